@@ -1,14 +1,13 @@
 #include <stdio.h>
 #include <shlwapi.h>
 #include "..\ME3SDK\ME3TweaksHeader.h"
-#include "..\ME3SDK\SdkHeaders.h"
+#include "..\ME3SDK\Packages\SFXGame.h"
+#include "..\ME3SDK\ProcessEventHub.h"
 #include <chrono>
 #include <thread>
 #include <functional>
-#include "../detours/detours.h"
 
 #define _CRT_SECURE_NO_WARNINGS
-#pragma comment(lib, "detours.lib") //Library needed for Hooking part.
 
 ME3TweaksASILogger logger("Ace Slammer v1", "AceSlammer.txt");
 
@@ -20,46 +19,42 @@ const int NEXTSTATE_UPGRAV = 3;
 const int NEXTSTATE_NORMAL = 4;
 int nextState = NEXTSTATE_UPGRAV;
 
-void __fastcall HookedPE(UObject* pObject, void* edx, UFunction* pFunction, void* pParms, void* pResult)
+bool OnPlayerTick(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult)
 {
 	if (fetchNextItem) {
-		char* szName = pFunction->GetFullName();
-		if (strcmp(szName, "Function SFXGame.BioPlayerController.PlayerTick") == 0)
+		bool nextStateSet = false;
+		ABioPlayerController* bpc = reinterpret_cast<ABioPlayerController*>(pObject);
+		if (!nextStateSet && nextState == NEXTSTATE_SLAMMING)
 		{
-			bool nextStateSet = false;
-			ABioPlayerController* bpc = reinterpret_cast<ABioPlayerController*>(pObject);
-			if (!nextStateSet && nextState == NEXTSTATE_SLAMMING)
-			{
-				bpc->WorldInfo->WorldGravityZ = -3100;
-				nextState = NEXTSTATE_NORMAL;
-				nextStateSet = true;
-			}
-			if (!nextStateSet && nextState == NEXTSTATE_NORMAL)
-			{
-				bpc ->WorldInfo->WorldGravityZ = -981;
-				nextState = NEXTSTATE_UPGRAV;
-				nextStateSet = true;
-			}
-			if (!nextStateSet && nextState == NEXTSTATE_ZEROG)
-			{
-				bpc->WorldInfo->WorldGravityZ = 3; //just slightly up
-				nextState = NEXTSTATE_SLAMMING;
-				nextStateSet = true;
-			}
-			if (!nextStateSet && nextState == NEXTSTATE_UPGRAV)
-			{
-				bpc->WorldInfo->WorldGravityZ = 500;
-				nextState = NEXTSTATE_ZEROG;
-				nextStateSet = true;
-			}
-
-			logger.writeToLog(string_format("GRAVITY: %f\n", bpc->WorldInfo->WorldGravityZ), true);
-			//logger.writeToConsoleOnly(string_format("Default gravity: %f", wi->DefaultGravityZ), true);
-			//logger.writeToLog(string_format("%s", szName), true);
-			fetchNextItem = false;
+			bpc->WorldInfo->WorldGravityZ = -3100;
+			nextState = NEXTSTATE_NORMAL;
+			nextStateSet = true;
+		}
+		if (!nextStateSet && nextState == NEXTSTATE_NORMAL)
+		{
+			bpc ->WorldInfo->WorldGravityZ = -981;
+			nextState = NEXTSTATE_UPGRAV;
+			nextStateSet = true;
+		}
+		if (!nextStateSet && nextState == NEXTSTATE_ZEROG)
+		{
+			bpc->WorldInfo->WorldGravityZ = 3; //just slightly up
+			nextState = NEXTSTATE_SLAMMING;
+			nextStateSet = true;
 		}
+		if (!nextStateSet && nextState == NEXTSTATE_UPGRAV)
+		{
+			bpc->WorldInfo->WorldGravityZ = 500;
+			nextState = NEXTSTATE_ZEROG;
+			nextStateSet = true;
+		}
+
+		logger.writeToLog(string_format("GRAVITY: %f\n", bpc->WorldInfo->WorldGravityZ), true);
+		//logger.writeToConsoleOnly(string_format("Default gravity: %f", wi->DefaultGravityZ), true);
+		//logger.writeToLog(string_format("%s", szName), true);
+		fetchNextItem = false;
 	}
-	ProcessEvent(pObject, pFunction, pParms, pResult);
+	return true;
 }
 
 void timer_start(function<unsigned(void)> func, unsigned int interval)
@@ -99,10 +94,8 @@ unsigned test()
 
 void onAttach()
 {
-	DetourTransactionBegin();
-	DetourUpdateThread(GetCurrentThread()); //This command set the current working thread to the game current thread.
-	DetourAttach(&(PVOID&)ProcessEvent, HookedPE); //This command will start your Hook.
-	DetourTransactionCommit();
+	ResolveSdkBindings(logger);
+	SubscribeProcessEvent("Function SFXGame.BioPlayerController.PlayerTick", OnPlayerTick);
 	std::this_thread::sleep_for(std::chrono::milliseconds(10000));
 	timer_start(test, 1000);
 }
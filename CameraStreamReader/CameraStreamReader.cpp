@@ -0,0 +1,340 @@
+// A reader for the camera slot ME3ExplorerInterop publishes the player's camera to, as a sample of following the
+// camera from another process and for benchmarking the stream without ME3Explorer. See readme.md for build
+// instructions.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include "../ME3ExplorerInterop/CameraStream.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static uint64_t NowNanoseconds()
+{
+	return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count());
+}
+
+/// <summary>
+/// The value at fraction p of the way through values, which are sorted here, so 1 gives the largest. 0 if there are
+/// none.
+/// </summary>
+static double Percentile(std::vector<double>& values, const double p)
+{
+	if (values.empty())
+	{
+		return 0;
+	}
+	std::sort(values.begin(), values.end());
+	return values[size_t(p * (values.size() - 1))];
+}
+
+#ifdef _WIN32
+static std::atomic<bool> stopping(false);
+
+static BOOL WINAPI OnConsoleEvent(DWORD)
+{
+	stopping = true;
+	return TRUE;
+}
+
+static float ToDegrees(const int32_t unrealRotationUnits)
+{
+	return unrealRotationUnits * 360.0f / 65536.0f;
+}
+
+/// <summary>
+/// Opens the game's slot, creating it if the game hasn't yet, asks for rate samples a second and prints each new
+/// one until Ctrl+C, then turns the stream off again.
+/// </summary>
+static int Follow(const uint32_t rate, const bool quiet)
+{
+	const auto section = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, sizeof(CameraStreamHeader),
+		CAMERASTREAM_SECTION_NAME);
+	if (!section)
+	{
+		fprintf(stderr, "Could not create or open %s\n", CAMERASTREAM_SECTION_NAME);
+		return 1;
+	}
+	const auto created = GetLastError() != ERROR_ALREADY_EXISTS;
+	const auto view = MapViewOfFile(section, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+	if (!view)
+	{
+		fprintf(stderr, "Could not map the camera slot\n");
+		return 1;
+	}
+	if (created)
+	{
+		InitializeCameraStream(view);
+	}
+	MEMORY_BASIC_INFORMATION region;
+	const auto header = GetCameraStream(view, VirtualQuery(view, &region, sizeof(region)) ? region.RegionSize : 0);
+	if (!header)
+	{
+		fprintf(stderr, "%s does not hold a camera slot this reader understands\n", CAMERASTREAM_SECTION_NAME);
+		return 1;
+	}
+
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	const auto ticksPerMillisecond = frequency.QuadPart / 1000.0;
+	SetConsoleCtrlHandler(OnConsoleEvent, TRUE);
+	CameraStreamReader reader(header);
+	reader.SetRate(rate);
+	printf("Following the camera at %u samples a second. Ctrl+C to stop.\n", rate);
+
+	auto haveLast = false;
+	uint32_t lastFrame = 0;
+	unsigned long long received = 0;
+	unsigned long long missed = 0;
+	std::vector<double> ages;
+	auto lastReport = Clock::now();
+	while (!stopping)
+	{
+		CameraStreamPOV pov;
+		if (reader.Read(pov) && (!haveLast || pov.Frame != lastFrame))
+		{
+			LARGE_INTEGER counter;
+			QueryPerformanceCounter(&counter);
+			const auto age = (counter.QuadPart - int64_t(pov.Timestamp)) / ticksPerMillisecond;
+			if (haveLast && pov.Frame > lastFrame)
+			{
+				missed += pov.Frame - lastFrame - 1;
+			}
+			haveLast = true;
+			lastFrame = pov.Frame;
+			received++;
+			if (quiet)
+			{
+				ages.push_back(age);
+			}
+			else
+			{
+				printf("%u (%.1f, %.1f, %.1f) pitch %.1f yaw %.1f roll %.1f, FOV %.1f, %.2f ms old\n", pov.Frame,
+					pov.Location[0], pov.Location[1], pov.Location[2], ToDegrees(pov.Pitch), ToDegrees(pov.Yaw),
+					ToDegrees(pov.Roll), pov.FOV, age);
+			}
+		}
+		if (quiet && std::chrono::duration<double>(Clock::now() - lastReport).count() >= 1.0)
+		{
+			printf("%llu received, %llu missed, %.2f ms old at median, %.2f ms at most\n", received, missed,
+				Percentile(ages, 0.5), Percentile(ages, 1));
+			received = missed = 0;
+			ages.clear();
+			lastReport = Clock::now();
+		}
+		Sleep(1);
+	}
+	reader.SetRate(0);
+	return 0;
+}
+#endif
+
+/// <summary>
+/// Runs the game's side and a reader on two threads over an in-process slot. The writer ticks like the game would,
+/// publishing whenever a sample is due, and every field of a sample is derived from its number so a torn read is
+/// caught. Reports what publishing cost the writer, how old samples were when the reader saw them, and how far apart
+/// they were published compared to the rate asked for.
+/// </summary>
+static int Bench(const uint32_t rate, const unsigned tickRate, const unsigned seconds, const unsigned pollMicroseconds)
+{
+	CameraStreamHeader slot;
+	InitializeCameraStream(&slot);
+	const auto header = GetCameraStream(&slot, sizeof(slot));
+	CameraStreamReader(header).SetRate(rate);
+
+	std::atomic<bool> done(false);
+	unsigned long long seen = 0;
+	unsigned long long missed = 0;
+	unsigned long long torn = 0;
+	unsigned long long retries = 0;
+	std::vector<double> latencies;
+	std::vector<double> jitters;
+	double intervalSum = 0;
+	std::thread readerThread([&]
+	{
+		CameraStreamReader reader(header);
+		auto haveLast = false;
+		CameraStreamPOV last = CameraStreamPOV();
+		while (!done)
+		{
+			CameraStreamPOV pov;
+			if (reader.Read(pov) && (!haveLast || pov.Frame != last.Frame))
+			{
+				const auto now = NowNanoseconds();
+				const auto number = float(pov.Frame & 0xFFFFFF);
+				if (pov.Pitch != int32_t(pov.Frame) || pov.Yaw != -pov.Pitch || pov.Roll != pov.Pitch ||
+					pov.Location[0] != number || pov.Location[1] != -number || pov.Location[2] != number || pov.FOV != number)
+				{
+					torn++;
+				}
+				latencies.push_back((now - pov.Timestamp) / 1e3);
+				if (haveLast && pov.Frame == last.Frame + 1)
+				{
+					const auto interval = (pov.Timestamp - last.Timestamp) / 1e3;
+					intervalSum += interval;
+					jitters.push_back(fabs(interval - 1e6 / rate));
+				}
+				else if (haveLast && pov.Frame > last.Frame)
+				{
+					missed += pov.Frame - last.Frame - 1;
+				}
+				haveLast = true;
+				last = pov;
+				seen++;
+			}
+			if (pollMicroseconds)
+			{
+				std::this_thread::sleep_for(std::chrono::microseconds(pollMicroseconds));
+			}
+		}
+		retries = reader.GetRetries();
+	});
+
+	CameraStreamWriter writer(header);
+	std::vector<double> publishTimes;
+	uint32_t published = 0;
+	const auto tick = tickRate ? std::chrono::nanoseconds(1000000000 / tickRate) : std::chrono::nanoseconds(0);
+	const auto start = Clock::now();
+	const auto end = start + std::chrono::seconds(seconds);
+	auto nextTick = start;
+	for (auto now = start; now < end; now = Clock::now())
+	{
+		const auto nanoseconds = NowNanoseconds();
+		if (writer.IsWanted() && writer.IsDue(nanoseconds, 1000000000))
+		{
+			const auto number = float(published & 0xFFFFFF);
+			CameraStreamPOV pov;
+			pov.Location[0] = number;
+			pov.Location[1] = -number;
+			pov.Location[2] = number;
+			pov.Pitch = int32_t(published);
+			pov.Yaw = -int32_t(published);
+			pov.Roll = int32_t(published);
+			pov.FOV = number;
+			pov.Timestamp = nanoseconds;
+			const auto before = Clock::now();
+			writer.Publish(pov);
+			publishTimes.push_back(std::chrono::duration<double, std::nano>(Clock::now() - before).count());
+			published++;
+		}
+		if (tickRate)
+		{
+			nextTick += tick;
+			std::this_thread::sleep_until(nextTick);
+		}
+	}
+	done = true;
+	readerThread.join();
+
+	printf("%u s, writer ticking %s, stream at %u a second, reader polling %s\n", seconds,
+		tickRate ? (std::to_string(tickRate) + " times a second").c_str() : "back to back", rate,
+		pollMicroseconds ? ("every " + std::to_string(pollMicroseconds) + " us").c_str() : "without pause");
+	printf("  Publish: median %.0f ns, p99 %.0f ns, max %.0f ns\n", Percentile(publishTimes, 0.5),
+		Percentile(publishTimes, 0.99), Percentile(publishTimes, 1));
+	printf("  %u published, %llu seen, %llu missed, %llu reads retried, %llu torn\n", published, seen, missed, retries,
+		torn);
+	printf("  Age when seen: median %.1f us, p99 %.1f us, max %.1f us\n", Percentile(latencies, 0.5),
+		Percentile(latencies, 0.99), Percentile(latencies, 1));
+	printf("  Interval: mean %.3f ms against %.3f ms asked for, off by median %.1f us, p99 %.1f us, max %.1f us\n",
+		jitters.empty() ? 0.0 : intervalSum / jitters.size() / 1e3, 1e3 / rate, Percentile(jitters, 0.5),
+		Percentile(jitters, 0.99), Percentile(jitters, 1));
+	return torn || !seen ? 1 : 0;
+}
+
+static void PrintUsage()
+{
+	printf("Usage: CameraStreamReader <follow|bench> [options]\n");
+#ifdef _WIN32
+	printf("  follow              Asks the game for the camera and prints every sample\n");
+	printf("    --rate <hz>       Samples a second, default 60\n");
+	printf("    --quiet           Prints counts and ages once a second instead of samples\n");
+#endif
+	printf("  bench               Runs a writer and this reader on two threads over a private slot\n");
+	printf("    --rate <hz>       Samples a second, default 60\n");
+	printf("    --tick <hz>       Writer ticks a second, like the game's frame rate, or 0 for back to back, default 144\n");
+	printf("    --seconds <n>     How long to run, default 5\n");
+	printf("    --poll <us>       Time between the reader's reads, or 0 to spin, default 100\n");
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		PrintUsage();
+		return 1;
+	}
+	const std::string command = argv[1];
+	unsigned rate = 60;
+	unsigned tickRate = 144;
+	unsigned seconds = 5;
+	unsigned poll = 100;
+#ifdef _WIN32
+	auto quiet = false;
+#endif
+	for (auto i = 2; i < argc; i++)
+	{
+		const std::string option = argv[i];
+#ifdef _WIN32
+		if (option == "--quiet")
+		{
+			quiet = true;
+			continue;
+		}
+#endif
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "Missing value for %s\n", option.c_str());
+			return 1;
+		}
+		const auto value = unsigned(strtoul(argv[++i], nullptr, 10));
+		if (option == "--rate")
+		{
+			rate = value;
+		}
+		else if (option == "--tick")
+		{
+			tickRate = value;
+		}
+		else if (option == "--seconds")
+		{
+			seconds = value;
+		}
+		else if (option == "--poll")
+		{
+			poll = value;
+		}
+		else
+		{
+			fprintf(stderr, "Unknown option %s\n", option.c_str());
+			return 1;
+		}
+	}
+
+	if (!rate)
+	{
+		fprintf(stderr, "The rate must be at least 1\n");
+		return 1;
+	}
+	if (command == "bench")
+	{
+		return Bench(rate, tickRate, seconds, poll);
+	}
+#ifdef _WIN32
+	if (command == "follow")
+	{
+		return Follow(rate, quiet);
+	}
+#endif
+	PrintUsage();
+	return 1;
+}
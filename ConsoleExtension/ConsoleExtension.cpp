@@ -11,13 +11,12 @@
 
 #include "../ME3SDK/ME3TweaksHeader.h"
 #include "../ME3SDK/ScreenLogger.h"
-#include "../ME3SDK/SdkHeaders.h"
-#include "../detours/detours.h"
+#include "../ME3SDK/Packages/SFXGame.h"
+#include "../ME3SDK/ProcessEventHub.h"
 
 #include "SimpleSerializer.h"
 
 #define _CRT_SECURE_NO_WARNINGS
-#pragma comment(lib, "detours.lib") //Library needed for Hooking part.
 
 
 #define LOGGING 0
@@ -88,41 +87,44 @@ void HandleConsoleCommand(USFXConsole* console, const wstring& cmd)
 	}
 }
 
-void __fastcall HookedPE(UObject* pObject, void* edx, UFunction* pFunction, void* pParms, void* pResult)
+bool OnConsoleInputChar(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult)
 {
-	const auto funcName = pFunction->GetFullName();
-	if (IsA<USFXConsole>(pObject) && isPartOf(funcName, "Function Console.Typing.InputChar"))
+	const auto inputCharParams = static_cast<UConsole_execInputChar_Parms*>(pParms);
+	if (inputCharParams->Unicode.Count >= 1 && inputCharParams->Unicode(0) == '\r')
 	{
-		const auto inputCharParams = static_cast<UConsole_execInputChar_Parms*>(pParms);
-		if (inputCharParams->Unicode.Count >= 1 && inputCharParams->Unicode(0) == '\r')
-		{
-			const auto console = static_cast<USFXConsole*>(pObject);
-			wstringstream ss;
-			ss << console->TypedStr;
-			HandleConsoleCommand(console, ss.str());
+		const auto console = static_cast<USFXConsole*>(pObject);
+		wstringstream ss;
+		ss << console->TypedStr;
+		HandleConsoleCommand(console, ss.str());
 #if LOGGING 
-			ss << endl;
-			const wstring msg = ss.str();
-			logger.writeToDiskOnly(msg, true);
-			screenLogger.LogMessage(msg);
+		ss << endl;
+		const wstring msg = ss.str();
+		logger.writeToDiskOnly(msg, true);
+		screenLogger.LogMessage(msg);
 #endif
-
-}
 	}
+	return true;
+}
+
 #if LOGGING
-	else if (!strcmp(funcName, "Function SFXGame.BioHUD.PostRender"))
-	{
-		const auto hud = static_cast<ABioHUD*>(pObject);
-		screenLogger.PostRenderer(hud);
-	}
+bool OnBioHUDPostRender(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult)
+{
+	const auto hud = static_cast<ABioHUD*>(pObject);
+	screenLogger.PostRenderer(hud);
+	return true;
+}
 #endif
 
-	else if (IsA<ABioPlayerController>(pObject) && isPartOf(pFunction->GetFullName(), "Function SFXGame.BioPlayerController.PlayerTick"))
-	{
-		const auto playerController = static_cast<ABioPlayerController*>(pObject);
-		cachedPOV = playerController->PlayerCamera->CameraCache.POV;
-	}
-	else if (shouldSetCamPOV && !strcmp(funcName, "Function Engine.Camera.UpdateCamera"))
+bool OnPlayerTick(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult)
+{
+	const auto playerController = static_cast<ABioPlayerController*>(pObject);
+	cachedPOV = playerController->PlayerCamera->CameraCache.POV;
+	return true;
+}
+
+bool OnCameraUpdateCamera(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult)
+{
+	if (shouldSetCamPOV)
 	{
 		const auto camera = static_cast<ACamera*>(pObject);
 		if (IsA<AActor>(camera->PCOwner))
@@ -133,15 +135,18 @@ void __fastcall HookedPE(UObject* pObject, void* edx, UFunction* pFunction, void
 			actor->Rotation = povToLoad.Rotation;
 		}
 	}
-	ProcessEvent(pObject, pFunction, pParms, pResult);
+	return true;
 }
 
 void onAttach()
 {
-	DetourTransactionBegin();
-	DetourUpdateThread(GetCurrentThread()); //This command set the current working thread to the game current thread.
-	DetourAttach(&(PVOID&)ProcessEvent, HookedPE); //This command will start your Hook.
-	DetourTransactionCommit();
+	ResolveSdkBindings(logger);
+	SubscribeProcessEvent("Function Console.Typing.InputChar", OnConsoleInputChar, nullptr, &USFXConsole::StaticClass);
+#if LOGGING
+	SubscribeProcessEvent("Function SFXGame.BioHUD.PostRender", OnBioHUDPostRender);
+#endif
+	SubscribeProcessEvent("Function SFXGame.BioPlayerController.PlayerTick", OnPlayerTick, nullptr, &ABioPlayerController::StaticClass);
+	SubscribeProcessEvent("Function Engine.Camera.UpdateCamera", OnCameraUpdateCamera);
 
 	if (_access_s(savedCamsFileName, 0) == 0) // does file exist
 	{
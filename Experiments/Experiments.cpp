@@ -9,11 +9,10 @@
 #include <shlwapi.h>
 
 #include "..\ME3SDK\ME3TweaksHeader.h"
-#include "..\ME3SDK\SdkHeaders.h"
-#include "..\detours\detours.h"
+#include "..\ME3SDK\Packages\SFXGame.h"
+#include "..\ME3SDK\ProcessEventHub.h"
 
 #define _CRT_SECURE_NO_WARNINGS
-#pragma comment(lib, "detours.lib") //Library needed for Hooking part.
 
 //ME3TweaksASILogger logger("Match Stats Collector", "MatchStats.txt");
 ME3TweaksASILogger logger("MP Controller Client Fix", "WorldInfo.txt");
@@ -32,12 +31,11 @@ FVector inline RotationToVector(FRotator Rotation) {
 	return Vector;
 }
 
-void __fastcall HookedPE(UObject* pObject, void* edx, UFunction* pFunction, void* pParms, void* pResult)
+bool OnSFXConsoleInputKey(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult)
 {
-	char* szName = pFunction->GetFullName();
 	//if (isPartOf(szName, "Function Engine.DebugCameraHUD.PostRender"))
 	//{
-	//	ProcessEvent(pObject, pFunction, pParms, pResult);
+	//	CallOriginalProcessEvent(pObject, pFunction, pParms, pResult);
 	//	ADebugCameraHUD* debugCameraHud = (ADebugCameraHUD*)pObject;
 	//	if (!debugCameraHud->Canvas)
 	//	{
@@ -113,34 +111,29 @@ void __fastcall HookedPE(UObject* pObject, void* edx, UFunction* pFunction, void
 	//		actor->WorldInfo->bUseConsoleInput = 1;
 	//	}*/
 	//}
-	//else 
-	if (isPartOf(szName, "Function SFXGame.SFXConsole.InputKey")) {
-		USFXConsole_execInputKey_Parms* params = (USFXConsole_execInputKey_Parms*)pParms;
-		//Event: 0 - > Down
-		//Event: 1 - > Up
-		//Event: 2 - > Holding
-		//logger.writeToConsoleOnly(string_format("Key pressed: %u %s\n", params->Event, params->Key.GetName()), true);
-		if (isPartOf(params->Key.GetName(), "Xbox")) {
-			if (params->Event == 0) {
-				logger.writeToConsoleOnly(string_format("%s DOWN\n", params->Key.GetName()), true);
-			}
-			else if (params->Event == 1) {
-				logger.writeToConsoleOnly(string_format("%s UP\n", params->Key.GetName()), true);
-			}
-			else if (params->Event == 2) {
-				logger.writeToConsoleOnly(string_format("%s HOLD\n", params->Key.GetName()), true);
-			}
+	USFXConsole_execInputKey_Parms* params = (USFXConsole_execInputKey_Parms*)pParms;
+	//Event: 0 - > Down
+	//Event: 1 - > Up
+	//Event: 2 - > Holding
+	//logger.writeToConsoleOnly(string_format("Key pressed: %u %s\n", params->Event, params->Key.GetName()), true);
+	if (isPartOf(params->Key.GetName(), "Xbox")) {
+		if (params->Event == 0) {
+			logger.writeToConsoleOnly(string_format("%s DOWN\n", params->Key.GetName()), true);
+		}
+		else if (params->Event == 1) {
+			logger.writeToConsoleOnly(string_format("%s UP\n", params->Key.GetName()), true);
+		}
+		else if (params->Event == 2) {
+			logger.writeToConsoleOnly(string_format("%s HOLD\n", params->Key.GetName()), true);
 		}
 	}
-	ProcessEvent(pObject, pFunction, pParms, pResult);
+	return true;
 }
 
 void onAttach()
 {
-	DetourTransactionBegin();
-	DetourUpdateThread(GetCurrentThread()); //This command set the current working thread to the game current thread.
-	DetourAttach(&(PVOID&)ProcessEvent, HookedPE); //This command will start your Hook.
-	DetourTransactionCommit();
+	ResolveSdkBindings(logger);
+	SubscribeProcessEvent("Function SFXGame.SFXConsole.InputKey", OnSFXConsoleInputKey);
 }
 
 /******************************************************************************
@@ -8,34 +8,25 @@
 #include <streambuf>
 #include <shlwapi.h>
 
-#include "..\ME3SDK\SdkHeaders.h"
-#include "..\detours\detours.h"
+#include "..\ME3SDK\Packages\SFXOnlineFoundation.h"
+#include "..\ME3SDK\ProcessEventHub.h"
 
 #define _CRT_SECURE_NO_WARNINGS
-#pragma comment(lib, "detours.lib") //Library needed for Hooking part.
 
-typedef void(__thiscall *tProcessEvent)(class UObject *, class UFunction *, void *, void *);
-tProcessEvent ProcessEvent = (tProcessEvent)0x00453120;
-
-void __fastcall HookedPE(UObject *pObject, void *edx, UFunction *pFunction, void *pParms, void *pResult)
+bool OnGetRatingsComplete(UObject *pObject, UFunction *pFunction, void *pParms, void *pResult)
 {
-	char *szName = pFunction->GetFullName();
-	if (!strcmp(szName, "Function SFXGame.SFXGAWAssetsHandler.OnGetRatingsComplete")) {
-		USFXOnlineComponentBlazeNotification_execGetGalaxyAtWarRatingsCompleted_Parms* parms = (USFXOnlineComponentBlazeNotification_execGetGalaxyAtWarRatingsCompleted_Parms*)pParms;
-		parms->Level = 100;
-		for (int i = 0; i < parms->updatedSecurityRatings.Count; i++) {
-			parms->updatedSecurityRatings(i) = 100;
-		}
+	USFXOnlineComponentBlazeNotification_execGetGalaxyAtWarRatingsCompleted_Parms* parms = (USFXOnlineComponentBlazeNotification_execGetGalaxyAtWarRatingsCompleted_Parms*)pParms;
+	parms->Level = 100;
+	for (int i = 0; i < parms->updatedSecurityRatings.Count; i++) {
+		parms->updatedSecurityRatings(i) = 100;
 	}
-	ProcessEvent(pObject, pFunction, pParms, pResult);
+	return true;
 }
 
 void onAttach()
 {
-	DetourTransactionBegin();
-	DetourUpdateThread(GetCurrentThread()); //This command set the current working thread to the game current thread.
-	DetourAttach(&(PVOID&)ProcessEvent, HookedPE); //This command will start your Hook.
-	DetourTransactionCommit();
+	SdkBindings::ResolveAll();
+	SubscribeProcessEvent("Function SFXGame.SFXGAWAssetsHandler.OnGetRatingsComplete", OnGetRatingsComplete);
 }
 
 BOOL WINAPI DllMain(HMODULE hModule, DWORD dwReason, LPVOID lpReserved)
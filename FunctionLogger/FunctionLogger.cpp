@@ -7,31 +7,144 @@
 #include <ostream>
 #include <streambuf>
 #include <shlwapi.h>
+#include <climits>
 
 #include "..\ME3SDK\ME3TweaksHeader.h"
-#include "..\ME3SDK\SdkHeaders.h"
-#include "..\detours\detours.h"
+#include "..\ME3SDK\Packages\Core.h"
+#include "..\ME3SDK\ProcessEventHub.h"
+#include "..\ME3SDK\FullNameCache.h"
+#include "FunctionProfiler.h"
+#include "FunctionTraceWriter.h"
 
 #define _CRT_SECURE_NO_WARNINGS
-#pragma comment(lib, "detours.lib") //Library needed for Hooking part.
 
-ME3TweaksASILogger logger("Function Call Logger", "FunctionCallLog.txt");
+// What to record for every ProcessEvent call:
+// LOGMODE_TEXT writes one timestamped line per call to FunctionCallLog.txt from a background writer thread. The
+// console is left out, it can't keep up with a line per call. With TEXTLOG_CRASHSAFE set to 1 the lines go to
+// FunctionCallLog.txt.ring instead, which keeps the last 64 MB even if the game crashes. Read it with LogLinearizer.
+// LOGMODE_PROFILE collects per-function call counts and timings and writes sorted reports to FunctionCallProfile.txt.
+// LOGMODE_TRACE writes compact binary records to FunctionCallTrace.bin. Decode it with FunctionTraceDecoder.
+#define LOGMODE_TEXT 0
+#define LOGMODE_PROFILE 1
+#define LOGMODE_TRACE 2
+#define LOGMODE LOGMODE_TEXT
+#define TEXTLOG_CRASHSAFE 0
 
-void __fastcall HookedPE(UObject *pObject, void *edx, UFunction *pFunction, void *pParms, void *pResult)
+// Writes a profile report or flushes the trace when this key is pressed...
+#define REPORT_KEY VK_F11
+// ...and every this many seconds. 0 to only report on the key.
+#define REPORT_SECONDS 30
+
+/// <summary>
+/// Polls the report key and timer forever, raising the flag for the game thread to act on.
+/// </summary>
+/// <param name="requested"></param>
+void WatchReportTriggers(std::atomic<bool>& requested)
+{
+	auto lastReport = GetTickCount64();
+	while (true)
+	{
+		Sleep(100);
+		const auto now = GetTickCount64();
+		const auto keyPressed = (GetAsyncKeyState(REPORT_KEY) & 1) != 0;
+		if (keyPressed || (REPORT_SECONDS && now - lastReport >= REPORT_SECONDS * 1000ULL))
+		{
+			requested = true;
+			lastReport = now;
+		}
+	}
+}
+
+#if LOGMODE == LOGMODE_PROFILE
+ME3TweaksASILogger logger("Function Call Profiler", "FunctionCallProfile.txt", false);
+FunctionProfiler profiler;
+std::atomic<bool> reportRequested{ false };
+
+bool OnProfiledFunctionBegin(UObject *pObject, UFunction *pFunction, void *pParms, void *pResult)
 {
-	char *szName = pFunction->GetFullName();
-	logger.writeToLog(string_format("%s\n", szName), true);
-	logger.flush();
-	ProcessEvent(pObject, pFunction, pParms, pResult);
+	// Reports are written between top level calls so no frame is open while the stats are walked.
+	if (reportRequested && profiler.IsIdle())
+	{
+		profiler.WriteReport(logger);
+		reportRequested = false;
+	}
+	profiler.Begin(pFunction);
+	return true;
+}
+
+void OnProfiledFunctionEnd(UObject *pObject, UFunction *pFunction, void *pParms, void *pResult)
+{
+	profiler.End(pFunction);
+}
+
+void onAttach()
+{
+	ResolveSdkBindings(logger);
+	profiler.Calibrate();
+	// Lowest priority: the profiler's Begin runs before, and its End after, every other subscriber's callbacks.
+	SubscribeProcessEvent(nullptr, OnProfiledFunctionBegin, OnProfiledFunctionEnd, nullptr, nullptr, INT_MIN);
+	WatchReportTriggers(reportRequested);
+}
+#elif LOGMODE == LOGMODE_TRACE
+ME3TweaksASILogger logger("Function Call Tracer", "FunctionCallTraceLog.txt", false);
+FunctionTraceWriter trace;
+std::atomic<bool> flushRequested{ false };
+int traceDepth = 0;
+
+bool OnTracedFunctionBegin(UObject *pObject, UFunction *pFunction, void *pParms, void *pResult)
+{
+	if (flushRequested && traceDepth == 0)
+	{
+		trace.Flush();
+		flushRequested = false;
+	}
+	trace.Call(pObject, pFunction, traceDepth++);
+	return true;
+}
+
+void OnTracedFunctionEnd(UObject *pObject, UFunction *pFunction, void *pParms, void *pResult)
+{
+	traceDepth--;
+}
+
+void onAttach()
+{
+	ResolveSdkBindings(logger);
+	const auto ticksPerSecond = (unsigned long long)(FunctionProfiler::MeasureCyclesPerMs() * 1000.0);
+	if (!trace.Open("FunctionCallTrace.bin", ticksPerSecond))
+	{
+		logger.writeToDiskOnly("Could not create FunctionCallTrace.bin\n"s, true);
+		logger.flush();
+		return;
+	}
+	SubscribeProcessEvent(nullptr, OnTracedFunctionBegin, OnTracedFunctionEnd, nullptr, nullptr, INT_MIN);
+	WatchReportTriggers(flushRequested);
+}
+#else
+#if TEXTLOG_CRASHSAFE
+ME3TweaksASILogger logger("Function Call Logger", "FunctionCallLog.txt", false, LogBackend::Mapped, LogOverflow::Count, 64 * 1024 * 1024);
+#else
+ME3TweaksASILogger logger("Function Call Logger", "FunctionCallLog.txt", false, LogBackend::Async, LogOverflow::Count);
+#endif
+
+FullNameCache fullNames;
+
+bool OnAnyFunction(UObject *pObject, UFunction *pFunction, void *pParms, void *pResult)
+{
+	string line;
+	line.reserve(128);
+	fullNames.Append(pFunction, line);
+	line += '\n';
+	logger.writeToLog(std::move(line), true);
+	return true;
 }
 
 void onAttach()
 {
-	DetourTransactionBegin();
-	DetourUpdateThread(GetCurrentThread()); //This command set the current working thread to the game current thread.
-	DetourAttach(&(PVOID&)ProcessEvent, HookedPE); //This command will start your Hook.
-	DetourTransactionCommit();
+	ResolveSdkBindings(logger);
+	SubscribeProcessEvent(nullptr, OnAnyFunction);
 }
+#endif
 
 BOOL WINAPI DllMain(HMODULE hModule, DWORD dwReason, LPVOID lpReserved)
 {
@@ -44,6 +157,7 @@ BOOL WINAPI DllMain(HMODULE hModule, DWORD dwReason, LPVOID lpReserved)
 		break;
 
 	case DLL_PROCESS_DETACH:
+		logger.shutdown();
 		return true;
 		break;
 	}
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <intrin.h>
+#include <algorithm>
+#include <vector>
+#include "..\ME3SDK\ME3TweaksHeader.h"
+#include "..\ME3SDK\Packages\Core.h"
+
+/// <summary>
+/// Counts calls and TSC cycles spent in every UFunction that goes through ProcessEvent. Stats live in a flat array
+/// indexed by the function's object index, so a call costs two rdtsc reads and a handful of adds; names are only
+/// built when a report is written. Begin/End must be paired and called from the game thread.
+/// </summary>
+class FunctionProfiler
+{
+public:
+	// Calls nested deeper than this are still counted, but not timed.
+	static const int MaxDepth = 512;
+
+	void Begin(UFunction* function)
+	{
+		const auto index = function->ObjectInternalInteger;
+		if (index < 0 || Depth >= MaxDepth)
+		{
+			Depth++;
+			return;
+		}
+		auto& stats = GetStats(index, function);
+		stats.Calls++;
+		stats.ActiveDepth++;
+
+		auto& frame = Frames[Depth++];
+		frame.Stats = &stats;
+		frame.ChildCycles = 0;
+		frame.Start = __rdtsc();
+	}
+
+	void End(UFunction* function)
+	{
+		const auto now = __rdtsc();
+		Depth--;
+		if (function->ObjectInternalInteger < 0 || Depth >= MaxDepth)
+		{
+			return;
+		}
+
+		auto& frame = Frames[Depth];
+		const auto elapsed = now - frame.Start;
+		auto& stats = *frame.Stats;
+		stats.ExclusiveCycles += elapsed - frame.ChildCycles;
+		// Recursive calls are already covered by the outermost one.
+		if (--stats.ActiveDepth == 0)
+		{
+			stats.InclusiveCycles += elapsed;
+		}
+		if (Depth > 0)
+		{
+			Frames[Depth - 1].ChildCycles += elapsed;
+		}
+	}
+
+	/// <summary>
+	/// Measures the TSC rate against the performance counter. Sleeps for 50 ms, so call it from the attach thread
+	/// rather than DllMain.
+	/// </summary>
+	/// <returns></returns>
+	static double MeasureCyclesPerMs()
+	{
+		LARGE_INTEGER frequency, qpcStart, qpcEnd;
+		QueryPerformanceFrequency(&frequency);
+		QueryPerformanceCounter(&qpcStart);
+		const auto tscStart = __rdtsc();
+		Sleep(50);
+		QueryPerformanceCounter(&qpcEnd);
+		const auto tscEnd = __rdtsc();
+		const auto ms = double(qpcEnd.QuadPart - qpcStart.QuadPart) * 1000.0 / double(frequency.QuadPart);
+		return double(tscEnd - tscStart) / ms;
+	}
+
+	/// <summary>
+	/// Measures the TSC rate so reports can be printed in milliseconds, and starts the report period.
+	/// </summary>
+	void Calibrate()
+	{
+		CyclesPerMs = MeasureCyclesPerMs();
+		ResetTsc = __rdtsc();
+	}
+
+	/// <summary>
+	/// True when no profiled call is in progress, i.e. it's safe to walk or reset the stats.
+	/// </summary>
+	bool IsIdle() const
+	{
+		return Depth == 0;
+	}
+
+	/// <summary>
+	/// Writes the top functions by exclusive time to the logger. Only call while IsIdle().
+	/// </summary>
+	/// <param name="logger"></param>
+	/// <param name="maxEntries"></param>
+	void WriteReport(ME3TweaksASILogger& logger, const size_t maxEntries = 200)
+	{
+		std::vector<const FunctionStats*> sorted;
+		unsigned long long totalExclusive = 0;
+		for (const auto& stats : Stats)
+		{
+			if (stats.Calls)
+			{
+				sorted.push_back(&stats);
+				totalExclusive += stats.ExclusiveCycles;
+			}
+		}
+		std::sort(sorted.begin(), sorted.end(), [](const FunctionStats* a, const FunctionStats* b)
+		{
+			return a->ExclusiveCycles > b->ExclusiveCycles;
+		});
+
+		const auto sinceReset = double(__rdtsc() - ResetTsc) / CyclesPerMs;
+		logger.writeToDiskOnly(string_format("Profile of %.0f ms, %u functions called\n", sinceReset, unsigned(sorted.size())), true);
+		logger.writeToDiskOnly(string_format("%12s %12s %12s %8s %10s  %s\n", "Calls", "Excl ms", "Incl ms", "Excl %", "ns/call", "Function"), false);
+		for (size_t i = 0; i < sorted.size() && i < maxEntries; i++)
+		{
+			const auto stats = sorted[i];
+			const auto exclusiveMs = double(stats->ExclusiveCycles) / CyclesPerMs;
+			const auto inclusiveMs = double(stats->InclusiveCycles) / CyclesPerMs;
+			const auto percent = totalExclusive ? 100.0 * double(stats->ExclusiveCycles) / double(totalExclusive) : 0.0;
+			logger.writeToDiskOnly(string_format("%12llu %12.3f %12.3f %7.2f%% %10.1f  %s\n", stats->Calls, exclusiveMs, inclusiveMs,
+				percent, exclusiveMs * 1000000.0 / double(stats->Calls), stats->Function->GetFullName()), false);
+		}
+		logger.writeToDiskOnly("\n"s, false);
+		logger.flush();
+	}
+
+	/// <summary>
+	/// Clears all counters. Only call while IsIdle().
+	/// </summary>
+	void Reset()
+	{
+		for (auto& stats : Stats)
+		{
+			stats.Calls = 0;
+			stats.InclusiveCycles = 0;
+			stats.ExclusiveCycles = 0;
+		}
+		ResetTsc = __rdtsc();
+	}
+
+private:
+	struct FunctionStats
+	{
+		UFunction* Function;
+		unsigned long long Calls;
+		unsigned long long InclusiveCycles;
+		unsigned long long ExclusiveCycles;
+		int ActiveDepth;
+	};
+
+	struct Frame
+	{
+		FunctionStats* Stats;
+		unsigned long long Start;
+		unsigned long long ChildCycles;
+	};
+
+	std::vector<FunctionStats> Stats;
+	Frame Frames[MaxDepth];
+	int Depth = 0;
+	double CyclesPerMs = 1.0;
+	unsigned long long ResetTsc = 0;
+
+	FunctionStats& GetStats(const int index, UFunction* function)
+	{
+		if (unsigned(index) >= Stats.size())
+		{
+			Grow(index);
+		}
+		auto& stats = Stats[index];
+		if (stats.Function != function)
+		{
+			// The slot was reused by a new object after the previous function was garbage collected.
+			stats = FunctionStats{ function, 0, 0, 0, 0 };
+		}
+		return stats;
+	}
+
+	void Grow(const int index)
+	{
+		const auto oldBase = Stats.data();
+		const auto objMax = UObject::GObjObjects()->Max;
+		Stats.resize(index < objMax ? objMax : index + 1024, FunctionStats{ nullptr, 0, 0, 0, 0 });
+
+		// Growing moves the array, which would leave open frames pointing at the old one.
+		for (auto i = 0; i < Depth && i < MaxDepth; i++)
+		{
+			Frames[i].Stats = Stats.data() + (Frames[i].Stats - oldBase);
+		}
+	}
+};
@@ -0,0 +1,75 @@
+#pragma once
+
+// On-disk layout of FunctionLogger's binary call trace. Shared with FunctionTraceDecoder, so this header must
+// stay free of Windows and SDK dependencies.
+//
+// A trace is a FunctionTraceHeader followed by chunks. Each chunk is a FunctionTraceChunk followed by Size bytes
+// holding Count entries of the chunk's type. Chunks must be read in order: Names and Objects chunks describe the
+// objects that the Calls chunks after them refer to by object index. An object index can be described again
+// later when the game reuses the slot for a different object.
+
+#include <stdint.h>
+
+#define FUNCTIONTRACE_MAGIC 0x43525446 // "FTRC"
+#define FUNCTIONTRACE_VERSION 1
+
+// FunctionIndex of a call record that only advances the clock, for gaps that don't fit in TicksDelta.
+// The full gap is ((uint64_t)ObjectIndex << 32) | TicksDelta.
+#define FUNCTIONTRACE_TIMESKIP -1
+
+enum FunctionTraceChunkType : uint32_t
+{
+	FTCHUNK_Names = 1,
+	FTCHUNK_Objects = 2,
+	FTCHUNK_Calls = 3,
+};
+
+#pragma pack(push, 1)
+
+struct FunctionTraceHeader
+{
+	uint32_t Magic;
+	uint32_t Version;
+	// Rate of the clock that call deltas are measured in.
+	uint64_t TicksPerSecond;
+};
+
+struct FunctionTraceChunk
+{
+	uint32_t Type;
+	uint32_t Count;
+	uint32_t Size;
+};
+
+// Followed by Length characters, not null terminated.
+struct FunctionTraceName
+{
+	uint32_t Id;
+	uint16_t Length;
+};
+
+struct FunctionTraceObject
+{
+	int32_t Index;
+	// -1 when the object has no class or outer.
+	int32_t ClassIndex;
+	int32_t OuterIndex;
+	uint32_t NameId;
+	uint32_t NameNumber;
+};
+
+struct FunctionTraceCall
+{
+	// Ticks since the previous call record.
+	uint32_t TicksDelta;
+	int32_t FunctionIndex;
+	// -1 when the object has no index.
+	int32_t ObjectIndex;
+	// Number of ProcessEvent calls on the stack when this one started.
+	uint16_t Depth;
+	uint16_t Reserved;
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(FunctionTraceCall) == 16, "Call records must stay 16 bytes");
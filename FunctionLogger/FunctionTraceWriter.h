@@ -0,0 +1,252 @@
+#pragma once
+
+#include <intrin.h>
+#include <stdio.h>
+#include <string.h>
+#include <unordered_map>
+#include <vector>
+#include "..\ME3SDK\Packages\Core.h"
+#include "FunctionTraceFormat.h"
+
+/// <summary>
+/// Appends a 16 byte record per ProcessEvent call to a memory buffer and writes it to disk in large blocks.
+/// Objects are described (name, class, outer) the first time their index shows up, starting with a snapshot of
+/// the whole object table, so call records only carry object indices. Call from the game thread only.
+/// </summary>
+class FunctionTraceWriter
+{
+public:
+	// The buffer is written out once it grows past this many bytes.
+	static const size_t FlushThreshold = 4 * 1024 * 1024;
+
+	~FunctionTraceWriter()
+	{
+		if (File)
+		{
+			Flush();
+			fclose(File);
+		}
+	}
+
+	/// <summary>
+	/// Creates the trace file and writes the header and object table snapshot. Returns false if the file
+	/// can't be created.
+	/// </summary>
+	/// <param name="fileName"></param>
+	/// <param name="ticksPerSecond">Rate of __rdtsc()</param>
+	/// <returns></returns>
+	bool Open(const char* fileName, const unsigned long long ticksPerSecond)
+	{
+		if (fopen_s(&File, fileName, "wb") != 0 || !File)
+		{
+			File = nullptr;
+			return false;
+		}
+		Buffer.reserve(FlushThreshold + 64 * 1024);
+
+		FunctionTraceHeader header;
+		header.Magic = FUNCTIONTRACE_MAGIC;
+		header.Version = FUNCTIONTRACE_VERSION;
+		header.TicksPerSecond = ticksPerSecond;
+		Append(&header, sizeof(header));
+
+		const auto objects = UObject::GObjObjects();
+		for (auto i = 0; i < objects->Count; i++)
+		{
+			if (objects->Data[i])
+			{
+				Describe(objects->Data[i]);
+			}
+		}
+		WritePendingDescriptions();
+		LastTicks = __rdtsc();
+		return true;
+	}
+
+	bool IsOpen() const
+	{
+		return File != nullptr;
+	}
+
+	void Call(UObject* object, UFunction* function, const int depth)
+	{
+		const auto now = __rdtsc();
+		Describe(function);
+		Describe(object);
+		if (!PendingObjects.empty())
+		{
+			WritePendingDescriptions();
+		}
+
+		if (CallsChunkOffset == NoChunk)
+		{
+			CallsChunkOffset = BeginChunk(FTCHUNK_Calls);
+		}
+
+		auto delta = now - LastTicks;
+		LastTicks = now;
+		if (delta > 0xFFFFFFFFULL)
+		{
+			AppendCall(FunctionTraceCall{ unsigned(delta), FUNCTIONTRACE_TIMESKIP, int(delta >> 32), 0, 0 });
+			delta = 0;
+		}
+		AppendCall(FunctionTraceCall{ unsigned(delta), function->ObjectInternalInteger, object ? object->ObjectInternalInteger : -1,
+			unsigned short(depth < 0xFFFF ? depth : 0xFFFF), 0 });
+
+		if (Buffer.size() >= FlushThreshold)
+		{
+			Flush();
+		}
+	}
+
+	/// <summary>
+	/// Writes everything buffered so far to disk.
+	/// </summary>
+	void Flush()
+	{
+		EndChunk(CallsChunkOffset);
+		if (File && !Buffer.empty())
+		{
+			fwrite(Buffer.data(), 1, Buffer.size(), File);
+			fflush(File);
+		}
+		Buffer.clear();
+	}
+
+private:
+	static const size_t NoChunk = size_t(-1);
+
+	struct PendingName
+	{
+		unsigned Id;
+		const char* Name;
+	};
+
+	FILE* File = nullptr;
+	std::vector<char> Buffer;
+	size_t CallsChunkOffset = NoChunk;
+	unsigned CallsInChunk = 0;
+	unsigned long long LastTicks = 0;
+
+	// Object last described at each index, to notice new objects and reused slots.
+	std::vector<UObject*> Described;
+	std::unordered_map<FNameEntry*, unsigned> NameIds;
+	std::vector<PendingName> PendingNames;
+	std::vector<FunctionTraceObject> PendingObjects;
+
+	void Append(const void* data, const size_t size)
+	{
+		const auto offset = Buffer.size();
+		Buffer.resize(offset + size);
+		memcpy(Buffer.data() + offset, data, size);
+	}
+
+	void AppendCall(const FunctionTraceCall& call)
+	{
+		Append(&call, sizeof(call));
+		CallsInChunk++;
+	}
+
+	size_t BeginChunk(const FunctionTraceChunkType type)
+	{
+		const auto offset = Buffer.size();
+		FunctionTraceChunk chunk = { unsigned(type), 0, 0 };
+		Append(&chunk, sizeof(chunk));
+		return offset;
+	}
+
+	/// <summary>
+	/// Patches the size and count of the open calls chunk, if any.
+	/// </summary>
+	void EndChunk(size_t& offset)
+	{
+		if (offset == NoChunk)
+		{
+			return;
+		}
+		const auto chunk = reinterpret_cast<FunctionTraceChunk*>(Buffer.data() + offset);
+		chunk->Count = CallsInChunk;
+		chunk->Size = unsigned(Buffer.size() - offset - sizeof(FunctionTraceChunk));
+		offset = NoChunk;
+		CallsInChunk = 0;
+	}
+
+	unsigned GetNameId(const FName& name)
+	{
+		const auto found = NameIds.find(name.NameEntry);
+		if (found != NameIds.end())
+		{
+			return found->second;
+		}
+		const auto id = unsigned(NameIds.size());
+		NameIds.emplace(name.NameEntry, id);
+		PendingNames.push_back(PendingName{ id, name.NameEntry->Name });
+		return id;
+	}
+
+	void Describe(UObject* object)
+	{
+		if (!object)
+		{
+			return;
+		}
+		const auto index = object->ObjectInternalInteger;
+		if (index < 0)
+		{
+			return;
+		}
+		if (unsigned(index) >= Described.size())
+		{
+			const auto objMax = UObject::GObjObjects()->Max;
+			Described.resize(index < objMax ? objMax : index + 1024, nullptr);
+		}
+		if (Described[index] == object)
+		{
+			return;
+		}
+		// Marked first so class and outer cycles terminate.
+		Described[index] = object;
+		Describe(object->Class);
+		Describe(object->Outer);
+
+		FunctionTraceObject entry;
+		entry.Index = index;
+		entry.ClassIndex = object->Class ? object->Class->ObjectInternalInteger : -1;
+		entry.OuterIndex = object->Outer ? object->Outer->ObjectInternalInteger : -1;
+		entry.NameId = GetNameId(object->Name);
+		entry.NameNumber = object->Name.NameIndex;
+		PendingObjects.push_back(entry);
+	}
+
+	void WritePendingDescriptions()
+	{
+		EndChunk(CallsChunkOffset);
+
+		if (!PendingNames.empty())
+		{
+			const auto offset = BeginChunk(FTCHUNK_Names);
+			for (const auto& name : PendingNames)
+			{
+				FunctionTraceName entry;
+				entry.Id = name.Id;
+				entry.Length = unsigned short(strnlen(name.Name, 0xFFFF));
+				Append(&entry, sizeof(entry));
+				Append(name.Name, entry.Length);
+			}
+			const auto chunk = reinterpret_cast<FunctionTraceChunk*>(Buffer.data() + offset);
+			chunk->Count = unsigned(PendingNames.size());
+			chunk->Size = unsigned(Buffer.size() - offset - sizeof(FunctionTraceChunk));
+			PendingNames.clear();
+		}
+
+		if (!PendingObjects.empty())
+		{
+			const auto offset = BeginChunk(FTCHUNK_Objects);
+			Append(PendingObjects.data(), PendingObjects.size() * sizeof(FunctionTraceObject));
+			const auto chunk = reinterpret_cast<FunctionTraceChunk*>(Buffer.data() + offset);
+			chunk->Count = unsigned(PendingObjects.size());
+			chunk->Size = unsigned(PendingObjects.size() * sizeof(FunctionTraceObject));
+			PendingObjects.clear();
+		}
+	}
+};
@@ -0,0 +1,422 @@
+// Decodes the binary call traces written by FunctionLogger in LOGMODE_TRACE.
+// Portable C++11 with no Windows dependencies, see readme.md for build instructions.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "../FunctionLogger/FunctionTraceFormat.h"
+
+struct ObjectEntry
+{
+	bool Known = false;
+	int32_t ClassIndex = -1;
+	int32_t OuterIndex = -1;
+	uint32_t NameId = 0;
+	uint32_t NameNumber = 0;
+};
+
+struct FunctionStats
+{
+	std::string Name;
+	uint64_t Calls = 0;
+	uint64_t FirstTicks = 0;
+	uint64_t LastTicks = 0;
+	uint32_t MaxDepth = 0;
+};
+
+struct Options
+{
+	const char* Path = nullptr;
+	std::string Command;
+	const char* FunctionFilter = nullptr;
+	const char* ObjectFilter = nullptr;
+	double From = 0;
+	double To = -1;
+	int MaxDepth = -1;
+	size_t Top = 100;
+};
+
+class TraceDecoder
+{
+public:
+	explicit TraceDecoder(const Options& options) : Opts(options)
+	{
+	}
+
+	int Run()
+	{
+		FILE* file = fopen(Opts.Path, "rb");
+		if (!file)
+		{
+			fprintf(stderr, "Could not open %s\n", Opts.Path);
+			return 1;
+		}
+
+		FunctionTraceHeader header;
+		if (fread(&header, sizeof(header), 1, file) != 1 || header.Magic != FUNCTIONTRACE_MAGIC)
+		{
+			fprintf(stderr, "%s is not a function trace\n", Opts.Path);
+			fclose(file);
+			return 1;
+		}
+		if (header.Version != FUNCTIONTRACE_VERSION)
+		{
+			fprintf(stderr, "Unsupported trace version %u, expected %u\n", header.Version, FUNCTIONTRACE_VERSION);
+			fclose(file);
+			return 1;
+		}
+		TicksPerSecond = header.TicksPerSecond ? double(header.TicksPerSecond) : 1.0;
+
+		FunctionTraceChunk chunk;
+		std::vector<char> data;
+		while (fread(&chunk, sizeof(chunk), 1, file) == 1)
+		{
+			data.resize(chunk.Size);
+			if (chunk.Size && fread(data.data(), 1, chunk.Size, file) != chunk.Size)
+			{
+				fprintf(stderr, "Trace is truncated, decoded up to the last complete chunk\n");
+				break;
+			}
+			switch (chunk.Type)
+			{
+			case FTCHUNK_Names:
+				ReadNames(data.data(), chunk.Size, chunk.Count);
+				break;
+			case FTCHUNK_Objects:
+				if (chunk.Size >= uint64_t(chunk.Count) * sizeof(FunctionTraceObject))
+				{
+					ReadObjects(data.data(), chunk.Count);
+				}
+				break;
+			case FTCHUNK_Calls:
+				if (chunk.Size >= uint64_t(chunk.Count) * sizeof(FunctionTraceCall))
+				{
+					ReadCalls(reinterpret_cast<const FunctionTraceCall*>(data.data()), chunk.Count);
+				}
+				break;
+			default:
+				// Unknown chunks are skipped so newer writers stay readable.
+				break;
+			}
+		}
+		fclose(file);
+
+		if (Opts.Command == "histogram")
+		{
+			PrintHistogram();
+		}
+		return 0;
+	}
+
+private:
+	const Options& Opts;
+	double TicksPerSecond = 1.0;
+	uint64_t Ticks = 0;
+	uint64_t TotalCalls = 0;
+
+	std::vector<std::string> Names;
+	std::vector<ObjectEntry> Objects;
+	// Per object index, the stats of the function last described there, or -1.
+	std::vector<int> StatsByIndex;
+	std::vector<FunctionStats> Stats;
+
+	void ReadNames(const char* data, const size_t size, const uint32_t count)
+	{
+		const char* end = data + size;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			FunctionTraceName entry;
+			// A corrupt count or length stops the chunk instead of reading past it.
+			if (size_t(end - data) < sizeof(entry))
+			{
+				break;
+			}
+			memcpy(&entry, data, sizeof(entry));
+			data += sizeof(entry);
+			if (size_t(end - data) < entry.Length)
+			{
+				break;
+			}
+			if (entry.Id >= Names.size())
+			{
+				Names.resize(entry.Id + 1);
+			}
+			Names[entry.Id].assign(data, entry.Length);
+			data += entry.Length;
+		}
+	}
+
+	void ReadObjects(const char* data, const uint32_t count)
+	{
+		for (uint32_t i = 0; i < count; i++)
+		{
+			FunctionTraceObject entry;
+			memcpy(&entry, data + i * sizeof(entry), sizeof(entry));
+			if (entry.Index < 0)
+			{
+				continue;
+			}
+			if (size_t(entry.Index) >= Objects.size())
+			{
+				Objects.resize(entry.Index + 1024);
+			}
+			if (size_t(entry.Index) >= StatsByIndex.size())
+			{
+				StatsByIndex.resize(entry.Index + 1024, -1);
+			}
+			auto& object = Objects[entry.Index];
+			object.Known = true;
+			object.ClassIndex = entry.ClassIndex;
+			object.OuterIndex = entry.OuterIndex;
+			object.NameId = entry.NameId;
+			object.NameNumber = entry.NameNumber;
+			// A different object took over this slot.
+			StatsByIndex[entry.Index] = -1;
+		}
+	}
+
+	const ObjectEntry* GetObject(const int32_t index) const
+	{
+		return index >= 0 && size_t(index) < Objects.size() && Objects[index].Known ? &Objects[index] : nullptr;
+	}
+
+	void AppendName(std::string& out, const ObjectEntry& object) const
+	{
+		out += object.NameId < Names.size() ? Names[object.NameId] : "?";
+		// Engine convention: number N > 0 is displayed as _(N-1).
+		if (object.NameNumber)
+		{
+			out += '_';
+			out += std::to_string(object.NameNumber - 1);
+		}
+	}
+
+	void AppendPath(std::string& out, const int32_t index, const int depth = 0) const
+	{
+		const auto object = GetObject(index);
+		if (!object)
+		{
+			out += "?";
+			return;
+		}
+		// Outer chains are short, the cap only guards against corrupt traces.
+		if (object->OuterIndex >= 0 && depth < 32)
+		{
+			AppendPath(out, object->OuterIndex, depth + 1);
+			out += '.';
+		}
+		AppendName(out, *object);
+	}
+
+	/// <summary>
+	/// Builds the same "Class Outer.Name" form as UObject::GetFullName, with the full outer chain.
+	/// </summary>
+	std::string GetFullName(const int32_t index) const
+	{
+		std::string name;
+		const auto object = GetObject(index);
+		if (!object)
+		{
+			return index < 0 ? "None" : "Unknown#" + std::to_string(index);
+		}
+		const auto cls = GetObject(object->ClassIndex);
+		if (cls)
+		{
+			AppendName(name, *cls);
+			name += ' ';
+		}
+		AppendPath(name, index);
+		return name;
+	}
+
+	FunctionStats& GetStats(const int32_t functionIndex)
+	{
+		const auto slot = size_t(functionIndex < 0 ? 0 : functionIndex);
+		if (slot >= StatsByIndex.size())
+		{
+			StatsByIndex.resize(slot + 1024, -1);
+		}
+		if (StatsByIndex[slot] < 0)
+		{
+			Stats.emplace_back();
+			Stats.back().Name = GetFullName(functionIndex);
+			StatsByIndex[slot] = int(Stats.size() - 1);
+		}
+		return Stats[StatsByIndex[slot]];
+	}
+
+	void ReadCalls(const FunctionTraceCall* calls, const uint32_t count)
+	{
+		const auto fromTicks = uint64_t(Opts.From * TicksPerSecond);
+		const auto toTicks = Opts.To < 0 ? UINT64_MAX : uint64_t(Opts.To * TicksPerSecond);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			FunctionTraceCall call;
+			memcpy(&call, calls + i, sizeof(call));
+			if (call.FunctionIndex == FUNCTIONTRACE_TIMESKIP)
+			{
+				Ticks += (uint64_t(uint32_t(call.ObjectIndex)) << 32) | call.TicksDelta;
+				continue;
+			}
+			Ticks += call.TicksDelta;
+			TotalCalls++;
+
+			if (Ticks < fromTicks || Ticks > toTicks || (Opts.MaxDepth >= 0 && call.Depth > Opts.MaxDepth))
+			{
+				continue;
+			}
+
+			auto& stats = GetStats(call.FunctionIndex);
+			if (Opts.FunctionFilter && !strstr(stats.Name.c_str(), Opts.FunctionFilter))
+			{
+				continue;
+			}
+			std::string objectName;
+			if (Opts.ObjectFilter || Opts.Command == "log")
+			{
+				objectName = GetFullName(call.ObjectIndex);
+				if (Opts.ObjectFilter && !strstr(objectName.c_str(), Opts.ObjectFilter))
+				{
+					continue;
+				}
+			}
+
+			if (!stats.Calls)
+			{
+				stats.FirstTicks = Ticks;
+			}
+			stats.Calls++;
+			stats.LastTicks = Ticks;
+			stats.MaxDepth = std::max(stats.MaxDepth, uint32_t(call.Depth));
+
+			if (Opts.Command == "log")
+			{
+				const auto ms = uint64_t(double(Ticks) * 1000.0 / TicksPerSecond);
+				printf("[%llu.%03u] %*s%s on %s\n", (unsigned long long)(ms / 1000), unsigned(ms % 1000),
+					std::min(int(call.Depth), 40) * 2, "", stats.Name.c_str(), objectName.c_str());
+			}
+		}
+	}
+
+	void PrintHistogram()
+	{
+		// A function can own several entries if its slot was described again; merge them by name.
+		std::vector<FunctionStats*> sorted;
+		for (auto& stats : Stats)
+		{
+			if (stats.Calls)
+			{
+				sorted.push_back(&stats);
+			}
+		}
+		std::sort(sorted.begin(), sorted.end(), [](const FunctionStats* a, const FunctionStats* b)
+		{
+			return a->Name != b->Name ? a->Name < b->Name : a->FirstTicks < b->FirstTicks;
+		});
+		std::vector<FunctionStats*> merged;
+		for (auto stats : sorted)
+		{
+			if (!merged.empty() && merged.back()->Name == stats->Name)
+			{
+				merged.back()->Calls += stats->Calls;
+				merged.back()->LastTicks = std::max(merged.back()->LastTicks, stats->LastTicks);
+				merged.back()->MaxDepth = std::max(merged.back()->MaxDepth, stats->MaxDepth);
+				continue;
+			}
+			merged.push_back(stats);
+		}
+		std::sort(merged.begin(), merged.end(), [](const FunctionStats* a, const FunctionStats* b)
+		{
+			return a->Calls > b->Calls;
+		});
+
+		const auto seconds = double(Ticks) / TicksPerSecond;
+		printf("%llu calls over %.3f s\n", (unsigned long long)TotalCalls, seconds);
+		printf("%12s %10s %10s %10s %6s  %s\n", "Calls", "Calls/s", "First s", "Last s", "Depth", "Function");
+		for (size_t i = 0; i < merged.size() && i < Opts.Top; i++)
+		{
+			const auto stats = merged[i];
+			const auto first = double(stats->FirstTicks) / TicksPerSecond;
+			const auto last = double(stats->LastTicks) / TicksPerSecond;
+			printf("%12llu %10.1f %10.3f %10.3f %6u  %s\n", (unsigned long long)stats->Calls,
+				seconds > 0 ? double(stats->Calls) / seconds : 0.0, first, last, stats->MaxDepth, stats->Name.c_str());
+		}
+	}
+};
+
+void PrintUsage()
+{
+	printf("Usage: FunctionTraceDecoder <FunctionCallTrace.bin> <log|histogram> [options]\n");
+	printf("  log                 Prints every call with its timestamp, nesting and object\n");
+	printf("  histogram           Prints call counts per function, most called first\n");
+	printf("Options:\n");
+	printf("  --function <text>   Only calls to functions whose full name contains text\n");
+	printf("  --object <text>     Only calls on objects whose full name contains text\n");
+	printf("  --from <seconds>    Skip calls before this time\n");
+	printf("  --to <seconds>      Skip calls after this time\n");
+	printf("  --max-depth <n>     Skip calls nested deeper than n\n");
+	printf("  --top <n>           Number of histogram rows, default 100\n");
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 3)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	Options options;
+	options.Path = argv[1];
+	options.Command = argv[2];
+	if (options.Command != "log" && options.Command != "histogram")
+	{
+		PrintUsage();
+		return 1;
+	}
+	for (auto i = 3; i < argc; i++)
+	{
+		const std::string option = argv[i];
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "Missing value for %s\n", option.c_str());
+			return 1;
+		}
+		const char* value = argv[++i];
+		if (option == "--function")
+		{
+			options.FunctionFilter = value;
+		}
+		else if (option == "--object")
+		{
+			options.ObjectFilter = value;
+		}
+		else if (option == "--from")
+		{
+			options.From = atof(value);
+		}
+		else if (option == "--to")
+		{
+			options.To = atof(value);
+		}
+		else if (option == "--max-depth")
+		{
+			options.MaxDepth = atoi(value);
+		}
+		else if (option == "--top")
+		{
+			options.Top = size_t(atoi(value));
+		}
+		else
+		{
+			fprintf(stderr, "Unknown option %s\n", option.c_str());
+			return 1;
+		}
+	}
+
+	TraceDecoder decoder(options);
+	return decoder.Run();
+}
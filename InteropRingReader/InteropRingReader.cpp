@@ -0,0 +1,346 @@
+// A reader for the shared memory ring ME3ExplorerInterop sends messages through, for testing and benchmarking the
+// transport without ME3Explorer. See readme.md for build instructions.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include "../ME3ExplorerInterop/InteropMessage.h"
+#include "../ME3ExplorerInterop/InteropRing.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static double SecondsSince(const Clock::time_point start)
+{
+	return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+#ifdef _WIN32
+/// <summary>
+/// Prints a message's fields in order, strings as ASCII with anything else replaced.
+/// </summary>
+static void PrintMessage(const uint8_t* message, const uint32_t length)
+{
+	InteropMessageReader reader;
+	if (!reader.Open(message, length))
+	{
+		printf("(not a message, %u bytes)\n", length);
+		return;
+	}
+	std::string text;
+	char number[64];
+	InteropField field;
+	while (reader.Next(field))
+	{
+		if (!text.empty())
+		{
+			text += ' ';
+		}
+		switch (field.Type)
+		{
+		case IMSGFIELD_Name:
+		case IMSGFIELD_String:
+			text += field.Type == IMSGFIELD_Name ? "[" : "\"";
+			for (uint32_t i = 0; i < field.StringLength; i++)
+			{
+				const auto unit = field.GetChar(i);
+				text += unit >= 0x20 && unit < 0x7F ? char(unit) : '?';
+			}
+			text += field.Type == IMSGFIELD_Name ? "]" : "\"";
+			break;
+		case IMSGFIELD_Vector:
+			snprintf(number, sizeof(number), "(%g, %g, %g)", field.Vector[0], field.Vector[1], field.Vector[2]);
+			text += number;
+			break;
+		case IMSGFIELD_Float:
+			snprintf(number, sizeof(number), "%g", field.Float);
+			text += number;
+			break;
+		case IMSGFIELD_Int:
+			snprintf(number, sizeof(number), "%d", field.Int);
+			text += number;
+			break;
+		case IMSGFIELD_Bool:
+			text += field.Bool ? "true" : "false";
+			break;
+		default:
+			break;
+		}
+	}
+	printf("%s%s\n", text.c_str(), reader.IsCorrupt() ? " (corrupt)" : "");
+}
+
+/// <summary>
+/// Attaches to the game's ring, creating it if the game hasn't yet, and prints every message until Ctrl+C.
+/// </summary>
+static int Attach(const bool quiet)
+{
+	const auto section = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0,
+		INTEROPRING_DATA_OFFSET + INTEROPRING_DEFAULT_CAPACITY, INTEROPRING_SECTION_NAME);
+	if (!section)
+	{
+		fprintf(stderr, "Could not create or open %s\n", INTEROPRING_SECTION_NAME);
+		return 1;
+	}
+	const auto created = GetLastError() != ERROR_ALREADY_EXISTS;
+	const auto view = MapViewOfFile(section, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+	const auto doorbell = CreateEventA(nullptr, FALSE, FALSE, INTEROPRING_DOORBELL_NAME);
+	if (!view || !doorbell)
+	{
+		fprintf(stderr, "Could not map the ring or open its doorbell\n");
+		return 1;
+	}
+	if (created)
+	{
+		InitializeInteropRing(view, INTEROPRING_DEFAULT_CAPACITY);
+	}
+	MEMORY_BASIC_INFORMATION region;
+	const auto header = GetInteropRing(view, VirtualQuery(view, &region, sizeof(region)) ? region.RegionSize : 0);
+	if (!header)
+	{
+		fprintf(stderr, "%s does not hold a ring this reader understands\n", INTEROPRING_SECTION_NAME);
+		return 1;
+	}
+
+	InteropRingReader reader(header);
+	reader.SkipAll();
+	header->ReaderProcessId.store(GetCurrentProcessId());
+	printf("Attached to %s, %u byte ring. Waiting for messages.\n", INTEROPRING_SECTION_NAME, header->Capacity);
+
+	unsigned long long received = 0;
+	auto lastReport = Clock::now();
+	auto lastDropped = header->Dropped.load();
+	while (true)
+	{
+		received += reader.Drain([&](const uint8_t* message, const uint32_t length)
+		{
+			if (!quiet)
+			{
+				PrintMessage(message, length);
+			}
+		});
+		if (quiet && SecondsSince(lastReport) >= 1.0)
+		{
+			const auto dropped = header->Dropped.load();
+			printf("%llu received, %u dropped in the last second\n", received, dropped - lastDropped);
+			lastDropped = dropped;
+			lastReport = Clock::now();
+		}
+		if (reader.PrepareToWait())
+		{
+			WaitForSingleObject(doorbell, 1000);
+			reader.DoneWaiting();
+		}
+	}
+}
+#endif
+
+/// <summary>
+/// Stands in for the doorbell event between two threads of one process.
+/// </summary>
+class Doorbell
+{
+public:
+	void Ring()
+	{
+		std::lock_guard<std::mutex> lock(Mutex);
+		Rung = true;
+		Condition.notify_one();
+	}
+
+	void Wait(const int milliseconds)
+	{
+		std::unique_lock<std::mutex> lock(Mutex);
+		Condition.wait_for(lock, std::chrono::milliseconds(milliseconds), [this] { return Rung; });
+		Rung = false;
+	}
+
+private:
+	std::mutex Mutex;
+	std::condition_variable Condition;
+	bool Rung = false;
+};
+
+/// <summary>
+/// Runs the game's side and a reader on two threads over an in-process ring. The writer sends messages of the given
+/// size as fast as it can or paced by a gap, the way Kismet would, and reports what each Send cost it.
+/// </summary>
+static int Bench(const unsigned messages, const unsigned size, const uint32_t capacity, const unsigned gapMicroseconds)
+{
+	std::vector<uint64_t> memory((INTEROPRING_DATA_OFFSET + capacity) / sizeof(uint64_t) + 1);
+	InitializeInteropRing(memory.data(), capacity);
+	const auto header = GetInteropRing(memory.data(), memory.size() * sizeof(uint64_t));
+	header->ReaderProcessId.store(1);
+	Doorbell doorbell;
+
+	unsigned long long received = 0;
+	unsigned long long receivedBytes = 0;
+	unsigned long long corrupt = 0;
+	std::atomic<bool> done(false);
+	std::thread readerThread([&]
+	{
+		InteropRingReader reader(header);
+		unsigned expected = 0;
+		while (true)
+		{
+			reader.Drain([&](const uint8_t* message, const uint32_t length)
+			{
+				// Messages carry their sequence number, so lost or mangled ones are noticed.
+				uint32_t sequence;
+				memcpy(&sequence, message, 4);
+				if (length != size || sequence < expected)
+				{
+					corrupt++;
+				}
+				expected = sequence + 1;
+				received++;
+				receivedBytes += length;
+			});
+			if (done && reader.IsEmpty())
+			{
+				break;
+			}
+			if (reader.PrepareToWait())
+			{
+				doorbell.Wait(10);
+				reader.DoneWaiting();
+			}
+		}
+	});
+
+	InteropRingWriter writer(header);
+	std::vector<uint8_t> message(std::max(size, 4u), 0x41);
+	std::vector<double> sendTimes;
+	sendTimes.reserve(messages);
+	unsigned long long doorbells = 0;
+	const auto start = Clock::now();
+	for (uint32_t i = 0; i < messages; i++)
+	{
+		memcpy(message.data(), &i, 4);
+		const auto before = Clock::now();
+		if (writer.Write(message.data(), size) && writer.IsReaderWaiting())
+		{
+			doorbell.Ring();
+			doorbells++;
+		}
+		sendTimes.push_back(std::chrono::duration<double, std::nano>(Clock::now() - before).count());
+		if (gapMicroseconds)
+		{
+			const auto until = before + std::chrono::microseconds(gapMicroseconds);
+			while (Clock::now() < until)
+			{
+			}
+		}
+	}
+	const auto sendSeconds = SecondsSince(start);
+	done = true;
+	doorbell.Ring();
+	readerThread.join();
+	const auto totalSeconds = SecondsSince(start);
+
+	std::sort(sendTimes.begin(), sendTimes.end());
+	const auto percentile = [&](const double p) { return sendTimes[size_t(p * (sendTimes.size() - 1))]; };
+	printf("%u messages of %u bytes, %u byte ring, %u us apart\n", messages, size, capacity, gapMicroseconds);
+	printf("  Send: median %.0f ns, p99 %.0f ns, p99.9 %.0f ns, max %.0f ns\n", percentile(0.5), percentile(0.99),
+		percentile(0.999), sendTimes.back());
+	printf("  Sent in %.3f s, drained %.3f s after the first\n", sendSeconds, totalSeconds);
+	printf("  %llu received (%.1f MB/s), %u dropped, %llu doorbells rung, %llu out of order or mangled\n", received,
+		receivedBytes / totalSeconds / 1e6, header->Dropped.load(), doorbells, corrupt);
+	return corrupt || received + header->Dropped.load() != messages ? 1 : 0;
+}
+
+static void PrintUsage()
+{
+	printf("Usage: InteropRingReader <attach|bench> [options]\n");
+#ifdef _WIN32
+	printf("  attach              Attaches to the game's ring and prints every message\n");
+	printf("    --quiet           Prints counts once a second instead of messages\n");
+#endif
+	printf("  bench               Runs a writer and this reader on two threads over a private ring\n");
+	printf("    --messages <n>    Messages to send, default 1000000\n");
+	printf("    --size <bytes>    Message size, default 64\n");
+	printf("    --capacity <n>    Ring size in bytes, a power of two, default %u\n", INTEROPRING_DEFAULT_CAPACITY);
+	printf("    --gap <us>        Time between messages, default 0\n");
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		PrintUsage();
+		return 1;
+	}
+	const std::string command = argv[1];
+	unsigned messages = 1000000;
+	unsigned size = 64;
+	unsigned capacity = INTEROPRING_DEFAULT_CAPACITY;
+	unsigned gap = 0;
+#ifdef _WIN32
+	auto quiet = false;
+#endif
+	for (auto i = 2; i < argc; i++)
+	{
+		const std::string option = argv[i];
+#ifdef _WIN32
+		if (option == "--quiet")
+		{
+			quiet = true;
+			continue;
+		}
+#endif
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "Missing value for %s\n", option.c_str());
+			return 1;
+		}
+		const auto value = unsigned(strtoul(argv[++i], nullptr, 10));
+		if (option == "--messages")
+		{
+			messages = value;
+		}
+		else if (option == "--size")
+		{
+			size = value;
+		}
+		else if (option == "--capacity")
+		{
+			capacity = value;
+		}
+		else if (option == "--gap")
+		{
+			gap = value;
+		}
+		else
+		{
+			fprintf(stderr, "Unknown option %s\n", option.c_str());
+			return 1;
+		}
+	}
+
+	if (command == "bench")
+	{
+		if (capacity < 64 || (capacity & (capacity - 1)) != 0 || size < 4 || GetInteropRecordSize(size) > capacity / 2 || !messages)
+		{
+			fprintf(stderr, "The capacity must be a power of two of at least 64, and hold two messages of at least 4 bytes\n");
+			return 1;
+		}
+		return Bench(messages, size, capacity, gap);
+	}
+#ifdef _WIN32
+	if (command == "attach")
+	{
+		return Attach(quiet);
+	}
+#endif
+	PrintUsage();
+	return 1;
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <math.h>
+#include <stdio.h>
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "..\ME3SDK\ScreenLogger.h"
+
+/// <summary>
+/// Draws the sequence ops activated most often, with their rates, over the HUD. An activation only bumps its op's
+/// counter; a few times a second the counters are folded into per-op rates, smoothed so a burst fades over about
+/// a second, and the top ops are formatted into a ScreenLogger that's drawn every frame. Call from the game thread only.
+/// </summary>
+class KismetActivityOverlay
+{
+public:
+	/// <param name="topCount">Number of ops shown.</param>
+	/// <param name="refreshMilliseconds">How often the rates and the list are updated.</param>
+	/// <param name="halfLifeSeconds">How long an op's rate takes to halve once it stops being activated.</param>
+	KismetActivityOverlay(const int topCount = 15, const unsigned long long refreshMilliseconds = 250, const double halfLifeSeconds = 1.0)
+		: TopCount(topCount), RefreshMilliseconds(refreshMilliseconds), HalfLifeSeconds(halfLifeSeconds),
+		Screen(L"Kismet activations/s", topCount + 1, 256), LastRefresh(GetTickCount64())
+	{
+	}
+
+	void Activation(USequenceOp* op)
+	{
+		auto& entry = Ops[op];
+		if (entry.Name.empty() || entry.ObjectName.NameEntry != op->Name.NameEntry ||
+			entry.ObjectName.NameIndex != op->Name.NameIndex || entry.Outer != op->Outer)
+		{
+			// New, or a different op at the same address. Named now, while it's certainly alive.
+			entry = OpRate();
+			entry.ObjectName = op->Name;
+			entry.Outer = op->Outer;
+			const std::string name = op->GetFullName();
+			entry.Name.assign(name.begin(), name.end());
+		}
+		entry.Count++;
+		TotalCount++;
+	}
+
+	void PostRender(ABioHUD* hud)
+	{
+		const auto now = GetTickCount64();
+		if (now - LastRefresh >= RefreshMilliseconds)
+		{
+			Refresh(double(now - LastRefresh) / 1000.0);
+			LastRefresh = now;
+		}
+		Screen.PostRenderer(hud);
+	}
+
+private:
+	struct OpRate
+	{
+		FName ObjectName;
+		UObject* Outer = nullptr;
+		std::wstring Name;
+		unsigned Count = 0;
+		double Rate = 0;
+	};
+
+	// Ops whose smoothed rate drops below this are forgotten.
+	static constexpr double MinRate = 0.01;
+
+	int TopCount;
+	unsigned long long RefreshMilliseconds;
+	double HalfLifeSeconds;
+	ScreenLogger Screen;
+	unsigned long long LastRefresh;
+	std::unordered_map<USequenceOp*, OpRate> Ops;
+	unsigned TotalCount = 0;
+	double TotalRate = 0;
+	std::vector<const OpRate*> Top;
+
+	void Refresh(const double elapsedSeconds)
+	{
+		// Exponential smoothing: with alpha for the time passed, a steady rate is reached and a stopped one decays
+		// with the configured half life, however irregular the refreshes are.
+		const auto alpha = 1.0 - pow(0.5, elapsedSeconds / HalfLifeSeconds);
+		TotalRate += alpha * (TotalCount / elapsedSeconds - TotalRate);
+		TotalCount = 0;
+		Top.clear();
+		for (auto it = Ops.begin(); it != Ops.end();)
+		{
+			auto& entry = it->second;
+			entry.Rate += alpha * (entry.Count / elapsedSeconds - entry.Rate);
+			entry.Count = 0;
+			if (entry.Rate < MinRate)
+			{
+				it = Ops.erase(it);
+				continue;
+			}
+			Top.push_back(&entry);
+			++it;
+		}
+		const auto shown = (std::min)(Top.size(), size_t(TopCount));
+		std::partial_sort(Top.begin(), Top.begin() + shown, Top.end(), [](const OpRate* a, const OpRate* b)
+		{
+			return a->Rate > b->Rate;
+		});
+		Top.resize(shown);
+
+		// ScreenLogger shows the newest line first, so the list is logged bottom up.
+		Screen.Clear();
+		wchar_t line[256];
+		for (auto i = int(Top.size()) - 1; i >= 0; i--)
+		{
+			const auto length = swprintf(line, 256, L"%8.1f  %.200ls", Top[i]->Rate, Top[i]->Name.c_str());
+			Screen.LogMessage(line, length > 0 ? length : 0);
+		}
+		const auto length = swprintf(line, 256, L"%8.1f  total, %d ops", TotalRate, int(Ops.size()));
+		Screen.LogMessage(line, length > 0 ? length : 0);
+	}
+};
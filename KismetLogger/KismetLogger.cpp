@@ -9,34 +9,104 @@
 #include <shlwapi.h>
 
 #include "..\ME3SDK\ME3TweaksHeader.h"
-#include "..\ME3SDK\SdkHeaders.h"
-#include "..\detours\detours.h"
+#include "..\ME3SDK\Packages\Engine.h"
+#include "..\ME3SDK\ProcessEventHub.h"
+#include "..\ME3SDK\FullNameCache.h"
+#include "KismetTraceWriter.h"
 
 #define _CRT_SECURE_NO_WARNINGS
-#pragma comment(lib, "detours.lib") //Library needed for Hooking part.
 
-ME3TweaksASILogger logger("Kismet Logger v4", "KismetLog.txt");
+// LOGMODE_TEXT writes one timestamped "(map) op" line per activation to the console and to KismetLog.txt.
+// LOGMODE_TRACE writes compact binary records to KismetTrace.bin. Analyze it with KismetTraceAnalyzer.
+// LOGMODE_OVERLAY writes nothing and draws the most activated ops and their rates over the HUD instead.
+#define LOGMODE_TEXT 0
+#define LOGMODE_TRACE 1
+#define LOGMODE_OVERLAY 2
+#define LOGMODE LOGMODE_TEXT
 
-void __fastcall HookedPE(UObject *pObject, void *edx, UFunction *pFunction, void *pParms, void *pResult)
+#if LOGMODE == LOGMODE_OVERLAY
+#include "KismetActivityOverlay.h"
+
+ME3TweaksASILogger logger("Kismet Overlay v4", "KismetOverlayLog.txt", false);
+KismetActivityOverlay overlay;
+
+bool OnSequenceOpActivated(UObject *pObject, UFunction *pFunction, void *pParms, void *pResult)
+{
+	overlay.Activation(static_cast<USequenceOp*>(pObject));
+	return true;
+}
+
+bool OnBioHUDPostRender(UObject *pObject, UFunction *pFunction, void *pParms, void *pResult)
 {
-	char *szName = pFunction->GetFullName();
-	if (isPartOf(szName, "Function Engine.SequenceOp.Activated")) {
-		USequenceOp* op = (USequenceOp*)pObject;
-		char* fullname = op->GetFullName();
-		char* mapname = op->GetContainingMapName();
-		int instanceIndex = op->Name.GetIndex();
-		logger.writeToLog(string_format("(%s) %s_%d\n", mapname, fullname, instanceIndex), true);
+	overlay.PostRender(static_cast<ABioHUD*>(pObject));
+	return true;
+}
+
+void onAttach()
+{
+	ResolveSdkBindings(logger);
+	SubscribeProcessEvent("Function Engine.SequenceOp.Activated", OnSequenceOpActivated);
+	SubscribeProcessEvent("Function SFXGame.BioHUD.PostRender", OnBioHUDPostRender);
+}
+#elif LOGMODE == LOGMODE_TRACE
+ME3TweaksASILogger logger("Kismet Tracer v4", "KismetTraceLog.txt", false);
+KismetTraceWriter trace;
+
+bool OnSequenceOpActivated(UObject *pObject, UFunction *pFunction, void *pParms, void *pResult)
+{
+	trace.Activation(static_cast<USequenceOp*>(pObject));
+	return true;
+}
+
+bool OnBioHUDPostRender(UObject *pObject, UFunction *pFunction, void *pParms, void *pResult)
+{
+	// Activations stop during quiet spells, so the age of what's buffered is also checked every frame.
+	trace.FlushIfDue();
+	return true;
+}
+
+void onAttach()
+{
+	ResolveSdkBindings(logger);
+	if (!trace.Open("KismetTrace.bin"))
+	{
+		logger.writeToDiskOnly("Could not create KismetTrace.bin\n"s, true);
+		logger.flush();
+		return;
 	}
-	ProcessEvent(pObject, pFunction, pParms, pResult);
+	SubscribeProcessEvent("Function Engine.SequenceOp.Activated", OnSequenceOpActivated);
+	SubscribeProcessEvent("Function SFXGame.BioHUD.PostRender", OnBioHUDPostRender);
+}
+#else
+ME3TweaksASILogger logger("Kismet Logger v4", "KismetLog.txt", true, LogBackend::Async);
+FullNameCache fullNames;
+
+bool OnSequenceOpActivated(UObject *pObject, UFunction *pFunction, void *pParms, void *pResult)
+{
+	USequenceOp* op = (USequenceOp*)pObject;
+	char* mapname = op->GetContainingMapName();
+	int instanceIndex = op->Name.GetIndex();
+
+	// Same text as "(%s) %s_%d\n", without formatting the cached full name again.
+	string line;
+	line.reserve(256);
+	line += '(';
+	line += mapname;
+	line += ") ";
+	fullNames.Append(op, line);
+	line += '_';
+	line += to_string(instanceIndex);
+	line += '\n';
+	logger.writeToLog(std::move(line), true);
+	return true;
 }
 
 void onAttach()
 {
-	DetourTransactionBegin();
-	DetourUpdateThread(GetCurrentThread()); //This command set the current working thread to the game current thread.
-	DetourAttach(&(PVOID&)ProcessEvent, HookedPE); //This command will start your Hook.
-	DetourTransactionCommit();
+	ResolveSdkBindings(logger);
+	SubscribeProcessEvent("Function Engine.SequenceOp.Activated", OnSequenceOpActivated);
 }
+#endif
 
 BOOL WINAPI DllMain(HMODULE hModule, DWORD dwReason, LPVOID lpReserved)
 {
@@ -49,6 +119,10 @@ BOOL WINAPI DllMain(HMODULE hModule, DWORD dwReason, LPVOID lpReserved)
 		break;
 
 	case DLL_PROCESS_DETACH:
+#if LOGMODE == LOGMODE_TRACE
+		trace.Flush();
+#endif
+		logger.shutdown();
 		return true;
 		break;
 	}
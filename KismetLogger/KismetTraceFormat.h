@@ -0,0 +1,62 @@
+#pragma once
+
+// On-disk layout of KismetLogger's binary activation trace. Shared with KismetTraceAnalyzer, so this header must
+// stay free of Windows and SDK dependencies.
+//
+// A trace is a KismetTraceHeader followed by chunks. Each chunk is a KismetTraceChunk followed by Size bytes holding
+// Count entries of the chunk's type. Chunks must be read in order: Maps and Ops chunks describe the maps and sequence
+// ops that the Activations chunks after them refer to by id. Ids are never reused; an op that replaces another at the
+// same address gets a new one.
+//
+// Activations chunks are stored by column rather than by record: Count uint32 tick deltas, then Count uint32 op ids.
+
+#include <stdint.h>
+
+#define KISMETTRACE_MAGIC 0x4352544B // "KTRC"
+#define KISMETTRACE_VERSION 1
+
+// Op id of an activation that only advances the clock, for gaps that don't fit in one tick delta.
+#define KISMETTRACE_TIMESKIP 0xFFFFFFFFu
+
+enum KismetTraceChunkType : uint32_t
+{
+	KTCHUNK_Maps = 1,
+	KTCHUNK_Ops = 2,
+	KTCHUNK_Activations = 3,
+};
+
+#pragma pack(push, 1)
+
+struct KismetTraceHeader
+{
+	uint32_t Magic;
+	uint32_t Version;
+	// Rate of the clock that activation deltas are measured in.
+	uint64_t TicksPerSecond;
+};
+
+struct KismetTraceChunk
+{
+	uint32_t Type;
+	uint32_t Count;
+	uint32_t Size;
+};
+
+// Followed by Length characters of the map's file name, not null terminated.
+struct KismetTraceMap
+{
+	uint32_t Id;
+	uint16_t Length;
+};
+
+// Followed by Length characters of the op's full name and instance number, as the text log writes them.
+struct KismetTraceOp
+{
+	uint32_t Id;
+	uint32_t MapId;
+	// -1 when the op has no index.
+	int32_t ObjectIndex;
+	uint16_t Length;
+};
+
+#pragma pack(pop)
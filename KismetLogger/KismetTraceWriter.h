@@ -0,0 +1,229 @@
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "..\ME3SDK\Packages\Engine.h"
+#include "KismetTraceFormat.h"
+
+/// <summary>
+/// Records each sequence op activation as a tick delta and an op id, kept in two column buffers that are written out
+/// as one chunk when full, or once the oldest buffered activation is FlushSeconds old. That age is checked on every
+/// activation and on every FlushIfDue call, so a caller that wants the guarantee to hold through a quiet spell calls
+/// FlushIfDue from something that runs every frame. An op's full name and map are looked up once, the first time it
+/// activates, and written to the trace's dictionary. Call from the game thread only.
+/// </summary>
+class KismetTraceWriter
+{
+public:
+	// Activations per chunk. The columns are written out once they hold this many.
+	static const size_t ChunkActivations = 64 * 1024;
+	// Buffered activations are also written out once the oldest is this old, so a crash loses little. See FlushIfDue.
+	static const unsigned FlushSeconds = 5;
+
+	~KismetTraceWriter()
+	{
+		if (File)
+		{
+			Flush();
+			fclose(File);
+		}
+	}
+
+	/// <summary>
+	/// Creates the trace file and writes its header. Returns false if the file can't be created.
+	/// </summary>
+	bool Open(const char* fileName)
+	{
+		if (fopen_s(&File, fileName, "wb") != 0 || !File)
+		{
+			File = nullptr;
+			return false;
+		}
+		LARGE_INTEGER frequency;
+		QueryPerformanceFrequency(&frequency);
+		TicksPerSecond = frequency.QuadPart;
+		Deltas.reserve(ChunkActivations);
+		OpIds.reserve(ChunkActivations);
+
+		KismetTraceHeader header;
+		header.Magic = KISMETTRACE_MAGIC;
+		header.Version = KISMETTRACE_VERSION;
+		header.TicksPerSecond = TicksPerSecond;
+		fwrite(&header, sizeof(header), 1, File);
+		fflush(File);
+
+		LastTicks = Now();
+		return true;
+	}
+
+	bool IsOpen() const
+	{
+		return File != nullptr;
+	}
+
+	void Activation(USequenceOp* op)
+	{
+		const auto now = Now();
+		const auto id = GetOpId(op);
+		auto delta = now - LastTicks;
+		LastTicks = now;
+		if (Deltas.empty())
+		{
+			OldestTicks = now;
+		}
+		while (delta > 0xFFFFFFFFULL)
+		{
+			Deltas.push_back(0xFFFFFFFFu);
+			OpIds.push_back(KISMETTRACE_TIMESKIP);
+			delta -= 0xFFFFFFFFULL;
+		}
+		Deltas.push_back(unsigned(delta));
+		OpIds.push_back(id);
+
+		if (Deltas.size() >= ChunkActivations || now - OldestTicks >= FlushSeconds * TicksPerSecond)
+		{
+			Flush();
+		}
+	}
+
+	/// <summary>
+	/// Writes out the buffered activations if the oldest is FlushSeconds old. Costs a clock read while anything is
+	/// buffered and nothing otherwise.
+	/// </summary>
+	void FlushIfDue()
+	{
+		if (!Deltas.empty() && Now() - OldestTicks >= FlushSeconds * TicksPerSecond)
+		{
+			Flush();
+		}
+	}
+
+	/// <summary>
+	/// Writes the new dictionary entries and buffered activations to disk.
+	/// </summary>
+	void Flush()
+	{
+		if (!File)
+		{
+			return;
+		}
+		WriteChunk(KTCHUNK_Maps, PendingMapCount, PendingMaps.data(), PendingMaps.size());
+		WriteChunk(KTCHUNK_Ops, PendingOpCount, PendingOps.data(), PendingOps.size());
+		PendingMaps.clear();
+		PendingOps.clear();
+		PendingMapCount = PendingOpCount = 0;
+
+		if (!Deltas.empty())
+		{
+			const auto count = unsigned(Deltas.size());
+			KismetTraceChunk chunk = { KTCHUNK_Activations, count, unsigned(count * 2 * sizeof(uint32_t)) };
+			fwrite(&chunk, sizeof(chunk), 1, File);
+			fwrite(Deltas.data(), sizeof(uint32_t), count, File);
+			fwrite(OpIds.data(), sizeof(uint32_t), count, File);
+			Deltas.clear();
+			OpIds.clear();
+		}
+		fflush(File);
+	}
+
+private:
+	struct OpEntry
+	{
+		unsigned Id;
+		// What the op at this address was when it got its id, to notice a different op in its place.
+		FName Name;
+		UObject* Outer;
+	};
+
+	FILE* File = nullptr;
+	unsigned long long TicksPerSecond = 1;
+	unsigned long long LastTicks = 0;
+	// When the oldest buffered activation happened. Only meaningful while Deltas isn't empty.
+	unsigned long long OldestTicks = 0;
+
+	std::vector<uint32_t> Deltas;
+	std::vector<uint32_t> OpIds;
+
+	std::unordered_map<USequenceOp*, OpEntry> Ops;
+	std::unordered_map<std::string, unsigned> MapIds;
+	unsigned NextOpId = 0;
+	std::vector<char> PendingMaps;
+	std::vector<char> PendingOps;
+	unsigned PendingMapCount = 0;
+	unsigned PendingOpCount = 0;
+
+	static unsigned long long Now()
+	{
+		LARGE_INTEGER counter;
+		QueryPerformanceCounter(&counter);
+		return counter.QuadPart;
+	}
+
+	static void Append(std::vector<char>& buffer, const void* data, const size_t size)
+	{
+		const auto offset = buffer.size();
+		buffer.resize(offset + size);
+		memcpy(buffer.data() + offset, data, size);
+	}
+
+	void WriteChunk(const KismetTraceChunkType type, const unsigned count, const char* data, const size_t size)
+	{
+		if (!count)
+		{
+			return;
+		}
+		KismetTraceChunk chunk = { unsigned(type), count, unsigned(size) };
+		fwrite(&chunk, sizeof(chunk), 1, File);
+		fwrite(data, 1, size, File);
+	}
+
+	unsigned GetMapId(const char* mapName)
+	{
+		const std::string name(mapName ? mapName : "");
+		const auto found = MapIds.find(name);
+		if (found != MapIds.end())
+		{
+			return found->second;
+		}
+		const auto id = unsigned(MapIds.size());
+		MapIds.emplace(name, id);
+		KismetTraceMap entry;
+		entry.Id = id;
+		entry.Length = uint16_t(name.length() < 0xFFFF ? name.length() : 0xFFFF);
+		Append(PendingMaps, &entry, sizeof(entry));
+		Append(PendingMaps, name.data(), entry.Length);
+		PendingMapCount++;
+		return id;
+	}
+
+	unsigned GetOpId(USequenceOp* op)
+	{
+		const auto found = Ops.find(op);
+		if (found != Ops.end() && found->second.Outer == op->Outer && found->second.Name.NameEntry == op->Name.NameEntry &&
+			found->second.Name.NameIndex == op->Name.NameIndex)
+		{
+			return found->second.Id;
+		}
+		auto& entry = Ops[op];
+		entry.Id = NextOpId++;
+		entry.Name = op->Name;
+		entry.Outer = op->Outer;
+
+		// Same text as the text log's "%s_%d".
+		std::string name = op->GetFullName();
+		name += '_';
+		name += std::to_string(op->Name.GetIndex());
+		KismetTraceOp description;
+		description.Id = entry.Id;
+		description.MapId = GetMapId(op->GetContainingMapName());
+		description.ObjectIndex = op->ObjectInternalInteger;
+		description.Length = uint16_t(name.length() < 0xFFFF ? name.length() : 0xFFFF);
+		Append(PendingOps, &description, sizeof(description));
+		Append(PendingOps, name.data(), description.Length);
+		PendingOpCount++;
+		return entry.Id;
+	}
+};
@@ -0,0 +1,462 @@
+// Analyzes the binary activation traces written by KismetLogger in LOGMODE_TRACE.
+// Portable C++11 with no Windows dependencies, see readme.md for build instructions.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../KismetLogger/KismetTraceFormat.h"
+
+struct OpEntry
+{
+	std::string Name;
+	uint32_t MapId = 0;
+	bool Included = false;
+	uint64_t Activations = 0;
+	uint64_t FirstTicks = 0;
+	uint64_t LastTicks = 0;
+	// Activations in the current bucket, and the most in any one bucket so far.
+	uint64_t Bucket = 0;
+	uint64_t BucketActivations = 0;
+	uint64_t PeakBucket = 0;
+	uint64_t PeakActivations = 0;
+};
+
+struct RateRow
+{
+	uint64_t Bucket;
+	uint64_t Activations;
+	uint32_t BusiestOp;
+	uint64_t BusiestActivations;
+};
+
+struct Options
+{
+	const char* Path = nullptr;
+	std::string Command;
+	const char* MapFilter = nullptr;
+	const char* OpFilter = nullptr;
+	double From = 0;
+	double To = -1;
+	double BucketSeconds = 1;
+	size_t Top = 20;
+	bool Csv = false;
+};
+
+class TraceAnalyzer
+{
+public:
+	explicit TraceAnalyzer(const Options& options) : Opts(options)
+	{
+	}
+
+	int Run()
+	{
+		FILE* file = fopen(Opts.Path, "rb");
+		if (!file)
+		{
+			fprintf(stderr, "Could not open %s\n", Opts.Path);
+			return 1;
+		}
+
+		KismetTraceHeader header;
+		if (fread(&header, sizeof(header), 1, file) != 1 || header.Magic != KISMETTRACE_MAGIC)
+		{
+			fprintf(stderr, "%s is not a Kismet trace\n", Opts.Path);
+			fclose(file);
+			return 1;
+		}
+		if (header.Version != KISMETTRACE_VERSION)
+		{
+			fprintf(stderr, "Unsupported trace version %u, expected %u\n", header.Version, KISMETTRACE_VERSION);
+			fclose(file);
+			return 1;
+		}
+		TicksPerSecond = header.TicksPerSecond ? double(header.TicksPerSecond) : 1.0;
+		BucketTicks = std::max(uint64_t(Opts.BucketSeconds * TicksPerSecond), uint64_t(1));
+
+		KismetTraceChunk chunk;
+		std::vector<char> data;
+		while (fread(&chunk, sizeof(chunk), 1, file) == 1)
+		{
+			data.resize(chunk.Size);
+			if (chunk.Size && fread(data.data(), 1, chunk.Size, file) != chunk.Size)
+			{
+				fprintf(stderr, "Trace is truncated, analyzed up to the last complete chunk\n");
+				break;
+			}
+			switch (chunk.Type)
+			{
+			case KTCHUNK_Maps:
+				ReadMaps(data.data(), chunk.Count);
+				break;
+			case KTCHUNK_Ops:
+				ReadOps(data.data(), chunk.Count);
+				break;
+			case KTCHUNK_Activations:
+				if (chunk.Size >= uint64_t(chunk.Count) * 2 * sizeof(uint32_t))
+				{
+					ReadActivations(data.data(), chunk.Count);
+				}
+				break;
+			default:
+				// Unknown chunks are skipped so newer writers stay readable.
+				break;
+			}
+		}
+		fclose(file);
+
+		if (Opts.Command == "hot")
+		{
+			PrintHot();
+		}
+		else if (Opts.Command == "rate")
+		{
+			EndRateBucket();
+			PrintRate();
+		}
+		return 0;
+	}
+
+private:
+	const Options& Opts;
+	double TicksPerSecond = 1.0;
+	uint64_t BucketTicks = 1;
+	uint64_t Ticks = 0;
+	uint64_t TotalActivations = 0;
+
+	std::vector<std::string> Maps;
+	std::vector<OpEntry> Ops;
+
+	// The rate command's current bucket, with activations per op in it.
+	bool RateStarted = false;
+	uint64_t RateBucket = 0;
+	std::unordered_map<uint32_t, uint64_t> RateCounts;
+	std::vector<RateRow> RateRows;
+
+	static void ReadName(const char*& data, const uint16_t length, std::string& out)
+	{
+		out.assign(data, length);
+		data += length;
+	}
+
+	void ReadMaps(const char* data, const uint32_t count)
+	{
+		for (uint32_t i = 0; i < count; i++)
+		{
+			KismetTraceMap entry;
+			memcpy(&entry, data, sizeof(entry));
+			data += sizeof(entry);
+			if (entry.Id >= Maps.size())
+			{
+				Maps.resize(entry.Id + 1);
+			}
+			ReadName(data, entry.Length, Maps[entry.Id]);
+		}
+	}
+
+	void ReadOps(const char* data, const uint32_t count)
+	{
+		for (uint32_t i = 0; i < count; i++)
+		{
+			KismetTraceOp entry;
+			memcpy(&entry, data, sizeof(entry));
+			data += sizeof(entry);
+			if (entry.Id >= Ops.size())
+			{
+				Ops.resize(entry.Id + 1);
+			}
+			auto& op = Ops[entry.Id];
+			ReadName(data, entry.Length, op.Name);
+			op.MapId = entry.MapId;
+			op.Included = (!Opts.OpFilter || strstr(op.Name.c_str(), Opts.OpFilter)) &&
+				(!Opts.MapFilter || strstr(GetMapName(op.MapId), Opts.MapFilter));
+		}
+	}
+
+	const char* GetMapName(const uint32_t mapId) const
+	{
+		return mapId < Maps.size() ? Maps[mapId].c_str() : "?";
+	}
+
+	double ToSeconds(const uint64_t ticks) const
+	{
+		return double(ticks) / TicksPerSecond;
+	}
+
+	void ReadActivations(const char* data, const uint32_t count)
+	{
+		const auto fromTicks = uint64_t(Opts.From * TicksPerSecond);
+		const auto toTicks = Opts.To < 0 ? UINT64_MAX : uint64_t(Opts.To * TicksPerSecond);
+		const auto deltas = data;
+		const auto opIds = data + count * sizeof(uint32_t);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			uint32_t delta;
+			uint32_t opId;
+			memcpy(&delta, deltas + i * sizeof(uint32_t), sizeof(delta));
+			memcpy(&opId, opIds + i * sizeof(uint32_t), sizeof(opId));
+			Ticks += delta;
+			if (opId == KISMETTRACE_TIMESKIP)
+			{
+				continue;
+			}
+			TotalActivations++;
+			if (opId >= Ops.size() || !Ops[opId].Included || Ticks < fromTicks || Ticks > toTicks)
+			{
+				continue;
+			}
+
+			auto& op = Ops[opId];
+			const auto bucket = Ticks / BucketTicks;
+			if (!op.Activations)
+			{
+				op.FirstTicks = Ticks;
+			}
+			if (!op.Activations || bucket != op.Bucket)
+			{
+				op.Bucket = bucket;
+				op.BucketActivations = 0;
+			}
+			op.Activations++;
+			op.LastTicks = Ticks;
+			if (++op.BucketActivations > op.PeakActivations)
+			{
+				op.PeakActivations = op.BucketActivations;
+				op.PeakBucket = bucket;
+			}
+
+			if (Opts.Command == "rate")
+			{
+				if (RateStarted && bucket != RateBucket)
+				{
+					EndRateBucket();
+				}
+				RateStarted = true;
+				RateBucket = bucket;
+				RateCounts[opId]++;
+			}
+			else if (Opts.Command == "log")
+			{
+				const auto ms = uint64_t(double(Ticks) * 1000.0 / TicksPerSecond);
+				printf("[%llu.%03u] (%s) %s\n", (unsigned long long)(ms / 1000), unsigned(ms % 1000), GetMapName(op.MapId),
+					op.Name.c_str());
+			}
+		}
+	}
+
+	void EndRateBucket()
+	{
+		if (!RateStarted)
+		{
+			return;
+		}
+		RateRow row = { RateBucket, 0, KISMETTRACE_TIMESKIP, 0 };
+		for (const auto& count : RateCounts)
+		{
+			row.Activations += count.second;
+			if (count.second > row.BusiestActivations)
+			{
+				row.BusiestOp = count.first;
+				row.BusiestActivations = count.second;
+			}
+		}
+		RateRows.push_back(row);
+		RateCounts.clear();
+	}
+
+	/// <summary>
+	/// Per map, the ops activated most, with their average and peak rates and when they were first and last seen.
+	/// </summary>
+	void PrintHot()
+	{
+		std::vector<const OpEntry*> sorted;
+		for (const auto& op : Ops)
+		{
+			if (op.Activations)
+			{
+				sorted.push_back(&op);
+			}
+		}
+		std::vector<uint64_t> mapActivations(Maps.size() + 1, 0);
+		for (const auto op : sorted)
+		{
+			mapActivations[std::min(size_t(op->MapId), Maps.size())] += op->Activations;
+		}
+		// Busiest maps first, then busiest ops within each.
+		std::sort(sorted.begin(), sorted.end(), [&](const OpEntry* a, const OpEntry* b)
+		{
+			const auto mapA = mapActivations[std::min(size_t(a->MapId), Maps.size())];
+			const auto mapB = mapActivations[std::min(size_t(b->MapId), Maps.size())];
+			if (a->MapId != b->MapId)
+			{
+				return mapA != mapB ? mapA > mapB : a->MapId < b->MapId;
+			}
+			return a->Activations > b->Activations;
+		});
+
+		const auto seconds = ToSeconds(Ticks);
+		printf("%llu activations of %zu ops over %.3f s\n", (unsigned long long)TotalActivations, Ops.size(), seconds);
+		const auto peakLabel = "Peak/" + FormatBucket();
+		size_t shown = 0;
+		for (size_t i = 0; i < sorted.size(); i++)
+		{
+			const auto op = sorted[i];
+			if (i == 0 || op->MapId != sorted[i - 1]->MapId)
+			{
+				shown = 0;
+				printf("\n%s: %llu activations\n", GetMapName(op->MapId),
+					(unsigned long long)mapActivations[std::min(size_t(op->MapId), Maps.size())]);
+				printf("%12s %10s %10s %10s %10s %10s  %s\n", "Activations", "Avg/s", peakLabel.c_str(), "Peak at s", "First s",
+					"Last s", "Op");
+			}
+			if (shown++ >= Opts.Top)
+			{
+				continue;
+			}
+			const auto first = ToSeconds(op->FirstTicks);
+			const auto last = ToSeconds(op->LastTicks);
+			// Over the time the op was active, so ops from a map loaded late aren't diluted by the rest of the trace.
+			const auto span = last - first;
+			printf("%12llu %10.1f %10llu %10.1f %10.3f %10.3f  %s\n", (unsigned long long)op->Activations,
+				span > 0 ? double(op->Activations) / span : double(op->Activations), (unsigned long long)op->PeakActivations,
+				ToSeconds(op->PeakBucket * BucketTicks), first, last, op->Name.c_str());
+		}
+	}
+
+	/// <summary>
+	/// Activations per bucket, with empty buckets filled in, and the op activated most in each.
+	/// </summary>
+	void PrintRate()
+	{
+		if (Opts.Csv)
+		{
+			printf("Start s,Activations,Busiest op activations,Busiest op,Map\n");
+		}
+		else
+		{
+			printf("%10s %12s %12s  %s\n", "Start s", "Activations", "Busiest", "Busiest op");
+		}
+		for (size_t i = 0; i < RateRows.size(); i++)
+		{
+			const auto& row = RateRows[i];
+			// Buckets with no activations are kept so the series can be plotted as is.
+			const auto previous = i > 0 ? RateRows[i - 1].Bucket + 1 : row.Bucket;
+			for (auto empty = previous; empty < row.Bucket; empty++)
+			{
+				printf(Opts.Csv ? "%.3f,0,0,,\n" : "%10.3f %12u\n", ToSeconds(empty * BucketTicks), 0u);
+			}
+			const auto& op = Ops[row.BusiestOp];
+			if (Opts.Csv)
+			{
+				printf("%.3f,%llu,%llu,\"%s\",\"%s\"\n", ToSeconds(row.Bucket * BucketTicks), (unsigned long long)row.Activations,
+					(unsigned long long)row.BusiestActivations, op.Name.c_str(), GetMapName(op.MapId));
+			}
+			else
+			{
+				printf("%10.3f %12llu %12llu  (%s) %s\n", ToSeconds(row.Bucket * BucketTicks), (unsigned long long)row.Activations,
+					(unsigned long long)row.BusiestActivations, GetMapName(op.MapId), op.Name.c_str());
+			}
+		}
+	}
+
+	std::string FormatBucket() const
+	{
+		if (Opts.BucketSeconds == 1)
+		{
+			return "s";
+		}
+		char text[32];
+		snprintf(text, sizeof(text), "%gs", Opts.BucketSeconds);
+		return text;
+	}
+};
+
+void PrintUsage()
+{
+	printf("Usage: KismetTraceAnalyzer <KismetTrace.bin> <hot|rate|log> [options]\n");
+	printf("  hot                 Prints the most activated ops per map with their average and peak rates\n");
+	printf("  rate                Prints activations per time bucket and the busiest op in each\n");
+	printf("  log                 Prints every activation, like the text log\n");
+	printf("Options:\n");
+	printf("  --map <text>        Only ops in maps whose name contains text\n");
+	printf("  --op <text>         Only ops whose full name contains text\n");
+	printf("  --from <seconds>    Skip activations before this time\n");
+	printf("  --to <seconds>      Skip activations after this time\n");
+	printf("  --bucket <seconds>  Length of the buckets peaks and rates are counted in, default 1\n");
+	printf("  --top <n>           Number of ops per map for hot, default 20\n");
+	printf("  --csv               Comma separated output for rate\n");
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 3)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	Options options;
+	options.Path = argv[1];
+	options.Command = argv[2];
+	if (options.Command != "hot" && options.Command != "rate" && options.Command != "log")
+	{
+		PrintUsage();
+		return 1;
+	}
+	for (auto i = 3; i < argc; i++)
+	{
+		const std::string option = argv[i];
+		if (option == "--csv")
+		{
+			options.Csv = true;
+			continue;
+		}
+		if (i + 1 >= argc)
+		{
+			fprintf(stderr, "Missing value for %s\n", option.c_str());
+			return 1;
+		}
+		const char* value = argv[++i];
+		if (option == "--map")
+		{
+			options.MapFilter = value;
+		}
+		else if (option == "--op")
+		{
+			options.OpFilter = value;
+		}
+		else if (option == "--from")
+		{
+			options.From = atof(value);
+		}
+		else if (option == "--to")
+		{
+			options.To = atof(value);
+		}
+		else if (option == "--bucket")
+		{
+			options.BucketSeconds = atof(value);
+			if (options.BucketSeconds <= 0)
+			{
+				fprintf(stderr, "--bucket must be positive\n");
+				return 1;
+			}
+		}
+		else if (option == "--top")
+		{
+			options.Top = size_t(atoi(value));
+		}
+		else
+		{
+			fprintf(stderr, "Unknown option %s\n", option.c_str());
+			return 1;
+		}
+	}
+
+	TraceAnalyzer analyzer(options);
+	return analyzer.Run();
+}
@@ -0,0 +1,97 @@
+// Turns the circular .ring log files written by ME3TweaksASILogger's Mapped backend back into plain text,
+// oldest line first. Portable C++11 with no Windows dependencies, see readme.md for build instructions.
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "../ME3SDK/MappedLogFormat.h"
+
+int main(int argc, char** argv)
+{
+	if (argc < 2 || argc > 3)
+	{
+		printf("Usage: LogLinearizer <log.ring> [output.txt]\n");
+		printf("Writes the log text oldest first, to output.txt or to stdout.\n");
+		return 1;
+	}
+
+	FILE* in = fopen(argv[1], "rb");
+	if (!in)
+	{
+		fprintf(stderr, "Could not open %s\n", argv[1]);
+		return 1;
+	}
+
+	MappedLogHeader header;
+	if (fread(&header, sizeof(header), 1, in) != 1 || header.Magic != MAPPEDLOG_MAGIC)
+	{
+		fprintf(stderr, "%s is not a ring log\n", argv[1]);
+		fclose(in);
+		return 1;
+	}
+	if (header.Version != MAPPEDLOG_VERSION)
+	{
+		fprintf(stderr, "Unsupported ring log version %u, expected %u\n", header.Version, MAPPEDLOG_VERSION);
+		fclose(in);
+		return 1;
+	}
+
+	const auto cursor = uint64_t(header.WriteCursor);
+	const auto capacity = header.Capacity;
+	const auto wrapped = cursor > capacity;
+	const auto used = wrapped ? capacity : cursor;
+
+	std::vector<char> data(size_t(capacity ? capacity : 1));
+	fseek(in, MAPPEDLOG_DATA_OFFSET, SEEK_SET);
+	const auto read = fread(data.data(), 1, size_t(used), in);
+	fclose(in);
+	if (read != used)
+	{
+		fprintf(stderr, "%s is truncated\n", argv[1]);
+		return 1;
+	}
+
+	FILE* out = stdout;
+	if (argc == 3)
+	{
+		out = fopen(argv[2], "wb");
+		if (!out)
+		{
+			fprintf(stderr, "Could not create %s\n", argv[2]);
+			return 1;
+		}
+	}
+
+	if (wrapped)
+	{
+		// The oldest line was partly overwritten, so start after the first line break.
+		const auto start = size_t(cursor % capacity);
+		auto skip = start;
+		while (skip < capacity && data[skip] != '\n')
+		{
+			skip++;
+		}
+		if (skip < capacity)
+		{
+			fwrite(data.data() + skip + 1, 1, size_t(capacity) - skip - 1, out);
+			fwrite(data.data(), 1, start, out);
+		}
+		else
+		{
+			// No line break before the end of the ring; keep whatever follows the wrap.
+			const char* newline = static_cast<const char*>(memchr(data.data(), '\n', start));
+			const auto from = newline ? size_t(newline - data.data()) + 1 : 0;
+			fwrite(data.data() + from, 1, start - from, out);
+		}
+	}
+	else
+	{
+		fwrite(data.data(), 1, size_t(used), out);
+	}
+
+	if (out != stdout)
+	{
+		fclose(out);
+	}
+	return 0;
+}
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include "..\ME3SDK\SpatialGrid.h"
+
+/// <summary>
+/// The world's actors in a SpatialGrid, for the spatial Kismet actions. Filled from the object index the first time
+/// it's queried, then, once FollowEvents has been called, kept up to date from spawn and destroy events. Without the
+/// events it can't follow the world, so it's filled again for every query, as LiveActorSet writes a full snapshot for
+/// every dump. Actors move, so every tick RefreshBudget actors' locations are re-read; a location a query sees is at
+/// most Num() / RefreshBudget ticks old. Call from the game thread only.
+/// </summary>
+class ActorGrid
+{
+public:
+	static const int RefreshBudget = 256;
+
+	bool IsSynced() const
+	{
+		return Synced;
+	}
+
+	/// <summary>
+	/// Tells the grid that Added and Removed will be called for every actor spawned and destroyed from now on.
+	/// </summary>
+	void FollowEvents()
+	{
+		Following = true;
+	}
+
+	void Added(AActor* actor)
+	{
+		if (Synced && Following)
+		{
+			Grid.Add(actor, actor->ObjectInternalInteger, actor->location.X, actor->location.Y, actor->location.Z);
+		}
+	}
+
+	void Removed(AActor* actor)
+	{
+		Grid.Remove(actor);
+	}
+
+	void Tick()
+	{
+		if (!Synced || !Following)
+		{
+			return;
+		}
+		const auto objects = UObject::GObjObjects();
+		Grid.Refresh(RefreshBudget, [objects](const Entry& entry, float& x, float& y, float& z)
+		{
+			if (!IsAlive(objects, entry))
+			{
+				return false;
+			}
+			const auto& location = entry.Item->location;
+			x = location.X;
+			y = location.Y;
+			z = location.Z;
+			return true;
+		});
+	}
+
+	/// <summary>
+	/// Calls callback(AActor*, float distanceSquared) for each actor within radius of center that IsA type, or any
+	/// actor if type is nullptr.
+	/// </summary>
+	template <class TCallback>
+	void ForEachInRadius(const FVector& center, const float radius, UClass* type, TCallback callback)
+	{
+		Sync();
+		const auto objects = UObject::GObjObjects();
+		Grid.ForEachInRadius(center.X, center.Y, center.Z, radius, [&](const Entry& entry, const float distanceSquared)
+		{
+			if (Accepts(objects, entry, type))
+			{
+				callback(entry.Item, distanceSquared);
+			}
+		});
+	}
+
+	/// <summary>
+	/// Calls callback(AActor*) for each actor inside the box that IsA type, or any actor if type is nullptr.
+	/// </summary>
+	template <class TCallback>
+	void ForEachInBox(const FVector& min, const FVector& max, UClass* type, TCallback callback)
+	{
+		Sync();
+		const auto objects = UObject::GObjObjects();
+		Grid.ForEachInBox(min.X, min.Y, min.Z, max.X, max.Y, max.Z, [&](const Entry& entry)
+		{
+			if (Accepts(objects, entry, type))
+			{
+				callback(entry.Item);
+			}
+		});
+	}
+
+	/// <summary>
+	/// The actor nearest center, within maxRadius, that IsA type, or any actor if type is nullptr. Returns nullptr if
+	/// there's none.
+	/// </summary>
+	AActor* FindNearest(const FVector& center, const float maxRadius, UClass* type)
+	{
+		Sync();
+		const auto objects = UObject::GObjObjects();
+		const auto nearest = Grid.FindNearest(center.X, center.Y, center.Z, maxRadius, [&](const Entry& entry)
+		{
+			return Accepts(objects, entry, type);
+		});
+		return nearest ? nearest->Item : nullptr;
+	}
+
+	/// <summary>
+	/// Finds a class by name, e.g. "SFXPawn_Player" or "Class SFXGame.SFXPawn_Player". Classes found are remembered
+	/// while they stay in their GObjObjects slot. Names that weren't found aren't, since the class may be loaded later.
+	/// </summary>
+	UClass* FindClass(const FString& name)
+	{
+		const auto length = name.Count > 0 ? wcsnlen(name.Data, name.Count) : 0;
+		ClassKey.assign(name.Data ? name.Data : L"", length);
+		const auto cached = ClassesByName.find(ClassKey);
+		if (cached != ClassesByName.end())
+		{
+			const auto objects = UObject::GObjObjects();
+			const auto& known = cached->second;
+			if (known.Index < objects->Count && objects->Data[known.Index] == known.Class)
+			{
+				return known.Class;
+			}
+			ClassesByName.erase(cached);
+		}
+		std::string narrow(ClassKey.begin(), ClassKey.end());
+		UClass* found = nullptr;
+		if (narrow.find('.') != std::string::npos)
+		{
+			if (narrow.compare(0, 6, "Class ") != 0)
+			{
+				narrow.insert(0, "Class ");
+			}
+			found = static_cast<UClass*>(ObjectIndex::Get().FindByPath(narrow.c_str(), UClass::StaticClass()));
+		}
+		else
+		{
+			ObjectIndex::Get().ForEach(UClass::StaticClass(), [&](UObject* obj)
+			{
+				if (obj->Name == narrow.c_str())
+				{
+					found = static_cast<UClass*>(obj);
+					return false;
+				}
+				return true;
+			});
+		}
+		if (found)
+		{
+			ClassesByName[ClassKey] = KnownClass{ found, found->ObjectInternalInteger };
+		}
+		return found;
+	}
+
+private:
+	typedef SpatialGrid<AActor*>::Entry Entry;
+
+	struct KnownClass
+	{
+		UClass* Class;
+		// Its GObjObjects slot, to check it's still loaded without reading it.
+		int Index;
+	};
+
+	SpatialGrid<AActor*> Grid;
+	bool Synced = false;
+	bool Following = false;
+	std::wstring ClassKey;
+	std::unordered_map<std::wstring, KnownClass> ClassesByName;
+
+	void Sync()
+	{
+		if (Synced && Following)
+		{
+			return;
+		}
+		Grid.Clear();
+		ObjectIndex::Get().ForEach(AActor::StaticClass(), [&](UObject* obj)
+		{
+			const auto actor = static_cast<AActor*>(obj);
+			Grid.Add(actor, actor->ObjectInternalInteger, actor->location.X, actor->location.Y, actor->location.Z);
+			return true;
+		});
+		Synced = true;
+	}
+
+	/// <summary>
+	/// Whether the actor is still in its GObjObjects slot and not being deleted. It may have gone away without a
+	/// Destroyed event, so its memory is only read once the slot proves it's alive.
+	/// </summary>
+	static bool IsAlive(const TArray<UObject*>* objects, const Entry& entry)
+	{
+		return entry.Tag >= 0 && entry.Tag < objects->Count && objects->Data[entry.Tag] == entry.Item && !entry.Item->bDeleteMe;
+	}
+
+	static bool Accepts(const TArray<UObject*>* objects, const Entry& entry, UClass* type)
+	{
+		return IsAlive(objects, entry) && (!type || entry.Item->IsA(type));
+	}
+};
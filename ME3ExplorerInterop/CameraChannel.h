@@ -0,0 +1,91 @@
+#pragma once
+
+#include <windows.h>
+#include "CameraStream.h"
+
+/// <summary>
+/// The game's side of the camera slot ME3Explorer follows the camera through. While no reader has asked for the
+/// stream, IsDue costs one load; while one has, IsDue comes true at the rate it asked for. Call from the game thread
+/// only.
+/// </summary>
+class CameraChannel
+{
+public:
+	~CameraChannel()
+	{
+		if (View)
+		{
+			UnmapViewOfFile(View);
+		}
+		if (Section)
+		{
+			CloseHandle(Section);
+		}
+	}
+
+	/// <summary>
+	/// Creates or opens the slot's section. Returns false if it can't be created.
+	/// </summary>
+	bool Open()
+	{
+		Section = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, sizeof(CameraStreamHeader),
+			CAMERASTREAM_SECTION_NAME);
+		if (!Section)
+		{
+			return false;
+		}
+		const auto created = GetLastError() != ERROR_ALREADY_EXISTS;
+		View = MapViewOfFile(Section, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+		if (!View)
+		{
+			return false;
+		}
+		MEMORY_BASIC_INFORMATION region;
+		ViewSize = VirtualQuery(View, &region, sizeof(region)) ? region.RegionSize : 0;
+		if (created)
+		{
+			InitializeCameraStream(View);
+		}
+		LARGE_INTEGER frequency;
+		QueryPerformanceFrequency(&frequency);
+		TicksPerSecond = frequency.QuadPart;
+		return true;
+	}
+
+	/// <summary>
+	/// Whether a sample should be published this tick. The clock is only read while a reader wants the stream.
+	/// </summary>
+	bool IsDue()
+	{
+		if (!Writer.IsAttached())
+		{
+			// A reader that created the section may have finished setting it up since the last tick.
+			Writer.Attach(View ? GetCameraStream(View, ViewSize) : nullptr);
+		}
+		if (!Writer.IsWanted())
+		{
+			return false;
+		}
+		LARGE_INTEGER counter;
+		QueryPerformanceCounter(&counter);
+		Now = counter.QuadPart;
+		return Writer.IsDue(Now, TicksPerSecond);
+	}
+
+	/// <summary>
+	/// Publishes a sample after IsDue returned true, stamped with the time IsDue read.
+	/// </summary>
+	void Publish(CameraStreamPOV pov)
+	{
+		pov.Timestamp = Now;
+		Writer.Publish(pov);
+	}
+
+private:
+	HANDLE Section = nullptr;
+	void* View = nullptr;
+	size_t ViewSize = 0;
+	uint64_t TicksPerSecond = 0;
+	uint64_t Now = 0;
+	CameraStreamWriter Writer;
+};
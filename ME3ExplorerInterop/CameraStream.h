@@ -0,0 +1,186 @@
+#pragma once
+
+#include <string.h>
+#include <new>
+#include "CameraStreamFormat.h"
+
+/// <summary>
+/// Lays out the camera slot in memory the caller has mapped, which must be sizeof(CameraStreamHeader) bytes. Magic is
+/// set last, so a side that finds it set sees the rest initialized.
+/// </summary>
+inline void InitializeCameraStream(void* memory)
+{
+	const auto header = new (memory) CameraStreamHeader();
+	header->Version = CAMERASTREAM_VERSION;
+	header->Magic.store(CAMERASTREAM_MAGIC, std::memory_order_release);
+}
+
+/// <summary>
+/// Returns the slot's header if memory holds an initialized slot that fits in size bytes, or nullptr.
+/// </summary>
+inline CameraStreamHeader* GetCameraStream(void* memory, const size_t size)
+{
+	const auto header = static_cast<CameraStreamHeader*>(memory);
+	if (!header || size < sizeof(CameraStreamHeader) ||
+		header->Magic.load(std::memory_order_acquire) != CAMERASTREAM_MAGIC || header->Version != CAMERASTREAM_VERSION)
+	{
+		return nullptr;
+	}
+	return header;
+}
+
+/// <summary>
+/// The game's end of the slot. Publishing is a handful of stores and never waits for a reader. Only one thread may
+/// publish.
+/// </summary>
+class CameraStreamWriter
+{
+public:
+	explicit CameraStreamWriter(CameraStreamHeader* header = nullptr)
+	{
+		Attach(header);
+	}
+
+	void Attach(CameraStreamHeader* header)
+	{
+		Header = header;
+		NextDue = 0;
+	}
+
+	bool IsAttached() const
+	{
+		return Header != nullptr;
+	}
+
+	/// <summary>
+	/// Whether a reader wants the stream. Costs one load, so it can be checked every tick before reading the clock.
+	/// </summary>
+	bool IsWanted()
+	{
+		if (!Header || !Header->RateHz.load(std::memory_order_relaxed))
+		{
+			NextDue = 0;
+			return false;
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// Whether a sample should be published at now, a time in ticks of a clock that counts ticksPerSecond a second.
+	/// Always false while no reader wants the stream.
+	/// </summary>
+	bool IsDue(const uint64_t now, const uint64_t ticksPerSecond)
+	{
+		const auto rate = Header ? Header->RateHz.load(std::memory_order_relaxed) : 0;
+		if (!rate)
+		{
+			NextDue = 0;
+			return false;
+		}
+		if (now < NextDue)
+		{
+			return false;
+		}
+		const auto interval = ticksPerSecond / rate;
+		// Due times step by the interval rather than from when the tick came, so a rate that doesn't divide the frame
+		// rate still averages out to it. After a stall the schedule starts again from now, rather than catching up.
+		NextDue = NextDue && now - NextDue < interval ? NextDue + interval : now + interval;
+		return true;
+	}
+
+	/// <summary>
+	/// Publishes a sample. Its Frame is filled in here.
+	/// </summary>
+	void Publish(CameraStreamPOV pov)
+	{
+		const auto sequence = Header->Sequence.load(std::memory_order_relaxed);
+		pov.Frame = sequence / 2;
+		uint32_t words[CAMERASTREAM_WORDS];
+		memcpy(words, &pov, sizeof(words));
+		Header->Sequence.store(sequence + 1, std::memory_order_relaxed);
+		// Pairs with the fence in CameraStreamReader::Read: a reader that sees any of the words below also sees the odd
+		// sequence number, and throws the words away.
+		std::atomic_thread_fence(std::memory_order_release);
+		for (size_t i = 0; i < CAMERASTREAM_WORDS; i++)
+		{
+			Header->Words[i].store(words[i], std::memory_order_relaxed);
+		}
+		Header->Sequence.store(sequence + 2, std::memory_order_release);
+	}
+
+private:
+	CameraStreamHeader* Header = nullptr;
+	// When the next sample is due, or 0 if the stream is off.
+	uint64_t NextDue = 0;
+};
+
+/// <summary>
+/// A reader of the slot. Any number of threads and processes may read at once, each with its own CameraStreamReader.
+/// </summary>
+class CameraStreamReader
+{
+public:
+	explicit CameraStreamReader(CameraStreamHeader* header = nullptr)
+	{
+		Attach(header);
+	}
+
+	void Attach(CameraStreamHeader* header)
+	{
+		Header = header;
+	}
+
+	/// <summary>
+	/// Asks the game for rate samples a second, or 0 to stop the stream.
+	/// </summary>
+	void SetRate(const uint32_t rate)
+	{
+		Header->RateHz.store(rate, std::memory_order_relaxed);
+	}
+
+	/// <summary>
+	/// Copies the latest sample into pov. Returns false if none has been published yet, or if the writer was
+	/// publishing during each of tries attempts. Never waits; a caller that gets false just tries again later.
+	/// </summary>
+	bool Read(CameraStreamPOV& pov, int tries = 16)
+	{
+		while (tries-- > 0)
+		{
+			const auto before = Header->Sequence.load(std::memory_order_acquire);
+			if (before == 0)
+			{
+				return false;
+			}
+			if (before & 1)
+			{
+				Retries++;
+				continue;
+			}
+			uint32_t words[CAMERASTREAM_WORDS];
+			for (size_t i = 0; i < CAMERASTREAM_WORDS; i++)
+			{
+				words[i] = Header->Words[i].load(std::memory_order_relaxed);
+			}
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (Header->Sequence.load(std::memory_order_relaxed) == before)
+			{
+				memcpy(&pov, words, sizeof(words));
+				return true;
+			}
+			Retries++;
+		}
+		return false;
+	}
+
+	/// <summary>
+	/// Attempts Read has thrown away because the writer was publishing at the time.
+	/// </summary>
+	unsigned long long GetRetries() const
+	{
+		return Retries;
+	}
+
+private:
+	CameraStreamHeader* Header = nullptr;
+	unsigned long long Retries = 0;
+};
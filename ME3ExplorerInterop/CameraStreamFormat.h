@@ -0,0 +1,58 @@
+#pragma once
+
+// Layout of the shared memory slot ME3ExplorerInterop publishes the player's camera to. Shared with
+// CameraStreamReader, so this header must stay free of Windows and SDK dependencies.
+//
+// The section is one CameraStreamHeader. It holds only the latest sample; a reader that's slow just misses samples.
+// The stream is off until a reader sets RateHz to the number of samples a second it wants, and off again once it's
+// set back to 0. While it's on, the game publishes at most one sample per tick, so a rate above the frame rate gets
+// one per frame.
+//
+// The sample is guarded by a seqlock. To publish, the writer makes Sequence odd, stores the sample's words, then makes
+// Sequence even again. A reader reads Sequence, the words, then Sequence again, and keeps the words only if both
+// reads were the same even number; otherwise it tries again. The writer never waits for a reader.
+
+#include <stdint.h>
+#include <atomic>
+
+#define CAMERASTREAM_MAGIC 0x4D414343 // "CCAM"
+#define CAMERASTREAM_VERSION 1
+
+#define CAMERASTREAM_SECTION_NAME "Local\\ME3ExplorerInteropCamera"
+
+/// <summary>
+/// One sample of the camera, as the reader gets it.
+/// </summary>
+struct CameraStreamPOV
+{
+	float Location[3];
+	// Unreal rotation units, 65536 to a turn.
+	int32_t Pitch;
+	int32_t Yaw;
+	int32_t Roll;
+	// Horizontal field of view in degrees.
+	float FOV;
+	// Samples published before this one, so a reader can tell a new sample from one it has seen and count the ones
+	// it missed.
+	uint32_t Frame;
+	// When the game read the camera, in QueryPerformanceCounter ticks.
+	uint64_t Timestamp;
+};
+
+#define CAMERASTREAM_WORDS (sizeof(CameraStreamPOV) / 4)
+
+struct CameraStreamHeader
+{
+	std::atomic<uint32_t> Magic;
+	uint32_t Version;
+	// Samples a second the reader wants, or 0 for none.
+	std::atomic<uint32_t> RateHz;
+	uint8_t Reserved0[52];
+
+	// The sample is on its own cache lines, so the writer's checks of RateHz don't contend with readers.
+	std::atomic<uint32_t> Sequence;
+	std::atomic<uint32_t> Words[CAMERASTREAM_WORDS];
+};
+
+static_assert(sizeof(CameraStreamPOV) == 40, "The sample is part of the format");
+static_assert(sizeof(std::atomic<uint32_t>) == 4, "The seqlock must be made of plain 32 bit words in shared memory");
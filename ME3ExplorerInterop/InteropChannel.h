@@ -0,0 +1,153 @@
+#pragma once
+
+#include <windows.h>
+#include "InteropRing.h"
+
+/// <summary>
+/// What InteropChannel::Send did with a message.
+/// </summary>
+enum class InteropSendResult
+{
+	Sent,
+	// No reader has attached to the ring, or the one that did has exited, so the caller may fall back to another
+	// transport.
+	NoReader,
+	// The reader is attached but behind, so the message was dropped. The ring counts these for the reader.
+	Full
+};
+
+/// <summary>
+/// The game's side of the shared memory ring to ME3Explorer. Sending copies the message into the ring and, only if
+/// the reader is asleep, signals the doorbell event; it never waits for ME3Explorer. Call Send from one thread only.
+/// </summary>
+class InteropChannel
+{
+public:
+	// How often Send checks that the reader's process is still running.
+	static const unsigned long long ReaderCheckIntervalMs = 1000;
+
+	~InteropChannel()
+	{
+		ForgetReaderProcess();
+		if (View)
+		{
+			UnmapViewOfFile(View);
+		}
+		if (Section)
+		{
+			CloseHandle(Section);
+		}
+		if (Doorbell)
+		{
+			CloseHandle(Doorbell);
+		}
+	}
+
+	/// <summary>
+	/// Creates or opens the ring's section and doorbell. Returns false if either can't be created.
+	/// </summary>
+	bool Open(const uint32_t capacity = INTEROPRING_DEFAULT_CAPACITY)
+	{
+		Section = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, INTEROPRING_DATA_OFFSET + capacity,
+			INTEROPRING_SECTION_NAME);
+		if (!Section)
+		{
+			return false;
+		}
+		const auto created = GetLastError() != ERROR_ALREADY_EXISTS;
+		View = MapViewOfFile(Section, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+		Doorbell = CreateEventA(nullptr, FALSE, FALSE, INTEROPRING_DOORBELL_NAME);
+		if (!View || !Doorbell)
+		{
+			return false;
+		}
+		MEMORY_BASIC_INFORMATION region;
+		ViewSize = VirtualQuery(View, &region, sizeof(region)) ? region.RegionSize : 0;
+		if (created)
+		{
+			InitializeInteropRing(View, capacity);
+		}
+		return true;
+	}
+
+	InteropSendResult Send(const void* message, const uint32_t length)
+	{
+		if (!Writer.IsReaderAttached())
+		{
+			// A reader that created the section may have finished setting it up since the last message.
+			const auto header = View ? GetInteropRing(View, ViewSize) : nullptr;
+			Writer.Attach(header);
+		}
+		if (!IsReaderAlive())
+		{
+			return InteropSendResult::NoReader;
+		}
+		if (!Writer.Write(message, length))
+		{
+			return InteropSendResult::Full;
+		}
+		if (Writer.IsReaderWaiting())
+		{
+			SetEvent(Doorbell);
+		}
+		return InteropSendResult::Sent;
+	}
+
+private:
+	HANDLE Section = nullptr;
+	HANDLE Doorbell = nullptr;
+	void* View = nullptr;
+	size_t ViewSize = 0;
+	InteropRingWriter Writer;
+	// The attached reader's process, held open so its id can't be reused while it's watched, and when it was last
+	// checked.
+	HANDLE ReaderProcess = nullptr;
+	uint32_t ReaderProcessId = 0;
+	bool ReaderUnwatched = false;
+	unsigned long long LastReaderCheck = 0;
+
+	/// <summary>
+	/// Whether a reader is attached and its process is still running. A reader that was killed never clears
+	/// ReaderProcessId, so without this its messages would be written into a ring nobody drains.
+	/// </summary>
+	bool IsReaderAlive()
+	{
+		const auto processId = Writer.GetReaderProcessId();
+		if (!processId)
+		{
+			return false;
+		}
+		const auto now = GetTickCount64();
+		if (processId == ReaderProcessId && now - LastReaderCheck < ReaderCheckIntervalMs)
+		{
+			return true;
+		}
+		LastReaderCheck = now;
+		if (processId != ReaderProcessId)
+		{
+			ForgetReaderProcess();
+			ReaderProcessId = processId;
+			ReaderProcess = OpenProcess(SYNCHRONIZE, FALSE, processId);
+			// Running, but not ours to watch, e.g. an elevated reader. Take its word that it's attached.
+			ReaderUnwatched = !ReaderProcess && GetLastError() == ERROR_ACCESS_DENIED;
+		}
+		if (ReaderUnwatched || (ReaderProcess && WaitForSingleObject(ReaderProcess, 0) == WAIT_TIMEOUT))
+		{
+			return true;
+		}
+		Writer.DetachReader(processId);
+		ForgetReaderProcess();
+		return false;
+	}
+
+	void ForgetReaderProcess()
+	{
+		if (ReaderProcess)
+		{
+			CloseHandle(ReaderProcess);
+			ReaderProcess = nullptr;
+		}
+		ReaderProcessId = 0;
+		ReaderUnwatched = false;
+	}
+};
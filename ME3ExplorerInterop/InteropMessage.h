@@ -0,0 +1,239 @@
+#pragma once
+
+#include <string.h>
+#include <vector>
+#include "InteropMessageFormat.h"
+
+/// <summary>
+/// Builds a message in a buffer that's kept between messages, so once it has grown to fit the largest one, building
+/// a message allocates nothing. Values are copied as they are; nothing is formatted.
+/// </summary>
+class InteropMessageWriter
+{
+public:
+	void Begin()
+	{
+		Buffer.resize(sizeof(InteropMessageHeader));
+		FieldCount = 0;
+	}
+
+	/// <summary>
+	/// Fills in the header and returns the finished message, valid until the next Begin.
+	/// </summary>
+	const uint8_t* End()
+	{
+		InteropMessageHeader header;
+		header.Magic = INTEROPMESSAGE_MAGIC;
+		header.Version = INTEROPMESSAGE_VERSION;
+		header.Reserved = 0;
+		header.Length = uint32_t(Buffer.size());
+		header.FieldCount = FieldCount;
+		memcpy(Buffer.data(), &header, sizeof(header));
+		return Buffer.data();
+	}
+
+	uint32_t Size() const
+	{
+		return uint32_t(Buffer.size());
+	}
+
+	/// <summary>
+	/// Adds a Name or String field. Characters wider than 16 bits, which only off Windows wchar_t can hold, are cut
+	/// to their low 16 bits.
+	/// </summary>
+	template <class TChar>
+	void AddString(const EInteropFieldType type, const TChar* text, const uint32_t length)
+	{
+		const auto offset = Grow(1 + 4 + length * 2);
+		Buffer[offset] = type;
+		memcpy(&Buffer[offset + 1], &length, 4);
+		if (sizeof(TChar) == 2)
+		{
+			if (length)
+			{
+				memcpy(&Buffer[offset + 5], text, length * 2);
+			}
+		}
+		else
+		{
+			for (uint32_t i = 0; i < length; i++)
+			{
+				const auto unit = uint16_t(text[i]);
+				memcpy(&Buffer[offset + 5 + i * 2], &unit, 2);
+			}
+		}
+	}
+
+	void AddVector(const float x, const float y, const float z)
+	{
+		const auto offset = Grow(1 + 12);
+		Buffer[offset] = IMSGFIELD_Vector;
+		memcpy(&Buffer[offset + 1], &x, 4);
+		memcpy(&Buffer[offset + 5], &y, 4);
+		memcpy(&Buffer[offset + 9], &z, 4);
+	}
+
+	void AddFloat(const float value)
+	{
+		const auto offset = Grow(1 + 4);
+		Buffer[offset] = IMSGFIELD_Float;
+		memcpy(&Buffer[offset + 1], &value, 4);
+	}
+
+	void AddInt(const int32_t value)
+	{
+		const auto offset = Grow(1 + 4);
+		Buffer[offset] = IMSGFIELD_Int;
+		memcpy(&Buffer[offset + 1], &value, 4);
+	}
+
+	void AddBool(const bool value)
+	{
+		const auto offset = Grow(1 + 1);
+		Buffer[offset] = IMSGFIELD_Bool;
+		Buffer[offset + 1] = value ? 1 : 0;
+	}
+
+private:
+	std::vector<uint8_t> Buffer;
+	uint32_t FieldCount = 0;
+
+	size_t Grow(const size_t size)
+	{
+		const auto offset = Buffer.size();
+		Buffer.resize(offset + size);
+		FieldCount++;
+		return offset;
+	}
+};
+
+/// <summary>
+/// One decoded field. Only the members for its Type are set. String points into the message, at unaligned
+/// little endian UTF-16 code units; use GetChar to read them.
+/// </summary>
+struct InteropField
+{
+	EInteropFieldType Type;
+	const uint8_t* String;
+	uint32_t StringLength;
+	float Vector[3];
+	float Float;
+	int32_t Int;
+	bool Bool;
+
+	uint16_t GetChar(const uint32_t index) const
+	{
+		return uint16_t(String[index * 2] | (String[index * 2 + 1] << 8));
+	}
+};
+
+/// <summary>
+/// Decodes a message without copying it. Every read is checked against the message's length, so a truncated or
+/// corrupt message makes Open or Next return false rather than read past it.
+/// </summary>
+class InteropMessageReader
+{
+public:
+	/// <summary>
+	/// Starts reading the message at data, which holds size bytes. Returns false if it isn't a message this reader
+	/// understands or it's longer than size.
+	/// </summary>
+	bool Open(const uint8_t* data, const uint32_t size)
+	{
+		Data = data;
+		Position = End = 0;
+		FieldsLeft = 0;
+		Corrupt = false;
+		InteropMessageHeader header;
+		if (size < sizeof(header))
+		{
+			return false;
+		}
+		memcpy(&header, data, sizeof(header));
+		if (header.Magic != INTEROPMESSAGE_MAGIC || header.Version != INTEROPMESSAGE_VERSION ||
+			header.Length < sizeof(header) || header.Length > size)
+		{
+			return false;
+		}
+		Position = sizeof(header);
+		End = header.Length;
+		FieldsLeft = header.FieldCount;
+		return true;
+	}
+
+	/// <summary>
+	/// Decodes the next field. Returns false after the last one, or at a field that's truncated or of an unknown
+	/// type; IsCorrupt tells those apart.
+	/// </summary>
+	bool Next(InteropField& field)
+	{
+		if (!FieldsLeft)
+		{
+			return false;
+		}
+		auto ok = Read(&field.Type, 1);
+		switch (ok ? field.Type : 0)
+		{
+		case IMSGFIELD_Name:
+		case IMSGFIELD_String:
+			ok = Read(&field.StringLength, 4) && field.StringLength <= (End - Position) / 2;
+			if (ok)
+			{
+				field.String = Data + Position;
+				Position += field.StringLength * 2;
+			}
+			break;
+		case IMSGFIELD_Vector:
+			ok = Read(field.Vector, 12);
+			break;
+		case IMSGFIELD_Float:
+			ok = Read(&field.Float, 4);
+			break;
+		case IMSGFIELD_Int:
+			ok = Read(&field.Int, 4);
+			break;
+		case IMSGFIELD_Bool:
+		{
+			uint8_t value;
+			ok = Read(&value, 1);
+			field.Bool = value != 0;
+			break;
+		}
+		default:
+			ok = false;
+			break;
+		}
+		if (!ok)
+		{
+			Position = End;
+			Corrupt = true;
+			FieldsLeft = 0;
+			return false;
+		}
+		FieldsLeft--;
+		return true;
+	}
+
+	bool IsCorrupt() const
+	{
+		return Corrupt;
+	}
+
+private:
+	const uint8_t* Data = nullptr;
+	uint32_t Position = 0;
+	uint32_t End = 0;
+	uint32_t FieldsLeft = 0;
+	bool Corrupt = false;
+
+	bool Read(void* value, const uint32_t size)
+	{
+		if (End - Position < size)
+		{
+			return false;
+		}
+		memcpy(value, Data + Position, size);
+		Position += size;
+		return true;
+	}
+};
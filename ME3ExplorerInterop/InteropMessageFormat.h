@@ -0,0 +1,42 @@
+#pragma once
+
+// Layout of the messages SeqAct_SendMessageToME3Explorer sends to ME3Explorer. Shared with the receiving tools, so
+// this header must stay free of Windows and SDK dependencies.
+//
+// A message is an InteropMessageHeader followed by FieldCount fields, in the order the op's variable links list
+// them. A field is a uint8_t type from EInteropFieldType followed by its value:
+//   IMSGFIELD_Name, IMSGFIELD_String   uint32_t length in UTF-16 code units, then the code units, not null terminated
+//   IMSGFIELD_Vector                   three floats, X Y Z
+//   IMSGFIELD_Float                    float
+//   IMSGFIELD_Int                      int32_t
+//   IMSGFIELD_Bool                     uint8_t, 0 or 1
+// All values are little endian and unaligned. Length in the header covers the whole message, header included, so a
+// reader can skip a message without understanding its fields.
+
+#include <stdint.h>
+
+#define INTEROPMESSAGE_MAGIC 0x4753 // "SG"
+#define INTEROPMESSAGE_VERSION 1
+
+enum EInteropFieldType : uint8_t
+{
+	IMSGFIELD_Name = 1,
+	IMSGFIELD_String = 2,
+	IMSGFIELD_Vector = 3,
+	IMSGFIELD_Float = 4,
+	IMSGFIELD_Int = 5,
+	IMSGFIELD_Bool = 6,
+};
+
+#pragma pack(push, 1)
+struct InteropMessageHeader
+{
+	uint16_t Magic;
+	uint8_t Version;
+	uint8_t Reserved;
+	uint32_t Length;
+	uint32_t FieldCount;
+};
+#pragma pack(pop)
+
+static_assert(sizeof(InteropMessageHeader) == 12, "The message header is part of the format");
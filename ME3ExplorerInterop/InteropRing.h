@@ -0,0 +1,226 @@
+#pragma once
+
+#include <string.h>
+#include <new>
+#include "InteropRingFormat.h"
+
+/// <summary>
+/// Lays out a ring in memory the caller has mapped, which must be INTEROPRING_DATA_OFFSET + capacity bytes.
+/// Capacity must be a power of two. Magic is set last, so a side that finds it set sees the rest initialized.
+/// </summary>
+inline void InitializeInteropRing(void* memory, const uint32_t capacity)
+{
+	const auto header = new (memory) InteropRingHeader();
+	header->Version = INTEROPRING_VERSION;
+	header->Capacity = capacity;
+	header->Magic.store(INTEROPRING_MAGIC, std::memory_order_release);
+}
+
+/// <summary>
+/// Returns the ring's header if memory holds an initialized ring that fits in size bytes, or nullptr.
+/// </summary>
+inline InteropRingHeader* GetInteropRing(void* memory, const size_t size)
+{
+	const auto header = static_cast<InteropRingHeader*>(memory);
+	if (!header || size < INTEROPRING_DATA_OFFSET || header->Magic.load(std::memory_order_acquire) != INTEROPRING_MAGIC ||
+		header->Version != INTEROPRING_VERSION)
+	{
+		return nullptr;
+	}
+	const auto capacity = header->Capacity;
+	if (capacity < 64 || (capacity & (capacity - 1)) != 0 || capacity > size - INTEROPRING_DATA_OFFSET)
+	{
+		return nullptr;
+	}
+	return header;
+}
+
+inline uint32_t GetInteropRecordSize(const uint32_t length)
+{
+	return 4 + ((length + 3) & ~3u);
+}
+
+/// <summary>
+/// The game's end of the ring. Write never blocks: a message that doesn't fit is dropped, counted in Dropped, and
+/// Write returns false. Only one thread may write.
+/// </summary>
+class InteropRingWriter
+{
+public:
+	explicit InteropRingWriter(InteropRingHeader* header = nullptr)
+	{
+		Attach(header);
+	}
+
+	void Attach(InteropRingHeader* header)
+	{
+		Header = header;
+		Data = header ? reinterpret_cast<uint8_t*>(header) + INTEROPRING_DATA_OFFSET : nullptr;
+	}
+
+	bool IsReaderAttached() const
+	{
+		return GetReaderProcessId() != 0;
+	}
+
+	uint32_t GetReaderProcessId() const
+	{
+		return Header ? Header->ReaderProcessId.load(std::memory_order_relaxed) : 0;
+	}
+
+	/// <summary>
+	/// Marks the ring as having no reader, for when the reader with this process id has gone away without saying so.
+	/// A reader that attached since keeps its place.
+	/// </summary>
+	void DetachReader(uint32_t processId)
+	{
+		if (Header)
+		{
+			Header->ReaderProcessId.compare_exchange_strong(processId, 0, std::memory_order_relaxed);
+		}
+	}
+
+	/// <summary>
+	/// Copies a message into the ring and publishes it. Returns false if it doesn't fit, either because the reader
+	/// is behind or because the message is larger than half the ring and never could.
+	/// </summary>
+	bool Write(const void* message, const uint32_t length)
+	{
+		const auto capacity = Header->Capacity;
+		const auto needed = GetInteropRecordSize(length);
+		if (needed > capacity / 2)
+		{
+			Header->Dropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		auto write = Header->WriteCursor.load(std::memory_order_relaxed);
+		const auto read = Header->ReadCursor.load(std::memory_order_acquire);
+		auto offset = write & (capacity - 1);
+		const auto untilEnd = capacity - offset;
+		const auto padding = untilEnd < needed ? untilEnd : 0;
+		if (capacity - (write - read) < needed + padding)
+		{
+			Header->Dropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		if (padding)
+		{
+			const auto marker = INTEROPRING_PADDING;
+			memcpy(Data + offset, &marker, 4);
+			write += padding;
+			offset = 0;
+		}
+		memcpy(Data + offset, &length, 4);
+		memcpy(Data + offset + 4, message, length);
+		Header->WriteCursor.store(write + needed, std::memory_order_release);
+		return true;
+	}
+
+	/// <summary>
+	/// After a Write, whether the reader is asleep and the doorbell must be rung to wake it.
+	/// </summary>
+	bool IsReaderWaiting() const
+	{
+		// Orders the cursor store above before this load, pairing with the reader's store of ReaderWaiting before
+		// its last look at the cursor. One side or the other always sees the record.
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		return Header->ReaderWaiting.load(std::memory_order_relaxed) != 0;
+	}
+
+private:
+	InteropRingHeader* Header = nullptr;
+	uint8_t* Data = nullptr;
+};
+
+/// <summary>
+/// The reading end of the ring. Only one thread may read.
+/// </summary>
+class InteropRingReader
+{
+public:
+	explicit InteropRingReader(InteropRingHeader* header = nullptr)
+	{
+		Attach(header);
+	}
+
+	void Attach(InteropRingHeader* header)
+	{
+		Header = header;
+		Data = header ? reinterpret_cast<uint8_t*>(header) + INTEROPRING_DATA_OFFSET : nullptr;
+	}
+
+	bool IsEmpty() const
+	{
+		return Header->ReadCursor.load(std::memory_order_relaxed) == Header->WriteCursor.load(std::memory_order_acquire);
+	}
+
+	/// <summary>
+	/// Skips everything written so far, e.g. messages left over from a reader that went away.
+	/// </summary>
+	void SkipAll()
+	{
+		Header->ReadCursor.store(Header->WriteCursor.load(std::memory_order_acquire), std::memory_order_release);
+	}
+
+	/// <summary>
+	/// Calls handler(const uint8_t* message, uint32_t length) for each message in the ring and returns how many there
+	/// were. The message is only valid during the call.
+	/// </summary>
+	template <class THandler>
+	unsigned Drain(THandler handler)
+	{
+		const auto capacity = Header->Capacity;
+		auto read = Header->ReadCursor.load(std::memory_order_relaxed);
+		const auto write = Header->WriteCursor.load(std::memory_order_acquire);
+		unsigned count = 0;
+		while (read != write)
+		{
+			const auto offset = read & (capacity - 1);
+			uint32_t length;
+			memcpy(&length, Data + offset, 4);
+			if (length == INTEROPRING_PADDING)
+			{
+				read += capacity - offset;
+				continue;
+			}
+			if (GetInteropRecordSize(length) > capacity - offset)
+			{
+				// Not something the writer could have written. Drop what's left rather than read past the ring.
+				read = write;
+				break;
+			}
+			handler(static_cast<const uint8_t*>(Data + offset + 4), length);
+			read += GetInteropRecordSize(length);
+			// Released per record, so the writer gets the space back while a long batch is still being handled.
+			Header->ReadCursor.store(read, std::memory_order_release);
+			count++;
+		}
+		Header->ReadCursor.store(read, std::memory_order_release);
+		return count;
+	}
+
+	/// <summary>
+	/// Call before sleeping on the doorbell. Returns false, and stays awake, if a message arrived meanwhile.
+	/// </summary>
+	bool PrepareToWait()
+	{
+		Header->ReaderWaiting.store(1, std::memory_order_relaxed);
+		// Pairs with the fence in InteropRingWriter::IsReaderWaiting.
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (!IsEmpty())
+		{
+			Header->ReaderWaiting.store(0, std::memory_order_relaxed);
+			return false;
+		}
+		return true;
+	}
+
+	void DoneWaiting()
+	{
+		Header->ReaderWaiting.store(0, std::memory_order_relaxed);
+	}
+
+private:
+	InteropRingHeader* Header = nullptr;
+	uint8_t* Data = nullptr;
+};
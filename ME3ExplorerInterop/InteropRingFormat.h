@@ -0,0 +1,53 @@
+#pragma once
+
+// Layout of the shared memory ring ME3ExplorerInterop sends messages to ME3Explorer through. Shared with
+// InteropRingReader, so this header must stay free of Windows and SDK dependencies.
+//
+// The section is an InteropRingHeader padded to INTEROPRING_DATA_OFFSET, followed by Capacity bytes used as a ring.
+// Capacity is a power of two. There is one writer, the game, and one reader. Each owns its cursor; both cursors count
+// every byte ever written or read, modulo 2^32, so the ring holds WriteCursor - ReadCursor bytes.
+//
+// A record is a uint32_t Length followed by Length bytes of message, padded to a multiple of 4. Records never wrap:
+// when one doesn't fit before the end of the ring, the writer fills the rest with a record whose Length is
+// INTEROPRING_PADDING and starts again at offset 0. Each record holds one message, laid out as described in
+// InteropMessageFormat.h.
+//
+// Whichever side creates the section initializes the header and sets Magic last. A reader sets ReaderProcessId while
+// attached; the writer doesn't use the ring otherwise, and clears it if that process has exited. Before a reader waits on the doorbell event it sets
+// ReaderWaiting, then checks the ring is still empty; after publishing a record the writer signals the event if
+// ReaderWaiting is set.
+
+#include <stdint.h>
+#include <atomic>
+
+#define INTEROPRING_MAGIC 0x474E5249 // "IRNG"
+#define INTEROPRING_VERSION 1
+#define INTEROPRING_DATA_OFFSET 256
+#define INTEROPRING_DEFAULT_CAPACITY (1024 * 1024)
+
+#define INTEROPRING_SECTION_NAME "Local\\ME3ExplorerInteropRing"
+#define INTEROPRING_DOORBELL_NAME "Local\\ME3ExplorerInteropDoorbell"
+
+// Length of a record that only fills the end of the ring.
+#define INTEROPRING_PADDING 0xFFFFFFFFu
+
+struct InteropRingHeader
+{
+	std::atomic<uint32_t> Magic;
+	uint32_t Version;
+	uint32_t Capacity;
+	std::atomic<uint32_t> ReaderProcessId;
+	std::atomic<uint32_t> ReaderWaiting;
+	// Messages the writer couldn't fit, because the reader fell behind or they're larger than half the ring.
+	std::atomic<uint32_t> Dropped;
+	uint8_t Reserved0[40];
+
+	// Each cursor is on its own cache line so the two sides don't contend for one.
+	std::atomic<uint32_t> WriteCursor;
+	uint8_t Reserved1[60];
+	std::atomic<uint32_t> ReadCursor;
+	uint8_t Reserved2[60];
+};
+
+static_assert(sizeof(std::atomic<uint32_t>) == 4, "Cursors must be plain 32 bit words in shared memory");
+static_assert(sizeof(InteropRingHeader) <= INTEROPRING_DATA_OFFSET, "Header must fit before the data");
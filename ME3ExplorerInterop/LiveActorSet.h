@@ -0,0 +1,240 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// <summary>
+/// The actors in the world, each in a numbered slot that SeqAct_ME3ExpAcessDumpedActorsList indexes. The set is kept
+/// up to date from spawn and destroy events, so a dump doesn't rescan GObjObjects. Every change is numbered. A dump
+/// writes either a full snapshot, or only the slots filled and emptied since a sequence number the editor already
+/// has. Call from the game thread only.
+/// </summary>
+class LiveActorSet
+{
+public:
+	// Changes kept for diffs. A diff from before the oldest one kept is answered with a full snapshot.
+	static const size_t MaxChanges = 65536;
+
+	/// <summary>
+	/// Whether a snapshot has been taken. Events before then are ignored, since the first dump rescans anyway.
+	/// </summary>
+	bool IsSynced() const
+	{
+		return Synced;
+	}
+
+	void Added(AActor* actor)
+	{
+		if (!Synced || SlotOf.count(actor))
+		{
+			return;
+		}
+		auto slot = int(Slots.size());
+		if (!FreeSlots.empty())
+		{
+			slot = FreeSlots.back();
+			FreeSlots.pop_back();
+		}
+		else
+		{
+			Slots.emplace_back();
+		}
+		Fill(slot, actor, ++Sequence);
+		Record(slot, true);
+	}
+
+	void Removed(AActor* actor)
+	{
+		const auto it = SlotOf.find(actor);
+		if (it != SlotOf.end())
+		{
+			Empty(it->second);
+		}
+	}
+
+	/// <summary>
+	/// Appends the actors to out and returns the sequence number they're current as of. Writes only what changed since
+	/// the given sequence number, or a full snapshot if it's 0 or too old to diff from.
+	/// </summary>
+	unsigned Dump(const unsigned since, std::string& out)
+	{
+		if (Synced)
+		{
+			RemoveStale();
+		}
+		if (!Synced || since == 0 || since < OldestSequence || since > Sequence)
+		{
+			Resync();
+			for (const auto& slot : Slots)
+			{
+				AppendActor(out, slot.Actor);
+			}
+			return Sequence;
+		}
+
+		out += "#diff ";
+		out += std::to_string(since);
+		out += ' ';
+		out += std::to_string(Sequence);
+		out += '\n';
+		// A slot filled and emptied again within the range is left out entirely, since the editor never saw it.
+		for (auto i = size_t(since + 1 - (Sequence + 1 - Changes.size())); i < Changes.size(); i++)
+		{
+			const auto& change = Changes[i];
+			const auto& slot = Slots[change.Slot];
+			if (change.Added)
+			{
+				if (slot.Actor && slot.AddedSequence == change.AddedSequence)
+				{
+					out += '+';
+					out += std::to_string(change.Slot);
+					out += ':';
+					AppendActor(out, slot.Actor);
+				}
+			}
+			else if (change.AddedSequence <= since)
+			{
+				out += '-';
+				out += std::to_string(change.Slot);
+				out += '\n';
+			}
+		}
+		return Sequence;
+	}
+
+	int GetSlotCount() const
+	{
+		return int(Slots.size());
+	}
+
+	/// <summary>
+	/// The actor in a slot, or nullptr if it's out of range or was emptied.
+	/// </summary>
+	AActor* GetActor(const int slot) const
+	{
+		return slot >= 0 && slot < int(Slots.size()) ? Slots[slot].Actor : nullptr;
+	}
+
+private:
+	struct Slot
+	{
+		AActor* Actor = nullptr;
+		// Where the actor was in GObjObjects, to tell whether it's still alive without touching it.
+		int ObjectIndex = -1;
+		UClass* Class = nullptr;
+		unsigned AddedSequence = 0;
+	};
+
+	struct Change
+	{
+		int Slot;
+		bool Added;
+		// Sequence number of the change that filled the slot, to pair an emptying with its filling.
+		unsigned AddedSequence;
+	};
+
+	bool Synced = false;
+	// Number of the newest change. Changes[i] is numbered Sequence + 1 - Changes.size() + i.
+	unsigned Sequence = 0;
+	// Diffs can start from this number or later.
+	unsigned OldestSequence = 0;
+	std::vector<Slot> Slots;
+	std::vector<int> FreeSlots;
+	std::unordered_map<AActor*, int> SlotOf;
+	std::vector<Change> Changes;
+
+	/// <summary>
+	/// Rebuilds the set from GObjObjects with no empty slots. Slot numbers change, so diffs from any earlier sequence
+	/// number are no longer possible; Resync counts as a change so an editor that was current also takes a snapshot.
+	/// </summary>
+	void Resync()
+	{
+		Slots.clear();
+		FreeSlots.clear();
+		SlotOf.clear();
+		Changes.clear();
+		Sequence++;
+		OldestSequence = Sequence;
+		ObjectIndex::Get().ForEach(AActor::StaticClass(), [&](UObject* obj)
+		{
+			Slots.emplace_back();
+			Fill(int(Slots.size()) - 1, static_cast<AActor*>(obj), Sequence);
+			return true;
+		});
+		Synced = true;
+	}
+
+	/// <summary>
+	/// Empties the slots of actors that went away without a Destroyed event, e.g. with a streaming level that was
+	/// unloaded. Only the slot's GObjObjects entry is read until it proves the actor is still there.
+	/// </summary>
+	void RemoveStale()
+	{
+		const auto objects = UObject::GObjObjects();
+		for (auto i = 0; i < int(Slots.size()); i++)
+		{
+			const auto& slot = Slots[i];
+			if (slot.Actor && (slot.ObjectIndex >= objects->Count || objects->Data[slot.ObjectIndex] != slot.Actor ||
+				slot.Actor->Class != slot.Class || slot.Actor->bDeleteMe))
+			{
+				Empty(i);
+			}
+		}
+	}
+
+	void Fill(const int index, AActor* actor, const unsigned sequence)
+	{
+		auto& slot = Slots[index];
+		slot.Actor = actor;
+		slot.ObjectIndex = actor->ObjectInternalInteger;
+		slot.Class = actor->Class;
+		slot.AddedSequence = sequence;
+		SlotOf[actor] = index;
+	}
+
+	void Empty(const int index)
+	{
+		auto& slot = Slots[index];
+		SlotOf.erase(slot.Actor);
+		slot.Actor = nullptr;
+		FreeSlots.push_back(index);
+		++Sequence;
+		Record(index, false);
+	}
+
+	void Record(const int slot, const bool added)
+	{
+		Change change;
+		change.Slot = slot;
+		change.Added = added;
+		change.AddedSequence = Slots[slot].AddedSequence;
+		Changes.push_back(change);
+		if (Changes.size() > MaxChanges)
+		{
+			Changes.erase(Changes.begin(), Changes.begin() + MaxChanges / 2);
+			OldestSequence = Sequence - unsigned(Changes.size());
+		}
+	}
+
+	/// <summary>
+	/// Appends a line in the original dump format: map:name, then _number if the name has one, then :static.
+	/// </summary>
+	static void AppendActor(std::string& out, AActor* actor)
+	{
+		out += actor->GetContainingMapName();
+		out += ':';
+		out += actor->Name.GetName();
+		const auto index = actor->Name.GetIndex();
+		if (index > 0)
+		{
+			out += '_';
+			out += std::to_string(index - 1);
+		}
+		if (actor->bStatic || !actor->bMovable)
+		{
+			out += ":static";
+		}
+		out += '\n';
+	}
+};
@@ -11,14 +11,21 @@
 #include "Strsafe.h"
 
 #include "../ME3SDK/ME3TweaksHeader.h"
-#include "../detours/detours.h"
+#include "../ME3SDK/Packages/SFXGame.h"
+#include "../ME3SDK/ProcessEventHub.h"
 #include "ME3ExpInterop.h"
+#include "InteropChannel.h"
+#include "InteropMessage.h"
+#include "ActorGrid.h"
+#include "CameraChannel.h"
+#include "LiveActorSet.h"
 
 #define _CRT_SECURE_NO_WARNINGS
-#pragma comment(lib, "detours.lib") //Library needed for Hooking part.
 #pragma comment(lib, "shlwapi.lib")
 
 TCHAR actorDumpFilePath[MAX_PATH];
+InteropChannel interopChannel;
+CameraChannel cameraChannel;
 
 char* GetUObjectClassName(UObject* object)
 {
@@ -29,35 +36,11 @@ char* GetUObjectClassName(UObject* object)
 	return cOutBuffer;
 }
 
-wchar_t msgBuffer[512];
-wchar_t* msgPtr;
-int writePos = 0;
-void WriteToMsgBuffer(const wchar_t* wstr, const int len, const bool msgStart = false) {
-	if (msgStart)
-	{
-		if (writePos > 400)
-		{
-			writePos = 0;
-		}
-		msgPtr = msgBuffer + writePos;
-	}
-	else
-	{
-		msgBuffer[writePos] = ' ';
-		writePos++;
-	}
-	for (auto i = 0; i < len && wstr[i] != 0 && writePos < 512; i++, writePos++)
-	{
-		msgBuffer[writePos] = wstr[i];
-	}
-}
-
-void WriteToMsgBuffer(const FString& fstr, const bool msgStart = false) {
-	WriteToMsgBuffer(fstr.Data, fstr.Num(), msgStart);
-}
+InteropMessageWriter interopMessage;
 
-void WriteToMsgBuffer(wstring& wstr, const bool msgStart = false) {
-	WriteToMsgBuffer(wstr.c_str(), wstr.length(), msgStart);
+void AddStringField(const EInteropFieldType type, const FString& fstr)
+{
+	interopMessage.AddString(type, fstr.Data, uint32_t(fstr.Count > 0 ? wcsnlen(fstr.Data, fstr.Count) : 0));
 }
 
 struct ME3ExpMsg
@@ -65,64 +48,153 @@ struct ME3ExpMsg
 	wchar_t msg[100];
 };
 
+/// <summary>
+/// Formats a message as text, the way versions of ME3Explorer that only take window messages expect it: the message
+/// name, then each field's type and value, separated by spaces. Text that doesn't fit in msg is cut off.
+/// </summary>
+void FormatLegacyMessage(const uint8_t* message, const uint32_t size, ME3ExpMsg& msg)
+{
+	constexpr auto capacity = int(sizeof(msg.msg) / sizeof(wchar_t));
+	auto length = 0;
+	const auto append = [&](const wchar_t* text, const int textLength)
+	{
+		for (auto i = 0; i < textLength && length < capacity - 1; i++)
+		{
+			msg.msg[length++] = text[i];
+		}
+	};
+	wchar_t text[64];
+	InteropMessageReader reader;
+	InteropField field;
+	// The name goes first wherever its link is.
+	for (auto pass = 0; pass < 2; pass++)
+	{
+		reader.Open(message, size);
+		while (reader.Next(field))
+		{
+			if ((field.Type == IMSGFIELD_Name) != (pass == 0))
+			{
+				continue;
+			}
+			if (length)
+			{
+				append(L" ", 1);
+			}
+			auto textLength = 0;
+			switch (field.Type)
+			{
+			case IMSGFIELD_Name:
+			case IMSGFIELD_String:
+				if (field.Type == IMSGFIELD_String)
+				{
+					append(L"string ", 7);
+				}
+				for (uint32_t i = 0; i < field.StringLength && length < capacity - 1; i++)
+				{
+					msg.msg[length++] = field.GetChar(i);
+				}
+				break;
+			case IMSGFIELD_Vector:
+				textLength = swprintf(text, 64, L"vector %f %f %f", field.Vector[0], field.Vector[1], field.Vector[2]);
+				break;
+			case IMSGFIELD_Float:
+				textLength = swprintf(text, 64, L"float %f", field.Float);
+				break;
+			case IMSGFIELD_Int:
+				textLength = swprintf(text, 64, L"int %d", field.Int);
+				break;
+			case IMSGFIELD_Bool:
+				textLength = swprintf(text, 64, L"bool %d", field.Bool ? 1 : 0);
+				break;
+			default:
+				break;
+			}
+			append(text, textLength);
+		}
+	}
+	msg.msg[length] = 0;
+}
+
+enum EMessageLink { MSGLINK_MessageName, MSGLINK_String, MSGLINK_Vector, MSGLINK_Float, MSGLINK_Int, MSGLINK_Bool };
+static constexpr FStringSwitch<6> MessageLinks = { { L"MessageName", L"String", L"Vector", L"Float", L"Int", L"Bool" } };
 
 void SendMessageToMe3Explorer(USequenceOp* op)
 {
+	interopMessage.Begin();
 	const auto numVarLinks = op->VariableLinks.Num();
 	for (auto i = 0; i < numVarLinks; i++)
 	{
 		const auto& varLink = op->VariableLinks(i);
+		const auto linkType = MessageLinks.Match(varLink.LinkDesc);
+		if (linkType < 0)
+		{
+			continue;
+		}
 		for (auto j = 0; j < varLink.LinkedVariables.Num(); ++j)
 		{
 			const auto seqVar = varLink.LinkedVariables(j);
-			if (varLink.LinkDesc == L"MessageName" && IsA<USeqVar_String>(seqVar))
-			{
-				const USeqVar_String* strVar = static_cast<USeqVar_String*>(seqVar);
-				WriteToMsgBuffer(strVar->StrValue, true);
-			}
-			else if (varLink.LinkDesc == L"String" && IsA<USeqVar_String>(seqVar))
-			{
-				const USeqVar_String* strVar = static_cast<USeqVar_String*>(seqVar);
-				WriteToMsgBuffer(L"string", 7);
-				WriteToMsgBuffer(strVar->StrValue);
-			}
-			else if (varLink.LinkDesc == L"Vector" && IsA<USeqVar_Vector>(seqVar))
-			{
-				const USeqVar_Vector* vectorVar = static_cast<USeqVar_Vector*>(seqVar);
-				WriteToMsgBuffer(L"vector", 7);
-				WriteToMsgBuffer(to_wstring(vectorVar->VectValue.X));
-				WriteToMsgBuffer(to_wstring(vectorVar->VectValue.Y));
-				WriteToMsgBuffer(to_wstring(vectorVar->VectValue.Z));
-			}
-			else if (varLink.LinkDesc == L"Float" && IsA<USeqVar_Float>(seqVar))
-			{
-				const USeqVar_Float* floatVar = static_cast<USeqVar_Float*>(seqVar);
-				WriteToMsgBuffer(L"float", 6);
-				WriteToMsgBuffer(to_wstring(floatVar->FloatValue));
-			}
-			else if (varLink.LinkDesc == L"Int" && IsA<USeqVar_Int>(seqVar))
-			{
-				const USeqVar_Int* intVar = static_cast<USeqVar_Int*>(seqVar);
-				WriteToMsgBuffer(L"int", 4);
-				WriteToMsgBuffer(to_wstring(intVar->IntValue));
-			}
-			else if (varLink.LinkDesc == L"Bool" && IsA<USeqVar_Bool>(seqVar))
+			switch (linkType)
 			{
-				const USeqVar_Bool* boolVar = static_cast<USeqVar_Bool*>(seqVar);
-				WriteToMsgBuffer(L"bool", 5);
-				WriteToMsgBuffer(to_wstring(boolVar->bValue));
+			case MSGLINK_MessageName:
+				if (IsA<USeqVar_String>(seqVar))
+				{
+					AddStringField(IMSGFIELD_Name, static_cast<USeqVar_String*>(seqVar)->StrValue);
+				}
+				break;
+			case MSGLINK_String:
+				if (IsA<USeqVar_String>(seqVar))
+				{
+					AddStringField(IMSGFIELD_String, static_cast<USeqVar_String*>(seqVar)->StrValue);
+				}
+				break;
+			case MSGLINK_Vector:
+				if (IsA<USeqVar_Vector>(seqVar))
+				{
+					const auto& vector = static_cast<USeqVar_Vector*>(seqVar)->VectValue;
+					interopMessage.AddVector(vector.X, vector.Y, vector.Z);
+				}
+				break;
+			case MSGLINK_Float:
+				if (IsA<USeqVar_Float>(seqVar))
+				{
+					interopMessage.AddFloat(static_cast<USeqVar_Float*>(seqVar)->FloatValue);
+				}
+				break;
+			case MSGLINK_Int:
+				if (IsA<USeqVar_Int>(seqVar))
+				{
+					interopMessage.AddInt(static_cast<USeqVar_Int*>(seqVar)->IntValue);
+				}
+				break;
+			case MSGLINK_Bool:
+				if (IsA<USeqVar_Bool>(seqVar))
+				{
+					interopMessage.AddBool(static_cast<USeqVar_Bool*>(seqVar)->bValue != 0);
+				}
+				break;
+			default:
+				break;
 			}
 		}
 	}
-	msgBuffer[writePos] = 0;
-	writePos++;
-	const auto handle = FindWindow(nullptr, L"ME3Explorer");
+	const auto message = interopMessage.End();
+	// Window messages are only sent while no reader has attached to the ring, for versions of ME3Explorer that
+	// predate it. Only they get the message as text. A reader that's attached but behind loses the message rather
+	// than being sent it a second way.
+	if (interopChannel.Send(message, interopMessage.Size()) != InteropSendResult::NoReader)
+	{
+		return;
+	}
+	static HWND handle = nullptr;
+	if (!handle || !IsWindow(handle))
+	{
+		handle = FindWindow(nullptr, L"ME3Explorer");
+	}
 	if (handle)
 	{
 		constexpr unsigned long SENT_FROM_ME3 = 0x02AC00C2;
 		ME3ExpMsg msg;
-		const auto len = writePos - (msgPtr - msgBuffer);
-		wcsncpy_s(msg.msg, msgPtr, len);
+		FormatLegacyMessage(message, interopMessage.Size(), msg);
 		COPYDATASTRUCT cds;
 		ZeroMemory(&cds, sizeof(COPYDATASTRUCT));
 		cds.dwData = SENT_FROM_ME3;
@@ -132,62 +204,227 @@ void SendMessageToMe3Explorer(USequenceOp* op)
 	}
 }
 
-TArray<UObject*> Actors;
+LiveActorSet liveActors;
+string actorDumpText;
+FNameEntry* postBeginPlayName;
+FNameEntry* destroyedName;
+bool actorEventsHooked = false;
+
+// SeqAct_ME3ExpAcessDumpedActorsList reads from whichever list was filled last: the dump's slots or the actors a
+// spatial query found.
+enum EActorList { ACTORLIST_Dump, ACTORLIST_Query };
+EActorList accessedList = ACTORLIST_Dump;
+ActorGrid actorGrid;
+vector<AActor*> queryResults;
+
+enum EDumpActorsLink { DUMPLINK_Length, DUMPLINK_Sequence };
+static constexpr FStringSwitch<2> DumpActorsLinks = { { L"Length", L"Sequence" } };
 
+/// <summary>
+/// Writes the actors to ME3ExpActorDump.txt. With no Sequence variable, or one that's 0, the file lists every actor,
+/// one per line. Otherwise it starts with "#diff from to" and lists only the slots filled ("+slot:line") and emptied
+/// ("-slot") since the sequence number in the variable, which is then set to the current one.
+/// </summary>
 void DumpActors(USequenceOp* const op)
 {
 	const auto numVarLinks = op->VariableLinks.Num();
-	const auto objCount = UObject::GObjObjects()->Count;
-	const auto objArray = UObject::GObjObjects()->Data;
+	USeqVar_Int* lengthVar = nullptr;
+	USeqVar_Int* sequenceVar = nullptr;
+	for (auto i = 0; i < numVarLinks; i++)
+	{
+		if (op->VariableLinks(i).LinkedVariables.Num() == 0)
+		{
+			continue;
+		}
+		const auto seqVar = op->VariableLinks(i).LinkedVariables(0);
+		if (!IsA<USeqVar_Int>(seqVar))
+		{
+			continue;
+		}
+		switch (DumpActorsLinks.Match(op->VariableLinks(i).LinkDesc))
+		{
+		case DUMPLINK_Length:
+			lengthVar = static_cast<USeqVar_Int*>(seqVar);
+			break;
+		case DUMPLINK_Sequence:
+			sequenceVar = static_cast<USeqVar_Int*>(seqVar);
+			break;
+		default:
+			break;
+		}
+	}
 
-	Actors.Count = 0; //clear the array without de-allocating any memory.
+	// Without the events the set can't follow the world, so every dump is a full one.
+	const auto since = sequenceVar && actorEventsHooked ? unsigned(sequenceVar->IntValue) : 0;
+	actorDumpText.clear();
+	const auto sequence = liveActors.Dump(since, actorDumpText);
 	ofstream ofs;
 	ofs.open(actorDumpFilePath);
-	const auto actorClass = AActor::StaticClass();
-	for (auto j = 0; j < objCount; j++)
+	ofs.write(actorDumpText.data(), actorDumpText.size());
+	ofs.close();
+
+	if (lengthVar)
+	{
+		lengthVar->IntValue = liveActors.GetSlotCount();
+	}
+	if (sequenceVar)
 	{
-		auto obj = objArray[j];
-		if (obj && obj->IsA(actorClass))
+		sequenceVar->IntValue = int(sequence);
+	}
+	accessedList = ACTORLIST_Dump;
+}
+
+enum ESpatialQueryLink { QUERYLINK_Center, QUERYLINK_Radius, QUERYLINK_Min, QUERYLINK_Max, QUERYLINK_Class, QUERYLINK_Length, QUERYLINK_OutputObject };
+static constexpr FStringSwitch<7> SpatialQueryLinks = { { L"Center", L"Radius", L"Min", L"Max", L"Class", L"Length", L"Output Object" } };
+
+struct SpatialQuery
+{
+	FVector Center = {};
+	FVector Min = {};
+	FVector Max = {};
+	float Radius = 1e38f;
+	UClass* Type = nullptr;
+	bool UnknownType = false;
+	USeqVar_Int* LengthVar = nullptr;
+	USeqVar_Object* OutputVar = nullptr;
+};
+
+SpatialQuery ReadSpatialQuery(USequenceOp* const op)
+{
+	SpatialQuery query;
+	const auto numVarLinks = op->VariableLinks.Num();
+	for (auto i = 0; i < numVarLinks; i++)
+	{
+		if (op->VariableLinks(i).LinkedVariables.Num() == 0)
 		{
-			auto actor = static_cast<AActor*>(obj);
-			const auto name = actor->Name.GetName();
-			if (strstr(name, "Default_"))// || actor->bStatic || !actor->bMovable)
+			continue;
+		}
+		const auto seqVar = op->VariableLinks(i).LinkedVariables(0);
+		const auto linkType = SpatialQueryLinks.Match(op->VariableLinks(i).LinkDesc);
+		switch (linkType)
+		{
+		case QUERYLINK_Center:
+		case QUERYLINK_Min:
+		case QUERYLINK_Max:
+			if (IsA<USeqVar_Vector>(seqVar))
 			{
-				continue;
+				auto& point = linkType == QUERYLINK_Center ? query.Center : linkType == QUERYLINK_Min ? query.Min : query.Max;
+				point = static_cast<USeqVar_Vector*>(seqVar)->VectValue;
 			}
-			Actors.Add(actor);
-			ofs << actor->GetContainingMapName() << ":" << name;
-			const auto index = actor->Name.GetIndex();
-			if (index > 0)
+			break;
+		case QUERYLINK_Radius:
+			if (IsA<USeqVar_Float>(seqVar))
+			{
+				query.Radius = static_cast<USeqVar_Float*>(seqVar)->FloatValue;
+			}
+			break;
+		case QUERYLINK_Class:
+			if (IsA<USeqVar_String>(seqVar))
 			{
-				ofs << '_' << index - 1;
+				const auto& name = static_cast<USeqVar_String*>(seqVar)->StrValue;
+				if (name.Count > 1)
+				{
+					query.Type = actorGrid.FindClass(name);
+					query.UnknownType = !query.Type;
+				}
 			}
-			if (actor->bStatic || !actor->bMovable)
+			break;
+		case QUERYLINK_Length:
+			if (IsA<USeqVar_Int>(seqVar))
 			{
-				ofs << ":static";
+				query.LengthVar = static_cast<USeqVar_Int*>(seqVar);
 			}
-			ofs << endl;
+			break;
+		case QUERYLINK_OutputObject:
+			if (IsA<USeqVar_Object>(seqVar))
+			{
+				query.OutputVar = static_cast<USeqVar_Object*>(seqVar);
+			}
+			break;
+		default:
+			break;
 		}
 	}
-	ofs.close();
-	
-	for (auto i = 0; i < numVarLinks; i++)
+	return query;
+}
+
+/// <summary>
+/// Makes queryResults the list SeqAct_ME3ExpAcessDumpedActorsList reads, and sets Length to its size and Output
+/// Object to its first actor.
+/// </summary>
+void WriteSpatialQueryResults(const SpatialQuery& query)
+{
+	accessedList = ACTORLIST_Query;
+	if (query.LengthVar)
+	{
+		query.LengthVar->IntValue = int(queryResults.size());
+	}
+	if (query.OutputVar)
 	{
+		query.OutputVar->ObjValue = queryResults.empty() ? nullptr : queryResults[0];
+	}
+}
 
-		if (op->VariableLinks(i).LinkedVariables.Num() == 0)
+vector<pair<float, AActor*>> actorsByDistance;
+
+/// <summary>
+/// Finds the actors within Radius of Center, nearest first, optionally only those of Class.
+/// </summary>
+void GetActorsInRadius(USequenceOp* const op)
+{
+	const auto query = ReadSpatialQuery(op);
+	queryResults.clear();
+	if (!query.UnknownType)
+	{
+		actorsByDistance.clear();
+		actorGrid.ForEachInRadius(query.Center, query.Radius, query.Type, [](AActor* actor, const float distanceSquared)
 		{
-			continue;
-		}
-		const auto seqVar = op->VariableLinks(i).LinkedVariables(0);
-		if (op->VariableLinks(i).LinkDesc == L"Length" && IsA<USeqVar_Int>(seqVar))
+			actorsByDistance.emplace_back(distanceSquared, actor);
+		});
+		sort(actorsByDistance.begin(), actorsByDistance.end());
+		for (const auto& found : actorsByDistance)
 		{
-			const auto lenVar = static_cast<USeqVar_Int*>(seqVar);
-			lenVar->IntValue = Actors.Count;
-			break;
+			queryResults.push_back(found.second);
 		}
 	}
+	WriteSpatialQueryResults(query);
 }
 
+/// <summary>
+/// Finds the actor nearest Center, optionally only of Class and within Radius.
+/// </summary>
+void GetNearestActor(USequenceOp* const op)
+{
+	const auto query = ReadSpatialQuery(op);
+	queryResults.clear();
+	const auto nearest = query.UnknownType ? nullptr : actorGrid.FindNearest(query.Center, query.Radius, query.Type);
+	if (nearest)
+	{
+		queryResults.push_back(nearest);
+	}
+	WriteSpatialQueryResults(query);
+}
+
+/// <summary>
+/// Finds the actors inside the box from Min to Max, optionally only those of Class.
+/// </summary>
+void GetActorsInBox(USequenceOp* const op)
+{
+	const auto query = ReadSpatialQuery(op);
+	queryResults.clear();
+	if (!query.UnknownType)
+	{
+		actorGrid.ForEachInBox(query.Min, query.Max, query.Type, [](AActor* actor)
+		{
+			queryResults.push_back(actor);
+		});
+	}
+	WriteSpatialQueryResults(query);
+}
+
+enum EDumpedActorsLink { ACTORSLINK_Index, ACTORSLINK_OutputObject };
+static constexpr FStringSwitch<2> DumpedActorsLinks = { { L"Index", L"Output Object" } };
+
 void AcessDumpedActorsList(USequenceOp* const op)
 {
 	const auto numVarLinks = op->VariableLinks.Num();
@@ -199,21 +436,22 @@ void AcessDumpedActorsList(USequenceOp* const op)
 			continue;
 		}
 		const auto seqVar = op->VariableLinks(i).LinkedVariables(0);
-		if (op->VariableLinks(i).LinkDesc == L"Index" && IsA<USeqVar_Int>(seqVar))
+		const auto linkType = DumpedActorsLinks.Match(op->VariableLinks(i).LinkDesc);
+		if (linkType == ACTORSLINK_Index && IsA<USeqVar_Int>(seqVar))
 		{
 			const auto idxVar = static_cast<USeqVar_Int*>(seqVar);
 			index = idxVar->IntValue;
 		}
-		if (op->VariableLinks(i).LinkDesc == L"Output Object" && IsA<USeqVar_Object>(seqVar))
+		if (linkType == ACTORSLINK_OutputObject && IsA<USeqVar_Object>(seqVar))
 		{
 			const auto outputVar = static_cast<USeqVar_Object*>(seqVar);
-			if (index >= 0 && index < Actors.Count)
+			if (accessedList == ACTORLIST_Query)
 			{
-				outputVar->ObjValue = Actors(index);
+				outputVar->ObjValue = index >= 0 && index < int(queryResults.size()) ? queryResults[index] : nullptr;
 			}
 			else
 			{
-				outputVar->ObjValue = nullptr;
+				outputVar->ObjValue = liveActors.GetActor(index);
 			}
 		}
 	}
@@ -224,9 +462,23 @@ float ToRadians(const int unrealRotationUnits)
 	return unrealRotationUnits * 360.0f / 65536.0f * 3.1415926535897931f / 180.0f;
 }
 
-FTPOV cachedPOV;
+// The controller PlayerTick last ran for, and its GObjObjects index. Its camera is read when something needs it,
+// not copied every tick.
+ABioPlayerController* playerController = nullptr;
+int playerControllerIndex = -1;
+enum ECamPOVLink { POVLINK_Position, POVLINK_Rotation };
+static constexpr FStringSwitch<2> CamPOVLinks = { { L"Position", L"Rotation" } };
+
 void GetCamPOV(USequenceOp* const op)
 {
+	// A map load may have destroyed the controller since its last tick; only use it while its slot still holds it.
+	const auto objects = UObject::GObjObjects();
+	if (!playerController || playerControllerIndex < 0 || playerControllerIndex >= objects->Count ||
+		objects->Data[playerControllerIndex] != playerController || !playerController->PlayerCamera)
+	{
+		return;
+	}
+	const auto& pov = playerController->PlayerCamera->CameraCache.POV;
 	const auto numVarLinks = op->VariableLinks.Num();
 	for (auto i = 0; i < numVarLinks; i++)
 	{
@@ -236,15 +488,16 @@ void GetCamPOV(USequenceOp* const op)
 			continue;
 		}
 		const auto seqVar = op->VariableLinks(i).LinkedVariables(0);
-		if (op->VariableLinks(i).LinkDesc == L"Position" && IsA<USeqVar_Vector>(seqVar))
+		const auto linkType = CamPOVLinks.Match(op->VariableLinks(i).LinkDesc);
+		if (linkType == POVLINK_Position && IsA<USeqVar_Vector>(seqVar))
 		{
 			const auto posVar = static_cast<USeqVar_Vector*>(seqVar);
-			posVar->VectValue = cachedPOV.location;
+			posVar->VectValue = pov.location;
 		}
-		else if (op->VariableLinks(i).LinkDesc == L"Rotation" && IsA<USeqVar_Vector>(seqVar))
+		else if (linkType == POVLINK_Rotation && IsA<USeqVar_Vector>(seqVar))
 		{
-			const auto pitch = ToRadians(cachedPOV.Rotation.Pitch);
-			const auto yaw = ToRadians(cachedPOV.Rotation.Yaw);
+			const auto pitch = ToRadians(pov.Rotation.Pitch);
+			const auto yaw = ToRadians(pov.Rotation.Yaw);
 			const auto cp = cos(pitch);
 			const auto sp = sin(pitch);
 			const auto cy = cos(yaw);
@@ -260,55 +513,120 @@ void GetCamPOV(USequenceOp* const op)
 	}
 }
 
-void __fastcall HookedPE(UObject *pObject, void *edx, UFunction *pFunction, void *pParms, void *pResult)
+bool OnSendMessageToME3ExplorerActivated(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult)
 {
-	const auto className = pObject->Class->GetName();
-	if (strcmp(className, "SeqAct_SendMessageToME3Explorer") == 0)
-	{
-		const auto funcName = pFunction->GetFullName();
-		if (isPartOf(funcName, "Function Engine.SequenceOp.Activated")) {
-			const auto op = static_cast<USequenceOp*>(pObject);
-			SendMessageToMe3Explorer(op);
-		}
-	}
-	else if(strcmp(className, "SeqAct_ME3ExpDumpActors") == 0)
+	SendMessageToMe3Explorer(static_cast<USequenceOp*>(pObject));
+	return true;
+}
+
+bool OnDumpActorsActivated(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult)
+{
+	DumpActors(static_cast<USequenceOp*>(pObject));
+	return true;
+}
+
+bool OnAcessDumpedActorsListActivated(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult)
+{
+	AcessDumpedActorsList(static_cast<USequenceOp*>(pObject));
+	return true;
+}
+
+bool OnGetPlayerCamPOVActivated(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult)
+{
+	GetCamPOV(static_cast<USequenceOp*>(pObject));
+	return true;
+}
+
+bool OnGetActorsInRadiusActivated(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult)
+{
+	GetActorsInRadius(static_cast<USequenceOp*>(pObject));
+	return true;
+}
+
+bool OnGetNearestActorActivated(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult)
+{
+	GetNearestActor(static_cast<USequenceOp*>(pObject));
+	return true;
+}
+
+bool OnGetActorsInBoxActivated(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult)
+{
+	GetActorsInBox(static_cast<USequenceOp*>(pObject));
+	return true;
+}
+
+bool OnActorEvent(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult)
+{
+	// This sees every ProcessEvent call, so anything but the two events goes no further than a name compare.
+	const auto name = pFunction->Name.NameEntry;
+	if ((name != postBeginPlayName && name != destroyedName) || (!liveActors.IsSynced() && !actorGrid.IsSynced()) ||
+		!pObject->IsA(AActor::StaticClass()))
 	{
-		const auto funcName = pFunction->GetFullName();
-		if (isPartOf(funcName, "Function Engine.SequenceOp.Activated")) {
-			const auto op = static_cast<USequenceOp*>(pObject);
-			DumpActors(op);
-		}
+		return true;
 	}
-	else if (strcmp(className, "SeqAct_ME3ExpAcessDumpedActorsList") == 0)
+	const auto actor = static_cast<AActor*>(pObject);
+	if (name == postBeginPlayName)
 	{
-		const auto funcName = pFunction->GetFullName();
-		if (isPartOf(funcName, "Function Engine.SequenceOp.Activated")) {
-			const auto op = static_cast<USequenceOp*>(pObject);
-			AcessDumpedActorsList(op);
-		}
+		liveActors.Added(actor);
+		actorGrid.Added(actor);
 	}
-	else if (strcmp(className, "SeqAct_ME3ExpGetPlayerCamPOV") == 0)
+	else
 	{
-		const auto funcName = pFunction->GetFullName();
-		if (isPartOf(funcName, "Function Engine.SequenceOp.Activated")) {
-			const auto op = static_cast<USequenceOp*>(pObject);
-			GetCamPOV(op);
-		}
+		liveActors.Removed(actor);
+		actorGrid.Removed(actor);
 	}
-	else if (IsA<ABioPlayerController>(pObject) && isPartOf(pFunction->GetFullName(), "Function SFXGame.BioPlayerController.PlayerTick"))
+	return true;
+}
+
+bool OnPlayerTick(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult)
+{
+	playerController = static_cast<ABioPlayerController*>(pObject);
+	playerControllerIndex = playerController->ObjectInternalInteger;
+	if (cameraChannel.IsDue() && playerController->PlayerCamera)
 	{
-		const auto playerController = static_cast<ABioPlayerController*>(pObject);
-		cachedPOV = playerController->PlayerCamera->CameraCache.POV;
+		const auto& cameraPOV = playerController->PlayerCamera->CameraCache.POV;
+		CameraStreamPOV pov;
+		pov.Location[0] = cameraPOV.location.X;
+		pov.Location[1] = cameraPOV.location.Y;
+		pov.Location[2] = cameraPOV.location.Z;
+		pov.Pitch = cameraPOV.Rotation.Pitch;
+		pov.Yaw = cameraPOV.Rotation.Yaw;
+		pov.Roll = cameraPOV.Rotation.Roll;
+		pov.FOV = cameraPOV.FOV;
+		cameraChannel.Publish(pov);
 	}
-	ProcessEvent(pObject, pFunction, pParms, pResult);
+	actorGrid.Tick();
+	return true;
 }
 
 void onAttach()
 {
-	DetourTransactionBegin();
-	DetourUpdateThread(GetCurrentThread()); //This command set the current working thread to the game current thread.
-	DetourAttach(&(PVOID&)ProcessEvent, HookedPE); //This command will start your Hook.
-	DetourTransactionCommit();
+	SdkBindings::ResolveAll();
+	interopChannel.Open();
+	cameraChannel.Open();
+	const auto activated = "Function Engine.SequenceOp.Activated";
+	SubscribeProcessEvent(activated, OnSendMessageToME3ExplorerActivated, nullptr, nullptr, "SeqAct_SendMessageToME3Explorer");
+	SubscribeProcessEvent(activated, OnDumpActorsActivated, nullptr, nullptr, "SeqAct_ME3ExpDumpActors");
+	SubscribeProcessEvent(activated, OnAcessDumpedActorsListActivated, nullptr, nullptr, "SeqAct_ME3ExpAcessDumpedActorsList");
+	SubscribeProcessEvent(activated, OnGetPlayerCamPOVActivated, nullptr, nullptr, "SeqAct_ME3ExpGetPlayerCamPOV");
+	SubscribeProcessEvent(activated, OnGetActorsInRadiusActivated, nullptr, nullptr, "SeqAct_ME3ExpGetActorsInRadius");
+	SubscribeProcessEvent(activated, OnGetNearestActorActivated, nullptr, nullptr, "SeqAct_ME3ExpGetNearestActor");
+	SubscribeProcessEvent(activated, OnGetActorsInBoxActivated, nullptr, nullptr, "SeqAct_ME3ExpGetActorsInBox");
+	SubscribeProcessEvent("Function SFXGame.BioPlayerController.PlayerTick", OnPlayerTick, nullptr, &ABioPlayerController::StaticClass);
+
+	// Subclasses override PostBeginPlay and Destroyed, and each override is its own function, so the events are
+	// matched by name on every call rather than subscribed to one function.
+	const char* actorEvents[] = { "Function Engine.Actor.PostBeginPlay", "Function Engine.Actor.Destroyed" };
+	UObject* actorEventFunctions[2];
+	ObjectIndex::Get().FindByPaths(actorEvents, actorEventFunctions, 2);
+	if (actorEventFunctions[0] && actorEventFunctions[1])
+	{
+		postBeginPlayName = actorEventFunctions[0]->Name.NameEntry;
+		destroyedName = actorEventFunctions[1]->Name.NameEntry;
+		SubscribeProcessEvent(nullptr, OnActorEvent);
+		actorEventsHooked = true;
+		actorGrid.FollowEvents();
+	}
 }
 
 BOOL WINAPI DllMain(HMODULE hModule, DWORD dwReason, LPVOID lpReserved)
@@ -0,0 +1,352 @@
+#pragma once
+
+#include <windows.h>
+#include <stdio.h>
+#include <atomic>
+#include <string>
+#include <utility>
+
+// Where a log record goes.
+#define LOGTARGET_DISK 1
+#define LOGTARGET_CONSOLE 2
+#define LOGTARGET_TIMESTAMP 4
+
+/// <summary>
+/// What to do with a record when the ring is full.
+/// Drop discards it silently, Block waits for the writer thread to make room, Count discards it and reports how
+/// many were lost in the log once there is room again.
+/// </summary>
+enum class LogOverflow
+{
+	Drop,
+	Block,
+	Count
+};
+
+/// <summary>
+/// Moves log output off the calling thread. Callers push records into a bounded lock-free ring; a writer thread
+/// drains it in batches, formats timestamps, and writes the file and console with one call each per batch. The
+/// file is flushed at most every FlushIntervalMs, or right after flush() asks for it.
+/// </summary>
+class AsyncLogWriter
+{
+public:
+	// How long written data may sit in the CRT buffer before it's flushed to disk.
+	static const DWORD FlushIntervalMs = 500;
+	// How long Shutdown waits for a live writer thread to write out what's queued.
+	static const DWORD ShutdownTimeoutMs = 500;
+
+	AsyncLogWriter(FILE* file, const ULONGLONG bootTime, const LogOverflow overflow, const size_t capacity = 8192)
+		: File(file), BootTime(bootTime), Overflow(overflow)
+	{
+		// Round up to a power of two so positions can be masked.
+		size_t size = 2;
+		while (size < capacity)
+		{
+			size <<= 1;
+		}
+		Mask = size - 1;
+		Cells = new Cell[size];
+		for (size_t i = 0; i < size; i++)
+		{
+			Cells[i].Sequence.store(i, std::memory_order_relaxed);
+		}
+		WakeEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+		// The thread won't start running until the loader lock is released if this is constructed in DllMain.
+		Thread = CreateThread(nullptr, 0, ThreadProc, this, 0, nullptr);
+	}
+
+	/// <summary>
+	/// Queues text for the writer thread. Never blocks unless the overflow policy is Block.
+	/// </summary>
+	/// <param name="text"></param>
+	/// <param name="targets">LOGTARGET_ flags</param>
+	void Push(std::string&& text, const int targets)
+	{
+		Record record;
+		record.Ticks = GetTickCount64();
+		record.Targets = targets;
+		record.Text = std::move(text);
+		if (Stopping)
+		{
+			// Nothing reads the ring once Shutdown has started.
+			Dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		while (!TryPush(record))
+		{
+			if (Overflow != LogOverflow::Block || Stopping)
+			{
+				Dropped.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+			Wake();
+			Sleep(0);
+		}
+		// Pairs with the fence in WriterLoop: the publish above must be visible before WriterSleeping is read,
+		// or both sides can miss each other and the record sits in the ring until the next push.
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (WriterSleeping.load(std::memory_order_relaxed))
+		{
+			Wake();
+		}
+	}
+
+	/// <summary>
+	/// Asks the writer thread to flush the file once everything queued so far is written. Doesn't wait.
+	/// </summary>
+	void RequestFlush()
+	{
+		FlushRequested.store(true, std::memory_order_release);
+		Wake();
+	}
+
+	/// <summary>
+	/// Number of records lost to a full ring so far.
+	/// </summary>
+	/// <returns></returns>
+	unsigned long long GetDroppedCount() const
+	{
+		return Dropped.load(std::memory_order_relaxed);
+	}
+
+	/// <summary>
+	/// Stops the writer thread once it has written out everything queued, and flushes the file. Call from
+	/// DLL_PROCESS_DETACH. When the process is exiting the writer thread has already been terminated, and what it left
+	/// queued is written out on the calling thread instead. A writer thread that's still running but doesn't finish
+	/// within ShutdownTimeoutMs keeps the ring, so it's never read from two threads at once.
+	/// </summary>
+	void Shutdown()
+	{
+		if (!Thread)
+		{
+			return;
+		}
+		Stopping = true;
+		Wake();
+		auto done = false;
+		for (DWORD waited = 0; waited < ShutdownTimeoutMs; waited++)
+		{
+			if (Finished.load(std::memory_order_acquire))
+			{
+				done = true;
+				break;
+			}
+			if (WaitForSingleObject(Thread, 1) == WAIT_OBJECT_0)
+			{
+				// Terminated before it finished, so nothing else reads the ring now.
+				Drain();
+				fflush(File);
+				fflush(stdout);
+				done = true;
+				break;
+			}
+		}
+		CloseHandle(Thread);
+		Thread = nullptr;
+		if (done)
+		{
+			// A thread that didn't finish may still wait on the event, so it's only closed once the thread is done.
+			CloseHandle(WakeEvent);
+			WakeEvent = nullptr;
+		}
+	}
+
+private:
+	struct Record
+	{
+		ULONGLONG Ticks = 0;
+		int Targets = 0;
+		std::string Text;
+	};
+
+	struct Cell
+	{
+		std::atomic<size_t> Sequence;
+		Record Value;
+	};
+
+	FILE* File;
+	ULONGLONG BootTime;
+	LogOverflow Overflow;
+	Cell* Cells;
+	size_t Mask;
+	HANDLE WakeEvent;
+	HANDLE Thread;
+
+	alignas(64) std::atomic<size_t> EnqueuePos{ 0 };
+	alignas(64) size_t DequeuePos = 0;
+	std::atomic<unsigned long long> Dropped{ 0 };
+	unsigned long long DroppedReported = 0;
+	std::atomic<bool> WriterSleeping{ false };
+	std::atomic<bool> FlushRequested{ false };
+	std::atomic<bool> Stopping{ false };
+	// Set by the writer thread once it has written out what was queued when it was told to stop.
+	std::atomic<bool> Finished{ false };
+
+	// Batches are built here so each drain is one fwrite per target.
+	std::string DiskBatch;
+	std::string ConsoleBatch;
+
+	void Wake()
+	{
+		if (WakeEvent)
+		{
+			SetEvent(WakeEvent);
+		}
+	}
+
+	/// <summary>
+	/// Bounded MPSC enqueue: claims a cell by advancing EnqueuePos, then publishes it through the cell's sequence.
+	/// </summary>
+	bool TryPush(Record& record)
+	{
+		auto pos = EnqueuePos.load(std::memory_order_relaxed);
+		Cell* cell;
+		while (true)
+		{
+			cell = &Cells[pos & Mask];
+			const auto sequence = cell->Sequence.load(std::memory_order_acquire);
+			const auto diff = intptr_t(sequence) - intptr_t(pos);
+			if (diff == 0)
+			{
+				if (EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				pos = EnqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+		cell->Value = std::move(record);
+		cell->Sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool TryPop(Record& record)
+	{
+		auto cell = &Cells[DequeuePos & Mask];
+		const auto sequence = cell->Sequence.load(std::memory_order_acquire);
+		if (intptr_t(sequence) - intptr_t(DequeuePos + 1) < 0)
+		{
+			return false;
+		}
+		record = std::move(cell->Value);
+		cell->Sequence.store(DequeuePos + Mask + 1, std::memory_order_release);
+		DequeuePos++;
+		return true;
+	}
+
+	void AppendTimestamp(std::string& out, const ULONGLONG ticks) const
+	{
+		char timestamp[32];
+		const auto sinceBoot = ticks - BootTime;
+		sprintf_s(timestamp, "[%llu.%d] ", sinceBoot / 1000, int(sinceBoot % 1000));
+		out += timestamp;
+	}
+
+	/// <summary>
+	/// Writes out everything queued. Returns true if anything was written. Single consumer: only the writer thread
+	/// calls it, or Shutdown once that thread is gone.
+	/// </summary>
+	bool Drain()
+	{
+		auto wroteAny = false;
+		Record record;
+		while (true)
+		{
+			auto batchSize = 0;
+			while (batchSize < 1024 && TryPop(record))
+			{
+				if (record.Targets & LOGTARGET_DISK)
+				{
+					if (record.Targets & LOGTARGET_TIMESTAMP)
+					{
+						AppendTimestamp(DiskBatch, record.Ticks);
+					}
+					DiskBatch += record.Text;
+				}
+				if (record.Targets & LOGTARGET_CONSOLE)
+				{
+					if (record.Targets & LOGTARGET_TIMESTAMP)
+					{
+						AppendTimestamp(ConsoleBatch, record.Ticks);
+					}
+					ConsoleBatch += record.Text;
+				}
+				batchSize++;
+			}
+
+			const auto dropped = Dropped.load(std::memory_order_relaxed);
+			if (Overflow == LogOverflow::Count && dropped != DroppedReported)
+			{
+				char note[96];
+				sprintf_s(note, "[Logger] %llu messages dropped because the log queue was full\n", dropped - DroppedReported);
+				DiskBatch += note;
+				DroppedReported = dropped;
+			}
+
+			if (DiskBatch.empty() && ConsoleBatch.empty())
+			{
+				return wroteAny;
+			}
+			if (!DiskBatch.empty())
+			{
+				fwrite(DiskBatch.data(), 1, DiskBatch.size(), File);
+				DiskBatch.clear();
+			}
+			if (!ConsoleBatch.empty())
+			{
+				fwrite(ConsoleBatch.data(), 1, ConsoleBatch.size(), stdout);
+				ConsoleBatch.clear();
+			}
+			wroteAny = true;
+		}
+	}
+
+	static DWORD WINAPI ThreadProc(LPVOID parameter)
+	{
+		static_cast<AsyncLogWriter*>(parameter)->Run();
+		return 0;
+	}
+
+	void Run()
+	{
+		auto dirty = false;
+		auto lastFlush = GetTickCount64();
+		while (!Stopping)
+		{
+			dirty |= Drain();
+			const auto now = GetTickCount64();
+			const auto flushRequested = FlushRequested.exchange(false, std::memory_order_acq_rel);
+			if (dirty && (flushRequested || now - lastFlush >= FlushIntervalMs))
+			{
+				fflush(File);
+				fflush(stdout);
+				dirty = false;
+				lastFlush = now;
+			}
+
+			// Producers only signal while this is set; recheck after setting it so a push can't be missed.
+			WriterSleeping.store(true, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const auto pending = Cells[DequeuePos & Mask].Sequence.load(std::memory_order_acquire) == DequeuePos + 1;
+			if (!pending && !FlushRequested.load(std::memory_order_acquire))
+			{
+				WaitForSingleObject(WakeEvent, dirty ? FlushIntervalMs : INFINITE);
+			}
+			WriterSleeping.store(false, std::memory_order_relaxed);
+		}
+		Drain();
+		fflush(File);
+		fflush(stdout);
+		Finished.store(true, std::memory_order_release);
+	}
+};
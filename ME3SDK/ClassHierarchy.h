@@ -0,0 +1,213 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+/// <summary>
+/// Answers "is this class derived from that one" without walking SuperField. Each class gets a display: its depth
+/// in the hierarchy and the list of its ancestors from the root down, so B derives from A exactly when
+/// display(B).Ancestors[depth(A)] == A.
+/// Displays are built the first time a class is asked about, which also covers classes loaded later from DLC
+/// packages, and are looked up by the class's GObjObjects index. Lookups take no lock; only building one does.
+/// </summary>
+class ClassHierarchy
+{
+	struct Display;
+
+public:
+	// Classes deeper than this fall back to walking SuperField.
+	static const int MaxDepth = 32;
+
+	/// <summary>
+	/// Remembers the display of a type that is checked against over and over, like the per-type one in IsA&lt;T&gt;,
+	/// so a check only looks up the candidate class's display.
+	/// </summary>
+	class TypeCache
+	{
+		friend class ClassHierarchy;
+		std::atomic<Display*> Cached{ nullptr };
+	};
+
+	static bool IsChildOf(UClass* cls, UClass* type)
+	{
+		if (cls == type)
+		{
+			return cls != nullptr;
+		}
+		if (!cls || !type)
+		{
+			return false;
+		}
+		auto& hierarchy = Get();
+		return hierarchy.Test(cls, type, hierarchy.Find(type));
+	}
+
+	static bool IsChildOf(UClass* cls, UClass* type, TypeCache& typeCache)
+	{
+		if (cls == type)
+		{
+			return cls != nullptr;
+		}
+		if (!cls || !type)
+		{
+			return false;
+		}
+		auto& hierarchy = Get();
+		auto typeDisplay = typeCache.Cached.load(std::memory_order_acquire);
+		if (!typeDisplay || typeDisplay->Class != type || typeDisplay->Replaced.load(std::memory_order_relaxed))
+		{
+			typeDisplay = hierarchy.Find(type);
+			typeCache.Cached.store(typeDisplay, std::memory_order_release);
+		}
+		return hierarchy.Test(cls, type, typeDisplay);
+	}
+
+private:
+	struct Display
+	{
+		UClass* Class;
+		// Number of ancestors, or -1 if the class is too deep to have a display.
+		int Depth;
+		// Set once another class took over this display's slot, so a TypeCache holding it looks it up again.
+		std::atomic<bool> Replaced;
+		// Root first, ending with the class itself.
+		UClass* Ancestors[MaxDepth];
+	};
+
+	// Displays by GObjObjects index. Replaced by a bigger copy when a class with a higher index shows up; the old
+	// table is never freed, since another thread may still be reading it.
+	struct Table
+	{
+		int Size;
+		std::atomic<Display*>* Slots;
+	};
+
+	std::atomic<Table*> Current{ nullptr };
+	std::mutex BuildLock;
+
+	static ClassHierarchy& Get()
+	{
+		static ClassHierarchy hierarchy;
+		return hierarchy;
+	}
+
+	static bool Walk(UClass* cls, UClass* type)
+	{
+		for (auto super = cls; super; super = static_cast<UClass*>(super->SuperField))
+		{
+			if (super == type)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool Test(UClass* cls, UClass* type, const Display* typeDisplay)
+	{
+		const auto display = Find(cls);
+		if (display->Depth < 0 || typeDisplay->Depth < 0)
+		{
+			return Walk(cls, type);
+		}
+		const auto depth = typeDisplay->Depth;
+		return depth <= display->Depth && display->Ancestors[depth] == type;
+	}
+
+	Display* Find(UClass* cls)
+	{
+		const auto index = cls->ObjectInternalInteger;
+		const auto table = Current.load(std::memory_order_acquire);
+		if (table && index >= 0 && index < table->Size)
+		{
+			const auto display = table->Slots[index].load(std::memory_order_acquire);
+			if (display && display->Class == cls)
+			{
+				return display;
+			}
+		}
+		return Build(cls);
+	}
+
+	Display* Build(UClass* cls)
+	{
+		const auto index = cls->ObjectInternalInteger;
+		if (index < 0)
+		{
+			// Not in the object table, so there's nowhere to keep a display. Shouldn't happen for a live class.
+			static Display unindexed = {};
+			unindexed.Depth = -1;
+			return &unindexed;
+		}
+
+		std::lock_guard<std::mutex> lock(BuildLock);
+		auto table = Current.load(std::memory_order_relaxed);
+		if (table && index < table->Size)
+		{
+			// Another thread may have built it while this one waited.
+			const auto built = table->Slots[index].load(std::memory_order_relaxed);
+			if (built && built->Class == cls)
+			{
+				return built;
+			}
+		}
+
+		auto display = new Display();
+		display->Class = cls;
+		auto depth = 0;
+		for (auto super = cls; super; super = static_cast<UClass*>(super->SuperField))
+		{
+			depth++;
+		}
+		if (depth > MaxDepth)
+		{
+			display->Depth = -1;
+		}
+		else
+		{
+			display->Depth = depth - 1;
+			auto super = cls;
+			for (auto i = depth - 1; i >= 0; i--)
+			{
+				display->Ancestors[i] = super;
+				super = static_cast<UClass*>(super->SuperField);
+			}
+		}
+
+		if (!table || index >= table->Size)
+		{
+			table = Grow(table, index);
+		}
+		// A display this replaces may still be in use by a reader, so it's left allocated. That only happens when a
+		// class is unloaded and its slot reused.
+		const auto replaced = table->Slots[index].load(std::memory_order_relaxed);
+		if (replaced)
+		{
+			replaced->Replaced.store(true, std::memory_order_relaxed);
+		}
+		table->Slots[index].store(display, std::memory_order_release);
+		return display;
+	}
+
+	Table* Grow(Table* table, const int index)
+	{
+		auto size = table ? table->Size : 4096;
+		const auto objMax = UObject::GObjObjects()->Max;
+		if (size < objMax)
+		{
+			size = objMax;
+		}
+		while (size <= index)
+		{
+			size *= 2;
+		}
+		const auto grown = new Table{ size, new std::atomic<Display*>[size] };
+		for (auto i = 0; i < size; i++)
+		{
+			grown->Slots[i].store(table && i < table->Size ? table->Slots[i].load(std::memory_order_relaxed) : nullptr,
+				std::memory_order_relaxed);
+		}
+		Current.store(grown, std::memory_order_release);
+		return grown;
+	}
+};
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <stdint.h>
+#include <wchar.h>
+
+/// <summary>
+/// FNV-1a over the characters of a wide string. constexpr, so views of literals are hashed by the compiler.
+/// </summary>
+constexpr uint32_t HashWideString(const wchar_t* text, const int length)
+{
+	uint32_t hash = 2166136261u;
+	for (auto i = 0; i < length; i++)
+	{
+		hash = (hash ^ uint32_t(text[i])) * 16777619u;
+	}
+	return hash;
+}
+
+/// <summary>
+/// A non-owning view of a wide string with its length and hash worked out once, so comparing it against other views
+/// checks two integers before it looks at any characters. Views of literals are built at compile time; a view of an
+/// FString, such as a link's LinkDesc, costs one pass over the string. Only valid while the viewed text is unchanged.
+/// </summary>
+class FStringView
+{
+public:
+	constexpr FStringView() : Data(L""), Length(0), Hash(HashWideString(L"", 0)) {}
+
+	/// <summary>
+	/// A view of a string literal. Its length comes from the array, so don't pass a buffer holding a shorter string.
+	/// </summary>
+	template< int N >
+	constexpr FStringView(const wchar_t (&literal)[N]) : Data(literal), Length(N - 1), Hash(HashWideString(literal, N - 1)) {}
+
+	constexpr FStringView(const wchar_t* data, const int length) : Data(data), Length(length), Hash(HashWideString(data, length)) {}
+
+	/// <summary>
+	/// A view of an FString. Its Count includes the terminating null, when it has any characters at all.
+	/// </summary>
+	explicit FStringView(const FString& string)
+		: Data(string.Count > 0 ? string.Data : L""), Length(string.Count > 0 ? string.Count - 1 : 0), Hash(HashWideString(Data, Length)) {}
+
+	constexpr const wchar_t* GetData() const
+	{
+		return Data;
+	}
+
+	constexpr int Len() const
+	{
+		return Length;
+	}
+
+	constexpr uint32_t GetHash() const
+	{
+		return Hash;
+	}
+
+	bool operator == (const FStringView& other) const
+	{
+		return Length == other.Length && Hash == other.Hash && wmemcmp(Data, other.Data, size_t(Length)) == 0;
+	}
+
+	bool operator != (const FStringView& other) const
+	{
+		return !(*this == other);
+	}
+
+private:
+	const wchar_t* Data;
+	int Length;
+	uint32_t Hash;
+};
+
+/// <summary>
+/// Matches a string against a fixed set of literals and returns the index of the one it equals, for use in a
+/// switch instead of a chain of string compares. An FString's length is known without reading it, so cases are
+/// told apart by length first and only the ones of the same length compare characters. The candidate is never
+/// hashed: for a handful of short cases that costs more than the compares it would save.
+/// </summary>
+/// <example>
+/// enum ELinkDesc { LINK_Position, LINK_Rotation };
+/// static constexpr FStringSwitch&lt;2&gt; LinkDescs = { { L"Position", L"Rotation" } };
+/// switch (LinkDescs.Match(link.LinkDesc)) { case LINK_Position: ... }
+/// </example>
+template< int N > struct FStringSwitch
+{
+	FStringView Cases[N];
+
+	/// <summary>
+	/// Returns the index of the case equal to text, or -1.
+	/// </summary>
+	int Match(const FStringView& text) const
+	{
+		for (auto i = 0; i < N; i++)
+		{
+			if (Cases[i] == text)
+			{
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	int Match(const FString& text) const
+	{
+		const auto data = text.Count > 0 ? text.Data : L"";
+		const auto length = text.Count > 0 ? text.Count - 1 : 0;
+		for (auto i = 0; i < N; i++)
+		{
+			if (Cases[i].Len() == length && wmemcmp(Cases[i].GetData(), data, size_t(length)) == 0)
+			{
+				return i;
+			}
+		}
+		return -1;
+	}
+};
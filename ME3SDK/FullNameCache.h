@@ -0,0 +1,117 @@
+#pragma once
+
+#include <string.h>
+#include <string>
+#include <vector>
+#include "Packages/Core.h"
+
+/// <summary>
+/// Remembers each object's GetFullName() text by GObjObjects index, so logging the same objects over and over
+/// costs a copy instead of rebuilding the name. An entry is rebuilt when the object in its slot, its class, its
+/// name, its outer or anything else the full name is made of has changed since it was cached.
+/// Not thread safe: give each thread that logs names its own cache.
+/// </summary>
+class FullNameCache
+{
+public:
+	/// <summary>
+	/// Gets the full name of object. The reference is valid until the next call for an object in the same slot.
+	/// </summary>
+	/// <param name="object"></param>
+	/// <returns></returns>
+	const std::string& Get(UObject* object)
+	{
+		if (!object || object->ObjectInternalInteger < 0)
+		{
+			Build(object, Scratch.FullName);
+			return Scratch.FullName;
+		}
+
+		const auto index = unsigned(object->ObjectInternalInteger);
+		if (index >= Entries.size())
+		{
+			const auto objMax = UObject::GObjObjects()->Max;
+			Entries.resize(index < unsigned(objMax) ? objMax : index + 1024);
+		}
+		auto& entry = Entries[index];
+		if (!entry.Matches(object))
+		{
+			entry.Capture(object);
+			Build(object, entry.FullName);
+		}
+		return entry.FullName;
+	}
+
+	/// <summary>
+	/// Appends the full name of object to out.
+	/// </summary>
+	/// <param name="object"></param>
+	/// <param name="out"></param>
+	void Append(UObject* object, std::string& out)
+	{
+		out += Get(object);
+	}
+
+	/// <summary>
+	/// Copies the full name of object into buffer, truncating to fit, and returns the length written.
+	/// </summary>
+	size_t Copy(UObject* object, char* buffer, const size_t bufferSize)
+	{
+		return AppendToNameBuffer(buffer, bufferSize, 0, Get(object).c_str());
+	}
+
+private:
+	// Everything GetFullName() reads, to tell when a cached name has gone stale.
+	struct Entry
+	{
+		UObject* Object = nullptr;
+		UClass* Class = nullptr;
+		FNameEntry* Name = nullptr;
+		FNameEntry* ClassName = nullptr;
+		UObject* Outer = nullptr;
+		FNameEntry* OuterName = nullptr;
+		UObject* OuterOuter = nullptr;
+		FNameEntry* OuterOuterName = nullptr;
+		std::string FullName;
+
+		bool Matches(UObject* object) const
+		{
+			if (Object != object || Class != object->Class || Name != object->Name.NameEntry || Outer != object->Outer)
+			{
+				return false;
+			}
+			if (Class && Class->Name.NameEntry != ClassName)
+			{
+				return false;
+			}
+			if (Outer && (Outer->Name.NameEntry != OuterName || Outer->Outer != OuterOuter))
+			{
+				return false;
+			}
+			return !OuterOuter || OuterOuter->Name.NameEntry == OuterOuterName;
+		}
+
+		void Capture(UObject* object)
+		{
+			Object = object;
+			Class = object->Class;
+			Name = object->Name.NameEntry;
+			ClassName = Class ? Class->Name.NameEntry : nullptr;
+			Outer = object->Outer;
+			OuterName = Outer ? Outer->Name.NameEntry : nullptr;
+			OuterOuter = Outer ? Outer->Outer : nullptr;
+			OuterOuterName = OuterOuter ? OuterOuter->Name.NameEntry : nullptr;
+		}
+	};
+
+	std::vector<Entry> Entries;
+	// Holds the name of objects that aren't in the table.
+	Entry Scratch;
+
+	static void Build(UObject* object, std::string& out)
+	{
+		char buffer[256];
+		const auto length = object ? object->GetFullName(buffer, sizeof(buffer)) : AppendToNameBuffer(buffer, sizeof(buffer), 0, "(null)");
+		out.assign(buffer, length);
+	}
+};
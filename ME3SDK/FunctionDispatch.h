@@ -0,0 +1,126 @@
+#pragma once
+
+#include <string.h>
+#include <string>
+#include <vector>
+#include "Packages/Core.h"
+
+/// <summary>
+/// Resolves the full names of the functions a ProcessEvent hook is interested in to small integer ids.
+/// A UFunction's full name is only built the first time that function passes through the hook; after that
+/// the result is cached in a flat array indexed by the function's object index, so classifying a call
+/// costs one bounds check and one pointer compare.
+/// </summary>
+class FunctionDispatchTable
+{
+public:
+	static const int NotWatched = -1;
+
+	/// <summary>
+	/// Adds a function to the watch list and returns the id that Lookup will report for it.
+	/// Registering the same name twice returns the same id.
+	/// </summary>
+	/// <param name="functionFullName">Full name as returned by GetFullName(), e.g. "Function Engine.SequenceOp.Activated"</param>
+	/// <returns></returns>
+	int Register(const char* functionFullName)
+	{
+		for (size_t i = 0; i < Names.size(); i++)
+		{
+			if (Names[i] == functionFullName)
+			{
+				return int(i);
+			}
+		}
+		Names.emplace_back(functionFullName);
+		Resolved.push_back(nullptr);
+
+		// Functions seen so far were classified against the old watch list.
+		Cache.clear();
+		return int(Names.size() - 1);
+	}
+
+	/// <summary>
+	/// Returns the id of the watched function, or NotWatched.
+	/// </summary>
+	/// <param name="function"></param>
+	/// <returns></returns>
+	int Lookup(UFunction* function)
+	{
+		const auto index = unsigned(function->ObjectInternalInteger);
+		if (index < Cache.size())
+		{
+			const auto& entry = Cache[index];
+			if (entry.Function == function)
+			{
+				return entry.Id;
+			}
+		}
+		return Classify(function);
+	}
+
+	/// <summary>
+	/// Gets the UFunction a watched name was last resolved to, or NULL if it hasn't been called yet.
+	/// </summary>
+	/// <param name="id"></param>
+	/// <returns></returns>
+	UFunction* GetResolved(const int id) const
+	{
+		return id >= 0 && id < int(Resolved.size()) ? Resolved[id] : nullptr;
+	}
+
+	const char* GetName(const int id) const
+	{
+		return id >= 0 && id < int(Names.size()) ? Names[id].c_str() : nullptr;
+	}
+
+	int Num() const
+	{
+		return int(Names.size());
+	}
+
+private:
+	struct Entry
+	{
+		UFunction* Function;
+		int Id;
+	};
+
+	std::vector<std::string> Names;
+	std::vector<UFunction*> Resolved;
+	std::vector<Entry> Cache;
+
+	/// <summary>
+	/// String fallback for functions that haven't been seen at their object index yet (first call, or
+	/// the slot was reused after the previous occupant was garbage collected).
+	/// </summary>
+	/// <param name="function"></param>
+	/// <returns></returns>
+	int Classify(UFunction* function)
+	{
+		const auto index = function->ObjectInternalInteger;
+		if (index < 0)
+		{
+			return NotWatched;
+		}
+		if (unsigned(index) >= Cache.size())
+		{
+			const auto objMax = UObject::GObjObjects()->Max;
+			Cache.resize(index < objMax ? objMax : index + 1024, Entry{ nullptr, NotWatched });
+		}
+
+		auto id = NotWatched;
+		char fullName[256];
+		function->GetFullName(fullName, sizeof(fullName));
+		for (size_t i = 0; i < Names.size(); i++)
+		{
+			if (!strcmp(fullName, Names[i].c_str()))
+			{
+				id = int(i);
+				Resolved[i] = function;
+				break;
+			}
+		}
+		Cache[index] = Entry{ function, id };
+		return id;
+	}
+};
@@ -1,3 +1,5 @@
+#pragma once
+
 #include <stdio.h>
 #include <io.h>
 #include <fcntl.h>     /* for _O_TEXT and _O_BINARY */  
@@ -10,107 +12,64 @@
 #include <vector>
 #include <locale> 
 #include <codecvt>
-#include "SdkHeaders.h"
+#include "Packages\Core.h"
+#include "SdkHelpers.h"
+#include "AsyncLogWriter.h"
+#include "MappedLogBuffer.h"
 using namespace std;
 
-typedef void(__thiscall *tProcessEvent)(class UObject *, class UFunction *, void *, void *);
-tProcessEvent ProcessEvent = (tProcessEvent)0x00453120;
-
 /// <summary>
-/// Gets objects in memory of a specific class type. Returns a TArray with objects that can be casted to that type.
+/// How ME3TweaksASILogger gets text to disk.
+/// Direct writes through the CRT on the calling thread.
+/// Async queues writes for a background thread; see AsyncLogWriter.
+/// Mapped writes into a memory-mapped ring file named after the log with a .ring suffix, which survives a crash
+/// without flushing. Only the last mappedCapacity bytes are kept. Read it with LogLinearizer.
 /// </summary>
-/// <param name="type"></param>
-/// <returns></returns>
-TArray<UObject*> FindObjectsOfType(UClass* type)
+enum class LogBackend
 {
-	TArray<UObject*> foundObjects;
-	const auto objCount = UObject::GObjObjects()->Count;
-	const auto objArray = UObject::GObjObjects()->Data;
-	for (auto j = 0; j < objCount; j++)
-	{
-		auto obj = objArray[j];
-		if (obj && obj->IsA(type))
-		{
-			const auto name = obj->Name.GetName();
-			if (strstr(name, "Default_"))// || actor->bStatic || !actor->bMovable)
-			{
-				continue;
-			}
-			foundObjects.Add(obj);
-		}
-	}
-	return foundObjects;
-}
-
-/// <summary>
-/// Gets the first object in memory of the specified type. Ensure you check for NULL.
-/// </summary>
-/// <param name="type"></param>
-/// <returns></returns>
-UObject* FindObjectOfType(UClass* type)
-{
-	const auto objCount = UObject::GObjObjects()->Count;
-	const auto objArray = UObject::GObjObjects()->Data;
-	for (auto j = 0; j < objCount; j++)
-	{
-		auto obj = objArray[j];
-		if (obj && obj->IsA(type))
-		{
-			const auto name = obj->Name.GetName();
-			if (strstr(name, "Default_"))// || actor->bStatic || !actor->bMovable)
-			{
-				continue;
-			}
-			return obj;
-		}
-	}
-	return NULL;
-}
-
-const std::string string_format(const char* const zcFormat, ...) {
-
-	// initialize use of the variable argument array
-	va_list vaArgs;
-	va_start(vaArgs, zcFormat);
-
-	// reliably acquire the size
-	// from a copy of the variable argument array
-	// and a functionally reliable call to mock the formatting
-	va_list vaArgsCopy;
-	va_copy(vaArgsCopy, vaArgs);
-	const int iLen = std::vsnprintf(NULL, 0, zcFormat, vaArgsCopy);
-	va_end(vaArgsCopy);
-
-	// return a formatted string without risking memory mismanagement
-	// and without assuming any compiler or platform specific behavior
-	std::vector<char> zc(iLen + 1);
-	std::vsnprintf(zc.data(), zc.size(), zcFormat, vaArgs);
-	va_end(vaArgs);
-	return std::string(zc.data(), iLen);
-}
-
-/// <summary>
-/// Converts a widestring (wstring) to wchar_t
-/// </summary>
-/// <param name="wstr"></param>
-/// <returns></returns>
-inline std::string ws2s(const std::wstring& wstr)
-{
-	using convert_typeX = std::codecvt_utf8<wchar_t>;
-	std::wstring_convert<convert_typeX, wchar_t> converterX;
-
-	return converterX.to_bytes(wstr);
-}
+	Direct,
+	Async,
+	Mapped
+};
 
 class ME3TweaksASILogger
 {
 public:
 	char* logfname;
 
-	ME3TweaksASILogger(char* loggername, char* _logfname, bool console = true) {
+	/// <summary>
+	/// Opens the log file and optionally a console window.
+	/// </summary>
+	/// <param name="loggername"></param>
+	/// <param name="_logfname"></param>
+	/// <param name="console">Allocate a console window to mirror the log to. The mirror is a synchronous write on the
+	/// calling thread, so loggers that want the Mapped backend's speed should pass false.</param>
+	/// <param name="backend">How text gets to disk. With Async, call shutdown() from DLL_PROCESS_DETACH.</param>
+	/// <param name="overflow">What the Async backend does when its queue is full</param>
+	/// <param name="mappedCapacity">Bytes of text the Mapped backend keeps</param>
+	ME3TweaksASILogger(char* loggername, char* _logfname, bool console = true, LogBackend backend = LogBackend::Direct,
+		LogOverflow overflow = LogOverflow::Count, unsigned long long mappedCapacity = 16 * 1024 * 1024) {
 		logfname = _logfname;
-		fopen_s(&log, logfname, "w");
+		boottime = GetTickCount64();
+		string diskfname = logfname;
+		if (backend == LogBackend::Mapped) {
+			diskfname += ".ring";
+			mappedLog = new MappedLogBuffer();
+			if (!mappedLog->Open(diskfname.c_str(), mappedCapacity)) {
+				// Fall back to a regular log rather than losing output.
+				delete mappedLog;
+				mappedLog = nullptr;
+				diskfname = logfname;
+			}
+		}
+		if (!mappedLog) {
+			fopen_s(&log, logfname, "w");
+		}
+		if (backend == LogBackend::Async && log) {
+			asyncWriter = new AsyncLogWriter(log, boottime, overflow);
+		}
 
+		hasConsole = console;
 		if (console)
 		{
 			AllocConsole();
@@ -131,10 +90,9 @@ public:
 			freopen_s(&CErrorHandle, "CONOUT$", "w", stderr);
 		}
 
-		boottime = GetTickCount64();
 		writeToLog("ME3Tweaks ASI Logger - By Mgamerz\n"s, false);
 		writeToLog(string(loggername) + "\n", false);
-		writeToLog(string_format("Logging to %s%s\n", workingdir().c_str(), _logfname), true);
+		writeToLog(string_format("Logging to %s%s\n", workingdir().c_str(), diskfname.c_str()), true);
 		writeToLog("--------------------------------------------------------\n", false);
 	}
 
@@ -153,6 +111,14 @@ public:
 	/// <param name="str"></param>
 	/// <param name="bTimeStamp"></param>
 	void writeToDiskOnly(string str, bool bTimeStamp) {
+		if (asyncWriter) {
+			asyncWriter->Push(std::move(str), LOGTARGET_DISK | (bTimeStamp ? LOGTARGET_TIMESTAMP : 0));
+			return;
+		}
+		if (mappedLog) {
+			writeToMappedLog(str, bTimeStamp);
+			return;
+		}
 		if (bTimeStamp) {
 			string timeStamp = getTimestampStr();
 			fprintf(log, timeStamp.c_str());
@@ -161,7 +127,7 @@ public:
 
 		fprintf(log, "%s", str.c_str());
 
-		if (numLinesWritten > 10) {
+		if (++numLinesWritten > 10) {
 			fflush(log);
 			numLinesWritten = 0;
 		}
@@ -182,6 +148,10 @@ public:
 	/// <param name="str"></param>
 	/// <param name="bTimeStamp"></param>
 	void writeToConsoleOnly(string str, bool bTimeStamp) {
+		if (asyncWriter) {
+			asyncWriter->Push(std::move(str), LOGTARGET_CONSOLE | (bTimeStamp ? LOGTARGET_TIMESTAMP : 0));
+			return;
+		}
 		if (bTimeStamp) {
 			string timeStamp = getTimestampStr();
 			std::cout << timeStamp;
@@ -206,6 +176,17 @@ public:
 	/// <param name="str"></param>
 	/// <param name="bTimeStamp"></param>
 	void writeToLog(string str, bool bTimeStamp) {
+		if (asyncWriter) {
+			asyncWriter->Push(std::move(str), LOGTARGET_DISK | LOGTARGET_CONSOLE | (bTimeStamp ? LOGTARGET_TIMESTAMP : 0));
+			return;
+		}
+		if (mappedLog) {
+			writeToMappedLog(str, bTimeStamp);
+			if (hasConsole) {
+				writeToConsoleOnly(str, bTimeStamp);
+			}
+			return;
+		}
 		if (bTimeStamp) {
 			string timeStamp = getTimestampStr();
 			std::cout << timeStamp;
@@ -218,24 +199,62 @@ public:
 		fprintf(log, "%s", str.c_str());
 		std::cout << str;
 
-		if (numLinesWritten > 10) {
+		if (++numLinesWritten > 10) {
 			fflush(log);
 			numLinesWritten = 0;
 		}
 	}
 
+	/// <summary>
+	/// Flushes the log file. In async mode this only asks the writer thread to flush and returns immediately, and
+	/// mapped mode needs no flushing to survive a crash.
+	/// </summary>
 	void flush() {
-		if (log) {
+		if (asyncWriter) {
+			asyncWriter->RequestFlush();
+		}
+		else if (log) {
 			fflush(log);
 			numLinesWritten = 0;
 		}
 	}
 
+	/// <summary>
+	/// Writes out everything still queued and flushes the file. Call from DLL_PROCESS_DETACH.
+	/// </summary>
+	void shutdown() {
+		if (asyncWriter) {
+			asyncWriter->Shutdown();
+		}
+		else {
+			flush();
+		}
+	}
+
+	/// <summary>
+	/// Number of messages async mode has lost to a full queue.
+	/// </summary>
+	/// <returns></returns>
+	unsigned long long droppedCount() const {
+		return asyncWriter ? asyncWriter->GetDroppedCount() : 0;
+	}
+
 private:
 	int numLinesWritten = 0;
-	FILE* log;
+	bool hasConsole = false;
+	FILE* log = nullptr;
+	AsyncLogWriter* asyncWriter = nullptr;
+	MappedLogBuffer* mappedLog = nullptr;
 	ULONGLONG boottime = 0;
 
+	void writeToMappedLog(const string& str, const bool bTimeStamp) {
+		if (bTimeStamp) {
+			const string timeStamp = getTimestampStr();
+			mappedLog->Write(timeStamp.data(), timeStamp.size());
+		}
+		mappedLog->Write(str.data(), str.size());
+	}
+
 	std::string workingdir()
 	{
 		char buf[256];
@@ -251,58 +270,13 @@ private:
 	}
 };
 
-
-/*Checks if w2 is part of w1*/
-bool isPartOf(char* w1, char* w2)
-{
-	int i = 0;
-	int j = 0;
-
-
-	while (w1[i] != '\0') {
-		if (w1[i] == w2[j])
-		{
-			int init = i;
-			while (w1[i] == w2[j] && w2[j] != '\0')
-			{
-				j++;
-				i++;
-			}
-			if (w2[j] == '\0') {
-				return true;
-			}
-			j = 0;
-		}
-		i++;
-	}
-	return false;
-}
-
-std::string wchar2string(wchar_t* str)
-{
-	std::string mystring;
-	while (*str)
-		mystring += (char)*str++;
-	return  mystring;
-}
-
-char GetBit(int value, int bit) {
-	return (value >> bit) & 1;
-}
-
-std::string GuidToString(FGuid guid)
+/// <summary>
+/// Resolves and verifies every SDK binding now instead of on first use, and notes how it went in the log.
+/// </summary>
+/// <param name="logger"></param>
+void ResolveSdkBindings(ME3TweaksASILogger& logger)
 {
-	char guid_cstr[39];
-	snprintf(guid_cstr, sizeof(guid_cstr),
-		"{%08x-%04x-%04x-%02x%02x-%02x%02x%02x%02x%02x%02x}",
-		guid.A, guid.B, guid.C,
-		GetBit(guid.D, 0), GetBit(guid.D, 1), GetBit(guid.D, 2), GetBit(guid.D, 3),
-		GetBit(guid.D, 4), GetBit(guid.D, 5), GetBit(guid.D, 6), GetBit(guid.D, 7));
-
-	return std::string(guid_cstr);
+	const auto result = SdkBindings::ResolveAll();
+	logger.writeToDiskOnly(string_format("Resolved %d SDK bindings in %.2f ms: %d verified, %d moved, %d not loaded yet\n",
+		result.Count, result.Milliseconds, result.Verified, result.Moved, result.Missing), true);
 }
-
-template<typename T>
-bool IsA(UObject* object) {
-	return object->IsA(T::StaticClass());
-}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <windows.h>
+#include <string.h>
+#include "MappedLogFormat.h"
+
+/// <summary>
+/// A log file mapped into memory and used as a ring buffer. Writes are plain memcpys into the mapped view, and
+/// the OS writes dirty pages back even if the game crashes, so the end of the log survives without any fflush.
+/// Safe to write from several threads at once. Linearize the file with LogLinearizer to read it.
+/// </summary>
+class MappedLogBuffer
+{
+public:
+	~MappedLogBuffer()
+	{
+		if (Header)
+		{
+			UnmapViewOfFile(Header);
+		}
+		if (Mapping)
+		{
+			CloseHandle(Mapping);
+		}
+		if (File != INVALID_HANDLE_VALUE)
+		{
+			CloseHandle(File);
+		}
+	}
+
+	/// <summary>
+	/// Creates the file at its full size and maps it. Returns false if that fails.
+	/// </summary>
+	/// <param name="fileName"></param>
+	/// <param name="capacity">Bytes of log text kept before the oldest is overwritten</param>
+	/// <returns></returns>
+	bool Open(const char* fileName, const unsigned long long capacity)
+	{
+		File = CreateFileA(fileName, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (File == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+		const auto size = MAPPEDLOG_DATA_OFFSET + capacity;
+		Mapping = CreateFileMappingA(File, nullptr, PAGE_READWRITE, DWORD(size >> 32), DWORD(size), nullptr);
+		if (!Mapping)
+		{
+			return false;
+		}
+		Header = static_cast<MappedLogHeader*>(MapViewOfFile(Mapping, FILE_MAP_ALL_ACCESS, 0, 0, SIZE_T(size)));
+		if (!Header)
+		{
+			return false;
+		}
+		Data = reinterpret_cast<char*>(Header) + MAPPEDLOG_DATA_OFFSET;
+		Capacity = capacity;
+		Header->Magic = MAPPEDLOG_MAGIC;
+		Header->Version = MAPPEDLOG_VERSION;
+		Header->Capacity = capacity;
+		Header->WriteCursor = 0;
+		return true;
+	}
+
+	bool IsOpen() const
+	{
+		return Header != nullptr;
+	}
+
+	void Write(const char* text, const size_t length)
+	{
+		if (!Header || !length)
+		{
+			return;
+		}
+		// Text longer than the whole ring only keeps its tail.
+		if (length > Capacity)
+		{
+			text += length - Capacity;
+		}
+		const auto count = length > Capacity ? size_t(Capacity) : length;
+
+		// Reserve the range first so concurrent writers never overlap, then copy into it.
+		const auto start = InterlockedExchangeAdd64(&Header->WriteCursor, LONGLONG(count));
+		const auto offset = size_t(unsigned long long(start) % Capacity);
+		const auto firstPart = count < Capacity - offset ? count : size_t(Capacity - offset);
+		memcpy(Data + offset, text, firstPart);
+		if (firstPart < count)
+		{
+			memcpy(Data, text + firstPart, count - firstPart);
+		}
+	}
+
+	/// <summary>
+	/// Asks the OS to write the mapped pages to disk now. Only needed to survive a power loss, not a crash.
+	/// </summary>
+	void Flush()
+	{
+		if (Header)
+		{
+			FlushViewOfFile(Header, 0);
+		}
+	}
+
+private:
+	HANDLE File = INVALID_HANDLE_VALUE;
+	HANDLE Mapping = nullptr;
+	MappedLogHeader* Header = nullptr;
+	char* Data = nullptr;
+	unsigned long long Capacity = 0;
+};
@@ -0,0 +1,27 @@
+#pragma once
+
+// Layout of the circular log files ME3TweaksASILogger writes in LogBackend::Mapped mode. Shared with
+// LogLinearizer, so this header must stay free of Windows and SDK dependencies.
+//
+// The file is a MappedLogHeader padded to MAPPEDLOG_DATA_OFFSET, followed by Capacity bytes of log text used as a
+// ring. WriteCursor counts every byte ever written, so the text starts at WriteCursor % Capacity once the ring
+// has wrapped, and at 0 before that.
+
+#include <stdint.h>
+
+#define MAPPEDLOG_MAGIC 0x474F4C4D // "MLOG"
+#define MAPPEDLOG_VERSION 1
+#define MAPPEDLOG_DATA_OFFSET 4096
+
+#pragma pack(push, 1)
+
+struct MappedLogHeader
+{
+	uint32_t Magic;
+	uint32_t Version;
+	uint64_t Capacity;
+	// Advanced before each write is copied in, so the bytes just below it may be incomplete after a crash.
+	volatile int64_t WriteCursor;
+};
+
+#pragma pack(pop)
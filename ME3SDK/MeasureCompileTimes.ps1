@@ -0,0 +1,50 @@
+# Times a Release rebuild of every plugin against ME3SDK.lib and against the header-only SDK, so changes to the SDK
+# layout can be checked for what they do to build times. Run from a Developer PowerShell, or anywhere vswhere can
+# find Visual Studio:
+#
+#   powershell -ExecutionPolicy Bypass -File ME3SDK\MeasureCompileTimes.ps1 [-Plugins KismetLogger,Wonderland]
+
+param(
+	[string[]]$Plugins = @(),
+	[string]$Configuration = "Release"
+)
+
+$ErrorActionPreference = "Stop"
+$root = Split-Path -Parent $PSScriptRoot
+
+$msbuild = (Get-Command msbuild.exe -ErrorAction SilentlyContinue).Source
+if (-not $msbuild) {
+	$vswhere = Join-Path ${env:ProgramFiles(x86)} "Microsoft Visual Studio\Installer\vswhere.exe"
+	$msbuild = & $vswhere -latest -requires Microsoft.Component.MSBuild -find "MSBuild\**\Bin\MSBuild.exe" | Select-Object -First 1
+}
+if (-not $msbuild) {
+	throw "MSBuild not found"
+}
+
+function Measure-Build([string]$project, [string[]]$extra) {
+	$arguments = @($project, "/t:Rebuild", "/p:Configuration=$Configuration", "/p:Platform=Win32", "/m", "/nologo", "/v:minimal") + $extra
+	$elapsed = Measure-Command { & $msbuild @arguments | Out-Null }
+	if ($LASTEXITCODE -ne 0) {
+		return "failed"
+	}
+	return "{0:N1} s" -f $elapsed.TotalSeconds
+}
+
+$sdk = Join-Path $PSScriptRoot "ME3SDK.vcxproj"
+Write-Host ("ME3SDK.lib: {0}" -f (Measure-Build $sdk @()))
+
+$projects = Get-ChildItem $root -Directory | ForEach-Object { Get-ChildItem $_.FullName -Filter *.vcxproj } |
+	Where-Object { (Get-Content $_.FullName -Raw) -match "ME3SDK\.props" }
+if ($Plugins.Count) {
+	$projects = $projects | Where-Object { $Plugins -contains $_.BaseName }
+}
+
+# The library is already built, so /p:BuildProjectReferences=false times the plugin alone.
+$results = foreach ($project in $projects) {
+	[pscustomobject]@{
+		Plugin = $project.BaseName
+		Library = Measure-Build $project.FullName @("/p:BuildProjectReferences=false")
+		HeaderOnly = Measure-Build $project.FullName @("/p:ME3SDKHeaderOnly=true")
+	}
+}
+$results | Format-Table -AutoSize
@@ -0,0 +1,556 @@
+#pragma once
+
+#include <ctype.h>
+#include <string.h>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// <summary>
+/// Groups the objects in GObjObjects by exact class, with class default objects kept apart, so "all objects of
+/// type T" visits only the classes derived from T and their objects instead of the whole table. Objects are also
+/// grouped by name and by (outer, name), so a full path like "Class Package.Group.Name" resolves by following
+/// outers through the index instead of building and comparing a full name for every object.
+/// The index follows GObjObjects incrementally. Queries first index the slots added since the last seen Count, then,
+/// at most every RefreshIntervalMs, re-check the next SweepBudget of the older slots for ones that were emptied,
+/// reused or renamed, so a pass over the whole table is spread across many queries. Every candidate is checked
+/// against its slot before it's returned, so removed objects are never handed out; an object loaded into a reused
+/// slot may be missed until the sweep reaches it, except by FindByPath, which re-checks every slot on a miss at most
+/// every RefreshIntervalMs.
+/// </summary>
+class ObjectIndex
+{
+public:
+	static const ULONGLONG RefreshIntervalMs = 100;
+	// Older slots re-checked per sweep. At 150,000 objects a pass over the table takes about a second.
+	static const int SweepBudget = 16384;
+
+	static ObjectIndex& Get()
+	{
+		static ObjectIndex index;
+		return index;
+	}
+
+	/// <summary>
+	/// Calls callback(UObject*) for every non-default object that IsA type, until it returns false.
+	/// The callback must not query the index.
+	/// </summary>
+	template<typename TCallback>
+	void ForEach(UClass* type, TCallback callback)
+	{
+		std::lock_guard<std::mutex> lock(Lock);
+		RefreshIfStale();
+		Visit(GetBuckets(type, false), callback);
+	}
+
+	/// <summary>
+	/// Calls callback(UObject*) for every default object ("Default__" name) that IsA type, until it returns false.
+	/// The callback must not query the index.
+	/// </summary>
+	template<typename TCallback>
+	void ForEachDefault(UClass* type, TCallback callback)
+	{
+		std::lock_guard<std::mutex> lock(Lock);
+		RefreshIfStale();
+		Visit(GetBuckets(type, true), callback);
+	}
+
+	/// <summary>
+	/// Finds the object whose GetFullName() equals fullName, ignoring case, e.g. "Function SFXGame.BioHUD.PostRender".
+	/// Like GetFullName, names don't include their instance number, and only the object's outer and the outer's
+	/// outer are part of the path. When several objects match, the one earliest in GObjObjects wins.
+	/// </summary>
+	/// <param name="fullName"></param>
+	/// <param name="type">Only objects that IsA this class, or nullptr for any</param>
+	/// <returns>The object, or nullptr</returns>
+	UObject* FindByPath(const char* fullName, UClass* type = nullptr)
+	{
+		std::lock_guard<std::mutex> lock(Lock);
+		RefreshIfStale();
+		const auto found = Resolve(fullName, type);
+		if (found || !RefreshAfterMiss())
+		{
+			return found;
+		}
+		return Resolve(fullName, type);
+	}
+
+	/// <summary>
+	/// FindByPath for many paths with one refresh and one lock, for resolving everything a plugin needs at startup.
+	/// </summary>
+	/// <param name="fullNames"></param>
+	/// <param name="results">Receives the object for each path, or nullptr</param>
+	/// <param name="count"></param>
+	/// <param name="type">Only objects that IsA this class, or nullptr for any</param>
+	void FindByPaths(const char* const* fullNames, UObject** results, const int count, UClass* type = nullptr)
+	{
+		std::lock_guard<std::mutex> lock(Lock);
+		RefreshIfStale();
+		auto missed = false;
+		for (auto i = 0; i < count; i++)
+		{
+			results[i] = Resolve(fullNames[i], type);
+			missed |= !results[i];
+		}
+		if (missed && RefreshAfterMiss())
+		{
+			for (auto i = 0; i < count; i++)
+			{
+				if (!results[i])
+				{
+					results[i] = Resolve(fullNames[i], type);
+				}
+			}
+		}
+	}
+
+	/// <summary>
+	/// Brings the index up to date with GObjObjects now by re-checking every slot.
+	/// </summary>
+	void Refresh()
+	{
+		std::lock_guard<std::mutex> lock(Lock);
+		RefreshNow();
+	}
+
+	/// <summary>
+	/// What every query does first: indexes the slots added since the last seen Count, and sweeps the next
+	/// SweepBudget older slots if RefreshIntervalMs has passed since the last sweep.
+	/// </summary>
+	void Update()
+	{
+		std::lock_guard<std::mutex> lock(Lock);
+		RefreshIfStale();
+	}
+
+private:
+	// Longest path FindByPath accepts; GetFullName's own buffer is this size.
+	static const size_t MaxPathLength = 256;
+
+	struct Bucket
+	{
+		std::vector<int> Slots;
+	};
+
+	// Where a slot sits in one of its buckets.
+	struct Membership
+	{
+		Bucket* Owner = nullptr;
+		int Position = -1;
+	};
+
+	struct Slot
+	{
+		UObject* Object = nullptr;
+		UClass* Class = nullptr;
+		UObject* Outer = nullptr;
+		FNameEntry* Name = nullptr;
+		Membership ByClass;
+		Membership ByName;
+		Membership ByOuter;
+	};
+
+	struct OuterName
+	{
+		UObject* Outer;
+		FNameEntry* Name;
+
+		bool operator==(const OuterName& other) const
+		{
+			return Outer == other.Outer && Name == other.Name;
+		}
+	};
+
+	struct OuterNameHash
+	{
+		size_t operator()(const OuterName& key) const
+		{
+			return std::hash<void*>()(key.Outer) * 31 + std::hash<void*>()(key.Name);
+		}
+	};
+
+	std::mutex Lock;
+	std::vector<Slot> Slots;
+	// unordered_map never moves its values, so Bucket pointers stay valid as entries are added.
+	std::unordered_map<UClass*, Bucket> Instances;
+	std::unordered_map<UClass*, Bucket> Defaults;
+	std::unordered_map<FNameEntry*, Bucket> Named;
+	std::unordered_map<OuterName, Bucket, OuterNameHash> Children;
+	// Lowercased name text to name entry, for every name an object has had. Names are case insensitive and never
+	// freed by the engine, so there's one entry per text and entries are never removed.
+	std::unordered_map<std::string, FNameEntry*> NameEntries;
+	// Per queried type, the buckets of every class derived from it. Cleared when a class gets its first object.
+	std::unordered_map<UClass*, std::vector<Bucket*>> DerivedInstances;
+	std::unordered_map<UClass*, std::vector<Bucket*>> DerivedDefaults;
+	int LastCount = 0;
+	// Where the next sweep starts.
+	int SweepCursor = 0;
+	ULONGLONG LastSweep = 0;
+	ULONGLONG LastFullRefresh = 0;
+	bool Refreshed = false;
+
+	const std::vector<Bucket*>& GetBuckets(UClass* type, const bool defaults)
+	{
+		auto& cache = defaults ? DerivedDefaults : DerivedInstances;
+		const auto found = cache.find(type);
+		if (found != cache.end())
+		{
+			return found->second;
+		}
+		auto& buckets = cache[type];
+		for (auto& entry : defaults ? Defaults : Instances)
+		{
+			if (ClassHierarchy::IsChildOf(entry.first, type))
+			{
+				buckets.push_back(&entry.second);
+			}
+		}
+		return buckets;
+	}
+
+	/// <summary>
+	/// True if the slot still holds what it was indexed with.
+	/// </summary>
+	bool IsCurrent(const int index) const
+	{
+		const auto objects = UObject::GObjObjects();
+		const auto& slot = Slots[index];
+		return index < objects->Count && objects->Data[index] == slot.Object && slot.Object->Class == slot.Class
+			&& slot.Object->Outer == slot.Outer && slot.Object->Name.NameEntry == slot.Name;
+	}
+
+	template<typename TCallback>
+	void Visit(const std::vector<Bucket*>& buckets, TCallback& callback)
+	{
+		for (const auto bucket : buckets)
+		{
+			for (const auto index : bucket->Slots)
+			{
+				// Skip anything that changed since the last refresh.
+				if (!IsCurrent(index))
+				{
+					continue;
+				}
+				if (!callback(Slots[index].Object))
+				{
+					return;
+				}
+			}
+		}
+	}
+
+	FNameEntry* FindNameEntry(const char* text, const size_t length) const
+	{
+		std::string key(text, length);
+		for (auto& c : key)
+		{
+			c = char(tolower(static_cast<unsigned char>(c)));
+		}
+		const auto found = NameEntries.find(key);
+		return found != NameEntries.end() ? found->second : nullptr;
+	}
+
+	const Bucket* FindChildren(UObject* outer, FNameEntry* name) const
+	{
+		const auto found = Children.find(OuterName{ outer, name });
+		return found != Children.end() ? &found->second : nullptr;
+	}
+
+	/// <summary>
+	/// Splits "Class A.B.C" into name entries and follows them down the outer chain. Keeps the lowest matching slot.
+	/// </summary>
+	UObject* Resolve(const char* fullName, UClass* type)
+	{
+		if (!fullName || strnlen(fullName, MaxPathLength) >= MaxPathLength)
+		{
+			return nullptr;
+		}
+		const auto space = strchr(fullName, ' ');
+		if (!space)
+		{
+			return nullptr;
+		}
+		const auto className = FindNameEntry(fullName, space - fullName);
+		if (!className)
+		{
+			return nullptr;
+		}
+
+		// GetFullName prints two or three components: [Outer's outer.]Outer.Name
+		FNameEntry* parts[3];
+		auto partCount = 0;
+		auto start = space + 1;
+		while (true)
+		{
+			const auto dot = strchr(start, '.');
+			const auto end = dot ? dot : start + strlen(start);
+			if (partCount == 3 || end == start)
+			{
+				return nullptr;
+			}
+			parts[partCount] = FindNameEntry(start, end - start);
+			if (!parts[partCount++])
+			{
+				return nullptr;
+			}
+			if (!dot)
+			{
+				break;
+			}
+			start = dot + 1;
+		}
+		if (partCount < 2)
+		{
+			return nullptr;
+		}
+
+		auto best = -1;
+		const auto consider = [&](const Bucket* bucket)
+		{
+			for (const auto index : bucket->Slots)
+			{
+				const auto& slot = Slots[index];
+				if ((best >= 0 && index >= best) || !IsCurrent(index) || !slot.Class
+					|| slot.Class->Name.NameEntry != className
+					|| (type && !ClassHierarchy::IsChildOf(slot.Class, type)))
+				{
+					continue;
+				}
+				best = index;
+			}
+		};
+
+		if (partCount == 2)
+		{
+			// The outer is a top level object, so it's found under a null outer.
+			const auto outers = FindChildren(nullptr, parts[0]);
+			if (!outers)
+			{
+				return nullptr;
+			}
+			for (const auto outerIndex : outers->Slots)
+			{
+				if (!IsCurrent(outerIndex))
+				{
+					continue;
+				}
+				const auto objects = FindChildren(Slots[outerIndex].Object, parts[1]);
+				if (objects)
+				{
+					consider(objects);
+				}
+			}
+		}
+		else
+		{
+			// The outer's outer may itself have outers that the path doesn't mention.
+			const auto grandOuters = Named.find(parts[0]);
+			if (grandOuters == Named.end())
+			{
+				return nullptr;
+			}
+			for (const auto grandIndex : grandOuters->second.Slots)
+			{
+				if (!IsCurrent(grandIndex))
+				{
+					continue;
+				}
+				const auto outers = FindChildren(Slots[grandIndex].Object, parts[1]);
+				if (!outers)
+				{
+					continue;
+				}
+				for (const auto outerIndex : outers->Slots)
+				{
+					if (!IsCurrent(outerIndex))
+					{
+						continue;
+					}
+					const auto objects = FindChildren(Slots[outerIndex].Object, parts[2]);
+					if (objects)
+					{
+						consider(objects);
+					}
+				}
+			}
+		}
+		return best >= 0 ? Slots[best].Object : nullptr;
+	}
+
+	void RefreshIfStale()
+	{
+		const auto count = UObject::GObjObjects()->Count;
+		if (!Refreshed)
+		{
+			RefreshNow();
+			return;
+		}
+		if (count != LastCount)
+		{
+			Track(count);
+		}
+		const auto now = GetTickCount64();
+		if (now - LastSweep >= RefreshIntervalMs)
+		{
+			Sweep(SweepBudget);
+			LastSweep = now;
+		}
+	}
+
+	/// <summary>
+	/// After a query found nothing, re-checks every slot in case what it was after was loaded into a reused slot the
+	/// sweep hasn't reached. Returns false without refreshing if the last full refresh was too recent.
+	/// </summary>
+	bool RefreshAfterMiss()
+	{
+		if (GetTickCount64() - LastFullRefresh < RefreshIntervalMs)
+		{
+			return false;
+		}
+		RefreshNow();
+		return true;
+	}
+
+	void RefreshNow()
+	{
+		const auto count = UObject::GObjObjects()->Count;
+		Track(count);
+		Sweep(count);
+		Refreshed = true;
+		LastSweep = LastFullRefresh = GetTickCount64();
+	}
+
+	/// <summary>
+	/// Indexes the slots added since the last seen Count, or forgets the ones past the end if the table shrank.
+	/// </summary>
+	void Track(const int count)
+	{
+		const auto objects = UObject::GObjObjects();
+		if (Slots.size() < size_t(count))
+		{
+			Slots.resize(count);
+		}
+		for (auto i = LastCount; i < count; i++)
+		{
+			Check(i, objects->Data[i]);
+		}
+		for (auto i = size_t(count); i < Slots.size(); i++)
+		{
+			if (Slots[i].Object)
+			{
+				Remove(int(i));
+			}
+		}
+		LastCount = count;
+	}
+
+	/// <summary>
+	/// Re-checks up to budget slots below the last seen Count, carrying on from where the last sweep stopped.
+	/// </summary>
+	void Sweep(const int budget)
+	{
+		const auto objects = UObject::GObjObjects();
+		const auto count = budget < LastCount ? budget : LastCount;
+		for (auto checked = 0; checked < count; checked++)
+		{
+			if (SweepCursor >= LastCount)
+			{
+				SweepCursor = 0;
+			}
+			Check(SweepCursor, objects->Data[SweepCursor]);
+			SweepCursor++;
+		}
+	}
+
+	/// <summary>
+	/// Re-indexes a slot if it no longer holds what it was indexed with.
+	/// </summary>
+	void Check(const int index, UObject* object)
+	{
+		auto& slot = Slots[index];
+		if (slot.Object == object && (!object
+			|| (slot.Class == object->Class && slot.Outer == object->Outer && slot.Name == object->Name.NameEntry)))
+		{
+			return;
+		}
+		if (slot.Object)
+		{
+			Remove(index);
+		}
+		if (object && object->Class)
+		{
+			Insert(index, object);
+		}
+	}
+
+	void Join(const int index, Bucket& bucket, Membership Slot::* membership)
+	{
+		auto& member = Slots[index].*membership;
+		member.Owner = &bucket;
+		member.Position = int(bucket.Slots.size());
+		bucket.Slots.push_back(index);
+	}
+
+	void Leave(const int index, Membership Slot::* membership)
+	{
+		auto& member = Slots[index].*membership;
+		auto& bucketSlots = member.Owner->Slots;
+		const auto moved = bucketSlots.back();
+		bucketSlots[member.Position] = moved;
+		(Slots[moved].*membership).Position = member.Position;
+		bucketSlots.pop_back();
+		member = Membership();
+	}
+
+	void Insert(const int index, UObject* object)
+	{
+		auto& slot = Slots[index];
+		slot.Object = object;
+		slot.Class = object->Class;
+		slot.Outer = object->Outer;
+		slot.Name = object->Name.NameEntry;
+
+		const auto name = object->Name.GetName();
+		const auto isDefault = strstr(name, "Default_") != nullptr;
+		auto& classes = isDefault ? Defaults : Instances;
+		auto byClass = classes.find(object->Class);
+		if (byClass == classes.end())
+		{
+			byClass = classes.emplace(object->Class, Bucket()).first;
+			(isDefault ? DerivedDefaults : DerivedInstances).clear();
+		}
+		Join(index, byClass->second, &Slot::ByClass);
+
+		auto byName = Named.find(slot.Name);
+		if (byName == Named.end())
+		{
+			byName = Named.emplace(slot.Name, Bucket()).first;
+			std::string key(name);
+			for (auto& c : key)
+			{
+				c = char(tolower(static_cast<unsigned char>(c)));
+			}
+			NameEntries.emplace(key, slot.Name);
+		}
+		Join(index, byName->second, &Slot::ByName);
+		Join(index, Children[OuterName{ slot.Outer, slot.Name }], &Slot::ByOuter);
+	}
+
+	void Remove(const int index)
+	{
+		Leave(index, &Slot::ByClass);
+		Leave(index, &Slot::ByName);
+		Leave(index, &Slot::ByOuter);
+		Slots[index] = Slot();
+	}
+};
+
+// Defined here rather than with the other UObject functions so plugins built against the SDK library can use it.
+template< class T > T* UObject::FindObject ( char* ObjectFullName ) 
+{ 
+	while ( ! UObject::GObjObjects() ) 
+		Sleep ( 100 ); 
+
+	return (T*) ObjectIndex::Get().FindByPath ( ObjectFullName, T::StaticClass() ); 
+} 
@@ -0,0 +1,357 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/// <summary>
+/// A view of an array the plugin doesn't own, usually a TArray field or parameter the engine filled in. It never
+/// allocates or frees, and works with range-based for. It's only valid while the array it views is unchanged.
+/// Use TArrayView&lt;const T&gt; to view a const array.
+/// </summary>
+template< class T > class TArrayView
+{
+public:
+	typedef typename std::remove_const< T >::type ElementType;
+
+	TArrayView() : Data(nullptr), Count(0) {}
+
+	TArrayView(T* data, const int count) : Data(data), Count(count) {}
+
+	TArrayView(TArray< ElementType >& array) : Data(array.Data), Count(array.Count) {}
+
+	template< class U = T, typename std::enable_if< std::is_const< U >::value, int >::type = 0 >
+	TArrayView(const TArray< ElementType >& array) : Data(array.Data), Count(array.Count) {}
+
+	int Num() const
+	{
+		return Count;
+	}
+
+	bool Any() const
+	{
+		return Count > 0;
+	}
+
+	T& operator() (const int i) const
+	{
+		return Data[i];
+	}
+
+	T& operator[] (const int i) const
+	{
+		return Data[i];
+	}
+
+	T* begin() const
+	{
+		return Data;
+	}
+
+	T* end() const
+	{
+		return Data + Count;
+	}
+
+private:
+	T* Data;
+	int Count;
+};
+
+/// <summary>
+/// A plugin-owned array with TArray's layout. Unlike TArray it frees its buffer when it goes out of scope, can be
+/// moved and copied, and reserves ahead. Empty() keeps the buffer, so an array that lives across frames and is
+/// emptied and refilled each time stops allocating once it has grown to its working size.
+/// AsTArray() lets the engine read it, e.g. as a function parameter, but arrays the engine fills in or resizes must
+/// stay TArray: the engine allocates with its own allocator, this array with the CRT's.
+/// </summary>
+template< class T > struct TOwnedArray
+{
+public:
+	// Public and in TArray's order, so existing code that reads Data and Count directly keeps working.
+	T* Data;
+	int Count;
+	int Max;
+
+	TOwnedArray() : Data(nullptr), Count(0), Max(0) {}
+
+	explicit TOwnedArray(const int capacity) : TOwnedArray()
+	{
+		Reserve(capacity);
+	}
+
+	TOwnedArray(TArrayView< const T > items) : TOwnedArray()
+	{
+		Append(items);
+	}
+
+	TOwnedArray(const TOwnedArray& other) : TOwnedArray()
+	{
+		Append(other.Data, other.Count);
+	}
+
+	TOwnedArray(TOwnedArray&& other) noexcept : Data(other.Data), Count(other.Count), Max(other.Max)
+	{
+		other.Data = nullptr;
+		other.Count = other.Max = 0;
+	}
+
+	~TOwnedArray()
+	{
+		Free();
+	}
+
+	TOwnedArray& operator= (const TOwnedArray& other)
+	{
+		if (this != &other)
+		{
+			Empty();
+			Append(other.Data, other.Count);
+		}
+		return *this;
+	}
+
+	TOwnedArray& operator= (TOwnedArray&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Free();
+			Data = other.Data;
+			Count = other.Count;
+			Max = other.Max;
+			other.Data = nullptr;
+			other.Count = other.Max = 0;
+		}
+		return *this;
+	}
+
+	int Num() const
+	{
+		return Count;
+	}
+
+	bool Any() const
+	{
+		return Count > 0;
+	}
+
+	T& operator() (const int i)
+	{
+		return Data[i];
+	}
+
+	const T& operator() (const int i) const
+	{
+		return Data[i];
+	}
+
+	T& operator[] (const int i)
+	{
+		return Data[i];
+	}
+
+	const T& operator[] (const int i) const
+	{
+		return Data[i];
+	}
+
+	T* begin()
+	{
+		return Data;
+	}
+
+	T* end()
+	{
+		return Data + Count;
+	}
+
+	const T* begin() const
+	{
+		return Data;
+	}
+
+	const T* end() const
+	{
+		return Data + Count;
+	}
+
+	/// <summary>
+	/// Makes room for at least capacity items in total without changing Count.
+	/// </summary>
+	void Reserve(const int capacity)
+	{
+		if (capacity > Max)
+		{
+			Reallocate(capacity);
+		}
+	}
+
+	/// <summary>
+	/// Adds count items without initializing them and returns the first. Only for types that need no constructor.
+	/// </summary>
+	T* AddUninitialized(const int count)
+	{
+		static_assert(std::is_trivially_default_constructible< T >::value && std::is_trivially_destructible< T >::value,
+			"AddUninitialized needs a type without constructors or a destructor");
+		Grow(Count + count);
+		const auto first = Data + Count;
+		Count += count;
+		return first;
+	}
+
+	void Add(const T& item)
+	{
+		if (Count < Max)
+		{
+			new (Data + Count) T(item);
+		}
+		else
+		{
+			// item may be one of this array's own items, which growing would move.
+			T copy(item);
+			Grow(Count + 1);
+			new (Data + Count) T(std::move(copy));
+		}
+		Count++;
+	}
+
+	void Add(T&& item)
+	{
+		if (Count < Max)
+		{
+			new (Data + Count) T(std::move(item));
+		}
+		else
+		{
+			T moved(std::move(item));
+			Grow(Count + 1);
+			new (Data + Count) T(std::move(moved));
+		}
+		Count++;
+	}
+
+	/// <summary>
+	/// Copies count items onto the end, growing at most once.
+	/// </summary>
+	void Append(const T* items, const int count)
+	{
+		if (count <= 0)
+		{
+			return;
+		}
+		if (Count + count > Max)
+		{
+			// items may point into this array, which growing would move.
+			const auto inside = items >= Data && items < Data + Count;
+			const auto offset = items - Data;
+			Grow(Count + count);
+			if (inside)
+			{
+				items = Data + offset;
+			}
+		}
+		if (std::is_trivially_copyable< T >::value)
+		{
+			memcpy(static_cast<void*>(Data + Count), items, sizeof(T) * count);
+		}
+		else
+		{
+			for (auto i = 0; i < count; i++)
+			{
+				new (Data + Count + i) T(items[i]);
+			}
+		}
+		Count += count;
+	}
+
+	void Append(TArrayView< const T > items)
+	{
+		Append(items.begin(), items.Num());
+	}
+
+	/// <summary>
+	/// Removes every item but keeps the buffer for reuse.
+	/// </summary>
+	void Empty()
+	{
+		DestroyItems();
+		Count = 0;
+	}
+
+	/// <summary>
+	/// Removes every item and frees the buffer.
+	/// </summary>
+	void Free()
+	{
+		DestroyItems();
+		free(Data);
+		Data = nullptr;
+		Count = Max = 0;
+	}
+
+	/// <summary>
+	/// This array as a TArray, for passing to the engine to read. The engine must not resize or free it.
+	/// </summary>
+	const TArray< T >& AsTArray() const
+	{
+		return *reinterpret_cast<const TArray< T >*>(this);
+	}
+
+	operator TArrayView< T >()
+	{
+		return TArrayView< T >(Data, Count);
+	}
+
+	operator TArrayView< const T >() const
+	{
+		return TArrayView< const T >(Data, Count);
+	}
+
+private:
+	void Grow(const int needed)
+	{
+		if (needed > Max)
+		{
+			Reallocate(needed > Max * 2 ? (needed > 16 ? needed : 16) : Max * 2);
+		}
+	}
+
+	void Reallocate(const int capacity)
+	{
+		if (std::is_trivially_copyable< T >::value)
+		{
+			Data = static_cast<T*>(realloc(static_cast<void*>(Data), sizeof(T) * capacity));
+		}
+		else
+		{
+			const auto moved = static_cast<T*>(malloc(sizeof(T) * capacity));
+			for (auto i = 0; i < Count; i++)
+			{
+				new (moved + i) T(std::move(Data[i]));
+				Data[i].~T();
+			}
+			free(Data);
+			Data = moved;
+		}
+		Max = capacity;
+	}
+
+	void DestroyItems()
+	{
+		if (!std::is_trivially_destructible< T >::value)
+		{
+			for (auto i = 0; i < Count; i++)
+			{
+				Data[i].~T();
+			}
+		}
+	}
+};
+
+static_assert(sizeof(TOwnedArray< void* >) == sizeof(TArray< void* >) &&
+	offsetof(TOwnedArray< void* >, Count) == offsetof(TArray< void* >, Count) &&
+	offsetof(TOwnedArray< void* >, Max) == offsetof(TArray< void* >, Max),
+	"TOwnedArray must keep TArray's layout");
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "../SdkBase.h"
+#include "../SDK_HEADERS/Core_structs.h"
+#include "../SDK_HEADERS/Core_classes.h"
+#include "../ClassHierarchy.h"
+#include "../ObjectIndex.h"
+#include "../SDK_HEADERS/Core_f_structs.h"
+
+// Function bodies. Plugins built with ME3SDK_LIBRARY link them from ME3SDK.lib instead.
+#ifndef ME3SDK_LIBRARY
+#include "../SDK_HEADERS/Core_functions.h"
+#include "../SdkBindingResolver.h"
+#endif
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "../SdkBase.h"
+#include "Core.h"
+#include "../SDK_HEADERS/Engine_structs.h"
+#include "../SDK_HEADERS/Engine_classes.h"
+#include "../SDK_HEADERS/Engine_f_structs.h"
+
+// Function bodies. Engine_functions.h isn't in the tree yet, so ME3SDK.lib doesn't build them: plugins compile them
+// inline even with ME3SDK_LIBRARY, and only the library's own sources leave them out.
+#ifndef ME3SDK_BUILDING_LIBRARY
+#include "../SDK_HEADERS/Engine_functions.h"
+#endif
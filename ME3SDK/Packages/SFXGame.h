@@ -0,0 +1,16 @@
+#pragma once
+
+#include "../SdkBase.h"
+#include "GameFramework.h"
+#include "GFxUI.h"
+#include "WwiseAudio.h"
+#include "SFXOnlineFoundation.h"
+#include "../SDK_HEADERS/SFXGame_structs.h"
+#include "../SDK_HEADERS/SFXGame_classes.h"
+#include "../SDK_HEADERS/SFXGame_f_structs.h"
+
+// Function bodies. SFXGame_functions.h isn't in the tree yet, so ME3SDK.lib doesn't build them: plugins compile them
+// inline even with ME3SDK_LIBRARY, and only the library's own sources leave them out.
+#ifndef ME3SDK_BUILDING_LIBRARY
+#include "../SDK_HEADERS/SFXGame_functions.h"
+#endif
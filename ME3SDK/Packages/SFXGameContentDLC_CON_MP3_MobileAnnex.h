@@ -0,0 +1,12 @@
+#pragma once
+
+#include "../SdkBase.h"
+#include "sfxgamempcontentdlc_shared_mp.h"
+#include "../SDK_HEADERS/SFXGameContentDLC_CON_MP3_MobileAnnex_structs.h"
+#include "../SDK_HEADERS/SFXGameContentDLC_CON_MP3_MobileAnnex_classes.h"
+#include "../SDK_HEADERS/SFXGameContentDLC_CON_MP3_MobileAnnex_f_structs.h"
+
+// Function bodies. Plugins built with ME3SDK_LIBRARY link them from ME3SDK.lib instead.
+#ifndef ME3SDK_LIBRARY
+#include "../SDK_HEADERS/SFXGameContentDLC_CON_MP3_MobileAnnex_functions.h"
+#endif
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "../SdkBase.h"
+#include "SFXGame.h"
+#include "../SDK_HEADERS/sfxgamecontent_structs.h"
+#include "../SDK_HEADERS/sfxgamecontent_classes.h"
+#include "../SDK_HEADERS/sfxgamecontent_f_structs.h"
+
+// Function bodies. Plugins built with ME3SDK_LIBRARY link them from ME3SDK.lib instead.
+#ifndef ME3SDK_LIBRARY
+#include "../SDK_HEADERS/sfxgamecontent_functions.h"
+#endif
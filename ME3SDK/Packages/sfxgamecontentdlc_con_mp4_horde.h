@@ -0,0 +1,12 @@
+#pragma once
+
+#include "../SdkBase.h"
+#include "sfxgamempcontentdlc_shared_mp.h"
+#include "../SDK_HEADERS/sfxgamecontentdlc_con_mp4_horde_structs.h"
+#include "../SDK_HEADERS/sfxgamecontentdlc_con_mp4_horde_classes.h"
+#include "../SDK_HEADERS/sfxgamecontentdlc_con_mp4_horde_f_structs.h"
+
+// Function bodies. Plugins built with ME3SDK_LIBRARY link them from ME3SDK.lib instead.
+#ifndef ME3SDK_LIBRARY
+#include "../SDK_HEADERS/sfxgamecontentdlc_con_mp4_horde_functions.h"
+#endif
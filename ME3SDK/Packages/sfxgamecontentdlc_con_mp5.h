@@ -0,0 +1,12 @@
+#pragma once
+
+#include "../SdkBase.h"
+#include "sfxgamecontent.h"
+#include "../SDK_HEADERS/sfxgamecontentdlc_con_mp5_structs.h"
+#include "../SDK_HEADERS/sfxgamecontentdlc_con_mp5_classes.h"
+#include "../SDK_HEADERS/sfxgamecontentdlc_con_mp5_f_structs.h"
+
+// Function bodies. Plugins built with ME3SDK_LIBRARY link them from ME3SDK.lib instead.
+#ifndef ME3SDK_LIBRARY
+#include "../SDK_HEADERS/sfxgamecontentdlc_con_mp5_functions.h"
+#endif
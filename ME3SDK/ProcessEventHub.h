@@ -0,0 +1,334 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "Packages/Core.h"
+#include "FunctionDispatch.h"
+#ifndef ME3SDK_PORTABLE
+#include "../detours/detours.h"
+
+#pragma comment(lib, "detours.lib")
+#endif
+
+// Bump whenever ProcessEventSubscription or ProcessEventHubApi change layout. A plugin that finds a hub with a
+// different version installs its own private hub instead of talking to an incompatible one.
+#define PROCESSEVENTHUB_VERSION 2
+
+typedef bool(*tProcessEventPre)(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult);
+typedef void(*tProcessEventPost)(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult);
+
+/// <summary>
+/// Describes one ProcessEvent callback. Pre runs before the original function and can return false to skip it;
+/// Post runs afterwards. Subscriptions with a lower Priority run their Pre earlier and their Post later.
+/// </summary>
+struct ProcessEventSubscription
+{
+	// Full name as returned by GetFullName(), e.g. "Function Engine.SequenceOp.Activated". NULL receives every call.
+	const char* FunctionFullName;
+	// Optional. Only objects that IsA this class, e.g. &USFXConsole::StaticClass. Resolved on the first matching call.
+	UClass* (*ClassFilter)();
+	// Optional. Only objects whose class has exactly this name. Use for classes the SDK has no StaticClass for.
+	const char* ClassName;
+	tProcessEventPre Pre;
+	tProcessEventPost Post;
+	int Priority;
+};
+
+/// <summary>
+/// The function table published to every ASI in the process. All calls land in the module that owns the hub,
+/// so allocations never cross CRT boundaries.
+/// </summary>
+struct ProcessEventHubApi
+{
+	int Version;
+	int (*Subscribe)(const ProcessEventSubscription* subscription);
+	void (*Unsubscribe)(int handle);
+	// Calls the game's ProcessEvent without going through the hub, so no callback sees the call.
+	void (*CallOriginal)(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult);
+};
+
+/// <summary>
+/// Owns the merged subscriber table and dispatches calls through it. Subscribing rebuilds an immutable table and
+/// swaps it in, so the game thread reads it without locking.
+/// </summary>
+class ProcessEventHub
+{
+public:
+	typedef void(__thiscall* tOriginalProcessEvent)(UObject*, UFunction*, void*, void*);
+
+	tOriginalProcessEvent Original = nullptr;
+
+	int Subscribe(const ProcessEventSubscription& subscription)
+	{
+		std::lock_guard<std::mutex> lock(SubscriptionLock);
+		Subscriber subscriber;
+		subscriber.Handle = ++LastHandle;
+		subscriber.FunctionFullName = subscription.FunctionFullName ? subscription.FunctionFullName : "";
+		subscriber.ClassFilter = subscription.ClassFilter;
+		subscriber.ClassName = subscription.ClassName ? subscription.ClassName : "";
+		subscriber.Pre = subscription.Pre;
+		subscriber.Post = subscription.Post;
+		subscriber.Priority = subscription.Priority;
+		Subscriptions.push_back(subscriber);
+		Current.store(BuildTable(), std::memory_order_release);
+		return subscriber.Handle;
+	}
+
+	void Unsubscribe(const int handle)
+	{
+		std::lock_guard<std::mutex> lock(SubscriptionLock);
+		Subscriptions.erase(std::remove_if(Subscriptions.begin(), Subscriptions.end(),
+			[handle](const Subscriber& s) { return s.Handle == handle; }), Subscriptions.end());
+		Current.store(BuildTable(), std::memory_order_release);
+	}
+
+	/// <summary>
+	/// Runs the matching Pre callbacks in priority order, the original ProcessEvent unless a Pre vetoed it, and then
+	/// the Post callbacks of every subscriber whose Pre ran, in reverse order.
+	/// </summary>
+	void Dispatch(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult)
+	{
+		const auto table = Current.load(std::memory_order_acquire);
+		if (!table)
+		{
+			Original(pObject, pFunction, pParms, pResult);
+			return;
+		}
+
+		const auto id = table->Functions.Lookup(pFunction);
+		auto& subscribers = id == FunctionDispatchTable::NotWatched ? table->Wildcard : table->ByFunction[id];
+		if (subscribers.empty())
+		{
+			Original(pObject, pFunction, pParms, pResult);
+			return;
+		}
+
+		const auto first = subscribers.data();
+		const auto last = first + subscribers.size();
+		auto callOriginal = true;
+		auto it = first;
+		while (it != last)
+		{
+			const auto subscriber = it++;
+			if (subscriber->Pre && Matches(*subscriber, pObject) && !subscriber->Pre(pObject, pFunction, pParms, pResult))
+			{
+				callOriginal = false;
+				break;
+			}
+		}
+
+		if (callOriginal)
+		{
+			Original(pObject, pFunction, pParms, pResult);
+		}
+
+		while (it != first)
+		{
+			const auto subscriber = --it;
+			if (subscriber->Post && Matches(*subscriber, pObject))
+			{
+				subscriber->Post(pObject, pFunction, pParms, pResult);
+			}
+		}
+	}
+
+private:
+	struct Subscriber
+	{
+		int Handle;
+		std::string FunctionFullName;
+		UClass* (*ClassFilter)();
+		std::string ClassName;
+		tProcessEventPre Pre;
+		tProcessEventPost Post;
+		int Priority;
+
+		// Lazily resolved on the game thread; every table has its own copy.
+		UClass* ResolvedClass = nullptr;
+		FNameEntry* ResolvedClassName = nullptr;
+	};
+
+	struct Table
+	{
+		FunctionDispatchTable Functions;
+		std::vector<Subscriber> Wildcard;
+		std::vector<std::vector<Subscriber>> ByFunction;
+	};
+
+	std::mutex SubscriptionLock;
+	std::vector<Subscriber> Subscriptions;
+	std::atomic<Table*> Current{ nullptr };
+	int LastHandle = 0;
+
+	static bool Matches(Subscriber& subscriber, UObject* pObject)
+	{
+		if (subscriber.ClassFilter)
+		{
+			if (!subscriber.ResolvedClass)
+			{
+				subscriber.ResolvedClass = subscriber.ClassFilter();
+			}
+			if (!pObject->IsA(subscriber.ResolvedClass))
+			{
+				return false;
+			}
+		}
+		if (!subscriber.ClassName.empty())
+		{
+			// Name entries are unique per string, so once one has matched a pointer compare is enough.
+			const auto classNameEntry = pObject->Class->Name.NameEntry;
+			if (subscriber.ResolvedClassName)
+			{
+				return classNameEntry == subscriber.ResolvedClassName;
+			}
+			if (strcmp(classNameEntry->Name, subscriber.ClassName.c_str()) != 0)
+			{
+				return false;
+			}
+			subscriber.ResolvedClassName = classNameEntry;
+		}
+		return true;
+	}
+
+	Table* BuildTable() const
+	{
+		const auto byPriority = [](const Subscriber& a, const Subscriber& b)
+		{
+			return a.Priority != b.Priority ? a.Priority < b.Priority : a.Handle < b.Handle;
+		};
+
+		auto table = new Table();
+		for (const auto& subscriber : Subscriptions)
+		{
+			if (subscriber.FunctionFullName.empty())
+			{
+				table->Wildcard.push_back(subscriber);
+				continue;
+			}
+			const auto id = table->Functions.Register(subscriber.FunctionFullName.c_str());
+			if (id >= int(table->ByFunction.size()))
+			{
+				table->ByFunction.resize(id + 1);
+			}
+			table->ByFunction[id].push_back(subscriber);
+		}
+		for (auto& subscribers : table->ByFunction)
+		{
+			subscribers.insert(subscribers.end(), table->Wildcard.begin(), table->Wildcard.end());
+			std::sort(subscribers.begin(), subscribers.end(), byPriority);
+		}
+		std::sort(table->Wildcard.begin(), table->Wildcard.end(), byPriority);
+
+		// The previous table is leaked on purpose: a call on the game thread may still be walking it.
+		return table;
+	}
+};
+
+// Installing the hub needs Detours and the game; off Windows only the hub itself builds, e.g. for SdkBench.
+#ifndef ME3SDK_PORTABLE
+ProcessEventHub processEventHub;
+
+int HubSubscribe(const ProcessEventSubscription* subscription)
+{
+	return processEventHub.Subscribe(*subscription);
+}
+
+void HubUnsubscribe(const int handle)
+{
+	processEventHub.Unsubscribe(handle);
+}
+
+void HubCallOriginal(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult)
+{
+	processEventHub.Original(pObject, pFunction, pParms, pResult);
+}
+
+ProcessEventHubApi processEventHubApi = { PROCESSEVENTHUB_VERSION, HubSubscribe, HubUnsubscribe, HubCallOriginal };
+
+void __fastcall HubHookedPE(UObject* pObject, void* edx, UFunction* pFunction, void* pParms, void* pResult)
+{
+	processEventHub.Dispatch(pObject, pFunction, pParms, pResult);
+}
+
+void InstallProcessEventHub()
+{
+	processEventHub.Original = (ProcessEventHub::tOriginalProcessEvent)0x00453120;
+	DetourTransactionBegin();
+	DetourUpdateThread(GetCurrentThread()); //This command set the current working thread to the game current thread.
+	DetourAttach(&(PVOID&)processEventHub.Original, HubHookedPE);
+	DetourTransactionCommit();
+}
+
+/// <summary>
+/// Gets the process-wide ProcessEvent hub. The first ASI to call this installs the only ProcessEvent detour and
+/// publishes its hub through a named mapping; every later ASI subscribes to that one.
+/// </summary>
+/// <returns></returns>
+ProcessEventHubApi* GetProcessEventHub()
+{
+	static ProcessEventHubApi* hubApi = nullptr;
+	if (hubApi)
+	{
+		return hubApi;
+	}
+
+	wchar_t mutexName[64];
+	wchar_t mappingName[64];
+	swprintf(mutexName, 64, L"Local\\ME3TweaksProcessEventHubLock-%lu", GetCurrentProcessId());
+	swprintf(mappingName, 64, L"Local\\ME3TweaksProcessEventHub-%lu", GetCurrentProcessId());
+
+	// Handles are kept open for the life of the process so the mapping outlives this call.
+	const auto mutex = CreateMutexW(nullptr, FALSE, mutexName);
+	WaitForSingleObject(mutex, INFINITE);
+
+	const auto mapping = CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, sizeof(ProcessEventHubApi*), mappingName);
+	const auto alreadyPublished = GetLastError() == ERROR_ALREADY_EXISTS;
+	const auto published = static_cast<ProcessEventHubApi**>(MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(ProcessEventHubApi*)));
+
+	if (alreadyPublished && *published && (*published)->Version == PROCESSEVENTHUB_VERSION)
+	{
+		hubApi = *published;
+	}
+	else
+	{
+		InstallProcessEventHub();
+		hubApi = &processEventHubApi;
+		if (!alreadyPublished || !*published)
+		{
+			*published = hubApi;
+		}
+	}
+
+	UnmapViewOfFile(published);
+	ReleaseMutex(mutex);
+	return hubApi;
+}
+
+/// <summary>
+/// Subscribes a callback to a single function through the process-wide hub. Returns a handle for Unsubscribe.
+/// </summary>
+int SubscribeProcessEvent(const char* functionFullName, const tProcessEventPre pre, const tProcessEventPost post = nullptr,
+	UClass* (*classFilter)() = nullptr, const char* className = nullptr, const int priority = 0)
+{
+	ProcessEventSubscription subscription;
+	subscription.FunctionFullName = functionFullName;
+	subscription.ClassFilter = classFilter;
+	subscription.ClassName = className;
+	subscription.Pre = pre;
+	subscription.Post = post;
+	subscription.Priority = priority;
+	return GetProcessEventHub()->Subscribe(&subscription);
+}
+
+/// <summary>
+/// Calls the game's ProcessEvent directly, past the hub's detour. ProcessEvent's own address is the detoured entry
+/// point, so calling it from a callback would dispatch the call again; use this instead.
+/// </summary>
+void CallOriginalProcessEvent(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult)
+{
+	GetProcessEventHub()->CallOriginal(pObject, pFunction, pParms, pResult);
+}
+#endif
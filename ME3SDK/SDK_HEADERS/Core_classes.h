@@ -205,10 +205,6 @@ public:
 	class UClass*                                      Class;                                            		// 0x0034 (0x0004) [0x0000000000021002]              ( CPF_Const | CPF_Native | CPF_EditConst )
 	class UObject*                                     ObjectArchetype;                                  		// 0x0038 (0x0004) [0x0000000000021003]              ( CPF_Edit | CPF_Const | CPF_Native | CPF_EditConst )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static TArray< UObject* >* GObjObjects(); 
 
 	char* GetName(); 
@@ -217,6 +213,11 @@ public:
 	char* GetFullNameNoClass();
 	char* GetFullName2();
 
+	// Reentrant versions: write into Buffer, truncating to fit, and return the length written.
+	size_t GetName(char* Buffer, size_t BufferSize);
+	size_t GetFullName(char* Buffer, size_t BufferSize);
+	size_t GetFullNameNoClass(char* Buffer, size_t BufferSize);
+
 	template< class T > static T* FindObject ( char* ObjectFullName ); 
 	static UClass* FindClass ( char* ClassFullName ); 
 
@@ -224,10 +225,7 @@ public:
 
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1 );
 	};
 
 
@@ -306,8 +304,6 @@ public:
 	char* GetContainingMapName();
 };
 
-UClass* UObject::pClassPointer = NULL;
-
 // Class Core.TextBuffer
 // 0x0028 (0x0064 - 0x003C)
 class UTextBuffer : public UObject
@@ -315,22 +311,13 @@ class UTextBuffer : public UObject
 public:
 	unsigned char                                      UnknownData00[ 0x28 ];                            		// 0x003C (0x0028) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 0 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 0 );
 	};
 
 };
 
-UClass* UTextBuffer::pClassPointer = NULL;
-
 // Class Core.Subsystem
 // 0x0004 (0x0040 - 0x003C)
 class USubsystem : public UObject
@@ -338,22 +325,13 @@ class USubsystem : public UObject
 public:
 	struct FPointer                                    VfTable_FExec;                                    		// 0x003C (0x0004) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 3 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 3 );
 	};
 
 };
 
-UClass* USubsystem::pClassPointer = NULL;
-
 // Class Core.System
 // 0x00C8 (0x0108 - 0x0040)
 class USystem : public USubsystem
@@ -380,22 +358,13 @@ public:
 	TArray< struct FString >                           LocalizationPaths;                                		// 0x00F0 (0x000C) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 	struct FString                                     TextureFileCacheExtension;                        		// 0x00FC (0x000C) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2 );
 	};
 
 };
 
-UClass* USystem::pClassPointer = NULL;
-
 // Class Core.PackageMap
 // 0x008C (0x00C8 - 0x003C)
 class UPackageMap : public UObject
@@ -403,22 +372,13 @@ class UPackageMap : public UObject
 public:
 	unsigned char                                      UnknownData00[ 0x8C ];                            		// 0x003C (0x008C) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 4 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4 );
 	};
 
 };
 
-UClass* UPackageMap::pClassPointer = NULL;
-
 // Class Core.ObjectSerializer
 // 0x000C (0x0048 - 0x003C)
 class UObjectSerializer : public UObject
@@ -426,22 +386,13 @@ class UObjectSerializer : public UObject
 public:
 	unsigned char                                      UnknownData00[ 0xC ];                             		// 0x003C (0x000C) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 5 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5 );
 	};
 
 };
 
-UClass* UObjectSerializer::pClassPointer = NULL;
-
 // Class Core.ObjectRedirector
 // 0x0004 (0x0040 - 0x003C)
 class UObjectRedirector : public UObject
@@ -449,22 +400,13 @@ class UObjectRedirector : public UObject
 public:
 	unsigned char                                      UnknownData00[ 0x4 ];                             		// 0x003C (0x0004) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 6 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6 );
 	};
 
 };
 
-UClass* UObjectRedirector::pClassPointer = NULL;
-
 // Class Core.MetaData
 // 0x003C (0x0078 - 0x003C)
 class UMetaData : public UObject
@@ -472,22 +414,13 @@ class UMetaData : public UObject
 public:
 	unsigned char                                      UnknownData00[ 0x3C ];                            		// 0x003C (0x003C) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 7 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7 );
 	};
 
 };
 
-UClass* UMetaData::pClassPointer = NULL;
-
 // Class Core.Linker
 // 0x011C (0x0158 - 0x003C)
 class ULinker : public UObject
@@ -495,22 +428,13 @@ class ULinker : public UObject
 public:
 	unsigned char                                      UnknownData00[ 0x11C ];                           		// 0x003C (0x011C) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 9 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 9 );
 	};
 
 };
 
-UClass* ULinker::pClassPointer = NULL;
-
 // Class Core.LinkerSave
 // 0x00D4 (0x022C - 0x0158)
 class ULinkerSave : public ULinker
@@ -518,22 +442,13 @@ class ULinkerSave : public ULinker
 public:
 	unsigned char                                      UnknownData00[ 0xD4 ];                            		// 0x0158 (0x00D4) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 8 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8 );
 	};
 
 };
 
-UClass* ULinkerSave::pClassPointer = NULL;
-
 // Class Core.LinkerLoad
 // 0x05BC (0x0714 - 0x0158)
 class ULinkerLoad : public ULinker
@@ -541,44 +456,26 @@ class ULinkerLoad : public ULinker
 public:
 	unsigned char                                      UnknownData00[ 0x5BC ];                           		// 0x0158 (0x05BC) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 10 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 10 );
 	};
 
 };
 
-UClass* ULinkerLoad::pClassPointer = NULL;
-
 // Class Core.Interface
 // 0x0000 (0x003C - 0x003C)
 class UInterface : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 11 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 11 );
 	};
 
 };
 
-UClass* UInterface::pClassPointer = NULL;
-
 // Class Core.Field
 // 0x0008 (0x0044 - 0x003C)
 class UField : public UObject
@@ -587,22 +484,13 @@ public:
 	class UField*                                      SuperField;                                       		// NOT AUTO-GENERATED PROPERTY 
 	class UField*                                      Next;                                             		// NOT AUTO-GENERATED PROPERTY 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 14 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 14 );
 	};
 
 };
 
-UClass* UField::pClassPointer = NULL;
-
 // Class Core.Struct
 // 0x0040 (0x0084 - 0x0044)
 class UStruct : public UField
@@ -610,22 +498,13 @@ class UStruct : public UField
 public:
 	unsigned char                                      UnknownData00[ 0x40 ];                            		// 0x0044 (0x0040) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 13 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 13 );
 	};
 
 };
 
-UClass* UStruct::pClassPointer = NULL;
-
 // Class Core.ScriptStruct
 // 0x0010 (0x0094 - 0x0084)
 class UScriptStruct : public UStruct
@@ -633,22 +512,13 @@ class UScriptStruct : public UStruct
 public:
 	unsigned char                                      UnknownData00[ 0x10 ];                            		// 0x0084 (0x0010) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 12 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 12 );
 	};
 
 };
 
-UClass* UScriptStruct::pClassPointer = NULL;
-
 // Class Core.Function
 // 0x0014 (0x0098 - 0x0084)
 class UFunction : public UStruct
@@ -659,22 +529,13 @@ public:
 	unsigned short		                               iNative;			                             		    // NOT AUTO-GENERATED PROPERTY 
 	unsigned char		                               UnknownData00[ 0x8 ];                             		// NOT AUTO-GENERATED PROPERTY 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 15 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 15 );
 	};
 
 };
 
-UClass* UFunction::pClassPointer = NULL;
-
 // Class Core.Property
 // 0x0044 (0x0088 - 0x0044)
 class UProperty : public UField
@@ -682,22 +543,13 @@ class UProperty : public UField
 public:
 	unsigned char                                      UnknownData00[ 0x44 ];                            		// 0x0044 (0x0044) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 17 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 17 );
 	};
 
 };
 
-UClass* UProperty::pClassPointer = NULL;
-
 // Class Core.StructProperty
 // 0x0008 (0x0090 - 0x0088)
 class UStructProperty : public UProperty
@@ -705,66 +557,39 @@ class UStructProperty : public UProperty
 public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0088 (0x0008) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 16 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 16 );
 	};
 
 };
 
-UClass* UStructProperty::pClassPointer = NULL;
-
 // Class Core.StrProperty
 // 0x0000 (0x0088 - 0x0088)
 class UStrProperty : public UProperty
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 18 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 18 );
 	};
 
 };
 
-UClass* UStrProperty::pClassPointer = NULL;
-
 // Class Core.StringRefProperty
 // 0x0000 (0x0088 - 0x0088)
 class UStringRefProperty : public UProperty
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 19 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 19 );
 	};
 
 };
 
-UClass* UStringRefProperty::pClassPointer = NULL;
-
 // Class Core.ObjectProperty
 // 0x0008 (0x0090 - 0x0088)
 class UObjectProperty : public UProperty
@@ -772,88 +597,52 @@ class UObjectProperty : public UProperty
 public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0088 (0x0008) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 21 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 21 );
 	};
 
 };
 
-UClass* UObjectProperty::pClassPointer = NULL;
-
 // Class Core.ComponentProperty
 // 0x0000 (0x0090 - 0x0090)
 class UComponentProperty : public UObjectProperty
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 20 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 20 );
 	};
 
 };
 
-UClass* UComponentProperty::pClassPointer = NULL;
-
 // Class Core.ClassProperty
 // 0x0000 (0x0090 - 0x0090)
 class UClassProperty : public UObjectProperty
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 22 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 22 );
 	};
 
 };
 
-UClass* UClassProperty::pClassPointer = NULL;
-
 // Class Core.NameProperty
 // 0x0000 (0x0088 - 0x0088)
 class UNameProperty : public UProperty
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 23 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 23 );
 	};
 
 };
 
-UClass* UNameProperty::pClassPointer = NULL;
-
 // Class Core.MapProperty
 // 0x0008 (0x0090 - 0x0088)
 class UMapProperty : public UProperty
@@ -861,44 +650,26 @@ class UMapProperty : public UProperty
 public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0088 (0x0008) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 24 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 24 );
 	};
 
 };
 
-UClass* UMapProperty::pClassPointer = NULL;
-
 // Class Core.IntProperty
 // 0x0000 (0x0088 - 0x0088)
 class UIntProperty : public UProperty
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 25 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 25 );
 	};
 
 };
 
-UClass* UIntProperty::pClassPointer = NULL;
-
 // Class Core.InterfaceProperty
 // 0x0008 (0x0090 - 0x0088)
 class UInterfaceProperty : public UProperty
@@ -906,44 +677,26 @@ class UInterfaceProperty : public UProperty
 public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0088 (0x0008) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 26 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 26 );
 	};
 
 };
 
-UClass* UInterfaceProperty::pClassPointer = NULL;
-
 // Class Core.FloatProperty
 // 0x0000 (0x0088 - 0x0088)
 class UFloatProperty : public UProperty
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 27 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 27 );
 	};
 
 };
 
-UClass* UFloatProperty::pClassPointer = NULL;
-
 // Class Core.DelegateProperty
 // 0x0008 (0x0090 - 0x0088)
 class UDelegateProperty : public UProperty
@@ -951,22 +704,13 @@ class UDelegateProperty : public UProperty
 public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0088 (0x0008) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 28 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 28 );
 	};
 
 };
 
-UClass* UDelegateProperty::pClassPointer = NULL;
-
 // Class Core.ByteProperty
 // 0x0008 (0x0090 - 0x0088)
 class UByteProperty : public UProperty
@@ -974,22 +718,13 @@ class UByteProperty : public UProperty
 public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0088 (0x0008) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 29 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 29 );
 	};
 
 };
 
-UClass* UByteProperty::pClassPointer = NULL;
-
 // Class Core.BoolProperty
 // 0x0008 (0x0090 - 0x0088)
 class UBoolProperty : public UProperty
@@ -997,22 +732,13 @@ class UBoolProperty : public UProperty
 public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0088 (0x0008) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 30 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 30 );
 	};
 
 };
 
-UClass* UBoolProperty::pClassPointer = NULL;
-
 // Class Core.BioMask4Property
 // 0x0008 (0x0090 - 0x0088)
 class UBioMask4Property : public UProperty
@@ -1020,22 +746,13 @@ class UBioMask4Property : public UProperty
 public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0088 (0x0008) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 31 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 31 );
 	};
 
 };
 
-UClass* UBioMask4Property::pClassPointer = NULL;
-
 // Class Core.ArrayProperty
 // 0x0008 (0x0090 - 0x0088)
 class UArrayProperty : public UProperty
@@ -1043,22 +760,13 @@ class UArrayProperty : public UProperty
 public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0088 (0x0008) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 32 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 32 );
 	};
 
 };
 
-UClass* UArrayProperty::pClassPointer = NULL;
-
 // Class Core.Enum
 // 0x0010 (0x0054 - 0x0044)
 class UEnum : public UField
@@ -1066,22 +774,13 @@ class UEnum : public UField
 public:
 	unsigned char                                      UnknownData00[ 0x10 ];                            		// 0x0044 (0x0010) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 33 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 33 );
 	};
 
 };
 
-UClass* UEnum::pClassPointer = NULL;
-
 // Class Core.Const
 // 0x000C (0x0050 - 0x0044)
 class UConst : public UField
@@ -1089,22 +788,13 @@ class UConst : public UField
 public:
 	unsigned char                                      UnknownData00[ 0xC ];                             		// 0x0044 (0x000C) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 34 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 34 );
 	};
 
 };
 
-UClass* UConst::pClassPointer = NULL;
-
 // Class Core.Factory
 // 0x0034 (0x0070 - 0x003C)
 class UFactory : public UObject
@@ -1115,44 +805,26 @@ public:
 	TArray< struct FString >                           Formats;                                          		// 0x0050 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	unsigned char                                      UnknownData01[ 0x14 ];                            		// 0x005C (0x0014) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 36 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 36 );
 	};
 
 };
 
-UClass* UFactory::pClassPointer = NULL;
-
 // Class Core.TextBufferFactory
 // 0x0000 (0x0070 - 0x0070)
 class UTextBufferFactory : public UFactory
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 35 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 35 );
 	};
 
 };
 
-UClass* UTextBufferFactory::pClassPointer = NULL;
-
 // Class Core.Exporter
 // 0x0028 (0x0064 - 0x003C)
 class UExporter : public UObject
@@ -1163,22 +835,13 @@ public:
 	TArray< struct FString >                           FormatDescription;                                		// 0x004C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	unsigned char                                      UnknownData01[ 0xC ];                             		// 0x0058 (0x000C) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 37 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 37 );
 	};
 
 };
 
-UClass* UExporter::pClassPointer = NULL;
-
 // Class Core.Component
 // 0x000C (0x0048 - 0x003C)
 class UComponent : public UObject
@@ -1187,22 +850,13 @@ public:
 	class UClass*                                      TemplateOwnerClass;                               		// 0x003C (0x0004) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 	struct FName                                       TemplateName;                                     		// 0x0040 (0x0008) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 39 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 39 );
 	};
 
 };
 
-UClass* UComponent::pClassPointer = NULL;
-
 // Class Core.DistributionVector
 // 0x0008 (0x0050 - 0x0048)
 class UDistributionVector : public UComponent
@@ -1212,23 +866,14 @@ public:
 	unsigned long                                      bCanBeBaked : 1;                                  		// 0x004C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bIsDirty : 1;                                     		// 0x004C (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 38 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 38 );
 	};
 
 	struct FVector GetVectorValue ( float F, int LastExtreme );
 };
 
-UClass* UDistributionVector::pClassPointer = NULL;
-
 // Class Core.DistributionFloat
 // 0x0008 (0x0050 - 0x0048)
 class UDistributionFloat : public UComponent
@@ -1238,23 +883,14 @@ public:
 	unsigned long                                      bCanBeBaked : 1;                                  		// 0x004C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bIsDirty : 1;                                     		// 0x004C (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 40 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 40 );
 	};
 
 	float GetFloatValue ( float F );
 };
 
-UClass* UDistributionFloat::pClassPointer = NULL;
-
 // Class Core.Commandlet
 // 0x0040 (0x007C - 0x003C)
 class UCommandlet : public UObject
@@ -1273,46 +909,28 @@ public:
 	unsigned long                                      BioLoadConsoleSupport : 1;                        		// 0x0078 (0x0004) [0x0000000000000000] [0x00000020] 
 	unsigned long                                      bBioUseSound : 1;                                 		// 0x0078 (0x0004) [0x0000000000000000] [0x00000040] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 42 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 42 );
 	};
 
 	int eventMain ( struct FString Params );
 };
 
-UClass* UCommandlet::pClassPointer = NULL;
-
 // Class Core.HelpCommandlet
 // 0x0000 (0x007C - 0x007C)
 class UHelpCommandlet : public UCommandlet
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 41 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 41 );
 	};
 
 	int eventMain ( struct FString Params );
 };
 
-UClass* UHelpCommandlet::pClassPointer = NULL;
-
 // Class Core.Package
 // 0x0094 (0x00D0 - 0x003C)
 class UPackage : public UObject
@@ -1320,22 +938,13 @@ class UPackage : public UObject
 public:
 	unsigned char                                      UnknownData00[ 0x94 ];                            		// 0x003C (0x0094) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 43 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 43 );
 	};
 
 };
 
-UClass* UPackage::pClassPointer = NULL;
-
 // Class Core.State
 // 0x0024 (0x00A8 - 0x0084)
 class UState : public UStruct
@@ -1343,22 +952,13 @@ class UState : public UStruct
 public:
 	unsigned char                                      UnknownData00[ 0x24 ];                            		// 0x0084 (0x0024) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 44 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 44 );
 	};
 
 };
 
-UClass* UState::pClassPointer = NULL;
-
 // Class Core.Class
 // 0x00BC (0x0164 - 0x00A8)
 class UClass : public UState
@@ -1366,22 +966,13 @@ class UClass : public UState
 public:
 	unsigned char                                      UnknownData00[ 0xBC ];                            		// 0x00A8 (0x00BC) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 45 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 45 );
 	};
 
 };
 
-UClass* UClass::pClassPointer = NULL;
-
 
 #ifdef _MSC_VER
 	#pragma pack ( pop )
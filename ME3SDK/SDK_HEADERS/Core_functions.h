@@ -27,30 +27,67 @@ TArray< UObject* >* UObject::GObjObjects()
 	return ObjectArray; 
 } 
 
+size_t UObject::GetName(char* Buffer, size_t BufferSize)
+{
+	return AppendToNameBuffer(Buffer, BufferSize, 0, this->Name.GetName());
+}
+
+size_t UObject::GetFullNameNoClass(char* Buffer, size_t BufferSize)
+{
+	if (!this->Outer)
+	{
+		return AppendToNameBuffer(Buffer, BufferSize, 0, "(null)");
+	}
+
+	size_t Length = 0;
+	if (this->Outer->Outer)
+	{
+		Length = AppendToNameBuffer(Buffer, BufferSize, Length, this->Outer->Outer->Name.GetName());
+		Length = AppendToNameBuffer(Buffer, BufferSize, Length, ".");
+	}
+	Length = AppendToNameBuffer(Buffer, BufferSize, Length, this->Outer->Name.GetName());
+	Length = AppendToNameBuffer(Buffer, BufferSize, Length, ".");
+	return AppendToNameBuffer(Buffer, BufferSize, Length, this->Name.GetName());
+}
+
+size_t UObject::GetFullName(char* Buffer, size_t BufferSize)
+{
+	if (!this->Class || !this->Outer)
+	{
+		return AppendToNameBuffer(Buffer, BufferSize, 0, "(null)");
+	}
+
+	auto Length = AppendToNameBuffer(Buffer, BufferSize, 0, this->Class->Name.GetName());
+	Length = AppendToNameBuffer(Buffer, BufferSize, Length, " ");
+	return Length + this->GetFullNameNoClass(Buffer + Length, BufferSize - Length);
+}
+
+// The char* versions below return a per-thread buffer that the next call on the same thread overwrites.
+
 char* UObject::GetName() 
 { 
-	static char cOutBuffer[ 256 ]; 
+	static thread_local char cOutBuffer[ 256 ]; 
 
-	sprintf_s ( cOutBuffer, "%s", this->Name.GetName() ); 
+	this->GetName ( cOutBuffer, sizeof ( cOutBuffer ) ); 
 
 	return cOutBuffer; 
 } 
 
 char* UObject::GetNameCPP() 
 { 
-	static char cOutBuffer[ 256 ]; 
+	static thread_local char cOutBuffer[ 256 ]; 
 
 	if ( this->IsA ( UClass::StaticClass() ) ) 
 	{ 
 		UClass* pClass = (UClass*) this; 
 		while ( pClass ) 
 		{ 
-			if ( ! strcmp ( pClass->GetName(), "Actor" ) ) 
+			if ( ! strcmp ( pClass->Name.GetName(), "Actor" ) ) 
 			{ 
 				strcpy_s ( cOutBuffer, "A" ); 
 				break; 
 			} 
-			else if ( ! strcmp ( pClass->GetName(), "Object" ) ) 
+			else if ( ! strcmp ( pClass->Name.GetName(), "Object" ) ) 
 			{ 
 				strcpy_s ( cOutBuffer, "U" ); 
 				break; 
@@ -64,40 +101,18 @@ char* UObject::GetNameCPP()
 		strcpy_s ( cOutBuffer, "F" ); 
 	} 
 
-	strcat_s ( cOutBuffer, this->GetName() ); 
+	strcat_s ( cOutBuffer, this->Name.GetName() ); 
 
 	return cOutBuffer; 
 } 
 
 char* UObject::GetFullName() 
 { 
-	if ( this->Class && this->Outer ) 
-	{ 
-		static char cOutBuffer[ 256 ]; 
+	static thread_local char cOutBuffer[ 256 ]; 
 
-		if ( this->Outer->Outer ) 
-		{ 
-			strcpy_s ( cOutBuffer, this->Class->GetName() ); 
-			strcat_s ( cOutBuffer, " " ); 
-			strcat_s ( cOutBuffer, this->Outer->Outer->GetName() ); 
-			strcat_s ( cOutBuffer, "." ); 
-			strcat_s ( cOutBuffer, this->Outer->GetName() ); 
-			strcat_s ( cOutBuffer, "." ); 
-			strcat_s ( cOutBuffer, this->GetName() ); 
-		} 
-		else 
-		{ 
-			strcpy_s ( cOutBuffer, this->Class->GetName() ); 
-			strcat_s ( cOutBuffer, " " ); 
-			strcat_s ( cOutBuffer, this->Outer->GetName() ); 
-			strcat_s ( cOutBuffer, "." ); 
-			strcat_s ( cOutBuffer, this->GetName() ); 
-		} 
+	this->GetFullName ( cOutBuffer, sizeof ( cOutBuffer ) ); 
 
-		return cOutBuffer; 
-	} 
-
-	return "(null)"; 
+	return cOutBuffer; 
 }
 
 /// <summary>
@@ -106,30 +121,11 @@ char* UObject::GetFullName()
 /// <returns></returns>
 char* UObject::GetFullNameNoClass()
 {
-	if (this->Outer)
-	{
-		static char cOutBuffer[256];
-
-		if (this->Outer->Outer)
-		{
-
-			strcat_s(cOutBuffer, this->Outer->Outer->GetName());
-			strcat_s(cOutBuffer, ".");
-			strcat_s(cOutBuffer, this->Outer->GetName());
-			strcat_s(cOutBuffer, ".");
-			strcat_s(cOutBuffer, this->GetName());
-		}
-		else
-		{
-			strcat_s(cOutBuffer, this->Outer->GetName());
-			strcat_s(cOutBuffer, ".");
-			strcat_s(cOutBuffer, this->GetName());
-		}
+	static thread_local char cOutBuffer[256];
 
-		return cOutBuffer;
-	}
+	this->GetFullNameNoClass(cOutBuffer, sizeof(cOutBuffer));
 
-	return "(null)";
+	return cOutBuffer;
 }
 
 //Used to get debug info about outer
@@ -137,17 +133,17 @@ char* UObject::GetFullName2()
 {
 	if (this->Class && this->Outer)
 	{
-		static char cOutBuffer[512];
+		static thread_local char cOutBuffer[512];
 		class UObject* OuterObj = this->Outer;
 
-		strcpy_s(cOutBuffer, this->Class->GetName());
+		strcpy_s(cOutBuffer, this->Class->Name.GetName());
 		strcat_s(cOutBuffer, " ");
-		strcat_s(cOutBuffer, this->Outer->GetName());
+		strcat_s(cOutBuffer, this->Outer->Name.GetName());
 
 		while (OuterObj->Class && OuterObj->Outer)
 		{
 			strcat_s(cOutBuffer, ".");
-			strcat_s(cOutBuffer, OuterObj->Outer->GetName());
+			strcat_s(cOutBuffer, OuterObj->Outer->Name.GetName());
 			strcat_s(cOutBuffer, ".");
 			OuterObj = OuterObj->Outer;
 		}
@@ -159,59 +155,17 @@ char* UObject::GetFullName2()
 	return "(null)";
 }
 
-template< class T > T* UObject::FindObject ( char* ObjectFullName ) 
-{ 
-	while ( ! UObject::GObjObjects() ) 
-		Sleep ( 100 ); 
-
-	for ( int i = 0; i < UObject::GObjObjects()->Count; ++i ) 
-	{ 
-		UObject* Object = UObject::GObjObjects()->Data[ i ]; 
-
-		// skip no T class objects 
-		if 
-		( 
-				! Object 
-			||	! Object->IsA ( T::StaticClass() ) 
-		) 
-			continue; 
-
-		// check 
-		if ( ! _stricmp ( Object->GetFullName(), ObjectFullName ) ) 
-			return (T*) Object; 
-	} 
-
-	return NULL; 
-} 
-
 UClass* UObject::FindClass ( char* ClassFullName ) 
 { 
 	while ( ! UObject::GObjObjects() ) 
 		Sleep ( 100 ); 
 
-	for ( int i = 0; i < UObject::GObjObjects()->Count; ++i ) 
-	{ 
-		UObject* Object = UObject::GObjObjects()->Data[ i ]; 
-
-		if ( ! Object ) 
-			continue; 
-
-		if ( ! _stricmp ( Object->GetFullName(), ClassFullName ) ) 
-			return (UClass*) Object; 
-	} 
-
-	return NULL; 
+	return (UClass*) ObjectIndex::Get().FindByPath ( ClassFullName ); 
 } 
 
 bool UObject::IsA ( UClass* pClass ) 
 { 
-	for ( UClass* SuperClass = this->Class; SuperClass; SuperClass = ( UClass* ) SuperClass->SuperField ) 
-	{ 
-		if ( SuperClass == pClass ) 
-			return true; 
-	} 
-
-	return false; 
+	return ClassHierarchy::IsChildOf ( this->Class, pClass ); 
 } 
 
 /*
@@ -229,10 +183,9 @@ bool UObject::IsA ( UClass* pClass )
 
 struct FVector UDistributionVector::GetVectorValue ( float F, int LastExtreme )
 {
-	static UFunction* pFnGetVectorValue = NULL;
-
+	UFunction* pFnGetVectorValue = (UFunction*) SdkBindings::Get ( 2107 );
 	if ( ! pFnGetVectorValue )
-		pFnGetVectorValue = (UFunction*) UObject::GObjObjects()->Data[ 3634 ];
+		return {};
 
 	UDistributionVector_execGetVectorValue_Parms GetVectorValue_Parms;
 	GetVectorValue_Parms.F = F;
@@ -255,10 +208,9 @@ struct FVector UDistributionVector::GetVectorValue ( float F, int LastExtreme )
 
 float UDistributionFloat::GetFloatValue ( float F )
 {
-	static UFunction* pFnGetFloatValue = NULL;
-
+	UFunction* pFnGetFloatValue = (UFunction*) SdkBindings::Get ( 2106 );
 	if ( ! pFnGetFloatValue )
-		pFnGetFloatValue = (UFunction*) UObject::GObjObjects()->Data[ 3622 ];
+		return {};
 
 	UDistributionFloat_execGetFloatValue_Parms GetFloatValue_Parms;
 	GetFloatValue_Parms.F = F;
@@ -280,10 +232,9 @@ float UDistributionFloat::GetFloatValue ( float F )
 
 int UHelpCommandlet::eventMain ( struct FString Params )
 {
-	static UFunction* pFnMain = NULL;
-
+	UFunction* pFnMain = (UFunction*) SdkBindings::Get ( 2105 );
 	if ( ! pFnMain )
-		pFnMain = (UFunction*) UObject::GObjObjects()->Data[ 3607 ];
+		return {};
 
 	UHelpCommandlet_eventMain_Parms Main_Parms;
 	memcpy ( &Main_Parms.Params, &Params, 0xC );
@@ -305,10 +256,9 @@ int UHelpCommandlet::eventMain ( struct FString Params )
 
 int UCommandlet::eventMain ( struct FString Params )
 {
-	static UFunction* pFnMain = NULL;
-
+	UFunction* pFnMain = (UFunction*) SdkBindings::Get ( 2105 );
 	if ( ! pFnMain )
-		pFnMain = (UFunction*) UObject::GObjObjects()->Data[ 3607 ];
+		return {};
 
 	UCommandlet_eventMain_Parms Main_Parms;
 	memcpy ( &Main_Parms.Params, &Params, 0xC );
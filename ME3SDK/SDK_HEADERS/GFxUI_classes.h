@@ -96,44 +96,26 @@ public:
 	TArray< struct FGCReference >                      GCReferences;                                     		// 0x003C (0x000C) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 	int                                                RefCount;                                         		// 0x0048 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1293 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1293 );
 	};
 
 };
 
-UClass* UGFxEngine::pClassPointer = NULL;
-
 // Class GFxUI.GFxFSCmdHandler
 // 0x0000 (0x003C - 0x003C)
 class UGFxFSCmdHandler : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1294 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1294 );
 	};
 
 };
 
-UClass* UGFxFSCmdHandler::pClassPointer = NULL;
-
 // Class GFxUI.GFxGameViewportClient
 // 0x000B (0x0128 - 0x011D)
 class UGFxGameViewportClient : public UGameViewportClient
@@ -142,23 +124,14 @@ public:
 	class UClass*                                      GFxUIControllerClass;                             		// 0x0120 (0x0004) [0x0000000000000000]              
 	class UGFxInteraction*                             GFxUIController;                                  		// 0x0124 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1295 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1295 );
 	};
 
 	bool eventInit ( struct FString* OutError );
 };
 
-UClass* UGFxGameViewportClient::pClassPointer = NULL;
-
 // Class GFxUI.GFxInteraction
 // 0x0004 (0x0070 - 0x006C)
 class UGFxInteraction : public UInteraction
@@ -166,16 +139,9 @@ class UGFxInteraction : public UInteraction
 public:
 	struct FPointer                                    VfTable_FCallbackEventDevice;                     		// 0x006C (0x0004) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1296 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1296 );
 	};
 
 	void NotifyPlayerRemoved ( int PlayerIndex, class ULocalPlayer* RemovedPlayer );
@@ -185,8 +151,6 @@ public:
 	bool SetFocusMovie ( struct FString MovieName, unsigned long captureInput );
 };
 
-UClass* UGFxInteraction::pClassPointer = NULL;
-
 // Class GFxUI.GFxMovie
 // 0x011F (0x015B - 0x003C)
 class UGFxMovie : public UObject
@@ -220,16 +184,9 @@ public:
 	unsigned char                                      TimingMode;                                       		// 0x0159 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      RenderTextureMode;                                		// 0x015A (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1297 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1297 );
 	};
 
 	bool UnregisterGFxValue ( class UGFxValue* i_val );
@@ -291,8 +248,6 @@ public:
 	bool eventStart ( unsigned long StartPaused );
 };
 
-UClass* UGFxMovie::pClassPointer = NULL;
-
 // Class GFxUI.GFxMovieInfo
 // 0x0038 (0x0074 - 0x003C)
 class UGFxMovieInfo : public UObject
@@ -305,22 +260,13 @@ public:
 	TArray< class UObject* >                           CompressedTextureReferences;                      		// 0x0064 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	unsigned long                                      bUsesFontlib : 1;                                 		// 0x0070 (0x0004) [0x0000000000020001] [0x00000001] ( CPF_Edit | CPF_EditConst )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1298 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1298 );
 	};
 
 };
 
-UClass* UGFxMovieInfo::pClassPointer = NULL;
-
 // Class GFxUI.GFxValue
 // 0x0030 (0x006C - 0x003C)
 class UGFxValue : public UObject
@@ -328,16 +274,9 @@ class UGFxValue : public UObject
 public:
 	int                                                Value[ 0xC ];                                     		// 0x003C (0x0030) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1299 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1299 );
 	};
 
 	void ActionScriptSetFunctionOn ( class UGFxValue* Target, struct FString member );
@@ -409,8 +348,6 @@ public:
 	struct FASValue Invoke ( struct FString member, TArray< struct FASValue > Args );
 };
 
-UClass* UGFxValue::pClassPointer = NULL;
-
 // Class GFxUI.GFxAction_CloseMovie
 // 0x0008 (0x00B8 - 0x00B0)
 class UGFxAction_CloseMovie : public USequenceAction
@@ -419,23 +356,14 @@ public:
 	class UGFxMovie*                                   movie;                                            		// 0x00B0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bUnload : 1;                                      		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1300 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1300 );
 	};
 
 	bool eventIsValidLevelSequenceObject ( );
 };
 
-UClass* UGFxAction_CloseMovie::pClassPointer = NULL;
-
 // Class GFxUI.GFxAction_GetVariable
 // 0x0010 (0x00C0 - 0x00B0)
 class UGFxAction_GetVariable : public USequenceAction
@@ -444,23 +372,14 @@ public:
 	struct FString                                     Variable;                                         		// 0x00B0 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	class UGFxMovie*                                   movie;                                            		// 0x00BC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1301 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1301 );
 	};
 
 	bool eventIsValidLevelSequenceObject ( );
 };
 
-UClass* UGFxAction_GetVariable::pClassPointer = NULL;
-
 // Class GFxUI.GFxAction_Invoke
 // 0x001C (0x00CC - 0x00B0)
 class UGFxAction_Invoke : public USequenceAction
@@ -470,23 +389,14 @@ public:
 	TArray< struct FASValue >                          Arguments;                                        		// 0x00BC (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	class UGFxMovie*                                   movie;                                            		// 0x00C8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1302 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1302 );
 	};
 
 	bool eventIsValidLevelSequenceObject ( );
 };
 
-UClass* UGFxAction_Invoke::pClassPointer = NULL;
-
 // Class GFxUI.GFxAction_OpenMovie
 // 0x0008 (0x00B8 - 0x00B0)
 class UGFxAction_OpenMovie : public USequenceAction
@@ -497,23 +407,14 @@ public:
 	unsigned long                                      bCaptureInput : 1;                                		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned long                                      bStartPaused : 1;                                 		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1303 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1303 );
 	};
 
 	bool eventIsValidLevelSequenceObject ( );
 };
 
-UClass* UGFxAction_OpenMovie::pClassPointer = NULL;
-
 // Class GFxUI.GFxAction_SetCaptureKeys
 // 0x0010 (0x00C0 - 0x00B0)
 class UGFxAction_SetCaptureKeys : public USequenceAction
@@ -522,22 +423,13 @@ public:
 	TArray< struct FName >                             CaptureKeys;                                      		// 0x00B0 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	class UGFxMovie*                                   movie;                                            		// 0x00BC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1304 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1304 );
 	};
 
 };
 
-UClass* UGFxAction_SetCaptureKeys::pClassPointer = NULL;
-
 // Class GFxUI.GFxAction_SetFocus
 // 0x0008 (0x00B8 - 0x00B0)
 class UGFxAction_SetFocus : public USequenceAction
@@ -546,22 +438,13 @@ public:
 	class UGFxMovie*                                   movie;                                            		// 0x00B0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bCaptureInput : 1;                                		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1305 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1305 );
 	};
 
 };
 
-UClass* UGFxAction_SetFocus::pClassPointer = NULL;
-
 // Class GFxUI.GFxAction_SetVariable
 // 0x0010 (0x00C0 - 0x00B0)
 class UGFxAction_SetVariable : public USequenceAction
@@ -570,23 +453,14 @@ public:
 	struct FString                                     Variable;                                         		// 0x00B0 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	class UGFxMovie*                                   movie;                                            		// 0x00BC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1306 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1306 );
 	};
 
 	bool eventIsValidLevelSequenceObject ( );
 };
 
-UClass* UGFxAction_SetVariable::pClassPointer = NULL;
-
 // Class GFxUI.GFxEvent_FsCommand
 // 0x0012 (0x00E4 - 0x00D2)
 class UGFxEvent_FsCommand : public USequenceEvent
@@ -595,22 +469,13 @@ public:
 	struct FString                                     FSCommand;                                        		// 0x00D4 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	class UGFxMovie*                                   movie;                                            		// 0x00E0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1307 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1307 );
 	};
 
 };
 
-UClass* UGFxEvent_FsCommand::pClassPointer = NULL;
-
 // Class GFxUI.GFxFSCmdHandler_Kismet
 // 0x003C (0x0078 - 0x003C)
 class UGFxFSCmdHandler_Kismet : public UGFxFSCmdHandler
@@ -618,23 +483,14 @@ class UGFxFSCmdHandler_Kismet : public UGFxFSCmdHandler
 public:
 	unsigned char                                      UnknownData00[ 0x3C ];                            		// 0x003C (0x003C) UNKNOWN PROPERTY: MapProperty GFxUI.GFxFSCmdHandler_Kismet.Events
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1308 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1308 );
 	};
 
 	bool eventFSCommand ( class UGFxMovie* movie, struct FString Cmd, struct FString Arg );
 };
 
-UClass* UGFxFSCmdHandler_Kismet::pClassPointer = NULL;
-
 // Class GFxUI.GFxDataStoreSubscriber
 // 0x0008 (0x0044 - 0x003C)
 class UGFxDataStoreSubscriber : public UObject
@@ -643,16 +499,9 @@ public:
 	struct FPointer                                    VfTable_IUIDataStorePublisher;                    		// 0x003C (0x0004) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 	class UGFxMovie*                                   movie;                                            		// 0x0040 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1309 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1309 );
 	};
 
 	bool SaveSubscriberValue ( int BindingIndex, TArray< class UUIDataStore* >* out_BoundDataStores );
@@ -665,8 +514,6 @@ public:
 	void PublishValues ( );
 };
 
-UClass* UGFxDataStoreSubscriber::pClassPointer = NULL;
-
 
 #ifdef _MSC_VER
 	#pragma pack ( pop )
@@ -29,10 +29,9 @@
 
 bool UGFxGameViewportClient::eventInit ( struct FString* OutError )
 {
-	static UFunction* pFnInit = NULL;
-
+	UFunction* pFnInit = (UFunction*) SdkBindings::Get ( 2856 );
 	if ( ! pFnInit )
-		pFnInit = (UFunction*) UObject::GObjObjects()->Data[ 34724 ];
+		return {};
 
 	UGFxGameViewportClient_eventInit_Parms Init_Parms;
 
@@ -52,10 +51,9 @@ bool UGFxGameViewportClient::eventInit ( struct FString* OutError )
 
 void UGFxInteraction::NotifyPlayerRemoved ( int PlayerIndex, class ULocalPlayer* RemovedPlayer )
 {
-	static UFunction* pFnNotifyPlayerRemoved = NULL;
-
+	UFunction* pFnNotifyPlayerRemoved = (UFunction*) SdkBindings::Get ( 2861 );
 	if ( ! pFnNotifyPlayerRemoved )
-		pFnNotifyPlayerRemoved = (UFunction*) UObject::GObjObjects()->Data[ 34740 ];
+		return;
 
 	UGFxInteraction_execNotifyPlayerRemoved_Parms NotifyPlayerRemoved_Parms;
 	NotifyPlayerRemoved_Parms.PlayerIndex = PlayerIndex;
@@ -76,10 +74,9 @@ void UGFxInteraction::NotifyPlayerRemoved ( int PlayerIndex, class ULocalPlayer*
 
 void UGFxInteraction::NotifyPlayerAdded ( int PlayerIndex, class ULocalPlayer* AddedPlayer )
 {
-	static UFunction* pFnNotifyPlayerAdded = NULL;
-
+	UFunction* pFnNotifyPlayerAdded = (UFunction*) SdkBindings::Get ( 2860 );
 	if ( ! pFnNotifyPlayerAdded )
-		pFnNotifyPlayerAdded = (UFunction*) UObject::GObjObjects()->Data[ 34737 ];
+		return;
 
 	UGFxInteraction_execNotifyPlayerAdded_Parms NotifyPlayerAdded_Parms;
 	NotifyPlayerAdded_Parms.PlayerIndex = PlayerIndex;
@@ -98,10 +95,9 @@ void UGFxInteraction::NotifyPlayerAdded ( int PlayerIndex, class ULocalPlayer* A
 
 void UGFxInteraction::NotifyGameSessionEnded ( )
 {
-	static UFunction* pFnNotifyGameSessionEnded = NULL;
-
+	UFunction* pFnNotifyGameSessionEnded = (UFunction*) SdkBindings::Get ( 2859 );
 	if ( ! pFnNotifyGameSessionEnded )
-		pFnNotifyGameSessionEnded = (UFunction*) UObject::GObjObjects()->Data[ 34736 ];
+		return;
 
 	UGFxInteraction_execNotifyGameSessionEnded_Parms NotifyGameSessionEnded_Parms;
 
@@ -119,10 +115,9 @@ void UGFxInteraction::NotifyGameSessionEnded ( )
 
 class UGFxMovie* UGFxInteraction::GetFocusMovie ( )
 {
-	static UFunction* pFnGetFocusMovie = NULL;
-
+	UFunction* pFnGetFocusMovie = (UFunction*) SdkBindings::Get ( 2858 );
 	if ( ! pFnGetFocusMovie )
-		pFnGetFocusMovie = (UFunction*) UObject::GObjObjects()->Data[ 34734 ];
+		return {};
 
 	UGFxInteraction_execGetFocusMovie_Parms GetFocusMovie_Parms;
 
@@ -144,10 +139,9 @@ class UGFxMovie* UGFxInteraction::GetFocusMovie ( )
 
 bool UGFxInteraction::SetFocusMovie ( struct FString MovieName, unsigned long captureInput )
 {
-	static UFunction* pFnSetFocusMovie = NULL;
-
+	UFunction* pFnSetFocusMovie = (UFunction*) SdkBindings::Get ( 2857 );
 	if ( ! pFnSetFocusMovie )
-		pFnSetFocusMovie = (UFunction*) UObject::GObjObjects()->Data[ 34730 ];
+		return {};
 
 	UGFxInteraction_execSetFocusMovie_Parms SetFocusMovie_Parms;
 	memcpy ( &SetFocusMovie_Parms.MovieName, &MovieName, 0xC );
@@ -170,10 +164,9 @@ bool UGFxInteraction::SetFocusMovie ( struct FString MovieName, unsigned long ca
 
 bool UGFxMovie::UnregisterGFxValue ( class UGFxValue* i_val )
 {
-	static UFunction* pFnUnregisterGFxValue = NULL;
-
+	UFunction* pFnUnregisterGFxValue = (UFunction*) SdkBindings::Get ( 2787 );
 	if ( ! pFnUnregisterGFxValue )
-		pFnUnregisterGFxValue = (UFunction*) UObject::GObjObjects()->Data[ 34474 ];
+		return {};
 
 	UGFxMovie_execUnregisterGFxValue_Parms UnregisterGFxValue_Parms;
 	UnregisterGFxValue_Parms.i_val = i_val;
@@ -195,10 +188,9 @@ bool UGFxMovie::UnregisterGFxValue ( class UGFxValue* i_val )
 
 bool UGFxMovie::RegisterGFxValue ( class UGFxValue* i_val )
 {
-	static UFunction* pFnRegisterGFxValue = NULL;
-
+	UFunction* pFnRegisterGFxValue = (UFunction*) SdkBindings::Get ( 2788 );
 	if ( ! pFnRegisterGFxValue )
-		pFnRegisterGFxValue = (UFunction*) UObject::GObjObjects()->Data[ 34475 ];
+		return {};
 
 	UGFxMovie_execRegisterGFxValue_Parms RegisterGFxValue_Parms;
 	RegisterGFxValue_Parms.i_val = i_val;
@@ -220,10 +212,9 @@ bool UGFxMovie::RegisterGFxValue ( class UGFxValue* i_val )
 
 void UGFxMovie::ActionScriptSetFunction ( class UGFxValue* Obj, struct FString member )
 {
-	static UFunction* pFnActionScriptSetFunction = NULL;
-
+	UFunction* pFnActionScriptSetFunction = (UFunction*) SdkBindings::Get ( 2789 );
 	if ( ! pFnActionScriptSetFunction )
-		pFnActionScriptSetFunction = (UFunction*) UObject::GObjObjects()->Data[ 34478 ];
+		return;
 
 	UGFxMovie_execActionScriptSetFunction_Parms ActionScriptSetFunction_Parms;
 	ActionScriptSetFunction_Parms.Obj = Obj;
@@ -244,10 +235,9 @@ void UGFxMovie::ActionScriptSetFunction ( class UGFxValue* Obj, struct FString m
 
 class UGFxValue* UGFxMovie::ActionScriptObject ( struct FString Path )
 {
-	static UFunction* pFnActionScriptObject = NULL;
-
+	UFunction* pFnActionScriptObject = (UFunction*) SdkBindings::Get ( 2790 );
 	if ( ! pFnActionScriptObject )
-		pFnActionScriptObject = (UFunction*) UObject::GObjObjects()->Data[ 34481 ];
+		return {};
 
 	UGFxMovie_execActionScriptObject_Parms ActionScriptObject_Parms;
 	memcpy ( &ActionScriptObject_Parms.Path, &Path, 0xC );
@@ -269,10 +259,9 @@ class UGFxValue* UGFxMovie::ActionScriptObject ( struct FString Path )
 
 struct FString UGFxMovie::ActionScriptString ( struct FString Path )
 {
-	static UFunction* pFnActionScriptString = NULL;
-
+	UFunction* pFnActionScriptString = (UFunction*) SdkBindings::Get ( 2791 );
 	if ( ! pFnActionScriptString )
-		pFnActionScriptString = (UFunction*) UObject::GObjObjects()->Data[ 34484 ];
+		return {};
 
 	UGFxMovie_execActionScriptString_Parms ActionScriptString_Parms;
 	memcpy ( &ActionScriptString_Parms.Path, &Path, 0xC );
@@ -294,10 +283,9 @@ struct FString UGFxMovie::ActionScriptString ( struct FString Path )
 
 float UGFxMovie::ActionScriptFloat ( struct FString Path )
 {
-	static UFunction* pFnActionScriptFloat = NULL;
-
+	UFunction* pFnActionScriptFloat = (UFunction*) SdkBindings::Get ( 2792 );
 	if ( ! pFnActionScriptFloat )
-		pFnActionScriptFloat = (UFunction*) UObject::GObjObjects()->Data[ 34487 ];
+		return {};
 
 	UGFxMovie_execActionScriptFloat_Parms ActionScriptFloat_Parms;
 	memcpy ( &ActionScriptFloat_Parms.Path, &Path, 0xC );
@@ -319,10 +307,9 @@ float UGFxMovie::ActionScriptFloat ( struct FString Path )
 
 int UGFxMovie::ActionScriptInt ( struct FString Path )
 {
-	static UFunction* pFnActionScriptInt = NULL;
-
+	UFunction* pFnActionScriptInt = (UFunction*) SdkBindings::Get ( 2793 );
 	if ( ! pFnActionScriptInt )
-		pFnActionScriptInt = (UFunction*) UObject::GObjObjects()->Data[ 34490 ];
+		return {};
 
 	UGFxMovie_execActionScriptInt_Parms ActionScriptInt_Parms;
 	memcpy ( &ActionScriptInt_Parms.Path, &Path, 0xC );
@@ -343,10 +330,9 @@ int UGFxMovie::ActionScriptInt ( struct FString Path )
 
 void UGFxMovie::ActionScriptVoid ( struct FString Path )
 {
-	static UFunction* pFnActionScriptVoid = NULL;
-
+	UFunction* pFnActionScriptVoid = (UFunction*) SdkBindings::Get ( 2794 );
 	if ( ! pFnActionScriptVoid )
-		pFnActionScriptVoid = (UFunction*) UObject::GObjObjects()->Data[ 34493 ];
+		return;
 
 	UGFxMovie_execActionScriptVoid_Parms ActionScriptVoid_Parms;
 	memcpy ( &ActionScriptVoid_Parms.Path, &Path, 0xC );
@@ -365,10 +351,9 @@ void UGFxMovie::ActionScriptVoid ( struct FString Path )
 
 class APlayerController* UGFxMovie::GetPC ( )
 {
-	static UFunction* pFnGetPC = NULL;
-
+	UFunction* pFnGetPC = (UFunction*) SdkBindings::Get ( 2795 );
 	if ( ! pFnGetPC )
-		pFnGetPC = (UFunction*) UObject::GObjObjects()->Data[ 34496 ];
+		return {};
 
 	UGFxMovie_execGetPC_Parms GetPC_Parms;
 
@@ -388,10 +373,9 @@ class APlayerController* UGFxMovie::GetPC ( )
 
 class ULocalPlayer* UGFxMovie::GetLP ( )
 {
-	static UFunction* pFnGetLP = NULL;
-
+	UFunction* pFnGetLP = (UFunction*) SdkBindings::Get ( 2796 );
 	if ( ! pFnGetLP )
-		pFnGetLP = (UFunction*) UObject::GObjObjects()->Data[ 34498 ];
+		return {};
 
 	UGFxMovie_execGetLP_Parms GetLP_Parms;
 
@@ -411,10 +395,9 @@ class ULocalPlayer* UGFxMovie::GetLP ( )
 
 void UGFxMovie::SetExternalInterface ( class UObject* H )
 {
-	static UFunction* pFnSetExternalInterface = NULL;
-
+	UFunction* pFnSetExternalInterface = (UFunction*) SdkBindings::Get ( 2797 );
 	if ( ! pFnSetExternalInterface )
-		pFnSetExternalInterface = (UFunction*) UObject::GObjObjects()->Data[ 34500 ];
+		return;
 
 	UGFxMovie_execSetExternalInterface_Parms SetExternalInterface_Parms;
 	SetExternalInterface_Parms.H = H;
@@ -429,10 +412,9 @@ void UGFxMovie::SetExternalInterface ( class UObject* H )
 
 void UGFxMovie::SetFsCmdHandler ( class UGFxFSCmdHandler* H )
 {
-	static UFunction* pFnSetFsCmdHandler = NULL;
-
+	UFunction* pFnSetFsCmdHandler = (UFunction*) SdkBindings::Get ( 2798 );
 	if ( ! pFnSetFsCmdHandler )
-		pFnSetFsCmdHandler = (UFunction*) UObject::GObjObjects()->Data[ 34502 ];
+		return;
 
 	UGFxMovie_execSetFsCmdHandler_Parms SetFsCmdHandler_Parms;
 	SetFsCmdHandler_Parms.H = H;
@@ -448,10 +430,9 @@ void UGFxMovie::SetFsCmdHandler ( class UGFxFSCmdHandler* H )
 
 void UGFxMovie::SetVariableObject ( struct FString Path, class UGFxValue* Value )
 {
-	static UFunction* pFnSetVariableObject = NULL;
-
+	UFunction* pFnSetVariableObject = (UFunction*) SdkBindings::Get ( 2799 );
 	if ( ! pFnSetVariableObject )
-		pFnSetVariableObject = (UFunction*) UObject::GObjObjects()->Data[ 34504 ];
+		return;
 
 	UGFxMovie_execSetVariableObject_Parms SetVariableObject_Parms;
 	memcpy ( &SetVariableObject_Parms.Path, &Path, 0xC );
@@ -473,10 +454,9 @@ void UGFxMovie::SetVariableObject ( struct FString Path, class UGFxValue* Value
 
 class UGFxValue* UGFxMovie::GetVariableObject ( struct FString Path, class UClass* Type )
 {
-	static UFunction* pFnGetVariableObject = NULL;
-
+	UFunction* pFnGetVariableObject = (UFunction*) SdkBindings::Get ( 2800 );
 	if ( ! pFnGetVariableObject )
-		pFnGetVariableObject = (UFunction*) UObject::GObjObjects()->Data[ 34506 ];
+		return {};
 
 	UGFxMovie_execGetVariableObject_Parms GetVariableObject_Parms;
 	memcpy ( &GetVariableObject_Parms.Path, &Path, 0xC );
@@ -498,10 +478,9 @@ class UGFxValue* UGFxMovie::GetVariableObject ( struct FString Path, class UClas
 
 class UGFxValue* UGFxMovie::CreateArray ( )
 {
-	static UFunction* pFnCreateArray = NULL;
-
+	UFunction* pFnCreateArray = (UFunction*) SdkBindings::Get ( 2801 );
 	if ( ! pFnCreateArray )
-		pFnCreateArray = (UFunction*) UObject::GObjObjects()->Data[ 34509 ];
+		return {};
 
 	UGFxMovie_execCreateArray_Parms CreateArray_Parms;
 
@@ -523,10 +502,9 @@ class UGFxValue* UGFxMovie::CreateArray ( )
 
 class UGFxValue* UGFxMovie::CreateObject ( struct FString ASClass, class UClass* Type )
 {
-	static UFunction* pFnCreateObject = NULL;
-
+	UFunction* pFnCreateObject = (UFunction*) SdkBindings::Get ( 2802 );
 	if ( ! pFnCreateObject )
-		pFnCreateObject = (UFunction*) UObject::GObjObjects()->Data[ 34513 ];
+		return {};
 
 	UGFxMovie_execCreateObject_Parms CreateObject_Parms;
 	memcpy ( &CreateObject_Parms.ASClass, &ASClass, 0xC );
@@ -551,10 +529,9 @@ class UGFxValue* UGFxMovie::CreateObject ( struct FString ASClass, class UClass*
 
 bool UGFxMovie::SetVariableStringArray ( struct FString Path, int Index, TArray< struct FString > Arg )
 {
-	static UFunction* pFnSetVariableStringArray = NULL;
-
+	UFunction* pFnSetVariableStringArray = (UFunction*) SdkBindings::Get ( 2803 );
 	if ( ! pFnSetVariableStringArray )
-		pFnSetVariableStringArray = (UFunction*) UObject::GObjObjects()->Data[ 34515 ];
+		return {};
 
 	UGFxMovie_execSetVariableStringArray_Parms SetVariableStringArray_Parms;
 	memcpy ( &SetVariableStringArray_Parms.Path, &Path, 0xC );
@@ -580,10 +557,9 @@ bool UGFxMovie::SetVariableStringArray ( struct FString Path, int Index, TArray<
 
 bool UGFxMovie::SetVariableFloatArray ( struct FString Path, int Index, TArray< float > Arg )
 {
-	static UFunction* pFnSetVariableFloatArray = NULL;
-
+	UFunction* pFnSetVariableFloatArray = (UFunction*) SdkBindings::Get ( 2804 );
 	if ( ! pFnSetVariableFloatArray )
-		pFnSetVariableFloatArray = (UFunction*) UObject::GObjObjects()->Data[ 34519 ];
+		return {};
 
 	UGFxMovie_execSetVariableFloatArray_Parms SetVariableFloatArray_Parms;
 	memcpy ( &SetVariableFloatArray_Parms.Path, &Path, 0xC );
@@ -609,10 +585,9 @@ bool UGFxMovie::SetVariableFloatArray ( struct FString Path, int Index, TArray<
 
 bool UGFxMovie::SetVariableIntArray ( struct FString Path, int Index, TArray< int > Arg )
 {
-	static UFunction* pFnSetVariableIntArray = NULL;
-
+	UFunction* pFnSetVariableIntArray = (UFunction*) SdkBindings::Get ( 2805 );
 	if ( ! pFnSetVariableIntArray )
-		pFnSetVariableIntArray = (UFunction*) UObject::GObjObjects()->Data[ 34525 ];
+		return {};
 
 	UGFxMovie_execSetVariableIntArray_Parms SetVariableIntArray_Parms;
 	memcpy ( &SetVariableIntArray_Parms.Path, &Path, 0xC );
@@ -638,10 +613,9 @@ bool UGFxMovie::SetVariableIntArray ( struct FString Path, int Index, TArray< in
 
 bool UGFxMovie::SetVariableArray ( struct FString Path, int Index, TArray< struct FASValue > Arg )
 {
-	static UFunction* pFnSetVariableArray = NULL;
-
+	UFunction* pFnSetVariableArray = (UFunction*) SdkBindings::Get ( 2806 );
 	if ( ! pFnSetVariableArray )
-		pFnSetVariableArray = (UFunction*) UObject::GObjObjects()->Data[ 34531 ];
+		return {};
 
 	UGFxMovie_execSetVariableArray_Parms SetVariableArray_Parms;
 	memcpy ( &SetVariableArray_Parms.Path, &Path, 0xC );
@@ -667,10 +641,9 @@ bool UGFxMovie::SetVariableArray ( struct FString Path, int Index, TArray< struc
 
 bool UGFxMovie::GetVariableStringArray ( struct FString Path, int Index, TArray< struct FString >* Arg )
 {
-	static UFunction* pFnGetVariableStringArray = NULL;
-
+	UFunction* pFnGetVariableStringArray = (UFunction*) SdkBindings::Get ( 2807 );
 	if ( ! pFnGetVariableStringArray )
-		pFnGetVariableStringArray = (UFunction*) UObject::GObjObjects()->Data[ 34537 ];
+		return {};
 
 	UGFxMovie_execGetVariableStringArray_Parms GetVariableStringArray_Parms;
 	memcpy ( &GetVariableStringArray_Parms.Path, &Path, 0xC );
@@ -698,10 +671,9 @@ bool UGFxMovie::GetVariableStringArray ( struct FString Path, int Index, TArray<
 
 bool UGFxMovie::GetVariableFloatArray ( struct FString Path, int Index, TArray< float >* Arg )
 {
-	static UFunction* pFnGetVariableFloatArray = NULL;
-
+	UFunction* pFnGetVariableFloatArray = (UFunction*) SdkBindings::Get ( 2808 );
 	if ( ! pFnGetVariableFloatArray )
-		pFnGetVariableFloatArray = (UFunction*) UObject::GObjObjects()->Data[ 34549 ];
+		return {};
 
 	UGFxMovie_execGetVariableFloatArray_Parms GetVariableFloatArray_Parms;
 	memcpy ( &GetVariableFloatArray_Parms.Path, &Path, 0xC );
@@ -729,10 +701,9 @@ bool UGFxMovie::GetVariableFloatArray ( struct FString Path, int Index, TArray<
 
 bool UGFxMovie::GetVariableIntArray ( struct FString Path, int Index, TArray< int >* Arg )
 {
-	static UFunction* pFnGetVariableIntArray = NULL;
-
+	UFunction* pFnGetVariableIntArray = (UFunction*) SdkBindings::Get ( 2809 );
 	if ( ! pFnGetVariableIntArray )
-		pFnGetVariableIntArray = (UFunction*) UObject::GObjObjects()->Data[ 34555 ];
+		return {};
 
 	UGFxMovie_execGetVariableIntArray_Parms GetVariableIntArray_Parms;
 	memcpy ( &GetVariableIntArray_Parms.Path, &Path, 0xC );
@@ -760,10 +731,9 @@ bool UGFxMovie::GetVariableIntArray ( struct FString Path, int Index, TArray< in
 
 bool UGFxMovie::GetVariableArray ( struct FString Path, int Index, TArray< struct FASValue >* Arg )
 {
-	static UFunction* pFnGetVariableArray = NULL;
-
+	UFunction* pFnGetVariableArray = (UFunction*) SdkBindings::Get ( 2810 );
 	if ( ! pFnGetVariableArray )
-		pFnGetVariableArray = (UFunction*) UObject::GObjObjects()->Data[ 34561 ];
+		return {};
 
 	UGFxMovie_execGetVariableArray_Parms GetVariableArray_Parms;
 	memcpy ( &GetVariableArray_Parms.Path, &Path, 0xC );
@@ -789,10 +759,9 @@ bool UGFxMovie::GetVariableArray ( struct FString Path, int Index, TArray< struc
 
 void UGFxMovie::SetVariableString ( struct FString Path, struct FString S )
 {
-	static UFunction* pFnSetVariableString = NULL;
-
+	UFunction* pFnSetVariableString = (UFunction*) SdkBindings::Get ( 2811 );
 	if ( ! pFnSetVariableString )
-		pFnSetVariableString = (UFunction*) UObject::GObjObjects()->Data[ 34567 ];
+		return;
 
 	UGFxMovie_execSetVariableString_Parms SetVariableString_Parms;
 	memcpy ( &SetVariableString_Parms.Path, &Path, 0xC );
@@ -813,10 +782,9 @@ void UGFxMovie::SetVariableString ( struct FString Path, struct FString S )
 
 void UGFxMovie::SetVariableNumber ( struct FString Path, float F )
 {
-	static UFunction* pFnSetVariableNumber = NULL;
-
+	UFunction* pFnSetVariableNumber = (UFunction*) SdkBindings::Get ( 2812 );
 	if ( ! pFnSetVariableNumber )
-		pFnSetVariableNumber = (UFunction*) UObject::GObjObjects()->Data[ 34573 ];
+		return;
 
 	UGFxMovie_execSetVariableNumber_Parms SetVariableNumber_Parms;
 	memcpy ( &SetVariableNumber_Parms.Path, &Path, 0xC );
@@ -837,10 +805,9 @@ void UGFxMovie::SetVariableNumber ( struct FString Path, float F )
 
 void UGFxMovie::SetVariableBool ( struct FString Path, unsigned long B )
 {
-	static UFunction* pFnSetVariableBool = NULL;
-
+	UFunction* pFnSetVariableBool = (UFunction*) SdkBindings::Get ( 2813 );
 	if ( ! pFnSetVariableBool )
-		pFnSetVariableBool = (UFunction*) UObject::GObjObjects()->Data[ 34576 ];
+		return;
 
 	UGFxMovie_execSetVariableBool_Parms SetVariableBool_Parms;
 	memcpy ( &SetVariableBool_Parms.Path, &Path, 0xC );
@@ -861,10 +828,9 @@ void UGFxMovie::SetVariableBool ( struct FString Path, unsigned long B )
 
 void UGFxMovie::SetVariable ( struct FString Path, struct FASValue Arg )
 {
-	static UFunction* pFnSetVariable = NULL;
-
+	UFunction* pFnSetVariable = (UFunction*) SdkBindings::Get ( 2814 );
 	if ( ! pFnSetVariable )
-		pFnSetVariable = (UFunction*) UObject::GObjObjects()->Data[ 34579 ];
+		return;
 
 	UGFxMovie_execSetVariable_Parms SetVariable_Parms;
 	memcpy ( &SetVariable_Parms.Path, &Path, 0xC );
@@ -885,10 +851,9 @@ void UGFxMovie::SetVariable ( struct FString Path, struct FASValue Arg )
 
 struct FString UGFxMovie::GetVariableString ( struct FString Path )
 {
-	static UFunction* pFnGetVariableString = NULL;
-
+	UFunction* pFnGetVariableString = (UFunction*) SdkBindings::Get ( 2815 );
 	if ( ! pFnGetVariableString )
-		pFnGetVariableString = (UFunction*) UObject::GObjObjects()->Data[ 34582 ];
+		return {};
 
 	UGFxMovie_execGetVariableString_Parms GetVariableString_Parms;
 	memcpy ( &GetVariableString_Parms.Path, &Path, 0xC );
@@ -910,10 +875,9 @@ struct FString UGFxMovie::GetVariableString ( struct FString Path )
 
 float UGFxMovie::GetVariableNumber ( struct FString Path )
 {
-	static UFunction* pFnGetVariableNumber = NULL;
-
+	UFunction* pFnGetVariableNumber = (UFunction*) SdkBindings::Get ( 2816 );
 	if ( ! pFnGetVariableNumber )
-		pFnGetVariableNumber = (UFunction*) UObject::GObjObjects()->Data[ 34585 ];
+		return {};
 
 	UGFxMovie_execGetVariableNumber_Parms GetVariableNumber_Parms;
 	memcpy ( &GetVariableNumber_Parms.Path, &Path, 0xC );
@@ -935,10 +899,9 @@ float UGFxMovie::GetVariableNumber ( struct FString Path )
 
 bool UGFxMovie::GetVariableBool ( struct FString Path )
 {
-	static UFunction* pFnGetVariableBool = NULL;
-
+	UFunction* pFnGetVariableBool = (UFunction*) SdkBindings::Get ( 2817 );
 	if ( ! pFnGetVariableBool )
-		pFnGetVariableBool = (UFunction*) UObject::GObjObjects()->Data[ 34588 ];
+		return {};
 
 	UGFxMovie_execGetVariableBool_Parms GetVariableBool_Parms;
 	memcpy ( &GetVariableBool_Parms.Path, &Path, 0xC );
@@ -960,10 +923,9 @@ bool UGFxMovie::GetVariableBool ( struct FString Path )
 
 struct FASValue UGFxMovie::GetVariable ( struct FString Path )
 {
-	static UFunction* pFnGetVariable = NULL;
-
+	UFunction* pFnGetVariable = (UFunction*) SdkBindings::Get ( 2818 );
 	if ( ! pFnGetVariable )
-		pFnGetVariable = (UFunction*) UObject::GObjObjects()->Data[ 34591 ];
+		return {};
 
 	UGFxMovie_execGetVariable_Parms GetVariable_Parms;
 	memcpy ( &GetVariable_Parms.Path, &Path, 0xC );
@@ -983,10 +945,9 @@ struct FASValue UGFxMovie::GetVariable ( struct FString Path )
 
 void UGFxMovie::PublishDataStoreValues ( )
 {
-	static UFunction* pFnPublishDataStoreValues = NULL;
-
+	UFunction* pFnPublishDataStoreValues = (UFunction*) SdkBindings::Get ( 2819 );
 	if ( ! pFnPublishDataStoreValues )
-		pFnPublishDataStoreValues = (UFunction*) UObject::GObjObjects()->Data[ 34594 ];
+		return;
 
 	UGFxMovie_execPublishDataStoreValues_Parms PublishDataStoreValues_Parms;
 
@@ -1003,10 +964,9 @@ void UGFxMovie::PublishDataStoreValues ( )
 
 void UGFxMovie::RefreshDataStoreBindings ( )
 {
-	static UFunction* pFnRefreshDataStoreBindings = NULL;
-
+	UFunction* pFnRefreshDataStoreBindings = (UFunction*) SdkBindings::Get ( 2820 );
 	if ( ! pFnRefreshDataStoreBindings )
-		pFnRefreshDataStoreBindings = (UFunction*) UObject::GObjObjects()->Data[ 34597 ];
+		return;
 
 	UGFxMovie_execRefreshDataStoreBindings_Parms RefreshDataStoreBindings_Parms;
 
@@ -1026,10 +986,9 @@ void UGFxMovie::RefreshDataStoreBindings ( )
 
 struct FASValue UGFxMovie::Invoke ( struct FString method, TArray< struct FASValue >* Args )
 {
-	static UFunction* pFnInvoke = NULL;
-
+	UFunction* pFnInvoke = (UFunction*) SdkBindings::Get ( 2821 );
 	if ( ! pFnInvoke )
-		pFnInvoke = (UFunction*) UObject::GObjObjects()->Data[ 34598 ];
+		return {};
 
 	UGFxMovie_execInvoke_Parms Invoke_Parms;
 	memcpy ( &Invoke_Parms.method, &method, 0xC );
@@ -1053,10 +1012,9 @@ struct FASValue UGFxMovie::Invoke ( struct FString method, TArray< struct FASVal
 
 void UGFxMovie::SetTimingMode ( unsigned char mode )
 {
-	static UFunction* pFnSetTimingMode = NULL;
-
+	UFunction* pFnSetTimingMode = (UFunction*) SdkBindings::Get ( 2822 );
 	if ( ! pFnSetTimingMode )
-		pFnSetTimingMode = (UFunction*) UObject::GObjObjects()->Data[ 34599 ];
+		return;
 
 	UGFxMovie_execSetTimingMode_Parms SetTimingMode_Parms;
 	SetTimingMode_Parms.mode = mode;
@@ -1075,10 +1033,9 @@ void UGFxMovie::SetTimingMode ( unsigned char mode )
 
 void UGFxMovie::Pause ( unsigned long pauseplay )
 {
-	static UFunction* pFnPause = NULL;
-
+	UFunction* pFnPause = (UFunction*) SdkBindings::Get ( 2823 );
 	if ( ! pFnPause )
-		pFnPause = (UFunction*) UObject::GObjObjects()->Data[ 34604 ];
+		return;
 
 	UGFxMovie_execPause_Parms Pause_Parms;
 	Pause_Parms.pauseplay = pauseplay;
@@ -1097,10 +1054,9 @@ void UGFxMovie::Pause ( unsigned long pauseplay )
 
 void UGFxMovie::Advance ( float Time )
 {
-	static UFunction* pFnAdvance = NULL;
-
+	UFunction* pFnAdvance = (UFunction*) SdkBindings::Get ( 2824 );
 	if ( ! pFnAdvance )
-		pFnAdvance = (UFunction*) UObject::GObjObjects()->Data[ 34606 ];
+		return;
 
 	UGFxMovie_execAdvance_Parms Advance_Parms;
 	Advance_Parms.Time = Time;
@@ -1121,10 +1077,9 @@ void UGFxMovie::Advance ( float Time )
 
 bool UGFxMovie::SetExternalTexture ( struct FString Resource, class UTexture* Texture )
 {
-	static UFunction* pFnSetExternalTexture = NULL;
-
+	UFunction* pFnSetExternalTexture = (UFunction*) SdkBindings::Get ( 2825 );
 	if ( ! pFnSetExternalTexture )
-		pFnSetExternalTexture = (UFunction*) UObject::GObjObjects()->Data[ 34608 ];
+		return {};
 
 	UGFxMovie_execSetExternalTexture_Parms SetExternalTexture_Parms;
 	memcpy ( &SetExternalTexture_Parms.Resource, &Resource, 0xC );
@@ -1146,10 +1101,9 @@ bool UGFxMovie::SetExternalTexture ( struct FString Resource, class UTexture* Te
 
 void UGFxMovie::FlushPlayerInput ( unsigned long capturekeysonly )
 {
-	static UFunction* pFnFlushPlayerInput = NULL;
-
+	UFunction* pFnFlushPlayerInput = (UFunction*) SdkBindings::Get ( 2826 );
 	if ( ! pFnFlushPlayerInput )
-		pFnFlushPlayerInput = (UFunction*) UObject::GObjObjects()->Data[ 34610 ];
+		return;
 
 	UGFxMovie_execFlushPlayerInput_Parms FlushPlayerInput_Parms;
 	FlushPlayerInput_Parms.capturekeysonly = capturekeysonly;
@@ -1167,10 +1121,9 @@ void UGFxMovie::FlushPlayerInput ( unsigned long capturekeysonly )
 
 void UGFxMovie::ClearFocusIgnoreKeys ( )
 {
-	static UFunction* pFnClearFocusIgnoreKeys = NULL;
-
+	UFunction* pFnClearFocusIgnoreKeys = (UFunction*) SdkBindings::Get ( 2827 );
 	if ( ! pFnClearFocusIgnoreKeys )
-		pFnClearFocusIgnoreKeys = (UFunction*) UObject::GObjObjects()->Data[ 34614 ];
+		return;
 
 	UGFxMovie_execClearFocusIgnoreKeys_Parms ClearFocusIgnoreKeys_Parms;
 
@@ -1188,10 +1141,9 @@ void UGFxMovie::ClearFocusIgnoreKeys ( )
 
 void UGFxMovie::AddFocusIgnoreKey ( struct FName Key )
 {
-	static UFunction* pFnAddFocusIgnoreKey = NULL;
-
+	UFunction* pFnAddFocusIgnoreKey = (UFunction*) SdkBindings::Get ( 2828 );
 	if ( ! pFnAddFocusIgnoreKey )
-		pFnAddFocusIgnoreKey = (UFunction*) UObject::GObjObjects()->Data[ 34616 ];
+		return;
 
 	UGFxMovie_execAddFocusIgnoreKey_Parms AddFocusIgnoreKey_Parms;
 	memcpy ( &AddFocusIgnoreKey_Parms.Key, &Key, 0x8 );
@@ -1209,10 +1161,9 @@ void UGFxMovie::AddFocusIgnoreKey ( struct FName Key )
 
 void UGFxMovie::ClearCaptureKeys ( )
 {
-	static UFunction* pFnClearCaptureKeys = NULL;
-
+	UFunction* pFnClearCaptureKeys = (UFunction*) SdkBindings::Get ( 2829 );
 	if ( ! pFnClearCaptureKeys )
-		pFnClearCaptureKeys = (UFunction*) UObject::GObjObjects()->Data[ 34617 ];
+		return;
 
 	UGFxMovie_execClearCaptureKeys_Parms ClearCaptureKeys_Parms;
 
@@ -1230,10 +1181,9 @@ void UGFxMovie::ClearCaptureKeys ( )
 
 void UGFxMovie::AddCaptureKey ( struct FName Key )
 {
-	static UFunction* pFnAddCaptureKey = NULL;
-
+	UFunction* pFnAddCaptureKey = (UFunction*) SdkBindings::Get ( 2830 );
 	if ( ! pFnAddCaptureKey )
-		pFnAddCaptureKey = (UFunction*) UObject::GObjObjects()->Data[ 34619 ];
+		return;
 
 	UGFxMovie_execAddCaptureKey_Parms AddCaptureKey_Parms;
 	memcpy ( &AddCaptureKey_Parms.Key, &Key, 0x8 );
@@ -1253,10 +1203,9 @@ void UGFxMovie::AddCaptureKey ( struct FName Key )
 
 void UGFxMovie::SetFocus ( unsigned long captureInput, unsigned long Focus )
 {
-	static UFunction* pFnSetFocus = NULL;
-
+	UFunction* pFnSetFocus = (UFunction*) SdkBindings::Get ( 2831 );
 	if ( ! pFnSetFocus )
-		pFnSetFocus = (UFunction*) UObject::GObjObjects()->Data[ 34620 ];
+		return;
 
 	UGFxMovie_execSetFocus_Parms SetFocus_Parms;
 	SetFocus_Parms.captureInput = captureInput;
@@ -1276,10 +1225,9 @@ void UGFxMovie::SetFocus ( unsigned long captureInput, unsigned long Focus )
 
 void UGFxMovie::SetSceneDPG ( unsigned char NewDPG )
 {
-	static UFunction* pFnSetSceneDPG = NULL;
-
+	UFunction* pFnSetSceneDPG = (UFunction*) SdkBindings::Get ( 2832 );
 	if ( ! pFnSetSceneDPG )
-		pFnSetSceneDPG = (UFunction*) UObject::GObjObjects()->Data[ 34622 ];
+		return;
 
 	UGFxMovie_execSetSceneDPG_Parms SetSceneDPG_Parms;
 	SetSceneDPG_Parms.NewDPG = NewDPG;
@@ -1298,10 +1246,9 @@ void UGFxMovie::SetSceneDPG ( unsigned char NewDPG )
 
 void UGFxMovie::SetPerspective3D ( struct FMatrix* matPersp )
 {
-	static UFunction* pFnSetPerspective3D = NULL;
-
+	UFunction* pFnSetPerspective3D = (UFunction*) SdkBindings::Get ( 2833 );
 	if ( ! pFnSetPerspective3D )
-		pFnSetPerspective3D = (UFunction*) UObject::GObjObjects()->Data[ 34625 ];
+		return;
 
 	UGFxMovie_execSetPerspective3D_Parms SetPerspective3D_Parms;
 
@@ -1322,10 +1269,9 @@ void UGFxMovie::SetPerspective3D ( struct FMatrix* matPersp )
 
 void UGFxMovie::SetView3D ( struct FMatrix* matView )
 {
-	static UFunction* pFnSetView3D = NULL;
-
+	UFunction* pFnSetView3D = (UFunction*) SdkBindings::Get ( 2834 );
 	if ( ! pFnSetView3D )
-		pFnSetView3D = (UFunction*) UObject::GObjObjects()->Data[ 34627 ];
+		return;
 
 	UGFxMovie_execSetView3D_Parms SetView3D_Parms;
 
@@ -1349,10 +1295,9 @@ void UGFxMovie::SetView3D ( struct FMatrix* matView )
 
 void UGFxMovie::GetVisibleFrameRect ( float* x0, float* y0, float* X1, float* Y1 )
 {
-	static UFunction* pFnGetVisibleFrameRect = NULL;
-
+	UFunction* pFnGetVisibleFrameRect = (UFunction*) SdkBindings::Get ( 2835 );
 	if ( ! pFnGetVisibleFrameRect )
-		pFnGetVisibleFrameRect = (UFunction*) UObject::GObjObjects()->Data[ 34629 ];
+		return;
 
 	UGFxMovie_execGetVisibleFrameRect_Parms GetVisibleFrameRect_Parms;
 
@@ -1382,10 +1327,9 @@ void UGFxMovie::GetVisibleFrameRect ( float* x0, float* y0, float* X1, float* Y1
 
 void UGFxMovie::SetAlignment ( unsigned char A )
 {
-	static UFunction* pFnSetAlignment = NULL;
-
+	UFunction* pFnSetAlignment = (UFunction*) SdkBindings::Get ( 2836 );
 	if ( ! pFnSetAlignment )
-		pFnSetAlignment = (UFunction*) UObject::GObjObjects()->Data[ 34631 ];
+		return;
 
 	UGFxMovie_execSetAlignment_Parms SetAlignment_Parms;
 	SetAlignment_Parms.A = A;
@@ -1404,10 +1348,9 @@ void UGFxMovie::SetAlignment ( unsigned char A )
 
 void UGFxMovie::SetViewScaleMode ( unsigned char sm )
 {
-	static UFunction* pFnSetViewScaleMode = NULL;
-
+	UFunction* pFnSetViewScaleMode = (UFunction*) SdkBindings::Get ( 2837 );
 	if ( ! pFnSetViewScaleMode )
-		pFnSetViewScaleMode = (UFunction*) UObject::GObjObjects()->Data[ 34636 ];
+		return;
 
 	UGFxMovie_execSetViewScaleMode_Parms SetViewScaleMode_Parms;
 	SetViewScaleMode_Parms.sm = sm;
@@ -1429,10 +1372,9 @@ void UGFxMovie::SetViewScaleMode ( unsigned char sm )
 
 void UGFxMovie::SetViewport ( int X, int Y, int Width, int Height )
 {
-	static UFunction* pFnSetViewport = NULL;
-
+	UFunction* pFnSetViewport = (UFunction*) SdkBindings::Get ( 2838 );
 	if ( ! pFnSetViewport )
-		pFnSetViewport = (UFunction*) UObject::GObjObjects()->Data[ 34640 ];
+		return;
 
 	UGFxMovie_execSetViewport_Parms SetViewport_Parms;
 	SetViewport_Parms.X = X;
@@ -1454,10 +1396,9 @@ void UGFxMovie::SetViewport ( int X, int Y, int Width, int Height )
 
 class UGameViewportClient* UGFxMovie::GetGameViewportClient ( )
 {
-	static UFunction* pFnGetGameViewportClient = NULL;
-
+	UFunction* pFnGetGameViewportClient = (UFunction*) SdkBindings::Get ( 2839 );
 	if ( ! pFnGetGameViewportClient )
-		pFnGetGameViewportClient = (UFunction*) UObject::GObjObjects()->Data[ 34642 ];
+		return {};
 
 	UGFxMovie_execGetGameViewportClient_Parms GetGameViewportClient_Parms;
 
@@ -1477,10 +1418,9 @@ class UGameViewportClient* UGFxMovie::GetGameViewportClient ( )
 
 void UGFxMovie::SetMovieInfo ( class UGFxMovieInfo* Data )
 {
-	static UFunction* pFnSetMovieInfo = NULL;
-
+	UFunction* pFnSetMovieInfo = (UFunction*) SdkBindings::Get ( 2840 );
 	if ( ! pFnSetMovieInfo )
-		pFnSetMovieInfo = (UFunction*) UObject::GObjObjects()->Data[ 34647 ];
+		return;
 
 	UGFxMovie_execSetMovieInfo_Parms SetMovieInfo_Parms;
 	SetMovieInfo_Parms.Data = Data;
@@ -1494,10 +1434,9 @@ void UGFxMovie::SetMovieInfo ( class UGFxMovieInfo* Data )
 
 void UGFxMovie::eventOnClose ( )
 {
-	static UFunction* pFnOnClose = NULL;
-
+	UFunction* pFnOnClose = (UFunction*) SdkBindings::Get ( 2841 );
 	if ( ! pFnOnClose )
-		pFnOnClose = (UFunction*) UObject::GObjObjects()->Data[ 34649 ];
+		return;
 
 	UGFxMovie_eventOnClose_Parms OnClose_Parms;
 
@@ -1511,10 +1450,9 @@ void UGFxMovie::eventOnClose ( )
 
 void UGFxMovie::Close ( unsigned long Unload )
 {
-	static UFunction* pFnClose = NULL;
-
+	UFunction* pFnClose = (UFunction*) SdkBindings::Get ( 2842 );
 	if ( ! pFnClose )
-		pFnClose = (UFunction*) UObject::GObjObjects()->Data[ 34651 ];
+		return;
 
 	UGFxMovie_execClose_Parms Close_Parms;
 	Close_Parms.Unload = Unload;
@@ -1534,10 +1472,9 @@ void UGFxMovie::Close ( unsigned long Unload )
 
 bool UGFxMovie::eventStart ( unsigned long StartPaused )
 {
-	static UFunction* pFnStart = NULL;
-
+	UFunction* pFnStart = (UFunction*) SdkBindings::Get ( 2843 );
 	if ( ! pFnStart )
-		pFnStart = (UFunction*) UObject::GObjObjects()->Data[ 34652 ];
+		return {};
 
 	UGFxMovie_eventStart_Parms Start_Parms;
 	Start_Parms.StartPaused = StartPaused;
@@ -1559,10 +1496,9 @@ bool UGFxMovie::eventStart ( unsigned long StartPaused )
 
 void UGFxValue::ActionScriptSetFunctionOn ( class UGFxValue* Target, struct FString member )
 {
-	static UFunction* pFnActionScriptSetFunctionOn = NULL;
-
+	UFunction* pFnActionScriptSetFunctionOn = (UFunction*) SdkBindings::Get ( 2928 );
 	if ( ! pFnActionScriptSetFunctionOn )
-		pFnActionScriptSetFunctionOn = (UFunction*) UObject::GObjObjects()->Data[ 34987 ];
+		return;
 
 	UGFxValue_execActionScriptSetFunctionOn_Parms ActionScriptSetFunctionOn_Parms;
 	ActionScriptSetFunctionOn_Parms.Target = Target;
@@ -1582,10 +1518,9 @@ void UGFxValue::ActionScriptSetFunctionOn ( class UGFxValue* Target, struct FStr
 
 void UGFxValue::ActionScriptSetFunction ( struct FString member )
 {
-	static UFunction* pFnActionScriptSetFunction = NULL;
-
+	UFunction* pFnActionScriptSetFunction = (UFunction*) SdkBindings::Get ( 2927 );
 	if ( ! pFnActionScriptSetFunction )
-		pFnActionScriptSetFunction = (UFunction*) UObject::GObjObjects()->Data[ 34985 ];
+		return;
 
 	UGFxValue_execActionScriptSetFunction_Parms ActionScriptSetFunction_Parms;
 	memcpy ( &ActionScriptSetFunction_Parms.member, &member, 0xC );
@@ -1605,10 +1540,9 @@ void UGFxValue::ActionScriptSetFunction ( struct FString member )
 
 TArray< class UGFxValue* > UGFxValue::ActionScriptArray ( struct FString Path )
 {
-	static UFunction* pFnActionScriptArray = NULL;
-
+	UFunction* pFnActionScriptArray = (UFunction*) SdkBindings::Get ( 2926 );
 	if ( ! pFnActionScriptArray )
-		pFnActionScriptArray = (UFunction*) UObject::GObjObjects()->Data[ 34981 ];
+		return {};
 
 	UGFxValue_execActionScriptArray_Parms ActionScriptArray_Parms;
 	memcpy ( &ActionScriptArray_Parms.Path, &Path, 0xC );
@@ -1630,10 +1564,9 @@ TArray< class UGFxValue* > UGFxValue::ActionScriptArray ( struct FString Path )
 
 class UGFxValue* UGFxValue::ActionScriptObject ( struct FString Path )
 {
-	static UFunction* pFnActionScriptObject = NULL;
-
+	UFunction* pFnActionScriptObject = (UFunction*) SdkBindings::Get ( 2925 );
 	if ( ! pFnActionScriptObject )
-		pFnActionScriptObject = (UFunction*) UObject::GObjObjects()->Data[ 34978 ];
+		return {};
 
 	UGFxValue_execActionScriptObject_Parms ActionScriptObject_Parms;
 	memcpy ( &ActionScriptObject_Parms.Path, &Path, 0xC );
@@ -1655,10 +1588,9 @@ class UGFxValue* UGFxValue::ActionScriptObject ( struct FString Path )
 
 struct FString UGFxValue::ActionScriptString ( struct FString method )
 {
-	static UFunction* pFnActionScriptString = NULL;
-
+	UFunction* pFnActionScriptString = (UFunction*) SdkBindings::Get ( 2924 );
 	if ( ! pFnActionScriptString )
-		pFnActionScriptString = (UFunction*) UObject::GObjObjects()->Data[ 34975 ];
+		return {};
 
 	UGFxValue_execActionScriptString_Parms ActionScriptString_Parms;
 	memcpy ( &ActionScriptString_Parms.method, &method, 0xC );
@@ -1680,10 +1612,9 @@ struct FString UGFxValue::ActionScriptString ( struct FString method )
 
 float UGFxValue::ActionScriptFloat ( struct FString method )
 {
-	static UFunction* pFnActionScriptFloat = NULL;
-
+	UFunction* pFnActionScriptFloat = (UFunction*) SdkBindings::Get ( 2923 );
 	if ( ! pFnActionScriptFloat )
-		pFnActionScriptFloat = (UFunction*) UObject::GObjObjects()->Data[ 34972 ];
+		return {};
 
 	UGFxValue_execActionScriptFloat_Parms ActionScriptFloat_Parms;
 	memcpy ( &ActionScriptFloat_Parms.method, &method, 0xC );
@@ -1705,10 +1636,9 @@ float UGFxValue::ActionScriptFloat ( struct FString method )
 
 int UGFxValue::ActionScriptInt ( struct FString method )
 {
-	static UFunction* pFnActionScriptInt = NULL;
-
+	UFunction* pFnActionScriptInt = (UFunction*) SdkBindings::Get ( 2922 );
 	if ( ! pFnActionScriptInt )
-		pFnActionScriptInt = (UFunction*) UObject::GObjObjects()->Data[ 34969 ];
+		return {};
 
 	UGFxValue_execActionScriptInt_Parms ActionScriptInt_Parms;
 	memcpy ( &ActionScriptInt_Parms.method, &method, 0xC );
@@ -1729,10 +1659,9 @@ int UGFxValue::ActionScriptInt ( struct FString method )
 
 void UGFxValue::ActionScriptVoid ( struct FString method )
 {
-	static UFunction* pFnActionScriptVoid = NULL;
-
+	UFunction* pFnActionScriptVoid = (UFunction*) SdkBindings::Get ( 2921 );
 	if ( ! pFnActionScriptVoid )
-		pFnActionScriptVoid = (UFunction*) UObject::GObjObjects()->Data[ 34967 ];
+		return;
 
 	UGFxValue_execActionScriptVoid_Parms ActionScriptVoid_Parms;
 	memcpy ( &ActionScriptVoid_Parms.method, &method, 0xC );
@@ -1753,10 +1682,9 @@ void UGFxValue::ActionScriptVoid ( struct FString method )
 
 void UGFxValue::SetElementMemberString ( int Index, struct FString member, struct FString S )
 {
-	static UFunction* pFnSetElementMemberString = NULL;
-
+	UFunction* pFnSetElementMemberString = (UFunction*) SdkBindings::Get ( 2920 );
 	if ( ! pFnSetElementMemberString )
-		pFnSetElementMemberString = (UFunction*) UObject::GObjObjects()->Data[ 34963 ];
+		return;
 
 	UGFxValue_execSetElementMemberString_Parms SetElementMemberString_Parms;
 	SetElementMemberString_Parms.Index = Index;
@@ -1779,10 +1707,9 @@ void UGFxValue::SetElementMemberString ( int Index, struct FString member, struc
 
 void UGFxValue::SetElementMemberNumber ( int Index, struct FString member, float F )
 {
-	static UFunction* pFnSetElementMemberNumber = NULL;
-
+	UFunction* pFnSetElementMemberNumber = (UFunction*) SdkBindings::Get ( 2919 );
 	if ( ! pFnSetElementMemberNumber )
-		pFnSetElementMemberNumber = (UFunction*) UObject::GObjObjects()->Data[ 34959 ];
+		return;
 
 	UGFxValue_execSetElementMemberNumber_Parms SetElementMemberNumber_Parms;
 	SetElementMemberNumber_Parms.Index = Index;
@@ -1805,10 +1732,9 @@ void UGFxValue::SetElementMemberNumber ( int Index, struct FString member, float
 
 void UGFxValue::SetElementMemberBool ( int Index, struct FString member, unsigned long B )
 {
-	static UFunction* pFnSetElementMemberBool = NULL;
-
+	UFunction* pFnSetElementMemberBool = (UFunction*) SdkBindings::Get ( 2918 );
 	if ( ! pFnSetElementMemberBool )
-		pFnSetElementMemberBool = (UFunction*) UObject::GObjObjects()->Data[ 34955 ];
+		return;
 
 	UGFxValue_execSetElementMemberBool_Parms SetElementMemberBool_Parms;
 	SetElementMemberBool_Parms.Index = Index;
@@ -1831,10 +1757,9 @@ void UGFxValue::SetElementMemberBool ( int Index, struct FString member, unsigne
 
 void UGFxValue::SetElementMemberObject ( int Index, struct FString member, class UGFxValue* val )
 {
-	static UFunction* pFnSetElementMemberObject = NULL;
-
+	UFunction* pFnSetElementMemberObject = (UFunction*) SdkBindings::Get ( 2917 );
 	if ( ! pFnSetElementMemberObject )
-		pFnSetElementMemberObject = (UFunction*) UObject::GObjObjects()->Data[ 34951 ];
+		return;
 
 	UGFxValue_execSetElementMemberObject_Parms SetElementMemberObject_Parms;
 	SetElementMemberObject_Parms.Index = Index;
@@ -1857,10 +1782,9 @@ void UGFxValue::SetElementMemberObject ( int Index, struct FString member, class
 
 void UGFxValue::SetElementMember ( int Index, struct FString member, struct FASValue Arg )
 {
-	static UFunction* pFnSetElementMember = NULL;
-
+	UFunction* pFnSetElementMember = (UFunction*) SdkBindings::Get ( 2916 );
 	if ( ! pFnSetElementMember )
-		pFnSetElementMember = (UFunction*) UObject::GObjObjects()->Data[ 34947 ];
+		return;
 
 	UGFxValue_execSetElementMember_Parms SetElementMember_Parms;
 	SetElementMember_Parms.Index = Index;
@@ -1883,10 +1807,9 @@ void UGFxValue::SetElementMember ( int Index, struct FString member, struct FASV
 
 struct FString UGFxValue::GetElementMemberString ( int Index, struct FString member )
 {
-	static UFunction* pFnGetElementMemberString = NULL;
-
+	UFunction* pFnGetElementMemberString = (UFunction*) SdkBindings::Get ( 2915 );
 	if ( ! pFnGetElementMemberString )
-		pFnGetElementMemberString = (UFunction*) UObject::GObjObjects()->Data[ 34943 ];
+		return {};
 
 	UGFxValue_execGetElementMemberString_Parms GetElementMemberString_Parms;
 	GetElementMemberString_Parms.Index = Index;
@@ -1910,10 +1833,9 @@ struct FString UGFxValue::GetElementMemberString ( int Index, struct FString mem
 
 float UGFxValue::GetElementMemberNumber ( int Index, struct FString member )
 {
-	static UFunction* pFnGetElementMemberNumber = NULL;
-
+	UFunction* pFnGetElementMemberNumber = (UFunction*) SdkBindings::Get ( 2914 );
 	if ( ! pFnGetElementMemberNumber )
-		pFnGetElementMemberNumber = (UFunction*) UObject::GObjObjects()->Data[ 34939 ];
+		return {};
 
 	UGFxValue_execGetElementMemberNumber_Parms GetElementMemberNumber_Parms;
 	GetElementMemberNumber_Parms.Index = Index;
@@ -1937,10 +1859,9 @@ float UGFxValue::GetElementMemberNumber ( int Index, struct FString member )
 
 bool UGFxValue::GetElementMemberBool ( int Index, struct FString member )
 {
-	static UFunction* pFnGetElementMemberBool = NULL;
-
+	UFunction* pFnGetElementMemberBool = (UFunction*) SdkBindings::Get ( 2913 );
 	if ( ! pFnGetElementMemberBool )
-		pFnGetElementMemberBool = (UFunction*) UObject::GObjObjects()->Data[ 34935 ];
+		return {};
 
 	UGFxValue_execGetElementMemberBool_Parms GetElementMemberBool_Parms;
 	GetElementMemberBool_Parms.Index = Index;
@@ -1965,10 +1886,9 @@ bool UGFxValue::GetElementMemberBool ( int Index, struct FString member )
 
 class UGFxValue* UGFxValue::GetElementMemberObject ( int Index, struct FString member, class UClass* Type )
 {
-	static UFunction* pFnGetElementMemberObject = NULL;
-
+	UFunction* pFnGetElementMemberObject = (UFunction*) SdkBindings::Get ( 2912 );
 	if ( ! pFnGetElementMemberObject )
-		pFnGetElementMemberObject = (UFunction*) UObject::GObjObjects()->Data[ 34930 ];
+		return {};
 
 	UGFxValue_execGetElementMemberObject_Parms GetElementMemberObject_Parms;
 	GetElementMemberObject_Parms.Index = Index;
@@ -1993,10 +1913,9 @@ class UGFxValue* UGFxValue::GetElementMemberObject ( int Index, struct FString m
 
 struct FASValue UGFxValue::GetElementMember ( int Index, struct FString member )
 {
-	static UFunction* pFnGetElementMember = NULL;
-
+	UFunction* pFnGetElementMember = (UFunction*) SdkBindings::Get ( 2911 );
 	if ( ! pFnGetElementMember )
-		pFnGetElementMember = (UFunction*) UObject::GObjObjects()->Data[ 34926 ];
+		return {};
 
 	UGFxValue_execGetElementMember_Parms GetElementMember_Parms;
 	GetElementMember_Parms.Index = Index;
@@ -2019,10 +1938,9 @@ struct FASValue UGFxValue::GetElementMember ( int Index, struct FString member )
 
 void UGFxValue::SetElementColorTransform ( int Index, struct FASColorTransform cxform )
 {
-	static UFunction* pFnSetElementColorTransform = NULL;
-
+	UFunction* pFnSetElementColorTransform = (UFunction*) SdkBindings::Get ( 2910 );
 	if ( ! pFnSetElementColorTransform )
-		pFnSetElementColorTransform = (UFunction*) UObject::GObjObjects()->Data[ 34923 ];
+		return;
 
 	UGFxValue_execSetElementColorTransform_Parms SetElementColorTransform_Parms;
 	SetElementColorTransform_Parms.Index = Index;
@@ -2044,10 +1962,9 @@ void UGFxValue::SetElementColorTransform ( int Index, struct FASColorTransform c
 
 void UGFxValue::SetElementPosition ( int Index, float X, float Y )
 {
-	static UFunction* pFnSetElementPosition = NULL;
-
+	UFunction* pFnSetElementPosition = (UFunction*) SdkBindings::Get ( 2909 );
 	if ( ! pFnSetElementPosition )
-		pFnSetElementPosition = (UFunction*) UObject::GObjObjects()->Data[ 34919 ];
+		return;
 
 	UGFxValue_execSetElementPosition_Parms SetElementPosition_Parms;
 	SetElementPosition_Parms.Index = Index;
@@ -2069,10 +1986,9 @@ void UGFxValue::SetElementPosition ( int Index, float X, float Y )
 
 void UGFxValue::SetElementVisible ( int Index, unsigned long visible )
 {
-	static UFunction* pFnSetElementVisible = NULL;
-
+	UFunction* pFnSetElementVisible = (UFunction*) SdkBindings::Get ( 2908 );
 	if ( ! pFnSetElementVisible )
-		pFnSetElementVisible = (UFunction*) UObject::GObjObjects()->Data[ 34916 ];
+		return;
 
 	UGFxValue_execSetElementVisible_Parms SetElementVisible_Parms;
 	SetElementVisible_Parms.Index = Index;
@@ -2093,10 +2009,9 @@ void UGFxValue::SetElementVisible ( int Index, unsigned long visible )
 
 void UGFxValue::SetElementDisplayMatrix ( int Index, struct FMatrix M )
 {
-	static UFunction* pFnSetElementDisplayMatrix = NULL;
-
+	UFunction* pFnSetElementDisplayMatrix = (UFunction*) SdkBindings::Get ( 2907 );
 	if ( ! pFnSetElementDisplayMatrix )
-		pFnSetElementDisplayMatrix = (UFunction*) UObject::GObjObjects()->Data[ 34913 ];
+		return;
 
 	UGFxValue_execSetElementDisplayMatrix_Parms SetElementDisplayMatrix_Parms;
 	SetElementDisplayMatrix_Parms.Index = Index;
@@ -2117,10 +2032,9 @@ void UGFxValue::SetElementDisplayMatrix ( int Index, struct FMatrix M )
 
 void UGFxValue::SetElementDisplayInfo ( int Index, struct FASDisplayInfo D )
 {
-	static UFunction* pFnSetElementDisplayInfo = NULL;
-
+	UFunction* pFnSetElementDisplayInfo = (UFunction*) SdkBindings::Get ( 2906 );
 	if ( ! pFnSetElementDisplayInfo )
-		pFnSetElementDisplayInfo = (UFunction*) UObject::GObjObjects()->Data[ 34910 ];
+		return;
 
 	UGFxValue_execSetElementDisplayInfo_Parms SetElementDisplayInfo_Parms;
 	SetElementDisplayInfo_Parms.Index = Index;
@@ -2141,10 +2055,9 @@ void UGFxValue::SetElementDisplayInfo ( int Index, struct FASDisplayInfo D )
 
 void UGFxValue::SetElementString ( int Index, struct FString S )
 {
-	static UFunction* pFnSetElementString = NULL;
-
+	UFunction* pFnSetElementString = (UFunction*) SdkBindings::Get ( 2905 );
 	if ( ! pFnSetElementString )
-		pFnSetElementString = (UFunction*) UObject::GObjObjects()->Data[ 34907 ];
+		return;
 
 	UGFxValue_execSetElementString_Parms SetElementString_Parms;
 	SetElementString_Parms.Index = Index;
@@ -2165,10 +2078,9 @@ void UGFxValue::SetElementString ( int Index, struct FString S )
 
 void UGFxValue::SetElementNumber ( int Index, float F )
 {
-	static UFunction* pFnSetElementNumber = NULL;
-
+	UFunction* pFnSetElementNumber = (UFunction*) SdkBindings::Get ( 2904 );
 	if ( ! pFnSetElementNumber )
-		pFnSetElementNumber = (UFunction*) UObject::GObjObjects()->Data[ 34904 ];
+		return;
 
 	UGFxValue_execSetElementNumber_Parms SetElementNumber_Parms;
 	SetElementNumber_Parms.Index = Index;
@@ -2189,10 +2101,9 @@ void UGFxValue::SetElementNumber ( int Index, float F )
 
 void UGFxValue::SetElementBool ( int Index, unsigned long B )
 {
-	static UFunction* pFnSetElementBool = NULL;
-
+	UFunction* pFnSetElementBool = (UFunction*) SdkBindings::Get ( 2903 );
 	if ( ! pFnSetElementBool )
-		pFnSetElementBool = (UFunction*) UObject::GObjObjects()->Data[ 34901 ];
+		return;
 
 	UGFxValue_execSetElementBool_Parms SetElementBool_Parms;
 	SetElementBool_Parms.Index = Index;
@@ -2213,10 +2124,9 @@ void UGFxValue::SetElementBool ( int Index, unsigned long B )
 
 void UGFxValue::SetElementObject ( int Index, class UGFxValue* val )
 {
-	static UFunction* pFnSetElementObject = NULL;
-
+	UFunction* pFnSetElementObject = (UFunction*) SdkBindings::Get ( 2902 );
 	if ( ! pFnSetElementObject )
-		pFnSetElementObject = (UFunction*) UObject::GObjObjects()->Data[ 34898 ];
+		return;
 
 	UGFxValue_execSetElementObject_Parms SetElementObject_Parms;
 	SetElementObject_Parms.Index = Index;
@@ -2237,10 +2147,9 @@ void UGFxValue::SetElementObject ( int Index, class UGFxValue* val )
 
 void UGFxValue::SetElement ( int Index, struct FASValue Arg )
 {
-	static UFunction* pFnSetElement = NULL;
-
+	UFunction* pFnSetElement = (UFunction*) SdkBindings::Get ( 2901 );
 	if ( ! pFnSetElement )
-		pFnSetElement = (UFunction*) UObject::GObjObjects()->Data[ 34895 ];
+		return;
 
 	UGFxValue_execSetElement_Parms SetElement_Parms;
 	SetElement_Parms.Index = Index;
@@ -2261,10 +2170,9 @@ void UGFxValue::SetElement ( int Index, struct FASValue Arg )
 
 struct FMatrix UGFxValue::GetElementDisplayMatrix ( int Index )
 {
-	static UFunction* pFnGetElementDisplayMatrix = NULL;
-
+	UFunction* pFnGetElementDisplayMatrix = (UFunction*) SdkBindings::Get ( 2900 );
 	if ( ! pFnGetElementDisplayMatrix )
-		pFnGetElementDisplayMatrix = (UFunction*) UObject::GObjObjects()->Data[ 34892 ];
+		return {};
 
 	UGFxValue_execGetElementDisplayMatrix_Parms GetElementDisplayMatrix_Parms;
 	GetElementDisplayMatrix_Parms.Index = Index;
@@ -2286,10 +2194,9 @@ struct FMatrix UGFxValue::GetElementDisplayMatrix ( int Index )
 
 struct FASDisplayInfo UGFxValue::GetElementDisplayInfo ( int Index )
 {
-	static UFunction* pFnGetElementDisplayInfo = NULL;
-
+	UFunction* pFnGetElementDisplayInfo = (UFunction*) SdkBindings::Get ( 2899 );
 	if ( ! pFnGetElementDisplayInfo )
-		pFnGetElementDisplayInfo = (UFunction*) UObject::GObjObjects()->Data[ 34889 ];
+		return {};
 
 	UGFxValue_execGetElementDisplayInfo_Parms GetElementDisplayInfo_Parms;
 	GetElementDisplayInfo_Parms.Index = Index;
@@ -2311,10 +2218,9 @@ struct FASDisplayInfo UGFxValue::GetElementDisplayInfo ( int Index )
 
 struct FString UGFxValue::GetElementString ( int Index )
 {
-	static UFunction* pFnGetElementString = NULL;
-
+	UFunction* pFnGetElementString = (UFunction*) SdkBindings::Get ( 2898 );
 	if ( ! pFnGetElementString )
-		pFnGetElementString = (UFunction*) UObject::GObjObjects()->Data[ 34886 ];
+		return {};
 
 	UGFxValue_execGetElementString_Parms GetElementString_Parms;
 	GetElementString_Parms.Index = Index;
@@ -2336,10 +2242,9 @@ struct FString UGFxValue::GetElementString ( int Index )
 
 float UGFxValue::GetElementNumber ( int Index )
 {
-	static UFunction* pFnGetElementNumber = NULL;
-
+	UFunction* pFnGetElementNumber = (UFunction*) SdkBindings::Get ( 2897 );
 	if ( ! pFnGetElementNumber )
-		pFnGetElementNumber = (UFunction*) UObject::GObjObjects()->Data[ 34883 ];
+		return {};
 
 	UGFxValue_execGetElementNumber_Parms GetElementNumber_Parms;
 	GetElementNumber_Parms.Index = Index;
@@ -2361,10 +2266,9 @@ float UGFxValue::GetElementNumber ( int Index )
 
 bool UGFxValue::GetElementBool ( int Index )
 {
-	static UFunction* pFnGetElementBool = NULL;
-
+	UFunction* pFnGetElementBool = (UFunction*) SdkBindings::Get ( 2896 );
 	if ( ! pFnGetElementBool )
-		pFnGetElementBool = (UFunction*) UObject::GObjObjects()->Data[ 34880 ];
+		return {};
 
 	UGFxValue_execGetElementBool_Parms GetElementBool_Parms;
 	GetElementBool_Parms.Index = Index;
@@ -2387,10 +2291,9 @@ bool UGFxValue::GetElementBool ( int Index )
 
 class UGFxValue* UGFxValue::GetElementObject ( int Index, class UClass* Type )
 {
-	static UFunction* pFnGetElementObject = NULL;
-
+	UFunction* pFnGetElementObject = (UFunction*) SdkBindings::Get ( 2895 );
 	if ( ! pFnGetElementObject )
-		pFnGetElementObject = (UFunction*) UObject::GObjObjects()->Data[ 34876 ];
+		return {};
 
 	UGFxValue_execGetElementObject_Parms GetElementObject_Parms;
 	GetElementObject_Parms.Index = Index;
@@ -2413,10 +2316,9 @@ class UGFxValue* UGFxValue::GetElementObject ( int Index, class UClass* Type )
 
 struct FASValue UGFxValue::GetElement ( int Index )
 {
-	static UFunction* pFnGetElement = NULL;
-
+	UFunction* pFnGetElement = (UFunction*) SdkBindings::Get ( 2894 );
 	if ( ! pFnGetElement )
-		pFnGetElement = (UFunction*) UObject::GObjObjects()->Data[ 34873 ];
+		return {};
 
 	UGFxValue_execGetElement_Parms GetElement_Parms;
 	GetElement_Parms.Index = Index;
@@ -2439,10 +2341,9 @@ struct FASValue UGFxValue::GetElement ( int Index )
 
 void UGFxValue::SetMemberObjectText ( struct FString sMember, struct FString sText, unsigned long bIsHTML )
 {
-	static UFunction* pFnSetMemberObjectText = NULL;
-
+	UFunction* pFnSetMemberObjectText = (UFunction*) SdkBindings::Get ( 2893 );
 	if ( ! pFnSetMemberObjectText )
-		pFnSetMemberObjectText = (UFunction*) UObject::GObjObjects()->Data[ 34869 ];
+		return;
 
 	UGFxValue_execSetMemberObjectText_Parms SetMemberObjectText_Parms;
 	memcpy ( &SetMemberObjectText_Parms.sMember, &sMember, 0xC );
@@ -2464,10 +2365,9 @@ void UGFxValue::SetMemberObjectText ( struct FString sMember, struct FString sTe
 
 void UGFxValue::SetText ( struct FString Text, unsigned long bIsHTML )
 {
-	static UFunction* pFnSetText = NULL;
-
+	UFunction* pFnSetText = (UFunction*) SdkBindings::Get ( 2892 );
 	if ( ! pFnSetText )
-		pFnSetText = (UFunction*) UObject::GObjObjects()->Data[ 34866 ];
+		return;
 
 	UGFxValue_execSetText_Parms SetText_Parms;
 	memcpy ( &SetText_Parms.Text, &Text, 0xC );
@@ -2487,10 +2387,9 @@ void UGFxValue::SetText ( struct FString Text, unsigned long bIsHTML )
 
 struct FString UGFxValue::GetText ( )
 {
-	static UFunction* pFnGetText = NULL;
-
+	UFunction* pFnGetText = (UFunction*) SdkBindings::Get ( 2891 );
 	if ( ! pFnGetText )
-		pFnGetText = (UFunction*) UObject::GObjObjects()->Data[ 34864 ];
+		return {};
 
 	UGFxValue_execGetText_Parms GetText_Parms;
 
@@ -2511,10 +2410,9 @@ struct FString UGFxValue::GetText ( )
 
 class UGFxValue* UGFxValue::CastTo ( class UClass* Type )
 {
-	static UFunction* pFnCastTo = NULL;
-
+	UFunction* pFnCastTo = (UFunction*) SdkBindings::Get ( 2890 );
 	if ( ! pFnCastTo )
-		pFnCastTo = (UFunction*) UObject::GObjObjects()->Data[ 34861 ];
+		return {};
 
 	UGFxValue_execCastTo_Parms CastTo_Parms;
 	CastTo_Parms.Type = Type;
@@ -2539,10 +2437,9 @@ class UGFxValue* UGFxValue::CastTo ( class UClass* Type )
 
 class UGFxValue* UGFxValue::AttachMovie ( struct FString symbolname, struct FString InstanceName, int Depth, class UClass* Type )
 {
-	static UFunction* pFnAttachMovie = NULL;
-
+	UFunction* pFnAttachMovie = (UFunction*) SdkBindings::Get ( 2889 );
 	if ( ! pFnAttachMovie )
-		pFnAttachMovie = (UFunction*) UObject::GObjObjects()->Data[ 34855 ];
+		return {};
 
 	UGFxValue_execAttachMovie_Parms AttachMovie_Parms;
 	memcpy ( &AttachMovie_Parms.symbolname, &symbolname, 0xC );
@@ -2569,10 +2466,9 @@ class UGFxValue* UGFxValue::AttachMovie ( struct FString symbolname, struct FStr
 
 class UGFxValue* UGFxValue::CreateEmptyMovieClip ( struct FString InstanceName, int Depth, class UClass* Type )
 {
-	static UFunction* pFnCreateEmptyMovieClip = NULL;
-
+	UFunction* pFnCreateEmptyMovieClip = (UFunction*) SdkBindings::Get ( 2888 );
 	if ( ! pFnCreateEmptyMovieClip )
-		pFnCreateEmptyMovieClip = (UFunction*) UObject::GObjObjects()->Data[ 34850 ];
+		return {};
 
 	UGFxValue_execCreateEmptyMovieClip_Parms CreateEmptyMovieClip_Parms;
 	memcpy ( &CreateEmptyMovieClip_Parms.InstanceName, &InstanceName, 0xC );
@@ -2595,10 +2491,9 @@ class UGFxValue* UGFxValue::CreateEmptyMovieClip ( struct FString InstanceName,
 
 void UGFxValue::GotoAndStopI ( int frame )
 {
-	static UFunction* pFnGotoAndStopI = NULL;
-
+	UFunction* pFnGotoAndStopI = (UFunction*) SdkBindings::Get ( 2887 );
 	if ( ! pFnGotoAndStopI )
-		pFnGotoAndStopI = (UFunction*) UObject::GObjObjects()->Data[ 34848 ];
+		return;
 
 	UGFxValue_execGotoAndStopI_Parms GotoAndStopI_Parms;
 	GotoAndStopI_Parms.frame = frame;
@@ -2617,10 +2512,9 @@ void UGFxValue::GotoAndStopI ( int frame )
 
 void UGFxValue::GotoAndStop ( struct FString frame )
 {
-	static UFunction* pFnGotoAndStop = NULL;
-
+	UFunction* pFnGotoAndStop = (UFunction*) SdkBindings::Get ( 2886 );
 	if ( ! pFnGotoAndStop )
-		pFnGotoAndStop = (UFunction*) UObject::GObjObjects()->Data[ 34846 ];
+		return;
 
 	UGFxValue_execGotoAndStop_Parms GotoAndStop_Parms;
 	memcpy ( &GotoAndStop_Parms.frame, &frame, 0xC );
@@ -2639,10 +2533,9 @@ void UGFxValue::GotoAndStop ( struct FString frame )
 
 void UGFxValue::GotoAndPlayI ( int frame )
 {
-	static UFunction* pFnGotoAndPlayI = NULL;
-
+	UFunction* pFnGotoAndPlayI = (UFunction*) SdkBindings::Get ( 2885 );
 	if ( ! pFnGotoAndPlayI )
-		pFnGotoAndPlayI = (UFunction*) UObject::GObjObjects()->Data[ 34844 ];
+		return;
 
 	UGFxValue_execGotoAndPlayI_Parms GotoAndPlayI_Parms;
 	GotoAndPlayI_Parms.frame = frame;
@@ -2661,10 +2554,9 @@ void UGFxValue::GotoAndPlayI ( int frame )
 
 void UGFxValue::GotoAndPlay ( struct FString frame )
 {
-	static UFunction* pFnGotoAndPlay = NULL;
-
+	UFunction* pFnGotoAndPlay = (UFunction*) SdkBindings::Get ( 2884 );
 	if ( ! pFnGotoAndPlay )
-		pFnGotoAndPlay = (UFunction*) UObject::GObjObjects()->Data[ 34842 ];
+		return;
 
 	UGFxValue_execGotoAndPlay_Parms GotoAndPlay_Parms;
 	memcpy ( &GotoAndPlay_Parms.frame, &frame, 0xC );
@@ -2683,10 +2575,9 @@ void UGFxValue::GotoAndPlay ( struct FString frame )
 
 void UGFxValue::SetColorTransform ( struct FASColorTransform cxform )
 {
-	static UFunction* pFnSetColorTransform = NULL;
-
+	UFunction* pFnSetColorTransform = (UFunction*) SdkBindings::Get ( 2883 );
 	if ( ! pFnSetColorTransform )
-		pFnSetColorTransform = (UFunction*) UObject::GObjObjects()->Data[ 34840 ];
+		return;
 
 	UGFxValue_execSetColorTransform_Parms SetColorTransform_Parms;
 	memcpy ( &SetColorTransform_Parms.cxform, &cxform, 0x20 );
@@ -2706,10 +2597,9 @@ void UGFxValue::SetColorTransform ( struct FASColorTransform cxform )
 
 void UGFxValue::SetPosition ( float X, float Y )
 {
-	static UFunction* pFnSetPosition = NULL;
-
+	UFunction* pFnSetPosition = (UFunction*) SdkBindings::Get ( 2882 );
 	if ( ! pFnSetPosition )
-		pFnSetPosition = (UFunction*) UObject::GObjObjects()->Data[ 34837 ];
+		return;
 
 	UGFxValue_execSetPosition_Parms SetPosition_Parms;
 	SetPosition_Parms.X = X;
@@ -2729,10 +2619,9 @@ void UGFxValue::SetPosition ( float X, float Y )
 
 void UGFxValue::SetVisible ( unsigned long visible )
 {
-	static UFunction* pFnSetVisible = NULL;
-
+	UFunction* pFnSetVisible = (UFunction*) SdkBindings::Get ( 2881 );
 	if ( ! pFnSetVisible )
-		pFnSetVisible = (UFunction*) UObject::GObjObjects()->Data[ 34835 ];
+		return;
 
 	UGFxValue_execSetVisible_Parms SetVisible_Parms;
 	SetVisible_Parms.visible = visible;
@@ -2751,10 +2640,9 @@ void UGFxValue::SetVisible ( unsigned long visible )
 
 void UGFxValue::SetDisplayMatrix3D ( struct FMatrix M )
 {
-	static UFunction* pFnSetDisplayMatrix3D = NULL;
-
+	UFunction* pFnSetDisplayMatrix3D = (UFunction*) SdkBindings::Get ( 2880 );
 	if ( ! pFnSetDisplayMatrix3D )
-		pFnSetDisplayMatrix3D = (UFunction*) UObject::GObjObjects()->Data[ 34833 ];
+		return;
 
 	UGFxValue_execSetDisplayMatrix3D_Parms SetDisplayMatrix3D_Parms;
 	memcpy ( &SetDisplayMatrix3D_Parms.M, &M, 0x40 );
@@ -2773,10 +2661,9 @@ void UGFxValue::SetDisplayMatrix3D ( struct FMatrix M )
 
 void UGFxValue::SetDisplayMatrix ( struct FMatrix M )
 {
-	static UFunction* pFnSetDisplayMatrix = NULL;
-
+	UFunction* pFnSetDisplayMatrix = (UFunction*) SdkBindings::Get ( 2879 );
 	if ( ! pFnSetDisplayMatrix )
-		pFnSetDisplayMatrix = (UFunction*) UObject::GObjObjects()->Data[ 34831 ];
+		return;
 
 	UGFxValue_execSetDisplayMatrix_Parms SetDisplayMatrix_Parms;
 	memcpy ( &SetDisplayMatrix_Parms.M, &M, 0x40 );
@@ -2795,10 +2682,9 @@ void UGFxValue::SetDisplayMatrix ( struct FMatrix M )
 
 void UGFxValue::SetDisplayInfo ( struct FASDisplayInfo* D )
 {
-	static UFunction* pFnSetDisplayInfo = NULL;
-
+	UFunction* pFnSetDisplayInfo = (UFunction*) SdkBindings::Get ( 2878 );
 	if ( ! pFnSetDisplayInfo )
-		pFnSetDisplayInfo = (UFunction*) UObject::GObjObjects()->Data[ 34829 ];
+		return;
 
 	UGFxValue_execSetDisplayInfo_Parms SetDisplayInfo_Parms;
 
@@ -2821,10 +2707,9 @@ void UGFxValue::SetDisplayInfo ( struct FASDisplayInfo* D )
 
 bool UGFxValue::GetPosition ( float* X, float* Y )
 {
-	static UFunction* pFnGetPosition = NULL;
-
+	UFunction* pFnGetPosition = (UFunction*) SdkBindings::Get ( 2877 );
 	if ( ! pFnGetPosition )
-		pFnGetPosition = (UFunction*) UObject::GObjObjects()->Data[ 34825 ];
+		return {};
 
 	UGFxValue_execGetPosition_Parms GetPosition_Parms;
 
@@ -2850,10 +2735,9 @@ bool UGFxValue::GetPosition ( float* X, float* Y )
 
 struct FASColorTransform UGFxValue::GetColorTransform ( )
 {
-	static UFunction* pFnGetColorTransform = NULL;
-
+	UFunction* pFnGetColorTransform = (UFunction*) SdkBindings::Get ( 2876 );
 	if ( ! pFnGetColorTransform )
-		pFnGetColorTransform = (UFunction*) UObject::GObjObjects()->Data[ 34823 ];
+		return {};
 
 	UGFxValue_execGetColorTransform_Parms GetColorTransform_Parms;
 
@@ -2873,10 +2757,9 @@ struct FASColorTransform UGFxValue::GetColorTransform ( )
 
 struct FMatrix UGFxValue::GetDisplayMatrix ( )
 {
-	static UFunction* pFnGetDisplayMatrix = NULL;
-
+	UFunction* pFnGetDisplayMatrix = (UFunction*) SdkBindings::Get ( 2875 );
 	if ( ! pFnGetDisplayMatrix )
-		pFnGetDisplayMatrix = (UFunction*) UObject::GObjObjects()->Data[ 34821 ];
+		return {};
 
 	UGFxValue_execGetDisplayMatrix_Parms GetDisplayMatrix_Parms;
 
@@ -2896,10 +2779,9 @@ struct FMatrix UGFxValue::GetDisplayMatrix ( )
 
 struct FASDisplayInfo UGFxValue::GetDisplayInfo ( )
 {
-	static UFunction* pFnGetDisplayInfo = NULL;
-
+	UFunction* pFnGetDisplayInfo = (UFunction*) SdkBindings::Get ( 2874 );
 	if ( ! pFnGetDisplayInfo )
-		pFnGetDisplayInfo = (UFunction*) UObject::GObjObjects()->Data[ 34819 ];
+		return {};
 
 	UGFxValue_execGetDisplayInfo_Parms GetDisplayInfo_Parms;
 
@@ -2920,10 +2802,9 @@ struct FASDisplayInfo UGFxValue::GetDisplayInfo ( )
 
 void UGFxValue::SetString ( struct FString member, struct FString S )
 {
-	static UFunction* pFnSetString = NULL;
-
+	UFunction* pFnSetString = (UFunction*) SdkBindings::Get ( 2873 );
 	if ( ! pFnSetString )
-		pFnSetString = (UFunction*) UObject::GObjObjects()->Data[ 34816 ];
+		return;
 
 	UGFxValue_execSetString_Parms SetString_Parms;
 	memcpy ( &SetString_Parms.member, &member, 0xC );
@@ -2944,10 +2825,9 @@ void UGFxValue::SetString ( struct FString member, struct FString S )
 
 void UGFxValue::SetNumber ( struct FString member, float F )
 {
-	static UFunction* pFnSetNumber = NULL;
-
+	UFunction* pFnSetNumber = (UFunction*) SdkBindings::Get ( 2872 );
 	if ( ! pFnSetNumber )
-		pFnSetNumber = (UFunction*) UObject::GObjObjects()->Data[ 34813 ];
+		return;
 
 	UGFxValue_execSetNumber_Parms SetNumber_Parms;
 	memcpy ( &SetNumber_Parms.member, &member, 0xC );
@@ -2968,10 +2848,9 @@ void UGFxValue::SetNumber ( struct FString member, float F )
 
 void UGFxValue::SetBool ( struct FString member, unsigned long B )
 {
-	static UFunction* pFnSetBool = NULL;
-
+	UFunction* pFnSetBool = (UFunction*) SdkBindings::Get ( 2871 );
 	if ( ! pFnSetBool )
-		pFnSetBool = (UFunction*) UObject::GObjObjects()->Data[ 34810 ];
+		return;
 
 	UGFxValue_execSetBool_Parms SetBool_Parms;
 	memcpy ( &SetBool_Parms.member, &member, 0xC );
@@ -2993,10 +2872,9 @@ void UGFxValue::SetBool ( struct FString member, unsigned long B )
 
 void UGFxValue::SetFunction ( struct FString member, class UObject* Context, struct FName fname )
 {
-	static UFunction* pFnSetFunction = NULL;
-
+	UFunction* pFnSetFunction = (UFunction*) SdkBindings::Get ( 2870 );
 	if ( ! pFnSetFunction )
-		pFnSetFunction = (UFunction*) UObject::GObjObjects()->Data[ 34806 ];
+		return;
 
 	UGFxValue_execSetFunction_Parms SetFunction_Parms;
 	memcpy ( &SetFunction_Parms.member, &member, 0xC );
@@ -3018,10 +2896,9 @@ void UGFxValue::SetFunction ( struct FString member, class UObject* Context, str
 
 void UGFxValue::SetObject ( struct FString member, class UGFxValue* val )
 {
-	static UFunction* pFnSetObject = NULL;
-
+	UFunction* pFnSetObject = (UFunction*) SdkBindings::Get ( 2869 );
 	if ( ! pFnSetObject )
-		pFnSetObject = (UFunction*) UObject::GObjObjects()->Data[ 34803 ];
+		return;
 
 	UGFxValue_execSetObject_Parms SetObject_Parms;
 	memcpy ( &SetObject_Parms.member, &member, 0xC );
@@ -3042,10 +2919,9 @@ void UGFxValue::SetObject ( struct FString member, class UGFxValue* val )
 
 void UGFxValue::Set ( struct FString member, struct FASValue Arg )
 {
-	static UFunction* pFnSet = NULL;
-
+	UFunction* pFnSet = (UFunction*) SdkBindings::Get ( 2868 );
 	if ( ! pFnSet )
-		pFnSet = (UFunction*) UObject::GObjObjects()->Data[ 34800 ];
+		return;
 
 	UGFxValue_execSet_Parms Set_Parms;
 	memcpy ( &Set_Parms.member, &member, 0xC );
@@ -3066,10 +2942,9 @@ void UGFxValue::Set ( struct FString member, struct FASValue Arg )
 
 struct FString UGFxValue::GetString ( struct FString member )
 {
-	static UFunction* pFnGetString = NULL;
-
+	UFunction* pFnGetString = (UFunction*) SdkBindings::Get ( 2867 );
 	if ( ! pFnGetString )
-		pFnGetString = (UFunction*) UObject::GObjObjects()->Data[ 34797 ];
+		return {};
 
 	UGFxValue_execGetString_Parms GetString_Parms;
 	memcpy ( &GetString_Parms.member, &member, 0xC );
@@ -3091,10 +2966,9 @@ struct FString UGFxValue::GetString ( struct FString member )
 
 float UGFxValue::GetNumber ( struct FString member )
 {
-	static UFunction* pFnGetNumber = NULL;
-
+	UFunction* pFnGetNumber = (UFunction*) SdkBindings::Get ( 2866 );
 	if ( ! pFnGetNumber )
-		pFnGetNumber = (UFunction*) UObject::GObjObjects()->Data[ 34794 ];
+		return {};
 
 	UGFxValue_execGetNumber_Parms GetNumber_Parms;
 	memcpy ( &GetNumber_Parms.member, &member, 0xC );
@@ -3116,10 +2990,9 @@ float UGFxValue::GetNumber ( struct FString member )
 
 bool UGFxValue::GetBool ( struct FString member )
 {
-	static UFunction* pFnGetBool = NULL;
-
+	UFunction* pFnGetBool = (UFunction*) SdkBindings::Get ( 2865 );
 	if ( ! pFnGetBool )
-		pFnGetBool = (UFunction*) UObject::GObjObjects()->Data[ 34791 ];
+		return {};
 
 	UGFxValue_execGetBool_Parms GetBool_Parms;
 	memcpy ( &GetBool_Parms.member, &member, 0xC );
@@ -3142,10 +3015,9 @@ bool UGFxValue::GetBool ( struct FString member )
 
 class UGFxValue* UGFxValue::GetObject ( struct FString member, class UClass* Type )
 {
-	static UFunction* pFnGetObject = NULL;
-
+	UFunction* pFnGetObject = (UFunction*) SdkBindings::Get ( 2864 );
 	if ( ! pFnGetObject )
-		pFnGetObject = (UFunction*) UObject::GObjObjects()->Data[ 34787 ];
+		return {};
 
 	UGFxValue_execGetObject_Parms GetObject_Parms;
 	memcpy ( &GetObject_Parms.member, &member, 0xC );
@@ -3168,10 +3040,9 @@ class UGFxValue* UGFxValue::GetObject ( struct FString member, class UClass* Typ
 
 struct FASValue UGFxValue::Get ( struct FString member )
 {
-	static UFunction* pFnGet = NULL;
-
+	UFunction* pFnGet = (UFunction*) SdkBindings::Get ( 2863 );
 	if ( ! pFnGet )
-		pFnGet = (UFunction*) UObject::GObjObjects()->Data[ 34784 ];
+		return {};
 
 	UGFxValue_execGet_Parms Get_Parms;
 	memcpy ( &Get_Parms.member, &member, 0xC );
@@ -3194,10 +3065,9 @@ struct FASValue UGFxValue::Get ( struct FString member )
 
 struct FASValue UGFxValue::Invoke ( struct FString member, TArray< struct FASValue > Args )
 {
-	static UFunction* pFnInvoke = NULL;
-
+	UFunction* pFnInvoke = (UFunction*) SdkBindings::Get ( 2862 );
 	if ( ! pFnInvoke )
-		pFnInvoke = (UFunction*) UObject::GObjObjects()->Data[ 34779 ];
+		return {};
 
 	UGFxValue_execInvoke_Parms Invoke_Parms;
 	memcpy ( &Invoke_Parms.member, &member, 0xC );
@@ -3219,10 +3089,9 @@ struct FASValue UGFxValue::Invoke ( struct FString member, TArray< struct FASVal
 
 bool UGFxAction_CloseMovie::eventIsValidLevelSequenceObject ( )
 {
-	static UFunction* pFnIsValidLevelSequenceObject = NULL;
-
+	UFunction* pFnIsValidLevelSequenceObject = (UFunction*) SdkBindings::Get ( 2785 );
 	if ( ! pFnIsValidLevelSequenceObject )
-		pFnIsValidLevelSequenceObject = (UFunction*) UObject::GObjObjects()->Data[ 34413 ];
+		return {};
 
 	UGFxAction_CloseMovie_eventIsValidLevelSequenceObject_Parms IsValidLevelSequenceObject_Parms;
 
@@ -3238,10 +3107,9 @@ bool UGFxAction_CloseMovie::eventIsValidLevelSequenceObject ( )
 
 bool UGFxAction_GetVariable::eventIsValidLevelSequenceObject ( )
 {
-	static UFunction* pFnIsValidLevelSequenceObject = NULL;
-
+	UFunction* pFnIsValidLevelSequenceObject = (UFunction*) SdkBindings::Get ( 2786 );
 	if ( ! pFnIsValidLevelSequenceObject )
-		pFnIsValidLevelSequenceObject = (UFunction*) UObject::GObjObjects()->Data[ 34417 ];
+		return {};
 
 	UGFxAction_GetVariable_eventIsValidLevelSequenceObject_Parms IsValidLevelSequenceObject_Parms;
 
@@ -3257,10 +3125,9 @@ bool UGFxAction_GetVariable::eventIsValidLevelSequenceObject ( )
 
 bool UGFxAction_Invoke::eventIsValidLevelSequenceObject ( )
 {
-	static UFunction* pFnIsValidLevelSequenceObject = NULL;
-
+	UFunction* pFnIsValidLevelSequenceObject = (UFunction*) SdkBindings::Get ( 2844 );
 	if ( ! pFnIsValidLevelSequenceObject )
-		pFnIsValidLevelSequenceObject = (UFunction*) UObject::GObjObjects()->Data[ 34658 ];
+		return {};
 
 	UGFxAction_Invoke_eventIsValidLevelSequenceObject_Parms IsValidLevelSequenceObject_Parms;
 
@@ -3276,10 +3143,9 @@ bool UGFxAction_Invoke::eventIsValidLevelSequenceObject ( )
 
 bool UGFxAction_OpenMovie::eventIsValidLevelSequenceObject ( )
 {
-	static UFunction* pFnIsValidLevelSequenceObject = NULL;
-
+	UFunction* pFnIsValidLevelSequenceObject = (UFunction*) SdkBindings::Get ( 2845 );
 	if ( ! pFnIsValidLevelSequenceObject )
-		pFnIsValidLevelSequenceObject = (UFunction*) UObject::GObjObjects()->Data[ 34662 ];
+		return {};
 
 	UGFxAction_OpenMovie_eventIsValidLevelSequenceObject_Parms IsValidLevelSequenceObject_Parms;
 
@@ -3295,10 +3161,9 @@ bool UGFxAction_OpenMovie::eventIsValidLevelSequenceObject ( )
 
 bool UGFxAction_SetVariable::eventIsValidLevelSequenceObject ( )
 {
-	static UFunction* pFnIsValidLevelSequenceObject = NULL;
-
+	UFunction* pFnIsValidLevelSequenceObject = (UFunction*) SdkBindings::Get ( 2846 );
 	if ( ! pFnIsValidLevelSequenceObject )
-		pFnIsValidLevelSequenceObject = (UFunction*) UObject::GObjObjects()->Data[ 34673 ];
+		return {};
 
 	UGFxAction_SetVariable_eventIsValidLevelSequenceObject_Parms IsValidLevelSequenceObject_Parms;
 
@@ -3317,10 +3182,9 @@ bool UGFxAction_SetVariable::eventIsValidLevelSequenceObject ( )
 
 bool UGFxFSCmdHandler_Kismet::eventFSCommand ( class UGFxMovie* movie, struct FString Cmd, struct FString Arg )
 {
-	static UFunction* pFnFSCommand = NULL;
-
+	UFunction* pFnFSCommand = (UFunction*) SdkBindings::Get ( 2855 );
 	if ( ! pFnFSCommand )
-		pFnFSCommand = (UFunction*) UObject::GObjObjects()->Data[ 34718 ];
+		return {};
 
 	UGFxFSCmdHandler_Kismet_eventFSCommand_Parms FSCommand_Parms;
 	FSCommand_Parms.movie = movie;
@@ -3345,10 +3209,9 @@ bool UGFxFSCmdHandler_Kismet::eventFSCommand ( class UGFxMovie* movie, struct FS
 
 bool UGFxDataStoreSubscriber::SaveSubscriberValue ( int BindingIndex, TArray< class UUIDataStore* >* out_BoundDataStores )
 {
-	static UFunction* pFnSaveSubscriberValue = NULL;
-
+	UFunction* pFnSaveSubscriberValue = (UFunction*) SdkBindings::Get ( 2854 );
 	if ( ! pFnSaveSubscriberValue )
-		pFnSaveSubscriberValue = (UFunction*) UObject::GObjObjects()->Data[ 34697 ];
+		return {};
 
 	UGFxDataStoreSubscriber_execSaveSubscriberValue_Parms SaveSubscriberValue_Parms;
 	SaveSubscriberValue_Parms.BindingIndex = BindingIndex;
@@ -3371,10 +3234,9 @@ bool UGFxDataStoreSubscriber::SaveSubscriberValue ( int BindingIndex, TArray< cl
 
 void UGFxDataStoreSubscriber::ClearBoundDataStores ( )
 {
-	static UFunction* pFnClearBoundDataStores = NULL;
-
+	UFunction* pFnClearBoundDataStores = (UFunction*) SdkBindings::Get ( 2853 );
 	if ( ! pFnClearBoundDataStores )
-		pFnClearBoundDataStores = (UFunction*) UObject::GObjObjects()->Data[ 34696 ];
+		return;
 
 	UGFxDataStoreSubscriber_execClearBoundDataStores_Parms ClearBoundDataStores_Parms;
 
@@ -3392,10 +3254,9 @@ void UGFxDataStoreSubscriber::ClearBoundDataStores ( )
 
 void UGFxDataStoreSubscriber::GetBoundDataStores ( TArray< class UUIDataStore* >* out_BoundDataStores )
 {
-	static UFunction* pFnGetBoundDataStores = NULL;
-
+	UFunction* pFnGetBoundDataStores = (UFunction*) SdkBindings::Get ( 2852 );
 	if ( ! pFnGetBoundDataStores )
-		pFnGetBoundDataStores = (UFunction*) UObject::GObjObjects()->Data[ 34693 ];
+		return;
 
 	UGFxDataStoreSubscriber_execGetBoundDataStores_Parms GetBoundDataStores_Parms;
 
@@ -3420,10 +3281,9 @@ void UGFxDataStoreSubscriber::GetBoundDataStores ( TArray< class UUIDataStore* >
 
 void UGFxDataStoreSubscriber::NotifyDataStoreValueUpdated ( class UUIDataStore* SourceDataStore, unsigned long bValuesInvalidated, struct FName PropertyTag, class UUIDataProvider* SourceProvider, int ArrayIndex )
 {
-	static UFunction* pFnNotifyDataStoreValueUpdated = NULL;
-
+	UFunction* pFnNotifyDataStoreValueUpdated = (UFunction*) SdkBindings::Get ( 2851 );
 	if ( ! pFnNotifyDataStoreValueUpdated )
-		pFnNotifyDataStoreValueUpdated = (UFunction*) UObject::GObjObjects()->Data[ 34687 ];
+		return;
 
 	UGFxDataStoreSubscriber_execNotifyDataStoreValueUpdated_Parms NotifyDataStoreValueUpdated_Parms;
 	NotifyDataStoreValueUpdated_Parms.SourceDataStore = SourceDataStore;
@@ -3447,10 +3307,9 @@ void UGFxDataStoreSubscriber::NotifyDataStoreValueUpdated ( class UUIDataStore*
 
 bool UGFxDataStoreSubscriber::RefreshSubscriberValue ( int BindingIndex )
 {
-	static UFunction* pFnRefreshSubscriberValue = NULL;
-
+	UFunction* pFnRefreshSubscriberValue = (UFunction*) SdkBindings::Get ( 2850 );
 	if ( ! pFnRefreshSubscriberValue )
-		pFnRefreshSubscriberValue = (UFunction*) UObject::GObjObjects()->Data[ 34684 ];
+		return {};
 
 	UGFxDataStoreSubscriber_execRefreshSubscriberValue_Parms RefreshSubscriberValue_Parms;
 	RefreshSubscriberValue_Parms.BindingIndex = BindingIndex;
@@ -3472,10 +3331,9 @@ bool UGFxDataStoreSubscriber::RefreshSubscriberValue ( int BindingIndex )
 
 struct FString UGFxDataStoreSubscriber::GetDataStoreBinding ( int BindingIndex )
 {
-	static UFunction* pFnGetDataStoreBinding = NULL;
-
+	UFunction* pFnGetDataStoreBinding = (UFunction*) SdkBindings::Get ( 2849 );
 	if ( ! pFnGetDataStoreBinding )
-		pFnGetDataStoreBinding = (UFunction*) UObject::GObjObjects()->Data[ 34681 ];
+		return {};
 
 	UGFxDataStoreSubscriber_execGetDataStoreBinding_Parms GetDataStoreBinding_Parms;
 	GetDataStoreBinding_Parms.BindingIndex = BindingIndex;
@@ -3497,10 +3355,9 @@ struct FString UGFxDataStoreSubscriber::GetDataStoreBinding ( int BindingIndex )
 
 void UGFxDataStoreSubscriber::SetDataStoreBinding ( struct FString MarkupText, int BindingIndex )
 {
-	static UFunction* pFnSetDataStoreBinding = NULL;
-
+	UFunction* pFnSetDataStoreBinding = (UFunction*) SdkBindings::Get ( 2848 );
 	if ( ! pFnSetDataStoreBinding )
-		pFnSetDataStoreBinding = (UFunction*) UObject::GObjObjects()->Data[ 34678 ];
+		return;
 
 	UGFxDataStoreSubscriber_execSetDataStoreBinding_Parms SetDataStoreBinding_Parms;
 	memcpy ( &SetDataStoreBinding_Parms.MarkupText, &MarkupText, 0xC );
@@ -3519,10 +3376,9 @@ void UGFxDataStoreSubscriber::SetDataStoreBinding ( struct FString MarkupText, i
 
 void UGFxDataStoreSubscriber::PublishValues ( )
 {
-	static UFunction* pFnPublishValues = NULL;
-
+	UFunction* pFnPublishValues = (UFunction*) SdkBindings::Get ( 2847 );
 	if ( ! pFnPublishValues )
-		pFnPublishValues = (UFunction*) UObject::GObjObjects()->Data[ 34677 ];
+		return;
 
 	UGFxDataStoreSubscriber_execPublishValues_Parms PublishValues_Parms;
 
@@ -62,16 +62,9 @@ public:
 	unsigned long                                      bAIBroken : 1;                                    		// 0x03D8 (0x0004) [0x0000000000002000] [0x00000040] ( CPF_Transient )
 	unsigned long                                      bUseIterativePathFinding : 1;                     		// 0x03D8 (0x0004) [0x0000000000004000] [0x00000080] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1269 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1269 );
 	};
 
 	struct FString eventGetActionString ( );
@@ -91,8 +84,6 @@ public:
 	void PushCommand ( class UGameAICommand* NewCommand );
 };
 
-UClass* AGameAIController::pClassPointer = NULL;
-
 // Class GameFramework.GameAICommand
 // 0x001C (0x0058 - 0x003C)
 class UGameAICommand : public UObject
@@ -108,16 +99,9 @@ public:
 	unsigned long                                      bIgnoreNotifies : 1;                              		// 0x0054 (0x0004) [0x0000000000000000] [0x00000008] 
 	unsigned long                                      bPendingPop : 1;                                  		// 0x0054 (0x0004) [0x0000000000002000] [0x00000010] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1270 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1270 );
 	};
 
 	void GetDebugOverheadText ( class APlayerController* PC, TArray< struct FString >* OutText );
@@ -143,30 +127,19 @@ public:
 	bool InitCommandUserActor ( class AGameAIController* AI, class AActor* UserActor );
 };
 
-UClass* UGameAICommand::pClassPointer = NULL;
-
 // Class GameFramework.GameTypes
 // 0x0000 (0x003C - 0x003C)
 class UGameTypes : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1271 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1271 );
 	};
 
 };
 
-UClass* UGameTypes::pClassPointer = NULL;
-
 // Class GameFramework.SeqAct_ModifyProperty
 // 0x000C (0x00BC - 0x00B0)
 class USeqAct_ModifyProperty : public USequenceAction
@@ -174,22 +147,13 @@ class USeqAct_ModifyProperty : public USequenceAction
 public:
 	TArray< struct FPropertyInfo >                     Properties;                                       		// 0x00B0 (0x000C) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1272 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1272 );
 	};
 
 };
 
-UClass* USeqAct_ModifyProperty::pClassPointer = NULL;
-
 
 #ifdef _MSC_VER
 	#pragma pack ( pop )
@@ -28,10 +28,9 @@
 
 struct FString AGameAIController::eventGetActionString ( )
 {
-	static UFunction* pFnGetActionString = NULL;
-
+	UFunction* pFnGetActionString = (UFunction*) SdkBindings::Get ( 2556 );
 	if ( ! pFnGetActionString )
-		pFnGetActionString = (UFunction*) UObject::GObjObjects()->Data[ 33363 ];
+		return {};
 
 	AGameAIController_eventGetActionString_Parms GetActionString_Parms;
 
@@ -50,10 +49,9 @@ struct FString AGameAIController::eventGetActionString ( )
 
 bool AGameAIController::eventGeneratePathToLocation ( struct FVector Goal, float WithinDistance, unsigned long bAllowPartialPath )
 {
-	static UFunction* pFnGeneratePathToLocation = NULL;
-
+	UFunction* pFnGeneratePathToLocation = (UFunction*) SdkBindings::Get ( 2555 );
 	if ( ! pFnGeneratePathToLocation )
-		pFnGeneratePathToLocation = (UFunction*) UObject::GObjObjects()->Data[ 33349 ];
+		return {};
 
 	AGameAIController_eventGeneratePathToLocation_Parms GeneratePathToLocation_Parms;
 	memcpy ( &GeneratePathToLocation_Parms.Goal, &Goal, 0xC );
@@ -75,10 +73,9 @@ bool AGameAIController::eventGeneratePathToLocation ( struct FVector Goal, float
 
 bool AGameAIController::eventGeneratePathToActor ( class AActor* Goal, float WithinDistance, unsigned long bAllowPartialPath )
 {
-	static UFunction* pFnGeneratePathToActor = NULL;
-
+	UFunction* pFnGeneratePathToActor = (UFunction*) SdkBindings::Get ( 2554 );
 	if ( ! pFnGeneratePathToActor )
-		pFnGeneratePathToActor = (UFunction*) UObject::GObjObjects()->Data[ 33344 ];
+		return {};
 
 	AGameAIController_eventGeneratePathToActor_Parms GeneratePathToActor_Parms;
 	GeneratePathToActor_Parms.Goal = Goal;
@@ -100,10 +97,9 @@ bool AGameAIController::eventGeneratePathToActor ( class AActor* Goal, float Wit
 
 void AGameAIController::SetDesiredRotation ( struct FRotator TargetDesiredRotation, unsigned long InLockDesiredRotation, unsigned long InUnlockWhenReached, float InterpolationTime )
 {
-	static UFunction* pFnSetDesiredRotation = NULL;
-
+	UFunction* pFnSetDesiredRotation = (UFunction*) SdkBindings::Get ( 2553 );
 	if ( ! pFnSetDesiredRotation )
-		pFnSetDesiredRotation = (UFunction*) UObject::GObjObjects()->Data[ 33339 ];
+		return;
 
 	AGameAIController_execSetDesiredRotation_Parms SetDesiredRotation_Parms;
 	memcpy ( &SetDesiredRotation_Parms.TargetDesiredRotation, &TargetDesiredRotation, 0xC );
@@ -123,10 +119,9 @@ void AGameAIController::SetDesiredRotation ( struct FRotator TargetDesiredRotati
 
 void AGameAIController::eventAILog_Internal ( struct FString LogText, struct FName LogCategory, unsigned long bForce )
 {
-	static UFunction* pFnAILog_Internal = NULL;
-
+	UFunction* pFnAILog_Internal = (UFunction*) SdkBindings::Get ( 2552 );
 	if ( ! pFnAILog_Internal )
-		pFnAILog_Internal = (UFunction*) UObject::GObjObjects()->Data[ 33335 ];
+		return;
 
 	AGameAIController_eventAILog_Internal_Parms AILog_Internal_Parms;
 	memcpy ( &AILog_Internal_Parms.LogText, &LogText, 0xC );
@@ -143,10 +138,9 @@ void AGameAIController::eventAILog_Internal ( struct FString LogText, struct FNa
 
 void AGameAIController::RecordDemoAILog ( struct FString LogText )
 {
-	static UFunction* pFnRecordDemoAILog = NULL;
-
+	UFunction* pFnRecordDemoAILog = (UFunction*) SdkBindings::Get ( 2551 );
 	if ( ! pFnRecordDemoAILog )
-		pFnRecordDemoAILog = (UFunction*) UObject::GObjObjects()->Data[ 33333 ];
+		return;
 
 	AGameAIController_execRecordDemoAILog_Parms RecordDemoAILog_Parms;
 	memcpy ( &RecordDemoAILog_Parms.LogText, &LogText, 0xC );
@@ -160,10 +154,9 @@ void AGameAIController::RecordDemoAILog ( struct FString LogText )
 
 void AGameAIController::eventDestroyed ( )
 {
-	static UFunction* pFnDestroyed = NULL;
-
+	UFunction* pFnDestroyed = (UFunction*) SdkBindings::Get ( 2550 );
 	if ( ! pFnDestroyed )
-		pFnDestroyed = (UFunction*) UObject::GObjObjects()->Data[ 33330 ];
+		return;
 
 	AGameAIController_eventDestroyed_Parms Destroyed_Parms;
 
@@ -178,10 +171,9 @@ void AGameAIController::eventDestroyed ( )
 
 class UGameAICommand* AGameAIController::GetAICommandInStack ( class UClass* InClass )
 {
-	static UFunction* pFnGetAICommandInStack = NULL;
-
+	UFunction* pFnGetAICommandInStack = (UFunction*) SdkBindings::Get ( 2549 );
 	if ( ! pFnGetAICommandInStack )
-		pFnGetAICommandInStack = (UFunction*) UObject::GObjObjects()->Data[ 33327 ];
+		return {};
 
 	AGameAIController_execGetAICommandInStack_Parms GetAICommandInStack_Parms;
 	GetAICommandInStack_Parms.InClass = InClass;
@@ -203,10 +195,9 @@ class UGameAICommand* AGameAIController::GetAICommandInStack ( class UClass* InC
 
 class UGameAICommand* AGameAIController::FindCommandOfClass ( class UClass* SearchClass )
 {
-	static UFunction* pFnFindCommandOfClass = NULL;
-
+	UFunction* pFnFindCommandOfClass = (UFunction*) SdkBindings::Get ( 2548 );
 	if ( ! pFnFindCommandOfClass )
-		pFnFindCommandOfClass = (UFunction*) UObject::GObjObjects()->Data[ 33324 ];
+		return {};
 
 	AGameAIController_execFindCommandOfClass_Parms FindCommandOfClass_Parms;
 	FindCommandOfClass_Parms.SearchClass = SearchClass;
@@ -226,10 +217,9 @@ class UGameAICommand* AGameAIController::FindCommandOfClass ( class UClass* Sear
 
 void AGameAIController::DumpCommandStack ( )
 {
-	static UFunction* pFnDumpCommandStack = NULL;
-
+	UFunction* pFnDumpCommandStack = (UFunction*) SdkBindings::Get ( 2547 );
 	if ( ! pFnDumpCommandStack )
-		pFnDumpCommandStack = (UFunction*) UObject::GObjObjects()->Data[ 33323 ];
+		return;
 
 	AGameAIController_execDumpCommandStack_Parms DumpCommandStack_Parms;
 
@@ -246,10 +236,9 @@ void AGameAIController::DumpCommandStack ( )
 
 void AGameAIController::CheckCommandCount ( )
 {
-	static UFunction* pFnCheckCommandCount = NULL;
-
+	UFunction* pFnCheckCommandCount = (UFunction*) SdkBindings::Get ( 2546 );
 	if ( ! pFnCheckCommandCount )
-		pFnCheckCommandCount = (UFunction*) UObject::GObjObjects()->Data[ 33322 ];
+		return;
 
 	AGameAIController_execCheckCommandCount_Parms CheckCommandCount_Parms;
 
@@ -267,10 +256,9 @@ void AGameAIController::CheckCommandCount ( )
 
 class UGameAICommand* AGameAIController::GetActiveCommand ( )
 {
-	static UFunction* pFnGetActiveCommand = NULL;
-
+	UFunction* pFnGetActiveCommand = (UFunction*) SdkBindings::Get ( 2545 );
 	if ( ! pFnGetActiveCommand )
-		pFnGetActiveCommand = (UFunction*) UObject::GObjObjects()->Data[ 33320 ];
+		return {};
 
 	AGameAIController_execGetActiveCommand_Parms GetActiveCommand_Parms;
 
@@ -292,10 +280,9 @@ class UGameAICommand* AGameAIController::GetActiveCommand ( )
 
 bool AGameAIController::AbortCommand ( class UGameAICommand* AbortCmd, class UClass* AbortClass )
 {
-	static UFunction* pFnAbortCommand = NULL;
-
+	UFunction* pFnAbortCommand = (UFunction*) SdkBindings::Get ( 2544 );
 	if ( ! pFnAbortCommand )
-		pFnAbortCommand = (UFunction*) UObject::GObjObjects()->Data[ 33316 ];
+		return {};
 
 	AGameAIController_execAbortCommand_Parms AbortCommand_Parms;
 	AbortCommand_Parms.AbortCmd = AbortCmd;
@@ -317,10 +304,9 @@ bool AGameAIController::AbortCommand ( class UGameAICommand* AbortCmd, class UCl
 
 void AGameAIController::PopCommand ( class UGameAICommand* ToBePoppedCommand )
 {
-	static UFunction* pFnPopCommand = NULL;
-
+	UFunction* pFnPopCommand = (UFunction*) SdkBindings::Get ( 2541 );
 	if ( ! pFnPopCommand )
-		pFnPopCommand = (UFunction*) UObject::GObjObjects()->Data[ 33297 ];
+		return;
 
 	AGameAIController_execPopCommand_Parms PopCommand_Parms;
 	PopCommand_Parms.ToBePoppedCommand = ToBePoppedCommand;
@@ -339,10 +325,9 @@ void AGameAIController::PopCommand ( class UGameAICommand* ToBePoppedCommand )
 
 void AGameAIController::PushCommand ( class UGameAICommand* NewCommand )
 {
-	static UFunction* pFnPushCommand = NULL;
-
+	UFunction* pFnPushCommand = (UFunction*) SdkBindings::Get ( 2523 );
 	if ( ! pFnPushCommand )
-		pFnPushCommand = (UFunction*) UObject::GObjObjects()->Data[ 33252 ];
+		return;
 
 	AGameAIController_execPushCommand_Parms PushCommand_Parms;
 	PushCommand_Parms.NewCommand = NewCommand;
@@ -362,10 +347,9 @@ void AGameAIController::PushCommand ( class UGameAICommand* NewCommand )
 
 void UGameAICommand::GetDebugOverheadText ( class APlayerController* PC, TArray< struct FString >* OutText )
 {
-	static UFunction* pFnGetDebugOverheadText = NULL;
-
+	UFunction* pFnGetDebugOverheadText = (UFunction*) SdkBindings::Get ( 2543 );
 	if ( ! pFnGetDebugOverheadText )
-		pFnGetDebugOverheadText = (UFunction*) UObject::GObjObjects()->Data[ 33302 ];
+		return;
 
 	UGameAICommand_execGetDebugOverheadText_Parms GetDebugOverheadText_Parms;
 	GetDebugOverheadText_Parms.PC = PC;
@@ -384,10 +368,9 @@ void UGameAICommand::GetDebugOverheadText ( class APlayerController* PC, TArray<
 
 void UGameAICommand::eventDrawDebug ( class AHUD* H, struct FName Category )
 {
-	static UFunction* pFnDrawDebug = NULL;
-
+	UFunction* pFnDrawDebug = (UFunction*) SdkBindings::Get ( 2542 );
 	if ( ! pFnDrawDebug )
-		pFnDrawDebug = (UFunction*) UObject::GObjObjects()->Data[ 33299 ];
+		return;
 
 	UGameAICommand_eventDrawDebug_Parms DrawDebug_Parms;
 	DrawDebug_Parms.H = H;
@@ -403,10 +386,9 @@ void UGameAICommand::eventDrawDebug ( class AHUD* H, struct FName Category )
 
 struct FString UGameAICommand::eventGetDumpString ( )
 {
-	static UFunction* pFnGetDumpString = NULL;
-
+	UFunction* pFnGetDumpString = (UFunction*) SdkBindings::Get ( 2540 );
 	if ( ! pFnGetDumpString )
-		pFnGetDumpString = (UFunction*) UObject::GObjObjects()->Data[ 33284 ];
+		return {};
 
 	UGameAICommand_eventGetDumpString_Parms GetDumpString_Parms;
 
@@ -422,10 +404,9 @@ struct FString UGameAICommand::eventGetDumpString ( )
 
 void UGameAICommand::Resumed ( struct FName OldCommandName )
 {
-	static UFunction* pFnResumed = NULL;
-
+	UFunction* pFnResumed = (UFunction*) SdkBindings::Get ( 2539 );
 	if ( ! pFnResumed )
-		pFnResumed = (UFunction*) UObject::GObjObjects()->Data[ 33282 ];
+		return;
 
 	UGameAICommand_execResumed_Parms Resumed_Parms;
 	memcpy ( &Resumed_Parms.OldCommandName, &OldCommandName, 0x8 );
@@ -440,10 +421,9 @@ void UGameAICommand::Resumed ( struct FName OldCommandName )
 
 void UGameAICommand::Paused ( class UGameAICommand* NewCommand )
 {
-	static UFunction* pFnPaused = NULL;
-
+	UFunction* pFnPaused = (UFunction*) SdkBindings::Get ( 2538 );
 	if ( ! pFnPaused )
-		pFnPaused = (UFunction*) UObject::GObjObjects()->Data[ 33280 ];
+		return;
 
 	UGameAICommand_execPaused_Parms Paused_Parms;
 	Paused_Parms.NewCommand = NewCommand;
@@ -457,10 +437,9 @@ void UGameAICommand::Paused ( class UGameAICommand* NewCommand )
 
 void UGameAICommand::Popped ( )
 {
-	static UFunction* pFnPopped = NULL;
-
+	UFunction* pFnPopped = (UFunction*) SdkBindings::Get ( 2537 );
 	if ( ! pFnPopped )
-		pFnPopped = (UFunction*) UObject::GObjObjects()->Data[ 33279 ];
+		return;
 
 	UGameAICommand_execPopped_Parms Popped_Parms;
 
@@ -473,10 +452,9 @@ void UGameAICommand::Popped ( )
 
 void UGameAICommand::Pushed ( )
 {
-	static UFunction* pFnPushed = NULL;
-
+	UFunction* pFnPushed = (UFunction*) SdkBindings::Get ( 2536 );
 	if ( ! pFnPushed )
-		pFnPushed = (UFunction*) UObject::GObjObjects()->Data[ 33278 ];
+		return;
 
 	UGameAICommand_execPushed_Parms Pushed_Parms;
 
@@ -489,10 +467,9 @@ void UGameAICommand::Pushed ( )
 
 void UGameAICommand::PostPopped ( )
 {
-	static UFunction* pFnPostPopped = NULL;
-
+	UFunction* pFnPostPopped = (UFunction*) SdkBindings::Get ( 2535 );
 	if ( ! pFnPostPopped )
-		pFnPostPopped = (UFunction*) UObject::GObjObjects()->Data[ 33277 ];
+		return;
 
 	UGameAICommand_execPostPopped_Parms PostPopped_Parms;
 
@@ -506,10 +483,9 @@ void UGameAICommand::PostPopped ( )
 
 void UGameAICommand::PrePushed ( class AGameAIController* AI )
 {
-	static UFunction* pFnPrePushed = NULL;
-
+	UFunction* pFnPrePushed = (UFunction*) SdkBindings::Get ( 2534 );
 	if ( ! pFnPrePushed )
-		pFnPrePushed = (UFunction*) UObject::GObjObjects()->Data[ 33275 ];
+		return;
 
 	UGameAICommand_execPrePushed_Parms PrePushed_Parms;
 	PrePushed_Parms.AI = AI;
@@ -525,10 +501,9 @@ void UGameAICommand::PrePushed ( class AGameAIController* AI )
 
 bool UGameAICommand::AllowStateTransitionTo ( struct FName StateName )
 {
-	static UFunction* pFnAllowStateTransitionTo = NULL;
-
+	UFunction* pFnAllowStateTransitionTo = (UFunction*) SdkBindings::Get ( 2533 );
 	if ( ! pFnAllowStateTransitionTo )
-		pFnAllowStateTransitionTo = (UFunction*) UObject::GObjObjects()->Data[ 33272 ];
+		return {};
 
 	UGameAICommand_execAllowStateTransitionTo_Parms AllowStateTransitionTo_Parms;
 	memcpy ( &AllowStateTransitionTo_Parms.StateName, &StateName, 0x8 );
@@ -546,10 +521,9 @@ bool UGameAICommand::AllowStateTransitionTo ( struct FName StateName )
 
 bool UGameAICommand::AllowTransitionTo ( class UClass* AttemptCommand )
 {
-	static UFunction* pFnAllowTransitionTo = NULL;
-
+	UFunction* pFnAllowTransitionTo = (UFunction*) SdkBindings::Get ( 2532 );
 	if ( ! pFnAllowTransitionTo )
-		pFnAllowTransitionTo = (UFunction*) UObject::GObjObjects()->Data[ 33268 ];
+		return {};
 
 	UGameAICommand_execAllowTransitionTo_Parms AllowTransitionTo_Parms;
 	AllowTransitionTo_Parms.AttemptCommand = AttemptCommand;
@@ -566,10 +540,9 @@ bool UGameAICommand::AllowTransitionTo ( class UClass* AttemptCommand )
 
 void UGameAICommand::Tick ( float DeltaTime )
 {
-	static UFunction* pFnTick = NULL;
-
+	UFunction* pFnTick = (UFunction*) SdkBindings::Get ( 2531 );
 	if ( ! pFnTick )
-		pFnTick = (UFunction*) UObject::GObjObjects()->Data[ 33266 ];
+		return;
 
 	UGameAICommand_execTick_Parms Tick_Parms;
 	Tick_Parms.DeltaTime = DeltaTime;
@@ -584,10 +557,9 @@ void UGameAICommand::Tick ( float DeltaTime )
 
 bool UGameAICommand::ShouldIgnoreNotifies ( )
 {
-	static UFunction* pFnShouldIgnoreNotifies = NULL;
-
+	UFunction* pFnShouldIgnoreNotifies = (UFunction*) SdkBindings::Get ( 2530 );
 	if ( ! pFnShouldIgnoreNotifies )
-		pFnShouldIgnoreNotifies = (UFunction*) UObject::GObjObjects()->Data[ 33264 ];
+		return {};
 
 	UGameAICommand_execShouldIgnoreNotifies_Parms ShouldIgnoreNotifies_Parms;
 
@@ -607,10 +579,9 @@ bool UGameAICommand::ShouldIgnoreNotifies ( )
 
 void UGameAICommand::eventInternalTick ( float DeltaTime )
 {
-	static UFunction* pFnInternalTick = NULL;
-
+	UFunction* pFnInternalTick = (UFunction*) SdkBindings::Get ( 2529 );
 	if ( ! pFnInternalTick )
-		pFnInternalTick = (UFunction*) UObject::GObjObjects()->Data[ 33262 ];
+		return;
 
 	UGameAICommand_eventInternalTick_Parms InternalTick_Parms;
 	InternalTick_Parms.DeltaTime = DeltaTime;
@@ -625,10 +596,9 @@ void UGameAICommand::eventInternalTick ( float DeltaTime )
 
 void UGameAICommand::eventInternalResumed ( struct FName OldCommandName )
 {
-	static UFunction* pFnInternalResumed = NULL;
-
+	UFunction* pFnInternalResumed = (UFunction*) SdkBindings::Get ( 2528 );
 	if ( ! pFnInternalResumed )
-		pFnInternalResumed = (UFunction*) UObject::GObjObjects()->Data[ 33260 ];
+		return;
 
 	UGameAICommand_eventInternalResumed_Parms InternalResumed_Parms;
 	memcpy ( &InternalResumed_Parms.OldCommandName, &OldCommandName, 0x8 );
@@ -643,10 +613,9 @@ void UGameAICommand::eventInternalResumed ( struct FName OldCommandName )
 
 void UGameAICommand::eventInternalPaused ( class UGameAICommand* NewCommand )
 {
-	static UFunction* pFnInternalPaused = NULL;
-
+	UFunction* pFnInternalPaused = (UFunction*) SdkBindings::Get ( 2527 );
 	if ( ! pFnInternalPaused )
-		pFnInternalPaused = (UFunction*) UObject::GObjObjects()->Data[ 33258 ];
+		return;
 
 	UGameAICommand_eventInternalPaused_Parms InternalPaused_Parms;
 	InternalPaused_Parms.NewCommand = NewCommand;
@@ -660,10 +629,9 @@ void UGameAICommand::eventInternalPaused ( class UGameAICommand* NewCommand )
 
 void UGameAICommand::eventInternalPopped ( )
 {
-	static UFunction* pFnInternalPopped = NULL;
-
+	UFunction* pFnInternalPopped = (UFunction*) SdkBindings::Get ( 2526 );
 	if ( ! pFnInternalPopped )
-		pFnInternalPopped = (UFunction*) UObject::GObjObjects()->Data[ 33257 ];
+		return;
 
 	UGameAICommand_eventInternalPopped_Parms InternalPopped_Parms;
 
@@ -676,10 +644,9 @@ void UGameAICommand::eventInternalPopped ( )
 
 void UGameAICommand::eventInternalPushed ( )
 {
-	static UFunction* pFnInternalPushed = NULL;
-
+	UFunction* pFnInternalPushed = (UFunction*) SdkBindings::Get ( 2525 );
 	if ( ! pFnInternalPushed )
-		pFnInternalPushed = (UFunction*) UObject::GObjObjects()->Data[ 33256 ];
+		return;
 
 	UGameAICommand_eventInternalPushed_Parms InternalPushed_Parms;
 
@@ -693,10 +660,9 @@ void UGameAICommand::eventInternalPushed ( )
 
 void UGameAICommand::eventInternalPrePushed ( class AGameAIController* AI )
 {
-	static UFunction* pFnInternalPrePushed = NULL;
-
+	UFunction* pFnInternalPrePushed = (UFunction*) SdkBindings::Get ( 2524 );
 	if ( ! pFnInternalPrePushed )
-		pFnInternalPrePushed = (UFunction*) UObject::GObjObjects()->Data[ 33253 ];
+		return;
 
 	UGameAICommand_eventInternalPrePushed_Parms InternalPrePushed_Parms;
 	InternalPrePushed_Parms.AI = AI;
@@ -712,10 +678,9 @@ void UGameAICommand::eventInternalPrePushed ( class AGameAIController* AI )
 
 bool UGameAICommand::InitCommand ( class AGameAIController* AI )
 {
-	static UFunction* pFnInitCommand = NULL;
-
+	UFunction* pFnInitCommand = (UFunction*) SdkBindings::Get ( 2522 );
 	if ( ! pFnInitCommand )
-		pFnInitCommand = (UFunction*) UObject::GObjObjects()->Data[ 33248 ];
+		return {};
 
 	UGameAICommand_execInitCommand_Parms InitCommand_Parms;
 	InitCommand_Parms.AI = AI;
@@ -734,10 +699,9 @@ bool UGameAICommand::InitCommand ( class AGameAIController* AI )
 
 bool UGameAICommand::InitCommandUserActor ( class AGameAIController* AI, class AActor* UserActor )
 {
-	static UFunction* pFnInitCommandUserActor = NULL;
-
+	UFunction* pFnInitCommandUserActor = (UFunction*) SdkBindings::Get ( 2521 );
 	if ( ! pFnInitCommandUserActor )
-		pFnInitCommandUserActor = (UFunction*) UObject::GObjObjects()->Data[ 33244 ];
+		return {};
 
 	UGameAICommand_execInitCommandUserActor_Parms InitCommandUserActor_Parms;
 	InitCommandUserActor_Parms.AI = AI;
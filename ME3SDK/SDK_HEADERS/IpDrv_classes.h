@@ -223,22 +223,13 @@ public:
 	struct FName                                       BeaconName;                                       		// 0x003C (0x0008) [0x0000000000000000]              
 	int                                                BeaconPort;                                       		// 0x0044 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1273 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1273 );
 	};
 
 };
 
-UClass* UClientBeaconAddressResolver::pClassPointer = NULL;
-
 // Class IpDrv.HTTPDownload
 // 0x0100 (0x0B70 - 0x0A70)
 class UHTTPDownload : public UDownload
@@ -250,22 +241,13 @@ public:
 	float                                              ConnectionTimeout;                                		// 0x0A84 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	unsigned char                                      UnknownData00[ 0xE8 ];                            		// 0x0A88 (0x00E8) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1274 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1274 );
 	};
 
 };
 
-UClass* UHTTPDownload::pClassPointer = NULL;
-
 // Class IpDrv.InternetLink
 // 0x001A (0x0210 - 0x01F6)
 class AInternetLink : public AInfo
@@ -281,16 +263,9 @@ public:
 	unsigned char                                      OutLineMode;                                      		// 0x020E (0x0001) [0x0000000000000000]              
 	unsigned char                                      ReceiveMode;                                      		// 0x020F (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1275 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1275 );
 	};
 
 	void eventResolveFailed ( );
@@ -304,8 +279,6 @@ public:
 	bool IsDataPending ( );
 };
 
-UClass* AInternetLink::pClassPointer = NULL;
-
 // Class IpDrv.TcpLink
 // 0x0025 (0x0235 - 0x0210)
 class ATcpLink : public AInternetLink
@@ -317,16 +290,9 @@ public:
 	struct FIpAddr                                     RemoteAddr;                                       		// 0x022C (0x0008) [0x0000000000000000]              
 	unsigned char                                      LinkState;                                        		// 0x0234 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1276 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1276 );
 	};
 
 	void eventReceivedBinary ( int Count, unsigned char* B );
@@ -346,8 +312,6 @@ public:
 	int BindPort ( int PortNum, unsigned long bUseNextAvailable );
 };
 
-UClass* ATcpLink::pClassPointer = NULL;
-
 // Class IpDrv.MCPBase
 // 0x0004 (0x0040 - 0x003C)
 class UMCPBase : public UObject
@@ -355,22 +319,13 @@ class UMCPBase : public UObject
 public:
 	struct FPointer                                    VfTable_FTickableObject;                          		// 0x003C (0x0004) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1277 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1277 );
 	};
 
 };
 
-UClass* UMCPBase::pClassPointer = NULL;
-
 // Class IpDrv.OnlineEventsInterfaceMcp
 // 0x0028 (0x0068 - 0x0040)
 class UOnlineEventsInterfaceMcp : public UMCPBase
@@ -381,16 +336,9 @@ public:
 	TArray< unsigned char >                            DisabledUploadTypes;                              		// 0x0058 (0x000C) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 	unsigned long                                      bBinaryStats : 1;                                 		// 0x0064 (0x0004) [0x0000000000004002] [0x00000001] ( CPF_Const | CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1278 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1278 );
 	};
 
 	bool UploadHardwareData ( struct FUniqueNetId UniqueId, struct FString PlayerNick );
@@ -398,8 +346,6 @@ public:
 	bool UploadProfileData ( struct FUniqueNetId UniqueId, struct FString PlayerNick, class UOnlineProfileSettings* ProfileSettings );
 };
 
-UClass* UOnlineEventsInterfaceMcp::pClassPointer = NULL;
-
 // Class IpDrv.OnlineNewsInterfaceMcp
 // 0x0028 (0x0068 - 0x0040)
 class UOnlineNewsInterfaceMcp : public UMCPBase
@@ -410,16 +356,9 @@ public:
 	struct FScriptDelegate                             __OnReadNewsCompleted__Delegate;                  		// 0x0058 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	unsigned long                                      bNeedsTicking : 1;                                		// 0x0064 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1279 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1279 );
 	};
 
 	struct FString GetNews ( unsigned char LocalUserNum, unsigned char NewsType );
@@ -429,8 +368,6 @@ public:
 	bool ReadNews ( unsigned char LocalUserNum, unsigned char NewsType );
 };
 
-UClass* UOnlineNewsInterfaceMcp::pClassPointer = NULL;
-
 // Class IpDrv.OnlineTitleFileDownloadMcp
 // 0x003C (0x007C - 0x0040)
 class UOnlineTitleFileDownloadMcp : public UMCPBase
@@ -444,16 +381,9 @@ public:
 	int                                                CurrentIndex;                                     		// 0x0074 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	float                                              TimeOut;                                          		// 0x0078 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1280 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1280 );
 	};
 
 	bool ClearDownloadedFiles ( );
@@ -465,8 +395,6 @@ public:
 	void OnReadTitleFileComplete ( unsigned long bWasSuccessful, struct FString Filename );
 };
 
-UClass* UOnlineTitleFileDownloadMcp::pClassPointer = NULL;
-
 // Class IpDrv.MeshBeacon
 // 0x003C (0x0078 - 0x003C)
 class UMeshBeacon : public UObject
@@ -489,23 +417,14 @@ public:
 	unsigned long                                      bWantsDeferredDestroy : 1;                        		// 0x0074 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 	unsigned long                                      bShouldTick : 1;                                  		// 0x0074 (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1281 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1281 );
 	};
 
 	void eventDestroyBeacon ( );
 };
 
-UClass* UMeshBeacon::pClassPointer = NULL;
-
 // Class IpDrv.MeshBeaconClient
 // 0x009E (0x0116 - 0x0078)
 class UMeshBeaconClient : public UMeshBeacon
@@ -528,16 +447,9 @@ public:
 	unsigned char                                      ClientBeaconState;                                		// 0x0114 (0x0001) [0x0000000000000000]              
 	unsigned char                                      ClientBeaconRequestType;                          		// 0x0115 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1282 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1282 );
 	};
 
 	bool SendHostNewGameSessionResponse ( unsigned long bSuccess, struct FName SessionName, class UClass* SearchClass, unsigned char* PlatformSpecificInfo );
@@ -551,8 +463,6 @@ public:
 	void eventDestroyBeacon ( );
 };
 
-UClass* UMeshBeaconClient::pClassPointer = NULL;
-
 // Class IpDrv.MeshBeaconHost
 // 0x0064 (0x00DC - 0x0078)
 class UMeshBeaconHost : public UMeshBeacon
@@ -569,16 +479,9 @@ public:
 	int                                                ConnectionBacklog;                                		// 0x00D4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	unsigned long                                      bAllowBandwidthTesting : 1;                       		// 0x00D8 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1283 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1283 );
 	};
 
 	void OnReceivedClientCreateNewSessionResult ( unsigned long bSucceeded, struct FName SessionName, class UClass* SearchClass, unsigned char* PlatformSpecificInfo );
@@ -601,8 +504,6 @@ public:
 	bool InitHostBeacon ( struct FUniqueNetId InOwningPlayerId );
 };
 
-UClass* UMeshBeaconHost::pClassPointer = NULL;
-
 // Class IpDrv.OnlineSubsystemCommonImpl
 // 0x0014 (0x00D4 - 0x00C0)
 class UOnlineSubsystemCommonImpl : public UOnlineSubsystem
@@ -614,16 +515,9 @@ public:
 	class UOnlineGameInterfaceImpl*                    GameInterfaceImpl;                                		// 0x00CC (0x0004) [0x0000000000000000]              
 	unsigned long                                      bIsUsingSpeechRecognition : 1;                    		// 0x00D0 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1284 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1284 );
 	};
 
 	void GetRegisteredPlayers ( struct FName SessionName, TArray< struct FUniqueNetId >* OutRegisteredPlayers );
@@ -632,8 +526,6 @@ public:
 	struct FString eventGetPlayerNicknameFromIndex ( int UserIndex );
 };
 
-UClass* UOnlineSubsystemCommonImpl::pClassPointer = NULL;
-
 // Class IpDrv.OnlineGameInterfaceImpl
 // 0x012E (0x016A - 0x003C)
 class UOnlineGameInterfaceImpl : public UObject
@@ -674,16 +566,9 @@ public:
 	unsigned char                                      CurrentGameState;                                 		// 0x0168 (0x0001) [0x0000000000000002]              ( CPF_Const )
 	unsigned char                                      LanBeaconState;                                   		// 0x0169 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1285 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1285 );
 	};
 
 	void ClearQuickMatchCompleteDelegate ( struct FScriptDelegate QuickMatchCompleteDelegate );
@@ -751,8 +636,6 @@ public:
 	void OnFindOnlineGamesComplete ( unsigned long bWasSuccessful );
 };
 
-UClass* UOnlineGameInterfaceImpl::pClassPointer = NULL;
-
 // Class IpDrv.PartyBeacon
 // 0x002C (0x0068 - 0x003C)
 class UPartyBeacon : public UObject
@@ -769,24 +652,15 @@ public:
 	unsigned long                                      bWantsDeferredDestroy : 1;                        		// 0x0064 (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned long                                      bShouldTick : 1;                                  		// 0x0064 (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1286 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1286 );
 	};
 
 	void OnDestroyComplete ( );
 	void eventDestroyBeacon ( );
 };
 
-UClass* UPartyBeacon::pClassPointer = NULL;
-
 // Class IpDrv.PartyBeaconClient
 // 0x007A (0x00E2 - 0x0068)
 class UPartyBeaconClient : public UPartyBeacon
@@ -807,16 +681,9 @@ public:
 	unsigned char                                      ClientBeaconState;                                		// 0x00E0 (0x0001) [0x0000000000000000]              
 	unsigned char                                      ClientBeaconRequestType;                          		// 0x00E1 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1287 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1287 );
 	};
 
 	void eventDestroyBeacon ( );
@@ -830,8 +697,6 @@ public:
 	void OnReservationRequestComplete ( unsigned char ReservationResult );
 };
 
-UClass* UPartyBeaconClient::pClassPointer = NULL;
-
 // Class IpDrv.PartyBeaconHost
 // 0x0060 (0x00C8 - 0x0068)
 class UPartyBeaconHost : public UPartyBeacon
@@ -851,16 +716,9 @@ public:
 	int                                                ReservedHostTeamNum;                              		// 0x00C0 (0x0004) [0x0000000000000002]              ( CPF_Const )
 	unsigned long                                      bBestFitTeamAssignment : 1;                       		// 0x00C4 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1288 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1288 );
 	};
 
 	int GetMaxAvailableTeamSize ( );
@@ -884,8 +742,6 @@ public:
 	bool InitHostBeacon ( int InNumTeams, int InNumPlayersPerTeam, int InNumReservations, struct FName InSessionName );
 };
 
-UClass* UPartyBeaconHost::pClassPointer = NULL;
-
 // Class IpDrv.TcpipConnection
 // 0x001C (0x4FD0 - 0x4FB4)
 class UTcpipConnection : public UNetConnection
@@ -893,22 +749,13 @@ class UTcpipConnection : public UNetConnection
 public:
 	unsigned char                                      UnknownData00[ 0x1C ];                            		// 0x4FB4 (0x001C) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1289 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1289 );
 	};
 
 };
 
-UClass* UTcpipConnection::pClassPointer = NULL;
-
 // Class IpDrv.TcpNetDriver
 // 0x001C (0x019C - 0x0180)
 class UTcpNetDriver : public UNetDriver
@@ -918,22 +765,13 @@ public:
 	unsigned long                                      LogPortUnreach : 1;                               		// 0x0184 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 	unsigned char                                      UnknownData00[ 0x14 ];                            		// 0x0188 (0x0014) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1290 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1290 );
 	};
 
 };
 
-UClass* UTcpNetDriver::pClassPointer = NULL;
-
 // Class IpDrv.WebRequest
 // 0x00B9 (0x00F5 - 0x003C)
 class UWebRequest : public UObject
@@ -949,16 +787,9 @@ public:
 	int                                                ContentLength;                                    		// 0x00F0 (0x0004) [0x0000000000000000]              
 	unsigned char                                      RequestType;                                      		// 0x00F4 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1291 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1291 );
 	};
 
 	int GetHexDigit ( struct FString D );
@@ -977,8 +808,6 @@ public:
 	struct FString DecodeBase64 ( struct FString Encoded );
 };
 
-UClass* UWebRequest::pClassPointer = NULL;
-
 // Class IpDrv.WebResponse
 // 0x0068 (0x00A4 - 0x003C)
 class UWebResponse : public UObject
@@ -992,16 +821,9 @@ public:
 	unsigned long                                      bSentText : 1;                                    		// 0x00A0 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      bSentResponse : 1;                                		// 0x00A0 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1292 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1292 );
 	};
 
 	bool SentResponse ( );
@@ -1027,8 +849,6 @@ public:
 	bool FileExists ( struct FString Filename );
 };
 
-UClass* UWebResponse::pClassPointer = NULL;
-
 // Class IpDrv.WebApplication
 // 0x0014 (0x0050 - 0x003C)
 class UWebApplication : public UObject
@@ -1038,16 +858,9 @@ public:
 	class AWorldInfo*                                  WorldInfo;                                        		// 0x0048 (0x0004) [0x0000000000000000]              
 	class AWebServer*                                  WebServer;                                        		// 0x004C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 33431 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2557 );
 	};
 
 	void PostQuery ( class UWebRequest* request, class UWebResponse* Response );
@@ -1058,8 +871,6 @@ public:
 	void Init ( );
 };
 
-UClass* UWebApplication::pClassPointer = NULL;
-
 // Class IpDrv.WebServer
 // 0x014F (0x0384 - 0x0235)
 class AWebServer : public ATcpLink
@@ -1078,16 +889,9 @@ public:
 	int                                                ConnId;                                           		// 0x037C (0x0004) [0x0000000000000000]              
 	unsigned long                                      bEnabled : 1;                                     		// 0x0380 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 33447 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2564 );
 	};
 
 	class UWebApplication* GetApplication ( struct FString URI, struct FString* SubURI );
@@ -1097,24 +901,15 @@ public:
 	void PostBeginPlay ( );
 };
 
-UClass* AWebServer::pClassPointer = NULL;
-
 // Class IpDrv.HelloWeb
 // 0x0000 (0x0050 - 0x0050)
 class UHelloWeb : public UWebApplication
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 33450 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2565 );
 	};
 
 	void PostQuery ( class UWebRequest* request, class UWebResponse* Response );
@@ -1125,24 +920,15 @@ public:
 	void Init ( );
 };
 
-UClass* UHelloWeb::pClassPointer = NULL;
-
 // Class IpDrv.ImageServer
 // 0x0000 (0x0050 - 0x0050)
 class UImageServer : public UWebApplication
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 33469 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2571 );
 	};
 
 	void PostQuery ( class UWebRequest* request, class UWebResponse* Response );
@@ -1153,8 +939,6 @@ public:
 	void Init ( );
 };
 
-UClass* UImageServer::pClassPointer = NULL;
-
 // Class IpDrv.WebConnection
 // 0x0033 (0x0268 - 0x0235)
 class AWebConnection : public ATcpLink
@@ -1171,16 +955,9 @@ public:
 	int                                                ConnId;                                           		// 0x0260 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bDelayCleanup : 1;                                		// 0x0264 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 34237 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2738 );
 	};
 
 	bool IsHanging ( );
@@ -1198,8 +975,6 @@ public:
 	void eventAccepted ( );
 };
 
-UClass* AWebConnection::pClassPointer = NULL;
-
 
 #ifdef _MSC_VER
 	#pragma pack ( pop )
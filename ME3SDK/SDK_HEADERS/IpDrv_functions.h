@@ -27,10 +27,9 @@
 
 void AInternetLink::eventResolveFailed ( )
 {
-	static UFunction* pFnResolveFailed = NULL;
-
+	UFunction* pFnResolveFailed = (UFunction*) SdkBindings::Get ( 2582 );
 	if ( ! pFnResolveFailed )
-		pFnResolveFailed = (UFunction*) UObject::GObjObjects()->Data[ 33509 ];
+		return;
 
 	AInternetLink_eventResolveFailed_Parms ResolveFailed_Parms;
 
@@ -44,10 +43,9 @@ void AInternetLink::eventResolveFailed ( )
 
 void AInternetLink::eventResolved ( struct FIpAddr Addr )
 {
-	static UFunction* pFnResolved = NULL;
-
+	UFunction* pFnResolved = (UFunction*) SdkBindings::Get ( 2581 );
 	if ( ! pFnResolved )
-		pFnResolved = (UFunction*) UObject::GObjObjects()->Data[ 33507 ];
+		return;
 
 	AInternetLink_eventResolved_Parms Resolved_Parms;
 	memcpy ( &Resolved_Parms.Addr, &Addr, 0x8 );
@@ -62,10 +60,9 @@ void AInternetLink::eventResolved ( struct FIpAddr Addr )
 
 void AInternetLink::GetLocalIP ( struct FIpAddr* Arg )
 {
-	static UFunction* pFnGetLocalIP = NULL;
-
+	UFunction* pFnGetLocalIP = (UFunction*) SdkBindings::Get ( 2580 );
 	if ( ! pFnGetLocalIP )
-		pFnGetLocalIP = (UFunction*) UObject::GObjObjects()->Data[ 33505 ];
+		return;
 
 	AInternetLink_execGetLocalIP_Parms GetLocalIP_Parms;
 
@@ -88,10 +85,9 @@ void AInternetLink::GetLocalIP ( struct FIpAddr* Arg )
 
 bool AInternetLink::StringToIpAddr ( struct FString Str, struct FIpAddr* Addr )
 {
-	static UFunction* pFnStringToIpAddr = NULL;
-
+	UFunction* pFnStringToIpAddr = (UFunction*) SdkBindings::Get ( 2579 );
 	if ( ! pFnStringToIpAddr )
-		pFnStringToIpAddr = (UFunction*) UObject::GObjObjects()->Data[ 33501 ];
+		return {};
 
 	AInternetLink_execStringToIpAddr_Parms StringToIpAddr_Parms;
 	memcpy ( &StringToIpAddr_Parms.Str, &Str, 0xC );
@@ -116,10 +112,9 @@ bool AInternetLink::StringToIpAddr ( struct FString Str, struct FIpAddr* Addr )
 
 struct FString AInternetLink::IpAddrToString ( struct FIpAddr Arg )
 {
-	static UFunction* pFnIpAddrToString = NULL;
-
+	UFunction* pFnIpAddrToString = (UFunction*) SdkBindings::Get ( 2578 );
 	if ( ! pFnIpAddrToString )
-		pFnIpAddrToString = (UFunction*) UObject::GObjObjects()->Data[ 33498 ];
+		return {};
 
 	AInternetLink_execIpAddrToString_Parms IpAddrToString_Parms;
 	memcpy ( &IpAddrToString_Parms.Arg, &Arg, 0x8 );
@@ -140,10 +135,9 @@ struct FString AInternetLink::IpAddrToString ( struct FIpAddr Arg )
 
 int AInternetLink::GetLastError ( )
 {
-	static UFunction* pFnGetLastError = NULL;
-
+	UFunction* pFnGetLastError = (UFunction*) SdkBindings::Get ( 2577 );
 	if ( ! pFnGetLastError )
-		pFnGetLastError = (UFunction*) UObject::GObjObjects()->Data[ 33496 ];
+		return {};
 
 	AInternetLink_execGetLastError_Parms GetLastError_Parms;
 
@@ -163,10 +157,9 @@ int AInternetLink::GetLastError ( )
 
 void AInternetLink::Resolve ( struct FString Domain )
 {
-	static UFunction* pFnResolve = NULL;
-
+	UFunction* pFnResolve = (UFunction*) SdkBindings::Get ( 2576 );
 	if ( ! pFnResolve )
-		pFnResolve = (UFunction*) UObject::GObjObjects()->Data[ 33494 ];
+		return;
 
 	AInternetLink_execResolve_Parms Resolve_Parms;
 	memcpy ( &Resolve_Parms.Domain, &Domain, 0xC );
@@ -190,10 +183,9 @@ void AInternetLink::Resolve ( struct FString Domain )
 
 bool AInternetLink::ParseURL ( struct FString URL, struct FString* Addr, int* PortNum, struct FString* LevelName, struct FString* EntryName )
 {
-	static UFunction* pFnParseURL = NULL;
-
+	UFunction* pFnParseURL = (UFunction*) SdkBindings::Get ( 2575 );
 	if ( ! pFnParseURL )
-		pFnParseURL = (UFunction*) UObject::GObjObjects()->Data[ 33487 ];
+		return {};
 
 	AInternetLink_execParseURL_Parms ParseURL_Parms;
 	memcpy ( &ParseURL_Parms.URL, &URL, 0xC );
@@ -226,10 +218,9 @@ bool AInternetLink::ParseURL ( struct FString URL, struct FString* Addr, int* Po
 
 bool AInternetLink::IsDataPending ( )
 {
-	static UFunction* pFnIsDataPending = NULL;
-
+	UFunction* pFnIsDataPending = (UFunction*) SdkBindings::Get ( 2574 );
 	if ( ! pFnIsDataPending )
-		pFnIsDataPending = (UFunction*) UObject::GObjObjects()->Data[ 33485 ];
+		return {};
 
 	AInternetLink_execIsDataPending_Parms IsDataPending_Parms;
 
@@ -250,10 +241,9 @@ bool AInternetLink::IsDataPending ( )
 
 void ATcpLink::eventReceivedBinary ( int Count, unsigned char* B )
 {
-	static UFunction* pFnReceivedBinary = NULL;
-
+	UFunction* pFnReceivedBinary = (UFunction*) SdkBindings::Get ( 2737 );
 	if ( ! pFnReceivedBinary )
-		pFnReceivedBinary = (UFunction*) UObject::GObjObjects()->Data[ 34230 ];
+		return;
 
 	ATcpLink_eventReceivedBinary_Parms ReceivedBinary_Parms;
 	ReceivedBinary_Parms.Count = Count;
@@ -269,10 +259,9 @@ void ATcpLink::eventReceivedBinary ( int Count, unsigned char* B )
 
 void ATcpLink::eventReceivedLine ( struct FString Line )
 {
-	static UFunction* pFnReceivedLine = NULL;
-
+	UFunction* pFnReceivedLine = (UFunction*) SdkBindings::Get ( 2736 );
 	if ( ! pFnReceivedLine )
-		pFnReceivedLine = (UFunction*) UObject::GObjObjects()->Data[ 34228 ];
+		return;
 
 	ATcpLink_eventReceivedLine_Parms ReceivedLine_Parms;
 	memcpy ( &ReceivedLine_Parms.Line, &Line, 0xC );
@@ -287,10 +276,9 @@ void ATcpLink::eventReceivedLine ( struct FString Line )
 
 void ATcpLink::eventReceivedText ( struct FString Text )
 {
-	static UFunction* pFnReceivedText = NULL;
-
+	UFunction* pFnReceivedText = (UFunction*) SdkBindings::Get ( 2735 );
 	if ( ! pFnReceivedText )
-		pFnReceivedText = (UFunction*) UObject::GObjObjects()->Data[ 34226 ];
+		return;
 
 	ATcpLink_eventReceivedText_Parms ReceivedText_Parms;
 	memcpy ( &ReceivedText_Parms.Text, &Text, 0xC );
@@ -304,10 +292,9 @@ void ATcpLink::eventReceivedText ( struct FString Text )
 
 void ATcpLink::eventClosed ( )
 {
-	static UFunction* pFnClosed = NULL;
-
+	UFunction* pFnClosed = (UFunction*) SdkBindings::Get ( 2734 );
 	if ( ! pFnClosed )
-		pFnClosed = (UFunction*) UObject::GObjObjects()->Data[ 34225 ];
+		return;
 
 	ATcpLink_eventClosed_Parms Closed_Parms;
 
@@ -320,10 +307,9 @@ void ATcpLink::eventClosed ( )
 
 void ATcpLink::eventOpened ( )
 {
-	static UFunction* pFnOpened = NULL;
-
+	UFunction* pFnOpened = (UFunction*) SdkBindings::Get ( 2733 );
 	if ( ! pFnOpened )
-		pFnOpened = (UFunction*) UObject::GObjObjects()->Data[ 34224 ];
+		return;
 
 	ATcpLink_eventOpened_Parms Opened_Parms;
 
@@ -336,10 +322,9 @@ void ATcpLink::eventOpened ( )
 
 void ATcpLink::eventAccepted ( )
 {
-	static UFunction* pFnAccepted = NULL;
-
+	UFunction* pFnAccepted = (UFunction*) SdkBindings::Get ( 2732 );
 	if ( ! pFnAccepted )
-		pFnAccepted = (UFunction*) UObject::GObjObjects()->Data[ 34223 ];
+		return;
 
 	ATcpLink_eventAccepted_Parms Accepted_Parms;
 
@@ -355,10 +340,9 @@ void ATcpLink::eventAccepted ( )
 
 int ATcpLink::ReadBinary ( int Count, unsigned char* B )
 {
-	static UFunction* pFnReadBinary = NULL;
-
+	UFunction* pFnReadBinary = (UFunction*) SdkBindings::Get ( 2731 );
 	if ( ! pFnReadBinary )
-		pFnReadBinary = (UFunction*) UObject::GObjObjects()->Data[ 34219 ];
+		return {};
 
 	ATcpLink_execReadBinary_Parms ReadBinary_Parms;
 	ReadBinary_Parms.Count = Count;
@@ -383,10 +367,9 @@ int ATcpLink::ReadBinary ( int Count, unsigned char* B )
 
 int ATcpLink::ReadText ( struct FString* Str )
 {
-	static UFunction* pFnReadText = NULL;
-
+	UFunction* pFnReadText = (UFunction*) SdkBindings::Get ( 2730 );
 	if ( ! pFnReadText )
-		pFnReadText = (UFunction*) UObject::GObjObjects()->Data[ 34216 ];
+		return {};
 
 	ATcpLink_execReadText_Parms ReadText_Parms;
 
@@ -411,10 +394,9 @@ int ATcpLink::ReadText ( struct FString* Str )
 
 int ATcpLink::SendBinary ( int Count, unsigned char* B )
 {
-	static UFunction* pFnSendBinary = NULL;
-
+	UFunction* pFnSendBinary = (UFunction*) SdkBindings::Get ( 2729 );
 	if ( ! pFnSendBinary )
-		pFnSendBinary = (UFunction*) UObject::GObjObjects()->Data[ 34212 ];
+		return {};
 
 	ATcpLink_execSendBinary_Parms SendBinary_Parms;
 	SendBinary_Parms.Count = Count;
@@ -437,10 +419,9 @@ int ATcpLink::SendBinary ( int Count, unsigned char* B )
 
 int ATcpLink::SendText ( struct FString Str )
 {
-	static UFunction* pFnSendText = NULL;
-
+	UFunction* pFnSendText = (UFunction*) SdkBindings::Get ( 2728 );
 	if ( ! pFnSendText )
-		pFnSendText = (UFunction*) UObject::GObjObjects()->Data[ 34209 ];
+		return {};
 
 	ATcpLink_execSendText_Parms SendText_Parms;
 	memcpy ( &SendText_Parms.Str, &Str, 0xC );
@@ -461,10 +442,9 @@ int ATcpLink::SendText ( struct FString Str )
 
 bool ATcpLink::IsConnected ( )
 {
-	static UFunction* pFnIsConnected = NULL;
-
+	UFunction* pFnIsConnected = (UFunction*) SdkBindings::Get ( 2727 );
 	if ( ! pFnIsConnected )
-		pFnIsConnected = (UFunction*) UObject::GObjObjects()->Data[ 34207 ];
+		return {};
 
 	ATcpLink_execIsConnected_Parms IsConnected_Parms;
 
@@ -484,10 +464,9 @@ bool ATcpLink::IsConnected ( )
 
 bool ATcpLink::Close ( )
 {
-	static UFunction* pFnClose = NULL;
-
+	UFunction* pFnClose = (UFunction*) SdkBindings::Get ( 2726 );
 	if ( ! pFnClose )
-		pFnClose = (UFunction*) UObject::GObjObjects()->Data[ 34205 ];
+		return {};
 
 	ATcpLink_execClose_Parms Close_Parms;
 
@@ -508,10 +487,9 @@ bool ATcpLink::Close ( )
 
 bool ATcpLink::Open ( struct FIpAddr Addr )
 {
-	static UFunction* pFnOpen = NULL;
-
+	UFunction* pFnOpen = (UFunction*) SdkBindings::Get ( 2725 );
 	if ( ! pFnOpen )
-		pFnOpen = (UFunction*) UObject::GObjObjects()->Data[ 34202 ];
+		return {};
 
 	ATcpLink_execOpen_Parms Open_Parms;
 	memcpy ( &Open_Parms.Addr, &Addr, 0x8 );
@@ -532,10 +510,9 @@ bool ATcpLink::Open ( struct FIpAddr Addr )
 
 bool ATcpLink::Listen ( )
 {
-	static UFunction* pFnListen = NULL;
-
+	UFunction* pFnListen = (UFunction*) SdkBindings::Get ( 2724 );
 	if ( ! pFnListen )
-		pFnListen = (UFunction*) UObject::GObjObjects()->Data[ 34200 ];
+		return {};
 
 	ATcpLink_execListen_Parms Listen_Parms;
 
@@ -557,10 +534,9 @@ bool ATcpLink::Listen ( )
 
 int ATcpLink::BindPort ( int PortNum, unsigned long bUseNextAvailable )
 {
-	static UFunction* pFnBindPort = NULL;
-
+	UFunction* pFnBindPort = (UFunction*) SdkBindings::Get ( 2723 );
 	if ( ! pFnBindPort )
-		pFnBindPort = (UFunction*) UObject::GObjObjects()->Data[ 34196 ];
+		return {};
 
 	ATcpLink_execBindPort_Parms BindPort_Parms;
 	BindPort_Parms.PortNum = PortNum;
@@ -584,10 +560,9 @@ int ATcpLink::BindPort ( int PortNum, unsigned long bUseNextAvailable )
 
 bool UOnlineEventsInterfaceMcp::UploadHardwareData ( struct FUniqueNetId UniqueId, struct FString PlayerNick )
 {
-	static UFunction* pFnUploadHardwareData = NULL;
-
+	UFunction* pFnUploadHardwareData = (UFunction*) SdkBindings::Get ( 2613 );
 	if ( ! pFnUploadHardwareData )
-		pFnUploadHardwareData = (UFunction*) UObject::GObjObjects()->Data[ 33721 ];
+		return {};
 
 	UOnlineEventsInterfaceMcp_execUploadHardwareData_Parms UploadHardwareData_Parms;
 	memcpy ( &UploadHardwareData_Parms.UniqueId, &UniqueId, 0x8 );
@@ -606,10 +581,9 @@ bool UOnlineEventsInterfaceMcp::UploadHardwareData ( struct FUniqueNetId UniqueI
 
 bool UOnlineEventsInterfaceMcp::UploadGameplayEventsData ( class UOnlineGameplayEvents* Events )
 {
-	static UFunction* pFnUploadGameplayEventsData = NULL;
-
+	UFunction* pFnUploadGameplayEventsData = (UFunction*) SdkBindings::Get ( 2612 );
 	if ( ! pFnUploadGameplayEventsData )
-		pFnUploadGameplayEventsData = (UFunction*) UObject::GObjObjects()->Data[ 33718 ];
+		return {};
 
 	UOnlineEventsInterfaceMcp_execUploadGameplayEventsData_Parms UploadGameplayEventsData_Parms;
 	UploadGameplayEventsData_Parms.Events = Events;
@@ -633,10 +607,9 @@ bool UOnlineEventsInterfaceMcp::UploadGameplayEventsData ( class UOnlineGameplay
 
 bool UOnlineEventsInterfaceMcp::UploadProfileData ( struct FUniqueNetId UniqueId, struct FString PlayerNick, class UOnlineProfileSettings* ProfileSettings )
 {
-	static UFunction* pFnUploadProfileData = NULL;
-
+	UFunction* pFnUploadProfileData = (UFunction*) SdkBindings::Get ( 2611 );
 	if ( ! pFnUploadProfileData )
-		pFnUploadProfileData = (UFunction*) UObject::GObjObjects()->Data[ 33713 ];
+		return {};
 
 	UOnlineEventsInterfaceMcp_execUploadProfileData_Parms UploadProfileData_Parms;
 	memcpy ( &UploadProfileData_Parms.UniqueId, &UniqueId, 0x8 );
@@ -661,10 +634,9 @@ bool UOnlineEventsInterfaceMcp::UploadProfileData ( struct FUniqueNetId UniqueId
 
 struct FString UOnlineNewsInterfaceMcp::GetNews ( unsigned char LocalUserNum, unsigned char NewsType )
 {
-	static UFunction* pFnGetNews = NULL;
-
+	UFunction* pFnGetNews = (UFunction*) SdkBindings::Get ( 2681 );
 	if ( ! pFnGetNews )
-		pFnGetNews = (UFunction*) UObject::GObjObjects()->Data[ 33980 ];
+		return {};
 
 	UOnlineNewsInterfaceMcp_execGetNews_Parms GetNews_Parms;
 	GetNews_Parms.LocalUserNum = LocalUserNum;
@@ -682,10 +654,9 @@ struct FString UOnlineNewsInterfaceMcp::GetNews ( unsigned char LocalUserNum, un
 
 void UOnlineNewsInterfaceMcp::ClearReadNewsCompletedDelegate ( struct FScriptDelegate ReadGameNewsDelegate )
 {
-	static UFunction* pFnClearReadNewsCompletedDelegate = NULL;
-
+	UFunction* pFnClearReadNewsCompletedDelegate = (UFunction*) SdkBindings::Get ( 2680 );
 	if ( ! pFnClearReadNewsCompletedDelegate )
-		pFnClearReadNewsCompletedDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33977 ];
+		return;
 
 	UOnlineNewsInterfaceMcp_execClearReadNewsCompletedDelegate_Parms ClearReadNewsCompletedDelegate_Parms;
 	memcpy ( &ClearReadNewsCompletedDelegate_Parms.ReadGameNewsDelegate, &ReadGameNewsDelegate, 0xC );
@@ -700,10 +671,9 @@ void UOnlineNewsInterfaceMcp::ClearReadNewsCompletedDelegate ( struct FScriptDel
 
 void UOnlineNewsInterfaceMcp::AddReadNewsCompletedDelegate ( struct FScriptDelegate ReadNewsDelegate )
 {
-	static UFunction* pFnAddReadNewsCompletedDelegate = NULL;
-
+	UFunction* pFnAddReadNewsCompletedDelegate = (UFunction*) SdkBindings::Get ( 2679 );
 	if ( ! pFnAddReadNewsCompletedDelegate )
-		pFnAddReadNewsCompletedDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33975 ];
+		return;
 
 	UOnlineNewsInterfaceMcp_execAddReadNewsCompletedDelegate_Parms AddReadNewsCompletedDelegate_Parms;
 	memcpy ( &AddReadNewsCompletedDelegate_Parms.ReadNewsDelegate, &ReadNewsDelegate, 0xC );
@@ -719,10 +689,9 @@ void UOnlineNewsInterfaceMcp::AddReadNewsCompletedDelegate ( struct FScriptDeleg
 
 void UOnlineNewsInterfaceMcp::OnReadNewsCompleted ( unsigned long bWasSuccessful, unsigned char NewsType )
 {
-	static UFunction* pFnOnReadNewsCompleted = NULL;
-
+	UFunction* pFnOnReadNewsCompleted = (UFunction*) SdkBindings::Get ( 2677 );
 	if ( ! pFnOnReadNewsCompleted )
-		pFnOnReadNewsCompleted = (UFunction*) UObject::GObjObjects()->Data[ 33961 ];
+		return;
 
 	UOnlineNewsInterfaceMcp_execOnReadNewsCompleted_Parms OnReadNewsCompleted_Parms;
 	OnReadNewsCompleted_Parms.bWasSuccessful = bWasSuccessful;
@@ -740,10 +709,9 @@ void UOnlineNewsInterfaceMcp::OnReadNewsCompleted ( unsigned long bWasSuccessful
 
 bool UOnlineNewsInterfaceMcp::ReadNews ( unsigned char LocalUserNum, unsigned char NewsType )
 {
-	static UFunction* pFnReadNews = NULL;
-
+	UFunction* pFnReadNews = (UFunction*) SdkBindings::Get ( 2678 );
 	if ( ! pFnReadNews )
-		pFnReadNews = (UFunction*) UObject::GObjObjects()->Data[ 33969 ];
+		return {};
 
 	UOnlineNewsInterfaceMcp_execReadNews_Parms ReadNews_Parms;
 	ReadNews_Parms.LocalUserNum = LocalUserNum;
@@ -765,10 +733,9 @@ bool UOnlineNewsInterfaceMcp::ReadNews ( unsigned char LocalUserNum, unsigned ch
 
 bool UOnlineTitleFileDownloadMcp::ClearDownloadedFiles ( )
 {
-	static UFunction* pFnClearDownloadedFiles = NULL;
-
+	UFunction* pFnClearDownloadedFiles = (UFunction*) SdkBindings::Get ( 2692 );
 	if ( ! pFnClearDownloadedFiles )
-		pFnClearDownloadedFiles = (UFunction*) UObject::GObjObjects()->Data[ 34032 ];
+		return {};
 
 	UOnlineTitleFileDownloadMcp_execClearDownloadedFiles_Parms ClearDownloadedFiles_Parms;
 
@@ -789,10 +756,9 @@ bool UOnlineTitleFileDownloadMcp::ClearDownloadedFiles ( )
 
 unsigned char UOnlineTitleFileDownloadMcp::GetTitleFileState ( struct FString Filename )
 {
-	static UFunction* pFnGetTitleFileState = NULL;
-
+	UFunction* pFnGetTitleFileState = (UFunction*) SdkBindings::Get ( 2691 );
 	if ( ! pFnGetTitleFileState )
-		pFnGetTitleFileState = (UFunction*) UObject::GObjObjects()->Data[ 34028 ];
+		return {};
 
 	UOnlineTitleFileDownloadMcp_execGetTitleFileState_Parms GetTitleFileState_Parms;
 	memcpy ( &GetTitleFileState_Parms.Filename, &Filename, 0xC );
@@ -811,10 +777,9 @@ unsigned char UOnlineTitleFileDownloadMcp::GetTitleFileState ( struct FString Fi
 
 bool UOnlineTitleFileDownloadMcp::GetTitleFileContents ( struct FString Filename, TArray< unsigned char >* FileContents )
 {
-	static UFunction* pFnGetTitleFileContents = NULL;
-
+	UFunction* pFnGetTitleFileContents = (UFunction*) SdkBindings::Get ( 2690 );
 	if ( ! pFnGetTitleFileContents )
-		pFnGetTitleFileContents = (UFunction*) UObject::GObjObjects()->Data[ 34023 ];
+		return {};
 
 	UOnlineTitleFileDownloadMcp_execGetTitleFileContents_Parms GetTitleFileContents_Parms;
 	memcpy ( &GetTitleFileContents_Parms.Filename, &Filename, 0xC );
@@ -838,10 +803,9 @@ bool UOnlineTitleFileDownloadMcp::GetTitleFileContents ( struct FString Filename
 
 void UOnlineTitleFileDownloadMcp::ClearReadTitleFileCompleteDelegate ( struct FScriptDelegate ReadTitleFileCompleteDelegate )
 {
-	static UFunction* pFnClearReadTitleFileCompleteDelegate = NULL;
-
+	UFunction* pFnClearReadTitleFileCompleteDelegate = (UFunction*) SdkBindings::Get ( 2689 );
 	if ( ! pFnClearReadTitleFileCompleteDelegate )
-		pFnClearReadTitleFileCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 34020 ];
+		return;
 
 	UOnlineTitleFileDownloadMcp_execClearReadTitleFileCompleteDelegate_Parms ClearReadTitleFileCompleteDelegate_Parms;
 	memcpy ( &ClearReadTitleFileCompleteDelegate_Parms.ReadTitleFileCompleteDelegate, &ReadTitleFileCompleteDelegate, 0xC );
@@ -856,10 +820,9 @@ void UOnlineTitleFileDownloadMcp::ClearReadTitleFileCompleteDelegate ( struct FS
 
 void UOnlineTitleFileDownloadMcp::AddReadTitleFileCompleteDelegate ( struct FScriptDelegate ReadTitleFileCompleteDelegate )
 {
-	static UFunction* pFnAddReadTitleFileCompleteDelegate = NULL;
-
+	UFunction* pFnAddReadTitleFileCompleteDelegate = (UFunction*) SdkBindings::Get ( 2688 );
 	if ( ! pFnAddReadTitleFileCompleteDelegate )
-		pFnAddReadTitleFileCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 34018 ];
+		return;
 
 	UOnlineTitleFileDownloadMcp_execAddReadTitleFileCompleteDelegate_Parms AddReadTitleFileCompleteDelegate_Parms;
 	memcpy ( &AddReadTitleFileCompleteDelegate_Parms.ReadTitleFileCompleteDelegate, &ReadTitleFileCompleteDelegate, 0xC );
@@ -875,10 +838,9 @@ void UOnlineTitleFileDownloadMcp::AddReadTitleFileCompleteDelegate ( struct FScr
 
 bool UOnlineTitleFileDownloadMcp::ReadTitleFile ( struct FString FileToRead )
 {
-	static UFunction* pFnReadTitleFile = NULL;
-
+	UFunction* pFnReadTitleFile = (UFunction*) SdkBindings::Get ( 2687 );
 	if ( ! pFnReadTitleFile )
-		pFnReadTitleFile = (UFunction*) UObject::GObjObjects()->Data[ 34015 ];
+		return {};
 
 	UOnlineTitleFileDownloadMcp_execReadTitleFile_Parms ReadTitleFile_Parms;
 	memcpy ( &ReadTitleFile_Parms.FileToRead, &FileToRead, 0xC );
@@ -900,10 +862,9 @@ bool UOnlineTitleFileDownloadMcp::ReadTitleFile ( struct FString FileToRead )
 
 void UOnlineTitleFileDownloadMcp::OnReadTitleFileComplete ( unsigned long bWasSuccessful, struct FString Filename )
 {
-	static UFunction* pFnOnReadTitleFileComplete = NULL;
-
+	UFunction* pFnOnReadTitleFileComplete = (UFunction*) SdkBindings::Get ( 2686 );
 	if ( ! pFnOnReadTitleFileComplete )
-		pFnOnReadTitleFileComplete = (UFunction*) UObject::GObjObjects()->Data[ 34010 ];
+		return;
 
 	UOnlineTitleFileDownloadMcp_execOnReadTitleFileComplete_Parms OnReadTitleFileComplete_Parms;
 	OnReadTitleFileComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -918,10 +879,9 @@ void UOnlineTitleFileDownloadMcp::OnReadTitleFileComplete ( unsigned long bWasSu
 
 void UMeshBeacon::eventDestroyBeacon ( )
 {
-	static UFunction* pFnDestroyBeacon = NULL;
-
+	UFunction* pFnDestroyBeacon = (UFunction*) SdkBindings::Get ( 2583 );
 	if ( ! pFnDestroyBeacon )
-		pFnDestroyBeacon = (UFunction*) UObject::GObjObjects()->Data[ 33533 ];
+		return;
 
 	UMeshBeacon_eventDestroyBeacon_Parms DestroyBeacon_Parms;
 
@@ -943,10 +903,9 @@ void UMeshBeacon::eventDestroyBeacon ( )
 
 bool UMeshBeaconClient::SendHostNewGameSessionResponse ( unsigned long bSuccess, struct FName SessionName, class UClass* SearchClass, unsigned char* PlatformSpecificInfo )
 {
-	static UFunction* pFnSendHostNewGameSessionResponse = NULL;
-
+	UFunction* pFnSendHostNewGameSessionResponse = (UFunction*) SdkBindings::Get ( 2592 );
 	if ( ! pFnSendHostNewGameSessionResponse )
-		pFnSendHostNewGameSessionResponse = (UFunction*) UObject::GObjObjects()->Data[ 33593 ];
+		return {};
 
 	UMeshBeaconClient_execSendHostNewGameSessionResponse_Parms SendHostNewGameSessionResponse_Parms;
 	SendHostNewGameSessionResponse_Parms.bSuccess = bSuccess;
@@ -974,10 +933,9 @@ bool UMeshBeaconClient::SendHostNewGameSessionResponse ( unsigned long bSuccess,
 
 void UMeshBeaconClient::OnCreateNewSessionRequestReceived ( struct FName SessionName, class UClass* SearchClass, TArray< struct FPlayerMember >* Players )
 {
-	static UFunction* pFnOnCreateNewSessionRequestReceived = NULL;
-
+	UFunction* pFnOnCreateNewSessionRequestReceived = (UFunction*) SdkBindings::Get ( 2591 );
 	if ( ! pFnOnCreateNewSessionRequestReceived )
-		pFnOnCreateNewSessionRequestReceived = (UFunction*) UObject::GObjObjects()->Data[ 33588 ];
+		return;
 
 	UMeshBeaconClient_execOnCreateNewSessionRequestReceived_Parms OnCreateNewSessionRequestReceived_Parms;
 	memcpy ( &OnCreateNewSessionRequestReceived_Parms.SessionName, &SessionName, 0x8 );
@@ -998,10 +956,9 @@ void UMeshBeaconClient::OnCreateNewSessionRequestReceived ( struct FName Session
 
 void UMeshBeaconClient::OnTravelRequestReceived ( struct FName SessionName, class UClass* SearchClass, unsigned char* PlatformSpecificInfo )
 {
-	static UFunction* pFnOnTravelRequestReceived = NULL;
-
+	UFunction* pFnOnTravelRequestReceived = (UFunction*) SdkBindings::Get ( 2590 );
 	if ( ! pFnOnTravelRequestReceived )
-		pFnOnTravelRequestReceived = (UFunction*) UObject::GObjObjects()->Data[ 33584 ];
+		return;
 
 	UMeshBeaconClient_execOnTravelRequestReceived_Parms OnTravelRequestReceived_Parms;
 	memcpy ( &OnTravelRequestReceived_Parms.SessionName, &SessionName, 0x8 );
@@ -1022,10 +979,9 @@ void UMeshBeaconClient::OnTravelRequestReceived ( struct FName SessionName, clas
 
 void UMeshBeaconClient::OnReceivedBandwidthTestResults ( unsigned char testType, unsigned char TestResult, struct FConnectionBandwidthStats* BandwidthStats )
 {
-	static UFunction* pFnOnReceivedBandwidthTestResults = NULL;
-
+	UFunction* pFnOnReceivedBandwidthTestResults = (UFunction*) SdkBindings::Get ( 2589 );
 	if ( ! pFnOnReceivedBandwidthTestResults )
-		pFnOnReceivedBandwidthTestResults = (UFunction*) UObject::GObjObjects()->Data[ 33580 ];
+		return;
 
 	UMeshBeaconClient_execOnReceivedBandwidthTestResults_Parms OnReceivedBandwidthTestResults_Parms;
 	OnReceivedBandwidthTestResults_Parms.testType = testType;
@@ -1044,10 +1000,9 @@ void UMeshBeaconClient::OnReceivedBandwidthTestResults ( unsigned char testType,
 
 void UMeshBeaconClient::OnReceivedBandwidthTestRequest ( unsigned char testType )
 {
-	static UFunction* pFnOnReceivedBandwidthTestRequest = NULL;
-
+	UFunction* pFnOnReceivedBandwidthTestRequest = (UFunction*) SdkBindings::Get ( 2588 );
 	if ( ! pFnOnReceivedBandwidthTestRequest )
-		pFnOnReceivedBandwidthTestRequest = (UFunction*) UObject::GObjObjects()->Data[ 33578 ];
+		return;
 
 	UMeshBeaconClient_execOnReceivedBandwidthTestRequest_Parms OnReceivedBandwidthTestRequest_Parms;
 	OnReceivedBandwidthTestRequest_Parms.testType = testType;
@@ -1062,10 +1017,9 @@ void UMeshBeaconClient::OnReceivedBandwidthTestRequest ( unsigned char testType
 
 void UMeshBeaconClient::OnConnectionRequestResult ( unsigned char ConnectionResult )
 {
-	static UFunction* pFnOnConnectionRequestResult = NULL;
-
+	UFunction* pFnOnConnectionRequestResult = (UFunction*) SdkBindings::Get ( 2587 );
 	if ( ! pFnOnConnectionRequestResult )
-		pFnOnConnectionRequestResult = (UFunction*) UObject::GObjObjects()->Data[ 33576 ];
+		return;
 
 	UMeshBeaconClient_execOnConnectionRequestResult_Parms OnConnectionRequestResult_Parms;
 	OnConnectionRequestResult_Parms.ConnectionResult = ConnectionResult;
@@ -1082,10 +1036,9 @@ void UMeshBeaconClient::OnConnectionRequestResult ( unsigned char ConnectionResu
 
 bool UMeshBeaconClient::BeginBandwidthTest ( unsigned char testType, int TestBufferSize )
 {
-	static UFunction* pFnBeginBandwidthTest = NULL;
-
+	UFunction* pFnBeginBandwidthTest = (UFunction*) SdkBindings::Get ( 2586 );
 	if ( ! pFnBeginBandwidthTest )
-		pFnBeginBandwidthTest = (UFunction*) UObject::GObjObjects()->Data[ 33572 ];
+		return {};
 
 	UMeshBeaconClient_execBeginBandwidthTest_Parms BeginBandwidthTest_Parms;
 	BeginBandwidthTest_Parms.testType = testType;
@@ -1110,10 +1063,9 @@ bool UMeshBeaconClient::BeginBandwidthTest ( unsigned char testType, int TestBuf
 
 bool UMeshBeaconClient::RequestConnection ( unsigned long bRegisterSecureAddress, struct FOnlineGameSearchResult* DesiredHost, struct FClientConnectionRequest* ClientRequest )
 {
-	static UFunction* pFnRequestConnection = NULL;
-
+	UFunction* pFnRequestConnection = (UFunction*) SdkBindings::Get ( 2585 );
 	if ( ! pFnRequestConnection )
-		pFnRequestConnection = (UFunction*) UObject::GObjObjects()->Data[ 33567 ];
+		return {};
 
 	UMeshBeaconClient_execRequestConnection_Parms RequestConnection_Parms;
 	RequestConnection_Parms.bRegisterSecureAddress = bRegisterSecureAddress;
@@ -1139,10 +1091,9 @@ bool UMeshBeaconClient::RequestConnection ( unsigned long bRegisterSecureAddress
 
 void UMeshBeaconClient::eventDestroyBeacon ( )
 {
-	static UFunction* pFnDestroyBeacon = NULL;
-
+	UFunction* pFnDestroyBeacon = (UFunction*) SdkBindings::Get ( 2584 );
 	if ( ! pFnDestroyBeacon )
-		pFnDestroyBeacon = (UFunction*) UObject::GObjObjects()->Data[ 33566 ];
+		return;
 
 	UMeshBeaconClient_eventDestroyBeacon_Parms DestroyBeacon_Parms;
 
@@ -1163,10 +1114,9 @@ void UMeshBeaconClient::eventDestroyBeacon ( )
 
 void UMeshBeaconHost::OnReceivedClientCreateNewSessionResult ( unsigned long bSucceeded, struct FName SessionName, class UClass* SearchClass, unsigned char* PlatformSpecificInfo )
 {
-	static UFunction* pFnOnReceivedClientCreateNewSessionResult = NULL;
-
+	UFunction* pFnOnReceivedClientCreateNewSessionResult = (UFunction*) SdkBindings::Get ( 2610 );
 	if ( ! pFnOnReceivedClientCreateNewSessionResult )
-		pFnOnReceivedClientCreateNewSessionResult = (UFunction*) UObject::GObjObjects()->Data[ 33689 ];
+		return;
 
 	UMeshBeaconHost_execOnReceivedClientCreateNewSessionResult_Parms OnReceivedClientCreateNewSessionResult_Parms;
 	OnReceivedClientCreateNewSessionResult_Parms.bSucceeded = bSucceeded;
@@ -1190,10 +1140,9 @@ void UMeshBeaconHost::OnReceivedClientCreateNewSessionResult ( unsigned long bSu
 
 bool UMeshBeaconHost::RequestClientCreateNewSession ( struct FUniqueNetId PlayerNetId, struct FName SessionName, class UClass* SearchClass, TArray< struct FPlayerMember >* Players )
 {
-	static UFunction* pFnRequestClientCreateNewSession = NULL;
-
+	UFunction* pFnRequestClientCreateNewSession = (UFunction*) SdkBindings::Get ( 2609 );
 	if ( ! pFnRequestClientCreateNewSession )
-		pFnRequestClientCreateNewSession = (UFunction*) UObject::GObjObjects()->Data[ 33682 ];
+		return {};
 
 	UMeshBeaconHost_execRequestClientCreateNewSession_Parms RequestClientCreateNewSession_Parms;
 	memcpy ( &RequestClientCreateNewSession_Parms.PlayerNetId, &PlayerNetId, 0x8 );
@@ -1221,10 +1170,9 @@ bool UMeshBeaconHost::RequestClientCreateNewSession ( struct FUniqueNetId Player
 
 void UMeshBeaconHost::TellClientsToTravel ( struct FName SessionName, class UClass* SearchClass, unsigned char* PlatformSpecificInfo )
 {
-	static UFunction* pFnTellClientsToTravel = NULL;
-
+	UFunction* pFnTellClientsToTravel = (UFunction*) SdkBindings::Get ( 2608 );
 	if ( ! pFnTellClientsToTravel )
-		pFnTellClientsToTravel = (UFunction*) UObject::GObjObjects()->Data[ 33678 ];
+		return;
 
 	UMeshBeaconHost_execTellClientsToTravel_Parms TellClientsToTravel_Parms;
 	memcpy ( &TellClientsToTravel_Parms.SessionName, &SessionName, 0x8 );
@@ -1246,10 +1194,9 @@ void UMeshBeaconHost::TellClientsToTravel ( struct FName SessionName, class UCla
 
 void UMeshBeaconHost::OnAllPendingPlayersConnected ( )
 {
-	static UFunction* pFnOnAllPendingPlayersConnected = NULL;
-
+	UFunction* pFnOnAllPendingPlayersConnected = (UFunction*) SdkBindings::Get ( 2607 );
 	if ( ! pFnOnAllPendingPlayersConnected )
-		pFnOnAllPendingPlayersConnected = (UFunction*) UObject::GObjObjects()->Data[ 33677 ];
+		return;
 
 	UMeshBeaconHost_execOnAllPendingPlayersConnected_Parms OnAllPendingPlayersConnected_Parms;
 
@@ -1264,10 +1211,9 @@ void UMeshBeaconHost::OnAllPendingPlayersConnected ( )
 
 bool UMeshBeaconHost::AllPlayersConnected ( TArray< struct FUniqueNetId >* Players )
 {
-	static UFunction* pFnAllPlayersConnected = NULL;
-
+	UFunction* pFnAllPlayersConnected = (UFunction*) SdkBindings::Get ( 2606 );
 	if ( ! pFnAllPlayersConnected )
-		pFnAllPlayersConnected = (UFunction*) UObject::GObjObjects()->Data[ 33673 ];
+		return {};
 
 	UMeshBeaconHost_execAllPlayersConnected_Parms AllPlayersConnected_Parms;
 
@@ -1291,10 +1237,9 @@ bool UMeshBeaconHost::AllPlayersConnected ( TArray< struct FUniqueNetId >* Playe
 
 int UMeshBeaconHost::GetConnectionIndexForPlayer ( struct FUniqueNetId PlayerNetId )
 {
-	static UFunction* pFnGetConnectionIndexForPlayer = NULL;
-
+	UFunction* pFnGetConnectionIndexForPlayer = (UFunction*) SdkBindings::Get ( 2605 );
 	if ( ! pFnGetConnectionIndexForPlayer )
-		pFnGetConnectionIndexForPlayer = (UFunction*) UObject::GObjObjects()->Data[ 33670 ];
+		return {};
 
 	UMeshBeaconHost_execGetConnectionIndexForPlayer_Parms GetConnectionIndexForPlayer_Parms;
 	memcpy ( &GetConnectionIndexForPlayer_Parms.PlayerNetId, &PlayerNetId, 0x8 );
@@ -1315,10 +1260,9 @@ int UMeshBeaconHost::GetConnectionIndexForPlayer ( struct FUniqueNetId PlayerNet
 
 void UMeshBeaconHost::SetPendingPlayerConnections ( TArray< struct FUniqueNetId >* Players )
 {
-	static UFunction* pFnSetPendingPlayerConnections = NULL;
-
+	UFunction* pFnSetPendingPlayerConnections = (UFunction*) SdkBindings::Get ( 2604 );
 	if ( ! pFnSetPendingPlayerConnections )
-		pFnSetPendingPlayerConnections = (UFunction*) UObject::GObjObjects()->Data[ 33667 ];
+		return;
 
 	UMeshBeaconHost_execSetPendingPlayerConnections_Parms SetPendingPlayerConnections_Parms;
 
@@ -1338,10 +1282,9 @@ void UMeshBeaconHost::SetPendingPlayerConnections ( TArray< struct FUniqueNetId
 
 void UMeshBeaconHost::OnFinishedBandwidthTest ( struct FUniqueNetId PlayerNetId, unsigned char testType, unsigned char TestResult, struct FConnectionBandwidthStats* BandwidthStats )
 {
-	static UFunction* pFnOnFinishedBandwidthTest = NULL;
-
+	UFunction* pFnOnFinishedBandwidthTest = (UFunction*) SdkBindings::Get ( 2603 );
 	if ( ! pFnOnFinishedBandwidthTest )
-		pFnOnFinishedBandwidthTest = (UFunction*) UObject::GObjObjects()->Data[ 33662 ];
+		return;
 
 	UMeshBeaconHost_execOnFinishedBandwidthTest_Parms OnFinishedBandwidthTest_Parms;
 	memcpy ( &OnFinishedBandwidthTest_Parms.PlayerNetId, &PlayerNetId, 0x8 );
@@ -1362,10 +1305,9 @@ void UMeshBeaconHost::OnFinishedBandwidthTest ( struct FUniqueNetId PlayerNetId,
 
 void UMeshBeaconHost::OnStartedBandwidthTest ( struct FUniqueNetId PlayerNetId, unsigned char testType )
 {
-	static UFunction* pFnOnStartedBandwidthTest = NULL;
-
+	UFunction* pFnOnStartedBandwidthTest = (UFunction*) SdkBindings::Get ( 2602 );
 	if ( ! pFnOnStartedBandwidthTest )
-		pFnOnStartedBandwidthTest = (UFunction*) UObject::GObjObjects()->Data[ 33659 ];
+		return;
 
 	UMeshBeaconHost_execOnStartedBandwidthTest_Parms OnStartedBandwidthTest_Parms;
 	memcpy ( &OnStartedBandwidthTest_Parms.PlayerNetId, &PlayerNetId, 0x8 );
@@ -1381,10 +1323,9 @@ void UMeshBeaconHost::OnStartedBandwidthTest ( struct FUniqueNetId PlayerNetId,
 
 void UMeshBeaconHost::OnReceivedClientConnectionRequest ( struct FClientMeshBeaconConnection* NewClientConnection )
 {
-	static UFunction* pFnOnReceivedClientConnectionRequest = NULL;
-
+	UFunction* pFnOnReceivedClientConnectionRequest = (UFunction*) SdkBindings::Get ( 2601 );
 	if ( ! pFnOnReceivedClientConnectionRequest )
-		pFnOnReceivedClientConnectionRequest = (UFunction*) UObject::GObjObjects()->Data[ 33657 ];
+		return;
 
 	UMeshBeaconHost_execOnReceivedClientConnectionRequest_Parms OnReceivedClientConnectionRequest_Parms;
 
@@ -1401,10 +1342,9 @@ void UMeshBeaconHost::OnReceivedClientConnectionRequest ( struct FClientMeshBeac
 
 void UMeshBeaconHost::AllowBandwidthTesting ( unsigned long bEnabled )
 {
-	static UFunction* pFnAllowBandwidthTesting = NULL;
-
+	UFunction* pFnAllowBandwidthTesting = (UFunction*) SdkBindings::Get ( 2600 );
 	if ( ! pFnAllowBandwidthTesting )
-		pFnAllowBandwidthTesting = (UFunction*) UObject::GObjObjects()->Data[ 33654 ];
+		return;
 
 	UMeshBeaconHost_execAllowBandwidthTesting_Parms AllowBandwidthTesting_Parms;
 	AllowBandwidthTesting_Parms.bEnabled = bEnabled;
@@ -1418,10 +1358,9 @@ void UMeshBeaconHost::AllowBandwidthTesting ( unsigned long bEnabled )
 
 void UMeshBeaconHost::CancelPendingBandwidthTests ( )
 {
-	static UFunction* pFnCancelPendingBandwidthTests = NULL;
-
+	UFunction* pFnCancelPendingBandwidthTests = (UFunction*) SdkBindings::Get ( 2599 );
 	if ( ! pFnCancelPendingBandwidthTests )
-		pFnCancelPendingBandwidthTests = (UFunction*) UObject::GObjObjects()->Data[ 33653 ];
+		return;
 
 	UMeshBeaconHost_execCancelPendingBandwidthTests_Parms CancelPendingBandwidthTests_Parms;
 
@@ -1439,10 +1378,9 @@ void UMeshBeaconHost::CancelPendingBandwidthTests ( )
 
 bool UMeshBeaconHost::HasPendingBandwidthTest ( )
 {
-	static UFunction* pFnHasPendingBandwidthTest = NULL;
-
+	UFunction* pFnHasPendingBandwidthTest = (UFunction*) SdkBindings::Get ( 2598 );
 	if ( ! pFnHasPendingBandwidthTest )
-		pFnHasPendingBandwidthTest = (UFunction*) UObject::GObjObjects()->Data[ 33651 ];
+		return {};
 
 	UMeshBeaconHost_execHasPendingBandwidthTest_Parms HasPendingBandwidthTest_Parms;
 
@@ -1461,10 +1399,9 @@ bool UMeshBeaconHost::HasPendingBandwidthTest ( )
 
 void UMeshBeaconHost::CancelInProgressBandwidthTests ( )
 {
-	static UFunction* pFnCancelInProgressBandwidthTests = NULL;
-
+	UFunction* pFnCancelInProgressBandwidthTests = (UFunction*) SdkBindings::Get ( 2597 );
 	if ( ! pFnCancelInProgressBandwidthTests )
-		pFnCancelInProgressBandwidthTests = (UFunction*) UObject::GObjObjects()->Data[ 33650 ];
+		return;
 
 	UMeshBeaconHost_execCancelInProgressBandwidthTests_Parms CancelInProgressBandwidthTests_Parms;
 
@@ -1482,10 +1419,9 @@ void UMeshBeaconHost::CancelInProgressBandwidthTests ( )
 
 bool UMeshBeaconHost::HasInProgressBandwidthTest ( )
 {
-	static UFunction* pFnHasInProgressBandwidthTest = NULL;
-
+	UFunction* pFnHasInProgressBandwidthTest = (UFunction*) SdkBindings::Get ( 2596 );
 	if ( ! pFnHasInProgressBandwidthTest )
-		pFnHasInProgressBandwidthTest = (UFunction*) UObject::GObjObjects()->Data[ 33648 ];
+		return {};
 
 	UMeshBeaconHost_execHasInProgressBandwidthTest_Parms HasInProgressBandwidthTest_Parms;
 
@@ -1508,10 +1444,9 @@ bool UMeshBeaconHost::HasInProgressBandwidthTest ( )
 
 bool UMeshBeaconHost::RequestClientBandwidthTest ( struct FUniqueNetId PlayerNetId, unsigned char testType, int TestBufferSize )
 {
-	static UFunction* pFnRequestClientBandwidthTest = NULL;
-
+	UFunction* pFnRequestClientBandwidthTest = (UFunction*) SdkBindings::Get ( 2595 );
 	if ( ! pFnRequestClientBandwidthTest )
-		pFnRequestClientBandwidthTest = (UFunction*) UObject::GObjObjects()->Data[ 33643 ];
+		return {};
 
 	UMeshBeaconHost_execRequestClientBandwidthTest_Parms RequestClientBandwidthTest_Parms;
 	memcpy ( &RequestClientBandwidthTest_Parms.PlayerNetId, &PlayerNetId, 0x8 );
@@ -1533,10 +1468,9 @@ bool UMeshBeaconHost::RequestClientBandwidthTest ( struct FUniqueNetId PlayerNet
 
 void UMeshBeaconHost::eventDestroyBeacon ( )
 {
-	static UFunction* pFnDestroyBeacon = NULL;
-
+	UFunction* pFnDestroyBeacon = (UFunction*) SdkBindings::Get ( 2594 );
 	if ( ! pFnDestroyBeacon )
-		pFnDestroyBeacon = (UFunction*) UObject::GObjObjects()->Data[ 33642 ];
+		return;
 
 	UMeshBeaconHost_eventDestroyBeacon_Parms DestroyBeacon_Parms;
 
@@ -1555,10 +1489,9 @@ void UMeshBeaconHost::eventDestroyBeacon ( )
 
 bool UMeshBeaconHost::InitHostBeacon ( struct FUniqueNetId InOwningPlayerId )
 {
-	static UFunction* pFnInitHostBeacon = NULL;
-
+	UFunction* pFnInitHostBeacon = (UFunction*) SdkBindings::Get ( 2593 );
 	if ( ! pFnInitHostBeacon )
-		pFnInitHostBeacon = (UFunction*) UObject::GObjObjects()->Data[ 33639 ];
+		return {};
 
 	UMeshBeaconHost_execInitHostBeacon_Parms InitHostBeacon_Parms;
 	memcpy ( &InitHostBeacon_Parms.InOwningPlayerId, &InOwningPlayerId, 0x8 );
@@ -1580,10 +1513,9 @@ bool UMeshBeaconHost::InitHostBeacon ( struct FUniqueNetId InOwningPlayerId )
 
 void UOnlineSubsystemCommonImpl::GetRegisteredPlayers ( struct FName SessionName, TArray< struct FUniqueNetId >* OutRegisteredPlayers )
 {
-	static UFunction* pFnGetRegisteredPlayers = NULL;
-
+	UFunction* pFnGetRegisteredPlayers = (UFunction*) SdkBindings::Get ( 2685 );
 	if ( ! pFnGetRegisteredPlayers )
-		pFnGetRegisteredPlayers = (UFunction*) UObject::GObjObjects()->Data[ 33997 ];
+		return;
 
 	UOnlineSubsystemCommonImpl_execGetRegisteredPlayers_Parms GetRegisteredPlayers_Parms;
 	memcpy ( &GetRegisteredPlayers_Parms.SessionName, &SessionName, 0x8 );
@@ -1603,10 +1535,9 @@ void UOnlineSubsystemCommonImpl::GetRegisteredPlayers ( struct FName SessionName
 
 bool UOnlineSubsystemCommonImpl::IsPlayerInSession ( struct FName SessionName, struct FUniqueNetId PlayerID )
 {
-	static UFunction* pFnIsPlayerInSession = NULL;
-
+	UFunction* pFnIsPlayerInSession = (UFunction*) SdkBindings::Get ( 2684 );
 	if ( ! pFnIsPlayerInSession )
-		pFnIsPlayerInSession = (UFunction*) UObject::GObjObjects()->Data[ 33993 ];
+		return {};
 
 	UOnlineSubsystemCommonImpl_execIsPlayerInSession_Parms IsPlayerInSession_Parms;
 	memcpy ( &IsPlayerInSession_Parms.SessionName, &SessionName, 0x8 );
@@ -1629,10 +1560,9 @@ bool UOnlineSubsystemCommonImpl::IsPlayerInSession ( struct FName SessionName, s
 
 struct FUniqueNetId UOnlineSubsystemCommonImpl::eventGetPlayerUniqueNetIdFromIndex ( int UserIndex )
 {
-	static UFunction* pFnGetPlayerUniqueNetIdFromIndex = NULL;
-
+	UFunction* pFnGetPlayerUniqueNetIdFromIndex = (UFunction*) SdkBindings::Get ( 2683 );
 	if ( ! pFnGetPlayerUniqueNetIdFromIndex )
-		pFnGetPlayerUniqueNetIdFromIndex = (UFunction*) UObject::GObjObjects()->Data[ 33990 ];
+		return {};
 
 	UOnlineSubsystemCommonImpl_eventGetPlayerUniqueNetIdFromIndex_Parms GetPlayerUniqueNetIdFromIndex_Parms;
 	GetPlayerUniqueNetIdFromIndex_Parms.UserIndex = UserIndex;
@@ -1650,10 +1580,9 @@ struct FUniqueNetId UOnlineSubsystemCommonImpl::eventGetPlayerUniqueNetIdFromInd
 
 struct FString UOnlineSubsystemCommonImpl::eventGetPlayerNicknameFromIndex ( int UserIndex )
 {
-	static UFunction* pFnGetPlayerNicknameFromIndex = NULL;
-
+	UFunction* pFnGetPlayerNicknameFromIndex = (UFunction*) SdkBindings::Get ( 2682 );
 	if ( ! pFnGetPlayerNicknameFromIndex )
-		pFnGetPlayerNicknameFromIndex = (UFunction*) UObject::GObjObjects()->Data[ 33987 ];
+		return {};
 
 	UOnlineSubsystemCommonImpl_eventGetPlayerNicknameFromIndex_Parms GetPlayerNicknameFromIndex_Parms;
 	GetPlayerNicknameFromIndex_Parms.UserIndex = UserIndex;
@@ -1670,10 +1599,9 @@ struct FString UOnlineSubsystemCommonImpl::eventGetPlayerNicknameFromIndex ( int
 
 void UOnlineGameInterfaceImpl::ClearQuickMatchCompleteDelegate ( struct FScriptDelegate QuickMatchCompleteDelegate )
 {
-	static UFunction* pFnClearQuickMatchCompleteDelegate = NULL;
-
+	UFunction* pFnClearQuickMatchCompleteDelegate = (UFunction*) SdkBindings::Get ( 2676 );
 	if ( ! pFnClearQuickMatchCompleteDelegate )
-		pFnClearQuickMatchCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33930 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execClearQuickMatchCompleteDelegate_Parms ClearQuickMatchCompleteDelegate_Parms;
 	memcpy ( &ClearQuickMatchCompleteDelegate_Parms.QuickMatchCompleteDelegate, &QuickMatchCompleteDelegate, 0xC );
@@ -1688,10 +1616,9 @@ void UOnlineGameInterfaceImpl::ClearQuickMatchCompleteDelegate ( struct FScriptD
 
 void UOnlineGameInterfaceImpl::AddQuickMatchCompleteDelegate ( struct FScriptDelegate QuickMatchCompleteDelegate )
 {
-	static UFunction* pFnAddQuickMatchCompleteDelegate = NULL;
-
+	UFunction* pFnAddQuickMatchCompleteDelegate = (UFunction*) SdkBindings::Get ( 2675 );
 	if ( ! pFnAddQuickMatchCompleteDelegate )
-		pFnAddQuickMatchCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33928 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execAddQuickMatchCompleteDelegate_Parms AddQuickMatchCompleteDelegate_Parms;
 	memcpy ( &AddQuickMatchCompleteDelegate_Parms.QuickMatchCompleteDelegate, &QuickMatchCompleteDelegate, 0xC );
@@ -1706,10 +1633,9 @@ void UOnlineGameInterfaceImpl::AddQuickMatchCompleteDelegate ( struct FScriptDel
 
 void UOnlineGameInterfaceImpl::OnQuickMatchComplete ( unsigned char Result )
 {
-	static UFunction* pFnOnQuickMatchComplete = NULL;
-
+	UFunction* pFnOnQuickMatchComplete = (UFunction*) SdkBindings::Get ( 2674 );
 	if ( ! pFnOnQuickMatchComplete )
-		pFnOnQuickMatchComplete = (UFunction*) UObject::GObjObjects()->Data[ 33926 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execOnQuickMatchComplete_Parms OnQuickMatchComplete_Parms;
 	OnQuickMatchComplete_Parms.Result = Result;
@@ -1725,10 +1651,9 @@ void UOnlineGameInterfaceImpl::OnQuickMatchComplete ( unsigned char Result )
 
 bool UOnlineGameInterfaceImpl::QuickMatch ( class UOnlineGameSettings* quickMatchSettings )
 {
-	static UFunction* pFnQuickMatch = NULL;
-
+	UFunction* pFnQuickMatch = (UFunction*) SdkBindings::Get ( 2673 );
 	if ( ! pFnQuickMatch )
-		pFnQuickMatch = (UFunction*) UObject::GObjObjects()->Data[ 33923 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execQuickMatch_Parms QuickMatch_Parms;
 	QuickMatch_Parms.quickMatchSettings = quickMatchSettings;
@@ -1745,10 +1670,9 @@ bool UOnlineGameInterfaceImpl::QuickMatch ( class UOnlineGameSettings* quickMatc
 
 bool UOnlineGameInterfaceImpl::ForceCleanUp ( )
 {
-	static UFunction* pFnForceCleanUp = NULL;
-
+	UFunction* pFnForceCleanUp = (UFunction*) SdkBindings::Get ( 2672 );
 	if ( ! pFnForceCleanUp )
-		pFnForceCleanUp = (UFunction*) UObject::GObjObjects()->Data[ 33921 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execForceCleanUp_Parms ForceCleanUp_Parms;
 
@@ -1767,10 +1691,9 @@ bool UOnlineGameInterfaceImpl::ForceCleanUp ( )
 
 bool UOnlineGameInterfaceImpl::BindPlatformSpecificSessionToSearch ( unsigned char SearchingPlayerNum, class UOnlineGameSearch* SearchSettings, unsigned char* PlatformSpecificInfo )
 {
-	static UFunction* pFnBindPlatformSpecificSessionToSearch = NULL;
-
+	UFunction* pFnBindPlatformSpecificSessionToSearch = (UFunction*) SdkBindings::Get ( 2671 );
 	if ( ! pFnBindPlatformSpecificSessionToSearch )
-		pFnBindPlatformSpecificSessionToSearch = (UFunction*) UObject::GObjObjects()->Data[ 33916 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execBindPlatformSpecificSessionToSearch_Parms BindPlatformSpecificSessionToSearch_Parms;
 	BindPlatformSpecificSessionToSearch_Parms.SearchingPlayerNum = SearchingPlayerNum;
@@ -1795,10 +1718,9 @@ bool UOnlineGameInterfaceImpl::BindPlatformSpecificSessionToSearch ( unsigned ch
 
 bool UOnlineGameInterfaceImpl::ReadPlatformSpecificSessionInfoBySessionName ( struct FName SessionName, unsigned char* PlatformSpecificInfo )
 {
-	static UFunction* pFnReadPlatformSpecificSessionInfoBySessionName = NULL;
-
+	UFunction* pFnReadPlatformSpecificSessionInfoBySessionName = (UFunction*) SdkBindings::Get ( 2670 );
 	if ( ! pFnReadPlatformSpecificSessionInfoBySessionName )
-		pFnReadPlatformSpecificSessionInfoBySessionName = (UFunction*) UObject::GObjObjects()->Data[ 33912 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execReadPlatformSpecificSessionInfoBySessionName_Parms ReadPlatformSpecificSessionInfoBySessionName_Parms;
 	memcpy ( &ReadPlatformSpecificSessionInfoBySessionName_Parms.SessionName, &SessionName, 0x8 );
@@ -1820,10 +1742,9 @@ bool UOnlineGameInterfaceImpl::ReadPlatformSpecificSessionInfoBySessionName ( st
 
 bool UOnlineGameInterfaceImpl::ReadPlatformSpecificSessionInfo ( struct FOnlineGameSearchResult* DesiredGame, unsigned char* PlatformSpecificInfo )
 {
-	static UFunction* pFnReadPlatformSpecificSessionInfo = NULL;
-
+	UFunction* pFnReadPlatformSpecificSessionInfo = (UFunction*) SdkBindings::Get ( 2669 );
 	if ( ! pFnReadPlatformSpecificSessionInfo )
-		pFnReadPlatformSpecificSessionInfo = (UFunction*) UObject::GObjObjects()->Data[ 33908 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execReadPlatformSpecificSessionInfo_Parms ReadPlatformSpecificSessionInfo_Parms;
 
@@ -1851,10 +1772,9 @@ bool UOnlineGameInterfaceImpl::ReadPlatformSpecificSessionInfo ( struct FOnlineG
 
 bool UOnlineGameInterfaceImpl::QueryNonAdvertisedData ( int StartAt, int NumberToQuery )
 {
-	static UFunction* pFnQueryNonAdvertisedData = NULL;
-
+	UFunction* pFnQueryNonAdvertisedData = (UFunction*) SdkBindings::Get ( 2668 );
 	if ( ! pFnQueryNonAdvertisedData )
-		pFnQueryNonAdvertisedData = (UFunction*) UObject::GObjObjects()->Data[ 33904 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execQueryNonAdvertisedData_Parms QueryNonAdvertisedData_Parms;
 	QueryNonAdvertisedData_Parms.StartAt = StartAt;
@@ -1874,10 +1794,9 @@ bool UOnlineGameInterfaceImpl::QueryNonAdvertisedData ( int StartAt, int NumberT
 
 bool UOnlineGameInterfaceImpl::RecalculateSkillRating ( struct FName SessionName, TArray< struct FUniqueNetId >* Players )
 {
-	static UFunction* pFnRecalculateSkillRating = NULL;
-
+	UFunction* pFnRecalculateSkillRating = (UFunction*) SdkBindings::Get ( 2667 );
 	if ( ! pFnRecalculateSkillRating )
-		pFnRecalculateSkillRating = (UFunction*) UObject::GObjObjects()->Data[ 33899 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execRecalculateSkillRating_Parms RecalculateSkillRating_Parms;
 	memcpy ( &RecalculateSkillRating_Parms.SessionName, &SessionName, 0x8 );
@@ -1899,10 +1818,9 @@ bool UOnlineGameInterfaceImpl::RecalculateSkillRating ( struct FName SessionName
 
 bool UOnlineGameInterfaceImpl::AcceptGameInvite ( unsigned char LocalUserNum, struct FName SessionName )
 {
-	static UFunction* pFnAcceptGameInvite = NULL;
-
+	UFunction* pFnAcceptGameInvite = (UFunction*) SdkBindings::Get ( 2666 );
 	if ( ! pFnAcceptGameInvite )
-		pFnAcceptGameInvite = (UFunction*) UObject::GObjObjects()->Data[ 33895 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execAcceptGameInvite_Parms AcceptGameInvite_Parms;
 	AcceptGameInvite_Parms.LocalUserNum = LocalUserNum;
@@ -1921,10 +1839,9 @@ bool UOnlineGameInterfaceImpl::AcceptGameInvite ( unsigned char LocalUserNum, st
 
 void UOnlineGameInterfaceImpl::ClearGameInviteAcceptedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate GameInviteAcceptedDelegate )
 {
-	static UFunction* pFnClearGameInviteAcceptedDelegate = NULL;
-
+	UFunction* pFnClearGameInviteAcceptedDelegate = (UFunction*) SdkBindings::Get ( 2665 );
 	if ( ! pFnClearGameInviteAcceptedDelegate )
-		pFnClearGameInviteAcceptedDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33892 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execClearGameInviteAcceptedDelegate_Parms ClearGameInviteAcceptedDelegate_Parms;
 	ClearGameInviteAcceptedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -1941,10 +1858,9 @@ void UOnlineGameInterfaceImpl::ClearGameInviteAcceptedDelegate ( unsigned char L
 
 void UOnlineGameInterfaceImpl::AddGameInviteAcceptedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate GameInviteAcceptedDelegate )
 {
-	static UFunction* pFnAddGameInviteAcceptedDelegate = NULL;
-
+	UFunction* pFnAddGameInviteAcceptedDelegate = (UFunction*) SdkBindings::Get ( 2664 );
 	if ( ! pFnAddGameInviteAcceptedDelegate )
-		pFnAddGameInviteAcceptedDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33889 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execAddGameInviteAcceptedDelegate_Parms AddGameInviteAcceptedDelegate_Parms;
 	AddGameInviteAcceptedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -1960,10 +1876,9 @@ void UOnlineGameInterfaceImpl::AddGameInviteAcceptedDelegate ( unsigned char Loc
 
 void UOnlineGameInterfaceImpl::OnGameInviteAccepted ( struct FOnlineGameSearchResult* InviteResult )
 {
-	static UFunction* pFnOnGameInviteAccepted = NULL;
-
+	UFunction* pFnOnGameInviteAccepted = (UFunction*) SdkBindings::Get ( 2663 );
 	if ( ! pFnOnGameInviteAccepted )
-		pFnOnGameInviteAccepted = (UFunction*) UObject::GObjObjects()->Data[ 33887 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execOnGameInviteAccepted_Parms OnGameInviteAccepted_Parms;
 
@@ -1981,10 +1896,9 @@ void UOnlineGameInterfaceImpl::OnGameInviteAccepted ( struct FOnlineGameSearchRe
 
 TArray< struct FOnlineArbitrationRegistrant > UOnlineGameInterfaceImpl::GetArbitratedPlayers ( struct FName SessionName )
 {
-	static UFunction* pFnGetArbitratedPlayers = NULL;
-
+	UFunction* pFnGetArbitratedPlayers = (UFunction*) SdkBindings::Get ( 2662 );
 	if ( ! pFnGetArbitratedPlayers )
-		pFnGetArbitratedPlayers = (UFunction*) UObject::GObjObjects()->Data[ 33883 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execGetArbitratedPlayers_Parms GetArbitratedPlayers_Parms;
 	memcpy ( &GetArbitratedPlayers_Parms.SessionName, &SessionName, 0x8 );
@@ -2001,10 +1915,9 @@ TArray< struct FOnlineArbitrationRegistrant > UOnlineGameInterfaceImpl::GetArbit
 
 void UOnlineGameInterfaceImpl::ClearArbitrationRegistrationCompleteDelegate ( struct FScriptDelegate ArbitrationRegistrationCompleteDelegate )
 {
-	static UFunction* pFnClearArbitrationRegistrationCompleteDelegate = NULL;
-
+	UFunction* pFnClearArbitrationRegistrationCompleteDelegate = (UFunction*) SdkBindings::Get ( 2661 );
 	if ( ! pFnClearArbitrationRegistrationCompleteDelegate )
-		pFnClearArbitrationRegistrationCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33881 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execClearArbitrationRegistrationCompleteDelegate_Parms ClearArbitrationRegistrationCompleteDelegate_Parms;
 	memcpy ( &ClearArbitrationRegistrationCompleteDelegate_Parms.ArbitrationRegistrationCompleteDelegate, &ArbitrationRegistrationCompleteDelegate, 0xC );
@@ -2019,10 +1932,9 @@ void UOnlineGameInterfaceImpl::ClearArbitrationRegistrationCompleteDelegate ( st
 
 void UOnlineGameInterfaceImpl::AddArbitrationRegistrationCompleteDelegate ( struct FScriptDelegate ArbitrationRegistrationCompleteDelegate )
 {
-	static UFunction* pFnAddArbitrationRegistrationCompleteDelegate = NULL;
-
+	UFunction* pFnAddArbitrationRegistrationCompleteDelegate = (UFunction*) SdkBindings::Get ( 2660 );
 	if ( ! pFnAddArbitrationRegistrationCompleteDelegate )
-		pFnAddArbitrationRegistrationCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33879 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execAddArbitrationRegistrationCompleteDelegate_Parms AddArbitrationRegistrationCompleteDelegate_Parms;
 	memcpy ( &AddArbitrationRegistrationCompleteDelegate_Parms.ArbitrationRegistrationCompleteDelegate, &ArbitrationRegistrationCompleteDelegate, 0xC );
@@ -2038,10 +1950,9 @@ void UOnlineGameInterfaceImpl::AddArbitrationRegistrationCompleteDelegate ( stru
 
 void UOnlineGameInterfaceImpl::OnArbitrationRegistrationComplete ( struct FName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnArbitrationRegistrationComplete = NULL;
-
+	UFunction* pFnOnArbitrationRegistrationComplete = (UFunction*) SdkBindings::Get ( 2659 );
 	if ( ! pFnOnArbitrationRegistrationComplete )
-		pFnOnArbitrationRegistrationComplete = (UFunction*) UObject::GObjObjects()->Data[ 33876 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execOnArbitrationRegistrationComplete_Parms OnArbitrationRegistrationComplete_Parms;
 	memcpy ( &OnArbitrationRegistrationComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -2058,10 +1969,9 @@ void UOnlineGameInterfaceImpl::OnArbitrationRegistrationComplete ( struct FName
 
 bool UOnlineGameInterfaceImpl::RegisterForArbitration ( struct FName SessionName )
 {
-	static UFunction* pFnRegisterForArbitration = NULL;
-
+	UFunction* pFnRegisterForArbitration = (UFunction*) SdkBindings::Get ( 2658 );
 	if ( ! pFnRegisterForArbitration )
-		pFnRegisterForArbitration = (UFunction*) UObject::GObjObjects()->Data[ 33873 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execRegisterForArbitration_Parms RegisterForArbitration_Parms;
 	memcpy ( &RegisterForArbitration_Parms.SessionName, &SessionName, 0x8 );
@@ -2078,10 +1988,9 @@ bool UOnlineGameInterfaceImpl::RegisterForArbitration ( struct FName SessionName
 
 void UOnlineGameInterfaceImpl::ClearEndOnlineGameCompleteDelegate ( struct FScriptDelegate EndOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnClearEndOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnClearEndOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 2657 );
 	if ( ! pFnClearEndOnlineGameCompleteDelegate )
-		pFnClearEndOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33870 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execClearEndOnlineGameCompleteDelegate_Parms ClearEndOnlineGameCompleteDelegate_Parms;
 	memcpy ( &ClearEndOnlineGameCompleteDelegate_Parms.EndOnlineGameCompleteDelegate, &EndOnlineGameCompleteDelegate, 0xC );
@@ -2096,10 +2005,9 @@ void UOnlineGameInterfaceImpl::ClearEndOnlineGameCompleteDelegate ( struct FScri
 
 void UOnlineGameInterfaceImpl::AddEndOnlineGameCompleteDelegate ( struct FScriptDelegate EndOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnAddEndOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnAddEndOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 2656 );
 	if ( ! pFnAddEndOnlineGameCompleteDelegate )
-		pFnAddEndOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33868 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execAddEndOnlineGameCompleteDelegate_Parms AddEndOnlineGameCompleteDelegate_Parms;
 	memcpy ( &AddEndOnlineGameCompleteDelegate_Parms.EndOnlineGameCompleteDelegate, &EndOnlineGameCompleteDelegate, 0xC );
@@ -2115,10 +2023,9 @@ void UOnlineGameInterfaceImpl::AddEndOnlineGameCompleteDelegate ( struct FScript
 
 void UOnlineGameInterfaceImpl::OnEndOnlineGameComplete ( struct FName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnEndOnlineGameComplete = NULL;
-
+	UFunction* pFnOnEndOnlineGameComplete = (UFunction*) SdkBindings::Get ( 2619 );
 	if ( ! pFnOnEndOnlineGameComplete )
-		pFnOnEndOnlineGameComplete = (UFunction*) UObject::GObjObjects()->Data[ 33743 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execOnEndOnlineGameComplete_Parms OnEndOnlineGameComplete_Parms;
 	memcpy ( &OnEndOnlineGameComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -2135,10 +2042,9 @@ void UOnlineGameInterfaceImpl::OnEndOnlineGameComplete ( struct FName SessionNam
 
 bool UOnlineGameInterfaceImpl::EndOnlineGame ( struct FName SessionName )
 {
-	static UFunction* pFnEndOnlineGame = NULL;
-
+	UFunction* pFnEndOnlineGame = (UFunction*) SdkBindings::Get ( 2655 );
 	if ( ! pFnEndOnlineGame )
-		pFnEndOnlineGame = (UFunction*) UObject::GObjObjects()->Data[ 33863 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execEndOnlineGame_Parms EndOnlineGame_Parms;
 	memcpy ( &EndOnlineGame_Parms.SessionName, &SessionName, 0x8 );
@@ -2159,10 +2065,9 @@ bool UOnlineGameInterfaceImpl::EndOnlineGame ( struct FName SessionName )
 
 void UOnlineGameInterfaceImpl::ClearStartOnlineGameCompleteDelegate ( struct FScriptDelegate StartOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnClearStartOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnClearStartOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 2654 );
 	if ( ! pFnClearStartOnlineGameCompleteDelegate )
-		pFnClearStartOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33860 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execClearStartOnlineGameCompleteDelegate_Parms ClearStartOnlineGameCompleteDelegate_Parms;
 	memcpy ( &ClearStartOnlineGameCompleteDelegate_Parms.StartOnlineGameCompleteDelegate, &StartOnlineGameCompleteDelegate, 0xC );
@@ -2177,10 +2082,9 @@ void UOnlineGameInterfaceImpl::ClearStartOnlineGameCompleteDelegate ( struct FSc
 
 void UOnlineGameInterfaceImpl::AddStartOnlineGameCompleteDelegate ( struct FScriptDelegate StartOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnAddStartOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnAddStartOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 2653 );
 	if ( ! pFnAddStartOnlineGameCompleteDelegate )
-		pFnAddStartOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33858 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execAddStartOnlineGameCompleteDelegate_Parms AddStartOnlineGameCompleteDelegate_Parms;
 	memcpy ( &AddStartOnlineGameCompleteDelegate_Parms.StartOnlineGameCompleteDelegate, &StartOnlineGameCompleteDelegate, 0xC );
@@ -2196,10 +2100,9 @@ void UOnlineGameInterfaceImpl::AddStartOnlineGameCompleteDelegate ( struct FScri
 
 void UOnlineGameInterfaceImpl::OnStartOnlineGameComplete ( struct FName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnStartOnlineGameComplete = NULL;
-
+	UFunction* pFnOnStartOnlineGameComplete = (UFunction*) SdkBindings::Get ( 2618 );
 	if ( ! pFnOnStartOnlineGameComplete )
-		pFnOnStartOnlineGameComplete = (UFunction*) UObject::GObjObjects()->Data[ 33740 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execOnStartOnlineGameComplete_Parms OnStartOnlineGameComplete_Parms;
 	memcpy ( &OnStartOnlineGameComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -2216,10 +2119,9 @@ void UOnlineGameInterfaceImpl::OnStartOnlineGameComplete ( struct FName SessionN
 
 bool UOnlineGameInterfaceImpl::StartOnlineGame ( struct FName SessionName )
 {
-	static UFunction* pFnStartOnlineGame = NULL;
-
+	UFunction* pFnStartOnlineGame = (UFunction*) SdkBindings::Get ( 2652 );
 	if ( ! pFnStartOnlineGame )
-		pFnStartOnlineGame = (UFunction*) UObject::GObjObjects()->Data[ 33853 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execStartOnlineGame_Parms StartOnlineGame_Parms;
 	memcpy ( &StartOnlineGame_Parms.SessionName, &SessionName, 0x8 );
@@ -2240,10 +2142,9 @@ bool UOnlineGameInterfaceImpl::StartOnlineGame ( struct FName SessionName )
 
 void UOnlineGameInterfaceImpl::ClearUnregisterPlayerCompleteDelegate ( struct FScriptDelegate UnregisterPlayerCompleteDelegate )
 {
-	static UFunction* pFnClearUnregisterPlayerCompleteDelegate = NULL;
-
+	UFunction* pFnClearUnregisterPlayerCompleteDelegate = (UFunction*) SdkBindings::Get ( 2651 );
 	if ( ! pFnClearUnregisterPlayerCompleteDelegate )
-		pFnClearUnregisterPlayerCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33851 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execClearUnregisterPlayerCompleteDelegate_Parms ClearUnregisterPlayerCompleteDelegate_Parms;
 	memcpy ( &ClearUnregisterPlayerCompleteDelegate_Parms.UnregisterPlayerCompleteDelegate, &UnregisterPlayerCompleteDelegate, 0xC );
@@ -2258,10 +2159,9 @@ void UOnlineGameInterfaceImpl::ClearUnregisterPlayerCompleteDelegate ( struct FS
 
 void UOnlineGameInterfaceImpl::AddUnregisterPlayerCompleteDelegate ( struct FScriptDelegate UnregisterPlayerCompleteDelegate )
 {
-	static UFunction* pFnAddUnregisterPlayerCompleteDelegate = NULL;
-
+	UFunction* pFnAddUnregisterPlayerCompleteDelegate = (UFunction*) SdkBindings::Get ( 2650 );
 	if ( ! pFnAddUnregisterPlayerCompleteDelegate )
-		pFnAddUnregisterPlayerCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33849 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execAddUnregisterPlayerCompleteDelegate_Parms AddUnregisterPlayerCompleteDelegate_Parms;
 	memcpy ( &AddUnregisterPlayerCompleteDelegate_Parms.UnregisterPlayerCompleteDelegate, &UnregisterPlayerCompleteDelegate, 0xC );
@@ -2278,10 +2178,9 @@ void UOnlineGameInterfaceImpl::AddUnregisterPlayerCompleteDelegate ( struct FScr
 
 void UOnlineGameInterfaceImpl::OnUnregisterPlayerComplete ( struct FName SessionName, struct FUniqueNetId PlayerID, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnUnregisterPlayerComplete = NULL;
-
+	UFunction* pFnOnUnregisterPlayerComplete = (UFunction*) SdkBindings::Get ( 2649 );
 	if ( ! pFnOnUnregisterPlayerComplete )
-		pFnOnUnregisterPlayerComplete = (UFunction*) UObject::GObjObjects()->Data[ 33845 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execOnUnregisterPlayerComplete_Parms OnUnregisterPlayerComplete_Parms;
 	memcpy ( &OnUnregisterPlayerComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -2300,10 +2199,9 @@ void UOnlineGameInterfaceImpl::OnUnregisterPlayerComplete ( struct FName Session
 
 bool UOnlineGameInterfaceImpl::UnregisterPlayer ( struct FName SessionName, struct FUniqueNetId PlayerID )
 {
-	static UFunction* pFnUnregisterPlayer = NULL;
-
+	UFunction* pFnUnregisterPlayer = (UFunction*) SdkBindings::Get ( 2648 );
 	if ( ! pFnUnregisterPlayer )
-		pFnUnregisterPlayer = (UFunction*) UObject::GObjObjects()->Data[ 33841 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execUnregisterPlayer_Parms UnregisterPlayer_Parms;
 	memcpy ( &UnregisterPlayer_Parms.SessionName, &SessionName, 0x8 );
@@ -2321,10 +2219,9 @@ bool UOnlineGameInterfaceImpl::UnregisterPlayer ( struct FName SessionName, stru
 
 void UOnlineGameInterfaceImpl::ClearRegisterPlayerCompleteDelegate ( struct FScriptDelegate RegisterPlayerCompleteDelegate )
 {
-	static UFunction* pFnClearRegisterPlayerCompleteDelegate = NULL;
-
+	UFunction* pFnClearRegisterPlayerCompleteDelegate = (UFunction*) SdkBindings::Get ( 2647 );
 	if ( ! pFnClearRegisterPlayerCompleteDelegate )
-		pFnClearRegisterPlayerCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33839 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execClearRegisterPlayerCompleteDelegate_Parms ClearRegisterPlayerCompleteDelegate_Parms;
 	memcpy ( &ClearRegisterPlayerCompleteDelegate_Parms.RegisterPlayerCompleteDelegate, &RegisterPlayerCompleteDelegate, 0xC );
@@ -2339,10 +2236,9 @@ void UOnlineGameInterfaceImpl::ClearRegisterPlayerCompleteDelegate ( struct FScr
 
 void UOnlineGameInterfaceImpl::AddRegisterPlayerCompleteDelegate ( struct FScriptDelegate RegisterPlayerCompleteDelegate )
 {
-	static UFunction* pFnAddRegisterPlayerCompleteDelegate = NULL;
-
+	UFunction* pFnAddRegisterPlayerCompleteDelegate = (UFunction*) SdkBindings::Get ( 2646 );
 	if ( ! pFnAddRegisterPlayerCompleteDelegate )
-		pFnAddRegisterPlayerCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33837 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execAddRegisterPlayerCompleteDelegate_Parms AddRegisterPlayerCompleteDelegate_Parms;
 	memcpy ( &AddRegisterPlayerCompleteDelegate_Parms.RegisterPlayerCompleteDelegate, &RegisterPlayerCompleteDelegate, 0xC );
@@ -2359,10 +2255,9 @@ void UOnlineGameInterfaceImpl::AddRegisterPlayerCompleteDelegate ( struct FScrip
 
 void UOnlineGameInterfaceImpl::OnRegisterPlayerComplete ( struct FName SessionName, struct FUniqueNetId PlayerID, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnRegisterPlayerComplete = NULL;
-
+	UFunction* pFnOnRegisterPlayerComplete = (UFunction*) SdkBindings::Get ( 2645 );
 	if ( ! pFnOnRegisterPlayerComplete )
-		pFnOnRegisterPlayerComplete = (UFunction*) UObject::GObjObjects()->Data[ 33833 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execOnRegisterPlayerComplete_Parms OnRegisterPlayerComplete_Parms;
 	memcpy ( &OnRegisterPlayerComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -2382,10 +2277,9 @@ void UOnlineGameInterfaceImpl::OnRegisterPlayerComplete ( struct FName SessionNa
 
 bool UOnlineGameInterfaceImpl::RegisterPlayer ( struct FName SessionName, struct FUniqueNetId PlayerID, unsigned long bWasInvited )
 {
-	static UFunction* pFnRegisterPlayer = NULL;
-
+	UFunction* pFnRegisterPlayer = (UFunction*) SdkBindings::Get ( 2644 );
 	if ( ! pFnRegisterPlayer )
-		pFnRegisterPlayer = (UFunction*) UObject::GObjObjects()->Data[ 33828 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execRegisterPlayer_Parms RegisterPlayer_Parms;
 	memcpy ( &RegisterPlayer_Parms.SessionName, &SessionName, 0x8 );
@@ -2406,10 +2300,9 @@ bool UOnlineGameInterfaceImpl::RegisterPlayer ( struct FName SessionName, struct
 
 bool UOnlineGameInterfaceImpl::GetResolvedConnectString ( struct FName SessionName, struct FString* ConnectInfo )
 {
-	static UFunction* pFnGetResolvedConnectString = NULL;
-
+	UFunction* pFnGetResolvedConnectString = (UFunction*) SdkBindings::Get ( 2643 );
 	if ( ! pFnGetResolvedConnectString )
-		pFnGetResolvedConnectString = (UFunction*) UObject::GObjObjects()->Data[ 33824 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execGetResolvedConnectString_Parms GetResolvedConnectString_Parms;
 	memcpy ( &GetResolvedConnectString_Parms.SessionName, &SessionName, 0x8 );
@@ -2433,10 +2326,9 @@ bool UOnlineGameInterfaceImpl::GetResolvedConnectString ( struct FName SessionNa
 
 void UOnlineGameInterfaceImpl::ClearJoinOnlineGameCompleteDelegate ( struct FScriptDelegate JoinOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnClearJoinOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnClearJoinOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 2642 );
 	if ( ! pFnClearJoinOnlineGameCompleteDelegate )
-		pFnClearJoinOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33821 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execClearJoinOnlineGameCompleteDelegate_Parms ClearJoinOnlineGameCompleteDelegate_Parms;
 	memcpy ( &ClearJoinOnlineGameCompleteDelegate_Parms.JoinOnlineGameCompleteDelegate, &JoinOnlineGameCompleteDelegate, 0xC );
@@ -2451,10 +2343,9 @@ void UOnlineGameInterfaceImpl::ClearJoinOnlineGameCompleteDelegate ( struct FScr
 
 void UOnlineGameInterfaceImpl::AddJoinOnlineGameCompleteDelegate ( struct FScriptDelegate JoinOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnAddJoinOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnAddJoinOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 2641 );
 	if ( ! pFnAddJoinOnlineGameCompleteDelegate )
-		pFnAddJoinOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33819 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execAddJoinOnlineGameCompleteDelegate_Parms AddJoinOnlineGameCompleteDelegate_Parms;
 	memcpy ( &AddJoinOnlineGameCompleteDelegate_Parms.JoinOnlineGameCompleteDelegate, &JoinOnlineGameCompleteDelegate, 0xC );
@@ -2470,10 +2361,9 @@ void UOnlineGameInterfaceImpl::AddJoinOnlineGameCompleteDelegate ( struct FScrip
 
 void UOnlineGameInterfaceImpl::OnJoinOnlineGameComplete ( struct FName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnJoinOnlineGameComplete = NULL;
-
+	UFunction* pFnOnJoinOnlineGameComplete = (UFunction*) SdkBindings::Get ( 2617 );
 	if ( ! pFnOnJoinOnlineGameComplete )
-		pFnOnJoinOnlineGameComplete = (UFunction*) UObject::GObjObjects()->Data[ 33737 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execOnJoinOnlineGameComplete_Parms OnJoinOnlineGameComplete_Parms;
 	memcpy ( &OnJoinOnlineGameComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -2492,10 +2382,9 @@ void UOnlineGameInterfaceImpl::OnJoinOnlineGameComplete ( struct FName SessionNa
 
 bool UOnlineGameInterfaceImpl::JoinOnlineGame ( unsigned char PlayerNum, struct FName SessionName, struct FOnlineGameSearchResult* DesiredGame )
 {
-	static UFunction* pFnJoinOnlineGame = NULL;
-
+	UFunction* pFnJoinOnlineGame = (UFunction*) SdkBindings::Get ( 2640 );
 	if ( ! pFnJoinOnlineGame )
-		pFnJoinOnlineGame = (UFunction*) UObject::GObjObjects()->Data[ 33812 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execJoinOnlineGame_Parms JoinOnlineGame_Parms;
 	JoinOnlineGame_Parms.PlayerNum = PlayerNum;
@@ -2521,10 +2410,9 @@ bool UOnlineGameInterfaceImpl::JoinOnlineGame ( unsigned char PlayerNum, struct
 
 bool UOnlineGameInterfaceImpl::FreeSearchResults ( class UOnlineGameSearch* Search )
 {
-	static UFunction* pFnFreeSearchResults = NULL;
-
+	UFunction* pFnFreeSearchResults = (UFunction*) SdkBindings::Get ( 2639 );
 	if ( ! pFnFreeSearchResults )
-		pFnFreeSearchResults = (UFunction*) UObject::GObjObjects()->Data[ 33809 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execFreeSearchResults_Parms FreeSearchResults_Parms;
 	FreeSearchResults_Parms.Search = Search;
@@ -2545,10 +2433,9 @@ bool UOnlineGameInterfaceImpl::FreeSearchResults ( class UOnlineGameSearch* Sear
 
 void UOnlineGameInterfaceImpl::ClearCancelFindOnlineGamesCompleteDelegate ( struct FScriptDelegate CancelFindOnlineGamesCompleteDelegate )
 {
-	static UFunction* pFnClearCancelFindOnlineGamesCompleteDelegate = NULL;
-
+	UFunction* pFnClearCancelFindOnlineGamesCompleteDelegate = (UFunction*) SdkBindings::Get ( 2638 );
 	if ( ! pFnClearCancelFindOnlineGamesCompleteDelegate )
-		pFnClearCancelFindOnlineGamesCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33806 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execClearCancelFindOnlineGamesCompleteDelegate_Parms ClearCancelFindOnlineGamesCompleteDelegate_Parms;
 	memcpy ( &ClearCancelFindOnlineGamesCompleteDelegate_Parms.CancelFindOnlineGamesCompleteDelegate, &CancelFindOnlineGamesCompleteDelegate, 0xC );
@@ -2563,10 +2450,9 @@ void UOnlineGameInterfaceImpl::ClearCancelFindOnlineGamesCompleteDelegate ( stru
 
 void UOnlineGameInterfaceImpl::AddCancelFindOnlineGamesCompleteDelegate ( struct FScriptDelegate CancelFindOnlineGamesCompleteDelegate )
 {
-	static UFunction* pFnAddCancelFindOnlineGamesCompleteDelegate = NULL;
-
+	UFunction* pFnAddCancelFindOnlineGamesCompleteDelegate = (UFunction*) SdkBindings::Get ( 2637 );
 	if ( ! pFnAddCancelFindOnlineGamesCompleteDelegate )
-		pFnAddCancelFindOnlineGamesCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33804 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execAddCancelFindOnlineGamesCompleteDelegate_Parms AddCancelFindOnlineGamesCompleteDelegate_Parms;
 	memcpy ( &AddCancelFindOnlineGamesCompleteDelegate_Parms.CancelFindOnlineGamesCompleteDelegate, &CancelFindOnlineGamesCompleteDelegate, 0xC );
@@ -2581,10 +2467,9 @@ void UOnlineGameInterfaceImpl::AddCancelFindOnlineGamesCompleteDelegate ( struct
 
 void UOnlineGameInterfaceImpl::OnCancelFindOnlineGamesComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnCancelFindOnlineGamesComplete = NULL;
-
+	UFunction* pFnOnCancelFindOnlineGamesComplete = (UFunction*) SdkBindings::Get ( 2621 );
 	if ( ! pFnOnCancelFindOnlineGamesComplete )
-		pFnOnCancelFindOnlineGamesComplete = (UFunction*) UObject::GObjObjects()->Data[ 33749 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execOnCancelFindOnlineGamesComplete_Parms OnCancelFindOnlineGamesComplete_Parms;
 	OnCancelFindOnlineGamesComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -2599,10 +2484,9 @@ void UOnlineGameInterfaceImpl::OnCancelFindOnlineGamesComplete ( unsigned long b
 
 bool UOnlineGameInterfaceImpl::CancelFindOnlineGames ( )
 {
-	static UFunction* pFnCancelFindOnlineGames = NULL;
-
+	UFunction* pFnCancelFindOnlineGames = (UFunction*) SdkBindings::Get ( 2636 );
 	if ( ! pFnCancelFindOnlineGames )
-		pFnCancelFindOnlineGames = (UFunction*) UObject::GObjObjects()->Data[ 33801 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execCancelFindOnlineGames_Parms CancelFindOnlineGames_Parms;
 
@@ -2622,10 +2506,9 @@ bool UOnlineGameInterfaceImpl::CancelFindOnlineGames ( )
 
 void UOnlineGameInterfaceImpl::ClearFindOnlineGamesCompleteDelegate ( struct FScriptDelegate FindOnlineGamesCompleteDelegate )
 {
-	static UFunction* pFnClearFindOnlineGamesCompleteDelegate = NULL;
-
+	UFunction* pFnClearFindOnlineGamesCompleteDelegate = (UFunction*) SdkBindings::Get ( 2635 );
 	if ( ! pFnClearFindOnlineGamesCompleteDelegate )
-		pFnClearFindOnlineGamesCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33798 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execClearFindOnlineGamesCompleteDelegate_Parms ClearFindOnlineGamesCompleteDelegate_Parms;
 	memcpy ( &ClearFindOnlineGamesCompleteDelegate_Parms.FindOnlineGamesCompleteDelegate, &FindOnlineGamesCompleteDelegate, 0xC );
@@ -2640,10 +2523,9 @@ void UOnlineGameInterfaceImpl::ClearFindOnlineGamesCompleteDelegate ( struct FSc
 
 void UOnlineGameInterfaceImpl::AddFindOnlineGamesCompleteDelegate ( struct FScriptDelegate FindOnlineGamesCompleteDelegate )
 {
-	static UFunction* pFnAddFindOnlineGamesCompleteDelegate = NULL;
-
+	UFunction* pFnAddFindOnlineGamesCompleteDelegate = (UFunction*) SdkBindings::Get ( 2634 );
 	if ( ! pFnAddFindOnlineGamesCompleteDelegate )
-		pFnAddFindOnlineGamesCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33796 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execAddFindOnlineGamesCompleteDelegate_Parms AddFindOnlineGamesCompleteDelegate_Parms;
 	memcpy ( &AddFindOnlineGamesCompleteDelegate_Parms.FindOnlineGamesCompleteDelegate, &FindOnlineGamesCompleteDelegate, 0xC );
@@ -2660,10 +2542,9 @@ void UOnlineGameInterfaceImpl::AddFindOnlineGamesCompleteDelegate ( struct FScri
 
 bool UOnlineGameInterfaceImpl::FindOnlineGames ( unsigned char SearchingPlayerNum, class UOnlineGameSearch* SearchSettings )
 {
-	static UFunction* pFnFindOnlineGames = NULL;
-
+	UFunction* pFnFindOnlineGames = (UFunction*) SdkBindings::Get ( 2633 );
 	if ( ! pFnFindOnlineGames )
-		pFnFindOnlineGames = (UFunction*) UObject::GObjObjects()->Data[ 33792 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execFindOnlineGames_Parms FindOnlineGames_Parms;
 	FindOnlineGames_Parms.SearchingPlayerNum = SearchingPlayerNum;
@@ -2685,10 +2566,9 @@ bool UOnlineGameInterfaceImpl::FindOnlineGames ( unsigned char SearchingPlayerNu
 
 void UOnlineGameInterfaceImpl::ClearDestroyOnlineGameCompleteDelegate ( struct FScriptDelegate DestroyOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnClearDestroyOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnClearDestroyOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 2632 );
 	if ( ! pFnClearDestroyOnlineGameCompleteDelegate )
-		pFnClearDestroyOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33789 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execClearDestroyOnlineGameCompleteDelegate_Parms ClearDestroyOnlineGameCompleteDelegate_Parms;
 	memcpy ( &ClearDestroyOnlineGameCompleteDelegate_Parms.DestroyOnlineGameCompleteDelegate, &DestroyOnlineGameCompleteDelegate, 0xC );
@@ -2703,10 +2583,9 @@ void UOnlineGameInterfaceImpl::ClearDestroyOnlineGameCompleteDelegate ( struct F
 
 void UOnlineGameInterfaceImpl::AddDestroyOnlineGameCompleteDelegate ( struct FScriptDelegate DestroyOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnAddDestroyOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnAddDestroyOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 2631 );
 	if ( ! pFnAddDestroyOnlineGameCompleteDelegate )
-		pFnAddDestroyOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33787 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execAddDestroyOnlineGameCompleteDelegate_Parms AddDestroyOnlineGameCompleteDelegate_Parms;
 	memcpy ( &AddDestroyOnlineGameCompleteDelegate_Parms.DestroyOnlineGameCompleteDelegate, &DestroyOnlineGameCompleteDelegate, 0xC );
@@ -2722,10 +2601,9 @@ void UOnlineGameInterfaceImpl::AddDestroyOnlineGameCompleteDelegate ( struct FSc
 
 void UOnlineGameInterfaceImpl::OnDestroyOnlineGameComplete ( struct FName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnDestroyOnlineGameComplete = NULL;
-
+	UFunction* pFnOnDestroyOnlineGameComplete = (UFunction*) SdkBindings::Get ( 2616 );
 	if ( ! pFnOnDestroyOnlineGameComplete )
-		pFnOnDestroyOnlineGameComplete = (UFunction*) UObject::GObjObjects()->Data[ 33734 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execOnDestroyOnlineGameComplete_Parms OnDestroyOnlineGameComplete_Parms;
 	memcpy ( &OnDestroyOnlineGameComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -2742,10 +2620,9 @@ void UOnlineGameInterfaceImpl::OnDestroyOnlineGameComplete ( struct FName Sessio
 
 bool UOnlineGameInterfaceImpl::DestroyOnlineGame ( struct FName SessionName )
 {
-	static UFunction* pFnDestroyOnlineGame = NULL;
-
+	UFunction* pFnDestroyOnlineGame = (UFunction*) SdkBindings::Get ( 2630 );
 	if ( ! pFnDestroyOnlineGame )
-		pFnDestroyOnlineGame = (UFunction*) UObject::GObjObjects()->Data[ 33782 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execDestroyOnlineGame_Parms DestroyOnlineGame_Parms;
 	memcpy ( &DestroyOnlineGame_Parms.SessionName, &SessionName, 0x8 );
@@ -2766,10 +2643,9 @@ bool UOnlineGameInterfaceImpl::DestroyOnlineGame ( struct FName SessionName )
 
 void UOnlineGameInterfaceImpl::ClearUpdateOnlineGameCompleteDelegate ( struct FScriptDelegate UpdateOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnClearUpdateOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnClearUpdateOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 2629 );
 	if ( ! pFnClearUpdateOnlineGameCompleteDelegate )
-		pFnClearUpdateOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33779 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execClearUpdateOnlineGameCompleteDelegate_Parms ClearUpdateOnlineGameCompleteDelegate_Parms;
 	memcpy ( &ClearUpdateOnlineGameCompleteDelegate_Parms.UpdateOnlineGameCompleteDelegate, &UpdateOnlineGameCompleteDelegate, 0xC );
@@ -2784,10 +2660,9 @@ void UOnlineGameInterfaceImpl::ClearUpdateOnlineGameCompleteDelegate ( struct FS
 
 void UOnlineGameInterfaceImpl::AddUpdateOnlineGameCompleteDelegate ( struct FScriptDelegate UpdateOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnAddUpdateOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnAddUpdateOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 2628 );
 	if ( ! pFnAddUpdateOnlineGameCompleteDelegate )
-		pFnAddUpdateOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33777 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execAddUpdateOnlineGameCompleteDelegate_Parms AddUpdateOnlineGameCompleteDelegate_Parms;
 	memcpy ( &AddUpdateOnlineGameCompleteDelegate_Parms.UpdateOnlineGameCompleteDelegate, &UpdateOnlineGameCompleteDelegate, 0xC );
@@ -2803,10 +2678,9 @@ void UOnlineGameInterfaceImpl::AddUpdateOnlineGameCompleteDelegate ( struct FScr
 
 void UOnlineGameInterfaceImpl::OnUpdateOnlineGameComplete ( struct FName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnUpdateOnlineGameComplete = NULL;
-
+	UFunction* pFnOnUpdateOnlineGameComplete = (UFunction*) SdkBindings::Get ( 2615 );
 	if ( ! pFnOnUpdateOnlineGameComplete )
-		pFnOnUpdateOnlineGameComplete = (UFunction*) UObject::GObjObjects()->Data[ 33731 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execOnUpdateOnlineGameComplete_Parms OnUpdateOnlineGameComplete_Parms;
 	memcpy ( &OnUpdateOnlineGameComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -2825,10 +2699,9 @@ void UOnlineGameInterfaceImpl::OnUpdateOnlineGameComplete ( struct FName Session
 
 bool UOnlineGameInterfaceImpl::UpdateOnlineGame ( struct FName SessionName, class UOnlineGameSettings* UpdatedGameSettings, unsigned long bShouldRefreshOnlineData )
 {
-	static UFunction* pFnUpdateOnlineGame = NULL;
-
+	UFunction* pFnUpdateOnlineGame = (UFunction*) SdkBindings::Get ( 2627 );
 	if ( ! pFnUpdateOnlineGame )
-		pFnUpdateOnlineGame = (UFunction*) UObject::GObjObjects()->Data[ 33770 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execUpdateOnlineGame_Parms UpdateOnlineGame_Parms;
 	memcpy ( &UpdateOnlineGame_Parms.SessionName, &SessionName, 0x8 );
@@ -2847,10 +2720,9 @@ bool UOnlineGameInterfaceImpl::UpdateOnlineGame ( struct FName SessionName, clas
 
 void UOnlineGameInterfaceImpl::ClearCreateOnlineGameCompleteDelegate ( struct FScriptDelegate CreateOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnClearCreateOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnClearCreateOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 2626 );
 	if ( ! pFnClearCreateOnlineGameCompleteDelegate )
-		pFnClearCreateOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33767 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execClearCreateOnlineGameCompleteDelegate_Parms ClearCreateOnlineGameCompleteDelegate_Parms;
 	memcpy ( &ClearCreateOnlineGameCompleteDelegate_Parms.CreateOnlineGameCompleteDelegate, &CreateOnlineGameCompleteDelegate, 0xC );
@@ -2865,10 +2737,9 @@ void UOnlineGameInterfaceImpl::ClearCreateOnlineGameCompleteDelegate ( struct FS
 
 void UOnlineGameInterfaceImpl::AddCreateOnlineGameCompleteDelegate ( struct FScriptDelegate CreateOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnAddCreateOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnAddCreateOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 2625 );
 	if ( ! pFnAddCreateOnlineGameCompleteDelegate )
-		pFnAddCreateOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 33765 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execAddCreateOnlineGameCompleteDelegate_Parms AddCreateOnlineGameCompleteDelegate_Parms;
 	memcpy ( &AddCreateOnlineGameCompleteDelegate_Parms.CreateOnlineGameCompleteDelegate, &CreateOnlineGameCompleteDelegate, 0xC );
@@ -2884,10 +2755,9 @@ void UOnlineGameInterfaceImpl::AddCreateOnlineGameCompleteDelegate ( struct FScr
 
 void UOnlineGameInterfaceImpl::OnCreateOnlineGameComplete ( struct FName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnCreateOnlineGameComplete = NULL;
-
+	UFunction* pFnOnCreateOnlineGameComplete = (UFunction*) SdkBindings::Get ( 2614 );
 	if ( ! pFnOnCreateOnlineGameComplete )
-		pFnOnCreateOnlineGameComplete = (UFunction*) UObject::GObjObjects()->Data[ 33728 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execOnCreateOnlineGameComplete_Parms OnCreateOnlineGameComplete_Parms;
 	memcpy ( &OnCreateOnlineGameComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -2906,10 +2776,9 @@ void UOnlineGameInterfaceImpl::OnCreateOnlineGameComplete ( struct FName Session
 
 bool UOnlineGameInterfaceImpl::CreateOnlineGame ( unsigned char HostingPlayerNum, struct FName SessionName, class UOnlineGameSettings* NewGameSettings )
 {
-	static UFunction* pFnCreateOnlineGame = NULL;
-
+	UFunction* pFnCreateOnlineGame = (UFunction*) SdkBindings::Get ( 2624 );
 	if ( ! pFnCreateOnlineGame )
-		pFnCreateOnlineGame = (UFunction*) UObject::GObjObjects()->Data[ 33758 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execCreateOnlineGame_Parms CreateOnlineGame_Parms;
 	CreateOnlineGame_Parms.HostingPlayerNum = HostingPlayerNum;
@@ -2932,10 +2801,9 @@ bool UOnlineGameInterfaceImpl::CreateOnlineGame ( unsigned char HostingPlayerNum
 
 class UOnlineGameSearch* UOnlineGameInterfaceImpl::GetGameSearch ( )
 {
-	static UFunction* pFnGetGameSearch = NULL;
-
+	UFunction* pFnGetGameSearch = (UFunction*) SdkBindings::Get ( 2623 );
 	if ( ! pFnGetGameSearch )
-		pFnGetGameSearch = (UFunction*) UObject::GObjObjects()->Data[ 33755 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execGetGameSearch_Parms GetGameSearch_Parms;
 
@@ -2952,10 +2820,9 @@ class UOnlineGameSearch* UOnlineGameInterfaceImpl::GetGameSearch ( )
 
 class UOnlineGameSettings* UOnlineGameInterfaceImpl::GetGameSettings ( struct FName SessionName )
 {
-	static UFunction* pFnGetGameSettings = NULL;
-
+	UFunction* pFnGetGameSettings = (UFunction*) SdkBindings::Get ( 2622 );
 	if ( ! pFnGetGameSettings )
-		pFnGetGameSettings = (UFunction*) UObject::GObjObjects()->Data[ 33751 ];
+		return {};
 
 	UOnlineGameInterfaceImpl_execGetGameSettings_Parms GetGameSettings_Parms;
 	memcpy ( &GetGameSettings_Parms.SessionName, &SessionName, 0x8 );
@@ -2972,10 +2839,9 @@ class UOnlineGameSettings* UOnlineGameInterfaceImpl::GetGameSettings ( struct FN
 
 void UOnlineGameInterfaceImpl::OnFindOnlineGamesComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnFindOnlineGamesComplete = NULL;
-
+	UFunction* pFnOnFindOnlineGamesComplete = (UFunction*) SdkBindings::Get ( 2620 );
 	if ( ! pFnOnFindOnlineGamesComplete )
-		pFnOnFindOnlineGamesComplete = (UFunction*) UObject::GObjObjects()->Data[ 33746 ];
+		return;
 
 	UOnlineGameInterfaceImpl_execOnFindOnlineGamesComplete_Parms OnFindOnlineGamesComplete_Parms;
 	OnFindOnlineGamesComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -2989,10 +2855,9 @@ void UOnlineGameInterfaceImpl::OnFindOnlineGamesComplete ( unsigned long bWasSuc
 
 void UPartyBeacon::OnDestroyComplete ( )
 {
-	static UFunction* pFnOnDestroyComplete = NULL;
-
+	UFunction* pFnOnDestroyComplete = (UFunction*) SdkBindings::Get ( 2694 );
 	if ( ! pFnOnDestroyComplete )
-		pFnOnDestroyComplete = (UFunction*) UObject::GObjObjects()->Data[ 34054 ];
+		return;
 
 	UPartyBeacon_execOnDestroyComplete_Parms OnDestroyComplete_Parms;
 
@@ -3005,10 +2870,9 @@ void UPartyBeacon::OnDestroyComplete ( )
 
 void UPartyBeacon::eventDestroyBeacon ( )
 {
-	static UFunction* pFnDestroyBeacon = NULL;
-
+	UFunction* pFnDestroyBeacon = (UFunction*) SdkBindings::Get ( 2693 );
 	if ( ! pFnDestroyBeacon )
-		pFnDestroyBeacon = (UFunction*) UObject::GObjObjects()->Data[ 34053 ];
+		return;
 
 	UPartyBeacon_eventDestroyBeacon_Parms DestroyBeacon_Parms;
 
@@ -3025,10 +2889,9 @@ void UPartyBeacon::eventDestroyBeacon ( )
 
 void UPartyBeaconClient::eventDestroyBeacon ( )
 {
-	static UFunction* pFnDestroyBeacon = NULL;
-
+	UFunction* pFnDestroyBeacon = (UFunction*) SdkBindings::Get ( 2703 );
 	if ( ! pFnDestroyBeacon )
-		pFnDestroyBeacon = (UFunction*) UObject::GObjObjects()->Data[ 34092 ];
+		return;
 
 	UPartyBeaconClient_eventDestroyBeacon_Parms DestroyBeacon_Parms;
 
@@ -3047,10 +2910,9 @@ void UPartyBeaconClient::eventDestroyBeacon ( )
 
 bool UPartyBeaconClient::CancelReservation ( struct FUniqueNetId CancellingPartyLeader )
 {
-	static UFunction* pFnCancelReservation = NULL;
-
+	UFunction* pFnCancelReservation = (UFunction*) SdkBindings::Get ( 2702 );
 	if ( ! pFnCancelReservation )
-		pFnCancelReservation = (UFunction*) UObject::GObjObjects()->Data[ 34089 ];
+		return {};
 
 	UPartyBeaconClient_execCancelReservation_Parms CancelReservation_Parms;
 	memcpy ( &CancelReservation_Parms.CancellingPartyLeader, &CancellingPartyLeader, 0x8 );
@@ -3074,10 +2936,9 @@ bool UPartyBeaconClient::CancelReservation ( struct FUniqueNetId CancellingParty
 
 bool UPartyBeaconClient::RequestReservationUpdate ( struct FUniqueNetId RequestingPartyLeader, struct FOnlineGameSearchResult* DesiredHost, TArray< struct FPlayerReservation >* PlayersToAdd )
 {
-	static UFunction* pFnRequestReservationUpdate = NULL;
-
+	UFunction* pFnRequestReservationUpdate = (UFunction*) SdkBindings::Get ( 2701 );
 	if ( ! pFnRequestReservationUpdate )
-		pFnRequestReservationUpdate = (UFunction*) UObject::GObjObjects()->Data[ 34083 ];
+		return {};
 
 	UPartyBeaconClient_execRequestReservationUpdate_Parms RequestReservationUpdate_Parms;
 	memcpy ( &RequestReservationUpdate_Parms.RequestingPartyLeader, &RequestingPartyLeader, 0x8 );
@@ -3107,10 +2968,9 @@ bool UPartyBeaconClient::RequestReservationUpdate ( struct FUniqueNetId Requesti
 
 bool UPartyBeaconClient::RequestReservation ( struct FUniqueNetId RequestingPartyLeader, struct FOnlineGameSearchResult* DesiredHost, TArray< struct FPlayerReservation >* Players )
 {
-	static UFunction* pFnRequestReservation = NULL;
-
+	UFunction* pFnRequestReservation = (UFunction*) SdkBindings::Get ( 2700 );
 	if ( ! pFnRequestReservation )
-		pFnRequestReservation = (UFunction*) UObject::GObjObjects()->Data[ 34077 ];
+		return {};
 
 	UPartyBeaconClient_execRequestReservation_Parms RequestReservation_Parms;
 	memcpy ( &RequestReservation_Parms.RequestingPartyLeader, &RequestingPartyLeader, 0x8 );
@@ -3136,10 +2996,9 @@ bool UPartyBeaconClient::RequestReservation ( struct FUniqueNetId RequestingPart
 
 void UPartyBeaconClient::OnHostHasCancelled ( )
 {
-	static UFunction* pFnOnHostHasCancelled = NULL;
-
+	UFunction* pFnOnHostHasCancelled = (UFunction*) SdkBindings::Get ( 2699 );
 	if ( ! pFnOnHostHasCancelled )
-		pFnOnHostHasCancelled = (UFunction*) UObject::GObjObjects()->Data[ 34076 ];
+		return;
 
 	UPartyBeaconClient_execOnHostHasCancelled_Parms OnHostHasCancelled_Parms;
 
@@ -3152,10 +3011,9 @@ void UPartyBeaconClient::OnHostHasCancelled ( )
 
 void UPartyBeaconClient::OnHostIsReady ( )
 {
-	static UFunction* pFnOnHostIsReady = NULL;
-
+	UFunction* pFnOnHostIsReady = (UFunction*) SdkBindings::Get ( 2698 );
 	if ( ! pFnOnHostIsReady )
-		pFnOnHostIsReady = (UFunction*) UObject::GObjObjects()->Data[ 34075 ];
+		return;
 
 	UPartyBeaconClient_execOnHostIsReady_Parms OnHostIsReady_Parms;
 
@@ -3171,10 +3029,9 @@ void UPartyBeaconClient::OnHostIsReady ( )
 
 void UPartyBeaconClient::OnTravelRequestReceived ( struct FName SessionName, class UClass* SearchClass, unsigned char* PlatformSpecificInfo )
 {
-	static UFunction* pFnOnTravelRequestReceived = NULL;
-
+	UFunction* pFnOnTravelRequestReceived = (UFunction*) SdkBindings::Get ( 2697 );
 	if ( ! pFnOnTravelRequestReceived )
-		pFnOnTravelRequestReceived = (UFunction*) UObject::GObjObjects()->Data[ 34071 ];
+		return;
 
 	UPartyBeaconClient_execOnTravelRequestReceived_Parms OnTravelRequestReceived_Parms;
 	memcpy ( &OnTravelRequestReceived_Parms.SessionName, &SessionName, 0x8 );
@@ -3191,10 +3048,9 @@ void UPartyBeaconClient::OnTravelRequestReceived ( struct FName SessionName, cla
 
 void UPartyBeaconClient::OnReservationCountUpdated ( int ReservationRemaining )
 {
-	static UFunction* pFnOnReservationCountUpdated = NULL;
-
+	UFunction* pFnOnReservationCountUpdated = (UFunction*) SdkBindings::Get ( 2696 );
 	if ( ! pFnOnReservationCountUpdated )
-		pFnOnReservationCountUpdated = (UFunction*) UObject::GObjObjects()->Data[ 34069 ];
+		return;
 
 	UPartyBeaconClient_execOnReservationCountUpdated_Parms OnReservationCountUpdated_Parms;
 	OnReservationCountUpdated_Parms.ReservationRemaining = ReservationRemaining;
@@ -3209,10 +3065,9 @@ void UPartyBeaconClient::OnReservationCountUpdated ( int ReservationRemaining )
 
 void UPartyBeaconClient::OnReservationRequestComplete ( unsigned char ReservationResult )
 {
-	static UFunction* pFnOnReservationRequestComplete = NULL;
-
+	UFunction* pFnOnReservationRequestComplete = (UFunction*) SdkBindings::Get ( 2695 );
 	if ( ! pFnOnReservationRequestComplete )
-		pFnOnReservationRequestComplete = (UFunction*) UObject::GObjObjects()->Data[ 34067 ];
+		return;
 
 	UPartyBeaconClient_execOnReservationRequestComplete_Parms OnReservationRequestComplete_Parms;
 	OnReservationRequestComplete_Parms.ReservationResult = ReservationResult;
@@ -3227,10 +3082,9 @@ void UPartyBeaconClient::OnReservationRequestComplete ( unsigned char Reservatio
 
 int UPartyBeaconHost::GetMaxAvailableTeamSize ( )
 {
-	static UFunction* pFnGetMaxAvailableTeamSize = NULL;
-
+	UFunction* pFnGetMaxAvailableTeamSize = (UFunction*) SdkBindings::Get ( 2722 );
 	if ( ! pFnGetMaxAvailableTeamSize )
-		pFnGetMaxAvailableTeamSize = (UFunction*) UObject::GObjObjects()->Data[ 34183 ];
+		return {};
 
 	UPartyBeaconHost_execGetMaxAvailableTeamSize_Parms GetMaxAvailableTeamSize_Parms;
 
@@ -3250,10 +3104,9 @@ int UPartyBeaconHost::GetMaxAvailableTeamSize ( )
 
 void UPartyBeaconHost::GetPartyLeaders ( TArray< struct FUniqueNetId >* PartyLeaders )
 {
-	static UFunction* pFnGetPartyLeaders = NULL;
-
+	UFunction* pFnGetPartyLeaders = (UFunction*) SdkBindings::Get ( 2721 );
 	if ( ! pFnGetPartyLeaders )
-		pFnGetPartyLeaders = (UFunction*) UObject::GObjObjects()->Data[ 34179 ];
+		return;
 
 	UPartyBeaconHost_execGetPartyLeaders_Parms GetPartyLeaders_Parms;
 
@@ -3270,10 +3123,9 @@ void UPartyBeaconHost::GetPartyLeaders ( TArray< struct FUniqueNetId >* PartyLea
 
 void UPartyBeaconHost::GetPlayers ( TArray< struct FUniqueNetId >* Players )
 {
-	static UFunction* pFnGetPlayers = NULL;
-
+	UFunction* pFnGetPlayers = (UFunction*) SdkBindings::Get ( 2720 );
 	if ( ! pFnGetPlayers )
-		pFnGetPlayers = (UFunction*) UObject::GObjObjects()->Data[ 34173 ];
+		return;
 
 	UPartyBeaconHost_execGetPlayers_Parms GetPlayers_Parms;
 
@@ -3290,10 +3142,9 @@ void UPartyBeaconHost::GetPlayers ( TArray< struct FUniqueNetId >* Players )
 
 void UPartyBeaconHost::AppendReservationSkillsToSearch ( class UOnlineGameSearch* Search )
 {
-	static UFunction* pFnAppendReservationSkillsToSearch = NULL;
-
+	UFunction* pFnAppendReservationSkillsToSearch = (UFunction*) SdkBindings::Get ( 2719 );
 	if ( ! pFnAppendReservationSkillsToSearch )
-		pFnAppendReservationSkillsToSearch = (UFunction*) UObject::GObjObjects()->Data[ 34171 ];
+		return;
 
 	UPartyBeaconHost_execAppendReservationSkillsToSearch_Parms AppendReservationSkillsToSearch_Parms;
 	AppendReservationSkillsToSearch_Parms.Search = Search;
@@ -3312,10 +3163,9 @@ void UPartyBeaconHost::AppendReservationSkillsToSearch ( class UOnlineGameSearch
 
 void UPartyBeaconHost::eventUnregisterParty ( struct FUniqueNetId PartyLeader )
 {
-	static UFunction* pFnUnregisterParty = NULL;
-
+	UFunction* pFnUnregisterParty = (UFunction*) SdkBindings::Get ( 2718 );
 	if ( ! pFnUnregisterParty )
-		pFnUnregisterParty = (UFunction*) UObject::GObjObjects()->Data[ 34165 ];
+		return;
 
 	UPartyBeaconHost_eventUnregisterParty_Parms UnregisterParty_Parms;
 	memcpy ( &UnregisterParty_Parms.PartyLeader, &PartyLeader, 0x8 );
@@ -3329,10 +3179,9 @@ void UPartyBeaconHost::eventUnregisterParty ( struct FUniqueNetId PartyLeader )
 
 void UPartyBeaconHost::eventUnregisterPartyMembers ( )
 {
-	static UFunction* pFnUnregisterPartyMembers = NULL;
-
+	UFunction* pFnUnregisterPartyMembers = (UFunction*) SdkBindings::Get ( 2717 );
 	if ( ! pFnUnregisterPartyMembers )
-		pFnUnregisterPartyMembers = (UFunction*) UObject::GObjObjects()->Data[ 34160 ];
+		return;
 
 	UPartyBeaconHost_eventUnregisterPartyMembers_Parms UnregisterPartyMembers_Parms;
 
@@ -3345,10 +3194,9 @@ void UPartyBeaconHost::eventUnregisterPartyMembers ( )
 
 void UPartyBeaconHost::eventRegisterPartyMembers ( )
 {
-	static UFunction* pFnRegisterPartyMembers = NULL;
-
+	UFunction* pFnRegisterPartyMembers = (UFunction*) SdkBindings::Get ( 2716 );
 	if ( ! pFnRegisterPartyMembers )
-		pFnRegisterPartyMembers = (UFunction*) UObject::GObjObjects()->Data[ 34151 ];
+		return;
 
 	UPartyBeaconHost_eventRegisterPartyMembers_Parms RegisterPartyMembers_Parms;
 
@@ -3362,10 +3210,9 @@ void UPartyBeaconHost::eventRegisterPartyMembers ( )
 
 bool UPartyBeaconHost::AreReservationsFull ( )
 {
-	static UFunction* pFnAreReservationsFull = NULL;
-
+	UFunction* pFnAreReservationsFull = (UFunction*) SdkBindings::Get ( 2715 );
 	if ( ! pFnAreReservationsFull )
-		pFnAreReservationsFull = (UFunction*) UObject::GObjObjects()->Data[ 34147 ];
+		return {};
 
 	UPartyBeaconHost_execAreReservationsFull_Parms AreReservationsFull_Parms;
 
@@ -3380,10 +3227,9 @@ bool UPartyBeaconHost::AreReservationsFull ( )
 
 void UPartyBeaconHost::TellClientsHostHasCancelled ( )
 {
-	static UFunction* pFnTellClientsHostHasCancelled = NULL;
-
+	UFunction* pFnTellClientsHostHasCancelled = (UFunction*) SdkBindings::Get ( 2714 );
 	if ( ! pFnTellClientsHostHasCancelled )
-		pFnTellClientsHostHasCancelled = (UFunction*) UObject::GObjObjects()->Data[ 34146 ];
+		return;
 
 	UPartyBeaconHost_execTellClientsHostHasCancelled_Parms TellClientsHostHasCancelled_Parms;
 
@@ -3400,10 +3246,9 @@ void UPartyBeaconHost::TellClientsHostHasCancelled ( )
 
 void UPartyBeaconHost::TellClientsHostIsReady ( )
 {
-	static UFunction* pFnTellClientsHostIsReady = NULL;
-
+	UFunction* pFnTellClientsHostIsReady = (UFunction*) SdkBindings::Get ( 2713 );
 	if ( ! pFnTellClientsHostIsReady )
-		pFnTellClientsHostIsReady = (UFunction*) UObject::GObjObjects()->Data[ 34145 ];
+		return;
 
 	UPartyBeaconHost_execTellClientsHostIsReady_Parms TellClientsHostIsReady_Parms;
 
@@ -3423,10 +3268,9 @@ void UPartyBeaconHost::TellClientsHostIsReady ( )
 
 void UPartyBeaconHost::TellClientsToTravel ( struct FName SessionName, class UClass* SearchClass, unsigned char* PlatformSpecificInfo )
 {
-	static UFunction* pFnTellClientsToTravel = NULL;
-
+	UFunction* pFnTellClientsToTravel = (UFunction*) SdkBindings::Get ( 2712 );
 	if ( ! pFnTellClientsToTravel )
-		pFnTellClientsToTravel = (UFunction*) UObject::GObjObjects()->Data[ 34141 ];
+		return;
 
 	UPartyBeaconHost_execTellClientsToTravel_Parms TellClientsToTravel_Parms;
 	memcpy ( &TellClientsToTravel_Parms.SessionName, &SessionName, 0x8 );
@@ -3446,10 +3290,9 @@ void UPartyBeaconHost::TellClientsToTravel ( struct FName SessionName, class UCl
 
 void UPartyBeaconHost::eventDestroyBeacon ( )
 {
-	static UFunction* pFnDestroyBeacon = NULL;
-
+	UFunction* pFnDestroyBeacon = (UFunction*) SdkBindings::Get ( 2711 );
 	if ( ! pFnDestroyBeacon )
-		pFnDestroyBeacon = (UFunction*) UObject::GObjObjects()->Data[ 34140 ];
+		return;
 
 	UPartyBeaconHost_eventDestroyBeacon_Parms DestroyBeacon_Parms;
 
@@ -3467,10 +3310,9 @@ void UPartyBeaconHost::eventDestroyBeacon ( )
 
 void UPartyBeaconHost::OnClientCancellationReceived ( struct FUniqueNetId PartyLeader )
 {
-	static UFunction* pFnOnClientCancellationReceived = NULL;
-
+	UFunction* pFnOnClientCancellationReceived = (UFunction*) SdkBindings::Get ( 2710 );
 	if ( ! pFnOnClientCancellationReceived )
-		pFnOnClientCancellationReceived = (UFunction*) UObject::GObjObjects()->Data[ 34138 ];
+		return;
 
 	UPartyBeaconHost_execOnClientCancellationReceived_Parms OnClientCancellationReceived_Parms;
 	memcpy ( &OnClientCancellationReceived_Parms.PartyLeader, &PartyLeader, 0x8 );
@@ -3484,10 +3326,9 @@ void UPartyBeaconHost::OnClientCancellationReceived ( struct FUniqueNetId PartyL
 
 void UPartyBeaconHost::OnReservationsFull ( )
 {
-	static UFunction* pFnOnReservationsFull = NULL;
-
+	UFunction* pFnOnReservationsFull = (UFunction*) SdkBindings::Get ( 2709 );
 	if ( ! pFnOnReservationsFull )
-		pFnOnReservationsFull = (UFunction*) UObject::GObjObjects()->Data[ 34137 ];
+		return;
 
 	UPartyBeaconHost_execOnReservationsFull_Parms OnReservationsFull_Parms;
 
@@ -3500,10 +3341,9 @@ void UPartyBeaconHost::OnReservationsFull ( )
 
 void UPartyBeaconHost::OnReservationChange ( )
 {
-	static UFunction* pFnOnReservationChange = NULL;
-
+	UFunction* pFnOnReservationChange = (UFunction*) SdkBindings::Get ( 2708 );
 	if ( ! pFnOnReservationChange )
-		pFnOnReservationChange = (UFunction*) UObject::GObjObjects()->Data[ 34136 ];
+		return;
 
 	UPartyBeaconHost_execOnReservationChange_Parms OnReservationChange_Parms;
 
@@ -3518,10 +3358,9 @@ void UPartyBeaconHost::OnReservationChange ( )
 
 void UPartyBeaconHost::HandlePlayerLogout ( struct FUniqueNetId PlayerID, unsigned long bMaintainParty )
 {
-	static UFunction* pFnHandlePlayerLogout = NULL;
-
+	UFunction* pFnHandlePlayerLogout = (UFunction*) SdkBindings::Get ( 2707 );
 	if ( ! pFnHandlePlayerLogout )
-		pFnHandlePlayerLogout = (UFunction*) UObject::GObjObjects()->Data[ 34133 ];
+		return;
 
 	UPartyBeaconHost_execHandlePlayerLogout_Parms HandlePlayerLogout_Parms;
 	memcpy ( &HandlePlayerLogout_Parms.PlayerID, &PlayerID, 0x8 );
@@ -3543,10 +3382,9 @@ void UPartyBeaconHost::HandlePlayerLogout ( struct FUniqueNetId PlayerID, unsign
 
 unsigned char UPartyBeaconHost::UpdatePartyReservationEntry ( struct FUniqueNetId PartyLeader, TArray< struct FPlayerReservation >* PlayerMembers )
 {
-	static UFunction* pFnUpdatePartyReservationEntry = NULL;
-
+	UFunction* pFnUpdatePartyReservationEntry = (UFunction*) SdkBindings::Get ( 2706 );
 	if ( ! pFnUpdatePartyReservationEntry )
-		pFnUpdatePartyReservationEntry = (UFunction*) UObject::GObjObjects()->Data[ 34128 ];
+		return {};
 
 	UPartyBeaconHost_execUpdatePartyReservationEntry_Parms UpdatePartyReservationEntry_Parms;
 	memcpy ( &UpdatePartyReservationEntry_Parms.PartyLeader, &PartyLeader, 0x8 );
@@ -3574,10 +3412,9 @@ unsigned char UPartyBeaconHost::UpdatePartyReservationEntry ( struct FUniqueNetI
 
 unsigned char UPartyBeaconHost::AddPartyReservationEntry ( struct FUniqueNetId PartyLeader, int TeamNum, unsigned long bIsHost, TArray< struct FPlayerReservation >* PlayerMembers )
 {
-	static UFunction* pFnAddPartyReservationEntry = NULL;
-
+	UFunction* pFnAddPartyReservationEntry = (UFunction*) SdkBindings::Get ( 2705 );
 	if ( ! pFnAddPartyReservationEntry )
-		pFnAddPartyReservationEntry = (UFunction*) UObject::GObjObjects()->Data[ 34121 ];
+		return {};
 
 	UPartyBeaconHost_execAddPartyReservationEntry_Parms AddPartyReservationEntry_Parms;
 	memcpy ( &AddPartyReservationEntry_Parms.PartyLeader, &PartyLeader, 0x8 );
@@ -3607,10 +3444,9 @@ unsigned char UPartyBeaconHost::AddPartyReservationEntry ( struct FUniqueNetId P
 
 bool UPartyBeaconHost::InitHostBeacon ( int InNumTeams, int InNumPlayersPerTeam, int InNumReservations, struct FName InSessionName )
 {
-	static UFunction* pFnInitHostBeacon = NULL;
-
+	UFunction* pFnInitHostBeacon = (UFunction*) SdkBindings::Get ( 2704 );
 	if ( ! pFnInitHostBeacon )
-		pFnInitHostBeacon = (UFunction*) UObject::GObjObjects()->Data[ 34115 ];
+		return {};
 
 	UPartyBeaconHost_execInitHostBeacon_Parms InitHostBeacon_Parms;
 	InitHostBeacon_Parms.InNumTeams = InNumTeams;
@@ -3635,10 +3471,9 @@ bool UPartyBeaconHost::InitHostBeacon ( int InNumTeams, int InNumPlayersPerTeam,
 
 int UWebRequest::GetHexDigit ( struct FString D )
 {
-	static UFunction* pFnGetHexDigit = NULL;
-
+	UFunction* pFnGetHexDigit = (UFunction*) SdkBindings::Get ( 2763 );
 	if ( ! pFnGetHexDigit )
-		pFnGetHexDigit = (UFunction*) UObject::GObjObjects()->Data[ 34325 ];
+		return {};
 
 	UWebRequest_execGetHexDigit_Parms GetHexDigit_Parms;
 	memcpy ( &GetHexDigit_Parms.D, &D, 0xC );
@@ -3655,10 +3490,9 @@ int UWebRequest::GetHexDigit ( struct FString D )
 
 void UWebRequest::DecodeFormData ( struct FString Data )
 {
-	static UFunction* pFnDecodeFormData = NULL;
-
+	UFunction* pFnDecodeFormData = (UFunction*) SdkBindings::Get ( 2762 );
 	if ( ! pFnDecodeFormData )
-		pFnDecodeFormData = (UFunction*) UObject::GObjObjects()->Data[ 34316 ];
+		return;
 
 	UWebRequest_execDecodeFormData_Parms DecodeFormData_Parms;
 	memcpy ( &DecodeFormData_Parms.Data, &Data, 0xC );
@@ -3673,10 +3507,9 @@ void UWebRequest::DecodeFormData ( struct FString Data )
 
 void UWebRequest::ProcessHeaderString ( struct FString S )
 {
-	static UFunction* pFnProcessHeaderString = NULL;
-
+	UFunction* pFnProcessHeaderString = (UFunction*) SdkBindings::Get ( 2761 );
 	if ( ! pFnProcessHeaderString )
-		pFnProcessHeaderString = (UFunction*) UObject::GObjObjects()->Data[ 34313 ];
+		return;
 
 	UWebRequest_execProcessHeaderString_Parms ProcessHeaderString_Parms;
 	memcpy ( &ProcessHeaderString_Parms.S, &S, 0xC );
@@ -3690,10 +3523,9 @@ void UWebRequest::ProcessHeaderString ( struct FString S )
 
 void UWebRequest::Dump ( )
 {
-	static UFunction* pFnDump = NULL;
-
+	UFunction* pFnDump = (UFunction*) SdkBindings::Get ( 2760 );
 	if ( ! pFnDump )
-		pFnDump = (UFunction*) UObject::GObjObjects()->Data[ 34312 ];
+		return;
 
 	UWebRequest_execDump_Parms Dump_Parms;
 
@@ -3711,10 +3543,9 @@ void UWebRequest::Dump ( )
 
 void UWebRequest::GetVariables ( TArray< struct FString >* varNames )
 {
-	static UFunction* pFnGetVariables = NULL;
-
+	UFunction* pFnGetVariables = (UFunction*) SdkBindings::Get ( 2759 );
 	if ( ! pFnGetVariables )
-		pFnGetVariables = (UFunction*) UObject::GObjObjects()->Data[ 34309 ];
+		return;
 
 	UWebRequest_execGetVariables_Parms GetVariables_Parms;
 
@@ -3738,10 +3569,9 @@ void UWebRequest::GetVariables ( TArray< struct FString >* varNames )
 
 struct FString UWebRequest::GetVariableNumber ( struct FString VariableName, int Number, struct FString DefaultValue )
 {
-	static UFunction* pFnGetVariableNumber = NULL;
-
+	UFunction* pFnGetVariableNumber = (UFunction*) SdkBindings::Get ( 2568 );
 	if ( ! pFnGetVariableNumber )
-		pFnGetVariableNumber = (UFunction*) UObject::GObjObjects()->Data[ 33463 ];
+		return {};
 
 	UWebRequest_execGetVariableNumber_Parms GetVariableNumber_Parms;
 	memcpy ( &GetVariableNumber_Parms.VariableName, &VariableName, 0xC );
@@ -3765,10 +3595,9 @@ struct FString UWebRequest::GetVariableNumber ( struct FString VariableName, int
 
 int UWebRequest::GetVariableCount ( struct FString VariableName )
 {
-	static UFunction* pFnGetVariableCount = NULL;
-
+	UFunction* pFnGetVariableCount = (UFunction*) SdkBindings::Get ( 2567 );
 	if ( ! pFnGetVariableCount )
-		pFnGetVariableCount = (UFunction*) UObject::GObjObjects()->Data[ 33461 ];
+		return {};
 
 	UWebRequest_execGetVariableCount_Parms GetVariableCount_Parms;
 	memcpy ( &GetVariableCount_Parms.VariableName, &VariableName, 0xC );
@@ -3791,10 +3620,9 @@ int UWebRequest::GetVariableCount ( struct FString VariableName )
 
 struct FString UWebRequest::GetVariable ( struct FString VariableName, struct FString DefaultValue )
 {
-	static UFunction* pFnGetVariable = NULL;
-
+	UFunction* pFnGetVariable = (UFunction*) SdkBindings::Get ( 2566 );
 	if ( ! pFnGetVariable )
-		pFnGetVariable = (UFunction*) UObject::GObjObjects()->Data[ 33459 ];
+		return {};
 
 	UWebRequest_execGetVariable_Parms GetVariable_Parms;
 	memcpy ( &GetVariable_Parms.VariableName, &VariableName, 0xC );
@@ -3817,10 +3645,9 @@ struct FString UWebRequest::GetVariable ( struct FString VariableName, struct FS
 
 void UWebRequest::AddVariable ( struct FString VariableName, struct FString Value )
 {
-	static UFunction* pFnAddVariable = NULL;
-
+	UFunction* pFnAddVariable = (UFunction*) SdkBindings::Get ( 2758 );
 	if ( ! pFnAddVariable )
-		pFnAddVariable = (UFunction*) UObject::GObjObjects()->Data[ 34300 ];
+		return;
 
 	UWebRequest_execAddVariable_Parms AddVariable_Parms;
 	memcpy ( &AddVariable_Parms.VariableName, &VariableName, 0xC );
@@ -3840,10 +3667,9 @@ void UWebRequest::AddVariable ( struct FString VariableName, struct FString Valu
 
 void UWebRequest::GetHeaders ( TArray< struct FString >* headers )
 {
-	static UFunction* pFnGetHeaders = NULL;
-
+	UFunction* pFnGetHeaders = (UFunction*) SdkBindings::Get ( 2757 );
 	if ( ! pFnGetHeaders )
-		pFnGetHeaders = (UFunction*) UObject::GObjObjects()->Data[ 34297 ];
+		return;
 
 	UWebRequest_execGetHeaders_Parms GetHeaders_Parms;
 
@@ -3866,10 +3692,9 @@ void UWebRequest::GetHeaders ( TArray< struct FString >* headers )
 
 struct FString UWebRequest::GetHeader ( struct FString HeaderName, struct FString DefaultValue )
 {
-	static UFunction* pFnGetHeader = NULL;
-
+	UFunction* pFnGetHeader = (UFunction*) SdkBindings::Get ( 2756 );
 	if ( ! pFnGetHeader )
-		pFnGetHeader = (UFunction*) UObject::GObjObjects()->Data[ 34293 ];
+		return {};
 
 	UWebRequest_execGetHeader_Parms GetHeader_Parms;
 	memcpy ( &GetHeader_Parms.HeaderName, &HeaderName, 0xC );
@@ -3892,10 +3717,9 @@ struct FString UWebRequest::GetHeader ( struct FString HeaderName, struct FStrin
 
 void UWebRequest::AddHeader ( struct FString HeaderName, struct FString Value )
 {
-	static UFunction* pFnAddHeader = NULL;
-
+	UFunction* pFnAddHeader = (UFunction*) SdkBindings::Get ( 2755 );
 	if ( ! pFnAddHeader )
-		pFnAddHeader = (UFunction*) UObject::GObjObjects()->Data[ 34290 ];
+		return;
 
 	UWebRequest_execAddHeader_Parms AddHeader_Parms;
 	memcpy ( &AddHeader_Parms.HeaderName, &HeaderName, 0xC );
@@ -3916,10 +3740,9 @@ void UWebRequest::AddHeader ( struct FString HeaderName, struct FString Value )
 
 struct FString UWebRequest::EncodeBase64 ( struct FString Decoded )
 {
-	static UFunction* pFnEncodeBase64 = NULL;
-
+	UFunction* pFnEncodeBase64 = (UFunction*) SdkBindings::Get ( 2754 );
 	if ( ! pFnEncodeBase64 )
-		pFnEncodeBase64 = (UFunction*) UObject::GObjObjects()->Data[ 34287 ];
+		return {};
 
 	UWebRequest_execEncodeBase64_Parms EncodeBase64_Parms;
 	memcpy ( &EncodeBase64_Parms.Decoded, &Decoded, 0xC );
@@ -3941,10 +3764,9 @@ struct FString UWebRequest::EncodeBase64 ( struct FString Decoded )
 
 struct FString UWebRequest::DecodeBase64 ( struct FString Encoded )
 {
-	static UFunction* pFnDecodeBase64 = NULL;
-
+	UFunction* pFnDecodeBase64 = (UFunction*) SdkBindings::Get ( 2753 );
 	if ( ! pFnDecodeBase64 )
-		pFnDecodeBase64 = (UFunction*) UObject::GObjObjects()->Data[ 34284 ];
+		return {};
 
 	UWebRequest_execDecodeBase64_Parms DecodeBase64_Parms;
 	memcpy ( &DecodeBase64_Parms.Encoded, &Encoded, 0xC );
@@ -3965,10 +3787,9 @@ struct FString UWebRequest::DecodeBase64 ( struct FString Encoded )
 
 bool UWebResponse::SentResponse ( )
 {
-	static UFunction* pFnSentResponse = NULL;
-
+	UFunction* pFnSentResponse = (UFunction*) SdkBindings::Get ( 2780 );
 	if ( ! pFnSentResponse )
-		pFnSentResponse = (UFunction*) UObject::GObjObjects()->Data[ 34384 ];
+		return {};
 
 	UWebResponse_execSentResponse_Parms SentResponse_Parms;
 
@@ -3984,10 +3805,9 @@ bool UWebResponse::SentResponse ( )
 
 bool UWebResponse::SentText ( )
 {
-	static UFunction* pFnSentText = NULL;
-
+	UFunction* pFnSentText = (UFunction*) SdkBindings::Get ( 2779 );
 	if ( ! pFnSentText )
-		pFnSentText = (UFunction*) UObject::GObjObjects()->Data[ 34382 ];
+		return {};
 
 	UWebResponse_execSentText_Parms SentText_Parms;
 
@@ -4003,10 +3823,9 @@ bool UWebResponse::SentText ( )
 
 void UWebResponse::Redirect ( struct FString URL )
 {
-	static UFunction* pFnRedirect = NULL;
-
+	UFunction* pFnRedirect = (UFunction*) SdkBindings::Get ( 2778 );
 	if ( ! pFnRedirect )
-		pFnRedirect = (UFunction*) UObject::GObjObjects()->Data[ 34380 ];
+		return;
 
 	UWebResponse_execRedirect_Parms Redirect_Parms;
 	memcpy ( &Redirect_Parms.URL, &URL, 0xC );
@@ -4022,10 +3841,9 @@ void UWebResponse::Redirect ( struct FString URL )
 
 void UWebResponse::SendStandardHeaders ( struct FString ContentType, unsigned long bCache )
 {
-	static UFunction* pFnSendStandardHeaders = NULL;
-
+	UFunction* pFnSendStandardHeaders = (UFunction*) SdkBindings::Get ( 2777 );
 	if ( ! pFnSendStandardHeaders )
-		pFnSendStandardHeaders = (UFunction*) UObject::GObjObjects()->Data[ 34376 ];
+		return;
 
 	UWebResponse_execSendStandardHeaders_Parms SendStandardHeaders_Parms;
 	memcpy ( &SendStandardHeaders_Parms.ContentType, &ContentType, 0xC );
@@ -4042,10 +3860,9 @@ void UWebResponse::SendStandardHeaders ( struct FString ContentType, unsigned lo
 
 void UWebResponse::HTTPError ( int ErrorNum, struct FString Data )
 {
-	static UFunction* pFnHTTPError = NULL;
-
+	UFunction* pFnHTTPError = (UFunction*) SdkBindings::Get ( 2776 );
 	if ( ! pFnHTTPError )
-		pFnHTTPError = (UFunction*) UObject::GObjObjects()->Data[ 34373 ];
+		return;
 
 	UWebResponse_execHTTPError_Parms HTTPError_Parms;
 	HTTPError_Parms.ErrorNum = ErrorNum;
@@ -4060,10 +3877,9 @@ void UWebResponse::HTTPError ( int ErrorNum, struct FString Data )
 
 void UWebResponse::SendHeaders ( )
 {
-	static UFunction* pFnSendHeaders = NULL;
-
+	UFunction* pFnSendHeaders = (UFunction*) SdkBindings::Get ( 2775 );
 	if ( ! pFnSendHeaders )
-		pFnSendHeaders = (UFunction*) UObject::GObjObjects()->Data[ 34371 ];
+		return;
 
 	UWebResponse_execSendHeaders_Parms SendHeaders_Parms;
 
@@ -4078,10 +3894,9 @@ void UWebResponse::SendHeaders ( )
 
 void UWebResponse::AddHeader ( struct FString Header, unsigned long bReplace )
 {
-	static UFunction* pFnAddHeader = NULL;
-
+	UFunction* pFnAddHeader = (UFunction*) SdkBindings::Get ( 2774 );
 	if ( ! pFnAddHeader )
-		pFnAddHeader = (UFunction*) UObject::GObjObjects()->Data[ 34364 ];
+		return;
 
 	UWebResponse_execAddHeader_Parms AddHeader_Parms;
 	memcpy ( &AddHeader_Parms.Header, &Header, 0xC );
@@ -4097,10 +3912,9 @@ void UWebResponse::AddHeader ( struct FString Header, unsigned long bReplace )
 
 void UWebResponse::HTTPHeader ( struct FString Header )
 {
-	static UFunction* pFnHTTPHeader = NULL;
-
+	UFunction* pFnHTTPHeader = (UFunction*) SdkBindings::Get ( 2773 );
 	if ( ! pFnHTTPHeader )
-		pFnHTTPHeader = (UFunction*) UObject::GObjObjects()->Data[ 34362 ];
+		return;
 
 	UWebResponse_execHTTPHeader_Parms HTTPHeader_Parms;
 	memcpy ( &HTTPHeader_Parms.Header, &Header, 0xC );
@@ -4115,10 +3929,9 @@ void UWebResponse::HTTPHeader ( struct FString Header )
 
 void UWebResponse::HTTPResponse ( struct FString Header )
 {
-	static UFunction* pFnHTTPResponse = NULL;
-
+	UFunction* pFnHTTPResponse = (UFunction*) SdkBindings::Get ( 2772 );
 	if ( ! pFnHTTPResponse )
-		pFnHTTPResponse = (UFunction*) UObject::GObjObjects()->Data[ 34359 ];
+		return;
 
 	UWebResponse_execHTTPResponse_Parms HTTPResponse_Parms;
 	memcpy ( &HTTPResponse_Parms.Header, &Header, 0xC );
@@ -4133,10 +3946,9 @@ void UWebResponse::HTTPResponse ( struct FString Header )
 
 void UWebResponse::FailAuthentication ( struct FString Realm )
 {
-	static UFunction* pFnFailAuthentication = NULL;
-
+	UFunction* pFnFailAuthentication = (UFunction*) SdkBindings::Get ( 2771 );
 	if ( ! pFnFailAuthentication )
-		pFnFailAuthentication = (UFunction*) UObject::GObjObjects()->Data[ 34357 ];
+		return;
 
 	UWebResponse_execFailAuthentication_Parms FailAuthentication_Parms;
 	memcpy ( &FailAuthentication_Parms.Realm, &Realm, 0xC );
@@ -4153,10 +3965,9 @@ void UWebResponse::FailAuthentication ( struct FString Realm )
 
 bool UWebResponse::SendCachedFile ( struct FString Filename, struct FString ContentType )
 {
-	static UFunction* pFnSendCachedFile = NULL;
-
+	UFunction* pFnSendCachedFile = (UFunction*) SdkBindings::Get ( 2770 );
 	if ( ! pFnSendCachedFile )
-		pFnSendCachedFile = (UFunction*) UObject::GObjObjects()->Data[ 34353 ];
+		return {};
 
 	UWebResponse_execSendCachedFile_Parms SendCachedFile_Parms;
 	memcpy ( &SendCachedFile_Parms.Filename, &Filename, 0xC );
@@ -4175,10 +3986,9 @@ bool UWebResponse::SendCachedFile ( struct FString Filename, struct FString Cont
 
 void UWebResponse::eventSendBinary ( int Count, unsigned char* B )
 {
-	static UFunction* pFnSendBinary = NULL;
-
+	UFunction* pFnSendBinary = (UFunction*) SdkBindings::Get ( 2769 );
 	if ( ! pFnSendBinary )
-		pFnSendBinary = (UFunction*) UObject::GObjObjects()->Data[ 34350 ];
+		return;
 
 	UWebResponse_eventSendBinary_Parms SendBinary_Parms;
 	SendBinary_Parms.Count = Count;
@@ -4195,10 +4005,9 @@ void UWebResponse::eventSendBinary ( int Count, unsigned char* B )
 
 void UWebResponse::eventSendText ( struct FString Text, unsigned long bNoCRLF )
 {
-	static UFunction* pFnSendText = NULL;
-
+	UFunction* pFnSendText = (UFunction*) SdkBindings::Get ( 2768 );
 	if ( ! pFnSendText )
-		pFnSendText = (UFunction*) UObject::GObjObjects()->Data[ 34346 ];
+		return;
 
 	UWebResponse_eventSendText_Parms SendText_Parms;
 	memcpy ( &SendText_Parms.Text, &Text, 0xC );
@@ -4213,10 +4022,9 @@ void UWebResponse::eventSendText ( struct FString Text, unsigned long bNoCRLF )
 
 void UWebResponse::Dump ( )
 {
-	static UFunction* pFnDump = NULL;
-
+	UFunction* pFnDump = (UFunction*) SdkBindings::Get ( 2767 );
 	if ( ! pFnDump )
-		pFnDump = (UFunction*) UObject::GObjObjects()->Data[ 34345 ];
+		return;
 
 	UWebResponse_execDump_Parms Dump_Parms;
 
@@ -4235,10 +4043,9 @@ void UWebResponse::Dump ( )
 
 struct FString UWebResponse::GetHTTPExpiration ( int OffsetSeconds )
 {
-	static UFunction* pFnGetHTTPExpiration = NULL;
-
+	UFunction* pFnGetHTTPExpiration = (UFunction*) SdkBindings::Get ( 2766 );
 	if ( ! pFnGetHTTPExpiration )
-		pFnGetHTTPExpiration = (UFunction*) UObject::GObjObjects()->Data[ 34342 ];
+		return {};
 
 	UWebResponse_execGetHTTPExpiration_Parms GetHTTPExpiration_Parms;
 	GetHTTPExpiration_Parms.OffsetSeconds = OffsetSeconds;
@@ -4260,10 +4067,9 @@ struct FString UWebResponse::GetHTTPExpiration ( int OffsetSeconds )
 
 struct FString UWebResponse::LoadParsedUHTM ( struct FString Filename )
 {
-	static UFunction* pFnLoadParsedUHTM = NULL;
-
+	UFunction* pFnLoadParsedUHTM = (UFunction*) SdkBindings::Get ( 2765 );
 	if ( ! pFnLoadParsedUHTM )
-		pFnLoadParsedUHTM = (UFunction*) UObject::GObjObjects()->Data[ 34339 ];
+		return {};
 
 	UWebResponse_execLoadParsedUHTM_Parms LoadParsedUHTM_Parms;
 	memcpy ( &LoadParsedUHTM_Parms.Filename, &Filename, 0xC );
@@ -4285,10 +4091,9 @@ struct FString UWebResponse::LoadParsedUHTM ( struct FString Filename )
 
 bool UWebResponse::IncludeBinaryFile ( struct FString Filename )
 {
-	static UFunction* pFnIncludeBinaryFile = NULL;
-
+	UFunction* pFnIncludeBinaryFile = (UFunction*) SdkBindings::Get ( 2573 );
 	if ( ! pFnIncludeBinaryFile )
-		pFnIncludeBinaryFile = (UFunction*) UObject::GObjObjects()->Data[ 33476 ];
+		return {};
 
 	UWebResponse_execIncludeBinaryFile_Parms IncludeBinaryFile_Parms;
 	memcpy ( &IncludeBinaryFile_Parms.Filename, &Filename, 0xC );
@@ -4310,10 +4115,9 @@ bool UWebResponse::IncludeBinaryFile ( struct FString Filename )
 
 bool UWebResponse::IncludeUHTM ( struct FString Filename )
 {
-	static UFunction* pFnIncludeUHTM = NULL;
-
+	UFunction* pFnIncludeUHTM = (UFunction*) SdkBindings::Get ( 2570 );
 	if ( ! pFnIncludeUHTM )
-		pFnIncludeUHTM = (UFunction*) UObject::GObjObjects()->Data[ 33466 ];
+		return {};
 
 	UWebResponse_execIncludeUHTM_Parms IncludeUHTM_Parms;
 	memcpy ( &IncludeUHTM_Parms.Filename, &Filename, 0xC );
@@ -4333,10 +4137,9 @@ bool UWebResponse::IncludeUHTM ( struct FString Filename )
 
 void UWebResponse::ClearSubst ( )
 {
-	static UFunction* pFnClearSubst = NULL;
-
+	UFunction* pFnClearSubst = (UFunction*) SdkBindings::Get ( 2764 );
 	if ( ! pFnClearSubst )
-		pFnClearSubst = (UFunction*) UObject::GObjObjects()->Data[ 34336 ];
+		return;
 
 	UWebResponse_execClearSubst_Parms ClearSubst_Parms;
 
@@ -4356,10 +4159,9 @@ void UWebResponse::ClearSubst ( )
 
 void UWebResponse::Subst ( struct FString Variable, struct FString Value, unsigned long bClear )
 {
-	static UFunction* pFnSubst = NULL;
-
+	UFunction* pFnSubst = (UFunction*) SdkBindings::Get ( 2569 );
 	if ( ! pFnSubst )
-		pFnSubst = (UFunction*) UObject::GObjObjects()->Data[ 33465 ];
+		return;
 
 	UWebResponse_execSubst_Parms Subst_Parms;
 	memcpy ( &Subst_Parms.Variable, &Variable, 0xC );
@@ -4381,10 +4183,9 @@ void UWebResponse::Subst ( struct FString Variable, struct FString Value, unsign
 
 bool UWebResponse::FileExists ( struct FString Filename )
 {
-	static UFunction* pFnFileExists = NULL;
-
+	UFunction* pFnFileExists = (UFunction*) SdkBindings::Get ( 2572 );
 	if ( ! pFnFileExists )
-		pFnFileExists = (UFunction*) UObject::GObjObjects()->Data[ 33474 ];
+		return {};
 
 	UWebResponse_execFileExists_Parms FileExists_Parms;
 	memcpy ( &FileExists_Parms.Filename, &Filename, 0xC );
@@ -4406,10 +4207,9 @@ bool UWebResponse::FileExists ( struct FString Filename )
 
 void UWebApplication::PostQuery ( class UWebRequest* request, class UWebResponse* Response )
 {
-	static UFunction* pFnPostQuery = NULL;
-
+	UFunction* pFnPostQuery = (UFunction*) SdkBindings::Get ( 2563 );
 	if ( ! pFnPostQuery )
-		pFnPostQuery = (UFunction*) UObject::GObjObjects()->Data[ 33444 ];
+		return;
 
 	UWebApplication_execPostQuery_Parms PostQuery_Parms;
 	PostQuery_Parms.request = request;
@@ -4426,10 +4226,9 @@ void UWebApplication::PostQuery ( class UWebRequest* request, class UWebResponse
 
 void UWebApplication::Query ( class UWebRequest* request, class UWebResponse* Response )
 {
-	static UFunction* pFnQuery = NULL;
-
+	UFunction* pFnQuery = (UFunction*) SdkBindings::Get ( 2562 );
 	if ( ! pFnQuery )
-		pFnQuery = (UFunction*) UObject::GObjObjects()->Data[ 33441 ];
+		return;
 
 	UWebApplication_execQuery_Parms Query_Parms;
 	Query_Parms.request = request;
@@ -4447,10 +4246,9 @@ void UWebApplication::Query ( class UWebRequest* request, class UWebResponse* Re
 
 bool UWebApplication::PreQuery ( class UWebRequest* request, class UWebResponse* Response )
 {
-	static UFunction* pFnPreQuery = NULL;
-
+	UFunction* pFnPreQuery = (UFunction*) SdkBindings::Get ( 2561 );
 	if ( ! pFnPreQuery )
-		pFnPreQuery = (UFunction*) UObject::GObjObjects()->Data[ 33437 ];
+		return {};
 
 	UWebApplication_execPreQuery_Parms PreQuery_Parms;
 	PreQuery_Parms.request = request;
@@ -4467,10 +4265,9 @@ bool UWebApplication::PreQuery ( class UWebRequest* request, class UWebResponse*
 
 void UWebApplication::CleanupApp ( )
 {
-	static UFunction* pFnCleanupApp = NULL;
-
+	UFunction* pFnCleanupApp = (UFunction*) SdkBindings::Get ( 2560 );
 	if ( ! pFnCleanupApp )
-		pFnCleanupApp = (UFunction*) UObject::GObjObjects()->Data[ 33434 ];
+		return;
 
 	UWebApplication_execCleanupApp_Parms CleanupApp_Parms;
 
@@ -4483,10 +4280,9 @@ void UWebApplication::CleanupApp ( )
 
 void UWebApplication::Cleanup ( )
 {
-	static UFunction* pFnCleanup = NULL;
-
+	UFunction* pFnCleanup = (UFunction*) SdkBindings::Get ( 2559 );
 	if ( ! pFnCleanup )
-		pFnCleanup = (UFunction*) UObject::GObjObjects()->Data[ 33433 ];
+		return;
 
 	UWebApplication_execCleanup_Parms Cleanup_Parms;
 
@@ -4499,10 +4295,9 @@ void UWebApplication::Cleanup ( )
 
 void UWebApplication::Init ( )
 {
-	static UFunction* pFnInit = NULL;
-
+	UFunction* pFnInit = (UFunction*) SdkBindings::Get ( 2558 );
 	if ( ! pFnInit )
-		pFnInit = (UFunction*) UObject::GObjObjects()->Data[ 33432 ];
+		return;
 
 	UWebApplication_execInit_Parms Init_Parms;
 
@@ -4518,10 +4313,9 @@ void UWebApplication::Init ( )
 
 class UWebApplication* AWebServer::GetApplication ( struct FString URI, struct FString* SubURI )
 {
-	static UFunction* pFnGetApplication = NULL;
-
+	UFunction* pFnGetApplication = (UFunction*) SdkBindings::Get ( 2746 );
 	if ( ! pFnGetApplication )
-		pFnGetApplication = (UFunction*) UObject::GObjObjects()->Data[ 34261 ];
+		return {};
 
 	AWebServer_execGetApplication_Parms GetApplication_Parms;
 	memcpy ( &GetApplication_Parms.URI, &URI, 0xC );
@@ -4541,10 +4335,9 @@ class UWebApplication* AWebServer::GetApplication ( struct FString URI, struct F
 
 void AWebServer::eventLostChild ( class AActor* C )
 {
-	static UFunction* pFnLostChild = NULL;
-
+	UFunction* pFnLostChild = (UFunction*) SdkBindings::Get ( 2784 );
 	if ( ! pFnLostChild )
-		pFnLostChild = (UFunction*) UObject::GObjObjects()->Data[ 34406 ];
+		return;
 
 	AWebServer_eventLostChild_Parms LostChild_Parms;
 	LostChild_Parms.C = C;
@@ -4559,10 +4352,9 @@ void AWebServer::eventLostChild ( class AActor* C )
 
 void AWebServer::eventGainedChild ( class AActor* C )
 {
-	static UFunction* pFnGainedChild = NULL;
-
+	UFunction* pFnGainedChild = (UFunction*) SdkBindings::Get ( 2783 );
 	if ( ! pFnGainedChild )
-		pFnGainedChild = (UFunction*) UObject::GObjObjects()->Data[ 34402 ];
+		return;
 
 	AWebServer_eventGainedChild_Parms GainedChild_Parms;
 	GainedChild_Parms.C = C;
@@ -4576,10 +4368,9 @@ void AWebServer::eventGainedChild ( class AActor* C )
 
 void AWebServer::eventDestroyed ( )
 {
-	static UFunction* pFnDestroyed = NULL;
-
+	UFunction* pFnDestroyed = (UFunction*) SdkBindings::Get ( 2782 );
 	if ( ! pFnDestroyed )
-		pFnDestroyed = (UFunction*) UObject::GObjObjects()->Data[ 34400 ];
+		return;
 
 	AWebServer_eventDestroyed_Parms Destroyed_Parms;
 
@@ -4592,10 +4383,9 @@ void AWebServer::eventDestroyed ( )
 
 void AWebServer::PostBeginPlay ( )
 {
-	static UFunction* pFnPostBeginPlay = NULL;
-
+	UFunction* pFnPostBeginPlay = (UFunction*) SdkBindings::Get ( 2781 );
 	if ( ! pFnPostBeginPlay )
-		pFnPostBeginPlay = (UFunction*) UObject::GObjObjects()->Data[ 34389 ];
+		return;
 
 	AWebServer_execPostBeginPlay_Parms PostBeginPlay_Parms;
 
@@ -4610,10 +4400,9 @@ void AWebServer::PostBeginPlay ( )
 
 void UHelloWeb::PostQuery ( class UWebRequest* request, class UWebResponse* Response )
 {
-	static UFunction* pFnPostQuery = NULL;
-
+	UFunction* pFnPostQuery = (UFunction*) SdkBindings::Get ( 2563 );
 	if ( ! pFnPostQuery )
-		pFnPostQuery = (UFunction*) UObject::GObjObjects()->Data[ 33444 ];
+		return;
 
 	UHelloWeb_execPostQuery_Parms PostQuery_Parms;
 	PostQuery_Parms.request = request;
@@ -4630,10 +4419,9 @@ void UHelloWeb::PostQuery ( class UWebRequest* request, class UWebResponse* Resp
 
 void UHelloWeb::Query ( class UWebRequest* request, class UWebResponse* Response )
 {
-	static UFunction* pFnQuery = NULL;
-
+	UFunction* pFnQuery = (UFunction*) SdkBindings::Get ( 2562 );
 	if ( ! pFnQuery )
-		pFnQuery = (UFunction*) UObject::GObjObjects()->Data[ 33441 ];
+		return;
 
 	UHelloWeb_execQuery_Parms Query_Parms;
 	Query_Parms.request = request;
@@ -4651,10 +4439,9 @@ void UHelloWeb::Query ( class UWebRequest* request, class UWebResponse* Response
 
 bool UHelloWeb::PreQuery ( class UWebRequest* request, class UWebResponse* Response )
 {
-	static UFunction* pFnPreQuery = NULL;
-
+	UFunction* pFnPreQuery = (UFunction*) SdkBindings::Get ( 2561 );
 	if ( ! pFnPreQuery )
-		pFnPreQuery = (UFunction*) UObject::GObjObjects()->Data[ 33437 ];
+		return {};
 
 	UHelloWeb_execPreQuery_Parms PreQuery_Parms;
 	PreQuery_Parms.request = request;
@@ -4671,10 +4458,9 @@ bool UHelloWeb::PreQuery ( class UWebRequest* request, class UWebResponse* Respo
 
 void UHelloWeb::CleanupApp ( )
 {
-	static UFunction* pFnCleanupApp = NULL;
-
+	UFunction* pFnCleanupApp = (UFunction*) SdkBindings::Get ( 2560 );
 	if ( ! pFnCleanupApp )
-		pFnCleanupApp = (UFunction*) UObject::GObjObjects()->Data[ 33434 ];
+		return;
 
 	UHelloWeb_execCleanupApp_Parms CleanupApp_Parms;
 
@@ -4687,10 +4473,9 @@ void UHelloWeb::CleanupApp ( )
 
 void UHelloWeb::Cleanup ( )
 {
-	static UFunction* pFnCleanup = NULL;
-
+	UFunction* pFnCleanup = (UFunction*) SdkBindings::Get ( 2559 );
 	if ( ! pFnCleanup )
-		pFnCleanup = (UFunction*) UObject::GObjObjects()->Data[ 33433 ];
+		return;
 
 	UHelloWeb_execCleanup_Parms Cleanup_Parms;
 
@@ -4703,10 +4488,9 @@ void UHelloWeb::Cleanup ( )
 
 void UHelloWeb::Init ( )
 {
-	static UFunction* pFnInit = NULL;
-
+	UFunction* pFnInit = (UFunction*) SdkBindings::Get ( 2558 );
 	if ( ! pFnInit )
-		pFnInit = (UFunction*) UObject::GObjObjects()->Data[ 33432 ];
+		return;
 
 	UHelloWeb_execInit_Parms Init_Parms;
 
@@ -4721,10 +4505,9 @@ void UHelloWeb::Init ( )
 
 void UImageServer::PostQuery ( class UWebRequest* request, class UWebResponse* Response )
 {
-	static UFunction* pFnPostQuery = NULL;
-
+	UFunction* pFnPostQuery = (UFunction*) SdkBindings::Get ( 2563 );
 	if ( ! pFnPostQuery )
-		pFnPostQuery = (UFunction*) UObject::GObjObjects()->Data[ 33444 ];
+		return;
 
 	UImageServer_execPostQuery_Parms PostQuery_Parms;
 	PostQuery_Parms.request = request;
@@ -4741,10 +4524,9 @@ void UImageServer::PostQuery ( class UWebRequest* request, class UWebResponse* R
 
 void UImageServer::Query ( class UWebRequest* request, class UWebResponse* Response )
 {
-	static UFunction* pFnQuery = NULL;
-
+	UFunction* pFnQuery = (UFunction*) SdkBindings::Get ( 2562 );
 	if ( ! pFnQuery )
-		pFnQuery = (UFunction*) UObject::GObjObjects()->Data[ 33441 ];
+		return;
 
 	UImageServer_execQuery_Parms Query_Parms;
 	Query_Parms.request = request;
@@ -4762,10 +4544,9 @@ void UImageServer::Query ( class UWebRequest* request, class UWebResponse* Respo
 
 bool UImageServer::PreQuery ( class UWebRequest* request, class UWebResponse* Response )
 {
-	static UFunction* pFnPreQuery = NULL;
-
+	UFunction* pFnPreQuery = (UFunction*) SdkBindings::Get ( 2561 );
 	if ( ! pFnPreQuery )
-		pFnPreQuery = (UFunction*) UObject::GObjObjects()->Data[ 33437 ];
+		return {};
 
 	UImageServer_execPreQuery_Parms PreQuery_Parms;
 	PreQuery_Parms.request = request;
@@ -4782,10 +4563,9 @@ bool UImageServer::PreQuery ( class UWebRequest* request, class UWebResponse* Re
 
 void UImageServer::CleanupApp ( )
 {
-	static UFunction* pFnCleanupApp = NULL;
-
+	UFunction* pFnCleanupApp = (UFunction*) SdkBindings::Get ( 2560 );
 	if ( ! pFnCleanupApp )
-		pFnCleanupApp = (UFunction*) UObject::GObjObjects()->Data[ 33434 ];
+		return;
 
 	UImageServer_execCleanupApp_Parms CleanupApp_Parms;
 
@@ -4798,10 +4578,9 @@ void UImageServer::CleanupApp ( )
 
 void UImageServer::Cleanup ( )
 {
-	static UFunction* pFnCleanup = NULL;
-
+	UFunction* pFnCleanup = (UFunction*) SdkBindings::Get ( 2559 );
 	if ( ! pFnCleanup )
-		pFnCleanup = (UFunction*) UObject::GObjObjects()->Data[ 33433 ];
+		return;
 
 	UImageServer_execCleanup_Parms Cleanup_Parms;
 
@@ -4814,10 +4593,9 @@ void UImageServer::Cleanup ( )
 
 void UImageServer::Init ( )
 {
-	static UFunction* pFnInit = NULL;
-
+	UFunction* pFnInit = (UFunction*) SdkBindings::Get ( 2558 );
 	if ( ! pFnInit )
-		pFnInit = (UFunction*) UObject::GObjObjects()->Data[ 33432 ];
+		return;
 
 	UImageServer_execInit_Parms Init_Parms;
 
@@ -4831,10 +4609,9 @@ void UImageServer::Init ( )
 
 bool AWebConnection::IsHanging ( )
 {
-	static UFunction* pFnIsHanging = NULL;
-
+	UFunction* pFnIsHanging = (UFunction*) SdkBindings::Get ( 2752 );
 	if ( ! pFnIsHanging )
-		pFnIsHanging = (UFunction*) UObject::GObjObjects()->Data[ 34278 ];
+		return {};
 
 	AWebConnection_execIsHanging_Parms IsHanging_Parms;
 
@@ -4849,10 +4626,9 @@ bool AWebConnection::IsHanging ( )
 
 void AWebConnection::Cleanup ( )
 {
-	static UFunction* pFnCleanup = NULL;
-
+	UFunction* pFnCleanup = (UFunction*) SdkBindings::Get ( 2751 );
 	if ( ! pFnCleanup )
-		pFnCleanup = (UFunction*) UObject::GObjObjects()->Data[ 34277 ];
+		return;
 
 	AWebConnection_execCleanup_Parms Cleanup_Parms;
 
@@ -4865,10 +4641,9 @@ void AWebConnection::Cleanup ( )
 
 void AWebConnection::CheckRawBytes ( )
 {
-	static UFunction* pFnCheckRawBytes = NULL;
-
+	UFunction* pFnCheckRawBytes = (UFunction*) SdkBindings::Get ( 2750 );
 	if ( ! pFnCheckRawBytes )
-		pFnCheckRawBytes = (UFunction*) UObject::GObjObjects()->Data[ 34275 ];
+		return;
 
 	AWebConnection_execCheckRawBytes_Parms CheckRawBytes_Parms;
 
@@ -4881,10 +4656,9 @@ void AWebConnection::CheckRawBytes ( )
 
 void AWebConnection::EndOfHeaders ( )
 {
-	static UFunction* pFnEndOfHeaders = NULL;
-
+	UFunction* pFnEndOfHeaders = (UFunction*) SdkBindings::Get ( 2749 );
 	if ( ! pFnEndOfHeaders )
-		pFnEndOfHeaders = (UFunction*) UObject::GObjObjects()->Data[ 34273 ];
+		return;
 
 	AWebConnection_execEndOfHeaders_Parms EndOfHeaders_Parms;
 
@@ -4897,10 +4671,9 @@ void AWebConnection::EndOfHeaders ( )
 
 void AWebConnection::CreateResponseObject ( )
 {
-	static UFunction* pFnCreateResponseObject = NULL;
-
+	UFunction* pFnCreateResponseObject = (UFunction*) SdkBindings::Get ( 2748 );
 	if ( ! pFnCreateResponseObject )
-		pFnCreateResponseObject = (UFunction*) UObject::GObjObjects()->Data[ 34269 ];
+		return;
 
 	AWebConnection_execCreateResponseObject_Parms CreateResponseObject_Parms;
 
@@ -4914,10 +4687,9 @@ void AWebConnection::CreateResponseObject ( )
 
 void AWebConnection::ProcessPost ( struct FString S )
 {
-	static UFunction* pFnProcessPost = NULL;
-
+	UFunction* pFnProcessPost = (UFunction*) SdkBindings::Get ( 2747 );
 	if ( ! pFnProcessPost )
-		pFnProcessPost = (UFunction*) UObject::GObjObjects()->Data[ 34266 ];
+		return;
 
 	AWebConnection_execProcessPost_Parms ProcessPost_Parms;
 	memcpy ( &ProcessPost_Parms.S, &S, 0xC );
@@ -4932,10 +4704,9 @@ void AWebConnection::ProcessPost ( struct FString S )
 
 void AWebConnection::ProcessGet ( struct FString S )
 {
-	static UFunction* pFnProcessGet = NULL;
-
+	UFunction* pFnProcessGet = (UFunction*) SdkBindings::Get ( 2745 );
 	if ( ! pFnProcessGet )
-		pFnProcessGet = (UFunction*) UObject::GObjObjects()->Data[ 34256 ];
+		return;
 
 	AWebConnection_execProcessGet_Parms ProcessGet_Parms;
 	memcpy ( &ProcessGet_Parms.S, &S, 0xC );
@@ -4950,10 +4721,9 @@ void AWebConnection::ProcessGet ( struct FString S )
 
 void AWebConnection::ProcessHead ( struct FString S )
 {
-	static UFunction* pFnProcessHead = NULL;
-
+	UFunction* pFnProcessHead = (UFunction*) SdkBindings::Get ( 2744 );
 	if ( ! pFnProcessHead )
-		pFnProcessHead = (UFunction*) UObject::GObjObjects()->Data[ 34254 ];
+		return;
 
 	AWebConnection_execProcessHead_Parms ProcessHead_Parms;
 	memcpy ( &ProcessHead_Parms.S, &S, 0xC );
@@ -4968,10 +4738,9 @@ void AWebConnection::ProcessHead ( struct FString S )
 
 void AWebConnection::ReceivedLine ( struct FString S )
 {
-	static UFunction* pFnReceivedLine = NULL;
-
+	UFunction* pFnReceivedLine = (UFunction*) SdkBindings::Get ( 2743 );
 	if ( ! pFnReceivedLine )
-		pFnReceivedLine = (UFunction*) UObject::GObjObjects()->Data[ 34251 ];
+		return;
 
 	AWebConnection_execReceivedLine_Parms ReceivedLine_Parms;
 	memcpy ( &ReceivedLine_Parms.S, &S, 0xC );
@@ -4986,10 +4755,9 @@ void AWebConnection::ReceivedLine ( struct FString S )
 
 void AWebConnection::eventReceivedText ( struct FString Text )
 {
-	static UFunction* pFnReceivedText = NULL;
-
+	UFunction* pFnReceivedText = (UFunction*) SdkBindings::Get ( 2742 );
 	if ( ! pFnReceivedText )
-		pFnReceivedText = (UFunction*) UObject::GObjObjects()->Data[ 34245 ];
+		return;
 
 	AWebConnection_eventReceivedText_Parms ReceivedText_Parms;
 	memcpy ( &ReceivedText_Parms.Text, &Text, 0xC );
@@ -5003,10 +4771,9 @@ void AWebConnection::eventReceivedText ( struct FString Text )
 
 void AWebConnection::eventTimer ( )
 {
-	static UFunction* pFnTimer = NULL;
-
+	UFunction* pFnTimer = (UFunction*) SdkBindings::Get ( 2741 );
 	if ( ! pFnTimer )
-		pFnTimer = (UFunction*) UObject::GObjObjects()->Data[ 34243 ];
+		return;
 
 	AWebConnection_eventTimer_Parms Timer_Parms;
 
@@ -5019,10 +4786,9 @@ void AWebConnection::eventTimer ( )
 
 void AWebConnection::eventClosed ( )
 {
-	static UFunction* pFnClosed = NULL;
-
+	UFunction* pFnClosed = (UFunction*) SdkBindings::Get ( 2740 );
 	if ( ! pFnClosed )
-		pFnClosed = (UFunction*) UObject::GObjObjects()->Data[ 34242 ];
+		return;
 
 	AWebConnection_eventClosed_Parms Closed_Parms;
 
@@ -5035,10 +4801,9 @@ void AWebConnection::eventClosed ( )
 
 void AWebConnection::eventAccepted ( )
 {
-	static UFunction* pFnAccepted = NULL;
-
+	UFunction* pFnAccepted = (UFunction*) SdkBindings::Get ( 2739 );
 	if ( ! pFnAccepted )
-		pFnAccepted = (UFunction*) UObject::GObjObjects()->Data[ 34238 ];
+		return;
 
 	AWebConnection_eventAccepted_Parms Accepted_Parms;
 
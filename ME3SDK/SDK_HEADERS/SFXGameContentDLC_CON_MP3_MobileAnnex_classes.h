@@ -41,16 +41,9 @@ class USFXEngagement_MobileAnnex : public USFXEngagement_MobileAnnex_Base
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 124620 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7406 );
 	};
 
 	float GetCreditsReward ( );
@@ -76,8 +69,6 @@ public:
 	void InitializeWave ( class ASFXWaveManager* OwnerManager );
 };
 
-UClass* USFXEngagement_MobileAnnex::pClassPointer = NULL;
-
 
 #ifdef _MSC_VER
 	#pragma pack ( pop )
@@ -28,10 +28,9 @@
 
 float USFXEngagement_MobileAnnex::GetCreditsReward ( )
 {
-	static UFunction* pFnGetCreditsReward = NULL;
-
+	UFunction* pFnGetCreditsReward = (UFunction*) SdkBindings::Get ( 6254 );
 	if ( ! pFnGetCreditsReward )
-		pFnGetCreditsReward = (UFunction*) UObject::GObjObjects()->Data[ 108350 ];
+		return {};
 
 	USFXEngagement_MobileAnnex_execGetCreditsReward_Parms GetCreditsReward_Parms;
 
@@ -47,10 +46,9 @@ float USFXEngagement_MobileAnnex::GetCreditsReward ( )
 
 float USFXEngagement_MobileAnnex::GetCreditBudget ( )
 {
-	static UFunction* pFnGetCreditBudget = NULL;
-
+	UFunction* pFnGetCreditBudget = (UFunction*) SdkBindings::Get ( 6253 );
 	if ( ! pFnGetCreditBudget )
-		pFnGetCreditBudget = (UFunction*) UObject::GObjObjects()->Data[ 108348 ];
+		return {};
 
 	USFXEngagement_MobileAnnex_execGetCreditBudget_Parms GetCreditBudget_Parms;
 
@@ -65,10 +63,9 @@ float USFXEngagement_MobileAnnex::GetCreditBudget ( )
 
 void USFXEngagement_MobileAnnex::DistributeObjectiveScore ( )
 {
-	static UFunction* pFnDistributeObjectiveScore = NULL;
-
+	UFunction* pFnDistributeObjectiveScore = (UFunction*) SdkBindings::Get ( 6252 );
 	if ( ! pFnDistributeObjectiveScore )
-		pFnDistributeObjectiveScore = (UFunction*) UObject::GObjObjects()->Data[ 108333 ];
+		return;
 
 	USFXEngagement_MobileAnnex_execDistributeObjectiveScore_Parms DistributeObjectiveScore_Parms;
 
@@ -81,10 +78,9 @@ void USFXEngagement_MobileAnnex::DistributeObjectiveScore ( )
 
 void USFXEngagement_MobileAnnex::CountdownTimerExpired ( )
 {
-	static UFunction* pFnCountdownTimerExpired = NULL;
-
+	UFunction* pFnCountdownTimerExpired = (UFunction*) SdkBindings::Get ( 6251 );
 	if ( ! pFnCountdownTimerExpired )
-		pFnCountdownTimerExpired = (UFunction*) UObject::GObjObjects()->Data[ 108331 ];
+		return;
 
 	USFXEngagement_MobileAnnex_execCountdownTimerExpired_Parms CountdownTimerExpired_Parms;
 
@@ -97,10 +93,9 @@ void USFXEngagement_MobileAnnex::CountdownTimerExpired ( )
 
 void USFXEngagement_MobileAnnex::CancelCountdownTimer ( )
 {
-	static UFunction* pFnCancelCountdownTimer = NULL;
-
+	UFunction* pFnCancelCountdownTimer = (UFunction*) SdkBindings::Get ( 6250 );
 	if ( ! pFnCancelCountdownTimer )
-		pFnCancelCountdownTimer = (UFunction*) UObject::GObjObjects()->Data[ 108329 ];
+		return;
 
 	USFXEngagement_MobileAnnex_execCancelCountdownTimer_Parms CancelCountdownTimer_Parms;
 
@@ -113,10 +108,9 @@ void USFXEngagement_MobileAnnex::CancelCountdownTimer ( )
 
 void USFXEngagement_MobileAnnex::LocalPlayerTimeWarningHint ( )
 {
-	static UFunction* pFnLocalPlayerTimeWarningHint = NULL;
-
+	UFunction* pFnLocalPlayerTimeWarningHint = (UFunction*) SdkBindings::Get ( 6249 );
 	if ( ! pFnLocalPlayerTimeWarningHint )
-		pFnLocalPlayerTimeWarningHint = (UFunction*) UObject::GObjObjects()->Data[ 108326 ];
+		return;
 
 	USFXEngagement_MobileAnnex_execLocalPlayerTimeWarningHint_Parms LocalPlayerTimeWarningHint_Parms;
 
@@ -130,10 +124,9 @@ void USFXEngagement_MobileAnnex::LocalPlayerTimeWarningHint ( )
 
 void USFXEngagement_MobileAnnex::SetTimeLimit ( float TimeLimit )
 {
-	static UFunction* pFnSetTimeLimit = NULL;
-
+	UFunction* pFnSetTimeLimit = (UFunction*) SdkBindings::Get ( 6248 );
 	if ( ! pFnSetTimeLimit )
-		pFnSetTimeLimit = (UFunction*) UObject::GObjObjects()->Data[ 108322 ];
+		return;
 
 	USFXEngagement_MobileAnnex_execSetTimeLimit_Parms SetTimeLimit_Parms;
 	SetTimeLimit_Parms.TimeLimit = TimeLimit;
@@ -147,10 +140,9 @@ void USFXEngagement_MobileAnnex::SetTimeLimit ( float TimeLimit )
 
 void USFXEngagement_MobileAnnex::BeginWaveTimeLimit ( )
 {
-	static UFunction* pFnBeginWaveTimeLimit = NULL;
-
+	UFunction* pFnBeginWaveTimeLimit = (UFunction*) SdkBindings::Get ( 6247 );
 	if ( ! pFnBeginWaveTimeLimit )
-		pFnBeginWaveTimeLimit = (UFunction*) UObject::GObjObjects()->Data[ 108318 ];
+		return;
 
 	USFXEngagement_MobileAnnex_execBeginWaveTimeLimit_Parms BeginWaveTimeLimit_Parms;
 
@@ -164,10 +156,9 @@ void USFXEngagement_MobileAnnex::BeginWaveTimeLimit ( )
 
 void USFXEngagement_MobileAnnex::DeactivateObjectiveCombatZone ( class AActor* ObjectiveActor )
 {
-	static UFunction* pFnDeactivateObjectiveCombatZone = NULL;
-
+	UFunction* pFnDeactivateObjectiveCombatZone = (UFunction*) SdkBindings::Get ( 6246 );
 	if ( ! pFnDeactivateObjectiveCombatZone )
-		pFnDeactivateObjectiveCombatZone = (UFunction*) UObject::GObjObjects()->Data[ 108313 ];
+		return;
 
 	USFXEngagement_MobileAnnex_execDeactivateObjectiveCombatZone_Parms DeactivateObjectiveCombatZone_Parms;
 	DeactivateObjectiveCombatZone_Parms.ObjectiveActor = ObjectiveActor;
@@ -182,10 +173,9 @@ void USFXEngagement_MobileAnnex::DeactivateObjectiveCombatZone ( class AActor* O
 
 void USFXEngagement_MobileAnnex::ActivateObjectiveCombatZone ( class AActor* ObjectiveActor )
 {
-	static UFunction* pFnActivateObjectiveCombatZone = NULL;
-
+	UFunction* pFnActivateObjectiveCombatZone = (UFunction*) SdkBindings::Get ( 6244 );
 	if ( ! pFnActivateObjectiveCombatZone )
-		pFnActivateObjectiveCombatZone = (UFunction*) UObject::GObjObjects()->Data[ 108307 ];
+		return;
 
 	USFXEngagement_MobileAnnex_execActivateObjectiveCombatZone_Parms ActivateObjectiveCombatZone_Parms;
 	ActivateObjectiveCombatZone_Parms.ObjectiveActor = ObjectiveActor;
@@ -200,10 +190,9 @@ void USFXEngagement_MobileAnnex::ActivateObjectiveCombatZone ( class AActor* Obj
 
 void USFXEngagement_MobileAnnex::PawnDestroyed ( class ABioPawn* Pawn )
 {
-	static UFunction* pFnPawnDestroyed = NULL;
-
+	UFunction* pFnPawnDestroyed = (UFunction*) SdkBindings::Get ( 6245 );
 	if ( ! pFnPawnDestroyed )
-		pFnPawnDestroyed = (UFunction*) UObject::GObjObjects()->Data[ 108312 ];
+		return;
 
 	USFXEngagement_MobileAnnex_execPawnDestroyed_Parms PawnDestroyed_Parms;
 	PawnDestroyed_Parms.Pawn = Pawn;
@@ -218,10 +207,9 @@ void USFXEngagement_MobileAnnex::PawnDestroyed ( class ABioPawn* Pawn )
 
 void USFXEngagement_MobileAnnex::PawnRevived ( class ABioPawn* Pawn )
 {
-	static UFunction* pFnPawnRevived = NULL;
-
+	UFunction* pFnPawnRevived = (UFunction*) SdkBindings::Get ( 6243 );
 	if ( ! pFnPawnRevived )
-		pFnPawnRevived = (UFunction*) UObject::GObjObjects()->Data[ 108303 ];
+		return;
 
 	USFXEngagement_MobileAnnex_execPawnRevived_Parms PawnRevived_Parms;
 	PawnRevived_Parms.Pawn = Pawn;
@@ -236,10 +224,9 @@ void USFXEngagement_MobileAnnex::PawnRevived ( class ABioPawn* Pawn )
 
 void USFXEngagement_MobileAnnex::PawnDowned ( class ABioPawn* Pawn )
 {
-	static UFunction* pFnPawnDowned = NULL;
-
+	UFunction* pFnPawnDowned = (UFunction*) SdkBindings::Get ( 6242 );
 	if ( ! pFnPawnDowned )
-		pFnPawnDowned = (UFunction*) UObject::GObjObjects()->Data[ 108299 ];
+		return;
 
 	USFXEngagement_MobileAnnex_execPawnDowned_Parms PawnDowned_Parms;
 	PawnDowned_Parms.Pawn = Pawn;
@@ -253,10 +240,9 @@ void USFXEngagement_MobileAnnex::PawnDowned ( class ABioPawn* Pawn )
 
 void USFXEngagement_MobileAnnex::DetermineObjectivesToSpawn ( )
 {
-	static UFunction* pFnDetermineObjectivesToSpawn = NULL;
-
+	UFunction* pFnDetermineObjectivesToSpawn = (UFunction*) SdkBindings::Get ( 6241 );
 	if ( ! pFnDetermineObjectivesToSpawn )
-		pFnDetermineObjectivesToSpawn = (UFunction*) UObject::GObjObjects()->Data[ 108283 ];
+		return;
 
 	USFXEngagement_MobileAnnex_execDetermineObjectivesToSpawn_Parms DetermineObjectivesToSpawn_Parms;
 
@@ -271,10 +257,9 @@ void USFXEngagement_MobileAnnex::DetermineObjectivesToSpawn ( )
 
 float USFXEngagement_MobileAnnex::RateEnemyStart ( class ANavigationPoint* NavPoint )
 {
-	static UFunction* pFnRateEnemyStart = NULL;
-
+	UFunction* pFnRateEnemyStart = (UFunction*) SdkBindings::Get ( 6240 );
 	if ( ! pFnRateEnemyStart )
-		pFnRateEnemyStart = (UFunction*) UObject::GObjObjects()->Data[ 108269 ];
+		return {};
 
 	USFXEngagement_MobileAnnex_execRateEnemyStart_Parms RateEnemyStart_Parms;
 	RateEnemyStart_Parms.NavPoint = NavPoint;
@@ -290,10 +275,9 @@ float USFXEngagement_MobileAnnex::RateEnemyStart ( class ANavigationPoint* NavPo
 
 void USFXEngagement_MobileAnnex::DelayedFinishWave ( )
 {
-	static UFunction* pFnDelayedFinishWave = NULL;
-
+	UFunction* pFnDelayedFinishWave = (UFunction*) SdkBindings::Get ( 6239 );
 	if ( ! pFnDelayedFinishWave )
-		pFnDelayedFinishWave = (UFunction*) UObject::GObjObjects()->Data[ 108267 ];
+		return;
 
 	USFXEngagement_MobileAnnex_execDelayedFinishWave_Parms DelayedFinishWave_Parms;
 
@@ -306,10 +290,9 @@ void USFXEngagement_MobileAnnex::DelayedFinishWave ( )
 
 void USFXEngagement_MobileAnnex::FinishWave ( )
 {
-	static UFunction* pFnFinishWave = NULL;
-
+	UFunction* pFnFinishWave = (UFunction*) SdkBindings::Get ( 6238 );
 	if ( ! pFnFinishWave )
-		pFnFinishWave = (UFunction*) UObject::GObjObjects()->Data[ 108262 ];
+		return;
 
 	USFXEngagement_MobileAnnex_execFinishWave_Parms FinishWave_Parms;
 
@@ -322,10 +305,9 @@ void USFXEngagement_MobileAnnex::FinishWave ( )
 
 void USFXEngagement_MobileAnnex::ShowBeginWaveMessage ( )
 {
-	static UFunction* pFnShowBeginWaveMessage = NULL;
-
+	UFunction* pFnShowBeginWaveMessage = (UFunction*) SdkBindings::Get ( 6237 );
 	if ( ! pFnShowBeginWaveMessage )
-		pFnShowBeginWaveMessage = (UFunction*) UObject::GObjObjects()->Data[ 108260 ];
+		return;
 
 	USFXEngagement_MobileAnnex_execShowBeginWaveMessage_Parms ShowBeginWaveMessage_Parms;
 
@@ -339,10 +321,9 @@ void USFXEngagement_MobileAnnex::ShowBeginWaveMessage ( )
 
 bool USFXEngagement_MobileAnnex::BeginWave ( )
 {
-	static UFunction* pFnBeginWave = NULL;
-
+	UFunction* pFnBeginWave = (UFunction*) SdkBindings::Get ( 6236 );
 	if ( ! pFnBeginWave )
-		pFnBeginWave = (UFunction*) UObject::GObjObjects()->Data[ 108216 ];
+		return {};
 
 	USFXEngagement_MobileAnnex_execBeginWave_Parms BeginWave_Parms;
 
@@ -360,10 +341,9 @@ bool USFXEngagement_MobileAnnex::BeginWave ( )
 
 int USFXEngagement_MobileAnnex::ObjectiveSpawnSort ( class ASFXOperation_ObjectiveSpawnPoint* A, class ASFXOperation_ObjectiveSpawnPoint* B )
 {
-	static UFunction* pFnObjectiveSpawnSort = NULL;
-
+	UFunction* pFnObjectiveSpawnSort = (UFunction*) SdkBindings::Get ( 6235 );
 	if ( ! pFnObjectiveSpawnSort )
-		pFnObjectiveSpawnSort = (UFunction*) UObject::GObjObjects()->Data[ 108212 ];
+		return {};
 
 	USFXEngagement_MobileAnnex_execObjectiveSpawnSort_Parms ObjectiveSpawnSort_Parms;
 	ObjectiveSpawnSort_Parms.A = A;
@@ -381,10 +361,9 @@ int USFXEngagement_MobileAnnex::ObjectiveSpawnSort ( class ASFXOperation_Objecti
 
 void USFXEngagement_MobileAnnex::InitializeWave ( class ASFXWaveManager* OwnerManager )
 {
-	static UFunction* pFnInitializeWave = NULL;
-
+	UFunction* pFnInitializeWave = (UFunction*) SdkBindings::Get ( 6233 );
 	if ( ! pFnInitializeWave )
-		pFnInitializeWave = (UFunction*) UObject::GObjObjects()->Data[ 108207 ];
+		return;
 
 	USFXEngagement_MobileAnnex_execInitializeWave_Parms InitializeWave_Parms;
 	InitializeWave_Parms.OwnerManager = OwnerManager;
@@ -5447,22 +5447,13 @@ class UBioHardLinks : public UObject
 public:
 	TArray< struct FBioHardLinkReference >             References;                                       		// 0x003C (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1350 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1350 );
 	};
 
 };
 
-UClass* UBioHardLinks::pClassPointer = NULL;
-
 // Class SFXGame.BioHintSystemBase
 // 0x008C (0x00C8 - 0x003C)
 class UBioHintSystemBase : public UObject
@@ -5484,16 +5475,9 @@ public:
 	unsigned long                                      m_bDisabledForTutorial : 1;                       		// 0x00C4 (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned long                                      m_bNotificationIsPaused : 1;                      		// 0x00C4 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1351 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1351 );
 	};
 
 	void eventCacheCurrentState ( );
@@ -5533,8 +5517,6 @@ public:
 	void AddNotification ( struct FSFXNotification* oNotification );
 };
 
-UClass* UBioHintSystemBase::pClassPointer = NULL;
-
 // Class SFXGame.BioLevelUpSystem
 // 0x0004 (0x0040 - 0x003C)
 class UBioLevelUpSystem : public UObject
@@ -5542,16 +5524,9 @@ class UBioLevelUpSystem : public UObject
 public:
 	float                                              ME2ImportReputationAmount;                        		// 0x003C (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1352 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1352 );
 	};
 
 	int GetMaxLevel ( );
@@ -5566,8 +5541,6 @@ public:
 	bool AttemptLevelUp ( class ABioBaseSquad* Squad );
 };
 
-UClass* UBioLevelUpSystem::pClassPointer = NULL;
-
 // Class SFXGame.BioLoadingMovie
 // 0x0024 (0x0060 - 0x003C)
 class UBioLoadingMovie : public UObject
@@ -5581,22 +5554,13 @@ public:
 	class UWwiseEvent*                                 FadeOutWwiseEvent;                                		// 0x0058 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	float                                              MinPlayTime;                                      		// 0x005C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1353 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1353 );
 	};
 
 };
 
-UClass* UBioLoadingMovie::pClassPointer = NULL;
-
 // Class SFXGame.BioPhysicsSounds
 // 0x0014 (0x0050 - 0x003C)
 class UBioPhysicsSounds : public UObject
@@ -5608,16 +5572,9 @@ public:
 	float                                              m_fMinSpeedToPlay;                                		// 0x0048 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	unsigned long                                      m_bEnableLogging : 1;                             		// 0x004C (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1354 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1354 );
 	};
 
 	float GetSpeedSpecifier ( class UPrimitiveComponent* oComp, float fSpeedToUse );
@@ -5633,8 +5590,6 @@ public:
 	void eventPlaySoundOnPhysMatAt ( class AGameReplicationInfo* GRI, class UPhysicalMaterial* PhysMat, class UPhysicalMaterial* PhysMatSweetener, struct FVector pos, TArray< struct FString > RTPCNames, TArray< float > RTPCValues );
 };
 
-UClass* UBioPhysicsSounds::pClassPointer = NULL;
-
 // Class SFXGame.BioPlaypenVolume
 // 0x0014 (0x0240 - 0x022C)
 class ABioPlaypenVolume : public AVolume
@@ -5643,22 +5598,13 @@ public:
 	struct FGuid                                       PlaypenGuid;                                      		// 0x022C (0x0010) [0x0000000000220003]              ( CPF_Edit | CPF_Const | CPF_EditConst )
 	unsigned long                                      bSubtractive : 1;                                 		// 0x023C (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1355 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1355 );
 	};
 
 };
 
-UClass* ABioPlaypenVolume::pClassPointer = NULL;
-
 // Class SFXGame.BioPlotTreasure
 // 0x000C (0x0048 - 0x003C)
 class UBioPlotTreasure : public UObject
@@ -5668,16 +5614,9 @@ public:
 	class UBio2DA*                                     oPlotTreasureTreasure2DA;                         		// 0x0040 (0x0004) [0x0000000000000000]              
 	class UBio2DA*                                     oPlotTreasureTech2DA;                             		// 0x0044 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1356 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1356 );
 	};
 
 	bool GetMapName ( struct FString* sOutMapName );
@@ -5688,8 +5627,6 @@ public:
 	bool GetPlotTreasureResourcesInt ( struct FName nmLevel, struct FName nmHeader, int* nPlotTreasureValue );
 };
 
-UClass* UBioPlotTreasure::pClassPointer = NULL;
-
 // Class SFXGame.BioPower
 // 0x002C (0x0068 - 0x003C)
 class UBioPower : public UObject
@@ -5707,16 +5644,9 @@ public:
 	unsigned long                                      m_bDisableDamageAndEffects : 1;                   		// 0x0064 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 	unsigned long                                      m_bDisableAnimation : 1;                          		// 0x0064 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1357 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1357 );
 	};
 
 	bool ShouldDisplayInHUD ( );
@@ -5749,8 +5679,6 @@ public:
 	float GetCastingTime ( );
 };
 
-UClass* UBioPower::pClassPointer = NULL;
-
 // Class SFXGame.BioPowerManager
 // 0x004C (0x0088 - 0x003C)
 class UBioPowerManager : public UObject
@@ -5760,16 +5688,9 @@ public:
 	TArray< struct FPowerReservation >                 m_aReservations;                                  		// 0x0078 (0x000C) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 	int                                                m_nCurrentReservationID;                          		// 0x0084 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1358 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1358 );
 	};
 
 	bool eventCanImpactActor ( class AActor* oActor );
@@ -5788,8 +5709,6 @@ public:
 	void GetStartLocationForLOSCheck ( class APawn* Caster, struct FVector* vStartLocation );
 };
 
-UClass* UBioPowerManager::pClassPointer = NULL;
-
 // Class SFXGame.BioPowerScript
 // 0x0080 (0x00BC - 0x003C)
 class UBioPowerScript : public UObject
@@ -5818,16 +5737,9 @@ public:
 	unsigned long                                      bShouldTick : 1;                                  		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned long                                      m_bPlayerOrderedPowerUse : 1;                     		// 0x00B8 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1359 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1359 );
 	};
 
 	void DebugDraw_Power ( class ABioHUD* H );
@@ -5857,8 +5769,6 @@ public:
 	void eventInitializePowerScript ( );
 };
 
-UClass* UBioPowerScript::pClassPointer = NULL;
-
 // Class SFXGame.BioRadarMapBoundaries
 // 0x000E (0x0204 - 0x01F6)
 class ABioRadarMapBoundaries : public AActor
@@ -5866,22 +5776,13 @@ class ABioRadarMapBoundaries : public AActor
 public:
 	struct FVector                                     m_vBoundarySize;                                  		// 0x01F8 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1360 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1360 );
 	};
 
 };
 
-UClass* ABioRadarMapBoundaries::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_GiveMissionXP_NativeBase
 // 0x0014 (0x00C4 - 0x00B0)
 class UBioSeqAct_GiveMissionXP_NativeBase : public USequenceAction
@@ -5893,24 +5794,15 @@ public:
 	unsigned long                                      bSkipNotifications : 1;                           		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bCombatExperience : 1;                            		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1361 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1361 );
 	};
 
 	int eventGetObjClassVersion ( );
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_GiveMissionXP_NativeBase::pClassPointer = NULL;
-
 // Class SFXGame.BioSFResources
 // 0x0024 (0x0060 - 0x003C)
 class UBioSFResources : public UObject
@@ -5920,22 +5812,13 @@ public:
 	TArray< class UBioSFScreenTip* >                   LoadScreenTips;                                   		// 0x0048 (0x000C) [0x000000000440000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 	TArray< class UGFxMovieInfo* >                     Movies;                                           		// 0x0054 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1362 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1362 );
 	};
 
 };
 
-UClass* UBioSFResources::pClassPointer = NULL;
-
 // Class SFXGame.BioSocketSupermodel
 // 0x000C (0x0374 - 0x0368)
 class UBioSocketSupermodel : public USkeletalMesh
@@ -5943,22 +5826,13 @@ class UBioSocketSupermodel : public USkeletalMesh
 public:
 	TArray< class USkeletalMesh* >                     Dependents;                                       		// 0x0368 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1363 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1363 );
 	};
 
 };
 
-UClass* UBioSocketSupermodel::pClassPointer = NULL;
-
 // Class SFXGame.BioTacticalMoveToIndicator
 // 0x000E (0x0204 - 0x01F6)
 class ABioTacticalMoveToIndicator : public AActor
@@ -5968,22 +5842,13 @@ public:
 	float                                              m_fFadeInTime;                                    		// 0x01FC (0x0004) [0x0000000000000000]              
 	float                                              m_fTimePassed;                                    		// 0x0200 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1364 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1364 );
 	};
 
 };
 
-UClass* ABioTacticalMoveToIndicator::pClassPointer = NULL;
-
 // Class SFXGame.SFXAccomplishmentManager
 // 0x005C (0x0098 - 0x003C)
 class USFXAccomplishmentManager : public UObject
@@ -6003,16 +5868,9 @@ public:
 	unsigned long                                      bPendingSave : 1;                                 		// 0x0094 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 	unsigned long                                      bSaveRequired : 1;                                		// 0x0094 (0x0004) [0x0000000000002000] [0x00000010] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1365 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1365 );
 	};
 
 	void Destroyed ( );
@@ -6072,52 +5930,32 @@ public:
 	void eventInitialize ( );
 };
 
-UClass* USFXAccomplishmentManager::pClassPointer = NULL;
-
 // Class SFXGame.SFXActorFactoryRigidBody
 // 0x0000 (0x0095 - 0x0095)
 class USFXActorFactoryRigidBody : public UActorFactoryRigidBody
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1366 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1366 );
 	};
 
 };
 
-UClass* USFXActorFactoryRigidBody::pClassPointer = NULL;
-
 // Class SFXGame.BioActorFactoryPhysicsActor
 // 0x0000 (0x0095 - 0x0095)
 class UBioActorFactoryPhysicsActor : public USFXActorFactoryRigidBody
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1367 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1367 );
 	};
 
 };
 
-UClass* UBioActorFactoryPhysicsActor::pClassPointer = NULL;
-
 // Class SFXGame.SFXAnimationMarker
 // 0x0012 (0x0208 - 0x01F6)
 class ASFXAnimationMarker : public AActor
@@ -6126,22 +5964,13 @@ public:
 	struct FString                                     Text;                                             		// 0x01F8 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	class UStaticMeshComponent*                        ZoneMeshComp;                                     		// 0x0204 (0x0004) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1368 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1368 );
 	};
 
 };
 
-UClass* ASFXAnimationMarker::pClassPointer = NULL;
-
 // Class SFXGame.SFXArmourPiece
 // 0x007C (0x00B8 - 0x003C)
 class USFXArmourPiece : public UObject
@@ -6170,16 +5999,9 @@ public:
 	unsigned long                                      bNotifyOnHit : 1;                                 		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 	unsigned long                                      bPassThroughDamage : 1;                           		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1369 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1369 );
 	};
 
 	void UpdateMorphWeights ( class USkeletalMeshComponent* SkelMeshComp, float NewWeight );
@@ -6189,8 +6011,6 @@ public:
 	bool AttachToActor ( class AActor* oTarget );
 };
 
-UClass* USFXArmourPiece::pClassPointer = NULL;
-
 // Class SFXGame.SFXAsyncAssetLoader
 // 0x0028 (0x0064 - 0x003C)
 class USFXAsyncAssetLoader : public UObject
@@ -6201,16 +6021,9 @@ public:
 	TArray< struct FSFXAsyncLoadGroupCallback >        m_OnGroupLoadedCallbacks;                         		// 0x004C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	struct FScriptDelegate                             __OnAsyncGroupLoaded__Delegate;                   		// 0x0058 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1370 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1370 );
 	};
 
 	bool GetAssetsForGroup ( struct FName nmAsyncGroupTag, TArray< class UObject* >* oAssets );
@@ -6220,8 +6033,6 @@ public:
 	void OnAsyncGroupLoaded ( );
 };
 
-UClass* USFXAsyncAssetLoader::pClassPointer = NULL;
-
 // Class SFXGame.SFXCombatZone
 // 0x0010 (0x023C - 0x022C)
 class ASFXCombatZone : public AVolume
@@ -6229,22 +6040,13 @@ class ASFXCombatZone : public AVolume
 public:
 	struct FGuid                                       CombatZoneGuid;                                   		// 0x022C (0x0010) [0x0000000000220003]              ( CPF_Edit | CPF_Const | CPF_EditConst )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1371 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1371 );
 	};
 
 };
 
-UClass* ASFXCombatZone::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomReachSpec
 // 0x0006 (0x008C - 0x0086)
 class USFXCustomReachSpec : public UAdvancedReachSpec
@@ -6252,88 +6054,52 @@ class USFXCustomReachSpec : public UAdvancedReachSpec
 public:
 	class APawn*                                       BlockingPawn;                                     		// 0x0088 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1372 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1372 );
 	};
 
 };
 
-UClass* USFXCustomReachSpec::pClassPointer = NULL;
-
 // Class SFXGame.SFXBoostReachSpec
 // 0x0000 (0x008C - 0x008C)
 class USFXBoostReachSpec : public USFXCustomReachSpec
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1373 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1373 );
 	};
 
 };
 
-UClass* USFXBoostReachSpec::pClassPointer = NULL;
-
 // Class SFXGame.SFXClimbWallReachSpec
 // 0x0000 (0x008C - 0x008C)
 class USFXClimbWallReachSpec : public USFXCustomReachSpec
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1374 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1374 );
 	};
 
 };
 
-UClass* USFXClimbWallReachSpec::pClassPointer = NULL;
-
 // Class SFXGame.SFXJumpDownReachSpec
 // 0x0000 (0x008C - 0x008C)
 class USFXJumpDownReachSpec : public USFXCustomReachSpec
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1375 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1375 );
 	};
 
 };
 
-UClass* USFXJumpDownReachSpec::pClassPointer = NULL;
-
 // Class SFXGame.SFXJumpReachSpec
 // 0x0008 (0x0094 - 0x008C)
 class USFXJumpReachSpec : public USFXCustomReachSpec
@@ -6342,110 +6108,65 @@ public:
 	float                                              MaxHeight;                                        		// 0x008C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	float                                              MovePercentToReachMaxHeight;                      		// 0x0090 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1376 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1376 );
 	};
 
 };
 
-UClass* USFXJumpReachSpec::pClassPointer = NULL;
-
 // Class SFXGame.SFXLadderReachSpec
 // 0x0000 (0x008C - 0x008C)
 class USFXLadderReachSpec : public USFXCustomReachSpec
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1377 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1377 );
 	};
 
 };
 
-UClass* USFXLadderReachSpec::pClassPointer = NULL;
-
 // Class SFXGame.SFXLargeBoostReachSpec
 // 0x0000 (0x008C - 0x008C)
 class USFXLargeBoostReachSpec : public USFXCustomReachSpec
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1378 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1378 );
 	};
 
 };
 
-UClass* USFXLargeBoostReachSpec::pClassPointer = NULL;
-
 // Class SFXGame.SFXLargeClimbReachSpec
 // 0x0000 (0x008C - 0x008C)
 class USFXLargeClimbReachSpec : public USFXCustomReachSpec
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1379 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1379 );
 	};
 
 };
 
-UClass* USFXLargeClimbReachSpec::pClassPointer = NULL;
-
 // Class SFXGame.SFXLargeMantleReachSpec
 // 0x0000 (0x008C - 0x008C)
 class USFXLargeMantleReachSpec : public USFXCustomReachSpec
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1380 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1380 );
 	};
 
 };
 
-UClass* USFXLargeMantleReachSpec::pClassPointer = NULL;
-
 // Class SFXGame.SFXLeapReachSpecBase
 // 0x0004 (0x0090 - 0x008C)
 class USFXLeapReachSpecBase : public USFXCustomReachSpec
@@ -6453,66 +6174,39 @@ class USFXLeapReachSpecBase : public USFXCustomReachSpec
 public:
 	float                                              LeapHeight;                                       		// 0x008C (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1381 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1381 );
 	};
 
 };
 
-UClass* USFXLeapReachSpecBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXLeapReachSpecHumanoid
 // 0x0000 (0x0090 - 0x0090)
 class USFXLeapReachSpecHumanoid : public USFXLeapReachSpecBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1382 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1382 );
 	};
 
 };
 
-UClass* USFXLeapReachSpecHumanoid::pClassPointer = NULL;
-
 // Class SFXGame.SFXLeapReachSpecLarge
 // 0x0000 (0x0090 - 0x0090)
 class USFXLeapReachSpecLarge : public USFXLeapReachSpecBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1383 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1383 );
 	};
 
 };
 
-UClass* USFXLeapReachSpecLarge::pClassPointer = NULL;
-
 // Class SFXGame.SFXDamageType
 // 0x005A (0x00E2 - 0x0088)
 class USFXDamageType : public UDamageType
@@ -6558,16 +6252,9 @@ public:
 	unsigned char                                      FalloffType;                                      		// 0x00E0 (0x0001) [0x0000000000000000]              
 	unsigned char                                      WoundDamage;                                      		// 0x00E1 (0x0001) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1384 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1384 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -6575,24 +6262,15 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType::pClassPointer = NULL;
-
 // Class SFXGame.SFXDamageType_Suicide
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_Suicide : public USFXDamageType
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1385 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1385 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -6600,8 +6278,6 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_Suicide::pClassPointer = NULL;
-
 // Class SFXGame.SFXGRI
 // 0x0059 (0x02B1 - 0x0258)
 class ASFXGRI : public AGameReplicationInfo
@@ -6643,16 +6319,9 @@ public:
 	unsigned long                                      bForceOperationWave : 1;                          		// 0x02AC (0x0004) [0x0000000000000000] [0x00004000] 
 	unsigned char                                      MaxUniquePlayers;                                 		// 0x02B0 (0x0001) [0x0000000000002020]              ( CPF_Net | CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1386 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1386 );
 	};
 
 	float GetTeamScore ( );
@@ -6689,8 +6358,6 @@ public:
 	void DestroyLoadMovieAudio ( );
 };
 
-UClass* ASFXGRI::pClassPointer = NULL;
-
 // Class SFXGame.SFXDifficultyHandler
 // 0x008E (0x00CA - 0x003C)
 class USFXDifficultyHandler : public UObject
@@ -6724,16 +6391,9 @@ public:
 	unsigned char                                      CurrentDifficulty;                                		// 0x00C8 (0x0001) [0x0000000000000000]              
 	unsigned char                                      NormalizedDifficulty;                             		// 0x00C9 (0x0001) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1387 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1387 );
 	};
 
 	void UpdateDifficultyScore ( );
@@ -6747,8 +6407,6 @@ public:
 	class USFXDifficultyHandler* GetDifficultyHandler ( );
 };
 
-UClass* USFXDifficultyHandler::pClassPointer = NULL;
-
 // Class SFXGame.SFXDoorMarker
 // 0x000C (0x02D0 - 0x02C4)
 class ASFXDoorMarker : public ANavigationPoint
@@ -6763,16 +6421,9 @@ public:
 	unsigned long                                      bTempDisabledCollision : 1;                       		// 0x02CC (0x0004) [0x0000000000002002] [0x00000010] ( CPF_Const | CPF_Transient )
 	unsigned long                                      bPrevBlockedState : 1;                            		// 0x02CC (0x0004) [0x0000000000002002] [0x00000020] ( CPF_Const | CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1388 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1388 );
 	};
 
 	bool eventSuggestMovePreparation ( class APawn* Other );
@@ -6786,8 +6437,6 @@ public:
 	int UnblockDoorMarker ( );
 };
 
-UClass* ASFXDoorMarker::pClassPointer = NULL;
-
 // Class SFXGame.SFXDummyWeaponFireActor
 // 0x0012 (0x0208 - 0x01F6)
 class ASFXDummyWeaponFireActor : public AActor
@@ -6798,16 +6447,9 @@ public:
 	class AActor*                                      TargetActor;                                      		// 0x0200 (0x0004) [0x0000000000000020]              ( CPF_Net )
 	int                                                ShotCount;                                        		// 0x0204 (0x0004) [0x0000000000000020]              ( CPF_Net )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1389 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1389 );
 	};
 
 	void eventNotifyShotFired ( class AActor* InOriginActor, class AActor* InTargetActor );
@@ -6816,8 +6458,6 @@ public:
 	void eventReplicatedEvent ( struct FName VarName );
 };
 
-UClass* ASFXDummyWeaponFireActor::pClassPointer = NULL;
-
 // Class SFXGame.SFXDuringAsyncWorkTicker
 // 0x0046 (0x023C - 0x01F6)
 class ASFXDuringAsyncWorkTicker : public AActor
@@ -6841,16 +6481,9 @@ public:
 	unsigned long                                      bNoTracerCull : 1;                                		// 0x0238 (0x0004) [0x0000000000000000] [0x00000080] 
 	unsigned long                                      bNoEffectCull : 1;                                		// 0x0238 (0x0004) [0x0000000000000000] [0x00000100] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1390 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1390 );
 	};
 
 	void eventSetEffectLifetime ( class AEmitter* Emit, float Lifetime );
@@ -6862,8 +6495,6 @@ public:
 	void SpawnImpactEffect ( class AActor* inInstigator, class UParticleSystem* Effect, float ImpactScale, struct FImpactInfo* Impact );
 };
 
-UClass* ASFXDuringAsyncWorkTicker::pClassPointer = NULL;
-
 // Class SFXGame.SFXEngine
 // 0x0309 (0x0A52 - 0x0749)
 class USFXEngine : public UGameEngine
@@ -6961,16 +6592,9 @@ public:
 	unsigned char                                      PendingModeToRemove;                              		// 0x0A50 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 	unsigned char                                      eNetworkErrorStatus;                              		// 0x0A51 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1391 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1391 );
 	};
 
 	void HandleAFKTimeout ( );
@@ -7105,8 +6729,6 @@ public:
 	int GetLocalPlayerControllerId ( );
 };
 
-UClass* USFXEngine::pClassPointer = NULL;
-
 // Class SFXGame.SFXGalaxyMapObject
 // 0x0073 (0x00AF - 0x003C)
 class USFXGalaxyMapObject : public UObject
@@ -7140,16 +6762,9 @@ public:
 	unsigned char                                      UsableConditionalName;                            		// 0x00AD (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      MapObjectLevel;                                   		// 0x00AE (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1392 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1392 );
 	};
 
 	int EncodeWorldID ( int nCluster, int nSystem, int nPlanet );
@@ -7195,8 +6810,6 @@ public:
 	class USFXGalaxyMapObject* CreateChild ( class UClass* childClass );
 };
 
-UClass* USFXGalaxyMapObject::pClassPointer = NULL;
-
 // Class SFXGame.SFXCluster
 // 0x0051 (0x0100 - 0x00AF)
 class USFXCluster : public USFXGalaxyMapObject
@@ -7213,16 +6826,9 @@ public:
 	float                                              SphereSize;                                       		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      ExploredCluster : 1;                              		// 0x00FC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1393 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1393 );
 	};
 
 	void CountObjectsForExploration ( unsigned char eMapLevel, int* nObjectCount, int* nExploredCount );
@@ -7233,8 +6839,6 @@ public:
 	void eventAddChild ( class USFXGalaxyMapObject* oChild );
 };
 
-UClass* USFXCluster::pClassPointer = NULL;
-
 // Class SFXGame.SFXGalaxy
 // 0x0011 (0x00C0 - 0x00AF)
 class USFXGalaxy : public USFXGalaxyMapObject
@@ -7243,16 +6847,9 @@ public:
 	TArray< class USFXCluster* >                       Clusters;                                         		// 0x00B0 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	float                                              m_fGalaxyRadius;                                  		// 0x00BC (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1394 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1394 );
 	};
 
 	float GetLevelSize ( );
@@ -7261,8 +6858,6 @@ public:
 	void eventAddChild ( class USFXGalaxyMapObject* oChild );
 };
 
-UClass* USFXGalaxy::pClassPointer = NULL;
-
 // Class SFXGame.SFXPlanetFeature
 // 0x0051 (0x0100 - 0x00AF)
 class USFXPlanetFeature : public USFXGalaxyMapObject
@@ -7287,16 +6882,9 @@ public:
 	unsigned char                                      FeatureTransitionPlot;                            		// 0x00FE (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      FeatureTransitionName;                            		// 0x00FF (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1395 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1395 );
 	};
 
 	bool IsProbeable ( );
@@ -7311,8 +6899,6 @@ public:
 	void eventPerformTransition ( );
 };
 
-UClass* USFXPlanetFeature::pClassPointer = NULL;
-
 // Class SFXGame.SFXSystem
 // 0x0068 (0x0117 - 0x00AF)
 class USFXSystem : public USFXGalaxyMapObject
@@ -7338,16 +6924,9 @@ public:
 	unsigned char                                      ReaperControlConditionPlot;                       		// 0x0115 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      ReaperControlConditionName;                       		// 0x0116 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1396 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1396 );
 	};
 
 	void SystemObjectScanned ( class USFXSystemLevelObject* oSrc );
@@ -7384,8 +6963,6 @@ public:
 	void LoadSaveData ( );
 };
 
-UClass* USFXSystem::pClassPointer = NULL;
-
 // Class SFXGame.SFXSystemLevelObject
 // 0x0021 (0x00D0 - 0x00AF)
 class USFXSystemLevelObject : public USFXGalaxyMapObject
@@ -7401,16 +6978,9 @@ public:
 	unsigned long                                      IsActualPlanet : 1;                               		// 0x00CC (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned long                                      m_bShowAsScanned : 1;                             		// 0x00CC (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1397 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1397 );
 	};
 
 	bool HasBeenSystemScanned ( );
@@ -7426,8 +6996,6 @@ public:
 	void SpawnSystemScanMarker ( unsigned long bPlaySound );
 };
 
-UClass* USFXSystemLevelObject::pClassPointer = NULL;
-
 // Class SFXGame.BioPlanet
 // 0x0104 (0x01D4 - 0x00D0)
 class UBioPlanet : public USFXSystemLevelObject
@@ -7494,16 +7062,9 @@ public:
 	unsigned char                                      PlanetPlotLabelConditionPlot;                     		// 0x01D2 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      PlanetPlotLabelConditionName;                     		// 0x01D3 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1398 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1398 );
 	};
 
 	void CountObjectsForExploration ( unsigned char eMapLevel, int* nObjectCount, int* nExploredCount );
@@ -7544,8 +7105,6 @@ public:
 	bool IsVisited ( );
 };
 
-UClass* UBioPlanet::pClassPointer = NULL;
-
 // Class SFXGame.SFXGalaxyMapObjectAppearanceBase
 // 0x0038 (0x0074 - 0x003C)
 class USFXGalaxyMapObjectAppearanceBase : public UObject
@@ -7560,16 +7119,9 @@ public:
 	float                                              m_fAccumulatedRotationTime;                       		// 0x006C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned long                                      NoAppearance : 1;                                 		// 0x0070 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1399 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1399 );
 	};
 
 	void Tick ( class UBioCameraBehaviorGalaxy* pGalaxy, float fDeltaT );
@@ -7577,8 +7129,6 @@ public:
 	void OnObjectSpawned ( class AActor* oObjectActor, class UBioCameraBehaviorGalaxy* pGalaxy );
 };
 
-UClass* USFXGalaxyMapObjectAppearanceBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXGame
 // 0x02C0 (0x0650 - 0x0390)
 class ASFXGame : public AGameInfo
@@ -7656,16 +7206,9 @@ public:
 	unsigned long                                      bShowSquadScreenMessageBoxes : 1;                 		// 0x064C (0x0004) [0x0000000000002000] [0x00000010] ( CPF_Transient )
 	unsigned long                                      bPerfProto : 1;                                   		// 0x064C (0x0004) [0x0000000000004000] [0x00000020] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1400 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1400 );
 	};
 
 	void SetMipFadingValue ( float fNewMipValue );
@@ -7749,8 +7292,6 @@ public:
 	void OnJoinInProgress ( );
 };
 
-UClass* ASFXGame::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameEffect
 // 0x0026 (0x0062 - 0x003C)
 class USFXGameEffect : public UObject
@@ -7768,16 +7309,9 @@ public:
 	unsigned char                                      DurationType;                                     		// 0x0060 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      BonusFormula;                                     		// 0x0061 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1401 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1401 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -7793,8 +7327,6 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect::pClassPointer = NULL;
-
 // Class SFXGame.BioPlayerController
 // 0x0519 (0x0AFB - 0x05E2)
 class ABioPlayerController : public APlayerController
@@ -7989,16 +7521,9 @@ public:
 	unsigned char                                      bMine;                                            		// 0x0AF9 (0x0001) [0x0000000000000004]              ( CPF_Input )
 	unsigned char                                      m_eCurrentActionIcon;                             		// 0x0AFA (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1402 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1402 );
 	};
 
 	void SetCurrentChallengeReward ( int nRewardIndex );
@@ -8269,8 +7794,6 @@ public:
 	void OnResumeGameComplete ( unsigned long bWasSuccessful );
 };
 
-UClass* ABioPlayerController::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeBase
 // 0x0061 (0x009D - 0x003C)
 class USFXGameModeBase : public UObject
@@ -8315,16 +7838,9 @@ public:
 	unsigned long                                      bAllowPowerWeaponUI : 1;                          		// 0x0098 (0x0004) [0x0000000000000003] [0x80000000] ( CPF_Edit | CPF_Const )
 	unsigned char                                      Priority;                                         		// 0x009C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1403 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1403 );
 	};
 
 	bool ShowAreaMap ( );
@@ -8365,8 +7881,6 @@ public:
 	class USFXCameraMode* GetCameraMode ( class USFXCameraMode* OldCameraMode, int* PreserveTarget, float* TransitionTime, class USFXCameraMode_Interpolate** Transition );
 };
 
-UClass* USFXGameModeBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeGalaxy
 // 0x000F (0x00AC - 0x009D)
 class USFXGameModeGalaxy : public USFXGameModeBase
@@ -8376,16 +7890,9 @@ public:
 	class UBioCameraBehaviorGalaxy*                    GalaxyCam;                                        		// 0x00A4 (0x0004) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 	class USFXCameraTransition_GalaxyMap*              InstantTransition;                                		// 0x00A8 (0x0004) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1404 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1404 );
 	};
 
 	void ScanSystem ( );
@@ -8403,8 +7910,6 @@ public:
 	void Initialize ( );
 };
 
-UClass* USFXGameModeGalaxy::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeMultiLand
 // 0x0078 (0x0124 - 0x00AC)
 class USFXGameModeMultiLand : public USFXGameModeGalaxy
@@ -8432,16 +7937,9 @@ public:
 	unsigned long                                      bInitialized : 1;                                 		// 0x0120 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 	unsigned long                                      bRescaling : 1;                                   		// 0x0120 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1405 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1405 );
 	};
 
 	void UpdateLabelPositions ( );
@@ -8463,8 +7961,6 @@ public:
 	class UBioSeqAct_MultiLand* GetGameData ( );
 };
 
-UClass* USFXGameModeMultiLand::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeManager
 // 0x0035 (0x0071 - 0x003C)
 class USFXGameModeManager : public UObject
@@ -8477,16 +7973,9 @@ public:
 	unsigned long                                      bDisableInput : 1;                                		// 0x006C (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned char                                      CurrentMode;                                      		// 0x0070 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1406 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1406 );
 	};
 
 	struct FString GetLocalizedNameForKey ( struct FName Key, unsigned long Control, unsigned long Shift, unsigned long Alt );
@@ -8548,8 +8037,6 @@ public:
 	unsigned char eventGetDefaultMode ( );
 };
 
-UClass* USFXGameModeManager::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIInputHandler
 // 0x0033 (0x006F - 0x003C)
 class USFXGUIInputHandler : public UObject
@@ -8566,23 +8053,14 @@ public:
 	unsigned char                                      m_nLStickX;                                       		// 0x006D (0x0001) [0x0000000000000000]              
 	unsigned char                                      m_nLStickY;                                       		// 0x006E (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1407 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1407 );
 	};
 
 	void AddCooldown ( unsigned char nEvent, float fTime );
 };
 
-UClass* USFXGUIInputHandler::pClassPointer = NULL;
-
 // Class SFXGame.SFXInventoryManager
 // 0x00F8 (0x030C - 0x0214)
 class ASFXInventoryManager : public AInventoryManager
@@ -8637,16 +8115,9 @@ public:
 	unsigned long                                      bFlashlightAttached : 1;                          		// 0x0308 (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned long                                      bCanPickUpGrenades : 1;                           		// 0x0308 (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1408 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1408 );
 	};
 
 	void NextWeapon ( );
@@ -8700,8 +8171,6 @@ public:
 	void eventPostBeginPlay ( );
 };
 
-UClass* ASFXInventoryManager::pClassPointer = NULL;
-
 // Class SFXGame.SFXLoadMovieManager
 // 0x0095 (0x00D1 - 0x003C)
 class USFXLoadMovieManager : public UObject
@@ -8731,16 +8200,9 @@ public:
 	unsigned long                                      bStreamFromDisc : 1;                              		// 0x00CC (0x0004) [0x0000000000000000] [0x00000010] 
 	unsigned char                                      PlaybackState;                                    		// 0x00D0 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1409 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1409 );
 	};
 
 	void RegisterDelegate ( unsigned char TriggerState, struct FScriptDelegate InDelegate );
@@ -8756,8 +8218,6 @@ public:
 	void ResetToDefaultLoadMovie ( );
 };
 
-UClass* USFXLoadMovieManager::pClassPointer = NULL;
-
 // Class SFXGame.SFXLoadoutData
 // 0x0048 (0x0084 - 0x003C)
 class USFXLoadoutData : public UObject
@@ -8771,22 +8231,13 @@ public:
 	struct FVector2D                                   WeaponLevelRange;                                 		// 0x0078 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 	float                                              ShieldScale;                                      		// 0x0080 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1410 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1410 );
 	};
 
 };
 
-UClass* USFXLoadoutData::pClassPointer = NULL;
-
 // Class SFXGame.SFXPlayerSquadLoadoutData
 // 0x00AC (0x0130 - 0x0084)
 class USFXPlayerSquadLoadoutData : public USFXLoadoutData
@@ -8808,16 +8259,9 @@ public:
 	TArray< struct FSpecialWeaponInfo >                HenchmenSpecialWeapons;                           		// 0x0120 (0x000C) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 	int                                                MaxWeapons;                                       		// 0x012C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1411 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1411 );
 	};
 
 	void SetWeaponLoadoutFlag ( struct FName nmWeaponClassPath, unsigned char eFlag );
@@ -8842,8 +8286,6 @@ public:
 	TArray< struct FLoadoutWeaponInfo > GetWeaponGroup ( int idx );
 };
 
-UClass* USFXPlayerSquadLoadoutData::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_Armour
 // 0x0060 (0x00A8 - 0x0048)
 class USFXModule_Armour : public USFXModule
@@ -8852,16 +8294,9 @@ public:
 	class USFXArmourPiece*                             ActiveArmour[ 0xC ];                              		// 0x0048 (0x0030) [0x0000000000000001]              ( CPF_Edit )
 	int                                                ReplicatedArmourStates[ 0xC ];                    		// 0x0078 (0x0030) [0x0000000000000020]              ( CPF_Net )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1412 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1412 );
 	};
 
 	class USFXArmourPiece* GetArmourPieceByName ( struct FName ArmourName );
@@ -8886,8 +8321,6 @@ public:
 	void eventReplicatedEvent ( struct FName VarName );
 };
 
-UClass* USFXModule_Armour::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_Audio
 // 0x0024 (0x006C - 0x0048)
 class USFXModule_Audio : public USFXModule
@@ -8901,16 +8334,9 @@ public:
 	float                                              RunThreshold;                                     		// 0x0064 (0x0004) [0x0000000000044000]              ( CPF_Config | CPF_GlobalConfig )
 	unsigned long                                      bPlayFootstepSounds : 1;                          		// 0x0068 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1413 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1413 );
 	};
 
 	void SFXSetAudioComponentRTPCs ( class UActorComponent* pWwiseAudioComponent );
@@ -8920,8 +8346,6 @@ public:
 	class AActor* PlayFootStepSound ( int FootDown, struct FTraceHitInfo* HitInfo );
 };
 
-UClass* USFXModule_Audio::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_Conversation
 // 0x003C (0x0084 - 0x0048)
 class USFXModule_Conversation : public USFXModule
@@ -8938,23 +8362,14 @@ public:
 	unsigned long                                      m_bDisableFacefx : 1;                             		// 0x0080 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      m_bInConversation : 1;                            		// 0x0080 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1414 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1414 );
 	};
 
 	bool ScriptIsInConversation ( class AActor* pActor );
 };
 
-UClass* USFXModule_Conversation::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_DamageNativeBase
 // 0x0039 (0x0081 - 0x0048)
 class USFXModule_DamageNativeBase : public USFXModule_DamageBase
@@ -8968,16 +8383,9 @@ public:
 	float                                              LastHealthPct;                                    		// 0x007C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned char                                      ReplicatedHealth;                                 		// 0x0080 (0x0001) [0x0000000000002020]              ( CPF_Net | CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1415 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1415 );
 	};
 
 	struct FScaledFloat GetMaxHealthStats ( );
@@ -8992,8 +8400,6 @@ public:
 	void eventReplicatedEvent ( struct FName VarName );
 };
 
-UClass* USFXModule_DamageNativeBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_GameEffectManager_NativeBase
 // 0x0010 (0x0058 - 0x0048)
 class USFXModule_GameEffectManager_NativeBase : public USFXModule
@@ -9002,16 +8408,9 @@ public:
 	TArray< class USFXGameEffect* >                    GameEffects;                                      		// 0x0048 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	unsigned long                                      EffectListLocked : 1;                             		// 0x0054 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1416 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1416 );
 	};
 
 	void eventHandlePreRemove ( );
@@ -9019,8 +8418,6 @@ public:
 	void Tick ( float DeltaSeconds );
 };
 
-UClass* USFXModule_GameEffectManager_NativeBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_Locomotion
 // 0x0085 (0x00CD - 0x0048)
 class USFXModule_Locomotion : public USFXModule
@@ -9054,16 +8451,9 @@ public:
 	unsigned long                                      MoveStartStopping : 1;                            		// 0x00C8 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned char                                      CurrentState;                                     		// 0x00CC (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1417 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1417 );
 	};
 
 	void eventHandlePostBeginPlay ( );
@@ -9071,8 +8461,6 @@ public:
 	void SetDesiredRotation ( struct FRotator DesiredRotation );
 };
 
-UClass* USFXModule_Locomotion::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_LookAt
 // 0x0038 (0x0080 - 0x0048)
 class USFXModule_LookAt : public USFXModule
@@ -9094,16 +8482,9 @@ public:
 	unsigned long                                      bEnableLookAtTargeting : 1;                       		// 0x007C (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 	unsigned long                                      bAutoLookAtPlayer : 1;                            		// 0x007C (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1418 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1418 );
 	};
 
 	void ChangeTarget ( class AActor* Target, unsigned char a_eTransition, int nRank );
@@ -9112,8 +8493,6 @@ public:
 	void eventHandlePostBeginPlay ( );
 };
 
-UClass* USFXModule_LookAt::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_Marker
 // 0x0034 (0x007C - 0x0048)
 class USFXModule_Marker : public USFXModule
@@ -9128,16 +8507,9 @@ public:
 	class APawn*                                       PawnWithExclusiveInvisibility;                    		// 0x0074 (0x0004) [0x0000000000000020]              ( CPF_Net )
 	unsigned long                                      bActive : 1;                                      		// 0x0078 (0x0004) [0x0000000000000020] [0x00000001] ( CPF_Net )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1419 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1419 );
 	};
 
 	void DeferredHandlePostAdd ( );
@@ -9150,8 +8522,6 @@ public:
 	void eventHandlePostAdd ( );
 };
 
-UClass* USFXModule_Marker::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_MarkerObjective
 // 0x0001 (0x007D - 0x007C)
 class USFXModule_MarkerObjective : public USFXModule_Marker
@@ -9159,22 +8529,13 @@ class USFXModule_MarkerObjective : public USFXModule_Marker
 public:
 	unsigned char                                      MarkerIconType;                                   		// 0x007C (0x0001) [0x0000000000000021]              ( CPF_Edit | CPF_Net )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1420 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1420 );
 	};
 
 };
 
-UClass* USFXModule_MarkerObjective::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_MarkerPlayer
 // 0x0004 (0x0080 - 0x007C)
 class USFXModule_MarkerPlayer : public USFXModule_Marker
@@ -9183,24 +8544,15 @@ public:
 	unsigned long                                      PlayerIsDown : 1;                                 		// 0x007C (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      PlayerIsDead : 1;                                 		// 0x007C (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1421 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1421 );
 	};
 
 	void UpdatePlayerDownState ( unsigned long NewPlayerIsDown );
 	void eventHandlePostAdd ( );
 };
 
-UClass* USFXModule_MarkerPlayer::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_Radar
 // 0x0005 (0x004D - 0x0048)
 class USFXModule_Radar : public USFXModule
@@ -9209,23 +8561,14 @@ public:
 	unsigned long                                      bRadarDisabled : 1;                               		// 0x0048 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned char                                      RadarType;                                        		// 0x004C (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1422 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1422 );
 	};
 
 	void eventHandlePostBeginPlay ( );
 };
 
-UClass* USFXModule_Radar::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_Wound
 // 0x0018 (0x0060 - 0x0048)
 class USFXModule_Wound : public USFXModule
@@ -9234,16 +8577,9 @@ public:
 	TArray< struct FBioWoundSpec >                     m_aWoundSpecs;                                    		// 0x0048 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	TArray< struct FBioWoundSpec >                     m_aWounds;                                        		// 0x0054 (0x000C) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1423 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1423 );
 	};
 
 	bool CanSupportAnotherWound ( );
@@ -9252,8 +8588,6 @@ public:
 	void CreateWound ( int WoundIdx );
 };
 
-UClass* USFXModule_Wound::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_Wrinkles
 // 0x0020 (0x0068 - 0x0048)
 class USFXModule_Wrinkles : public USFXModule
@@ -9264,24 +8598,15 @@ public:
 	int                                                m_nWrinkleHighestLOD;                             		// 0x0060 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	unsigned long                                      bUseWrinkles : 1;                                 		// 0x0064 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1424 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1424 );
 	};
 
 	void Tick ( float DeltaTime );
 	void Tick_Wrinkle ( float DeltaTime );
 };
 
-UClass* USFXModule_Wrinkles::pClassPointer = NULL;
-
 // Class SFXGame.sfxmpcharacterrecord
 // 0x0078 (0x00B4 - 0x003C)
 class Usfxmpcharacterrecord : public UObject
@@ -9308,16 +8633,9 @@ public:
 	unsigned long                                      LeveledUp : 1;                                    		// 0x00B0 (0x0004) [0x0000000000000000] [0x00000004] 
 	unsigned long                                      bSerializedFromBlaze : 1;                         		// 0x00B0 (0x0004) [0x0000000000000000] [0x00000008] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1425 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1425 );
 	};
 
 	bool IsInitialized ( );
@@ -9342,8 +8660,6 @@ public:
 	void RecalculateTalentPoints ( );
 };
 
-UClass* Usfxmpcharacterrecord::pClassPointer = NULL;
-
 // Class SFXGame.sfxmpclassrecord
 // 0x0020 (0x005C - 0x003C)
 class Usfxmpclassrecord : public UObject
@@ -9355,16 +8671,9 @@ public:
 	float                                              XPOffset;                                         		// 0x0054 (0x0004) [0x0000000000000000]              
 	int                                                NumPromotions;                                    		// 0x0058 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1426 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1426 );
 	};
 
 	bool HasAnyDeployedCharacters ( );
@@ -9376,8 +8685,6 @@ public:
 	float GetTotalXP ( );
 };
 
-UClass* Usfxmpclassrecord::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_BlockingPathNode
 // 0x0008 (0x02CC - 0x02C4)
 class ASFXNav_BlockingPathNode : public APathNode
@@ -9386,24 +8693,15 @@ public:
 	class ABlockingVolume*                             PathBlockingVolume;                               		// 0x02C4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bRemovedFromInclusionaryList : 1;                 		// 0x02C8 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1427 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1427 );
 	};
 
 	void EndPathMove ( class AActor* Mover );
 	void StartPathMove ( class AActor* Mover );
 };
 
-UClass* ASFXNav_BlockingPathNode::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_BoostNode
 // 0x0010 (0x02DC - 0x02CC)
 class ASFXNav_BoostNode : public ASFXNav_BlockingPathNode
@@ -9414,22 +8712,13 @@ public:
 	float                                              BoostDistZ;                                       		// 0x02D4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bTopNode : 1;                                     		// 0x02D8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1428 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1428 );
 	};
 
 };
 
-UClass* ASFXNav_BoostNode::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_ClimbWallNode
 // 0x0004 (0x02D0 - 0x02CC)
 class ASFXNav_ClimbWallNode : public ASFXNav_BlockingPathNode
@@ -9437,22 +8726,13 @@ class ASFXNav_ClimbWallNode : public ASFXNav_BlockingPathNode
 public:
 	class ANavigationPoint*                            ClimbDest;                                        		// 0x02CC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1429 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1429 );
 	};
 
 };
 
-UClass* ASFXNav_ClimbWallNode::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_JumpDownNode
 // 0x0014 (0x02E0 - 0x02CC)
 class ASFXNav_JumpDownNode : public ASFXNav_BlockingPathNode
@@ -9464,22 +8744,13 @@ public:
 	float                                              JumpDownDistZ;                                    		// 0x02D8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bTopNode : 1;                                     		// 0x02DC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1430 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1430 );
 	};
 
 };
 
-UClass* ASFXNav_JumpDownNode::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_JumpNode
 // 0x0020 (0x02EC - 0x02CC)
 class ASFXNav_JumpNode : public ASFXNav_BlockingPathNode
@@ -9490,22 +8761,13 @@ public:
 	class UCylinderComponent*                          TouchingCylinder;                                 		// 0x02E4 (0x0004) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 	float                                              JumpDist;                                         		// 0x02E8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1431 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1431 );
 	};
 
 };
 
-UClass* ASFXNav_JumpNode::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_LadderNode
 // 0x0014 (0x02E0 - 0x02CC)
 class ASFXNav_LadderNode : public ASFXNav_BlockingPathNode
@@ -9518,16 +8780,9 @@ public:
 	unsigned long                                      bTopNode : 1;                                     		// 0x02DC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bDisabled : 1;                                    		// 0x02DC (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1432 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1432 );
 	};
 
 	void StartLadderCustomAction ( class ABioPawn* User, int NewAction, class UReachSpec* LadderSpec );
@@ -9536,8 +8791,6 @@ public:
 	void PostBeginPlay ( );
 };
 
-UClass* ASFXNav_LadderNode::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_LargeBoostNode
 // 0x000C (0x02D8 - 0x02CC)
 class ASFXNav_LargeBoostNode : public ASFXNav_BlockingPathNode
@@ -9547,22 +8800,13 @@ public:
 	float                                              BoostDistX;                                       		// 0x02D0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	float                                              BoostDistZ;                                       		// 0x02D4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1433 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1433 );
 	};
 
 };
 
-UClass* ASFXNav_LargeBoostNode::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_LeapNodeBase
 // 0x0018 (0x02E4 - 0x02CC)
 class ASFXNav_LeapNodeBase : public ASFXNav_BlockingPathNode
@@ -9571,66 +8815,39 @@ public:
 	TArray< class ANavigationPoint* >                  LeapDest;                                         		// 0x02CC (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	struct FVector                                     LandingOffset;                                    		// 0x02D8 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1434 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1434 );
 	};
 
 };
 
-UClass* ASFXNav_LeapNodeBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_LeapNodeHumanoid
 // 0x0000 (0x02E4 - 0x02E4)
 class ASFXNav_LeapNodeHumanoid : public ASFXNav_LeapNodeBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1435 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1435 );
 	};
 
 };
 
-UClass* ASFXNav_LeapNodeHumanoid::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_LeapNodeLarge
 // 0x0000 (0x02E4 - 0x02E4)
 class ASFXNav_LeapNodeLarge : public ASFXNav_LeapNodeBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1436 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1436 );
 	};
 
 };
 
-UClass* ASFXNav_LeapNodeLarge::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_ForcedPathNode
 // 0x0008 (0x02CC - 0x02C4)
 class ASFXNav_ForcedPathNode : public ANavigationPoint
@@ -9639,22 +8856,13 @@ public:
 	float                                              m_fForcedRadius;                                  		// 0x02C4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	float                                              m_fForcedHeight;                                  		// 0x02C8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1437 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1437 );
 	};
 
 };
 
-UClass* ASFXNav_ForcedPathNode::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_GoalPoint
 // 0x000C (0x02D0 - 0x02C4)
 class ASFXNav_GoalPoint : public ANavigationPoint
@@ -9664,16 +8872,9 @@ public:
 	int                                                m_nOverridePriority;                              		// 0x02C8 (0x0004) [0x0000000000000000]              
 	unsigned long                                      m_bIsFinalGoal : 1;                               		// 0x02CC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1438 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1438 );
 	};
 
 	int GetPriority ( );
@@ -9681,8 +8882,6 @@ public:
 	void OverridePriority ( int nNewPriority );
 };
 
-UClass* ASFXNav_GoalPoint::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_LargeClimbNode
 // 0x0008 (0x02CC - 0x02C4)
 class ASFXNav_LargeClimbNode : public APathNode
@@ -9691,22 +8890,13 @@ public:
 	class ANavigationPoint*                            ClimbDest;                                        		// 0x02C4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bTopNode : 1;                                     		// 0x02C8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1439 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1439 );
 	};
 
 };
 
-UClass* ASFXNav_LargeClimbNode::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_LargeMantleNode
 // 0x0004 (0x02C8 - 0x02C4)
 class ASFXNav_LargeMantleNode : public APathNode
@@ -9714,38 +8904,22 @@ class ASFXNav_LargeMantleNode : public APathNode
 public:
 	class ANavigationPoint*                            MantleDest;                                       		// 0x02C4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1440 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1440 );
 	};
 
 };
 
-UClass* ASFXNav_LargeMantleNode::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_SpawnEntrance
 // 0x0000 (0x02C4 - 0x02C4)
 class ASFXNav_SpawnEntrance : public APathNode
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1441 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1441 );
 	};
 
 	struct FString eventGetDebugAbbrev ( );
@@ -9769,8 +8943,6 @@ public:
 	void GetBoundingCylinder ( float* CollisionRadius, float* CollisionHeight );
 };
 
-UClass* ASFXNav_SpawnEntrance::pClassPointer = NULL;
-
 // Class SFXGame.SFXNuiSpeech_Combat
 // 0x0014 (0x0050 - 0x003C)
 class USFXNuiSpeech_Combat : public UObject
@@ -9780,16 +8952,9 @@ public:
 	class AActor*                                      SelectionTarget;                                  		// 0x0048 (0x0004) [0x0000000000000000]              
 	class AActor*                                      Target;                                           		// 0x004C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1442 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1442 );
 	};
 
 	void* eventGetPlayerClassStringRef ( class ABioPawn* member );
@@ -9801,30 +8966,19 @@ public:
 	void* eventGetSWITCH_WEAPON_STRREF ( );
 };
 
-UClass* USFXNuiSpeech_Combat::pClassPointer = NULL;
-
 // Class SFXGame.SFXNuiSpeech_Explore
 // 0x0000 (0x003C - 0x003C)
 class USFXNuiSpeech_Explore : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1443 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1443 );
 	};
 
 };
 
-UClass* USFXNuiSpeech_Explore::pClassPointer = NULL;
-
 // Class SFXGame.SFXObjectiveDrawSpawnPointComponent
 // 0x001C (0x01E8 - 0x01CC)
 class USFXObjectiveDrawSpawnPointComponent : public UPrimitiveComponent
@@ -9833,22 +8987,13 @@ public:
 	TArray< struct FSFXObjectiveSpawnLocationSize >    SpawnLocationExtents;                             		// 0x01CC (0x000C) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 	struct FLinearColor                                LineColor;                                        		// 0x01D8 (0x0010) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1444 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1444 );
 	};
 
 };
 
-UClass* USFXObjectiveDrawSpawnPointComponent::pClassPointer = NULL;
-
 // Class SFXGame.SFXObjectPool
 // 0x00AA (0x02A0 - 0x01F6)
 class ASFXObjectPool : public AActor
@@ -9866,16 +9011,9 @@ public:
 	int                                                WwiseNextIdx;                                     		// 0x0298 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bDebugLogOnCleanup : 1;                           		// 0x029C (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1445 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1445 );
 	};
 
 	void CleanUpPools ( unsigned long bPreserveRunningEffects, unsigned long bClearAmmo, unsigned long bIsMultiplayerWaveEnd );
@@ -9906,8 +9044,6 @@ public:
 	void AttachParticleSystemComponent ( class UParticleSystemComponent* PSC, class AActor* HitActor, class UPrimitiveComponent* HitComponent, struct FName HitBone, struct FVector HitLocation, struct FVector HitNormal, unsigned long bStaticLocation );
 };
 
-UClass* ASFXObjectPool::pClassPointer = NULL;
-
 // Class SFXGame.SFXObjectSerializerMT
 // 0x0014 (0x0050 - 0x003C)
 class USFXObjectSerializerMT : public UObject
@@ -9915,22 +9051,13 @@ class USFXObjectSerializerMT : public UObject
 public:
 	unsigned char                                      UnknownData00[ 0x14 ];                            		// 0x003C (0x0014) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1446 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1446 );
 	};
 
 };
 
-UClass* USFXObjectSerializerMT::pClassPointer = NULL;
-
 // Class SFXGame.SFXOutlineGlowActorBase
 // 0x005A (0x0250 - 0x01F6)
 class ASFXOutlineGlowActorBase : public AActor
@@ -9949,22 +9076,13 @@ public:
 	float                                              LastDiedTime;                                     		// 0x0248 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned long                                      bSourceDied : 1;                                  		// 0x024C (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1447 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1447 );
 	};
 
 };
 
-UClass* ASFXOutlineGlowActorBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXOutlineGlowActorMP
 // 0x0034 (0x0284 - 0x0250)
 class ASFXOutlineGlowActorMP : public ASFXOutlineGlowActorBase
@@ -9975,22 +9093,13 @@ public:
 	struct FLinearColor                                EnemyColour;                                      		// 0x0270 (0x0010) [0x0000000000000002]              ( CPF_Const )
 	float                                              RenderDelay;                                      		// 0x0280 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1448 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1448 );
 	};
 
 };
 
-UClass* ASFXOutlineGlowActorMP::pClassPointer = NULL;
-
 // Class SFXGame.SFXOutlineGlowActorSP
 // 0x0020 (0x0270 - 0x0250)
 class ASFXOutlineGlowActorSP : public ASFXOutlineGlowActorBase
@@ -9999,22 +9108,13 @@ public:
 	struct FLinearColor                                EnemyColour;                                      		// 0x0250 (0x0010) [0x0000000000000002]              ( CPF_Const )
 	struct FLinearColor                                HenchmenColour;                                   		// 0x0260 (0x0010) [0x0000000000000002]              ( CPF_Const )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1449 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1449 );
 	};
 
 };
 
-UClass* ASFXOutlineGlowActorSP::pClassPointer = NULL;
-
 // Class SFXGame.SFXPathWeightLog
 // 0x0024 (0x0060 - 0x003C)
 class USFXPathWeightLog : public UObject
@@ -10023,24 +9123,15 @@ public:
 	struct FNavWeight                                  BestWeight;                                       		// 0x003C (0x0018) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 	TArray< struct FNavWeight >                        NavWeights;                                       		// 0x0054 (0x000C) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1450 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1450 );
 	};
 
 	void SetNavWeight ( int NavIndex, float Weight, int ConstraintIndex, unsigned long bRejected );
 	int AddNav ( class ANavigationPoint* Nav, int NumConstraints );
 };
 
-UClass* USFXPathWeightLog::pClassPointer = NULL;
-
 // Class SFXGame.SFXPickupFactory
 // 0x0008 (0x02E8 - 0x02E0)
 class ASFXPickupFactory : public APickupFactory
@@ -10049,16 +9140,9 @@ public:
 	class ULightEnvironmentComponent*                  LightEnvironment;                                 		// 0x02E0 (0x0004) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 	struct FLightingChannelContainer                   LightingChannels;                                 		// 0x02E4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1451 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1451 );
 	};
 
 	void PickedUpBy ( class APawn* P );
@@ -10071,24 +9155,15 @@ public:
 	void eventPostBeginPlay ( );
 };
 
-UClass* ASFXPickupFactory::pClassPointer = NULL;
-
 // Class SFXGame.SFXRpgPickupFactory
 // 0x0000 (0x02E8 - 0x02E8)
 class ASFXRpgPickupFactory : public ASFXPickupFactory
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1452 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1452 );
 	};
 
 	void PickedUpBy ( class APawn* P );
@@ -10101,8 +9176,6 @@ public:
 	void eventPostBeginPlay ( );
 };
 
-UClass* ASFXRpgPickupFactory::pClassPointer = NULL;
-
 // Class SFXGame.SFXWeaponModFactory
 // 0x0010 (0x02F8 - 0x02E8)
 class ASFXWeaponModFactory : public ASFXRpgPickupFactory
@@ -10113,16 +9186,9 @@ public:
 	float                                              UpdateFrequency;                                  		// 0x02F0 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bStopCustomTicking : 1;                           		// 0x02F4 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1453 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1453 );
 	};
 
 	class UPrimitiveComponent* GetPickupMesh ( );
@@ -10135,8 +9201,6 @@ public:
 	void InitializePickup ( );
 };
 
-UClass* ASFXWeaponModFactory::pClassPointer = NULL;
-
 // Class SFXGame.SFXWeaponFactory
 // 0x0038 (0x0320 - 0x02E8)
 class ASFXWeaponFactory : public ASFXPickupFactory
@@ -10158,16 +9222,9 @@ public:
 	unsigned long                                      ForceRespawn : 1;                                 		// 0x031C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bStopCustomTicking : 1;                           		// 0x031C (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1454 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1454 );
 	};
 
 	void Tick ( float DeltaTime );
@@ -10181,8 +9238,6 @@ public:
 	bool DelayRespawn ( );
 };
 
-UClass* ASFXWeaponFactory::pClassPointer = NULL;
-
 // Class SFXGame.SFXPlaceableBase
 // 0x0014 (0x0270 - 0x025C)
 class ASFXPlaceableBase : public AInterpActor
@@ -10192,16 +9247,9 @@ public:
 	unsigned long                                      bIsDeactivated : 1;                               		// 0x026C (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      bIsDestroyed : 1;                                 		// 0x026C (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1455 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1455 );
 	};
 
 	void GetDifficultyDebugStrings ( TArray< struct FString >* DifficultyDebugStrings );
@@ -10214,24 +9262,15 @@ public:
 	void eventPostBeginPlay ( );
 };
 
-UClass* ASFXPlaceableBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXPointOfInterest
 // 0x0000 (0x01F6 - 0x01F6)
 class ASFXPointOfInterest : public AActor
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1456 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1456 );
 	};
 
 	struct FVector LocalToWorld ( struct FVector vLocal );
@@ -10505,8 +9544,6 @@ public:
 	void ForceUpdateComponents ( unsigned long bCollisionUpdate, unsigned long bTransformOnly );
 };
 
-UClass* ASFXPointOfInterest::pClassPointer = NULL;
-
 // Class SFXGame.SFXPreAsyncWorkTicker
 // 0x0026 (0x021C - 0x01F6)
 class ASFXPreAsyncWorkTicker : public AActor
@@ -10516,16 +9553,9 @@ public:
 	TArray< struct FSFXPreAsyncWorkQueuedPowerImpact > QueuedPowerImpacts;                               		// 0x0204 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	struct FScriptDelegate                             __OnActorImpacted__Delegate;                      		// 0x0210 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1457 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1457 );
 	};
 
 	bool DoAreaExplosionForActor ( class USFXPowerCustomActionBase* Power, class AActor* Target, struct FVector ExplosionLocation, int ImpactCount, float Damage, class UClass* DamageType, float Force, int MaxRagdollOverride, unsigned long bReplicateCustomAction, struct FScriptDelegate ImpactCallback, class UClass* MaxRagdollDmgTypeOverride, struct FAreaEffectParameters* Params );
@@ -10534,8 +9564,6 @@ public:
 	void ProcessInstantHit ( class ASFXWeapon_NativeBase* Weapon, unsigned char FiringMode, unsigned long bSuppressAudio, int NumHits, struct FImpactInfo* Impact );
 };
 
-UClass* ASFXPreAsyncWorkTicker::pClassPointer = NULL;
-
 // Class SFXGame.SFXPRI_NativeBase
 // 0x000C (0x02BA - 0x02AE)
 class ASFXPRI_NativeBase : public APlayerReplicationInfo
@@ -10554,23 +9582,14 @@ public:
 	unsigned char                                      AutoLevelUp;                                      		// 0x02B8 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 	unsigned char                                      HenchmenHelmetPreference;                         		// 0x02B9 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1458 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1458 );
 	};
 
 	class APawn* eventGetAPawn ( );
 };
 
-UClass* ASFXPRI_NativeBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXProfileSettings
 // 0x0010 (0x009C - 0x008C)
 class USFXProfileSettings : public UOnlineProfileSettings
@@ -10579,16 +9598,9 @@ public:
 	TArray< struct FBonusPowerUnlockData >             BonusPowerUnlockDataArray;                        		// 0x008C (0x000C) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 	int                                                MinReadinessRating;                               		// 0x0098 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1459 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1459 );
 	};
 
 	void SetLanguageSpeech ( struct FString Language );
@@ -10683,8 +9695,6 @@ public:
 	bool GetControllerVibrationOption ( );
 };
 
-UClass* USFXProfileSettings::pClassPointer = NULL;
-
 // Class SFXGame.SFXReachSpecPlaceholderCylinder
 // 0x000E (0x0204 - 0x01F6)
 class ASFXReachSpecPlaceholderCylinder : public AActor
@@ -10692,22 +9702,13 @@ class ASFXReachSpecPlaceholderCylinder : public AActor
 public:
 	TArray< class APawn* >                             PawnsToIgnore;                                    		// 0x01F8 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1460 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1460 );
 	};
 
 };
 
-UClass* ASFXReachSpecPlaceholderCylinder::pClassPointer = NULL;
-
 // Class SFXGame.SFXSavedMove
 // 0x0026 (0x010D - 0x00E7)
 class USFXSavedMove : public USavedMove
@@ -10734,16 +9735,9 @@ public:
 	unsigned char                                      CoverDirection;                                   		// 0x010B (0x0001) [0x0000000000000000]              
 	unsigned char                                      CurrentSlotDirection;                             		// 0x010C (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1461 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1461 );
 	};
 
 	void CopyFrom ( class USFXSavedMove* PreviousMove );
@@ -10755,8 +9749,6 @@ public:
 	void Clear ( );
 };
 
-UClass* USFXSavedMove::pClassPointer = NULL;
-
 // Class SFXGame.SFXSaveGame
 // 0x0382 (0x03BE - 0x003C)
 class USFXSaveGame : public UObject
@@ -10798,16 +9790,9 @@ public:
 	unsigned char                                      Difficulty;                                       		// 0x03BC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      ConversationMode;                                 		// 0x03BD (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1462 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1462 );
 	};
 
 	bool HasME1PlotData ( );
@@ -10839,8 +9824,6 @@ public:
 	bool GetPlayerRecord ( struct FPlayerSaveRecord* Record );
 };
 
-UClass* USFXSaveGame::pClassPointer = NULL;
-
 // Class SFXGame.SFXSaveGameCallback
 // 0x000C (0x0048 - 0x003C)
 class USFXSaveGameCallback : public UObject
@@ -10848,16 +9831,9 @@ class USFXSaveGameCallback : public UObject
 public:
 	TArray< struct FScriptDelegate >                   SaveCommandCompleteDelegates;                     		// 0x003C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1463 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1463 );
 	};
 
 	void ClearSaveCommandCompleteDelegate ( struct FScriptDelegate SaveCommandCompleteDelegate );
@@ -10865,8 +9841,6 @@ public:
 	void SaveGameCommandComplete ( struct FSFXSaveGameCommandEventArgs Args );
 };
 
-UClass* USFXSaveGameCallback::pClassPointer = NULL;
-
 // Class SFXGame.SFXSaveManagerMP
 // 0x014C (0x0188 - 0x003C)
 class USFXSaveManagerMP : public UObject
@@ -10912,16 +9886,9 @@ public:
 	unsigned long                                      m_bSaveInProgress : 1;                            		// 0x0184 (0x0004) [0x0000000000000000] [0x00000008] 
 	unsigned long                                      m_bLoadInProgress : 1;                            		// 0x0184 (0x0004) [0x0000000000000000] [0x00000010] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1464 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1464 );
 	};
 
 	void DeployCharacter ( class Usfxmpcharacterrecord* Character );
@@ -11013,24 +9980,15 @@ public:
 	void OnSaveRecordsDelegate ( int nResult );
 };
 
-UClass* USFXSaveManagerMP::pClassPointer = NULL;
-
 // Class SFXGame.SFXSelectionLensFlareComponent
 // 0x0000 (0x0204 - 0x0204)
 class USFXSelectionLensFlareComponent : public ULensFlareComponent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1465 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1465 );
 	};
 
 	void SetIsActive ( unsigned long bInIsActive );
@@ -11038,8 +9996,6 @@ public:
 	void SetTemplate ( class ULensFlare* NewTemplate );
 };
 
-UClass* USFXSelectionLensFlareComponent::pClassPointer = NULL;
-
 // Class SFXGame.SFXSelectionModule
 // 0x0041 (0x0089 - 0x0048)
 class USFXSelectionModule : public USFXModule
@@ -11063,16 +10019,9 @@ public:
 	unsigned long                                      bHighPriority : 1;                                		// 0x0084 (0x0004) [0x0000000000000001] [0x00000020] ( CPF_Edit )
 	unsigned char                                      m_TargetTipText;                                  		// 0x0088 (0x0001) [0x0000000004000009]              ( CPF_Edit | CPF_ExportObject | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1466 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1466 );
 	};
 
 	void RestoreSelection ( );
@@ -11083,8 +10032,6 @@ public:
 	struct FVector GetSelectionPoint ( );
 };
 
-UClass* USFXSelectionModule::pClassPointer = NULL;
-
 // Class SFXGame.SFXSimpleUseModule
 // 0x0017 (0x00A0 - 0x0089)
 class USFXSimpleUseModule : public USFXSelectionModule
@@ -11096,16 +10043,9 @@ public:
 	unsigned long                                      bDeactivated : 1;                                 		// 0x009C (0x0004) [0x0000000000002001] [0x00000002] ( CPF_Edit | CPF_Transient )
 	unsigned long                                      bPlayUseAnimation : 1;                            		// 0x009C (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1467 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1467 );
 	};
 
 	bool eventIsDefaultActionPossible ( );
@@ -11114,8 +10054,6 @@ public:
 	void OnUsed ( class AActor* User );
 };
 
-UClass* USFXSimpleUseModule::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_AimAssistTarget
 // 0x0018 (0x00B8 - 0x00A0)
 class USFXModule_AimAssistTarget : public USFXSimpleUseModule
@@ -11124,24 +10062,15 @@ public:
 	TArray< struct FName >                             AimNodes;                                         		// 0x00A0 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	TArray< struct FAimAssistBox >                     AimAssistRegions;                                 		// 0x00AC (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1468 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1468 );
 	};
 
 	bool eventIsDefaultActionPossible ( );
 	void eventHandlePostBeginPlay ( );
 };
 
-UClass* USFXModule_AimAssistTarget::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_SavedUse
 // 0x0010 (0x00B0 - 0x00A0)
 class USFXModule_SavedUse : public USFXSimpleUseModule
@@ -11149,16 +10078,9 @@ class USFXModule_SavedUse : public USFXSimpleUseModule
 public:
 	struct FGuid                                       UseModuleGUID;                                    		// 0x00A0 (0x0010) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1469 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1469 );
 	};
 
 	bool HasBeenUsed ( );
@@ -11166,8 +10088,6 @@ public:
 	void OnUsed ( class AActor* User );
 };
 
-UClass* USFXModule_SavedUse::pClassPointer = NULL;
-
 // Class SFXGame.SFXWeaponUseModule
 // 0x0030 (0x00E0 - 0x00B0)
 class USFXWeaponUseModule : public USFXModule_SavedUse
@@ -11186,16 +10106,9 @@ public:
 	class UWwiseEvent*                                 PickupSound;                                      		// 0x00D8 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bStopCustomTicking : 1;                           		// 0x00DC (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1470 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1470 );
 	};
 
 	void StartWeaponSelection ( );
@@ -11209,8 +10122,6 @@ public:
 	void eventHandlePostBeginPlay ( );
 };
 
-UClass* USFXWeaponUseModule::pClassPointer = NULL;
-
 // Class SFXGame.SFXVersionDependentSelectionModule
 // 0x0007 (0x0090 - 0x0089)
 class USFXVersionDependentSelectionModule : public USFXSelectionModule
@@ -11218,24 +10129,15 @@ class USFXVersionDependentSelectionModule : public USFXSelectionModule
 public:
 	unsigned long                                      selectable : 1;                                   		// 0x008C (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1471 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1471 );
 	};
 
 	void eventHandlePostBeginPlay ( );
 	bool IsEnglishBuild ( );
 };
 
-UClass* USFXVersionDependentSelectionModule::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_AwardResource
 // 0x0009 (0x00B9 - 0x00B0)
 class USFXSeqAct_AwardResource : public USequenceAction
@@ -11246,24 +10148,15 @@ public:
 	unsigned long                                      bIsSalvage : 1;                                   		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned char                                      TreasureType;                                     		// 0x00B8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1472 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1472 );
 	};
 
 	int eventGetObjClassVersion ( );
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_AwardResource::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_HarvesterLand
 // 0x000C (0x00CC - 0x00C0)
 class USFXSeqAct_HarvesterLand : public USeqAct_Latent
@@ -11273,24 +10166,15 @@ public:
 	class AActor*                                      EndMarker;                                        		// 0x00C4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bTakeOff : 1;                                     		// 0x00C8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1473 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1473 );
 	};
 
 	bool Update ( float DeltaTime );
 	int GetObjClassVersion ( );
 };
 
-UClass* USFXSeqAct_HarvesterLand::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_LookupHenchmenFromPlotManager
 // 0x0010 (0x00C0 - 0x00B0)
 class USFXSeqAct_LookupHenchmenFromPlotManager : public USequenceAction
@@ -11299,23 +10183,14 @@ public:
 	TArray< int >                                      SelectedIndices;                                  		// 0x00B0 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	int                                                NumHenchmen;                                      		// 0x00BC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1474 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1474 );
 	};
 
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_LookupHenchmenFromPlotManager::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_WheelController_NativeBase
 // 0x001C (0x00DC - 0x00C0)
 class USFXSeqAct_WheelController_NativeBase : public USeqAct_Latent
@@ -11327,24 +10202,15 @@ public:
 	float                                              SteeringLimit;                                    		// 0x00D4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	float                                              SuspensionVariance;                               		// 0x00D8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1475 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1475 );
 	};
 
 	void UpdateWheels ( float LocalChassisVelocityX, struct FRotator WheelTargetFacing );
 	void ProcessWheels ( );
 };
 
-UClass* USFXSeqAct_WheelController_NativeBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXSmokeActorBase
 // 0x000E (0x0204 - 0x01F6)
 class ASFXSmokeActorBase : public AActor
@@ -11354,16 +10220,9 @@ public:
 	float                                              SmokeDuration;                                    		// 0x01FC (0x0004) [0x0000000000000002]              ( CPF_Const )
 	unsigned long                                      bActive : 1;                                      		// 0x0200 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1476 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1476 );
 	};
 
 	void Reset ( );
@@ -11372,8 +10231,6 @@ public:
 	void PostBeginPlay ( );
 };
 
-UClass* ASFXSmokeActorBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXVocalizationBank
 // 0x0018 (0x0054 - 0x003C)
 class USFXVocalizationBank : public UObject
@@ -11382,16 +10239,9 @@ public:
 	TArray< struct FSFXVocalizationRole >              Vocalizations;                                    		// 0x003C (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	TArray< struct FSFXVocalizationEventV2 >           VocalizationsV2;                                  		// 0x0048 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1477 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1477 );
 	};
 
 	void eventMakeEntry ( struct FName Role, struct FName Event, struct FName Type, struct FName Variation, class UWwiseEvent* Sound );
@@ -11399,8 +10249,6 @@ public:
 	void EnsureArrays ( int i, int J );
 };
 
-UClass* USFXVocalizationBank::pClassPointer = NULL;
-
 // Class SFXGame.SFXVocalizationManagerNativeBase
 // 0x0032 (0x0228 - 0x01F6)
 class ASFXVocalizationManagerNativeBase : public AActor
@@ -11414,16 +10262,9 @@ public:
 	unsigned long                                      bDebugging : 1;                                   		// 0x0224 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned long                                      bAlwaysPlay : 1;                                  		// 0x0224 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1478 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1478 );
 	};
 
 	void eventTickEvents ( float DeltaTime );
@@ -11443,8 +10284,6 @@ public:
 	bool eventPlaySFXVocalizationSLineInternal ( class ABioPawn* Speaker, float DelaySec, struct FSFXVocalizationEvent* Event, struct FSFXVocalizationLine* LineToPlay );
 };
 
-UClass* ASFXVocalizationManagerNativeBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXVocalizationTypes
 // 0x000C (0x0048 - 0x003C)
 class USFXVocalizationTypes : public UObject
@@ -11452,22 +10291,13 @@ class USFXVocalizationTypes : public UObject
 public:
 	TArray< class UObject* >                           EnumForType;                                      		// 0x003C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1479 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1479 );
 	};
 
 };
 
-UClass* USFXVocalizationTypes::pClassPointer = NULL;
-
 // Class SFXGame.Bio2DA
 // 0x00D8 (0x0114 - 0x003C)
 class UBio2DA : public UObject
@@ -11480,16 +10310,9 @@ public:
 	TArray< struct FBio2daMasterRowIndexRec >          m_MasterRowIndex;                                 		// 0x00FC (0x000C) [0x0000000000001000]              ( CPF_Native )
 	TArray< struct FName >                             m_sRowLabel;                                      		// 0x0108 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1480 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1480 );
 	};
 
 	int GetRowNumber ( int nRowIndex );
@@ -11528,8 +10351,6 @@ public:
 	int GetNumColumns ( );
 };
 
-UClass* UBio2DA::pClassPointer = NULL;
-
 // Class SFXGame.Bio2DANumberedRows
 // 0x0054 (0x0168 - 0x0114)
 class UBio2DANumberedRows : public UBio2DA
@@ -11539,22 +10360,13 @@ public:
 	TArray< struct FBio2daMasterRowIndexRec >          m_MasterNumberedRowIndex;                         		// 0x0150 (0x000C) [0x0000000000001000]              ( CPF_Native )
 	TArray< int >                                      m_lstRowNumbers;                                  		// 0x015C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1481 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1481 );
 	};
 
 };
 
-UClass* UBio2DANumberedRows::pClassPointer = NULL;
-
 // Class SFXGame.BioAnim_TurnInPlace_Rotator
 // 0x0017 (0x00D4 - 0x00BD)
 class UBioAnim_TurnInPlace_Rotator : public UAnimNodeBlendBase
@@ -11564,22 +10376,13 @@ public:
 	class ABioPawn*                                    BioPawnOwner;                                     		// 0x00CC (0x0004) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 	class UBioAnimNodeBlend_TurnInPlace*               ActiveTurnInPlaceNode;                            		// 0x00D0 (0x0004) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1482 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1482 );
 	};
 
 };
 
-UClass* UBioAnim_TurnInPlace_Rotator::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimCheckBlendOut
 // 0x0014 (0x0050 - 0x003C)
 class UBioAnimCheckBlendOut : public UObject
@@ -11588,22 +10391,13 @@ public:
 	struct FBioAnimCheckBlendOutPath                   PathsLL;                                          		// 0x003C (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 	class UAnimNode*                                   Parent;                                           		// 0x004C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1483 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1483 );
 	};
 
 };
 
-UClass* UBioAnimCheckBlendOut::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimMovementSync
 // 0x0010 (0x004C - 0x003C)
 class UBioAnimMovementSync : public UObject
@@ -11612,22 +10406,13 @@ public:
 	TArray< struct FBioAnimMovementSyncNode >          MovementNodes;                                    		// 0x003C (0x000C) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 	unsigned long                                      bInitialized : 1;                                 		// 0x0048 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1484 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1484 );
 	};
 
 };
 
-UClass* UBioAnimMovementSync::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeAimOffset
 // 0x0040 (0x0151 - 0x0111)
 class UBioAnimNodeAimOffset : public UAnimNodeAimOffset
@@ -11645,22 +10430,13 @@ public:
 	float                                              AngVelAimOffsetScale;                             		// 0x014C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      AimInput;                                         		// 0x0150 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1485 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1485 );
 	};
 
 };
 
-UClass* UBioAnimNodeAimOffset::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlend_TurnInPlace
 // 0x0054 (0x012C - 0x00D8)
 class UBioAnimNodeBlend_TurnInPlace : public UAnimNodeBlendList
@@ -11688,22 +10464,13 @@ public:
 	unsigned long                                      bPlayingTurnTransition : 1;                       		// 0x0128 (0x0004) [0x0000000000000002] [0x00000008] ( CPF_Const )
 	unsigned long                                      bTransitioningToIdle : 1;                         		// 0x0128 (0x0004) [0x0000000000000000] [0x00000010] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1486 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1486 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlend_TurnInPlace::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendBase
 // 0x001F (0x00DC - 0x00BD)
 class UBioAnimNodeBlendBase : public UAnimNodeBlendBase
@@ -11720,46 +10487,28 @@ public:
 	unsigned long                                      m_bBlendDirect : 1;                               		// 0x00D8 (0x0004) [0x0000000000000000] [0x00000004] 
 	unsigned long                                      m_bShowSlider : 1;                                		// 0x00D8 (0x0004) [0x0000000000000000] [0x00000008] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1487 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1487 );
 	};
 
 	void SetChildAnimTime ( class UAnimNode* oChild, float fTime );
 };
 
-UClass* UBioAnimNodeBlendBase::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendAdditive
 // 0x0000 (0x00DC - 0x00DC)
 class UBioAnimNodeBlendAdditive : public UBioAnimNodeBlendBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1488 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1488 );
 	};
 
 	void SetChildAnimTime ( class UAnimNode* oChild, float fTime );
 };
 
-UClass* UBioAnimNodeBlendAdditive::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendAdditiveCover
 // 0x0008 (0x00E4 - 0x00DC)
 class UBioAnimNodeBlendAdditiveCover : public UBioAnimNodeBlendAdditive
@@ -11768,22 +10517,13 @@ public:
 	float                                              BlendInDuration;                                  		// 0x00DC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	float                                              BlendOutDuration;                                 		// 0x00E0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1489 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1489 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendAdditiveCover::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendAdditiveDamage
 // 0x001C (0x00F8 - 0x00DC)
 class UBioAnimNodeBlendAdditiveDamage : public UBioAnimNodeBlendAdditive
@@ -11796,22 +10536,13 @@ public:
 	unsigned long                                      bLastDamageNode : 1;                              		// 0x00F4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bProcessDamage : 1;                               		// 0x00F4 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1490 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1490 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendAdditiveDamage::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendByDeath
 // 0x0050 (0x012C - 0x00DC)
 class UBioAnimNodeBlendByDeath : public UBioAnimNodeBlendBase
@@ -11832,22 +10563,13 @@ public:
 	float                                              m_fCurrentTime;                                   		// 0x0124 (0x0004) [0x0000000000000000]              
 	unsigned long                                      m_bEventTriggered : 1;                            		// 0x0128 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1491 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1491 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendByDeath::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendByIncline
 // 0x0014 (0x00F0 - 0x00DC)
 class UBioAnimNodeBlendByIncline : public UBioAnimNodeBlendBase
@@ -11859,22 +10581,13 @@ public:
 	float                                              m_fInclineAngle;                                  		// 0x00E8 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bForceLevelReferenceAngle : 1;                    		// 0x00EC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1492 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1492 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendByIncline::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendByLean
 // 0x0018 (0x00F4 - 0x00DC)
 class UBioAnimNodeBlendByLean : public UBioAnimNodeBlendBase
@@ -11887,22 +10600,13 @@ public:
 	float                                              m_fLastLeanAngle;                                 		// 0x00EC (0x0004) [0x0000000000000000]              
 	unsigned long                                      m_bSwitchingLean : 1;                             		// 0x00F0 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1493 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1493 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendByLean::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendDirectional
 // 0x0014 (0x00F0 - 0x00DC)
 class UBioAnimNodeBlendDirectional : public UBioAnimNodeBlendBase
@@ -11915,22 +10619,13 @@ public:
 	unsigned long                                      m_bForward : 1;                                   		// 0x00EC (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      m_bWasMoving : 1;                                 		// 0x00EC (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1494 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1494 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendDirectional::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendDirStart
 // 0x0010 (0x00EC - 0x00DC)
 class UBioAnimNodeBlendDirStart : public UBioAnimNodeBlendBase
@@ -11941,68 +10636,41 @@ public:
 	float                                              RightStartTime;                                   		// 0x00E4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      m_bIsStarting : 1;                                		// 0x00E8 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1495 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1495 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendDirStart::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendGetUp
 // 0x0000 (0x00DC - 0x00DC)
 class UBioAnimNodeBlendGetUp : public UBioAnimNodeBlendBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1496 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1496 );
 	};
 
 	void SetChildAnimTime ( class UAnimNode* oChild, float fTime );
 };
 
-UClass* UBioAnimNodeBlendGetUp::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendMoveStop
 // 0x0000 (0x00DC - 0x00DC)
 class UBioAnimNodeBlendMoveStop : public UBioAnimNodeBlendBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1497 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1497 );
 	};
 
 	void SetChildAnimTime ( class UAnimNode* oChild, float fTime );
 };
 
-UClass* UBioAnimNodeBlendMoveStop::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendMultiAdditive
 // 0x0044 (0x0120 - 0x00DC)
 class UBioAnimNodeBlendMultiAdditive : public UBioAnimNodeBlendBase
@@ -12012,22 +10680,13 @@ public:
 	int                                                m_nNumAdditiveChildren;                           		// 0x0118 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      m_bBasePoseForEachChild : 1;                      		// 0x011C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1498 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1498 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendMultiAdditive::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendEyeNoiseAndBlink
 // 0x000C (0x012C - 0x0120)
 class UBioAnimNodeBlendEyeNoiseAndBlink : public UBioAnimNodeBlendMultiAdditive
@@ -12037,22 +10696,13 @@ public:
 	float                                              m_fCachedRegularBlinkWeight;                      		// 0x0124 (0x0004) [0x0000000000000000]              
 	float                                              m_fBlinkBlendOutTime;                             		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1499 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1499 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendEyeNoiseAndBlink::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendPoseAndGestures
 // 0x0024 (0x0144 - 0x0120)
 class UBioAnimNodeBlendPoseAndGestures : public UBioAnimNodeBlendMultiAdditive
@@ -12062,22 +10712,13 @@ public:
 	TArray< struct FName >                             m_aRefPoseAnimsets;                               		// 0x012C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	TArray< struct FBioChildPinData >                  m_aChildPinData;                                  		// 0x0138 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1500 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1500 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendPoseAndGestures::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendPose
 // 0x0018 (0x00F4 - 0x00DC)
 class UBioAnimNodeBlendPose : public UBioAnimNodeBlendBase
@@ -12088,22 +10729,13 @@ public:
 	float                                              m_fEndBlendDuration;                              		// 0x00EC (0x0004) [0x0000000000000000]              
 	unsigned long                                      m_bTransIsOneShot : 1;                            		// 0x00F0 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1501 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1501 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendPose::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendScalar
 // 0x0048 (0x0124 - 0x00DC)
 class UBioAnimNodeBlendScalar : public UBioAnimNodeBlendBase
@@ -12123,22 +10755,13 @@ public:
 	unsigned long                                      m_bBlendInstant : 1;                              		// 0x0120 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      m_bUseBlendSpanTime : 1;                          		// 0x0120 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1502 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1502 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendScalar::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendSkidTurn
 // 0x0020 (0x00FC - 0x00DC)
 class UBioAnimNodeBlendSkidTurn : public UBioAnimNodeBlendBase
@@ -12154,22 +10777,13 @@ public:
 	unsigned long                                      m_bIsSkidding : 1;                                		// 0x00F8 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      m_bFinishSkidStarted : 1;                         		// 0x00F8 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1503 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1503 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendSkidTurn::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendSpeed
 // 0x002D (0x0109 - 0x00DC)
 class UBioAnimNodeBlendSpeed : public UBioAnimNodeBlendBase
@@ -12189,22 +10803,13 @@ public:
 	unsigned long                                      m_bIsStarted : 1;                                 		// 0x0104 (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned char                                      SpeedType;                                        		// 0x0108 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1504 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1504 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendSpeed::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendState
 // 0x0018 (0x00F4 - 0x00DC)
 class UBioAnimNodeBlendState : public UBioAnimNodeBlendBase
@@ -12215,22 +10820,13 @@ public:
 	class UBioAnimCheckBlendOut*                       m_oBlendOut;                                      		// 0x00EC (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	class UBioAnimNodeBlendStateBehavior*              m_oBehavior;                                      		// 0x00F0 (0x0004) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1505 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1505 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendState::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeCombatMode
 // 0x0015 (0x00F1 - 0x00DC)
 class UBioAnimNodeCombatMode : public UBioAnimNodeBlendBase
@@ -12243,22 +10839,13 @@ public:
 	unsigned long                                      m_isInitialStateDetermined : 1;                   		// 0x00EC (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned char                                      m_currentState;                                   		// 0x00F0 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1506 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1506 );
 	};
 
 };
 
-UClass* UBioAnimNodeCombatMode::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendByAction
 // 0x03F9 (0x04D1 - 0x00D8)
 class UBioAnimNodeBlendByAction : public UAnimNodeBlendList
@@ -12269,22 +10856,13 @@ public:
 	unsigned long                                      m_bFallingAvailable : 1;                          		// 0x04CC (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 	unsigned char                                      m_eCurrentAnimNode;                               		// 0x04D0 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1507 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1507 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendByAction::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendByAim
 // 0x003F (0x00FC - 0x00BD)
 class UBioAnimNodeBlendByAim : public UAnimNodeBlendBase
@@ -12300,45 +10878,27 @@ public:
 	class UBioAnimCheckBlendOut*                       BlendOut;                                         		// 0x00F4 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned long                                      bUseMirrored : 1;                                 		// 0x00F8 (0x0004) [0x0000000000002001] [0x00000001] ( CPF_Edit | CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1508 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1508 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendByAim::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendByCustomAnim
 // 0x0000 (0x00D0 - 0x00D0)
 class UBioAnimNodeBlendByCustomAnim : public UAnimNodeBlend
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1509 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1509 );
 	};
 
 	void SetBlendTarget ( float BlendTarget, float BlendTime );
 };
 
-UClass* UBioAnimNodeBlendByCustomAnim::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendByDamage
 // 0x0008 (0x00E0 - 0x00D8)
 class UBioAnimNodeBlendByDamage : public UAnimNodeBlendList
@@ -12347,22 +10907,13 @@ public:
 	int                                                m_nLastDamageIndex;                               		// 0x00D8 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned long                                      bAdditiveMode : 1;                                		// 0x00DC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1510 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1510 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendByDamage::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendByFireSequence
 // 0x0034 (0x010C - 0x00D8)
 class UBioAnimNodeBlendByFireSequence : public UAnimNodeBlendList
@@ -12376,24 +10927,15 @@ public:
 	int                                                FlashCount;                                       		// 0x0104 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned long                                      CacheUpdated : 1;                                 		// 0x0108 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1511 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1511 );
 	};
 
 	float eventGetPlayRate ( class UAnimNodeSequence* Seq );
 	void eventNotifyWeaponAnimationPlaying ( unsigned long Playing );
 };
 
-UClass* UBioAnimNodeBlendByFireSequence::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendByPosture
 // 0x0004 (0x00D4 - 0x00D0)
 class UBioAnimNodeBlendByPosture : public UAnimNodeBlend
@@ -12401,22 +10943,13 @@ class UBioAnimNodeBlendByPosture : public UAnimNodeBlend
 public:
 	float                                              BlendDuration;                                    		// 0x00D0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1512 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1512 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendByPosture::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendByPower
 // 0x0005 (0x00DD - 0x00D8)
 class UBioAnimNodeBlendByPower : public UAnimNodeBlendList
@@ -12425,46 +10958,28 @@ public:
 	int                                                LastTag;                                          		// 0x00D8 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned char                                      NotifyActive;                                     		// 0x00DC (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1513 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1513 );
 	};
 
 	void SendPowerNotification ( );
 };
 
-UClass* UBioAnimNodeBlendByPower::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendByReload
 // 0x0000 (0x00D8 - 0x00D8)
 class UBioAnimNodeBlendByReload : public UAnimNodeBlendList
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1514 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1514 );
 	};
 
 	void SetActiveChild ( int ChildIndex, float BlendTime );
 };
 
-UClass* UBioAnimNodeBlendByReload::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendByStorm
 // 0x000C (0x00E4 - 0x00D8)
 class UBioAnimNodeBlendByStorm : public UAnimNodeBlendList
@@ -12474,45 +10989,27 @@ public:
 	float                                              Storm2IdleBlendDuration;                          		// 0x00DC (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 	class UBioAnimMovementSync*                        MovementSync;                                     		// 0x00E0 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1515 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1515 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendByStorm::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendByWeaponAction
 // 0x0000 (0x00D8 - 0x00D8)
 class UBioAnimNodeBlendByWeaponAction : public UAnimNodeBlendList
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1516 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1516 );
 	};
 
 	void SetActiveChild ( int ChildIndex, float BlendTime );
 };
 
-UClass* UBioAnimNodeBlendByWeaponAction::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendByWeaponEquip
 // 0x0014 (0x00EC - 0x00D8)
 class UBioAnimNodeBlendByWeaponEquip : public UAnimNodeBlendList
@@ -12524,24 +11021,15 @@ public:
 	float                                              HolsterToIdleBlendDuration;                       		// 0x00E4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bDisabledIK : 1;                                  		// 0x00E8 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1517 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1517 );
 	};
 
 	void eventDrawAnimEnd ( );
 	void eventHolsterAnimEnd ( );
 };
 
-UClass* UBioAnimNodeBlendByWeaponEquip::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendFall
 // 0x000C (0x00E4 - 0x00D8)
 class UBioAnimNodeBlendFall : public UAnimNodeBlendList
@@ -12551,22 +11039,13 @@ public:
 	float                                              BlendIntoLandingTime;                             		// 0x00DC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bRootMotionOverridden : 1;                        		// 0x00E0 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1518 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1518 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendFall::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendMovement
 // 0x005C (0x0134 - 0x00D8)
 class UBioAnimNodeBlendMovement : public UAnimNodeBlendList
@@ -12594,22 +11073,13 @@ public:
 	float                                              CurrentWalkRate;                                  		// 0x012C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	float                                              CurrentRunRate;                                   		// 0x0130 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1519 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1519 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendMovement::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendPerBone
 // 0x0025 (0x011D - 0x00F8)
 class UBioAnimNodeBlendPerBone : public UAnimNodeBlendPerBone
@@ -12624,22 +11094,13 @@ public:
 	unsigned long                                      m_bBoneSwitchOn : 1;                              		// 0x0118 (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned char                                      BoneBlendType;                                    		// 0x011C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1520 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1520 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendPerBone::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendScalarBehavior
 // 0x000C (0x0048 - 0x003C)
 class UBioAnimNodeBlendScalarBehavior : public UObject
@@ -12647,22 +11108,13 @@ class UBioAnimNodeBlendScalarBehavior : public UObject
 public:
 	TArray< struct FBioAnimScalarNodeBehaviorDef >     m_aNodeDefinitions;                               		// 0x003C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1521 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1521 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendScalarBehavior::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendScalarMovementBehavior
 // 0x0008 (0x0050 - 0x0048)
 class UBioAnimNodeBlendScalarMovementBehavior : public UBioAnimNodeBlendScalarBehavior
@@ -12677,22 +11129,13 @@ public:
 	unsigned char                                      AxisDir;                                          		// 0x004E (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      AxisDirMode;                                      		// 0x004F (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1522 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1522 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendScalarMovementBehavior::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendStateBehavior
 // 0x0010 (0x004C - 0x003C)
 class UBioAnimNodeBlendStateBehavior : public UObject
@@ -12701,22 +11144,13 @@ public:
 	TArray< struct FBioAnimStateNodeBehaviorDef >      m_aNodeDefinitions;                               		// 0x003C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	float                                              m_fQueryPlayTime;                                 		// 0x0048 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1523 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1523 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendStateBehavior::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendStateActionBehavior
 // 0x0005 (0x0051 - 0x004C)
 class UBioAnimNodeBlendStateActionBehavior : public UBioAnimNodeBlendStateBehavior
@@ -12725,22 +11159,13 @@ public:
 	unsigned long                                      m_bPlayedRecoverAnim : 1;                         		// 0x004C (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned char                                      ActionBehavior;                                   		// 0x0050 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1524 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1524 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendStateActionBehavior::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendStateCombatBehavior
 // 0x0005 (0x0051 - 0x004C)
 class UBioAnimNodeBlendStateCombatBehavior : public UBioAnimNodeBlendStateBehavior
@@ -12751,22 +11176,13 @@ public:
 	unsigned long                                      bOnlyDuringNoOffensiveAction : 1;                 		// 0x004C (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 	unsigned char                                      CombatBehavior;                                   		// 0x0050 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1525 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1525 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendStateCombatBehavior::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendStateMovementBehavior
 // 0x0023 (0x006F - 0x004C)
 class UBioAnimNodeBlendStateMovementBehavior : public UBioAnimNodeBlendStateBehavior
@@ -12792,22 +11208,13 @@ public:
 	unsigned char                                      AxisDir;                                          		// 0x006D (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      AxisDirMode;                                      		// 0x006E (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1526 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1526 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendStateMovementBehavior::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendStrafe
 // 0x001F (0x00DC - 0x00BD)
 class UBioAnimNodeBlendStrafe : public UAnimNodeBlendBase
@@ -12820,22 +11227,13 @@ public:
 	float                                              DirAngle;                                         		// 0x00D4 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	class UBioAnimMovementSync*                        MovementSync;                                     		// 0x00D8 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1527 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1527 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendStrafe::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendStuntActor
 // 0x0004 (0x00DC - 0x00D8)
 class UBioAnimNodeBlendStuntActor : public UAnimNodeBlendList
@@ -12843,22 +11241,13 @@ class UBioAnimNodeBlendStuntActor : public UAnimNodeBlendList
 public:
 	int                                                m_nCurrentAnimNode;                               		// 0x00D8 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1528 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1528 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendStuntActor::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendTurn
 // 0x000C (0x00E4 - 0x00D8)
 class UBioAnimNodeBlendTurn : public UAnimNodeBlendList
@@ -12868,22 +11257,13 @@ public:
 	float                                              YawTurnTriggerDegrees;                            		// 0x00DC (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 	class UBioAnimCheckBlendOut*                       BlendOut;                                         		// 0x00E0 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1529 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1529 );
 	};
 
 };
 
-UClass* UBioAnimNodeBlendTurn::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeCover2Actions
 // 0x0034 (0x010C - 0x00D8)
 class UBioAnimNodeCover2Actions : public UAnimNodeBlendList
@@ -12903,22 +11283,13 @@ public:
 	float                                              Aimback2DefaultBlendDuration;                     		// 0x0104 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 	class UBioAnimCheckBlendOut*                       BlendOut;                                         		// 0x0108 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1530 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1530 );
 	};
 
 };
 
-UClass* UBioAnimNodeCover2Actions::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeCover2ChangeDirection
 // 0x000E (0x00E6 - 0x00D8)
 class UBioAnimNodeCover2ChangeDirection : public UAnimNodeBlendList
@@ -12930,22 +11301,13 @@ public:
 	unsigned char                                      CurrentCoverDirection;                            		// 0x00E4 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 	unsigned char                                      PendingCoverDirection;                            		// 0x00E5 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1531 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1531 );
 	};
 
 };
 
-UClass* UBioAnimNodeCover2ChangeDirection::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeCover2Move
 // 0x000C (0x00E4 - 0x00D8)
 class UBioAnimNodeCover2Move : public UAnimNodeBlendList
@@ -12955,22 +11317,13 @@ public:
 	float                                              Move2IdleBlendDuration;                           		// 0x00DC (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 	class UBioAnimCheckBlendOut*                       BlendOut;                                         		// 0x00E0 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1532 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1532 );
 	};
 
 };
 
-UClass* UBioAnimNodeCover2Move::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeCover2Neutral
 // 0x0004 (0x00DC - 0x00D8)
 class UBioAnimNodeCover2Neutral : public UAnimNodeBlendList
@@ -12978,22 +11331,13 @@ class UBioAnimNodeCover2Neutral : public UAnimNodeBlendList
 public:
 	float                                              BlendTime;                                        		// 0x00D8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1533 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1533 );
 	};
 
 };
 
-UClass* UBioAnimNodeCover2Neutral::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeCover2Transition
 // 0x001F (0x00F7 - 0x00D8)
 class UBioAnimNodeCover2Transition : public UAnimNodeBlendList
@@ -13019,23 +11363,14 @@ public:
 	unsigned char                                      RootMotionMode;                                   		// 0x00F5 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 	unsigned char                                      RootRotationMode;                                 		// 0x00F6 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1534 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1534 );
 	};
 
 	void eventIgnorePlayerInput ( class ABioPawn* pPawn, unsigned long bIgnore );
 };
 
-UClass* UBioAnimNodeCover2Transition::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeCover2Type
 // 0x0001 (0x00D9 - 0x00D8)
 class UBioAnimNodeCover2Type : public UAnimNodeBlendList
@@ -13043,22 +11378,13 @@ class UBioAnimNodeCover2Type : public UAnimNodeBlendList
 public:
 	unsigned char                                      LastCoverAction;                                  		// 0x00D8 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1535 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1535 );
 	};
 
 };
 
-UClass* UBioAnimNodeCover2Type::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeFrame
 // 0x0013 (0x00BC - 0x00A9)
 class UBioAnimNodeFrame : public UAnimNode
@@ -13068,23 +11394,14 @@ public:
 	unsigned long                                      m_bIsFrameDataValid : 1;                          		// 0x00B8 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned long                                      m_bCaptureOnRelevant : 1;                         		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1536 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1536 );
 	};
 
 	void CaptureAnimFrame ( );
 };
 
-UClass* UBioAnimNodeFrame::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeLocomotion
 // 0x0018 (0x00F0 - 0x00D8)
 class UBioAnimNodeLocomotion : public UAnimNodeBlendList
@@ -13097,22 +11414,13 @@ public:
 	float                                              StopToStartBlendDuration;                         		// 0x00E8 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 	class UBioAnimCheckBlendOut*                       BlendOut;                                         		// 0x00EC (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1537 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1537 );
 	};
 
 };
 
-UClass* UBioAnimNodeLocomotion::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeLocomotionMoving
 // 0x003F (0x00FC - 0x00BD)
 class UBioAnimNodeLocomotionMoving : public UAnimNodeBlendBase
@@ -13133,22 +11441,13 @@ public:
 	float                                              Lean;                                             		// 0x00F4 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	float                                              Incline;                                          		// 0x00F8 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1538 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1538 );
 	};
 
 };
 
-UClass* UBioAnimNodeLocomotionMoving::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeLocomotionSpeed
 // 0x0010 (0x00E8 - 0x00D8)
 class UBioAnimNodeLocomotionSpeed : public UAnimNodeBlendList
@@ -13159,22 +11458,13 @@ public:
 	float                                              WalkSpeed;                                        		// 0x00E0 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 	class UBioAnimCheckBlendOut*                       BlendOut;                                         		// 0x00E4 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1539 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1539 );
 	};
 
 };
 
-UClass* UBioAnimNodeLocomotionSpeed::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeLocomotionStart
 // 0x0057 (0x0114 - 0x00BD)
 class UBioAnimNodeLocomotionStart : public UAnimNodeBlendBase
@@ -13192,22 +11482,13 @@ public:
 	unsigned long                                      bOverrideRMM : 1;                                 		// 0x0110 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 	unsigned long                                      bOverrideRMR : 1;                                 		// 0x0110 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1540 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1540 );
 	};
 
 };
 
-UClass* UBioAnimNodeLocomotionStart::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeLocomotionStop
 // 0x0018 (0x00F0 - 0x00D8)
 class UBioAnimNodeLocomotionStop : public UAnimNodeBlendList
@@ -13219,22 +11500,13 @@ public:
 	class UBioAnimMovementSync*                        MovementSync;                                     		// 0x00E8 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned long                                      bOverrideRootMotion : 1;                          		// 0x00EC (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1541 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1541 );
 	};
 
 };
 
-UClass* UBioAnimNodeLocomotionStop::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeRandom
 // 0x0008 (0x00F4 - 0x00EC)
 class UBioAnimNodeRandom : public UAnimNodeRandom
@@ -13243,22 +11515,13 @@ public:
 	int                                                nChildOnActive;                                   		// 0x00EC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bForceChildOnActive : 1;                          		// 0x00F0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1542 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1542 );
 	};
 
 };
 
-UClass* UBioAnimNodeRandom::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeSequence
 // 0x0036 (0x0128 - 0x00F2)
 class UBioAnimNodeSequence : public UAnimNodeSequence
@@ -13273,22 +11536,13 @@ public:
 	struct FName                                       DF_SequenceLength;                                		// 0x011C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bRandomizeStartTime : 1;                          		// 0x0124 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1543 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1543 );
 	};
 
 };
 
-UClass* UBioAnimNodeSequence::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeSequenceByBoneRotation
 // 0x0017 (0x0109 - 0x00F2)
 class UBioAnimNodeSequenceByBoneRotation : public UAnimNodeSequence
@@ -13298,22 +11552,13 @@ public:
 	struct FName                                       BoneName;                                         		// 0x0100 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      BoneAxis;                                         		// 0x0108 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1544 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1544 );
 	};
 
 };
 
-UClass* UBioAnimNodeSequenceByBoneRotation::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeSequenceMirror
 // 0x001E (0x0110 - 0x00F2)
 class UBioAnimNodeSequenceMirror : public UAnimNodeSequence
@@ -13326,22 +11571,13 @@ public:
 	int                                                DefaultAnimLinkupIndex;                           		// 0x0108 (0x0004) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 	unsigned long                                      bUseMirrored : 1;                                 		// 0x010C (0x0004) [0x0000000000002001] [0x00000001] ( CPF_Edit | CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1545 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1545 );
 	};
 
 };
 
-UClass* UBioAnimNodeSequenceMirror::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNotifyEvent
 // 0x000C (0x0048 - 0x003C)
 class UBioAnimNotifyEvent : public UAnimNotify
@@ -13350,22 +11586,13 @@ public:
 	struct FName                                       EventName;                                        		// 0x003C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      IsGlobal : 1;                                     		// 0x0044 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1546 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1546 );
 	};
 
 };
 
-UClass* UBioAnimNotifyEvent::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNotifyVFX
 // 0x0008 (0x0044 - 0x003C)
 class UBioAnimNotifyVFX : public UAnimNotify
@@ -13373,22 +11600,13 @@ class UBioAnimNotifyVFX : public UAnimNotify
 public:
 	struct FName                                       m_nmVisualEffectLabel;                            		// 0x003C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1547 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1547 );
 	};
 
 };
 
-UClass* UBioAnimNotifyVFX::pClassPointer = NULL;
-
 // Class SFXGame.BioSkelControl_TurretConstrained
 // 0x0032 (0x00FC - 0x00CA)
 class UBioSkelControl_TurretConstrained : public USkelControlSingleBone
@@ -13406,22 +11624,13 @@ public:
 	unsigned long                                      bInvertYaw : 1;                                   		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 	unsigned long                                      bInvertRoll : 1;                                  		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000020] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1548 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1548 );
 	};
 
 };
 
-UClass* UBioSkelControl_TurretConstrained::pClassPointer = NULL;
-
 // Class SFXGame.BioSkelControlAdditiveLookAt
 // 0x0008 (0x0118 - 0x0110)
 class UBioSkelControlAdditiveLookAt : public USkelControlLookAt
@@ -13430,22 +11639,13 @@ public:
 	float                                              MaxAngleUpDown;                                   		// 0x0110 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bSeparateUpDownLimit : 1;                         		// 0x0114 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1549 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1549 );
 	};
 
 };
 
-UClass* UBioSkelControlAdditiveLookAt::pClassPointer = NULL;
-
 // Class SFXGame.BioActorLookAtController
 // 0x0077 (0x018F - 0x0118)
 class UBioActorLookAtController : public UBioSkelControlAdditiveLookAt
@@ -13475,22 +11675,13 @@ public:
 	unsigned char                                      m_RootAnimBoneUpAxis;                             		// 0x018D (0x0001) [0x0000000000002000]              ( CPF_Transient )
 	unsigned char                                      nTransitionType;                                  		// 0x018E (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1550 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1550 );
 	};
 
 };
 
-UClass* UBioActorLookAtController::pClassPointer = NULL;
-
 // Class SFXGame.SFXAnimNodeBlendByMoveTransition
 // 0x0024 (0x00FC - 0x00D8)
 class USFXAnimNodeBlendByMoveTransition : public UAnimNodeBlendList
@@ -13503,22 +11694,13 @@ public:
 	int                                                ActiveMoveToIdleTrans;                            		// 0x00F4 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned long                                      bIdle : 1;                                        		// 0x00F8 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1551 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1551 );
 	};
 
 };
 
-UClass* USFXAnimNodeBlendByMoveTransition::pClassPointer = NULL;
-
 // Class SFXGame.SFXAnimNodeBlendStrafe
 // 0x0023 (0x00E0 - 0x00BD)
 class USFXAnimNodeBlendStrafe : public UAnimNodeBlendBase
@@ -13532,22 +11714,13 @@ public:
 	int                                                HighestIndex;                                     		// 0x00D8 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	class UBioAnimMovementSync*                        MovementSync;                                     		// 0x00DC (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1552 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1552 );
 	};
 
 };
 
-UClass* USFXAnimNodeBlendStrafe::pClassPointer = NULL;
-
 // Class SFXGame.SFXAnimNodeBlendStrafeBySpeed
 // 0x0020 (0x0100 - 0x00E0)
 class USFXAnimNodeBlendStrafeBySpeed : public USFXAnimNodeBlendStrafe
@@ -13555,22 +11728,13 @@ class USFXAnimNodeBlendStrafeBySpeed : public USFXAnimNodeBlendStrafe
 public:
 	float                                              BaseSpeeds[ 0x8 ];                                		// 0x00E0 (0x0020) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1553 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1553 );
 	};
 
 };
 
-UClass* USFXAnimNodeBlendStrafeBySpeed::pClassPointer = NULL;
-
 // Class SFXGame.SFXAnimNotify_Exertion
 // 0x0004 (0x0040 - 0x003C)
 class USFXAnimNotify_Exertion : public UAnimNotify
@@ -13578,22 +11742,13 @@ class USFXAnimNotify_Exertion : public UAnimNotify
 public:
 	class UWwiseEvent*                                 ExertionEvent;                                    		// 0x003C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1554 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1554 );
 	};
 
 };
 
-UClass* USFXAnimNotify_Exertion::pClassPointer = NULL;
-
 // Class SFXGame.SFXAnimSetCookSpec
 // 0x0004 (0x0040 - 0x003C)
 class USFXAnimSetCookSpec : public UObject
@@ -13601,22 +11756,13 @@ class USFXAnimSetCookSpec : public UObject
 public:
 	class UAnimSet*                                    AnimSet;                                          		// 0x003C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1555 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1555 );
 	};
 
 };
 
-UClass* USFXAnimSetCookSpec::pClassPointer = NULL;
-
 // Class SFXGame.SFXDoor
 // 0x00C7 (0x02F3 - 0x022C)
 class ASFXDoor : public ASkeletalMeshActor
@@ -13671,16 +11817,9 @@ public:
 	unsigned char                                      m_TargetTipTextDelayed;                           		// 0x02F1 (0x0001) [0x0000000000000009]              ( CPF_Edit | CPF_ExportObject )
 	unsigned char                                      m_PendingDoorState;                               		// 0x02F2 (0x0001) [0x0000000000002020]              ( CPF_Net | CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1556 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1556 );
 	};
 
 	void CheckInterrupt ( );
@@ -13706,24 +11845,15 @@ public:
 	void OnUse ( class AActor* User );
 };
 
-UClass* ASFXDoor::pClassPointer = NULL;
-
 // Class SFXGame.SFXGoreActor
 // 0x0000 (0x022C - 0x022C)
 class ASFXGoreActor : public ASkeletalMeshActor
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1557 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1557 );
 	};
 
 	class USkeletalMeshComponent* GetHeadSkelMeshComponent ( );
@@ -13758,8 +11888,6 @@ public:
 	void OnSetAimTarget ( class USFXSeqAct_SetAimTarget* inAction );
 };
 
-UClass* ASFXGoreActor::pClassPointer = NULL;
-
 // Class SFXGame.SFXSkelControlLimb
 // 0x0010 (0x00EC - 0x00DC)
 class USFXSkelControlLimb : public USkelControlLimb
@@ -13768,23 +11896,14 @@ public:
 	TArray< struct FSkelControlProfile >               SkelControlProfiles;                              		// 0x00DC (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	int                                                CurrentProfile;                                   		// 0x00E8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1558 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1558 );
 	};
 
 	void SetSkelControlProfile ( int idx );
 };
 
-UClass* USFXSkelControlLimb::pClassPointer = NULL;
-
 // Class SFXGame.SFXSkelControlSingleBoneByGender
 // 0x0006 (0x00D0 - 0x00CA)
 class USFXSkelControlSingleBoneByGender : public USkelControlSingleBone
@@ -13794,22 +11913,13 @@ public:
 	unsigned long                                      bGenderMatch : 1;                                 		// 0x00CC (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 	unsigned long                                      bFemale : 1;                                      		// 0x00CC (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1559 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1559 );
 	};
 
 };
 
-UClass* USFXSkelControlSingleBoneByGender::pClassPointer = NULL;
-
 // Class SFXGame.SFXSkelCtrl_AnimatedFootPlacement
 // 0x0037 (0x0118 - 0x00E1)
 class USFXSkelCtrl_AnimatedFootPlacement : public USkelControl_CCD_IK
@@ -13825,22 +11935,13 @@ public:
 	float                                              LastDeltaTime;                                    		// 0x0110 (0x0004) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 	unsigned long                                      bLockFoot : 1;                                    		// 0x0114 (0x0004) [0x0000000000002002] [0x00000001] ( CPF_Const | CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1560 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1560 );
 	};
 
 };
 
-UClass* USFXSkelCtrl_AnimatedFootPlacement::pClassPointer = NULL;
-
 // Class SFXGame.SFXSkelCtrl_FootPlanting
 // 0x0044 (0x0120 - 0x00DC)
 class USFXSkelCtrl_FootPlanting : public USkelControlLimb
@@ -13859,22 +11960,13 @@ public:
 	unsigned long                                      bDoFootLocking : 1;                               		// 0x011C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bLockFoot : 1;                                    		// 0x011C (0x0004) [0x0000000000002002] [0x00000002] ( CPF_Const | CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1561 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1561 );
 	};
 
 };
 
-UClass* USFXSkelCtrl_FootPlanting::pClassPointer = NULL;
-
 // Class SFXGame.SFXSkeletalMeshActor
 // 0x0038 (0x0264 - 0x022C)
 class ASFXSkeletalMeshActor : public ASkeletalMeshActor
@@ -13891,16 +11983,9 @@ public:
 	unsigned long                                      UpdateSkelWhenNotRendered : 1;                    		// 0x0260 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned long                                      bHasWrinkles : 1;                                 		// 0x0260 (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1562 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1562 );
 	};
 
 	void BioBaseRemovedFromWorld ( );
@@ -13911,8 +11996,6 @@ public:
 	class USkeletalMeshComponent* GetPrimarySkelMeshComponent ( );
 };
 
-UClass* ASFXSkeletalMeshActor::pClassPointer = NULL;
-
 // Class SFXGame.SFXSkeletalMeshActorMAT
 // 0x0034 (0x026C - 0x0238)
 class ASFXSkeletalMeshActorMAT : public ASkeletalMeshActorMAT
@@ -13927,16 +12010,9 @@ public:
 	unsigned long                                      UpdateSkelWhenNotRendered : 1;                    		// 0x0268 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bHasWrinkles : 1;                                 		// 0x0268 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1563 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1563 );
 	};
 
 	void BioBaseRemovedFromWorld ( );
@@ -13944,8 +12020,6 @@ public:
 	void FellOutOfWorld ( class UClass* dmgType );
 };
 
-UClass* ASFXSkeletalMeshActorMAT::pClassPointer = NULL;
-
 // Class SFXGame.SFXStuntActor
 // 0x0022 (0x0218 - 0x01F6)
 class ASFXStuntActor : public AActor
@@ -13964,16 +12038,9 @@ public:
 	unsigned long                                      m_bActive : 1;                                    		// 0x0214 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 	unsigned long                                      bCausesPlayerPortArms : 1;                        		// 0x0214 (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1564 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1564 );
 	};
 
 	void SetHeadGearVisibility ( unsigned long bShow );
@@ -13994,8 +12061,6 @@ public:
 	void OnSetAimTarget ( class USFXSeqAct_SetAimTarget* inAction );
 };
 
-UClass* ASFXStuntActor::pClassPointer = NULL;
-
 // Class SFXGame.BioPathNodeVolume
 // 0x001E (0x024A - 0x022C)
 class ABioPathNodeVolume : public AVolume
@@ -14012,22 +12077,13 @@ public:
 	unsigned char                                      eAlignment;                                       		// 0x0248 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      ePathNodeGenerator;                               		// 0x0249 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1565 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1565 );
 	};
 
 };
 
-UClass* ABioPathNodeVolume::pClassPointer = NULL;
-
 // Class SFXGame.BioTierInfo
 // 0x0018 (0x0054 - 0x003C)
 class UBioTierInfo : public UObject
@@ -14042,22 +12098,13 @@ public:
 	unsigned long                                      IsDynamic : 1;                                    		// 0x0050 (0x0004) [0x0000000000000000] [0x00000008] 
 	unsigned long                                      ValidCurrentTrigger : 1;                          		// 0x0050 (0x0004) [0x0000000000000000] [0x00000010] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1566 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1566 );
 	};
 
 };
 
-UClass* UBioTierInfo::pClassPointer = NULL;
-
 // Class SFXGame.BioTierManager
 // 0x0025 (0x0061 - 0x003C)
 class UBioTierManager : public UObject
@@ -14069,16 +12116,9 @@ public:
 	unsigned long                                      bReevaluateStreaming : 1;                         		// 0x005C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned char                                      FloorTierIndex;                                   		// 0x0060 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1567 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1567 );
 	};
 
 	void ConvertPlotStreaming ( struct FName fnVirtualChunk, TArray< struct FPlotStreamingElement >* aRealChunks );
@@ -14092,8 +12132,6 @@ public:
 	unsigned char GetNumTiers ( );
 };
 
-UClass* UBioTierManager::pClassPointer = NULL;
-
 // Class SFXGame.BioTriggerStream
 // 0x002D (0x0259 - 0x022C)
 class ABioTriggerStream : public ATriggerVolume
@@ -14110,16 +12148,9 @@ public:
 	unsigned long                                      m_bIgnoreForStreamingCoverage : 1;                		// 0x0254 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned char                                      Tier;                                             		// 0x0258 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1568 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1568 );
 	};
 
 	void eventUnTouch ( class AActor* Other );
@@ -14130,8 +12161,6 @@ public:
 	void DoTouch ( class AActor* Other );
 };
 
-UClass* ABioTriggerStream::pClassPointer = NULL;
-
 // Class SFXGame.BioWorldInfo
 // 0x0181 (0x07D3 - 0x0652)
 class ABioWorldInfo : public AWorldInfo
@@ -14214,16 +12243,9 @@ public:
 	unsigned char                                      m_lstBrowserAlerts[ 0xA ];                        		// 0x07C8 (0x000A) [0x0000000000002000]              ( CPF_Transient )
 	unsigned char                                      m_nJournalSortMethod;                             		// 0x07D2 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1569 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1569 );
 	};
 
 	void MakeLevelLive ( );
@@ -14284,8 +12306,6 @@ public:
 	void SetStreamingState ( struct FName StateName, unsigned long bValue );
 };
 
-UClass* ABioWorldInfo::pClassPointer = NULL;
-
 // Class SFXGame.SFXGalaxyMapGameData
 // 0x0354 (0x0390 - 0x003C)
 class USFXGalaxyMapGameData : public UObject
@@ -14298,24 +12318,15 @@ public:
 	struct FSFXGalaxyTemplates_Galaxy                  GalaxyTemplates;                                  		// 0x02D0 (0x0090) [0x0000000000000001]              ( CPF_Edit )
 	struct FSFXGalaxyTemplates_SystemScanning          ScanningTemplates;                                		// 0x0360 (0x0030) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1570 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1570 );
 	};
 
 	void ClearPersistentLevelReferences ( );
 	void CachePersistentLevelReferences ( );
 };
 
-UClass* USFXGalaxyMapGameData::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameChoiceGUIData
 // 0x0035 (0x0071 - 0x003C)
 class USFXGameChoiceGUIData : public UObject
@@ -14332,16 +12343,9 @@ public:
 	unsigned long                                      m_ShowOptionalPane : 1;                           		// 0x006C (0x0004) [0x0000000000004001] [0x00000001] ( CPF_Edit | CPF_Config )
 	unsigned char                                      m_eOptionalPaneResourceType;                      		// 0x0070 (0x0001) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1571 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1571 );
 	};
 
 	void RemoveTokenMapping ( int nTokenID, struct FSFXChoiceEntry* Data );
@@ -14352,8 +12356,6 @@ public:
 	void SetDisplayText ( void* srTitle, void* srSubTitle, void* srAText, void* srBText );
 };
 
-UClass* USFXGameChoiceGUIData::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameChoiceGUIData_PRCShop
 // 0x000F (0x0080 - 0x0071)
 class USFXGameChoiceGUIData_PRCShop : public USFXGameChoiceGUIData
@@ -14361,23 +12363,14 @@ class USFXGameChoiceGUIData_PRCShop : public USFXGameChoiceGUIData
 public:
 	TArray< struct FSFXChoiceEntryNoStrRef >           lstChoicesNoStrRef;                               		// 0x0074 (0x000C) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1572 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1572 );
 	};
 
 	void AddChoiceNoStrRef ( struct FSFXChoiceEntryNoStrRef oChoice );
 };
 
-UClass* USFXGameChoiceGUIData_PRCShop::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIData_Elevator
 // 0x0033 (0x00A4 - 0x0071)
 class USFXGUIData_Elevator : public USFXGameChoiceGUIData
@@ -14391,24 +12384,15 @@ public:
 	void*                                              srDefaultAButtonText;                             		// 0x009C (0x0004) [0x0000000000004000]              ( CPF_Config )
 	void*                                              srDefaultBButtonText;                             		// 0x00A0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1573 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1573 );
 	};
 
 	void DestinationDescString ( class USFXGUIMovie* Elevator, struct FElevatorDestinationData Destination, struct FString* Desc );
 	void DestinationTitleString ( class USFXGUIMovie* Elevator, struct FElevatorDestinationData Destination, struct FString* Title );
 };
 
-UClass* USFXGUIData_Elevator::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIData_Store
 // 0x015C (0x01CD - 0x0071)
 class USFXGUIData_Store : public USFXGameChoiceGUIData
@@ -14432,23 +12416,14 @@ public:
 	unsigned long                                      bUseChoiceNameAsConfirmationMessage : 1;          		// 0x01C8 (0x0004) [0x0000000000004000] [0x00000002] ( CPF_Config )
 	unsigned char                                      ItemType;                                         		// 0x01CC (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1574 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1574 );
 	};
 
 	bool IsStoreDiscovered ( );
 };
 
-UClass* USFXGUIData_Store::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIData_Terminal
 // 0x0033 (0x00A4 - 0x0071)
 class USFXGUIData_Terminal : public USFXGameChoiceGUIData
@@ -14462,22 +12437,13 @@ public:
 	void*                                              srDefaultAButtonText;                             		// 0x009C (0x0004) [0x0000000000004000]              ( CPF_Config )
 	void*                                              srDefaultBButtonText;                             		// 0x00A0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1575 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1575 );
 	};
 
 };
 
-UClass* USFXGUIData_Terminal::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_MainMenu_Message
 // 0x003E (0x007A - 0x003C)
 class USFXGUI_MainMenu_Message : public UObject
@@ -14496,16 +12462,9 @@ public:
 	unsigned char                                      Status;                                           		// 0x0078 (0x0001) [0x0000000000000000]              
 	unsigned char                                      MessageType;                                      		// 0x0079 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1576 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1576 );
 	};
 
 	void AS_SetDataLoadStatus ( int nStatus );
@@ -14519,8 +12478,6 @@ public:
 	void OnMessageDataLoaded ( class USFXGUI_MainMenu_Message* aMessageThatFinishedLoading );
 };
 
-UClass* USFXGUI_MainMenu_Message::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_MainMenu_RightComputer
 // 0x0064 (0x00A0 - 0x003C)
 class USFXGUI_MainMenu_RightComputer : public UObject
@@ -14540,16 +12497,9 @@ public:
 	int                                                MaxNumberOfImages;                                		// 0x0098 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	unsigned long                                      bComputerOpen : 1;                                		// 0x009C (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1577 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1577 );
 	};
 
 	void FailImageAssets ( );
@@ -14596,8 +12546,6 @@ public:
 	void OnComputerDisplayRegistered ( );
 };
 
-UClass* USFXGUI_MainMenu_RightComputer::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIMovie
 // 0x0106 (0x0261 - 0x015B)
 class USFXGUIMovie : public UGFxMovie
@@ -14642,16 +12590,9 @@ public:
 	unsigned long                                      m_InputEnabled : 1;                               		// 0x025C (0x0004) [0x0000000000000000] [0x00020000] 
 	unsigned char                                      ScreenLayout;                                     		// 0x0260 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1578 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1578 );
 	};
 
 	void SetBackgroundAlpha ( float F );
@@ -14733,8 +12674,6 @@ public:
 	bool OnMovieClosedDelegate ( class USFXGUIMovie* i_ScreenToClose );
 };
 
-UClass* USFXGUIMovie::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIMovieLegacyAdapter
 // 0x002C (0x028D - 0x0261)
 class USFXGUIMovieLegacyAdapter : public USFXGUIMovie
@@ -14750,16 +12689,9 @@ public:
 	unsigned long                                      bPipeDirectInputToGFx : 1;                        		// 0x0288 (0x0004) [0x0000000000000000] [0x00000004] 
 	unsigned char                                      eGameMode;                                        		// 0x028C (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1579 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1579 );
 	};
 
 	void QueueCommand ( struct FBioSFQueuedCommand* stQueuedCommand );
@@ -14793,8 +12725,6 @@ public:
 	void eventUpdate ( float fDeltaT );
 };
 
-UClass* USFXGUIMovieLegacyAdapter::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_Options
 // 0x00E1 (0x036E - 0x028D)
 class UBioSFHandler_Options : public USFXGUIMovieLegacyAdapter
@@ -14833,16 +12763,9 @@ public:
 	unsigned char                                      GuiMode;                                          		// 0x036C (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 	unsigned char                                      CachedDifficulty;                                 		// 0x036D (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1580 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1580 );
 	};
 
 	void SaveAndExit ( );
@@ -14878,8 +12801,6 @@ public:
 	void AddTelem ( unsigned char eOptionId, int Value, TArray< struct FTelemetryAttribute >* Attributes, struct FString* TelemetryKey );
 };
 
-UClass* UBioSFHandler_Options::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_OptionsObject
 // 0x0001 (0x003D - 0x003C)
 class USFXGUI_OptionsObject : public UObject
@@ -14887,16 +12808,9 @@ class USFXGUI_OptionsObject : public UObject
 public:
 	unsigned char                                      OptionId;                                         		// 0x003C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1581 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1581 );
 	};
 
 	void eventResetToDefault ( );
@@ -14909,8 +12823,6 @@ public:
 	bool eventOptionIsAvailable ( );
 };
 
-UClass* USFXGUI_OptionsObject::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_Option_LanguageBase
 // 0x0018 (0x0055 - 0x003D)
 class USFXGUI_Option_LanguageBase : public USFXGUI_OptionsObject
@@ -14921,16 +12833,9 @@ public:
 	unsigned long                                      bInitialized : 1;                                 		// 0x0050 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned char                                      LanguageType;                                     		// 0x0054 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1582 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1582 );
 	};
 
 	void GetAvailableSKULanguages ( TArray< struct FLanguageOptionInfo >* aReturnLangs );
@@ -14943,8 +12848,6 @@ public:
 	bool eventOptionIsAvailable ( );
 };
 
-UClass* USFXGUI_Option_LanguageBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_Option_SpeechLanguage
 // 0x000F (0x0064 - 0x0055)
 class USFXGUI_Option_SpeechLanguage : public USFXGUI_Option_LanguageBase
@@ -14952,16 +12855,9 @@ class USFXGUI_Option_SpeechLanguage : public USFXGUI_Option_LanguageBase
 public:
 	struct FString                                     CurrentTextLanguage;                              		// 0x0058 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1583 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1583 );
 	};
 
 	void GetAvailableSKULanguages ( TArray< struct FLanguageOptionInfo >* aReturnLangs );
@@ -14969,24 +12865,15 @@ public:
 	bool eventOptionIsAvailable ( );
 };
 
-UClass* USFXGUI_Option_SpeechLanguage::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_Option_TextLanguage
 // 0x0000 (0x0055 - 0x0055)
 class USFXGUI_Option_TextLanguage : public USFXGUI_Option_LanguageBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1584 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1584 );
 	};
 
 	void GetAvailableSKULanguages ( TArray< struct FLanguageOptionInfo >* aReturnLangs );
@@ -14999,8 +12886,6 @@ public:
 	bool eventOptionIsAvailable ( );
 };
 
-UClass* USFXGUI_Option_TextLanguage::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_Reticle
 // 0x006F (0x02FC - 0x028D)
 class USFXSFHandler_Reticle : public USFXGUIMovieLegacyAdapter
@@ -15027,16 +12912,9 @@ public:
 	unsigned long                                      m_bSelectionInvalidated : 1;                      		// 0x02F8 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      m_bReticleVisible : 1;                            		// 0x02F8 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1585 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1585 );
 	};
 
 	void AS_CleanupReferences ( );
@@ -15055,8 +12933,6 @@ public:
 	void eventOnPanelRemoved ( );
 };
 
-UClass* USFXSFHandler_Reticle::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_WeaponReticleBase
 // 0x0020 (0x008C - 0x006C)
 class USFXGUI_WeaponReticleBase : public UGFxValue
@@ -15080,16 +12956,9 @@ public:
 	unsigned long                                      m_bScriptUpdate : 1;                              		// 0x0088 (0x0004) [0x0000000000000001] [0x00000100] ( CPF_Edit )
 	unsigned long                                      m_bSubscribeToImpacts : 1;                        		// 0x0088 (0x0004) [0x0000000000000001] [0x00000200] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1586 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1586 );
 	};
 
 	void eventSetWeapon ( class ABioPawn* aPawn );
@@ -15107,8 +12976,6 @@ public:
 	void SetReticleVisible ( unsigned long bVisible, unsigned long bInstant );
 };
 
-UClass* USFXGUI_WeaponReticleBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_CrosshairReticle
 // 0x0030 (0x00BC - 0x008C)
 class USFXGUI_CrosshairReticle : public USFXGUI_WeaponReticleBase
@@ -15125,16 +12992,9 @@ public:
 	float                                              m_fCrosshairAccuracyModifier;                     		// 0x00B4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	unsigned long                                      m_fCacheTargetInSights : 1;                       		// 0x00B8 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1587 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1587 );
 	};
 
 	void AS_TriggerImpactVisualization ( );
@@ -15145,8 +13005,6 @@ public:
 	void eventPerformReticleShow ( unsigned long bInstant );
 };
 
-UClass* USFXGUI_CrosshairReticle::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIHelper_ConsoleKeyboard
 // 0x0038 (0x0074 - 0x003C)
 class USFXGUIHelper_ConsoleKeyboard : public UObject
@@ -15159,16 +13017,9 @@ public:
 	struct FScriptDelegate                             __OnKeyboardEntryComplete__Delegate;              		// 0x0064 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	unsigned long                                      bKeyboardVisible : 1;                             		// 0x0070 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1588 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1588 );
 	};
 
 	void eventKeyboardEntryComplete ( unsigned long EntryOK, struct FString EntryText );
@@ -15176,8 +13027,6 @@ public:
 	void OnKeyboardEntryComplete ( unsigned long EntryOK, struct FString EntryText );
 };
 
-UClass* USFXGUIHelper_ConsoleKeyboard::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIInteraction
 // 0x0365 (0x03D5 - 0x0070)
 class USFXGUIInteraction : public UGFxInteraction
@@ -15283,16 +13132,9 @@ public:
 	unsigned long                                      HACK_IgnoreTurnBlackScreenOffForMP : 1;           		// 0x03D0 (0x0004) [0x0000000000000000] [0x00000010] 
 	unsigned char                                      m_eLastBrowserWheelSubPage;                       		// 0x03D4 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1589 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1589 );
 	};
 
 	void MPToggleReady ( class APlayerController* oPlayerController );
@@ -15431,24 +13273,15 @@ public:
 	void OnCloseCallback ( );
 };
 
-UClass* USFXGUIInteraction::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_Splash
 // 0x0000 (0x0261 - 0x0261)
 class UBioSFHandler_Splash : public USFXGUIMovie
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1590 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1590 );
 	};
 
 	void SetBackgroundAlpha ( float F );
@@ -15530,8 +13363,6 @@ public:
 	bool OnMovieClosedDelegate ( class USFXGUIMovie* i_ScreenToClose );
 };
 
-UClass* UBioSFHandler_Splash::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_SplashScreen
 // 0x0043 (0x02A4 - 0x0261)
 class USFXGUI_SplashScreen : public UBioSFHandler_Splash
@@ -15556,16 +13387,9 @@ public:
 	unsigned long                                      bPressedStart : 1;                                		// 0x02A0 (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned long                                      bWaitingForOrigin : 1;                            		// 0x02A0 (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1591 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1591 );
 	};
 
 	void Callback_NoLoginStart ( unsigned long bAPressed, int Context );
@@ -15590,24 +13414,15 @@ public:
 	bool eventHandleInputEvent ( unsigned char Event, float fValue );
 };
 
-UClass* USFXGUI_SplashScreen::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_PCSplashScreen
 // 0x0000 (0x02A4 - 0x02A4)
 class USFXGUI_PCSplashScreen : public USFXGUI_SplashScreen
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1592 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1592 );
 	};
 
 	void Callback_NoLoginStart ( unsigned long bAPressed, int Context );
@@ -15632,8 +13447,6 @@ public:
 	bool eventHandleInputEvent ( unsigned char Event, float fValue );
 };
 
-UClass* USFXGUI_PCSplashScreen::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_Credits
 // 0x0080 (0x02E1 - 0x0261)
 class USFXGUI_Credits : public USFXGUIMovie
@@ -15669,16 +13482,9 @@ public:
 	unsigned long                                      m_bGameWasUsingVSync : 1;                         		// 0x02DC (0x0004) [0x0000000000002000] [0x00000040] ( CPF_Transient )
 	unsigned char                                      m_eFlashingCreditState;                           		// 0x02E0 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1593 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1593 );
 	};
 
 	void ScrollToPosition ( float fScrollPct );
@@ -15709,8 +13515,6 @@ public:
 	void OnCreditsFinished ( class USFXGUI_Credits* creditsMovie );
 };
 
-UClass* USFXGUI_Credits::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_Elevator
 // 0x0027 (0x0288 - 0x0261)
 class USFXGUI_Elevator : public USFXGUIMovie
@@ -15727,16 +13531,9 @@ public:
 	unsigned long                                      bIsScriptLoaded : 1;                              		// 0x0284 (0x0004) [0x0000000000002000] [0x00000010] ( CPF_Transient )
 	unsigned long                                      bDestinationRequested : 1;                        		// 0x0284 (0x0004) [0x0000000000002000] [0x00000020] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1594 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1594 );
 	};
 
 	void eventASAddDestination ( unsigned long KeepAlive, struct FString Title, struct FString SubTitle, struct FString Desc, struct FString Image, unsigned long Default, unsigned long Able );
@@ -15756,8 +13553,6 @@ public:
 	void OnRequestExitDelegate ( );
 };
 
-UClass* USFXGUI_Elevator::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_JournalCodex
 // 0x00BB (0x031C - 0x0261)
 class USFXGUI_JournalCodex : public USFXGUIMovie
@@ -15796,16 +13591,9 @@ public:
 	void*                                              MarkAllViewedText;                                		// 0x0314 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	void*                                              ViewText;                                         		// 0x0318 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1595 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1595 );
 	};
 
 	void eventAS_MarkAllViewedConfirmed ( );
@@ -15833,8 +13621,6 @@ public:
 	bool eventHandleInputEvent ( unsigned char Event, float fValue );
 };
 
-UClass* USFXGUI_JournalCodex::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_Leaderboard
 // 0x003F (0x02A0 - 0x0261)
 class USFXGUI_Leaderboard : public USFXGUIMovie
@@ -15850,16 +13636,9 @@ public:
 	int                                                SeamlessRankToSelect;                             		// 0x0298 (0x0004) [0x0000000000000000]              
 	float                                              StartTime;                                        		// 0x029C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1596 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1596 );
 	};
 
 	struct FString GetLocalUsername ( );
@@ -15889,8 +13668,6 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* USFXGUI_Leaderboard::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_Manual
 // 0x00AF (0x0310 - 0x0261)
 class USFXGUI_Manual : public USFXGUIMovie
@@ -15920,16 +13697,9 @@ public:
 	unsigned long                                      m_bInitialized : 1;                               		// 0x030C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned long                                      m_bOpenedFromMainMenu : 1;                        		// 0x030C (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1597 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1597 );
 	};
 
 	void eventAS_SetDetails ( struct FString sInfo, struct FString sImgResource );
@@ -15960,8 +13730,6 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* USFXGUI_Manual::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_Markers
 // 0x001B (0x027C - 0x0261)
 class USFXGUI_Markers : public USFXGUIMovie
@@ -15972,16 +13740,9 @@ public:
 	class AActor*                                      ObjectiveTextActor;                               		// 0x0274 (0x0004) [0x0000000000000000]              
 	float                                              TextStayUpDuration;                               		// 0x0278 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1598 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1598 );
 	};
 
 	void ASFadeOutObjectiveText ( );
@@ -16005,8 +13766,6 @@ public:
 	void AddMarker ( class AActor* NewMarkerActor );
 };
 
-UClass* USFXGUI_Markers::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_MPScoretags
 // 0x0027 (0x0288 - 0x0261)
 class USFXGUI_MPScoretags : public USFXGUIMovie
@@ -16020,16 +13779,9 @@ public:
 	float                                              ScreenLocationX;                                  		// 0x0280 (0x0004) [0x0000000000000000]              
 	float                                              ScreenLocationY;                                  		// 0x0284 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1599 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1599 );
 	};
 
 	void AS_SetScoreTagText ( struct FString ScoreText );
@@ -16040,8 +13792,6 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* USFXGUI_MPScoretags::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_Store
 // 0x01FF (0x0460 - 0x0261)
 class USFXGUI_Store : public USFXGUIMovie
@@ -16096,16 +13846,9 @@ public:
 	unsigned long                                      bResetTalents : 1;                                		// 0x045C (0x0004) [0x0000000000000000] [0x00000100] 
 	unsigned long                                      bInNestedStore : 1;                               		// 0x045C (0x0004) [0x0000000000000000] [0x00000200] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1600 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1600 );
 	};
 
 	struct FString GetStoreHeaderImageRef ( );
@@ -16157,8 +13900,6 @@ public:
 	void OnCloseCallback ( );
 };
 
-UClass* USFXGUI_Store::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_Terminal
 // 0x002F (0x0290 - 0x0261)
 class USFXGUI_Terminal : public USFXGUIMovie
@@ -16174,16 +13915,9 @@ public:
 	unsigned long                                      bIsFlashLoaded : 1;                               		// 0x028C (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 	unsigned long                                      bIsScriptLoaded : 1;                              		// 0x028C (0x0004) [0x0000000000002000] [0x00000010] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1601 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1601 );
 	};
 
 	void eventASAddSelectionTitles ( struct FString sTitle, struct FString sDesc, unsigned long bDisabled );
@@ -16203,8 +13937,6 @@ public:
 	void OnRequestExitCallback ( );
 };
 
-UClass* USFXGUI_Terminal::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIMovieKismet
 // 0x0013 (0x0274 - 0x0261)
 class USFXGUIMovieKismet : public USFXGUIMovie
@@ -16215,16 +13947,9 @@ public:
 	unsigned long                                      CloseRequested : 1;                               		// 0x0270 (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned long                                      UnloadOnClose : 1;                                		// 0x0270 (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1602 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1602 );
 	};
 
 	void eventOnClose ( );
@@ -16233,8 +13958,6 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* USFXGUIMovieKismet::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_MainMenu_RTT
 // 0x010E (0x0382 - 0x0274)
 class USFXGUI_MainMenu_RTT : public USFXGUIMovieKismet
@@ -16294,16 +14017,9 @@ public:
 	unsigned char                                      GameType;                                         		// 0x0380 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 	unsigned char                                      PendingCommand;                                   		// 0x0381 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1603 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1603 );
 	};
 
 	void AS_MenuBack ( );
@@ -16403,8 +14119,6 @@ public:
 	void MsgBoxInputCallback ( unsigned long bAPressed, int Context );
 };
 
-UClass* USFXGUI_MainMenu_RTT::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_MainMenu_RTT_RC
 // 0x000C (0x0280 - 0x0274)
 class USFXGUI_MainMenu_RTT_RC : public USFXGUIMovieKismet
@@ -16412,16 +14126,9 @@ class USFXGUI_MainMenu_RTT_RC : public USFXGUIMovieKismet
 public:
 	struct FString                                     ReplacementTextureSymbol;                         		// 0x0274 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1604 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1604 );
 	};
 
 	void AS_UpdateImageMessage ( struct FString strTitle, struct FString strBody, int nMessageId );
@@ -16441,8 +14148,6 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* USFXGUI_MainMenu_RTT_RC::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_BlackScreen
 // 0x001C (0x02A9 - 0x028D)
 class UBioSFHandler_BlackScreen : public USFXGUIMovieLegacyAdapter
@@ -16454,16 +14159,9 @@ public:
 	float                                              m_FadeTime;                                       		// 0x02A4 (0x0004) [0x0000000000000000]              
 	unsigned char                                      m_eDisplayMode;                                   		// 0x02A8 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1605 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1605 );
 	};
 
 	void eventOnStart ( );
@@ -16473,8 +14171,6 @@ public:
 	void OnPanelAdded ( );
 };
 
-UClass* UBioSFHandler_BlackScreen::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_BrowserWheel
 // 0x0033 (0x02C0 - 0x028D)
 class UBioSFHandler_BrowserWheel : public USFXGUIMovieLegacyAdapter
@@ -16489,16 +14185,9 @@ public:
 	void*                                              srCancel;                                         		// 0x02B8 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	class USFXPowerLevelUpHelper*                      m_Helper;                                         		// 0x02BC (0x0004) [0x0000000004400008]              ( CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1606 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1606 );
 	};
 
 	void AS_SetButtonAdvanceSwap ( unsigned long bMenuAdvanceSwapped );
@@ -16520,8 +14209,6 @@ public:
 	struct FName RedirectTag ( struct FName fnTag );
 };
 
-UClass* UBioSFHandler_BrowserWheel::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_ChoiceGUI
 // 0x006F (0x02FC - 0x028D)
 class UBioSFHandler_ChoiceGUI : public USFXGUIMovieLegacyAdapter
@@ -16545,16 +14232,9 @@ public:
 	int                                                m_nInfoScrollSpeed;                               		// 0x02F4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	unsigned long                                      m_bStopScroll : 1;                                		// 0x02F8 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1607 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1607 );
 	};
 
 	void CleanUpDelegateReferences ( );
@@ -16577,8 +14257,6 @@ public:
 	void InputCallback ( unsigned long bAPressed, int nContext );
 };
 
-UClass* UBioSFHandler_ChoiceGUI::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_PRCShop
 // 0x0010 (0x030C - 0x02FC)
 class USFXSFHandler_PRCShop : public UBioSFHandler_ChoiceGUI
@@ -16587,23 +14265,14 @@ public:
 	TArray< struct FPRCInfo_t >                        PRCInfo;                                          		// 0x02FC (0x000C) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 	class USFXGameChoiceGUIData_PRCShop*               m_ChoiceDataNoStrRef;                             		// 0x0308 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1608 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1608 );
 	};
 
 	void ShowChoiceGUI ( );
 };
 
-UClass* USFXSFHandler_PRCShop::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_Conversation
 // 0x00BB (0x0348 - 0x028D)
 class UBioSFHandler_Conversation : public USFXGUIMovieLegacyAdapter
@@ -16641,16 +14310,9 @@ public:
 	unsigned long                                      m_bWasTriggered : 1;                              		// 0x0344 (0x0004) [0x0000000000002000] [0x00000020] ( CPF_Transient )
 	unsigned long                                      m_bEnforcing16x9 : 1;                             		// 0x0344 (0x0004) [0x0000000000002000] [0x00000040] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1609 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1609 );
 	};
 
 	void eventAS_Enforce16x9 ( unsigned long bTrue );
@@ -16685,8 +14347,6 @@ public:
 	void HighlightDefaultConvSegment ( );
 };
 
-UClass* UBioSFHandler_Conversation::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_PCConversation
 // 0x0010 (0x0358 - 0x0348)
 class UBioSFHandler_PCConversation : public UBioSFHandler_Conversation
@@ -16695,16 +14355,9 @@ public:
 	struct FVector                                     vMouseInput;                                      		// 0x0348 (0x000C) [0x0000000000000000]              
 	float                                              AccumulationDivisor;                              		// 0x0354 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1610 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1610 );
 	};
 
 	void HighlightDefaultConvSegment ( );
@@ -16712,8 +14365,6 @@ public:
 	void OnPanelAdded ( );
 };
 
-UClass* UBioSFHandler_PCConversation::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_DesignerUI
 // 0x009B (0x0328 - 0x028D)
 class UBioSFHandler_DesignerUI : public USFXGUIMovieLegacyAdapter
@@ -16727,16 +14378,9 @@ public:
 	int                                                m_nLayout;                                        		// 0x0320 (0x0004) [0x0000000000000000]              
 	unsigned long                                      m_bCanInvoke : 1;                                 		// 0x0324 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1611 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1611 );
 	};
 
 	void OnPanelAdded ( );
@@ -16760,8 +14404,6 @@ public:
 	void ClearAll ( unsigned long bModal );
 };
 
-UClass* UBioSFHandler_DesignerUI::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_GalaxyMap
 // 0x0227 (0x04B4 - 0x028D)
 class UBioSFHandler_GalaxyMap : public USFXGUIMovieLegacyAdapter
@@ -16834,16 +14476,9 @@ public:
 	unsigned long                                      m_bInitialized : 1;                               		// 0x04B0 (0x0004) [0x0000000000002000] [0x00001000] ( CPF_Transient )
 	unsigned long                                      m_bFullCleanupOnClose : 1;                        		// 0x04B0 (0x0004) [0x0000000000000000] [0x00002000] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1612 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1612 );
 	};
 
 	void eventAS_HidePlanetTag ( int nIndex );
@@ -16904,8 +14539,6 @@ public:
 	void OnCallbackEvent ( );
 };
 
-UClass* UBioSFHandler_GalaxyMap::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_PCGalaxyMap
 // 0x0020 (0x04D4 - 0x04B4)
 class UBioSFHandler_PCGalaxyMap : public UBioSFHandler_GalaxyMap
@@ -16918,16 +14551,9 @@ public:
 	unsigned long                                      bMouseMovementEnabled : 1;                        		// 0x04D0 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 	unsigned long                                      m_bActionTextVisible : 1;                         		// 0x04D0 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1613 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1613 );
 	};
 
 	void AS_SetPCEscapeAction ( struct FString sText );
@@ -16942,8 +14568,6 @@ public:
 	bool eventHandleInputEvent ( unsigned char nEvent, float fValue );
 };
 
-UClass* UBioSFHandler_PCGalaxyMap::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_MainMenu
 // 0x0044 (0x02D1 - 0x028D)
 class UBioSFHandler_MainMenu : public USFXGUIMovieLegacyAdapter
@@ -16968,16 +14592,9 @@ public:
 	unsigned long                                      bProcessedRankChanges : 1;                        		// 0x02CC (0x0004) [0x0000000000000000] [0x00000004] 
 	unsigned char                                      m_CerbConnectState;                               		// 0x02D0 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1614 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1614 );
 	};
 
 	void ProcessRankChangeNotifications ( );
@@ -17017,24 +14634,15 @@ public:
 	void OnPanelAdded ( );
 };
 
-UClass* UBioSFHandler_MainMenu::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_PCMainMenu
 // 0x0000 (0x02D1 - 0x02D1)
 class UBioSFHandler_PCMainMenu : public UBioSFHandler_MainMenu
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1615 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1615 );
 	};
 
 	void ProcessRankChangeNotifications ( );
@@ -17074,8 +14682,6 @@ public:
 	void OnPanelAdded ( );
 };
 
-UClass* UBioSFHandler_PCMainMenu::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_MessageBox
 // 0x005F (0x02EC - 0x028D)
 class UBioSFHandler_MessageBox : public USFXGUIMovieLegacyAdapter
@@ -17104,16 +14710,9 @@ public:
 	unsigned long                                      m_bCurrentlyActive : 1;                           		// 0x02E8 (0x0004) [0x0000000000002000] [0x00000100] ( CPF_Transient )
 	unsigned long                                      m_bPausedPriorToWeaponChoice : 1;                 		// 0x02E8 (0x0004) [0x0000000000002000] [0x00000200] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1616 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1616 );
 	};
 
 	void AS_ShowWeaponChoiceDialog ( unsigned long bSkipTransition );
@@ -17157,24 +14756,15 @@ public:
 	void InputCallback ( unsigned long bAPressed, int nContext );
 };
 
-UClass* UBioSFHandler_MessageBox::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_PCMessageBox
 // 0x0000 (0x02EC - 0x02EC)
 class UBioSFHandler_PCMessageBox : public UBioSFHandler_MessageBox
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1617 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1617 );
 	};
 
 	void AS_ShowWeaponChoiceDialog ( unsigned long bSkipTransition );
@@ -17218,8 +14808,6 @@ public:
 	void InputCallback ( unsigned long bAPressed, int nContext );
 };
 
-UClass* UBioSFHandler_PCMessageBox::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_NewCharacter
 // 0x0215 (0x04A2 - 0x028D)
 class UBioSFHandler_NewCharacter : public USFXGUIMovieLegacyAdapter
@@ -17298,16 +14886,9 @@ public:
 	unsigned char                                      CurrentLookAtTarget;                              		// 0x04A0 (0x0001) [0x0000000000000000]              
 	unsigned char                                      NextLookAtTarget;                                 		// 0x04A1 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1618 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1618 );
 	};
 
 	void SetDefaultFemaleME2SaveProperties ( struct FMorphHeadSaveRecord* InProperties );
@@ -17394,8 +14975,6 @@ public:
 	void OnCloseCallback ( );
 };
 
-UClass* UBioSFHandler_NewCharacter::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_PCNewCharacter
 // 0x0016 (0x04B8 - 0x04A2)
 class UBioSFHandler_PCNewCharacter : public UBioSFHandler_NewCharacter
@@ -17407,16 +14986,9 @@ public:
 	float                                              fLookAtLimit;                                     		// 0x04B0 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bHeadLookEnabled : 1;                             		// 0x04B4 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1619 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1619 );
 	};
 
 	void UpdateLookAtTarget ( );
@@ -17431,8 +15003,6 @@ public:
 	void ClipboardCopy ( struct FString sString );
 };
 
-UClass* UBioSFHandler_PCNewCharacter::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_PCOptions
 // 0x005A (0x03C8 - 0x036E)
 class UBioSFHandler_PCOptions : public UBioSFHandler_Options
@@ -17455,16 +15025,9 @@ public:
 	int                                                CaptureBindIndex;                                 		// 0x03C0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	int                                                CaptureBindNumber;                                		// 0x03C4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1620 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1620 );
 	};
 
 	void RevertSettings ( );
@@ -17490,8 +15053,6 @@ public:
 	void OnPanelAdded ( );
 };
 
-UClass* UBioSFHandler_PCOptions::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_XBoxMessageBox
 // 0x000B (0x0298 - 0x028D)
 class UBioSFHandler_XBoxMessageBox : public USFXGUIMovieLegacyAdapter
@@ -17500,23 +15061,14 @@ public:
 	int                                                nSelectedButton;                                  		// 0x0290 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bMessageBoxVisible : 1;                           		// 0x0294 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1621 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1621 );
 	};
 
 	void DisplayMessageBox ( void* srTitle, void* srMessage, unsigned char nIcon, int nDefaultButton, TArray< void* >* srButtons );
 };
 
-UClass* UBioSFHandler_XBoxMessageBox::pClassPointer = NULL;
-
 // Class SFXGame.BioSkillGame_Base_Handler
 // 0x0057 (0x02E4 - 0x028D)
 class UBioSkillGame_Base_Handler : public USFXGUIMovieLegacyAdapter
@@ -17537,16 +15089,9 @@ public:
 	unsigned long                                      m_bSuccessfulEndGame : 1;                         		// 0x02E0 (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned long                                      m_bCanceled : 1;                                  		// 0x02E0 (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1622 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1622 );
 	};
 
 	void Cancel ( );
@@ -17562,8 +15107,6 @@ public:
 	void OnSuccessCallback ( int n_TimeTaken );
 };
 
-UClass* UBioSkillGame_Base_Handler::pClassPointer = NULL;
-
 // Class SFXGame.BioSkillGame_Bypass_Handler
 // 0x0024 (0x0308 - 0x02E4)
 class UBioSkillGame_Bypass_Handler : public UBioSkillGame_Base_Handler
@@ -17575,16 +15118,9 @@ public:
 	int                                                m_nPCBurnDown;                                    		// 0x0300 (0x0004) [0x0000000000000000]              
 	int                                                m_nConsoleBurnDown;                               		// 0x0304 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1623 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1623 );
 	};
 
 	void OnPanelAdded ( );
@@ -17592,8 +15128,6 @@ public:
 	bool eventHandleInputEvent ( unsigned char Event, float fValue );
 };
 
-UClass* UBioSkillGame_Bypass_Handler::pClassPointer = NULL;
-
 // Class SFXGame.BioSkillGame_Decryption_Handler
 // 0x000C (0x02F0 - 0x02E4)
 class UBioSkillGame_Decryption_Handler : public UBioSkillGame_Base_Handler
@@ -17603,16 +15137,9 @@ public:
 	int                                                m_nPercentGood;                                   		// 0x02E8 (0x0004) [0x0000000000000000]              
 	float                                              m_fSpeed;                                         		// 0x02EC (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1624 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1624 );
 	};
 
 	void OnPanelAdded ( );
@@ -17624,8 +15151,6 @@ public:
 	void onDownPressed ( );
 };
 
-UClass* UBioSkillGame_Decryption_Handler::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_EANetworking
 // 0x00E3 (0x0370 - 0x028D)
 class USFXSFHandler_EANetworking : public USFXGUIMovieLegacyAdapter
@@ -17658,16 +15183,9 @@ public:
 	void*                                              m_srConfirmCodeRedemptionTitle;                   		// 0x0368 (0x0004) [0x0000000000004002]              ( CPF_Const | CPF_Config )
 	void*                                              m_srConfirmCodeRedemptionText;                    		// 0x036C (0x0004) [0x0000000000004002]              ( CPF_Const | CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1625 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1625 );
 	};
 
 	void AS_SetActiveInputField ( struct FString sText );
@@ -17726,8 +15244,6 @@ public:
 	void ShowIntroPage ( );
 };
 
-UClass* USFXSFHandler_EANetworking::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_HUD
 // 0x0441 (0x06CE - 0x028D)
 class USFXSFHandler_HUD : public USFXGUIMovieLegacyAdapter
@@ -17853,16 +15369,9 @@ public:
 	unsigned char                                      m_eCurrentActionIcon;                             		// 0x06CC (0x0001) [0x0000000000000000]              
 	unsigned char                                      m_eCurrentPOIState;                               		// 0x06CD (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1626 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1626 );
 	};
 
 	void AS_SetTargetNuiSpeechEnabled ( unsigned long bEnabled );
@@ -17920,8 +15429,6 @@ public:
 	void OnNotificationCompleted ( int nID );
 };
 
-UClass* USFXSFHandler_HUD::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_Personalization
 // 0x0120 (0x03AD - 0x028D)
 class USFXSFHandler_Personalization : public USFXGUIMovieLegacyAdapter
@@ -17978,16 +15485,9 @@ public:
 	unsigned long                                      m_bGameEffectLoadingComplete : 1;                 		// 0x03A8 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 	unsigned char                                      CombatAppearance;                                 		// 0x03AC (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1627 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1627 );
 	};
 
 	void ASSetDetailedCustomizationVisible ( unsigned long bVisible );
@@ -18031,8 +15531,6 @@ public:
 	void ExternalCallback_OnComplete ( );
 };
 
-UClass* USFXSFHandler_Personalization::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_PowerWheel
 // 0x03CC (0x0659 - 0x028D)
 class USFXSFHandler_PowerWheel : public USFXGUIMovieLegacyAdapter
@@ -18157,16 +15655,9 @@ public:
 	unsigned long                                      m_bSquadChanged : 1;                              		// 0x0654 (0x0004) [0x0000000000000000] [0x00004000] 
 	unsigned char                                      m_ePowerWheelMode;                                		// 0x0658 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1628 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1628 );
 	};
 
 	void AS_ShowWheel ( unsigned long bMakeVisible );
@@ -18229,8 +15720,6 @@ public:
 	void SetWheelVisible ( unsigned long bVisible );
 };
 
-UClass* USFXSFHandler_PowerWheel::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_PCPowerWheel
 // 0x0354 (0x09AD - 0x0659)
 class USFXSFHandler_PCPowerWheel : public USFXSFHandler_PowerWheel
@@ -18261,16 +15750,9 @@ public:
 	unsigned long                                      m_bEvalQuickSlotPowers : 1;                       		// 0x09A8 (0x0004) [0x0000000000000000] [0x00000040] 
 	unsigned char                                      m_ShepardPreviousPhysics;                         		// 0x09AC (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1629 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1629 );
 	};
 
 	void ExInt_CollapsePlayerWeapons ( );
@@ -18307,8 +15789,6 @@ public:
 	void NewSetQuickSlotPower ( int nSlot, int nDraggingIconID, unsigned long bDraggingPower, unsigned long bSilently );
 };
 
-UClass* USFXSFHandler_PCPowerWheel::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_Save
 // 0x00BC (0x0349 - 0x028D)
 class USFXSFHandler_Save : public USFXGUIMovieLegacyAdapter
@@ -18355,16 +15835,9 @@ public:
 	unsigned long                                      bCheckingDataMessageVisible : 1;                  		// 0x0344 (0x0004) [0x0000000000002001] [0x00000008] ( CPF_Edit | CPF_Transient )
 	unsigned char                                      GuiMode;                                          		// 0x0348 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1630 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1630 );
 	};
 
 	void SetLoadSave ( unsigned long bIsSave, unsigned long bLegacySave, unsigned long ME2Import, int nLastGUI, int nLayout, unsigned long bCarreerSelection );
@@ -18388,8 +15861,6 @@ public:
 	void BeginInitializeSaveList ( );
 };
 
-UClass* USFXSFHandler_Save::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_Load
 // 0x00D0 (0x0419 - 0x0349)
 class USFXSFHandler_Load : public USFXSFHandler_Save
@@ -18445,16 +15916,9 @@ public:
 	unsigned long                                      bShowingSearchingCharacterOverlay : 1;            		// 0x0414 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned char                                      LoadMode;                                         		// 0x0418 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1631 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1631 );
 	};
 
 	void eventAS_ScrollDetailsAnalog ( float fScroll );
@@ -18492,8 +15956,6 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* USFXSFHandler_Load::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_Slideshow
 // 0x0063 (0x02F0 - 0x028D)
 class USFXSFHandler_Slideshow : public USFXGUIMovieLegacyAdapter
@@ -18511,16 +15973,9 @@ public:
 	unsigned long                                      m_bCanGoPrev : 1;                                 		// 0x02EC (0x0004) [0x0000000000000000] [0x00000008] 
 	unsigned long                                      m_bCanExit : 1;                                   		// 0x02EC (0x0004) [0x0000000000000000] [0x00000010] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1632 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1632 );
 	};
 
 	void TryExitShow ( );
@@ -18539,8 +15994,6 @@ public:
 	void SlideshowFinished ( class USFXSFHandler_Slideshow* slideshow );
 };
 
-UClass* USFXSFHandler_Slideshow::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIMovieExtension
 // 0x0004 (0x0040 - 0x003C)
 class USFXGUIMovieExtension : public UObject
@@ -18548,16 +16001,9 @@ class USFXGUIMovieExtension : public UObject
 public:
 	int                                                m_nFSHandlerID;                                   		// 0x003C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1633 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1633 );
 	};
 
 	void eventUpdate ( float fDeltaT );
@@ -18568,8 +16014,6 @@ public:
 	void eventOnAdded ( );
 };
 
-UClass* USFXGUIMovieExtension::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIValue_ManualAnimController
 // 0x0038 (0x00A4 - 0x006C)
 class USFXGUIValue_ManualAnimController : public UGFxValue
@@ -18586,16 +16030,9 @@ public:
 	unsigned long                                      IsPlaying : 1;                                    		// 0x00A0 (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned long                                      AbortRequested : 1;                               		// 0x00A0 (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1634 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1634 );
 	};
 
 	void UpdateAnimation ( float DeltaTime );
@@ -18609,8 +16046,6 @@ public:
 	void OnAnimStarted ( );
 };
 
-UClass* USFXGUIValue_ManualAnimController::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIValue_Marker
 // 0x0129 (0x0195 - 0x006C)
 class USFXGUIValue_Marker : public UGFxValue
@@ -18642,16 +16077,9 @@ public:
 	unsigned long                                      TitleVisible : 1;                                 		// 0x0190 (0x0004) [0x0000000000000000] [0x00000020] 
 	unsigned char                                      DefaultPawnAimNodeToAttachTo;                     		// 0x0194 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1635 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1635 );
 	};
 
 	void eventAS_FadeOutTitle ( );
@@ -18675,8 +16103,6 @@ public:
 	void ImmediateInitialize ( class AActor* NewActor, class USFXModule_Marker* Module );
 };
 
-UClass* USFXGUIValue_Marker::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIValue_MarkerGrenade
 // 0x0017 (0x01AC - 0x0195)
 class USFXGUIValue_MarkerGrenade : public USFXGUIValue_Marker
@@ -18687,24 +16113,15 @@ public:
 	class APawn*                                       Player;                                           		// 0x01A4 (0x0004) [0x0000000000000000]              
 	float                                              DisplayRange;                                     		// 0x01A8 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1636 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1636 );
 	};
 
 	void Update ( struct FSFXGUISceneView* SceneView );
 	void Initialize ( );
 };
 
-UClass* USFXGUIValue_MarkerGrenade::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIValue_MarkerHenchman
 // 0x000B (0x01A0 - 0x0195)
 class USFXGUIValue_MarkerHenchman : public USFXGUIValue_Marker
@@ -18713,24 +16130,15 @@ public:
 	class ABioPawn*                                    Henchman;                                         		// 0x0198 (0x0004) [0x0000000000000000]              
 	unsigned long                                      PreviousHenchmanIsDown : 1;                       		// 0x019C (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1637 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1637 );
 	};
 
 	void Update ( struct FSFXGUISceneView* SceneView );
 	void Initialize ( );
 };
 
-UClass* USFXGUIValue_MarkerHenchman::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIValue_MarkerObjective
 // 0x0013 (0x01A8 - 0x0195)
 class USFXGUIValue_MarkerObjective : public USFXGUIValue_Marker
@@ -18741,16 +16149,9 @@ public:
 	class ABioPawn*                                    LocalPlayer;                                      		// 0x01A0 (0x0004) [0x0000000000000000]              
 	unsigned long                                      ShouldPlaySpawn : 1;                              		// 0x01A4 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1638 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1638 );
 	};
 
 	void FadeOutMarker ( );
@@ -18761,8 +16162,6 @@ public:
 	void Initialize ( );
 };
 
-UClass* USFXGUIValue_MarkerObjective::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIValue_MarkerPlayer
 // 0x0023 (0x01B8 - 0x0195)
 class USFXGUIValue_MarkerPlayer : public USFXGUIValue_Marker
@@ -18778,16 +16177,9 @@ public:
 	unsigned long                                      PreviousIconIsVisible : 1;                        		// 0x01B4 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      PreviousPlayerIsDead : 1;                         		// 0x01B4 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1639 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1639 );
 	};
 
 	void* eventGetPlayerTitle ( );
@@ -18798,8 +16190,6 @@ public:
 	void Initialize ( );
 };
 
-UClass* USFXGUIValue_MarkerPlayer::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIValue_PowerIcon
 // 0x00E6 (0x0152 - 0x006C)
 class USFXGUIValue_PowerIcon : public UGFxValue
@@ -18831,16 +16221,9 @@ public:
 	unsigned char                                      eState;                                           		// 0x0150 (0x0001) [0x0000000000000000]              
 	unsigned char                                      eDesiredState;                                    		// 0x0151 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1640 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1640 );
 	};
 
 	void eventCleanup ( );
@@ -18872,8 +16255,6 @@ public:
 	void Hide ( );
 };
 
-UClass* USFXGUIValue_PowerIcon::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIValue_HUDPowerIcon
 // 0x0006 (0x0158 - 0x0152)
 class USFXGUIValue_HUDPowerIcon : public USFXGUIValue_PowerIcon
@@ -18881,16 +16262,9 @@ class USFXGUIValue_HUDPowerIcon : public USFXGUIValue_PowerIcon
 public:
 	unsigned long                                      bCooldownActive : 1;                              		// 0x0154 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1641 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1641 );
 	};
 
 	struct FName eventGetMappedHenchmanPower ( class ABioPawn* pHenchPawn );
@@ -18908,24 +16282,15 @@ public:
 	void ClearIcon ( );
 };
 
-UClass* USFXGUIValue_HUDPowerIcon::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIValue_QuickSlotPowerIcon
 // 0x0000 (0x0152 - 0x0152)
 class USFXGUIValue_QuickSlotPowerIcon : public USFXGUIValue_PowerIcon
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1642 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1642 );
 	};
 
 	void eventCleanup ( );
@@ -18957,8 +16322,6 @@ public:
 	void Hide ( );
 };
 
-UClass* USFXGUIValue_QuickSlotPowerIcon::pClassPointer = NULL;
-
 // Class SFXGame.SFXSaveLoadWidgetProxy
 // 0x0014 (0x0050 - 0x003C)
 class USFXSaveLoadWidgetProxy : public UObject
@@ -18970,16 +16333,9 @@ public:
 	void*                                              NetworkMessage;                                   		// 0x0048 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	unsigned long                                      m_bShowMessage : 1;                               		// 0x004C (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1643 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1643 );
 	};
 
 	void HideNetworkMessage ( unsigned long bDoTransition );
@@ -18991,8 +16347,6 @@ public:
 	void ShowSavingMessage ( unsigned long bDoTransition, void* srMessage );
 };
 
-UClass* USFXSaveLoadWidgetProxy::pClassPointer = NULL;
-
 // Class SFXGame.SFXSF_ReticleBase
 // 0x0030 (0x006C - 0x003C)
 class USFXSF_ReticleBase : public UObject
@@ -19010,16 +16364,9 @@ public:
 	unsigned long                                      m_bVisible : 1;                                   		// 0x0068 (0x0004) [0x0000000000000000] [0x00000008] 
 	unsigned long                                      m_bInTransitionOut : 1;                           		// 0x0068 (0x0004) [0x0000000000000000] [0x00000010] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1644 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1644 );
 	};
 
 	void eventUpdateReticleDisplay ( );
@@ -19030,24 +16377,15 @@ public:
 	void eventSetVisible ( unsigned long bVisible, unsigned long bTransition );
 };
 
-UClass* USFXSF_ReticleBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXSF_ReticleCombatObject
 // 0x0000 (0x006C - 0x006C)
 class USFXSF_ReticleCombatObject : public USFXSF_ReticleBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1645 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1645 );
 	};
 
 	void eventUpdateReticleDisplay ( );
@@ -19058,8 +16396,6 @@ public:
 	void eventSetVisible ( unsigned long bVisible, unsigned long bTransition );
 };
 
-UClass* USFXSF_ReticleCombatObject::pClassPointer = NULL;
-
 // Class SFXGame.SFXSF_ReticleCombatTarget
 // 0x0030 (0x009C - 0x006C)
 class USFXSF_ReticleCombatTarget : public USFXSF_ReticleBase
@@ -19077,24 +16413,15 @@ public:
 	unsigned long                                      m_bPreviouslyInitialized : 1;                     		// 0x0098 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      m_bDoingActionFlourish : 1;                       		// 0x0098 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1646 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1646 );
 	};
 
 	void eventClearReticle ( unsigned long bTransition );
 	void eventSetReticle ( struct FString sSFReticlePath );
 };
 
-UClass* USFXSF_ReticleCombatTarget::pClassPointer = NULL;
-
 // Class SFXGame.SFXWeaponUIData
 // 0x0018 (0x0054 - 0x003C)
 class USFXWeaponUIData : public UObject
@@ -19103,22 +16430,13 @@ public:
 	TArray< struct FSFXWeaponSelectWeaponData >        m_aWeapons;                                       		// 0x003C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	TArray< struct FSFXWeaponModData >                 m_aMods;                                          		// 0x0048 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1647 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1647 );
 	};
 
 };
 
-UClass* USFXWeaponUIData::pClassPointer = NULL;
-
 // Class SFXGame.SFXWeaponUIDataManager
 // 0x006C (0x00A8 - 0x003C)
 class USFXWeaponUIDataManager : public UObject
@@ -19142,16 +16460,9 @@ public:
 	float                                              MaxWeaponLevel;                                   		// 0x00A0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	unsigned long                                      DataIsLoaded : 1;                                 		// 0x00A4 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1648 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1648 );
 	};
 
 	struct FString GetRomanNumeral ( int nLevel );
@@ -19182,8 +16493,6 @@ public:
 	void OnDataLoadedDelegate ( );
 };
 
-UClass* USFXWeaponUIDataManager::pClassPointer = NULL;
-
 // Class SFXGame.BioCameraZoom
 // 0x0064 (0x00A0 - 0x003C)
 class UBioCameraZoom : public UObject
@@ -19202,16 +16511,9 @@ public:
 	float                                              m_fFocusDistance;                                 		// 0x0098 (0x0004) [0x0000000000000000]              
 	float                                              m_fFocusDistanceTarget;                           		// 0x009C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1649 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1649 );
 	};
 
 	void ModifyPostProcessSettings ( struct FPostProcessSettings* PPSettings );
@@ -19220,8 +16522,6 @@ public:
 	void Focus ( float fDistance, class ABioWorldInfo* pWorldInfo );
 };
 
-UClass* UBioCameraZoom::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode
 // 0x00B0 (0x00EC - 0x003C)
 class USFXCameraMode : public UObject
@@ -19254,16 +16554,9 @@ public:
 	unsigned long                                      bAutoCancelCameraRecentering : 1;                 		// 0x00E8 (0x0004) [0x0000000000000000] [0x00000100] 
 	unsigned long                                      bRecenterCancelled : 1;                           		// 0x00E8 (0x0004) [0x0000000000000000] [0x00000200] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1650 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1650 );
 	};
 
 	void ProcessViewRotation ( float DeltaTime, struct FRotator* OutViewRotation, struct FRotator* OutDeltaRot );
@@ -19289,8 +16582,6 @@ public:
 	void eventModifyPostProcessSettings ( struct FPostProcessSettings* PPSettings );
 };
 
-UClass* USFXCameraMode::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraInput
 // 0x001C (0x0058 - 0x003C)
 class USFXCameraInput : public UObject
@@ -19305,22 +16596,13 @@ public:
 	unsigned long                                      bSwitchSticks : 1;                                		// 0x0054 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned long                                      bClampMouse : 1;                                  		// 0x0054 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1651 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1651 );
 	};
 
 };
 
-UClass* USFXCameraInput::pClassPointer = NULL;
-
 // Class SFXGame.BioCameraUtility
 // 0x0004 (0x00F0 - 0x00EC)
 class UBioCameraUtility : public USFXCameraMode
@@ -19328,44 +16610,26 @@ class UBioCameraUtility : public USFXCameraMode
 public:
 	float                                              m_fCameraCollisionTestPointRange;                 		// 0x00EC (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1652 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1652 );
 	};
 
 };
 
-UClass* UBioCameraUtility::pClassPointer = NULL;
-
 // Class SFXGame.BioCameraBehavior
 // 0x0000 (0x00F0 - 0x00F0)
 class UBioCameraBehavior : public UBioCameraUtility
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1653 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1653 );
 	};
 
 };
 
-UClass* UBioCameraBehavior::pClassPointer = NULL;
-
 // Class SFXGame.BioCameraBehaviorConversation
 // 0x006C (0x015C - 0x00F0)
 class UBioCameraBehaviorConversation : public UBioCameraBehavior
@@ -19388,16 +16652,9 @@ public:
 	unsigned long                                      m_bDOFSettingDisabled : 1;                        		// 0x0158 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned long                                      m_bIdleCamEnabled : 1;                            		// 0x0158 (0x0004) [0x0000000000004000] [0x00000002] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1654 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1654 );
 	};
 
 	void eventModifyPostProcessSettings ( struct FPostProcessSettings* PPSettings );
@@ -19410,8 +16667,6 @@ public:
 	void Tick ( float TimeDelta );
 };
 
-UClass* UBioCameraBehaviorConversation::pClassPointer = NULL;
-
 // Class SFXGame.BioCameraBehaviorGalaxy
 // 0x0340 (0x0430 - 0x00F0)
 class UBioCameraBehaviorGalaxy : public UBioCameraBehavior
@@ -19526,16 +16781,9 @@ public:
 	unsigned long                                      m_bSystemSunVisible : 1;                          		// 0x042C (0x0004) [0x0000000000002000] [0x00001000] ( CPF_Transient )
 	unsigned long                                      m_bCanDoSystemScan : 1;                           		// 0x042C (0x0004) [0x0000000000002000] [0x00002000] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1655 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1655 );
 	};
 
 	class UBioPlanet* GetCurrentPlanet ( );
@@ -19579,8 +16827,6 @@ public:
 	void Tick ( float TimeDelta );
 };
 
-UClass* UBioCameraBehaviorGalaxy::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraModifier_ScreenShake
 // 0x0087 (0x00DC - 0x0055)
 class USFXCameraModifier_ScreenShake : public UCameraModifier
@@ -19589,16 +16835,9 @@ public:
 	TArray< struct FScreenShakeStruct >                Shakes;                                           		// 0x0058 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	struct FScreenShakeStruct                          TestShake;                                        		// 0x0064 (0x0078) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1656 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1656 );
 	};
 
 	bool ModifyCamera ( class ACamera* Camera, float DeltaTime, struct FTPOV* OutPOV );
@@ -19612,8 +16851,6 @@ public:
 	void RemoveAllScreenShakes ( );
 };
 
-UClass* USFXCameraModifier_ScreenShake::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraNativeBase
 // 0x0068 (0x0490 - 0x0428)
 class ASFXCameraNativeBase : public ACamera
@@ -19633,16 +16870,9 @@ public:
 	unsigned long                                      m_bCameraSwitchEnabled : 1;                       		// 0x048C (0x0004) [0x0000000000000000] [0x00000004] 
 	unsigned long                                      bUseCameraRotation : 1;                           		// 0x048C (0x0004) [0x0000000000000000] [0x00000008] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1657 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1657 );
 	};
 
 	void eventAddScreenShake ( struct FScreenShakeStruct Shake );
@@ -19659,8 +16889,6 @@ public:
 	bool GetTrace ( class AActor** oHit, struct FVector* vLocation, struct FVector* vNormal );
 };
 
-UClass* ASFXCameraNativeBase::pClassPointer = NULL;
-
 // Class SFXGame.BioAiController
 // 0x00A4 (0x0480 - 0x03DC)
 class ABioAiController : public AGameAIController
@@ -19704,16 +16932,9 @@ public:
 	unsigned long                                      bDisableFriendlyNotifications : 1;                		// 0x047C (0x0004) [0x0000000000002000] [0x00000100] ( CPF_Transient )
 	unsigned long                                      bUnaware : 1;                                     		// 0x047C (0x0004) [0x0000000000002000] [0x00000200] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1658 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1658 );
 	};
 
 	void OnLastManStanding ( );
@@ -19800,8 +17021,6 @@ public:
 	void MapName_Hench_Teleport ( float X, float Y );
 };
 
-UClass* ABioAiController::pClassPointer = NULL;
-
 // Class SFXGame.SFXAI_NativeBase
 // 0x0021 (0x04A1 - 0x0480)
 class ASFXAI_NativeBase : public ABioAiController
@@ -19819,16 +17038,9 @@ public:
 	unsigned long                                      CustomReachSpecBlocked : 1;                       		// 0x049C (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 	unsigned char                                      CombatMood;                                       		// 0x04A0 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1659 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1659 );
 	};
 
 	bool eventIsCustomReachSpecBlocked ( class USFXCustomReachSpec* ReachSpec );
@@ -19864,8 +17076,6 @@ public:
 	void eventBioClearCrossLevelReferences ( class ULevel* oLevel );
 };
 
-UClass* ASFXAI_NativeBase::pClassPointer = NULL;
-
 // Class SFXGame.BioCheatManager
 // 0x00C5 (0x0109 - 0x0044)
 class UBioCheatManager : public UCheatManager
@@ -19905,16 +17115,9 @@ public:
 	unsigned long                                      bDebugAllLevels : 1;                              		// 0x0104 (0x0004) [0x0000000000000000] [0x00000010] 
 	unsigned char                                      CurrentProfile;                                   		// 0x0108 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1660 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1660 );
 	};
 
 	void BlazeDlcMountTime ( float nSeconds, int nStallComponent );
@@ -20418,8 +17621,6 @@ public:
 	void ProfileHandler ( );
 };
 
-UClass* UBioCheatManager::pClassPointer = NULL;
-
 // Class SFXGame.BioPlayerInput
 // 0x0192 (0x033D - 0x01AB)
 class UBioPlayerInput : public UPlayerInput
@@ -20470,16 +17671,9 @@ public:
 	unsigned long                                      bUseMouseDampening : 1;                           		// 0x0338 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 	unsigned char                                      bWantsToZoom;                                     		// 0x033C (0x0001) [0x0000000000000004]              ( CPF_Input )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1661 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1661 );
 	};
 
 	void SetFlyCam ( unsigned long bOn );
@@ -20508,8 +17702,6 @@ public:
 	void InputDelegate ( struct FString Alias, unsigned long bPress );
 };
 
-UClass* UBioPlayerInput::pClassPointer = NULL;
-
 // Class SFXGame.BioPlayerSelection
 // 0x0038 (0x0074 - 0x003C)
 class UBioPlayerSelection : public UObject
@@ -20528,16 +17720,9 @@ public:
 	float                                              MaxHighlightRange;                                		// 0x006C (0x0004) [0x0000000000004000]              ( CPF_Config )
 	unsigned long                                      m_bCurrentSelectionIsCombatTarget : 1;            		// 0x0070 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1662 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1662 );
 	};
 
 	void SetSelectionIconMaterialParam ( struct FName Param, int Value );
@@ -20546,8 +17731,6 @@ public:
 	void FindCurrentSelectionTarget ( );
 };
 
-UClass* UBioPlayerSelection::pClassPointer = NULL;
-
 // Class SFXGame.CoverGoalConstraint
 // 0x0004 (0x0040 - 0x003C)
 class UCoverGoalConstraint : public UObject
@@ -20555,24 +17738,15 @@ class UCoverGoalConstraint : public UObject
 public:
 	int                                                ConstraintEvaluationPriority;                     		// 0x003C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1663 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1663 );
 	};
 
 	struct FString eventGetDumpString ( );
 	void eventInit ( class UGoal_AtCover* GoalEvaluator );
 };
 
-UClass* UCoverGoalConstraint::pClassPointer = NULL;
-
 // Class SFXGame.CovGoal_AvoidEnemies
 // 0x000C (0x004C - 0x0040)
 class UCovGoal_AvoidEnemies : public UCoverGoalConstraint
@@ -20580,23 +17754,14 @@ class UCovGoal_AvoidEnemies : public UCoverGoalConstraint
 public:
 	TArray< struct FEnemyData >                        Enemies;                                          		// 0x0040 (0x000C) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1664 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1664 );
 	};
 
 	void eventInit ( class UGoal_AtCover* GoalEvaluator );
 };
 
-UClass* UCovGoal_AvoidEnemies::pClassPointer = NULL;
-
 // Class SFXGame.CovGoal_CombatZones
 // 0x000C (0x004C - 0x0040)
 class UCovGoal_CombatZones : public UCoverGoalConstraint
@@ -20604,23 +17769,14 @@ class UCovGoal_CombatZones : public UCoverGoalConstraint
 public:
 	struct FVector                                     CombatZoneOrigin;                                 		// 0x0040 (0x000C) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1665 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1665 );
 	};
 
 	void eventInit ( class UGoal_AtCover* GoalEvaluator );
 };
 
-UClass* UCovGoal_CombatZones::pClassPointer = NULL;
-
 // Class SFXGame.CovGoal_Enemies
 // 0x000C (0x004C - 0x0040)
 class UCovGoal_Enemies : public UCoverGoalConstraint
@@ -20628,23 +17784,14 @@ class UCovGoal_Enemies : public UCoverGoalConstraint
 public:
 	TArray< struct FValidEnemyCacheDatum >             ValidEnemyCache;                                  		// 0x0040 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1666 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1666 );
 	};
 
 	void eventInit ( class UGoal_AtCover* GoalEvaluator );
 };
 
-UClass* UCovGoal_Enemies::pClassPointer = NULL;
-
 // Class SFXGame.CovGoal_GoalProximity
 // 0x0010 (0x0050 - 0x0040)
 class UCovGoal_GoalProximity : public UCoverGoalConstraint
@@ -20655,22 +17802,13 @@ public:
 	float                                              MaxGoalDist;                                      		// 0x0048 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bHardLimits : 1;                                  		// 0x004C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1667 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1667 );
 	};
 
 };
 
-UClass* UCovGoal_GoalProximity::pClassPointer = NULL;
-
 // Class SFXGame.CovGoal_MovementDistance
 // 0x0014 (0x0054 - 0x0040)
 class UCovGoal_MovementDistance : public UCoverGoalConstraint
@@ -20684,22 +17822,13 @@ public:
 	unsigned long                                      bHardConstraint : 1;                              		// 0x0050 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned long                                      bIgnoreCoverOutOfRange : 1;                       		// 0x0050 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1668 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1668 );
 	};
 
 };
 
-UClass* UCovGoal_MovementDistance::pClassPointer = NULL;
-
 // Class SFXGame.CovGoal_TeammateProximity
 // 0x0018 (0x0058 - 0x0040)
 class UCovGoal_TeammateProximity : public UCoverGoalConstraint
@@ -20712,22 +17841,13 @@ public:
 	float                                              fMaxDistancePenalty;                              		// 0x0050 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bRestrictMaxDistance : 1;                         		// 0x0054 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1669 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1669 );
 	};
 
 };
 
-UClass* UCovGoal_TeammateProximity::pClassPointer = NULL;
-
 // Class SFXGame.CovGoal_WeaponRange
 // 0x0018 (0x0058 - 0x0040)
 class UCovGoal_WeaponRange : public UCoverGoalConstraint
@@ -20740,23 +17860,14 @@ public:
 	float                                              fShortWeaponRange;                                		// 0x0050 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bHardConstraint : 1;                              		// 0x0054 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1670 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1670 );
 	};
 
 	void Init ( class UGoal_AtCover* GoalEvaluator );
 };
 
-UClass* UCovGoal_WeaponRange::pClassPointer = NULL;
-
 // Class SFXGame.SFXCovGoal_AvoidHazard
 // 0x0010 (0x0050 - 0x0040)
 class USFXCovGoal_AvoidHazard : public UCoverGoalConstraint
@@ -20765,23 +17876,14 @@ public:
 	TArray< struct FVector >                           Hazards;                                          		// 0x0040 (0x000C) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 	float                                              MaxWeight;                                        		// 0x004C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1671 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1671 );
 	};
 
 	void Init ( class UGoal_AtCover* GoalEvaluator );
 };
 
-UClass* USFXCovGoal_AvoidHazard::pClassPointer = NULL;
-
 // Class SFXGame.SFXCovGoal_AwayFromFriendlies
 // 0x0014 (0x0054 - 0x0040)
 class USFXCovGoal_AwayFromFriendlies : public UCoverGoalConstraint
@@ -20791,23 +17893,14 @@ public:
 	float                                              AvoidDistance;                                    		// 0x004C (0x0004) [0x0000000000000000]              
 	float                                              MaxWeight;                                        		// 0x0050 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1672 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1672 );
 	};
 
 	void Init ( class UGoal_AtCover* GoalEvaluator );
 };
 
-UClass* USFXCovGoal_AwayFromFriendlies::pClassPointer = NULL;
-
 // Class SFXGame.SFXCovGoal_CanFireAtPrimary
 // 0x0014 (0x0054 - 0x0040)
 class USFXCovGoal_CanFireAtPrimary : public UCoverGoalConstraint
@@ -20818,23 +17911,14 @@ public:
 	class AActor*                                      FireTarget;                                       		// 0x004C (0x0004) [0x0000000000000000]              
 	float                                              MaxWeight;                                        		// 0x0050 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1673 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1673 );
 	};
 
 	void Init ( class UGoal_AtCover* GoalEvaluator );
 };
 
-UClass* USFXCovGoal_CanFireAtPrimary::pClassPointer = NULL;
-
 // Class SFXGame.SFXCovGoal_CanFireAtSecondaries
 // 0x0010 (0x0050 - 0x0040)
 class USFXCovGoal_CanFireAtSecondaries : public UCoverGoalConstraint
@@ -20843,23 +17927,14 @@ public:
 	TArray< struct FSecondaryTargetData >              Secondaries;                                      		// 0x0040 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	float                                              MaxWeight;                                        		// 0x004C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1674 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1674 );
 	};
 
 	void Init ( class UGoal_AtCover* GoalEvaluator );
 };
 
-UClass* USFXCovGoal_CanFireAtSecondaries::pClassPointer = NULL;
-
 // Class SFXGame.SFXCovGoal_CoverFromPrimary
 // 0x0014 (0x0054 - 0x0040)
 class USFXCovGoal_CoverFromPrimary : public UCoverGoalConstraint
@@ -20869,23 +17944,14 @@ public:
 	float                                              FlankDot;                                         		// 0x004C (0x0004) [0x0000000000000000]              
 	float                                              MaxWeight;                                        		// 0x0050 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1675 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1675 );
 	};
 
 	void Init ( class UGoal_AtCover* GoalEvaluator );
 };
 
-UClass* USFXCovGoal_CoverFromPrimary::pClassPointer = NULL;
-
 // Class SFXGame.SFXCovGoal_CoverFromSecondaries
 // 0x0014 (0x0054 - 0x0040)
 class USFXCovGoal_CoverFromSecondaries : public UCoverGoalConstraint
@@ -20895,23 +17961,14 @@ public:
 	float                                              FlankDot;                                         		// 0x004C (0x0004) [0x0000000000000000]              
 	float                                              MaxWeight;                                        		// 0x0050 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1676 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1676 );
 	};
 
 	void Init ( class UGoal_AtCover* GoalEvaluator );
 };
 
-UClass* USFXCovGoal_CoverFromSecondaries::pClassPointer = NULL;
-
 // Class SFXGame.SFXCovGoal_FrontArc
 // 0x0008 (0x0048 - 0x0040)
 class USFXCovGoal_FrontArc : public UCoverGoalConstraint
@@ -20920,22 +17977,13 @@ public:
 	float                                              ForwardDot;                                       		// 0x0040 (0x0004) [0x0000000000000000]              
 	float                                              MaxWeight;                                        		// 0x0044 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1677 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1677 );
 	};
 
 };
 
-UClass* USFXCovGoal_FrontArc::pClassPointer = NULL;
-
 // Class SFXGame.SFXCovGoal_NoFriendlyLOF
 // 0x0014 (0x0054 - 0x0040)
 class USFXCovGoal_NoFriendlyLOF : public UCoverGoalConstraint
@@ -20945,23 +17993,14 @@ public:
 	float                                              LOFDistance;                                      		// 0x004C (0x0004) [0x0000000000000000]              
 	float                                              MaxWeight;                                        		// 0x0050 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1678 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1678 );
 	};
 
 	void Init ( class UGoal_AtCover* GoalEvaluator );
 };
 
-UClass* USFXCovGoal_NoFriendlyLOF::pClassPointer = NULL;
-
 // Class SFXGame.Goal_AtCover
 // 0x0028 (0x0078 - 0x0050)
 class UGoal_AtCover : public UPathGoalEvaluator
@@ -20977,16 +18016,9 @@ public:
 	unsigned long                                      MoveTowardsGoalActor : 1;                         		// 0x0074 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned long                                      bIncludePathCost : 1;                             		// 0x0074 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1679 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1679 );
 	};
 
 	struct FString eventGetDumpString ( );
@@ -20996,8 +18028,6 @@ public:
 	void Init ( class ASFXAI_NativeBase* oAI, class AActor* GoalActor, unsigned long bAddPathCost );
 };
 
-UClass* UGoal_AtCover::pClassPointer = NULL;
-
 // Class SFXGame.Goal_AwayFromPosition
 // 0x0024 (0x0074 - 0x0050)
 class UGoal_AwayFromPosition : public UPathGoalEvaluator
@@ -21009,24 +18039,15 @@ public:
 	class ANavigationPoint*                            BestNode;                                         		// 0x006C (0x0004) [0x0000000000000000]              
 	int                                                BestRating;                                       		// 0x0070 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1680 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1680 );
 	};
 
 	void eventRecycle ( );
 	bool FleeFrom ( class APawn* P, struct FVector InAvoidPos, int InMaxDist );
 };
 
-UClass* UGoal_AwayFromPosition::pClassPointer = NULL;
-
 // Class SFXGame.SFXAIPerceptionManager
 // 0x000E (0x0204 - 0x01F6)
 class ASFXAIPerceptionManager : public AActor
@@ -21034,16 +18055,9 @@ class ASFXAIPerceptionManager : public AActor
 public:
 	TArray< struct FSFXAIPerceptionNoise >             Noises;                                           		// 0x01F8 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1681 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1681 );
 	};
 
 	void DelayedNoticeEnemy ( class ABioAiController* AI, class APawn* Enemy, unsigned char Notification, float Delay, struct FName EventName );
@@ -21053,8 +18067,6 @@ public:
 	void FillEnemyList ( class ABioAiController* AI );
 };
 
-UClass* ASFXAIPerceptionManager::pClassPointer = NULL;
-
 // Class SFXGame.SFXGoal_SuppressionPoint
 // 0x0030 (0x0080 - 0x0050)
 class USFXGoal_SuppressionPoint : public UPathGoalEvaluator
@@ -21071,48 +18083,30 @@ public:
 	int                                                NumNodesTested;                                   		// 0x0078 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned long                                      bFlank : 1;                                       		// 0x007C (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1682 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1682 );
 	};
 
 	void eventRecycle ( );
 	bool SuppressPoint ( class APawn* P, class AActor* Target, float SuppressDist, unsigned long bPreferFlank, float fMinDistance );
 };
 
-UClass* USFXGoal_SuppressionPoint::pClassPointer = NULL;
-
 // Class SFXGame.SFXPath_AvoidClaimedCover
 // 0x0000 (0x0044 - 0x0044)
 class USFXPath_AvoidClaimedCover : public UPathConstraint
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1683 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1683 );
 	};
 
 	struct FString eventGetDumpString ( );
 	void eventRecycle ( );
 };
 
-UClass* USFXPath_AvoidClaimedCover::pClassPointer = NULL;
-
 // Class SFXGame.SFXPath_AvoidFireFromCover
 // 0x0010 (0x0054 - 0x0044)
 class USFXPath_AvoidFireFromCover : public UPathConstraint
@@ -21121,48 +18115,30 @@ public:
 	TArray< struct FEnemyCoverInfo >                   EnemyList;                                        		// 0x0044 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	class Asfxai_core*                                 AI;                                               		// 0x0050 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1684 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1684 );
 	};
 
 	void Recycle ( );
 	bool AvoidFireFromCover ( class APawn* P, unsigned long bCheckPlayerOnly );
 };
 
-UClass* USFXPath_AvoidFireFromCover::pClassPointer = NULL;
-
 // Class SFXGame.SFXPath_AvoidPlayer
 // 0x0000 (0x0044 - 0x0044)
 class USFXPath_AvoidPlayer : public UPathConstraint
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1685 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1685 );
 	};
 
 	struct FString eventGetDumpString ( );
 	void eventRecycle ( );
 };
 
-UClass* USFXPath_AvoidPlayer::pClassPointer = NULL;
-
 // Class SFXGame.SFXPath_AwayFromGoal
 // 0x0008 (0x004C - 0x0044)
 class USFXPath_AwayFromGoal : public UPathConstraint
@@ -21171,23 +18147,14 @@ public:
 	class AActor*                                      GoalActor;                                        		// 0x0044 (0x0004) [0x0000000000000000]              
 	float                                              fDistAway;                                        		// 0x0048 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1686 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1686 );
 	};
 
 	bool AwayFromGoal ( class ABioPawn* Pawn, class AActor* Goal, float fDist );
 };
 
-UClass* USFXPath_AwayFromGoal::pClassPointer = NULL;
-
 // Class SFXGame.SFXPath_TowardCombatZone
 // 0x000C (0x0050 - 0x0044)
 class USFXPath_TowardCombatZone : public UPathConstraint
@@ -21195,23 +18162,14 @@ class USFXPath_TowardCombatZone : public UPathConstraint
 public:
 	struct FVector                                     CombatZoneOrigin;                                 		// 0x0044 (0x000C) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1687 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1687 );
 	};
 
 	bool TowardCombatZone ( class ABioPawn* Pawn );
 };
 
-UClass* USFXPath_TowardCombatZone::pClassPointer = NULL;
-
 // Class SFXGame.SFXPath_WithinPlaypen
 // 0x0004 (0x0048 - 0x0044)
 class USFXPath_WithinPlaypen : public UPathConstraint
@@ -21219,23 +18177,14 @@ class USFXPath_WithinPlaypen : public UPathConstraint
 public:
 	unsigned long                                      m_bOnlyAvoidSubtractive : 1;                      		// 0x0044 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1688 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1688 );
 	};
 
 	bool WithinPlaypen ( class ABioPawn* P, unsigned long bAvoidSubtractive );
 };
 
-UClass* USFXPath_WithinPlaypen::pClassPointer = NULL;
-
 // Class SFXGame.BioConversation
 // 0x00CC (0x0108 - 0x003C)
 class UBioConversation : public UObject
@@ -21263,22 +18212,13 @@ public:
 	unsigned long                                      m_bHasSpeechGrammar : 1;                          		// 0x0104 (0x0004) [0x0000000000000000] [0x00000008] 
 	unsigned long                                      m_bUsesRubberMouth : 1;                           		// 0x0104 (0x0004) [0x0000000000000000] [0x00000010] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1689 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1689 );
 	};
 
 };
 
-UClass* UBioConversation::pClassPointer = NULL;
-
 // Class SFXGame.BioConversationController
 // 0x0269 (0x02A5 - 0x003C)
 class UBioConversationController : public UObject
@@ -21377,16 +18317,9 @@ public:
 	unsigned long                                      m_bReplySubtitleOverridden : 1;                   		// 0x02A0 (0x0004) [0x0000000000000000] [0x40000000] 
 	unsigned char                                      m_eControllerType;                                		// 0x02A4 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1690 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1690 );
 	};
 
 	void TrackConvCineModeChanges ( unsigned long bConvEnabled, unsigned long bConvDisabled, unsigned long bCineEnabled, unsigned long bCineDisabled );
@@ -21406,8 +18339,6 @@ public:
 	bool QueueReply ( int nReply );
 };
 
-UClass* UBioConversationController::pClassPointer = NULL;
-
 // Class SFXGame.BioConversationManager
 // 0x0070 (0x00AC - 0x003C)
 class UBioConversationManager : public UObject
@@ -21420,16 +18351,9 @@ public:
 	TArray< class UBioSimpleDialog* >                  m_aSimpleDialogPlayers;                           		// 0x009C (0x000C) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 	unsigned long                                      m_bActivatingConversation : 1;                    		// 0x00A8 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1691 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1691 );
 	};
 
 	void AddSimpleDialog ( class UBioSimpleDialog* pNewDialogObject );
@@ -21442,8 +18366,6 @@ public:
 	class UBioConversationController* GetConversationControllerByResourceID ( int nResourceID );
 };
 
-UClass* UBioConversationManager::pClassPointer = NULL;
-
 // Class SFXGame.BioSimpleDialog
 // 0x0038 (0x0074 - 0x003C)
 class UBioSimpleDialog : public UObject
@@ -21456,16 +18378,9 @@ public:
 	struct FColor                                      SubtitleColor;                                    		// 0x006C (0x0004) [0x0000000000000002]              ( CPF_Const )
 	float                                              LastEventDuration;                                		// 0x0070 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1692 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1692 );
 	};
 
 	struct FSimpleVOEvent GetEvent ( struct FName EventName, void* EventReplyLine, void* EventLine );
@@ -21475,8 +18390,6 @@ public:
 	void PlayDialogLine ( void* DialogLineSr, class ABioPlayerController* ControllerToPlayOn );
 };
 
-UClass* UBioSimpleDialog::pClassPointer = NULL;
-
 // Class SFXGame.BioStage
 // 0x006E (0x0264 - 0x01F6)
 class ABioStage : public AActor
@@ -21497,23 +18410,14 @@ public:
 	unsigned long                                      m_bDOFActive : 1;                                 		// 0x0260 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 	unsigned long                                      m_bDisableProceduralCameraHeightAdjust : 1;       		// 0x0260 (0x0004) [0x0000000000006000] [0x00000010] ( CPF_Transient | CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1693 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1693 );
 	};
 
 	void ProfileStage ( class ABioHUD* HUD );
 };
 
-UClass* ABioStage::pClassPointer = NULL;
-
 // Class SFXGame.BioCustomAction
 // 0x0085 (0x00C1 - 0x003C)
 class UBioCustomAction : public UObject
@@ -21584,16 +18488,9 @@ public:
 	unsigned char                                      OriginalRemoteRole;                               		// 0x00BF (0x0001) [0x0000000000000000]              
 	unsigned char                                      RandomReactionRolled;                             		// 0x00C0 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1694 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1694 );
 	};
 
 	void CheckMoving ( );
@@ -21652,8 +18549,6 @@ public:
 	bool CanDoCustomAction ( class APawn* SyncPawn, unsigned long bForced );
 };
 
-UClass* UBioCustomAction::pClassPointer = NULL;
-
 // Class SFXGame.BioCustomAction_KroganCharge
 // 0x003D (0x00FE - 0x00C1)
 class UBioCustomAction_KroganCharge : public UBioCustomAction
@@ -21668,16 +18563,9 @@ public:
 	unsigned char                                      m_ChargeAction;                                   		// 0x00FC (0x0001) [0x0000000000002000]              ( CPF_Transient )
 	unsigned char                                      m_NextAction;                                     		// 0x00FD (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1695 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1695 );
 	};
 
 	bool CanBeInterrupted ( );
@@ -21689,8 +18577,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* UBioCustomAction_KroganCharge::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_ProceduralMoveBase
 // 0x0073 (0x0134 - 0x00C1)
 class USFXCustomAction_ProceduralMoveBase : public UBioCustomAction
@@ -21734,16 +18620,9 @@ public:
 	unsigned char                                      StartRMRM;                                        		// 0x0132 (0x0001) [0x0000000000000000]              
 	unsigned char                                      EndRMRM;                                          		// 0x0133 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1696 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1696 );
 	};
 
 	bool ShouldReplicate ( );
@@ -21765,8 +18644,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_ProceduralMoveBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_MantleOverCoverBase
 // 0x0300 (0x0434 - 0x0134)
 class USFXCustomAction_MantleOverCoverBase : public USFXCustomAction_ProceduralMoveBase
@@ -21776,16 +18653,9 @@ public:
 	class ASFXReachSpecPlaceholderCylinder*            PlaceholderCylinder;                              		// 0x042C (0x0004) [0x0000000000000000]              
 	class ASFXReachSpecPlaceholderCylinder*            PlaceholderCylinder2;                             		// 0x0430 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1697 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1697 );
 	};
 
 	void ClientDoCustomAction ( unsigned long bForced );
@@ -21803,8 +18673,6 @@ public:
 	bool InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced );
 };
 
-UClass* USFXCustomAction_MantleOverCoverBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_ReachSpecMove
 // 0x000C (0x0140 - 0x0134)
 class USFXCustomAction_ReachSpecMove : public USFXCustomAction_ProceduralMoveBase
@@ -21814,16 +18682,9 @@ public:
 	class ASFXReachSpecPlaceholderCylinder*            BlockingStartCylinder;                            		// 0x0138 (0x0004) [0x0000000000000000]              
 	class ASFXReachSpecPlaceholderCylinder*            BlockingEndCylinder;                              		// 0x013C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1698 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1698 );
 	};
 
 	void StopCustomAction ( );
@@ -21836,8 +18697,6 @@ public:
 	bool InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced );
 };
 
-UClass* USFXCustomAction_ReachSpecMove::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_AirRecoverBase
 // 0x0008 (0x0148 - 0x0140)
 class USFXCustomAction_AirRecoverBase : public USFXCustomAction_ReachSpecMove
@@ -21846,16 +18705,9 @@ public:
 	float                                              FlightAccel;                                      		// 0x0140 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bTimedOut : 1;                                    		// 0x0144 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1699 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1699 );
 	};
 
 	bool CanBeInterrupted ( );
@@ -21867,24 +18719,15 @@ public:
 	struct FVector GetDestination ( );
 };
 
-UClass* USFXCustomAction_AirRecoverBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_BoostDownBase
 // 0x0000 (0x0140 - 0x0140)
 class USFXCustomAction_BoostDownBase : public USFXCustomAction_ReachSpecMove
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1700 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1700 );
 	};
 
 	void StopCustomAction ( );
@@ -21897,8 +18740,6 @@ public:
 	bool InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced );
 };
 
-UClass* USFXCustomAction_BoostDownBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_ClimbDownBase
 // 0x0004 (0x0144 - 0x0140)
 class USFXCustomAction_ClimbDownBase : public USFXCustomAction_ReachSpecMove
@@ -21906,16 +18747,9 @@ class USFXCustomAction_ClimbDownBase : public USFXCustomAction_ReachSpecMove
 public:
 	float                                              fClimbSpeed;                                      		// 0x0140 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1701 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1701 );
 	};
 
 	void SetMoveStage ( unsigned char NextStage );
@@ -21923,8 +18757,6 @@ public:
 	void PreAlignPawnLocation ( );
 };
 
-UClass* USFXCustomAction_ClimbDownBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_ClimbUpBase
 // 0x0014 (0x0154 - 0x0140)
 class USFXCustomAction_ClimbUpBase : public USFXCustomAction_ReachSpecMove
@@ -21936,16 +18768,9 @@ public:
 	float                                              fMaxAcceleration;                                 		// 0x014C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	float                                              fStopSpeed;                                       		// 0x0150 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1702 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1702 );
 	};
 
 	void SetMoveStage ( unsigned char NextStage );
@@ -21953,8 +18778,6 @@ public:
 	void PreAlignPawnLocation ( );
 };
 
-UClass* USFXCustomAction_ClimbUpBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_LadderClimbDownBase
 // 0x0008 (0x0148 - 0x0140)
 class USFXCustomAction_LadderClimbDownBase : public USFXCustomAction_ReachSpecMove
@@ -21963,16 +18786,9 @@ public:
 	float                                              fClimbDownSpeed;                                  		// 0x0140 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	class UAnimSet*                                    LadderAnimSet;                                    		// 0x0144 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1703 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1703 );
 	};
 
 	void SetMoveStage ( unsigned char NextStage );
@@ -21981,8 +18797,6 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_LadderClimbDownBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_LeapBase
 // 0x0018 (0x0158 - 0x0140)
 class USFXCustomAction_LeapBase : public USFXCustomAction_ReachSpecMove
@@ -21992,16 +18806,9 @@ public:
 	float                                              LeapSpeed;                                        		// 0x0150 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	class USFXLeapReachSpecBase*                       LeapSpec;                                         		// 0x0154 (0x0004) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1704 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1704 );
 	};
 
 	void StopCustomAction ( );
@@ -22009,8 +18816,6 @@ public:
 	void PreAlignPawnLocation ( );
 };
 
-UClass* USFXCustomAction_LeapBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_SyncPawnInstigator_Base
 // 0x0033 (0x00F4 - 0x00C1)
 class USFXCustomAction_SyncPawnInstigator_Base : public UBioCustomAction
@@ -22033,16 +18838,9 @@ public:
 	unsigned long                                      bDisablePartnerCollisionOnMove : 1;               		// 0x00F0 (0x0004) [0x0000000000000001] [0x00000040] ( CPF_Edit )
 	unsigned long                                      bIgnoreCameraHiding : 1;                          		// 0x00F0 (0x0004) [0x0000000000000001] [0x00000080] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1705 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1705 );
 	};
 
 	bool CanBeInterrupted ( );
@@ -22067,8 +18865,6 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_SyncPawnInstigator_Base::pClassPointer = NULL;
-
 // Class SFXGame.SFXPowerCustomActionBase
 // 0x0389 (0x044A - 0x00C1)
 class USFXPowerCustomActionBase : public UBioCustomAction
@@ -22136,16 +18932,9 @@ public:
 	unsigned char                                      PowerType;                                        		// 0x0448 (0x0001) [0x0000000000000000]              
 	unsigned char                                      HenchmanPowerType;                                		// 0x0449 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1706 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1706 );
 	};
 
 	void OnOwnerDestroyed ( );
@@ -22195,8 +18984,6 @@ public:
 	bool OnActorImpacted ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector HitLocation, struct FVector HitNormal );
 };
 
-UClass* USFXPowerCustomActionBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXTimelineData
 // 0x0038 (0x0074 - 0x003C)
 class USFXTimelineData : public UObject
@@ -22211,16 +18998,9 @@ public:
 	class AActor*                                      Target;                                           		// 0x006C (0x0004) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 	class UObject*                                     FuncOwner;                                        		// 0x0070 (0x0004) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1707 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1707 );
 	};
 
 	void InitializeTimeline ( class UObject* oFuncOwner );
@@ -22229,30 +19009,19 @@ public:
 	bool AOEEvalFunc ( class AActor* ChkOwner, class AActor* ChkTarget );
 };
 
-UClass* USFXTimelineData::pClassPointer = NULL;
-
 // Class SFXGame.BioDefine
 // 0x0000 (0x003C - 0x003C)
 class UBioDefine : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1708 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1708 );
 	};
 
 };
 
-UClass* UBioDefine::pClassPointer = NULL;
-
 // Class SFXGame.BioEventNotifier
 // 0x0080 (0x00BC - 0x003C)
 class UBioEventNotifier : public UObject
@@ -22287,16 +19056,9 @@ public:
 	unsigned long                                      m_bHUDAcknowledgedTalentNotify : 1;               		// 0x00B8 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 	unsigned long                                      bDissableTallentNotifications : 1;                		// 0x00B8 (0x0004) [0x0000000000004000] [0x00000010] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1709 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1709 );
 	};
 
 	void RemoveTalentNotify ( class ABioPawn* oCharacter );
@@ -22311,8 +19073,6 @@ public:
 	void RetrieveNotices ( TArray< struct FBioDisplayNotice >* lstNotices );
 };
 
-UClass* UBioEventNotifier::pClassPointer = NULL;
-
 // Class SFXGame.BioSFScreenTip
 // 0x000C (0x0048 - 0x003C)
 class UBioSFScreenTip : public UObject
@@ -22322,22 +19082,13 @@ public:
 	void*                                              PC_Body;                                          		// 0x0040 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	void*                                              PS3_Body;                                         		// 0x0044 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1710 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1710 );
 	};
 
 };
 
-UClass* UBioSFScreenTip::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIRenderTarget_InterpActor
 // 0x0005 (0x0261 - 0x025C)
 class ASFXGUIRenderTarget_InterpActor : public AInterpActor
@@ -22346,22 +19097,13 @@ public:
 	int                                                RenderTextureUVChannel;                           		// 0x025C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      MouseSupport;                                     		// 0x0260 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1711 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1711 );
 	};
 
 };
 
-UClass* ASFXGUIRenderTarget_InterpActor::pClassPointer = NULL;
-
 // Class SFXGame.SFXProjectile
 // 0x009D (0x02E1 - 0x0244)
 class ASFXProjectile : public AProjectile
@@ -22405,16 +19147,9 @@ public:
 	unsigned long                                      bActive : 1;                                      		// 0x02DC (0x0004) [0x0000000000000000] [0x00000800] 
 	unsigned char                                      LastReplicatedInitInfoTrigger;                    		// 0x02E0 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1712 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1712 );
 	};
 
 	void PrecacheVFX ( class ASFXObjectPool* ObjectPool, class URvrClientEffectManager* ClientEffects );
@@ -22453,8 +19188,6 @@ public:
 	void SpawnFlightEffects ( );
 };
 
-UClass* ASFXProjectile::pClassPointer = NULL;
-
 // Class SFXGame.SFXProjectile_Explosive
 // 0x00B0 (0x0391 - 0x02E1)
 class ASFXProjectile_Explosive : public ASFXProjectile
@@ -22505,16 +19238,9 @@ public:
 	unsigned long                                      bPlayExplodeForceFeedback : 1;                    		// 0x038C (0x0004) [0x0000000000000000] [0x00000400] 
 	unsigned char                                      LastReplicatedStickInfoTriggerCounter;            		// 0x0390 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1713 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1713 );
 	};
 
 	void PrecacheVFX ( class ASFXObjectPool* ObjectPool, class URvrClientEffectManager* ClientEffects );
@@ -22547,8 +19273,6 @@ public:
 	void ReplicatedEvent ( struct FName VarName );
 };
 
-UClass* ASFXProjectile_Explosive::pClassPointer = NULL;
-
 // Class SFXGame.SFXProjectile_PowerCustomAction
 // 0x0093 (0x0424 - 0x0391)
 class ASFXProjectile_PowerCustomAction : public ASFXProjectile_Explosive
@@ -22571,16 +19295,9 @@ public:
 	unsigned long                                      bUsePowerReservation : 1;                         		// 0x0420 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned long                                      ShowPowerAiming : 1;                              		// 0x0420 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1714 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1714 );
 	};
 
 	void ReplicatedInitUpdated ( );
@@ -22602,24 +19319,15 @@ public:
 	float GetDamageRadius ( );
 };
 
-UClass* ASFXProjectile_PowerCustomAction::pClassPointer = NULL;
-
 // Class SFXGame.SFXProjectile_Trajectory
 // 0x0000 (0x0244 - 0x0244)
 class ASFXProjectile_Trajectory : public AProjectile
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1715 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1715 );
 	};
 
 	void ApplyFluidSurfaceImpact ( class AFluidSurfaceActor* Fluid, struct FVector HitLocation );
@@ -22647,8 +19355,6 @@ public:
 	void OnExplode ( class AProjectile* pProjectile );
 };
 
-UClass* ASFXProjectile_Trajectory::pClassPointer = NULL;
-
 // Class SFXGame.SFXTracer
 // 0x004F (0x0245 - 0x01F6)
 class ASFXTracer : public AActor
@@ -22669,16 +19375,9 @@ public:
 	float                                              Lifetime;                                         		// 0x0240 (0x0004) [0x0000000000000000]              
 	unsigned char                                      ActiveState;                                      		// 0x0244 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1716 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1716 );
 	};
 
 	void ProcessTouch ( class AActor* Other, struct FVector HitLocation, struct FVector HitNormal );
@@ -22692,8 +19391,6 @@ public:
 	void InitTracer ( struct FVector Start, struct FVector End, struct FVector DesiredScale, float DesiredSpeed );
 };
 
-UClass* ASFXTracer::pClassPointer = NULL;
-
 // Class SFXGame.SFXWeapon_NativeBase
 // 0x0012 (0x02F7 - 0x02E5)
 class ASFXWeapon_NativeBase : public AWeapon
@@ -22719,16 +19416,9 @@ public:
 	unsigned char                                      FizzleCount;                                      		// 0x02F5 (0x0001) [0x0000000000000020]              ( CPF_Net )
 	unsigned char                                      CharacterSlot;                                    		// 0x02F6 (0x0001) [0x0000000000000020]              ( CPF_Net )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1717 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1717 );
 	};
 
 	void eventProcessInstantHit_Internal ( unsigned char FiringMode, struct FImpactInfo Impact, int NumHits );
@@ -22743,8 +19433,6 @@ public:
 	bool IsZoomed ( );
 };
 
-UClass* ASFXWeapon_NativeBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXWeaponMod_NativeBase
 // 0x0004 (0x0040 - 0x003C)
 class USFXWeaponMod_NativeBase : public UObject
@@ -22752,22 +19440,13 @@ class USFXWeaponMod_NativeBase : public UObject
 public:
 	class UPrimitiveComponent*                         PickupFactoryMesh;                                		// 0x003C (0x0004) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1718 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1718 );
 	};
 
 };
 
-UClass* USFXWeaponMod_NativeBase::pClassPointer = NULL;
-
 // Class SFXGame.BioGestChainNode
 // 0x0008 (0x0044 - 0x003C)
 class UBioGestChainNode : public UObject
@@ -22776,22 +19455,13 @@ public:
 	class UBioEvtSysTrackGesture*                      m_pGestTrack;                                     		// 0x003C (0x0004) [0x0000000000000000]              
 	int                                                m_nIndex;                                         		// 0x0040 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1719 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1719 );
 	};
 
 };
 
-UClass* UBioGestChainNode::pClassPointer = NULL;
-
 // Class SFXGame.BioGestChainTree
 // 0x000C (0x0050 - 0x0044)
 class UBioGestChainTree : public UBioGestChainNode
@@ -22799,22 +19469,13 @@ class UBioGestChainTree : public UBioGestChainNode
 public:
 	TArray< class UBioGestChainNode* >                 m_aChildren;                                      		// 0x0044 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1720 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1720 );
 	};
 
 };
 
-UClass* UBioGestChainTree::pClassPointer = NULL;
-
 // Class SFXGame.BioGestureAnimSetMgr
 // 0x0054 (0x0090 - 0x003C)
 class UBioGestureAnimSetMgr : public UObject
@@ -22827,23 +19488,14 @@ public:
 	unsigned long                                      m_bTransitioning : 1;                             		// 0x008C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned long                                      m_bGesturePlaying : 1;                            		// 0x008C (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1721 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1721 );
 	};
 
 	void SetPoseRMRotation ( unsigned long bEnabled );
 };
 
-UClass* UBioGestureAnimSetMgr::pClassPointer = NULL;
-
 // Class SFXGame.BioGestureRulesData
 // 0x0240 (0x027C - 0x003C)
 class UBioGestureRulesData : public UObject
@@ -22871,22 +19523,13 @@ public:
 	struct FName                                       m_nmDefaultPoseGroup;                             		// 0x026C (0x0008) [0x0000000000000000]              
 	struct FName                                       m_nmDefaultPerfGroup;                             		// 0x0274 (0x0008) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1722 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1722 );
 	};
 
 };
 
-UClass* UBioGestureRulesData::pClassPointer = NULL;
-
 // Class SFXGame.BioGestureRuntimeData
 // 0x00B0 (0x00EC - 0x003C)
 class UBioGestureRuntimeData : public UObject
@@ -22899,22 +19542,13 @@ public:
 	struct FName                                       m_nmDefaultPoseAnim;                              		// 0x00E0 (0x0008) [0x0000000000000000]              
 	class UAnimSet*                                    m_pDefaultPoseSet;                                		// 0x00E8 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1723 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1723 );
 	};
 
 };
 
-UClass* UBioGestureRuntimeData::pClassPointer = NULL;
-
 // Class SFXGame.SFXAmbPerfGameData
 // 0x0048 (0x0084 - 0x003C)
 class USFXAmbPerfGameData : public UObject
@@ -22933,22 +19567,13 @@ public:
 	unsigned long                                      m_bUseDynamicAnimsets : 1;                        		// 0x0080 (0x0004) [0x0000000000000000] [0x00000004] 
 	unsigned long                                      m_bSuppressDamage : 1;                            		// 0x0080 (0x0004) [0x0000000000000000] [0x00000008] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1724 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1724 );
 	};
 
 };
 
-UClass* USFXAmbPerfGameData::pClassPointer = NULL;
-
 // Class SFXGame.SFXGestures
 // 0x0010 (0x004C - 0x003C)
 class USFXGestures : public UObject
@@ -22957,23 +19582,14 @@ public:
 	struct FString                                     GesturesPackageName;                              		// 0x003C (0x000C) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 	class UBioGestureRuntimeData*                      m_pRuntimeData;                                   		// 0x0048 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1725 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1725 );
 	};
 
 	void LoadRuntimeData ( );
 };
 
-UClass* USFXGestures::pClassPointer = NULL;
-
 // Class SFXGame.BioHUD
 // 0x00B8 (0x0544 - 0x048C)
 class ABioHUD : public AHUD
@@ -23020,16 +19636,9 @@ public:
 	unsigned long                                      m_bUseGeneratedItemNames : 1;                     		// 0x0540 (0x0004) [0x0000000000004000] [0x00000040] ( CPF_Config )
 	unsigned long                                      bDesignerHud : 1;                                 		// 0x0540 (0x0004) [0x0000000000004000] [0x00000080] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1726 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1726 );
 	};
 
 	void RemoveTraceAtIndex ( int nTrace );
@@ -23108,8 +19717,6 @@ public:
 	void ViewportDeProject ( class ULocalPlayer* LocalPlayerOwner, struct FVector ScreenLocation, struct FVector* OutLocation, struct FVector* OutDirection );
 };
 
-UClass* ABioHUD::pClassPointer = NULL;
-
 // Class SFXGame.BioSubtitles
 // 0x0015 (0x0051 - 0x003C)
 class UBioSubtitles : public UObject
@@ -23120,16 +19727,9 @@ public:
 	unsigned long                                      m_bSubtitleVisible : 1;                           		// 0x004C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned char                                      m_DefaultRenderMode;                              		// 0x0050 (0x0001) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1727 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1727 );
 	};
 
 	void Enforce16x9 ( unsigned long bEnforce );
@@ -23140,8 +19740,6 @@ public:
 	void AddSubtitle ( struct FString sSubtitle, class UObject* pRefObject, class AActor* pActor, struct FColor colFontColor, unsigned long bAlert, unsigned char eRenderMode, unsigned long bHasPriority, float fDuration, float fDelayStarting );
 };
 
-UClass* UBioSubtitles::pClassPointer = NULL;
-
 // Class SFXGame.BioUIWorld
 // 0x01B8 (0x01F4 - 0x003C)
 class UBioUIWorld : public UObject
@@ -23167,16 +19765,9 @@ public:
 	unsigned long                                      m_bEnabled : 1;                                   		// 0x01F0 (0x0004) [0x0000000000004001] [0x00000001] ( CPF_Edit | CPF_Config )
 	unsigned long                                      m_bLoaded : 1;                                    		// 0x01F0 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1728 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1728 );
 	};
 
 	void CleanupUIWorld ( );
@@ -23212,8 +19803,6 @@ public:
 	void UIWorld_DeferredOperator ( class UObject* InData );
 };
 
-UClass* UBioUIWorld::pClassPointer = NULL;
-
 // Class SFXGame.SFXConsole
 // 0x0004 (0x01D4 - 0x01D0)
 class USFXConsole : public UConsole
@@ -23221,16 +19810,9 @@ class USFXConsole : public UConsole
 public:
 	unsigned long                                      bShift : 1;                                       		// 0x01D0 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1729 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1729 );
 	};
 
 	int FindBreak ( struct FString CurrentString, int CurrentStringPos, unsigned long bForward );
@@ -23248,8 +19830,6 @@ public:
 	void Initialized ( );
 };
 
-UClass* USFXConsole::pClassPointer = NULL;
-
 // Class SFXGame.BioInGamePropertyEditor
 // 0x008C (0x00C8 - 0x003C)
 class UBioInGamePropertyEditor : public UObject
@@ -23278,16 +19858,9 @@ public:
 	unsigned long                                      m_bSortByType : 1;                                		// 0x00C4 (0x0004) [0x0000000000000000] [0x00000004] 
 	unsigned long                                      m_bSortByName : 1;                                		// 0x00C4 (0x0004) [0x0000000000000000] [0x00000008] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1730 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1730 );
 	};
 
 	struct FString filterString ( struct FString Input );
@@ -23315,8 +19888,6 @@ public:
 	bool Initialize ( );
 };
 
-UClass* UBioInGamePropertyEditor::pClassPointer = NULL;
-
 // Class SFXGame.BioPropertyEditorBaseNode
 // 0x004C (0x0088 - 0x003C)
 class UBioPropertyEditorBaseNode : public UObject
@@ -23334,16 +19905,9 @@ public:
 	struct FColor                                      m_colour;                                         		// 0x0080 (0x0004) [0x0000000000000000]              
 	int                                                m_nGeneration;                                    		// 0x0084 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1731 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1731 );
 	};
 
 	struct FString getDisplayText ( unsigned long selectable );
@@ -23351,8 +19915,6 @@ public:
 	struct FColor getColour ( );
 };
 
-UClass* UBioPropertyEditorBaseNode::pClassPointer = NULL;
-
 // Class SFXGame.BioPropertyEditorBoneNode
 // 0x000C (0x0094 - 0x0088)
 class UBioPropertyEditorBoneNode : public UBioPropertyEditorBaseNode
@@ -23362,22 +19924,13 @@ public:
 	int                                                m_iLodIndex;                                      		// 0x008C (0x0004) [0x0000000000000000]              
 	int                                                m_iBoneIndex;                                     		// 0x0090 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1732 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1732 );
 	};
 
 };
 
-UClass* UBioPropertyEditorBoneNode::pClassPointer = NULL;
-
 // Class SFXGame.BioPropertyEditorLevelNode
 // 0x000C (0x0094 - 0x0088)
 class UBioPropertyEditorLevelNode : public UBioPropertyEditorBaseNode
@@ -23385,22 +19938,13 @@ class UBioPropertyEditorLevelNode : public UBioPropertyEditorBaseNode
 public:
 	struct FString                                     m_sCommand;                                       		// 0x0088 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1733 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1733 );
 	};
 
 };
 
-UClass* UBioPropertyEditorLevelNode::pClassPointer = NULL;
-
 // Class SFXGame.BioPropertyEditorLoadNode
 // 0x000C (0x0094 - 0x0088)
 class UBioPropertyEditorLoadNode : public UBioPropertyEditorBaseNode
@@ -23408,22 +19952,13 @@ class UBioPropertyEditorLoadNode : public UBioPropertyEditorBaseNode
 public:
 	struct FString                                     Filename;                                         		// 0x0088 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1734 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1734 );
 	};
 
 };
 
-UClass* UBioPropertyEditorLoadNode::pClassPointer = NULL;
-
 // Class SFXGame.BioPropertyEditorPropertyNode
 // 0x001C (0x00A4 - 0x0088)
 class UBioPropertyEditorPropertyNode : public UBioPropertyEditorBaseNode
@@ -23433,16 +19968,9 @@ public:
 	struct FString                                     m_sDeliminator;                                   		// 0x0094 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	struct FPointer                                    Base;                                             		// 0x00A0 (0x0004) [0x0000000000001000]              ( CPF_Native )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1735 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1735 );
 	};
 
 	struct FString getDisplayText ( unsigned long selectable );
@@ -23450,8 +19978,6 @@ public:
 	void SetObject ( class UObject* Obj );
 };
 
-UClass* UBioPropertyEditorPropertyNode::pClassPointer = NULL;
-
 // Class SFXGame.BioPropertyEditorArrayNode
 // 0x0004 (0x00A8 - 0x00A4)
 class UBioPropertyEditorArrayNode : public UBioPropertyEditorPropertyNode
@@ -23459,22 +19985,13 @@ class UBioPropertyEditorArrayNode : public UBioPropertyEditorPropertyNode
 public:
 	class UProperty*                                   m_Property;                                       		// 0x00A4 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1736 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1736 );
 	};
 
 };
 
-UClass* UBioPropertyEditorArrayNode::pClassPointer = NULL;
-
 // Class SFXGame.BioPropertyEditorEditableNode
 // 0x0019 (0x00BD - 0x00A4)
 class UBioPropertyEditorEditableNode : public UBioPropertyEditorPropertyNode
@@ -23489,22 +20006,13 @@ public:
 	unsigned long                                      alreadyEdited : 1;                                		// 0x00B8 (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned char                                      byteVal;                                          		// 0x00BC (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1737 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1737 );
 	};
 
 };
 
-UClass* UBioPropertyEditorEditableNode::pClassPointer = NULL;
-
 // Class SFXGame.BioPropertyEditorEditNode
 // 0x0010 (0x00B4 - 0x00A4)
 class UBioPropertyEditorEditNode : public UBioPropertyEditorPropertyNode
@@ -23515,23 +20023,14 @@ public:
 	float                                              floatVal;                                         		// 0x00AC (0x0004) [0x0000000000000000]              
 	int                                                otherVal;                                         		// 0x00B0 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1738 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1738 );
 	};
 
 	struct FString getDisplayText ( unsigned long selectable );
 };
 
-UClass* UBioPropertyEditorEditNode::pClassPointer = NULL;
-
 // Class SFXGame.BioPropertyEditorReadOnlyNode
 // 0x000C (0x00B0 - 0x00A4)
 class UBioPropertyEditorReadOnlyNode : public UBioPropertyEditorPropertyNode
@@ -23539,22 +20038,13 @@ class UBioPropertyEditorReadOnlyNode : public UBioPropertyEditorPropertyNode
 public:
 	struct FString                                     sDisplay;                                         		// 0x00A4 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1739 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1739 );
 	};
 
 };
 
-UClass* UBioPropertyEditorReadOnlyNode::pClassPointer = NULL;
-
 // Class SFXGame.BioPropertyEditorSaveNode
 // 0x000C (0x0094 - 0x0088)
 class UBioPropertyEditorSaveNode : public UBioPropertyEditorBaseNode
@@ -23562,38 +20052,22 @@ class UBioPropertyEditorSaveNode : public UBioPropertyEditorBaseNode
 public:
 	struct FString                                     Filename;                                         		// 0x0088 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1740 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1740 );
 	};
 
 };
 
-UClass* UBioPropertyEditorSaveNode::pClassPointer = NULL;
-
 // Class SFXGame.BioPropertyEditorVolatileNode
 // 0x0000 (0x0088 - 0x0088)
 class UBioPropertyEditorVolatileNode : public UBioPropertyEditorBaseNode
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1741 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1741 );
 	};
 
 	struct FString getDisplayText ( unsigned long selectable );
@@ -23601,8 +20075,6 @@ public:
 	struct FColor getColour ( );
 };
 
-UClass* UBioPropertyEditorVolatileNode::pClassPointer = NULL;
-
 // Class SFXGame.BioEvtSysTrackGestureAudHelper
 // 0x0048 (0x0084 - 0x003C)
 class UBioEvtSysTrackGestureAudHelper : public UObject
@@ -23622,44 +20094,26 @@ public:
 	unsigned long                                      m_bAllowMovingChainKeys : 1;                      		// 0x0080 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 	unsigned long                                      m_bAllPoseGroupsLoaded : 1;                       		// 0x0080 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1742 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1742 );
 	};
 
 };
 
-UClass* UBioEvtSysTrackGestureAudHelper::pClassPointer = NULL;
-
 // Class SFXGame.BioInterpTrackInstMove
 // 0x0000 (0x00A9 - 0x00A9)
 class UBioInterpTrackInstMove : public UInterpTrackInstMove
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1743 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1743 );
 	};
 
 };
 
-UClass* UBioInterpTrackInstMove::pClassPointer = NULL;
-
 // Class SFXGame.BioInterpTrackMove
 // 0x000A (0x00A8 - 0x009E)
 class UBioInterpTrackMove : public UInterpTrackMove
@@ -23667,22 +20121,13 @@ class UBioInterpTrackMove : public UInterpTrackMove
 public:
 	struct FName                                       FacingController;                                 		// 0x00A0 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1744 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1744 );
 	};
 
 };
 
-UClass* UBioInterpTrackMove::pClassPointer = NULL;
-
 // Class SFXGame.BioScalarParameterInstTrack
 // 0x0004 (0x0040 - 0x003C)
 class UBioScalarParameterInstTrack : public UInterpTrackInst
@@ -23690,22 +20135,13 @@ class UBioScalarParameterInstTrack : public UInterpTrackInst
 public:
 	float                                              ResetFloat;                                       		// 0x003C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1745 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1745 );
 	};
 
 };
 
-UClass* UBioScalarParameterInstTrack::pClassPointer = NULL;
-
 // Class SFXGame.BioScalarParameterTrack
 // 0x0010 (0x0080 - 0x0070)
 class UBioScalarParameterTrack : public UInterpTrackFloatBase
@@ -23715,38 +20151,22 @@ public:
 	float                                              InterpValue;                                      		// 0x0078 (0x0004) [0x0000000000000000]              
 	class UObject*                                     m_pParentEffect;                                  		// 0x007C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1746 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1746 );
 	};
 
 };
 
-UClass* UBioScalarParameterTrack::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameInterpTrack
 // 0x0000 (0x0070 - 0x0070)
 class USFXGameInterpTrack : public UBioInterpTrack
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1747 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1747 );
 	};
 
 	struct FString eventKeyDataDisplayName ( );
@@ -23755,8 +20175,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* USFXGameInterpTrack::pClassPointer = NULL;
-
 // Class SFXGame.BioConvNodeTrackDebug
 // 0x000C (0x007C - 0x0070)
 class UBioConvNodeTrackDebug : public USFXGameInterpTrack
@@ -23764,16 +20182,9 @@ class UBioConvNodeTrackDebug : public USFXGameInterpTrack
 public:
 	TArray< struct FString >                           m_aDbgStrings;                                    		// 0x0070 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1748 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1748 );
 	};
 
 	struct FString eventGetNewTrackSubMenuName ( );
@@ -23783,8 +20194,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* UBioConvNodeTrackDebug::pClassPointer = NULL;
-
 // Class SFXGame.BioEvtSysTrackDOF
 // 0x001C (0x008C - 0x0070)
 class UBioEvtSysTrackDOF : public USFXGameInterpTrack
@@ -23796,16 +20205,9 @@ public:
 	float                                              m_fDOFDefaultMaxNearBlur;                         		// 0x0084 (0x0004) [0x0000000000006000]              ( CPF_Transient | CPF_Config )
 	float                                              m_fDOFDefaultMaxFarBlur;                          		// 0x0088 (0x0004) [0x0000000000006000]              ( CPF_Transient | CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1749 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1749 );
 	};
 
 	struct FString eventGetNewTrackSubMenuName ( );
@@ -23815,8 +20217,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* UBioEvtSysTrackDOF::pClassPointer = NULL;
-
 // Class SFXGame.BioEvtSysTrackInterrupt
 // 0x000C (0x007C - 0x0070)
 class UBioEvtSysTrackInterrupt : public USFXGameInterpTrack
@@ -23824,16 +20224,9 @@ class UBioEvtSysTrackInterrupt : public USFXGameInterpTrack
 public:
 	TArray< struct FBioInterruptTrackData >            m_aInterruptData;                                 		// 0x0070 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1750 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1750 );
 	};
 
 	struct FString eventGetNewTrackSubMenuName ( );
@@ -23843,8 +20236,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* UBioEvtSysTrackInterrupt::pClassPointer = NULL;
-
 // Class SFXGame.BioEvtSysTrackSubtitles
 // 0x000C (0x007C - 0x0070)
 class UBioEvtSysTrackSubtitles : public USFXGameInterpTrack
@@ -23852,16 +20243,9 @@ class UBioEvtSysTrackSubtitles : public USFXGameInterpTrack
 public:
 	TArray< struct FBioSubtitleTrackData >             m_aSubtitleData;                                  		// 0x0070 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1751 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1751 );
 	};
 
 	struct FString eventGetNewTrackSubMenuName ( );
@@ -23871,8 +20255,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* UBioEvtSysTrackSubtitles::pClassPointer = NULL;
-
 // Class SFXGame.BioEvtSysTrackSwitchCamera
 // 0x000C (0x007C - 0x0070)
 class UBioEvtSysTrackSwitchCamera : public USFXGameInterpTrack
@@ -23880,16 +20262,9 @@ class UBioEvtSysTrackSwitchCamera : public USFXGameInterpTrack
 public:
 	TArray< struct FBioCameraSwitchData >              m_aCameras;                                       		// 0x0070 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1752 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1752 );
 	};
 
 	struct FString eventGetNewTrackSubMenuName ( );
@@ -23899,8 +20274,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* UBioEvtSysTrackSwitchCamera::pClassPointer = NULL;
-
 // Class SFXGame.BioEvtSysTrackVOElements
 // 0x0008 (0x0078 - 0x0070)
 class UBioEvtSysTrackVOElements : public USFXGameInterpTrack
@@ -23909,16 +20282,9 @@ public:
 	int                                                m_nStrRefID;                                      		// 0x0070 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	float                                              m_fJCutOffset;                                    		// 0x0074 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1753 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1753 );
 	};
 
 	struct FString eventGetNewTrackSubMenuName ( );
@@ -23928,8 +20294,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* UBioEvtSysTrackVOElements::pClassPointer = NULL;
-
 // Class SFXGame.BioInterpTrackRotationMode
 // 0x000C (0x007C - 0x0070)
 class UBioInterpTrackRotationMode : public USFXGameInterpTrack
@@ -23937,16 +20301,9 @@ class UBioInterpTrackRotationMode : public USFXGameInterpTrack
 public:
 	TArray< struct FRotationModeTrackKey >             EventTrack;                                       		// 0x0070 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1754 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1754 );
 	};
 
 	struct FString eventGetNewTrackSubMenuName ( );
@@ -23955,8 +20312,6 @@ public:
 	struct FString eventNewKeyDefaultName ( );
 };
 
-UClass* UBioInterpTrackRotationMode::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameActorInterpTrack
 // 0x0009 (0x0079 - 0x0070)
 class USFXGameActorInterpTrack : public USFXGameInterpTrack
@@ -23965,22 +20320,13 @@ public:
 	struct FName                                       m_nmFindActor;                                    		// 0x0070 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      m_eFindActorMode;                                 		// 0x0078 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1755 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1755 );
 	};
 
 };
 
-UClass* USFXGameActorInterpTrack::pClassPointer = NULL;
-
 // Class SFXGame.BioEvtSysTrackGesture
 // 0x0029 (0x00A2 - 0x0079)
 class UBioEvtSysTrackGesture : public USFXGameActorInterpTrack
@@ -23996,16 +20342,9 @@ public:
 	unsigned char                                      ePoseFilter;                                      		// 0x00A0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      eStartingPose;                                    		// 0x00A1 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1756 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1756 );
 	};
 
 	struct FString eventGetNewTrackSubMenuName ( );
@@ -24015,8 +20354,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* UBioEvtSysTrackGesture::pClassPointer = NULL;
-
 // Class SFXGame.BioEvtSysTrackLighting
 // 0x000F (0x0088 - 0x0079)
 class UBioEvtSysTrackLighting : public USFXGameActorInterpTrack
@@ -24024,16 +20361,9 @@ class UBioEvtSysTrackLighting : public USFXGameActorInterpTrack
 public:
 	TArray< struct FBioConvLightingData >              m_aLightingKeys;                                  		// 0x007C (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1757 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1757 );
 	};
 
 	struct FString eventGetNewTrackSubMenuName ( );
@@ -24043,8 +20373,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* UBioEvtSysTrackLighting::pClassPointer = NULL;
-
 // Class SFXGame.BioEvtSysTrackLookAt
 // 0x000F (0x0088 - 0x0079)
 class UBioEvtSysTrackLookAt : public USFXGameActorInterpTrack
@@ -24052,16 +20380,9 @@ class UBioEvtSysTrackLookAt : public USFXGameActorInterpTrack
 public:
 	TArray< struct FBioLookAtTrackData >               m_aLookAtKeys;                                    		// 0x007C (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1758 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1758 );
 	};
 
 	struct FString eventGetNewTrackSubMenuName ( );
@@ -24071,8 +20392,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* UBioEvtSysTrackLookAt::pClassPointer = NULL;
-
 // Class SFXGame.BioEvtSysTrackProp
 // 0x000F (0x0088 - 0x0079)
 class UBioEvtSysTrackProp : public USFXGameActorInterpTrack
@@ -24080,16 +20399,9 @@ class UBioEvtSysTrackProp : public USFXGameActorInterpTrack
 public:
 	TArray< struct FBioPropTrackData >                 m_aPropKeys;                                      		// 0x007C (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1759 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1759 );
 	};
 
 	float PropWepActionTimingDummyFireInfiniteOff ( class UObject* pWeaponIn );
@@ -24128,8 +20440,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* UBioEvtSysTrackProp::pClassPointer = NULL;
-
 // Class SFXGame.BioEvtSysTrackSetFacing
 // 0x000F (0x0088 - 0x0079)
 class UBioEvtSysTrackSetFacing : public USFXGameActorInterpTrack
@@ -24137,16 +20447,9 @@ class UBioEvtSysTrackSetFacing : public USFXGameActorInterpTrack
 public:
 	TArray< struct FBioSetFacingData >                 m_aFacingKeys;                                    		// 0x007C (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1760 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1760 );
 	};
 
 	struct FString eventGetNewTrackSubMenuName ( );
@@ -24156,8 +20459,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* UBioEvtSysTrackSetFacing::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameInterpTrackProcFoley
 // 0x0013 (0x008C - 0x0079)
 class USFXGameInterpTrackProcFoley : public USFXGameActorInterpTrack
@@ -24166,16 +20467,9 @@ public:
 	TArray< struct FBioProcFoleyData >                 m_aProcFoleyStartStopKeys;                        		// 0x007C (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	class UWwiseEventPairObject*                       m_TrackFoleySound;                                		// 0x0088 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1761 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1761 );
 	};
 
 	struct FString eventKeyDataDisplayName ( );
@@ -24184,8 +20478,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* USFXGameInterpTrackProcFoley::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackPlayFaceOnlyVO
 // 0x000F (0x0088 - 0x0079)
 class USFXInterpTrackPlayFaceOnlyVO : public USFXGameActorInterpTrack
@@ -24193,16 +20485,9 @@ class USFXInterpTrackPlayFaceOnlyVO : public USFXGameActorInterpTrack
 public:
 	TArray< struct FBioFOVOTrackData >                 m_aFOVOKeys;                                      		// 0x007C (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1762 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1762 );
 	};
 
 	struct FString eventGetNewTrackSubMenuName ( );
@@ -24212,24 +20497,15 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* USFXInterpTrackPlayFaceOnlyVO::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameInterpTrackCustom
 // 0x0000 (0x0070 - 0x0070)
 class USFXGameInterpTrackCustom : public USFXGameInterpTrack
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1763 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1763 );
 	};
 
 	struct FString eventKeyDataDisplayName ( );
@@ -24238,8 +20514,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* USFXGameInterpTrackCustom::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackAttachCrustEffect
 // 0x001C (0x008C - 0x0070)
 class USFXInterpTrackAttachCrustEffect : public USFXGameInterpTrackCustom
@@ -24249,16 +20523,9 @@ public:
 	TArray< class UBioSeqVar_ObjectFindByTag* >        m_aTarget;                                        		// 0x007C (0x000C) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 	class UObject*                                     oEffect;                                          		// 0x0088 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1764 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1764 );
 	};
 
 	void eventTriggerKey ( class UBioInterpTrackInst* pTrackInst, unsigned long bAttach, float fLifeTime );
@@ -24268,8 +20535,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* USFXInterpTrackAttachCrustEffect::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackAttachToActor
 // 0x0030 (0x00A0 - 0x0070)
 class USFXInterpTrackAttachToActor : public USFXGameInterpTrackCustom
@@ -24284,16 +20549,9 @@ public:
 	unsigned long                                      bUseRelativeOffset : 1;                           		// 0x009C (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 	unsigned long                                      bUseRelativeRotation : 1;                         		// 0x009C (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1765 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1765 );
 	};
 
 	void eventTriggerKey ( class UBioInterpTrackInst* pTrackInst );
@@ -24303,8 +20561,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* USFXInterpTrackAttachToActor::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackAttachVFXToObject
 // 0x0024 (0x0094 - 0x0070)
 class USFXInterpTrackAttachVFXToObject : public USFXGameInterpTrackCustom
@@ -24315,16 +20571,9 @@ public:
 	struct FName                                       m_nmSocketOrBone;                                 		// 0x0088 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 	class UObject*                                     m_oEffect;                                        		// 0x0090 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1766 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1766 );
 	};
 
 	void eventTriggerKey ( class UBioInterpTrackInst* pTrackInst );
@@ -24334,8 +20583,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* USFXInterpTrackAttachVFXToObject::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackBlackScreen
 // 0x0010 (0x0080 - 0x0070)
 class USFXInterpTrackBlackScreen : public USFXGameInterpTrackCustom
@@ -24344,16 +20591,9 @@ public:
 	TArray< struct FSFXBlackScreenTrackData >          m_aBlackScreenKeyData;                            		// 0x0070 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	class UBioSeqAct_BlackScreen*                      m_BlackScreenSeq;                                 		// 0x007C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1767 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1767 );
 	};
 
 	struct FString eventKeyDataDisplayName ( );
@@ -24362,8 +20602,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* USFXInterpTrackBlackScreen::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackDestroy
 // 0x000C (0x007C - 0x0070)
 class USFXInterpTrackDestroy : public USFXGameInterpTrackCustom
@@ -24371,16 +20609,9 @@ class USFXInterpTrackDestroy : public USFXGameInterpTrackCustom
 public:
 	TArray< class UBioSeqVar_ObjectFindByTag* >        m_aTarget;                                        		// 0x0070 (0x000C) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1768 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1768 );
 	};
 
 	void eventTriggerKey ( class UBioInterpTrackInst* pTrackInst );
@@ -24390,8 +20621,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* USFXInterpTrackDestroy::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackForceLightEnvUpdate
 // 0x0004 (0x0074 - 0x0070)
 class USFXInterpTrackForceLightEnvUpdate : public USFXGameInterpTrackCustom
@@ -24399,16 +20628,9 @@ class USFXInterpTrackForceLightEnvUpdate : public USFXGameInterpTrackCustom
 public:
 	class UBioSeqAct_ForceLightEnvUpdate*              m_SeqForceUpdateLight;                            		// 0x0070 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1769 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1769 );
 	};
 
 	struct FString eventKeyDataDisplayName ( );
@@ -24417,8 +20639,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* USFXInterpTrackForceLightEnvUpdate::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackLightEnvQuality
 // 0x0010 (0x0080 - 0x0070)
 class USFXInterpTrackLightEnvQuality : public USFXGameInterpTrackCustom
@@ -24427,16 +20647,9 @@ public:
 	TArray< struct FSFXLightEnvTrackData >             m_aLightEnvKeyData;                               		// 0x0070 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	class UBioSeqAct_SetLightEnvQuality*               m_LightEnvSeq;                                    		// 0x007C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1770 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1770 );
 	};
 
 	struct FString eventKeyDataDisplayName ( );
@@ -24445,8 +20658,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* USFXInterpTrackLightEnvQuality::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackMovieBase
 // 0x000C (0x007C - 0x0070)
 class USFXInterpTrackMovieBase : public USFXGameInterpTrackCustom
@@ -24454,23 +20665,14 @@ class USFXInterpTrackMovieBase : public USFXGameInterpTrackCustom
 public:
 	TArray< struct FSFXMoviePlayStateData >            m_aMovieKeyData;                                  		// 0x0070 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1771 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1771 );
 	};
 
 	struct FString eventKeyDataArrayName ( );
 };
 
-UClass* USFXInterpTrackMovieBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackMovieBink
 // 0x0018 (0x0094 - 0x007C)
 class USFXInterpTrackMovieBink : public USFXInterpTrackMovieBase
@@ -24482,16 +20684,9 @@ public:
 	unsigned long                                      m_bIgnoreShrinking : 1;                           		// 0x0090 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      m_bIgnoreGrowing : 1;                             		// 0x0090 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1772 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1772 );
 	};
 
 	struct FString eventKeyDataDisplayName ( );
@@ -24499,8 +20694,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* USFXInterpTrackMovieBink::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackMovieTexture
 // 0x0004 (0x0080 - 0x007C)
 class USFXInterpTrackMovieTexture : public USFXInterpTrackMovieBase
@@ -24508,16 +20701,9 @@ class USFXInterpTrackMovieTexture : public USFXInterpTrackMovieBase
 public:
 	class UTextureMovie*                               m_oTextureMovie;                                  		// 0x007C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1773 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1773 );
 	};
 
 	struct FString eventKeyDataDisplayName ( );
@@ -24526,8 +20712,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* USFXInterpTrackMovieTexture::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackSetPlayerNearClipPlane
 // 0x000C (0x007C - 0x0070)
 class USFXInterpTrackSetPlayerNearClipPlane : public USFXGameInterpTrackCustom
@@ -24535,16 +20719,9 @@ class USFXInterpTrackSetPlayerNearClipPlane : public USFXGameInterpTrackCustom
 public:
 	TArray< struct FSFXNearClipTrackData >             m_aNearClipKeyData;                               		// 0x0070 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1774 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1774 );
 	};
 
 	struct FString eventKeyDataDisplayName ( );
@@ -24553,8 +20730,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* USFXInterpTrackSetPlayerNearClipPlane::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackSetWeaponInstant
 // 0x0014 (0x0084 - 0x0070)
 class USFXInterpTrackSetWeaponInstant : public USFXGameInterpTrackCustom
@@ -24564,16 +20739,9 @@ public:
 	class UBioSeqVar_ObjectFindByTag*                  m_PawnRefTag;                                     		// 0x007C (0x0004) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 	class ABioPawn*                                    m_Pawn;                                           		// 0x0080 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1775 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1775 );
 	};
 
 	struct FString eventKeyDataDisplayName ( );
@@ -24582,8 +20750,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* USFXInterpTrackSetWeaponInstant::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackToggleBase
 // 0x001C (0x008C - 0x0070)
 class USFXInterpTrackToggleBase : public USFXGameInterpTrackCustom
@@ -24593,16 +20759,9 @@ public:
 	TArray< class UBioSeqVar_ObjectFindByTag* >        m_aTarget;                                        		// 0x007C (0x000C) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 	class AActor*                                      m_TargetActor;                                    		// 0x0088 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1776 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1776 );
 	};
 
 	void SetupToggleSequenceOp ( class USequenceOp* Seq, unsigned long bToggle, unsigned long bEnable );
@@ -24612,24 +20771,15 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* USFXInterpTrackToggleBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackToggleAffectedByHitEffects
 // 0x0000 (0x008C - 0x008C)
 class USFXInterpTrackToggleAffectedByHitEffects : public USFXInterpTrackToggleBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1777 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1777 );
 	};
 
 	void SetupToggleSequenceOp ( class USequenceOp* Seq, unsigned long bToggle, unsigned long bEnable );
@@ -24639,24 +20789,15 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* USFXInterpTrackToggleAffectedByHitEffects::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackToggleHidden
 // 0x0000 (0x008C - 0x008C)
 class USFXInterpTrackToggleHidden : public USFXInterpTrackToggleBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1778 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1778 );
 	};
 
 	void SetupToggleSequenceOp ( class USequenceOp* Seq, unsigned long bToggle, unsigned long bEnable );
@@ -24666,8 +20807,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* USFXInterpTrackToggleHidden::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackToggleLightEnvironment
 // 0x0004 (0x0090 - 0x008C)
 class USFXInterpTrackToggleLightEnvironment : public USFXInterpTrackToggleBase
@@ -24675,16 +20814,9 @@ class USFXInterpTrackToggleLightEnvironment : public USFXInterpTrackToggleBase
 public:
 	class UBioSeqAct_ToggleLightEnv*                   m_LightEnvSeq;                                    		// 0x008C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1779 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1779 );
 	};
 
 	struct FString eventKeyDataDisplayName ( );
@@ -24692,8 +20824,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* USFXInterpTrackToggleLightEnvironment::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameInterpTrackWwiseMicLock
 // 0x0010 (0x0080 - 0x0070)
 class USFXGameInterpTrackWwiseMicLock : public USFXGameInterpTrack
@@ -24702,16 +20832,9 @@ public:
 	TArray< struct FBioMicLockData >                   m_aMicLockKeys;                                   		// 0x0070 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	unsigned long                                      m_bUnlockAtEnd : 1;                               		// 0x007C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1780 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1780 );
 	};
 
 	struct FString eventKeyDataDisplayName ( );
@@ -24720,30 +20843,19 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* USFXGameInterpTrackWwiseMicLock::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameInterpTrackInst
 // 0x0000 (0x0040 - 0x0040)
 class USFXGameInterpTrackInst : public UBioInterpTrackInst
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1781 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1781 );
 	};
 
 };
 
-UClass* USFXGameInterpTrackInst::pClassPointer = NULL;
-
 // Class SFXGame.BioEvtSysTrackDOFInst
 // 0x0008 (0x0048 - 0x0040)
 class UBioEvtSysTrackDOFInst : public USFXGameInterpTrackInst
@@ -24752,22 +20864,13 @@ public:
 	float                                              m_fInterpolateElapsed;                            		// 0x0040 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	int                                                m_nCurEffect;                                     		// 0x0044 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1782 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1782 );
 	};
 
 };
 
-UClass* UBioEvtSysTrackDOFInst::pClassPointer = NULL;
-
 // Class SFXGame.BioEvtSysTrackInterruptInst
 // 0x0004 (0x0044 - 0x0040)
 class UBioEvtSysTrackInterruptInst : public USFXGameInterpTrackInst
@@ -24775,44 +20878,26 @@ class UBioEvtSysTrackInterruptInst : public USFXGameInterpTrackInst
 public:
 	class UBioConversationController*                  m_pConvCont;                                      		// 0x0040 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1783 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1783 );
 	};
 
 };
 
-UClass* UBioEvtSysTrackInterruptInst::pClassPointer = NULL;
-
 // Class SFXGame.BioEvtSysTrackSubtitlesInst
 // 0x0000 (0x0040 - 0x0040)
 class UBioEvtSysTrackSubtitlesInst : public USFXGameInterpTrackInst
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1784 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1784 );
 	};
 
 };
 
-UClass* UBioEvtSysTrackSubtitlesInst::pClassPointer = NULL;
-
 // Class SFXGame.BioEvtSysTrackSwitchCameraInst
 // 0x0004 (0x0044 - 0x0040)
 class UBioEvtSysTrackSwitchCameraInst : public USFXGameInterpTrackInst
@@ -24820,22 +20905,13 @@ class UBioEvtSysTrackSwitchCameraInst : public USFXGameInterpTrackInst
 public:
 	class UBioEvtSysTrackDOF*                          m_pDOFTrack;                                      		// 0x0040 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1785 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1785 );
 	};
 
 };
 
-UClass* UBioEvtSysTrackSwitchCameraInst::pClassPointer = NULL;
-
 // Class SFXGame.BioEvtSysTrackVOElementsInst
 // 0x0004 (0x0044 - 0x0040)
 class UBioEvtSysTrackVOElementsInst : public USFXGameInterpTrackInst
@@ -24843,22 +20919,13 @@ class UBioEvtSysTrackVOElementsInst : public USFXGameInterpTrackInst
 public:
 	class UBioConversationController*                  m_pConvCont;                                      		// 0x0040 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1786 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1786 );
 	};
 
 };
 
-UClass* UBioEvtSysTrackVOElementsInst::pClassPointer = NULL;
-
 // Class SFXGame.BioInterpTrackInstRotationMode
 // 0x0004 (0x0044 - 0x0040)
 class UBioInterpTrackInstRotationMode : public USFXGameInterpTrackInst
@@ -24866,22 +20933,13 @@ class UBioInterpTrackInstRotationMode : public USFXGameInterpTrackInst
 public:
 	float                                              LastUpdatePosition;                               		// 0x0040 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1787 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1787 );
 	};
 
 };
 
-UClass* UBioInterpTrackInstRotationMode::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameActorInterpTrackInst
 // 0x0004 (0x0044 - 0x0040)
 class USFXGameActorInterpTrackInst : public USFXGameInterpTrackInst
@@ -24889,22 +20947,13 @@ class USFXGameActorInterpTrackInst : public USFXGameInterpTrackInst
 public:
 	class AActor*                                      m_pActor;                                         		// 0x0040 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1788 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1788 );
 	};
 
 };
 
-UClass* USFXGameActorInterpTrackInst::pClassPointer = NULL;
-
 // Class SFXGame.BioEvtSysTrackGestureInst
 // 0x0040 (0x0084 - 0x0044)
 class UBioEvtSysTrackGestureInst : public USFXGameActorInterpTrackInst
@@ -24913,22 +20962,13 @@ public:
 	struct FMap_Mirror                                 m_mapCachedAnimsets;                              		// 0x0044 (0x003C) [0x0000000000003000]              ( CPF_Native | CPF_Transient )
 	unsigned long                                      m_bBelongsToConversation : 1;                     		// 0x0080 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1789 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1789 );
 	};
 
 };
 
-UClass* UBioEvtSysTrackGestureInst::pClassPointer = NULL;
-
 // Class SFXGame.BioEvtSysTrackLightingInst
 // 0x0048 (0x008C - 0x0044)
 class UBioEvtSysTrackLightingInst : public USFXGameActorInterpTrackInst
@@ -24937,44 +20977,26 @@ public:
 	struct FBioConvLightingData                        InitialLightingData;                              		// 0x0044 (0x0044) [0x0000000000000000]              
 	unsigned long                                      ResetLightingData : 1;                            		// 0x0088 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1790 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1790 );
 	};
 
 };
 
-UClass* UBioEvtSysTrackLightingInst::pClassPointer = NULL;
-
 // Class SFXGame.BioEvtSysTrackLookAtInst
 // 0x0000 (0x0044 - 0x0044)
 class UBioEvtSysTrackLookAtInst : public USFXGameActorInterpTrackInst
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1791 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1791 );
 	};
 
 };
 
-UClass* UBioEvtSysTrackLookAtInst::pClassPointer = NULL;
-
 // Class SFXGame.BioEvtSysTrackPropInst
 // 0x007C (0x00C0 - 0x0044)
 class UBioEvtSysTrackPropInst : public USFXGameActorInterpTrackInst
@@ -24984,16 +21006,9 @@ public:
 	struct FMap_Mirror                                 m_mapUsedMeshProps;                               		// 0x0080 (0x003C) [0x0000000000003000]              ( CPF_Native | CPF_Transient )
 	unsigned long                                      m_bBelongsToConversation : 1;                     		// 0x00BC (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1792 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1792 );
 	};
 
 	struct FString eventGetWeaponName ( class UObject* pWeaponIn );
@@ -25002,30 +21017,19 @@ public:
 	class UObject* FindWeaponData ( class UClass* cWeapon, unsigned long bCurrentlyEquipped, int* nSpawned );
 };
 
-UClass* UBioEvtSysTrackPropInst::pClassPointer = NULL;
-
 // Class SFXGame.BioEvtSysTrackSetFacingInst
 // 0x0000 (0x0044 - 0x0044)
 class UBioEvtSysTrackSetFacingInst : public USFXGameActorInterpTrackInst
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1793 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1793 );
 	};
 
 };
 
-UClass* UBioEvtSysTrackSetFacingInst::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameInterpTrackInstProcFoley
 // 0x0004 (0x0048 - 0x0044)
 class USFXGameInterpTrackInstProcFoley : public USFXGameActorInterpTrackInst
@@ -25033,22 +21037,13 @@ class USFXGameInterpTrackInstProcFoley : public USFXGameActorInterpTrackInst
 public:
 	unsigned long                                      m_bBelongsToConversation : 1;                     		// 0x0044 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1794 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1794 );
 	};
 
 };
 
-UClass* USFXGameInterpTrackInstProcFoley::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackPlayFaceOnlyVOInst
 // 0x000C (0x0050 - 0x0044)
 class USFXInterpTrackPlayFaceOnlyVOInst : public USFXGameActorInterpTrackInst
@@ -25056,44 +21051,26 @@ class USFXInterpTrackPlayFaceOnlyVOInst : public USFXGameActorInterpTrackInst
 public:
 	TArray< class UBioSeqAct_FaceOnlyVO* >             m_aFOVOObjects;                                   		// 0x0044 (0x000C) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1795 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1795 );
 	};
 
 };
 
-UClass* USFXInterpTrackPlayFaceOnlyVOInst::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameInterpTrackInstCustom
 // 0x0000 (0x0040 - 0x0040)
 class USFXGameInterpTrackInstCustom : public USFXGameInterpTrackInst
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1796 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1796 );
 	};
 
 };
 
-UClass* USFXGameInterpTrackInstCustom::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameInterpTrackInstMovieBink
 // 0x0008 (0x0048 - 0x0040)
 class USFXGameInterpTrackInstMovieBink : public USFXGameInterpTrackInst
@@ -25102,22 +21079,13 @@ public:
 	class USFXSceneGroup*                              m_pOwningScene;                                   		// 0x0040 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned long                                      m_bIsPlaying : 1;                                 		// 0x0044 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1797 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1797 );
 	};
 
 };
 
-UClass* USFXGameInterpTrackInstMovieBink::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameInterpTrackInstWwiseMicLock
 // 0x003C (0x007C - 0x0040)
 class USFXGameInterpTrackInstWwiseMicLock : public USFXGameInterpTrackInst
@@ -25125,44 +21093,26 @@ class USFXGameInterpTrackInstWwiseMicLock : public USFXGameInterpTrackInst
 public:
 	struct FMap_Mirror                                 m_mapCachedActors;                                		// 0x0040 (0x003C) [0x0000000000003000]              ( CPF_Native | CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1798 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1798 );
 	};
 
 };
 
-UClass* USFXGameInterpTrackInstWwiseMicLock::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrack_MoveTo
 // 0x0000 (0x009E - 0x009E)
 class USFXInterpTrack_MoveTo : public UInterpTrackMove
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1799 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1799 );
 	};
 
 };
 
-UClass* USFXInterpTrack_MoveTo::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackInst_MoveTo
 // 0x001B (0x00C4 - 0x00A9)
 class USFXInterpTrackInst_MoveTo : public UInterpTrackInstMove
@@ -25171,22 +21121,13 @@ public:
 	struct FVector                                     StartLocation;                                    		// 0x00AC (0x000C) [0x0000000000000001]              ( CPF_Edit )
 	struct FRotator                                    StartRotation;                                    		// 0x00B8 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1800 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1800 );
 	};
 
 };
 
-UClass* USFXInterpTrackInst_MoveTo::pClassPointer = NULL;
-
 // Class SFXGame.SFXSceneShopNodeKisVarCheck
 // 0x0008 (0x005C - 0x0054)
 class USFXSceneShopNodeKisVarCheck : public USFXSceneShopNode
@@ -25194,22 +21135,13 @@ class USFXSceneShopNodeKisVarCheck : public USFXSceneShopNode
 public:
 	struct FName                                       m_nmKismetBoolVarName;                            		// 0x0054 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1801 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1801 );
 	};
 
 };
 
-UClass* USFXSceneShopNodeKisVarCheck::pClassPointer = NULL;
-
 // Class SFXGame.SFXSceneShopNodePlotCheck
 // 0x0014 (0x0068 - 0x0054)
 class USFXSceneShopNodePlotCheck : public USFXSceneShopNode
@@ -25222,22 +21154,13 @@ public:
 	unsigned char                                      VarType;                                          		// 0x0066 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      Variable;                                         		// 0x0067 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1802 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1802 );
 	};
 
 };
 
-UClass* USFXSceneShopNodePlotCheck::pClassPointer = NULL;
-
 // Class SFXGame.SFXSceneShopNodeScene
 // 0x0004 (0x0058 - 0x0054)
 class USFXSceneShopNodeScene : public USFXSceneShopNode
@@ -25245,66 +21168,39 @@ class USFXSceneShopNodeScene : public USFXSceneShopNode
 public:
 	class USFXSceneGroup*                              m_pLinkedScene;                                   		// 0x0054 (0x0004) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1803 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1803 );
 	};
 
 };
 
-UClass* USFXSceneShopNodeScene::pClassPointer = NULL;
-
 // Class SFXGame.SFXSceneShopNodeStart
 // 0x0000 (0x0054 - 0x0054)
 class USFXSceneShopNodeStart : public USFXSceneShopNode
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1804 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1804 );
 	};
 
 };
 
-UClass* USFXSceneShopNodeStart::pClassPointer = NULL;
-
 // Class SFXGame.BioInterpolator
 // 0x0000 (0x003C - 0x003C)
 class UBioInterpolator : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1805 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1805 );
 	};
 
 };
 
-UClass* UBioInterpolator::pClassPointer = NULL;
-
 // Class SFXGame.BioLookAtDefinition
 // 0x001E (0x005A - 0x003C)
 class UBioLookAtDefinition : public UObject
@@ -25319,22 +21215,13 @@ public:
 	unsigned char                                      RootAnimBoneLookAtAxis;                           		// 0x0058 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      RootAnimBoneUpAxis;                               		// 0x0059 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1806 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1806 );
 	};
 
 };
 
-UClass* UBioLookAtDefinition::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_ToggleGlobalLookAt
 // 0x0004 (0x00B4 - 0x00B0)
 class UBioSeqAct_ToggleGlobalLookAt : public USequenceAction
@@ -25344,22 +21231,13 @@ public:
 	unsigned long                                      State : 1;                                        		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned long                                      Instant : 1;                                      		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1807 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1807 );
 	};
 
 };
 
-UClass* UBioSeqAct_ToggleGlobalLookAt::pClassPointer = NULL;
-
 // Class SFXGame.BioMaterialExpressionAnisoSpec
 // 0x0054 (0x0090 - 0x003C)
 class UBioMaterialExpressionAnisoSpec : public UMaterialExpression
@@ -25369,22 +21247,13 @@ public:
 	struct FExpressionInput                            SpecColor;                                        		// 0x0058 (0x001C) [0x0000000000000000]              
 	struct FExpressionInput                            SpecPower;                                        		// 0x0074 (0x001C) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1808 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1808 );
 	};
 
 };
 
-UClass* UBioMaterialExpressionAnisoSpec::pClassPointer = NULL;
-
 // Class SFXGame.BioMaterialExpressionBlinnSpec
 // 0x0054 (0x0090 - 0x003C)
 class UBioMaterialExpressionBlinnSpec : public UMaterialExpression
@@ -25394,22 +21263,13 @@ public:
 	struct FExpressionInput                            SpecColor;                                        		// 0x0058 (0x001C) [0x0000000000000000]              
 	struct FExpressionInput                            SpecPower;                                        		// 0x0074 (0x001C) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1809 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1809 );
 	};
 
 };
 
-UClass* UBioMaterialExpressionBlinnSpec::pClassPointer = NULL;
-
 // Class SFXGame.BioMaterialExpressionDirt
 // 0x0030 (0x006C - 0x003C)
 class UBioMaterialExpressionDirt : public UMaterialExpression
@@ -25420,22 +21280,13 @@ public:
 	struct FName                                       GrimeTexParamName;                                		// 0x0060 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 	class UTexture2D*                                  GrimeTex;                                         		// 0x0068 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1810 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1810 );
 	};
 
 };
 
-UClass* UBioMaterialExpressionDirt::pClassPointer = NULL;
-
 // Class SFXGame.BioMaterialExpressionFresnel
 // 0x0024 (0x0060 - 0x003C)
 class UBioMaterialExpressionFresnel : public UMaterialExpression
@@ -25445,44 +21296,26 @@ public:
 	float                                              Power;                                            		// 0x0058 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      Inverted : 1;                                     		// 0x005C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1811 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1811 );
 	};
 
 };
 
-UClass* UBioMaterialExpressionFresnel::pClassPointer = NULL;
-
 // Class SFXGame.BioMaterialExpressionHalfAngle
 // 0x0000 (0x003C - 0x003C)
 class UBioMaterialExpressionHalfAngle : public UMaterialExpression
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1812 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1812 );
 	};
 
 };
 
-UClass* UBioMaterialExpressionHalfAngle::pClassPointer = NULL;
-
 // Class SFXGame.BioMaterialExpressionKeyedFlipbook
 // 0x0044 (0x0080 - 0x003C)
 class UBioMaterialExpressionKeyedFlipbook : public UMaterialExpression
@@ -25494,22 +21327,13 @@ public:
 	int                                                FlipTexCols;                                      		// 0x0078 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	class UTexture2D*                                  FlipTex;                                          		// 0x007C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1813 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1813 );
 	};
 
 };
 
-UClass* UBioMaterialExpressionKeyedFlipbook::pClassPointer = NULL;
-
 // Class SFXGame.BioMaterialExpressionPhongSpec
 // 0x0054 (0x0090 - 0x003C)
 class UBioMaterialExpressionPhongSpec : public UMaterialExpression
@@ -25519,22 +21343,13 @@ public:
 	struct FExpressionInput                            SpecColor;                                        		// 0x0058 (0x001C) [0x0000000000000000]              
 	struct FExpressionInput                            SpecPower;                                        		// 0x0074 (0x001C) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1814 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1814 );
 	};
 
 };
 
-UClass* UBioMaterialExpressionPhongSpec::pClassPointer = NULL;
-
 // Class SFXGame.BioMaterialExpressionSineSubtend
 // 0x0038 (0x0074 - 0x003C)
 class UBioMaterialExpressionSineSubtend : public UMaterialExpression
@@ -25543,22 +21358,13 @@ public:
 	struct FExpressionInput                            A;                                                		// 0x003C (0x001C) [0x0000000000000000]              
 	struct FExpressionInput                            B;                                                		// 0x0058 (0x001C) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1815 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1815 );
 	};
 
 };
 
-UClass* UBioMaterialExpressionSineSubtend::pClassPointer = NULL;
-
 // Class SFXGame.BioMaterialExpressionSpecPower
 // 0x001C (0x0058 - 0x003C)
 class UBioMaterialExpressionSpecPower : public UMaterialExpression
@@ -25566,22 +21372,13 @@ class UBioMaterialExpressionSpecPower : public UMaterialExpression
 public:
 	struct FExpressionInput                            Input;                                            		// 0x003C (0x001C) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1816 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1816 );
 	};
 
 };
 
-UClass* UBioMaterialExpressionSpecPower::pClassPointer = NULL;
-
 // Class SFXGame.BioMaterialExpressionWound
 // 0x0004 (0x0040 - 0x003C)
 class UBioMaterialExpressionWound : public UMaterialExpression
@@ -25589,22 +21386,13 @@ class UBioMaterialExpressionWound : public UMaterialExpression
 public:
 	int                                                m_nWoundNumber;                                   		// 0x003C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1817 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1817 );
 	};
 
 };
 
-UClass* UBioMaterialExpressionWound::pClassPointer = NULL;
-
 // Class SFXGame.BioMaterialOverride
 // 0x0024 (0x0060 - 0x003C)
 class UBioMaterialOverride : public UObject
@@ -25614,16 +21402,9 @@ public:
 	TArray< struct FColorParameter >                   m_aColorOverrides;                                		// 0x0048 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	TArray< struct FScalarParameter >                  m_aScalarOverrides;                               		// 0x0054 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1818 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1818 );
 	};
 
 	void Unapply ( class UMeshComponent* InComponent );
@@ -25632,8 +21413,6 @@ public:
 	void ApplyOverride ( class AActor* InTarget );
 };
 
-UClass* UBioMaterialOverride::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_Gestures
 // 0x00D8 (0x0120 - 0x0048)
 class USFXModule_Gestures : public USFXModule
@@ -25658,16 +21437,9 @@ public:
 	unsigned long                                      m_bPerfPaused : 1;                                		// 0x011C (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 	unsigned long                                      m_bDisableBlinksAndNoise : 1;                     		// 0x011C (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1819 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1819 );
 	};
 
 	void RemoveWeaponData ( class UClass* cWeapon );
@@ -25676,8 +21448,6 @@ public:
 	class USkeletalMeshComponent* ScriptGetMainMeshComp ( class AActor* pActor );
 };
 
-UClass* USFXModule_Gestures::pClassPointer = NULL;
-
 // Class SFXGame.BioMorphFace
 // 0x0054 (0x0090 - 0x003C)
 class UBioMorphFace : public UObject
@@ -25697,16 +21467,9 @@ public:
 	class UBioMaterialOverride*                        m_oMaterialOverrides;                             		// 0x0088 (0x0004) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 	unsigned long                                      bRequiresDynamicUpdates : 1;                      		// 0x008C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1820 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1820 );
 	};
 
 	void ApplyMesh ( class USkeletalMesh* SkelMesh, class USkeletalMeshComponent* MeshCmpt );
@@ -25722,8 +21485,6 @@ public:
 	void RefreshBuffers ( TArray< int > BufferIndices );
 };
 
-UClass* UBioMorphFace::pClassPointer = NULL;
-
 // Class SFXGame.BioMorphFaceFESliderBase
 // 0x0014 (0x0050 - 0x003C)
 class UBioMorphFaceFESliderBase : public UObject
@@ -25733,22 +21494,13 @@ public:
 	class UBioMorphFaceFrontEnd*                       m_oMorphFaceFrontEnd;                             		// 0x0048 (0x0004) [0x0000000000000000]              
 	unsigned long                                      m_bStepped : 1;                                   		// 0x004C (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1821 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1821 );
 	};
 
 };
 
-UClass* UBioMorphFaceFESliderBase::pClassPointer = NULL;
-
 // Class SFXGame.BioMorphFaceFESliderColour
 // 0x0018 (0x0068 - 0x0050)
 class UBioMorphFaceFESliderColour : public UBioMorphFaceFESliderBase
@@ -25757,44 +21509,26 @@ public:
 	struct FString                                     m_sParameterName;                                 		// 0x0050 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	TArray< struct FColor >                            m_acColours;                                      		// 0x005C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1822 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1822 );
 	};
 
 };
 
-UClass* UBioMorphFaceFESliderColour::pClassPointer = NULL;
-
 // Class SFXGame.BioMorphFaceFESliderHair
 // 0x0000 (0x0050 - 0x0050)
 class UBioMorphFaceFESliderHair : public UBioMorphFaceFESliderBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1823 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1823 );
 	};
 
 };
 
-UClass* UBioMorphFaceFESliderHair::pClassPointer = NULL;
-
 // Class SFXGame.BioMorphFaceFESliderMorph
 // 0x0024 (0x0074 - 0x0050)
 class UBioMorphFaceFESliderMorph : public UBioMorphFaceFESliderBase
@@ -25806,22 +21540,13 @@ public:
 	float                                              m_fRandomRange;                                   		// 0x006C (0x0004) [0x0000000000000000]              
 	unsigned long                                      m_bSingle : 1;                                    		// 0x0070 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1824 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1824 );
 	};
 
 };
 
-UClass* UBioMorphFaceFESliderMorph::pClassPointer = NULL;
-
 // Class SFXGame.BioMorphFaceFESliderScalar
 // 0x0018 (0x0068 - 0x0050)
 class UBioMorphFaceFESliderScalar : public UBioMorphFaceFESliderBase
@@ -25830,22 +21555,13 @@ public:
 	struct FString                                     m_sParameterName;                                 		// 0x0050 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	TArray< float >                                    m_afValues;                                       		// 0x005C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1825 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1825 );
 	};
 
 };
 
-UClass* UBioMorphFaceFESliderScalar::pClassPointer = NULL;
-
 // Class SFXGame.BioMorphFaceFESliderSetMorph
 // 0x0018 (0x0068 - 0x0050)
 class UBioMorphFaceFESliderSetMorph : public UBioMorphFaceFESliderBase
@@ -25854,22 +21570,13 @@ public:
 	struct FString                                     m_sMorphName;                                     		// 0x0050 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	TArray< float >                                    m_afValues;                                       		// 0x005C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1826 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1826 );
 	};
 
 };
 
-UClass* UBioMorphFaceFESliderSetMorph::pClassPointer = NULL;
-
 // Class SFXGame.BioMorphFaceFESliderTexture
 // 0x0018 (0x0068 - 0x0050)
 class UBioMorphFaceFESliderTexture : public UBioMorphFaceFESliderBase
@@ -25878,44 +21585,26 @@ public:
 	struct FString                                     m_sParameterName;                                 		// 0x0050 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	TArray< class UTexture* >                          m_atTexture;                                      		// 0x005C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1827 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1827 );
 	};
 
 };
 
-UClass* UBioMorphFaceFESliderTexture::pClassPointer = NULL;
-
 // Class SFXGame.BioMorphUtility
 // 0x0000 (0x003C - 0x003C)
 class UBioMorphUtility : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1828 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1828 );
 	};
 
 };
 
-UClass* UBioMorphUtility::pClassPointer = NULL;
-
 // Class SFXGame.BioMorphFaceFrontEnd
 // 0x0108 (0x0144 - 0x003C)
 class UBioMorphFaceFrontEnd : public UBioMorphUtility
@@ -25934,16 +21623,9 @@ public:
 	unsigned long                                      m_bDebugStrings : 1;                              		// 0x0140 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 	unsigned long                                      bIsMale : 1;                                      		// 0x0140 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1829 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1829 );
 	};
 
 	struct FString GenerateFaceCode ( );
@@ -25972,8 +21654,6 @@ public:
 	class UBioMorphFace* Initialize ( class USFXMorphFaceFrontEndDataSource* Data, unsigned long bReset );
 };
 
-UClass* UBioMorphFaceFrontEnd::pClassPointer = NULL;
-
 // Class SFXGame.SFXMorphFaceFrontEndDataSource
 // 0x00F4 (0x0130 - 0x003C)
 class USFXMorphFaceFrontEndDataSource : public UObject
@@ -25991,44 +21671,26 @@ public:
 	class UMorphTargetSet*                             MorphTargetSet;                                   		// 0x0128 (0x0004) [0x0000000000000000]              
 	unsigned long                                      PlayerIsMale : 1;                                 		// 0x012C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1830 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1830 );
 	};
 
 };
 
-UClass* USFXMorphFaceFrontEndDataSource::pClassPointer = NULL;
-
 // Class SFXGame.BioEmissionAreaList
 // 0x0000 (0x003C - 0x003C)
 class UBioEmissionAreaList : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1831 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1831 );
 	};
 
 };
 
-UClass* UBioEmissionAreaList::pClassPointer = NULL;
-
 // Class SFXGame.BioEmissionAreaListBoneList
 // 0x000C (0x0048 - 0x003C)
 class UBioEmissionAreaListBoneList : public UBioEmissionAreaList
@@ -26036,44 +21698,26 @@ class UBioEmissionAreaListBoneList : public UBioEmissionAreaList
 public:
 	TArray< struct FBoneListEmissionArea >             m_EmissionAreas;                                  		// 0x003C (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1832 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1832 );
 	};
 
 };
 
-UClass* UBioEmissionAreaListBoneList::pClassPointer = NULL;
-
 // Class SFXGame.BioParticleModuleBase
 // 0x0000 (0x0041 - 0x0041)
 class UBioParticleModuleBase : public UParticleModule
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1833 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1833 );
 	};
 
 };
 
-UClass* UBioParticleModuleBase::pClassPointer = NULL;
-
 // Class SFXGame.BioParticleModuleMultiplyByEmitterSpeed
 // 0x0014 (0x0055 - 0x0041)
 class UBioParticleModuleMultiplyByEmitterSpeed : public UBioParticleModuleBase
@@ -26085,22 +21729,13 @@ public:
 	float                                              MultiplierAtMax;                                  		// 0x0050 (0x0004) [0x000000000200000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_NoClear )
 	unsigned char                                      MultipliedProperty;                               		// 0x0054 (0x0001) [0x000000000200000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_NoClear )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1834 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1834 );
 	};
 
 };
 
-UClass* UBioParticleModuleMultiplyByEmitterSpeed::pClassPointer = NULL;
-
 // Class SFXGame.BioParticleModuleSound
 // 0x001B (0x005C - 0x0041)
 class UBioParticleModuleSound : public UBioParticleModuleBase
@@ -26115,22 +21750,13 @@ public:
 	unsigned long                                      bPerParticle : 1;                                 		// 0x0058 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned long                                      m_bDuck : 1;                                      		// 0x0058 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1835 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1835 );
 	};
 
 };
 
-UClass* UBioParticleModuleSound::pClassPointer = NULL;
-
 // Class SFXGame.SFXParticleModule_CameraEffect
 // 0x00A7 (0x00E8 - 0x0041)
 class USFXParticleModule_CameraEffect : public UBioParticleModuleBase
@@ -26145,22 +21771,13 @@ public:
 	unsigned long                                      bUseIntensityCurve : 1;                           		// 0x00E4 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned long                                      bPlayProgrammaticShake : 1;                       		// 0x00E4 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1836 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1836 );
 	};
 
 };
 
-UClass* USFXParticleModule_CameraEffect::pClassPointer = NULL;
-
 // Class SFXGame.BioParticleModuleCollisionDecal
 // 0x0027 (0x0114 - 0x00ED)
 class UBioParticleModuleCollisionDecal : public UParticleModuleCollision
@@ -26172,23 +21789,14 @@ public:
 	class UParticleSystem*                             CollisionEmitterTemplate;                         		// 0x010C (0x0004) [0x0000000000000000]              
 	unsigned long                                      bEnableMultiHitDecal : 1;                         		// 0x0110 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1837 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1837 );
 	};
 
 	void eventCreateDecal ( class UParticleSystemComponent* PSC, class UPrimitiveComponent* HitComponent, struct FVector HitLocation, struct FVector HitNormal );
 };
 
-UClass* UBioParticleModuleCollisionDecal::pClassPointer = NULL;
-
 // Class SFXGame.BioParticleModuleLocationAttachedMesh
 // 0x0025 (0x0071 - 0x004C)
 class UBioParticleModuleLocationAttachedMesh : public UParticleModuleLocationBase
@@ -26203,22 +21811,13 @@ public:
 	unsigned long                                      bUseRenderMeshAsSource : 1;                       		// 0x006C (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 	unsigned char                                      m_SpecificationType;                              		// 0x0070 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1838 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1838 );
 	};
 
 };
 
-UClass* UBioParticleModuleLocationAttachedMesh::pClassPointer = NULL;
-
 // Class SFXGame.BioParticleModuleLocationPrimitiveNearestSurface
 // 0x0016 (0x00A6 - 0x0090)
 class UBioParticleModuleLocationPrimitiveNearestSurface : public UParticleModuleLocationPrimitiveBase
@@ -26233,44 +21832,26 @@ public:
 	unsigned char                                      eIfNoCollision;                                   		// 0x00A4 (0x0001) [0x0000000002000009]              ( CPF_Edit | CPF_ExportObject | CPF_NoClear )
 	unsigned char                                      eOnCollision;                                     		// 0x00A5 (0x0001) [0x0000000002000009]              ( CPF_Edit | CPF_ExportObject | CPF_NoClear )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1839 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1839 );
 	};
 
 };
 
-UClass* UBioParticleModuleLocationPrimitiveNearestSurface::pClassPointer = NULL;
-
 // Class SFXGame.BioParticleModuleVelocityWorldSpace
 // 0x0000 (0x0088 - 0x0088)
 class UBioParticleModuleVelocityWorldSpace : public UParticleModuleVelocity
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1840 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1840 );
 	};
 
 };
 
-UClass* UBioParticleModuleVelocityWorldSpace::pClassPointer = NULL;
-
 // Class SFXGame.BioPawn
 // 0x0765 (0x0BCD - 0x0468)
 class ABioPawn : public APawn
@@ -26596,16 +22177,9 @@ public:
 	unsigned char                                      m_eAnimSkidState;                                 		// 0x0BCB (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 	unsigned char                                      m_eGetUpState;                                    		// 0x0BCC (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1841 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1841 );
 	};
 
 	void RemoveDetachOnDestroyObject ( class USkeletalMeshComponent* MeshToRemove );
@@ -26999,8 +22573,6 @@ public:
 	void RBCollisionCallback ( class APawn* oPawn, class AActor* oImpactActor, struct FVector vImpactDir );
 };
 
-UClass* ABioPawn::pClassPointer = NULL;
-
 // Class SFXGame.BioScout
 // 0x0004 (0x04D8 - 0x04D4)
 class ABioScout : public AScout
@@ -27008,22 +22580,13 @@ class ABioScout : public AScout
 public:
 	unsigned long                                      m_bAggressivePathPruning : 1;                     		// 0x04D4 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1842 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1842 );
 	};
 
 };
 
-UClass* ABioScout::pClassPointer = NULL;
-
 // Class SFXGame.SFXCharacterClass_NativeBase
 // 0x0038 (0x0074 - 0x003C)
 class USFXCharacterClass_NativeBase : public UObject
@@ -27036,23 +22599,14 @@ public:
 	float                                              CameraHookScale;                                  		// 0x006C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	float                                              CameraArmScale;                                   		// 0x0070 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1843 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1843 );
 	};
 
 	void CollectAnimListForCooking ( TArray< struct FName >* OutResults );
 };
 
-UClass* USFXCharacterClass_NativeBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXCompositeSkeletalMesh
 // 0x0018 (0x0380 - 0x0368)
 class USFXCompositeSkeletalMesh : public USkeletalMesh
@@ -27061,24 +22615,15 @@ public:
 	TArray< struct FString >                           SourceMeshNames;                                  		// 0x0368 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	TArray< struct FBoneOverrideInfo >                 OverrideInfo;                                     		// 0x0374 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1844 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1844 );
 	};
 
 	class USFXCompositeSkeletalMesh* MergeMeshes ( class USkeletalMesh* BaseMesh, TArray< class USkeletalMesh* > AdditionalMeshes, class USkeletalMeshComponent* HeadMeshComponent );
 	bool MatchesMerge ( class USkeletalMesh* BaseMesh, TArray< class USkeletalMesh* > AdditionalMeshes, class USkeletalMeshComponent* HeadMeshComponent );
 };
 
-UClass* USFXCompositeSkeletalMesh::pClassPointer = NULL;
-
 // Class SFXGame.SFXKActor
 // 0x000C (0x02F0 - 0x02E4)
 class ASFXKActor : public AKActor
@@ -27089,16 +22634,9 @@ public:
 	unsigned long                                      bImmovable : 1;                                   		// 0x02EC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bKinematicUntilMoved : 1;                         		// 0x02EC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1845 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1845 );
 	};
 
 	void ImpulseFragments ( struct FVector Source, struct FVector Momentum, struct FVector Extent, unsigned long bVelChange );
@@ -27108,8 +22646,6 @@ public:
 	void eventExceededPhysicsThreshold ( class AActor* instigatedBy );
 };
 
-UClass* ASFXKActor::pClassPointer = NULL;
-
 // Class SFXGame.BioPhysicsActor
 // 0x000C (0x02FC - 0x02F0)
 class ABioPhysicsActor : public ASFXKActor
@@ -27119,16 +22655,9 @@ public:
 	float                                              m_fCurrentHealth;                                 		// 0x02F4 (0x0004) [0x0000000000000000]              
 	unsigned long                                      m_bToughPlaceable : 1;                            		// 0x02F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1846 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1846 );
 	};
 
 	void eventTakeDamage ( float Damage, class AController* instigatedBy, struct FVector HitLocation, struct FVector Momentum, class UClass* DamageType, struct FTraceHitInfo HitInfo, class AActor* DamageCauser );
@@ -27136,8 +22665,6 @@ public:
 	void ChangeMaterialParameters ( );
 };
 
-UClass* ABioPhysicsActor::pClassPointer = NULL;
-
 // Class SFXGame.SFXKActorSpawnable
 // 0x0008 (0x02F0 - 0x02E8)
 class ASFXKActorSpawnable : public AKActorSpawnable
@@ -27146,22 +22673,13 @@ public:
 	float                                              m_fPhysicsSoundLastTimePlayed;                    		// 0x02E8 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	class AActor*                                      m_aLastCollidedActor;                             		// 0x02EC (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1847 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1847 );
 	};
 
 };
 
-UClass* ASFXKActorSpawnable::pClassPointer = NULL;
-
 // Class SFXGame.SFXKAsset
 // 0x0008 (0x0210 - 0x0208)
 class ASFXKAsset : public AKAsset
@@ -27170,22 +22688,13 @@ public:
 	float                                              m_fPhysicsSoundLastTimePlayed;                    		// 0x0208 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	class AActor*                                      m_aLastCollidedActor;                             		// 0x020C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1848 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1848 );
 	};
 
 };
 
-UClass* ASFXKAsset::pClassPointer = NULL;
-
 // Class SFXGame.BioCodexMap
 // 0x0078 (0x00B4 - 0x003C)
 class UBioCodexMap : public UObject
@@ -27194,22 +22703,13 @@ public:
 	struct FMap_Mirror                                 SectionMap;                                       		// 0x003C (0x003C) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 	struct FMap_Mirror                                 PageMap;                                          		// 0x0078 (0x003C) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1849 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1849 );
 	};
 
 };
 
-UClass* UBioCodexMap::pClassPointer = NULL;
-
 // Class SFXGame.BioDiscoveredCodexMap
 // 0x003C (0x0078 - 0x003C)
 class UBioDiscoveredCodexMap : public UObject
@@ -27217,23 +22717,14 @@ class UBioDiscoveredCodexMap : public UObject
 public:
 	struct FMap_Mirror                                 DiscoveredCodex;                                  		// 0x003C (0x003C) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1850 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1850 );
 	};
 
 	void Clear ( );
 };
 
-UClass* UBioDiscoveredCodexMap::pClassPointer = NULL;
-
 // Class SFXGame.BioGlobalVariableTable
 // 0x0204 (0x0240 - 0x003C)
 class UBioGlobalVariableTable : public UObject
@@ -27327,16 +22818,9 @@ public:
 	class UBio2DA*                                     oNameLookupTable;                                 		// 0x0238 (0x0004) [0x0000000000000000]              
 	class UBio2DA*                                     AchievementTable;                                 		// 0x023C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1851 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1851 );
 	};
 
 	void ClearAllVariables ( unsigned long bPersistME1ME2plots );
@@ -27380,8 +22864,6 @@ public:
 	bool GetBool ( int nIndex );
 };
 
-UClass* UBioGlobalVariableTable::pClassPointer = NULL;
-
 // Class SFXGame.BioOutcomeMap
 // 0x003C (0x0078 - 0x003C)
 class UBioOutcomeMap : public UObject
@@ -27389,22 +22871,13 @@ class UBioOutcomeMap : public UObject
 public:
 	struct FMap_Mirror                                 OutcomeMapping;                                   		// 0x003C (0x003C) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1852 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1852 );
 	};
 
 };
 
-UClass* UBioOutcomeMap::pClassPointer = NULL;
-
 // Class SFXGame.BioQuestMap
 // 0x00F0 (0x012C - 0x003C)
 class UBioQuestMap : public UObject
@@ -27415,22 +22888,13 @@ public:
 	struct FMap_Mirror                                 IntTaskEvalMap;                                   		// 0x00B4 (0x003C) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 	struct FMap_Mirror                                 FloatTaskEvalMap;                                 		// 0x00F0 (0x003C) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1853 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1853 );
 	};
 
 };
 
-UClass* UBioQuestMap::pClassPointer = NULL;
-
 // Class SFXGame.BioQuestProgressionMap
 // 0x0040 (0x007C - 0x003C)
 class UBioQuestProgressionMap : public UObject
@@ -27439,23 +22903,14 @@ public:
 	struct FMap_Mirror                                 QuestProgression;                                 		// 0x003C (0x003C) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 	int                                                nQuestProgressCounter;                            		// 0x0078 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1854 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1854 );
 	};
 
 	void Clear ( );
 };
 
-UClass* UBioQuestProgressionMap::pClassPointer = NULL;
-
 // Class SFXGame.BioStateEventMap
 // 0x0060 (0x009C - 0x003C)
 class UBioStateEventMap : public UObject
@@ -27466,44 +22921,26 @@ public:
 	TArray< int >                                      GalaxyAtWarIntVarIDs;                             		// 0x0084 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	TArray< int >                                      GalaxyAtWarFloatVarIDs;                           		// 0x0090 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1855 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1855 );
 	};
 
 };
 
-UClass* UBioStateEventMap::pClassPointer = NULL;
-
 // Class SFXGame.BioConsequenceMap
 // 0x0000 (0x009C - 0x009C)
 class UBioConsequenceMap : public UBioStateEventMap
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1856 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1856 );
 	};
 
 };
 
-UClass* UBioConsequenceMap::pClassPointer = NULL;
-
 // Class SFXGame.SFXPower
 // 0x0108 (0x0144 - 0x003C)
 class USFXPower : public UObject
@@ -27562,16 +22999,9 @@ public:
 	unsigned char                                      Discipline;                                       		// 0x0142 (0x0001) [0x0000000000000000]              
 	unsigned char                                      VocalizationEvent;                                		// 0x0143 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1857 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1857 );
 	};
 
 	float GetImpactRadius ( );
@@ -27595,8 +23025,6 @@ public:
 	float GetScaledValue ( struct FVector2D ValueToScale, int nRankToUse );
 };
 
-UClass* USFXPower::pClassPointer = NULL;
-
 // Class SFXGame.SFXPowerManager
 // 0x0088 (0x00C4 - 0x003C)
 class USFXPowerManager : public UObject
@@ -27623,16 +23051,9 @@ public:
 	int                                                DisableCasterCrusts;                              		// 0x00BC (0x0004) [0x0000000000000000]              
 	unsigned long                                      SharedCooldownDisabled : 1;                       		// 0x00C0 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1858 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1858 );
 	};
 
 	void OnPawnLoadedWeapons ( );
@@ -27676,8 +23097,6 @@ public:
 	void OnPowerReleased ( class Usfxpowercustomaction* oPower );
 };
 
-UClass* USFXPowerManager::pClassPointer = NULL;
-
 // Class SFXGame.BioCurveDrivenParameter
 // 0x0034 (0x0070 - 0x003C)
 class UBioCurveDrivenParameter : public UObject
@@ -27689,23 +23108,14 @@ public:
 	unsigned long                                      bScaleToLifetime : 1;                             		// 0x006C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bLoop : 1;                                        		// 0x006C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1859 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1859 );
 	};
 
 	float GetValue ( float fTime, float fScale );
 };
 
-UClass* UBioCurveDrivenParameter::pClassPointer = NULL;
-
 // Class SFXGame.BioDecalComponent
 // 0x00FE (0x03F0 - 0x02F2)
 class UBioDecalComponent : public UDecalComponent
@@ -27726,46 +23136,28 @@ public:
 	unsigned long                                      bScaleByDistance : 1;                             		// 0x03EC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bProjectOnShields : 1;                            		// 0x03EC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1860 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1860 );
 	};
 
 };
 
-UClass* UBioDecalComponent::pClassPointer = NULL;
-
 // Class SFXGame.BioVisualEffect
 // 0x0000 (0x02B4 - 0x02B4)
 class ABioVisualEffect : public APrefabInstance
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1861 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1861 );
 	};
 
 	void DestroyPrefab ( );
 	void InstancePrefab ( class UPrefab* InPrefab );
 };
 
-UClass* ABioVisualEffect::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_ActivateGalaxyMap
 // 0x0018 (0x00C8 - 0x00B0)
 class UBioSeqAct_ActivateGalaxyMap : public USequenceAction
@@ -27776,22 +23168,13 @@ public:
 	class USFXGalaxy*                                  m_pGalaxyMap;                                     		// 0x00C0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	class USFXGalaxyMapGameData*                       Data;                                             		// 0x00C4 (0x0004) [0x0000000004420009]              ( CPF_Edit | CPF_ExportObject | CPF_EditConst | CPF_NeedCtorLink | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1862 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1862 );
 	};
 
 };
 
-UClass* UBioSeqAct_ActivateGalaxyMap::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_AddChoiceGUIElement
 // 0x0031 (0x00E1 - 0x00B0)
 class UBioSeqAct_AddChoiceGUIElement : public USequenceAction
@@ -27813,45 +23196,27 @@ public:
 	unsigned long                                      m_bNested : 1;                                    		// 0x00DC (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 	unsigned char                                      m_eResource;                                      		// 0x00E0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1863 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1863 );
 	};
 
 	int eventGetObjClassVersion ( );
 };
 
-UClass* UBioSeqAct_AddChoiceGUIElement::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_BlockForTextureStreaming
 // 0x0000 (0x00B0 - 0x00B0)
 class UBioSeqAct_BlockForTextureStreaming : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1864 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1864 );
 	};
 
 };
 
-UClass* UBioSeqAct_BlockForTextureStreaming::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_CopyPlayerHeadToTarget
 // 0x0004 (0x00B4 - 0x00B0)
 class UBioSeqAct_CopyPlayerHeadToTarget : public USequenceAction
@@ -27860,22 +23225,13 @@ public:
 	unsigned long                                      m_bCopyHeadGearMesh : 1;                          		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      m_bCopyHairMesh : 1;                              		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1865 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1865 );
 	};
 
 };
 
-UClass* UBioSeqAct_CopyPlayerHeadToTarget::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_DUISetElementText
 // 0x000D (0x00BD - 0x00B0)
 class UBioSeqAct_DUISetElementText : public USequenceAction
@@ -27884,22 +23240,13 @@ public:
 	struct FString                                     sText;                                            		// 0x00B0 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	unsigned char                                      Element;                                          		// 0x00BC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1866 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1866 );
 	};
 
 };
 
-UClass* UBioSeqAct_DUISetElementText::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_DUITimer
 // 0x0010 (0x00D0 - 0x00C0)
 class UBioSeqAct_DUITimer : public USeqAct_Latent
@@ -27911,67 +23258,40 @@ public:
 	unsigned long                                      bModalTimer : 1;                                  		// 0x00CC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bVisible : 1;                                     		// 0x00CC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1867 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1867 );
 	};
 
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_DUITimer::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_EndCurrentConvNode
 // 0x0000 (0x00B0 - 0x00B0)
 class UBioSeqAct_EndCurrentConvNode : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1868 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1868 );
 	};
 
 };
 
-UClass* UBioSeqAct_EndCurrentConvNode::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_ForceLightEnvUpdate
 // 0x0000 (0x00B0 - 0x00B0)
 class UBioSeqAct_ForceLightEnvUpdate : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1869 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1869 );
 	};
 
 };
 
-UClass* UBioSeqAct_ForceLightEnvUpdate::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_ForceStreamInTextures
 // 0x0004 (0x00F0 - 0x00EC)
 class UBioSeqAct_ForceStreamInTextures : public USeqAct_StreamInTextures
@@ -27979,22 +23299,13 @@ class UBioSeqAct_ForceStreamInTextures : public USeqAct_StreamInTextures
 public:
 	unsigned long                                      bBlockOnWait : 1;                                 		// 0x00EC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1870 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1870 );
 	};
 
 };
 
-UClass* UBioSeqAct_ForceStreamInTextures::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_GetFromObjectList
 // 0x0004 (0x00B4 - 0x00B0)
 class UBioSeqAct_GetFromObjectList : public USequenceAction
@@ -28002,22 +23313,13 @@ class UBioSeqAct_GetFromObjectList : public USequenceAction
 public:
 	int                                                nListIndex;                                       		// 0x00B0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1871 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1871 );
 	};
 
 };
 
-UClass* UBioSeqAct_GetFromObjectList::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_GetNearestObject
 // 0x0004 (0x00B4 - 0x00B0)
 class UBioSeqAct_GetNearestObject : public USequenceAction
@@ -28025,44 +23327,26 @@ class UBioSeqAct_GetNearestObject : public USequenceAction
 public:
 	unsigned long                                      bGetFurthest : 1;                                 		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1872 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1872 );
 	};
 
 };
 
-UClass* UBioSeqAct_GetNearestObject::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_PlayLoadingMovie
 // 0x0000 (0x00B0 - 0x00B0)
 class UBioSeqAct_PlayLoadingMovie : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1873 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1873 );
 	};
 
 };
 
-UClass* UBioSeqAct_PlayLoadingMovie::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_PMBase
 // 0x0012 (0x00C2 - 0x00B0)
 class UBioSeqAct_PMBase : public USequenceAction
@@ -28073,22 +23357,13 @@ public:
 	unsigned char                                      Region;                                           		// 0x00C0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      Plot;                                             		// 0x00C1 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1874 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1874 );
 	};
 
 };
 
-UClass* UBioSeqAct_PMBase::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_PMCheckConditional
 // 0x000B (0x00CD - 0x00C2)
 class UBioSeqAct_PMCheckConditional : public UBioSeqAct_PMBase
@@ -28098,22 +23373,13 @@ public:
 	unsigned long                                      OutValue : 1;                                     		// 0x00C8 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned char                                      Conditional;                                      		// 0x00CC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1875 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1875 );
 	};
 
 };
 
-UClass* UBioSeqAct_PMCheckConditional::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_PMCheckState
 // 0x0007 (0x00C9 - 0x00C2)
 class UBioSeqAct_PMCheckState : public UBioSeqAct_PMBase
@@ -28122,22 +23388,13 @@ public:
 	unsigned long                                      OutValue : 1;                                     		// 0x00C4 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned char                                      State;                                            		// 0x00C8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1876 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1876 );
 	};
 
 };
 
-UClass* UBioSeqAct_PMCheckState::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_PMExecuteTransition
 // 0x0007 (0x00C9 - 0x00C2)
 class UBioSeqAct_PMExecuteTransition : public UBioSeqAct_PMBase
@@ -28146,44 +23403,26 @@ public:
 	int                                                Param;                                            		// 0x00C4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      Transition;                                       		// 0x00C8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1877 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1877 );
 	};
 
 };
 
-UClass* UBioSeqAct_PMExecuteTransition::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_PositionFSActors
 // 0x0000 (0x00B0 - 0x00B0)
 class UBioSeqAct_PositionFSActors : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1878 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1878 );
 	};
 
 };
 
-UClass* UBioSeqAct_PositionFSActors::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_ScalarMathUnit
 // 0x001D (0x00CD - 0x00B0)
 class UBioSeqAct_ScalarMathUnit : public USequenceAction
@@ -28200,23 +23439,14 @@ public:
 	unsigned long                                      ZIsFloat : 1;                                     		// 0x00C8 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 	unsigned char                                      Operation;                                        		// 0x00CC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1879 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1879 );
 	};
 
 	int eventGetObjClassVersion ( );
 };
 
-UClass* UBioSeqAct_ScalarMathUnit::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_SetGestureMode
 // 0x001D (0x00CD - 0x00B0)
 class UBioSeqAct_SetGestureMode : public USequenceAction
@@ -28227,23 +23457,14 @@ public:
 	unsigned long                                      m_bForAmbientActing : 1;                          		// 0x00C8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned char                                      GestureMode;                                      		// 0x00CC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1880 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1880 );
 	};
 
 	int eventGetObjClassVersion ( );
 };
 
-UClass* UBioSeqAct_SetGestureMode::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_SetLightEnvQuality
 // 0x0001 (0x00B1 - 0x00B0)
 class UBioSeqAct_SetLightEnvQuality : public USequenceAction
@@ -28251,23 +23472,14 @@ class UBioSeqAct_SetLightEnvQuality : public USequenceAction
 public:
 	unsigned char                                      Quality;                                          		// 0x00B0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1881 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1881 );
 	};
 
 	int eventGetObjClassVersion ( );
 };
 
-UClass* UBioSeqAct_SetLightEnvQuality::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_SetStreamingState
 // 0x000C (0x00BC - 0x00B0)
 class UBioSeqAct_SetStreamingState : public USequenceAction
@@ -28276,16 +23488,9 @@ public:
 	struct FName                                       StateName;                                        		// 0x00B0 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      NewValue : 1;                                     		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1882 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1882 );
 	};
 
 	void Activated ( );
@@ -28293,8 +23498,6 @@ public:
 	void RetouchTriggers ( );
 };
 
-UClass* UBioSeqAct_SetStreamingState::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_SetWeapon
 // 0x000C (0x00BC - 0x00B0)
 class UBioSeqAct_SetWeapon : public USequenceAction
@@ -28304,24 +23507,15 @@ public:
 	class ABioPawn*                                    oPawn;                                            		// 0x00B4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	int                                                nWeapon;                                          		// 0x00B8 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1883 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1883 );
 	};
 
 	int eventGetObjClassVersion ( );
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_SetWeapon::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_SkillGame_Base
 // 0x0011 (0x00D1 - 0x00C0)
 class UBioSeqAct_SkillGame_Base : public USeqAct_Latent
@@ -28334,16 +23528,9 @@ public:
 	unsigned long                                      m_bRewardOnTimeFail : 1;                          		// 0x00CC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned char                                      m_CompletionState;                                		// 0x00D0 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1884 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1884 );
 	};
 
 	void OnCancel ( );
@@ -28351,8 +23538,6 @@ public:
 	void OnSuccess ( int nRemainingResources );
 };
 
-UClass* UBioSeqAct_SkillGame_Base::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_SkillGame_Bypass
 // 0x000F (0x00E0 - 0x00D1)
 class UBioSeqAct_SkillGame_Bypass : public UBioSeqAct_SkillGame_Base
@@ -28362,16 +23547,9 @@ public:
 	int                                                m_nPCBurnDown;                                    		// 0x00D8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	int                                                m_nConsoleBurnDown;                               		// 0x00DC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1885 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1885 );
 	};
 
 	int eventGetObjClassVersion ( );
@@ -28379,8 +23557,6 @@ public:
 	void OnSuccess ( int nRemainingResources );
 };
 
-UClass* UBioSeqAct_SkillGame_Bypass::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_SkillGame_Decryption
 // 0x000F (0x00E0 - 0x00D1)
 class UBioSeqAct_SkillGame_Decryption : public UBioSeqAct_SkillGame_Base
@@ -28390,16 +23566,9 @@ public:
 	int                                                m_nPercentGood;                                   		// 0x00D8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	float                                              m_fSpeed;                                         		// 0x00DC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1886 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1886 );
 	};
 
 	int eventGetObjClassVersion ( );
@@ -28407,8 +23576,6 @@ public:
 	void OnSuccess ( int nRemainingResources );
 };
 
-UClass* UBioSeqAct_SkillGame_Decryption::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_SkynetEvent
 // 0x0025 (0x00D5 - 0x00B0)
 class UBioSeqAct_SkynetEvent : public USequenceAction
@@ -28421,22 +23588,13 @@ public:
 	unsigned long                                      m_bIsPartyMember : 1;                             		// 0x00D0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned char                                      m_eEventType;                                     		// 0x00D4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1887 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1887 );
 	};
 
 };
 
-UClass* UBioSeqAct_SkynetEvent::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_StopLoadingMovie
 // 0x0004 (0x00C4 - 0x00C0)
 class UBioSeqAct_StopLoadingMovie : public USeqAct_Latent
@@ -28444,60 +23602,35 @@ class UBioSeqAct_StopLoadingMovie : public USeqAct_Latent
 public:
 	unsigned long                                      bDelayStopUntilGameHasRendered : 1;               		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1888 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1888 );
 	};
 
 };
 
-UClass* UBioSeqAct_StopLoadingMovie::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_ToggleLightEnv
 // 0x0000 (0x00B0 - 0x00B0)
 class UBioSeqAct_ToggleLightEnv : public USeqAct_Toggle
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1889 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1889 );
 	};
 
 };
 
-UClass* UBioSeqAct_ToggleLightEnv::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqEvt_BackgroundStreamingDone
 // 0x0000 (0x00D2 - 0x00D2)
 class UBioSeqEvt_BackgroundStreamingDone : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1890 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1890 );
 	};
 
 	void eventToggled ( );
@@ -28507,8 +23640,6 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* UBioSeqEvt_BackgroundStreamingDone::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqEvt_CinematicSkipped
 // 0x000E (0x00E0 - 0x00D2)
 class UBioSeqEvt_CinematicSkipped : public USequenceEvent
@@ -28516,22 +23647,13 @@ class UBioSeqEvt_CinematicSkipped : public USequenceEvent
 public:
 	struct FString                                     sEvent;                                           		// 0x00D4 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1891 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1891 );
 	};
 
 };
 
-UClass* UBioSeqEvt_CinematicSkipped::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqEvt_Conversation
 // 0x0013 (0x00E5 - 0x00D2)
 class UBioSeqEvt_Conversation : public USequenceEvent
@@ -28543,22 +23665,13 @@ public:
 	unsigned long                                      bFireForAmbient : 1;                              		// 0x00E0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned char                                      eScriptType;                                      		// 0x00E4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1892 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1892 );
 	};
 
 };
 
-UClass* UBioSeqEvt_Conversation::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqEvt_ConvNode
 // 0x000A (0x00DC - 0x00D2)
 class UBioSeqEvt_ConvNode : public USequenceEvent
@@ -28567,38 +23680,22 @@ public:
 	int                                                m_nNodeID;                                        		// 0x00D4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	int                                                m_nConvResRefID;                                  		// 0x00D8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1893 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1893 );
 	};
 
 };
 
-UClass* UBioSeqEvt_ConvNode::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqEvt_ForegroundStreamingDone
 // 0x0000 (0x00D2 - 0x00D2)
 class UBioSeqEvt_ForegroundStreamingDone : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1894 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1894 );
 	};
 
 	void eventToggled ( );
@@ -28608,8 +23705,6 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* UBioSeqEvt_ForegroundStreamingDone::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqEvt_GalaxyMap
 // 0x0016 (0x00E8 - 0x00D2)
 class UBioSeqEvt_GalaxyMap : public USequenceEvent
@@ -28618,38 +23713,22 @@ public:
 	struct FString                                     sEvent;                                           		// 0x00D4 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	struct FName                                       EventParameter;                                   		// 0x00E0 (0x0008) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1895 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1895 );
 	};
 
 };
 
-UClass* UBioSeqEvt_GalaxyMap::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqEvt_OnPlayerActivate
 // 0x0000 (0x00D2 - 0x00D2)
 class UBioSeqEvt_OnPlayerActivate : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1896 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1896 );
 	};
 
 	void eventToggled ( );
@@ -28659,8 +23738,6 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* UBioSeqEvt_OnPlayerActivate::pClassPointer = NULL;
-
 // Class SFXGame.BioSequenceLatentAction
 // 0x0004 (0x00C4 - 0x00C0)
 class UBioSequenceLatentAction : public USeqAct_Latent
@@ -28668,23 +23745,14 @@ class UBioSequenceLatentAction : public USeqAct_Latent
 public:
 	unsigned long                                      bHasTargets : 1;                                  		// 0x00C0 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1897 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1897 );
 	};
 
 	bool eventUpdateOp ( float DeltaTime );
 };
 
-UClass* UBioSequenceLatentAction::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_BlackScreen
 // 0x0009 (0x00CD - 0x00C4)
 class UBioSeqAct_BlackScreen : public UBioSequenceLatentAction
@@ -28694,24 +23762,15 @@ public:
 	float                                              fTimeDelay;                                       		// 0x00C8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      m_eBlackScreenAction;                             		// 0x00CC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1898 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1898 );
 	};
 
 	bool UpdateOp ( float fDeltaT );
 	void eventActivated ( );
 };
 
-UClass* UBioSeqAct_BlackScreen::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_FaceOnlyVO
 // 0x0092 (0x0156 - 0x00C4)
 class UBioSeqAct_FaceOnlyVO : public UBioSequenceLatentAction
@@ -28751,24 +23810,15 @@ public:
 	unsigned char                                      m_eSpeakerList;                                   		// 0x0154 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      m_eConvLine;                                      		// 0x0155 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1899 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1899 );
 	};
 
 	void eventPreVersionUpdated ( int OldVersion, int NewVersion );
 	int eventGetObjClassVersion ( );
 };
 
-UClass* UBioSeqAct_FaceOnlyVO::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_MovieBink
 // 0x0024 (0x00E8 - 0x00C4)
 class UBioSeqAct_MovieBink : public UBioSequenceLatentAction
@@ -28781,16 +23831,9 @@ public:
 	unsigned long                                      m_bKeepTryingToPlay : 1;                          		// 0x00E4 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 	unsigned long                                      IsComplete : 1;                                   		// 0x00E4 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1900 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1900 );
 	};
 
 	int eventGetObjClassVersion ( );
@@ -28798,8 +23841,6 @@ public:
 	void eventActivated ( );
 };
 
-UClass* UBioSeqAct_MovieBink::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_PlatformMovieBink
 // 0x000C (0x00F4 - 0x00E8)
 class USFXSeqAct_PlatformMovieBink : public UBioSeqAct_MovieBink
@@ -28807,22 +23848,13 @@ class USFXSeqAct_PlatformMovieBink : public UBioSeqAct_MovieBink
 public:
 	TArray< unsigned char >                            Platforms;                                        		// 0x00E8 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1901 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1901 );
 	};
 
 };
 
-UClass* USFXSeqAct_PlatformMovieBink::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_ShowChoiceGUI
 // 0x003D (0x0101 - 0x00C4)
 class UBioSeqAct_ShowChoiceGUI : public UBioSequenceLatentAction
@@ -28848,16 +23880,9 @@ public:
 	unsigned long                                      m_bWasPaused : 1;                                 		// 0x00FC (0x0004) [0x0000000000002000] [0x00000020] ( CPF_Transient )
 	unsigned char                                      m_eResource;                                      		// 0x0100 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1902 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1902 );
 	};
 
 	int eventGetObjClassVersion ( );
@@ -28865,8 +23890,6 @@ public:
 	bool UpdateOp ( float fDeltaT );
 };
 
-UClass* UBioSeqAct_ShowChoiceGUI::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_LaunchWeaponSelection
 // 0x0020 (0x00E4 - 0x00C4)
 class USFXSeqAct_LaunchWeaponSelection : public UBioSequenceLatentAction
@@ -28884,16 +23907,9 @@ public:
 	unsigned long                                      AutoEquipWhenDone : 1;                            		// 0x00E0 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 	unsigned long                                      PauseGame : 1;                                    		// 0x00E0 (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1903 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1903 );
 	};
 
 	void eventCleanup ( );
@@ -28912,8 +23928,6 @@ public:
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_LaunchWeaponSelection::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_StartAmbientConv
 // 0x0020 (0x00E4 - 0x00C4)
 class USFXSeqAct_StartAmbientConv : public UBioSequenceLatentAction
@@ -28935,22 +23949,13 @@ public:
 	unsigned long                                      m_bPreLoading : 1;                                		// 0x00E0 (0x0004) [0x0000000000002000] [0x00000100] ( CPF_Transient )
 	unsigned long                                      m_bPlayRequested : 1;                             		// 0x00E0 (0x0004) [0x0000000000002000] [0x00000200] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1904 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1904 );
 	};
 
 };
 
-UClass* USFXSeqAct_StartAmbientConv::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_StartConversation
 // 0x000C (0x00F0 - 0x00E4)
 class USFXSeqAct_StartConversation : public USFXSeqAct_StartAmbientConv
@@ -28963,23 +23968,14 @@ public:
 	unsigned long                                      m_bFadeIn : 1;                                    		// 0x00EC (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 	unsigned long                                      m_bBlackOut : 1;                                  		// 0x00EC (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1905 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1905 );
 	};
 
 	int eventGetObjClassVersion ( );
 };
 
-UClass* USFXSeqAct_StartConversation::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqVar_ChoiceGUIData
 // 0x0004 (0x0080 - 0x007C)
 class UBioSeqVar_ChoiceGUIData : public USeqVar_Object
@@ -28987,22 +23983,13 @@ class UBioSeqVar_ChoiceGUIData : public USeqVar_Object
 public:
 	class USFXGameChoiceGUIData*                       m_ChoiceData;                                     		// 0x007C (0x0004) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1906 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1906 );
 	};
 
 };
 
-UClass* UBioSeqVar_ChoiceGUIData::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqVar_ObjectFindByTag
 // 0x000C (0x0088 - 0x007C)
 class UBioSeqVar_ObjectFindByTag : public USeqVar_Object
@@ -29011,22 +23998,13 @@ public:
 	struct FName                                       m_sObjectTagToFind;                               		// 0x007C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      m_bSearchUniqueTag : 1;                           		// 0x0084 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1907 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1907 );
 	};
 
 };
 
-UClass* UBioSeqVar_ObjectFindByTag::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqVar_StoryManagerBool
 // 0x0013 (0x0073 - 0x0060)
 class UBioSeqVar_StoryManagerBool : public USeqVar_Bool
@@ -29038,22 +24016,13 @@ public:
 	unsigned char                                      Plot;                                             		// 0x0071 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      State;                                            		// 0x0072 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1908 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1908 );
 	};
 
 };
 
-UClass* UBioSeqVar_StoryManagerBool::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqVar_StoryManagerFloat
 // 0x0013 (0x0073 - 0x0060)
 class UBioSeqVar_StoryManagerFloat : public USeqVar_Float
@@ -29065,22 +24034,13 @@ public:
 	unsigned char                                      Plot;                                             		// 0x0071 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      Float;                                            		// 0x0072 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1909 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1909 );
 	};
 
 };
 
-UClass* UBioSeqVar_StoryManagerFloat::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqVar_StoryManagerInt
 // 0x0013 (0x0073 - 0x0060)
 class UBioSeqVar_StoryManagerInt : public USeqVar_Int
@@ -29092,22 +24052,13 @@ public:
 	unsigned char                                      Plot;                                             		// 0x0071 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      Int;                                              		// 0x0072 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1910 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1910 );
 	};
 
 };
 
-UClass* UBioSeqVar_StoryManagerInt::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqVar_StoryManagerStateId
 // 0x0007 (0x0067 - 0x0060)
 class UBioSeqVar_StoryManagerStateId : public USeqVar_Int
@@ -29118,22 +24069,13 @@ public:
 	unsigned char                                      Plot;                                             		// 0x0065 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      State;                                            		// 0x0066 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1911 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1911 );
 	};
 
 };
 
-UClass* UBioSeqVar_StoryManagerStateId::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_AIFactory2
 // 0x0055 (0x0105 - 0x00B0)
 class USFXSeqAct_AIFactory2 : public USequenceAction
@@ -29158,16 +24100,9 @@ public:
 	unsigned long                                      bPreventSave : 1;                                 		// 0x0100 (0x0004) [0x0000000000000001] [0x00000040] ( CPF_Edit )
 	unsigned char                                      SpawnSelectionType;                               		// 0x0104 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1912 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1912 );
 	};
 
 	class AProjectile* eventSpawnObscuringEffect ( struct FAISpawnInfo Set );
@@ -29178,8 +24113,6 @@ public:
 	void NotifyCombatEntered ( );
 };
 
-UClass* USFXSeqAct_AIFactory2::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_AwardTreasure_Base
 // 0x0001 (0x00B1 - 0x00B0)
 class USFXSeqAct_AwardTreasure_Base : public USequenceAction
@@ -29187,46 +24120,28 @@ class USFXSeqAct_AwardTreasure_Base : public USequenceAction
 public:
 	unsigned char                                      TREASURE;                                         		// 0x00B0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1913 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1913 );
 	};
 
 	int eventGetObjClassVersion ( );
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_AwardTreasure_Base::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_CharCreateClass
 // 0x0000 (0x00B0 - 0x00B0)
 class USFXSeqAct_CharCreateClass : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1914 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1914 );
 	};
 
 };
 
-UClass* USFXSeqAct_CharCreateClass::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_CloseChoiceGui
 // 0x0008 (0x00B8 - 0x00B0)
 class USFXSeqAct_CloseChoiceGui : public USequenceAction
@@ -29234,22 +24149,13 @@ class USFXSeqAct_CloseChoiceGui : public USequenceAction
 public:
 	struct FName                                       m_nmTag;                                          		// 0x00B0 (0x0008) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1915 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1915 );
 	};
 
 };
 
-UClass* USFXSeqAct_CloseChoiceGui::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_CreateNotification
 // 0x0020 (0x00D0 - 0x00B0)
 class USFXSeqAct_CreateNotification : public USequenceAction
@@ -29263,23 +24169,14 @@ public:
 	float                                              fDisplayTime;                                     		// 0x00C8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	class UTexture*                                    oImage;                                           		// 0x00CC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1916 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1916 );
 	};
 
 	int eventGetObjClassVersion ( );
 };
 
-UClass* USFXSeqAct_CreateNotification::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_DummyWeaponFire
 // 0x0072 (0x0132 - 0x00C0)
 class USFXSeqAct_DummyWeaponFire : public USeqAct_Latent
@@ -29311,16 +24208,9 @@ public:
 	unsigned char                                      FiringMode;                                       		// 0x0130 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      TeamIndex;                                        		// 0x0131 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1917 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1917 );
 	};
 
 	void eventSetRemainingTime ( unsigned char DummyFiringMode );
@@ -29330,8 +24220,6 @@ public:
 	void SpawnDummyWeapon ( class AActor* OriginActor, class AActor* TargetActor );
 };
 
-UClass* USFXSeqAct_DummyWeaponFire::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_EnableAI
 // 0x0004 (0x00C4 - 0x00C0)
 class USFXSeqAct_EnableAI : public USeqAct_Latent
@@ -29340,23 +24228,14 @@ public:
 	unsigned long                                      m_bEnable : 1;                                    		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      m_bFirstPass : 1;                                 		// 0x00C0 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1918 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1918 );
 	};
 
 	int eventGetObjClassVersion ( );
 };
 
-UClass* USFXSeqAct_EnableAI::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_FireWeaponAt
 // 0x0020 (0x00E0 - 0x00C0)
 class USFXSeqAct_FireWeaponAt : public USeqAct_Latent
@@ -29373,16 +24252,9 @@ public:
 	unsigned long                                      bForceShoot : 1;                                  		// 0x00DC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned long                                      m_bDone : 1;                                      		// 0x00DC (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1919 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1919 );
 	};
 
 	int eventGetObjClassVersion ( );
@@ -29391,30 +24263,19 @@ public:
 	void FireWeaponCallback ( int nReason );
 };
 
-UClass* USFXSeqAct_FireWeaponAt::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_FreezeLevelStreaming
 // 0x0000 (0x00B0 - 0x00B0)
 class USFXSeqAct_FreezeLevelStreaming : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1920 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1920 );
 	};
 
 };
 
-UClass* USFXSeqAct_FreezeLevelStreaming::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_HenchmanUseInteractionPoint
 // 0x0010 (0x00D0 - 0x00C0)
 class USFXSeqAct_HenchmanUseInteractionPoint : public USeqAct_Latent
@@ -29427,16 +24288,9 @@ public:
 	unsigned long                                      m_bDone : 1;                                      		// 0x00CC (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned long                                      m_bSuccess : 1;                                   		// 0x00CC (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1921 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1921 );
 	};
 
 	bool eventCanDoInteraction ( );
@@ -29446,8 +24300,6 @@ public:
 	void ReachedInteractionCallback ( );
 };
 
-UClass* USFXSeqAct_HenchmanUseInteractionPoint::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_InitLoadingMovies
 // 0x0024 (0x00D4 - 0x00B0)
 class USFXSeqAct_InitLoadingMovies : public USequenceAction
@@ -29461,23 +24313,14 @@ public:
 	unsigned long                                      PlayToCompletion : 1;                             		// 0x00D0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 	unsigned long                                      StreamFromDisc : 1;                               		// 0x00D0 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1922 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1922 );
 	};
 
 	int eventGetObjClassVersion ( );
 };
 
-UClass* USFXSeqAct_InitLoadingMovies::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_IsPawnInCover
 // 0x0004 (0x00B4 - 0x00B0)
 class USFXSeqAct_IsPawnInCover : public USequenceAction
@@ -29485,23 +24328,14 @@ class USFXSeqAct_IsPawnInCover : public USequenceAction
 public:
 	class AActor*                                      oTargetActor;                                     		// 0x00B0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1923 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1923 );
 	};
 
 	int eventGetObjClassVersion ( );
 };
 
-UClass* USFXSeqAct_IsPawnInCover::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_LookAtPOI
 // 0x0038 (0x00F8 - 0x00C0)
 class USFXSeqAct_LookAtPOI : public USeqAct_Latent
@@ -29521,16 +24355,9 @@ public:
 	unsigned long                                      m_bPOIActive : 1;                                 		// 0x00F4 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 	unsigned long                                      m_bDurationUpdating : 1;                          		// 0x00F4 (0x0004) [0x0000000000002000] [0x00000010] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1924 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1924 );
 	};
 
 	void CalcCameraPosition ( float fTimeDelta, struct FVector* vCameraLocation, struct FVector* vUnderneathCamLoc, struct FVector* vTargetLocation );
@@ -29542,8 +24369,6 @@ public:
 	void eventAddPOITarget ( class ABioPlayerController* pBPC );
 };
 
-UClass* USFXSeqAct_LookAtPOI::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_MoveOnSplineNativeBase
 // 0x0004 (0x00C4 - 0x00C0)
 class USFXSeqAct_MoveOnSplineNativeBase : public USeqAct_Latent
@@ -29551,23 +24376,14 @@ class USFXSeqAct_MoveOnSplineNativeBase : public USeqAct_Latent
 public:
 	unsigned long                                      m_bSFXCreatedBeforeStuntActorLocationChange : 1;  		// 0x00C0 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1925 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1925 );
 	};
 
 	void MoveActor ( class AActor* Actor, struct FVector NewLocation );
 };
 
-UClass* USFXSeqAct_MoveOnSplineNativeBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_MoveToNode
 // 0x0020 (0x00E0 - 0x00C0)
 class USFXSeqAct_MoveToNode : public USeqAct_Latent
@@ -29585,16 +24401,9 @@ public:
 	unsigned long                                      m_bDone : 1;                                      		// 0x00DC (0x0004) [0x0000000000000000] [0x00000004] 
 	unsigned long                                      m_bWasWalkingBefore : 1;                          		// 0x00DC (0x0004) [0x0000000000000000] [0x00000008] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1926 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1926 );
 	};
 
 	int eventGetObjClassVersion ( );
@@ -29603,8 +24412,6 @@ public:
 	void MoveToCallback ( int nReason );
 };
 
-UClass* USFXSeqAct_MoveToNode::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_PrimeMovie
 // 0x0020 (0x00E0 - 0x00C0)
 class USFXSeqAct_PrimeMovie : public USeqAct_Latent
@@ -29614,45 +24421,27 @@ public:
 	struct FString                                     MovieName;                                        		// 0x00D0 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	unsigned long                                      IsComplete : 1;                                   		// 0x00DC (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1927 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1927 );
 	};
 
 	int eventGetObjClassVersion ( );
 };
 
-UClass* USFXSeqAct_PrimeMovie::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_ReportLevelLoadTime
 // 0x0000 (0x00B0 - 0x00B0)
 class USFXSeqAct_ReportLevelLoadTime : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1928 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1928 );
 	};
 
 };
 
-UClass* USFXSeqAct_ReportLevelLoadTime::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_SetAmbientPerformance
 // 0x0014 (0x00C4 - 0x00B0)
 class USFXSeqAct_SetAmbientPerformance : public USequenceAction
@@ -29663,22 +24452,13 @@ public:
 	class USFXAmbPerfGameData*                         m_pPerfGameData;                                  		// 0x00BC (0x0004) [0x0000000000000000]              
 	unsigned long                                      m_bReturnToDefaultPose : 1;                       		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1929 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1929 );
 	};
 
 };
 
-UClass* USFXSeqAct_SetAmbientPerformance::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_SetStringref
 // 0x0008 (0x00B8 - 0x00B0)
 class USFXSeqAct_SetStringref : public USeqAct_SetSequenceVariable
@@ -29687,23 +24467,14 @@ public:
 	void*                                              Target;                                           		// 0x00B0 (0x0004) [0x0000000000000000]              
 	void*                                              Value;                                            		// 0x00B4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1930 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1930 );
 	};
 
 	int eventGetObjClassVersion ( );
 };
 
-UClass* USFXSeqAct_SetStringref::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_ToggleCombatPawn
 // 0x0014 (0x00D4 - 0x00C0)
 class USFXSeqAct_ToggleCombatPawn : public USeqAct_Latent
@@ -29719,16 +24490,9 @@ public:
 	unsigned long                                      bNewCombatPawn : 1;                               		// 0x00D0 (0x0004) [0x0000000000002000] [0x00000010] ( CPF_Transient )
 	unsigned long                                      bInjuredPawn : 1;                                 		// 0x00D0 (0x0004) [0x0000000000002000] [0x00000020] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1931 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1931 );
 	};
 
 	void eventTogglePawn ( );
@@ -29736,8 +24500,6 @@ public:
 	int eventGetObjClassVersion ( );
 };
 
-UClass* USFXSeqAct_ToggleCombatPawn::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_UsePowerOn
 // 0x0025 (0x00E5 - 0x00C0)
 class USFXSeqAct_UsePowerOn : public USeqAct_Latent
@@ -29753,16 +24515,9 @@ public:
 	unsigned long                                      m_bDone : 1;                                      		// 0x00E0 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned char                                      ePower;                                           		// 0x00E4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1932 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1932 );
 	};
 
 	int eventGetObjClassVersion ( );
@@ -29771,8 +24526,6 @@ public:
 	void UsePowerCallback ( int nReason );
 };
 
-UClass* USFXSeqAct_UsePowerOn::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_WaitForGFxMovieClose
 // 0x0008 (0x00C8 - 0x00C0)
 class USFXSeqAct_WaitForGFxMovieClose : public USeqAct_Latent
@@ -29781,22 +24534,13 @@ public:
 	class USFXGUIMovieKismet*                          movie;                                            		// 0x00C0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      DeferredClose : 1;                                		// 0x00C4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1933 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1933 );
 	};
 
 };
 
-UClass* USFXSeqAct_WaitForGFxMovieClose::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_WaitForStreamingComplete
 // 0x0004 (0x00C4 - 0x00C0)
 class USFXSeqAct_WaitForStreamingComplete : public USeqAct_Latent
@@ -29806,46 +24550,28 @@ public:
 	unsigned long                                      bBlocking : 1;                                    		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned long                                      bWaitForUnvisibleAndUnloaded : 1;                 		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1934 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1934 );
 	};
 
 };
 
-UClass* USFXSeqAct_WaitForStreamingComplete::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_WaitUntilLevelIsLive
 // 0x0000 (0x00C0 - 0x00C0)
 class USFXSeqAct_WaitUntilLevelIsLive : public USeqAct_Latent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1935 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1935 );
 	};
 
 	bool eventUpdate ( float DeltaTime );
 	void AbortFor ( class AActor* latentActor, unsigned long bCancel );
 };
 
-UClass* USFXSeqAct_WaitUntilLevelIsLive::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqEvt_AmbientPerformance
 // 0x002B (0x00FD - 0x00D2)
 class USFXSeqEvt_AmbientPerformance : public USequenceEvent
@@ -29858,23 +24584,14 @@ public:
 	struct FName                                       m_nmGestureAnimName;                              		// 0x00F4 (0x0008) [0x0000000000000000]              
 	unsigned char                                      m_eEventType;                                     		// 0x00FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1936 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1936 );
 	};
 
 	int eventGetObjClassVersion ( );
 };
 
-UClass* USFXSeqEvt_AmbientPerformance::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqEvt_LevelIsLive
 // 0x0006 (0x00D8 - 0x00D2)
 class USFXSeqEvt_LevelIsLive : public USequenceEvent
@@ -29882,22 +24599,13 @@ class USFXSeqEvt_LevelIsLive : public USequenceEvent
 public:
 	unsigned long                                      m_bInitialized : 1;                               		// 0x00D4 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1937 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1937 );
 	};
 
 };
 
-UClass* USFXSeqEvt_LevelIsLive::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqEvt_PersistentLevelStarted
 // 0x0006 (0x00D8 - 0x00D2)
 class USFXSeqEvt_PersistentLevelStarted : public USequenceEvent
@@ -29907,38 +24615,22 @@ public:
 	unsigned long                                      bKeepLoadMovie : 1;                               		// 0x00D4 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned long                                      bSkipTextureStreaming : 1;                        		// 0x00D4 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1938 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1938 );
 	};
 
 };
 
-UClass* USFXSeqEvt_PersistentLevelStarted::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqEvt_Touch
 // 0x0000 (0x00FC - 0x00FC)
 class USFXSeqEvt_Touch : public USeqEvent_Touch
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1939 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1939 );
 	};
 
 	int eventGetObjClassVersion ( );
@@ -29948,8 +24640,6 @@ public:
 	bool CheckTouchActivate ( class AActor* inOriginator, class AActor* inInstigator, unsigned long bTest );
 };
 
-UClass* USFXSeqEvt_Touch::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqVar_Hench
 // 0x0024 (0x00A0 - 0x007C)
 class USFXSeqVar_Hench : public USeqVar_Object
@@ -29967,22 +24657,13 @@ public:
 	unsigned long                                      m_bCalculatedValue : 1;                           		// 0x009C (0x0004) [0x0000000000002000] [0x00000040] ( CPF_Transient )
 	unsigned long                                      m_bCalculatedTag : 1;                             		// 0x009C (0x0004) [0x0000000000002000] [0x00000080] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1940 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1940 );
 	};
 
 };
 
-UClass* USFXSeqVar_Hench::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqVar_SavedBool
 // 0x0010 (0x0070 - 0x0060)
 class USFXSeqVar_SavedBool : public USeqVar_Bool
@@ -29990,22 +24671,13 @@ class USFXSeqVar_SavedBool : public USeqVar_Bool
 public:
 	struct FGuid                                       MyGuid;                                           		// 0x0060 (0x0010) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1941 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1941 );
 	};
 
 };
 
-UClass* USFXSeqVar_SavedBool::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqVar_ToolTip
 // 0x0001 (0x0061 - 0x0060)
 class USFXSeqVar_ToolTip : public USeqVar_Int
@@ -30013,22 +24685,13 @@ class USFXSeqVar_ToolTip : public USeqVar_Int
 public:
 	unsigned char                                      TipText;                                          		// 0x0060 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1942 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1942 );
 	};
 
 };
 
-UClass* USFXSeqVar_ToolTip::pClassPointer = NULL;
-
 // Class SFXGame.SFXAccomplishmentStorage
 // 0x0070 (0x00AC - 0x003C)
 class USFXAccomplishmentStorage : public UObject
@@ -30047,16 +24710,9 @@ public:
 	int                                                ChallengeSystemVersionNumber;                     		// 0x00A4 (0x0004) [0x0000000000000000]              
 	unsigned long                                      IsInvalid : 1;                                    		// 0x00A8 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1943 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1943 );
 	};
 
 	void UpdateServerValue ( );
@@ -30083,8 +24739,6 @@ public:
 	void Initialize ( int MinProgressValuesLength, int MinRewardValuesLength );
 };
 
-UClass* USFXAccomplishmentStorage::pClassPointer = NULL;
-
 // Class SFXGame.SFXOnlineComponentMatchMakingBot
 // 0x001C (0x0080 - 0x0064)
 class USFXOnlineComponentMatchMakingBot : public USFXOnlineComponent
@@ -30100,16 +24754,9 @@ public:
 	unsigned long                                      SimulateDisconnect : 1;                           		// 0x007C (0x0004) [0x0000000000004000] [0x00000002] ( CPF_Config )
 	unsigned long                                      FastForwardMode : 1;                              		// 0x007C (0x0004) [0x0000000000004000] [0x00000004] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1945 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1945 );
 	};
 
 	void OnCreateMatchComplete ( struct FName SessionName, unsigned long bWasSuccessful );
@@ -30136,8 +24783,6 @@ public:
 	void OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem );
 };
 
-UClass* USFXOnlineComponentMatchMakingBot::pClassPointer = NULL;
-
 // Class SFXGame.SFXOnlineComponentUI
 // 0x0058 (0x00BC - 0x0064)
 class USFXOnlineComponentUI : public USFXOnlineComponent
@@ -30153,16 +24798,9 @@ public:
 	struct FName                                       HandlerId;                                        		// 0x00B0 (0x0008) [0x0000000000000000]              
 	class USFXSFHandler_EANetworking*                  m_oGUI;                                           		// 0x00B8 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1946 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1946 );
 	};
 
 	void ClearDelegates ( );
@@ -30226,8 +24864,6 @@ public:
 	void OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem );
 };
 
-UClass* USFXOnlineComponentUI::pClassPointer = NULL;
-
 // Class SFXGame.SFXOnlineGameEntryFlow
 // 0x0096 (0x00FA - 0x0064)
 class USFXOnlineGameEntryFlow : public USFXOnlineComponent
@@ -30252,16 +24888,9 @@ public:
 	unsigned char                                      m_FlowType;                                       		// 0x00F8 (0x0001) [0x0000000000000000]              
 	unsigned char                                      m_LoginUIState;                                   		// 0x00F9 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1947 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1947 );
 	};
 
 	void eventDestroyed ( );
@@ -30307,8 +24936,6 @@ public:
 	void OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem );
 };
 
-UClass* USFXOnlineGameEntryFlow::pClassPointer = NULL;
-
 // Class SFXGame.SFXOnlinePlayerStorage
 // 0x0017 (0x007C - 0x0065)
 class USFXOnlinePlayerStorage : public UOnlinePlayerStorage
@@ -30318,16 +24945,9 @@ public:
 	float                                              fMinDelayBetweenWrite;                            		// 0x0074 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	int                                                iMaxBytesPerStorage;                              		// 0x0078 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1948 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1948 );
 	};
 
 	void AcknowledgeWriteComplete ( unsigned char LocalUserNum, struct FScriptDelegate WritePlayerStorageCompleteDelegate );
@@ -30336,8 +24956,6 @@ public:
 	void SetBaseProfileSettings ( );
 };
 
-UClass* USFXOnlinePlayerStorage::pClassPointer = NULL;
-
 // Class SFXGame.SFXOnlineSaveGameMP
 // 0x0048 (0x0084 - 0x003C)
 class USFXOnlineSaveGameMP : public UObject
@@ -30353,16 +24971,9 @@ public:
 	unsigned long                                      bDebugSaving : 1;                                 		// 0x0080 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned long                                      bUseOldSavingSystem : 1;                          		// 0x0080 (0x0004) [0x0000000000004000] [0x00000002] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1949 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1949 );
 	};
 
 	void Initialize ( );
@@ -30416,8 +25027,6 @@ public:
 	struct FString HexEncodeNumber ( int numToEncode );
 };
 
-UClass* USFXOnlineSaveGameMP::pClassPointer = NULL;
-
 // Class SFXGame.BioBaseSquad
 // 0x0032 (0x0228 - 0x01F6)
 class ABioBaseSquad : public AActor
@@ -30434,16 +25043,9 @@ public:
 	unsigned long                                      bSquadEnabled : 1;                                		// 0x0224 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 	unsigned long                                      PathingTowardCombatZone : 1;                      		// 0x0224 (0x0004) [0x0000000000000000] [0x00000010] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1950 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1950 );
 	};
 
 	void NotifyCombatZoneRemoved ( );
@@ -30481,8 +25083,6 @@ public:
 	bool RemoveMember ( class APawn* pPawn );
 };
 
-UClass* ABioBaseSquad::pClassPointer = NULL;
-
 // Class SFXGame.BioPlayerSquad
 // 0x0020 (0x0248 - 0x0228)
 class ABioPlayerSquad : public ABioBaseSquad
@@ -30495,16 +25095,9 @@ public:
 	float                                              m_fPercentHealthOnResurrection;                   		// 0x0240 (0x0004) [0x0000000000000002]              ( CPF_Const )
 	unsigned long                                      m_bEngagedHostileAction : 1;                      		// 0x0244 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1951 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1951 );
 	};
 
 	void SetMemberMoveIndicator ( int nIndex, class ABioTacticalMoveToIndicator* oIndicator );
@@ -30524,8 +25117,6 @@ public:
 	void eventPostBeginPlay ( );
 };
 
-UClass* ABioPlayerSquad::pClassPointer = NULL;
-
 // Class SFXGame.BioSquadHoldMarker
 // 0x001C (0x02E0 - 0x02C4)
 class ABioSquadHoldMarker : public ANavigationPoint
@@ -30535,24 +25126,15 @@ public:
 	struct FVector                                     LiftOffset;                                       		// 0x02D0 (0x000C) [0x0000000000000000]              
 	class AInterpActor*                                MyLift;                                           		// 0x02DC (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1952 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1952 );
 	};
 
 	void PostBeginPlay ( );
 	void SetBaseByTag ( );
 };
 
-UClass* ABioSquadHoldMarker::pClassPointer = NULL;
-
 // Class SFXGame.BioSquadLinesComponent
 // 0x0018 (0x01E4 - 0x01CC)
 class UBioSquadLinesComponent : public UPrimitiveComponent
@@ -30565,22 +25147,13 @@ public:
 	struct FColor                                      vDynamicCoverColor;                               		// 0x01DC (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned long                                      bInited : 1;                                      		// 0x01E0 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1953 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1953 );
 	};
 
 };
 
-UClass* UBioSquadLinesComponent::pClassPointer = NULL;
-
 // Class SFXGame.BioSquadTargetData
 // 0x0060 (0x009C - 0x003C)
 class UBioSquadTargetData : public UObject
@@ -30588,22 +25161,13 @@ class UBioSquadTargetData : public UObject
 public:
 	struct FSquadTargetData                            m_aSimpleSquadTargets[ 0x3 ];                     		// 0x003C (0x0060) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1954 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1954 );
 	};
 
 };
 
-UClass* UBioSquadTargetData::pClassPointer = NULL;
-
 // Class SFXGame.SFXTelemetry
 // 0x0074 (0x00B0 - 0x003C)
 class USFXTelemetry : public UObject
@@ -30619,16 +25183,9 @@ public:
 	unsigned long                                      bCachedCollectionEnabledInProfile : 1;            		// 0x00AC (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned long                                      bInitialized : 1;                                 		// 0x00AC (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1955 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1955 );
 	};
 
 	void SendCachedDisconnectEvent ( );
@@ -30656,8 +25213,6 @@ public:
 	class USFXTelemetryGameSession* GetInstanceGameSession ( );
 };
 
-UClass* USFXTelemetry::pClassPointer = NULL;
-
 // Class SFXGame.SFXTelemetryGameSession
 // 0x0098 (0x00D4 - 0x003C)
 class USFXTelemetryGameSession : public UObject
@@ -30695,16 +25250,9 @@ public:
 	unsigned long                                      bPlayerHasMic : 1;                                		// 0x00D0 (0x0004) [0x0000000000000000] [0x00000040] 
 	unsigned long                                      bPlayerUsedMic : 1;                               		// 0x00D0 (0x0004) [0x0000000000000000] [0x00000080] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1956 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1956 );
 	};
 
 	void eventSendClientMPSessionStart ( );
@@ -30714,8 +25262,6 @@ public:
 	void Encode64_GUID ( struct FGuid* i_guid, struct FString* o_Base64Result );
 };
 
-UClass* USFXTelemetryGameSession::pClassPointer = NULL;
-
 // Class SFXGame.SFXVehicle_MountedGun
 // 0x006C (0x0668 - 0x05FC)
 class ASFXVehicle_MountedGun : public ASVehicle
@@ -30750,16 +25296,9 @@ public:
 	unsigned long                                      bFiring : 1;                                      		// 0x0664 (0x0004) [0x0000000000002000] [0x00000010] ( CPF_Transient )
 	unsigned long                                      bForceTightAim : 1;                               		// 0x0664 (0x0004) [0x0000000000000001] [0x00000020] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1957 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1957 );
 	};
 
 	bool ImpactWithPower ( unsigned char Resistance, class APawn* Caster, struct FVector HitLocation, struct FVector HitNormal, float Damage, struct FVector Force, class UClass* DamageType );
@@ -30787,8 +25326,6 @@ public:
 	void UpdateForMovingBase ( class AActor* BaseActor );
 };
 
-UClass* ASFXVehicle_MountedGun::pClassPointer = NULL;
-
 // Class SFXGame.SFXVehicleHover
 // 0x0108 (0x0704 - 0x05FC)
 class ASFXVehicleHover : public ASVehicle
@@ -30858,16 +25395,9 @@ public:
 	unsigned long                                      bMiningFailed : 1;                                		// 0x0700 (0x0004) [0x0000000000002000] [0x00000010] ( CPF_Transient )
 	unsigned long                                      m_bIsPaused : 1;                                  		// 0x0700 (0x0004) [0x0000000000002000] [0x00000020] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1958 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1958 );
 	};
 
 	void eventRigidBodyCollision ( class UPrimitiveComponent* HitComponent, class UPrimitiveComponent* OtherComponent, int ContactIndex, struct FCollisionImpactData* RigidCollisionData );
@@ -30883,8 +25413,6 @@ public:
 	void AddDefaultInventory ( );
 };
 
-UClass* ASFXVehicleHover::pClassPointer = NULL;
-
 // Class SFXGame.SFXVehicleSimHover
 // 0x00A4 (0x0134 - 0x0090)
 class USFXVehicleSimHover : public USVehicleSimBase
@@ -30936,22 +25464,13 @@ public:
 	unsigned long                                      bCanClimbSlopes : 1;                              		// 0x0130 (0x0004) [0x0000000000000000] [0x00000200] 
 	unsigned long                                      bUnPoweredDriving : 1;                            		// 0x0130 (0x0004) [0x0000000000000000] [0x00000400] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1959 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1959 );
 	};
 
 };
 
-UClass* USFXVehicleSimHover::pClassPointer = NULL;
-
 // Class SFXGame.BioMapNote
 // 0x002D (0x0223 - 0x01F6)
 class ABioMapNote : public AActor
@@ -30977,23 +25496,14 @@ public:
 	unsigned char                                      Plot;                                             		// 0x0221 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      Conditional;                                      		// 0x0222 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1960 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1960 );
 	};
 
 	bool ShowMapNote ( unsigned long bAreaMap );
 };
 
-UClass* ABioMapNote::pClassPointer = NULL;
-
 // Class SFXGame.BioPathPoint
 // 0x0004 (0x02C8 - 0x02C4)
 class ABioPathPoint : public ANavigationPoint
@@ -31002,23 +25512,14 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x02C4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bAlwaysReachable : 1;                             		// 0x02C4 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1961 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1961 );
 	};
 
 	bool OnCreatureReachedWayPoint ( class APawn* PathFindingCreature );
 };
 
-UClass* ABioPathPoint::pClassPointer = NULL;
-
 // Class SFXGame.BioWaypointLinesComponent
 // 0x0004 (0x01D0 - 0x01CC)
 class UBioWaypointLinesComponent : public UPrimitiveComponent
@@ -31026,22 +25527,13 @@ class UBioWaypointLinesComponent : public UPrimitiveComponent
 public:
 	struct FPointer                                    VfTable_FTickableObject;                          		// 0x01CC (0x0004) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1962 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1962 );
 	};
 
 };
 
-UClass* UBioWaypointLinesComponent::pClassPointer = NULL;
-
 // Class SFXGame.BioWaypointSet
 // 0x0012 (0x0208 - 0x01F6)
 class ABioWaypointSet : public AActor
@@ -31050,46 +25542,28 @@ public:
 	TArray< struct FActorReference >                   WaypointReferences;                               		// 0x01F8 (0x000C) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 	unsigned long                                      AlwaysShow : 1;                                   		// 0x0204 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1963 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1963 );
 	};
 
 	class ANavigationPoint* GetWaypoint ( int nIdx );
 	int FindNearestPoint ( struct FVector vLoc );
 };
 
-UClass* ABioWaypointSet::pClassPointer = NULL;
-
 // Class SFXGame.SFXAnimNotify_RaceWwiseEvent
 // 0x0000 (0x0050 - 0x0050)
 class USFXAnimNotify_RaceWwiseEvent : public UAnimNotify_WwiseEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1964 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1964 );
 	};
 
 };
 
-UClass* USFXAnimNotify_RaceWwiseEvent::pClassPointer = NULL;
-
 // Class SFXGame.RvrAnimNotifyClientEffect
 // 0x0014 (0x0050 - 0x003C)
 class URvrAnimNotifyClientEffect : public UAnimNotify
@@ -31100,22 +25574,13 @@ public:
 	unsigned long                                      m_bStop : 1;                                      		// 0x004C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      m_bAllowCooldown : 1;                             		// 0x004C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1965 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1965 );
 	};
 
 };
 
-UClass* URvrAnimNotifyClientEffect::pClassPointer = NULL;
-
 // Class SFXGame.RvrClientEffectActor
 // 0x000E (0x0204 - 0x01F6)
 class ARvrClientEffectActor : public AActor
@@ -31125,16 +25590,9 @@ public:
 	class URvrClientEffectPool*                        m_pPool;                                          		// 0x01FC (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned long                                      m_bDestroyOnFinished : 1;                         		// 0x0200 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1966 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1966 );
 	};
 
 	void OnToggle ( class USeqAct_Toggle* pAct );
@@ -31148,24 +25606,15 @@ public:
 	void SetTemplate ( class URvrClientEffectInterface* pTemplate );
 };
 
-UClass* ARvrClientEffectActor::pClassPointer = NULL;
-
 // Class SFXGame.RvrClientEffectSpawnable
 // 0x0000 (0x0204 - 0x0204)
 class ARvrClientEffectSpawnable : public ARvrClientEffectActor
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1967 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1967 );
 	};
 
 	void OnToggle ( class USeqAct_Toggle* pAct );
@@ -31179,8 +25628,6 @@ public:
 	void SetTemplate ( class URvrClientEffectInterface* pTemplate );
 };
 
-UClass* ARvrClientEffectSpawnable::pClassPointer = NULL;
-
 // Class SFXGame.RvrClientEffectComponent
 // 0x00B6 (0x010C - 0x0056)
 class URvrClientEffectComponent : public UActorComponent
@@ -31208,16 +25655,9 @@ public:
 	unsigned long                                      m_bBehind : 1;                                    		// 0x0108 (0x0004) [0x0000000000002000] [0x00000100] ( CPF_Transient )
 	unsigned long                                      m_bMultiplayer : 1;                               		// 0x0108 (0x0004) [0x0000000000002000] [0x00000200] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1968 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1968 );
 	};
 
 	void OnEffectFinished ( class URvrClientEffectComponent* pComponent );
@@ -31234,8 +25674,6 @@ public:
 	void SetTemplate ( class URvrClientEffectInterface* pTemplate );
 };
 
-UClass* URvrClientEffectComponent::pClassPointer = NULL;
-
 // Class SFXGame.RvrClientEffectInterface
 // 0x0008 (0x0044 - 0x003C)
 class URvrClientEffectInterface : public UObject
@@ -31244,24 +25682,15 @@ public:
 	int                                                m_nPriority;                                      		// 0x003C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      m_bIgnoreAttachedActorHiddenState : 1;            		// 0x0040 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1969 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1969 );
 	};
 
 	void ApplyParameters ( class URvrClientEffectComponent* pComponent, class URvrClientEffectModuleInstance* pInstance, int nIndex );
 	TArray< class URvrClientEffectModule* > GetModuleArray ( class URvrClientEffectComponent* pComponent );
 };
 
-UClass* URvrClientEffectInterface::pClassPointer = NULL;
-
 // Class SFXGame.RvrClientEffect
 // 0x000C (0x0050 - 0x0044)
 class URvrClientEffect : public URvrClientEffectInterface
@@ -31269,24 +25698,15 @@ class URvrClientEffect : public URvrClientEffectInterface
 public:
 	TArray< class URvrClientEffectModule* >            m_lstModules;                                     		// 0x0044 (0x000C) [0x0000000004400008]              ( CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1970 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1970 );
 	};
 
 	void ApplyParameters ( class URvrClientEffectComponent* pComponent, class URvrClientEffectModuleInstance* pInstance, int nIndex );
 	TArray< class URvrClientEffectModule* > GetModuleArray ( class URvrClientEffectComponent* pComponent );
 };
 
-UClass* URvrClientEffect::pClassPointer = NULL;
-
 // Class SFXGame.RvrClientEffectByImpactMaterial
 // 0x0010 (0x0054 - 0x0044)
 class URvrClientEffectByImpactMaterial : public URvrClientEffectInterface
@@ -31295,23 +25715,14 @@ public:
 	TArray< struct FCEImpactByMaterial >               m_lstImpacts;                                     		// 0x0044 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	class URvrClientEffectInterface*                   DefaultEffect;                                    		// 0x0050 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1971 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1971 );
 	};
 
 	void ApplyParameters ( class URvrClientEffectComponent* pComponent, class URvrClientEffectModuleInstance* pInstance, int nIndex );
 };
 
-UClass* URvrClientEffectByImpactMaterial::pClassPointer = NULL;
-
 // Class SFXGame.RvrClientEffectInstanceConstant
 // 0x0010 (0x0054 - 0x0044)
 class URvrClientEffectInstanceConstant : public URvrClientEffectInterface
@@ -31320,23 +25731,14 @@ public:
 	TArray< struct FRvrClientEffectParameter >         m_lstParameters;                                  		// 0x0044 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	class URvrClientEffectInterface*                   m_pClientEffect;                                  		// 0x0050 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1972 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1972 );
 	};
 
 	void ApplyParameters ( class URvrClientEffectComponent* pComponent, class URvrClientEffectModuleInstance* pInstance, int nIndex );
 };
 
-UClass* URvrClientEffectInstanceConstant::pClassPointer = NULL;
-
 // Class SFXGame.RvrClientEffectMulti
 // 0x000C (0x0050 - 0x0044)
 class URvrClientEffectMulti : public URvrClientEffectInterface
@@ -31344,23 +25746,14 @@ class URvrClientEffectMulti : public URvrClientEffectInterface
 public:
 	TArray< class URvrClientEffectInterface* >         m_aEffects;                                       		// 0x0044 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1973 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1973 );
 	};
 
 	void ApplyParameters ( class URvrClientEffectComponent* pComponent, class URvrClientEffectModuleInstance* pInstance, int nIndex );
 };
 
-UClass* URvrClientEffectMulti::pClassPointer = NULL;
-
 // Class SFXGame.RvrClientEffectManager
 // 0x0038 (0x0074 - 0x003C)
 class URvrClientEffectManager : public UObject
@@ -31378,16 +25771,9 @@ public:
 	unsigned long                                      m_bOnVisible_Debug_Override_Value : 1;            		// 0x0070 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 	unsigned long                                      m_bLogOnCleanup_Debug : 1;                        		// 0x0070 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1974 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1974 );
 	};
 
 	void CleanUpPools ( );
@@ -31406,8 +25792,6 @@ public:
 	class URvrClientEffectManager* GetClientEffectManager ( );
 };
 
-UClass* URvrClientEffectManager::pClassPointer = NULL;
-
 // Class SFXGame.RvrClientEffectModule
 // 0x0043 (0x007F - 0x003C)
 class URvrClientEffectModule : public UObject
@@ -31444,22 +25828,13 @@ public:
 	unsigned char                                      m_eActivationOperation;                           		// 0x007D (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      m_eActivationSelection;                           		// 0x007E (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1975 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1975 );
 	};
 
 };
 
-UClass* URvrClientEffectModule::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleCameraShake
 // 0x001A (0x0099 - 0x007F)
 class URvrCEffectModuleCameraShake : public URvrClientEffectModule
@@ -31475,22 +25850,13 @@ public:
 	unsigned long                                      bOrientTowardRadialEpicenter : 1;                 		// 0x0094 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 	unsigned char                                      PlaySpace;                                        		// 0x0098 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1976 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1976 );
 	};
 
 };
 
-UClass* URvrCEffectModuleCameraShake::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleEffectsMaterial
 // 0x002A (0x00A9 - 0x007F)
 class URvrCEffectModuleEffectsMaterial : public URvrClientEffectModule
@@ -31501,22 +25867,13 @@ public:
 	unsigned long                                      m_bAllAttachments : 1;                            		// 0x00A4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned char                                      m_eTarget;                                        		// 0x00A8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1977 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1977 );
 	};
 
 };
 
-UClass* URvrCEffectModuleEffectsMaterial::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleEmitter
 // 0x0008 (0x0087 - 0x007F)
 class URvrCEffectModuleEmitter : public URvrClientEffectModule
@@ -31527,22 +25884,13 @@ public:
 	unsigned char                                      m_eEmitterInstigator;                             		// 0x0085 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      m_eDPG;                                           		// 0x0086 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1978 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1978 );
 	};
 
 };
 
-UClass* URvrCEffectModuleEmitter::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleFramebuffer
 // 0x0009 (0x0088 - 0x007F)
 class URvrCEffectModuleFramebuffer : public URvrClientEffectModule
@@ -31553,22 +25901,13 @@ public:
 	unsigned long                                      m_bInstantiateMaterials : 1;                      		// 0x0084 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned long                                      m_bSendTimeParam : 1;                             		// 0x0084 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1979 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1979 );
 	};
 
 };
 
-UClass* URvrCEffectModuleFramebuffer::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleLensFlare
 // 0x0005 (0x0084 - 0x007F)
 class URvrCEffectModuleLensFlare : public URvrClientEffectModule
@@ -31576,22 +25915,13 @@ class URvrCEffectModuleLensFlare : public URvrClientEffectModule
 public:
 	class ULensFlare*                                  m_pLensFlare;                                     		// 0x0080 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1980 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1980 );
 	};
 
 };
 
-UClass* URvrCEffectModuleLensFlare::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleLifetime
 // 0x000D (0x008C - 0x007F)
 class URvrCEffectModuleLifetime : public URvrClientEffectModule
@@ -31601,22 +25931,13 @@ public:
 	float                                              m_fMax;                                           		// 0x0084 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	float                                              m_fRequestStop;                                   		// 0x0088 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1981 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1981 );
 	};
 
 };
 
-UClass* URvrCEffectModuleLifetime::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleLight
 // 0x005D (0x00DC - 0x007F)
 class URvrCEffectModuleLight : public URvrClientEffectModule
@@ -31631,22 +25952,13 @@ public:
 	unsigned long                                      m_bCastDynamicShadows : 1;                        		// 0x00D8 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 	unsigned long                                      m_bCastCompositeShadow : 1;                       		// 0x00D8 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1982 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1982 );
 	};
 
 };
 
-UClass* URvrCEffectModuleLight::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleLocation
 // 0x0095 (0x0114 - 0x007F)
 class URvrCEffectModuleLocation : public URvrClientEffectModule
@@ -31668,66 +25980,39 @@ public:
 	unsigned char                                      m_eRotationTarget;                                		// 0x0112 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      m_eBoneAxis;                                      		// 0x0113 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1983 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1983 );
 	};
 
 };
 
-UClass* URvrCEffectModuleLocation::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleMeta
 // 0x0000 (0x007F - 0x007F)
 class URvrCEffectModuleMeta : public URvrClientEffectModule
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1984 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1984 );
 	};
 
 };
 
-UClass* URvrCEffectModuleMeta::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleParameters
 // 0x0000 (0x007F - 0x007F)
 class URvrCEffectModuleParameters : public URvrClientEffectModule
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1985 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1985 );
 	};
 
 };
 
-UClass* URvrCEffectModuleParameters::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleRadialBlur
 // 0x0019 (0x0098 - 0x007F)
 class URvrCEffectModuleRadialBlur : public URvrClientEffectModule
@@ -31740,22 +26025,13 @@ public:
 	float                                              m_fDistanceFalloffExponent;                       		// 0x0090 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      m_bRenderAsVelocity : 1;                          		// 0x0094 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1986 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1986 );
 	};
 
 };
 
-UClass* URvrCEffectModuleRadialBlur::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleSkelMesh
 // 0x0021 (0x00A0 - 0x007F)
 class URvrCEffectModuleSkelMesh : public URvrClientEffectModule
@@ -31768,22 +26044,13 @@ public:
 	unsigned long                                      m_bParentToPrimary : 1;                           		// 0x009C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      m_bInstantiateMaterials : 1;                      		// 0x009C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1987 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1987 );
 	};
 
 };
 
-UClass* URvrCEffectModuleSkelMesh::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleSound
 // 0x0009 (0x0088 - 0x007F)
 class URvrCEffectModuleSound : public URvrClientEffectModule
@@ -31792,22 +26059,13 @@ public:
 	class UWwiseEvent*                                 m_pStartEvent;                                    		// 0x0080 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	class UWwiseEvent*                                 m_pStopEvent;                                     		// 0x0084 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1988 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1988 );
 	};
 
 };
 
-UClass* URvrCEffectModuleSound::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleSpawnActor
 // 0x00BD (0x013C - 0x007F)
 class URvrCEffectModuleSpawnActor : public URvrClientEffectModule
@@ -31838,22 +26096,13 @@ public:
 	unsigned long                                      m_bSendTimeParam : 1;                             		// 0x0138 (0x0004) [0x0000000000000001] [0x00000400] ( CPF_Edit )
 	unsigned long                                      m_bInstantiateOtherMaterials : 1;                 		// 0x0138 (0x0004) [0x0000000000000001] [0x00000800] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1989 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1989 );
 	};
 
 };
 
-UClass* URvrCEffectModuleSpawnActor::pClassPointer = NULL;
-
 // Class SFXGame.RvrClientEffectModuleInstance
 // 0x0038 (0x0074 - 0x003C)
 class URvrClientEffectModuleInstance : public UObject
@@ -31880,44 +26129,26 @@ public:
 	unsigned long                                      m_bCounted : 1;                                   		// 0x0070 (0x0004) [0x0000000000002000] [0x00000080] ( CPF_Transient )
 	unsigned long                                      m_bHiddenDueToCapsFail : 1;                       		// 0x0070 (0x0004) [0x0000000000002000] [0x00000100] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1990 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1990 );
 	};
 
 };
 
-UClass* URvrClientEffectModuleInstance::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleCameraShakeInstance
 // 0x0000 (0x0074 - 0x0074)
 class URvrCEffectModuleCameraShakeInstance : public URvrClientEffectModuleInstance
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1991 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1991 );
 	};
 
 };
 
-UClass* URvrCEffectModuleCameraShakeInstance::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleEffectsMaterialInstance
 // 0x0008 (0x007C - 0x0074)
 class URvrCEffectModuleEffectsMaterialInstance : public URvrClientEffectModuleInstance
@@ -31926,22 +26157,13 @@ public:
 	class AActor*                                      m_pTargetActor;                                   		// 0x0074 (0x0004) [0x0000000000000000]              
 	class USkeletalMeshComponent*                      m_pTargetWeapon;                                  		// 0x0078 (0x0004) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1992 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1992 );
 	};
 
 };
 
-UClass* URvrCEffectModuleEffectsMaterialInstance::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleEmitterInstance
 // 0x0004 (0x0078 - 0x0074)
 class URvrCEffectModuleEmitterInstance : public URvrClientEffectModuleInstance
@@ -31949,23 +26171,14 @@ class URvrCEffectModuleEmitterInstance : public URvrClientEffectModuleInstance
 public:
 	class UParticleSystemComponent*                    m_pPSysComponent;                                 		// 0x0074 (0x0004) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1993 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1993 );
 	};
 
 	void OnFinished ( class UParticleSystemComponent* PSystem );
 };
 
-UClass* URvrCEffectModuleEmitterInstance::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleFramebufferInstance
 // 0x0004 (0x0078 - 0x0074)
 class URvrCEffectModuleFramebufferInstance : public URvrClientEffectModuleInstance
@@ -31973,24 +26186,15 @@ class URvrCEffectModuleFramebufferInstance : public URvrClientEffectModuleInstan
 public:
 	class UPostProcessChain*                           m_pPostProcessInstance;                           		// 0x0074 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1994 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1994 );
 	};
 
 	void InstantiateMaterials ( );
 	void ResetMaterials ( );
 };
 
-UClass* URvrCEffectModuleFramebufferInstance::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleLensFlareInstance
 // 0x0004 (0x0078 - 0x0074)
 class URvrCEffectModuleLensFlareInstance : public URvrClientEffectModuleInstance
@@ -31998,22 +26202,13 @@ class URvrCEffectModuleLensFlareInstance : public URvrClientEffectModuleInstance
 public:
 	class ULensFlareComponent*                         m_pLFComponent;                                   		// 0x0074 (0x0004) [0x0000000004082008]              ( CPF_ExportObject | CPF_Transient | CPF_Component | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1995 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1995 );
 	};
 
 };
 
-UClass* URvrCEffectModuleLensFlareInstance::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleLifetimeInstance
 // 0x0010 (0x0084 - 0x0074)
 class URvrCEffectModuleLifetimeInstance : public URvrClientEffectModuleInstance
@@ -32024,22 +26219,13 @@ public:
 	float                                              m_fRequestStop;                                   		// 0x007C (0x0004) [0x0000000000000000]              
 	unsigned long                                      m_bSoftStopSent : 1;                              		// 0x0080 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1996 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1996 );
 	};
 
 };
 
-UClass* URvrCEffectModuleLifetimeInstance::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleLightInstance
 // 0x0004 (0x0078 - 0x0074)
 class URvrCEffectModuleLightInstance : public URvrClientEffectModuleInstance
@@ -32047,22 +26233,13 @@ class URvrCEffectModuleLightInstance : public URvrClientEffectModuleInstance
 public:
 	class ALight*                                      m_pLight;                                         		// 0x0074 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1997 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1997 );
 	};
 
 };
 
-UClass* URvrCEffectModuleLightInstance::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleLocationInstance
 // 0x0014 (0x0088 - 0x0074)
 class URvrCEffectModuleLocationInstance : public URvrClientEffectModuleInstance
@@ -32071,66 +26248,39 @@ public:
 	struct FVector                                     m_vHitBoneOffset;                                 		// 0x0074 (0x000C) [0x0000000000000000]              
 	struct FName                                       m_nmHitBone;                                      		// 0x0080 (0x0008) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1998 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1998 );
 	};
 
 };
 
-UClass* URvrCEffectModuleLocationInstance::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleMetaInstance
 // 0x0000 (0x0074 - 0x0074)
 class URvrCEffectModuleMetaInstance : public URvrClientEffectModuleInstance
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1999 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1999 );
 	};
 
 };
 
-UClass* URvrCEffectModuleMetaInstance::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleParametersInstance
 // 0x0000 (0x0074 - 0x0074)
 class URvrCEffectModuleParametersInstance : public URvrClientEffectModuleInstance
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2000 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2000 );
 	};
 
 };
 
-UClass* URvrCEffectModuleParametersInstance::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleRadialBlurInstance
 // 0x0004 (0x0078 - 0x0074)
 class URvrCEffectModuleRadialBlurInstance : public URvrClientEffectModuleInstance
@@ -32138,22 +26288,13 @@ class URvrCEffectModuleRadialBlurInstance : public URvrClientEffectModuleInstanc
 public:
 	class URadialBlurComponent*                        m_pRBComponent;                                   		// 0x0074 (0x0004) [0x0000000004082008]              ( CPF_ExportObject | CPF_Transient | CPF_Component | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2001 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2001 );
 	};
 
 };
 
-UClass* URvrCEffectModuleRadialBlurInstance::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleSkelMeshInstance
 // 0x0004 (0x0078 - 0x0074)
 class URvrCEffectModuleSkelMeshInstance : public URvrClientEffectModuleInstance
@@ -32161,44 +26302,26 @@ class URvrCEffectModuleSkelMeshInstance : public URvrClientEffectModuleInstance
 public:
 	class USkeletalMeshComponent*                      m_pSkelMesh;                                      		// 0x0074 (0x0004) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2002 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2002 );
 	};
 
 };
 
-UClass* URvrCEffectModuleSkelMeshInstance::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleSoundInstance
 // 0x0000 (0x0074 - 0x0074)
 class URvrCEffectModuleSoundInstance : public URvrClientEffectModuleInstance
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2003 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2003 );
 	};
 
 };
 
-UClass* URvrCEffectModuleSoundInstance::pClassPointer = NULL;
-
 // Class SFXGame.RvrCEffectModuleSpawnActorInstance
 // 0x0034 (0x00A8 - 0x0074)
 class URvrCEffectModuleSpawnActorInstance : public URvrClientEffectModuleInstance
@@ -32212,46 +26335,28 @@ public:
 	int                                                m_nRemainingSpawns;                               		// 0x00A0 (0x0004) [0x0000000000000000]              
 	float                                              m_fSpawnPotential;                                		// 0x00A4 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2004 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2004 );
 	};
 
 };
 
-UClass* URvrCEffectModuleSpawnActorInstance::pClassPointer = NULL;
-
 // Class SFXGame.RvrClientEffectPointLight
 // 0x0000 (0x0200 - 0x0200)
 class ARvrClientEffectPointLight : public APointLightMovable
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2005 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2005 );
 	};
 
 	void OnToggle ( class USeqAct_Toggle* Action );
 	void eventReplicatedEvent ( struct FName VarName );
 };
 
-UClass* ARvrClientEffectPointLight::pClassPointer = NULL;
-
 // Class SFXGame.RvrClientEffectPool
 // 0x0138 (0x0174 - 0x003C)
 class URvrClientEffectPool : public UObject
@@ -32266,16 +26371,9 @@ public:
 	int                                                m_nMaxTotalEffects;                               		// 0x016C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned long                                      m_bInitialized : 1;                               		// 0x0170 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2006 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2006 );
 	};
 
 	bool ShouldReactivate ( class URvrClientEffectModuleInstance* pModule );
@@ -32287,8 +26385,6 @@ public:
 	void FlushAllPools ( unsigned long bPreserveRunningEffects );
 };
 
-UClass* URvrClientEffectPool::pClassPointer = NULL;
-
 // Class SFXGame.RvrClientEffectTrigger
 // 0x0024 (0x0228 - 0x0204)
 class ARvrClientEffectTrigger : public ATrigger
@@ -32298,45 +26394,27 @@ public:
 	TArray< class AActor* >                            m_lstTargetActors;                                		// 0x0210 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	struct FVector                                     m_vSpawnParameters;                               		// 0x021C (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2007 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2007 );
 	};
 
 	void eventTouch ( class AActor* Other, class UPrimitiveComponent* OtherComp, struct FVector HitLocation, struct FVector HitNormal );
 };
 
-UClass* ARvrClientEffectTrigger::pClassPointer = NULL;
-
 // Class SFXGame.RvrComponentPCNetClientEffects
 // 0x0000 (0x0056 - 0x0056)
 class URvrComponentPCNetClientEffects : public UActorComponent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2008 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2008 );
 	};
 
 };
 
-UClass* URvrComponentPCNetClientEffects::pClassPointer = NULL;
-
 // Class SFXGame.RvrPhysicalMaterialProperty
 // 0x0001 (0x003D - 0x003C)
 class URvrPhysicalMaterialProperty : public UPhysicalMaterialPropertyBase
@@ -32344,22 +26422,13 @@ class URvrPhysicalMaterialProperty : public UPhysicalMaterialPropertyBase
 public:
 	unsigned char                                      m_eImpactClientEffect;                            		// 0x003C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2009 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2009 );
 	};
 
 };
 
-UClass* URvrPhysicalMaterialProperty::pClassPointer = NULL;
-
 // Class SFXGame.RvrSeqAct_ActivateClientEffect
 // 0x0004 (0x00B4 - 0x00B0)
 class URvrSeqAct_ActivateClientEffect : public USequenceAction
@@ -32367,22 +26436,13 @@ class URvrSeqAct_ActivateClientEffect : public USequenceAction
 public:
 	unsigned long                                      bAllowCooldown : 1;                               		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2010 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2010 );
 	};
 
 };
 
-UClass* URvrSeqAct_ActivateClientEffect::pClassPointer = NULL;
-
 // Class SFXGame.RvrSeqAct_SpawnClientEffect
 // 0x0018 (0x00C8 - 0x00B0)
 class URvrSeqAct_SpawnClientEffect : public USequenceAction
@@ -32391,22 +26451,13 @@ public:
 	TArray< class URvrClientEffectInterface* >         m_lstEffects;                                     		// 0x00B0 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	struct FVector                                     m_vSpawnParameters;                               		// 0x00BC (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2011 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2011 );
 	};
 
 };
 
-UClass* URvrSeqAct_SpawnClientEffect::pClassPointer = NULL;
-
 // Class SFXGame.RvrSeqAct_StoppableClientEffect
 // 0x0024 (0x00D4 - 0x00B0)
 class URvrSeqAct_StoppableClientEffect : public USequenceAction
@@ -32417,22 +26468,13 @@ public:
 	class URvrClientEffectInterface*                   m_pEffect;                                        		// 0x00CC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      m_bAllowCooldown : 1;                             		// 0x00D0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2012 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2012 );
 	};
 
 };
 
-UClass* URvrSeqAct_StoppableClientEffect::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackClientEffect
 // 0x0014 (0x0080 - 0x006C)
 class USFXInterpTrackClientEffect : public UInterpTrackToggle
@@ -32443,23 +26485,14 @@ public:
 	unsigned long                                      m_bAllowCooldown : 1;                             		// 0x007C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      m_bStopAllMatchingEffects : 1;                    		// 0x007C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2013 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2013 );
 	};
 
 	struct FString eventGetNewTrackSubMenuName ( );
 };
 
-UClass* USFXInterpTrackClientEffect::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackInstClientEffect
 // 0x0013 (0x0058 - 0x0045)
 class USFXInterpTrackInstClientEffect : public UInterpTrackInstToggle
@@ -32467,22 +26500,13 @@ class USFXInterpTrackInstClientEffect : public UInterpTrackInstToggle
 public:
 	struct FGuid                                       m_ID;                                             		// 0x0048 (0x0010) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2014 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2014 );
 	};
 
 };
 
-UClass* USFXInterpTrackInstClientEffect::pClassPointer = NULL;
-
 // Class SFXGame.SFXPatchLinkerLoad
 // 0x0050 (0x0764 - 0x0714)
 class USFXPatchLinkerLoad : public ULinkerLoad
@@ -32490,22 +26514,13 @@ class USFXPatchLinkerLoad : public ULinkerLoad
 public:
 	unsigned char                                      UnknownData00[ 0x50 ];                            		// 0x0714 (0x0050) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 3644 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2108 );
 	};
 
 };
 
-UClass* USFXPatchLinkerLoad::pClassPointer = NULL;
-
 // Class SFXGame.SFXWeapon
 // 0x0ADB (0x0DD2 - 0x02F7)
 class ASFXWeapon : public ASFXWeapon_NativeBase
@@ -32801,16 +26816,9 @@ public:
 	unsigned char                                      RTPCPlayerPosition;                               		// 0x0DD0 (0x0001) [0x0000000000000000]              
 	unsigned char                                      RepChargeEffect;                                  		// 0x0DD1 (0x0001) [0x0000000000000020]              ( CPF_Net )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 41446 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4333 );
 	};
 
 	void GiveWeaponCodex ( );
@@ -33007,24 +27015,15 @@ public:
 	void OnWeaponImpact ( class ASFXWeapon* Weapon, struct FImpactInfo Impact );
 };
 
-UClass* ASFXWeapon::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqEvt_OnStoppedSleeping
 // 0x0000 (0x00D2 - 0x00D2)
 class USFXSeqEvt_OnStoppedSleeping : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 41479 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4334 );
 	};
 
 	void eventToggled ( );
@@ -33034,8 +27033,6 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* USFXSeqEvt_OnStoppedSleeping::pClassPointer = NULL;
-
 // Class SFXGame.sfxpowercustomaction
 // 0x024B (0x0695 - 0x044A)
 class Usfxpowercustomaction : public USFXPowerCustomActionBase
@@ -33165,16 +27162,9 @@ public:
 	unsigned char                                      CastingPhase;                                     		// 0x0693 (0x0001) [0x0000000000000000]              
 	unsigned char                                      ERootMotionMode;                                  		// 0x0694 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 41506 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4336 );
 	};
 
 	int GetSaveGamePowerState ( );
@@ -33271,8 +27261,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* Usfxpowercustomaction::pClassPointer = NULL;
-
 // Class SFXGame.sfxpawn
 // 0x0173 (0x0D40 - 0x0BCD)
 class Asfxpawn : public ABioPawn
@@ -33339,16 +27327,9 @@ public:
 	unsigned long                                      bIsPet : 1;                                       		// 0x0D3C (0x0004) [0x0000000000000000] [0x00040000] 
 	unsigned long                                      bCanDropAmmo : 1;                                 		// 0x0D3C (0x0004) [0x0000000000000000] [0x00080000] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 41510 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4339 );
 	};
 
 	class AActor* GetPetOwner ( );
@@ -33393,8 +27374,6 @@ public:
 	void eventReplicatedEvent ( struct FName VarName );
 };
 
-UClass* Asfxpawn::pClassPointer = NULL;
-
 // Class SFXGame.SFXPawn_PlayerParty
 // 0x0050 (0x0D90 - 0x0D40)
 class ASFXPawn_PlayerParty : public Asfxpawn
@@ -33419,16 +27398,9 @@ public:
 	unsigned long                                      bDamagedHarvester : 1;                            		// 0x0D88 (0x0004) [0x0000000000000000] [0x00000040] 
 	unsigned char                                      ForcedHelmetState[ 0x4 ];                         		// 0x0D8C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 41509 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4338 );
 	};
 
 	void InstancePrecacheVFX ( class ASFXObjectPool* ObjectPool, class URvrClientEffectManager* ClientEffects );
@@ -33469,8 +27441,6 @@ public:
 	void InitDefaultHelmetState ( );
 };
 
-UClass* ASFXPawn_PlayerParty::pClassPointer = NULL;
-
 // Class SFXGame.SFXPawn_Henchman
 // 0x0034 (0x0DC4 - 0x0D90)
 class ASFXPawn_Henchman : public ASFXPawn_PlayerParty
@@ -33483,16 +27453,9 @@ public:
 	float                                              PowerUseDelay;                                    		// 0x0DBC (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	class UTexture2D*                                  m_GUI_Icon;                                       		// 0x0DC0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 41508 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4337 );
 	};
 
 	struct FName GetUIAppearanceTag ( );
@@ -33519,47 +27482,29 @@ public:
 	int GetScaledLevel ( );
 };
 
-UClass* ASFXPawn_Henchman::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendAdditivePower
 // 0x0000 (0x00DC - 0x00DC)
 class UBioAnimNodeBlendAdditivePower : public UBioAnimNodeBlendAdditive
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 41638 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4340 );
 	};
 
 	void SetChildAnimTime ( class UAnimNode* oChild, float fTime );
 };
 
-UClass* UBioAnimNodeBlendAdditivePower::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeBlendWeaponEquip
 // 0x0000 (0x00BD - 0x00BD)
 class UBioAnimNodeBlendWeaponEquip : public UAnimNodeBlendBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 41985 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4343 );
 	};
 
 	void ReplayAnim ( );
@@ -33567,31 +27512,20 @@ public:
 	void PlayAnim ( unsigned long bLoop, float Rate, float StartTime );
 };
 
-UClass* UBioAnimNodeBlendWeaponEquip::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNodeCameraShake
 // 0x0000 (0x00DC - 0x00DC)
 class UBioAnimNodeCameraShake : public UBioAnimNodeBlendAdditive
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 41987 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4344 );
 	};
 
 	void SetChildAnimTime ( class UAnimNode* oChild, float fTime );
 };
 
-UClass* UBioAnimNodeCameraShake::pClassPointer = NULL;
-
 // Class SFXGame.BioAnimNotify_CustomAction
 // 0x0008 (0x0044 - 0x003C)
 class UBioAnimNotify_CustomAction : public UAnimNotify_Scripted
@@ -33599,23 +27533,14 @@ class UBioAnimNotify_CustomAction : public UAnimNotify_Scripted
 public:
 	struct FName                                       Info;                                             		// 0x003C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 42122 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4345 );
 	};
 
 	void eventNotify ( class AActor* Owner, class UAnimNodeSequence* AnimSeqInstigator );
 };
 
-UClass* UBioAnimNotify_CustomAction::pClassPointer = NULL;
-
 // Class SFXGame.BioAreaTransition
 // 0x0010 (0x023C - 0x022C)
 class ABioAreaTransition : public ATriggerVolume
@@ -33624,23 +27549,14 @@ public:
 	struct FName                                       sMoveToArea;                                      		// 0x022C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 	struct FName                                       sMoveToStartPoint;                                		// 0x0234 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 42133 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4346 );
 	};
 
 	void eventTouch ( class AActor* Other, class UPrimitiveComponent* OtherComp, struct FVector HitLocation, struct FVector HitNormal );
 };
 
-UClass* ABioAreaTransition::pClassPointer = NULL;
-
 // Class SFXGame.SFXPawn_Player
 // 0x045B (0x11EB - 0x0D90)
 class ASFXPawn_Player : public ASFXPawn_PlayerParty
@@ -33736,16 +27652,9 @@ public:
 	unsigned char                                      Origin;                                           		// 0x11E9 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      Notoriety;                                        		// 0x11EA (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 42139 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4347 );
 	};
 
 	void RemoveDetachOnDestroyObject ( class USkeletalMeshComponent* MeshToRemove );
@@ -33865,8 +27774,6 @@ public:
 	void AsyncUpdating_OnCompleted ( TArray< class UObject* >* LoadedAssets );
 };
 
-UClass* ASFXPawn_Player::pClassPointer = NULL;
-
 // Class SFXGame.sfxai_core
 // 0x01EF (0x0690 - 0x04A1)
 class Asfxai_core : public ASFXAI_NativeBase
@@ -33994,16 +27901,9 @@ public:
 	unsigned char                                      m_AttackResult;                                   		// 0x068E (0x0001) [0x0000000000002000]              ( CPF_Transient )
 	unsigned char                                      PreviousCombatMood;                               		// 0x068F (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 42217 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4371 );
 	};
 
 	void CheckDownedPlayers ( );
@@ -34148,24 +28048,15 @@ public:
 	void UsePowerDelegate ( int nReason );
 };
 
-UClass* Asfxai_core::pClassPointer = NULL;
-
 // Class SFXGame.BioBaseSquadDesign
 // 0x0000 (0x0228 - 0x0228)
 class ABioBaseSquadDesign : public ABioBaseSquad
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 42262 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4381 );
 	};
 
 	void NotifyCombatZoneRemoved ( );
@@ -34203,24 +28094,15 @@ public:
 	bool RemoveMember ( class APawn* pPawn );
 };
 
-UClass* ABioBaseSquadDesign::pClassPointer = NULL;
-
 // Class SFXGame.BioBaseSquadDesignCombat
 // 0x0000 (0x0228 - 0x0228)
 class ABioBaseSquadDesignCombat : public ABioBaseSquadDesign
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 42266 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4382 );
 	};
 
 	void NotifyCombatZoneRemoved ( );
@@ -34258,8 +28140,6 @@ public:
 	bool RemoveMember ( class APawn* pPawn );
 };
 
-UClass* ABioBaseSquadDesignCombat::pClassPointer = NULL;
-
 // Class SFXGame.biocamerabehaviorflourish
 // 0x0028 (0x0118 - 0x00F0)
 class Ubiocamerabehaviorflourish : public UBioCameraBehavior
@@ -34274,16 +28154,9 @@ public:
 	float                                              DistanceSpeed;                                    		// 0x0110 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bInterpToStart : 1;                               		// 0x0114 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 42429 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4383 );
 	};
 
 	void Tick ( float TimeDelta );
@@ -34291,8 +28164,6 @@ public:
 	void Initialize ( );
 };
 
-UClass* Ubiocamerabehaviorflourish::pClassPointer = NULL;
-
 // Class SFXGame.BioCameraBehaviorFree
 // 0x0004 (0x00F4 - 0x00F0)
 class UBioCameraBehaviorFree : public UBioCameraBehavior
@@ -34300,24 +28171,15 @@ class UBioCameraBehaviorFree : public UBioCameraBehavior
 public:
 	unsigned long                                      m_bCameraLocked : 1;                              		// 0x00F0 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 42454 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4384 );
 	};
 
 	void Tick ( float TimeDelta );
 	void Initialize ( );
 };
 
-UClass* UBioCameraBehaviorFree::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeOrbital
 // 0x01E4 (0x0290 - 0x00AC)
 class USFXGameModeOrbital : public USFXGameModeGalaxy
@@ -34375,16 +28237,9 @@ public:
 	unsigned long                                      DrawProbeDebugLines : 1;                          		// 0x028C (0x0004) [0x0000000000002000] [0x00000020] ( CPF_Transient )
 	unsigned long                                      bMouseLock : 1;                                   		// 0x028C (0x0004) [0x0000000000002000] [0x00000040] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 42932 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4386 );
 	};
 
 	void setshakelfreq ( float X, float Y, float Z );
@@ -34433,30 +28288,19 @@ public:
 	class USFXCameraMode* GetCameraMode ( class USFXCameraMode* OldCameraMode, int* PreserveTarget, float* TransitionTime, class USFXCameraMode_Interpolate** Transition );
 };
 
-UClass* USFXGameModeOrbital::pClassPointer = NULL;
-
 // Class SFXGame.BioCameraBehaviorLocked
 // 0x0000 (0x00F0 - 0x00F0)
 class UBioCameraBehaviorLocked : public UBioCameraBehavior
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 43091 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4387 );
 	};
 
 };
 
-UClass* UBioCameraBehaviorLocked::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_WeaponModManager
 // 0x0018 (0x0060 - 0x0048)
 class USFXModule_WeaponModManager : public USFXModule
@@ -34465,16 +28309,9 @@ public:
 	TArray< class USFXWeaponMod* >                     WeaponMods;                                       		// 0x0048 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	TArray< struct FExtraMeshComponent >               ExtraMeshComponents;                              		// 0x0054 (0x000C) [0x0000000000482000]              ( CPF_Transient | CPF_Component | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 43494 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4388 );
 	};
 
 	void SetWeaponModHidden ( unsigned long bHidden );
@@ -34483,8 +28320,6 @@ public:
 	bool AddMod ( class UClass* ModClass, int nLevel );
 };
 
-UClass* USFXModule_WeaponModManager::pClassPointer = NULL;
-
 // Class SFXGame.SFXWeaponMod
 // 0x00AE (0x00EE - 0x0040)
 class USFXWeaponMod : public USFXWeaponMod_NativeBase
@@ -34518,16 +28353,9 @@ public:
 	unsigned char                                      WeaponModCategory;                                		// 0x00EC (0x0001) [0x0000000000004000]              ( CPF_Config )
 	unsigned char                                      ToolTipText;                                      		// 0x00ED (0x0001) [0x0000000000004002]              ( CPF_Const | CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 43498 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4389 );
 	};
 
 	class UClass* GetGameEffectClass ( struct FName EffectClassName );
@@ -34543,8 +28371,6 @@ public:
 	int GetMaxRank ( );
 };
 
-UClass* USFXWeaponMod::pClassPointer = NULL;
-
 // Class SFXGame.SFXGAWAssetsHandler
 // 0x00EC (0x0128 - 0x003C)
 class USFXGAWAssetsHandler : public UObject
@@ -34582,16 +28408,9 @@ public:
 	unsigned long                                      bEvaluateAchievement : 1;                         		// 0x0124 (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned long                                      bBrainUsed : 1;                                   		// 0x0124 (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 43542 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4393 );
 	};
 
 	bool IsAssetUnlockedForGUICategory ( int nAssetIndex, int nCategoryID, int* nCurrentStrength );
@@ -34651,8 +28470,6 @@ public:
 	void RequestGAWDataCallback ( TArray< struct FGAWZoneGUIData > ZoneData, int Level, int errorCode );
 };
 
-UClass* USFXGAWAssetsHandler::pClassPointer = NULL;
-
 // Class SFXGame.sfxmodule_damage
 // 0x0144 (0x01C5 - 0x0081)
 class Usfxmodule_damage : public USFXModule_DamageNativeBase
@@ -34676,16 +28493,9 @@ public:
 	unsigned long                                      bOwnerIsDead : 1;                                 		// 0x01C0 (0x0004) [0x0000000000000000] [0x00000004] 
 	unsigned char                                      HealthType;                                       		// 0x01C4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 43639 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4394 );
 	};
 
 	bool KillForStasis ( unsigned long bImmediate, class AController* Killer, class UClass* DamageType );
@@ -34700,8 +28510,6 @@ public:
 	void eventHandlePostBeginPlay ( );
 };
 
-UClass* Usfxmodule_damage::pClassPointer = NULL;
-
 // Class SFXGame.SFXCharacterClass
 // 0x0159 (0x01CD - 0x0074)
 class USFXCharacterClass : public USFXCharacterClass_NativeBase
@@ -34730,22 +28538,13 @@ public:
 	int                                                MaxWeapons;                                       		// 0x01C8 (0x0004) [0x0000000000000000]              
 	unsigned char                                      ClassType;                                        		// 0x01CC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 43764 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4397 );
 	};
 
 };
 
-UClass* USFXCharacterClass::pClassPointer = NULL;
-
 // Class SFXGame.sfxshield_base
 // 0x00D2 (0x0316 - 0x0244)
 class Asfxshield_base : public AInventory
@@ -34778,16 +28577,9 @@ public:
 	unsigned char                                      Resistance;                                       		// 0x0314 (0x0001) [0x0000000000000002]              ( CPF_Const )
 	unsigned char                                      ReplicatedShield;                                 		// 0x0315 (0x0001) [0x0000000000002020]              ( CPF_Net | CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 43807 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4398 );
 	};
 
 	void SetMaxShields ( struct FScaledFloat NewMaxShields );
@@ -34824,8 +28616,6 @@ public:
 	void ShieldDestroyedPowerCallback ( class AActor* ShieldActor, class Asfxshield_base* Shield );
 };
 
-UClass* Asfxshield_base::pClassPointer = NULL;
-
 // Class SFXGame.sfxhostmigration
 // 0x0004 (0x0040 - 0x003C)
 class Usfxhostmigration : public UObject
@@ -34833,16 +28623,9 @@ class Usfxhostmigration : public UObject
 public:
 	unsigned long                                      bNeedRestoration : 1;                             		// 0x003C (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 44389 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4399 );
 	};
 
 	void ResetWaveToRestore ( );
@@ -34857,8 +28640,6 @@ public:
 	class Usfxhostmigration* GetHostMigration ( );
 };
 
-UClass* Usfxhostmigration::pClassPointer = NULL;
-
 // Class SFXGame.sfxplayercontroller
 // 0x00A1 (0x0B9C - 0x0AFB)
 class Asfxplayercontroller : public ABioPlayerController
@@ -34892,16 +28673,9 @@ public:
 	class USFXLadderReachSpec*                         FoundLadder;                                      		// 0x0B94 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned long                                      bLeanDisabled : 1;                                		// 0x0B98 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 44446 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4401 );
 	};
 
 	void ClientShowExtractionCredits ( float Credits );
@@ -34982,46 +28756,28 @@ public:
 	void OnDestroyCallback ( );
 };
 
-UClass* Asfxplayercontroller::pClassPointer = NULL;
-
 // Class SFXGame.BioDynamicLoadInterface
 // 0x0000 (0x003C - 0x003C)
 class UBioDynamicLoadInterface : public UInterface
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 44527 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4403 );
 	};
 
 };
 
-UClass* UBioDynamicLoadInterface::pClassPointer = NULL;
-
 // Class SFXGame.SFXPawn_PlayerVanguard
 // 0x0000 (0x11EB - 0x11EB)
 class ASFXPawn_PlayerVanguard : public ASFXPawn_Player
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 44528 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4404 );
 	};
 
 	void RemoveDetachOnDestroyObject ( class USkeletalMeshComponent* MeshToRemove );
@@ -35141,30 +28897,19 @@ public:
 	void AsyncUpdating_OnCompleted ( TArray< class UObject* >* LoadedAssets );
 };
 
-UClass* ASFXPawn_PlayerVanguard::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomActionTypes
 // 0x0000 (0x003C - 0x003C)
 class USFXCustomActionTypes : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 44531 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4405 );
 	};
 
 };
 
-UClass* USFXCustomActionTypes::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICommand
 // 0x002C (0x0084 - 0x0058)
 class USFXAICommand : public UGameAICommand
@@ -35176,16 +28921,9 @@ public:
 	class USFXAICommand*                               SFXChildCommand;                                  		// 0x007C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned long                                      bAbortIfChildFailed : 1;                          		// 0x0080 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 44634 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4409 );
 	};
 
 	void NotifyFriendDied ( class ABioPawn* FriendPawn );
@@ -35217,8 +28955,6 @@ public:
 	void Paused ( class UGameAICommand* NewCommand );
 };
 
-UClass* USFXAICommand::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_InteractionPoint
 // 0x0010 (0x02D4 - 0x02C4)
 class ASFXNav_InteractionPoint : public APathNode
@@ -35231,23 +28967,14 @@ public:
 	unsigned long                                      bPreciseRotation : 1;                             		// 0x02D0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned long                                      bModifyPerception : 1;                            		// 0x02D0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 44712 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4410 );
 	};
 
 	bool StartInteraction ( class ABioPawn* oPawn );
 };
 
-UClass* ASFXNav_InteractionPoint::pClassPointer = NULL;
-
 // Class SFXGame.SFXVocalizationManager
 // 0x000C (0x0234 - 0x0228)
 class ASFXVocalizationManager : public ASFXVocalizationManagerNativeBase
@@ -35255,16 +28982,9 @@ class ASFXVocalizationManager : public ASFXVocalizationManagerNativeBase
 public:
 	TArray< struct FVocEventLog >                      PastEvents;                                       		// 0x0228 (0x000C) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 44843 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4411 );
 	};
 
 	void DrawActorLog ( class AActor* oActor, class ABioHUD* H );
@@ -35275,24 +28995,15 @@ public:
 	void eventPostBeginPlay ( );
 };
 
-UClass* ASFXVocalizationManager::pClassPointer = NULL;
-
 // Class SFXGame.SFXDamageType_CheatKill
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_CheatKill : public USFXDamageType
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 45038 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4421 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -35300,24 +29011,15 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_CheatKill::pClassPointer = NULL;
-
 // Class SFXGame.SFXDamageType_Default
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_Default : public USFXDamageType
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 45052 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4422 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -35325,8 +29027,6 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_Default::pClassPointer = NULL;
-
 // Class SFXGame.SFXHeavyWeapon
 // 0x0006 (0x0DD8 - 0x0DD2)
 class ASFXHeavyWeapon : public ASFXWeapon
@@ -35334,16 +29034,9 @@ class ASFXHeavyWeapon : public ASFXWeapon
 public:
 	unsigned long                                      bTossOnWeaponSwitch : 1;                          		// 0x0DD4 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 45204 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4423 );
 	};
 
 	void DropGun ( );
@@ -35356,8 +29049,6 @@ public:
 	void ConsumeAmmo ( unsigned char FireModeNum );
 };
 
-UClass* ASFXHeavyWeapon::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_GameEffectManager
 // 0x0124 (0x017C - 0x0058)
 class USFXModule_GameEffectManager : public USFXModule_GameEffectManager_NativeBase
@@ -35373,16 +29064,9 @@ public:
 	struct FScaledFloat                                WeaponMatchConsumableDamageBonus;                 		// 0x0154 (0x0024) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 	float                                              RecoilBonus;                                      		// 0x0178 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 45232 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4425 );
 	};
 
 	void UnpauseEffectsByType ( class UClass* EffectClass );
@@ -35408,24 +29092,15 @@ public:
 	void eventHandlePostBeginPlay ( );
 };
 
-UClass* USFXModule_GameEffectManager::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameEffect_PassiveWeaponBonus
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_PassiveWeaponBonus : public USFXGameEffect
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 45241 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4426 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -35441,8 +29116,6 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_PassiveWeaponBonus::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_AimAssist
 // 0x00CC (0x0114 - 0x0048)
 class USFXModule_AimAssist : public USFXModule
@@ -35480,16 +29153,9 @@ public:
 	class AActor*                                      CurrentAimAssistTarget;                           		// 0x010C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	float                                              CurrentAimAssistSoftMargin;                       		// 0x0110 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 45351 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4427 );
 	};
 
 	void DebugDraw_ZoomSnap ( class ABioHUD* H );
@@ -35508,8 +29174,6 @@ public:
 	void CacheCurrentAimAssistTarget ( );
 };
 
-UClass* USFXModule_AimAssist::pClassPointer = NULL;
-
 // Class SFXGame.SFXPlotTreasure
 // 0x0028 (0x0070 - 0x0048)
 class USFXPlotTreasure : public UBioPlotTreasure
@@ -35526,16 +29190,9 @@ public:
 	int                                                StateNewUpgradesAvailable;                        		// 0x0068 (0x0004) [0x0000000000000002]              ( CPF_Const )
 	int                                                srCanAffordResearch;                              		// 0x006C (0x0004) [0x0000000000000002]              ( CPF_Const )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 45444 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4431 );
 	};
 
 	void TriggerResourceHint ( unsigned char InvType, int nAmount );
@@ -35565,8 +29222,6 @@ public:
 	struct FSResourceBudget BudgetFromId ( int nID );
 };
 
-UClass* USFXPlotTreasure::pClassPointer = NULL;
-
 // Class SFXGame.SFXWeapon_Shotgun_Base
 // 0x008A (0x0E5C - 0x0DD2)
 class ASFXWeapon_Shotgun_Base : public ASFXWeapon
@@ -35583,16 +29238,9 @@ public:
 	float                                              LatentFireTime;                                   		// 0x0E54 (0x0004) [0x0000000000000002]              ( CPF_Const )
 	int                                                LatentFire_CurrentPellet;                         		// 0x0E58 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 45544 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4432 );
 	};
 
 	unsigned char GetStoreQualification ( );
@@ -35610,8 +29258,6 @@ public:
 	void ScaleWeapon ( );
 };
 
-UClass* ASFXWeapon_Shotgun_Base::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_DamageParty
 // 0x001C (0x01E1 - 0x01C5)
 class USFXModule_DamageParty : public Usfxmodule_damage
@@ -35625,16 +29271,9 @@ public:
 	float                                              HealthGateThreshold;                              		// 0x01DC (0x0004) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 	unsigned char                                      CurrentBleedoutState;                             		// 0x01E0 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 45596 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4434 );
 	};
 
 	bool KillForStasis ( unsigned long bImmediate, class AController* Killer, class UClass* DamageType );
@@ -35649,8 +29288,6 @@ public:
 	void RegenFullHealth ( );
 };
 
-UClass* USFXModule_DamageParty::pClassPointer = NULL;
-
 // Class SFXGame.sfxpri
 // 0x011A (0x03D4 - 0x02BA)
 class Asfxpri : public ASFXPRI_NativeBase
@@ -35666,16 +29303,9 @@ public:
 	float                                              CreditsEarned;                                    		// 0x03CC (0x0004) [0x0000000000000000]              
 	float                                              ScoreReplicationPeriod;                           		// 0x03D0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 45654 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4440 );
 	};
 
 	void SendTelemetryForWeapons ( );
@@ -35707,8 +29337,6 @@ public:
 	void eventReplicatedEvent ( struct FName VarName );
 };
 
-UClass* Asfxpri::pClassPointer = NULL;
-
 // Class SFXGame.sfxplayercamera
 // 0x006C (0x04FC - 0x0490)
 class Asfxplayercamera : public ASFXCameraNativeBase
@@ -35733,16 +29361,9 @@ public:
 	unsigned long                                      bDebugging : 1;                                   		// 0x04F8 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 	unsigned long                                      m_bLastConstrainAspect : 1;                       		// 0x04F8 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 45953 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4442 );
 	};
 
 	void ProcessViewRotation ( float DeltaTime, struct FRotator* OutViewRotation, struct FRotator* OutDeltaRot );
@@ -35762,8 +29383,6 @@ public:
 	void PostBeginPlay ( );
 };
 
-UClass* Asfxplayercamera::pClassPointer = NULL;
-
 // Class SFXGame.SFXAI_Cover
 // 0x0058 (0x06E8 - 0x0690)
 class ASFXAI_Cover : public Asfxai_core
@@ -35787,16 +29406,9 @@ public:
 	unsigned long                                      m_bInvalidatedCover : 1;                          		// 0x06E4 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned long                                      m_bUsePeriodicCoverCheck : 1;                     		// 0x06E4 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 45976 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4444 );
 	};
 
 	void OnCoverUserEvade ( class USFXSeqAct_CoverUserEvade* Seq );
@@ -35827,8 +29439,6 @@ public:
 	bool SetCombatMood ( unsigned char NewMood, float fDuration );
 };
 
-UClass* ASFXAI_Cover::pClassPointer = NULL;
-
 // Class SFXGame.SFXAI_Henchman
 // 0x0084 (0x076C - 0x06E8)
 class ASFXAI_Henchman : public ASFXAI_Cover
@@ -35873,16 +29483,9 @@ public:
 	unsigned long                                      m_bBackingAwayFromTarget : 1;                     		// 0x0768 (0x0004) [0x0000000000002000] [0x00001000] ( CPF_Transient )
 	unsigned long                                      PreventSquadPowerUse : 1;                         		// 0x0768 (0x0004) [0x0000000000002000] [0x00002000] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 45975 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4443 );
 	};
 
 	bool HasAnyEnemies ( );
@@ -35957,8 +29560,6 @@ public:
 	void ReachedInteractionPoint ( );
 };
 
-UClass* ASFXAI_Henchman::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameEffect_PowerBonus
 // 0x001A (0x007C - 0x0062)
 class USFXGameEffect_PowerBonus : public USFXGameEffect
@@ -35971,16 +29572,9 @@ public:
 	unsigned long                                      bApplyToCombat : 1;                               		// 0x0078 (0x0004) [0x0000000000000000] [0x00000004] 
 	unsigned long                                      bApplyToWeapons : 1;                              		// 0x0078 (0x0004) [0x0000000000000000] [0x00000008] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 46325 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4446 );
 	};
 
 	void ApplyBonus ( unsigned long bRemove );
@@ -35989,8 +29583,6 @@ public:
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_PowerBonus::pClassPointer = NULL;
-
 // Class SFXGame.BioHintSystem
 // 0x0065 (0x012D - 0x00C8)
 class UBioHintSystem : public UBioHintSystemBase
@@ -36027,16 +29619,9 @@ public:
 	unsigned long                                      m_bShowingSelectHint : 1;                         		// 0x0128 (0x0004) [0x0000000000002000] [0x00002000] ( CPF_Transient )
 	unsigned char                                      m_ePowerTutorialType;                             		// 0x012C (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 46629 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4449 );
 	};
 
 	void AddNotificationOneParameter ( struct FSFXNotificationData oNoteData, int nParam1 );
@@ -36096,8 +29681,6 @@ public:
 	void eventCacheCurrentState ( );
 };
 
-UClass* UBioHintSystem::pClassPointer = NULL;
-
 // Class SFXGame.SFXWeapon_AssaultRifle_Base
 // 0x0006 (0x0DD8 - 0x0DD2)
 class ASFXWeapon_AssaultRifle_Base : public ASFXWeapon
@@ -36105,16 +29688,9 @@ class ASFXWeapon_AssaultRifle_Base : public ASFXWeapon
 public:
 	int                                                ShotsTillMissTracer;                              		// 0x0DD4 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 46716 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4450 );
 	};
 
 	unsigned char GetStoreQualification ( );
@@ -36125,24 +29701,15 @@ public:
 	bool ShouldSpawnTracerFX ( );
 };
 
-UClass* ASFXWeapon_AssaultRifle_Base::pClassPointer = NULL;
-
 // Class SFXGame.SFXWeapon_Pistol_Base
 // 0x0000 (0x0DD2 - 0x0DD2)
 class ASFXWeapon_Pistol_Base : public ASFXWeapon
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 46717 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4451 );
 	};
 
 	void GiveWeaponCodex ( );
@@ -36339,24 +29906,15 @@ public:
 	void OnWeaponImpact ( class ASFXWeapon* Weapon, struct FImpactInfo Impact );
 };
 
-UClass* ASFXWeapon_Pistol_Base::pClassPointer = NULL;
-
 // Class SFXGame.SFXWeapon_SMG_Base
 // 0x0000 (0x0DD2 - 0x0DD2)
 class ASFXWeapon_SMG_Base : public ASFXWeapon
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 46718 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4452 );
 	};
 
 	void GiveWeaponCodex ( );
@@ -36553,8 +30111,6 @@ public:
 	void OnWeaponImpact ( class ASFXWeapon* Weapon, struct FImpactInfo Impact );
 };
 
-UClass* ASFXWeapon_SMG_Base::pClassPointer = NULL;
-
 // Class SFXGame.SFXWeapon_SniperRifle_Base
 // 0x007A (0x0E4C - 0x0DD2)
 class ASFXWeapon_SniperRifle_Base : public ASFXWeapon
@@ -36567,16 +30123,9 @@ public:
 	class UWwiseEvent*                                 DeActivateSniperZoomWwiseEvent;                   		// 0x0E44 (0x0004) [0x0000000000000000]              
 	float                                              SniperRifleDamagePenalty;                         		// 0x0E48 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 46719 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4453 );
 	};
 
 	float GetFireModeBaseDamage ( );
@@ -36588,8 +30137,6 @@ public:
 	void ScaleWeapon ( );
 };
 
-UClass* ASFXWeapon_SniperRifle_Base::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_QAModule
 // 0x0028 (0x0070 - 0x0048)
 class USFXModule_QAModule : public USFXModule
@@ -36607,16 +30154,9 @@ public:
 	unsigned long                                      bDoneStealthBarks : 1;                            		// 0x006C (0x0004) [0x0000000000000000] [0x00000004] 
 	unsigned long                                      bDoneCombatVarBarks : 1;                          		// 0x006C (0x0004) [0x0000000000000000] [0x00000008] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 46808 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4454 );
 	};
 
 	void Tick ( float TimeDelta );
@@ -36628,8 +30168,6 @@ public:
 	class UWwiseEvent* GetNextCombatBark ( class ABioPawn* pPawn );
 };
 
-UClass* USFXModule_QAModule::pClassPointer = NULL;
-
 // Class SFXGame.SFXMPEventTicker
 // 0x000C (0x0048 - 0x003C)
 class USFXMPEventTicker : public UObject
@@ -36637,24 +30175,15 @@ class USFXMPEventTicker : public UObject
 public:
 	TArray< struct FString >                           Events;                                           		// 0x003C (0x000C) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 47185 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4465 );
 	};
 
 	void ClearTicker ( );
 	void AddTickerEntry ( struct FString Text );
 };
 
-UClass* USFXMPEventTicker::pClassPointer = NULL;
-
 // Class SFXGame.sfxgui_weaponselection
 // 0x0109 (0x036A - 0x0261)
 class Usfxgui_weaponselection : public USFXGUIMovie
@@ -36709,16 +30238,9 @@ public:
 	unsigned char                                      CurrentLoadoutWeaponType;                         		// 0x0368 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 	unsigned char                                      EntryWeaponGroup;                                 		// 0x0369 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 47197 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4466 );
 	};
 
 	void AS_SetCurrentNameText ( struct FString sName );
@@ -36788,8 +30310,6 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* Usfxgui_weaponselection::pClassPointer = NULL;
-
 // Class SFXGame.SFXTreasureData
 // 0x0018 (0x0054 - 0x003C)
 class USFXTreasureData : public UObject
@@ -36798,16 +30318,9 @@ public:
 	TArray< struct FTD >                               LevelTreasure;                                    		// 0x003C (0x000C) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 	TArray< struct FArmorTreasureData >                ArmorTreasure;                                    		// 0x0048 (0x000C) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 47400 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4469 );
 	};
 
 	void GetArmorTreasure ( TArray< struct FArmorTreasureData >* OutArmorTreasure );
@@ -36819,8 +30332,6 @@ public:
 	struct FName CurrentLevel ( );
 };
 
-UClass* USFXTreasureData::pClassPointer = NULL;
-
 // Class SFXGame.biocheatmanagernonnative
 // 0x005B (0x0164 - 0x0109)
 class Ubiocheatmanagernonnative : public UBioCheatManager
@@ -36839,16 +30350,9 @@ public:
 	unsigned long                                      MPBotsIgnoreHostInternal : 1;                     		// 0x0160 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 	unsigned long                                      bDebugHeadLOD : 1;                                		// 0x0160 (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 47465 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4470 );
 	};
 
 	void SpawnSeeker ( struct FString TargetName );
@@ -36929,8 +30433,6 @@ public:
 	void SetupPlayer ( );
 };
 
-UClass* Ubiocheatmanagernonnative::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_AutoLevelPlayer
 // 0x0014 (0x00C4 - 0x00B0)
 class USFXSeqAct_AutoLevelPlayer : public USequenceAction
@@ -36940,24 +30442,15 @@ public:
 	int                                                FullGameExperience;                               		// 0x00BC (0x0004) [0x0000000000004000]              ( CPF_Config )
 	float                                              SideContentXP;                                    		// 0x00C0 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 47540 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4471 );
 	};
 
 	void AutoLevelUpPlot ( );
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_AutoLevelPlayer::pClassPointer = NULL;
-
 // Class SFXGame.sfxscoremanager
 // 0x00C8 (0x0104 - 0x003C)
 class Usfxscoremanager : public UObject
@@ -36992,16 +30485,9 @@ public:
 	int                                                LastBonusCreditsEarned;                           		// 0x00FC (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned long                                      bPlayerDownedInWave : 1;                          		// 0x0100 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 47931 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4474 );
 	};
 
 	void ShowExtractionCreditsEarnedMessage ( class Asfxplayercontroller* PC, float Credits );
@@ -37027,8 +30513,6 @@ public:
 	bool Init ( );
 };
 
-UClass* Usfxscoremanager::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_BioToggleCinematicMode
 // 0x0010 (0x00C4 - 0x00B4)
 class UBioSeqAct_BioToggleCinematicMode : public USeqAct_ToggleCinematicMode
@@ -37040,62 +30524,37 @@ public:
 	unsigned long                                      m_bSupportsPlayerHelmet : 1;                      		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 	unsigned long                                      m_bSupportsPlayerFace : 1;                        		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 48152 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4475 );
 	};
 
 	void ToggleCineMode ( );
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_BioToggleCinematicMode::pClassPointer = NULL;
-
 // Class SFXGame.BioConvNodeTrackDebugInst
 // 0x0000 (0x0040 - 0x0040)
 class UBioConvNodeTrackDebugInst : public USFXGameInterpTrackInst
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 48301 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4476 );
 	};
 
 };
 
-UClass* UBioConvNodeTrackDebugInst::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameEffect_DamageTakenBonus
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_DamageTakenBonus : public USFXGameEffect
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 48359 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4477 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -37111,8 +30570,6 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_DamageTakenBonus::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_Interpolate
 // 0x0055 (0x0141 - 0x00EC)
 class USFXCameraMode_Interpolate : public USFXCameraMode
@@ -37133,16 +30590,9 @@ public:
 	unsigned long                                      bDisableAimPointPreservation : 1;                 		// 0x013C (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 	unsigned char                                      InterpMethod;                                     		// 0x0140 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 48462 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4480 );
 	};
 
 	void DrawHUD ( class UBioCheatManager* M );
@@ -37155,8 +30605,6 @@ public:
 	float Interpolate ( float T );
 };
 
-UClass* USFXCameraMode_Interpolate::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraTransition_FaceTarget
 // 0x0027 (0x0168 - 0x0141)
 class USFXCameraTransition_FaceTarget : public USFXCameraMode_Interpolate
@@ -37166,24 +30614,15 @@ public:
 	struct FRotator                                    StartRotation;                                    		// 0x0150 (0x000C) [0x0000000000000000]              
 	struct FVector                                     StartLocation;                                    		// 0x015C (0x000C) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 48461 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4479 );
 	};
 
 	void Tick ( float TimeDelta );
 	void InitializeTransition ( class USFXCameraMode* FromMode, class USFXCameraMode* ToMode, float Time, unsigned long PreserveTarget );
 };
 
-UClass* USFXCameraTransition_FaceTarget::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_Timeline
 // 0x0024 (0x006C - 0x0048)
 class USFXModule_Timeline : public USFXModule
@@ -37193,16 +30632,9 @@ public:
 	struct FScriptDelegate                             __AOEEvalFunc__Delegate;                          		// 0x0054 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	struct FScriptDelegate                             __InputHandler__Delegate;                         		// 0x0060 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 48498 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4481 );
 	};
 
 	void CleanupTimeline ( class USFXTimelineData* Data );
@@ -37221,8 +30653,6 @@ public:
 	bool AOEEvalFunc ( class AActor* ChkOwner, class AActor* ChkTarget );
 };
 
-UClass* USFXModule_Timeline::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_CustomAction
 // 0x0004 (0x0088 - 0x0084)
 class USFXAICmd_CustomAction : public USFXAICommand
@@ -37230,16 +30660,9 @@ class USFXAICmd_CustomAction : public USFXAICommand
 public:
 	unsigned long                                      bPendingTransition : 1;                           		// 0x0084 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 48610 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4482 );
 	};
 
 	bool IsCustomActionComplete ( );
@@ -37255,8 +30678,6 @@ public:
 	bool StartCustomAction ( class Asfxai_core* AI, class UClass* AICommandClass );
 };
 
-UClass* USFXAICmd_CustomAction::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_Ragdoll
 // 0x0037 (0x00F8 - 0x00C1)
 class USFXCustomAction_Ragdoll : public UBioCustomAction
@@ -37270,16 +30691,9 @@ public:
 	unsigned long                                      bHeldInRagdoll : 1;                               		// 0x00F4 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned long                                      bVelocityChange : 1;                              		// 0x00F4 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 48611 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4483 );
 	};
 
 	bool CanOverrideMoveWith ( int OldCustomAction, int NewCustomAction );
@@ -37296,8 +30710,6 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_Ragdoll::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_AnimatedRagdoll
 // 0x0038 (0x00F9 - 0x00C1)
 class USFXCustomAction_AnimatedRagdoll : public UBioCustomAction
@@ -37312,16 +30724,9 @@ public:
 	unsigned long                                      bFinishedStartAnim : 1;                           		// 0x00F4 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned char                                      RootMotionMode;                                   		// 0x00F8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 48612 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4484 );
 	};
 
 	bool CanOverrideMoveWith ( int OldCustomAction, int NewCustomAction );
@@ -37335,8 +30740,6 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_AnimatedRagdoll::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_Frozen
 // 0x0007 (0x00C8 - 0x00C1)
 class USFXCustomAction_Frozen : public UBioCustomAction
@@ -37344,16 +30747,9 @@ class USFXCustomAction_Frozen : public UBioCustomAction
 public:
 	unsigned long                                      bWelded : 1;                                      		// 0x00C4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 48613 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4485 );
 	};
 
 	bool CanBeInterrupted ( );
@@ -37367,8 +30763,6 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_Frozen::pClassPointer = NULL;
-
 // Class SFXGame.BioCustomAction_CombatActivate
 // 0x000F (0x00D0 - 0x00C1)
 class UBioCustomAction_CombatActivate : public UBioCustomAction
@@ -37376,16 +30770,9 @@ class UBioCustomAction_CombatActivate : public UBioCustomAction
 public:
 	struct FBodyStance                                 BS_CombatActivate;                                		// 0x00C4 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 48614 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4486 );
 	};
 
 	void BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime );
@@ -37395,24 +30782,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* UBioCustomAction_CombatActivate::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_CombatActivate
 // 0x0000 (0x0088 - 0x0088)
 class USFXAICmd_CombatActivate : public USFXAICmd_CustomAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 48630 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4487 );
 	};
 
 	bool IsCustomActionComplete ( );
@@ -37428,8 +30806,6 @@ public:
 	bool StartCustomAction ( class Asfxai_core* AI, class UClass* AICommandClass );
 };
 
-UClass* USFXAICmd_CombatActivate::pClassPointer = NULL;
-
 // Class SFXGame.BioCustomAction_CoverClimbMantleBase
 // 0x0034 (0x00F5 - 0x00C1)
 class UBioCustomAction_CoverClimbMantleBase : public UBioCustomAction
@@ -37443,16 +30819,9 @@ public:
 	unsigned long                                      bWasInCover : 1;                                  		// 0x00F0 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned char                                      m_CurrentBodyStance;                              		// 0x00F4 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 48631 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4488 );
 	};
 
 	void EndPlayBodyStance ( unsigned char StanceID );
@@ -37466,8 +30835,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* UBioCustomAction_CoverClimbMantleBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_CA_CoverMantleClimbBase
 // 0x0008 (0x0090 - 0x0088)
 class USFXAICmd_CA_CoverMantleClimbBase : public USFXAICmd_CustomAction
@@ -37476,16 +30843,9 @@ public:
 	class AActor*                                      OriginalMoveTarget;                               		// 0x0088 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	class ANavigationPoint*                            OriginalAnchor;                                   		// 0x008C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 48673 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4489 );
 	};
 
 	bool GetCustomActionMovementState ( );
@@ -37494,24 +30854,15 @@ public:
 	bool ShouldFinishRotation ( );
 };
 
-UClass* USFXAICmd_CA_CoverMantleClimbBase::pClassPointer = NULL;
-
 // Class SFXGame.BioCustomAction_CoverClimb
 // 0x0000 (0x00F5 - 0x00F5)
 class UBioCustomAction_CoverClimb : public UBioCustomAction_CoverClimbMantleBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 48674 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4490 );
 	};
 
 	void EndPlayBodyStance ( unsigned char StanceID );
@@ -37525,8 +30876,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* UBioCustomAction_CoverClimb::pClassPointer = NULL;
-
 // Class SFXGame.BioCustomAction_CoverMantle
 // 0x001B (0x0110 - 0x00F5)
 class UBioCustomAction_CoverMantle : public UBioCustomAction_CoverClimbMantleBase
@@ -37535,16 +30884,9 @@ public:
 	TArray< class AActor* >                            aBumpList;                                        		// 0x00F8 (0x000C) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 	struct FVector                                     vStartLocation;                                   		// 0x0104 (0x000C) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 48682 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4491 );
 	};
 
 	bool NotifyBump ( class AActor* Other, struct FVector HitNormal );
@@ -37553,8 +30895,6 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* UBioCustomAction_CoverMantle::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_CA_KroganCharge
 // 0x0008 (0x0090 - 0x0088)
 class USFXAICmd_CA_KroganCharge : public USFXAICmd_CustomAction
@@ -37563,16 +30903,9 @@ public:
 	float                                              m_fCachedTurnSpeed;                               		// 0x0088 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	float                                              m_fChargeTurnSpeed;                               		// 0x008C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 48732 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4492 );
 	};
 
 	bool eventNotifyBump ( class AActor* Other, struct FVector HitNormal );
@@ -37585,68 +30918,41 @@ public:
 	void eventPushed ( );
 };
 
-UClass* USFXAICmd_CA_KroganCharge::pClassPointer = NULL;
-
 // Class SFXGame.BioDebugMenu
 // 0x0000 (0x003C - 0x003C)
 class UBioDebugMenu : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 48733 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4493 );
 	};
 
 };
 
-UClass* UBioDebugMenu::pClassPointer = NULL;
-
 // Class SFXGame.BioDeprecated
 // 0x0000 (0x003C - 0x003C)
 class UBioDeprecated : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 48758 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4494 );
 	};
 
 };
 
-UClass* UBioDeprecated::pClassPointer = NULL;
-
 // Class SFXGame.BioDestinationArrow
 // 0x0000 (0x01F6 - 0x01F6)
 class ABioDestinationArrow : public AActor
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 48760 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4495 );
 	};
 
 	struct FVector LocalToWorld ( struct FVector vLocal );
@@ -37920,8 +31226,6 @@ public:
 	void ForceUpdateComponents ( unsigned long bCollisionUpdate, unsigned long bTransformOnly );
 };
 
-UClass* ABioDestinationArrow::pClassPointer = NULL;
-
 // Class SFXGame.SFXPlayerCustomization
 // 0x0128 (0x0164 - 0x003C)
 class USFXPlayerCustomization : public UObject
@@ -37956,16 +31260,9 @@ public:
 	void*                                              N7ArmourDescription;                              		// 0x015C (0x0004) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 	class UBioMaterialOverride*                        IconicFemaleMaterialOverride;                     		// 0x0160 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 49609 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4496 );
 	};
 
 	class UBioMaterialOverride* FindIconicMaterialOverride ( unsigned long bIsFemale );
@@ -37975,30 +31272,19 @@ public:
 	class USkeletalMesh* GetMesh ( int Id, unsigned long bIsFemale, TArray< struct FCustomizableElement >* Meshes, struct FCustomizableElement* Element );
 };
 
-UClass* USFXPlayerCustomization::pClassPointer = NULL;
-
 // Class SFXGame.BioGUIBox
 // 0x0000 (0x003C - 0x003C)
 class UBioGUIBox : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 49744 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4497 );
 	};
 
 };
 
-UClass* UBioGUIBox::pClassPointer = NULL;
-
 // Class SFXGame.sfxgamemodedefault
 // 0x001B (0x00B8 - 0x009D)
 class Usfxgamemodedefault : public USFXGameModeBase
@@ -38011,16 +31297,9 @@ public:
 	class UWwiseEvent*                                 UseFailed;                                        		// 0x00B0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	class USFXCameraSetup*                             CameraSetup;                                      		// 0x00B4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 50418 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4500 );
 	};
 
 	bool HasCoverTurn ( );
@@ -38073,8 +31352,6 @@ public:
 	void Initialize ( );
 };
 
-UClass* Usfxgamemodedefault::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeVehicle
 // 0x0013 (0x00B0 - 0x009D)
 class USFXGameModeVehicle : public USFXGameModeBase
@@ -38085,16 +31362,9 @@ public:
 	class USFXCameraMode_Vehicle*                      VehicleCam;                                       		// 0x00A8 (0x0004) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 	class USFXCameraMode_MountedGunTightAim*           TightAimCam;                                      		// 0x00AC (0x0004) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 50419 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4501 );
 	};
 
 	void EnterWeaponWheel ( );
@@ -38111,8 +31381,6 @@ public:
 	void Initialize ( );
 };
 
-UClass* USFXGameModeVehicle::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeAtlas
 // 0x0013 (0x00B0 - 0x009D)
 class USFXGameModeAtlas : public USFXGameModeBase
@@ -38123,16 +31391,9 @@ public:
 	class USFXCameraMode_Atlas*                        AtlasCam;                                         		// 0x00A8 (0x0004) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 	class USFXCameraTransition_FaceTarget*             AtlasTrans;                                       		// 0x00AC (0x0004) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 50420 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4502 );
 	};
 
 	void EnterWeaponWheel ( );
@@ -38149,8 +31410,6 @@ public:
 	class USFXCameraMode* GetCameraMode ( class USFXCameraMode* OldCameraMode, int* PreserveTarget, float* TransitionTime, class USFXCameraMode_Interpolate** Transition );
 };
 
-UClass* USFXGameModeAtlas::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModePowerWheel
 // 0x0007 (0x00A4 - 0x009D)
 class USFXGameModePowerWheel : public USFXGameModeBase
@@ -38158,16 +31417,9 @@ class USFXGameModePowerWheel : public USFXGameModeBase
 public:
 	float                                              DisableMoveTime;                                  		// 0x00A0 (0x0004) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 50421 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4503 );
 	};
 
 	void ShowMenu ( );
@@ -38177,8 +31429,6 @@ public:
 	void Activated ( );
 };
 
-UClass* USFXGameModePowerWheel::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeWeaponWheel
 // 0x0007 (0x00A4 - 0x009D)
 class USFXGameModeWeaponWheel : public USFXGameModeBase
@@ -38186,16 +31436,9 @@ class USFXGameModeWeaponWheel : public USFXGameModeBase
 public:
 	float                                              DisableMoveTime;                                  		// 0x00A0 (0x0004) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 50422 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4504 );
 	};
 
 	void ShowMenu ( );
@@ -38205,8 +31448,6 @@ public:
 	void Activated ( );
 };
 
-UClass* USFXGameModeWeaponWheel::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeCommand
 // 0x0007 (0x00A4 - 0x009D)
 class USFXGameModeCommand : public USFXGameModeBase
@@ -38214,16 +31455,9 @@ class USFXGameModeCommand : public USFXGameModeBase
 public:
 	unsigned long                                      bCameraEnabled : 1;                               		// 0x00A0 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 50423 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4505 );
 	};
 
 	void ShowMenu ( );
@@ -38234,8 +31468,6 @@ public:
 	void Activated ( );
 };
 
-UClass* USFXGameModeCommand::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeInjuredShepard
 // 0x000B (0x00A8 - 0x009D)
 class USFXGameModeInjuredShepard : public USFXGameModeBase
@@ -38244,16 +31476,9 @@ public:
 	float                                              InputDelayTightAimExit;                           		// 0x00A0 (0x0004) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 	class USFXCameraMode_Combat*                       InjuredCamera;                                    		// 0x00A4 (0x0004) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 50424 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4506 );
 	};
 
 	class USFXCameraMode* GetCameraMode ( class USFXCameraMode* OldCameraMode, int* PreserveTarget, float* TransitionTime, class USFXCameraMode_Interpolate** Transition );
@@ -38265,8 +31490,6 @@ public:
 	void TryReload ( );
 };
 
-UClass* USFXGameModeInjuredShepard::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeConversation
 // 0x000B (0x00A8 - 0x009D)
 class USFXGameModeConversation : public USFXGameModeBase
@@ -38275,16 +31498,9 @@ public:
 	class UBioCameraBehaviorConversation*              ConversationCam;                                  		// 0x00A0 (0x0004) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 	class USFXCameraTransition_GalaxyMap*              InstantTransition;                                		// 0x00A4 (0x0004) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 50425 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4507 );
 	};
 
 	void HighlightDefaultResponse ( );
@@ -38298,24 +31514,15 @@ public:
 	class USFXCameraMode* GetCameraMode ( class USFXCameraMode* OldCameraMode, int* PreserveTarget, float* TransitionTime, class USFXCameraMode_Interpolate** Transition );
 };
 
-UClass* USFXGameModeConversation::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeCinematic
 // 0x0000 (0x009D - 0x009D)
 class USFXGameModeCinematic : public USFXGameModeBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 50426 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4508 );
 	};
 
 	bool ShowAreaMap ( );
@@ -38356,8 +31563,6 @@ public:
 	class USFXCameraMode* GetCameraMode ( class USFXCameraMode* OldCameraMode, int* PreserveTarget, float* TransitionTime, class USFXCameraMode_Interpolate** Transition );
 };
 
-UClass* USFXGameModeCinematic::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeGUI
 // 0x001B (0x00B8 - 0x009D)
 class USFXGameModeGUI : public USFXGameModeBase
@@ -38368,16 +31573,9 @@ public:
 	class Ubiocamerabehaviorflourish*                  DeathCam;                                         		// 0x00B0 (0x0004) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 	class USFXCameraTransition_GalaxyMap*              InstantTransition;                                		// 0x00B4 (0x0004) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 50427 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4509 );
 	};
 
 	void SlideshowExit ( );
@@ -38394,8 +31592,6 @@ public:
 	class USFXCameraMode* GetCameraMode ( class USFXCameraMode* OldCameraMode, int* PreserveTarget, float* TransitionTime, class USFXCameraMode_Interpolate** Transition );
 };
 
-UClass* USFXGameModeGUI::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeMovie
 // 0x0007 (0x00A4 - 0x009D)
 class USFXGameModeMovie : public USFXGameModeBase
@@ -38403,16 +31599,9 @@ class USFXGameModeMovie : public USFXGameModeBase
 public:
 	unsigned long                                      bLoadingMovie : 1;                                		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 50428 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4510 );
 	};
 
 	void SkipMovie ( );
@@ -38420,24 +31609,15 @@ public:
 	void ActivateSpecifier ( struct FName ModeSpecifier );
 };
 
-UClass* USFXGameModeMovie::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeCheatMenu
 // 0x0000 (0x009D - 0x009D)
 class USFXGameModeCheatMenu : public USFXGameModeBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 50429 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4511 );
 	};
 
 	bool ShowAreaMap ( );
@@ -38478,8 +31658,6 @@ public:
 	class USFXCameraMode* GetCameraMode ( class USFXCameraMode* OldCameraMode, int* PreserveTarget, float* TransitionTime, class USFXCameraMode_Interpolate** Transition );
 };
 
-UClass* USFXGameModeCheatMenu::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeAIDebug
 // 0x0043 (0x00E0 - 0x009D)
 class USFXGameModeAIDebug : public USFXGameModeBase
@@ -38505,16 +31683,9 @@ public:
 	unsigned long                                      bUnPauseOnExit : 1;                               		// 0x00DC (0x0004) [0x0000000000000000] [0x00000040] 
 	unsigned long                                      bShowLegend : 1;                                  		// 0x00DC (0x0004) [0x0000000000000000] [0x00000080] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 50430 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4512 );
 	};
 
 	void ToggleLegend ( );
@@ -38539,24 +31710,15 @@ public:
 	class USFXCameraMode* GetCameraMode ( class USFXCameraMode* OldCameraMode, int* PreserveTarget, float* TransitionTime, class USFXCameraMode_Interpolate** Transition );
 };
 
-UClass* USFXGameModeAIDebug::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeProto
 // 0x0000 (0x009D - 0x009D)
 class USFXGameModeProto : public USFXGameModeBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 50431 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4513 );
 	};
 
 	bool ShowAreaMap ( );
@@ -38597,24 +31759,15 @@ public:
 	class USFXCameraMode* GetCameraMode ( class USFXCameraMode* OldCameraMode, int* PreserveTarget, float* TransitionTime, class USFXCameraMode_Interpolate** Transition );
 };
 
-UClass* USFXGameModeProto::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeDreamSequence
 // 0x0000 (0x009D - 0x009D)
 class USFXGameModeDreamSequence : public USFXGameModeBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 50432 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4514 );
 	};
 
 	bool ShowAreaMap ( );
@@ -38655,8 +31808,6 @@ public:
 	class USFXCameraMode* GetCameraMode ( class USFXCameraMode* OldCameraMode, int* PreserveTarget, float* TransitionTime, class USFXCameraMode_Interpolate** Transition );
 };
 
-UClass* USFXGameModeDreamSequence::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeIllusiveManConflict
 // 0x009B (0x0138 - 0x009D)
 class USFXGameModeIllusiveManConflict : public USFXGameModeBase
@@ -38670,16 +31821,9 @@ public:
 	class USFXCameraMode_IllusiveManConflict*          CameraMode;                                       		// 0x0130 (0x0004) [0x0000000004400008]              ( CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 	unsigned long                                      bPushing : 1;                                     		// 0x0134 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 50433 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4515 );
 	};
 
 	void StartPush ( );
@@ -38697,8 +31841,6 @@ public:
 	void Activated ( );
 };
 
-UClass* USFXGameModeIllusiveManConflict::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeSpectator
 // 0x0007 (0x00A4 - 0x009D)
 class USFXGameModeSpectator : public USFXGameModeBase
@@ -38706,16 +31848,9 @@ class USFXGameModeSpectator : public USFXGameModeBase
 public:
 	class USFXCameraMode_Spectator*                    SpectatorCam;                                     		// 0x00A0 (0x0004) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 50434 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4516 );
 	};
 
 	class USFXCameraMode* GetCameraMode ( class USFXCameraMode* OldCameraMode, int* PreserveTarget, float* TransitionTime, class USFXCameraMode_Interpolate** Transition );
@@ -38724,8 +31859,6 @@ public:
 	void Activated ( );
 };
 
-UClass* USFXGameModeSpectator::pClassPointer = NULL;
-
 // Class SFXGame.sfxgamemodedying
 // 0x0013 (0x00B0 - 0x009D)
 class Usfxgamemodedying : public USFXGameModeBase
@@ -38736,16 +31869,9 @@ public:
 	float                                              StartBoostTime;                                   		// 0x00A8 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	class Ubiocamerabehaviorflourish*                  DeathCam;                                         		// 0x00AC (0x0004) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 50435 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4517 );
 	};
 
 	void UseRevivePower ( );
@@ -38759,8 +31885,6 @@ public:
 	void ClearHints ( );
 };
 
-UClass* Usfxgamemodedying::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeFlyCam
 // 0x0007 (0x00A4 - 0x009D)
 class USFXGameModeFlyCam : public USFXGameModeBase
@@ -38768,23 +31892,14 @@ class USFXGameModeFlyCam : public USFXGameModeBase
 public:
 	class UBioCameraBehaviorFree*                      FreeCam;                                          		// 0x00A0 (0x0004) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 50436 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4518 );
 	};
 
 	class USFXCameraMode* GetCameraMode ( class USFXCameraMode* OldCameraMode, int* PreserveTarget, float* TransitionTime, class USFXCameraMode_Interpolate** Transition );
 };
 
-UClass* USFXGameModeFlyCam::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeReplicationDebug
 // 0x0007 (0x00A4 - 0x009D)
 class USFXGameModeReplicationDebug : public USFXGameModeBase
@@ -38792,23 +31907,14 @@ class USFXGameModeReplicationDebug : public USFXGameModeBase
 public:
 	class USFXCameraMode_ReplicationDebug*             ReplicationDebugCam;                              		// 0x00A0 (0x0004) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 50437 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4519 );
 	};
 
 	class USFXCameraMode* GetCameraMode ( class USFXCameraMode* OldCameraMode, int* PreserveTarget, float* TransitionTime, class USFXCameraMode_Interpolate** Transition );
 };
 
-UClass* USFXGameModeReplicationDebug::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameModeLobby
 // 0x000F (0x00AC - 0x009D)
 class USFXGameModeLobby : public USFXGameModeBase
@@ -38816,16 +31922,9 @@ class USFXGameModeLobby : public USFXGameModeBase
 public:
 	TArray< struct FName >                             StackedGuis;                                      		// 0x00A0 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 50438 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4520 );
 	};
 
 	void MPToggleReady ( );
@@ -38834,8 +31933,6 @@ public:
 	void ActivateSpecifier ( struct FName ModeSpecifier );
 };
 
-UClass* USFXGameModeLobby::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameConfig
 // 0x0064 (0x00A0 - 0x003C)
 class USFXGameConfig : public UObject
@@ -38868,16 +31965,9 @@ public:
 	unsigned long                                      ScoreEnabled : 1;                                 		// 0x009C (0x0004) [0x0000000000000000] [0x00000020] 
 	unsigned long                                      bBudgetEnforced : 1;                              		// 0x009C (0x0004) [0x0000000000004000] [0x00000040] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 51382 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4655 );
 	};
 
 	bool VerifyPurchasableItems ( );
@@ -38889,8 +31979,6 @@ public:
 	struct FTreasureBudget GetLevelBudget ( );
 };
 
-UClass* USFXGameConfig::pClassPointer = NULL;
-
 // Class SFXGame.SFXPowerLevelUpHelper
 // 0x0020 (0x005C - 0x003C)
 class USFXPowerLevelUpHelper : public UObject
@@ -38901,16 +31989,9 @@ public:
 	class ABioWorldInfo*                               m_WorldInfo;                                      		// 0x0054 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	class ABioPawn*                                    m_Pawn;                                           		// 0x0058 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 51412 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4656 );
 	};
 
 	bool CanMakePurchase ( );
@@ -38929,8 +32010,6 @@ public:
 	bool Initialize ( class ABioWorldInfo* WorldInfo );
 };
 
-UClass* USFXPowerLevelUpHelper::pClassPointer = NULL;
-
 // Class SFXGame.BioLookAtTarget
 // 0x001E (0x0214 - 0x01F6)
 class ABioLookAtTarget : public AActor
@@ -38945,111 +32024,66 @@ public:
 	unsigned long                                      m_bCOSeen : 1;                                    		// 0x0210 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      m_bNCOSeen : 1;                                   		// 0x0210 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 51485 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4657 );
 	};
 
 };
 
-UClass* ABioLookAtTarget::pClassPointer = NULL;
-
 // Class SFXGame.SFXDefine
 // 0x0000 (0x003C - 0x003C)
 class USFXDefine : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 51495 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4658 );
 	};
 
 };
 
-UClass* USFXDefine::pClassPointer = NULL;
-
 // Class SFXGame.BioMessageBox
 // 0x0000 (0x003C - 0x003C)
 class UBioMessageBox : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 51572 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4659 );
 	};
 
 };
 
-UClass* UBioMessageBox::pClassPointer = NULL;
-
 // Class SFXGame.BioMetaVFX
 // 0x0000 (0x003C - 0x003C)
 class UBioMetaVFX : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 51574 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4660 );
 	};
 
 };
 
-UClass* UBioMetaVFX::pClassPointer = NULL;
-
 // Class SFXGame.BioPathPointFactory
 // 0x0000 (0x005C - 0x005C)
 class UBioPathPointFactory : public UActorFactory
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 51926 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4661 );
 	};
 
 	void eventPostCreateActor ( class AActor* NewActor );
 };
 
-UClass* UBioPathPointFactory::pClassPointer = NULL;
-
 // Class SFXGame.sfxgameeffect_powercombo
 // 0x008E (0x00F0 - 0x0062)
 class Usfxgameeffect_powercombo : public USFXGameEffect
@@ -39076,16 +32110,9 @@ public:
 	int                                                MaximumRagdollTargetsMP;                          		// 0x00E8 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	unsigned long                                      bOnlyOnDeath : 1;                                 		// 0x00EC (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 52004 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4662 );
 	};
 
 	void ClientDoPowerComboImpact ( class AActor* oActor, int CustomActionReactionType, float DetonationPowerRank, int MiscFlags );
@@ -39098,24 +32125,15 @@ public:
 	void OnApplied ( );
 };
 
-UClass* Usfxgameeffect_powercombo::pClassPointer = NULL;
-
 // Class SFXGame.SFXPowerCustomAction_PassivePower
 // 0x0000 (0x0695 - 0x0695)
 class USFXPowerCustomAction_PassivePower : public Usfxpowercustomaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 52205 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4663 );
 	};
 
 	int GetSaveGamePowerState ( );
@@ -39212,8 +32230,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXPowerCustomAction_PassivePower::pClassPointer = NULL;
-
 // Class SFXGame.SFXDamageType_Power
 // 0x0007 (0x00E9 - 0x00E2)
 class USFXDamageType_Power : public USFXDamageType_Default
@@ -39222,38 +32238,22 @@ public:
 	float                                              PowerReactionChance;                              		// 0x00E4 (0x0004) [0x0000000000000000]              
 	unsigned char                                      Discipline;                                       		// 0x00E8 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 52512 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4675 );
 	};
 
 };
 
-UClass* USFXDamageType_Power::pClassPointer = NULL;
-
 // Class SFXGame.SFXDamageType_Weapon
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_Weapon : public USFXDamageType
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 52549 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4676 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -39261,8 +32261,6 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_Weapon::pClassPointer = NULL;
-
 // Class SFXGame.SFXPhysicalMaterialProperty
 // 0x0014 (0x0050 - 0x003C)
 class USFXPhysicalMaterialProperty : public UPhysicalMaterialPropertyBase
@@ -39274,44 +32272,26 @@ public:
 	class USFXPhysicalMaterialFootSteps*               PhysicalMaterialFootSteps;                        		// 0x0048 (0x0004) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 	class USFXPhysicalMaterialPhysics*                 PhysicalMaterialPhysics;                          		// 0x004C (0x0004) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 52724 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4677 );
 	};
 
 };
 
-UClass* USFXPhysicalMaterialProperty::pClassPointer = NULL;
-
 // Class SFXGame.SFXPhysicalMaterialBase
 // 0x0000 (0x003C - 0x003C)
 class USFXPhysicalMaterialBase : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 52732 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4679 );
 	};
 
 };
 
-UClass* USFXPhysicalMaterialBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXPhysicalMaterialFootSteps
 // 0x005C (0x0098 - 0x003C)
 class USFXPhysicalMaterialFootSteps : public USFXPhysicalMaterialBase
@@ -39341,22 +32321,13 @@ public:
 	class UParticleSystem*                             FootstepRun;                                      		// 0x0090 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	class UWwiseEvent*                                 TireSound;                                        		// 0x0094 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 52731 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4678 );
 	};
 
 };
 
-UClass* USFXPhysicalMaterialFootSteps::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_DamageReaction
 // 0x0040 (0x0101 - 0x00C1)
 class USFXCustomAction_DamageReaction : public UBioCustomAction
@@ -39379,16 +32350,9 @@ public:
 	unsigned long                                      bDeathReaction : 1;                               		// 0x00FC (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 	unsigned char                                      ERootMotionMode;                                  		// 0x0100 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 52844 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4680 );
 	};
 
 	void ActivateImpactEmitter ( struct FVector HitLocation, struct FVector HitNormal, struct FName BoneName, class UClass* DamageType );
@@ -39402,8 +32366,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_DamageReaction::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_GiveWeapon
 // 0x0010 (0x00C0 - 0x00B0)
 class USFXSeqAct_GiveWeapon : public USequenceAction
@@ -39413,39 +32375,23 @@ public:
 	unsigned long                                      bClearExisting : 1;                               		// 0x00BC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bForceReplace : 1;                                		// 0x00BC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 53068 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4681 );
 	};
 
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_GiveWeapon::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqEvt_OnCastAt
 // 0x0000 (0x00D2 - 0x00D2)
 class UBioSeqEvt_OnCastAt : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 53200 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4684 );
 	};
 
 	void eventToggled ( );
@@ -39455,24 +32401,15 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* UBioSeqEvt_OnCastAt::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqEvt_Ragdoll
 // 0x0000 (0x00D2 - 0x00D2)
 class USFXSeqEvt_Ragdoll : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 53288 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4685 );
 	};
 
 	void eventToggled ( );
@@ -39482,24 +32419,15 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* USFXSeqEvt_Ragdoll::pClassPointer = NULL;
-
 // Class SFXGame.SFXKillRagdollVolume
 // 0x0000 (0x022C - 0x022C)
 class ASFXKillRagdollVolume : public ATriggerVolume
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 53301 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4686 );
 	};
 
 	void eventProcessActorSetVolume ( class AActor* Other );
@@ -39513,8 +32441,6 @@ public:
 	bool Encompasses ( class AActor* Other );
 };
 
-UClass* ASFXKillRagdollVolume::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameEffect_DeathEffect
 // 0x0016 (0x0078 - 0x0062)
 class USFXGameEffect_DeathEffect : public USFXGameEffect
@@ -39526,22 +32452,13 @@ public:
 	int                                                Priority;                                         		// 0x0070 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bCorpseDestroyed : 1;                             		// 0x0074 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 53445 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4687 );
 	};
 
 };
 
-UClass* USFXGameEffect_DeathEffect::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_SyncPawnPartner_Base
 // 0x002B (0x00EC - 0x00C1)
 class USFXCustomAction_SyncPawnPartner_Base : public UBioCustomAction
@@ -39555,16 +32472,9 @@ public:
 	class USFXTimelineData*                            APSTimeline;                                      		// 0x00E4 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bSendReachedDestinationEvent : 1;                 		// 0x00E8 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 53520 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4688 );
 	};
 
 	bool CanBeInterrupted ( );
@@ -39579,8 +32489,6 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_SyncPawnPartner_Base::pClassPointer = NULL;
-
 // Class SFXGame.sfxmodule_damageplayer
 // 0x007B (0x025C - 0x01E1)
 class Usfxmodule_damageplayer : public USFXModule_DamageParty
@@ -39606,16 +32514,9 @@ public:
 	class UWwiseEventPairObject*                       BleedOutEventPair;                                		// 0x0254 (0x0004) [0x0000000000000000]              
 	float                                              HealthRatio;                                      		// 0x0258 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 53550 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4689 );
 	};
 
 	void SFXTakeDamage ( float Damage, struct FVector Momentum, class UClass* DamageType, class AController* instigatedBy, class AActor* DamageCauser, struct FTraceHitInfo* HitInfo, struct FVector* HitLocation );
@@ -39635,24 +32536,15 @@ public:
 	void RegenFullHealth ( );
 };
 
-UClass* Usfxmodule_damageplayer::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqEvt_ImpactedByPower
 // 0x0000 (0x00D2 - 0x00D2)
 class USFXSeqEvt_ImpactedByPower : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 53557 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4690 );
 	};
 
 	void eventToggled ( );
@@ -39662,90 +32554,54 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* USFXSeqEvt_ImpactedByPower::pClassPointer = NULL;
-
 // Class SFXGame.SFXDamageType_Power_Fire
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_Power_Fire : public USFXDamageType_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 53573 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4691 );
 	};
 
 };
 
-UClass* USFXDamageType_Power_Fire::pClassPointer = NULL;
-
 // Class SFXGame.SFXDamageType_Power_Electrocute
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_Power_Electrocute : public USFXDamageType_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 53574 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4692 );
 	};
 
 };
 
-UClass* USFXDamageType_Power_Electrocute::pClassPointer = NULL;
-
 // Class SFXGame.SFXDamageType_Power_Freeze
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_Power_Freeze : public USFXDamageType_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 53575 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4693 );
 	};
 
 };
 
-UClass* USFXDamageType_Power_Freeze::pClassPointer = NULL;
-
 // Class SFXGame.SFXDamageType_Melee
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_Melee : public USFXDamageType_Default
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 53606 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4694 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -39753,24 +32609,15 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_Melee::pClassPointer = NULL;
-
 // Class SFXGame.SFXDamageType_SecondMelee
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_SecondMelee : public USFXDamageType_Default
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 53607 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4695 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -39778,24 +32625,15 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_SecondMelee::pClassPointer = NULL;
-
 // Class SFXGame.SFXDamageType_ThirdMelee
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_ThirdMelee : public USFXDamageType_Default
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 53608 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4696 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -39803,24 +32641,15 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_ThirdMelee::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqEvt_NotifyLimbDetached
 // 0x0000 (0x00D2 - 0x00D2)
 class UBioSeqEvt_NotifyLimbDetached : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 53651 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4697 );
 	};
 
 	void eventToggled ( );
@@ -39830,8 +32659,6 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* UBioSeqEvt_NotifyLimbDetached::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_OrbitalGame
 // 0x00D0 (0x0190 - 0x00C0)
 class UBioSeqAct_OrbitalGame : public USeqAct_Latent
@@ -39872,16 +32699,9 @@ public:
 	class UWwiseBaseSoundObject*                       AnomalyStaticStop;                                		// 0x0188 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	class UBioPlanet*                                  CurrentPlanet;                                    		// 0x018C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 53658 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4698 );
 	};
 
 	class UBioCameraBehaviorGalaxy* GetGalaxyCamera ( );
@@ -39892,8 +32712,6 @@ public:
 	void eventActivated ( );
 };
 
-UClass* UBioSeqAct_OrbitalGame::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_MultiLand
 // 0x0038 (0x00F8 - 0x00C0)
 class UBioSeqAct_MultiLand : public USeqAct_Latent
@@ -39908,16 +32726,9 @@ public:
 	float                                              LandingSiteScale;                                 		// 0x00F0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	class UBioPlanet*                                  CurrentPlanet;                                    		// 0x00F4 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 53661 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4699 );
 	};
 
 	class UBioCameraBehaviorGalaxy* GetGalaxyCamera ( );
@@ -39926,8 +32737,6 @@ public:
 	void eventActivated ( );
 };
 
-UClass* UBioSeqAct_MultiLand::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_MoveAlongCover
 // 0x0023 (0x00E4 - 0x00C1)
 class USFXCustomAction_MoveAlongCover : public UBioCustomAction
@@ -39942,16 +32751,9 @@ public:
 	unsigned long                                      m_bIsInitialized : 1;                             		// 0x00E0 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 	unsigned long                                      m_bIsInterrupted : 1;                             		// 0x00E0 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 53918 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4701 );
 	};
 
 	void StopCustomAction ( );
@@ -39966,24 +32768,15 @@ public:
 	bool InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced );
 };
 
-UClass* USFXCustomAction_MoveAlongCover::pClassPointer = NULL;
-
 // Class SFXGame.SFXDamageType_PowerPhysics
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_PowerPhysics : public USFXDamageType
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 54238 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4704 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -39991,8 +32784,6 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_PowerPhysics::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_SingleAnim
 // 0x002D (0x00EE - 0x00C1)
 class USFXCustomAction_SingleAnim : public UBioCustomAction
@@ -40013,16 +32804,9 @@ public:
 	unsigned char                                      RootBoneZ;                                        		// 0x00EC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      StartBlendType;                                   		// 0x00ED (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 54542 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4706 );
 	};
 
 	void BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime );
@@ -40033,24 +32817,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_SingleAnim::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_MountedGunReload
 // 0x0000 (0x00EE - 0x00EE)
 class USFXCustomAction_MountedGunReload : public USFXCustomAction_SingleAnim
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 54541 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4705 );
 	};
 
 	void BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime );
@@ -40061,24 +32836,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_MountedGunReload::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_EnterMountedGun
 // 0x0000 (0x00EE - 0x00EE)
 class USFXCustomAction_EnterMountedGun : public USFXCustomAction_SingleAnim
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 54543 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4707 );
 	};
 
 	void BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime );
@@ -40089,24 +32855,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_EnterMountedGun::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_ExitMountedGun
 // 0x0000 (0x00EE - 0x00EE)
 class USFXCustomAction_ExitMountedGun : public USFXCustomAction_SingleAnim
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 54544 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4708 );
 	};
 
 	void BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime );
@@ -40117,8 +32874,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_ExitMountedGun::pClassPointer = NULL;
-
 // Class SFXGame.SFXPhysicalMaterialPhysics
 // 0x0008 (0x0044 - 0x003C)
 class USFXPhysicalMaterialPhysics : public USFXPhysicalMaterialBase
@@ -40127,22 +32882,13 @@ public:
 	class UWwiseEvent*                                 Sound;                                            		// 0x003C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	int                                                WwiseType;                                        		// 0x0040 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 54635 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4709 );
 	};
 
 };
 
-UClass* USFXPhysicalMaterialPhysics::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_MoveToLocation
 // 0x0004 (0x0088 - 0x0084)
 class USFXAICmd_MoveToLocation : public USFXAICommand
@@ -40153,16 +32899,9 @@ public:
 	unsigned long                                      m_bMoveCancelled : 1;                             		// 0x0084 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 	unsigned long                                      m_bUsePartialPaths : 1;                           		// 0x0084 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 55430 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4762 );
 	};
 
 	bool CancelCommand ( int nReason );
@@ -40179,8 +32918,6 @@ public:
 	bool MoveToLocation ( class Asfxai_core* AI, struct FVector NewMovePoint, float NewMoveOffset, unsigned long bInAllowedToFire, unsigned long bInAllowPartialPath, unsigned long bInAllowEarlyFinish );
 };
 
-UClass* USFXAICmd_MoveToLocation::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_PrecisionMove
 // 0x001F (0x00E0 - 0x00C1)
 class USFXCustomAction_PrecisionMove : public UBioCustomAction
@@ -40190,16 +32927,9 @@ public:
 	struct FRotator                                    m_rDestinationRot;                                		// 0x00D0 (0x000C) [0x0000000000000000]              
 	float                                              m_fRotationTime;                                  		// 0x00DC (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 55486 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4773 );
 	};
 
 	void eventReachedPrecisePosition ( );
@@ -40207,8 +32937,6 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_PrecisionMove::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_UsePower
 // 0x001C (0x00A0 - 0x0084)
 class USFXAICmd_UsePower : public USFXAICommand
@@ -40220,16 +32948,9 @@ public:
 	unsigned long                                      bPlayerOrder : 1;                                 		// 0x009C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned long                                      bTargetSpecified : 1;                             		// 0x009C (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 55499 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4777 );
 	};
 
 	struct FString eventGetDumpString ( );
@@ -40241,24 +32962,15 @@ public:
 	bool UsePower ( class Asfxai_core* AI, struct FName nmPower, class AActor* oTarget, struct FVector vTargetLoc, unsigned long bUseSpecifiedTarget, unsigned long bOrdered );
 };
 
-UClass* USFXAICmd_UsePower::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_Fallen
 // 0x0000 (0x0084 - 0x0084)
 class USFXAICmd_Fallen : public USFXAICommand
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 55565 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4793 );
 	};
 
 	void NotifyFriendDied ( class ABioPawn* FriendPawn );
@@ -40290,8 +33002,6 @@ public:
 	void Paused ( class UGameAICommand* NewCommand );
 };
 
-UClass* USFXAICmd_Fallen::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICommand_Base_Combat
 // 0x0014 (0x0098 - 0x0084)
 class USFXAICommand_Base_Combat : public USFXAICommand
@@ -40301,16 +33011,9 @@ public:
 	struct FVector2D                                   TransitionCheckTime;                              		// 0x008C (0x0008) [0x0000000000000000]              
 	unsigned long                                      bFiringWeapon : 1;                                		// 0x0094 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 55580 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4798 );
 	};
 
 	void StopSustainedFire ( );
@@ -40321,24 +33024,15 @@ public:
 	void Pushed ( );
 };
 
-UClass* USFXAICommand_Base_Combat::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_ReturnToPlaypen
 // 0x0000 (0x0098 - 0x0098)
 class USFXAICmd_ReturnToPlaypen : public USFXAICommand_Base_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 55579 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4797 );
 	};
 
 	void StopSustainedFire ( );
@@ -40349,8 +33043,6 @@ public:
 	void Pushed ( );
 };
 
-UClass* USFXAICmd_ReturnToPlaypen::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_FireWeapon
 // 0x000C (0x0090 - 0x0084)
 class USFXAICmd_FireWeapon : public USFXAICommand
@@ -40360,16 +33052,9 @@ public:
 	float                                              DamageThreshold;                                  		// 0x0088 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned long                                      bForceShoot : 1;                                  		// 0x008C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 55648 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4816 );
 	};
 
 	void UpdateFocus ( );
@@ -40387,24 +33072,15 @@ public:
 	bool FireWeapon ( class Asfxai_core* AI, float DmgThreshold, unsigned long ForceShoot );
 };
 
-UClass* USFXAICmd_FireWeapon::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_Disabled
 // 0x0000 (0x0098 - 0x0098)
 class USFXAICmd_Disabled : public USFXAICommand_Base_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 55701 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4823 );
 	};
 
 	void StopSustainedFire ( );
@@ -40415,24 +33091,15 @@ public:
 	void Pushed ( );
 };
 
-UClass* USFXAICmd_Disabled::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_KismetOrder
 // 0x0000 (0x0098 - 0x0098)
 class USFXAICmd_KismetOrder : public USFXAICommand_Base_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 55709 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4826 );
 	};
 
 	void StopSustainedFire ( );
@@ -40443,8 +33110,6 @@ public:
 	void Pushed ( );
 };
 
-UClass* USFXAICmd_KismetOrder::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_FollowActor
 // 0x0004 (0x0088 - 0x0084)
 class USFXAICmd_FollowActor : public USFXAICommand
@@ -40452,16 +33117,9 @@ class USFXAICmd_FollowActor : public USFXAICommand
 public:
 	unsigned long                                      bActorReachable : 1;                              		// 0x0084 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 55751 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4833 );
 	};
 
 	bool eventNotifyBump ( class AActor* Other, struct FVector HitNormal );
@@ -40475,8 +33133,6 @@ public:
 	void Pushed ( );
 };
 
-UClass* USFXAICmd_FollowActor::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_PossessTurret
 // 0x0004 (0x00B4 - 0x00B0)
 class USFXSeqAct_PossessTurret : public USequenceAction
@@ -40484,23 +33140,14 @@ class USFXSeqAct_PossessTurret : public USequenceAction
 public:
 	class ASFXVehicle_MountedGun*                      MountedGun;                                       		// 0x00B0 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 55853 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4855 );
 	};
 
 	int eventGetObjClassVersion ( );
 };
 
-UClass* USFXSeqAct_PossessTurret::pClassPointer = NULL;
-
 // Class SFXGame.sfxaicmd_killingblow
 // 0x000C (0x00A4 - 0x0098)
 class Usfxaicmd_killingblow : public USFXAICommand_Base_Combat
@@ -40508,16 +33155,9 @@ class Usfxaicmd_killingblow : public USFXAICommand_Base_Combat
 public:
 	struct FRotator                                    ToTarget;                                         		// 0x0098 (0x000C) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 55869 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4859 );
 	};
 
 	bool IsInStompRange ( class APawn* StompTarget );
@@ -40525,8 +33165,6 @@ public:
 	void Pushed ( );
 };
 
-UClass* Usfxaicmd_killingblow::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_MoveToCover
 // 0x0004 (0x0088 - 0x0084)
 class USFXAICmd_MoveToCover : public USFXAICommand
@@ -40535,16 +33173,9 @@ public:
 	unsigned long                                      m_bDoPeriodicCoverCheck : 1;                      		// 0x0084 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned long                                      m_bAllowedToFire : 1;                             		// 0x0084 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 55957 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4860 );
 	};
 
 	void eventPopped ( );
@@ -40554,24 +33185,15 @@ public:
 	bool MoveToCover ( class ASFXAI_Cover* AI, unsigned long bInDoPeriodicCoverCheck, unsigned long bInAllowedToFire );
 };
 
-UClass* USFXAICmd_MoveToCover::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_CoverUserStuck
 // 0x0000 (0x0098 - 0x0098)
 class USFXAICmd_CoverUserStuck : public USFXAICommand_Base_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 55995 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4861 );
 	};
 
 	void StopSustainedFire ( );
@@ -40582,24 +33204,15 @@ public:
 	void Pushed ( );
 };
 
-UClass* USFXAICmd_CoverUserStuck::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_Base_Melee
 // 0x0000 (0x0098 - 0x0098)
 class USFXAICmd_Base_Melee : public USFXAICommand_Base_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 56014 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4862 );
 	};
 
 	void StopSustainedFire ( );
@@ -40610,24 +33223,15 @@ public:
 	void Pushed ( );
 };
 
-UClass* USFXAICmd_Base_Melee::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_Reaction_Flank
 // 0x0000 (0x0098 - 0x0098)
 class USFXAICmd_Reaction_Flank : public USFXAICommand_Base_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 56018 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4863 );
 	};
 
 	void StopSustainedFire ( );
@@ -40638,46 +33242,28 @@ public:
 	void Pushed ( );
 };
 
-UClass* USFXAICmd_Reaction_Flank::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_CoverUserEvade
 // 0x0000 (0x00B0 - 0x00B0)
 class USFXSeqAct_CoverUserEvade : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 56021 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4864 );
 	};
 
 };
 
-UClass* USFXSeqAct_CoverUserEvade::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_Berserk
 // 0x0000 (0x0098 - 0x0098)
 class USFXAICmd_Berserk : public USFXAICommand_Base_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 56033 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4865 );
 	};
 
 	void StopSustainedFire ( );
@@ -40688,24 +33274,15 @@ public:
 	void Pushed ( );
 };
 
-UClass* USFXAICmd_Berserk::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_Resurrect
 // 0x0000 (0x0098 - 0x0098)
 class USFXAICmd_Resurrect : public USFXAICommand_Base_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 56147 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4866 );
 	};
 
 	void StopSustainedFire ( );
@@ -40716,8 +33293,6 @@ public:
 	void Pushed ( );
 };
 
-UClass* USFXAICmd_Resurrect::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_AcquireCover
 // 0x0014 (0x0098 - 0x0084)
 class USFXAICmd_AcquireCover : public USFXAICommand
@@ -40729,24 +33304,15 @@ public:
 	unsigned long                                      bDoPeriodicCoverCheck : 1;                        		// 0x0094 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned long                                      bCanShoot : 1;                                    		// 0x0094 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 56165 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4867 );
 	};
 
 	void Pushed ( );
 	bool AcquireNewCover ( class ASFXAI_Cover* AI, class UGoal_AtCover* GoalEvaluator, class AActor* GoalActor, unsigned long bUsePeriodicCheck, unsigned long bAllowedToFire );
 };
 
-UClass* USFXAICmd_AcquireCover::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_AcquireCoverNearHoldLoc
 // 0x0008 (0x00A0 - 0x0098)
 class USFXAICmd_AcquireCoverNearHoldLoc : public USFXAICmd_AcquireCover
@@ -40755,23 +33321,14 @@ public:
 	class ACoverLink*                                  OriginalCoverLink;                                		// 0x0098 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned long                                      bInitialPlayerOrder : 1;                          		// 0x009C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 56172 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4868 );
 	};
 
 	bool AcquireCoverNearHoldLoc ( class ASFXAI_Henchman* AI, class UGoal_AtCover* GoalEvaluator, class AActor* GoalActor, unsigned long bPlayerOrder, unsigned long bUsePeriodicCheck, unsigned long bAllowedToFire );
 };
 
-UClass* USFXAICmd_AcquireCoverNearHoldLoc::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_MoveToGoal
 // 0x0008 (0x008C - 0x0084)
 class USFXAICmd_MoveToGoal : public USFXAICommand
@@ -40783,16 +33340,9 @@ public:
 	unsigned long                                      m_bRotateBeforeMoving : 1;                        		// 0x0088 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 	unsigned long                                      m_bMovingToFireTarget : 1;                        		// 0x0088 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 56178 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4869 );
 	};
 
 	void LogRoute ( );
@@ -40819,24 +33369,15 @@ public:
 	bool MoveToGoal ( class Asfxai_core* AI, class AActor* NewMoveGoal, float NewMoveOffset, unsigned long bInAllowedToFire, unsigned long bInAllowPartialPath, unsigned long bInRotateBeforeMoving );
 };
 
-UClass* USFXAICmd_MoveToGoal::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_Combat_Henchman
 // 0x0000 (0x0098 - 0x0098)
 class USFXAICmd_Combat_Henchman : public USFXAICommand_Base_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 56189 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4870 );
 	};
 
 	void StopSustainedFire ( );
@@ -40847,24 +33388,15 @@ public:
 	void Pushed ( );
 };
 
-UClass* USFXAICmd_Combat_Henchman::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_MoveAwayFromPlayer
 // 0x0000 (0x0098 - 0x0098)
 class USFXAICmd_MoveAwayFromPlayer : public USFXAICommand_Base_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 56234 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4871 );
 	};
 
 	void StopSustainedFire ( );
@@ -40875,24 +33407,15 @@ public:
 	void Pushed ( );
 };
 
-UClass* USFXAICmd_MoveAwayFromPlayer::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameEffect_PassiveWeaponDamageBonus
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_PassiveWeaponDamageBonus : public USFXGameEffect
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 56315 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4872 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -40908,24 +33431,15 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_PassiveWeaponDamageBonus::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_ExecuteOrders
 // 0x0000 (0x0084 - 0x0084)
 class USFXAICmd_ExecuteOrders : public USFXAICommand
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 56357 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4873 );
 	};
 
 	void NotifyFriendDied ( class ABioPawn* FriendPawn );
@@ -40957,24 +33471,15 @@ public:
 	void Paused ( class UGameAICommand* NewCommand );
 };
 
-UClass* USFXAICmd_ExecuteOrders::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_ResetHenchman
 // 0x0000 (0x0084 - 0x0084)
 class USFXAICmd_ResetHenchman : public USFXAICommand
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 56371 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4874 );
 	};
 
 	void NotifyFriendDied ( class ABioPawn* FriendPawn );
@@ -41006,24 +33511,15 @@ public:
 	void Paused ( class UGameAICommand* NewCommand );
 };
 
-UClass* USFXAICmd_ResetHenchman::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_HenchFollowActor
 // 0x0000 (0x0088 - 0x0088)
 class USFXAICmd_HenchFollowActor : public USFXAICmd_FollowActor
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 56372 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4875 );
 	};
 
 	bool eventNotifyBump ( class AActor* Other, struct FVector HitNormal );
@@ -41037,24 +33533,15 @@ public:
 	void Pushed ( );
 };
 
-UClass* USFXAICmd_HenchFollowActor::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_MoveToHoldLocation
 // 0x0000 (0x0084 - 0x0084)
 class USFXAICmd_MoveToHoldLocation : public USFXAICommand
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 56373 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4876 );
 	};
 
 	void NotifyFriendDied ( class ABioPawn* FriendPawn );
@@ -41086,8 +33573,6 @@ public:
 	void Paused ( class UGameAICommand* NewCommand );
 };
 
-UClass* USFXAICmd_MoveToHoldLocation::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_ClassMelee
 // 0x0049 (0x013D - 0x00F4)
 class USFXCustomAction_ClassMelee : public USFXCustomAction_SyncPawnInstigator_Base
@@ -41109,16 +33594,9 @@ public:
 	unsigned long                                      bApplyDamage : 1;                                 		// 0x0138 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned char                                      eVictimRootMotionMode;                            		// 0x013C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 57983 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4878 );
 	};
 
 	void InterruptThisCustomAction ( );
@@ -41135,8 +33613,6 @@ public:
 	bool InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced );
 };
 
-UClass* USFXCustomAction_ClassMelee::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_SwatTurn
 // 0x0078 (0x01AC - 0x0134)
 class USFXCustomAction_SwatTurn : public USFXCustomAction_ProceduralMoveBase
@@ -41159,16 +33635,9 @@ public:
 	unsigned long                                      bEndStanding : 1;                                 		// 0x01A8 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 	unsigned long                                      bRightSwatTurn : 1;                               		// 0x01A8 (0x0004) [0x0000000000000002] [0x00000004] ( CPF_Const )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 57989 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4880 );
 	};
 
 	float GetBlendOutTime ( );
@@ -41187,24 +33656,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_SwatTurn::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_SwatTurn_Left
 // 0x0000 (0x01AC - 0x01AC)
 class USFXCustomAction_SwatTurn_Left : public USFXCustomAction_SwatTurn
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 57988 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4879 );
 	};
 
 	float GetBlendOutTime ( );
@@ -41223,24 +33683,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_SwatTurn_Left::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_SwatTurn_Right
 // 0x0000 (0x01AC - 0x01AC)
 class USFXCustomAction_SwatTurn_Right : public USFXCustomAction_SwatTurn
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 57994 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4881 );
 	};
 
 	float GetBlendOutTime ( );
@@ -41259,24 +33710,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_SwatTurn_Right::pClassPointer = NULL;
-
 // Class SFXGame.BioPlayerReplicationInfo
 // 0x0000 (0x02AE - 0x02AE)
 class ABioPlayerReplicationInfo : public APlayerReplicationInfo
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 58406 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4882 );
 	};
 
 	void UnregisterPlayerFromSession ( );
@@ -41316,8 +33758,6 @@ public:
 	struct FString GetPlayerAlias ( );
 };
 
-UClass* ABioPlayerReplicationInfo::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_AddPlaypenVolume
 // 0x0010 (0x00C0 - 0x00B0)
 class UBioSeqAct_AddPlaypenVolume : public USequenceAction
@@ -41326,24 +33766,15 @@ public:
 	TArray< class AActor* >                            Volumes;                                          		// 0x00B0 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	class AActor*                                      Squad;                                            		// 0x00BC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 58901 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4883 );
 	};
 
 	int eventGetObjClassVersion ( );
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_AddPlaypenVolume::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_AddToParty
 // 0x000C (0x00BC - 0x00B0)
 class UBioSeqAct_AddToParty : public USequenceAction
@@ -41353,46 +33784,28 @@ public:
 	float                                              TeleportOffsetSide;                               		// 0x00B4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      TeleportToLeader : 1;                             		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 58916 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4884 );
 	};
 
 	int eventGetObjClassVersion ( );
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_AddToParty::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_AdjustCostForDiscount
 // 0x0000 (0x00B0 - 0x00B0)
 class UBioSeqAct_AdjustCostForDiscount : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 58939 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4885 );
 	};
 
 };
 
-UClass* UBioSeqAct_AdjustCostForDiscount::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_AOECauseDamage
 // 0x0018 (0x00C8 - 0x00B0)
 class UBioSeqAct_AOECauseDamage : public USequenceAction
@@ -41406,24 +33819,15 @@ public:
 	unsigned long                                      bDamageFalloff : 1;                               		// 0x00C4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bForceCinematicDamage : 1;                        		// 0x00C4 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 58941 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4886 );
 	};
 
 	int eventGetObjClassVersion ( );
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_AOECauseDamage::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_AreaTransition
 // 0x001C (0x00CC - 0x00B0)
 class UBioSeqAct_AreaTransition : public USequenceAction
@@ -41433,23 +33837,14 @@ public:
 	struct FName                                       AreaName;                                         		// 0x00BC (0x0008) [0x0000000000000001]              ( CPF_Edit )
 	struct FName                                       StartPoint;                                       		// 0x00C4 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 58961 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4887 );
 	};
 
 	void eventActivated ( );
 };
 
-UClass* UBioSeqAct_AreaTransition::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_AttachCrustEffect
 // 0x000C (0x00BC - 0x00B0)
 class UBioSeqAct_AttachCrustEffect : public USequenceAction
@@ -41459,24 +33854,15 @@ public:
 	float                                              fLifeTime;                                        		// 0x00B4 (0x0004) [0x0000000000000000]              
 	class AActor*                                      Target;                                           		// 0x00B8 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 58967 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4888 );
 	};
 
 	int eventGetObjClassVersion ( );
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_AttachCrustEffect::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_AttachVisualEffect
 // 0x0024 (0x00D4 - 0x00B0)
 class UBioSeqAct_AttachVisualEffect : public USequenceAction
@@ -41487,24 +33873,15 @@ public:
 	struct FName                                       m_nmSocketOrBone;                                 		// 0x00C8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 	class UObject*                                     m_oEffect;                                        		// 0x00D0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 58976 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4889 );
 	};
 
 	int eventGetObjClassVersion ( );
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_AttachVisualEffect::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_CauseDamage
 // 0x0014 (0x00C4 - 0x00B0)
 class UBioSeqAct_CauseDamage : public USequenceAction
@@ -41516,68 +33893,41 @@ public:
 	class AActor*                                      InstigatorController;                             		// 0x00BC (0x0004) [0x0000000000000000]              
 	unsigned long                                      bForceCinematicDamage : 1;                        		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59013 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4890 );
 	};
 
 	int eventGetObjClassVersion ( );
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_CauseDamage::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_ClearBrowserWheelStateOverrides
 // 0x0000 (0x00B0 - 0x00B0)
 class UBioSeqAct_ClearBrowserWheelStateOverrides : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59028 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4891 );
 	};
 
 };
 
-UClass* UBioSeqAct_ClearBrowserWheelStateOverrides::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_Deprecated
 // 0x0000 (0x00B0 - 0x00B0)
 class UBioSeqAct_Deprecated : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59034 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4892 );
 	};
 
 };
 
-UClass* UBioSeqAct_Deprecated::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_DUIClear
 // 0x0004 (0x00B4 - 0x00B0)
 class UBioSeqAct_DUIClear : public USequenceAction
@@ -41585,23 +33935,14 @@ class UBioSeqAct_DUIClear : public USequenceAction
 public:
 	unsigned long                                      bModal : 1;                                       		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59038 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4893 );
 	};
 
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_DUIClear::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_DUISetBarFillDirection
 // 0x0004 (0x00B4 - 0x00B0)
 class UBioSeqAct_DUISetBarFillDirection : public USequenceAction
@@ -41610,23 +33951,14 @@ public:
 	unsigned long                                      bModalBar : 1;                                    		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bLeftToRight : 1;                                 		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59043 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4894 );
 	};
 
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_DUISetBarFillDirection::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_DUISetBarFillPercent
 // 0x0008 (0x00B8 - 0x00B0)
 class UBioSeqAct_DUISetBarFillPercent : public USequenceAction
@@ -41635,23 +33967,14 @@ public:
 	int                                                nPercent;                                         		// 0x00B0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bModalBar : 1;                                    		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59049 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4895 );
 	};
 
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_DUISetBarFillPercent::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_DUISetBarMarkers
 // 0x000C (0x00BC - 0x00B0)
 class UBioSeqAct_DUISetBarMarkers : public USequenceAction
@@ -41661,23 +33984,14 @@ public:
 	int                                                nMarker2;                                         		// 0x00B4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bModalBar : 1;                                    		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59055 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4896 );
 	};
 
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_DUISetBarMarkers::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_DUISetCounterValue
 // 0x0008 (0x00B8 - 0x00B0)
 class UBioSeqAct_DUISetCounterValue : public USequenceAction
@@ -41686,23 +34000,14 @@ public:
 	int                                                nValue;                                           		// 0x00B0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bModalCounter : 1;                                		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59062 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4897 );
 	};
 
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_DUISetCounterValue::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_DUISetElementColor
 // 0x0005 (0x00B5 - 0x00B0)
 class UBioSeqAct_DUISetElementColor : public USequenceAction
@@ -41711,23 +34016,14 @@ public:
 	struct FColor                                      oColor;                                           		// 0x00B0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      Element;                                          		// 0x00B4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59068 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4898 );
 	};
 
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_DUISetElementColor::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_DUISetElementPulsing
 // 0x000D (0x00BD - 0x00B0)
 class UBioSeqAct_DUISetElementPulsing : public USequenceAction
@@ -41738,23 +34034,14 @@ public:
 	unsigned long                                      bPulsing : 1;                                     		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned char                                      Element;                                          		// 0x00BC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59078 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4899 );
 	};
 
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_DUISetElementPulsing::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_DUISetElementVisible
 // 0x0009 (0x00B9 - 0x00B0)
 class UBioSeqAct_DUISetElementVisible : public USequenceAction
@@ -41764,23 +34051,14 @@ public:
 	unsigned long                                      bVisible : 1;                                     		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned char                                      Element;                                          		// 0x00B8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59088 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4900 );
 	};
 
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_DUISetElementVisible::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_DUISetTextStringRef
 // 0x0005 (0x00B5 - 0x00B0)
 class UBioSeqAct_DUISetTextStringRef : public USequenceAction
@@ -41789,23 +34067,14 @@ public:
 	void*                                              srText;                                           		// 0x00B0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      Element;                                          		// 0x00B4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59095 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4901 );
 	};
 
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_DUISetTextStringRef::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_EndGame
 // 0x0008 (0x00B8 - 0x00B0)
 class UBioSeqAct_EndGame : public USequenceAction
@@ -41814,23 +34083,14 @@ public:
 	void*                                              srEndGameMessage;                                 		// 0x00B0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      m_bGameOverSignalled : 1;                         		// 0x00B4 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59108 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4902 );
 	};
 
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_EndGame::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_GetSquad
 // 0x0008 (0x00B8 - 0x00B0)
 class UBioSeqAct_GetSquad : public USequenceAction
@@ -41839,67 +34099,40 @@ public:
 	class AActor*                                      oPawn;                                            		// 0x00B0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	class AActor*                                      oSquad;                                           		// 0x00B4 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59157 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4903 );
 	};
 
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_GetSquad::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_HideSniperHudOverlay
 // 0x0000 (0x00B0 - 0x00B0)
 class UBioSeqAct_HideSniperHudOverlay : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59184 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4904 );
 	};
 
 };
 
-UClass* UBioSeqAct_HideSniperHudOverlay::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_InitLoadingMovie
 // 0x0000 (0x00B0 - 0x00B0)
 class UBioSeqAct_InitLoadingMovie : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59189 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4905 );
 	};
 
 };
 
-UClass* UBioSeqAct_InitLoadingMovie::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_InterruptAmbientConversation
 // 0x000C (0x00BC - 0x00B0)
 class UBioSeqAct_InterruptAmbientConversation : public USequenceAction
@@ -41909,23 +34142,14 @@ public:
 	class UBioConversation*                            OnlyInterruptThisConv;                            		// 0x00B4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      m_bInterruptFovoToo : 1;                          		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59191 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4906 );
 	};
 
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_InterruptAmbientConversation::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_IsActiveConversation
 // 0x0008 (0x00B8 - 0x00B0)
 class UBioSeqAct_IsActiveConversation : public USequenceAction
@@ -41936,67 +34160,40 @@ public:
 	unsigned long                                      m_bCheckForFull : 1;                              		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned long                                      m_bCheckForAmbient : 1;                           		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59201 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4907 );
 	};
 
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_IsActiveConversation::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_KillPawn
 // 0x0000 (0x00B0 - 0x00B0)
 class UBioSeqAct_KillPawn : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59212 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4908 );
 	};
 
 };
 
-UClass* UBioSeqAct_KillPawn::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_NonCombatArea
 // 0x0000 (0x00B0 - 0x00B0)
 class UBioSeqAct_NonCombatArea : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59249 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4909 );
 	};
 
 };
 
-UClass* UBioSeqAct_NonCombatArea::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_Ragdoll
 // 0x0004 (0x00B4 - 0x00B0)
 class UBioSeqAct_Ragdoll : public USequenceAction
@@ -42004,45 +34201,27 @@ class UBioSeqAct_Ragdoll : public USequenceAction
 public:
 	class AActor*                                      mActor;                                           		// 0x00B0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59320 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4910 );
 	};
 
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_Ragdoll::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_RemoveFromParty
 // 0x0000 (0x00B0 - 0x00B0)
 class UBioSeqAct_RemoveFromParty : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59327 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4911 );
 	};
 
 };
 
-UClass* UBioSeqAct_RemoveFromParty::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_ResurrectHenchman
 // 0x0004 (0x00B4 - 0x00B0)
 class UBioSeqAct_ResurrectHenchman : public USequenceAction
@@ -42050,23 +34229,14 @@ class UBioSeqAct_ResurrectHenchman : public USequenceAction
 public:
 	float                                              PctHealthRegained;                                		// 0x00B0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59336 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4912 );
 	};
 
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_ResurrectHenchman::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_SetActive
 // 0x0004 (0x00B4 - 0x00B0)
 class UBioSeqAct_SetActive : public USequenceAction
@@ -42074,23 +34244,14 @@ class UBioSeqAct_SetActive : public USequenceAction
 public:
 	unsigned long                                      bSetActive : 1;                                   		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59358 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4913 );
 	};
 
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_SetActive::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_SetBrowserWheelAvailable
 // 0x0004 (0x00B4 - 0x00B0)
 class UBioSeqAct_SetBrowserWheelAvailable : public USequenceAction
@@ -42098,23 +34259,14 @@ class UBioSeqAct_SetBrowserWheelAvailable : public USequenceAction
 public:
 	unsigned long                                      m_bMakeAvailable : 1;                             		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59364 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4914 );
 	};
 
 	void eventActivated ( );
 };
 
-UClass* UBioSeqAct_SetBrowserWheelAvailable::pClassPointer = NULL;
-
 // Class SFXGame.BioTimerList
 // 0x0018 (0x0054 - 0x003C)
 class UBioTimerList : public UObject
@@ -42123,16 +34275,9 @@ public:
 	TArray< struct FBioTimer >                         lstTimers;                                        		// 0x003C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	struct FScriptDelegate                             __BioTimerDelegate__Delegate;                     		// 0x0048 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59864 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4915 );
 	};
 
 	void Tick ( float fDeltaT );
@@ -42141,8 +34286,6 @@ public:
 	void BioTimerDelegate ( class UObject* Params );
 };
 
-UClass* UBioTimerList::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_SetBrowserWheelStateOverrides
 // 0x000C (0x00BC - 0x00B0)
 class UBioSeqAct_SetBrowserWheelStateOverrides : public USequenceAction
@@ -42150,45 +34293,27 @@ class UBioSeqAct_SetBrowserWheelStateOverrides : public USequenceAction
 public:
 	TArray< struct FSubPageState >                     PageStates;                                       		// 0x00B0 (0x000C) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59976 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4916 );
 	};
 
 	void eventActivated ( );
 };
 
-UClass* UBioSeqAct_SetBrowserWheelStateOverrides::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_SetEnvironmentEffectIntensity
 // 0x0000 (0x00B0 - 0x00B0)
 class UBioSeqAct_SetEnvironmentEffectIntensity : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59984 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4917 );
 	};
 
 };
 
-UClass* UBioSeqAct_SetEnvironmentEffectIntensity::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_SetExploreCameraRotation
 // 0x0008 (0x00B8 - 0x00B0)
 class UBioSeqAct_SetExploreCameraRotation : public USequenceAction
@@ -42197,40 +34322,24 @@ public:
 	class AActor*                                      oTarget;                                          		// 0x00B0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bForceInstant : 1;                                		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59986 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4918 );
 	};
 
 	void Activated ( );
 	bool eventIsCameraExploreMode ( class USFXCameraMode* pCameraMode );
 };
 
-UClass* UBioSeqAct_SetExploreCameraRotation::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_Explore
 // 0x0000 (0x00EC - 0x00EC)
 class USFXCameraMode_Explore : public USFXCameraMode
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 59990 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4919 );
 	};
 
 	void ProcessViewRotation ( float DeltaTime, struct FRotator* OutViewRotation, struct FRotator* OutDeltaRot );
@@ -42256,8 +34365,6 @@ public:
 	void eventModifyPostProcessSettings ( struct FPostProcessSettings* PPSettings );
 };
 
-UClass* USFXCameraMode_Explore::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_SetLookAtTarget
 // 0x0010 (0x00C0 - 0x00B0)
 class UBioSeqAct_SetLookAtTarget : public USequenceAction
@@ -42266,16 +34373,9 @@ public:
 	TArray< class AActor* >                            Actors;                                           		// 0x00B0 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	class AActor*                                      LookAtTarget;                                     		// 0x00BC (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 60009 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4920 );
 	};
 
 	void eventPreVersionUpdated ( int OldVersion, int NewVersion );
@@ -42283,30 +34383,19 @@ public:
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_SetLookAtTarget::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_ShouldShowSplashSequence
 // 0x0000 (0x00B0 - 0x00B0)
 class UBioSeqAct_ShouldShowSplashSequence : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 60034 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4921 );
 	};
 
 };
 
-UClass* UBioSeqAct_ShouldShowSplashSequence::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_ShowMessage
 // 0x001F (0x00E3 - 0x00C4)
 class UBioSeqAct_ShowMessage : public UBioSequenceLatentAction
@@ -42326,16 +34415,9 @@ public:
 	unsigned char                                      m_Skin;                                           		// 0x00E1 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      m_TextAlign;                                      		// 0x00E2 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 60075 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4922 );
 	};
 
 	void MessageBoxUpdate ( float fDeltaT, class UBioSFHandler_MessageBox* oMsgBox );
@@ -42344,8 +34426,6 @@ public:
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_ShowMessage::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_SwitchWeighted
 // 0x0050 (0x0100 - 0x00B0)
 class UBioSeqAct_SwitchWeighted : public USequenceAction
@@ -42363,23 +34443,14 @@ public:
 	float                                              fWeight8;                                         		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	float                                              fWeight9;                                         		// 0x00FC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 60139 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4923 );
 	};
 
 	void eventActivated ( );
 };
 
-UClass* UBioSeqAct_SwitchWeighted::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_TalkObjSelect
 // 0x003C (0x00EC - 0x00B0)
 class UBioSeqAct_TalkObjSelect : public USequenceAction
@@ -42401,24 +34472,15 @@ public:
 	int                                                nHench1;                                          		// 0x00E4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	int                                                nHench2;                                          		// 0x00E8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 60159 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4924 );
 	};
 
 	void eventActivated ( );
 	int GetHenchID ( struct FName Tag );
 };
 
-UClass* UBioSeqAct_TalkObjSelect::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqAct_ToggleSave
 // 0x0008 (0x00B8 - 0x00B0)
 class UBioSeqAct_ToggleSave : public USequenceAction
@@ -42427,39 +34489,23 @@ public:
 	void*                                              srReason;                                         		// 0x00B0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bEnable : 1;                                      		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 60194 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4925 );
 	};
 
 	void Activated ( );
 };
 
-UClass* UBioSeqAct_ToggleSave::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqCond_Deprecated
 // 0x0000 (0x0095 - 0x0095)
 class UBioSeqCond_Deprecated : public USequenceCondition
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 60201 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4926 );
 	};
 
 	void ForceActivateInput ( int InputIdx );
@@ -42494,24 +34540,15 @@ public:
 	bool HasLinkedOps ( unsigned long bConsiderInputLinks );
 };
 
-UClass* UBioSeqCond_Deprecated::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqCond_InCombat
 // 0x0000 (0x0095 - 0x0095)
 class UBioSeqCond_InCombat : public USequenceCondition
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 60205 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4927 );
 	};
 
 	void ForceActivateInput ( int InputIdx );
@@ -42546,24 +34583,15 @@ public:
 	bool HasLinkedOps ( unsigned long bConsiderInputLinks );
 };
 
-UClass* UBioSeqCond_InCombat::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqEvt_Deprecated
 // 0x0000 (0x00D2 - 0x00D2)
 class UBioSeqEvt_Deprecated : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 60220 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4928 );
 	};
 
 	void eventToggled ( );
@@ -42573,24 +34601,15 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* UBioSeqEvt_Deprecated::pClassPointer = NULL;
-
 // Class SFXGame.BioSeqEvt_LoadingScreenClosed
 // 0x0000 (0x00D2 - 0x00D2)
 class UBioSeqEvt_LoadingScreenClosed : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 60228 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4929 );
 	};
 
 	void eventToggled ( );
@@ -42600,8 +34619,6 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* UBioSeqEvt_LoadingScreenClosed::pClassPointer = NULL;
-
 // Class SFXGame.biosfhandler_achievement
 // 0x0013 (0x02A0 - 0x028D)
 class Ubiosfhandler_achievement : public USFXGUIMovieLegacyAdapter
@@ -42612,16 +34629,9 @@ public:
 	void*                                              srEmpty;                                          		// 0x0298 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	unsigned long                                      m_bFromMainMenu : 1;                              		// 0x029C (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 60315 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4930 );
 	};
 
 	bool IsAccomplishmentValid ( struct FAccomplishment* Data );
@@ -42633,24 +34643,15 @@ public:
 	void SetFromMainMenu ( );
 };
 
-UClass* Ubiosfhandler_achievement::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_SharedIGG
 // 0x0000 (0x0040 - 0x0040)
 class UBioSFHandler_SharedIGG : public USFXGUIMovieExtension
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 60754 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4932 );
 	};
 
 	void eventUpdate ( float fDeltaT );
@@ -42661,8 +34662,6 @@ public:
 	void eventOnAdded ( );
 };
 
-UClass* UBioSFHandler_SharedIGG::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_GameOver
 // 0x0013 (0x02A0 - 0x028D)
 class UBioSFHandler_GameOver : public USFXGUIMovieLegacyAdapter
@@ -42673,16 +34672,9 @@ public:
 	void*                                              AcceptBadResumeGameText;                          		// 0x0298 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	unsigned long                                      AbleToLoad : 1;                                   		// 0x029C (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 61269 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4933 );
 	};
 
 	void SetGameOverString ( void* messageId );
@@ -42702,8 +34694,6 @@ public:
 	void Callback_GotoMainMenu ( unsigned long bAPressed, int Context );
 };
 
-UClass* UBioSFHandler_GameOver::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_IntroText
 // 0x0007 (0x0294 - 0x028D)
 class UBioSFHandler_IntroText : public USFXGUIMovieLegacyAdapter
@@ -42711,39 +34701,23 @@ class UBioSFHandler_IntroText : public USFXGUIMovieLegacyAdapter
 public:
 	void*                                              srText;                                           		// 0x0290 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 61311 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4934 );
 	};
 
 	void HandleEvent ( unsigned char nCommand, TArray< struct FString >* lstArguments );
 };
 
-UClass* UBioSFHandler_IntroText::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_LoadScreen
 // 0x0000 (0x028D - 0x028D)
 class UBioSFHandler_LoadScreen : public USFXGUIMovieLegacyAdapter
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 61323 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4935 );
 	};
 
 	void QueueCommand ( struct FBioSFQueuedCommand* stQueuedCommand );
@@ -42777,24 +34751,15 @@ public:
 	void eventUpdate ( float fDeltaT );
 };
 
-UClass* UBioSFHandler_LoadScreen::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_MainMenu_Message_Text
 // 0x0000 (0x007A - 0x007A)
 class USFXGUI_MainMenu_Message_Text : public USFXGUI_MainMenu_Message
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 61376 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4937 );
 	};
 
 	void AS_SetDataLoadStatus ( int nStatus );
@@ -42808,8 +34773,6 @@ public:
 	void OnMessageDataLoaded ( class USFXGUI_MainMenu_Message* aMessageThatFinishedLoading );
 };
 
-UClass* USFXGUI_MainMenu_Message_Text::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_MainMenu_Message_Image
 // 0x0012 (0x008C - 0x007A)
 class USFXGUI_MainMenu_Message_Image : public USFXGUI_MainMenu_Message_Text
@@ -42818,16 +34781,9 @@ public:
 	struct FString                                     ImagePath;                                        		// 0x007C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	class UTexture*                                    ImageReference;                                   		// 0x0088 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 61375 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4936 );
 	};
 
 	void Cleanup ( );
@@ -42835,24 +34791,15 @@ public:
 	class USFXGUI_MainMenu_Message* CreateMessage ( int nMessageId );
 };
 
-UClass* USFXGUI_MainMenu_Message_Image::pClassPointer = NULL;
-
 // Class SFXGame.sfxgui_mainmenu_message_networkimage
 // 0x0000 (0x008C - 0x008C)
 class Usfxgui_mainmenu_message_networkimage : public USFXGUI_MainMenu_Message_Image
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 61385 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4938 );
 	};
 
 	void Cleanup ( );
@@ -42860,8 +34807,6 @@ public:
 	class USFXGUI_MainMenu_Message* CreateMessage ( int nMessageId );
 };
 
-UClass* Usfxgui_mainmenu_message_networkimage::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_MainMenu_Message_GAW
 // 0x004A (0x00C4 - 0x007A)
 class USFXGUI_MainMenu_Message_GAW : public USFXGUI_MainMenu_Message
@@ -42878,16 +34823,9 @@ public:
 	void*                                              GAWZoneStatusFormat;                              		// 0x00BC (0x0004) [0x0000000000004000]              ( CPF_Config )
 	void*                                              GAWFormattedReadinessPercent;                     		// 0x00C0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 61437 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4939 );
 	};
 
 	void AS_SetGAWSummary ( struct FString strGAWSummaryText );
@@ -42901,24 +34839,15 @@ public:
 	class USFXGUI_MainMenu_Message* CreateMessage ( int nMessageId );
 };
 
-UClass* USFXGUI_MainMenu_Message_GAW::pClassPointer = NULL;
-
 // Class SFXGame.SFXPawn_PlayerNonCombat
 // 0x0000 (0x11EB - 0x11EB)
 class ASFXPawn_PlayerNonCombat : public ASFXPawn_Player
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 61883 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4942 );
 	};
 
 	void RemoveDetachOnDestroyObject ( class USkeletalMeshComponent* MeshToRemove );
@@ -43038,24 +34967,15 @@ public:
 	void AsyncUpdating_OnCompleted ( TArray< class UObject* >* LoadedAssets );
 };
 
-UClass* ASFXPawn_PlayerNonCombat::pClassPointer = NULL;
-
 // Class SFXGame.SFXPawn_PlayerSoldierNonCombat
 // 0x0000 (0x11EB - 0x11EB)
 class ASFXPawn_PlayerSoldierNonCombat : public ASFXPawn_PlayerNonCombat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 61882 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4941 );
 	};
 
 	void RemoveDetachOnDestroyObject ( class USkeletalMeshComponent* MeshToRemove );
@@ -43175,24 +35095,15 @@ public:
 	void AsyncUpdating_OnCompleted ( TArray< class UObject* >* LoadedAssets );
 };
 
-UClass* ASFXPawn_PlayerSoldierNonCombat::pClassPointer = NULL;
-
 // Class SFXGame.sfxtelemetryhooks
 // 0x0000 (0x00B0 - 0x00B0)
 class Usfxtelemetryhooks : public USFXTelemetry
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62107 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4943 );
 	};
 
 	void SendCachedDisconnectEvent ( );
@@ -43220,24 +35131,15 @@ public:
 	class USFXTelemetryGameSession* GetInstanceGameSession ( );
 };
 
-UClass* Usfxtelemetryhooks::pClassPointer = NULL;
-
 // Class SFXGame.SFXPawn_PlayerSoldier
 // 0x0000 (0x11EB - 0x11EB)
 class ASFXPawn_PlayerSoldier : public ASFXPawn_Player
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62269 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4944 );
 	};
 
 	void RemoveDetachOnDestroyObject ( class USkeletalMeshComponent* MeshToRemove );
@@ -43357,24 +35259,15 @@ public:
 	void AsyncUpdating_OnCompleted ( TArray< class UObject* >* LoadedAssets );
 };
 
-UClass* ASFXPawn_PlayerSoldier::pClassPointer = NULL;
-
 // Class SFXGame.SFXPawn_PlayerInfiltrator
 // 0x0000 (0x11EB - 0x11EB)
 class ASFXPawn_PlayerInfiltrator : public ASFXPawn_Player
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62270 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4945 );
 	};
 
 	void RemoveDetachOnDestroyObject ( class USkeletalMeshComponent* MeshToRemove );
@@ -43494,24 +35387,15 @@ public:
 	void AsyncUpdating_OnCompleted ( TArray< class UObject* >* LoadedAssets );
 };
 
-UClass* ASFXPawn_PlayerInfiltrator::pClassPointer = NULL;
-
 // Class SFXGame.SFXPawn_PlayerSentinel
 // 0x0000 (0x11EB - 0x11EB)
 class ASFXPawn_PlayerSentinel : public ASFXPawn_Player
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62271 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4946 );
 	};
 
 	void RemoveDetachOnDestroyObject ( class USkeletalMeshComponent* MeshToRemove );
@@ -43631,24 +35515,15 @@ public:
 	void AsyncUpdating_OnCompleted ( TArray< class UObject* >* LoadedAssets );
 };
 
-UClass* ASFXPawn_PlayerSentinel::pClassPointer = NULL;
-
 // Class SFXGame.SFXPawn_PlayerAdept
 // 0x0000 (0x11EB - 0x11EB)
 class ASFXPawn_PlayerAdept : public ASFXPawn_Player
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62272 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4947 );
 	};
 
 	void RemoveDetachOnDestroyObject ( class USkeletalMeshComponent* MeshToRemove );
@@ -43768,24 +35643,15 @@ public:
 	void AsyncUpdating_OnCompleted ( TArray< class UObject* >* LoadedAssets );
 };
 
-UClass* ASFXPawn_PlayerAdept::pClassPointer = NULL;
-
 // Class SFXGame.SFXPawn_PlayerEngineer
 // 0x0000 (0x11EB - 0x11EB)
 class ASFXPawn_PlayerEngineer : public ASFXPawn_Player
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62273 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4948 );
 	};
 
 	void RemoveDetachOnDestroyObject ( class USkeletalMeshComponent* MeshToRemove );
@@ -43905,24 +35771,15 @@ public:
 	void AsyncUpdating_OnCompleted ( TArray< class UObject* >* LoadedAssets );
 };
 
-UClass* ASFXPawn_PlayerEngineer::pClassPointer = NULL;
-
 // Class SFXGame.biosfhandler_pcachievement
 // 0x0000 (0x02A0 - 0x02A0)
 class Ubiosfhandler_pcachievement : public Ubiosfhandler_achievement
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62502 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4980 );
 	};
 
 	bool IsAccomplishmentValid ( struct FAccomplishment* Data );
@@ -43934,24 +35791,15 @@ public:
 	void SetFromMainMenu ( );
 };
 
-UClass* Ubiosfhandler_pcachievement::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_PCChoiceGUI
 // 0x0000 (0x02FC - 0x02FC)
 class UBioSFHandler_PCChoiceGUI : public UBioSFHandler_ChoiceGUI
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62508 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4981 );
 	};
 
 	void CleanUpDelegateReferences ( );
@@ -43974,24 +35822,15 @@ public:
 	void InputCallback ( unsigned long bAPressed, int nContext );
 };
 
-UClass* UBioSFHandler_PCChoiceGUI::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_PCDesignerUI
 // 0x0000 (0x0328 - 0x0328)
 class UBioSFHandler_PCDesignerUI : public UBioSFHandler_DesignerUI
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62521 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4982 );
 	};
 
 	void OnPanelAdded ( );
@@ -44015,24 +35854,15 @@ public:
 	void ClearAll ( unsigned long bModal );
 };
 
-UClass* UBioSFHandler_PCDesignerUI::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_PCGameOver
 // 0x0000 (0x02A0 - 0x02A0)
 class UBioSFHandler_PCGameOver : public UBioSFHandler_GameOver
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62571 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4983 );
 	};
 
 	void SetGameOverString ( void* messageId );
@@ -44052,24 +35882,15 @@ public:
 	void Callback_GotoMainMenu ( unsigned long bAPressed, int Context );
 };
 
-UClass* UBioSFHandler_PCGameOver::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_PCPauseMenu
 // 0x0000 (0x02C0 - 0x02C0)
 class UBioSFHandler_PCPauseMenu : public UBioSFHandler_BrowserWheel
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62703 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5005 );
 	};
 
 	void AS_SetButtonAdvanceSwap ( unsigned long bMenuAdvanceSwapped );
@@ -44091,24 +35912,15 @@ public:
 	struct FName RedirectTag ( struct FName fnTag );
 };
 
-UClass* UBioSFHandler_PCPauseMenu::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_SelectCharacter
 // 0x0000 (0x028D - 0x028D)
 class UBioSFHandler_SelectCharacter : public USFXGUIMovieLegacyAdapter
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62721 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5006 );
 	};
 
 	void QueueCommand ( struct FBioSFQueuedCommand* stQueuedCommand );
@@ -44142,24 +35954,15 @@ public:
 	void eventUpdate ( float fDeltaT );
 };
 
-UClass* UBioSFHandler_SelectCharacter::pClassPointer = NULL;
-
 // Class SFXGame.BioSFHandler_SniperOverlay
 // 0x0000 (0x028D - 0x028D)
 class UBioSFHandler_SniperOverlay : public USFXGUIMovieLegacyAdapter
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62769 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5007 );
 	};
 
 	void QueueCommand ( struct FBioSFQueuedCommand* stQueuedCommand );
@@ -44193,8 +35996,6 @@ public:
 	void eventUpdate ( float fDeltaT );
 };
 
-UClass* UBioSFHandler_SniperOverlay::pClassPointer = NULL;
-
 // Class SFXGame.BioSimpleDialogContainer
 // 0x0004 (0x0040 - 0x003C)
 class UBioSimpleDialogContainer : public UObject
@@ -44202,38 +36003,22 @@ class UBioSimpleDialogContainer : public UObject
 public:
 	class UBioSimpleDialog*                            Dialog;                                           		// 0x003C (0x0004) [0x0000000004400008]              ( CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62840 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5008 );
 	};
 
 };
 
-UClass* UBioSimpleDialogContainer::pClassPointer = NULL;
-
 // Class SFXGame.BioSkillGame_Bypass_PCHandler
 // 0x0000 (0x0308 - 0x0308)
 class UBioSkillGame_Bypass_PCHandler : public UBioSkillGame_Bypass_Handler
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62905 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5009 );
 	};
 
 	void OnPanelAdded ( );
@@ -44241,24 +36026,15 @@ public:
 	bool eventHandleInputEvent ( unsigned char Event, float fValue );
 };
 
-UClass* UBioSkillGame_Bypass_PCHandler::pClassPointer = NULL;
-
 // Class SFXGame.BioSkillGame_Decryption_PCHandler
 // 0x0000 (0x02F0 - 0x02F0)
 class UBioSkillGame_Decryption_PCHandler : public UBioSkillGame_Decryption_Handler
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62933 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5010 );
 	};
 
 	void OnPanelAdded ( );
@@ -44270,8 +36046,6 @@ public:
 	void onDownPressed ( );
 };
 
-UClass* UBioSkillGame_Decryption_PCHandler::pClassPointer = NULL;
-
 // Class SFXGame.BioSkillMap
 // 0x0010 (0x004C - 0x003C)
 class UBioSkillMap : public UObject
@@ -44280,88 +36054,54 @@ public:
 	TArray< struct FName >                             SkillToStateMap;                                  		// 0x003C (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	unsigned long                                      m_bClosedIsSkillState : 1;                        		// 0x0048 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62936 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5011 );
 	};
 
 	bool IsSkillInMap ( struct FName Skill );
 	struct FName GetSkill ( int Num );
 };
 
-UClass* UBioSkillMap::pClassPointer = NULL;
-
 // Class SFXGame.BioSkillMap_Door
 // 0x0000 (0x004C - 0x004C)
 class UBioSkillMap_Door : public UBioSkillMap
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62948 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5012 );
 	};
 
 	bool IsSkillInMap ( struct FName Skill );
 	struct FName GetSkill ( int Num );
 };
 
-UClass* UBioSkillMap_Door::pClassPointer = NULL;
-
 // Class SFXGame.BioSkillMap_Test
 // 0x0000 (0x004C - 0x004C)
 class UBioSkillMap_Test : public UBioSkillMap
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62950 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5013 );
 	};
 
 	bool IsSkillInMap ( struct FName Skill );
 	struct FName GetSkill ( int Num );
 };
 
-UClass* UBioSkillMap_Test::pClassPointer = NULL;
-
 // Class SFXGame.BioSquadCombat
 // 0x0000 (0x0228 - 0x0228)
 class ABioSquadCombat : public ABioBaseSquadDesignCombat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62954 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5014 );
 	};
 
 	void NotifyCombatZoneRemoved ( );
@@ -44399,24 +36139,15 @@ public:
 	bool RemoveMember ( class APawn* pPawn );
 };
 
-UClass* ABioSquadCombat::pClassPointer = NULL;
-
 // Class SFXGame.BioStartLocation
 // 0x0000 (0x01F6 - 0x01F6)
 class ABioStartLocation : public AActor
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62994 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5015 );
 	};
 
 	struct FVector LocalToWorld ( struct FVector vLocal );
@@ -44690,24 +36421,15 @@ public:
 	void ForceUpdateComponents ( unsigned long bCollisionUpdate, unsigned long bTransformOnly );
 };
 
-UClass* ABioStartLocation::pClassPointer = NULL;
-
 // Class SFXGame.BioStartPoint
 // 0x0000 (0x02C4 - 0x02C4)
 class ABioStartPoint : public ANavigationPoint
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 62997 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5016 );
 	};
 
 	struct FString eventGetDebugAbbrev ( );
@@ -44731,24 +36453,15 @@ public:
 	void GetBoundingCylinder ( float* CollisionRadius, float* CollisionHeight );
 };
 
-UClass* ABioStartPoint::pClassPointer = NULL;
-
 // Class SFXGame.BioTempNavPoint
 // 0x0000 (0x02C4 - 0x02C4)
 class ABioTempNavPoint : public ANavigationPoint
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 63004 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5017 );
 	};
 
 	struct FString eventGetDebugAbbrev ( );
@@ -44772,8 +36485,6 @@ public:
 	void GetBoundingCylinder ( float* CollisionRadius, float* CollisionHeight );
 };
 
-UClass* ABioTempNavPoint::pClassPointer = NULL;
-
 // Class SFXGame.BioTrigger
 // 0x0004 (0x0208 - 0x0204)
 class ABioTrigger : public ATrigger
@@ -44783,47 +36494,29 @@ public:
 	unsigned long                                      OneShot : 1;                                      		// 0x0204 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned long                                      Touched : 1;                                      		// 0x0204 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 63089 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5018 );
 	};
 
 	void eventUnTouch ( class AActor* Other );
 	void eventTouch ( class AActor* Other, class UPrimitiveComponent* OtherComp, struct FVector HitLocation, struct FVector HitNormal );
 };
 
-UClass* ABioTrigger::pClassPointer = NULL;
-
 // Class SFXGame.BioTriggerActorFactory
 // 0x0000 (0x005C - 0x005C)
 class UBioTriggerActorFactory : public UActorFactory
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 63103 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5019 );
 	};
 
 	void eventPostCreateActor ( class AActor* NewActor );
 };
 
-UClass* UBioTriggerActorFactory::pClassPointer = NULL;
-
 // Class SFXGame.BioTriggerVolume
 // 0x0004 (0x0230 - 0x022C)
 class ABioTriggerVolume : public ATriggerVolume
@@ -44833,195 +36526,116 @@ public:
 	unsigned long                                      OneShot : 1;                                      		// 0x022C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned long                                      Touched : 1;                                      		// 0x022C (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 63145 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5020 );
 	};
 
 	void eventUnTouch ( class AActor* Other );
 	void eventTouch ( class AActor* Other, class UPrimitiveComponent* OtherComp, struct FVector HitLocation, struct FVector HitNormal );
 };
 
-UClass* ABioTriggerVolume::pClassPointer = NULL;
-
 // Class SFXGame.BioVectorParameterInstTrack
 // 0x0000 (0x003C - 0x003C)
 class UBioVectorParameterInstTrack : public UInterpTrackInst
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 63158 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5021 );
 	};
 
 };
 
-UClass* UBioVectorParameterInstTrack::pClassPointer = NULL;
-
 // Class SFXGame.BioVectorParameterTrack
 // 0x0000 (0x0070 - 0x0070)
 class UBioVectorParameterTrack : public UInterpTrackVectorBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 63160 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5022 );
 	};
 
 };
 
-UClass* UBioVectorParameterTrack::pClassPointer = NULL;
-
 // Class SFXGame.BioVFXTemplate
 // 0x0000 (0x003C - 0x003C)
 class UBioVFXTemplate : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 63162 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5023 );
 	};
 
 };
 
-UClass* UBioVFXTemplate::pClassPointer = NULL;
-
 // Class SFXGame.BioVisualEffectPool
 // 0x0000 (0x003C - 0x003C)
 class UBioVisualEffectPool : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 63164 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5024 );
 	};
 
 };
 
-UClass* UBioVisualEffectPool::pClassPointer = NULL;
-
 // Class SFXGame.BioVisualEffectTrack
 // 0x0000 (0x005C - 0x005C)
 class UBioVisualEffectTrack : public UInterpTrack
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 63166 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5025 );
 	};
 
 };
 
-UClass* UBioVisualEffectTrack::pClassPointer = NULL;
-
 // Class SFXGame.BioVisualEffectTrackInst
 // 0x0000 (0x003C - 0x003C)
 class UBioVisualEffectTrackInst : public UInterpTrackInst
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 63168 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5026 );
 	};
 
 };
 
-UClass* UBioVisualEffectTrackInst::pClassPointer = NULL;
-
 // Class SFXGame.BioWaypointSetFactory
 // 0x0000 (0x005C - 0x005C)
 class UBioWaypointSetFactory : public UActorFactory
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 63181 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5027 );
 	};
 
 	void eventPostCreateActor ( class AActor* NewActor );
 };
 
-UClass* UBioWaypointSetFactory::pClassPointer = NULL;
-
 // Class SFXGame.BioWorldInfoTick
 // 0x0000 (0x01F6 - 0x01F6)
 class ABioWorldInfoTick : public AActor
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 63183 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5028 );
 	};
 
 	struct FVector LocalToWorld ( struct FVector vLocal );
@@ -45295,54 +36909,34 @@ public:
 	void ForceUpdateComponents ( unsigned long bCollisionUpdate, unsigned long bTransformOnly );
 };
 
-UClass* ABioWorldInfoTick::pClassPointer = NULL;
-
 // Class SFXGame.BioWp_Kismet
 // 0x0000 (0x02C8 - 0x02C8)
 class ABioWp_Kismet : public ABioPathPoint
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 63185 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5029 );
 	};
 
 	bool OnCreatureReachedWayPoint ( class APawn* PathFindingCreature );
 };
 
-UClass* ABioWp_Kismet::pClassPointer = NULL;
-
 // Class SFXGame.DynamicCylindricalForceActor
 // 0x0000 (0x0228 - 0x0228)
 class ADynamicCylindricalForceActor : public ARB_CylindricalForceActor
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 63196 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5030 );
 	};
 
 	void OnToggle ( class USeqAct_Toggle* inAction );
 };
 
-UClass* ADynamicCylindricalForceActor::pClassPointer = NULL;
-
 // Class SFXGame.SFXMatchResultsData
 // 0x005C (0x0098 - 0x003C)
 class USFXMatchResultsData : public UObject
@@ -45357,16 +36951,9 @@ public:
 	int                                                TotalSquadXP;                                     		// 0x0090 (0x0004) [0x0000000000000000]              
 	int                                                BonusSquadXP;                                     		// 0x0094 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 63931 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5032 );
 	};
 
 	void ResetData ( );
@@ -45390,31 +36977,20 @@ public:
 	void UpdatePlayerScoreData ( int PlayerID, struct FString PlayerName, float fScore );
 };
 
-UClass* USFXMatchResultsData::pClassPointer = NULL;
-
 // Class SFXGame.SFXActorFactoryEnemySpawnPoint
 // 0x0000 (0x005C - 0x005C)
 class USFXActorFactoryEnemySpawnPoint : public UActorFactory
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64135 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5033 );
 	};
 
 	void eventPostCreateActor ( class AActor* NewActor );
 };
 
-UClass* USFXActorFactoryEnemySpawnPoint::pClassPointer = NULL;
-
 // Class SFXGame.SFXEnemySpawnPoint
 // 0x001C (0x02E0 - 0x02C4)
 class ASFXEnemySpawnPoint : public ANavigationPoint
@@ -45424,66 +37000,39 @@ public:
 	TArray< class UClass* >                            SupportedReachSpecs;                              		// 0x02D0 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	float                                              Weight;                                           		// 0x02DC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64137 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5034 );
 	};
 
 };
 
-UClass* ASFXEnemySpawnPoint::pClassPointer = NULL;
-
 // Class SFXGame.SFXActorFactoryPhysicsAsset
 // 0x0000 (0x0080 - 0x0080)
 class USFXActorFactoryPhysicsAsset : public UActorFactoryPhysicsAsset
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64138 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5035 );
 	};
 
 };
 
-UClass* USFXActorFactoryPhysicsAsset::pClassPointer = NULL;
-
 // Class SFXGame.SFXKAssetSpawnable
 // 0x0000 (0x0210 - 0x0210)
 class ASFXKAssetSpawnable : public ASFXKAsset
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64140 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5036 );
 	};
 
 };
 
-UClass* ASFXKAssetSpawnable::pClassPointer = NULL;
-
 // Class SFXGame.SFXAI_Critter
 // 0x0020 (0x06B0 - 0x0690)
 class ASFXAI_Critter : public Asfxai_core
@@ -45494,16 +37043,9 @@ public:
 	struct FVector                                     m_vCurrentSteeringDirection;                      		// 0x06A0 (0x000C) [0x0000000000000000]              
 	unsigned long                                      m_bUnderAttack : 1;                               		// 0x06AC (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64141 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5037 );
 	};
 
 	bool ShouldCancelMove ( int nReason );
@@ -45512,24 +37054,15 @@ public:
 	void Initialize ( );
 };
 
-UClass* ASFXAI_Critter::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_Critter
 // 0x0000 (0x0084 - 0x0084)
 class USFXAICmd_Critter : public USFXAICommand
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64160 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5038 );
 	};
 
 	void NotifyFriendDied ( class ABioPawn* FriendPawn );
@@ -45561,24 +37094,15 @@ public:
 	void Paused ( class UGameAICommand* NewCommand );
 };
 
-UClass* USFXAICmd_Critter::pClassPointer = NULL;
-
 // Class SFXGame.SFXAI_None
 // 0x0000 (0x0690 - 0x0690)
 class ASFXAI_None : public Asfxai_core
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64161 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5039 );
 	};
 
 	void CheckDownedPlayers ( );
@@ -45723,24 +37247,15 @@ public:
 	void UsePowerDelegate ( int nReason );
 };
 
-UClass* ASFXAI_None::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_None
 // 0x0000 (0x0098 - 0x0098)
 class USFXAICmd_None : public USFXAICommand_Base_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64164 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5040 );
 	};
 
 	void StopSustainedFire ( );
@@ -45751,24 +37266,15 @@ public:
 	void Pushed ( );
 };
 
-UClass* USFXAICmd_None::pClassPointer = NULL;
-
 // Class SFXGame.SFXAI_TechDrone
 // 0x0000 (0x0690 - 0x0690)
 class ASFXAI_TechDrone : public Asfxai_core
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64165 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5041 );
 	};
 
 	void CheckDownedPlayers ( );
@@ -45913,24 +37419,15 @@ public:
 	void UsePowerDelegate ( int nReason );
 };
 
-UClass* ASFXAI_TechDrone::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_Combat_TechDrone
 // 0x0000 (0x0098 - 0x0098)
 class USFXAICmd_Combat_TechDrone : public USFXAICommand_Base_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64175 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5042 );
 	};
 
 	void StopSustainedFire ( );
@@ -45941,8 +37438,6 @@ public:
 	void Pushed ( );
 };
 
-UClass* USFXAICmd_Combat_TechDrone::pClassPointer = NULL;
-
 // Class SFXGame.SFXAI_TechDrone_NPC
 // 0x0004 (0x0694 - 0x0690)
 class ASFXAI_TechDrone_NPC : public Asfxai_core
@@ -45953,40 +37448,24 @@ public:
 	unsigned long                                      bHasTaunted : 1;                                  		// 0x0690 (0x0004) [0x0000000000000000] [0x00000004] 
 	unsigned long                                      bHasWarned : 1;                                   		// 0x0690 (0x0004) [0x0000000000000000] [0x00000008] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64176 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5043 );
 	};
 
 	void PeriodicMoveCheck ( );
 	void SetMovementSpeed ( );
 };
 
-UClass* ASFXAI_TechDrone_NPC::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_Combat_TechDroneNPC
 // 0x0000 (0x0098 - 0x0098)
 class USFXAICmd_Combat_TechDroneNPC : public USFXAICommand_Base_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64190 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5044 );
 	};
 
 	void StopSustainedFire ( );
@@ -45997,8 +37476,6 @@ public:
 	void Pushed ( );
 };
 
-UClass* USFXAICmd_Combat_TechDroneNPC::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_Base_HordeApproach
 // 0x0004 (0x009C - 0x0098)
 class USFXAICmd_Base_HordeApproach : public USFXAICommand_Base_Combat
@@ -46006,16 +37483,9 @@ class USFXAICmd_Base_HordeApproach : public USFXAICommand_Base_Combat
 public:
 	unsigned long                                      bCombatStarted : 1;                               		// 0x0098 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64306 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5045 );
 	};
 
 	void NotifyEnemyVisible ( int EnemyIdx, float TimeSinceSeen );
@@ -46025,24 +37495,15 @@ public:
 	void Pushed ( );
 };
 
-UClass* USFXAICmd_Base_HordeApproach::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_Base_MountedGunner
 // 0x0000 (0x0098 - 0x0098)
 class USFXAICmd_Base_MountedGunner : public USFXAICommand_Base_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64338 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5046 );
 	};
 
 	void StopSustainedFire ( );
@@ -46053,24 +37514,15 @@ public:
 	void Pushed ( );
 };
 
-UClass* USFXAICmd_Base_MountedGunner::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_CA_DamageReaction
 // 0x0000 (0x0088 - 0x0088)
 class USFXAICmd_CA_DamageReaction : public USFXAICmd_CustomAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64399 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5047 );
 	};
 
 	bool IsCustomActionComplete ( );
@@ -46086,8 +37538,6 @@ public:
 	bool StartCustomAction ( class Asfxai_core* AI, class UClass* AICommandClass );
 };
 
-UClass* USFXAICmd_CA_DamageReaction::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_MoveAway
 // 0x0004 (0x0090 - 0x008C)
 class USFXAICmd_MoveAway : public USFXAICmd_MoveToGoal
@@ -46095,16 +37545,9 @@ class USFXAICmd_MoveAway : public USFXAICmd_MoveToGoal
 public:
 	float                                              MaxBackAwayDistance;                              		// 0x008C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64455 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5048 );
 	};
 
 	bool GetFirstMoveTarget ( );
@@ -46113,24 +37556,15 @@ public:
 	bool MoveAway ( class Asfxai_core* AI, class AActor* AvoidTarget, float NewMoveOffset, float fMaxBackAwayDistance, unsigned long bInAllowedToFire, unsigned long bInAllowPartialPath );
 };
 
-UClass* USFXAICmd_MoveAway::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_Combat_Turret
 // 0x0000 (0x0098 - 0x0098)
 class USFXAICmd_Combat_Turret : public USFXAICommand_Base_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64465 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5049 );
 	};
 
 	void StopSustainedFire ( );
@@ -46141,8 +37575,6 @@ public:
 	void Pushed ( );
 };
 
-UClass* USFXAICmd_Combat_Turret::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_HenchmanInteraction
 // 0x0011 (0x0095 - 0x0084)
 class USFXAICmd_HenchmanInteraction : public USFXAICommand
@@ -46159,16 +37591,9 @@ public:
 	unsigned long                                      bTriedDirectTeleport : 1;                         		// 0x0090 (0x0004) [0x0000000000002000] [0x00000020] ( CPF_Transient )
 	unsigned char                                      CurrentFallback;                                  		// 0x0094 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64528 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5050 );
 	};
 
 	bool FindClosestCover ( struct FCoverInfo* NearbyCover );
@@ -46182,126 +37607,15 @@ public:
 	bool StartWorldInteraction ( class Asfxai_core* AI, class AActor* oInteractionPoint, float fFidelityTimeout );
 };
 
-UClass* USFXAICmd_HenchmanInteraction::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_EnterCover
 // 0x0000 (0x0084 - 0x0084)
 class USFXAICmd_EnterCover : public USFXAICommand
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
-	static UClass* StaticClass()
-	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64533 ];
-
-		return pClassPointer;
-	};
-
-	void NotifyFriendDied ( class ABioPawn* FriendPawn );
-	void OnEnteredPlaypen ( );
-	bool StartFollowingActor ( class AActor* ActorToFollow );
-	bool MoveToGoalExternal ( class AActor* NewMoveGoal, float NewMoveOffset, unsigned long bForceWalk, struct FScriptDelegate MoveDelegate );
-	bool FireWeaponAtTarget ( class AActor* oTarget, unsigned long bCheckLOS, unsigned long bForceShoot, float fAttackDuration, struct FScriptDelegate FireDelegate );
-	bool UsePowerOnTarget ( struct FName nmPowerToUse, class AActor* oTarget, struct FScriptDelegate PowerDelegate, unsigned long bIgnoreSuppression );
-	void MoveToDelegate ( int nReason );
-	void FireWeaponDelegate ( int nReason );
-	void UsePowerDelegate ( int nReason );
-	bool NotifyHitWall ( struct FVector HitNormal, class AActor* Wall );
-	bool NotifyBump ( class AActor* Other, struct FVector HitNormal );
-	bool ShouldRun ( );
-	bool CancelCommand ( int nReason );
-	void NotifyEnemyVisible ( int EnemyIdx, float TimeSinceSeen );
-	bool NotifyMoodChange ( );
-	void NotifyPendingPowerImpact ( struct FName Label, float TimeBeforeImpact, class Usfxpowercustomaction* Power, class ASFXProjectile_PowerCustomAction* Projectile );
-	void NotifyNearMiss ( struct FVector HitLocation );
-	void NotifyTakeHit ( class AController* instigatedBy, struct FVector HitLocation, int Damage, class UClass* DamageType, struct FVector Momentum );
-	void NotifyArmourDestroyed ( struct FName ArmourPiece, class AController* instigatedBy );
-	void NotifyArmourHit ( float Damage, struct FName ArmourPiece, class AController* instigatedBy, struct FVector HitLocation, struct FVector Momentum, class UClass* DamageType, class AActor* DamageCauser );
-	void NotifyWeaponFinishedFiring ( class AWeapon* W, unsigned char FireMode );
-	void NotifyNewEnemy ( class APawn* NewEnemy );
-	void PeriodicMoveCheck ( );
-	void UpdateMovementActions ( );
-	bool CanInterruptCurrentCommand ( );
-	void Resumed ( struct FName OldCommandName );
-	void Paused ( class UGameAICommand* NewCommand );
-};
-
-UClass* USFXAICmd_EnterCover::pClassPointer = NULL;
-
-// Class SFXGame.SFXAICmd_EnterMountedGun
-// 0x0004 (0x009C - 0x0098)
-class USFXAICmd_EnterMountedGun : public USFXAICommand_Base_Combat
-{
-public:
-	unsigned long                                      bEnteredMountedGun : 1;                           		// 0x0098 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
-
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64549 ];
-
-		return pClassPointer;
-	};
-
-	void UnclaimTurret ( );
-	void Popped ( );
-};
-
-UClass* USFXAICmd_EnterMountedGun::pClassPointer = NULL;
-
-// Class SFXGame.SFXAICmd_SwitchWeapon
-// 0x0004 (0x0088 - 0x0084)
-class USFXAICmd_SwitchWeapon : public USFXAICommand
-{
-public:
-	class ASFXWeapon*                                  NextWeapon;                                       		// 0x0084 (0x0004) [0x0000000000002000]              ( CPF_Transient )
-
-private:
-	static UClass* pClassPointer;
-
-public:
-	static UClass* StaticClass()
-	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64566 ];
-
-		return pClassPointer;
-	};
-
-	bool IsWeaponSwitching ( );
-	void ChangeWeapons ( );
-	void Popped ( );
-	void Pushed ( );
-	bool SwitchWeapon ( class Asfxai_core* AI, class ASFXWeapon* oWeapon );
-};
-
-UClass* USFXAICmd_SwitchWeapon::pClassPointer = NULL;
-
-// Class SFXGame.SFXAICmd_WaitForAnimatedTransition
-// 0x0000 (0x0084 - 0x0084)
-class USFXAICmd_WaitForAnimatedTransition : public USFXAICommand
-{
-public:
-
-private:
-	static UClass* pClassPointer;
-
-public:
-	static UClass* StaticClass()
-	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64619 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5051 );
 	};
 
 	void NotifyFriendDied ( class ABioPawn* FriendPawn );
@@ -46333,7 +37647,80 @@ public:
 	void Paused ( class UGameAICommand* NewCommand );
 };
 
-UClass* USFXAICmd_WaitForAnimatedTransition::pClassPointer = NULL;
+// Class SFXGame.SFXAICmd_EnterMountedGun
+// 0x0004 (0x009C - 0x0098)
+class USFXAICmd_EnterMountedGun : public USFXAICommand_Base_Combat
+{
+public:
+	unsigned long                                      bEnteredMountedGun : 1;                           		// 0x0098 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
+
+	static UClass* StaticClass()
+	{
+		return (UClass*) SdkBindings::Get ( 5052 );
+	};
+
+	void UnclaimTurret ( );
+	void Popped ( );
+};
+
+// Class SFXGame.SFXAICmd_SwitchWeapon
+// 0x0004 (0x0088 - 0x0084)
+class USFXAICmd_SwitchWeapon : public USFXAICommand
+{
+public:
+	class ASFXWeapon*                                  NextWeapon;                                       		// 0x0084 (0x0004) [0x0000000000002000]              ( CPF_Transient )
+
+	static UClass* StaticClass()
+	{
+		return (UClass*) SdkBindings::Get ( 5053 );
+	};
+
+	bool IsWeaponSwitching ( );
+	void ChangeWeapons ( );
+	void Popped ( );
+	void Pushed ( );
+	bool SwitchWeapon ( class Asfxai_core* AI, class ASFXWeapon* oWeapon );
+};
+
+// Class SFXGame.SFXAICmd_WaitForAnimatedTransition
+// 0x0000 (0x0084 - 0x0084)
+class USFXAICmd_WaitForAnimatedTransition : public USFXAICommand
+{
+public:
+
+	static UClass* StaticClass()
+	{
+		return (UClass*) SdkBindings::Get ( 5054 );
+	};
+
+	void NotifyFriendDied ( class ABioPawn* FriendPawn );
+	void OnEnteredPlaypen ( );
+	bool StartFollowingActor ( class AActor* ActorToFollow );
+	bool MoveToGoalExternal ( class AActor* NewMoveGoal, float NewMoveOffset, unsigned long bForceWalk, struct FScriptDelegate MoveDelegate );
+	bool FireWeaponAtTarget ( class AActor* oTarget, unsigned long bCheckLOS, unsigned long bForceShoot, float fAttackDuration, struct FScriptDelegate FireDelegate );
+	bool UsePowerOnTarget ( struct FName nmPowerToUse, class AActor* oTarget, struct FScriptDelegate PowerDelegate, unsigned long bIgnoreSuppression );
+	void MoveToDelegate ( int nReason );
+	void FireWeaponDelegate ( int nReason );
+	void UsePowerDelegate ( int nReason );
+	bool NotifyHitWall ( struct FVector HitNormal, class AActor* Wall );
+	bool NotifyBump ( class AActor* Other, struct FVector HitNormal );
+	bool ShouldRun ( );
+	bool CancelCommand ( int nReason );
+	void NotifyEnemyVisible ( int EnemyIdx, float TimeSinceSeen );
+	bool NotifyMoodChange ( );
+	void NotifyPendingPowerImpact ( struct FName Label, float TimeBeforeImpact, class Usfxpowercustomaction* Power, class ASFXProjectile_PowerCustomAction* Projectile );
+	void NotifyNearMiss ( struct FVector HitLocation );
+	void NotifyTakeHit ( class AController* instigatedBy, struct FVector HitLocation, int Damage, class UClass* DamageType, struct FVector Momentum );
+	void NotifyArmourDestroyed ( struct FName ArmourPiece, class AController* instigatedBy );
+	void NotifyArmourHit ( float Damage, struct FName ArmourPiece, class AController* instigatedBy, struct FVector HitLocation, struct FVector Momentum, class UClass* DamageType, class AActor* DamageCauser );
+	void NotifyWeaponFinishedFiring ( class AWeapon* W, unsigned char FireMode );
+	void NotifyNewEnemy ( class APawn* NewEnemy );
+	void PeriodicMoveCheck ( );
+	void UpdateMovementActions ( );
+	bool CanInterruptCurrentCommand ( );
+	void Resumed ( struct FName OldCommandName );
+	void Paused ( class UGameAICommand* NewCommand );
+};
 
 // Class SFXGame.SFXCustomAction_InteractionPointAnim
 // 0x0017 (0x00D8 - 0x00C1)
@@ -46346,16 +37733,9 @@ public:
 	float                                              UnawareAlertness;                                 		// 0x00D0 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bUnawareAI : 1;                                   		// 0x00D4 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64709 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5055 );
 	};
 
 	bool CanOverrideMoveWith ( int OldCustomAction, int NewCustomAction );
@@ -46367,54 +37747,34 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_InteractionPointAnim::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_InteractionHenchManual
 // 0x0000 (0x02D4 - 0x02D4)
 class ASFXNav_InteractionHenchManual : public ASFXNav_InteractionPoint
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64713 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5056 );
 	};
 
 	bool StartInteraction ( class ABioPawn* oPawn );
 };
 
-UClass* ASFXNav_InteractionHenchManual::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_InteractionHenchCover
 // 0x0000 (0x02D4 - 0x02D4)
 class ASFXNav_InteractionHenchCover : public ASFXNav_InteractionPoint
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64716 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5057 );
 	};
 
 	bool StartInteraction ( class ABioPawn* oPawn );
 };
 
-UClass* ASFXNav_InteractionHenchCover::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_InteractionAnim
 // 0x0004 (0x008C - 0x0088)
 class USFXAICmd_InteractionAnim : public USFXAICmd_CustomAction
@@ -46422,16 +37782,9 @@ class USFXAICmd_InteractionAnim : public USFXAICmd_CustomAction
 public:
 	class USFXCustomAction_InteractionPointAnim*       InteractionCustomAction;                          		// 0x0088 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64718 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5058 );
 	};
 
 	void NotifyNewEnemy ( class APawn* NewEnemy );
@@ -46439,8 +37792,6 @@ public:
 	bool NotifyMoodChange ( );
 };
 
-UClass* USFXAICmd_InteractionAnim::pClassPointer = NULL;
-
 // Class SFXGame.SFXAICmd_MoveToMeleeRange
 // 0x0018 (0x009C - 0x0084)
 class USFXAICmd_MoveToMeleeRange : public USFXAICommand
@@ -46454,16 +37805,9 @@ public:
 	unsigned long                                      m_bShooting : 1;                                  		// 0x0098 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 	unsigned long                                      m_bUsePartialPaths : 1;                           		// 0x0098 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 64916 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5059 );
 	};
 
 	void ApproachTarget ( );
@@ -46472,8 +37816,6 @@ public:
 	bool MoveToMeleeRange ( class Asfxai_core* AI, class AActor* Target, float NewMoveOffset, unsigned long bInAllowedToFire, unsigned long bInAllowPartialPath );
 };
 
-UClass* USFXAICmd_MoveToMeleeRange::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_AreaMap
 // 0x00E3 (0x0370 - 0x028D)
 class USFXSFHandler_AreaMap : public USFXGUIMovieLegacyAdapter
@@ -46483,16 +37825,9 @@ public:
 	TArray< struct FString >                           LocationIcons;                                    		// 0x0360 (0x000C) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 	unsigned long                                      m_bFromBrowserWheel : 1;                          		// 0x036C (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65139 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5060 );
 	};
 
 	void ASSetTriggerDisplay ( unsigned long bShowingBumpers );
@@ -46520,8 +37855,6 @@ public:
 	void OnPanelAdded ( );
 };
 
-UClass* USFXSFHandler_AreaMap::pClassPointer = NULL;
-
 // Class SFXGame.SFXAreaMapData
 // 0x0075 (0x00B1 - 0x003C)
 class USFXAreaMapData : public UObject
@@ -46540,16 +37873,9 @@ public:
 	float                                              PxPerUU;                                          		// 0x00AC (0x0004) [0x0000000000000000]              
 	unsigned char                                      Floor;                                            		// 0x00B0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65163 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5061 );
 	};
 
 	TArray< struct FSFXCharacterMapData > GetCharacterData ( unsigned char TargetFloor );
@@ -46562,8 +37888,6 @@ public:
 	float GetPxPerUU ( );
 };
 
-UClass* USFXAreaMapData::pClassPointer = NULL;
-
 // Class SFXGame.SFXArmorUseModule
 // 0x000D (0x00BD - 0x00B0)
 class USFXArmorUseModule : public USFXModule_SavedUse
@@ -46574,16 +37898,9 @@ public:
 	unsigned long                                      bStopCustomTicking : 1;                           		// 0x00B8 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned char                                      ArmorPiece;                                       		// 0x00BC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65316 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5062 );
 	};
 
 	void DisableArmorUseModule ( );
@@ -46593,8 +37910,6 @@ public:
 	void eventHandlePostBeginPlay ( );
 };
 
-UClass* USFXArmorUseModule::pClassPointer = NULL;
-
 // Class SFXGame.SFXArmorNode
 // 0x000A (0x0200 - 0x01F6)
 class ASFXArmorNode : public ASFXPointOfInterest
@@ -46603,46 +37918,28 @@ public:
 	class UStaticMeshComponent*                        SMC;                                              		// 0x01F8 (0x0004) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 	class ULightEnvironmentComponent*                  LightEnvironment;                                 		// 0x01FC (0x0004) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65343 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5063 );
 	};
 
 	void DisableArmorNode ( );
 };
 
-UClass* ASFXArmorNode::pClassPointer = NULL;
-
 // Class SFXGame.SFXBlockingVolume_Ledge
 // 0x0000 (0x023C - 0x023C)
 class ASFXBlockingVolume_Ledge : public ABlockingVolume
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65426 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5064 );
 	};
 
 	void OnToggle ( class USeqAct_Toggle* Action );
 };
 
-UClass* ASFXBlockingVolume_Ledge::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraAction_FollowTarget
 // 0x0014 (0x0100 - 0x00EC)
 class USFXCameraAction_FollowTarget : public USFXCameraMode
@@ -46652,16 +37949,9 @@ public:
 	class USFXCameraMode*                              UnderneathMode;                                   		// 0x00F8 (0x0004) [0x0000000000000000]              
 	unsigned long                                      ReenableMovement : 1;                             		// 0x00FC (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65429 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5065 );
 	};
 
 	void Tick ( float TimeDelta );
@@ -46671,8 +37961,6 @@ public:
 	struct FVector GetCameraLocation ( );
 };
 
-UClass* USFXCameraAction_FollowTarget::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraAction_QuickTurn
 // 0x0007 (0x0148 - 0x0141)
 class USFXCameraAction_QuickTurn : public USFXCameraMode_Interpolate
@@ -46680,24 +37968,15 @@ class USFXCameraAction_QuickTurn : public USFXCameraMode_Interpolate
 public:
 	int                                                CurrentOffsetApplied;                             		// 0x0144 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65510 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5066 );
 	};
 
 	void Tick ( float TimeDelta );
 	void InitializeTransition ( class USFXCameraMode* FromMode, class USFXCameraMode* ToMode, float Time, unsigned long PreserveTarget );
 };
 
-UClass* USFXCameraAction_QuickTurn::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_Combat
 // 0x0004 (0x00F0 - 0x00EC)
 class USFXCameraMode_Combat : public USFXCameraMode
@@ -46705,48 +37984,30 @@ class USFXCameraMode_Combat : public USFXCameraMode
 public:
 	class UMotionBlurEffect*                           Blur;                                             		// 0x00EC (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65522 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5067 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_Combat::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_AdeptPunch
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_AdeptPunch : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65531 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5070 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_AdeptPunch::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_AIDebug
 // 0x001C (0x0108 - 0x00EC)
 class USFXCameraMode_AIDebug : public USFXCameraMode
@@ -46758,16 +38019,9 @@ public:
 	float                                              BlendTimeRemaining;                               		// 0x0100 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	float                                              TotalBlendTime;                                   		// 0x0104 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65535 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5071 );
 	};
 
 	void ChangeOffset ( int idx );
@@ -46776,32 +38030,21 @@ public:
 	void Tick ( float TimeSeconds );
 };
 
-UClass* USFXCameraMode_AIDebug::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_Atlas
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_Atlas : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65553 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5072 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_Atlas::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_CombatStorm
 // 0x0008 (0x00F8 - 0x00F0)
 class USFXCameraMode_CombatStorm : public USFXCameraMode_Combat
@@ -46810,16 +38053,9 @@ public:
 	float                                              StickFactor;                                      		// 0x00F0 (0x0004) [0x0000000000000000]              
 	float                                              FullTurnRecenter;                                 		// 0x00F4 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65557 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5073 );
 	};
 
 	void ProcessViewRotation ( float DeltaTime, struct FRotator* OutViewRotation, struct FRotator* OutDeltaRot );
@@ -46828,272 +38064,171 @@ public:
 	void Initialize ( );
 };
 
-UClass* USFXCameraMode_CombatStorm::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_Cover
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_Cover : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65576 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5074 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_Cover::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_CoverMeleeLeft
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_CoverMeleeLeft : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65582 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5075 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_CoverMeleeLeft::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_CoverMeleeRight
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_CoverMeleeRight : public USFXCameraMode_CoverMeleeLeft
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65588 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5076 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_CoverMeleeRight::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_CoverStorm
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_CoverStorm : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65592 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5077 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_CoverStorm::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_CoverStormHigh
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_CoverStormHigh : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65598 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5078 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_CoverStormHigh::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_CoverSwatTurnHigh
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_CoverSwatTurnHigh : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65604 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5079 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_CoverSwatTurnHigh::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_CoverSwatTurnLow
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_CoverSwatTurnLow : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65610 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5080 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_CoverSwatTurnLow::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_CoverSyncMelee
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_CoverSyncMelee : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65616 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5081 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_CoverSyncMelee::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_CoverSyncMeleeLeft
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_CoverSyncMeleeLeft : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65620 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5082 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_CoverSyncMeleeLeft::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_CustomAction
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_CustomAction : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65624 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5083 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_CustomAction::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_EnterCover
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_EnterCover : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65628 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5084 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_EnterCover::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_ExploreStorm
 // 0x0008 (0x00F4 - 0x00EC)
 class USFXCameraMode_ExploreStorm : public USFXCameraMode_Explore
@@ -47102,16 +38237,9 @@ public:
 	float                                              StickFactor;                                      		// 0x00EC (0x0004) [0x0000000000000000]              
 	float                                              FullTurnRecenter;                                 		// 0x00F0 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65636 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5085 );
 	};
 
 	void ProcessViewRotation ( float DeltaTime, struct FRotator* OutViewRotation, struct FRotator* OutDeltaRot );
@@ -47120,80 +38248,51 @@ public:
 	void Initialize ( );
 };
 
-UClass* USFXCameraMode_ExploreStorm::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_ForwardRoll
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_ForwardRoll : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65654 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5086 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_ForwardRoll::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_HipAimCover
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_HipAimCover : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65658 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5087 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_HipAimCover::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_HitReaction
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_HitReaction : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65662 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5088 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_HitReaction::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_IllusiveManConflict
 // 0x00A4 (0x0190 - 0x00EC)
 class USFXCameraMode_IllusiveManConflict : public USFXCameraMode
@@ -47212,16 +38311,9 @@ public:
 	float                                              SmoothedSpeed;                                    		// 0x0188 (0x0004) [0x0000000000000000]              
 	float                                              Smoothing;                                        		// 0x018C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65666 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5089 );
 	};
 
 	void Tick ( float DeltaTime );
@@ -47231,8 +38323,6 @@ public:
 	void InitializeFromGameMode ( );
 };
 
-UClass* USFXCameraMode_IllusiveManConflict::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_BeginIllusiveManConflict
 // 0x00E0 (0x01A0 - 0x00C0)
 class USFXSeqAct_BeginIllusiveManConflict : public USeqAct_Latent
@@ -47259,16 +38349,9 @@ public:
 	unsigned long                                      bLastSideWasAnderson : 1;                         		// 0x019C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bRunning : 1;                                     		// 0x019C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65697 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5090 );
 	};
 
 	bool eventUpdate ( float DeltaTime );
@@ -47276,152 +38359,96 @@ public:
 	struct FVector AndersonTargetLocation ( );
 };
 
-UClass* USFXSeqAct_BeginIllusiveManConflict::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_JumpStart
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_JumpStart : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65737 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5091 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_JumpStart::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_KroganMelee
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_KroganMelee : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65741 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5092 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_KroganMelee::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_LadderDown
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_LadderDown : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65745 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5093 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_LadderDown::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_LadderUp
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_LadderUp : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65765 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5094 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_LadderUp::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_LockOnPawn
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_LockOnPawn : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65769 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5095 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_LockOnPawn::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_Melee
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_Melee : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65786 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5096 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_Melee::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_ProceduralSync
 // 0x001A (0x0108 - 0x00EE)
 class USFXCustomAction_ProceduralSync : public USFXCustomAction_SingleAnim
@@ -47437,16 +38464,9 @@ public:
 	unsigned long                                      bAffectsFriendlies : 1;                           		// 0x0104 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 	unsigned long                                      bTryForceLocalSimulation : 1;                     		// 0x0104 (0x0004) [0x0000000000000002] [0x00000008] ( CPF_Const )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65790 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5097 );
 	};
 
 	void DebugSocketRelativeLocation ( struct FName InSocketName );
@@ -47465,8 +38485,6 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_ProceduralSync::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_TightAim
 // 0x0004 (0x00F4 - 0x00F0)
 class USFXCameraMode_TightAim : public USFXCameraMode_Combat
@@ -47474,88 +38492,54 @@ class USFXCameraMode_TightAim : public USFXCameraMode_Combat
 public:
 	class UBioCameraZoom*                              ZoomData;                                         		// 0x00F0 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65802 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5098 );
 	};
 
 	void Tick ( float TimeDelta );
 	void eventModifyPostProcessSettings ( struct FPostProcessSettings* PPSettings );
 };
 
-UClass* USFXCameraMode_TightAim::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_MountedGunTightAim
 // 0x0000 (0x00F4 - 0x00F4)
 class USFXCameraMode_MountedGunTightAim : public USFXCameraMode_TightAim
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65820 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5100 );
 	};
 
 	void Tick ( float TimeDelta );
 	void eventModifyPostProcessSettings ( struct FPostProcessSettings* PPSettings );
 };
 
-UClass* USFXCameraMode_MountedGunTightAim::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_PistolTightAim
 // 0x0000 (0x00F4 - 0x00F4)
 class USFXCameraMode_PistolTightAim : public USFXCameraMode_TightAim
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65825 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5101 );
 	};
 
 	void Tick ( float TimeDelta );
 	void eventModifyPostProcessSettings ( struct FPostProcessSettings* PPSettings );
 };
 
-UClass* USFXCameraMode_PistolTightAim::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_ReplicationDebug
 // 0x0000 (0x00EC - 0x00EC)
 class USFXCameraMode_ReplicationDebug : public USFXCameraMode
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65830 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5102 );
 	};
 
 	void ProcessViewRotation ( float DeltaTime, struct FRotator* OutViewRotation, struct FRotator* OutDeltaRot );
@@ -47581,72 +38565,45 @@ public:
 	void eventModifyPostProcessSettings ( struct FPostProcessSettings* PPSettings );
 };
 
-UClass* USFXCameraMode_ReplicationDebug::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_Roll
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_Roll : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65841 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5103 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_Roll::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_SniperAim
 // 0x0000 (0x00F4 - 0x00F4)
 class USFXCameraMode_SniperAim : public USFXCameraMode_TightAim
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65845 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5104 );
 	};
 
 	void Tick ( float TimeDelta );
 	void eventModifyPostProcessSettings ( struct FPostProcessSettings* PPSettings );
 };
 
-UClass* USFXCameraMode_SniperAim::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_Spectator
 // 0x0000 (0x00EC - 0x00EC)
 class USFXCameraMode_Spectator : public USFXCameraMode
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65850 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5105 );
 	};
 
 	void ProcessViewRotation ( float DeltaTime, struct FRotator* OutViewRotation, struct FRotator* OutDeltaRot );
@@ -47672,80 +38629,51 @@ public:
 	void eventModifyPostProcessSettings ( struct FPostProcessSettings* PPSettings );
 };
 
-UClass* USFXCameraMode_Spectator::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_SplitScreenCombat
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_SplitScreenCombat : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65858 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5106 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_SplitScreenCombat::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_TightAimCover
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_TightAimCover : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65862 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5107 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_TightAimCover::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraMode_Vehicle
 // 0x0000 (0x00F0 - 0x00F0)
 class USFXCameraMode_Vehicle : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65869 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5108 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_Vehicle::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraTransition_ZoomSnap
 // 0x0027 (0x0168 - 0x0141)
 class USFXCameraTransition_ZoomSnap : public USFXCameraMode_Interpolate
@@ -47755,16 +38683,9 @@ public:
 	struct FRotator                                    StartRotation;                                    		// 0x0150 (0x000C) [0x0000000000000000]              
 	struct FVector                                     StartLocation;                                    		// 0x015C (0x000C) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65979 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5109 );
 	};
 
 	void Tick ( float TimeDelta );
@@ -47772,8 +38693,6 @@ public:
 	void InitializeTransition ( class USFXCameraMode* FromMode, class USFXCameraMode* ToMode, float Time, unsigned long PreserveTarget );
 };
 
-UClass* USFXCameraTransition_ZoomSnap::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraSetup
 // 0x00E8 (0x0124 - 0x003C)
 class USFXCameraSetup : public UObject
@@ -47835,16 +38754,9 @@ public:
 	class USFXCameraMode*                              PowerCoverStdLeanRight;                           		// 0x011C (0x0004) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 	unsigned long                                      bCustomCameraMode : 1;                            		// 0x0120 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 65998 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5110 );
 	};
 
 	void GetAimbackCameraMode ( class ABioPlayerController* PC, class USFXCameraMode** NewCameraMode, float* TransitionTime );
@@ -47858,8 +38770,6 @@ public:
 	class USFXCameraMode* GetCombatCamera ( );
 };
 
-UClass* USFXCameraSetup::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraShakeBase
 // 0x0078 (0x00B4 - 0x003C)
 class USFXCameraShakeBase : public UObject
@@ -47867,22 +38777,13 @@ class USFXCameraShakeBase : public UObject
 public:
 	struct FScreenShakeStruct                          TheShake;                                         		// 0x003C (0x0078) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 66148 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5111 );
 	};
 
 };
 
-UClass* USFXCameraShakeBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraTransition_Animated
 // 0x0013 (0x0154 - 0x0141)
 class USFXCameraTransition_Animated : public USFXCameraMode_Interpolate
@@ -47894,40 +38795,24 @@ public:
 	unsigned long                                      bAnimationBegun : 1;                              		// 0x0150 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bScalePlayRate : 1;                               		// 0x0150 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 66151 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5112 );
 	};
 
 	void Tick ( float TimeDelta );
 	void InitializeTransition ( class USFXCameraMode* FromMode, class USFXCameraMode* ToMode, float Time, unsigned long PreserveTarget );
 };
 
-UClass* USFXCameraTransition_Animated::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraTransition_GalaxyMap
 // 0x0000 (0x0141 - 0x0141)
 class USFXCameraTransition_GalaxyMap : public USFXCameraMode_Interpolate
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 66181 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5113 );
 	};
 
 	void DrawHUD ( class UBioCheatManager* M );
@@ -47940,8 +38825,6 @@ public:
 	float Interpolate ( float T );
 };
 
-UClass* USFXCameraTransition_GalaxyMap::pClassPointer = NULL;
-
 // Class SFXGame.SFXCameraTransition_VanguardSlam
 // 0x0048 (0x019C - 0x0154)
 class USFXCameraTransition_VanguardSlam : public USFXCameraTransition_Animated
@@ -47956,24 +38839,15 @@ public:
 	float                                              FOVChange;                                        		// 0x0194 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	float                                              FirstPhaseLength;                                 		// 0x0198 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 66191 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5114 );
 	};
 
 	void Tick ( float TimeDelta );
 	void InitializeTransition ( class USFXCameraMode* FromMode, class USFXCameraMode* ToMode, float Time, unsigned long PreserveTarget );
 };
 
-UClass* USFXCameraTransition_VanguardSlam::pClassPointer = NULL;
-
 // Class SFXGame.SFXPowerCustomAction_MeleePassivePower
 // 0x01BB (0x0850 - 0x0695)
 class USFXPowerCustomAction_MeleePassivePower : public USFXPowerCustomAction_PassivePower
@@ -47990,16 +38864,9 @@ public:
 	struct FPowerData                                  CoverMeleeImpactRadius;                           		// 0x0818 (0x0030) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 	struct FName                                       MeleeKillCategory;                                		// 0x0848 (0x0008) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 66686 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5123 );
 	};
 
 	void RecalculateAllPowerData ( unsigned long bReset );
@@ -48007,24 +38874,15 @@ public:
 	void OnRegularMeleeKill ( class AActor* oImpacted );
 };
 
-UClass* USFXPowerCustomAction_MeleePassivePower::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_BackTakeDown
 // 0x0000 (0x013D - 0x013D)
 class USFXCustomAction_BackTakeDown : public USFXCustomAction_ClassMelee
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 66808 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5124 );
 	};
 
 	void InterruptThisCustomAction ( );
@@ -48041,8 +38899,6 @@ public:
 	bool InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced );
 };
 
-UClass* USFXCustomAction_BackTakeDown::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_BovineFortitude
 // 0x000B (0x010C - 0x0101)
 class USFXCustomAction_BovineFortitude : public USFXCustomAction_DamageReaction
@@ -48051,24 +38907,15 @@ public:
 	float                                              HealDuration;                                     		// 0x0104 (0x0004) [0x0000000000000000]              
 	class UWwiseEvent*                                 Moo;                                              		// 0x0108 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 66873 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5134 );
 	};
 
 	void DelayedSoundEffect ( );
 	void BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime );
 };
 
-UClass* USFXCustomAction_BovineFortitude::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_Cover90TurnBase
 // 0x002D (0x00EE - 0x00C1)
 class USFXCustomAction_Cover90TurnBase : public UBioCustomAction
@@ -48088,16 +38935,9 @@ public:
 	unsigned char                                      RootBoneZ;                                        		// 0x00EC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      StartBlendType;                                   		// 0x00ED (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 66903 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5135 );
 	};
 
 	void StopCustomAction ( );
@@ -48111,24 +38951,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_Cover90TurnBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_Cover90TurnLeft
 // 0x0000 (0x00EE - 0x00EE)
 class USFXCustomAction_Cover90TurnLeft : public USFXCustomAction_Cover90TurnBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 66955 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5136 );
 	};
 
 	void StopCustomAction ( );
@@ -48142,24 +38973,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_Cover90TurnLeft::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_Cover90TurnLeftStanding
 // 0x0000 (0x00EE - 0x00EE)
 class USFXCustomAction_Cover90TurnLeftStanding : public USFXCustomAction_Cover90TurnLeft
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 66957 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5137 );
 	};
 
 	void StopCustomAction ( );
@@ -48173,24 +38995,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_Cover90TurnLeftStanding::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_Cover90TurnRight
 // 0x0000 (0x00EE - 0x00EE)
 class USFXCustomAction_Cover90TurnRight : public USFXCustomAction_Cover90TurnBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 66959 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5138 );
 	};
 
 	void StopCustomAction ( );
@@ -48204,24 +39017,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_Cover90TurnRight::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_Cover90TurnRightStanding
 // 0x0000 (0x00EE - 0x00EE)
 class USFXCustomAction_Cover90TurnRightStanding : public USFXCustomAction_Cover90TurnRight
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 66961 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5139 );
 	};
 
 	void StopCustomAction ( );
@@ -48235,24 +39039,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_Cover90TurnRightStanding::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_CoverSlipBase
 // 0x0000 (0x00EE - 0x00EE)
 class USFXCustomAction_CoverSlipBase : public USFXCustomAction_SingleAnim
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 66994 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5146 );
 	};
 
 	void BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime );
@@ -48263,8 +39058,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_CoverSlipBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_DrawWeapon
 // 0x001C (0x00DD - 0x00C1)
 class USFXCustomAction_DrawWeapon : public UBioCustomAction
@@ -48276,16 +39069,9 @@ public:
 	float                                              fAnimPlaybackRate;                                		// 0x00D8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      BlendType;                                        		// 0x00DC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67002 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5147 );
 	};
 
 	void StopCustomAction ( );
@@ -48293,24 +39079,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_DrawWeapon::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_ExplosionBack
 // 0x0000 (0x00EE - 0x00EE)
 class USFXCustomAction_ExplosionBack : public USFXCustomAction_SingleAnim
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67028 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5148 );
 	};
 
 	void BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime );
@@ -48321,24 +39098,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_ExplosionBack::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_ExplosionForward
 // 0x0000 (0x00EE - 0x00EE)
 class USFXCustomAction_ExplosionForward : public USFXCustomAction_SingleAnim
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67032 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5149 );
 	};
 
 	void BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime );
@@ -48349,24 +39117,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_ExplosionForward::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_ExplosionLeft
 // 0x0000 (0x00EE - 0x00EE)
 class USFXCustomAction_ExplosionLeft : public USFXCustomAction_SingleAnim
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67036 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5150 );
 	};
 
 	void BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime );
@@ -48377,24 +39136,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_ExplosionLeft::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_ExplosionRight
 // 0x0000 (0x00EE - 0x00EE)
 class USFXCustomAction_ExplosionRight : public USFXCustomAction_SingleAnim
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67040 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5151 );
 	};
 
 	void BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime );
@@ -48405,8 +39155,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_ExplosionRight::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_HackDoor
 // 0x0006 (0x00F4 - 0x00EE)
 class USFXCustomAction_HackDoor : public USFXCustomAction_SingleAnim
@@ -48414,16 +39162,9 @@ class USFXCustomAction_HackDoor : public USFXCustomAction_SingleAnim
 public:
 	class UWwiseEvent*                                 CancelSound;                                      		// 0x00F0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67059 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5152 );
 	};
 
 	void StopCustomAction ( );
@@ -48432,24 +39173,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_HackDoor::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_HeavyStdCoverMeleeRight
 // 0x0000 (0x013D - 0x013D)
 class USFXCustomAction_HeavyStdCoverMeleeRight : public USFXCustomAction_ClassMelee
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67068 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5153 );
 	};
 
 	void InterruptThisCustomAction ( );
@@ -48466,8 +39198,6 @@ public:
 	bool InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced );
 };
 
-UClass* USFXCustomAction_HeavyStdCoverMeleeRight::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_HolsterWeapon
 // 0x001C (0x00DD - 0x00C1)
 class USFXCustomAction_HolsterWeapon : public UBioCustomAction
@@ -48479,16 +39209,9 @@ public:
 	float                                              fAnimPlaybackRate;                                		// 0x00D8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      BlendType;                                        		// 0x00DC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67087 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5154 );
 	};
 
 	void StopCustomAction ( );
@@ -48496,8 +39219,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_HolsterWeapon::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_LookAtLoop
 // 0x0061 (0x0122 - 0x00C1)
 class USFXCustomAction_LookAtLoop : public UBioCustomAction
@@ -48517,16 +39238,9 @@ public:
 	unsigned char                                      LoopState;                                        		// 0x0120 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 	unsigned char                                      RootMotionMode;                                   		// 0x0121 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67138 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5160 );
 	};
 
 	void StopCustomAction ( );
@@ -48538,8 +39252,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_LookAtLoop::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_Loop
 // 0x003D (0x00FE - 0x00C1)
 class USFXCustomAction_Loop : public UBioCustomAction
@@ -48556,16 +39268,9 @@ public:
 	unsigned char                                      LoopState;                                        		// 0x00FC (0x0001) [0x0000000000002000]              ( CPF_Transient )
 	unsigned char                                      RootMotionMode;                                   		// 0x00FD (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67169 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5161 );
 	};
 
 	void StopCustomAction ( );
@@ -48575,8 +39280,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_Loop::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_LoopingInteraction
 // 0x0041 (0x0119 - 0x00D8)
 class USFXCustomAction_LoopingInteraction : public USFXCustomAction_InteractionPointAnim
@@ -48594,16 +39297,9 @@ public:
 	unsigned long                                      bTriggeredEnd : 1;                                		// 0x0114 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned char                                      InteractionStage;                                 		// 0x0118 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67193 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5162 );
 	};
 
 	void TriggerEnd ( );
@@ -48613,8 +39309,6 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_LoopingInteraction::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_OmniWave
 // 0x0016 (0x0104 - 0x00EE)
 class USFXCustomAction_OmniWave : public USFXCustomAction_SingleAnim
@@ -48623,16 +39317,9 @@ public:
 	struct FGuid                                       OmniToolGuid;                                     		// 0x00F0 (0x0010) [0x0000000000000000]              
 	class URvrClientEffectInterface*                   CE_OmniTool;                                      		// 0x0100 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67298 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5163 );
 	};
 
 	void CheckFiring ( );
@@ -48640,24 +39327,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_OmniWave::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_PlayerEvadeBase
 // 0x0000 (0x00EE - 0x00EE)
 class USFXCustomAction_PlayerEvadeBase : public USFXCustomAction_SingleAnim
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67308 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5164 );
 	};
 
 	void BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime );
@@ -48668,8 +39346,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_PlayerEvadeBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_PlayerHeavyMeleeBase
 // 0x003C (0x0144 - 0x0108)
 class USFXCustomAction_PlayerHeavyMeleeBase : public USFXCustomAction_ProceduralSync
@@ -48682,16 +39358,9 @@ public:
 	class USFXPowerCustomAction_MeleePassivePower*     Power;                                            		// 0x013C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	int                                                OmniWeaponPlotID;                                 		// 0x0140 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67369 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5165 );
 	};
 
 	void StopCustomAction ( );
@@ -48703,8 +39372,6 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_PlayerHeavyMeleeBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameEffect_MovementSpeedBonus
 // 0x0006 (0x0068 - 0x0062)
 class USFXGameEffect_MovementSpeedBonus : public USFXGameEffect
@@ -48712,46 +39379,28 @@ class USFXGameEffect_MovementSpeedBonus : public USFXGameEffect
 public:
 	float                                              OriginalDesiredSpeed;                             		// 0x0064 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67382 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5168 );
 	};
 
 	void OnRemoved ( );
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_MovementSpeedBonus::pClassPointer = NULL;
-
 // Class SFXGame.SFXDamageType_HeavyMelee
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_HeavyMelee : public USFXDamageType_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67424 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5177 );
 	};
 
 };
 
-UClass* USFXDamageType_HeavyMelee::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_PlayerMeleeBase
 // 0x00D4 (0x01DC - 0x0108)
 class USFXCustomAction_PlayerMeleeBase : public USFXCustomAction_ProceduralSync
@@ -48776,16 +39425,9 @@ public:
 	unsigned long                                      bPlayMeleedVoc : 1;                               		// 0x01D8 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      ApplyBlurEffect : 1;                              		// 0x01D8 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67425 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5178 );
 	};
 
 	void Breakout ( );
@@ -48801,24 +39443,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_PlayerMeleeBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_ReloadBase
 // 0x0000 (0x00C1 - 0x00C1)
 class USFXCustomAction_ReloadBase : public UBioCustomAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67426 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5179 );
 	};
 
 	void CheckMoving ( );
@@ -48877,8 +39510,6 @@ public:
 	bool CanDoCustomAction ( class APawn* SyncPawn, unsigned long bForced );
 };
 
-UClass* USFXCustomAction_ReloadBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_PlayerShieldStandardImpact
 // 0x0012 (0x0100 - 0x00EE)
 class USFXCustomAction_PlayerShieldStandardImpact : public USFXCustomAction_SingleAnim
@@ -48887,16 +39518,9 @@ public:
 	struct FBodyStance                                 BS_Anim1;                                         		// 0x00F0 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	int                                                RandPercent;                                      		// 0x00FC (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67486 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5192 );
 	};
 
 	void EndAction ( );
@@ -48905,24 +39529,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_PlayerShieldStandardImpact::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_ShieldFace
 // 0x0000 (0x00EE - 0x00EE)
 class USFXCustomAction_ShieldFace : public USFXCustomAction_SingleAnim
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67538 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5193 );
 	};
 
 	void BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime );
@@ -48933,8 +39548,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_ShieldFace::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_SingleAnimInteraction
 // 0x0018 (0x00F0 - 0x00D8)
 class USFXCustomAction_SingleAnimInteraction : public USFXCustomAction_InteractionPointAnim
@@ -48945,16 +39558,9 @@ public:
 	float                                              fBlendOutTime;                                    		// 0x00E8 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bPauseAnimOnStart : 1;                            		// 0x00EC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67542 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5194 );
 	};
 
 	void TriggerEnd ( );
@@ -48963,8 +39569,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_SingleAnimInteraction::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_SyncBase
 // 0x0038 (0x012C - 0x00F4)
 class USFXCustomAction_SyncBase : public USFXCustomAction_SyncPawnInstigator_Base
@@ -48981,16 +39585,9 @@ public:
 	float                                              TargetBlendOutTime;                               		// 0x0124 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	class USFXAnimSetCookSpec*                         TargetAnimInfo;                                   		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67626 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5195 );
 	};
 
 	void StopCustomAction ( );
@@ -49004,8 +39601,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_SyncBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_SyncBase_Loop
 // 0x006D (0x0161 - 0x00F4)
 class USFXCustomAction_SyncBase_Loop : public USFXCustomAction_SyncPawnInstigator_Base
@@ -49028,16 +39623,9 @@ public:
 	class UAnimSet*                                    VictimAnimSet;                                    		// 0x015C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      LoopState;                                        		// 0x0160 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67652 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5196 );
 	};
 
 	void StopCustomAction ( );
@@ -49048,8 +39636,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_SyncBase_Loop::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_SyncMultiPawnInstigator_Base
 // 0x0033 (0x00F4 - 0x00C1)
 class USFXCustomAction_SyncMultiPawnInstigator_Base : public UBioCustomAction
@@ -49066,16 +39652,9 @@ public:
 	unsigned long                                      bHideTargetWeapon : 1;                            		// 0x00F0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 	unsigned long                                      bAffectsFriendlies : 1;                           		// 0x00F0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67681 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5197 );
 	};
 
 	void OnPartnerReachedDestination ( );
@@ -49093,8 +39672,6 @@ public:
 	void AddSyncPartner ( class ABioPawn* SyncPartner );
 };
 
-UClass* USFXCustomAction_SyncMultiPawnInstigator_Base::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_SyncMultiBase
 // 0x0018 (0x010C - 0x00F4)
 class USFXCustomAction_SyncMultiBase : public USFXCustomAction_SyncMultiPawnInstigator_Base
@@ -49105,16 +39682,9 @@ public:
 	float                                              InstigatorBlendInTime;                            		// 0x0104 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	float                                              InstigatorBlendOutTime;                           		// 0x0108 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67722 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5198 );
 	};
 
 	void StopCustomAction ( );
@@ -49124,8 +39694,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_SyncMultiBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_Utilize
 // 0x002B (0x012C - 0x0101)
 class USFXCustomAction_Utilize : public USFXCustomAction_DamageReaction
@@ -49136,16 +39704,9 @@ public:
 	struct FBodyStance                                 BS_ReactionExploreAlternative;                    		// 0x011C (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	class UWwiseEvent*                                 CancelSound;                                      		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67771 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5199 );
 	};
 
 	void StopCustomAction ( );
@@ -49155,8 +39716,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_Utilize::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_VariableExit
 // 0x0027 (0x0188 - 0x0161)
 class USFXCustomAction_VariableExit : public USFXCustomAction_SyncBase_Loop
@@ -49168,16 +39727,9 @@ public:
 	float                                              VictimBlendOutTime2;                              		// 0x0180 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	class USFXTimelineData*                            SuccessTimeline;                                  		// 0x0184 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67786 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5200 );
 	};
 
 	bool MessageEvent ( struct FName EventName, class UObject* Sender );
@@ -49186,8 +39738,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_VariableExit::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomAction_WeaponPickUp
 // 0x000E (0x00FC - 0x00EE)
 class USFXCustomAction_WeaponPickUp : public USFXCustomAction_SingleAnim
@@ -49195,46 +39745,28 @@ class USFXCustomAction_WeaponPickUp : public USFXCustomAction_SingleAnim
 public:
 	struct FBodyStance                                 BS_AnimExplore;                                   		// 0x00F0 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67805 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5201 );
 	};
 
 	void StartCustomAction ( );
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_WeaponPickUp::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomizationInstance
 // 0x0000 (0x003C - 0x003C)
 class USFXCustomizationInstance : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67813 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5202 );
 	};
 
 };
 
-UClass* USFXCustomizationInstance::pClassPointer = NULL;
-
 // Class SFXGame.SFXCustomizationInstance_Player
 // 0x0039 (0x0075 - 0x003C)
 class USFXCustomizationInstance_Player : public USFXCustomizationInstance
@@ -49256,39 +39788,23 @@ public:
 	unsigned long                                      bUseCasualAppearance : 1;                         		// 0x0070 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned char                                      CombatAppearance;                                 		// 0x0074 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67823 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5203 );
 	};
 
 	void CustomizeMaterialInstance ( class UMaterialInstanceConstant* MIC );
 };
 
-UClass* USFXCustomizationInstance_Player::pClassPointer = NULL;
-
 // Class SFXGame.SFXDamageType_CoverMelee
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_CoverMelee : public USFXDamageType_Melee
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67851 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5204 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -49296,24 +39812,15 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_CoverMelee::pClassPointer = NULL;
-
 // Class SFXGame.SFXDamageType_CriticalMelee
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_CriticalMelee : public USFXDamageType_Melee
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67854 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5205 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -49321,24 +39828,15 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_CriticalMelee::pClassPointer = NULL;
-
 // Class SFXGame.SFXDamageType_IllusiveManConflict
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_IllusiveManConflict : public USFXDamageType_PowerPhysics
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67864 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5206 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -49346,24 +39844,15 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_IllusiveManConflict::pClassPointer = NULL;
-
 // Class SFXGame.SFXDamageType_KroganCharge
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_KroganCharge : public USFXDamageType_Default
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67867 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5207 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -49371,30 +39860,19 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_KroganCharge::pClassPointer = NULL;
-
 // Class SFXGame.SFXDamageType_Power_Control
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_Power_Control : public USFXDamageType_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67870 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5208 );
 	};
 
 };
 
-UClass* USFXDamageType_Power_Control::pClassPointer = NULL;
-
 // Class SFXGame.SFXDamageType_Power_Ragdoll
 // 0x0001 (0x00EA - 0x00E9)
 class USFXDamageType_Power_Ragdoll : public USFXDamageType_Power
@@ -49402,82 +39880,48 @@ class USFXDamageType_Power_Ragdoll : public USFXDamageType_Power
 public:
 	unsigned char                                      AnimatedPowerRagdollType;                         		// 0x00E9 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67888 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5209 );
 	};
 
 };
 
-UClass* USFXDamageType_Power_Ragdoll::pClassPointer = NULL;
-
 // Class SFXGame.SFXDamageType_Stasis
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_Stasis : public USFXDamageType_Power_Control
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67894 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5210 );
 	};
 
 };
 
-UClass* USFXDamageType_Stasis::pClassPointer = NULL;
-
 // Class SFXGame.SFXDecalActorSpawnable
 // 0x0000 (0x01FC - 0x01FC)
 class ASFXDecalActorSpawnable : public ADecalActorMovable
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 67902 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5211 );
 	};
 
 };
 
-UClass* ASFXDecalActorSpawnable::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqEvt_SFXDoorInteraction
 // 0x0000 (0x00D2 - 0x00D2)
 class USFXSeqEvt_SFXDoorInteraction : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68021 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5212 );
 	};
 
 	void eventToggled ( );
@@ -49487,8 +39931,6 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* USFXSeqEvt_SFXDoorInteraction::pClassPointer = NULL;
-
 // Class SFXGame.sfxdroppedammo
 // 0x0014 (0x021C - 0x0208)
 class Asfxdroppedammo : public ADroppedPickup
@@ -49500,16 +39942,9 @@ public:
 	class ULightEnvironmentComponent*                  LightEnvironment;                                 		// 0x0214 (0x0004) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 	unsigned long                                      bPooled : 1;                                      		// 0x0218 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68132 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5213 );
 	};
 
 	void Reuse ( );
@@ -49525,8 +39960,6 @@ public:
 	bool CanPickUpAmmo ( class APawn* ChkPawn );
 };
 
-UClass* Asfxdroppedammo::pClassPointer = NULL;
-
 // Class SFXGame.SFXDroppedPickup
 // 0x001D (0x0225 - 0x0208)
 class ASFXDroppedPickup : public ADroppedPickup
@@ -49541,16 +39974,9 @@ public:
 	unsigned long                                      bTargetable : 1;                                  		// 0x0220 (0x0004) [0x0000000000000020] [0x00000001] ( CPF_Net )
 	unsigned char                                      EquipWeaponToolTip;                               		// 0x0224 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68193 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5214 );
 	};
 
 	void PickedUpBy ( class APawn* P );
@@ -49564,8 +39990,6 @@ public:
 	void PostBeginPlay ( );
 };
 
-UClass* ASFXDroppedPickup::pClassPointer = NULL;
-
 // Class SFXGame.SFXEmitter
 // 0x0004 (0x0208 - 0x0204)
 class ASFXEmitter : public AEmitter
@@ -49573,16 +39997,9 @@ class ASFXEmitter : public AEmitter
 public:
 	unsigned long                                      bPooled : 1;                                      		// 0x0204 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68361 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5216 );
 	};
 
 	void Reset ( );
@@ -49593,48 +40010,30 @@ public:
 	void Recycle ( );
 };
 
-UClass* ASFXEmitter::pClassPointer = NULL;
-
 // Class SFXGame.SFXDynamicPrefabInstance
 // 0x0000 (0x02B4 - 0x02B4)
 class ASFXDynamicPrefabInstance : public APrefabInstance
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68377 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5217 );
 	};
 
 	void DestroyPrefab ( );
 	void InstancePrefab ( class UPrefab* InPrefab );
 };
 
-UClass* ASFXDynamicPrefabInstance::pClassPointer = NULL;
-
 // Class SFXGame.SFXTeamInfo
 // 0x0000 (0x0214 - 0x0214)
 class ASFXTeamInfo : public ATeamInfo
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68433 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5218 );
 	};
 
 	unsigned char GetTeamNum ( );
@@ -49649,24 +40048,15 @@ public:
 	void eventReplicatedEvent ( struct FName VarName );
 };
 
-UClass* ASFXTeamInfo::pClassPointer = NULL;
-
 // Class SFXGame.SFXMutator
 // 0x0000 (0x020C - 0x020C)
 class ASFXMutator : public AMutator
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68468 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5219 );
 	};
 
 	void NetDamage ( int OriginalDamage, class APawn* injured, class AController* instigatedBy, struct FVector HitLocation, class UClass* DamageType, class AActor* DamageCauser, int* Damage, struct FVector* Momentum );
@@ -49700,24 +40090,15 @@ public:
 	void eventPreBeginPlay ( );
 };
 
-UClass* ASFXMutator::pClassPointer = NULL;
-
 // Class SFXGame.SFXPawn_PlayerAdeptNonCombat
 // 0x0000 (0x11EB - 0x11EB)
 class ASFXPawn_PlayerAdeptNonCombat : public ASFXPawn_PlayerNonCombat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68484 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5220 );
 	};
 
 	void RemoveDetachOnDestroyObject ( class USkeletalMeshComponent* MeshToRemove );
@@ -49837,24 +40218,15 @@ public:
 	void AsyncUpdating_OnCompleted ( TArray< class UObject* >* LoadedAssets );
 };
 
-UClass* ASFXPawn_PlayerAdeptNonCombat::pClassPointer = NULL;
-
 // Class SFXGame.SFXPawn_PlayerInfiltratorNonCombat
 // 0x0000 (0x11EB - 0x11EB)
 class ASFXPawn_PlayerInfiltratorNonCombat : public ASFXPawn_PlayerNonCombat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68485 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5221 );
 	};
 
 	void RemoveDetachOnDestroyObject ( class USkeletalMeshComponent* MeshToRemove );
@@ -49974,24 +40346,15 @@ public:
 	void AsyncUpdating_OnCompleted ( TArray< class UObject* >* LoadedAssets );
 };
 
-UClass* ASFXPawn_PlayerInfiltratorNonCombat::pClassPointer = NULL;
-
 // Class SFXGame.SFXPawn_PlayerEngineerNonCombat
 // 0x0000 (0x11EB - 0x11EB)
 class ASFXPawn_PlayerEngineerNonCombat : public ASFXPawn_PlayerNonCombat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68486 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5222 );
 	};
 
 	void RemoveDetachOnDestroyObject ( class USkeletalMeshComponent* MeshToRemove );
@@ -50111,24 +40474,15 @@ public:
 	void AsyncUpdating_OnCompleted ( TArray< class UObject* >* LoadedAssets );
 };
 
-UClass* ASFXPawn_PlayerEngineerNonCombat::pClassPointer = NULL;
-
 // Class SFXGame.SFXPawn_PlayerVanguardNonCombat
 // 0x0000 (0x11EB - 0x11EB)
 class ASFXPawn_PlayerVanguardNonCombat : public ASFXPawn_PlayerNonCombat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68487 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5223 );
 	};
 
 	void RemoveDetachOnDestroyObject ( class USkeletalMeshComponent* MeshToRemove );
@@ -50248,24 +40602,15 @@ public:
 	void AsyncUpdating_OnCompleted ( TArray< class UObject* >* LoadedAssets );
 };
 
-UClass* ASFXPawn_PlayerVanguardNonCombat::pClassPointer = NULL;
-
 // Class SFXGame.SFXPawn_PlayerSentinelNonCombat
 // 0x0000 (0x11EB - 0x11EB)
 class ASFXPawn_PlayerSentinelNonCombat : public ASFXPawn_PlayerNonCombat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68488 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5224 );
 	};
 
 	void RemoveDetachOnDestroyObject ( class USkeletalMeshComponent* MeshToRemove );
@@ -50385,24 +40730,15 @@ public:
 	void AsyncUpdating_OnCompleted ( TArray< class UObject* >* LoadedAssets );
 };
 
-UClass* ASFXPawn_PlayerSentinelNonCombat::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqEvt_CombatStarted
 // 0x0000 (0x00D2 - 0x00D2)
 class USFXSeqEvt_CombatStarted : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68700 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5225 );
 	};
 
 	void eventToggled ( );
@@ -50412,24 +40748,15 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* USFXSeqEvt_CombatStarted::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqEvt_CombatEnded
 // 0x0000 (0x00D2 - 0x00D2)
 class USFXSeqEvt_CombatEnded : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68710 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5226 );
 	};
 
 	void eventToggled ( );
@@ -50439,24 +40766,15 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* USFXSeqEvt_CombatEnded::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameChoiceGUIData_HeavyWeapons
 // 0x0000 (0x0071 - 0x0071)
 class USFXGameChoiceGUIData_HeavyWeapons : public USFXGameChoiceGUIData
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68841 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5227 );
 	};
 
 	void RemoveTokenMapping ( int nTokenID, struct FSFXChoiceEntry* Data );
@@ -50467,8 +40785,6 @@ public:
 	void SetDisplayText ( void* srTitle, void* srSubTitle, void* srAText, void* srBText );
 };
 
-UClass* USFXGameChoiceGUIData_HeavyWeapons::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameChoiceGUIData_Research
 // 0x0043 (0x00B4 - 0x0071)
 class USFXGameChoiceGUIData_Research : public USFXGameChoiceGUIData
@@ -50487,38 +40803,22 @@ public:
 	void*                                              m_srResearchErrorTooExpensive;                    		// 0x00AC (0x0004) [0x0000000000004000]              ( CPF_Config )
 	void*                                              m_srResearchErrorCanNotLearn;                     		// 0x00B0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68863 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5228 );
 	};
 
 };
 
-UClass* USFXGameChoiceGUIData_Research::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameChoiceGUIData_Weapons
 // 0x0000 (0x0071 - 0x0071)
 class USFXGameChoiceGUIData_Weapons : public USFXGameChoiceGUIData
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68891 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5229 );
 	};
 
 	void RemoveTokenMapping ( int nTokenID, struct FSFXChoiceEntry* Data );
@@ -50529,8 +40829,6 @@ public:
 	void SetDisplayText ( void* srTitle, void* srSubTitle, void* srAText, void* srBText );
 };
 
-UClass* USFXGameChoiceGUIData_Weapons::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameEffect_DamageOverTime
 // 0x000A (0x006C - 0x0062)
 class USFXGameEffect_DamageOverTime : public USFXGameEffect
@@ -50539,16 +40837,9 @@ public:
 	class UClass*                                      DamageType;                                       		// 0x0064 (0x0004) [0x0000000000000000]              
 	float                                              DamageInterval;                                   		// 0x0068 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68960 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5230 );
 	};
 
 	void OnRemoved ( );
@@ -50556,8 +40847,6 @@ public:
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_DamageOverTime::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameEffect_GlobalCooldownBonus
 // 0x0006 (0x0068 - 0x0062)
 class USFXGameEffect_GlobalCooldownBonus : public USFXGameEffect
@@ -50565,16 +40854,9 @@ class USFXGameEffect_GlobalCooldownBonus : public USFXGameEffect
 public:
 	unsigned long                                      bRemoved : 1;                                     		// 0x0064 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68974 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5231 );
 	};
 
 	void OnRemoved ( );
@@ -50583,8 +40865,6 @@ public:
 	void ComputeEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_GlobalCooldownBonus::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameEffect_HealOverTime
 // 0x0006 (0x0068 - 0x0062)
 class USFXGameEffect_HealOverTime : public USFXGameEffect
@@ -50592,39 +40872,23 @@ class USFXGameEffect_HealOverTime : public USFXGameEffect
 public:
 	unsigned long                                      bPercentOfMaxHealth : 1;                          		// 0x0064 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68988 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5232 );
 	};
 
 	void OnUpdate ( float DeltaSeconds );
 };
 
-UClass* USFXGameEffect_HealOverTime::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameEffect_HealthRegenPenalty
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_HealthRegenPenalty : public USFXGameEffect
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68995 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5233 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -50640,8 +40904,6 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_HealthRegenPenalty::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameEffect_HealthBonus
 // 0x000A (0x006C - 0x0062)
 class USFXGameEffect_HealthBonus : public USFXGameEffect
@@ -50650,16 +40912,9 @@ public:
 	float                                              PercentHealthBonus;                               		// 0x0064 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bEffectValueIsPercent : 1;                        		// 0x0068 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 68998 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5234 );
 	};
 
 	void OnRemoved ( );
@@ -50667,24 +40922,15 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_HealthBonus::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameEffect_IgnorePlayerSquad
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_IgnorePlayerSquad : public USFXGameEffect
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 69012 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5235 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -50700,24 +40946,15 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_IgnorePlayerSquad::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameEffect_PhysicsDamageMultiplier
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_PhysicsDamageMultiplier : public USFXGameEffect
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 69048 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5236 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -50733,24 +40970,15 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_PhysicsDamageMultiplier::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameEffect_PhysicsPower
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_PhysicsPower : public USFXGameEffect
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 69054 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5237 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -50766,8 +40994,6 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_PhysicsPower::pClassPointer = NULL;
-
 // Class SFXGame.SFXRumble_Power
 // 0x0008 (0x0048 - 0x0040)
 class USFXRumble_Power : public UWaveFormBase
@@ -50776,22 +41002,13 @@ public:
 	float                                              MinDetonationRumbleDistance;                      		// 0x0040 (0x0004) [0x0000000000000000]              
 	float                                              MaxDetonationRumbleDistance;                      		// 0x0044 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 69125 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5251 );
 	};
 
 };
 
-UClass* USFXRumble_Power::pClassPointer = NULL;
-
 // Class SFXGame.SFXShake_Power
 // 0x0008 (0x00BC - 0x00B4)
 class USFXShake_Power : public USFXCameraShakeBase
@@ -50800,22 +41017,13 @@ public:
 	float                                              MinDetonationShakeDistance;                       		// 0x00B4 (0x0004) [0x0000000000000000]              
 	float                                              MaxDetonationShakeDistance;                       		// 0x00B8 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 69126 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5252 );
 	};
 
 };
 
-UClass* USFXShake_Power::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameEffect_ShieldBonus
 // 0x000A (0x006C - 0x0062)
 class USFXGameEffect_ShieldBonus : public USFXGameEffect
@@ -50825,16 +41033,9 @@ public:
 	unsigned long                                      bEffectValueIsPercent : 1;                        		// 0x0068 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      bRemoveEffectWhenShieldsDown : 1;                 		// 0x0068 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 69128 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5253 );
 	};
 
 	void OnRemoved ( );
@@ -50843,24 +41044,15 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_ShieldBonus::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameEffect_ShieldRegenBonus
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_ShieldRegenBonus : public USFXGameEffect
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 69146 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5254 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -50876,8 +41068,6 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_ShieldRegenBonus::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameEffect_TimeDilation
 // 0x001A (0x007C - 0x0062)
 class USFXGameEffect_TimeDilation : public USFXGameEffect
@@ -50887,16 +41077,9 @@ public:
 	float                                              TimeRemainingBeforePause;                         		// 0x0074 (0x0004) [0x0000000000000000]              
 	float                                              OwnerCounterScale;                                		// 0x0078 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 69155 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5255 );
 	};
 
 	void OnUnpaused ( );
@@ -50906,8 +41089,6 @@ public:
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_TimeDilation::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameEffect_UniqueArmor_Base
 // 0x000E (0x0070 - 0x0062)
 class USFXGameEffect_UniqueArmor_Base : public USFXGameEffect
@@ -50915,39 +41096,23 @@ class USFXGameEffect_UniqueArmor_Base : public USFXGameEffect
 public:
 	TArray< struct FUniqueArmorEffects >               Children;                                         		// 0x0064 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 69168 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5256 );
 	};
 
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_UniqueArmor_Base::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameEffect_WeaponDamageBonus
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_WeaponDamageBonus : public USFXGameEffect_PassiveWeaponDamageBonus
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 69178 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5257 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -50963,8 +41128,6 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_WeaponDamageBonus::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameEffect_WeldPhysics
 // 0x0009 (0x0081 - 0x0078)
 class USFXGameEffect_WeldPhysics : public USFXGameEffect_DeathEffect
@@ -50974,16 +41137,9 @@ public:
 	unsigned long                                      bFreezeSucceeded : 1;                             		// 0x007C (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned char                                      CustomActionType;                                 		// 0x0080 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 69180 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5258 );
 	};
 
 	void OnRemoved ( );
@@ -50991,24 +41147,15 @@ public:
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_WeldPhysics::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqEvt_LeaveWorld
 // 0x0000 (0x00D2 - 0x00D2)
 class USFXSeqEvt_LeaveWorld : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 69302 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5259 );
 	};
 
 	void eventToggled ( );
@@ -51018,31 +41165,20 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* USFXSeqEvt_LeaveWorld::pClassPointer = NULL;
-
 // Class SFXGame.SFXGameViewportClient
 // 0x0000 (0x0128 - 0x0128)
 class USFXGameViewportClient : public UGFxGameViewportClient
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 70365 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5260 );
 	};
 
 	bool eventInit ( struct FString* OutError );
 };
 
-UClass* USFXGameViewportClient::pClassPointer = NULL;
-
 // Class SFXGame.SFXLocalPlayer
 // 0x0008 (0x0434 - 0x042C)
 class USFXLocalPlayer : public ULocalPlayer
@@ -51051,44 +41187,26 @@ public:
 	class USFXGAWReinforcementManagerBase*             GAWReinforcementManager;                          		// 0x042C (0x0004) [0x0000000004400008]              ( CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 	class USFXGAWAssetsHandler*                        GAWHandler;                                       		// 0x0430 (0x0004) [0x0000000004402008]              ( CPF_ExportObject | CPF_Transient | CPF_NeedCtorLink | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 70455 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5261 );
 	};
 
 };
 
-UClass* USFXLocalPlayer::pClassPointer = NULL;
-
 // Class SFXGame.SFXGAWReinforcementManagerBase
 // 0x0000 (0x003C - 0x003C)
 class USFXGAWReinforcementManagerBase : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 70769 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5262 );
 	};
 
 };
 
-UClass* USFXGAWReinforcementManagerBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXMarkerModuleManager
 // 0x0060 (0x009C - 0x003C)
 class USFXMarkerModuleManager : public UObject
@@ -51103,16 +41221,9 @@ public:
 	struct FScriptDelegate                             __OnDeactivated__Delegate;                        		// 0x0084 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	struct FScriptDelegate                             __OnDestroyed__Delegate;                          		// 0x0090 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 70818 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5263 );
 	};
 
 	void ClearManagerDestroyedDelegate ( struct FScriptDelegate ManagerDestroyedDelegate );
@@ -51136,8 +41247,6 @@ public:
 	void OnActivated ( class AActor* ActivatedTarget );
 };
 
-UClass* USFXMarkerModuleManager::pClassPointer = NULL;
-
 // Class SFXGame.sfxwavecoordinator
 // 0x0016 (0x020C - 0x01F6)
 class Asfxwavecoordinator : public AActor
@@ -51147,16 +41256,9 @@ public:
 	float                                              PostLoadDelay;                                    		// 0x0204 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	unsigned long                                      WavesAreLoading : 1;                              		// 0x0208 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 70869 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5264 );
 	};
 
 	float GetObjectiveScoreBudget ( );
@@ -51183,8 +41285,6 @@ public:
 	void StartWaves ( );
 };
 
-UClass* Asfxwavecoordinator::pClassPointer = NULL;
-
 // Class SFXGame.sfxgui_accomplishments
 // 0x0017 (0x0278 - 0x0261)
 class Usfxgui_accomplishments : public USFXGUIMovie
@@ -51197,16 +41297,9 @@ public:
 	unsigned long                                      bFromMainMenu : 1;                                		// 0x0274 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      bShowChildDetails : 1;                            		// 0x0274 (0x0004) [0x0000000000004000] [0x00000002] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 70913 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5265 );
 	};
 
 	void Exit ( );
@@ -51217,8 +41310,6 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* Usfxgui_accomplishments::pClassPointer = NULL;
-
 // Class SFXGame.SFXPlayerInventoryManager
 // 0x0048 (0x0354 - 0x030C)
 class ASFXPlayerInventoryManager : public ASFXInventoryManager
@@ -51240,16 +41331,9 @@ public:
 	float                                              AccMod_WeaponFired;                               		// 0x034C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	float                                              TimeSinceLastFire;                                		// 0x0350 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 71135 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5270 );
 	};
 
 	float GetPlayerCrosshairValue ( );
@@ -51258,8 +41342,6 @@ public:
 	void Tick ( float DeltaTime );
 };
 
-UClass* ASFXPlayerInventoryManager::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_GalaxyAtWar
 // 0x003F (0x02A0 - 0x0261)
 class USFXGUI_GalaxyAtWar : public USFXGUIMovie
@@ -51275,16 +41357,9 @@ public:
 	void*                                              srGaWTutorialMessage;                             		// 0x0298 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	unsigned long                                      m_bGAWRatingsError : 1;                           		// 0x029C (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 71210 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5271 );
 	};
 
 	void AS_SetPercentagesVisible ( unsigned long bVisbile );
@@ -51308,24 +41383,15 @@ public:
 	void OnFinished ( );
 };
 
-UClass* USFXGUI_GalaxyAtWar::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_MainMenu_RTT_RC_B
 // 0x0000 (0x0274 - 0x0274)
 class USFXGUI_MainMenu_RTT_RC_B : public USFXGUIMovieKismet
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 71886 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5272 );
 	};
 
 	void eventOnClose ( );
@@ -51334,24 +41400,15 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* USFXGUI_MainMenu_RTT_RC_B::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_Option_VOLanguage
 // 0x0000 (0x0055 - 0x0055)
 class USFXGUI_Option_VOLanguage : public USFXGUI_Option_LanguageBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 72161 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5273 );
 	};
 
 	void GetAvailableSKULanguages ( TArray< struct FLanguageOptionInfo >* aReturnLangs );
@@ -51364,8 +41421,6 @@ public:
 	bool eventOptionIsAvailable ( );
 };
 
-UClass* USFXGUI_Option_VOLanguage::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_SquadRecord
 // 0x0107 (0x0394 - 0x028D)
 class USFXGUI_SquadRecord : public USFXGUIMovieLegacyAdapter
@@ -51419,16 +41474,9 @@ public:
 	unsigned long                                      m_bFinished : 1;                                  		// 0x0390 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 	unsigned long                                      m_bCheckingNotifications : 1;                     		// 0x0390 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 72244 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5274 );
 	};
 
 	void ASRefreshDataAfterRespec ( int nCharIndex );
@@ -51499,24 +41547,15 @@ public:
 	void OnNewTutorialCallback ( );
 };
 
-UClass* USFXGUI_SquadRecord::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_PCSquadRecord
 // 0x0000 (0x0394 - 0x0394)
 class USFXGUI_PCSquadRecord : public USFXGUI_SquadRecord
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 72659 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5275 );
 	};
 
 	void ASRefreshDataAfterRespec ( int nCharIndex );
@@ -51587,24 +41626,15 @@ public:
 	void OnNewTutorialCallback ( );
 };
 
-UClass* USFXGUI_PCSquadRecord::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_PCStore
 // 0x0000 (0x0460 - 0x0460)
 class USFXGUI_PCStore : public USFXGUI_Store
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 73423 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5284 );
 	};
 
 	struct FString GetStoreHeaderImageRef ( );
@@ -51656,8 +41686,6 @@ public:
 	void OnCloseCallback ( );
 };
 
-UClass* USFXGUI_PCStore::pClassPointer = NULL;
-
 // Class SFXGame.sfxgui_playercountdown
 // 0x0017 (0x0278 - 0x0261)
 class Usfxgui_playercountdown : public USFXGUIMovie
@@ -51667,16 +41695,9 @@ public:
 	float                                              LastBleedOutTimer;                                		// 0x0270 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bTappingPromptVisible : 1;                        		// 0x0274 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 73427 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5285 );
 	};
 
 	void ASFinishOtherPlayerRevive ( );
@@ -51705,8 +41726,6 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* Usfxgui_playercountdown::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_TeamSelect
 // 0x004F (0x02B0 - 0x0261)
 class USFXGUI_TeamSelect : public USFXGUIMovie
@@ -51725,16 +41744,9 @@ public:
 	unsigned long                                      bWasPaused : 1;                                   		// 0x02AC (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 	unsigned long                                      bNoSelect : 1;                                    		// 0x02AC (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 73857 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5286 );
 	};
 
 	void ASSetTotalPartySize ( int nPartySize );
@@ -51772,8 +41784,6 @@ public:
 	void OnRequestExitDelegate ( );
 };
 
-UClass* USFXGUI_TeamSelect::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIData_TeamSelect
 // 0x006B (0x00DC - 0x0071)
 class USFXGUIData_TeamSelect : public USFXGameChoiceGUIData
@@ -51795,22 +41805,13 @@ public:
 	void*                                              srPartyQuestion;                                  		// 0x00D4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	void*                                              srInfoExit;                                       		// 0x00D8 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 74062 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5287 );
 	};
 
 };
 
-UClass* USFXGUIData_TeamSelect::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_WarAssets
 // 0x0027 (0x0288 - 0x0261)
 class USFXGUI_WarAssets : public USFXGUIMovie
@@ -51822,16 +41823,9 @@ public:
 	class USFXGAWAssetsHandler*                        GAWAssetsHandler;                                 		// 0x0280 (0x0004) [0x0000000000000000]              
 	void*                                              srWarAssetsTutorialMessage;                       		// 0x0284 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 74330 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5288 );
 	};
 
 	void AS_ScrollDetails ( float fValue );
@@ -51862,8 +41856,6 @@ public:
 	void OnFinished ( );
 };
 
-UClass* USFXGUI_WarAssets::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_WeaponReticleSimple
 // 0x000C (0x0098 - 0x008C)
 class USFXGUI_WeaponReticleSimple : public USFXGUI_WeaponReticleBase
@@ -51873,16 +41865,9 @@ public:
 	class UGFxValue*                                   m_oPipRight;                                      		// 0x0090 (0x0004) [0x0000000000000000]              
 	class UGFxValue*                                   m_oPipLeft;                                       		// 0x0094 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 74424 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5289 );
 	};
 
 	void eventTargetCanHitChanged ( unsigned long bInSights );
@@ -51892,8 +41877,6 @@ public:
 	void eventPerformReticleShow ( unsigned long bInstant );
 };
 
-UClass* USFXGUI_WeaponReticleSimple::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUI_WeaponReticleSimpleAlpha
 // 0x0004 (0x009C - 0x0098)
 class USFXGUI_WeaponReticleSimpleAlpha : public USFXGUI_WeaponReticleSimple
@@ -51901,39 +41884,23 @@ class USFXGUI_WeaponReticleSimpleAlpha : public USFXGUI_WeaponReticleSimple
 public:
 	float                                              ReticleOpacity;                                   		// 0x0098 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 74440 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5290 );
 	};
 
 	void eventResetReticle ( unsigned long bUnsubscribe );
 };
 
-UClass* USFXGUI_WeaponReticleSimpleAlpha::pClassPointer = NULL;
-
 // Class SFXGame.SFXPowerCustomAction_AmmoPowerBase
 // 0x0000 (0x0695 - 0x0695)
 class USFXPowerCustomAction_AmmoPowerBase : public Usfxpowercustomaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 74619 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5325 );
 	};
 
 	int GetSaveGamePowerState ( );
@@ -52030,30 +41997,19 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXPowerCustomAction_AmmoPowerBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIData_TerminalNoSquadSel
 // 0x0000 (0x00A4 - 0x00A4)
 class USFXGUIData_TerminalNoSquadSel : public USFXGUIData_Terminal
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 74815 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5357 );
 	};
 
 };
 
-UClass* USFXGUIData_TerminalNoSquadSel::pClassPointer = NULL;
-
 // Class SFXGame.sfxguiext_weaponmods
 // 0x00B8 (0x00F8 - 0x0040)
 class Usfxguiext_weaponmods : public USFXGUIMovieExtension
@@ -52090,16 +42046,9 @@ public:
 	unsigned long                                      CurrentModSelectionIsValid : 1;                   		// 0x00F4 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 	unsigned long                                      m_bMonitorWeaponLoadIn : 1;                       		// 0x00F4 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 74817 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5358 );
 	};
 
 	void AS_ModInitModDisplay ( );
@@ -52144,8 +42093,6 @@ public:
 	void eventOnAdded ( );
 };
 
-UClass* Usfxguiext_weaponmods::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_MarkerGrenade
 // 0x0004 (0x0080 - 0x007C)
 class USFXModule_MarkerGrenade : public USFXModule_Marker
@@ -52153,38 +42100,22 @@ class USFXModule_MarkerGrenade : public USFXModule_Marker
 public:
 	float                                              VisibleDistance;                                  		// 0x007C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 75235 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5359 );
 	};
 
 };
 
-UClass* USFXModule_MarkerGrenade::pClassPointer = NULL;
-
 // Class SFXGame.SFXGUIValue_MarkerObjectiveSP
 // 0x0000 (0x01A8 - 0x01A8)
 class USFXGUIValue_MarkerObjectiveSP : public USFXGUIValue_MarkerObjective
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 75262 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5360 );
 	};
 
 	void FadeOutMarker ( );
@@ -52195,8 +42126,6 @@ public:
 	void Initialize ( );
 };
 
-UClass* USFXGUIValue_MarkerObjectiveSP::pClassPointer = NULL;
-
 // Class SFXGame.SFXModule_MarkerObjectiveSP
 // 0x0007 (0x0084 - 0x007D)
 class USFXModule_MarkerObjectiveSP : public USFXModule_MarkerObjective
@@ -52204,22 +42133,13 @@ class USFXModule_MarkerObjectiveSP : public USFXModule_MarkerObjective
 public:
 	unsigned long                                      DisplayMarkerOnSpawn : 1;                         		// 0x0080 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 75265 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5361 );
 	};
 
 };
 
-UClass* USFXModule_MarkerObjectiveSP::pClassPointer = NULL;
-
 // Class SFXGame.SFXPhysicalMaterialImpactEffects
 // 0x0038 (0x0074 - 0x003C)
 class USFXPhysicalMaterialImpactEffects : public USFXPhysicalMaterialBase
@@ -52240,22 +42160,13 @@ public:
 	class UParticleSystem*                             MassCannon;                                       		// 0x006C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	class UParticleSystem*                             ParticleBeam;                                     		// 0x0070 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 75646 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5420 );
 	};
 
 };
 
-UClass* USFXPhysicalMaterialImpactEffects::pClassPointer = NULL;
-
 // Class SFXGame.SFXPhysicalMaterialImpactSounds
 // 0x0078 (0x00B4 - 0x003C)
 class USFXPhysicalMaterialImpactSounds : public USFXPhysicalMaterialBase
@@ -52292,22 +42203,13 @@ public:
 	class UWwiseEvent*                                 GraalShotgun;                                     		// 0x00AC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	class UWwiseEvent*                                 GraalShotgun_Player;                              		// 0x00B0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 75660 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5424 );
 	};
 
 };
 
-UClass* USFXPhysicalMaterialImpactSounds::pClassPointer = NULL;
-
 // Class SFXGame.SFXPhysicalMaterialDecals
 // 0x00E0 (0x011C - 0x003C)
 class USFXPhysicalMaterialDecals : public USFXPhysicalMaterialBase
@@ -52342,22 +42244,13 @@ public:
 	float                                              MassCannonFadeTime;                               		// 0x0114 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	float                                              ParticleBeamFadeTime;                             		// 0x0118 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 75677 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5428 );
 	};
 
 };
 
-UClass* USFXPhysicalMaterialDecals::pClassPointer = NULL;
-
 // Class SFXGame.sfxwave
 // 0x0020 (0x005C - 0x003C)
 class Usfxwave : public UObject
@@ -52371,16 +42264,9 @@ public:
 	unsigned long                                      IsLoading : 1;                                    		// 0x0058 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned long                                      IsActive : 1;                                     		// 0x0058 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 76410 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5535 );
 	};
 
 	unsigned char AggregateAssetLoadStatus ( );
@@ -52398,24 +42284,15 @@ public:
 	void InitializeWave ( class ASFXWaveManager* NewWaveManager );
 };
 
-UClass* Usfxwave::pClassPointer = NULL;
-
 // Class SFXGame.SFXInterpTrackSetEnvEffectIntensity
 // 0x0000 (0x0070 - 0x0070)
 class USFXInterpTrackSetEnvEffectIntensity : public USFXGameInterpTrackCustom
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 76670 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5536 );
 	};
 
 	struct FString eventKeyDataDisplayName ( );
@@ -52424,8 +42301,6 @@ public:
 	bool eventAllowKeyNaming ( );
 };
 
-UClass* USFXInterpTrackSetEnvEffectIntensity::pClassPointer = NULL;
-
 // Class SFXGame.SFXTreasureUseModule
 // 0x0009 (0x00B9 - 0x00B0)
 class USFXTreasureUseModule : public USFXModule_SavedUse
@@ -52435,16 +42310,9 @@ public:
 	unsigned long                                      bUseAbsuluteAmount : 1;                           		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned char                                      TreasureType;                                     		// 0x00B8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 76752 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5537 );
 	};
 
 	bool eventIsDefaultActionPossible ( );
@@ -52453,8 +42321,6 @@ public:
 	void OnUsed ( class AActor* User );
 };
 
-UClass* USFXTreasureUseModule::pClassPointer = NULL;
-
 // Class SFXGame.SFXMiningNode
 // 0x0022 (0x0218 - 0x01F6)
 class ASFXMiningNode : public ASFXPointOfInterest
@@ -52469,39 +42335,23 @@ public:
 	class UParticleSystemComponent*                    PSC_GroundReticle;                                		// 0x0210 (0x0004) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 	unsigned long                                      bAlreadyMined : 1;                                		// 0x0214 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 77265 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5538 );
 	};
 
 	void PostBeginPlay ( );
 };
 
-UClass* ASFXMiningNode::pClassPointer = NULL;
-
 // Class SFXGame.SFXMutator_DifficultySpeed
 // 0x0000 (0x020C - 0x020C)
 class ASFXMutator_DifficultySpeed : public ASFXMutator
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 77832 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5539 );
 	};
 
 	void NetDamage ( int OriginalDamage, class APawn* injured, class AController* instigatedBy, struct FVector HitLocation, class UClass* DamageType, class AActor* DamageCauser, int* Damage, struct FVector* Momentum );
@@ -52535,8 +42385,6 @@ public:
 	void eventPreBeginPlay ( );
 };
 
-UClass* ASFXMutator_DifficultySpeed::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_WayPoint
 // 0x000C (0x02D0 - 0x02C4)
 class ASFXNav_WayPoint : public ANavigationPoint
@@ -52547,60 +42395,35 @@ public:
 	unsigned long                                      m_bPrecisionMovement : 1;                         		// 0x02CC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      m_bMaintainVelocity : 1;                          		// 0x02CC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 77841 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5540 );
 	};
 
 };
 
-UClass* ASFXNav_WayPoint::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_ActionStationWP
 // 0x0000 (0x02D0 - 0x02D0)
 class ASFXNav_ActionStationWP : public ASFXNav_WayPoint
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 77848 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5541 );
 	};
 
 };
 
-UClass* ASFXNav_ActionStationWP::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_KaiLengShield
 // 0x0000 (0x02C4 - 0x02C4)
 class ASFXNav_KaiLengShield : public APathNode
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 77902 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5542 );
 	};
 
 	struct FString eventGetDebugAbbrev ( );
@@ -52624,8 +42447,6 @@ public:
 	void GetBoundingCylinder ( float* CollisionRadius, float* CollisionHeight );
 };
 
-UClass* ASFXNav_KaiLengShield::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_PlayAnimWP
 // 0x0009 (0x02D9 - 0x02D0)
 class ASFXNav_PlayAnimWP : public ASFXNav_WayPoint
@@ -52634,23 +42455,14 @@ public:
 	struct FName                                       AnimName;                                         		// 0x02D0 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      eStance;                                          		// 0x02D8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 77941 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5543 );
 	};
 
 	bool OnPawnReachedWayPoint ( class APawn* oPawn );
 };
 
-UClass* ASFXNav_PlayAnimWP::pClassPointer = NULL;
-
 // Class SFXGame.SFXNav_TurretPoint
 // 0x0004 (0x02C8 - 0x02C4)
 class ASFXNav_TurretPoint : public APathNode
@@ -52658,22 +42470,13 @@ class ASFXNav_TurretPoint : public APathNode
 public:
 	unsigned long                                      bClaimed : 1;                                     		// 0x02C4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 77950 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5544 );
 	};
 
 };
 
-UClass* ASFXNav_TurretPoint::pClassPointer = NULL;
-
 // Class SFXGame.SFXOperation_ObjectiveSpawnPoint
 // 0x001F (0x0215 - 0x01F6)
 class ASFXOperation_ObjectiveSpawnPoint : public ABioStartLocation
@@ -52686,23 +42489,14 @@ public:
 	class AActor*                                      AnnexZoneLocation;                                		// 0x0210 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      SpawnLocation;                                    		// 0x0214 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 77989 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5545 );
 	};
 
 	bool IsObjectiveValidForSpawn ( class USFXOperation_ObjectiveData* ObjectiveData );
 };
 
-UClass* ASFXOperation_ObjectiveSpawnPoint::pClassPointer = NULL;
-
 // Class SFXGame.SFXOperation_ObjectiveData
 // 0x0044 (0x0080 - 0x003C)
 class USFXOperation_ObjectiveData : public UObject
@@ -52716,23 +42510,14 @@ public:
 	float                                              MinDistanceFromPlayerForSpawn;                    		// 0x0078 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	unsigned long                                      PerformVisibilityCheckForSpawn : 1;               		// 0x007C (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 78000 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5546 );
 	};
 
 	bool CanSelectedMeshSpawnAtLocation ( class ASFXOperation_ObjectiveSpawnPoint* SpawnPoint );
 };
 
-UClass* USFXOperation_ObjectiveData::pClassPointer = NULL;
-
 // Class SFXGame.SFXPowerCustomAction_ParagonRenegade
 // 0x0033 (0x06C8 - 0x0695)
 class USFXPowerCustomAction_ParagonRenegade : public USFXPowerCustomAction_PassivePower
@@ -52740,16 +42525,9 @@ class USFXPowerCustomAction_ParagonRenegade : public USFXPowerCustomAction_Passi
 public:
 	struct FPowerData                                  ParagonRenegadeModifier;                          		// 0x0698 (0x0030) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 80387 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5548 );
 	};
 
 	void RecalculateAllPowerData ( unsigned long bReset );
@@ -52760,8 +42538,6 @@ public:
 	void ApplyGlobalBonus ( );
 };
 
-UClass* USFXPowerCustomAction_ParagonRenegade::pClassPointer = NULL;
-
 // Class SFXGame.SFXProjectile_PowerCustomAction_Grenade
 // 0x0020 (0x0444 - 0x0424)
 class ASFXProjectile_PowerCustomAction_Grenade : public ASFXProjectile_PowerCustomAction
@@ -52777,16 +42553,9 @@ public:
 	unsigned long                                      bExploded : 1;                                    		// 0x0440 (0x0004) [0x0000000004000008] [0x00000001] ( CPF_ExportObject | CPF_EditInline )
 	unsigned long                                      bSpeedThresholdFuseSet : 1;                       		// 0x0440 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 82019 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5574 );
 	};
 
 	void Explode ( struct FVector HitLocation, struct FVector HitNormal );
@@ -52799,8 +42568,6 @@ public:
 	void FuseDone ( );
 };
 
-UClass* ASFXProjectile_PowerCustomAction_Grenade::pClassPointer = NULL;
-
 // Class SFXGame.SFXRumble_Explode
 // 0x0008 (0x0048 - 0x0040)
 class USFXRumble_Explode : public UWaveFormBase
@@ -52809,22 +42576,13 @@ public:
 	float                                              MinDetonationRumbleDistance;                      		// 0x0040 (0x0004) [0x0000000000000000]              
 	float                                              MaxDetonationRumbleDistance;                      		// 0x0044 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 83318 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5664 );
 	};
 
 };
 
-UClass* USFXRumble_Explode::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_3DCeberusStateChange
 // 0x0001 (0x00B1 - 0x00B0)
 class USFXSeqAct_3DCeberusStateChange : public USequenceAction
@@ -52832,23 +42590,14 @@ class USFXSeqAct_3DCeberusStateChange : public USequenceAction
 public:
 	unsigned char                                      m_eCerberus3DStateChange;                         		// 0x00B0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 83715 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5673 );
 	};
 
 	void eventActivated ( );
 };
 
-UClass* USFXSeqAct_3DCeberusStateChange::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_AddCombatZone
 // 0x0010 (0x00C0 - 0x00B0)
 class USFXSeqAct_AddCombatZone : public USequenceAction
@@ -52857,24 +42606,15 @@ public:
 	TArray< class ASFXCombatZone* >                    CombatZones;                                      		// 0x00B0 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	class AActor*                                      Squad;                                            		// 0x00BC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 83719 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5674 );
 	};
 
 	int eventGetObjClassVersion ( );
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_AddCombatZone::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_AIGoHere
 // 0x0020 (0x00E4 - 0x00C4)
 class USFXSeqAct_AIGoHere : public UBioSequenceLatentAction
@@ -52892,16 +42632,9 @@ public:
 	unsigned long                                      m_bArrivedPinFired : 1;                           		// 0x00E0 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 	unsigned long                                      m_bTargetInvalidated : 1;                         		// 0x00E0 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 83810 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5675 );
 	};
 
 	bool TryInvalidateTargetFlank ( );
@@ -52914,8 +42647,6 @@ public:
 	void eventActivated ( );
 };
 
-UClass* USFXSeqAct_AIGoHere::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_AwardEndGameAchievements
 // 0x0004 (0x00B4 - 0x00B0)
 class USFXSeqAct_AwardEndGameAchievements : public USequenceAction
@@ -52923,23 +42654,14 @@ class USFXSeqAct_AwardEndGameAchievements : public USequenceAction
 public:
 	int                                                PlayedME2VarIndex;                                		// 0x00B0 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 83872 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5676 );
 	};
 
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_AwardEndGameAchievements::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_AwardGAWAsset
 // 0x002A (0x00EE - 0x00C4)
 class USFXSeqAct_AwardGAWAsset : public UBioSequenceLatentAction
@@ -52955,16 +42677,9 @@ public:
 	unsigned char                                      m_Skin;                                           		// 0x00EC (0x0001) [0x0000000000000000]              
 	unsigned char                                      m_TextAlign;                                      		// 0x00ED (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 83884 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5677 );
 	};
 
 	int eventGetObjClassVersion ( );
@@ -52973,8 +42688,6 @@ public:
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_AwardGAWAsset::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_AwardGAWAsset_Silent
 // 0x0010 (0x00C0 - 0x00B0)
 class USFXSeqAct_AwardGAWAsset_Silent : public USequenceAction
@@ -52983,70 +42696,43 @@ public:
 	struct FString                                     AssetName;                                        		// 0x00B0 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	int                                                Id;                                               		// 0x00BC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 83911 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5678 );
 	};
 
 	int eventGetObjClassVersion ( );
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_AwardGAWAsset_Silent::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_AwardGAWAssetsForLevel
 // 0x0000 (0x00B0 - 0x00B0)
 class USFXSeqAct_AwardGAWAssetsForLevel : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 83920 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5679 );
 	};
 
 };
 
-UClass* USFXSeqAct_AwardGAWAssetsForLevel::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_AwardTreasure
 // 0x0000 (0x00B1 - 0x00B1)
 class USFXSeqAct_AwardTreasure : public USFXSeqAct_AwardTreasure_Base
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 83945 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5680 );
 	};
 
 	int eventGetObjClassVersion ( );
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_AwardTreasure::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_CanAffordTreasure
 // 0x0004 (0x00B4 - 0x00B0)
 class USFXSeqAct_CanAffordTreasure : public USequenceAction
@@ -53054,24 +42740,15 @@ class USFXSeqAct_CanAffordTreasure : public USequenceAction
 public:
 	int                                                nState;                                           		// 0x00B0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 83962 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5681 );
 	};
 
 	int eventGetObjClassVersion ( );
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_CanAffordTreasure::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_ChangeBehaviour
 // 0x0011 (0x00C1 - 0x00B0)
 class USFXSeqAct_ChangeBehaviour : public USequenceAction
@@ -53082,69 +42759,42 @@ public:
 	class AActor*                                      oPawn;                                            		// 0x00BC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      eBehaviour;                                       		// 0x00C0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 83970 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5682 );
 	};
 
 	void eventActivated ( );
 };
 
-UClass* USFXSeqAct_ChangeBehaviour::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_CharCreateCrust
 // 0x0000 (0x00C0 - 0x00C0)
 class USFXSeqAct_CharCreateCrust : public USeqAct_Latent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 83977 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5683 );
 	};
 
 	bool eventUpdate ( float DeltaTime );
 	void AbortFor ( class AActor* latentActor, unsigned long bCancel );
 };
 
-UClass* USFXSeqAct_CharCreateCrust::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_CheckResourceBudget
 // 0x0000 (0x00B0 - 0x00B0)
 class USFXSeqAct_CheckResourceBudget : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 83979 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5684 );
 	};
 
 };
 
-UClass* USFXSeqAct_CheckResourceBudget::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_ChooseLoadoutBase
 // 0x0100 (0x01C0 - 0x00C0)
 class USFXSeqAct_ChooseLoadoutBase : public USeqAct_Latent
@@ -53200,16 +42850,9 @@ public:
 	unsigned long                                      m_bFinished : 1;                                  		// 0x01BC (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned long                                      m_bAllHenchmen : 1;                               		// 0x01BC (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 83981 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5685 );
 	};
 
 	int eventGetObjClassVersion ( );
@@ -53246,96 +42889,58 @@ public:
 	void OnFinished ( );
 };
 
-UClass* USFXSeqAct_ChooseLoadoutBase::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_CloseGalaxyMap
 // 0x0000 (0x00B0 - 0x00B0)
 class USFXSeqAct_CloseGalaxyMap : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84236 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5686 );
 	};
 
 };
 
-UClass* USFXSeqAct_CloseGalaxyMap::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_DefendActor
 // 0x0000 (0x00B0 - 0x00B0)
 class USFXSeqAct_DefendActor : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84254 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5687 );
 	};
 
 };
 
-UClass* USFXSeqAct_DefendActor::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_FlushAsyncWork
 // 0x0000 (0x00B0 - 0x00B0)
 class USFXSeqAct_FlushAsyncWork : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84326 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5688 );
 	};
 
 };
 
-UClass* USFXSeqAct_FlushAsyncWork::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_ForceCombatOn
 // 0x0000 (0x00B0 - 0x00B0)
 class USFXSeqAct_ForceCombatOn : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84333 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5689 );
 	};
 
 };
 
-UClass* USFXSeqAct_ForceCombatOn::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_GenerateVocEvent
 // 0x0011 (0x00C1 - 0x00B0)
 class USFXSeqAct_GenerateVocEvent : public USequenceAction
@@ -53347,16 +42952,9 @@ public:
 	float                                              fChanceToPlayMod;                                 		// 0x00BC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      oEventID;                                         		// 0x00C0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84339 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5690 );
 	};
 
 	int eventGetObjClassVersion ( );
@@ -53364,8 +42962,6 @@ public:
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_GenerateVocEvent::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_GetCurrentGoal
 // 0x0008 (0x00B8 - 0x00B0)
 class USFXSeqAct_GetCurrentGoal : public USequenceAction
@@ -53374,23 +42970,14 @@ public:
 	class ASFXNav_GoalPoint*                           oGoal;                                            		// 0x00B0 (0x0004) [0x0000000000000000]              
 	int                                                nPriority;                                        		// 0x00B4 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84354 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5691 );
 	};
 
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_GetCurrentGoal::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_GetTreasureImage
 // 0x0008 (0x00B8 - 0x00B0)
 class USFXSeqAct_GetTreasureImage : public USequenceAction
@@ -53399,24 +42986,15 @@ public:
 	int                                                nTreasureId;                                      		// 0x00B0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	class UTexture2D*                                  oImage;                                           		// 0x00B4 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84361 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5692 );
 	};
 
 	int eventGetObjClassVersion ( );
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_GetTreasureImage::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_GivePlotWeapon
 // 0x001E (0x00DE - 0x00C0)
 class USFXSeqAct_GivePlotWeapon : public USeqAct_Latent
@@ -53435,16 +43013,9 @@ public:
 	unsigned char                                      m_Skin;                                           		// 0x00DC (0x0001) [0x0000000000000000]              
 	unsigned char                                      m_TextAlign;                                      		// 0x00DD (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84370 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5693 );
 	};
 
 	void eventPreVersionUpdated ( int OldVersion, int NewVersion );
@@ -53456,52 +43027,32 @@ public:
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_GivePlotWeapon::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_InitMainMenu
 // 0x0000 (0x00B0 - 0x00B0)
 class USFXSeqAct_InitMainMenu : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84456 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5694 );
 	};
 
 };
 
-UClass* USFXSeqAct_InitMainMenu::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_InterruptCustomAction
 // 0x0000 (0x00B0 - 0x00B0)
 class USFXSeqAct_InterruptCustomAction : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84461 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5695 );
 	};
 
 };
 
-UClass* USFXSeqAct_InterruptCustomAction::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_LinkLighting
 // 0x0004 (0x00B4 - 0x00B0)
 class USFXSeqAct_LinkLighting : public USequenceAction
@@ -53510,23 +43061,14 @@ public:
 	unsigned long                                      bLinkShadows : 1;                                 		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bLinkEnvironment : 1;                             		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84497 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5696 );
 	};
 
 	void eventActivated ( );
 };
 
-UClass* USFXSeqAct_LinkLighting::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_LinkToSaveBool
 // 0x000C (0x00BC - 0x00B0)
 class USFXSeqAct_LinkToSaveBool : public USequenceAction
@@ -53536,68 +43078,41 @@ public:
 	class USeqVar_Bool*                                oTargetBool;                                      		// 0x00B4 (0x0004) [0x0000000000000000]              
 	class USeqVar_Bool*                                oCombatTargetBool;                                		// 0x00B8 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84510 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5697 );
 	};
 
 	int eventGetObjClassVersion ( );
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_LinkToSaveBool::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_MainMenu
 // 0x0000 (0x00B0 - 0x00B0)
 class USFXSeqAct_MainMenu : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84567 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5698 );
 	};
 
 };
 
-UClass* USFXSeqAct_MainMenu::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_MakeLevelLive
 // 0x0000 (0x00B0 - 0x00B0)
 class USFXSeqAct_MakeLevelLive : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84573 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5699 );
 	};
 
 };
 
-UClass* USFXSeqAct_MakeLevelLive::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_RemoveCombatZone
 // 0x0010 (0x00C0 - 0x00B0)
 class USFXSeqAct_RemoveCombatZone : public USequenceAction
@@ -53606,23 +43121,14 @@ public:
 	TArray< class ASFXCombatZone* >                    CombatZones;                                      		// 0x00B0 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	class AActor*                                      Squad;                                            		// 0x00BC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84616 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5700 );
 	};
 
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_RemoveCombatZone::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_ResearchChoiceGUI
 // 0x01E0 (0x02A4 - 0x00C4)
 class USFXSeqAct_ResearchChoiceGUI : public UBioSequenceLatentAction
@@ -53672,16 +43178,9 @@ public:
 	unsigned char                                      InitialMode;                                      		// 0x02A2 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      InitialResearchMode;                              		// 0x02A3 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84625 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5701 );
 	};
 
 	int eventGetObjClassVersion ( );
@@ -53720,8 +43219,6 @@ public:
 	void eventDeactivated ( );
 };
 
-UClass* USFXSeqAct_ResearchChoiceGUI::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_SetDoorState
 // 0x0010 (0x00D4 - 0x00C4)
 class USFXSeqAct_SetDoorState : public UBioSequenceLatentAction
@@ -53733,16 +43230,9 @@ public:
 	unsigned long                                      m_bInstantTransition : 1;                         		// 0x00D0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bForceFireSuccess : 1;                            		// 0x00D0 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84826 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5702 );
 	};
 
 	int eventGetObjClassVersion ( );
@@ -53751,8 +43241,6 @@ public:
 	void eventActivated ( );
 };
 
-UClass* USFXSeqAct_SetDoorState::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_SetDoorType
 // 0x0005 (0x00B5 - 0x00B0)
 class USFXSeqAct_SetDoorType : public USequenceAction
@@ -53761,24 +43249,15 @@ public:
 	class ASFXDoor*                                    m_Door;                                           		// 0x00B0 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned char                                      m_DoorType;                                       		// 0x00B4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84844 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5703 );
 	};
 
 	int eventGetObjClassVersion ( );
 	void eventActivated ( );
 };
 
-UClass* USFXSeqAct_SetDoorType::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_SetGoalPriority
 // 0x0010 (0x00C0 - 0x00B0)
 class USFXSeqAct_SetGoalPriority : public USequenceAction
@@ -53789,23 +43268,14 @@ public:
 	int                                                m_nSetPriority;                                   		// 0x00B8 (0x0004) [0x0000000000000000]              
 	unsigned long                                      m_bResetPriorityToDefault : 1;                    		// 0x00BC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84851 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5704 );
 	};
 
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_SetGoalPriority::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_SetPawnVocState
 // 0x0004 (0x00B4 - 0x00B0)
 class USFXSeqAct_SetPawnVocState : public USequenceAction
@@ -53813,24 +43283,15 @@ class USFXSeqAct_SetPawnVocState : public USequenceAction
 public:
 	unsigned long                                      bVocState : 1;                                    		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84858 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5705 );
 	};
 
 	int eventGetObjClassVersion ( );
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_SetPawnVocState::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_SetTargetable
 // 0x0004 (0x00B4 - 0x00B0)
 class USFXSeqAct_SetTargetable : public USequenceAction
@@ -53839,24 +43300,15 @@ public:
 	unsigned long                                      bTargetable : 1;                                  		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bCombatTargetable : 1;                            		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84870 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5706 );
 	};
 
 	int eventGetObjClassVersion ( );
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_SetTargetable::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_SetTreasure
 // 0x0009 (0x00B9 - 0x00B0)
 class USFXSeqAct_SetTreasure : public USequenceAction
@@ -53868,46 +43320,28 @@ public:
 	unsigned long                                      bTreasureTypeOverride : 1;                        		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 	unsigned char                                      TreasureType;                                     		// 0x00B8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84879 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5707 );
 	};
 
 	int eventGetObjClassVersion ( );
 	void Activated ( );
 };
 
-UClass* USFXSeqAct_SetTreasure::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_SetWeaponVisibility
 // 0x0000 (0x00B0 - 0x00B0)
 class USFXSeqAct_SetWeaponVisibility : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84892 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5708 );
 	};
 
 };
 
-UClass* USFXSeqAct_SetWeaponVisibility::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_ShowCharacterRecordGUI
 // 0x0004 (0x00C8 - 0x00C4)
 class USFXSeqAct_ShowCharacterRecordGUI : public UBioSequenceLatentAction
@@ -53915,16 +43349,9 @@ class USFXSeqAct_ShowCharacterRecordGUI : public UBioSequenceLatentAction
 public:
 	unsigned long                                      m_bIsFinished : 1;                                		// 0x00C4 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84898 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5709 );
 	};
 
 	void eventDeactivated ( );
@@ -53933,8 +43360,6 @@ public:
 	void eventActivated ( );
 };
 
-UClass* USFXSeqAct_ShowCharacterRecordGUI::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_ShowOptionsGUI
 // 0x0005 (0x00C9 - 0x00C4)
 class USFXSeqAct_ShowOptionsGUI : public UBioSequenceLatentAction
@@ -53943,16 +43368,9 @@ public:
 	unsigned long                                      m_bIsFinished : 1;                                		// 0x00C4 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned char                                      OptionsGUIMode;                                   		// 0x00C8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84914 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5710 );
 	};
 
 	void eventDeactivated ( );
@@ -53961,8 +43379,6 @@ public:
 	void eventActivated ( );
 };
 
-UClass* USFXSeqAct_ShowOptionsGUI::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_StoreGUI
 // 0x0014 (0x00D8 - 0x00C4)
 class USFXSeqAct_StoreGUI : public UBioSequenceLatentAction
@@ -53976,16 +43392,9 @@ public:
 	unsigned long                                      m_bAborted : 1;                                   		// 0x00D4 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 	unsigned long                                      m_bWasPaused : 1;                                 		// 0x00D4 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84959 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5711 );
 	};
 
 	int eventGetObjClassVersion ( );
@@ -53997,96 +43406,58 @@ public:
 	void eventDeactivated ( );
 };
 
-UClass* USFXSeqAct_StoreGUI::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_ToggleAutoHints
 // 0x0000 (0x00B0 - 0x00B0)
 class USFXSeqAct_ToggleAutoHints : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84984 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5712 );
 	};
 
 };
 
-UClass* USFXSeqAct_ToggleAutoHints::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_ToggleBlinking
 // 0x0000 (0x00B0 - 0x00B0)
 class USFXSeqAct_ToggleBlinking : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 84988 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5713 );
 	};
 
 };
 
-UClass* USFXSeqAct_ToggleBlinking::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_ToggleInjuredShepardMode
 // 0x0000 (0x00B0 - 0x00B0)
 class USFXSeqAct_ToggleInjuredShepardMode : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 85024 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5714 );
 	};
 
 };
 
-UClass* USFXSeqAct_ToggleInjuredShepardMode::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_TogglePrototyping
 // 0x0000 (0x00B0 - 0x00B0)
 class USFXSeqAct_TogglePrototyping : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 85029 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5715 );
 	};
 
 };
 
-UClass* USFXSeqAct_TogglePrototyping::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqAct_WaitForPlayerSpawn
 // 0x0004 (0x00C4 - 0x00C0)
 class USFXSeqAct_WaitForPlayerSpawn : public USeqAct_Latent
@@ -54094,24 +43465,15 @@ class USFXSeqAct_WaitForPlayerSpawn : public USeqAct_Latent
 public:
 	unsigned long                                      bWaitForPlayerSpawn : 1;                          		// 0x00C0 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 85052 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5716 );
 	};
 
 	bool eventUpdate ( float DeltaTime );
 	class ABioPawn* GetPlayerPawn ( );
 };
 
-UClass* USFXSeqAct_WaitForPlayerSpawn::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqCond_GetDifficulty
 // 0x0007 (0x009C - 0x0095)
 class USFXSeqCond_GetDifficulty : public USequenceCondition
@@ -54119,40 +43481,24 @@ class USFXSeqCond_GetDifficulty : public USequenceCondition
 public:
 	class AActor*                                      Player;                                           		// 0x0098 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 85088 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5717 );
 	};
 
 	int eventGetObjClassVersion ( );
 	void Activated ( );
 };
 
-UClass* USFXSeqCond_GetDifficulty::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqCond_HasPlayerStart
 // 0x0000 (0x0095 - 0x0095)
 class USFXSeqCond_HasPlayerStart : public USequenceCondition
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 85095 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5718 );
 	};
 
 	void ForceActivateInput ( int InputIdx );
@@ -54187,24 +43533,15 @@ public:
 	bool HasLinkedOps ( unsigned long bConsiderInputLinks );
 };
 
-UClass* USFXSeqCond_HasPlayerStart::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqEvt_HordeEnemyKilled
 // 0x0000 (0x00D2 - 0x00D2)
 class USFXSeqEvt_HordeEnemyKilled : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 85117 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5719 );
 	};
 
 	void eventToggled ( );
@@ -54214,24 +43551,15 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* USFXSeqEvt_HordeEnemyKilled::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqEvt_HordeWaveEnd
 // 0x0000 (0x00D2 - 0x00D2)
 class USFXSeqEvt_HordeWaveEnd : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 85119 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5720 );
 	};
 
 	void eventToggled ( );
@@ -54241,24 +43569,15 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* USFXSeqEvt_HordeWaveEnd::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqEvt_HordeWaveStart
 // 0x0000 (0x00D2 - 0x00D2)
 class USFXSeqEvt_HordeWaveStart : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 85121 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5721 );
 	};
 
 	void eventToggled ( );
@@ -54268,24 +43587,15 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* USFXSeqEvt_HordeWaveStart::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqEvt_LeavingStasis
 // 0x0000 (0x00D2 - 0x00D2)
 class USFXSeqEvt_LeavingStasis : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 85125 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5722 );
 	};
 
 	void eventToggled ( );
@@ -54295,24 +43605,15 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* USFXSeqEvt_LeavingStasis::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqEvt_ProtoInputTrap
 // 0x0000 (0x00D2 - 0x00D2)
 class USFXSeqEvt_ProtoInputTrap : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 85131 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5723 );
 	};
 
 	void eventToggled ( );
@@ -54322,24 +43623,15 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* USFXSeqEvt_ProtoInputTrap::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqEvt_Tutorial
 // 0x0000 (0x00D2 - 0x00D2)
 class USFXSeqEvt_Tutorial : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 85152 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5724 );
 	};
 
 	void eventToggled ( );
@@ -54349,24 +43641,15 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* USFXSeqEvt_Tutorial::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqEvt_VehicleMiningFailure
 // 0x0000 (0x00D2 - 0x00D2)
 class USFXSeqEvt_VehicleMiningFailure : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 85154 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5725 );
 	};
 
 	void eventToggled ( );
@@ -54376,24 +43659,15 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* USFXSeqEvt_VehicleMiningFailure::pClassPointer = NULL;
-
 // Class SFXGame.SFXSeqEvt_VehicleMiningSuccess
 // 0x0000 (0x00D2 - 0x00D2)
 class USFXSeqEvt_VehicleMiningSuccess : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 85156 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5726 );
 	};
 
 	void eventToggled ( );
@@ -54403,24 +43677,15 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* USFXSeqEvt_VehicleMiningSuccess::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_PCAreaMap
 // 0x0000 (0x0370 - 0x0370)
 class USFXSFHandler_PCAreaMap : public USFXSFHandler_AreaMap
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 85882 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5727 );
 	};
 
 	void ASSetTriggerDisplay ( unsigned long bShowingBumpers );
@@ -54448,24 +43713,15 @@ public:
 	void OnPanelAdded ( );
 };
 
-UClass* USFXSFHandler_PCAreaMap::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_PCEANetworking
 // 0x0000 (0x0370 - 0x0370)
 class USFXSFHandler_PCEANetworking : public USFXSFHandler_EANetworking
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 85885 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5728 );
 	};
 
 	void AS_SetActiveInputField ( struct FString sText );
@@ -54524,8 +43780,6 @@ public:
 	void ShowIntroPage ( );
 };
 
-UClass* USFXSFHandler_PCEANetworking::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_PCHUD
 // 0x0006 (0x06D4 - 0x06CE)
 class USFXSFHandler_PCHUD : public USFXSFHandler_HUD
@@ -54533,40 +43787,24 @@ class USFXSFHandler_PCHUD : public USFXSFHandler_HUD
 public:
 	void*                                              m_srPOIAction;                                    		// 0x06D0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 85888 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5729 );
 	};
 
 	struct FString GetActionIconString ( unsigned char eActionIcon );
 	void SetTargetStatus ( struct FString sStatus, unsigned long bInteractive, unsigned long bInRange );
 };
 
-UClass* USFXSFHandler_PCHUD::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_PCLoad
 // 0x0000 (0x0419 - 0x0419)
 class USFXSFHandler_PCLoad : public USFXSFHandler_Load
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 85899 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5730 );
 	};
 
 	void eventAS_ScrollDetailsAnalog ( float fScroll );
@@ -54604,8 +43842,6 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* USFXSFHandler_PCLoad::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_PCPersonalization
 // 0x0007 (0x03B4 - 0x03AD)
 class USFXSFHandler_PCPersonalization : public USFXSFHandler_Personalization
@@ -54613,40 +43849,24 @@ class USFXSFHandler_PCPersonalization : public USFXSFHandler_Personalization
 public:
 	unsigned long                                      bRotationEnabled : 1;                             		// 0x03B0 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 86148 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5731 );
 	};
 
 	bool eventHandleInputEvent ( unsigned char Event, float fValue );
 	void eventUpdate ( float fDeltaT );
 };
 
-UClass* USFXSFHandler_PCPersonalization::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_PCSave
 // 0x0000 (0x0349 - 0x0349)
 class USFXSFHandler_PCSave : public USFXSFHandler_Save
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 86702 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5732 );
 	};
 
 	void SetLoadSave ( unsigned long bIsSave, unsigned long bLegacySave, unsigned long ME2Import, int nLastGUI, int nLayout, unsigned long bCarreerSelection );
@@ -54670,24 +43890,15 @@ public:
 	void BeginInitializeSaveList ( );
 };
 
-UClass* USFXSFHandler_PCSave::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_PCSlideshow
 // 0x0000 (0x02F0 - 0x02F0)
 class USFXSFHandler_PCSlideshow : public USFXSFHandler_Slideshow
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 86780 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5733 );
 	};
 
 	void TryExitShow ( );
@@ -54706,24 +43917,15 @@ public:
 	void SlideshowFinished ( class USFXSFHandler_Slideshow* slideshow );
 };
 
-UClass* USFXSFHandler_PCSlideshow::pClassPointer = NULL;
-
 // Class SFXGame.sfxsfhandler_ps3achievement
 // 0x0000 (0x02A0 - 0x02A0)
 class Usfxsfhandler_ps3achievement : public Ubiosfhandler_achievement
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 86791 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5734 );
 	};
 
 	bool IsAccomplishmentValid ( struct FAccomplishment* Data );
@@ -54735,24 +43937,15 @@ public:
 	void SetFromMainMenu ( );
 };
 
-UClass* Usfxsfhandler_ps3achievement::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_PS3EANetworking
 // 0x0000 (0x0370 - 0x0370)
 class USFXSFHandler_PS3EANetworking : public USFXSFHandler_EANetworking
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 86796 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5735 );
 	};
 
 	void AS_SetActiveInputField ( struct FString sText );
@@ -54811,24 +44004,15 @@ public:
 	void ShowIntroPage ( );
 };
 
-UClass* USFXSFHandler_PS3EANetworking::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_PS3MainMenu
 // 0x0000 (0x02D1 - 0x02D1)
 class USFXSFHandler_PS3MainMenu : public UBioSFHandler_MainMenu
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 86798 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5736 );
 	};
 
 	void ProcessRankChangeNotifications ( );
@@ -54868,24 +44052,15 @@ public:
 	void OnPanelAdded ( );
 };
 
-UClass* USFXSFHandler_PS3MainMenu::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_PS3NewCharacter
 // 0x0000 (0x04A2 - 0x04A2)
 class USFXSFHandler_PS3NewCharacter : public UBioSFHandler_NewCharacter
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 86808 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5737 );
 	};
 
 	void SetDefaultFemaleME2SaveProperties ( struct FMorphHeadSaveRecord* InProperties );
@@ -54972,24 +44147,15 @@ public:
 	void OnCloseCallback ( );
 };
 
-UClass* USFXSFHandler_PS3NewCharacter::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_PS3Options
 // 0x0000 (0x036E - 0x036E)
 class USFXSFHandler_PS3Options : public UBioSFHandler_Options
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 86811 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5738 );
 	};
 
 	void SaveAndExit ( );
@@ -55025,24 +44191,15 @@ public:
 	void AddTelem ( unsigned char eOptionId, int Value, TArray< struct FTelemetryAttribute >* Attributes, struct FString* TelemetryKey );
 };
 
-UClass* USFXSFHandler_PS3Options::pClassPointer = NULL;
-
 // Class SFXGame.SFXSFHandler_PS3Personalization
 // 0x0000 (0x03AD - 0x03AD)
 class USFXSFHandler_PS3Personalization : public USFXSFHandler_Personalization
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 86813 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5739 );
 	};
 
 	void ASSetDetailedCustomizationVisible ( unsigned long bVisible );
@@ -55086,8 +44243,6 @@ public:
 	void ExternalCallback_OnComplete ( );
 };
 
-UClass* USFXSFHandler_PS3Personalization::pClassPointer = NULL;
-
 // Class SFXGame.sfxshield_player
 // 0x00BA (0x03D0 - 0x0316)
 class Asfxshield_player : public Asfxshield_base
@@ -55105,16 +44260,9 @@ public:
 	class UWwiseEvent*                                 PCShieldsUpSound;                                 		// 0x03C8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	class UWwiseEvent*                                 ShieldBreakPainVoc;                               		// 0x03CC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 86990 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5740 );
 	};
 
 	void BeginRecharge ( );
@@ -55126,24 +44274,15 @@ public:
 	void PrecacheVFX ( class ASFXObjectPool* ObjectPool, class URvrClientEffectManager* ClientEffects );
 };
 
-UClass* Asfxshield_player::pClassPointer = NULL;
-
 // Class SFXGame.SFXSignText
 // 0x0000 (0x01F6 - 0x01F6)
 class ASFXSignText : public AActor
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 87046 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5748 );
 	};
 
 	struct FVector LocalToWorld ( struct FVector vLocal );
@@ -55417,24 +44556,15 @@ public:
 	void ForceUpdateComponents ( unsigned long bCollisionUpdate, unsigned long bTransformOnly );
 };
 
-UClass* ASFXSignText::pClassPointer = NULL;
-
 // Class SFXGame.SFXStealthVolume
 // 0x0000 (0x022C - 0x022C)
 class ASFXStealthVolume : public AVolume
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 87150 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5749 );
 	};
 
 	void eventProcessActorSetVolume ( class AActor* Other );
@@ -55448,24 +44578,15 @@ public:
 	bool Encompasses ( class AActor* Other );
 };
 
-UClass* ASFXStealthVolume::pClassPointer = NULL;
-
 // Class SFXGame.SFXTracer_Bullet
 // 0x0000 (0x0245 - 0x0245)
 class ASFXTracer_Bullet : public ASFXTracer
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 87619 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5763 );
 	};
 
 	void ProcessTouch ( class AActor* Other, struct FVector HitLocation, struct FVector HitNormal );
@@ -55479,24 +44600,15 @@ public:
 	void InitTracer ( struct FVector Start, struct FVector End, struct FVector DesiredScale, float DesiredSpeed );
 };
 
-UClass* ASFXTracer_Bullet::pClassPointer = NULL;
-
 // Class SFXGame.SFXTreasureNode
 // 0x0000 (0x01F6 - 0x01F6)
 class ASFXTreasureNode : public ASFXPointOfInterest
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 87623 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5764 );
 	};
 
 	struct FVector LocalToWorld ( struct FVector vLocal );
@@ -55770,30 +44882,19 @@ public:
 	void ForceUpdateComponents ( unsigned long bCollisionUpdate, unsigned long bTransformOnly );
 };
 
-UClass* ASFXTreasureNode::pClassPointer = NULL;
-
 // Class SFXGame.SFXWallRunReachSpec
 // 0x0000 (0x008C - 0x008C)
 class USFXWallRunReachSpec : public USFXCustomReachSpec
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 87978 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5765 );
 	};
 
 };
 
-UClass* USFXWallRunReachSpec::pClassPointer = NULL;
-
 // Class SFXGame.SFXWaveManager
 // 0x0016 (0x020C - 0x01F6)
 class ASFXWaveManager : public AActor
@@ -55803,16 +44904,9 @@ public:
 	class UClass*                                      PotentialWavesType;                               		// 0x0204 (0x0004) [0x0000000000000000]              
 	class ABioWorldInfo*                               BioWorldInfo;                                     		// 0x0208 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 87988 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5766 );
 	};
 
 	void GeneratePotentialWaveList ( class UClass* SpecifiedWaveType );
@@ -55821,8 +44915,6 @@ public:
 	void eventPostBeginPlay ( );
 };
 
-UClass* ASFXWaveManager::pClassPointer = NULL;
-
 // Class SFXGame.SFXWeaponModUseModule
 // 0x0010 (0x00C0 - 0x00B0)
 class USFXWeaponModUseModule : public USFXModule_SavedUse
@@ -55833,16 +44925,9 @@ public:
 	float                                              UpdateFrequency;                                  		// 0x00B8 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bStopCustomTicking : 1;                           		// 0x00BC (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 88329 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5786 );
 	};
 
 	void DisableWeaponModUseModule ( );
@@ -55852,8 +44937,6 @@ public:
 	void eventHandlePostBeginPlay ( );
 };
 
-UClass* USFXWeaponModUseModule::pClassPointer = NULL;
-
 // Class SFXGame.SFXWeaponModNode
 // 0x000A (0x0200 - 0x01F6)
 class ASFXWeaponModNode : public ASFXPointOfInterest
@@ -55862,23 +44945,14 @@ public:
 	class UStaticMeshComponent*                        SMC;                                              		// 0x01F8 (0x0004) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 	class ULightEnvironmentComponent*                  LightEnvironment;                                 		// 0x01FC (0x0004) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 88354 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5787 );
 	};
 
 	void DisableWeaponModNode ( );
 };
 
-UClass* ASFXWeaponModNode::pClassPointer = NULL;
-
 // Class SFXGame.SFXWeaponNode
 // 0x000A (0x0200 - 0x01F6)
 class ASFXWeaponNode : public ASFXPointOfInterest
@@ -55887,40 +44961,24 @@ public:
 	class USkeletalMeshComponent*                      SMC;                                              		// 0x01F8 (0x0004) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 	class ULightEnvironmentComponent*                  LightEnvironment;                                 		// 0x01FC (0x0004) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 88380 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5788 );
 	};
 
 	void DisableWeaponNode ( );
 	void PostBeginPlay ( );
 };
 
-UClass* ASFXWeaponNode::pClassPointer = NULL;
-
 // Class SFXGame.SFXWeaponUseModule_BonusWeapon
 // 0x0000 (0x00E0 - 0x00E0)
 class USFXWeaponUseModule_BonusWeapon : public USFXWeaponUseModule
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 88426 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5789 );
 	};
 
 	void StartWeaponSelection ( );
@@ -55934,32 +44992,21 @@ public:
 	void eventHandlePostBeginPlay ( );
 };
 
-UClass* USFXWeaponUseModule_BonusWeapon::pClassPointer = NULL;
-
 // Class SFXGame.SFXWeaponNode_BonusWeapon
 // 0x0000 (0x0200 - 0x0200)
 class ASFXWeaponNode_BonusWeapon : public ASFXWeaponNode
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 88440 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5790 );
 	};
 
 	void DisableWeaponNode ( );
 	void PostBeginPlay ( );
 };
 
-UClass* ASFXWeaponNode_BonusWeapon::pClassPointer = NULL;
-
 
 #ifdef _MSC_VER
 	#pragma pack ( pop )
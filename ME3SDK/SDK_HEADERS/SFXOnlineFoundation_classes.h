@@ -628,16 +628,9 @@ public:
 	class USFXOnlineSubsystem*                         OnlineSubsystem;                                  		// 0x005C (0x0004) [0x0000000000000000]              
 	unsigned long                                      NeedsStateMachine : 1;                            		// 0x0060 (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1944 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1944 );
 	};
 
 	bool eventIsXbox360 ( );
@@ -667,8 +660,6 @@ public:
 	void OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem );
 };
 
-UClass* USFXOnlineComponent::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineEvent
 // 0x0028 (0x0064 - 0x003C)
 class USFXOnlineEvent : public UObject
@@ -687,16 +678,9 @@ public:
 	unsigned char                                      Outcome;                                          		// 0x0062 (0x0001) [0x0000000000000000]              
 	unsigned char                                      ErrorContext;                                     		// 0x0063 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2015 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2015 );
 	};
 
 	unsigned char GetEventTypeFromString ( struct FString sEventString );
@@ -736,8 +720,6 @@ public:
 	unsigned char GetEventType ( );
 };
 
-UClass* USFXOnlineEvent::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineEvent_Integer
 // 0x0004 (0x0068 - 0x0064)
 class USFXOnlineEvent_Integer : public USFXOnlineEvent
@@ -745,24 +727,15 @@ class USFXOnlineEvent_Integer : public USFXOnlineEvent
 public:
 	int                                                m_nInteger;                                       		// 0x0064 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2016 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2016 );
 	};
 
 	void SetInteger ( int nInteger );
 	int GetInteger ( );
 };
 
-UClass* USFXOnlineEvent_Integer::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineEvent_Invite
 // 0x0008 (0x006C - 0x0064)
 class USFXOnlineEvent_Invite : public USFXOnlineEvent
@@ -770,22 +743,13 @@ class USFXOnlineEvent_Invite : public USFXOnlineEvent
 public:
 	struct FOnlineGameSearchResult                     SearchResult;                                     		// 0x0064 (0x0008) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2017 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2017 );
 	};
 
 };
 
-UClass* USFXOnlineEvent_Invite::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineEvent_PlatformKeyboardUI
 // 0x0039 (0x009D - 0x0064)
 class USFXOnlineEvent_PlatformKeyboardUI : public USFXOnlineEvent
@@ -800,22 +764,13 @@ public:
 	unsigned long                                      RouteThroughConsole : 1;                          		// 0x0098 (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned char                                      LocalUserNum;                                     		// 0x009C (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2018 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2018 );
 	};
 
 };
 
-UClass* USFXOnlineEvent_PlatformKeyboardUI::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineEvent_QuickMatch
 // 0x0009 (0x006D - 0x0064)
 class USFXOnlineEvent_QuickMatch : public USFXOnlineEvent
@@ -825,22 +780,13 @@ public:
 	int                                                GameId;                                           		// 0x0068 (0x0004) [0x0000000000000000]              
 	unsigned char                                      SearchOutcome;                                    		// 0x006C (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2019 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2019 );
 	};
 
 };
 
-UClass* USFXOnlineEvent_QuickMatch::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineEvent_SeenPlayer
 // 0x0004 (0x0068 - 0x0064)
 class USFXOnlineEvent_SeenPlayer : public USFXOnlineEvent
@@ -848,22 +794,13 @@ class USFXOnlineEvent_SeenPlayer : public USFXOnlineEvent
 public:
 	struct FPointer                                    SeenPlayer;                                       		// 0x0064 (0x0004) [0x0000000000001000]              ( CPF_Native )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2020 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2020 );
 	};
 
 };
 
-UClass* USFXOnlineEvent_SeenPlayer::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineEvent_String
 // 0x000C (0x0070 - 0x0064)
 class USFXOnlineEvent_String : public USFXOnlineEvent
@@ -871,24 +808,15 @@ class USFXOnlineEvent_String : public USFXOnlineEvent
 public:
 	struct FString                                     StringData;                                       		// 0x0064 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2021 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2021 );
 	};
 
 	void SetStringData ( struct FString sStringData );
 	struct FString GetStringData ( );
 };
 
-UClass* USFXOnlineEvent_String::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineEvent_Notification
 // 0x0010 (0x0080 - 0x0070)
 class USFXOnlineEvent_Notification : public USFXOnlineEvent_String
@@ -897,16 +825,9 @@ public:
 	struct FString                                     m_sImageName;                                     		// 0x0070 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	int                                                m_nPriority;                                      		// 0x007C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2022 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2022 );
 	};
 
 	void SetPriority ( int nPriority );
@@ -915,8 +836,6 @@ public:
 	struct FString GetImageName ( );
 };
 
-UClass* USFXOnlineEvent_Notification::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineEvent_Tick
 // 0x000C (0x0070 - 0x0064)
 class USFXOnlineEvent_Tick : public USFXOnlineEvent
@@ -925,22 +844,13 @@ public:
 	struct FDouble                                     LastTickTime;                                     		// 0x0064 (0x0008) [0x0000000000000000]              
 	float                                              DeltaTime;                                        		// 0x006C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2023 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2023 );
 	};
 
 };
 
-UClass* USFXOnlineEvent_Tick::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineEventList
 // 0x000C (0x0048 - 0x003C)
 class USFXOnlineEventList : public UObject
@@ -948,16 +858,9 @@ class USFXOnlineEventList : public UObject
 public:
 	TArray< class USFXOnlineEvent* >                   EventList;                                        		// 0x003C (0x000C) [0x0000000000500000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2024 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2024 );
 	};
 
 	class USFXOnlineEvent* GetNextTimedOutEvent ( );
@@ -969,90 +872,54 @@ public:
 	bool AddEvent ( class USFXOnlineEvent* oEvent );
 };
 
-UClass* USFXOnlineEventList::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.ISFXOnlineComponent
 // 0x0000 (0x003C - 0x003C)
 class UISFXOnlineComponent : public UInterface
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2025 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2025 );
 	};
 
 };
 
-UClass* UISFXOnlineComponent::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.ISFXOnlineComponentAchievement
 // 0x0000 (0x003C - 0x003C)
 class UISFXOnlineComponentAchievement : public UISFXOnlineComponent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2026 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2026 );
 	};
 
 };
 
-UClass* UISFXOnlineComponentAchievement::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.ISFXOnlineComponentAPI
 // 0x0000 (0x003C - 0x003C)
 class UISFXOnlineComponentAPI : public UISFXOnlineComponent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2027 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2027 );
 	};
 
 };
 
-UClass* UISFXOnlineComponentAPI::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.ISFXOnlineComponentCommerce
 // 0x0000 (0x003C - 0x003C)
 class UISFXOnlineComponentCommerce : public UISFXOnlineComponent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2028 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2028 );
 	};
 
 	struct FString DecryptOfflineEntitlementInfo ( );
@@ -1086,24 +953,15 @@ public:
 	void OnRefreshDigitalRightsResult ( int nResult );
 };
 
-UClass* UISFXOnlineComponentCommerce::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar
 // 0x0000 (0x003C - 0x003C)
 class UISFXOnlineComponentGalaxyAtWar : public UISFXOnlineComponent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2029 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2029 );
 	};
 
 	void eventSetBaseURL ( struct FString BaseUrl );
@@ -1134,90 +992,54 @@ public:
 	void AuthenticateCompleted ( int errorCode );
 };
 
-UClass* UISFXOnlineComponentGalaxyAtWar::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.ISFXOnlineComponentGame
 // 0x0000 (0x003C - 0x003C)
 class UISFXOnlineComponentGame : public UISFXOnlineComponent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2030 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2030 );
 	};
 
 };
 
-UClass* UISFXOnlineComponentGame::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.ISFXOnlineComponentGameEntryFlow
 // 0x0000 (0x003C - 0x003C)
 class UISFXOnlineComponentGameEntryFlow : public UISFXOnlineComponent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2031 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2031 );
 	};
 
 };
 
-UClass* UISFXOnlineComponentGameEntryFlow::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.ISFXOnlineComponentGameFlow
 // 0x0000 (0x003C - 0x003C)
 class UISFXOnlineComponentGameFlow : public UISFXOnlineComponent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2032 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2032 );
 	};
 
 };
 
-UClass* UISFXOnlineComponentGameFlow::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.ISFXOnlineComponentLeaderboard
 // 0x0000 (0x003C - 0x003C)
 class UISFXOnlineComponentLeaderboard : public UISFXOnlineComponent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2033 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2033 );
 	};
 
 	bool HasNotificationsAvailable ( );
@@ -1242,24 +1064,15 @@ public:
 	void OnResultsRetrieved ( TArray< struct FLeaderboardColumn > aColumnInfo, TArray< struct FLeaderboardRecord > aResults, int iTotalRanks, struct FUniqueNetId uidEntity, unsigned char nErrorCode, struct FPointer pExternalData );
 };
 
-UClass* UISFXOnlineComponentLeaderboard::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.ISFXOnlineComponentLogin
 // 0x0000 (0x003C - 0x003C)
 class UISFXOnlineComponentLogin : public UISFXOnlineComponent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2034 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2034 );
 	};
 
 	void SetExternalDRMDataLoaded ( unsigned long bValue );
@@ -1318,112 +1131,67 @@ public:
 	unsigned char GetLoginStatus ( );
 };
 
-UClass* UISFXOnlineComponentLogin::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.ISFXOnlineComponentMatchMakingBot
 // 0x0000 (0x003C - 0x003C)
 class UISFXOnlineComponentMatchMakingBot : public UISFXOnlineComponent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2035 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2035 );
 	};
 
 };
 
-UClass* UISFXOnlineComponentMatchMakingBot::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.ISFXOnlineComponentMessaging
 // 0x0000 (0x003C - 0x003C)
 class UISFXOnlineComponentMessaging : public UISFXOnlineComponent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2036 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2036 );
 	};
 
 };
 
-UClass* UISFXOnlineComponentMessaging::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.ISFXOnlineComponentNotification
 // 0x0000 (0x003C - 0x003C)
 class UISFXOnlineComponentNotification : public UISFXOnlineComponent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2037 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2037 );
 	};
 
 };
 
-UClass* UISFXOnlineComponentNotification::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.ISFXOnlineComponentPlatform
 // 0x0000 (0x003C - 0x003C)
 class UISFXOnlineComponentPlatform : public UISFXOnlineComponent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2038 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2038 );
 	};
 
 };
 
-UClass* UISFXOnlineComponentPlatform::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.ISFXOnlineComponentStats
 // 0x0000 (0x003C - 0x003C)
 class UISFXOnlineComponentStats : public UISFXOnlineComponent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2039 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2039 );
 	};
 
 	int ReadStatsGroupList ( );
@@ -1433,24 +1201,15 @@ public:
 	void OnResultsRetrieved ( TArray< struct FLeaderboardColumn > aColumnInfo, TArray< struct FLeaderboardRecord > aResults, unsigned char nErrorCode, struct FPointer pExternalData );
 };
 
-UClass* UISFXOnlineComponentStats::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.ISFXOnlineComponentTelemetry
 // 0x0000 (0x003C - 0x003C)
 class UISFXOnlineComponentTelemetry : public UISFXOnlineComponent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2040 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2040 );
 	};
 
 	void Flush ( unsigned char Channel );
@@ -1460,52 +1219,32 @@ public:
 	bool CanCollect ( );
 };
 
-UClass* UISFXOnlineComponentTelemetry::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.ISFXOnlineComponentUserInterface
 // 0x0000 (0x003C - 0x003C)
 class UISFXOnlineComponentUserInterface : public UISFXOnlineComponent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2041 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2041 );
 	};
 
 };
 
-UClass* UISFXOnlineComponentUserInterface::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineDefine
 // 0x0000 (0x003C - 0x003C)
 class USFXOnlineDefine : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2042 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2042 );
 	};
 
 };
 
-UClass* USFXOnlineDefine::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentGameFlow
 // 0x0032 (0x0096 - 0x0064)
 class USFXOnlineComponentGameFlow : public USFXOnlineComponent
@@ -1521,16 +1260,9 @@ public:
 	unsigned char                                      m_JoinFailureReason;                              		// 0x0094 (0x0001) [0x0000000000000000]              
 	unsigned char                                      m_MatchMakingTimeStatus;                          		// 0x0095 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2043 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2043 );
 	};
 
 	void GM_OnQuickMatchUpdateEvent ( class USFXOnlineEvent_QuickMatch* qmEvent );
@@ -1583,8 +1315,6 @@ public:
 	struct FString eventGetStateStr ( );
 };
 
-UClass* USFXOnlineComponentGameFlow::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentHTTPManager
 // 0x0031 (0x0095 - 0x0064)
 class USFXOnlineComponentHTTPManager : public USFXOnlineComponent
@@ -1602,16 +1332,9 @@ public:
 	unsigned long                                      mServiceStarted : 1;                              		// 0x0090 (0x0004) [0x0000000000001000] [0x00000001] ( CPF_Native )
 	unsigned char                                      mState;                                           		// 0x0094 (0x0001) [0x0000000000001000]              ( CPF_Native )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2044 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2044 );
 	};
 
 	void OnDownloadingTick ( );
@@ -1628,8 +1351,6 @@ public:
 	void OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem );
 };
 
-UClass* USFXOnlineComponentHTTPManager::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentImageManager
 // 0x003C (0x00A0 - 0x0064)
 class USFXOnlineComponentImageManager : public USFXOnlineComponent
@@ -1643,16 +1364,9 @@ public:
 	int                                                mMaxImages;                                       		// 0x0098 (0x0004) [0x0000000000000000]              
 	int                                                mMaxBytes;                                        		// 0x009C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2045 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2045 );
 	};
 
 	void OnJobComplete ( class USFXOnlineHTTPRequest* request );
@@ -1674,8 +1388,6 @@ public:
 	void eventSetBaseURL ( struct FString BaseUrl );
 };
 
-UClass* USFXOnlineComponentImageManager::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx
 // 0x008C (0x00F0 - 0x0064)
 class USFXOnlineComponentUnrealPlayerEx : public USFXOnlineComponent
@@ -1686,16 +1398,9 @@ public:
 	struct FScriptDelegate                             __OnDeviceSelectionComplete__Delegate;            		// 0x00D8 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	struct FScriptDelegate                             __OnProfileDataChanged__Delegate;                 		// 0x00E4 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2046 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2046 );
 	};
 
 	bool UnlockAvatarAward ( unsigned char LocalUserNum, int AvatarItemId );
@@ -1725,8 +1430,6 @@ public:
 	void OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem );
 };
 
-UClass* USFXOnlineComponentUnrealPlayerEx::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentUnrealSystem
 // 0x00A1 (0x0105 - 0x0064)
 class USFXOnlineComponentUnrealSystem : public USFXOnlineComponent
@@ -1748,16 +1451,9 @@ public:
 	struct FScriptDelegate                             __OnReadTitleFileComplete__Delegate;              		// 0x00F8 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	unsigned char                                      CurrentNotificationPosition;                      		// 0x0104 (0x0001) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2047 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2047 );
 	};
 
 	unsigned char GetTitleFileState ( struct FString Filename );
@@ -1792,8 +1488,6 @@ public:
 	void OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem );
 };
 
-UClass* USFXOnlineComponentUnrealSystem::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentVoiceInterface
 // 0x0048 (0x00AC - 0x0064)
 class USFXOnlineComponentVoiceInterface : public USFXOnlineComponent
@@ -1807,16 +1501,9 @@ public:
 	struct FPointer                                    VoiceEngine;                                      		// 0x0098 (0x0004) [0x0000000000001000]              ( CPF_Native )
 	struct FLocalTalker                                LocalTalkers[ 0x4 ];                              		// 0x009C (0x0010) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2048 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2048 );
 	};
 
 	void ClearPlayerTalkingDelegate ( struct FScriptDelegate TalkerDelegate );
@@ -1864,8 +1551,6 @@ public:
 	void OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem );
 };
 
-UClass* USFXOnlineComponentVoiceInterface::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentXMLParser
 // 0x0008 (0x006C - 0x0064)
 class USFXOnlineComponentXMLParser : public USFXOnlineComponent
@@ -1874,16 +1559,9 @@ public:
 	struct FPointer                                    VfTable_IISFXOnlineComponent;                     		// 0x0064 (0x0004) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 	struct FPointer                                    mXmlSource;                                       		// 0x0068 (0x0004) [0x0000000000001000]              ( CPF_Native )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2049 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2049 );
 	};
 
 	struct FName GetAPIName ( );
@@ -1896,8 +1574,6 @@ public:
 	void StartParsing ( struct FString xmlInput );
 };
 
-UClass* USFXOnlineComponentXMLParser::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentCoordinator
 // 0x0018 (0x0054 - 0x003C)
 class USFXOnlineComponentCoordinator : public UObject
@@ -1908,16 +1584,9 @@ public:
 	class USFXOnlineEventList*                         EventList;                                        		// 0x004C (0x0004) [0x0000000000000000]              
 	class USFXOnlineEventNotifier*                     EventNotifier;                                    		// 0x0050 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2050 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2050 );
 	};
 
 	struct FName GetAPIName ( );
@@ -1946,8 +1615,6 @@ public:
 	void OnEvent ( class USFXOnlineEvent* oEvent );
 };
 
-UClass* USFXOnlineComponentCoordinator::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineEventNotifier
 // 0x02B0 (0x02EC - 0x003C)
 class USFXOnlineEventNotifier : public UObject
@@ -1959,16 +1626,9 @@ public:
 	struct FScriptDelegate                             __OnEvent__Delegate;                              		// 0x02DC (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	unsigned long                                      bQueuingEnabled : 1;                              		// 0x02E8 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2051 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2051 );
 	};
 
 	void NotifyCallbacks ( TArray< struct FScriptDelegate > NotifyArray, class USFXOnlineEvent* Event );
@@ -1983,8 +1643,6 @@ public:
 	void OnEvent ( class USFXOnlineEvent* Event );
 };
 
-UClass* USFXOnlineEventNotifier::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineHTTPRequest
 // 0x0061 (0x009D - 0x003C)
 class USFXOnlineHTTPRequest : public UObject
@@ -2006,16 +1664,9 @@ public:
 	unsigned long                                      mInProgress : 1;                                  		// 0x0098 (0x0004) [0x0000000000000000] [0x00000010] 
 	unsigned char                                      mRequestType;                                     		// 0x009C (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2052 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2052 );
 	};
 
 	struct FString eventGenerateParametersString ( );
@@ -2032,8 +1683,6 @@ public:
 	struct FString URLEncodeString ( struct FString InputString );
 };
 
-UClass* USFXOnlineHTTPRequest::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineSubsystem
 // 0x0164 (0x0224 - 0x00C0)
 class USFXOnlineSubsystem : public UOnlineSubsystem
@@ -2051,16 +1700,9 @@ public:
 	class USFXOnlineEvent_Tick*                        TickEvent;                                        		// 0x021C (0x0004) [0x0000000000000000]              
 	int                                                IniVersionId;                                     		// 0x0220 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2053 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2053 );
 	};
 
 	unsigned char GetEnvironment ( );
@@ -2114,8 +1756,6 @@ public:
 	bool eventInit ( );
 };
 
-UClass* USFXOnlineSubsystem::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.sfxonlinecomponentachievementpc
 // 0x0004 (0x0068 - 0x0064)
 class Usfxonlinecomponentachievementpc : public USFXOnlineComponent
@@ -2123,16 +1763,9 @@ class Usfxonlinecomponentachievementpc : public USFXOnlineComponent
 public:
 	struct FPointer                                    VfTable_IISFXOnlineComponentAchievement;          		// 0x0064 (0x0004) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2054 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2054 );
 	};
 
 	struct FName GetAPIName ( );
@@ -2142,8 +1775,6 @@ public:
 	void Grant ( unsigned char LocalUserNum, int AchievementId );
 };
 
-UClass* Usfxonlinecomponentachievementpc::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentOrigin
 // 0x012D (0x0191 - 0x0064)
 class USFXOnlineComponentOrigin : public USFXOnlineComponent
@@ -2194,16 +1825,9 @@ public:
 	unsigned long                                      mPendingInviteJoin : 1;                           		// 0x018C (0x0004) [0x0000000000001000] [0x00000800] ( CPF_Native )
 	unsigned char                                      mPresenceState;                                   		// 0x0190 (0x0001) [0x0000000000001000]              ( CPF_Native )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2055 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2055 );
 	};
 
 	bool ProcessAchievementQueue ( );
@@ -2257,8 +1881,6 @@ public:
 	void OnOriginClosedDelegate ( );
 };
 
-UClass* USFXOnlineComponentOrigin::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentPlatformPC
 // 0x0010 (0x0074 - 0x0064)
 class USFXOnlineComponentPlatformPC : public USFXOnlineComponent
@@ -2267,16 +1889,9 @@ public:
 	struct FPointer                                    VfTable_IISFXOnlineComponentPlatform;             		// 0x0064 (0x0004) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 	TArray< struct FOnlineFriend >                     CachedFriendListPC;                               		// 0x0068 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2056 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2056 );
 	};
 
 	bool ShowInbox ( );
@@ -2309,8 +1924,6 @@ public:
 	void OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem );
 };
 
-UClass* USFXOnlineComponentPlatformPC::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentAchievementXenon
 // 0x0004 (0x0068 - 0x0064)
 class USFXOnlineComponentAchievementXenon : public USFXOnlineComponent
@@ -2318,16 +1931,9 @@ class USFXOnlineComponentAchievementXenon : public USFXOnlineComponent
 public:
 	struct FPointer                                    VfTable_IISFXOnlineComponentAchievement;          		// 0x0064 (0x0004) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2057 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2057 );
 	};
 
 	struct FName GetAPIName ( );
@@ -2337,8 +1943,6 @@ public:
 	void Grant ( unsigned char LocalUserNum, int AchievementId );
 };
 
-UClass* USFXOnlineComponentAchievementXenon::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentAvatarAwardXenon
 // 0x0004 (0x0068 - 0x0064)
 class USFXOnlineComponentAvatarAwardXenon : public USFXOnlineComponent
@@ -2346,16 +1950,9 @@ class USFXOnlineComponentAvatarAwardXenon : public USFXOnlineComponent
 public:
 	struct FPointer                                    VfTable_IISFXOnlineComponent;                     		// 0x0064 (0x0004) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2058 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2058 );
 	};
 
 	struct FName GetAPIName ( );
@@ -2364,8 +1961,6 @@ public:
 	void Grant ( unsigned char LocalUserNum, int AvatarAwardId );
 };
 
-UClass* USFXOnlineComponentAvatarAwardXenon::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentPlatformXenon
 // 0x008D (0x00F1 - 0x0064)
 class USFXOnlineComponentPlatformXenon : public USFXOnlineComponent
@@ -2386,16 +1981,9 @@ public:
 	unsigned long                                      bIsCountingDownSigninNotification : 1;            		// 0x00EC (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 	unsigned char                                      CachedLocalUserNumForAsyncRequest;                		// 0x00F0 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2059 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2059 );
 	};
 
 	bool ShowInbox ( );
@@ -2432,8 +2020,6 @@ public:
 	void OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem );
 };
 
-UClass* USFXOnlineComponentPlatformXenon::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentXenonLiveParty
 // 0x005C (0x00C0 - 0x0064)
 class USFXOnlineComponentXenonLiveParty : public USFXOnlineComponent
@@ -2447,16 +2033,9 @@ public:
 	int                                                BandwidthUsed;                                    		// 0x00B8 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	float                                              ElapsedTime;                                      		// 0x00BC (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2060 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2060 );
 	};
 
 	void OnTick ( class USFXOnlineEvent* oEvent );
@@ -2476,8 +2055,6 @@ public:
 	void OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem );
 };
 
-UClass* USFXOnlineComponentXenonLiveParty::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentAchievementPS3
 // 0x0004 (0x0068 - 0x0064)
 class USFXOnlineComponentAchievementPS3 : public USFXOnlineComponent
@@ -2485,16 +2062,9 @@ class USFXOnlineComponentAchievementPS3 : public USFXOnlineComponent
 public:
 	struct FPointer                                    VfTable_IISFXOnlineComponentAchievement;          		// 0x0064 (0x0004) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2061 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2061 );
 	};
 
 	struct FName GetAPIName ( );
@@ -2504,8 +2074,6 @@ public:
 	void Grant ( unsigned char LocalUserNum, int AchievementId );
 };
 
-UClass* USFXOnlineComponentAchievementPS3::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentPlatformPS3
 // 0x0044 (0x00A8 - 0x0064)
 class USFXOnlineComponentPlatformPS3 : public USFXOnlineComponent
@@ -2523,16 +2091,9 @@ public:
 	unsigned long                                      mDispatchInviteOnNextTick : 1;                    		// 0x00A4 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      m_bLaunchedSignInUI : 1;                          		// 0x00A4 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2062 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2062 );
 	};
 
 	bool ShowInbox ( );
@@ -2574,46 +2135,28 @@ public:
 	void OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem );
 };
 
-UClass* USFXOnlineComponentPlatformPS3::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineBlazeJobUtilities
 // 0x0000 (0x003C - 0x003C)
 class USFXOnlineBlazeJobUtilities : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2063 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2063 );
 	};
 
 };
 
-UClass* USFXOnlineBlazeJobUtilities::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentBlaze
 // 0x0000 (0x0064 - 0x0064)
 class USFXOnlineComponentBlaze : public USFXOnlineComponent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2064 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2064 );
 	};
 
 	bool eventIsXbox360 ( );
@@ -2643,8 +2186,6 @@ public:
 	void OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem );
 };
 
-UClass* USFXOnlineComponentBlaze::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentBlazeGame
 // 0x01DC (0x0240 - 0x0064)
 class USFXOnlineComponentBlazeGame : public USFXOnlineComponentBlaze
@@ -2719,16 +2260,9 @@ public:
 	unsigned long                                      m_LocalPlayerWasKicked : 1;                       		// 0x023C (0x0004) [0x0000000000000000] [0x00001000] 
 	unsigned long                                      m_LeaveGamePending : 1;                           		// 0x023C (0x0004) [0x0000000000000000] [0x00002000] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2065 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2065 );
 	};
 
 	void SetKickedOutOfGame ( unsigned long wasKicked );
@@ -2844,8 +2378,6 @@ public:
 	void OnQuickMatchComplete ( unsigned char Result );
 };
 
-UClass* USFXOnlineComponentBlazeGame::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentBlazeGameXenon
 // 0x0010 (0x0250 - 0x0240)
 class USFXOnlineComponentBlazeGameXenon : public USFXOnlineComponentBlazeGame
@@ -2856,16 +2388,9 @@ public:
 	float                                              m_NextAllowedRestrictedFunctionCallTime;          		// 0x0248 (0x0004) [0x0000000000000000]              
 	unsigned long                                      m_CallRestrictedFunctionMode : 1;                 		// 0x024C (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2066 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2066 );
 	};
 
 	void SetPlatformPresence ( unsigned long presencePrivate );
@@ -2875,8 +2400,6 @@ public:
 	void OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem );
 };
 
-UClass* USFXOnlineComponentBlazeGameXenon::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentBlazeHub
 // 0x0035 (0x0099 - 0x0064)
 class USFXOnlineComponentBlazeHub : public USFXOnlineComponentBlaze
@@ -2894,16 +2417,9 @@ public:
 	unsigned long                                      ForceDisableSecureMode : 1;                       		// 0x0094 (0x0004) [0x0000000000004002] [0x00000002] ( CPF_Const | CPF_Config )
 	unsigned char                                      BlazeEnv;                                         		// 0x0098 (0x0001) [0x0000000000004002]              ( CPF_Const | CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2067 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2067 );
 	};
 
 	void OnTick ( class USFXOnlineEvent* oEvent );
@@ -2916,8 +2432,6 @@ public:
 	void OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem );
 };
 
-UClass* USFXOnlineComponentBlazeHub::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard
 // 0x0120 (0x0184 - 0x0064)
 class USFXOnlineComponentBlazeLeaderboard : public USFXOnlineComponentBlaze
@@ -2956,16 +2470,9 @@ public:
 	int                                                ChallengePointsGlobal_LeaderboardDefinitionIndex; 		// 0x017C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned long                                      bCacheFriendRankHistory : 1;                      		// 0x0180 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2068 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2068 );
 	};
 
 	void eventTriggerEmptyCallback ( unsigned char nErrorCode );
@@ -3007,8 +2514,6 @@ public:
 	void OnResultsRetrieved ( TArray< struct FLeaderboardColumn > aColumnInfo, TArray< struct FLeaderboardRecord > aResults, int iTotalRanks, struct FUniqueNetId uidEntity, unsigned char nErrorCode, struct FPointer pExternalData );
 };
 
-UClass* USFXOnlineComponentBlazeLeaderboard::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentBlazeLogin
 // 0x00E5 (0x0149 - 0x0064)
 class USFXOnlineComponentBlazeLogin : public USFXOnlineComponentBlaze
@@ -3059,16 +2564,9 @@ public:
 	unsigned long                                      WaitingForSubmitNucleusWelcomeMessage : 1;        		// 0x0144 (0x0004) [0x0000000000000000] [0x00004000] 
 	unsigned char                                      PendingConnectMode;                               		// 0x0148 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2069 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2069 );
 	};
 
 	void SetExternalDRMDataLoaded ( unsigned long bValue );
@@ -3149,24 +2647,15 @@ public:
 	void OnAuthTokenRetrieved ( struct FString token );
 };
 
-UClass* USFXOnlineComponentBlazeLogin::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentBlazeLoginPC
 // 0x0000 (0x0149 - 0x0149)
 class USFXOnlineComponentBlazeLoginPC : public USFXOnlineComponentBlazeLogin
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2070 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2070 );
 	};
 
 	void SetExternalDRMDataLoaded ( unsigned long bValue );
@@ -3247,24 +2736,15 @@ public:
 	void OnAuthTokenRetrieved ( struct FString token );
 };
 
-UClass* USFXOnlineComponentBlazeLoginPC::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentBlazeLoginPS3
 // 0x0000 (0x0149 - 0x0149)
 class USFXOnlineComponentBlazeLoginPS3 : public USFXOnlineComponentBlazeLogin
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2071 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2071 );
 	};
 
 	void SetExternalDRMDataLoaded ( unsigned long bValue );
@@ -3345,8 +2825,6 @@ public:
 	void OnAuthTokenRetrieved ( struct FString token );
 };
 
-UClass* USFXOnlineComponentBlazeLoginPS3::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentBlazeLoginXenon
 // 0x000F (0x0158 - 0x0149)
 class USFXOnlineComponentBlazeLoginXenon : public USFXOnlineComponentBlazeLogin
@@ -3354,16 +2832,9 @@ class USFXOnlineComponentBlazeLoginXenon : public USFXOnlineComponentBlazeLogin
 public:
 	struct FScriptDelegate                             __OnExternalUIChange__Delegate;                   		// 0x014C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2072 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2072 );
 	};
 
 	void XenonLoginResult ( unsigned long isOpening );
@@ -3372,8 +2843,6 @@ public:
 	bool HasInternetConnection ( );
 };
 
-UClass* USFXOnlineComponentBlazeLoginXenon::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentBlazeMessaging
 // 0x001C (0x0080 - 0x0064)
 class USFXOnlineComponentBlazeMessaging : public USFXOnlineComponentBlaze
@@ -3385,16 +2854,9 @@ public:
 	struct FPointer                                    mMessagingAPI;                                    		// 0x0078 (0x0004) [0x0000000000001000]              ( CPF_Native )
 	void*                                              mAchievementMsgStrRef;                            		// 0x007C (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2073 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2073 );
 	};
 
 	class USFXOnlineJobPurgeMessages* eventCreatePurgeMessagesJob ( int InMapId );
@@ -3410,8 +2872,6 @@ public:
 	void FetchAllMessages ( );
 };
 
-UClass* USFXOnlineComponentBlazeMessaging::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentBlazeNotification
 // 0x0055 (0x00B9 - 0x0064)
 class USFXOnlineComponentBlazeNotification : public USFXOnlineComponentBlaze
@@ -3435,16 +2895,9 @@ public:
 	unsigned long                                      bSkipLiveINIUpdateOnLogin : 1;                    		// 0x00B4 (0x0004) [0x0000000000004000] [0x00000008] ( CPF_Config )
 	unsigned char                                      m_CurrentDownloadStep;                            		// 0x00B8 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2074 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2074 );
 	};
 
 	void GetGalaxyAtWarRatingsCompleted ( TArray< int > updatedSecurityRatings, TArray< int > updatedWarAssets, int Level, int errorCode );
@@ -3477,8 +2930,6 @@ public:
 	void OnTick ( class USFXOnlineEvent* oEvent );
 };
 
-UClass* USFXOnlineComponentBlazeNotification::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentBlazeStats
 // 0x0084 (0x00E8 - 0x0064)
 class USFXOnlineComponentBlazeStats : public USFXOnlineComponentBlaze
@@ -3500,16 +2951,9 @@ public:
 	void*                                              srRankColumnHeader;                               		// 0x00E0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	void*                                              srUserColumnHeader;                               		// 0x00E4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2075 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2075 );
 	};
 
 	void GameReportingCallback ( unsigned char eError, int nJob );
@@ -3548,8 +2992,6 @@ public:
 	void OnResultsRetrieved ( TArray< struct FLeaderboardColumn > aColumnInfo, TArray< struct FLeaderboardRecord > aResults, unsigned char nErrorCode, struct FPointer pExternalData );
 };
 
-UClass* USFXOnlineComponentBlazeStats::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar
 // 0x0094 (0x00F8 - 0x0064)
 class USFXOnlineComponentGalaxyAtWar : public USFXOnlineComponentBlaze
@@ -3572,16 +3014,9 @@ public:
 	unsigned long                                      m_CachedRatingsValid : 1;                         		// 0x00F4 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      m_CachedWarAssetsValid : 1;                       		// 0x00F4 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2076 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2076 );
 	};
 
 	void TestGetRatingsCallback ( TArray< int > updatedSecurityRatings, TArray< int > updatedWarAssets, int Level, int errorCode );
@@ -3625,8 +3060,6 @@ public:
 	void AuthenticateCompleted ( int errorCode );
 };
 
-UClass* USFXOnlineComponentGalaxyAtWar::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentBlazeTelemetry
 // 0x0034 (0x0098 - 0x0064)
 class USFXOnlineComponentBlazeTelemetry : public USFXOnlineComponent
@@ -3639,16 +3072,9 @@ public:
 	struct FScriptDelegate                             __OnDisconnect__Delegate;                         		// 0x0084 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	int                                                bConnectedToChannel[ 0x2 ];                       		// 0x0090 (0x0008) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2077 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2077 );
 	};
 
 	void OnTick ( class USFXOnlineEvent* oEvent );
@@ -3662,8 +3088,6 @@ public:
 	void OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem );
 };
 
-UClass* USFXOnlineComponentBlazeTelemetry::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentJobQueue
 // 0x0068 (0x00CC - 0x0064)
 class USFXOnlineComponentJobQueue : public USFXOnlineComponent
@@ -3678,16 +3102,9 @@ public:
 	int                                                NextJobId;                                        		// 0x00C4 (0x0004) [0x0000000000000000]              
 	unsigned long                                      SkipJobProcessing : 1;                            		// 0x00C8 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2078 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2078 );
 	};
 
 	void OnTick ( class USFXOnlineEvent* OnlineEvent );
@@ -3710,8 +3127,6 @@ public:
 	void SetJobThrottle ( unsigned char Category, int valueMS );
 };
 
-UClass* USFXOnlineComponentJobQueue::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer
 // 0x02E8 (0x034C - 0x0064)
 class USFXOnlineComponentUnrealPlayer : public USFXOnlineComponent
@@ -3758,16 +3173,9 @@ public:
 	struct FScriptDelegate                             __OnUnlockAchievementComplete__Delegate;          		// 0x0330 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	class UOnlinePlayerStorage*                        PlayerStorageCache[ 0x4 ];                        		// 0x033C (0x0010) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2079 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2079 );
 	};
 
 	void ClearOnlineProfileCaches ( );
@@ -3897,32 +3305,21 @@ public:
 	void OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem );
 };
 
-UClass* USFXOnlineComponentUnrealPlayer::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineGameSearch
 // 0x0000 (0x0104 - 0x0104)
 class USFXOnlineGameSearch : public UOnlineGameSearch
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2080 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2080 );
 	};
 
 	void eventSortSearchResults ( );
 	void SetSkillOverride ( int LeaderboardId, TArray< struct FUniqueNetId >* Players );
 };
 
-UClass* USFXOnlineGameSearch::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineGameSettings
 // 0x008D (0x014E - 0x00C1)
 class USFXOnlineGameSettings : public UOnlineGameSettings
@@ -3948,16 +3345,9 @@ public:
 	unsigned char                                      Difficulty;                                       		// 0x014C (0x0001) [0x0000000000000000]              
 	unsigned char                                      mPrivacySetting;                                  		// 0x014D (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2081 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2081 );
 	};
 
 	struct FString ToString ( );
@@ -3972,8 +3362,6 @@ public:
 	unsigned char eventGetPrivacy ( );
 };
 
-UClass* USFXOnlineGameSettings::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineJob
 // 0x001F (0x005B - 0x003C)
 class USFXOnlineJob : public UObject
@@ -3989,16 +3377,9 @@ public:
 	unsigned char                                      JobCategory;                                      		// 0x0059 (0x0001) [0x0000000000004000]              ( CPF_Config )
 	unsigned char                                      JobType;                                          		// 0x005A (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2082 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2082 );
 	};
 
 	int GetSchedulingsLeft ( );
@@ -4020,8 +3401,6 @@ public:
 	void Execute ( );
 };
 
-UClass* USFXOnlineJob::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineJobGameReporting
 // 0x001D (0x0078 - 0x005B)
 class USFXOnlineJobGameReporting : public USFXOnlineJob
@@ -4031,16 +3410,9 @@ public:
 	struct FScriptDelegate                             __GameReportingCallback__Delegate;                		// 0x0068 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	struct FPointer                                    mGameReport;                                      		// 0x0074 (0x0004) [0x0000000000001000]              ( CPF_Native )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2083 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2083 );
 	};
 
 	class USFXOnlineJobGameReporting* eventCreateJob ( struct FScriptDelegate InCallback, class UOnlineStatsWrite* StatsWrite );
@@ -4051,8 +3423,6 @@ public:
 	void GameReportingCallback ( unsigned char errorCode, int InJobId );
 };
 
-UClass* USFXOnlineJobGameReporting::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineJobGaWHTTPRequest
 // 0x0011 (0x006C - 0x005B)
 class USFXOnlineJobGaWHTTPRequest : public USFXOnlineJob
@@ -4064,16 +3434,9 @@ public:
 	unsigned long                                      bKickedOffAuthRequest : 1;                        		// 0x0068 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      bKickedOffSecondRequest : 1;                      		// 0x0068 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2084 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2084 );
 	};
 
 	bool eventAuthorizationFailed ( );
@@ -4090,8 +3453,6 @@ public:
 	void HandleSecondHTTPResult ( );
 };
 
-UClass* USFXOnlineJobGaWHTTPRequest::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineJobGaWHTTPGetMessages
 // 0x0010 (0x007C - 0x006C)
 class USFXOnlineJobGaWHTTPGetMessages : public USFXOnlineJobGaWHTTPRequest
@@ -4100,16 +3461,9 @@ public:
 	struct FScriptDelegate                             __OnGetMessagesComplete__Delegate;                		// 0x006C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	int                                                mMsgType;                                         		// 0x0078 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2085 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2085 );
 	};
 
 	void OnRelease ( );
@@ -4120,8 +3474,6 @@ public:
 	void OnGetMessagesComplete ( TArray< struct FMessageEntry > Messages, int errorCode );
 };
 
-UClass* USFXOnlineJobGaWHTTPGetMessages::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineJobGaWHTTPGetRatings
 // 0x0014 (0x0080 - 0x006C)
 class USFXOnlineJobGaWHTTPGetRatings : public USFXOnlineJobGaWHTTPRequest
@@ -4131,16 +3483,9 @@ public:
 	int                                                MaxSecurityRating;                                		// 0x0078 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	unsigned long                                      getWarAssets : 1;                                 		// 0x007C (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2086 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2086 );
 	};
 
 	void OnRelease ( );
@@ -4151,8 +3496,6 @@ public:
 	void OnGetRatingsComplete ( TArray< int > updatedSecurityRatings, TArray< int > updatedWarAssets, int Level, int errorCode );
 };
 
-UClass* USFXOnlineJobGaWHTTPGetRatings::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineJobGaWHTTPIncreaseRatings
 // 0x0028 (0x0094 - 0x006C)
 class USFXOnlineJobGaWHTTPIncreaseRatings : public USFXOnlineJobGaWHTTPRequest
@@ -4163,16 +3506,9 @@ public:
 	struct FScriptDelegate                             __OnIncreaseRatingsComplete__Delegate;            		// 0x0084 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	int                                                defaultRatingIncrease;                            		// 0x0090 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2087 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2087 );
 	};
 
 	void OnRelease ( );
@@ -4183,8 +3519,6 @@ public:
 	void OnIncreaseRatingsComplete ( TArray< int > updatedSecurityRatings, TArray< int > updatedWarAssets, int Level, int errorCode );
 };
 
-UClass* USFXOnlineJobGaWHTTPIncreaseRatings::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineJobGaWHTTPSendMessage
 // 0x0034 (0x00A0 - 0x006C)
 class USFXOnlineJobGaWHTTPSendMessage : public USFXOnlineJobGaWHTTPRequest
@@ -4196,16 +3530,9 @@ public:
 	struct FScriptDelegate                             __OnSendMessageComplete__Delegate;                		// 0x0090 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	int                                                mMsgType;                                         		// 0x009C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2088 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2088 );
 	};
 
 	void OnRelease ( );
@@ -4216,8 +3543,6 @@ public:
 	void OnSendMessageComplete ( int messageId, TArray< int > messageIds, int errorCode );
 };
 
-UClass* USFXOnlineJobGaWHTTPSendMessage::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineJobGaWHTTPTouchMessages
 // 0x0010 (0x007C - 0x006C)
 class USFXOnlineJobGaWHTTPTouchMessages : public USFXOnlineJobGaWHTTPRequest
@@ -4226,16 +3551,9 @@ public:
 	struct FScriptDelegate                             __OnTouchMessagesComplete__Delegate;              		// 0x006C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	int                                                mMsgType;                                         		// 0x0078 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2089 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2089 );
 	};
 
 	void OnRelease ( );
@@ -4246,8 +3564,6 @@ public:
 	void OnTouchMessagesComplete ( int Count, int errorCode );
 };
 
-UClass* USFXOnlineJobGaWHTTPTouchMessages::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineJobGetAuthToken
 // 0x000D (0x0068 - 0x005B)
 class USFXOnlineJobGetAuthToken : public USFXOnlineJob
@@ -4255,16 +3571,9 @@ class USFXOnlineJobGetAuthToken : public USFXOnlineJob
 public:
 	struct FScriptDelegate                             __OnAuthTokenRetrieved__Delegate;                 		// 0x005C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2090 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2090 );
 	};
 
 	class USFXOnlineJobGetAuthToken* eventCreateGetAuthTokenJob ( struct FScriptDelegate AuthTokenRetrievedDelegate );
@@ -4272,8 +3581,6 @@ public:
 	bool DoExecute ( );
 };
 
-UClass* USFXOnlineJobGetAuthToken::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineJobGetLeaderboardData
 // 0x0041 (0x009C - 0x005B)
 class USFXOnlineJobGetLeaderboardData : public USFXOnlineJob
@@ -4290,16 +3597,9 @@ public:
 	unsigned long                                      bCenteredLeaderboard : 1;                         		// 0x0098 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      bFriendLeaderboard : 1;                           		// 0x0098 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2091 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2091 );
 	};
 
 	class USFXOnlineJobGetLeaderboardData* eventCreateFriendStatsDataJob ( struct FLeaderboardStatScope oScope, int RankRange, struct FScriptDelegate ResultsRetrievedDelegate, struct FPointer pExternalData );
@@ -4312,8 +3612,6 @@ public:
 	void OnJobCompletion ( TArray< struct FLeaderboardColumn > aColumInfo, TArray< struct FLeaderboardRecord > aResults, int iTotalRanks, struct FUniqueNetId uidEntity, unsigned char nErrorCode, struct FPointer pExternalData );
 };
 
-UClass* USFXOnlineJobGetLeaderboardData::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineJobGetLeaderboardList
 // 0x000D (0x0068 - 0x005B)
 class USFXOnlineJobGetLeaderboardList : public USFXOnlineJob
@@ -4321,16 +3619,9 @@ class USFXOnlineJobGetLeaderboardList : public USFXOnlineJob
 public:
 	struct FScriptDelegate                             __OnJobCompletion__Delegate;                      		// 0x005C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2092 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2092 );
 	};
 
 	bool eventShouldReschedule ( );
@@ -4340,8 +3631,6 @@ public:
 	void OnJobCompletion ( unsigned char errorCode );
 };
 
-UClass* USFXOnlineJobGetLeaderboardList::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineJobGetStatsGroupList
 // 0x000D (0x0068 - 0x005B)
 class USFXOnlineJobGetStatsGroupList : public USFXOnlineJob
@@ -4349,16 +3638,9 @@ class USFXOnlineJobGetStatsGroupList : public USFXOnlineJob
 public:
 	struct FScriptDelegate                             __OnJobCompletion__Delegate;                      		// 0x005C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2093 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2093 );
 	};
 
 	class USFXOnlineJobGetStatsGroupList* eventCreateGetStatsGroupListJob ( );
@@ -4367,8 +3649,6 @@ public:
 	void OnJobCompletion ( unsigned char errorCode );
 };
 
-UClass* USFXOnlineJobGetStatsGroupList::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineJobHTTPRequest
 // 0x0011 (0x006C - 0x005B)
 class USFXOnlineJobHTTPRequest : public USFXOnlineJob
@@ -4377,16 +3657,9 @@ public:
 	struct FScriptDelegate                             __OnJobComplete__Delegate;                        		// 0x005C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	class USFXOnlineHTTPRequest*                       mRequest;                                         		// 0x0068 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2094 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2094 );
 	};
 
 	void Tick ( );
@@ -4395,8 +3668,6 @@ public:
 	void OnJobComplete ( class USFXOnlineHTTPRequest* request );
 };
 
-UClass* USFXOnlineJobHTTPRequest::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineJobImageRequest
 // 0x0025 (0x0080 - 0x005B)
 class USFXOnlineJobImageRequest : public USFXOnlineJob
@@ -4405,16 +3676,9 @@ public:
 	struct FSFXOnlineImageRequest                      mRequest;                                         		// 0x005C (0x0018) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	struct FScriptDelegate                             __OnJobComplete__Delegate;                        		// 0x0074 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2095 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2095 );
 	};
 
 	void MoveToBackOfQueue ( );
@@ -4424,8 +3688,6 @@ public:
 	void OnJobComplete ( struct FSFXOnlineImageRequest request );
 };
 
-UClass* USFXOnlineJobImageRequest::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineJobImportFriendListToBlaze
 // 0x0011 (0x006C - 0x005B)
 class USFXOnlineJobImportFriendListToBlaze : public USFXOnlineJob
@@ -4434,16 +3696,9 @@ public:
 	struct FScriptDelegate                             __OnJobCompletion__Delegate;                      		// 0x005C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	unsigned long                                      bCallPostImportFriendListToBlaze : 1;             		// 0x0068 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2096 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2096 );
 	};
 
 	bool eventShouldReschedule ( );
@@ -4453,8 +3708,6 @@ public:
 	void OnJobCompletion ( unsigned char errorCode );
 };
 
-UClass* USFXOnlineJobImportFriendListToBlaze::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineJobLoadSettings
 // 0x001E (0x0079 - 0x005B)
 class USFXOnlineJobLoadSettings : public USFXOnlineJob
@@ -4465,16 +3718,9 @@ public:
 	int                                                CallbackArg;                                      		// 0x0074 (0x0004) [0x0000000000000000]              
 	unsigned char                                      RunningErrorCode;                                 		// 0x0078 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2097 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2097 );
 	};
 
 	bool eventShouldReschedule ( );
@@ -4483,8 +3729,6 @@ public:
 	void LoadSettingsCallback ( unsigned char errorCode, int InJobId, TArray< struct FSettingsPair > InSettings, int InCallbackArg );
 };
 
-UClass* USFXOnlineJobLoadSettings::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineJobPurgeMessages
 // 0x0009 (0x0064 - 0x005B)
 class USFXOnlineJobPurgeMessages : public USFXOnlineJob
@@ -4493,16 +3737,9 @@ public:
 	int                                                MapId;                                            		// 0x005C (0x0004) [0x0000000000000000]              
 	unsigned long                                      PurgeAllMessages : 1;                             		// 0x0060 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2098 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2098 );
 	};
 
 	class USFXOnlineJobPurgeMessages* eventCreatePurgeMessagesJob ( int InMapId );
@@ -4510,8 +3747,6 @@ public:
 	bool DoExecute ( );
 };
 
-UClass* USFXOnlineJobPurgeMessages::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineJobReceiveMessage
 // 0x0005 (0x0060 - 0x005B)
 class USFXOnlineJobReceiveMessage : public USFXOnlineJob
@@ -4519,24 +3754,15 @@ class USFXOnlineJobReceiveMessage : public USFXOnlineJob
 public:
 	int                                                nMapId;                                           		// 0x005C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2099 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2099 );
 	};
 
 	class USFXOnlineJobReceiveMessage* eventCreateReceiveAllMessagesJob ( );
 	bool DoExecute ( );
 };
 
-UClass* USFXOnlineJobReceiveMessage::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineJobSaveSettings
 // 0x0035 (0x0090 - 0x005B)
 class USFXOnlineJobSaveSettings : public USFXOnlineJob
@@ -4550,16 +3776,9 @@ public:
 	int                                                OutstandingSubJobs;                               		// 0x0088 (0x0004) [0x0000000000000000]              
 	unsigned long                                      CallbackHasRun : 1;                               		// 0x008C (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2100 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2100 );
 	};
 
 	class USFXOnlineJobSaveSettings* eventCreateJob ( struct FScriptDelegate InCallback, int InCallbackArg );
@@ -4570,8 +3789,6 @@ public:
 	void SaveSettingsCallback ( unsigned char errorCode, int InJobId, int InCallbackArg );
 };
 
-UClass* USFXOnlineJobSaveSettings::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineJobSendMessage
 // 0x001A (0x0075 - 0x005B)
 class USFXOnlineJobSendMessage : public USFXOnlineJob
@@ -4581,16 +3798,9 @@ public:
 	TArray< struct FString >                           sParams;                                          		// 0x0068 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	unsigned char                                      MessageType;                                      		// 0x0074 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2101 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2101 );
 	};
 
 	bool GetFriendsList ( TArray< struct FString >* friendsPersonaNames );
@@ -4599,8 +3809,6 @@ public:
 	bool DoExecute ( );
 };
 
-UClass* USFXOnlineJobSendMessage::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineNetConnection
 // 0x012C (0x50E0 - 0x4FB4)
 class USFXOnlineNetConnection : public UNetConnection
@@ -4608,22 +3816,13 @@ class USFXOnlineNetConnection : public UNetConnection
 public:
 	unsigned char                                      UnknownData00[ 0x12C ];                           		// 0x4FB4 (0x012C) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2102 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2102 );
 	};
 
 };
 
-UClass* USFXOnlineNetConnection::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineNetDriver
 // 0x0008 (0x0188 - 0x0180)
 class USFXOnlineNetDriver : public UNetDriver
@@ -4631,22 +3830,13 @@ class USFXOnlineNetDriver : public UNetDriver
 public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0180 (0x0008) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2103 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2103 );
 	};
 
 };
 
-UClass* USFXOnlineNetDriver::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.SFXOnlineComponentCommerce
 // 0x00EC (0x0150 - 0x0064)
 class USFXOnlineComponentCommerce : public USFXOnlineComponent
@@ -4676,16 +3866,9 @@ public:
 	int                                                CurrentDimeState;                                 		// 0x0148 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bAwaitingDimeForRefresh : 1;                      		// 0x014C (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 2104 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2104 );
 	};
 
 	struct FString DecryptOfflineEntitlementInfo ( );
@@ -4725,24 +3908,15 @@ public:
 	void OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem );
 };
 
-UClass* USFXOnlineComponentCommerce::pClassPointer = NULL;
-
 // Class SFXOnlineFoundation.sfxonlinestatswrite
 // 0x0000 (0x0088 - 0x0088)
 class Usfxonlinestatswrite : public UOnlineStatsWrite
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 40838 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 4288 );
 	};
 
 	void DecrementIntStat ( int StatId, int DecBy );
@@ -4756,8 +3930,6 @@ public:
 	void OnStatsWriteComplete ( );
 };
 
-UClass* Usfxonlinestatswrite::pClassPointer = NULL;
-
 
 #ifdef _MSC_VER
 	#pragma pack ( pop )
@@ -28,10 +28,9 @@
 
 bool USFXOnlineComponent::eventIsXbox360 ( )
 {
-	static UFunction* pFnIsXbox360 = NULL;
-
+	UFunction* pFnIsXbox360 = (UFunction*) SdkBindings::Get ( 3190 );
 	if ( ! pFnIsXbox360 )
-		pFnIsXbox360 = (UFunction*) UObject::GObjObjects()->Data[ 36514 ];
+		return {};
 
 	USFXOnlineComponent_eventIsXbox360_Parms IsXbox360_Parms;
 
@@ -47,10 +46,9 @@ bool USFXOnlineComponent::eventIsXbox360 ( )
 
 bool USFXOnlineComponent::eventIsPS3 ( )
 {
-	static UFunction* pFnIsPS3 = NULL;
-
+	UFunction* pFnIsPS3 = (UFunction*) SdkBindings::Get ( 3189 );
 	if ( ! pFnIsPS3 )
-		pFnIsPS3 = (UFunction*) UObject::GObjObjects()->Data[ 36512 ];
+		return {};
 
 	USFXOnlineComponent_eventIsPS3_Parms IsPS3_Parms;
 
@@ -66,10 +64,9 @@ bool USFXOnlineComponent::eventIsPS3 ( )
 
 bool USFXOnlineComponent::eventIsConsole ( )
 {
-	static UFunction* pFnIsConsole = NULL;
-
+	UFunction* pFnIsConsole = (UFunction*) SdkBindings::Get ( 3188 );
 	if ( ! pFnIsConsole )
-		pFnIsConsole = (UFunction*) UObject::GObjObjects()->Data[ 36510 ];
+		return {};
 
 	USFXOnlineComponent_eventIsConsole_Parms IsConsole_Parms;
 
@@ -87,10 +84,9 @@ bool USFXOnlineComponent::eventIsConsole ( )
 
 bool USFXOnlineComponent::GetAllPendingEvents ( unsigned char eEventType, TArray< class USFXOnlineEvent* >* aPendingEvents )
 {
-	static UFunction* pFnGetAllPendingEvents = NULL;
-
+	UFunction* pFnGetAllPendingEvents = (UFunction*) SdkBindings::Get ( 3187 );
 	if ( ! pFnGetAllPendingEvents )
-		pFnGetAllPendingEvents = (UFunction*) UObject::GObjObjects()->Data[ 36505 ];
+		return {};
 
 	USFXOnlineComponent_execGetAllPendingEvents_Parms GetAllPendingEvents_Parms;
 	GetAllPendingEvents_Parms.eEventType = eEventType;
@@ -115,10 +111,9 @@ bool USFXOnlineComponent::GetAllPendingEvents ( unsigned char eEventType, TArray
 
 bool USFXOnlineComponent::IsAnyEventPending ( unsigned char eEventType )
 {
-	static UFunction* pFnIsAnyEventPending = NULL;
-
+	UFunction* pFnIsAnyEventPending = (UFunction*) SdkBindings::Get ( 3186 );
 	if ( ! pFnIsAnyEventPending )
-		pFnIsAnyEventPending = (UFunction*) UObject::GObjObjects()->Data[ 36502 ];
+		return {};
 
 	USFXOnlineComponent_execIsAnyEventPending_Parms IsAnyEventPending_Parms;
 	IsAnyEventPending_Parms.eEventType = eEventType;
@@ -141,10 +136,9 @@ bool USFXOnlineComponent::IsAnyEventPending ( unsigned char eEventType )
 
 bool USFXOnlineComponent::IsEventPending ( unsigned char eEventType, int nEventID )
 {
-	static UFunction* pFnIsEventPending = NULL;
-
+	UFunction* pFnIsEventPending = (UFunction*) SdkBindings::Get ( 3185 );
 	if ( ! pFnIsEventPending )
-		pFnIsEventPending = (UFunction*) UObject::GObjObjects()->Data[ 36498 ];
+		return {};
 
 	USFXOnlineComponent_execIsEventPending_Parms IsEventPending_Parms;
 	IsEventPending_Parms.eEventType = eEventType;
@@ -168,10 +162,9 @@ bool USFXOnlineComponent::IsEventPending ( unsigned char eEventType, int nEventI
 
 class USFXOnlineEvent* USFXOnlineComponent::GetEvent ( unsigned char eEventType, int nEventID )
 {
-	static UFunction* pFnGetEvent = NULL;
-
+	UFunction* pFnGetEvent = (UFunction*) SdkBindings::Get ( 3184 );
 	if ( ! pFnGetEvent )
-		pFnGetEvent = (UFunction*) UObject::GObjObjects()->Data[ 36494 ];
+		return {};
 
 	USFXOnlineComponent_execGetEvent_Parms GetEvent_Parms;
 	GetEvent_Parms.eEventType = eEventType;
@@ -194,10 +187,9 @@ class USFXOnlineEvent* USFXOnlineComponent::GetEvent ( unsigned char eEventType,
 
 void USFXOnlineComponent::WaitingForWorkSetObject ( TArray< class USFXOnlineEvent* > aOnlineEventSet, struct FScriptDelegate fnWorkComplete )
 {
-	static UFunction* pFnWaitingForWorkSetObject = NULL;
-
+	UFunction* pFnWaitingForWorkSetObject = (UFunction*) SdkBindings::Get ( 3183 );
 	if ( ! pFnWaitingForWorkSetObject )
-		pFnWaitingForWorkSetObject = (UFunction*) UObject::GObjObjects()->Data[ 36490 ];
+		return;
 
 	USFXOnlineComponent_execWaitingForWorkSetObject_Parms WaitingForWorkSetObject_Parms;
 	memcpy ( &WaitingForWorkSetObject_Parms.aOnlineEventSet, &aOnlineEventSet, 0xC );
@@ -218,10 +210,9 @@ void USFXOnlineComponent::WaitingForWorkSetObject ( TArray< class USFXOnlineEven
 
 void USFXOnlineComponent::WaitingForWorkSetType ( TArray< unsigned char > aWorkUnits, struct FScriptDelegate fnWorkComplete )
 {
-	static UFunction* pFnWaitingForWorkSetType = NULL;
-
+	UFunction* pFnWaitingForWorkSetType = (UFunction*) SdkBindings::Get ( 3182 );
 	if ( ! pFnWaitingForWorkSetType )
-		pFnWaitingForWorkSetType = (UFunction*) UObject::GObjObjects()->Data[ 36486 ];
+		return;
 
 	USFXOnlineComponent_execWaitingForWorkSetType_Parms WaitingForWorkSetType_Parms;
 	memcpy ( &WaitingForWorkSetType_Parms.aWorkUnits, &aWorkUnits, 0xC );
@@ -242,10 +233,9 @@ void USFXOnlineComponent::WaitingForWorkSetType ( TArray< unsigned char > aWorkU
 
 void USFXOnlineComponent::WaitingForWorkObject ( class USFXOnlineEvent* oEvent, struct FScriptDelegate fnWorkComplete )
 {
-	static UFunction* pFnWaitingForWorkObject = NULL;
-
+	UFunction* pFnWaitingForWorkObject = (UFunction*) SdkBindings::Get ( 3181 );
 	if ( ! pFnWaitingForWorkObject )
-		pFnWaitingForWorkObject = (UFunction*) UObject::GObjObjects()->Data[ 36483 ];
+		return;
 
 	USFXOnlineComponent_execWaitingForWorkObject_Parms WaitingForWorkObject_Parms;
 	WaitingForWorkObject_Parms.oEvent = oEvent;
@@ -267,10 +257,9 @@ void USFXOnlineComponent::WaitingForWorkObject ( class USFXOnlineEvent* oEvent,
 
 void USFXOnlineComponent::WaitingForWorkType ( unsigned char eWork, struct FScriptDelegate fnWorkComplete, int nEventID )
 {
-	static UFunction* pFnWaitingForWorkType = NULL;
-
+	UFunction* pFnWaitingForWorkType = (UFunction*) SdkBindings::Get ( 3180 );
 	if ( ! pFnWaitingForWorkType )
-		pFnWaitingForWorkType = (UFunction*) UObject::GObjObjects()->Data[ 36479 ];
+		return;
 
 	USFXOnlineComponent_execWaitingForWorkType_Parms WaitingForWorkType_Parms;
 	WaitingForWorkType_Parms.eWork = eWork;
@@ -292,10 +281,9 @@ void USFXOnlineComponent::WaitingForWorkType ( unsigned char eWork, struct FScri
 
 void USFXOnlineComponent::NotifyWorkFinishedObject ( class USFXOnlineEvent* oEvent, unsigned char eStatusFinished )
 {
-	static UFunction* pFnNotifyWorkFinishedObject = NULL;
-
+	UFunction* pFnNotifyWorkFinishedObject = (UFunction*) SdkBindings::Get ( 3179 );
 	if ( ! pFnNotifyWorkFinishedObject )
-		pFnNotifyWorkFinishedObject = (UFunction*) UObject::GObjObjects()->Data[ 36476 ];
+		return;
 
 	USFXOnlineComponent_execNotifyWorkFinishedObject_Parms NotifyWorkFinishedObject_Parms;
 	NotifyWorkFinishedObject_Parms.oEvent = oEvent;
@@ -317,10 +305,9 @@ void USFXOnlineComponent::NotifyWorkFinishedObject ( class USFXOnlineEvent* oEve
 
 void USFXOnlineComponent::NotifyWorkFinishedType ( unsigned char eWork, unsigned char eStatusFinished, int nEventID )
 {
-	static UFunction* pFnNotifyWorkFinishedType = NULL;
-
+	UFunction* pFnNotifyWorkFinishedType = (UFunction*) SdkBindings::Get ( 3178 );
 	if ( ! pFnNotifyWorkFinishedType )
-		pFnNotifyWorkFinishedType = (UFunction*) UObject::GObjObjects()->Data[ 36472 ];
+		return;
 
 	USFXOnlineComponent_execNotifyWorkFinishedType_Parms NotifyWorkFinishedType_Parms;
 	NotifyWorkFinishedType_Parms.eWork = eWork;
@@ -343,10 +330,9 @@ void USFXOnlineComponent::NotifyWorkFinishedType ( unsigned char eWork, unsigned
 
 void USFXOnlineComponent::NotifyWorkStartedObject ( class USFXOnlineEvent* oEvent, unsigned char eEventType, float TimeOut )
 {
-	static UFunction* pFnNotifyWorkStartedObject = NULL;
-
+	UFunction* pFnNotifyWorkStartedObject = (UFunction*) SdkBindings::Get ( 3177 );
 	if ( ! pFnNotifyWorkStartedObject )
-		pFnNotifyWorkStartedObject = (UFunction*) UObject::GObjObjects()->Data[ 36468 ];
+		return;
 
 	USFXOnlineComponent_execNotifyWorkStartedObject_Parms NotifyWorkStartedObject_Parms;
 	NotifyWorkStartedObject_Parms.oEvent = oEvent;
@@ -369,10 +355,9 @@ void USFXOnlineComponent::NotifyWorkStartedObject ( class USFXOnlineEvent* oEven
 
 void USFXOnlineComponent::NotifyWorkStartedType ( unsigned char eWork, int nEventID, float fTimeOut )
 {
-	static UFunction* pFnNotifyWorkStartedType = NULL;
-
+	UFunction* pFnNotifyWorkStartedType = (UFunction*) SdkBindings::Get ( 3176 );
 	if ( ! pFnNotifyWorkStartedType )
-		pFnNotifyWorkStartedType = (UFunction*) UObject::GObjObjects()->Data[ 36464 ];
+		return;
 
 	USFXOnlineComponent_execNotifyWorkStartedType_Parms NotifyWorkStartedType_Parms;
 	NotifyWorkStartedType_Parms.eWork = eWork;
@@ -393,10 +378,9 @@ void USFXOnlineComponent::NotifyWorkStartedType ( unsigned char eWork, int nEven
 
 void USFXOnlineComponent::NotifyEventObject ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnNotifyEventObject = NULL;
-
+	UFunction* pFnNotifyEventObject = (UFunction*) SdkBindings::Get ( 3175 );
 	if ( ! pFnNotifyEventObject )
-		pFnNotifyEventObject = (UFunction*) UObject::GObjObjects()->Data[ 36462 ];
+		return;
 
 	USFXOnlineComponent_execNotifyEventObject_Parms NotifyEventObject_Parms;
 	NotifyEventObject_Parms.oEvent = oEvent;
@@ -417,10 +401,9 @@ void USFXOnlineComponent::NotifyEventObject ( class USFXOnlineEvent* oEvent )
 
 void USFXOnlineComponent::NotifyEventType ( unsigned char eEventType, unsigned char eStatus, unsigned char eOutcome )
 {
-	static UFunction* pFnNotifyEventType = NULL;
-
+	UFunction* pFnNotifyEventType = (UFunction*) SdkBindings::Get ( 3174 );
 	if ( ! pFnNotifyEventType )
-		pFnNotifyEventType = (UFunction*) UObject::GObjObjects()->Data[ 36458 ];
+		return;
 
 	USFXOnlineComponent_execNotifyEventType_Parms NotifyEventType_Parms;
 	NotifyEventType_Parms.eEventType = eEventType;
@@ -441,10 +424,9 @@ void USFXOnlineComponent::NotifyEventType ( unsigned char eEventType, unsigned c
 
 void USFXOnlineComponent::StopWaitingForAllWork ( class UObject* oCallbackTarget )
 {
-	static UFunction* pFnStopWaitingForAllWork = NULL;
-
+	UFunction* pFnStopWaitingForAllWork = (UFunction*) SdkBindings::Get ( 3173 );
 	if ( ! pFnStopWaitingForAllWork )
-		pFnStopWaitingForAllWork = (UFunction*) UObject::GObjObjects()->Data[ 36456 ];
+		return;
 
 	USFXOnlineComponent_execStopWaitingForAllWork_Parms StopWaitingForAllWork_Parms;
 	StopWaitingForAllWork_Parms.oCallbackTarget = oCallbackTarget;
@@ -463,10 +445,9 @@ void USFXOnlineComponent::StopWaitingForAllWork ( class UObject* oCallbackTarget
 
 void USFXOnlineComponent::UnsubscribeFromAllEvents ( class UObject* oCallbackTarget )
 {
-	static UFunction* pFnUnsubscribeFromAllEvents = NULL;
-
+	UFunction* pFnUnsubscribeFromAllEvents = (UFunction*) SdkBindings::Get ( 3172 );
 	if ( ! pFnUnsubscribeFromAllEvents )
-		pFnUnsubscribeFromAllEvents = (UFunction*) UObject::GObjObjects()->Data[ 36454 ];
+		return;
 
 	USFXOnlineComponent_execUnsubscribeFromAllEvents_Parms UnsubscribeFromAllEvents_Parms;
 	UnsubscribeFromAllEvents_Parms.oCallbackTarget = oCallbackTarget;
@@ -486,10 +467,9 @@ void USFXOnlineComponent::UnsubscribeFromAllEvents ( class UObject* oCallbackTar
 
 void USFXOnlineComponent::UnsubscribeFromEvent ( unsigned char oEventType, struct FScriptDelegate fnEventCallback )
 {
-	static UFunction* pFnUnsubscribeFromEvent = NULL;
-
+	UFunction* pFnUnsubscribeFromEvent = (UFunction*) SdkBindings::Get ( 3171 );
 	if ( ! pFnUnsubscribeFromEvent )
-		pFnUnsubscribeFromEvent = (UFunction*) UObject::GObjObjects()->Data[ 36451 ];
+		return;
 
 	USFXOnlineComponent_execUnsubscribeFromEvent_Parms UnsubscribeFromEvent_Parms;
 	UnsubscribeFromEvent_Parms.oEventType = oEventType;
@@ -510,10 +490,9 @@ void USFXOnlineComponent::UnsubscribeFromEvent ( unsigned char oEventType, struc
 
 void USFXOnlineComponent::SubscribeToEvent ( unsigned char eEventType, struct FScriptDelegate fnEventCallback )
 {
-	static UFunction* pFnSubscribeToEvent = NULL;
-
+	UFunction* pFnSubscribeToEvent = (UFunction*) SdkBindings::Get ( 3170 );
 	if ( ! pFnSubscribeToEvent )
-		pFnSubscribeToEvent = (UFunction*) UObject::GObjObjects()->Data[ 36448 ];
+		return;
 
 	USFXOnlineComponent_execSubscribeToEvent_Parms SubscribeToEvent_Parms;
 	SubscribeToEvent_Parms.eEventType = eEventType;
@@ -533,10 +512,9 @@ void USFXOnlineComponent::SubscribeToEvent ( unsigned char eEventType, struct FS
 
 void USFXOnlineComponent::OnEvent ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnEvent = NULL;
-
+	UFunction* pFnOnEvent = (UFunction*) SdkBindings::Get ( 3169 );
 	if ( ! pFnOnEvent )
-		pFnOnEvent = (UFunction*) UObject::GObjObjects()->Data[ 36446 ];
+		return;
 
 	USFXOnlineComponent_execOnEvent_Parms OnEvent_Parms;
 	OnEvent_Parms.oEvent = oEvent;
@@ -551,10 +529,9 @@ void USFXOnlineComponent::OnEvent ( class USFXOnlineEvent* oEvent )
 
 struct FName USFXOnlineComponent::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3168 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 36444 ];
+		return {};
 
 	USFXOnlineComponent_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -573,10 +550,9 @@ struct FName USFXOnlineComponent::GetAPIName ( )
 
 void USFXOnlineComponent::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3167 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 36443 ];
+		return;
 
 	USFXOnlineComponent_execOnRelease_Parms OnRelease_Parms;
 
@@ -594,10 +570,9 @@ void USFXOnlineComponent::OnRelease ( )
 
 void USFXOnlineComponent::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3166 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 36441 ];
+		return;
 
 	USFXOnlineComponent_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -617,10 +592,9 @@ void USFXOnlineComponent::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsy
 
 unsigned char USFXOnlineEvent::GetEventTypeFromString ( struct FString sEventString )
 {
-	static UFunction* pFnGetEventTypeFromString = NULL;
-
+	UFunction* pFnGetEventTypeFromString = (UFunction*) SdkBindings::Get ( 3165 );
 	if ( ! pFnGetEventTypeFromString )
-		pFnGetEventTypeFromString = (UFunction*) UObject::GObjObjects()->Data[ 36421 ];
+		return {};
 
 	USFXOnlineEvent_execGetEventTypeFromString_Parms GetEventTypeFromString_Parms;
 	memcpy ( &GetEventTypeFromString_Parms.sEventString, &sEventString, 0xC );
@@ -642,10 +616,9 @@ unsigned char USFXOnlineEvent::GetEventTypeFromString ( struct FString sEventStr
 
 struct FString USFXOnlineEvent::GetEventOutcomeAsString ( unsigned char oEventOutcome )
 {
-	static UFunction* pFnGetEventOutcomeAsString = NULL;
-
+	UFunction* pFnGetEventOutcomeAsString = (UFunction*) SdkBindings::Get ( 3164 );
 	if ( ! pFnGetEventOutcomeAsString )
-		pFnGetEventOutcomeAsString = (UFunction*) UObject::GObjObjects()->Data[ 36418 ];
+		return {};
 
 	USFXOnlineEvent_execGetEventOutcomeAsString_Parms GetEventOutcomeAsString_Parms;
 	GetEventOutcomeAsString_Parms.oEventOutcome = oEventOutcome;
@@ -667,10 +640,9 @@ struct FString USFXOnlineEvent::GetEventOutcomeAsString ( unsigned char oEventOu
 
 struct FString USFXOnlineEvent::GetEventStatusAsString ( unsigned char eStatusStatus )
 {
-	static UFunction* pFnGetEventStatusAsString = NULL;
-
+	UFunction* pFnGetEventStatusAsString = (UFunction*) SdkBindings::Get ( 3163 );
 	if ( ! pFnGetEventStatusAsString )
-		pFnGetEventStatusAsString = (UFunction*) UObject::GObjObjects()->Data[ 36415 ];
+		return {};
 
 	USFXOnlineEvent_execGetEventStatusAsString_Parms GetEventStatusAsString_Parms;
 	GetEventStatusAsString_Parms.eStatusStatus = eStatusStatus;
@@ -692,10 +664,9 @@ struct FString USFXOnlineEvent::GetEventStatusAsString ( unsigned char eStatusSt
 
 struct FString USFXOnlineEvent::GetEventTypeAsString ( unsigned char eEventType )
 {
-	static UFunction* pFnGetEventTypeAsString = NULL;
-
+	UFunction* pFnGetEventTypeAsString = (UFunction*) SdkBindings::Get ( 3162 );
 	if ( ! pFnGetEventTypeAsString )
-		pFnGetEventTypeAsString = (UFunction*) UObject::GObjObjects()->Data[ 36412 ];
+		return {};
 
 	USFXOnlineEvent_execGetEventTypeAsString_Parms GetEventTypeAsString_Parms;
 	GetEventTypeAsString_Parms.eEventType = eEventType;
@@ -715,10 +686,9 @@ struct FString USFXOnlineEvent::GetEventTypeAsString ( unsigned char eEventType
 
 void USFXOnlineEvent::DumpEventInfo ( )
 {
-	static UFunction* pFnDumpEventInfo = NULL;
-
+	UFunction* pFnDumpEventInfo = (UFunction*) SdkBindings::Get ( 3161 );
 	if ( ! pFnDumpEventInfo )
-		pFnDumpEventInfo = (UFunction*) UObject::GObjObjects()->Data[ 36411 ];
+		return;
 
 	USFXOnlineEvent_execDumpEventInfo_Parms DumpEventInfo_Parms;
 
@@ -736,10 +706,9 @@ void USFXOnlineEvent::DumpEventInfo ( )
 
 void USFXOnlineEvent::Update ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnUpdate = NULL;
-
+	UFunction* pFnUpdate = (UFunction*) SdkBindings::Get ( 3160 );
 	if ( ! pFnUpdate )
-		pFnUpdate = (UFunction*) UObject::GObjObjects()->Data[ 36409 ];
+		return;
 
 	USFXOnlineEvent_execUpdate_Parms Update_Parms;
 	Update_Parms.oEvent = oEvent;
@@ -758,10 +727,9 @@ void USFXOnlineEvent::Update ( class USFXOnlineEvent* oEvent )
 
 bool USFXOnlineEvent::IsSucceeded ( )
 {
-	static UFunction* pFnIsSucceeded = NULL;
-
+	UFunction* pFnIsSucceeded = (UFunction*) SdkBindings::Get ( 3159 );
 	if ( ! pFnIsSucceeded )
-		pFnIsSucceeded = (UFunction*) UObject::GObjObjects()->Data[ 36407 ];
+		return {};
 
 	USFXOnlineEvent_execIsSucceeded_Parms IsSucceeded_Parms;
 
@@ -781,10 +749,9 @@ bool USFXOnlineEvent::IsSucceeded ( )
 
 bool USFXOnlineEvent::IsCanceled ( )
 {
-	static UFunction* pFnIsCanceled = NULL;
-
+	UFunction* pFnIsCanceled = (UFunction*) SdkBindings::Get ( 3158 );
 	if ( ! pFnIsCanceled )
-		pFnIsCanceled = (UFunction*) UObject::GObjObjects()->Data[ 36405 ];
+		return {};
 
 	USFXOnlineEvent_execIsCanceled_Parms IsCanceled_Parms;
 
@@ -804,10 +771,9 @@ bool USFXOnlineEvent::IsCanceled ( )
 
 bool USFXOnlineEvent::IsInError ( )
 {
-	static UFunction* pFnIsInError = NULL;
-
+	UFunction* pFnIsInError = (UFunction*) SdkBindings::Get ( 3157 );
 	if ( ! pFnIsInError )
-		pFnIsInError = (UFunction*) UObject::GObjObjects()->Data[ 36403 ];
+		return {};
 
 	USFXOnlineEvent_execIsInError_Parms IsInError_Parms;
 
@@ -827,10 +793,9 @@ bool USFXOnlineEvent::IsInError ( )
 
 bool USFXOnlineEvent::IsComplete ( )
 {
-	static UFunction* pFnIsComplete = NULL;
-
+	UFunction* pFnIsComplete = (UFunction*) SdkBindings::Get ( 3156 );
 	if ( ! pFnIsComplete )
-		pFnIsComplete = (UFunction*) UObject::GObjObjects()->Data[ 36401 ];
+		return {};
 
 	USFXOnlineEvent_execIsComplete_Parms IsComplete_Parms;
 
@@ -850,10 +815,9 @@ bool USFXOnlineEvent::IsComplete ( )
 
 bool USFXOnlineEvent::IsPending ( )
 {
-	static UFunction* pFnIsPending = NULL;
-
+	UFunction* pFnIsPending = (UFunction*) SdkBindings::Get ( 3155 );
 	if ( ! pFnIsPending )
-		pFnIsPending = (UFunction*) UObject::GObjObjects()->Data[ 36399 ];
+		return {};
 
 	USFXOnlineEvent_execIsPending_Parms IsPending_Parms;
 
@@ -873,10 +837,9 @@ bool USFXOnlineEvent::IsPending ( )
 
 bool USFXOnlineEvent::IsCompleteAndSucceeded ( )
 {
-	static UFunction* pFnIsCompleteAndSucceeded = NULL;
-
+	UFunction* pFnIsCompleteAndSucceeded = (UFunction*) SdkBindings::Get ( 3154 );
 	if ( ! pFnIsCompleteAndSucceeded )
-		pFnIsCompleteAndSucceeded = (UFunction*) UObject::GObjObjects()->Data[ 36397 ];
+		return {};
 
 	USFXOnlineEvent_execIsCompleteAndSucceeded_Parms IsCompleteAndSucceeded_Parms;
 
@@ -896,10 +859,9 @@ bool USFXOnlineEvent::IsCompleteAndSucceeded ( )
 
 void USFXOnlineEvent::SetEndTime ( float CurrentTime )
 {
-	static UFunction* pFnSetEndTime = NULL;
-
+	UFunction* pFnSetEndTime = (UFunction*) SdkBindings::Get ( 3153 );
 	if ( ! pFnSetEndTime )
-		pFnSetEndTime = (UFunction*) UObject::GObjObjects()->Data[ 36395 ];
+		return;
 
 	USFXOnlineEvent_execSetEndTime_Parms SetEndTime_Parms;
 	SetEndTime_Parms.CurrentTime = CurrentTime;
@@ -918,10 +880,9 @@ void USFXOnlineEvent::SetEndTime ( float CurrentTime )
 
 void USFXOnlineEvent::SetStartTime ( float CurrentTime )
 {
-	static UFunction* pFnSetStartTime = NULL;
-
+	UFunction* pFnSetStartTime = (UFunction*) SdkBindings::Get ( 3152 );
 	if ( ! pFnSetStartTime )
-		pFnSetStartTime = (UFunction*) UObject::GObjObjects()->Data[ 36393 ];
+		return;
 
 	USFXOnlineEvent_execSetStartTime_Parms SetStartTime_Parms;
 	SetStartTime_Parms.CurrentTime = CurrentTime;
@@ -940,10 +901,9 @@ void USFXOnlineEvent::SetStartTime ( float CurrentTime )
 
 float USFXOnlineEvent::GetEndTime ( )
 {
-	static UFunction* pFnGetEndTime = NULL;
-
+	UFunction* pFnGetEndTime = (UFunction*) SdkBindings::Get ( 3151 );
 	if ( ! pFnGetEndTime )
-		pFnGetEndTime = (UFunction*) UObject::GObjObjects()->Data[ 36391 ];
+		return {};
 
 	USFXOnlineEvent_execGetEndTime_Parms GetEndTime_Parms;
 
@@ -963,10 +923,9 @@ float USFXOnlineEvent::GetEndTime ( )
 
 float USFXOnlineEvent::GetStartTime ( )
 {
-	static UFunction* pFnGetStartTime = NULL;
-
+	UFunction* pFnGetStartTime = (UFunction*) SdkBindings::Get ( 3150 );
 	if ( ! pFnGetStartTime )
-		pFnGetStartTime = (UFunction*) UObject::GObjObjects()->Data[ 36389 ];
+		return {};
 
 	USFXOnlineEvent_execGetStartTime_Parms GetStartTime_Parms;
 
@@ -987,10 +946,9 @@ float USFXOnlineEvent::GetStartTime ( )
 
 float USFXOnlineEvent::GetTimeDifference ( float CurrentTime )
 {
-	static UFunction* pFnGetTimeDifference = NULL;
-
+	UFunction* pFnGetTimeDifference = (UFunction*) SdkBindings::Get ( 3149 );
 	if ( ! pFnGetTimeDifference )
-		pFnGetTimeDifference = (UFunction*) UObject::GObjObjects()->Data[ 36386 ];
+		return {};
 
 	USFXOnlineEvent_execGetTimeDifference_Parms GetTimeDifference_Parms;
 	GetTimeDifference_Parms.CurrentTime = CurrentTime;
@@ -1011,10 +969,9 @@ float USFXOnlineEvent::GetTimeDifference ( float CurrentTime )
 
 bool USFXOnlineEvent::HasTimedOut ( )
 {
-	static UFunction* pFnHasTimedOut = NULL;
-
+	UFunction* pFnHasTimedOut = (UFunction*) SdkBindings::Get ( 3148 );
 	if ( ! pFnHasTimedOut )
-		pFnHasTimedOut = (UFunction*) UObject::GObjObjects()->Data[ 36384 ];
+		return {};
 
 	USFXOnlineEvent_execHasTimedOut_Parms HasTimedOut_Parms;
 
@@ -1034,10 +991,9 @@ bool USFXOnlineEvent::HasTimedOut ( )
 
 bool USFXOnlineEvent::IsTimeoutEnabled ( )
 {
-	static UFunction* pFnIsTimeoutEnabled = NULL;
-
+	UFunction* pFnIsTimeoutEnabled = (UFunction*) SdkBindings::Get ( 3147 );
 	if ( ! pFnIsTimeoutEnabled )
-		pFnIsTimeoutEnabled = (UFunction*) UObject::GObjObjects()->Data[ 36382 ];
+		return {};
 
 	USFXOnlineEvent_execIsTimeoutEnabled_Parms IsTimeoutEnabled_Parms;
 
@@ -1056,10 +1012,9 @@ bool USFXOnlineEvent::IsTimeoutEnabled ( )
 
 void USFXOnlineEvent::DisableTimeout ( )
 {
-	static UFunction* pFnDisableTimeout = NULL;
-
+	UFunction* pFnDisableTimeout = (UFunction*) SdkBindings::Get ( 3146 );
 	if ( ! pFnDisableTimeout )
-		pFnDisableTimeout = (UFunction*) UObject::GObjObjects()->Data[ 36381 ];
+		return;
 
 	USFXOnlineEvent_execDisableTimeout_Parms DisableTimeout_Parms;
 
@@ -1076,10 +1031,9 @@ void USFXOnlineEvent::DisableTimeout ( )
 
 void USFXOnlineEvent::EnableTimeout ( )
 {
-	static UFunction* pFnEnableTimeout = NULL;
-
+	UFunction* pFnEnableTimeout = (UFunction*) SdkBindings::Get ( 3145 );
 	if ( ! pFnEnableTimeout )
-		pFnEnableTimeout = (UFunction*) UObject::GObjObjects()->Data[ 36380 ];
+		return;
 
 	USFXOnlineEvent_execEnableTimeout_Parms EnableTimeout_Parms;
 
@@ -1097,10 +1051,9 @@ void USFXOnlineEvent::EnableTimeout ( )
 
 void USFXOnlineEvent::SetTimeout ( float fEventTimeout )
 {
-	static UFunction* pFnSetTimeout = NULL;
-
+	UFunction* pFnSetTimeout = (UFunction*) SdkBindings::Get ( 3144 );
 	if ( ! pFnSetTimeout )
-		pFnSetTimeout = (UFunction*) UObject::GObjObjects()->Data[ 36378 ];
+		return;
 
 	USFXOnlineEvent_execSetTimeout_Parms SetTimeout_Parms;
 	SetTimeout_Parms.fEventTimeout = fEventTimeout;
@@ -1119,10 +1072,9 @@ void USFXOnlineEvent::SetTimeout ( float fEventTimeout )
 
 float USFXOnlineEvent::GetTimeout ( )
 {
-	static UFunction* pFnGetTimeout = NULL;
-
+	UFunction* pFnGetTimeout = (UFunction*) SdkBindings::Get ( 3143 );
 	if ( ! pFnGetTimeout )
-		pFnGetTimeout = (UFunction*) UObject::GObjObjects()->Data[ 36376 ];
+		return {};
 
 	USFXOnlineEvent_execGetTimeout_Parms GetTimeout_Parms;
 
@@ -1142,10 +1094,9 @@ float USFXOnlineEvent::GetTimeout ( )
 
 void USFXOnlineEvent::SetErrorString ( struct FString sMessage )
 {
-	static UFunction* pFnSetErrorString = NULL;
-
+	UFunction* pFnSetErrorString = (UFunction*) SdkBindings::Get ( 3142 );
 	if ( ! pFnSetErrorString )
-		pFnSetErrorString = (UFunction*) UObject::GObjObjects()->Data[ 36374 ];
+		return;
 
 	USFXOnlineEvent_execSetErrorString_Parms SetErrorString_Parms;
 	memcpy ( &SetErrorString_Parms.sMessage, &sMessage, 0xC );
@@ -1164,10 +1115,9 @@ void USFXOnlineEvent::SetErrorString ( struct FString sMessage )
 
 struct FString USFXOnlineEvent::GetErrorString ( )
 {
-	static UFunction* pFnGetErrorString = NULL;
-
+	UFunction* pFnGetErrorString = (UFunction*) SdkBindings::Get ( 3141 );
 	if ( ! pFnGetErrorString )
-		pFnGetErrorString = (UFunction*) UObject::GObjObjects()->Data[ 36372 ];
+		return {};
 
 	USFXOnlineEvent_execGetErrorString_Parms GetErrorString_Parms;
 
@@ -1187,10 +1137,9 @@ struct FString USFXOnlineEvent::GetErrorString ( )
 
 void USFXOnlineEvent::SetErrorCode ( int nCode )
 {
-	static UFunction* pFnSetErrorCode = NULL;
-
+	UFunction* pFnSetErrorCode = (UFunction*) SdkBindings::Get ( 3140 );
 	if ( ! pFnSetErrorCode )
-		pFnSetErrorCode = (UFunction*) UObject::GObjObjects()->Data[ 36370 ];
+		return;
 
 	USFXOnlineEvent_execSetErrorCode_Parms SetErrorCode_Parms;
 	SetErrorCode_Parms.nCode = nCode;
@@ -1209,10 +1158,9 @@ void USFXOnlineEvent::SetErrorCode ( int nCode )
 
 int USFXOnlineEvent::GetErrorCode ( )
 {
-	static UFunction* pFnGetErrorCode = NULL;
-
+	UFunction* pFnGetErrorCode = (UFunction*) SdkBindings::Get ( 3139 );
 	if ( ! pFnGetErrorCode )
-		pFnGetErrorCode = (UFunction*) UObject::GObjObjects()->Data[ 36368 ];
+		return {};
 
 	USFXOnlineEvent_execGetErrorCode_Parms GetErrorCode_Parms;
 
@@ -1232,10 +1180,9 @@ int USFXOnlineEvent::GetErrorCode ( )
 
 void USFXOnlineEvent::SetStatus ( unsigned char eNewStatus )
 {
-	static UFunction* pFnSetStatus = NULL;
-
+	UFunction* pFnSetStatus = (UFunction*) SdkBindings::Get ( 3138 );
 	if ( ! pFnSetStatus )
-		pFnSetStatus = (UFunction*) UObject::GObjObjects()->Data[ 36366 ];
+		return;
 
 	USFXOnlineEvent_execSetStatus_Parms SetStatus_Parms;
 	SetStatus_Parms.eNewStatus = eNewStatus;
@@ -1254,10 +1201,9 @@ void USFXOnlineEvent::SetStatus ( unsigned char eNewStatus )
 
 unsigned char USFXOnlineEvent::GetStatus ( )
 {
-	static UFunction* pFnGetStatus = NULL;
-
+	UFunction* pFnGetStatus = (UFunction*) SdkBindings::Get ( 3137 );
 	if ( ! pFnGetStatus )
-		pFnGetStatus = (UFunction*) UObject::GObjObjects()->Data[ 36364 ];
+		return {};
 
 	USFXOnlineEvent_execGetStatus_Parms GetStatus_Parms;
 
@@ -1277,10 +1223,9 @@ unsigned char USFXOnlineEvent::GetStatus ( )
 
 void USFXOnlineEvent::SetOutcome ( unsigned char eStatusFinished )
 {
-	static UFunction* pFnSetOutcome = NULL;
-
+	UFunction* pFnSetOutcome = (UFunction*) SdkBindings::Get ( 3136 );
 	if ( ! pFnSetOutcome )
-		pFnSetOutcome = (UFunction*) UObject::GObjObjects()->Data[ 36362 ];
+		return;
 
 	USFXOnlineEvent_execSetOutcome_Parms SetOutcome_Parms;
 	SetOutcome_Parms.eStatusFinished = eStatusFinished;
@@ -1299,10 +1244,9 @@ void USFXOnlineEvent::SetOutcome ( unsigned char eStatusFinished )
 
 unsigned char USFXOnlineEvent::GetOutcome ( )
 {
-	static UFunction* pFnGetOutcome = NULL;
-
+	UFunction* pFnGetOutcome = (UFunction*) SdkBindings::Get ( 3135 );
 	if ( ! pFnGetOutcome )
-		pFnGetOutcome = (UFunction*) UObject::GObjObjects()->Data[ 36360 ];
+		return {};
 
 	USFXOnlineEvent_execGetOutcome_Parms GetOutcome_Parms;
 
@@ -1322,10 +1266,9 @@ unsigned char USFXOnlineEvent::GetOutcome ( )
 
 void USFXOnlineEvent::SetEventId ( int nNewEventId )
 {
-	static UFunction* pFnSetEventId = NULL;
-
+	UFunction* pFnSetEventId = (UFunction*) SdkBindings::Get ( 3134 );
 	if ( ! pFnSetEventId )
-		pFnSetEventId = (UFunction*) UObject::GObjObjects()->Data[ 36358 ];
+		return;
 
 	USFXOnlineEvent_execSetEventId_Parms SetEventId_Parms;
 	SetEventId_Parms.nNewEventId = nNewEventId;
@@ -1344,10 +1287,9 @@ void USFXOnlineEvent::SetEventId ( int nNewEventId )
 
 int USFXOnlineEvent::GetEventId ( )
 {
-	static UFunction* pFnGetEventId = NULL;
-
+	UFunction* pFnGetEventId = (UFunction*) SdkBindings::Get ( 3133 );
 	if ( ! pFnGetEventId )
-		pFnGetEventId = (UFunction*) UObject::GObjObjects()->Data[ 36356 ];
+		return {};
 
 	USFXOnlineEvent_execGetEventId_Parms GetEventId_Parms;
 
@@ -1367,10 +1309,9 @@ int USFXOnlineEvent::GetEventId ( )
 
 void USFXOnlineEvent::SetEventType ( unsigned char eNewEventType )
 {
-	static UFunction* pFnSetEventType = NULL;
-
+	UFunction* pFnSetEventType = (UFunction*) SdkBindings::Get ( 3132 );
 	if ( ! pFnSetEventType )
-		pFnSetEventType = (UFunction*) UObject::GObjObjects()->Data[ 36354 ];
+		return;
 
 	USFXOnlineEvent_execSetEventType_Parms SetEventType_Parms;
 	SetEventType_Parms.eNewEventType = eNewEventType;
@@ -1389,10 +1330,9 @@ void USFXOnlineEvent::SetEventType ( unsigned char eNewEventType )
 
 unsigned char USFXOnlineEvent::GetEventType ( )
 {
-	static UFunction* pFnGetEventType = NULL;
-
+	UFunction* pFnGetEventType = (UFunction*) SdkBindings::Get ( 3131 );
 	if ( ! pFnGetEventType )
-		pFnGetEventType = (UFunction*) UObject::GObjObjects()->Data[ 36352 ];
+		return {};
 
 	USFXOnlineEvent_execGetEventType_Parms GetEventType_Parms;
 
@@ -1412,10 +1352,9 @@ unsigned char USFXOnlineEvent::GetEventType ( )
 
 void USFXOnlineEvent_Integer::SetInteger ( int nInteger )
 {
-	static UFunction* pFnSetInteger = NULL;
-
+	UFunction* pFnSetInteger = (UFunction*) SdkBindings::Get ( 3715 );
 	if ( ! pFnSetInteger )
-		pFnSetInteger = (UFunction*) UObject::GObjObjects()->Data[ 38354 ];
+		return;
 
 	USFXOnlineEvent_Integer_execSetInteger_Parms SetInteger_Parms;
 	SetInteger_Parms.nInteger = nInteger;
@@ -1434,10 +1373,9 @@ void USFXOnlineEvent_Integer::SetInteger ( int nInteger )
 
 int USFXOnlineEvent_Integer::GetInteger ( )
 {
-	static UFunction* pFnGetInteger = NULL;
-
+	UFunction* pFnGetInteger = (UFunction*) SdkBindings::Get ( 4160 );
 	if ( ! pFnGetInteger )
-		pFnGetInteger = (UFunction*) UObject::GObjObjects()->Data[ 40241 ];
+		return {};
 
 	USFXOnlineEvent_Integer_execGetInteger_Parms GetInteger_Parms;
 
@@ -1457,10 +1395,9 @@ int USFXOnlineEvent_Integer::GetInteger ( )
 
 void USFXOnlineEvent_String::SetStringData ( struct FString sStringData )
 {
-	static UFunction* pFnSetStringData = NULL;
-
+	UFunction* pFnSetStringData = (UFunction*) SdkBindings::Get ( 4162 );
 	if ( ! pFnSetStringData )
-		pFnSetStringData = (UFunction*) UObject::GObjObjects()->Data[ 40247 ];
+		return;
 
 	USFXOnlineEvent_String_execSetStringData_Parms SetStringData_Parms;
 	memcpy ( &SetStringData_Parms.sStringData, &sStringData, 0xC );
@@ -1479,10 +1416,9 @@ void USFXOnlineEvent_String::SetStringData ( struct FString sStringData )
 
 struct FString USFXOnlineEvent_String::GetStringData ( )
 {
-	static UFunction* pFnGetStringData = NULL;
-
+	UFunction* pFnGetStringData = (UFunction*) SdkBindings::Get ( 4161 );
 	if ( ! pFnGetStringData )
-		pFnGetStringData = (UFunction*) UObject::GObjObjects()->Data[ 40245 ];
+		return {};
 
 	USFXOnlineEvent_String_execGetStringData_Parms GetStringData_Parms;
 
@@ -1502,10 +1438,9 @@ struct FString USFXOnlineEvent_String::GetStringData ( )
 
 void USFXOnlineEvent_Notification::SetPriority ( int nPriority )
 {
-	static UFunction* pFnSetPriority = NULL;
-
+	UFunction* pFnSetPriority = (UFunction*) SdkBindings::Get ( 4166 );
 	if ( ! pFnSetPriority )
-		pFnSetPriority = (UFunction*) UObject::GObjObjects()->Data[ 40256 ];
+		return;
 
 	USFXOnlineEvent_Notification_execSetPriority_Parms SetPriority_Parms;
 	SetPriority_Parms.nPriority = nPriority;
@@ -1524,10 +1459,9 @@ void USFXOnlineEvent_Notification::SetPriority ( int nPriority )
 
 int USFXOnlineEvent_Notification::GetPriority ( )
 {
-	static UFunction* pFnGetPriority = NULL;
-
+	UFunction* pFnGetPriority = (UFunction*) SdkBindings::Get ( 4165 );
 	if ( ! pFnGetPriority )
-		pFnGetPriority = (UFunction*) UObject::GObjObjects()->Data[ 40254 ];
+		return {};
 
 	USFXOnlineEvent_Notification_execGetPriority_Parms GetPriority_Parms;
 
@@ -1547,10 +1481,9 @@ int USFXOnlineEvent_Notification::GetPriority ( )
 
 void USFXOnlineEvent_Notification::SetImageName ( struct FString sImageName )
 {
-	static UFunction* pFnSetImageName = NULL;
-
+	UFunction* pFnSetImageName = (UFunction*) SdkBindings::Get ( 4164 );
 	if ( ! pFnSetImageName )
-		pFnSetImageName = (UFunction*) UObject::GObjObjects()->Data[ 40252 ];
+		return;
 
 	USFXOnlineEvent_Notification_execSetImageName_Parms SetImageName_Parms;
 	memcpy ( &SetImageName_Parms.sImageName, &sImageName, 0xC );
@@ -1569,10 +1502,9 @@ void USFXOnlineEvent_Notification::SetImageName ( struct FString sImageName )
 
 struct FString USFXOnlineEvent_Notification::GetImageName ( )
 {
-	static UFunction* pFnGetImageName = NULL;
-
+	UFunction* pFnGetImageName = (UFunction*) SdkBindings::Get ( 4163 );
 	if ( ! pFnGetImageName )
-		pFnGetImageName = (UFunction*) UObject::GObjObjects()->Data[ 40250 ];
+		return {};
 
 	USFXOnlineEvent_Notification_execGetImageName_Parms GetImageName_Parms;
 
@@ -1592,10 +1524,9 @@ struct FString USFXOnlineEvent_Notification::GetImageName ( )
 
 class USFXOnlineEvent* USFXOnlineEventList::GetNextTimedOutEvent ( )
 {
-	static UFunction* pFnGetNextTimedOutEvent = NULL;
-
+	UFunction* pFnGetNextTimedOutEvent = (UFunction*) SdkBindings::Get ( 4173 );
 	if ( ! pFnGetNextTimedOutEvent )
-		pFnGetNextTimedOutEvent = (UFunction*) UObject::GObjObjects()->Data[ 40295 ];
+		return {};
 
 	USFXOnlineEventList_execGetNextTimedOutEvent_Parms GetNextTimedOutEvent_Parms;
 
@@ -1616,10 +1547,9 @@ class USFXOnlineEvent* USFXOnlineEventList::GetNextTimedOutEvent ( )
 
 bool USFXOnlineEventList::RemoveEvent ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnRemoveEvent = NULL;
-
+	UFunction* pFnRemoveEvent = (UFunction*) SdkBindings::Get ( 4172 );
 	if ( ! pFnRemoveEvent )
-		pFnRemoveEvent = (UFunction*) UObject::GObjObjects()->Data[ 40292 ];
+		return {};
 
 	USFXOnlineEventList_execRemoveEvent_Parms RemoveEvent_Parms;
 	RemoveEvent_Parms.oEvent = oEvent;
@@ -1642,10 +1572,9 @@ bool USFXOnlineEventList::RemoveEvent ( class USFXOnlineEvent* oEvent )
 
 bool USFXOnlineEventList::GetAllPendingEvents ( unsigned char eEventType, TArray< class USFXOnlineEvent* >* PendingEvents )
 {
-	static UFunction* pFnGetAllPendingEvents = NULL;
-
+	UFunction* pFnGetAllPendingEvents = (UFunction*) SdkBindings::Get ( 4171 );
 	if ( ! pFnGetAllPendingEvents )
-		pFnGetAllPendingEvents = (UFunction*) UObject::GObjObjects()->Data[ 40287 ];
+		return {};
 
 	USFXOnlineEventList_execGetAllPendingEvents_Parms GetAllPendingEvents_Parms;
 	GetAllPendingEvents_Parms.eEventType = eEventType;
@@ -1670,10 +1599,9 @@ bool USFXOnlineEventList::GetAllPendingEvents ( unsigned char eEventType, TArray
 
 int USFXOnlineEventList::FindEvent ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnFindEvent = NULL;
-
+	UFunction* pFnFindEvent = (UFunction*) SdkBindings::Get ( 4170 );
 	if ( ! pFnFindEvent )
-		pFnFindEvent = (UFunction*) UObject::GObjObjects()->Data[ 40284 ];
+		return {};
 
 	USFXOnlineEventList_execFindEvent_Parms FindEvent_Parms;
 	FindEvent_Parms.oEvent = oEvent;
@@ -1695,10 +1623,9 @@ int USFXOnlineEventList::FindEvent ( class USFXOnlineEvent* oEvent )
 
 class USFXOnlineEvent* USFXOnlineEventList::GetEventAtIndex ( int nEventIndex )
 {
-	static UFunction* pFnGetEventAtIndex = NULL;
-
+	UFunction* pFnGetEventAtIndex = (UFunction*) SdkBindings::Get ( 4169 );
 	if ( ! pFnGetEventAtIndex )
-		pFnGetEventAtIndex = (UFunction*) UObject::GObjObjects()->Data[ 40281 ];
+		return {};
 
 	USFXOnlineEventList_execGetEventAtIndex_Parms GetEventAtIndex_Parms;
 	GetEventAtIndex_Parms.nEventIndex = nEventIndex;
@@ -1720,10 +1647,9 @@ class USFXOnlineEvent* USFXOnlineEventList::GetEventAtIndex ( int nEventIndex )
 
 class USFXOnlineEvent* USFXOnlineEventList::GetEvent ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnGetEvent = NULL;
-
+	UFunction* pFnGetEvent = (UFunction*) SdkBindings::Get ( 4168 );
 	if ( ! pFnGetEvent )
-		pFnGetEvent = (UFunction*) UObject::GObjObjects()->Data[ 40278 ];
+		return {};
 
 	USFXOnlineEventList_execGetEvent_Parms GetEvent_Parms;
 	GetEvent_Parms.oEvent = oEvent;
@@ -1745,10 +1671,9 @@ class USFXOnlineEvent* USFXOnlineEventList::GetEvent ( class USFXOnlineEvent* oE
 
 bool USFXOnlineEventList::AddEvent ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnAddEvent = NULL;
-
+	UFunction* pFnAddEvent = (UFunction*) SdkBindings::Get ( 4167 );
 	if ( ! pFnAddEvent )
-		pFnAddEvent = (UFunction*) UObject::GObjObjects()->Data[ 40275 ];
+		return {};
 
 	USFXOnlineEventList_execAddEvent_Parms AddEvent_Parms;
 	AddEvent_Parms.oEvent = oEvent;
@@ -1769,10 +1694,9 @@ bool USFXOnlineEventList::AddEvent ( class USFXOnlineEvent* oEvent )
 
 struct FString UISFXOnlineComponentCommerce::DecryptOfflineEntitlementInfo ( )
 {
-	static UFunction* pFnDecryptOfflineEntitlementInfo = NULL;
-
+	UFunction* pFnDecryptOfflineEntitlementInfo = (UFunction*) SdkBindings::Get ( 3020 );
 	if ( ! pFnDecryptOfflineEntitlementInfo )
-		pFnDecryptOfflineEntitlementInfo = (UFunction*) UObject::GObjObjects()->Data[ 35466 ];
+		return {};
 
 	UISFXOnlineComponentCommerce_execDecryptOfflineEntitlementInfo_Parms DecryptOfflineEntitlementInfo_Parms;
 
@@ -1793,10 +1717,9 @@ struct FString UISFXOnlineComponentCommerce::DecryptOfflineEntitlementInfo ( )
 
 bool UISFXOnlineComponentCommerce::StoreOfflineEntitlementInfo ( struct FString a_sEncryptedContent )
 {
-	static UFunction* pFnStoreOfflineEntitlementInfo = NULL;
-
+	UFunction* pFnStoreOfflineEntitlementInfo = (UFunction*) SdkBindings::Get ( 3019 );
 	if ( ! pFnStoreOfflineEntitlementInfo )
-		pFnStoreOfflineEntitlementInfo = (UFunction*) UObject::GObjObjects()->Data[ 35463 ];
+		return {};
 
 	UISFXOnlineComponentCommerce_execStoreOfflineEntitlementInfo_Parms StoreOfflineEntitlementInfo_Parms;
 	memcpy ( &StoreOfflineEntitlementInfo_Parms.a_sEncryptedContent, &a_sEncryptedContent, 0xC );
@@ -1816,10 +1739,9 @@ bool UISFXOnlineComponentCommerce::StoreOfflineEntitlementInfo ( struct FString
 
 void UISFXOnlineComponentCommerce::DumpTestData ( )
 {
-	static UFunction* pFnDumpTestData = NULL;
-
+	UFunction* pFnDumpTestData = (UFunction*) SdkBindings::Get ( 3018 );
 	if ( ! pFnDumpTestData )
-		pFnDumpTestData = (UFunction*) UObject::GObjObjects()->Data[ 35462 ];
+		return;
 
 	UISFXOnlineComponentCommerce_execDumpTestData_Parms DumpTestData_Parms;
 
@@ -1836,10 +1758,9 @@ void UISFXOnlineComponentCommerce::DumpTestData ( )
 
 void UISFXOnlineComponentCommerce::NucleusEntitlementsRefreshOffline ( )
 {
-	static UFunction* pFnNucleusEntitlementsRefreshOffline = NULL;
-
+	UFunction* pFnNucleusEntitlementsRefreshOffline = (UFunction*) SdkBindings::Get ( 3017 );
 	if ( ! pFnNucleusEntitlementsRefreshOffline )
-		pFnNucleusEntitlementsRefreshOffline = (UFunction*) UObject::GObjObjects()->Data[ 35461 ];
+		return;
 
 	UISFXOnlineComponentCommerce_execNucleusEntitlementsRefreshOffline_Parms NucleusEntitlementsRefreshOffline_Parms;
 
@@ -1857,10 +1778,9 @@ void UISFXOnlineComponentCommerce::NucleusEntitlementsRefreshOffline ( )
 
 void UISFXOnlineComponentCommerce::LoadDimeConfig ( struct FString sConfig )
 {
-	static UFunction* pFnLoadDimeConfig = NULL;
-
+	UFunction* pFnLoadDimeConfig = (UFunction*) SdkBindings::Get ( 3016 );
 	if ( ! pFnLoadDimeConfig )
-		pFnLoadDimeConfig = (UFunction*) UObject::GObjObjects()->Data[ 35458 ];
+		return;
 
 	UISFXOnlineComponentCommerce_execLoadDimeConfig_Parms LoadDimeConfig_Parms;
 	memcpy ( &LoadDimeConfig_Parms.sConfig, &sConfig, 0xC );
@@ -1878,10 +1798,9 @@ void UISFXOnlineComponentCommerce::LoadDimeConfig ( struct FString sConfig )
 
 void UISFXOnlineComponentCommerce::OnDimeConfigLoaded ( )
 {
-	static UFunction* pFnOnDimeConfigLoaded = NULL;
-
+	UFunction* pFnOnDimeConfigLoaded = (UFunction*) SdkBindings::Get ( 3015 );
 	if ( ! pFnOnDimeConfigLoaded )
-		pFnOnDimeConfigLoaded = (UFunction*) UObject::GObjObjects()->Data[ 35457 ];
+		return;
 
 	UISFXOnlineComponentCommerce_execOnDimeConfigLoaded_Parms OnDimeConfigLoaded_Parms;
 
@@ -1895,10 +1814,9 @@ void UISFXOnlineComponentCommerce::OnDimeConfigLoaded ( )
 
 void UISFXOnlineComponentCommerce::FetchOfferDetails ( TArray< struct FBWOfferId > aOffers )
 {
-	static UFunction* pFnFetchOfferDetails = NULL;
-
+	UFunction* pFnFetchOfferDetails = (UFunction*) SdkBindings::Get ( 3014 );
 	if ( ! pFnFetchOfferDetails )
-		pFnFetchOfferDetails = (UFunction*) UObject::GObjObjects()->Data[ 35453 ];
+		return;
 
 	UISFXOnlineComponentCommerce_execFetchOfferDetails_Parms FetchOfferDetails_Parms;
 	memcpy ( &FetchOfferDetails_Parms.aOffers, &aOffers, 0xC );
@@ -1916,10 +1834,9 @@ void UISFXOnlineComponentCommerce::FetchOfferDetails ( TArray< struct FBWOfferId
 
 void UISFXOnlineComponentCommerce::OnFetchOfferDetailsComplete ( )
 {
-	static UFunction* pFnOnFetchOfferDetailsComplete = NULL;
-
+	UFunction* pFnOnFetchOfferDetailsComplete = (UFunction*) SdkBindings::Get ( 3013 );
 	if ( ! pFnOnFetchOfferDetailsComplete )
-		pFnOnFetchOfferDetailsComplete = (UFunction*) UObject::GObjObjects()->Data[ 35452 ];
+		return;
 
 	UISFXOnlineComponentCommerce_execOnFetchOfferDetailsComplete_Parms OnFetchOfferDetailsComplete_Parms;
 
@@ -1934,10 +1851,9 @@ void UISFXOnlineComponentCommerce::OnFetchOfferDetailsComplete ( )
 
 void UISFXOnlineComponentCommerce::eventGetOffersList ( TArray< struct FBWOfferId > aOfferFilter, TArray< struct FBWOfferInfo >* aOffers )
 {
-	static UFunction* pFnGetOffersList = NULL;
-
+	UFunction* pFnGetOffersList = (UFunction*) SdkBindings::Get ( 3012 );
 	if ( ! pFnGetOffersList )
-		pFnGetOffersList = (UFunction*) UObject::GObjObjects()->Data[ 35447 ];
+		return;
 
 	UISFXOnlineComponentCommerce_eventGetOffersList_Parms GetOffersList_Parms;
 	memcpy ( &GetOffersList_Parms.aOfferFilter, &aOfferFilter, 0xC );
@@ -1955,10 +1871,9 @@ void UISFXOnlineComponentCommerce::eventGetOffersList ( TArray< struct FBWOfferI
 
 struct FString UISFXOnlineComponentCommerce::GetWalletBalance ( )
 {
-	static UFunction* pFnGetWalletBalance = NULL;
-
+	UFunction* pFnGetWalletBalance = (UFunction*) SdkBindings::Get ( 3011 );
 	if ( ! pFnGetWalletBalance )
-		pFnGetWalletBalance = (UFunction*) UObject::GObjObjects()->Data[ 35445 ];
+		return {};
 
 	UISFXOnlineComponentCommerce_execGetWalletBalance_Parms GetWalletBalance_Parms;
 
@@ -1973,10 +1888,9 @@ struct FString UISFXOnlineComponentCommerce::GetWalletBalance ( )
 
 void UISFXOnlineComponentCommerce::Display1stPartyStore ( )
 {
-	static UFunction* pFnDisplay1stPartyStore = NULL;
-
+	UFunction* pFnDisplay1stPartyStore = (UFunction*) SdkBindings::Get ( 3010 );
 	if ( ! pFnDisplay1stPartyStore )
-		pFnDisplay1stPartyStore = (UFunction*) UObject::GObjObjects()->Data[ 35444 ];
+		return;
 
 	UISFXOnlineComponentCommerce_execDisplay1stPartyStore_Parms Display1stPartyStore_Parms;
 
@@ -1994,10 +1908,9 @@ void UISFXOnlineComponentCommerce::Display1stPartyStore ( )
 
 void UISFXOnlineComponentCommerce::PurchaseOfferId ( struct FBWOfferId Id )
 {
-	static UFunction* pFnPurchaseOfferId = NULL;
-
+	UFunction* pFnPurchaseOfferId = (UFunction*) SdkBindings::Get ( 3009 );
 	if ( ! pFnPurchaseOfferId )
-		pFnPurchaseOfferId = (UFunction*) UObject::GObjObjects()->Data[ 35441 ];
+		return;
 
 	UISFXOnlineComponentCommerce_execPurchaseOfferId_Parms PurchaseOfferId_Parms;
 	memcpy ( &PurchaseOfferId_Parms.Id, &Id, 0x4 );
@@ -2016,10 +1929,9 @@ void UISFXOnlineComponentCommerce::PurchaseOfferId ( struct FBWOfferId Id )
 
 void UISFXOnlineComponentCommerce::OnPurchaseOfferIdResult ( int nResult )
 {
-	static UFunction* pFnOnPurchaseOfferIdResult = NULL;
-
+	UFunction* pFnOnPurchaseOfferIdResult = (UFunction*) SdkBindings::Get ( 3008 );
 	if ( ! pFnOnPurchaseOfferIdResult )
-		pFnOnPurchaseOfferIdResult = (UFunction*) UObject::GObjObjects()->Data[ 35439 ];
+		return;
 
 	UISFXOnlineComponentCommerce_execOnPurchaseOfferIdResult_Parms OnPurchaseOfferIdResult_Parms;
 	OnPurchaseOfferIdResult_Parms.nResult = nResult;
@@ -2034,10 +1946,9 @@ void UISFXOnlineComponentCommerce::OnPurchaseOfferIdResult ( int nResult )
 
 void UISFXOnlineComponentCommerce::OnCodeRedeemed ( unsigned char nResult )
 {
-	static UFunction* pFnOnCodeRedeemed = NULL;
-
+	UFunction* pFnOnCodeRedeemed = (UFunction*) SdkBindings::Get ( 3007 );
 	if ( ! pFnOnCodeRedeemed )
-		pFnOnCodeRedeemed = (UFunction*) UObject::GObjObjects()->Data[ 35437 ];
+		return;
 
 	UISFXOnlineComponentCommerce_execOnCodeRedeemed_Parms OnCodeRedeemed_Parms;
 	OnCodeRedeemed_Parms.nResult = nResult;
@@ -2057,10 +1968,9 @@ void UISFXOnlineComponentCommerce::OnCodeRedeemed ( unsigned char nResult )
 
 void UISFXOnlineComponentCommerce::SubmitRedeemCode ( unsigned long bContinue, struct FString strCode )
 {
-	static UFunction* pFnSubmitRedeemCode = NULL;
-
+	UFunction* pFnSubmitRedeemCode = (UFunction*) SdkBindings::Get ( 3006 );
 	if ( ! pFnSubmitRedeemCode )
-		pFnSubmitRedeemCode = (UFunction*) UObject::GObjObjects()->Data[ 35434 ];
+		return;
 
 	UISFXOnlineComponentCommerce_execSubmitRedeemCode_Parms SubmitRedeemCode_Parms;
 	SubmitRedeemCode_Parms.bContinue = bContinue;
@@ -2079,10 +1989,9 @@ void UISFXOnlineComponentCommerce::SubmitRedeemCode ( unsigned long bContinue, s
 
 void UISFXOnlineComponentCommerce::PromptRedeemCode ( )
 {
-	static UFunction* pFnPromptRedeemCode = NULL;
-
+	UFunction* pFnPromptRedeemCode = (UFunction*) SdkBindings::Get ( 3005 );
 	if ( ! pFnPromptRedeemCode )
-		pFnPromptRedeemCode = (UFunction*) UObject::GObjObjects()->Data[ 35432 ];
+		return;
 
 	UISFXOnlineComponentCommerce_execPromptRedeemCode_Parms PromptRedeemCode_Parms;
 
@@ -2100,10 +2009,9 @@ void UISFXOnlineComponentCommerce::PromptRedeemCode ( )
 
 void UISFXOnlineComponentCommerce::OnPromptRedeemCodeResult ( int nResult )
 {
-	static UFunction* pFnOnPromptRedeemCodeResult = NULL;
-
+	UFunction* pFnOnPromptRedeemCodeResult = (UFunction*) SdkBindings::Get ( 3004 );
 	if ( ! pFnOnPromptRedeemCodeResult )
-		pFnOnPromptRedeemCodeResult = (UFunction*) UObject::GObjObjects()->Data[ 35430 ];
+		return;
 
 	UISFXOnlineComponentCommerce_execOnPromptRedeemCodeResult_Parms OnPromptRedeemCodeResult_Parms;
 	OnPromptRedeemCodeResult_Parms.nResult = nResult;
@@ -2117,10 +2025,9 @@ void UISFXOnlineComponentCommerce::OnPromptRedeemCodeResult ( int nResult )
 
 void UISFXOnlineComponentCommerce::ProcessAutoGrants ( )
 {
-	static UFunction* pFnProcessAutoGrants = NULL;
-
+	UFunction* pFnProcessAutoGrants = (UFunction*) SdkBindings::Get ( 3003 );
 	if ( ! pFnProcessAutoGrants )
-		pFnProcessAutoGrants = (UFunction*) UObject::GObjObjects()->Data[ 35428 ];
+		return;
 
 	UISFXOnlineComponentCommerce_execProcessAutoGrants_Parms ProcessAutoGrants_Parms;
 
@@ -2137,10 +2044,9 @@ void UISFXOnlineComponentCommerce::ProcessAutoGrants ( )
 
 void UISFXOnlineComponentCommerce::OnProcessAutoGrantsComplete ( )
 {
-	static UFunction* pFnOnProcessAutoGrantsComplete = NULL;
-
+	UFunction* pFnOnProcessAutoGrantsComplete = (UFunction*) SdkBindings::Get ( 3002 );
 	if ( ! pFnOnProcessAutoGrantsComplete )
-		pFnOnProcessAutoGrantsComplete = (UFunction*) UObject::GObjObjects()->Data[ 35427 ];
+		return;
 
 	UISFXOnlineComponentCommerce_execOnProcessAutoGrantsComplete_Parms OnProcessAutoGrantsComplete_Parms;
 
@@ -2156,10 +2062,9 @@ void UISFXOnlineComponentCommerce::OnProcessAutoGrantsComplete ( )
 
 bool UISFXOnlineComponentCommerce::GrantEntitlementId ( struct FBWEntitlementId Id, unsigned long bUseNucleusCheck )
 {
-	static UFunction* pFnGrantEntitlementId = NULL;
-
+	UFunction* pFnGrantEntitlementId = (UFunction*) SdkBindings::Get ( 3001 );
 	if ( ! pFnGrantEntitlementId )
-		pFnGrantEntitlementId = (UFunction*) UObject::GObjObjects()->Data[ 35422 ];
+		return {};
 
 	UISFXOnlineComponentCommerce_execGrantEntitlementId_Parms GrantEntitlementId_Parms;
 	memcpy ( &GrantEntitlementId_Parms.Id, &Id, 0x4 );
@@ -2182,10 +2087,9 @@ bool UISFXOnlineComponentCommerce::GrantEntitlementId ( struct FBWEntitlementId
 
 void UISFXOnlineComponentCommerce::OnGrantEntitlementResult ( struct FBWEntitlementId Id, int nResult )
 {
-	static UFunction* pFnOnGrantEntitlementResult = NULL;
-
+	UFunction* pFnOnGrantEntitlementResult = (UFunction*) SdkBindings::Get ( 3000 );
 	if ( ! pFnOnGrantEntitlementResult )
-		pFnOnGrantEntitlementResult = (UFunction*) UObject::GObjObjects()->Data[ 35419 ];
+		return;
 
 	UISFXOnlineComponentCommerce_execOnGrantEntitlementResult_Parms OnGrantEntitlementResult_Parms;
 	memcpy ( &OnGrantEntitlementResult_Parms.Id, &Id, 0x4 );
@@ -2203,10 +2107,9 @@ void UISFXOnlineComponentCommerce::OnGrantEntitlementResult ( struct FBWEntitlem
 
 bool UISFXOnlineComponentCommerce::ConsumeId ( struct FBWConsumableId Id, int nCopies )
 {
-	static UFunction* pFnConsumeId = NULL;
-
+	UFunction* pFnConsumeId = (UFunction*) SdkBindings::Get ( 2999 );
 	if ( ! pFnConsumeId )
-		pFnConsumeId = (UFunction*) UObject::GObjObjects()->Data[ 35414 ];
+		return {};
 
 	UISFXOnlineComponentCommerce_execConsumeId_Parms ConsumeId_Parms;
 	memcpy ( &ConsumeId_Parms.Id, &Id, 0x4 );
@@ -2230,10 +2133,9 @@ bool UISFXOnlineComponentCommerce::ConsumeId ( struct FBWConsumableId Id, int nC
 
 void UISFXOnlineComponentCommerce::OnConsumeResult ( struct FBWConsumableId Id, int nCopies, int nResult )
 {
-	static UFunction* pFnOnConsumeResult = NULL;
-
+	UFunction* pFnOnConsumeResult = (UFunction*) SdkBindings::Get ( 2998 );
 	if ( ! pFnOnConsumeResult )
-		pFnOnConsumeResult = (UFunction*) UObject::GObjObjects()->Data[ 35410 ];
+		return;
 
 	UISFXOnlineComponentCommerce_execOnConsumeResult_Parms OnConsumeResult_Parms;
 	memcpy ( &OnConsumeResult_Parms.Id, &Id, 0x4 );
@@ -2252,10 +2154,9 @@ void UISFXOnlineComponentCommerce::OnConsumeResult ( struct FBWConsumableId Id,
 
 bool UISFXOnlineComponentCommerce::eventGetConsumableInfo ( struct FBWConsumableId Id, struct FBWConsumableInfo* oConsumable )
 {
-	static UFunction* pFnGetConsumableInfo = NULL;
-
+	UFunction* pFnGetConsumableInfo = (UFunction*) SdkBindings::Get ( 2997 );
 	if ( ! pFnGetConsumableInfo )
-		pFnGetConsumableInfo = (UFunction*) UObject::GObjObjects()->Data[ 35406 ];
+		return {};
 
 	UISFXOnlineComponentCommerce_eventGetConsumableInfo_Parms GetConsumableInfo_Parms;
 	memcpy ( &GetConsumableInfo_Parms.Id, &Id, 0x4 );
@@ -2276,10 +2177,9 @@ bool UISFXOnlineComponentCommerce::eventGetConsumableInfo ( struct FBWConsumable
 
 bool UISFXOnlineComponentCommerce::eventGetConsumablesList ( TArray< struct FBWConsumableInfo >* aConsumables )
 {
-	static UFunction* pFnGetConsumablesList = NULL;
-
+	UFunction* pFnGetConsumablesList = (UFunction*) SdkBindings::Get ( 2996 );
 	if ( ! pFnGetConsumablesList )
-		pFnGetConsumablesList = (UFunction*) UObject::GObjObjects()->Data[ 35402 ];
+		return {};
 
 	UISFXOnlineComponentCommerce_eventGetConsumablesList_Parms GetConsumablesList_Parms;
 
@@ -2300,10 +2200,9 @@ bool UISFXOnlineComponentCommerce::eventGetConsumablesList ( TArray< struct FBWC
 
 bool UISFXOnlineComponentCommerce::eventGetEntitlementInfo ( struct FBWEntitlementId Id, struct FBWEntitlementInfo* oEntitlement )
 {
-	static UFunction* pFnGetEntitlementInfo = NULL;
-
+	UFunction* pFnGetEntitlementInfo = (UFunction*) SdkBindings::Get ( 2995 );
 	if ( ! pFnGetEntitlementInfo )
-		pFnGetEntitlementInfo = (UFunction*) UObject::GObjObjects()->Data[ 35398 ];
+		return {};
 
 	UISFXOnlineComponentCommerce_eventGetEntitlementInfo_Parms GetEntitlementInfo_Parms;
 	memcpy ( &GetEntitlementInfo_Parms.Id, &Id, 0x4 );
@@ -2324,10 +2223,9 @@ bool UISFXOnlineComponentCommerce::eventGetEntitlementInfo ( struct FBWEntitleme
 
 bool UISFXOnlineComponentCommerce::eventGetEntitlementsList ( TArray< struct FBWEntitlementInfo >* aEntitlements )
 {
-	static UFunction* pFnGetEntitlementsList = NULL;
-
+	UFunction* pFnGetEntitlementsList = (UFunction*) SdkBindings::Get ( 2994 );
 	if ( ! pFnGetEntitlementsList )
-		pFnGetEntitlementsList = (UFunction*) UObject::GObjObjects()->Data[ 35394 ];
+		return {};
 
 	UISFXOnlineComponentCommerce_eventGetEntitlementsList_Parms GetEntitlementsList_Parms;
 
@@ -2345,10 +2243,9 @@ bool UISFXOnlineComponentCommerce::eventGetEntitlementsList ( TArray< struct FBW
 
 void UISFXOnlineComponentCommerce::RefreshDigitalRights ( )
 {
-	static UFunction* pFnRefreshDigitalRights = NULL;
-
+	UFunction* pFnRefreshDigitalRights = (UFunction*) SdkBindings::Get ( 2993 );
 	if ( ! pFnRefreshDigitalRights )
-		pFnRefreshDigitalRights = (UFunction*) UObject::GObjObjects()->Data[ 35392 ];
+		return;
 
 	UISFXOnlineComponentCommerce_execRefreshDigitalRights_Parms RefreshDigitalRights_Parms;
 
@@ -2366,10 +2263,9 @@ void UISFXOnlineComponentCommerce::RefreshDigitalRights ( )
 
 void UISFXOnlineComponentCommerce::OnRefreshDigitalRightsResult ( int nResult )
 {
-	static UFunction* pFnOnRefreshDigitalRightsResult = NULL;
-
+	UFunction* pFnOnRefreshDigitalRightsResult = (UFunction*) SdkBindings::Get ( 2992 );
 	if ( ! pFnOnRefreshDigitalRightsResult )
-		pFnOnRefreshDigitalRightsResult = (UFunction*) UObject::GObjObjects()->Data[ 35390 ];
+		return;
 
 	UISFXOnlineComponentCommerce_execOnRefreshDigitalRightsResult_Parms OnRefreshDigitalRightsResult_Parms;
 	OnRefreshDigitalRightsResult_Parms.nResult = nResult;
@@ -2384,10 +2280,9 @@ void UISFXOnlineComponentCommerce::OnRefreshDigitalRightsResult ( int nResult )
 
 void UISFXOnlineComponentGalaxyAtWar::eventSetBaseURL ( struct FString BaseUrl )
 {
-	static UFunction* pFnSetBaseURL = NULL;
-
+	UFunction* pFnSetBaseURL = (UFunction*) SdkBindings::Get ( 3046 );
 	if ( ! pFnSetBaseURL )
-		pFnSetBaseURL = (UFunction*) UObject::GObjObjects()->Data[ 35595 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_eventSetBaseURL_Parms SetBaseURL_Parms;
 	memcpy ( &SetBaseURL_Parms.BaseUrl, &BaseUrl, 0xC );
@@ -2404,10 +2299,9 @@ void UISFXOnlineComponentGalaxyAtWar::eventSetBaseURL ( struct FString BaseUrl )
 
 void UISFXOnlineComponentGalaxyAtWar::eventParseTouchMessagesResult ( class USFXOnlineHTTPRequest* request, int* numMsgs, int* errorCode )
 {
-	static UFunction* pFnParseTouchMessagesResult = NULL;
-
+	UFunction* pFnParseTouchMessagesResult = (UFunction*) SdkBindings::Get ( 3045 );
 	if ( ! pFnParseTouchMessagesResult )
-		pFnParseTouchMessagesResult = (UFunction*) UObject::GObjObjects()->Data[ 35591 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_eventParseTouchMessagesResult_Parms ParseTouchMessagesResult_Parms;
 	ParseTouchMessagesResult_Parms.request = request;
@@ -2429,10 +2323,9 @@ void UISFXOnlineComponentGalaxyAtWar::eventParseTouchMessagesResult ( class USFX
 
 void UISFXOnlineComponentGalaxyAtWar::GetTouchMessagesHTTPRequest ( int msgType, class USFXOnlineHTTPRequest** pSFXOnlineHTTPRequest )
 {
-	static UFunction* pFnGetTouchMessagesHTTPRequest = NULL;
-
+	UFunction* pFnGetTouchMessagesHTTPRequest = (UFunction*) SdkBindings::Get ( 3044 );
 	if ( ! pFnGetTouchMessagesHTTPRequest )
-		pFnGetTouchMessagesHTTPRequest = (UFunction*) UObject::GObjObjects()->Data[ 35588 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_execGetTouchMessagesHTTPRequest_Parms GetTouchMessagesHTTPRequest_Parms;
 	GetTouchMessagesHTTPRequest_Parms.msgType = msgType;
@@ -2456,10 +2349,9 @@ void UISFXOnlineComponentGalaxyAtWar::GetTouchMessagesHTTPRequest ( int msgType,
 
 void UISFXOnlineComponentGalaxyAtWar::eventParseGetMessagesResult ( class USFXOnlineHTTPRequest* request, TArray< struct FMessageEntry >* messageEntries, int* errorCode )
 {
-	static UFunction* pFnParseGetMessagesResult = NULL;
-
+	UFunction* pFnParseGetMessagesResult = (UFunction*) SdkBindings::Get ( 3043 );
 	if ( ! pFnParseGetMessagesResult )
-		pFnParseGetMessagesResult = (UFunction*) UObject::GObjObjects()->Data[ 35583 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_eventParseGetMessagesResult_Parms ParseGetMessagesResult_Parms;
 	ParseGetMessagesResult_Parms.request = request;
@@ -2481,10 +2373,9 @@ void UISFXOnlineComponentGalaxyAtWar::eventParseGetMessagesResult ( class USFXOn
 
 void UISFXOnlineComponentGalaxyAtWar::GetGetMessagesHTTPRequest ( int msgType, class USFXOnlineHTTPRequest** pSFXOnlineHTTPRequest )
 {
-	static UFunction* pFnGetGetMessagesHTTPRequest = NULL;
-
+	UFunction* pFnGetGetMessagesHTTPRequest = (UFunction*) SdkBindings::Get ( 3042 );
 	if ( ! pFnGetGetMessagesHTTPRequest )
-		pFnGetGetMessagesHTTPRequest = (UFunction*) UObject::GObjObjects()->Data[ 35580 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_execGetGetMessagesHTTPRequest_Parms GetGetMessagesHTTPRequest_Parms;
 	GetGetMessagesHTTPRequest_Parms.msgType = msgType;
@@ -2509,10 +2400,9 @@ void UISFXOnlineComponentGalaxyAtWar::GetGetMessagesHTTPRequest ( int msgType, c
 
 void UISFXOnlineComponentGalaxyAtWar::eventParseSendMessageResult ( class USFXOnlineHTTPRequest* request, int* messageId, TArray< int >* messageIds, int* errorCode )
 {
-	static UFunction* pFnParseSendMessageResult = NULL;
-
+	UFunction* pFnParseSendMessageResult = (UFunction*) SdkBindings::Get ( 3041 );
 	if ( ! pFnParseSendMessageResult )
-		pFnParseSendMessageResult = (UFunction*) UObject::GObjObjects()->Data[ 35574 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_eventParseSendMessageResult_Parms ParseSendMessageResult_Parms;
 	ParseSendMessageResult_Parms.request = request;
@@ -2540,10 +2430,9 @@ void UISFXOnlineComponentGalaxyAtWar::eventParseSendMessageResult ( class USFXOn
 
 void UISFXOnlineComponentGalaxyAtWar::GetSendMessageHTTPRequest ( int msgType, struct FString param1, struct FString param2, struct FString param3, class USFXOnlineHTTPRequest** pSFXOnlineHTTPRequest )
 {
-	static UFunction* pFnGetSendMessageHTTPRequest = NULL;
-
+	UFunction* pFnGetSendMessageHTTPRequest = (UFunction*) SdkBindings::Get ( 3040 );
 	if ( ! pFnGetSendMessageHTTPRequest )
-		pFnGetSendMessageHTTPRequest = (UFunction*) UObject::GObjObjects()->Data[ 35568 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_execGetSendMessageHTTPRequest_Parms GetSendMessageHTTPRequest_Parms;
 	GetSendMessageHTTPRequest_Parms.msgType = msgType;
@@ -2572,10 +2461,9 @@ void UISFXOnlineComponentGalaxyAtWar::GetSendMessageHTTPRequest ( int msgType, s
 
 void UISFXOnlineComponentGalaxyAtWar::eventParseHTTPRatingsAssetsLevel ( class USFXOnlineHTTPRequest* request, TArray< int >* updatedSecurityRatings, TArray< int >* updatedWarAssets, int* Level, int* errorCode )
 {
-	static UFunction* pFnParseHTTPRatingsAssetsLevel = NULL;
-
+	UFunction* pFnParseHTTPRatingsAssetsLevel = (UFunction*) SdkBindings::Get ( 3039 );
 	if ( ! pFnParseHTTPRatingsAssetsLevel )
-		pFnParseHTTPRatingsAssetsLevel = (UFunction*) UObject::GObjObjects()->Data[ 35560 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_eventParseHTTPRatingsAssetsLevel_Parms ParseHTTPRatingsAssetsLevel_Parms;
 	ParseHTTPRatingsAssetsLevel_Parms.request = request;
@@ -2605,10 +2493,9 @@ void UISFXOnlineComponentGalaxyAtWar::eventParseHTTPRatingsAssetsLevel ( class U
 
 void UISFXOnlineComponentGalaxyAtWar::GetIncreaseRatingsHTTPRequest ( int defaultRatingIncrease, TArray< struct FMapEntry > securityRatingsIncrease, TArray< struct FMapEntry > warAssetsIncrease, class USFXOnlineHTTPRequest** pSFXOnlineHTTPRequest )
 {
-	static UFunction* pFnGetIncreaseRatingsHTTPRequest = NULL;
-
+	UFunction* pFnGetIncreaseRatingsHTTPRequest = (UFunction*) SdkBindings::Get ( 3038 );
 	if ( ! pFnGetIncreaseRatingsHTTPRequest )
-		pFnGetIncreaseRatingsHTTPRequest = (UFunction*) UObject::GObjObjects()->Data[ 35553 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_execGetIncreaseRatingsHTTPRequest_Parms GetIncreaseRatingsHTTPRequest_Parms;
 	GetIncreaseRatingsHTTPRequest_Parms.defaultRatingIncrease = defaultRatingIncrease;
@@ -2633,10 +2520,9 @@ void UISFXOnlineComponentGalaxyAtWar::GetIncreaseRatingsHTTPRequest ( int defaul
 
 void UISFXOnlineComponentGalaxyAtWar::GetRatingsHTTPRequest ( unsigned long getAssets, class USFXOnlineHTTPRequest** pSFXOnlineHTTPRequest )
 {
-	static UFunction* pFnGetRatingsHTTPRequest = NULL;
-
+	UFunction* pFnGetRatingsHTTPRequest = (UFunction*) SdkBindings::Get ( 3037 );
 	if ( ! pFnGetRatingsHTTPRequest )
-		pFnGetRatingsHTTPRequest = (UFunction*) UObject::GObjObjects()->Data[ 35550 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_execGetRatingsHTTPRequest_Parms GetRatingsHTTPRequest_Parms;
 	GetRatingsHTTPRequest_Parms.getAssets = getAssets;
@@ -2659,10 +2545,9 @@ void UISFXOnlineComponentGalaxyAtWar::GetRatingsHTTPRequest ( unsigned long getA
 
 int UISFXOnlineComponentGalaxyAtWar::eventParseAuthenticationResult ( class USFXOnlineHTTPRequest* request )
 {
-	static UFunction* pFnParseAuthenticationResult = NULL;
-
+	UFunction* pFnParseAuthenticationResult = (UFunction*) SdkBindings::Get ( 3036 );
 	if ( ! pFnParseAuthenticationResult )
-		pFnParseAuthenticationResult = (UFunction*) UObject::GObjObjects()->Data[ 35547 ];
+		return {};
 
 	UISFXOnlineComponentGalaxyAtWar_eventParseAuthenticationResult_Parms ParseAuthenticationResult_Parms;
 	ParseAuthenticationResult_Parms.request = request;
@@ -2681,10 +2566,9 @@ int UISFXOnlineComponentGalaxyAtWar::eventParseAuthenticationResult ( class USFX
 
 void UISFXOnlineComponentGalaxyAtWar::GetAuthenticationHTTPRequest ( struct FString token, int tokenType, class USFXOnlineHTTPRequest** pSFXOnlineHTTPRequest )
 {
-	static UFunction* pFnGetAuthenticationHTTPRequest = NULL;
-
+	UFunction* pFnGetAuthenticationHTTPRequest = (UFunction*) SdkBindings::Get ( 3035 );
 	if ( ! pFnGetAuthenticationHTTPRequest )
-		pFnGetAuthenticationHTTPRequest = (UFunction*) UObject::GObjObjects()->Data[ 35543 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_execGetAuthenticationHTTPRequest_Parms GetAuthenticationHTTPRequest_Parms;
 	memcpy ( &GetAuthenticationHTTPRequest_Parms.token, &token, 0xC );
@@ -2706,10 +2590,9 @@ void UISFXOnlineComponentGalaxyAtWar::GetAuthenticationHTTPRequest ( struct FStr
 
 void UISFXOnlineComponentGalaxyAtWar::eventInvalidateSession ( )
 {
-	static UFunction* pFnInvalidateSession = NULL;
-
+	UFunction* pFnInvalidateSession = (UFunction*) SdkBindings::Get ( 3034 );
 	if ( ! pFnInvalidateSession )
-		pFnInvalidateSession = (UFunction*) UObject::GObjObjects()->Data[ 35542 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_eventInvalidateSession_Parms InvalidateSession_Parms;
 
@@ -2723,10 +2606,9 @@ void UISFXOnlineComponentGalaxyAtWar::eventInvalidateSession ( )
 
 bool UISFXOnlineComponentGalaxyAtWar::eventIsSessionValid ( )
 {
-	static UFunction* pFnIsSessionValid = NULL;
-
+	UFunction* pFnIsSessionValid = (UFunction*) SdkBindings::Get ( 3033 );
 	if ( ! pFnIsSessionValid )
-		pFnIsSessionValid = (UFunction*) UObject::GObjObjects()->Data[ 35540 ];
+		return {};
 
 	UISFXOnlineComponentGalaxyAtWar_eventIsSessionValid_Parms IsSessionValid_Parms;
 
@@ -2741,10 +2623,9 @@ bool UISFXOnlineComponentGalaxyAtWar::eventIsSessionValid ( )
 
 void UISFXOnlineComponentGalaxyAtWar::Cleanup ( )
 {
-	static UFunction* pFnCleanup = NULL;
-
+	UFunction* pFnCleanup = (UFunction*) SdkBindings::Get ( 3032 );
 	if ( ! pFnCleanup )
-		pFnCleanup = (UFunction*) UObject::GObjObjects()->Data[ 35539 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_execCleanup_Parms Cleanup_Parms;
 
@@ -2762,10 +2643,9 @@ void UISFXOnlineComponentGalaxyAtWar::Cleanup ( )
 
 void UISFXOnlineComponentGalaxyAtWar::TouchMessages ( int msgType )
 {
-	static UFunction* pFnTouchMessages = NULL;
-
+	UFunction* pFnTouchMessages = (UFunction*) SdkBindings::Get ( 3031 );
 	if ( ! pFnTouchMessages )
-		pFnTouchMessages = (UFunction*) UObject::GObjObjects()->Data[ 35536 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_execTouchMessages_Parms TouchMessages_Parms;
 	TouchMessages_Parms.msgType = msgType;
@@ -2784,10 +2664,9 @@ void UISFXOnlineComponentGalaxyAtWar::TouchMessages ( int msgType )
 
 void UISFXOnlineComponentGalaxyAtWar::GetMessages ( int msgType )
 {
-	static UFunction* pFnGetMessages = NULL;
-
+	UFunction* pFnGetMessages = (UFunction*) SdkBindings::Get ( 3030 );
 	if ( ! pFnGetMessages )
-		pFnGetMessages = (UFunction*) UObject::GObjObjects()->Data[ 35533 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_execGetMessages_Parms GetMessages_Parms;
 	GetMessages_Parms.msgType = msgType;
@@ -2809,10 +2688,9 @@ void UISFXOnlineComponentGalaxyAtWar::GetMessages ( int msgType )
 
 void UISFXOnlineComponentGalaxyAtWar::SendMessage ( int msgType, struct FString sendMsgParam1, unsigned char ParamType, struct FString sendMsgParam3 )
 {
-	static UFunction* pFnSendMessage = NULL;
-
+	UFunction* pFnSendMessage = (UFunction*) SdkBindings::Get ( 3029 );
 	if ( ! pFnSendMessage )
-		pFnSendMessage = (UFunction*) UObject::GObjObjects()->Data[ 35527 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_execSendMessage_Parms SendMessage_Parms;
 	SendMessage_Parms.msgType = msgType;
@@ -2836,10 +2714,9 @@ void UISFXOnlineComponentGalaxyAtWar::SendMessage ( int msgType, struct FString
 
 void UISFXOnlineComponentGalaxyAtWar::IncreaseRatings ( int defaultRatingIncrease, TArray< struct FMapEntry > securityRatingIncrease, TArray< struct FMapEntry > warAssetIncrease )
 {
-	static UFunction* pFnIncreaseRatings = NULL;
-
+	UFunction* pFnIncreaseRatings = (UFunction*) SdkBindings::Get ( 3028 );
 	if ( ! pFnIncreaseRatings )
-		pFnIncreaseRatings = (UFunction*) UObject::GObjObjects()->Data[ 35517 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_execIncreaseRatings_Parms IncreaseRatings_Parms;
 	IncreaseRatings_Parms.defaultRatingIncrease = defaultRatingIncrease;
@@ -2861,10 +2738,9 @@ void UISFXOnlineComponentGalaxyAtWar::IncreaseRatings ( int defaultRatingIncreas
 
 void UISFXOnlineComponentGalaxyAtWar::GetRatings ( unsigned long getWarAssets, unsigned long bCached )
 {
-	static UFunction* pFnGetRatings = NULL;
-
+	UFunction* pFnGetRatings = (UFunction*) SdkBindings::Get ( 3027 );
 	if ( ! pFnGetRatings )
-		pFnGetRatings = (UFunction*) UObject::GObjObjects()->Data[ 35513 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_execGetRatings_Parms GetRatings_Parms;
 	GetRatings_Parms.getWarAssets = getWarAssets;
@@ -2885,10 +2761,9 @@ void UISFXOnlineComponentGalaxyAtWar::GetRatings ( unsigned long getWarAssets, u
 
 void UISFXOnlineComponentGalaxyAtWar::OnTouchMessagesComplete ( int Count, int errorCode )
 {
-	static UFunction* pFnOnTouchMessagesComplete = NULL;
-
+	UFunction* pFnOnTouchMessagesComplete = (UFunction*) SdkBindings::Get ( 3026 );
 	if ( ! pFnOnTouchMessagesComplete )
-		pFnOnTouchMessagesComplete = (UFunction*) UObject::GObjObjects()->Data[ 35510 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_execOnTouchMessagesComplete_Parms OnTouchMessagesComplete_Parms;
 	OnTouchMessagesComplete_Parms.Count = Count;
@@ -2905,10 +2780,9 @@ void UISFXOnlineComponentGalaxyAtWar::OnTouchMessagesComplete ( int Count, int e
 
 void UISFXOnlineComponentGalaxyAtWar::OnGetMessagesComplete ( TArray< struct FMessageEntry > Messages, int errorCode )
 {
-	static UFunction* pFnOnGetMessagesComplete = NULL;
-
+	UFunction* pFnOnGetMessagesComplete = (UFunction*) SdkBindings::Get ( 3025 );
 	if ( ! pFnOnGetMessagesComplete )
-		pFnOnGetMessagesComplete = (UFunction*) UObject::GObjObjects()->Data[ 35499 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_execOnGetMessagesComplete_Parms OnGetMessagesComplete_Parms;
 	memcpy ( &OnGetMessagesComplete_Parms.Messages, &Messages, 0xC );
@@ -2926,10 +2800,9 @@ void UISFXOnlineComponentGalaxyAtWar::OnGetMessagesComplete ( TArray< struct FMe
 
 void UISFXOnlineComponentGalaxyAtWar::OnSendMessageComplete ( int messageId, TArray< int > messageIds, int errorCode )
 {
-	static UFunction* pFnOnSendMessageComplete = NULL;
-
+	UFunction* pFnOnSendMessageComplete = (UFunction*) SdkBindings::Get ( 3024 );
 	if ( ! pFnOnSendMessageComplete )
-		pFnOnSendMessageComplete = (UFunction*) UObject::GObjObjects()->Data[ 35494 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_execOnSendMessageComplete_Parms OnSendMessageComplete_Parms;
 	OnSendMessageComplete_Parms.messageId = messageId;
@@ -2949,10 +2822,9 @@ void UISFXOnlineComponentGalaxyAtWar::OnSendMessageComplete ( int messageId, TAr
 
 void UISFXOnlineComponentGalaxyAtWar::OnIncreaseRatingsComplete ( TArray< int > updatedSecurityRatings, TArray< int > updatedWarAssets, int Level, int errorCode )
 {
-	static UFunction* pFnOnIncreaseRatingsComplete = NULL;
-
+	UFunction* pFnOnIncreaseRatingsComplete = (UFunction*) SdkBindings::Get ( 3023 );
 	if ( ! pFnOnIncreaseRatingsComplete )
-		pFnOnIncreaseRatingsComplete = (UFunction*) UObject::GObjObjects()->Data[ 35487 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_execOnIncreaseRatingsComplete_Parms OnIncreaseRatingsComplete_Parms;
 	memcpy ( &OnIncreaseRatingsComplete_Parms.updatedSecurityRatings, &updatedSecurityRatings, 0xC );
@@ -2973,10 +2845,9 @@ void UISFXOnlineComponentGalaxyAtWar::OnIncreaseRatingsComplete ( TArray< int >
 
 void UISFXOnlineComponentGalaxyAtWar::OnGetRatingsComplete ( TArray< int > updatedSecurityRatings, TArray< int > updatedWarAssets, int Level, int errorCode )
 {
-	static UFunction* pFnOnGetRatingsComplete = NULL;
-
+	UFunction* pFnOnGetRatingsComplete = (UFunction*) SdkBindings::Get ( 3022 );
 	if ( ! pFnOnGetRatingsComplete )
-		pFnOnGetRatingsComplete = (UFunction*) UObject::GObjObjects()->Data[ 35480 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_execOnGetRatingsComplete_Parms OnGetRatingsComplete_Parms;
 	memcpy ( &OnGetRatingsComplete_Parms.updatedSecurityRatings, &updatedSecurityRatings, 0xC );
@@ -2994,10 +2865,9 @@ void UISFXOnlineComponentGalaxyAtWar::OnGetRatingsComplete ( TArray< int > updat
 
 void UISFXOnlineComponentGalaxyAtWar::AuthenticateCompleted ( int errorCode )
 {
-	static UFunction* pFnAuthenticateCompleted = NULL;
-
+	UFunction* pFnAuthenticateCompleted = (UFunction*) SdkBindings::Get ( 3021 );
 	if ( ! pFnAuthenticateCompleted )
-		pFnAuthenticateCompleted = (UFunction*) UObject::GObjObjects()->Data[ 35478 ];
+		return;
 
 	UISFXOnlineComponentGalaxyAtWar_execAuthenticateCompleted_Parms AuthenticateCompleted_Parms;
 	AuthenticateCompleted_Parms.errorCode = errorCode;
@@ -3012,10 +2882,9 @@ void UISFXOnlineComponentGalaxyAtWar::AuthenticateCompleted ( int errorCode )
 
 bool UISFXOnlineComponentLeaderboard::HasNotificationsAvailable ( )
 {
-	static UFunction* pFnHasNotificationsAvailable = NULL;
-
+	UFunction* pFnHasNotificationsAvailable = (UFunction*) SdkBindings::Get ( 3066 );
 	if ( ! pFnHasNotificationsAvailable )
-		pFnHasNotificationsAvailable = (UFunction*) UObject::GObjObjects()->Data[ 35906 ];
+		return {};
 
 	UISFXOnlineComponentLeaderboard_execHasNotificationsAvailable_Parms HasNotificationsAvailable_Parms;
 
@@ -3030,10 +2899,9 @@ bool UISFXOnlineComponentLeaderboard::HasNotificationsAvailable ( )
 
 void UISFXOnlineComponentLeaderboard::eventRemoveRankNotificationCallback ( )
 {
-	static UFunction* pFnRemoveRankNotificationCallback = NULL;
-
+	UFunction* pFnRemoveRankNotificationCallback = (UFunction*) SdkBindings::Get ( 3065 );
 	if ( ! pFnRemoveRankNotificationCallback )
-		pFnRemoveRankNotificationCallback = (UFunction*) UObject::GObjObjects()->Data[ 35904 ];
+		return;
 
 	UISFXOnlineComponentLeaderboard_eventRemoveRankNotificationCallback_Parms RemoveRankNotificationCallback_Parms;
 
@@ -3046,10 +2914,9 @@ void UISFXOnlineComponentLeaderboard::eventRemoveRankNotificationCallback ( )
 
 void UISFXOnlineComponentLeaderboard::eventAddRankNotificationCallback ( )
 {
-	static UFunction* pFnAddRankNotificationCallback = NULL;
-
+	UFunction* pFnAddRankNotificationCallback = (UFunction*) SdkBindings::Get ( 3064 );
 	if ( ! pFnAddRankNotificationCallback )
-		pFnAddRankNotificationCallback = (UFunction*) UObject::GObjObjects()->Data[ 35902 ];
+		return;
 
 	UISFXOnlineComponentLeaderboard_eventAddRankNotificationCallback_Parms AddRankNotificationCallback_Parms;
 
@@ -3063,10 +2930,9 @@ void UISFXOnlineComponentLeaderboard::eventAddRankNotificationCallback ( )
 
 TArray< struct FRankBypassNotification > UISFXOnlineComponentLeaderboard::GetCurrentRankNotificationsArray ( )
 {
-	static UFunction* pFnGetCurrentRankNotificationsArray = NULL;
-
+	UFunction* pFnGetCurrentRankNotificationsArray = (UFunction*) SdkBindings::Get ( 3062 );
 	if ( ! pFnGetCurrentRankNotificationsArray )
-		pFnGetCurrentRankNotificationsArray = (UFunction*) UObject::GObjObjects()->Data[ 35898 ];
+		return {};
 
 	UISFXOnlineComponentLeaderboard_execGetCurrentRankNotificationsArray_Parms GetCurrentRankNotificationsArray_Parms;
 
@@ -3081,10 +2947,9 @@ TArray< struct FRankBypassNotification > UISFXOnlineComponentLeaderboard::GetCur
 
 void UISFXOnlineComponentLeaderboard::RefreshLeaderboardTitles ( )
 {
-	static UFunction* pFnRefreshLeaderboardTitles = NULL;
-
+	UFunction* pFnRefreshLeaderboardTitles = (UFunction*) SdkBindings::Get ( 3063 );
 	if ( ! pFnRefreshLeaderboardTitles )
-		pFnRefreshLeaderboardTitles = (UFunction*) UObject::GObjObjects()->Data[ 35901 ];
+		return;
 
 	UISFXOnlineComponentLeaderboard_execRefreshLeaderboardTitles_Parms RefreshLeaderboardTitles_Parms;
 
@@ -3104,10 +2969,9 @@ void UISFXOnlineComponentLeaderboard::RefreshLeaderboardTitles ( )
 
 int UISFXOnlineComponentLeaderboard::ShowGamerCardForRecord ( unsigned char LocalUserNum, struct FLeaderboardRecord* Record )
 {
-	static UFunction* pFnShowGamerCardForRecord = NULL;
-
+	UFunction* pFnShowGamerCardForRecord = (UFunction*) SdkBindings::Get ( 3061 );
 	if ( ! pFnShowGamerCardForRecord )
-		pFnShowGamerCardForRecord = (UFunction*) UObject::GObjObjects()->Data[ 35894 ];
+		return {};
 
 	UISFXOnlineComponentLeaderboard_execShowGamerCardForRecord_Parms ShowGamerCardForRecord_Parms;
 	ShowGamerCardForRecord_Parms.LocalUserNum = LocalUserNum;
@@ -3131,10 +2995,9 @@ int UISFXOnlineComponentLeaderboard::ShowGamerCardForRecord ( unsigned char Loca
 
 void UISFXOnlineComponentLeaderboard::ReadLeaderboardList ( TArray< int >* jobIds )
 {
-	static UFunction* pFnReadLeaderboardList = NULL;
-
+	UFunction* pFnReadLeaderboardList = (UFunction*) SdkBindings::Get ( 3060 );
 	if ( ! pFnReadLeaderboardList )
-		pFnReadLeaderboardList = (UFunction*) UObject::GObjObjects()->Data[ 35890 ];
+		return;
 
 	UISFXOnlineComponentLeaderboard_execReadLeaderboardList_Parms ReadLeaderboardList_Parms;
 
@@ -3157,10 +3020,9 @@ void UISFXOnlineComponentLeaderboard::ReadLeaderboardList ( TArray< int >* jobId
 
 int UISFXOnlineComponentLeaderboard::GetFriendLeaderboardData ( int pLbId, struct FPointer pExternalData )
 {
-	static UFunction* pFnGetFriendLeaderboardData = NULL;
-
+	UFunction* pFnGetFriendLeaderboardData = (UFunction*) SdkBindings::Get ( 3059 );
 	if ( ! pFnGetFriendLeaderboardData )
-		pFnGetFriendLeaderboardData = (UFunction*) UObject::GObjObjects()->Data[ 35885 ];
+		return {};
 
 	UISFXOnlineComponentLeaderboard_execGetFriendLeaderboardData_Parms GetFriendLeaderboardData_Parms;
 	GetFriendLeaderboardData_Parms.pLbId = pLbId;
@@ -3186,10 +3048,9 @@ int UISFXOnlineComponentLeaderboard::GetFriendLeaderboardData ( int pLbId, struc
 
 int UISFXOnlineComponentLeaderboard::GetLeaderboardCenteredData ( int pLbId, struct FUniqueNetId nPlayerId, int nRankRange, struct FPointer pExternalData )
 {
-	static UFunction* pFnGetLeaderboardCenteredData = NULL;
-
+	UFunction* pFnGetLeaderboardCenteredData = (UFunction*) SdkBindings::Get ( 3058 );
 	if ( ! pFnGetLeaderboardCenteredData )
-		pFnGetLeaderboardCenteredData = (UFunction*) UObject::GObjObjects()->Data[ 35878 ];
+		return {};
 
 	UISFXOnlineComponentLeaderboard_execGetLeaderboardCenteredData_Parms GetLeaderboardCenteredData_Parms;
 	GetLeaderboardCenteredData_Parms.pLbId = pLbId;
@@ -3217,10 +3078,9 @@ int UISFXOnlineComponentLeaderboard::GetLeaderboardCenteredData ( int pLbId, str
 
 int UISFXOnlineComponentLeaderboard::GetLeaderboardData ( int pLbId, int nRankStart, int nRankRange, struct FPointer pExternalData )
 {
-	static UFunction* pFnGetLeaderboardData = NULL;
-
+	UFunction* pFnGetLeaderboardData = (UFunction*) SdkBindings::Get ( 3057 );
 	if ( ! pFnGetLeaderboardData )
-		pFnGetLeaderboardData = (UFunction*) UObject::GObjObjects()->Data[ 35871 ];
+		return {};
 
 	UISFXOnlineComponentLeaderboard_execGetLeaderboardData_Parms GetLeaderboardData_Parms;
 	GetLeaderboardData_Parms.pLbId = pLbId;
@@ -3243,10 +3103,9 @@ int UISFXOnlineComponentLeaderboard::GetLeaderboardData ( int pLbId, int nRankSt
 
 void UISFXOnlineComponentLeaderboard::CancelLeaderboardRequests ( )
 {
-	static UFunction* pFnCancelLeaderboardRequests = NULL;
-
+	UFunction* pFnCancelLeaderboardRequests = (UFunction*) SdkBindings::Get ( 3056 );
 	if ( ! pFnCancelLeaderboardRequests )
-		pFnCancelLeaderboardRequests = (UFunction*) UObject::GObjObjects()->Data[ 35870 ];
+		return;
 
 	UISFXOnlineComponentLeaderboard_execCancelLeaderboardRequests_Parms CancelLeaderboardRequests_Parms;
 
@@ -3263,10 +3122,9 @@ void UISFXOnlineComponentLeaderboard::CancelLeaderboardRequests ( )
 
 void UISFXOnlineComponentLeaderboard::RequestReadLeaderboardList ( )
 {
-	static UFunction* pFnRequestReadLeaderboardList = NULL;
-
+	UFunction* pFnRequestReadLeaderboardList = (UFunction*) SdkBindings::Get ( 3055 );
 	if ( ! pFnRequestReadLeaderboardList )
-		pFnRequestReadLeaderboardList = (UFunction*) UObject::GObjObjects()->Data[ 35869 ];
+		return;
 
 	UISFXOnlineComponentLeaderboard_execRequestReadLeaderboardList_Parms RequestReadLeaderboardList_Parms;
 
@@ -3283,10 +3141,9 @@ void UISFXOnlineComponentLeaderboard::RequestReadLeaderboardList ( )
 
 void UISFXOnlineComponentLeaderboard::GetRankNotifications ( )
 {
-	static UFunction* pFnGetRankNotifications = NULL;
-
+	UFunction* pFnGetRankNotifications = (UFunction*) SdkBindings::Get ( 3054 );
 	if ( ! pFnGetRankNotifications )
-		pFnGetRankNotifications = (UFunction*) UObject::GObjObjects()->Data[ 35868 ];
+		return;
 
 	UISFXOnlineComponentLeaderboard_execGetRankNotifications_Parms GetRankNotifications_Parms;
 
@@ -3307,10 +3164,9 @@ void UISFXOnlineComponentLeaderboard::GetRankNotifications ( )
 
 void UISFXOnlineComponentLeaderboard::RequestLeaderboardCenteredData ( struct FLeaderboardDefinition LeaderboardDef, struct FUniqueNetId nPlayerId, int nRankRange, struct FPointer pExternalData )
 {
-	static UFunction* pFnRequestLeaderboardCenteredData = NULL;
-
+	UFunction* pFnRequestLeaderboardCenteredData = (UFunction*) SdkBindings::Get ( 3053 );
 	if ( ! pFnRequestLeaderboardCenteredData )
-		pFnRequestLeaderboardCenteredData = (UFunction*) UObject::GObjObjects()->Data[ 35862 ];
+		return;
 
 	UISFXOnlineComponentLeaderboard_execRequestLeaderboardCenteredData_Parms RequestLeaderboardCenteredData_Parms;
 	memcpy ( &RequestLeaderboardCenteredData_Parms.LeaderboardDef, &LeaderboardDef, 0x14 );
@@ -3335,10 +3191,9 @@ void UISFXOnlineComponentLeaderboard::RequestLeaderboardCenteredData ( struct FL
 
 void UISFXOnlineComponentLeaderboard::RequestLeaderboardData ( struct FLeaderboardDefinition LeaderboardDef, int nRankStart, int nRankRange, struct FPointer pExternalData )
 {
-	static UFunction* pFnRequestLeaderboardData = NULL;
-
+	UFunction* pFnRequestLeaderboardData = (UFunction*) SdkBindings::Get ( 3052 );
 	if ( ! pFnRequestLeaderboardData )
-		pFnRequestLeaderboardData = (UFunction*) UObject::GObjObjects()->Data[ 35856 ];
+		return;
 
 	UISFXOnlineComponentLeaderboard_execRequestLeaderboardData_Parms RequestLeaderboardData_Parms;
 	memcpy ( &RequestLeaderboardData_Parms.LeaderboardDef, &LeaderboardDef, 0x14 );
@@ -3361,10 +3216,9 @@ void UISFXOnlineComponentLeaderboard::RequestLeaderboardData ( struct FLeaderboa
 
 bool UISFXOnlineComponentLeaderboard::GetLeaderboardDefinitionTable ( TArray< struct FLeaderboardMapGroup >* aLBDefTableRows )
 {
-	static UFunction* pFnGetLeaderboardDefinitionTable = NULL;
-
+	UFunction* pFnGetLeaderboardDefinitionTable = (UFunction*) SdkBindings::Get ( 3051 );
 	if ( ! pFnGetLeaderboardDefinitionTable )
-		pFnGetLeaderboardDefinitionTable = (UFunction*) UObject::GObjObjects()->Data[ 35852 ];
+		return {};
 
 	UISFXOnlineComponentLeaderboard_execGetLeaderboardDefinitionTable_Parms GetLeaderboardDefinitionTable_Parms;
 
@@ -3388,10 +3242,9 @@ bool UISFXOnlineComponentLeaderboard::GetLeaderboardDefinitionTable ( TArray< st
 
 bool UISFXOnlineComponentLeaderboard::GetLeaderboardDefinitions ( TArray< struct FLeaderboardDefinition >* aLBDefinitions )
 {
-	static UFunction* pFnGetLeaderboardDefinitions = NULL;
-
+	UFunction* pFnGetLeaderboardDefinitions = (UFunction*) SdkBindings::Get ( 3050 );
 	if ( ! pFnGetLeaderboardDefinitions )
-		pFnGetLeaderboardDefinitions = (UFunction*) UObject::GObjObjects()->Data[ 35848 ];
+		return {};
 
 	UISFXOnlineComponentLeaderboard_execGetLeaderboardDefinitions_Parms GetLeaderboardDefinitions_Parms;
 
@@ -3414,10 +3267,9 @@ bool UISFXOnlineComponentLeaderboard::GetLeaderboardDefinitions ( TArray< struct
 
 void UISFXOnlineComponentLeaderboard::OnGetRankNotificationsCompleted ( TArray< struct FRankBypassNotification > RankBypassNotificationArray )
 {
-	static UFunction* pFnOnGetRankNotificationsCompleted = NULL;
-
+	UFunction* pFnOnGetRankNotificationsCompleted = (UFunction*) SdkBindings::Get ( 3049 );
 	if ( ! pFnOnGetRankNotificationsCompleted )
-		pFnOnGetRankNotificationsCompleted = (UFunction*) UObject::GObjObjects()->Data[ 35845 ];
+		return;
 
 	UISFXOnlineComponentLeaderboard_execOnGetRankNotificationsCompleted_Parms OnGetRankNotificationsCompleted_Parms;
 	memcpy ( &OnGetRankNotificationsCompleted_Parms.RankBypassNotificationArray, &RankBypassNotificationArray, 0xC );
@@ -3432,10 +3284,9 @@ void UISFXOnlineComponentLeaderboard::OnGetRankNotificationsCompleted ( TArray<
 
 void UISFXOnlineComponentLeaderboard::OnReadLbListCompleted ( unsigned char errorCode )
 {
-	static UFunction* pFnOnReadLbListCompleted = NULL;
-
+	UFunction* pFnOnReadLbListCompleted = (UFunction*) SdkBindings::Get ( 3048 );
 	if ( ! pFnOnReadLbListCompleted )
-		pFnOnReadLbListCompleted = (UFunction*) UObject::GObjObjects()->Data[ 35843 ];
+		return;
 
 	UISFXOnlineComponentLeaderboard_execOnReadLbListCompleted_Parms OnReadLbListCompleted_Parms;
 	OnReadLbListCompleted_Parms.errorCode = errorCode;
@@ -3455,10 +3306,9 @@ void UISFXOnlineComponentLeaderboard::OnReadLbListCompleted ( unsigned char erro
 
 void UISFXOnlineComponentLeaderboard::OnResultsRetrieved ( TArray< struct FLeaderboardColumn > aColumnInfo, TArray< struct FLeaderboardRecord > aResults, int iTotalRanks, struct FUniqueNetId uidEntity, unsigned char nErrorCode, struct FPointer pExternalData )
 {
-	static UFunction* pFnOnResultsRetrieved = NULL;
-
+	UFunction* pFnOnResultsRetrieved = (UFunction*) SdkBindings::Get ( 3047 );
 	if ( ! pFnOnResultsRetrieved )
-		pFnOnResultsRetrieved = (UFunction*) UObject::GObjObjects()->Data[ 35834 ];
+		return;
 
 	UISFXOnlineComponentLeaderboard_execOnResultsRetrieved_Parms OnResultsRetrieved_Parms;
 	memcpy ( &OnResultsRetrieved_Parms.aColumnInfo, &aColumnInfo, 0xC );
@@ -3478,10 +3328,9 @@ void UISFXOnlineComponentLeaderboard::OnResultsRetrieved ( TArray< struct FLeade
 
 void UISFXOnlineComponentLogin::SetExternalDRMDataLoaded ( unsigned long bValue )
 {
-	static UFunction* pFnSetExternalDRMDataLoaded = NULL;
-
+	UFunction* pFnSetExternalDRMDataLoaded = (UFunction*) SdkBindings::Get ( 3120 );
 	if ( ! pFnSetExternalDRMDataLoaded )
-		pFnSetExternalDRMDataLoaded = (UFunction*) UObject::GObjObjects()->Data[ 36049 ];
+		return;
 
 	UISFXOnlineComponentLogin_execSetExternalDRMDataLoaded_Parms SetExternalDRMDataLoaded_Parms;
 	SetExternalDRMDataLoaded_Parms.bValue = bValue;
@@ -3499,10 +3348,9 @@ void UISFXOnlineComponentLogin::SetExternalDRMDataLoaded ( unsigned long bValue
 
 void UISFXOnlineComponentLogin::StartCerberusLogin ( )
 {
-	static UFunction* pFnStartCerberusLogin = NULL;
-
+	UFunction* pFnStartCerberusLogin = (UFunction*) SdkBindings::Get ( 3119 );
 	if ( ! pFnStartCerberusLogin )
-		pFnStartCerberusLogin = (UFunction*) UObject::GObjObjects()->Data[ 36047 ];
+		return;
 
 	UISFXOnlineComponentLogin_execStartCerberusLogin_Parms StartCerberusLogin_Parms;
 
@@ -3519,10 +3367,9 @@ void UISFXOnlineComponentLogin::StartCerberusLogin ( )
 
 void UISFXOnlineComponentLogin::PostImportFriendListToBlaze ( )
 {
-	static UFunction* pFnPostImportFriendListToBlaze = NULL;
-
+	UFunction* pFnPostImportFriendListToBlaze = (UFunction*) SdkBindings::Get ( 3118 );
 	if ( ! pFnPostImportFriendListToBlaze )
-		pFnPostImportFriendListToBlaze = (UFunction*) UObject::GObjObjects()->Data[ 36046 ];
+		return;
 
 	UISFXOnlineComponentLogin_execPostImportFriendListToBlaze_Parms PostImportFriendListToBlaze_Parms;
 
@@ -3540,10 +3387,9 @@ void UISFXOnlineComponentLogin::PostImportFriendListToBlaze ( )
 
 void UISFXOnlineComponentLogin::SuspendUserPing ( unsigned long suspend )
 {
-	static UFunction* pFnSuspendUserPing = NULL;
-
+	UFunction* pFnSuspendUserPing = (UFunction*) SdkBindings::Get ( 3117 );
 	if ( ! pFnSuspendUserPing )
-		pFnSuspendUserPing = (UFunction*) UObject::GObjObjects()->Data[ 36044 ];
+		return;
 
 	UISFXOnlineComponentLogin_execSuspendUserPing_Parms SuspendUserPing_Parms;
 	SuspendUserPing_Parms.suspend = suspend;
@@ -3562,10 +3408,9 @@ void UISFXOnlineComponentLogin::SuspendUserPing ( unsigned long suspend )
 
 unsigned char UISFXOnlineComponentLogin::GetConnectMode ( )
 {
-	static UFunction* pFnGetConnectMode = NULL;
-
+	UFunction* pFnGetConnectMode = (UFunction*) SdkBindings::Get ( 3116 );
 	if ( ! pFnGetConnectMode )
-		pFnGetConnectMode = (UFunction*) UObject::GObjObjects()->Data[ 36042 ];
+		return {};
 
 	UISFXOnlineComponentLogin_execGetConnectMode_Parms GetConnectMode_Parms;
 
@@ -3586,10 +3431,9 @@ unsigned char UISFXOnlineComponentLogin::GetConnectMode ( )
 
 unsigned char UISFXOnlineComponentLogin::CanShowPresenceInformation ( int nUserIndex )
 {
-	static UFunction* pFnCanShowPresenceInformation = NULL;
-
+	UFunction* pFnCanShowPresenceInformation = (UFunction*) SdkBindings::Get ( 3115 );
 	if ( ! pFnCanShowPresenceInformation )
-		pFnCanShowPresenceInformation = (UFunction*) UObject::GObjObjects()->Data[ 36039 ];
+		return {};
 
 	UISFXOnlineComponentLogin_execCanShowPresenceInformation_Parms CanShowPresenceInformation_Parms;
 	CanShowPresenceInformation_Parms.nUserIndex = nUserIndex;
@@ -3611,10 +3455,9 @@ unsigned char UISFXOnlineComponentLogin::CanShowPresenceInformation ( int nUserI
 
 unsigned char UISFXOnlineComponentLogin::CanViewPlayerProfiles ( int nUserIndex )
 {
-	static UFunction* pFnCanViewPlayerProfiles = NULL;
-
+	UFunction* pFnCanViewPlayerProfiles = (UFunction*) SdkBindings::Get ( 3114 );
 	if ( ! pFnCanViewPlayerProfiles )
-		pFnCanViewPlayerProfiles = (UFunction*) UObject::GObjObjects()->Data[ 36036 ];
+		return {};
 
 	UISFXOnlineComponentLogin_execCanViewPlayerProfiles_Parms CanViewPlayerProfiles_Parms;
 	CanViewPlayerProfiles_Parms.nUserIndex = nUserIndex;
@@ -3636,10 +3479,9 @@ unsigned char UISFXOnlineComponentLogin::CanViewPlayerProfiles ( int nUserIndex
 
 unsigned char UISFXOnlineComponentLogin::CanPurchaseContent ( int nUserIndex )
 {
-	static UFunction* pFnCanPurchaseContent = NULL;
-
+	UFunction* pFnCanPurchaseContent = (UFunction*) SdkBindings::Get ( 3113 );
 	if ( ! pFnCanPurchaseContent )
-		pFnCanPurchaseContent = (UFunction*) UObject::GObjObjects()->Data[ 36033 ];
+		return {};
 
 	UISFXOnlineComponentLogin_execCanPurchaseContent_Parms CanPurchaseContent_Parms;
 	CanPurchaseContent_Parms.nUserIndex = nUserIndex;
@@ -3661,10 +3503,9 @@ unsigned char UISFXOnlineComponentLogin::CanPurchaseContent ( int nUserIndex )
 
 unsigned char UISFXOnlineComponentLogin::CanDownloadUserContent ( int nUserIndex )
 {
-	static UFunction* pFnCanDownloadUserContent = NULL;
-
+	UFunction* pFnCanDownloadUserContent = (UFunction*) SdkBindings::Get ( 3112 );
 	if ( ! pFnCanDownloadUserContent )
-		pFnCanDownloadUserContent = (UFunction*) UObject::GObjObjects()->Data[ 36030 ];
+		return {};
 
 	UISFXOnlineComponentLogin_execCanDownloadUserContent_Parms CanDownloadUserContent_Parms;
 	CanDownloadUserContent_Parms.nUserIndex = nUserIndex;
@@ -3686,10 +3527,9 @@ unsigned char UISFXOnlineComponentLogin::CanDownloadUserContent ( int nUserIndex
 
 unsigned char UISFXOnlineComponentLogin::CanCommunicate ( int nUserIndex )
 {
-	static UFunction* pFnCanCommunicate = NULL;
-
+	UFunction* pFnCanCommunicate = (UFunction*) SdkBindings::Get ( 3111 );
 	if ( ! pFnCanCommunicate )
-		pFnCanCommunicate = (UFunction*) UObject::GObjObjects()->Data[ 36027 ];
+		return {};
 
 	UISFXOnlineComponentLogin_execCanCommunicate_Parms CanCommunicate_Parms;
 	CanCommunicate_Parms.nUserIndex = nUserIndex;
@@ -3711,10 +3551,9 @@ unsigned char UISFXOnlineComponentLogin::CanCommunicate ( int nUserIndex )
 
 unsigned char UISFXOnlineComponentLogin::CanPlayOnline ( int nUserIndex )
 {
-	static UFunction* pFnCanPlayOnline = NULL;
-
+	UFunction* pFnCanPlayOnline = (UFunction*) SdkBindings::Get ( 3110 );
 	if ( ! pFnCanPlayOnline )
-		pFnCanPlayOnline = (UFunction*) UObject::GObjObjects()->Data[ 36024 ];
+		return {};
 
 	UISFXOnlineComponentLogin_execCanPlayOnline_Parms CanPlayOnline_Parms;
 	CanPlayOnline_Parms.nUserIndex = nUserIndex;
@@ -3735,10 +3574,9 @@ unsigned char UISFXOnlineComponentLogin::CanPlayOnline ( int nUserIndex )
 
 void UISFXOnlineComponentLogin::EnterCDKey ( struct FString sKey )
 {
-	static UFunction* pFnEnterCDKey = NULL;
-
+	UFunction* pFnEnterCDKey = (UFunction*) SdkBindings::Get ( 3109 );
 	if ( ! pFnEnterCDKey )
-		pFnEnterCDKey = (UFunction*) UObject::GObjObjects()->Data[ 36022 ];
+		return;
 
 	UISFXOnlineComponentLogin_execEnterCDKey_Parms EnterCDKey_Parms;
 	memcpy ( &EnterCDKey_Parms.sKey, &sKey, 0xC );
@@ -3757,10 +3595,9 @@ void UISFXOnlineComponentLogin::EnterCDKey ( struct FString sKey )
 
 int UISFXOnlineComponentLogin::GetAuthToken ( )
 {
-	static UFunction* pFnGetAuthToken = NULL;
-
+	UFunction* pFnGetAuthToken = (UFunction*) SdkBindings::Get ( 3108 );
 	if ( ! pFnGetAuthToken )
-		pFnGetAuthToken = (UFunction*) UObject::GObjObjects()->Data[ 36019 ];
+		return {};
 
 	UISFXOnlineComponentLogin_execGetAuthToken_Parms GetAuthToken_Parms;
 
@@ -3780,10 +3617,9 @@ int UISFXOnlineComponentLogin::GetAuthToken ( )
 
 bool UISFXOnlineComponentLogin::ImportFriendListToBlaze ( )
 {
-	static UFunction* pFnImportFriendListToBlaze = NULL;
-
+	UFunction* pFnImportFriendListToBlaze = (UFunction*) SdkBindings::Get ( 3107 );
 	if ( ! pFnImportFriendListToBlaze )
-		pFnImportFriendListToBlaze = (UFunction*) UObject::GObjObjects()->Data[ 36016 ];
+		return {};
 
 	UISFXOnlineComponentLogin_execImportFriendListToBlaze_Parms ImportFriendListToBlaze_Parms;
 
@@ -3803,10 +3639,9 @@ bool UISFXOnlineComponentLogin::ImportFriendListToBlaze ( )
 
 void UISFXOnlineComponentLogin::OnImportFriendListToBlazeCompleted ( unsigned char errorCode )
 {
-	static UFunction* pFnOnImportFriendListToBlazeCompleted = NULL;
-
+	UFunction* pFnOnImportFriendListToBlazeCompleted = (UFunction*) SdkBindings::Get ( 3106 );
 	if ( ! pFnOnImportFriendListToBlazeCompleted )
-		pFnOnImportFriendListToBlazeCompleted = (UFunction*) UObject::GObjObjects()->Data[ 36014 ];
+		return;
 
 	UISFXOnlineComponentLogin_execOnImportFriendListToBlazeCompleted_Parms OnImportFriendListToBlazeCompleted_Parms;
 	OnImportFriendListToBlazeCompleted_Parms.errorCode = errorCode;
@@ -3821,10 +3656,9 @@ void UISFXOnlineComponentLogin::OnImportFriendListToBlazeCompleted ( unsigned ch
 
 void UISFXOnlineComponentLogin::OnAuthTokenRetrieved ( struct FString token )
 {
-	static UFunction* pFnOnAuthTokenRetrieved = NULL;
-
+	UFunction* pFnOnAuthTokenRetrieved = (UFunction*) SdkBindings::Get ( 3105 );
 	if ( ! pFnOnAuthTokenRetrieved )
-		pFnOnAuthTokenRetrieved = (UFunction*) UObject::GObjObjects()->Data[ 36012 ];
+		return;
 
 	UISFXOnlineComponentLogin_execOnAuthTokenRetrieved_Parms OnAuthTokenRetrieved_Parms;
 	memcpy ( &OnAuthTokenRetrieved_Parms.token, &token, 0xC );
@@ -3839,10 +3673,9 @@ void UISFXOnlineComponentLogin::OnAuthTokenRetrieved ( struct FString token )
 
 void UISFXOnlineComponentLogin::RequestImportFriendListToBlaze ( unsigned long callPostImportFriendListToBlaze )
 {
-	static UFunction* pFnRequestImportFriendListToBlaze = NULL;
-
+	UFunction* pFnRequestImportFriendListToBlaze = (UFunction*) SdkBindings::Get ( 3104 );
 	if ( ! pFnRequestImportFriendListToBlaze )
-		pFnRequestImportFriendListToBlaze = (UFunction*) UObject::GObjObjects()->Data[ 36010 ];
+		return;
 
 	UISFXOnlineComponentLogin_execRequestImportFriendListToBlaze_Parms RequestImportFriendListToBlaze_Parms;
 	RequestImportFriendListToBlaze_Parms.callPostImportFriendListToBlaze = callPostImportFriendListToBlaze;
@@ -3860,10 +3693,9 @@ void UISFXOnlineComponentLogin::RequestImportFriendListToBlaze ( unsigned long c
 
 void UISFXOnlineComponentLogin::OnDownloadOffersUICompleted ( )
 {
-	static UFunction* pFnOnDownloadOffersUICompleted = NULL;
-
+	UFunction* pFnOnDownloadOffersUICompleted = (UFunction*) SdkBindings::Get ( 3103 );
 	if ( ! pFnOnDownloadOffersUICompleted )
-		pFnOnDownloadOffersUICompleted = (UFunction*) UObject::GObjObjects()->Data[ 36009 ];
+		return;
 
 	UISFXOnlineComponentLogin_execOnDownloadOffersUICompleted_Parms OnDownloadOffersUICompleted_Parms;
 
@@ -3880,10 +3712,9 @@ void UISFXOnlineComponentLogin::OnDownloadOffersUICompleted ( )
 
 void UISFXOnlineComponentLogin::OnDLCInfoLoaded ( )
 {
-	static UFunction* pFnOnDLCInfoLoaded = NULL;
-
+	UFunction* pFnOnDLCInfoLoaded = (UFunction*) SdkBindings::Get ( 3102 );
 	if ( ! pFnOnDLCInfoLoaded )
-		pFnOnDLCInfoLoaded = (UFunction*) UObject::GObjObjects()->Data[ 36008 ];
+		return;
 
 	UISFXOnlineComponentLogin_execOnDLCInfoLoaded_Parms OnDLCInfoLoaded_Parms;
 
@@ -3900,10 +3731,9 @@ void UISFXOnlineComponentLogin::OnDLCInfoLoaded ( )
 
 void UISFXOnlineComponentLogin::OpenCerberusUI ( )
 {
-	static UFunction* pFnOpenCerberusUI = NULL;
-
+	UFunction* pFnOpenCerberusUI = (UFunction*) SdkBindings::Get ( 3101 );
 	if ( ! pFnOpenCerberusUI )
-		pFnOpenCerberusUI = (UFunction*) UObject::GObjObjects()->Data[ 36007 ];
+		return;
 
 	UISFXOnlineComponentLogin_execOpenCerberusUI_Parms OpenCerberusUI_Parms;
 
@@ -3921,10 +3751,9 @@ void UISFXOnlineComponentLogin::OpenCerberusUI ( )
 
 bool UISFXOnlineComponentLogin::IsCerberusMember ( )
 {
-	static UFunction* pFnIsCerberusMember = NULL;
-
+	UFunction* pFnIsCerberusMember = (UFunction*) SdkBindings::Get ( 3100 );
 	if ( ! pFnIsCerberusMember )
-		pFnIsCerberusMember = (UFunction*) UObject::GObjObjects()->Data[ 36005 ];
+		return {};
 
 	UISFXOnlineComponentLogin_execIsCerberusMember_Parms IsCerberusMember_Parms;
 
@@ -3944,10 +3773,9 @@ bool UISFXOnlineComponentLogin::IsCerberusMember ( )
 
 void UISFXOnlineComponentLogin::DisablePersona ( struct FString sPersonaNonGrata )
 {
-	static UFunction* pFnDisablePersona = NULL;
-
+	UFunction* pFnDisablePersona = (UFunction*) SdkBindings::Get ( 3099 );
 	if ( ! pFnDisablePersona )
-		pFnDisablePersona = (UFunction*) UObject::GObjObjects()->Data[ 36003 ];
+		return;
 
 	UISFXOnlineComponentLogin_execDisablePersona_Parms DisablePersona_Parms;
 	memcpy ( &DisablePersona_Parms.sPersonaNonGrata, &sPersonaNonGrata, 0xC );
@@ -3966,10 +3794,9 @@ void UISFXOnlineComponentLogin::DisablePersona ( struct FString sPersonaNonGrata
 
 void UISFXOnlineComponentLogin::CreatePersona ( struct FString sPersonaName )
 {
-	static UFunction* pFnCreatePersona = NULL;
-
+	UFunction* pFnCreatePersona = (UFunction*) SdkBindings::Get ( 3098 );
 	if ( ! pFnCreatePersona )
-		pFnCreatePersona = (UFunction*) UObject::GObjObjects()->Data[ 36001 ];
+		return;
 
 	UISFXOnlineComponentLogin_execCreatePersona_Parms CreatePersona_Parms;
 	memcpy ( &CreatePersona_Parms.sPersonaName, &sPersonaName, 0xC );
@@ -3988,10 +3815,9 @@ void UISFXOnlineComponentLogin::CreatePersona ( struct FString sPersonaName )
 
 void UISFXOnlineComponentLogin::SelectPersona ( struct FString sPersonaName )
 {
-	static UFunction* pFnSelectPersona = NULL;
-
+	UFunction* pFnSelectPersona = (UFunction*) SdkBindings::Get ( 3097 );
 	if ( ! pFnSelectPersona )
-		pFnSelectPersona = (UFunction*) UObject::GObjObjects()->Data[ 35999 ];
+		return;
 
 	UISFXOnlineComponentLogin_execSelectPersona_Parms SelectPersona_Parms;
 	memcpy ( &SelectPersona_Parms.sPersonaName, &sPersonaName, 0xC );
@@ -4010,10 +3836,9 @@ void UISFXOnlineComponentLogin::SelectPersona ( struct FString sPersonaName )
 
 void UISFXOnlineComponentLogin::AcceptTOS ( unsigned long bAccepted )
 {
-	static UFunction* pFnAcceptTOS = NULL;
-
+	UFunction* pFnAcceptTOS = (UFunction*) SdkBindings::Get ( 3096 );
 	if ( ! pFnAcceptTOS )
-		pFnAcceptTOS = (UFunction*) UObject::GObjObjects()->Data[ 35997 ];
+		return;
 
 	UISFXOnlineComponentLogin_execAcceptTOS_Parms AcceptTOS_Parms;
 	AcceptTOS_Parms.bAccepted = bAccepted;
@@ -4032,10 +3857,9 @@ void UISFXOnlineComponentLogin::AcceptTOS ( unsigned long bAccepted )
 
 void UISFXOnlineComponentLogin::Disconnect ( unsigned long bShowError )
 {
-	static UFunction* pFnDisconnect = NULL;
-
+	UFunction* pFnDisconnect = (UFunction*) SdkBindings::Get ( 3095 );
 	if ( ! pFnDisconnect )
-		pFnDisconnect = (UFunction*) UObject::GObjObjects()->Data[ 35995 ];
+		return;
 
 	UISFXOnlineComponentLogin_execDisconnect_Parms Disconnect_Parms;
 	Disconnect_Parms.bShowError = bShowError;
@@ -4054,10 +3878,9 @@ void UISFXOnlineComponentLogin::Disconnect ( unsigned long bShowError )
 
 void UISFXOnlineComponentLogin::SubmitStore ( TArray< int > aiChosen )
 {
-	static UFunction* pFnSubmitStore = NULL;
-
+	UFunction* pFnSubmitStore = (UFunction*) SdkBindings::Get ( 3094 );
 	if ( ! pFnSubmitStore )
-		pFnSubmitStore = (UFunction*) UObject::GObjObjects()->Data[ 35992 ];
+		return;
 
 	UISFXOnlineComponentLogin_execSubmitStore_Parms SubmitStore_Parms;
 	memcpy ( &SubmitStore_Parms.aiChosen, &aiChosen, 0xC );
@@ -4086,10 +3909,9 @@ void UISFXOnlineComponentLogin::SubmitStore ( TArray< int > aiChosen )
 
 void UISFXOnlineComponentLogin::SubmitCreateNucleusAccountEx ( struct FString sEmail, struct FString sPassword, unsigned long bEAProducts, unsigned long bThirdParty, unsigned long bBioWareProducts, struct FString i_sCountryCode, int BirthDay, int BirthMonth, int BirthYear, struct FString i_sLanguageCode, unsigned long bSubmit )
 {
-	static UFunction* pFnSubmitCreateNucleusAccountEx = NULL;
-
+	UFunction* pFnSubmitCreateNucleusAccountEx = (UFunction*) SdkBindings::Get ( 3093 );
 	if ( ! pFnSubmitCreateNucleusAccountEx )
-		pFnSubmitCreateNucleusAccountEx = (UFunction*) UObject::GObjObjects()->Data[ 35980 ];
+		return;
 
 	UISFXOnlineComponentLogin_execSubmitCreateNucleusAccountEx_Parms SubmitCreateNucleusAccountEx_Parms;
 	memcpy ( &SubmitCreateNucleusAccountEx_Parms.sEmail, &sEmail, 0xC );
@@ -4120,10 +3942,9 @@ void UISFXOnlineComponentLogin::SubmitCreateNucleusAccountEx ( struct FString sE
 
 void UISFXOnlineComponentLogin::SubmitEmailPasswordMismatch ( struct FString email, struct FString Password, int eReturnCode )
 {
-	static UFunction* pFnSubmitEmailPasswordMismatch = NULL;
-
+	UFunction* pFnSubmitEmailPasswordMismatch = (UFunction*) SdkBindings::Get ( 3092 );
 	if ( ! pFnSubmitEmailPasswordMismatch )
-		pFnSubmitEmailPasswordMismatch = (UFunction*) UObject::GObjObjects()->Data[ 35976 ];
+		return;
 
 	UISFXOnlineComponentLogin_execSubmitEmailPasswordMismatch_Parms SubmitEmailPasswordMismatch_Parms;
 	memcpy ( &SubmitEmailPasswordMismatch_Parms.email, &email, 0xC );
@@ -4144,10 +3965,9 @@ void UISFXOnlineComponentLogin::SubmitEmailPasswordMismatch ( struct FString ema
 
 void UISFXOnlineComponentLogin::SubmitMessageBox ( int eReturnCode )
 {
-	static UFunction* pFnSubmitMessageBox = NULL;
-
+	UFunction* pFnSubmitMessageBox = (UFunction*) SdkBindings::Get ( 3091 );
 	if ( ! pFnSubmitMessageBox )
-		pFnSubmitMessageBox = (UFunction*) UObject::GObjObjects()->Data[ 35974 ];
+		return;
 
 	UISFXOnlineComponentLogin_execSubmitMessageBox_Parms SubmitMessageBox_Parms;
 	SubmitMessageBox_Parms.eReturnCode = eReturnCode;
@@ -4167,10 +3987,9 @@ void UISFXOnlineComponentLogin::SubmitMessageBox ( int eReturnCode )
 
 void UISFXOnlineComponentLogin::SubmitRedeemCode ( unsigned long bContinue, struct FString i_sCode )
 {
-	static UFunction* pFnSubmitRedeemCode = NULL;
-
+	UFunction* pFnSubmitRedeemCode = (UFunction*) SdkBindings::Get ( 3090 );
 	if ( ! pFnSubmitRedeemCode )
-		pFnSubmitRedeemCode = (UFunction*) UObject::GObjObjects()->Data[ 35971 ];
+		return;
 
 	UISFXOnlineComponentLogin_execSubmitRedeemCode_Parms SubmitRedeemCode_Parms;
 	SubmitRedeemCode_Parms.bContinue = bContinue;
@@ -4189,10 +4008,9 @@ void UISFXOnlineComponentLogin::SubmitRedeemCode ( unsigned long bContinue, stru
 
 void UISFXOnlineComponentLogin::SubmitCerberusWelcomeMessage ( )
 {
-	static UFunction* pFnSubmitCerberusWelcomeMessage = NULL;
-
+	UFunction* pFnSubmitCerberusWelcomeMessage = (UFunction*) SdkBindings::Get ( 3089 );
 	if ( ! pFnSubmitCerberusWelcomeMessage )
-		pFnSubmitCerberusWelcomeMessage = (UFunction*) UObject::GObjObjects()->Data[ 35970 ];
+		return;
 
 	UISFXOnlineComponentLogin_execSubmitCerberusWelcomeMessage_Parms SubmitCerberusWelcomeMessage_Parms;
 
@@ -4210,10 +4028,9 @@ void UISFXOnlineComponentLogin::SubmitCerberusWelcomeMessage ( )
 
 void UISFXOnlineComponentLogin::SubmitCerberusIntro ( int eReturnCode )
 {
-	static UFunction* pFnSubmitCerberusIntro = NULL;
-
+	UFunction* pFnSubmitCerberusIntro = (UFunction*) SdkBindings::Get ( 3088 );
 	if ( ! pFnSubmitCerberusIntro )
-		pFnSubmitCerberusIntro = (UFunction*) UObject::GObjObjects()->Data[ 35968 ];
+		return;
 
 	UISFXOnlineComponentLogin_execSubmitCerberusIntro_Parms SubmitCerberusIntro_Parms;
 	SubmitCerberusIntro_Parms.eReturnCode = eReturnCode;
@@ -4231,10 +4048,9 @@ void UISFXOnlineComponentLogin::SubmitCerberusIntro ( int eReturnCode )
 
 void UISFXOnlineComponentLogin::SubmitNucleusWelcomeMessage ( )
 {
-	static UFunction* pFnSubmitNucleusWelcomeMessage = NULL;
-
+	UFunction* pFnSubmitNucleusWelcomeMessage = (UFunction*) SdkBindings::Get ( 3087 );
 	if ( ! pFnSubmitNucleusWelcomeMessage )
-		pFnSubmitNucleusWelcomeMessage = (UFunction*) UObject::GObjObjects()->Data[ 35967 ];
+		return;
 
 	UISFXOnlineComponentLogin_execSubmitNucleusWelcomeMessage_Parms SubmitNucleusWelcomeMessage_Parms;
 
@@ -4257,10 +4073,9 @@ void UISFXOnlineComponentLogin::SubmitNucleusWelcomeMessage ( )
 
 void UISFXOnlineComponentLogin::SubmitCreateNucleusAccount ( struct FString sEmail, struct FString sPassword, unsigned long bEAProducts, unsigned long bThirdParty, unsigned long bBioWareProducts, unsigned long bSubmit )
 {
-	static UFunction* pFnSubmitCreateNucleusAccount = NULL;
-
+	UFunction* pFnSubmitCreateNucleusAccount = (UFunction*) SdkBindings::Get ( 3086 );
 	if ( ! pFnSubmitCreateNucleusAccount )
-		pFnSubmitCreateNucleusAccount = (UFunction*) UObject::GObjObjects()->Data[ 35960 ];
+		return;
 
 	UISFXOnlineComponentLogin_execSubmitCreateNucleusAccount_Parms SubmitCreateNucleusAccount_Parms;
 	memcpy ( &SubmitCreateNucleusAccount_Parms.sEmail, &sEmail, 0xC );
@@ -4285,10 +4100,9 @@ void UISFXOnlineComponentLogin::SubmitCreateNucleusAccount ( struct FString sEma
 
 void UISFXOnlineComponentLogin::SubmitParentEmail ( unsigned long bContinue, struct FString ParentEmail )
 {
-	static UFunction* pFnSubmitParentEmail = NULL;
-
+	UFunction* pFnSubmitParentEmail = (UFunction*) SdkBindings::Get ( 3085 );
 	if ( ! pFnSubmitParentEmail )
-		pFnSubmitParentEmail = (UFunction*) UObject::GObjObjects()->Data[ 35957 ];
+		return;
 
 	UISFXOnlineComponentLogin_execSubmitParentEmail_Parms SubmitParentEmail_Parms;
 	SubmitParentEmail_Parms.bContinue = bContinue;
@@ -4310,10 +4124,9 @@ void UISFXOnlineComponentLogin::SubmitParentEmail ( unsigned long bContinue, str
 
 void UISFXOnlineComponentLogin::SubmitNucleusLogin ( struct FString email, struct FString Password, unsigned char eReturnCode )
 {
-	static UFunction* pFnSubmitNucleusLogin = NULL;
-
+	UFunction* pFnSubmitNucleusLogin = (UFunction*) SdkBindings::Get ( 3084 );
 	if ( ! pFnSubmitNucleusLogin )
-		pFnSubmitNucleusLogin = (UFunction*) UObject::GObjObjects()->Data[ 35953 ];
+		return;
 
 	UISFXOnlineComponentLogin_execSubmitNucleusLogin_Parms SubmitNucleusLogin_Parms;
 	memcpy ( &SubmitNucleusLogin_Parms.email, &email, 0xC );
@@ -4335,10 +4148,9 @@ void UISFXOnlineComponentLogin::SubmitNucleusLogin ( struct FString email, struc
 
 void UISFXOnlineComponentLogin::SubmitIntroPage ( unsigned long bContinue, unsigned long bSimulated )
 {
-	static UFunction* pFnSubmitIntroPage = NULL;
-
+	UFunction* pFnSubmitIntroPage = (UFunction*) SdkBindings::Get ( 3083 );
 	if ( ! pFnSubmitIntroPage )
-		pFnSubmitIntroPage = (UFunction*) UObject::GObjObjects()->Data[ 35950 ];
+		return;
 
 	UISFXOnlineComponentLogin_execSubmitIntroPage_Parms SubmitIntroPage_Parms;
 	SubmitIntroPage_Parms.bContinue = bContinue;
@@ -4359,10 +4171,9 @@ void UISFXOnlineComponentLogin::SubmitIntroPage ( unsigned long bContinue, unsig
 
 void UISFXOnlineComponentLogin::AutoLogin ( struct FString sEmail, struct FString sPassword )
 {
-	static UFunction* pFnAutoLogin = NULL;
-
+	UFunction* pFnAutoLogin = (UFunction*) SdkBindings::Get ( 3082 );
 	if ( ! pFnAutoLogin )
-		pFnAutoLogin = (UFunction*) UObject::GObjObjects()->Data[ 35947 ];
+		return;
 
 	UISFXOnlineComponentLogin_execAutoLogin_Parms AutoLogin_Parms;
 	memcpy ( &AutoLogin_Parms.sEmail, &sEmail, 0xC );
@@ -4382,10 +4193,9 @@ void UISFXOnlineComponentLogin::AutoLogin ( struct FString sEmail, struct FStrin
 
 void UISFXOnlineComponentLogin::AutoLoginWithAccountIndex ( int configAccountIndex )
 {
-	static UFunction* pFnAutoLoginWithAccountIndex = NULL;
-
+	UFunction* pFnAutoLoginWithAccountIndex = (UFunction*) SdkBindings::Get ( 3081 );
 	if ( ! pFnAutoLoginWithAccountIndex )
-		pFnAutoLoginWithAccountIndex = (UFunction*) UObject::GObjObjects()->Data[ 35945 ];
+		return;
 
 	UISFXOnlineComponentLogin_execAutoLoginWithAccountIndex_Parms AutoLoginWithAccountIndex_Parms;
 	AutoLoginWithAccountIndex_Parms.configAccountIndex = configAccountIndex;
@@ -4404,10 +4214,9 @@ void UISFXOnlineComponentLogin::AutoLoginWithAccountIndex ( int configAccountInd
 
 bool UISFXOnlineComponentLogin::CheckAutoLoginFromIni ( )
 {
-	static UFunction* pFnCheckAutoLoginFromIni = NULL;
-
+	UFunction* pFnCheckAutoLoginFromIni = (UFunction*) SdkBindings::Get ( 3080 );
 	if ( ! pFnCheckAutoLoginFromIni )
-		pFnCheckAutoLoginFromIni = (UFunction*) UObject::GObjObjects()->Data[ 35943 ];
+		return {};
 
 	UISFXOnlineComponentLogin_execCheckAutoLoginFromIni_Parms CheckAutoLoginFromIni_Parms;
 
@@ -4426,10 +4235,9 @@ bool UISFXOnlineComponentLogin::CheckAutoLoginFromIni ( )
 
 void UISFXOnlineComponentLogin::GoBackInUI ( )
 {
-	static UFunction* pFnGoBackInUI = NULL;
-
+	UFunction* pFnGoBackInUI = (UFunction*) SdkBindings::Get ( 3079 );
 	if ( ! pFnGoBackInUI )
-		pFnGoBackInUI = (UFunction*) UObject::GObjObjects()->Data[ 35942 ];
+		return;
 
 	UISFXOnlineComponentLogin_execGoBackInUI_Parms GoBackInUI_Parms;
 
@@ -4446,10 +4254,9 @@ void UISFXOnlineComponentLogin::GoBackInUI ( )
 
 void UISFXOnlineComponentLogin::Cancel ( )
 {
-	static UFunction* pFnCancel = NULL;
-
+	UFunction* pFnCancel = (UFunction*) SdkBindings::Get ( 3078 );
 	if ( ! pFnCancel )
-		pFnCancel = (UFunction*) UObject::GObjObjects()->Data[ 35941 ];
+		return;
 
 	UISFXOnlineComponentLogin_execCancel_Parms Cancel_Parms;
 
@@ -4467,10 +4274,9 @@ void UISFXOnlineComponentLogin::Cancel ( )
 
 struct FUniqueNetId UISFXOnlineComponentLogin::GetUserId ( )
 {
-	static UFunction* pFnGetUserId = NULL;
-
+	UFunction* pFnGetUserId = (UFunction*) SdkBindings::Get ( 3077 );
 	if ( ! pFnGetUserId )
-		pFnGetUserId = (UFunction*) UObject::GObjObjects()->Data[ 35939 ];
+		return {};
 
 	UISFXOnlineComponentLogin_execGetUserId_Parms GetUserId_Parms;
 
@@ -4490,10 +4296,9 @@ struct FUniqueNetId UISFXOnlineComponentLogin::GetUserId ( )
 
 struct FString UISFXOnlineComponentLogin::GetPersonaName ( )
 {
-	static UFunction* pFnGetPersonaName = NULL;
-
+	UFunction* pFnGetPersonaName = (UFunction*) SdkBindings::Get ( 3076 );
 	if ( ! pFnGetPersonaName )
-		pFnGetPersonaName = (UFunction*) UObject::GObjObjects()->Data[ 35937 ];
+		return {};
 
 	UISFXOnlineComponentLogin_execGetPersonaName_Parms GetPersonaName_Parms;
 
@@ -4513,10 +4318,9 @@ struct FString UISFXOnlineComponentLogin::GetPersonaName ( )
 
 bool UISFXOnlineComponentLogin::HasInternetConnection ( )
 {
-	static UFunction* pFnHasInternetConnection = NULL;
-
+	UFunction* pFnHasInternetConnection = (UFunction*) SdkBindings::Get ( 3075 );
 	if ( ! pFnHasInternetConnection )
-		pFnHasInternetConnection = (UFunction*) UObject::GObjObjects()->Data[ 35935 ];
+		return {};
 
 	UISFXOnlineComponentLogin_execHasInternetConnection_Parms HasInternetConnection_Parms;
 
@@ -4536,10 +4340,9 @@ bool UISFXOnlineComponentLogin::HasInternetConnection ( )
 
 bool UISFXOnlineComponentLogin::IsConnectedTo1stPartyOnlineService ( )
 {
-	static UFunction* pFnIsConnectedTo1stPartyOnlineService = NULL;
-
+	UFunction* pFnIsConnectedTo1stPartyOnlineService = (UFunction*) SdkBindings::Get ( 3074 );
 	if ( ! pFnIsConnectedTo1stPartyOnlineService )
-		pFnIsConnectedTo1stPartyOnlineService = (UFunction*) UObject::GObjObjects()->Data[ 35933 ];
+		return {};
 
 	UISFXOnlineComponentLogin_execIsConnectedTo1stPartyOnlineService_Parms IsConnectedTo1stPartyOnlineService_Parms;
 
@@ -4559,10 +4362,9 @@ bool UISFXOnlineComponentLogin::IsConnectedTo1stPartyOnlineService ( )
 
 bool UISFXOnlineComponentLogin::IsSignedIn ( )
 {
-	static UFunction* pFnIsSignedIn = NULL;
-
+	UFunction* pFnIsSignedIn = (UFunction*) SdkBindings::Get ( 3073 );
 	if ( ! pFnIsSignedIn )
-		pFnIsSignedIn = (UFunction*) UObject::GObjObjects()->Data[ 35931 ];
+		return {};
 
 	UISFXOnlineComponentLogin_execIsSignedIn_Parms IsSignedIn_Parms;
 
@@ -4582,10 +4384,9 @@ bool UISFXOnlineComponentLogin::IsSignedIn ( )
 
 bool UISFXOnlineComponentLogin::IsConnected ( )
 {
-	static UFunction* pFnIsConnected = NULL;
-
+	UFunction* pFnIsConnected = (UFunction*) SdkBindings::Get ( 3072 );
 	if ( ! pFnIsConnected )
-		pFnIsConnected = (UFunction*) UObject::GObjObjects()->Data[ 35929 ];
+		return {};
 
 	UISFXOnlineComponentLogin_execIsConnected_Parms IsConnected_Parms;
 
@@ -4605,10 +4406,9 @@ bool UISFXOnlineComponentLogin::IsConnected ( )
 
 void UISFXOnlineComponentLogin::Connect ( unsigned char connectMode )
 {
-	static UFunction* pFnConnect = NULL;
-
+	UFunction* pFnConnect = (UFunction*) SdkBindings::Get ( 3071 );
 	if ( ! pFnConnect )
-		pFnConnect = (UFunction*) UObject::GObjObjects()->Data[ 35927 ];
+		return;
 
 	UISFXOnlineComponentLogin_execConnect_Parms Connect_Parms;
 	Connect_Parms.connectMode = connectMode;
@@ -4628,10 +4428,9 @@ void UISFXOnlineComponentLogin::Connect ( unsigned char connectMode )
 
 bool UISFXOnlineComponentLogin::IsActiveUser ( struct FUniqueNetId userId )
 {
-	static UFunction* pFnIsActiveUser = NULL;
-
+	UFunction* pFnIsActiveUser = (UFunction*) SdkBindings::Get ( 3070 );
 	if ( ! pFnIsActiveUser )
-		pFnIsActiveUser = (UFunction*) UObject::GObjObjects()->Data[ 35924 ];
+		return {};
 
 	UISFXOnlineComponentLogin_execIsActiveUser_Parms IsActiveUser_Parms;
 	memcpy ( &IsActiveUser_Parms.userId, &userId, 0x8 );
@@ -4652,10 +4451,9 @@ bool UISFXOnlineComponentLogin::IsActiveUser ( struct FUniqueNetId userId )
 
 void UISFXOnlineComponentLogin::SwitchActiveUserIndex ( int nNewIndex )
 {
-	static UFunction* pFnSwitchActiveUserIndex = NULL;
-
+	UFunction* pFnSwitchActiveUserIndex = (UFunction*) SdkBindings::Get ( 3069 );
 	if ( ! pFnSwitchActiveUserIndex )
-		pFnSwitchActiveUserIndex = (UFunction*) UObject::GObjObjects()->Data[ 35922 ];
+		return;
 
 	UISFXOnlineComponentLogin_execSwitchActiveUserIndex_Parms SwitchActiveUserIndex_Parms;
 	SwitchActiveUserIndex_Parms.nNewIndex = nNewIndex;
@@ -4674,10 +4472,9 @@ void UISFXOnlineComponentLogin::SwitchActiveUserIndex ( int nNewIndex )
 
 int UISFXOnlineComponentLogin::GetActiveUserIndex ( )
 {
-	static UFunction* pFnGetActiveUserIndex = NULL;
-
+	UFunction* pFnGetActiveUserIndex = (UFunction*) SdkBindings::Get ( 3068 );
 	if ( ! pFnGetActiveUserIndex )
-		pFnGetActiveUserIndex = (UFunction*) UObject::GObjObjects()->Data[ 35920 ];
+		return {};
 
 	UISFXOnlineComponentLogin_execGetActiveUserIndex_Parms GetActiveUserIndex_Parms;
 
@@ -4697,10 +4494,9 @@ int UISFXOnlineComponentLogin::GetActiveUserIndex ( )
 
 unsigned char UISFXOnlineComponentLogin::GetLoginStatus ( )
 {
-	static UFunction* pFnGetLoginStatus = NULL;
-
+	UFunction* pFnGetLoginStatus = (UFunction*) SdkBindings::Get ( 3067 );
 	if ( ! pFnGetLoginStatus )
-		pFnGetLoginStatus = (UFunction*) UObject::GObjObjects()->Data[ 35918 ];
+		return {};
 
 	UISFXOnlineComponentLogin_execGetLoginStatus_Parms GetLoginStatus_Parms;
 
@@ -4720,10 +4516,9 @@ unsigned char UISFXOnlineComponentLogin::GetLoginStatus ( )
 
 int UISFXOnlineComponentStats::ReadStatsGroupList ( )
 {
-	static UFunction* pFnReadStatsGroupList = NULL;
-
+	UFunction* pFnReadStatsGroupList = (UFunction*) SdkBindings::Get ( 3125 );
 	if ( ! pFnReadStatsGroupList )
-		pFnReadStatsGroupList = (UFunction*) UObject::GObjObjects()->Data[ 36239 ];
+		return {};
 
 	UISFXOnlineComponentStats_execReadStatsGroupList_Parms ReadStatsGroupList_Parms;
 
@@ -4742,10 +4537,9 @@ int UISFXOnlineComponentStats::ReadStatsGroupList ( )
 
 void UISFXOnlineComponentStats::RequestReadStatsGroupList ( )
 {
-	static UFunction* pFnRequestReadStatsGroupList = NULL;
-
+	UFunction* pFnRequestReadStatsGroupList = (UFunction*) SdkBindings::Get ( 3124 );
 	if ( ! pFnRequestReadStatsGroupList )
-		pFnRequestReadStatsGroupList = (UFunction*) UObject::GObjObjects()->Data[ 36238 ];
+		return;
 
 	UISFXOnlineComponentStats_execRequestReadStatsGroupList_Parms RequestReadStatsGroupList_Parms;
 
@@ -4766,10 +4560,9 @@ void UISFXOnlineComponentStats::RequestReadStatsGroupList ( )
 
 int UISFXOnlineComponentStats::GetFriendsStatsData ( int nRankRange, struct FPointer pExternalData, struct FLeaderboardStatScope* oScope )
 {
-	static UFunction* pFnGetFriendsStatsData = NULL;
-
+	UFunction* pFnGetFriendsStatsData = (UFunction*) SdkBindings::Get ( 3123 );
 	if ( ! pFnGetFriendsStatsData )
-		pFnGetFriendsStatsData = (UFunction*) UObject::GObjObjects()->Data[ 36232 ];
+		return {};
 
 	UISFXOnlineComponentStats_execGetFriendsStatsData_Parms GetFriendsStatsData_Parms;
 	GetFriendsStatsData_Parms.nRankRange = nRankRange;
@@ -4794,10 +4587,9 @@ int UISFXOnlineComponentStats::GetFriendsStatsData ( int nRankRange, struct FPoi
 
 void UISFXOnlineComponentStats::OnReadStatsGroupListCompleted ( unsigned char errorCode )
 {
-	static UFunction* pFnOnReadStatsGroupListCompleted = NULL;
-
+	UFunction* pFnOnReadStatsGroupListCompleted = (UFunction*) SdkBindings::Get ( 3122 );
 	if ( ! pFnOnReadStatsGroupListCompleted )
-		pFnOnReadStatsGroupListCompleted = (UFunction*) UObject::GObjObjects()->Data[ 36230 ];
+		return;
 
 	UISFXOnlineComponentStats_execOnReadStatsGroupListCompleted_Parms OnReadStatsGroupListCompleted_Parms;
 	OnReadStatsGroupListCompleted_Parms.errorCode = errorCode;
@@ -4815,10 +4607,9 @@ void UISFXOnlineComponentStats::OnReadStatsGroupListCompleted ( unsigned char er
 
 void UISFXOnlineComponentStats::OnResultsRetrieved ( TArray< struct FLeaderboardColumn > aColumnInfo, TArray< struct FLeaderboardRecord > aResults, unsigned char nErrorCode, struct FPointer pExternalData )
 {
-	static UFunction* pFnOnResultsRetrieved = NULL;
-
+	UFunction* pFnOnResultsRetrieved = (UFunction*) SdkBindings::Get ( 3121 );
 	if ( ! pFnOnResultsRetrieved )
-		pFnOnResultsRetrieved = (UFunction*) UObject::GObjObjects()->Data[ 36223 ];
+		return;
 
 	UISFXOnlineComponentStats_execOnResultsRetrieved_Parms OnResultsRetrieved_Parms;
 	memcpy ( &OnResultsRetrieved_Parms.aColumnInfo, &aColumnInfo, 0xC );
@@ -4836,10 +4627,9 @@ void UISFXOnlineComponentStats::OnResultsRetrieved ( TArray< struct FLeaderboard
 
 void UISFXOnlineComponentTelemetry::Flush ( unsigned char Channel )
 {
-	static UFunction* pFnFlush = NULL;
-
+	UFunction* pFnFlush = (UFunction*) SdkBindings::Get ( 3130 );
 	if ( ! pFnFlush )
-		pFnFlush = (UFunction*) UObject::GObjObjects()->Data[ 36265 ];
+		return;
 
 	UISFXOnlineComponentTelemetry_execFlush_Parms Flush_Parms;
 	Flush_Parms.Channel = Channel;
@@ -4857,10 +4647,9 @@ void UISFXOnlineComponentTelemetry::Flush ( unsigned char Channel )
 
 void UISFXOnlineComponentTelemetry::RegisterConnectionDelegates ( )
 {
-	static UFunction* pFnRegisterConnectionDelegates = NULL;
-
+	UFunction* pFnRegisterConnectionDelegates = (UFunction*) SdkBindings::Get ( 3129 );
 	if ( ! pFnRegisterConnectionDelegates )
-		pFnRegisterConnectionDelegates = (UFunction*) UObject::GObjObjects()->Data[ 36261 ];
+		return;
 
 	UISFXOnlineComponentTelemetry_execRegisterConnectionDelegates_Parms RegisterConnectionDelegates_Parms;
 
@@ -4877,10 +4666,9 @@ void UISFXOnlineComponentTelemetry::RegisterConnectionDelegates ( )
 
 void UISFXOnlineComponentTelemetry::OnDisconnect ( int Error, int PreviousState, int NewState, struct FString SessionId )
 {
-	static UFunction* pFnOnDisconnect = NULL;
-
+	UFunction* pFnOnDisconnect = (UFunction*) SdkBindings::Get ( 3128 );
 	if ( ! pFnOnDisconnect )
-		pFnOnDisconnect = (UFunction*) UObject::GObjObjects()->Data[ 36256 ];
+		return;
 
 	UISFXOnlineComponentTelemetry_execOnDisconnect_Parms OnDisconnect_Parms;
 	OnDisconnect_Parms.Error = Error;
@@ -4897,10 +4685,9 @@ void UISFXOnlineComponentTelemetry::OnDisconnect ( int Error, int PreviousState,
 
 void UISFXOnlineComponentTelemetry::OnAuthenticate ( )
 {
-	static UFunction* pFnOnAuthenticate = NULL;
-
+	UFunction* pFnOnAuthenticate = (UFunction*) SdkBindings::Get ( 3127 );
 	if ( ! pFnOnAuthenticate )
-		pFnOnAuthenticate = (UFunction*) UObject::GObjObjects()->Data[ 36255 ];
+		return;
 
 	UISFXOnlineComponentTelemetry_execOnAuthenticate_Parms OnAuthenticate_Parms;
 
@@ -4914,10 +4701,9 @@ void UISFXOnlineComponentTelemetry::OnAuthenticate ( )
 
 bool UISFXOnlineComponentTelemetry::CanCollect ( )
 {
-	static UFunction* pFnCanCollect = NULL;
-
+	UFunction* pFnCanCollect = (UFunction*) SdkBindings::Get ( 3126 );
 	if ( ! pFnCanCollect )
-		pFnCanCollect = (UFunction*) UObject::GObjObjects()->Data[ 36253 ];
+		return {};
 
 	UISFXOnlineComponentTelemetry_execCanCollect_Parms CanCollect_Parms;
 
@@ -4933,10 +4719,9 @@ bool UISFXOnlineComponentTelemetry::CanCollect ( )
 
 void USFXOnlineComponentGameFlow::GM_OnQuickMatchUpdateEvent ( class USFXOnlineEvent_QuickMatch* qmEvent )
 {
-	static UFunction* pFnGM_OnQuickMatchUpdateEvent = NULL;
-
+	UFunction* pFnGM_OnQuickMatchUpdateEvent = (UFunction*) SdkBindings::Get ( 3718 );
 	if ( ! pFnGM_OnQuickMatchUpdateEvent )
-		pFnGM_OnQuickMatchUpdateEvent = (UFunction*) UObject::GObjObjects()->Data[ 38585 ];
+		return;
 
 	USFXOnlineComponentGameFlow_execGM_OnQuickMatchUpdateEvent_Parms GM_OnQuickMatchUpdateEvent_Parms;
 	GM_OnQuickMatchUpdateEvent_Parms.qmEvent = qmEvent;
@@ -4952,10 +4737,9 @@ void USFXOnlineComponentGameFlow::GM_OnQuickMatchUpdateEvent ( class USFXOnlineE
 
 bool USFXOnlineComponentGameFlow::eventDebugTestInput ( struct FName InputType )
 {
-	static UFunction* pFnDebugTestInput = NULL;
-
+	UFunction* pFnDebugTestInput = (UFunction*) SdkBindings::Get ( 3717 );
 	if ( ! pFnDebugTestInput )
-		pFnDebugTestInput = (UFunction*) UObject::GObjObjects()->Data[ 38582 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventDebugTestInput_Parms DebugTestInput_Parms;
 	memcpy ( &DebugTestInput_Parms.InputType, &InputType, 0x8 );
@@ -4973,10 +4757,9 @@ bool USFXOnlineComponentGameFlow::eventDebugTestInput ( struct FName InputType )
 
 bool USFXOnlineComponentGameFlow::eventDebugValidateStates ( unsigned long writeToFile )
 {
-	static UFunction* pFnDebugValidateStates = NULL;
-
+	UFunction* pFnDebugValidateStates = (UFunction*) SdkBindings::Get ( 3716 );
 	if ( ! pFnDebugValidateStates )
-		pFnDebugValidateStates = (UFunction*) UObject::GObjObjects()->Data[ 38579 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventDebugValidateStates_Parms DebugValidateStates_Parms;
 	DebugValidateStates_Parms.writeToFile = writeToFile;
@@ -4993,10 +4776,9 @@ bool USFXOnlineComponentGameFlow::eventDebugValidateStates ( unsigned long write
 
 void USFXOnlineComponentGameFlow::MatchMakingTimeStatusUpdate ( unsigned char NewStatus )
 {
-	static UFunction* pFnMatchMakingTimeStatusUpdate = NULL;
-
+	UFunction* pFnMatchMakingTimeStatusUpdate = (UFunction*) SdkBindings::Get ( 3714 );
 	if ( ! pFnMatchMakingTimeStatusUpdate )
-		pFnMatchMakingTimeStatusUpdate = (UFunction*) UObject::GObjObjects()->Data[ 38351 ];
+		return;
 
 	USFXOnlineComponentGameFlow_execMatchMakingTimeStatusUpdate_Parms MatchMakingTimeStatusUpdate_Parms;
 	MatchMakingTimeStatusUpdate_Parms.NewStatus = NewStatus;
@@ -5011,10 +4793,9 @@ void USFXOnlineComponentGameFlow::MatchMakingTimeStatusUpdate ( unsigned char Ne
 
 bool USFXOnlineComponentGameFlow::eventGM_IsConnectionErrorSilent ( )
 {
-	static UFunction* pFnGM_IsConnectionErrorSilent = NULL;
-
+	UFunction* pFnGM_IsConnectionErrorSilent = (UFunction*) SdkBindings::Get ( 3713 );
 	if ( ! pFnGM_IsConnectionErrorSilent )
-		pFnGM_IsConnectionErrorSilent = (UFunction*) UObject::GObjObjects()->Data[ 38349 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_IsConnectionErrorSilent_Parms GM_IsConnectionErrorSilent_Parms;
 
@@ -5030,10 +4811,9 @@ bool USFXOnlineComponentGameFlow::eventGM_IsConnectionErrorSilent ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_IsInMPMapAction ( )
 {
-	static UFunction* pFnGM_IsInMPMapAction = NULL;
-
+	UFunction* pFnGM_IsInMPMapAction = (UFunction*) SdkBindings::Get ( 3712 );
 	if ( ! pFnGM_IsInMPMapAction )
-		pFnGM_IsInMPMapAction = (UFunction*) UObject::GObjObjects()->Data[ 38347 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_IsInMPMapAction_Parms GM_IsInMPMapAction_Parms;
 
@@ -5049,10 +4829,9 @@ bool USFXOnlineComponentGameFlow::eventGM_IsInMPMapAction ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_IsInMultiplayerGame ( )
 {
-	static UFunction* pFnGM_IsInMultiplayerGame = NULL;
-
+	UFunction* pFnGM_IsInMultiplayerGame = (UFunction*) SdkBindings::Get ( 3711 );
 	if ( ! pFnGM_IsInMultiplayerGame )
-		pFnGM_IsInMultiplayerGame = (UFunction*) UObject::GObjObjects()->Data[ 38345 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_IsInMultiplayerGame_Parms GM_IsInMultiplayerGame_Parms;
 
@@ -5068,10 +4847,9 @@ bool USFXOnlineComponentGameFlow::eventGM_IsInMultiplayerGame ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_IsInInviteFlow ( )
 {
-	static UFunction* pFnGM_IsInInviteFlow = NULL;
-
+	UFunction* pFnGM_IsInInviteFlow = (UFunction*) SdkBindings::Get ( 3710 );
 	if ( ! pFnGM_IsInInviteFlow )
-		pFnGM_IsInInviteFlow = (UFunction*) UObject::GObjObjects()->Data[ 38343 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_IsInInviteFlow_Parms GM_IsInInviteFlow_Parms;
 
@@ -5087,10 +4865,9 @@ bool USFXOnlineComponentGameFlow::eventGM_IsInInviteFlow ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_IsInMultiplayerFlow ( )
 {
-	static UFunction* pFnGM_IsInMultiplayerFlow = NULL;
-
+	UFunction* pFnGM_IsInMultiplayerFlow = (UFunction*) SdkBindings::Get ( 3709 );
 	if ( ! pFnGM_IsInMultiplayerFlow )
-		pFnGM_IsInMultiplayerFlow = (UFunction*) UObject::GObjObjects()->Data[ 38341 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_IsInMultiplayerFlow_Parms GM_IsInMultiplayerFlow_Parms;
 
@@ -5106,10 +4883,9 @@ bool USFXOnlineComponentGameFlow::eventGM_IsInMultiplayerFlow ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_IsLeavingGame ( )
 {
-	static UFunction* pFnGM_IsLeavingGame = NULL;
-
+	UFunction* pFnGM_IsLeavingGame = (UFunction*) SdkBindings::Get ( 3708 );
 	if ( ! pFnGM_IsLeavingGame )
-		pFnGM_IsLeavingGame = (UFunction*) UObject::GObjObjects()->Data[ 38339 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_IsLeavingGame_Parms GM_IsLeavingGame_Parms;
 
@@ -5125,10 +4901,9 @@ bool USFXOnlineComponentGameFlow::eventGM_IsLeavingGame ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_HasFailedConnecting_QM ( )
 {
-	static UFunction* pFnGM_HasFailedConnecting_QM = NULL;
-
+	UFunction* pFnGM_HasFailedConnecting_QM = (UFunction*) SdkBindings::Get ( 3707 );
 	if ( ! pFnGM_HasFailedConnecting_QM )
-		pFnGM_HasFailedConnecting_QM = (UFunction*) UObject::GObjObjects()->Data[ 38337 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_HasFailedConnecting_QM_Parms GM_HasFailedConnecting_QM_Parms;
 
@@ -5144,10 +4919,9 @@ bool USFXOnlineComponentGameFlow::eventGM_HasFailedConnecting_QM ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_HasFailedJoiningGameMissingDLCInvitee ( )
 {
-	static UFunction* pFnGM_HasFailedJoiningGameMissingDLCInvitee = NULL;
-
+	UFunction* pFnGM_HasFailedJoiningGameMissingDLCInvitee = (UFunction*) SdkBindings::Get ( 3706 );
 	if ( ! pFnGM_HasFailedJoiningGameMissingDLCInvitee )
-		pFnGM_HasFailedJoiningGameMissingDLCInvitee = (UFunction*) UObject::GObjObjects()->Data[ 38335 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_HasFailedJoiningGameMissingDLCInvitee_Parms GM_HasFailedJoiningGameMissingDLCInvitee_Parms;
 
@@ -5163,10 +4937,9 @@ bool USFXOnlineComponentGameFlow::eventGM_HasFailedJoiningGameMissingDLCInvitee
 
 bool USFXOnlineComponentGameFlow::eventGM_HasFailedJoiningGameMissingDLCInviter ( )
 {
-	static UFunction* pFnGM_HasFailedJoiningGameMissingDLCInviter = NULL;
-
+	UFunction* pFnGM_HasFailedJoiningGameMissingDLCInviter = (UFunction*) SdkBindings::Get ( 3705 );
 	if ( ! pFnGM_HasFailedJoiningGameMissingDLCInviter )
-		pFnGM_HasFailedJoiningGameMissingDLCInviter = (UFunction*) UObject::GObjObjects()->Data[ 38333 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_HasFailedJoiningGameMissingDLCInviter_Parms GM_HasFailedJoiningGameMissingDLCInviter_Parms;
 
@@ -5182,10 +4955,9 @@ bool USFXOnlineComponentGameFlow::eventGM_HasFailedJoiningGameMissingDLCInviter
 
 bool USFXOnlineComponentGameFlow::eventGM_HasFailedJoiningGameProtocolMismatch ( )
 {
-	static UFunction* pFnGM_HasFailedJoiningGameProtocolMismatch = NULL;
-
+	UFunction* pFnGM_HasFailedJoiningGameProtocolMismatch = (UFunction*) SdkBindings::Get ( 3704 );
 	if ( ! pFnGM_HasFailedJoiningGameProtocolMismatch )
-		pFnGM_HasFailedJoiningGameProtocolMismatch = (UFunction*) UObject::GObjObjects()->Data[ 38331 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_HasFailedJoiningGameProtocolMismatch_Parms GM_HasFailedJoiningGameProtocolMismatch_Parms;
 
@@ -5201,10 +4973,9 @@ bool USFXOnlineComponentGameFlow::eventGM_HasFailedJoiningGameProtocolMismatch (
 
 bool USFXOnlineComponentGameFlow::eventGM_HasFailedJoiningInviterLeft ( )
 {
-	static UFunction* pFnGM_HasFailedJoiningInviterLeft = NULL;
-
+	UFunction* pFnGM_HasFailedJoiningInviterLeft = (UFunction*) SdkBindings::Get ( 3703 );
 	if ( ! pFnGM_HasFailedJoiningInviterLeft )
-		pFnGM_HasFailedJoiningInviterLeft = (UFunction*) UObject::GObjObjects()->Data[ 38329 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_HasFailedJoiningInviterLeft_Parms GM_HasFailedJoiningInviterLeft_Parms;
 
@@ -5220,10 +4991,9 @@ bool USFXOnlineComponentGameFlow::eventGM_HasFailedJoiningInviterLeft ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_HasFailedJoiningFullGame ( )
 {
-	static UFunction* pFnGM_HasFailedJoiningFullGame = NULL;
-
+	UFunction* pFnGM_HasFailedJoiningFullGame = (UFunction*) SdkBindings::Get ( 3702 );
 	if ( ! pFnGM_HasFailedJoiningFullGame )
-		pFnGM_HasFailedJoiningFullGame = (UFunction*) UObject::GObjObjects()->Data[ 38327 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_HasFailedJoiningFullGame_Parms GM_HasFailedJoiningFullGame_Parms;
 
@@ -5239,10 +5009,9 @@ bool USFXOnlineComponentGameFlow::eventGM_HasFailedJoiningFullGame ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_HasFailedConnecting ( )
 {
-	static UFunction* pFnGM_HasFailedConnecting = NULL;
-
+	UFunction* pFnGM_HasFailedConnecting = (UFunction*) SdkBindings::Get ( 3701 );
 	if ( ! pFnGM_HasFailedConnecting )
-		pFnGM_HasFailedConnecting = (UFunction*) UObject::GObjObjects()->Data[ 38325 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_HasFailedConnecting_Parms GM_HasFailedConnecting_Parms;
 
@@ -5258,10 +5027,9 @@ bool USFXOnlineComponentGameFlow::eventGM_HasFailedConnecting ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_HasJoinedGame ( )
 {
-	static UFunction* pFnGM_HasJoinedGame = NULL;
-
+	UFunction* pFnGM_HasJoinedGame = (UFunction*) SdkBindings::Get ( 3700 );
 	if ( ! pFnGM_HasJoinedGame )
-		pFnGM_HasJoinedGame = (UFunction*) UObject::GObjObjects()->Data[ 38323 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_HasJoinedGame_Parms GM_HasJoinedGame_Parms;
 
@@ -5277,10 +5045,9 @@ bool USFXOnlineComponentGameFlow::eventGM_HasJoinedGame ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_HasCreatedGame ( )
 {
-	static UFunction* pFnGM_HasCreatedGame = NULL;
-
+	UFunction* pFnGM_HasCreatedGame = (UFunction*) SdkBindings::Get ( 3699 );
 	if ( ! pFnGM_HasCreatedGame )
-		pFnGM_HasCreatedGame = (UFunction*) UObject::GObjObjects()->Data[ 38321 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_HasCreatedGame_Parms GM_HasCreatedGame_Parms;
 
@@ -5297,10 +5064,9 @@ bool USFXOnlineComponentGameFlow::eventGM_HasCreatedGame ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_OnHostMigrationEnded ( unsigned long bInLobby )
 {
-	static UFunction* pFnGM_OnHostMigrationEnded = NULL;
-
+	UFunction* pFnGM_OnHostMigrationEnded = (UFunction*) SdkBindings::Get ( 3698 );
 	if ( ! pFnGM_OnHostMigrationEnded )
-		pFnGM_OnHostMigrationEnded = (UFunction*) UObject::GObjObjects()->Data[ 38318 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnHostMigrationEnded_Parms GM_OnHostMigrationEnded_Parms;
 	GM_OnHostMigrationEnded_Parms.bInLobby = bInLobby;
@@ -5318,10 +5084,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnHostMigrationEnded ( unsigned long b
 
 bool USFXOnlineComponentGameFlow::eventGM_OnHostMigrationStarted ( unsigned long bLocalPlayerIsHost )
 {
-	static UFunction* pFnGM_OnHostMigrationStarted = NULL;
-
+	UFunction* pFnGM_OnHostMigrationStarted = (UFunction*) SdkBindings::Get ( 3697 );
 	if ( ! pFnGM_OnHostMigrationStarted )
-		pFnGM_OnHostMigrationStarted = (UFunction*) UObject::GObjObjects()->Data[ 38315 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnHostMigrationStarted_Parms GM_OnHostMigrationStarted_Parms;
 	GM_OnHostMigrationStarted_Parms.bLocalPlayerIsHost = bLocalPlayerIsHost;
@@ -5338,10 +5103,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnHostMigrationStarted ( unsigned long
 
 bool USFXOnlineComponentGameFlow::eventGM_OnProfileSelected ( )
 {
-	static UFunction* pFnGM_OnProfileSelected = NULL;
-
+	UFunction* pFnGM_OnProfileSelected = (UFunction*) SdkBindings::Get ( 3696 );
 	if ( ! pFnGM_OnProfileSelected )
-		pFnGM_OnProfileSelected = (UFunction*) UObject::GObjObjects()->Data[ 38313 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnProfileSelected_Parms GM_OnProfileSelected_Parms;
 
@@ -5357,10 +5121,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnProfileSelected ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_OnNetworkErrorDismissed ( )
 {
-	static UFunction* pFnGM_OnNetworkErrorDismissed = NULL;
-
+	UFunction* pFnGM_OnNetworkErrorDismissed = (UFunction*) SdkBindings::Get ( 3695 );
 	if ( ! pFnGM_OnNetworkErrorDismissed )
-		pFnGM_OnNetworkErrorDismissed = (UFunction*) UObject::GObjObjects()->Data[ 38311 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnNetworkErrorDismissed_Parms GM_OnNetworkErrorDismissed_Parms;
 
@@ -5376,10 +5139,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnNetworkErrorDismissed ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_OnP2PConnectionFailure ( )
 {
-	static UFunction* pFnGM_OnP2PConnectionFailure = NULL;
-
+	UFunction* pFnGM_OnP2PConnectionFailure = (UFunction*) SdkBindings::Get ( 3694 );
 	if ( ! pFnGM_OnP2PConnectionFailure )
-		pFnGM_OnP2PConnectionFailure = (UFunction*) UObject::GObjObjects()->Data[ 38309 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnP2PConnectionFailure_Parms GM_OnP2PConnectionFailure_Parms;
 
@@ -5395,10 +5157,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnP2PConnectionFailure ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_OnDisconnect ( )
 {
-	static UFunction* pFnGM_OnDisconnect = NULL;
-
+	UFunction* pFnGM_OnDisconnect = (UFunction*) SdkBindings::Get ( 3693 );
 	if ( ! pFnGM_OnDisconnect )
-		pFnGM_OnDisconnect = (UFunction*) UObject::GObjObjects()->Data[ 38307 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnDisconnect_Parms GM_OnDisconnect_Parms;
 
@@ -5415,10 +5176,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnDisconnect ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_OnQuickMatchUpdate ( class USFXOnlineEvent_QuickMatch* qmEvent )
 {
-	static UFunction* pFnGM_OnQuickMatchUpdate = NULL;
-
+	UFunction* pFnGM_OnQuickMatchUpdate = (UFunction*) SdkBindings::Get ( 3692 );
 	if ( ! pFnGM_OnQuickMatchUpdate )
-		pFnGM_OnQuickMatchUpdate = (UFunction*) UObject::GObjObjects()->Data[ 38304 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnQuickMatchUpdate_Parms GM_OnQuickMatchUpdate_Parms;
 	GM_OnQuickMatchUpdate_Parms.qmEvent = qmEvent;
@@ -5435,10 +5195,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnQuickMatchUpdate ( class USFXOnlineE
 
 void USFXOnlineComponentGameFlow::GM_OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnGM_OnTick = NULL;
-
+	UFunction* pFnGM_OnTick = (UFunction*) SdkBindings::Get ( 3691 );
 	if ( ! pFnGM_OnTick )
-		pFnGM_OnTick = (UFunction*) UObject::GObjObjects()->Data[ 38302 ];
+		return;
 
 	USFXOnlineComponentGameFlow_execGM_OnTick_Parms GM_OnTick_Parms;
 	GM_OnTick_Parms.oEvent = oEvent;
@@ -5453,10 +5212,9 @@ void USFXOnlineComponentGameFlow::GM_OnTick ( class USFXOnlineEvent* oEvent )
 
 bool USFXOnlineComponentGameFlow::eventGM_CancelSearch ( )
 {
-	static UFunction* pFnGM_CancelSearch = NULL;
-
+	UFunction* pFnGM_CancelSearch = (UFunction*) SdkBindings::Get ( 3690 );
 	if ( ! pFnGM_CancelSearch )
-		pFnGM_CancelSearch = (UFunction*) UObject::GObjObjects()->Data[ 38300 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_CancelSearch_Parms GM_CancelSearch_Parms;
 
@@ -5473,10 +5231,9 @@ bool USFXOnlineComponentGameFlow::eventGM_CancelSearch ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_OnGameJoinFailure ( unsigned char Reason )
 {
-	static UFunction* pFnGM_OnGameJoinFailure = NULL;
-
+	UFunction* pFnGM_OnGameJoinFailure = (UFunction*) SdkBindings::Get ( 3689 );
 	if ( ! pFnGM_OnGameJoinFailure )
-		pFnGM_OnGameJoinFailure = (UFunction*) UObject::GObjObjects()->Data[ 38297 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnGameJoinFailure_Parms GM_OnGameJoinFailure_Parms;
 	GM_OnGameJoinFailure_Parms.Reason = Reason;
@@ -5494,10 +5251,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnGameJoinFailure ( unsigned char Reas
 
 bool USFXOnlineComponentGameFlow::eventGM_OnGameJoined ( unsigned long bSuccess )
 {
-	static UFunction* pFnGM_OnGameJoined = NULL;
-
+	UFunction* pFnGM_OnGameJoined = (UFunction*) SdkBindings::Get ( 3688 );
 	if ( ! pFnGM_OnGameJoined )
-		pFnGM_OnGameJoined = (UFunction*) UObject::GObjObjects()->Data[ 38294 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnGameJoined_Parms GM_OnGameJoined_Parms;
 	GM_OnGameJoined_Parms.bSuccess = bSuccess;
@@ -5514,10 +5270,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnGameJoined ( unsigned long bSuccess
 
 bool USFXOnlineComponentGameFlow::eventGM_OnInviteErrorNotified ( )
 {
-	static UFunction* pFnGM_OnInviteErrorNotified = NULL;
-
+	UFunction* pFnGM_OnInviteErrorNotified = (UFunction*) SdkBindings::Get ( 3687 );
 	if ( ! pFnGM_OnInviteErrorNotified )
-		pFnGM_OnInviteErrorNotified = (UFunction*) UObject::GObjObjects()->Data[ 38292 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnInviteErrorNotified_Parms GM_OnInviteErrorNotified_Parms;
 
@@ -5533,10 +5288,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnInviteErrorNotified ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_OnInviteProceed ( )
 {
-	static UFunction* pFnGM_OnInviteProceed = NULL;
-
+	UFunction* pFnGM_OnInviteProceed = (UFunction*) SdkBindings::Get ( 3686 );
 	if ( ! pFnGM_OnInviteProceed )
-		pFnGM_OnInviteProceed = (UFunction*) UObject::GObjObjects()->Data[ 38290 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnInviteProceed_Parms GM_OnInviteProceed_Parms;
 
@@ -5552,10 +5306,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnInviteProceed ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_OnInviteAborted ( )
 {
-	static UFunction* pFnGM_OnInviteAborted = NULL;
-
+	UFunction* pFnGM_OnInviteAborted = (UFunction*) SdkBindings::Get ( 3685 );
 	if ( ! pFnGM_OnInviteAborted )
-		pFnGM_OnInviteAborted = (UFunction*) UObject::GObjObjects()->Data[ 38288 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnInviteAborted_Parms GM_OnInviteAborted_Parms;
 
@@ -5572,10 +5325,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnInviteAborted ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_OnInviteAccepted ( unsigned long invitedInactiveUser )
 {
-	static UFunction* pFnGM_OnInviteAccepted = NULL;
-
+	UFunction* pFnGM_OnInviteAccepted = (UFunction*) SdkBindings::Get ( 3684 );
 	if ( ! pFnGM_OnInviteAccepted )
-		pFnGM_OnInviteAccepted = (UFunction*) UObject::GObjObjects()->Data[ 38285 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnInviteAccepted_Parms GM_OnInviteAccepted_Parms;
 	GM_OnInviteAccepted_Parms.invitedInactiveUser = invitedInactiveUser;
@@ -5592,10 +5344,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnInviteAccepted ( unsigned long invit
 
 bool USFXOnlineComponentGameFlow::eventGM_OnHostAddressResolved ( )
 {
-	static UFunction* pFnGM_OnHostAddressResolved = NULL;
-
+	UFunction* pFnGM_OnHostAddressResolved = (UFunction*) SdkBindings::Get ( 3683 );
 	if ( ! pFnGM_OnHostAddressResolved )
-		pFnGM_OnHostAddressResolved = (UFunction*) UObject::GObjObjects()->Data[ 38283 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnHostAddressResolved_Parms GM_OnHostAddressResolved_Parms;
 
@@ -5611,10 +5362,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnHostAddressResolved ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_OnLeaveGameComplete ( )
 {
-	static UFunction* pFnGM_OnLeaveGameComplete = NULL;
-
+	UFunction* pFnGM_OnLeaveGameComplete = (UFunction*) SdkBindings::Get ( 3682 );
 	if ( ! pFnGM_OnLeaveGameComplete )
-		pFnGM_OnLeaveGameComplete = (UFunction*) UObject::GObjObjects()->Data[ 38281 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnLeaveGameComplete_Parms GM_OnLeaveGameComplete_Parms;
 
@@ -5630,10 +5380,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnLeaveGameComplete ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_OnLeaveGame ( )
 {
-	static UFunction* pFnGM_OnLeaveGame = NULL;
-
+	UFunction* pFnGM_OnLeaveGame = (UFunction*) SdkBindings::Get ( 3681 );
 	if ( ! pFnGM_OnLeaveGame )
-		pFnGM_OnLeaveGame = (UFunction*) UObject::GObjObjects()->Data[ 38279 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnLeaveGame_Parms GM_OnLeaveGame_Parms;
 
@@ -5650,10 +5399,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnLeaveGame ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_OnGameCreated ( unsigned long bSuccess )
 {
-	static UFunction* pFnGM_OnGameCreated = NULL;
-
+	UFunction* pFnGM_OnGameCreated = (UFunction*) SdkBindings::Get ( 3680 );
 	if ( ! pFnGM_OnGameCreated )
-		pFnGM_OnGameCreated = (UFunction*) UObject::GObjObjects()->Data[ 38276 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnGameCreated_Parms GM_OnGameCreated_Parms;
 	GM_OnGameCreated_Parms.bSuccess = bSuccess;
@@ -5670,10 +5418,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnGameCreated ( unsigned long bSuccess
 
 bool USFXOnlineComponentGameFlow::eventGM_OnCreateGameSent ( )
 {
-	static UFunction* pFnGM_OnCreateGameSent = NULL;
-
+	UFunction* pFnGM_OnCreateGameSent = (UFunction*) SdkBindings::Get ( 3679 );
 	if ( ! pFnGM_OnCreateGameSent )
-		pFnGM_OnCreateGameSent = (UFunction*) UObject::GObjObjects()->Data[ 38274 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnCreateGameSent_Parms GM_OnCreateGameSent_Parms;
 
@@ -5689,10 +5436,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnCreateGameSent ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_OnQuickMatchSent ( )
 {
-	static UFunction* pFnGM_OnQuickMatchSent = NULL;
-
+	UFunction* pFnGM_OnQuickMatchSent = (UFunction*) SdkBindings::Get ( 3678 );
 	if ( ! pFnGM_OnQuickMatchSent )
-		pFnGM_OnQuickMatchSent = (UFunction*) UObject::GObjObjects()->Data[ 38272 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnQuickMatchSent_Parms GM_OnQuickMatchSent_Parms;
 
@@ -5708,10 +5454,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnQuickMatchSent ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_OnExitMPFlow ( )
 {
-	static UFunction* pFnGM_OnExitMPFlow = NULL;
-
+	UFunction* pFnGM_OnExitMPFlow = (UFunction*) SdkBindings::Get ( 3677 );
 	if ( ! pFnGM_OnExitMPFlow )
-		pFnGM_OnExitMPFlow = (UFunction*) UObject::GObjObjects()->Data[ 38270 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnExitMPFlow_Parms GM_OnExitMPFlow_Parms;
 
@@ -5727,10 +5472,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnExitMPFlow ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_OnEnterMPGameResults ( )
 {
-	static UFunction* pFnGM_OnEnterMPGameResults = NULL;
-
+	UFunction* pFnGM_OnEnterMPGameResults = (UFunction*) SdkBindings::Get ( 3676 );
 	if ( ! pFnGM_OnEnterMPGameResults )
-		pFnGM_OnEnterMPGameResults = (UFunction*) UObject::GObjObjects()->Data[ 38268 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnEnterMPGameResults_Parms GM_OnEnterMPGameResults_Parms;
 
@@ -5746,10 +5490,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnEnterMPGameResults ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_OnEnterMPGameplay ( )
 {
-	static UFunction* pFnGM_OnEnterMPGameplay = NULL;
-
+	UFunction* pFnGM_OnEnterMPGameplay = (UFunction*) SdkBindings::Get ( 3675 );
 	if ( ! pFnGM_OnEnterMPGameplay )
-		pFnGM_OnEnterMPGameplay = (UFunction*) UObject::GObjObjects()->Data[ 38266 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnEnterMPGameplay_Parms GM_OnEnterMPGameplay_Parms;
 
@@ -5765,10 +5508,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnEnterMPGameplay ( )
 
 bool USFXOnlineComponentGameFlow::eventGM_OnEnterMPFlow ( )
 {
-	static UFunction* pFnGM_OnEnterMPFlow = NULL;
-
+	UFunction* pFnGM_OnEnterMPFlow = (UFunction*) SdkBindings::Get ( 3674 );
 	if ( ! pFnGM_OnEnterMPFlow )
-		pFnGM_OnEnterMPFlow = (UFunction*) UObject::GObjObjects()->Data[ 38264 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGM_OnEnterMPFlow_Parms GM_OnEnterMPFlow_Parms;
 
@@ -5784,10 +5526,9 @@ bool USFXOnlineComponentGameFlow::eventGM_OnEnterMPFlow ( )
 
 struct FName USFXOnlineComponentGameFlow::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3673 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 38262 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -5806,10 +5547,9 @@ struct FName USFXOnlineComponentGameFlow::GetAPIName ( )
 
 void USFXOnlineComponentGameFlow::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3672 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 38261 ];
+		return;
 
 	USFXOnlineComponentGameFlow_execOnRelease_Parms OnRelease_Parms;
 
@@ -5827,10 +5567,9 @@ void USFXOnlineComponentGameFlow::OnRelease ( )
 
 void USFXOnlineComponentGameFlow::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3671 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 38259 ];
+		return;
 
 	USFXOnlineComponentGameFlow_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -5849,10 +5588,9 @@ void USFXOnlineComponentGameFlow::OnInitialize ( class USFXOnlineSubsystem* oOnl
 
 struct FString USFXOnlineComponentGameFlow::eventGetStateStr ( )
 {
-	static UFunction* pFnGetStateStr = NULL;
-
+	UFunction* pFnGetStateStr = (UFunction*) SdkBindings::Get ( 3670 );
 	if ( ! pFnGetStateStr )
-		pFnGetStateStr = (UFunction*) UObject::GObjObjects()->Data[ 38254 ];
+		return {};
 
 	USFXOnlineComponentGameFlow_eventGetStateStr_Parms GetStateStr_Parms;
 
@@ -5867,10 +5605,9 @@ struct FString USFXOnlineComponentGameFlow::eventGetStateStr ( )
 
 void USFXOnlineComponentHTTPManager::OnDownloadingTick ( )
 {
-	static UFunction* pFnOnDownloadingTick = NULL;
-
+	UFunction* pFnOnDownloadingTick = (UFunction*) SdkBindings::Get ( 3730 );
 	if ( ! pFnOnDownloadingTick )
-		pFnOnDownloadingTick = (UFunction*) UObject::GObjObjects()->Data[ 38623 ];
+		return;
 
 	USFXOnlineComponentHTTPManager_execOnDownloadingTick_Parms OnDownloadingTick_Parms;
 
@@ -5883,10 +5620,9 @@ void USFXOnlineComponentHTTPManager::OnDownloadingTick ( )
 
 void USFXOnlineComponentHTTPManager::OnIdleTick ( )
 {
-	static UFunction* pFnOnIdleTick = NULL;
-
+	UFunction* pFnOnIdleTick = (UFunction*) SdkBindings::Get ( 3729 );
 	if ( ! pFnOnIdleTick )
-		pFnOnIdleTick = (UFunction*) UObject::GObjObjects()->Data[ 38618 ];
+		return;
 
 	USFXOnlineComponentHTTPManager_execOnIdleTick_Parms OnIdleTick_Parms;
 
@@ -5900,10 +5636,9 @@ void USFXOnlineComponentHTTPManager::OnIdleTick ( )
 
 void USFXOnlineComponentHTTPManager::QueueRequest ( class USFXOnlineHTTPRequest* request )
 {
-	static UFunction* pFnQueueRequest = NULL;
-
+	UFunction* pFnQueueRequest = (UFunction*) SdkBindings::Get ( 3728 );
 	if ( ! pFnQueueRequest )
-		pFnQueueRequest = (UFunction*) UObject::GObjObjects()->Data[ 38615 ];
+		return;
 
 	USFXOnlineComponentHTTPManager_execQueueRequest_Parms QueueRequest_Parms;
 	QueueRequest_Parms.request = request;
@@ -5919,10 +5654,9 @@ void USFXOnlineComponentHTTPManager::QueueRequest ( class USFXOnlineHTTPRequest*
 
 bool USFXOnlineComponentHTTPManager::ProcessDownload ( class USFXOnlineHTTPRequest* request )
 {
-	static UFunction* pFnProcessDownload = NULL;
-
+	UFunction* pFnProcessDownload = (UFunction*) SdkBindings::Get ( 3727 );
 	if ( ! pFnProcessDownload )
-		pFnProcessDownload = (UFunction*) UObject::GObjObjects()->Data[ 38611 ];
+		return {};
 
 	USFXOnlineComponentHTTPManager_execProcessDownload_Parms ProcessDownload_Parms;
 	ProcessDownload_Parms.request = request;
@@ -5940,10 +5674,9 @@ bool USFXOnlineComponentHTTPManager::ProcessDownload ( class USFXOnlineHTTPReque
 
 bool USFXOnlineComponentHTTPManager::FetchStatus ( class USFXOnlineHTTPRequest* request )
 {
-	static UFunction* pFnFetchStatus = NULL;
-
+	UFunction* pFnFetchStatus = (UFunction*) SdkBindings::Get ( 3726 );
 	if ( ! pFnFetchStatus )
-		pFnFetchStatus = (UFunction*) UObject::GObjObjects()->Data[ 38608 ];
+		return {};
 
 	USFXOnlineComponentHTTPManager_execFetchStatus_Parms FetchStatus_Parms;
 	FetchStatus_Parms.request = request;
@@ -5965,10 +5698,9 @@ bool USFXOnlineComponentHTTPManager::FetchStatus ( class USFXOnlineHTTPRequest*
 
 bool USFXOnlineComponentHTTPManager::FetchBodyData ( class USFXOnlineHTTPRequest* request )
 {
-	static UFunction* pFnFetchBodyData = NULL;
-
+	UFunction* pFnFetchBodyData = (UFunction*) SdkBindings::Get ( 3725 );
 	if ( ! pFnFetchBodyData )
-		pFnFetchBodyData = (UFunction*) UObject::GObjObjects()->Data[ 38605 ];
+		return {};
 
 	USFXOnlineComponentHTTPManager_execFetchBodyData_Parms FetchBodyData_Parms;
 	FetchBodyData_Parms.request = request;
@@ -5990,10 +5722,9 @@ bool USFXOnlineComponentHTTPManager::FetchBodyData ( class USFXOnlineHTTPRequest
 
 bool USFXOnlineComponentHTTPManager::StartRequest ( class USFXOnlineHTTPRequest* request )
 {
-	static UFunction* pFnStartRequest = NULL;
-
+	UFunction* pFnStartRequest = (UFunction*) SdkBindings::Get ( 3724 );
 	if ( ! pFnStartRequest )
-		pFnStartRequest = (UFunction*) UObject::GObjObjects()->Data[ 38602 ];
+		return {};
 
 	USFXOnlineComponentHTTPManager_execStartRequest_Parms StartRequest_Parms;
 	StartRequest_Parms.request = request;
@@ -6013,10 +5744,9 @@ bool USFXOnlineComponentHTTPManager::StartRequest ( class USFXOnlineHTTPRequest*
 
 void USFXOnlineComponentHTTPManager::StartService ( )
 {
-	static UFunction* pFnStartService = NULL;
-
+	UFunction* pFnStartService = (UFunction*) SdkBindings::Get ( 3723 );
 	if ( ! pFnStartService )
-		pFnStartService = (UFunction*) UObject::GObjObjects()->Data[ 38601 ];
+		return;
 
 	USFXOnlineComponentHTTPManager_execStartService_Parms StartService_Parms;
 
@@ -6034,10 +5764,9 @@ void USFXOnlineComponentHTTPManager::StartService ( )
 
 void USFXOnlineComponentHTTPManager::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
-
+	UFunction* pFnOnTick = (UFunction*) SdkBindings::Get ( 3722 );
 	if ( ! pFnOnTick )
-		pFnOnTick = (UFunction*) UObject::GObjObjects()->Data[ 38597 ];
+		return;
 
 	USFXOnlineComponentHTTPManager_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
@@ -6052,10 +5781,9 @@ void USFXOnlineComponentHTTPManager::OnTick ( class USFXOnlineEvent* oEvent )
 
 struct FName USFXOnlineComponentHTTPManager::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3721 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 38595 ];
+		return {};
 
 	USFXOnlineComponentHTTPManager_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -6074,10 +5802,9 @@ struct FName USFXOnlineComponentHTTPManager::GetAPIName ( )
 
 void USFXOnlineComponentHTTPManager::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3720 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 38594 ];
+		return;
 
 	USFXOnlineComponentHTTPManager_execOnRelease_Parms OnRelease_Parms;
 
@@ -6095,10 +5822,9 @@ void USFXOnlineComponentHTTPManager::OnRelease ( )
 
 void USFXOnlineComponentHTTPManager::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3719 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 38592 ];
+		return;
 
 	USFXOnlineComponentHTTPManager_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -6117,10 +5843,9 @@ void USFXOnlineComponentHTTPManager::OnInitialize ( class USFXOnlineSubsystem* o
 
 void USFXOnlineComponentImageManager::OnJobComplete ( class USFXOnlineHTTPRequest* request )
 {
-	static UFunction* pFnOnJobComplete = NULL;
-
+	UFunction* pFnOnJobComplete = (UFunction*) SdkBindings::Get ( 3751 );
 	if ( ! pFnOnJobComplete )
-		pFnOnJobComplete = (UFunction*) UObject::GObjObjects()->Data[ 38702 ];
+		return;
 
 	USFXOnlineComponentImageManager_execOnJobComplete_Parms OnJobComplete_Parms;
 	OnJobComplete_Parms.request = request;
@@ -6135,10 +5860,9 @@ void USFXOnlineComponentImageManager::OnJobComplete ( class USFXOnlineHTTPReques
 
 int USFXOnlineComponentImageManager::SumTotalSize ( )
 {
-	static UFunction* pFnSumTotalSize = NULL;
-
+	UFunction* pFnSumTotalSize = (UFunction*) SdkBindings::Get ( 3750 );
 	if ( ! pFnSumTotalSize )
-		pFnSumTotalSize = (UFunction*) UObject::GObjObjects()->Data[ 38697 ];
+		return {};
 
 	USFXOnlineComponentImageManager_execSumTotalSize_Parms SumTotalSize_Parms;
 
@@ -6155,10 +5879,9 @@ int USFXOnlineComponentImageManager::SumTotalSize ( )
 
 struct FSFXOnlineImageRequest USFXOnlineComponentImageManager::RemoveRequest ( class USFXOnlineHTTPRequest* request )
 {
-	static UFunction* pFnRemoveRequest = NULL;
-
+	UFunction* pFnRemoveRequest = (UFunction*) SdkBindings::Get ( 3749 );
 	if ( ! pFnRemoveRequest )
-		pFnRemoveRequest = (UFunction*) UObject::GObjObjects()->Data[ 38691 ];
+		return {};
 
 	USFXOnlineComponentImageManager_execRemoveRequest_Parms RemoveRequest_Parms;
 	RemoveRequest_Parms.request = request;
@@ -6175,10 +5898,9 @@ struct FSFXOnlineImageRequest USFXOnlineComponentImageManager::RemoveRequest ( c
 
 void USFXOnlineComponentImageManager::AddCompletedRequest ( struct FSFXOnlineImageRequest request )
 {
-	static UFunction* pFnAddCompletedRequest = NULL;
-
+	UFunction* pFnAddCompletedRequest = (UFunction*) SdkBindings::Get ( 3748 );
 	if ( ! pFnAddCompletedRequest )
-		pFnAddCompletedRequest = (UFunction*) UObject::GObjObjects()->Data[ 38688 ];
+		return;
 
 	USFXOnlineComponentImageManager_execAddCompletedRequest_Parms AddCompletedRequest_Parms;
 	memcpy ( &AddCompletedRequest_Parms.request, &request, 0x18 );
@@ -6193,10 +5915,9 @@ void USFXOnlineComponentImageManager::AddCompletedRequest ( struct FSFXOnlineIma
 
 void USFXOnlineComponentImageManager::AddPendingRequest ( struct FSFXOnlineImageRequest request )
 {
-	static UFunction* pFnAddPendingRequest = NULL;
-
+	UFunction* pFnAddPendingRequest = (UFunction*) SdkBindings::Get ( 3747 );
 	if ( ! pFnAddPendingRequest )
-		pFnAddPendingRequest = (UFunction*) UObject::GObjObjects()->Data[ 38685 ];
+		return;
 
 	USFXOnlineComponentImageManager_execAddPendingRequest_Parms AddPendingRequest_Parms;
 	memcpy ( &AddPendingRequest_Parms.request, &request, 0x18 );
@@ -6212,10 +5933,9 @@ void USFXOnlineComponentImageManager::AddPendingRequest ( struct FSFXOnlineImage
 
 struct FSFXOnlineImageRequest USFXOnlineComponentImageManager::StartRequest ( struct FString ImageName )
 {
-	static UFunction* pFnStartRequest = NULL;
-
+	UFunction* pFnStartRequest = (UFunction*) SdkBindings::Get ( 3745 );
 	if ( ! pFnStartRequest )
-		pFnStartRequest = (UFunction*) UObject::GObjObjects()->Data[ 38676 ];
+		return {};
 
 	USFXOnlineComponentImageManager_execStartRequest_Parms StartRequest_Parms;
 	memcpy ( &StartRequest_Parms.ImageName, &ImageName, 0xC );
@@ -6233,10 +5953,9 @@ struct FSFXOnlineImageRequest USFXOnlineComponentImageManager::StartRequest ( st
 
 struct FSFXOnlineImageRequest USFXOnlineComponentImageManager::GetImage ( struct FString ImageName )
 {
-	static UFunction* pFnGetImage = NULL;
-
+	UFunction* pFnGetImage = (UFunction*) SdkBindings::Get ( 3744 );
 	if ( ! pFnGetImage )
-		pFnGetImage = (UFunction*) UObject::GObjObjects()->Data[ 38672 ];
+		return {};
 
 	USFXOnlineComponentImageManager_execGetImage_Parms GetImage_Parms;
 	memcpy ( &GetImage_Parms.ImageName, &ImageName, 0xC );
@@ -6254,10 +5973,9 @@ struct FSFXOnlineImageRequest USFXOnlineComponentImageManager::GetImage ( struct
 
 void USFXOnlineComponentImageManager::RequestImage ( struct FString ImageName, struct FScriptDelegate CompletedCallback )
 {
-	static UFunction* pFnRequestImage = NULL;
-
+	UFunction* pFnRequestImage = (UFunction*) SdkBindings::Get ( 3740 );
 	if ( ! pFnRequestImage )
-		pFnRequestImage = (UFunction*) UObject::GObjObjects()->Data[ 38660 ];
+		return;
 
 	USFXOnlineComponentImageManager_execRequestImage_Parms RequestImage_Parms;
 	memcpy ( &RequestImage_Parms.ImageName, &ImageName, 0xC );
@@ -6272,10 +5990,9 @@ void USFXOnlineComponentImageManager::RequestImage ( struct FString ImageName, s
 
 void USFXOnlineComponentImageManager::eventClearReferences ( )
 {
-	static UFunction* pFnClearReferences = NULL;
-
+	UFunction* pFnClearReferences = (UFunction*) SdkBindings::Get ( 3739 );
 	if ( ! pFnClearReferences )
-		pFnClearReferences = (UFunction*) UObject::GObjObjects()->Data[ 38659 ];
+		return;
 
 	USFXOnlineComponentImageManager_eventClearReferences_Parms ClearReferences_Parms;
 
@@ -6289,10 +6006,9 @@ void USFXOnlineComponentImageManager::eventClearReferences ( )
 
 void USFXOnlineComponentImageManager::ProcessImage ( struct FSFXOnlineImageRequest* imageRequest )
 {
-	static UFunction* pFnProcessImage = NULL;
-
+	UFunction* pFnProcessImage = (UFunction*) SdkBindings::Get ( 3738 );
 	if ( ! pFnProcessImage )
-		pFnProcessImage = (UFunction*) UObject::GObjObjects()->Data[ 38657 ];
+		return;
 
 	USFXOnlineComponentImageManager_execProcessImage_Parms ProcessImage_Parms;
 
@@ -6313,10 +6029,9 @@ void USFXOnlineComponentImageManager::ProcessImage ( struct FSFXOnlineImageReque
 
 struct FName USFXOnlineComponentImageManager::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3737 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 38655 ];
+		return {};
 
 	USFXOnlineComponentImageManager_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -6335,10 +6050,9 @@ struct FName USFXOnlineComponentImageManager::GetAPIName ( )
 
 void USFXOnlineComponentImageManager::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3736 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 38654 ];
+		return;
 
 	USFXOnlineComponentImageManager_execOnRelease_Parms OnRelease_Parms;
 
@@ -6356,10 +6070,9 @@ void USFXOnlineComponentImageManager::OnRelease ( )
 
 void USFXOnlineComponentImageManager::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3735 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 38652 ];
+		return;
 
 	USFXOnlineComponentImageManager_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -6378,10 +6091,9 @@ void USFXOnlineComponentImageManager::OnInitialize ( class USFXOnlineSubsystem*
 
 void USFXOnlineComponentImageManager::OnImageRequestCompleted ( struct FSFXOnlineImageRequest request )
 {
-	static UFunction* pFnOnImageRequestCompleted = NULL;
-
+	UFunction* pFnOnImageRequestCompleted = (UFunction*) SdkBindings::Get ( 3734 );
 	if ( ! pFnOnImageRequestCompleted )
-		pFnOnImageRequestCompleted = (UFunction*) UObject::GObjObjects()->Data[ 38650 ];
+		return;
 
 	USFXOnlineComponentImageManager_execOnImageRequestCompleted_Parms OnImageRequestCompleted_Parms;
 	memcpy ( &OnImageRequestCompleted_Parms.request, &request, 0x18 );
@@ -6396,10 +6108,9 @@ void USFXOnlineComponentImageManager::OnImageRequestCompleted ( struct FSFXOnlin
 
 void USFXOnlineComponentImageManager::eventSetMaxBytes ( int maxBytes )
 {
-	static UFunction* pFnSetMaxBytes = NULL;
-
+	UFunction* pFnSetMaxBytes = (UFunction*) SdkBindings::Get ( 3733 );
 	if ( ! pFnSetMaxBytes )
-		pFnSetMaxBytes = (UFunction*) UObject::GObjObjects()->Data[ 38647 ];
+		return;
 
 	USFXOnlineComponentImageManager_eventSetMaxBytes_Parms SetMaxBytes_Parms;
 	SetMaxBytes_Parms.maxBytes = maxBytes;
@@ -6414,10 +6125,9 @@ void USFXOnlineComponentImageManager::eventSetMaxBytes ( int maxBytes )
 
 void USFXOnlineComponentImageManager::eventSetMaxImages ( int maxImages )
 {
-	static UFunction* pFnSetMaxImages = NULL;
-
+	UFunction* pFnSetMaxImages = (UFunction*) SdkBindings::Get ( 3732 );
 	if ( ! pFnSetMaxImages )
-		pFnSetMaxImages = (UFunction*) UObject::GObjObjects()->Data[ 38644 ];
+		return;
 
 	USFXOnlineComponentImageManager_eventSetMaxImages_Parms SetMaxImages_Parms;
 	SetMaxImages_Parms.maxImages = maxImages;
@@ -6432,10 +6142,9 @@ void USFXOnlineComponentImageManager::eventSetMaxImages ( int maxImages )
 
 void USFXOnlineComponentImageManager::eventSetBaseURL ( struct FString BaseUrl )
 {
-	static UFunction* pFnSetBaseURL = NULL;
-
+	UFunction* pFnSetBaseURL = (UFunction*) SdkBindings::Get ( 3731 );
 	if ( ! pFnSetBaseURL )
-		pFnSetBaseURL = (UFunction*) UObject::GObjObjects()->Data[ 38641 ];
+		return;
 
 	USFXOnlineComponentImageManager_eventSetBaseURL_Parms SetBaseURL_Parms;
 	memcpy ( &SetBaseURL_Parms.BaseUrl, &BaseUrl, 0xC );
@@ -6452,10 +6161,9 @@ void USFXOnlineComponentImageManager::eventSetBaseURL ( struct FString BaseUrl )
 
 bool USFXOnlineComponentUnrealPlayerEx::UnlockAvatarAward ( unsigned char LocalUserNum, int AvatarItemId )
 {
-	static UFunction* pFnUnlockAvatarAward = NULL;
-
+	UFunction* pFnUnlockAvatarAward = (UFunction*) SdkBindings::Get ( 4065 );
 	if ( ! pFnUnlockAvatarAward )
-		pFnUnlockAvatarAward = (UFunction*) UObject::GObjObjects()->Data[ 39920 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayerEx_execUnlockAvatarAward_Parms UnlockAvatarAward_Parms;
 	UnlockAvatarAward_Parms.LocalUserNum = LocalUserNum;
@@ -6481,10 +6189,9 @@ bool USFXOnlineComponentUnrealPlayerEx::UnlockAvatarAward ( unsigned char LocalU
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowCustomPlayersUI ( unsigned char LocalUserNum, struct FString Title, struct FString Description, TArray< struct FUniqueNetId >* Players )
 {
-	static UFunction* pFnShowCustomPlayersUI = NULL;
-
+	UFunction* pFnShowCustomPlayersUI = (UFunction*) SdkBindings::Get ( 4064 );
 	if ( ! pFnShowCustomPlayersUI )
-		pFnShowCustomPlayersUI = (UFunction*) UObject::GObjObjects()->Data[ 39913 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayerEx_execShowCustomPlayersUI_Parms ShowCustomPlayersUI_Parms;
 	ShowCustomPlayersUI_Parms.LocalUserNum = LocalUserNum;
@@ -6507,10 +6214,9 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowCustomPlayersUI ( unsigned char Loca
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowPlayersUI ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnShowPlayersUI = NULL;
-
+	UFunction* pFnShowPlayersUI = (UFunction*) SdkBindings::Get ( 4063 );
 	if ( ! pFnShowPlayersUI )
-		pFnShowPlayersUI = (UFunction*) UObject::GObjObjects()->Data[ 39910 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayerEx_execShowPlayersUI_Parms ShowPlayersUI_Parms;
 	ShowPlayersUI_Parms.LocalUserNum = LocalUserNum;
@@ -6529,10 +6235,9 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowPlayersUI ( unsigned char LocalUserN
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowFriendsInviteUI ( unsigned char LocalUserNum, struct FUniqueNetId PlayerID )
 {
-	static UFunction* pFnShowFriendsInviteUI = NULL;
-
+	UFunction* pFnShowFriendsInviteUI = (UFunction*) SdkBindings::Get ( 4062 );
 	if ( ! pFnShowFriendsInviteUI )
-		pFnShowFriendsInviteUI = (UFunction*) UObject::GObjObjects()->Data[ 39906 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayerEx_execShowFriendsInviteUI_Parms ShowFriendsInviteUI_Parms;
 	ShowFriendsInviteUI_Parms.LocalUserNum = LocalUserNum;
@@ -6551,10 +6256,9 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowFriendsInviteUI ( unsigned char Loca
 
 void USFXOnlineComponentUnrealPlayerEx::ClearProfileDataChangedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ProfileDataChangedDelegate )
 {
-	static UFunction* pFnClearProfileDataChangedDelegate = NULL;
-
+	UFunction* pFnClearProfileDataChangedDelegate = (UFunction*) SdkBindings::Get ( 4061 );
 	if ( ! pFnClearProfileDataChangedDelegate )
-		pFnClearProfileDataChangedDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39903 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayerEx_execClearProfileDataChangedDelegate_Parms ClearProfileDataChangedDelegate_Parms;
 	ClearProfileDataChangedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -6571,10 +6275,9 @@ void USFXOnlineComponentUnrealPlayerEx::ClearProfileDataChangedDelegate ( unsign
 
 void USFXOnlineComponentUnrealPlayerEx::AddProfileDataChangedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ProfileDataChangedDelegate )
 {
-	static UFunction* pFnAddProfileDataChangedDelegate = NULL;
-
+	UFunction* pFnAddProfileDataChangedDelegate = (UFunction*) SdkBindings::Get ( 4060 );
 	if ( ! pFnAddProfileDataChangedDelegate )
-		pFnAddProfileDataChangedDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39900 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayerEx_execAddProfileDataChangedDelegate_Parms AddProfileDataChangedDelegate_Parms;
 	AddProfileDataChangedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -6589,10 +6292,9 @@ void USFXOnlineComponentUnrealPlayerEx::AddProfileDataChangedDelegate ( unsigned
 
 void USFXOnlineComponentUnrealPlayerEx::OnProfileDataChanged ( )
 {
-	static UFunction* pFnOnProfileDataChanged = NULL;
-
+	UFunction* pFnOnProfileDataChanged = (UFunction*) SdkBindings::Get ( 4059 );
 	if ( ! pFnOnProfileDataChanged )
-		pFnOnProfileDataChanged = (UFunction*) UObject::GObjObjects()->Data[ 39899 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayerEx_execOnProfileDataChanged_Parms OnProfileDataChanged_Parms;
 
@@ -6608,10 +6310,9 @@ void USFXOnlineComponentUnrealPlayerEx::OnProfileDataChanged ( )
 
 bool USFXOnlineComponentUnrealPlayerEx::UnlockGamerPicture ( unsigned char LocalUserNum, int PictureId )
 {
-	static UFunction* pFnUnlockGamerPicture = NULL;
-
+	UFunction* pFnUnlockGamerPicture = (UFunction*) SdkBindings::Get ( 4058 );
 	if ( ! pFnUnlockGamerPicture )
-		pFnUnlockGamerPicture = (UFunction*) UObject::GObjObjects()->Data[ 39895 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayerEx_execUnlockGamerPicture_Parms UnlockGamerPicture_Parms;
 	UnlockGamerPicture_Parms.LocalUserNum = LocalUserNum;
@@ -6631,10 +6332,9 @@ bool USFXOnlineComponentUnrealPlayerEx::UnlockGamerPicture ( unsigned char Local
 
 bool USFXOnlineComponentUnrealPlayerEx::IsDeviceValid ( int DeviceID, int SizeNeeded )
 {
-	static UFunction* pFnIsDeviceValid = NULL;
-
+	UFunction* pFnIsDeviceValid = (UFunction*) SdkBindings::Get ( 4057 );
 	if ( ! pFnIsDeviceValid )
-		pFnIsDeviceValid = (UFunction*) UObject::GObjObjects()->Data[ 39891 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayerEx_execIsDeviceValid_Parms IsDeviceValid_Parms;
 	IsDeviceValid_Parms.DeviceID = DeviceID;
@@ -6658,10 +6358,9 @@ bool USFXOnlineComponentUnrealPlayerEx::IsDeviceValid ( int DeviceID, int SizeNe
 
 int USFXOnlineComponentUnrealPlayerEx::GetDeviceSelectionResults ( unsigned char LocalUserNum, struct FString* DeviceName )
 {
-	static UFunction* pFnGetDeviceSelectionResults = NULL;
-
+	UFunction* pFnGetDeviceSelectionResults = (UFunction*) SdkBindings::Get ( 4056 );
 	if ( ! pFnGetDeviceSelectionResults )
-		pFnGetDeviceSelectionResults = (UFunction*) UObject::GObjObjects()->Data[ 39887 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayerEx_execGetDeviceSelectionResults_Parms GetDeviceSelectionResults_Parms;
 	GetDeviceSelectionResults_Parms.LocalUserNum = LocalUserNum;
@@ -6686,10 +6385,9 @@ int USFXOnlineComponentUnrealPlayerEx::GetDeviceSelectionResults ( unsigned char
 
 void USFXOnlineComponentUnrealPlayerEx::ClearDeviceSelectionDoneDelegate ( unsigned char LocalUserNum, struct FScriptDelegate DeviceDelegate )
 {
-	static UFunction* pFnClearDeviceSelectionDoneDelegate = NULL;
-
+	UFunction* pFnClearDeviceSelectionDoneDelegate = (UFunction*) SdkBindings::Get ( 4055 );
 	if ( ! pFnClearDeviceSelectionDoneDelegate )
-		pFnClearDeviceSelectionDoneDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39883 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayerEx_execClearDeviceSelectionDoneDelegate_Parms ClearDeviceSelectionDoneDelegate_Parms;
 	ClearDeviceSelectionDoneDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -6706,10 +6404,9 @@ void USFXOnlineComponentUnrealPlayerEx::ClearDeviceSelectionDoneDelegate ( unsig
 
 void USFXOnlineComponentUnrealPlayerEx::AddDeviceSelectionDoneDelegate ( unsigned char LocalUserNum, struct FScriptDelegate DeviceDelegate )
 {
-	static UFunction* pFnAddDeviceSelectionDoneDelegate = NULL;
-
+	UFunction* pFnAddDeviceSelectionDoneDelegate = (UFunction*) SdkBindings::Get ( 4054 );
 	if ( ! pFnAddDeviceSelectionDoneDelegate )
-		pFnAddDeviceSelectionDoneDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39878 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayerEx_execAddDeviceSelectionDoneDelegate_Parms AddDeviceSelectionDoneDelegate_Parms;
 	AddDeviceSelectionDoneDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -6726,10 +6423,9 @@ void USFXOnlineComponentUnrealPlayerEx::AddDeviceSelectionDoneDelegate ( unsigne
 
 void USFXOnlineComponentUnrealPlayerEx::OnDeviceSelectionComplete ( unsigned long bWasSuccessful, unsigned long bWasBlocked )
 {
-	static UFunction* pFnOnDeviceSelectionComplete = NULL;
-
+	UFunction* pFnOnDeviceSelectionComplete = (UFunction*) SdkBindings::Get ( 4041 );
 	if ( ! pFnOnDeviceSelectionComplete )
-		pFnOnDeviceSelectionComplete = (UFunction*) UObject::GObjObjects()->Data[ 39834 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayerEx_execOnDeviceSelectionComplete_Parms OnDeviceSelectionComplete_Parms;
 	OnDeviceSelectionComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -6749,10 +6445,9 @@ void USFXOnlineComponentUnrealPlayerEx::OnDeviceSelectionComplete ( unsigned lon
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowDeviceSelectionUI ( unsigned char LocalUserNum, int SizeNeeded, unsigned long bForceShowUI, unsigned long bManageStorage )
 {
-	static UFunction* pFnShowDeviceSelectionUI = NULL;
-
+	UFunction* pFnShowDeviceSelectionUI = (UFunction*) SdkBindings::Get ( 4053 );
 	if ( ! pFnShowDeviceSelectionUI )
-		pFnShowDeviceSelectionUI = (UFunction*) UObject::GObjObjects()->Data[ 39870 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayerEx_execShowDeviceSelectionUI_Parms ShowDeviceSelectionUI_Parms;
 	ShowDeviceSelectionUI_Parms.LocalUserNum = LocalUserNum;
@@ -6777,10 +6472,9 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowDeviceSelectionUI ( unsigned char Lo
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowMembershipMarketplaceUI ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnShowMembershipMarketplaceUI = NULL;
-
+	UFunction* pFnShowMembershipMarketplaceUI = (UFunction*) SdkBindings::Get ( 4052 );
 	if ( ! pFnShowMembershipMarketplaceUI )
-		pFnShowMembershipMarketplaceUI = (UFunction*) UObject::GObjObjects()->Data[ 39867 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayerEx_execShowMembershipMarketplaceUI_Parms ShowMembershipMarketplaceUI_Parms;
 	ShowMembershipMarketplaceUI_Parms.LocalUserNum = LocalUserNum;
@@ -6800,10 +6494,9 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowMembershipMarketplaceUI ( unsigned c
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowContentMarketplaceUI ( unsigned char LocalUserNum, int CategoryMask, int offerId )
 {
-	static UFunction* pFnShowContentMarketplaceUI = NULL;
-
+	UFunction* pFnShowContentMarketplaceUI = (UFunction*) SdkBindings::Get ( 4051 );
 	if ( ! pFnShowContentMarketplaceUI )
-		pFnShowContentMarketplaceUI = (UFunction*) UObject::GObjObjects()->Data[ 39862 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayerEx_execShowContentMarketplaceUI_Parms ShowContentMarketplaceUI_Parms;
 	ShowContentMarketplaceUI_Parms.LocalUserNum = LocalUserNum;
@@ -6824,10 +6517,9 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowContentMarketplaceUI ( unsigned char
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowInviteUI ( unsigned char LocalUserNum, struct FString InviteText )
 {
-	static UFunction* pFnShowInviteUI = NULL;
-
+	UFunction* pFnShowInviteUI = (UFunction*) SdkBindings::Get ( 4050 );
 	if ( ! pFnShowInviteUI )
-		pFnShowInviteUI = (UFunction*) UObject::GObjObjects()->Data[ 39858 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayerEx_execShowInviteUI_Parms ShowInviteUI_Parms;
 	ShowInviteUI_Parms.LocalUserNum = LocalUserNum;
@@ -6846,10 +6538,9 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowInviteUI ( unsigned char LocalUserNu
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowAchievementsUI ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnShowAchievementsUI = NULL;
-
+	UFunction* pFnShowAchievementsUI = (UFunction*) SdkBindings::Get ( 4049 );
 	if ( ! pFnShowAchievementsUI )
-		pFnShowAchievementsUI = (UFunction*) UObject::GObjObjects()->Data[ 39855 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayerEx_execShowAchievementsUI_Parms ShowAchievementsUI_Parms;
 	ShowAchievementsUI_Parms.LocalUserNum = LocalUserNum;
@@ -6867,10 +6558,9 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowAchievementsUI ( unsigned char Local
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowMessagesUI ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnShowMessagesUI = NULL;
-
+	UFunction* pFnShowMessagesUI = (UFunction*) SdkBindings::Get ( 4048 );
 	if ( ! pFnShowMessagesUI )
-		pFnShowMessagesUI = (UFunction*) UObject::GObjObjects()->Data[ 39852 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayerEx_execShowMessagesUI_Parms ShowMessagesUI_Parms;
 	ShowMessagesUI_Parms.LocalUserNum = LocalUserNum;
@@ -6889,10 +6579,9 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowMessagesUI ( unsigned char LocalUser
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowGamerCardUI ( unsigned char LocalUserNum, struct FUniqueNetId PlayerID )
 {
-	static UFunction* pFnShowGamerCardUI = NULL;
-
+	UFunction* pFnShowGamerCardUI = (UFunction*) SdkBindings::Get ( 4047 );
 	if ( ! pFnShowGamerCardUI )
-		pFnShowGamerCardUI = (UFunction*) UObject::GObjObjects()->Data[ 39848 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayerEx_execShowGamerCardUI_Parms ShowGamerCardUI_Parms;
 	ShowGamerCardUI_Parms.LocalUserNum = LocalUserNum;
@@ -6912,10 +6601,9 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowGamerCardUI ( unsigned char LocalUse
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowFeedbackUI ( unsigned char LocalUserNum, struct FUniqueNetId PlayerID )
 {
-	static UFunction* pFnShowFeedbackUI = NULL;
-
+	UFunction* pFnShowFeedbackUI = (UFunction*) SdkBindings::Get ( 4046 );
 	if ( ! pFnShowFeedbackUI )
-		pFnShowFeedbackUI = (UFunction*) UObject::GObjObjects()->Data[ 39844 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayerEx_execShowFeedbackUI_Parms ShowFeedbackUI_Parms;
 	ShowFeedbackUI_Parms.LocalUserNum = LocalUserNum;
@@ -6933,10 +6621,9 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowFeedbackUI ( unsigned char LocalUser
 
 void USFXOnlineComponentUnrealPlayerEx::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
-
+	UFunction* pFnOnTick = (UFunction*) SdkBindings::Get ( 4045 );
 	if ( ! pFnOnTick )
-		pFnOnTick = (UFunction*) UObject::GObjObjects()->Data[ 39842 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayerEx_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
@@ -6955,10 +6642,9 @@ void USFXOnlineComponentUnrealPlayerEx::OnTick ( class USFXOnlineEvent* oEvent )
 
 struct FName USFXOnlineComponentUnrealPlayerEx::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 4044 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 39840 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayerEx_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -6977,10 +6663,9 @@ struct FName USFXOnlineComponentUnrealPlayerEx::GetAPIName ( )
 
 void USFXOnlineComponentUnrealPlayerEx::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 4043 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 39839 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayerEx_execOnRelease_Parms OnRelease_Parms;
 
@@ -6998,10 +6683,9 @@ void USFXOnlineComponentUnrealPlayerEx::OnRelease ( )
 
 void USFXOnlineComponentUnrealPlayerEx::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 4042 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 39837 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayerEx_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -7021,10 +6705,9 @@ void USFXOnlineComponentUnrealPlayerEx::OnInitialize ( class USFXOnlineSubsystem
 
 unsigned char USFXOnlineComponentUnrealSystem::GetTitleFileState ( struct FString Filename )
 {
-	static UFunction* pFnGetTitleFileState = NULL;
-
+	UFunction* pFnGetTitleFileState = (UFunction*) SdkBindings::Get ( 4095 );
 	if ( ! pFnGetTitleFileState )
-		pFnGetTitleFileState = (UFunction*) UObject::GObjObjects()->Data[ 40015 ];
+		return {};
 
 	USFXOnlineComponentUnrealSystem_execGetTitleFileState_Parms GetTitleFileState_Parms;
 	memcpy ( &GetTitleFileState_Parms.Filename, &Filename, 0xC );
@@ -7043,10 +6726,9 @@ unsigned char USFXOnlineComponentUnrealSystem::GetTitleFileState ( struct FStrin
 
 bool USFXOnlineComponentUnrealSystem::GetTitleFileContents ( struct FString Filename, TArray< unsigned char >* FileContents )
 {
-	static UFunction* pFnGetTitleFileContents = NULL;
-
+	UFunction* pFnGetTitleFileContents = (UFunction*) SdkBindings::Get ( 4094 );
 	if ( ! pFnGetTitleFileContents )
-		pFnGetTitleFileContents = (UFunction*) UObject::GObjObjects()->Data[ 40010 ];
+		return {};
 
 	USFXOnlineComponentUnrealSystem_execGetTitleFileContents_Parms GetTitleFileContents_Parms;
 	memcpy ( &GetTitleFileContents_Parms.Filename, &Filename, 0xC );
@@ -7070,10 +6752,9 @@ bool USFXOnlineComponentUnrealSystem::GetTitleFileContents ( struct FString File
 
 void USFXOnlineComponentUnrealSystem::ClearReadTitleFileCompleteDelegate ( struct FScriptDelegate ReadTitleFileCompleteDelegate )
 {
-	static UFunction* pFnClearReadTitleFileCompleteDelegate = NULL;
-
+	UFunction* pFnClearReadTitleFileCompleteDelegate = (UFunction*) SdkBindings::Get ( 4093 );
 	if ( ! pFnClearReadTitleFileCompleteDelegate )
-		pFnClearReadTitleFileCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 40007 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execClearReadTitleFileCompleteDelegate_Parms ClearReadTitleFileCompleteDelegate_Parms;
 	memcpy ( &ClearReadTitleFileCompleteDelegate_Parms.ReadTitleFileCompleteDelegate, &ReadTitleFileCompleteDelegate, 0xC );
@@ -7088,10 +6769,9 @@ void USFXOnlineComponentUnrealSystem::ClearReadTitleFileCompleteDelegate ( struc
 
 void USFXOnlineComponentUnrealSystem::AddReadTitleFileCompleteDelegate ( struct FScriptDelegate ReadTitleFileCompleteDelegate )
 {
-	static UFunction* pFnAddReadTitleFileCompleteDelegate = NULL;
-
+	UFunction* pFnAddReadTitleFileCompleteDelegate = (UFunction*) SdkBindings::Get ( 4092 );
 	if ( ! pFnAddReadTitleFileCompleteDelegate )
-		pFnAddReadTitleFileCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 40005 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execAddReadTitleFileCompleteDelegate_Parms AddReadTitleFileCompleteDelegate_Parms;
 	memcpy ( &AddReadTitleFileCompleteDelegate_Parms.ReadTitleFileCompleteDelegate, &ReadTitleFileCompleteDelegate, 0xC );
@@ -7107,10 +6787,9 @@ void USFXOnlineComponentUnrealSystem::AddReadTitleFileCompleteDelegate ( struct
 
 bool USFXOnlineComponentUnrealSystem::ReadTitleFile ( struct FString FileToRead )
 {
-	static UFunction* pFnReadTitleFile = NULL;
-
+	UFunction* pFnReadTitleFile = (UFunction*) SdkBindings::Get ( 4091 );
 	if ( ! pFnReadTitleFile )
-		pFnReadTitleFile = (UFunction*) UObject::GObjObjects()->Data[ 40002 ];
+		return {};
 
 	USFXOnlineComponentUnrealSystem_execReadTitleFile_Parms ReadTitleFile_Parms;
 	memcpy ( &ReadTitleFile_Parms.FileToRead, &FileToRead, 0xC );
@@ -7132,10 +6811,9 @@ bool USFXOnlineComponentUnrealSystem::ReadTitleFile ( struct FString FileToRead
 
 void USFXOnlineComponentUnrealSystem::OnReadTitleFileComplete ( unsigned long bWasSuccessful, struct FString Filename )
 {
-	static UFunction* pFnOnReadTitleFileComplete = NULL;
-
+	UFunction* pFnOnReadTitleFileComplete = (UFunction*) SdkBindings::Get ( 4068 );
 	if ( ! pFnOnReadTitleFileComplete )
-		pFnOnReadTitleFileComplete = (UFunction*) UObject::GObjObjects()->Data[ 39937 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execOnReadTitleFileComplete_Parms OnReadTitleFileComplete_Parms;
 	OnReadTitleFileComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -7151,10 +6829,9 @@ void USFXOnlineComponentUnrealSystem::OnReadTitleFileComplete ( unsigned long bW
 
 void USFXOnlineComponentUnrealSystem::ClearStorageDeviceChangeDelegate ( struct FScriptDelegate StorageDeviceChangeDelegate )
 {
-	static UFunction* pFnClearStorageDeviceChangeDelegate = NULL;
-
+	UFunction* pFnClearStorageDeviceChangeDelegate = (UFunction*) SdkBindings::Get ( 4090 );
 	if ( ! pFnClearStorageDeviceChangeDelegate )
-		pFnClearStorageDeviceChangeDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39997 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execClearStorageDeviceChangeDelegate_Parms ClearStorageDeviceChangeDelegate_Parms;
 	memcpy ( &ClearStorageDeviceChangeDelegate_Parms.StorageDeviceChangeDelegate, &StorageDeviceChangeDelegate, 0xC );
@@ -7169,10 +6846,9 @@ void USFXOnlineComponentUnrealSystem::ClearStorageDeviceChangeDelegate ( struct
 
 void USFXOnlineComponentUnrealSystem::AddStorageDeviceChangeDelegate ( struct FScriptDelegate StorageDeviceChangeDelegate )
 {
-	static UFunction* pFnAddStorageDeviceChangeDelegate = NULL;
-
+	UFunction* pFnAddStorageDeviceChangeDelegate = (UFunction*) SdkBindings::Get ( 4089 );
 	if ( ! pFnAddStorageDeviceChangeDelegate )
-		pFnAddStorageDeviceChangeDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39995 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execAddStorageDeviceChangeDelegate_Parms AddStorageDeviceChangeDelegate_Parms;
 	memcpy ( &AddStorageDeviceChangeDelegate_Parms.StorageDeviceChangeDelegate, &StorageDeviceChangeDelegate, 0xC );
@@ -7186,10 +6862,9 @@ void USFXOnlineComponentUnrealSystem::AddStorageDeviceChangeDelegate ( struct FS
 
 void USFXOnlineComponentUnrealSystem::OnStorageDeviceChange ( )
 {
-	static UFunction* pFnOnStorageDeviceChange = NULL;
-
+	UFunction* pFnOnStorageDeviceChange = (UFunction*) SdkBindings::Get ( 4069 );
 	if ( ! pFnOnStorageDeviceChange )
-		pFnOnStorageDeviceChange = (UFunction*) UObject::GObjObjects()->Data[ 39940 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execOnStorageDeviceChange_Parms OnStorageDeviceChange_Parms;
 
@@ -7203,10 +6878,9 @@ void USFXOnlineComponentUnrealSystem::OnStorageDeviceChange ( )
 
 unsigned char USFXOnlineComponentUnrealSystem::GetNATType ( )
 {
-	static UFunction* pFnGetNATType = NULL;
-
+	UFunction* pFnGetNATType = (UFunction*) SdkBindings::Get ( 4088 );
 	if ( ! pFnGetNATType )
-		pFnGetNATType = (UFunction*) UObject::GObjObjects()->Data[ 39993 ];
+		return {};
 
 	USFXOnlineComponentUnrealSystem_execGetNATType_Parms GetNATType_Parms;
 
@@ -7222,10 +6896,9 @@ unsigned char USFXOnlineComponentUnrealSystem::GetNATType ( )
 
 void USFXOnlineComponentUnrealSystem::ClearConnectionStatusChangeDelegate ( struct FScriptDelegate ConnectionStatusDelegate )
 {
-	static UFunction* pFnClearConnectionStatusChangeDelegate = NULL;
-
+	UFunction* pFnClearConnectionStatusChangeDelegate = (UFunction*) SdkBindings::Get ( 4087 );
 	if ( ! pFnClearConnectionStatusChangeDelegate )
-		pFnClearConnectionStatusChangeDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39990 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execClearConnectionStatusChangeDelegate_Parms ClearConnectionStatusChangeDelegate_Parms;
 	memcpy ( &ClearConnectionStatusChangeDelegate_Parms.ConnectionStatusDelegate, &ConnectionStatusDelegate, 0xC );
@@ -7240,10 +6913,9 @@ void USFXOnlineComponentUnrealSystem::ClearConnectionStatusChangeDelegate ( stru
 
 void USFXOnlineComponentUnrealSystem::AddConnectionStatusChangeDelegate ( struct FScriptDelegate ConnectionStatusDelegate )
 {
-	static UFunction* pFnAddConnectionStatusChangeDelegate = NULL;
-
+	UFunction* pFnAddConnectionStatusChangeDelegate = (UFunction*) SdkBindings::Get ( 4086 );
 	if ( ! pFnAddConnectionStatusChangeDelegate )
-		pFnAddConnectionStatusChangeDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39987 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execAddConnectionStatusChangeDelegate_Parms AddConnectionStatusChangeDelegate_Parms;
 	memcpy ( &AddConnectionStatusChangeDelegate_Parms.ConnectionStatusDelegate, &ConnectionStatusDelegate, 0xC );
@@ -7258,10 +6930,9 @@ void USFXOnlineComponentUnrealSystem::AddConnectionStatusChangeDelegate ( struct
 
 void USFXOnlineComponentUnrealSystem::OnConnectionStatusChange ( unsigned char ConnectionStatus )
 {
-	static UFunction* pFnOnConnectionStatusChange = NULL;
-
+	UFunction* pFnOnConnectionStatusChange = (UFunction*) SdkBindings::Get ( 4070 );
 	if ( ! pFnOnConnectionStatusChange )
-		pFnOnConnectionStatusChange = (UFunction*) UObject::GObjObjects()->Data[ 39943 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execOnConnectionStatusChange_Parms OnConnectionStatusChange_Parms;
 	OnConnectionStatusChange_Parms.ConnectionStatus = ConnectionStatus;
@@ -7277,10 +6948,9 @@ void USFXOnlineComponentUnrealSystem::OnConnectionStatusChange ( unsigned char C
 
 bool USFXOnlineComponentUnrealSystem::IsControllerConnected ( int ControllerId )
 {
-	static UFunction* pFnIsControllerConnected = NULL;
-
+	UFunction* pFnIsControllerConnected = (UFunction*) SdkBindings::Get ( 4085 );
 	if ( ! pFnIsControllerConnected )
-		pFnIsControllerConnected = (UFunction*) UObject::GObjObjects()->Data[ 39983 ];
+		return {};
 
 	USFXOnlineComponentUnrealSystem_execIsControllerConnected_Parms IsControllerConnected_Parms;
 	IsControllerConnected_Parms.ControllerId = ControllerId;
@@ -7301,10 +6971,9 @@ bool USFXOnlineComponentUnrealSystem::IsControllerConnected ( int ControllerId )
 
 void USFXOnlineComponentUnrealSystem::ClearControllerChangeDelegate ( struct FScriptDelegate ControllerChangeDelegate )
 {
-	static UFunction* pFnClearControllerChangeDelegate = NULL;
-
+	UFunction* pFnClearControllerChangeDelegate = (UFunction*) SdkBindings::Get ( 4084 );
 	if ( ! pFnClearControllerChangeDelegate )
-		pFnClearControllerChangeDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39980 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execClearControllerChangeDelegate_Parms ClearControllerChangeDelegate_Parms;
 	memcpy ( &ClearControllerChangeDelegate_Parms.ControllerChangeDelegate, &ControllerChangeDelegate, 0xC );
@@ -7319,10 +6988,9 @@ void USFXOnlineComponentUnrealSystem::ClearControllerChangeDelegate ( struct FSc
 
 void USFXOnlineComponentUnrealSystem::AddControllerChangeDelegate ( struct FScriptDelegate ControllerChangeDelegate )
 {
-	static UFunction* pFnAddControllerChangeDelegate = NULL;
-
+	UFunction* pFnAddControllerChangeDelegate = (UFunction*) SdkBindings::Get ( 4083 );
 	if ( ! pFnAddControllerChangeDelegate )
-		pFnAddControllerChangeDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39977 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execAddControllerChangeDelegate_Parms AddControllerChangeDelegate_Parms;
 	memcpy ( &AddControllerChangeDelegate_Parms.ControllerChangeDelegate, &ControllerChangeDelegate, 0xC );
@@ -7338,10 +7006,9 @@ void USFXOnlineComponentUnrealSystem::AddControllerChangeDelegate ( struct FScri
 
 void USFXOnlineComponentUnrealSystem::OnControllerChange ( int ControllerId, unsigned long bIsConnected )
 {
-	static UFunction* pFnOnControllerChange = NULL;
-
+	UFunction* pFnOnControllerChange = (UFunction*) SdkBindings::Get ( 4067 );
 	if ( ! pFnOnControllerChange )
-		pFnOnControllerChange = (UFunction*) UObject::GObjObjects()->Data[ 39932 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execOnControllerChange_Parms OnControllerChange_Parms;
 	OnControllerChange_Parms.ControllerId = ControllerId;
@@ -7357,10 +7024,9 @@ void USFXOnlineComponentUnrealSystem::OnControllerChange ( int ControllerId, uns
 
 void USFXOnlineComponentUnrealSystem::SetNetworkNotificationPosition ( unsigned char NewPos )
 {
-	static UFunction* pFnSetNetworkNotificationPosition = NULL;
-
+	UFunction* pFnSetNetworkNotificationPosition = (UFunction*) SdkBindings::Get ( 4082 );
 	if ( ! pFnSetNetworkNotificationPosition )
-		pFnSetNetworkNotificationPosition = (UFunction*) UObject::GObjObjects()->Data[ 39973 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execSetNetworkNotificationPosition_Parms SetNetworkNotificationPosition_Parms;
 	SetNetworkNotificationPosition_Parms.NewPos = NewPos;
@@ -7379,10 +7045,9 @@ void USFXOnlineComponentUnrealSystem::SetNetworkNotificationPosition ( unsigned
 
 unsigned char USFXOnlineComponentUnrealSystem::GetNetworkNotificationPosition ( )
 {
-	static UFunction* pFnGetNetworkNotificationPosition = NULL;
-
+	UFunction* pFnGetNetworkNotificationPosition = (UFunction*) SdkBindings::Get ( 4081 );
 	if ( ! pFnGetNetworkNotificationPosition )
-		pFnGetNetworkNotificationPosition = (UFunction*) UObject::GObjObjects()->Data[ 39970 ];
+		return {};
 
 	USFXOnlineComponentUnrealSystem_execGetNetworkNotificationPosition_Parms GetNetworkNotificationPosition_Parms;
 
@@ -7398,10 +7063,9 @@ unsigned char USFXOnlineComponentUnrealSystem::GetNetworkNotificationPosition (
 
 void USFXOnlineComponentUnrealSystem::ProcessExternalUINotification ( unsigned long bOpening )
 {
-	static UFunction* pFnProcessExternalUINotification = NULL;
-
+	UFunction* pFnProcessExternalUINotification = (UFunction*) SdkBindings::Get ( 4080 );
 	if ( ! pFnProcessExternalUINotification )
-		pFnProcessExternalUINotification = (UFunction*) UObject::GObjObjects()->Data[ 39968 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execProcessExternalUINotification_Parms ProcessExternalUINotification_Parms;
 	ProcessExternalUINotification_Parms.bOpening = bOpening;
@@ -7420,10 +7084,9 @@ void USFXOnlineComponentUnrealSystem::ProcessExternalUINotification ( unsigned l
 
 void USFXOnlineComponentUnrealSystem::ClearExternalUIChangeDelegate ( struct FScriptDelegate ExternalUIDelegate )
 {
-	static UFunction* pFnClearExternalUIChangeDelegate = NULL;
-
+	UFunction* pFnClearExternalUIChangeDelegate = (UFunction*) SdkBindings::Get ( 4079 );
 	if ( ! pFnClearExternalUIChangeDelegate )
-		pFnClearExternalUIChangeDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39965 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execClearExternalUIChangeDelegate_Parms ClearExternalUIChangeDelegate_Parms;
 	memcpy ( &ClearExternalUIChangeDelegate_Parms.ExternalUIDelegate, &ExternalUIDelegate, 0xC );
@@ -7438,10 +7101,9 @@ void USFXOnlineComponentUnrealSystem::ClearExternalUIChangeDelegate ( struct FSc
 
 void USFXOnlineComponentUnrealSystem::AddExternalUIChangeDelegate ( struct FScriptDelegate ExternalUIDelegate )
 {
-	static UFunction* pFnAddExternalUIChangeDelegate = NULL;
-
+	UFunction* pFnAddExternalUIChangeDelegate = (UFunction*) SdkBindings::Get ( 4078 );
 	if ( ! pFnAddExternalUIChangeDelegate )
-		pFnAddExternalUIChangeDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39962 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execAddExternalUIChangeDelegate_Parms AddExternalUIChangeDelegate_Parms;
 	memcpy ( &AddExternalUIChangeDelegate_Parms.ExternalUIDelegate, &ExternalUIDelegate, 0xC );
@@ -7456,10 +7118,9 @@ void USFXOnlineComponentUnrealSystem::AddExternalUIChangeDelegate ( struct FScri
 
 void USFXOnlineComponentUnrealSystem::OnExternalUIChange ( unsigned long bIsOpening )
 {
-	static UFunction* pFnOnExternalUIChange = NULL;
-
+	UFunction* pFnOnExternalUIChange = (UFunction*) SdkBindings::Get ( 4066 );
 	if ( ! pFnOnExternalUIChange )
-		pFnOnExternalUIChange = (UFunction*) UObject::GObjObjects()->Data[ 39929 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execOnExternalUIChange_Parms OnExternalUIChange_Parms;
 	OnExternalUIChange_Parms.bIsOpening = bIsOpening;
@@ -7474,10 +7135,9 @@ void USFXOnlineComponentUnrealSystem::OnExternalUIChange ( unsigned long bIsOpen
 
 void USFXOnlineComponentUnrealSystem::ClearLinkStatusChangeDelegate ( struct FScriptDelegate LinkStatusDelegate )
 {
-	static UFunction* pFnClearLinkStatusChangeDelegate = NULL;
-
+	UFunction* pFnClearLinkStatusChangeDelegate = (UFunction*) SdkBindings::Get ( 4077 );
 	if ( ! pFnClearLinkStatusChangeDelegate )
-		pFnClearLinkStatusChangeDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39958 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execClearLinkStatusChangeDelegate_Parms ClearLinkStatusChangeDelegate_Parms;
 	memcpy ( &ClearLinkStatusChangeDelegate_Parms.LinkStatusDelegate, &LinkStatusDelegate, 0xC );
@@ -7492,10 +7152,9 @@ void USFXOnlineComponentUnrealSystem::ClearLinkStatusChangeDelegate ( struct FSc
 
 void USFXOnlineComponentUnrealSystem::AddLinkStatusChangeDelegate ( struct FScriptDelegate LinkStatusDelegate )
 {
-	static UFunction* pFnAddLinkStatusChangeDelegate = NULL;
-
+	UFunction* pFnAddLinkStatusChangeDelegate = (UFunction*) SdkBindings::Get ( 4076 );
 	if ( ! pFnAddLinkStatusChangeDelegate )
-		pFnAddLinkStatusChangeDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39955 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execAddLinkStatusChangeDelegate_Parms AddLinkStatusChangeDelegate_Parms;
 	memcpy ( &AddLinkStatusChangeDelegate_Parms.LinkStatusDelegate, &LinkStatusDelegate, 0xC );
@@ -7510,10 +7169,9 @@ void USFXOnlineComponentUnrealSystem::AddLinkStatusChangeDelegate ( struct FScri
 
 void USFXOnlineComponentUnrealSystem::OnLinkStatusChange ( unsigned long bIsConnected )
 {
-	static UFunction* pFnOnLinkStatusChange = NULL;
-
+	UFunction* pFnOnLinkStatusChange = (UFunction*) SdkBindings::Get ( 4075 );
 	if ( ! pFnOnLinkStatusChange )
-		pFnOnLinkStatusChange = (UFunction*) UObject::GObjObjects()->Data[ 39953 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execOnLinkStatusChange_Parms OnLinkStatusChange_Parms;
 	OnLinkStatusChange_Parms.bIsConnected = bIsConnected;
@@ -7528,10 +7186,9 @@ void USFXOnlineComponentUnrealSystem::OnLinkStatusChange ( unsigned long bIsConn
 
 bool USFXOnlineComponentUnrealSystem::HasLinkConnection ( )
 {
-	static UFunction* pFnHasLinkConnection = NULL;
-
+	UFunction* pFnHasLinkConnection = (UFunction*) SdkBindings::Get ( 4074 );
 	if ( ! pFnHasLinkConnection )
-		pFnHasLinkConnection = (UFunction*) UObject::GObjObjects()->Data[ 39951 ];
+		return {};
 
 	USFXOnlineComponentUnrealSystem_execHasLinkConnection_Parms HasLinkConnection_Parms;
 
@@ -7551,10 +7208,9 @@ bool USFXOnlineComponentUnrealSystem::HasLinkConnection ( )
 
 struct FName USFXOnlineComponentUnrealSystem::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 4073 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 39949 ];
+		return {};
 
 	USFXOnlineComponentUnrealSystem_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -7573,10 +7229,9 @@ struct FName USFXOnlineComponentUnrealSystem::GetAPIName ( )
 
 void USFXOnlineComponentUnrealSystem::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 4072 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 39948 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execOnRelease_Parms OnRelease_Parms;
 
@@ -7594,10 +7249,9 @@ void USFXOnlineComponentUnrealSystem::OnRelease ( )
 
 void USFXOnlineComponentUnrealSystem::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 4071 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 39946 ];
+		return;
 
 	USFXOnlineComponentUnrealSystem_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -7616,10 +7270,9 @@ void USFXOnlineComponentUnrealSystem::OnInitialize ( class USFXOnlineSubsystem*
 
 void USFXOnlineComponentVoiceInterface::ClearPlayerTalkingDelegate ( struct FScriptDelegate TalkerDelegate )
 {
-	static UFunction* pFnClearPlayerTalkingDelegate = NULL;
-
+	UFunction* pFnClearPlayerTalkingDelegate = (UFunction*) SdkBindings::Get ( 4138 );
 	if ( ! pFnClearPlayerTalkingDelegate )
-		pFnClearPlayerTalkingDelegate = (UFunction*) UObject::GObjObjects()->Data[ 40154 ];
+		return;
 
 	USFXOnlineComponentVoiceInterface_execClearPlayerTalkingDelegate_Parms ClearPlayerTalkingDelegate_Parms;
 	memcpy ( &ClearPlayerTalkingDelegate_Parms.TalkerDelegate, &TalkerDelegate, 0xC );
@@ -7634,10 +7287,9 @@ void USFXOnlineComponentVoiceInterface::ClearPlayerTalkingDelegate ( struct FScr
 
 void USFXOnlineComponentVoiceInterface::AddPlayerTalkingDelegate ( struct FScriptDelegate TalkerDelegate )
 {
-	static UFunction* pFnAddPlayerTalkingDelegate = NULL;
-
+	UFunction* pFnAddPlayerTalkingDelegate = (UFunction*) SdkBindings::Get ( 4137 );
 	if ( ! pFnAddPlayerTalkingDelegate )
-		pFnAddPlayerTalkingDelegate = (UFunction*) UObject::GObjObjects()->Data[ 40151 ];
+		return;
 
 	USFXOnlineComponentVoiceInterface_execAddPlayerTalkingDelegate_Parms AddPlayerTalkingDelegate_Parms;
 	memcpy ( &AddPlayerTalkingDelegate_Parms.TalkerDelegate, &TalkerDelegate, 0xC );
@@ -7652,10 +7304,9 @@ void USFXOnlineComponentVoiceInterface::AddPlayerTalkingDelegate ( struct FScrip
 
 void USFXOnlineComponentVoiceInterface::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
-
+	UFunction* pFnOnTick = (UFunction*) SdkBindings::Get ( 4136 );
 	if ( ! pFnOnTick )
-		pFnOnTick = (UFunction*) UObject::GObjObjects()->Data[ 40149 ];
+		return;
 
 	USFXOnlineComponentVoiceInterface_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
@@ -7673,10 +7324,9 @@ void USFXOnlineComponentVoiceInterface::OnTick ( class USFXOnlineEvent* oEvent )
 
 void USFXOnlineComponentVoiceInterface::ResetVoiceSystem ( )
 {
-	static UFunction* pFnResetVoiceSystem = NULL;
-
+	UFunction* pFnResetVoiceSystem = (UFunction*) SdkBindings::Get ( 4135 );
 	if ( ! pFnResetVoiceSystem )
-		pFnResetVoiceSystem = (UFunction*) UObject::GObjObjects()->Data[ 40148 ];
+		return;
 
 	USFXOnlineComponentVoiceInterface_execResetVoiceSystem_Parms ResetVoiceSystem_Parms;
 
@@ -7693,10 +7343,9 @@ void USFXOnlineComponentVoiceInterface::ResetVoiceSystem ( )
 
 void USFXOnlineComponentVoiceInterface::ApplyOptions ( )
 {
-	static UFunction* pFnApplyOptions = NULL;
-
+	UFunction* pFnApplyOptions = (UFunction*) SdkBindings::Get ( 4134 );
 	if ( ! pFnApplyOptions )
-		pFnApplyOptions = (UFunction*) UObject::GObjObjects()->Data[ 40147 ];
+		return;
 
 	USFXOnlineComponentVoiceInterface_execApplyOptions_Parms ApplyOptions_Parms;
 
@@ -7714,10 +7363,9 @@ void USFXOnlineComponentVoiceInterface::ApplyOptions ( )
 
 void USFXOnlineComponentVoiceInterface::SetVoiceMode ( int voiceMode )
 {
-	static UFunction* pFnSetVoiceMode = NULL;
-
+	UFunction* pFnSetVoiceMode = (UFunction*) SdkBindings::Get ( 4133 );
 	if ( ! pFnSetVoiceMode )
-		pFnSetVoiceMode = (UFunction*) UObject::GObjObjects()->Data[ 40145 ];
+		return;
 
 	USFXOnlineComponentVoiceInterface_execSetVoiceMode_Parms SetVoiceMode_Parms;
 	SetVoiceMode_Parms.voiceMode = voiceMode;
@@ -7735,10 +7383,9 @@ void USFXOnlineComponentVoiceInterface::SetVoiceMode ( int voiceMode )
 
 void USFXOnlineComponentVoiceInterface::PushToTalkEnd ( )
 {
-	static UFunction* pFnPushToTalkEnd = NULL;
-
+	UFunction* pFnPushToTalkEnd = (UFunction*) SdkBindings::Get ( 4132 );
 	if ( ! pFnPushToTalkEnd )
-		pFnPushToTalkEnd = (UFunction*) UObject::GObjObjects()->Data[ 40144 ];
+		return;
 
 	USFXOnlineComponentVoiceInterface_execPushToTalkEnd_Parms PushToTalkEnd_Parms;
 
@@ -7755,10 +7402,9 @@ void USFXOnlineComponentVoiceInterface::PushToTalkEnd ( )
 
 void USFXOnlineComponentVoiceInterface::PushToTalkStart ( )
 {
-	static UFunction* pFnPushToTalkStart = NULL;
-
+	UFunction* pFnPushToTalkStart = (UFunction*) SdkBindings::Get ( 4131 );
 	if ( ! pFnPushToTalkStart )
-		pFnPushToTalkStart = (UFunction*) UObject::GObjObjects()->Data[ 40143 ];
+		return;
 
 	USFXOnlineComponentVoiceInterface_execPushToTalkStart_Parms PushToTalkStart_Parms;
 
@@ -7777,10 +7423,9 @@ void USFXOnlineComponentVoiceInterface::PushToTalkStart ( )
 
 bool USFXOnlineComponentVoiceInterface::SetOutputDevice ( int outputDeviceId )
 {
-	static UFunction* pFnSetOutputDevice = NULL;
-
+	UFunction* pFnSetOutputDevice = (UFunction*) SdkBindings::Get ( 4130 );
 	if ( ! pFnSetOutputDevice )
-		pFnSetOutputDevice = (UFunction*) UObject::GObjObjects()->Data[ 40140 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execSetOutputDevice_Parms SetOutputDevice_Parms;
 	SetOutputDevice_Parms.outputDeviceId = outputDeviceId;
@@ -7802,10 +7447,9 @@ bool USFXOnlineComponentVoiceInterface::SetOutputDevice ( int outputDeviceId )
 
 bool USFXOnlineComponentVoiceInterface::SetInputDevice ( int inputDeviceId )
 {
-	static UFunction* pFnSetInputDevice = NULL;
-
+	UFunction* pFnSetInputDevice = (UFunction*) SdkBindings::Get ( 4129 );
 	if ( ! pFnSetInputDevice )
-		pFnSetInputDevice = (UFunction*) UObject::GObjObjects()->Data[ 40137 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execSetInputDevice_Parms SetInputDevice_Parms;
 	SetInputDevice_Parms.inputDeviceId = inputDeviceId;
@@ -7826,10 +7470,9 @@ bool USFXOnlineComponentVoiceInterface::SetInputDevice ( int inputDeviceId )
 
 int USFXOnlineComponentVoiceInterface::GetDefaultOutputDevice ( )
 {
-	static UFunction* pFnGetDefaultOutputDevice = NULL;
-
+	UFunction* pFnGetDefaultOutputDevice = (UFunction*) SdkBindings::Get ( 4128 );
 	if ( ! pFnGetDefaultOutputDevice )
-		pFnGetDefaultOutputDevice = (UFunction*) UObject::GObjObjects()->Data[ 40135 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execGetDefaultOutputDevice_Parms GetDefaultOutputDevice_Parms;
 
@@ -7849,10 +7492,9 @@ int USFXOnlineComponentVoiceInterface::GetDefaultOutputDevice ( )
 
 int USFXOnlineComponentVoiceInterface::GetDefaultInputDevice ( )
 {
-	static UFunction* pFnGetDefaultInputDevice = NULL;
-
+	UFunction* pFnGetDefaultInputDevice = (UFunction*) SdkBindings::Get ( 4127 );
 	if ( ! pFnGetDefaultInputDevice )
-		pFnGetDefaultInputDevice = (UFunction*) UObject::GObjObjects()->Data[ 40133 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execGetDefaultInputDevice_Parms GetDefaultInputDevice_Parms;
 
@@ -7873,10 +7515,9 @@ int USFXOnlineComponentVoiceInterface::GetDefaultInputDevice ( )
 
 bool USFXOnlineComponentVoiceInterface::EnumerateOutputDevices ( TArray< struct FString >* OutputDevices )
 {
-	static UFunction* pFnEnumerateOutputDevices = NULL;
-
+	UFunction* pFnEnumerateOutputDevices = (UFunction*) SdkBindings::Get ( 4126 );
 	if ( ! pFnEnumerateOutputDevices )
-		pFnEnumerateOutputDevices = (UFunction*) UObject::GObjObjects()->Data[ 40129 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execEnumerateOutputDevices_Parms EnumerateOutputDevices_Parms;
 
@@ -7900,10 +7541,9 @@ bool USFXOnlineComponentVoiceInterface::EnumerateOutputDevices ( TArray< struct
 
 bool USFXOnlineComponentVoiceInterface::EnumerateInputDevices ( TArray< struct FString >* InputDevices )
 {
-	static UFunction* pFnEnumerateInputDevices = NULL;
-
+	UFunction* pFnEnumerateInputDevices = (UFunction*) SdkBindings::Get ( 4125 );
 	if ( ! pFnEnumerateInputDevices )
-		pFnEnumerateInputDevices = (UFunction*) UObject::GObjObjects()->Data[ 40125 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execEnumerateInputDevices_Parms EnumerateInputDevices_Parms;
 
@@ -7927,10 +7567,9 @@ bool USFXOnlineComponentVoiceInterface::EnumerateInputDevices ( TArray< struct F
 
 bool USFXOnlineComponentVoiceInterface::SetVolume ( float Volume )
 {
-	static UFunction* pFnSetVolume = NULL;
-
+	UFunction* pFnSetVolume = (UFunction*) SdkBindings::Get ( 4124 );
 	if ( ! pFnSetVolume )
-		pFnSetVolume = (UFunction*) UObject::GObjObjects()->Data[ 40122 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execSetVolume_Parms SetVolume_Parms;
 	SetVolume_Parms.Volume = Volume;
@@ -7952,10 +7591,9 @@ bool USFXOnlineComponentVoiceInterface::SetVolume ( float Volume )
 
 bool USFXOnlineComponentVoiceInterface::UnmuteAll ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnUnmuteAll = NULL;
-
+	UFunction* pFnUnmuteAll = (UFunction*) SdkBindings::Get ( 4123 );
 	if ( ! pFnUnmuteAll )
-		pFnUnmuteAll = (UFunction*) UObject::GObjObjects()->Data[ 40119 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execUnmuteAll_Parms UnmuteAll_Parms;
 	UnmuteAll_Parms.LocalUserNum = LocalUserNum;
@@ -7978,10 +7616,9 @@ bool USFXOnlineComponentVoiceInterface::UnmuteAll ( unsigned char LocalUserNum )
 
 bool USFXOnlineComponentVoiceInterface::MuteAll ( unsigned char LocalUserNum, unsigned long bAllowFriends )
 {
-	static UFunction* pFnMuteAll = NULL;
-
+	UFunction* pFnMuteAll = (UFunction*) SdkBindings::Get ( 4122 );
 	if ( ! pFnMuteAll )
-		pFnMuteAll = (UFunction*) UObject::GObjObjects()->Data[ 40115 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execMuteAll_Parms MuteAll_Parms;
 	MuteAll_Parms.LocalUserNum = LocalUserNum;
@@ -8005,10 +7642,9 @@ bool USFXOnlineComponentVoiceInterface::MuteAll ( unsigned char LocalUserNum, un
 
 bool USFXOnlineComponentVoiceInterface::SetSpeechRecognitionObject ( unsigned char LocalUserNum, class USpeechRecognition* SpeechRecogObj )
 {
-	static UFunction* pFnSetSpeechRecognitionObject = NULL;
-
+	UFunction* pFnSetSpeechRecognitionObject = (UFunction*) SdkBindings::Get ( 4121 );
 	if ( ! pFnSetSpeechRecognitionObject )
-		pFnSetSpeechRecognitionObject = (UFunction*) UObject::GObjObjects()->Data[ 40111 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execSetSpeechRecognitionObject_Parms SetSpeechRecognitionObject_Parms;
 	SetSpeechRecognitionObject_Parms.LocalUserNum = LocalUserNum;
@@ -8032,10 +7668,9 @@ bool USFXOnlineComponentVoiceInterface::SetSpeechRecognitionObject ( unsigned ch
 
 bool USFXOnlineComponentVoiceInterface::SelectVocabulary ( unsigned char LocalUserNum, int VocabularyId )
 {
-	static UFunction* pFnSelectVocabulary = NULL;
-
+	UFunction* pFnSelectVocabulary = (UFunction*) SdkBindings::Get ( 4120 );
 	if ( ! pFnSelectVocabulary )
-		pFnSelectVocabulary = (UFunction*) UObject::GObjObjects()->Data[ 40107 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execSelectVocabulary_Parms SelectVocabulary_Parms;
 	SelectVocabulary_Parms.LocalUserNum = LocalUserNum;
@@ -8058,10 +7693,9 @@ bool USFXOnlineComponentVoiceInterface::SelectVocabulary ( unsigned char LocalUs
 
 void USFXOnlineComponentVoiceInterface::ClearRecognitionCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate RecognitionDelegate )
 {
-	static UFunction* pFnClearRecognitionCompleteDelegate = NULL;
-
+	UFunction* pFnClearRecognitionCompleteDelegate = (UFunction*) SdkBindings::Get ( 4119 );
 	if ( ! pFnClearRecognitionCompleteDelegate )
-		pFnClearRecognitionCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 40104 ];
+		return;
 
 	USFXOnlineComponentVoiceInterface_execClearRecognitionCompleteDelegate_Parms ClearRecognitionCompleteDelegate_Parms;
 	ClearRecognitionCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -8082,10 +7716,9 @@ void USFXOnlineComponentVoiceInterface::ClearRecognitionCompleteDelegate ( unsig
 
 void USFXOnlineComponentVoiceInterface::AddRecognitionCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate RecognitionDelegate )
 {
-	static UFunction* pFnAddRecognitionCompleteDelegate = NULL;
-
+	UFunction* pFnAddRecognitionCompleteDelegate = (UFunction*) SdkBindings::Get ( 4118 );
 	if ( ! pFnAddRecognitionCompleteDelegate )
-		pFnAddRecognitionCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 40101 ];
+		return;
 
 	USFXOnlineComponentVoiceInterface_execAddRecognitionCompleteDelegate_Parms AddRecognitionCompleteDelegate_Parms;
 	AddRecognitionCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -8107,10 +7740,9 @@ void USFXOnlineComponentVoiceInterface::AddRecognitionCompleteDelegate ( unsigne
 
 bool USFXOnlineComponentVoiceInterface::GetRecognitionResults ( unsigned char LocalUserNum, TArray< struct FSpeechRecognizedWord >* Words )
 {
-	static UFunction* pFnGetRecognitionResults = NULL;
-
+	UFunction* pFnGetRecognitionResults = (UFunction*) SdkBindings::Get ( 4117 );
 	if ( ! pFnGetRecognitionResults )
-		pFnGetRecognitionResults = (UFunction*) UObject::GObjObjects()->Data[ 40096 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execGetRecognitionResults_Parms GetRecognitionResults_Parms;
 	GetRecognitionResults_Parms.LocalUserNum = LocalUserNum;
@@ -8135,10 +7767,9 @@ bool USFXOnlineComponentVoiceInterface::GetRecognitionResults ( unsigned char Lo
 
 bool USFXOnlineComponentVoiceInterface::StopSpeechRecognition ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnStopSpeechRecognition = NULL;
-
+	UFunction* pFnStopSpeechRecognition = (UFunction*) SdkBindings::Get ( 4116 );
 	if ( ! pFnStopSpeechRecognition )
-		pFnStopSpeechRecognition = (UFunction*) UObject::GObjObjects()->Data[ 40093 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execStopSpeechRecognition_Parms StopSpeechRecognition_Parms;
 	StopSpeechRecognition_Parms.LocalUserNum = LocalUserNum;
@@ -8160,10 +7791,9 @@ bool USFXOnlineComponentVoiceInterface::StopSpeechRecognition ( unsigned char Lo
 
 bool USFXOnlineComponentVoiceInterface::StartSpeechRecognition ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnStartSpeechRecognition = NULL;
-
+	UFunction* pFnStartSpeechRecognition = (UFunction*) SdkBindings::Get ( 4115 );
 	if ( ! pFnStartSpeechRecognition )
-		pFnStartSpeechRecognition = (UFunction*) UObject::GObjObjects()->Data[ 40090 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execStartSpeechRecognition_Parms StartSpeechRecognition_Parms;
 	StartSpeechRecognition_Parms.LocalUserNum = LocalUserNum;
@@ -8184,10 +7814,9 @@ bool USFXOnlineComponentVoiceInterface::StartSpeechRecognition ( unsigned char L
 
 void USFXOnlineComponentVoiceInterface::StopNetworkedVoice ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnStopNetworkedVoice = NULL;
-
+	UFunction* pFnStopNetworkedVoice = (UFunction*) SdkBindings::Get ( 4114 );
 	if ( ! pFnStopNetworkedVoice )
-		pFnStopNetworkedVoice = (UFunction*) UObject::GObjObjects()->Data[ 40088 ];
+		return;
 
 	USFXOnlineComponentVoiceInterface_execStopNetworkedVoice_Parms StopNetworkedVoice_Parms;
 	StopNetworkedVoice_Parms.LocalUserNum = LocalUserNum;
@@ -8206,10 +7835,9 @@ void USFXOnlineComponentVoiceInterface::StopNetworkedVoice ( unsigned char Local
 
 void USFXOnlineComponentVoiceInterface::StartNetworkedVoice ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnStartNetworkedVoice = NULL;
-
+	UFunction* pFnStartNetworkedVoice = (UFunction*) SdkBindings::Get ( 4113 );
 	if ( ! pFnStartNetworkedVoice )
-		pFnStartNetworkedVoice = (UFunction*) UObject::GObjObjects()->Data[ 40086 ];
+		return;
 
 	USFXOnlineComponentVoiceInterface_execStartNetworkedVoice_Parms StartNetworkedVoice_Parms;
 	StartNetworkedVoice_Parms.LocalUserNum = LocalUserNum;
@@ -8230,10 +7858,9 @@ void USFXOnlineComponentVoiceInterface::StartNetworkedVoice ( unsigned char Loca
 
 bool USFXOnlineComponentVoiceInterface::IsRemoteTalkerMuted ( unsigned char LocalUserNum, struct FUniqueNetId PlayerID )
 {
-	static UFunction* pFnIsRemoteTalkerMuted = NULL;
-
+	UFunction* pFnIsRemoteTalkerMuted = (UFunction*) SdkBindings::Get ( 4112 );
 	if ( ! pFnIsRemoteTalkerMuted )
-		pFnIsRemoteTalkerMuted = (UFunction*) UObject::GObjObjects()->Data[ 40082 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execIsRemoteTalkerMuted_Parms IsRemoteTalkerMuted_Parms;
 	IsRemoteTalkerMuted_Parms.LocalUserNum = LocalUserNum;
@@ -8257,10 +7884,9 @@ bool USFXOnlineComponentVoiceInterface::IsRemoteTalkerMuted ( unsigned char Loca
 
 bool USFXOnlineComponentVoiceInterface::UnmuteRemoteTalker ( unsigned char LocalUserNum, struct FUniqueNetId PlayerID )
 {
-	static UFunction* pFnUnmuteRemoteTalker = NULL;
-
+	UFunction* pFnUnmuteRemoteTalker = (UFunction*) SdkBindings::Get ( 4111 );
 	if ( ! pFnUnmuteRemoteTalker )
-		pFnUnmuteRemoteTalker = (UFunction*) UObject::GObjObjects()->Data[ 40078 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execUnmuteRemoteTalker_Parms UnmuteRemoteTalker_Parms;
 	UnmuteRemoteTalker_Parms.LocalUserNum = LocalUserNum;
@@ -8284,10 +7910,9 @@ bool USFXOnlineComponentVoiceInterface::UnmuteRemoteTalker ( unsigned char Local
 
 bool USFXOnlineComponentVoiceInterface::MuteRemoteTalker ( unsigned char LocalUserNum, struct FUniqueNetId PlayerID )
 {
-	static UFunction* pFnMuteRemoteTalker = NULL;
-
+	UFunction* pFnMuteRemoteTalker = (UFunction*) SdkBindings::Get ( 4110 );
 	if ( ! pFnMuteRemoteTalker )
-		pFnMuteRemoteTalker = (UFunction*) UObject::GObjObjects()->Data[ 40074 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execMuteRemoteTalker_Parms MuteRemoteTalker_Parms;
 	MuteRemoteTalker_Parms.LocalUserNum = LocalUserNum;
@@ -8312,10 +7937,9 @@ bool USFXOnlineComponentVoiceInterface::MuteRemoteTalker ( unsigned char LocalUs
 
 bool USFXOnlineComponentVoiceInterface::SetRemoteTalkerPriority ( unsigned char LocalUserNum, struct FUniqueNetId PlayerID, int Priority )
 {
-	static UFunction* pFnSetRemoteTalkerPriority = NULL;
-
+	UFunction* pFnSetRemoteTalkerPriority = (UFunction*) SdkBindings::Get ( 4109 );
 	if ( ! pFnSetRemoteTalkerPriority )
-		pFnSetRemoteTalkerPriority = (UFunction*) UObject::GObjObjects()->Data[ 40069 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execSetRemoteTalkerPriority_Parms SetRemoteTalkerPriority_Parms;
 	SetRemoteTalkerPriority_Parms.LocalUserNum = LocalUserNum;
@@ -8339,10 +7963,9 @@ bool USFXOnlineComponentVoiceInterface::SetRemoteTalkerPriority ( unsigned char
 
 bool USFXOnlineComponentVoiceInterface::IsHeadsetPresent ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnIsHeadsetPresent = NULL;
-
+	UFunction* pFnIsHeadsetPresent = (UFunction*) SdkBindings::Get ( 4108 );
 	if ( ! pFnIsHeadsetPresent )
-		pFnIsHeadsetPresent = (UFunction*) UObject::GObjObjects()->Data[ 40066 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execIsHeadsetPresent_Parms IsHeadsetPresent_Parms;
 	IsHeadsetPresent_Parms.LocalUserNum = LocalUserNum;
@@ -8364,10 +7987,9 @@ bool USFXOnlineComponentVoiceInterface::IsHeadsetPresent ( unsigned char LocalUs
 
 int USFXOnlineComponentVoiceInterface::GetRemotePlayerStatus ( struct FUniqueNetId PlayerID )
 {
-	static UFunction* pFnGetRemotePlayerStatus = NULL;
-
+	UFunction* pFnGetRemotePlayerStatus = (UFunction*) SdkBindings::Get ( 4107 );
 	if ( ! pFnGetRemotePlayerStatus )
-		pFnGetRemotePlayerStatus = (UFunction*) UObject::GObjObjects()->Data[ 40063 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execGetRemotePlayerStatus_Parms GetRemotePlayerStatus_Parms;
 	memcpy ( &GetRemotePlayerStatus_Parms.PlayerID, &PlayerID, 0x8 );
@@ -8389,10 +8011,9 @@ int USFXOnlineComponentVoiceInterface::GetRemotePlayerStatus ( struct FUniqueNet
 
 bool USFXOnlineComponentVoiceInterface::IsRemotePlayerTalking ( struct FUniqueNetId PlayerID )
 {
-	static UFunction* pFnIsRemotePlayerTalking = NULL;
-
+	UFunction* pFnIsRemotePlayerTalking = (UFunction*) SdkBindings::Get ( 4106 );
 	if ( ! pFnIsRemotePlayerTalking )
-		pFnIsRemotePlayerTalking = (UFunction*) UObject::GObjObjects()->Data[ 40060 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execIsRemotePlayerTalking_Parms IsRemotePlayerTalking_Parms;
 	memcpy ( &IsRemotePlayerTalking_Parms.PlayerID, &PlayerID, 0x8 );
@@ -8414,10 +8035,9 @@ bool USFXOnlineComponentVoiceInterface::IsRemotePlayerTalking ( struct FUniqueNe
 
 bool USFXOnlineComponentVoiceInterface::IsLocalPlayerTalking ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnIsLocalPlayerTalking = NULL;
-
+	UFunction* pFnIsLocalPlayerTalking = (UFunction*) SdkBindings::Get ( 4105 );
 	if ( ! pFnIsLocalPlayerTalking )
-		pFnIsLocalPlayerTalking = (UFunction*) UObject::GObjObjects()->Data[ 40057 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execIsLocalPlayerTalking_Parms IsLocalPlayerTalking_Parms;
 	IsLocalPlayerTalking_Parms.LocalUserNum = LocalUserNum;
@@ -8439,10 +8059,9 @@ bool USFXOnlineComponentVoiceInterface::IsLocalPlayerTalking ( unsigned char Loc
 
 bool USFXOnlineComponentVoiceInterface::UnregisterRemoteTalker ( struct FUniqueNetId PlayerID )
 {
-	static UFunction* pFnUnregisterRemoteTalker = NULL;
-
+	UFunction* pFnUnregisterRemoteTalker = (UFunction*) SdkBindings::Get ( 4104 );
 	if ( ! pFnUnregisterRemoteTalker )
-		pFnUnregisterRemoteTalker = (UFunction*) UObject::GObjObjects()->Data[ 40054 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execUnregisterRemoteTalker_Parms UnregisterRemoteTalker_Parms;
 	memcpy ( &UnregisterRemoteTalker_Parms.PlayerID, &PlayerID, 0x8 );
@@ -8464,10 +8083,9 @@ bool USFXOnlineComponentVoiceInterface::UnregisterRemoteTalker ( struct FUniqueN
 
 bool USFXOnlineComponentVoiceInterface::RegisterRemoteTalker ( struct FUniqueNetId PlayerID )
 {
-	static UFunction* pFnRegisterRemoteTalker = NULL;
-
+	UFunction* pFnRegisterRemoteTalker = (UFunction*) SdkBindings::Get ( 4103 );
 	if ( ! pFnRegisterRemoteTalker )
-		pFnRegisterRemoteTalker = (UFunction*) UObject::GObjObjects()->Data[ 40051 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execRegisterRemoteTalker_Parms RegisterRemoteTalker_Parms;
 	memcpy ( &RegisterRemoteTalker_Parms.PlayerID, &PlayerID, 0x8 );
@@ -8489,10 +8107,9 @@ bool USFXOnlineComponentVoiceInterface::RegisterRemoteTalker ( struct FUniqueNet
 
 bool USFXOnlineComponentVoiceInterface::UnregisterLocalTalker ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnUnregisterLocalTalker = NULL;
-
+	UFunction* pFnUnregisterLocalTalker = (UFunction*) SdkBindings::Get ( 4102 );
 	if ( ! pFnUnregisterLocalTalker )
-		pFnUnregisterLocalTalker = (UFunction*) UObject::GObjObjects()->Data[ 40048 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execUnregisterLocalTalker_Parms UnregisterLocalTalker_Parms;
 	UnregisterLocalTalker_Parms.LocalUserNum = LocalUserNum;
@@ -8514,10 +8131,9 @@ bool USFXOnlineComponentVoiceInterface::UnregisterLocalTalker ( unsigned char Lo
 
 bool USFXOnlineComponentVoiceInterface::RegisterLocalTalker ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnRegisterLocalTalker = NULL;
-
+	UFunction* pFnRegisterLocalTalker = (UFunction*) SdkBindings::Get ( 4101 );
 	if ( ! pFnRegisterLocalTalker )
-		pFnRegisterLocalTalker = (UFunction*) UObject::GObjObjects()->Data[ 40045 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execRegisterLocalTalker_Parms RegisterLocalTalker_Parms;
 	RegisterLocalTalker_Parms.LocalUserNum = LocalUserNum;
@@ -8537,10 +8153,9 @@ bool USFXOnlineComponentVoiceInterface::RegisterLocalTalker ( unsigned char Loca
 
 void USFXOnlineComponentVoiceInterface::OnRecognitionComplete ( )
 {
-	static UFunction* pFnOnRecognitionComplete = NULL;
-
+	UFunction* pFnOnRecognitionComplete = (UFunction*) SdkBindings::Get ( 4100 );
 	if ( ! pFnOnRecognitionComplete )
-		pFnOnRecognitionComplete = (UFunction*) UObject::GObjObjects()->Data[ 40044 ];
+		return;
 
 	USFXOnlineComponentVoiceInterface_execOnRecognitionComplete_Parms OnRecognitionComplete_Parms;
 
@@ -8555,10 +8170,9 @@ void USFXOnlineComponentVoiceInterface::OnRecognitionComplete ( )
 
 void USFXOnlineComponentVoiceInterface::OnPlayerTalkingStateChange ( struct FUniqueNetId Player, unsigned long bIsTalking )
 {
-	static UFunction* pFnOnPlayerTalkingStateChange = NULL;
-
+	UFunction* pFnOnPlayerTalkingStateChange = (UFunction*) SdkBindings::Get ( 4096 );
 	if ( ! pFnOnPlayerTalkingStateChange )
-		pFnOnPlayerTalkingStateChange = (UFunction*) UObject::GObjObjects()->Data[ 40031 ];
+		return;
 
 	USFXOnlineComponentVoiceInterface_execOnPlayerTalkingStateChange_Parms OnPlayerTalkingStateChange_Parms;
 	memcpy ( &OnPlayerTalkingStateChange_Parms.Player, &Player, 0x8 );
@@ -8574,10 +8188,9 @@ void USFXOnlineComponentVoiceInterface::OnPlayerTalkingStateChange ( struct FUni
 
 struct FName USFXOnlineComponentVoiceInterface::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 4099 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 40040 ];
+		return {};
 
 	USFXOnlineComponentVoiceInterface_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -8596,10 +8209,9 @@ struct FName USFXOnlineComponentVoiceInterface::GetAPIName ( )
 
 void USFXOnlineComponentVoiceInterface::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 4098 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 40039 ];
+		return;
 
 	USFXOnlineComponentVoiceInterface_execOnRelease_Parms OnRelease_Parms;
 
@@ -8617,10 +8229,9 @@ void USFXOnlineComponentVoiceInterface::OnRelease ( )
 
 void USFXOnlineComponentVoiceInterface::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 4097 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 40037 ];
+		return;
 
 	USFXOnlineComponentVoiceInterface_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -8639,10 +8250,9 @@ void USFXOnlineComponentVoiceInterface::OnInitialize ( class USFXOnlineSubsystem
 
 struct FName USFXOnlineComponentXMLParser::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 4159 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 40237 ];
+		return {};
 
 	USFXOnlineComponentXMLParser_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -8661,10 +8271,9 @@ struct FName USFXOnlineComponentXMLParser::GetAPIName ( )
 
 void USFXOnlineComponentXMLParser::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 4158 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 40236 ];
+		return;
 
 	USFXOnlineComponentXMLParser_execOnRelease_Parms OnRelease_Parms;
 
@@ -8682,10 +8291,9 @@ void USFXOnlineComponentXMLParser::OnRelease ( )
 
 void USFXOnlineComponentXMLParser::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 4157 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 40234 ];
+		return;
 
 	USFXOnlineComponentXMLParser_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -8708,10 +8316,9 @@ void USFXOnlineComponentXMLParser::OnInitialize ( class USFXOnlineSubsystem* oOn
 
 bool USFXOnlineComponentXMLParser::GetXMLAttribInteger ( struct FString Element, struct FString attrib, int skipcount, int* intOut )
 {
-	static UFunction* pFnGetXMLAttribInteger = NULL;
-
+	UFunction* pFnGetXMLAttribInteger = (UFunction*) SdkBindings::Get ( 4156 );
 	if ( ! pFnGetXMLAttribInteger )
-		pFnGetXMLAttribInteger = (UFunction*) UObject::GObjObjects()->Data[ 40228 ];
+		return {};
 
 	USFXOnlineComponentXMLParser_execGetXMLAttribInteger_Parms GetXMLAttribInteger_Parms;
 	memcpy ( &GetXMLAttribInteger_Parms.Element, &Element, 0xC );
@@ -8741,10 +8348,9 @@ bool USFXOnlineComponentXMLParser::GetXMLAttribInteger ( struct FString Element,
 
 bool USFXOnlineComponentXMLParser::GetXMLAttribString ( struct FString Element, struct FString attrib, int skipcount, struct FString* stringOut )
 {
-	static UFunction* pFnGetXMLAttribString = NULL;
-
+	UFunction* pFnGetXMLAttribString = (UFunction*) SdkBindings::Get ( 4155 );
 	if ( ! pFnGetXMLAttribString )
-		pFnGetXMLAttribString = (UFunction*) UObject::GObjObjects()->Data[ 40222 ];
+		return {};
 
 	USFXOnlineComponentXMLParser_execGetXMLAttribString_Parms GetXMLAttribString_Parms;
 	memcpy ( &GetXMLAttribString_Parms.Element, &Element, 0xC );
@@ -8773,10 +8379,9 @@ bool USFXOnlineComponentXMLParser::GetXMLAttribString ( struct FString Element,
 
 bool USFXOnlineComponentXMLParser::GetXMLInteger ( struct FString Element, int skipcount, int* intOut )
 {
-	static UFunction* pFnGetXMLInteger = NULL;
-
+	UFunction* pFnGetXMLInteger = (UFunction*) SdkBindings::Get ( 3660 );
 	if ( ! pFnGetXMLInteger )
-		pFnGetXMLInteger = (UFunction*) UObject::GObjObjects()->Data[ 38170 ];
+		return {};
 
 	USFXOnlineComponentXMLParser_execGetXMLInteger_Parms GetXMLInteger_Parms;
 	memcpy ( &GetXMLInteger_Parms.Element, &Element, 0xC );
@@ -8804,10 +8409,9 @@ bool USFXOnlineComponentXMLParser::GetXMLInteger ( struct FString Element, int s
 
 bool USFXOnlineComponentXMLParser::GetXMLString ( struct FString Element, int skipcount, struct FString* stringOut )
 {
-	static UFunction* pFnGetXMLString = NULL;
-
+	UFunction* pFnGetXMLString = (UFunction*) SdkBindings::Get ( 3661 );
 	if ( ! pFnGetXMLString )
-		pFnGetXMLString = (UFunction*) UObject::GObjObjects()->Data[ 38172 ];
+		return {};
 
 	USFXOnlineComponentXMLParser_execGetXMLString_Parms GetXMLString_Parms;
 	memcpy ( &GetXMLString_Parms.Element, &Element, 0xC );
@@ -8832,10 +8436,9 @@ bool USFXOnlineComponentXMLParser::GetXMLString ( struct FString Element, int sk
 
 void USFXOnlineComponentXMLParser::StartParsing ( struct FString xmlInput )
 {
-	static UFunction* pFnStartParsing = NULL;
-
+	UFunction* pFnStartParsing = (UFunction*) SdkBindings::Get ( 4154 );
 	if ( ! pFnStartParsing )
-		pFnStartParsing = (UFunction*) UObject::GObjObjects()->Data[ 40214 ];
+		return;
 
 	USFXOnlineComponentXMLParser_execStartParsing_Parms StartParsing_Parms;
 	memcpy ( &StartParsing_Parms.xmlInput, &xmlInput, 0xC );
@@ -8854,10 +8457,9 @@ void USFXOnlineComponentXMLParser::StartParsing ( struct FString xmlInput )
 
 struct FName USFXOnlineComponentCoordinator::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3622 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 38017 ];
+		return {};
 
 	USFXOnlineComponentCoordinator_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -8876,10 +8478,9 @@ struct FName USFXOnlineComponentCoordinator::GetAPIName ( )
 
 void USFXOnlineComponentCoordinator::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3621 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 38016 ];
+		return;
 
 	USFXOnlineComponentCoordinator_execOnRelease_Parms OnRelease_Parms;
 
@@ -8897,10 +8498,9 @@ void USFXOnlineComponentCoordinator::OnRelease ( )
 
 void USFXOnlineComponentCoordinator::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3620 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 38014 ];
+		return;
 
 	USFXOnlineComponentCoordinator_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -8919,10 +8519,9 @@ void USFXOnlineComponentCoordinator::OnInitialize ( class USFXOnlineSubsystem* o
 
 void USFXOnlineComponentCoordinator::StopWaitingForAllWork ( class UObject* oCallbackTarget )
 {
-	static UFunction* pFnStopWaitingForAllWork = NULL;
-
+	UFunction* pFnStopWaitingForAllWork = (UFunction*) SdkBindings::Get ( 3619 );
 	if ( ! pFnStopWaitingForAllWork )
-		pFnStopWaitingForAllWork = (UFunction*) UObject::GObjObjects()->Data[ 38012 ];
+		return;
 
 	USFXOnlineComponentCoordinator_execStopWaitingForAllWork_Parms StopWaitingForAllWork_Parms;
 	StopWaitingForAllWork_Parms.oCallbackTarget = oCallbackTarget;
@@ -8942,10 +8541,9 @@ void USFXOnlineComponentCoordinator::StopWaitingForAllWork ( class UObject* oCal
 
 void USFXOnlineComponentCoordinator::WaitingForWorkSetObject ( TArray< class USFXOnlineEvent* > aEventObjects, struct FScriptDelegate fnWorkComplete )
 {
-	static UFunction* pFnWaitingForWorkSetObject = NULL;
-
+	UFunction* pFnWaitingForWorkSetObject = (UFunction*) SdkBindings::Get ( 3618 );
 	if ( ! pFnWaitingForWorkSetObject )
-		pFnWaitingForWorkSetObject = (UFunction*) UObject::GObjObjects()->Data[ 38008 ];
+		return;
 
 	USFXOnlineComponentCoordinator_execWaitingForWorkSetObject_Parms WaitingForWorkSetObject_Parms;
 	memcpy ( &WaitingForWorkSetObject_Parms.aEventObjects, &aEventObjects, 0xC );
@@ -8967,10 +8565,9 @@ void USFXOnlineComponentCoordinator::WaitingForWorkSetObject ( TArray< class USF
 
 void USFXOnlineComponentCoordinator::WaitingForWorkSetType ( TArray< unsigned char > aEventTypes, struct FScriptDelegate fnWorkComplete, TArray< int > aWorkEventIds )
 {
-	static UFunction* pFnWaitingForWorkSetType = NULL;
-
+	UFunction* pFnWaitingForWorkSetType = (UFunction*) SdkBindings::Get ( 3617 );
 	if ( ! pFnWaitingForWorkSetType )
-		pFnWaitingForWorkSetType = (UFunction*) UObject::GObjObjects()->Data[ 38002 ];
+		return;
 
 	USFXOnlineComponentCoordinator_execWaitingForWorkSetType_Parms WaitingForWorkSetType_Parms;
 	memcpy ( &WaitingForWorkSetType_Parms.aEventTypes, &aEventTypes, 0xC );
@@ -8992,10 +8589,9 @@ void USFXOnlineComponentCoordinator::WaitingForWorkSetType ( TArray< unsigned ch
 
 void USFXOnlineComponentCoordinator::WaitingForWorkBlocking ( unsigned char eEventType, int nEventID )
 {
-	static UFunction* pFnWaitingForWorkBlocking = NULL;
-
+	UFunction* pFnWaitingForWorkBlocking = (UFunction*) SdkBindings::Get ( 3616 );
 	if ( ! pFnWaitingForWorkBlocking )
-		pFnWaitingForWorkBlocking = (UFunction*) UObject::GObjObjects()->Data[ 37999 ];
+		return;
 
 	USFXOnlineComponentCoordinator_execWaitingForWorkBlocking_Parms WaitingForWorkBlocking_Parms;
 	WaitingForWorkBlocking_Parms.eEventType = eEventType;
@@ -9016,10 +8612,9 @@ void USFXOnlineComponentCoordinator::WaitingForWorkBlocking ( unsigned char eEve
 
 void USFXOnlineComponentCoordinator::WaitingForWorkObject ( class USFXOnlineEvent* oEvent, struct FScriptDelegate fnWorkComplete )
 {
-	static UFunction* pFnWaitingForWorkObject = NULL;
-
+	UFunction* pFnWaitingForWorkObject = (UFunction*) SdkBindings::Get ( 3615 );
 	if ( ! pFnWaitingForWorkObject )
-		pFnWaitingForWorkObject = (UFunction*) UObject::GObjObjects()->Data[ 37996 ];
+		return;
 
 	USFXOnlineComponentCoordinator_execWaitingForWorkObject_Parms WaitingForWorkObject_Parms;
 	WaitingForWorkObject_Parms.oEvent = oEvent;
@@ -9041,10 +8636,9 @@ void USFXOnlineComponentCoordinator::WaitingForWorkObject ( class USFXOnlineEven
 
 void USFXOnlineComponentCoordinator::WaitingForWorkType ( unsigned char eEventType, struct FScriptDelegate fnWorkComplete, int nEventID )
 {
-	static UFunction* pFnWaitingForWorkType = NULL;
-
+	UFunction* pFnWaitingForWorkType = (UFunction*) SdkBindings::Get ( 3614 );
 	if ( ! pFnWaitingForWorkType )
-		pFnWaitingForWorkType = (UFunction*) UObject::GObjObjects()->Data[ 37992 ];
+		return;
 
 	USFXOnlineComponentCoordinator_execWaitingForWorkType_Parms WaitingForWorkType_Parms;
 	WaitingForWorkType_Parms.eEventType = eEventType;
@@ -9067,10 +8661,9 @@ void USFXOnlineComponentCoordinator::WaitingForWorkType ( unsigned char eEventTy
 
 bool USFXOnlineComponentCoordinator::GetAllPendingEvents ( unsigned char EventType, TArray< class USFXOnlineEvent* >* PendingEvents )
 {
-	static UFunction* pFnGetAllPendingEvents = NULL;
-
+	UFunction* pFnGetAllPendingEvents = (UFunction*) SdkBindings::Get ( 3613 );
 	if ( ! pFnGetAllPendingEvents )
-		pFnGetAllPendingEvents = (UFunction*) UObject::GObjObjects()->Data[ 37987 ];
+		return {};
 
 	USFXOnlineComponentCoordinator_execGetAllPendingEvents_Parms GetAllPendingEvents_Parms;
 	GetAllPendingEvents_Parms.EventType = EventType;
@@ -9095,10 +8688,9 @@ bool USFXOnlineComponentCoordinator::GetAllPendingEvents ( unsigned char EventTy
 
 bool USFXOnlineComponentCoordinator::IsAnyEventPending ( unsigned char EventType )
 {
-	static UFunction* pFnIsAnyEventPending = NULL;
-
+	UFunction* pFnIsAnyEventPending = (UFunction*) SdkBindings::Get ( 3612 );
 	if ( ! pFnIsAnyEventPending )
-		pFnIsAnyEventPending = (UFunction*) UObject::GObjObjects()->Data[ 37984 ];
+		return {};
 
 	USFXOnlineComponentCoordinator_execIsAnyEventPending_Parms IsAnyEventPending_Parms;
 	IsAnyEventPending_Parms.EventType = EventType;
@@ -9121,10 +8713,9 @@ bool USFXOnlineComponentCoordinator::IsAnyEventPending ( unsigned char EventType
 
 bool USFXOnlineComponentCoordinator::IsEventPending ( unsigned char eEventType, int nEventID )
 {
-	static UFunction* pFnIsEventPending = NULL;
-
+	UFunction* pFnIsEventPending = (UFunction*) SdkBindings::Get ( 3611 );
 	if ( ! pFnIsEventPending )
-		pFnIsEventPending = (UFunction*) UObject::GObjObjects()->Data[ 37980 ];
+		return {};
 
 	USFXOnlineComponentCoordinator_execIsEventPending_Parms IsEventPending_Parms;
 	IsEventPending_Parms.eEventType = eEventType;
@@ -9148,10 +8739,9 @@ bool USFXOnlineComponentCoordinator::IsEventPending ( unsigned char eEventType,
 
 class USFXOnlineEvent* USFXOnlineComponentCoordinator::GetEvent ( unsigned char eEventType, int nEventID )
 {
-	static UFunction* pFnGetEvent = NULL;
-
+	UFunction* pFnGetEvent = (UFunction*) SdkBindings::Get ( 3610 );
 	if ( ! pFnGetEvent )
-		pFnGetEvent = (UFunction*) UObject::GObjObjects()->Data[ 37976 ];
+		return {};
 
 	USFXOnlineComponentCoordinator_execGetEvent_Parms GetEvent_Parms;
 	GetEvent_Parms.eEventType = eEventType;
@@ -9173,10 +8763,9 @@ class USFXOnlineEvent* USFXOnlineComponentCoordinator::GetEvent ( unsigned char
 
 void USFXOnlineComponentCoordinator::UnsubscribeFromAllEvents ( class UObject* oCallbackTarget )
 {
-	static UFunction* pFnUnsubscribeFromAllEvents = NULL;
-
+	UFunction* pFnUnsubscribeFromAllEvents = (UFunction*) SdkBindings::Get ( 3609 );
 	if ( ! pFnUnsubscribeFromAllEvents )
-		pFnUnsubscribeFromAllEvents = (UFunction*) UObject::GObjObjects()->Data[ 37974 ];
+		return;
 
 	USFXOnlineComponentCoordinator_execUnsubscribeFromAllEvents_Parms UnsubscribeFromAllEvents_Parms;
 	UnsubscribeFromAllEvents_Parms.oCallbackTarget = oCallbackTarget;
@@ -9196,10 +8785,9 @@ void USFXOnlineComponentCoordinator::UnsubscribeFromAllEvents ( class UObject* o
 
 void USFXOnlineComponentCoordinator::UnsubscribeFromEvent ( unsigned char eEventType, struct FScriptDelegate fnEventCallback )
 {
-	static UFunction* pFnUnsubscribeFromEvent = NULL;
-
+	UFunction* pFnUnsubscribeFromEvent = (UFunction*) SdkBindings::Get ( 3608 );
 	if ( ! pFnUnsubscribeFromEvent )
-		pFnUnsubscribeFromEvent = (UFunction*) UObject::GObjObjects()->Data[ 37971 ];
+		return;
 
 	USFXOnlineComponentCoordinator_execUnsubscribeFromEvent_Parms UnsubscribeFromEvent_Parms;
 	UnsubscribeFromEvent_Parms.eEventType = eEventType;
@@ -9220,10 +8808,9 @@ void USFXOnlineComponentCoordinator::UnsubscribeFromEvent ( unsigned char eEvent
 
 void USFXOnlineComponentCoordinator::SubscribeToEvent ( unsigned char eEventType, struct FScriptDelegate fnEventCallback )
 {
-	static UFunction* pFnSubscribeToEvent = NULL;
-
+	UFunction* pFnSubscribeToEvent = (UFunction*) SdkBindings::Get ( 3607 );
 	if ( ! pFnSubscribeToEvent )
-		pFnSubscribeToEvent = (UFunction*) UObject::GObjObjects()->Data[ 37968 ];
+		return;
 
 	USFXOnlineComponentCoordinator_execSubscribeToEvent_Parms SubscribeToEvent_Parms;
 	SubscribeToEvent_Parms.eEventType = eEventType;
@@ -9244,10 +8831,9 @@ void USFXOnlineComponentCoordinator::SubscribeToEvent ( unsigned char eEventType
 
 void USFXOnlineComponentCoordinator::NotifyWorkFinishedObject ( class USFXOnlineEvent* oEvent, unsigned char eStatusFinished )
 {
-	static UFunction* pFnNotifyWorkFinishedObject = NULL;
-
+	UFunction* pFnNotifyWorkFinishedObject = (UFunction*) SdkBindings::Get ( 3606 );
 	if ( ! pFnNotifyWorkFinishedObject )
-		pFnNotifyWorkFinishedObject = (UFunction*) UObject::GObjObjects()->Data[ 37965 ];
+		return;
 
 	USFXOnlineComponentCoordinator_execNotifyWorkFinishedObject_Parms NotifyWorkFinishedObject_Parms;
 	NotifyWorkFinishedObject_Parms.oEvent = oEvent;
@@ -9269,10 +8855,9 @@ void USFXOnlineComponentCoordinator::NotifyWorkFinishedObject ( class USFXOnline
 
 void USFXOnlineComponentCoordinator::NotifyWorkFinishedType ( unsigned char eEventType, unsigned char eStatusFinished, int nEventID )
 {
-	static UFunction* pFnNotifyWorkFinishedType = NULL;
-
+	UFunction* pFnNotifyWorkFinishedType = (UFunction*) SdkBindings::Get ( 3605 );
 	if ( ! pFnNotifyWorkFinishedType )
-		pFnNotifyWorkFinishedType = (UFunction*) UObject::GObjObjects()->Data[ 37961 ];
+		return;
 
 	USFXOnlineComponentCoordinator_execNotifyWorkFinishedType_Parms NotifyWorkFinishedType_Parms;
 	NotifyWorkFinishedType_Parms.eEventType = eEventType;
@@ -9296,10 +8881,9 @@ void USFXOnlineComponentCoordinator::NotifyWorkFinishedType ( unsigned char eEve
 
 void USFXOnlineComponentCoordinator::NotifyWorkStartedObject ( class USFXOnlineEvent* oEvent, unsigned char eEventType, int EventId, float TimeOut )
 {
-	static UFunction* pFnNotifyWorkStartedObject = NULL;
-
+	UFunction* pFnNotifyWorkStartedObject = (UFunction*) SdkBindings::Get ( 3604 );
 	if ( ! pFnNotifyWorkStartedObject )
-		pFnNotifyWorkStartedObject = (UFunction*) UObject::GObjObjects()->Data[ 37956 ];
+		return;
 
 	USFXOnlineComponentCoordinator_execNotifyWorkStartedObject_Parms NotifyWorkStartedObject_Parms;
 	NotifyWorkStartedObject_Parms.oEvent = oEvent;
@@ -9323,10 +8907,9 @@ void USFXOnlineComponentCoordinator::NotifyWorkStartedObject ( class USFXOnlineE
 
 void USFXOnlineComponentCoordinator::NotifyWorkStartedType ( unsigned char eEventType, int nEventID, float fTimeOut )
 {
-	static UFunction* pFnNotifyWorkStartedType = NULL;
-
+	UFunction* pFnNotifyWorkStartedType = (UFunction*) SdkBindings::Get ( 3603 );
 	if ( ! pFnNotifyWorkStartedType )
-		pFnNotifyWorkStartedType = (UFunction*) UObject::GObjObjects()->Data[ 37952 ];
+		return;
 
 	USFXOnlineComponentCoordinator_execNotifyWorkStartedType_Parms NotifyWorkStartedType_Parms;
 	NotifyWorkStartedType_Parms.eEventType = eEventType;
@@ -9347,10 +8930,9 @@ void USFXOnlineComponentCoordinator::NotifyWorkStartedType ( unsigned char eEven
 
 void USFXOnlineComponentCoordinator::NotifyEventObject ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnNotifyEventObject = NULL;
-
+	UFunction* pFnNotifyEventObject = (UFunction*) SdkBindings::Get ( 3602 );
 	if ( ! pFnNotifyEventObject )
-		pFnNotifyEventObject = (UFunction*) UObject::GObjObjects()->Data[ 37950 ];
+		return;
 
 	USFXOnlineComponentCoordinator_execNotifyEventObject_Parms NotifyEventObject_Parms;
 	NotifyEventObject_Parms.oEvent = oEvent;
@@ -9371,10 +8953,9 @@ void USFXOnlineComponentCoordinator::NotifyEventObject ( class USFXOnlineEvent*
 
 void USFXOnlineComponentCoordinator::NotifyEventType ( unsigned char eEventType, unsigned char eStatus, unsigned char eOutcome )
 {
-	static UFunction* pFnNotifyEventType = NULL;
-
+	UFunction* pFnNotifyEventType = (UFunction*) SdkBindings::Get ( 3601 );
 	if ( ! pFnNotifyEventType )
-		pFnNotifyEventType = (UFunction*) UObject::GObjObjects()->Data[ 37946 ];
+		return;
 
 	USFXOnlineComponentCoordinator_execNotifyEventType_Parms NotifyEventType_Parms;
 	NotifyEventType_Parms.eEventType = eEventType;
@@ -9395,10 +8976,9 @@ void USFXOnlineComponentCoordinator::NotifyEventType ( unsigned char eEventType,
 
 void USFXOnlineComponentCoordinator::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
-
+	UFunction* pFnOnTick = (UFunction*) SdkBindings::Get ( 3600 );
 	if ( ! pFnOnTick )
-		pFnOnTick = (UFunction*) UObject::GObjObjects()->Data[ 37944 ];
+		return;
 
 	USFXOnlineComponentCoordinator_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
@@ -9417,10 +8997,9 @@ void USFXOnlineComponentCoordinator::OnTick ( class USFXOnlineEvent* oEvent )
 
 void USFXOnlineComponentCoordinator::OnEvent ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnEvent = NULL;
-
+	UFunction* pFnOnEvent = (UFunction*) SdkBindings::Get ( 3599 );
 	if ( ! pFnOnEvent )
-		pFnOnEvent = (UFunction*) UObject::GObjObjects()->Data[ 37942 ];
+		return;
 
 	USFXOnlineComponentCoordinator_execOnEvent_Parms OnEvent_Parms;
 	OnEvent_Parms.oEvent = oEvent;
@@ -9436,10 +9015,9 @@ void USFXOnlineComponentCoordinator::OnEvent ( class USFXOnlineEvent* oEvent )
 
 void USFXOnlineEventNotifier::NotifyCallbacks ( TArray< struct FScriptDelegate > NotifyArray, class USFXOnlineEvent* Event )
 {
-	static UFunction* pFnNotifyCallbacks = NULL;
-
+	UFunction* pFnNotifyCallbacks = (UFunction*) SdkBindings::Get ( 4183 );
 	if ( ! pFnNotifyCallbacks )
-		pFnNotifyCallbacks = (UFunction*) UObject::GObjObjects()->Data[ 40333 ];
+		return;
 
 	USFXOnlineEventNotifier_execNotifyCallbacks_Parms NotifyCallbacks_Parms;
 	memcpy ( &NotifyCallbacks_Parms.NotifyArray, &NotifyArray, 0xC );
@@ -9459,10 +9037,9 @@ void USFXOnlineEventNotifier::NotifyCallbacks ( TArray< struct FScriptDelegate >
 
 void USFXOnlineEventNotifier::NotifyWaiters ( class USFXOnlineEvent* Event )
 {
-	static UFunction* pFnNotifyWaiters = NULL;
-
+	UFunction* pFnNotifyWaiters = (UFunction*) SdkBindings::Get ( 4182 );
 	if ( ! pFnNotifyWaiters )
-		pFnNotifyWaiters = (UFunction*) UObject::GObjObjects()->Data[ 40331 ];
+		return;
 
 	USFXOnlineEventNotifier_execNotifyWaiters_Parms NotifyWaiters_Parms;
 	NotifyWaiters_Parms.Event = Event;
@@ -9481,10 +9058,9 @@ void USFXOnlineEventNotifier::NotifyWaiters ( class USFXOnlineEvent* Event )
 
 void USFXOnlineEventNotifier::NotifySubscribers ( class USFXOnlineEvent* Event )
 {
-	static UFunction* pFnNotifySubscribers = NULL;
-
+	UFunction* pFnNotifySubscribers = (UFunction*) SdkBindings::Get ( 4181 );
 	if ( ! pFnNotifySubscribers )
-		pFnNotifySubscribers = (UFunction*) UObject::GObjObjects()->Data[ 40329 ];
+		return;
 
 	USFXOnlineEventNotifier_execNotifySubscribers_Parms NotifySubscribers_Parms;
 	NotifySubscribers_Parms.Event = Event;
@@ -9503,10 +9079,9 @@ void USFXOnlineEventNotifier::NotifySubscribers ( class USFXOnlineEvent* Event )
 
 void USFXOnlineEventNotifier::RemoveAllWaiters ( class UObject* CallbackTarget )
 {
-	static UFunction* pFnRemoveAllWaiters = NULL;
-
+	UFunction* pFnRemoveAllWaiters = (UFunction*) SdkBindings::Get ( 4180 );
 	if ( ! pFnRemoveAllWaiters )
-		pFnRemoveAllWaiters = (UFunction*) UObject::GObjObjects()->Data[ 40327 ];
+		return;
 
 	USFXOnlineEventNotifier_execRemoveAllWaiters_Parms RemoveAllWaiters_Parms;
 	RemoveAllWaiters_Parms.CallbackTarget = CallbackTarget;
@@ -9526,10 +9101,9 @@ void USFXOnlineEventNotifier::RemoveAllWaiters ( class UObject* CallbackTarget )
 
 void USFXOnlineEventNotifier::AddWaiter ( unsigned char EventType, struct FScriptDelegate EventCallback )
 {
-	static UFunction* pFnAddWaiter = NULL;
-
+	UFunction* pFnAddWaiter = (UFunction*) SdkBindings::Get ( 4179 );
 	if ( ! pFnAddWaiter )
-		pFnAddWaiter = (UFunction*) UObject::GObjObjects()->Data[ 40324 ];
+		return;
 
 	USFXOnlineEventNotifier_execAddWaiter_Parms AddWaiter_Parms;
 	AddWaiter_Parms.EventType = EventType;
@@ -9549,10 +9123,9 @@ void USFXOnlineEventNotifier::AddWaiter ( unsigned char EventType, struct FScrip
 
 void USFXOnlineEventNotifier::RemoveAllSubscribers ( class UObject* CallbackTarget )
 {
-	static UFunction* pFnRemoveAllSubscribers = NULL;
-
+	UFunction* pFnRemoveAllSubscribers = (UFunction*) SdkBindings::Get ( 4178 );
 	if ( ! pFnRemoveAllSubscribers )
-		pFnRemoveAllSubscribers = (UFunction*) UObject::GObjObjects()->Data[ 40322 ];
+		return;
 
 	USFXOnlineEventNotifier_execRemoveAllSubscribers_Parms RemoveAllSubscribers_Parms;
 	RemoveAllSubscribers_Parms.CallbackTarget = CallbackTarget;
@@ -9573,10 +9146,9 @@ void USFXOnlineEventNotifier::RemoveAllSubscribers ( class UObject* CallbackTarg
 
 void USFXOnlineEventNotifier::RemoveSubscriber ( unsigned char EventType, struct FScriptDelegate EventCallback, int RemoveIndex )
 {
-	static UFunction* pFnRemoveSubscriber = NULL;
-
+	UFunction* pFnRemoveSubscriber = (UFunction*) SdkBindings::Get ( 4177 );
 	if ( ! pFnRemoveSubscriber )
-		pFnRemoveSubscriber = (UFunction*) UObject::GObjObjects()->Data[ 40318 ];
+		return;
 
 	USFXOnlineEventNotifier_execRemoveSubscriber_Parms RemoveSubscriber_Parms;
 	RemoveSubscriber_Parms.EventType = EventType;
@@ -9598,10 +9170,9 @@ void USFXOnlineEventNotifier::RemoveSubscriber ( unsigned char EventType, struct
 
 void USFXOnlineEventNotifier::AddSubscriber ( unsigned char EventType, struct FScriptDelegate EventCallback )
 {
-	static UFunction* pFnAddSubscriber = NULL;
-
+	UFunction* pFnAddSubscriber = (UFunction*) SdkBindings::Get ( 4176 );
 	if ( ! pFnAddSubscriber )
-		pFnAddSubscriber = (UFunction*) UObject::GObjObjects()->Data[ 40315 ];
+		return;
 
 	USFXOnlineEventNotifier_execAddSubscriber_Parms AddSubscriber_Parms;
 	AddSubscriber_Parms.EventType = EventType;
@@ -9623,10 +9194,9 @@ void USFXOnlineEventNotifier::AddSubscriber ( unsigned char EventType, struct FS
 
 bool USFXOnlineEventNotifier::IsSubscribed ( unsigned char EventType, struct FScriptDelegate EventCallback )
 {
-	static UFunction* pFnIsSubscribed = NULL;
-
+	UFunction* pFnIsSubscribed = (UFunction*) SdkBindings::Get ( 4175 );
 	if ( ! pFnIsSubscribed )
-		pFnIsSubscribed = (UFunction*) UObject::GObjObjects()->Data[ 40311 ];
+		return {};
 
 	USFXOnlineEventNotifier_execIsSubscribed_Parms IsSubscribed_Parms;
 	IsSubscribed_Parms.EventType = EventType;
@@ -9648,10 +9218,9 @@ bool USFXOnlineEventNotifier::IsSubscribed ( unsigned char EventType, struct FSc
 
 void USFXOnlineEventNotifier::OnEvent ( class USFXOnlineEvent* Event )
 {
-	static UFunction* pFnOnEvent = NULL;
-
+	UFunction* pFnOnEvent = (UFunction*) SdkBindings::Get ( 4174 );
 	if ( ! pFnOnEvent )
-		pFnOnEvent = (UFunction*) UObject::GObjObjects()->Data[ 40305 ];
+		return;
 
 	USFXOnlineEventNotifier_execOnEvent_Parms OnEvent_Parms;
 	OnEvent_Parms.Event = Event;
@@ -9666,10 +9235,9 @@ void USFXOnlineEventNotifier::OnEvent ( class USFXOnlineEvent* Event )
 
 struct FString USFXOnlineHTTPRequest::eventGenerateParametersString ( )
 {
-	static UFunction* pFnGenerateParametersString = NULL;
-
+	UFunction* pFnGenerateParametersString = (UFunction*) SdkBindings::Get ( 4205 );
 	if ( ! pFnGenerateParametersString )
-		pFnGenerateParametersString = (UFunction*) UObject::GObjObjects()->Data[ 40475 ];
+		return {};
 
 	USFXOnlineHTTPRequest_eventGenerateParametersString_Parms GenerateParametersString_Parms;
 
@@ -9685,10 +9253,9 @@ struct FString USFXOnlineHTTPRequest::eventGenerateParametersString ( )
 
 struct FString USFXOnlineHTTPRequest::eventGenerateHeaderParametersString ( )
 {
-	static UFunction* pFnGenerateHeaderParametersString = NULL;
-
+	UFunction* pFnGenerateHeaderParametersString = (UFunction*) SdkBindings::Get ( 4204 );
 	if ( ! pFnGenerateHeaderParametersString )
-		pFnGenerateHeaderParametersString = (UFunction*) UObject::GObjObjects()->Data[ 40471 ];
+		return {};
 
 	USFXOnlineHTTPRequest_eventGenerateHeaderParametersString_Parms GenerateHeaderParametersString_Parms;
 
@@ -9703,10 +9270,9 @@ struct FString USFXOnlineHTTPRequest::eventGenerateHeaderParametersString ( )
 
 void USFXOnlineHTTPRequest::eventFillDefaultParameters ( )
 {
-	static UFunction* pFnFillDefaultParameters = NULL;
-
+	UFunction* pFnFillDefaultParameters = (UFunction*) SdkBindings::Get ( 4203 );
 	if ( ! pFnFillDefaultParameters )
-		pFnFillDefaultParameters = (UFunction*) UObject::GObjObjects()->Data[ 40470 ];
+		return;
 
 	USFXOnlineHTTPRequest_eventFillDefaultParameters_Parms FillDefaultParameters_Parms;
 
@@ -9719,10 +9285,9 @@ void USFXOnlineHTTPRequest::eventFillDefaultParameters ( )
 
 void USFXOnlineHTTPRequest::eventReset ( )
 {
-	static UFunction* pFnReset = NULL;
-
+	UFunction* pFnReset = (UFunction*) SdkBindings::Get ( 4202 );
 	if ( ! pFnReset )
-		pFnReset = (UFunction*) UObject::GObjObjects()->Data[ 40466 ];
+		return;
 
 	USFXOnlineHTTPRequest_eventReset_Parms Reset_Parms;
 
@@ -9735,10 +9300,9 @@ void USFXOnlineHTTPRequest::eventReset ( )
 
 void USFXOnlineHTTPRequest::eventClearParams ( )
 {
-	static UFunction* pFnClearParams = NULL;
-
+	UFunction* pFnClearParams = (UFunction*) SdkBindings::Get ( 4201 );
 	if ( ! pFnClearParams )
-		pFnClearParams = (UFunction*) UObject::GObjObjects()->Data[ 40465 ];
+		return;
 
 	USFXOnlineHTTPRequest_eventClearParams_Parms ClearParams_Parms;
 
@@ -9752,10 +9316,9 @@ void USFXOnlineHTTPRequest::eventClearParams ( )
 
 void USFXOnlineHTTPRequest::eventAddSubURL ( struct FString subUrl )
 {
-	static UFunction* pFnAddSubURL = NULL;
-
+	UFunction* pFnAddSubURL = (UFunction*) SdkBindings::Get ( 4200 );
 	if ( ! pFnAddSubURL )
-		pFnAddSubURL = (UFunction*) UObject::GObjObjects()->Data[ 40463 ];
+		return;
 
 	USFXOnlineHTTPRequest_eventAddSubURL_Parms AddSubURL_Parms;
 	memcpy ( &AddSubURL_Parms.subUrl, &subUrl, 0xC );
@@ -9770,10 +9333,9 @@ void USFXOnlineHTTPRequest::eventAddSubURL ( struct FString subUrl )
 
 void USFXOnlineHTTPRequest::eventSetBaseURL ( struct FString URL )
 {
-	static UFunction* pFnSetBaseURL = NULL;
-
+	UFunction* pFnSetBaseURL = (UFunction*) SdkBindings::Get ( 4199 );
 	if ( ! pFnSetBaseURL )
-		pFnSetBaseURL = (UFunction*) UObject::GObjObjects()->Data[ 40461 ];
+		return;
 
 	USFXOnlineHTTPRequest_eventSetBaseURL_Parms SetBaseURL_Parms;
 	memcpy ( &SetBaseURL_Parms.URL, &URL, 0xC );
@@ -9788,10 +9350,9 @@ void USFXOnlineHTTPRequest::eventSetBaseURL ( struct FString URL )
 
 void USFXOnlineHTTPRequest::SetPost ( unsigned long post )
 {
-	static UFunction* pFnSetPost = NULL;
-
+	UFunction* pFnSetPost = (UFunction*) SdkBindings::Get ( 4198 );
 	if ( ! pFnSetPost )
-		pFnSetPost = (UFunction*) UObject::GObjObjects()->Data[ 40458 ];
+		return;
 
 	USFXOnlineHTTPRequest_execSetPost_Parms SetPost_Parms;
 	SetPost_Parms.post = post;
@@ -9807,10 +9368,9 @@ void USFXOnlineHTTPRequest::SetPost ( unsigned long post )
 
 void USFXOnlineHTTPRequest::AddHeaderParameter ( struct FString Key, struct FString Value )
 {
-	static UFunction* pFnAddHeaderParameter = NULL;
-
+	UFunction* pFnAddHeaderParameter = (UFunction*) SdkBindings::Get ( 4197 );
 	if ( ! pFnAddHeaderParameter )
-		pFnAddHeaderParameter = (UFunction*) UObject::GObjObjects()->Data[ 40454 ];
+		return;
 
 	USFXOnlineHTTPRequest_execAddHeaderParameter_Parms AddHeaderParameter_Parms;
 	memcpy ( &AddHeaderParameter_Parms.Key, &Key, 0xC );
@@ -9827,10 +9387,9 @@ void USFXOnlineHTTPRequest::AddHeaderParameter ( struct FString Key, struct FStr
 
 void USFXOnlineHTTPRequest::eventAddParameter ( struct FString Key, struct FString Value )
 {
-	static UFunction* pFnAddParameter = NULL;
-
+	UFunction* pFnAddParameter = (UFunction*) SdkBindings::Get ( 4196 );
 	if ( ! pFnAddParameter )
-		pFnAddParameter = (UFunction*) UObject::GObjObjects()->Data[ 40450 ];
+		return;
 
 	USFXOnlineHTTPRequest_eventAddParameter_Parms AddParameter_Parms;
 	memcpy ( &AddParameter_Parms.Key, &Key, 0xC );
@@ -9847,10 +9406,9 @@ void USFXOnlineHTTPRequest::eventAddParameter ( struct FString Key, struct FStri
 
 struct FString USFXOnlineHTTPRequest::AddHeaderTerminator ( struct FString InputString )
 {
-	static UFunction* pFnAddHeaderTerminator = NULL;
-
+	UFunction* pFnAddHeaderTerminator = (UFunction*) SdkBindings::Get ( 4195 );
 	if ( ! pFnAddHeaderTerminator )
-		pFnAddHeaderTerminator = (UFunction*) UObject::GObjObjects()->Data[ 40447 ];
+		return {};
 
 	USFXOnlineHTTPRequest_execAddHeaderTerminator_Parms AddHeaderTerminator_Parms;
 	memcpy ( &AddHeaderTerminator_Parms.InputString, &InputString, 0xC );
@@ -9872,10 +9430,9 @@ struct FString USFXOnlineHTTPRequest::AddHeaderTerminator ( struct FString Input
 
 struct FString USFXOnlineHTTPRequest::URLEncodeString ( struct FString InputString )
 {
-	static UFunction* pFnURLEncodeString = NULL;
-
+	UFunction* pFnURLEncodeString = (UFunction*) SdkBindings::Get ( 4194 );
 	if ( ! pFnURLEncodeString )
-		pFnURLEncodeString = (UFunction*) UObject::GObjObjects()->Data[ 40444 ];
+		return {};
 
 	USFXOnlineHTTPRequest_execURLEncodeString_Parms URLEncodeString_Parms;
 	memcpy ( &URLEncodeString_Parms.InputString, &InputString, 0xC );
@@ -9896,10 +9453,9 @@ struct FString USFXOnlineHTTPRequest::URLEncodeString ( struct FString InputStri
 
 unsigned char USFXOnlineSubsystem::GetEnvironment ( )
 {
-	static UFunction* pFnGetEnvironment = NULL;
-
+	UFunction* pFnGetEnvironment = (UFunction*) SdkBindings::Get ( 4327 );
 	if ( ! pFnGetEnvironment )
-		pFnGetEnvironment = (UFunction*) UObject::GObjObjects()->Data[ 40941 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetEnvironment_Parms GetEnvironment_Parms;
 
@@ -9918,10 +9474,9 @@ unsigned char USFXOnlineSubsystem::GetEnvironment ( )
 
 void USFXOnlineSubsystem::eventExit ( )
 {
-	static UFunction* pFnExit = NULL;
-
+	UFunction* pFnExit = (UFunction*) SdkBindings::Get ( 4326 );
 	if ( ! pFnExit )
-		pFnExit = (UFunction*) UObject::GObjObjects()->Data[ 40940 ];
+		return;
 
 	USFXOnlineSubsystem_eventExit_Parms Exit_Parms;
 
@@ -9946,10 +9501,9 @@ void USFXOnlineSubsystem::eventExit ( )
 
 bool USFXOnlineSubsystem::ShowConsoleRoutedKeyboardUI ( unsigned char eLocalUserNum, struct FString sTitleText, struct FString sDescriptionText, unsigned long bIsPassword, unsigned long bShouldValidate, struct FString sDefaultText, int nMaxResultLength )
 {
-	static UFunction* pFnShowConsoleRoutedKeyboardUI = NULL;
-
+	UFunction* pFnShowConsoleRoutedKeyboardUI = (UFunction*) SdkBindings::Get ( 4325 );
 	if ( ! pFnShowConsoleRoutedKeyboardUI )
-		pFnShowConsoleRoutedKeyboardUI = (UFunction*) UObject::GObjObjects()->Data[ 40931 ];
+		return {};
 
 	USFXOnlineSubsystem_execShowConsoleRoutedKeyboardUI_Parms ShowConsoleRoutedKeyboardUI_Parms;
 	ShowConsoleRoutedKeyboardUI_Parms.eLocalUserNum = eLocalUserNum;
@@ -9979,10 +9533,9 @@ bool USFXOnlineSubsystem::ShowConsoleRoutedKeyboardUI ( unsigned char eLocalUser
 
 bool USFXOnlineSubsystem::ShowKeyboardUI ( unsigned char eLocalUserNum, struct FString sTitleText, struct FString sDescriptionText, unsigned long bIsPassword, unsigned long bShouldValidate, struct FString sDefaultText, int nMaxResultLength )
 {
-	static UFunction* pFnShowKeyboardUI = NULL;
-
+	UFunction* pFnShowKeyboardUI = (UFunction*) SdkBindings::Get ( 4324 );
 	if ( ! pFnShowKeyboardUI )
-		pFnShowKeyboardUI = (UFunction*) UObject::GObjObjects()->Data[ 40922 ];
+		return {};
 
 	USFXOnlineSubsystem_execShowKeyboardUI_Parms ShowKeyboardUI_Parms;
 	ShowKeyboardUI_Parms.eLocalUserNum = eLocalUserNum;
@@ -10005,10 +9558,9 @@ bool USFXOnlineSubsystem::ShowKeyboardUI ( unsigned char eLocalUserNum, struct F
 
 int USFXOnlineSubsystem::GetBioDynamicBuildVersion ( )
 {
-	static UFunction* pFnGetBioDynamicBuildVersion = NULL;
-
+	UFunction* pFnGetBioDynamicBuildVersion = (UFunction*) SdkBindings::Get ( 4323 );
 	if ( ! pFnGetBioDynamicBuildVersion )
-		pFnGetBioDynamicBuildVersion = (UFunction*) UObject::GObjObjects()->Data[ 40920 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetBioDynamicBuildVersion_Parms GetBioDynamicBuildVersion_Parms;
 
@@ -10028,10 +9580,9 @@ int USFXOnlineSubsystem::GetBioDynamicBuildVersion ( )
 
 bool USFXOnlineSubsystem::IsCerberusMember ( )
 {
-	static UFunction* pFnIsCerberusMember = NULL;
-
+	UFunction* pFnIsCerberusMember = (UFunction*) SdkBindings::Get ( 4322 );
 	if ( ! pFnIsCerberusMember )
-		pFnIsCerberusMember = (UFunction*) UObject::GObjObjects()->Data[ 40918 ];
+		return {};
 
 	USFXOnlineSubsystem_execIsCerberusMember_Parms IsCerberusMember_Parms;
 
@@ -10047,10 +9598,9 @@ bool USFXOnlineSubsystem::IsCerberusMember ( )
 
 struct FString USFXOnlineSubsystem::GetProjectID ( )
 {
-	static UFunction* pFnGetProjectID = NULL;
-
+	UFunction* pFnGetProjectID = (UFunction*) SdkBindings::Get ( 4321 );
 	if ( ! pFnGetProjectID )
-		pFnGetProjectID = (UFunction*) UObject::GObjObjects()->Data[ 40916 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetProjectID_Parms GetProjectID_Parms;
 
@@ -10070,10 +9620,9 @@ struct FString USFXOnlineSubsystem::GetProjectID ( )
 
 struct FString USFXOnlineSubsystem::GetCDKey ( )
 {
-	static UFunction* pFnGetCDKey = NULL;
-
+	UFunction* pFnGetCDKey = (UFunction*) SdkBindings::Get ( 4320 );
 	if ( ! pFnGetCDKey )
-		pFnGetCDKey = (UFunction*) UObject::GObjObjects()->Data[ 40914 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetCDKey_Parms GetCDKey_Parms;
 
@@ -10093,10 +9642,9 @@ struct FString USFXOnlineSubsystem::GetCDKey ( )
 
 struct FString USFXOnlineSubsystem::GetLanguage ( )
 {
-	static UFunction* pFnGetLanguage = NULL;
-
+	UFunction* pFnGetLanguage = (UFunction*) SdkBindings::Get ( 4319 );
 	if ( ! pFnGetLanguage )
-		pFnGetLanguage = (UFunction*) UObject::GObjObjects()->Data[ 40912 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetLanguage_Parms GetLanguage_Parms;
 
@@ -10116,10 +9664,9 @@ struct FString USFXOnlineSubsystem::GetLanguage ( )
 
 struct FName USFXOnlineSubsystem::GetPlatform ( )
 {
-	static UFunction* pFnGetPlatform = NULL;
-
+	UFunction* pFnGetPlatform = (UFunction*) SdkBindings::Get ( 4318 );
 	if ( ! pFnGetPlatform )
-		pFnGetPlatform = (UFunction*) UObject::GObjObjects()->Data[ 40910 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetPlatform_Parms GetPlatform_Parms;
 
@@ -10138,10 +9685,9 @@ struct FName USFXOnlineSubsystem::GetPlatform ( )
 
 void USFXOnlineSubsystem::eventShutDown ( )
 {
-	static UFunction* pFnShutDown = NULL;
-
+	UFunction* pFnShutDown = (UFunction*) SdkBindings::Get ( 4317 );
 	if ( ! pFnShutDown )
-		pFnShutDown = (UFunction*) UObject::GObjObjects()->Data[ 40909 ];
+		return;
 
 	USFXOnlineSubsystem_eventShutDown_Parms ShutDown_Parms;
 
@@ -10159,10 +9705,9 @@ void USFXOnlineSubsystem::eventShutDown ( )
 
 bool USFXOnlineSubsystem::NativeInit ( )
 {
-	static UFunction* pFnNativeInit = NULL;
-
+	UFunction* pFnNativeInit = (UFunction*) SdkBindings::Get ( 4316 );
 	if ( ! pFnNativeInit )
-		pFnNativeInit = (UFunction*) UObject::GObjObjects()->Data[ 40907 ];
+		return {};
 
 	USFXOnlineSubsystem_execNativeInit_Parms NativeInit_Parms;
 
@@ -10183,10 +9728,9 @@ bool USFXOnlineSubsystem::NativeInit ( )
 
 void USFXOnlineSubsystem::NativeInitOnlineComponent ( int componentIdx, struct FString componentClassName )
 {
-	static UFunction* pFnNativeInitOnlineComponent = NULL;
-
+	UFunction* pFnNativeInitOnlineComponent = (UFunction*) SdkBindings::Get ( 4315 );
 	if ( ! pFnNativeInitOnlineComponent )
-		pFnNativeInitOnlineComponent = (UFunction*) UObject::GObjObjects()->Data[ 40904 ];
+		return;
 
 	USFXOnlineSubsystem_execNativeInitOnlineComponent_Parms NativeInitOnlineComponent_Parms;
 	NativeInitOnlineComponent_Parms.componentIdx = componentIdx;
@@ -10206,10 +9750,9 @@ void USFXOnlineSubsystem::NativeInitOnlineComponent ( int componentIdx, struct F
 
 struct FString USFXOnlineSubsystem::GetGameProtocolVersion ( )
 {
-	static UFunction* pFnGetGameProtocolVersion = NULL;
-
+	UFunction* pFnGetGameProtocolVersion = (UFunction*) SdkBindings::Get ( 4314 );
 	if ( ! pFnGetGameProtocolVersion )
-		pFnGetGameProtocolVersion = (UFunction*) UObject::GObjObjects()->Data[ 40902 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetGameProtocolVersion_Parms GetGameProtocolVersion_Parms;
 
@@ -10229,10 +9772,9 @@ struct FString USFXOnlineSubsystem::GetGameProtocolVersion ( )
 
 class USFXOnlineComponentAvatarAwardXenon* USFXOnlineSubsystem::GetComponentAvatarAwardXenon ( )
 {
-	static UFunction* pFnGetComponentAvatarAwardXenon = NULL;
-
+	UFunction* pFnGetComponentAvatarAwardXenon = (UFunction*) SdkBindings::Get ( 4313 );
 	if ( ! pFnGetComponentAvatarAwardXenon )
-		pFnGetComponentAvatarAwardXenon = (UFunction*) UObject::GObjObjects()->Data[ 40900 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentAvatarAwardXenon_Parms GetComponentAvatarAwardXenon_Parms;
 
@@ -10252,10 +9794,9 @@ class USFXOnlineComponentAvatarAwardXenon* USFXOnlineSubsystem::GetComponentAvat
 
 class USFXOnlineComponentImageManager* USFXOnlineSubsystem::GetComponentImageManager ( )
 {
-	static UFunction* pFnGetComponentImageManager = NULL;
-
+	UFunction* pFnGetComponentImageManager = (UFunction*) SdkBindings::Get ( 4267 );
 	if ( ! pFnGetComponentImageManager )
-		pFnGetComponentImageManager = (UFunction*) UObject::GObjObjects()->Data[ 40739 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentImageManager_Parms GetComponentImageManager_Parms;
 
@@ -10275,10 +9816,9 @@ class USFXOnlineComponentImageManager* USFXOnlineSubsystem::GetComponentImageMan
 
 class USFXOnlineComponentXMLParser* USFXOnlineSubsystem::GetComponentXMLParser ( )
 {
-	static UFunction* pFnGetComponentXMLParser = NULL;
-
+	UFunction* pFnGetComponentXMLParser = (UFunction*) SdkBindings::Get ( 3659 );
 	if ( ! pFnGetComponentXMLParser )
-		pFnGetComponentXMLParser = (UFunction*) UObject::GObjObjects()->Data[ 38167 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentXMLParser_Parms GetComponentXMLParser_Parms;
 
@@ -10298,10 +9838,9 @@ class USFXOnlineComponentXMLParser* USFXOnlineSubsystem::GetComponentXMLParser (
 
 class USFXOnlineComponentHTTPManager* USFXOnlineSubsystem::GetComponentHTTPManager ( )
 {
-	static UFunction* pFnGetComponentHTTPManager = NULL;
-
+	UFunction* pFnGetComponentHTTPManager = (UFunction*) SdkBindings::Get ( 4219 );
 	if ( ! pFnGetComponentHTTPManager )
-		pFnGetComponentHTTPManager = (UFunction*) UObject::GObjObjects()->Data[ 40512 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentHTTPManager_Parms GetComponentHTTPManager_Parms;
 
@@ -10321,10 +9860,9 @@ class USFXOnlineComponentHTTPManager* USFXOnlineSubsystem::GetComponentHTTPManag
 
 class USFXOnlineComponentXenonLiveParty* USFXOnlineSubsystem::GetComponentXenonLiveParty ( )
 {
-	static UFunction* pFnGetComponentXenonLiveParty = NULL;
-
+	UFunction* pFnGetComponentXenonLiveParty = (UFunction*) SdkBindings::Get ( 4299 );
 	if ( ! pFnGetComponentXenonLiveParty )
-		pFnGetComponentXenonLiveParty = (UFunction*) UObject::GObjObjects()->Data[ 40866 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentXenonLiveParty_Parms GetComponentXenonLiveParty_Parms;
 
@@ -10344,10 +9882,9 @@ class USFXOnlineComponentXenonLiveParty* USFXOnlineSubsystem::GetComponentXenonL
 
 class USFXOnlineComponentJobQueue* USFXOnlineSubsystem::GetComponentJobQueue ( )
 {
-	static UFunction* pFnGetComponentJobQueue = NULL;
-
+	UFunction* pFnGetComponentJobQueue = (UFunction*) SdkBindings::Get ( 3742 );
 	if ( ! pFnGetComponentJobQueue )
-		pFnGetComponentJobQueue = (UFunction*) UObject::GObjObjects()->Data[ 38668 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentJobQueue_Parms GetComponentJobQueue_Parms;
 
@@ -10367,10 +9904,9 @@ class USFXOnlineComponentJobQueue* USFXOnlineSubsystem::GetComponentJobQueue ( )
 
 class USFXOnlineComponentOrigin* USFXOnlineSubsystem::GetComponentOrigin ( )
 {
-	static UFunction* pFnGetComponentOrigin = NULL;
-
+	UFunction* pFnGetComponentOrigin = (UFunction*) SdkBindings::Get ( 4312 );
 	if ( ! pFnGetComponentOrigin )
-		pFnGetComponentOrigin = (UFunction*) UObject::GObjObjects()->Data[ 40897 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentOrigin_Parms GetComponentOrigin_Parms;
 
@@ -10390,10 +9926,9 @@ class USFXOnlineComponentOrigin* USFXOnlineSubsystem::GetComponentOrigin ( )
 
 class USFXOnlineComponentVoiceInterface* USFXOnlineSubsystem::GetComponentVoiceInterface ( )
 {
-	static UFunction* pFnGetComponentVoiceInterface = NULL;
-
+	UFunction* pFnGetComponentVoiceInterface = (UFunction*) SdkBindings::Get ( 4298 );
 	if ( ! pFnGetComponentVoiceInterface )
-		pFnGetComponentVoiceInterface = (UFunction*) UObject::GObjObjects()->Data[ 40865 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentVoiceInterface_Parms GetComponentVoiceInterface_Parms;
 
@@ -10413,10 +9948,9 @@ class USFXOnlineComponentVoiceInterface* USFXOnlineSubsystem::GetComponentVoiceI
 
 class USFXOnlineComponentUnrealPlayerEx* USFXOnlineSubsystem::GetComponentUnrealPlayerEx ( )
 {
-	static UFunction* pFnGetComponentUnrealPlayerEx = NULL;
-
+	UFunction* pFnGetComponentUnrealPlayerEx = (UFunction*) SdkBindings::Get ( 4296 );
 	if ( ! pFnGetComponentUnrealPlayerEx )
-		pFnGetComponentUnrealPlayerEx = (UFunction*) UObject::GObjObjects()->Data[ 40863 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentUnrealPlayerEx_Parms GetComponentUnrealPlayerEx_Parms;
 
@@ -10436,10 +9970,9 @@ class USFXOnlineComponentUnrealPlayerEx* USFXOnlineSubsystem::GetComponentUnreal
 
 class USFXOnlineComponentUnrealPlayer* USFXOnlineSubsystem::GetComponentUnrealPlayer ( )
 {
-	static UFunction* pFnGetComponentUnrealPlayer = NULL;
-
+	UFunction* pFnGetComponentUnrealPlayer = (UFunction*) SdkBindings::Get ( 3377 );
 	if ( ! pFnGetComponentUnrealPlayer )
-		pFnGetComponentUnrealPlayer = (UFunction*) UObject::GObjObjects()->Data[ 37247 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentUnrealPlayer_Parms GetComponentUnrealPlayer_Parms;
 
@@ -10459,10 +9992,9 @@ class USFXOnlineComponentUnrealPlayer* USFXOnlineSubsystem::GetComponentUnrealPl
 
 class USFXOnlineComponentUnrealSystem* USFXOnlineSubsystem::GetComponentUnrealSystem ( )
 {
-	static UFunction* pFnGetComponentUnrealSystem = NULL;
-
+	UFunction* pFnGetComponentUnrealSystem = (UFunction*) SdkBindings::Get ( 4297 );
 	if ( ! pFnGetComponentUnrealSystem )
-		pFnGetComponentUnrealSystem = (UFunction*) UObject::GObjObjects()->Data[ 40864 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentUnrealSystem_Parms GetComponentUnrealSystem_Parms;
 
@@ -10482,10 +10014,9 @@ class USFXOnlineComponentUnrealSystem* USFXOnlineSubsystem::GetComponentUnrealSy
 
 class USFXOnlineComponentCoordinator* USFXOnlineSubsystem::GetCoordinator ( )
 {
-	static UFunction* pFnGetCoordinator = NULL;
-
+	UFunction* pFnGetCoordinator = (UFunction*) SdkBindings::Get ( 4311 );
 	if ( ! pFnGetCoordinator )
-		pFnGetCoordinator = (UFunction*) UObject::GObjObjects()->Data[ 40892 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetCoordinator_Parms GetCoordinator_Parms;
 
@@ -10505,10 +10036,9 @@ class USFXOnlineComponentCoordinator* USFXOnlineSubsystem::GetCoordinator ( )
 
 class UISFXOnlineComponentCommerce* USFXOnlineSubsystem::GetComponentCommerce ( )
 {
-	static UFunction* pFnGetComponentCommerce = NULL;
-
+	UFunction* pFnGetComponentCommerce = (UFunction*) SdkBindings::Get ( 4310 );
 	if ( ! pFnGetComponentCommerce )
-		pFnGetComponentCommerce = (UFunction*) UObject::GObjObjects()->Data[ 40890 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentCommerce_Parms GetComponentCommerce_Parms;
 
@@ -10528,10 +10058,9 @@ class UISFXOnlineComponentCommerce* USFXOnlineSubsystem::GetComponentCommerce (
 
 class UISFXOnlineComponentGalaxyAtWar* USFXOnlineSubsystem::GetComponentGalaxyAtWar ( )
 {
-	static UFunction* pFnGetComponentGalaxyAtWar = NULL;
-
+	UFunction* pFnGetComponentGalaxyAtWar = (UFunction*) SdkBindings::Get ( 3499 );
 	if ( ! pFnGetComponentGalaxyAtWar )
-		pFnGetComponentGalaxyAtWar = (UFunction*) UObject::GObjObjects()->Data[ 37587 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentGalaxyAtWar_Parms GetComponentGalaxyAtWar_Parms;
 
@@ -10551,10 +10080,9 @@ class UISFXOnlineComponentGalaxyAtWar* USFXOnlineSubsystem::GetComponentGalaxyAt
 
 class UISFXOnlineComponentTelemetry* USFXOnlineSubsystem::GetComponentTelemetry ( )
 {
-	static UFunction* pFnGetComponentTelemetry = NULL;
-
+	UFunction* pFnGetComponentTelemetry = (UFunction*) SdkBindings::Get ( 4309 );
 	if ( ! pFnGetComponentTelemetry )
-		pFnGetComponentTelemetry = (UFunction*) UObject::GObjObjects()->Data[ 40888 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentTelemetry_Parms GetComponentTelemetry_Parms;
 
@@ -10574,10 +10102,9 @@ class UISFXOnlineComponentTelemetry* USFXOnlineSubsystem::GetComponentTelemetry
 
 class UISFXOnlineComponentGameEntryFlow* USFXOnlineSubsystem::GetComponentGameEntryFlow ( )
 {
-	static UFunction* pFnGetComponentGameEntryFlow = NULL;
-
+	UFunction* pFnGetComponentGameEntryFlow = (UFunction*) SdkBindings::Get ( 3276 );
 	if ( ! pFnGetComponentGameEntryFlow )
-		pFnGetComponentGameEntryFlow = (UFunction*) UObject::GObjObjects()->Data[ 36788 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentGameEntryFlow_Parms GetComponentGameEntryFlow_Parms;
 
@@ -10597,10 +10124,9 @@ class UISFXOnlineComponentGameEntryFlow* USFXOnlineSubsystem::GetComponentGameEn
 
 class UISFXOnlineComponentMessaging* USFXOnlineSubsystem::GetComponentMessaging ( )
 {
-	static UFunction* pFnGetComponentMessaging = NULL;
-
+	UFunction* pFnGetComponentMessaging = (UFunction*) SdkBindings::Get ( 4308 );
 	if ( ! pFnGetComponentMessaging )
-		pFnGetComponentMessaging = (UFunction*) UObject::GObjObjects()->Data[ 40886 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentMessaging_Parms GetComponentMessaging_Parms;
 
@@ -10620,10 +10146,9 @@ class UISFXOnlineComponentMessaging* USFXOnlineSubsystem::GetComponentMessaging
 
 class UISFXOnlineComponentLeaderboard* USFXOnlineSubsystem::GetComponentLeaderboard ( )
 {
-	static UFunction* pFnGetComponentLeaderboard = NULL;
-
+	UFunction* pFnGetComponentLeaderboard = (UFunction*) SdkBindings::Get ( 4307 );
 	if ( ! pFnGetComponentLeaderboard )
-		pFnGetComponentLeaderboard = (UFunction*) UObject::GObjObjects()->Data[ 40884 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentLeaderboard_Parms GetComponentLeaderboard_Parms;
 
@@ -10643,10 +10168,9 @@ class UISFXOnlineComponentLeaderboard* USFXOnlineSubsystem::GetComponentLeaderbo
 
 class UISFXOnlineComponentMatchMakingBot* USFXOnlineSubsystem::GetComponentMatchMakingBot ( )
 {
-	static UFunction* pFnGetComponentMatchMakingBot = NULL;
-
+	UFunction* pFnGetComponentMatchMakingBot = (UFunction*) SdkBindings::Get ( 4306 );
 	if ( ! pFnGetComponentMatchMakingBot )
-		pFnGetComponentMatchMakingBot = (UFunction*) UObject::GObjObjects()->Data[ 40882 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentMatchMakingBot_Parms GetComponentMatchMakingBot_Parms;
 
@@ -10666,10 +10190,9 @@ class UISFXOnlineComponentMatchMakingBot* USFXOnlineSubsystem::GetComponentMatch
 
 class UISFXOnlineComponentStats* USFXOnlineSubsystem::GetComponentStats ( )
 {
-	static UFunction* pFnGetComponentStats = NULL;
-
+	UFunction* pFnGetComponentStats = (UFunction*) SdkBindings::Get ( 4295 );
 	if ( ! pFnGetComponentStats )
-		pFnGetComponentStats = (UFunction*) UObject::GObjObjects()->Data[ 40862 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentStats_Parms GetComponentStats_Parms;
 
@@ -10689,10 +10212,9 @@ class UISFXOnlineComponentStats* USFXOnlineSubsystem::GetComponentStats ( )
 
 class UISFXOnlineComponentNotification* USFXOnlineSubsystem::GetComponentNotification ( )
 {
-	static UFunction* pFnGetComponentNotification = NULL;
-
+	UFunction* pFnGetComponentNotification = (UFunction*) SdkBindings::Get ( 4305 );
 	if ( ! pFnGetComponentNotification )
-		pFnGetComponentNotification = (UFunction*) UObject::GObjObjects()->Data[ 40879 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentNotification_Parms GetComponentNotification_Parms;
 
@@ -10712,10 +10234,9 @@ class UISFXOnlineComponentNotification* USFXOnlineSubsystem::GetComponentNotific
 
 class UISFXOnlineComponentUserInterface* USFXOnlineSubsystem::GetComponentUserInterface ( )
 {
-	static UFunction* pFnGetComponentUserInterface = NULL;
-
+	UFunction* pFnGetComponentUserInterface = (UFunction*) SdkBindings::Get ( 4304 );
 	if ( ! pFnGetComponentUserInterface )
-		pFnGetComponentUserInterface = (UFunction*) UObject::GObjObjects()->Data[ 40877 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentUserInterface_Parms GetComponentUserInterface_Parms;
 
@@ -10735,10 +10256,9 @@ class UISFXOnlineComponentUserInterface* USFXOnlineSubsystem::GetComponentUserIn
 
 class UISFXOnlineComponentLogin* USFXOnlineSubsystem::GetComponentLogin ( )
 {
-	static UFunction* pFnGetComponentLogin = NULL;
-
+	UFunction* pFnGetComponentLogin = (UFunction*) SdkBindings::Get ( 4303 );
 	if ( ! pFnGetComponentLogin )
-		pFnGetComponentLogin = (UFunction*) UObject::GObjObjects()->Data[ 40875 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentLogin_Parms GetComponentLogin_Parms;
 
@@ -10758,10 +10278,9 @@ class UISFXOnlineComponentLogin* USFXOnlineSubsystem::GetComponentLogin ( )
 
 class UISFXOnlineComponentGameFlow* USFXOnlineSubsystem::GetComponentGameFlow ( )
 {
-	static UFunction* pFnGetComponentGameFlow = NULL;
-
+	UFunction* pFnGetComponentGameFlow = (UFunction*) SdkBindings::Get ( 3273 );
 	if ( ! pFnGetComponentGameFlow )
-		pFnGetComponentGameFlow = (UFunction*) UObject::GObjObjects()->Data[ 36769 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentGameFlow_Parms GetComponentGameFlow_Parms;
 
@@ -10781,10 +10300,9 @@ class UISFXOnlineComponentGameFlow* USFXOnlineSubsystem::GetComponentGameFlow (
 
 class UISFXOnlineComponentGame* USFXOnlineSubsystem::GetComponentGame ( )
 {
-	static UFunction* pFnGetComponentGame = NULL;
-
+	UFunction* pFnGetComponentGame = (UFunction*) SdkBindings::Get ( 4294 );
 	if ( ! pFnGetComponentGame )
-		pFnGetComponentGame = (UFunction*) UObject::GObjObjects()->Data[ 40858 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentGame_Parms GetComponentGame_Parms;
 
@@ -10804,10 +10322,9 @@ class UISFXOnlineComponentGame* USFXOnlineSubsystem::GetComponentGame ( )
 
 class UISFXOnlineComponentAPI* USFXOnlineSubsystem::GetComponentAPI ( )
 {
-	static UFunction* pFnGetComponentAPI = NULL;
-
+	UFunction* pFnGetComponentAPI = (UFunction*) SdkBindings::Get ( 4302 );
 	if ( ! pFnGetComponentAPI )
-		pFnGetComponentAPI = (UFunction*) UObject::GObjObjects()->Data[ 40872 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentAPI_Parms GetComponentAPI_Parms;
 
@@ -10827,10 +10344,9 @@ class UISFXOnlineComponentAPI* USFXOnlineSubsystem::GetComponentAPI ( )
 
 class UISFXOnlineComponentAchievement* USFXOnlineSubsystem::GetComponentAchievement ( )
 {
-	static UFunction* pFnGetComponentAchievement = NULL;
-
+	UFunction* pFnGetComponentAchievement = (UFunction*) SdkBindings::Get ( 4301 );
 	if ( ! pFnGetComponentAchievement )
-		pFnGetComponentAchievement = (UFunction*) UObject::GObjObjects()->Data[ 40870 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentAchievement_Parms GetComponentAchievement_Parms;
 
@@ -10850,10 +10366,9 @@ class UISFXOnlineComponentAchievement* USFXOnlineSubsystem::GetComponentAchievem
 
 class UISFXOnlineComponentPlatform* USFXOnlineSubsystem::GetComponentPlatform ( )
 {
-	static UFunction* pFnGetComponentPlatform = NULL;
-
+	UFunction* pFnGetComponentPlatform = (UFunction*) SdkBindings::Get ( 3453 );
 	if ( ! pFnGetComponentPlatform )
-		pFnGetComponentPlatform = (UFunction*) UObject::GObjObjects()->Data[ 37479 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetComponentPlatform_Parms GetComponentPlatform_Parms;
 
@@ -10873,10 +10388,9 @@ class UISFXOnlineComponentPlatform* USFXOnlineSubsystem::GetComponentPlatform (
 
 class USFXOnlineSubsystem* USFXOnlineSubsystem::GetOnlineSubsystem ( )
 {
-	static UFunction* pFnGetOnlineSubsystem = NULL;
-
+	UFunction* pFnGetOnlineSubsystem = (UFunction*) SdkBindings::Get ( 3376 );
 	if ( ! pFnGetOnlineSubsystem )
-		pFnGetOnlineSubsystem = (UFunction*) UObject::GObjObjects()->Data[ 37245 ];
+		return {};
 
 	USFXOnlineSubsystem_execGetOnlineSubsystem_Parms GetOnlineSubsystem_Parms;
 
@@ -10896,10 +10410,9 @@ class USFXOnlineSubsystem* USFXOnlineSubsystem::GetOnlineSubsystem ( )
 
 struct FString USFXOnlineSubsystem::eventGetURL ( )
 {
-	static UFunction* pFnGetURL = NULL;
-
+	UFunction* pFnGetURL = (UFunction*) SdkBindings::Get ( 4300 );
 	if ( ! pFnGetURL )
-		pFnGetURL = (UFunction*) UObject::GObjObjects()->Data[ 40867 ];
+		return {};
 
 	USFXOnlineSubsystem_eventGetURL_Parms GetURL_Parms;
 
@@ -10914,10 +10427,9 @@ struct FString USFXOnlineSubsystem::eventGetURL ( )
 
 void USFXOnlineSubsystem::SetUnrealInterfaces ( )
 {
-	static UFunction* pFnSetUnrealInterfaces = NULL;
-
+	UFunction* pFnSetUnrealInterfaces = (UFunction*) SdkBindings::Get ( 4292 );
 	if ( ! pFnSetUnrealInterfaces )
-		pFnSetUnrealInterfaces = (UFunction*) UObject::GObjObjects()->Data[ 40852 ];
+		return;
 
 	USFXOnlineSubsystem_execSetUnrealInterfaces_Parms SetUnrealInterfaces_Parms;
 
@@ -10930,10 +10442,9 @@ void USFXOnlineSubsystem::SetUnrealInterfaces ( )
 
 void USFXOnlineSubsystem::CreateComponents ( )
 {
-	static UFunction* pFnCreateComponents = NULL;
-
+	UFunction* pFnCreateComponents = (UFunction*) SdkBindings::Get ( 4291 );
 	if ( ! pFnCreateComponents )
-		pFnCreateComponents = (UFunction*) UObject::GObjObjects()->Data[ 40851 ];
+		return;
 
 	USFXOnlineSubsystem_execCreateComponents_Parms CreateComponents_Parms;
 
@@ -10947,10 +10458,9 @@ void USFXOnlineSubsystem::CreateComponents ( )
 
 void USFXOnlineSubsystem::eventUpdateGameProtocolVersion ( int runTimeVersioning )
 {
-	static UFunction* pFnUpdateGameProtocolVersion = NULL;
-
+	UFunction* pFnUpdateGameProtocolVersion = (UFunction*) SdkBindings::Get ( 4293 );
 	if ( ! pFnUpdateGameProtocolVersion )
-		pFnUpdateGameProtocolVersion = (UFunction*) UObject::GObjObjects()->Data[ 40855 ];
+		return;
 
 	USFXOnlineSubsystem_eventUpdateGameProtocolVersion_Parms UpdateGameProtocolVersion_Parms;
 	UpdateGameProtocolVersion_Parms.runTimeVersioning = runTimeVersioning;
@@ -10964,10 +10474,9 @@ void USFXOnlineSubsystem::eventUpdateGameProtocolVersion ( int runTimeVersioning
 
 void USFXOnlineSubsystem::InitGameProtocolVersion ( )
 {
-	static UFunction* pFnInitGameProtocolVersion = NULL;
-
+	UFunction* pFnInitGameProtocolVersion = (UFunction*) SdkBindings::Get ( 4290 );
 	if ( ! pFnInitGameProtocolVersion )
-		pFnInitGameProtocolVersion = (UFunction*) UObject::GObjObjects()->Data[ 40850 ];
+		return;
 
 	USFXOnlineSubsystem_execInitGameProtocolVersion_Parms InitGameProtocolVersion_Parms;
 
@@ -10981,10 +10490,9 @@ void USFXOnlineSubsystem::InitGameProtocolVersion ( )
 
 bool USFXOnlineSubsystem::eventInit ( )
 {
-	static UFunction* pFnInit = NULL;
-
+	UFunction* pFnInit = (UFunction*) SdkBindings::Get ( 4289 );
 	if ( ! pFnInit )
-		pFnInit = (UFunction*) UObject::GObjObjects()->Data[ 40847 ];
+		return {};
 
 	USFXOnlineSubsystem_eventInit_Parms Init_Parms;
 
@@ -11000,10 +10508,9 @@ bool USFXOnlineSubsystem::eventInit ( )
 
 struct FName Usfxonlinecomponentachievementpc::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 4332 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 40957 ];
+		return {};
 
 	Usfxonlinecomponentachievementpc_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -11022,10 +10529,9 @@ struct FName Usfxonlinecomponentachievementpc::GetAPIName ( )
 
 void Usfxonlinecomponentachievementpc::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 4331 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 40956 ];
+		return;
 
 	Usfxonlinecomponentachievementpc_execOnRelease_Parms OnRelease_Parms;
 
@@ -11043,10 +10549,9 @@ void Usfxonlinecomponentachievementpc::OnRelease ( )
 
 void Usfxonlinecomponentachievementpc::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 4330 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 40954 ];
+		return;
 
 	Usfxonlinecomponentachievementpc_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -11067,10 +10572,9 @@ void Usfxonlinecomponentachievementpc::OnInitialize ( class USFXOnlineSubsystem*
 
 bool Usfxonlinecomponentachievementpc::IsGranted ( unsigned char LocalUserNum, int AchievementId )
 {
-	static UFunction* pFnIsGranted = NULL;
-
+	UFunction* pFnIsGranted = (UFunction*) SdkBindings::Get ( 4329 );
 	if ( ! pFnIsGranted )
-		pFnIsGranted = (UFunction*) UObject::GObjObjects()->Data[ 40950 ];
+		return {};
 
 	Usfxonlinecomponentachievementpc_execIsGranted_Parms IsGranted_Parms;
 	IsGranted_Parms.LocalUserNum = LocalUserNum;
@@ -11093,10 +10597,9 @@ bool Usfxonlinecomponentachievementpc::IsGranted ( unsigned char LocalUserNum, i
 
 void Usfxonlinecomponentachievementpc::Grant ( unsigned char LocalUserNum, int AchievementId )
 {
-	static UFunction* pFnGrant = NULL;
-
+	UFunction* pFnGrant = (UFunction*) SdkBindings::Get ( 4328 );
 	if ( ! pFnGrant )
-		pFnGrant = (UFunction*) UObject::GObjObjects()->Data[ 40947 ];
+		return;
 
 	Usfxonlinecomponentachievementpc_execGrant_Parms Grant_Parms;
 	Grant_Parms.LocalUserNum = LocalUserNum;
@@ -11116,10 +10619,9 @@ void Usfxonlinecomponentachievementpc::Grant ( unsigned char LocalUserNum, int A
 
 bool USFXOnlineComponentOrigin::ProcessAchievementQueue ( )
 {
-	static UFunction* pFnProcessAchievementQueue = NULL;
-
+	UFunction* pFnProcessAchievementQueue = (UFunction*) SdkBindings::Get ( 3814 );
 	if ( ! pFnProcessAchievementQueue )
-		pFnProcessAchievementQueue = (UFunction*) UObject::GObjObjects()->Data[ 38915 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execProcessAchievementQueue_Parms ProcessAchievementQueue_Parms;
 
@@ -11139,10 +10641,9 @@ bool USFXOnlineComponentOrigin::ProcessAchievementQueue ( )
 
 bool USFXOnlineComponentOrigin::RefreshServerAchievements_ASync ( )
 {
-	static UFunction* pFnRefreshServerAchievements_ASync = NULL;
-
+	UFunction* pFnRefreshServerAchievements_ASync = (UFunction*) SdkBindings::Get ( 3815 );
 	if ( ! pFnRefreshServerAchievements_ASync )
-		pFnRefreshServerAchievements_ASync = (UFunction*) UObject::GObjObjects()->Data[ 38954 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execRefreshServerAchievements_ASync_Parms RefreshServerAchievements_ASync_Parms;
 
@@ -11163,10 +10664,9 @@ bool USFXOnlineComponentOrigin::RefreshServerAchievements_ASync ( )
 
 bool USFXOnlineComponentOrigin::IsAchievementGranted ( int AchievementId )
 {
-	static UFunction* pFnIsAchievementGranted = NULL;
-
+	UFunction* pFnIsAchievementGranted = (UFunction*) SdkBindings::Get ( 3816 );
 	if ( ! pFnIsAchievementGranted )
-		pFnIsAchievementGranted = (UFunction*) UObject::GObjObjects()->Data[ 38956 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execIsAchievementGranted_Parms IsAchievementGranted_Parms;
 	IsAchievementGranted_Parms.AchievementId = AchievementId;
@@ -11188,10 +10688,9 @@ bool USFXOnlineComponentOrigin::IsAchievementGranted ( int AchievementId )
 
 bool USFXOnlineComponentOrigin::GrantAchievement ( int AchievementId )
 {
-	static UFunction* pFnGrantAchievement = NULL;
-
+	UFunction* pFnGrantAchievement = (UFunction*) SdkBindings::Get ( 3817 );
 	if ( ! pFnGrantAchievement )
-		pFnGrantAchievement = (UFunction*) UObject::GObjObjects()->Data[ 38958 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execGrantAchievement_Parms GrantAchievement_Parms;
 	GrantAchievement_Parms.AchievementId = AchievementId;
@@ -11213,10 +10712,9 @@ bool USFXOnlineComponentOrigin::GrantAchievement ( int AchievementId )
 
 bool USFXOnlineComponentOrigin::IsMuted ( struct FString* personaName )
 {
-	static UFunction* pFnIsMuted = NULL;
-
+	UFunction* pFnIsMuted = (UFunction*) SdkBindings::Get ( 3813 );
 	if ( ! pFnIsMuted )
-		pFnIsMuted = (UFunction*) UObject::GObjObjects()->Data[ 38911 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execIsMuted_Parms IsMuted_Parms;
 
@@ -11238,10 +10736,9 @@ bool USFXOnlineComponentOrigin::IsMuted ( struct FString* personaName )
 
 void USFXOnlineComponentOrigin::OnOriginGoesOffline ( )
 {
-	static UFunction* pFnOnOriginGoesOffline = NULL;
-
+	UFunction* pFnOnOriginGoesOffline = (UFunction*) SdkBindings::Get ( 3812 );
 	if ( ! pFnOnOriginGoesOffline )
-		pFnOnOriginGoesOffline = (UFunction*) UObject::GObjObjects()->Data[ 38910 ];
+		return;
 
 	USFXOnlineComponentOrigin_execOnOriginGoesOffline_Parms OnOriginGoesOffline_Parms;
 
@@ -11258,10 +10755,9 @@ void USFXOnlineComponentOrigin::OnOriginGoesOffline ( )
 
 void USFXOnlineComponentOrigin::OnOriginClosed ( )
 {
-	static UFunction* pFnOnOriginClosed = NULL;
-
+	UFunction* pFnOnOriginClosed = (UFunction*) SdkBindings::Get ( 3811 );
 	if ( ! pFnOnOriginClosed )
-		pFnOnOriginClosed = (UFunction*) UObject::GObjObjects()->Data[ 38909 ];
+		return;
 
 	USFXOnlineComponentOrigin_execOnOriginClosed_Parms OnOriginClosed_Parms;
 
@@ -11279,10 +10775,9 @@ void USFXOnlineComponentOrigin::OnOriginClosed ( )
 
 void USFXOnlineComponentOrigin::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
-
+	UFunction* pFnOnTick = (UFunction*) SdkBindings::Get ( 3810 );
 	if ( ! pFnOnTick )
-		pFnOnTick = (UFunction*) UObject::GObjObjects()->Data[ 38907 ];
+		return;
 
 	USFXOnlineComponentOrigin_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
@@ -11300,10 +10795,9 @@ void USFXOnlineComponentOrigin::OnTick ( class USFXOnlineEvent* oEvent )
 
 void USFXOnlineComponentOrigin::RequestWalletBalance ( )
 {
-	static UFunction* pFnRequestWalletBalance = NULL;
-
+	UFunction* pFnRequestWalletBalance = (UFunction*) SdkBindings::Get ( 3809 );
 	if ( ! pFnRequestWalletBalance )
-		pFnRequestWalletBalance = (UFunction*) UObject::GObjObjects()->Data[ 38906 ];
+		return;
 
 	USFXOnlineComponentOrigin_execRequestWalletBalance_Parms RequestWalletBalance_Parms;
 
@@ -11320,10 +10814,9 @@ void USFXOnlineComponentOrigin::RequestWalletBalance ( )
 
 void USFXOnlineComponentOrigin::RequestBlockList ( )
 {
-	static UFunction* pFnRequestBlockList = NULL;
-
+	UFunction* pFnRequestBlockList = (UFunction*) SdkBindings::Get ( 3808 );
 	if ( ! pFnRequestBlockList )
-		pFnRequestBlockList = (UFunction*) UObject::GObjObjects()->Data[ 38905 ];
+		return;
 
 	USFXOnlineComponentOrigin_execRequestBlockList_Parms RequestBlockList_Parms;
 
@@ -11340,10 +10833,9 @@ void USFXOnlineComponentOrigin::RequestBlockList ( )
 
 void USFXOnlineComponentOrigin::RequestEntitlementCache ( )
 {
-	static UFunction* pFnRequestEntitlementCache = NULL;
-
+	UFunction* pFnRequestEntitlementCache = (UFunction*) SdkBindings::Get ( 3807 );
 	if ( ! pFnRequestEntitlementCache )
-		pFnRequestEntitlementCache = (UFunction*) UObject::GObjObjects()->Data[ 38904 ];
+		return;
 
 	USFXOnlineComponentOrigin_execRequestEntitlementCache_Parms RequestEntitlementCache_Parms;
 
@@ -11361,10 +10853,9 @@ void USFXOnlineComponentOrigin::RequestEntitlementCache ( )
 
 void USFXOnlineComponentOrigin::ProcessIGODisplayEvent ( unsigned long isOpening )
 {
-	static UFunction* pFnProcessIGODisplayEvent = NULL;
-
+	UFunction* pFnProcessIGODisplayEvent = (UFunction*) SdkBindings::Get ( 3806 );
 	if ( ! pFnProcessIGODisplayEvent )
-		pFnProcessIGODisplayEvent = (UFunction*) UObject::GObjObjects()->Data[ 38902 ];
+		return;
 
 	USFXOnlineComponentOrigin_execProcessIGODisplayEvent_Parms ProcessIGODisplayEvent_Parms;
 	ProcessIGODisplayEvent_Parms.isOpening = isOpening;
@@ -11383,10 +10874,9 @@ void USFXOnlineComponentOrigin::ProcessIGODisplayEvent ( unsigned long isOpening
 
 void USFXOnlineComponentOrigin::OnBlazeSignedIn ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnBlazeSignedIn = NULL;
-
+	UFunction* pFnOnBlazeSignedIn = (UFunction*) SdkBindings::Get ( 3805 );
 	if ( ! pFnOnBlazeSignedIn )
-		pFnOnBlazeSignedIn = (UFunction*) UObject::GObjObjects()->Data[ 38900 ];
+		return;
 
 	USFXOnlineComponentOrigin_execOnBlazeSignedIn_Parms OnBlazeSignedIn_Parms;
 	OnBlazeSignedIn_Parms.oEvent = oEvent;
@@ -11405,10 +10895,9 @@ void USFXOnlineComponentOrigin::OnBlazeSignedIn ( class USFXOnlineEvent* oEvent
 
 bool USFXOnlineComponentOrigin::CheckEntitlementCache ( )
 {
-	static UFunction* pFnCheckEntitlementCache = NULL;
-
+	UFunction* pFnCheckEntitlementCache = (UFunction*) SdkBindings::Get ( 3804 );
 	if ( ! pFnCheckEntitlementCache )
-		pFnCheckEntitlementCache = (UFunction*) UObject::GObjObjects()->Data[ 38898 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execCheckEntitlementCache_Parms CheckEntitlementCache_Parms;
 
@@ -11428,10 +10917,9 @@ bool USFXOnlineComponentOrigin::CheckEntitlementCache ( )
 
 bool USFXOnlineComponentOrigin::CheckSignedIn ( )
 {
-	static UFunction* pFnCheckSignedIn = NULL;
-
+	UFunction* pFnCheckSignedIn = (UFunction*) SdkBindings::Get ( 3803 );
 	if ( ! pFnCheckSignedIn )
-		pFnCheckSignedIn = (UFunction*) UObject::GObjObjects()->Data[ 38896 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execCheckSignedIn_Parms CheckSignedIn_Parms;
 
@@ -11451,10 +10939,9 @@ bool USFXOnlineComponentOrigin::CheckSignedIn ( )
 
 bool USFXOnlineComponentOrigin::QueryIgoEnabled ( )
 {
-	static UFunction* pFnQueryIgoEnabled = NULL;
-
+	UFunction* pFnQueryIgoEnabled = (UFunction*) SdkBindings::Get ( 3802 );
 	if ( ! pFnQueryIgoEnabled )
-		pFnQueryIgoEnabled = (UFunction*) UObject::GObjObjects()->Data[ 38894 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execQueryIgoEnabled_Parms QueryIgoEnabled_Parms;
 
@@ -11474,10 +10961,9 @@ bool USFXOnlineComponentOrigin::QueryIgoEnabled ( )
 
 bool USFXOnlineComponentOrigin::QueryOnline ( )
 {
-	static UFunction* pFnQueryOnline = NULL;
-
+	UFunction* pFnQueryOnline = (UFunction*) SdkBindings::Get ( 3801 );
 	if ( ! pFnQueryOnline )
-		pFnQueryOnline = (UFunction*) UObject::GObjObjects()->Data[ 38892 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execQueryOnline_Parms QueryOnline_Parms;
 
@@ -11497,10 +10983,9 @@ bool USFXOnlineComponentOrigin::QueryOnline ( )
 
 bool USFXOnlineComponentOrigin::CheckOnline ( )
 {
-	static UFunction* pFnCheckOnline = NULL;
-
+	UFunction* pFnCheckOnline = (UFunction*) SdkBindings::Get ( 3800 );
 	if ( ! pFnCheckOnline )
-		pFnCheckOnline = (UFunction*) UObject::GObjObjects()->Data[ 38890 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execCheckOnline_Parms CheckOnline_Parms;
 
@@ -11519,10 +11004,9 @@ bool USFXOnlineComponentOrigin::CheckOnline ( )
 
 void USFXOnlineComponentOrigin::JoinPendingGameInvite ( )
 {
-	static UFunction* pFnJoinPendingGameInvite = NULL;
-
+	UFunction* pFnJoinPendingGameInvite = (UFunction*) SdkBindings::Get ( 3799 );
 	if ( ! pFnJoinPendingGameInvite )
-		pFnJoinPendingGameInvite = (UFunction*) UObject::GObjObjects()->Data[ 38889 ];
+		return;
 
 	USFXOnlineComponentOrigin_execJoinPendingGameInvite_Parms JoinPendingGameInvite_Parms;
 
@@ -11541,10 +11025,9 @@ void USFXOnlineComponentOrigin::JoinPendingGameInvite ( )
 
 bool USFXOnlineComponentOrigin::SetPresenceState ( unsigned char presence )
 {
-	static UFunction* pFnSetPresenceState = NULL;
-
+	UFunction* pFnSetPresenceState = (UFunction*) SdkBindings::Get ( 3798 );
 	if ( ! pFnSetPresenceState )
-		pFnSetPresenceState = (UFunction*) UObject::GObjObjects()->Data[ 38886 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execSetPresenceState_Parms SetPresenceState_Parms;
 	SetPresenceState_Parms.presence = presence;
@@ -11567,10 +11050,9 @@ bool USFXOnlineComponentOrigin::SetPresenceState ( unsigned char presence )
 
 bool USFXOnlineComponentOrigin::SetRichPresence ( struct FString presence, struct FString gamePresence )
 {
-	static UFunction* pFnSetRichPresence = NULL;
-
+	UFunction* pFnSetRichPresence = (UFunction*) SdkBindings::Get ( 3797 );
 	if ( ! pFnSetRichPresence )
-		pFnSetRichPresence = (UFunction*) UObject::GObjObjects()->Data[ 38882 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execSetRichPresence_Parms SetRichPresence_Parms;
 	memcpy ( &SetRichPresence_Parms.presence, &presence, 0xC );
@@ -11592,10 +11074,9 @@ bool USFXOnlineComponentOrigin::SetRichPresence ( struct FString presence, struc
 
 bool USFXOnlineComponentOrigin::ClearSessionPresence ( )
 {
-	static UFunction* pFnClearSessionPresence = NULL;
-
+	UFunction* pFnClearSessionPresence = (UFunction*) SdkBindings::Get ( 3796 );
 	if ( ! pFnClearSessionPresence )
-		pFnClearSessionPresence = (UFunction*) UObject::GObjObjects()->Data[ 38880 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execClearSessionPresence_Parms ClearSessionPresence_Parms;
 
@@ -11616,10 +11097,9 @@ bool USFXOnlineComponentOrigin::ClearSessionPresence ( )
 
 bool USFXOnlineComponentOrigin::SetSessionPresence ( struct FString SessionId )
 {
-	static UFunction* pFnSetSessionPresence = NULL;
-
+	UFunction* pFnSetSessionPresence = (UFunction*) SdkBindings::Get ( 3795 );
 	if ( ! pFnSetSessionPresence )
-		pFnSetSessionPresence = (UFunction*) UObject::GObjObjects()->Data[ 38877 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execSetSessionPresence_Parms SetSessionPresence_Parms;
 	memcpy ( &SetSessionPresence_Parms.SessionId, &SessionId, 0xC );
@@ -11640,10 +11120,9 @@ bool USFXOnlineComponentOrigin::SetSessionPresence ( struct FString SessionId )
 
 bool USFXOnlineComponentOrigin::RequestFriendsList ( )
 {
-	static UFunction* pFnRequestFriendsList = NULL;
-
+	UFunction* pFnRequestFriendsList = (UFunction*) SdkBindings::Get ( 3794 );
 	if ( ! pFnRequestFriendsList )
-		pFnRequestFriendsList = (UFunction*) UObject::GObjObjects()->Data[ 38875 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execRequestFriendsList_Parms RequestFriendsList_Parms;
 
@@ -11664,10 +11143,9 @@ bool USFXOnlineComponentOrigin::RequestFriendsList ( )
 
 bool USFXOnlineComponentOrigin::Checkout ( struct FString offerId )
 {
-	static UFunction* pFnCheckout = NULL;
-
+	UFunction* pFnCheckout = (UFunction*) SdkBindings::Get ( 3793 );
 	if ( ! pFnCheckout )
-		pFnCheckout = (UFunction*) UObject::GObjObjects()->Data[ 38872 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execCheckout_Parms Checkout_Parms;
 	memcpy ( &Checkout_Parms.offerId, &offerId, 0xC );
@@ -11689,10 +11167,9 @@ bool USFXOnlineComponentOrigin::Checkout ( struct FString offerId )
 
 bool USFXOnlineComponentOrigin::ShowCheckoutOverlay ( struct FString offerId )
 {
-	static UFunction* pFnShowCheckoutOverlay = NULL;
-
+	UFunction* pFnShowCheckoutOverlay = (UFunction*) SdkBindings::Get ( 3792 );
 	if ( ! pFnShowCheckoutOverlay )
-		pFnShowCheckoutOverlay = (UFunction*) UObject::GObjObjects()->Data[ 38869 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execShowCheckoutOverlay_Parms ShowCheckoutOverlay_Parms;
 	memcpy ( &ShowCheckoutOverlay_Parms.offerId, &offerId, 0xC );
@@ -11714,10 +11191,9 @@ bool USFXOnlineComponentOrigin::ShowCheckoutOverlay ( struct FString offerId )
 
 bool USFXOnlineComponentOrigin::ShowStoreOverlay ( struct FString categoryId )
 {
-	static UFunction* pFnShowStoreOverlay = NULL;
-
+	UFunction* pFnShowStoreOverlay = (UFunction*) SdkBindings::Get ( 3791 );
 	if ( ! pFnShowStoreOverlay )
-		pFnShowStoreOverlay = (UFunction*) UObject::GObjObjects()->Data[ 38866 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execShowStoreOverlay_Parms ShowStoreOverlay_Parms;
 	memcpy ( &ShowStoreOverlay_Parms.categoryId, &categoryId, 0xC );
@@ -11738,10 +11214,9 @@ bool USFXOnlineComponentOrigin::ShowStoreOverlay ( struct FString categoryId )
 
 bool USFXOnlineComponentOrigin::ShowInviteOverlay ( )
 {
-	static UFunction* pFnShowInviteOverlay = NULL;
-
+	UFunction* pFnShowInviteOverlay = (UFunction*) SdkBindings::Get ( 3790 );
 	if ( ! pFnShowInviteOverlay )
-		pFnShowInviteOverlay = (UFunction*) UObject::GObjObjects()->Data[ 38864 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execShowInviteOverlay_Parms ShowInviteOverlay_Parms;
 
@@ -11761,10 +11236,9 @@ bool USFXOnlineComponentOrigin::ShowInviteOverlay ( )
 
 bool USFXOnlineComponentOrigin::ShowFriendsOverlay ( )
 {
-	static UFunction* pFnShowFriendsOverlay = NULL;
-
+	UFunction* pFnShowFriendsOverlay = (UFunction*) SdkBindings::Get ( 3789 );
 	if ( ! pFnShowFriendsOverlay )
-		pFnShowFriendsOverlay = (UFunction*) UObject::GObjObjects()->Data[ 38862 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execShowFriendsOverlay_Parms ShowFriendsOverlay_Parms;
 
@@ -11783,10 +11257,9 @@ bool USFXOnlineComponentOrigin::ShowFriendsOverlay ( )
 
 void USFXOnlineComponentOrigin::RequestAuthToken ( )
 {
-	static UFunction* pFnRequestAuthToken = NULL;
-
+	UFunction* pFnRequestAuthToken = (UFunction*) SdkBindings::Get ( 3788 );
 	if ( ! pFnRequestAuthToken )
-		pFnRequestAuthToken = (UFunction*) UObject::GObjObjects()->Data[ 38861 ];
+		return;
 
 	USFXOnlineComponentOrigin_execRequestAuthToken_Parms RequestAuthToken_Parms;
 
@@ -11803,10 +11276,9 @@ void USFXOnlineComponentOrigin::RequestAuthToken ( )
 
 void USFXOnlineComponentOrigin::RequestProfileInfo ( )
 {
-	static UFunction* pFnRequestProfileInfo = NULL;
-
+	UFunction* pFnRequestProfileInfo = (UFunction*) SdkBindings::Get ( 3787 );
 	if ( ! pFnRequestProfileInfo )
-		pFnRequestProfileInfo = (UFunction*) UObject::GObjObjects()->Data[ 38860 ];
+		return;
 
 	USFXOnlineComponentOrigin_execRequestProfileInfo_Parms RequestProfileInfo_Parms;
 
@@ -11824,10 +11296,9 @@ void USFXOnlineComponentOrigin::RequestProfileInfo ( )
 
 bool USFXOnlineComponentOrigin::RegisterCallbacks ( )
 {
-	static UFunction* pFnRegisterCallbacks = NULL;
-
+	UFunction* pFnRegisterCallbacks = (UFunction*) SdkBindings::Get ( 3786 );
 	if ( ! pFnRegisterCallbacks )
-		pFnRegisterCallbacks = (UFunction*) UObject::GObjObjects()->Data[ 38858 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execRegisterCallbacks_Parms RegisterCallbacks_Parms;
 
@@ -11847,10 +11318,9 @@ bool USFXOnlineComponentOrigin::RegisterCallbacks ( )
 
 bool USFXOnlineComponentOrigin::StopService ( )
 {
-	static UFunction* pFnStopService = NULL;
-
+	UFunction* pFnStopService = (UFunction*) SdkBindings::Get ( 3785 );
 	if ( ! pFnStopService )
-		pFnStopService = (UFunction*) UObject::GObjObjects()->Data[ 38856 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execStopService_Parms StopService_Parms;
 
@@ -11870,10 +11340,9 @@ bool USFXOnlineComponentOrigin::StopService ( )
 
 bool USFXOnlineComponentOrigin::StartService ( )
 {
-	static UFunction* pFnStartService = NULL;
-
+	UFunction* pFnStartService = (UFunction*) SdkBindings::Get ( 3784 );
 	if ( ! pFnStartService )
-		pFnStartService = (UFunction*) UObject::GObjObjects()->Data[ 38854 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execStartService_Parms StartService_Parms;
 
@@ -11893,10 +11362,9 @@ bool USFXOnlineComponentOrigin::StartService ( )
 
 struct FName USFXOnlineComponentOrigin::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3783 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 38852 ];
+		return {};
 
 	USFXOnlineComponentOrigin_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -11915,10 +11383,9 @@ struct FName USFXOnlineComponentOrigin::GetAPIName ( )
 
 void USFXOnlineComponentOrigin::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3782 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 38851 ];
+		return;
 
 	USFXOnlineComponentOrigin_execOnRelease_Parms OnRelease_Parms;
 
@@ -11936,10 +11403,9 @@ void USFXOnlineComponentOrigin::OnRelease ( )
 
 void USFXOnlineComponentOrigin::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3781 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 38849 ];
+		return;
 
 	USFXOnlineComponentOrigin_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -11959,10 +11425,9 @@ void USFXOnlineComponentOrigin::OnInitialize ( class USFXOnlineSubsystem* oOnlin
 
 void USFXOnlineComponentOrigin::eventTriggerWalletBalanceAvailableDelegates ( unsigned long Success, int balance )
 {
-	static UFunction* pFnTriggerWalletBalanceAvailableDelegates = NULL;
-
+	UFunction* pFnTriggerWalletBalanceAvailableDelegates = (UFunction*) SdkBindings::Get ( 3780 );
 	if ( ! pFnTriggerWalletBalanceAvailableDelegates )
-		pFnTriggerWalletBalanceAvailableDelegates = (UFunction*) UObject::GObjObjects()->Data[ 38845 ];
+		return;
 
 	USFXOnlineComponentOrigin_eventTriggerWalletBalanceAvailableDelegates_Parms TriggerWalletBalanceAvailableDelegates_Parms;
 	TriggerWalletBalanceAvailableDelegates_Parms.Success = Success;
@@ -11978,10 +11443,9 @@ void USFXOnlineComponentOrigin::eventTriggerWalletBalanceAvailableDelegates ( un
 
 void USFXOnlineComponentOrigin::eventClearWalletBalanceAvailableDelegate ( struct FScriptDelegate walletBalanceDelegate )
 {
-	static UFunction* pFnClearWalletBalanceAvailableDelegate = NULL;
-
+	UFunction* pFnClearWalletBalanceAvailableDelegate = (UFunction*) SdkBindings::Get ( 3779 );
 	if ( ! pFnClearWalletBalanceAvailableDelegate )
-		pFnClearWalletBalanceAvailableDelegate = (UFunction*) UObject::GObjObjects()->Data[ 38842 ];
+		return;
 
 	USFXOnlineComponentOrigin_eventClearWalletBalanceAvailableDelegate_Parms ClearWalletBalanceAvailableDelegate_Parms;
 	memcpy ( &ClearWalletBalanceAvailableDelegate_Parms.walletBalanceDelegate, &walletBalanceDelegate, 0xC );
@@ -11996,10 +11460,9 @@ void USFXOnlineComponentOrigin::eventClearWalletBalanceAvailableDelegate ( struc
 
 void USFXOnlineComponentOrigin::eventAddWalletBalanceAvailableDelegate ( struct FScriptDelegate walletBalanceDelegate )
 {
-	static UFunction* pFnAddWalletBalanceAvailableDelegate = NULL;
-
+	UFunction* pFnAddWalletBalanceAvailableDelegate = (UFunction*) SdkBindings::Get ( 3778 );
 	if ( ! pFnAddWalletBalanceAvailableDelegate )
-		pFnAddWalletBalanceAvailableDelegate = (UFunction*) UObject::GObjObjects()->Data[ 38840 ];
+		return;
 
 	USFXOnlineComponentOrigin_eventAddWalletBalanceAvailableDelegate_Parms AddWalletBalanceAvailableDelegate_Parms;
 	memcpy ( &AddWalletBalanceAvailableDelegate_Parms.walletBalanceDelegate, &walletBalanceDelegate, 0xC );
@@ -12015,10 +11478,9 @@ void USFXOnlineComponentOrigin::eventAddWalletBalanceAvailableDelegate ( struct
 
 void USFXOnlineComponentOrigin::eventTriggerOriginAuthKeyDelegates ( unsigned long Success, struct FString authKey )
 {
-	static UFunction* pFnTriggerOriginAuthKeyDelegates = NULL;
-
+	UFunction* pFnTriggerOriginAuthKeyDelegates = (UFunction*) SdkBindings::Get ( 3777 );
 	if ( ! pFnTriggerOriginAuthKeyDelegates )
-		pFnTriggerOriginAuthKeyDelegates = (UFunction*) UObject::GObjObjects()->Data[ 38836 ];
+		return;
 
 	USFXOnlineComponentOrigin_eventTriggerOriginAuthKeyDelegates_Parms TriggerOriginAuthKeyDelegates_Parms;
 	TriggerOriginAuthKeyDelegates_Parms.Success = Success;
@@ -12034,10 +11496,9 @@ void USFXOnlineComponentOrigin::eventTriggerOriginAuthKeyDelegates ( unsigned lo
 
 void USFXOnlineComponentOrigin::eventClearOriginAuthKeyDelegate ( struct FScriptDelegate authKeyDelegate )
 {
-	static UFunction* pFnClearOriginAuthKeyDelegate = NULL;
-
+	UFunction* pFnClearOriginAuthKeyDelegate = (UFunction*) SdkBindings::Get ( 3776 );
 	if ( ! pFnClearOriginAuthKeyDelegate )
-		pFnClearOriginAuthKeyDelegate = (UFunction*) UObject::GObjObjects()->Data[ 38833 ];
+		return;
 
 	USFXOnlineComponentOrigin_eventClearOriginAuthKeyDelegate_Parms ClearOriginAuthKeyDelegate_Parms;
 	memcpy ( &ClearOriginAuthKeyDelegate_Parms.authKeyDelegate, &authKeyDelegate, 0xC );
@@ -12052,10 +11513,9 @@ void USFXOnlineComponentOrigin::eventClearOriginAuthKeyDelegate ( struct FScript
 
 void USFXOnlineComponentOrigin::eventAddOriginAuthKeyDelegate ( struct FScriptDelegate authKeyDelegate )
 {
-	static UFunction* pFnAddOriginAuthKeyDelegate = NULL;
-
+	UFunction* pFnAddOriginAuthKeyDelegate = (UFunction*) SdkBindings::Get ( 3775 );
 	if ( ! pFnAddOriginAuthKeyDelegate )
-		pFnAddOriginAuthKeyDelegate = (UFunction*) UObject::GObjObjects()->Data[ 38831 ];
+		return;
 
 	USFXOnlineComponentOrigin_eventAddOriginAuthKeyDelegate_Parms AddOriginAuthKeyDelegate_Parms;
 	memcpy ( &AddOriginAuthKeyDelegate_Parms.authKeyDelegate, &authKeyDelegate, 0xC );
@@ -12069,10 +11529,9 @@ void USFXOnlineComponentOrigin::eventAddOriginAuthKeyDelegate ( struct FScriptDe
 
 void USFXOnlineComponentOrigin::eventTriggerOriginClosedDelegates ( )
 {
-	static UFunction* pFnTriggerOriginClosedDelegates = NULL;
-
+	UFunction* pFnTriggerOriginClosedDelegates = (UFunction*) SdkBindings::Get ( 3774 );
 	if ( ! pFnTriggerOriginClosedDelegates )
-		pFnTriggerOriginClosedDelegates = (UFunction*) UObject::GObjObjects()->Data[ 38829 ];
+		return;
 
 	USFXOnlineComponentOrigin_eventTriggerOriginClosedDelegates_Parms TriggerOriginClosedDelegates_Parms;
 
@@ -12086,10 +11545,9 @@ void USFXOnlineComponentOrigin::eventTriggerOriginClosedDelegates ( )
 
 void USFXOnlineComponentOrigin::eventClearOriginClosedDelegate ( struct FScriptDelegate originClosedDelegate )
 {
-	static UFunction* pFnClearOriginClosedDelegate = NULL;
-
+	UFunction* pFnClearOriginClosedDelegate = (UFunction*) SdkBindings::Get ( 3773 );
 	if ( ! pFnClearOriginClosedDelegate )
-		pFnClearOriginClosedDelegate = (UFunction*) UObject::GObjObjects()->Data[ 38826 ];
+		return;
 
 	USFXOnlineComponentOrigin_eventClearOriginClosedDelegate_Parms ClearOriginClosedDelegate_Parms;
 	memcpy ( &ClearOriginClosedDelegate_Parms.originClosedDelegate, &originClosedDelegate, 0xC );
@@ -12104,10 +11562,9 @@ void USFXOnlineComponentOrigin::eventClearOriginClosedDelegate ( struct FScriptD
 
 void USFXOnlineComponentOrigin::eventAddOriginClosedDelegate ( struct FScriptDelegate originClosedDelegate )
 {
-	static UFunction* pFnAddOriginClosedDelegate = NULL;
-
+	UFunction* pFnAddOriginClosedDelegate = (UFunction*) SdkBindings::Get ( 3772 );
 	if ( ! pFnAddOriginClosedDelegate )
-		pFnAddOriginClosedDelegate = (UFunction*) UObject::GObjObjects()->Data[ 38824 ];
+		return;
 
 	USFXOnlineComponentOrigin_eventAddOriginClosedDelegate_Parms AddOriginClosedDelegate_Parms;
 	memcpy ( &AddOriginClosedDelegate_Parms.originClosedDelegate, &originClosedDelegate, 0xC );
@@ -12123,10 +11580,9 @@ void USFXOnlineComponentOrigin::eventAddOriginClosedDelegate ( struct FScriptDel
 
 void USFXOnlineComponentOrigin::OnWalletBalanceAvailable ( unsigned long Success, int walletBalance )
 {
-	static UFunction* pFnOnWalletBalanceAvailable = NULL;
-
+	UFunction* pFnOnWalletBalanceAvailable = (UFunction*) SdkBindings::Get ( 3771 );
 	if ( ! pFnOnWalletBalanceAvailable )
-		pFnOnWalletBalanceAvailable = (UFunction*) UObject::GObjObjects()->Data[ 38819 ];
+		return;
 
 	USFXOnlineComponentOrigin_execOnWalletBalanceAvailable_Parms OnWalletBalanceAvailable_Parms;
 	OnWalletBalanceAvailable_Parms.Success = Success;
@@ -12143,10 +11599,9 @@ void USFXOnlineComponentOrigin::OnWalletBalanceAvailable ( unsigned long Success
 
 void USFXOnlineComponentOrigin::OnOriginAuthKey ( unsigned long Success, struct FString authKey )
 {
-	static UFunction* pFnOnOriginAuthKey = NULL;
-
+	UFunction* pFnOnOriginAuthKey = (UFunction*) SdkBindings::Get ( 3770 );
 	if ( ! pFnOnOriginAuthKey )
-		pFnOnOriginAuthKey = (UFunction*) UObject::GObjObjects()->Data[ 38816 ];
+		return;
 
 	USFXOnlineComponentOrigin_execOnOriginAuthKey_Parms OnOriginAuthKey_Parms;
 	OnOriginAuthKey_Parms.Success = Success;
@@ -12161,10 +11616,9 @@ void USFXOnlineComponentOrigin::OnOriginAuthKey ( unsigned long Success, struct
 
 void USFXOnlineComponentOrigin::OnOriginClosedDelegate ( )
 {
-	static UFunction* pFnOnOriginClosedDelegate = NULL;
-
+	UFunction* pFnOnOriginClosedDelegate = (UFunction*) SdkBindings::Get ( 3769 );
 	if ( ! pFnOnOriginClosedDelegate )
-		pFnOnOriginClosedDelegate = (UFunction*) UObject::GObjObjects()->Data[ 38813 ];
+		return;
 
 	USFXOnlineComponentOrigin_execOnOriginClosedDelegate_Parms OnOriginClosedDelegate_Parms;
 
@@ -12178,10 +11632,9 @@ void USFXOnlineComponentOrigin::OnOriginClosedDelegate ( )
 
 bool USFXOnlineComponentPlatformPC::ShowInbox ( )
 {
-	static UFunction* pFnShowInbox = NULL;
-
+	UFunction* pFnShowInbox = (UFunction*) SdkBindings::Get ( 3845 );
 	if ( ! pFnShowInbox )
-		pFnShowInbox = (UFunction*) UObject::GObjObjects()->Data[ 39063 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execShowInbox_Parms ShowInbox_Parms;
 
@@ -12201,10 +11654,9 @@ bool USFXOnlineComponentPlatformPC::ShowInbox ( )
 
 bool USFXOnlineComponentPlatformPC::ShowVoiceCommandTunerUI ( )
 {
-	static UFunction* pFnShowVoiceCommandTunerUI = NULL;
-
+	UFunction* pFnShowVoiceCommandTunerUI = (UFunction*) SdkBindings::Get ( 3844 );
 	if ( ! pFnShowVoiceCommandTunerUI )
-		pFnShowVoiceCommandTunerUI = (UFunction*) UObject::GObjObjects()->Data[ 39061 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execShowVoiceCommandTunerUI_Parms ShowVoiceCommandTunerUI_Parms;
 
@@ -12224,10 +11676,9 @@ bool USFXOnlineComponentPlatformPC::ShowVoiceCommandTunerUI ( )
 
 int USFXOnlineComponentPlatformPC::GetMinimumAgeForOnlinePlay ( )
 {
-	static UFunction* pFnGetMinimumAgeForOnlinePlay = NULL;
-
+	UFunction* pFnGetMinimumAgeForOnlinePlay = (UFunction*) SdkBindings::Get ( 3843 );
 	if ( ! pFnGetMinimumAgeForOnlinePlay )
-		pFnGetMinimumAgeForOnlinePlay = (UFunction*) UObject::GObjObjects()->Data[ 39059 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execGetMinimumAgeForOnlinePlay_Parms GetMinimumAgeForOnlinePlay_Parms;
 
@@ -12251,10 +11702,9 @@ int USFXOnlineComponentPlatformPC::GetMinimumAgeForOnlinePlay ( )
 
 unsigned char USFXOnlineComponentPlatformPC::GetFriendsList ( unsigned char LocalUserNum, int Count, int StartingAt, TArray< struct FOnlineFriend >* Friends )
 {
-	static UFunction* pFnGetFriendsList = NULL;
-
+	UFunction* pFnGetFriendsList = (UFunction*) SdkBindings::Get ( 3842 );
 	if ( ! pFnGetFriendsList )
-		pFnGetFriendsList = (UFunction*) UObject::GObjObjects()->Data[ 39052 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execGetFriendsList_Parms GetFriendsList_Parms;
 	GetFriendsList_Parms.LocalUserNum = LocalUserNum;
@@ -12283,10 +11733,9 @@ unsigned char USFXOnlineComponentPlatformPC::GetFriendsList ( unsigned char Loca
 
 bool USFXOnlineComponentPlatformPC::ReadFriendsList ( unsigned char LocalUserNum, int Count, int StartingAt )
 {
-	static UFunction* pFnReadFriendsList = NULL;
-
+	UFunction* pFnReadFriendsList = (UFunction*) SdkBindings::Get ( 3841 );
 	if ( ! pFnReadFriendsList )
-		pFnReadFriendsList = (UFunction*) UObject::GObjObjects()->Data[ 39047 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execReadFriendsList_Parms ReadFriendsList_Parms;
 	ReadFriendsList_Parms.LocalUserNum = LocalUserNum;
@@ -12309,10 +11758,9 @@ bool USFXOnlineComponentPlatformPC::ReadFriendsList ( unsigned char LocalUserNum
 
 bool USFXOnlineComponentPlatformPC::ShowStoreUI ( )
 {
-	static UFunction* pFnShowStoreUI = NULL;
-
+	UFunction* pFnShowStoreUI = (UFunction*) SdkBindings::Get ( 3840 );
 	if ( ! pFnShowStoreUI )
-		pFnShowStoreUI = (UFunction*) UObject::GObjObjects()->Data[ 39045 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execShowStoreUI_Parms ShowStoreUI_Parms;
 
@@ -12334,10 +11782,9 @@ bool USFXOnlineComponentPlatformPC::ShowStoreUI ( )
 
 bool USFXOnlineComponentPlatformPC::GetOnlineXuid ( int nUserIndex, struct FUniqueNetId* oPlayerXuid )
 {
-	static UFunction* pFnGetOnlineXuid = NULL;
-
+	UFunction* pFnGetOnlineXuid = (UFunction*) SdkBindings::Get ( 3839 );
 	if ( ! pFnGetOnlineXuid )
-		pFnGetOnlineXuid = (UFunction*) UObject::GObjObjects()->Data[ 39041 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execGetOnlineXuid_Parms GetOnlineXuid_Parms;
 	GetOnlineXuid_Parms.nUserIndex = nUserIndex;
@@ -12363,10 +11810,9 @@ bool USFXOnlineComponentPlatformPC::GetOnlineXuid ( int nUserIndex, struct FUniq
 
 bool USFXOnlineComponentPlatformPC::GetOfflineXuid ( int nUserIndex, struct FUniqueNetId* oPlayerXuid )
 {
-	static UFunction* pFnGetOfflineXuid = NULL;
-
+	UFunction* pFnGetOfflineXuid = (UFunction*) SdkBindings::Get ( 3838 );
 	if ( ! pFnGetOfflineXuid )
-		pFnGetOfflineXuid = (UFunction*) UObject::GObjObjects()->Data[ 39037 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execGetOfflineXuid_Parms GetOfflineXuid_Parms;
 	GetOfflineXuid_Parms.nUserIndex = nUserIndex;
@@ -12398,10 +11844,9 @@ bool USFXOnlineComponentPlatformPC::GetOfflineXuid ( int nUserIndex, struct FUni
 
 bool USFXOnlineComponentPlatformPC::ShowKeyboardUI ( unsigned char LocalUserNum, struct FString sTitleText, struct FString sDescriptionText, unsigned char nKeyboardType, unsigned long bShouldValidate, unsigned long bRouteThroughConsole, struct FString sDefaultText, int nMaxResultLength )
 {
-	static UFunction* pFnShowKeyboardUI = NULL;
-
+	UFunction* pFnShowKeyboardUI = (UFunction*) SdkBindings::Get ( 3837 );
 	if ( ! pFnShowKeyboardUI )
-		pFnShowKeyboardUI = (UFunction*) UObject::GObjObjects()->Data[ 39027 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execShowKeyboardUI_Parms ShowKeyboardUI_Parms;
 	ShowKeyboardUI_Parms.LocalUserNum = LocalUserNum;
@@ -12431,10 +11876,9 @@ bool USFXOnlineComponentPlatformPC::ShowKeyboardUI ( unsigned char LocalUserNum,
 
 bool USFXOnlineComponentPlatformPC::ShowInviteUI ( unsigned char LocalUserNum, struct FString InviteText )
 {
-	static UFunction* pFnShowInviteUI = NULL;
-
+	UFunction* pFnShowInviteUI = (UFunction*) SdkBindings::Get ( 3836 );
 	if ( ! pFnShowInviteUI )
-		pFnShowInviteUI = (UFunction*) UObject::GObjObjects()->Data[ 39023 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execShowInviteUI_Parms ShowInviteUI_Parms;
 	ShowInviteUI_Parms.LocalUserNum = LocalUserNum;
@@ -12458,10 +11902,9 @@ bool USFXOnlineComponentPlatformPC::ShowInviteUI ( unsigned char LocalUserNum, s
 
 bool USFXOnlineComponentPlatformPC::ShowFriendsInviteUI ( unsigned char eLocalUserNum, struct FUniqueNetId oPlayerXuid )
 {
-	static UFunction* pFnShowFriendsInviteUI = NULL;
-
+	UFunction* pFnShowFriendsInviteUI = (UFunction*) SdkBindings::Get ( 3835 );
 	if ( ! pFnShowFriendsInviteUI )
-		pFnShowFriendsInviteUI = (UFunction*) UObject::GObjObjects()->Data[ 39019 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execShowFriendsInviteUI_Parms ShowFriendsInviteUI_Parms;
 	ShowFriendsInviteUI_Parms.eLocalUserNum = eLocalUserNum;
@@ -12484,10 +11927,9 @@ bool USFXOnlineComponentPlatformPC::ShowFriendsInviteUI ( unsigned char eLocalUs
 
 bool USFXOnlineComponentPlatformPC::ShowFriendsUI ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnShowFriendsUI = NULL;
-
+	UFunction* pFnShowFriendsUI = (UFunction*) SdkBindings::Get ( 3834 );
 	if ( ! pFnShowFriendsUI )
-		pFnShowFriendsUI = (UFunction*) UObject::GObjObjects()->Data[ 39016 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execShowFriendsUI_Parms ShowFriendsUI_Parms;
 	ShowFriendsUI_Parms.eLocalUserNum = eLocalUserNum;
@@ -12509,10 +11951,9 @@ bool USFXOnlineComponentPlatformPC::ShowFriendsUI ( unsigned char eLocalUserNum
 
 bool USFXOnlineComponentPlatformPC::ShowAchievementsUI ( unsigned char byLocalUserNum )
 {
-	static UFunction* pFnShowAchievementsUI = NULL;
-
+	UFunction* pFnShowAchievementsUI = (UFunction*) SdkBindings::Get ( 3833 );
 	if ( ! pFnShowAchievementsUI )
-		pFnShowAchievementsUI = (UFunction*) UObject::GObjObjects()->Data[ 39013 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execShowAchievementsUI_Parms ShowAchievementsUI_Parms;
 	ShowAchievementsUI_Parms.byLocalUserNum = byLocalUserNum;
@@ -12535,10 +11976,9 @@ bool USFXOnlineComponentPlatformPC::ShowAchievementsUI ( unsigned char byLocalUs
 
 bool USFXOnlineComponentPlatformPC::ShowFeedbackUI ( unsigned char eLocalUserNum, struct FUniqueNetId oPlayerId )
 {
-	static UFunction* pFnShowFeedbackUI = NULL;
-
+	UFunction* pFnShowFeedbackUI = (UFunction*) SdkBindings::Get ( 3832 );
 	if ( ! pFnShowFeedbackUI )
-		pFnShowFeedbackUI = (UFunction*) UObject::GObjObjects()->Data[ 39009 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execShowFeedbackUI_Parms ShowFeedbackUI_Parms;
 	ShowFeedbackUI_Parms.eLocalUserNum = eLocalUserNum;
@@ -12562,10 +12002,9 @@ bool USFXOnlineComponentPlatformPC::ShowFeedbackUI ( unsigned char eLocalUserNum
 
 bool USFXOnlineComponentPlatformPC::ShowGamerCardUI ( unsigned char eLocalUserNum, struct FUniqueNetId oPlayerId )
 {
-	static UFunction* pFnShowGamerCardUI = NULL;
-
+	UFunction* pFnShowGamerCardUI = (UFunction*) SdkBindings::Get ( 3831 );
 	if ( ! pFnShowGamerCardUI )
-		pFnShowGamerCardUI = (UFunction*) UObject::GObjObjects()->Data[ 39005 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execShowGamerCardUI_Parms ShowGamerCardUI_Parms;
 	ShowGamerCardUI_Parms.eLocalUserNum = eLocalUserNum;
@@ -12588,10 +12027,9 @@ bool USFXOnlineComponentPlatformPC::ShowGamerCardUI ( unsigned char eLocalUserNu
 
 unsigned char USFXOnlineComponentPlatformPC::CanShowPresenceInformation ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanShowPresenceInformation = NULL;
-
+	UFunction* pFnCanShowPresenceInformation = (UFunction*) SdkBindings::Get ( 3830 );
 	if ( ! pFnCanShowPresenceInformation )
-		pFnCanShowPresenceInformation = (UFunction*) UObject::GObjObjects()->Data[ 39002 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execCanShowPresenceInformation_Parms CanShowPresenceInformation_Parms;
 	CanShowPresenceInformation_Parms.eLocalUserNum = eLocalUserNum;
@@ -12613,10 +12051,9 @@ unsigned char USFXOnlineComponentPlatformPC::CanShowPresenceInformation ( unsign
 
 unsigned char USFXOnlineComponentPlatformPC::CanViewPlayerProfiles ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanViewPlayerProfiles = NULL;
-
+	UFunction* pFnCanViewPlayerProfiles = (UFunction*) SdkBindings::Get ( 3829 );
 	if ( ! pFnCanViewPlayerProfiles )
-		pFnCanViewPlayerProfiles = (UFunction*) UObject::GObjObjects()->Data[ 38999 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execCanViewPlayerProfiles_Parms CanViewPlayerProfiles_Parms;
 	CanViewPlayerProfiles_Parms.eLocalUserNum = eLocalUserNum;
@@ -12638,10 +12075,9 @@ unsigned char USFXOnlineComponentPlatformPC::CanViewPlayerProfiles ( unsigned ch
 
 unsigned char USFXOnlineComponentPlatformPC::CanPurchaseContent ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanPurchaseContent = NULL;
-
+	UFunction* pFnCanPurchaseContent = (UFunction*) SdkBindings::Get ( 3828 );
 	if ( ! pFnCanPurchaseContent )
-		pFnCanPurchaseContent = (UFunction*) UObject::GObjObjects()->Data[ 38996 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execCanPurchaseContent_Parms CanPurchaseContent_Parms;
 	CanPurchaseContent_Parms.eLocalUserNum = eLocalUserNum;
@@ -12663,10 +12099,9 @@ unsigned char USFXOnlineComponentPlatformPC::CanPurchaseContent ( unsigned char
 
 unsigned char USFXOnlineComponentPlatformPC::CanDownloadUserContent ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanDownloadUserContent = NULL;
-
+	UFunction* pFnCanDownloadUserContent = (UFunction*) SdkBindings::Get ( 3827 );
 	if ( ! pFnCanDownloadUserContent )
-		pFnCanDownloadUserContent = (UFunction*) UObject::GObjObjects()->Data[ 38993 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execCanDownloadUserContent_Parms CanDownloadUserContent_Parms;
 	CanDownloadUserContent_Parms.eLocalUserNum = eLocalUserNum;
@@ -12688,10 +12123,9 @@ unsigned char USFXOnlineComponentPlatformPC::CanDownloadUserContent ( unsigned c
 
 unsigned char USFXOnlineComponentPlatformPC::CanCommunicate ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanCommunicate = NULL;
-
+	UFunction* pFnCanCommunicate = (UFunction*) SdkBindings::Get ( 3826 );
 	if ( ! pFnCanCommunicate )
-		pFnCanCommunicate = (UFunction*) UObject::GObjObjects()->Data[ 38990 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execCanCommunicate_Parms CanCommunicate_Parms;
 	CanCommunicate_Parms.eLocalUserNum = eLocalUserNum;
@@ -12713,10 +12147,9 @@ unsigned char USFXOnlineComponentPlatformPC::CanCommunicate ( unsigned char eLoc
 
 unsigned char USFXOnlineComponentPlatformPC::CanPlayOnline ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanPlayOnline = NULL;
-
+	UFunction* pFnCanPlayOnline = (UFunction*) SdkBindings::Get ( 3825 );
 	if ( ! pFnCanPlayOnline )
-		pFnCanPlayOnline = (UFunction*) UObject::GObjObjects()->Data[ 38987 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execCanPlayOnline_Parms CanPlayOnline_Parms;
 	CanPlayOnline_Parms.eLocalUserNum = eLocalUserNum;
@@ -12740,10 +12173,9 @@ unsigned char USFXOnlineComponentPlatformPC::CanPlayOnline ( unsigned char eLoca
 
 void USFXOnlineComponentPlatformPC::SetRichPresence ( unsigned char eLocalUserNum, int nPresenceMode, TArray< struct FLocalizedStringSetting >* aLocalizedStringSettings, TArray< struct FSettingsProperty >* aProperties )
 {
-	static UFunction* pFnSetRichPresence = NULL;
-
+	UFunction* pFnSetRichPresence = (UFunction*) SdkBindings::Get ( 3824 );
 	if ( ! pFnSetRichPresence )
-		pFnSetRichPresence = (UFunction*) UObject::GObjObjects()->Data[ 38980 ];
+		return;
 
 	USFXOnlineComponentPlatformPC_execSetRichPresence_Parms SetRichPresence_Parms;
 	SetRichPresence_Parms.eLocalUserNum = eLocalUserNum;
@@ -12770,10 +12202,9 @@ void USFXOnlineComponentPlatformPC::SetRichPresence ( unsigned char eLocalUserNu
 
 bool USFXOnlineComponentPlatformPC::ShowLoginUI ( unsigned long bShowOnlineOnly )
 {
-	static UFunction* pFnShowLoginUI = NULL;
-
+	UFunction* pFnShowLoginUI = (UFunction*) SdkBindings::Get ( 3823 );
 	if ( ! pFnShowLoginUI )
-		pFnShowLoginUI = (UFunction*) UObject::GObjObjects()->Data[ 38977 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execShowLoginUI_Parms ShowLoginUI_Parms;
 	ShowLoginUI_Parms.bShowOnlineOnly = bShowOnlineOnly;
@@ -12795,10 +12226,9 @@ bool USFXOnlineComponentPlatformPC::ShowLoginUI ( unsigned long bShowOnlineOnly
 
 unsigned char USFXOnlineComponentPlatformPC::GetLoginStatus ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnGetLoginStatus = NULL;
-
+	UFunction* pFnGetLoginStatus = (UFunction*) SdkBindings::Get ( 3822 );
 	if ( ! pFnGetLoginStatus )
-		pFnGetLoginStatus = (UFunction*) UObject::GObjObjects()->Data[ 38974 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execGetLoginStatus_Parms GetLoginStatus_Parms;
 	GetLoginStatus_Parms.eLocalUserNum = eLocalUserNum;
@@ -12821,10 +12251,9 @@ unsigned char USFXOnlineComponentPlatformPC::GetLoginStatus ( unsigned char eLoc
 
 bool USFXOnlineComponentPlatformPC::AddRecentPlayer ( struct FUniqueNetId oPlayerId, struct FString sDescription )
 {
-	static UFunction* pFnAddRecentPlayer = NULL;
-
+	UFunction* pFnAddRecentPlayer = (UFunction*) SdkBindings::Get ( 3821 );
 	if ( ! pFnAddRecentPlayer )
-		pFnAddRecentPlayer = (UFunction*) UObject::GObjObjects()->Data[ 38970 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execAddRecentPlayer_Parms AddRecentPlayer_Parms;
 	memcpy ( &AddRecentPlayer_Parms.oPlayerId, &oPlayerId, 0x8 );
@@ -12846,10 +12275,9 @@ bool USFXOnlineComponentPlatformPC::AddRecentPlayer ( struct FUniqueNetId oPlaye
 
 struct FName USFXOnlineComponentPlatformPC::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3820 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 38968 ];
+		return {};
 
 	USFXOnlineComponentPlatformPC_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -12868,10 +12296,9 @@ struct FName USFXOnlineComponentPlatformPC::GetAPIName ( )
 
 void USFXOnlineComponentPlatformPC::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3819 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 38967 ];
+		return;
 
 	USFXOnlineComponentPlatformPC_execOnRelease_Parms OnRelease_Parms;
 
@@ -12889,10 +12316,9 @@ void USFXOnlineComponentPlatformPC::OnRelease ( )
 
 void USFXOnlineComponentPlatformPC::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3818 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 38965 ];
+		return;
 
 	USFXOnlineComponentPlatformPC_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -12911,10 +12337,9 @@ void USFXOnlineComponentPlatformPC::OnInitialize ( class USFXOnlineSubsystem* oO
 
 struct FName USFXOnlineComponentAchievementXenon::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3200 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 36543 ];
+		return {};
 
 	USFXOnlineComponentAchievementXenon_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -12933,10 +12358,9 @@ struct FName USFXOnlineComponentAchievementXenon::GetAPIName ( )
 
 void USFXOnlineComponentAchievementXenon::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3199 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 36542 ];
+		return;
 
 	USFXOnlineComponentAchievementXenon_execOnRelease_Parms OnRelease_Parms;
 
@@ -12954,10 +12378,9 @@ void USFXOnlineComponentAchievementXenon::OnRelease ( )
 
 void USFXOnlineComponentAchievementXenon::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3198 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 36540 ];
+		return;
 
 	USFXOnlineComponentAchievementXenon_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -12978,10 +12401,9 @@ void USFXOnlineComponentAchievementXenon::OnInitialize ( class USFXOnlineSubsyst
 
 bool USFXOnlineComponentAchievementXenon::IsGranted ( unsigned char LocalUserNum, int AchievementId )
 {
-	static UFunction* pFnIsGranted = NULL;
-
+	UFunction* pFnIsGranted = (UFunction*) SdkBindings::Get ( 3197 );
 	if ( ! pFnIsGranted )
-		pFnIsGranted = (UFunction*) UObject::GObjObjects()->Data[ 36536 ];
+		return {};
 
 	USFXOnlineComponentAchievementXenon_execIsGranted_Parms IsGranted_Parms;
 	IsGranted_Parms.LocalUserNum = LocalUserNum;
@@ -13004,10 +12426,9 @@ bool USFXOnlineComponentAchievementXenon::IsGranted ( unsigned char LocalUserNum
 
 void USFXOnlineComponentAchievementXenon::Grant ( unsigned char LocalUserNum, int AchievementId )
 {
-	static UFunction* pFnGrant = NULL;
-
+	UFunction* pFnGrant = (UFunction*) SdkBindings::Get ( 3196 );
 	if ( ! pFnGrant )
-		pFnGrant = (UFunction*) UObject::GObjObjects()->Data[ 36533 ];
+		return;
 
 	USFXOnlineComponentAchievementXenon_execGrant_Parms Grant_Parms;
 	Grant_Parms.LocalUserNum = LocalUserNum;
@@ -13027,10 +12448,9 @@ void USFXOnlineComponentAchievementXenon::Grant ( unsigned char LocalUserNum, in
 
 struct FName USFXOnlineComponentAvatarAwardXenon::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3204 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 36552 ];
+		return {};
 
 	USFXOnlineComponentAvatarAwardXenon_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -13049,10 +12469,9 @@ struct FName USFXOnlineComponentAvatarAwardXenon::GetAPIName ( )
 
 void USFXOnlineComponentAvatarAwardXenon::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3203 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 36551 ];
+		return;
 
 	USFXOnlineComponentAvatarAwardXenon_execOnRelease_Parms OnRelease_Parms;
 
@@ -13070,10 +12489,9 @@ void USFXOnlineComponentAvatarAwardXenon::OnRelease ( )
 
 void USFXOnlineComponentAvatarAwardXenon::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3202 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 36549 ];
+		return;
 
 	USFXOnlineComponentAvatarAwardXenon_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -13093,10 +12511,9 @@ void USFXOnlineComponentAvatarAwardXenon::OnInitialize ( class USFXOnlineSubsyst
 
 void USFXOnlineComponentAvatarAwardXenon::Grant ( unsigned char LocalUserNum, int AvatarAwardId )
 {
-	static UFunction* pFnGrant = NULL;
-
+	UFunction* pFnGrant = (UFunction*) SdkBindings::Get ( 3201 );
 	if ( ! pFnGrant )
-		pFnGrant = (UFunction*) UObject::GObjObjects()->Data[ 36546 ];
+		return;
 
 	USFXOnlineComponentAvatarAwardXenon_execGrant_Parms Grant_Parms;
 	Grant_Parms.LocalUserNum = LocalUserNum;
@@ -13116,10 +12533,9 @@ void USFXOnlineComponentAvatarAwardXenon::Grant ( unsigned char LocalUserNum, in
 
 bool USFXOnlineComponentPlatformXenon::ShowInbox ( )
 {
-	static UFunction* pFnShowInbox = NULL;
-
+	UFunction* pFnShowInbox = (UFunction*) SdkBindings::Get ( 3913 );
 	if ( ! pFnShowInbox )
-		pFnShowInbox = (UFunction*) UObject::GObjObjects()->Data[ 39324 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execShowInbox_Parms ShowInbox_Parms;
 
@@ -13139,10 +12555,9 @@ bool USFXOnlineComponentPlatformXenon::ShowInbox ( )
 
 bool USFXOnlineComponentPlatformXenon::ShowVoiceCommandTunerUI ( )
 {
-	static UFunction* pFnShowVoiceCommandTunerUI = NULL;
-
+	UFunction* pFnShowVoiceCommandTunerUI = (UFunction*) SdkBindings::Get ( 3912 );
 	if ( ! pFnShowVoiceCommandTunerUI )
-		pFnShowVoiceCommandTunerUI = (UFunction*) UObject::GObjObjects()->Data[ 39322 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execShowVoiceCommandTunerUI_Parms ShowVoiceCommandTunerUI_Parms;
 
@@ -13162,10 +12577,9 @@ bool USFXOnlineComponentPlatformXenon::ShowVoiceCommandTunerUI ( )
 
 int USFXOnlineComponentPlatformXenon::GetMinimumAgeForOnlinePlay ( )
 {
-	static UFunction* pFnGetMinimumAgeForOnlinePlay = NULL;
-
+	UFunction* pFnGetMinimumAgeForOnlinePlay = (UFunction*) SdkBindings::Get ( 3911 );
 	if ( ! pFnGetMinimumAgeForOnlinePlay )
-		pFnGetMinimumAgeForOnlinePlay = (UFunction*) UObject::GObjObjects()->Data[ 39320 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execGetMinimumAgeForOnlinePlay_Parms GetMinimumAgeForOnlinePlay_Parms;
 
@@ -13189,10 +12603,9 @@ int USFXOnlineComponentPlatformXenon::GetMinimumAgeForOnlinePlay ( )
 
 unsigned char USFXOnlineComponentPlatformXenon::GetFriendsList ( unsigned char LocalUserNum, int Count, int StartingAt, TArray< struct FOnlineFriend >* Friends )
 {
-	static UFunction* pFnGetFriendsList = NULL;
-
+	UFunction* pFnGetFriendsList = (UFunction*) SdkBindings::Get ( 3910 );
 	if ( ! pFnGetFriendsList )
-		pFnGetFriendsList = (UFunction*) UObject::GObjObjects()->Data[ 39313 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execGetFriendsList_Parms GetFriendsList_Parms;
 	GetFriendsList_Parms.LocalUserNum = LocalUserNum;
@@ -13221,10 +12634,9 @@ unsigned char USFXOnlineComponentPlatformXenon::GetFriendsList ( unsigned char L
 
 bool USFXOnlineComponentPlatformXenon::ReadFriendsList ( unsigned char LocalUserNum, int Count, int StartingAt )
 {
-	static UFunction* pFnReadFriendsList = NULL;
-
+	UFunction* pFnReadFriendsList = (UFunction*) SdkBindings::Get ( 3909 );
 	if ( ! pFnReadFriendsList )
-		pFnReadFriendsList = (UFunction*) UObject::GObjObjects()->Data[ 39308 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execReadFriendsList_Parms ReadFriendsList_Parms;
 	ReadFriendsList_Parms.LocalUserNum = LocalUserNum;
@@ -13247,10 +12659,9 @@ bool USFXOnlineComponentPlatformXenon::ReadFriendsList ( unsigned char LocalUser
 
 bool USFXOnlineComponentPlatformXenon::ShowStoreUI ( )
 {
-	static UFunction* pFnShowStoreUI = NULL;
-
+	UFunction* pFnShowStoreUI = (UFunction*) SdkBindings::Get ( 3908 );
 	if ( ! pFnShowStoreUI )
-		pFnShowStoreUI = (UFunction*) UObject::GObjObjects()->Data[ 39306 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execShowStoreUI_Parms ShowStoreUI_Parms;
 
@@ -13272,10 +12683,9 @@ bool USFXOnlineComponentPlatformXenon::ShowStoreUI ( )
 
 bool USFXOnlineComponentPlatformXenon::GetOnlineXuid ( int nUserIndex, struct FUniqueNetId* oPlayerXuid )
 {
-	static UFunction* pFnGetOnlineXuid = NULL;
-
+	UFunction* pFnGetOnlineXuid = (UFunction*) SdkBindings::Get ( 3907 );
 	if ( ! pFnGetOnlineXuid )
-		pFnGetOnlineXuid = (UFunction*) UObject::GObjObjects()->Data[ 39302 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execGetOnlineXuid_Parms GetOnlineXuid_Parms;
 	GetOnlineXuid_Parms.nUserIndex = nUserIndex;
@@ -13301,10 +12711,9 @@ bool USFXOnlineComponentPlatformXenon::GetOnlineXuid ( int nUserIndex, struct FU
 
 bool USFXOnlineComponentPlatformXenon::GetOfflineXuid ( int nUserIndex, struct FUniqueNetId* oPlayerXuid )
 {
-	static UFunction* pFnGetOfflineXuid = NULL;
-
+	UFunction* pFnGetOfflineXuid = (UFunction*) SdkBindings::Get ( 3906 );
 	if ( ! pFnGetOfflineXuid )
-		pFnGetOfflineXuid = (UFunction*) UObject::GObjObjects()->Data[ 39298 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execGetOfflineXuid_Parms GetOfflineXuid_Parms;
 	GetOfflineXuid_Parms.nUserIndex = nUserIndex;
@@ -13336,10 +12745,9 @@ bool USFXOnlineComponentPlatformXenon::GetOfflineXuid ( int nUserIndex, struct F
 
 bool USFXOnlineComponentPlatformXenon::ShowKeyboardUI ( unsigned char LocalUserNum, struct FString sTitleText, struct FString sDescriptionText, unsigned char nKeyboardType, unsigned long bShouldValidate, unsigned long bRouteThroughConsole, struct FString sDefaultText, int nMaxResultLength )
 {
-	static UFunction* pFnShowKeyboardUI = NULL;
-
+	UFunction* pFnShowKeyboardUI = (UFunction*) SdkBindings::Get ( 3905 );
 	if ( ! pFnShowKeyboardUI )
-		pFnShowKeyboardUI = (UFunction*) UObject::GObjObjects()->Data[ 39288 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execShowKeyboardUI_Parms ShowKeyboardUI_Parms;
 	ShowKeyboardUI_Parms.LocalUserNum = LocalUserNum;
@@ -13369,10 +12777,9 @@ bool USFXOnlineComponentPlatformXenon::ShowKeyboardUI ( unsigned char LocalUserN
 
 bool USFXOnlineComponentPlatformXenon::ShowInviteUI ( unsigned char LocalUserNum, struct FString InviteText )
 {
-	static UFunction* pFnShowInviteUI = NULL;
-
+	UFunction* pFnShowInviteUI = (UFunction*) SdkBindings::Get ( 3904 );
 	if ( ! pFnShowInviteUI )
-		pFnShowInviteUI = (UFunction*) UObject::GObjObjects()->Data[ 39284 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execShowInviteUI_Parms ShowInviteUI_Parms;
 	ShowInviteUI_Parms.LocalUserNum = LocalUserNum;
@@ -13396,10 +12803,9 @@ bool USFXOnlineComponentPlatformXenon::ShowInviteUI ( unsigned char LocalUserNum
 
 bool USFXOnlineComponentPlatformXenon::ShowFriendsInviteUI ( unsigned char eLocalUserNum, struct FUniqueNetId oPlayerXuid )
 {
-	static UFunction* pFnShowFriendsInviteUI = NULL;
-
+	UFunction* pFnShowFriendsInviteUI = (UFunction*) SdkBindings::Get ( 3903 );
 	if ( ! pFnShowFriendsInviteUI )
-		pFnShowFriendsInviteUI = (UFunction*) UObject::GObjObjects()->Data[ 39280 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execShowFriendsInviteUI_Parms ShowFriendsInviteUI_Parms;
 	ShowFriendsInviteUI_Parms.eLocalUserNum = eLocalUserNum;
@@ -13422,10 +12828,9 @@ bool USFXOnlineComponentPlatformXenon::ShowFriendsInviteUI ( unsigned char eLoca
 
 bool USFXOnlineComponentPlatformXenon::ShowFriendsUI ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnShowFriendsUI = NULL;
-
+	UFunction* pFnShowFriendsUI = (UFunction*) SdkBindings::Get ( 3902 );
 	if ( ! pFnShowFriendsUI )
-		pFnShowFriendsUI = (UFunction*) UObject::GObjObjects()->Data[ 39277 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execShowFriendsUI_Parms ShowFriendsUI_Parms;
 	ShowFriendsUI_Parms.eLocalUserNum = eLocalUserNum;
@@ -13447,10 +12852,9 @@ bool USFXOnlineComponentPlatformXenon::ShowFriendsUI ( unsigned char eLocalUserN
 
 bool USFXOnlineComponentPlatformXenon::ShowAchievementsUI ( unsigned char byLocalUserNum )
 {
-	static UFunction* pFnShowAchievementsUI = NULL;
-
+	UFunction* pFnShowAchievementsUI = (UFunction*) SdkBindings::Get ( 3901 );
 	if ( ! pFnShowAchievementsUI )
-		pFnShowAchievementsUI = (UFunction*) UObject::GObjObjects()->Data[ 39274 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execShowAchievementsUI_Parms ShowAchievementsUI_Parms;
 	ShowAchievementsUI_Parms.byLocalUserNum = byLocalUserNum;
@@ -13473,10 +12877,9 @@ bool USFXOnlineComponentPlatformXenon::ShowAchievementsUI ( unsigned char byLoca
 
 bool USFXOnlineComponentPlatformXenon::ShowFeedbackUI ( unsigned char eLocalUserNum, struct FUniqueNetId oPlayerXuid )
 {
-	static UFunction* pFnShowFeedbackUI = NULL;
-
+	UFunction* pFnShowFeedbackUI = (UFunction*) SdkBindings::Get ( 3900 );
 	if ( ! pFnShowFeedbackUI )
-		pFnShowFeedbackUI = (UFunction*) UObject::GObjObjects()->Data[ 39270 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execShowFeedbackUI_Parms ShowFeedbackUI_Parms;
 	ShowFeedbackUI_Parms.eLocalUserNum = eLocalUserNum;
@@ -13500,10 +12903,9 @@ bool USFXOnlineComponentPlatformXenon::ShowFeedbackUI ( unsigned char eLocalUser
 
 bool USFXOnlineComponentPlatformXenon::ShowGamerCardUI ( unsigned char eLocalUserNum, struct FUniqueNetId oUniqueNetId )
 {
-	static UFunction* pFnShowGamerCardUI = NULL;
-
+	UFunction* pFnShowGamerCardUI = (UFunction*) SdkBindings::Get ( 3899 );
 	if ( ! pFnShowGamerCardUI )
-		pFnShowGamerCardUI = (UFunction*) UObject::GObjObjects()->Data[ 39266 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execShowGamerCardUI_Parms ShowGamerCardUI_Parms;
 	ShowGamerCardUI_Parms.eLocalUserNum = eLocalUserNum;
@@ -13526,10 +12928,9 @@ bool USFXOnlineComponentPlatformXenon::ShowGamerCardUI ( unsigned char eLocalUse
 
 unsigned char USFXOnlineComponentPlatformXenon::CanShowPresenceInformation ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanShowPresenceInformation = NULL;
-
+	UFunction* pFnCanShowPresenceInformation = (UFunction*) SdkBindings::Get ( 3898 );
 	if ( ! pFnCanShowPresenceInformation )
-		pFnCanShowPresenceInformation = (UFunction*) UObject::GObjObjects()->Data[ 39263 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execCanShowPresenceInformation_Parms CanShowPresenceInformation_Parms;
 	CanShowPresenceInformation_Parms.eLocalUserNum = eLocalUserNum;
@@ -13551,10 +12952,9 @@ unsigned char USFXOnlineComponentPlatformXenon::CanShowPresenceInformation ( uns
 
 unsigned char USFXOnlineComponentPlatformXenon::CanViewPlayerProfiles ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanViewPlayerProfiles = NULL;
-
+	UFunction* pFnCanViewPlayerProfiles = (UFunction*) SdkBindings::Get ( 3897 );
 	if ( ! pFnCanViewPlayerProfiles )
-		pFnCanViewPlayerProfiles = (UFunction*) UObject::GObjObjects()->Data[ 39260 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execCanViewPlayerProfiles_Parms CanViewPlayerProfiles_Parms;
 	CanViewPlayerProfiles_Parms.eLocalUserNum = eLocalUserNum;
@@ -13576,10 +12976,9 @@ unsigned char USFXOnlineComponentPlatformXenon::CanViewPlayerProfiles ( unsigned
 
 unsigned char USFXOnlineComponentPlatformXenon::CanPurchaseContent ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanPurchaseContent = NULL;
-
+	UFunction* pFnCanPurchaseContent = (UFunction*) SdkBindings::Get ( 3896 );
 	if ( ! pFnCanPurchaseContent )
-		pFnCanPurchaseContent = (UFunction*) UObject::GObjObjects()->Data[ 39257 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execCanPurchaseContent_Parms CanPurchaseContent_Parms;
 	CanPurchaseContent_Parms.eLocalUserNum = eLocalUserNum;
@@ -13601,10 +13000,9 @@ unsigned char USFXOnlineComponentPlatformXenon::CanPurchaseContent ( unsigned ch
 
 unsigned char USFXOnlineComponentPlatformXenon::CanDownloadUserContent ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanDownloadUserContent = NULL;
-
+	UFunction* pFnCanDownloadUserContent = (UFunction*) SdkBindings::Get ( 3895 );
 	if ( ! pFnCanDownloadUserContent )
-		pFnCanDownloadUserContent = (UFunction*) UObject::GObjObjects()->Data[ 39254 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execCanDownloadUserContent_Parms CanDownloadUserContent_Parms;
 	CanDownloadUserContent_Parms.eLocalUserNum = eLocalUserNum;
@@ -13626,10 +13024,9 @@ unsigned char USFXOnlineComponentPlatformXenon::CanDownloadUserContent ( unsigne
 
 unsigned char USFXOnlineComponentPlatformXenon::CanCommunicate ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanCommunicate = NULL;
-
+	UFunction* pFnCanCommunicate = (UFunction*) SdkBindings::Get ( 3894 );
 	if ( ! pFnCanCommunicate )
-		pFnCanCommunicate = (UFunction*) UObject::GObjObjects()->Data[ 39251 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execCanCommunicate_Parms CanCommunicate_Parms;
 	CanCommunicate_Parms.eLocalUserNum = eLocalUserNum;
@@ -13651,10 +13048,9 @@ unsigned char USFXOnlineComponentPlatformXenon::CanCommunicate ( unsigned char e
 
 unsigned char USFXOnlineComponentPlatformXenon::CanPlayOnline ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanPlayOnline = NULL;
-
+	UFunction* pFnCanPlayOnline = (UFunction*) SdkBindings::Get ( 3893 );
 	if ( ! pFnCanPlayOnline )
-		pFnCanPlayOnline = (UFunction*) UObject::GObjObjects()->Data[ 39248 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execCanPlayOnline_Parms CanPlayOnline_Parms;
 	CanPlayOnline_Parms.eLocalUserNum = eLocalUserNum;
@@ -13678,10 +13074,9 @@ unsigned char USFXOnlineComponentPlatformXenon::CanPlayOnline ( unsigned char eL
 
 void USFXOnlineComponentPlatformXenon::SetRichPresence ( unsigned char eLocalUserNum, int nPresenceMode, TArray< struct FLocalizedStringSetting >* aLocalizedStringSettings, TArray< struct FSettingsProperty >* aProperties )
 {
-	static UFunction* pFnSetRichPresence = NULL;
-
+	UFunction* pFnSetRichPresence = (UFunction*) SdkBindings::Get ( 3892 );
 	if ( ! pFnSetRichPresence )
-		pFnSetRichPresence = (UFunction*) UObject::GObjObjects()->Data[ 39241 ];
+		return;
 
 	USFXOnlineComponentPlatformXenon_execSetRichPresence_Parms SetRichPresence_Parms;
 	SetRichPresence_Parms.eLocalUserNum = eLocalUserNum;
@@ -13708,10 +13103,9 @@ void USFXOnlineComponentPlatformXenon::SetRichPresence ( unsigned char eLocalUse
 
 bool USFXOnlineComponentPlatformXenon::ShowLoginUI ( unsigned long bShowOnlineOnly )
 {
-	static UFunction* pFnShowLoginUI = NULL;
-
+	UFunction* pFnShowLoginUI = (UFunction*) SdkBindings::Get ( 3891 );
 	if ( ! pFnShowLoginUI )
-		pFnShowLoginUI = (UFunction*) UObject::GObjObjects()->Data[ 39238 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execShowLoginUI_Parms ShowLoginUI_Parms;
 	ShowLoginUI_Parms.bShowOnlineOnly = bShowOnlineOnly;
@@ -13733,10 +13127,9 @@ bool USFXOnlineComponentPlatformXenon::ShowLoginUI ( unsigned long bShowOnlineOn
 
 unsigned char USFXOnlineComponentPlatformXenon::GetLoginStatus ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnGetLoginStatus = NULL;
-
+	UFunction* pFnGetLoginStatus = (UFunction*) SdkBindings::Get ( 3890 );
 	if ( ! pFnGetLoginStatus )
-		pFnGetLoginStatus = (UFunction*) UObject::GObjObjects()->Data[ 39235 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execGetLoginStatus_Parms GetLoginStatus_Parms;
 	GetLoginStatus_Parms.eLocalUserNum = eLocalUserNum;
@@ -13756,10 +13149,9 @@ unsigned char USFXOnlineComponentPlatformXenon::GetLoginStatus ( unsigned char e
 
 void USFXOnlineComponentPlatformXenon::TickAsyncTasks ( )
 {
-	static UFunction* pFnTickAsyncTasks = NULL;
-
+	UFunction* pFnTickAsyncTasks = (UFunction*) SdkBindings::Get ( 3889 );
 	if ( ! pFnTickAsyncTasks )
-		pFnTickAsyncTasks = (UFunction*) UObject::GObjObjects()->Data[ 39234 ];
+		return;
 
 	USFXOnlineComponentPlatformXenon_execTickAsyncTasks_Parms TickAsyncTasks_Parms;
 
@@ -13777,10 +13169,9 @@ void USFXOnlineComponentPlatformXenon::TickAsyncTasks ( )
 
 void USFXOnlineComponentPlatformXenon::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
-
+	UFunction* pFnOnTick = (UFunction*) SdkBindings::Get ( 3888 );
 	if ( ! pFnOnTick )
-		pFnOnTick = (UFunction*) UObject::GObjObjects()->Data[ 39232 ];
+		return;
 
 	USFXOnlineComponentPlatformXenon_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
@@ -13799,10 +13190,9 @@ void USFXOnlineComponentPlatformXenon::OnTick ( class USFXOnlineEvent* oEvent )
 
 bool USFXOnlineComponentPlatformXenon::eventIsPlayerInActiveParty ( )
 {
-	static UFunction* pFnIsPlayerInActiveParty = NULL;
-
+	UFunction* pFnIsPlayerInActiveParty = (UFunction*) SdkBindings::Get ( 3887 );
 	if ( ! pFnIsPlayerInActiveParty )
-		pFnIsPlayerInActiveParty = (UFunction*) UObject::GObjObjects()->Data[ 39230 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_eventIsPlayerInActiveParty_Parms IsPlayerInActiveParty_Parms;
 
@@ -13818,10 +13208,9 @@ bool USFXOnlineComponentPlatformXenon::eventIsPlayerInActiveParty ( )
 
 bool USFXOnlineComponentPlatformXenon::eventIsPlayerInParty ( )
 {
-	static UFunction* pFnIsPlayerInParty = NULL;
-
+	UFunction* pFnIsPlayerInParty = (UFunction*) SdkBindings::Get ( 3886 );
 	if ( ! pFnIsPlayerInParty )
-		pFnIsPlayerInParty = (UFunction*) UObject::GObjObjects()->Data[ 39227 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_eventIsPlayerInParty_Parms IsPlayerInParty_Parms;
 
@@ -13839,10 +13228,9 @@ bool USFXOnlineComponentPlatformXenon::eventIsPlayerInParty ( )
 
 bool USFXOnlineComponentPlatformXenon::AddRecentPlayer ( struct FUniqueNetId oPlayerId, struct FString sDescription )
 {
-	static UFunction* pFnAddRecentPlayer = NULL;
-
+	UFunction* pFnAddRecentPlayer = (UFunction*) SdkBindings::Get ( 3885 );
 	if ( ! pFnAddRecentPlayer )
-		pFnAddRecentPlayer = (UFunction*) UObject::GObjObjects()->Data[ 39223 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execAddRecentPlayer_Parms AddRecentPlayer_Parms;
 	memcpy ( &AddRecentPlayer_Parms.oPlayerId, &oPlayerId, 0x8 );
@@ -13864,10 +13252,9 @@ bool USFXOnlineComponentPlatformXenon::AddRecentPlayer ( struct FUniqueNetId oPl
 
 struct FName USFXOnlineComponentPlatformXenon::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3884 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 39221 ];
+		return {};
 
 	USFXOnlineComponentPlatformXenon_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -13886,10 +13273,9 @@ struct FName USFXOnlineComponentPlatformXenon::GetAPIName ( )
 
 void USFXOnlineComponentPlatformXenon::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3883 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 39220 ];
+		return;
 
 	USFXOnlineComponentPlatformXenon_execOnRelease_Parms OnRelease_Parms;
 
@@ -13907,10 +13293,9 @@ void USFXOnlineComponentPlatformXenon::OnRelease ( )
 
 void USFXOnlineComponentPlatformXenon::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3882 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 39218 ];
+		return;
 
 	USFXOnlineComponentPlatformXenon_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -13929,10 +13314,9 @@ void USFXOnlineComponentPlatformXenon::OnInitialize ( class USFXOnlineSubsystem*
 
 void USFXOnlineComponentXenonLiveParty::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
-
+	UFunction* pFnOnTick = (UFunction*) SdkBindings::Get ( 4153 );
 	if ( ! pFnOnTick )
-		pFnOnTick = (UFunction*) UObject::GObjObjects()->Data[ 40208 ];
+		return;
 
 	USFXOnlineComponentXenonLiveParty_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
@@ -13951,10 +13335,9 @@ void USFXOnlineComponentXenonLiveParty::OnTick ( class USFXOnlineEvent* oEvent )
 
 void USFXOnlineComponentXenonLiveParty::TickBandwidthTracking ( float DeltaTime )
 {
-	static UFunction* pFnTickBandwidthTracking = NULL;
-
+	UFunction* pFnTickBandwidthTracking = (UFunction*) SdkBindings::Get ( 4152 );
 	if ( ! pFnTickBandwidthTracking )
-		pFnTickBandwidthTracking = (UFunction*) UObject::GObjObjects()->Data[ 40206 ];
+		return;
 
 	USFXOnlineComponentXenonLiveParty_execTickBandwidthTracking_Parms TickBandwidthTracking_Parms;
 	TickBandwidthTracking_Parms.DeltaTime = DeltaTime;
@@ -13974,10 +13357,9 @@ void USFXOnlineComponentXenonLiveParty::TickBandwidthTracking ( float DeltaTime
 
 bool USFXOnlineComponentXenonLiveParty::ShowCommunitySessionsUI ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnShowCommunitySessionsUI = NULL;
-
+	UFunction* pFnShowCommunitySessionsUI = (UFunction*) SdkBindings::Get ( 4151 );
 	if ( ! pFnShowCommunitySessionsUI )
-		pFnShowCommunitySessionsUI = (UFunction*) UObject::GObjObjects()->Data[ 40203 ];
+		return {};
 
 	USFXOnlineComponentXenonLiveParty_execShowCommunitySessionsUI_Parms ShowCommunitySessionsUI_Parms;
 	ShowCommunitySessionsUI_Parms.LocalUserNum = LocalUserNum;
@@ -13999,10 +13381,9 @@ bool USFXOnlineComponentXenonLiveParty::ShowCommunitySessionsUI ( unsigned char
 
 bool USFXOnlineComponentXenonLiveParty::ShowVoiceChannelUI ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnShowVoiceChannelUI = NULL;
-
+	UFunction* pFnShowVoiceChannelUI = (UFunction*) SdkBindings::Get ( 4150 );
 	if ( ! pFnShowVoiceChannelUI )
-		pFnShowVoiceChannelUI = (UFunction*) UObject::GObjObjects()->Data[ 40200 ];
+		return {};
 
 	USFXOnlineComponentXenonLiveParty_execShowVoiceChannelUI_Parms ShowVoiceChannelUI_Parms;
 	ShowVoiceChannelUI_Parms.LocalUserNum = LocalUserNum;
@@ -14024,10 +13405,9 @@ bool USFXOnlineComponentXenonLiveParty::ShowVoiceChannelUI ( unsigned char Local
 
 bool USFXOnlineComponentXenonLiveParty::ShowPartyUI ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnShowPartyUI = NULL;
-
+	UFunction* pFnShowPartyUI = (UFunction*) SdkBindings::Get ( 4149 );
 	if ( ! pFnShowPartyUI )
-		pFnShowPartyUI = (UFunction*) UObject::GObjObjects()->Data[ 40197 ];
+		return {};
 
 	USFXOnlineComponentXenonLiveParty_execShowPartyUI_Parms ShowPartyUI_Parms;
 	ShowPartyUI_Parms.LocalUserNum = LocalUserNum;
@@ -14048,10 +13428,9 @@ bool USFXOnlineComponentXenonLiveParty::ShowPartyUI ( unsigned char LocalUserNum
 
 int USFXOnlineComponentXenonLiveParty::GetPartyBandwidth ( )
 {
-	static UFunction* pFnGetPartyBandwidth = NULL;
-
+	UFunction* pFnGetPartyBandwidth = (UFunction*) SdkBindings::Get ( 4148 );
 	if ( ! pFnGetPartyBandwidth )
-		pFnGetPartyBandwidth = (UFunction*) UObject::GObjObjects()->Data[ 40194 ];
+		return {};
 
 	USFXOnlineComponentXenonLiveParty_execGetPartyBandwidth_Parms GetPartyBandwidth_Parms;
 
@@ -14070,10 +13449,9 @@ int USFXOnlineComponentXenonLiveParty::GetPartyBandwidth ( )
 
 bool USFXOnlineComponentXenonLiveParty::SetPartyMemberCustomData ( unsigned char LocalUserNum, struct FQWord Data1, struct FQWord Data2 )
 {
-	static UFunction* pFnSetPartyMemberCustomData = NULL;
-
+	UFunction* pFnSetPartyMemberCustomData = (UFunction*) SdkBindings::Get ( 4147 );
 	if ( ! pFnSetPartyMemberCustomData )
-		pFnSetPartyMemberCustomData = (UFunction*) UObject::GObjObjects()->Data[ 40189 ];
+		return {};
 
 	USFXOnlineComponentXenonLiveParty_execSetPartyMemberCustomData_Parms SetPartyMemberCustomData_Parms;
 	SetPartyMemberCustomData_Parms.LocalUserNum = LocalUserNum;
@@ -14097,10 +13475,9 @@ bool USFXOnlineComponentXenonLiveParty::SetPartyMemberCustomData ( unsigned char
 
 bool USFXOnlineComponentXenonLiveParty::GetPartyMemberInformation ( TArray< struct FOnlinePartyMember >* PartyMembers )
 {
-	static UFunction* pFnGetPartyMemberInformation = NULL;
-
+	UFunction* pFnGetPartyMemberInformation = (UFunction*) SdkBindings::Get ( 4146 );
 	if ( ! pFnGetPartyMemberInformation )
-		pFnGetPartyMemberInformation = (UFunction*) UObject::GObjObjects()->Data[ 40185 ];
+		return {};
 
 	USFXOnlineComponentXenonLiveParty_execGetPartyMemberInformation_Parms GetPartyMemberInformation_Parms;
 
@@ -14124,10 +13501,9 @@ bool USFXOnlineComponentXenonLiveParty::GetPartyMemberInformation ( TArray< stru
 
 void USFXOnlineComponentXenonLiveParty::ClearSendPartyGameInvitesCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate SendPartyGameInvitesCompleteDelegate )
 {
-	static UFunction* pFnClearSendPartyGameInvitesCompleteDelegate = NULL;
-
+	UFunction* pFnClearSendPartyGameInvitesCompleteDelegate = (UFunction*) SdkBindings::Get ( 4145 );
 	if ( ! pFnClearSendPartyGameInvitesCompleteDelegate )
-		pFnClearSendPartyGameInvitesCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 40181 ];
+		return;
 
 	USFXOnlineComponentXenonLiveParty_execClearSendPartyGameInvitesCompleteDelegate_Parms ClearSendPartyGameInvitesCompleteDelegate_Parms;
 	ClearSendPartyGameInvitesCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -14144,10 +13520,9 @@ void USFXOnlineComponentXenonLiveParty::ClearSendPartyGameInvitesCompleteDelegat
 
 void USFXOnlineComponentXenonLiveParty::AddSendPartyGameInvitesCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate SendPartyGameInvitesCompleteDelegate )
 {
-	static UFunction* pFnAddSendPartyGameInvitesCompleteDelegate = NULL;
-
+	UFunction* pFnAddSendPartyGameInvitesCompleteDelegate = (UFunction*) SdkBindings::Get ( 4144 );
 	if ( ! pFnAddSendPartyGameInvitesCompleteDelegate )
-		pFnAddSendPartyGameInvitesCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 40177 ];
+		return;
 
 	USFXOnlineComponentXenonLiveParty_execAddSendPartyGameInvitesCompleteDelegate_Parms AddSendPartyGameInvitesCompleteDelegate_Parms;
 	AddSendPartyGameInvitesCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -14163,10 +13538,9 @@ void USFXOnlineComponentXenonLiveParty::AddSendPartyGameInvitesCompleteDelegate
 
 void USFXOnlineComponentXenonLiveParty::OnSendPartyGameInvitesComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnSendPartyGameInvitesComplete = NULL;
-
+	UFunction* pFnOnSendPartyGameInvitesComplete = (UFunction*) SdkBindings::Get ( 4139 );
 	if ( ! pFnOnSendPartyGameInvitesComplete )
-		pFnOnSendPartyGameInvitesComplete = (UFunction*) UObject::GObjObjects()->Data[ 40167 ];
+		return;
 
 	USFXOnlineComponentXenonLiveParty_execOnSendPartyGameInvitesComplete_Parms OnSendPartyGameInvitesComplete_Parms;
 	OnSendPartyGameInvitesComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -14182,10 +13556,9 @@ void USFXOnlineComponentXenonLiveParty::OnSendPartyGameInvitesComplete ( unsigne
 
 bool USFXOnlineComponentXenonLiveParty::SendPartyGameInvites ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnSendPartyGameInvites = NULL;
-
+	UFunction* pFnSendPartyGameInvites = (UFunction*) SdkBindings::Get ( 4143 );
 	if ( ! pFnSendPartyGameInvites )
-		pFnSendPartyGameInvites = (UFunction*) UObject::GObjObjects()->Data[ 40173 ];
+		return {};
 
 	USFXOnlineComponentXenonLiveParty_execSendPartyGameInvites_Parms SendPartyGameInvites_Parms;
 	SendPartyGameInvites_Parms.LocalUserNum = LocalUserNum;
@@ -14206,10 +13579,9 @@ bool USFXOnlineComponentXenonLiveParty::SendPartyGameInvites ( unsigned char Loc
 
 struct FName USFXOnlineComponentXenonLiveParty::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 4142 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 40171 ];
+		return {};
 
 	USFXOnlineComponentXenonLiveParty_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -14228,10 +13600,9 @@ struct FName USFXOnlineComponentXenonLiveParty::GetAPIName ( )
 
 void USFXOnlineComponentXenonLiveParty::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 4141 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 40170 ];
+		return;
 
 	USFXOnlineComponentXenonLiveParty_execOnRelease_Parms OnRelease_Parms;
 
@@ -14249,10 +13620,9 @@ void USFXOnlineComponentXenonLiveParty::OnRelease ( )
 
 void USFXOnlineComponentXenonLiveParty::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 4140 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 40168 ];
+		return;
 
 	USFXOnlineComponentXenonLiveParty_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -14271,10 +13641,9 @@ void USFXOnlineComponentXenonLiveParty::OnInitialize ( class USFXOnlineSubsystem
 
 struct FName USFXOnlineComponentAchievementPS3::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3195 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 36530 ];
+		return {};
 
 	USFXOnlineComponentAchievementPS3_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -14293,10 +13662,9 @@ struct FName USFXOnlineComponentAchievementPS3::GetAPIName ( )
 
 void USFXOnlineComponentAchievementPS3::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3194 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 36529 ];
+		return;
 
 	USFXOnlineComponentAchievementPS3_execOnRelease_Parms OnRelease_Parms;
 
@@ -14314,10 +13682,9 @@ void USFXOnlineComponentAchievementPS3::OnRelease ( )
 
 void USFXOnlineComponentAchievementPS3::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3193 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 36527 ];
+		return;
 
 	USFXOnlineComponentAchievementPS3_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -14338,10 +13705,9 @@ void USFXOnlineComponentAchievementPS3::OnInitialize ( class USFXOnlineSubsystem
 
 bool USFXOnlineComponentAchievementPS3::IsGranted ( unsigned char LocalUserNum, int AchievementId )
 {
-	static UFunction* pFnIsGranted = NULL;
-
+	UFunction* pFnIsGranted = (UFunction*) SdkBindings::Get ( 3192 );
 	if ( ! pFnIsGranted )
-		pFnIsGranted = (UFunction*) UObject::GObjObjects()->Data[ 36523 ];
+		return {};
 
 	USFXOnlineComponentAchievementPS3_execIsGranted_Parms IsGranted_Parms;
 	IsGranted_Parms.LocalUserNum = LocalUserNum;
@@ -14364,10 +13730,9 @@ bool USFXOnlineComponentAchievementPS3::IsGranted ( unsigned char LocalUserNum,
 
 void USFXOnlineComponentAchievementPS3::Grant ( unsigned char LocalUserNum, int AchievementId )
 {
-	static UFunction* pFnGrant = NULL;
-
+	UFunction* pFnGrant = (UFunction*) SdkBindings::Get ( 3191 );
 	if ( ! pFnGrant )
-		pFnGrant = (UFunction*) UObject::GObjObjects()->Data[ 36520 ];
+		return;
 
 	USFXOnlineComponentAchievementPS3_execGrant_Parms Grant_Parms;
 	Grant_Parms.LocalUserNum = LocalUserNum;
@@ -14387,10 +13752,9 @@ void USFXOnlineComponentAchievementPS3::Grant ( unsigned char LocalUserNum, int
 
 bool USFXOnlineComponentPlatformPS3::ShowInbox ( )
 {
-	static UFunction* pFnShowInbox = NULL;
-
+	UFunction* pFnShowInbox = (UFunction*) SdkBindings::Get ( 3881 );
 	if ( ! pFnShowInbox )
-		pFnShowInbox = (UFunction*) UObject::GObjObjects()->Data[ 39195 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execShowInbox_Parms ShowInbox_Parms;
 
@@ -14410,10 +13774,9 @@ bool USFXOnlineComponentPlatformPS3::ShowInbox ( )
 
 void USFXOnlineComponentPlatformPS3::StartInviteFlow ( int attachmentDataId )
 {
-	static UFunction* pFnStartInviteFlow = NULL;
-
+	UFunction* pFnStartInviteFlow = (UFunction*) SdkBindings::Get ( 3880 );
 	if ( ! pFnStartInviteFlow )
-		pFnStartInviteFlow = (UFunction*) UObject::GObjObjects()->Data[ 39193 ];
+		return;
 
 	USFXOnlineComponentPlatformPS3_execStartInviteFlow_Parms StartInviteFlow_Parms;
 	StartInviteFlow_Parms.attachmentDataId = attachmentDataId;
@@ -14433,10 +13796,9 @@ void USFXOnlineComponentPlatformPS3::StartInviteFlow ( int attachmentDataId )
 
 bool USFXOnlineComponentPlatformPS3::GetInviterUniqueNetId ( struct FUniqueNetId* InviterUniqueNetId )
 {
-	static UFunction* pFnGetInviterUniqueNetId = NULL;
-
+	UFunction* pFnGetInviterUniqueNetId = (UFunction*) SdkBindings::Get ( 3879 );
 	if ( ! pFnGetInviterUniqueNetId )
-		pFnGetInviterUniqueNetId = (UFunction*) UObject::GObjObjects()->Data[ 39190 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execGetInviterUniqueNetId_Parms GetInviterUniqueNetId_Parms;
 
@@ -14459,10 +13821,9 @@ bool USFXOnlineComponentPlatformPS3::GetInviterUniqueNetId ( struct FUniqueNetId
 
 bool USFXOnlineComponentPlatformPS3::ShowVoiceCommandTunerUI ( )
 {
-	static UFunction* pFnShowVoiceCommandTunerUI = NULL;
-
+	UFunction* pFnShowVoiceCommandTunerUI = (UFunction*) SdkBindings::Get ( 3878 );
 	if ( ! pFnShowVoiceCommandTunerUI )
-		pFnShowVoiceCommandTunerUI = (UFunction*) UObject::GObjObjects()->Data[ 39188 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execShowVoiceCommandTunerUI_Parms ShowVoiceCommandTunerUI_Parms;
 
@@ -14482,10 +13843,9 @@ bool USFXOnlineComponentPlatformPS3::ShowVoiceCommandTunerUI ( )
 
 int USFXOnlineComponentPlatformPS3::GetMinimumAgeForOnlinePlay ( )
 {
-	static UFunction* pFnGetMinimumAgeForOnlinePlay = NULL;
-
+	UFunction* pFnGetMinimumAgeForOnlinePlay = (UFunction*) SdkBindings::Get ( 3877 );
 	if ( ! pFnGetMinimumAgeForOnlinePlay )
-		pFnGetMinimumAgeForOnlinePlay = (UFunction*) UObject::GObjObjects()->Data[ 39186 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execGetMinimumAgeForOnlinePlay_Parms GetMinimumAgeForOnlinePlay_Parms;
 
@@ -14509,10 +13869,9 @@ int USFXOnlineComponentPlatformPS3::GetMinimumAgeForOnlinePlay ( )
 
 unsigned char USFXOnlineComponentPlatformPS3::GetFriendsList ( unsigned char LocalUserNum, int Count, int StartingAt, TArray< struct FOnlineFriend >* Friends )
 {
-	static UFunction* pFnGetFriendsList = NULL;
-
+	UFunction* pFnGetFriendsList = (UFunction*) SdkBindings::Get ( 3876 );
 	if ( ! pFnGetFriendsList )
-		pFnGetFriendsList = (UFunction*) UObject::GObjObjects()->Data[ 39179 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execGetFriendsList_Parms GetFriendsList_Parms;
 	GetFriendsList_Parms.LocalUserNum = LocalUserNum;
@@ -14541,10 +13900,9 @@ unsigned char USFXOnlineComponentPlatformPS3::GetFriendsList ( unsigned char Loc
 
 bool USFXOnlineComponentPlatformPS3::ReadFriendsList ( unsigned char LocalUserNum, int Count, int StartingAt )
 {
-	static UFunction* pFnReadFriendsList = NULL;
-
+	UFunction* pFnReadFriendsList = (UFunction*) SdkBindings::Get ( 3875 );
 	if ( ! pFnReadFriendsList )
-		pFnReadFriendsList = (UFunction*) UObject::GObjObjects()->Data[ 39174 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execReadFriendsList_Parms ReadFriendsList_Parms;
 	ReadFriendsList_Parms.LocalUserNum = LocalUserNum;
@@ -14567,10 +13925,9 @@ bool USFXOnlineComponentPlatformPS3::ReadFriendsList ( unsigned char LocalUserNu
 
 bool USFXOnlineComponentPlatformPS3::ShowStoreUI ( )
 {
-	static UFunction* pFnShowStoreUI = NULL;
-
+	UFunction* pFnShowStoreUI = (UFunction*) SdkBindings::Get ( 3874 );
 	if ( ! pFnShowStoreUI )
-		pFnShowStoreUI = (UFunction*) UObject::GObjObjects()->Data[ 39172 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execShowStoreUI_Parms ShowStoreUI_Parms;
 
@@ -14592,10 +13949,9 @@ bool USFXOnlineComponentPlatformPS3::ShowStoreUI ( )
 
 bool USFXOnlineComponentPlatformPS3::GetOnlineXuid ( int nUserIndex, struct FUniqueNetId* oPlayerXuid )
 {
-	static UFunction* pFnGetOnlineXuid = NULL;
-
+	UFunction* pFnGetOnlineXuid = (UFunction*) SdkBindings::Get ( 3873 );
 	if ( ! pFnGetOnlineXuid )
-		pFnGetOnlineXuid = (UFunction*) UObject::GObjObjects()->Data[ 39168 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execGetOnlineXuid_Parms GetOnlineXuid_Parms;
 	GetOnlineXuid_Parms.nUserIndex = nUserIndex;
@@ -14621,10 +13977,9 @@ bool USFXOnlineComponentPlatformPS3::GetOnlineXuid ( int nUserIndex, struct FUni
 
 bool USFXOnlineComponentPlatformPS3::GetOfflineXuid ( int nUserIndex, struct FUniqueNetId* oPlayerXuid )
 {
-	static UFunction* pFnGetOfflineXuid = NULL;
-
+	UFunction* pFnGetOfflineXuid = (UFunction*) SdkBindings::Get ( 3872 );
 	if ( ! pFnGetOfflineXuid )
-		pFnGetOfflineXuid = (UFunction*) UObject::GObjObjects()->Data[ 39164 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execGetOfflineXuid_Parms GetOfflineXuid_Parms;
 	GetOfflineXuid_Parms.nUserIndex = nUserIndex;
@@ -14656,10 +14011,9 @@ bool USFXOnlineComponentPlatformPS3::GetOfflineXuid ( int nUserIndex, struct FUn
 
 bool USFXOnlineComponentPlatformPS3::ShowKeyboardUI ( unsigned char LocalUserNum, struct FString sTitleText, struct FString sDescriptionText, unsigned char nKeyboardType, unsigned long bShouldValidate, unsigned long bRouteThroughConsole, struct FString sDefaultText, int nMaxResultLength )
 {
-	static UFunction* pFnShowKeyboardUI = NULL;
-
+	UFunction* pFnShowKeyboardUI = (UFunction*) SdkBindings::Get ( 3871 );
 	if ( ! pFnShowKeyboardUI )
-		pFnShowKeyboardUI = (UFunction*) UObject::GObjObjects()->Data[ 39154 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execShowKeyboardUI_Parms ShowKeyboardUI_Parms;
 	ShowKeyboardUI_Parms.LocalUserNum = LocalUserNum;
@@ -14689,10 +14043,9 @@ bool USFXOnlineComponentPlatformPS3::ShowKeyboardUI ( unsigned char LocalUserNum
 
 bool USFXOnlineComponentPlatformPS3::ShowInviteUI ( unsigned char LocalUserNum, struct FString InviteText )
 {
-	static UFunction* pFnShowInviteUI = NULL;
-
+	UFunction* pFnShowInviteUI = (UFunction*) SdkBindings::Get ( 3870 );
 	if ( ! pFnShowInviteUI )
-		pFnShowInviteUI = (UFunction*) UObject::GObjObjects()->Data[ 39150 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execShowInviteUI_Parms ShowInviteUI_Parms;
 	ShowInviteUI_Parms.LocalUserNum = LocalUserNum;
@@ -14716,10 +14069,9 @@ bool USFXOnlineComponentPlatformPS3::ShowInviteUI ( unsigned char LocalUserNum,
 
 bool USFXOnlineComponentPlatformPS3::ShowFriendsInviteUI ( unsigned char eLocalUserNum, struct FUniqueNetId oPlayerXuid )
 {
-	static UFunction* pFnShowFriendsInviteUI = NULL;
-
+	UFunction* pFnShowFriendsInviteUI = (UFunction*) SdkBindings::Get ( 3869 );
 	if ( ! pFnShowFriendsInviteUI )
-		pFnShowFriendsInviteUI = (UFunction*) UObject::GObjObjects()->Data[ 39146 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execShowFriendsInviteUI_Parms ShowFriendsInviteUI_Parms;
 	ShowFriendsInviteUI_Parms.eLocalUserNum = eLocalUserNum;
@@ -14742,10 +14094,9 @@ bool USFXOnlineComponentPlatformPS3::ShowFriendsInviteUI ( unsigned char eLocalU
 
 bool USFXOnlineComponentPlatformPS3::ShowFriendsUI ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnShowFriendsUI = NULL;
-
+	UFunction* pFnShowFriendsUI = (UFunction*) SdkBindings::Get ( 3868 );
 	if ( ! pFnShowFriendsUI )
-		pFnShowFriendsUI = (UFunction*) UObject::GObjObjects()->Data[ 39143 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execShowFriendsUI_Parms ShowFriendsUI_Parms;
 	ShowFriendsUI_Parms.eLocalUserNum = eLocalUserNum;
@@ -14767,10 +14118,9 @@ bool USFXOnlineComponentPlatformPS3::ShowFriendsUI ( unsigned char eLocalUserNum
 
 bool USFXOnlineComponentPlatformPS3::ShowAchievementsUI ( unsigned char byLocalUserNum )
 {
-	static UFunction* pFnShowAchievementsUI = NULL;
-
+	UFunction* pFnShowAchievementsUI = (UFunction*) SdkBindings::Get ( 3867 );
 	if ( ! pFnShowAchievementsUI )
-		pFnShowAchievementsUI = (UFunction*) UObject::GObjObjects()->Data[ 39140 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execShowAchievementsUI_Parms ShowAchievementsUI_Parms;
 	ShowAchievementsUI_Parms.byLocalUserNum = byLocalUserNum;
@@ -14793,10 +14143,9 @@ bool USFXOnlineComponentPlatformPS3::ShowAchievementsUI ( unsigned char byLocalU
 
 bool USFXOnlineComponentPlatformPS3::ShowFeedbackUI ( unsigned char eLocalUserNum, struct FUniqueNetId oPlayerId )
 {
-	static UFunction* pFnShowFeedbackUI = NULL;
-
+	UFunction* pFnShowFeedbackUI = (UFunction*) SdkBindings::Get ( 3866 );
 	if ( ! pFnShowFeedbackUI )
-		pFnShowFeedbackUI = (UFunction*) UObject::GObjObjects()->Data[ 39136 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execShowFeedbackUI_Parms ShowFeedbackUI_Parms;
 	ShowFeedbackUI_Parms.eLocalUserNum = eLocalUserNum;
@@ -14820,10 +14169,9 @@ bool USFXOnlineComponentPlatformPS3::ShowFeedbackUI ( unsigned char eLocalUserNu
 
 bool USFXOnlineComponentPlatformPS3::ShowGamerCardUI ( unsigned char eLocalUserNum, struct FUniqueNetId oPlayerId )
 {
-	static UFunction* pFnShowGamerCardUI = NULL;
-
+	UFunction* pFnShowGamerCardUI = (UFunction*) SdkBindings::Get ( 3865 );
 	if ( ! pFnShowGamerCardUI )
-		pFnShowGamerCardUI = (UFunction*) UObject::GObjObjects()->Data[ 39132 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execShowGamerCardUI_Parms ShowGamerCardUI_Parms;
 	ShowGamerCardUI_Parms.eLocalUserNum = eLocalUserNum;
@@ -14846,10 +14194,9 @@ bool USFXOnlineComponentPlatformPS3::ShowGamerCardUI ( unsigned char eLocalUserN
 
 unsigned char USFXOnlineComponentPlatformPS3::CanShowPresenceInformation ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanShowPresenceInformation = NULL;
-
+	UFunction* pFnCanShowPresenceInformation = (UFunction*) SdkBindings::Get ( 3864 );
 	if ( ! pFnCanShowPresenceInformation )
-		pFnCanShowPresenceInformation = (UFunction*) UObject::GObjObjects()->Data[ 39129 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execCanShowPresenceInformation_Parms CanShowPresenceInformation_Parms;
 	CanShowPresenceInformation_Parms.eLocalUserNum = eLocalUserNum;
@@ -14871,10 +14218,9 @@ unsigned char USFXOnlineComponentPlatformPS3::CanShowPresenceInformation ( unsig
 
 unsigned char USFXOnlineComponentPlatformPS3::CanViewPlayerProfiles ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanViewPlayerProfiles = NULL;
-
+	UFunction* pFnCanViewPlayerProfiles = (UFunction*) SdkBindings::Get ( 3863 );
 	if ( ! pFnCanViewPlayerProfiles )
-		pFnCanViewPlayerProfiles = (UFunction*) UObject::GObjObjects()->Data[ 39126 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execCanViewPlayerProfiles_Parms CanViewPlayerProfiles_Parms;
 	CanViewPlayerProfiles_Parms.eLocalUserNum = eLocalUserNum;
@@ -14896,10 +14242,9 @@ unsigned char USFXOnlineComponentPlatformPS3::CanViewPlayerProfiles ( unsigned c
 
 unsigned char USFXOnlineComponentPlatformPS3::CanPurchaseContent ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanPurchaseContent = NULL;
-
+	UFunction* pFnCanPurchaseContent = (UFunction*) SdkBindings::Get ( 3862 );
 	if ( ! pFnCanPurchaseContent )
-		pFnCanPurchaseContent = (UFunction*) UObject::GObjObjects()->Data[ 39123 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execCanPurchaseContent_Parms CanPurchaseContent_Parms;
 	CanPurchaseContent_Parms.eLocalUserNum = eLocalUserNum;
@@ -14921,10 +14266,9 @@ unsigned char USFXOnlineComponentPlatformPS3::CanPurchaseContent ( unsigned char
 
 unsigned char USFXOnlineComponentPlatformPS3::CanDownloadUserContent ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanDownloadUserContent = NULL;
-
+	UFunction* pFnCanDownloadUserContent = (UFunction*) SdkBindings::Get ( 3861 );
 	if ( ! pFnCanDownloadUserContent )
-		pFnCanDownloadUserContent = (UFunction*) UObject::GObjObjects()->Data[ 39120 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execCanDownloadUserContent_Parms CanDownloadUserContent_Parms;
 	CanDownloadUserContent_Parms.eLocalUserNum = eLocalUserNum;
@@ -14946,10 +14290,9 @@ unsigned char USFXOnlineComponentPlatformPS3::CanDownloadUserContent ( unsigned
 
 unsigned char USFXOnlineComponentPlatformPS3::CanCommunicate ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanCommunicate = NULL;
-
+	UFunction* pFnCanCommunicate = (UFunction*) SdkBindings::Get ( 3860 );
 	if ( ! pFnCanCommunicate )
-		pFnCanCommunicate = (UFunction*) UObject::GObjObjects()->Data[ 39117 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execCanCommunicate_Parms CanCommunicate_Parms;
 	CanCommunicate_Parms.eLocalUserNum = eLocalUserNum;
@@ -14971,10 +14314,9 @@ unsigned char USFXOnlineComponentPlatformPS3::CanCommunicate ( unsigned char eLo
 
 unsigned char USFXOnlineComponentPlatformPS3::CanPlayOnline ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanPlayOnline = NULL;
-
+	UFunction* pFnCanPlayOnline = (UFunction*) SdkBindings::Get ( 3859 );
 	if ( ! pFnCanPlayOnline )
-		pFnCanPlayOnline = (UFunction*) UObject::GObjObjects()->Data[ 39114 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execCanPlayOnline_Parms CanPlayOnline_Parms;
 	CanPlayOnline_Parms.eLocalUserNum = eLocalUserNum;
@@ -14998,10 +14340,9 @@ unsigned char USFXOnlineComponentPlatformPS3::CanPlayOnline ( unsigned char eLoc
 
 void USFXOnlineComponentPlatformPS3::SetRichPresence ( unsigned char eLocalUserNum, int nPresenceMode, TArray< struct FLocalizedStringSetting >* aLocalizedStringSettings, TArray< struct FSettingsProperty >* aProperties )
 {
-	static UFunction* pFnSetRichPresence = NULL;
-
+	UFunction* pFnSetRichPresence = (UFunction*) SdkBindings::Get ( 3858 );
 	if ( ! pFnSetRichPresence )
-		pFnSetRichPresence = (UFunction*) UObject::GObjObjects()->Data[ 39107 ];
+		return;
 
 	USFXOnlineComponentPlatformPS3_execSetRichPresence_Parms SetRichPresence_Parms;
 	SetRichPresence_Parms.eLocalUserNum = eLocalUserNum;
@@ -15028,10 +14369,9 @@ void USFXOnlineComponentPlatformPS3::SetRichPresence ( unsigned char eLocalUserN
 
 bool USFXOnlineComponentPlatformPS3::ShowLoginUIEx ( struct FScriptDelegate funcSignInComplete )
 {
-	static UFunction* pFnShowLoginUIEx = NULL;
-
+	UFunction* pFnShowLoginUIEx = (UFunction*) SdkBindings::Get ( 3454 );
 	if ( ! pFnShowLoginUIEx )
-		pFnShowLoginUIEx = (UFunction*) UObject::GObjObjects()->Data[ 37481 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execShowLoginUIEx_Parms ShowLoginUIEx_Parms;
 	memcpy ( &ShowLoginUIEx_Parms.funcSignInComplete, &funcSignInComplete, 0xC );
@@ -15052,10 +14392,9 @@ bool USFXOnlineComponentPlatformPS3::ShowLoginUIEx ( struct FScriptDelegate func
 
 void USFXOnlineComponentPlatformPS3::OnSignInComplete ( unsigned long bSignedIn )
 {
-	static UFunction* pFnOnSignInComplete = NULL;
-
+	UFunction* pFnOnSignInComplete = (UFunction*) SdkBindings::Get ( 3857 );
 	if ( ! pFnOnSignInComplete )
-		pFnOnSignInComplete = (UFunction*) UObject::GObjObjects()->Data[ 39104 ];
+		return;
 
 	USFXOnlineComponentPlatformPS3_execOnSignInComplete_Parms OnSignInComplete_Parms;
 	OnSignInComplete_Parms.bSignedIn = bSignedIn;
@@ -15071,10 +14410,9 @@ void USFXOnlineComponentPlatformPS3::OnSignInComplete ( unsigned long bSignedIn
 
 bool USFXOnlineComponentPlatformPS3::ShowLoginUI ( unsigned long bShowOnlineOnly )
 {
-	static UFunction* pFnShowLoginUI = NULL;
-
+	UFunction* pFnShowLoginUI = (UFunction*) SdkBindings::Get ( 3856 );
 	if ( ! pFnShowLoginUI )
-		pFnShowLoginUI = (UFunction*) UObject::GObjObjects()->Data[ 39101 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execShowLoginUI_Parms ShowLoginUI_Parms;
 	ShowLoginUI_Parms.bShowOnlineOnly = bShowOnlineOnly;
@@ -15096,10 +14434,9 @@ bool USFXOnlineComponentPlatformPS3::ShowLoginUI ( unsigned long bShowOnlineOnly
 
 unsigned char USFXOnlineComponentPlatformPS3::GetLoginStatus ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnGetLoginStatus = NULL;
-
+	UFunction* pFnGetLoginStatus = (UFunction*) SdkBindings::Get ( 3855 );
 	if ( ! pFnGetLoginStatus )
-		pFnGetLoginStatus = (UFunction*) UObject::GObjObjects()->Data[ 39098 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execGetLoginStatus_Parms GetLoginStatus_Parms;
 	GetLoginStatus_Parms.eLocalUserNum = eLocalUserNum;
@@ -15122,10 +14459,9 @@ unsigned char USFXOnlineComponentPlatformPS3::GetLoginStatus ( unsigned char eLo
 
 bool USFXOnlineComponentPlatformPS3::AddRecentPlayer ( struct FUniqueNetId oPlayerId, struct FString sDescription )
 {
-	static UFunction* pFnAddRecentPlayer = NULL;
-
+	UFunction* pFnAddRecentPlayer = (UFunction*) SdkBindings::Get ( 3854 );
 	if ( ! pFnAddRecentPlayer )
-		pFnAddRecentPlayer = (UFunction*) UObject::GObjObjects()->Data[ 39094 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execAddRecentPlayer_Parms AddRecentPlayer_Parms;
 	memcpy ( &AddRecentPlayer_Parms.oPlayerId, &oPlayerId, 0x8 );
@@ -15146,10 +14482,9 @@ bool USFXOnlineComponentPlatformPS3::AddRecentPlayer ( struct FUniqueNetId oPlay
 
 void USFXOnlineComponentPlatformPS3::DispatchInviteEvent ( )
 {
-	static UFunction* pFnDispatchInviteEvent = NULL;
-
+	UFunction* pFnDispatchInviteEvent = (UFunction*) SdkBindings::Get ( 3853 );
 	if ( ! pFnDispatchInviteEvent )
-		pFnDispatchInviteEvent = (UFunction*) UObject::GObjObjects()->Data[ 39093 ];
+		return;
 
 	USFXOnlineComponentPlatformPS3_execDispatchInviteEvent_Parms DispatchInviteEvent_Parms;
 
@@ -15167,10 +14502,9 @@ void USFXOnlineComponentPlatformPS3::DispatchInviteEvent ( )
 
 void USFXOnlineComponentPlatformPS3::OnPlayerSeen ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnPlayerSeen = NULL;
-
+	UFunction* pFnOnPlayerSeen = (UFunction*) SdkBindings::Get ( 3852 );
 	if ( ! pFnOnPlayerSeen )
-		pFnOnPlayerSeen = (UFunction*) UObject::GObjObjects()->Data[ 39091 ];
+		return;
 
 	USFXOnlineComponentPlatformPS3_execOnPlayerSeen_Parms OnPlayerSeen_Parms;
 	OnPlayerSeen_Parms.oEvent = oEvent;
@@ -15189,10 +14523,9 @@ void USFXOnlineComponentPlatformPS3::OnPlayerSeen ( class USFXOnlineEvent* oEven
 
 void USFXOnlineComponentPlatformPS3::OnKeyboardUI ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnKeyboardUI = NULL;
-
+	UFunction* pFnOnKeyboardUI = (UFunction*) SdkBindings::Get ( 3851 );
 	if ( ! pFnOnKeyboardUI )
-		pFnOnKeyboardUI = (UFunction*) UObject::GObjObjects()->Data[ 39089 ];
+		return;
 
 	USFXOnlineComponentPlatformPS3_execOnKeyboardUI_Parms OnKeyboardUI_Parms;
 	OnKeyboardUI_Parms.oEvent = oEvent;
@@ -15211,10 +14544,9 @@ void USFXOnlineComponentPlatformPS3::OnKeyboardUI ( class USFXOnlineEvent* oEven
 
 void USFXOnlineComponentPlatformPS3::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
-
+	UFunction* pFnOnTick = (UFunction*) SdkBindings::Get ( 3850 );
 	if ( ! pFnOnTick )
-		pFnOnTick = (UFunction*) UObject::GObjObjects()->Data[ 39087 ];
+		return;
 
 	USFXOnlineComponentPlatformPS3_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
@@ -15233,10 +14565,9 @@ void USFXOnlineComponentPlatformPS3::OnTick ( class USFXOnlineEvent* oEvent )
 
 struct FName USFXOnlineComponentPlatformPS3::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3849 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 39085 ];
+		return {};
 
 	USFXOnlineComponentPlatformPS3_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -15255,10 +14586,9 @@ struct FName USFXOnlineComponentPlatformPS3::GetAPIName ( )
 
 void USFXOnlineComponentPlatformPS3::RegisterPS3CustomMenuActions ( )
 {
-	static UFunction* pFnRegisterPS3CustomMenuActions = NULL;
-
+	UFunction* pFnRegisterPS3CustomMenuActions = (UFunction*) SdkBindings::Get ( 3848 );
 	if ( ! pFnRegisterPS3CustomMenuActions )
-		pFnRegisterPS3CustomMenuActions = (UFunction*) UObject::GObjObjects()->Data[ 39084 ];
+		return;
 
 	USFXOnlineComponentPlatformPS3_execRegisterPS3CustomMenuActions_Parms RegisterPS3CustomMenuActions_Parms;
 
@@ -15275,10 +14605,9 @@ void USFXOnlineComponentPlatformPS3::RegisterPS3CustomMenuActions ( )
 
 void USFXOnlineComponentPlatformPS3::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3847 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 39083 ];
+		return;
 
 	USFXOnlineComponentPlatformPS3_execOnRelease_Parms OnRelease_Parms;
 
@@ -15296,10 +14625,9 @@ void USFXOnlineComponentPlatformPS3::OnRelease ( )
 
 void USFXOnlineComponentPlatformPS3::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3846 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 39081 ];
+		return;
 
 	USFXOnlineComponentPlatformPS3_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -15318,10 +14646,9 @@ void USFXOnlineComponentPlatformPS3::OnInitialize ( class USFXOnlineSubsystem* o
 
 bool USFXOnlineComponentBlaze::eventIsXbox360 ( )
 {
-	static UFunction* pFnIsXbox360 = NULL;
-
+	UFunction* pFnIsXbox360 = (UFunction*) SdkBindings::Get ( 3190 );
 	if ( ! pFnIsXbox360 )
-		pFnIsXbox360 = (UFunction*) UObject::GObjObjects()->Data[ 36514 ];
+		return {};
 
 	USFXOnlineComponentBlaze_eventIsXbox360_Parms IsXbox360_Parms;
 
@@ -15337,10 +14664,9 @@ bool USFXOnlineComponentBlaze::eventIsXbox360 ( )
 
 bool USFXOnlineComponentBlaze::eventIsPS3 ( )
 {
-	static UFunction* pFnIsPS3 = NULL;
-
+	UFunction* pFnIsPS3 = (UFunction*) SdkBindings::Get ( 3189 );
 	if ( ! pFnIsPS3 )
-		pFnIsPS3 = (UFunction*) UObject::GObjObjects()->Data[ 36512 ];
+		return {};
 
 	USFXOnlineComponentBlaze_eventIsPS3_Parms IsPS3_Parms;
 
@@ -15356,10 +14682,9 @@ bool USFXOnlineComponentBlaze::eventIsPS3 ( )
 
 bool USFXOnlineComponentBlaze::eventIsConsole ( )
 {
-	static UFunction* pFnIsConsole = NULL;
-
+	UFunction* pFnIsConsole = (UFunction*) SdkBindings::Get ( 3188 );
 	if ( ! pFnIsConsole )
-		pFnIsConsole = (UFunction*) UObject::GObjObjects()->Data[ 36510 ];
+		return {};
 
 	USFXOnlineComponentBlaze_eventIsConsole_Parms IsConsole_Parms;
 
@@ -15377,10 +14702,9 @@ bool USFXOnlineComponentBlaze::eventIsConsole ( )
 
 bool USFXOnlineComponentBlaze::GetAllPendingEvents ( unsigned char eEventType, TArray< class USFXOnlineEvent* >* aPendingEvents )
 {
-	static UFunction* pFnGetAllPendingEvents = NULL;
-
+	UFunction* pFnGetAllPendingEvents = (UFunction*) SdkBindings::Get ( 3187 );
 	if ( ! pFnGetAllPendingEvents )
-		pFnGetAllPendingEvents = (UFunction*) UObject::GObjObjects()->Data[ 36505 ];
+		return {};
 
 	USFXOnlineComponentBlaze_execGetAllPendingEvents_Parms GetAllPendingEvents_Parms;
 	GetAllPendingEvents_Parms.eEventType = eEventType;
@@ -15405,10 +14729,9 @@ bool USFXOnlineComponentBlaze::GetAllPendingEvents ( unsigned char eEventType, T
 
 bool USFXOnlineComponentBlaze::IsAnyEventPending ( unsigned char eEventType )
 {
-	static UFunction* pFnIsAnyEventPending = NULL;
-
+	UFunction* pFnIsAnyEventPending = (UFunction*) SdkBindings::Get ( 3186 );
 	if ( ! pFnIsAnyEventPending )
-		pFnIsAnyEventPending = (UFunction*) UObject::GObjObjects()->Data[ 36502 ];
+		return {};
 
 	USFXOnlineComponentBlaze_execIsAnyEventPending_Parms IsAnyEventPending_Parms;
 	IsAnyEventPending_Parms.eEventType = eEventType;
@@ -15431,10 +14754,9 @@ bool USFXOnlineComponentBlaze::IsAnyEventPending ( unsigned char eEventType )
 
 bool USFXOnlineComponentBlaze::IsEventPending ( unsigned char eEventType, int nEventID )
 {
-	static UFunction* pFnIsEventPending = NULL;
-
+	UFunction* pFnIsEventPending = (UFunction*) SdkBindings::Get ( 3185 );
 	if ( ! pFnIsEventPending )
-		pFnIsEventPending = (UFunction*) UObject::GObjObjects()->Data[ 36498 ];
+		return {};
 
 	USFXOnlineComponentBlaze_execIsEventPending_Parms IsEventPending_Parms;
 	IsEventPending_Parms.eEventType = eEventType;
@@ -15458,10 +14780,9 @@ bool USFXOnlineComponentBlaze::IsEventPending ( unsigned char eEventType, int nE
 
 class USFXOnlineEvent* USFXOnlineComponentBlaze::GetEvent ( unsigned char eEventType, int nEventID )
 {
-	static UFunction* pFnGetEvent = NULL;
-
+	UFunction* pFnGetEvent = (UFunction*) SdkBindings::Get ( 3184 );
 	if ( ! pFnGetEvent )
-		pFnGetEvent = (UFunction*) UObject::GObjObjects()->Data[ 36494 ];
+		return {};
 
 	USFXOnlineComponentBlaze_execGetEvent_Parms GetEvent_Parms;
 	GetEvent_Parms.eEventType = eEventType;
@@ -15484,10 +14805,9 @@ class USFXOnlineEvent* USFXOnlineComponentBlaze::GetEvent ( unsigned char eEvent
 
 void USFXOnlineComponentBlaze::WaitingForWorkSetObject ( TArray< class USFXOnlineEvent* > aOnlineEventSet, struct FScriptDelegate fnWorkComplete )
 {
-	static UFunction* pFnWaitingForWorkSetObject = NULL;
-
+	UFunction* pFnWaitingForWorkSetObject = (UFunction*) SdkBindings::Get ( 3183 );
 	if ( ! pFnWaitingForWorkSetObject )
-		pFnWaitingForWorkSetObject = (UFunction*) UObject::GObjObjects()->Data[ 36490 ];
+		return;
 
 	USFXOnlineComponentBlaze_execWaitingForWorkSetObject_Parms WaitingForWorkSetObject_Parms;
 	memcpy ( &WaitingForWorkSetObject_Parms.aOnlineEventSet, &aOnlineEventSet, 0xC );
@@ -15508,10 +14828,9 @@ void USFXOnlineComponentBlaze::WaitingForWorkSetObject ( TArray< class USFXOnlin
 
 void USFXOnlineComponentBlaze::WaitingForWorkSetType ( TArray< unsigned char > aWorkUnits, struct FScriptDelegate fnWorkComplete )
 {
-	static UFunction* pFnWaitingForWorkSetType = NULL;
-
+	UFunction* pFnWaitingForWorkSetType = (UFunction*) SdkBindings::Get ( 3182 );
 	if ( ! pFnWaitingForWorkSetType )
-		pFnWaitingForWorkSetType = (UFunction*) UObject::GObjObjects()->Data[ 36486 ];
+		return;
 
 	USFXOnlineComponentBlaze_execWaitingForWorkSetType_Parms WaitingForWorkSetType_Parms;
 	memcpy ( &WaitingForWorkSetType_Parms.aWorkUnits, &aWorkUnits, 0xC );
@@ -15532,10 +14851,9 @@ void USFXOnlineComponentBlaze::WaitingForWorkSetType ( TArray< unsigned char > a
 
 void USFXOnlineComponentBlaze::WaitingForWorkObject ( class USFXOnlineEvent* oEvent, struct FScriptDelegate fnWorkComplete )
 {
-	static UFunction* pFnWaitingForWorkObject = NULL;
-
+	UFunction* pFnWaitingForWorkObject = (UFunction*) SdkBindings::Get ( 3181 );
 	if ( ! pFnWaitingForWorkObject )
-		pFnWaitingForWorkObject = (UFunction*) UObject::GObjObjects()->Data[ 36483 ];
+		return;
 
 	USFXOnlineComponentBlaze_execWaitingForWorkObject_Parms WaitingForWorkObject_Parms;
 	WaitingForWorkObject_Parms.oEvent = oEvent;
@@ -15557,10 +14875,9 @@ void USFXOnlineComponentBlaze::WaitingForWorkObject ( class USFXOnlineEvent* oEv
 
 void USFXOnlineComponentBlaze::WaitingForWorkType ( unsigned char eWork, struct FScriptDelegate fnWorkComplete, int nEventID )
 {
-	static UFunction* pFnWaitingForWorkType = NULL;
-
+	UFunction* pFnWaitingForWorkType = (UFunction*) SdkBindings::Get ( 3180 );
 	if ( ! pFnWaitingForWorkType )
-		pFnWaitingForWorkType = (UFunction*) UObject::GObjObjects()->Data[ 36479 ];
+		return;
 
 	USFXOnlineComponentBlaze_execWaitingForWorkType_Parms WaitingForWorkType_Parms;
 	WaitingForWorkType_Parms.eWork = eWork;
@@ -15582,10 +14899,9 @@ void USFXOnlineComponentBlaze::WaitingForWorkType ( unsigned char eWork, struct
 
 void USFXOnlineComponentBlaze::NotifyWorkFinishedObject ( class USFXOnlineEvent* oEvent, unsigned char eStatusFinished )
 {
-	static UFunction* pFnNotifyWorkFinishedObject = NULL;
-
+	UFunction* pFnNotifyWorkFinishedObject = (UFunction*) SdkBindings::Get ( 3179 );
 	if ( ! pFnNotifyWorkFinishedObject )
-		pFnNotifyWorkFinishedObject = (UFunction*) UObject::GObjObjects()->Data[ 36476 ];
+		return;
 
 	USFXOnlineComponentBlaze_execNotifyWorkFinishedObject_Parms NotifyWorkFinishedObject_Parms;
 	NotifyWorkFinishedObject_Parms.oEvent = oEvent;
@@ -15607,10 +14923,9 @@ void USFXOnlineComponentBlaze::NotifyWorkFinishedObject ( class USFXOnlineEvent*
 
 void USFXOnlineComponentBlaze::NotifyWorkFinishedType ( unsigned char eWork, unsigned char eStatusFinished, int nEventID )
 {
-	static UFunction* pFnNotifyWorkFinishedType = NULL;
-
+	UFunction* pFnNotifyWorkFinishedType = (UFunction*) SdkBindings::Get ( 3178 );
 	if ( ! pFnNotifyWorkFinishedType )
-		pFnNotifyWorkFinishedType = (UFunction*) UObject::GObjObjects()->Data[ 36472 ];
+		return;
 
 	USFXOnlineComponentBlaze_execNotifyWorkFinishedType_Parms NotifyWorkFinishedType_Parms;
 	NotifyWorkFinishedType_Parms.eWork = eWork;
@@ -15633,10 +14948,9 @@ void USFXOnlineComponentBlaze::NotifyWorkFinishedType ( unsigned char eWork, uns
 
 void USFXOnlineComponentBlaze::NotifyWorkStartedObject ( class USFXOnlineEvent* oEvent, unsigned char eEventType, float TimeOut )
 {
-	static UFunction* pFnNotifyWorkStartedObject = NULL;
-
+	UFunction* pFnNotifyWorkStartedObject = (UFunction*) SdkBindings::Get ( 3177 );
 	if ( ! pFnNotifyWorkStartedObject )
-		pFnNotifyWorkStartedObject = (UFunction*) UObject::GObjObjects()->Data[ 36468 ];
+		return;
 
 	USFXOnlineComponentBlaze_execNotifyWorkStartedObject_Parms NotifyWorkStartedObject_Parms;
 	NotifyWorkStartedObject_Parms.oEvent = oEvent;
@@ -15659,10 +14973,9 @@ void USFXOnlineComponentBlaze::NotifyWorkStartedObject ( class USFXOnlineEvent*
 
 void USFXOnlineComponentBlaze::NotifyWorkStartedType ( unsigned char eWork, int nEventID, float fTimeOut )
 {
-	static UFunction* pFnNotifyWorkStartedType = NULL;
-
+	UFunction* pFnNotifyWorkStartedType = (UFunction*) SdkBindings::Get ( 3176 );
 	if ( ! pFnNotifyWorkStartedType )
-		pFnNotifyWorkStartedType = (UFunction*) UObject::GObjObjects()->Data[ 36464 ];
+		return;
 
 	USFXOnlineComponentBlaze_execNotifyWorkStartedType_Parms NotifyWorkStartedType_Parms;
 	NotifyWorkStartedType_Parms.eWork = eWork;
@@ -15683,10 +14996,9 @@ void USFXOnlineComponentBlaze::NotifyWorkStartedType ( unsigned char eWork, int
 
 void USFXOnlineComponentBlaze::NotifyEventObject ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnNotifyEventObject = NULL;
-
+	UFunction* pFnNotifyEventObject = (UFunction*) SdkBindings::Get ( 3175 );
 	if ( ! pFnNotifyEventObject )
-		pFnNotifyEventObject = (UFunction*) UObject::GObjObjects()->Data[ 36462 ];
+		return;
 
 	USFXOnlineComponentBlaze_execNotifyEventObject_Parms NotifyEventObject_Parms;
 	NotifyEventObject_Parms.oEvent = oEvent;
@@ -15707,10 +15019,9 @@ void USFXOnlineComponentBlaze::NotifyEventObject ( class USFXOnlineEvent* oEvent
 
 void USFXOnlineComponentBlaze::NotifyEventType ( unsigned char eEventType, unsigned char eStatus, unsigned char eOutcome )
 {
-	static UFunction* pFnNotifyEventType = NULL;
-
+	UFunction* pFnNotifyEventType = (UFunction*) SdkBindings::Get ( 3174 );
 	if ( ! pFnNotifyEventType )
-		pFnNotifyEventType = (UFunction*) UObject::GObjObjects()->Data[ 36458 ];
+		return;
 
 	USFXOnlineComponentBlaze_execNotifyEventType_Parms NotifyEventType_Parms;
 	NotifyEventType_Parms.eEventType = eEventType;
@@ -15731,10 +15042,9 @@ void USFXOnlineComponentBlaze::NotifyEventType ( unsigned char eEventType, unsig
 
 void USFXOnlineComponentBlaze::StopWaitingForAllWork ( class UObject* oCallbackTarget )
 {
-	static UFunction* pFnStopWaitingForAllWork = NULL;
-
+	UFunction* pFnStopWaitingForAllWork = (UFunction*) SdkBindings::Get ( 3173 );
 	if ( ! pFnStopWaitingForAllWork )
-		pFnStopWaitingForAllWork = (UFunction*) UObject::GObjObjects()->Data[ 36456 ];
+		return;
 
 	USFXOnlineComponentBlaze_execStopWaitingForAllWork_Parms StopWaitingForAllWork_Parms;
 	StopWaitingForAllWork_Parms.oCallbackTarget = oCallbackTarget;
@@ -15753,10 +15063,9 @@ void USFXOnlineComponentBlaze::StopWaitingForAllWork ( class UObject* oCallbackT
 
 void USFXOnlineComponentBlaze::UnsubscribeFromAllEvents ( class UObject* oCallbackTarget )
 {
-	static UFunction* pFnUnsubscribeFromAllEvents = NULL;
-
+	UFunction* pFnUnsubscribeFromAllEvents = (UFunction*) SdkBindings::Get ( 3172 );
 	if ( ! pFnUnsubscribeFromAllEvents )
-		pFnUnsubscribeFromAllEvents = (UFunction*) UObject::GObjObjects()->Data[ 36454 ];
+		return;
 
 	USFXOnlineComponentBlaze_execUnsubscribeFromAllEvents_Parms UnsubscribeFromAllEvents_Parms;
 	UnsubscribeFromAllEvents_Parms.oCallbackTarget = oCallbackTarget;
@@ -15776,10 +15085,9 @@ void USFXOnlineComponentBlaze::UnsubscribeFromAllEvents ( class UObject* oCallba
 
 void USFXOnlineComponentBlaze::UnsubscribeFromEvent ( unsigned char oEventType, struct FScriptDelegate fnEventCallback )
 {
-	static UFunction* pFnUnsubscribeFromEvent = NULL;
-
+	UFunction* pFnUnsubscribeFromEvent = (UFunction*) SdkBindings::Get ( 3171 );
 	if ( ! pFnUnsubscribeFromEvent )
-		pFnUnsubscribeFromEvent = (UFunction*) UObject::GObjObjects()->Data[ 36451 ];
+		return;
 
 	USFXOnlineComponentBlaze_execUnsubscribeFromEvent_Parms UnsubscribeFromEvent_Parms;
 	UnsubscribeFromEvent_Parms.oEventType = oEventType;
@@ -15800,10 +15108,9 @@ void USFXOnlineComponentBlaze::UnsubscribeFromEvent ( unsigned char oEventType,
 
 void USFXOnlineComponentBlaze::SubscribeToEvent ( unsigned char eEventType, struct FScriptDelegate fnEventCallback )
 {
-	static UFunction* pFnSubscribeToEvent = NULL;
-
+	UFunction* pFnSubscribeToEvent = (UFunction*) SdkBindings::Get ( 3170 );
 	if ( ! pFnSubscribeToEvent )
-		pFnSubscribeToEvent = (UFunction*) UObject::GObjObjects()->Data[ 36448 ];
+		return;
 
 	USFXOnlineComponentBlaze_execSubscribeToEvent_Parms SubscribeToEvent_Parms;
 	SubscribeToEvent_Parms.eEventType = eEventType;
@@ -15823,10 +15130,9 @@ void USFXOnlineComponentBlaze::SubscribeToEvent ( unsigned char eEventType, stru
 
 void USFXOnlineComponentBlaze::OnEvent ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnEvent = NULL;
-
+	UFunction* pFnOnEvent = (UFunction*) SdkBindings::Get ( 3169 );
 	if ( ! pFnOnEvent )
-		pFnOnEvent = (UFunction*) UObject::GObjObjects()->Data[ 36446 ];
+		return;
 
 	USFXOnlineComponentBlaze_execOnEvent_Parms OnEvent_Parms;
 	OnEvent_Parms.oEvent = oEvent;
@@ -15841,10 +15147,9 @@ void USFXOnlineComponentBlaze::OnEvent ( class USFXOnlineEvent* oEvent )
 
 struct FName USFXOnlineComponentBlaze::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3168 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 36444 ];
+		return {};
 
 	USFXOnlineComponentBlaze_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -15863,10 +15168,9 @@ struct FName USFXOnlineComponentBlaze::GetAPIName ( )
 
 void USFXOnlineComponentBlaze::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3167 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 36443 ];
+		return;
 
 	USFXOnlineComponentBlaze_execOnRelease_Parms OnRelease_Parms;
 
@@ -15884,10 +15188,9 @@ void USFXOnlineComponentBlaze::OnRelease ( )
 
 void USFXOnlineComponentBlaze::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3166 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 36441 ];
+		return;
 
 	USFXOnlineComponentBlaze_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -15906,10 +15209,9 @@ void USFXOnlineComponentBlaze::OnInitialize ( class USFXOnlineSubsystem* oOnline
 
 void USFXOnlineComponentBlazeGame::SetKickedOutOfGame ( unsigned long wasKicked )
 {
-	static UFunction* pFnSetKickedOutOfGame = NULL;
-
+	UFunction* pFnSetKickedOutOfGame = (UFunction*) SdkBindings::Get ( 3317 );
 	if ( ! pFnSetKickedOutOfGame )
-		pFnSetKickedOutOfGame = (UFunction*) UObject::GObjObjects()->Data[ 36899 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execSetKickedOutOfGame_Parms SetKickedOutOfGame_Parms;
 	SetKickedOutOfGame_Parms.wasKicked = wasKicked;
@@ -15926,10 +15228,9 @@ void USFXOnlineComponentBlazeGame::SetKickedOutOfGame ( unsigned long wasKicked
 
 bool USFXOnlineComponentBlazeGame::RecalculateSkillRating ( struct FName SessionName, TArray< struct FUniqueNetId >* Players )
 {
-	static UFunction* pFnRecalculateSkillRating = NULL;
-
+	UFunction* pFnRecalculateSkillRating = (UFunction*) SdkBindings::Get ( 3316 );
 	if ( ! pFnRecalculateSkillRating )
-		pFnRecalculateSkillRating = (UFunction*) UObject::GObjObjects()->Data[ 36893 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execRecalculateSkillRating_Parms RecalculateSkillRating_Parms;
 	memcpy ( &RecalculateSkillRating_Parms.SessionName, &SessionName, 0x8 );
@@ -15950,10 +15251,9 @@ bool USFXOnlineComponentBlazeGame::RecalculateSkillRating ( struct FName Session
 
 TArray< struct FOnlineArbitrationRegistrant > USFXOnlineComponentBlazeGame::GetArbitratedPlayers ( struct FName SessionName )
 {
-	static UFunction* pFnGetArbitratedPlayers = NULL;
-
+	UFunction* pFnGetArbitratedPlayers = (UFunction*) SdkBindings::Get ( 3315 );
 	if ( ! pFnGetArbitratedPlayers )
-		pFnGetArbitratedPlayers = (UFunction*) UObject::GObjObjects()->Data[ 36889 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execGetArbitratedPlayers_Parms GetArbitratedPlayers_Parms;
 	memcpy ( &GetArbitratedPlayers_Parms.SessionName, &SessionName, 0x8 );
@@ -15970,10 +15270,9 @@ TArray< struct FOnlineArbitrationRegistrant > USFXOnlineComponentBlazeGame::GetA
 
 void USFXOnlineComponentBlazeGame::ClearArbitrationRegistrationCompleteDelegate ( struct FScriptDelegate ArbitrationRegistrationCompleteDelegate )
 {
-	static UFunction* pFnClearArbitrationRegistrationCompleteDelegate = NULL;
-
+	UFunction* pFnClearArbitrationRegistrationCompleteDelegate = (UFunction*) SdkBindings::Get ( 3314 );
 	if ( ! pFnClearArbitrationRegistrationCompleteDelegate )
-		pFnClearArbitrationRegistrationCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36887 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execClearArbitrationRegistrationCompleteDelegate_Parms ClearArbitrationRegistrationCompleteDelegate_Parms;
 	memcpy ( &ClearArbitrationRegistrationCompleteDelegate_Parms.ArbitrationRegistrationCompleteDelegate, &ArbitrationRegistrationCompleteDelegate, 0xC );
@@ -15988,10 +15287,9 @@ void USFXOnlineComponentBlazeGame::ClearArbitrationRegistrationCompleteDelegate
 
 void USFXOnlineComponentBlazeGame::AddArbitrationRegistrationCompleteDelegate ( struct FScriptDelegate ArbitrationRegistrationCompleteDelegate )
 {
-	static UFunction* pFnAddArbitrationRegistrationCompleteDelegate = NULL;
-
+	UFunction* pFnAddArbitrationRegistrationCompleteDelegate = (UFunction*) SdkBindings::Get ( 3313 );
 	if ( ! pFnAddArbitrationRegistrationCompleteDelegate )
-		pFnAddArbitrationRegistrationCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36885 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execAddArbitrationRegistrationCompleteDelegate_Parms AddArbitrationRegistrationCompleteDelegate_Parms;
 	memcpy ( &AddArbitrationRegistrationCompleteDelegate_Parms.ArbitrationRegistrationCompleteDelegate, &ArbitrationRegistrationCompleteDelegate, 0xC );
@@ -16007,10 +15305,9 @@ void USFXOnlineComponentBlazeGame::AddArbitrationRegistrationCompleteDelegate (
 
 bool USFXOnlineComponentBlazeGame::RegisterForArbitration ( struct FName SessionName )
 {
-	static UFunction* pFnRegisterForArbitration = NULL;
-
+	UFunction* pFnRegisterForArbitration = (UFunction*) SdkBindings::Get ( 3312 );
 	if ( ! pFnRegisterForArbitration )
-		pFnRegisterForArbitration = (UFunction*) UObject::GObjObjects()->Data[ 36882 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execRegisterForArbitration_Parms RegisterForArbitration_Parms;
 	memcpy ( &RegisterForArbitration_Parms.SessionName, &SessionName, 0x8 );
@@ -16027,10 +15324,9 @@ bool USFXOnlineComponentBlazeGame::RegisterForArbitration ( struct FName Session
 
 void USFXOnlineComponentBlazeGame::ClearStartOnlineGameCompleteDelegate ( struct FScriptDelegate StartOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnClearStartOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnClearStartOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 3311 );
 	if ( ! pFnClearStartOnlineGameCompleteDelegate )
-		pFnClearStartOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36880 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execClearStartOnlineGameCompleteDelegate_Parms ClearStartOnlineGameCompleteDelegate_Parms;
 	memcpy ( &ClearStartOnlineGameCompleteDelegate_Parms.StartOnlineGameCompleteDelegate, &StartOnlineGameCompleteDelegate, 0xC );
@@ -16045,10 +15341,9 @@ void USFXOnlineComponentBlazeGame::ClearStartOnlineGameCompleteDelegate ( struct
 
 void USFXOnlineComponentBlazeGame::AddStartOnlineGameCompleteDelegate ( struct FScriptDelegate StartOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnAddStartOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnAddStartOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 3310 );
 	if ( ! pFnAddStartOnlineGameCompleteDelegate )
-		pFnAddStartOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36878 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execAddStartOnlineGameCompleteDelegate_Parms AddStartOnlineGameCompleteDelegate_Parms;
 	memcpy ( &AddStartOnlineGameCompleteDelegate_Parms.StartOnlineGameCompleteDelegate, &StartOnlineGameCompleteDelegate, 0xC );
@@ -16063,10 +15358,9 @@ void USFXOnlineComponentBlazeGame::AddStartOnlineGameCompleteDelegate ( struct F
 
 void USFXOnlineComponentBlazeGame::ClearUnregisterPlayerCompleteDelegate ( struct FScriptDelegate UnregisterPlayerCompleteDelegate )
 {
-	static UFunction* pFnClearUnregisterPlayerCompleteDelegate = NULL;
-
+	UFunction* pFnClearUnregisterPlayerCompleteDelegate = (UFunction*) SdkBindings::Get ( 3309 );
 	if ( ! pFnClearUnregisterPlayerCompleteDelegate )
-		pFnClearUnregisterPlayerCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36876 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execClearUnregisterPlayerCompleteDelegate_Parms ClearUnregisterPlayerCompleteDelegate_Parms;
 	memcpy ( &ClearUnregisterPlayerCompleteDelegate_Parms.UnregisterPlayerCompleteDelegate, &UnregisterPlayerCompleteDelegate, 0xC );
@@ -16081,10 +15375,9 @@ void USFXOnlineComponentBlazeGame::ClearUnregisterPlayerCompleteDelegate ( struc
 
 void USFXOnlineComponentBlazeGame::AddUnregisterPlayerCompleteDelegate ( struct FScriptDelegate UnregisterPlayerCompleteDelegate )
 {
-	static UFunction* pFnAddUnregisterPlayerCompleteDelegate = NULL;
-
+	UFunction* pFnAddUnregisterPlayerCompleteDelegate = (UFunction*) SdkBindings::Get ( 3308 );
 	if ( ! pFnAddUnregisterPlayerCompleteDelegate )
-		pFnAddUnregisterPlayerCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36874 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execAddUnregisterPlayerCompleteDelegate_Parms AddUnregisterPlayerCompleteDelegate_Parms;
 	memcpy ( &AddUnregisterPlayerCompleteDelegate_Parms.UnregisterPlayerCompleteDelegate, &UnregisterPlayerCompleteDelegate, 0xC );
@@ -16099,10 +15392,9 @@ void USFXOnlineComponentBlazeGame::AddUnregisterPlayerCompleteDelegate ( struct
 
 void USFXOnlineComponentBlazeGame::ClearRegisterPlayerCompleteDelegate ( struct FScriptDelegate RegisterPlayerCompleteDelegate )
 {
-	static UFunction* pFnClearRegisterPlayerCompleteDelegate = NULL;
-
+	UFunction* pFnClearRegisterPlayerCompleteDelegate = (UFunction*) SdkBindings::Get ( 3307 );
 	if ( ! pFnClearRegisterPlayerCompleteDelegate )
-		pFnClearRegisterPlayerCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36872 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execClearRegisterPlayerCompleteDelegate_Parms ClearRegisterPlayerCompleteDelegate_Parms;
 	memcpy ( &ClearRegisterPlayerCompleteDelegate_Parms.RegisterPlayerCompleteDelegate, &RegisterPlayerCompleteDelegate, 0xC );
@@ -16117,10 +15409,9 @@ void USFXOnlineComponentBlazeGame::ClearRegisterPlayerCompleteDelegate ( struct
 
 void USFXOnlineComponentBlazeGame::AddRegisterPlayerCompleteDelegate ( struct FScriptDelegate RegisterPlayerCompleteDelegate )
 {
-	static UFunction* pFnAddRegisterPlayerCompleteDelegate = NULL;
-
+	UFunction* pFnAddRegisterPlayerCompleteDelegate = (UFunction*) SdkBindings::Get ( 3306 );
 	if ( ! pFnAddRegisterPlayerCompleteDelegate )
-		pFnAddRegisterPlayerCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36870 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execAddRegisterPlayerCompleteDelegate_Parms AddRegisterPlayerCompleteDelegate_Parms;
 	memcpy ( &AddRegisterPlayerCompleteDelegate_Parms.RegisterPlayerCompleteDelegate, &RegisterPlayerCompleteDelegate, 0xC );
@@ -16137,10 +15428,9 @@ void USFXOnlineComponentBlazeGame::AddRegisterPlayerCompleteDelegate ( struct FS
 
 bool USFXOnlineComponentBlazeGame::QueryNonAdvertisedData ( int StartAt, int NumberToQuery )
 {
-	static UFunction* pFnQueryNonAdvertisedData = NULL;
-
+	UFunction* pFnQueryNonAdvertisedData = (UFunction*) SdkBindings::Get ( 3305 );
 	if ( ! pFnQueryNonAdvertisedData )
-		pFnQueryNonAdvertisedData = (UFunction*) UObject::GObjObjects()->Data[ 36866 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execQueryNonAdvertisedData_Parms QueryNonAdvertisedData_Parms;
 	QueryNonAdvertisedData_Parms.StartAt = StartAt;
@@ -16159,10 +15449,9 @@ bool USFXOnlineComponentBlazeGame::QueryNonAdvertisedData ( int StartAt, int Num
 
 bool USFXOnlineComponentBlazeGame::FreeSearchResults ( class UOnlineGameSearch* Search )
 {
-	static UFunction* pFnFreeSearchResults = NULL;
-
+	UFunction* pFnFreeSearchResults = (UFunction*) SdkBindings::Get ( 3304 );
 	if ( ! pFnFreeSearchResults )
-		pFnFreeSearchResults = (UFunction*) UObject::GObjObjects()->Data[ 36863 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execFreeSearchResults_Parms FreeSearchResults_Parms;
 	FreeSearchResults_Parms.Search = Search;
@@ -16182,10 +15471,9 @@ bool USFXOnlineComponentBlazeGame::FreeSearchResults ( class UOnlineGameSearch*
 
 bool USFXOnlineComponentBlazeGame::BindPlatformSpecificSessionToSearch ( unsigned char SearchingPlayerNum, class UOnlineGameSearch* SearchSettings, unsigned char* PlatformSpecificInfo )
 {
-	static UFunction* pFnBindPlatformSpecificSessionToSearch = NULL;
-
+	UFunction* pFnBindPlatformSpecificSessionToSearch = (UFunction*) SdkBindings::Get ( 3303 );
 	if ( ! pFnBindPlatformSpecificSessionToSearch )
-		pFnBindPlatformSpecificSessionToSearch = (UFunction*) UObject::GObjObjects()->Data[ 36858 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execBindPlatformSpecificSessionToSearch_Parms BindPlatformSpecificSessionToSearch_Parms;
 	BindPlatformSpecificSessionToSearch_Parms.SearchingPlayerNum = SearchingPlayerNum;
@@ -16206,10 +15494,9 @@ bool USFXOnlineComponentBlazeGame::BindPlatformSpecificSessionToSearch ( unsigne
 
 bool USFXOnlineComponentBlazeGame::ReadPlatformSpecificSessionInfoBySessionName ( struct FName SessionName, unsigned char* PlatformSpecificInfo )
 {
-	static UFunction* pFnReadPlatformSpecificSessionInfoBySessionName = NULL;
-
+	UFunction* pFnReadPlatformSpecificSessionInfoBySessionName = (UFunction*) SdkBindings::Get ( 3302 );
 	if ( ! pFnReadPlatformSpecificSessionInfoBySessionName )
-		pFnReadPlatformSpecificSessionInfoBySessionName = (UFunction*) UObject::GObjObjects()->Data[ 36854 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execReadPlatformSpecificSessionInfoBySessionName_Parms ReadPlatformSpecificSessionInfoBySessionName_Parms;
 	memcpy ( &ReadPlatformSpecificSessionInfoBySessionName_Parms.SessionName, &SessionName, 0x8 );
@@ -16231,10 +15518,9 @@ bool USFXOnlineComponentBlazeGame::ReadPlatformSpecificSessionInfoBySessionName
 
 bool USFXOnlineComponentBlazeGame::ReadPlatformSpecificSessionInfo ( struct FOnlineGameSearchResult* DesiredGame, unsigned char* PlatformSpecificInfo )
 {
-	static UFunction* pFnReadPlatformSpecificSessionInfo = NULL;
-
+	UFunction* pFnReadPlatformSpecificSessionInfo = (UFunction*) SdkBindings::Get ( 3301 );
 	if ( ! pFnReadPlatformSpecificSessionInfo )
-		pFnReadPlatformSpecificSessionInfo = (UFunction*) UObject::GObjObjects()->Data[ 36850 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execReadPlatformSpecificSessionInfo_Parms ReadPlatformSpecificSessionInfo_Parms;
 
@@ -16256,10 +15542,9 @@ bool USFXOnlineComponentBlazeGame::ReadPlatformSpecificSessionInfo ( struct FOnl
 
 void USFXOnlineComponentBlazeGame::ClearCancelFindOnlineGamesCompleteDelegate ( struct FScriptDelegate CancelFindOnlineGamesCompleteDelegate )
 {
-	static UFunction* pFnClearCancelFindOnlineGamesCompleteDelegate = NULL;
-
+	UFunction* pFnClearCancelFindOnlineGamesCompleteDelegate = (UFunction*) SdkBindings::Get ( 3300 );
 	if ( ! pFnClearCancelFindOnlineGamesCompleteDelegate )
-		pFnClearCancelFindOnlineGamesCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36848 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execClearCancelFindOnlineGamesCompleteDelegate_Parms ClearCancelFindOnlineGamesCompleteDelegate_Parms;
 	memcpy ( &ClearCancelFindOnlineGamesCompleteDelegate_Parms.CancelFindOnlineGamesCompleteDelegate, &CancelFindOnlineGamesCompleteDelegate, 0xC );
@@ -16274,10 +15559,9 @@ void USFXOnlineComponentBlazeGame::ClearCancelFindOnlineGamesCompleteDelegate (
 
 void USFXOnlineComponentBlazeGame::AddCancelFindOnlineGamesCompleteDelegate ( struct FScriptDelegate CancelFindOnlineGamesCompleteDelegate )
 {
-	static UFunction* pFnAddCancelFindOnlineGamesCompleteDelegate = NULL;
-
+	UFunction* pFnAddCancelFindOnlineGamesCompleteDelegate = (UFunction*) SdkBindings::Get ( 3299 );
 	if ( ! pFnAddCancelFindOnlineGamesCompleteDelegate )
-		pFnAddCancelFindOnlineGamesCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36846 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execAddCancelFindOnlineGamesCompleteDelegate_Parms AddCancelFindOnlineGamesCompleteDelegate_Parms;
 	memcpy ( &AddCancelFindOnlineGamesCompleteDelegate_Parms.CancelFindOnlineGamesCompleteDelegate, &CancelFindOnlineGamesCompleteDelegate, 0xC );
@@ -16292,10 +15576,9 @@ void USFXOnlineComponentBlazeGame::AddCancelFindOnlineGamesCompleteDelegate ( st
 
 void USFXOnlineComponentBlazeGame::ClearEndOnlineGameCompleteDelegate ( struct FScriptDelegate EndOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnClearEndOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnClearEndOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 3298 );
 	if ( ! pFnClearEndOnlineGameCompleteDelegate )
-		pFnClearEndOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36844 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execClearEndOnlineGameCompleteDelegate_Parms ClearEndOnlineGameCompleteDelegate_Parms;
 	memcpy ( &ClearEndOnlineGameCompleteDelegate_Parms.EndOnlineGameCompleteDelegate, &EndOnlineGameCompleteDelegate, 0xC );
@@ -16310,10 +15593,9 @@ void USFXOnlineComponentBlazeGame::ClearEndOnlineGameCompleteDelegate ( struct F
 
 void USFXOnlineComponentBlazeGame::AddEndOnlineGameCompleteDelegate ( struct FScriptDelegate EndOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnAddEndOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnAddEndOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 3297 );
 	if ( ! pFnAddEndOnlineGameCompleteDelegate )
-		pFnAddEndOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36842 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execAddEndOnlineGameCompleteDelegate_Parms AddEndOnlineGameCompleteDelegate_Parms;
 	memcpy ( &AddEndOnlineGameCompleteDelegate_Parms.EndOnlineGameCompleteDelegate, &EndOnlineGameCompleteDelegate, 0xC );
@@ -16328,10 +15610,9 @@ void USFXOnlineComponentBlazeGame::AddEndOnlineGameCompleteDelegate ( struct FSc
 
 void USFXOnlineComponentBlazeGame::ClearDestroyOnlineGameCompleteDelegate ( struct FScriptDelegate DestroyOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnClearDestroyOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnClearDestroyOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 3296 );
 	if ( ! pFnClearDestroyOnlineGameCompleteDelegate )
-		pFnClearDestroyOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36840 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execClearDestroyOnlineGameCompleteDelegate_Parms ClearDestroyOnlineGameCompleteDelegate_Parms;
 	memcpy ( &ClearDestroyOnlineGameCompleteDelegate_Parms.DestroyOnlineGameCompleteDelegate, &DestroyOnlineGameCompleteDelegate, 0xC );
@@ -16346,10 +15627,9 @@ void USFXOnlineComponentBlazeGame::ClearDestroyOnlineGameCompleteDelegate ( stru
 
 void USFXOnlineComponentBlazeGame::AddDestroyOnlineGameCompleteDelegate ( struct FScriptDelegate DestroyOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnAddDestroyOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnAddDestroyOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 3295 );
 	if ( ! pFnAddDestroyOnlineGameCompleteDelegate )
-		pFnAddDestroyOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36838 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execAddDestroyOnlineGameCompleteDelegate_Parms AddDestroyOnlineGameCompleteDelegate_Parms;
 	memcpy ( &AddDestroyOnlineGameCompleteDelegate_Parms.DestroyOnlineGameCompleteDelegate, &DestroyOnlineGameCompleteDelegate, 0xC );
@@ -16364,10 +15644,9 @@ void USFXOnlineComponentBlazeGame::AddDestroyOnlineGameCompleteDelegate ( struct
 
 void USFXOnlineComponentBlazeGame::ClearUpdateOnlineGameCompleteDelegate ( struct FScriptDelegate UpdateOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnClearUpdateOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnClearUpdateOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 3294 );
 	if ( ! pFnClearUpdateOnlineGameCompleteDelegate )
-		pFnClearUpdateOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36836 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execClearUpdateOnlineGameCompleteDelegate_Parms ClearUpdateOnlineGameCompleteDelegate_Parms;
 	memcpy ( &ClearUpdateOnlineGameCompleteDelegate_Parms.UpdateOnlineGameCompleteDelegate, &UpdateOnlineGameCompleteDelegate, 0xC );
@@ -16382,10 +15661,9 @@ void USFXOnlineComponentBlazeGame::ClearUpdateOnlineGameCompleteDelegate ( struc
 
 void USFXOnlineComponentBlazeGame::AddUpdateOnlineGameCompleteDelegate ( struct FScriptDelegate UpdateOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnAddUpdateOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnAddUpdateOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 3293 );
 	if ( ! pFnAddUpdateOnlineGameCompleteDelegate )
-		pFnAddUpdateOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36834 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execAddUpdateOnlineGameCompleteDelegate_Parms AddUpdateOnlineGameCompleteDelegate_Parms;
 	memcpy ( &AddUpdateOnlineGameCompleteDelegate_Parms.UpdateOnlineGameCompleteDelegate, &UpdateOnlineGameCompleteDelegate, 0xC );
@@ -16400,10 +15678,9 @@ void USFXOnlineComponentBlazeGame::AddUpdateOnlineGameCompleteDelegate ( struct
 
 void USFXOnlineComponentBlazeGame::ClearJoinOnlineGameCompleteDelegate ( struct FScriptDelegate JoinOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnClearJoinOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnClearJoinOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 3292 );
 	if ( ! pFnClearJoinOnlineGameCompleteDelegate )
-		pFnClearJoinOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36832 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execClearJoinOnlineGameCompleteDelegate_Parms ClearJoinOnlineGameCompleteDelegate_Parms;
 	memcpy ( &ClearJoinOnlineGameCompleteDelegate_Parms.JoinOnlineGameCompleteDelegate, &JoinOnlineGameCompleteDelegate, 0xC );
@@ -16418,10 +15695,9 @@ void USFXOnlineComponentBlazeGame::ClearJoinOnlineGameCompleteDelegate ( struct
 
 void USFXOnlineComponentBlazeGame::AddJoinOnlineGameCompleteDelegate ( struct FScriptDelegate JoinOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnAddJoinOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnAddJoinOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 3291 );
 	if ( ! pFnAddJoinOnlineGameCompleteDelegate )
-		pFnAddJoinOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36830 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execAddJoinOnlineGameCompleteDelegate_Parms AddJoinOnlineGameCompleteDelegate_Parms;
 	memcpy ( &AddJoinOnlineGameCompleteDelegate_Parms.JoinOnlineGameCompleteDelegate, &JoinOnlineGameCompleteDelegate, 0xC );
@@ -16437,10 +15713,9 @@ void USFXOnlineComponentBlazeGame::AddJoinOnlineGameCompleteDelegate ( struct FS
 
 void USFXOnlineComponentBlazeGame::ClearGameInviteAcceptedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate GameInviteAcceptedDelegate )
 {
-	static UFunction* pFnClearGameInviteAcceptedDelegate = NULL;
-
+	UFunction* pFnClearGameInviteAcceptedDelegate = (UFunction*) SdkBindings::Get ( 3290 );
 	if ( ! pFnClearGameInviteAcceptedDelegate )
-		pFnClearGameInviteAcceptedDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36827 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execClearGameInviteAcceptedDelegate_Parms ClearGameInviteAcceptedDelegate_Parms;
 	ClearGameInviteAcceptedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -16456,10 +15731,9 @@ void USFXOnlineComponentBlazeGame::ClearGameInviteAcceptedDelegate ( unsigned ch
 
 bool USFXOnlineComponentBlazeGame::eventCanShowErrorMessage ( )
 {
-	static UFunction* pFnCanShowErrorMessage = NULL;
-
+	UFunction* pFnCanShowErrorMessage = (UFunction*) SdkBindings::Get ( 3289 );
 	if ( ! pFnCanShowErrorMessage )
-		pFnCanShowErrorMessage = (UFunction*) UObject::GObjObjects()->Data[ 36823 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_eventCanShowErrorMessage_Parms CanShowErrorMessage_Parms;
 
@@ -16475,10 +15749,9 @@ bool USFXOnlineComponentBlazeGame::eventCanShowErrorMessage ( )
 
 void USFXOnlineComponentBlazeGame::NotifyGameInviteAcceptedDelegates ( struct FOnlineGameSearchResult* InviteResult )
 {
-	static UFunction* pFnNotifyGameInviteAcceptedDelegates = NULL;
-
+	UFunction* pFnNotifyGameInviteAcceptedDelegates = (UFunction*) SdkBindings::Get ( 3288 );
 	if ( ! pFnNotifyGameInviteAcceptedDelegates )
-		pFnNotifyGameInviteAcceptedDelegates = (UFunction*) UObject::GObjObjects()->Data[ 36817 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execNotifyGameInviteAcceptedDelegates_Parms NotifyGameInviteAcceptedDelegates_Parms;
 
@@ -16496,10 +15769,9 @@ void USFXOnlineComponentBlazeGame::NotifyGameInviteAcceptedDelegates ( struct FO
 
 void USFXOnlineComponentBlazeGame::AddGameInviteAcceptedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate GameInviteAcceptedDelegate )
 {
-	static UFunction* pFnAddGameInviteAcceptedDelegate = NULL;
-
+	UFunction* pFnAddGameInviteAcceptedDelegate = (UFunction*) SdkBindings::Get ( 3287 );
 	if ( ! pFnAddGameInviteAcceptedDelegate )
-		pFnAddGameInviteAcceptedDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36813 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execAddGameInviteAcceptedDelegate_Parms AddGameInviteAcceptedDelegate_Parms;
 	AddGameInviteAcceptedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -16515,10 +15787,9 @@ void USFXOnlineComponentBlazeGame::AddGameInviteAcceptedDelegate ( unsigned char
 
 void USFXOnlineComponentBlazeGame::ClearQuickMatchCompleteDelegate ( struct FScriptDelegate QuickMatchCompleteDelegate )
 {
-	static UFunction* pFnClearQuickMatchCompleteDelegate = NULL;
-
+	UFunction* pFnClearQuickMatchCompleteDelegate = (UFunction*) SdkBindings::Get ( 3286 );
 	if ( ! pFnClearQuickMatchCompleteDelegate )
-		pFnClearQuickMatchCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36811 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execClearQuickMatchCompleteDelegate_Parms ClearQuickMatchCompleteDelegate_Parms;
 	memcpy ( &ClearQuickMatchCompleteDelegate_Parms.QuickMatchCompleteDelegate, &QuickMatchCompleteDelegate, 0xC );
@@ -16533,10 +15804,9 @@ void USFXOnlineComponentBlazeGame::ClearQuickMatchCompleteDelegate ( struct FScr
 
 void USFXOnlineComponentBlazeGame::AddQuickMatchCompleteDelegate ( struct FScriptDelegate QuickMatchCompleteDelegate )
 {
-	static UFunction* pFnAddQuickMatchCompleteDelegate = NULL;
-
+	UFunction* pFnAddQuickMatchCompleteDelegate = (UFunction*) SdkBindings::Get ( 3285 );
 	if ( ! pFnAddQuickMatchCompleteDelegate )
-		pFnAddQuickMatchCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36809 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execAddQuickMatchCompleteDelegate_Parms AddQuickMatchCompleteDelegate_Parms;
 	memcpy ( &AddQuickMatchCompleteDelegate_Parms.QuickMatchCompleteDelegate, &QuickMatchCompleteDelegate, 0xC );
@@ -16551,10 +15821,9 @@ void USFXOnlineComponentBlazeGame::AddQuickMatchCompleteDelegate ( struct FScrip
 
 void USFXOnlineComponentBlazeGame::ClearCreateOnlineGameCompleteDelegate ( struct FScriptDelegate CreateOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnClearCreateOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnClearCreateOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 3284 );
 	if ( ! pFnClearCreateOnlineGameCompleteDelegate )
-		pFnClearCreateOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36807 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execClearCreateOnlineGameCompleteDelegate_Parms ClearCreateOnlineGameCompleteDelegate_Parms;
 	memcpy ( &ClearCreateOnlineGameCompleteDelegate_Parms.CreateOnlineGameCompleteDelegate, &CreateOnlineGameCompleteDelegate, 0xC );
@@ -16569,10 +15838,9 @@ void USFXOnlineComponentBlazeGame::ClearCreateOnlineGameCompleteDelegate ( struc
 
 void USFXOnlineComponentBlazeGame::AddCreateOnlineGameCompleteDelegate ( struct FScriptDelegate CreateOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnAddCreateOnlineGameCompleteDelegate = NULL;
-
+	UFunction* pFnAddCreateOnlineGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 3283 );
 	if ( ! pFnAddCreateOnlineGameCompleteDelegate )
-		pFnAddCreateOnlineGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36805 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execAddCreateOnlineGameCompleteDelegate_Parms AddCreateOnlineGameCompleteDelegate_Parms;
 	memcpy ( &AddCreateOnlineGameCompleteDelegate_Parms.CreateOnlineGameCompleteDelegate, &CreateOnlineGameCompleteDelegate, 0xC );
@@ -16587,10 +15855,9 @@ void USFXOnlineComponentBlazeGame::AddCreateOnlineGameCompleteDelegate ( struct
 
 void USFXOnlineComponentBlazeGame::ClearFindOnlineGamesCompleteDelegate ( struct FScriptDelegate FindOnlineGamesCompleteDelegate )
 {
-	static UFunction* pFnClearFindOnlineGamesCompleteDelegate = NULL;
-
+	UFunction* pFnClearFindOnlineGamesCompleteDelegate = (UFunction*) SdkBindings::Get ( 3282 );
 	if ( ! pFnClearFindOnlineGamesCompleteDelegate )
-		pFnClearFindOnlineGamesCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36803 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execClearFindOnlineGamesCompleteDelegate_Parms ClearFindOnlineGamesCompleteDelegate_Parms;
 	memcpy ( &ClearFindOnlineGamesCompleteDelegate_Parms.FindOnlineGamesCompleteDelegate, &FindOnlineGamesCompleteDelegate, 0xC );
@@ -16605,10 +15872,9 @@ void USFXOnlineComponentBlazeGame::ClearFindOnlineGamesCompleteDelegate ( struct
 
 void USFXOnlineComponentBlazeGame::AddFindOnlineGamesCompleteDelegate ( struct FScriptDelegate FindOnlineGamesCompleteDelegate )
 {
-	static UFunction* pFnAddFindOnlineGamesCompleteDelegate = NULL;
-
+	UFunction* pFnAddFindOnlineGamesCompleteDelegate = (UFunction*) SdkBindings::Get ( 3281 );
 	if ( ! pFnAddFindOnlineGamesCompleteDelegate )
-		pFnAddFindOnlineGamesCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 36801 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execAddFindOnlineGamesCompleteDelegate_Parms AddFindOnlineGamesCompleteDelegate_Parms;
 	memcpy ( &AddFindOnlineGamesCompleteDelegate_Parms.FindOnlineGamesCompleteDelegate, &FindOnlineGamesCompleteDelegate, 0xC );
@@ -16623,10 +15889,9 @@ void USFXOnlineComponentBlazeGame::AddFindOnlineGamesCompleteDelegate ( struct F
 
 bool USFXOnlineComponentBlazeGame::CancelFindOnlineGames ( )
 {
-	static UFunction* pFnCancelFindOnlineGames = NULL;
-
+	UFunction* pFnCancelFindOnlineGames = (UFunction*) SdkBindings::Get ( 3280 );
 	if ( ! pFnCancelFindOnlineGames )
-		pFnCancelFindOnlineGames = (UFunction*) UObject::GObjObjects()->Data[ 36799 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execCancelFindOnlineGames_Parms CancelFindOnlineGames_Parms;
 
@@ -16646,10 +15911,9 @@ bool USFXOnlineComponentBlazeGame::CancelFindOnlineGames ( )
 
 class UOnlineGameSearch* USFXOnlineComponentBlazeGame::GetGameSearch ( )
 {
-	static UFunction* pFnGetGameSearch = NULL;
-
+	UFunction* pFnGetGameSearch = (UFunction*) SdkBindings::Get ( 3279 );
 	if ( ! pFnGetGameSearch )
-		pFnGetGameSearch = (UFunction*) UObject::GObjObjects()->Data[ 36797 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execGetGameSearch_Parms GetGameSearch_Parms;
 
@@ -16666,10 +15930,9 @@ class UOnlineGameSearch* USFXOnlineComponentBlazeGame::GetGameSearch ( )
 
 class UOnlineGameSettings* USFXOnlineComponentBlazeGame::GetGameSettings ( struct FName SessionName )
 {
-	static UFunction* pFnGetGameSettings = NULL;
-
+	UFunction* pFnGetGameSettings = (UFunction*) SdkBindings::Get ( 3278 );
 	if ( ! pFnGetGameSettings )
-		pFnGetGameSettings = (UFunction*) UObject::GObjObjects()->Data[ 36794 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execGetGameSettings_Parms GetGameSettings_Parms;
 	memcpy ( &GetGameSettings_Parms.SessionName, &SessionName, 0x8 );
@@ -16686,10 +15949,9 @@ class UOnlineGameSettings* USFXOnlineComponentBlazeGame::GetGameSettings ( struc
 
 bool USFXOnlineComponentBlazeGame::OnConnectionError ( )
 {
-	static UFunction* pFnOnConnectionError = NULL;
-
+	UFunction* pFnOnConnectionError = (UFunction*) SdkBindings::Get ( 3277 );
 	if ( ! pFnOnConnectionError )
-		pFnOnConnectionError = (UFunction*) UObject::GObjObjects()->Data[ 36792 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execOnConnectionError_Parms OnConnectionError_Parms;
 
@@ -16709,10 +15971,9 @@ bool USFXOnlineComponentBlazeGame::OnConnectionError ( )
 
 void USFXOnlineComponentBlazeGame::eventOnInviteAccepted ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnInviteAccepted = NULL;
-
+	UFunction* pFnOnInviteAccepted = (UFunction*) SdkBindings::Get ( 3275 );
 	if ( ! pFnOnInviteAccepted )
-		pFnOnInviteAccepted = (UFunction*) UObject::GObjObjects()->Data[ 36779 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_eventOnInviteAccepted_Parms OnInviteAccepted_Parms;
 	OnInviteAccepted_Parms.oEvent = oEvent;
@@ -16730,10 +15991,9 @@ void USFXOnlineComponentBlazeGame::eventOnInviteAccepted ( class USFXOnlineEvent
 
 void USFXOnlineComponentBlazeGame::ShowPopup ( void* bodyStr, unsigned long bShowOkBtn, unsigned long bModal, unsigned long bPauseGameplay )
 {
-	static UFunction* pFnShowPopup = NULL;
-
+	UFunction* pFnShowPopup = (UFunction*) SdkBindings::Get ( 3274 );
 	if ( ! pFnShowPopup )
-		pFnShowPopup = (UFunction*) UObject::GObjObjects()->Data[ 36774 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execShowPopup_Parms ShowPopup_Parms;
 	ShowPopup_Parms.bodyStr = bodyStr;
@@ -16755,10 +16015,9 @@ void USFXOnlineComponentBlazeGame::ShowPopup ( void* bodyStr, unsigned long bSho
 
 void USFXOnlineComponentBlazeGame::eventGM_OnDisconnect ( class USFXOnlineEvent* disconnectEvent )
 {
-	static UFunction* pFnGM_OnDisconnect = NULL;
-
+	UFunction* pFnGM_OnDisconnect = (UFunction*) SdkBindings::Get ( 3272 );
 	if ( ! pFnGM_OnDisconnect )
-		pFnGM_OnDisconnect = (UFunction*) UObject::GObjObjects()->Data[ 36767 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_eventGM_OnDisconnect_Parms GM_OnDisconnect_Parms;
 	GM_OnDisconnect_Parms.disconnectEvent = disconnectEvent;
@@ -16773,10 +16032,9 @@ void USFXOnlineComponentBlazeGame::eventGM_OnDisconnect ( class USFXOnlineEvent*
 
 void USFXOnlineComponentBlazeGame::SetPlatformPresence ( unsigned long presencePrivate )
 {
-	static UFunction* pFnSetPlatformPresence = NULL;
-
+	UFunction* pFnSetPlatformPresence = (UFunction*) SdkBindings::Get ( 3271 );
 	if ( ! pFnSetPlatformPresence )
-		pFnSetPlatformPresence = (UFunction*) UObject::GObjObjects()->Data[ 36765 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execSetPlatformPresence_Parms SetPlatformPresence_Parms;
 	SetPlatformPresence_Parms.presencePrivate = presencePrivate;
@@ -16795,10 +16053,9 @@ void USFXOnlineComponentBlazeGame::SetPlatformPresence ( unsigned long presenceP
 
 bool USFXOnlineComponentBlazeGame::PerformCallRestrictedFunction ( )
 {
-	static UFunction* pFnPerformCallRestrictedFunction = NULL;
-
+	UFunction* pFnPerformCallRestrictedFunction = (UFunction*) SdkBindings::Get ( 3270 );
 	if ( ! pFnPerformCallRestrictedFunction )
-		pFnPerformCallRestrictedFunction = (UFunction*) UObject::GObjObjects()->Data[ 36763 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execPerformCallRestrictedFunction_Parms PerformCallRestrictedFunction_Parms;
 
@@ -16818,10 +16075,9 @@ bool USFXOnlineComponentBlazeGame::PerformCallRestrictedFunction ( )
 
 void USFXOnlineComponentBlazeGame::SetCallRestrictedFunctionMode ( unsigned long bEnable )
 {
-	static UFunction* pFnSetCallRestrictedFunctionMode = NULL;
-
+	UFunction* pFnSetCallRestrictedFunctionMode = (UFunction*) SdkBindings::Get ( 3269 );
 	if ( ! pFnSetCallRestrictedFunctionMode )
-		pFnSetCallRestrictedFunctionMode = (UFunction*) UObject::GObjObjects()->Data[ 36761 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execSetCallRestrictedFunctionMode_Parms SetCallRestrictedFunctionMode_Parms;
 	SetCallRestrictedFunctionMode_Parms.bEnable = bEnable;
@@ -16840,10 +16096,9 @@ void USFXOnlineComponentBlazeGame::SetCallRestrictedFunctionMode ( unsigned long
 
 class USFXOnlineGameSettings* USFXOnlineComponentBlazeGame::eventCreateDefaultQuickMatchSettings ( )
 {
-	static UFunction* pFnCreateDefaultQuickMatchSettings = NULL;
-
+	UFunction* pFnCreateDefaultQuickMatchSettings = (UFunction*) SdkBindings::Get ( 3268 );
 	if ( ! pFnCreateDefaultQuickMatchSettings )
-		pFnCreateDefaultQuickMatchSettings = (UFunction*) UObject::GObjObjects()->Data[ 36756 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_eventCreateDefaultQuickMatchSettings_Parms CreateDefaultQuickMatchSettings_Parms;
 
@@ -16860,10 +16115,9 @@ class USFXOnlineGameSettings* USFXOnlineComponentBlazeGame::eventCreateDefaultQu
 
 bool USFXOnlineComponentBlazeGame::CanStartMPMatch ( class UOnlineGameSettings* NewGameSettings )
 {
-	static UFunction* pFnCanStartMPMatch = NULL;
-
+	UFunction* pFnCanStartMPMatch = (UFunction*) SdkBindings::Get ( 3267 );
 	if ( ! pFnCanStartMPMatch )
-		pFnCanStartMPMatch = (UFunction*) UObject::GObjObjects()->Data[ 36753 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execCanStartMPMatch_Parms CanStartMPMatch_Parms;
 	CanStartMPMatch_Parms.NewGameSettings = NewGameSettings;
@@ -16885,10 +16139,9 @@ bool USFXOnlineComponentBlazeGame::CanStartMPMatch ( class UOnlineGameSettings*
 
 bool USFXOnlineComponentBlazeGame::QuickMatch ( class UOnlineGameSettings* quickMatchSettings )
 {
-	static UFunction* pFnQuickMatch = NULL;
-
+	UFunction* pFnQuickMatch = (UFunction*) SdkBindings::Get ( 3266 );
 	if ( ! pFnQuickMatch )
-		pFnQuickMatch = (UFunction*) UObject::GObjObjects()->Data[ 36750 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execQuickMatch_Parms QuickMatch_Parms;
 	QuickMatch_Parms.quickMatchSettings = quickMatchSettings;
@@ -16908,10 +16161,9 @@ bool USFXOnlineComponentBlazeGame::QuickMatch ( class UOnlineGameSettings* quick
 
 void USFXOnlineComponentBlazeGame::LeaveGame ( )
 {
-	static UFunction* pFnLeaveGame = NULL;
-
+	UFunction* pFnLeaveGame = (UFunction*) SdkBindings::Get ( 3265 );
 	if ( ! pFnLeaveGame )
-		pFnLeaveGame = (UFunction*) UObject::GObjObjects()->Data[ 36749 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execLeaveGame_Parms LeaveGame_Parms;
 
@@ -16929,10 +16181,9 @@ void USFXOnlineComponentBlazeGame::LeaveGame ( )
 
 bool USFXOnlineComponentBlazeGame::IsPlaying ( )
 {
-	static UFunction* pFnIsPlaying = NULL;
-
+	UFunction* pFnIsPlaying = (UFunction*) SdkBindings::Get ( 3264 );
 	if ( ! pFnIsPlaying )
-		pFnIsPlaying = (UFunction*) UObject::GObjObjects()->Data[ 36747 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execIsPlaying_Parms IsPlaying_Parms;
 
@@ -16952,10 +16203,9 @@ bool USFXOnlineComponentBlazeGame::IsPlaying ( )
 
 void USFXOnlineComponentBlazeGame::Tick ( class USFXOnlineEvent* Event )
 {
-	static UFunction* pFnTick = NULL;
-
+	UFunction* pFnTick = (UFunction*) SdkBindings::Get ( 3263 );
 	if ( ! pFnTick )
-		pFnTick = (UFunction*) UObject::GObjObjects()->Data[ 36743 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execTick_Parms Tick_Parms;
 	Tick_Parms.Event = Event;
@@ -16970,10 +16220,9 @@ void USFXOnlineComponentBlazeGame::Tick ( class USFXOnlineEvent* Event )
 
 void USFXOnlineComponentBlazeGame::OnMPGameStatusChange ( class USFXOnlineEvent* Event )
 {
-	static UFunction* pFnOnMPGameStatusChange = NULL;
-
+	UFunction* pFnOnMPGameStatusChange = (UFunction*) SdkBindings::Get ( 3262 );
 	if ( ! pFnOnMPGameStatusChange )
-		pFnOnMPGameStatusChange = (UFunction*) UObject::GObjObjects()->Data[ 36741 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execOnMPGameStatusChange_Parms OnMPGameStatusChange_Parms;
 	OnMPGameStatusChange_Parms.Event = Event;
@@ -16992,10 +16241,9 @@ void USFXOnlineComponentBlazeGame::OnMPGameStatusChange ( class USFXOnlineEvent*
 
 void USFXOnlineComponentBlazeGame::OnTick ( class USFXOnlineEvent* Event )
 {
-	static UFunction* pFnOnTick = NULL;
-
+	UFunction* pFnOnTick = (UFunction*) SdkBindings::Get ( 3261 );
 	if ( ! pFnOnTick )
-		pFnOnTick = (UFunction*) UObject::GObjObjects()->Data[ 36739 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.Event = Event;
@@ -17015,10 +16263,9 @@ void USFXOnlineComponentBlazeGame::OnTick ( class USFXOnlineEvent* Event )
 
 bool USFXOnlineComponentBlazeGame::KickPlayer ( struct FUniqueNetId PlayerID )
 {
-	static UFunction* pFnKickPlayer = NULL;
-
+	UFunction* pFnKickPlayer = (UFunction*) SdkBindings::Get ( 3260 );
 	if ( ! pFnKickPlayer )
-		pFnKickPlayer = (UFunction*) UObject::GObjObjects()->Data[ 36736 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execKickPlayer_Parms KickPlayer_Parms;
 	memcpy ( &KickPlayer_Parms.PlayerID, &PlayerID, 0x8 );
@@ -17039,10 +16286,9 @@ bool USFXOnlineComponentBlazeGame::KickPlayer ( struct FUniqueNetId PlayerID )
 
 int USFXOnlineComponentBlazeGame::GetPlayerCount ( )
 {
-	static UFunction* pFnGetPlayerCount = NULL;
-
+	UFunction* pFnGetPlayerCount = (UFunction*) SdkBindings::Get ( 3259 );
 	if ( ! pFnGetPlayerCount )
-		pFnGetPlayerCount = (UFunction*) UObject::GObjObjects()->Data[ 36734 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execGetPlayerCount_Parms GetPlayerCount_Parms;
 
@@ -17061,10 +16307,9 @@ int USFXOnlineComponentBlazeGame::GetPlayerCount ( )
 
 void USFXOnlineComponentBlazeGame::HideHostMigrationMsgBox ( )
 {
-	static UFunction* pFnHideHostMigrationMsgBox = NULL;
-
+	UFunction* pFnHideHostMigrationMsgBox = (UFunction*) SdkBindings::Get ( 3258 );
 	if ( ! pFnHideHostMigrationMsgBox )
-		pFnHideHostMigrationMsgBox = (UFunction*) UObject::GObjObjects()->Data[ 36733 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execHideHostMigrationMsgBox_Parms HideHostMigrationMsgBox_Parms;
 
@@ -17082,10 +16327,9 @@ void USFXOnlineComponentBlazeGame::HideHostMigrationMsgBox ( )
 
 void USFXOnlineComponentBlazeGame::ShowHostMigrationMsgBox ( unsigned long bIsInLobby )
 {
-	static UFunction* pFnShowHostMigrationMsgBox = NULL;
-
+	UFunction* pFnShowHostMigrationMsgBox = (UFunction*) SdkBindings::Get ( 3257 );
 	if ( ! pFnShowHostMigrationMsgBox )
-		pFnShowHostMigrationMsgBox = (UFunction*) UObject::GObjObjects()->Data[ 36731 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execShowHostMigrationMsgBox_Parms ShowHostMigrationMsgBox_Parms;
 	ShowHostMigrationMsgBox_Parms.bIsInLobby = bIsInLobby;
@@ -17104,10 +16348,9 @@ void USFXOnlineComponentBlazeGame::ShowHostMigrationMsgBox ( unsigned long bIsIn
 
 void USFXOnlineComponentBlazeGame::FailHostMigration ( struct FString Reason )
 {
-	static UFunction* pFnFailHostMigration = NULL;
-
+	UFunction* pFnFailHostMigration = (UFunction*) SdkBindings::Get ( 3256 );
 	if ( ! pFnFailHostMigration )
-		pFnFailHostMigration = (UFunction*) UObject::GObjObjects()->Data[ 36729 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execFailHostMigration_Parms FailHostMigration_Parms;
 	memcpy ( &FailHostMigration_Parms.Reason, &Reason, 0xC );
@@ -17125,10 +16368,9 @@ void USFXOnlineComponentBlazeGame::FailHostMigration ( struct FString Reason )
 
 void USFXOnlineComponentBlazeGame::CancelHostMigration ( )
 {
-	static UFunction* pFnCancelHostMigration = NULL;
-
+	UFunction* pFnCancelHostMigration = (UFunction*) SdkBindings::Get ( 3255 );
 	if ( ! pFnCancelHostMigration )
-		pFnCancelHostMigration = (UFunction*) UObject::GObjObjects()->Data[ 36728 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execCancelHostMigration_Parms CancelHostMigration_Parms;
 
@@ -17147,10 +16389,9 @@ void USFXOnlineComponentBlazeGame::CancelHostMigration ( )
 
 void USFXOnlineComponentBlazeGame::CompleteHostMigration ( unsigned long bLocalPlayerIsHost, unsigned long bIsInLobby )
 {
-	static UFunction* pFnCompleteHostMigration = NULL;
-
+	UFunction* pFnCompleteHostMigration = (UFunction*) SdkBindings::Get ( 3254 );
 	if ( ! pFnCompleteHostMigration )
-		pFnCompleteHostMigration = (UFunction*) UObject::GObjObjects()->Data[ 36725 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execCompleteHostMigration_Parms CompleteHostMigration_Parms;
 	CompleteHostMigration_Parms.bLocalPlayerIsHost = bLocalPlayerIsHost;
@@ -17170,10 +16411,9 @@ void USFXOnlineComponentBlazeGame::CompleteHostMigration ( unsigned long bLocalP
 
 bool USFXOnlineComponentBlazeGame::IsHostMigrationInProgress ( )
 {
-	static UFunction* pFnIsHostMigrationInProgress = NULL;
-
+	UFunction* pFnIsHostMigrationInProgress = (UFunction*) SdkBindings::Get ( 3253 );
 	if ( ! pFnIsHostMigrationInProgress )
-		pFnIsHostMigrationInProgress = (UFunction*) UObject::GObjObjects()->Data[ 36723 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execIsHostMigrationInProgress_Parms IsHostMigrationInProgress_Parms;
 
@@ -17193,10 +16433,9 @@ bool USFXOnlineComponentBlazeGame::IsHostMigrationInProgress ( )
 
 bool USFXOnlineComponentBlazeGame::IsReadyForConnections ( )
 {
-	static UFunction* pFnIsReadyForConnections = NULL;
-
+	UFunction* pFnIsReadyForConnections = (UFunction*) SdkBindings::Get ( 3252 );
 	if ( ! pFnIsReadyForConnections )
-		pFnIsReadyForConnections = (UFunction*) UObject::GObjObjects()->Data[ 36721 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execIsReadyForConnections_Parms IsReadyForConnections_Parms;
 
@@ -17216,10 +16455,9 @@ bool USFXOnlineComponentBlazeGame::IsReadyForConnections ( )
 
 bool USFXOnlineComponentBlazeGame::ForceCleanUp ( )
 {
-	static UFunction* pFnForceCleanUp = NULL;
-
+	UFunction* pFnForceCleanUp = (UFunction*) SdkBindings::Get ( 3251 );
 	if ( ! pFnForceCleanUp )
-		pFnForceCleanUp = (UFunction*) UObject::GObjObjects()->Data[ 36719 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execForceCleanUp_Parms ForceCleanUp_Parms;
 
@@ -17239,10 +16477,9 @@ bool USFXOnlineComponentBlazeGame::ForceCleanUp ( )
 
 bool USFXOnlineComponentBlazeGame::OnHostAddressResolved ( )
 {
-	static UFunction* pFnOnHostAddressResolved = NULL;
-
+	UFunction* pFnOnHostAddressResolved = (UFunction*) SdkBindings::Get ( 3250 );
 	if ( ! pFnOnHostAddressResolved )
-		pFnOnHostAddressResolved = (UFunction*) UObject::GObjObjects()->Data[ 36717 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execOnHostAddressResolved_Parms OnHostAddressResolved_Parms;
 
@@ -17264,10 +16501,9 @@ bool USFXOnlineComponentBlazeGame::OnHostAddressResolved ( )
 
 bool USFXOnlineComponentBlazeGame::GetResolvedConnectString ( struct FName SessionName, struct FString* ConnectInfo )
 {
-	static UFunction* pFnGetResolvedConnectString = NULL;
-
+	UFunction* pFnGetResolvedConnectString = (UFunction*) SdkBindings::Get ( 3249 );
 	if ( ! pFnGetResolvedConnectString )
-		pFnGetResolvedConnectString = (UFunction*) UObject::GObjObjects()->Data[ 36713 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execGetResolvedConnectString_Parms GetResolvedConnectString_Parms;
 	memcpy ( &GetResolvedConnectString_Parms.SessionName, &SessionName, 0x8 );
@@ -17293,10 +16529,9 @@ bool USFXOnlineComponentBlazeGame::GetResolvedConnectString ( struct FName Sessi
 
 bool USFXOnlineComponentBlazeGame::AcceptGameInvite ( unsigned char LocalUserNum, struct FName SessionName )
 {
-	static UFunction* pFnAcceptGameInvite = NULL;
-
+	UFunction* pFnAcceptGameInvite = (UFunction*) SdkBindings::Get ( 3248 );
 	if ( ! pFnAcceptGameInvite )
-		pFnAcceptGameInvite = (UFunction*) UObject::GObjObjects()->Data[ 36709 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execAcceptGameInvite_Parms AcceptGameInvite_Parms;
 	AcceptGameInvite_Parms.LocalUserNum = LocalUserNum;
@@ -17321,10 +16556,9 @@ bool USFXOnlineComponentBlazeGame::AcceptGameInvite ( unsigned char LocalUserNum
 
 bool USFXOnlineComponentBlazeGame::UpdateOnlineGame ( struct FName SessionName, class UOnlineGameSettings* UpdatedGameSettings, unsigned long bShouldRefreshOnlineData )
 {
-	static UFunction* pFnUpdateOnlineGame = NULL;
-
+	UFunction* pFnUpdateOnlineGame = (UFunction*) SdkBindings::Get ( 3247 );
 	if ( ! pFnUpdateOnlineGame )
-		pFnUpdateOnlineGame = (UFunction*) UObject::GObjObjects()->Data[ 36704 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execUpdateOnlineGame_Parms UpdateOnlineGame_Parms;
 	memcpy ( &UpdateOnlineGame_Parms.SessionName, &SessionName, 0x8 );
@@ -17348,10 +16582,9 @@ bool USFXOnlineComponentBlazeGame::UpdateOnlineGame ( struct FName SessionName,
 
 bool USFXOnlineComponentBlazeGame::DestroyOnlineGame ( struct FName SessionName )
 {
-	static UFunction* pFnDestroyOnlineGame = NULL;
-
+	UFunction* pFnDestroyOnlineGame = (UFunction*) SdkBindings::Get ( 3246 );
 	if ( ! pFnDestroyOnlineGame )
-		pFnDestroyOnlineGame = (UFunction*) UObject::GObjObjects()->Data[ 36701 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execDestroyOnlineGame_Parms DestroyOnlineGame_Parms;
 	memcpy ( &DestroyOnlineGame_Parms.SessionName, &SessionName, 0x8 );
@@ -17374,10 +16607,9 @@ bool USFXOnlineComponentBlazeGame::DestroyOnlineGame ( struct FName SessionName
 
 bool USFXOnlineComponentBlazeGame::UnregisterPlayer ( struct FName SessionName, struct FUniqueNetId PlayerID )
 {
-	static UFunction* pFnUnregisterPlayer = NULL;
-
+	UFunction* pFnUnregisterPlayer = (UFunction*) SdkBindings::Get ( 3245 );
 	if ( ! pFnUnregisterPlayer )
-		pFnUnregisterPlayer = (UFunction*) UObject::GObjObjects()->Data[ 36697 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execUnregisterPlayer_Parms UnregisterPlayer_Parms;
 	memcpy ( &UnregisterPlayer_Parms.SessionName, &SessionName, 0x8 );
@@ -17402,10 +16634,9 @@ bool USFXOnlineComponentBlazeGame::UnregisterPlayer ( struct FName SessionName,
 
 bool USFXOnlineComponentBlazeGame::RegisterPlayer ( struct FName SessionName, struct FUniqueNetId PlayerID, unsigned long bWasInvited )
 {
-	static UFunction* pFnRegisterPlayer = NULL;
-
+	UFunction* pFnRegisterPlayer = (UFunction*) SdkBindings::Get ( 3244 );
 	if ( ! pFnRegisterPlayer )
-		pFnRegisterPlayer = (UFunction*) UObject::GObjObjects()->Data[ 36692 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execRegisterPlayer_Parms RegisterPlayer_Parms;
 	memcpy ( &RegisterPlayer_Parms.SessionName, &SessionName, 0x8 );
@@ -17429,10 +16660,9 @@ bool USFXOnlineComponentBlazeGame::RegisterPlayer ( struct FName SessionName, st
 
 bool USFXOnlineComponentBlazeGame::EndOnlineGame ( struct FName SessionName )
 {
-	static UFunction* pFnEndOnlineGame = NULL;
-
+	UFunction* pFnEndOnlineGame = (UFunction*) SdkBindings::Get ( 3243 );
 	if ( ! pFnEndOnlineGame )
-		pFnEndOnlineGame = (UFunction*) UObject::GObjObjects()->Data[ 36689 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execEndOnlineGame_Parms EndOnlineGame_Parms;
 	memcpy ( &EndOnlineGame_Parms.SessionName, &SessionName, 0x8 );
@@ -17454,10 +16684,9 @@ bool USFXOnlineComponentBlazeGame::EndOnlineGame ( struct FName SessionName )
 
 bool USFXOnlineComponentBlazeGame::StartOnlineGame ( struct FName SessionName )
 {
-	static UFunction* pFnStartOnlineGame = NULL;
-
+	UFunction* pFnStartOnlineGame = (UFunction*) SdkBindings::Get ( 3242 );
 	if ( ! pFnStartOnlineGame )
-		pFnStartOnlineGame = (UFunction*) UObject::GObjObjects()->Data[ 36686 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execStartOnlineGame_Parms StartOnlineGame_Parms;
 	memcpy ( &StartOnlineGame_Parms.SessionName, &SessionName, 0x8 );
@@ -17481,10 +16710,9 @@ bool USFXOnlineComponentBlazeGame::StartOnlineGame ( struct FName SessionName )
 
 bool USFXOnlineComponentBlazeGame::JoinOnlineGame ( unsigned char PlayerNum, struct FName SessionName, struct FOnlineGameSearchResult* DesiredGame )
 {
-	static UFunction* pFnJoinOnlineGame = NULL;
-
+	UFunction* pFnJoinOnlineGame = (UFunction*) SdkBindings::Get ( 3241 );
 	if ( ! pFnJoinOnlineGame )
-		pFnJoinOnlineGame = (UFunction*) UObject::GObjObjects()->Data[ 36681 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execJoinOnlineGame_Parms JoinOnlineGame_Parms;
 	JoinOnlineGame_Parms.PlayerNum = PlayerNum;
@@ -17511,10 +16739,9 @@ bool USFXOnlineComponentBlazeGame::JoinOnlineGame ( unsigned char PlayerNum, str
 
 bool USFXOnlineComponentBlazeGame::FindOnlineGames ( unsigned char SearchingPlayerNum, class UOnlineGameSearch* SearchSettings )
 {
-	static UFunction* pFnFindOnlineGames = NULL;
-
+	UFunction* pFnFindOnlineGames = (UFunction*) SdkBindings::Get ( 3240 );
 	if ( ! pFnFindOnlineGames )
-		pFnFindOnlineGames = (UFunction*) UObject::GObjObjects()->Data[ 36677 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execFindOnlineGames_Parms FindOnlineGames_Parms;
 	FindOnlineGames_Parms.SearchingPlayerNum = SearchingPlayerNum;
@@ -17539,10 +16766,9 @@ bool USFXOnlineComponentBlazeGame::FindOnlineGames ( unsigned char SearchingPlay
 
 bool USFXOnlineComponentBlazeGame::CreateOnlineGame ( unsigned char HostingPlayerNum, struct FName SessionName, class UOnlineGameSettings* NewGameSettings )
 {
-	static UFunction* pFnCreateOnlineGame = NULL;
-
+	UFunction* pFnCreateOnlineGame = (UFunction*) SdkBindings::Get ( 3239 );
 	if ( ! pFnCreateOnlineGame )
-		pFnCreateOnlineGame = (UFunction*) UObject::GObjObjects()->Data[ 36672 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execCreateOnlineGame_Parms CreateOnlineGame_Parms;
 	CreateOnlineGame_Parms.HostingPlayerNum = HostingPlayerNum;
@@ -17566,10 +16792,9 @@ bool USFXOnlineComponentBlazeGame::CreateOnlineGame ( unsigned char HostingPlaye
 
 void USFXOnlineComponentBlazeGame::GetMultiplayer_MissingDLCs ( unsigned long bInvitee, TArray< struct FMPDLCInfo >* missingDLCs )
 {
-	static UFunction* pFnGetMultiplayer_MissingDLCs = NULL;
-
+	UFunction* pFnGetMultiplayer_MissingDLCs = (UFunction*) SdkBindings::Get ( 3238 );
 	if ( ! pFnGetMultiplayer_MissingDLCs )
-		pFnGetMultiplayer_MissingDLCs = (UFunction*) UObject::GObjObjects()->Data[ 36668 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execGetMultiplayer_MissingDLCs_Parms GetMultiplayer_MissingDLCs_Parms;
 	GetMultiplayer_MissingDLCs_Parms.bInvitee = bInvitee;
@@ -17587,10 +16812,9 @@ void USFXOnlineComponentBlazeGame::GetMultiplayer_MissingDLCs ( unsigned long bI
 
 bool USFXOnlineComponentBlazeGame::IsInvalidHost ( )
 {
-	static UFunction* pFnIsInvalidHost = NULL;
-
+	UFunction* pFnIsInvalidHost = (UFunction*) SdkBindings::Get ( 3237 );
 	if ( ! pFnIsInvalidHost )
-		pFnIsInvalidHost = (UFunction*) UObject::GObjObjects()->Data[ 36666 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execIsInvalidHost_Parms IsInvalidHost_Parms;
 
@@ -17610,10 +16834,9 @@ bool USFXOnlineComponentBlazeGame::IsInvalidHost ( )
 
 void USFXOnlineComponentBlazeGame::eventSetMPDLCInfo ( TArray< struct FMPDLCInfo >* allAvailableDLCs )
 {
-	static UFunction* pFnSetMPDLCInfo = NULL;
-
+	UFunction* pFnSetMPDLCInfo = (UFunction*) SdkBindings::Get ( 3236 );
 	if ( ! pFnSetMPDLCInfo )
-		pFnSetMPDLCInfo = (UFunction*) UObject::GObjObjects()->Data[ 36662 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_eventSetMPDLCInfo_Parms SetMPDLCInfo_Parms;
 
@@ -17630,10 +16853,9 @@ void USFXOnlineComponentBlazeGame::eventSetMPDLCInfo ( TArray< struct FMPDLCInfo
 
 struct FString USFXOnlineComponentBlazeGame::ValidateDLCMasterList ( )
 {
-	static UFunction* pFnValidateDLCMasterList = NULL;
-
+	UFunction* pFnValidateDLCMasterList = (UFunction*) SdkBindings::Get ( 3235 );
 	if ( ! pFnValidateDLCMasterList )
-		pFnValidateDLCMasterList = (UFunction*) UObject::GObjObjects()->Data[ 36660 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execValidateDLCMasterList_Parms ValidateDLCMasterList_Parms;
 
@@ -17653,10 +16875,9 @@ struct FString USFXOnlineComponentBlazeGame::ValidateDLCMasterList ( )
 
 bool USFXOnlineComponentBlazeGame::eventIsTargetVersionRetrieved ( )
 {
-	static UFunction* pFnIsTargetVersionRetrieved = NULL;
-
+	UFunction* pFnIsTargetVersionRetrieved = (UFunction*) SdkBindings::Get ( 3234 );
 	if ( ! pFnIsTargetVersionRetrieved )
-		pFnIsTargetVersionRetrieved = (UFunction*) UObject::GObjObjects()->Data[ 36658 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_eventIsTargetVersionRetrieved_Parms IsTargetVersionRetrieved_Parms;
 
@@ -17672,10 +16893,9 @@ bool USFXOnlineComponentBlazeGame::eventIsTargetVersionRetrieved ( )
 
 bool USFXOnlineComponentBlazeGame::IsOnLatestMultiplayerVersion ( )
 {
-	static UFunction* pFnIsOnLatestMultiplayerVersion = NULL;
-
+	UFunction* pFnIsOnLatestMultiplayerVersion = (UFunction*) SdkBindings::Get ( 3233 );
 	if ( ! pFnIsOnLatestMultiplayerVersion )
-		pFnIsOnLatestMultiplayerVersion = (UFunction*) UObject::GObjObjects()->Data[ 36655 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execIsOnLatestMultiplayerVersion_Parms IsOnLatestMultiplayerVersion_Parms;
 
@@ -17690,10 +16910,9 @@ bool USFXOnlineComponentBlazeGame::IsOnLatestMultiplayerVersion ( )
 
 void USFXOnlineComponentBlazeGame::UpdateGameProtocolVersion ( )
 {
-	static UFunction* pFnUpdateGameProtocolVersion = NULL;
-
+	UFunction* pFnUpdateGameProtocolVersion = (UFunction*) SdkBindings::Get ( 3232 );
 	if ( ! pFnUpdateGameProtocolVersion )
-		pFnUpdateGameProtocolVersion = (UFunction*) UObject::GObjObjects()->Data[ 36654 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execUpdateGameProtocolVersion_Parms UpdateGameProtocolVersion_Parms;
 
@@ -17711,10 +16930,9 @@ void USFXOnlineComponentBlazeGame::UpdateGameProtocolVersion ( )
 
 void USFXOnlineComponentBlazeGame::eventSetServerMatchMakingRulesVersion ( int serverRulesVersion )
 {
-	static UFunction* pFnSetServerMatchMakingRulesVersion = NULL;
-
+	UFunction* pFnSetServerMatchMakingRulesVersion = (UFunction*) SdkBindings::Get ( 3231 );
 	if ( ! pFnSetServerMatchMakingRulesVersion )
-		pFnSetServerMatchMakingRulesVersion = (UFunction*) UObject::GObjObjects()->Data[ 36651 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_eventSetServerMatchMakingRulesVersion_Parms SetServerMatchMakingRulesVersion_Parms;
 	SetServerMatchMakingRulesVersion_Parms.serverRulesVersion = serverRulesVersion;
@@ -17729,10 +16947,9 @@ void USFXOnlineComponentBlazeGame::eventSetServerMatchMakingRulesVersion ( int s
 
 void USFXOnlineComponentBlazeGame::eventSetMultiplayerTargetVersion ( int protocolVersion )
 {
-	static UFunction* pFnSetMultiplayerTargetVersion = NULL;
-
+	UFunction* pFnSetMultiplayerTargetVersion = (UFunction*) SdkBindings::Get ( 3230 );
 	if ( ! pFnSetMultiplayerTargetVersion )
-		pFnSetMultiplayerTargetVersion = (UFunction*) UObject::GObjObjects()->Data[ 36648 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_eventSetMultiplayerTargetVersion_Parms SetMultiplayerTargetVersion_Parms;
 	SetMultiplayerTargetVersion_Parms.protocolVersion = protocolVersion;
@@ -17747,10 +16964,9 @@ void USFXOnlineComponentBlazeGame::eventSetMultiplayerTargetVersion ( int protoc
 
 class USFXOnlineGameSettings* USFXOnlineComponentBlazeGame::eventGetSFXGameSettings ( )
 {
-	static UFunction* pFnGetSFXGameSettings = NULL;
-
+	UFunction* pFnGetSFXGameSettings = (UFunction*) SdkBindings::Get ( 3229 );
 	if ( ! pFnGetSFXGameSettings )
-		pFnGetSFXGameSettings = (UFunction*) UObject::GObjObjects()->Data[ 36645 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_eventGetSFXGameSettings_Parms GetSFXGameSettings_Parms;
 
@@ -17766,10 +16982,9 @@ class USFXOnlineGameSettings* USFXOnlineComponentBlazeGame::eventGetSFXGameSetti
 
 bool USFXOnlineComponentBlazeGame::WasKickedOutOfGame ( )
 {
-	static UFunction* pFnWasKickedOutOfGame = NULL;
-
+	UFunction* pFnWasKickedOutOfGame = (UFunction*) SdkBindings::Get ( 3228 );
 	if ( ! pFnWasKickedOutOfGame )
-		pFnWasKickedOutOfGame = (UFunction*) UObject::GObjObjects()->Data[ 36642 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execWasKickedOutOfGame_Parms WasKickedOutOfGame_Parms;
 
@@ -17785,10 +17000,9 @@ bool USFXOnlineComponentBlazeGame::WasKickedOutOfGame ( )
 
 void USFXOnlineComponentBlazeGame::SetHostViabilityEnabled ( unsigned long Enabled )
 {
-	static UFunction* pFnSetHostViabilityEnabled = NULL;
-
+	UFunction* pFnSetHostViabilityEnabled = (UFunction*) SdkBindings::Get ( 3227 );
 	if ( ! pFnSetHostViabilityEnabled )
-		pFnSetHostViabilityEnabled = (UFunction*) UObject::GObjObjects()->Data[ 36639 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execSetHostViabilityEnabled_Parms SetHostViabilityEnabled_Parms;
 	SetHostViabilityEnabled_Parms.Enabled = Enabled;
@@ -17804,10 +17018,9 @@ void USFXOnlineComponentBlazeGame::SetHostViabilityEnabled ( unsigned long Enabl
 
 bool USFXOnlineComponentBlazeGame::IsLocalPlayer ( struct FUniqueNetId PlayerID )
 {
-	static UFunction* pFnIsLocalPlayer = NULL;
-
+	UFunction* pFnIsLocalPlayer = (UFunction*) SdkBindings::Get ( 3226 );
 	if ( ! pFnIsLocalPlayer )
-		pFnIsLocalPlayer = (UFunction*) UObject::GObjObjects()->Data[ 36636 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execIsLocalPlayer_Parms IsLocalPlayer_Parms;
 	memcpy ( &IsLocalPlayer_Parms.PlayerID, &PlayerID, 0x8 );
@@ -17829,10 +17042,9 @@ bool USFXOnlineComponentBlazeGame::IsLocalPlayer ( struct FUniqueNetId PlayerID
 
 void USFXOnlineComponentBlazeGame::HostMigrationMsgBoxCallback ( unsigned long bAPressed, int Context )
 {
-	static UFunction* pFnHostMigrationMsgBoxCallback = NULL;
-
+	UFunction* pFnHostMigrationMsgBoxCallback = (UFunction*) SdkBindings::Get ( 3225 );
 	if ( ! pFnHostMigrationMsgBoxCallback )
-		pFnHostMigrationMsgBoxCallback = (UFunction*) UObject::GObjObjects()->Data[ 36633 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execHostMigrationMsgBoxCallback_Parms HostMigrationMsgBoxCallback_Parms;
 	HostMigrationMsgBoxCallback_Parms.bAPressed = bAPressed;
@@ -17852,10 +17064,9 @@ void USFXOnlineComponentBlazeGame::HostMigrationMsgBoxCallback ( unsigned long b
 
 bool USFXOnlineComponentBlazeGame::CanMigrate ( )
 {
-	static UFunction* pFnCanMigrate = NULL;
-
+	UFunction* pFnCanMigrate = (UFunction*) SdkBindings::Get ( 3224 );
 	if ( ! pFnCanMigrate )
-		pFnCanMigrate = (UFunction*) UObject::GObjObjects()->Data[ 36631 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execCanMigrate_Parms CanMigrate_Parms;
 
@@ -17874,10 +17085,9 @@ bool USFXOnlineComponentBlazeGame::CanMigrate ( )
 
 void USFXOnlineComponentBlazeGame::CancelJoinOnlineGame ( )
 {
-	static UFunction* pFnCancelJoinOnlineGame = NULL;
-
+	UFunction* pFnCancelJoinOnlineGame = (UFunction*) SdkBindings::Get ( 3223 );
 	if ( ! pFnCancelJoinOnlineGame )
-		pFnCancelJoinOnlineGame = (UFunction*) UObject::GObjObjects()->Data[ 36630 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execCancelJoinOnlineGame_Parms CancelJoinOnlineGame_Parms;
 
@@ -17896,10 +17106,9 @@ void USFXOnlineComponentBlazeGame::CancelJoinOnlineGame ( )
 
 bool USFXOnlineComponentBlazeGame::IsPlayerInGame ( struct FUniqueNetId PlayerID )
 {
-	static UFunction* pFnIsPlayerInGame = NULL;
-
+	UFunction* pFnIsPlayerInGame = (UFunction*) SdkBindings::Get ( 3222 );
 	if ( ! pFnIsPlayerInGame )
-		pFnIsPlayerInGame = (UFunction*) UObject::GObjObjects()->Data[ 36627 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execIsPlayerInGame_Parms IsPlayerInGame_Parms;
 	memcpy ( &IsPlayerInGame_Parms.PlayerID, &PlayerID, 0x8 );
@@ -17920,10 +17129,9 @@ bool USFXOnlineComponentBlazeGame::IsPlayerInGame ( struct FUniqueNetId PlayerID
 
 struct FName USFXOnlineComponentBlazeGame::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3221 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 36625 ];
+		return {};
 
 	USFXOnlineComponentBlazeGame_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -17942,10 +17150,9 @@ struct FName USFXOnlineComponentBlazeGame::GetAPIName ( )
 
 void USFXOnlineComponentBlazeGame::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3220 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 36624 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execOnRelease_Parms OnRelease_Parms;
 
@@ -17963,10 +17170,9 @@ void USFXOnlineComponentBlazeGame::OnRelease ( )
 
 void USFXOnlineComponentBlazeGame::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3219 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 36622 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -17986,10 +17192,9 @@ void USFXOnlineComponentBlazeGame::OnInitialize ( class USFXOnlineSubsystem* oOn
 
 void USFXOnlineComponentBlazeGame::AllowMatchmaking ( unsigned long bAllow, unsigned long bUpdateServer )
 {
-	static UFunction* pFnAllowMatchmaking = NULL;
-
+	UFunction* pFnAllowMatchmaking = (UFunction*) SdkBindings::Get ( 3218 );
 	if ( ! pFnAllowMatchmaking )
-		pFnAllowMatchmaking = (UFunction*) UObject::GObjObjects()->Data[ 36619 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execAllowMatchmaking_Parms AllowMatchmaking_Parms;
 	AllowMatchmaking_Parms.bAllow = bAllow;
@@ -18009,10 +17214,9 @@ void USFXOnlineComponentBlazeGame::AllowMatchmaking ( unsigned long bAllow, unsi
 
 void USFXOnlineComponentBlazeGame::OnGameInviteAccepted ( struct FOnlineGameSearchResult* InviteResult )
 {
-	static UFunction* pFnOnGameInviteAccepted = NULL;
-
+	UFunction* pFnOnGameInviteAccepted = (UFunction*) SdkBindings::Get ( 3212 );
 	if ( ! pFnOnGameInviteAccepted )
-		pFnOnGameInviteAccepted = (UFunction*) UObject::GObjObjects()->Data[ 36589 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execOnGameInviteAccepted_Parms OnGameInviteAccepted_Parms;
 
@@ -18030,10 +17234,9 @@ void USFXOnlineComponentBlazeGame::OnGameInviteAccepted ( struct FOnlineGameSear
 
 void USFXOnlineComponentBlazeGame::OnArbitrationRegistrationComplete ( struct FName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnArbitrationRegistrationComplete = NULL;
-
+	UFunction* pFnOnArbitrationRegistrationComplete = (UFunction*) SdkBindings::Get ( 3217 );
 	if ( ! pFnOnArbitrationRegistrationComplete )
-		pFnOnArbitrationRegistrationComplete = (UFunction*) UObject::GObjObjects()->Data[ 36615 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execOnArbitrationRegistrationComplete_Parms OnArbitrationRegistrationComplete_Parms;
 	memcpy ( &OnArbitrationRegistrationComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -18050,10 +17253,9 @@ void USFXOnlineComponentBlazeGame::OnArbitrationRegistrationComplete ( struct FN
 
 void USFXOnlineComponentBlazeGame::OnEndOnlineGameComplete ( struct FName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnEndOnlineGameComplete = NULL;
-
+	UFunction* pFnOnEndOnlineGameComplete = (UFunction*) SdkBindings::Get ( 3205 );
 	if ( ! pFnOnEndOnlineGameComplete )
-		pFnOnEndOnlineGameComplete = (UFunction*) UObject::GObjObjects()->Data[ 36561 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execOnEndOnlineGameComplete_Parms OnEndOnlineGameComplete_Parms;
 	memcpy ( &OnEndOnlineGameComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -18070,10 +17272,9 @@ void USFXOnlineComponentBlazeGame::OnEndOnlineGameComplete ( struct FName Sessio
 
 void USFXOnlineComponentBlazeGame::OnStartOnlineGameComplete ( struct FName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnStartOnlineGameComplete = NULL;
-
+	UFunction* pFnOnStartOnlineGameComplete = (UFunction*) SdkBindings::Get ( 3216 );
 	if ( ! pFnOnStartOnlineGameComplete )
-		pFnOnStartOnlineGameComplete = (UFunction*) UObject::GObjObjects()->Data[ 36610 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execOnStartOnlineGameComplete_Parms OnStartOnlineGameComplete_Parms;
 	memcpy ( &OnStartOnlineGameComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -18091,10 +17292,9 @@ void USFXOnlineComponentBlazeGame::OnStartOnlineGameComplete ( struct FName Sess
 
 void USFXOnlineComponentBlazeGame::OnUnregisterPlayerComplete ( struct FName SessionName, struct FUniqueNetId PlayerID, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnUnregisterPlayerComplete = NULL;
-
+	UFunction* pFnOnUnregisterPlayerComplete = (UFunction*) SdkBindings::Get ( 3215 );
 	if ( ! pFnOnUnregisterPlayerComplete )
-		pFnOnUnregisterPlayerComplete = (UFunction*) UObject::GObjObjects()->Data[ 36606 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execOnUnregisterPlayerComplete_Parms OnUnregisterPlayerComplete_Parms;
 	memcpy ( &OnUnregisterPlayerComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -18113,10 +17313,9 @@ void USFXOnlineComponentBlazeGame::OnUnregisterPlayerComplete ( struct FName Ses
 
 void USFXOnlineComponentBlazeGame::OnRegisterPlayerComplete ( struct FName SessionName, struct FUniqueNetId PlayerID, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnRegisterPlayerComplete = NULL;
-
+	UFunction* pFnOnRegisterPlayerComplete = (UFunction*) SdkBindings::Get ( 3214 );
 	if ( ! pFnOnRegisterPlayerComplete )
-		pFnOnRegisterPlayerComplete = (UFunction*) UObject::GObjObjects()->Data[ 36602 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execOnRegisterPlayerComplete_Parms OnRegisterPlayerComplete_Parms;
 	memcpy ( &OnRegisterPlayerComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -18134,10 +17333,9 @@ void USFXOnlineComponentBlazeGame::OnRegisterPlayerComplete ( struct FName Sessi
 
 void USFXOnlineComponentBlazeGame::OnJoinOnlineGameComplete ( struct FName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnJoinOnlineGameComplete = NULL;
-
+	UFunction* pFnOnJoinOnlineGameComplete = (UFunction*) SdkBindings::Get ( 3209 );
 	if ( ! pFnOnJoinOnlineGameComplete )
-		pFnOnJoinOnlineGameComplete = (UFunction*) UObject::GObjObjects()->Data[ 36573 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execOnJoinOnlineGameComplete_Parms OnJoinOnlineGameComplete_Parms;
 	memcpy ( &OnJoinOnlineGameComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -18154,10 +17352,9 @@ void USFXOnlineComponentBlazeGame::OnJoinOnlineGameComplete ( struct FName Sessi
 
 void USFXOnlineComponentBlazeGame::OnDestroyOnlineGameComplete ( struct FName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnDestroyOnlineGameComplete = NULL;
-
+	UFunction* pFnOnDestroyOnlineGameComplete = (UFunction*) SdkBindings::Get ( 3211 );
 	if ( ! pFnOnDestroyOnlineGameComplete )
-		pFnOnDestroyOnlineGameComplete = (UFunction*) UObject::GObjObjects()->Data[ 36579 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execOnDestroyOnlineGameComplete_Parms OnDestroyOnlineGameComplete_Parms;
 	memcpy ( &OnDestroyOnlineGameComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -18173,10 +17370,9 @@ void USFXOnlineComponentBlazeGame::OnDestroyOnlineGameComplete ( struct FName Se
 
 void USFXOnlineComponentBlazeGame::OnCancelFindOnlineGamesComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnCancelFindOnlineGamesComplete = NULL;
-
+	UFunction* pFnOnCancelFindOnlineGamesComplete = (UFunction*) SdkBindings::Get ( 3213 );
 	if ( ! pFnOnCancelFindOnlineGamesComplete )
-		pFnOnCancelFindOnlineGamesComplete = (UFunction*) UObject::GObjObjects()->Data[ 36596 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execOnCancelFindOnlineGamesComplete_Parms OnCancelFindOnlineGamesComplete_Parms;
 	OnCancelFindOnlineGamesComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -18191,10 +17387,9 @@ void USFXOnlineComponentBlazeGame::OnCancelFindOnlineGamesComplete ( unsigned lo
 
 void USFXOnlineComponentBlazeGame::OnFindOnlineGamesComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnFindOnlineGamesComplete = NULL;
-
+	UFunction* pFnOnFindOnlineGamesComplete = (UFunction*) SdkBindings::Get ( 3206 );
 	if ( ! pFnOnFindOnlineGamesComplete )
-		pFnOnFindOnlineGamesComplete = (UFunction*) UObject::GObjObjects()->Data[ 36564 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execOnFindOnlineGamesComplete_Parms OnFindOnlineGamesComplete_Parms;
 	OnFindOnlineGamesComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -18210,10 +17405,9 @@ void USFXOnlineComponentBlazeGame::OnFindOnlineGamesComplete ( unsigned long bWa
 
 void USFXOnlineComponentBlazeGame::OnUpdateOnlineGameComplete ( struct FName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnUpdateOnlineGameComplete = NULL;
-
+	UFunction* pFnOnUpdateOnlineGameComplete = (UFunction*) SdkBindings::Get ( 3210 );
 	if ( ! pFnOnUpdateOnlineGameComplete )
-		pFnOnUpdateOnlineGameComplete = (UFunction*) UObject::GObjObjects()->Data[ 36576 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execOnUpdateOnlineGameComplete_Parms OnUpdateOnlineGameComplete_Parms;
 	memcpy ( &OnUpdateOnlineGameComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -18230,10 +17424,9 @@ void USFXOnlineComponentBlazeGame::OnUpdateOnlineGameComplete ( struct FName Ses
 
 void USFXOnlineComponentBlazeGame::OnCreateOnlineGameComplete ( struct FName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnCreateOnlineGameComplete = NULL;
-
+	UFunction* pFnOnCreateOnlineGameComplete = (UFunction*) SdkBindings::Get ( 3207 );
 	if ( ! pFnOnCreateOnlineGameComplete )
-		pFnOnCreateOnlineGameComplete = (UFunction*) UObject::GObjObjects()->Data[ 36567 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execOnCreateOnlineGameComplete_Parms OnCreateOnlineGameComplete_Parms;
 	memcpy ( &OnCreateOnlineGameComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -18249,10 +17442,9 @@ void USFXOnlineComponentBlazeGame::OnCreateOnlineGameComplete ( struct FName Ses
 
 void USFXOnlineComponentBlazeGame::OnQuickMatchComplete ( unsigned char Result )
 {
-	static UFunction* pFnOnQuickMatchComplete = NULL;
-
+	UFunction* pFnOnQuickMatchComplete = (UFunction*) SdkBindings::Get ( 3208 );
 	if ( ! pFnOnQuickMatchComplete )
-		pFnOnQuickMatchComplete = (UFunction*) UObject::GObjObjects()->Data[ 36570 ];
+		return;
 
 	USFXOnlineComponentBlazeGame_execOnQuickMatchComplete_Parms OnQuickMatchComplete_Parms;
 	OnQuickMatchComplete_Parms.Result = Result;
@@ -18267,10 +17459,9 @@ void USFXOnlineComponentBlazeGame::OnQuickMatchComplete ( unsigned char Result )
 
 void USFXOnlineComponentBlazeGameXenon::SetPlatformPresence ( unsigned long presencePrivate )
 {
-	static UFunction* pFnSetPlatformPresence = NULL;
-
+	UFunction* pFnSetPlatformPresence = (UFunction*) SdkBindings::Get ( 3322 );
 	if ( ! pFnSetPlatformPresence )
-		pFnSetPlatformPresence = (UFunction*) UObject::GObjObjects()->Data[ 36950 ];
+		return;
 
 	USFXOnlineComponentBlazeGameXenon_execSetPlatformPresence_Parms SetPlatformPresence_Parms;
 	SetPlatformPresence_Parms.presencePrivate = presencePrivate;
@@ -18289,10 +17480,9 @@ void USFXOnlineComponentBlazeGameXenon::SetPlatformPresence ( unsigned long pres
 
 bool USFXOnlineComponentBlazeGameXenon::PerformCallRestrictedFunction ( )
 {
-	static UFunction* pFnPerformCallRestrictedFunction = NULL;
-
+	UFunction* pFnPerformCallRestrictedFunction = (UFunction*) SdkBindings::Get ( 3321 );
 	if ( ! pFnPerformCallRestrictedFunction )
-		pFnPerformCallRestrictedFunction = (UFunction*) UObject::GObjObjects()->Data[ 36948 ];
+		return {};
 
 	USFXOnlineComponentBlazeGameXenon_execPerformCallRestrictedFunction_Parms PerformCallRestrictedFunction_Parms;
 
@@ -18312,10 +17502,9 @@ bool USFXOnlineComponentBlazeGameXenon::PerformCallRestrictedFunction ( )
 
 void USFXOnlineComponentBlazeGameXenon::SetCallRestrictedFunctionMode ( unsigned long bEnable )
 {
-	static UFunction* pFnSetCallRestrictedFunctionMode = NULL;
-
+	UFunction* pFnSetCallRestrictedFunctionMode = (UFunction*) SdkBindings::Get ( 3320 );
 	if ( ! pFnSetCallRestrictedFunctionMode )
-		pFnSetCallRestrictedFunctionMode = (UFunction*) UObject::GObjObjects()->Data[ 36946 ];
+		return;
 
 	USFXOnlineComponentBlazeGameXenon_execSetCallRestrictedFunctionMode_Parms SetCallRestrictedFunctionMode_Parms;
 	SetCallRestrictedFunctionMode_Parms.bEnable = bEnable;
@@ -18333,10 +17522,9 @@ void USFXOnlineComponentBlazeGameXenon::SetCallRestrictedFunctionMode ( unsigned
 
 void USFXOnlineComponentBlazeGameXenon::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3319 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 36945 ];
+		return;
 
 	USFXOnlineComponentBlazeGameXenon_execOnRelease_Parms OnRelease_Parms;
 
@@ -18354,10 +17542,9 @@ void USFXOnlineComponentBlazeGameXenon::OnRelease ( )
 
 void USFXOnlineComponentBlazeGameXenon::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3318 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 36943 ];
+		return;
 
 	USFXOnlineComponentBlazeGameXenon_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -18376,10 +17563,9 @@ void USFXOnlineComponentBlazeGameXenon::OnInitialize ( class USFXOnlineSubsystem
 
 void USFXOnlineComponentBlazeHub::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
-
+	UFunction* pFnOnTick = (UFunction*) SdkBindings::Get ( 3330 );
 	if ( ! pFnOnTick )
-		pFnOnTick = (UFunction*) UObject::GObjObjects()->Data[ 36970 ];
+		return;
 
 	USFXOnlineComponentBlazeHub_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
@@ -18398,10 +17584,9 @@ void USFXOnlineComponentBlazeHub::OnTick ( class USFXOnlineEvent* oEvent )
 
 bool USFXOnlineComponentBlazeHub::Idle ( )
 {
-	static UFunction* pFnIdle = NULL;
-
+	UFunction* pFnIdle = (UFunction*) SdkBindings::Get ( 3329 );
 	if ( ! pFnIdle )
-		pFnIdle = (UFunction*) UObject::GObjObjects()->Data[ 36968 ];
+		return {};
 
 	USFXOnlineComponentBlazeHub_execIdle_Parms Idle_Parms;
 
@@ -18420,10 +17605,9 @@ bool USFXOnlineComponentBlazeHub::Idle ( )
 
 void USFXOnlineComponentBlazeHub::ResetLocale ( )
 {
-	static UFunction* pFnResetLocale = NULL;
-
+	UFunction* pFnResetLocale = (UFunction*) SdkBindings::Get ( 3328 );
 	if ( ! pFnResetLocale )
-		pFnResetLocale = (UFunction*) UObject::GObjObjects()->Data[ 36967 ];
+		return;
 
 	USFXOnlineComponentBlazeHub_execResetLocale_Parms ResetLocale_Parms;
 
@@ -18441,10 +17625,9 @@ void USFXOnlineComponentBlazeHub::ResetLocale ( )
 
 int USFXOnlineComponentBlazeHub::GetCurrentTime ( )
 {
-	static UFunction* pFnGetCurrentTime = NULL;
-
+	UFunction* pFnGetCurrentTime = (UFunction*) SdkBindings::Get ( 3327 );
 	if ( ! pFnGetCurrentTime )
-		pFnGetCurrentTime = (UFunction*) UObject::GObjObjects()->Data[ 36965 ];
+		return {};
 
 	USFXOnlineComponentBlazeHub_execGetCurrentTime_Parms GetCurrentTime_Parms;
 
@@ -18464,10 +17647,9 @@ int USFXOnlineComponentBlazeHub::GetCurrentTime ( )
 
 struct FName USFXOnlineComponentBlazeHub::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3326 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 36963 ];
+		return {};
 
 	USFXOnlineComponentBlazeHub_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -18487,10 +17669,9 @@ struct FName USFXOnlineComponentBlazeHub::GetAPIName ( )
 
 bool USFXOnlineComponentBlazeHub::ConnectDirtySock ( )
 {
-	static UFunction* pFnConnectDirtySock = NULL;
-
+	UFunction* pFnConnectDirtySock = (UFunction*) SdkBindings::Get ( 3325 );
 	if ( ! pFnConnectDirtySock )
-		pFnConnectDirtySock = (UFunction*) UObject::GObjObjects()->Data[ 36961 ];
+		return {};
 
 	USFXOnlineComponentBlazeHub_execConnectDirtySock_Parms ConnectDirtySock_Parms;
 
@@ -18509,10 +17690,9 @@ bool USFXOnlineComponentBlazeHub::ConnectDirtySock ( )
 
 void USFXOnlineComponentBlazeHub::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3324 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 36960 ];
+		return;
 
 	USFXOnlineComponentBlazeHub_execOnRelease_Parms OnRelease_Parms;
 
@@ -18530,10 +17710,9 @@ void USFXOnlineComponentBlazeHub::OnRelease ( )
 
 void USFXOnlineComponentBlazeHub::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3323 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 36958 ];
+		return;
 
 	USFXOnlineComponentBlazeHub_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -18552,10 +17731,9 @@ void USFXOnlineComponentBlazeHub::OnInitialize ( class USFXOnlineSubsystem* oOnl
 
 void USFXOnlineComponentBlazeLeaderboard::eventTriggerEmptyCallback ( unsigned char nErrorCode )
 {
-	static UFunction* pFnTriggerEmptyCallback = NULL;
-
+	UFunction* pFnTriggerEmptyCallback = (UFunction*) SdkBindings::Get ( 3368 );
 	if ( ! pFnTriggerEmptyCallback )
-		pFnTriggerEmptyCallback = (UFunction*) UObject::GObjObjects()->Data[ 37149 ];
+		return;
 
 	USFXOnlineComponentBlazeLeaderboard_eventTriggerEmptyCallback_Parms TriggerEmptyCallback_Parms;
 	TriggerEmptyCallback_Parms.nErrorCode = nErrorCode;
@@ -18570,10 +17748,9 @@ void USFXOnlineComponentBlazeLeaderboard::eventTriggerEmptyCallback ( unsigned c
 
 class USFXOnlineJobGetLeaderboardList* USFXOnlineComponentBlazeLeaderboard::eventCreateJobGetLeaderboardList ( )
 {
-	static UFunction* pFnCreateJobGetLeaderboardList = NULL;
-
+	UFunction* pFnCreateJobGetLeaderboardList = (UFunction*) SdkBindings::Get ( 3366 );
 	if ( ! pFnCreateJobGetLeaderboardList )
-		pFnCreateJobGetLeaderboardList = (UFunction*) UObject::GObjObjects()->Data[ 37145 ];
+		return {};
 
 	USFXOnlineComponentBlazeLeaderboard_eventCreateJobGetLeaderboardList_Parms CreateJobGetLeaderboardList_Parms;
 
@@ -18593,10 +17770,9 @@ class USFXOnlineJobGetLeaderboardList* USFXOnlineComponentBlazeLeaderboard::even
 
 class USFXOnlineJobGetLeaderboardData* USFXOnlineComponentBlazeLeaderboard::eventCreateJobGetStatsData ( struct FLeaderboardStatScope oScope, int nRankRange, struct FScriptDelegate funcResultsRetrieved, struct FPointer pExternalData )
 {
-	static UFunction* pFnCreateJobGetStatsData = NULL;
-
+	UFunction* pFnCreateJobGetStatsData = (UFunction*) SdkBindings::Get ( 3364 );
 	if ( ! pFnCreateJobGetStatsData )
-		pFnCreateJobGetStatsData = (UFunction*) UObject::GObjObjects()->Data[ 37137 ];
+		return {};
 
 	USFXOnlineComponentBlazeLeaderboard_eventCreateJobGetStatsData_Parms CreateJobGetStatsData_Parms;
 	memcpy ( &CreateJobGetStatsData_Parms.oScope, &oScope, 0xC );
@@ -18619,10 +17795,9 @@ class USFXOnlineJobGetLeaderboardData* USFXOnlineComponentBlazeLeaderboard::even
 
 class USFXOnlineJobGetLeaderboardData* USFXOnlineComponentBlazeLeaderboard::eventCreateJobGetFriendLeaderboardData ( int nLBID, struct FScriptDelegate funcResultsRetrieved, struct FPointer pExternalData )
 {
-	static UFunction* pFnCreateJobGetFriendLeaderboardData = NULL;
-
+	UFunction* pFnCreateJobGetFriendLeaderboardData = (UFunction*) SdkBindings::Get ( 3362 );
 	if ( ! pFnCreateJobGetFriendLeaderboardData )
-		pFnCreateJobGetFriendLeaderboardData = (UFunction*) UObject::GObjObjects()->Data[ 37130 ];
+		return {};
 
 	USFXOnlineComponentBlazeLeaderboard_eventCreateJobGetFriendLeaderboardData_Parms CreateJobGetFriendLeaderboardData_Parms;
 	CreateJobGetFriendLeaderboardData_Parms.nLBID = nLBID;
@@ -18646,10 +17821,9 @@ class USFXOnlineJobGetLeaderboardData* USFXOnlineComponentBlazeLeaderboard::even
 
 class USFXOnlineJobGetLeaderboardData* USFXOnlineComponentBlazeLeaderboard::eventCreateJobGetLeaderboardCenteredData ( int nLBID, struct FUniqueNetId nPlayerId, int nRankRange, struct FScriptDelegate funcResultsRetrieved, struct FPointer pExternalData )
 {
-	static UFunction* pFnCreateJobGetLeaderboardCenteredData = NULL;
-
+	UFunction* pFnCreateJobGetLeaderboardCenteredData = (UFunction*) SdkBindings::Get ( 3360 );
 	if ( ! pFnCreateJobGetLeaderboardCenteredData )
-		pFnCreateJobGetLeaderboardCenteredData = (UFunction*) UObject::GObjObjects()->Data[ 37121 ];
+		return {};
 
 	USFXOnlineComponentBlazeLeaderboard_eventCreateJobGetLeaderboardCenteredData_Parms CreateJobGetLeaderboardCenteredData_Parms;
 	CreateJobGetLeaderboardCenteredData_Parms.nLBID = nLBID;
@@ -18675,10 +17849,9 @@ class USFXOnlineJobGetLeaderboardData* USFXOnlineComponentBlazeLeaderboard::even
 
 class USFXOnlineJobGetLeaderboardData* USFXOnlineComponentBlazeLeaderboard::eventCreateJobGetLeaderboardData ( int nLBID, int nRankStart, int nRankRange, struct FScriptDelegate funcResultsRetrieved, struct FPointer pExternalData )
 {
-	static UFunction* pFnCreateJobGetLeaderboardData = NULL;
-
+	UFunction* pFnCreateJobGetLeaderboardData = (UFunction*) SdkBindings::Get ( 3358 );
 	if ( ! pFnCreateJobGetLeaderboardData )
-		pFnCreateJobGetLeaderboardData = (UFunction*) UObject::GObjObjects()->Data[ 37112 ];
+		return {};
 
 	USFXOnlineComponentBlazeLeaderboard_eventCreateJobGetLeaderboardData_Parms CreateJobGetLeaderboardData_Parms;
 	CreateJobGetLeaderboardData_Parms.nLBID = nLBID;
@@ -18699,10 +17872,9 @@ class USFXOnlineJobGetLeaderboardData* USFXOnlineComponentBlazeLeaderboard::even
 
 struct FName USFXOnlineComponentBlazeLeaderboard::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3357 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 37110 ];
+		return {};
 
 	USFXOnlineComponentBlazeLeaderboard_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -18721,10 +17893,9 @@ struct FName USFXOnlineComponentBlazeLeaderboard::GetAPIName ( )
 
 void USFXOnlineComponentBlazeLeaderboard::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3356 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 37109 ];
+		return;
 
 	USFXOnlineComponentBlazeLeaderboard_execOnRelease_Parms OnRelease_Parms;
 
@@ -18742,10 +17913,9 @@ void USFXOnlineComponentBlazeLeaderboard::OnRelease ( )
 
 void USFXOnlineComponentBlazeLeaderboard::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3355 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 37107 ];
+		return;
 
 	USFXOnlineComponentBlazeLeaderboard_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -18771,10 +17941,9 @@ void USFXOnlineComponentBlazeLeaderboard::OnInitialize ( class USFXOnlineSubsyst
 
 int USFXOnlineComponentBlazeLeaderboard::GetLeaderboard ( int pLbId, int nRecordsStartRank, int nRecordsRange, unsigned long bCenteredData, unsigned long bFriendData, struct FUniqueNetId pPlayerId, struct FPointer pExternalData )
 {
-	static UFunction* pFnGetLeaderboard = NULL;
-
+	UFunction* pFnGetLeaderboard = (UFunction*) SdkBindings::Get ( 3353 );
 	if ( ! pFnGetLeaderboard )
-		pFnGetLeaderboard = (UFunction*) UObject::GObjObjects()->Data[ 37097 ];
+		return {};
 
 	USFXOnlineComponentBlazeLeaderboard_execGetLeaderboard_Parms GetLeaderboard_Parms;
 	GetLeaderboard_Parms.pLbId = pLbId;
@@ -18800,10 +17969,9 @@ int USFXOnlineComponentBlazeLeaderboard::GetLeaderboard ( int pLbId, int nRecord
 
 void USFXOnlineComponentBlazeLeaderboard::RefreshLeaderboardTitles ( )
 {
-	static UFunction* pFnRefreshLeaderboardTitles = NULL;
-
+	UFunction* pFnRefreshLeaderboardTitles = (UFunction*) SdkBindings::Get ( 3354 );
 	if ( ! pFnRefreshLeaderboardTitles )
-		pFnRefreshLeaderboardTitles = (UFunction*) UObject::GObjObjects()->Data[ 37106 ];
+		return;
 
 	USFXOnlineComponentBlazeLeaderboard_execRefreshLeaderboardTitles_Parms RefreshLeaderboardTitles_Parms;
 
@@ -18823,10 +17991,9 @@ void USFXOnlineComponentBlazeLeaderboard::RefreshLeaderboardTitles ( )
 
 int USFXOnlineComponentBlazeLeaderboard::ShowGamerCardForRecord ( unsigned char LocalUserNum, struct FLeaderboardRecord* Record )
 {
-	static UFunction* pFnShowGamerCardForRecord = NULL;
-
+	UFunction* pFnShowGamerCardForRecord = (UFunction*) SdkBindings::Get ( 3352 );
 	if ( ! pFnShowGamerCardForRecord )
-		pFnShowGamerCardForRecord = (UFunction*) UObject::GObjObjects()->Data[ 37093 ];
+		return {};
 
 	USFXOnlineComponentBlazeLeaderboard_execShowGamerCardForRecord_Parms ShowGamerCardForRecord_Parms;
 	ShowGamerCardForRecord_Parms.LocalUserNum = LocalUserNum;
@@ -18851,10 +18018,9 @@ int USFXOnlineComponentBlazeLeaderboard::ShowGamerCardForRecord ( unsigned char
 
 void USFXOnlineComponentBlazeLeaderboard::ReadLeaderboardList ( struct FScriptDelegate funcReadLbListCompleted, TArray< int >* jobIds )
 {
-	static UFunction* pFnReadLeaderboardList = NULL;
-
+	UFunction* pFnReadLeaderboardList = (UFunction*) SdkBindings::Get ( 3351 );
 	if ( ! pFnReadLeaderboardList )
-		pFnReadLeaderboardList = (UFunction*) UObject::GObjObjects()->Data[ 37089 ];
+		return;
 
 	USFXOnlineComponentBlazeLeaderboard_execReadLeaderboardList_Parms ReadLeaderboardList_Parms;
 	memcpy ( &ReadLeaderboardList_Parms.funcReadLbListCompleted, &funcReadLbListCompleted, 0xC );
@@ -18879,10 +18045,9 @@ void USFXOnlineComponentBlazeLeaderboard::ReadLeaderboardList ( struct FScriptDe
 
 int USFXOnlineComponentBlazeLeaderboard::GetFriendLeaderboardData ( int pLbId, struct FScriptDelegate funcResultsRetrieved, struct FPointer pExternalData )
 {
-	static UFunction* pFnGetFriendLeaderboardData = NULL;
-
+	UFunction* pFnGetFriendLeaderboardData = (UFunction*) SdkBindings::Get ( 3350 );
 	if ( ! pFnGetFriendLeaderboardData )
-		pFnGetFriendLeaderboardData = (UFunction*) UObject::GObjObjects()->Data[ 37084 ];
+		return {};
 
 	USFXOnlineComponentBlazeLeaderboard_execGetFriendLeaderboardData_Parms GetFriendLeaderboardData_Parms;
 	GetFriendLeaderboardData_Parms.pLbId = pLbId;
@@ -18910,10 +18075,9 @@ int USFXOnlineComponentBlazeLeaderboard::GetFriendLeaderboardData ( int pLbId, s
 
 int USFXOnlineComponentBlazeLeaderboard::GetLeaderboardCenteredData ( int pLbId, struct FUniqueNetId nPlayerId, int nRankRange, struct FScriptDelegate funcResultsRetrieved, struct FPointer pExternalData )
 {
-	static UFunction* pFnGetLeaderboardCenteredData = NULL;
-
+	UFunction* pFnGetLeaderboardCenteredData = (UFunction*) SdkBindings::Get ( 3349 );
 	if ( ! pFnGetLeaderboardCenteredData )
-		pFnGetLeaderboardCenteredData = (UFunction*) UObject::GObjObjects()->Data[ 37077 ];
+		return {};
 
 	USFXOnlineComponentBlazeLeaderboard_execGetLeaderboardCenteredData_Parms GetLeaderboardCenteredData_Parms;
 	GetLeaderboardCenteredData_Parms.pLbId = pLbId;
@@ -18943,10 +18107,9 @@ int USFXOnlineComponentBlazeLeaderboard::GetLeaderboardCenteredData ( int pLbId,
 
 int USFXOnlineComponentBlazeLeaderboard::GetLeaderboardData ( int pLbId, int nRankStart, int nRankRange, struct FScriptDelegate funcResultsRetrieved, struct FPointer pExternalData )
 {
-	static UFunction* pFnGetLeaderboardData = NULL;
-
+	UFunction* pFnGetLeaderboardData = (UFunction*) SdkBindings::Get ( 3348 );
 	if ( ! pFnGetLeaderboardData )
-		pFnGetLeaderboardData = (UFunction*) UObject::GObjObjects()->Data[ 37070 ];
+		return {};
 
 	USFXOnlineComponentBlazeLeaderboard_execGetLeaderboardData_Parms GetLeaderboardData_Parms;
 	GetLeaderboardData_Parms.pLbId = pLbId;
@@ -18971,10 +18134,9 @@ int USFXOnlineComponentBlazeLeaderboard::GetLeaderboardData ( int pLbId, int nRa
 
 bool USFXOnlineComponentBlazeLeaderboard::HasNotificationsAvailable ( )
 {
-	static UFunction* pFnHasNotificationsAvailable = NULL;
-
+	UFunction* pFnHasNotificationsAvailable = (UFunction*) SdkBindings::Get ( 3347 );
 	if ( ! pFnHasNotificationsAvailable )
-		pFnHasNotificationsAvailable = (UFunction*) UObject::GObjObjects()->Data[ 37068 ];
+		return {};
 
 	USFXOnlineComponentBlazeLeaderboard_execHasNotificationsAvailable_Parms HasNotificationsAvailable_Parms;
 
@@ -18990,10 +18152,9 @@ bool USFXOnlineComponentBlazeLeaderboard::HasNotificationsAvailable ( )
 
 TArray< struct FRankBypassNotification > USFXOnlineComponentBlazeLeaderboard::GetCurrentRankNotificationsArray ( )
 {
-	static UFunction* pFnGetCurrentRankNotificationsArray = NULL;
-
+	UFunction* pFnGetCurrentRankNotificationsArray = (UFunction*) SdkBindings::Get ( 3346 );
 	if ( ! pFnGetCurrentRankNotificationsArray )
-		pFnGetCurrentRankNotificationsArray = (UFunction*) UObject::GObjObjects()->Data[ 37065 ];
+		return {};
 
 	USFXOnlineComponentBlazeLeaderboard_execGetCurrentRankNotificationsArray_Parms GetCurrentRankNotificationsArray_Parms;
 
@@ -19009,10 +18170,9 @@ TArray< struct FRankBypassNotification > USFXOnlineComponentBlazeLeaderboard::Ge
 
 void USFXOnlineComponentBlazeLeaderboard::eventRemoveRankNotificationCallback ( struct FScriptDelegate Callback )
 {
-	static UFunction* pFnRemoveRankNotificationCallback = NULL;
-
+	UFunction* pFnRemoveRankNotificationCallback = (UFunction*) SdkBindings::Get ( 3345 );
 	if ( ! pFnRemoveRankNotificationCallback )
-		pFnRemoveRankNotificationCallback = (UFunction*) UObject::GObjObjects()->Data[ 37063 ];
+		return;
 
 	USFXOnlineComponentBlazeLeaderboard_eventRemoveRankNotificationCallback_Parms RemoveRankNotificationCallback_Parms;
 	memcpy ( &RemoveRankNotificationCallback_Parms.Callback, &Callback, 0xC );
@@ -19027,10 +18187,9 @@ void USFXOnlineComponentBlazeLeaderboard::eventRemoveRankNotificationCallback (
 
 void USFXOnlineComponentBlazeLeaderboard::eventAddRankNotificationCallback ( struct FScriptDelegate Callback )
 {
-	static UFunction* pFnAddRankNotificationCallback = NULL;
-
+	UFunction* pFnAddRankNotificationCallback = (UFunction*) SdkBindings::Get ( 3344 );
 	if ( ! pFnAddRankNotificationCallback )
-		pFnAddRankNotificationCallback = (UFunction*) UObject::GObjObjects()->Data[ 37061 ];
+		return;
 
 	USFXOnlineComponentBlazeLeaderboard_eventAddRankNotificationCallback_Parms AddRankNotificationCallback_Parms;
 	memcpy ( &AddRankNotificationCallback_Parms.Callback, &Callback, 0xC );
@@ -19045,10 +18204,9 @@ void USFXOnlineComponentBlazeLeaderboard::eventAddRankNotificationCallback ( str
 
 void USFXOnlineComponentBlazeLeaderboard::OnDisconnect ( class USFXOnlineEvent* OnlineEvent )
 {
-	static UFunction* pFnOnDisconnect = NULL;
-
+	UFunction* pFnOnDisconnect = (UFunction*) SdkBindings::Get ( 3343 );
 	if ( ! pFnOnDisconnect )
-		pFnOnDisconnect = (UFunction*) UObject::GObjObjects()->Data[ 37059 ];
+		return;
 
 	USFXOnlineComponentBlazeLeaderboard_execOnDisconnect_Parms OnDisconnect_Parms;
 	OnDisconnect_Parms.OnlineEvent = OnlineEvent;
@@ -19062,10 +18220,9 @@ void USFXOnlineComponentBlazeLeaderboard::OnDisconnect ( class USFXOnlineEvent*
 
 void USFXOnlineComponentBlazeLeaderboard::CancelLeaderboardRequests ( )
 {
-	static UFunction* pFnCancelLeaderboardRequests = NULL;
-
+	UFunction* pFnCancelLeaderboardRequests = (UFunction*) SdkBindings::Get ( 3342 );
 	if ( ! pFnCancelLeaderboardRequests )
-		pFnCancelLeaderboardRequests = (UFunction*) UObject::GObjObjects()->Data[ 37058 ];
+		return;
 
 	USFXOnlineComponentBlazeLeaderboard_execCancelLeaderboardRequests_Parms CancelLeaderboardRequests_Parms;
 
@@ -19082,10 +18239,9 @@ void USFXOnlineComponentBlazeLeaderboard::CancelLeaderboardRequests ( )
 
 void USFXOnlineComponentBlazeLeaderboard::RequestReadLeaderboardList ( )
 {
-	static UFunction* pFnRequestReadLeaderboardList = NULL;
-
+	UFunction* pFnRequestReadLeaderboardList = (UFunction*) SdkBindings::Get ( 3340 );
 	if ( ! pFnRequestReadLeaderboardList )
-		pFnRequestReadLeaderboardList = (UFunction*) UObject::GObjObjects()->Data[ 37056 ];
+		return;
 
 	USFXOnlineComponentBlazeLeaderboard_execRequestReadLeaderboardList_Parms RequestReadLeaderboardList_Parms;
 
@@ -19106,10 +18262,9 @@ void USFXOnlineComponentBlazeLeaderboard::RequestReadLeaderboardList ( )
 
 bool USFXOnlineComponentBlazeLeaderboard::GenerateHistoricalFriendData ( TArray< struct FLeaderboardRecord > aResults, int* nPreviousLocalUserRank, struct FString* friendsBlob )
 {
-	static UFunction* pFnGenerateHistoricalFriendData = NULL;
-
+	UFunction* pFnGenerateHistoricalFriendData = (UFunction*) SdkBindings::Get ( 3341 );
 	if ( ! pFnGenerateHistoricalFriendData )
-		pFnGenerateHistoricalFriendData = (UFunction*) UObject::GObjObjects()->Data[ 37057 ];
+		return {};
 
 	USFXOnlineComponentBlazeLeaderboard_execGenerateHistoricalFriendData_Parms GenerateHistoricalFriendData_Parms;
 	memcpy ( &GenerateHistoricalFriendData_Parms.aResults, &aResults, 0xC );
@@ -19140,10 +18295,9 @@ bool USFXOnlineComponentBlazeLeaderboard::GenerateHistoricalFriendData ( TArray<
 
 void USFXOnlineComponentBlazeLeaderboard::ProcessHistoricalFriendData ( int nPreviousLocalUserRank, struct FString friendsBlob, void* srIBeatMyFriend, void* srIWasBeatByFriend, TArray< struct FLeaderboardRecord > aResults )
 {
-	static UFunction* pFnProcessHistoricalFriendData = NULL;
-
+	UFunction* pFnProcessHistoricalFriendData = (UFunction*) SdkBindings::Get ( 3369 );
 	if ( ! pFnProcessHistoricalFriendData )
-		pFnProcessHistoricalFriendData = (UFunction*) UObject::GObjObjects()->Data[ 37191 ];
+		return;
 
 	USFXOnlineComponentBlazeLeaderboard_execProcessHistoricalFriendData_Parms ProcessHistoricalFriendData_Parms;
 	ProcessHistoricalFriendData_Parms.nPreviousLocalUserRank = nPreviousLocalUserRank;
@@ -19165,10 +18319,9 @@ void USFXOnlineComponentBlazeLeaderboard::ProcessHistoricalFriendData ( int nPre
 
 void USFXOnlineComponentBlazeLeaderboard::GenerateHistoricalFriendDataRecords ( )
 {
-	static UFunction* pFnGenerateHistoricalFriendDataRecords = NULL;
-
+	UFunction* pFnGenerateHistoricalFriendDataRecords = (UFunction*) SdkBindings::Get ( 3370 );
 	if ( ! pFnGenerateHistoricalFriendDataRecords )
-		pFnGenerateHistoricalFriendDataRecords = (UFunction*) UObject::GObjObjects()->Data[ 37197 ];
+		return;
 
 	USFXOnlineComponentBlazeLeaderboard_execGenerateHistoricalFriendDataRecords_Parms GenerateHistoricalFriendDataRecords_Parms;
 
@@ -19191,10 +18344,9 @@ void USFXOnlineComponentBlazeLeaderboard::GenerateHistoricalFriendDataRecords (
 
 void USFXOnlineComponentBlazeLeaderboard::RankNotification_ChallengePointLeaderboardCb ( TArray< struct FLeaderboardColumn > aColumInfo, TArray< struct FLeaderboardRecord > aResults, int iTotalRanks, struct FUniqueNetId uidEntity, unsigned char nErrorCode, struct FPointer pExternalData )
 {
-	static UFunction* pFnRankNotification_ChallengePointLeaderboardCb = NULL;
-
+	UFunction* pFnRankNotification_ChallengePointLeaderboardCb = (UFunction*) SdkBindings::Get ( 3371 );
 	if ( ! pFnRankNotification_ChallengePointLeaderboardCb )
-		pFnRankNotification_ChallengePointLeaderboardCb = (UFunction*) UObject::GObjObjects()->Data[ 37204 ];
+		return;
 
 	USFXOnlineComponentBlazeLeaderboard_execRankNotification_ChallengePointLeaderboardCb_Parms RankNotification_ChallengePointLeaderboardCb_Parms;
 	memcpy ( &RankNotification_ChallengePointLeaderboardCb_Parms.aColumInfo, &aColumInfo, 0xC );
@@ -19223,10 +18375,9 @@ void USFXOnlineComponentBlazeLeaderboard::RankNotification_ChallengePointLeaderb
 
 void USFXOnlineComponentBlazeLeaderboard::RankNotification_N7RatingLeaderboardCb ( TArray< struct FLeaderboardColumn > aColumInfo, TArray< struct FLeaderboardRecord > aResults, int iTotalRanks, struct FUniqueNetId uidEntity, unsigned char nErrorCode, struct FPointer pExternalData )
 {
-	static UFunction* pFnRankNotification_N7RatingLeaderboardCb = NULL;
-
+	UFunction* pFnRankNotification_N7RatingLeaderboardCb = (UFunction*) SdkBindings::Get ( 3372 );
 	if ( ! pFnRankNotification_N7RatingLeaderboardCb )
-		pFnRankNotification_N7RatingLeaderboardCb = (UFunction*) UObject::GObjObjects()->Data[ 37205 ];
+		return;
 
 	USFXOnlineComponentBlazeLeaderboard_execRankNotification_N7RatingLeaderboardCb_Parms RankNotification_N7RatingLeaderboardCb_Parms;
 	memcpy ( &RankNotification_N7RatingLeaderboardCb_Parms.aColumInfo, &aColumInfo, 0xC );
@@ -19252,10 +18403,9 @@ void USFXOnlineComponentBlazeLeaderboard::RankNotification_N7RatingLeaderboardCb
 
 void USFXOnlineComponentBlazeLeaderboard::RequestFriendLeaderboardData ( struct FLeaderboardDefinition LeaderboardDef, struct FScriptDelegate funcResultsRetrieved, struct FPointer pExternalData )
 {
-	static UFunction* pFnRequestFriendLeaderboardData = NULL;
-
+	UFunction* pFnRequestFriendLeaderboardData = (UFunction*) SdkBindings::Get ( 3339 );
 	if ( ! pFnRequestFriendLeaderboardData )
-		pFnRequestFriendLeaderboardData = (UFunction*) UObject::GObjObjects()->Data[ 37052 ];
+		return;
 
 	USFXOnlineComponentBlazeLeaderboard_execRequestFriendLeaderboardData_Parms RequestFriendLeaderboardData_Parms;
 	memcpy ( &RequestFriendLeaderboardData_Parms.LeaderboardDef, &LeaderboardDef, 0x14 );
@@ -19275,10 +18425,9 @@ void USFXOnlineComponentBlazeLeaderboard::RequestFriendLeaderboardData ( struct
 
 void USFXOnlineComponentBlazeLeaderboard::GetRankNotifications ( )
 {
-	static UFunction* pFnGetRankNotifications = NULL;
-
+	UFunction* pFnGetRankNotifications = (UFunction*) SdkBindings::Get ( 3338 );
 	if ( ! pFnGetRankNotifications )
-		pFnGetRankNotifications = (UFunction*) UObject::GObjObjects()->Data[ 37051 ];
+		return;
 
 	USFXOnlineComponentBlazeLeaderboard_execGetRankNotifications_Parms GetRankNotifications_Parms;
 
@@ -19300,10 +18449,9 @@ void USFXOnlineComponentBlazeLeaderboard::GetRankNotifications ( )
 
 void USFXOnlineComponentBlazeLeaderboard::RequestLeaderboardCenteredData ( struct FLeaderboardDefinition LeaderboardDef, struct FUniqueNetId nPlayerId, int nRankRange, struct FScriptDelegate funcResultsRetrieved, struct FPointer pExternalData )
 {
-	static UFunction* pFnRequestLeaderboardCenteredData = NULL;
-
+	UFunction* pFnRequestLeaderboardCenteredData = (UFunction*) SdkBindings::Get ( 3337 );
 	if ( ! pFnRequestLeaderboardCenteredData )
-		pFnRequestLeaderboardCenteredData = (UFunction*) UObject::GObjObjects()->Data[ 37045 ];
+		return;
 
 	USFXOnlineComponentBlazeLeaderboard_execRequestLeaderboardCenteredData_Parms RequestLeaderboardCenteredData_Parms;
 	memcpy ( &RequestLeaderboardCenteredData_Parms.LeaderboardDef, &LeaderboardDef, 0x14 );
@@ -19330,10 +18478,9 @@ void USFXOnlineComponentBlazeLeaderboard::RequestLeaderboardCenteredData ( struc
 
 void USFXOnlineComponentBlazeLeaderboard::RequestLeaderboardData ( struct FLeaderboardDefinition LeaderboardDef, int nRankStart, int nRankRange, struct FScriptDelegate funcResultsRetrieved, struct FPointer pExternalData )
 {
-	static UFunction* pFnRequestLeaderboardData = NULL;
-
+	UFunction* pFnRequestLeaderboardData = (UFunction*) SdkBindings::Get ( 3336 );
 	if ( ! pFnRequestLeaderboardData )
-		pFnRequestLeaderboardData = (UFunction*) UObject::GObjObjects()->Data[ 37039 ];
+		return;
 
 	USFXOnlineComponentBlazeLeaderboard_execRequestLeaderboardData_Parms RequestLeaderboardData_Parms;
 	memcpy ( &RequestLeaderboardData_Parms.LeaderboardDef, &LeaderboardDef, 0x14 );
@@ -19357,10 +18504,9 @@ void USFXOnlineComponentBlazeLeaderboard::RequestLeaderboardData ( struct FLeade
 
 bool USFXOnlineComponentBlazeLeaderboard::GetLeaderboardDefinitionTable ( TArray< struct FLeaderboardMapGroup >* aLBDefTableRows )
 {
-	static UFunction* pFnGetLeaderboardDefinitionTable = NULL;
-
+	UFunction* pFnGetLeaderboardDefinitionTable = (UFunction*) SdkBindings::Get ( 3335 );
 	if ( ! pFnGetLeaderboardDefinitionTable )
-		pFnGetLeaderboardDefinitionTable = (UFunction*) UObject::GObjObjects()->Data[ 37035 ];
+		return {};
 
 	USFXOnlineComponentBlazeLeaderboard_execGetLeaderboardDefinitionTable_Parms GetLeaderboardDefinitionTable_Parms;
 
@@ -19384,10 +18530,9 @@ bool USFXOnlineComponentBlazeLeaderboard::GetLeaderboardDefinitionTable ( TArray
 
 bool USFXOnlineComponentBlazeLeaderboard::GetLeaderboardDefinitions ( TArray< struct FLeaderboardDefinition >* aLBDefinitions )
 {
-	static UFunction* pFnGetLeaderboardDefinitions = NULL;
-
+	UFunction* pFnGetLeaderboardDefinitions = (UFunction*) SdkBindings::Get ( 3334 );
 	if ( ! pFnGetLeaderboardDefinitions )
-		pFnGetLeaderboardDefinitions = (UFunction*) UObject::GObjObjects()->Data[ 37031 ];
+		return {};
 
 	USFXOnlineComponentBlazeLeaderboard_execGetLeaderboardDefinitions_Parms GetLeaderboardDefinitions_Parms;
 
@@ -19410,10 +18555,9 @@ bool USFXOnlineComponentBlazeLeaderboard::GetLeaderboardDefinitions ( TArray< st
 
 void USFXOnlineComponentBlazeLeaderboard::OnGetRankNotificationsCompleted ( TArray< struct FRankBypassNotification > RankBypassNotificationArray )
 {
-	static UFunction* pFnOnGetRankNotificationsCompleted = NULL;
-
+	UFunction* pFnOnGetRankNotificationsCompleted = (UFunction*) SdkBindings::Get ( 3331 );
 	if ( ! pFnOnGetRankNotificationsCompleted )
-		pFnOnGetRankNotificationsCompleted = (UFunction*) UObject::GObjObjects()->Data[ 36996 ];
+		return;
 
 	USFXOnlineComponentBlazeLeaderboard_execOnGetRankNotificationsCompleted_Parms OnGetRankNotificationsCompleted_Parms;
 	memcpy ( &OnGetRankNotificationsCompleted_Parms.RankBypassNotificationArray, &RankBypassNotificationArray, 0xC );
@@ -19428,10 +18572,9 @@ void USFXOnlineComponentBlazeLeaderboard::OnGetRankNotificationsCompleted ( TArr
 
 void USFXOnlineComponentBlazeLeaderboard::OnReadLbListCompleted ( unsigned char errorCode )
 {
-	static UFunction* pFnOnReadLbListCompleted = NULL;
-
+	UFunction* pFnOnReadLbListCompleted = (UFunction*) SdkBindings::Get ( 3333 );
 	if ( ! pFnOnReadLbListCompleted )
-		pFnOnReadLbListCompleted = (UFunction*) UObject::GObjObjects()->Data[ 37027 ];
+		return;
 
 	USFXOnlineComponentBlazeLeaderboard_execOnReadLbListCompleted_Parms OnReadLbListCompleted_Parms;
 	OnReadLbListCompleted_Parms.errorCode = errorCode;
@@ -19451,10 +18594,9 @@ void USFXOnlineComponentBlazeLeaderboard::OnReadLbListCompleted ( unsigned char
 
 void USFXOnlineComponentBlazeLeaderboard::OnResultsRetrieved ( TArray< struct FLeaderboardColumn > aColumnInfo, TArray< struct FLeaderboardRecord > aResults, int iTotalRanks, struct FUniqueNetId uidEntity, unsigned char nErrorCode, struct FPointer pExternalData )
 {
-	static UFunction* pFnOnResultsRetrieved = NULL;
-
+	UFunction* pFnOnResultsRetrieved = (UFunction*) SdkBindings::Get ( 3332 );
 	if ( ! pFnOnResultsRetrieved )
-		pFnOnResultsRetrieved = (UFunction*) UObject::GObjObjects()->Data[ 37017 ];
+		return;
 
 	USFXOnlineComponentBlazeLeaderboard_execOnResultsRetrieved_Parms OnResultsRetrieved_Parms;
 	memcpy ( &OnResultsRetrieved_Parms.aColumnInfo, &aColumnInfo, 0xC );
@@ -19474,10 +18616,9 @@ void USFXOnlineComponentBlazeLeaderboard::OnResultsRetrieved ( TArray< struct FL
 
 void USFXOnlineComponentBlazeLogin::SetExternalDRMDataLoaded ( unsigned long bValue )
 {
-	static UFunction* pFnSetExternalDRMDataLoaded = NULL;
-
+	UFunction* pFnSetExternalDRMDataLoaded = (UFunction*) SdkBindings::Get ( 3451 );
 	if ( ! pFnSetExternalDRMDataLoaded )
-		pFnSetExternalDRMDataLoaded = (UFunction*) UObject::GObjObjects()->Data[ 37424 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execSetExternalDRMDataLoaded_Parms SetExternalDRMDataLoaded_Parms;
 	SetExternalDRMDataLoaded_Parms.bValue = bValue;
@@ -19496,10 +18637,9 @@ void USFXOnlineComponentBlazeLogin::SetExternalDRMDataLoaded ( unsigned long bVa
 
 void USFXOnlineComponentBlazeLogin::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
-
+	UFunction* pFnOnTick = (UFunction*) SdkBindings::Get ( 3452 );
 	if ( ! pFnOnTick )
-		pFnOnTick = (UFunction*) UObject::GObjObjects()->Data[ 37462 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
@@ -19519,10 +18659,9 @@ void USFXOnlineComponentBlazeLogin::OnTick ( class USFXOnlineEvent* oEvent )
 
 void USFXOnlineComponentBlazeLogin::OnOriginAuthKeyAvailableCallback ( unsigned long Success, struct FString authKey )
 {
-	static UFunction* pFnOnOriginAuthKeyAvailableCallback = NULL;
-
+	UFunction* pFnOnOriginAuthKeyAvailableCallback = (UFunction*) SdkBindings::Get ( 3450 );
 	if ( ! pFnOnOriginAuthKeyAvailableCallback )
-		pFnOnOriginAuthKeyAvailableCallback = (UFunction*) UObject::GObjObjects()->Data[ 37420 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execOnOriginAuthKeyAvailableCallback_Parms OnOriginAuthKeyAvailableCallback_Parms;
 	OnOriginAuthKeyAvailableCallback_Parms.Success = Success;
@@ -19542,10 +18681,9 @@ void USFXOnlineComponentBlazeLogin::OnOriginAuthKeyAvailableCallback ( unsigned
 
 void USFXOnlineComponentBlazeLogin::OnPromptRedeemCodeResult ( int nResult )
 {
-	static UFunction* pFnOnPromptRedeemCodeResult = NULL;
-
+	UFunction* pFnOnPromptRedeemCodeResult = (UFunction*) SdkBindings::Get ( 3449 );
 	if ( ! pFnOnPromptRedeemCodeResult )
-		pFnOnPromptRedeemCodeResult = (UFunction*) UObject::GObjObjects()->Data[ 37418 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execOnPromptRedeemCodeResult_Parms OnPromptRedeemCodeResult_Parms;
 	OnPromptRedeemCodeResult_Parms.nResult = nResult;
@@ -19564,10 +18702,9 @@ void USFXOnlineComponentBlazeLogin::OnPromptRedeemCodeResult ( int nResult )
 
 void USFXOnlineComponentBlazeLogin::SuspendUserPing ( unsigned long suspend )
 {
-	static UFunction* pFnSuspendUserPing = NULL;
-
+	UFunction* pFnSuspendUserPing = (UFunction*) SdkBindings::Get ( 3448 );
 	if ( ! pFnSuspendUserPing )
-		pFnSuspendUserPing = (UFunction*) UObject::GObjObjects()->Data[ 37416 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execSuspendUserPing_Parms SuspendUserPing_Parms;
 	SuspendUserPing_Parms.suspend = suspend;
@@ -19586,10 +18723,9 @@ void USFXOnlineComponentBlazeLogin::SuspendUserPing ( unsigned long suspend )
 
 bool USFXOnlineComponentBlazeLogin::GetDefaultBiowareEmailAllowed ( )
 {
-	static UFunction* pFnGetDefaultBiowareEmailAllowed = NULL;
-
+	UFunction* pFnGetDefaultBiowareEmailAllowed = (UFunction*) SdkBindings::Get ( 3447 );
 	if ( ! pFnGetDefaultBiowareEmailAllowed )
-		pFnGetDefaultBiowareEmailAllowed = (UFunction*) UObject::GObjObjects()->Data[ 37414 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execGetDefaultBiowareEmailAllowed_Parms GetDefaultBiowareEmailAllowed_Parms;
 
@@ -19609,10 +18745,9 @@ bool USFXOnlineComponentBlazeLogin::GetDefaultBiowareEmailAllowed ( )
 
 unsigned char USFXOnlineComponentBlazeLogin::GetConnectMode ( )
 {
-	static UFunction* pFnGetConnectMode = NULL;
-
+	UFunction* pFnGetConnectMode = (UFunction*) SdkBindings::Get ( 3446 );
 	if ( ! pFnGetConnectMode )
-		pFnGetConnectMode = (UFunction*) UObject::GObjObjects()->Data[ 37412 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execGetConnectMode_Parms GetConnectMode_Parms;
 
@@ -19632,10 +18767,9 @@ unsigned char USFXOnlineComponentBlazeLogin::GetConnectMode ( )
 
 void USFXOnlineComponentBlazeLogin::AddFriendsCompleteCb ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnAddFriendsCompleteCb = NULL;
-
+	UFunction* pFnAddFriendsCompleteCb = (UFunction*) SdkBindings::Get ( 3445 );
 	if ( ! pFnAddFriendsCompleteCb )
-		pFnAddFriendsCompleteCb = (UFunction*) UObject::GObjObjects()->Data[ 37410 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execAddFriendsCompleteCb_Parms AddFriendsCompleteCb_Parms;
 	AddFriendsCompleteCb_Parms.bWasSuccessful = bWasSuccessful;
@@ -19653,10 +18787,9 @@ void USFXOnlineComponentBlazeLogin::AddFriendsCompleteCb ( unsigned long bWasSuc
 
 void USFXOnlineComponentBlazeLogin::PostImportFriendListToBlaze ( )
 {
-	static UFunction* pFnPostImportFriendListToBlaze = NULL;
-
+	UFunction* pFnPostImportFriendListToBlaze = (UFunction*) SdkBindings::Get ( 3444 );
 	if ( ! pFnPostImportFriendListToBlaze )
-		pFnPostImportFriendListToBlaze = (UFunction*) UObject::GObjObjects()->Data[ 37409 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execPostImportFriendListToBlaze_Parms PostImportFriendListToBlaze_Parms;
 
@@ -19675,10 +18808,9 @@ void USFXOnlineComponentBlazeLogin::PostImportFriendListToBlaze ( )
 
 bool USFXOnlineComponentBlazeLogin::ImportFriendListToBlaze ( struct FScriptDelegate funcImportFriendListToBlazeCompleted )
 {
-	static UFunction* pFnImportFriendListToBlaze = NULL;
-
+	UFunction* pFnImportFriendListToBlaze = (UFunction*) SdkBindings::Get ( 3443 );
 	if ( ! pFnImportFriendListToBlaze )
-		pFnImportFriendListToBlaze = (UFunction*) UObject::GObjObjects()->Data[ 37406 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execImportFriendListToBlaze_Parms ImportFriendListToBlaze_Parms;
 	memcpy ( &ImportFriendListToBlaze_Parms.funcImportFriendListToBlazeCompleted, &funcImportFriendListToBlazeCompleted, 0xC );
@@ -19699,10 +18831,9 @@ bool USFXOnlineComponentBlazeLogin::ImportFriendListToBlaze ( struct FScriptDele
 
 void USFXOnlineComponentBlazeLogin::OnImportFriendListToBlazeCompleted ( unsigned char errorCode )
 {
-	static UFunction* pFnOnImportFriendListToBlazeCompleted = NULL;
-
+	UFunction* pFnOnImportFriendListToBlazeCompleted = (UFunction*) SdkBindings::Get ( 3442 );
 	if ( ! pFnOnImportFriendListToBlazeCompleted )
-		pFnOnImportFriendListToBlazeCompleted = (UFunction*) UObject::GObjObjects()->Data[ 37404 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execOnImportFriendListToBlazeCompleted_Parms OnImportFriendListToBlazeCompleted_Parms;
 	OnImportFriendListToBlazeCompleted_Parms.errorCode = errorCode;
@@ -19717,10 +18848,9 @@ void USFXOnlineComponentBlazeLogin::OnImportFriendListToBlazeCompleted ( unsigne
 
 void USFXOnlineComponentBlazeLogin::RequestImportFriendListToBlaze ( unsigned long callPostImportFriendListToBlaze )
 {
-	static UFunction* pFnRequestImportFriendListToBlaze = NULL;
-
+	UFunction* pFnRequestImportFriendListToBlaze = (UFunction*) SdkBindings::Get ( 3441 );
 	if ( ! pFnRequestImportFriendListToBlaze )
-		pFnRequestImportFriendListToBlaze = (UFunction*) UObject::GObjObjects()->Data[ 37402 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execRequestImportFriendListToBlaze_Parms RequestImportFriendListToBlaze_Parms;
 	RequestImportFriendListToBlaze_Parms.callPostImportFriendListToBlaze = callPostImportFriendListToBlaze;
@@ -19740,10 +18870,9 @@ void USFXOnlineComponentBlazeLogin::RequestImportFriendListToBlaze ( unsigned lo
 
 class USFXOnlineJobImportFriendListToBlaze* USFXOnlineComponentBlazeLogin::eventCreateJobImportFriendListToBlaze ( unsigned long callPostImportFriendListToBlaze )
 {
-	static UFunction* pFnCreateJobImportFriendListToBlaze = NULL;
-
+	UFunction* pFnCreateJobImportFriendListToBlaze = (UFunction*) SdkBindings::Get ( 3439 );
 	if ( ! pFnCreateJobImportFriendListToBlaze )
-		pFnCreateJobImportFriendListToBlaze = (UFunction*) UObject::GObjObjects()->Data[ 37397 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_eventCreateJobImportFriendListToBlaze_Parms CreateJobImportFriendListToBlaze_Parms;
 	CreateJobImportFriendListToBlaze_Parms.callPostImportFriendListToBlaze = callPostImportFriendListToBlaze;
@@ -19761,10 +18890,9 @@ class USFXOnlineJobImportFriendListToBlaze* USFXOnlineComponentBlazeLogin::event
 
 unsigned char USFXOnlineComponentBlazeLogin::CanShowPresenceInformation ( int nUserIndex )
 {
-	static UFunction* pFnCanShowPresenceInformation = NULL;
-
+	UFunction* pFnCanShowPresenceInformation = (UFunction*) SdkBindings::Get ( 3438 );
 	if ( ! pFnCanShowPresenceInformation )
-		pFnCanShowPresenceInformation = (UFunction*) UObject::GObjObjects()->Data[ 37394 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execCanShowPresenceInformation_Parms CanShowPresenceInformation_Parms;
 	CanShowPresenceInformation_Parms.nUserIndex = nUserIndex;
@@ -19786,10 +18914,9 @@ unsigned char USFXOnlineComponentBlazeLogin::CanShowPresenceInformation ( int nU
 
 unsigned char USFXOnlineComponentBlazeLogin::CanViewPlayerProfiles ( int nUserIndex )
 {
-	static UFunction* pFnCanViewPlayerProfiles = NULL;
-
+	UFunction* pFnCanViewPlayerProfiles = (UFunction*) SdkBindings::Get ( 3437 );
 	if ( ! pFnCanViewPlayerProfiles )
-		pFnCanViewPlayerProfiles = (UFunction*) UObject::GObjObjects()->Data[ 37391 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execCanViewPlayerProfiles_Parms CanViewPlayerProfiles_Parms;
 	CanViewPlayerProfiles_Parms.nUserIndex = nUserIndex;
@@ -19811,10 +18938,9 @@ unsigned char USFXOnlineComponentBlazeLogin::CanViewPlayerProfiles ( int nUserIn
 
 unsigned char USFXOnlineComponentBlazeLogin::CanPurchaseContent ( int nUserIndex )
 {
-	static UFunction* pFnCanPurchaseContent = NULL;
-
+	UFunction* pFnCanPurchaseContent = (UFunction*) SdkBindings::Get ( 3436 );
 	if ( ! pFnCanPurchaseContent )
-		pFnCanPurchaseContent = (UFunction*) UObject::GObjObjects()->Data[ 37388 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execCanPurchaseContent_Parms CanPurchaseContent_Parms;
 	CanPurchaseContent_Parms.nUserIndex = nUserIndex;
@@ -19836,10 +18962,9 @@ unsigned char USFXOnlineComponentBlazeLogin::CanPurchaseContent ( int nUserIndex
 
 unsigned char USFXOnlineComponentBlazeLogin::CanDownloadUserContent ( int nUserIndex )
 {
-	static UFunction* pFnCanDownloadUserContent = NULL;
-
+	UFunction* pFnCanDownloadUserContent = (UFunction*) SdkBindings::Get ( 3435 );
 	if ( ! pFnCanDownloadUserContent )
-		pFnCanDownloadUserContent = (UFunction*) UObject::GObjObjects()->Data[ 37385 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execCanDownloadUserContent_Parms CanDownloadUserContent_Parms;
 	CanDownloadUserContent_Parms.nUserIndex = nUserIndex;
@@ -19861,10 +18986,9 @@ unsigned char USFXOnlineComponentBlazeLogin::CanDownloadUserContent ( int nUserI
 
 unsigned char USFXOnlineComponentBlazeLogin::CanCommunicate ( int nUserIndex )
 {
-	static UFunction* pFnCanCommunicate = NULL;
-
+	UFunction* pFnCanCommunicate = (UFunction*) SdkBindings::Get ( 3434 );
 	if ( ! pFnCanCommunicate )
-		pFnCanCommunicate = (UFunction*) UObject::GObjObjects()->Data[ 37382 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execCanCommunicate_Parms CanCommunicate_Parms;
 	CanCommunicate_Parms.nUserIndex = nUserIndex;
@@ -19886,10 +19010,9 @@ unsigned char USFXOnlineComponentBlazeLogin::CanCommunicate ( int nUserIndex )
 
 unsigned char USFXOnlineComponentBlazeLogin::CanPlayOnline ( int nUserIndex )
 {
-	static UFunction* pFnCanPlayOnline = NULL;
-
+	UFunction* pFnCanPlayOnline = (UFunction*) SdkBindings::Get ( 3433 );
 	if ( ! pFnCanPlayOnline )
-		pFnCanPlayOnline = (UFunction*) UObject::GObjObjects()->Data[ 37379 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execCanPlayOnline_Parms CanPlayOnline_Parms;
 	CanPlayOnline_Parms.nUserIndex = nUserIndex;
@@ -19909,10 +19032,9 @@ unsigned char USFXOnlineComponentBlazeLogin::CanPlayOnline ( int nUserIndex )
 
 void USFXOnlineComponentBlazeLogin::OnDownloadOffersUICompleted ( )
 {
-	static UFunction* pFnOnDownloadOffersUICompleted = NULL;
-
+	UFunction* pFnOnDownloadOffersUICompleted = (UFunction*) SdkBindings::Get ( 3432 );
 	if ( ! pFnOnDownloadOffersUICompleted )
-		pFnOnDownloadOffersUICompleted = (UFunction*) UObject::GObjObjects()->Data[ 37378 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execOnDownloadOffersUICompleted_Parms OnDownloadOffersUICompleted_Parms;
 
@@ -19929,10 +19051,9 @@ void USFXOnlineComponentBlazeLogin::OnDownloadOffersUICompleted ( )
 
 void USFXOnlineComponentBlazeLogin::OnDLCInfoLoaded ( )
 {
-	static UFunction* pFnOnDLCInfoLoaded = NULL;
-
+	UFunction* pFnOnDLCInfoLoaded = (UFunction*) SdkBindings::Get ( 3431 );
 	if ( ! pFnOnDLCInfoLoaded )
-		pFnOnDLCInfoLoaded = (UFunction*) UObject::GObjObjects()->Data[ 37377 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execOnDLCInfoLoaded_Parms OnDLCInfoLoaded_Parms;
 
@@ -19949,10 +19070,9 @@ void USFXOnlineComponentBlazeLogin::OnDLCInfoLoaded ( )
 
 void USFXOnlineComponentBlazeLogin::OpenCerberusUI ( )
 {
-	static UFunction* pFnOpenCerberusUI = NULL;
-
+	UFunction* pFnOpenCerberusUI = (UFunction*) SdkBindings::Get ( 3430 );
 	if ( ! pFnOpenCerberusUI )
-		pFnOpenCerberusUI = (UFunction*) UObject::GObjObjects()->Data[ 37376 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execOpenCerberusUI_Parms OpenCerberusUI_Parms;
 
@@ -19970,10 +19090,9 @@ void USFXOnlineComponentBlazeLogin::OpenCerberusUI ( )
 
 void USFXOnlineComponentBlazeLogin::EnterCDKey ( struct FString sKey )
 {
-	static UFunction* pFnEnterCDKey = NULL;
-
+	UFunction* pFnEnterCDKey = (UFunction*) SdkBindings::Get ( 3429 );
 	if ( ! pFnEnterCDKey )
-		pFnEnterCDKey = (UFunction*) UObject::GObjObjects()->Data[ 37374 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execEnterCDKey_Parms EnterCDKey_Parms;
 	memcpy ( &EnterCDKey_Parms.sKey, &sKey, 0xC );
@@ -19992,10 +19111,9 @@ void USFXOnlineComponentBlazeLogin::EnterCDKey ( struct FString sKey )
 
 void USFXOnlineComponentBlazeLogin::Buy ( unsigned char nPurchaseSource )
 {
-	static UFunction* pFnBuy = NULL;
-
+	UFunction* pFnBuy = (UFunction*) SdkBindings::Get ( 3428 );
 	if ( ! pFnBuy )
-		pFnBuy = (UFunction*) UObject::GObjObjects()->Data[ 37372 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execBuy_Parms Buy_Parms;
 	Buy_Parms.nPurchaseSource = nPurchaseSource;
@@ -20014,10 +19132,9 @@ void USFXOnlineComponentBlazeLogin::Buy ( unsigned char nPurchaseSource )
 
 void USFXOnlineComponentBlazeLogin::CompleteBuildEntitlementListUponRedeption ( int nResult )
 {
-	static UFunction* pFnCompleteBuildEntitlementListUponRedeption = NULL;
-
+	UFunction* pFnCompleteBuildEntitlementListUponRedeption = (UFunction*) SdkBindings::Get ( 3427 );
 	if ( ! pFnCompleteBuildEntitlementListUponRedeption )
-		pFnCompleteBuildEntitlementListUponRedeption = (UFunction*) UObject::GObjObjects()->Data[ 37370 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execCompleteBuildEntitlementListUponRedeption_Parms CompleteBuildEntitlementListUponRedeption_Parms;
 	CompleteBuildEntitlementListUponRedeption_Parms.nResult = nResult;
@@ -20036,10 +19153,9 @@ void USFXOnlineComponentBlazeLogin::CompleteBuildEntitlementListUponRedeption (
 
 void USFXOnlineComponentBlazeLogin::CompleteBuildEntitlementListUponLogin ( int nResult )
 {
-	static UFunction* pFnCompleteBuildEntitlementListUponLogin = NULL;
-
+	UFunction* pFnCompleteBuildEntitlementListUponLogin = (UFunction*) SdkBindings::Get ( 3426 );
 	if ( ! pFnCompleteBuildEntitlementListUponLogin )
-		pFnCompleteBuildEntitlementListUponLogin = (UFunction*) UObject::GObjObjects()->Data[ 37368 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execCompleteBuildEntitlementListUponLogin_Parms CompleteBuildEntitlementListUponLogin_Parms;
 	CompleteBuildEntitlementListUponLogin_Parms.nResult = nResult;
@@ -20060,10 +19176,9 @@ void USFXOnlineComponentBlazeLogin::CompleteBuildEntitlementListUponLogin ( int
 
 bool USFXOnlineComponentBlazeLogin::BuildEntitlementList ( unsigned long bFirstCallUponLogin, int nPage )
 {
-	static UFunction* pFnBuildEntitlementList = NULL;
-
+	UFunction* pFnBuildEntitlementList = (UFunction*) SdkBindings::Get ( 3425 );
 	if ( ! pFnBuildEntitlementList )
-		pFnBuildEntitlementList = (UFunction*) UObject::GObjObjects()->Data[ 37364 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execBuildEntitlementList_Parms BuildEntitlementList_Parms;
 	BuildEntitlementList_Parms.bFirstCallUponLogin = bFirstCallUponLogin;
@@ -20085,10 +19200,9 @@ bool USFXOnlineComponentBlazeLogin::BuildEntitlementList ( unsigned long bFirstC
 
 bool USFXOnlineComponentBlazeLogin::IsCerberusMember ( )
 {
-	static UFunction* pFnIsCerberusMember = NULL;
-
+	UFunction* pFnIsCerberusMember = (UFunction*) SdkBindings::Get ( 3424 );
 	if ( ! pFnIsCerberusMember )
-		pFnIsCerberusMember = (UFunction*) UObject::GObjObjects()->Data[ 37362 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execIsCerberusMember_Parms IsCerberusMember_Parms;
 
@@ -20108,10 +19222,9 @@ bool USFXOnlineComponentBlazeLogin::IsCerberusMember ( )
 
 void USFXOnlineComponentBlazeLogin::DisablePersona ( struct FString sPersonaNonGrata )
 {
-	static UFunction* pFnDisablePersona = NULL;
-
+	UFunction* pFnDisablePersona = (UFunction*) SdkBindings::Get ( 3423 );
 	if ( ! pFnDisablePersona )
-		pFnDisablePersona = (UFunction*) UObject::GObjObjects()->Data[ 37360 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execDisablePersona_Parms DisablePersona_Parms;
 	memcpy ( &DisablePersona_Parms.sPersonaNonGrata, &sPersonaNonGrata, 0xC );
@@ -20130,10 +19243,9 @@ void USFXOnlineComponentBlazeLogin::DisablePersona ( struct FString sPersonaNonG
 
 void USFXOnlineComponentBlazeLogin::CreatePersona ( struct FString sPersonaName )
 {
-	static UFunction* pFnCreatePersona = NULL;
-
+	UFunction* pFnCreatePersona = (UFunction*) SdkBindings::Get ( 3422 );
 	if ( ! pFnCreatePersona )
-		pFnCreatePersona = (UFunction*) UObject::GObjObjects()->Data[ 37358 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execCreatePersona_Parms CreatePersona_Parms;
 	memcpy ( &CreatePersona_Parms.sPersonaName, &sPersonaName, 0xC );
@@ -20152,10 +19264,9 @@ void USFXOnlineComponentBlazeLogin::CreatePersona ( struct FString sPersonaName
 
 void USFXOnlineComponentBlazeLogin::SelectPersona ( struct FString sPersonaName )
 {
-	static UFunction* pFnSelectPersona = NULL;
-
+	UFunction* pFnSelectPersona = (UFunction*) SdkBindings::Get ( 3421 );
 	if ( ! pFnSelectPersona )
-		pFnSelectPersona = (UFunction*) UObject::GObjObjects()->Data[ 37356 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execSelectPersona_Parms SelectPersona_Parms;
 	memcpy ( &SelectPersona_Parms.sPersonaName, &sPersonaName, 0xC );
@@ -20174,10 +19285,9 @@ void USFXOnlineComponentBlazeLogin::SelectPersona ( struct FString sPersonaName
 
 void USFXOnlineComponentBlazeLogin::AcceptTOS ( unsigned long bAccepted )
 {
-	static UFunction* pFnAcceptTOS = NULL;
-
+	UFunction* pFnAcceptTOS = (UFunction*) SdkBindings::Get ( 3420 );
 	if ( ! pFnAcceptTOS )
-		pFnAcceptTOS = (UFunction*) UObject::GObjObjects()->Data[ 37354 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execAcceptTOS_Parms AcceptTOS_Parms;
 	AcceptTOS_Parms.bAccepted = bAccepted;
@@ -20196,10 +19306,9 @@ void USFXOnlineComponentBlazeLogin::AcceptTOS ( unsigned long bAccepted )
 
 void USFXOnlineComponentBlazeLogin::Disconnect ( unsigned long bShowError )
 {
-	static UFunction* pFnDisconnect = NULL;
-
+	UFunction* pFnDisconnect = (UFunction*) SdkBindings::Get ( 3419 );
 	if ( ! pFnDisconnect )
-		pFnDisconnect = (UFunction*) UObject::GObjObjects()->Data[ 37352 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execDisconnect_Parms Disconnect_Parms;
 	Disconnect_Parms.bShowError = bShowError;
@@ -20218,10 +19327,9 @@ void USFXOnlineComponentBlazeLogin::Disconnect ( unsigned long bShowError )
 
 void USFXOnlineComponentBlazeLogin::On1stPartyServiceLoginResult ( unsigned long loggedIn )
 {
-	static UFunction* pFnOn1stPartyServiceLoginResult = NULL;
-
+	UFunction* pFnOn1stPartyServiceLoginResult = (UFunction*) SdkBindings::Get ( 3418 );
 	if ( ! pFnOn1stPartyServiceLoginResult )
-		pFnOn1stPartyServiceLoginResult = (UFunction*) UObject::GObjObjects()->Data[ 37350 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execOn1stPartyServiceLoginResult_Parms On1stPartyServiceLoginResult_Parms;
 	On1stPartyServiceLoginResult_Parms.loggedIn = loggedIn;
@@ -20240,10 +19348,9 @@ void USFXOnlineComponentBlazeLogin::On1stPartyServiceLoginResult ( unsigned long
 
 bool USFXOnlineComponentBlazeLogin::eventShow1stPartyServiceLogin ( )
 {
-	static UFunction* pFnShow1stPartyServiceLogin = NULL;
-
+	UFunction* pFnShow1stPartyServiceLogin = (UFunction*) SdkBindings::Get ( 3417 );
 	if ( ! pFnShow1stPartyServiceLogin )
-		pFnShow1stPartyServiceLogin = (UFunction*) UObject::GObjObjects()->Data[ 37348 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_eventShow1stPartyServiceLogin_Parms Show1stPartyServiceLogin_Parms;
 
@@ -20259,10 +19366,9 @@ bool USFXOnlineComponentBlazeLogin::eventShow1stPartyServiceLogin ( )
 
 bool USFXOnlineComponentBlazeLogin::Show1stPartyServiceLoginImp ( )
 {
-	static UFunction* pFnShow1stPartyServiceLoginImp = NULL;
-
+	UFunction* pFnShow1stPartyServiceLoginImp = (UFunction*) SdkBindings::Get ( 3416 );
 	if ( ! pFnShow1stPartyServiceLoginImp )
-		pFnShow1stPartyServiceLoginImp = (UFunction*) UObject::GObjObjects()->Data[ 37346 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execShow1stPartyServiceLoginImp_Parms Show1stPartyServiceLoginImp_Parms;
 
@@ -20277,10 +19383,9 @@ bool USFXOnlineComponentBlazeLogin::Show1stPartyServiceLoginImp ( )
 
 void USFXOnlineComponentBlazeLogin::CompleteLoginProcess ( )
 {
-	static UFunction* pFnCompleteLoginProcess = NULL;
-
+	UFunction* pFnCompleteLoginProcess = (UFunction*) SdkBindings::Get ( 3415 );
 	if ( ! pFnCompleteLoginProcess )
-		pFnCompleteLoginProcess = (UFunction*) UObject::GObjObjects()->Data[ 37345 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execCompleteLoginProcess_Parms CompleteLoginProcess_Parms;
 
@@ -20297,10 +19402,9 @@ void USFXOnlineComponentBlazeLogin::CompleteLoginProcess ( )
 
 void USFXOnlineComponentBlazeLogin::StartCerberusLogin ( )
 {
-	static UFunction* pFnStartCerberusLogin = NULL;
-
+	UFunction* pFnStartCerberusLogin = (UFunction*) SdkBindings::Get ( 3414 );
 	if ( ! pFnStartCerberusLogin )
-		pFnStartCerberusLogin = (UFunction*) UObject::GObjObjects()->Data[ 37344 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execStartCerberusLogin_Parms StartCerberusLogin_Parms;
 
@@ -20318,10 +19422,9 @@ void USFXOnlineComponentBlazeLogin::StartCerberusLogin ( )
 
 void USFXOnlineComponentBlazeLogin::SubmitStore ( TArray< int > aiChosen )
 {
-	static UFunction* pFnSubmitStore = NULL;
-
+	UFunction* pFnSubmitStore = (UFunction*) SdkBindings::Get ( 3413 );
 	if ( ! pFnSubmitStore )
-		pFnSubmitStore = (UFunction*) UObject::GObjObjects()->Data[ 37341 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execSubmitStore_Parms SubmitStore_Parms;
 	memcpy ( &SubmitStore_Parms.aiChosen, &aiChosen, 0xC );
@@ -20350,10 +19453,9 @@ void USFXOnlineComponentBlazeLogin::SubmitStore ( TArray< int > aiChosen )
 
 void USFXOnlineComponentBlazeLogin::SubmitCreateNucleusAccountEx ( struct FString sEmail, struct FString sPassword, unsigned long bEAProducts, unsigned long bThirdParty, unsigned long bBioWareProducts, struct FString i_sCountryCode, int BirthDay, int BirthMonth, int BirthYear, struct FString i_sLanguageCode, unsigned long bSubmit )
 {
-	static UFunction* pFnSubmitCreateNucleusAccountEx = NULL;
-
+	UFunction* pFnSubmitCreateNucleusAccountEx = (UFunction*) SdkBindings::Get ( 3412 );
 	if ( ! pFnSubmitCreateNucleusAccountEx )
-		pFnSubmitCreateNucleusAccountEx = (UFunction*) UObject::GObjObjects()->Data[ 37329 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execSubmitCreateNucleusAccountEx_Parms SubmitCreateNucleusAccountEx_Parms;
 	memcpy ( &SubmitCreateNucleusAccountEx_Parms.sEmail, &sEmail, 0xC );
@@ -20384,10 +19486,9 @@ void USFXOnlineComponentBlazeLogin::SubmitCreateNucleusAccountEx ( struct FStrin
 
 void USFXOnlineComponentBlazeLogin::SubmitEmailPasswordMismatch ( struct FString email, struct FString Password, int eReturnCode )
 {
-	static UFunction* pFnSubmitEmailPasswordMismatch = NULL;
-
+	UFunction* pFnSubmitEmailPasswordMismatch = (UFunction*) SdkBindings::Get ( 3411 );
 	if ( ! pFnSubmitEmailPasswordMismatch )
-		pFnSubmitEmailPasswordMismatch = (UFunction*) UObject::GObjObjects()->Data[ 37325 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execSubmitEmailPasswordMismatch_Parms SubmitEmailPasswordMismatch_Parms;
 	memcpy ( &SubmitEmailPasswordMismatch_Parms.email, &email, 0xC );
@@ -20408,10 +19509,9 @@ void USFXOnlineComponentBlazeLogin::SubmitEmailPasswordMismatch ( struct FString
 
 void USFXOnlineComponentBlazeLogin::SubmitMessageBox ( int eReturnCode )
 {
-	static UFunction* pFnSubmitMessageBox = NULL;
-
+	UFunction* pFnSubmitMessageBox = (UFunction*) SdkBindings::Get ( 3410 );
 	if ( ! pFnSubmitMessageBox )
-		pFnSubmitMessageBox = (UFunction*) UObject::GObjObjects()->Data[ 37323 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execSubmitMessageBox_Parms SubmitMessageBox_Parms;
 	SubmitMessageBox_Parms.eReturnCode = eReturnCode;
@@ -20431,10 +19531,9 @@ void USFXOnlineComponentBlazeLogin::SubmitMessageBox ( int eReturnCode )
 
 void USFXOnlineComponentBlazeLogin::SubmitRedeemCode ( unsigned long bContinue, struct FString i_sCode )
 {
-	static UFunction* pFnSubmitRedeemCode = NULL;
-
+	UFunction* pFnSubmitRedeemCode = (UFunction*) SdkBindings::Get ( 3409 );
 	if ( ! pFnSubmitRedeemCode )
-		pFnSubmitRedeemCode = (UFunction*) UObject::GObjObjects()->Data[ 37320 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execSubmitRedeemCode_Parms SubmitRedeemCode_Parms;
 	SubmitRedeemCode_Parms.bContinue = bContinue;
@@ -20453,10 +19552,9 @@ void USFXOnlineComponentBlazeLogin::SubmitRedeemCode ( unsigned long bContinue,
 
 void USFXOnlineComponentBlazeLogin::SubmitCerberusWelcomeMessage ( )
 {
-	static UFunction* pFnSubmitCerberusWelcomeMessage = NULL;
-
+	UFunction* pFnSubmitCerberusWelcomeMessage = (UFunction*) SdkBindings::Get ( 3408 );
 	if ( ! pFnSubmitCerberusWelcomeMessage )
-		pFnSubmitCerberusWelcomeMessage = (UFunction*) UObject::GObjObjects()->Data[ 37319 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execSubmitCerberusWelcomeMessage_Parms SubmitCerberusWelcomeMessage_Parms;
 
@@ -20474,10 +19572,9 @@ void USFXOnlineComponentBlazeLogin::SubmitCerberusWelcomeMessage ( )
 
 void USFXOnlineComponentBlazeLogin::SubmitCerberusIntro ( int eReturnCode )
 {
-	static UFunction* pFnSubmitCerberusIntro = NULL;
-
+	UFunction* pFnSubmitCerberusIntro = (UFunction*) SdkBindings::Get ( 3406 );
 	if ( ! pFnSubmitCerberusIntro )
-		pFnSubmitCerberusIntro = (UFunction*) UObject::GObjObjects()->Data[ 37316 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execSubmitCerberusIntro_Parms SubmitCerberusIntro_Parms;
 	SubmitCerberusIntro_Parms.eReturnCode = eReturnCode;
@@ -20495,10 +19592,9 @@ void USFXOnlineComponentBlazeLogin::SubmitCerberusIntro ( int eReturnCode )
 
 void USFXOnlineComponentBlazeLogin::SubmitNucleusWelcomeMessageEx ( )
 {
-	static UFunction* pFnSubmitNucleusWelcomeMessageEx = NULL;
-
+	UFunction* pFnSubmitNucleusWelcomeMessageEx = (UFunction*) SdkBindings::Get ( 3407 );
 	if ( ! pFnSubmitNucleusWelcomeMessageEx )
-		pFnSubmitNucleusWelcomeMessageEx = (UFunction*) UObject::GObjObjects()->Data[ 37318 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execSubmitNucleusWelcomeMessageEx_Parms SubmitNucleusWelcomeMessageEx_Parms;
 
@@ -20515,10 +19611,9 @@ void USFXOnlineComponentBlazeLogin::SubmitNucleusWelcomeMessageEx ( )
 
 void USFXOnlineComponentBlazeLogin::SubmitNucleusWelcomeMessage ( )
 {
-	static UFunction* pFnSubmitNucleusWelcomeMessage = NULL;
-
+	UFunction* pFnSubmitNucleusWelcomeMessage = (UFunction*) SdkBindings::Get ( 3405 );
 	if ( ! pFnSubmitNucleusWelcomeMessage )
-		pFnSubmitNucleusWelcomeMessage = (UFunction*) UObject::GObjObjects()->Data[ 37315 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execSubmitNucleusWelcomeMessage_Parms SubmitNucleusWelcomeMessage_Parms;
 
@@ -20541,10 +19636,9 @@ void USFXOnlineComponentBlazeLogin::SubmitNucleusWelcomeMessage ( )
 
 void USFXOnlineComponentBlazeLogin::SubmitCreateNucleusAccount ( struct FString sEmail, struct FString sPassword, unsigned long bEAProducts, unsigned long bThirdParty, unsigned long bBioWareProducts, unsigned long bSubmit )
 {
-	static UFunction* pFnSubmitCreateNucleusAccount = NULL;
-
+	UFunction* pFnSubmitCreateNucleusAccount = (UFunction*) SdkBindings::Get ( 3404 );
 	if ( ! pFnSubmitCreateNucleusAccount )
-		pFnSubmitCreateNucleusAccount = (UFunction*) UObject::GObjObjects()->Data[ 37308 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execSubmitCreateNucleusAccount_Parms SubmitCreateNucleusAccount_Parms;
 	memcpy ( &SubmitCreateNucleusAccount_Parms.sEmail, &sEmail, 0xC );
@@ -20569,10 +19663,9 @@ void USFXOnlineComponentBlazeLogin::SubmitCreateNucleusAccount ( struct FString
 
 void USFXOnlineComponentBlazeLogin::SubmitParentEmail ( unsigned long bContinue, struct FString ParentEmail )
 {
-	static UFunction* pFnSubmitParentEmail = NULL;
-
+	UFunction* pFnSubmitParentEmail = (UFunction*) SdkBindings::Get ( 3403 );
 	if ( ! pFnSubmitParentEmail )
-		pFnSubmitParentEmail = (UFunction*) UObject::GObjObjects()->Data[ 37305 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execSubmitParentEmail_Parms SubmitParentEmail_Parms;
 	SubmitParentEmail_Parms.bContinue = bContinue;
@@ -20594,10 +19687,9 @@ void USFXOnlineComponentBlazeLogin::SubmitParentEmail ( unsigned long bContinue,
 
 void USFXOnlineComponentBlazeLogin::SubmitNucleusLogin ( struct FString email, struct FString Password, unsigned char eReturnCode )
 {
-	static UFunction* pFnSubmitNucleusLogin = NULL;
-
+	UFunction* pFnSubmitNucleusLogin = (UFunction*) SdkBindings::Get ( 3402 );
 	if ( ! pFnSubmitNucleusLogin )
-		pFnSubmitNucleusLogin = (UFunction*) UObject::GObjObjects()->Data[ 37301 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execSubmitNucleusLogin_Parms SubmitNucleusLogin_Parms;
 	memcpy ( &SubmitNucleusLogin_Parms.email, &email, 0xC );
@@ -20619,10 +19711,9 @@ void USFXOnlineComponentBlazeLogin::SubmitNucleusLogin ( struct FString email, s
 
 void USFXOnlineComponentBlazeLogin::SubmitIntroPage ( unsigned long bContinue, unsigned long bSimulated )
 {
-	static UFunction* pFnSubmitIntroPage = NULL;
-
+	UFunction* pFnSubmitIntroPage = (UFunction*) SdkBindings::Get ( 3401 );
 	if ( ! pFnSubmitIntroPage )
-		pFnSubmitIntroPage = (UFunction*) UObject::GObjObjects()->Data[ 37298 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execSubmitIntroPage_Parms SubmitIntroPage_Parms;
 	SubmitIntroPage_Parms.bContinue = bContinue;
@@ -20642,10 +19733,9 @@ void USFXOnlineComponentBlazeLogin::SubmitIntroPage ( unsigned long bContinue, u
 
 void USFXOnlineComponentBlazeLogin::Connect ( unsigned char connectMode )
 {
-	static UFunction* pFnConnect = NULL;
-
+	UFunction* pFnConnect = (UFunction*) SdkBindings::Get ( 3400 );
 	if ( ! pFnConnect )
-		pFnConnect = (UFunction*) UObject::GObjObjects()->Data[ 37296 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execConnect_Parms Connect_Parms;
 	Connect_Parms.connectMode = connectMode;
@@ -20665,10 +19755,9 @@ void USFXOnlineComponentBlazeLogin::Connect ( unsigned char connectMode )
 
 void USFXOnlineComponentBlazeLogin::AutoLogin ( struct FString sEmail, struct FString sPassword )
 {
-	static UFunction* pFnAutoLogin = NULL;
-
+	UFunction* pFnAutoLogin = (UFunction*) SdkBindings::Get ( 3399 );
 	if ( ! pFnAutoLogin )
-		pFnAutoLogin = (UFunction*) UObject::GObjObjects()->Data[ 37293 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execAutoLogin_Parms AutoLogin_Parms;
 	memcpy ( &AutoLogin_Parms.sEmail, &sEmail, 0xC );
@@ -20688,10 +19777,9 @@ void USFXOnlineComponentBlazeLogin::AutoLogin ( struct FString sEmail, struct FS
 
 void USFXOnlineComponentBlazeLogin::AutoLoginWithAccountIndex ( int configAccountIndex )
 {
-	static UFunction* pFnAutoLoginWithAccountIndex = NULL;
-
+	UFunction* pFnAutoLoginWithAccountIndex = (UFunction*) SdkBindings::Get ( 3398 );
 	if ( ! pFnAutoLoginWithAccountIndex )
-		pFnAutoLoginWithAccountIndex = (UFunction*) UObject::GObjObjects()->Data[ 37291 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execAutoLoginWithAccountIndex_Parms AutoLoginWithAccountIndex_Parms;
 	AutoLoginWithAccountIndex_Parms.configAccountIndex = configAccountIndex;
@@ -20710,10 +19798,9 @@ void USFXOnlineComponentBlazeLogin::AutoLoginWithAccountIndex ( int configAccoun
 
 bool USFXOnlineComponentBlazeLogin::CheckAutoLoginFromIni ( )
 {
-	static UFunction* pFnCheckAutoLoginFromIni = NULL;
-
+	UFunction* pFnCheckAutoLoginFromIni = (UFunction*) SdkBindings::Get ( 3397 );
 	if ( ! pFnCheckAutoLoginFromIni )
-		pFnCheckAutoLoginFromIni = (UFunction*) UObject::GObjObjects()->Data[ 37289 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execCheckAutoLoginFromIni_Parms CheckAutoLoginFromIni_Parms;
 
@@ -20732,10 +19819,9 @@ bool USFXOnlineComponentBlazeLogin::CheckAutoLoginFromIni ( )
 
 void USFXOnlineComponentBlazeLogin::GoBackInUI ( )
 {
-	static UFunction* pFnGoBackInUI = NULL;
-
+	UFunction* pFnGoBackInUI = (UFunction*) SdkBindings::Get ( 3396 );
 	if ( ! pFnGoBackInUI )
-		pFnGoBackInUI = (UFunction*) UObject::GObjObjects()->Data[ 37288 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execGoBackInUI_Parms GoBackInUI_Parms;
 
@@ -20752,10 +19838,9 @@ void USFXOnlineComponentBlazeLogin::GoBackInUI ( )
 
 void USFXOnlineComponentBlazeLogin::Cancel ( )
 {
-	static UFunction* pFnCancel = NULL;
-
+	UFunction* pFnCancel = (UFunction*) SdkBindings::Get ( 3395 );
 	if ( ! pFnCancel )
-		pFnCancel = (UFunction*) UObject::GObjObjects()->Data[ 37287 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execCancel_Parms Cancel_Parms;
 
@@ -20773,10 +19858,9 @@ void USFXOnlineComponentBlazeLogin::Cancel ( )
 
 struct FUniqueNetId USFXOnlineComponentBlazeLogin::GetUserId ( )
 {
-	static UFunction* pFnGetUserId = NULL;
-
+	UFunction* pFnGetUserId = (UFunction*) SdkBindings::Get ( 3394 );
 	if ( ! pFnGetUserId )
-		pFnGetUserId = (UFunction*) UObject::GObjObjects()->Data[ 37285 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execGetUserId_Parms GetUserId_Parms;
 
@@ -20796,10 +19880,9 @@ struct FUniqueNetId USFXOnlineComponentBlazeLogin::GetUserId ( )
 
 struct FString USFXOnlineComponentBlazeLogin::GetPersonaName ( )
 {
-	static UFunction* pFnGetPersonaName = NULL;
-
+	UFunction* pFnGetPersonaName = (UFunction*) SdkBindings::Get ( 3393 );
 	if ( ! pFnGetPersonaName )
-		pFnGetPersonaName = (UFunction*) UObject::GObjObjects()->Data[ 37283 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execGetPersonaName_Parms GetPersonaName_Parms;
 
@@ -20819,10 +19902,9 @@ struct FString USFXOnlineComponentBlazeLogin::GetPersonaName ( )
 
 bool USFXOnlineComponentBlazeLogin::HasInternetConnection ( )
 {
-	static UFunction* pFnHasInternetConnection = NULL;
-
+	UFunction* pFnHasInternetConnection = (UFunction*) SdkBindings::Get ( 3392 );
 	if ( ! pFnHasInternetConnection )
-		pFnHasInternetConnection = (UFunction*) UObject::GObjObjects()->Data[ 37281 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execHasInternetConnection_Parms HasInternetConnection_Parms;
 
@@ -20842,10 +19924,9 @@ bool USFXOnlineComponentBlazeLogin::HasInternetConnection ( )
 
 bool USFXOnlineComponentBlazeLogin::IsConnectedTo1stPartyOnlineService ( )
 {
-	static UFunction* pFnIsConnectedTo1stPartyOnlineService = NULL;
-
+	UFunction* pFnIsConnectedTo1stPartyOnlineService = (UFunction*) SdkBindings::Get ( 3391 );
 	if ( ! pFnIsConnectedTo1stPartyOnlineService )
-		pFnIsConnectedTo1stPartyOnlineService = (UFunction*) UObject::GObjObjects()->Data[ 37279 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execIsConnectedTo1stPartyOnlineService_Parms IsConnectedTo1stPartyOnlineService_Parms;
 
@@ -20865,10 +19946,9 @@ bool USFXOnlineComponentBlazeLogin::IsConnectedTo1stPartyOnlineService ( )
 
 bool USFXOnlineComponentBlazeLogin::IsSignedIn ( )
 {
-	static UFunction* pFnIsSignedIn = NULL;
-
+	UFunction* pFnIsSignedIn = (UFunction*) SdkBindings::Get ( 3390 );
 	if ( ! pFnIsSignedIn )
-		pFnIsSignedIn = (UFunction*) UObject::GObjObjects()->Data[ 37277 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execIsSignedIn_Parms IsSignedIn_Parms;
 
@@ -20888,10 +19968,9 @@ bool USFXOnlineComponentBlazeLogin::IsSignedIn ( )
 
 bool USFXOnlineComponentBlazeLogin::IsConnected ( )
 {
-	static UFunction* pFnIsConnected = NULL;
-
+	UFunction* pFnIsConnected = (UFunction*) SdkBindings::Get ( 3389 );
 	if ( ! pFnIsConnected )
-		pFnIsConnected = (UFunction*) UObject::GObjObjects()->Data[ 37275 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execIsConnected_Parms IsConnected_Parms;
 
@@ -20912,10 +19991,9 @@ bool USFXOnlineComponentBlazeLogin::IsConnected ( )
 
 bool USFXOnlineComponentBlazeLogin::IsActiveUser ( struct FUniqueNetId userId )
 {
-	static UFunction* pFnIsActiveUser = NULL;
-
+	UFunction* pFnIsActiveUser = (UFunction*) SdkBindings::Get ( 3388 );
 	if ( ! pFnIsActiveUser )
-		pFnIsActiveUser = (UFunction*) UObject::GObjObjects()->Data[ 37272 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execIsActiveUser_Parms IsActiveUser_Parms;
 	memcpy ( &IsActiveUser_Parms.userId, &userId, 0x8 );
@@ -20936,10 +20014,9 @@ bool USFXOnlineComponentBlazeLogin::IsActiveUser ( struct FUniqueNetId userId )
 
 void USFXOnlineComponentBlazeLogin::SwitchActiveUserIndex ( int nNewIndex )
 {
-	static UFunction* pFnSwitchActiveUserIndex = NULL;
-
+	UFunction* pFnSwitchActiveUserIndex = (UFunction*) SdkBindings::Get ( 3387 );
 	if ( ! pFnSwitchActiveUserIndex )
-		pFnSwitchActiveUserIndex = (UFunction*) UObject::GObjObjects()->Data[ 37270 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execSwitchActiveUserIndex_Parms SwitchActiveUserIndex_Parms;
 	SwitchActiveUserIndex_Parms.nNewIndex = nNewIndex;
@@ -20958,10 +20035,9 @@ void USFXOnlineComponentBlazeLogin::SwitchActiveUserIndex ( int nNewIndex )
 
 int USFXOnlineComponentBlazeLogin::GetActiveUserIndex ( )
 {
-	static UFunction* pFnGetActiveUserIndex = NULL;
-
+	UFunction* pFnGetActiveUserIndex = (UFunction*) SdkBindings::Get ( 3386 );
 	if ( ! pFnGetActiveUserIndex )
-		pFnGetActiveUserIndex = (UFunction*) UObject::GObjObjects()->Data[ 37268 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execGetActiveUserIndex_Parms GetActiveUserIndex_Parms;
 
@@ -20981,10 +20057,9 @@ int USFXOnlineComponentBlazeLogin::GetActiveUserIndex ( )
 
 unsigned char USFXOnlineComponentBlazeLogin::GetLoginStatus ( )
 {
-	static UFunction* pFnGetLoginStatus = NULL;
-
+	UFunction* pFnGetLoginStatus = (UFunction*) SdkBindings::Get ( 3385 );
 	if ( ! pFnGetLoginStatus )
-		pFnGetLoginStatus = (UFunction*) UObject::GObjObjects()->Data[ 37266 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execGetLoginStatus_Parms GetLoginStatus_Parms;
 
@@ -21004,10 +20079,9 @@ unsigned char USFXOnlineComponentBlazeLogin::GetLoginStatus ( )
 
 struct FName USFXOnlineComponentBlazeLogin::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3384 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 37264 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -21026,10 +20100,9 @@ struct FName USFXOnlineComponentBlazeLogin::GetAPIName ( )
 
 void USFXOnlineComponentBlazeLogin::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3383 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 37263 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execOnRelease_Parms OnRelease_Parms;
 
@@ -21047,10 +20120,9 @@ void USFXOnlineComponentBlazeLogin::OnRelease ( )
 
 void USFXOnlineComponentBlazeLogin::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3382 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 37261 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -21070,10 +20142,9 @@ void USFXOnlineComponentBlazeLogin::OnInitialize ( class USFXOnlineSubsystem* oO
 
 int USFXOnlineComponentBlazeLogin::GetAuthToken ( struct FScriptDelegate funcAuthTokenRetrieved )
 {
-	static UFunction* pFnGetAuthToken = NULL;
-
+	UFunction* pFnGetAuthToken = (UFunction*) SdkBindings::Get ( 3381 );
 	if ( ! pFnGetAuthToken )
-		pFnGetAuthToken = (UFunction*) UObject::GObjObjects()->Data[ 37258 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_execGetAuthToken_Parms GetAuthToken_Parms;
 	memcpy ( &GetAuthToken_Parms.funcAuthTokenRetrieved, &funcAuthTokenRetrieved, 0xC );
@@ -21095,10 +20166,9 @@ int USFXOnlineComponentBlazeLogin::GetAuthToken ( struct FScriptDelegate funcAut
 
 class USFXOnlineJobGetAuthToken* USFXOnlineComponentBlazeLogin::eventCreateJobGetAuthToken ( struct FScriptDelegate funcAuthTokenRetrieved )
 {
-	static UFunction* pFnCreateJobGetAuthToken = NULL;
-
+	UFunction* pFnCreateJobGetAuthToken = (UFunction*) SdkBindings::Get ( 3379 );
 	if ( ! pFnCreateJobGetAuthToken )
-		pFnCreateJobGetAuthToken = (UFunction*) UObject::GObjObjects()->Data[ 37253 ];
+		return {};
 
 	USFXOnlineComponentBlazeLogin_eventCreateJobGetAuthToken_Parms CreateJobGetAuthToken_Parms;
 	memcpy ( &CreateJobGetAuthToken_Parms.funcAuthTokenRetrieved, &funcAuthTokenRetrieved, 0xC );
@@ -21116,10 +20186,9 @@ class USFXOnlineJobGetAuthToken* USFXOnlineComponentBlazeLogin::eventCreateJobGe
 
 void USFXOnlineComponentBlazeLogin::eventClearReadFriendsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadFriendsCompleteDelegate )
 {
-	static UFunction* pFnClearReadFriendsCompleteDelegate = NULL;
-
+	UFunction* pFnClearReadFriendsCompleteDelegate = (UFunction*) SdkBindings::Get ( 3378 );
 	if ( ! pFnClearReadFriendsCompleteDelegate )
-		pFnClearReadFriendsCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 37249 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_eventClearReadFriendsCompleteDelegate_Parms ClearReadFriendsCompleteDelegate_Parms;
 	ClearReadFriendsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -21136,10 +20205,9 @@ void USFXOnlineComponentBlazeLogin::eventClearReadFriendsCompleteDelegate ( unsi
 
 void USFXOnlineComponentBlazeLogin::eventAddReadFriendsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadFriendsCompleteDelegate )
 {
-	static UFunction* pFnAddReadFriendsCompleteDelegate = NULL;
-
+	UFunction* pFnAddReadFriendsCompleteDelegate = (UFunction*) SdkBindings::Get ( 3375 );
 	if ( ! pFnAddReadFriendsCompleteDelegate )
-		pFnAddReadFriendsCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 37241 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_eventAddReadFriendsCompleteDelegate_Parms AddReadFriendsCompleteDelegate_Parms;
 	AddReadFriendsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -21155,10 +20223,9 @@ void USFXOnlineComponentBlazeLogin::eventAddReadFriendsCompleteDelegate ( unsign
 
 void USFXOnlineComponentBlazeLogin::OnReadFriendsComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnReadFriendsComplete = NULL;
-
+	UFunction* pFnOnReadFriendsComplete = (UFunction*) SdkBindings::Get ( 3374 );
 	if ( ! pFnOnReadFriendsComplete )
-		pFnOnReadFriendsComplete = (UFunction*) UObject::GObjObjects()->Data[ 37239 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execOnReadFriendsComplete_Parms OnReadFriendsComplete_Parms;
 	OnReadFriendsComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -21173,10 +20240,9 @@ void USFXOnlineComponentBlazeLogin::OnReadFriendsComplete ( unsigned long bWasSu
 
 void USFXOnlineComponentBlazeLogin::OnAuthTokenRetrieved ( struct FString token )
 {
-	static UFunction* pFnOnAuthTokenRetrieved = NULL;
-
+	UFunction* pFnOnAuthTokenRetrieved = (UFunction*) SdkBindings::Get ( 3373 );
 	if ( ! pFnOnAuthTokenRetrieved )
-		pFnOnAuthTokenRetrieved = (UFunction*) UObject::GObjObjects()->Data[ 37237 ];
+		return;
 
 	USFXOnlineComponentBlazeLogin_execOnAuthTokenRetrieved_Parms OnAuthTokenRetrieved_Parms;
 	memcpy ( &OnAuthTokenRetrieved_Parms.token, &token, 0xC );
@@ -21191,10 +20257,9 @@ void USFXOnlineComponentBlazeLogin::OnAuthTokenRetrieved ( struct FString token
 
 void USFXOnlineComponentBlazeLoginPC::SetExternalDRMDataLoaded ( unsigned long bValue )
 {
-	static UFunction* pFnSetExternalDRMDataLoaded = NULL;
-
+	UFunction* pFnSetExternalDRMDataLoaded = (UFunction*) SdkBindings::Get ( 3451 );
 	if ( ! pFnSetExternalDRMDataLoaded )
-		pFnSetExternalDRMDataLoaded = (UFunction*) UObject::GObjObjects()->Data[ 37424 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execSetExternalDRMDataLoaded_Parms SetExternalDRMDataLoaded_Parms;
 	SetExternalDRMDataLoaded_Parms.bValue = bValue;
@@ -21213,10 +20278,9 @@ void USFXOnlineComponentBlazeLoginPC::SetExternalDRMDataLoaded ( unsigned long b
 
 void USFXOnlineComponentBlazeLoginPC::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
-
+	UFunction* pFnOnTick = (UFunction*) SdkBindings::Get ( 3452 );
 	if ( ! pFnOnTick )
-		pFnOnTick = (UFunction*) UObject::GObjObjects()->Data[ 37462 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
@@ -21236,10 +20300,9 @@ void USFXOnlineComponentBlazeLoginPC::OnTick ( class USFXOnlineEvent* oEvent )
 
 void USFXOnlineComponentBlazeLoginPC::OnOriginAuthKeyAvailableCallback ( unsigned long Success, struct FString authKey )
 {
-	static UFunction* pFnOnOriginAuthKeyAvailableCallback = NULL;
-
+	UFunction* pFnOnOriginAuthKeyAvailableCallback = (UFunction*) SdkBindings::Get ( 3450 );
 	if ( ! pFnOnOriginAuthKeyAvailableCallback )
-		pFnOnOriginAuthKeyAvailableCallback = (UFunction*) UObject::GObjObjects()->Data[ 37420 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execOnOriginAuthKeyAvailableCallback_Parms OnOriginAuthKeyAvailableCallback_Parms;
 	OnOriginAuthKeyAvailableCallback_Parms.Success = Success;
@@ -21259,10 +20322,9 @@ void USFXOnlineComponentBlazeLoginPC::OnOriginAuthKeyAvailableCallback ( unsigne
 
 void USFXOnlineComponentBlazeLoginPC::OnPromptRedeemCodeResult ( int nResult )
 {
-	static UFunction* pFnOnPromptRedeemCodeResult = NULL;
-
+	UFunction* pFnOnPromptRedeemCodeResult = (UFunction*) SdkBindings::Get ( 3449 );
 	if ( ! pFnOnPromptRedeemCodeResult )
-		pFnOnPromptRedeemCodeResult = (UFunction*) UObject::GObjObjects()->Data[ 37418 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execOnPromptRedeemCodeResult_Parms OnPromptRedeemCodeResult_Parms;
 	OnPromptRedeemCodeResult_Parms.nResult = nResult;
@@ -21281,10 +20343,9 @@ void USFXOnlineComponentBlazeLoginPC::OnPromptRedeemCodeResult ( int nResult )
 
 void USFXOnlineComponentBlazeLoginPC::SuspendUserPing ( unsigned long suspend )
 {
-	static UFunction* pFnSuspendUserPing = NULL;
-
+	UFunction* pFnSuspendUserPing = (UFunction*) SdkBindings::Get ( 3448 );
 	if ( ! pFnSuspendUserPing )
-		pFnSuspendUserPing = (UFunction*) UObject::GObjObjects()->Data[ 37416 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execSuspendUserPing_Parms SuspendUserPing_Parms;
 	SuspendUserPing_Parms.suspend = suspend;
@@ -21303,10 +20364,9 @@ void USFXOnlineComponentBlazeLoginPC::SuspendUserPing ( unsigned long suspend )
 
 bool USFXOnlineComponentBlazeLoginPC::GetDefaultBiowareEmailAllowed ( )
 {
-	static UFunction* pFnGetDefaultBiowareEmailAllowed = NULL;
-
+	UFunction* pFnGetDefaultBiowareEmailAllowed = (UFunction*) SdkBindings::Get ( 3447 );
 	if ( ! pFnGetDefaultBiowareEmailAllowed )
-		pFnGetDefaultBiowareEmailAllowed = (UFunction*) UObject::GObjObjects()->Data[ 37414 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execGetDefaultBiowareEmailAllowed_Parms GetDefaultBiowareEmailAllowed_Parms;
 
@@ -21326,10 +20386,9 @@ bool USFXOnlineComponentBlazeLoginPC::GetDefaultBiowareEmailAllowed ( )
 
 unsigned char USFXOnlineComponentBlazeLoginPC::GetConnectMode ( )
 {
-	static UFunction* pFnGetConnectMode = NULL;
-
+	UFunction* pFnGetConnectMode = (UFunction*) SdkBindings::Get ( 3446 );
 	if ( ! pFnGetConnectMode )
-		pFnGetConnectMode = (UFunction*) UObject::GObjObjects()->Data[ 37412 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execGetConnectMode_Parms GetConnectMode_Parms;
 
@@ -21349,10 +20408,9 @@ unsigned char USFXOnlineComponentBlazeLoginPC::GetConnectMode ( )
 
 void USFXOnlineComponentBlazeLoginPC::AddFriendsCompleteCb ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnAddFriendsCompleteCb = NULL;
-
+	UFunction* pFnAddFriendsCompleteCb = (UFunction*) SdkBindings::Get ( 3445 );
 	if ( ! pFnAddFriendsCompleteCb )
-		pFnAddFriendsCompleteCb = (UFunction*) UObject::GObjObjects()->Data[ 37410 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execAddFriendsCompleteCb_Parms AddFriendsCompleteCb_Parms;
 	AddFriendsCompleteCb_Parms.bWasSuccessful = bWasSuccessful;
@@ -21370,10 +20428,9 @@ void USFXOnlineComponentBlazeLoginPC::AddFriendsCompleteCb ( unsigned long bWasS
 
 void USFXOnlineComponentBlazeLoginPC::PostImportFriendListToBlaze ( )
 {
-	static UFunction* pFnPostImportFriendListToBlaze = NULL;
-
+	UFunction* pFnPostImportFriendListToBlaze = (UFunction*) SdkBindings::Get ( 3444 );
 	if ( ! pFnPostImportFriendListToBlaze )
-		pFnPostImportFriendListToBlaze = (UFunction*) UObject::GObjObjects()->Data[ 37409 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execPostImportFriendListToBlaze_Parms PostImportFriendListToBlaze_Parms;
 
@@ -21392,10 +20449,9 @@ void USFXOnlineComponentBlazeLoginPC::PostImportFriendListToBlaze ( )
 
 bool USFXOnlineComponentBlazeLoginPC::ImportFriendListToBlaze ( struct FScriptDelegate funcImportFriendListToBlazeCompleted )
 {
-	static UFunction* pFnImportFriendListToBlaze = NULL;
-
+	UFunction* pFnImportFriendListToBlaze = (UFunction*) SdkBindings::Get ( 3443 );
 	if ( ! pFnImportFriendListToBlaze )
-		pFnImportFriendListToBlaze = (UFunction*) UObject::GObjObjects()->Data[ 37406 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execImportFriendListToBlaze_Parms ImportFriendListToBlaze_Parms;
 	memcpy ( &ImportFriendListToBlaze_Parms.funcImportFriendListToBlazeCompleted, &funcImportFriendListToBlazeCompleted, 0xC );
@@ -21416,10 +20472,9 @@ bool USFXOnlineComponentBlazeLoginPC::ImportFriendListToBlaze ( struct FScriptDe
 
 void USFXOnlineComponentBlazeLoginPC::OnImportFriendListToBlazeCompleted ( unsigned char errorCode )
 {
-	static UFunction* pFnOnImportFriendListToBlazeCompleted = NULL;
-
+	UFunction* pFnOnImportFriendListToBlazeCompleted = (UFunction*) SdkBindings::Get ( 3442 );
 	if ( ! pFnOnImportFriendListToBlazeCompleted )
-		pFnOnImportFriendListToBlazeCompleted = (UFunction*) UObject::GObjObjects()->Data[ 37404 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execOnImportFriendListToBlazeCompleted_Parms OnImportFriendListToBlazeCompleted_Parms;
 	OnImportFriendListToBlazeCompleted_Parms.errorCode = errorCode;
@@ -21434,10 +20489,9 @@ void USFXOnlineComponentBlazeLoginPC::OnImportFriendListToBlazeCompleted ( unsig
 
 void USFXOnlineComponentBlazeLoginPC::RequestImportFriendListToBlaze ( unsigned long callPostImportFriendListToBlaze )
 {
-	static UFunction* pFnRequestImportFriendListToBlaze = NULL;
-
+	UFunction* pFnRequestImportFriendListToBlaze = (UFunction*) SdkBindings::Get ( 3441 );
 	if ( ! pFnRequestImportFriendListToBlaze )
-		pFnRequestImportFriendListToBlaze = (UFunction*) UObject::GObjObjects()->Data[ 37402 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execRequestImportFriendListToBlaze_Parms RequestImportFriendListToBlaze_Parms;
 	RequestImportFriendListToBlaze_Parms.callPostImportFriendListToBlaze = callPostImportFriendListToBlaze;
@@ -21457,10 +20511,9 @@ void USFXOnlineComponentBlazeLoginPC::RequestImportFriendListToBlaze ( unsigned
 
 class USFXOnlineJobImportFriendListToBlaze* USFXOnlineComponentBlazeLoginPC::eventCreateJobImportFriendListToBlaze ( unsigned long callPostImportFriendListToBlaze )
 {
-	static UFunction* pFnCreateJobImportFriendListToBlaze = NULL;
-
+	UFunction* pFnCreateJobImportFriendListToBlaze = (UFunction*) SdkBindings::Get ( 3439 );
 	if ( ! pFnCreateJobImportFriendListToBlaze )
-		pFnCreateJobImportFriendListToBlaze = (UFunction*) UObject::GObjObjects()->Data[ 37397 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_eventCreateJobImportFriendListToBlaze_Parms CreateJobImportFriendListToBlaze_Parms;
 	CreateJobImportFriendListToBlaze_Parms.callPostImportFriendListToBlaze = callPostImportFriendListToBlaze;
@@ -21478,10 +20531,9 @@ class USFXOnlineJobImportFriendListToBlaze* USFXOnlineComponentBlazeLoginPC::eve
 
 unsigned char USFXOnlineComponentBlazeLoginPC::CanShowPresenceInformation ( int nUserIndex )
 {
-	static UFunction* pFnCanShowPresenceInformation = NULL;
-
+	UFunction* pFnCanShowPresenceInformation = (UFunction*) SdkBindings::Get ( 3438 );
 	if ( ! pFnCanShowPresenceInformation )
-		pFnCanShowPresenceInformation = (UFunction*) UObject::GObjObjects()->Data[ 37394 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execCanShowPresenceInformation_Parms CanShowPresenceInformation_Parms;
 	CanShowPresenceInformation_Parms.nUserIndex = nUserIndex;
@@ -21503,10 +20555,9 @@ unsigned char USFXOnlineComponentBlazeLoginPC::CanShowPresenceInformation ( int
 
 unsigned char USFXOnlineComponentBlazeLoginPC::CanViewPlayerProfiles ( int nUserIndex )
 {
-	static UFunction* pFnCanViewPlayerProfiles = NULL;
-
+	UFunction* pFnCanViewPlayerProfiles = (UFunction*) SdkBindings::Get ( 3437 );
 	if ( ! pFnCanViewPlayerProfiles )
-		pFnCanViewPlayerProfiles = (UFunction*) UObject::GObjObjects()->Data[ 37391 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execCanViewPlayerProfiles_Parms CanViewPlayerProfiles_Parms;
 	CanViewPlayerProfiles_Parms.nUserIndex = nUserIndex;
@@ -21528,10 +20579,9 @@ unsigned char USFXOnlineComponentBlazeLoginPC::CanViewPlayerProfiles ( int nUser
 
 unsigned char USFXOnlineComponentBlazeLoginPC::CanPurchaseContent ( int nUserIndex )
 {
-	static UFunction* pFnCanPurchaseContent = NULL;
-
+	UFunction* pFnCanPurchaseContent = (UFunction*) SdkBindings::Get ( 3436 );
 	if ( ! pFnCanPurchaseContent )
-		pFnCanPurchaseContent = (UFunction*) UObject::GObjObjects()->Data[ 37388 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execCanPurchaseContent_Parms CanPurchaseContent_Parms;
 	CanPurchaseContent_Parms.nUserIndex = nUserIndex;
@@ -21553,10 +20603,9 @@ unsigned char USFXOnlineComponentBlazeLoginPC::CanPurchaseContent ( int nUserInd
 
 unsigned char USFXOnlineComponentBlazeLoginPC::CanDownloadUserContent ( int nUserIndex )
 {
-	static UFunction* pFnCanDownloadUserContent = NULL;
-
+	UFunction* pFnCanDownloadUserContent = (UFunction*) SdkBindings::Get ( 3435 );
 	if ( ! pFnCanDownloadUserContent )
-		pFnCanDownloadUserContent = (UFunction*) UObject::GObjObjects()->Data[ 37385 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execCanDownloadUserContent_Parms CanDownloadUserContent_Parms;
 	CanDownloadUserContent_Parms.nUserIndex = nUserIndex;
@@ -21578,10 +20627,9 @@ unsigned char USFXOnlineComponentBlazeLoginPC::CanDownloadUserContent ( int nUse
 
 unsigned char USFXOnlineComponentBlazeLoginPC::CanCommunicate ( int nUserIndex )
 {
-	static UFunction* pFnCanCommunicate = NULL;
-
+	UFunction* pFnCanCommunicate = (UFunction*) SdkBindings::Get ( 3434 );
 	if ( ! pFnCanCommunicate )
-		pFnCanCommunicate = (UFunction*) UObject::GObjObjects()->Data[ 37382 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execCanCommunicate_Parms CanCommunicate_Parms;
 	CanCommunicate_Parms.nUserIndex = nUserIndex;
@@ -21603,10 +20651,9 @@ unsigned char USFXOnlineComponentBlazeLoginPC::CanCommunicate ( int nUserIndex )
 
 unsigned char USFXOnlineComponentBlazeLoginPC::CanPlayOnline ( int nUserIndex )
 {
-	static UFunction* pFnCanPlayOnline = NULL;
-
+	UFunction* pFnCanPlayOnline = (UFunction*) SdkBindings::Get ( 3433 );
 	if ( ! pFnCanPlayOnline )
-		pFnCanPlayOnline = (UFunction*) UObject::GObjObjects()->Data[ 37379 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execCanPlayOnline_Parms CanPlayOnline_Parms;
 	CanPlayOnline_Parms.nUserIndex = nUserIndex;
@@ -21626,10 +20673,9 @@ unsigned char USFXOnlineComponentBlazeLoginPC::CanPlayOnline ( int nUserIndex )
 
 void USFXOnlineComponentBlazeLoginPC::OnDownloadOffersUICompleted ( )
 {
-	static UFunction* pFnOnDownloadOffersUICompleted = NULL;
-
+	UFunction* pFnOnDownloadOffersUICompleted = (UFunction*) SdkBindings::Get ( 3432 );
 	if ( ! pFnOnDownloadOffersUICompleted )
-		pFnOnDownloadOffersUICompleted = (UFunction*) UObject::GObjObjects()->Data[ 37378 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execOnDownloadOffersUICompleted_Parms OnDownloadOffersUICompleted_Parms;
 
@@ -21646,10 +20692,9 @@ void USFXOnlineComponentBlazeLoginPC::OnDownloadOffersUICompleted ( )
 
 void USFXOnlineComponentBlazeLoginPC::OnDLCInfoLoaded ( )
 {
-	static UFunction* pFnOnDLCInfoLoaded = NULL;
-
+	UFunction* pFnOnDLCInfoLoaded = (UFunction*) SdkBindings::Get ( 3431 );
 	if ( ! pFnOnDLCInfoLoaded )
-		pFnOnDLCInfoLoaded = (UFunction*) UObject::GObjObjects()->Data[ 37377 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execOnDLCInfoLoaded_Parms OnDLCInfoLoaded_Parms;
 
@@ -21666,10 +20711,9 @@ void USFXOnlineComponentBlazeLoginPC::OnDLCInfoLoaded ( )
 
 void USFXOnlineComponentBlazeLoginPC::OpenCerberusUI ( )
 {
-	static UFunction* pFnOpenCerberusUI = NULL;
-
+	UFunction* pFnOpenCerberusUI = (UFunction*) SdkBindings::Get ( 3430 );
 	if ( ! pFnOpenCerberusUI )
-		pFnOpenCerberusUI = (UFunction*) UObject::GObjObjects()->Data[ 37376 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execOpenCerberusUI_Parms OpenCerberusUI_Parms;
 
@@ -21687,10 +20731,9 @@ void USFXOnlineComponentBlazeLoginPC::OpenCerberusUI ( )
 
 void USFXOnlineComponentBlazeLoginPC::EnterCDKey ( struct FString sKey )
 {
-	static UFunction* pFnEnterCDKey = NULL;
-
+	UFunction* pFnEnterCDKey = (UFunction*) SdkBindings::Get ( 3429 );
 	if ( ! pFnEnterCDKey )
-		pFnEnterCDKey = (UFunction*) UObject::GObjObjects()->Data[ 37374 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execEnterCDKey_Parms EnterCDKey_Parms;
 	memcpy ( &EnterCDKey_Parms.sKey, &sKey, 0xC );
@@ -21709,10 +20752,9 @@ void USFXOnlineComponentBlazeLoginPC::EnterCDKey ( struct FString sKey )
 
 void USFXOnlineComponentBlazeLoginPC::Buy ( unsigned char nPurchaseSource )
 {
-	static UFunction* pFnBuy = NULL;
-
+	UFunction* pFnBuy = (UFunction*) SdkBindings::Get ( 3428 );
 	if ( ! pFnBuy )
-		pFnBuy = (UFunction*) UObject::GObjObjects()->Data[ 37372 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execBuy_Parms Buy_Parms;
 	Buy_Parms.nPurchaseSource = nPurchaseSource;
@@ -21731,10 +20773,9 @@ void USFXOnlineComponentBlazeLoginPC::Buy ( unsigned char nPurchaseSource )
 
 void USFXOnlineComponentBlazeLoginPC::CompleteBuildEntitlementListUponRedeption ( int nResult )
 {
-	static UFunction* pFnCompleteBuildEntitlementListUponRedeption = NULL;
-
+	UFunction* pFnCompleteBuildEntitlementListUponRedeption = (UFunction*) SdkBindings::Get ( 3427 );
 	if ( ! pFnCompleteBuildEntitlementListUponRedeption )
-		pFnCompleteBuildEntitlementListUponRedeption = (UFunction*) UObject::GObjObjects()->Data[ 37370 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execCompleteBuildEntitlementListUponRedeption_Parms CompleteBuildEntitlementListUponRedeption_Parms;
 	CompleteBuildEntitlementListUponRedeption_Parms.nResult = nResult;
@@ -21753,10 +20794,9 @@ void USFXOnlineComponentBlazeLoginPC::CompleteBuildEntitlementListUponRedeption
 
 void USFXOnlineComponentBlazeLoginPC::CompleteBuildEntitlementListUponLogin ( int nResult )
 {
-	static UFunction* pFnCompleteBuildEntitlementListUponLogin = NULL;
-
+	UFunction* pFnCompleteBuildEntitlementListUponLogin = (UFunction*) SdkBindings::Get ( 3426 );
 	if ( ! pFnCompleteBuildEntitlementListUponLogin )
-		pFnCompleteBuildEntitlementListUponLogin = (UFunction*) UObject::GObjObjects()->Data[ 37368 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execCompleteBuildEntitlementListUponLogin_Parms CompleteBuildEntitlementListUponLogin_Parms;
 	CompleteBuildEntitlementListUponLogin_Parms.nResult = nResult;
@@ -21777,10 +20817,9 @@ void USFXOnlineComponentBlazeLoginPC::CompleteBuildEntitlementListUponLogin ( in
 
 bool USFXOnlineComponentBlazeLoginPC::BuildEntitlementList ( unsigned long bFirstCallUponLogin, int nPage )
 {
-	static UFunction* pFnBuildEntitlementList = NULL;
-
+	UFunction* pFnBuildEntitlementList = (UFunction*) SdkBindings::Get ( 3425 );
 	if ( ! pFnBuildEntitlementList )
-		pFnBuildEntitlementList = (UFunction*) UObject::GObjObjects()->Data[ 37364 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execBuildEntitlementList_Parms BuildEntitlementList_Parms;
 	BuildEntitlementList_Parms.bFirstCallUponLogin = bFirstCallUponLogin;
@@ -21802,10 +20841,9 @@ bool USFXOnlineComponentBlazeLoginPC::BuildEntitlementList ( unsigned long bFirs
 
 bool USFXOnlineComponentBlazeLoginPC::IsCerberusMember ( )
 {
-	static UFunction* pFnIsCerberusMember = NULL;
-
+	UFunction* pFnIsCerberusMember = (UFunction*) SdkBindings::Get ( 3424 );
 	if ( ! pFnIsCerberusMember )
-		pFnIsCerberusMember = (UFunction*) UObject::GObjObjects()->Data[ 37362 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execIsCerberusMember_Parms IsCerberusMember_Parms;
 
@@ -21825,10 +20863,9 @@ bool USFXOnlineComponentBlazeLoginPC::IsCerberusMember ( )
 
 void USFXOnlineComponentBlazeLoginPC::DisablePersona ( struct FString sPersonaNonGrata )
 {
-	static UFunction* pFnDisablePersona = NULL;
-
+	UFunction* pFnDisablePersona = (UFunction*) SdkBindings::Get ( 3423 );
 	if ( ! pFnDisablePersona )
-		pFnDisablePersona = (UFunction*) UObject::GObjObjects()->Data[ 37360 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execDisablePersona_Parms DisablePersona_Parms;
 	memcpy ( &DisablePersona_Parms.sPersonaNonGrata, &sPersonaNonGrata, 0xC );
@@ -21847,10 +20884,9 @@ void USFXOnlineComponentBlazeLoginPC::DisablePersona ( struct FString sPersonaNo
 
 void USFXOnlineComponentBlazeLoginPC::CreatePersona ( struct FString sPersonaName )
 {
-	static UFunction* pFnCreatePersona = NULL;
-
+	UFunction* pFnCreatePersona = (UFunction*) SdkBindings::Get ( 3422 );
 	if ( ! pFnCreatePersona )
-		pFnCreatePersona = (UFunction*) UObject::GObjObjects()->Data[ 37358 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execCreatePersona_Parms CreatePersona_Parms;
 	memcpy ( &CreatePersona_Parms.sPersonaName, &sPersonaName, 0xC );
@@ -21869,10 +20905,9 @@ void USFXOnlineComponentBlazeLoginPC::CreatePersona ( struct FString sPersonaNam
 
 void USFXOnlineComponentBlazeLoginPC::SelectPersona ( struct FString sPersonaName )
 {
-	static UFunction* pFnSelectPersona = NULL;
-
+	UFunction* pFnSelectPersona = (UFunction*) SdkBindings::Get ( 3421 );
 	if ( ! pFnSelectPersona )
-		pFnSelectPersona = (UFunction*) UObject::GObjObjects()->Data[ 37356 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execSelectPersona_Parms SelectPersona_Parms;
 	memcpy ( &SelectPersona_Parms.sPersonaName, &sPersonaName, 0xC );
@@ -21891,10 +20926,9 @@ void USFXOnlineComponentBlazeLoginPC::SelectPersona ( struct FString sPersonaNam
 
 void USFXOnlineComponentBlazeLoginPC::AcceptTOS ( unsigned long bAccepted )
 {
-	static UFunction* pFnAcceptTOS = NULL;
-
+	UFunction* pFnAcceptTOS = (UFunction*) SdkBindings::Get ( 3420 );
 	if ( ! pFnAcceptTOS )
-		pFnAcceptTOS = (UFunction*) UObject::GObjObjects()->Data[ 37354 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execAcceptTOS_Parms AcceptTOS_Parms;
 	AcceptTOS_Parms.bAccepted = bAccepted;
@@ -21913,10 +20947,9 @@ void USFXOnlineComponentBlazeLoginPC::AcceptTOS ( unsigned long bAccepted )
 
 void USFXOnlineComponentBlazeLoginPC::Disconnect ( unsigned long bShowError )
 {
-	static UFunction* pFnDisconnect = NULL;
-
+	UFunction* pFnDisconnect = (UFunction*) SdkBindings::Get ( 3419 );
 	if ( ! pFnDisconnect )
-		pFnDisconnect = (UFunction*) UObject::GObjObjects()->Data[ 37352 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execDisconnect_Parms Disconnect_Parms;
 	Disconnect_Parms.bShowError = bShowError;
@@ -21935,10 +20968,9 @@ void USFXOnlineComponentBlazeLoginPC::Disconnect ( unsigned long bShowError )
 
 void USFXOnlineComponentBlazeLoginPC::On1stPartyServiceLoginResult ( unsigned long loggedIn )
 {
-	static UFunction* pFnOn1stPartyServiceLoginResult = NULL;
-
+	UFunction* pFnOn1stPartyServiceLoginResult = (UFunction*) SdkBindings::Get ( 3418 );
 	if ( ! pFnOn1stPartyServiceLoginResult )
-		pFnOn1stPartyServiceLoginResult = (UFunction*) UObject::GObjObjects()->Data[ 37350 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execOn1stPartyServiceLoginResult_Parms On1stPartyServiceLoginResult_Parms;
 	On1stPartyServiceLoginResult_Parms.loggedIn = loggedIn;
@@ -21957,10 +20989,9 @@ void USFXOnlineComponentBlazeLoginPC::On1stPartyServiceLoginResult ( unsigned lo
 
 bool USFXOnlineComponentBlazeLoginPC::eventShow1stPartyServiceLogin ( )
 {
-	static UFunction* pFnShow1stPartyServiceLogin = NULL;
-
+	UFunction* pFnShow1stPartyServiceLogin = (UFunction*) SdkBindings::Get ( 3417 );
 	if ( ! pFnShow1stPartyServiceLogin )
-		pFnShow1stPartyServiceLogin = (UFunction*) UObject::GObjObjects()->Data[ 37348 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_eventShow1stPartyServiceLogin_Parms Show1stPartyServiceLogin_Parms;
 
@@ -21976,10 +21007,9 @@ bool USFXOnlineComponentBlazeLoginPC::eventShow1stPartyServiceLogin ( )
 
 bool USFXOnlineComponentBlazeLoginPC::Show1stPartyServiceLoginImp ( )
 {
-	static UFunction* pFnShow1stPartyServiceLoginImp = NULL;
-
+	UFunction* pFnShow1stPartyServiceLoginImp = (UFunction*) SdkBindings::Get ( 3416 );
 	if ( ! pFnShow1stPartyServiceLoginImp )
-		pFnShow1stPartyServiceLoginImp = (UFunction*) UObject::GObjObjects()->Data[ 37346 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execShow1stPartyServiceLoginImp_Parms Show1stPartyServiceLoginImp_Parms;
 
@@ -21994,10 +21024,9 @@ bool USFXOnlineComponentBlazeLoginPC::Show1stPartyServiceLoginImp ( )
 
 void USFXOnlineComponentBlazeLoginPC::CompleteLoginProcess ( )
 {
-	static UFunction* pFnCompleteLoginProcess = NULL;
-
+	UFunction* pFnCompleteLoginProcess = (UFunction*) SdkBindings::Get ( 3415 );
 	if ( ! pFnCompleteLoginProcess )
-		pFnCompleteLoginProcess = (UFunction*) UObject::GObjObjects()->Data[ 37345 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execCompleteLoginProcess_Parms CompleteLoginProcess_Parms;
 
@@ -22014,10 +21043,9 @@ void USFXOnlineComponentBlazeLoginPC::CompleteLoginProcess ( )
 
 void USFXOnlineComponentBlazeLoginPC::StartCerberusLogin ( )
 {
-	static UFunction* pFnStartCerberusLogin = NULL;
-
+	UFunction* pFnStartCerberusLogin = (UFunction*) SdkBindings::Get ( 3414 );
 	if ( ! pFnStartCerberusLogin )
-		pFnStartCerberusLogin = (UFunction*) UObject::GObjObjects()->Data[ 37344 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execStartCerberusLogin_Parms StartCerberusLogin_Parms;
 
@@ -22035,10 +21063,9 @@ void USFXOnlineComponentBlazeLoginPC::StartCerberusLogin ( )
 
 void USFXOnlineComponentBlazeLoginPC::SubmitStore ( TArray< int > aiChosen )
 {
-	static UFunction* pFnSubmitStore = NULL;
-
+	UFunction* pFnSubmitStore = (UFunction*) SdkBindings::Get ( 3413 );
 	if ( ! pFnSubmitStore )
-		pFnSubmitStore = (UFunction*) UObject::GObjObjects()->Data[ 37341 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execSubmitStore_Parms SubmitStore_Parms;
 	memcpy ( &SubmitStore_Parms.aiChosen, &aiChosen, 0xC );
@@ -22067,10 +21094,9 @@ void USFXOnlineComponentBlazeLoginPC::SubmitStore ( TArray< int > aiChosen )
 
 void USFXOnlineComponentBlazeLoginPC::SubmitCreateNucleusAccountEx ( struct FString sEmail, struct FString sPassword, unsigned long bEAProducts, unsigned long bThirdParty, unsigned long bBioWareProducts, struct FString i_sCountryCode, int BirthDay, int BirthMonth, int BirthYear, struct FString i_sLanguageCode, unsigned long bSubmit )
 {
-	static UFunction* pFnSubmitCreateNucleusAccountEx = NULL;
-
+	UFunction* pFnSubmitCreateNucleusAccountEx = (UFunction*) SdkBindings::Get ( 3412 );
 	if ( ! pFnSubmitCreateNucleusAccountEx )
-		pFnSubmitCreateNucleusAccountEx = (UFunction*) UObject::GObjObjects()->Data[ 37329 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execSubmitCreateNucleusAccountEx_Parms SubmitCreateNucleusAccountEx_Parms;
 	memcpy ( &SubmitCreateNucleusAccountEx_Parms.sEmail, &sEmail, 0xC );
@@ -22101,10 +21127,9 @@ void USFXOnlineComponentBlazeLoginPC::SubmitCreateNucleusAccountEx ( struct FStr
 
 void USFXOnlineComponentBlazeLoginPC::SubmitEmailPasswordMismatch ( struct FString email, struct FString Password, int eReturnCode )
 {
-	static UFunction* pFnSubmitEmailPasswordMismatch = NULL;
-
+	UFunction* pFnSubmitEmailPasswordMismatch = (UFunction*) SdkBindings::Get ( 3411 );
 	if ( ! pFnSubmitEmailPasswordMismatch )
-		pFnSubmitEmailPasswordMismatch = (UFunction*) UObject::GObjObjects()->Data[ 37325 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execSubmitEmailPasswordMismatch_Parms SubmitEmailPasswordMismatch_Parms;
 	memcpy ( &SubmitEmailPasswordMismatch_Parms.email, &email, 0xC );
@@ -22125,10 +21150,9 @@ void USFXOnlineComponentBlazeLoginPC::SubmitEmailPasswordMismatch ( struct FStri
 
 void USFXOnlineComponentBlazeLoginPC::SubmitMessageBox ( int eReturnCode )
 {
-	static UFunction* pFnSubmitMessageBox = NULL;
-
+	UFunction* pFnSubmitMessageBox = (UFunction*) SdkBindings::Get ( 3410 );
 	if ( ! pFnSubmitMessageBox )
-		pFnSubmitMessageBox = (UFunction*) UObject::GObjObjects()->Data[ 37323 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execSubmitMessageBox_Parms SubmitMessageBox_Parms;
 	SubmitMessageBox_Parms.eReturnCode = eReturnCode;
@@ -22148,10 +21172,9 @@ void USFXOnlineComponentBlazeLoginPC::SubmitMessageBox ( int eReturnCode )
 
 void USFXOnlineComponentBlazeLoginPC::SubmitRedeemCode ( unsigned long bContinue, struct FString i_sCode )
 {
-	static UFunction* pFnSubmitRedeemCode = NULL;
-
+	UFunction* pFnSubmitRedeemCode = (UFunction*) SdkBindings::Get ( 3409 );
 	if ( ! pFnSubmitRedeemCode )
-		pFnSubmitRedeemCode = (UFunction*) UObject::GObjObjects()->Data[ 37320 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execSubmitRedeemCode_Parms SubmitRedeemCode_Parms;
 	SubmitRedeemCode_Parms.bContinue = bContinue;
@@ -22170,10 +21193,9 @@ void USFXOnlineComponentBlazeLoginPC::SubmitRedeemCode ( unsigned long bContinue
 
 void USFXOnlineComponentBlazeLoginPC::SubmitCerberusWelcomeMessage ( )
 {
-	static UFunction* pFnSubmitCerberusWelcomeMessage = NULL;
-
+	UFunction* pFnSubmitCerberusWelcomeMessage = (UFunction*) SdkBindings::Get ( 3408 );
 	if ( ! pFnSubmitCerberusWelcomeMessage )
-		pFnSubmitCerberusWelcomeMessage = (UFunction*) UObject::GObjObjects()->Data[ 37319 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execSubmitCerberusWelcomeMessage_Parms SubmitCerberusWelcomeMessage_Parms;
 
@@ -22191,10 +21213,9 @@ void USFXOnlineComponentBlazeLoginPC::SubmitCerberusWelcomeMessage ( )
 
 void USFXOnlineComponentBlazeLoginPC::SubmitCerberusIntro ( int eReturnCode )
 {
-	static UFunction* pFnSubmitCerberusIntro = NULL;
-
+	UFunction* pFnSubmitCerberusIntro = (UFunction*) SdkBindings::Get ( 3406 );
 	if ( ! pFnSubmitCerberusIntro )
-		pFnSubmitCerberusIntro = (UFunction*) UObject::GObjObjects()->Data[ 37316 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execSubmitCerberusIntro_Parms SubmitCerberusIntro_Parms;
 	SubmitCerberusIntro_Parms.eReturnCode = eReturnCode;
@@ -22212,10 +21233,9 @@ void USFXOnlineComponentBlazeLoginPC::SubmitCerberusIntro ( int eReturnCode )
 
 void USFXOnlineComponentBlazeLoginPC::SubmitNucleusWelcomeMessageEx ( )
 {
-	static UFunction* pFnSubmitNucleusWelcomeMessageEx = NULL;
-
+	UFunction* pFnSubmitNucleusWelcomeMessageEx = (UFunction*) SdkBindings::Get ( 3407 );
 	if ( ! pFnSubmitNucleusWelcomeMessageEx )
-		pFnSubmitNucleusWelcomeMessageEx = (UFunction*) UObject::GObjObjects()->Data[ 37318 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execSubmitNucleusWelcomeMessageEx_Parms SubmitNucleusWelcomeMessageEx_Parms;
 
@@ -22232,10 +21252,9 @@ void USFXOnlineComponentBlazeLoginPC::SubmitNucleusWelcomeMessageEx ( )
 
 void USFXOnlineComponentBlazeLoginPC::SubmitNucleusWelcomeMessage ( )
 {
-	static UFunction* pFnSubmitNucleusWelcomeMessage = NULL;
-
+	UFunction* pFnSubmitNucleusWelcomeMessage = (UFunction*) SdkBindings::Get ( 3405 );
 	if ( ! pFnSubmitNucleusWelcomeMessage )
-		pFnSubmitNucleusWelcomeMessage = (UFunction*) UObject::GObjObjects()->Data[ 37315 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execSubmitNucleusWelcomeMessage_Parms SubmitNucleusWelcomeMessage_Parms;
 
@@ -22258,10 +21277,9 @@ void USFXOnlineComponentBlazeLoginPC::SubmitNucleusWelcomeMessage ( )
 
 void USFXOnlineComponentBlazeLoginPC::SubmitCreateNucleusAccount ( struct FString sEmail, struct FString sPassword, unsigned long bEAProducts, unsigned long bThirdParty, unsigned long bBioWareProducts, unsigned long bSubmit )
 {
-	static UFunction* pFnSubmitCreateNucleusAccount = NULL;
-
+	UFunction* pFnSubmitCreateNucleusAccount = (UFunction*) SdkBindings::Get ( 3404 );
 	if ( ! pFnSubmitCreateNucleusAccount )
-		pFnSubmitCreateNucleusAccount = (UFunction*) UObject::GObjObjects()->Data[ 37308 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execSubmitCreateNucleusAccount_Parms SubmitCreateNucleusAccount_Parms;
 	memcpy ( &SubmitCreateNucleusAccount_Parms.sEmail, &sEmail, 0xC );
@@ -22286,10 +21304,9 @@ void USFXOnlineComponentBlazeLoginPC::SubmitCreateNucleusAccount ( struct FStrin
 
 void USFXOnlineComponentBlazeLoginPC::SubmitParentEmail ( unsigned long bContinue, struct FString ParentEmail )
 {
-	static UFunction* pFnSubmitParentEmail = NULL;
-
+	UFunction* pFnSubmitParentEmail = (UFunction*) SdkBindings::Get ( 3403 );
 	if ( ! pFnSubmitParentEmail )
-		pFnSubmitParentEmail = (UFunction*) UObject::GObjObjects()->Data[ 37305 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execSubmitParentEmail_Parms SubmitParentEmail_Parms;
 	SubmitParentEmail_Parms.bContinue = bContinue;
@@ -22311,10 +21328,9 @@ void USFXOnlineComponentBlazeLoginPC::SubmitParentEmail ( unsigned long bContinu
 
 void USFXOnlineComponentBlazeLoginPC::SubmitNucleusLogin ( struct FString email, struct FString Password, unsigned char eReturnCode )
 {
-	static UFunction* pFnSubmitNucleusLogin = NULL;
-
+	UFunction* pFnSubmitNucleusLogin = (UFunction*) SdkBindings::Get ( 3402 );
 	if ( ! pFnSubmitNucleusLogin )
-		pFnSubmitNucleusLogin = (UFunction*) UObject::GObjObjects()->Data[ 37301 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execSubmitNucleusLogin_Parms SubmitNucleusLogin_Parms;
 	memcpy ( &SubmitNucleusLogin_Parms.email, &email, 0xC );
@@ -22336,10 +21352,9 @@ void USFXOnlineComponentBlazeLoginPC::SubmitNucleusLogin ( struct FString email,
 
 void USFXOnlineComponentBlazeLoginPC::SubmitIntroPage ( unsigned long bContinue, unsigned long bSimulated )
 {
-	static UFunction* pFnSubmitIntroPage = NULL;
-
+	UFunction* pFnSubmitIntroPage = (UFunction*) SdkBindings::Get ( 3401 );
 	if ( ! pFnSubmitIntroPage )
-		pFnSubmitIntroPage = (UFunction*) UObject::GObjObjects()->Data[ 37298 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execSubmitIntroPage_Parms SubmitIntroPage_Parms;
 	SubmitIntroPage_Parms.bContinue = bContinue;
@@ -22359,10 +21374,9 @@ void USFXOnlineComponentBlazeLoginPC::SubmitIntroPage ( unsigned long bContinue,
 
 void USFXOnlineComponentBlazeLoginPC::Connect ( unsigned char connectMode )
 {
-	static UFunction* pFnConnect = NULL;
-
+	UFunction* pFnConnect = (UFunction*) SdkBindings::Get ( 3400 );
 	if ( ! pFnConnect )
-		pFnConnect = (UFunction*) UObject::GObjObjects()->Data[ 37296 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execConnect_Parms Connect_Parms;
 	Connect_Parms.connectMode = connectMode;
@@ -22382,10 +21396,9 @@ void USFXOnlineComponentBlazeLoginPC::Connect ( unsigned char connectMode )
 
 void USFXOnlineComponentBlazeLoginPC::AutoLogin ( struct FString sEmail, struct FString sPassword )
 {
-	static UFunction* pFnAutoLogin = NULL;
-
+	UFunction* pFnAutoLogin = (UFunction*) SdkBindings::Get ( 3399 );
 	if ( ! pFnAutoLogin )
-		pFnAutoLogin = (UFunction*) UObject::GObjObjects()->Data[ 37293 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execAutoLogin_Parms AutoLogin_Parms;
 	memcpy ( &AutoLogin_Parms.sEmail, &sEmail, 0xC );
@@ -22405,10 +21418,9 @@ void USFXOnlineComponentBlazeLoginPC::AutoLogin ( struct FString sEmail, struct
 
 void USFXOnlineComponentBlazeLoginPC::AutoLoginWithAccountIndex ( int configAccountIndex )
 {
-	static UFunction* pFnAutoLoginWithAccountIndex = NULL;
-
+	UFunction* pFnAutoLoginWithAccountIndex = (UFunction*) SdkBindings::Get ( 3398 );
 	if ( ! pFnAutoLoginWithAccountIndex )
-		pFnAutoLoginWithAccountIndex = (UFunction*) UObject::GObjObjects()->Data[ 37291 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execAutoLoginWithAccountIndex_Parms AutoLoginWithAccountIndex_Parms;
 	AutoLoginWithAccountIndex_Parms.configAccountIndex = configAccountIndex;
@@ -22427,10 +21439,9 @@ void USFXOnlineComponentBlazeLoginPC::AutoLoginWithAccountIndex ( int configAcco
 
 bool USFXOnlineComponentBlazeLoginPC::CheckAutoLoginFromIni ( )
 {
-	static UFunction* pFnCheckAutoLoginFromIni = NULL;
-
+	UFunction* pFnCheckAutoLoginFromIni = (UFunction*) SdkBindings::Get ( 3397 );
 	if ( ! pFnCheckAutoLoginFromIni )
-		pFnCheckAutoLoginFromIni = (UFunction*) UObject::GObjObjects()->Data[ 37289 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execCheckAutoLoginFromIni_Parms CheckAutoLoginFromIni_Parms;
 
@@ -22449,10 +21460,9 @@ bool USFXOnlineComponentBlazeLoginPC::CheckAutoLoginFromIni ( )
 
 void USFXOnlineComponentBlazeLoginPC::GoBackInUI ( )
 {
-	static UFunction* pFnGoBackInUI = NULL;
-
+	UFunction* pFnGoBackInUI = (UFunction*) SdkBindings::Get ( 3396 );
 	if ( ! pFnGoBackInUI )
-		pFnGoBackInUI = (UFunction*) UObject::GObjObjects()->Data[ 37288 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execGoBackInUI_Parms GoBackInUI_Parms;
 
@@ -22469,10 +21479,9 @@ void USFXOnlineComponentBlazeLoginPC::GoBackInUI ( )
 
 void USFXOnlineComponentBlazeLoginPC::Cancel ( )
 {
-	static UFunction* pFnCancel = NULL;
-
+	UFunction* pFnCancel = (UFunction*) SdkBindings::Get ( 3395 );
 	if ( ! pFnCancel )
-		pFnCancel = (UFunction*) UObject::GObjObjects()->Data[ 37287 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execCancel_Parms Cancel_Parms;
 
@@ -22490,10 +21499,9 @@ void USFXOnlineComponentBlazeLoginPC::Cancel ( )
 
 struct FUniqueNetId USFXOnlineComponentBlazeLoginPC::GetUserId ( )
 {
-	static UFunction* pFnGetUserId = NULL;
-
+	UFunction* pFnGetUserId = (UFunction*) SdkBindings::Get ( 3394 );
 	if ( ! pFnGetUserId )
-		pFnGetUserId = (UFunction*) UObject::GObjObjects()->Data[ 37285 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execGetUserId_Parms GetUserId_Parms;
 
@@ -22513,10 +21521,9 @@ struct FUniqueNetId USFXOnlineComponentBlazeLoginPC::GetUserId ( )
 
 struct FString USFXOnlineComponentBlazeLoginPC::GetPersonaName ( )
 {
-	static UFunction* pFnGetPersonaName = NULL;
-
+	UFunction* pFnGetPersonaName = (UFunction*) SdkBindings::Get ( 3393 );
 	if ( ! pFnGetPersonaName )
-		pFnGetPersonaName = (UFunction*) UObject::GObjObjects()->Data[ 37283 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execGetPersonaName_Parms GetPersonaName_Parms;
 
@@ -22536,10 +21543,9 @@ struct FString USFXOnlineComponentBlazeLoginPC::GetPersonaName ( )
 
 bool USFXOnlineComponentBlazeLoginPC::HasInternetConnection ( )
 {
-	static UFunction* pFnHasInternetConnection = NULL;
-
+	UFunction* pFnHasInternetConnection = (UFunction*) SdkBindings::Get ( 3392 );
 	if ( ! pFnHasInternetConnection )
-		pFnHasInternetConnection = (UFunction*) UObject::GObjObjects()->Data[ 37281 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execHasInternetConnection_Parms HasInternetConnection_Parms;
 
@@ -22559,10 +21565,9 @@ bool USFXOnlineComponentBlazeLoginPC::HasInternetConnection ( )
 
 bool USFXOnlineComponentBlazeLoginPC::IsConnectedTo1stPartyOnlineService ( )
 {
-	static UFunction* pFnIsConnectedTo1stPartyOnlineService = NULL;
-
+	UFunction* pFnIsConnectedTo1stPartyOnlineService = (UFunction*) SdkBindings::Get ( 3391 );
 	if ( ! pFnIsConnectedTo1stPartyOnlineService )
-		pFnIsConnectedTo1stPartyOnlineService = (UFunction*) UObject::GObjObjects()->Data[ 37279 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execIsConnectedTo1stPartyOnlineService_Parms IsConnectedTo1stPartyOnlineService_Parms;
 
@@ -22582,10 +21587,9 @@ bool USFXOnlineComponentBlazeLoginPC::IsConnectedTo1stPartyOnlineService ( )
 
 bool USFXOnlineComponentBlazeLoginPC::IsSignedIn ( )
 {
-	static UFunction* pFnIsSignedIn = NULL;
-
+	UFunction* pFnIsSignedIn = (UFunction*) SdkBindings::Get ( 3390 );
 	if ( ! pFnIsSignedIn )
-		pFnIsSignedIn = (UFunction*) UObject::GObjObjects()->Data[ 37277 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execIsSignedIn_Parms IsSignedIn_Parms;
 
@@ -22605,10 +21609,9 @@ bool USFXOnlineComponentBlazeLoginPC::IsSignedIn ( )
 
 bool USFXOnlineComponentBlazeLoginPC::IsConnected ( )
 {
-	static UFunction* pFnIsConnected = NULL;
-
+	UFunction* pFnIsConnected = (UFunction*) SdkBindings::Get ( 3389 );
 	if ( ! pFnIsConnected )
-		pFnIsConnected = (UFunction*) UObject::GObjObjects()->Data[ 37275 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execIsConnected_Parms IsConnected_Parms;
 
@@ -22629,10 +21632,9 @@ bool USFXOnlineComponentBlazeLoginPC::IsConnected ( )
 
 bool USFXOnlineComponentBlazeLoginPC::IsActiveUser ( struct FUniqueNetId userId )
 {
-	static UFunction* pFnIsActiveUser = NULL;
-
+	UFunction* pFnIsActiveUser = (UFunction*) SdkBindings::Get ( 3388 );
 	if ( ! pFnIsActiveUser )
-		pFnIsActiveUser = (UFunction*) UObject::GObjObjects()->Data[ 37272 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execIsActiveUser_Parms IsActiveUser_Parms;
 	memcpy ( &IsActiveUser_Parms.userId, &userId, 0x8 );
@@ -22653,10 +21655,9 @@ bool USFXOnlineComponentBlazeLoginPC::IsActiveUser ( struct FUniqueNetId userId
 
 void USFXOnlineComponentBlazeLoginPC::SwitchActiveUserIndex ( int nNewIndex )
 {
-	static UFunction* pFnSwitchActiveUserIndex = NULL;
-
+	UFunction* pFnSwitchActiveUserIndex = (UFunction*) SdkBindings::Get ( 3387 );
 	if ( ! pFnSwitchActiveUserIndex )
-		pFnSwitchActiveUserIndex = (UFunction*) UObject::GObjObjects()->Data[ 37270 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execSwitchActiveUserIndex_Parms SwitchActiveUserIndex_Parms;
 	SwitchActiveUserIndex_Parms.nNewIndex = nNewIndex;
@@ -22675,10 +21676,9 @@ void USFXOnlineComponentBlazeLoginPC::SwitchActiveUserIndex ( int nNewIndex )
 
 int USFXOnlineComponentBlazeLoginPC::GetActiveUserIndex ( )
 {
-	static UFunction* pFnGetActiveUserIndex = NULL;
-
+	UFunction* pFnGetActiveUserIndex = (UFunction*) SdkBindings::Get ( 3386 );
 	if ( ! pFnGetActiveUserIndex )
-		pFnGetActiveUserIndex = (UFunction*) UObject::GObjObjects()->Data[ 37268 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execGetActiveUserIndex_Parms GetActiveUserIndex_Parms;
 
@@ -22698,10 +21698,9 @@ int USFXOnlineComponentBlazeLoginPC::GetActiveUserIndex ( )
 
 unsigned char USFXOnlineComponentBlazeLoginPC::GetLoginStatus ( )
 {
-	static UFunction* pFnGetLoginStatus = NULL;
-
+	UFunction* pFnGetLoginStatus = (UFunction*) SdkBindings::Get ( 3385 );
 	if ( ! pFnGetLoginStatus )
-		pFnGetLoginStatus = (UFunction*) UObject::GObjObjects()->Data[ 37266 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execGetLoginStatus_Parms GetLoginStatus_Parms;
 
@@ -22721,10 +21720,9 @@ unsigned char USFXOnlineComponentBlazeLoginPC::GetLoginStatus ( )
 
 struct FName USFXOnlineComponentBlazeLoginPC::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3384 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 37264 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -22743,10 +21741,9 @@ struct FName USFXOnlineComponentBlazeLoginPC::GetAPIName ( )
 
 void USFXOnlineComponentBlazeLoginPC::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3383 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 37263 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execOnRelease_Parms OnRelease_Parms;
 
@@ -22764,10 +21761,9 @@ void USFXOnlineComponentBlazeLoginPC::OnRelease ( )
 
 void USFXOnlineComponentBlazeLoginPC::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3382 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 37261 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -22787,10 +21783,9 @@ void USFXOnlineComponentBlazeLoginPC::OnInitialize ( class USFXOnlineSubsystem*
 
 int USFXOnlineComponentBlazeLoginPC::GetAuthToken ( struct FScriptDelegate funcAuthTokenRetrieved )
 {
-	static UFunction* pFnGetAuthToken = NULL;
-
+	UFunction* pFnGetAuthToken = (UFunction*) SdkBindings::Get ( 3381 );
 	if ( ! pFnGetAuthToken )
-		pFnGetAuthToken = (UFunction*) UObject::GObjObjects()->Data[ 37258 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_execGetAuthToken_Parms GetAuthToken_Parms;
 	memcpy ( &GetAuthToken_Parms.funcAuthTokenRetrieved, &funcAuthTokenRetrieved, 0xC );
@@ -22812,10 +21807,9 @@ int USFXOnlineComponentBlazeLoginPC::GetAuthToken ( struct FScriptDelegate funcA
 
 class USFXOnlineJobGetAuthToken* USFXOnlineComponentBlazeLoginPC::eventCreateJobGetAuthToken ( struct FScriptDelegate funcAuthTokenRetrieved )
 {
-	static UFunction* pFnCreateJobGetAuthToken = NULL;
-
+	UFunction* pFnCreateJobGetAuthToken = (UFunction*) SdkBindings::Get ( 3379 );
 	if ( ! pFnCreateJobGetAuthToken )
-		pFnCreateJobGetAuthToken = (UFunction*) UObject::GObjObjects()->Data[ 37253 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPC_eventCreateJobGetAuthToken_Parms CreateJobGetAuthToken_Parms;
 	memcpy ( &CreateJobGetAuthToken_Parms.funcAuthTokenRetrieved, &funcAuthTokenRetrieved, 0xC );
@@ -22833,10 +21827,9 @@ class USFXOnlineJobGetAuthToken* USFXOnlineComponentBlazeLoginPC::eventCreateJob
 
 void USFXOnlineComponentBlazeLoginPC::eventClearReadFriendsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadFriendsCompleteDelegate )
 {
-	static UFunction* pFnClearReadFriendsCompleteDelegate = NULL;
-
+	UFunction* pFnClearReadFriendsCompleteDelegate = (UFunction*) SdkBindings::Get ( 3378 );
 	if ( ! pFnClearReadFriendsCompleteDelegate )
-		pFnClearReadFriendsCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 37249 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_eventClearReadFriendsCompleteDelegate_Parms ClearReadFriendsCompleteDelegate_Parms;
 	ClearReadFriendsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -22853,10 +21846,9 @@ void USFXOnlineComponentBlazeLoginPC::eventClearReadFriendsCompleteDelegate ( un
 
 void USFXOnlineComponentBlazeLoginPC::eventAddReadFriendsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadFriendsCompleteDelegate )
 {
-	static UFunction* pFnAddReadFriendsCompleteDelegate = NULL;
-
+	UFunction* pFnAddReadFriendsCompleteDelegate = (UFunction*) SdkBindings::Get ( 3375 );
 	if ( ! pFnAddReadFriendsCompleteDelegate )
-		pFnAddReadFriendsCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 37241 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_eventAddReadFriendsCompleteDelegate_Parms AddReadFriendsCompleteDelegate_Parms;
 	AddReadFriendsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -22872,10 +21864,9 @@ void USFXOnlineComponentBlazeLoginPC::eventAddReadFriendsCompleteDelegate ( unsi
 
 void USFXOnlineComponentBlazeLoginPC::OnReadFriendsComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnReadFriendsComplete = NULL;
-
+	UFunction* pFnOnReadFriendsComplete = (UFunction*) SdkBindings::Get ( 3374 );
 	if ( ! pFnOnReadFriendsComplete )
-		pFnOnReadFriendsComplete = (UFunction*) UObject::GObjObjects()->Data[ 37239 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execOnReadFriendsComplete_Parms OnReadFriendsComplete_Parms;
 	OnReadFriendsComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -22890,10 +21881,9 @@ void USFXOnlineComponentBlazeLoginPC::OnReadFriendsComplete ( unsigned long bWas
 
 void USFXOnlineComponentBlazeLoginPC::OnAuthTokenRetrieved ( struct FString token )
 {
-	static UFunction* pFnOnAuthTokenRetrieved = NULL;
-
+	UFunction* pFnOnAuthTokenRetrieved = (UFunction*) SdkBindings::Get ( 3373 );
 	if ( ! pFnOnAuthTokenRetrieved )
-		pFnOnAuthTokenRetrieved = (UFunction*) UObject::GObjObjects()->Data[ 37237 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPC_execOnAuthTokenRetrieved_Parms OnAuthTokenRetrieved_Parms;
 	memcpy ( &OnAuthTokenRetrieved_Parms.token, &token, 0xC );
@@ -22908,10 +21898,9 @@ void USFXOnlineComponentBlazeLoginPC::OnAuthTokenRetrieved ( struct FString toke
 
 void USFXOnlineComponentBlazeLoginPS3::SetExternalDRMDataLoaded ( unsigned long bValue )
 {
-	static UFunction* pFnSetExternalDRMDataLoaded = NULL;
-
+	UFunction* pFnSetExternalDRMDataLoaded = (UFunction*) SdkBindings::Get ( 3451 );
 	if ( ! pFnSetExternalDRMDataLoaded )
-		pFnSetExternalDRMDataLoaded = (UFunction*) UObject::GObjObjects()->Data[ 37424 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execSetExternalDRMDataLoaded_Parms SetExternalDRMDataLoaded_Parms;
 	SetExternalDRMDataLoaded_Parms.bValue = bValue;
@@ -22930,10 +21919,9 @@ void USFXOnlineComponentBlazeLoginPS3::SetExternalDRMDataLoaded ( unsigned long
 
 void USFXOnlineComponentBlazeLoginPS3::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
-
+	UFunction* pFnOnTick = (UFunction*) SdkBindings::Get ( 3452 );
 	if ( ! pFnOnTick )
-		pFnOnTick = (UFunction*) UObject::GObjObjects()->Data[ 37462 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
@@ -22953,10 +21941,9 @@ void USFXOnlineComponentBlazeLoginPS3::OnTick ( class USFXOnlineEvent* oEvent )
 
 void USFXOnlineComponentBlazeLoginPS3::OnOriginAuthKeyAvailableCallback ( unsigned long Success, struct FString authKey )
 {
-	static UFunction* pFnOnOriginAuthKeyAvailableCallback = NULL;
-
+	UFunction* pFnOnOriginAuthKeyAvailableCallback = (UFunction*) SdkBindings::Get ( 3450 );
 	if ( ! pFnOnOriginAuthKeyAvailableCallback )
-		pFnOnOriginAuthKeyAvailableCallback = (UFunction*) UObject::GObjObjects()->Data[ 37420 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execOnOriginAuthKeyAvailableCallback_Parms OnOriginAuthKeyAvailableCallback_Parms;
 	OnOriginAuthKeyAvailableCallback_Parms.Success = Success;
@@ -22976,10 +21963,9 @@ void USFXOnlineComponentBlazeLoginPS3::OnOriginAuthKeyAvailableCallback ( unsign
 
 void USFXOnlineComponentBlazeLoginPS3::OnPromptRedeemCodeResult ( int nResult )
 {
-	static UFunction* pFnOnPromptRedeemCodeResult = NULL;
-
+	UFunction* pFnOnPromptRedeemCodeResult = (UFunction*) SdkBindings::Get ( 3449 );
 	if ( ! pFnOnPromptRedeemCodeResult )
-		pFnOnPromptRedeemCodeResult = (UFunction*) UObject::GObjObjects()->Data[ 37418 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execOnPromptRedeemCodeResult_Parms OnPromptRedeemCodeResult_Parms;
 	OnPromptRedeemCodeResult_Parms.nResult = nResult;
@@ -22998,10 +21984,9 @@ void USFXOnlineComponentBlazeLoginPS3::OnPromptRedeemCodeResult ( int nResult )
 
 void USFXOnlineComponentBlazeLoginPS3::SuspendUserPing ( unsigned long suspend )
 {
-	static UFunction* pFnSuspendUserPing = NULL;
-
+	UFunction* pFnSuspendUserPing = (UFunction*) SdkBindings::Get ( 3448 );
 	if ( ! pFnSuspendUserPing )
-		pFnSuspendUserPing = (UFunction*) UObject::GObjObjects()->Data[ 37416 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execSuspendUserPing_Parms SuspendUserPing_Parms;
 	SuspendUserPing_Parms.suspend = suspend;
@@ -23020,10 +22005,9 @@ void USFXOnlineComponentBlazeLoginPS3::SuspendUserPing ( unsigned long suspend )
 
 bool USFXOnlineComponentBlazeLoginPS3::GetDefaultBiowareEmailAllowed ( )
 {
-	static UFunction* pFnGetDefaultBiowareEmailAllowed = NULL;
-
+	UFunction* pFnGetDefaultBiowareEmailAllowed = (UFunction*) SdkBindings::Get ( 3447 );
 	if ( ! pFnGetDefaultBiowareEmailAllowed )
-		pFnGetDefaultBiowareEmailAllowed = (UFunction*) UObject::GObjObjects()->Data[ 37414 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execGetDefaultBiowareEmailAllowed_Parms GetDefaultBiowareEmailAllowed_Parms;
 
@@ -23043,10 +22027,9 @@ bool USFXOnlineComponentBlazeLoginPS3::GetDefaultBiowareEmailAllowed ( )
 
 unsigned char USFXOnlineComponentBlazeLoginPS3::GetConnectMode ( )
 {
-	static UFunction* pFnGetConnectMode = NULL;
-
+	UFunction* pFnGetConnectMode = (UFunction*) SdkBindings::Get ( 3446 );
 	if ( ! pFnGetConnectMode )
-		pFnGetConnectMode = (UFunction*) UObject::GObjObjects()->Data[ 37412 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execGetConnectMode_Parms GetConnectMode_Parms;
 
@@ -23066,10 +22049,9 @@ unsigned char USFXOnlineComponentBlazeLoginPS3::GetConnectMode ( )
 
 void USFXOnlineComponentBlazeLoginPS3::AddFriendsCompleteCb ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnAddFriendsCompleteCb = NULL;
-
+	UFunction* pFnAddFriendsCompleteCb = (UFunction*) SdkBindings::Get ( 3445 );
 	if ( ! pFnAddFriendsCompleteCb )
-		pFnAddFriendsCompleteCb = (UFunction*) UObject::GObjObjects()->Data[ 37410 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execAddFriendsCompleteCb_Parms AddFriendsCompleteCb_Parms;
 	AddFriendsCompleteCb_Parms.bWasSuccessful = bWasSuccessful;
@@ -23087,10 +22069,9 @@ void USFXOnlineComponentBlazeLoginPS3::AddFriendsCompleteCb ( unsigned long bWas
 
 void USFXOnlineComponentBlazeLoginPS3::PostImportFriendListToBlaze ( )
 {
-	static UFunction* pFnPostImportFriendListToBlaze = NULL;
-
+	UFunction* pFnPostImportFriendListToBlaze = (UFunction*) SdkBindings::Get ( 3444 );
 	if ( ! pFnPostImportFriendListToBlaze )
-		pFnPostImportFriendListToBlaze = (UFunction*) UObject::GObjObjects()->Data[ 37409 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execPostImportFriendListToBlaze_Parms PostImportFriendListToBlaze_Parms;
 
@@ -23109,10 +22090,9 @@ void USFXOnlineComponentBlazeLoginPS3::PostImportFriendListToBlaze ( )
 
 bool USFXOnlineComponentBlazeLoginPS3::ImportFriendListToBlaze ( struct FScriptDelegate funcImportFriendListToBlazeCompleted )
 {
-	static UFunction* pFnImportFriendListToBlaze = NULL;
-
+	UFunction* pFnImportFriendListToBlaze = (UFunction*) SdkBindings::Get ( 3443 );
 	if ( ! pFnImportFriendListToBlaze )
-		pFnImportFriendListToBlaze = (UFunction*) UObject::GObjObjects()->Data[ 37406 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execImportFriendListToBlaze_Parms ImportFriendListToBlaze_Parms;
 	memcpy ( &ImportFriendListToBlaze_Parms.funcImportFriendListToBlazeCompleted, &funcImportFriendListToBlazeCompleted, 0xC );
@@ -23133,10 +22113,9 @@ bool USFXOnlineComponentBlazeLoginPS3::ImportFriendListToBlaze ( struct FScriptD
 
 void USFXOnlineComponentBlazeLoginPS3::OnImportFriendListToBlazeCompleted ( unsigned char errorCode )
 {
-	static UFunction* pFnOnImportFriendListToBlazeCompleted = NULL;
-
+	UFunction* pFnOnImportFriendListToBlazeCompleted = (UFunction*) SdkBindings::Get ( 3442 );
 	if ( ! pFnOnImportFriendListToBlazeCompleted )
-		pFnOnImportFriendListToBlazeCompleted = (UFunction*) UObject::GObjObjects()->Data[ 37404 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execOnImportFriendListToBlazeCompleted_Parms OnImportFriendListToBlazeCompleted_Parms;
 	OnImportFriendListToBlazeCompleted_Parms.errorCode = errorCode;
@@ -23151,10 +22130,9 @@ void USFXOnlineComponentBlazeLoginPS3::OnImportFriendListToBlazeCompleted ( unsi
 
 void USFXOnlineComponentBlazeLoginPS3::RequestImportFriendListToBlaze ( unsigned long callPostImportFriendListToBlaze )
 {
-	static UFunction* pFnRequestImportFriendListToBlaze = NULL;
-
+	UFunction* pFnRequestImportFriendListToBlaze = (UFunction*) SdkBindings::Get ( 3441 );
 	if ( ! pFnRequestImportFriendListToBlaze )
-		pFnRequestImportFriendListToBlaze = (UFunction*) UObject::GObjObjects()->Data[ 37402 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execRequestImportFriendListToBlaze_Parms RequestImportFriendListToBlaze_Parms;
 	RequestImportFriendListToBlaze_Parms.callPostImportFriendListToBlaze = callPostImportFriendListToBlaze;
@@ -23174,10 +22152,9 @@ void USFXOnlineComponentBlazeLoginPS3::RequestImportFriendListToBlaze ( unsigned
 
 class USFXOnlineJobImportFriendListToBlaze* USFXOnlineComponentBlazeLoginPS3::eventCreateJobImportFriendListToBlaze ( unsigned long callPostImportFriendListToBlaze )
 {
-	static UFunction* pFnCreateJobImportFriendListToBlaze = NULL;
-
+	UFunction* pFnCreateJobImportFriendListToBlaze = (UFunction*) SdkBindings::Get ( 3439 );
 	if ( ! pFnCreateJobImportFriendListToBlaze )
-		pFnCreateJobImportFriendListToBlaze = (UFunction*) UObject::GObjObjects()->Data[ 37397 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_eventCreateJobImportFriendListToBlaze_Parms CreateJobImportFriendListToBlaze_Parms;
 	CreateJobImportFriendListToBlaze_Parms.callPostImportFriendListToBlaze = callPostImportFriendListToBlaze;
@@ -23195,10 +22172,9 @@ class USFXOnlineJobImportFriendListToBlaze* USFXOnlineComponentBlazeLoginPS3::ev
 
 unsigned char USFXOnlineComponentBlazeLoginPS3::CanShowPresenceInformation ( int nUserIndex )
 {
-	static UFunction* pFnCanShowPresenceInformation = NULL;
-
+	UFunction* pFnCanShowPresenceInformation = (UFunction*) SdkBindings::Get ( 3438 );
 	if ( ! pFnCanShowPresenceInformation )
-		pFnCanShowPresenceInformation = (UFunction*) UObject::GObjObjects()->Data[ 37394 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execCanShowPresenceInformation_Parms CanShowPresenceInformation_Parms;
 	CanShowPresenceInformation_Parms.nUserIndex = nUserIndex;
@@ -23220,10 +22196,9 @@ unsigned char USFXOnlineComponentBlazeLoginPS3::CanShowPresenceInformation ( int
 
 unsigned char USFXOnlineComponentBlazeLoginPS3::CanViewPlayerProfiles ( int nUserIndex )
 {
-	static UFunction* pFnCanViewPlayerProfiles = NULL;
-
+	UFunction* pFnCanViewPlayerProfiles = (UFunction*) SdkBindings::Get ( 3437 );
 	if ( ! pFnCanViewPlayerProfiles )
-		pFnCanViewPlayerProfiles = (UFunction*) UObject::GObjObjects()->Data[ 37391 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execCanViewPlayerProfiles_Parms CanViewPlayerProfiles_Parms;
 	CanViewPlayerProfiles_Parms.nUserIndex = nUserIndex;
@@ -23245,10 +22220,9 @@ unsigned char USFXOnlineComponentBlazeLoginPS3::CanViewPlayerProfiles ( int nUse
 
 unsigned char USFXOnlineComponentBlazeLoginPS3::CanPurchaseContent ( int nUserIndex )
 {
-	static UFunction* pFnCanPurchaseContent = NULL;
-
+	UFunction* pFnCanPurchaseContent = (UFunction*) SdkBindings::Get ( 3436 );
 	if ( ! pFnCanPurchaseContent )
-		pFnCanPurchaseContent = (UFunction*) UObject::GObjObjects()->Data[ 37388 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execCanPurchaseContent_Parms CanPurchaseContent_Parms;
 	CanPurchaseContent_Parms.nUserIndex = nUserIndex;
@@ -23270,10 +22244,9 @@ unsigned char USFXOnlineComponentBlazeLoginPS3::CanPurchaseContent ( int nUserIn
 
 unsigned char USFXOnlineComponentBlazeLoginPS3::CanDownloadUserContent ( int nUserIndex )
 {
-	static UFunction* pFnCanDownloadUserContent = NULL;
-
+	UFunction* pFnCanDownloadUserContent = (UFunction*) SdkBindings::Get ( 3435 );
 	if ( ! pFnCanDownloadUserContent )
-		pFnCanDownloadUserContent = (UFunction*) UObject::GObjObjects()->Data[ 37385 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execCanDownloadUserContent_Parms CanDownloadUserContent_Parms;
 	CanDownloadUserContent_Parms.nUserIndex = nUserIndex;
@@ -23295,10 +22268,9 @@ unsigned char USFXOnlineComponentBlazeLoginPS3::CanDownloadUserContent ( int nUs
 
 unsigned char USFXOnlineComponentBlazeLoginPS3::CanCommunicate ( int nUserIndex )
 {
-	static UFunction* pFnCanCommunicate = NULL;
-
+	UFunction* pFnCanCommunicate = (UFunction*) SdkBindings::Get ( 3434 );
 	if ( ! pFnCanCommunicate )
-		pFnCanCommunicate = (UFunction*) UObject::GObjObjects()->Data[ 37382 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execCanCommunicate_Parms CanCommunicate_Parms;
 	CanCommunicate_Parms.nUserIndex = nUserIndex;
@@ -23320,10 +22292,9 @@ unsigned char USFXOnlineComponentBlazeLoginPS3::CanCommunicate ( int nUserIndex
 
 unsigned char USFXOnlineComponentBlazeLoginPS3::CanPlayOnline ( int nUserIndex )
 {
-	static UFunction* pFnCanPlayOnline = NULL;
-
+	UFunction* pFnCanPlayOnline = (UFunction*) SdkBindings::Get ( 3433 );
 	if ( ! pFnCanPlayOnline )
-		pFnCanPlayOnline = (UFunction*) UObject::GObjObjects()->Data[ 37379 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execCanPlayOnline_Parms CanPlayOnline_Parms;
 	CanPlayOnline_Parms.nUserIndex = nUserIndex;
@@ -23343,10 +22314,9 @@ unsigned char USFXOnlineComponentBlazeLoginPS3::CanPlayOnline ( int nUserIndex )
 
 void USFXOnlineComponentBlazeLoginPS3::OnDownloadOffersUICompleted ( )
 {
-	static UFunction* pFnOnDownloadOffersUICompleted = NULL;
-
+	UFunction* pFnOnDownloadOffersUICompleted = (UFunction*) SdkBindings::Get ( 3432 );
 	if ( ! pFnOnDownloadOffersUICompleted )
-		pFnOnDownloadOffersUICompleted = (UFunction*) UObject::GObjObjects()->Data[ 37378 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execOnDownloadOffersUICompleted_Parms OnDownloadOffersUICompleted_Parms;
 
@@ -23363,10 +22333,9 @@ void USFXOnlineComponentBlazeLoginPS3::OnDownloadOffersUICompleted ( )
 
 void USFXOnlineComponentBlazeLoginPS3::OnDLCInfoLoaded ( )
 {
-	static UFunction* pFnOnDLCInfoLoaded = NULL;
-
+	UFunction* pFnOnDLCInfoLoaded = (UFunction*) SdkBindings::Get ( 3431 );
 	if ( ! pFnOnDLCInfoLoaded )
-		pFnOnDLCInfoLoaded = (UFunction*) UObject::GObjObjects()->Data[ 37377 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execOnDLCInfoLoaded_Parms OnDLCInfoLoaded_Parms;
 
@@ -23383,10 +22352,9 @@ void USFXOnlineComponentBlazeLoginPS3::OnDLCInfoLoaded ( )
 
 void USFXOnlineComponentBlazeLoginPS3::OpenCerberusUI ( )
 {
-	static UFunction* pFnOpenCerberusUI = NULL;
-
+	UFunction* pFnOpenCerberusUI = (UFunction*) SdkBindings::Get ( 3430 );
 	if ( ! pFnOpenCerberusUI )
-		pFnOpenCerberusUI = (UFunction*) UObject::GObjObjects()->Data[ 37376 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execOpenCerberusUI_Parms OpenCerberusUI_Parms;
 
@@ -23404,10 +22372,9 @@ void USFXOnlineComponentBlazeLoginPS3::OpenCerberusUI ( )
 
 void USFXOnlineComponentBlazeLoginPS3::EnterCDKey ( struct FString sKey )
 {
-	static UFunction* pFnEnterCDKey = NULL;
-
+	UFunction* pFnEnterCDKey = (UFunction*) SdkBindings::Get ( 3429 );
 	if ( ! pFnEnterCDKey )
-		pFnEnterCDKey = (UFunction*) UObject::GObjObjects()->Data[ 37374 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execEnterCDKey_Parms EnterCDKey_Parms;
 	memcpy ( &EnterCDKey_Parms.sKey, &sKey, 0xC );
@@ -23426,10 +22393,9 @@ void USFXOnlineComponentBlazeLoginPS3::EnterCDKey ( struct FString sKey )
 
 void USFXOnlineComponentBlazeLoginPS3::Buy ( unsigned char nPurchaseSource )
 {
-	static UFunction* pFnBuy = NULL;
-
+	UFunction* pFnBuy = (UFunction*) SdkBindings::Get ( 3428 );
 	if ( ! pFnBuy )
-		pFnBuy = (UFunction*) UObject::GObjObjects()->Data[ 37372 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execBuy_Parms Buy_Parms;
 	Buy_Parms.nPurchaseSource = nPurchaseSource;
@@ -23448,10 +22414,9 @@ void USFXOnlineComponentBlazeLoginPS3::Buy ( unsigned char nPurchaseSource )
 
 void USFXOnlineComponentBlazeLoginPS3::CompleteBuildEntitlementListUponRedeption ( int nResult )
 {
-	static UFunction* pFnCompleteBuildEntitlementListUponRedeption = NULL;
-
+	UFunction* pFnCompleteBuildEntitlementListUponRedeption = (UFunction*) SdkBindings::Get ( 3427 );
 	if ( ! pFnCompleteBuildEntitlementListUponRedeption )
-		pFnCompleteBuildEntitlementListUponRedeption = (UFunction*) UObject::GObjObjects()->Data[ 37370 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execCompleteBuildEntitlementListUponRedeption_Parms CompleteBuildEntitlementListUponRedeption_Parms;
 	CompleteBuildEntitlementListUponRedeption_Parms.nResult = nResult;
@@ -23470,10 +22435,9 @@ void USFXOnlineComponentBlazeLoginPS3::CompleteBuildEntitlementListUponRedeption
 
 void USFXOnlineComponentBlazeLoginPS3::CompleteBuildEntitlementListUponLogin ( int nResult )
 {
-	static UFunction* pFnCompleteBuildEntitlementListUponLogin = NULL;
-
+	UFunction* pFnCompleteBuildEntitlementListUponLogin = (UFunction*) SdkBindings::Get ( 3426 );
 	if ( ! pFnCompleteBuildEntitlementListUponLogin )
-		pFnCompleteBuildEntitlementListUponLogin = (UFunction*) UObject::GObjObjects()->Data[ 37368 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execCompleteBuildEntitlementListUponLogin_Parms CompleteBuildEntitlementListUponLogin_Parms;
 	CompleteBuildEntitlementListUponLogin_Parms.nResult = nResult;
@@ -23494,10 +22458,9 @@ void USFXOnlineComponentBlazeLoginPS3::CompleteBuildEntitlementListUponLogin ( i
 
 bool USFXOnlineComponentBlazeLoginPS3::BuildEntitlementList ( unsigned long bFirstCallUponLogin, int nPage )
 {
-	static UFunction* pFnBuildEntitlementList = NULL;
-
+	UFunction* pFnBuildEntitlementList = (UFunction*) SdkBindings::Get ( 3425 );
 	if ( ! pFnBuildEntitlementList )
-		pFnBuildEntitlementList = (UFunction*) UObject::GObjObjects()->Data[ 37364 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execBuildEntitlementList_Parms BuildEntitlementList_Parms;
 	BuildEntitlementList_Parms.bFirstCallUponLogin = bFirstCallUponLogin;
@@ -23519,10 +22482,9 @@ bool USFXOnlineComponentBlazeLoginPS3::BuildEntitlementList ( unsigned long bFir
 
 bool USFXOnlineComponentBlazeLoginPS3::IsCerberusMember ( )
 {
-	static UFunction* pFnIsCerberusMember = NULL;
-
+	UFunction* pFnIsCerberusMember = (UFunction*) SdkBindings::Get ( 3424 );
 	if ( ! pFnIsCerberusMember )
-		pFnIsCerberusMember = (UFunction*) UObject::GObjObjects()->Data[ 37362 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execIsCerberusMember_Parms IsCerberusMember_Parms;
 
@@ -23542,10 +22504,9 @@ bool USFXOnlineComponentBlazeLoginPS3::IsCerberusMember ( )
 
 void USFXOnlineComponentBlazeLoginPS3::DisablePersona ( struct FString sPersonaNonGrata )
 {
-	static UFunction* pFnDisablePersona = NULL;
-
+	UFunction* pFnDisablePersona = (UFunction*) SdkBindings::Get ( 3423 );
 	if ( ! pFnDisablePersona )
-		pFnDisablePersona = (UFunction*) UObject::GObjObjects()->Data[ 37360 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execDisablePersona_Parms DisablePersona_Parms;
 	memcpy ( &DisablePersona_Parms.sPersonaNonGrata, &sPersonaNonGrata, 0xC );
@@ -23564,10 +22525,9 @@ void USFXOnlineComponentBlazeLoginPS3::DisablePersona ( struct FString sPersonaN
 
 void USFXOnlineComponentBlazeLoginPS3::CreatePersona ( struct FString sPersonaName )
 {
-	static UFunction* pFnCreatePersona = NULL;
-
+	UFunction* pFnCreatePersona = (UFunction*) SdkBindings::Get ( 3422 );
 	if ( ! pFnCreatePersona )
-		pFnCreatePersona = (UFunction*) UObject::GObjObjects()->Data[ 37358 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execCreatePersona_Parms CreatePersona_Parms;
 	memcpy ( &CreatePersona_Parms.sPersonaName, &sPersonaName, 0xC );
@@ -23586,10 +22546,9 @@ void USFXOnlineComponentBlazeLoginPS3::CreatePersona ( struct FString sPersonaNa
 
 void USFXOnlineComponentBlazeLoginPS3::SelectPersona ( struct FString sPersonaName )
 {
-	static UFunction* pFnSelectPersona = NULL;
-
+	UFunction* pFnSelectPersona = (UFunction*) SdkBindings::Get ( 3421 );
 	if ( ! pFnSelectPersona )
-		pFnSelectPersona = (UFunction*) UObject::GObjObjects()->Data[ 37356 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execSelectPersona_Parms SelectPersona_Parms;
 	memcpy ( &SelectPersona_Parms.sPersonaName, &sPersonaName, 0xC );
@@ -23608,10 +22567,9 @@ void USFXOnlineComponentBlazeLoginPS3::SelectPersona ( struct FString sPersonaNa
 
 void USFXOnlineComponentBlazeLoginPS3::AcceptTOS ( unsigned long bAccepted )
 {
-	static UFunction* pFnAcceptTOS = NULL;
-
+	UFunction* pFnAcceptTOS = (UFunction*) SdkBindings::Get ( 3420 );
 	if ( ! pFnAcceptTOS )
-		pFnAcceptTOS = (UFunction*) UObject::GObjObjects()->Data[ 37354 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execAcceptTOS_Parms AcceptTOS_Parms;
 	AcceptTOS_Parms.bAccepted = bAccepted;
@@ -23630,10 +22588,9 @@ void USFXOnlineComponentBlazeLoginPS3::AcceptTOS ( unsigned long bAccepted )
 
 void USFXOnlineComponentBlazeLoginPS3::Disconnect ( unsigned long bShowError )
 {
-	static UFunction* pFnDisconnect = NULL;
-
+	UFunction* pFnDisconnect = (UFunction*) SdkBindings::Get ( 3419 );
 	if ( ! pFnDisconnect )
-		pFnDisconnect = (UFunction*) UObject::GObjObjects()->Data[ 37352 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execDisconnect_Parms Disconnect_Parms;
 	Disconnect_Parms.bShowError = bShowError;
@@ -23652,10 +22609,9 @@ void USFXOnlineComponentBlazeLoginPS3::Disconnect ( unsigned long bShowError )
 
 void USFXOnlineComponentBlazeLoginPS3::On1stPartyServiceLoginResult ( unsigned long loggedIn )
 {
-	static UFunction* pFnOn1stPartyServiceLoginResult = NULL;
-
+	UFunction* pFnOn1stPartyServiceLoginResult = (UFunction*) SdkBindings::Get ( 3418 );
 	if ( ! pFnOn1stPartyServiceLoginResult )
-		pFnOn1stPartyServiceLoginResult = (UFunction*) UObject::GObjObjects()->Data[ 37350 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execOn1stPartyServiceLoginResult_Parms On1stPartyServiceLoginResult_Parms;
 	On1stPartyServiceLoginResult_Parms.loggedIn = loggedIn;
@@ -23674,10 +22630,9 @@ void USFXOnlineComponentBlazeLoginPS3::On1stPartyServiceLoginResult ( unsigned l
 
 bool USFXOnlineComponentBlazeLoginPS3::eventShow1stPartyServiceLogin ( )
 {
-	static UFunction* pFnShow1stPartyServiceLogin = NULL;
-
+	UFunction* pFnShow1stPartyServiceLogin = (UFunction*) SdkBindings::Get ( 3417 );
 	if ( ! pFnShow1stPartyServiceLogin )
-		pFnShow1stPartyServiceLogin = (UFunction*) UObject::GObjObjects()->Data[ 37348 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_eventShow1stPartyServiceLogin_Parms Show1stPartyServiceLogin_Parms;
 
@@ -23693,10 +22648,9 @@ bool USFXOnlineComponentBlazeLoginPS3::eventShow1stPartyServiceLogin ( )
 
 bool USFXOnlineComponentBlazeLoginPS3::Show1stPartyServiceLoginImp ( )
 {
-	static UFunction* pFnShow1stPartyServiceLoginImp = NULL;
-
+	UFunction* pFnShow1stPartyServiceLoginImp = (UFunction*) SdkBindings::Get ( 3416 );
 	if ( ! pFnShow1stPartyServiceLoginImp )
-		pFnShow1stPartyServiceLoginImp = (UFunction*) UObject::GObjObjects()->Data[ 37346 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execShow1stPartyServiceLoginImp_Parms Show1stPartyServiceLoginImp_Parms;
 
@@ -23711,10 +22665,9 @@ bool USFXOnlineComponentBlazeLoginPS3::Show1stPartyServiceLoginImp ( )
 
 void USFXOnlineComponentBlazeLoginPS3::CompleteLoginProcess ( )
 {
-	static UFunction* pFnCompleteLoginProcess = NULL;
-
+	UFunction* pFnCompleteLoginProcess = (UFunction*) SdkBindings::Get ( 3415 );
 	if ( ! pFnCompleteLoginProcess )
-		pFnCompleteLoginProcess = (UFunction*) UObject::GObjObjects()->Data[ 37345 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execCompleteLoginProcess_Parms CompleteLoginProcess_Parms;
 
@@ -23731,10 +22684,9 @@ void USFXOnlineComponentBlazeLoginPS3::CompleteLoginProcess ( )
 
 void USFXOnlineComponentBlazeLoginPS3::StartCerberusLogin ( )
 {
-	static UFunction* pFnStartCerberusLogin = NULL;
-
+	UFunction* pFnStartCerberusLogin = (UFunction*) SdkBindings::Get ( 3414 );
 	if ( ! pFnStartCerberusLogin )
-		pFnStartCerberusLogin = (UFunction*) UObject::GObjObjects()->Data[ 37344 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execStartCerberusLogin_Parms StartCerberusLogin_Parms;
 
@@ -23752,10 +22704,9 @@ void USFXOnlineComponentBlazeLoginPS3::StartCerberusLogin ( )
 
 void USFXOnlineComponentBlazeLoginPS3::SubmitStore ( TArray< int > aiChosen )
 {
-	static UFunction* pFnSubmitStore = NULL;
-
+	UFunction* pFnSubmitStore = (UFunction*) SdkBindings::Get ( 3413 );
 	if ( ! pFnSubmitStore )
-		pFnSubmitStore = (UFunction*) UObject::GObjObjects()->Data[ 37341 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execSubmitStore_Parms SubmitStore_Parms;
 	memcpy ( &SubmitStore_Parms.aiChosen, &aiChosen, 0xC );
@@ -23784,10 +22735,9 @@ void USFXOnlineComponentBlazeLoginPS3::SubmitStore ( TArray< int > aiChosen )
 
 void USFXOnlineComponentBlazeLoginPS3::SubmitCreateNucleusAccountEx ( struct FString sEmail, struct FString sPassword, unsigned long bEAProducts, unsigned long bThirdParty, unsigned long bBioWareProducts, struct FString i_sCountryCode, int BirthDay, int BirthMonth, int BirthYear, struct FString i_sLanguageCode, unsigned long bSubmit )
 {
-	static UFunction* pFnSubmitCreateNucleusAccountEx = NULL;
-
+	UFunction* pFnSubmitCreateNucleusAccountEx = (UFunction*) SdkBindings::Get ( 3412 );
 	if ( ! pFnSubmitCreateNucleusAccountEx )
-		pFnSubmitCreateNucleusAccountEx = (UFunction*) UObject::GObjObjects()->Data[ 37329 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execSubmitCreateNucleusAccountEx_Parms SubmitCreateNucleusAccountEx_Parms;
 	memcpy ( &SubmitCreateNucleusAccountEx_Parms.sEmail, &sEmail, 0xC );
@@ -23818,10 +22768,9 @@ void USFXOnlineComponentBlazeLoginPS3::SubmitCreateNucleusAccountEx ( struct FSt
 
 void USFXOnlineComponentBlazeLoginPS3::SubmitEmailPasswordMismatch ( struct FString email, struct FString Password, int eReturnCode )
 {
-	static UFunction* pFnSubmitEmailPasswordMismatch = NULL;
-
+	UFunction* pFnSubmitEmailPasswordMismatch = (UFunction*) SdkBindings::Get ( 3411 );
 	if ( ! pFnSubmitEmailPasswordMismatch )
-		pFnSubmitEmailPasswordMismatch = (UFunction*) UObject::GObjObjects()->Data[ 37325 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execSubmitEmailPasswordMismatch_Parms SubmitEmailPasswordMismatch_Parms;
 	memcpy ( &SubmitEmailPasswordMismatch_Parms.email, &email, 0xC );
@@ -23842,10 +22791,9 @@ void USFXOnlineComponentBlazeLoginPS3::SubmitEmailPasswordMismatch ( struct FStr
 
 void USFXOnlineComponentBlazeLoginPS3::SubmitMessageBox ( int eReturnCode )
 {
-	static UFunction* pFnSubmitMessageBox = NULL;
-
+	UFunction* pFnSubmitMessageBox = (UFunction*) SdkBindings::Get ( 3410 );
 	if ( ! pFnSubmitMessageBox )
-		pFnSubmitMessageBox = (UFunction*) UObject::GObjObjects()->Data[ 37323 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execSubmitMessageBox_Parms SubmitMessageBox_Parms;
 	SubmitMessageBox_Parms.eReturnCode = eReturnCode;
@@ -23865,10 +22813,9 @@ void USFXOnlineComponentBlazeLoginPS3::SubmitMessageBox ( int eReturnCode )
 
 void USFXOnlineComponentBlazeLoginPS3::SubmitRedeemCode ( unsigned long bContinue, struct FString i_sCode )
 {
-	static UFunction* pFnSubmitRedeemCode = NULL;
-
+	UFunction* pFnSubmitRedeemCode = (UFunction*) SdkBindings::Get ( 3409 );
 	if ( ! pFnSubmitRedeemCode )
-		pFnSubmitRedeemCode = (UFunction*) UObject::GObjObjects()->Data[ 37320 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execSubmitRedeemCode_Parms SubmitRedeemCode_Parms;
 	SubmitRedeemCode_Parms.bContinue = bContinue;
@@ -23887,10 +22834,9 @@ void USFXOnlineComponentBlazeLoginPS3::SubmitRedeemCode ( unsigned long bContinu
 
 void USFXOnlineComponentBlazeLoginPS3::SubmitCerberusWelcomeMessage ( )
 {
-	static UFunction* pFnSubmitCerberusWelcomeMessage = NULL;
-
+	UFunction* pFnSubmitCerberusWelcomeMessage = (UFunction*) SdkBindings::Get ( 3408 );
 	if ( ! pFnSubmitCerberusWelcomeMessage )
-		pFnSubmitCerberusWelcomeMessage = (UFunction*) UObject::GObjObjects()->Data[ 37319 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execSubmitCerberusWelcomeMessage_Parms SubmitCerberusWelcomeMessage_Parms;
 
@@ -23908,10 +22854,9 @@ void USFXOnlineComponentBlazeLoginPS3::SubmitCerberusWelcomeMessage ( )
 
 void USFXOnlineComponentBlazeLoginPS3::SubmitCerberusIntro ( int eReturnCode )
 {
-	static UFunction* pFnSubmitCerberusIntro = NULL;
-
+	UFunction* pFnSubmitCerberusIntro = (UFunction*) SdkBindings::Get ( 3406 );
 	if ( ! pFnSubmitCerberusIntro )
-		pFnSubmitCerberusIntro = (UFunction*) UObject::GObjObjects()->Data[ 37316 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execSubmitCerberusIntro_Parms SubmitCerberusIntro_Parms;
 	SubmitCerberusIntro_Parms.eReturnCode = eReturnCode;
@@ -23929,10 +22874,9 @@ void USFXOnlineComponentBlazeLoginPS3::SubmitCerberusIntro ( int eReturnCode )
 
 void USFXOnlineComponentBlazeLoginPS3::SubmitNucleusWelcomeMessageEx ( )
 {
-	static UFunction* pFnSubmitNucleusWelcomeMessageEx = NULL;
-
+	UFunction* pFnSubmitNucleusWelcomeMessageEx = (UFunction*) SdkBindings::Get ( 3407 );
 	if ( ! pFnSubmitNucleusWelcomeMessageEx )
-		pFnSubmitNucleusWelcomeMessageEx = (UFunction*) UObject::GObjObjects()->Data[ 37318 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execSubmitNucleusWelcomeMessageEx_Parms SubmitNucleusWelcomeMessageEx_Parms;
 
@@ -23949,10 +22893,9 @@ void USFXOnlineComponentBlazeLoginPS3::SubmitNucleusWelcomeMessageEx ( )
 
 void USFXOnlineComponentBlazeLoginPS3::SubmitNucleusWelcomeMessage ( )
 {
-	static UFunction* pFnSubmitNucleusWelcomeMessage = NULL;
-
+	UFunction* pFnSubmitNucleusWelcomeMessage = (UFunction*) SdkBindings::Get ( 3405 );
 	if ( ! pFnSubmitNucleusWelcomeMessage )
-		pFnSubmitNucleusWelcomeMessage = (UFunction*) UObject::GObjObjects()->Data[ 37315 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execSubmitNucleusWelcomeMessage_Parms SubmitNucleusWelcomeMessage_Parms;
 
@@ -23975,10 +22918,9 @@ void USFXOnlineComponentBlazeLoginPS3::SubmitNucleusWelcomeMessage ( )
 
 void USFXOnlineComponentBlazeLoginPS3::SubmitCreateNucleusAccount ( struct FString sEmail, struct FString sPassword, unsigned long bEAProducts, unsigned long bThirdParty, unsigned long bBioWareProducts, unsigned long bSubmit )
 {
-	static UFunction* pFnSubmitCreateNucleusAccount = NULL;
-
+	UFunction* pFnSubmitCreateNucleusAccount = (UFunction*) SdkBindings::Get ( 3404 );
 	if ( ! pFnSubmitCreateNucleusAccount )
-		pFnSubmitCreateNucleusAccount = (UFunction*) UObject::GObjObjects()->Data[ 37308 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execSubmitCreateNucleusAccount_Parms SubmitCreateNucleusAccount_Parms;
 	memcpy ( &SubmitCreateNucleusAccount_Parms.sEmail, &sEmail, 0xC );
@@ -24003,10 +22945,9 @@ void USFXOnlineComponentBlazeLoginPS3::SubmitCreateNucleusAccount ( struct FStri
 
 void USFXOnlineComponentBlazeLoginPS3::SubmitParentEmail ( unsigned long bContinue, struct FString ParentEmail )
 {
-	static UFunction* pFnSubmitParentEmail = NULL;
-
+	UFunction* pFnSubmitParentEmail = (UFunction*) SdkBindings::Get ( 3403 );
 	if ( ! pFnSubmitParentEmail )
-		pFnSubmitParentEmail = (UFunction*) UObject::GObjObjects()->Data[ 37305 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execSubmitParentEmail_Parms SubmitParentEmail_Parms;
 	SubmitParentEmail_Parms.bContinue = bContinue;
@@ -24028,10 +22969,9 @@ void USFXOnlineComponentBlazeLoginPS3::SubmitParentEmail ( unsigned long bContin
 
 void USFXOnlineComponentBlazeLoginPS3::SubmitNucleusLogin ( struct FString email, struct FString Password, unsigned char eReturnCode )
 {
-	static UFunction* pFnSubmitNucleusLogin = NULL;
-
+	UFunction* pFnSubmitNucleusLogin = (UFunction*) SdkBindings::Get ( 3402 );
 	if ( ! pFnSubmitNucleusLogin )
-		pFnSubmitNucleusLogin = (UFunction*) UObject::GObjObjects()->Data[ 37301 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execSubmitNucleusLogin_Parms SubmitNucleusLogin_Parms;
 	memcpy ( &SubmitNucleusLogin_Parms.email, &email, 0xC );
@@ -24053,10 +22993,9 @@ void USFXOnlineComponentBlazeLoginPS3::SubmitNucleusLogin ( struct FString email
 
 void USFXOnlineComponentBlazeLoginPS3::SubmitIntroPage ( unsigned long bContinue, unsigned long bSimulated )
 {
-	static UFunction* pFnSubmitIntroPage = NULL;
-
+	UFunction* pFnSubmitIntroPage = (UFunction*) SdkBindings::Get ( 3401 );
 	if ( ! pFnSubmitIntroPage )
-		pFnSubmitIntroPage = (UFunction*) UObject::GObjObjects()->Data[ 37298 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execSubmitIntroPage_Parms SubmitIntroPage_Parms;
 	SubmitIntroPage_Parms.bContinue = bContinue;
@@ -24076,10 +23015,9 @@ void USFXOnlineComponentBlazeLoginPS3::SubmitIntroPage ( unsigned long bContinue
 
 void USFXOnlineComponentBlazeLoginPS3::Connect ( unsigned char connectMode )
 {
-	static UFunction* pFnConnect = NULL;
-
+	UFunction* pFnConnect = (UFunction*) SdkBindings::Get ( 3400 );
 	if ( ! pFnConnect )
-		pFnConnect = (UFunction*) UObject::GObjObjects()->Data[ 37296 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execConnect_Parms Connect_Parms;
 	Connect_Parms.connectMode = connectMode;
@@ -24099,10 +23037,9 @@ void USFXOnlineComponentBlazeLoginPS3::Connect ( unsigned char connectMode )
 
 void USFXOnlineComponentBlazeLoginPS3::AutoLogin ( struct FString sEmail, struct FString sPassword )
 {
-	static UFunction* pFnAutoLogin = NULL;
-
+	UFunction* pFnAutoLogin = (UFunction*) SdkBindings::Get ( 3399 );
 	if ( ! pFnAutoLogin )
-		pFnAutoLogin = (UFunction*) UObject::GObjObjects()->Data[ 37293 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execAutoLogin_Parms AutoLogin_Parms;
 	memcpy ( &AutoLogin_Parms.sEmail, &sEmail, 0xC );
@@ -24122,10 +23059,9 @@ void USFXOnlineComponentBlazeLoginPS3::AutoLogin ( struct FString sEmail, struct
 
 void USFXOnlineComponentBlazeLoginPS3::AutoLoginWithAccountIndex ( int configAccountIndex )
 {
-	static UFunction* pFnAutoLoginWithAccountIndex = NULL;
-
+	UFunction* pFnAutoLoginWithAccountIndex = (UFunction*) SdkBindings::Get ( 3398 );
 	if ( ! pFnAutoLoginWithAccountIndex )
-		pFnAutoLoginWithAccountIndex = (UFunction*) UObject::GObjObjects()->Data[ 37291 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execAutoLoginWithAccountIndex_Parms AutoLoginWithAccountIndex_Parms;
 	AutoLoginWithAccountIndex_Parms.configAccountIndex = configAccountIndex;
@@ -24144,10 +23080,9 @@ void USFXOnlineComponentBlazeLoginPS3::AutoLoginWithAccountIndex ( int configAcc
 
 bool USFXOnlineComponentBlazeLoginPS3::CheckAutoLoginFromIni ( )
 {
-	static UFunction* pFnCheckAutoLoginFromIni = NULL;
-
+	UFunction* pFnCheckAutoLoginFromIni = (UFunction*) SdkBindings::Get ( 3397 );
 	if ( ! pFnCheckAutoLoginFromIni )
-		pFnCheckAutoLoginFromIni = (UFunction*) UObject::GObjObjects()->Data[ 37289 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execCheckAutoLoginFromIni_Parms CheckAutoLoginFromIni_Parms;
 
@@ -24166,10 +23101,9 @@ bool USFXOnlineComponentBlazeLoginPS3::CheckAutoLoginFromIni ( )
 
 void USFXOnlineComponentBlazeLoginPS3::GoBackInUI ( )
 {
-	static UFunction* pFnGoBackInUI = NULL;
-
+	UFunction* pFnGoBackInUI = (UFunction*) SdkBindings::Get ( 3396 );
 	if ( ! pFnGoBackInUI )
-		pFnGoBackInUI = (UFunction*) UObject::GObjObjects()->Data[ 37288 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execGoBackInUI_Parms GoBackInUI_Parms;
 
@@ -24186,10 +23120,9 @@ void USFXOnlineComponentBlazeLoginPS3::GoBackInUI ( )
 
 void USFXOnlineComponentBlazeLoginPS3::Cancel ( )
 {
-	static UFunction* pFnCancel = NULL;
-
+	UFunction* pFnCancel = (UFunction*) SdkBindings::Get ( 3395 );
 	if ( ! pFnCancel )
-		pFnCancel = (UFunction*) UObject::GObjObjects()->Data[ 37287 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execCancel_Parms Cancel_Parms;
 
@@ -24207,10 +23140,9 @@ void USFXOnlineComponentBlazeLoginPS3::Cancel ( )
 
 struct FUniqueNetId USFXOnlineComponentBlazeLoginPS3::GetUserId ( )
 {
-	static UFunction* pFnGetUserId = NULL;
-
+	UFunction* pFnGetUserId = (UFunction*) SdkBindings::Get ( 3394 );
 	if ( ! pFnGetUserId )
-		pFnGetUserId = (UFunction*) UObject::GObjObjects()->Data[ 37285 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execGetUserId_Parms GetUserId_Parms;
 
@@ -24230,10 +23162,9 @@ struct FUniqueNetId USFXOnlineComponentBlazeLoginPS3::GetUserId ( )
 
 struct FString USFXOnlineComponentBlazeLoginPS3::GetPersonaName ( )
 {
-	static UFunction* pFnGetPersonaName = NULL;
-
+	UFunction* pFnGetPersonaName = (UFunction*) SdkBindings::Get ( 3393 );
 	if ( ! pFnGetPersonaName )
-		pFnGetPersonaName = (UFunction*) UObject::GObjObjects()->Data[ 37283 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execGetPersonaName_Parms GetPersonaName_Parms;
 
@@ -24253,10 +23184,9 @@ struct FString USFXOnlineComponentBlazeLoginPS3::GetPersonaName ( )
 
 bool USFXOnlineComponentBlazeLoginPS3::HasInternetConnection ( )
 {
-	static UFunction* pFnHasInternetConnection = NULL;
-
+	UFunction* pFnHasInternetConnection = (UFunction*) SdkBindings::Get ( 3392 );
 	if ( ! pFnHasInternetConnection )
-		pFnHasInternetConnection = (UFunction*) UObject::GObjObjects()->Data[ 37281 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execHasInternetConnection_Parms HasInternetConnection_Parms;
 
@@ -24276,10 +23206,9 @@ bool USFXOnlineComponentBlazeLoginPS3::HasInternetConnection ( )
 
 bool USFXOnlineComponentBlazeLoginPS3::IsConnectedTo1stPartyOnlineService ( )
 {
-	static UFunction* pFnIsConnectedTo1stPartyOnlineService = NULL;
-
+	UFunction* pFnIsConnectedTo1stPartyOnlineService = (UFunction*) SdkBindings::Get ( 3391 );
 	if ( ! pFnIsConnectedTo1stPartyOnlineService )
-		pFnIsConnectedTo1stPartyOnlineService = (UFunction*) UObject::GObjObjects()->Data[ 37279 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execIsConnectedTo1stPartyOnlineService_Parms IsConnectedTo1stPartyOnlineService_Parms;
 
@@ -24299,10 +23228,9 @@ bool USFXOnlineComponentBlazeLoginPS3::IsConnectedTo1stPartyOnlineService ( )
 
 bool USFXOnlineComponentBlazeLoginPS3::IsSignedIn ( )
 {
-	static UFunction* pFnIsSignedIn = NULL;
-
+	UFunction* pFnIsSignedIn = (UFunction*) SdkBindings::Get ( 3390 );
 	if ( ! pFnIsSignedIn )
-		pFnIsSignedIn = (UFunction*) UObject::GObjObjects()->Data[ 37277 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execIsSignedIn_Parms IsSignedIn_Parms;
 
@@ -24322,10 +23250,9 @@ bool USFXOnlineComponentBlazeLoginPS3::IsSignedIn ( )
 
 bool USFXOnlineComponentBlazeLoginPS3::IsConnected ( )
 {
-	static UFunction* pFnIsConnected = NULL;
-
+	UFunction* pFnIsConnected = (UFunction*) SdkBindings::Get ( 3389 );
 	if ( ! pFnIsConnected )
-		pFnIsConnected = (UFunction*) UObject::GObjObjects()->Data[ 37275 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execIsConnected_Parms IsConnected_Parms;
 
@@ -24346,10 +23273,9 @@ bool USFXOnlineComponentBlazeLoginPS3::IsConnected ( )
 
 bool USFXOnlineComponentBlazeLoginPS3::IsActiveUser ( struct FUniqueNetId userId )
 {
-	static UFunction* pFnIsActiveUser = NULL;
-
+	UFunction* pFnIsActiveUser = (UFunction*) SdkBindings::Get ( 3388 );
 	if ( ! pFnIsActiveUser )
-		pFnIsActiveUser = (UFunction*) UObject::GObjObjects()->Data[ 37272 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execIsActiveUser_Parms IsActiveUser_Parms;
 	memcpy ( &IsActiveUser_Parms.userId, &userId, 0x8 );
@@ -24370,10 +23296,9 @@ bool USFXOnlineComponentBlazeLoginPS3::IsActiveUser ( struct FUniqueNetId userId
 
 void USFXOnlineComponentBlazeLoginPS3::SwitchActiveUserIndex ( int nNewIndex )
 {
-	static UFunction* pFnSwitchActiveUserIndex = NULL;
-
+	UFunction* pFnSwitchActiveUserIndex = (UFunction*) SdkBindings::Get ( 3387 );
 	if ( ! pFnSwitchActiveUserIndex )
-		pFnSwitchActiveUserIndex = (UFunction*) UObject::GObjObjects()->Data[ 37270 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execSwitchActiveUserIndex_Parms SwitchActiveUserIndex_Parms;
 	SwitchActiveUserIndex_Parms.nNewIndex = nNewIndex;
@@ -24392,10 +23317,9 @@ void USFXOnlineComponentBlazeLoginPS3::SwitchActiveUserIndex ( int nNewIndex )
 
 int USFXOnlineComponentBlazeLoginPS3::GetActiveUserIndex ( )
 {
-	static UFunction* pFnGetActiveUserIndex = NULL;
-
+	UFunction* pFnGetActiveUserIndex = (UFunction*) SdkBindings::Get ( 3386 );
 	if ( ! pFnGetActiveUserIndex )
-		pFnGetActiveUserIndex = (UFunction*) UObject::GObjObjects()->Data[ 37268 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execGetActiveUserIndex_Parms GetActiveUserIndex_Parms;
 
@@ -24415,10 +23339,9 @@ int USFXOnlineComponentBlazeLoginPS3::GetActiveUserIndex ( )
 
 unsigned char USFXOnlineComponentBlazeLoginPS3::GetLoginStatus ( )
 {
-	static UFunction* pFnGetLoginStatus = NULL;
-
+	UFunction* pFnGetLoginStatus = (UFunction*) SdkBindings::Get ( 3385 );
 	if ( ! pFnGetLoginStatus )
-		pFnGetLoginStatus = (UFunction*) UObject::GObjObjects()->Data[ 37266 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execGetLoginStatus_Parms GetLoginStatus_Parms;
 
@@ -24438,10 +23361,9 @@ unsigned char USFXOnlineComponentBlazeLoginPS3::GetLoginStatus ( )
 
 struct FName USFXOnlineComponentBlazeLoginPS3::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3384 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 37264 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -24460,10 +23382,9 @@ struct FName USFXOnlineComponentBlazeLoginPS3::GetAPIName ( )
 
 void USFXOnlineComponentBlazeLoginPS3::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3383 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 37263 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execOnRelease_Parms OnRelease_Parms;
 
@@ -24481,10 +23402,9 @@ void USFXOnlineComponentBlazeLoginPS3::OnRelease ( )
 
 void USFXOnlineComponentBlazeLoginPS3::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3382 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 37261 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -24504,10 +23424,9 @@ void USFXOnlineComponentBlazeLoginPS3::OnInitialize ( class USFXOnlineSubsystem*
 
 int USFXOnlineComponentBlazeLoginPS3::GetAuthToken ( struct FScriptDelegate funcAuthTokenRetrieved )
 {
-	static UFunction* pFnGetAuthToken = NULL;
-
+	UFunction* pFnGetAuthToken = (UFunction*) SdkBindings::Get ( 3381 );
 	if ( ! pFnGetAuthToken )
-		pFnGetAuthToken = (UFunction*) UObject::GObjObjects()->Data[ 37258 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_execGetAuthToken_Parms GetAuthToken_Parms;
 	memcpy ( &GetAuthToken_Parms.funcAuthTokenRetrieved, &funcAuthTokenRetrieved, 0xC );
@@ -24529,10 +23448,9 @@ int USFXOnlineComponentBlazeLoginPS3::GetAuthToken ( struct FScriptDelegate func
 
 class USFXOnlineJobGetAuthToken* USFXOnlineComponentBlazeLoginPS3::eventCreateJobGetAuthToken ( struct FScriptDelegate funcAuthTokenRetrieved )
 {
-	static UFunction* pFnCreateJobGetAuthToken = NULL;
-
+	UFunction* pFnCreateJobGetAuthToken = (UFunction*) SdkBindings::Get ( 3379 );
 	if ( ! pFnCreateJobGetAuthToken )
-		pFnCreateJobGetAuthToken = (UFunction*) UObject::GObjObjects()->Data[ 37253 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginPS3_eventCreateJobGetAuthToken_Parms CreateJobGetAuthToken_Parms;
 	memcpy ( &CreateJobGetAuthToken_Parms.funcAuthTokenRetrieved, &funcAuthTokenRetrieved, 0xC );
@@ -24550,10 +23468,9 @@ class USFXOnlineJobGetAuthToken* USFXOnlineComponentBlazeLoginPS3::eventCreateJo
 
 void USFXOnlineComponentBlazeLoginPS3::eventClearReadFriendsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadFriendsCompleteDelegate )
 {
-	static UFunction* pFnClearReadFriendsCompleteDelegate = NULL;
-
+	UFunction* pFnClearReadFriendsCompleteDelegate = (UFunction*) SdkBindings::Get ( 3378 );
 	if ( ! pFnClearReadFriendsCompleteDelegate )
-		pFnClearReadFriendsCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 37249 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_eventClearReadFriendsCompleteDelegate_Parms ClearReadFriendsCompleteDelegate_Parms;
 	ClearReadFriendsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -24570,10 +23487,9 @@ void USFXOnlineComponentBlazeLoginPS3::eventClearReadFriendsCompleteDelegate ( u
 
 void USFXOnlineComponentBlazeLoginPS3::eventAddReadFriendsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadFriendsCompleteDelegate )
 {
-	static UFunction* pFnAddReadFriendsCompleteDelegate = NULL;
-
+	UFunction* pFnAddReadFriendsCompleteDelegate = (UFunction*) SdkBindings::Get ( 3375 );
 	if ( ! pFnAddReadFriendsCompleteDelegate )
-		pFnAddReadFriendsCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 37241 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_eventAddReadFriendsCompleteDelegate_Parms AddReadFriendsCompleteDelegate_Parms;
 	AddReadFriendsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -24589,10 +23505,9 @@ void USFXOnlineComponentBlazeLoginPS3::eventAddReadFriendsCompleteDelegate ( uns
 
 void USFXOnlineComponentBlazeLoginPS3::OnReadFriendsComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnReadFriendsComplete = NULL;
-
+	UFunction* pFnOnReadFriendsComplete = (UFunction*) SdkBindings::Get ( 3374 );
 	if ( ! pFnOnReadFriendsComplete )
-		pFnOnReadFriendsComplete = (UFunction*) UObject::GObjObjects()->Data[ 37239 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execOnReadFriendsComplete_Parms OnReadFriendsComplete_Parms;
 	OnReadFriendsComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -24607,10 +23522,9 @@ void USFXOnlineComponentBlazeLoginPS3::OnReadFriendsComplete ( unsigned long bWa
 
 void USFXOnlineComponentBlazeLoginPS3::OnAuthTokenRetrieved ( struct FString token )
 {
-	static UFunction* pFnOnAuthTokenRetrieved = NULL;
-
+	UFunction* pFnOnAuthTokenRetrieved = (UFunction*) SdkBindings::Get ( 3373 );
 	if ( ! pFnOnAuthTokenRetrieved )
-		pFnOnAuthTokenRetrieved = (UFunction*) UObject::GObjObjects()->Data[ 37237 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginPS3_execOnAuthTokenRetrieved_Parms OnAuthTokenRetrieved_Parms;
 	memcpy ( &OnAuthTokenRetrieved_Parms.token, &token, 0xC );
@@ -24625,10 +23539,9 @@ void USFXOnlineComponentBlazeLoginPS3::OnAuthTokenRetrieved ( struct FString tok
 
 void USFXOnlineComponentBlazeLoginXenon::XenonLoginResult ( unsigned long isOpening )
 {
-	static UFunction* pFnXenonLoginResult = NULL;
-
+	UFunction* pFnXenonLoginResult = (UFunction*) SdkBindings::Get ( 3458 );
 	if ( ! pFnXenonLoginResult )
-		pFnXenonLoginResult = (UFunction*) UObject::GObjObjects()->Data[ 37493 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginXenon_execXenonLoginResult_Parms XenonLoginResult_Parms;
 	XenonLoginResult_Parms.isOpening = isOpening;
@@ -24643,10 +23556,9 @@ void USFXOnlineComponentBlazeLoginXenon::XenonLoginResult ( unsigned long isOpen
 
 bool USFXOnlineComponentBlazeLoginXenon::Show1stPartyServiceLoginImp ( )
 {
-	static UFunction* pFnShow1stPartyServiceLoginImp = NULL;
-
+	UFunction* pFnShow1stPartyServiceLoginImp = (UFunction*) SdkBindings::Get ( 3457 );
 	if ( ! pFnShow1stPartyServiceLoginImp )
-		pFnShow1stPartyServiceLoginImp = (UFunction*) UObject::GObjObjects()->Data[ 37487 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginXenon_execShow1stPartyServiceLoginImp_Parms Show1stPartyServiceLoginImp_Parms;
 
@@ -24662,10 +23574,9 @@ bool USFXOnlineComponentBlazeLoginXenon::Show1stPartyServiceLoginImp ( )
 
 void USFXOnlineComponentBlazeLoginXenon::OnExternalUIChange ( unsigned long bIsOpening )
 {
-	static UFunction* pFnOnExternalUIChange = NULL;
-
+	UFunction* pFnOnExternalUIChange = (UFunction*) SdkBindings::Get ( 3456 );
 	if ( ! pFnOnExternalUIChange )
-		pFnOnExternalUIChange = (UFunction*) UObject::GObjObjects()->Data[ 37485 ];
+		return;
 
 	USFXOnlineComponentBlazeLoginXenon_execOnExternalUIChange_Parms OnExternalUIChange_Parms;
 	OnExternalUIChange_Parms.bIsOpening = bIsOpening;
@@ -24680,10 +23591,9 @@ void USFXOnlineComponentBlazeLoginXenon::OnExternalUIChange ( unsigned long bIsO
 
 bool USFXOnlineComponentBlazeLoginXenon::HasInternetConnection ( )
 {
-	static UFunction* pFnHasInternetConnection = NULL;
-
+	UFunction* pFnHasInternetConnection = (UFunction*) SdkBindings::Get ( 3455 );
 	if ( ! pFnHasInternetConnection )
-		pFnHasInternetConnection = (UFunction*) UObject::GObjObjects()->Data[ 37483 ];
+		return {};
 
 	USFXOnlineComponentBlazeLoginXenon_execHasInternetConnection_Parms HasInternetConnection_Parms;
 
@@ -24704,10 +23614,9 @@ bool USFXOnlineComponentBlazeLoginXenon::HasInternetConnection ( )
 
 class USFXOnlineJobPurgeMessages* USFXOnlineComponentBlazeMessaging::eventCreatePurgeMessagesJob ( int InMapId )
 {
-	static UFunction* pFnCreatePurgeMessagesJob = NULL;
-
+	UFunction* pFnCreatePurgeMessagesJob = (UFunction*) SdkBindings::Get ( 3471 );
 	if ( ! pFnCreatePurgeMessagesJob )
-		pFnCreatePurgeMessagesJob = (UFunction*) UObject::GObjObjects()->Data[ 37528 ];
+		return {};
 
 	USFXOnlineComponentBlazeMessaging_eventCreatePurgeMessagesJob_Parms CreatePurgeMessagesJob_Parms;
 	CreatePurgeMessagesJob_Parms.InMapId = InMapId;
@@ -24724,10 +23633,9 @@ class USFXOnlineJobPurgeMessages* USFXOnlineComponentBlazeMessaging::eventCreate
 
 class USFXOnlineJobPurgeMessages* USFXOnlineComponentBlazeMessaging::eventCreatePurgeAllMessagesJob ( )
 {
-	static UFunction* pFnCreatePurgeAllMessagesJob = NULL;
-
+	UFunction* pFnCreatePurgeAllMessagesJob = (UFunction*) SdkBindings::Get ( 3469 );
 	if ( ! pFnCreatePurgeAllMessagesJob )
-		pFnCreatePurgeAllMessagesJob = (UFunction*) UObject::GObjObjects()->Data[ 37524 ];
+		return {};
 
 	USFXOnlineComponentBlazeMessaging_eventCreatePurgeAllMessagesJob_Parms CreatePurgeAllMessagesJob_Parms;
 
@@ -24743,10 +23651,9 @@ class USFXOnlineJobPurgeMessages* USFXOnlineComponentBlazeMessaging::eventCreate
 
 class USFXOnlineJobReceiveMessage* USFXOnlineComponentBlazeMessaging::eventCreateReceiveAllMessagesJob ( )
 {
-	static UFunction* pFnCreateReceiveAllMessagesJob = NULL;
-
+	UFunction* pFnCreateReceiveAllMessagesJob = (UFunction*) SdkBindings::Get ( 3467 );
 	if ( ! pFnCreateReceiveAllMessagesJob )
-		pFnCreateReceiveAllMessagesJob = (UFunction*) UObject::GObjObjects()->Data[ 37520 ];
+		return {};
 
 	USFXOnlineComponentBlazeMessaging_eventCreateReceiveAllMessagesJob_Parms CreateReceiveAllMessagesJob_Parms;
 
@@ -24762,10 +23669,9 @@ class USFXOnlineJobReceiveMessage* USFXOnlineComponentBlazeMessaging::eventCreat
 
 struct FName USFXOnlineComponentBlazeMessaging::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3466 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 37518 ];
+		return {};
 
 	USFXOnlineComponentBlazeMessaging_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -24784,10 +23690,9 @@ struct FName USFXOnlineComponentBlazeMessaging::GetAPIName ( )
 
 void USFXOnlineComponentBlazeMessaging::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3465 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 37517 ];
+		return;
 
 	USFXOnlineComponentBlazeMessaging_execOnRelease_Parms OnRelease_Parms;
 
@@ -24805,10 +23710,9 @@ void USFXOnlineComponentBlazeMessaging::OnRelease ( )
 
 void USFXOnlineComponentBlazeMessaging::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3464 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 37515 ];
+		return;
 
 	USFXOnlineComponentBlazeMessaging_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -24826,10 +23730,9 @@ void USFXOnlineComponentBlazeMessaging::OnInitialize ( class USFXOnlineSubsystem
 
 void USFXOnlineComponentBlazeMessaging::PurgeAllMessagesViaJob ( )
 {
-	static UFunction* pFnPurgeAllMessagesViaJob = NULL;
-
+	UFunction* pFnPurgeAllMessagesViaJob = (UFunction*) SdkBindings::Get ( 3463 );
 	if ( ! pFnPurgeAllMessagesViaJob )
-		pFnPurgeAllMessagesViaJob = (UFunction*) UObject::GObjObjects()->Data[ 37514 ];
+		return;
 
 	USFXOnlineComponentBlazeMessaging_execPurgeAllMessagesViaJob_Parms PurgeAllMessagesViaJob_Parms;
 
@@ -24846,10 +23749,9 @@ void USFXOnlineComponentBlazeMessaging::PurgeAllMessagesViaJob ( )
 
 void USFXOnlineComponentBlazeMessaging::FetchAllMessagesViaJob ( )
 {
-	static UFunction* pFnFetchAllMessagesViaJob = NULL;
-
+	UFunction* pFnFetchAllMessagesViaJob = (UFunction*) SdkBindings::Get ( 3462 );
 	if ( ! pFnFetchAllMessagesViaJob )
-		pFnFetchAllMessagesViaJob = (UFunction*) UObject::GObjObjects()->Data[ 37513 ];
+		return;
 
 	USFXOnlineComponentBlazeMessaging_execFetchAllMessagesViaJob_Parms FetchAllMessagesViaJob_Parms;
 
@@ -24866,10 +23768,9 @@ void USFXOnlineComponentBlazeMessaging::FetchAllMessagesViaJob ( )
 
 void USFXOnlineComponentBlazeMessaging::PurgeAllMessages ( )
 {
-	static UFunction* pFnPurgeAllMessages = NULL;
-
+	UFunction* pFnPurgeAllMessages = (UFunction*) SdkBindings::Get ( 3461 );
 	if ( ! pFnPurgeAllMessages )
-		pFnPurgeAllMessages = (UFunction*) UObject::GObjObjects()->Data[ 37512 ];
+		return;
 
 	USFXOnlineComponentBlazeMessaging_execPurgeAllMessages_Parms PurgeAllMessages_Parms;
 
@@ -24889,10 +23790,9 @@ void USFXOnlineComponentBlazeMessaging::PurgeAllMessages ( )
 
 void USFXOnlineComponentBlazeMessaging::SendMessage ( TArray< struct FString > sendToPersonaNames, unsigned char msgType, TArray< struct FString > Params )
 {
-	static UFunction* pFnSendMessage = NULL;
-
+	UFunction* pFnSendMessage = (UFunction*) SdkBindings::Get ( 3460 );
 	if ( ! pFnSendMessage )
-		pFnSendMessage = (UFunction*) UObject::GObjObjects()->Data[ 37506 ];
+		return;
 
 	USFXOnlineComponentBlazeMessaging_execSendMessage_Parms SendMessage_Parms;
 	memcpy ( &SendMessage_Parms.sendToPersonaNames, &sendToPersonaNames, 0xC );
@@ -24912,10 +23812,9 @@ void USFXOnlineComponentBlazeMessaging::SendMessage ( TArray< struct FString > s
 
 void USFXOnlineComponentBlazeMessaging::FetchAllMessages ( )
 {
-	static UFunction* pFnFetchAllMessages = NULL;
-
+	UFunction* pFnFetchAllMessages = (UFunction*) SdkBindings::Get ( 3459 );
 	if ( ! pFnFetchAllMessages )
-		pFnFetchAllMessages = (UFunction*) UObject::GObjObjects()->Data[ 37505 ];
+		return;
 
 	USFXOnlineComponentBlazeMessaging_execFetchAllMessages_Parms FetchAllMessages_Parms;
 
@@ -24936,10 +23835,9 @@ void USFXOnlineComponentBlazeMessaging::FetchAllMessages ( )
 
 void USFXOnlineComponentBlazeNotification::GetGalaxyAtWarRatingsCompleted ( TArray< int > updatedSecurityRatings, TArray< int > updatedWarAssets, int Level, int errorCode )
 {
-	static UFunction* pFnGetGalaxyAtWarRatingsCompleted = NULL;
-
+	UFunction* pFnGetGalaxyAtWarRatingsCompleted = (UFunction*) SdkBindings::Get ( 3501 );
 	if ( ! pFnGetGalaxyAtWarRatingsCompleted )
-		pFnGetGalaxyAtWarRatingsCompleted = (UFunction*) UObject::GObjObjects()->Data[ 37592 ];
+		return;
 
 	USFXOnlineComponentBlazeNotification_execGetGalaxyAtWarRatingsCompleted_Parms GetGalaxyAtWarRatingsCompleted_Parms;
 	memcpy ( &GetGalaxyAtWarRatingsCompleted_Parms.updatedSecurityRatings, &updatedSecurityRatings, 0xC );
@@ -24961,10 +23859,9 @@ void USFXOnlineComponentBlazeNotification::GetGalaxyAtWarRatingsCompleted ( TArr
 
 struct FString USFXOnlineComponentBlazeNotification::eventGetStoreCatalogId ( )
 {
-	static UFunction* pFnGetStoreCatalogId = NULL;
-
+	UFunction* pFnGetStoreCatalogId = (UFunction*) SdkBindings::Get ( 3500 );
 	if ( ! pFnGetStoreCatalogId )
-		pFnGetStoreCatalogId = (UFunction*) UObject::GObjObjects()->Data[ 37589 ];
+		return {};
 
 	USFXOnlineComponentBlazeNotification_eventGetStoreCatalogId_Parms GetStoreCatalogId_Parms;
 
@@ -24979,10 +23876,9 @@ struct FString USFXOnlineComponentBlazeNotification::eventGetStoreCatalogId ( )
 
 void USFXOnlineComponentBlazeNotification::eventRequestGalaxyAtWarLevel ( )
 {
-	static UFunction* pFnRequestGalaxyAtWarLevel = NULL;
-
+	UFunction* pFnRequestGalaxyAtWarLevel = (UFunction*) SdkBindings::Get ( 3498 );
 	if ( ! pFnRequestGalaxyAtWarLevel )
-		pFnRequestGalaxyAtWarLevel = (UFunction*) UObject::GObjObjects()->Data[ 37586 ];
+		return;
 
 	USFXOnlineComponentBlazeNotification_eventRequestGalaxyAtWarLevel_Parms RequestGalaxyAtWarLevel_Parms;
 
@@ -24995,10 +23891,9 @@ void USFXOnlineComponentBlazeNotification::eventRequestGalaxyAtWarLevel ( )
 
 void USFXOnlineComponentBlazeNotification::PostGetLeaderboardList ( )
 {
-	static UFunction* pFnPostGetLeaderboardList = NULL;
-
+	UFunction* pFnPostGetLeaderboardList = (UFunction*) SdkBindings::Get ( 3497 );
 	if ( ! pFnPostGetLeaderboardList )
-		pFnPostGetLeaderboardList = (UFunction*) UObject::GObjObjects()->Data[ 37585 ];
+		return;
 
 	USFXOnlineComponentBlazeNotification_execPostGetLeaderboardList_Parms PostGetLeaderboardList_Parms;
 
@@ -25016,10 +23911,9 @@ void USFXOnlineComponentBlazeNotification::PostGetLeaderboardList ( )
 
 void USFXOnlineComponentBlazeNotification::ReadPlayerStorageCallback ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnReadPlayerStorageCallback = NULL;
-
+	UFunction* pFnReadPlayerStorageCallback = (UFunction*) SdkBindings::Get ( 3496 );
 	if ( ! pFnReadPlayerStorageCallback )
-		pFnReadPlayerStorageCallback = (UFunction*) UObject::GObjObjects()->Data[ 37583 ];
+		return;
 
 	USFXOnlineComponentBlazeNotification_execReadPlayerStorageCallback_Parms ReadPlayerStorageCallback_Parms;
 	ReadPlayerStorageCallback_Parms.bWasSuccessful = bWasSuccessful;
@@ -25037,10 +23931,9 @@ void USFXOnlineComponentBlazeNotification::ReadPlayerStorageCallback ( unsigned
 
 void USFXOnlineComponentBlazeNotification::FetchOfflineEntitlementStoreMappings ( )
 {
-	static UFunction* pFnFetchOfflineEntitlementStoreMappings = NULL;
-
+	UFunction* pFnFetchOfflineEntitlementStoreMappings = (UFunction*) SdkBindings::Get ( 3495 );
 	if ( ! pFnFetchOfflineEntitlementStoreMappings )
-		pFnFetchOfflineEntitlementStoreMappings = (UFunction*) UObject::GObjObjects()->Data[ 37582 ];
+		return;
 
 	USFXOnlineComponentBlazeNotification_execFetchOfflineEntitlementStoreMappings_Parms FetchOfflineEntitlementStoreMappings_Parms;
 
@@ -25058,10 +23951,9 @@ void USFXOnlineComponentBlazeNotification::FetchOfflineEntitlementStoreMappings
 
 bool USFXOnlineComponentBlazeNotification::IsLiveINIOutOfDate ( )
 {
-	static UFunction* pFnIsLiveINIOutOfDate = NULL;
-
+	UFunction* pFnIsLiveINIOutOfDate = (UFunction*) SdkBindings::Get ( 3494 );
 	if ( ! pFnIsLiveINIOutOfDate )
-		pFnIsLiveINIOutOfDate = (UFunction*) UObject::GObjObjects()->Data[ 37580 ];
+		return {};
 
 	USFXOnlineComponentBlazeNotification_execIsLiveINIOutOfDate_Parms IsLiveINIOutOfDate_Parms;
 
@@ -25081,10 +23973,9 @@ bool USFXOnlineComponentBlazeNotification::IsLiveINIOutOfDate ( )
 
 bool USFXOnlineComponentBlazeNotification::IsFetchingLiveBinaryINIData ( )
 {
-	static UFunction* pFnIsFetchingLiveBinaryINIData = NULL;
-
+	UFunction* pFnIsFetchingLiveBinaryINIData = (UFunction*) SdkBindings::Get ( 3493 );
 	if ( ! pFnIsFetchingLiveBinaryINIData )
-		pFnIsFetchingLiveBinaryINIData = (UFunction*) UObject::GObjObjects()->Data[ 37578 ];
+		return {};
 
 	USFXOnlineComponentBlazeNotification_execIsFetchingLiveBinaryINIData_Parms IsFetchingLiveBinaryINIData_Parms;
 
@@ -25104,10 +23995,9 @@ bool USFXOnlineComponentBlazeNotification::IsFetchingLiveBinaryINIData ( )
 
 void USFXOnlineComponentBlazeNotification::RequestBinaryLiveINIData ( unsigned long bMainMenu )
 {
-	static UFunction* pFnRequestBinaryLiveINIData = NULL;
-
+	UFunction* pFnRequestBinaryLiveINIData = (UFunction*) SdkBindings::Get ( 3492 );
 	if ( ! pFnRequestBinaryLiveINIData )
-		pFnRequestBinaryLiveINIData = (UFunction*) UObject::GObjObjects()->Data[ 37576 ];
+		return;
 
 	USFXOnlineComponentBlazeNotification_execRequestBinaryLiveINIData_Parms RequestBinaryLiveINIData_Parms;
 	RequestBinaryLiveINIData_Parms.bMainMenu = bMainMenu;
@@ -25126,10 +24016,9 @@ void USFXOnlineComponentBlazeNotification::RequestBinaryLiveINIData ( unsigned l
 
 int USFXOnlineComponentBlazeNotification::GetLiveBinaryINIVersion ( )
 {
-	static UFunction* pFnGetLiveBinaryINIVersion = NULL;
-
+	UFunction* pFnGetLiveBinaryINIVersion = (UFunction*) SdkBindings::Get ( 3491 );
 	if ( ! pFnGetLiveBinaryINIVersion )
-		pFnGetLiveBinaryINIVersion = (UFunction*) UObject::GObjObjects()->Data[ 37573 ];
+		return {};
 
 	USFXOnlineComponentBlazeNotification_execGetLiveBinaryINIVersion_Parms GetLiveBinaryINIVersion_Parms;
 
@@ -25144,10 +24033,9 @@ int USFXOnlineComponentBlazeNotification::GetLiveBinaryINIVersion ( )
 
 void USFXOnlineComponentBlazeNotification::UpdateMOTDGUI ( )
 {
-	static UFunction* pFnUpdateMOTDGUI = NULL;
-
+	UFunction* pFnUpdateMOTDGUI = (UFunction*) SdkBindings::Get ( 3490 );
 	if ( ! pFnUpdateMOTDGUI )
-		pFnUpdateMOTDGUI = (UFunction*) UObject::GObjObjects()->Data[ 37572 ];
+		return;
 
 	USFXOnlineComponentBlazeNotification_execUpdateMOTDGUI_Parms UpdateMOTDGUI_Parms;
 
@@ -25166,10 +24054,9 @@ void USFXOnlineComponentBlazeNotification::UpdateMOTDGUI ( )
 
 struct FSFXOnlineMOTDInfo USFXOnlineComponentBlazeNotification::GetMOTDInfo ( unsigned char Type )
 {
-	static UFunction* pFnGetMOTDInfo = NULL;
-
+	UFunction* pFnGetMOTDInfo = (UFunction*) SdkBindings::Get ( 3489 );
 	if ( ! pFnGetMOTDInfo )
-		pFnGetMOTDInfo = (UFunction*) UObject::GObjObjects()->Data[ 37569 ];
+		return {};
 
 	USFXOnlineComponentBlazeNotification_execGetMOTDInfo_Parms GetMOTDInfo_Parms;
 	GetMOTDInfo_Parms.Type = Type;
@@ -25191,10 +24078,9 @@ struct FSFXOnlineMOTDInfo USFXOnlineComponentBlazeNotification::GetMOTDInfo ( un
 
 bool USFXOnlineComponentBlazeNotification::CheckMessageAgainstDR ( int i )
 {
-	static UFunction* pFnCheckMessageAgainstDR = NULL;
-
+	UFunction* pFnCheckMessageAgainstDR = (UFunction*) SdkBindings::Get ( 3488 );
 	if ( ! pFnCheckMessageAgainstDR )
-		pFnCheckMessageAgainstDR = (UFunction*) UObject::GObjObjects()->Data[ 37566 ];
+		return {};
 
 	USFXOnlineComponentBlazeNotification_execCheckMessageAgainstDR_Parms CheckMessageAgainstDR_Parms;
 	CheckMessageAgainstDR_Parms.i = i;
@@ -25215,10 +24101,9 @@ bool USFXOnlineComponentBlazeNotification::CheckMessageAgainstDR ( int i )
 
 void USFXOnlineComponentBlazeNotification::RequestLiveTlkTable ( unsigned long bMainMenu )
 {
-	static UFunction* pFnRequestLiveTlkTable = NULL;
-
+	UFunction* pFnRequestLiveTlkTable = (UFunction*) SdkBindings::Get ( 3487 );
 	if ( ! pFnRequestLiveTlkTable )
-		pFnRequestLiveTlkTable = (UFunction*) UObject::GObjObjects()->Data[ 37564 ];
+		return;
 
 	USFXOnlineComponentBlazeNotification_execRequestLiveTlkTable_Parms RequestLiveTlkTable_Parms;
 	RequestLiveTlkTable_Parms.bMainMenu = bMainMenu;
@@ -25238,10 +24123,9 @@ void USFXOnlineComponentBlazeNotification::RequestLiveTlkTable ( unsigned long b
 
 int USFXOnlineComponentBlazeNotification::GetTargetOfferId ( unsigned char nSource )
 {
-	static UFunction* pFnGetTargetOfferId = NULL;
-
+	UFunction* pFnGetTargetOfferId = (UFunction*) SdkBindings::Get ( 3486 );
 	if ( ! pFnGetTargetOfferId )
-		pFnGetTargetOfferId = (UFunction*) UObject::GObjObjects()->Data[ 37561 ];
+		return {};
 
 	USFXOnlineComponentBlazeNotification_execGetTargetOfferId_Parms GetTargetOfferId_Parms;
 	GetTargetOfferId_Parms.nSource = nSource;
@@ -25262,10 +24146,9 @@ int USFXOnlineComponentBlazeNotification::GetTargetOfferId ( unsigned char nSour
 
 struct FString USFXOnlineComponentBlazeNotification::GetDimeInfo ( )
 {
-	static UFunction* pFnGetDimeInfo = NULL;
-
+	UFunction* pFnGetDimeInfo = (UFunction*) SdkBindings::Get ( 3485 );
 	if ( ! pFnGetDimeInfo )
-		pFnGetDimeInfo = (UFunction*) UObject::GObjObjects()->Data[ 37559 ];
+		return {};
 
 	USFXOnlineComponentBlazeNotification_execGetDimeInfo_Parms GetDimeInfo_Parms;
 
@@ -25285,10 +24168,9 @@ struct FString USFXOnlineComponentBlazeNotification::GetDimeInfo ( )
 
 TArray< struct FSFXOnlineEntitlementLookupInfo > USFXOnlineComponentBlazeNotification::GetEntitlementInfo ( )
 {
-	static UFunction* pFnGetEntitlementInfo = NULL;
-
+	UFunction* pFnGetEntitlementInfo = (UFunction*) SdkBindings::Get ( 3484 );
 	if ( ! pFnGetEntitlementInfo )
-		pFnGetEntitlementInfo = (UFunction*) UObject::GObjObjects()->Data[ 37556 ];
+		return {};
 
 	USFXOnlineComponentBlazeNotification_execGetEntitlementInfo_Parms GetEntitlementInfo_Parms;
 
@@ -25307,10 +24189,9 @@ TArray< struct FSFXOnlineEntitlementLookupInfo > USFXOnlineComponentBlazeNotific
 
 void USFXOnlineComponentBlazeNotification::LoadDimeCallback ( )
 {
-	static UFunction* pFnLoadDimeCallback = NULL;
-
+	UFunction* pFnLoadDimeCallback = (UFunction*) SdkBindings::Get ( 3483 );
 	if ( ! pFnLoadDimeCallback )
-		pFnLoadDimeCallback = (UFunction*) UObject::GObjObjects()->Data[ 37555 ];
+		return;
 
 	USFXOnlineComponentBlazeNotification_execLoadDimeCallback_Parms LoadDimeCallback_Parms;
 
@@ -25327,10 +24208,9 @@ void USFXOnlineComponentBlazeNotification::LoadDimeCallback ( )
 
 void USFXOnlineComponentBlazeNotification::LoadDimeInfo ( )
 {
-	static UFunction* pFnLoadDimeInfo = NULL;
-
+	UFunction* pFnLoadDimeInfo = (UFunction*) SdkBindings::Get ( 3482 );
 	if ( ! pFnLoadDimeInfo )
-		pFnLoadDimeInfo = (UFunction*) UObject::GObjObjects()->Data[ 37554 ];
+		return;
 
 	USFXOnlineComponentBlazeNotification_execLoadDimeInfo_Parms LoadDimeInfo_Parms;
 
@@ -25347,10 +24227,9 @@ void USFXOnlineComponentBlazeNotification::LoadDimeInfo ( )
 
 void USFXOnlineComponentBlazeNotification::RequestDimeInfo ( )
 {
-	static UFunction* pFnRequestDimeInfo = NULL;
-
+	UFunction* pFnRequestDimeInfo = (UFunction*) SdkBindings::Get ( 3481 );
 	if ( ! pFnRequestDimeInfo )
-		pFnRequestDimeInfo = (UFunction*) UObject::GObjObjects()->Data[ 37553 ];
+		return;
 
 	USFXOnlineComponentBlazeNotification_execRequestDimeInfo_Parms RequestDimeInfo_Parms;
 
@@ -25367,10 +24246,9 @@ void USFXOnlineComponentBlazeNotification::RequestDimeInfo ( )
 
 void USFXOnlineComponentBlazeNotification::RequestEntitlementsInfo ( )
 {
-	static UFunction* pFnRequestEntitlementsInfo = NULL;
-
+	UFunction* pFnRequestEntitlementsInfo = (UFunction*) SdkBindings::Get ( 3480 );
 	if ( ! pFnRequestEntitlementsInfo )
-		pFnRequestEntitlementsInfo = (UFunction*) UObject::GObjObjects()->Data[ 37552 ];
+		return;
 
 	USFXOnlineComponentBlazeNotification_execRequestEntitlementsInfo_Parms RequestEntitlementsInfo_Parms;
 
@@ -25387,10 +24265,9 @@ void USFXOnlineComponentBlazeNotification::RequestEntitlementsInfo ( )
 
 void USFXOnlineComponentBlazeNotification::RequestServerInfo ( )
 {
-	static UFunction* pFnRequestServerInfo = NULL;
-
+	UFunction* pFnRequestServerInfo = (UFunction*) SdkBindings::Get ( 3479 );
 	if ( ! pFnRequestServerInfo )
-		pFnRequestServerInfo = (UFunction*) UObject::GObjObjects()->Data[ 37551 ];
+		return;
 
 	USFXOnlineComponentBlazeNotification_execRequestServerInfo_Parms RequestServerInfo_Parms;
 
@@ -25407,10 +24284,9 @@ void USFXOnlineComponentBlazeNotification::RequestServerInfo ( )
 
 void USFXOnlineComponentBlazeNotification::AdvanceToNextRequest ( )
 {
-	static UFunction* pFnAdvanceToNextRequest = NULL;
-
+	UFunction* pFnAdvanceToNextRequest = (UFunction*) SdkBindings::Get ( 3478 );
 	if ( ! pFnAdvanceToNextRequest )
-		pFnAdvanceToNextRequest = (UFunction*) UObject::GObjObjects()->Data[ 37550 ];
+		return;
 
 	USFXOnlineComponentBlazeNotification_execAdvanceToNextRequest_Parms AdvanceToNextRequest_Parms;
 
@@ -25427,10 +24303,9 @@ void USFXOnlineComponentBlazeNotification::AdvanceToNextRequest ( )
 
 void USFXOnlineComponentBlazeNotification::RequestData ( )
 {
-	static UFunction* pFnRequestData = NULL;
-
+	UFunction* pFnRequestData = (UFunction*) SdkBindings::Get ( 3477 );
 	if ( ! pFnRequestData )
-		pFnRequestData = (UFunction*) UObject::GObjObjects()->Data[ 37549 ];
+		return;
 
 	USFXOnlineComponentBlazeNotification_execRequestData_Parms RequestData_Parms;
 
@@ -25448,10 +24323,9 @@ void USFXOnlineComponentBlazeNotification::RequestData ( )
 
 struct FName USFXOnlineComponentBlazeNotification::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3476 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 37547 ];
+		return {};
 
 	USFXOnlineComponentBlazeNotification_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -25470,10 +24344,9 @@ struct FName USFXOnlineComponentBlazeNotification::GetAPIName ( )
 
 void USFXOnlineComponentBlazeNotification::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3475 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 37546 ];
+		return;
 
 	USFXOnlineComponentBlazeNotification_execOnRelease_Parms OnRelease_Parms;
 
@@ -25491,10 +24364,9 @@ void USFXOnlineComponentBlazeNotification::OnRelease ( )
 
 void USFXOnlineComponentBlazeNotification::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3474 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 37544 ];
+		return;
 
 	USFXOnlineComponentBlazeNotification_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -25513,10 +24385,9 @@ void USFXOnlineComponentBlazeNotification::OnInitialize ( class USFXOnlineSubsys
 
 void USFXOnlineComponentBlazeNotification::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
-
+	UFunction* pFnOnTick = (UFunction*) SdkBindings::Get ( 3473 );
 	if ( ! pFnOnTick )
-		pFnOnTick = (UFunction*) UObject::GObjObjects()->Data[ 37542 ];
+		return;
 
 	USFXOnlineComponentBlazeNotification_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
@@ -25536,10 +24407,9 @@ void USFXOnlineComponentBlazeNotification::OnTick ( class USFXOnlineEvent* oEven
 
 void USFXOnlineComponentBlazeStats::GameReportingCallback ( unsigned char eError, int nJob )
 {
-	static UFunction* pFnGameReportingCallback = NULL;
-
+	UFunction* pFnGameReportingCallback = (UFunction*) SdkBindings::Get ( 3554 );
 	if ( ! pFnGameReportingCallback )
-		pFnGameReportingCallback = (UFunction*) UObject::GObjObjects()->Data[ 37772 ];
+		return;
 
 	USFXOnlineComponentBlazeStats_execGameReportingCallback_Parms GameReportingCallback_Parms;
 	GameReportingCallback_Parms.eError = eError;
@@ -25555,10 +24425,9 @@ void USFXOnlineComponentBlazeStats::GameReportingCallback ( unsigned char eError
 
 class USFXOnlineJobGetStatsGroupList* USFXOnlineComponentBlazeStats::eventCreateJobGetStatsGroupList ( )
 {
-	static UFunction* pFnCreateJobGetStatsGroupList = NULL;
-
+	UFunction* pFnCreateJobGetStatsGroupList = (UFunction*) SdkBindings::Get ( 3551 );
 	if ( ! pFnCreateJobGetStatsGroupList )
-		pFnCreateJobGetStatsGroupList = (UFunction*) UObject::GObjObjects()->Data[ 37752 ];
+		return {};
 
 	USFXOnlineComponentBlazeStats_eventCreateJobGetStatsGroupList_Parms CreateJobGetStatsGroupList_Parms;
 
@@ -25575,10 +24444,9 @@ class USFXOnlineJobGetStatsGroupList* USFXOnlineComponentBlazeStats::eventCreate
 
 class USFXOnlineJobGameReporting* USFXOnlineComponentBlazeStats::eventCreateJobGameReporting ( class UOnlineStatsWrite* StatsWrite )
 {
-	static UFunction* pFnCreateJobGameReporting = NULL;
-
+	UFunction* pFnCreateJobGameReporting = (UFunction*) SdkBindings::Get ( 3549 );
 	if ( ! pFnCreateJobGameReporting )
-		pFnCreateJobGameReporting = (UFunction*) UObject::GObjObjects()->Data[ 37747 ];
+		return {};
 
 	USFXOnlineComponentBlazeStats_eventCreateJobGameReporting_Parms CreateJobGameReporting_Parms;
 	CreateJobGameReporting_Parms.StatsWrite = StatsWrite;
@@ -25597,10 +24465,9 @@ class USFXOnlineJobGameReporting* USFXOnlineComponentBlazeStats::eventCreateJobG
 
 bool USFXOnlineComponentBlazeStats::RegisterStatGuid ( struct FUniqueNetId PlayerID, struct FString* ClientStatGuid )
 {
-	static UFunction* pFnRegisterStatGuid = NULL;
-
+	UFunction* pFnRegisterStatGuid = (UFunction*) SdkBindings::Get ( 3548 );
 	if ( ! pFnRegisterStatGuid )
-		pFnRegisterStatGuid = (UFunction*) UObject::GObjObjects()->Data[ 37743 ];
+		return {};
 
 	USFXOnlineComponentBlazeStats_execRegisterStatGuid_Parms RegisterStatGuid_Parms;
 	memcpy ( &RegisterStatGuid_Parms.PlayerID, &PlayerID, 0x8 );
@@ -25620,10 +24487,9 @@ bool USFXOnlineComponentBlazeStats::RegisterStatGuid ( struct FUniqueNetId Playe
 
 struct FString USFXOnlineComponentBlazeStats::GetClientStatGuid ( )
 {
-	static UFunction* pFnGetClientStatGuid = NULL;
-
+	UFunction* pFnGetClientStatGuid = (UFunction*) SdkBindings::Get ( 3547 );
 	if ( ! pFnGetClientStatGuid )
-		pFnGetClientStatGuid = (UFunction*) UObject::GObjObjects()->Data[ 37741 ];
+		return {};
 
 	USFXOnlineComponentBlazeStats_execGetClientStatGuid_Parms GetClientStatGuid_Parms;
 
@@ -25639,10 +24505,9 @@ struct FString USFXOnlineComponentBlazeStats::GetClientStatGuid ( )
 
 void USFXOnlineComponentBlazeStats::ClearRegisterHostStatGuidCompleteDelegateDelegate ( struct FScriptDelegate RegisterHostStatGuidCompleteDelegate )
 {
-	static UFunction* pFnClearRegisterHostStatGuidCompleteDelegateDelegate = NULL;
-
+	UFunction* pFnClearRegisterHostStatGuidCompleteDelegateDelegate = (UFunction*) SdkBindings::Get ( 3546 );
 	if ( ! pFnClearRegisterHostStatGuidCompleteDelegateDelegate )
-		pFnClearRegisterHostStatGuidCompleteDelegateDelegate = (UFunction*) UObject::GObjObjects()->Data[ 37739 ];
+		return;
 
 	USFXOnlineComponentBlazeStats_execClearRegisterHostStatGuidCompleteDelegateDelegate_Parms ClearRegisterHostStatGuidCompleteDelegateDelegate_Parms;
 	memcpy ( &ClearRegisterHostStatGuidCompleteDelegateDelegate_Parms.RegisterHostStatGuidCompleteDelegate, &RegisterHostStatGuidCompleteDelegate, 0xC );
@@ -25657,10 +24522,9 @@ void USFXOnlineComponentBlazeStats::ClearRegisterHostStatGuidCompleteDelegateDel
 
 void USFXOnlineComponentBlazeStats::AddRegisterHostStatGuidCompleteDelegate ( struct FScriptDelegate RegisterHostStatGuidCompleteDelegate )
 {
-	static UFunction* pFnAddRegisterHostStatGuidCompleteDelegate = NULL;
-
+	UFunction* pFnAddRegisterHostStatGuidCompleteDelegate = (UFunction*) SdkBindings::Get ( 3545 );
 	if ( ! pFnAddRegisterHostStatGuidCompleteDelegate )
-		pFnAddRegisterHostStatGuidCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 37737 ];
+		return;
 
 	USFXOnlineComponentBlazeStats_execAddRegisterHostStatGuidCompleteDelegate_Parms AddRegisterHostStatGuidCompleteDelegate_Parms;
 	memcpy ( &AddRegisterHostStatGuidCompleteDelegate_Parms.RegisterHostStatGuidCompleteDelegate, &RegisterHostStatGuidCompleteDelegate, 0xC );
@@ -25676,10 +24540,9 @@ void USFXOnlineComponentBlazeStats::AddRegisterHostStatGuidCompleteDelegate ( st
 
 bool USFXOnlineComponentBlazeStats::RegisterHostStatGuid ( struct FString* HostStatGuid )
 {
-	static UFunction* pFnRegisterHostStatGuid = NULL;
-
+	UFunction* pFnRegisterHostStatGuid = (UFunction*) SdkBindings::Get ( 3544 );
 	if ( ! pFnRegisterHostStatGuid )
-		pFnRegisterHostStatGuid = (UFunction*) UObject::GObjObjects()->Data[ 37734 ];
+		return {};
 
 	USFXOnlineComponentBlazeStats_execRegisterHostStatGuid_Parms RegisterHostStatGuid_Parms;
 
@@ -25698,10 +24561,9 @@ bool USFXOnlineComponentBlazeStats::RegisterHostStatGuid ( struct FString* HostS
 
 struct FString USFXOnlineComponentBlazeStats::GetHostStatGuid ( )
 {
-	static UFunction* pFnGetHostStatGuid = NULL;
-
+	UFunction* pFnGetHostStatGuid = (UFunction*) SdkBindings::Get ( 3543 );
 	if ( ! pFnGetHostStatGuid )
-		pFnGetHostStatGuid = (UFunction*) UObject::GObjObjects()->Data[ 37732 ];
+		return {};
 
 	USFXOnlineComponentBlazeStats_execGetHostStatGuid_Parms GetHostStatGuid_Parms;
 
@@ -25720,10 +24582,9 @@ struct FString USFXOnlineComponentBlazeStats::GetHostStatGuid ( )
 
 bool USFXOnlineComponentBlazeStats::WriteOnlinePlayerScores ( struct FName SessionName, int LeaderboardId, TArray< struct FOnlinePlayerScore >* PlayerScores )
 {
-	static UFunction* pFnWriteOnlinePlayerScores = NULL;
-
+	UFunction* pFnWriteOnlinePlayerScores = (UFunction*) SdkBindings::Get ( 3542 );
 	if ( ! pFnWriteOnlinePlayerScores )
-		pFnWriteOnlinePlayerScores = (UFunction*) UObject::GObjObjects()->Data[ 37726 ];
+		return {};
 
 	USFXOnlineComponentBlazeStats_execWriteOnlinePlayerScores_Parms WriteOnlinePlayerScores_Parms;
 	memcpy ( &WriteOnlinePlayerScores_Parms.SessionName, &SessionName, 0x8 );
@@ -25744,10 +24605,9 @@ bool USFXOnlineComponentBlazeStats::WriteOnlinePlayerScores ( struct FName Sessi
 
 void USFXOnlineComponentBlazeStats::FreeStats ( class UOnlineStatsRead* StatsRead )
 {
-	static UFunction* pFnFreeStats = NULL;
-
+	UFunction* pFnFreeStats = (UFunction*) SdkBindings::Get ( 3541 );
 	if ( ! pFnFreeStats )
-		pFnFreeStats = (UFunction*) UObject::GObjObjects()->Data[ 37724 ];
+		return;
 
 	USFXOnlineComponentBlazeStats_execFreeStats_Parms FreeStats_Parms;
 	FreeStats_Parms.StatsRead = StatsRead;
@@ -25762,10 +24622,9 @@ void USFXOnlineComponentBlazeStats::FreeStats ( class UOnlineStatsRead* StatsRea
 
 void USFXOnlineComponentBlazeStats::ClearReadOnlineStatsCompleteDelegate ( struct FScriptDelegate ReadOnlineStatsCompleteDelegate )
 {
-	static UFunction* pFnClearReadOnlineStatsCompleteDelegate = NULL;
-
+	UFunction* pFnClearReadOnlineStatsCompleteDelegate = (UFunction*) SdkBindings::Get ( 3540 );
 	if ( ! pFnClearReadOnlineStatsCompleteDelegate )
-		pFnClearReadOnlineStatsCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 37722 ];
+		return;
 
 	USFXOnlineComponentBlazeStats_execClearReadOnlineStatsCompleteDelegate_Parms ClearReadOnlineStatsCompleteDelegate_Parms;
 	memcpy ( &ClearReadOnlineStatsCompleteDelegate_Parms.ReadOnlineStatsCompleteDelegate, &ReadOnlineStatsCompleteDelegate, 0xC );
@@ -25780,10 +24639,9 @@ void USFXOnlineComponentBlazeStats::ClearReadOnlineStatsCompleteDelegate ( struc
 
 void USFXOnlineComponentBlazeStats::AddReadOnlineStatsCompleteDelegate ( struct FScriptDelegate ReadOnlineStatsCompleteDelegate )
 {
-	static UFunction* pFnAddReadOnlineStatsCompleteDelegate = NULL;
-
+	UFunction* pFnAddReadOnlineStatsCompleteDelegate = (UFunction*) SdkBindings::Get ( 3539 );
 	if ( ! pFnAddReadOnlineStatsCompleteDelegate )
-		pFnAddReadOnlineStatsCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 37720 ];
+		return;
 
 	USFXOnlineComponentBlazeStats_execAddReadOnlineStatsCompleteDelegate_Parms AddReadOnlineStatsCompleteDelegate_Parms;
 	memcpy ( &AddReadOnlineStatsCompleteDelegate_Parms.ReadOnlineStatsCompleteDelegate, &ReadOnlineStatsCompleteDelegate, 0xC );
@@ -25801,10 +24659,9 @@ void USFXOnlineComponentBlazeStats::AddReadOnlineStatsCompleteDelegate ( struct
 
 bool USFXOnlineComponentBlazeStats::ReadOnlineStatsByRankAroundPlayer ( unsigned char LocalUserNum, class UOnlineStatsRead* StatsRead, int NumRows )
 {
-	static UFunction* pFnReadOnlineStatsByRankAroundPlayer = NULL;
-
+	UFunction* pFnReadOnlineStatsByRankAroundPlayer = (UFunction*) SdkBindings::Get ( 3538 );
 	if ( ! pFnReadOnlineStatsByRankAroundPlayer )
-		pFnReadOnlineStatsByRankAroundPlayer = (UFunction*) UObject::GObjObjects()->Data[ 37715 ];
+		return {};
 
 	USFXOnlineComponentBlazeStats_execReadOnlineStatsByRankAroundPlayer_Parms ReadOnlineStatsByRankAroundPlayer_Parms;
 	ReadOnlineStatsByRankAroundPlayer_Parms.LocalUserNum = LocalUserNum;
@@ -25826,10 +24683,9 @@ bool USFXOnlineComponentBlazeStats::ReadOnlineStatsByRankAroundPlayer ( unsigned
 
 bool USFXOnlineComponentBlazeStats::ReadOnlineStatsByRank ( class UOnlineStatsRead* StatsRead, int StartIndex, int NumToRead )
 {
-	static UFunction* pFnReadOnlineStatsByRank = NULL;
-
+	UFunction* pFnReadOnlineStatsByRank = (UFunction*) SdkBindings::Get ( 3537 );
 	if ( ! pFnReadOnlineStatsByRank )
-		pFnReadOnlineStatsByRank = (UFunction*) UObject::GObjObjects()->Data[ 37710 ];
+		return {};
 
 	USFXOnlineComponentBlazeStats_execReadOnlineStatsByRank_Parms ReadOnlineStatsByRank_Parms;
 	ReadOnlineStatsByRank_Parms.StatsRead = StatsRead;
@@ -25850,10 +24706,9 @@ bool USFXOnlineComponentBlazeStats::ReadOnlineStatsByRank ( class UOnlineStatsRe
 
 bool USFXOnlineComponentBlazeStats::ReadOnlineStatsForFriends ( unsigned char LocalUserNum, class UOnlineStatsRead* StatsRead )
 {
-	static UFunction* pFnReadOnlineStatsForFriends = NULL;
-
+	UFunction* pFnReadOnlineStatsForFriends = (UFunction*) SdkBindings::Get ( 3536 );
 	if ( ! pFnReadOnlineStatsForFriends )
-		pFnReadOnlineStatsForFriends = (UFunction*) UObject::GObjObjects()->Data[ 37706 ];
+		return {};
 
 	USFXOnlineComponentBlazeStats_execReadOnlineStatsForFriends_Parms ReadOnlineStatsForFriends_Parms;
 	ReadOnlineStatsForFriends_Parms.LocalUserNum = LocalUserNum;
@@ -25873,10 +24728,9 @@ bool USFXOnlineComponentBlazeStats::ReadOnlineStatsForFriends ( unsigned char Lo
 
 bool USFXOnlineComponentBlazeStats::ReadOnlineStats ( class UOnlineStatsRead* StatsRead, TArray< struct FUniqueNetId >* Players )
 {
-	static UFunction* pFnReadOnlineStats = NULL;
-
+	UFunction* pFnReadOnlineStats = (UFunction*) SdkBindings::Get ( 3535 );
 	if ( ! pFnReadOnlineStats )
-		pFnReadOnlineStats = (UFunction*) UObject::GObjObjects()->Data[ 37701 ];
+		return {};
 
 	USFXOnlineComponentBlazeStats_execReadOnlineStats_Parms ReadOnlineStats_Parms;
 	ReadOnlineStats_Parms.StatsRead = StatsRead;
@@ -25896,10 +24750,9 @@ bool USFXOnlineComponentBlazeStats::ReadOnlineStats ( class UOnlineStatsRead* St
 
 void USFXOnlineComponentBlazeStats::ClearFlushOnlineStatsCompleteDelegate ( struct FScriptDelegate FlushOnlineStatsCompleteDelegate )
 {
-	static UFunction* pFnClearFlushOnlineStatsCompleteDelegate = NULL;
-
+	UFunction* pFnClearFlushOnlineStatsCompleteDelegate = (UFunction*) SdkBindings::Get ( 3534 );
 	if ( ! pFnClearFlushOnlineStatsCompleteDelegate )
-		pFnClearFlushOnlineStatsCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 37699 ];
+		return;
 
 	USFXOnlineComponentBlazeStats_execClearFlushOnlineStatsCompleteDelegate_Parms ClearFlushOnlineStatsCompleteDelegate_Parms;
 	memcpy ( &ClearFlushOnlineStatsCompleteDelegate_Parms.FlushOnlineStatsCompleteDelegate, &FlushOnlineStatsCompleteDelegate, 0xC );
@@ -25914,10 +24767,9 @@ void USFXOnlineComponentBlazeStats::ClearFlushOnlineStatsCompleteDelegate ( stru
 
 void USFXOnlineComponentBlazeStats::AddFlushOnlineStatsCompleteDelegate ( struct FScriptDelegate FlushOnlineStatsCompleteDelegate )
 {
-	static UFunction* pFnAddFlushOnlineStatsCompleteDelegate = NULL;
-
+	UFunction* pFnAddFlushOnlineStatsCompleteDelegate = (UFunction*) SdkBindings::Get ( 3533 );
 	if ( ! pFnAddFlushOnlineStatsCompleteDelegate )
-		pFnAddFlushOnlineStatsCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 37697 ];
+		return;
 
 	USFXOnlineComponentBlazeStats_execAddFlushOnlineStatsCompleteDelegate_Parms AddFlushOnlineStatsCompleteDelegate_Parms;
 	memcpy ( &AddFlushOnlineStatsCompleteDelegate_Parms.FlushOnlineStatsCompleteDelegate, &FlushOnlineStatsCompleteDelegate, 0xC );
@@ -25933,10 +24785,9 @@ void USFXOnlineComponentBlazeStats::AddFlushOnlineStatsCompleteDelegate ( struct
 
 int USFXOnlineComponentBlazeStats::ReadStatsGroupList ( struct FScriptDelegate funcReadStatsGroupListCompleted )
 {
-	static UFunction* pFnReadStatsGroupList = NULL;
-
+	UFunction* pFnReadStatsGroupList = (UFunction*) SdkBindings::Get ( 3531 );
 	if ( ! pFnReadStatsGroupList )
-		pFnReadStatsGroupList = (UFunction*) UObject::GObjObjects()->Data[ 37693 ];
+		return {};
 
 	USFXOnlineComponentBlazeStats_execReadStatsGroupList_Parms ReadStatsGroupList_Parms;
 	memcpy ( &ReadStatsGroupList_Parms.funcReadStatsGroupListCompleted, &funcReadStatsGroupListCompleted, 0xC );
@@ -25956,10 +24807,9 @@ int USFXOnlineComponentBlazeStats::ReadStatsGroupList ( struct FScriptDelegate f
 
 void USFXOnlineComponentBlazeStats::RequestReadStatsGroupList ( )
 {
-	static UFunction* pFnRequestReadStatsGroupList = NULL;
-
+	UFunction* pFnRequestReadStatsGroupList = (UFunction*) SdkBindings::Get ( 3530 );
 	if ( ! pFnRequestReadStatsGroupList )
-		pFnRequestReadStatsGroupList = (UFunction*) UObject::GObjObjects()->Data[ 37692 ];
+		return;
 
 	USFXOnlineComponentBlazeStats_execRequestReadStatsGroupList_Parms RequestReadStatsGroupList_Parms;
 
@@ -25981,10 +24831,9 @@ void USFXOnlineComponentBlazeStats::RequestReadStatsGroupList ( )
 
 int USFXOnlineComponentBlazeStats::GetFriendsStatsData ( int nRankRange, struct FScriptDelegate funcResultsRetrieved, struct FPointer pExternalData, struct FLeaderboardStatScope* oScope )
 {
-	static UFunction* pFnGetFriendsStatsData = NULL;
-
+	UFunction* pFnGetFriendsStatsData = (UFunction*) SdkBindings::Get ( 3528 );
 	if ( ! pFnGetFriendsStatsData )
-		pFnGetFriendsStatsData = (UFunction*) UObject::GObjObjects()->Data[ 37685 ];
+		return {};
 
 	USFXOnlineComponentBlazeStats_execGetFriendsStatsData_Parms GetFriendsStatsData_Parms;
 	GetFriendsStatsData_Parms.nRankRange = nRankRange;
@@ -26011,10 +24860,9 @@ int USFXOnlineComponentBlazeStats::GetFriendsStatsData ( int nRankRange, struct
 
 bool USFXOnlineComponentBlazeStats::GetStatsGroupNames ( TArray< struct FString >* aStatsGroupNames )
 {
-	static UFunction* pFnGetStatsGroupNames = NULL;
-
+	UFunction* pFnGetStatsGroupNames = (UFunction*) SdkBindings::Get ( 3527 );
 	if ( ! pFnGetStatsGroupNames )
-		pFnGetStatsGroupNames = (UFunction*) UObject::GObjObjects()->Data[ 37681 ];
+		return {};
 
 	USFXOnlineComponentBlazeStats_execGetStatsGroupNames_Parms GetStatsGroupNames_Parms;
 
@@ -26038,10 +24886,9 @@ bool USFXOnlineComponentBlazeStats::GetStatsGroupNames ( TArray< struct FString
 
 bool USFXOnlineComponentBlazeStats::FlushOnlineStats ( struct FName SessionName )
 {
-	static UFunction* pFnFlushOnlineStats = NULL;
-
+	UFunction* pFnFlushOnlineStats = (UFunction*) SdkBindings::Get ( 3526 );
 	if ( ! pFnFlushOnlineStats )
-		pFnFlushOnlineStats = (UFunction*) UObject::GObjObjects()->Data[ 37678 ];
+		return {};
 
 	USFXOnlineComponentBlazeStats_execFlushOnlineStats_Parms FlushOnlineStats_Parms;
 	memcpy ( &FlushOnlineStats_Parms.SessionName, &SessionName, 0x8 );
@@ -26065,10 +24912,9 @@ bool USFXOnlineComponentBlazeStats::FlushOnlineStats ( struct FName SessionName
 
 bool USFXOnlineComponentBlazeStats::WriteOnlineStats ( struct FName SessionName, struct FUniqueNetId Player, class UOnlineStatsWrite* StatsWrite )
 {
-	static UFunction* pFnWriteOnlineStats = NULL;
-
+	UFunction* pFnWriteOnlineStats = (UFunction*) SdkBindings::Get ( 3525 );
 	if ( ! pFnWriteOnlineStats )
-		pFnWriteOnlineStats = (UFunction*) UObject::GObjObjects()->Data[ 37673 ];
+		return {};
 
 	USFXOnlineComponentBlazeStats_execWriteOnlineStats_Parms WriteOnlineStats_Parms;
 	memcpy ( &WriteOnlineStats_Parms.SessionName, &SessionName, 0x8 );
@@ -26091,10 +24937,9 @@ bool USFXOnlineComponentBlazeStats::WriteOnlineStats ( struct FName SessionName,
 
 struct FName USFXOnlineComponentBlazeStats::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3524 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 37671 ];
+		return {};
 
 	USFXOnlineComponentBlazeStats_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -26113,10 +24958,9 @@ struct FName USFXOnlineComponentBlazeStats::GetAPIName ( )
 
 void USFXOnlineComponentBlazeStats::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3523 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 37670 ];
+		return;
 
 	USFXOnlineComponentBlazeStats_execOnRelease_Parms OnRelease_Parms;
 
@@ -26134,10 +24978,9 @@ void USFXOnlineComponentBlazeStats::OnRelease ( )
 
 void USFXOnlineComponentBlazeStats::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3522 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 37668 ];
+		return;
 
 	USFXOnlineComponentBlazeStats_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -26156,10 +24999,9 @@ void USFXOnlineComponentBlazeStats::OnInitialize ( class USFXOnlineSubsystem* oO
 
 void USFXOnlineComponentBlazeStats::OnRegisterHostStatGuidComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnRegisterHostStatGuidComplete = NULL;
-
+	UFunction* pFnOnRegisterHostStatGuidComplete = (UFunction*) SdkBindings::Get ( 3521 );
 	if ( ! pFnOnRegisterHostStatGuidComplete )
-		pFnOnRegisterHostStatGuidComplete = (UFunction*) UObject::GObjObjects()->Data[ 37666 ];
+		return;
 
 	USFXOnlineComponentBlazeStats_execOnRegisterHostStatGuidComplete_Parms OnRegisterHostStatGuidComplete_Parms;
 	OnRegisterHostStatGuidComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -26174,10 +25016,9 @@ void USFXOnlineComponentBlazeStats::OnRegisterHostStatGuidComplete ( unsigned lo
 
 void USFXOnlineComponentBlazeStats::OnReadOnlineStatsComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnReadOnlineStatsComplete = NULL;
-
+	UFunction* pFnOnReadOnlineStatsComplete = (UFunction*) SdkBindings::Get ( 3520 );
 	if ( ! pFnOnReadOnlineStatsComplete )
-		pFnOnReadOnlineStatsComplete = (UFunction*) UObject::GObjObjects()->Data[ 37664 ];
+		return;
 
 	USFXOnlineComponentBlazeStats_execOnReadOnlineStatsComplete_Parms OnReadOnlineStatsComplete_Parms;
 	OnReadOnlineStatsComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -26193,10 +25034,9 @@ void USFXOnlineComponentBlazeStats::OnReadOnlineStatsComplete ( unsigned long bW
 
 void USFXOnlineComponentBlazeStats::OnFlushOnlineStatsComplete ( struct FName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnFlushOnlineStatsComplete = NULL;
-
+	UFunction* pFnOnFlushOnlineStatsComplete = (UFunction*) SdkBindings::Get ( 3519 );
 	if ( ! pFnOnFlushOnlineStatsComplete )
-		pFnOnFlushOnlineStatsComplete = (UFunction*) UObject::GObjObjects()->Data[ 37663 ];
+		return;
 
 	USFXOnlineComponentBlazeStats_execOnFlushOnlineStatsComplete_Parms OnFlushOnlineStatsComplete_Parms;
 	memcpy ( &OnFlushOnlineStatsComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -26212,10 +25052,9 @@ void USFXOnlineComponentBlazeStats::OnFlushOnlineStatsComplete ( struct FName Se
 
 void USFXOnlineComponentBlazeStats::OnGetRankNotifications ( unsigned char errorCode )
 {
-	static UFunction* pFnOnGetRankNotifications = NULL;
-
+	UFunction* pFnOnGetRankNotifications = (UFunction*) SdkBindings::Get ( 3553 );
 	if ( ! pFnOnGetRankNotifications )
-		pFnOnGetRankNotifications = (UFunction*) UObject::GObjObjects()->Data[ 37768 ];
+		return;
 
 	USFXOnlineComponentBlazeStats_execOnGetRankNotifications_Parms OnGetRankNotifications_Parms;
 	OnGetRankNotifications_Parms.errorCode = errorCode;
@@ -26230,10 +25069,9 @@ void USFXOnlineComponentBlazeStats::OnGetRankNotifications ( unsigned char error
 
 void USFXOnlineComponentBlazeStats::OnReadStatsGroupListCompleted ( unsigned char errorCode )
 {
-	static UFunction* pFnOnReadStatsGroupListCompleted = NULL;
-
+	UFunction* pFnOnReadStatsGroupListCompleted = (UFunction*) SdkBindings::Get ( 3532 );
 	if ( ! pFnOnReadStatsGroupListCompleted )
-		pFnOnReadStatsGroupListCompleted = (UFunction*) UObject::GObjObjects()->Data[ 37696 ];
+		return;
 
 	USFXOnlineComponentBlazeStats_execOnReadStatsGroupListCompleted_Parms OnReadStatsGroupListCompleted_Parms;
 	OnReadStatsGroupListCompleted_Parms.errorCode = errorCode;
@@ -26251,10 +25089,9 @@ void USFXOnlineComponentBlazeStats::OnReadStatsGroupListCompleted ( unsigned cha
 
 void USFXOnlineComponentBlazeStats::OnResultsRetrieved ( TArray< struct FLeaderboardColumn > aColumnInfo, TArray< struct FLeaderboardRecord > aResults, unsigned char nErrorCode, struct FPointer pExternalData )
 {
-	static UFunction* pFnOnResultsRetrieved = NULL;
-
+	UFunction* pFnOnResultsRetrieved = (UFunction*) SdkBindings::Get ( 3529 );
 	if ( ! pFnOnResultsRetrieved )
-		pFnOnResultsRetrieved = (UFunction*) UObject::GObjObjects()->Data[ 37689 ];
+		return;
 
 	USFXOnlineComponentBlazeStats_execOnResultsRetrieved_Parms OnResultsRetrieved_Parms;
 	memcpy ( &OnResultsRetrieved_Parms.aColumnInfo, &aColumnInfo, 0xC );
@@ -26275,10 +25112,9 @@ void USFXOnlineComponentBlazeStats::OnResultsRetrieved ( TArray< struct FLeaderb
 
 void USFXOnlineComponentGalaxyAtWar::TestGetRatingsCallback ( TArray< int > updatedSecurityRatings, TArray< int > updatedWarAssets, int Level, int errorCode )
 {
-	static UFunction* pFnTestGetRatingsCallback = NULL;
-
+	UFunction* pFnTestGetRatingsCallback = (UFunction*) SdkBindings::Get ( 3669 );
 	if ( ! pFnTestGetRatingsCallback )
-		pFnTestGetRatingsCallback = (UFunction*) UObject::GObjObjects()->Data[ 38238 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execTestGetRatingsCallback_Parms TestGetRatingsCallback_Parms;
 	memcpy ( &TestGetRatingsCallback_Parms.updatedSecurityRatings, &updatedSecurityRatings, 0xC );
@@ -26297,10 +25133,9 @@ void USFXOnlineComponentGalaxyAtWar::TestGetRatingsCallback ( TArray< int > upda
 
 void USFXOnlineComponentGalaxyAtWar::TestTouchMessagesCallback ( int Count, int errorCode )
 {
-	static UFunction* pFnTestTouchMessagesCallback = NULL;
-
+	UFunction* pFnTestTouchMessagesCallback = (UFunction*) SdkBindings::Get ( 3668 );
 	if ( ! pFnTestTouchMessagesCallback )
-		pFnTestTouchMessagesCallback = (UFunction*) UObject::GObjObjects()->Data[ 38235 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execTestTouchMessagesCallback_Parms TestTouchMessagesCallback_Parms;
 	TestTouchMessagesCallback_Parms.Count = Count;
@@ -26317,10 +25152,9 @@ void USFXOnlineComponentGalaxyAtWar::TestTouchMessagesCallback ( int Count, int
 
 void USFXOnlineComponentGalaxyAtWar::TestGetMessagesCallback ( TArray< struct FMessageEntry > Messages, int errorCode )
 {
-	static UFunction* pFnTestGetMessagesCallback = NULL;
-
+	UFunction* pFnTestGetMessagesCallback = (UFunction*) SdkBindings::Get ( 3667 );
 	if ( ! pFnTestGetMessagesCallback )
-		pFnTestGetMessagesCallback = (UFunction*) UObject::GObjObjects()->Data[ 38230 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execTestGetMessagesCallback_Parms TestGetMessagesCallback_Parms;
 	memcpy ( &TestGetMessagesCallback_Parms.Messages, &Messages, 0xC );
@@ -26338,10 +25172,9 @@ void USFXOnlineComponentGalaxyAtWar::TestGetMessagesCallback ( TArray< struct FM
 
 void USFXOnlineComponentGalaxyAtWar::TestSendMessageCallback ( int messageId, TArray< int > messageIds, int errorCode )
 {
-	static UFunction* pFnTestSendMessageCallback = NULL;
-
+	UFunction* pFnTestSendMessageCallback = (UFunction*) SdkBindings::Get ( 3666 );
 	if ( ! pFnTestSendMessageCallback )
-		pFnTestSendMessageCallback = (UFunction*) UObject::GObjObjects()->Data[ 38224 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execTestSendMessageCallback_Parms TestSendMessageCallback_Parms;
 	TestSendMessageCallback_Parms.messageId = messageId;
@@ -26360,10 +25193,9 @@ void USFXOnlineComponentGalaxyAtWar::TestSendMessageCallback ( int messageId, TA
 
 void USFXOnlineComponentGalaxyAtWar::eventParseTouchMessagesResult ( class USFXOnlineHTTPRequest* request, int* numMsgs, int* errorCode )
 {
-	static UFunction* pFnParseTouchMessagesResult = NULL;
-
+	UFunction* pFnParseTouchMessagesResult = (UFunction*) SdkBindings::Get ( 3665 );
 	if ( ! pFnParseTouchMessagesResult )
-		pFnParseTouchMessagesResult = (UFunction*) UObject::GObjObjects()->Data[ 38216 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_eventParseTouchMessagesResult_Parms ParseTouchMessagesResult_Parms;
 	ParseTouchMessagesResult_Parms.request = request;
@@ -26386,10 +25218,9 @@ void USFXOnlineComponentGalaxyAtWar::eventParseTouchMessagesResult ( class USFXO
 
 void USFXOnlineComponentGalaxyAtWar::eventParseGetMessagesResult ( class USFXOnlineHTTPRequest* request, TArray< struct FMessageEntry >* messageEntries, int* errorCode )
 {
-	static UFunction* pFnParseGetMessagesResult = NULL;
-
+	UFunction* pFnParseGetMessagesResult = (UFunction*) SdkBindings::Get ( 3664 );
 	if ( ! pFnParseGetMessagesResult )
-		pFnParseGetMessagesResult = (UFunction*) UObject::GObjObjects()->Data[ 38205 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_eventParseGetMessagesResult_Parms ParseGetMessagesResult_Parms;
 	ParseGetMessagesResult_Parms.request = request;
@@ -26413,10 +25244,9 @@ void USFXOnlineComponentGalaxyAtWar::eventParseGetMessagesResult ( class USFXOnl
 
 void USFXOnlineComponentGalaxyAtWar::eventParseSendMessageResult ( class USFXOnlineHTTPRequest* request, int* messageId, TArray< int >* messageIds, int* errorCode )
 {
-	static UFunction* pFnParseSendMessageResult = NULL;
-
+	UFunction* pFnParseSendMessageResult = (UFunction*) SdkBindings::Get ( 3663 );
 	if ( ! pFnParseSendMessageResult )
-		pFnParseSendMessageResult = (UFunction*) UObject::GObjObjects()->Data[ 38193 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_eventParseSendMessageResult_Parms ParseSendMessageResult_Parms;
 	ParseSendMessageResult_Parms.request = request;
@@ -26444,10 +25274,9 @@ void USFXOnlineComponentGalaxyAtWar::eventParseSendMessageResult ( class USFXOnl
 
 void USFXOnlineComponentGalaxyAtWar::eventParseHTTPRatingsAssetsLevel ( class USFXOnlineHTTPRequest* request, TArray< int >* updatedSecurityRatings, TArray< int >* updatedWarAssets, int* Level, int* errorCode )
 {
-	static UFunction* pFnParseHTTPRatingsAssetsLevel = NULL;
-
+	UFunction* pFnParseHTTPRatingsAssetsLevel = (UFunction*) SdkBindings::Get ( 3662 );
 	if ( ! pFnParseHTTPRatingsAssetsLevel )
-		pFnParseHTTPRatingsAssetsLevel = (UFunction*) UObject::GObjObjects()->Data[ 38175 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_eventParseHTTPRatingsAssetsLevel_Parms ParseHTTPRatingsAssetsLevel_Parms;
 	ParseHTTPRatingsAssetsLevel_Parms.request = request;
@@ -26475,10 +25304,9 @@ void USFXOnlineComponentGalaxyAtWar::eventParseHTTPRatingsAssetsLevel ( class US
 
 int USFXOnlineComponentGalaxyAtWar::eventParseAuthenticationResult ( class USFXOnlineHTTPRequest* request )
 {
-	static UFunction* pFnParseAuthenticationResult = NULL;
-
+	UFunction* pFnParseAuthenticationResult = (UFunction*) SdkBindings::Get ( 3658 );
 	if ( ! pFnParseAuthenticationResult )
-		pFnParseAuthenticationResult = (UFunction*) UObject::GObjObjects()->Data[ 38157 ];
+		return {};
 
 	USFXOnlineComponentGalaxyAtWar_eventParseAuthenticationResult_Parms ParseAuthenticationResult_Parms;
 	ParseAuthenticationResult_Parms.request = request;
@@ -26494,10 +25322,9 @@ int USFXOnlineComponentGalaxyAtWar::eventParseAuthenticationResult ( class USFXO
 
 void USFXOnlineComponentGalaxyAtWar::eventInvalidateSession ( )
 {
-	static UFunction* pFnInvalidateSession = NULL;
-
+	UFunction* pFnInvalidateSession = (UFunction*) SdkBindings::Get ( 3657 );
 	if ( ! pFnInvalidateSession )
-		pFnInvalidateSession = (UFunction*) UObject::GObjObjects()->Data[ 38156 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_eventInvalidateSession_Parms InvalidateSession_Parms;
 
@@ -26511,10 +25338,9 @@ void USFXOnlineComponentGalaxyAtWar::eventInvalidateSession ( )
 
 bool USFXOnlineComponentGalaxyAtWar::eventIsSessionValid ( )
 {
-	static UFunction* pFnIsSessionValid = NULL;
-
+	UFunction* pFnIsSessionValid = (UFunction*) SdkBindings::Get ( 3656 );
 	if ( ! pFnIsSessionValid )
-		pFnIsSessionValid = (UFunction*) UObject::GObjObjects()->Data[ 38153 ];
+		return {};
 
 	USFXOnlineComponentGalaxyAtWar_eventIsSessionValid_Parms IsSessionValid_Parms;
 
@@ -26532,10 +25358,9 @@ bool USFXOnlineComponentGalaxyAtWar::eventIsSessionValid ( )
 
 class USFXOnlineJobGaWHTTPTouchMessages* USFXOnlineComponentGalaxyAtWar::eventCreateJobGaWTouchMessages ( int msgType, struct FScriptDelegate funcOnRequestComplete )
 {
-	static UFunction* pFnCreateJobGaWTouchMessages = NULL;
-
+	UFunction* pFnCreateJobGaWTouchMessages = (UFunction*) SdkBindings::Get ( 3654 );
 	if ( ! pFnCreateJobGaWTouchMessages )
-		pFnCreateJobGaWTouchMessages = (UFunction*) UObject::GObjObjects()->Data[ 38147 ];
+		return {};
 
 	USFXOnlineComponentGalaxyAtWar_eventCreateJobGaWTouchMessages_Parms CreateJobGaWTouchMessages_Parms;
 	CreateJobGaWTouchMessages_Parms.msgType = msgType;
@@ -26555,10 +25380,9 @@ class USFXOnlineJobGaWHTTPTouchMessages* USFXOnlineComponentGalaxyAtWar::eventCr
 
 class USFXOnlineJobGaWHTTPGetMessages* USFXOnlineComponentGalaxyAtWar::eventCreateJobGaWGetMessages ( int msgType, struct FScriptDelegate funcOnRequestComplete )
 {
-	static UFunction* pFnCreateJobGaWGetMessages = NULL;
-
+	UFunction* pFnCreateJobGaWGetMessages = (UFunction*) SdkBindings::Get ( 3652 );
 	if ( ! pFnCreateJobGaWGetMessages )
-		pFnCreateJobGaWGetMessages = (UFunction*) UObject::GObjObjects()->Data[ 38141 ];
+		return {};
 
 	USFXOnlineComponentGalaxyAtWar_eventCreateJobGaWGetMessages_Parms CreateJobGaWGetMessages_Parms;
 	CreateJobGaWGetMessages_Parms.msgType = msgType;
@@ -26581,10 +25405,9 @@ class USFXOnlineJobGaWHTTPGetMessages* USFXOnlineComponentGalaxyAtWar::eventCrea
 
 class USFXOnlineJobGaWHTTPSendMessage* USFXOnlineComponentGalaxyAtWar::eventCreateJobGaWSendMessage ( int msgType, struct FString sendMsgParam1, struct FString sendMsgParam2, struct FString sendMsgParam3, struct FScriptDelegate funcOnRequestComplete )
 {
-	static UFunction* pFnCreateJobGaWSendMessage = NULL;
-
+	UFunction* pFnCreateJobGaWSendMessage = (UFunction*) SdkBindings::Get ( 3650 );
 	if ( ! pFnCreateJobGaWSendMessage )
-		pFnCreateJobGaWSendMessage = (UFunction*) UObject::GObjObjects()->Data[ 38132 ];
+		return {};
 
 	USFXOnlineComponentGalaxyAtWar_eventCreateJobGaWSendMessage_Parms CreateJobGaWSendMessage_Parms;
 	CreateJobGaWSendMessage_Parms.msgType = msgType;
@@ -26609,10 +25432,9 @@ class USFXOnlineJobGaWHTTPSendMessage* USFXOnlineComponentGalaxyAtWar::eventCrea
 
 class USFXOnlineJobGaWHTTPIncreaseRatings* USFXOnlineComponentGalaxyAtWar::eventCreateJobGaWIncreaseRatings ( int defaultRatingIncrease, TArray< struct FMapEntry > securityRatingIncrease, TArray< struct FMapEntry > warAssetIncrease, struct FScriptDelegate funcOnRequestComplete )
 {
-	static UFunction* pFnCreateJobGaWIncreaseRatings = NULL;
-
+	UFunction* pFnCreateJobGaWIncreaseRatings = (UFunction*) SdkBindings::Get ( 3648 );
 	if ( ! pFnCreateJobGaWIncreaseRatings )
-		pFnCreateJobGaWIncreaseRatings = (UFunction*) UObject::GObjObjects()->Data[ 38122 ];
+		return {};
 
 	USFXOnlineComponentGalaxyAtWar_eventCreateJobGaWIncreaseRatings_Parms CreateJobGaWIncreaseRatings_Parms;
 	CreateJobGaWIncreaseRatings_Parms.defaultRatingIncrease = defaultRatingIncrease;
@@ -26634,10 +25456,9 @@ class USFXOnlineJobGaWHTTPIncreaseRatings* USFXOnlineComponentGalaxyAtWar::event
 
 class USFXOnlineJobGaWHTTPGetRatings* USFXOnlineComponentGalaxyAtWar::eventCreateJobGaWGetRatings ( unsigned long getWarAssets, struct FScriptDelegate funcOnRequestComplete )
 {
-	static UFunction* pFnCreateJobGaWGetRatings = NULL;
-
+	UFunction* pFnCreateJobGaWGetRatings = (UFunction*) SdkBindings::Get ( 3646 );
 	if ( ! pFnCreateJobGaWGetRatings )
-		pFnCreateJobGaWGetRatings = (UFunction*) UObject::GObjObjects()->Data[ 38116 ];
+		return {};
 
 	USFXOnlineComponentGalaxyAtWar_eventCreateJobGaWGetRatings_Parms CreateJobGaWGetRatings_Parms;
 	CreateJobGaWGetRatings_Parms.getWarAssets = getWarAssets;
@@ -26655,10 +25476,9 @@ class USFXOnlineJobGaWHTTPGetRatings* USFXOnlineComponentGalaxyAtWar::eventCreat
 
 void USFXOnlineComponentGalaxyAtWar::eventSetBaseURL ( struct FString sURL )
 {
-	static UFunction* pFnSetBaseURL = NULL;
-
+	UFunction* pFnSetBaseURL = (UFunction*) SdkBindings::Get ( 3645 );
 	if ( ! pFnSetBaseURL )
-		pFnSetBaseURL = (UFunction*) UObject::GObjObjects()->Data[ 38113 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_eventSetBaseURL_Parms SetBaseURL_Parms;
 	memcpy ( &SetBaseURL_Parms.sURL, &sURL, 0xC );
@@ -26672,10 +25492,9 @@ void USFXOnlineComponentGalaxyAtWar::eventSetBaseURL ( struct FString sURL )
 
 void USFXOnlineComponentGalaxyAtWar::Cleanup ( )
 {
-	static UFunction* pFnCleanup = NULL;
-
+	UFunction* pFnCleanup = (UFunction*) SdkBindings::Get ( 3644 );
 	if ( ! pFnCleanup )
-		pFnCleanup = (UFunction*) UObject::GObjObjects()->Data[ 38112 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execCleanup_Parms Cleanup_Parms;
 
@@ -26693,10 +25512,9 @@ void USFXOnlineComponentGalaxyAtWar::Cleanup ( )
 
 struct FName USFXOnlineComponentGalaxyAtWar::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3643 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 38110 ];
+		return {};
 
 	USFXOnlineComponentGalaxyAtWar_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -26715,10 +25533,9 @@ struct FName USFXOnlineComponentGalaxyAtWar::GetAPIName ( )
 
 void USFXOnlineComponentGalaxyAtWar::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3642 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 38109 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execOnRelease_Parms OnRelease_Parms;
 
@@ -26736,10 +25553,9 @@ void USFXOnlineComponentGalaxyAtWar::OnRelease ( )
 
 void USFXOnlineComponentGalaxyAtWar::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3641 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 38107 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -26758,10 +25574,9 @@ void USFXOnlineComponentGalaxyAtWar::OnInitialize ( class USFXOnlineSubsystem* o
 
 int USFXOnlineComponentGalaxyAtWar::GetFirstBlazeAttrId ( )
 {
-	static UFunction* pFnGetFirstBlazeAttrId = NULL;
-
+	UFunction* pFnGetFirstBlazeAttrId = (UFunction*) SdkBindings::Get ( 3640 );
 	if ( ! pFnGetFirstBlazeAttrId )
-		pFnGetFirstBlazeAttrId = (UFunction*) UObject::GObjObjects()->Data[ 38105 ];
+		return {};
 
 	USFXOnlineComponentGalaxyAtWar_execGetFirstBlazeAttrId_Parms GetFirstBlazeAttrId_Parms;
 
@@ -26782,10 +25597,9 @@ int USFXOnlineComponentGalaxyAtWar::GetFirstBlazeAttrId ( )
 
 void USFXOnlineComponentGalaxyAtWar::GetTouchMessagesHTTPRequest ( int msgType, class USFXOnlineHTTPRequest** pSFXOnlineHTTPRequest )
 {
-	static UFunction* pFnGetTouchMessagesHTTPRequest = NULL;
-
+	UFunction* pFnGetTouchMessagesHTTPRequest = (UFunction*) SdkBindings::Get ( 3639 );
 	if ( ! pFnGetTouchMessagesHTTPRequest )
-		pFnGetTouchMessagesHTTPRequest = (UFunction*) UObject::GObjObjects()->Data[ 38102 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execGetTouchMessagesHTTPRequest_Parms GetTouchMessagesHTTPRequest_Parms;
 	GetTouchMessagesHTTPRequest_Parms.msgType = msgType;
@@ -26808,10 +25622,9 @@ void USFXOnlineComponentGalaxyAtWar::GetTouchMessagesHTTPRequest ( int msgType,
 
 void USFXOnlineComponentGalaxyAtWar::GetGetMessagesHTTPRequest ( int msgType, class USFXOnlineHTTPRequest** pSFXOnlineHTTPRequest )
 {
-	static UFunction* pFnGetGetMessagesHTTPRequest = NULL;
-
+	UFunction* pFnGetGetMessagesHTTPRequest = (UFunction*) SdkBindings::Get ( 3638 );
 	if ( ! pFnGetGetMessagesHTTPRequest )
-		pFnGetGetMessagesHTTPRequest = (UFunction*) UObject::GObjObjects()->Data[ 38099 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execGetGetMessagesHTTPRequest_Parms GetGetMessagesHTTPRequest_Parms;
 	GetGetMessagesHTTPRequest_Parms.msgType = msgType;
@@ -26837,10 +25650,9 @@ void USFXOnlineComponentGalaxyAtWar::GetGetMessagesHTTPRequest ( int msgType, cl
 
 void USFXOnlineComponentGalaxyAtWar::GetSendMessageHTTPRequest ( int msgType, struct FString param1, struct FString param2, struct FString param3, class USFXOnlineHTTPRequest** pSFXOnlineHTTPRequest )
 {
-	static UFunction* pFnGetSendMessageHTTPRequest = NULL;
-
+	UFunction* pFnGetSendMessageHTTPRequest = (UFunction*) SdkBindings::Get ( 3637 );
 	if ( ! pFnGetSendMessageHTTPRequest )
-		pFnGetSendMessageHTTPRequest = (UFunction*) UObject::GObjObjects()->Data[ 38093 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execGetSendMessageHTTPRequest_Parms GetSendMessageHTTPRequest_Parms;
 	GetSendMessageHTTPRequest_Parms.msgType = msgType;
@@ -26868,10 +25680,9 @@ void USFXOnlineComponentGalaxyAtWar::GetSendMessageHTTPRequest ( int msgType, st
 
 void USFXOnlineComponentGalaxyAtWar::GetIncreaseRatingsHTTPRequest ( int defaultRatingIncrease, TArray< struct FMapEntry > securityRatingsIncrease, TArray< struct FMapEntry > warAssetsIncrease, class USFXOnlineHTTPRequest** pSFXOnlineHTTPRequest )
 {
-	static UFunction* pFnGetIncreaseRatingsHTTPRequest = NULL;
-
+	UFunction* pFnGetIncreaseRatingsHTTPRequest = (UFunction*) SdkBindings::Get ( 3636 );
 	if ( ! pFnGetIncreaseRatingsHTTPRequest )
-		pFnGetIncreaseRatingsHTTPRequest = (UFunction*) UObject::GObjObjects()->Data[ 38086 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execGetIncreaseRatingsHTTPRequest_Parms GetIncreaseRatingsHTTPRequest_Parms;
 	GetIncreaseRatingsHTTPRequest_Parms.defaultRatingIncrease = defaultRatingIncrease;
@@ -26896,10 +25707,9 @@ void USFXOnlineComponentGalaxyAtWar::GetIncreaseRatingsHTTPRequest ( int default
 
 void USFXOnlineComponentGalaxyAtWar::GetRatingsHTTPRequest ( unsigned long getAssets, class USFXOnlineHTTPRequest** pSFXOnlineHTTPRequest )
 {
-	static UFunction* pFnGetRatingsHTTPRequest = NULL;
-
+	UFunction* pFnGetRatingsHTTPRequest = (UFunction*) SdkBindings::Get ( 3635 );
 	if ( ! pFnGetRatingsHTTPRequest )
-		pFnGetRatingsHTTPRequest = (UFunction*) UObject::GObjObjects()->Data[ 38083 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execGetRatingsHTTPRequest_Parms GetRatingsHTTPRequest_Parms;
 	GetRatingsHTTPRequest_Parms.getAssets = getAssets;
@@ -26923,10 +25733,9 @@ void USFXOnlineComponentGalaxyAtWar::GetRatingsHTTPRequest ( unsigned long getAs
 
 void USFXOnlineComponentGalaxyAtWar::GetAuthenticationHTTPRequest ( struct FString token, int tokenType, class USFXOnlineHTTPRequest** pSFXOnlineHTTPRequest )
 {
-	static UFunction* pFnGetAuthenticationHTTPRequest = NULL;
-
+	UFunction* pFnGetAuthenticationHTTPRequest = (UFunction*) SdkBindings::Get ( 3634 );
 	if ( ! pFnGetAuthenticationHTTPRequest )
-		pFnGetAuthenticationHTTPRequest = (UFunction*) UObject::GObjObjects()->Data[ 38079 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execGetAuthenticationHTTPRequest_Parms GetAuthenticationHTTPRequest_Parms;
 	memcpy ( &GetAuthenticationHTTPRequest_Parms.token, &token, 0xC );
@@ -26950,10 +25759,9 @@ void USFXOnlineComponentGalaxyAtWar::GetAuthenticationHTTPRequest ( struct FStri
 
 void USFXOnlineComponentGalaxyAtWar::TouchMessages ( int msgType, struct FScriptDelegate funcOnRequestComplete )
 {
-	static UFunction* pFnTouchMessages = NULL;
-
+	UFunction* pFnTouchMessages = (UFunction*) SdkBindings::Get ( 3633 );
 	if ( ! pFnTouchMessages )
-		pFnTouchMessages = (UFunction*) UObject::GObjObjects()->Data[ 38076 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execTouchMessages_Parms TouchMessages_Parms;
 	TouchMessages_Parms.msgType = msgType;
@@ -26974,10 +25782,9 @@ void USFXOnlineComponentGalaxyAtWar::TouchMessages ( int msgType, struct FScript
 
 void USFXOnlineComponentGalaxyAtWar::GetMessages ( int msgType, struct FScriptDelegate funcOnRequestComplete )
 {
-	static UFunction* pFnGetMessages = NULL;
-
+	UFunction* pFnGetMessages = (UFunction*) SdkBindings::Get ( 3632 );
 	if ( ! pFnGetMessages )
-		pFnGetMessages = (UFunction*) UObject::GObjObjects()->Data[ 38073 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execGetMessages_Parms GetMessages_Parms;
 	GetMessages_Parms.msgType = msgType;
@@ -27001,10 +25808,9 @@ void USFXOnlineComponentGalaxyAtWar::GetMessages ( int msgType, struct FScriptDe
 
 void USFXOnlineComponentGalaxyAtWar::SendMessage ( int msgType, struct FString sendMsgParam1, unsigned char ParamType, struct FString sendMsgParam3, struct FScriptDelegate OnSendMessageComplete )
 {
-	static UFunction* pFnSendMessage = NULL;
-
+	UFunction* pFnSendMessage = (UFunction*) SdkBindings::Get ( 3631 );
 	if ( ! pFnSendMessage )
-		pFnSendMessage = (UFunction*) UObject::GObjObjects()->Data[ 38067 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execSendMessage_Parms SendMessage_Parms;
 	SendMessage_Parms.msgType = msgType;
@@ -27030,10 +25836,9 @@ void USFXOnlineComponentGalaxyAtWar::SendMessage ( int msgType, struct FString s
 
 void USFXOnlineComponentGalaxyAtWar::IncreaseRatings ( int defaultRatingIncrease, TArray< struct FMapEntry > securityRatingIncrease, TArray< struct FMapEntry > warAssetIncrease, struct FScriptDelegate funcOnRequestComplete )
 {
-	static UFunction* pFnIncreaseRatings = NULL;
-
+	UFunction* pFnIncreaseRatings = (UFunction*) SdkBindings::Get ( 3630 );
 	if ( ! pFnIncreaseRatings )
-		pFnIncreaseRatings = (UFunction*) UObject::GObjObjects()->Data[ 38060 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execIncreaseRatings_Parms IncreaseRatings_Parms;
 	IncreaseRatings_Parms.defaultRatingIncrease = defaultRatingIncrease;
@@ -27057,10 +25862,9 @@ void USFXOnlineComponentGalaxyAtWar::IncreaseRatings ( int defaultRatingIncrease
 
 void USFXOnlineComponentGalaxyAtWar::GetRatings ( unsigned long getWarAssets, unsigned long bCached, struct FScriptDelegate funcOnRequestComplete )
 {
-	static UFunction* pFnGetRatings = NULL;
-
+	UFunction* pFnGetRatings = (UFunction*) SdkBindings::Get ( 3629 );
 	if ( ! pFnGetRatings )
-		pFnGetRatings = (UFunction*) UObject::GObjObjects()->Data[ 38056 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execGetRatings_Parms GetRatings_Parms;
 	GetRatings_Parms.getWarAssets = getWarAssets;
@@ -27082,10 +25886,9 @@ void USFXOnlineComponentGalaxyAtWar::GetRatings ( unsigned long getWarAssets, un
 
 void USFXOnlineComponentGalaxyAtWar::OnTouchMessagesComplete ( int Count, int errorCode )
 {
-	static UFunction* pFnOnTouchMessagesComplete = NULL;
-
+	UFunction* pFnOnTouchMessagesComplete = (UFunction*) SdkBindings::Get ( 3628 );
 	if ( ! pFnOnTouchMessagesComplete )
-		pFnOnTouchMessagesComplete = (UFunction*) UObject::GObjObjects()->Data[ 38053 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execOnTouchMessagesComplete_Parms OnTouchMessagesComplete_Parms;
 	OnTouchMessagesComplete_Parms.Count = Count;
@@ -27102,10 +25905,9 @@ void USFXOnlineComponentGalaxyAtWar::OnTouchMessagesComplete ( int Count, int er
 
 void USFXOnlineComponentGalaxyAtWar::OnGetMessagesComplete ( TArray< struct FMessageEntry > Messages, int errorCode )
 {
-	static UFunction* pFnOnGetMessagesComplete = NULL;
-
+	UFunction* pFnOnGetMessagesComplete = (UFunction*) SdkBindings::Get ( 3627 );
 	if ( ! pFnOnGetMessagesComplete )
-		pFnOnGetMessagesComplete = (UFunction*) UObject::GObjObjects()->Data[ 38049 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execOnGetMessagesComplete_Parms OnGetMessagesComplete_Parms;
 	memcpy ( &OnGetMessagesComplete_Parms.Messages, &Messages, 0xC );
@@ -27123,10 +25925,9 @@ void USFXOnlineComponentGalaxyAtWar::OnGetMessagesComplete ( TArray< struct FMes
 
 void USFXOnlineComponentGalaxyAtWar::OnSendMessageComplete ( int messageId, TArray< int > messageIds, int errorCode )
 {
-	static UFunction* pFnOnSendMessageComplete = NULL;
-
+	UFunction* pFnOnSendMessageComplete = (UFunction*) SdkBindings::Get ( 3626 );
 	if ( ! pFnOnSendMessageComplete )
-		pFnOnSendMessageComplete = (UFunction*) UObject::GObjObjects()->Data[ 38044 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execOnSendMessageComplete_Parms OnSendMessageComplete_Parms;
 	OnSendMessageComplete_Parms.messageId = messageId;
@@ -27146,10 +25947,9 @@ void USFXOnlineComponentGalaxyAtWar::OnSendMessageComplete ( int messageId, TArr
 
 void USFXOnlineComponentGalaxyAtWar::OnIncreaseRatingsComplete ( TArray< int > updatedSecurityRatings, TArray< int > updatedWarAssets, int Level, int errorCode )
 {
-	static UFunction* pFnOnIncreaseRatingsComplete = NULL;
-
+	UFunction* pFnOnIncreaseRatingsComplete = (UFunction*) SdkBindings::Get ( 3625 );
 	if ( ! pFnOnIncreaseRatingsComplete )
-		pFnOnIncreaseRatingsComplete = (UFunction*) UObject::GObjObjects()->Data[ 38037 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execOnIncreaseRatingsComplete_Parms OnIncreaseRatingsComplete_Parms;
 	memcpy ( &OnIncreaseRatingsComplete_Parms.updatedSecurityRatings, &updatedSecurityRatings, 0xC );
@@ -27170,10 +25970,9 @@ void USFXOnlineComponentGalaxyAtWar::OnIncreaseRatingsComplete ( TArray< int > u
 
 void USFXOnlineComponentGalaxyAtWar::OnGetRatingsComplete ( TArray< int > updatedSecurityRatings, TArray< int > updatedWarAssets, int Level, int errorCode )
 {
-	static UFunction* pFnOnGetRatingsComplete = NULL;
-
+	UFunction* pFnOnGetRatingsComplete = (UFunction*) SdkBindings::Get ( 3624 );
 	if ( ! pFnOnGetRatingsComplete )
-		pFnOnGetRatingsComplete = (UFunction*) UObject::GObjObjects()->Data[ 38030 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execOnGetRatingsComplete_Parms OnGetRatingsComplete_Parms;
 	memcpy ( &OnGetRatingsComplete_Parms.updatedSecurityRatings, &updatedSecurityRatings, 0xC );
@@ -27191,10 +25990,9 @@ void USFXOnlineComponentGalaxyAtWar::OnGetRatingsComplete ( TArray< int > update
 
 void USFXOnlineComponentGalaxyAtWar::AuthenticateCompleted ( int errorCode )
 {
-	static UFunction* pFnAuthenticateCompleted = NULL;
-
+	UFunction* pFnAuthenticateCompleted = (UFunction*) SdkBindings::Get ( 3623 );
 	if ( ! pFnAuthenticateCompleted )
-		pFnAuthenticateCompleted = (UFunction*) UObject::GObjObjects()->Data[ 38028 ];
+		return;
 
 	USFXOnlineComponentGalaxyAtWar_execAuthenticateCompleted_Parms AuthenticateCompleted_Parms;
 	AuthenticateCompleted_Parms.errorCode = errorCode;
@@ -27209,10 +26007,9 @@ void USFXOnlineComponentGalaxyAtWar::AuthenticateCompleted ( int errorCode )
 
 void USFXOnlineComponentBlazeTelemetry::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
-
+	UFunction* pFnOnTick = (UFunction*) SdkBindings::Get ( 3563 );
 	if ( ! pFnOnTick )
-		pFnOnTick = (UFunction*) UObject::GObjObjects()->Data[ 37811 ];
+		return;
 
 	USFXOnlineComponentBlazeTelemetry_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
@@ -27231,10 +26028,9 @@ void USFXOnlineComponentBlazeTelemetry::OnTick ( class USFXOnlineEvent* oEvent )
 
 void USFXOnlineComponentBlazeTelemetry::Flush ( unsigned char Channel )
 {
-	static UFunction* pFnFlush = NULL;
-
+	UFunction* pFnFlush = (UFunction*) SdkBindings::Get ( 3562 );
 	if ( ! pFnFlush )
-		pFnFlush = (UFunction*) UObject::GObjObjects()->Data[ 37809 ];
+		return;
 
 	USFXOnlineComponentBlazeTelemetry_execFlush_Parms Flush_Parms;
 	Flush_Parms.Channel = Channel;
@@ -27255,10 +26051,9 @@ void USFXOnlineComponentBlazeTelemetry::Flush ( unsigned char Channel )
 
 void USFXOnlineComponentBlazeTelemetry::RegisterConnectionDelegates ( struct FScriptDelegate CollectDelegate, struct FScriptDelegate AuthenticateDelegate, struct FScriptDelegate DisconnectDelegate )
 {
-	static UFunction* pFnRegisterConnectionDelegates = NULL;
-
+	UFunction* pFnRegisterConnectionDelegates = (UFunction*) SdkBindings::Get ( 3561 );
 	if ( ! pFnRegisterConnectionDelegates )
-		pFnRegisterConnectionDelegates = (UFunction*) UObject::GObjObjects()->Data[ 37802 ];
+		return;
 
 	USFXOnlineComponentBlazeTelemetry_execRegisterConnectionDelegates_Parms RegisterConnectionDelegates_Parms;
 	memcpy ( &RegisterConnectionDelegates_Parms.CollectDelegate, &CollectDelegate, 0xC );
@@ -27278,10 +26073,9 @@ void USFXOnlineComponentBlazeTelemetry::RegisterConnectionDelegates ( struct FSc
 
 void USFXOnlineComponentBlazeTelemetry::OnDisconnect ( int Error, int PreviousState, int NewState, struct FString SessionId )
 {
-	static UFunction* pFnOnDisconnect = NULL;
-
+	UFunction* pFnOnDisconnect = (UFunction*) SdkBindings::Get ( 3560 );
 	if ( ! pFnOnDisconnect )
-		pFnOnDisconnect = (UFunction*) UObject::GObjObjects()->Data[ 37797 ];
+		return;
 
 	USFXOnlineComponentBlazeTelemetry_execOnDisconnect_Parms OnDisconnect_Parms;
 	OnDisconnect_Parms.Error = Error;
@@ -27298,10 +26092,9 @@ void USFXOnlineComponentBlazeTelemetry::OnDisconnect ( int Error, int PreviousSt
 
 void USFXOnlineComponentBlazeTelemetry::OnAuthenticate ( )
 {
-	static UFunction* pFnOnAuthenticate = NULL;
-
+	UFunction* pFnOnAuthenticate = (UFunction*) SdkBindings::Get ( 3559 );
 	if ( ! pFnOnAuthenticate )
-		pFnOnAuthenticate = (UFunction*) UObject::GObjObjects()->Data[ 37796 ];
+		return;
 
 	USFXOnlineComponentBlazeTelemetry_execOnAuthenticate_Parms OnAuthenticate_Parms;
 
@@ -27315,10 +26108,9 @@ void USFXOnlineComponentBlazeTelemetry::OnAuthenticate ( )
 
 bool USFXOnlineComponentBlazeTelemetry::CanCollect ( )
 {
-	static UFunction* pFnCanCollect = NULL;
-
+	UFunction* pFnCanCollect = (UFunction*) SdkBindings::Get ( 3558 );
 	if ( ! pFnCanCollect )
-		pFnCanCollect = (UFunction*) UObject::GObjObjects()->Data[ 37794 ];
+		return {};
 
 	USFXOnlineComponentBlazeTelemetry_execCanCollect_Parms CanCollect_Parms;
 
@@ -27334,10 +26126,9 @@ bool USFXOnlineComponentBlazeTelemetry::CanCollect ( )
 
 struct FName USFXOnlineComponentBlazeTelemetry::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3557 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 37792 ];
+		return {};
 
 	USFXOnlineComponentBlazeTelemetry_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -27356,10 +26147,9 @@ struct FName USFXOnlineComponentBlazeTelemetry::GetAPIName ( )
 
 void USFXOnlineComponentBlazeTelemetry::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3556 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 37791 ];
+		return;
 
 	USFXOnlineComponentBlazeTelemetry_execOnRelease_Parms OnRelease_Parms;
 
@@ -27377,10 +26167,9 @@ void USFXOnlineComponentBlazeTelemetry::OnRelease ( )
 
 void USFXOnlineComponentBlazeTelemetry::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3555 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 37789 ];
+		return;
 
 	USFXOnlineComponentBlazeTelemetry_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -27399,10 +26188,9 @@ void USFXOnlineComponentBlazeTelemetry::OnInitialize ( class USFXOnlineSubsystem
 
 void USFXOnlineComponentJobQueue::OnTick ( class USFXOnlineEvent* OnlineEvent )
 {
-	static UFunction* pFnOnTick = NULL;
-
+	UFunction* pFnOnTick = (UFunction*) SdkBindings::Get ( 3768 );
 	if ( ! pFnOnTick )
-		pFnOnTick = (UFunction*) UObject::GObjObjects()->Data[ 38789 ];
+		return;
 
 	USFXOnlineComponentJobQueue_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.OnlineEvent = OnlineEvent;
@@ -27416,10 +26204,9 @@ void USFXOnlineComponentJobQueue::OnTick ( class USFXOnlineEvent* OnlineEvent )
 
 void USFXOnlineComponentJobQueue::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3767 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 38788 ];
+		return;
 
 	USFXOnlineComponentJobQueue_execOnRelease_Parms OnRelease_Parms;
 
@@ -27437,10 +26224,9 @@ void USFXOnlineComponentJobQueue::OnRelease ( )
 
 void USFXOnlineComponentJobQueue::OnInitialize ( class USFXOnlineSubsystem* OnlineSub )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3766 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 38786 ];
+		return;
 
 	USFXOnlineComponentJobQueue_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.OnlineSub = OnlineSub;
@@ -27459,10 +26245,9 @@ void USFXOnlineComponentJobQueue::OnInitialize ( class USFXOnlineSubsystem* Onli
 
 struct FName USFXOnlineComponentJobQueue::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3765 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 38784 ];
+		return {};
 
 	USFXOnlineComponentJobQueue_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -27483,10 +26268,9 @@ struct FName USFXOnlineComponentJobQueue::GetAPIName ( )
 
 bool USFXOnlineComponentJobQueue::eventCancelJob ( int JobId )
 {
-	static UFunction* pFnCancelJob = NULL;
-
+	UFunction* pFnCancelJob = (UFunction*) SdkBindings::Get ( 3764 );
 	if ( ! pFnCancelJob )
-		pFnCancelJob = (UFunction*) UObject::GObjObjects()->Data[ 38778 ];
+		return {};
 
 	USFXOnlineComponentJobQueue_eventCancelJob_Parms CancelJob_Parms;
 	CancelJob_Parms.JobId = JobId;
@@ -27504,10 +26288,9 @@ bool USFXOnlineComponentJobQueue::eventCancelJob ( int JobId )
 
 int USFXOnlineComponentJobQueue::eventCancelJobs ( unsigned char JobType )
 {
-	static UFunction* pFnCancelJobs = NULL;
-
+	UFunction* pFnCancelJobs = (UFunction*) SdkBindings::Get ( 3763 );
 	if ( ! pFnCancelJobs )
-		pFnCancelJobs = (UFunction*) UObject::GObjObjects()->Data[ 38769 ];
+		return {};
 
 	USFXOnlineComponentJobQueue_eventCancelJobs_Parms CancelJobs_Parms;
 	CancelJobs_Parms.JobType = JobType;
@@ -27526,10 +26309,9 @@ int USFXOnlineComponentJobQueue::eventCancelJobs ( unsigned char JobType )
 
 bool USFXOnlineComponentJobQueue::eventCheckForJob ( unsigned char JobType, struct FScriptDelegate Predicate )
 {
-	static UFunction* pFnCheckForJob = NULL;
-
+	UFunction* pFnCheckForJob = (UFunction*) SdkBindings::Get ( 3762 );
 	if ( ! pFnCheckForJob )
-		pFnCheckForJob = (UFunction*) UObject::GObjObjects()->Data[ 38765 ];
+		return {};
 
 	USFXOnlineComponentJobQueue_eventCheckForJob_Parms CheckForJob_Parms;
 	CheckForJob_Parms.JobType = JobType;
@@ -27549,10 +26331,9 @@ bool USFXOnlineComponentJobQueue::eventCheckForJob ( unsigned char JobType, stru
 
 bool USFXOnlineComponentJobQueue::eventCheckForPendingJob ( unsigned char JobType, struct FScriptDelegate Predicate )
 {
-	static UFunction* pFnCheckForPendingJob = NULL;
-
+	UFunction* pFnCheckForPendingJob = (UFunction*) SdkBindings::Get ( 3761 );
 	if ( ! pFnCheckForPendingJob )
-		pFnCheckForPendingJob = (UFunction*) UObject::GObjObjects()->Data[ 38761 ];
+		return {};
 
 	USFXOnlineComponentJobQueue_eventCheckForPendingJob_Parms CheckForPendingJob_Parms;
 	CheckForPendingJob_Parms.JobType = JobType;
@@ -27572,10 +26353,9 @@ bool USFXOnlineComponentJobQueue::eventCheckForPendingJob ( unsigned char JobTyp
 
 bool USFXOnlineComponentJobQueue::eventCheckForProcessingJob ( unsigned char JobType, struct FScriptDelegate Predicate )
 {
-	static UFunction* pFnCheckForProcessingJob = NULL;
-
+	UFunction* pFnCheckForProcessingJob = (UFunction*) SdkBindings::Get ( 3760 );
 	if ( ! pFnCheckForProcessingJob )
-		pFnCheckForProcessingJob = (UFunction*) UObject::GObjObjects()->Data[ 38757 ];
+		return {};
 
 	USFXOnlineComponentJobQueue_eventCheckForProcessingJob_Parms CheckForProcessingJob_Parms;
 	CheckForProcessingJob_Parms.JobType = JobType;
@@ -27596,10 +26376,9 @@ bool USFXOnlineComponentJobQueue::eventCheckForProcessingJob ( unsigned char Job
 
 bool USFXOnlineComponentJobQueue::CheckForJobInArray ( unsigned char JobType, struct FScriptDelegate Predicate, TArray< class USFXOnlineJob* >* JobArray )
 {
-	static UFunction* pFnCheckForJobInArray = NULL;
-
+	UFunction* pFnCheckForJobInArray = (UFunction*) SdkBindings::Get ( 3759 );
 	if ( ! pFnCheckForJobInArray )
-		pFnCheckForJobInArray = (UFunction*) UObject::GObjObjects()->Data[ 38748 ];
+		return {};
 
 	USFXOnlineComponentJobQueue_execCheckForJobInArray_Parms CheckForJobInArray_Parms;
 	CheckForJobInArray_Parms.JobType = JobType;
@@ -27621,10 +26400,9 @@ bool USFXOnlineComponentJobQueue::CheckForJobInArray ( unsigned char JobType, st
 
 bool USFXOnlineComponentJobQueue::JobPredicate ( class USFXOnlineJob** Job )
 {
-	static UFunction* pFnJobPredicate = NULL;
-
+	UFunction* pFnJobPredicate = (UFunction*) SdkBindings::Get ( 3758 );
 	if ( ! pFnJobPredicate )
-		pFnJobPredicate = (UFunction*) UObject::GObjObjects()->Data[ 38745 ];
+		return {};
 
 	USFXOnlineComponentJobQueue_execJobPredicate_Parms JobPredicate_Parms;
 
@@ -27645,10 +26423,9 @@ bool USFXOnlineComponentJobQueue::JobPredicate ( class USFXOnlineJob** Job )
 
 int USFXOnlineComponentJobQueue::eventProcessJobs ( float TimeDelta, int JobsToProcess )
 {
-	static UFunction* pFnProcessJobs = NULL;
-
+	UFunction* pFnProcessJobs = (UFunction*) SdkBindings::Get ( 3757 );
 	if ( ! pFnProcessJobs )
-		pFnProcessJobs = (UFunction*) UObject::GObjObjects()->Data[ 38731 ];
+		return {};
 
 	USFXOnlineComponentJobQueue_eventProcessJobs_Parms ProcessJobs_Parms;
 	ProcessJobs_Parms.TimeDelta = TimeDelta;
@@ -27667,10 +26444,9 @@ int USFXOnlineComponentJobQueue::eventProcessJobs ( float TimeDelta, int JobsToP
 
 class USFXOnlineJob* USFXOnlineComponentJobQueue::GetFirstPendingJob ( unsigned char JobType )
 {
-	static UFunction* pFnGetFirstPendingJob = NULL;
-
+	UFunction* pFnGetFirstPendingJob = (UFunction*) SdkBindings::Get ( 3756 );
 	if ( ! pFnGetFirstPendingJob )
-		pFnGetFirstPendingJob = (UFunction*) UObject::GObjObjects()->Data[ 38728 ];
+		return {};
 
 	USFXOnlineComponentJobQueue_execGetFirstPendingJob_Parms GetFirstPendingJob_Parms;
 	GetFirstPendingJob_Parms.JobType = JobType;
@@ -27692,10 +26468,9 @@ class USFXOnlineJob* USFXOnlineComponentJobQueue::GetFirstPendingJob ( unsigned
 
 class USFXOnlineJob* USFXOnlineComponentJobQueue::GetProcessingJob ( int JobId )
 {
-	static UFunction* pFnGetProcessingJob = NULL;
-
+	UFunction* pFnGetProcessingJob = (UFunction*) SdkBindings::Get ( 3755 );
 	if ( ! pFnGetProcessingJob )
-		pFnGetProcessingJob = (UFunction*) UObject::GObjObjects()->Data[ 38724 ];
+		return {};
 
 	USFXOnlineComponentJobQueue_execGetProcessingJob_Parms GetProcessingJob_Parms;
 	GetProcessingJob_Parms.JobId = JobId;
@@ -27713,10 +26488,9 @@ class USFXOnlineJob* USFXOnlineComponentJobQueue::GetProcessingJob ( int JobId )
 
 class USFXOnlineJob* USFXOnlineComponentJobQueue::GetPendingJob ( int JobId )
 {
-	static UFunction* pFnGetPendingJob = NULL;
-
+	UFunction* pFnGetPendingJob = (UFunction*) SdkBindings::Get ( 3754 );
 	if ( ! pFnGetPendingJob )
-		pFnGetPendingJob = (UFunction*) UObject::GObjObjects()->Data[ 38720 ];
+		return {};
 
 	USFXOnlineComponentJobQueue_execGetPendingJob_Parms GetPendingJob_Parms;
 	GetPendingJob_Parms.JobId = JobId;
@@ -27734,10 +26508,9 @@ class USFXOnlineJob* USFXOnlineComponentJobQueue::GetPendingJob ( int JobId )
 
 int USFXOnlineComponentJobQueue::eventAddJob ( class USFXOnlineJob* Job )
 {
-	static UFunction* pFnAddJob = NULL;
-
+	UFunction* pFnAddJob = (UFunction*) SdkBindings::Get ( 3743 );
 	if ( ! pFnAddJob )
-		pFnAddJob = (UFunction*) UObject::GObjObjects()->Data[ 38670 ];
+		return {};
 
 	USFXOnlineComponentJobQueue_eventAddJob_Parms AddJob_Parms;
 	AddJob_Parms.Job = Job;
@@ -27754,10 +26527,9 @@ int USFXOnlineComponentJobQueue::eventAddJob ( class USFXOnlineJob* Job )
 
 void USFXOnlineComponentJobQueue::UpdateTime ( int TimeDeltaMS )
 {
-	static UFunction* pFnUpdateTime = NULL;
-
+	UFunction* pFnUpdateTime = (UFunction*) SdkBindings::Get ( 3753 );
 	if ( ! pFnUpdateTime )
-		pFnUpdateTime = (UFunction*) UObject::GObjObjects()->Data[ 38714 ];
+		return;
 
 	USFXOnlineComponentJobQueue_execUpdateTime_Parms UpdateTime_Parms;
 	UpdateTime_Parms.TimeDeltaMS = TimeDeltaMS;
@@ -27773,10 +26545,9 @@ void USFXOnlineComponentJobQueue::UpdateTime ( int TimeDeltaMS )
 
 void USFXOnlineComponentJobQueue::SetJobThrottle ( unsigned char Category, int valueMS )
 {
-	static UFunction* pFnSetJobThrottle = NULL;
-
+	UFunction* pFnSetJobThrottle = (UFunction*) SdkBindings::Get ( 3752 );
 	if ( ! pFnSetJobThrottle )
-		pFnSetJobThrottle = (UFunction*) UObject::GObjObjects()->Data[ 38711 ];
+		return;
 
 	USFXOnlineComponentJobQueue_execSetJobThrottle_Parms SetJobThrottle_Parms;
 	SetJobThrottle_Parms.Category = Category;
@@ -27795,10 +26566,9 @@ void USFXOnlineComponentJobQueue::SetJobThrottle ( unsigned char Category, int v
 
 void USFXOnlineComponentUnrealPlayer::ClearOnlineProfileCaches ( )
 {
-	static UFunction* pFnClearOnlineProfileCaches = NULL;
-
+	UFunction* pFnClearOnlineProfileCaches = (UFunction*) SdkBindings::Get ( 4040 );
 	if ( ! pFnClearOnlineProfileCaches )
-		pFnClearOnlineProfileCaches = (UFunction*) UObject::GObjObjects()->Data[ 39802 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearOnlineProfileCaches_Parms ClearOnlineProfileCaches_Parms;
 
@@ -27813,10 +26583,9 @@ void USFXOnlineComponentUnrealPlayer::ClearOnlineProfileCaches ( )
 
 void USFXOnlineComponentUnrealPlayer::eventTriggerProfileReadDelegate ( unsigned char UserNum, unsigned long bWasSuccesful )
 {
-	static UFunction* pFnTriggerProfileReadDelegate = NULL;
-
+	UFunction* pFnTriggerProfileReadDelegate = (UFunction*) SdkBindings::Get ( 4039 );
 	if ( ! pFnTriggerProfileReadDelegate )
-		pFnTriggerProfileReadDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39798 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_eventTriggerProfileReadDelegate_Parms TriggerProfileReadDelegate_Parms;
 	TriggerProfileReadDelegate_Parms.UserNum = UserNum;
@@ -27835,10 +26604,9 @@ void USFXOnlineComponentUnrealPlayer::eventTriggerProfileReadDelegate ( unsigned
 
 void USFXOnlineComponentUnrealPlayer::LoadSettingsCallback ( unsigned char eError, int nJob, int UserNum, TArray< struct FSettingsPair >* SettingsPairs )
 {
-	static UFunction* pFnLoadSettingsCallback = NULL;
-
+	UFunction* pFnLoadSettingsCallback = (UFunction*) SdkBindings::Get ( 4038 );
 	if ( ! pFnLoadSettingsCallback )
-		pFnLoadSettingsCallback = (UFunction*) UObject::GObjObjects()->Data[ 39790 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execLoadSettingsCallback_Parms LoadSettingsCallback_Parms;
 	LoadSettingsCallback_Parms.eError = eError;
@@ -27860,10 +26628,9 @@ void USFXOnlineComponentUnrealPlayer::LoadSettingsCallback ( unsigned char eErro
 
 void USFXOnlineComponentUnrealPlayer::SaveSettingsCallback ( unsigned char eError, int nJob, int UserNum )
 {
-	static UFunction* pFnSaveSettingsCallback = NULL;
-
+	UFunction* pFnSaveSettingsCallback = (UFunction*) SdkBindings::Get ( 4037 );
 	if ( ! pFnSaveSettingsCallback )
-		pFnSaveSettingsCallback = (UFunction*) UObject::GObjObjects()->Data[ 39784 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execSaveSettingsCallback_Parms SaveSettingsCallback_Parms;
 	SaveSettingsCallback_Parms.eError = eError;
@@ -27881,10 +26648,9 @@ void USFXOnlineComponentUnrealPlayer::SaveSettingsCallback ( unsigned char eErro
 
 class USFXOnlineJobLoadSettings* USFXOnlineComponentUnrealPlayer::eventCreateJobLoadSettings ( int Arg )
 {
-	static UFunction* pFnCreateJobLoadSettings = NULL;
-
+	UFunction* pFnCreateJobLoadSettings = (UFunction*) SdkBindings::Get ( 4035 );
 	if ( ! pFnCreateJobLoadSettings )
-		pFnCreateJobLoadSettings = (UFunction*) UObject::GObjObjects()->Data[ 39779 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_eventCreateJobLoadSettings_Parms CreateJobLoadSettings_Parms;
 	CreateJobLoadSettings_Parms.Arg = Arg;
@@ -27902,10 +26668,9 @@ class USFXOnlineJobLoadSettings* USFXOnlineComponentUnrealPlayer::eventCreateJob
 
 class USFXOnlineJobSaveSettings* USFXOnlineComponentUnrealPlayer::eventCreateJobSaveSettings ( int Arg )
 {
-	static UFunction* pFnCreateJobSaveSettings = NULL;
-
+	UFunction* pFnCreateJobSaveSettings = (UFunction*) SdkBindings::Get ( 4033 );
 	if ( ! pFnCreateJobSaveSettings )
-		pFnCreateJobSaveSettings = (UFunction*) UObject::GObjObjects()->Data[ 39774 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_eventCreateJobSaveSettings_Parms CreateJobSaveSettings_Parms;
 	CreateJobSaveSettings_Parms.Arg = Arg;
@@ -27922,10 +26687,9 @@ class USFXOnlineJobSaveSettings* USFXOnlineComponentUnrealPlayer::eventCreateJob
 
 void USFXOnlineComponentUnrealPlayer::ClearAsyncState ( int UserNum )
 {
-	static UFunction* pFnClearAsyncState = NULL;
-
+	UFunction* pFnClearAsyncState = (UFunction*) SdkBindings::Get ( 4032 );
 	if ( ! pFnClearAsyncState )
-		pFnClearAsyncState = (UFunction*) UObject::GObjObjects()->Data[ 39772 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearAsyncState_Parms ClearAsyncState_Parms;
 	ClearAsyncState_Parms.UserNum = UserNum;
@@ -27945,10 +26709,9 @@ void USFXOnlineComponentUnrealPlayer::ClearAsyncState ( int UserNum )
 
 void USFXOnlineComponentUnrealPlayer::ClearUnlockAchievementCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate UnlockAchievementCompleteDelegate )
 {
-	static UFunction* pFnClearUnlockAchievementCompleteDelegate = NULL;
-
+	UFunction* pFnClearUnlockAchievementCompleteDelegate = (UFunction*) SdkBindings::Get ( 4031 );
 	if ( ! pFnClearUnlockAchievementCompleteDelegate )
-		pFnClearUnlockAchievementCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39768 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearUnlockAchievementCompleteDelegate_Parms ClearUnlockAchievementCompleteDelegate_Parms;
 	ClearUnlockAchievementCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -27965,10 +26728,9 @@ void USFXOnlineComponentUnrealPlayer::ClearUnlockAchievementCompleteDelegate ( u
 
 void USFXOnlineComponentUnrealPlayer::AddUnlockAchievementCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate UnlockAchievementCompleteDelegate )
 {
-	static UFunction* pFnAddUnlockAchievementCompleteDelegate = NULL;
-
+	UFunction* pFnAddUnlockAchievementCompleteDelegate = (UFunction*) SdkBindings::Get ( 4030 );
 	if ( ! pFnAddUnlockAchievementCompleteDelegate )
-		pFnAddUnlockAchievementCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39765 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execAddUnlockAchievementCompleteDelegate_Parms AddUnlockAchievementCompleteDelegate_Parms;
 	AddUnlockAchievementCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -27984,10 +26746,9 @@ void USFXOnlineComponentUnrealPlayer::AddUnlockAchievementCompleteDelegate ( uns
 
 void USFXOnlineComponentUnrealPlayer::OnUnlockAchievementComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnUnlockAchievementComplete = NULL;
-
+	UFunction* pFnOnUnlockAchievementComplete = (UFunction*) SdkBindings::Get ( 3925 );
 	if ( ! pFnOnUnlockAchievementComplete )
-		pFnOnUnlockAchievementComplete = (UFunction*) UObject::GObjObjects()->Data[ 39385 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnUnlockAchievementComplete_Parms OnUnlockAchievementComplete_Parms;
 	OnUnlockAchievementComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -28004,10 +26765,9 @@ void USFXOnlineComponentUnrealPlayer::OnUnlockAchievementComplete ( unsigned lon
 
 bool USFXOnlineComponentUnrealPlayer::UnlockAchievement ( unsigned char LocalUserNum, int AchievementId )
 {
-	static UFunction* pFnUnlockAchievement = NULL;
-
+	UFunction* pFnUnlockAchievement = (UFunction*) SdkBindings::Get ( 4029 );
 	if ( ! pFnUnlockAchievement )
-		pFnUnlockAchievement = (UFunction*) UObject::GObjObjects()->Data[ 39760 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execUnlockAchievement_Parms UnlockAchievement_Parms;
 	UnlockAchievement_Parms.LocalUserNum = LocalUserNum;
@@ -28032,10 +26792,9 @@ bool USFXOnlineComponentUnrealPlayer::UnlockAchievement ( unsigned char LocalUse
 
 unsigned char USFXOnlineComponentUnrealPlayer::GetAchievements ( unsigned char LocalUserNum, int TitleId, TArray< struct FAchievementDetails >* Achievements )
 {
-	static UFunction* pFnGetAchievements = NULL;
-
+	UFunction* pFnGetAchievements = (UFunction*) SdkBindings::Get ( 4028 );
 	if ( ! pFnGetAchievements )
-		pFnGetAchievements = (UFunction*) UObject::GObjObjects()->Data[ 39754 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execGetAchievements_Parms GetAchievements_Parms;
 	GetAchievements_Parms.LocalUserNum = LocalUserNum;
@@ -28061,10 +26820,9 @@ unsigned char USFXOnlineComponentUnrealPlayer::GetAchievements ( unsigned char L
 
 void USFXOnlineComponentUnrealPlayer::ClearReadAchievementsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadAchievementsCompleteDelegate )
 {
-	static UFunction* pFnClearReadAchievementsCompleteDelegate = NULL;
-
+	UFunction* pFnClearReadAchievementsCompleteDelegate = (UFunction*) SdkBindings::Get ( 4027 );
 	if ( ! pFnClearReadAchievementsCompleteDelegate )
-		pFnClearReadAchievementsCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39750 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearReadAchievementsCompleteDelegate_Parms ClearReadAchievementsCompleteDelegate_Parms;
 	ClearReadAchievementsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -28081,10 +26839,9 @@ void USFXOnlineComponentUnrealPlayer::ClearReadAchievementsCompleteDelegate ( un
 
 void USFXOnlineComponentUnrealPlayer::AddReadAchievementsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadAchievementsCompleteDelegate )
 {
-	static UFunction* pFnAddReadAchievementsCompleteDelegate = NULL;
-
+	UFunction* pFnAddReadAchievementsCompleteDelegate = (UFunction*) SdkBindings::Get ( 4026 );
 	if ( ! pFnAddReadAchievementsCompleteDelegate )
-		pFnAddReadAchievementsCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39746 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execAddReadAchievementsCompleteDelegate_Parms AddReadAchievementsCompleteDelegate_Parms;
 	AddReadAchievementsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -28100,10 +26857,9 @@ void USFXOnlineComponentUnrealPlayer::AddReadAchievementsCompleteDelegate ( unsi
 
 void USFXOnlineComponentUnrealPlayer::OnReadAchievementsComplete ( int TitleId )
 {
-	static UFunction* pFnOnReadAchievementsComplete = NULL;
-
+	UFunction* pFnOnReadAchievementsComplete = (UFunction*) SdkBindings::Get ( 3926 );
 	if ( ! pFnOnReadAchievementsComplete )
-		pFnOnReadAchievementsComplete = (UFunction*) UObject::GObjObjects()->Data[ 39388 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnReadAchievementsComplete_Parms OnReadAchievementsComplete_Parms;
 	OnReadAchievementsComplete_Parms.TitleId = TitleId;
@@ -28122,10 +26878,9 @@ void USFXOnlineComponentUnrealPlayer::OnReadAchievementsComplete ( int TitleId )
 
 bool USFXOnlineComponentUnrealPlayer::ReadAchievements ( unsigned char LocalUserNum, int TitleId, unsigned long bShouldReadText, unsigned long bShouldReadImages )
 {
-	static UFunction* pFnReadAchievements = NULL;
-
+	UFunction* pFnReadAchievements = (UFunction*) SdkBindings::Get ( 4025 );
 	if ( ! pFnReadAchievements )
-		pFnReadAchievements = (UFunction*) UObject::GObjObjects()->Data[ 39739 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execReadAchievements_Parms ReadAchievements_Parms;
 	ReadAchievements_Parms.LocalUserNum = LocalUserNum;
@@ -28151,10 +26906,9 @@ bool USFXOnlineComponentUnrealPlayer::ReadAchievements ( unsigned char LocalUser
 
 bool USFXOnlineComponentUnrealPlayer::DeleteMessage ( unsigned char LocalUserNum, int MessageIndex )
 {
-	static UFunction* pFnDeleteMessage = NULL;
-
+	UFunction* pFnDeleteMessage = (UFunction*) SdkBindings::Get ( 4024 );
 	if ( ! pFnDeleteMessage )
-		pFnDeleteMessage = (UFunction*) UObject::GObjObjects()->Data[ 39735 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execDeleteMessage_Parms DeleteMessage_Parms;
 	DeleteMessage_Parms.LocalUserNum = LocalUserNum;
@@ -28173,10 +26927,9 @@ bool USFXOnlineComponentUnrealPlayer::DeleteMessage ( unsigned char LocalUserNum
 
 void USFXOnlineComponentUnrealPlayer::ClearFriendMessageReceivedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate MessageDelegate )
 {
-	static UFunction* pFnClearFriendMessageReceivedDelegate = NULL;
-
+	UFunction* pFnClearFriendMessageReceivedDelegate = (UFunction*) SdkBindings::Get ( 4023 );
 	if ( ! pFnClearFriendMessageReceivedDelegate )
-		pFnClearFriendMessageReceivedDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39732 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearFriendMessageReceivedDelegate_Parms ClearFriendMessageReceivedDelegate_Parms;
 	ClearFriendMessageReceivedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -28193,10 +26946,9 @@ void USFXOnlineComponentUnrealPlayer::ClearFriendMessageReceivedDelegate ( unsig
 
 void USFXOnlineComponentUnrealPlayer::AddFriendMessageReceivedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate MessageDelegate )
 {
-	static UFunction* pFnAddFriendMessageReceivedDelegate = NULL;
-
+	UFunction* pFnAddFriendMessageReceivedDelegate = (UFunction*) SdkBindings::Get ( 4022 );
 	if ( ! pFnAddFriendMessageReceivedDelegate )
-		pFnAddFriendMessageReceivedDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39729 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execAddFriendMessageReceivedDelegate_Parms AddFriendMessageReceivedDelegate_Parms;
 	AddFriendMessageReceivedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -28215,10 +26967,9 @@ void USFXOnlineComponentUnrealPlayer::AddFriendMessageReceivedDelegate ( unsigne
 
 void USFXOnlineComponentUnrealPlayer::OnFriendMessageReceived ( unsigned char LocalUserNum, struct FUniqueNetId SendingPlayer, struct FString SendingNick, struct FString Message )
 {
-	static UFunction* pFnOnFriendMessageReceived = NULL;
-
+	UFunction* pFnOnFriendMessageReceived = (UFunction*) SdkBindings::Get ( 4021 );
 	if ( ! pFnOnFriendMessageReceived )
-		pFnOnFriendMessageReceived = (UFunction*) UObject::GObjObjects()->Data[ 39724 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnFriendMessageReceived_Parms OnFriendMessageReceived_Parms;
 	OnFriendMessageReceived_Parms.LocalUserNum = LocalUserNum;
@@ -28237,10 +26988,9 @@ void USFXOnlineComponentUnrealPlayer::OnFriendMessageReceived ( unsigned char Lo
 
 void USFXOnlineComponentUnrealPlayer::GetFriendMessages ( unsigned char LocalUserNum, TArray< struct FOnlineFriendMessage >* FriendMessages )
 {
-	static UFunction* pFnGetFriendMessages = NULL;
-
+	UFunction* pFnGetFriendMessages = (UFunction*) SdkBindings::Get ( 4020 );
 	if ( ! pFnGetFriendMessages )
-		pFnGetFriendMessages = (UFunction*) UObject::GObjObjects()->Data[ 39720 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execGetFriendMessages_Parms GetFriendMessages_Parms;
 	GetFriendMessages_Parms.LocalUserNum = LocalUserNum;
@@ -28258,10 +27008,9 @@ void USFXOnlineComponentUnrealPlayer::GetFriendMessages ( unsigned char LocalUse
 
 void USFXOnlineComponentUnrealPlayer::ClearJoinFriendGameCompleteDelegate ( struct FScriptDelegate JoinFriendGameCompleteDelegate )
 {
-	static UFunction* pFnClearJoinFriendGameCompleteDelegate = NULL;
-
+	UFunction* pFnClearJoinFriendGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 4019 );
 	if ( ! pFnClearJoinFriendGameCompleteDelegate )
-		pFnClearJoinFriendGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39718 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearJoinFriendGameCompleteDelegate_Parms ClearJoinFriendGameCompleteDelegate_Parms;
 	memcpy ( &ClearJoinFriendGameCompleteDelegate_Parms.JoinFriendGameCompleteDelegate, &JoinFriendGameCompleteDelegate, 0xC );
@@ -28276,10 +27025,9 @@ void USFXOnlineComponentUnrealPlayer::ClearJoinFriendGameCompleteDelegate ( stru
 
 void USFXOnlineComponentUnrealPlayer::AddJoinFriendGameCompleteDelegate ( struct FScriptDelegate JoinFriendGameCompleteDelegate )
 {
-	static UFunction* pFnAddJoinFriendGameCompleteDelegate = NULL;
-
+	UFunction* pFnAddJoinFriendGameCompleteDelegate = (UFunction*) SdkBindings::Get ( 4018 );
 	if ( ! pFnAddJoinFriendGameCompleteDelegate )
-		pFnAddJoinFriendGameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39716 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execAddJoinFriendGameCompleteDelegate_Parms AddJoinFriendGameCompleteDelegate_Parms;
 	memcpy ( &AddJoinFriendGameCompleteDelegate_Parms.JoinFriendGameCompleteDelegate, &JoinFriendGameCompleteDelegate, 0xC );
@@ -28294,10 +27042,9 @@ void USFXOnlineComponentUnrealPlayer::AddJoinFriendGameCompleteDelegate ( struct
 
 void USFXOnlineComponentUnrealPlayer::OnJoinFriendGameComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnJoinFriendGameComplete = NULL;
-
+	UFunction* pFnOnJoinFriendGameComplete = (UFunction*) SdkBindings::Get ( 4017 );
 	if ( ! pFnOnJoinFriendGameComplete )
-		pFnOnJoinFriendGameComplete = (UFunction*) UObject::GObjObjects()->Data[ 39714 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnJoinFriendGameComplete_Parms OnJoinFriendGameComplete_Parms;
 	OnJoinFriendGameComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -28314,10 +27061,9 @@ void USFXOnlineComponentUnrealPlayer::OnJoinFriendGameComplete ( unsigned long b
 
 bool USFXOnlineComponentUnrealPlayer::JoinFriendGame ( unsigned char LocalUserNum, struct FUniqueNetId Friend )
 {
-	static UFunction* pFnJoinFriendGame = NULL;
-
+	UFunction* pFnJoinFriendGame = (UFunction*) SdkBindings::Get ( 4016 );
 	if ( ! pFnJoinFriendGame )
-		pFnJoinFriendGame = (UFunction*) UObject::GObjObjects()->Data[ 39710 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execJoinFriendGame_Parms JoinFriendGame_Parms;
 	JoinFriendGame_Parms.LocalUserNum = LocalUserNum;
@@ -28336,10 +27082,9 @@ bool USFXOnlineComponentUnrealPlayer::JoinFriendGame ( unsigned char LocalUserNu
 
 void USFXOnlineComponentUnrealPlayer::ClearReceivedGameInviteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReceivedGameInviteDelegate )
 {
-	static UFunction* pFnClearReceivedGameInviteDelegate = NULL;
-
+	UFunction* pFnClearReceivedGameInviteDelegate = (UFunction*) SdkBindings::Get ( 4015 );
 	if ( ! pFnClearReceivedGameInviteDelegate )
-		pFnClearReceivedGameInviteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39707 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearReceivedGameInviteDelegate_Parms ClearReceivedGameInviteDelegate_Parms;
 	ClearReceivedGameInviteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -28356,10 +27101,9 @@ void USFXOnlineComponentUnrealPlayer::ClearReceivedGameInviteDelegate ( unsigned
 
 void USFXOnlineComponentUnrealPlayer::AddReceivedGameInviteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReceivedGameInviteDelegate )
 {
-	static UFunction* pFnAddReceivedGameInviteDelegate = NULL;
-
+	UFunction* pFnAddReceivedGameInviteDelegate = (UFunction*) SdkBindings::Get ( 4014 );
 	if ( ! pFnAddReceivedGameInviteDelegate )
-		pFnAddReceivedGameInviteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39704 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execAddReceivedGameInviteDelegate_Parms AddReceivedGameInviteDelegate_Parms;
 	AddReceivedGameInviteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -28376,10 +27120,9 @@ void USFXOnlineComponentUnrealPlayer::AddReceivedGameInviteDelegate ( unsigned c
 
 void USFXOnlineComponentUnrealPlayer::OnReceivedGameInvite ( unsigned char LocalUserNum, struct FString InviterName )
 {
-	static UFunction* pFnOnReceivedGameInvite = NULL;
-
+	UFunction* pFnOnReceivedGameInvite = (UFunction*) SdkBindings::Get ( 4013 );
 	if ( ! pFnOnReceivedGameInvite )
-		pFnOnReceivedGameInvite = (UFunction*) UObject::GObjObjects()->Data[ 39701 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnReceivedGameInvite_Parms OnReceivedGameInvite_Parms;
 	OnReceivedGameInvite_Parms.LocalUserNum = LocalUserNum;
@@ -28398,10 +27141,9 @@ void USFXOnlineComponentUnrealPlayer::OnReceivedGameInvite ( unsigned char Local
 
 bool USFXOnlineComponentUnrealPlayer::SendGameInviteToFriends ( unsigned char LocalUserNum, TArray< struct FUniqueNetId > Friends, struct FString Text )
 {
-	static UFunction* pFnSendGameInviteToFriends = NULL;
-
+	UFunction* pFnSendGameInviteToFriends = (UFunction*) SdkBindings::Get ( 4012 );
 	if ( ! pFnSendGameInviteToFriends )
-		pFnSendGameInviteToFriends = (UFunction*) UObject::GObjObjects()->Data[ 39695 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execSendGameInviteToFriends_Parms SendGameInviteToFriends_Parms;
 	SendGameInviteToFriends_Parms.LocalUserNum = LocalUserNum;
@@ -28423,10 +27165,9 @@ bool USFXOnlineComponentUnrealPlayer::SendGameInviteToFriends ( unsigned char Lo
 
 bool USFXOnlineComponentUnrealPlayer::SendGameInviteToFriend ( unsigned char LocalUserNum, struct FUniqueNetId Friend, struct FString Text )
 {
-	static UFunction* pFnSendGameInviteToFriend = NULL;
-
+	UFunction* pFnSendGameInviteToFriend = (UFunction*) SdkBindings::Get ( 4011 );
 	if ( ! pFnSendGameInviteToFriend )
-		pFnSendGameInviteToFriend = (UFunction*) UObject::GObjObjects()->Data[ 39690 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execSendGameInviteToFriend_Parms SendGameInviteToFriend_Parms;
 	SendGameInviteToFriend_Parms.LocalUserNum = LocalUserNum;
@@ -28448,10 +27189,9 @@ bool USFXOnlineComponentUnrealPlayer::SendGameInviteToFriend ( unsigned char Loc
 
 bool USFXOnlineComponentUnrealPlayer::SendMessageToFriend ( unsigned char LocalUserNum, struct FUniqueNetId Friend, struct FString Message )
 {
-	static UFunction* pFnSendMessageToFriend = NULL;
-
+	UFunction* pFnSendMessageToFriend = (UFunction*) SdkBindings::Get ( 4010 );
 	if ( ! pFnSendMessageToFriend )
-		pFnSendMessageToFriend = (UFunction*) UObject::GObjObjects()->Data[ 39685 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execSendMessageToFriend_Parms SendMessageToFriend_Parms;
 	SendMessageToFriend_Parms.LocalUserNum = LocalUserNum;
@@ -28471,10 +27211,9 @@ bool USFXOnlineComponentUnrealPlayer::SendMessageToFriend ( unsigned char LocalU
 
 void USFXOnlineComponentUnrealPlayer::ClearFriendInviteReceivedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate InviteDelegate )
 {
-	static UFunction* pFnClearFriendInviteReceivedDelegate = NULL;
-
+	UFunction* pFnClearFriendInviteReceivedDelegate = (UFunction*) SdkBindings::Get ( 4009 );
 	if ( ! pFnClearFriendInviteReceivedDelegate )
-		pFnClearFriendInviteReceivedDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39682 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearFriendInviteReceivedDelegate_Parms ClearFriendInviteReceivedDelegate_Parms;
 	ClearFriendInviteReceivedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -28491,10 +27230,9 @@ void USFXOnlineComponentUnrealPlayer::ClearFriendInviteReceivedDelegate ( unsign
 
 void USFXOnlineComponentUnrealPlayer::AddFriendInviteReceivedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate InviteDelegate )
 {
-	static UFunction* pFnAddFriendInviteReceivedDelegate = NULL;
-
+	UFunction* pFnAddFriendInviteReceivedDelegate = (UFunction*) SdkBindings::Get ( 4008 );
 	if ( ! pFnAddFriendInviteReceivedDelegate )
-		pFnAddFriendInviteReceivedDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39679 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execAddFriendInviteReceivedDelegate_Parms AddFriendInviteReceivedDelegate_Parms;
 	AddFriendInviteReceivedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -28513,10 +27251,9 @@ void USFXOnlineComponentUnrealPlayer::AddFriendInviteReceivedDelegate ( unsigned
 
 void USFXOnlineComponentUnrealPlayer::OnFriendInviteReceived ( unsigned char LocalUserNum, struct FUniqueNetId RequestingPlayer, struct FString RequestingNick, struct FString Message )
 {
-	static UFunction* pFnOnFriendInviteReceived = NULL;
-
+	UFunction* pFnOnFriendInviteReceived = (UFunction*) SdkBindings::Get ( 4007 );
 	if ( ! pFnOnFriendInviteReceived )
-		pFnOnFriendInviteReceived = (UFunction*) UObject::GObjObjects()->Data[ 39674 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnFriendInviteReceived_Parms OnFriendInviteReceived_Parms;
 	OnFriendInviteReceived_Parms.LocalUserNum = LocalUserNum;
@@ -28536,10 +27273,9 @@ void USFXOnlineComponentUnrealPlayer::OnFriendInviteReceived ( unsigned char Loc
 
 bool USFXOnlineComponentUnrealPlayer::RemoveFriend ( unsigned char LocalUserNum, struct FUniqueNetId FormerFriend )
 {
-	static UFunction* pFnRemoveFriend = NULL;
-
+	UFunction* pFnRemoveFriend = (UFunction*) SdkBindings::Get ( 4006 );
 	if ( ! pFnRemoveFriend )
-		pFnRemoveFriend = (UFunction*) UObject::GObjObjects()->Data[ 39670 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execRemoveFriend_Parms RemoveFriend_Parms;
 	RemoveFriend_Parms.LocalUserNum = LocalUserNum;
@@ -28559,10 +27295,9 @@ bool USFXOnlineComponentUnrealPlayer::RemoveFriend ( unsigned char LocalUserNum,
 
 bool USFXOnlineComponentUnrealPlayer::DenyFriendInvite ( unsigned char LocalUserNum, struct FUniqueNetId RequestingPlayer )
 {
-	static UFunction* pFnDenyFriendInvite = NULL;
-
+	UFunction* pFnDenyFriendInvite = (UFunction*) SdkBindings::Get ( 4005 );
 	if ( ! pFnDenyFriendInvite )
-		pFnDenyFriendInvite = (UFunction*) UObject::GObjObjects()->Data[ 39666 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execDenyFriendInvite_Parms DenyFriendInvite_Parms;
 	DenyFriendInvite_Parms.LocalUserNum = LocalUserNum;
@@ -28582,10 +27317,9 @@ bool USFXOnlineComponentUnrealPlayer::DenyFriendInvite ( unsigned char LocalUser
 
 bool USFXOnlineComponentUnrealPlayer::AcceptFriendInvite ( unsigned char LocalUserNum, struct FUniqueNetId RequestingPlayer )
 {
-	static UFunction* pFnAcceptFriendInvite = NULL;
-
+	UFunction* pFnAcceptFriendInvite = (UFunction*) SdkBindings::Get ( 4004 );
 	if ( ! pFnAcceptFriendInvite )
-		pFnAcceptFriendInvite = (UFunction*) UObject::GObjObjects()->Data[ 39662 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execAcceptFriendInvite_Parms AcceptFriendInvite_Parms;
 	AcceptFriendInvite_Parms.LocalUserNum = LocalUserNum;
@@ -28604,10 +27338,9 @@ bool USFXOnlineComponentUnrealPlayer::AcceptFriendInvite ( unsigned char LocalUs
 
 void USFXOnlineComponentUnrealPlayer::ClearAddFriendByNameCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate FriendDelegate )
 {
-	static UFunction* pFnClearAddFriendByNameCompleteDelegate = NULL;
-
+	UFunction* pFnClearAddFriendByNameCompleteDelegate = (UFunction*) SdkBindings::Get ( 4003 );
 	if ( ! pFnClearAddFriendByNameCompleteDelegate )
-		pFnClearAddFriendByNameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39659 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearAddFriendByNameCompleteDelegate_Parms ClearAddFriendByNameCompleteDelegate_Parms;
 	ClearAddFriendByNameCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -28624,10 +27357,9 @@ void USFXOnlineComponentUnrealPlayer::ClearAddFriendByNameCompleteDelegate ( uns
 
 void USFXOnlineComponentUnrealPlayer::AddAddFriendByNameCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate FriendDelegate )
 {
-	static UFunction* pFnAddAddFriendByNameCompleteDelegate = NULL;
-
+	UFunction* pFnAddAddFriendByNameCompleteDelegate = (UFunction*) SdkBindings::Get ( 4002 );
 	if ( ! pFnAddAddFriendByNameCompleteDelegate )
-		pFnAddAddFriendByNameCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39656 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execAddAddFriendByNameCompleteDelegate_Parms AddAddFriendByNameCompleteDelegate_Parms;
 	AddAddFriendByNameCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -28643,10 +27375,9 @@ void USFXOnlineComponentUnrealPlayer::AddAddFriendByNameCompleteDelegate ( unsig
 
 void USFXOnlineComponentUnrealPlayer::OnAddFriendByNameComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnAddFriendByNameComplete = NULL;
-
+	UFunction* pFnOnAddFriendByNameComplete = (UFunction*) SdkBindings::Get ( 4001 );
 	if ( ! pFnOnAddFriendByNameComplete )
-		pFnOnAddFriendByNameComplete = (UFunction*) UObject::GObjObjects()->Data[ 39654 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnAddFriendByNameComplete_Parms OnAddFriendByNameComplete_Parms;
 	OnAddFriendByNameComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -28664,10 +27395,9 @@ void USFXOnlineComponentUnrealPlayer::OnAddFriendByNameComplete ( unsigned long
 
 bool USFXOnlineComponentUnrealPlayer::AddFriendByName ( unsigned char LocalUserNum, struct FString FriendName, struct FString Message )
 {
-	static UFunction* pFnAddFriendByName = NULL;
-
+	UFunction* pFnAddFriendByName = (UFunction*) SdkBindings::Get ( 4000 );
 	if ( ! pFnAddFriendByName )
-		pFnAddFriendByName = (UFunction*) UObject::GObjObjects()->Data[ 39649 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execAddFriendByName_Parms AddFriendByName_Parms;
 	AddFriendByName_Parms.LocalUserNum = LocalUserNum;
@@ -28689,10 +27419,9 @@ bool USFXOnlineComponentUnrealPlayer::AddFriendByName ( unsigned char LocalUserN
 
 bool USFXOnlineComponentUnrealPlayer::AddFriend ( unsigned char LocalUserNum, struct FUniqueNetId NewFriend, struct FString Message )
 {
-	static UFunction* pFnAddFriend = NULL;
-
+	UFunction* pFnAddFriend = (UFunction*) SdkBindings::Get ( 3999 );
 	if ( ! pFnAddFriend )
-		pFnAddFriend = (UFunction*) UObject::GObjObjects()->Data[ 39644 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execAddFriend_Parms AddFriend_Parms;
 	AddFriend_Parms.LocalUserNum = LocalUserNum;
@@ -28712,10 +27441,9 @@ bool USFXOnlineComponentUnrealPlayer::AddFriend ( unsigned char LocalUserNum, st
 
 struct FString USFXOnlineComponentUnrealPlayer::GetKeyboardInputResults ( unsigned char* bWasCanceled )
 {
-	static UFunction* pFnGetKeyboardInputResults = NULL;
-
+	UFunction* pFnGetKeyboardInputResults = (UFunction*) SdkBindings::Get ( 3998 );
 	if ( ! pFnGetKeyboardInputResults )
-		pFnGetKeyboardInputResults = (UFunction*) UObject::GObjObjects()->Data[ 39641 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execGetKeyboardInputResults_Parms GetKeyboardInputResults_Parms;
 
@@ -28734,10 +27462,9 @@ struct FString USFXOnlineComponentUnrealPlayer::GetKeyboardInputResults ( unsign
 
 void USFXOnlineComponentUnrealPlayer::ClearKeyboardInputDoneDelegate ( struct FScriptDelegate InputDelegate )
 {
-	static UFunction* pFnClearKeyboardInputDoneDelegate = NULL;
-
+	UFunction* pFnClearKeyboardInputDoneDelegate = (UFunction*) SdkBindings::Get ( 3997 );
 	if ( ! pFnClearKeyboardInputDoneDelegate )
-		pFnClearKeyboardInputDoneDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39639 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearKeyboardInputDoneDelegate_Parms ClearKeyboardInputDoneDelegate_Parms;
 	memcpy ( &ClearKeyboardInputDoneDelegate_Parms.InputDelegate, &InputDelegate, 0xC );
@@ -28752,10 +27479,9 @@ void USFXOnlineComponentUnrealPlayer::ClearKeyboardInputDoneDelegate ( struct FS
 
 void USFXOnlineComponentUnrealPlayer::AddKeyboardInputDoneDelegate ( struct FScriptDelegate InputDelegate )
 {
-	static UFunction* pFnAddKeyboardInputDoneDelegate = NULL;
-
+	UFunction* pFnAddKeyboardInputDoneDelegate = (UFunction*) SdkBindings::Get ( 3996 );
 	if ( ! pFnAddKeyboardInputDoneDelegate )
-		pFnAddKeyboardInputDoneDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39637 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execAddKeyboardInputDoneDelegate_Parms AddKeyboardInputDoneDelegate_Parms;
 	memcpy ( &AddKeyboardInputDoneDelegate_Parms.InputDelegate, &InputDelegate, 0xC );
@@ -28770,10 +27496,9 @@ void USFXOnlineComponentUnrealPlayer::AddKeyboardInputDoneDelegate ( struct FScr
 
 void USFXOnlineComponentUnrealPlayer::OnKeyboardInputComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnKeyboardInputComplete = NULL;
-
+	UFunction* pFnOnKeyboardInputComplete = (UFunction*) SdkBindings::Get ( 3995 );
 	if ( ! pFnOnKeyboardInputComplete )
-		pFnOnKeyboardInputComplete = (UFunction*) UObject::GObjObjects()->Data[ 39635 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnKeyboardInputComplete_Parms OnKeyboardInputComplete_Parms;
 	OnKeyboardInputComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -28795,10 +27520,9 @@ void USFXOnlineComponentUnrealPlayer::OnKeyboardInputComplete ( unsigned long bW
 
 bool USFXOnlineComponentUnrealPlayer::ShowKeyboardUI ( unsigned char LocalUserNum, struct FString TitleText, struct FString DescriptionText, unsigned long bIsPassword, unsigned long bShouldValidate, struct FString DefaultText, int MaxResultLength )
 {
-	static UFunction* pFnShowKeyboardUI = NULL;
-
+	UFunction* pFnShowKeyboardUI = (UFunction*) SdkBindings::Get ( 3994 );
 	if ( ! pFnShowKeyboardUI )
-		pFnShowKeyboardUI = (UFunction*) UObject::GObjObjects()->Data[ 39626 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execShowKeyboardUI_Parms ShowKeyboardUI_Parms;
 	ShowKeyboardUI_Parms.LocalUserNum = LocalUserNum;
@@ -28824,10 +27548,9 @@ bool USFXOnlineComponentUnrealPlayer::ShowKeyboardUI ( unsigned char LocalUserNu
 
 void USFXOnlineComponentUnrealPlayer::SetOnlineStatus ( unsigned char LocalUserNum, int StatusId, TArray< struct FLocalizedStringSetting >* LocalizedStringSettings, TArray< struct FSettingsProperty >* Properties )
 {
-	static UFunction* pFnSetOnlineStatus = NULL;
-
+	UFunction* pFnSetOnlineStatus = (UFunction*) SdkBindings::Get ( 3993 );
 	if ( ! pFnSetOnlineStatus )
-		pFnSetOnlineStatus = (UFunction*) UObject::GObjObjects()->Data[ 39619 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execSetOnlineStatus_Parms SetOnlineStatus_Parms;
 	SetOnlineStatus_Parms.LocalUserNum = LocalUserNum;
@@ -28857,10 +27580,9 @@ void USFXOnlineComponentUnrealPlayer::SetOnlineStatus ( unsigned char LocalUserN
 
 unsigned char USFXOnlineComponentUnrealPlayer::GetFriendsList ( unsigned char LocalUserNum, int Count, int StartingAt, TArray< struct FOnlineFriend >* Friends )
 {
-	static UFunction* pFnGetFriendsList = NULL;
-
+	UFunction* pFnGetFriendsList = (UFunction*) SdkBindings::Get ( 3992 );
 	if ( ! pFnGetFriendsList )
-		pFnGetFriendsList = (UFunction*) UObject::GObjObjects()->Data[ 39612 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execGetFriendsList_Parms GetFriendsList_Parms;
 	GetFriendsList_Parms.LocalUserNum = LocalUserNum;
@@ -28887,10 +27609,9 @@ unsigned char USFXOnlineComponentUnrealPlayer::GetFriendsList ( unsigned char Lo
 
 void USFXOnlineComponentUnrealPlayer::ClearReadFriendsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadFriendsCompleteDelegate )
 {
-	static UFunction* pFnClearReadFriendsCompleteDelegate = NULL;
-
+	UFunction* pFnClearReadFriendsCompleteDelegate = (UFunction*) SdkBindings::Get ( 3991 );
 	if ( ! pFnClearReadFriendsCompleteDelegate )
-		pFnClearReadFriendsCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39608 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearReadFriendsCompleteDelegate_Parms ClearReadFriendsCompleteDelegate_Parms;
 	ClearReadFriendsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -28907,10 +27628,9 @@ void USFXOnlineComponentUnrealPlayer::ClearReadFriendsCompleteDelegate ( unsigne
 
 void USFXOnlineComponentUnrealPlayer::AddReadFriendsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadFriendsCompleteDelegate )
 {
-	static UFunction* pFnAddReadFriendsCompleteDelegate = NULL;
-
+	UFunction* pFnAddReadFriendsCompleteDelegate = (UFunction*) SdkBindings::Get ( 3990 );
 	if ( ! pFnAddReadFriendsCompleteDelegate )
-		pFnAddReadFriendsCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39605 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execAddReadFriendsCompleteDelegate_Parms AddReadFriendsCompleteDelegate_Parms;
 	AddReadFriendsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -28926,10 +27646,9 @@ void USFXOnlineComponentUnrealPlayer::AddReadFriendsCompleteDelegate ( unsigned
 
 void USFXOnlineComponentUnrealPlayer::OnReadFriendsComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnReadFriendsComplete = NULL;
-
+	UFunction* pFnOnReadFriendsComplete = (UFunction*) SdkBindings::Get ( 3917 );
 	if ( ! pFnOnReadFriendsComplete )
-		pFnOnReadFriendsComplete = (UFunction*) UObject::GObjObjects()->Data[ 39351 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnReadFriendsComplete_Parms OnReadFriendsComplete_Parms;
 	OnReadFriendsComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -28947,10 +27666,9 @@ void USFXOnlineComponentUnrealPlayer::OnReadFriendsComplete ( unsigned long bWas
 
 bool USFXOnlineComponentUnrealPlayer::ReadFriendsList ( unsigned char LocalUserNum, int Count, int StartingAt )
 {
-	static UFunction* pFnReadFriendsList = NULL;
-
+	UFunction* pFnReadFriendsList = (UFunction*) SdkBindings::Get ( 3989 );
 	if ( ! pFnReadFriendsList )
-		pFnReadFriendsList = (UFunction*) UObject::GObjObjects()->Data[ 39599 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execReadFriendsList_Parms ReadFriendsList_Parms;
 	ReadFriendsList_Parms.LocalUserNum = LocalUserNum;
@@ -28974,10 +27692,9 @@ bool USFXOnlineComponentUnrealPlayer::ReadFriendsList ( unsigned char LocalUserN
 
 void USFXOnlineComponentUnrealPlayer::ClearWritePlayerStorageCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate WritePlayerStorageCompleteDelegate )
 {
-	static UFunction* pFnClearWritePlayerStorageCompleteDelegate = NULL;
-
+	UFunction* pFnClearWritePlayerStorageCompleteDelegate = (UFunction*) SdkBindings::Get ( 3988 );
 	if ( ! pFnClearWritePlayerStorageCompleteDelegate )
-		pFnClearWritePlayerStorageCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39595 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearWritePlayerStorageCompleteDelegate_Parms ClearWritePlayerStorageCompleteDelegate_Parms;
 	ClearWritePlayerStorageCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -28994,10 +27711,9 @@ void USFXOnlineComponentUnrealPlayer::ClearWritePlayerStorageCompleteDelegate (
 
 void USFXOnlineComponentUnrealPlayer::AddWritePlayerStorageCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate WritePlayerStorageCompleteDelegate )
 {
-	static UFunction* pFnAddWritePlayerStorageCompleteDelegate = NULL;
-
+	UFunction* pFnAddWritePlayerStorageCompleteDelegate = (UFunction*) SdkBindings::Get ( 3987 );
 	if ( ! pFnAddWritePlayerStorageCompleteDelegate )
-		pFnAddWritePlayerStorageCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39592 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execAddWritePlayerStorageCompleteDelegate_Parms AddWritePlayerStorageCompleteDelegate_Parms;
 	AddWritePlayerStorageCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -29014,10 +27730,9 @@ void USFXOnlineComponentUnrealPlayer::AddWritePlayerStorageCompleteDelegate ( un
 
 void USFXOnlineComponentUnrealPlayer::OnWritePlayerStorageComplete ( unsigned char LocalUserNum, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnWritePlayerStorageComplete = NULL;
-
+	UFunction* pFnOnWritePlayerStorageComplete = (UFunction*) SdkBindings::Get ( 3915 );
 	if ( ! pFnOnWritePlayerStorageComplete )
-		pFnOnWritePlayerStorageComplete = (UFunction*) UObject::GObjObjects()->Data[ 39345 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnWritePlayerStorageComplete_Parms OnWritePlayerStorageComplete_Parms;
 	OnWritePlayerStorageComplete_Parms.LocalUserNum = LocalUserNum;
@@ -29035,10 +27750,9 @@ void USFXOnlineComponentUnrealPlayer::OnWritePlayerStorageComplete ( unsigned ch
 
 bool USFXOnlineComponentUnrealPlayer::WritePlayerStorage ( unsigned char LocalUserNum, class UOnlinePlayerStorage* PlayerStorage )
 {
-	static UFunction* pFnWritePlayerStorage = NULL;
-
+	UFunction* pFnWritePlayerStorage = (UFunction*) SdkBindings::Get ( 3986 );
 	if ( ! pFnWritePlayerStorage )
-		pFnWritePlayerStorage = (UFunction*) UObject::GObjObjects()->Data[ 39586 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execWritePlayerStorage_Parms WritePlayerStorage_Parms;
 	WritePlayerStorage_Parms.LocalUserNum = LocalUserNum;
@@ -29061,10 +27775,9 @@ bool USFXOnlineComponentUnrealPlayer::WritePlayerStorage ( unsigned char LocalUs
 
 class UOnlinePlayerStorage* USFXOnlineComponentUnrealPlayer::GetPlayerStorage ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnGetPlayerStorage = NULL;
-
+	UFunction* pFnGetPlayerStorage = (UFunction*) SdkBindings::Get ( 3985 );
 	if ( ! pFnGetPlayerStorage )
-		pFnGetPlayerStorage = (UFunction*) UObject::GObjObjects()->Data[ 39582 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execGetPlayerStorage_Parms GetPlayerStorage_Parms;
 	GetPlayerStorage_Parms.LocalUserNum = LocalUserNum;
@@ -29082,10 +27795,9 @@ class UOnlinePlayerStorage* USFXOnlineComponentUnrealPlayer::GetPlayerStorage (
 
 void USFXOnlineComponentUnrealPlayer::ClearReadPlayerStorageForNetIdCompleteDelegate ( struct FUniqueNetId NetId, struct FScriptDelegate ReadPlayerStorageForNetIdCompleteDelegate )
 {
-	static UFunction* pFnClearReadPlayerStorageForNetIdCompleteDelegate = NULL;
-
+	UFunction* pFnClearReadPlayerStorageForNetIdCompleteDelegate = (UFunction*) SdkBindings::Get ( 3984 );
 	if ( ! pFnClearReadPlayerStorageForNetIdCompleteDelegate )
-		pFnClearReadPlayerStorageForNetIdCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39578 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearReadPlayerStorageForNetIdCompleteDelegate_Parms ClearReadPlayerStorageForNetIdCompleteDelegate_Parms;
 	memcpy ( &ClearReadPlayerStorageForNetIdCompleteDelegate_Parms.NetId, &NetId, 0x8 );
@@ -29102,10 +27814,9 @@ void USFXOnlineComponentUnrealPlayer::ClearReadPlayerStorageForNetIdCompleteDele
 
 void USFXOnlineComponentUnrealPlayer::AddReadPlayerStorageForNetIdCompleteDelegate ( struct FUniqueNetId NetId, struct FScriptDelegate ReadPlayerStorageForNetIdCompleteDelegate )
 {
-	static UFunction* pFnAddReadPlayerStorageForNetIdCompleteDelegate = NULL;
-
+	UFunction* pFnAddReadPlayerStorageForNetIdCompleteDelegate = (UFunction*) SdkBindings::Get ( 3983 );
 	if ( ! pFnAddReadPlayerStorageForNetIdCompleteDelegate )
-		pFnAddReadPlayerStorageForNetIdCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39575 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execAddReadPlayerStorageForNetIdCompleteDelegate_Parms AddReadPlayerStorageForNetIdCompleteDelegate_Parms;
 	memcpy ( &AddReadPlayerStorageForNetIdCompleteDelegate_Parms.NetId, &NetId, 0x8 );
@@ -29122,10 +27833,9 @@ void USFXOnlineComponentUnrealPlayer::AddReadPlayerStorageForNetIdCompleteDelega
 
 void USFXOnlineComponentUnrealPlayer::OnReadPlayerStorageForNetIdComplete ( struct FUniqueNetId NetId, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnReadPlayerStorageForNetIdComplete = NULL;
-
+	UFunction* pFnOnReadPlayerStorageForNetIdComplete = (UFunction*) SdkBindings::Get ( 3916 );
 	if ( ! pFnOnReadPlayerStorageForNetIdComplete )
-		pFnOnReadPlayerStorageForNetIdComplete = (UFunction*) UObject::GObjObjects()->Data[ 39348 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnReadPlayerStorageForNetIdComplete_Parms OnReadPlayerStorageForNetIdComplete_Parms;
 	memcpy ( &OnReadPlayerStorageForNetIdComplete_Parms.NetId, &NetId, 0x8 );
@@ -29143,10 +27853,9 @@ void USFXOnlineComponentUnrealPlayer::OnReadPlayerStorageForNetIdComplete ( stru
 
 bool USFXOnlineComponentUnrealPlayer::ReadPlayerStorageForNetId ( struct FUniqueNetId NetId, class UOnlinePlayerStorage* PlayerStorage )
 {
-	static UFunction* pFnReadPlayerStorageForNetId = NULL;
-
+	UFunction* pFnReadPlayerStorageForNetId = (UFunction*) SdkBindings::Get ( 3982 );
 	if ( ! pFnReadPlayerStorageForNetId )
-		pFnReadPlayerStorageForNetId = (UFunction*) UObject::GObjObjects()->Data[ 39569 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execReadPlayerStorageForNetId_Parms ReadPlayerStorageForNetId_Parms;
 	memcpy ( &ReadPlayerStorageForNetId_Parms.NetId, &NetId, 0x8 );
@@ -29169,10 +27878,9 @@ bool USFXOnlineComponentUnrealPlayer::ReadPlayerStorageForNetId ( struct FUnique
 
 void USFXOnlineComponentUnrealPlayer::ClearReadPlayerStorageCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadPlayerStorageCompleteDelegate )
 {
-	static UFunction* pFnClearReadPlayerStorageCompleteDelegate = NULL;
-
+	UFunction* pFnClearReadPlayerStorageCompleteDelegate = (UFunction*) SdkBindings::Get ( 3981 );
 	if ( ! pFnClearReadPlayerStorageCompleteDelegate )
-		pFnClearReadPlayerStorageCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39565 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearReadPlayerStorageCompleteDelegate_Parms ClearReadPlayerStorageCompleteDelegate_Parms;
 	ClearReadPlayerStorageCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -29189,10 +27897,9 @@ void USFXOnlineComponentUnrealPlayer::ClearReadPlayerStorageCompleteDelegate ( u
 
 void USFXOnlineComponentUnrealPlayer::AddReadPlayerStorageCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadPlayerStorageCompleteDelegate )
 {
-	static UFunction* pFnAddReadPlayerStorageCompleteDelegate = NULL;
-
+	UFunction* pFnAddReadPlayerStorageCompleteDelegate = (UFunction*) SdkBindings::Get ( 3980 );
 	if ( ! pFnAddReadPlayerStorageCompleteDelegate )
-		pFnAddReadPlayerStorageCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39562 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execAddReadPlayerStorageCompleteDelegate_Parms AddReadPlayerStorageCompleteDelegate_Parms;
 	AddReadPlayerStorageCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -29209,10 +27916,9 @@ void USFXOnlineComponentUnrealPlayer::AddReadPlayerStorageCompleteDelegate ( uns
 
 void USFXOnlineComponentUnrealPlayer::OnReadPlayerStorageComplete ( unsigned char LocalUserNum, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnReadPlayerStorageComplete = NULL;
-
+	UFunction* pFnOnReadPlayerStorageComplete = (UFunction*) SdkBindings::Get ( 3914 );
 	if ( ! pFnOnReadPlayerStorageComplete )
-		pFnOnReadPlayerStorageComplete = (UFunction*) UObject::GObjObjects()->Data[ 39342 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnReadPlayerStorageComplete_Parms OnReadPlayerStorageComplete_Parms;
 	OnReadPlayerStorageComplete_Parms.LocalUserNum = LocalUserNum;
@@ -29230,10 +27936,9 @@ void USFXOnlineComponentUnrealPlayer::OnReadPlayerStorageComplete ( unsigned cha
 
 bool USFXOnlineComponentUnrealPlayer::ReadPlayerStorage ( unsigned char LocalUserNum, class UOnlinePlayerStorage* PlayerStorage )
 {
-	static UFunction* pFnReadPlayerStorage = NULL;
-
+	UFunction* pFnReadPlayerStorage = (UFunction*) SdkBindings::Get ( 3979 );
 	if ( ! pFnReadPlayerStorage )
-		pFnReadPlayerStorage = (UFunction*) UObject::GObjObjects()->Data[ 39556 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execReadPlayerStorage_Parms ReadPlayerStorage_Parms;
 	ReadPlayerStorage_Parms.LocalUserNum = LocalUserNum;
@@ -29256,10 +27961,9 @@ bool USFXOnlineComponentUnrealPlayer::ReadPlayerStorage ( unsigned char LocalUse
 
 void USFXOnlineComponentUnrealPlayer::ClearWriteProfileSettingsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate WriteProfileSettingsCompleteDelegate )
 {
-	static UFunction* pFnClearWriteProfileSettingsCompleteDelegate = NULL;
-
+	UFunction* pFnClearWriteProfileSettingsCompleteDelegate = (UFunction*) SdkBindings::Get ( 3978 );
 	if ( ! pFnClearWriteProfileSettingsCompleteDelegate )
-		pFnClearWriteProfileSettingsCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39552 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearWriteProfileSettingsCompleteDelegate_Parms ClearWriteProfileSettingsCompleteDelegate_Parms;
 	ClearWriteProfileSettingsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -29276,10 +27980,9 @@ void USFXOnlineComponentUnrealPlayer::ClearWriteProfileSettingsCompleteDelegate
 
 void USFXOnlineComponentUnrealPlayer::AddWriteProfileSettingsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate WriteProfileSettingsCompleteDelegate )
 {
-	static UFunction* pFnAddWriteProfileSettingsCompleteDelegate = NULL;
-
+	UFunction* pFnAddWriteProfileSettingsCompleteDelegate = (UFunction*) SdkBindings::Get ( 3977 );
 	if ( ! pFnAddWriteProfileSettingsCompleteDelegate )
-		pFnAddWriteProfileSettingsCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39549 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execAddWriteProfileSettingsCompleteDelegate_Parms AddWriteProfileSettingsCompleteDelegate_Parms;
 	AddWriteProfileSettingsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -29296,10 +27999,9 @@ void USFXOnlineComponentUnrealPlayer::AddWriteProfileSettingsCompleteDelegate (
 
 void USFXOnlineComponentUnrealPlayer::OnWriteProfileSettingsComplete ( unsigned char LocalUserNum, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnWriteProfileSettingsComplete = NULL;
-
+	UFunction* pFnOnWriteProfileSettingsComplete = (UFunction*) SdkBindings::Get ( 3923 );
 	if ( ! pFnOnWriteProfileSettingsComplete )
-		pFnOnWriteProfileSettingsComplete = (UFunction*) UObject::GObjObjects()->Data[ 39370 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnWriteProfileSettingsComplete_Parms OnWriteProfileSettingsComplete_Parms;
 	OnWriteProfileSettingsComplete_Parms.LocalUserNum = LocalUserNum;
@@ -29317,10 +28019,9 @@ void USFXOnlineComponentUnrealPlayer::OnWriteProfileSettingsComplete ( unsigned
 
 bool USFXOnlineComponentUnrealPlayer::WriteProfileSettings ( unsigned char LocalUserNum, class UOnlineProfileSettings* ProfileSettings )
 {
-	static UFunction* pFnWriteProfileSettings = NULL;
-
+	UFunction* pFnWriteProfileSettings = (UFunction*) SdkBindings::Get ( 3976 );
 	if ( ! pFnWriteProfileSettings )
-		pFnWriteProfileSettings = (UFunction*) UObject::GObjObjects()->Data[ 39543 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execWriteProfileSettings_Parms WriteProfileSettings_Parms;
 	WriteProfileSettings_Parms.LocalUserNum = LocalUserNum;
@@ -29343,10 +28044,9 @@ bool USFXOnlineComponentUnrealPlayer::WriteProfileSettings ( unsigned char Local
 
 class UOnlineProfileSettings* USFXOnlineComponentUnrealPlayer::GetProfileSettings ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnGetProfileSettings = NULL;
-
+	UFunction* pFnGetProfileSettings = (UFunction*) SdkBindings::Get ( 3975 );
 	if ( ! pFnGetProfileSettings )
-		pFnGetProfileSettings = (UFunction*) UObject::GObjObjects()->Data[ 39540 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execGetProfileSettings_Parms GetProfileSettings_Parms;
 	GetProfileSettings_Parms.LocalUserNum = LocalUserNum;
@@ -29364,10 +28064,9 @@ class UOnlineProfileSettings* USFXOnlineComponentUnrealPlayer::GetProfileSetting
 
 void USFXOnlineComponentUnrealPlayer::ClearReadProfileSettingsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadProfileSettingsCompleteDelegate )
 {
-	static UFunction* pFnClearReadProfileSettingsCompleteDelegate = NULL;
-
+	UFunction* pFnClearReadProfileSettingsCompleteDelegate = (UFunction*) SdkBindings::Get ( 3974 );
 	if ( ! pFnClearReadProfileSettingsCompleteDelegate )
-		pFnClearReadProfileSettingsCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39536 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearReadProfileSettingsCompleteDelegate_Parms ClearReadProfileSettingsCompleteDelegate_Parms;
 	ClearReadProfileSettingsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -29384,10 +28083,9 @@ void USFXOnlineComponentUnrealPlayer::ClearReadProfileSettingsCompleteDelegate (
 
 void USFXOnlineComponentUnrealPlayer::AddReadProfileSettingsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadProfileSettingsCompleteDelegate )
 {
-	static UFunction* pFnAddReadProfileSettingsCompleteDelegate = NULL;
-
+	UFunction* pFnAddReadProfileSettingsCompleteDelegate = (UFunction*) SdkBindings::Get ( 3973 );
 	if ( ! pFnAddReadProfileSettingsCompleteDelegate )
-		pFnAddReadProfileSettingsCompleteDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39532 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execAddReadProfileSettingsCompleteDelegate_Parms AddReadProfileSettingsCompleteDelegate_Parms;
 	AddReadProfileSettingsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -29404,10 +28102,9 @@ void USFXOnlineComponentUnrealPlayer::AddReadProfileSettingsCompleteDelegate ( u
 
 void USFXOnlineComponentUnrealPlayer::OnReadProfileSettingsComplete ( unsigned char LocalUserNum, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnReadProfileSettingsComplete = NULL;
-
+	UFunction* pFnOnReadProfileSettingsComplete = (UFunction*) SdkBindings::Get ( 3922 );
 	if ( ! pFnOnReadProfileSettingsComplete )
-		pFnOnReadProfileSettingsComplete = (UFunction*) UObject::GObjObjects()->Data[ 39367 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnReadProfileSettingsComplete_Parms OnReadProfileSettingsComplete_Parms;
 	OnReadProfileSettingsComplete_Parms.LocalUserNum = LocalUserNum;
@@ -29425,10 +28122,9 @@ void USFXOnlineComponentUnrealPlayer::OnReadProfileSettingsComplete ( unsigned c
 
 bool USFXOnlineComponentUnrealPlayer::ReadProfileSettings ( unsigned char LocalUserNum, class UOnlineProfileSettings* ProfileSettings )
 {
-	static UFunction* pFnReadProfileSettings = NULL;
-
+	UFunction* pFnReadProfileSettings = (UFunction*) SdkBindings::Get ( 3972 );
 	if ( ! pFnReadProfileSettings )
-		pFnReadProfileSettings = (UFunction*) UObject::GObjObjects()->Data[ 39526 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execReadProfileSettings_Parms ReadProfileSettings_Parms;
 	ReadProfileSettings_Parms.LocalUserNum = LocalUserNum;
@@ -29451,10 +28147,9 @@ bool USFXOnlineComponentUnrealPlayer::ReadProfileSettings ( unsigned char LocalU
 
 void USFXOnlineComponentUnrealPlayer::ClearFriendsChangeDelegate ( unsigned char LocalUserNum, struct FScriptDelegate FriendsDelegate )
 {
-	static UFunction* pFnClearFriendsChangeDelegate = NULL;
-
+	UFunction* pFnClearFriendsChangeDelegate = (UFunction*) SdkBindings::Get ( 3971 );
 	if ( ! pFnClearFriendsChangeDelegate )
-		pFnClearFriendsChangeDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39523 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearFriendsChangeDelegate_Parms ClearFriendsChangeDelegate_Parms;
 	ClearFriendsChangeDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -29471,10 +28166,9 @@ void USFXOnlineComponentUnrealPlayer::ClearFriendsChangeDelegate ( unsigned char
 
 void USFXOnlineComponentUnrealPlayer::AddFriendsChangeDelegate ( unsigned char LocalUserNum, struct FScriptDelegate FriendsDelegate )
 {
-	static UFunction* pFnAddFriendsChangeDelegate = NULL;
-
+	UFunction* pFnAddFriendsChangeDelegate = (UFunction*) SdkBindings::Get ( 3970 );
 	if ( ! pFnAddFriendsChangeDelegate )
-		pFnAddFriendsChangeDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39520 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execAddFriendsChangeDelegate_Parms AddFriendsChangeDelegate_Parms;
 	AddFriendsChangeDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -29490,10 +28184,9 @@ void USFXOnlineComponentUnrealPlayer::AddFriendsChangeDelegate ( unsigned char L
 
 void USFXOnlineComponentUnrealPlayer::ClearMutingChangeDelegate ( struct FScriptDelegate MutingDelegate )
 {
-	static UFunction* pFnClearMutingChangeDelegate = NULL;
-
+	UFunction* pFnClearMutingChangeDelegate = (UFunction*) SdkBindings::Get ( 3969 );
 	if ( ! pFnClearMutingChangeDelegate )
-		pFnClearMutingChangeDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39518 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearMutingChangeDelegate_Parms ClearMutingChangeDelegate_Parms;
 	memcpy ( &ClearMutingChangeDelegate_Parms.MutingDelegate, &MutingDelegate, 0xC );
@@ -29508,10 +28201,9 @@ void USFXOnlineComponentUnrealPlayer::ClearMutingChangeDelegate ( struct FScript
 
 void USFXOnlineComponentUnrealPlayer::AddMutingChangeDelegate ( struct FScriptDelegate MutingDelegate )
 {
-	static UFunction* pFnAddMutingChangeDelegate = NULL;
-
+	UFunction* pFnAddMutingChangeDelegate = (UFunction*) SdkBindings::Get ( 3968 );
 	if ( ! pFnAddMutingChangeDelegate )
-		pFnAddMutingChangeDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39516 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execAddMutingChangeDelegate_Parms AddMutingChangeDelegate_Parms;
 	memcpy ( &AddMutingChangeDelegate_Parms.MutingDelegate, &MutingDelegate, 0xC );
@@ -29526,10 +28218,9 @@ void USFXOnlineComponentUnrealPlayer::AddMutingChangeDelegate ( struct FScriptDe
 
 void USFXOnlineComponentUnrealPlayer::ClearLoginCancelledDelegate ( struct FScriptDelegate CancelledDelegate )
 {
-	static UFunction* pFnClearLoginCancelledDelegate = NULL;
-
+	UFunction* pFnClearLoginCancelledDelegate = (UFunction*) SdkBindings::Get ( 3967 );
 	if ( ! pFnClearLoginCancelledDelegate )
-		pFnClearLoginCancelledDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39513 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearLoginCancelledDelegate_Parms ClearLoginCancelledDelegate_Parms;
 	memcpy ( &ClearLoginCancelledDelegate_Parms.CancelledDelegate, &CancelledDelegate, 0xC );
@@ -29544,10 +28235,9 @@ void USFXOnlineComponentUnrealPlayer::ClearLoginCancelledDelegate ( struct FScri
 
 void USFXOnlineComponentUnrealPlayer::AddLoginCancelledDelegate ( struct FScriptDelegate CancelledDelegate )
 {
-	static UFunction* pFnAddLoginCancelledDelegate = NULL;
-
+	UFunction* pFnAddLoginCancelledDelegate = (UFunction*) SdkBindings::Get ( 3966 );
 	if ( ! pFnAddLoginCancelledDelegate )
-		pFnAddLoginCancelledDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39511 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execAddLoginCancelledDelegate_Parms AddLoginCancelledDelegate_Parms;
 	memcpy ( &AddLoginCancelledDelegate_Parms.CancelledDelegate, &CancelledDelegate, 0xC );
@@ -29563,10 +28253,9 @@ void USFXOnlineComponentUnrealPlayer::AddLoginCancelledDelegate ( struct FScript
 
 void USFXOnlineComponentUnrealPlayer::ClearLoginStatusChangeDelegate ( struct FScriptDelegate LoginStatusDelegate, unsigned char LocalUserNum )
 {
-	static UFunction* pFnClearLoginStatusChangeDelegate = NULL;
-
+	UFunction* pFnClearLoginStatusChangeDelegate = (UFunction*) SdkBindings::Get ( 3965 );
 	if ( ! pFnClearLoginStatusChangeDelegate )
-		pFnClearLoginStatusChangeDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39507 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearLoginStatusChangeDelegate_Parms ClearLoginStatusChangeDelegate_Parms;
 	memcpy ( &ClearLoginStatusChangeDelegate_Parms.LoginStatusDelegate, &LoginStatusDelegate, 0xC );
@@ -29583,10 +28272,9 @@ void USFXOnlineComponentUnrealPlayer::ClearLoginStatusChangeDelegate ( struct FS
 
 void USFXOnlineComponentUnrealPlayer::AddLoginStatusChangeDelegate ( struct FScriptDelegate LoginStatusDelegate, unsigned char LocalUserNum )
 {
-	static UFunction* pFnAddLoginStatusChangeDelegate = NULL;
-
+	UFunction* pFnAddLoginStatusChangeDelegate = (UFunction*) SdkBindings::Get ( 3964 );
 	if ( ! pFnAddLoginStatusChangeDelegate )
-		pFnAddLoginStatusChangeDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39503 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execAddLoginStatusChangeDelegate_Parms AddLoginStatusChangeDelegate_Parms;
 	memcpy ( &AddLoginStatusChangeDelegate_Parms.LoginStatusDelegate, &LoginStatusDelegate, 0xC );
@@ -29603,10 +28291,9 @@ void USFXOnlineComponentUnrealPlayer::AddLoginStatusChangeDelegate ( struct FScr
 
 void USFXOnlineComponentUnrealPlayer::OnLoginStatusChange ( unsigned char NewStatus, struct FUniqueNetId NewId )
 {
-	static UFunction* pFnOnLoginStatusChange = NULL;
-
+	UFunction* pFnOnLoginStatusChange = (UFunction*) SdkBindings::Get ( 3927 );
 	if ( ! pFnOnLoginStatusChange )
-		pFnOnLoginStatusChange = (UFunction*) UObject::GObjObjects()->Data[ 39392 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnLoginStatusChange_Parms OnLoginStatusChange_Parms;
 	OnLoginStatusChange_Parms.NewStatus = NewStatus;
@@ -29622,10 +28309,9 @@ void USFXOnlineComponentUnrealPlayer::OnLoginStatusChange ( unsigned char NewSta
 
 void USFXOnlineComponentUnrealPlayer::ClearLoginChangeDelegate ( struct FScriptDelegate LoginDelegate )
 {
-	static UFunction* pFnClearLoginChangeDelegate = NULL;
-
+	UFunction* pFnClearLoginChangeDelegate = (UFunction*) SdkBindings::Get ( 3963 );
 	if ( ! pFnClearLoginChangeDelegate )
-		pFnClearLoginChangeDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39498 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearLoginChangeDelegate_Parms ClearLoginChangeDelegate_Parms;
 	memcpy ( &ClearLoginChangeDelegate_Parms.LoginDelegate, &LoginDelegate, 0xC );
@@ -29640,10 +28326,9 @@ void USFXOnlineComponentUnrealPlayer::ClearLoginChangeDelegate ( struct FScriptD
 
 void USFXOnlineComponentUnrealPlayer::AddLoginChangeDelegate ( struct FScriptDelegate LoginDelegate )
 {
-	static UFunction* pFnAddLoginChangeDelegate = NULL;
-
+	UFunction* pFnAddLoginChangeDelegate = (UFunction*) SdkBindings::Get ( 3962 );
 	if ( ! pFnAddLoginChangeDelegate )
-		pFnAddLoginChangeDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39496 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execAddLoginChangeDelegate_Parms AddLoginChangeDelegate_Parms;
 	memcpy ( &AddLoginChangeDelegate_Parms.LoginDelegate, &LoginDelegate, 0xC );
@@ -29659,10 +28344,9 @@ void USFXOnlineComponentUnrealPlayer::AddLoginChangeDelegate ( struct FScriptDel
 
 bool USFXOnlineComponentUnrealPlayer::ShowFriendsUI ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnShowFriendsUI = NULL;
-
+	UFunction* pFnShowFriendsUI = (UFunction*) SdkBindings::Get ( 3961 );
 	if ( ! pFnShowFriendsUI )
-		pFnShowFriendsUI = (UFunction*) UObject::GObjObjects()->Data[ 39493 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execShowFriendsUI_Parms ShowFriendsUI_Parms;
 	ShowFriendsUI_Parms.LocalUserNum = LocalUserNum;
@@ -29681,10 +28365,9 @@ bool USFXOnlineComponentUnrealPlayer::ShowFriendsUI ( unsigned char LocalUserNum
 
 bool USFXOnlineComponentUnrealPlayer::IsMuted ( unsigned char LocalUserNum, struct FUniqueNetId PlayerID )
 {
-	static UFunction* pFnIsMuted = NULL;
-
+	UFunction* pFnIsMuted = (UFunction*) SdkBindings::Get ( 3960 );
 	if ( ! pFnIsMuted )
-		pFnIsMuted = (UFunction*) UObject::GObjObjects()->Data[ 39489 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execIsMuted_Parms IsMuted_Parms;
 	IsMuted_Parms.LocalUserNum = LocalUserNum;
@@ -29704,10 +28387,9 @@ bool USFXOnlineComponentUnrealPlayer::IsMuted ( unsigned char LocalUserNum, stru
 
 bool USFXOnlineComponentUnrealPlayer::AreAnyFriends ( unsigned char LocalUserNum, TArray< struct FFriendsQuery >* Query )
 {
-	static UFunction* pFnAreAnyFriends = NULL;
-
+	UFunction* pFnAreAnyFriends = (UFunction*) SdkBindings::Get ( 3959 );
 	if ( ! pFnAreAnyFriends )
-		pFnAreAnyFriends = (UFunction*) UObject::GObjObjects()->Data[ 39484 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execAreAnyFriends_Parms AreAnyFriends_Parms;
 	AreAnyFriends_Parms.LocalUserNum = LocalUserNum;
@@ -29729,10 +28411,9 @@ bool USFXOnlineComponentUnrealPlayer::AreAnyFriends ( unsigned char LocalUserNum
 
 bool USFXOnlineComponentUnrealPlayer::IsFriend ( unsigned char LocalUserNum, struct FUniqueNetId PlayerID )
 {
-	static UFunction* pFnIsFriend = NULL;
-
+	UFunction* pFnIsFriend = (UFunction*) SdkBindings::Get ( 3958 );
 	if ( ! pFnIsFriend )
-		pFnIsFriend = (UFunction*) UObject::GObjObjects()->Data[ 39480 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execIsFriend_Parms IsFriend_Parms;
 	IsFriend_Parms.LocalUserNum = LocalUserNum;
@@ -29751,10 +28432,9 @@ bool USFXOnlineComponentUnrealPlayer::IsFriend ( unsigned char LocalUserNum, str
 
 unsigned char USFXOnlineComponentUnrealPlayer::CanShowPresenceInformation ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnCanShowPresenceInformation = NULL;
-
+	UFunction* pFnCanShowPresenceInformation = (UFunction*) SdkBindings::Get ( 3957 );
 	if ( ! pFnCanShowPresenceInformation )
-		pFnCanShowPresenceInformation = (UFunction*) UObject::GObjObjects()->Data[ 39477 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execCanShowPresenceInformation_Parms CanShowPresenceInformation_Parms;
 	CanShowPresenceInformation_Parms.LocalUserNum = LocalUserNum;
@@ -29776,10 +28456,9 @@ unsigned char USFXOnlineComponentUnrealPlayer::CanShowPresenceInformation ( unsi
 
 unsigned char USFXOnlineComponentUnrealPlayer::CanViewPlayerProfiles ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnCanViewPlayerProfiles = NULL;
-
+	UFunction* pFnCanViewPlayerProfiles = (UFunction*) SdkBindings::Get ( 3956 );
 	if ( ! pFnCanViewPlayerProfiles )
-		pFnCanViewPlayerProfiles = (UFunction*) UObject::GObjObjects()->Data[ 39474 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execCanViewPlayerProfiles_Parms CanViewPlayerProfiles_Parms;
 	CanViewPlayerProfiles_Parms.LocalUserNum = LocalUserNum;
@@ -29801,10 +28480,9 @@ unsigned char USFXOnlineComponentUnrealPlayer::CanViewPlayerProfiles ( unsigned
 
 unsigned char USFXOnlineComponentUnrealPlayer::CanPurchaseContent ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnCanPurchaseContent = NULL;
-
+	UFunction* pFnCanPurchaseContent = (UFunction*) SdkBindings::Get ( 3955 );
 	if ( ! pFnCanPurchaseContent )
-		pFnCanPurchaseContent = (UFunction*) UObject::GObjObjects()->Data[ 39471 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execCanPurchaseContent_Parms CanPurchaseContent_Parms;
 	CanPurchaseContent_Parms.LocalUserNum = LocalUserNum;
@@ -29826,10 +28504,9 @@ unsigned char USFXOnlineComponentUnrealPlayer::CanPurchaseContent ( unsigned cha
 
 unsigned char USFXOnlineComponentUnrealPlayer::CanDownloadUserContent ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnCanDownloadUserContent = NULL;
-
+	UFunction* pFnCanDownloadUserContent = (UFunction*) SdkBindings::Get ( 3954 );
 	if ( ! pFnCanDownloadUserContent )
-		pFnCanDownloadUserContent = (UFunction*) UObject::GObjObjects()->Data[ 39468 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execCanDownloadUserContent_Parms CanDownloadUserContent_Parms;
 	CanDownloadUserContent_Parms.LocalUserNum = LocalUserNum;
@@ -29851,10 +28528,9 @@ unsigned char USFXOnlineComponentUnrealPlayer::CanDownloadUserContent ( unsigned
 
 unsigned char USFXOnlineComponentUnrealPlayer::CanCommunicate ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnCanCommunicate = NULL;
-
+	UFunction* pFnCanCommunicate = (UFunction*) SdkBindings::Get ( 3953 );
 	if ( ! pFnCanCommunicate )
-		pFnCanCommunicate = (UFunction*) UObject::GObjObjects()->Data[ 39465 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execCanCommunicate_Parms CanCommunicate_Parms;
 	CanCommunicate_Parms.LocalUserNum = LocalUserNum;
@@ -29876,10 +28552,9 @@ unsigned char USFXOnlineComponentUnrealPlayer::CanCommunicate ( unsigned char Lo
 
 unsigned char USFXOnlineComponentUnrealPlayer::CanPlayOnline ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnCanPlayOnline = NULL;
-
+	UFunction* pFnCanPlayOnline = (UFunction*) SdkBindings::Get ( 3952 );
 	if ( ! pFnCanPlayOnline )
-		pFnCanPlayOnline = (UFunction*) UObject::GObjObjects()->Data[ 39462 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execCanPlayOnline_Parms CanPlayOnline_Parms;
 	CanPlayOnline_Parms.LocalUserNum = LocalUserNum;
@@ -29901,10 +28576,9 @@ unsigned char USFXOnlineComponentUnrealPlayer::CanPlayOnline ( unsigned char Loc
 
 bool USFXOnlineComponentUnrealPlayer::IsLocalLogin ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnIsLocalLogin = NULL;
-
+	UFunction* pFnIsLocalLogin = (UFunction*) SdkBindings::Get ( 3951 );
 	if ( ! pFnIsLocalLogin )
-		pFnIsLocalLogin = (UFunction*) UObject::GObjObjects()->Data[ 39459 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execIsLocalLogin_Parms IsLocalLogin_Parms;
 	IsLocalLogin_Parms.LocalUserNum = LocalUserNum;
@@ -29926,10 +28600,9 @@ bool USFXOnlineComponentUnrealPlayer::IsLocalLogin ( unsigned char LocalUserNum
 
 bool USFXOnlineComponentUnrealPlayer::IsGuestLogin ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnIsGuestLogin = NULL;
-
+	UFunction* pFnIsGuestLogin = (UFunction*) SdkBindings::Get ( 3950 );
 	if ( ! pFnIsGuestLogin )
-		pFnIsGuestLogin = (UFunction*) UObject::GObjObjects()->Data[ 39456 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execIsGuestLogin_Parms IsGuestLogin_Parms;
 	IsGuestLogin_Parms.LocalUserNum = LocalUserNum;
@@ -29951,10 +28624,9 @@ bool USFXOnlineComponentUnrealPlayer::IsGuestLogin ( unsigned char LocalUserNum
 
 struct FString USFXOnlineComponentUnrealPlayer::GetPlayerNickname ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnGetPlayerNickname = NULL;
-
+	UFunction* pFnGetPlayerNickname = (UFunction*) SdkBindings::Get ( 3949 );
 	if ( ! pFnGetPlayerNickname )
-		pFnGetPlayerNickname = (UFunction*) UObject::GObjObjects()->Data[ 39453 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execGetPlayerNickname_Parms GetPlayerNickname_Parms;
 	GetPlayerNickname_Parms.LocalUserNum = LocalUserNum;
@@ -29977,10 +28649,9 @@ struct FString USFXOnlineComponentUnrealPlayer::GetPlayerNickname ( unsigned cha
 
 bool USFXOnlineComponentUnrealPlayer::GetUniquePlayerId ( unsigned char LocalUserNum, struct FUniqueNetId* PlayerID )
 {
-	static UFunction* pFnGetUniquePlayerId = NULL;
-
+	UFunction* pFnGetUniquePlayerId = (UFunction*) SdkBindings::Get ( 3948 );
 	if ( ! pFnGetUniquePlayerId )
-		pFnGetUniquePlayerId = (UFunction*) UObject::GObjObjects()->Data[ 39449 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execGetUniquePlayerId_Parms GetUniquePlayerId_Parms;
 	GetUniquePlayerId_Parms.LocalUserNum = LocalUserNum;
@@ -30006,10 +28677,9 @@ bool USFXOnlineComponentUnrealPlayer::GetUniquePlayerId ( unsigned char LocalUse
 
 bool USFXOnlineComponentUnrealPlayer::GetOfflinePlayerId ( unsigned char LocalUserNum, struct FUniqueNetId* PlayerID )
 {
-	static UFunction* pFnGetOfflinePlayerId = NULL;
-
+	UFunction* pFnGetOfflinePlayerId = (UFunction*) SdkBindings::Get ( 3947 );
 	if ( ! pFnGetOfflinePlayerId )
-		pFnGetOfflinePlayerId = (UFunction*) UObject::GObjObjects()->Data[ 39445 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execGetOfflinePlayerId_Parms GetOfflinePlayerId_Parms;
 	GetOfflinePlayerId_Parms.LocalUserNum = LocalUserNum;
@@ -30034,10 +28704,9 @@ bool USFXOnlineComponentUnrealPlayer::GetOfflinePlayerId ( unsigned char LocalUs
 
 unsigned char USFXOnlineComponentUnrealPlayer::GetLoginStatus ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnGetLoginStatus = NULL;
-
+	UFunction* pFnGetLoginStatus = (UFunction*) SdkBindings::Get ( 3946 );
 	if ( ! pFnGetLoginStatus )
-		pFnGetLoginStatus = (UFunction*) UObject::GObjObjects()->Data[ 39440 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execGetLoginStatus_Parms GetLoginStatus_Parms;
 	GetLoginStatus_Parms.LocalUserNum = LocalUserNum;
@@ -30055,10 +28724,9 @@ unsigned char USFXOnlineComponentUnrealPlayer::GetLoginStatus ( unsigned char Lo
 
 void USFXOnlineComponentUnrealPlayer::ClearLogoutCompletedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate LogoutDelegate )
 {
-	static UFunction* pFnClearLogoutCompletedDelegate = NULL;
-
+	UFunction* pFnClearLogoutCompletedDelegate = (UFunction*) SdkBindings::Get ( 3945 );
 	if ( ! pFnClearLogoutCompletedDelegate )
-		pFnClearLogoutCompletedDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39436 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearLogoutCompletedDelegate_Parms ClearLogoutCompletedDelegate_Parms;
 	ClearLogoutCompletedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -30075,10 +28743,9 @@ void USFXOnlineComponentUnrealPlayer::ClearLogoutCompletedDelegate ( unsigned ch
 
 void USFXOnlineComponentUnrealPlayer::AddLogoutCompletedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate LogoutDelegate )
 {
-	static UFunction* pFnAddLogoutCompletedDelegate = NULL;
-
+	UFunction* pFnAddLogoutCompletedDelegate = (UFunction*) SdkBindings::Get ( 3944 );
 	if ( ! pFnAddLogoutCompletedDelegate )
-		pFnAddLogoutCompletedDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39433 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execAddLogoutCompletedDelegate_Parms AddLogoutCompletedDelegate_Parms;
 	AddLogoutCompletedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -30094,10 +28761,9 @@ void USFXOnlineComponentUnrealPlayer::AddLogoutCompletedDelegate ( unsigned char
 
 void USFXOnlineComponentUnrealPlayer::OnLogoutCompleted ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnLogoutCompleted = NULL;
-
+	UFunction* pFnOnLogoutCompleted = (UFunction*) SdkBindings::Get ( 3920 );
 	if ( ! pFnOnLogoutCompleted )
-		pFnOnLogoutCompleted = (UFunction*) UObject::GObjObjects()->Data[ 39360 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnLogoutCompleted_Parms OnLogoutCompleted_Parms;
 	OnLogoutCompleted_Parms.bWasSuccessful = bWasSuccessful;
@@ -30113,10 +28779,9 @@ void USFXOnlineComponentUnrealPlayer::OnLogoutCompleted ( unsigned long bWasSucc
 
 bool USFXOnlineComponentUnrealPlayer::Logout ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnLogout = NULL;
-
+	UFunction* pFnLogout = (UFunction*) SdkBindings::Get ( 3943 );
 	if ( ! pFnLogout )
-		pFnLogout = (UFunction*) UObject::GObjObjects()->Data[ 39429 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execLogout_Parms Logout_Parms;
 	Logout_Parms.LocalUserNum = LocalUserNum;
@@ -30138,10 +28803,9 @@ bool USFXOnlineComponentUnrealPlayer::Logout ( unsigned char LocalUserNum )
 
 void USFXOnlineComponentUnrealPlayer::ClearLoginFailedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate LoginDelegate )
 {
-	static UFunction* pFnClearLoginFailedDelegate = NULL;
-
+	UFunction* pFnClearLoginFailedDelegate = (UFunction*) SdkBindings::Get ( 3942 );
 	if ( ! pFnClearLoginFailedDelegate )
-		pFnClearLoginFailedDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39425 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearLoginFailedDelegate_Parms ClearLoginFailedDelegate_Parms;
 	ClearLoginFailedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -30158,10 +28822,9 @@ void USFXOnlineComponentUnrealPlayer::ClearLoginFailedDelegate ( unsigned char L
 
 void USFXOnlineComponentUnrealPlayer::AddLoginFailedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate LoginDelegate )
 {
-	static UFunction* pFnAddLoginFailedDelegate = NULL;
-
+	UFunction* pFnAddLoginFailedDelegate = (UFunction*) SdkBindings::Get ( 3941 );
 	if ( ! pFnAddLoginFailedDelegate )
-		pFnAddLoginFailedDelegate = (UFunction*) UObject::GObjObjects()->Data[ 39422 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execAddLoginFailedDelegate_Parms AddLoginFailedDelegate_Parms;
 	AddLoginFailedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -30178,10 +28841,9 @@ void USFXOnlineComponentUnrealPlayer::AddLoginFailedDelegate ( unsigned char Loc
 
 void USFXOnlineComponentUnrealPlayer::OnLoginFailed ( unsigned char LocalUserNum, unsigned char errorCode )
 {
-	static UFunction* pFnOnLoginFailed = NULL;
-
+	UFunction* pFnOnLoginFailed = (UFunction*) SdkBindings::Get ( 3919 );
 	if ( ! pFnOnLoginFailed )
-		pFnOnLoginFailed = (UFunction*) UObject::GObjObjects()->Data[ 39357 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnLoginFailed_Parms OnLoginFailed_Parms;
 	OnLoginFailed_Parms.LocalUserNum = LocalUserNum;
@@ -30197,10 +28859,9 @@ void USFXOnlineComponentUnrealPlayer::OnLoginFailed ( unsigned char LocalUserNum
 
 bool USFXOnlineComponentUnrealPlayer::AutoLogin ( )
 {
-	static UFunction* pFnAutoLogin = NULL;
-
+	UFunction* pFnAutoLogin = (UFunction*) SdkBindings::Get ( 3940 );
 	if ( ! pFnAutoLogin )
-		pFnAutoLogin = (UFunction*) UObject::GObjObjects()->Data[ 39418 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execAutoLogin_Parms AutoLogin_Parms;
 
@@ -30224,10 +28885,9 @@ bool USFXOnlineComponentUnrealPlayer::AutoLogin ( )
 
 bool USFXOnlineComponentUnrealPlayer::Login ( unsigned char LocalUserNum, struct FString LoginName, struct FString Password, unsigned long bWantsLocalOnly )
 {
-	static UFunction* pFnLogin = NULL;
-
+	UFunction* pFnLogin = (UFunction*) SdkBindings::Get ( 3939 );
 	if ( ! pFnLogin )
-		pFnLogin = (UFunction*) UObject::GObjObjects()->Data[ 39412 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execLogin_Parms Login_Parms;
 	Login_Parms.LocalUserNum = LocalUserNum;
@@ -30252,10 +28912,9 @@ bool USFXOnlineComponentUnrealPlayer::Login ( unsigned char LocalUserNum, struct
 
 bool USFXOnlineComponentUnrealPlayer::ShowLoginUI ( unsigned long bShowOnlineOnly )
 {
-	static UFunction* pFnShowLoginUI = NULL;
-
+	UFunction* pFnShowLoginUI = (UFunction*) SdkBindings::Get ( 3938 );
 	if ( ! pFnShowLoginUI )
-		pFnShowLoginUI = (UFunction*) UObject::GObjObjects()->Data[ 39409 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execShowLoginUI_Parms ShowLoginUI_Parms;
 	ShowLoginUI_Parms.bShowOnlineOnly = bShowOnlineOnly;
@@ -30275,10 +28934,9 @@ bool USFXOnlineComponentUnrealPlayer::ShowLoginUI ( unsigned long bShowOnlineOnl
 
 void USFXOnlineComponentUnrealPlayer::ClearProfileCaches ( )
 {
-	static UFunction* pFnClearProfileCaches = NULL;
-
+	UFunction* pFnClearProfileCaches = (UFunction*) SdkBindings::Get ( 3937 );
 	if ( ! pFnClearProfileCaches )
-		pFnClearProfileCaches = (UFunction*) UObject::GObjObjects()->Data[ 39408 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execClearProfileCaches_Parms ClearProfileCaches_Parms;
 
@@ -30295,10 +28953,9 @@ void USFXOnlineComponentUnrealPlayer::ClearProfileCaches ( )
 
 void USFXOnlineComponentUnrealPlayer::OnFriendsChange ( )
 {
-	static UFunction* pFnOnFriendsChange = NULL;
-
+	UFunction* pFnOnFriendsChange = (UFunction*) SdkBindings::Get ( 3936 );
 	if ( ! pFnOnFriendsChange )
-		pFnOnFriendsChange = (UFunction*) UObject::GObjObjects()->Data[ 39407 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnFriendsChange_Parms OnFriendsChange_Parms;
 
@@ -30311,10 +28968,9 @@ void USFXOnlineComponentUnrealPlayer::OnFriendsChange ( )
 
 void USFXOnlineComponentUnrealPlayer::OnMutingChange ( )
 {
-	static UFunction* pFnOnMutingChange = NULL;
-
+	UFunction* pFnOnMutingChange = (UFunction*) SdkBindings::Get ( 3935 );
 	if ( ! pFnOnMutingChange )
-		pFnOnMutingChange = (UFunction*) UObject::GObjObjects()->Data[ 39406 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnMutingChange_Parms OnMutingChange_Parms;
 
@@ -30327,10 +28983,9 @@ void USFXOnlineComponentUnrealPlayer::OnMutingChange ( )
 
 void USFXOnlineComponentUnrealPlayer::OnLoginCancelled ( )
 {
-	static UFunction* pFnOnLoginCancelled = NULL;
-
+	UFunction* pFnOnLoginCancelled = (UFunction*) SdkBindings::Get ( 3918 );
 	if ( ! pFnOnLoginCancelled )
-		pFnOnLoginCancelled = (UFunction*) UObject::GObjObjects()->Data[ 39354 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnLoginCancelled_Parms OnLoginCancelled_Parms;
 
@@ -30344,10 +28999,9 @@ void USFXOnlineComponentUnrealPlayer::OnLoginCancelled ( )
 
 void USFXOnlineComponentUnrealPlayer::OnLoginChange ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnOnLoginChange = NULL;
-
+	UFunction* pFnOnLoginChange = (UFunction*) SdkBindings::Get ( 3921 );
 	if ( ! pFnOnLoginChange )
-		pFnOnLoginChange = (UFunction*) UObject::GObjObjects()->Data[ 39363 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnLoginChange_Parms OnLoginChange_Parms;
 	OnLoginChange_Parms.LocalUserNum = LocalUserNum;
@@ -30361,10 +29015,9 @@ void USFXOnlineComponentUnrealPlayer::OnLoginChange ( unsigned char LocalUserNum
 
 void USFXOnlineComponentUnrealPlayer::OnProfileDataChanged ( )
 {
-	static UFunction* pFnOnProfileDataChanged = NULL;
-
+	UFunction* pFnOnProfileDataChanged = (UFunction*) SdkBindings::Get ( 3924 );
 	if ( ! pFnOnProfileDataChanged )
-		pFnOnProfileDataChanged = (UFunction*) UObject::GObjObjects()->Data[ 39373 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnProfileDataChanged_Parms OnProfileDataChanged_Parms;
 
@@ -30377,10 +29030,9 @@ void USFXOnlineComponentUnrealPlayer::OnProfileDataChanged ( )
 
 void USFXOnlineComponentUnrealPlayer::CachePlayerNickname ( )
 {
-	static UFunction* pFnCachePlayerNickname = NULL;
-
+	UFunction* pFnCachePlayerNickname = (UFunction*) SdkBindings::Get ( 3934 );
 	if ( ! pFnCachePlayerNickname )
-		pFnCachePlayerNickname = (UFunction*) UObject::GObjObjects()->Data[ 39404 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execCachePlayerNickname_Parms CachePlayerNickname_Parms;
 
@@ -30398,10 +29050,9 @@ void USFXOnlineComponentUnrealPlayer::CachePlayerNickname ( )
 
 struct FString USFXOnlineComponentUnrealPlayer::CreateProfileName ( )
 {
-	static UFunction* pFnCreateProfileName = NULL;
-
+	UFunction* pFnCreateProfileName = (UFunction*) SdkBindings::Get ( 3933 );
 	if ( ! pFnCreateProfileName )
-		pFnCreateProfileName = (UFunction*) UObject::GObjObjects()->Data[ 39402 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execCreateProfileName_Parms CreateProfileName_Parms;
 
@@ -30421,10 +29072,9 @@ struct FString USFXOnlineComponentUnrealPlayer::CreateProfileName ( )
 
 bool USFXOnlineComponentUnrealPlayer::DoesProfileExist ( )
 {
-	static UFunction* pFnDoesProfileExist = NULL;
-
+	UFunction* pFnDoesProfileExist = (UFunction*) SdkBindings::Get ( 3932 );
 	if ( ! pFnDoesProfileExist )
-		pFnDoesProfileExist = (UFunction*) UObject::GObjObjects()->Data[ 39400 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execDoesProfileExist_Parms DoesProfileExist_Parms;
 
@@ -30444,10 +29094,9 @@ bool USFXOnlineComponentUnrealPlayer::DoesProfileExist ( )
 
 void USFXOnlineComponentUnrealPlayer::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
-
+	UFunction* pFnOnTick = (UFunction*) SdkBindings::Get ( 3931 );
 	if ( ! pFnOnTick )
-		pFnOnTick = (UFunction*) UObject::GObjObjects()->Data[ 39398 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
@@ -30466,10 +29115,9 @@ void USFXOnlineComponentUnrealPlayer::OnTick ( class USFXOnlineEvent* oEvent )
 
 struct FName USFXOnlineComponentUnrealPlayer::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3930 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 39396 ];
+		return {};
 
 	USFXOnlineComponentUnrealPlayer_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -30488,10 +29136,9 @@ struct FName USFXOnlineComponentUnrealPlayer::GetAPIName ( )
 
 void USFXOnlineComponentUnrealPlayer::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3929 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 39395 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnRelease_Parms OnRelease_Parms;
 
@@ -30509,10 +29156,9 @@ void USFXOnlineComponentUnrealPlayer::OnRelease ( )
 
 void USFXOnlineComponentUnrealPlayer::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3928 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 39393 ];
+		return;
 
 	USFXOnlineComponentUnrealPlayer_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -30530,10 +29176,9 @@ void USFXOnlineComponentUnrealPlayer::OnInitialize ( class USFXOnlineSubsystem*
 
 void USFXOnlineGameSearch::eventSortSearchResults ( )
 {
-	static UFunction* pFnSortSearchResults = NULL;
-
+	UFunction* pFnSortSearchResults = (UFunction*) SdkBindings::Get ( 2467 );
 	if ( ! pFnSortSearchResults )
-		pFnSortSearchResults = (UFunction*) UObject::GObjObjects()->Data[ 22272 ];
+		return;
 
 	USFXOnlineGameSearch_eventSortSearchResults_Parms SortSearchResults_Parms;
 
@@ -30552,10 +29197,9 @@ void USFXOnlineGameSearch::eventSortSearchResults ( )
 
 void USFXOnlineGameSearch::SetSkillOverride ( int LeaderboardId, TArray< struct FUniqueNetId >* Players )
 {
-	static UFunction* pFnSetSkillOverride = NULL;
-
+	UFunction* pFnSetSkillOverride = (UFunction*) SdkBindings::Get ( 2466 );
 	if ( ! pFnSetSkillOverride )
-		pFnSetSkillOverride = (UFunction*) UObject::GObjObjects()->Data[ 22267 ];
+		return;
 
 	USFXOnlineGameSearch_execSetSkillOverride_Parms SetSkillOverride_Parms;
 	SetSkillOverride_Parms.LeaderboardId = LeaderboardId;
@@ -30573,10 +29217,9 @@ void USFXOnlineGameSearch::SetSkillOverride ( int LeaderboardId, TArray< struct
 
 struct FString USFXOnlineGameSettings::ToString ( )
 {
-	static UFunction* pFnToString = NULL;
-
+	UFunction* pFnToString = (UFunction*) SdkBindings::Get ( 4192 );
 	if ( ! pFnToString )
-		pFnToString = (UFunction*) UObject::GObjObjects()->Data[ 40422 ];
+		return {};
 
 	USFXOnlineGameSettings_execToString_Parms ToString_Parms;
 
@@ -30592,10 +29235,9 @@ struct FString USFXOnlineGameSettings::ToString ( )
 
 class USFXOnlineGameSettings* USFXOnlineGameSettings::eventCopy ( )
 {
-	static UFunction* pFnCopy = NULL;
-
+	UFunction* pFnCopy = (UFunction*) SdkBindings::Get ( 4191 );
 	if ( ! pFnCopy )
-		pFnCopy = (UFunction*) UObject::GObjObjects()->Data[ 40414 ];
+		return {};
 
 	USFXOnlineGameSettings_eventCopy_Parms Copy_Parms;
 
@@ -30615,10 +29257,9 @@ class USFXOnlineGameSettings* USFXOnlineGameSettings::eventCopy ( )
 
 void USFXOnlineGameSettings::EnsureMatchSettingsAreValid ( unsigned char eType, int* PrivacySetting, int* MapSetting, int* EnemySetting, int* ChallengeSetting )
 {
-	static UFunction* pFnEnsureMatchSettingsAreValid = NULL;
-
+	UFunction* pFnEnsureMatchSettingsAreValid = (UFunction*) SdkBindings::Get ( 4190 );
 	if ( ! pFnEnsureMatchSettingsAreValid )
-		pFnEnsureMatchSettingsAreValid = (UFunction*) UObject::GObjObjects()->Data[ 40400 ];
+		return;
 
 	USFXOnlineGameSettings_execEnsureMatchSettingsAreValid_Parms EnsureMatchSettingsAreValid_Parms;
 	EnsureMatchSettingsAreValid_Parms.eType = eType;
@@ -30646,10 +29287,9 @@ void USFXOnlineGameSettings::EnsureMatchSettingsAreValid ( unsigned char eType,
 
 bool USFXOnlineGameSettings::ValidateMapName ( struct FString MapName )
 {
-	static UFunction* pFnValidateMapName = NULL;
-
+	UFunction* pFnValidateMapName = (UFunction*) SdkBindings::Get ( 4189 );
 	if ( ! pFnValidateMapName )
-		pFnValidateMapName = (UFunction*) UObject::GObjObjects()->Data[ 40397 ];
+		return {};
 
 	USFXOnlineGameSettings_execValidateMapName_Parms ValidateMapName_Parms;
 	memcpy ( &ValidateMapName_Parms.MapName, &MapName, 0xC );
@@ -30667,10 +29307,9 @@ bool USFXOnlineGameSettings::ValidateMapName ( struct FString MapName )
 
 struct FMPMapInfo USFXOnlineGameSettings::eventGetMapByServerMapID ( struct FString serverMapID )
 {
-	static UFunction* pFnGetMapByServerMapID = NULL;
-
+	UFunction* pFnGetMapByServerMapID = (UFunction*) SdkBindings::Get ( 4188 );
 	if ( ! pFnGetMapByServerMapID )
-		pFnGetMapByServerMapID = (UFunction*) UObject::GObjObjects()->Data[ 40393 ];
+		return {};
 
 	USFXOnlineGameSettings_eventGetMapByServerMapID_Parms GetMapByServerMapID_Parms;
 	memcpy ( &GetMapByServerMapID_Parms.serverMapID, &serverMapID, 0xC );
@@ -30688,10 +29327,9 @@ struct FMPMapInfo USFXOnlineGameSettings::eventGetMapByServerMapID ( struct FStr
 
 struct FMPMapInfo USFXOnlineGameSettings::GetMapByID ( int MapId )
 {
-	static UFunction* pFnGetMapByID = NULL;
-
+	UFunction* pFnGetMapByID = (UFunction*) SdkBindings::Get ( 4187 );
 	if ( ! pFnGetMapByID )
-		pFnGetMapByID = (UFunction*) UObject::GObjObjects()->Data[ 40388 ];
+		return {};
 
 	USFXOnlineGameSettings_execGetMapByID_Parms GetMapByID_Parms;
 	GetMapByID_Parms.MapId = MapId;
@@ -30709,10 +29347,9 @@ struct FMPMapInfo USFXOnlineGameSettings::GetMapByID ( int MapId )
 
 struct FMPMapInfo USFXOnlineGameSettings::GetMapByPackageName ( struct FString PackageName )
 {
-	static UFunction* pFnGetMapByPackageName = NULL;
-
+	UFunction* pFnGetMapByPackageName = (UFunction*) SdkBindings::Get ( 4186 );
 	if ( ! pFnGetMapByPackageName )
-		pFnGetMapByPackageName = (UFunction*) UObject::GObjObjects()->Data[ 40383 ];
+		return {};
 
 	USFXOnlineGameSettings_execGetMapByPackageName_Parms GetMapByPackageName_Parms;
 	memcpy ( &GetMapByPackageName_Parms.PackageName, &PackageName, 0xC );
@@ -30730,10 +29367,9 @@ struct FMPMapInfo USFXOnlineGameSettings::GetMapByPackageName ( struct FString P
 
 int USFXOnlineGameSettings::eventGetMasterMapID ( struct FString PackageName )
 {
-	static UFunction* pFnGetMasterMapID = NULL;
-
+	UFunction* pFnGetMasterMapID = (UFunction*) SdkBindings::Get ( 4184 );
 	if ( ! pFnGetMasterMapID )
-		pFnGetMasterMapID = (UFunction*) UObject::GObjObjects()->Data[ 40378 ];
+		return {};
 
 	USFXOnlineGameSettings_eventGetMasterMapID_Parms GetMasterMapID_Parms;
 	memcpy ( &GetMasterMapID_Parms.PackageName, &PackageName, 0xC );
@@ -30750,10 +29386,9 @@ int USFXOnlineGameSettings::eventGetMasterMapID ( struct FString PackageName )
 
 void USFXOnlineGameSettings::eventSetPrivacy ( unsigned char privacy )
 {
-	static UFunction* pFnSetPrivacy = NULL;
-
+	UFunction* pFnSetPrivacy = (UFunction*) SdkBindings::Get ( 4185 );
 	if ( ! pFnSetPrivacy )
-		pFnSetPrivacy = (UFunction*) UObject::GObjObjects()->Data[ 40382 ];
+		return;
 
 	USFXOnlineGameSettings_eventSetPrivacy_Parms SetPrivacy_Parms;
 	SetPrivacy_Parms.privacy = privacy;
@@ -30768,10 +29403,9 @@ void USFXOnlineGameSettings::eventSetPrivacy ( unsigned char privacy )
 
 unsigned char USFXOnlineGameSettings::eventGetPrivacy ( )
 {
-	static UFunction* pFnGetPrivacy = NULL;
-
+	UFunction* pFnGetPrivacy = (UFunction*) SdkBindings::Get ( 4193 );
 	if ( ! pFnGetPrivacy )
-		pFnGetPrivacy = (UFunction*) UObject::GObjObjects()->Data[ 40431 ];
+		return {};
 
 	USFXOnlineGameSettings_eventGetPrivacy_Parms GetPrivacy_Parms;
 
@@ -30787,10 +29421,9 @@ unsigned char USFXOnlineGameSettings::eventGetPrivacy ( )
 
 int USFXOnlineJob::GetSchedulingsLeft ( )
 {
-	static UFunction* pFnGetSchedulingsLeft = NULL;
-
+	UFunction* pFnGetSchedulingsLeft = (UFunction*) SdkBindings::Get ( 3512 );
 	if ( ! pFnGetSchedulingsLeft )
-		pFnGetSchedulingsLeft = (UFunction*) UObject::GObjObjects()->Data[ 37637 ];
+		return {};
 
 	USFXOnlineJob_execGetSchedulingsLeft_Parms GetSchedulingsLeft_Parms;
 
@@ -30806,10 +29439,9 @@ int USFXOnlineJob::GetSchedulingsLeft ( )
 
 void USFXOnlineJob::eventSetId ( int NewJobId )
 {
-	static UFunction* pFnSetId = NULL;
-
+	UFunction* pFnSetId = (UFunction*) SdkBindings::Get ( 3518 );
 	if ( ! pFnSetId )
-		pFnSetId = (UFunction*) UObject::GObjObjects()->Data[ 37653 ];
+		return;
 
 	USFXOnlineJob_eventSetId_Parms SetId_Parms;
 	SetId_Parms.NewJobId = NewJobId;
@@ -30824,10 +29456,9 @@ void USFXOnlineJob::eventSetId ( int NewJobId )
 
 bool USFXOnlineJob::eventIsCanceled ( )
 {
-	static UFunction* pFnIsCanceled = NULL;
-
+	UFunction* pFnIsCanceled = (UFunction*) SdkBindings::Get ( 3517 );
 	if ( ! pFnIsCanceled )
-		pFnIsCanceled = (UFunction*) UObject::GObjObjects()->Data[ 37651 ];
+		return {};
 
 	USFXOnlineJob_eventIsCanceled_Parms IsCanceled_Parms;
 
@@ -30843,10 +29474,9 @@ bool USFXOnlineJob::eventIsCanceled ( )
 
 void USFXOnlineJob::eventCancel ( unsigned char WithError )
 {
-	static UFunction* pFnCancel = NULL;
-
+	UFunction* pFnCancel = (UFunction*) SdkBindings::Get ( 3504 );
 	if ( ! pFnCancel )
-		pFnCancel = (UFunction*) UObject::GObjObjects()->Data[ 37622 ];
+		return;
 
 	USFXOnlineJob_eventCancel_Parms Cancel_Parms;
 	Cancel_Parms.WithError = WithError;
@@ -30860,10 +29490,9 @@ void USFXOnlineJob::eventCancel ( unsigned char WithError )
 
 void USFXOnlineJob::DeleteBlazeJobs ( )
 {
-	static UFunction* pFnDeleteBlazeJobs = NULL;
-
+	UFunction* pFnDeleteBlazeJobs = (UFunction*) SdkBindings::Get ( 3507 );
 	if ( ! pFnDeleteBlazeJobs )
-		pFnDeleteBlazeJobs = (UFunction*) UObject::GObjObjects()->Data[ 37629 ];
+		return;
 
 	USFXOnlineJob_execDeleteBlazeJobs_Parms DeleteBlazeJobs_Parms;
 
@@ -30880,10 +29509,9 @@ void USFXOnlineJob::DeleteBlazeJobs ( )
 
 void USFXOnlineJob::CancelBlazeJobs ( )
 {
-	static UFunction* pFnCancelBlazeJobs = NULL;
-
+	UFunction* pFnCancelBlazeJobs = (UFunction*) SdkBindings::Get ( 3516 );
 	if ( ! pFnCancelBlazeJobs )
-		pFnCancelBlazeJobs = (UFunction*) UObject::GObjObjects()->Data[ 37648 ];
+		return;
 
 	USFXOnlineJob_execCancelBlazeJobs_Parms CancelBlazeJobs_Parms;
 
@@ -30901,10 +29529,9 @@ void USFXOnlineJob::CancelBlazeJobs ( )
 
 bool USFXOnlineJob::eventInProgress ( )
 {
-	static UFunction* pFnInProgress = NULL;
-
+	UFunction* pFnInProgress = (UFunction*) SdkBindings::Get ( 3503 );
 	if ( ! pFnInProgress )
-		pFnInProgress = (UFunction*) UObject::GObjObjects()->Data[ 37620 ];
+		return {};
 
 	USFXOnlineJob_eventInProgress_Parms InProgress_Parms;
 
@@ -30920,10 +29547,9 @@ bool USFXOnlineJob::eventInProgress ( )
 
 unsigned char USFXOnlineJob::GetJobCategory ( )
 {
-	static UFunction* pFnGetJobCategory = NULL;
-
+	UFunction* pFnGetJobCategory = (UFunction*) SdkBindings::Get ( 3515 );
 	if ( ! pFnGetJobCategory )
-		pFnGetJobCategory = (UFunction*) UObject::GObjObjects()->Data[ 37644 ];
+		return {};
 
 	USFXOnlineJob_execGetJobCategory_Parms GetJobCategory_Parms;
 
@@ -30939,10 +29565,9 @@ unsigned char USFXOnlineJob::GetJobCategory ( )
 
 unsigned char USFXOnlineJob::eventGetJobType ( )
 {
-	static UFunction* pFnGetJobType = NULL;
-
+	UFunction* pFnGetJobType = (UFunction*) SdkBindings::Get ( 3514 );
 	if ( ! pFnGetJobType )
-		pFnGetJobType = (UFunction*) UObject::GObjObjects()->Data[ 37641 ];
+		return {};
 
 	USFXOnlineJob_eventGetJobType_Parms GetJobType_Parms;
 
@@ -30958,10 +29583,9 @@ unsigned char USFXOnlineJob::eventGetJobType ( )
 
 int USFXOnlineJob::eventGetId ( )
 {
-	static UFunction* pFnGetId = NULL;
-
+	UFunction* pFnGetId = (UFunction*) SdkBindings::Get ( 3513 );
 	if ( ! pFnGetId )
-		pFnGetId = (UFunction*) UObject::GObjObjects()->Data[ 37638 ];
+		return {};
 
 	USFXOnlineJob_eventGetId_Parms GetId_Parms;
 
@@ -30977,10 +29601,9 @@ int USFXOnlineJob::eventGetId ( )
 
 bool USFXOnlineJob::eventShouldReschedule ( )
 {
-	static UFunction* pFnShouldReschedule = NULL;
-
+	UFunction* pFnShouldReschedule = (UFunction*) SdkBindings::Get ( 3511 );
 	if ( ! pFnShouldReschedule )
-		pFnShouldReschedule = (UFunction*) UObject::GObjObjects()->Data[ 37635 ];
+		return {};
 
 	USFXOnlineJob_eventShouldReschedule_Parms ShouldReschedule_Parms;
 
@@ -30995,10 +29618,9 @@ bool USFXOnlineJob::eventShouldReschedule ( )
 
 void USFXOnlineJob::Tick ( )
 {
-	static UFunction* pFnTick = NULL;
-
+	UFunction* pFnTick = (UFunction*) SdkBindings::Get ( 3510 );
 	if ( ! pFnTick )
-		pFnTick = (UFunction*) UObject::GObjObjects()->Data[ 37634 ];
+		return;
 
 	USFXOnlineJob_execTick_Parms Tick_Parms;
 
@@ -31012,10 +29634,9 @@ void USFXOnlineJob::Tick ( )
 
 bool USFXOnlineJob::IsBlocking ( )
 {
-	static UFunction* pFnIsBlocking = NULL;
-
+	UFunction* pFnIsBlocking = (UFunction*) SdkBindings::Get ( 3509 );
 	if ( ! pFnIsBlocking )
-		pFnIsBlocking = (UFunction*) UObject::GObjObjects()->Data[ 37632 ];
+		return {};
 
 	USFXOnlineJob_execIsBlocking_Parms IsBlocking_Parms;
 
@@ -31031,10 +29652,9 @@ bool USFXOnlineJob::IsBlocking ( )
 
 bool USFXOnlineJob::DoExecute ( )
 {
-	static UFunction* pFnDoExecute = NULL;
-
+	UFunction* pFnDoExecute = (UFunction*) SdkBindings::Get ( 3508 );
 	if ( ! pFnDoExecute )
-		pFnDoExecute = (UFunction*) UObject::GObjObjects()->Data[ 37630 ];
+		return {};
 
 	USFXOnlineJob_execDoExecute_Parms DoExecute_Parms;
 
@@ -31049,10 +29669,9 @@ bool USFXOnlineJob::DoExecute ( )
 
 void USFXOnlineJob::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3506 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 37628 ];
+		return;
 
 	USFXOnlineJob_execOnRelease_Parms OnRelease_Parms;
 
@@ -31066,10 +29685,9 @@ void USFXOnlineJob::OnRelease ( )
 
 void USFXOnlineJob::eventEndProcessing ( unsigned char WithError )
 {
-	static UFunction* pFnEndProcessing = NULL;
-
+	UFunction* pFnEndProcessing = (UFunction*) SdkBindings::Get ( 3505 );
 	if ( ! pFnEndProcessing )
-		pFnEndProcessing = (UFunction*) UObject::GObjObjects()->Data[ 37626 ];
+		return;
 
 	USFXOnlineJob_eventEndProcessing_Parms EndProcessing_Parms;
 	EndProcessing_Parms.WithError = WithError;
@@ -31083,10 +29701,9 @@ void USFXOnlineJob::eventEndProcessing ( unsigned char WithError )
 
 void USFXOnlineJob::Execute ( )
 {
-	static UFunction* pFnExecute = NULL;
-
+	UFunction* pFnExecute = (UFunction*) SdkBindings::Get ( 3502 );
 	if ( ! pFnExecute )
-		pFnExecute = (UFunction*) UObject::GObjObjects()->Data[ 37618 ];
+		return;
 
 	USFXOnlineJob_execExecute_Parms Execute_Parms;
 
@@ -31102,10 +29719,9 @@ void USFXOnlineJob::Execute ( )
 
 class USFXOnlineJobGameReporting* USFXOnlineJobGameReporting::eventCreateJob ( struct FScriptDelegate InCallback, class UOnlineStatsWrite* StatsWrite )
 {
-	static UFunction* pFnCreateJob = NULL;
-
+	UFunction* pFnCreateJob = (UFunction*) SdkBindings::Get ( 3550 );
 	if ( ! pFnCreateJob )
-		pFnCreateJob = (UFunction*) UObject::GObjObjects()->Data[ 37750 ];
+		return {};
 
 	USFXOnlineJobGameReporting_eventCreateJob_Parms CreateJob_Parms;
 	memcpy ( &CreateJob_Parms.InCallback, &InCallback, 0xC );
@@ -31122,10 +29738,9 @@ class USFXOnlineJobGameReporting* USFXOnlineJobGameReporting::eventCreateJob ( s
 
 void USFXOnlineJobGameReporting::OnReleaseImpl ( )
 {
-	static UFunction* pFnOnReleaseImpl = NULL;
-
+	UFunction* pFnOnReleaseImpl = (UFunction*) SdkBindings::Get ( 4210 );
 	if ( ! pFnOnReleaseImpl )
-		pFnOnReleaseImpl = (UFunction*) UObject::GObjObjects()->Data[ 40489 ];
+		return;
 
 	USFXOnlineJobGameReporting_execOnReleaseImpl_Parms OnReleaseImpl_Parms;
 
@@ -31142,10 +29757,9 @@ void USFXOnlineJobGameReporting::OnReleaseImpl ( )
 
 void USFXOnlineJobGameReporting::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 4209 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 40488 ];
+		return;
 
 	USFXOnlineJobGameReporting_execOnRelease_Parms OnRelease_Parms;
 
@@ -31159,10 +29773,9 @@ void USFXOnlineJobGameReporting::OnRelease ( )
 
 void USFXOnlineJobGameReporting::BuildReport ( class UOnlineStatsWrite* StatsWrite )
 {
-	static UFunction* pFnBuildReport = NULL;
-
+	UFunction* pFnBuildReport = (UFunction*) SdkBindings::Get ( 4208 );
 	if ( ! pFnBuildReport )
-		pFnBuildReport = (UFunction*) UObject::GObjObjects()->Data[ 40486 ];
+		return;
 
 	USFXOnlineJobGameReporting_execBuildReport_Parms BuildReport_Parms;
 	BuildReport_Parms.StatsWrite = StatsWrite;
@@ -31181,10 +29794,9 @@ void USFXOnlineJobGameReporting::BuildReport ( class UOnlineStatsWrite* StatsWri
 
 bool USFXOnlineJobGameReporting::DoExecute ( )
 {
-	static UFunction* pFnDoExecute = NULL;
-
+	UFunction* pFnDoExecute = (UFunction*) SdkBindings::Get ( 4207 );
 	if ( ! pFnDoExecute )
-		pFnDoExecute = (UFunction*) UObject::GObjObjects()->Data[ 40484 ];
+		return {};
 
 	USFXOnlineJobGameReporting_execDoExecute_Parms DoExecute_Parms;
 
@@ -31205,10 +29817,9 @@ bool USFXOnlineJobGameReporting::DoExecute ( )
 
 void USFXOnlineJobGameReporting::GameReportingCallback ( unsigned char errorCode, int InJobId )
 {
-	static UFunction* pFnGameReportingCallback = NULL;
-
+	UFunction* pFnGameReportingCallback = (UFunction*) SdkBindings::Get ( 4206 );
 	if ( ! pFnGameReportingCallback )
-		pFnGameReportingCallback = (UFunction*) UObject::GObjObjects()->Data[ 40481 ];
+		return;
 
 	USFXOnlineJobGameReporting_execGameReportingCallback_Parms GameReportingCallback_Parms;
 	GameReportingCallback_Parms.errorCode = errorCode;
@@ -31224,10 +29835,9 @@ void USFXOnlineJobGameReporting::GameReportingCallback ( unsigned char errorCode
 
 bool USFXOnlineJobGaWHTTPRequest::eventAuthorizationFailed ( )
 {
-	static UFunction* pFnAuthorizationFailed = NULL;
-
+	UFunction* pFnAuthorizationFailed = (UFunction*) SdkBindings::Get ( 4223 );
 	if ( ! pFnAuthorizationFailed )
-		pFnAuthorizationFailed = (UFunction*) UObject::GObjObjects()->Data[ 40518 ];
+		return {};
 
 	USFXOnlineJobGaWHTTPRequest_eventAuthorizationFailed_Parms AuthorizationFailed_Parms;
 
@@ -31243,10 +29853,9 @@ bool USFXOnlineJobGaWHTTPRequest::eventAuthorizationFailed ( )
 
 bool USFXOnlineJobGaWHTTPRequest::eventShouldReschedule ( )
 {
-	static UFunction* pFnShouldReschedule = NULL;
-
+	UFunction* pFnShouldReschedule = (UFunction*) SdkBindings::Get ( 4222 );
 	if ( ! pFnShouldReschedule )
-		pFnShouldReschedule = (UFunction*) UObject::GObjObjects()->Data[ 40516 ];
+		return {};
 
 	USFXOnlineJobGaWHTTPRequest_eventShouldReschedule_Parms ShouldReschedule_Parms;
 
@@ -31261,10 +29870,9 @@ bool USFXOnlineJobGaWHTTPRequest::eventShouldReschedule ( )
 
 void USFXOnlineJobGaWHTTPRequest::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 4221 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 40515 ];
+		return;
 
 	USFXOnlineJobGaWHTTPRequest_execOnRelease_Parms OnRelease_Parms;
 
@@ -31277,10 +29885,9 @@ void USFXOnlineJobGaWHTTPRequest::OnRelease ( )
 
 void USFXOnlineJobGaWHTTPRequest::Tick ( )
 {
-	static UFunction* pFnTick = NULL;
-
+	UFunction* pFnTick = (UFunction*) SdkBindings::Get ( 4220 );
 	if ( ! pFnTick )
-		pFnTick = (UFunction*) UObject::GObjObjects()->Data[ 40514 ];
+		return;
 
 	USFXOnlineJobGaWHTTPRequest_execTick_Parms Tick_Parms;
 
@@ -31295,10 +29902,9 @@ void USFXOnlineJobGaWHTTPRequest::Tick ( )
 
 void USFXOnlineJobGaWHTTPRequest::eventAuthenticateHTTP ( struct FString token, int tokenType )
 {
-	static UFunction* pFnAuthenticateHTTP = NULL;
-
+	UFunction* pFnAuthenticateHTTP = (UFunction*) SdkBindings::Get ( 4218 );
 	if ( ! pFnAuthenticateHTTP )
-		pFnAuthenticateHTTP = (UFunction*) UObject::GObjObjects()->Data[ 40505 ];
+		return;
 
 	USFXOnlineJobGaWHTTPRequest_eventAuthenticateHTTP_Parms AuthenticateHTTP_Parms;
 	memcpy ( &AuthenticateHTTP_Parms.token, &token, 0xC );
@@ -31313,10 +29919,9 @@ void USFXOnlineJobGaWHTTPRequest::eventAuthenticateHTTP ( struct FString token,
 
 void USFXOnlineJobGaWHTTPRequest::AuthenticateHTTPResult ( )
 {
-	static UFunction* pFnAuthenticateHTTPResult = NULL;
-
+	UFunction* pFnAuthenticateHTTPResult = (UFunction*) SdkBindings::Get ( 4217 );
 	if ( ! pFnAuthenticateHTTPResult )
-		pFnAuthenticateHTTPResult = (UFunction*) UObject::GObjObjects()->Data[ 40504 ];
+		return;
 
 	USFXOnlineJobGaWHTTPRequest_execAuthenticateHTTPResult_Parms AuthenticateHTTPResult_Parms;
 
@@ -31334,10 +29939,9 @@ void USFXOnlineJobGaWHTTPRequest::AuthenticateHTTPResult ( )
 
 void USFXOnlineJobGaWHTTPRequest::JobFailedHandler ( unsigned char errorCode )
 {
-	static UFunction* pFnJobFailedHandler = NULL;
-
+	UFunction* pFnJobFailedHandler = (UFunction*) SdkBindings::Get ( 4216 );
 	if ( ! pFnJobFailedHandler )
-		pFnJobFailedHandler = (UFunction*) UObject::GObjObjects()->Data[ 40502 ];
+		return;
 
 	USFXOnlineJobGaWHTTPRequest_execJobFailedHandler_Parms JobFailedHandler_Parms;
 	JobFailedHandler_Parms.errorCode = errorCode;
@@ -31355,10 +29959,9 @@ void USFXOnlineJobGaWHTTPRequest::JobFailedHandler ( unsigned char errorCode )
 
 void USFXOnlineJobGaWHTTPRequest::TickInternal ( )
 {
-	static UFunction* pFnTickInternal = NULL;
-
+	UFunction* pFnTickInternal = (UFunction*) SdkBindings::Get ( 4215 );
 	if ( ! pFnTickInternal )
-		pFnTickInternal = (UFunction*) UObject::GObjObjects()->Data[ 40501 ];
+		return;
 
 	USFXOnlineJobGaWHTTPRequest_execTickInternal_Parms TickInternal_Parms;
 
@@ -31375,10 +29978,9 @@ void USFXOnlineJobGaWHTTPRequest::TickInternal ( )
 
 void USFXOnlineJobGaWHTTPRequest::GetAuthToken ( )
 {
-	static UFunction* pFnGetAuthToken = NULL;
-
+	UFunction* pFnGetAuthToken = (UFunction*) SdkBindings::Get ( 4214 );
 	if ( ! pFnGetAuthToken )
-		pFnGetAuthToken = (UFunction*) UObject::GObjObjects()->Data[ 40500 ];
+		return;
 
 	USFXOnlineJobGaWHTTPRequest_execGetAuthToken_Parms GetAuthToken_Parms;
 
@@ -31396,10 +29998,9 @@ void USFXOnlineJobGaWHTTPRequest::GetAuthToken ( )
 
 bool USFXOnlineJobGaWHTTPRequest::DoExecute ( )
 {
-	static UFunction* pFnDoExecute = NULL;
-
+	UFunction* pFnDoExecute = (UFunction*) SdkBindings::Get ( 4213 );
 	if ( ! pFnDoExecute )
-		pFnDoExecute = (UFunction*) UObject::GObjObjects()->Data[ 40498 ];
+		return {};
 
 	USFXOnlineJobGaWHTTPRequest_execDoExecute_Parms DoExecute_Parms;
 
@@ -31418,10 +30019,9 @@ bool USFXOnlineJobGaWHTTPRequest::DoExecute ( )
 
 void USFXOnlineJobGaWHTTPRequest::eventQueueSecondHTTPRequest ( )
 {
-	static UFunction* pFnQueueSecondHTTPRequest = NULL;
-
+	UFunction* pFnQueueSecondHTTPRequest = (UFunction*) SdkBindings::Get ( 4212 );
 	if ( ! pFnQueueSecondHTTPRequest )
-		pFnQueueSecondHTTPRequest = (UFunction*) UObject::GObjObjects()->Data[ 40497 ];
+		return;
 
 	USFXOnlineJobGaWHTTPRequest_eventQueueSecondHTTPRequest_Parms QueueSecondHTTPRequest_Parms;
 
@@ -31434,10 +30034,9 @@ void USFXOnlineJobGaWHTTPRequest::eventQueueSecondHTTPRequest ( )
 
 void USFXOnlineJobGaWHTTPRequest::HandleSecondHTTPResult ( )
 {
-	static UFunction* pFnHandleSecondHTTPResult = NULL;
-
+	UFunction* pFnHandleSecondHTTPResult = (UFunction*) SdkBindings::Get ( 4211 );
 	if ( ! pFnHandleSecondHTTPResult )
-		pFnHandleSecondHTTPResult = (UFunction*) UObject::GObjObjects()->Data[ 40496 ];
+		return;
 
 	USFXOnlineJobGaWHTTPRequest_execHandleSecondHTTPResult_Parms HandleSecondHTTPResult_Parms;
 
@@ -31454,10 +30053,9 @@ void USFXOnlineJobGaWHTTPRequest::HandleSecondHTTPResult ( )
 
 void USFXOnlineJobGaWHTTPGetMessages::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 4228 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 40538 ];
+		return;
 
 	USFXOnlineJobGaWHTTPGetMessages_execOnRelease_Parms OnRelease_Parms;
 
@@ -31470,10 +30068,9 @@ void USFXOnlineJobGaWHTTPGetMessages::OnRelease ( )
 
 void USFXOnlineJobGaWHTTPGetMessages::eventQueueSecondHTTPRequest ( )
 {
-	static UFunction* pFnQueueSecondHTTPRequest = NULL;
-
+	UFunction* pFnQueueSecondHTTPRequest = (UFunction*) SdkBindings::Get ( 4227 );
 	if ( ! pFnQueueSecondHTTPRequest )
-		pFnQueueSecondHTTPRequest = (UFunction*) UObject::GObjObjects()->Data[ 40535 ];
+		return;
 
 	USFXOnlineJobGaWHTTPGetMessages_eventQueueSecondHTTPRequest_Parms QueueSecondHTTPRequest_Parms;
 
@@ -31489,10 +30086,9 @@ void USFXOnlineJobGaWHTTPGetMessages::eventQueueSecondHTTPRequest ( )
 
 class USFXOnlineJobGaWHTTPGetMessages* USFXOnlineJobGaWHTTPGetMessages::eventCreateGaWGetMessagesJob ( int msgType, struct FScriptDelegate RequestCompleteDelegate )
 {
-	static UFunction* pFnCreateGaWGetMessagesJob = NULL;
-
+	UFunction* pFnCreateGaWGetMessagesJob = (UFunction*) SdkBindings::Get ( 3653 );
 	if ( ! pFnCreateGaWGetMessagesJob )
-		pFnCreateGaWGetMessagesJob = (UFunction*) UObject::GObjObjects()->Data[ 38145 ];
+		return {};
 
 	USFXOnlineJobGaWHTTPGetMessages_eventCreateGaWGetMessagesJob_Parms CreateGaWGetMessagesJob_Parms;
 	CreateGaWGetMessagesJob_Parms.msgType = msgType;
@@ -31510,10 +30106,9 @@ class USFXOnlineJobGaWHTTPGetMessages* USFXOnlineJobGaWHTTPGetMessages::eventCre
 
 void USFXOnlineJobGaWHTTPGetMessages::JobFailedHandler ( unsigned char errorCode )
 {
-	static UFunction* pFnJobFailedHandler = NULL;
-
+	UFunction* pFnJobFailedHandler = (UFunction*) SdkBindings::Get ( 4226 );
 	if ( ! pFnJobFailedHandler )
-		pFnJobFailedHandler = (UFunction*) UObject::GObjObjects()->Data[ 40528 ];
+		return;
 
 	USFXOnlineJobGaWHTTPGetMessages_execJobFailedHandler_Parms JobFailedHandler_Parms;
 	JobFailedHandler_Parms.errorCode = errorCode;
@@ -31531,10 +30126,9 @@ void USFXOnlineJobGaWHTTPGetMessages::JobFailedHandler ( unsigned char errorCode
 
 void USFXOnlineJobGaWHTTPGetMessages::HandleSecondHTTPResult ( )
 {
-	static UFunction* pFnHandleSecondHTTPResult = NULL;
-
+	UFunction* pFnHandleSecondHTTPResult = (UFunction*) SdkBindings::Get ( 4225 );
 	if ( ! pFnHandleSecondHTTPResult )
-		pFnHandleSecondHTTPResult = (UFunction*) UObject::GObjObjects()->Data[ 40527 ];
+		return;
 
 	USFXOnlineJobGaWHTTPGetMessages_execHandleSecondHTTPResult_Parms HandleSecondHTTPResult_Parms;
 
@@ -31553,10 +30147,9 @@ void USFXOnlineJobGaWHTTPGetMessages::HandleSecondHTTPResult ( )
 
 void USFXOnlineJobGaWHTTPGetMessages::OnGetMessagesComplete ( TArray< struct FMessageEntry > Messages, int errorCode )
 {
-	static UFunction* pFnOnGetMessagesComplete = NULL;
-
+	UFunction* pFnOnGetMessagesComplete = (UFunction*) SdkBindings::Get ( 4224 );
 	if ( ! pFnOnGetMessagesComplete )
-		pFnOnGetMessagesComplete = (UFunction*) UObject::GObjObjects()->Data[ 40523 ];
+		return;
 
 	USFXOnlineJobGaWHTTPGetMessages_execOnGetMessagesComplete_Parms OnGetMessagesComplete_Parms;
 	memcpy ( &OnGetMessagesComplete_Parms.Messages, &Messages, 0xC );
@@ -31571,10 +30164,9 @@ void USFXOnlineJobGaWHTTPGetMessages::OnGetMessagesComplete ( TArray< struct FMe
 
 void USFXOnlineJobGaWHTTPGetRatings::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 4233 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 40559 ];
+		return;
 
 	USFXOnlineJobGaWHTTPGetRatings_execOnRelease_Parms OnRelease_Parms;
 
@@ -31587,10 +30179,9 @@ void USFXOnlineJobGaWHTTPGetRatings::OnRelease ( )
 
 void USFXOnlineJobGaWHTTPGetRatings::eventQueueSecondHTTPRequest ( )
 {
-	static UFunction* pFnQueueSecondHTTPRequest = NULL;
-
+	UFunction* pFnQueueSecondHTTPRequest = (UFunction*) SdkBindings::Get ( 4232 );
 	if ( ! pFnQueueSecondHTTPRequest )
-		pFnQueueSecondHTTPRequest = (UFunction*) UObject::GObjObjects()->Data[ 40556 ];
+		return;
 
 	USFXOnlineJobGaWHTTPGetRatings_eventQueueSecondHTTPRequest_Parms QueueSecondHTTPRequest_Parms;
 
@@ -31606,10 +30197,9 @@ void USFXOnlineJobGaWHTTPGetRatings::eventQueueSecondHTTPRequest ( )
 
 class USFXOnlineJobGaWHTTPGetRatings* USFXOnlineJobGaWHTTPGetRatings::eventCreateGaWGetRatingsJob ( unsigned long includeWarAssets, struct FScriptDelegate RequestCompleteDelegate )
 {
-	static UFunction* pFnCreateGaWGetRatingsJob = NULL;
-
+	UFunction* pFnCreateGaWGetRatingsJob = (UFunction*) SdkBindings::Get ( 3647 );
 	if ( ! pFnCreateGaWGetRatingsJob )
-		pFnCreateGaWGetRatingsJob = (UFunction*) UObject::GObjObjects()->Data[ 38120 ];
+		return {};
 
 	USFXOnlineJobGaWHTTPGetRatings_eventCreateGaWGetRatingsJob_Parms CreateGaWGetRatingsJob_Parms;
 	CreateGaWGetRatingsJob_Parms.includeWarAssets = includeWarAssets;
@@ -31627,10 +30217,9 @@ class USFXOnlineJobGaWHTTPGetRatings* USFXOnlineJobGaWHTTPGetRatings::eventCreat
 
 void USFXOnlineJobGaWHTTPGetRatings::JobFailedHandler ( unsigned char errorCode )
 {
-	static UFunction* pFnJobFailedHandler = NULL;
-
+	UFunction* pFnJobFailedHandler = (UFunction*) SdkBindings::Get ( 4231 );
 	if ( ! pFnJobFailedHandler )
-		pFnJobFailedHandler = (UFunction*) UObject::GObjObjects()->Data[ 40549 ];
+		return;
 
 	USFXOnlineJobGaWHTTPGetRatings_execJobFailedHandler_Parms JobFailedHandler_Parms;
 	JobFailedHandler_Parms.errorCode = errorCode;
@@ -31648,10 +30237,9 @@ void USFXOnlineJobGaWHTTPGetRatings::JobFailedHandler ( unsigned char errorCode
 
 void USFXOnlineJobGaWHTTPGetRatings::HandleSecondHTTPResult ( )
 {
-	static UFunction* pFnHandleSecondHTTPResult = NULL;
-
+	UFunction* pFnHandleSecondHTTPResult = (UFunction*) SdkBindings::Get ( 4230 );
 	if ( ! pFnHandleSecondHTTPResult )
-		pFnHandleSecondHTTPResult = (UFunction*) UObject::GObjObjects()->Data[ 40548 ];
+		return;
 
 	USFXOnlineJobGaWHTTPGetRatings_execHandleSecondHTTPResult_Parms HandleSecondHTTPResult_Parms;
 
@@ -31672,10 +30260,9 @@ void USFXOnlineJobGaWHTTPGetRatings::HandleSecondHTTPResult ( )
 
 void USFXOnlineJobGaWHTTPGetRatings::OnGetRatingsComplete ( TArray< int > updatedSecurityRatings, TArray< int > updatedWarAssets, int Level, int errorCode )
 {
-	static UFunction* pFnOnGetRatingsComplete = NULL;
-
+	UFunction* pFnOnGetRatingsComplete = (UFunction*) SdkBindings::Get ( 4229 );
 	if ( ! pFnOnGetRatingsComplete )
-		pFnOnGetRatingsComplete = (UFunction*) UObject::GObjObjects()->Data[ 40541 ];
+		return;
 
 	USFXOnlineJobGaWHTTPGetRatings_execOnGetRatingsComplete_Parms OnGetRatingsComplete_Parms;
 	memcpy ( &OnGetRatingsComplete_Parms.updatedSecurityRatings, &updatedSecurityRatings, 0xC );
@@ -31692,10 +30279,9 @@ void USFXOnlineJobGaWHTTPGetRatings::OnGetRatingsComplete ( TArray< int > update
 
 void USFXOnlineJobGaWHTTPIncreaseRatings::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 4238 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 40592 ];
+		return;
 
 	USFXOnlineJobGaWHTTPIncreaseRatings_execOnRelease_Parms OnRelease_Parms;
 
@@ -31708,10 +30294,9 @@ void USFXOnlineJobGaWHTTPIncreaseRatings::OnRelease ( )
 
 void USFXOnlineJobGaWHTTPIncreaseRatings::eventQueueSecondHTTPRequest ( )
 {
-	static UFunction* pFnQueueSecondHTTPRequest = NULL;
-
+	UFunction* pFnQueueSecondHTTPRequest = (UFunction*) SdkBindings::Get ( 4237 );
 	if ( ! pFnQueueSecondHTTPRequest )
-		pFnQueueSecondHTTPRequest = (UFunction*) UObject::GObjObjects()->Data[ 40589 ];
+		return;
 
 	USFXOnlineJobGaWHTTPIncreaseRatings_eventQueueSecondHTTPRequest_Parms QueueSecondHTTPRequest_Parms;
 
@@ -31729,10 +30314,9 @@ void USFXOnlineJobGaWHTTPIncreaseRatings::eventQueueSecondHTTPRequest ( )
 
 class USFXOnlineJobGaWHTTPIncreaseRatings* USFXOnlineJobGaWHTTPIncreaseRatings::eventCreateGaWIncreaseRatingsJob ( int inDefaultRatingIncrease, TArray< struct FMapEntry > inSecurityRatingIncrease, TArray< struct FMapEntry > inWarAssetIncrease, struct FScriptDelegate RequestCompleteDelegate )
 {
-	static UFunction* pFnCreateGaWIncreaseRatingsJob = NULL;
-
+	UFunction* pFnCreateGaWIncreaseRatingsJob = (UFunction*) SdkBindings::Get ( 3649 );
 	if ( ! pFnCreateGaWIncreaseRatingsJob )
-		pFnCreateGaWIncreaseRatingsJob = (UFunction*) UObject::GObjObjects()->Data[ 38130 ];
+		return {};
 
 	USFXOnlineJobGaWHTTPIncreaseRatings_eventCreateGaWIncreaseRatingsJob_Parms CreateGaWIncreaseRatingsJob_Parms;
 	CreateGaWIncreaseRatingsJob_Parms.inDefaultRatingIncrease = inDefaultRatingIncrease;
@@ -31752,10 +30336,9 @@ class USFXOnlineJobGaWHTTPIncreaseRatings* USFXOnlineJobGaWHTTPIncreaseRatings::
 
 void USFXOnlineJobGaWHTTPIncreaseRatings::JobFailedHandler ( unsigned char errorCode )
 {
-	static UFunction* pFnJobFailedHandler = NULL;
-
+	UFunction* pFnJobFailedHandler = (UFunction*) SdkBindings::Get ( 4236 );
 	if ( ! pFnJobFailedHandler )
-		pFnJobFailedHandler = (UFunction*) UObject::GObjObjects()->Data[ 40578 ];
+		return;
 
 	USFXOnlineJobGaWHTTPIncreaseRatings_execJobFailedHandler_Parms JobFailedHandler_Parms;
 	JobFailedHandler_Parms.errorCode = errorCode;
@@ -31773,10 +30356,9 @@ void USFXOnlineJobGaWHTTPIncreaseRatings::JobFailedHandler ( unsigned char error
 
 void USFXOnlineJobGaWHTTPIncreaseRatings::HandleSecondHTTPResult ( )
 {
-	static UFunction* pFnHandleSecondHTTPResult = NULL;
-
+	UFunction* pFnHandleSecondHTTPResult = (UFunction*) SdkBindings::Get ( 4235 );
 	if ( ! pFnHandleSecondHTTPResult )
-		pFnHandleSecondHTTPResult = (UFunction*) UObject::GObjObjects()->Data[ 40577 ];
+		return;
 
 	USFXOnlineJobGaWHTTPIncreaseRatings_execHandleSecondHTTPResult_Parms HandleSecondHTTPResult_Parms;
 
@@ -31797,10 +30379,9 @@ void USFXOnlineJobGaWHTTPIncreaseRatings::HandleSecondHTTPResult ( )
 
 void USFXOnlineJobGaWHTTPIncreaseRatings::OnIncreaseRatingsComplete ( TArray< int > updatedSecurityRatings, TArray< int > updatedWarAssets, int Level, int errorCode )
 {
-	static UFunction* pFnOnIncreaseRatingsComplete = NULL;
-
+	UFunction* pFnOnIncreaseRatingsComplete = (UFunction*) SdkBindings::Get ( 4234 );
 	if ( ! pFnOnIncreaseRatingsComplete )
-		pFnOnIncreaseRatingsComplete = (UFunction*) UObject::GObjObjects()->Data[ 40570 ];
+		return;
 
 	USFXOnlineJobGaWHTTPIncreaseRatings_execOnIncreaseRatingsComplete_Parms OnIncreaseRatingsComplete_Parms;
 	memcpy ( &OnIncreaseRatingsComplete_Parms.updatedSecurityRatings, &updatedSecurityRatings, 0xC );
@@ -31817,10 +30398,9 @@ void USFXOnlineJobGaWHTTPIncreaseRatings::OnIncreaseRatingsComplete ( TArray< in
 
 void USFXOnlineJobGaWHTTPSendMessage::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 4243 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 40620 ];
+		return;
 
 	USFXOnlineJobGaWHTTPSendMessage_execOnRelease_Parms OnRelease_Parms;
 
@@ -31833,10 +30413,9 @@ void USFXOnlineJobGaWHTTPSendMessage::OnRelease ( )
 
 void USFXOnlineJobGaWHTTPSendMessage::eventQueueSecondHTTPRequest ( )
 {
-	static UFunction* pFnQueueSecondHTTPRequest = NULL;
-
+	UFunction* pFnQueueSecondHTTPRequest = (UFunction*) SdkBindings::Get ( 4242 );
 	if ( ! pFnQueueSecondHTTPRequest )
-		pFnQueueSecondHTTPRequest = (UFunction*) UObject::GObjObjects()->Data[ 40617 ];
+		return;
 
 	USFXOnlineJobGaWHTTPSendMessage_eventQueueSecondHTTPRequest_Parms QueueSecondHTTPRequest_Parms;
 
@@ -31855,10 +30434,9 @@ void USFXOnlineJobGaWHTTPSendMessage::eventQueueSecondHTTPRequest ( )
 
 class USFXOnlineJobGaWHTTPSendMessage* USFXOnlineJobGaWHTTPSendMessage::eventCreateGaWSendMessageJob ( int msgType, struct FString sendMsgParam1, struct FString sendMsgParam2, struct FString sendMsgParam3, struct FScriptDelegate RequestCompleteDelegate )
 {
-	static UFunction* pFnCreateGaWSendMessageJob = NULL;
-
+	UFunction* pFnCreateGaWSendMessageJob = (UFunction*) SdkBindings::Get ( 3651 );
 	if ( ! pFnCreateGaWSendMessageJob )
-		pFnCreateGaWSendMessageJob = (UFunction*) UObject::GObjObjects()->Data[ 38139 ];
+		return {};
 
 	USFXOnlineJobGaWHTTPSendMessage_eventCreateGaWSendMessageJob_Parms CreateGaWSendMessageJob_Parms;
 	CreateGaWSendMessageJob_Parms.msgType = msgType;
@@ -31879,10 +30457,9 @@ class USFXOnlineJobGaWHTTPSendMessage* USFXOnlineJobGaWHTTPSendMessage::eventCre
 
 void USFXOnlineJobGaWHTTPSendMessage::JobFailedHandler ( unsigned char errorCode )
 {
-	static UFunction* pFnJobFailedHandler = NULL;
-
+	UFunction* pFnJobFailedHandler = (UFunction*) SdkBindings::Get ( 4241 );
 	if ( ! pFnJobFailedHandler )
-		pFnJobFailedHandler = (UFunction*) UObject::GObjObjects()->Data[ 40604 ];
+		return;
 
 	USFXOnlineJobGaWHTTPSendMessage_execJobFailedHandler_Parms JobFailedHandler_Parms;
 	JobFailedHandler_Parms.errorCode = errorCode;
@@ -31900,10 +30477,9 @@ void USFXOnlineJobGaWHTTPSendMessage::JobFailedHandler ( unsigned char errorCode
 
 void USFXOnlineJobGaWHTTPSendMessage::HandleSecondHTTPResult ( )
 {
-	static UFunction* pFnHandleSecondHTTPResult = NULL;
-
+	UFunction* pFnHandleSecondHTTPResult = (UFunction*) SdkBindings::Get ( 4240 );
 	if ( ! pFnHandleSecondHTTPResult )
-		pFnHandleSecondHTTPResult = (UFunction*) UObject::GObjObjects()->Data[ 40603 ];
+		return;
 
 	USFXOnlineJobGaWHTTPSendMessage_execHandleSecondHTTPResult_Parms HandleSecondHTTPResult_Parms;
 
@@ -31923,10 +30499,9 @@ void USFXOnlineJobGaWHTTPSendMessage::HandleSecondHTTPResult ( )
 
 void USFXOnlineJobGaWHTTPSendMessage::OnSendMessageComplete ( int messageId, TArray< int > messageIds, int errorCode )
 {
-	static UFunction* pFnOnSendMessageComplete = NULL;
-
+	UFunction* pFnOnSendMessageComplete = (UFunction*) SdkBindings::Get ( 4239 );
 	if ( ! pFnOnSendMessageComplete )
-		pFnOnSendMessageComplete = (UFunction*) UObject::GObjObjects()->Data[ 40598 ];
+		return;
 
 	USFXOnlineJobGaWHTTPSendMessage_execOnSendMessageComplete_Parms OnSendMessageComplete_Parms;
 	OnSendMessageComplete_Parms.messageId = messageId;
@@ -31942,10 +30517,9 @@ void USFXOnlineJobGaWHTTPSendMessage::OnSendMessageComplete ( int messageId, TAr
 
 void USFXOnlineJobGaWHTTPTouchMessages::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 4248 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 40638 ];
+		return;
 
 	USFXOnlineJobGaWHTTPTouchMessages_execOnRelease_Parms OnRelease_Parms;
 
@@ -31958,10 +30532,9 @@ void USFXOnlineJobGaWHTTPTouchMessages::OnRelease ( )
 
 void USFXOnlineJobGaWHTTPTouchMessages::eventQueueSecondHTTPRequest ( )
 {
-	static UFunction* pFnQueueSecondHTTPRequest = NULL;
-
+	UFunction* pFnQueueSecondHTTPRequest = (UFunction*) SdkBindings::Get ( 4247 );
 	if ( ! pFnQueueSecondHTTPRequest )
-		pFnQueueSecondHTTPRequest = (UFunction*) UObject::GObjObjects()->Data[ 40635 ];
+		return;
 
 	USFXOnlineJobGaWHTTPTouchMessages_eventQueueSecondHTTPRequest_Parms QueueSecondHTTPRequest_Parms;
 
@@ -31977,10 +30550,9 @@ void USFXOnlineJobGaWHTTPTouchMessages::eventQueueSecondHTTPRequest ( )
 
 class USFXOnlineJobGaWHTTPTouchMessages* USFXOnlineJobGaWHTTPTouchMessages::eventCreateGaWTouchMessagesJob ( int msgType, struct FScriptDelegate RequestCompleteDelegate )
 {
-	static UFunction* pFnCreateGaWTouchMessagesJob = NULL;
-
+	UFunction* pFnCreateGaWTouchMessagesJob = (UFunction*) SdkBindings::Get ( 3655 );
 	if ( ! pFnCreateGaWTouchMessagesJob )
-		pFnCreateGaWTouchMessagesJob = (UFunction*) UObject::GObjObjects()->Data[ 38151 ];
+		return {};
 
 	USFXOnlineJobGaWHTTPTouchMessages_eventCreateGaWTouchMessagesJob_Parms CreateGaWTouchMessagesJob_Parms;
 	CreateGaWTouchMessagesJob_Parms.msgType = msgType;
@@ -31998,10 +30570,9 @@ class USFXOnlineJobGaWHTTPTouchMessages* USFXOnlineJobGaWHTTPTouchMessages::even
 
 void USFXOnlineJobGaWHTTPTouchMessages::JobFailedHandler ( unsigned char errorCode )
 {
-	static UFunction* pFnJobFailedHandler = NULL;
-
+	UFunction* pFnJobFailedHandler = (UFunction*) SdkBindings::Get ( 4246 );
 	if ( ! pFnJobFailedHandler )
-		pFnJobFailedHandler = (UFunction*) UObject::GObjObjects()->Data[ 40628 ];
+		return;
 
 	USFXOnlineJobGaWHTTPTouchMessages_execJobFailedHandler_Parms JobFailedHandler_Parms;
 	JobFailedHandler_Parms.errorCode = errorCode;
@@ -32019,10 +30590,9 @@ void USFXOnlineJobGaWHTTPTouchMessages::JobFailedHandler ( unsigned char errorCo
 
 void USFXOnlineJobGaWHTTPTouchMessages::HandleSecondHTTPResult ( )
 {
-	static UFunction* pFnHandleSecondHTTPResult = NULL;
-
+	UFunction* pFnHandleSecondHTTPResult = (UFunction*) SdkBindings::Get ( 4245 );
 	if ( ! pFnHandleSecondHTTPResult )
-		pFnHandleSecondHTTPResult = (UFunction*) UObject::GObjObjects()->Data[ 40627 ];
+		return;
 
 	USFXOnlineJobGaWHTTPTouchMessages_execHandleSecondHTTPResult_Parms HandleSecondHTTPResult_Parms;
 
@@ -32041,10 +30611,9 @@ void USFXOnlineJobGaWHTTPTouchMessages::HandleSecondHTTPResult ( )
 
 void USFXOnlineJobGaWHTTPTouchMessages::OnTouchMessagesComplete ( int Count, int errorCode )
 {
-	static UFunction* pFnOnTouchMessagesComplete = NULL;
-
+	UFunction* pFnOnTouchMessagesComplete = (UFunction*) SdkBindings::Get ( 4244 );
 	if ( ! pFnOnTouchMessagesComplete )
-		pFnOnTouchMessagesComplete = (UFunction*) UObject::GObjObjects()->Data[ 40624 ];
+		return;
 
 	USFXOnlineJobGaWHTTPTouchMessages_execOnTouchMessagesComplete_Parms OnTouchMessagesComplete_Parms;
 	OnTouchMessagesComplete_Parms.Count = Count;
@@ -32061,10 +30630,9 @@ void USFXOnlineJobGaWHTTPTouchMessages::OnTouchMessagesComplete ( int Count, int
 
 class USFXOnlineJobGetAuthToken* USFXOnlineJobGetAuthToken::eventCreateGetAuthTokenJob ( struct FScriptDelegate AuthTokenRetrievedDelegate )
 {
-	static UFunction* pFnCreateGetAuthTokenJob = NULL;
-
+	UFunction* pFnCreateGetAuthTokenJob = (UFunction*) SdkBindings::Get ( 3380 );
 	if ( ! pFnCreateGetAuthTokenJob )
-		pFnCreateGetAuthTokenJob = (UFunction*) UObject::GObjObjects()->Data[ 37256 ];
+		return {};
 
 	USFXOnlineJobGetAuthToken_eventCreateGetAuthTokenJob_Parms CreateGetAuthTokenJob_Parms;
 	memcpy ( &CreateGetAuthTokenJob_Parms.AuthTokenRetrievedDelegate, &AuthTokenRetrievedDelegate, 0xC );
@@ -32081,10 +30649,9 @@ class USFXOnlineJobGetAuthToken* USFXOnlineJobGetAuthToken::eventCreateGetAuthTo
 
 void USFXOnlineJobGetAuthToken::OnAuthTokenRetrieved ( struct FString token )
 {
-	static UFunction* pFnOnAuthTokenRetrieved = NULL;
-
+	UFunction* pFnOnAuthTokenRetrieved = (UFunction*) SdkBindings::Get ( 4250 );
 	if ( ! pFnOnAuthTokenRetrieved )
-		pFnOnAuthTokenRetrieved = (UFunction*) UObject::GObjObjects()->Data[ 40642 ];
+		return;
 
 	USFXOnlineJobGetAuthToken_execOnAuthTokenRetrieved_Parms OnAuthTokenRetrieved_Parms;
 	memcpy ( &OnAuthTokenRetrieved_Parms.token, &token, 0xC );
@@ -32099,10 +30666,9 @@ void USFXOnlineJobGetAuthToken::OnAuthTokenRetrieved ( struct FString token )
 
 bool USFXOnlineJobGetAuthToken::DoExecute ( )
 {
-	static UFunction* pFnDoExecute = NULL;
-
+	UFunction* pFnDoExecute = (UFunction*) SdkBindings::Get ( 4249 );
 	if ( ! pFnDoExecute )
-		pFnDoExecute = (UFunction*) UObject::GObjObjects()->Data[ 40640 ];
+		return {};
 
 	USFXOnlineJobGetAuthToken_execDoExecute_Parms DoExecute_Parms;
 
@@ -32126,10 +30692,9 @@ bool USFXOnlineJobGetAuthToken::DoExecute ( )
 
 class USFXOnlineJobGetLeaderboardData* USFXOnlineJobGetLeaderboardData::eventCreateFriendStatsDataJob ( struct FLeaderboardStatScope oScope, int RankRange, struct FScriptDelegate ResultsRetrievedDelegate, struct FPointer pExternalData )
 {
-	static UFunction* pFnCreateFriendStatsDataJob = NULL;
-
+	UFunction* pFnCreateFriendStatsDataJob = (UFunction*) SdkBindings::Get ( 3365 );
 	if ( ! pFnCreateFriendStatsDataJob )
-		pFnCreateFriendStatsDataJob = (UFunction*) UObject::GObjObjects()->Data[ 37143 ];
+		return {};
 
 	USFXOnlineJobGetLeaderboardData_eventCreateFriendStatsDataJob_Parms CreateFriendStatsDataJob_Parms;
 	memcpy ( &CreateFriendStatsDataJob_Parms.oScope, &oScope, 0xC );
@@ -32152,10 +30717,9 @@ class USFXOnlineJobGetLeaderboardData* USFXOnlineJobGetLeaderboardData::eventCre
 
 class USFXOnlineJobGetLeaderboardData* USFXOnlineJobGetLeaderboardData::eventCreateFriendLeaderboardJob ( int LeaderboardId, struct FScriptDelegate ResultsRetrievedDelegate, struct FPointer pExternalData )
 {
-	static UFunction* pFnCreateFriendLeaderboardJob = NULL;
-
+	UFunction* pFnCreateFriendLeaderboardJob = (UFunction*) SdkBindings::Get ( 3363 );
 	if ( ! pFnCreateFriendLeaderboardJob )
-		pFnCreateFriendLeaderboardJob = (UFunction*) UObject::GObjObjects()->Data[ 37135 ];
+		return {};
 
 	USFXOnlineJobGetLeaderboardData_eventCreateFriendLeaderboardJob_Parms CreateFriendLeaderboardJob_Parms;
 	CreateFriendLeaderboardJob_Parms.LeaderboardId = LeaderboardId;
@@ -32179,10 +30743,9 @@ class USFXOnlineJobGetLeaderboardData* USFXOnlineJobGetLeaderboardData::eventCre
 
 class USFXOnlineJobGetLeaderboardData* USFXOnlineJobGetLeaderboardData::eventCreateCenteredLeaderboardJob ( int LeaderboardId, struct FUniqueNetId PlayerID, int RankRange, struct FScriptDelegate ResultsRetrievedDelegate, struct FPointer pExternalData )
 {
-	static UFunction* pFnCreateCenteredLeaderboardJob = NULL;
-
+	UFunction* pFnCreateCenteredLeaderboardJob = (UFunction*) SdkBindings::Get ( 3361 );
 	if ( ! pFnCreateCenteredLeaderboardJob )
-		pFnCreateCenteredLeaderboardJob = (UFunction*) UObject::GObjObjects()->Data[ 37128 ];
+		return {};
 
 	USFXOnlineJobGetLeaderboardData_eventCreateCenteredLeaderboardJob_Parms CreateCenteredLeaderboardJob_Parms;
 	CreateCenteredLeaderboardJob_Parms.LeaderboardId = LeaderboardId;
@@ -32208,10 +30771,9 @@ class USFXOnlineJobGetLeaderboardData* USFXOnlineJobGetLeaderboardData::eventCre
 
 class USFXOnlineJobGetLeaderboardData* USFXOnlineJobGetLeaderboardData::eventCreateLeaderboardJob ( int LeaderboardId, int RankStart, int RankRange, struct FScriptDelegate ResultsRetrievedDelegate, struct FPointer pExternalData )
 {
-	static UFunction* pFnCreateLeaderboardJob = NULL;
-
+	UFunction* pFnCreateLeaderboardJob = (UFunction*) SdkBindings::Get ( 3359 );
 	if ( ! pFnCreateLeaderboardJob )
-		pFnCreateLeaderboardJob = (UFunction*) UObject::GObjObjects()->Data[ 37119 ];
+		return {};
 
 	USFXOnlineJobGetLeaderboardData_eventCreateLeaderboardJob_Parms CreateLeaderboardJob_Parms;
 	CreateLeaderboardJob_Parms.LeaderboardId = LeaderboardId;
@@ -32237,10 +30799,9 @@ class USFXOnlineJobGetLeaderboardData* USFXOnlineJobGetLeaderboardData::eventCre
 
 void USFXOnlineJobGetLeaderboardData::JobCompleted ( TArray< struct FLeaderboardColumn > aColumInfo, TArray< struct FLeaderboardRecord > aResults, int iTotalRanks, struct FUniqueNetId uidEntity, unsigned char nErrorCode, struct FPointer pExternalData )
 {
-	static UFunction* pFnJobCompleted = NULL;
-
+	UFunction* pFnJobCompleted = (UFunction*) SdkBindings::Get ( 4254 );
 	if ( ! pFnJobCompleted )
-		pFnJobCompleted = (UFunction*) UObject::GObjObjects()->Data[ 40667 ];
+		return;
 
 	USFXOnlineJobGetLeaderboardData_execJobCompleted_Parms JobCompleted_Parms;
 	memcpy ( &JobCompleted_Parms.aColumInfo, &aColumInfo, 0xC );
@@ -32264,10 +30825,9 @@ void USFXOnlineJobGetLeaderboardData::JobCompleted ( TArray< struct FLeaderboard
 
 bool USFXOnlineJobGetLeaderboardData::DoExecute ( )
 {
-	static UFunction* pFnDoExecute = NULL;
-
+	UFunction* pFnDoExecute = (UFunction*) SdkBindings::Get ( 4253 );
 	if ( ! pFnDoExecute )
-		pFnDoExecute = (UFunction*) UObject::GObjObjects()->Data[ 40665 ];
+		return {};
 
 	USFXOnlineJobGetLeaderboardData_execDoExecute_Parms DoExecute_Parms;
 
@@ -32292,10 +30852,9 @@ bool USFXOnlineJobGetLeaderboardData::DoExecute ( )
 
 void USFXOnlineJobGetLeaderboardData::OnResultsRetrieved ( TArray< struct FLeaderboardColumn > aColumInfo, TArray< struct FLeaderboardRecord > aResults, int iTotalRanks, struct FUniqueNetId uidEntity, unsigned char nErrorCode, struct FPointer pExternalData )
 {
-	static UFunction* pFnOnResultsRetrieved = NULL;
-
+	UFunction* pFnOnResultsRetrieved = (UFunction*) SdkBindings::Get ( 4252 );
 	if ( ! pFnOnResultsRetrieved )
-		pFnOnResultsRetrieved = (UFunction*) UObject::GObjObjects()->Data[ 40656 ];
+		return;
 
 	USFXOnlineJobGetLeaderboardData_execOnResultsRetrieved_Parms OnResultsRetrieved_Parms;
 	memcpy ( &OnResultsRetrieved_Parms.aColumInfo, &aColumInfo, 0xC );
@@ -32320,10 +30879,9 @@ void USFXOnlineJobGetLeaderboardData::OnResultsRetrieved ( TArray< struct FLeade
 
 void USFXOnlineJobGetLeaderboardData::OnJobCompletion ( TArray< struct FLeaderboardColumn > aColumInfo, TArray< struct FLeaderboardRecord > aResults, int iTotalRanks, struct FUniqueNetId uidEntity, unsigned char nErrorCode, struct FPointer pExternalData )
 {
-	static UFunction* pFnOnJobCompletion = NULL;
-
+	UFunction* pFnOnJobCompletion = (UFunction*) SdkBindings::Get ( 4251 );
 	if ( ! pFnOnJobCompletion )
-		pFnOnJobCompletion = (UFunction*) UObject::GObjObjects()->Data[ 40647 ];
+		return;
 
 	USFXOnlineJobGetLeaderboardData_execOnJobCompletion_Parms OnJobCompletion_Parms;
 	memcpy ( &OnJobCompletion_Parms.aColumInfo, &aColumInfo, 0xC );
@@ -32343,10 +30901,9 @@ void USFXOnlineJobGetLeaderboardData::OnJobCompletion ( TArray< struct FLeaderbo
 
 bool USFXOnlineJobGetLeaderboardList::eventShouldReschedule ( )
 {
-	static UFunction* pFnShouldReschedule = NULL;
-
+	UFunction* pFnShouldReschedule = (UFunction*) SdkBindings::Get ( 4258 );
 	if ( ! pFnShouldReschedule )
-		pFnShouldReschedule = (UFunction*) UObject::GObjObjects()->Data[ 40715 ];
+		return {};
 
 	USFXOnlineJobGetLeaderboardList_eventShouldReschedule_Parms ShouldReschedule_Parms;
 
@@ -32362,10 +30919,9 @@ bool USFXOnlineJobGetLeaderboardList::eventShouldReschedule ( )
 
 class USFXOnlineJobGetLeaderboardList* USFXOnlineJobGetLeaderboardList::eventCreateGetLeaderboardListJob ( )
 {
-	static UFunction* pFnCreateGetLeaderboardListJob = NULL;
-
+	UFunction* pFnCreateGetLeaderboardListJob = (UFunction*) SdkBindings::Get ( 3367 );
 	if ( ! pFnCreateGetLeaderboardListJob )
-		pFnCreateGetLeaderboardListJob = (UFunction*) UObject::GObjObjects()->Data[ 37147 ];
+		return {};
 
 	USFXOnlineJobGetLeaderboardList_eventCreateGetLeaderboardListJob_Parms CreateGetLeaderboardListJob_Parms;
 
@@ -32381,10 +30937,9 @@ class USFXOnlineJobGetLeaderboardList* USFXOnlineJobGetLeaderboardList::eventCre
 
 void USFXOnlineJobGetLeaderboardList::JobCompleted ( unsigned char errorCode )
 {
-	static UFunction* pFnJobCompleted = NULL;
-
+	UFunction* pFnJobCompleted = (UFunction*) SdkBindings::Get ( 4257 );
 	if ( ! pFnJobCompleted )
-		pFnJobCompleted = (UFunction*) UObject::GObjObjects()->Data[ 40711 ];
+		return;
 
 	USFXOnlineJobGetLeaderboardList_execJobCompleted_Parms JobCompleted_Parms;
 	JobCompleted_Parms.errorCode = errorCode;
@@ -32403,10 +30958,9 @@ void USFXOnlineJobGetLeaderboardList::JobCompleted ( unsigned char errorCode )
 
 bool USFXOnlineJobGetLeaderboardList::DoExecute ( )
 {
-	static UFunction* pFnDoExecute = NULL;
-
+	UFunction* pFnDoExecute = (UFunction*) SdkBindings::Get ( 4256 );
 	if ( ! pFnDoExecute )
-		pFnDoExecute = (UFunction*) UObject::GObjObjects()->Data[ 40709 ];
+		return {};
 
 	USFXOnlineJobGetLeaderboardList_execDoExecute_Parms DoExecute_Parms;
 
@@ -32426,10 +30980,9 @@ bool USFXOnlineJobGetLeaderboardList::DoExecute ( )
 
 void USFXOnlineJobGetLeaderboardList::OnJobCompletion ( unsigned char errorCode )
 {
-	static UFunction* pFnOnJobCompletion = NULL;
-
+	UFunction* pFnOnJobCompletion = (UFunction*) SdkBindings::Get ( 4255 );
 	if ( ! pFnOnJobCompletion )
-		pFnOnJobCompletion = (UFunction*) UObject::GObjObjects()->Data[ 40707 ];
+		return;
 
 	USFXOnlineJobGetLeaderboardList_execOnJobCompletion_Parms OnJobCompletion_Parms;
 	OnJobCompletion_Parms.errorCode = errorCode;
@@ -32444,10 +30997,9 @@ void USFXOnlineJobGetLeaderboardList::OnJobCompletion ( unsigned char errorCode
 
 class USFXOnlineJobGetStatsGroupList* USFXOnlineJobGetStatsGroupList::eventCreateGetStatsGroupListJob ( )
 {
-	static UFunction* pFnCreateGetStatsGroupListJob = NULL;
-
+	UFunction* pFnCreateGetStatsGroupListJob = (UFunction*) SdkBindings::Get ( 3552 );
 	if ( ! pFnCreateGetStatsGroupListJob )
-		pFnCreateGetStatsGroupListJob = (UFunction*) UObject::GObjObjects()->Data[ 37754 ];
+		return {};
 
 	USFXOnlineJobGetStatsGroupList_eventCreateGetStatsGroupListJob_Parms CreateGetStatsGroupListJob_Parms;
 
@@ -32463,10 +31015,9 @@ class USFXOnlineJobGetStatsGroupList* USFXOnlineJobGetStatsGroupList::eventCreat
 
 void USFXOnlineJobGetStatsGroupList::JobCompleted ( unsigned char errorCode )
 {
-	static UFunction* pFnJobCompleted = NULL;
-
+	UFunction* pFnJobCompleted = (UFunction*) SdkBindings::Get ( 4261 );
 	if ( ! pFnJobCompleted )
-		pFnJobCompleted = (UFunction*) UObject::GObjObjects()->Data[ 40721 ];
+		return;
 
 	USFXOnlineJobGetStatsGroupList_execJobCompleted_Parms JobCompleted_Parms;
 	JobCompleted_Parms.errorCode = errorCode;
@@ -32485,10 +31036,9 @@ void USFXOnlineJobGetStatsGroupList::JobCompleted ( unsigned char errorCode )
 
 bool USFXOnlineJobGetStatsGroupList::DoExecute ( )
 {
-	static UFunction* pFnDoExecute = NULL;
-
+	UFunction* pFnDoExecute = (UFunction*) SdkBindings::Get ( 4260 );
 	if ( ! pFnDoExecute )
-		pFnDoExecute = (UFunction*) UObject::GObjObjects()->Data[ 40719 ];
+		return {};
 
 	USFXOnlineJobGetStatsGroupList_execDoExecute_Parms DoExecute_Parms;
 
@@ -32508,10 +31058,9 @@ bool USFXOnlineJobGetStatsGroupList::DoExecute ( )
 
 void USFXOnlineJobGetStatsGroupList::OnJobCompletion ( unsigned char errorCode )
 {
-	static UFunction* pFnOnJobCompletion = NULL;
-
+	UFunction* pFnOnJobCompletion = (UFunction*) SdkBindings::Get ( 4259 );
 	if ( ! pFnOnJobCompletion )
-		pFnOnJobCompletion = (UFunction*) UObject::GObjObjects()->Data[ 40717 ];
+		return;
 
 	USFXOnlineJobGetStatsGroupList_execOnJobCompletion_Parms OnJobCompletion_Parms;
 	OnJobCompletion_Parms.errorCode = errorCode;
@@ -32525,10 +31074,9 @@ void USFXOnlineJobGetStatsGroupList::OnJobCompletion ( unsigned char errorCode )
 
 void USFXOnlineJobHTTPRequest::Tick ( )
 {
-	static UFunction* pFnTick = NULL;
-
+	UFunction* pFnTick = (UFunction*) SdkBindings::Get ( 4264 );
 	if ( ! pFnTick )
-		pFnTick = (UFunction*) UObject::GObjObjects()->Data[ 40731 ];
+		return;
 
 	USFXOnlineJobHTTPRequest_execTick_Parms Tick_Parms;
 
@@ -32542,10 +31090,9 @@ void USFXOnlineJobHTTPRequest::Tick ( )
 
 bool USFXOnlineJobHTTPRequest::DoExecute ( )
 {
-	static UFunction* pFnDoExecute = NULL;
-
+	UFunction* pFnDoExecute = (UFunction*) SdkBindings::Get ( 4263 );
 	if ( ! pFnDoExecute )
-		pFnDoExecute = (UFunction*) UObject::GObjObjects()->Data[ 40728 ];
+		return {};
 
 	USFXOnlineJobHTTPRequest_execDoExecute_Parms DoExecute_Parms;
 
@@ -32561,10 +31108,9 @@ bool USFXOnlineJobHTTPRequest::DoExecute ( )
 
 class USFXOnlineJobHTTPRequest* USFXOnlineJobHTTPRequest::eventCreateHTTPRequestJob ( )
 {
-	static UFunction* pFnCreateHTTPRequestJob = NULL;
-
+	UFunction* pFnCreateHTTPRequestJob = (UFunction*) SdkBindings::Get ( 3746 );
 	if ( ! pFnCreateHTTPRequestJob )
-		pFnCreateHTTPRequestJob = (UFunction*) UObject::GObjObjects()->Data[ 38680 ];
+		return {};
 
 	USFXOnlineJobHTTPRequest_eventCreateHTTPRequestJob_Parms CreateHTTPRequestJob_Parms;
 
@@ -32580,10 +31126,9 @@ class USFXOnlineJobHTTPRequest* USFXOnlineJobHTTPRequest::eventCreateHTTPRequest
 
 void USFXOnlineJobHTTPRequest::OnJobComplete ( class USFXOnlineHTTPRequest* request )
 {
-	static UFunction* pFnOnJobComplete = NULL;
-
+	UFunction* pFnOnJobComplete = (UFunction*) SdkBindings::Get ( 4262 );
 	if ( ! pFnOnJobComplete )
-		pFnOnJobComplete = (UFunction*) UObject::GObjObjects()->Data[ 40725 ];
+		return;
 
 	USFXOnlineJobHTTPRequest_execOnJobComplete_Parms OnJobComplete_Parms;
 	OnJobComplete_Parms.request = request;
@@ -32597,10 +31142,9 @@ void USFXOnlineJobHTTPRequest::OnJobComplete ( class USFXOnlineHTTPRequest* requ
 
 void USFXOnlineJobImageRequest::MoveToBackOfQueue ( )
 {
-	static UFunction* pFnMoveToBackOfQueue = NULL;
-
+	UFunction* pFnMoveToBackOfQueue = (UFunction*) SdkBindings::Get ( 4269 );
 	if ( ! pFnMoveToBackOfQueue )
-		pFnMoveToBackOfQueue = (UFunction*) UObject::GObjObjects()->Data[ 40742 ];
+		return;
 
 	USFXOnlineJobImageRequest_execMoveToBackOfQueue_Parms MoveToBackOfQueue_Parms;
 
@@ -32613,10 +31157,9 @@ void USFXOnlineJobImageRequest::MoveToBackOfQueue ( )
 
 void USFXOnlineJobImageRequest::Tick ( )
 {
-	static UFunction* pFnTick = NULL;
-
+	UFunction* pFnTick = (UFunction*) SdkBindings::Get ( 4268 );
 	if ( ! pFnTick )
-		pFnTick = (UFunction*) UObject::GObjObjects()->Data[ 40741 ];
+		return;
 
 	USFXOnlineJobImageRequest_execTick_Parms Tick_Parms;
 
@@ -32630,10 +31173,9 @@ void USFXOnlineJobImageRequest::Tick ( )
 
 bool USFXOnlineJobImageRequest::DoExecute ( )
 {
-	static UFunction* pFnDoExecute = NULL;
-
+	UFunction* pFnDoExecute = (UFunction*) SdkBindings::Get ( 4266 );
 	if ( ! pFnDoExecute )
-		pFnDoExecute = (UFunction*) UObject::GObjObjects()->Data[ 40735 ];
+		return {};
 
 	USFXOnlineJobImageRequest_execDoExecute_Parms DoExecute_Parms;
 
@@ -32649,10 +31191,9 @@ bool USFXOnlineJobImageRequest::DoExecute ( )
 
 class USFXOnlineJobImageRequest* USFXOnlineJobImageRequest::eventCreateImageRequestJob ( )
 {
-	static UFunction* pFnCreateImageRequestJob = NULL;
-
+	UFunction* pFnCreateImageRequestJob = (UFunction*) SdkBindings::Get ( 3741 );
 	if ( ! pFnCreateImageRequestJob )
-		pFnCreateImageRequestJob = (UFunction*) UObject::GObjObjects()->Data[ 38664 ];
+		return {};
 
 	USFXOnlineJobImageRequest_eventCreateImageRequestJob_Parms CreateImageRequestJob_Parms;
 
@@ -32668,10 +31209,9 @@ class USFXOnlineJobImageRequest* USFXOnlineJobImageRequest::eventCreateImageRequ
 
 void USFXOnlineJobImageRequest::OnJobComplete ( struct FSFXOnlineImageRequest request )
 {
-	static UFunction* pFnOnJobComplete = NULL;
-
+	UFunction* pFnOnJobComplete = (UFunction*) SdkBindings::Get ( 4265 );
 	if ( ! pFnOnJobComplete )
-		pFnOnJobComplete = (UFunction*) UObject::GObjObjects()->Data[ 40732 ];
+		return;
 
 	USFXOnlineJobImageRequest_execOnJobComplete_Parms OnJobComplete_Parms;
 	memcpy ( &OnJobComplete_Parms.request, &request, 0x18 );
@@ -32686,10 +31226,9 @@ void USFXOnlineJobImageRequest::OnJobComplete ( struct FSFXOnlineImageRequest re
 
 bool USFXOnlineJobImportFriendListToBlaze::eventShouldReschedule ( )
 {
-	static UFunction* pFnShouldReschedule = NULL;
-
+	UFunction* pFnShouldReschedule = (UFunction*) SdkBindings::Get ( 4273 );
 	if ( ! pFnShouldReschedule )
-		pFnShouldReschedule = (UFunction*) UObject::GObjObjects()->Data[ 40754 ];
+		return {};
 
 	USFXOnlineJobImportFriendListToBlaze_eventShouldReschedule_Parms ShouldReschedule_Parms;
 
@@ -32706,10 +31245,9 @@ bool USFXOnlineJobImportFriendListToBlaze::eventShouldReschedule ( )
 
 class USFXOnlineJobImportFriendListToBlaze* USFXOnlineJobImportFriendListToBlaze::eventCreateImportFriendListToBlazeJob ( unsigned long callPostImportFriendListToBlaze )
 {
-	static UFunction* pFnCreateImportFriendListToBlazeJob = NULL;
-
+	UFunction* pFnCreateImportFriendListToBlazeJob = (UFunction*) SdkBindings::Get ( 3440 );
 	if ( ! pFnCreateImportFriendListToBlazeJob )
-		pFnCreateImportFriendListToBlazeJob = (UFunction*) UObject::GObjObjects()->Data[ 37400 ];
+		return {};
 
 	USFXOnlineJobImportFriendListToBlaze_eventCreateImportFriendListToBlazeJob_Parms CreateImportFriendListToBlazeJob_Parms;
 	CreateImportFriendListToBlazeJob_Parms.callPostImportFriendListToBlaze = callPostImportFriendListToBlaze;
@@ -32726,10 +31264,9 @@ class USFXOnlineJobImportFriendListToBlaze* USFXOnlineJobImportFriendListToBlaze
 
 void USFXOnlineJobImportFriendListToBlaze::JobCompleted ( unsigned char errorCode )
 {
-	static UFunction* pFnJobCompleted = NULL;
-
+	UFunction* pFnJobCompleted = (UFunction*) SdkBindings::Get ( 4272 );
 	if ( ! pFnJobCompleted )
-		pFnJobCompleted = (UFunction*) UObject::GObjObjects()->Data[ 40748 ];
+		return;
 
 	USFXOnlineJobImportFriendListToBlaze_execJobCompleted_Parms JobCompleted_Parms;
 	JobCompleted_Parms.errorCode = errorCode;
@@ -32748,10 +31285,9 @@ void USFXOnlineJobImportFriendListToBlaze::JobCompleted ( unsigned char errorCod
 
 bool USFXOnlineJobImportFriendListToBlaze::DoExecute ( )
 {
-	static UFunction* pFnDoExecute = NULL;
-
+	UFunction* pFnDoExecute = (UFunction*) SdkBindings::Get ( 4271 );
 	if ( ! pFnDoExecute )
-		pFnDoExecute = (UFunction*) UObject::GObjObjects()->Data[ 40746 ];
+		return {};
 
 	USFXOnlineJobImportFriendListToBlaze_execDoExecute_Parms DoExecute_Parms;
 
@@ -32771,10 +31307,9 @@ bool USFXOnlineJobImportFriendListToBlaze::DoExecute ( )
 
 void USFXOnlineJobImportFriendListToBlaze::OnJobCompletion ( unsigned char errorCode )
 {
-	static UFunction* pFnOnJobCompletion = NULL;
-
+	UFunction* pFnOnJobCompletion = (UFunction*) SdkBindings::Get ( 4270 );
 	if ( ! pFnOnJobCompletion )
-		pFnOnJobCompletion = (UFunction*) UObject::GObjObjects()->Data[ 40744 ];
+		return;
 
 	USFXOnlineJobImportFriendListToBlaze_execOnJobCompletion_Parms OnJobCompletion_Parms;
 	OnJobCompletion_Parms.errorCode = errorCode;
@@ -32789,10 +31324,9 @@ void USFXOnlineJobImportFriendListToBlaze::OnJobCompletion ( unsigned char error
 
 bool USFXOnlineJobLoadSettings::eventShouldReschedule ( )
 {
-	static UFunction* pFnShouldReschedule = NULL;
-
+	UFunction* pFnShouldReschedule = (UFunction*) SdkBindings::Get ( 4276 );
 	if ( ! pFnShouldReschedule )
-		pFnShouldReschedule = (UFunction*) UObject::GObjObjects()->Data[ 40771 ];
+		return {};
 
 	USFXOnlineJobLoadSettings_eventShouldReschedule_Parms ShouldReschedule_Parms;
 
@@ -32810,10 +31344,9 @@ bool USFXOnlineJobLoadSettings::eventShouldReschedule ( )
 
 class USFXOnlineJobLoadSettings* USFXOnlineJobLoadSettings::eventCreateJob ( struct FScriptDelegate InCallback, int InCallbackArg )
 {
-	static UFunction* pFnCreateJob = NULL;
-
+	UFunction* pFnCreateJob = (UFunction*) SdkBindings::Get ( 4036 );
 	if ( ! pFnCreateJob )
-		pFnCreateJob = (UFunction*) UObject::GObjObjects()->Data[ 39782 ];
+		return {};
 
 	USFXOnlineJobLoadSettings_eventCreateJob_Parms CreateJob_Parms;
 	memcpy ( &CreateJob_Parms.InCallback, &InCallback, 0xC );
@@ -32831,10 +31364,9 @@ class USFXOnlineJobLoadSettings* USFXOnlineJobLoadSettings::eventCreateJob ( str
 
 bool USFXOnlineJobLoadSettings::DoExecute ( )
 {
-	static UFunction* pFnDoExecute = NULL;
-
+	UFunction* pFnDoExecute = (UFunction*) SdkBindings::Get ( 4275 );
 	if ( ! pFnDoExecute )
-		pFnDoExecute = (UFunction*) UObject::GObjObjects()->Data[ 40764 ];
+		return {};
 
 	USFXOnlineJobLoadSettings_execDoExecute_Parms DoExecute_Parms;
 
@@ -32857,10 +31389,9 @@ bool USFXOnlineJobLoadSettings::DoExecute ( )
 
 void USFXOnlineJobLoadSettings::LoadSettingsCallback ( unsigned char errorCode, int InJobId, TArray< struct FSettingsPair > InSettings, int InCallbackArg )
 {
-	static UFunction* pFnLoadSettingsCallback = NULL;
-
+	UFunction* pFnLoadSettingsCallback = (UFunction*) SdkBindings::Get ( 4274 );
 	if ( ! pFnLoadSettingsCallback )
-		pFnLoadSettingsCallback = (UFunction*) UObject::GObjObjects()->Data[ 40758 ];
+		return;
 
 	USFXOnlineJobLoadSettings_execLoadSettingsCallback_Parms LoadSettingsCallback_Parms;
 	LoadSettingsCallback_Parms.errorCode = errorCode;
@@ -32879,10 +31410,9 @@ void USFXOnlineJobLoadSettings::LoadSettingsCallback ( unsigned char errorCode,
 
 class USFXOnlineJobPurgeMessages* USFXOnlineJobPurgeMessages::eventCreatePurgeMessagesJob ( int InMapId )
 {
-	static UFunction* pFnCreatePurgeMessagesJob = NULL;
-
+	UFunction* pFnCreatePurgeMessagesJob = (UFunction*) SdkBindings::Get ( 3472 );
 	if ( ! pFnCreatePurgeMessagesJob )
-		pFnCreatePurgeMessagesJob = (UFunction*) UObject::GObjObjects()->Data[ 37531 ];
+		return {};
 
 	USFXOnlineJobPurgeMessages_eventCreatePurgeMessagesJob_Parms CreatePurgeMessagesJob_Parms;
 	CreatePurgeMessagesJob_Parms.InMapId = InMapId;
@@ -32899,10 +31429,9 @@ class USFXOnlineJobPurgeMessages* USFXOnlineJobPurgeMessages::eventCreatePurgeMe
 
 class USFXOnlineJobPurgeMessages* USFXOnlineJobPurgeMessages::eventCreatePurgeAllMessagesJob ( )
 {
-	static UFunction* pFnCreatePurgeAllMessagesJob = NULL;
-
+	UFunction* pFnCreatePurgeAllMessagesJob = (UFunction*) SdkBindings::Get ( 3470 );
 	if ( ! pFnCreatePurgeAllMessagesJob )
-		pFnCreatePurgeAllMessagesJob = (UFunction*) UObject::GObjObjects()->Data[ 37526 ];
+		return {};
 
 	USFXOnlineJobPurgeMessages_eventCreatePurgeAllMessagesJob_Parms CreatePurgeAllMessagesJob_Parms;
 
@@ -32918,10 +31447,9 @@ class USFXOnlineJobPurgeMessages* USFXOnlineJobPurgeMessages::eventCreatePurgeAl
 
 bool USFXOnlineJobPurgeMessages::DoExecute ( )
 {
-	static UFunction* pFnDoExecute = NULL;
-
+	UFunction* pFnDoExecute = (UFunction*) SdkBindings::Get ( 4277 );
 	if ( ! pFnDoExecute )
-		pFnDoExecute = (UFunction*) UObject::GObjObjects()->Data[ 40774 ];
+		return {};
 
 	USFXOnlineJobPurgeMessages_execDoExecute_Parms DoExecute_Parms;
 
@@ -32941,10 +31469,9 @@ bool USFXOnlineJobPurgeMessages::DoExecute ( )
 
 class USFXOnlineJobReceiveMessage* USFXOnlineJobReceiveMessage::eventCreateReceiveAllMessagesJob ( )
 {
-	static UFunction* pFnCreateReceiveAllMessagesJob = NULL;
-
+	UFunction* pFnCreateReceiveAllMessagesJob = (UFunction*) SdkBindings::Get ( 3468 );
 	if ( ! pFnCreateReceiveAllMessagesJob )
-		pFnCreateReceiveAllMessagesJob = (UFunction*) UObject::GObjObjects()->Data[ 37522 ];
+		return {};
 
 	USFXOnlineJobReceiveMessage_eventCreateReceiveAllMessagesJob_Parms CreateReceiveAllMessagesJob_Parms;
 
@@ -32960,10 +31487,9 @@ class USFXOnlineJobReceiveMessage* USFXOnlineJobReceiveMessage::eventCreateRecei
 
 bool USFXOnlineJobReceiveMessage::DoExecute ( )
 {
-	static UFunction* pFnDoExecute = NULL;
-
+	UFunction* pFnDoExecute = (UFunction*) SdkBindings::Get ( 4278 );
 	if ( ! pFnDoExecute )
-		pFnDoExecute = (UFunction*) UObject::GObjObjects()->Data[ 40781 ];
+		return {};
 
 	USFXOnlineJobReceiveMessage_execDoExecute_Parms DoExecute_Parms;
 
@@ -32985,10 +31511,9 @@ bool USFXOnlineJobReceiveMessage::DoExecute ( )
 
 class USFXOnlineJobSaveSettings* USFXOnlineJobSaveSettings::eventCreateJob ( struct FScriptDelegate InCallback, int InCallbackArg )
 {
-	static UFunction* pFnCreateJob = NULL;
-
+	UFunction* pFnCreateJob = (UFunction*) SdkBindings::Get ( 4034 );
 	if ( ! pFnCreateJob )
-		pFnCreateJob = (UFunction*) UObject::GObjObjects()->Data[ 39777 ];
+		return {};
 
 	USFXOnlineJobSaveSettings_eventCreateJob_Parms CreateJob_Parms;
 	memcpy ( &CreateJob_Parms.InCallback, &InCallback, 0xC );
@@ -33006,10 +31531,9 @@ class USFXOnlineJobSaveSettings* USFXOnlineJobSaveSettings::eventCreateJob ( str
 
 bool USFXOnlineJobSaveSettings::DoExecute ( )
 {
-	static UFunction* pFnDoExecute = NULL;
-
+	UFunction* pFnDoExecute = (UFunction*) SdkBindings::Get ( 4283 );
 	if ( ! pFnDoExecute )
-		pFnDoExecute = (UFunction*) UObject::GObjObjects()->Data[ 40803 ];
+		return {};
 
 	USFXOnlineJobSaveSettings_execDoExecute_Parms DoExecute_Parms;
 
@@ -33029,10 +31553,9 @@ bool USFXOnlineJobSaveSettings::DoExecute ( )
 
 void USFXOnlineJobSaveSettings::eventCallCompletionDelegates ( unsigned long Success )
 {
-	static UFunction* pFnCallCompletionDelegates = NULL;
-
+	UFunction* pFnCallCompletionDelegates = (UFunction*) SdkBindings::Get ( 4282 );
 	if ( ! pFnCallCompletionDelegates )
-		pFnCallCompletionDelegates = (UFunction*) UObject::GObjObjects()->Data[ 40799 ];
+		return;
 
 	USFXOnlineJobSaveSettings_eventCallCompletionDelegates_Parms CallCompletionDelegates_Parms;
 	CallCompletionDelegates_Parms.Success = Success;
@@ -33047,10 +31570,9 @@ void USFXOnlineJobSaveSettings::eventCallCompletionDelegates ( unsigned long Suc
 
 void USFXOnlineJobSaveSettings::eventAddCompletionDelegate ( struct FScriptDelegate JobCompleteDelegate )
 {
-	static UFunction* pFnAddCompletionDelegate = NULL;
-
+	UFunction* pFnAddCompletionDelegate = (UFunction*) SdkBindings::Get ( 4281 );
 	if ( ! pFnAddCompletionDelegate )
-		pFnAddCompletionDelegate = (UFunction*) UObject::GObjObjects()->Data[ 40797 ];
+		return;
 
 	USFXOnlineJobSaveSettings_eventAddCompletionDelegate_Parms AddCompletionDelegate_Parms;
 	memcpy ( &AddCompletionDelegate_Parms.JobCompleteDelegate, &JobCompleteDelegate, 0xC );
@@ -33066,10 +31588,9 @@ void USFXOnlineJobSaveSettings::eventAddCompletionDelegate ( struct FScriptDeleg
 
 void USFXOnlineJobSaveSettings::eventAddSetting ( struct FString* InKey, struct FString* InValue )
 {
-	static UFunction* pFnAddSetting = NULL;
-
+	UFunction* pFnAddSetting = (UFunction*) SdkBindings::Get ( 4280 );
 	if ( ! pFnAddSetting )
-		pFnAddSetting = (UFunction*) UObject::GObjObjects()->Data[ 40793 ];
+		return;
 
 	USFXOnlineJobSaveSettings_eventAddSetting_Parms AddSetting_Parms;
 
@@ -33091,10 +31612,9 @@ void USFXOnlineJobSaveSettings::eventAddSetting ( struct FString* InKey, struct
 
 void USFXOnlineJobSaveSettings::SaveSettingsCallback ( unsigned char errorCode, int InJobId, int InCallbackArg )
 {
-	static UFunction* pFnSaveSettingsCallback = NULL;
-
+	UFunction* pFnSaveSettingsCallback = (UFunction*) SdkBindings::Get ( 4279 );
 	if ( ! pFnSaveSettingsCallback )
-		pFnSaveSettingsCallback = (UFunction*) UObject::GObjObjects()->Data[ 40789 ];
+		return;
 
 	USFXOnlineJobSaveSettings_execSaveSettingsCallback_Parms SaveSettingsCallback_Parms;
 	SaveSettingsCallback_Parms.errorCode = errorCode;
@@ -33112,10 +31632,9 @@ void USFXOnlineJobSaveSettings::SaveSettingsCallback ( unsigned char errorCode,
 
 bool USFXOnlineJobSendMessage::GetFriendsList ( TArray< struct FString >* friendsPersonaNames )
 {
-	static UFunction* pFnGetFriendsList = NULL;
-
+	UFunction* pFnGetFriendsList = (UFunction*) SdkBindings::Get ( 4287 );
 	if ( ! pFnGetFriendsList )
-		pFnGetFriendsList = (UFunction*) UObject::GObjObjects()->Data[ 40834 ];
+		return {};
 
 	USFXOnlineJobSendMessage_execGetFriendsList_Parms GetFriendsList_Parms;
 
@@ -33140,10 +31659,9 @@ bool USFXOnlineJobSendMessage::GetFriendsList ( TArray< struct FString >* friend
 
 class USFXOnlineJobSendMessage* USFXOnlineJobSendMessage::eventCreateSendMessageToAllFriendsJob ( unsigned char InMessageType, TArray< struct FString > Params )
 {
-	static UFunction* pFnCreateSendMessageToAllFriendsJob = NULL;
-
+	UFunction* pFnCreateSendMessageToAllFriendsJob = (UFunction*) SdkBindings::Get ( 4286 );
 	if ( ! pFnCreateSendMessageToAllFriendsJob )
-		pFnCreateSendMessageToAllFriendsJob = (UFunction*) UObject::GObjObjects()->Data[ 40827 ];
+		return {};
 
 	USFXOnlineJobSendMessage_eventCreateSendMessageToAllFriendsJob_Parms CreateSendMessageToAllFriendsJob_Parms;
 	CreateSendMessageToAllFriendsJob_Parms.InMessageType = InMessageType;
@@ -33164,10 +31682,9 @@ class USFXOnlineJobSendMessage* USFXOnlineJobSendMessage::eventCreateSendMessage
 
 class USFXOnlineJobSendMessage* USFXOnlineJobSendMessage::eventCreateSendMessageJob ( TArray< struct FString > InSendToPersonaNames, unsigned char InMessageType, TArray< struct FString > Params )
 {
-	static UFunction* pFnCreateSendMessageJob = NULL;
-
+	UFunction* pFnCreateSendMessageJob = (UFunction*) SdkBindings::Get ( 4285 );
 	if ( ! pFnCreateSendMessageJob )
-		pFnCreateSendMessageJob = (UFunction*) UObject::GObjObjects()->Data[ 40818 ];
+		return {};
 
 	USFXOnlineJobSendMessage_eventCreateSendMessageJob_Parms CreateSendMessageJob_Parms;
 	memcpy ( &CreateSendMessageJob_Parms.InSendToPersonaNames, &InSendToPersonaNames, 0xC );
@@ -33186,10 +31703,9 @@ class USFXOnlineJobSendMessage* USFXOnlineJobSendMessage::eventCreateSendMessage
 
 bool USFXOnlineJobSendMessage::DoExecute ( )
 {
-	static UFunction* pFnDoExecute = NULL;
-
+	UFunction* pFnDoExecute = (UFunction*) SdkBindings::Get ( 4284 );
 	if ( ! pFnDoExecute )
-		pFnDoExecute = (UFunction*) UObject::GObjObjects()->Data[ 40816 ];
+		return {};
 
 	USFXOnlineJobSendMessage_execDoExecute_Parms DoExecute_Parms;
 
@@ -33209,10 +31725,9 @@ bool USFXOnlineJobSendMessage::DoExecute ( )
 
 struct FString USFXOnlineComponentCommerce::DecryptOfflineEntitlementInfo ( )
 {
-	static UFunction* pFnDecryptOfflineEntitlementInfo = NULL;
-
+	UFunction* pFnDecryptOfflineEntitlementInfo = (UFunction*) SdkBindings::Get ( 3598 );
 	if ( ! pFnDecryptOfflineEntitlementInfo )
-		pFnDecryptOfflineEntitlementInfo = (UFunction*) UObject::GObjObjects()->Data[ 37927 ];
+		return {};
 
 	USFXOnlineComponentCommerce_execDecryptOfflineEntitlementInfo_Parms DecryptOfflineEntitlementInfo_Parms;
 
@@ -33233,10 +31748,9 @@ struct FString USFXOnlineComponentCommerce::DecryptOfflineEntitlementInfo ( )
 
 bool USFXOnlineComponentCommerce::StoreOfflineEntitlementInfo ( struct FString a_sEncryptedContent )
 {
-	static UFunction* pFnStoreOfflineEntitlementInfo = NULL;
-
+	UFunction* pFnStoreOfflineEntitlementInfo = (UFunction*) SdkBindings::Get ( 3597 );
 	if ( ! pFnStoreOfflineEntitlementInfo )
-		pFnStoreOfflineEntitlementInfo = (UFunction*) UObject::GObjObjects()->Data[ 37924 ];
+		return {};
 
 	USFXOnlineComponentCommerce_execStoreOfflineEntitlementInfo_Parms StoreOfflineEntitlementInfo_Parms;
 	memcpy ( &StoreOfflineEntitlementInfo_Parms.a_sEncryptedContent, &a_sEncryptedContent, 0xC );
@@ -33256,10 +31770,9 @@ bool USFXOnlineComponentCommerce::StoreOfflineEntitlementInfo ( struct FString a
 
 void USFXOnlineComponentCommerce::DumpTestData ( )
 {
-	static UFunction* pFnDumpTestData = NULL;
-
+	UFunction* pFnDumpTestData = (UFunction*) SdkBindings::Get ( 3596 );
 	if ( ! pFnDumpTestData )
-		pFnDumpTestData = (UFunction*) UObject::GObjObjects()->Data[ 37923 ];
+		return;
 
 	USFXOnlineComponentCommerce_execDumpTestData_Parms DumpTestData_Parms;
 
@@ -33276,10 +31789,9 @@ void USFXOnlineComponentCommerce::DumpTestData ( )
 
 void USFXOnlineComponentCommerce::NucleusEntitlementsRefreshOffline ( )
 {
-	static UFunction* pFnNucleusEntitlementsRefreshOffline = NULL;
-
+	UFunction* pFnNucleusEntitlementsRefreshOffline = (UFunction*) SdkBindings::Get ( 3595 );
 	if ( ! pFnNucleusEntitlementsRefreshOffline )
-		pFnNucleusEntitlementsRefreshOffline = (UFunction*) UObject::GObjObjects()->Data[ 37922 ];
+		return;
 
 	USFXOnlineComponentCommerce_execNucleusEntitlementsRefreshOffline_Parms NucleusEntitlementsRefreshOffline_Parms;
 
@@ -33298,10 +31810,9 @@ void USFXOnlineComponentCommerce::NucleusEntitlementsRefreshOffline ( )
 
 void USFXOnlineComponentCommerce::LoadDimeConfig ( struct FString sConfig, struct FScriptDelegate dCallback )
 {
-	static UFunction* pFnLoadDimeConfig = NULL;
-
+	UFunction* pFnLoadDimeConfig = (UFunction*) SdkBindings::Get ( 3594 );
 	if ( ! pFnLoadDimeConfig )
-		pFnLoadDimeConfig = (UFunction*) UObject::GObjObjects()->Data[ 37919 ];
+		return;
 
 	USFXOnlineComponentCommerce_execLoadDimeConfig_Parms LoadDimeConfig_Parms;
 	memcpy ( &LoadDimeConfig_Parms.sConfig, &sConfig, 0xC );
@@ -33320,10 +31831,9 @@ void USFXOnlineComponentCommerce::LoadDimeConfig ( struct FString sConfig, struc
 
 void USFXOnlineComponentCommerce::OnDimeConfigLoaded ( )
 {
-	static UFunction* pFnOnDimeConfigLoaded = NULL;
-
+	UFunction* pFnOnDimeConfigLoaded = (UFunction*) SdkBindings::Get ( 3593 );
 	if ( ! pFnOnDimeConfigLoaded )
-		pFnOnDimeConfigLoaded = (UFunction*) UObject::GObjObjects()->Data[ 37918 ];
+		return;
 
 	USFXOnlineComponentCommerce_execOnDimeConfigLoaded_Parms OnDimeConfigLoaded_Parms;
 
@@ -33337,10 +31847,9 @@ void USFXOnlineComponentCommerce::OnDimeConfigLoaded ( )
 
 struct FString USFXOnlineComponentCommerce::GetWalletBalance ( )
 {
-	static UFunction* pFnGetWalletBalance = NULL;
-
+	UFunction* pFnGetWalletBalance = (UFunction*) SdkBindings::Get ( 3592 );
 	if ( ! pFnGetWalletBalance )
-		pFnGetWalletBalance = (UFunction*) UObject::GObjObjects()->Data[ 37915 ];
+		return {};
 
 	USFXOnlineComponentCommerce_execGetWalletBalance_Parms GetWalletBalance_Parms;
 
@@ -33357,10 +31866,9 @@ struct FString USFXOnlineComponentCommerce::GetWalletBalance ( )
 
 void USFXOnlineComponentCommerce::FetchOfferDetails ( TArray< struct FBWOfferId > aOffers, struct FScriptDelegate dCallback )
 {
-	static UFunction* pFnFetchOfferDetails = NULL;
-
+	UFunction* pFnFetchOfferDetails = (UFunction*) SdkBindings::Get ( 3591 );
 	if ( ! pFnFetchOfferDetails )
-		pFnFetchOfferDetails = (UFunction*) UObject::GObjObjects()->Data[ 37911 ];
+		return;
 
 	USFXOnlineComponentCommerce_execFetchOfferDetails_Parms FetchOfferDetails_Parms;
 	memcpy ( &FetchOfferDetails_Parms.aOffers, &aOffers, 0xC );
@@ -33379,10 +31887,9 @@ void USFXOnlineComponentCommerce::FetchOfferDetails ( TArray< struct FBWOfferId
 
 void USFXOnlineComponentCommerce::OnFetchOfferDetailsComplete ( )
 {
-	static UFunction* pFnOnFetchOfferDetailsComplete = NULL;
-
+	UFunction* pFnOnFetchOfferDetailsComplete = (UFunction*) SdkBindings::Get ( 3590 );
 	if ( ! pFnOnFetchOfferDetailsComplete )
-		pFnOnFetchOfferDetailsComplete = (UFunction*) UObject::GObjObjects()->Data[ 37910 ];
+		return;
 
 	USFXOnlineComponentCommerce_execOnFetchOfferDetailsComplete_Parms OnFetchOfferDetailsComplete_Parms;
 
@@ -33397,10 +31904,9 @@ void USFXOnlineComponentCommerce::OnFetchOfferDetailsComplete ( )
 
 void USFXOnlineComponentCommerce::eventGetOffersList ( TArray< struct FBWOfferId > aOfferFilter, TArray< struct FBWOfferInfo >* aOffers )
 {
-	static UFunction* pFnGetOffersList = NULL;
-
+	UFunction* pFnGetOffersList = (UFunction*) SdkBindings::Get ( 3589 );
 	if ( ! pFnGetOffersList )
-		pFnGetOffersList = (UFunction*) UObject::GObjObjects()->Data[ 37902 ];
+		return;
 
 	USFXOnlineComponentCommerce_eventGetOffersList_Parms GetOffersList_Parms;
 	memcpy ( &GetOffersList_Parms.aOfferFilter, &aOfferFilter, 0xC );
@@ -33417,10 +31923,9 @@ void USFXOnlineComponentCommerce::eventGetOffersList ( TArray< struct FBWOfferId
 
 void USFXOnlineComponentCommerce::Display1stPartyStore ( )
 {
-	static UFunction* pFnDisplay1stPartyStore = NULL;
-
+	UFunction* pFnDisplay1stPartyStore = (UFunction*) SdkBindings::Get ( 3588 );
 	if ( ! pFnDisplay1stPartyStore )
-		pFnDisplay1stPartyStore = (UFunction*) UObject::GObjObjects()->Data[ 37901 ];
+		return;
 
 	USFXOnlineComponentCommerce_execDisplay1stPartyStore_Parms Display1stPartyStore_Parms;
 
@@ -33439,10 +31944,9 @@ void USFXOnlineComponentCommerce::Display1stPartyStore ( )
 
 void USFXOnlineComponentCommerce::PurchaseOfferId ( struct FBWOfferId Id, struct FScriptDelegate dCallback )
 {
-	static UFunction* pFnPurchaseOfferId = NULL;
-
+	UFunction* pFnPurchaseOfferId = (UFunction*) SdkBindings::Get ( 3587 );
 	if ( ! pFnPurchaseOfferId )
-		pFnPurchaseOfferId = (UFunction*) UObject::GObjObjects()->Data[ 37898 ];
+		return;
 
 	USFXOnlineComponentCommerce_execPurchaseOfferId_Parms PurchaseOfferId_Parms;
 	memcpy ( &PurchaseOfferId_Parms.Id, &Id, 0x4 );
@@ -33462,10 +31966,9 @@ void USFXOnlineComponentCommerce::PurchaseOfferId ( struct FBWOfferId Id, struct
 
 void USFXOnlineComponentCommerce::OnPurchaseOfferIdResult ( int nResult )
 {
-	static UFunction* pFnOnPurchaseOfferIdResult = NULL;
-
+	UFunction* pFnOnPurchaseOfferIdResult = (UFunction*) SdkBindings::Get ( 3586 );
 	if ( ! pFnOnPurchaseOfferIdResult )
-		pFnOnPurchaseOfferIdResult = (UFunction*) UObject::GObjObjects()->Data[ 37896 ];
+		return;
 
 	USFXOnlineComponentCommerce_execOnPurchaseOfferIdResult_Parms OnPurchaseOfferIdResult_Parms;
 	OnPurchaseOfferIdResult_Parms.nResult = nResult;
@@ -33480,10 +31983,9 @@ void USFXOnlineComponentCommerce::OnPurchaseOfferIdResult ( int nResult )
 
 void USFXOnlineComponentCommerce::OnCodeRedeemed ( unsigned char nResult )
 {
-	static UFunction* pFnOnCodeRedeemed = NULL;
-
+	UFunction* pFnOnCodeRedeemed = (UFunction*) SdkBindings::Get ( 3585 );
 	if ( ! pFnOnCodeRedeemed )
-		pFnOnCodeRedeemed = (UFunction*) UObject::GObjObjects()->Data[ 37894 ];
+		return;
 
 	USFXOnlineComponentCommerce_execOnCodeRedeemed_Parms OnCodeRedeemed_Parms;
 	OnCodeRedeemed_Parms.nResult = nResult;
@@ -33503,10 +32005,9 @@ void USFXOnlineComponentCommerce::OnCodeRedeemed ( unsigned char nResult )
 
 void USFXOnlineComponentCommerce::SubmitRedeemCode ( unsigned long bContinue, struct FString strCode )
 {
-	static UFunction* pFnSubmitRedeemCode = NULL;
-
+	UFunction* pFnSubmitRedeemCode = (UFunction*) SdkBindings::Get ( 3584 );
 	if ( ! pFnSubmitRedeemCode )
-		pFnSubmitRedeemCode = (UFunction*) UObject::GObjObjects()->Data[ 37891 ];
+		return;
 
 	USFXOnlineComponentCommerce_execSubmitRedeemCode_Parms SubmitRedeemCode_Parms;
 	SubmitRedeemCode_Parms.bContinue = bContinue;
@@ -33526,10 +32027,9 @@ void USFXOnlineComponentCommerce::SubmitRedeemCode ( unsigned long bContinue, st
 
 void USFXOnlineComponentCommerce::PromptRedeemCode ( struct FScriptDelegate dCallback )
 {
-	static UFunction* pFnPromptRedeemCode = NULL;
-
+	UFunction* pFnPromptRedeemCode = (UFunction*) SdkBindings::Get ( 3583 );
 	if ( ! pFnPromptRedeemCode )
-		pFnPromptRedeemCode = (UFunction*) UObject::GObjObjects()->Data[ 37889 ];
+		return;
 
 	USFXOnlineComponentCommerce_execPromptRedeemCode_Parms PromptRedeemCode_Parms;
 	memcpy ( &PromptRedeemCode_Parms.dCallback, &dCallback, 0xC );
@@ -33548,10 +32048,9 @@ void USFXOnlineComponentCommerce::PromptRedeemCode ( struct FScriptDelegate dCal
 
 void USFXOnlineComponentCommerce::OnPromptRedeemCodeResult ( int nResult )
 {
-	static UFunction* pFnOnPromptRedeemCodeResult = NULL;
-
+	UFunction* pFnOnPromptRedeemCodeResult = (UFunction*) SdkBindings::Get ( 3582 );
 	if ( ! pFnOnPromptRedeemCodeResult )
-		pFnOnPromptRedeemCodeResult = (UFunction*) UObject::GObjObjects()->Data[ 37887 ];
+		return;
 
 	USFXOnlineComponentCommerce_execOnPromptRedeemCodeResult_Parms OnPromptRedeemCodeResult_Parms;
 	OnPromptRedeemCodeResult_Parms.nResult = nResult;
@@ -33565,10 +32064,9 @@ void USFXOnlineComponentCommerce::OnPromptRedeemCodeResult ( int nResult )
 
 void USFXOnlineComponentCommerce::CompleteProcessAutoGrant ( )
 {
-	static UFunction* pFnCompleteProcessAutoGrant = NULL;
-
+	UFunction* pFnCompleteProcessAutoGrant = (UFunction*) SdkBindings::Get ( 3581 );
 	if ( ! pFnCompleteProcessAutoGrant )
-		pFnCompleteProcessAutoGrant = (UFunction*) UObject::GObjObjects()->Data[ 37886 ];
+		return;
 
 	USFXOnlineComponentCommerce_execCompleteProcessAutoGrant_Parms CompleteProcessAutoGrant_Parms;
 
@@ -33587,10 +32085,9 @@ void USFXOnlineComponentCommerce::CompleteProcessAutoGrant ( )
 
 void USFXOnlineComponentCommerce::ProcessNextAutoGrant ( struct FBWEntitlementId Id, int nResult )
 {
-	static UFunction* pFnProcessNextAutoGrant = NULL;
-
+	UFunction* pFnProcessNextAutoGrant = (UFunction*) SdkBindings::Get ( 3580 );
 	if ( ! pFnProcessNextAutoGrant )
-		pFnProcessNextAutoGrant = (UFunction*) UObject::GObjObjects()->Data[ 37883 ];
+		return;
 
 	USFXOnlineComponentCommerce_execProcessNextAutoGrant_Parms ProcessNextAutoGrant_Parms;
 	memcpy ( &ProcessNextAutoGrant_Parms.Id, &Id, 0x4 );
@@ -33610,10 +32107,9 @@ void USFXOnlineComponentCommerce::ProcessNextAutoGrant ( struct FBWEntitlementId
 
 void USFXOnlineComponentCommerce::ProcessAutoGrants ( struct FScriptDelegate dCallback )
 {
-	static UFunction* pFnProcessAutoGrants = NULL;
-
+	UFunction* pFnProcessAutoGrants = (UFunction*) SdkBindings::Get ( 3579 );
 	if ( ! pFnProcessAutoGrants )
-		pFnProcessAutoGrants = (UFunction*) UObject::GObjObjects()->Data[ 37881 ];
+		return;
 
 	USFXOnlineComponentCommerce_execProcessAutoGrants_Parms ProcessAutoGrants_Parms;
 	memcpy ( &ProcessAutoGrants_Parms.dCallback, &dCallback, 0xC );
@@ -33631,10 +32127,9 @@ void USFXOnlineComponentCommerce::ProcessAutoGrants ( struct FScriptDelegate dCa
 
 void USFXOnlineComponentCommerce::OnProcessAutoGrantsComplete ( )
 {
-	static UFunction* pFnOnProcessAutoGrantsComplete = NULL;
-
+	UFunction* pFnOnProcessAutoGrantsComplete = (UFunction*) SdkBindings::Get ( 3578 );
 	if ( ! pFnOnProcessAutoGrantsComplete )
-		pFnOnProcessAutoGrantsComplete = (UFunction*) UObject::GObjObjects()->Data[ 37880 ];
+		return;
 
 	USFXOnlineComponentCommerce_execOnProcessAutoGrantsComplete_Parms OnProcessAutoGrantsComplete_Parms;
 
@@ -33651,10 +32146,9 @@ void USFXOnlineComponentCommerce::OnProcessAutoGrantsComplete ( )
 
 bool USFXOnlineComponentCommerce::GrantEntitlementId ( struct FBWEntitlementId Id, struct FScriptDelegate dCallback, unsigned long bUseNucleusCheck )
 {
-	static UFunction* pFnGrantEntitlementId = NULL;
-
+	UFunction* pFnGrantEntitlementId = (UFunction*) SdkBindings::Get ( 3577 );
 	if ( ! pFnGrantEntitlementId )
-		pFnGrantEntitlementId = (UFunction*) UObject::GObjObjects()->Data[ 37875 ];
+		return {};
 
 	USFXOnlineComponentCommerce_execGrantEntitlementId_Parms GrantEntitlementId_Parms;
 	memcpy ( &GrantEntitlementId_Parms.Id, &Id, 0x4 );
@@ -33678,10 +32172,9 @@ bool USFXOnlineComponentCommerce::GrantEntitlementId ( struct FBWEntitlementId I
 
 void USFXOnlineComponentCommerce::OnGrantEntitlementResult ( struct FBWEntitlementId Id, int nResult )
 {
-	static UFunction* pFnOnGrantEntitlementResult = NULL;
-
+	UFunction* pFnOnGrantEntitlementResult = (UFunction*) SdkBindings::Get ( 3576 );
 	if ( ! pFnOnGrantEntitlementResult )
-		pFnOnGrantEntitlementResult = (UFunction*) UObject::GObjObjects()->Data[ 37872 ];
+		return;
 
 	USFXOnlineComponentCommerce_execOnGrantEntitlementResult_Parms OnGrantEntitlementResult_Parms;
 	memcpy ( &OnGrantEntitlementResult_Parms.Id, &Id, 0x4 );
@@ -33700,10 +32193,9 @@ void USFXOnlineComponentCommerce::OnGrantEntitlementResult ( struct FBWEntitleme
 
 bool USFXOnlineComponentCommerce::ConsumeId ( struct FBWConsumableId Id, int nCopies, struct FScriptDelegate dCallback )
 {
-	static UFunction* pFnConsumeId = NULL;
-
+	UFunction* pFnConsumeId = (UFunction*) SdkBindings::Get ( 3575 );
 	if ( ! pFnConsumeId )
-		pFnConsumeId = (UFunction*) UObject::GObjObjects()->Data[ 37867 ];
+		return {};
 
 	USFXOnlineComponentCommerce_execConsumeId_Parms ConsumeId_Parms;
 	memcpy ( &ConsumeId_Parms.Id, &Id, 0x4 );
@@ -33728,10 +32220,9 @@ bool USFXOnlineComponentCommerce::ConsumeId ( struct FBWConsumableId Id, int nCo
 
 void USFXOnlineComponentCommerce::OnConsumeResult ( struct FBWConsumableId Id, int nCopies, int nResult )
 {
-	static UFunction* pFnOnConsumeResult = NULL;
-
+	UFunction* pFnOnConsumeResult = (UFunction*) SdkBindings::Get ( 3574 );
 	if ( ! pFnOnConsumeResult )
-		pFnOnConsumeResult = (UFunction*) UObject::GObjObjects()->Data[ 37863 ];
+		return;
 
 	USFXOnlineComponentCommerce_execOnConsumeResult_Parms OnConsumeResult_Parms;
 	memcpy ( &OnConsumeResult_Parms.Id, &Id, 0x4 );
@@ -33750,10 +32241,9 @@ void USFXOnlineComponentCommerce::OnConsumeResult ( struct FBWConsumableId Id, i
 
 bool USFXOnlineComponentCommerce::eventGetConsumableInfo ( struct FBWConsumableId Id, struct FBWConsumableInfo* oConsumable )
 {
-	static UFunction* pFnGetConsumableInfo = NULL;
-
+	UFunction* pFnGetConsumableInfo = (UFunction*) SdkBindings::Get ( 3573 );
 	if ( ! pFnGetConsumableInfo )
-		pFnGetConsumableInfo = (UFunction*) UObject::GObjObjects()->Data[ 37858 ];
+		return {};
 
 	USFXOnlineComponentCommerce_eventGetConsumableInfo_Parms GetConsumableInfo_Parms;
 	memcpy ( &GetConsumableInfo_Parms.Id, &Id, 0x4 );
@@ -33774,10 +32264,9 @@ bool USFXOnlineComponentCommerce::eventGetConsumableInfo ( struct FBWConsumableI
 
 bool USFXOnlineComponentCommerce::eventGetConsumablesList ( TArray< struct FBWConsumableInfo >* aConsumables )
 {
-	static UFunction* pFnGetConsumablesList = NULL;
-
+	UFunction* pFnGetConsumablesList = (UFunction*) SdkBindings::Get ( 3572 );
 	if ( ! pFnGetConsumablesList )
-		pFnGetConsumablesList = (UFunction*) UObject::GObjObjects()->Data[ 37854 ];
+		return {};
 
 	USFXOnlineComponentCommerce_eventGetConsumablesList_Parms GetConsumablesList_Parms;
 
@@ -33798,10 +32287,9 @@ bool USFXOnlineComponentCommerce::eventGetConsumablesList ( TArray< struct FBWCo
 
 bool USFXOnlineComponentCommerce::eventGetEntitlementInfo ( struct FBWEntitlementId Id, struct FBWEntitlementInfo* oEntitlement )
 {
-	static UFunction* pFnGetEntitlementInfo = NULL;
-
+	UFunction* pFnGetEntitlementInfo = (UFunction*) SdkBindings::Get ( 3571 );
 	if ( ! pFnGetEntitlementInfo )
-		pFnGetEntitlementInfo = (UFunction*) UObject::GObjObjects()->Data[ 37849 ];
+		return {};
 
 	USFXOnlineComponentCommerce_eventGetEntitlementInfo_Parms GetEntitlementInfo_Parms;
 	memcpy ( &GetEntitlementInfo_Parms.Id, &Id, 0x4 );
@@ -33822,10 +32310,9 @@ bool USFXOnlineComponentCommerce::eventGetEntitlementInfo ( struct FBWEntitlemen
 
 bool USFXOnlineComponentCommerce::eventGetEntitlementsList ( TArray< struct FBWEntitlementInfo >* aEntitlements )
 {
-	static UFunction* pFnGetEntitlementsList = NULL;
-
+	UFunction* pFnGetEntitlementsList = (UFunction*) SdkBindings::Get ( 3570 );
 	if ( ! pFnGetEntitlementsList )
-		pFnGetEntitlementsList = (UFunction*) UObject::GObjObjects()->Data[ 37845 ];
+		return {};
 
 	USFXOnlineComponentCommerce_eventGetEntitlementsList_Parms GetEntitlementsList_Parms;
 
@@ -33844,10 +32331,9 @@ bool USFXOnlineComponentCommerce::eventGetEntitlementsList ( TArray< struct FBWE
 
 void USFXOnlineComponentCommerce::RefreshDigitalRights ( struct FScriptDelegate dCallback )
 {
-	static UFunction* pFnRefreshDigitalRights = NULL;
-
+	UFunction* pFnRefreshDigitalRights = (UFunction*) SdkBindings::Get ( 3569 );
 	if ( ! pFnRefreshDigitalRights )
-		pFnRefreshDigitalRights = (UFunction*) UObject::GObjObjects()->Data[ 37843 ];
+		return;
 
 	USFXOnlineComponentCommerce_execRefreshDigitalRights_Parms RefreshDigitalRights_Parms;
 	memcpy ( &RefreshDigitalRights_Parms.dCallback, &dCallback, 0xC );
@@ -33866,10 +32352,9 @@ void USFXOnlineComponentCommerce::RefreshDigitalRights ( struct FScriptDelegate
 
 void USFXOnlineComponentCommerce::OnRefreshDigitalRightsResult ( int nResult )
 {
-	static UFunction* pFnOnRefreshDigitalRightsResult = NULL;
-
+	UFunction* pFnOnRefreshDigitalRightsResult = (UFunction*) SdkBindings::Get ( 3568 );
 	if ( ! pFnOnRefreshDigitalRightsResult )
-		pFnOnRefreshDigitalRightsResult = (UFunction*) UObject::GObjObjects()->Data[ 37841 ];
+		return;
 
 	USFXOnlineComponentCommerce_execOnRefreshDigitalRightsResult_Parms OnRefreshDigitalRightsResult_Parms;
 	OnRefreshDigitalRightsResult_Parms.nResult = nResult;
@@ -33884,10 +32369,9 @@ void USFXOnlineComponentCommerce::OnRefreshDigitalRightsResult ( int nResult )
 
 void USFXOnlineComponentCommerce::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
-
+	UFunction* pFnOnTick = (UFunction*) SdkBindings::Get ( 3567 );
 	if ( ! pFnOnTick )
-		pFnOnTick = (UFunction*) UObject::GObjObjects()->Data[ 37839 ];
+		return;
 
 	USFXOnlineComponentCommerce_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
@@ -33906,10 +32390,9 @@ void USFXOnlineComponentCommerce::OnTick ( class USFXOnlineEvent* oEvent )
 
 struct FName USFXOnlineComponentCommerce::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
-
+	UFunction* pFnGetAPIName = (UFunction*) SdkBindings::Get ( 3566 );
 	if ( ! pFnGetAPIName )
-		pFnGetAPIName = (UFunction*) UObject::GObjObjects()->Data[ 37837 ];
+		return {};
 
 	USFXOnlineComponentCommerce_execGetAPIName_Parms GetAPIName_Parms;
 
@@ -33928,10 +32411,9 @@ struct FName USFXOnlineComponentCommerce::GetAPIName ( )
 
 void USFXOnlineComponentCommerce::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
-
+	UFunction* pFnOnRelease = (UFunction*) SdkBindings::Get ( 3565 );
 	if ( ! pFnOnRelease )
-		pFnOnRelease = (UFunction*) UObject::GObjObjects()->Data[ 37836 ];
+		return;
 
 	USFXOnlineComponentCommerce_execOnRelease_Parms OnRelease_Parms;
 
@@ -33949,10 +32431,9 @@ void USFXOnlineComponentCommerce::OnRelease ( )
 
 void USFXOnlineComponentCommerce::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
-
+	UFunction* pFnOnInitialize = (UFunction*) SdkBindings::Get ( 3564 );
 	if ( ! pFnOnInitialize )
-		pFnOnInitialize = (UFunction*) UObject::GObjObjects()->Data[ 37834 ];
+		return;
 
 	USFXOnlineComponentCommerce_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
@@ -33972,10 +32453,9 @@ void USFXOnlineComponentCommerce::OnInitialize ( class USFXOnlineSubsystem* oOnl
 
 void Usfxonlinestatswrite::DecrementIntStat ( int StatId, int DecBy )
 {
-	static UFunction* pFnDecrementIntStat = NULL;
-
+	UFunction* pFnDecrementIntStat = (UFunction*) SdkBindings::Get ( 2479 );
 	if ( ! pFnDecrementIntStat )
-		pFnDecrementIntStat = (UFunction*) UObject::GObjObjects()->Data[ 23272 ];
+		return;
 
 	Usfxonlinestatswrite_execDecrementIntStat_Parms DecrementIntStat_Parms;
 	DecrementIntStat_Parms.StatId = StatId;
@@ -33996,10 +32476,9 @@ void Usfxonlinestatswrite::DecrementIntStat ( int StatId, int DecBy )
 
 void Usfxonlinestatswrite::DecrementFloatStat ( int StatId, float DecBy )
 {
-	static UFunction* pFnDecrementFloatStat = NULL;
-
+	UFunction* pFnDecrementFloatStat = (UFunction*) SdkBindings::Get ( 2478 );
 	if ( ! pFnDecrementFloatStat )
-		pFnDecrementFloatStat = (UFunction*) UObject::GObjObjects()->Data[ 23269 ];
+		return;
 
 	Usfxonlinestatswrite_execDecrementFloatStat_Parms DecrementFloatStat_Parms;
 	DecrementFloatStat_Parms.StatId = StatId;
@@ -34020,10 +32499,9 @@ void Usfxonlinestatswrite::DecrementFloatStat ( int StatId, float DecBy )
 
 void Usfxonlinestatswrite::IncrementIntStat ( int StatId, int IncBy )
 {
-	static UFunction* pFnIncrementIntStat = NULL;
-
+	UFunction* pFnIncrementIntStat = (UFunction*) SdkBindings::Get ( 2477 );
 	if ( ! pFnIncrementIntStat )
-		pFnIncrementIntStat = (UFunction*) UObject::GObjObjects()->Data[ 23266 ];
+		return;
 
 	Usfxonlinestatswrite_execIncrementIntStat_Parms IncrementIntStat_Parms;
 	IncrementIntStat_Parms.StatId = StatId;
@@ -34044,10 +32522,9 @@ void Usfxonlinestatswrite::IncrementIntStat ( int StatId, int IncBy )
 
 void Usfxonlinestatswrite::IncrementFloatStat ( int StatId, float IncBy )
 {
-	static UFunction* pFnIncrementFloatStat = NULL;
-
+	UFunction* pFnIncrementFloatStat = (UFunction*) SdkBindings::Get ( 2476 );
 	if ( ! pFnIncrementFloatStat )
-		pFnIncrementFloatStat = (UFunction*) UObject::GObjObjects()->Data[ 23263 ];
+		return;
 
 	Usfxonlinestatswrite_execIncrementFloatStat_Parms IncrementFloatStat_Parms;
 	IncrementFloatStat_Parms.StatId = StatId;
@@ -34068,10 +32545,9 @@ void Usfxonlinestatswrite::IncrementFloatStat ( int StatId, float IncBy )
 
 void Usfxonlinestatswrite::SetIntStat ( int StatId, int Value )
 {
-	static UFunction* pFnSetIntStat = NULL;
-
+	UFunction* pFnSetIntStat = (UFunction*) SdkBindings::Get ( 2475 );
 	if ( ! pFnSetIntStat )
-		pFnSetIntStat = (UFunction*) UObject::GObjObjects()->Data[ 23260 ];
+		return;
 
 	Usfxonlinestatswrite_execSetIntStat_Parms SetIntStat_Parms;
 	SetIntStat_Parms.StatId = StatId;
@@ -34092,10 +32568,9 @@ void Usfxonlinestatswrite::SetIntStat ( int StatId, int Value )
 
 void Usfxonlinestatswrite::SetFloatStat ( int StatId, float Value )
 {
-	static UFunction* pFnSetFloatStat = NULL;
-
+	UFunction* pFnSetFloatStat = (UFunction*) SdkBindings::Get ( 2474 );
 	if ( ! pFnSetFloatStat )
-		pFnSetFloatStat = (UFunction*) UObject::GObjObjects()->Data[ 23257 ];
+		return;
 
 	Usfxonlinestatswrite_execSetFloatStat_Parms SetFloatStat_Parms;
 	SetFloatStat_Parms.StatId = StatId;
@@ -34116,10 +32591,9 @@ void Usfxonlinestatswrite::SetFloatStat ( int StatId, float Value )
 
 struct FName Usfxonlinestatswrite::GetStatName ( int StatId )
 {
-	static UFunction* pFnGetStatName = NULL;
-
+	UFunction* pFnGetStatName = (UFunction*) SdkBindings::Get ( 2473 );
 	if ( ! pFnGetStatName )
-		pFnGetStatName = (UFunction*) UObject::GObjObjects()->Data[ 23254 ];
+		return {};
 
 	Usfxonlinestatswrite_execGetStatName_Parms GetStatName_Parms;
 	GetStatName_Parms.StatId = StatId;
@@ -34142,10 +32616,9 @@ struct FName Usfxonlinestatswrite::GetStatName ( int StatId )
 
 bool Usfxonlinestatswrite::GetStatId ( struct FName StatName, int* StatId )
 {
-	static UFunction* pFnGetStatId = NULL;
-
+	UFunction* pFnGetStatId = (UFunction*) SdkBindings::Get ( 2472 );
 	if ( ! pFnGetStatId )
-		pFnGetStatId = (UFunction*) UObject::GObjObjects()->Data[ 23250 ];
+		return {};
 
 	Usfxonlinestatswrite_execGetStatId_Parms GetStatId_Parms;
 	memcpy ( &GetStatId_Parms.StatName, &StatName, 0x8 );
@@ -34168,10 +32641,9 @@ bool Usfxonlinestatswrite::GetStatId ( struct FName StatName, int* StatId )
 
 void Usfxonlinestatswrite::OnStatsWriteComplete ( )
 {
-	static UFunction* pFnOnStatsWriteComplete = NULL;
-
+	UFunction* pFnOnStatsWriteComplete = (UFunction*) SdkBindings::Get ( 2471 );
 	if ( ! pFnOnStatsWriteComplete )
-		pFnOnStatsWriteComplete = (UFunction*) UObject::GObjObjects()->Data[ 23249 ];
+		return;
 
 	Usfxonlinestatswrite_execOnStatsWriteComplete_Parms OnStatsWriteComplete_Parms;
 
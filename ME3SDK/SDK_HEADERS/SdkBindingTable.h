@@ -0,0 +1,8157 @@
+/*
+#############################################################################################
+# Mass Effect 3 (1.5) SDK
+# Generated with TheFeckless UE3 SDK Generator v1.4_Beta-Rev.51
+# ========================================================================================= #
+# File: SdkBindingTable.h
+# ========================================================================================= #
+# Credits: uNrEaL, Tamimego, SystemFiles, R00T88, _silencer, the1domo, K@N@VEL
+# Thanks: HOOAH07, lowHertz
+# Forums: www.uc-forum.com, www.gamedeception.net
+#############################################################################################
+*/
+
+// Every class and function the generated headers bind, by binding slot: the GObjObjects index the SDK was
+// generated against and the full name expected there. SdkBindings::Get ( slot ) returns the resolved object.
+
+#define SDK_BINDING_COUNT 8134
+
+const SdkBinding GSdkBindingTable[ SDK_BINDING_COUNT ] = 
+{
+	{ 0, "Class Core.TextBuffer" },	// 0
+	{ 1, "Class Core.Object" },	// 1
+	{ 2, "Class Core.System" },	// 2
+	{ 3, "Class Core.Subsystem" },	// 3
+	{ 4, "Class Core.PackageMap" },	// 4
+	{ 5, "Class Core.ObjectSerializer" },	// 5
+	{ 6, "Class Core.ObjectRedirector" },	// 6
+	{ 7, "Class Core.MetaData" },	// 7
+	{ 8, "Class Core.LinkerSave" },	// 8
+	{ 9, "Class Core.Linker" },	// 9
+	{ 10, "Class Core.LinkerLoad" },	// 10
+	{ 11, "Class Core.Interface" },	// 11
+	{ 12, "Class Core.ScriptStruct" },	// 12
+	{ 13, "Class Core.Struct" },	// 13
+	{ 14, "Class Core.Field" },	// 14
+	{ 15, "Class Core.Function" },	// 15
+	{ 16, "Class Core.StructProperty" },	// 16
+	{ 17, "Class Core.Property" },	// 17
+	{ 18, "Class Core.StrProperty" },	// 18
+	{ 19, "Class Core.StringRefProperty" },	// 19
+	{ 20, "Class Core.ComponentProperty" },	// 20
+	{ 21, "Class Core.ObjectProperty" },	// 21
+	{ 22, "Class Core.ClassProperty" },	// 22
+	{ 23, "Class Core.NameProperty" },	// 23
+	{ 24, "Class Core.MapProperty" },	// 24
+	{ 25, "Class Core.IntProperty" },	// 25
+	{ 26, "Class Core.InterfaceProperty" },	// 26
+	{ 27, "Class Core.FloatProperty" },	// 27
+	{ 28, "Class Core.DelegateProperty" },	// 28
+	{ 29, "Class Core.ByteProperty" },	// 29
+	{ 30, "Class Core.BoolProperty" },	// 30
+	{ 31, "Class Core.BioMask4Property" },	// 31
+	{ 32, "Class Core.ArrayProperty" },	// 32
+	{ 33, "Class Core.Enum" },	// 33
+	{ 34, "Class Core.Const" },	// 34
+	{ 35, "Class Core.TextBufferFactory" },	// 35
+	{ 36, "Class Core.Factory" },	// 36
+	{ 37, "Class Core.Exporter" },	// 37
+	{ 38, "Class Core.DistributionVector" },	// 38
+	{ 39, "Class Core.Component" },	// 39
+	{ 40, "Class Core.DistributionFloat" },	// 40
+	{ 41, "Class Core.HelpCommandlet" },	// 41
+	{ 42, "Class Core.Commandlet" },	// 42
+	{ 43, "Class Core.Package" },	// 43
+	{ 44, "Class Core.State" },	// 44
+	{ 45, "Class Core.Class" },	// 45
+	{ 46, "Class Engine.Engine" },	// 46
+	{ 47, "Class Engine.GameEngine" },	// 47
+	{ 48, "Class Engine.Actor" },	// 48
+	{ 49, "Class Engine.Brush" },	// 49
+	{ 50, "Class Engine.BrushShape" },	// 50
+	{ 51, "Class Engine.Volume" },	// 51
+	{ 52, "Class Engine.BlockingVolume" },	// 52
+	{ 53, "Class Engine.DynamicBlockingVolume" },	// 53
+	{ 54, "Class Engine.CullDistanceVolume" },	// 54
+	{ 55, "Class Engine.LevelStreamingVolume" },	// 55
+	{ 56, "Class Engine.LightmassImportanceVolume" },	// 56
+	{ 57, "Class Engine.PathBlockingVolume" },	// 57
+	{ 58, "Class Engine.PhysicsVolume" },	// 58
+	{ 59, "Class Engine.DefaultPhysicsVolume" },	// 59
+	{ 60, "Class Engine.GravityVolume" },	// 60
+	{ 61, "Class Engine.LadderVolume" },	// 61
+	{ 62, "Class Engine.PortalVolume" },	// 62
+	{ 63, "Class Engine.PostProcessVolume" },	// 63
+	{ 64, "Class Engine.ReverbVolume" },	// 64
+	{ 65, "Class Engine.TriggerVolume" },	// 65
+	{ 66, "Class Engine.DroppedPickup" },	// 66
+	{ 67, "Class Engine.DynamicSMActor" },	// 67
+	{ 68, "Class Engine.InterpActor" },	// 68
+	{ 69, "Class Engine.Emitter" },	// 69
+	{ 70, "Class Engine.EmitterPool" },	// 70
+	{ 71, "Class Engine.HUD" },	// 71
+	{ 72, "Class Engine.Info" },	// 72
+	{ 73, "Class Engine.AutoTestManager" },	// 73
+	{ 74, "Class Engine.CoverGroup" },	// 74
+	{ 75, "Class Engine.FileWriter" },	// 75
+	{ 76, "Class Engine.FileLog" },	// 76
+	{ 77, "Class Engine.GameInfo" },	// 77
+	{ 78, "Class Engine.MCPTools" },	// 78
+	{ 79, "Class Engine.Mutator" },	// 79
+	{ 80, "Class Engine.PotentialClimbWatcher" },	// 80
+	{ 81, "Class Engine.Route" },	// 81
+	{ 82, "Class Engine.WindPointSource" },	// 82
+	{ 83, "Class Engine.ZoneInfo" },	// 83
+	{ 84, "Class Engine.WorldInfo" },	// 84
+	{ 85, "Class Engine.Inventory" },	// 85
+	{ 86, "Class Engine.Weapon" },	// 86
+	{ 87, "Class Engine.InventoryManager" },	// 87
+	{ 88, "Class Engine.Keypoint" },	// 88
+	{ 89, "Class Engine.TargetPoint" },	// 89
+	{ 90, "Class Engine.MaterialInstanceActor" },	// 90
+	{ 91, "Class Engine.MatineeActor" },	// 91
+	{ 92, "Class Engine.NavigationPoint" },	// 92
+	{ 93, "Class Engine.CoverLink" },	// 93
+	{ 94, "Class Engine.SFXDynamicCoverLink" },	// 94
+	{ 95, "Class Engine.CoverSlotMarker" },	// 95
+	{ 96, "Class Engine.SFXDynamicCoverSlotMarker" },	// 96
+	{ 97, "Class Engine.DoorMarker" },	// 97
+	{ 98, "Class Engine.DynamicAnchor" },	// 98
+	{ 99, "Class Engine.Ladder" },	// 99
+	{ 100, "Class Engine.AutoLadder" },	// 100
+	{ 101, "Class Engine.LiftCenter" },	// 101
+	{ 102, "Class Engine.LiftExit" },	// 102
+	{ 103, "Class Engine.MantleMarker" },	// 103
+	{ 104, "Class Engine.Objective" },	// 104
+	{ 105, "Class Engine.PathNode" },	// 105
+	{ 106, "Class Engine.VolumePathNode" },	// 106
+	{ 107, "Class Engine.PickupFactory" },	// 107
+	{ 108, "Class Engine.PlayerStart" },	// 108
+	{ 109, "Class Engine.PortalMarker" },	// 109
+	{ 110, "Class Engine.Pylon" },	// 110
+	{ 111, "Class Engine.AISwitchablePylon" },	// 111
+	{ 112, "Class Engine.DynamicPylon" },	// 112
+	{ 113, "Class Engine.SFXDynamicPathNode" },	// 113
+	{ 114, "Class Engine.Teleporter" },	// 114
+	{ 115, "Class Engine.Note" },	// 115
+	{ 116, "Class Engine.Projectile" },	// 116
+	{ 117, "Class Engine.RigidBodyBase" },	// 117
+	{ 118, "Class Engine.SceneCaptureActor" },	// 118
+	{ 119, "Class Engine.SceneCapture2DActor" },	// 119
+	{ 120, "Class Engine.SceneCaptureCubeMapActor" },	// 120
+	{ 121, "Class Engine.SceneCaptureReflectActor" },	// 121
+	{ 122, "Class Engine.SceneCapturePortalActor" },	// 122
+	{ 123, "Class Engine.PortalTeleporter" },	// 123
+	{ 124, "Class Engine.StaticMeshActorBase" },	// 124
+	{ 125, "Class Engine.StaticMeshActor" },	// 125
+	{ 126, "Class Engine.StaticMeshCollectionActor" },	// 126
+	{ 127, "Class Engine.StaticMeshActorBasedOnExtremeContent" },	// 127
+	{ 128, "Class Engine.Trigger" },	// 128
+	{ 129, "Class Engine.ActorComponent" },	// 129
+	{ 130, "Class Engine.AudioComponent" },	// 130
+	{ 131, "Class Engine.HeightFogComponent" },	// 131
+	{ 132, "Class Engine.PrimitiveComponent" },	// 132
+	{ 133, "Class Engine.ArrowComponent" },	// 133
+	{ 134, "Class Engine.BrushComponent" },	// 134
+	{ 135, "Class Engine.CameraConeComponent" },	// 135
+	{ 136, "Class Engine.CylinderComponent" },	// 136
+	{ 137, "Class Engine.DrawBoxComponent" },	// 137
+	{ 138, "Class Engine.DrawCapsuleComponent" },	// 138
+	{ 139, "Class Engine.DrawConeComponent" },	// 139
+	{ 140, "Class Engine.DrawCylinderComponent" },	// 140
+	{ 141, "Class Engine.DrawFrustumComponent" },	// 141
+	{ 142, "Class Engine.DrawQuadComponent" },	// 142
+	{ 143, "Class Engine.DrawSphereComponent" },	// 143
+	{ 144, "Class Engine.DrawPylonRadiusComponent" },	// 144
+	{ 145, "Class Engine.DrawSoundRadiusComponent" },	// 145
+	{ 146, "Class Engine.LineBatchComponent" },	// 146
+	{ 147, "Class Engine.MeshComponent" },	// 147
+	{ 148, "Class Engine.StaticMeshComponent" },	// 148
+	{ 149, "Class Engine.ModelComponent" },	// 149
+	{ 150, "Class Engine.SpriteComponent" },	// 150
+	{ 151, "Class Engine.RadialBlurComponent" },	// 151
+	{ 152, "Class Engine.SceneCaptureComponent" },	// 152
+	{ 153, "Class Engine.SceneCapture2DComponent" },	// 153
+	{ 154, "Class Engine.SceneCapture2DHitMaskComponent" },	// 154
+	{ 155, "Class Engine.SceneCaptureCubeMapComponent" },	// 155
+	{ 156, "Class Engine.SceneCapturePortalComponent" },	// 156
+	{ 157, "Class Engine.SceneCaptureReflectComponent" },	// 157
+	{ 158, "Class Engine.WindDirectionalSourceComponent" },	// 158
+	{ 159, "Class Engine.WindPointSourceComponent" },	// 159
+	{ 160, "Class Engine.ActorFactory" },	// 160
+	{ 161, "Class Engine.ActorFactoryActor" },	// 161
+	{ 162, "Class Engine.ActorFactoryAI" },	// 162
+	{ 163, "Class Engine.ActorFactoryAmbientSound" },	// 163
+	{ 164, "Class Engine.ActorFactoryAmbientSoundMovable" },	// 164
+	{ 165, "Class Engine.ActorFactoryAmbientSoundSimple" },	// 165
+	{ 166, "Class Engine.ActorFactoryAmbientSoundNonLoop" },	// 166
+	{ 167, "Class Engine.ActorFactoryAmbientSoundSimpleToggleable" },	// 167
+	{ 168, "Class Engine.ActorFactoryApexDestructible" },	// 168
+	{ 169, "Class Engine.ActorFactoryArchetype" },	// 169
+	{ 170, "Class Engine.ActorFactoryCoverLink" },	// 170
+	{ 171, "Class Engine.ActorFactoryDominantDirectionalLight" },	// 171
+	{ 172, "Class Engine.ActorFactoryDynamicSM" },	// 172
+	{ 173, "Class Engine.ActorFactoryMover" },	// 173
+	{ 174, "Class Engine.ActorFactoryRigidBody" },	// 174
+	{ 175, "Class Engine.ActorFactoryEmitter" },	// 175
+	{ 176, "Class Engine.ActorFactoryFracturedStaticMesh" },	// 176
+	{ 177, "Class Engine.ActorFactoryLensFlare" },	// 177
+	{ 178, "Class Engine.ActorFactoryLight" },	// 178
+	{ 179, "Class Engine.ActorFactoryPathNode" },	// 179
+	{ 180, "Class Engine.ActorFactoryPhysicsAsset" },	// 180
+	{ 181, "Class Engine.ActorFactoryPhysXDestructible" },	// 181
+	{ 182, "Class Engine.ActorFactoryPlayerStart" },	// 182
+	{ 183, "Class Engine.ActorFactoryPylon" },	// 183
+	{ 184, "Class Engine.ActorFactorySkeletalMesh" },	// 184
+	{ 185, "Class Engine.ActorFactoryStaticMesh" },	// 185
+	{ 186, "Class Engine.ActorFactoryTrigger" },	// 186
+	{ 187, "Class Engine.ActorFactoryVehicle" },	// 187
+	{ 188, "Class Engine.BioEngineEnums" },	// 188
+	{ 189, "Class Engine.BioParallelAnimUpdater" },	// 189
+	{ 190, "Class Engine.BioPathQueue" },	// 190
+	{ 191, "Class Engine.BioTestFramework" },	// 191
+	{ 192, "Class Engine.BookMark" },	// 192
+	{ 193, "Class Engine.Canvas" },	// 193
+	{ 194, "Class Engine.Channel" },	// 194
+	{ 195, "Class Engine.ActorChannel" },	// 195
+	{ 196, "Class Engine.ControlChannel" },	// 196
+	{ 197, "Class Engine.FileChannel" },	// 197
+	{ 198, "Class Engine.VoiceChannel" },	// 198
+	{ 199, "Class Engine.Controller" },	// 199
+	{ 200, "Class Engine.PlayerController" },	// 200
+	{ 201, "Class Engine.CheatManager" },	// 201
+	{ 202, "Class Engine.Client" },	// 202
+	{ 203, "Class Engine.ClipPadEntry" },	// 203
+	{ 204, "Class Engine.CodecMovie" },	// 204
+	{ 205, "Class Engine.CodecMovieBink" },	// 205
+	{ 206, "Class Engine.CodecMovieFallback" },	// 206
+	{ 207, "Class Engine.CurveEdPresetCurve" },	// 207
+	{ 208, "Class Engine.CustomPropertyItemHandler" },	// 208
+	{ 209, "Class Engine.DamageType" },	// 209
+	{ 210, "Class Engine.KillZDamageType" },	// 210
+	{ 211, "Class Engine.DebugManager" },	// 211
+	{ 212, "Class Engine.DistributionFloatConstant" },	// 212
+	{ 213, "Class Engine.DistributionFloatParameterBase" },	// 213
+	{ 214, "Class Engine.DistributionFloatConstantCurve" },	// 214
+	{ 215, "Class Engine.DistributionFloatUniform" },	// 215
+	{ 216, "Class Engine.DistributionFloatUniformCurve" },	// 216
+	{ 217, "Class Engine.DistributionVectorConstant" },	// 217
+	{ 218, "Class Engine.DistributionVectorParameterBase" },	// 218
+	{ 219, "Class Engine.DistributionVectorConstantCurve" },	// 219
+	{ 220, "Class Engine.DistributionVectorUniform" },	// 220
+	{ 221, "Class Engine.DistributionVectorUniformCurve" },	// 221
+	{ 222, "Class Engine.Download" },	// 222
+	{ 223, "Class Engine.ChannelDownload" },	// 223
+	{ 224, "Class Engine.EdCoordSystem" },	// 224
+	{ 225, "Class Engine.EditorLinkSelectionInterface" },	// 225
+	{ 226, "Class Engine.EngineTypes" },	// 226
+	{ 227, "Class Engine.FaceFXAnimSet" },	// 227
+	{ 228, "Class Engine.FaceFXAsset" },	// 228
+	{ 229, "Class Engine.Font" },	// 229
+	{ 230, "Class Engine.MultiFont" },	// 230
+	{ 231, "Class Engine.FontImportOptions" },	// 231
+	{ 232, "Class Engine.ForceFeedbackManager" },	// 232
+	{ 233, "Class Engine.ForceFeedbackWaveform" },	// 233
+	{ 234, "Class Engine.GameplayEvents" },	// 234
+	{ 235, "Class Engine.GameplayEventsReader" },	// 235
+	{ 236, "Class Engine.GameplayEventsWriter" },	// 236
+	{ 237, "Class Engine.GameViewportClient" },	// 237
+	{ 238, "Class Engine.GuidCache" },	// 238
+	{ 239, "Class Engine.Interface_NavigationHandle" },	// 239
+	{ 240, "Class Engine.InterpCurveEdSetup" },	// 240
+	{ 241, "Class Engine.InterpTrack" },	// 241
+	{ 242, "Class Engine.KMeshProps" },	// 242
+	{ 243, "Class Engine.LevelBase" },	// 243
+	{ 244, "Class Engine.Level" },	// 244
+	{ 245, "Class Engine.PendingLevel" },	// 245
+	{ 246, "Class Engine.DemoPlayPendingLevel" },	// 246
+	{ 247, "Class Engine.NetPendingLevel" },	// 247
+	{ 248, "Class Engine.LevelStreaming" },	// 248
+	{ 249, "Class Engine.LevelStreamingAlwaysLoaded" },	// 249
+	{ 250, "Class Engine.LevelStreamingDistance" },	// 250
+	{ 251, "Class Engine.LevelStreamingKismet" },	// 251
+	{ 252, "Class Engine.LevelStreamingPersistent" },	// 252
+	{ 253, "Class Engine.LightmappedSurfaceCollection" },	// 253
+	{ 254, "Class Engine.LightmassLevelSettings" },	// 254
+	{ 255, "Class Engine.LightmassPrimitiveSettingsObject" },	// 255
+	{ 256, "Class Engine.MapInfo" },	// 256
+	{ 257, "Class Engine.Surface" },	// 257
+	{ 258, "Class Engine.MaterialInterface" },	// 258
+	{ 259, "Class Engine.Material" },	// 259
+	{ 260, "Class Engine.MaterialExpression" },	// 260
+	{ 261, "Class Engine.Model" },	// 261
+	{ 262, "Class Engine.MusicTrackDataStructures" },	// 262
+	{ 263, "Class Engine.NavigationMeshBase" },	// 263
+	{ 264, "Class Engine.NetDriver" },	// 264
+	{ 265, "Class Engine.DemoRecDriver" },	// 265
+	{ 266, "Class Engine.ObjectReferencer" },	// 266
+	{ 267, "Class Engine.OnlineGameplayEvents" },	// 267
+	{ 268, "Class Engine.OnlinePlayerStorage" },	// 268
+	{ 269, "Class Engine.OnlineProfileSettings" },	// 269
+	{ 270, "Class Engine.OnlinePlaylistManager" },	// 270
+	{ 271, "Class Engine.OnlineStats" },	// 271
+	{ 272, "Class Engine.OnlineStatsRead" },	// 272
+	{ 273, "Class Engine.OnlineStatsWrite" },	// 273
+	{ 274, "Class Engine.OnlineSubsystem" },	// 274
+	{ 275, "Class Engine.PackageMapLevel" },	// 275
+	{ 276, "Class Engine.PackageMapSeekFree" },	// 276
+	{ 277, "Class Engine.Player" },	// 277
+	{ 278, "Class Engine.LocalPlayer" },	// 278
+	{ 279, "Class Engine.NetConnection" },	// 279
+	{ 280, "Class Engine.ChildConnection" },	// 280
+	{ 281, "Class Engine.DemoRecConnection" },	// 281
+	{ 282, "Class Engine.Polys" },	// 282
+	{ 283, "Class Engine.PostProcessChain" },	// 283
+	{ 284, "Class Engine.PostProcessEffect" },	// 284
+	{ 285, "Class Engine.AmbientOcclusionEffect" },	// 285
+	{ 286, "Class Engine.BioMaterialInstanceEffect" },	// 286
+	{ 287, "Class Engine.BlurEffect" },	// 287
+	{ 288, "Class Engine.DOFEffect" },	// 288
+	{ 289, "Class Engine.DOFAndBloomEffect" },	// 289
+	{ 290, "Class Engine.DOFBloomMotionBlurEffect" },	// 290
+	{ 291, "Class Engine.UberPostProcessEffect" },	// 291
+	{ 292, "Class Engine.MaterialEffect" },	// 292
+	{ 293, "Class Engine.MotionBlurEffect" },	// 293
+	{ 294, "Class Engine.PrimitiveComponentFactory" },	// 294
+	{ 295, "Class Engine.MeshComponentFactory" },	// 295
+	{ 296, "Class Engine.StaticMeshComponentFactory" },	// 296
+	{ 297, "Class Engine.ReachSpec" },	// 297
+	{ 298, "Class Engine.AdvancedReachSpec" },	// 298
+	{ 299, "Class Engine.CeilingReachSpec" },	// 299
+	{ 300, "Class Engine.ForcedReachSpec" },	// 300
+	{ 301, "Class Engine.CoverSlipReachSpec" },	// 301
+	{ 302, "Class Engine.CoverTurnReachSpec" },	// 302
+	{ 303, "Class Engine.FloorToCeilingReachSpec" },	// 303
+	{ 304, "Class Engine.MantleReachSpec" },	// 304
+	{ 305, "Class Engine.SlotToSlotReachSpec" },	// 305
+	{ 306, "Class Engine.SwatTurnReachSpec" },	// 306
+	{ 307, "Class Engine.WallTransReachSpec" },	// 307
+	{ 308, "Class Engine.LadderReachSpec" },	// 308
+	{ 309, "Class Engine.ProscribedReachSpec" },	// 309
+	{ 310, "Class Engine.TeleportReachSpec" },	// 310
+	{ 311, "Class Engine.RvrEffectsMaterialGroup" },	// 311
+	{ 312, "Class Engine.SavedMove" },	// 312
+	{ 313, "Class Engine.SaveGameSummary" },	// 313
+	{ 314, "Class Engine.Selection" },	// 314
+	{ 315, "Class Engine.ServerCommandlet" },	// 315
+	{ 316, "Class Engine.Settings" },	// 316
+	{ 317, "Class Engine.OnlineGameSearch" },	// 317
+	{ 318, "Class Engine.OnlineGameSettings" },	// 318
+	{ 319, "Class Engine.SFXModule" },	// 319
+	{ 320, "Class Engine.SFXModule_DamageBase" },	// 320
+	{ 321, "Class Engine.ShaderCache" },	// 321
+	{ 322, "Class Engine.ShaderCachePayload" },	// 322
+	{ 323, "Class Engine.ShadowMap1D" },	// 323
+	{ 324, "Class Engine.ShadowMap2D" },	// 324
+	{ 325, "Class Engine.SmokeTestCommandlet" },	// 325
+	{ 326, "Class Engine.SpeechRecognition" },	// 326
+	{ 327, "Class Engine.StaticMesh" },	// 327
+	{ 328, "Class Engine.RB_BodySetup" },	// 328
+	{ 329, "Class Engine.FracturedStaticMesh" },	// 329
+	{ 330, "Class Engine.ParticleSystem" },	// 330
+	{ 331, "Class Engine.RvrEffectsMaterialUser" },	// 331
+	{ 332, "Class Engine.RvrMaterialMultiplexor" },	// 332
+	{ 333, "Class Engine.Texture" },	// 333
+	{ 334, "Class Engine.Texture2D" },	// 334
+	{ 335, "Class Engine.LightMapTexture2D" },	// 335
+	{ 336, "Class Engine.ShadowMapTexture2D" },	// 336
+	{ 337, "Class Engine.WaveFormBase" },	// 337
+	{ 338, "Class Engine.World" },	// 338
+	{ 339, "Class Engine.WwiseBaseSoundObject" },	// 339
+	{ 340, "Class Engine.SoundCue" },	// 340
+	{ 341, "Class Engine.EnvironmentVolume" },	// 341
+	{ 342, "Class Engine.TestSplittingVolume" },	// 342
+	{ 343, "Class Engine.AIController" },	// 343
+	{ 344, "Class Engine.CrowdAgentBase" },	// 344
+	{ 345, "Class Engine.CrowdPopulationManagerBase" },	// 345
+	{ 346, "Class Engine.PathTargetPoint" },	// 346
+	{ 347, "Class Engine.NavMeshObstacle" },	// 347
+	{ 348, "Class Engine.PylonSeed" },	// 348
+	{ 349, "Class Engine.CoverGroupRenderingComponent" },	// 349
+	{ 350, "Class Engine.CoverMeshComponent" },	// 350
+	{ 351, "Class Engine.NavMeshRenderingComponent" },	// 351
+	{ 352, "Class Engine.PathRenderingComponent" },	// 352
+	{ 353, "Class Engine.RouteRenderingComponent" },	// 353
+	{ 354, "Class Engine.Interface_NavMeshPathObject" },	// 354
+	{ 355, "Class Engine.Interface_NavMeshPathSwitch" },	// 355
+	{ 356, "Class Engine.Interface_NavMeshPathObstacle" },	// 356
+	{ 357, "Class Engine.NavigationHandle" },	// 357
+	{ 358, "Class Engine.NavMeshPathConstraint" },	// 358
+	{ 359, "Class Engine.NavMeshPath_AlongLine" },	// 359
+	{ 360, "Class Engine.NavMeshPath_EnforceTwoWayEdges" },	// 360
+	{ 361, "Class Engine.NavMeshPath_MinDistBetweenSpecsOfType" },	// 361
+	{ 362, "Class Engine.NavMeshPath_Toward" },	// 362
+	{ 363, "Class Engine.NavMeshPath_WithinDistanceEnvelope" },	// 363
+	{ 364, "Class Engine.NavMeshPath_WithinTraversalDist" },	// 364
+	{ 365, "Class Engine.NavMeshPathGoalEvaluator" },	// 365
+	{ 366, "Class Engine.NavMeshGoal_At" },	// 366
+	{ 367, "Class Engine.NavMeshGoal_ClosestActorInList" },	// 367
+	{ 368, "Class Engine.NavMeshGoal_Null" },	// 368
+	{ 369, "Class Engine.NavMeshGoal_PolyEncompassesAI" },	// 369
+	{ 370, "Class Engine.PathConstraint" },	// 370
+	{ 371, "Class Engine.Path_AlongLine" },	// 371
+	{ 372, "Class Engine.Path_AvoidInEscapableNodes" },	// 372
+	{ 373, "Class Engine.Path_MinDistBetweenSpecsOfType" },	// 373
+	{ 374, "Class Engine.Path_TowardGoal" },	// 374
+	{ 375, "Class Engine.Path_TowardPoint" },	// 375
+	{ 376, "Class Engine.Path_WithinDistanceEnvelope" },	// 376
+	{ 377, "Class Engine.Path_WithinTraversalDist" },	// 377
+	{ 378, "Class Engine.PathGoalEvaluator" },	// 378
+	{ 379, "Class Engine.Goal_AtActor" },	// 379
+	{ 380, "Class Engine.Goal_Null" },	// 380
+	{ 381, "Class Engine.SkeletalMeshActor" },	// 381
+	{ 382, "Class Engine.SkeletalMeshActorBasedOnExtremeContent" },	// 382
+	{ 383, "Class Engine.SkeletalMeshActorSpawnable" },	// 383
+	{ 384, "Class Engine.SkeletalMeshCinematicActor" },	// 384
+	{ 385, "Class Engine.SkeletalMeshActorMAT" },	// 385
+	{ 386, "Class Engine.AnimationCompressionAlgorithm" },	// 386
+	{ 387, "Class Engine.AnimationCompressionAlgorithm_BitwiseCompressOnly" },	// 387
+	{ 388, "Class Engine.AnimationCompressionAlgorithm_RemoveEverySecondKey" },	// 388
+	{ 389, "Class Engine.AnimationCompressionAlgorithm_RemoveLinearKeys" },	// 389
+	{ 390, "Class Engine.AnimationCompressionAlgorithm_RemoveTrivialKeys" },	// 390
+	{ 391, "Class Engine.AnimationCompressionAlgorithm_RevertToRaw" },	// 391
+	{ 392, "Class Engine.AnimMetaData" },	// 392
+	{ 393, "Class Engine.AnimMetaData_SkelControl" },	// 393
+	{ 394, "Class Engine.AnimMetaData_SkelControlKeyFrame" },	// 394
+	{ 395, "Class Engine.AnimNotify" },	// 395
+	{ 396, "Class Engine.AnimNotify_CameraEffect" },	// 396
+	{ 397, "Class Engine.AnimNotify_Footstep" },	// 397
+	{ 398, "Class Engine.AnimNotify_Kismet" },	// 398
+	{ 399, "Class Engine.AnimNotify_PlayParticleEffect" },	// 399
+	{ 400, "Class Engine.AnimNotify_Rumble" },	// 400
+	{ 401, "Class Engine.AnimNotify_Script" },	// 401
+	{ 402, "Class Engine.AnimNotify_Scripted" },	// 402
+	{ 403, "Class Engine.AnimNotify_ViewShake" },	// 403
+	{ 404, "Class Engine.AnimNotify_Sound" },	// 404
+	{ 405, "Class Engine.AnimNotify_Trails" },	// 405
+	{ 406, "Class Engine.AnimObject" },	// 406
+	{ 407, "Class Engine.AnimNode" },	// 407
+	{ 408, "Class Engine.AnimNodeBlendBase" },	// 408
+	{ 409, "Class Engine.AnimNode_MultiBlendPerBone" },	// 409
+	{ 410, "Class Engine.AnimNodeAimOffset" },	// 410
+	{ 411, "Class Engine.AnimNodeBlend" },	// 411
+	{ 412, "Class Engine.AnimNodeAdditiveBlending" },	// 412
+	{ 413, "Class Engine.AnimNodeBlendPerBone" },	// 413
+	{ 414, "Class Engine.AnimNodeCrossfader" },	// 414
+	{ 415, "Class Engine.AnimNodePlayCustomAnim" },	// 415
+	{ 416, "Class Engine.AnimNodeBlendDirectional" },	// 416
+	{ 417, "Class Engine.AnimNodeBlendList" },	// 417
+	{ 418, "Class Engine.AnimNodeBlendByBase" },	// 418
+	{ 419, "Class Engine.AnimNodeBlendByPhysics" },	// 419
+	{ 420, "Class Engine.AnimNodeBlendByPosture" },	// 420
+	{ 421, "Class Engine.AnimNodeBlendByProperty" },	// 421
+	{ 422, "Class Engine.AnimNodeBlendBySpeed" },	// 422
+	{ 423, "Class Engine.AnimNodeRandom" },	// 423
+	{ 424, "Class Engine.AnimNodeBlendMultiBone" },	// 424
+	{ 425, "Class Engine.AnimNodeMirror" },	// 425
+	{ 426, "Class Engine.AnimNodeScalePlayRate" },	// 426
+	{ 427, "Class Engine.AnimNodeScaleRateBySpeed" },	// 427
+	{ 428, "Class Engine.AnimNodeSlot" },	// 428
+	{ 429, "Class Engine.AnimNodeSynch" },	// 429
+	{ 430, "Class Engine.AnimTree" },	// 430
+	{ 431, "Class Engine.AnimNodeSequence" },	// 431
+	{ 432, "Class Engine.AnimNodeSequenceBlendBase" },	// 432
+	{ 433, "Class Engine.AnimNodeSequenceBlendByAim" },	// 433
+	{ 434, "Class Engine.MorphNodeBase" },	// 434
+	{ 435, "Class Engine.MorphNodeMultiPose" },	// 435
+	{ 436, "Class Engine.MorphNodePose" },	// 436
+	{ 437, "Class Engine.MorphNodeWeightBase" },	// 437
+	{ 438, "Class Engine.MorphNodeWeight" },	// 438
+	{ 439, "Class Engine.MorphNodeWeightByBoneAngle" },	// 439
+	{ 440, "Class Engine.MorphNodeWeightByBoneRotation" },	// 440
+	{ 441, "Class Engine.SkelControlBase" },	// 441
+	{ 442, "Class Engine.SkelControl_CCD_IK" },	// 442
+	{ 443, "Class Engine.SkelControl_TwistBone" },	// 443
+	{ 444, "Class Engine.SkelControlLimb" },	// 444
+	{ 445, "Class Engine.SkelControlFootPlacement" },	// 445
+	{ 446, "Class Engine.SkelControlLookAt" },	// 446
+	{ 447, "Class Engine.SkelControlSingleBone" },	// 447
+	{ 448, "Class Engine.SkelControlHandlebars" },	// 448
+	{ 449, "Class Engine.SkelControlWheel" },	// 449
+	{ 450, "Class Engine.SkelControlSpline" },	// 450
+	{ 451, "Class Engine.SkelControlTrail" },	// 451
+	{ 452, "Class Engine.AnimSequence" },	// 452
+	{ 453, "Class Engine.AnimSet" },	// 453
+	{ 454, "Class Engine.BioDynamicAnimSet" },	// 454
+	{ 455, "Class Engine.BioAnimSetData" },	// 455
+	{ 456, "Class Engine.MorphTarget" },	// 456
+	{ 457, "Class Engine.MorphTargetSet" },	// 457
+	{ 458, "Class Engine.MorphWeightSequence" },	// 458
+	{ 459, "Class Engine.DecalActorBase" },	// 459
+	{ 460, "Class Engine.DecalActor" },	// 460
+	{ 461, "Class Engine.DecalActorMovable" },	// 461
+	{ 462, "Class Engine.DecalManager" },	// 462
+	{ 463, "Class Engine.DecalComponent" },	// 463
+	{ 464, "Class Engine.ActorFactoryDecal" },	// 464
+	{ 465, "Class Engine.DecalMaterial" },	// 465
+	{ 466, "Class Engine.FogVolumeDensityInfo" },	// 466
+	{ 467, "Class Engine.FogVolumeConeDensityInfo" },	// 467
+	{ 468, "Class Engine.FogVolumeConstantDensityInfo" },	// 468
+	{ 469, "Class Engine.FogVolumeLinearHalfspaceDensityInfo" },	// 469
+	{ 470, "Class Engine.FogVolumeSphericalDensityInfo" },	// 470
+	{ 471, "Class Engine.FogVolumeDensityComponent" },	// 471
+	{ 472, "Class Engine.FogVolumeConeDensityComponent" },	// 472
+	{ 473, "Class Engine.FogVolumeConstantDensityComponent" },	// 473
+	{ 474, "Class Engine.FogVolumeLinearHalfspaceDensityComponent" },	// 474
+	{ 475, "Class Engine.FogVolumeSphericalDensityComponent" },	// 475
+	{ 476, "Class Engine.ActorFactoryFogVolumeConstantDensityInfo" },	// 476
+	{ 477, "Class Engine.ActorFactoryFogVolumeLinearHalfspaceDensityInfo" },	// 477
+	{ 478, "Class Engine.ActorFactoryFogVolumeSphericalDensityInfo" },	// 478
+	{ 479, "Class Engine.ApexDestructibleActor" },	// 479
+	{ 480, "Class Engine.FracturedStaticMeshActor" },	// 480
+	{ 481, "Class Engine.FracturedStaticMeshPart" },	// 481
+	{ 482, "Class Engine.PhysXDestructibleActor" },	// 482
+	{ 483, "Class Engine.FractureManager" },	// 483
+	{ 484, "Class Engine.PhysXDestructiblePart" },	// 484
+	{ 485, "Class Engine.ApexComponentBase" },	// 485
+	{ 486, "Class Engine.ApexDynamicComponent" },	// 486
+	{ 487, "Class Engine.ApexStaticComponent" },	// 487
+	{ 488, "Class Engine.ApexStaticDestructibleComponent" },	// 488
+	{ 489, "Class Engine.FracturedBaseComponent" },	// 489
+	{ 490, "Class Engine.FracturedSkinnedMeshComponent" },	// 490
+	{ 491, "Class Engine.FracturedStaticMeshComponent" },	// 491
+	{ 492, "Class Engine.InstancedStaticMeshComponent" },	// 492
+	{ 493, "Class Engine.SplineMeshComponent" },	// 493
+	{ 494, "Class Engine.PhysXDestructibleComponent" },	// 494
+	{ 495, "Class Engine.ApexAsset" },	// 495
+	{ 496, "Class Engine.ApexClothingAsset" },	// 496
+	{ 497, "Class Engine.ApexDestructibleAsset" },	// 497
+	{ 498, "Class Engine.ApexGenericAsset" },	// 498
+	{ 499, "Class Engine.PhysXDestructible" },	// 499
+	{ 500, "Class Engine.PhysXDestructibleAsset" },	// 500
+	{ 501, "Class Engine.PhysXDestructibleStructure" },	// 501
+	{ 502, "Class Engine.InterpFilter" },	// 502
+	{ 503, "Class Engine.InterpFilter_Classes" },	// 503
+	{ 504, "Class Engine.InterpFilter_Custom" },	// 504
+	{ 505, "Class Engine.InterpGroup" },	// 505
+	{ 506, "Class Engine.InterpGroupAI" },	// 506
+	{ 507, "Class Engine.InterpGroupDirector" },	// 507
+	{ 508, "Class Engine.SFXSceneGroup" },	// 508
+	{ 509, "Class Engine.InterpGroupInst" },	// 509
+	{ 510, "Class Engine.InterpGroupInstAI" },	// 510
+	{ 511, "Class Engine.InterpGroupInstDirector" },	// 511
+	{ 512, "Class Engine.BioInterpTrack" },	// 512
+	{ 513, "Class Engine.InterpTrackDirector" },	// 513
+	{ 514, "Class Engine.InterpTrackEvent" },	// 514
+	{ 515, "Class Engine.InterpTrackFaceFX" },	// 515
+	{ 516, "Class Engine.InterpTrackFloatBase" },	// 516
+	{ 517, "Class Engine.InterpTrackAnimControl" },	// 517
+	{ 518, "Class Engine.InterpTrackFade" },	// 518
+	{ 519, "Class Engine.InterpTrackFloatMaterialParam" },	// 519
+	{ 520, "Class Engine.InterpTrackFloatParticleParam" },	// 520
+	{ 521, "Class Engine.InterpTrackFloatProp" },	// 521
+	{ 522, "Class Engine.InterpTrackMorphWeight" },	// 522
+	{ 523, "Class Engine.InterpTrackSkelControlScale" },	// 523
+	{ 524, "Class Engine.InterpTrackSlomo" },	// 524
+	{ 525, "Class Engine.InterpTrackLinearColorBase" },	// 525
+	{ 526, "Class Engine.InterpTrackLinearColorProp" },	// 526
+	{ 527, "Class Engine.InterpTrackMove" },	// 527
+	{ 528, "Class Engine.InterpTrackParticleReplay" },	// 528
+	{ 529, "Class Engine.InterpTrackToggle" },	// 529
+	{ 530, "Class Engine.InterpTrackVectorBase" },	// 530
+	{ 531, "Class Engine.InterpTrackAudioMaster" },	// 531
+	{ 532, "Class Engine.InterpTrackColorProp" },	// 532
+	{ 533, "Class Engine.InterpTrackColorScale" },	// 533
+	{ 534, "Class Engine.InterpTrackSound" },	// 534
+	{ 535, "Class Engine.InterpTrackVectorMaterialParam" },	// 535
+	{ 536, "Class Engine.InterpTrackVectorProp" },	// 536
+	{ 537, "Class Engine.InterpTrackVisibility" },	// 537
+	{ 538, "Class Engine.InterpTrackInst" },	// 538
+	{ 539, "Class Engine.BioInterpTrackInst" },	// 539
+	{ 540, "Class Engine.InterpTrackInstAnimControl" },	// 540
+	{ 541, "Class Engine.InterpTrackInstAudioMaster" },	// 541
+	{ 542, "Class Engine.InterpTrackInstColorScale" },	// 542
+	{ 543, "Class Engine.InterpTrackInstDirector" },	// 543
+	{ 544, "Class Engine.InterpTrackInstEvent" },	// 544
+	{ 545, "Class Engine.InterpTrackInstFaceFX" },	// 545
+	{ 546, "Class Engine.InterpTrackInstFade" },	// 546
+	{ 547, "Class Engine.InterpTrackInstFloatMaterialParam" },	// 547
+	{ 548, "Class Engine.InterpTrackInstFloatParticleParam" },	// 548
+	{ 549, "Class Engine.InterpTrackInstMorphWeight" },	// 549
+	{ 550, "Class Engine.InterpTrackInstMove" },	// 550
+	{ 551, "Class Engine.InterpTrackInstParticleReplay" },	// 551
+	{ 552, "Class Engine.InterpTrackInstProperty" },	// 552
+	{ 553, "Class Engine.InterpTrackInstColorProp" },	// 553
+	{ 554, "Class Engine.InterpTrackInstFloatProp" },	// 554
+	{ 555, "Class Engine.InterpTrackInstLinearColorProp" },	// 555
+	{ 556, "Class Engine.InterpTrackInstVectorProp" },	// 556
+	{ 557, "Class Engine.InterpTrackInstSkelControlScale" },	// 557
+	{ 558, "Class Engine.InterpTrackInstSlomo" },	// 558
+	{ 559, "Class Engine.InterpTrackInstSound" },	// 559
+	{ 560, "Class Engine.InterpTrackInstToggle" },	// 560
+	{ 561, "Class Engine.InterpTrackInstVectorMaterialParam" },	// 561
+	{ 562, "Class Engine.InterpTrackInstVisibility" },	// 562
+	{ 563, "Class Engine.SFXInterpAuditionHelperInterface" },	// 563
+	{ 564, "Class Engine.SFXSceneShopDataInstInterface" },	// 564
+	{ 565, "Class Engine.SFXSceneShopEditorDataInst" },	// 565
+	{ 566, "Class Engine.SFXSceneShopGameDataInst" },	// 566
+	{ 567, "Class Engine.SFXSceneShopGameData" },	// 567
+	{ 568, "Class Engine.SFXSceneShopNode" },	// 568
+	{ 569, "Class Engine.BioMaterialExpressionEffectMatBaseProperty" },	// 569
+	{ 570, "Class Engine.MaterialExpressionAbs" },	// 570
+	{ 571, "Class Engine.MaterialExpressionAdd" },	// 571
+	{ 572, "Class Engine.MaterialExpressionAppendVector" },	// 572
+	{ 573, "Class Engine.MaterialExpressionBumpOffset" },	// 573
+	{ 574, "Class Engine.MaterialExpressionCameraVector" },	// 574
+	{ 575, "Class Engine.MaterialExpressionCameraWorldPosition" },	// 575
+	{ 576, "Class Engine.MaterialExpressionCeil" },	// 576
+	{ 577, "Class Engine.MaterialExpressionClamp" },	// 577
+	{ 578, "Class Engine.MaterialExpressionComment" },	// 578
+	{ 579, "Class Engine.MaterialExpressionComponentMask" },	// 579
+	{ 580, "Class Engine.MaterialExpressionCompound" },	// 580
+	{ 581, "Class Engine.MaterialExpressionConstant" },	// 581
+	{ 582, "Class Engine.MaterialExpressionConstant2Vector" },	// 582
+	{ 583, "Class Engine.MaterialExpressionConstant3Vector" },	// 583
+	{ 584, "Class Engine.MaterialExpressionConstant4Vector" },	// 584
+	{ 585, "Class Engine.MaterialExpressionConstantBiasScale" },	// 585
+	{ 586, "Class Engine.MaterialExpressionConstantClamp" },	// 586
+	{ 587, "Class Engine.MaterialExpressionCosine" },	// 587
+	{ 588, "Class Engine.MaterialExpressionCrossProduct" },	// 588
+	{ 589, "Class Engine.MaterialExpressionCustom" },	// 589
+	{ 590, "Class Engine.MaterialExpressionCustomTexture" },	// 590
+	{ 591, "Class Engine.MaterialExpressionDepthBiasedAlpha" },	// 591
+	{ 592, "Class Engine.MaterialExpressionDepthBiasedBlend" },	// 592
+	{ 593, "Class Engine.MaterialExpressionDeriveNormalZ" },	// 593
+	{ 594, "Class Engine.MaterialExpressionDesaturation" },	// 594
+	{ 595, "Class Engine.MaterialExpressionDestColor" },	// 595
+	{ 596, "Class Engine.MaterialExpressionDestDepth" },	// 596
+	{ 597, "Class Engine.MaterialExpressionDistance" },	// 597
+	{ 598, "Class Engine.MaterialExpressionDivide" },	// 598
+	{ 599, "Class Engine.MaterialExpressionDotProduct" },	// 599
+	{ 600, "Class Engine.MaterialExpressionDynamicParameter" },	// 600
+	{ 601, "Class Engine.MaterialExpressionMeshEmitterDynamicParameter" },	// 601
+	{ 602, "Class Engine.MaterialExpressionFloor" },	// 602
+	{ 603, "Class Engine.MaterialExpressionFluidNormal" },	// 603
+	{ 604, "Class Engine.MaterialExpressionFmod" },	// 604
+	{ 605, "Class Engine.MaterialExpressionFoliageImpulseDirection" },	// 605
+	{ 606, "Class Engine.MaterialExpressionFoliageNormalizedRotationAxisAndAngle" },	// 606
+	{ 607, "Class Engine.MaterialExpressionFontSample" },	// 607
+	{ 608, "Class Engine.MaterialExpressionFontSampleParameter" },	// 608
+	{ 609, "Class Engine.MaterialExpressionFrac" },	// 609
+	{ 610, "Class Engine.MaterialExpressionFresnel" },	// 610
+	{ 611, "Class Engine.MaterialExpressionIf" },	// 611
+	{ 612, "Class Engine.MaterialExpressionLensFlareIntensity" },	// 612
+	{ 613, "Class Engine.MaterialExpressionLensFlareOcclusion" },	// 613
+	{ 614, "Class Engine.MaterialExpressionLensFlareRadialDistance" },	// 614
+	{ 615, "Class Engine.MaterialExpressionLensFlareRayDistance" },	// 615
+	{ 616, "Class Engine.MaterialExpressionLensFlareSourceDistance" },	// 616
+	{ 617, "Class Engine.MaterialExpressionLightmapUVs" },	// 617
+	{ 618, "Class Engine.MaterialExpressionLightmassReplace" },	// 618
+	{ 619, "Class Engine.MaterialExpressionLightVector" },	// 619
+	{ 620, "Class Engine.MaterialExpressionLinearInterpolate" },	// 620
+	{ 621, "Class Engine.MaterialExpressionMeshEmitterVertexColor" },	// 621
+	{ 622, "Class Engine.MaterialExpressionMultiply" },	// 622
+	{ 623, "Class Engine.MaterialExpressionNormalize" },	// 623
+	{ 624, "Class Engine.MaterialExpressionObjectOrientation" },	// 624
+	{ 625, "Class Engine.MaterialExpressionObjectRadius" },	// 625
+	{ 626, "Class Engine.MaterialExpressionObjectWorldPosition" },	// 626
+	{ 627, "Class Engine.MaterialExpressionOcclusionPercentage" },	// 627
+	{ 628, "Class Engine.MaterialExpressionOneMinus" },	// 628
+	{ 629, "Class Engine.MaterialExpressionPanner" },	// 629
+	{ 630, "Class Engine.MaterialExpressionParameter" },	// 630
+	{ 631, "Class Engine.MaterialExpressionScalarParameter" },	// 631
+	{ 632, "Class Engine.BioMaterialExpressionEffectMatFractionEnabled" },	// 632
+	{ 633, "Class Engine.MaterialExpressionStaticComponentMaskParameter" },	// 633
+	{ 634, "Class Engine.MaterialExpressionStaticSwitchParameter" },	// 634
+	{ 635, "Class Engine.MaterialExpressionVectorParameter" },	// 635
+	{ 636, "Class Engine.MaterialExpressionParticleMacroUV" },	// 636
+	{ 637, "Class Engine.MaterialExpressionPerInstanceRandom" },	// 637
+	{ 638, "Class Engine.MaterialExpressionPixelDepth" },	// 638
+	{ 639, "Class Engine.MaterialExpressionPower" },	// 639
+	{ 640, "Class Engine.MaterialExpressionReflectionVector" },	// 640
+	{ 641, "Class Engine.MaterialExpressionRotateAboutAxis" },	// 641
+	{ 642, "Class Engine.MaterialExpressionRotator" },	// 642
+	{ 643, "Class Engine.MaterialExpressionSceneDepth" },	// 643
+	{ 644, "Class Engine.MaterialExpressionSceneTexture" },	// 644
+	{ 645, "Class Engine.MaterialExpressionScreenPosition" },	// 645
+	{ 646, "Class Engine.MaterialExpressionSine" },	// 646
+	{ 647, "Class Engine.MaterialExpressionSphereMask" },	// 647
+	{ 648, "Class Engine.MaterialExpressionSquareRoot" },	// 648
+	{ 649, "Class Engine.MaterialExpressionSubtract" },	// 649
+	{ 650, "Class Engine.MaterialExpressionTextureCoordinate" },	// 650
+	{ 651, "Class Engine.MaterialExpressionTextureSample" },	// 651
+	{ 652, "Class Engine.MaterialExpressionDepthBiasBlend" },	// 652
+	{ 653, "Class Engine.MaterialExpressionFlipBookSample" },	// 653
+	{ 654, "Class Engine.MaterialExpressionMeshSubUV" },	// 654
+	{ 655, "Class Engine.MaterialExpressionMeshSubUVBlend" },	// 655
+	{ 656, "Class Engine.MaterialExpressionParticleSubUV" },	// 656
+	{ 657, "Class Engine.MaterialExpressionTextureSampleParameter" },	// 657
+	{ 658, "Class Engine.MaterialExpressionTextureSampleParameter2D" },	// 658
+	{ 659, "Class Engine.MaterialExpressionAntialiasedTextureMask" },	// 659
+	{ 660, "Class Engine.MaterialExpressionTextureSampleParameterMeshSubUV" },	// 660
+	{ 661, "Class Engine.MaterialExpressionTextureSampleParameterMeshSubUVBlend" },	// 661
+	{ 662, "Class Engine.MaterialExpressionTextureSampleParameterSubUV" },	// 662
+	{ 663, "Class Engine.MaterialExpressionTextureSampleParameterCube" },	// 663
+	{ 664, "Class Engine.MaterialExpressionTextureSampleParameterMovie" },	// 664
+	{ 665, "Class Engine.MaterialExpressionTextureSampleParameterNormal" },	// 665
+	{ 666, "Class Engine.MaterialExpressionTime" },	// 666
+	{ 667, "Class Engine.MaterialExpressionTransform" },	// 667
+	{ 668, "Class Engine.MaterialExpressionTransformPosition" },	// 668
+	{ 669, "Class Engine.MaterialExpressionTwoSidedSign" },	// 669
+	{ 670, "Class Engine.MaterialExpressionVertexColor" },	// 670
+	{ 671, "Class Engine.MaterialExpressionWindDirectionAndSpeed" },	// 671
+	{ 672, "Class Engine.MaterialExpressionWorldNormal" },	// 672
+	{ 673, "Class Engine.MaterialExpressionWorldPosition" },	// 673
+	{ 674, "Class Engine.MaterialInstance" },	// 674
+	{ 675, "Class Engine.MaterialInstanceConstant" },	// 675
+	{ 676, "Class Engine.BioMaterialInstanceConstant" },	// 676
+	{ 677, "Class Engine.MaterialInstanceTimeVarying" },	// 677
+	{ 678, "Class Engine.EmitterCameraLensEffectBase" },	// 678
+	{ 679, "Class Engine.PhysXEmitterSpawnable" },	// 679
+	{ 680, "Class Engine.ParticleEventManager" },	// 680
+	{ 681, "Class Engine.ParticleSystemComponent" },	// 681
+	{ 682, "Class Engine.DistributionFloatParticleParameter" },	// 682
+	{ 683, "Class Engine.DistributionVectorParticleParameter" },	// 683
+	{ 684, "Class Engine.ParticleEmitter" },	// 684
+	{ 685, "Class Engine.ParticleSpriteEmitter" },	// 685
+	{ 686, "Class Engine.ParticleLODLevel" },	// 686
+	{ 687, "Class Engine.ParticleModule" },	// 687
+	{ 688, "Class Engine.ParticleModuleAccelerationBase" },	// 688
+	{ 689, "Class Engine.ParticleModuleAcceleration" },	// 689
+	{ 690, "Class Engine.ParticleModuleAccelerationOverLifetime" },	// 690
+	{ 691, "Class Engine.ParticleModuleAttractorBase" },	// 691
+	{ 692, "Class Engine.ParticleModuleAttractorLine" },	// 692
+	{ 693, "Class Engine.ParticleModuleAttractorParticle" },	// 693
+	{ 694, "Class Engine.ParticleModuleAttractorPoint" },	// 694
+	{ 695, "Class Engine.ParticleModuleBeamBase" },	// 695
+	{ 696, "Class Engine.ParticleModuleBeamModifier" },	// 696
+	{ 697, "Class Engine.ParticleModuleBeamNoise" },	// 697
+	{ 698, "Class Engine.ParticleModuleBeamSource" },	// 698
+	{ 699, "Class Engine.ParticleModuleBeamTarget" },	// 699
+	{ 700, "Class Engine.ParticleModuleCollisionBase" },	// 700
+	{ 701, "Class Engine.ParticleModuleCollision" },	// 701
+	{ 702, "Class Engine.ParticleModuleColorBase" },	// 702
+	{ 703, "Class Engine.ParticleModuleColor" },	// 703
+	{ 704, "Class Engine.ParticleModuleColorByParameter" },	// 704
+	{ 705, "Class Engine.ParticleModuleColorOverLife" },	// 705
+	{ 706, "Class Engine.ParticleModuleColorScaleOverLife" },	// 706
+	{ 707, "Class Engine.ParticleModuleEventBase" },	// 707
+	{ 708, "Class Engine.ParticleModuleEventGenerator" },	// 708
+	{ 709, "Class Engine.ParticleModuleEventReceiverBase" },	// 709
+	{ 710, "Class Engine.ParticleModuleEventReceiverKillParticles" },	// 710
+	{ 711, "Class Engine.ParticleModuleEventReceiverSpawn" },	// 711
+	{ 712, "Class Engine.ParticleModuleKillBase" },	// 712
+	{ 713, "Class Engine.ParticleModuleKillBox" },	// 713
+	{ 714, "Class Engine.ParticleModuleKillHeight" },	// 714
+	{ 715, "Class Engine.ParticleModuleLifetimeBase" },	// 715
+	{ 716, "Class Engine.ParticleModuleLifetime" },	// 716
+	{ 717, "Class Engine.ParticleModuleLocationBase" },	// 717
+	{ 718, "Class Engine.ParticleModuleLocation" },	// 718
+	{ 719, "Class Engine.ParticleModuleLocationDirect" },	// 719
+	{ 720, "Class Engine.ParticleModuleLocationEmitter" },	// 720
+	{ 721, "Class Engine.ParticleModuleLocationEmitterDirect" },	// 721
+	{ 722, "Class Engine.ParticleModuleLocationPrimitiveBase" },	// 722
+	{ 723, "Class Engine.ParticleModuleLocationPrimitiveCylinder" },	// 723
+	{ 724, "Class Engine.ParticleModuleLocationPrimitiveSphere" },	// 724
+	{ 725, "Class Engine.ParticleModuleSourceMovement" },	// 725
+	{ 726, "Class Engine.ParticleModuleMaterialBase" },	// 726
+	{ 727, "Class Engine.ParticleModuleMaterialByParameter" },	// 727
+	{ 728, "Class Engine.ParticleModuleMeshMaterial" },	// 728
+	{ 729, "Class Engine.ParticleModuleOrbitBase" },	// 729
+	{ 730, "Class Engine.ParticleModuleOrbit" },	// 730
+	{ 731, "Class Engine.ParticleModuleOrientationBase" },	// 731
+	{ 732, "Class Engine.ParticleModuleOrientationAxisLock" },	// 732
+	{ 733, "Class Engine.ParticleModuleParameterBase" },	// 733
+	{ 734, "Class Engine.ParticleModuleParameterDynamic" },	// 734
+	{ 735, "Class Engine.ParticleModuleRequired" },	// 735
+	{ 736, "Class Engine.ParticleModuleRotationBase" },	// 736
+	{ 737, "Class Engine.ParticleModuleMeshRotation" },	// 737
+	{ 738, "Class Engine.ParticleModuleRotation" },	// 738
+	{ 739, "Class Engine.ParticleModuleRotationOverLifetime" },	// 739
+	{ 740, "Class Engine.ParticleModuleRotationRateBase" },	// 740
+	{ 741, "Class Engine.ParticleModuleMeshRotationRate" },	// 741
+	{ 742, "Class Engine.ParticleModuleMeshRotationRateMultiplyLife" },	// 742
+	{ 743, "Class Engine.ParticleModuleRotationRate" },	// 743
+	{ 744, "Class Engine.ParticleModuleRotationRateMultiplyLife" },	// 744
+	{ 745, "Class Engine.ParticleModuleSizeBase" },	// 745
+	{ 746, "Class Engine.ParticleModuleSize" },	// 746
+	{ 747, "Class Engine.ParticleModuleSizeMultiplyLife" },	// 747
+	{ 748, "Class Engine.ParticleModuleSizeMultiplyVelocity" },	// 748
+	{ 749, "Class Engine.ParticleModuleSizeScale" },	// 749
+	{ 750, "Class Engine.ParticleModuleSizeScaleByTime" },	// 750
+	{ 751, "Class Engine.ParticleModuleSpawnBase" },	// 751
+	{ 752, "Class Engine.ParticleModuleSpawn" },	// 752
+	{ 753, "Class Engine.ParticleModuleSpawnPerUnit" },	// 753
+	{ 754, "Class Engine.ParticleModuleStoreSpawnTimeBase" },	// 754
+	{ 755, "Class Engine.ParticleModuleStoreSpawnTime" },	// 755
+	{ 756, "Class Engine.ParticleModuleSubUVBase" },	// 756
+	{ 757, "Class Engine.ParticleModuleSubUV" },	// 757
+	{ 758, "Class Engine.ParticleModuleSubUVMovie" },	// 758
+	{ 759, "Class Engine.ParticleModuleSubUVDirect" },	// 759
+	{ 760, "Class Engine.ParticleModuleSubUVSelect" },	// 760
+	{ 761, "Class Engine.ParticleModuleTrailBase" },	// 761
+	{ 762, "Class Engine.ParticleModuleTrailSource" },	// 762
+	{ 763, "Class Engine.ParticleModuleTrailSpawn" },	// 763
+	{ 764, "Class Engine.ParticleModuleTrailTaper" },	// 764
+	{ 765, "Class Engine.ParticleModuleTypeDataBase" },	// 765
+	{ 766, "Class Engine.ParticleModuleTypeDataAnimTrail" },	// 766
+	{ 767, "Class Engine.ParticleModuleTypeDataBeam" },	// 767
+	{ 768, "Class Engine.ParticleModuleTypeDataBeam2" },	// 768
+	{ 769, "Class Engine.ParticleModuleTypeDataMesh" },	// 769
+	{ 770, "Class Engine.ParticleModuleTypeDataMeshPhysX" },	// 770
+	{ 771, "Class Engine.ParticleModuleTypeDataPhysX" },	// 771
+	{ 772, "Class Engine.ParticleModuleTypeDataRibbon" },	// 772
+	{ 773, "Class Engine.ParticleModuleTypeDataTrail" },	// 773
+	{ 774, "Class Engine.ParticleModuleTypeDataTrail2" },	// 774
+	{ 775, "Class Engine.ParticleModuleUberBase" },	// 775
+	{ 776, "Class Engine.ParticleModuleUberLTISIVCL" },	// 776
+	{ 777, "Class Engine.ParticleModuleUberLTISIVCLIL" },	// 777
+	{ 778, "Class Engine.ParticleModuleUberLTISIVCLILIRSSBLIRR" },	// 778
+	{ 779, "Class Engine.ParticleModuleUberRainDrops" },	// 779
+	{ 780, "Class Engine.ParticleModuleUberRainImpacts" },	// 780
+	{ 781, "Class Engine.ParticleModuleUberRainSplashA" },	// 781
+	{ 782, "Class Engine.ParticleModuleUberRainSplashB" },	// 782
+	{ 783, "Class Engine.ParticleModuleVelocityBase" },	// 783
+	{ 784, "Class Engine.ParticleModuleVelocity" },	// 784
+	{ 785, "Class Engine.ParticleModuleVelocityInheritParent" },	// 785
+	{ 786, "Class Engine.ParticleModuleVelocityOverLifetime" },	// 786
+	{ 787, "Class Engine.ParticleModuleEventSendToGame" },	// 787
+	{ 788, "Class Engine.ParticleSystemReplay" },	// 788
+	{ 789, "Class Engine.PhysXParticleSystem" },	// 789
+	{ 790, "Class Engine.KActor" },	// 790
+	{ 791, "Class Engine.KActorFromStatic" },	// 791
+	{ 792, "Class Engine.KActorSpawnable" },	// 792
+	{ 793, "Class Engine.KAsset" },	// 793
+	{ 794, "Class Engine.Pawn" },	// 794
+	{ 795, "Class Engine.Vehicle" },	// 795
+	{ 796, "Class Engine.SVehicle" },	// 796
+	{ 797, "Class Engine.RB_ConstraintActor" },	// 797
+	{ 798, "Class Engine.RB_LineImpulseActor" },	// 798
+	{ 799, "Class Engine.RB_RadialImpulseActor" },	// 799
+	{ 800, "Class Engine.RB_Thruster" },	// 800
+	{ 801, "Class Engine.RB_ConstraintDrawComponent" },	// 801
+	{ 802, "Class Engine.RB_RadialImpulseComponent" },	// 802
+	{ 803, "Class Engine.RB_Handle" },	// 803
+	{ 804, "Class Engine.RB_Spring" },	// 804
+	{ 805, "Class Engine.SVehicleSimBase" },	// 805
+	{ 806, "Class Engine.SVehicleSimCar" },	// 806
+	{ 807, "Class Engine.SVehicleSimTank" },	// 807
+	{ 808, "Class Engine.PhysicalMaterial" },	// 808
+	{ 809, "Class Engine.PhysicalMaterialPropertyBase" },	// 809
+	{ 810, "Class Engine.PhysicsAsset" },	// 810
+	{ 811, "Class Engine.PhysicsAssetInstance" },	// 811
+	{ 812, "Class Engine.PhysicsLODVerticalDestructible" },	// 812
+	{ 813, "Class Engine.PhysicsLODVerticalEmitter" },	// 813
+	{ 814, "Class Engine.RB_BodyInstance" },	// 814
+	{ 815, "Class Engine.RB_ConstraintInstance" },	// 815
+	{ 816, "Class Engine.RB_ConstraintSetup" },	// 816
+	{ 817, "Class Engine.RB_BSJointSetup" },	// 817
+	{ 818, "Class Engine.RB_DistanceJointSetup" },	// 818
+	{ 819, "Class Engine.RB_HingeSetup" },	// 819
+	{ 820, "Class Engine.RB_PrismaticSetup" },	// 820
+	{ 821, "Class Engine.RB_PulleyJointSetup" },	// 821
+	{ 822, "Class Engine.RB_SkelJointSetup" },	// 822
+	{ 823, "Class Engine.RB_StayUprightSetup" },	// 823
+	{ 824, "Class Engine.SVehicleWheel" },	// 824
+	{ 825, "Class Engine.NxGenericForceFieldBrush" },	// 825
+	{ 826, "Class Engine.RB_ForceFieldExcludeVolume" },	// 826
+	{ 827, "Class Engine.NxForceField" },	// 827
+	{ 828, "Class Engine.NxCylindricalForceField" },	// 828
+	{ 829, "Class Engine.NxCylindricalForceFieldCapsule" },	// 829
+	{ 830, "Class Engine.NxForceFieldGeneric" },	// 830
+	{ 831, "Class Engine.NxForceFieldRadial" },	// 831
+	{ 832, "Class Engine.NxForceFieldTornado" },	// 832
+	{ 833, "Class Engine.NxGenericForceField" },	// 833
+	{ 834, "Class Engine.NxGenericForceFieldBox" },	// 834
+	{ 835, "Class Engine.NxGenericForceFieldCapsule" },	// 835
+	{ 836, "Class Engine.NxRadialForceField" },	// 836
+	{ 837, "Class Engine.NxRadialCustomForceField" },	// 837
+	{ 838, "Class Engine.NxTornadoAngularForceField" },	// 838
+	{ 839, "Class Engine.NxTornadoAngularForceFieldCapsule" },	// 839
+	{ 840, "Class Engine.NxTornadoForceField" },	// 840
+	{ 841, "Class Engine.NxTornadoForceFieldCapsule" },	// 841
+	{ 842, "Class Engine.RB_CylindricalForceActor" },	// 842
+	{ 843, "Class Engine.RB_RadialForceActor" },	// 843
+	{ 844, "Class Engine.ForceFieldShape" },	// 844
+	{ 845, "Class Engine.ForceFieldShapeBox" },	// 845
+	{ 846, "Class Engine.ForceFieldShapeCapsule" },	// 846
+	{ 847, "Class Engine.ForceFieldShapeSphere" },	// 847
+	{ 848, "Class Engine.PrefabInstance" },	// 848
+	{ 849, "Class Engine.Prefab" },	// 849
+	{ 850, "Class Engine.SequenceObject" },	// 850
+	{ 851, "Class Engine.SequenceFrame" },	// 851
+	{ 852, "Class Engine.SequenceFrameWrapped" },	// 852
+	{ 853, "Class Engine.SequenceOp" },	// 853
+	{ 854, "Class Engine.Sequence" },	// 854
+	{ 855, "Class Engine.PrefabSequence" },	// 855
+	{ 856, "Class Engine.PrefabSequenceContainer" },	// 856
+	{ 857, "Class Engine.SequenceReference" },	// 857
+	{ 858, "Class Engine.SequenceAction" },	// 858
+	{ 859, "Class Engine.SeqAct_ActivateRemoteEvent" },	// 859
+	{ 860, "Class Engine.SeqAct_AndGate" },	// 860
+	{ 861, "Class Engine.SeqAct_ApplySoundNode" },	// 861
+	{ 862, "Class Engine.SeqAct_AttachToEvent" },	// 862
+	{ 863, "Class Engine.SeqAct_CameraFade" },	// 863
+	{ 864, "Class Engine.SeqAct_CameraLookAt" },	// 864
+	{ 865, "Class Engine.SeqAct_CameraShake" },	// 865
+	{ 866, "Class Engine.SeqAct_ChangeCollision" },	// 866
+	{ 867, "Class Engine.SeqAct_CommitMapChange" },	// 867
+	{ 868, "Class Engine.SeqAct_ConvertToString" },	// 868
+	{ 869, "Class Engine.SeqAct_DrawText" },	// 869
+	{ 870, "Class Engine.SeqAct_FinishSequence" },	// 870
+	{ 871, "Class Engine.SeqAct_Gate" },	// 871
+	{ 872, "Class Engine.SeqAct_GetDistance" },	// 872
+	{ 873, "Class Engine.SeqAct_GetLocationAndRotation" },	// 873
+	{ 874, "Class Engine.SeqAct_GetProperty" },	// 874
+	{ 875, "Class Engine.SeqAct_GetVectorComponents" },	// 875
+	{ 876, "Class Engine.SeqAct_GetVelocity" },	// 876
+	{ 877, "Class Engine.SeqAct_IsInObjectList" },	// 877
+	{ 878, "Class Engine.SeqAct_Latent" },	// 878
+	{ 879, "Class Engine.SeqAct_ActorFactory" },	// 879
+	{ 880, "Class Engine.SeqAct_ActorFactoryEx" },	// 880
+	{ 881, "Class Engine.SeqAct_AIMoveToActor" },	// 881
+	{ 882, "Class Engine.SeqAct_Delay" },	// 882
+	{ 883, "Class Engine.SeqAct_DelaySwitch" },	// 883
+	{ 884, "Class Engine.SeqAct_ForceGarbageCollection" },	// 884
+	{ 885, "Class Engine.SeqAct_Interp" },	// 885
+	{ 886, "Class Engine.SeqAct_LevelStreamingBase" },	// 886
+	{ 887, "Class Engine.SeqAct_LevelStreaming" },	// 887
+	{ 888, "Class Engine.SeqAct_MultiLevelStreaming" },	// 888
+	{ 889, "Class Engine.SeqAct_LevelVisibility" },	// 889
+	{ 890, "Class Engine.SeqAct_PlaySound" },	// 890
+	{ 891, "Class Engine.SeqAct_PrepareMapChange" },	// 891
+	{ 892, "Class Engine.SeqAct_SetDOFParams" },	// 892
+	{ 893, "Class Engine.SeqAct_SetMotionBlurParams" },	// 893
+	{ 894, "Class Engine.SeqAct_StreamInTextures" },	// 894
+	{ 895, "Class Engine.SeqAct_WaitForLevelsVisible" },	// 895
+	{ 896, "Class Engine.SeqAct_Log" },	// 896
+	{ 897, "Class Engine.SeqAct_ModifyCover" },	// 897
+	{ 898, "Class Engine.SeqAct_ModifyHealth" },	// 898
+	{ 899, "Class Engine.SeqAct_ParticleEventGenerator" },	// 899
+	{ 900, "Class Engine.SeqAct_PlayCameraAnim" },	// 900
+	{ 901, "Class Engine.SeqAct_PlayFaceFXAnim" },	// 901
+	{ 902, "Class Engine.SeqAct_PlayMusicTrack" },	// 902
+	{ 903, "Class Engine.SeqAct_Possess" },	// 903
+	{ 904, "Class Engine.SeqAct_RangeSwitch" },	// 904
+	{ 905, "Class Engine.SeqAct_SetBlockRigidBody" },	// 905
+	{ 906, "Class Engine.SeqAct_SetCameraTarget" },	// 906
+	{ 907, "Class Engine.SeqAct_SetMaterial" },	// 907
+	{ 908, "Class Engine.SeqAct_SetMatInstScalarParam" },	// 908
+	{ 909, "Class Engine.SeqAct_SetMesh" },	// 909
+	{ 910, "Class Engine.SeqAct_SetPhysics" },	// 910
+	{ 911, "Class Engine.SeqAct_SetRigidBodyIgnoreVehicles" },	// 911
+	{ 912, "Class Engine.SeqAct_SetSequenceVariable" },	// 912
+	{ 913, "Class Engine.SeqAct_AccessObjectList" },	// 913
+	{ 914, "Class Engine.SeqAct_AddFloat" },	// 914
+	{ 915, "Class Engine.SeqAct_AddInt" },	// 915
+	{ 916, "Class Engine.SeqAct_CastToFloat" },	// 916
+	{ 917, "Class Engine.SeqAct_CastToInt" },	// 917
+	{ 918, "Class Engine.SeqAct_DivideFloat" },	// 918
+	{ 919, "Class Engine.SeqAct_DivideInt" },	// 919
+	{ 920, "Class Engine.SeqAct_ModifyObjectList" },	// 920
+	{ 921, "Class Engine.SeqAct_MultiplyFloat" },	// 921
+	{ 922, "Class Engine.SeqAct_MultiplyInt" },	// 922
+	{ 923, "Class Engine.SeqAct_SetBool" },	// 923
+	{ 924, "Class Engine.SeqAct_SetFloat" },	// 924
+	{ 925, "Class Engine.SeqAct_SetInt" },	// 925
+	{ 926, "Class Engine.SeqAct_SetLocation" },	// 926
+	{ 927, "Class Engine.SeqAct_SetObject" },	// 927
+	{ 928, "Class Engine.SeqAct_SetString" },	// 928
+	{ 929, "Class Engine.SeqAct_SubtractFloat" },	// 929
+	{ 930, "Class Engine.SeqAct_SubtractInt" },	// 930
+	{ 931, "Class Engine.SeqAct_SetVectorComponents" },	// 931
+	{ 932, "Class Engine.SeqAct_Switch" },	// 932
+	{ 933, "Class Engine.SeqAct_RandomSwitch" },	// 933
+	{ 934, "Class Engine.SeqAct_Teleport" },	// 934
+	{ 935, "Class Engine.SeqAct_Timer" },	// 935
+	{ 936, "Class Engine.SeqAct_Toggle" },	// 936
+	{ 937, "Class Engine.SeqAct_ToggleHUD" },	// 937
+	{ 938, "Class Engine.SeqAct_Trace" },	// 938
+	{ 939, "Class Engine.SequenceCondition" },	// 939
+	{ 940, "Class Engine.SeqCond_CompareBool" },	// 940
+	{ 941, "Class Engine.SeqCond_CompareFloat" },	// 941
+	{ 942, "Class Engine.SeqCond_CompareInt" },	// 942
+	{ 943, "Class Engine.SeqCond_CompareName" },	// 943
+	{ 944, "Class Engine.SeqCond_CompareObject" },	// 944
+	{ 945, "Class Engine.SeqCond_CompareString" },	// 945
+	{ 946, "Class Engine.SeqCond_GetServerType" },	// 946
+	{ 947, "Class Engine.SeqCond_Increment" },	// 947
+	{ 948, "Class Engine.SeqCond_IncrementFloat" },	// 948
+	{ 949, "Class Engine.SeqCond_IsAlive" },	// 949
+	{ 950, "Class Engine.SeqCond_IsConsole" },	// 950
+	{ 951, "Class Engine.SeqCond_IsInCombat" },	// 951
+	{ 952, "Class Engine.SeqCond_IsLoggedIn" },	// 952
+	{ 953, "Class Engine.SeqCond_IsSameTeam" },	// 953
+	{ 954, "Class Engine.SeqCond_SwitchBase" },	// 954
+	{ 955, "Class Engine.SeqCond_SwitchClass" },	// 955
+	{ 956, "Class Engine.SeqCond_SwitchObject" },	// 956
+	{ 957, "Class Engine.SeqCond_SwitchPlatform" },	// 957
+	{ 958, "Class Engine.SequenceEvent" },	// 958
+	{ 959, "Class Engine.SeqEvent_AISeeEnemy" },	// 959
+	{ 960, "Class Engine.SeqEvent_AnimNotify" },	// 960
+	{ 961, "Class Engine.SeqEvent_Console" },	// 961
+	{ 962, "Class Engine.SeqEvent_ConstraintBroken" },	// 962
+	{ 963, "Class Engine.SeqEvent_Destroyed" },	// 963
+	{ 964, "Class Engine.SeqEvent_GetInventory" },	// 964
+	{ 965, "Class Engine.SeqEvent_LevelBeginning" },	// 965
+	{ 966, "Class Engine.SeqEvent_LevelLoaded" },	// 966
+	{ 967, "Class Engine.SeqEvent_LevelStartup" },	// 967
+	{ 968, "Class Engine.SeqEvent_Mover" },	// 968
+	{ 969, "Class Engine.SeqEvent_ParticleEvent" },	// 969
+	{ 970, "Class Engine.SeqEvent_ProjectileLanded" },	// 970
+	{ 971, "Class Engine.SeqEvent_RemoteEvent" },	// 971
+	{ 972, "Class Engine.SeqEvent_RigidBodyCollision" },	// 972
+	{ 973, "Class Engine.SeqEvent_SeeDeath" },	// 973
+	{ 974, "Class Engine.SeqEvent_SequenceActivated" },	// 974
+	{ 975, "Class Engine.SeqEvent_TakeDamage" },	// 975
+	{ 976, "Class Engine.SeqEvent_Touch" },	// 976
+	{ 977, "Class Engine.SeqEvent_Used" },	// 977
+	{ 978, "Class Engine.SequenceVariable" },	// 978
+	{ 979, "Class Engine.BioSeqVar_StrRef" },	// 979
+	{ 980, "Class Engine.BioSeqVar_StrRefLiteral" },	// 980
+	{ 981, "Class Engine.InterpData" },	// 981
+	{ 982, "Class Engine.SeqVar_Bool" },	// 982
+	{ 983, "Class Engine.SeqVar_External" },	// 983
+	{ 984, "Class Engine.SeqVar_Float" },	// 984
+	{ 985, "Class Engine.SeqVar_RandomFloat" },	// 985
+	{ 986, "Class Engine.SeqVar_Int" },	// 986
+	{ 987, "Class Engine.SeqVar_RandomInt" },	// 987
+	{ 988, "Class Engine.SeqVar_Name" },	// 988
+	{ 989, "Class Engine.SeqVar_Named" },	// 989
+	{ 990, "Class Engine.SeqVar_ScopedNamed" },	// 990
+	{ 991, "Class Engine.SeqVar_Object" },	// 991
+	{ 992, "Class Engine.SeqVar_Character" },	// 992
+	{ 993, "Class Engine.SeqVar_Group" },	// 993
+	{ 994, "Class Engine.SeqVar_ObjectList" },	// 994
+	{ 995, "Class Engine.SeqVar_ObjectVolume" },	// 995
+	{ 996, "Class Engine.SeqVar_Player" },	// 996
+	{ 997, "Class Engine.SeqVar_String" },	// 997
+	{ 998, "Class Engine.SeqVar_Vector" },	// 998
+	{ 999, "Class Engine.AmbientSound" },	// 999
+	{ 1000, "Class Engine.AmbientSoundMovable" },	// 1000
+	{ 1001, "Class Engine.AmbientSoundSimple" },	// 1001
+	{ 1002, "Class Engine.AmbientSoundNonLoop" },	// 1002
+	{ 1003, "Class Engine.AmbientSoundSimpleToggleable" },	// 1003
+	{ 1004, "Class Engine.DistributionFloatSoundParameter" },	// 1004
+	{ 1005, "Class Engine.SoundNode" },	// 1005
+	{ 1006, "Class Engine.SoundNodeAmbient" },	// 1006
+	{ 1007, "Class Engine.SoundNodeAmbientNonLoop" },	// 1007
+	{ 1008, "Class Engine.SoundNodeAttenuation" },	// 1008
+	{ 1009, "Class Engine.SoundNodeConcatenator" },	// 1009
+	{ 1010, "Class Engine.SoundNodeDelay" },	// 1010
+	{ 1011, "Class Engine.SoundNodeDistanceCrossFade" },	// 1011
+	{ 1012, "Class Engine.SoundNodeLooping" },	// 1012
+	{ 1013, "Class Engine.SoundNodeMature" },	// 1013
+	{ 1014, "Class Engine.SoundNodeMixer" },	// 1014
+	{ 1015, "Class Engine.SoundNodeModulator" },	// 1015
+	{ 1016, "Class Engine.SoundNodeModulatorContinuous" },	// 1016
+	{ 1017, "Class Engine.SoundNodeOscillator" },	// 1017
+	{ 1018, "Class Engine.SoundNodeRandom" },	// 1018
+	{ 1019, "Class Engine.SoundNodeWave" },	// 1019
+	{ 1020, "Class Engine.SoundNodeWaveStreaming" },	// 1020
+	{ 1021, "Class Engine.SoundNodeWaveParam" },	// 1021
+	{ 1022, "Class Engine.Terrain" },	// 1022
+	{ 1023, "Class Engine.TerrainComponent" },	// 1023
+	{ 1024, "Class Engine.TerrainWeightMapTexture" },	// 1024
+	{ 1025, "Class Engine.TerrainLayerSetup" },	// 1025
+	{ 1026, "Class Engine.TerrainMaterial" },	// 1026
+	{ 1027, "Class Engine.UIRoot" },	// 1027
+	{ 1028, "Class Engine.UIScreenObject" },	// 1028
+	{ 1029, "Class Engine.UIComponent" },	// 1029
+	{ 1030, "Class Engine.UIComp_Event" },	// 1030
+	{ 1031, "Class Engine.UIEventContainer" },	// 1031
+	{ 1032, "Class Engine.DataStoreClient" },	// 1032
+	{ 1033, "Class Engine.Interaction" },	// 1033
+	{ 1034, "Class Engine.Console" },	// 1034
+	{ 1035, "Class Engine.Input" },	// 1035
+	{ 1036, "Class Engine.PlayerInput" },	// 1036
+	{ 1037, "Class Engine.PlayerManagerInteraction" },	// 1037
+	{ 1038, "Class Engine.UIInteraction" },	// 1038
+	{ 1039, "Class Engine.UIInputConfiguration" },	// 1039
+	{ 1040, "Class Engine.UILayerBase" },	// 1040
+	{ 1041, "Class Engine.UISceneClient" },	// 1041
+	{ 1042, "Class Engine.UIState" },	// 1042
+	{ 1043, "Class Engine.UIState_Disabled" },	// 1043
+	{ 1044, "Class Engine.UIState_Enabled" },	// 1044
+	{ 1045, "Class Engine.UIString" },	// 1045
+	{ 1046, "Class Engine.UIDataProvider" },	// 1046
+	{ 1047, "Class Engine.UIDataStore" },	// 1047
+	{ 1048, "Class Engine.UISkin" },	// 1048
+	{ 1049, "Class Engine.UIStyle" },	// 1049
+	{ 1050, "Class Engine.UIObject" },	// 1050
+	{ 1051, "Class Engine.UIComp_AutoAlignment" },	// 1051
+	{ 1052, "Class Engine.UIComp_DrawComponents" },	// 1052
+	{ 1053, "Class Engine.UIComp_DrawImage" },	// 1053
+	{ 1054, "Class Engine.UIComp_DrawString" },	// 1054
+	{ 1055, "Class Engine.UIList" },	// 1055
+	{ 1056, "Class Engine.UIComp_ListComponentBase" },	// 1056
+	{ 1057, "Class Engine.UIComp_ListElementSorter" },	// 1057
+	{ 1058, "Class Engine.UIComp_ListPresenterBase" },	// 1058
+	{ 1059, "Class Engine.UIComp_ListPresenter" },	// 1059
+	{ 1060, "Class Engine.UIDataStoreSubscriber" },	// 1060
+	{ 1061, "Class Engine.UIDataStorePublisher" },	// 1061
+	{ 1062, "Class Engine.UIListElementCellProvider" },	// 1062
+	{ 1063, "Class Engine.UIListElementProvider" },	// 1063
+	{ 1064, "Class Engine.UIAnimation" },	// 1064
+	{ 1065, "Class Engine.UIAnimationSeq" },	// 1065
+	{ 1066, "Class Engine.UIConfigProvider" },	// 1066
+	{ 1067, "Class Engine.UIDataProvider_OnlinePlayerDataBase" },	// 1067
+	{ 1068, "Class Engine.UIDataProvider_OnlineClanMates" },	// 1068
+	{ 1069, "Class Engine.UIDataProvider_OnlineFriendMessages" },	// 1069
+	{ 1070, "Class Engine.UIDataProvider_OnlineFriends" },	// 1070
+	{ 1071, "Class Engine.UIDataProvider_OnlinePartyChatList" },	// 1071
+	{ 1072, "Class Engine.UIDataProvider_OnlinePlayers" },	// 1072
+	{ 1073, "Class Engine.UIDataProvider_OnlinePlayerStorage" },	// 1073
+	{ 1074, "Class Engine.UIDataProvider_OnlineProfileSettings" },	// 1074
+	{ 1075, "Class Engine.UIDataProvider_PlayerAchievements" },	// 1075
+	{ 1076, "Class Engine.UIDataProvider_OnlinePlayerStorageArray" },	// 1076
+	{ 1077, "Class Engine.UIDataProvider_SettingsArray" },	// 1077
+	{ 1078, "Class Engine.SceneDataStore" },	// 1078
+	{ 1079, "Class Engine.UIDataStore_Color" },	// 1079
+	{ 1080, "Class Engine.UIDataStore_DynamicResource" },	// 1080
+	{ 1081, "Class Engine.UIDataStore_Fonts" },	// 1081
+	{ 1082, "Class Engine.UIDataStore_GameResource" },	// 1082
+	{ 1083, "Class Engine.UIDataStore_MenuItems" },	// 1083
+	{ 1084, "Class Engine.UIDataStore_GameState" },	// 1084
+	{ 1085, "Class Engine.CurrentGameDataStore" },	// 1085
+	{ 1086, "Class Engine.PlayerOwnerDataStore" },	// 1086
+	{ 1087, "Class Engine.UIDataStore_Gamma" },	// 1087
+	{ 1088, "Class Engine.UIDataStore_Images" },	// 1088
+	{ 1089, "Class Engine.UIDataStore_OnlinePlaylists" },	// 1089
+	{ 1090, "Class Engine.UIDataStore_Registry" },	// 1090
+	{ 1091, "Class Engine.UIDataStore_Remote" },	// 1091
+	{ 1092, "Class Engine.UIDataStore_OnlineGameSearch" },	// 1092
+	{ 1093, "Class Engine.UIDataStore_OnlinePlayerData" },	// 1093
+	{ 1094, "Class Engine.UIDataStore_OnlineStats" },	// 1094
+	{ 1095, "Class Engine.UIDataStore_Settings" },	// 1095
+	{ 1096, "Class Engine.UIDataStore_OnlineGameSettings" },	// 1096
+	{ 1097, "Class Engine.UIDataStore_SessionSettings" },	// 1097
+	{ 1098, "Class Engine.UIDataStore_StringBase" },	// 1098
+	{ 1099, "Class Engine.UIDataStore_InputAlias" },	// 1099
+	{ 1100, "Class Engine.UIDataStore_StringAliasMap" },	// 1100
+	{ 1101, "Class Engine.UICustomSkin" },	// 1101
+	{ 1102, "Class Engine.UIDynamicFieldProvider" },	// 1102
+	{ 1103, "Class Engine.UIPropertyDataProvider" },	// 1103
+	{ 1104, "Class Engine.UIDynamicDataProvider" },	// 1104
+	{ 1105, "Class Engine.GameInfoDataProvider" },	// 1105
+	{ 1106, "Class Engine.InventoryDataProvider" },	// 1106
+	{ 1107, "Class Engine.PowerupDataProvider" },	// 1107
+	{ 1108, "Class Engine.WeaponDataProvider" },	// 1108
+	{ 1109, "Class Engine.CurrentWeaponDataProvider" },	// 1109
+	{ 1110, "Class Engine.PickupDataProvider" },	// 1110
+	{ 1111, "Class Engine.PlayerDataProvider" },	// 1111
+	{ 1112, "Class Engine.PlayerOwnerDataProvider" },	// 1112
+	{ 1113, "Class Engine.TeamDataProvider" },	// 1113
+	{ 1114, "Class Engine.UIDataProvider_Settings" },	// 1114
+	{ 1115, "Class Engine.UIResourceDataProvider" },	// 1115
+	{ 1116, "Class Engine.UIDataProvider_MenuItem" },	// 1116
+	{ 1117, "Class Engine.UIMapSummary" },	// 1117
+	{ 1118, "Class Engine.UISettingsProvider" },	// 1118
+	{ 1119, "Class Engine.SessionSettingsProvider" },	// 1119
+	{ 1120, "Class Engine.UIResourceCombinationProvider" },	// 1120
+	{ 1121, "Class Engine.GameUISceneClient" },	// 1121
+	{ 1122, "Class Engine.UIButton" },	// 1122
+	{ 1123, "Class Engine.UILabelButton" },	// 1123
+	{ 1124, "Class Engine.UICalloutButton" },	// 1124
+	{ 1125, "Class Engine.UIScrollbar" },	// 1125
+	{ 1126, "Class Engine.UIScrollbarButton" },	// 1126
+	{ 1127, "Class Engine.UIScrollbarMarkerButton" },	// 1127
+	{ 1128, "Class Engine.UIContainer" },	// 1128
+	{ 1129, "Class Engine.UICalloutButtonPanel" },	// 1129
+	{ 1130, "Class Engine.UISafeRegionPanel" },	// 1130
+	{ 1131, "Class Engine.UIImage" },	// 1131
+	{ 1132, "Class Engine.UILabel" },	// 1132
+	{ 1133, "Class Engine.UIContextMenu" },	// 1133
+	{ 1134, "Class Engine.UIPrefab" },	// 1134
+	{ 1135, "Class Engine.UIPrefabInstance" },	// 1135
+	{ 1136, "Class Engine.UIScene" },	// 1136
+	{ 1137, "Class Engine.UIState_Active" },	// 1137
+	{ 1138, "Class Engine.UIState_Focused" },	// 1138
+	{ 1139, "Class Engine.UIState_Pressed" },	// 1139
+	{ 1140, "Class Engine.UIListString" },	// 1140
+	{ 1141, "Class Engine.UIStyle_Data" },	// 1141
+	{ 1142, "Class Engine.UIStyle_Combo" },	// 1142
+	{ 1143, "Class Engine.UIStyle_Image" },	// 1143
+	{ 1144, "Class Engine.UIStyle_Text" },	// 1144
+	{ 1145, "Class Engine.UITexture" },	// 1145
+	{ 1146, "Class Engine.UITickableObjectProxy" },	// 1146
+	{ 1147, "Class Engine.UIStringRenderer" },	// 1147
+	{ 1148, "Class Engine.UIStyleResolver" },	// 1148
+	{ 1149, "Class Engine.UITickableObject" },	// 1149
+	{ 1150, "Class Engine.UISequence" },	// 1150
+	{ 1151, "Class Engine.UIStateSequence" },	// 1151
+	{ 1152, "Class Engine.UIAction" },	// 1152
+	{ 1153, "Class Engine.UIEvent" },	// 1153
+	{ 1154, "Class Engine.UIEvent_CalloutButtonInputProxy" },	// 1154
+	{ 1155, "Class Engine.UIEvent_MetaObject" },	// 1155
+	{ 1156, "Class Engine.UIEvent_ProcessInput" },	// 1156
+	{ 1157, "Class Engine.Scene" },	// 1157
+	{ 1158, "Class Engine.FoliageFactory" },	// 1158
+	{ 1159, "Class Engine.InteractiveFoliageActor" },	// 1159
+	{ 1160, "Class Engine.FoliageComponent" },	// 1160
+	{ 1161, "Class Engine.InteractiveFoliageComponent" },	// 1161
+	{ 1162, "Class Engine.ActorFactoryInteractiveFoliage" },	// 1162
+	{ 1163, "Class Engine.FluidInfluenceActor" },	// 1163
+	{ 1164, "Class Engine.FluidSurfaceActor" },	// 1164
+	{ 1165, "Class Engine.FluidSurfaceActorMovable" },	// 1165
+	{ 1166, "Class Engine.FluidInfluenceComponent" },	// 1166
+	{ 1167, "Class Engine.FluidSurfaceComponent" },	// 1167
+	{ 1168, "Class Engine.SpeedTreeActor" },	// 1168
+	{ 1169, "Class Engine.SpeedTreeComponent" },	// 1169
+	{ 1170, "Class Engine.SpeedTreeActorFactory" },	// 1170
+	{ 1171, "Class Engine.SpeedTreeComponentFactory" },	// 1171
+	{ 1172, "Class Engine.SpeedTree" },	// 1172
+	{ 1173, "Class Engine.LensFlareSource" },	// 1173
+	{ 1174, "Class Engine.LensFlareComponent" },	// 1174
+	{ 1175, "Class Engine.LensFlare" },	// 1175
+	{ 1176, "Class Engine.TextureFlipBook" },	// 1176
+	{ 1177, "Class Engine.Texture2DComposite" },	// 1177
+	{ 1178, "Class Engine.Texture2DDynamic" },	// 1178
+	{ 1179, "Class Engine.TextureCube" },	// 1179
+	{ 1180, "Class Engine.TextureMovie" },	// 1180
+	{ 1181, "Class Engine.TextureRenderTarget" },	// 1181
+	{ 1182, "Class Engine.TextureRenderTarget2D" },	// 1182
+	{ 1183, "Class Engine.ScriptedTexture" },	// 1183
+	{ 1184, "Class Engine.TextureRenderTargetCube" },	// 1184
+	{ 1185, "Class Engine.AudioDevice" },	// 1185
+	{ 1186, "Class Engine.SoundClass" },	// 1186
+	{ 1187, "Class Engine.SoundMode" },	// 1187
+	{ 1188, "Class Engine.DebugCameraController" },	// 1188
+	{ 1189, "Class Engine.MatineePawn" },	// 1189
+	{ 1190, "Class Engine.Scout" },	// 1190
+	{ 1191, "Class Engine.LightVolume" },	// 1191
+	{ 1192, "Class Engine.Light" },	// 1192
+	{ 1193, "Class Engine.DirectionalLight" },	// 1193
+	{ 1194, "Class Engine.DirectionalLightToggleable" },	// 1194
+	{ 1195, "Class Engine.DominantDirectionalLight" },	// 1195
+	{ 1196, "Class Engine.PointLight" },	// 1196
+	{ 1197, "Class Engine.DominantPointLight" },	// 1197
+	{ 1198, "Class Engine.PointLightMovable" },	// 1198
+	{ 1199, "Class Engine.PointLightToggleable" },	// 1199
+	{ 1200, "Class Engine.SkyLight" },	// 1200
+	{ 1201, "Class Engine.SkyLightToggleable" },	// 1201
+	{ 1202, "Class Engine.SpotLight" },	// 1202
+	{ 1203, "Class Engine.DominantSpotLight" },	// 1203
+	{ 1204, "Class Engine.SpotLightMovable" },	// 1204
+	{ 1205, "Class Engine.SpotLightToggleable" },	// 1205
+	{ 1206, "Class Engine.StaticLightCollectionActor" },	// 1206
+	{ 1207, "Class Engine.LightComponent" },	// 1207
+	{ 1208, "Class Engine.DirectionalLightComponent" },	// 1208
+	{ 1209, "Class Engine.DominantDirectionalLightComponent" },	// 1209
+	{ 1210, "Class Engine.PointLightComponent" },	// 1210
+	{ 1211, "Class Engine.DominantPointLightComponent" },	// 1211
+	{ 1212, "Class Engine.SpotLightComponent" },	// 1212
+	{ 1213, "Class Engine.DominantSpotLightComponent" },	// 1213
+	{ 1214, "Class Engine.SkyLightComponent" },	// 1214
+	{ 1215, "Class Engine.SphericalHarmonicLightComponent" },	// 1215
+	{ 1216, "Class Engine.LightEnvironmentComponent" },	// 1216
+	{ 1217, "Class Engine.DynamicLightEnvironmentComponent" },	// 1217
+	{ 1218, "Class Engine.ParticleLightEnvironmentComponent" },	// 1218
+	{ 1219, "Class Engine.DrawLightConeComponent" },	// 1219
+	{ 1220, "Class Engine.DrawLightRadiusComponent" },	// 1220
+	{ 1221, "Class Engine.LightFunction" },	// 1221
+	{ 1222, "Class Engine.SkeletalMeshComponent" },	// 1222
+	{ 1223, "Class Engine.SkeletalMesh" },	// 1223
+	{ 1224, "Class Engine.SkeletalMeshSocket" },	// 1224
+	{ 1225, "Class Engine.SplineActor" },	// 1225
+	{ 1226, "Class Engine.SplineLoftActor" },	// 1226
+	{ 1227, "Class Engine.SplineComponent" },	// 1227
+	{ 1228, "Class Engine.ProcBuilding" },	// 1228
+	{ 1229, "Class Engine.ProcBuilding_SimpleLODActor" },	// 1229
+	{ 1230, "Class Engine.PBRuleNodeBase" },	// 1230
+	{ 1231, "Class Engine.PBRuleNodeAlternate" },	// 1231
+	{ 1232, "Class Engine.PBRuleNodeComment" },	// 1232
+	{ 1233, "Class Engine.PBRuleNodeCorner" },	// 1233
+	{ 1234, "Class Engine.PBRuleNodeEdgeAngle" },	// 1234
+	{ 1235, "Class Engine.PBRuleNodeEdgeMesh" },	// 1235
+	{ 1236, "Class Engine.PBRuleNodeExtractTopBottom" },	// 1236
+	{ 1237, "Class Engine.PBRuleNodeLODQuad" },	// 1237
+	{ 1238, "Class Engine.PBRuleNodeMesh" },	// 1238
+	{ 1239, "Class Engine.PBRuleNodeOcclusion" },	// 1239
+	{ 1240, "Class Engine.PBRuleNodeQuad" },	// 1240
+	{ 1241, "Class Engine.PBRuleNodeRandom" },	// 1241
+	{ 1242, "Class Engine.PBRuleNodeRepeat" },	// 1242
+	{ 1243, "Class Engine.PBRuleNodeSize" },	// 1243
+	{ 1244, "Class Engine.PBRuleNodeSplit" },	// 1244
+	{ 1245, "Class Engine.PBRuleNodeSubRuleset" },	// 1245
+	{ 1246, "Class Engine.PBRuleNodeTransform" },	// 1246
+	{ 1247, "Class Engine.PBRuleNodeVariation" },	// 1247
+	{ 1248, "Class Engine.PBRuleNodeWindowWall" },	// 1248
+	{ 1249, "Class Engine.ProcBuildingRuleset" },	// 1249
+	{ 1250, "Class Engine.ReplicationInfo" },	// 1250
+	{ 1251, "Class Engine.GameReplicationInfo" },	// 1251
+	{ 1252, "Class Engine.PlayerReplicationInfo" },	// 1252
+	{ 1253, "Class Engine.TeamInfo" },	// 1253
+	{ 1254, "Class Engine.Camera" },	// 1254
+	{ 1255, "Class Engine.CameraActor" },	// 1255
+	{ 1256, "Class Engine.DynamicCameraActor" },	// 1256
+	{ 1257, "Class Engine.CameraAnim" },	// 1257
+	{ 1258, "Class Engine.CameraAnimInst" },	// 1258
+	{ 1259, "Class Engine.CameraModifier" },	// 1259
+	{ 1260, "Class Engine.CameraModifier_CameraShake" },	// 1260
+	{ 1261, "Class Engine.CameraShake" },	// 1261
+	{ 1262, "Class Engine.BioRemoteLogger" },	// 1262
+	{ 1263, "Class Engine.SFXLightProbeBlendVolume" },	// 1263
+	{ 1264, "Class Engine.SFXLightProbe" },	// 1264
+	{ 1265, "Class Engine.SFXPointLightComponent" },	// 1265
+	{ 1266, "Class Engine.BioDynamicLightEnvironmentComponent" },	// 1266
+	{ 1267, "Class Engine.SFXUberPostProcessEffect" },	// 1267
+	{ 1268, "Class Engine.SFXLightRig" },	// 1268
+	{ 1269, "Class GameFramework.GameAIController" },	// 1269
+	{ 1270, "Class GameFramework.GameAICommand" },	// 1270
+	{ 1271, "Class GameFramework.GameTypes" },	// 1271
+	{ 1272, "Class GameFramework.SeqAct_ModifyProperty" },	// 1272
+	{ 1273, "Class IpDrv.ClientBeaconAddressResolver" },	// 1273
+	{ 1274, "Class IpDrv.HTTPDownload" },	// 1274
+	{ 1275, "Class IpDrv.InternetLink" },	// 1275
+	{ 1276, "Class IpDrv.TcpLink" },	// 1276
+	{ 1277, "Class IpDrv.MCPBase" },	// 1277
+	{ 1278, "Class IpDrv.OnlineEventsInterfaceMcp" },	// 1278
+	{ 1279, "Class IpDrv.OnlineNewsInterfaceMcp" },	// 1279
+	{ 1280, "Class IpDrv.OnlineTitleFileDownloadMcp" },	// 1280
+	{ 1281, "Class IpDrv.MeshBeacon" },	// 1281
+	{ 1282, "Class IpDrv.MeshBeaconClient" },	// 1282
+	{ 1283, "Class IpDrv.MeshBeaconHost" },	// 1283
+	{ 1284, "Class IpDrv.OnlineSubsystemCommonImpl" },	// 1284
+	{ 1285, "Class IpDrv.OnlineGameInterfaceImpl" },	// 1285
+	{ 1286, "Class IpDrv.PartyBeacon" },	// 1286
+	{ 1287, "Class IpDrv.PartyBeaconClient" },	// 1287
+	{ 1288, "Class IpDrv.PartyBeaconHost" },	// 1288
+	{ 1289, "Class IpDrv.TcpipConnection" },	// 1289
+	{ 1290, "Class IpDrv.TcpNetDriver" },	// 1290
+	{ 1291, "Class IpDrv.WebRequest" },	// 1291
+	{ 1292, "Class IpDrv.WebResponse" },	// 1292
+	{ 1293, "Class GFxUI.GFxEngine" },	// 1293
+	{ 1294, "Class GFxUI.GFxFSCmdHandler" },	// 1294
+	{ 1295, "Class GFxUI.GFxGameViewportClient" },	// 1295
+	{ 1296, "Class GFxUI.GFxInteraction" },	// 1296
+	{ 1297, "Class GFxUI.GFxMovie" },	// 1297
+	{ 1298, "Class GFxUI.GFxMovieInfo" },	// 1298
+	{ 1299, "Class GFxUI.GFxValue" },	// 1299
+	{ 1300, "Class GFxUI.GFxAction_CloseMovie" },	// 1300
+	{ 1301, "Class GFxUI.GFxAction_GetVariable" },	// 1301
+	{ 1302, "Class GFxUI.GFxAction_Invoke" },	// 1302
+	{ 1303, "Class GFxUI.GFxAction_OpenMovie" },	// 1303
+	{ 1304, "Class GFxUI.GFxAction_SetCaptureKeys" },	// 1304
+	{ 1305, "Class GFxUI.GFxAction_SetFocus" },	// 1305
+	{ 1306, "Class GFxUI.GFxAction_SetVariable" },	// 1306
+	{ 1307, "Class GFxUI.GFxEvent_FsCommand" },	// 1307
+	{ 1308, "Class GFxUI.GFxFSCmdHandler_Kismet" },	// 1308
+	{ 1309, "Class GFxUI.GFxDataStoreSubscriber" },	// 1309
+	{ 1310, "Class WwiseAudio.ActorFactoryWwiseAmbientSound" },	// 1310
+	{ 1311, "Class WwiseAudio.AnimNotify_WwiseEvent" },	// 1311
+	{ 1312, "Class WwiseAudio.InterpTrackInstWwiseEvent" },	// 1312
+	{ 1313, "Class WwiseAudio.InterpTrackInstWwiseRTPC" },	// 1313
+	{ 1314, "Class WwiseAudio.InterpTrackWwiseEvent" },	// 1314
+	{ 1315, "Class WwiseAudio.InterpTrackWwiseSoundEffect" },	// 1315
+	{ 1316, "Class WwiseAudio.InterpTrackWwiseRTPC" },	// 1316
+	{ 1317, "Class WwiseAudio.SeqAct_WwiseLockMic" },	// 1317
+	{ 1318, "Class WwiseAudio.SeqAct_WwiseMusicVolumeDisable" },	// 1318
+	{ 1319, "Class WwiseAudio.SeqAct_WwiseMusicVolumeEnable" },	// 1319
+	{ 1320, "Class WwiseAudio.SeqAct_WwisePostEvent" },	// 1320
+	{ 1321, "Class WwiseAudio.SeqAct_WwisePostTrigger" },	// 1321
+	{ 1322, "Class WwiseAudio.SeqAct_WwiseSetRTPCValue" },	// 1322
+	{ 1323, "Class WwiseAudio.SeqAct_WwiseSetState" },	// 1323
+	{ 1324, "Class WwiseAudio.SeqAct_WwiseSetSwitch" },	// 1324
+	{ 1325, "Class WwiseAudio.SeqAct_WwiseStartAudioObjects" },	// 1325
+	{ 1326, "Class WwiseAudio.SeqAct_WwiseStopAll" },	// 1326
+	{ 1327, "Class WwiseAudio.WwiseAmbientSound" },	// 1327
+	{ 1328, "Class WwiseAudio.WwiseAudioComponent" },	// 1328
+	{ 1329, "Class WwiseAudio.WwiseAudioComponentMultiLoc" },	// 1329
+	{ 1330, "Class WwiseAudio.WwiseAudioDevice" },	// 1330
+	{ 1331, "Class WwiseAudio.WwiseBundleArchive" },	// 1331
+	{ 1332, "Class WwiseAudio.WwiseComponentCallback" },	// 1332
+	{ 1333, "Class WwiseAudio.WwiseEnvironmentSettings" },	// 1333
+	{ 1334, "Class WwiseAudio.WwiseEnvironmentVolume" },	// 1334
+	{ 1335, "Class WwiseAudio.WwiseEvent" },	// 1335
+	{ 1336, "Class WwiseAudio.WwiseDialogueEvent" },	// 1336
+	{ 1337, "Class WwiseAudio.WwiseEventPairObject" },	// 1337
+	{ 1338, "Class WwiseAudio.WwiseFaceFXStopper" },	// 1338
+	{ 1339, "Class WwiseAudio.WwiseFile" },	// 1339
+	{ 1340, "Class WwiseAudio.WwiseBank" },	// 1340
+	{ 1341, "Class WwiseAudio.WwiseStream" },	// 1341
+	{ 1342, "Class WwiseAudio.WwiseMicPosOrient" },	// 1342
+	{ 1343, "Class WwiseAudio.WwiseProcFoleyComponent" },	// 1343
+	{ 1344, "Class WwiseAudio.WwiseVolume" },	// 1344
+	{ 1345, "Class WwiseAudio.WwiseAudioVolume" },	// 1345
+	{ 1346, "Class WwiseAudio.WwiseMusicVolume" },	// 1346
+	{ 1347, "Class WwiseAudio.WwiseVolumeTimer" },	// 1347
+	{ 1348, "Class WinDrv.WindowsClient" },	// 1348
+	{ 1349, "Class WinDrv.XnaForceFeedbackManager" },	// 1349
+	{ 1350, "Class SFXGame.BioHardLinks" },	// 1350
+	{ 1351, "Class SFXGame.BioHintSystemBase" },	// 1351
+	{ 1352, "Class SFXGame.BioLevelUpSystem" },	// 1352
+	{ 1353, "Class SFXGame.BioLoadingMovie" },	// 1353
+	{ 1354, "Class SFXGame.BioPhysicsSounds" },	// 1354
+	{ 1355, "Class SFXGame.BioPlaypenVolume" },	// 1355
+	{ 1356, "Class SFXGame.BioPlotTreasure" },	// 1356
+	{ 1357, "Class SFXGame.BioPower" },	// 1357
+	{ 1358, "Class SFXGame.BioPowerManager" },	// 1358
+	{ 1359, "Class SFXGame.BioPowerScript" },	// 1359
+	{ 1360, "Class SFXGame.BioRadarMapBoundaries" },	// 1360
+	{ 1361, "Class SFXGame.BioSeqAct_GiveMissionXP_NativeBase" },	// 1361
+	{ 1362, "Class SFXGame.BioSFResources" },	// 1362
+	{ 1363, "Class SFXGame.BioSocketSupermodel" },	// 1363
+	{ 1364, "Class SFXGame.BioTacticalMoveToIndicator" },	// 1364
+	{ 1365, "Class SFXGame.SFXAccomplishmentManager" },	// 1365
+	{ 1366, "Class SFXGame.SFXActorFactoryRigidBody" },	// 1366
+	{ 1367, "Class SFXGame.BioActorFactoryPhysicsActor" },	// 1367
+	{ 1368, "Class SFXGame.SFXAnimationMarker" },	// 1368
+	{ 1369, "Class SFXGame.SFXArmourPiece" },	// 1369
+	{ 1370, "Class SFXGame.SFXAsyncAssetLoader" },	// 1370
+	{ 1371, "Class SFXGame.SFXCombatZone" },	// 1371
+	{ 1372, "Class SFXGame.SFXCustomReachSpec" },	// 1372
+	{ 1373, "Class SFXGame.SFXBoostReachSpec" },	// 1373
+	{ 1374, "Class SFXGame.SFXClimbWallReachSpec" },	// 1374
+	{ 1375, "Class SFXGame.SFXJumpDownReachSpec" },	// 1375
+	{ 1376, "Class SFXGame.SFXJumpReachSpec" },	// 1376
+	{ 1377, "Class SFXGame.SFXLadderReachSpec" },	// 1377
+	{ 1378, "Class SFXGame.SFXLargeBoostReachSpec" },	// 1378
+	{ 1379, "Class SFXGame.SFXLargeClimbReachSpec" },	// 1379
+	{ 1380, "Class SFXGame.SFXLargeMantleReachSpec" },	// 1380
+	{ 1381, "Class SFXGame.SFXLeapReachSpecBase" },	// 1381
+	{ 1382, "Class SFXGame.SFXLeapReachSpecHumanoid" },	// 1382
+	{ 1383, "Class SFXGame.SFXLeapReachSpecLarge" },	// 1383
+	{ 1384, "Class SFXGame.SFXDamageType" },	// 1384
+	{ 1385, "Class SFXGame.SFXDamageType_Suicide" },	// 1385
+	{ 1386, "Class SFXGame.SFXGRI" },	// 1386
+	{ 1387, "Class SFXGame.SFXDifficultyHandler" },	// 1387
+	{ 1388, "Class SFXGame.SFXDoorMarker" },	// 1388
+	{ 1389, "Class SFXGame.SFXDummyWeaponFireActor" },	// 1389
+	{ 1390, "Class SFXGame.SFXDuringAsyncWorkTicker" },	// 1390
+	{ 1391, "Class SFXGame.SFXEngine" },	// 1391
+	{ 1392, "Class SFXGame.SFXGalaxyMapObject" },	// 1392
+	{ 1393, "Class SFXGame.SFXCluster" },	// 1393
+	{ 1394, "Class SFXGame.SFXGalaxy" },	// 1394
+	{ 1395, "Class SFXGame.SFXPlanetFeature" },	// 1395
+	{ 1396, "Class SFXGame.SFXSystem" },	// 1396
+	{ 1397, "Class SFXGame.SFXSystemLevelObject" },	// 1397
+	{ 1398, "Class SFXGame.BioPlanet" },	// 1398
+	{ 1399, "Class SFXGame.SFXGalaxyMapObjectAppearanceBase" },	// 1399
+	{ 1400, "Class SFXGame.SFXGame" },	// 1400
+	{ 1401, "Class SFXGame.SFXGameEffect" },	// 1401
+	{ 1402, "Class SFXGame.BioPlayerController" },	// 1402
+	{ 1403, "Class SFXGame.SFXGameModeBase" },	// 1403
+	{ 1404, "Class SFXGame.SFXGameModeGalaxy" },	// 1404
+	{ 1405, "Class SFXGame.SFXGameModeMultiLand" },	// 1405
+	{ 1406, "Class SFXGame.SFXGameModeManager" },	// 1406
+	{ 1407, "Class SFXGame.SFXGUIInputHandler" },	// 1407
+	{ 1408, "Class SFXGame.SFXInventoryManager" },	// 1408
+	{ 1409, "Class SFXGame.SFXLoadMovieManager" },	// 1409
+	{ 1410, "Class SFXGame.SFXLoadoutData" },	// 1410
+	{ 1411, "Class SFXGame.SFXPlayerSquadLoadoutData" },	// 1411
+	{ 1412, "Class SFXGame.SFXModule_Armour" },	// 1412
+	{ 1413, "Class SFXGame.SFXModule_Audio" },	// 1413
+	{ 1414, "Class SFXGame.SFXModule_Conversation" },	// 1414
+	{ 1415, "Class SFXGame.SFXModule_DamageNativeBase" },	// 1415
+	{ 1416, "Class SFXGame.SFXModule_GameEffectManager_NativeBase" },	// 1416
+	{ 1417, "Class SFXGame.SFXModule_Locomotion" },	// 1417
+	{ 1418, "Class SFXGame.SFXModule_LookAt" },	// 1418
+	{ 1419, "Class SFXGame.SFXModule_Marker" },	// 1419
+	{ 1420, "Class SFXGame.SFXModule_MarkerObjective" },	// 1420
+	{ 1421, "Class SFXGame.SFXModule_MarkerPlayer" },	// 1421
+	{ 1422, "Class SFXGame.SFXModule_Radar" },	// 1422
+	{ 1423, "Class SFXGame.SFXModule_Wound" },	// 1423
+	{ 1424, "Class SFXGame.SFXModule_Wrinkles" },	// 1424
+	{ 1425, "Class SFXGame.sfxmpcharacterrecord" },	// 1425
+	{ 1426, "Class SFXGame.sfxmpclassrecord" },	// 1426
+	{ 1427, "Class SFXGame.SFXNav_BlockingPathNode" },	// 1427
+	{ 1428, "Class SFXGame.SFXNav_BoostNode" },	// 1428
+	{ 1429, "Class SFXGame.SFXNav_ClimbWallNode" },	// 1429
+	{ 1430, "Class SFXGame.SFXNav_JumpDownNode" },	// 1430
+	{ 1431, "Class SFXGame.SFXNav_JumpNode" },	// 1431
+	{ 1432, "Class SFXGame.SFXNav_LadderNode" },	// 1432
+	{ 1433, "Class SFXGame.SFXNav_LargeBoostNode" },	// 1433
+	{ 1434, "Class SFXGame.SFXNav_LeapNodeBase" },	// 1434
+	{ 1435, "Class SFXGame.SFXNav_LeapNodeHumanoid" },	// 1435
+	{ 1436, "Class SFXGame.SFXNav_LeapNodeLarge" },	// 1436
+	{ 1437, "Class SFXGame.SFXNav_ForcedPathNode" },	// 1437
+	{ 1438, "Class SFXGame.SFXNav_GoalPoint" },	// 1438
+	{ 1439, "Class SFXGame.SFXNav_LargeClimbNode" },	// 1439
+	{ 1440, "Class SFXGame.SFXNav_LargeMantleNode" },	// 1440
+	{ 1441, "Class SFXGame.SFXNav_SpawnEntrance" },	// 1441
+	{ 1442, "Class SFXGame.SFXNuiSpeech_Combat" },	// 1442
+	{ 1443, "Class SFXGame.SFXNuiSpeech_Explore" },	// 1443
+	{ 1444, "Class SFXGame.SFXObjectiveDrawSpawnPointComponent" },	// 1444
+	{ 1445, "Class SFXGame.SFXObjectPool" },	// 1445
+	{ 1446, "Class SFXGame.SFXObjectSerializerMT" },	// 1446
+	{ 1447, "Class SFXGame.SFXOutlineGlowActorBase" },	// 1447
+	{ 1448, "Class SFXGame.SFXOutlineGlowActorMP" },	// 1448
+	{ 1449, "Class SFXGame.SFXOutlineGlowActorSP" },	// 1449
+	{ 1450, "Class SFXGame.SFXPathWeightLog" },	// 1450
+	{ 1451, "Class SFXGame.SFXPickupFactory" },	// 1451
+	{ 1452, "Class SFXGame.SFXRpgPickupFactory" },	// 1452
+	{ 1453, "Class SFXGame.SFXWeaponModFactory" },	// 1453
+	{ 1454, "Class SFXGame.SFXWeaponFactory" },	// 1454
+	{ 1455, "Class SFXGame.SFXPlaceableBase" },	// 1455
+	{ 1456, "Class SFXGame.SFXPointOfInterest" },	// 1456
+	{ 1457, "Class SFXGame.SFXPreAsyncWorkTicker" },	// 1457
+	{ 1458, "Class SFXGame.SFXPRI_NativeBase" },	// 1458
+	{ 1459, "Class SFXGame.SFXProfileSettings" },	// 1459
+	{ 1460, "Class SFXGame.SFXReachSpecPlaceholderCylinder" },	// 1460
+	{ 1461, "Class SFXGame.SFXSavedMove" },	// 1461
+	{ 1462, "Class SFXGame.SFXSaveGame" },	// 1462
+	{ 1463, "Class SFXGame.SFXSaveGameCallback" },	// 1463
+	{ 1464, "Class SFXGame.SFXSaveManagerMP" },	// 1464
+	{ 1465, "Class SFXGame.SFXSelectionLensFlareComponent" },	// 1465
+	{ 1466, "Class SFXGame.SFXSelectionModule" },	// 1466
+	{ 1467, "Class SFXGame.SFXSimpleUseModule" },	// 1467
+	{ 1468, "Class SFXGame.SFXModule_AimAssistTarget" },	// 1468
+	{ 1469, "Class SFXGame.SFXModule_SavedUse" },	// 1469
+	{ 1470, "Class SFXGame.SFXWeaponUseModule" },	// 1470
+	{ 1471, "Class SFXGame.SFXVersionDependentSelectionModule" },	// 1471
+	{ 1472, "Class SFXGame.SFXSeqAct_AwardResource" },	// 1472
+	{ 1473, "Class SFXGame.SFXSeqAct_HarvesterLand" },	// 1473
+	{ 1474, "Class SFXGame.SFXSeqAct_LookupHenchmenFromPlotManager" },	// 1474
+	{ 1475, "Class SFXGame.SFXSeqAct_WheelController_NativeBase" },	// 1475
+	{ 1476, "Class SFXGame.SFXSmokeActorBase" },	// 1476
+	{ 1477, "Class SFXGame.SFXVocalizationBank" },	// 1477
+	{ 1478, "Class SFXGame.SFXVocalizationManagerNativeBase" },	// 1478
+	{ 1479, "Class SFXGame.SFXVocalizationTypes" },	// 1479
+	{ 1480, "Class SFXGame.Bio2DA" },	// 1480
+	{ 1481, "Class SFXGame.Bio2DANumberedRows" },	// 1481
+	{ 1482, "Class SFXGame.BioAnim_TurnInPlace_Rotator" },	// 1482
+	{ 1483, "Class SFXGame.BioAnimCheckBlendOut" },	// 1483
+	{ 1484, "Class SFXGame.BioAnimMovementSync" },	// 1484
+	{ 1485, "Class SFXGame.BioAnimNodeAimOffset" },	// 1485
+	{ 1486, "Class SFXGame.BioAnimNodeBlend_TurnInPlace" },	// 1486
+	{ 1487, "Class SFXGame.BioAnimNodeBlendBase" },	// 1487
+	{ 1488, "Class SFXGame.BioAnimNodeBlendAdditive" },	// 1488
+	{ 1489, "Class SFXGame.BioAnimNodeBlendAdditiveCover" },	// 1489
+	{ 1490, "Class SFXGame.BioAnimNodeBlendAdditiveDamage" },	// 1490
+	{ 1491, "Class SFXGame.BioAnimNodeBlendByDeath" },	// 1491
+	{ 1492, "Class SFXGame.BioAnimNodeBlendByIncline" },	// 1492
+	{ 1493, "Class SFXGame.BioAnimNodeBlendByLean" },	// 1493
+	{ 1494, "Class SFXGame.BioAnimNodeBlendDirectional" },	// 1494
+	{ 1495, "Class SFXGame.BioAnimNodeBlendDirStart" },	// 1495
+	{ 1496, "Class SFXGame.BioAnimNodeBlendGetUp" },	// 1496
+	{ 1497, "Class SFXGame.BioAnimNodeBlendMoveStop" },	// 1497
+	{ 1498, "Class SFXGame.BioAnimNodeBlendMultiAdditive" },	// 1498
+	{ 1499, "Class SFXGame.BioAnimNodeBlendEyeNoiseAndBlink" },	// 1499
+	{ 1500, "Class SFXGame.BioAnimNodeBlendPoseAndGestures" },	// 1500
+	{ 1501, "Class SFXGame.BioAnimNodeBlendPose" },	// 1501
+	{ 1502, "Class SFXGame.BioAnimNodeBlendScalar" },	// 1502
+	{ 1503, "Class SFXGame.BioAnimNodeBlendSkidTurn" },	// 1503
+	{ 1504, "Class SFXGame.BioAnimNodeBlendSpeed" },	// 1504
+	{ 1505, "Class SFXGame.BioAnimNodeBlendState" },	// 1505
+	{ 1506, "Class SFXGame.BioAnimNodeCombatMode" },	// 1506
+	{ 1507, "Class SFXGame.BioAnimNodeBlendByAction" },	// 1507
+	{ 1508, "Class SFXGame.BioAnimNodeBlendByAim" },	// 1508
+	{ 1509, "Class SFXGame.BioAnimNodeBlendByCustomAnim" },	// 1509
+	{ 1510, "Class SFXGame.BioAnimNodeBlendByDamage" },	// 1510
+	{ 1511, "Class SFXGame.BioAnimNodeBlendByFireSequence" },	// 1511
+	{ 1512, "Class SFXGame.BioAnimNodeBlendByPosture" },	// 1512
+	{ 1513, "Class SFXGame.BioAnimNodeBlendByPower" },	// 1513
+	{ 1514, "Class SFXGame.BioAnimNodeBlendByReload" },	// 1514
+	{ 1515, "Class SFXGame.BioAnimNodeBlendByStorm" },	// 1515
+	{ 1516, "Class SFXGame.BioAnimNodeBlendByWeaponAction" },	// 1516
+	{ 1517, "Class SFXGame.BioAnimNodeBlendByWeaponEquip" },	// 1517
+	{ 1518, "Class SFXGame.BioAnimNodeBlendFall" },	// 1518
+	{ 1519, "Class SFXGame.BioAnimNodeBlendMovement" },	// 1519
+	{ 1520, "Class SFXGame.BioAnimNodeBlendPerBone" },	// 1520
+	{ 1521, "Class SFXGame.BioAnimNodeBlendScalarBehavior" },	// 1521
+	{ 1522, "Class SFXGame.BioAnimNodeBlendScalarMovementBehavior" },	// 1522
+	{ 1523, "Class SFXGame.BioAnimNodeBlendStateBehavior" },	// 1523
+	{ 1524, "Class SFXGame.BioAnimNodeBlendStateActionBehavior" },	// 1524
+	{ 1525, "Class SFXGame.BioAnimNodeBlendStateCombatBehavior" },	// 1525
+	{ 1526, "Class SFXGame.BioAnimNodeBlendStateMovementBehavior" },	// 1526
+	{ 1527, "Class SFXGame.BioAnimNodeBlendStrafe" },	// 1527
+	{ 1528, "Class SFXGame.BioAnimNodeBlendStuntActor" },	// 1528
+	{ 1529, "Class SFXGame.BioAnimNodeBlendTurn" },	// 1529
+	{ 1530, "Class SFXGame.BioAnimNodeCover2Actions" },	// 1530
+	{ 1531, "Class SFXGame.BioAnimNodeCover2ChangeDirection" },	// 1531
+	{ 1532, "Class SFXGame.BioAnimNodeCover2Move" },	// 1532
+	{ 1533, "Class SFXGame.BioAnimNodeCover2Neutral" },	// 1533
+	{ 1534, "Class SFXGame.BioAnimNodeCover2Transition" },	// 1534
+	{ 1535, "Class SFXGame.BioAnimNodeCover2Type" },	// 1535
+	{ 1536, "Class SFXGame.BioAnimNodeFrame" },	// 1536
+	{ 1537, "Class SFXGame.BioAnimNodeLocomotion" },	// 1537
+	{ 1538, "Class SFXGame.BioAnimNodeLocomotionMoving" },	// 1538
+	{ 1539, "Class SFXGame.BioAnimNodeLocomotionSpeed" },	// 1539
+	{ 1540, "Class SFXGame.BioAnimNodeLocomotionStart" },	// 1540
+	{ 1541, "Class SFXGame.BioAnimNodeLocomotionStop" },	// 1541
+	{ 1542, "Class SFXGame.BioAnimNodeRandom" },	// 1542
+	{ 1543, "Class SFXGame.BioAnimNodeSequence" },	// 1543
+	{ 1544, "Class SFXGame.BioAnimNodeSequenceByBoneRotation" },	// 1544
+	{ 1545, "Class SFXGame.BioAnimNodeSequenceMirror" },	// 1545
+	{ 1546, "Class SFXGame.BioAnimNotifyEvent" },	// 1546
+	{ 1547, "Class SFXGame.BioAnimNotifyVFX" },	// 1547
+	{ 1548, "Class SFXGame.BioSkelControl_TurretConstrained" },	// 1548
+	{ 1549, "Class SFXGame.BioSkelControlAdditiveLookAt" },	// 1549
+	{ 1550, "Class SFXGame.BioActorLookAtController" },	// 1550
+	{ 1551, "Class SFXGame.SFXAnimNodeBlendByMoveTransition" },	// 1551
+	{ 1552, "Class SFXGame.SFXAnimNodeBlendStrafe" },	// 1552
+	{ 1553, "Class SFXGame.SFXAnimNodeBlendStrafeBySpeed" },	// 1553
+	{ 1554, "Class SFXGame.SFXAnimNotify_Exertion" },	// 1554
+	{ 1555, "Class SFXGame.SFXAnimSetCookSpec" },	// 1555
+	{ 1556, "Class SFXGame.SFXDoor" },	// 1556
+	{ 1557, "Class SFXGame.SFXGoreActor" },	// 1557
+	{ 1558, "Class SFXGame.SFXSkelControlLimb" },	// 1558
+	{ 1559, "Class SFXGame.SFXSkelControlSingleBoneByGender" },	// 1559
+	{ 1560, "Class SFXGame.SFXSkelCtrl_AnimatedFootPlacement" },	// 1560
+	{ 1561, "Class SFXGame.SFXSkelCtrl_FootPlanting" },	// 1561
+	{ 1562, "Class SFXGame.SFXSkeletalMeshActor" },	// 1562
+	{ 1563, "Class SFXGame.SFXSkeletalMeshActorMAT" },	// 1563
+	{ 1564, "Class SFXGame.SFXStuntActor" },	// 1564
+	{ 1565, "Class SFXGame.BioPathNodeVolume" },	// 1565
+	{ 1566, "Class SFXGame.BioTierInfo" },	// 1566
+	{ 1567, "Class SFXGame.BioTierManager" },	// 1567
+	{ 1568, "Class SFXGame.BioTriggerStream" },	// 1568
+	{ 1569, "Class SFXGame.BioWorldInfo" },	// 1569
+	{ 1570, "Class SFXGame.SFXGalaxyMapGameData" },	// 1570
+	{ 1571, "Class SFXGame.SFXGameChoiceGUIData" },	// 1571
+	{ 1572, "Class SFXGame.SFXGameChoiceGUIData_PRCShop" },	// 1572
+	{ 1573, "Class SFXGame.SFXGUIData_Elevator" },	// 1573
+	{ 1574, "Class SFXGame.SFXGUIData_Store" },	// 1574
+	{ 1575, "Class SFXGame.SFXGUIData_Terminal" },	// 1575
+	{ 1576, "Class SFXGame.SFXGUI_MainMenu_Message" },	// 1576
+	{ 1577, "Class SFXGame.SFXGUI_MainMenu_RightComputer" },	// 1577
+	{ 1578, "Class SFXGame.SFXGUIMovie" },	// 1578
+	{ 1579, "Class SFXGame.SFXGUIMovieLegacyAdapter" },	// 1579
+	{ 1580, "Class SFXGame.BioSFHandler_Options" },	// 1580
+	{ 1581, "Class SFXGame.SFXGUI_OptionsObject" },	// 1581
+	{ 1582, "Class SFXGame.SFXGUI_Option_LanguageBase" },	// 1582
+	{ 1583, "Class SFXGame.SFXGUI_Option_SpeechLanguage" },	// 1583
+	{ 1584, "Class SFXGame.SFXGUI_Option_TextLanguage" },	// 1584
+	{ 1585, "Class SFXGame.SFXSFHandler_Reticle" },	// 1585
+	{ 1586, "Class SFXGame.SFXGUI_WeaponReticleBase" },	// 1586
+	{ 1587, "Class SFXGame.SFXGUI_CrosshairReticle" },	// 1587
+	{ 1588, "Class SFXGame.SFXGUIHelper_ConsoleKeyboard" },	// 1588
+	{ 1589, "Class SFXGame.SFXGUIInteraction" },	// 1589
+	{ 1590, "Class SFXGame.BioSFHandler_Splash" },	// 1590
+	{ 1591, "Class SFXGame.SFXGUI_SplashScreen" },	// 1591
+	{ 1592, "Class SFXGame.SFXGUI_PCSplashScreen" },	// 1592
+	{ 1593, "Class SFXGame.SFXGUI_Credits" },	// 1593
+	{ 1594, "Class SFXGame.SFXGUI_Elevator" },	// 1594
+	{ 1595, "Class SFXGame.SFXGUI_JournalCodex" },	// 1595
+	{ 1596, "Class SFXGame.SFXGUI_Leaderboard" },	// 1596
+	{ 1597, "Class SFXGame.SFXGUI_Manual" },	// 1597
+	{ 1598, "Class SFXGame.SFXGUI_Markers" },	// 1598
+	{ 1599, "Class SFXGame.SFXGUI_MPScoretags" },	// 1599
+	{ 1600, "Class SFXGame.SFXGUI_Store" },	// 1600
+	{ 1601, "Class SFXGame.SFXGUI_Terminal" },	// 1601
+	{ 1602, "Class SFXGame.SFXGUIMovieKismet" },	// 1602
+	{ 1603, "Class SFXGame.SFXGUI_MainMenu_RTT" },	// 1603
+	{ 1604, "Class SFXGame.SFXGUI_MainMenu_RTT_RC" },	// 1604
+	{ 1605, "Class SFXGame.BioSFHandler_BlackScreen" },	// 1605
+	{ 1606, "Class SFXGame.BioSFHandler_BrowserWheel" },	// 1606
+	{ 1607, "Class SFXGame.BioSFHandler_ChoiceGUI" },	// 1607
+	{ 1608, "Class SFXGame.SFXSFHandler_PRCShop" },	// 1608
+	{ 1609, "Class SFXGame.BioSFHandler_Conversation" },	// 1609
+	{ 1610, "Class SFXGame.BioSFHandler_PCConversation" },	// 1610
+	{ 1611, "Class SFXGame.BioSFHandler_DesignerUI" },	// 1611
+	{ 1612, "Class SFXGame.BioSFHandler_GalaxyMap" },	// 1612
+	{ 1613, "Class SFXGame.BioSFHandler_PCGalaxyMap" },	// 1613
+	{ 1614, "Class SFXGame.BioSFHandler_MainMenu" },	// 1614
+	{ 1615, "Class SFXGame.BioSFHandler_PCMainMenu" },	// 1615
+	{ 1616, "Class SFXGame.BioSFHandler_MessageBox" },	// 1616
+	{ 1617, "Class SFXGame.BioSFHandler_PCMessageBox" },	// 1617
+	{ 1618, "Class SFXGame.BioSFHandler_NewCharacter" },	// 1618
+	{ 1619, "Class SFXGame.BioSFHandler_PCNewCharacter" },	// 1619
+	{ 1620, "Class SFXGame.BioSFHandler_PCOptions" },	// 1620
+	{ 1621, "Class SFXGame.BioSFHandler_XBoxMessageBox" },	// 1621
+	{ 1622, "Class SFXGame.BioSkillGame_Base_Handler" },	// 1622
+	{ 1623, "Class SFXGame.BioSkillGame_Bypass_Handler" },	// 1623
+	{ 1624, "Class SFXGame.BioSkillGame_Decryption_Handler" },	// 1624
+	{ 1625, "Class SFXGame.SFXSFHandler_EANetworking" },	// 1625
+	{ 1626, "Class SFXGame.SFXSFHandler_HUD" },	// 1626
+	{ 1627, "Class SFXGame.SFXSFHandler_Personalization" },	// 1627
+	{ 1628, "Class SFXGame.SFXSFHandler_PowerWheel" },	// 1628
+	{ 1629, "Class SFXGame.SFXSFHandler_PCPowerWheel" },	// 1629
+	{ 1630, "Class SFXGame.SFXSFHandler_Save" },	// 1630
+	{ 1631, "Class SFXGame.SFXSFHandler_Load" },	// 1631
+	{ 1632, "Class SFXGame.SFXSFHandler_Slideshow" },	// 1632
+	{ 1633, "Class SFXGame.SFXGUIMovieExtension" },	// 1633
+	{ 1634, "Class SFXGame.SFXGUIValue_ManualAnimController" },	// 1634
+	{ 1635, "Class SFXGame.SFXGUIValue_Marker" },	// 1635
+	{ 1636, "Class SFXGame.SFXGUIValue_MarkerGrenade" },	// 1636
+	{ 1637, "Class SFXGame.SFXGUIValue_MarkerHenchman" },	// 1637
+	{ 1638, "Class SFXGame.SFXGUIValue_MarkerObjective" },	// 1638
+	{ 1639, "Class SFXGame.SFXGUIValue_MarkerPlayer" },	// 1639
+	{ 1640, "Class SFXGame.SFXGUIValue_PowerIcon" },	// 1640
+	{ 1641, "Class SFXGame.SFXGUIValue_HUDPowerIcon" },	// 1641
+	{ 1642, "Class SFXGame.SFXGUIValue_QuickSlotPowerIcon" },	// 1642
+	{ 1643, "Class SFXGame.SFXSaveLoadWidgetProxy" },	// 1643
+	{ 1644, "Class SFXGame.SFXSF_ReticleBase" },	// 1644
+	{ 1645, "Class SFXGame.SFXSF_ReticleCombatObject" },	// 1645
+	{ 1646, "Class SFXGame.SFXSF_ReticleCombatTarget" },	// 1646
+	{ 1647, "Class SFXGame.SFXWeaponUIData" },	// 1647
+	{ 1648, "Class SFXGame.SFXWeaponUIDataManager" },	// 1648
+	{ 1649, "Class SFXGame.BioCameraZoom" },	// 1649
+	{ 1650, "Class SFXGame.SFXCameraMode" },	// 1650
+	{ 1651, "Class SFXGame.SFXCameraInput" },	// 1651
+	{ 1652, "Class SFXGame.BioCameraUtility" },	// 1652
+	{ 1653, "Class SFXGame.BioCameraBehavior" },	// 1653
+	{ 1654, "Class SFXGame.BioCameraBehaviorConversation" },	// 1654
+	{ 1655, "Class SFXGame.BioCameraBehaviorGalaxy" },	// 1655
+	{ 1656, "Class SFXGame.SFXCameraModifier_ScreenShake" },	// 1656
+	{ 1657, "Class SFXGame.SFXCameraNativeBase" },	// 1657
+	{ 1658, "Class SFXGame.BioAiController" },	// 1658
+	{ 1659, "Class SFXGame.SFXAI_NativeBase" },	// 1659
+	{ 1660, "Class SFXGame.BioCheatManager" },	// 1660
+	{ 1661, "Class SFXGame.BioPlayerInput" },	// 1661
+	{ 1662, "Class SFXGame.BioPlayerSelection" },	// 1662
+	{ 1663, "Class SFXGame.CoverGoalConstraint" },	// 1663
+	{ 1664, "Class SFXGame.CovGoal_AvoidEnemies" },	// 1664
+	{ 1665, "Class SFXGame.CovGoal_CombatZones" },	// 1665
+	{ 1666, "Class SFXGame.CovGoal_Enemies" },	// 1666
+	{ 1667, "Class SFXGame.CovGoal_GoalProximity" },	// 1667
+	{ 1668, "Class SFXGame.CovGoal_MovementDistance" },	// 1668
+	{ 1669, "Class SFXGame.CovGoal_TeammateProximity" },	// 1669
+	{ 1670, "Class SFXGame.CovGoal_WeaponRange" },	// 1670
+	{ 1671, "Class SFXGame.SFXCovGoal_AvoidHazard" },	// 1671
+	{ 1672, "Class SFXGame.SFXCovGoal_AwayFromFriendlies" },	// 1672
+	{ 1673, "Class SFXGame.SFXCovGoal_CanFireAtPrimary" },	// 1673
+	{ 1674, "Class SFXGame.SFXCovGoal_CanFireAtSecondaries" },	// 1674
+	{ 1675, "Class SFXGame.SFXCovGoal_CoverFromPrimary" },	// 1675
+	{ 1676, "Class SFXGame.SFXCovGoal_CoverFromSecondaries" },	// 1676
+	{ 1677, "Class SFXGame.SFXCovGoal_FrontArc" },	// 1677
+	{ 1678, "Class SFXGame.SFXCovGoal_NoFriendlyLOF" },	// 1678
+	{ 1679, "Class SFXGame.Goal_AtCover" },	// 1679
+	{ 1680, "Class SFXGame.Goal_AwayFromPosition" },	// 1680
+	{ 1681, "Class SFXGame.SFXAIPerceptionManager" },	// 1681
+	{ 1682, "Class SFXGame.SFXGoal_SuppressionPoint" },	// 1682
+	{ 1683, "Class SFXGame.SFXPath_AvoidClaimedCover" },	// 1683
+	{ 1684, "Class SFXGame.SFXPath_AvoidFireFromCover" },	// 1684
+	{ 1685, "Class SFXGame.SFXPath_AvoidPlayer" },	// 1685
+	{ 1686, "Class SFXGame.SFXPath_AwayFromGoal" },	// 1686
+	{ 1687, "Class SFXGame.SFXPath_TowardCombatZone" },	// 1687
+	{ 1688, "Class SFXGame.SFXPath_WithinPlaypen" },	// 1688
+	{ 1689, "Class SFXGame.BioConversation" },	// 1689
+	{ 1690, "Class SFXGame.BioConversationController" },	// 1690
+	{ 1691, "Class SFXGame.BioConversationManager" },	// 1691
+	{ 1692, "Class SFXGame.BioSimpleDialog" },	// 1692
+	{ 1693, "Class SFXGame.BioStage" },	// 1693
+	{ 1694, "Class SFXGame.BioCustomAction" },	// 1694
+	{ 1695, "Class SFXGame.BioCustomAction_KroganCharge" },	// 1695
+	{ 1696, "Class SFXGame.SFXCustomAction_ProceduralMoveBase" },	// 1696
+	{ 1697, "Class SFXGame.SFXCustomAction_MantleOverCoverBase" },	// 1697
+	{ 1698, "Class SFXGame.SFXCustomAction_ReachSpecMove" },	// 1698
+	{ 1699, "Class SFXGame.SFXCustomAction_AirRecoverBase" },	// 1699
+	{ 1700, "Class SFXGame.SFXCustomAction_BoostDownBase" },	// 1700
+	{ 1701, "Class SFXGame.SFXCustomAction_ClimbDownBase" },	// 1701
+	{ 1702, "Class SFXGame.SFXCustomAction_ClimbUpBase" },	// 1702
+	{ 1703, "Class SFXGame.SFXCustomAction_LadderClimbDownBase" },	// 1703
+	{ 1704, "Class SFXGame.SFXCustomAction_LeapBase" },	// 1704
+	{ 1705, "Class SFXGame.SFXCustomAction_SyncPawnInstigator_Base" },	// 1705
+	{ 1706, "Class SFXGame.SFXPowerCustomActionBase" },	// 1706
+	{ 1707, "Class SFXGame.SFXTimelineData" },	// 1707
+	{ 1708, "Class SFXGame.BioDefine" },	// 1708
+	{ 1709, "Class SFXGame.BioEventNotifier" },	// 1709
+	{ 1710, "Class SFXGame.BioSFScreenTip" },	// 1710
+	{ 1711, "Class SFXGame.SFXGUIRenderTarget_InterpActor" },	// 1711
+	{ 1712, "Class SFXGame.SFXProjectile" },	// 1712
+	{ 1713, "Class SFXGame.SFXProjectile_Explosive" },	// 1713
+	{ 1714, "Class SFXGame.SFXProjectile_PowerCustomAction" },	// 1714
+	{ 1715, "Class SFXGame.SFXProjectile_Trajectory" },	// 1715
+	{ 1716, "Class SFXGame.SFXTracer" },	// 1716
+	{ 1717, "Class SFXGame.SFXWeapon_NativeBase" },	// 1717
+	{ 1718, "Class SFXGame.SFXWeaponMod_NativeBase" },	// 1718
+	{ 1719, "Class SFXGame.BioGestChainNode" },	// 1719
+	{ 1720, "Class SFXGame.BioGestChainTree" },	// 1720
+	{ 1721, "Class SFXGame.BioGestureAnimSetMgr" },	// 1721
+	{ 1722, "Class SFXGame.BioGestureRulesData" },	// 1722
+	{ 1723, "Class SFXGame.BioGestureRuntimeData" },	// 1723
+	{ 1724, "Class SFXGame.SFXAmbPerfGameData" },	// 1724
+	{ 1725, "Class SFXGame.SFXGestures" },	// 1725
+	{ 1726, "Class SFXGame.BioHUD" },	// 1726
+	{ 1727, "Class SFXGame.BioSubtitles" },	// 1727
+	{ 1728, "Class SFXGame.BioUIWorld" },	// 1728
+	{ 1729, "Class SFXGame.SFXConsole" },	// 1729
+	{ 1730, "Class SFXGame.BioInGamePropertyEditor" },	// 1730
+	{ 1731, "Class SFXGame.BioPropertyEditorBaseNode" },	// 1731
+	{ 1732, "Class SFXGame.BioPropertyEditorBoneNode" },	// 1732
+	{ 1733, "Class SFXGame.BioPropertyEditorLevelNode" },	// 1733
+	{ 1734, "Class SFXGame.BioPropertyEditorLoadNode" },	// 1734
+	{ 1735, "Class SFXGame.BioPropertyEditorPropertyNode" },	// 1735
+	{ 1736, "Class SFXGame.BioPropertyEditorArrayNode" },	// 1736
+	{ 1737, "Class SFXGame.BioPropertyEditorEditableNode" },	// 1737
+	{ 1738, "Class SFXGame.BioPropertyEditorEditNode" },	// 1738
+	{ 1739, "Class SFXGame.BioPropertyEditorReadOnlyNode" },	// 1739
+	{ 1740, "Class SFXGame.BioPropertyEditorSaveNode" },	// 1740
+	{ 1741, "Class SFXGame.BioPropertyEditorVolatileNode" },	// 1741
+	{ 1742, "Class SFXGame.BioEvtSysTrackGestureAudHelper" },	// 1742
+	{ 1743, "Class SFXGame.BioInterpTrackInstMove" },	// 1743
+	{ 1744, "Class SFXGame.BioInterpTrackMove" },	// 1744
+	{ 1745, "Class SFXGame.BioScalarParameterInstTrack" },	// 1745
+	{ 1746, "Class SFXGame.BioScalarParameterTrack" },	// 1746
+	{ 1747, "Class SFXGame.SFXGameInterpTrack" },	// 1747
+	{ 1748, "Class SFXGame.BioConvNodeTrackDebug" },	// 1748
+	{ 1749, "Class SFXGame.BioEvtSysTrackDOF" },	// 1749
+	{ 1750, "Class SFXGame.BioEvtSysTrackInterrupt" },	// 1750
+	{ 1751, "Class SFXGame.BioEvtSysTrackSubtitles" },	// 1751
+	{ 1752, "Class SFXGame.BioEvtSysTrackSwitchCamera" },	// 1752
+	{ 1753, "Class SFXGame.BioEvtSysTrackVOElements" },	// 1753
+	{ 1754, "Class SFXGame.BioInterpTrackRotationMode" },	// 1754
+	{ 1755, "Class SFXGame.SFXGameActorInterpTrack" },	// 1755
+	{ 1756, "Class SFXGame.BioEvtSysTrackGesture" },	// 1756
+	{ 1757, "Class SFXGame.BioEvtSysTrackLighting" },	// 1757
+	{ 1758, "Class SFXGame.BioEvtSysTrackLookAt" },	// 1758
+	{ 1759, "Class SFXGame.BioEvtSysTrackProp" },	// 1759
+	{ 1760, "Class SFXGame.BioEvtSysTrackSetFacing" },	// 1760
+	{ 1761, "Class SFXGame.SFXGameInterpTrackProcFoley" },	// 1761
+	{ 1762, "Class SFXGame.SFXInterpTrackPlayFaceOnlyVO" },	// 1762
+	{ 1763, "Class SFXGame.SFXGameInterpTrackCustom" },	// 1763
+	{ 1764, "Class SFXGame.SFXInterpTrackAttachCrustEffect" },	// 1764
+	{ 1765, "Class SFXGame.SFXInterpTrackAttachToActor" },	// 1765
+	{ 1766, "Class SFXGame.SFXInterpTrackAttachVFXToObject" },	// 1766
+	{ 1767, "Class SFXGame.SFXInterpTrackBlackScreen" },	// 1767
+	{ 1768, "Class SFXGame.SFXInterpTrackDestroy" },	// 1768
+	{ 1769, "Class SFXGame.SFXInterpTrackForceLightEnvUpdate" },	// 1769
+	{ 1770, "Class SFXGame.SFXInterpTrackLightEnvQuality" },	// 1770
+	{ 1771, "Class SFXGame.SFXInterpTrackMovieBase" },	// 1771
+	{ 1772, "Class SFXGame.SFXInterpTrackMovieBink" },	// 1772
+	{ 1773, "Class SFXGame.SFXInterpTrackMovieTexture" },	// 1773
+	{ 1774, "Class SFXGame.SFXInterpTrackSetPlayerNearClipPlane" },	// 1774
+	{ 1775, "Class SFXGame.SFXInterpTrackSetWeaponInstant" },	// 1775
+	{ 1776, "Class SFXGame.SFXInterpTrackToggleBase" },	// 1776
+	{ 1777, "Class SFXGame.SFXInterpTrackToggleAffectedByHitEffects" },	// 1777
+	{ 1778, "Class SFXGame.SFXInterpTrackToggleHidden" },	// 1778
+	{ 1779, "Class SFXGame.SFXInterpTrackToggleLightEnvironment" },	// 1779
+	{ 1780, "Class SFXGame.SFXGameInterpTrackWwiseMicLock" },	// 1780
+	{ 1781, "Class SFXGame.SFXGameInterpTrackInst" },	// 1781
+	{ 1782, "Class SFXGame.BioEvtSysTrackDOFInst" },	// 1782
+	{ 1783, "Class SFXGame.BioEvtSysTrackInterruptInst" },	// 1783
+	{ 1784, "Class SFXGame.BioEvtSysTrackSubtitlesInst" },	// 1784
+	{ 1785, "Class SFXGame.BioEvtSysTrackSwitchCameraInst" },	// 1785
+	{ 1786, "Class SFXGame.BioEvtSysTrackVOElementsInst" },	// 1786
+	{ 1787, "Class SFXGame.BioInterpTrackInstRotationMode" },	// 1787
+	{ 1788, "Class SFXGame.SFXGameActorInterpTrackInst" },	// 1788
+	{ 1789, "Class SFXGame.BioEvtSysTrackGestureInst" },	// 1789
+	{ 1790, "Class SFXGame.BioEvtSysTrackLightingInst" },	// 1790
+	{ 1791, "Class SFXGame.BioEvtSysTrackLookAtInst" },	// 1791
+	{ 1792, "Class SFXGame.BioEvtSysTrackPropInst" },	// 1792
+	{ 1793, "Class SFXGame.BioEvtSysTrackSetFacingInst" },	// 1793
+	{ 1794, "Class SFXGame.SFXGameInterpTrackInstProcFoley" },	// 1794
+	{ 1795, "Class SFXGame.SFXInterpTrackPlayFaceOnlyVOInst" },	// 1795
+	{ 1796, "Class SFXGame.SFXGameInterpTrackInstCustom" },	// 1796
+	{ 1797, "Class SFXGame.SFXGameInterpTrackInstMovieBink" },	// 1797
+	{ 1798, "Class SFXGame.SFXGameInterpTrackInstWwiseMicLock" },	// 1798
+	{ 1799, "Class SFXGame.SFXInterpTrack_MoveTo" },	// 1799
+	{ 1800, "Class SFXGame.SFXInterpTrackInst_MoveTo" },	// 1800
+	{ 1801, "Class SFXGame.SFXSceneShopNodeKisVarCheck" },	// 1801
+	{ 1802, "Class SFXGame.SFXSceneShopNodePlotCheck" },	// 1802
+	{ 1803, "Class SFXGame.SFXSceneShopNodeScene" },	// 1803
+	{ 1804, "Class SFXGame.SFXSceneShopNodeStart" },	// 1804
+	{ 1805, "Class SFXGame.BioInterpolator" },	// 1805
+	{ 1806, "Class SFXGame.BioLookAtDefinition" },	// 1806
+	{ 1807, "Class SFXGame.BioSeqAct_ToggleGlobalLookAt" },	// 1807
+	{ 1808, "Class SFXGame.BioMaterialExpressionAnisoSpec" },	// 1808
+	{ 1809, "Class SFXGame.BioMaterialExpressionBlinnSpec" },	// 1809
+	{ 1810, "Class SFXGame.BioMaterialExpressionDirt" },	// 1810
+	{ 1811, "Class SFXGame.BioMaterialExpressionFresnel" },	// 1811
+	{ 1812, "Class SFXGame.BioMaterialExpressionHalfAngle" },	// 1812
+	{ 1813, "Class SFXGame.BioMaterialExpressionKeyedFlipbook" },	// 1813
+	{ 1814, "Class SFXGame.BioMaterialExpressionPhongSpec" },	// 1814
+	{ 1815, "Class SFXGame.BioMaterialExpressionSineSubtend" },	// 1815
+	{ 1816, "Class SFXGame.BioMaterialExpressionSpecPower" },	// 1816
+	{ 1817, "Class SFXGame.BioMaterialExpressionWound" },	// 1817
+	{ 1818, "Class SFXGame.BioMaterialOverride" },	// 1818
+	{ 1819, "Class SFXGame.SFXModule_Gestures" },	// 1819
+	{ 1820, "Class SFXGame.BioMorphFace" },	// 1820
+	{ 1821, "Class SFXGame.BioMorphFaceFESliderBase" },	// 1821
+	{ 1822, "Class SFXGame.BioMorphFaceFESliderColour" },	// 1822
+	{ 1823, "Class SFXGame.BioMorphFaceFESliderHair" },	// 1823
+	{ 1824, "Class SFXGame.BioMorphFaceFESliderMorph" },	// 1824
+	{ 1825, "Class SFXGame.BioMorphFaceFESliderScalar" },	// 1825
+	{ 1826, "Class SFXGame.BioMorphFaceFESliderSetMorph" },	// 1826
+	{ 1827, "Class SFXGame.BioMorphFaceFESliderTexture" },	// 1827
+	{ 1828, "Class SFXGame.BioMorphUtility" },	// 1828
+	{ 1829, "Class SFXGame.BioMorphFaceFrontEnd" },	// 1829
+	{ 1830, "Class SFXGame.SFXMorphFaceFrontEndDataSource" },	// 1830
+	{ 1831, "Class SFXGame.BioEmissionAreaList" },	// 1831
+	{ 1832, "Class SFXGame.BioEmissionAreaListBoneList" },	// 1832
+	{ 1833, "Class SFXGame.BioParticleModuleBase" },	// 1833
+	{ 1834, "Class SFXGame.BioParticleModuleMultiplyByEmitterSpeed" },	// 1834
+	{ 1835, "Class SFXGame.BioParticleModuleSound" },	// 1835
+	{ 1836, "Class SFXGame.SFXParticleModule_CameraEffect" },	// 1836
+	{ 1837, "Class SFXGame.BioParticleModuleCollisionDecal" },	// 1837
+	{ 1838, "Class SFXGame.BioParticleModuleLocationAttachedMesh" },	// 1838
+	{ 1839, "Class SFXGame.BioParticleModuleLocationPrimitiveNearestSurface" },	// 1839
+	{ 1840, "Class SFXGame.BioParticleModuleVelocityWorldSpace" },	// 1840
+	{ 1841, "Class SFXGame.BioPawn" },	// 1841
+	{ 1842, "Class SFXGame.BioScout" },	// 1842
+	{ 1843, "Class SFXGame.SFXCharacterClass_NativeBase" },	// 1843
+	{ 1844, "Class SFXGame.SFXCompositeSkeletalMesh" },	// 1844
+	{ 1845, "Class SFXGame.SFXKActor" },	// 1845
+	{ 1846, "Class SFXGame.BioPhysicsActor" },	// 1846
+	{ 1847, "Class SFXGame.SFXKActorSpawnable" },	// 1847
+	{ 1848, "Class SFXGame.SFXKAsset" },	// 1848
+	{ 1849, "Class SFXGame.BioCodexMap" },	// 1849
+	{ 1850, "Class SFXGame.BioDiscoveredCodexMap" },	// 1850
+	{ 1851, "Class SFXGame.BioGlobalVariableTable" },	// 1851
+	{ 1852, "Class SFXGame.BioOutcomeMap" },	// 1852
+	{ 1853, "Class SFXGame.BioQuestMap" },	// 1853
+	{ 1854, "Class SFXGame.BioQuestProgressionMap" },	// 1854
+	{ 1855, "Class SFXGame.BioStateEventMap" },	// 1855
+	{ 1856, "Class SFXGame.BioConsequenceMap" },	// 1856
+	{ 1857, "Class SFXGame.SFXPower" },	// 1857
+	{ 1858, "Class SFXGame.SFXPowerManager" },	// 1858
+	{ 1859, "Class SFXGame.BioCurveDrivenParameter" },	// 1859
+	{ 1860, "Class SFXGame.BioDecalComponent" },	// 1860
+	{ 1861, "Class SFXGame.BioVisualEffect" },	// 1861
+	{ 1862, "Class SFXGame.BioSeqAct_ActivateGalaxyMap" },	// 1862
+	{ 1863, "Class SFXGame.BioSeqAct_AddChoiceGUIElement" },	// 1863
+	{ 1864, "Class SFXGame.BioSeqAct_BlockForTextureStreaming" },	// 1864
+	{ 1865, "Class SFXGame.BioSeqAct_CopyPlayerHeadToTarget" },	// 1865
+	{ 1866, "Class SFXGame.BioSeqAct_DUISetElementText" },	// 1866
+	{ 1867, "Class SFXGame.BioSeqAct_DUITimer" },	// 1867
+	{ 1868, "Class SFXGame.BioSeqAct_EndCurrentConvNode" },	// 1868
+	{ 1869, "Class SFXGame.BioSeqAct_ForceLightEnvUpdate" },	// 1869
+	{ 1870, "Class SFXGame.BioSeqAct_ForceStreamInTextures" },	// 1870
+	{ 1871, "Class SFXGame.BioSeqAct_GetFromObjectList" },	// 1871
+	{ 1872, "Class SFXGame.BioSeqAct_GetNearestObject" },	// 1872
+	{ 1873, "Class SFXGame.BioSeqAct_PlayLoadingMovie" },	// 1873
+	{ 1874, "Class SFXGame.BioSeqAct_PMBase" },	// 1874
+	{ 1875, "Class SFXGame.BioSeqAct_PMCheckConditional" },	// 1875
+	{ 1876, "Class SFXGame.BioSeqAct_PMCheckState" },	// 1876
+	{ 1877, "Class SFXGame.BioSeqAct_PMExecuteTransition" },	// 1877
+	{ 1878, "Class SFXGame.BioSeqAct_PositionFSActors" },	// 1878
+	{ 1879, "Class SFXGame.BioSeqAct_ScalarMathUnit" },	// 1879
+	{ 1880, "Class SFXGame.BioSeqAct_SetGestureMode" },	// 1880
+	{ 1881, "Class SFXGame.BioSeqAct_SetLightEnvQuality" },	// 1881
+	{ 1882, "Class SFXGame.BioSeqAct_SetStreamingState" },	// 1882
+	{ 1883, "Class SFXGame.BioSeqAct_SetWeapon" },	// 1883
+	{ 1884, "Class SFXGame.BioSeqAct_SkillGame_Base" },	// 1884
+	{ 1885, "Class SFXGame.BioSeqAct_SkillGame_Bypass" },	// 1885
+	{ 1886, "Class SFXGame.BioSeqAct_SkillGame_Decryption" },	// 1886
+	{ 1887, "Class SFXGame.BioSeqAct_SkynetEvent" },	// 1887
+	{ 1888, "Class SFXGame.BioSeqAct_StopLoadingMovie" },	// 1888
+	{ 1889, "Class SFXGame.BioSeqAct_ToggleLightEnv" },	// 1889
+	{ 1890, "Class SFXGame.BioSeqEvt_BackgroundStreamingDone" },	// 1890
+	{ 1891, "Class SFXGame.BioSeqEvt_CinematicSkipped" },	// 1891
+	{ 1892, "Class SFXGame.BioSeqEvt_Conversation" },	// 1892
+	{ 1893, "Class SFXGame.BioSeqEvt_ConvNode" },	// 1893
+	{ 1894, "Class SFXGame.BioSeqEvt_ForegroundStreamingDone" },	// 1894
+	{ 1895, "Class SFXGame.BioSeqEvt_GalaxyMap" },	// 1895
+	{ 1896, "Class SFXGame.BioSeqEvt_OnPlayerActivate" },	// 1896
+	{ 1897, "Class SFXGame.BioSequenceLatentAction" },	// 1897
+	{ 1898, "Class SFXGame.BioSeqAct_BlackScreen" },	// 1898
+	{ 1899, "Class SFXGame.BioSeqAct_FaceOnlyVO" },	// 1899
+	{ 1900, "Class SFXGame.BioSeqAct_MovieBink" },	// 1900
+	{ 1901, "Class SFXGame.SFXSeqAct_PlatformMovieBink" },	// 1901
+	{ 1902, "Class SFXGame.BioSeqAct_ShowChoiceGUI" },	// 1902
+	{ 1903, "Class SFXGame.SFXSeqAct_LaunchWeaponSelection" },	// 1903
+	{ 1904, "Class SFXGame.SFXSeqAct_StartAmbientConv" },	// 1904
+	{ 1905, "Class SFXGame.SFXSeqAct_StartConversation" },	// 1905
+	{ 1906, "Class SFXGame.BioSeqVar_ChoiceGUIData" },	// 1906
+	{ 1907, "Class SFXGame.BioSeqVar_ObjectFindByTag" },	// 1907
+	{ 1908, "Class SFXGame.BioSeqVar_StoryManagerBool" },	// 1908
+	{ 1909, "Class SFXGame.BioSeqVar_StoryManagerFloat" },	// 1909
+	{ 1910, "Class SFXGame.BioSeqVar_StoryManagerInt" },	// 1910
+	{ 1911, "Class SFXGame.BioSeqVar_StoryManagerStateId" },	// 1911
+	{ 1912, "Class SFXGame.SFXSeqAct_AIFactory2" },	// 1912
+	{ 1913, "Class SFXGame.SFXSeqAct_AwardTreasure_Base" },	// 1913
+	{ 1914, "Class SFXGame.SFXSeqAct_CharCreateClass" },	// 1914
+	{ 1915, "Class SFXGame.SFXSeqAct_CloseChoiceGui" },	// 1915
+	{ 1916, "Class SFXGame.SFXSeqAct_CreateNotification" },	// 1916
+	{ 1917, "Class SFXGame.SFXSeqAct_DummyWeaponFire" },	// 1917
+	{ 1918, "Class SFXGame.SFXSeqAct_EnableAI" },	// 1918
+	{ 1919, "Class SFXGame.SFXSeqAct_FireWeaponAt" },	// 1919
+	{ 1920, "Class SFXGame.SFXSeqAct_FreezeLevelStreaming" },	// 1920
+	{ 1921, "Class SFXGame.SFXSeqAct_HenchmanUseInteractionPoint" },	// 1921
+	{ 1922, "Class SFXGame.SFXSeqAct_InitLoadingMovies" },	// 1922
+	{ 1923, "Class SFXGame.SFXSeqAct_IsPawnInCover" },	// 1923
+	{ 1924, "Class SFXGame.SFXSeqAct_LookAtPOI" },	// 1924
+	{ 1925, "Class SFXGame.SFXSeqAct_MoveOnSplineNativeBase" },	// 1925
+	{ 1926, "Class SFXGame.SFXSeqAct_MoveToNode" },	// 1926
+	{ 1927, "Class SFXGame.SFXSeqAct_PrimeMovie" },	// 1927
+	{ 1928, "Class SFXGame.SFXSeqAct_ReportLevelLoadTime" },	// 1928
+	{ 1929, "Class SFXGame.SFXSeqAct_SetAmbientPerformance" },	// 1929
+	{ 1930, "Class SFXGame.SFXSeqAct_SetStringref" },	// 1930
+	{ 1931, "Class SFXGame.SFXSeqAct_ToggleCombatPawn" },	// 1931
+	{ 1932, "Class SFXGame.SFXSeqAct_UsePowerOn" },	// 1932
+	{ 1933, "Class SFXGame.SFXSeqAct_WaitForGFxMovieClose" },	// 1933
+	{ 1934, "Class SFXGame.SFXSeqAct_WaitForStreamingComplete" },	// 1934
+	{ 1935, "Class SFXGame.SFXSeqAct_WaitUntilLevelIsLive" },	// 1935
+	{ 1936, "Class SFXGame.SFXSeqEvt_AmbientPerformance" },	// 1936
+	{ 1937, "Class SFXGame.SFXSeqEvt_LevelIsLive" },	// 1937
+	{ 1938, "Class SFXGame.SFXSeqEvt_PersistentLevelStarted" },	// 1938
+	{ 1939, "Class SFXGame.SFXSeqEvt_Touch" },	// 1939
+	{ 1940, "Class SFXGame.SFXSeqVar_Hench" },	// 1940
+	{ 1941, "Class SFXGame.SFXSeqVar_SavedBool" },	// 1941
+	{ 1942, "Class SFXGame.SFXSeqVar_ToolTip" },	// 1942
+	{ 1943, "Class SFXGame.SFXAccomplishmentStorage" },	// 1943
+	{ 1944, "Class SFXOnlineFoundation.SFXOnlineComponent" },	// 1944
+	{ 1945, "Class SFXGame.SFXOnlineComponentMatchMakingBot" },	// 1945
+	{ 1946, "Class SFXGame.SFXOnlineComponentUI" },	// 1946
+	{ 1947, "Class SFXGame.SFXOnlineGameEntryFlow" },	// 1947
+	{ 1948, "Class SFXGame.SFXOnlinePlayerStorage" },	// 1948
+	{ 1949, "Class SFXGame.SFXOnlineSaveGameMP" },	// 1949
+	{ 1950, "Class SFXGame.BioBaseSquad" },	// 1950
+	{ 1951, "Class SFXGame.BioPlayerSquad" },	// 1951
+	{ 1952, "Class SFXGame.BioSquadHoldMarker" },	// 1952
+	{ 1953, "Class SFXGame.BioSquadLinesComponent" },	// 1953
+	{ 1954, "Class SFXGame.BioSquadTargetData" },	// 1954
+	{ 1955, "Class SFXGame.SFXTelemetry" },	// 1955
+	{ 1956, "Class SFXGame.SFXTelemetryGameSession" },	// 1956
+	{ 1957, "Class SFXGame.SFXVehicle_MountedGun" },	// 1957
+	{ 1958, "Class SFXGame.SFXVehicleHover" },	// 1958
+	{ 1959, "Class SFXGame.SFXVehicleSimHover" },	// 1959
+	{ 1960, "Class SFXGame.BioMapNote" },	// 1960
+	{ 1961, "Class SFXGame.BioPathPoint" },	// 1961
+	{ 1962, "Class SFXGame.BioWaypointLinesComponent" },	// 1962
+	{ 1963, "Class SFXGame.BioWaypointSet" },	// 1963
+	{ 1964, "Class SFXGame.SFXAnimNotify_RaceWwiseEvent" },	// 1964
+	{ 1965, "Class SFXGame.RvrAnimNotifyClientEffect" },	// 1965
+	{ 1966, "Class SFXGame.RvrClientEffectActor" },	// 1966
+	{ 1967, "Class SFXGame.RvrClientEffectSpawnable" },	// 1967
+	{ 1968, "Class SFXGame.RvrClientEffectComponent" },	// 1968
+	{ 1969, "Class SFXGame.RvrClientEffectInterface" },	// 1969
+	{ 1970, "Class SFXGame.RvrClientEffect" },	// 1970
+	{ 1971, "Class SFXGame.RvrClientEffectByImpactMaterial" },	// 1971
+	{ 1972, "Class SFXGame.RvrClientEffectInstanceConstant" },	// 1972
+	{ 1973, "Class SFXGame.RvrClientEffectMulti" },	// 1973
+	{ 1974, "Class SFXGame.RvrClientEffectManager" },	// 1974
+	{ 1975, "Class SFXGame.RvrClientEffectModule" },	// 1975
+	{ 1976, "Class SFXGame.RvrCEffectModuleCameraShake" },	// 1976
+	{ 1977, "Class SFXGame.RvrCEffectModuleEffectsMaterial" },	// 1977
+	{ 1978, "Class SFXGame.RvrCEffectModuleEmitter" },	// 1978
+	{ 1979, "Class SFXGame.RvrCEffectModuleFramebuffer" },	// 1979
+	{ 1980, "Class SFXGame.RvrCEffectModuleLensFlare" },	// 1980
+	{ 1981, "Class SFXGame.RvrCEffectModuleLifetime" },	// 1981
+	{ 1982, "Class SFXGame.RvrCEffectModuleLight" },	// 1982
+	{ 1983, "Class SFXGame.RvrCEffectModuleLocation" },	// 1983
+	{ 1984, "Class SFXGame.RvrCEffectModuleMeta" },	// 1984
+	{ 1985, "Class SFXGame.RvrCEffectModuleParameters" },	// 1985
+	{ 1986, "Class SFXGame.RvrCEffectModuleRadialBlur" },	// 1986
+	{ 1987, "Class SFXGame.RvrCEffectModuleSkelMesh" },	// 1987
+	{ 1988, "Class SFXGame.RvrCEffectModuleSound" },	// 1988
+	{ 1989, "Class SFXGame.RvrCEffectModuleSpawnActor" },	// 1989
+	{ 1990, "Class SFXGame.RvrClientEffectModuleInstance" },	// 1990
+	{ 1991, "Class SFXGame.RvrCEffectModuleCameraShakeInstance" },	// 1991
+	{ 1992, "Class SFXGame.RvrCEffectModuleEffectsMaterialInstance" },	// 1992
+	{ 1993, "Class SFXGame.RvrCEffectModuleEmitterInstance" },	// 1993
+	{ 1994, "Class SFXGame.RvrCEffectModuleFramebufferInstance" },	// 1994
+	{ 1995, "Class SFXGame.RvrCEffectModuleLensFlareInstance" },	// 1995
+	{ 1996, "Class SFXGame.RvrCEffectModuleLifetimeInstance" },	// 1996
+	{ 1997, "Class SFXGame.RvrCEffectModuleLightInstance" },	// 1997
+	{ 1998, "Class SFXGame.RvrCEffectModuleLocationInstance" },	// 1998
+	{ 1999, "Class SFXGame.RvrCEffectModuleMetaInstance" },	// 1999
+	{ 2000, "Class SFXGame.RvrCEffectModuleParametersInstance" },	// 2000
+	{ 2001, "Class SFXGame.RvrCEffectModuleRadialBlurInstance" },	// 2001
+	{ 2002, "Class SFXGame.RvrCEffectModuleSkelMeshInstance" },	// 2002
+	{ 2003, "Class SFXGame.RvrCEffectModuleSoundInstance" },	// 2003
+	{ 2004, "Class SFXGame.RvrCEffectModuleSpawnActorInstance" },	// 2004
+	{ 2005, "Class SFXGame.RvrClientEffectPointLight" },	// 2005
+	{ 2006, "Class SFXGame.RvrClientEffectPool" },	// 2006
+	{ 2007, "Class SFXGame.RvrClientEffectTrigger" },	// 2007
+	{ 2008, "Class SFXGame.RvrComponentPCNetClientEffects" },	// 2008
+	{ 2009, "Class SFXGame.RvrPhysicalMaterialProperty" },	// 2009
+	{ 2010, "Class SFXGame.RvrSeqAct_ActivateClientEffect" },	// 2010
+	{ 2011, "Class SFXGame.RvrSeqAct_SpawnClientEffect" },	// 2011
+	{ 2012, "Class SFXGame.RvrSeqAct_StoppableClientEffect" },	// 2012
+	{ 2013, "Class SFXGame.SFXInterpTrackClientEffect" },	// 2013
+	{ 2014, "Class SFXGame.SFXInterpTrackInstClientEffect" },	// 2014
+	{ 2015, "Class SFXOnlineFoundation.SFXOnlineEvent" },	// 2015
+	{ 2016, "Class SFXOnlineFoundation.SFXOnlineEvent_Integer" },	// 2016
+	{ 2017, "Class SFXOnlineFoundation.SFXOnlineEvent_Invite" },	// 2017
+	{ 2018, "Class SFXOnlineFoundation.SFXOnlineEvent_PlatformKeyboardUI" },	// 2018
+	{ 2019, "Class SFXOnlineFoundation.SFXOnlineEvent_QuickMatch" },	// 2019
+	{ 2020, "Class SFXOnlineFoundation.SFXOnlineEvent_SeenPlayer" },	// 2020
+	{ 2021, "Class SFXOnlineFoundation.SFXOnlineEvent_String" },	// 2021
+	{ 2022, "Class SFXOnlineFoundation.SFXOnlineEvent_Notification" },	// 2022
+	{ 2023, "Class SFXOnlineFoundation.SFXOnlineEvent_Tick" },	// 2023
+	{ 2024, "Class SFXOnlineFoundation.SFXOnlineEventList" },	// 2024
+	{ 2025, "Class SFXOnlineFoundation.ISFXOnlineComponent" },	// 2025
+	{ 2026, "Class SFXOnlineFoundation.ISFXOnlineComponentAchievement" },	// 2026
+	{ 2027, "Class SFXOnlineFoundation.ISFXOnlineComponentAPI" },	// 2027
+	{ 2028, "Class SFXOnlineFoundation.ISFXOnlineComponentCommerce" },	// 2028
+	{ 2029, "Class SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar" },	// 2029
+	{ 2030, "Class SFXOnlineFoundation.ISFXOnlineComponentGame" },	// 2030
+	{ 2031, "Class SFXOnlineFoundation.ISFXOnlineComponentGameEntryFlow" },	// 2031
+	{ 2032, "Class SFXOnlineFoundation.ISFXOnlineComponentGameFlow" },	// 2032
+	{ 2033, "Class SFXOnlineFoundation.ISFXOnlineComponentLeaderboard" },	// 2033
+	{ 2034, "Class SFXOnlineFoundation.ISFXOnlineComponentLogin" },	// 2034
+	{ 2035, "Class SFXOnlineFoundation.ISFXOnlineComponentMatchMakingBot" },	// 2035
+	{ 2036, "Class SFXOnlineFoundation.ISFXOnlineComponentMessaging" },	// 2036
+	{ 2037, "Class SFXOnlineFoundation.ISFXOnlineComponentNotification" },	// 2037
+	{ 2038, "Class SFXOnlineFoundation.ISFXOnlineComponentPlatform" },	// 2038
+	{ 2039, "Class SFXOnlineFoundation.ISFXOnlineComponentStats" },	// 2039
+	{ 2040, "Class SFXOnlineFoundation.ISFXOnlineComponentTelemetry" },	// 2040
+	{ 2041, "Class SFXOnlineFoundation.ISFXOnlineComponentUserInterface" },	// 2041
+	{ 2042, "Class SFXOnlineFoundation.SFXOnlineDefine" },	// 2042
+	{ 2043, "Class SFXOnlineFoundation.SFXOnlineComponentGameFlow" },	// 2043
+	{ 2044, "Class SFXOnlineFoundation.SFXOnlineComponentHTTPManager" },	// 2044
+	{ 2045, "Class SFXOnlineFoundation.SFXOnlineComponentImageManager" },	// 2045
+	{ 2046, "Class SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx" },	// 2046
+	{ 2047, "Class SFXOnlineFoundation.SFXOnlineComponentUnrealSystem" },	// 2047
+	{ 2048, "Class SFXOnlineFoundation.SFXOnlineComponentVoiceInterface" },	// 2048
+	{ 2049, "Class SFXOnlineFoundation.SFXOnlineComponentXMLParser" },	// 2049
+	{ 2050, "Class SFXOnlineFoundation.SFXOnlineComponentCoordinator" },	// 2050
+	{ 2051, "Class SFXOnlineFoundation.SFXOnlineEventNotifier" },	// 2051
+	{ 2052, "Class SFXOnlineFoundation.SFXOnlineHTTPRequest" },	// 2052
+	{ 2053, "Class SFXOnlineFoundation.SFXOnlineSubsystem" },	// 2053
+	{ 2054, "Class SFXOnlineFoundation.sfxonlinecomponentachievementpc" },	// 2054
+	{ 2055, "Class SFXOnlineFoundation.SFXOnlineComponentOrigin" },	// 2055
+	{ 2056, "Class SFXOnlineFoundation.SFXOnlineComponentPlatformPC" },	// 2056
+	{ 2057, "Class SFXOnlineFoundation.SFXOnlineComponentAchievementXenon" },	// 2057
+	{ 2058, "Class SFXOnlineFoundation.SFXOnlineComponentAvatarAwardXenon" },	// 2058
+	{ 2059, "Class SFXOnlineFoundation.SFXOnlineComponentPlatformXenon" },	// 2059
+	{ 2060, "Class SFXOnlineFoundation.SFXOnlineComponentXenonLiveParty" },	// 2060
+	{ 2061, "Class SFXOnlineFoundation.SFXOnlineComponentAchievementPS3" },	// 2061
+	{ 2062, "Class SFXOnlineFoundation.SFXOnlineComponentPlatformPS3" },	// 2062
+	{ 2063, "Class SFXOnlineFoundation.SFXOnlineBlazeJobUtilities" },	// 2063
+	{ 2064, "Class SFXOnlineFoundation.SFXOnlineComponentBlaze" },	// 2064
+	{ 2065, "Class SFXOnlineFoundation.SFXOnlineComponentBlazeGame" },	// 2065
+	{ 2066, "Class SFXOnlineFoundation.SFXOnlineComponentBlazeGameXenon" },	// 2066
+	{ 2067, "Class SFXOnlineFoundation.SFXOnlineComponentBlazeHub" },	// 2067
+	{ 2068, "Class SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard" },	// 2068
+	{ 2069, "Class SFXOnlineFoundation.SFXOnlineComponentBlazeLogin" },	// 2069
+	{ 2070, "Class SFXOnlineFoundation.SFXOnlineComponentBlazeLoginPC" },	// 2070
+	{ 2071, "Class SFXOnlineFoundation.SFXOnlineComponentBlazeLoginPS3" },	// 2071
+	{ 2072, "Class SFXOnlineFoundation.SFXOnlineComponentBlazeLoginXenon" },	// 2072
+	{ 2073, "Class SFXOnlineFoundation.SFXOnlineComponentBlazeMessaging" },	// 2073
+	{ 2074, "Class SFXOnlineFoundation.SFXOnlineComponentBlazeNotification" },	// 2074
+	{ 2075, "Class SFXOnlineFoundation.SFXOnlineComponentBlazeStats" },	// 2075
+	{ 2076, "Class SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar" },	// 2076
+	{ 2077, "Class SFXOnlineFoundation.SFXOnlineComponentBlazeTelemetry" },	// 2077
+	{ 2078, "Class SFXOnlineFoundation.SFXOnlineComponentJobQueue" },	// 2078
+	{ 2079, "Class SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer" },	// 2079
+	{ 2080, "Class SFXOnlineFoundation.SFXOnlineGameSearch" },	// 2080
+	{ 2081, "Class SFXOnlineFoundation.SFXOnlineGameSettings" },	// 2081
+	{ 2082, "Class SFXOnlineFoundation.SFXOnlineJob" },	// 2082
+	{ 2083, "Class SFXOnlineFoundation.SFXOnlineJobGameReporting" },	// 2083
+	{ 2084, "Class SFXOnlineFoundation.SFXOnlineJobGaWHTTPRequest" },	// 2084
+	{ 2085, "Class SFXOnlineFoundation.SFXOnlineJobGaWHTTPGetMessages" },	// 2085
+	{ 2086, "Class SFXOnlineFoundation.SFXOnlineJobGaWHTTPGetRatings" },	// 2086
+	{ 2087, "Class SFXOnlineFoundation.SFXOnlineJobGaWHTTPIncreaseRatings" },	// 2087
+	{ 2088, "Class SFXOnlineFoundation.SFXOnlineJobGaWHTTPSendMessage" },	// 2088
+	{ 2089, "Class SFXOnlineFoundation.SFXOnlineJobGaWHTTPTouchMessages" },	// 2089
+	{ 2090, "Class SFXOnlineFoundation.SFXOnlineJobGetAuthToken" },	// 2090
+	{ 2091, "Class SFXOnlineFoundation.SFXOnlineJobGetLeaderboardData" },	// 2091
+	{ 2092, "Class SFXOnlineFoundation.SFXOnlineJobGetLeaderboardList" },	// 2092
+	{ 2093, "Class SFXOnlineFoundation.SFXOnlineJobGetStatsGroupList" },	// 2093
+	{ 2094, "Class SFXOnlineFoundation.SFXOnlineJobHTTPRequest" },	// 2094
+	{ 2095, "Class SFXOnlineFoundation.SFXOnlineJobImageRequest" },	// 2095
+	{ 2096, "Class SFXOnlineFoundation.SFXOnlineJobImportFriendListToBlaze" },	// 2096
+	{ 2097, "Class SFXOnlineFoundation.SFXOnlineJobLoadSettings" },	// 2097
+	{ 2098, "Class SFXOnlineFoundation.SFXOnlineJobPurgeMessages" },	// 2098
+	{ 2099, "Class SFXOnlineFoundation.SFXOnlineJobReceiveMessage" },	// 2099
+	{ 2100, "Class SFXOnlineFoundation.SFXOnlineJobSaveSettings" },	// 2100
+	{ 2101, "Class SFXOnlineFoundation.SFXOnlineJobSendMessage" },	// 2101
+	{ 2102, "Class SFXOnlineFoundation.SFXOnlineNetConnection" },	// 2102
+	{ 2103, "Class SFXOnlineFoundation.SFXOnlineNetDriver" },	// 2103
+	{ 2104, "Class SFXOnlineFoundation.SFXOnlineComponentCommerce" },	// 2104
+	{ 3607, "Function Core.Commandlet.Main" },	// 2105
+	{ 3622, "Function Core.DistributionFloat.GetFloatValue" },	// 2106
+	{ 3634, "Function Core.DistributionVector.GetVectorValue" },	// 2107
+	{ 3644, "Class SFXGame.SFXPatchLinkerLoad" },	// 2108
+	{ 3708, "Function Engine.Actor.ForceUpdateComponents" },	// 2109
+	{ 3711, "Function Engine.Actor.ConsoleCommand" },	// 2110
+	{ 3715, "Function Engine.Actor.Sleep" },	// 2111
+	{ 3717, "Function Engine.Actor.FinishAnim" },	// 2112
+	{ 3719, "Function Engine.Actor.SetCollision" },	// 2113
+	{ 3723, "Function Engine.Actor.SetCollisionSize" },	// 2114
+	{ 3726, "Function Engine.Actor.SetCollisionType" },	// 2115
+	{ 3728, "Function Engine.Actor.SetDrawScale" },	// 2116
+	{ 3730, "Function Engine.Actor.SetDrawScale3D" },	// 2117
+	{ 3732, "Function Engine.Actor.Move" },	// 2118
+	{ 3735, "Function Engine.Actor.SetLocation" },	// 2119
+	{ 3739, "Function Engine.Actor.SetRotation" },	// 2120
+	{ 3742, "Function Engine.Actor.MovingWhichWay" },	// 2121
+	{ 3745, "Function Engine.Actor.SetZone" },	// 2122
+	{ 3747, "Function Engine.Actor.SetRelativeRotation" },	// 2123
+	{ 3750, "Function Engine.Actor.SetRelativeLocation" },	// 2124
+	{ 3753, "Function Engine.Actor.SetHardAttach" },	// 2125
+	{ 3755, "Function Engine.Actor.fixedTurn" },	// 2126
+	{ 3760, "Function Engine.Actor.MoveSmooth" },	// 2127
+	{ 3763, "Function Engine.Actor.AutonomousPhysics" },	// 2128
+	{ 3765, "Function Engine.Actor.GetTerminalVelocity" },	// 2129
+	{ 3767, "Function Engine.Actor.SetBase" },	// 2130
+	{ 3772, "Function Engine.Actor.SetOwner" },	// 2131
+	{ 3774, "Function Engine.Actor.FindBase" },	// 2132
+	{ 3775, "Function Engine.Actor.IsBasedOn" },	// 2133
+	{ 3778, "Function Engine.Actor.GetBaseMost" },	// 2134
+	{ 3780, "Function Engine.Actor.IsOwnedBy" },	// 2135
+	{ 3783, "Function Engine.Actor.ReplicatedEvent" },	// 2136
+	{ 3785, "Function Engine.Actor.ReplicatedDataBinding" },	// 2137
+	{ 3787, "Function Engine.Actor.SetForcedInitialReplicatedProperty" },	// 2138
+	{ 3790, "Function Engine.Actor.Vect2BP" },	// 2139
+	{ 3800, "Function Engine.Actor.BP2Vect" },	// 2140
+	{ 3803, "Function Engine.Actor.SetBasedPosition" },	// 2141
+	{ 3807, "Function Engine.Actor.GetBasedPosition" },	// 2142
+	{ 3810, "Function Engine.Actor.FlushPersistentDebugLines" },	// 2143
+	{ 3811, "Function Engine.Actor.DrawDebugLine" },	// 2144
+	{ 3818, "Function Engine.Actor.DrawDebugPoint" },	// 2145
+	{ 3823, "Function Engine.Actor.DrawDebugBox" },	// 2146
+	{ 3830, "Function Engine.Actor.DrawDebugStar" },	// 2147
+	{ 3837, "Function Engine.Actor.DrawDebugCoordinateSystem" },	// 2148
+	{ 3842, "Function Engine.Actor.DrawDebugSphere" },	// 2149
+	{ 3850, "Function Engine.Actor.DrawDebugCylinder" },	// 2150
+	{ 3859, "Function Engine.Actor.DrawDebugCone" },	// 2151
+	{ 3868, "Function Engine.Actor.DrawDebugString" },	// 2152
+	{ 3874, "Function Engine.Actor.DrawDebugFrustrum" },	// 2153
+	{ 3880, "Function Engine.Actor.FlushDebugStrings" },	// 2154
+	{ 3881, "Function Engine.Actor.ChartData" },	// 2155
+	{ 3884, "Function Engine.Actor.SetHidden" },	// 2156
+	{ 3886, "Function Engine.Actor.SetOnlyOwnerSee" },	// 2157
+	{ 3888, "Function Engine.Actor.SetPhysics" },	// 2158
+	{ 3890, "Function Engine.Actor.Clock" },	// 2159
+	{ 3892, "Function Engine.Actor.UnClock" },	// 2160
+	{ 3894, "Function Engine.Actor.AttachComponent" },	// 2161
+	{ 3896, "Function Engine.Actor.DetachComponent" },	// 2162
+	{ 3898, "Function Engine.Actor.ReattachComponent" },	// 2163
+	{ 3900, "Function Engine.Actor.SetTickGroup" },	// 2164
+	{ 3902, "Function Engine.Actor.SetTickIsDisabled" },	// 2165
+	{ 3904, "Function Engine.Actor.Destroyed" },	// 2166
+	{ 3905, "Function Engine.Actor.GainedChild" },	// 2167
+	{ 3907, "Function Engine.Actor.LostChild" },	// 2168
+	{ 3909, "Function Engine.Actor.Tick" },	// 2169
+	{ 3911, "Function Engine.Actor.Timer" },	// 2170
+	{ 3912, "Function Engine.Actor.HitWall" },	// 2171
+	{ 3916, "Class Engine.SeqEvent_HitWall" },	// 2172
+	{ 3917, "Function Engine.Actor.Falling" },	// 2173
+	{ 3918, "Function Engine.Actor.Landed" },	// 2174
+	{ 3921, "Function Engine.Actor.PhysicsVolumeChange" },	// 2175
+	{ 3923, "Function Engine.Actor.Touch" },	// 2176
+	{ 3928, "Function Engine.Actor.PostTouch" },	// 2177
+	{ 3930, "Function Engine.Actor.UnTouch" },	// 2178
+	{ 3932, "Function Engine.Actor.Bump" },	// 2179
+	{ 3936, "Function Engine.Actor.BaseChange" },	// 2180
+	{ 3937, "Function Engine.Actor.Attach" },	// 2181
+	{ 3939, "Function Engine.Actor.Detach" },	// 2182
+	{ 3941, "Function Engine.Actor.SpecialHandling" },	// 2183
+	{ 3944, "Function Engine.Actor.CollisionChanged" },	// 2184
+	{ 3945, "Function Engine.Actor.EncroachingOn" },	// 2185
+	{ 3948, "Function Engine.Actor.EncroachedBy" },	// 2186
+	{ 3950, "Function Engine.Actor.RanInto" },	// 2187
+	{ 3952, "Function Engine.Actor.OnWakeRBPhysics" },	// 2188
+	{ 3953, "Function Engine.Actor.OnSleepRBPhysics" },	// 2189
+	{ 3954, "Function Engine.Actor.ClampRotation" },	// 2190
+	{ 3960, "Function Engine.Actor.OverRotated" },	// 2191
+	{ 3964, "Function Engine.Actor.UsedBy" },	// 2192
+	{ 3967, "Function Engine.Actor.FellOutOfWorld" },	// 2193
+	{ 3969, "Function Engine.Actor.OutsideWorldBounds" },	// 2194
+	{ 3970, "Function Engine.Actor.VolumeBasedDestroy" },	// 2195
+	{ 3972, "Function Engine.Actor.Trace" },	// 2196
+	{ 3982, "Function Engine.Actor.TraceComponent" },	// 2197
+	{ 3992, "Function Engine.Actor.PointCheckComponent" },	// 2198
+	{ 3997, "Function Engine.Actor.FastTrace" },	// 2199
+	{ 4003, "Function Engine.Actor.TraceAllPhysicsAssetInteractions" },	// 2200
+	{ 4011, "Function Engine.Actor.FindSpot" },	// 2201
+	{ 4015, "Function Engine.Actor.ContainsPoint" },	// 2202
+	{ 4018, "Function Engine.Actor.IsOverlapping" },	// 2203
+	{ 4021, "Function Engine.Actor.GetComponentsBoundingBox" },	// 2204
+	{ 4023, "Function Engine.Actor.GetBoundingCylinder" },	// 2205
+	{ 4026, "Function Engine.Actor.Spawn" },	// 2206
+	{ 4036, "Function Engine.Actor.Destroy" },	// 2207
+	{ 4038, "Function Engine.Actor.TornOff" },	// 2208
+	{ 4039, "Function Engine.Actor.SetTimer" },	// 2209
+	{ 4044, "Function Engine.Actor.ClearTimer" },	// 2210
+	{ 4047, "Function Engine.Actor.ClearAllTimers" },	// 2211
+	{ 4049, "Function Engine.Actor.PauseTimer" },	// 2212
+	{ 4053, "Function Engine.Actor.IsTimerActive" },	// 2213
+	{ 4057, "Function Engine.Actor.GetTimerCount" },	// 2214
+	{ 4061, "Function Engine.Actor.GetTimerRate" },	// 2215
+	{ 4065, "Function Engine.Actor.GetRemainingTimeForTimer" },	// 2216
+	{ 4071, "Function Engine.Actor.ModifyTimerTimeDilation" },	// 2217
+	{ 4075, "Function Engine.Actor.ResetTimerTimeDilation" },	// 2218
+	{ 4078, "Function Engine.Actor.CreateAudioComponent" },	// 2219
+	{ 4086, "Function Engine.Actor.PlaySound" },	// 2220
+	{ 4093, "Function Engine.Actor.StopSound" },	// 2221
+	{ 4095, "Function Engine.Actor.MakeNoise" },	// 2222
+	{ 4098, "Function Engine.Actor.PlayerCanSeeMe" },	// 2223
+	{ 4100, "Function Engine.Actor.SuggestTossVelocity" },	// 2224
+	{ 4112, "Function Engine.Actor.GetDestination" },	// 2225
+	{ 4115, "Function Engine.Actor.PreTeleport" },	// 2226
+	{ 4118, "Function Engine.Actor.PostTeleport" },	// 2227
+	{ 4120, "Function Engine.Actor.GetURLMap" },	// 2228
+	{ 4122, "Function Engine.Actor.AllActors" },	// 2229
+	{ 4126, "Function Engine.Actor.DynamicActors" },	// 2230
+	{ 4130, "Function Engine.Actor.ChildActors" },	// 2231
+	{ 4133, "Function Engine.Actor.BasedActors" },	// 2232
+	{ 4136, "Function Engine.Actor.TouchingActors" },	// 2233
+	{ 4140, "Function Engine.Actor.TraceActors" },	// 2234
+	{ 4150, "Function Engine.Actor.VisibleActors" },	// 2235
+	{ 4155, "Function Engine.Actor.VisibleCollidingActors" },	// 2236
+	{ 4165, "Function Engine.Actor.CollidingActors" },	// 2237
+	{ 4173, "Function Engine.Actor.OverlappingActors" },	// 2238
+	{ 4179, "Function Engine.Actor.ComponentList" },	// 2239
+	{ 4182, "Function Engine.Actor.AllOwnedComponents" },	// 2240
+	{ 4185, "Function Engine.Actor.LocalPlayerControllers" },	// 2241
+	{ 4188, "Function Engine.Actor.GetALocalPlayerController" },	// 2242
+	{ 4190, "Function Engine.Actor.MoveActorToFloor" },	// 2243
+	{ 4192, "Function Engine.Actor.FindActorsOfClass" },	// 2244
+	{ 4198, "Function Engine.Actor.PreBeginPlay" },	// 2245
+	{ 4207, "Function Engine.Actor.BroadcastLocalizedMessage" },	// 2246
+	{ 4213, "Class Engine.LocalMessage" },	// 2247
+	{ 4214, "Function Engine.Actor.BroadcastLocalizedTeamMessage" },	// 2248
+	{ 4221, "Function Engine.Actor.PostBeginPlay" },	// 2249
+	{ 4222, "Function Engine.Actor.SetInitialState" },	// 2250
+	{ 4225, "Function Engine.Actor.ConstraintBrokenNotify" },	// 2251
+	{ 4229, "Function Engine.Actor.NotifySkelControlBeyondLimit" },	// 2252
+	{ 4231, "Function Engine.Actor.StopsProjectile" },	// 2253
+	{ 4236, "Function Engine.Actor.HurtRadius" },	// 2254
+	{ 4259, "Function Engine.Actor.KilledBy" },	// 2255
+	{ 4261, "Function Engine.Actor.TakeDamage" },	// 2256
+	{ 4272, "Function Engine.Actor.GetModule" },	// 2257
+	{ 4273, "Function Engine.Actor.HealDamage" },	// 2258
+	{ 4278, "Function Engine.Actor.TakeRadiusDamage" },	// 2259
+	{ 4297, "Function Engine.Actor.CheckHitInfo" },	// 2260
+	{ 4308, "Function Engine.Actor.GetGravityZ" },	// 2261
+	{ 4310, "Function Engine.Actor.DebugFreezeGame" },	// 2262
+	{ 4312, "Function Engine.Actor.CheckForErrors" },	// 2263
+	{ 4314, "Function Engine.Actor.BecomeViewTarget" },	// 2264
+	{ 4316, "Function Engine.Actor.EndViewTarget" },	// 2265
+	{ 4318, "Function Engine.Actor.CalcCamera" },	// 2266
+	{ 4327, "Function Engine.Actor.GetItemName" },	// 2267
+	{ 4331, "Function Engine.Actor.GetHumanReadableName" },	// 2268
+	{ 4333, "Function Engine.Actor.ReplaceText" },	// 2269
+	{ 4339, "Function Engine.Actor.GetLocalString" },	// 2270
+	{ 4344, "Function Engine.Actor.MatchStarting" },	// 2271
+	{ 4345, "Function Engine.Actor.GetDebugName" },	// 2272
+	{ 4347, "Function Engine.Actor.DisplayDebug" },	// 2273
+	{ 4380, "Function Engine.Actor.GetPhysicsName" },	// 2274
+	{ 4383, "Function Engine.Actor.ModifyHearSoundComponent" },	// 2275
+	{ 4385, "Function Engine.Actor.GetFaceFXAudioComponent" },	// 2276
+	{ 4387, "Function Engine.Actor.Reset" },	// 2277
+	{ 4388, "Function Engine.Actor.IsInVolume" },	// 2278
+	{ 4392, "Function Engine.Actor.IsInPain" },	// 2279
+	{ 4397, "Function Engine.Actor.PlayTeleportEffect" },	// 2280
+	{ 4400, "Function Engine.Actor.CanSplash" },	// 2281
+	{ 4402, "Function Engine.Actor.ApplyFluidSurfaceImpact" },	// 2282
+	{ 4412, "Function Engine.Actor.CheckMaxEffectDistance" },	// 2283
+	{ 4422, "Function Engine.Actor.EffectIsRelevant" },	// 2284
+	{ 4437, "Function Engine.Actor.TriggerEventClass" },	// 2285
+	{ 4447, "Function Engine.Actor.ActivateEventClass" },	// 2286
+	{ 4448, "Function Engine.Actor.ReceivedNewEvent" },	// 2287
+	{ 4450, "Function Engine.Actor.TriggerGlobalEventClass" },	// 2288
+	{ 4465, "Function Engine.SequenceEvent.CheckActivate" },	// 2289
+	{ 4478, "Function Engine.Actor.FindEventsOfClass" },	// 2290
+	{ 4489, "Function Engine.Actor.ClearLatentAction" },	// 2291
+	{ 4496, "Function Engine.Actor.OnDestroy" },	// 2292
+	{ 4501, "Class Engine.SeqAct_Destroy" },	// 2293
+	{ 4504, "Function Engine.Actor.ForceNetRelevant" },	// 2294
+	{ 4508, "Function Engine.Actor.SetNetUpdateTime" },	// 2295
+	{ 4510, "Function Engine.Actor.ShutDown" },	// 2296
+	{ 4514, "Function Engine.Actor.PrestreamTextures" },	// 2297
+	{ 4518, "Function Engine.Actor.TexturePrestreamIsRequired" },	// 2298
+	{ 4520, "Function Engine.Actor.BlockForTextureStreaming" },	// 2299
+	{ 4521, "Function Engine.Actor.OnModifyHealth" },	// 2300
+	{ 4530, "Function Engine.Actor.OnTeleport" },	// 2301
+	{ 4541, "Function Engine.Actor.OnSetVelocity" },	// 2302
+	{ 4545, "Class Engine.SeqAct_SetVelocity" },	// 2303
+	{ 4550, "Function Engine.Actor.OnSetBlockRigidBody" },	// 2304
+	{ 4555, "Function Engine.Actor.OnSetPhysics" },	// 2305
+	{ 4559, "Function Engine.Actor.OnChangeCollision" },	// 2306
+	{ 4569, "Function Engine.Actor.OnToggleHidden" },	// 2307
+	{ 4574, "Class Engine.SeqAct_ToggleHidden" },	// 2308
+	{ 4577, "Function Engine.Actor.BioDoKismetAttachment" },	// 2309
+	{ 4579, "Class Engine.SeqAct_AttachToActor" },	// 2310
+	{ 4595, "Function Engine.Actor.BioEnqueueDoKismetAttachment" },	// 2311
+	{ 4604, "Function Engine.Actor.OnAttachToActor" },	// 2312
+	{ 4612, "Function Engine.Actor.DoKismetAttachment" },	// 2313
+	{ 4620, "Function Engine.Actor.OnAnimEnd" },	// 2314
+	{ 4624, "Function Engine.Actor.OnAnimPlay" },	// 2315
+	{ 4626, "Function Engine.Actor.BeginAnimControl" },	// 2316
+	{ 4628, "Function Engine.Actor.SetAnimPosition" },	// 2317
+	{ 4635, "Function Engine.Actor.FinishAnimControl" },	// 2318
+	{ 4637, "Function Engine.Actor.BeginMovementControl" },	// 2319
+	{ 4639, "Function Engine.Actor.BioRestoreFromStasis" },	// 2320
+	{ 4640, "Function Engine.Actor.FinishMovementControl" },	// 2321
+	{ 4642, "Function Engine.Actor.PlayActorFaceFXAnim" },	// 2322
+	{ 4648, "Function Engine.Actor.StopActorFaceFXAnim" },	// 2323
+	{ 4649, "Function Engine.Actor.SetMorphWeight" },	// 2324
+	{ 4652, "Function Engine.Actor.SetSkelControlScale" },	// 2325
+	{ 4655, "Function Engine.Actor.IsActorPlayingFaceFXAnim" },	// 2326
+	{ 4657, "Function Engine.Actor.CanActorPlayFaceFXAnim" },	// 2327
+	{ 4659, "Function Engine.Actor.GetActorFaceFXAsset" },	// 2328
+	{ 4661, "Function Engine.Actor.IsStationary" },	// 2329
+	{ 4663, "Function Engine.Actor.GetActorEyesViewPoint" },	// 2330
+	{ 4666, "Function Engine.Actor.IsPlayerOwned" },	// 2331
+	{ 4668, "Function Engine.Actor.PawnBaseDied" },	// 2332
+	{ 4669, "Function Engine.Actor.GetTeamNum" },	// 2333
+	{ 4671, "Function Engine.Actor.ScriptGetTeamNum" },	// 2334
+	{ 4673, "Function Engine.Actor.GetLocationStringFor" },	// 2335
+	{ 4676, "Function Engine.Actor.NotifyLocalPlayerTeamReceived" },	// 2336
+	{ 4677, "Function Engine.Actor.FindGoodEndView" },	// 2337
+	{ 4680, "Function Engine.Actor.GetTargetLocation" },	// 2338
+	{ 4684, "Function Engine.Actor.SpawnedByKismet" },	// 2339
+	{ 4685, "Function Engine.Actor.PickedUpBy" },	// 2340
+	{ 4687, "Function Engine.Actor.InterpolationStarted" },	// 2341
+	{ 4690, "Function Engine.Actor.InterpolationFinished" },	// 2342
+	{ 4692, "Function Engine.Actor.InterpolationChanged" },	// 2343
+	{ 4694, "Function Engine.Actor.RigidBodyCollision" },	// 2344
+	{ 4711, "Function Engine.Actor.OnRanOver" },	// 2345
+	{ 4715, "Function Engine.Actor.SetHUDLocation" },	// 2346
+	{ 4717, "Function Engine.Actor.NativePostRenderFor" },	// 2347
+	{ 4722, "Function Engine.Actor.PostRenderFor" },	// 2348
+	{ 4727, "Function Engine.Actor.RootMotionModeChanged" },	// 2349
+	{ 4729, "Function Engine.Actor.RootMotionExtracted" },	// 2350
+	{ 4732, "Function Engine.Actor.PostInitAnimTree" },	// 2351
+	{ 4734, "Function Engine.Actor.GetPackageGuid" },	// 2352
+	{ 4737, "Function Engine.Actor.OnRigidBodySpringOverextension" },	// 2353
+	{ 4739, "Function Engine.Actor.ExceededPhysicsThreshold" },	// 2354
+	{ 4743, "Function Engine.Actor.SetActive" },	// 2355
+	{ 4745, "Function Engine.Actor.IsInPersistentLevel" },	// 2356
+	{ 4747, "Function Engine.Actor.GetAimFrictionExtent" },	// 2357
+	{ 4752, "Function Engine.Actor.GetAimAdhesionExtent" },	// 2358
+	{ 4757, "Function Engine.Actor.PlayParticleEffect" },	// 2359
+	{ 4759, "Function Engine.Actor.TrailsNotify" },	// 2360
+	{ 4761, "Function Engine.Actor.TrailsNotifyTick" },	// 2361
+	{ 4763, "Function Engine.Actor.TrailsNotifyEnd" },	// 2362
+	{ 4765, "Function Engine.Actor.SupportsKismetModification" },	// 2363
+	{ 4769, "Function Engine.Actor.AnimTreeUpdated" },	// 2364
+	{ 4771, "Function Engine.Actor.PostDemoRewind" },	// 2365
+	{ 4772, "Function Engine.Actor.ReplicationEnded" },	// 2366
+	{ 4773, "Function Engine.Actor.IsOwningClient" },	// 2367
+	{ 4775, "Function Engine.Actor.IsServer" },	// 2368
+	{ 4777, "Function Engine.Actor.IsClient" },	// 2369
+	{ 4779, "Function Engine.Actor.GetAvoidanceVector" },	// 2370
+	{ 4789, "Function Engine.Actor.WillOverlap" },	// 2371
+	{ 4798, "Function Engine.Actor.StopAllSounds" },	// 2372
+	{ 4799, "Function Engine.Actor.AddSFXModule" },	// 2373
+	{ 4802, "Function Engine.Actor.RemoveSFXModule" },	// 2374
+	{ 4804, "Function Engine.Actor.RemoveSFXModuleIndex" },	// 2375
+	{ 4806, "Function Engine.Actor.GetPowerResistance" },	// 2376
+	{ 4815, "Function Engine.Actor.ImpactWithPower" },	// 2377
+	{ 4824, "Function Engine.Actor.GetPrimarySkelMeshComponent" },	// 2378
+	{ 4826, "Function Engine.Actor.GetHeadSkelMeshComponent" },	// 2379
+	{ 4828, "Function Engine.Actor.SFXSetAudioComponentRTPCs" },	// 2380
+	{ 4830, "Function Engine.Actor.PlayFootStepSound" },	// 2381
+	{ 4832, "Function Engine.Actor.BioApplyStasis" },	// 2382
+	{ 4834, "Function Engine.Actor.BioBaseRemovedFromWorld" },	// 2383
+	{ 4835, "Function Engine.Actor.LocalToWorld" },	// 2384
+	{ 5003, "Class Engine.AccessControl" },	// 2385
+	{ 5012, "Class Engine.Admin" },	// 2386
+	{ 5133, "Function Engine.ActorFactory.PostCreateActor" },	// 2387
+	{ 5164, "Class Engine.EmitterSpawnable" },	// 2388
+	{ 5181, "Class Engine.KAssetSpawnable" },	// 2389
+	{ 5479, "Class Engine.ActorFactorySkeletalMeshCinematic" },	// 2390
+	{ 5481, "Class Engine.ActorFactorySkeletalMeshMAT" },	// 2391
+	{ 5593, "Class Engine.SeqEvent_Death" },	// 2392
+	{ 5875, "Class Engine.SeqAct_ToggleGodMode" },	// 2393
+	{ 5878, "Class Engine.SeqAct_ToggleAffectedByHitEffects" },	// 2394
+	{ 6462, "Class Engine.SeqAct_ControlMovieTexture" },	// 2395
+	{ 6502, "Class Engine.OnlineAccountInterface" },	// 2396
+	{ 6504, "Class Engine.OnlinePlayerInterface" },	// 2397
+	{ 6506, "Class Engine.OnlinePlayerInterfaceEx" },	// 2398
+	{ 6508, "Class Engine.OnlineSystemInterface" },	// 2399
+	{ 6510, "Class Engine.OnlineGameInterface" },	// 2400
+	{ 6512, "Class Engine.OnlineContentInterface" },	// 2401
+	{ 6514, "Class Engine.OnlineVoiceInterface" },	// 2402
+	{ 6516, "Class Engine.OnlineStatsInterface" },	// 2403
+	{ 6518, "Class Engine.OnlineNewsInterface" },	// 2404
+	{ 6520, "Class Engine.OnlinePartyChatInterface" },	// 2405
+	{ 7501, "Class Engine.CoverReplicator" },	// 2406
+	{ 7530, "Class Engine.GameMessage" },	// 2407
+	{ 7662, "Class Engine.Scoreboard" },	// 2408
+	{ 7787, "Class Engine.DmgType_Suicided" },	// 2409
+	{ 8748, "Class Engine.SeqAct_ToggleInput" },	// 2410
+	{ 8833, "Class Engine.SeqAct_ForceFeedback" },	// 2411
+	{ 8851, "Class Engine.SeqAct_ToggleCinematicMode" },	// 2412
+	{ 8886, "Class Engine.SeqAct_ConsoleCommand" },	// 2413
+	{ 9204, "Class Engine.SeqAct_FlyThroughHasEnded" },	// 2414
+	{ 9252, "Class Engine.SeqAct_SetSoundMode" },	// 2415
+	{ 9256, "Function Engine.AudioDevice.SetSoundMode" },	// 2416
+	{ 10328, "Class Engine.AnimNotify_PlayFaceFXAnim" },	// 2417
+	{ 10881, "Function Engine.Volume.Encompasses" },	// 2418
+	{ 10884, "Function Engine.Volume.EncompassesPoint" },	// 2419
+	{ 10887, "Function Engine.Volume.ScriptLineCheck" },	// 2420
+	{ 10892, "Function Engine.Volume.PostBeginPlay" },	// 2421
+	{ 10894, "Function Engine.Volume.GetLocationStringFor" },	// 2422
+	{ 10898, "Function Engine.Volume.DisplayDebug" },	// 2423
+	{ 10913, "Function Engine.Volume.OnToggle" },	// 2424
+	{ 10915, "Function Engine.Volume.CollisionChanged" },	// 2425
+	{ 10916, "Function Engine.Volume.ProcessActorSetVolume" },	// 2426
+	{ 11213, "Class Engine.BioLineBloomEffect" },	// 2427
+	{ 11695, "Class Engine.BroadcastHandler" },	// 2428
+	{ 12558, "Class Engine.ColorScaleVolume" },	// 2429
+	{ 14419, "Class Engine.DebugCameraHUD" },	// 2430
+	{ 14461, "Class Engine.DebugCameraInput" },	// 2431
+	{ 14591, "Function Engine.LocalMessage.GetConsoleColor" },	// 2432
+	{ 14611, "Function Engine.LocalMessage.PartiallyDuplicates" },	// 2433
+	{ 15083, "Class Engine.VolumeTimer" },	// 2434
+	{ 15123, "Class Engine.SeqAct_SetDamageInstigator" },	// 2435
+	{ 15215, "Class Engine.DmgType_Crushed" },	// 2436
+	{ 15217, "Class Engine.DmgType_Fell" },	// 2437
+	{ 15220, "Class Engine.DmgType_Telefragged" },	// 2438
+	{ 15402, "Class Engine.DynamicPhysicsVolume" },	// 2439
+	{ 15458, "Class Engine.DynamicSMActor_Spawnable" },	// 2440
+	{ 15467, "Class Engine.DynamicTriggerVolume" },	// 2441
+	{ 15796, "Class Engine.SeqAct_SetParticleSysParam" },	// 2442
+	{ 16280, "Function Engine.LocalMessage.ClientReceive" },	// 2443
+	{ 16287, "Function Engine.LocalMessage.GetString" },	// 2444
+	{ 16296, "Function Engine.LocalMessage.GetColor" },	// 2445
+	{ 16302, "Function Engine.LocalMessage.GetPos" },	// 2446
+	{ 16307, "Function Engine.LocalMessage.GetFontSize" },	// 2447
+	{ 16314, "Function Engine.LocalMessage.GetLifeTime" },	// 2448
+	{ 16317, "Function Engine.LocalMessage.IsConsoleMessage" },	// 2449
+	{ 16321, "Function Engine.LocalMessage.IsKeyObjectiveMessage" },	// 2450
+	{ 16329, "Class Engine.FailedConnect" },	// 2451
+	{ 16584, "Function Engine.ForceFeedbackManager.PlayForceFeedbackWaveform" },	// 2452
+	{ 16593, "Function Engine.ForceFeedbackManager.StopForceFeedbackWaveform" },	// 2453
+	{ 16595, "Function Engine.ForceFeedbackManager.PauseWaveform" },	// 2454
+	{ 16894, "Class Engine.FracturedSMActorSpawnable" },	// 2455
+	{ 17309, "Class Engine.SeqEvent_PlayerSpawned" },	// 2456
+	{ 18592, "Class Engine.UIMessageBoxBase" },	// 2457
+	{ 18706, "Class Engine.UIMessageBox" },	// 2458
+	{ 19004, "Class Engine.HeightFog" },	// 2459
+	{ 19157, "Class Engine.InterpActor_ForCinematic" },	// 2460
+	{ 20827, "Class Engine.SeqAct_AssignController" },	// 2461
+	{ 20833, "Class Engine.SeqAct_GiveInventory" },	// 2462
+	{ 21534, "Class Engine.NavMeshBoundsVolume" },	// 2463
+	{ 21894, "Class Engine.OnlineCommunityContentInterface" },	// 2464
+	{ 22023, "Class Engine.OnlineEventsInterface" },	// 2465
+	{ 22267, "Function Engine.OnlineGameSearch.SetSkillOverride" },	// 2466
+	{ 22272, "Function Engine.OnlineGameSearch.SortSearchResults" },	// 2467
+	{ 22916, "Class Engine.OnlinePlaylistGameTypeProvider" },	// 2468
+	{ 22984, "Class Engine.OnlinePlaylistProvider" },	// 2469
+	{ 23033, "Class Engine.OnlineRecentPlayersList" },	// 2470
+	{ 23249, "Function Engine.OnlineStatsWrite.OnStatsWriteComplete" },	// 2471
+	{ 23250, "Function Engine.OnlineStatsWrite.GetStatId" },	// 2472
+	{ 23254, "Function Engine.OnlineStatsWrite.GetStatName" },	// 2473
+	{ 23257, "Function Engine.OnlineStatsWrite.SetFloatStat" },	// 2474
+	{ 23260, "Function Engine.OnlineStatsWrite.SetIntStat" },	// 2475
+	{ 23263, "Function Engine.OnlineStatsWrite.IncrementFloatStat" },	// 2476
+	{ 23266, "Function Engine.OnlineStatsWrite.IncrementIntStat" },	// 2477
+	{ 23269, "Function Engine.OnlineStatsWrite.DecrementFloatStat" },	// 2478
+	{ 23272, "Function Engine.OnlineStatsWrite.DecrementIntStat" },	// 2479
+	{ 24312, "Class Engine.PathNode_Dynamic" },	// 2480
+	{ 25012, "Class Engine.SeqEvent_PickupStatusChange" },	// 2481
+	{ 25533, "Class Engine.RadialBlurActor" },	// 2482
+	{ 25734, "Class Engine.SeqAct_ToggleConstraintDrive" },	// 2483
+	{ 25783, "Class Engine.RB_BSJointActor" },	// 2484
+	{ 25788, "Class Engine.RB_ConstraintActorSpawnable" },	// 2485
+	{ 25848, "Class Engine.RB_HingeActor" },	// 2486
+	{ 25865, "Class Engine.RB_PrismaticActor" },	// 2487
+	{ 25870, "Class Engine.RB_PulleyJointActor" },	// 2488
+	{ 26286, "Class Engine.SeqAct_AddRemoveFaceFXAnimSet" },	// 2489
+	{ 26288, "Class Engine.SeqAct_AIAbortMoveToActor" },	// 2490
+	{ 26624, "Class Engine.SeqAct_SetMatInstTexParam" },	// 2491
+	{ 26629, "Class Engine.SeqAct_SetMatInstVectorParam" },	// 2492
+	{ 26642, "Class Engine.SeqAct_SetName" },	// 2493
+	{ 26653, "Class Engine.SeqAct_SetSkelControlTarget" },	// 2494
+	{ 26668, "Class Engine.SeqAct_SetVector" },	// 2495
+	{ 26768, "Class Engine.SeqAct_UpdatePhysBonesFromAnim" },	// 2496
+	{ 26846, "Function Engine.SequenceEvent.RegisterEvent" },	// 2497
+	{ 26854, "Function Engine.SequenceEvent.PassesWhoTriggers" },	// 2498
+	{ 26857, "Function Engine.SequenceEvent.Reset" },	// 2499
+	{ 26860, "Function Engine.SequenceEvent.Toggled" },	// 2500
+	{ 26868, "Class Engine.SeqEvent_AIReachedRouteActor" },	// 2501
+	{ 26879, "Class Engine.SeqEvent_LOS" },	// 2502
+	{ 27005, "Class Engine.SeqVar_Byte" },	// 2503
+	{ 27059, "Class Engine.SeqVar_Union" },	// 2504
+	{ 27061, "Class Engine.SeqVar_UniqueNetId" },	// 2505
+	{ 27093, "Class Engine.UISettingsClient" },	// 2506
+	{ 27094, "Class Engine.SessionSettingsProvider_GameInfo" },	// 2507
+	{ 27229, "Class Engine.SFXSeqAct_SetAimTarget" },	// 2508
+	{ 27790, "Class Engine.SkeletalMeshActorMATSpawnable" },	// 2509
+	{ 29021, "Class Engine.Trigger_Dynamic" },	// 2510
+	{ 29025, "Class Engine.Trigger_LOS" },	// 2511
+	{ 29043, "Class Engine.TriggeredPath" },	// 2512
+	{ 29057, "Class Engine.TriggerStreamingLevel" },	// 2513
+	{ 29087, "Class Engine.UIAction_ConsoleCommand" },	// 2514
+	{ 30035, "Class Engine.UIEvent_Initialized" },	// 2515
+	{ 30470, "Class Engine.UICharacterSummary" },	// 2516
+	{ 31992, "Class Engine.UIFocusHint" },	// 2517
+	{ 32806, "Class Engine.UIWeaponSummary" },	// 2518
+	{ 32822, "Class Engine.WaterVolume" },	// 2519
+	{ 33164, "Class Engine.WindDirectionalSource" },	// 2520
+	{ 33244, "Function GameFramework.GameAICommand.InitCommandUserActor" },	// 2521
+	{ 33248, "Function GameFramework.GameAICommand.InitCommand" },	// 2522
+	{ 33252, "Function GameFramework.GameAIController.PushCommand" },	// 2523
+	{ 33253, "Function GameFramework.GameAICommand.InternalPrePushed" },	// 2524
+	{ 33256, "Function GameFramework.GameAICommand.InternalPushed" },	// 2525
+	{ 33257, "Function GameFramework.GameAICommand.InternalPopped" },	// 2526
+	{ 33258, "Function GameFramework.GameAICommand.InternalPaused" },	// 2527
+	{ 33260, "Function GameFramework.GameAICommand.InternalResumed" },	// 2528
+	{ 33262, "Function GameFramework.GameAICommand.InternalTick" },	// 2529
+	{ 33264, "Function GameFramework.GameAICommand.ShouldIgnoreNotifies" },	// 2530
+	{ 33266, "Function GameFramework.GameAICommand.Tick" },	// 2531
+	{ 33268, "Function GameFramework.GameAICommand.AllowTransitionTo" },	// 2532
+	{ 33272, "Function GameFramework.GameAICommand.AllowStateTransitionTo" },	// 2533
+	{ 33275, "Function GameFramework.GameAICommand.PrePushed" },	// 2534
+	{ 33277, "Function GameFramework.GameAICommand.PostPopped" },	// 2535
+	{ 33278, "Function GameFramework.GameAICommand.Pushed" },	// 2536
+	{ 33279, "Function GameFramework.GameAICommand.Popped" },	// 2537
+	{ 33280, "Function GameFramework.GameAICommand.Paused" },	// 2538
+	{ 33282, "Function GameFramework.GameAICommand.Resumed" },	// 2539
+	{ 33284, "Function GameFramework.GameAICommand.GetDumpString" },	// 2540
+	{ 33297, "Function GameFramework.GameAIController.PopCommand" },	// 2541
+	{ 33299, "Function GameFramework.GameAICommand.DrawDebug" },	// 2542
+	{ 33302, "Function GameFramework.GameAICommand.GetDebugOverheadText" },	// 2543
+	{ 33316, "Function GameFramework.GameAIController.AbortCommand" },	// 2544
+	{ 33320, "Function GameFramework.GameAIController.GetActiveCommand" },	// 2545
+	{ 33322, "Function GameFramework.GameAIController.CheckCommandCount" },	// 2546
+	{ 33323, "Function GameFramework.GameAIController.DumpCommandStack" },	// 2547
+	{ 33324, "Function GameFramework.GameAIController.FindCommandOfClass" },	// 2548
+	{ 33327, "Function GameFramework.GameAIController.GetAICommandInStack" },	// 2549
+	{ 33330, "Function GameFramework.GameAIController.Destroyed" },	// 2550
+	{ 33333, "Function GameFramework.GameAIController.RecordDemoAILog" },	// 2551
+	{ 33335, "Function GameFramework.GameAIController.AILog_Internal" },	// 2552
+	{ 33339, "Function GameFramework.GameAIController.SetDesiredRotation" },	// 2553
+	{ 33344, "Function GameFramework.GameAIController.GeneratePathToActor" },	// 2554
+	{ 33349, "Function GameFramework.GameAIController.GeneratePathToLocation" },	// 2555
+	{ 33363, "Function GameFramework.GameAIController.GetActionString" },	// 2556
+	{ 33431, "Class IpDrv.WebApplication" },	// 2557
+	{ 33432, "Function IpDrv.WebApplication.Init" },	// 2558
+	{ 33433, "Function IpDrv.WebApplication.Cleanup" },	// 2559
+	{ 33434, "Function IpDrv.WebApplication.CleanupApp" },	// 2560
+	{ 33437, "Function IpDrv.WebApplication.PreQuery" },	// 2561
+	{ 33441, "Function IpDrv.WebApplication.Query" },	// 2562
+	{ 33444, "Function IpDrv.WebApplication.PostQuery" },	// 2563
+	{ 33447, "Class IpDrv.WebServer" },	// 2564
+	{ 33450, "Class IpDrv.HelloWeb" },	// 2565
+	{ 33459, "Function IpDrv.WebRequest.GetVariable" },	// 2566
+	{ 33461, "Function IpDrv.WebRequest.GetVariableCount" },	// 2567
+	{ 33463, "Function IpDrv.WebRequest.GetVariableNumber" },	// 2568
+	{ 33465, "Function IpDrv.WebResponse.Subst" },	// 2569
+	{ 33466, "Function IpDrv.WebResponse.IncludeUHTM" },	// 2570
+	{ 33469, "Class IpDrv.ImageServer" },	// 2571
+	{ 33474, "Function IpDrv.WebResponse.FileExists" },	// 2572
+	{ 33476, "Function IpDrv.WebResponse.IncludeBinaryFile" },	// 2573
+	{ 33485, "Function IpDrv.InternetLink.IsDataPending" },	// 2574
+	{ 33487, "Function IpDrv.InternetLink.ParseURL" },	// 2575
+	{ 33494, "Function IpDrv.InternetLink.Resolve" },	// 2576
+	{ 33496, "Function IpDrv.InternetLink.GetLastError" },	// 2577
+	{ 33498, "Function IpDrv.InternetLink.IpAddrToString" },	// 2578
+	{ 33501, "Function IpDrv.InternetLink.StringToIpAddr" },	// 2579
+	{ 33505, "Function IpDrv.InternetLink.GetLocalIP" },	// 2580
+	{ 33507, "Function IpDrv.InternetLink.Resolved" },	// 2581
+	{ 33509, "Function IpDrv.InternetLink.ResolveFailed" },	// 2582
+	{ 33533, "Function IpDrv.MeshBeacon.DestroyBeacon" },	// 2583
+	{ 33566, "Function IpDrv.MeshBeaconClient.DestroyBeacon" },	// 2584
+	{ 33567, "Function IpDrv.MeshBeaconClient.RequestConnection" },	// 2585
+	{ 33572, "Function IpDrv.MeshBeaconClient.BeginBandwidthTest" },	// 2586
+	{ 33576, "Function IpDrv.MeshBeaconClient.OnConnectionRequestResult" },	// 2587
+	{ 33578, "Function IpDrv.MeshBeaconClient.OnReceivedBandwidthTestRequest" },	// 2588
+	{ 33580, "Function IpDrv.MeshBeaconClient.OnReceivedBandwidthTestResults" },	// 2589
+	{ 33584, "Function IpDrv.MeshBeaconClient.OnTravelRequestReceived" },	// 2590
+	{ 33588, "Function IpDrv.MeshBeaconClient.OnCreateNewSessionRequestReceived" },	// 2591
+	{ 33593, "Function IpDrv.MeshBeaconClient.SendHostNewGameSessionResponse" },	// 2592
+	{ 33639, "Function IpDrv.MeshBeaconHost.InitHostBeacon" },	// 2593
+	{ 33642, "Function IpDrv.MeshBeaconHost.DestroyBeacon" },	// 2594
+	{ 33643, "Function IpDrv.MeshBeaconHost.RequestClientBandwidthTest" },	// 2595
+	{ 33648, "Function IpDrv.MeshBeaconHost.HasInProgressBandwidthTest" },	// 2596
+	{ 33650, "Function IpDrv.MeshBeaconHost.CancelInProgressBandwidthTests" },	// 2597
+	{ 33651, "Function IpDrv.MeshBeaconHost.HasPendingBandwidthTest" },	// 2598
+	{ 33653, "Function IpDrv.MeshBeaconHost.CancelPendingBandwidthTests" },	// 2599
+	{ 33654, "Function IpDrv.MeshBeaconHost.AllowBandwidthTesting" },	// 2600
+	{ 33657, "Function IpDrv.MeshBeaconHost.OnReceivedClientConnectionRequest" },	// 2601
+	{ 33659, "Function IpDrv.MeshBeaconHost.OnStartedBandwidthTest" },	// 2602
+	{ 33662, "Function IpDrv.MeshBeaconHost.OnFinishedBandwidthTest" },	// 2603
+	{ 33667, "Function IpDrv.MeshBeaconHost.SetPendingPlayerConnections" },	// 2604
+	{ 33670, "Function IpDrv.MeshBeaconHost.GetConnectionIndexForPlayer" },	// 2605
+	{ 33673, "Function IpDrv.MeshBeaconHost.AllPlayersConnected" },	// 2606
+	{ 33677, "Function IpDrv.MeshBeaconHost.OnAllPendingPlayersConnected" },	// 2607
+	{ 33678, "Function IpDrv.MeshBeaconHost.TellClientsToTravel" },	// 2608
+	{ 33682, "Function IpDrv.MeshBeaconHost.RequestClientCreateNewSession" },	// 2609
+	{ 33689, "Function IpDrv.MeshBeaconHost.OnReceivedClientCreateNewSessionResult" },	// 2610
+	{ 33713, "Function IpDrv.OnlineEventsInterfaceMcp.UploadProfileData" },	// 2611
+	{ 33718, "Function IpDrv.OnlineEventsInterfaceMcp.UploadGameplayEventsData" },	// 2612
+	{ 33721, "Function IpDrv.OnlineEventsInterfaceMcp.UploadHardwareData" },	// 2613
+	{ 33728, "Function IpDrv.OnlineGameInterfaceImpl.OnCreateOnlineGameComplete" },	// 2614
+	{ 33731, "Function IpDrv.OnlineGameInterfaceImpl.OnUpdateOnlineGameComplete" },	// 2615
+	{ 33734, "Function IpDrv.OnlineGameInterfaceImpl.OnDestroyOnlineGameComplete" },	// 2616
+	{ 33737, "Function IpDrv.OnlineGameInterfaceImpl.OnJoinOnlineGameComplete" },	// 2617
+	{ 33740, "Function IpDrv.OnlineGameInterfaceImpl.OnStartOnlineGameComplete" },	// 2618
+	{ 33743, "Function IpDrv.OnlineGameInterfaceImpl.OnEndOnlineGameComplete" },	// 2619
+	{ 33746, "Function IpDrv.OnlineGameInterfaceImpl.OnFindOnlineGamesComplete" },	// 2620
+	{ 33749, "Function IpDrv.OnlineGameInterfaceImpl.OnCancelFindOnlineGamesComplete" },	// 2621
+	{ 33751, "Function IpDrv.OnlineGameInterfaceImpl.GetGameSettings" },	// 2622
+	{ 33755, "Function IpDrv.OnlineGameInterfaceImpl.GetGameSearch" },	// 2623
+	{ 33758, "Function IpDrv.OnlineGameInterfaceImpl.CreateOnlineGame" },	// 2624
+	{ 33765, "Function IpDrv.OnlineGameInterfaceImpl.AddCreateOnlineGameCompleteDelegate" },	// 2625
+	{ 33767, "Function IpDrv.OnlineGameInterfaceImpl.ClearCreateOnlineGameCompleteDelegate" },	// 2626
+	{ 33770, "Function IpDrv.OnlineGameInterfaceImpl.UpdateOnlineGame" },	// 2627
+	{ 33777, "Function IpDrv.OnlineGameInterfaceImpl.AddUpdateOnlineGameCompleteDelegate" },	// 2628
+	{ 33779, "Function IpDrv.OnlineGameInterfaceImpl.ClearUpdateOnlineGameCompleteDelegate" },	// 2629
+	{ 33782, "Function IpDrv.OnlineGameInterfaceImpl.DestroyOnlineGame" },	// 2630
+	{ 33787, "Function IpDrv.OnlineGameInterfaceImpl.AddDestroyOnlineGameCompleteDelegate" },	// 2631
+	{ 33789, "Function IpDrv.OnlineGameInterfaceImpl.ClearDestroyOnlineGameCompleteDelegate" },	// 2632
+	{ 33792, "Function IpDrv.OnlineGameInterfaceImpl.FindOnlineGames" },	// 2633
+	{ 33796, "Function IpDrv.OnlineGameInterfaceImpl.AddFindOnlineGamesCompleteDelegate" },	// 2634
+	{ 33798, "Function IpDrv.OnlineGameInterfaceImpl.ClearFindOnlineGamesCompleteDelegate" },	// 2635
+	{ 33801, "Function IpDrv.OnlineGameInterfaceImpl.CancelFindOnlineGames" },	// 2636
+	{ 33804, "Function IpDrv.OnlineGameInterfaceImpl.AddCancelFindOnlineGamesCompleteDelegate" },	// 2637
+	{ 33806, "Function IpDrv.OnlineGameInterfaceImpl.ClearCancelFindOnlineGamesCompleteDelegate" },	// 2638
+	{ 33809, "Function IpDrv.OnlineGameInterfaceImpl.FreeSearchResults" },	// 2639
+	{ 33812, "Function IpDrv.OnlineGameInterfaceImpl.JoinOnlineGame" },	// 2640
+	{ 33819, "Function IpDrv.OnlineGameInterfaceImpl.AddJoinOnlineGameCompleteDelegate" },	// 2641
+	{ 33821, "Function IpDrv.OnlineGameInterfaceImpl.ClearJoinOnlineGameCompleteDelegate" },	// 2642
+	{ 33824, "Function IpDrv.OnlineGameInterfaceImpl.GetResolvedConnectString" },	// 2643
+	{ 33828, "Function IpDrv.OnlineGameInterfaceImpl.RegisterPlayer" },	// 2644
+	{ 33833, "Function IpDrv.OnlineGameInterfaceImpl.OnRegisterPlayerComplete" },	// 2645
+	{ 33837, "Function IpDrv.OnlineGameInterfaceImpl.AddRegisterPlayerCompleteDelegate" },	// 2646
+	{ 33839, "Function IpDrv.OnlineGameInterfaceImpl.ClearRegisterPlayerCompleteDelegate" },	// 2647
+	{ 33841, "Function IpDrv.OnlineGameInterfaceImpl.UnregisterPlayer" },	// 2648
+	{ 33845, "Function IpDrv.OnlineGameInterfaceImpl.OnUnregisterPlayerComplete" },	// 2649
+	{ 33849, "Function IpDrv.OnlineGameInterfaceImpl.AddUnregisterPlayerCompleteDelegate" },	// 2650
+	{ 33851, "Function IpDrv.OnlineGameInterfaceImpl.ClearUnregisterPlayerCompleteDelegate" },	// 2651
+	{ 33853, "Function IpDrv.OnlineGameInterfaceImpl.StartOnlineGame" },	// 2652
+	{ 33858, "Function IpDrv.OnlineGameInterfaceImpl.AddStartOnlineGameCompleteDelegate" },	// 2653
+	{ 33860, "Function IpDrv.OnlineGameInterfaceImpl.ClearStartOnlineGameCompleteDelegate" },	// 2654
+	{ 33863, "Function IpDrv.OnlineGameInterfaceImpl.EndOnlineGame" },	// 2655
+	{ 33868, "Function IpDrv.OnlineGameInterfaceImpl.AddEndOnlineGameCompleteDelegate" },	// 2656
+	{ 33870, "Function IpDrv.OnlineGameInterfaceImpl.ClearEndOnlineGameCompleteDelegate" },	// 2657
+	{ 33873, "Function IpDrv.OnlineGameInterfaceImpl.RegisterForArbitration" },	// 2658
+	{ 33876, "Function IpDrv.OnlineGameInterfaceImpl.OnArbitrationRegistrationComplete" },	// 2659
+	{ 33879, "Function IpDrv.OnlineGameInterfaceImpl.AddArbitrationRegistrationCompleteDelegate" },	// 2660
+	{ 33881, "Function IpDrv.OnlineGameInterfaceImpl.ClearArbitrationRegistrationCompleteDelegate" },	// 2661
+	{ 33883, "Function IpDrv.OnlineGameInterfaceImpl.GetArbitratedPlayers" },	// 2662
+	{ 33887, "Function IpDrv.OnlineGameInterfaceImpl.OnGameInviteAccepted" },	// 2663
+	{ 33889, "Function IpDrv.OnlineGameInterfaceImpl.AddGameInviteAcceptedDelegate" },	// 2664
+	{ 33892, "Function IpDrv.OnlineGameInterfaceImpl.ClearGameInviteAcceptedDelegate" },	// 2665
+	{ 33895, "Function IpDrv.OnlineGameInterfaceImpl.AcceptGameInvite" },	// 2666
+	{ 33899, "Function IpDrv.OnlineGameInterfaceImpl.RecalculateSkillRating" },	// 2667
+	{ 33904, "Function IpDrv.OnlineGameInterfaceImpl.QueryNonAdvertisedData" },	// 2668
+	{ 33908, "Function IpDrv.OnlineGameInterfaceImpl.ReadPlatformSpecificSessionInfo" },	// 2669
+	{ 33912, "Function IpDrv.OnlineGameInterfaceImpl.ReadPlatformSpecificSessionInfoBySessionName" },	// 2670
+	{ 33916, "Function IpDrv.OnlineGameInterfaceImpl.BindPlatformSpecificSessionToSearch" },	// 2671
+	{ 33921, "Function IpDrv.OnlineGameInterfaceImpl.ForceCleanUp" },	// 2672
+	{ 33923, "Function IpDrv.OnlineGameInterfaceImpl.QuickMatch" },	// 2673
+	{ 33926, "Function IpDrv.OnlineGameInterfaceImpl.OnQuickMatchComplete" },	// 2674
+	{ 33928, "Function IpDrv.OnlineGameInterfaceImpl.AddQuickMatchCompleteDelegate" },	// 2675
+	{ 33930, "Function IpDrv.OnlineGameInterfaceImpl.ClearQuickMatchCompleteDelegate" },	// 2676
+	{ 33961, "Function IpDrv.OnlineNewsInterfaceMcp.OnReadNewsCompleted" },	// 2677
+	{ 33969, "Function IpDrv.OnlineNewsInterfaceMcp.ReadNews" },	// 2678
+	{ 33975, "Function IpDrv.OnlineNewsInterfaceMcp.AddReadNewsCompletedDelegate" },	// 2679
+	{ 33977, "Function IpDrv.OnlineNewsInterfaceMcp.ClearReadNewsCompletedDelegate" },	// 2680
+	{ 33980, "Function IpDrv.OnlineNewsInterfaceMcp.GetNews" },	// 2681
+	{ 33987, "Function IpDrv.OnlineSubsystemCommonImpl.GetPlayerNicknameFromIndex" },	// 2682
+	{ 33990, "Function IpDrv.OnlineSubsystemCommonImpl.GetPlayerUniqueNetIdFromIndex" },	// 2683
+	{ 33993, "Function IpDrv.OnlineSubsystemCommonImpl.IsPlayerInSession" },	// 2684
+	{ 33997, "Function IpDrv.OnlineSubsystemCommonImpl.GetRegisteredPlayers" },	// 2685
+	{ 34010, "Function IpDrv.OnlineTitleFileDownloadMcp.OnReadTitleFileComplete" },	// 2686
+	{ 34015, "Function IpDrv.OnlineTitleFileDownloadMcp.ReadTitleFile" },	// 2687
+	{ 34018, "Function IpDrv.OnlineTitleFileDownloadMcp.AddReadTitleFileCompleteDelegate" },	// 2688
+	{ 34020, "Function IpDrv.OnlineTitleFileDownloadMcp.ClearReadTitleFileCompleteDelegate" },	// 2689
+	{ 34023, "Function IpDrv.OnlineTitleFileDownloadMcp.GetTitleFileContents" },	// 2690
+	{ 34028, "Function IpDrv.OnlineTitleFileDownloadMcp.GetTitleFileState" },	// 2691
+	{ 34032, "Function IpDrv.OnlineTitleFileDownloadMcp.ClearDownloadedFiles" },	// 2692
+	{ 34053, "Function IpDrv.PartyBeacon.DestroyBeacon" },	// 2693
+	{ 34054, "Function IpDrv.PartyBeacon.OnDestroyComplete" },	// 2694
+	{ 34067, "Function IpDrv.PartyBeaconClient.OnReservationRequestComplete" },	// 2695
+	{ 34069, "Function IpDrv.PartyBeaconClient.OnReservationCountUpdated" },	// 2696
+	{ 34071, "Function IpDrv.PartyBeaconClient.OnTravelRequestReceived" },	// 2697
+	{ 34075, "Function IpDrv.PartyBeaconClient.OnHostIsReady" },	// 2698
+	{ 34076, "Function IpDrv.PartyBeaconClient.OnHostHasCancelled" },	// 2699
+	{ 34077, "Function IpDrv.PartyBeaconClient.RequestReservation" },	// 2700
+	{ 34083, "Function IpDrv.PartyBeaconClient.RequestReservationUpdate" },	// 2701
+	{ 34089, "Function IpDrv.PartyBeaconClient.CancelReservation" },	// 2702
+	{ 34092, "Function IpDrv.PartyBeaconClient.DestroyBeacon" },	// 2703
+	{ 34115, "Function IpDrv.PartyBeaconHost.InitHostBeacon" },	// 2704
+	{ 34121, "Function IpDrv.PartyBeaconHost.AddPartyReservationEntry" },	// 2705
+	{ 34128, "Function IpDrv.PartyBeaconHost.UpdatePartyReservationEntry" },	// 2706
+	{ 34133, "Function IpDrv.PartyBeaconHost.HandlePlayerLogout" },	// 2707
+	{ 34136, "Function IpDrv.PartyBeaconHost.OnReservationChange" },	// 2708
+	{ 34137, "Function IpDrv.PartyBeaconHost.OnReservationsFull" },	// 2709
+	{ 34138, "Function IpDrv.PartyBeaconHost.OnClientCancellationReceived" },	// 2710
+	{ 34140, "Function IpDrv.PartyBeaconHost.DestroyBeacon" },	// 2711
+	{ 34141, "Function IpDrv.PartyBeaconHost.TellClientsToTravel" },	// 2712
+	{ 34145, "Function IpDrv.PartyBeaconHost.TellClientsHostIsReady" },	// 2713
+	{ 34146, "Function IpDrv.PartyBeaconHost.TellClientsHostHasCancelled" },	// 2714
+	{ 34147, "Function IpDrv.PartyBeaconHost.AreReservationsFull" },	// 2715
+	{ 34151, "Function IpDrv.PartyBeaconHost.RegisterPartyMembers" },	// 2716
+	{ 34160, "Function IpDrv.PartyBeaconHost.UnregisterPartyMembers" },	// 2717
+	{ 34165, "Function IpDrv.PartyBeaconHost.UnregisterParty" },	// 2718
+	{ 34171, "Function IpDrv.PartyBeaconHost.AppendReservationSkillsToSearch" },	// 2719
+	{ 34173, "Function IpDrv.PartyBeaconHost.GetPlayers" },	// 2720
+	{ 34179, "Function IpDrv.PartyBeaconHost.GetPartyLeaders" },	// 2721
+	{ 34183, "Function IpDrv.PartyBeaconHost.GetMaxAvailableTeamSize" },	// 2722
+	{ 34196, "Function IpDrv.TcpLink.BindPort" },	// 2723
+	{ 34200, "Function IpDrv.TcpLink.Listen" },	// 2724
+	{ 34202, "Function IpDrv.TcpLink.Open" },	// 2725
+	{ 34205, "Function IpDrv.TcpLink.Close" },	// 2726
+	{ 34207, "Function IpDrv.TcpLink.IsConnected" },	// 2727
+	{ 34209, "Function IpDrv.TcpLink.SendText" },	// 2728
+	{ 34212, "Function IpDrv.TcpLink.SendBinary" },	// 2729
+	{ 34216, "Function IpDrv.TcpLink.ReadText" },	// 2730
+	{ 34219, "Function IpDrv.TcpLink.ReadBinary" },	// 2731
+	{ 34223, "Function IpDrv.TcpLink.Accepted" },	// 2732
+	{ 34224, "Function IpDrv.TcpLink.Opened" },	// 2733
+	{ 34225, "Function IpDrv.TcpLink.Closed" },	// 2734
+	{ 34226, "Function IpDrv.TcpLink.ReceivedText" },	// 2735
+	{ 34228, "Function IpDrv.TcpLink.ReceivedLine" },	// 2736
+	{ 34230, "Function IpDrv.TcpLink.ReceivedBinary" },	// 2737
+	{ 34237, "Class IpDrv.WebConnection" },	// 2738
+	{ 34238, "Function IpDrv.WebConnection.Accepted" },	// 2739
+	{ 34242, "Function IpDrv.WebConnection.Closed" },	// 2740
+	{ 34243, "Function IpDrv.WebConnection.Timer" },	// 2741
+	{ 34245, "Function IpDrv.WebConnection.ReceivedText" },	// 2742
+	{ 34251, "Function IpDrv.WebConnection.ReceivedLine" },	// 2743
+	{ 34254, "Function IpDrv.WebConnection.ProcessHead" },	// 2744
+	{ 34256, "Function IpDrv.WebConnection.ProcessGet" },	// 2745
+	{ 34261, "Function IpDrv.WebServer.GetApplication" },	// 2746
+	{ 34266, "Function IpDrv.WebConnection.ProcessPost" },	// 2747
+	{ 34269, "Function IpDrv.WebConnection.CreateResponseObject" },	// 2748
+	{ 34273, "Function IpDrv.WebConnection.EndOfHeaders" },	// 2749
+	{ 34275, "Function IpDrv.WebConnection.CheckRawBytes" },	// 2750
+	{ 34277, "Function IpDrv.WebConnection.Cleanup" },	// 2751
+	{ 34278, "Function IpDrv.WebConnection.IsHanging" },	// 2752
+	{ 34284, "Function IpDrv.WebRequest.DecodeBase64" },	// 2753
+	{ 34287, "Function IpDrv.WebRequest.EncodeBase64" },	// 2754
+	{ 34290, "Function IpDrv.WebRequest.AddHeader" },	// 2755
+	{ 34293, "Function IpDrv.WebRequest.GetHeader" },	// 2756
+	{ 34297, "Function IpDrv.WebRequest.GetHeaders" },	// 2757
+	{ 34300, "Function IpDrv.WebRequest.AddVariable" },	// 2758
+	{ 34309, "Function IpDrv.WebRequest.GetVariables" },	// 2759
+	{ 34312, "Function IpDrv.WebRequest.Dump" },	// 2760
+	{ 34313, "Function IpDrv.WebRequest.ProcessHeaderString" },	// 2761
+	{ 34316, "Function IpDrv.WebRequest.DecodeFormData" },	// 2762
+	{ 34325, "Function IpDrv.WebRequest.GetHexDigit" },	// 2763
+	{ 34336, "Function IpDrv.WebResponse.ClearSubst" },	// 2764
+	{ 34339, "Function IpDrv.WebResponse.LoadParsedUHTM" },	// 2765
+	{ 34342, "Function IpDrv.WebResponse.GetHTTPExpiration" },	// 2766
+	{ 34345, "Function IpDrv.WebResponse.Dump" },	// 2767
+	{ 34346, "Function IpDrv.WebResponse.SendText" },	// 2768
+	{ 34350, "Function IpDrv.WebResponse.SendBinary" },	// 2769
+	{ 34353, "Function IpDrv.WebResponse.SendCachedFile" },	// 2770
+	{ 34357, "Function IpDrv.WebResponse.FailAuthentication" },	// 2771
+	{ 34359, "Function IpDrv.WebResponse.HTTPResponse" },	// 2772
+	{ 34362, "Function IpDrv.WebResponse.HTTPHeader" },	// 2773
+	{ 34364, "Function IpDrv.WebResponse.AddHeader" },	// 2774
+	{ 34371, "Function IpDrv.WebResponse.SendHeaders" },	// 2775
+	{ 34373, "Function IpDrv.WebResponse.HTTPError" },	// 2776
+	{ 34376, "Function IpDrv.WebResponse.SendStandardHeaders" },	// 2777
+	{ 34380, "Function IpDrv.WebResponse.Redirect" },	// 2778
+	{ 34382, "Function IpDrv.WebResponse.SentText" },	// 2779
+	{ 34384, "Function IpDrv.WebResponse.SentResponse" },	// 2780
+	{ 34389, "Function IpDrv.WebServer.PostBeginPlay" },	// 2781
+	{ 34400, "Function IpDrv.WebServer.Destroyed" },	// 2782
+	{ 34402, "Function IpDrv.WebServer.GainedChild" },	// 2783
+	{ 34406, "Function IpDrv.WebServer.LostChild" },	// 2784
+	{ 34413, "Function GFxUI.GFxAction_CloseMovie.IsValidLevelSequenceObject" },	// 2785
+	{ 34417, "Function GFxUI.GFxAction_GetVariable.IsValidLevelSequenceObject" },	// 2786
+	{ 34474, "Function GFxUI.GFxMovie.UnregisterGFxValue" },	// 2787
+	{ 34475, "Function GFxUI.GFxMovie.RegisterGFxValue" },	// 2788
+	{ 34478, "Function GFxUI.GFxMovie.ActionScriptSetFunction" },	// 2789
+	{ 34481, "Function GFxUI.GFxMovie.ActionScriptObject" },	// 2790
+	{ 34484, "Function GFxUI.GFxMovie.ActionScriptString" },	// 2791
+	{ 34487, "Function GFxUI.GFxMovie.ActionScriptFloat" },	// 2792
+	{ 34490, "Function GFxUI.GFxMovie.ActionScriptInt" },	// 2793
+	{ 34493, "Function GFxUI.GFxMovie.ActionScriptVoid" },	// 2794
+	{ 34496, "Function GFxUI.GFxMovie.GetPC" },	// 2795
+	{ 34498, "Function GFxUI.GFxMovie.GetLP" },	// 2796
+	{ 34500, "Function GFxUI.GFxMovie.SetExternalInterface" },	// 2797
+	{ 34502, "Function GFxUI.GFxMovie.SetFsCmdHandler" },	// 2798
+	{ 34504, "Function GFxUI.GFxMovie.SetVariableObject" },	// 2799
+	{ 34506, "Function GFxUI.GFxMovie.GetVariableObject" },	// 2800
+	{ 34509, "Function GFxUI.GFxMovie.CreateArray" },	// 2801
+	{ 34513, "Function GFxUI.GFxMovie.CreateObject" },	// 2802
+	{ 34515, "Function GFxUI.GFxMovie.SetVariableStringArray" },	// 2803
+	{ 34519, "Function GFxUI.GFxMovie.SetVariableFloatArray" },	// 2804
+	{ 34525, "Function GFxUI.GFxMovie.SetVariableIntArray" },	// 2805
+	{ 34531, "Function GFxUI.GFxMovie.SetVariableArray" },	// 2806
+	{ 34537, "Function GFxUI.GFxMovie.GetVariableStringArray" },	// 2807
+	{ 34549, "Function GFxUI.GFxMovie.GetVariableFloatArray" },	// 2808
+	{ 34555, "Function GFxUI.GFxMovie.GetVariableIntArray" },	// 2809
+	{ 34561, "Function GFxUI.GFxMovie.GetVariableArray" },	// 2810
+	{ 34567, "Function GFxUI.GFxMovie.SetVariableString" },	// 2811
+	{ 34573, "Function GFxUI.GFxMovie.SetVariableNumber" },	// 2812
+	{ 34576, "Function GFxUI.GFxMovie.SetVariableBool" },	// 2813
+	{ 34579, "Function GFxUI.GFxMovie.SetVariable" },	// 2814
+	{ 34582, "Function GFxUI.GFxMovie.GetVariableString" },	// 2815
+	{ 34585, "Function GFxUI.GFxMovie.GetVariableNumber" },	// 2816
+	{ 34588, "Function GFxUI.GFxMovie.GetVariableBool" },	// 2817
+	{ 34591, "Function GFxUI.GFxMovie.GetVariable" },	// 2818
+	{ 34594, "Function GFxUI.GFxMovie.PublishDataStoreValues" },	// 2819
+	{ 34597, "Function GFxUI.GFxMovie.RefreshDataStoreBindings" },	// 2820
+	{ 34598, "Function GFxUI.GFxMovie.Invoke" },	// 2821
+	{ 34599, "Function GFxUI.GFxMovie.SetTimingMode" },	// 2822
+	{ 34604, "Function GFxUI.GFxMovie.Pause" },	// 2823
+	{ 34606, "Function GFxUI.GFxMovie.Advance" },	// 2824
+	{ 34608, "Function GFxUI.GFxMovie.SetExternalTexture" },	// 2825
+	{ 34610, "Function GFxUI.GFxMovie.FlushPlayerInput" },	// 2826
+	{ 34614, "Function GFxUI.GFxMovie.ClearFocusIgnoreKeys" },	// 2827
+	{ 34616, "Function GFxUI.GFxMovie.AddFocusIgnoreKey" },	// 2828
+	{ 34617, "Function GFxUI.GFxMovie.ClearCaptureKeys" },	// 2829
+	{ 34619, "Function GFxUI.GFxMovie.AddCaptureKey" },	// 2830
+	{ 34620, "Function GFxUI.GFxMovie.SetFocus" },	// 2831
+	{ 34622, "Function GFxUI.GFxMovie.SetSceneDPG" },	// 2832
+	{ 34625, "Function GFxUI.GFxMovie.SetPerspective3D" },	// 2833
+	{ 34627, "Function GFxUI.GFxMovie.SetView3D" },	// 2834
+	{ 34629, "Function GFxUI.GFxMovie.GetVisibleFrameRect" },	// 2835
+	{ 34631, "Function GFxUI.GFxMovie.SetAlignment" },	// 2836
+	{ 34636, "Function GFxUI.GFxMovie.SetViewScaleMode" },	// 2837
+	{ 34640, "Function GFxUI.GFxMovie.SetViewport" },	// 2838
+	{ 34642, "Function GFxUI.GFxMovie.GetGameViewportClient" },	// 2839
+	{ 34647, "Function GFxUI.GFxMovie.SetMovieInfo" },	// 2840
+	{ 34649, "Function GFxUI.GFxMovie.OnClose" },	// 2841
+	{ 34651, "Function GFxUI.GFxMovie.Close" },	// 2842
+	{ 34652, "Function GFxUI.GFxMovie.Start" },	// 2843
+	{ 34658, "Function GFxUI.GFxAction_Invoke.IsValidLevelSequenceObject" },	// 2844
+	{ 34662, "Function GFxUI.GFxAction_OpenMovie.IsValidLevelSequenceObject" },	// 2845
+	{ 34673, "Function GFxUI.GFxAction_SetVariable.IsValidLevelSequenceObject" },	// 2846
+	{ 34677, "Function GFxUI.GFxDataStoreSubscriber.PublishValues" },	// 2847
+	{ 34678, "Function GFxUI.GFxDataStoreSubscriber.SetDataStoreBinding" },	// 2848
+	{ 34681, "Function GFxUI.GFxDataStoreSubscriber.GetDataStoreBinding" },	// 2849
+	{ 34684, "Function GFxUI.GFxDataStoreSubscriber.RefreshSubscriberValue" },	// 2850
+	{ 34687, "Function GFxUI.GFxDataStoreSubscriber.NotifyDataStoreValueUpdated" },	// 2851
+	{ 34693, "Function GFxUI.GFxDataStoreSubscriber.GetBoundDataStores" },	// 2852
+	{ 34696, "Function GFxUI.GFxDataStoreSubscriber.ClearBoundDataStores" },	// 2853
+	{ 34697, "Function GFxUI.GFxDataStoreSubscriber.SaveSubscriberValue" },	// 2854
+	{ 34718, "Function GFxUI.GFxFSCmdHandler_Kismet.FSCommand" },	// 2855
+	{ 34724, "Function GFxUI.GFxGameViewportClient.Init" },	// 2856
+	{ 34730, "Function GFxUI.GFxInteraction.SetFocusMovie" },	// 2857
+	{ 34734, "Function GFxUI.GFxInteraction.GetFocusMovie" },	// 2858
+	{ 34736, "Function GFxUI.GFxInteraction.NotifyGameSessionEnded" },	// 2859
+	{ 34737, "Function GFxUI.GFxInteraction.NotifyPlayerAdded" },	// 2860
+	{ 34740, "Function GFxUI.GFxInteraction.NotifyPlayerRemoved" },	// 2861
+	{ 34779, "Function GFxUI.GFxValue.Invoke" },	// 2862
+	{ 34784, "Function GFxUI.GFxValue.Get" },	// 2863
+	{ 34787, "Function GFxUI.GFxValue.GetObject" },	// 2864
+	{ 34791, "Function GFxUI.GFxValue.GetBool" },	// 2865
+	{ 34794, "Function GFxUI.GFxValue.GetNumber" },	// 2866
+	{ 34797, "Function GFxUI.GFxValue.GetString" },	// 2867
+	{ 34800, "Function GFxUI.GFxValue.Set" },	// 2868
+	{ 34803, "Function GFxUI.GFxValue.SetObject" },	// 2869
+	{ 34806, "Function GFxUI.GFxValue.SetFunction" },	// 2870
+	{ 34810, "Function GFxUI.GFxValue.SetBool" },	// 2871
+	{ 34813, "Function GFxUI.GFxValue.SetNumber" },	// 2872
+	{ 34816, "Function GFxUI.GFxValue.SetString" },	// 2873
+	{ 34819, "Function GFxUI.GFxValue.GetDisplayInfo" },	// 2874
+	{ 34821, "Function GFxUI.GFxValue.GetDisplayMatrix" },	// 2875
+	{ 34823, "Function GFxUI.GFxValue.GetColorTransform" },	// 2876
+	{ 34825, "Function GFxUI.GFxValue.GetPosition" },	// 2877
+	{ 34829, "Function GFxUI.GFxValue.SetDisplayInfo" },	// 2878
+	{ 34831, "Function GFxUI.GFxValue.SetDisplayMatrix" },	// 2879
+	{ 34833, "Function GFxUI.GFxValue.SetDisplayMatrix3D" },	// 2880
+	{ 34835, "Function GFxUI.GFxValue.SetVisible" },	// 2881
+	{ 34837, "Function GFxUI.GFxValue.SetPosition" },	// 2882
+	{ 34840, "Function GFxUI.GFxValue.SetColorTransform" },	// 2883
+	{ 34842, "Function GFxUI.GFxValue.GotoAndPlay" },	// 2884
+	{ 34844, "Function GFxUI.GFxValue.GotoAndPlayI" },	// 2885
+	{ 34846, "Function GFxUI.GFxValue.GotoAndStop" },	// 2886
+	{ 34848, "Function GFxUI.GFxValue.GotoAndStopI" },	// 2887
+	{ 34850, "Function GFxUI.GFxValue.CreateEmptyMovieClip" },	// 2888
+	{ 34855, "Function GFxUI.GFxValue.AttachMovie" },	// 2889
+	{ 34861, "Function GFxUI.GFxValue.CastTo" },	// 2890
+	{ 34864, "Function GFxUI.GFxValue.GetText" },	// 2891
+	{ 34866, "Function GFxUI.GFxValue.SetText" },	// 2892
+	{ 34869, "Function GFxUI.GFxValue.SetMemberObjectText" },	// 2893
+	{ 34873, "Function GFxUI.GFxValue.GetElement" },	// 2894
+	{ 34876, "Function GFxUI.GFxValue.GetElementObject" },	// 2895
+	{ 34880, "Function GFxUI.GFxValue.GetElementBool" },	// 2896
+	{ 34883, "Function GFxUI.GFxValue.GetElementNumber" },	// 2897
+	{ 34886, "Function GFxUI.GFxValue.GetElementString" },	// 2898
+	{ 34889, "Function GFxUI.GFxValue.GetElementDisplayInfo" },	// 2899
+	{ 34892, "Function GFxUI.GFxValue.GetElementDisplayMatrix" },	// 2900
+	{ 34895, "Function GFxUI.GFxValue.SetElement" },	// 2901
+	{ 34898, "Function GFxUI.GFxValue.SetElementObject" },	// 2902
+	{ 34901, "Function GFxUI.GFxValue.SetElementBool" },	// 2903
+	{ 34904, "Function GFxUI.GFxValue.SetElementNumber" },	// 2904
+	{ 34907, "Function GFxUI.GFxValue.SetElementString" },	// 2905
+	{ 34910, "Function GFxUI.GFxValue.SetElementDisplayInfo" },	// 2906
+	{ 34913, "Function GFxUI.GFxValue.SetElementDisplayMatrix" },	// 2907
+	{ 34916, "Function GFxUI.GFxValue.SetElementVisible" },	// 2908
+	{ 34919, "Function GFxUI.GFxValue.SetElementPosition" },	// 2909
+	{ 34923, "Function GFxUI.GFxValue.SetElementColorTransform" },	// 2910
+	{ 34926, "Function GFxUI.GFxValue.GetElementMember" },	// 2911
+	{ 34930, "Function GFxUI.GFxValue.GetElementMemberObject" },	// 2912
+	{ 34935, "Function GFxUI.GFxValue.GetElementMemberBool" },	// 2913
+	{ 34939, "Function GFxUI.GFxValue.GetElementMemberNumber" },	// 2914
+	{ 34943, "Function GFxUI.GFxValue.GetElementMemberString" },	// 2915
+	{ 34947, "Function GFxUI.GFxValue.SetElementMember" },	// 2916
+	{ 34951, "Function GFxUI.GFxValue.SetElementMemberObject" },	// 2917
+	{ 34955, "Function GFxUI.GFxValue.SetElementMemberBool" },	// 2918
+	{ 34959, "Function GFxUI.GFxValue.SetElementMemberNumber" },	// 2919
+	{ 34963, "Function GFxUI.GFxValue.SetElementMemberString" },	// 2920
+	{ 34967, "Function GFxUI.GFxValue.ActionScriptVoid" },	// 2921
+	{ 34969, "Function GFxUI.GFxValue.ActionScriptInt" },	// 2922
+	{ 34972, "Function GFxUI.GFxValue.ActionScriptFloat" },	// 2923
+	{ 34975, "Function GFxUI.GFxValue.ActionScriptString" },	// 2924
+	{ 34978, "Function GFxUI.GFxValue.ActionScriptObject" },	// 2925
+	{ 34981, "Function GFxUI.GFxValue.ActionScriptArray" },	// 2926
+	{ 34985, "Function GFxUI.GFxValue.ActionScriptSetFunction" },	// 2927
+	{ 34987, "Function GFxUI.GFxValue.ActionScriptSetFunctionOn" },	// 2928
+	{ 34991, "Class WwiseAudio.ActorFactoryWwiseDistanceRTPC" },	// 2929
+	{ 34993, "Class WwiseAudio.WwiseDistanceRTPC" },	// 2930
+	{ 34994, "Class WwiseAudio.ActorFactoryWwiseMicPosOrient" },	// 2931
+	{ 35016, "Function WwiseAudio.SeqAct_WwiseMusicVolumeDisable.GetObjClassVersion" },	// 2932
+	{ 35019, "Function WwiseAudio.SeqAct_WwiseMusicVolumeEnable.GetObjClassVersion" },	// 2933
+	{ 35022, "Function WwiseAudio.SeqAct_WwisePostEvent.GetObjClassVersion" },	// 2934
+	{ 35035, "Function WwiseAudio.WwiseAmbientSound.DrawEmitter" },	// 2935
+	{ 35036, "Function WwiseAudio.WwiseAmbientSound.HideEmitter" },	// 2936
+	{ 35048, "Function WwiseAudio.WwiseAudioComponent.SetRTPCWithHandler" },	// 2937
+	{ 35051, "Function WwiseAudio.WwiseAudioComponent.FindPlayingID" },	// 2938
+	{ 35055, "Function WwiseAudio.WwiseAudioComponent.StopAll" },	// 2939
+	{ 35057, "Function WwiseAudio.WwiseAudioComponent.SoundPosition" },	// 2940
+	{ 35060, "Function WwiseAudio.WwiseAudioComponent.SoundPositionByID" },	// 2941
+	{ 35063, "Function WwiseAudio.WwiseAudioComponent.PlayWwiseEvent" },	// 2942
+	{ 35067, "Function WwiseAudio.WwiseAudioComponent.Play" },	// 2943
+	{ 35071, "Function WwiseAudio.WwiseAudioComponent.StopWwiseEvent" },	// 2944
+	{ 35074, "Function WwiseAudio.WwiseAudioComponent.Stop" },	// 2945
+	{ 35077, "Function WwiseAudio.WwiseAudioComponent.SetWwiseRTPC" },	// 2946
+	{ 35081, "Function WwiseAudio.WwiseAudioComponent.SetWwiseRTPCs" },	// 2947
+	{ 35087, "Function WwiseAudio.WwiseAudioComponent.SetWwiseSwitch" },	// 2948
+	{ 35091, "Function WwiseAudio.WwiseAudioComponent.SetWwiseTrigger" },	// 2949
+	{ 35094, "Function WwiseAudio.WwiseAudioComponent.PostGlobalEvent" },	// 2950
+	{ 35097, "Function WwiseAudio.WwiseAudioComponent.IsPlaying" },	// 2951
+	{ 35100, "Function WwiseAudio.WwiseAudioComponent.IsEventPlaying" },	// 2952
+	{ 35103, "Function WwiseAudio.WwiseAudioComponent.CreateComponentFromScript" },	// 2953
+	{ 35110, "Function WwiseAudio.WwiseAudioComponent.StaticPostGlobalEventFromScript" },	// 2954
+	{ 35113, "Function WwiseAudio.WwiseAudioComponent.SetGlobalRTPCFromScript" },	// 2955
+	{ 35117, "Function WwiseAudio.WwiseAudioComponent.GetMicPosition" },	// 2956
+	{ 35119, "Function WwiseAudio.WwiseAudioComponent.GetEnvironmentalAudioEnabled" },	// 2957
+	{ 35121, "Function WwiseAudio.WwiseAudioComponent.GetObstructionOcclusionEnabled" },	// 2958
+	{ 35123, "Function WwiseAudio.WwiseAudioComponent.SetEnvironmentalAudioEnabled" },	// 2959
+	{ 35125, "Function WwiseAudio.WwiseAudioComponent.SetObstructionOcclusionEnabled" },	// 2960
+	{ 35127, "Function WwiseAudio.WwiseAudioComponent.GetDistanceToListener" },	// 2961
+	{ 35129, "Function WwiseAudio.WwiseAudioComponent.UnregisterGameObject" },	// 2962
+	{ 35131, "Function WwiseAudio.WwiseAudioComponent.RegisterGameObject" },	// 2963
+	{ 35134, "Function WwiseAudio.WwiseAudioComponent.Set2D" },	// 2964
+	{ 35135, "Function WwiseAudio.WwiseAudioComponent.Set3D" },	// 2965
+	{ 35136, "Function WwiseAudio.WwiseAudioComponent.KillSound" },	// 2966
+	{ 35139, "Function WwiseAudio.WwiseAudioComponent.SetDrawMic" },	// 2967
+	{ 35141, "Function WwiseAudio.WwiseAudioComponent.SetLocation" },	// 2968
+	{ 35175, "Function WwiseAudio.WwiseAudioComponentMultiLoc.Set3D" },	// 2969
+	{ 35179, "Function WwiseAudio.WwiseVolume.PostBeginPlay" },	// 2970
+	{ 35182, "Function WwiseAudio.WwiseVolume.TimerPop" },	// 2971
+	{ 35187, "Function WwiseAudio.WwiseAudioVolume.PostBeginPlay" },	// 2972
+	{ 35189, "Function WwiseAudio.WwiseAudioVolume.TimerPop" },	// 2973
+	{ 35191, "Function WwiseAudio.WwiseAudioVolume.myTimerPop" },	// 2974
+	{ 35192, "Function WwiseAudio.WwiseAudioVolume.Start" },	// 2975
+	{ 35193, "Function WwiseAudio.WwiseAudioVolume.Stop" },	// 2976
+	{ 35194, "Function WwiseAudio.WwiseAudioVolume.DrawVolume" },	// 2977
+	{ 35195, "Function WwiseAudio.WwiseAudioVolume.HideVolume" },	// 2978
+	{ 35218, "Class WwiseAudio.WwiseCollection" },	// 2979
+	{ 35262, "Function WwiseAudio.WwiseDistanceRTPC.Tick" },	// 2980
+	{ 35293, "Function WwiseAudio.WwiseMusicVolume.PostBeginPlay" },	// 2981
+	{ 35296, "Function WwiseAudio.WwiseMusicVolume.TimerPop" },	// 2982
+	{ 35298, "Function WwiseAudio.WwiseMusicVolume.myTimerPop" },	// 2983
+	{ 35299, "Function WwiseAudio.WwiseMusicVolume.CheckPriority" },	// 2984
+	{ 35301, "Function WwiseAudio.WwiseMusicVolume.StartMusic" },	// 2985
+	{ 35302, "Function WwiseAudio.WwiseMusicVolume.StopMusic" },	// 2986
+	{ 35303, "Function WwiseAudio.WwiseMusicVolume.SetEnabled" },	// 2987
+	{ 35305, "Function WwiseAudio.WwiseMusicVolume.SetContainsPlayer" },	// 2988
+	{ 35317, "Class WwiseAudio.WwiseOcclusionVolume" },	// 2989
+	{ 35324, "Function WwiseAudio.WwiseProcFoleyComponent.GetMAX_PROC_FOLEY_BONES" },	// 2990
+	{ 35343, "Function WwiseAudio.WwiseVolumeTimer.Timer" },	// 2991
+	{ 35390, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.OnRefreshDigitalRightsResult" },	// 2992
+	{ 35392, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.RefreshDigitalRights" },	// 2993
+	{ 35394, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.GetEntitlementsList" },	// 2994
+	{ 35398, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.GetEntitlementInfo" },	// 2995
+	{ 35402, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.GetConsumablesList" },	// 2996
+	{ 35406, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.GetConsumableInfo" },	// 2997
+	{ 35410, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.OnConsumeResult" },	// 2998
+	{ 35414, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.ConsumeId" },	// 2999
+	{ 35419, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.OnGrantEntitlementResult" },	// 3000
+	{ 35422, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.GrantEntitlementId" },	// 3001
+	{ 35427, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.OnProcessAutoGrantsComplete" },	// 3002
+	{ 35428, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.ProcessAutoGrants" },	// 3003
+	{ 35430, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.OnPromptRedeemCodeResult" },	// 3004
+	{ 35432, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.PromptRedeemCode" },	// 3005
+	{ 35434, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.SubmitRedeemCode" },	// 3006
+	{ 35437, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.OnCodeRedeemed" },	// 3007
+	{ 35439, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.OnPurchaseOfferIdResult" },	// 3008
+	{ 35441, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.PurchaseOfferId" },	// 3009
+	{ 35444, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.Display1stPartyStore" },	// 3010
+	{ 35445, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.GetWalletBalance" },	// 3011
+	{ 35447, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.GetOffersList" },	// 3012
+	{ 35452, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.OnFetchOfferDetailsComplete" },	// 3013
+	{ 35453, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.FetchOfferDetails" },	// 3014
+	{ 35457, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.OnDimeConfigLoaded" },	// 3015
+	{ 35458, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.LoadDimeConfig" },	// 3016
+	{ 35461, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.NucleusEntitlementsRefreshOffline" },	// 3017
+	{ 35462, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.DumpTestData" },	// 3018
+	{ 35463, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.StoreOfflineEntitlementInfo" },	// 3019
+	{ 35466, "Function SFXOnlineFoundation.ISFXOnlineComponentCommerce.DecryptOfflineEntitlementInfo" },	// 3020
+	{ 35478, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.AuthenticateCompleted" },	// 3021
+	{ 35480, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.OnGetRatingsComplete" },	// 3022
+	{ 35487, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.OnIncreaseRatingsComplete" },	// 3023
+	{ 35494, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.OnSendMessageComplete" },	// 3024
+	{ 35499, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.OnGetMessagesComplete" },	// 3025
+	{ 35510, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.OnTouchMessagesComplete" },	// 3026
+	{ 35513, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.GetRatings" },	// 3027
+	{ 35517, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.IncreaseRatings" },	// 3028
+	{ 35527, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.SendMessage" },	// 3029
+	{ 35533, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.GetMessages" },	// 3030
+	{ 35536, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.TouchMessages" },	// 3031
+	{ 35539, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.Cleanup" },	// 3032
+	{ 35540, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.IsSessionValid" },	// 3033
+	{ 35542, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.InvalidateSession" },	// 3034
+	{ 35543, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.GetAuthenticationHTTPRequest" },	// 3035
+	{ 35547, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.ParseAuthenticationResult" },	// 3036
+	{ 35550, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.GetRatingsHTTPRequest" },	// 3037
+	{ 35553, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.GetIncreaseRatingsHTTPRequest" },	// 3038
+	{ 35560, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.ParseHTTPRatingsAssetsLevel" },	// 3039
+	{ 35568, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.GetSendMessageHTTPRequest" },	// 3040
+	{ 35574, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.ParseSendMessageResult" },	// 3041
+	{ 35580, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.GetGetMessagesHTTPRequest" },	// 3042
+	{ 35583, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.ParseGetMessagesResult" },	// 3043
+	{ 35588, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.GetTouchMessagesHTTPRequest" },	// 3044
+	{ 35591, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.ParseTouchMessagesResult" },	// 3045
+	{ 35595, "Function SFXOnlineFoundation.ISFXOnlineComponentGalaxyAtWar.SetBaseURL" },	// 3046
+	{ 35834, "Function SFXOnlineFoundation.ISFXOnlineComponentLeaderboard.OnResultsRetrieved" },	// 3047
+	{ 35843, "Function SFXOnlineFoundation.ISFXOnlineComponentLeaderboard.OnReadLbListCompleted" },	// 3048
+	{ 35845, "Function SFXOnlineFoundation.ISFXOnlineComponentLeaderboard.OnGetRankNotificationsCompleted" },	// 3049
+	{ 35848, "Function SFXOnlineFoundation.ISFXOnlineComponentLeaderboard.GetLeaderboardDefinitions" },	// 3050
+	{ 35852, "Function SFXOnlineFoundation.ISFXOnlineComponentLeaderboard.GetLeaderboardDefinitionTable" },	// 3051
+	{ 35856, "Function SFXOnlineFoundation.ISFXOnlineComponentLeaderboard.RequestLeaderboardData" },	// 3052
+	{ 35862, "Function SFXOnlineFoundation.ISFXOnlineComponentLeaderboard.RequestLeaderboardCenteredData" },	// 3053
+	{ 35868, "Function SFXOnlineFoundation.ISFXOnlineComponentLeaderboard.GetRankNotifications" },	// 3054
+	{ 35869, "Function SFXOnlineFoundation.ISFXOnlineComponentLeaderboard.RequestReadLeaderboardList" },	// 3055
+	{ 35870, "Function SFXOnlineFoundation.ISFXOnlineComponentLeaderboard.CancelLeaderboardRequests" },	// 3056
+	{ 35871, "Function SFXOnlineFoundation.ISFXOnlineComponentLeaderboard.GetLeaderboardData" },	// 3057
+	{ 35878, "Function SFXOnlineFoundation.ISFXOnlineComponentLeaderboard.GetLeaderboardCenteredData" },	// 3058
+	{ 35885, "Function SFXOnlineFoundation.ISFXOnlineComponentLeaderboard.GetFriendLeaderboardData" },	// 3059
+	{ 35890, "Function SFXOnlineFoundation.ISFXOnlineComponentLeaderboard.ReadLeaderboardList" },	// 3060
+	{ 35894, "Function SFXOnlineFoundation.ISFXOnlineComponentLeaderboard.ShowGamerCardForRecord" },	// 3061
+	{ 35898, "Function SFXOnlineFoundation.ISFXOnlineComponentLeaderboard.GetCurrentRankNotificationsArray" },	// 3062
+	{ 35901, "Function SFXOnlineFoundation.ISFXOnlineComponentLeaderboard.RefreshLeaderboardTitles" },	// 3063
+	{ 35902, "Function SFXOnlineFoundation.ISFXOnlineComponentLeaderboard.AddRankNotificationCallback" },	// 3064
+	{ 35904, "Function SFXOnlineFoundation.ISFXOnlineComponentLeaderboard.RemoveRankNotificationCallback" },	// 3065
+	{ 35906, "Function SFXOnlineFoundation.ISFXOnlineComponentLeaderboard.HasNotificationsAvailable" },	// 3066
+	{ 35918, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetLoginStatus" },	// 3067
+	{ 35920, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetActiveUserIndex" },	// 3068
+	{ 35922, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SwitchActiveUserIndex" },	// 3069
+	{ 35924, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.IsActiveUser" },	// 3070
+	{ 35927, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.Connect" },	// 3071
+	{ 35929, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.IsConnected" },	// 3072
+	{ 35931, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.IsSignedIn" },	// 3073
+	{ 35933, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.IsConnectedTo1stPartyOnlineService" },	// 3074
+	{ 35935, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.HasInternetConnection" },	// 3075
+	{ 35937, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetPersonaName" },	// 3076
+	{ 35939, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetUserId" },	// 3077
+	{ 35941, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.Cancel" },	// 3078
+	{ 35942, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GoBackInUI" },	// 3079
+	{ 35943, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CheckAutoLoginFromIni" },	// 3080
+	{ 35945, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.AutoLoginWithAccountIndex" },	// 3081
+	{ 35947, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.AutoLogin" },	// 3082
+	{ 35950, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitIntroPage" },	// 3083
+	{ 35953, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitNucleusLogin" },	// 3084
+	{ 35957, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitParentEmail" },	// 3085
+	{ 35960, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitCreateNucleusAccount" },	// 3086
+	{ 35967, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitNucleusWelcomeMessage" },	// 3087
+	{ 35968, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitCerberusIntro" },	// 3088
+	{ 35970, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitCerberusWelcomeMessage" },	// 3089
+	{ 35971, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitRedeemCode" },	// 3090
+	{ 35974, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitMessageBox" },	// 3091
+	{ 35976, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitEmailPasswordMismatch" },	// 3092
+	{ 35980, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitCreateNucleusAccountEx" },	// 3093
+	{ 35992, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitStore" },	// 3094
+	{ 35995, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.Disconnect" },	// 3095
+	{ 35997, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.AcceptTOS" },	// 3096
+	{ 35999, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SelectPersona" },	// 3097
+	{ 36001, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CreatePersona" },	// 3098
+	{ 36003, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.DisablePersona" },	// 3099
+	{ 36005, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.IsCerberusMember" },	// 3100
+	{ 36007, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.OpenCerberusUI" },	// 3101
+	{ 36008, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.OnDLCInfoLoaded" },	// 3102
+	{ 36009, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.OnDownloadOffersUICompleted" },	// 3103
+	{ 36010, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.RequestImportFriendListToBlaze" },	// 3104
+	{ 36012, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.OnAuthTokenRetrieved" },	// 3105
+	{ 36014, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.OnImportFriendListToBlazeCompleted" },	// 3106
+	{ 36016, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.ImportFriendListToBlaze" },	// 3107
+	{ 36019, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetAuthToken" },	// 3108
+	{ 36022, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.EnterCDKey" },	// 3109
+	{ 36024, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanPlayOnline" },	// 3110
+	{ 36027, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanCommunicate" },	// 3111
+	{ 36030, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanDownloadUserContent" },	// 3112
+	{ 36033, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanPurchaseContent" },	// 3113
+	{ 36036, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanViewPlayerProfiles" },	// 3114
+	{ 36039, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanShowPresenceInformation" },	// 3115
+	{ 36042, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetConnectMode" },	// 3116
+	{ 36044, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SuspendUserPing" },	// 3117
+	{ 36046, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.PostImportFriendListToBlaze" },	// 3118
+	{ 36047, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.StartCerberusLogin" },	// 3119
+	{ 36049, "Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SetExternalDRMDataLoaded" },	// 3120
+	{ 36223, "Function SFXOnlineFoundation.ISFXOnlineComponentStats.OnResultsRetrieved" },	// 3121
+	{ 36230, "Function SFXOnlineFoundation.ISFXOnlineComponentStats.OnReadStatsGroupListCompleted" },	// 3122
+	{ 36232, "Function SFXOnlineFoundation.ISFXOnlineComponentStats.GetFriendsStatsData" },	// 3123
+	{ 36238, "Function SFXOnlineFoundation.ISFXOnlineComponentStats.RequestReadStatsGroupList" },	// 3124
+	{ 36239, "Function SFXOnlineFoundation.ISFXOnlineComponentStats.ReadStatsGroupList" },	// 3125
+	{ 36253, "Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.CanCollect" },	// 3126
+	{ 36255, "Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.OnAuthenticate" },	// 3127
+	{ 36256, "Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.OnDisconnect" },	// 3128
+	{ 36261, "Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.RegisterConnectionDelegates" },	// 3129
+	{ 36265, "Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.Flush" },	// 3130
+	{ 36352, "Function SFXOnlineFoundation.SFXOnlineEvent.GetEventType" },	// 3131
+	{ 36354, "Function SFXOnlineFoundation.SFXOnlineEvent.SetEventType" },	// 3132
+	{ 36356, "Function SFXOnlineFoundation.SFXOnlineEvent.GetEventId" },	// 3133
+	{ 36358, "Function SFXOnlineFoundation.SFXOnlineEvent.SetEventId" },	// 3134
+	{ 36360, "Function SFXOnlineFoundation.SFXOnlineEvent.GetOutcome" },	// 3135
+	{ 36362, "Function SFXOnlineFoundation.SFXOnlineEvent.SetOutcome" },	// 3136
+	{ 36364, "Function SFXOnlineFoundation.SFXOnlineEvent.GetStatus" },	// 3137
+	{ 36366, "Function SFXOnlineFoundation.SFXOnlineEvent.SetStatus" },	// 3138
+	{ 36368, "Function SFXOnlineFoundation.SFXOnlineEvent.GetErrorCode" },	// 3139
+	{ 36370, "Function SFXOnlineFoundation.SFXOnlineEvent.SetErrorCode" },	// 3140
+	{ 36372, "Function SFXOnlineFoundation.SFXOnlineEvent.GetErrorString" },	// 3141
+	{ 36374, "Function SFXOnlineFoundation.SFXOnlineEvent.SetErrorString" },	// 3142
+	{ 36376, "Function SFXOnlineFoundation.SFXOnlineEvent.GetTimeout" },	// 3143
+	{ 36378, "Function SFXOnlineFoundation.SFXOnlineEvent.SetTimeout" },	// 3144
+	{ 36380, "Function SFXOnlineFoundation.SFXOnlineEvent.EnableTimeout" },	// 3145
+	{ 36381, "Function SFXOnlineFoundation.SFXOnlineEvent.DisableTimeout" },	// 3146
+	{ 36382, "Function SFXOnlineFoundation.SFXOnlineEvent.IsTimeoutEnabled" },	// 3147
+	{ 36384, "Function SFXOnlineFoundation.SFXOnlineEvent.HasTimedOut" },	// 3148
+	{ 36386, "Function SFXOnlineFoundation.SFXOnlineEvent.GetTimeDifference" },	// 3149
+	{ 36389, "Function SFXOnlineFoundation.SFXOnlineEvent.GetStartTime" },	// 3150
+	{ 36391, "Function SFXOnlineFoundation.SFXOnlineEvent.GetEndTime" },	// 3151
+	{ 36393, "Function SFXOnlineFoundation.SFXOnlineEvent.SetStartTime" },	// 3152
+	{ 36395, "Function SFXOnlineFoundation.SFXOnlineEvent.SetEndTime" },	// 3153
+	{ 36397, "Function SFXOnlineFoundation.SFXOnlineEvent.IsCompleteAndSucceeded" },	// 3154
+	{ 36399, "Function SFXOnlineFoundation.SFXOnlineEvent.IsPending" },	// 3155
+	{ 36401, "Function SFXOnlineFoundation.SFXOnlineEvent.IsComplete" },	// 3156
+	{ 36403, "Function SFXOnlineFoundation.SFXOnlineEvent.IsInError" },	// 3157
+	{ 36405, "Function SFXOnlineFoundation.SFXOnlineEvent.IsCanceled" },	// 3158
+	{ 36407, "Function SFXOnlineFoundation.SFXOnlineEvent.IsSucceeded" },	// 3159
+	{ 36409, "Function SFXOnlineFoundation.SFXOnlineEvent.Update" },	// 3160
+	{ 36411, "Function SFXOnlineFoundation.SFXOnlineEvent.DumpEventInfo" },	// 3161
+	{ 36412, "Function SFXOnlineFoundation.SFXOnlineEvent.GetEventTypeAsString" },	// 3162
+	{ 36415, "Function SFXOnlineFoundation.SFXOnlineEvent.GetEventStatusAsString" },	// 3163
+	{ 36418, "Function SFXOnlineFoundation.SFXOnlineEvent.GetEventOutcomeAsString" },	// 3164
+	{ 36421, "Function SFXOnlineFoundation.SFXOnlineEvent.GetEventTypeFromString" },	// 3165
+	{ 36441, "Function SFXOnlineFoundation.SFXOnlineComponent.OnInitialize" },	// 3166
+	{ 36443, "Function SFXOnlineFoundation.SFXOnlineComponent.OnRelease" },	// 3167
+	{ 36444, "Function SFXOnlineFoundation.SFXOnlineComponent.GetAPIName" },	// 3168
+	{ 36446, "Function SFXOnlineFoundation.SFXOnlineComponent.OnEvent" },	// 3169
+	{ 36448, "Function SFXOnlineFoundation.SFXOnlineComponent.SubscribeToEvent" },	// 3170
+	{ 36451, "Function SFXOnlineFoundation.SFXOnlineComponent.UnsubscribeFromEvent" },	// 3171
+	{ 36454, "Function SFXOnlineFoundation.SFXOnlineComponent.UnsubscribeFromAllEvents" },	// 3172
+	{ 36456, "Function SFXOnlineFoundation.SFXOnlineComponent.StopWaitingForAllWork" },	// 3173
+	{ 36458, "Function SFXOnlineFoundation.SFXOnlineComponent.NotifyEventType" },	// 3174
+	{ 36462, "Function SFXOnlineFoundation.SFXOnlineComponent.NotifyEventObject" },	// 3175
+	{ 36464, "Function SFXOnlineFoundation.SFXOnlineComponent.NotifyWorkStartedType" },	// 3176
+	{ 36468, "Function SFXOnlineFoundation.SFXOnlineComponent.NotifyWorkStartedObject" },	// 3177
+	{ 36472, "Function SFXOnlineFoundation.SFXOnlineComponent.NotifyWorkFinishedType" },	// 3178
+	{ 36476, "Function SFXOnlineFoundation.SFXOnlineComponent.NotifyWorkFinishedObject" },	// 3179
+	{ 36479, "Function SFXOnlineFoundation.SFXOnlineComponent.WaitingForWorkType" },	// 3180
+	{ 36483, "Function SFXOnlineFoundation.SFXOnlineComponent.WaitingForWorkObject" },	// 3181
+	{ 36486, "Function SFXOnlineFoundation.SFXOnlineComponent.WaitingForWorkSetType" },	// 3182
+	{ 36490, "Function SFXOnlineFoundation.SFXOnlineComponent.WaitingForWorkSetObject" },	// 3183
+	{ 36494, "Function SFXOnlineFoundation.SFXOnlineComponent.GetEvent" },	// 3184
+	{ 36498, "Function SFXOnlineFoundation.SFXOnlineComponent.IsEventPending" },	// 3185
+	{ 36502, "Function SFXOnlineFoundation.SFXOnlineComponent.IsAnyEventPending" },	// 3186
+	{ 36505, "Function SFXOnlineFoundation.SFXOnlineComponent.GetAllPendingEvents" },	// 3187
+	{ 36510, "Function SFXOnlineFoundation.SFXOnlineComponent.IsConsole" },	// 3188
+	{ 36512, "Function SFXOnlineFoundation.SFXOnlineComponent.IsPS3" },	// 3189
+	{ 36514, "Function SFXOnlineFoundation.SFXOnlineComponent.IsXbox360" },	// 3190
+	{ 36520, "Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.Grant" },	// 3191
+	{ 36523, "Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.IsGranted" },	// 3192
+	{ 36527, "Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.OnInitialize" },	// 3193
+	{ 36529, "Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.OnRelease" },	// 3194
+	{ 36530, "Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.GetAPIName" },	// 3195
+	{ 36533, "Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.Grant" },	// 3196
+	{ 36536, "Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.IsGranted" },	// 3197
+	{ 36540, "Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.OnInitialize" },	// 3198
+	{ 36542, "Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.OnRelease" },	// 3199
+	{ 36543, "Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.GetAPIName" },	// 3200
+	{ 36546, "Function SFXOnlineFoundation.SFXOnlineComponentAvatarAwardXenon.Grant" },	// 3201
+	{ 36549, "Function SFXOnlineFoundation.SFXOnlineComponentAvatarAwardXenon.OnInitialize" },	// 3202
+	{ 36551, "Function SFXOnlineFoundation.SFXOnlineComponentAvatarAwardXenon.OnRelease" },	// 3203
+	{ 36552, "Function SFXOnlineFoundation.SFXOnlineComponentAvatarAwardXenon.GetAPIName" },	// 3204
+	{ 36561, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.OnEndOnlineGameComplete" },	// 3205
+	{ 36564, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.OnFindOnlineGamesComplete" },	// 3206
+	{ 36567, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.OnCreateOnlineGameComplete" },	// 3207
+	{ 36570, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.OnQuickMatchComplete" },	// 3208
+	{ 36573, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.OnJoinOnlineGameComplete" },	// 3209
+	{ 36576, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.OnUpdateOnlineGameComplete" },	// 3210
+	{ 36579, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.OnDestroyOnlineGameComplete" },	// 3211
+	{ 36589, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.OnGameInviteAccepted" },	// 3212
+	{ 36596, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.OnCancelFindOnlineGamesComplete" },	// 3213
+	{ 36602, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.OnRegisterPlayerComplete" },	// 3214
+	{ 36606, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.OnUnregisterPlayerComplete" },	// 3215
+	{ 36610, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.OnStartOnlineGameComplete" },	// 3216
+	{ 36615, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.OnArbitrationRegistrationComplete" },	// 3217
+	{ 36619, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.AllowMatchmaking" },	// 3218
+	{ 36622, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.OnInitialize" },	// 3219
+	{ 36624, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.OnRelease" },	// 3220
+	{ 36625, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.GetAPIName" },	// 3221
+	{ 36627, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.IsPlayerInGame" },	// 3222
+	{ 36630, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.CancelJoinOnlineGame" },	// 3223
+	{ 36631, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.CanMigrate" },	// 3224
+	{ 36633, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.HostMigrationMsgBoxCallback" },	// 3225
+	{ 36636, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.IsLocalPlayer" },	// 3226
+	{ 36639, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.SetHostViabilityEnabled" },	// 3227
+	{ 36642, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.WasKickedOutOfGame" },	// 3228
+	{ 36645, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.GetSFXGameSettings" },	// 3229
+	{ 36648, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.SetMultiplayerTargetVersion" },	// 3230
+	{ 36651, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.SetServerMatchMakingRulesVersion" },	// 3231
+	{ 36654, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.UpdateGameProtocolVersion" },	// 3232
+	{ 36655, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.IsOnLatestMultiplayerVersion" },	// 3233
+	{ 36658, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.IsTargetVersionRetrieved" },	// 3234
+	{ 36660, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.ValidateDLCMasterList" },	// 3235
+	{ 36662, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.SetMPDLCInfo" },	// 3236
+	{ 36666, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.IsInvalidHost" },	// 3237
+	{ 36668, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.GetMultiplayer_MissingDLCs" },	// 3238
+	{ 36672, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.CreateOnlineGame" },	// 3239
+	{ 36677, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.FindOnlineGames" },	// 3240
+	{ 36681, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.JoinOnlineGame" },	// 3241
+	{ 36686, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.StartOnlineGame" },	// 3242
+	{ 36689, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.EndOnlineGame" },	// 3243
+	{ 36692, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.RegisterPlayer" },	// 3244
+	{ 36697, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.UnregisterPlayer" },	// 3245
+	{ 36701, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.DestroyOnlineGame" },	// 3246
+	{ 36704, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.UpdateOnlineGame" },	// 3247
+	{ 36709, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.AcceptGameInvite" },	// 3248
+	{ 36713, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.GetResolvedConnectString" },	// 3249
+	{ 36717, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.OnHostAddressResolved" },	// 3250
+	{ 36719, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.ForceCleanUp" },	// 3251
+	{ 36721, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.IsReadyForConnections" },	// 3252
+	{ 36723, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.IsHostMigrationInProgress" },	// 3253
+	{ 36725, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.CompleteHostMigration" },	// 3254
+	{ 36728, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.CancelHostMigration" },	// 3255
+	{ 36729, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.FailHostMigration" },	// 3256
+	{ 36731, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.ShowHostMigrationMsgBox" },	// 3257
+	{ 36733, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.HideHostMigrationMsgBox" },	// 3258
+	{ 36734, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.GetPlayerCount" },	// 3259
+	{ 36736, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.KickPlayer" },	// 3260
+	{ 36739, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.OnTick" },	// 3261
+	{ 36741, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.OnMPGameStatusChange" },	// 3262
+	{ 36743, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.Tick" },	// 3263
+	{ 36747, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.IsPlaying" },	// 3264
+	{ 36749, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.LeaveGame" },	// 3265
+	{ 36750, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.QuickMatch" },	// 3266
+	{ 36753, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.CanStartMPMatch" },	// 3267
+	{ 36756, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.CreateDefaultQuickMatchSettings" },	// 3268
+	{ 36761, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.SetCallRestrictedFunctionMode" },	// 3269
+	{ 36763, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.PerformCallRestrictedFunction" },	// 3270
+	{ 36765, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.SetPlatformPresence" },	// 3271
+	{ 36767, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.GM_OnDisconnect" },	// 3272
+	{ 36769, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentGameFlow" },	// 3273
+	{ 36774, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.ShowPopup" },	// 3274
+	{ 36779, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.OnInviteAccepted" },	// 3275
+	{ 36788, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentGameEntryFlow" },	// 3276
+	{ 36792, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.OnConnectionError" },	// 3277
+	{ 36794, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.GetGameSettings" },	// 3278
+	{ 36797, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.GetGameSearch" },	// 3279
+	{ 36799, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.CancelFindOnlineGames" },	// 3280
+	{ 36801, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.AddFindOnlineGamesCompleteDelegate" },	// 3281
+	{ 36803, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.ClearFindOnlineGamesCompleteDelegate" },	// 3282
+	{ 36805, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.AddCreateOnlineGameCompleteDelegate" },	// 3283
+	{ 36807, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.ClearCreateOnlineGameCompleteDelegate" },	// 3284
+	{ 36809, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.AddQuickMatchCompleteDelegate" },	// 3285
+	{ 36811, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.ClearQuickMatchCompleteDelegate" },	// 3286
+	{ 36813, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.AddGameInviteAcceptedDelegate" },	// 3287
+	{ 36817, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.NotifyGameInviteAcceptedDelegates" },	// 3288
+	{ 36823, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.CanShowErrorMessage" },	// 3289
+	{ 36827, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.ClearGameInviteAcceptedDelegate" },	// 3290
+	{ 36830, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.AddJoinOnlineGameCompleteDelegate" },	// 3291
+	{ 36832, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.ClearJoinOnlineGameCompleteDelegate" },	// 3292
+	{ 36834, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.AddUpdateOnlineGameCompleteDelegate" },	// 3293
+	{ 36836, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.ClearUpdateOnlineGameCompleteDelegate" },	// 3294
+	{ 36838, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.AddDestroyOnlineGameCompleteDelegate" },	// 3295
+	{ 36840, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.ClearDestroyOnlineGameCompleteDelegate" },	// 3296
+	{ 36842, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.AddEndOnlineGameCompleteDelegate" },	// 3297
+	{ 36844, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.ClearEndOnlineGameCompleteDelegate" },	// 3298
+	{ 36846, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.AddCancelFindOnlineGamesCompleteDelegate" },	// 3299
+	{ 36848, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.ClearCancelFindOnlineGamesCompleteDelegate" },	// 3300
+	{ 36850, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.ReadPlatformSpecificSessionInfo" },	// 3301
+	{ 36854, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.ReadPlatformSpecificSessionInfoBySessionName" },	// 3302
+	{ 36858, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.BindPlatformSpecificSessionToSearch" },	// 3303
+	{ 36863, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.FreeSearchResults" },	// 3304
+	{ 36866, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.QueryNonAdvertisedData" },	// 3305
+	{ 36870, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.AddRegisterPlayerCompleteDelegate" },	// 3306
+	{ 36872, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.ClearRegisterPlayerCompleteDelegate" },	// 3307
+	{ 36874, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.AddUnregisterPlayerCompleteDelegate" },	// 3308
+	{ 36876, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.ClearUnregisterPlayerCompleteDelegate" },	// 3309
+	{ 36878, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.AddStartOnlineGameCompleteDelegate" },	// 3310
+	{ 36880, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.ClearStartOnlineGameCompleteDelegate" },	// 3311
+	{ 36882, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.RegisterForArbitration" },	// 3312
+	{ 36885, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.AddArbitrationRegistrationCompleteDelegate" },	// 3313
+	{ 36887, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.ClearArbitrationRegistrationCompleteDelegate" },	// 3314
+	{ 36889, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.GetArbitratedPlayers" },	// 3315
+	{ 36893, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.RecalculateSkillRating" },	// 3316
+	{ 36899, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGame.SetKickedOutOfGame" },	// 3317
+	{ 36943, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGameXenon.OnInitialize" },	// 3318
+	{ 36945, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGameXenon.OnRelease" },	// 3319
+	{ 36946, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGameXenon.SetCallRestrictedFunctionMode" },	// 3320
+	{ 36948, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGameXenon.PerformCallRestrictedFunction" },	// 3321
+	{ 36950, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeGameXenon.SetPlatformPresence" },	// 3322
+	{ 36958, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeHub.OnInitialize" },	// 3323
+	{ 36960, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeHub.OnRelease" },	// 3324
+	{ 36961, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeHub.ConnectDirtySock" },	// 3325
+	{ 36963, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeHub.GetAPIName" },	// 3326
+	{ 36965, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeHub.GetCurrentTime" },	// 3327
+	{ 36967, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeHub.ResetLocale" },	// 3328
+	{ 36968, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeHub.Idle" },	// 3329
+	{ 36970, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeHub.OnTick" },	// 3330
+	{ 36996, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.OnGetRankNotificationsCompleted" },	// 3331
+	{ 37017, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.OnResultsRetrieved" },	// 3332
+	{ 37027, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.OnReadLbListCompleted" },	// 3333
+	{ 37031, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.GetLeaderboardDefinitions" },	// 3334
+	{ 37035, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.GetLeaderboardDefinitionTable" },	// 3335
+	{ 37039, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.RequestLeaderboardData" },	// 3336
+	{ 37045, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.RequestLeaderboardCenteredData" },	// 3337
+	{ 37051, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.GetRankNotifications" },	// 3338
+	{ 37052, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.RequestFriendLeaderboardData" },	// 3339
+	{ 37056, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.RequestReadLeaderboardList" },	// 3340
+	{ 37057, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.GenerateHistoricalFriendData" },	// 3341
+	{ 37058, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.CancelLeaderboardRequests" },	// 3342
+	{ 37059, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.OnDisconnect" },	// 3343
+	{ 37061, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.AddRankNotificationCallback" },	// 3344
+	{ 37063, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.RemoveRankNotificationCallback" },	// 3345
+	{ 37065, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.GetCurrentRankNotificationsArray" },	// 3346
+	{ 37068, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.HasNotificationsAvailable" },	// 3347
+	{ 37070, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.GetLeaderboardData" },	// 3348
+	{ 37077, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.GetLeaderboardCenteredData" },	// 3349
+	{ 37084, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.GetFriendLeaderboardData" },	// 3350
+	{ 37089, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.ReadLeaderboardList" },	// 3351
+	{ 37093, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.ShowGamerCardForRecord" },	// 3352
+	{ 37097, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.GetLeaderboard" },	// 3353
+	{ 37106, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.RefreshLeaderboardTitles" },	// 3354
+	{ 37107, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.OnInitialize" },	// 3355
+	{ 37109, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.OnRelease" },	// 3356
+	{ 37110, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.GetAPIName" },	// 3357
+	{ 37112, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.CreateJobGetLeaderboardData" },	// 3358
+	{ 37119, "Function SFXOnlineFoundation.SFXOnlineJobGetLeaderboardData.CreateLeaderboardJob" },	// 3359
+	{ 37121, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.CreateJobGetLeaderboardCenteredData" },	// 3360
+	{ 37128, "Function SFXOnlineFoundation.SFXOnlineJobGetLeaderboardData.CreateCenteredLeaderboardJob" },	// 3361
+	{ 37130, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.CreateJobGetFriendLeaderboardData" },	// 3362
+	{ 37135, "Function SFXOnlineFoundation.SFXOnlineJobGetLeaderboardData.CreateFriendLeaderboardJob" },	// 3363
+	{ 37137, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.CreateJobGetStatsData" },	// 3364
+	{ 37143, "Function SFXOnlineFoundation.SFXOnlineJobGetLeaderboardData.CreateFriendStatsDataJob" },	// 3365
+	{ 37145, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.CreateJobGetLeaderboardList" },	// 3366
+	{ 37147, "Function SFXOnlineFoundation.SFXOnlineJobGetLeaderboardList.CreateGetLeaderboardListJob" },	// 3367
+	{ 37149, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.TriggerEmptyCallback" },	// 3368
+	{ 37191, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.ProcessHistoricalFriendData" },	// 3369
+	{ 37197, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.GenerateHistoricalFriendDataRecords" },	// 3370
+	{ 37204, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.RankNotification_ChallengePointLeaderboardCb" },	// 3371
+	{ 37205, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.RankNotification_N7RatingLeaderboardCb" },	// 3372
+	{ 37237, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.OnAuthTokenRetrieved" },	// 3373
+	{ 37239, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.OnReadFriendsComplete" },	// 3374
+	{ 37241, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.AddReadFriendsCompleteDelegate" },	// 3375
+	{ 37245, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetOnlineSubsystem" },	// 3376
+	{ 37247, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentUnrealPlayer" },	// 3377
+	{ 37249, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.ClearReadFriendsCompleteDelegate" },	// 3378
+	{ 37253, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.CreateJobGetAuthToken" },	// 3379
+	{ 37256, "Function SFXOnlineFoundation.SFXOnlineJobGetAuthToken.CreateGetAuthTokenJob" },	// 3380
+	{ 37258, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.GetAuthToken" },	// 3381
+	{ 37261, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.OnInitialize" },	// 3382
+	{ 37263, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.OnRelease" },	// 3383
+	{ 37264, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.GetAPIName" },	// 3384
+	{ 37266, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.GetLoginStatus" },	// 3385
+	{ 37268, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.GetActiveUserIndex" },	// 3386
+	{ 37270, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.SwitchActiveUserIndex" },	// 3387
+	{ 37272, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.IsActiveUser" },	// 3388
+	{ 37275, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.IsConnected" },	// 3389
+	{ 37277, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.IsSignedIn" },	// 3390
+	{ 37279, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.IsConnectedTo1stPartyOnlineService" },	// 3391
+	{ 37281, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.HasInternetConnection" },	// 3392
+	{ 37283, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.GetPersonaName" },	// 3393
+	{ 37285, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.GetUserId" },	// 3394
+	{ 37287, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.Cancel" },	// 3395
+	{ 37288, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.GoBackInUI" },	// 3396
+	{ 37289, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.CheckAutoLoginFromIni" },	// 3397
+	{ 37291, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.AutoLoginWithAccountIndex" },	// 3398
+	{ 37293, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.AutoLogin" },	// 3399
+	{ 37296, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.Connect" },	// 3400
+	{ 37298, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.SubmitIntroPage" },	// 3401
+	{ 37301, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.SubmitNucleusLogin" },	// 3402
+	{ 37305, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.SubmitParentEmail" },	// 3403
+	{ 37308, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.SubmitCreateNucleusAccount" },	// 3404
+	{ 37315, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.SubmitNucleusWelcomeMessage" },	// 3405
+	{ 37316, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.SubmitCerberusIntro" },	// 3406
+	{ 37318, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.SubmitNucleusWelcomeMessageEx" },	// 3407
+	{ 37319, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.SubmitCerberusWelcomeMessage" },	// 3408
+	{ 37320, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.SubmitRedeemCode" },	// 3409
+	{ 37323, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.SubmitMessageBox" },	// 3410
+	{ 37325, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.SubmitEmailPasswordMismatch" },	// 3411
+	{ 37329, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.SubmitCreateNucleusAccountEx" },	// 3412
+	{ 37341, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.SubmitStore" },	// 3413
+	{ 37344, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.StartCerberusLogin" },	// 3414
+	{ 37345, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.CompleteLoginProcess" },	// 3415
+	{ 37346, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.Show1stPartyServiceLoginImp" },	// 3416
+	{ 37348, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.Show1stPartyServiceLogin" },	// 3417
+	{ 37350, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.On1stPartyServiceLoginResult" },	// 3418
+	{ 37352, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.Disconnect" },	// 3419
+	{ 37354, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.AcceptTOS" },	// 3420
+	{ 37356, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.SelectPersona" },	// 3421
+	{ 37358, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.CreatePersona" },	// 3422
+	{ 37360, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.DisablePersona" },	// 3423
+	{ 37362, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.IsCerberusMember" },	// 3424
+	{ 37364, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.BuildEntitlementList" },	// 3425
+	{ 37368, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.CompleteBuildEntitlementListUponLogin" },	// 3426
+	{ 37370, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.CompleteBuildEntitlementListUponRedeption" },	// 3427
+	{ 37372, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.Buy" },	// 3428
+	{ 37374, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.EnterCDKey" },	// 3429
+	{ 37376, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.OpenCerberusUI" },	// 3430
+	{ 37377, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.OnDLCInfoLoaded" },	// 3431
+	{ 37378, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.OnDownloadOffersUICompleted" },	// 3432
+	{ 37379, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.CanPlayOnline" },	// 3433
+	{ 37382, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.CanCommunicate" },	// 3434
+	{ 37385, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.CanDownloadUserContent" },	// 3435
+	{ 37388, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.CanPurchaseContent" },	// 3436
+	{ 37391, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.CanViewPlayerProfiles" },	// 3437
+	{ 37394, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.CanShowPresenceInformation" },	// 3438
+	{ 37397, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.CreateJobImportFriendListToBlaze" },	// 3439
+	{ 37400, "Function SFXOnlineFoundation.SFXOnlineJobImportFriendListToBlaze.CreateImportFriendListToBlazeJob" },	// 3440
+	{ 37402, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.RequestImportFriendListToBlaze" },	// 3441
+	{ 37404, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.OnImportFriendListToBlazeCompleted" },	// 3442
+	{ 37406, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.ImportFriendListToBlaze" },	// 3443
+	{ 37409, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.PostImportFriendListToBlaze" },	// 3444
+	{ 37410, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.AddFriendsCompleteCb" },	// 3445
+	{ 37412, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.GetConnectMode" },	// 3446
+	{ 37414, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.GetDefaultBiowareEmailAllowed" },	// 3447
+	{ 37416, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.SuspendUserPing" },	// 3448
+	{ 37418, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.OnPromptRedeemCodeResult" },	// 3449
+	{ 37420, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.OnOriginAuthKeyAvailableCallback" },	// 3450
+	{ 37424, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.SetExternalDRMDataLoaded" },	// 3451
+	{ 37462, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLogin.OnTick" },	// 3452
+	{ 37479, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentPlatform" },	// 3453
+	{ 37481, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowLoginUIEx" },	// 3454
+	{ 37483, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLoginXenon.HasInternetConnection" },	// 3455
+	{ 37485, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLoginXenon.OnExternalUIChange" },	// 3456
+	{ 37487, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLoginXenon.Show1stPartyServiceLoginImp" },	// 3457
+	{ 37493, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLoginXenon.XenonLoginResult" },	// 3458
+	{ 37505, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeMessaging.FetchAllMessages" },	// 3459
+	{ 37506, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeMessaging.SendMessage" },	// 3460
+	{ 37512, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeMessaging.PurgeAllMessages" },	// 3461
+	{ 37513, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeMessaging.FetchAllMessagesViaJob" },	// 3462
+	{ 37514, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeMessaging.PurgeAllMessagesViaJob" },	// 3463
+	{ 37515, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeMessaging.OnInitialize" },	// 3464
+	{ 37517, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeMessaging.OnRelease" },	// 3465
+	{ 37518, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeMessaging.GetAPIName" },	// 3466
+	{ 37520, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeMessaging.CreateReceiveAllMessagesJob" },	// 3467
+	{ 37522, "Function SFXOnlineFoundation.SFXOnlineJobReceiveMessage.CreateReceiveAllMessagesJob" },	// 3468
+	{ 37524, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeMessaging.CreatePurgeAllMessagesJob" },	// 3469
+	{ 37526, "Function SFXOnlineFoundation.SFXOnlineJobPurgeMessages.CreatePurgeAllMessagesJob" },	// 3470
+	{ 37528, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeMessaging.CreatePurgeMessagesJob" },	// 3471
+	{ 37531, "Function SFXOnlineFoundation.SFXOnlineJobPurgeMessages.CreatePurgeMessagesJob" },	// 3472
+	{ 37542, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.OnTick" },	// 3473
+	{ 37544, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.OnInitialize" },	// 3474
+	{ 37546, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.OnRelease" },	// 3475
+	{ 37547, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.GetAPIName" },	// 3476
+	{ 37549, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.RequestData" },	// 3477
+	{ 37550, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.AdvanceToNextRequest" },	// 3478
+	{ 37551, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.RequestServerInfo" },	// 3479
+	{ 37552, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.RequestEntitlementsInfo" },	// 3480
+	{ 37553, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.RequestDimeInfo" },	// 3481
+	{ 37554, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.LoadDimeInfo" },	// 3482
+	{ 37555, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.LoadDimeCallback" },	// 3483
+	{ 37556, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.GetEntitlementInfo" },	// 3484
+	{ 37559, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.GetDimeInfo" },	// 3485
+	{ 37561, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.GetTargetOfferId" },	// 3486
+	{ 37564, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.RequestLiveTlkTable" },	// 3487
+	{ 37566, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.CheckMessageAgainstDR" },	// 3488
+	{ 37569, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.GetMOTDInfo" },	// 3489
+	{ 37572, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.UpdateMOTDGUI" },	// 3490
+	{ 37573, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.GetLiveBinaryINIVersion" },	// 3491
+	{ 37576, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.RequestBinaryLiveINIData" },	// 3492
+	{ 37578, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.IsFetchingLiveBinaryINIData" },	// 3493
+	{ 37580, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.IsLiveINIOutOfDate" },	// 3494
+	{ 37582, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.FetchOfflineEntitlementStoreMappings" },	// 3495
+	{ 37583, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.ReadPlayerStorageCallback" },	// 3496
+	{ 37585, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.PostGetLeaderboardList" },	// 3497
+	{ 37586, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.RequestGalaxyAtWarLevel" },	// 3498
+	{ 37587, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentGalaxyAtWar" },	// 3499
+	{ 37589, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.GetStoreCatalogId" },	// 3500
+	{ 37592, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeNotification.GetGalaxyAtWarRatingsCompleted" },	// 3501
+	{ 37618, "Function SFXOnlineFoundation.SFXOnlineJob.Execute" },	// 3502
+	{ 37620, "Function SFXOnlineFoundation.SFXOnlineJob.InProgress" },	// 3503
+	{ 37622, "Function SFXOnlineFoundation.SFXOnlineJob.Cancel" },	// 3504
+	{ 37626, "Function SFXOnlineFoundation.SFXOnlineJob.EndProcessing" },	// 3505
+	{ 37628, "Function SFXOnlineFoundation.SFXOnlineJob.OnRelease" },	// 3506
+	{ 37629, "Function SFXOnlineFoundation.SFXOnlineJob.DeleteBlazeJobs" },	// 3507
+	{ 37630, "Function SFXOnlineFoundation.SFXOnlineJob.DoExecute" },	// 3508
+	{ 37632, "Function SFXOnlineFoundation.SFXOnlineJob.IsBlocking" },	// 3509
+	{ 37634, "Function SFXOnlineFoundation.SFXOnlineJob.Tick" },	// 3510
+	{ 37635, "Function SFXOnlineFoundation.SFXOnlineJob.ShouldReschedule" },	// 3511
+	{ 37637, "Function SFXOnlineFoundation.SFXOnlineJob.GetSchedulingsLeft" },	// 3512
+	{ 37638, "Function SFXOnlineFoundation.SFXOnlineJob.GetId" },	// 3513
+	{ 37641, "Function SFXOnlineFoundation.SFXOnlineJob.GetJobType" },	// 3514
+	{ 37644, "Function SFXOnlineFoundation.SFXOnlineJob.GetJobCategory" },	// 3515
+	{ 37648, "Function SFXOnlineFoundation.SFXOnlineJob.CancelBlazeJobs" },	// 3516
+	{ 37651, "Function SFXOnlineFoundation.SFXOnlineJob.IsCanceled" },	// 3517
+	{ 37653, "Function SFXOnlineFoundation.SFXOnlineJob.SetId" },	// 3518
+	{ 37663, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.OnFlushOnlineStatsComplete" },	// 3519
+	{ 37664, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.OnReadOnlineStatsComplete" },	// 3520
+	{ 37666, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.OnRegisterHostStatGuidComplete" },	// 3521
+	{ 37668, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.OnInitialize" },	// 3522
+	{ 37670, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.OnRelease" },	// 3523
+	{ 37671, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.GetAPIName" },	// 3524
+	{ 37673, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.WriteOnlineStats" },	// 3525
+	{ 37678, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.FlushOnlineStats" },	// 3526
+	{ 37681, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.GetStatsGroupNames" },	// 3527
+	{ 37685, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.GetFriendsStatsData" },	// 3528
+	{ 37689, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.OnResultsRetrieved" },	// 3529
+	{ 37692, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.RequestReadStatsGroupList" },	// 3530
+	{ 37693, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.ReadStatsGroupList" },	// 3531
+	{ 37696, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.OnReadStatsGroupListCompleted" },	// 3532
+	{ 37697, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.AddFlushOnlineStatsCompleteDelegate" },	// 3533
+	{ 37699, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.ClearFlushOnlineStatsCompleteDelegate" },	// 3534
+	{ 37701, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.ReadOnlineStats" },	// 3535
+	{ 37706, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.ReadOnlineStatsForFriends" },	// 3536
+	{ 37710, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.ReadOnlineStatsByRank" },	// 3537
+	{ 37715, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.ReadOnlineStatsByRankAroundPlayer" },	// 3538
+	{ 37720, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.AddReadOnlineStatsCompleteDelegate" },	// 3539
+	{ 37722, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.ClearReadOnlineStatsCompleteDelegate" },	// 3540
+	{ 37724, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.FreeStats" },	// 3541
+	{ 37726, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.WriteOnlinePlayerScores" },	// 3542
+	{ 37732, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.GetHostStatGuid" },	// 3543
+	{ 37734, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.RegisterHostStatGuid" },	// 3544
+	{ 37737, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.AddRegisterHostStatGuidCompleteDelegate" },	// 3545
+	{ 37739, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.ClearRegisterHostStatGuidCompleteDelegateDelegate" },	// 3546
+	{ 37741, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.GetClientStatGuid" },	// 3547
+	{ 37743, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.RegisterStatGuid" },	// 3548
+	{ 37747, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.CreateJobGameReporting" },	// 3549
+	{ 37750, "Function SFXOnlineFoundation.SFXOnlineJobGameReporting.CreateJob" },	// 3550
+	{ 37752, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.CreateJobGetStatsGroupList" },	// 3551
+	{ 37754, "Function SFXOnlineFoundation.SFXOnlineJobGetStatsGroupList.CreateGetStatsGroupListJob" },	// 3552
+	{ 37768, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.OnGetRankNotifications" },	// 3553
+	{ 37772, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeStats.GameReportingCallback" },	// 3554
+	{ 37789, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeTelemetry.OnInitialize" },	// 3555
+	{ 37791, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeTelemetry.OnRelease" },	// 3556
+	{ 37792, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeTelemetry.GetAPIName" },	// 3557
+	{ 37794, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeTelemetry.CanCollect" },	// 3558
+	{ 37796, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeTelemetry.OnAuthenticate" },	// 3559
+	{ 37797, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeTelemetry.OnDisconnect" },	// 3560
+	{ 37802, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeTelemetry.RegisterConnectionDelegates" },	// 3561
+	{ 37809, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeTelemetry.Flush" },	// 3562
+	{ 37811, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeTelemetry.OnTick" },	// 3563
+	{ 37834, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.OnInitialize" },	// 3564
+	{ 37836, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.OnRelease" },	// 3565
+	{ 37837, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.GetAPIName" },	// 3566
+	{ 37839, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.OnTick" },	// 3567
+	{ 37841, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.OnRefreshDigitalRightsResult" },	// 3568
+	{ 37843, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.RefreshDigitalRights" },	// 3569
+	{ 37845, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.GetEntitlementsList" },	// 3570
+	{ 37849, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.GetEntitlementInfo" },	// 3571
+	{ 37854, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.GetConsumablesList" },	// 3572
+	{ 37858, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.GetConsumableInfo" },	// 3573
+	{ 37863, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.OnConsumeResult" },	// 3574
+	{ 37867, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.ConsumeId" },	// 3575
+	{ 37872, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.OnGrantEntitlementResult" },	// 3576
+	{ 37875, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.GrantEntitlementId" },	// 3577
+	{ 37880, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.OnProcessAutoGrantsComplete" },	// 3578
+	{ 37881, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.ProcessAutoGrants" },	// 3579
+	{ 37883, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.ProcessNextAutoGrant" },	// 3580
+	{ 37886, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.CompleteProcessAutoGrant" },	// 3581
+	{ 37887, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.OnPromptRedeemCodeResult" },	// 3582
+	{ 37889, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.PromptRedeemCode" },	// 3583
+	{ 37891, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.SubmitRedeemCode" },	// 3584
+	{ 37894, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.OnCodeRedeemed" },	// 3585
+	{ 37896, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.OnPurchaseOfferIdResult" },	// 3586
+	{ 37898, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.PurchaseOfferId" },	// 3587
+	{ 37901, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.Display1stPartyStore" },	// 3588
+	{ 37902, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.GetOffersList" },	// 3589
+	{ 37910, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.OnFetchOfferDetailsComplete" },	// 3590
+	{ 37911, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.FetchOfferDetails" },	// 3591
+	{ 37915, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.GetWalletBalance" },	// 3592
+	{ 37918, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.OnDimeConfigLoaded" },	// 3593
+	{ 37919, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.LoadDimeConfig" },	// 3594
+	{ 37922, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.NucleusEntitlementsRefreshOffline" },	// 3595
+	{ 37923, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.DumpTestData" },	// 3596
+	{ 37924, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.StoreOfflineEntitlementInfo" },	// 3597
+	{ 37927, "Function SFXOnlineFoundation.SFXOnlineComponentCommerce.DecryptOfflineEntitlementInfo" },	// 3598
+	{ 37942, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.OnEvent" },	// 3599
+	{ 37944, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.OnTick" },	// 3600
+	{ 37946, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyEventType" },	// 3601
+	{ 37950, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyEventObject" },	// 3602
+	{ 37952, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyWorkStartedType" },	// 3603
+	{ 37956, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyWorkStartedObject" },	// 3604
+	{ 37961, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyWorkFinishedType" },	// 3605
+	{ 37965, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyWorkFinishedObject" },	// 3606
+	{ 37968, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.SubscribeToEvent" },	// 3607
+	{ 37971, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.UnsubscribeFromEvent" },	// 3608
+	{ 37974, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.UnsubscribeFromAllEvents" },	// 3609
+	{ 37976, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.GetEvent" },	// 3610
+	{ 37980, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.IsEventPending" },	// 3611
+	{ 37984, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.IsAnyEventPending" },	// 3612
+	{ 37987, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.GetAllPendingEvents" },	// 3613
+	{ 37992, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.WaitingForWorkType" },	// 3614
+	{ 37996, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.WaitingForWorkObject" },	// 3615
+	{ 37999, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.WaitingForWorkBlocking" },	// 3616
+	{ 38002, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.WaitingForWorkSetType" },	// 3617
+	{ 38008, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.WaitingForWorkSetObject" },	// 3618
+	{ 38012, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.StopWaitingForAllWork" },	// 3619
+	{ 38014, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.OnInitialize" },	// 3620
+	{ 38016, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.OnRelease" },	// 3621
+	{ 38017, "Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.GetAPIName" },	// 3622
+	{ 38028, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.AuthenticateCompleted" },	// 3623
+	{ 38030, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.OnGetRatingsComplete" },	// 3624
+	{ 38037, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.OnIncreaseRatingsComplete" },	// 3625
+	{ 38044, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.OnSendMessageComplete" },	// 3626
+	{ 38049, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.OnGetMessagesComplete" },	// 3627
+	{ 38053, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.OnTouchMessagesComplete" },	// 3628
+	{ 38056, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.GetRatings" },	// 3629
+	{ 38060, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.IncreaseRatings" },	// 3630
+	{ 38067, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.SendMessage" },	// 3631
+	{ 38073, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.GetMessages" },	// 3632
+	{ 38076, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.TouchMessages" },	// 3633
+	{ 38079, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.GetAuthenticationHTTPRequest" },	// 3634
+	{ 38083, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.GetRatingsHTTPRequest" },	// 3635
+	{ 38086, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.GetIncreaseRatingsHTTPRequest" },	// 3636
+	{ 38093, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.GetSendMessageHTTPRequest" },	// 3637
+	{ 38099, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.GetGetMessagesHTTPRequest" },	// 3638
+	{ 38102, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.GetTouchMessagesHTTPRequest" },	// 3639
+	{ 38105, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.GetFirstBlazeAttrId" },	// 3640
+	{ 38107, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.OnInitialize" },	// 3641
+	{ 38109, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.OnRelease" },	// 3642
+	{ 38110, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.GetAPIName" },	// 3643
+	{ 38112, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.Cleanup" },	// 3644
+	{ 38113, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.SetBaseURL" },	// 3645
+	{ 38116, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.CreateJobGaWGetRatings" },	// 3646
+	{ 38120, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPGetRatings.CreateGaWGetRatingsJob" },	// 3647
+	{ 38122, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.CreateJobGaWIncreaseRatings" },	// 3648
+	{ 38130, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPIncreaseRatings.CreateGaWIncreaseRatingsJob" },	// 3649
+	{ 38132, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.CreateJobGaWSendMessage" },	// 3650
+	{ 38139, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPSendMessage.CreateGaWSendMessageJob" },	// 3651
+	{ 38141, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.CreateJobGaWGetMessages" },	// 3652
+	{ 38145, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPGetMessages.CreateGaWGetMessagesJob" },	// 3653
+	{ 38147, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.CreateJobGaWTouchMessages" },	// 3654
+	{ 38151, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPTouchMessages.CreateGaWTouchMessagesJob" },	// 3655
+	{ 38153, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.IsSessionValid" },	// 3656
+	{ 38156, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.InvalidateSession" },	// 3657
+	{ 38157, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.ParseAuthenticationResult" },	// 3658
+	{ 38167, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentXMLParser" },	// 3659
+	{ 38170, "Function SFXOnlineFoundation.SFXOnlineComponentXMLParser.GetXMLInteger" },	// 3660
+	{ 38172, "Function SFXOnlineFoundation.SFXOnlineComponentXMLParser.GetXMLString" },	// 3661
+	{ 38175, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.ParseHTTPRatingsAssetsLevel" },	// 3662
+	{ 38193, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.ParseSendMessageResult" },	// 3663
+	{ 38205, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.ParseGetMessagesResult" },	// 3664
+	{ 38216, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.ParseTouchMessagesResult" },	// 3665
+	{ 38224, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.TestSendMessageCallback" },	// 3666
+	{ 38230, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.TestGetMessagesCallback" },	// 3667
+	{ 38235, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.TestTouchMessagesCallback" },	// 3668
+	{ 38238, "Function SFXOnlineFoundation.SFXOnlineComponentGalaxyAtWar.TestGetRatingsCallback" },	// 3669
+	{ 38254, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GetStateStr" },	// 3670
+	{ 38259, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.OnInitialize" },	// 3671
+	{ 38261, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.OnRelease" },	// 3672
+	{ 38262, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GetAPIName" },	// 3673
+	{ 38264, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnEnterMPFlow" },	// 3674
+	{ 38266, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnEnterMPGameplay" },	// 3675
+	{ 38268, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnEnterMPGameResults" },	// 3676
+	{ 38270, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnExitMPFlow" },	// 3677
+	{ 38272, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnQuickMatchSent" },	// 3678
+	{ 38274, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnCreateGameSent" },	// 3679
+	{ 38276, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnGameCreated" },	// 3680
+	{ 38279, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnLeaveGame" },	// 3681
+	{ 38281, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnLeaveGameComplete" },	// 3682
+	{ 38283, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnHostAddressResolved" },	// 3683
+	{ 38285, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnInviteAccepted" },	// 3684
+	{ 38288, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnInviteAborted" },	// 3685
+	{ 38290, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnInviteProceed" },	// 3686
+	{ 38292, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnInviteErrorNotified" },	// 3687
+	{ 38294, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnGameJoined" },	// 3688
+	{ 38297, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnGameJoinFailure" },	// 3689
+	{ 38300, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_CancelSearch" },	// 3690
+	{ 38302, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnTick" },	// 3691
+	{ 38304, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnQuickMatchUpdate" },	// 3692
+	{ 38307, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnDisconnect" },	// 3693
+	{ 38309, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnP2PConnectionFailure" },	// 3694
+	{ 38311, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnNetworkErrorDismissed" },	// 3695
+	{ 38313, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnProfileSelected" },	// 3696
+	{ 38315, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnHostMigrationStarted" },	// 3697
+	{ 38318, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnHostMigrationEnded" },	// 3698
+	{ 38321, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_HasCreatedGame" },	// 3699
+	{ 38323, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_HasJoinedGame" },	// 3700
+	{ 38325, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_HasFailedConnecting" },	// 3701
+	{ 38327, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_HasFailedJoiningFullGame" },	// 3702
+	{ 38329, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_HasFailedJoiningInviterLeft" },	// 3703
+	{ 38331, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_HasFailedJoiningGameProtocolMismatch" },	// 3704
+	{ 38333, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_HasFailedJoiningGameMissingDLCInviter" },	// 3705
+	{ 38335, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_HasFailedJoiningGameMissingDLCInvitee" },	// 3706
+	{ 38337, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_HasFailedConnecting_QM" },	// 3707
+	{ 38339, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_IsLeavingGame" },	// 3708
+	{ 38341, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_IsInMultiplayerFlow" },	// 3709
+	{ 38343, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_IsInInviteFlow" },	// 3710
+	{ 38345, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_IsInMultiplayerGame" },	// 3711
+	{ 38347, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_IsInMPMapAction" },	// 3712
+	{ 38349, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_IsConnectionErrorSilent" },	// 3713
+	{ 38351, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.MatchMakingTimeStatusUpdate" },	// 3714
+	{ 38354, "Function SFXOnlineFoundation.SFXOnlineEvent_Integer.SetInteger" },	// 3715
+	{ 38579, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.DebugValidateStates" },	// 3716
+	{ 38582, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.DebugTestInput" },	// 3717
+	{ 38585, "Function SFXOnlineFoundation.SFXOnlineComponentGameFlow.GM_OnQuickMatchUpdateEvent" },	// 3718
+	{ 38592, "Function SFXOnlineFoundation.SFXOnlineComponentHTTPManager.OnInitialize" },	// 3719
+	{ 38594, "Function SFXOnlineFoundation.SFXOnlineComponentHTTPManager.OnRelease" },	// 3720
+	{ 38595, "Function SFXOnlineFoundation.SFXOnlineComponentHTTPManager.GetAPIName" },	// 3721
+	{ 38597, "Function SFXOnlineFoundation.SFXOnlineComponentHTTPManager.OnTick" },	// 3722
+	{ 38601, "Function SFXOnlineFoundation.SFXOnlineComponentHTTPManager.StartService" },	// 3723
+	{ 38602, "Function SFXOnlineFoundation.SFXOnlineComponentHTTPManager.StartRequest" },	// 3724
+	{ 38605, "Function SFXOnlineFoundation.SFXOnlineComponentHTTPManager.FetchBodyData" },	// 3725
+	{ 38608, "Function SFXOnlineFoundation.SFXOnlineComponentHTTPManager.FetchStatus" },	// 3726
+	{ 38611, "Function SFXOnlineFoundation.SFXOnlineComponentHTTPManager.ProcessDownload" },	// 3727
+	{ 38615, "Function SFXOnlineFoundation.SFXOnlineComponentHTTPManager.QueueRequest" },	// 3728
+	{ 38618, "Function SFXOnlineFoundation.SFXOnlineComponentHTTPManager.OnIdleTick" },	// 3729
+	{ 38623, "Function SFXOnlineFoundation.SFXOnlineComponentHTTPManager.OnDownloadingTick" },	// 3730
+	{ 38641, "Function SFXOnlineFoundation.SFXOnlineComponentImageManager.SetBaseURL" },	// 3731
+	{ 38644, "Function SFXOnlineFoundation.SFXOnlineComponentImageManager.SetMaxImages" },	// 3732
+	{ 38647, "Function SFXOnlineFoundation.SFXOnlineComponentImageManager.SetMaxBytes" },	// 3733
+	{ 38650, "Function SFXOnlineFoundation.SFXOnlineComponentImageManager.OnImageRequestCompleted" },	// 3734
+	{ 38652, "Function SFXOnlineFoundation.SFXOnlineComponentImageManager.OnInitialize" },	// 3735
+	{ 38654, "Function SFXOnlineFoundation.SFXOnlineComponentImageManager.OnRelease" },	// 3736
+	{ 38655, "Function SFXOnlineFoundation.SFXOnlineComponentImageManager.GetAPIName" },	// 3737
+	{ 38657, "Function SFXOnlineFoundation.SFXOnlineComponentImageManager.ProcessImage" },	// 3738
+	{ 38659, "Function SFXOnlineFoundation.SFXOnlineComponentImageManager.ClearReferences" },	// 3739
+	{ 38660, "Function SFXOnlineFoundation.SFXOnlineComponentImageManager.RequestImage" },	// 3740
+	{ 38664, "Function SFXOnlineFoundation.SFXOnlineJobImageRequest.CreateImageRequestJob" },	// 3741
+	{ 38668, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentJobQueue" },	// 3742
+	{ 38670, "Function SFXOnlineFoundation.SFXOnlineComponentJobQueue.AddJob" },	// 3743
+	{ 38672, "Function SFXOnlineFoundation.SFXOnlineComponentImageManager.GetImage" },	// 3744
+	{ 38676, "Function SFXOnlineFoundation.SFXOnlineComponentImageManager.StartRequest" },	// 3745
+	{ 38680, "Function SFXOnlineFoundation.SFXOnlineJobHTTPRequest.CreateHTTPRequestJob" },	// 3746
+	{ 38685, "Function SFXOnlineFoundation.SFXOnlineComponentImageManager.AddPendingRequest" },	// 3747
+	{ 38688, "Function SFXOnlineFoundation.SFXOnlineComponentImageManager.AddCompletedRequest" },	// 3748
+	{ 38691, "Function SFXOnlineFoundation.SFXOnlineComponentImageManager.RemoveRequest" },	// 3749
+	{ 38697, "Function SFXOnlineFoundation.SFXOnlineComponentImageManager.SumTotalSize" },	// 3750
+	{ 38702, "Function SFXOnlineFoundation.SFXOnlineComponentImageManager.OnJobComplete" },	// 3751
+	{ 38711, "Function SFXOnlineFoundation.SFXOnlineComponentJobQueue.SetJobThrottle" },	// 3752
+	{ 38714, "Function SFXOnlineFoundation.SFXOnlineComponentJobQueue.UpdateTime" },	// 3753
+	{ 38720, "Function SFXOnlineFoundation.SFXOnlineComponentJobQueue.GetPendingJob" },	// 3754
+	{ 38724, "Function SFXOnlineFoundation.SFXOnlineComponentJobQueue.GetProcessingJob" },	// 3755
+	{ 38728, "Function SFXOnlineFoundation.SFXOnlineComponentJobQueue.GetFirstPendingJob" },	// 3756
+	{ 38731, "Function SFXOnlineFoundation.SFXOnlineComponentJobQueue.ProcessJobs" },	// 3757
+	{ 38745, "Function SFXOnlineFoundation.SFXOnlineComponentJobQueue.JobPredicate" },	// 3758
+	{ 38748, "Function SFXOnlineFoundation.SFXOnlineComponentJobQueue.CheckForJobInArray" },	// 3759
+	{ 38757, "Function SFXOnlineFoundation.SFXOnlineComponentJobQueue.CheckForProcessingJob" },	// 3760
+	{ 38761, "Function SFXOnlineFoundation.SFXOnlineComponentJobQueue.CheckForPendingJob" },	// 3761
+	{ 38765, "Function SFXOnlineFoundation.SFXOnlineComponentJobQueue.CheckForJob" },	// 3762
+	{ 38769, "Function SFXOnlineFoundation.SFXOnlineComponentJobQueue.CancelJobs" },	// 3763
+	{ 38778, "Function SFXOnlineFoundation.SFXOnlineComponentJobQueue.CancelJob" },	// 3764
+	{ 38784, "Function SFXOnlineFoundation.SFXOnlineComponentJobQueue.GetAPIName" },	// 3765
+	{ 38786, "Function SFXOnlineFoundation.SFXOnlineComponentJobQueue.OnInitialize" },	// 3766
+	{ 38788, "Function SFXOnlineFoundation.SFXOnlineComponentJobQueue.OnRelease" },	// 3767
+	{ 38789, "Function SFXOnlineFoundation.SFXOnlineComponentJobQueue.OnTick" },	// 3768
+	{ 38813, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.OnOriginClosedDelegate" },	// 3769
+	{ 38816, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.OnOriginAuthKey" },	// 3770
+	{ 38819, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.OnWalletBalanceAvailable" },	// 3771
+	{ 38824, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.AddOriginClosedDelegate" },	// 3772
+	{ 38826, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.ClearOriginClosedDelegate" },	// 3773
+	{ 38829, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.TriggerOriginClosedDelegates" },	// 3774
+	{ 38831, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.AddOriginAuthKeyDelegate" },	// 3775
+	{ 38833, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.ClearOriginAuthKeyDelegate" },	// 3776
+	{ 38836, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.TriggerOriginAuthKeyDelegates" },	// 3777
+	{ 38840, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.AddWalletBalanceAvailableDelegate" },	// 3778
+	{ 38842, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.ClearWalletBalanceAvailableDelegate" },	// 3779
+	{ 38845, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.TriggerWalletBalanceAvailableDelegates" },	// 3780
+	{ 38849, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.OnInitialize" },	// 3781
+	{ 38851, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.OnRelease" },	// 3782
+	{ 38852, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.GetAPIName" },	// 3783
+	{ 38854, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.StartService" },	// 3784
+	{ 38856, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.StopService" },	// 3785
+	{ 38858, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.RegisterCallbacks" },	// 3786
+	{ 38860, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.RequestProfileInfo" },	// 3787
+	{ 38861, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.RequestAuthToken" },	// 3788
+	{ 38862, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.ShowFriendsOverlay" },	// 3789
+	{ 38864, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.ShowInviteOverlay" },	// 3790
+	{ 38866, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.ShowStoreOverlay" },	// 3791
+	{ 38869, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.ShowCheckoutOverlay" },	// 3792
+	{ 38872, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.Checkout" },	// 3793
+	{ 38875, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.RequestFriendsList" },	// 3794
+	{ 38877, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.SetSessionPresence" },	// 3795
+	{ 38880, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.ClearSessionPresence" },	// 3796
+	{ 38882, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.SetRichPresence" },	// 3797
+	{ 38886, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.SetPresenceState" },	// 3798
+	{ 38889, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.JoinPendingGameInvite" },	// 3799
+	{ 38890, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.CheckOnline" },	// 3800
+	{ 38892, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.QueryOnline" },	// 3801
+	{ 38894, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.QueryIgoEnabled" },	// 3802
+	{ 38896, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.CheckSignedIn" },	// 3803
+	{ 38898, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.CheckEntitlementCache" },	// 3804
+	{ 38900, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.OnBlazeSignedIn" },	// 3805
+	{ 38902, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.ProcessIGODisplayEvent" },	// 3806
+	{ 38904, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.RequestEntitlementCache" },	// 3807
+	{ 38905, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.RequestBlockList" },	// 3808
+	{ 38906, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.RequestWalletBalance" },	// 3809
+	{ 38907, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.OnTick" },	// 3810
+	{ 38909, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.OnOriginClosed" },	// 3811
+	{ 38910, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.OnOriginGoesOffline" },	// 3812
+	{ 38911, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.IsMuted" },	// 3813
+	{ 38915, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.ProcessAchievementQueue" },	// 3814
+	{ 38954, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.RefreshServerAchievements_ASync" },	// 3815
+	{ 38956, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.IsAchievementGranted" },	// 3816
+	{ 38958, "Function SFXOnlineFoundation.SFXOnlineComponentOrigin.GrantAchievement" },	// 3817
+	{ 38965, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.OnInitialize" },	// 3818
+	{ 38967, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.OnRelease" },	// 3819
+	{ 38968, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetAPIName" },	// 3820
+	{ 38970, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.AddRecentPlayer" },	// 3821
+	{ 38974, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetLoginStatus" },	// 3822
+	{ 38977, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowLoginUI" },	// 3823
+	{ 38980, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.SetRichPresence" },	// 3824
+	{ 38987, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanPlayOnline" },	// 3825
+	{ 38990, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanCommunicate" },	// 3826
+	{ 38993, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanDownloadUserContent" },	// 3827
+	{ 38996, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanPurchaseContent" },	// 3828
+	{ 38999, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanViewPlayerProfiles" },	// 3829
+	{ 39002, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanShowPresenceInformation" },	// 3830
+	{ 39005, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowGamerCardUI" },	// 3831
+	{ 39009, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowFeedbackUI" },	// 3832
+	{ 39013, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowAchievementsUI" },	// 3833
+	{ 39016, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowFriendsUI" },	// 3834
+	{ 39019, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowFriendsInviteUI" },	// 3835
+	{ 39023, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowInviteUI" },	// 3836
+	{ 39027, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowKeyboardUI" },	// 3837
+	{ 39037, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetOfflineXuid" },	// 3838
+	{ 39041, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetOnlineXuid" },	// 3839
+	{ 39045, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowStoreUI" },	// 3840
+	{ 39047, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ReadFriendsList" },	// 3841
+	{ 39052, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetFriendsList" },	// 3842
+	{ 39059, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetMinimumAgeForOnlinePlay" },	// 3843
+	{ 39061, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowVoiceCommandTunerUI" },	// 3844
+	{ 39063, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowInbox" },	// 3845
+	{ 39081, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnInitialize" },	// 3846
+	{ 39083, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnRelease" },	// 3847
+	{ 39084, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.RegisterPS3CustomMenuActions" },	// 3848
+	{ 39085, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetAPIName" },	// 3849
+	{ 39087, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnTick" },	// 3850
+	{ 39089, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnKeyboardUI" },	// 3851
+	{ 39091, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnPlayerSeen" },	// 3852
+	{ 39093, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.DispatchInviteEvent" },	// 3853
+	{ 39094, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.AddRecentPlayer" },	// 3854
+	{ 39098, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetLoginStatus" },	// 3855
+	{ 39101, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowLoginUI" },	// 3856
+	{ 39104, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnSignInComplete" },	// 3857
+	{ 39107, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.SetRichPresence" },	// 3858
+	{ 39114, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanPlayOnline" },	// 3859
+	{ 39117, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanCommunicate" },	// 3860
+	{ 39120, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanDownloadUserContent" },	// 3861
+	{ 39123, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanPurchaseContent" },	// 3862
+	{ 39126, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanViewPlayerProfiles" },	// 3863
+	{ 39129, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanShowPresenceInformation" },	// 3864
+	{ 39132, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowGamerCardUI" },	// 3865
+	{ 39136, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowFeedbackUI" },	// 3866
+	{ 39140, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowAchievementsUI" },	// 3867
+	{ 39143, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowFriendsUI" },	// 3868
+	{ 39146, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowFriendsInviteUI" },	// 3869
+	{ 39150, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowInviteUI" },	// 3870
+	{ 39154, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowKeyboardUI" },	// 3871
+	{ 39164, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetOfflineXuid" },	// 3872
+	{ 39168, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetOnlineXuid" },	// 3873
+	{ 39172, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowStoreUI" },	// 3874
+	{ 39174, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ReadFriendsList" },	// 3875
+	{ 39179, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetFriendsList" },	// 3876
+	{ 39186, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetMinimumAgeForOnlinePlay" },	// 3877
+	{ 39188, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowVoiceCommandTunerUI" },	// 3878
+	{ 39190, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetInviterUniqueNetId" },	// 3879
+	{ 39193, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.StartInviteFlow" },	// 3880
+	{ 39195, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowInbox" },	// 3881
+	{ 39218, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.OnInitialize" },	// 3882
+	{ 39220, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.OnRelease" },	// 3883
+	{ 39221, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetAPIName" },	// 3884
+	{ 39223, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.AddRecentPlayer" },	// 3885
+	{ 39227, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.IsPlayerInParty" },	// 3886
+	{ 39230, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.IsPlayerInActiveParty" },	// 3887
+	{ 39232, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.OnTick" },	// 3888
+	{ 39234, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.TickAsyncTasks" },	// 3889
+	{ 39235, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetLoginStatus" },	// 3890
+	{ 39238, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowLoginUI" },	// 3891
+	{ 39241, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.SetRichPresence" },	// 3892
+	{ 39248, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanPlayOnline" },	// 3893
+	{ 39251, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanCommunicate" },	// 3894
+	{ 39254, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanDownloadUserContent" },	// 3895
+	{ 39257, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanPurchaseContent" },	// 3896
+	{ 39260, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanViewPlayerProfiles" },	// 3897
+	{ 39263, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanShowPresenceInformation" },	// 3898
+	{ 39266, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowGamerCardUI" },	// 3899
+	{ 39270, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowFeedbackUI" },	// 3900
+	{ 39274, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowAchievementsUI" },	// 3901
+	{ 39277, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowFriendsUI" },	// 3902
+	{ 39280, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowFriendsInviteUI" },	// 3903
+	{ 39284, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowInviteUI" },	// 3904
+	{ 39288, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowKeyboardUI" },	// 3905
+	{ 39298, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetOfflineXuid" },	// 3906
+	{ 39302, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetOnlineXuid" },	// 3907
+	{ 39306, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowStoreUI" },	// 3908
+	{ 39308, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ReadFriendsList" },	// 3909
+	{ 39313, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetFriendsList" },	// 3910
+	{ 39320, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetMinimumAgeForOnlinePlay" },	// 3911
+	{ 39322, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowVoiceCommandTunerUI" },	// 3912
+	{ 39324, "Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowInbox" },	// 3913
+	{ 39342, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReadPlayerStorageComplete" },	// 3914
+	{ 39345, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnWritePlayerStorageComplete" },	// 3915
+	{ 39348, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReadPlayerStorageForNetIdComplete" },	// 3916
+	{ 39351, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReadFriendsComplete" },	// 3917
+	{ 39354, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnLoginCancelled" },	// 3918
+	{ 39357, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnLoginFailed" },	// 3919
+	{ 39360, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnLogoutCompleted" },	// 3920
+	{ 39363, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnLoginChange" },	// 3921
+	{ 39367, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReadProfileSettingsComplete" },	// 3922
+	{ 39370, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnWriteProfileSettingsComplete" },	// 3923
+	{ 39373, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnProfileDataChanged" },	// 3924
+	{ 39385, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnUnlockAchievementComplete" },	// 3925
+	{ 39388, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReadAchievementsComplete" },	// 3926
+	{ 39392, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnLoginStatusChange" },	// 3927
+	{ 39393, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnInitialize" },	// 3928
+	{ 39395, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnRelease" },	// 3929
+	{ 39396, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetAPIName" },	// 3930
+	{ 39398, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnTick" },	// 3931
+	{ 39400, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.DoesProfileExist" },	// 3932
+	{ 39402, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CreateProfileName" },	// 3933
+	{ 39404, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CachePlayerNickname" },	// 3934
+	{ 39406, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnMutingChange" },	// 3935
+	{ 39407, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnFriendsChange" },	// 3936
+	{ 39408, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearProfileCaches" },	// 3937
+	{ 39409, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ShowLoginUI" },	// 3938
+	{ 39412, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.Login" },	// 3939
+	{ 39418, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AutoLogin" },	// 3940
+	{ 39422, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddLoginFailedDelegate" },	// 3941
+	{ 39425, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearLoginFailedDelegate" },	// 3942
+	{ 39429, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.Logout" },	// 3943
+	{ 39433, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddLogoutCompletedDelegate" },	// 3944
+	{ 39436, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearLogoutCompletedDelegate" },	// 3945
+	{ 39440, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetLoginStatus" },	// 3946
+	{ 39445, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetOfflinePlayerId" },	// 3947
+	{ 39449, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetUniquePlayerId" },	// 3948
+	{ 39453, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetPlayerNickname" },	// 3949
+	{ 39456, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.IsGuestLogin" },	// 3950
+	{ 39459, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.IsLocalLogin" },	// 3951
+	{ 39462, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanPlayOnline" },	// 3952
+	{ 39465, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanCommunicate" },	// 3953
+	{ 39468, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanDownloadUserContent" },	// 3954
+	{ 39471, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanPurchaseContent" },	// 3955
+	{ 39474, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanViewPlayerProfiles" },	// 3956
+	{ 39477, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanShowPresenceInformation" },	// 3957
+	{ 39480, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.IsFriend" },	// 3958
+	{ 39484, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AreAnyFriends" },	// 3959
+	{ 39489, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.IsMuted" },	// 3960
+	{ 39493, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ShowFriendsUI" },	// 3961
+	{ 39496, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddLoginChangeDelegate" },	// 3962
+	{ 39498, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearLoginChangeDelegate" },	// 3963
+	{ 39503, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddLoginStatusChangeDelegate" },	// 3964
+	{ 39507, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearLoginStatusChangeDelegate" },	// 3965
+	{ 39511, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddLoginCancelledDelegate" },	// 3966
+	{ 39513, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearLoginCancelledDelegate" },	// 3967
+	{ 39516, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddMutingChangeDelegate" },	// 3968
+	{ 39518, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearMutingChangeDelegate" },	// 3969
+	{ 39520, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddFriendsChangeDelegate" },	// 3970
+	{ 39523, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearFriendsChangeDelegate" },	// 3971
+	{ 39526, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ReadProfileSettings" },	// 3972
+	{ 39532, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReadProfileSettingsCompleteDelegate" },	// 3973
+	{ 39536, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReadProfileSettingsCompleteDelegate" },	// 3974
+	{ 39540, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetProfileSettings" },	// 3975
+	{ 39543, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.WriteProfileSettings" },	// 3976
+	{ 39549, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddWriteProfileSettingsCompleteDelegate" },	// 3977
+	{ 39552, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearWriteProfileSettingsCompleteDelegate" },	// 3978
+	{ 39556, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ReadPlayerStorage" },	// 3979
+	{ 39562, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReadPlayerStorageCompleteDelegate" },	// 3980
+	{ 39565, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReadPlayerStorageCompleteDelegate" },	// 3981
+	{ 39569, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ReadPlayerStorageForNetId" },	// 3982
+	{ 39575, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReadPlayerStorageForNetIdCompleteDelegate" },	// 3983
+	{ 39578, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReadPlayerStorageForNetIdCompleteDelegate" },	// 3984
+	{ 39582, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetPlayerStorage" },	// 3985
+	{ 39586, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.WritePlayerStorage" },	// 3986
+	{ 39592, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddWritePlayerStorageCompleteDelegate" },	// 3987
+	{ 39595, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearWritePlayerStorageCompleteDelegate" },	// 3988
+	{ 39599, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ReadFriendsList" },	// 3989
+	{ 39605, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReadFriendsCompleteDelegate" },	// 3990
+	{ 39608, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReadFriendsCompleteDelegate" },	// 3991
+	{ 39612, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetFriendsList" },	// 3992
+	{ 39619, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.SetOnlineStatus" },	// 3993
+	{ 39626, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ShowKeyboardUI" },	// 3994
+	{ 39635, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnKeyboardInputComplete" },	// 3995
+	{ 39637, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddKeyboardInputDoneDelegate" },	// 3996
+	{ 39639, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearKeyboardInputDoneDelegate" },	// 3997
+	{ 39641, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetKeyboardInputResults" },	// 3998
+	{ 39644, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddFriend" },	// 3999
+	{ 39649, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddFriendByName" },	// 4000
+	{ 39654, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnAddFriendByNameComplete" },	// 4001
+	{ 39656, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddAddFriendByNameCompleteDelegate" },	// 4002
+	{ 39659, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearAddFriendByNameCompleteDelegate" },	// 4003
+	{ 39662, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AcceptFriendInvite" },	// 4004
+	{ 39666, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.DenyFriendInvite" },	// 4005
+	{ 39670, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.RemoveFriend" },	// 4006
+	{ 39674, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnFriendInviteReceived" },	// 4007
+	{ 39679, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddFriendInviteReceivedDelegate" },	// 4008
+	{ 39682, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearFriendInviteReceivedDelegate" },	// 4009
+	{ 39685, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.SendMessageToFriend" },	// 4010
+	{ 39690, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.SendGameInviteToFriend" },	// 4011
+	{ 39695, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.SendGameInviteToFriends" },	// 4012
+	{ 39701, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReceivedGameInvite" },	// 4013
+	{ 39704, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReceivedGameInviteDelegate" },	// 4014
+	{ 39707, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReceivedGameInviteDelegate" },	// 4015
+	{ 39710, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.JoinFriendGame" },	// 4016
+	{ 39714, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnJoinFriendGameComplete" },	// 4017
+	{ 39716, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddJoinFriendGameCompleteDelegate" },	// 4018
+	{ 39718, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearJoinFriendGameCompleteDelegate" },	// 4019
+	{ 39720, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetFriendMessages" },	// 4020
+	{ 39724, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnFriendMessageReceived" },	// 4021
+	{ 39729, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddFriendMessageReceivedDelegate" },	// 4022
+	{ 39732, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearFriendMessageReceivedDelegate" },	// 4023
+	{ 39735, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.DeleteMessage" },	// 4024
+	{ 39739, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ReadAchievements" },	// 4025
+	{ 39746, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReadAchievementsCompleteDelegate" },	// 4026
+	{ 39750, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReadAchievementsCompleteDelegate" },	// 4027
+	{ 39754, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetAchievements" },	// 4028
+	{ 39760, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.UnlockAchievement" },	// 4029
+	{ 39765, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddUnlockAchievementCompleteDelegate" },	// 4030
+	{ 39768, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearUnlockAchievementCompleteDelegate" },	// 4031
+	{ 39772, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearAsyncState" },	// 4032
+	{ 39774, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CreateJobSaveSettings" },	// 4033
+	{ 39777, "Function SFXOnlineFoundation.SFXOnlineJobSaveSettings.CreateJob" },	// 4034
+	{ 39779, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CreateJobLoadSettings" },	// 4035
+	{ 39782, "Function SFXOnlineFoundation.SFXOnlineJobLoadSettings.CreateJob" },	// 4036
+	{ 39784, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.SaveSettingsCallback" },	// 4037
+	{ 39790, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.LoadSettingsCallback" },	// 4038
+	{ 39798, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.TriggerProfileReadDelegate" },	// 4039
+	{ 39802, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearOnlineProfileCaches" },	// 4040
+	{ 39834, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.OnDeviceSelectionComplete" },	// 4041
+	{ 39837, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.OnInitialize" },	// 4042
+	{ 39839, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.OnRelease" },	// 4043
+	{ 39840, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.GetAPIName" },	// 4044
+	{ 39842, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.OnTick" },	// 4045
+	{ 39844, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowFeedbackUI" },	// 4046
+	{ 39848, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowGamerCardUI" },	// 4047
+	{ 39852, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowMessagesUI" },	// 4048
+	{ 39855, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowAchievementsUI" },	// 4049
+	{ 39858, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowInviteUI" },	// 4050
+	{ 39862, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowContentMarketplaceUI" },	// 4051
+	{ 39867, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowMembershipMarketplaceUI" },	// 4052
+	{ 39870, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowDeviceSelectionUI" },	// 4053
+	{ 39878, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.AddDeviceSelectionDoneDelegate" },	// 4054
+	{ 39883, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ClearDeviceSelectionDoneDelegate" },	// 4055
+	{ 39887, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.GetDeviceSelectionResults" },	// 4056
+	{ 39891, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.IsDeviceValid" },	// 4057
+	{ 39895, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.UnlockGamerPicture" },	// 4058
+	{ 39899, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.OnProfileDataChanged" },	// 4059
+	{ 39900, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.AddProfileDataChangedDelegate" },	// 4060
+	{ 39903, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ClearProfileDataChangedDelegate" },	// 4061
+	{ 39906, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowFriendsInviteUI" },	// 4062
+	{ 39910, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowPlayersUI" },	// 4063
+	{ 39913, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowCustomPlayersUI" },	// 4064
+	{ 39920, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.UnlockAvatarAward" },	// 4065
+	{ 39929, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnExternalUIChange" },	// 4066
+	{ 39932, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnControllerChange" },	// 4067
+	{ 39937, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnReadTitleFileComplete" },	// 4068
+	{ 39940, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnStorageDeviceChange" },	// 4069
+	{ 39943, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnConnectionStatusChange" },	// 4070
+	{ 39946, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnInitialize" },	// 4071
+	{ 39948, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnRelease" },	// 4072
+	{ 39949, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetAPIName" },	// 4073
+	{ 39951, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.HasLinkConnection" },	// 4074
+	{ 39953, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnLinkStatusChange" },	// 4075
+	{ 39955, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddLinkStatusChangeDelegate" },	// 4076
+	{ 39958, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearLinkStatusChangeDelegate" },	// 4077
+	{ 39962, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddExternalUIChangeDelegate" },	// 4078
+	{ 39965, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearExternalUIChangeDelegate" },	// 4079
+	{ 39968, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ProcessExternalUINotification" },	// 4080
+	{ 39970, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetNetworkNotificationPosition" },	// 4081
+	{ 39973, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.SetNetworkNotificationPosition" },	// 4082
+	{ 39977, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddControllerChangeDelegate" },	// 4083
+	{ 39980, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearControllerChangeDelegate" },	// 4084
+	{ 39983, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.IsControllerConnected" },	// 4085
+	{ 39987, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddConnectionStatusChangeDelegate" },	// 4086
+	{ 39990, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearConnectionStatusChangeDelegate" },	// 4087
+	{ 39993, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetNATType" },	// 4088
+	{ 39995, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddStorageDeviceChangeDelegate" },	// 4089
+	{ 39997, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearStorageDeviceChangeDelegate" },	// 4090
+	{ 40002, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ReadTitleFile" },	// 4091
+	{ 40005, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddReadTitleFileCompleteDelegate" },	// 4092
+	{ 40007, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearReadTitleFileCompleteDelegate" },	// 4093
+	{ 40010, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetTitleFileContents" },	// 4094
+	{ 40015, "Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetTitleFileState" },	// 4095
+	{ 40031, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.OnPlayerTalkingStateChange" },	// 4096
+	{ 40037, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.OnInitialize" },	// 4097
+	{ 40039, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.OnRelease" },	// 4098
+	{ 40040, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.GetAPIName" },	// 4099
+	{ 40044, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.OnRecognitionComplete" },	// 4100
+	{ 40045, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.RegisterLocalTalker" },	// 4101
+	{ 40048, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.UnregisterLocalTalker" },	// 4102
+	{ 40051, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.RegisterRemoteTalker" },	// 4103
+	{ 40054, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.UnregisterRemoteTalker" },	// 4104
+	{ 40057, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.IsLocalPlayerTalking" },	// 4105
+	{ 40060, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.IsRemotePlayerTalking" },	// 4106
+	{ 40063, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.GetRemotePlayerStatus" },	// 4107
+	{ 40066, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.IsHeadsetPresent" },	// 4108
+	{ 40069, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.SetRemoteTalkerPriority" },	// 4109
+	{ 40074, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.MuteRemoteTalker" },	// 4110
+	{ 40078, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.UnmuteRemoteTalker" },	// 4111
+	{ 40082, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.IsRemoteTalkerMuted" },	// 4112
+	{ 40086, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.StartNetworkedVoice" },	// 4113
+	{ 40088, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.StopNetworkedVoice" },	// 4114
+	{ 40090, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.StartSpeechRecognition" },	// 4115
+	{ 40093, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.StopSpeechRecognition" },	// 4116
+	{ 40096, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.GetRecognitionResults" },	// 4117
+	{ 40101, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.AddRecognitionCompleteDelegate" },	// 4118
+	{ 40104, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.ClearRecognitionCompleteDelegate" },	// 4119
+	{ 40107, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.SelectVocabulary" },	// 4120
+	{ 40111, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.SetSpeechRecognitionObject" },	// 4121
+	{ 40115, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.MuteAll" },	// 4122
+	{ 40119, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.UnmuteAll" },	// 4123
+	{ 40122, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.SetVolume" },	// 4124
+	{ 40125, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.EnumerateInputDevices" },	// 4125
+	{ 40129, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.EnumerateOutputDevices" },	// 4126
+	{ 40133, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.GetDefaultInputDevice" },	// 4127
+	{ 40135, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.GetDefaultOutputDevice" },	// 4128
+	{ 40137, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.SetInputDevice" },	// 4129
+	{ 40140, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.SetOutputDevice" },	// 4130
+	{ 40143, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.PushToTalkStart" },	// 4131
+	{ 40144, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.PushToTalkEnd" },	// 4132
+	{ 40145, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.SetVoiceMode" },	// 4133
+	{ 40147, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.ApplyOptions" },	// 4134
+	{ 40148, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.ResetVoiceSystem" },	// 4135
+	{ 40149, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.OnTick" },	// 4136
+	{ 40151, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.AddPlayerTalkingDelegate" },	// 4137
+	{ 40154, "Function SFXOnlineFoundation.SFXOnlineComponentVoiceInterface.ClearPlayerTalkingDelegate" },	// 4138
+	{ 40167, "Function SFXOnlineFoundation.SFXOnlineComponentXenonLiveParty.OnSendPartyGameInvitesComplete" },	// 4139
+	{ 40168, "Function SFXOnlineFoundation.SFXOnlineComponentXenonLiveParty.OnInitialize" },	// 4140
+	{ 40170, "Function SFXOnlineFoundation.SFXOnlineComponentXenonLiveParty.OnRelease" },	// 4141
+	{ 40171, "Function SFXOnlineFoundation.SFXOnlineComponentXenonLiveParty.GetAPIName" },	// 4142
+	{ 40173, "Function SFXOnlineFoundation.SFXOnlineComponentXenonLiveParty.SendPartyGameInvites" },	// 4143
+	{ 40177, "Function SFXOnlineFoundation.SFXOnlineComponentXenonLiveParty.AddSendPartyGameInvitesCompleteDelegate" },	// 4144
+	{ 40181, "Function SFXOnlineFoundation.SFXOnlineComponentXenonLiveParty.ClearSendPartyGameInvitesCompleteDelegate" },	// 4145
+	{ 40185, "Function SFXOnlineFoundation.SFXOnlineComponentXenonLiveParty.GetPartyMemberInformation" },	// 4146
+	{ 40189, "Function SFXOnlineFoundation.SFXOnlineComponentXenonLiveParty.SetPartyMemberCustomData" },	// 4147
+	{ 40194, "Function SFXOnlineFoundation.SFXOnlineComponentXenonLiveParty.GetPartyBandwidth" },	// 4148
+	{ 40197, "Function SFXOnlineFoundation.SFXOnlineComponentXenonLiveParty.ShowPartyUI" },	// 4149
+	{ 40200, "Function SFXOnlineFoundation.SFXOnlineComponentXenonLiveParty.ShowVoiceChannelUI" },	// 4150
+	{ 40203, "Function SFXOnlineFoundation.SFXOnlineComponentXenonLiveParty.ShowCommunitySessionsUI" },	// 4151
+	{ 40206, "Function SFXOnlineFoundation.SFXOnlineComponentXenonLiveParty.TickBandwidthTracking" },	// 4152
+	{ 40208, "Function SFXOnlineFoundation.SFXOnlineComponentXenonLiveParty.OnTick" },	// 4153
+	{ 40214, "Function SFXOnlineFoundation.SFXOnlineComponentXMLParser.StartParsing" },	// 4154
+	{ 40222, "Function SFXOnlineFoundation.SFXOnlineComponentXMLParser.GetXMLAttribString" },	// 4155
+	{ 40228, "Function SFXOnlineFoundation.SFXOnlineComponentXMLParser.GetXMLAttribInteger" },	// 4156
+	{ 40234, "Function SFXOnlineFoundation.SFXOnlineComponentXMLParser.OnInitialize" },	// 4157
+	{ 40236, "Function SFXOnlineFoundation.SFXOnlineComponentXMLParser.OnRelease" },	// 4158
+	{ 40237, "Function SFXOnlineFoundation.SFXOnlineComponentXMLParser.GetAPIName" },	// 4159
+	{ 40241, "Function SFXOnlineFoundation.SFXOnlineEvent_Integer.GetInteger" },	// 4160
+	{ 40245, "Function SFXOnlineFoundation.SFXOnlineEvent_String.GetStringData" },	// 4161
+	{ 40247, "Function SFXOnlineFoundation.SFXOnlineEvent_String.SetStringData" },	// 4162
+	{ 40250, "Function SFXOnlineFoundation.SFXOnlineEvent_Notification.GetImageName" },	// 4163
+	{ 40252, "Function SFXOnlineFoundation.SFXOnlineEvent_Notification.SetImageName" },	// 4164
+	{ 40254, "Function SFXOnlineFoundation.SFXOnlineEvent_Notification.GetPriority" },	// 4165
+	{ 40256, "Function SFXOnlineFoundation.SFXOnlineEvent_Notification.SetPriority" },	// 4166
+	{ 40275, "Function SFXOnlineFoundation.SFXOnlineEventList.AddEvent" },	// 4167
+	{ 40278, "Function SFXOnlineFoundation.SFXOnlineEventList.GetEvent" },	// 4168
+	{ 40281, "Function SFXOnlineFoundation.SFXOnlineEventList.GetEventAtIndex" },	// 4169
+	{ 40284, "Function SFXOnlineFoundation.SFXOnlineEventList.FindEvent" },	// 4170
+	{ 40287, "Function SFXOnlineFoundation.SFXOnlineEventList.GetAllPendingEvents" },	// 4171
+	{ 40292, "Function SFXOnlineFoundation.SFXOnlineEventList.RemoveEvent" },	// 4172
+	{ 40295, "Function SFXOnlineFoundation.SFXOnlineEventList.GetNextTimedOutEvent" },	// 4173
+	{ 40305, "Function SFXOnlineFoundation.SFXOnlineEventNotifier.OnEvent" },	// 4174
+	{ 40311, "Function SFXOnlineFoundation.SFXOnlineEventNotifier.IsSubscribed" },	// 4175
+	{ 40315, "Function SFXOnlineFoundation.SFXOnlineEventNotifier.AddSubscriber" },	// 4176
+	{ 40318, "Function SFXOnlineFoundation.SFXOnlineEventNotifier.RemoveSubscriber" },	// 4177
+	{ 40322, "Function SFXOnlineFoundation.SFXOnlineEventNotifier.RemoveAllSubscribers" },	// 4178
+	{ 40324, "Function SFXOnlineFoundation.SFXOnlineEventNotifier.AddWaiter" },	// 4179
+	{ 40327, "Function SFXOnlineFoundation.SFXOnlineEventNotifier.RemoveAllWaiters" },	// 4180
+	{ 40329, "Function SFXOnlineFoundation.SFXOnlineEventNotifier.NotifySubscribers" },	// 4181
+	{ 40331, "Function SFXOnlineFoundation.SFXOnlineEventNotifier.NotifyWaiters" },	// 4182
+	{ 40333, "Function SFXOnlineFoundation.SFXOnlineEventNotifier.NotifyCallbacks" },	// 4183
+	{ 40378, "Function SFXOnlineFoundation.SFXOnlineGameSettings.GetMasterMapID" },	// 4184
+	{ 40382, "Function SFXOnlineFoundation.SFXOnlineGameSettings.SetPrivacy" },	// 4185
+	{ 40383, "Function SFXOnlineFoundation.SFXOnlineGameSettings.GetMapByPackageName" },	// 4186
+	{ 40388, "Function SFXOnlineFoundation.SFXOnlineGameSettings.GetMapByID" },	// 4187
+	{ 40393, "Function SFXOnlineFoundation.SFXOnlineGameSettings.GetMapByServerMapID" },	// 4188
+	{ 40397, "Function SFXOnlineFoundation.SFXOnlineGameSettings.ValidateMapName" },	// 4189
+	{ 40400, "Function SFXOnlineFoundation.SFXOnlineGameSettings.EnsureMatchSettingsAreValid" },	// 4190
+	{ 40414, "Function SFXOnlineFoundation.SFXOnlineGameSettings.Copy" },	// 4191
+	{ 40422, "Function SFXOnlineFoundation.SFXOnlineGameSettings.ToString" },	// 4192
+	{ 40431, "Function SFXOnlineFoundation.SFXOnlineGameSettings.GetPrivacy" },	// 4193
+	{ 40444, "Function SFXOnlineFoundation.SFXOnlineHTTPRequest.URLEncodeString" },	// 4194
+	{ 40447, "Function SFXOnlineFoundation.SFXOnlineHTTPRequest.AddHeaderTerminator" },	// 4195
+	{ 40450, "Function SFXOnlineFoundation.SFXOnlineHTTPRequest.AddParameter" },	// 4196
+	{ 40454, "Function SFXOnlineFoundation.SFXOnlineHTTPRequest.AddHeaderParameter" },	// 4197
+	{ 40458, "Function SFXOnlineFoundation.SFXOnlineHTTPRequest.SetPost" },	// 4198
+	{ 40461, "Function SFXOnlineFoundation.SFXOnlineHTTPRequest.SetBaseURL" },	// 4199
+	{ 40463, "Function SFXOnlineFoundation.SFXOnlineHTTPRequest.AddSubURL" },	// 4200
+	{ 40465, "Function SFXOnlineFoundation.SFXOnlineHTTPRequest.ClearParams" },	// 4201
+	{ 40466, "Function SFXOnlineFoundation.SFXOnlineHTTPRequest.Reset" },	// 4202
+	{ 40470, "Function SFXOnlineFoundation.SFXOnlineHTTPRequest.FillDefaultParameters" },	// 4203
+	{ 40471, "Function SFXOnlineFoundation.SFXOnlineHTTPRequest.GenerateHeaderParametersString" },	// 4204
+	{ 40475, "Function SFXOnlineFoundation.SFXOnlineHTTPRequest.GenerateParametersString" },	// 4205
+	{ 40481, "Function SFXOnlineFoundation.SFXOnlineJobGameReporting.GameReportingCallback" },	// 4206
+	{ 40484, "Function SFXOnlineFoundation.SFXOnlineJobGameReporting.DoExecute" },	// 4207
+	{ 40486, "Function SFXOnlineFoundation.SFXOnlineJobGameReporting.BuildReport" },	// 4208
+	{ 40488, "Function SFXOnlineFoundation.SFXOnlineJobGameReporting.OnRelease" },	// 4209
+	{ 40489, "Function SFXOnlineFoundation.SFXOnlineJobGameReporting.OnReleaseImpl" },	// 4210
+	{ 40496, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPRequest.HandleSecondHTTPResult" },	// 4211
+	{ 40497, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPRequest.QueueSecondHTTPRequest" },	// 4212
+	{ 40498, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPRequest.DoExecute" },	// 4213
+	{ 40500, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPRequest.GetAuthToken" },	// 4214
+	{ 40501, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPRequest.TickInternal" },	// 4215
+	{ 40502, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPRequest.JobFailedHandler" },	// 4216
+	{ 40504, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPRequest.AuthenticateHTTPResult" },	// 4217
+	{ 40505, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPRequest.AuthenticateHTTP" },	// 4218
+	{ 40512, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentHTTPManager" },	// 4219
+	{ 40514, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPRequest.Tick" },	// 4220
+	{ 40515, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPRequest.OnRelease" },	// 4221
+	{ 40516, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPRequest.ShouldReschedule" },	// 4222
+	{ 40518, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPRequest.AuthorizationFailed" },	// 4223
+	{ 40523, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPGetMessages.OnGetMessagesComplete" },	// 4224
+	{ 40527, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPGetMessages.HandleSecondHTTPResult" },	// 4225
+	{ 40528, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPGetMessages.JobFailedHandler" },	// 4226
+	{ 40535, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPGetMessages.QueueSecondHTTPRequest" },	// 4227
+	{ 40538, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPGetMessages.OnRelease" },	// 4228
+	{ 40541, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPGetRatings.OnGetRatingsComplete" },	// 4229
+	{ 40548, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPGetRatings.HandleSecondHTTPResult" },	// 4230
+	{ 40549, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPGetRatings.JobFailedHandler" },	// 4231
+	{ 40556, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPGetRatings.QueueSecondHTTPRequest" },	// 4232
+	{ 40559, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPGetRatings.OnRelease" },	// 4233
+	{ 40570, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPIncreaseRatings.OnIncreaseRatingsComplete" },	// 4234
+	{ 40577, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPIncreaseRatings.HandleSecondHTTPResult" },	// 4235
+	{ 40578, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPIncreaseRatings.JobFailedHandler" },	// 4236
+	{ 40589, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPIncreaseRatings.QueueSecondHTTPRequest" },	// 4237
+	{ 40592, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPIncreaseRatings.OnRelease" },	// 4238
+	{ 40598, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPSendMessage.OnSendMessageComplete" },	// 4239
+	{ 40603, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPSendMessage.HandleSecondHTTPResult" },	// 4240
+	{ 40604, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPSendMessage.JobFailedHandler" },	// 4241
+	{ 40617, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPSendMessage.QueueSecondHTTPRequest" },	// 4242
+	{ 40620, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPSendMessage.OnRelease" },	// 4243
+	{ 40624, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPTouchMessages.OnTouchMessagesComplete" },	// 4244
+	{ 40627, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPTouchMessages.HandleSecondHTTPResult" },	// 4245
+	{ 40628, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPTouchMessages.JobFailedHandler" },	// 4246
+	{ 40635, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPTouchMessages.QueueSecondHTTPRequest" },	// 4247
+	{ 40638, "Function SFXOnlineFoundation.SFXOnlineJobGaWHTTPTouchMessages.OnRelease" },	// 4248
+	{ 40640, "Function SFXOnlineFoundation.SFXOnlineJobGetAuthToken.DoExecute" },	// 4249
+	{ 40642, "Function SFXOnlineFoundation.SFXOnlineJobGetAuthToken.OnAuthTokenRetrieved" },	// 4250
+	{ 40647, "Function SFXOnlineFoundation.SFXOnlineJobGetLeaderboardData.OnJobCompletion" },	// 4251
+	{ 40656, "Function SFXOnlineFoundation.SFXOnlineJobGetLeaderboardData.OnResultsRetrieved" },	// 4252
+	{ 40665, "Function SFXOnlineFoundation.SFXOnlineJobGetLeaderboardData.DoExecute" },	// 4253
+	{ 40667, "Function SFXOnlineFoundation.SFXOnlineJobGetLeaderboardData.JobCompleted" },	// 4254
+	{ 40707, "Function SFXOnlineFoundation.SFXOnlineJobGetLeaderboardList.OnJobCompletion" },	// 4255
+	{ 40709, "Function SFXOnlineFoundation.SFXOnlineJobGetLeaderboardList.DoExecute" },	// 4256
+	{ 40711, "Function SFXOnlineFoundation.SFXOnlineJobGetLeaderboardList.JobCompleted" },	// 4257
+	{ 40715, "Function SFXOnlineFoundation.SFXOnlineJobGetLeaderboardList.ShouldReschedule" },	// 4258
+	{ 40717, "Function SFXOnlineFoundation.SFXOnlineJobGetStatsGroupList.OnJobCompletion" },	// 4259
+	{ 40719, "Function SFXOnlineFoundation.SFXOnlineJobGetStatsGroupList.DoExecute" },	// 4260
+	{ 40721, "Function SFXOnlineFoundation.SFXOnlineJobGetStatsGroupList.JobCompleted" },	// 4261
+	{ 40725, "Function SFXOnlineFoundation.SFXOnlineJobHTTPRequest.OnJobComplete" },	// 4262
+	{ 40728, "Function SFXOnlineFoundation.SFXOnlineJobHTTPRequest.DoExecute" },	// 4263
+	{ 40731, "Function SFXOnlineFoundation.SFXOnlineJobHTTPRequest.Tick" },	// 4264
+	{ 40732, "Function SFXOnlineFoundation.SFXOnlineJobImageRequest.OnJobComplete" },	// 4265
+	{ 40735, "Function SFXOnlineFoundation.SFXOnlineJobImageRequest.DoExecute" },	// 4266
+	{ 40739, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentImageManager" },	// 4267
+	{ 40741, "Function SFXOnlineFoundation.SFXOnlineJobImageRequest.Tick" },	// 4268
+	{ 40742, "Function SFXOnlineFoundation.SFXOnlineJobImageRequest.MoveToBackOfQueue" },	// 4269
+	{ 40744, "Function SFXOnlineFoundation.SFXOnlineJobImportFriendListToBlaze.OnJobCompletion" },	// 4270
+	{ 40746, "Function SFXOnlineFoundation.SFXOnlineJobImportFriendListToBlaze.DoExecute" },	// 4271
+	{ 40748, "Function SFXOnlineFoundation.SFXOnlineJobImportFriendListToBlaze.JobCompleted" },	// 4272
+	{ 40754, "Function SFXOnlineFoundation.SFXOnlineJobImportFriendListToBlaze.ShouldReschedule" },	// 4273
+	{ 40758, "Function SFXOnlineFoundation.SFXOnlineJobLoadSettings.LoadSettingsCallback" },	// 4274
+	{ 40764, "Function SFXOnlineFoundation.SFXOnlineJobLoadSettings.DoExecute" },	// 4275
+	{ 40771, "Function SFXOnlineFoundation.SFXOnlineJobLoadSettings.ShouldReschedule" },	// 4276
+	{ 40774, "Function SFXOnlineFoundation.SFXOnlineJobPurgeMessages.DoExecute" },	// 4277
+	{ 40781, "Function SFXOnlineFoundation.SFXOnlineJobReceiveMessage.DoExecute" },	// 4278
+	{ 40789, "Function SFXOnlineFoundation.SFXOnlineJobSaveSettings.SaveSettingsCallback" },	// 4279
+	{ 40793, "Function SFXOnlineFoundation.SFXOnlineJobSaveSettings.AddSetting" },	// 4280
+	{ 40797, "Function SFXOnlineFoundation.SFXOnlineJobSaveSettings.AddCompletionDelegate" },	// 4281
+	{ 40799, "Function SFXOnlineFoundation.SFXOnlineJobSaveSettings.CallCompletionDelegates" },	// 4282
+	{ 40803, "Function SFXOnlineFoundation.SFXOnlineJobSaveSettings.DoExecute" },	// 4283
+	{ 40816, "Function SFXOnlineFoundation.SFXOnlineJobSendMessage.DoExecute" },	// 4284
+	{ 40818, "Function SFXOnlineFoundation.SFXOnlineJobSendMessage.CreateSendMessageJob" },	// 4285
+	{ 40827, "Function SFXOnlineFoundation.SFXOnlineJobSendMessage.CreateSendMessageToAllFriendsJob" },	// 4286
+	{ 40834, "Function SFXOnlineFoundation.SFXOnlineJobSendMessage.GetFriendsList" },	// 4287
+	{ 40838, "Class SFXOnlineFoundation.sfxonlinestatswrite" },	// 4288
+	{ 40847, "Function SFXOnlineFoundation.SFXOnlineSubsystem.Init" },	// 4289
+	{ 40850, "Function SFXOnlineFoundation.SFXOnlineSubsystem.InitGameProtocolVersion" },	// 4290
+	{ 40851, "Function SFXOnlineFoundation.SFXOnlineSubsystem.CreateComponents" },	// 4291
+	{ 40852, "Function SFXOnlineFoundation.SFXOnlineSubsystem.SetUnrealInterfaces" },	// 4292
+	{ 40855, "Function SFXOnlineFoundation.SFXOnlineSubsystem.UpdateGameProtocolVersion" },	// 4293
+	{ 40858, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentGame" },	// 4294
+	{ 40862, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentStats" },	// 4295
+	{ 40863, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentUnrealPlayerEx" },	// 4296
+	{ 40864, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentUnrealSystem" },	// 4297
+	{ 40865, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentVoiceInterface" },	// 4298
+	{ 40866, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentXenonLiveParty" },	// 4299
+	{ 40867, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetURL" },	// 4300
+	{ 40870, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentAchievement" },	// 4301
+	{ 40872, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentAPI" },	// 4302
+	{ 40875, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentLogin" },	// 4303
+	{ 40877, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentUserInterface" },	// 4304
+	{ 40879, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentNotification" },	// 4305
+	{ 40882, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentMatchMakingBot" },	// 4306
+	{ 40884, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentLeaderboard" },	// 4307
+	{ 40886, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentMessaging" },	// 4308
+	{ 40888, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentTelemetry" },	// 4309
+	{ 40890, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentCommerce" },	// 4310
+	{ 40892, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetCoordinator" },	// 4311
+	{ 40897, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentOrigin" },	// 4312
+	{ 40900, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentAvatarAwardXenon" },	// 4313
+	{ 40902, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetGameProtocolVersion" },	// 4314
+	{ 40904, "Function SFXOnlineFoundation.SFXOnlineSubsystem.NativeInitOnlineComponent" },	// 4315
+	{ 40907, "Function SFXOnlineFoundation.SFXOnlineSubsystem.NativeInit" },	// 4316
+	{ 40909, "Function SFXOnlineFoundation.SFXOnlineSubsystem.ShutDown" },	// 4317
+	{ 40910, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetPlatform" },	// 4318
+	{ 40912, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetLanguage" },	// 4319
+	{ 40914, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetCDKey" },	// 4320
+	{ 40916, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetProjectID" },	// 4321
+	{ 40918, "Function SFXOnlineFoundation.SFXOnlineSubsystem.IsCerberusMember" },	// 4322
+	{ 40920, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetBioDynamicBuildVersion" },	// 4323
+	{ 40922, "Function SFXOnlineFoundation.SFXOnlineSubsystem.ShowKeyboardUI" },	// 4324
+	{ 40931, "Function SFXOnlineFoundation.SFXOnlineSubsystem.ShowConsoleRoutedKeyboardUI" },	// 4325
+	{ 40940, "Function SFXOnlineFoundation.SFXOnlineSubsystem.Exit" },	// 4326
+	{ 40941, "Function SFXOnlineFoundation.SFXOnlineSubsystem.GetEnvironment" },	// 4327
+	{ 40947, "Function SFXOnlineFoundation.sfxonlinecomponentachievementpc.Grant" },	// 4328
+	{ 40950, "Function SFXOnlineFoundation.sfxonlinecomponentachievementpc.IsGranted" },	// 4329
+	{ 40954, "Function SFXOnlineFoundation.sfxonlinecomponentachievementpc.OnInitialize" },	// 4330
+	{ 40956, "Function SFXOnlineFoundation.sfxonlinecomponentachievementpc.OnRelease" },	// 4331
+	{ 40957, "Function SFXOnlineFoundation.sfxonlinecomponentachievementpc.GetAPIName" },	// 4332
+	{ 41446, "Class SFXGame.SFXWeapon" },	// 4333
+	{ 41479, "Class SFXGame.SFXSeqEvt_OnStoppedSleeping" },	// 4334
+	{ 41481, "Function SFXGame.BioBaseSquad.SquadMembers" },	// 4335
+	{ 41506, "Class SFXGame.sfxpowercustomaction" },	// 4336
+	{ 41508, "Class SFXGame.SFXPawn_Henchman" },	// 4337
+	{ 41509, "Class SFXGame.SFXPawn_PlayerParty" },	// 4338
+	{ 41510, "Class SFXGame.sfxpawn" },	// 4339
+	{ 41638, "Class SFXGame.BioAnimNodeBlendAdditivePower" },	// 4340
+	{ 41706, "Function SFXGame.SFXWeapon.GetRateOfFire" },	// 4341
+	{ 41736, "Function SFXGame.SFXWeapon.GetReloadDuration" },	// 4342
+	{ 41985, "Class SFXGame.BioAnimNodeBlendWeaponEquip" },	// 4343
+	{ 41987, "Class SFXGame.BioAnimNodeCameraShake" },	// 4344
+	{ 42122, "Class SFXGame.BioAnimNotify_CustomAction" },	// 4345
+	{ 42133, "Class SFXGame.BioAreaTransition" },	// 4346
+	{ 42139, "Class SFXGame.SFXPawn_Player" },	// 4347
+	{ 42158, "Function SFXGame.BioBaseSquad.RemoveMember" },	// 4348
+	{ 42161, "Function SFXGame.BioBaseSquad.GetMemberMoveIndicator" },	// 4349
+	{ 42164, "Function SFXGame.BioBaseSquad.SetMemberMoveIndicator" },	// 4350
+	{ 42168, "Function SFXGame.BioBaseSquad.IsPositionInPlaypen" },	// 4351
+	{ 42171, "Function SFXGame.BioBaseSquad.IsPositionInSubtractivePlaypen" },	// 4352
+	{ 42174, "Function SFXGame.BioBaseSquad.IsActorInPlaypen" },	// 4353
+	{ 42177, "Function SFXGame.BioBaseSquad.IsActorInSubtractivePlaypen" },	// 4354
+	{ 42180, "Function SFXGame.BioBaseSquad.HasPlaypen" },	// 4355
+	{ 42182, "Function SFXGame.BioBaseSquad.AddVolumeToPlaypen" },	// 4356
+	{ 42184, "Function SFXGame.BioBaseSquad.RemoveVolumeFromPlaypen" },	// 4357
+	{ 42186, "Function SFXGame.BioBaseSquad.IsVolumeInPlaypen" },	// 4358
+	{ 42189, "Function SFXGame.BioBaseSquad.UpdatePlaypen" },	// 4359
+	{ 42190, "Function SFXGame.BioBaseSquad.GetPlaypenNavOrigin" },	// 4360
+	{ 42193, "Function SFXGame.BioBaseSquad.GetPlaypenReturnPoint" },	// 4361
+	{ 42196, "Function SFXGame.BioBaseSquad.AddCombatZone" },	// 4362
+	{ 42198, "Function SFXGame.BioBaseSquad.RemoveCombatZone" },	// 4363
+	{ 42200, "Function SFXGame.BioBaseSquad.HasCombatZone" },	// 4364
+	{ 42203, "Function SFXGame.BioBaseSquad.IsCoverInCombatZone" },	// 4365
+	{ 42206, "Function SFXGame.BioBaseSquad.IsPositionInCombatZone" },	// 4366
+	{ 42209, "Function SFXGame.BioBaseSquad.GetClosestCombatZoneOrigin" },	// 4367
+	{ 42213, "Function SFXGame.BioBaseSquad.NotifyEnemyPerceived" },	// 4368
+	{ 42214, "Function SFXGame.BioBaseSquad.NotifyNoEnemiesPerceived" },	// 4369
+	{ 42215, "Function SFXGame.BioBaseSquad.NotifyPlaypenChanged" },	// 4370
+	{ 42217, "Class SFXGame.sfxai_core" },	// 4371
+	{ 42219, "Function SFXGame.BioBaseSquad.Died" },	// 4372
+	{ 42225, "Function SFXGame.BioBaseSquad.AddMember" },	// 4373
+	{ 42235, "Function SFXGame.BioBaseSquad.RemoveDyingMember" },	// 4374
+	{ 42237, "Function SFXGame.BioBaseSquad.MemberRemoved" },	// 4375
+	{ 42240, "Function SFXGame.BioBaseSquad.MakeHackable" },	// 4376
+	{ 42242, "Function SFXGame.BioBaseSquad.EnableSquad" },	// 4377
+	{ 42245, "Function SFXGame.BioBaseSquad.DisableSquad" },	// 4378
+	{ 42248, "Function SFXGame.BioBaseSquad.NotifyCombatZoneAdded" },	// 4379
+	{ 42251, "Function SFXGame.BioBaseSquad.NotifyCombatZoneRemoved" },	// 4380
+	{ 42262, "Class SFXGame.BioBaseSquadDesign" },	// 4381
+	{ 42266, "Class SFXGame.BioBaseSquadDesignCombat" },	// 4382
+	{ 42429, "Class SFXGame.biocamerabehaviorflourish" },	// 4383
+	{ 42454, "Class SFXGame.BioCameraBehaviorFree" },	// 4384
+	{ 42912, "Function SFXGame.SFXGUIMovie.UIStrRef" },	// 4385
+	{ 42932, "Class SFXGame.SFXGameModeOrbital" },	// 4386
+	{ 43091, "Class SFXGame.BioCameraBehaviorLocked" },	// 4387
+	{ 43494, "Class SFXGame.SFXModule_WeaponModManager" },	// 4388
+	{ 43498, "Class SFXGame.SFXWeaponMod" },	// 4389
+	{ 43499, "Function SFXGame.SFXWeaponMod.LoadModClass" },	// 4390
+	{ 43501, "Function SFXGame.SFXWeaponMod.IsUnlocked" },	// 4391
+	{ 43511, "Function SFXGame.SFXWeapon.GetMagazineSize" },	// 4392
+	{ 43542, "Class SFXGame.SFXGAWAssetsHandler" },	// 4393
+	{ 43639, "Class SFXGame.sfxmodule_damage" },	// 4394
+	{ 43649, "Function SFXGame.SFXTelemetry.SendArray" },	// 4395
+	{ 43672, "Function SFXGame.SFXWeapon.GetCurrentSpareAmmo" },	// 4396
+	{ 43764, "Class SFXGame.SFXCharacterClass" },	// 4397
+	{ 43807, "Class SFXGame.sfxshield_base" },	// 4398
+	{ 44389, "Class SFXGame.sfxhostmigration" },	// 4399
+	{ 44410, "Function SFXGame.SFXTelemetry.SendVoid" },	// 4400
+	{ 44446, "Class SFXGame.sfxplayercontroller" },	// 4401
+	{ 44451, "Function SFXGame.SFXTelemetry.SendBool" },	// 4402
+	{ 44527, "Class SFXGame.BioDynamicLoadInterface" },	// 4403
+	{ 44528, "Class SFXGame.SFXPawn_PlayerVanguard" },	// 4404
+	{ 44531, "Class SFXGame.SFXCustomActionTypes" },	// 4405
+	{ 44550, "Function SFXGame.SFXDamageType.CanPlayDeathEffect" },	// 4406
+	{ 44554, "Function SFXGame.SFXDamageType.ResetDamageCalc" },	// 4407
+	{ 44579, "Function SFXGame.SFXDamageType.CalculateDamageMultiplier" },	// 4408
+	{ 44634, "Class SFXGame.SFXAICommand" },	// 4409
+	{ 44712, "Class SFXGame.SFXNav_InteractionPoint" },	// 4410
+	{ 44843, "Class SFXGame.SFXVocalizationManager" },	// 4411
+	{ 44852, "Function SFXGame.SFXVocalizationManager.PostBeginPlay" },	// 4412
+	{ 44853, "Function SFXGame.SFXVocalizationManager.TriggerVocalizationEvent" },	// 4413
+	{ 44868, "Function SFXGame.SFXVocalizationManager.PlaySFXVocalizationSLineInternal" },	// 4414
+	{ 44874, "Function SFXGame.SFXVocalizationManager.TickEvents" },	// 4415
+	{ 44881, "Function SFXGame.SFXVocalizationManager.DebugDraw" },	// 4416
+	{ 44887, "Function SFXGame.SFXVocalizationManager.DrawActorLog" },	// 4417
+	{ 44927, "Function SFXGame.BioHUD.IsDrawing" },	// 4418
+	{ 44929, "Function SFXGame.BioHUD.ClearDebugDraw" },	// 4419
+	{ 44930, "Function SFXGame.BioHUD.AddDebugDraw" },	// 4420
+	{ 45038, "Class SFXGame.SFXDamageType_CheatKill" },	// 4421
+	{ 45052, "Class SFXGame.SFXDamageType_Default" },	// 4422
+	{ 45204, "Class SFXGame.SFXHeavyWeapon" },	// 4423
+	{ 45207, "Function SFXGame.SFXWeapon.AddAmmo" },	// 4424
+	{ 45232, "Class SFXGame.SFXModule_GameEffectManager" },	// 4425
+	{ 45241, "Class SFXGame.SFXGameEffect_PassiveWeaponBonus" },	// 4426
+	{ 45351, "Class SFXGame.SFXModule_AimAssist" },	// 4427
+	{ 45353, "Function SFXGame.BioHUD.ToggleDebugDraw" },	// 4428
+	{ 45421, "Function SFXGame.sfxai_core.EnableAI" },	// 4429
+	{ 45432, "Function SFXGame.sfxai_core.SetCombatMood" },	// 4430
+	{ 45444, "Class SFXGame.SFXPlotTreasure" },	// 4431
+	{ 45544, "Class SFXGame.SFXWeapon_Shotgun_Base" },	// 4432
+	{ 45583, "Function SFXGame.SFXWeaponMod.GetModName" },	// 4433
+	{ 45596, "Class SFXGame.SFXModule_DamageParty" },	// 4434
+	{ 45626, "Function SFXGame.SFXWeapon.GetFireModeBaseDamage" },	// 4435
+	{ 45628, "Function SFXGame.SFXWeapon.GetDamageType" },	// 4436
+	{ 45632, "Function SFXGame.SFXWeapon.GetWeaponAimErrorRange" },	// 4437
+	{ 45634, "Function SFXGame.SFXWeapon.GetBurstsToFire" },	// 4438
+	{ 45644, "Function SFXGame.sfxai_core.GetCurrentKismetOrder" },	// 4439
+	{ 45654, "Class SFXGame.sfxpri" },	// 4440
+	{ 45913, "Function SFXGame.sfxai_core.IsInFightingState" },	// 4441
+	{ 45953, "Class SFXGame.sfxplayercamera" },	// 4442
+	{ 45975, "Class SFXGame.SFXAI_Henchman" },	// 4443
+	{ 45976, "Class SFXGame.SFXAI_Cover" },	// 4444
+	{ 46008, "Function SFXGame.SFXGUIMovie.GetProfileTimes" },	// 4445
+	{ 46325, "Class SFXGame.SFXGameEffect_PowerBonus" },	// 4446
+	{ 46359, "Function SFXGame.sfxai_core.TeleportToActor" },	// 4447
+	{ 46461, "Function SFXGame.SFXGUIMovie.Invoke0" },	// 4448
+	{ 46629, "Class SFXGame.BioHintSystem" },	// 4449
+	{ 46716, "Class SFXGame.SFXWeapon_AssaultRifle_Base" },	// 4450
+	{ 46717, "Class SFXGame.SFXWeapon_Pistol_Base" },	// 4451
+	{ 46718, "Class SFXGame.SFXWeapon_SMG_Base" },	// 4452
+	{ 46719, "Class SFXGame.SFXWeapon_SniperRifle_Base" },	// 4453
+	{ 46808, "Class SFXGame.SFXModule_QAModule" },	// 4454
+	{ 46832, "Function SFXGame.BioHUD.RemoveDesignerText" },	// 4455
+	{ 46842, "Function SFXGame.BioHUD.AddDesignerText" },	// 4456
+	{ 46854, "Function SFXGame.BioHUD.AddBar" },	// 4457
+	{ 46890, "Function SFXGame.SFXTelemetry.SendInt" },	// 4458
+	{ 47130, "Function SFXGame.BioHUD.AddButtonTraceStrip" },	// 4459
+	{ 47134, "Function SFXGame.BioHUD.AddAxisTraceStrip" },	// 4460
+	{ 47140, "Function SFXGame.BioHUD.AddAnimNodeTraceStrip" },	// 4461
+	{ 47146, "Function SFXGame.BioHUD.AddPropertyTraceStrip" },	// 4462
+	{ 47148, "Function SFXGame.BioHUD.ClearTraceStrips" },	// 4463
+	{ 47151, "Function SFXGame.BioHUD.RemoveTraceAtIndex" },	// 4464
+	{ 47185, "Class SFXGame.SFXMPEventTicker" },	// 4465
+	{ 47197, "Class SFXGame.sfxgui_weaponselection" },	// 4466
+	{ 47204, "Function SFXGame.SFXGUIMovie.Start" },	// 4467
+	{ 47358, "Function SFXGame.sfxgui_weaponselection.UpdateUIWorldPawnPosition" },	// 4468
+	{ 47400, "Class SFXGame.SFXTreasureData" },	// 4469
+	{ 47465, "Class SFXGame.biocheatmanagernonnative" },	// 4470
+	{ 47540, "Class SFXGame.SFXSeqAct_AutoLevelPlayer" },	// 4471
+	{ 47758, "Function SFXGame.SFXWeapon.LoadWeaponClass" },	// 4472
+	{ 47760, "Function SFXGame.SFXWeapon.Upgrade" },	// 4473
+	{ 47931, "Class SFXGame.sfxscoremanager" },	// 4474
+	{ 48152, "Class SFXGame.BioSeqAct_BioToggleCinematicMode" },	// 4475
+	{ 48301, "Class SFXGame.BioConvNodeTrackDebugInst" },	// 4476
+	{ 48359, "Class SFXGame.SFXGameEffect_DamageTakenBonus" },	// 4477
+	{ 48379, "Function SFXGame.SFXWeapon.SetWeaponHidden" },	// 4478
+	{ 48461, "Class SFXGame.SFXCameraTransition_FaceTarget" },	// 4479
+	{ 48462, "Class SFXGame.SFXCameraMode_Interpolate" },	// 4480
+	{ 48498, "Class SFXGame.SFXModule_Timeline" },	// 4481
+	{ 48610, "Class SFXGame.SFXAICmd_CustomAction" },	// 4482
+	{ 48611, "Class SFXGame.SFXCustomAction_Ragdoll" },	// 4483
+	{ 48612, "Class SFXGame.SFXCustomAction_AnimatedRagdoll" },	// 4484
+	{ 48613, "Class SFXGame.SFXCustomAction_Frozen" },	// 4485
+	{ 48614, "Class SFXGame.BioCustomAction_CombatActivate" },	// 4486
+	{ 48630, "Class SFXGame.SFXAICmd_CombatActivate" },	// 4487
+	{ 48631, "Class SFXGame.BioCustomAction_CoverClimbMantleBase" },	// 4488
+	{ 48673, "Class SFXGame.SFXAICmd_CA_CoverMantleClimbBase" },	// 4489
+	{ 48674, "Class SFXGame.BioCustomAction_CoverClimb" },	// 4490
+	{ 48682, "Class SFXGame.BioCustomAction_CoverMantle" },	// 4491
+	{ 48732, "Class SFXGame.SFXAICmd_CA_KroganCharge" },	// 4492
+	{ 48733, "Class SFXGame.BioDebugMenu" },	// 4493
+	{ 48758, "Class SFXGame.BioDeprecated" },	// 4494
+	{ 48760, "Class SFXGame.BioDestinationArrow" },	// 4495
+	{ 49609, "Class SFXGame.SFXPlayerCustomization" },	// 4496
+	{ 49744, "Class SFXGame.BioGUIBox" },	// 4497
+	{ 49970, "Function SFXGame.SFXWeapon.GetAmmoCountInMagazine" },	// 4498
+	{ 49972, "Function SFXGame.SFXWeapon.HasAnyAmmo" },	// 4499
+	{ 50418, "Class SFXGame.sfxgamemodedefault" },	// 4500
+	{ 50419, "Class SFXGame.SFXGameModeVehicle" },	// 4501
+	{ 50420, "Class SFXGame.SFXGameModeAtlas" },	// 4502
+	{ 50421, "Class SFXGame.SFXGameModePowerWheel" },	// 4503
+	{ 50422, "Class SFXGame.SFXGameModeWeaponWheel" },	// 4504
+	{ 50423, "Class SFXGame.SFXGameModeCommand" },	// 4505
+	{ 50424, "Class SFXGame.SFXGameModeInjuredShepard" },	// 4506
+	{ 50425, "Class SFXGame.SFXGameModeConversation" },	// 4507
+	{ 50426, "Class SFXGame.SFXGameModeCinematic" },	// 4508
+	{ 50427, "Class SFXGame.SFXGameModeGUI" },	// 4509
+	{ 50428, "Class SFXGame.SFXGameModeMovie" },	// 4510
+	{ 50429, "Class SFXGame.SFXGameModeCheatMenu" },	// 4511
+	{ 50430, "Class SFXGame.SFXGameModeAIDebug" },	// 4512
+	{ 50431, "Class SFXGame.SFXGameModeProto" },	// 4513
+	{ 50432, "Class SFXGame.SFXGameModeDreamSequence" },	// 4514
+	{ 50433, "Class SFXGame.SFXGameModeIllusiveManConflict" },	// 4515
+	{ 50434, "Class SFXGame.SFXGameModeSpectator" },	// 4516
+	{ 50435, "Class SFXGame.sfxgamemodedying" },	// 4517
+	{ 50436, "Class SFXGame.SFXGameModeFlyCam" },	// 4518
+	{ 50437, "Class SFXGame.SFXGameModeReplicationDebug" },	// 4519
+	{ 50438, "Class SFXGame.SFXGameModeLobby" },	// 4520
+	{ 50441, "Function SFXGame.SFXGUIMovie.OnMovieClosedDelegate" },	// 4521
+	{ 50456, "Function SFXGame.SFXGUIMovie.AddOnMovieClosedDelegate" },	// 4522
+	{ 50458, "Function SFXGame.SFXGUIMovie.ClearOnMovieClosedDelegate" },	// 4523
+	{ 50460, "Function SFXGame.SFXGUIMovie.ClearAllDelegates" },	// 4524
+	{ 50461, "Function SFXGame.SFXGUIMovie.UpdateInputConfigurations" },	// 4525
+	{ 50462, "Function SFXGame.SFXGUIMovie.HandleInputConfigurations" },	// 4526
+	{ 50463, "Function SFXGame.SFXGUIMovie.IsEnterMenuButtonAssignmentSwapped" },	// 4527
+	{ 50464, "Function SFXGame.SFXGUIMovie.IsStickSouthpaw" },	// 4528
+	{ 50465, "Function SFXGame.SFXGUIMovie.IsTriggerSouthpaw" },	// 4529
+	{ 50466, "Function SFXGame.SFXGUIMovie.IsTriggerShoulderSwapped" },	// 4530
+	{ 50468, "Function SFXGame.SFXGUIMovie.OnStart" },	// 4531
+	{ 50470, "Function SFXGame.SFXGUIMovie.PlayGuiSound" },	// 4532
+	{ 50471, "Function SFXGame.SFXGUIMovie.Close" },	// 4533
+	{ 50473, "Function SFXGame.SFXGUIMovie.OnClose" },	// 4534
+	{ 50475, "Function SFXGame.SFXGUIMovie.InvokeOnCloseDelegates" },	// 4535
+	{ 50478, "Function SFXGame.SFXGUIMovie.Advance" },	// 4536
+	{ 50480, "Function SFXGame.SFXGUIMovie.PostAdvance" },	// 4537
+	{ 50482, "Function SFXGame.SFXGUIMovie.Update" },	// 4538
+	{ 50484, "Function SFXGame.SFXGUIMovie.SetMovieFocus" },	// 4539
+	{ 50486, "Function SFXGame.SFXGUIMovie.SetFocus" },	// 4540
+	{ 50489, "Function SFXGame.SFXGUIMovie.SetAllowFSCommands" },	// 4541
+	{ 50491, "Function SFXGame.SFXGUIMovie.HasFocus" },	// 4542
+	{ 50493, "Function SFXGame.SFXGUIMovie.SetVisible" },	// 4543
+	{ 50495, "Function SFXGame.SFXGUIMovie.GetVisible" },	// 4544
+	{ 50497, "Function SFXGame.SFXGUIMovie.SetUpdate" },	// 4545
+	{ 50499, "Function SFXGame.SFXGUIMovie.GetUpdate" },	// 4546
+	{ 50501, "Function SFXGame.SFXGUIMovie.SetEnabled" },	// 4547
+	{ 50503, "Function SFXGame.SFXGUIMovie.GetEnabled" },	// 4548
+	{ 50505, "Function SFXGame.SFXGUIMovie.SetInputEnabled" },	// 4549
+	{ 50507, "Function SFXGame.SFXGUIMovie.GetInputEnabled" },	// 4550
+	{ 50509, "Function SFXGame.SFXGUIMovie.SetRequiresUIWorld" },	// 4551
+	{ 50511, "Function SFXGame.SFXGUIMovie.GetRequiresUIWorld" },	// 4552
+	{ 50512, "Function SFXGame.SFXGUIMovie.AddExtension" },	// 4553
+	{ 50515, "Function SFXGame.SFXGUIMovie.GetExtension" },	// 4554
+	{ 50518, "Function SFXGame.SFXGUIMovie.RemoveExtension" },	// 4555
+	{ 50521, "Function SFXGame.SFXGUIMovie.GetSFXUIController" },	// 4556
+	{ 50523, "Function SFXGame.SFXGUIMovie.HandleInputEvent" },	// 4557
+	{ 50527, "Function SFXGame.SFXGUIMovie.SendMouseEvent" },	// 4558
+	{ 50529, "Function SFXGame.SFXGUIMovie.SetMouseVisible" },	// 4559
+	{ 50535, "Function SFXGame.SFXGUIMovie.GetViewportAspectRatio" },	// 4560
+	{ 50537, "Function SFXGame.SFXGUIMovie.GetMovieAspectRatio" },	// 4561
+	{ 50539, "Function SFXGame.SFXGUIMovie.UpdateAspectRatio" },	// 4562
+	{ 50543, "Function SFXGame.SFXGUIMovie.OnAspectRatioChanged" },	// 4563
+	{ 50545, "Function SFXGame.SFXGUIMovie.PlayGuiMusic" },	// 4564
+	{ 50548, "Function SFXGame.SFXGUIMovie.StopGuiMusic" },	// 4565
+	{ 50549, "Function SFXGame.SFXGUIMovie.PlayGuiVoice" },	// 4566
+	{ 50551, "Function SFXGame.SFXGUIMovie.StopGuiVoice" },	// 4567
+	{ 50554, "Function SFXGame.SFXGUIMovie.StopGuiSound" },	// 4568
+	{ 50557, "Function SFXGame.SFXGUIMovie.PlayGuiError" },	// 4569
+	{ 50558, "Function SFXGame.SFXGUIMovie.SetGameMode" },	// 4570
+	{ 50565, "Function SFXGame.SFXGUIMovie.GetScreenLayout" },	// 4571
+	{ 50568, "Function SFXGame.SFXGUIMovie.IsMPClient" },	// 4572
+	{ 50571, "Function SFXGame.SFXGUIMovie.IsMPGame" },	// 4573
+	{ 50573, "Function SFXGame.SFXGUIMovie.SetVariableStringRef" },	// 4574
+	{ 50576, "Function SFXGame.SFXGUIMovie.GetUIString" },	// 4575
+	{ 50580, "Function SFXGame.SFXGUIMovie.GetTokenizedUIString" },	// 4576
+	{ 50586, "Function SFXGame.SFXGUIMovie.GetGUISceneView" },	// 4577
+	{ 50588, "Function SFXGame.SFXGUIMovie.WorldToSafePostProjectionFast" },	// 4578
+	{ 50597, "Function SFXGame.SFXGUIMovie.WorldToScreenFast" },	// 4579
+	{ 50606, "Function SFXGame.SFXGUIMovie.WorldToScreen" },	// 4580
+	{ 50612, "Function SFXGame.SFXGUIMovie.PostProjectionToScreen" },	// 4581
+	{ 50615, "Function SFXGame.SFXGUIMovie.IsOpen" },	// 4582
+	{ 50617, "Function SFXGame.SFXGUIMovie.AttachToASFunction" },	// 4583
+	{ 50624, "Function SFXGame.SFXGUIMovie.OnLanguageChanged" },	// 4584
+	{ 50625, "Function SFXGame.SFXGUIMovie.OnControllerProfileSettingChange" },	// 4585
+	{ 50626, "Function SFXGame.SFXGUIMovie.GetBoundKeyString" },	// 4586
+	{ 50631, "Function SFXGame.SFXGUIMovie.IsNuiSpeechEnabled" },	// 4587
+	{ 50633, "Function SFXGame.SFXGUIMovie.GetNuiPawnCommandString" },	// 4588
+	{ 50642, "Function SFXGame.SFXGUIMovie.PauseMenuAdditionalProcessing" },	// 4589
+	{ 50643, "Function SFXGame.SFXGUIMovie.StartHandlingKeyPresses" },	// 4590
+	{ 50645, "Function SFXGame.SFXGUIMovie.StopHandlingKeyPresses" },	// 4591
+	{ 50646, "Function SFXGame.SFXGUIMovie.PreloadImages" },	// 4592
+	{ 50651, "Function SFXGame.SFXGUIMovie.SetBackgroundAlpha" },	// 4593
+	{ 50861, "Function SFXGame.BioHUD.DebugDraw" },	// 4594
+	{ 50898, "Function SFXGame.BioHUD.ViewportDeProject" },	// 4595
+	{ 50903, "Function SFXGame.BioHUD.ProfileConversationBug" },	// 4596
+	{ 50905, "Function SFXGame.BioHUD.ProfileConversation" },	// 4597
+	{ 50907, "Function SFXGame.BioHUD.ProfileGestures" },	// 4598
+	{ 50909, "Function SFXGame.BioHUD.ProfileAnim" },	// 4599
+	{ 50911, "Function SFXGame.BioHUD.ProfileCover" },	// 4600
+	{ 50913, "Function SFXGame.BioHUD.ProfileLookAt" },	// 4601
+	{ 50915, "Function SFXGame.BioHUD.ProfileWwise" },	// 4602
+	{ 50917, "Function SFXGame.BioHUD.ProfileKinect" },	// 4603
+	{ 50919, "Function SFXGame.BioHUD.ProfileAnimPreload" },	// 4604
+	{ 50921, "Function SFXGame.BioHUD.ProfileConversationExtra" },	// 4605
+	{ 50936, "Function SFXGame.BioHUD.DisplaySafeArea" },	// 4606
+	{ 50939, "Function SFXGame.BioHUD.ToggleSafeArea" },	// 4607
+	{ 50940, "Function SFXGame.BioHUD.PostRender" },	// 4608
+	{ 50947, "Function SFXGame.BioHUD.DrawHUD" },	// 4609
+	{ 50959, "Function SFXGame.BioHUD.DrawEngineHUD" },	// 4610
+	{ 50960, "Function SFXGame.BioHUD.DrawFakeShadowText" },	// 4611
+	{ 50966, "Function SFXGame.BioHUD.LoadTestTextStringFromFile" },	// 4612
+	{ 50968, "Function SFXGame.BioHUD.CDrawSquare" },	// 4613
+	{ 50972, "Function SFXGame.BioHUD.DrawCircle" },	// 4614
+	{ 50983, "Function SFXGame.BioHUD.DrawText" },	// 4615
+	{ 50988, "Function SFXGame.BioHUD.DrawTextWithColor" },	// 4616
+	{ 51000, "Function SFXGame.BioHUD.DisplayActorInfo" },	// 4617
+	{ 51001, "Function SFXGame.BioHUD.LockActorInfo" },	// 4618
+	{ 51009, "Function SFXGame.BioHUD.SetActorForActorInfo" },	// 4619
+	{ 51012, "Function SFXGame.BioHUD.ShowLocation" },	// 4620
+	{ 51013, "Function SFXGame.BioHUD.HideLocation" },	// 4621
+	{ 51014, "Function SFXGame.BioHUD.DebugDraw_PlayerLocation" },	// 4622
+	{ 51018, "Function SFXGame.BioHUD.DebugDraw_ActorInfo" },	// 4623
+	{ 51028, "Function SFXGame.BioHUD.ShowCover" },	// 4624
+	{ 51031, "Function SFXGame.BioHUD.DebugDraw_UpdateCover" },	// 4625
+	{ 51034, "Function SFXGame.BioHUD.UpdateCover" },	// 4626
+	{ 51036, "Function SFXGame.BioHUD.ToggleCoverNames" },	// 4627
+	{ 51039, "Function SFXGame.BioHUD.DebugDraw_CoverNames" },	// 4628
+	{ 51052, "Function SFXGame.BioHUD.DisplayRouteInfo" },	// 4629
+	{ 51056, "Function SFXGame.BioHUD.ShowReachSpecs" },	// 4630
+	{ 51061, "Function SFXGame.BioHUD.DUI_ClearAll" },	// 4631
+	{ 51064, "Function SFXGame.BioHUD.DUI_SetElementVisible" },	// 4632
+	{ 51069, "Function SFXGame.BioHUD.DUI_SetElementColor" },	// 4633
+	{ 51073, "Function SFXGame.BioHUD.DUI_SetElementAlpha" },	// 4634
+	{ 51077, "Function SFXGame.BioHUD.DUI_SetupElementPulse" },	// 4635
+	{ 51082, "Function SFXGame.BioHUD.DUI_ClearElementPulse" },	// 4636
+	{ 51085, "Function SFXGame.BioHUD.DUI_SetTextStringRef" },	// 4637
+	{ 51089, "Function SFXGame.BioHUD.DUI_SetElementText" },	// 4638
+	{ 51093, "Function SFXGame.BioHUD.DUI_SetCounterValue" },	// 4639
+	{ 51097, "Function SFXGame.BioHUD.DUI_SetBarMarkerPoints" },	// 4640
+	{ 51102, "Function SFXGame.BioHUD.DUI_SetBarFillPercent" },	// 4641
+	{ 51106, "Function SFXGame.BioHUD.DUI_SetBarFillDirection" },	// 4642
+	{ 51110, "Function SFXGame.BioHUD.DUI_SetQuasarLayout" },	// 4643
+	{ 51113, "Function SFXGame.BioHUD.DUI_SetTimerDetails" },	// 4644
+	{ 51120, "Function SFXGame.BioHUD.DrawDesignerHud" },	// 4645
+	{ 51128, "Function SFXGame.BioHUD.RemoveBar" },	// 4646
+	{ 51133, "Function SFXGame.BioHUD.HasDesignerText" },	// 4647
+	{ 51157, "Function SFXGame.BioHUD.IsFinalReleaseBuild" },	// 4648
+	{ 51159, "Function SFXGame.BioHUD.StartTraceStrips" },	// 4649
+	{ 51160, "Function SFXGame.BioHUD.HideTraceStrips" },	// 4650
+	{ 51161, "Function SFXGame.BioHUD.UpdateTraceStrips" },	// 4651
+	{ 51163, "Function SFXGame.BioHUD.DrawTraceStrip" },	// 4652
+	{ 51168, "Function SFXGame.BioHUD.DrawTraceStripBacking" },	// 4653
+	{ 51174, "Function SFXGame.BioHUD.DebugDraw_TraceStrips" },	// 4654
+	{ 51382, "Class SFXGame.SFXGameConfig" },	// 4655
+	{ 51412, "Class SFXGame.SFXPowerLevelUpHelper" },	// 4656
+	{ 51485, "Class SFXGame.BioLookAtTarget" },	// 4657
+	{ 51495, "Class SFXGame.SFXDefine" },	// 4658
+	{ 51572, "Class SFXGame.BioMessageBox" },	// 4659
+	{ 51574, "Class SFXGame.BioMetaVFX" },	// 4660
+	{ 51926, "Class SFXGame.BioPathPointFactory" },	// 4661
+	{ 52004, "Class SFXGame.sfxgameeffect_powercombo" },	// 4662
+	{ 52205, "Class SFXGame.SFXPowerCustomAction_PassivePower" },	// 4663
+	{ 52239, "Function SFXGame.SFXGameEffect.ComputeCustomEffectValue" },	// 4664
+	{ 52241, "Function SFXGame.SFXGameEffect.OnApplied" },	// 4665
+	{ 52242, "Function SFXGame.SFXGameEffect.OnUpdate" },	// 4666
+	{ 52244, "Function SFXGame.SFXGameEffect.OnRemoved" },	// 4667
+	{ 52245, "Function SFXGame.SFXGameEffect.OnCombatEnd" },	// 4668
+	{ 52246, "Function SFXGame.SFXGameEffect.OnPaused" },	// 4669
+	{ 52247, "Function SFXGame.SFXGameEffect.OnUnpaused" },	// 4670
+	{ 52248, "Function SFXGame.SFXGameEffect.LoadGameEffectClass" },	// 4671
+	{ 52251, "Function SFXGame.SFXGameEffect.PrecacheVFX" },	// 4672
+	{ 52254, "Function SFXGame.SFXGameEffect.SpawnWeaponImpactVFX" },	// 4673
+	{ 52269, "Function SFXGame.SFXGameEffect.CheckOwnerInstigator" },	// 4674
+	{ 52512, "Class SFXGame.SFXDamageType_Power" },	// 4675
+	{ 52549, "Class SFXGame.SFXDamageType_Weapon" },	// 4676
+	{ 52724, "Class SFXGame.SFXPhysicalMaterialProperty" },	// 4677
+	{ 52731, "Class SFXGame.SFXPhysicalMaterialFootSteps" },	// 4678
+	{ 52732, "Class SFXGame.SFXPhysicalMaterialBase" },	// 4679
+	{ 52844, "Class SFXGame.SFXCustomAction_DamageReaction" },	// 4680
+	{ 53068, "Class SFXGame.SFXSeqAct_GiveWeapon" },	// 4681
+	{ 53089, "Function SFXGame.SFXWeapon.GetMaxSpareAmmo" },	// 4682
+	{ 53129, "Function SFXGame.SFXWeapon.HasAmmo" },	// 4683
+	{ 53200, "Class SFXGame.BioSeqEvt_OnCastAt" },	// 4684
+	{ 53288, "Class SFXGame.SFXSeqEvt_Ragdoll" },	// 4685
+	{ 53301, "Class SFXGame.SFXKillRagdollVolume" },	// 4686
+	{ 53445, "Class SFXGame.SFXGameEffect_DeathEffect" },	// 4687
+	{ 53520, "Class SFXGame.SFXCustomAction_SyncPawnPartner_Base" },	// 4688
+	{ 53550, "Class SFXGame.sfxmodule_damageplayer" },	// 4689
+	{ 53557, "Class SFXGame.SFXSeqEvt_ImpactedByPower" },	// 4690
+	{ 53573, "Class SFXGame.SFXDamageType_Power_Fire" },	// 4691
+	{ 53574, "Class SFXGame.SFXDamageType_Power_Electrocute" },	// 4692
+	{ 53575, "Class SFXGame.SFXDamageType_Power_Freeze" },	// 4693
+	{ 53606, "Class SFXGame.SFXDamageType_Melee" },	// 4694
+	{ 53607, "Class SFXGame.SFXDamageType_SecondMelee" },	// 4695
+	{ 53608, "Class SFXGame.SFXDamageType_ThirdMelee" },	// 4696
+	{ 53651, "Class SFXGame.BioSeqEvt_NotifyLimbDetached" },	// 4697
+	{ 53658, "Class SFXGame.BioSeqAct_OrbitalGame" },	// 4698
+	{ 53661, "Class SFXGame.BioSeqAct_MultiLand" },	// 4699
+	{ 53812, "Function SFXGame.sfxpowercustomaction.ClientDoPowerComboImpact" },	// 4700
+	{ 53918, "Class SFXGame.SFXCustomAction_MoveAlongCover" },	// 4701
+	{ 53938, "Function SFXGame.sfxai_core.IsReturningToPlaypen" },	// 4702
+	{ 54000, "Function SFXGame.SFXWeapon.GetDamageVocProbabilityMod" },	// 4703
+	{ 54238, "Class SFXGame.SFXDamageType_PowerPhysics" },	// 4704
+	{ 54541, "Class SFXGame.SFXCustomAction_MountedGunReload" },	// 4705
+	{ 54542, "Class SFXGame.SFXCustomAction_SingleAnim" },	// 4706
+	{ 54543, "Class SFXGame.SFXCustomAction_EnterMountedGun" },	// 4707
+	{ 54544, "Class SFXGame.SFXCustomAction_ExitMountedGun" },	// 4708
+	{ 54635, "Class SFXGame.SFXPhysicalMaterialPhysics" },	// 4709
+	{ 55142, "Function SFXGame.sfxai_core.MoveToDelegate" },	// 4710
+	{ 55144, "Function SFXGame.sfxai_core.FireWeaponDelegate" },	// 4711
+	{ 55145, "Function SFXGame.sfxai_core.UsePowerDelegate" },	// 4712
+	{ 55149, "Function SFXGame.sfxai_core.TryInvalidateTargetRange" },	// 4713
+	{ 55152, "Function SFXGame.sfxai_core.TryInvalidateTargetFlank" },	// 4714
+	{ 55154, "Function SFXGame.sfxai_core.NotifyPlaypenChanged" },	// 4715
+	{ 55155, "Function SFXGame.sfxai_core.UsePowerOnTarget" },	// 4716
+	{ 55164, "Function SFXGame.sfxai_core.FireWeaponAtTarget" },	// 4717
+	{ 55176, "Function SFXGame.sfxai_core.MoveToGoalExternal" },	// 4718
+	{ 55188, "Function SFXGame.sfxai_core.StartFollowingActor" },	// 4719
+	{ 55194, "Function SFXGame.sfxai_core.StopFollowingActor" },	// 4720
+	{ 55197, "Function SFXGame.sfxai_core.AssignGoHereDelegates" },	// 4721
+	{ 55202, "Function SFXGame.sfxai_core.ClearGoHereDelegates" },	// 4722
+	{ 55203, "Function SFXGame.sfxai_core.Reset" },	// 4723
+	{ 55217, "Function SFXGame.sfxai_core.PostBeginPlay" },	// 4724
+	{ 55219, "Function SFXGame.sfxai_core.ResetEvadeDamage" },	// 4725
+	{ 55221, "Function SFXGame.sfxai_core.Initialize" },	// 4726
+	{ 55230, "Function SFXGame.sfxai_core.BeginDefaultCommand" },	// 4727
+	{ 55231, "Function SFXGame.sfxai_core.CanSwitchMood" },	// 4728
+	{ 55234, "Function SFXGame.sfxai_core.ResetCombatMood" },	// 4729
+	{ 55236, "Function SFXGame.sfxai_core.NotifyMoodChange" },	// 4730
+	{ 55241, "Function SFXGame.sfxai_core.SelectTarget" },	// 4731
+	{ 55258, "Function SFXGame.sfxai_core.AdjustRatingByTickets" },	// 4732
+	{ 55265, "Function SFXGame.sfxai_core.AdjustEnemyRating" },	// 4733
+	{ 55268, "Function SFXGame.sfxai_core.OnTargetChanged" },	// 4734
+	{ 55269, "Function SFXGame.sfxai_core.TriggerAttackVocalization" },	// 4735
+	{ 55270, "Function SFXGame.sfxai_core.IsFiringWeapon" },	// 4736
+	{ 55273, "Function SFXGame.sfxai_core.CanFireWeapon" },	// 4737
+	{ 55277, "Function SFXGame.sfxai_core.IsFireLineObstructed" },	// 4738
+	{ 55278, "Function SFXGame.sfxai_core.CanFireWeaponNoLOS" },	// 4739
+	{ 55283, "Function SFXGame.sfxai_core.IsFriendlyBlockingFireLine" },	// 4740
+	{ 55291, "Function SFXGame.sfxai_core.StartFiring" },	// 4741
+	{ 55295, "Function SFXGame.sfxai_core.NotifyWeaponFired" },	// 4742
+	{ 55300, "Function SFXGame.sfxai_core.NotifyWeaponFinishedFiring" },	// 4743
+	{ 55304, "Function SFXGame.sfxai_core.NotifyAiming" },	// 4744
+	{ 55307, "Function SFXGame.sfxai_core.NotifyChangedWeapon" },	// 4745
+	{ 55312, "Function SFXGame.SFXWeapon.GetAIAimDelay" },	// 4746
+	{ 55314, "Function SFXGame.sfxai_core.ResetAimInstability" },	// 4747
+	{ 55317, "Function SFXGame.sfxai_core.UpdateAccuracy" },	// 4748
+	{ 55320, "Function SFXGame.sfxai_core.GetAdjustedAimFor" },	// 4749
+	{ 55343, "Function SFXGame.sfxai_core.GetAttackOrigin" },	// 4750
+	{ 55347, "Function SFXGame.sfxai_core.CanAttack" },	// 4751
+	{ 55362, "Function SFXGame.sfxai_core.GetBestCoverAction" },	// 4752
+	{ 55379, "Function SFXGame.sfxai_core.NotifyTakeHit" },	// 4753
+	{ 55387, "Function SFXGame.sfxai_core.NotifyNearMiss" },	// 4754
+	{ 55390, "Function SFXGame.sfxai_core.NotifyPendingPowerImpact" },	// 4755
+	{ 55397, "Function SFXGame.sfxai_core.NotifyUnderAttack" },	// 4756
+	{ 55399, "Function SFXGame.sfxai_core.NotifyBump" },	// 4757
+	{ 55410, "Function SFXGame.sfxai_core.NotifyHitWall" },	// 4758
+	{ 55418, "Function SFXGame.sfxai_core.NotifyEnemyVisible" },	// 4759
+	{ 55422, "Function SFXGame.sfxai_core.PushPawn" },	// 4760
+	{ 55428, "Function SFXGame.sfxai_core.RespondToPush" },	// 4761
+	{ 55430, "Class SFXGame.SFXAICmd_MoveToLocation" },	// 4762
+	{ 55433, "Function SFXGame.sfxai_core.GetBestTargetCoverAction" },	// 4763
+	{ 55437, "Function SFXGame.sfxai_core.GetAimLocation" },	// 4764
+	{ 55450, "Function SFXGame.sfxai_core.CalculateGrenadeArc" },	// 4765
+	{ 55464, "Function SFXGame.sfxai_core.NotifyWeaponDelayFinished" },	// 4766
+	{ 55466, "Function SFXGame.sfxai_core.ApplyBasePathConstraints" },	// 4767
+	{ 55470, "Function SFXGame.sfxai_core.SetMoveGoal" },	// 4768
+	{ 55474, "Function SFXGame.sfxai_core.PeriodicMoveCheck" },	// 4769
+	{ 55476, "Function SFXGame.sfxai_core.SetMovementSpeed" },	// 4770
+	{ 55479, "Function SFXGame.sfxai_core.WantsToRun" },	// 4771
+	{ 55483, "Function SFXGame.sfxai_core.PrecisionMove" },	// 4772
+	{ 55486, "Class SFXGame.SFXCustomAction_PrecisionMove" },	// 4773
+	{ 55487, "Function SFXGame.sfxai_core.CancelAction" },	// 4774
+	{ 55494, "Function SFXGame.sfxai_core.ClearCancelAction" },	// 4775
+	{ 55495, "Function SFXGame.sfxai_core.Attack" },	// 4776
+	{ 55499, "Class SFXGame.SFXAICmd_UsePower" },	// 4777
+	{ 55503, "Function SFXGame.sfxai_core.ChooseAttack" },	// 4778
+	{ 55514, "Function SFXGame.sfxai_core.ShouldReload" },	// 4779
+	{ 55519, "Function SFXGame.SFXWeapon.CanReload" },	// 4780
+	{ 55522, "Function SFXGame.sfxai_core.RELOAD" },	// 4781
+	{ 55525, "Function SFXGame.sfxai_core.RequestPowerReservation" },	// 4782
+	{ 55536, "Function SFXGame.sfxai_core.ClearPowerReservation" },	// 4783
+	{ 55539, "Function SFXGame.sfxai_core.AcquireTicket" },	// 4784
+	{ 55548, "Function SFXGame.sfxai_core.ReleaseTicket" },	// 4785
+	{ 55553, "Function SFXGame.sfxai_core.GetPowerUsePercent" },	// 4786
+	{ 55555, "Function SFXGame.sfxai_core.SetSquadIntoCombat" },	// 4787
+	{ 55556, "Function SFXGame.sfxai_core.SwitchWeapon" },	// 4788
+	{ 55559, "Function SFXGame.sfxai_core.Taunt" },	// 4789
+	{ 55560, "Function SFXGame.sfxai_core.PlayAmbientVoc" },	// 4790
+	{ 55561, "Function SFXGame.sfxai_core.CheckPendingWeaponSwitch" },	// 4791
+	{ 55562, "Function SFXGame.sfxai_core.NotifyDeathBlow" },	// 4792
+	{ 55565, "Class SFXGame.SFXAICmd_Fallen" },	// 4793
+	{ 55566, "Function SFXGame.sfxai_core.NotifyFriendDied" },	// 4794
+	{ 55569, "Function SFXGame.sfxai_core.OnEnteringStasis" },	// 4795
+	{ 55570, "Function SFXGame.sfxai_core.IsFlankedByTarget" },	// 4796
+	{ 55579, "Class SFXGame.SFXAICmd_ReturnToPlaypen" },	// 4797
+	{ 55580, "Class SFXGame.SFXAICommand_Base_Combat" },	// 4798
+	{ 55581, "Function SFXGame.sfxai_core.OnLeftPlaypen" },	// 4799
+	{ 55582, "Function SFXGame.sfxai_core.BeginCombatCommand" },	// 4800
+	{ 55583, "Function SFXGame.sfxai_core.IsActorInPlaypen" },	// 4801
+	{ 55586, "Function SFXGame.sfxai_core.BioClearCrossLevelReferences" },	// 4802
+	{ 55588, "Function SFXGame.sfxai_core.DrawLocationMarker" },	// 4803
+	{ 55596, "Function SFXGame.sfxai_core.RespondToBump" },	// 4804
+	{ 55600, "Function SFXGame.sfxai_core.GetPeriodicMoveInterval" },	// 4805
+	{ 55602, "Function SFXGame.sfxai_core.OnEnteredPlaypen" },	// 4806
+	{ 55604, "Function SFXGame.sfxai_core.UpdateMovementActions" },	// 4807
+	{ 55606, "Function SFXGame.sfxai_core.UpdateMovementFocus" },	// 4808
+	{ 55608, "Function SFXGame.sfxai_core.CanChoosePower" },	// 4809
+	{ 55613, "Function SFXGame.sfxpowercustomaction.CanUsePower" },	// 4810
+	{ 55616, "Function SFXGame.sfxai_core.ChooseAttackPower" },	// 4811
+	{ 55631, "Function SFXGame.sfxpowercustomaction.GetProjectileAttachPoint" },	// 4812
+	{ 55633, "Function SFXGame.sfxai_core.ChooseDefensivePower" },	// 4813
+	{ 55640, "Function SFXGame.sfxai_core.CanShootWeapon" },	// 4814
+	{ 55643, "Function SFXGame.sfxai_core.ShootWeaponAtFireTarget" },	// 4815
+	{ 55648, "Class SFXGame.SFXAICmd_FireWeapon" },	// 4816
+	{ 55651, "Function SFXGame.sfxai_core.TargetRange" },	// 4817
+	{ 55653, "Function SFXGame.sfxai_core.IsInWeaponRange" },	// 4818
+	{ 55664, "Function SFXGame.sfxai_core.FindClosestApproachDistance" },	// 4819
+	{ 55671, "Function SFXGame.sfxai_core.FindSuppressionPoint" },	// 4820
+	{ 55685, "Function SFXGame.sfxai_core.NotifyArmourDestroyed" },	// 4821
+	{ 55689, "Function SFXGame.sfxai_core.NotifyArmourHit" },	// 4822
+	{ 55701, "Class SFXGame.SFXAICmd_Disabled" },	// 4823
+	{ 55703, "Function SFXGame.sfxai_core.IgnoreTimeTransitions" },	// 4824
+	{ 55706, "Function SFXGame.sfxai_core.CheckInterruptCombatTransitions" },	// 4825
+	{ 55709, "Class SFXGame.SFXAICmd_KismetOrder" },	// 4826
+	{ 55710, "Function SFXGame.sfxai_core.IsCombatStale" },	// 4827
+	{ 55717, "Function SFXGame.sfxai_core.IsTargetStealthed" },	// 4828
+	{ 55721, "Function SFXGame.sfxai_core.ReactToNearbyEnemy" },	// 4829
+	{ 55724, "Function SFXGame.sfxai_core.ReactToFlank" },	// 4830
+	{ 55727, "Function SFXGame.sfxai_core.InitialCheckTimedCombatTransition" },	// 4831
+	{ 55728, "Function SFXGame.sfxai_core.CheckTimedCombatTransition" },	// 4832
+	{ 55751, "Class SFXGame.SFXAICmd_FollowActor" },	// 4833
+	{ 55758, "Function SFXGame.sfxai_core.GetActorToFollow" },	// 4834
+	{ 55761, "Function SFXGame.sfxai_core.HasNearbyEnemy" },	// 4835
+	{ 55765, "Function SFXGame.sfxai_core.ShouldStayLeanedOut" },	// 4836
+	{ 55767, "Function SFXGame.sfxai_core.ShouldCancelMove" },	// 4837
+	{ 55770, "Function SFXGame.sfxai_core.ShouldPartialLean" },	// 4838
+	{ 55775, "Function SFXGame.sfxai_core.GetBestEvadeDir" },	// 4839
+	{ 55799, "Function SFXGame.sfxai_core.ShouldMelee" },	// 4840
+	{ 55805, "Function SFXGame.sfxai_core.ShouldSyncMelee" },	// 4841
+	{ 55812, "Function SFXGame.sfxai_core.ShouldPowerEvade" },	// 4842
+	{ 55815, "Function SFXGame.sfxai_core.ShouldKillPlayer" },	// 4843
+	{ 55820, "Function SFXGame.sfxai_core.DoMeleeAttack" },	// 4844
+	{ 55821, "Function SFXGame.sfxai_core.GetMoveFireDelayTime" },	// 4845
+	{ 55824, "Function SFXGame.sfxai_core.NotifyKnockedOutOfCover" },	// 4846
+	{ 55825, "Function SFXGame.sfxai_core.IsAtCover" },	// 4847
+	{ 55827, "Function SFXGame.sfxai_core.NotifyCombatZoneAdded" },	// 4848
+	{ 55828, "Function SFXGame.sfxai_core.NotifyCombatZoneRemoved" },	// 4849
+	{ 55829, "Function SFXGame.sfxai_core.NotifyStuck" },	// 4850
+	{ 55830, "Function SFXGame.sfxai_core.CleanUpStaleAI" },	// 4851
+	{ 55834, "Function SFXGame.sfxai_core.GetMinDistanceToAnyPlayer" },	// 4852
+	{ 55839, "Function SFXGame.sfxai_core.FindDrivablePawn" },	// 4853
+	{ 55851, "Function SFXGame.sfxai_core.OnPossessTurret" },	// 4854
+	{ 55853, "Class SFXGame.SFXSeqAct_PossessTurret" },	// 4855
+	{ 55856, "Function SFXGame.sfxai_core.CanTurretFireAt" },	// 4856
+	{ 55862, "Function SFXGame.sfxai_core.DrawDifficulty" },	// 4857
+	{ 55864, "Function SFXGame.sfxai_core.CheckDownedPlayers" },	// 4858
+	{ 55869, "Class SFXGame.sfxaicmd_killingblow" },	// 4859
+	{ 55957, "Class SFXGame.SFXAICmd_MoveToCover" },	// 4860
+	{ 55995, "Class SFXGame.SFXAICmd_CoverUserStuck" },	// 4861
+	{ 56014, "Class SFXGame.SFXAICmd_Base_Melee" },	// 4862
+	{ 56018, "Class SFXGame.SFXAICmd_Reaction_Flank" },	// 4863
+	{ 56021, "Class SFXGame.SFXSeqAct_CoverUserEvade" },	// 4864
+	{ 56033, "Class SFXGame.SFXAICmd_Berserk" },	// 4865
+	{ 56147, "Class SFXGame.SFXAICmd_Resurrect" },	// 4866
+	{ 56165, "Class SFXGame.SFXAICmd_AcquireCover" },	// 4867
+	{ 56172, "Class SFXGame.SFXAICmd_AcquireCoverNearHoldLoc" },	// 4868
+	{ 56178, "Class SFXGame.SFXAICmd_MoveToGoal" },	// 4869
+	{ 56189, "Class SFXGame.SFXAICmd_Combat_Henchman" },	// 4870
+	{ 56234, "Class SFXGame.SFXAICmd_MoveAwayFromPlayer" },	// 4871
+	{ 56315, "Class SFXGame.SFXGameEffect_PassiveWeaponDamageBonus" },	// 4872
+	{ 56357, "Class SFXGame.SFXAICmd_ExecuteOrders" },	// 4873
+	{ 56371, "Class SFXGame.SFXAICmd_ResetHenchman" },	// 4874
+	{ 56372, "Class SFXGame.SFXAICmd_HenchFollowActor" },	// 4875
+	{ 56373, "Class SFXGame.SFXAICmd_MoveToHoldLocation" },	// 4876
+	{ 57479, "Function SFXGame.SFXTelemetry.FStringToFourCC" },	// 4877
+	{ 57983, "Class SFXGame.SFXCustomAction_ClassMelee" },	// 4878
+	{ 57988, "Class SFXGame.SFXCustomAction_SwatTurn_Left" },	// 4879
+	{ 57989, "Class SFXGame.SFXCustomAction_SwatTurn" },	// 4880
+	{ 57994, "Class SFXGame.SFXCustomAction_SwatTurn_Right" },	// 4881
+	{ 58406, "Class SFXGame.BioPlayerReplicationInfo" },	// 4882
+	{ 58901, "Class SFXGame.BioSeqAct_AddPlaypenVolume" },	// 4883
+	{ 58916, "Class SFXGame.BioSeqAct_AddToParty" },	// 4884
+	{ 58939, "Class SFXGame.BioSeqAct_AdjustCostForDiscount" },	// 4885
+	{ 58941, "Class SFXGame.BioSeqAct_AOECauseDamage" },	// 4886
+	{ 58961, "Class SFXGame.BioSeqAct_AreaTransition" },	// 4887
+	{ 58967, "Class SFXGame.BioSeqAct_AttachCrustEffect" },	// 4888
+	{ 58976, "Class SFXGame.BioSeqAct_AttachVisualEffect" },	// 4889
+	{ 59013, "Class SFXGame.BioSeqAct_CauseDamage" },	// 4890
+	{ 59028, "Class SFXGame.BioSeqAct_ClearBrowserWheelStateOverrides" },	// 4891
+	{ 59034, "Class SFXGame.BioSeqAct_Deprecated" },	// 4892
+	{ 59038, "Class SFXGame.BioSeqAct_DUIClear" },	// 4893
+	{ 59043, "Class SFXGame.BioSeqAct_DUISetBarFillDirection" },	// 4894
+	{ 59049, "Class SFXGame.BioSeqAct_DUISetBarFillPercent" },	// 4895
+	{ 59055, "Class SFXGame.BioSeqAct_DUISetBarMarkers" },	// 4896
+	{ 59062, "Class SFXGame.BioSeqAct_DUISetCounterValue" },	// 4897
+	{ 59068, "Class SFXGame.BioSeqAct_DUISetElementColor" },	// 4898
+	{ 59078, "Class SFXGame.BioSeqAct_DUISetElementPulsing" },	// 4899
+	{ 59088, "Class SFXGame.BioSeqAct_DUISetElementVisible" },	// 4900
+	{ 59095, "Class SFXGame.BioSeqAct_DUISetTextStringRef" },	// 4901
+	{ 59108, "Class SFXGame.BioSeqAct_EndGame" },	// 4902
+	{ 59157, "Class SFXGame.BioSeqAct_GetSquad" },	// 4903
+	{ 59184, "Class SFXGame.BioSeqAct_HideSniperHudOverlay" },	// 4904
+	{ 59189, "Class SFXGame.BioSeqAct_InitLoadingMovie" },	// 4905
+	{ 59191, "Class SFXGame.BioSeqAct_InterruptAmbientConversation" },	// 4906
+	{ 59201, "Class SFXGame.BioSeqAct_IsActiveConversation" },	// 4907
+	{ 59212, "Class SFXGame.BioSeqAct_KillPawn" },	// 4908
+	{ 59249, "Class SFXGame.BioSeqAct_NonCombatArea" },	// 4909
+	{ 59320, "Class SFXGame.BioSeqAct_Ragdoll" },	// 4910
+	{ 59327, "Class SFXGame.BioSeqAct_RemoveFromParty" },	// 4911
+	{ 59336, "Class SFXGame.BioSeqAct_ResurrectHenchman" },	// 4912
+	{ 59358, "Class SFXGame.BioSeqAct_SetActive" },	// 4913
+	{ 59364, "Class SFXGame.BioSeqAct_SetBrowserWheelAvailable" },	// 4914
+	{ 59864, "Class SFXGame.BioTimerList" },	// 4915
+	{ 59976, "Class SFXGame.BioSeqAct_SetBrowserWheelStateOverrides" },	// 4916
+	{ 59984, "Class SFXGame.BioSeqAct_SetEnvironmentEffectIntensity" },	// 4917
+	{ 59986, "Class SFXGame.BioSeqAct_SetExploreCameraRotation" },	// 4918
+	{ 59990, "Class SFXGame.SFXCameraMode_Explore" },	// 4919
+	{ 60009, "Class SFXGame.BioSeqAct_SetLookAtTarget" },	// 4920
+	{ 60034, "Class SFXGame.BioSeqAct_ShouldShowSplashSequence" },	// 4921
+	{ 60075, "Class SFXGame.BioSeqAct_ShowMessage" },	// 4922
+	{ 60139, "Class SFXGame.BioSeqAct_SwitchWeighted" },	// 4923
+	{ 60159, "Class SFXGame.BioSeqAct_TalkObjSelect" },	// 4924
+	{ 60194, "Class SFXGame.BioSeqAct_ToggleSave" },	// 4925
+	{ 60201, "Class SFXGame.BioSeqCond_Deprecated" },	// 4926
+	{ 60205, "Class SFXGame.BioSeqCond_InCombat" },	// 4927
+	{ 60220, "Class SFXGame.BioSeqEvt_Deprecated" },	// 4928
+	{ 60228, "Class SFXGame.BioSeqEvt_LoadingScreenClosed" },	// 4929
+	{ 60315, "Class SFXGame.biosfhandler_achievement" },	// 4930
+	{ 60669, "Function SFXGame.SFXTelemetry.SendName" },	// 4931
+	{ 60754, "Class SFXGame.BioSFHandler_SharedIGG" },	// 4932
+	{ 61269, "Class SFXGame.BioSFHandler_GameOver" },	// 4933
+	{ 61311, "Class SFXGame.BioSFHandler_IntroText" },	// 4934
+	{ 61323, "Class SFXGame.BioSFHandler_LoadScreen" },	// 4935
+	{ 61375, "Class SFXGame.SFXGUI_MainMenu_Message_Image" },	// 4936
+	{ 61376, "Class SFXGame.SFXGUI_MainMenu_Message_Text" },	// 4937
+	{ 61385, "Class SFXGame.sfxgui_mainmenu_message_networkimage" },	// 4938
+	{ 61437, "Class SFXGame.SFXGUI_MainMenu_Message_GAW" },	// 4939
+	{ 61727, "Function SFXGame.SFXWeapon.GetPrettyName" },	// 4940
+	{ 61882, "Class SFXGame.SFXPawn_PlayerSoldierNonCombat" },	// 4941
+	{ 61883, "Class SFXGame.SFXPawn_PlayerNonCombat" },	// 4942
+	{ 62107, "Class SFXGame.sfxtelemetryhooks" },	// 4943
+	{ 62269, "Class SFXGame.SFXPawn_PlayerSoldier" },	// 4944
+	{ 62270, "Class SFXGame.SFXPawn_PlayerInfiltrator" },	// 4945
+	{ 62271, "Class SFXGame.SFXPawn_PlayerSentinel" },	// 4946
+	{ 62272, "Class SFXGame.SFXPawn_PlayerAdept" },	// 4947
+	{ 62273, "Class SFXGame.SFXPawn_PlayerEngineer" },	// 4948
+	{ 62295, "Function SFXGame.BioSFHandler_Options.AddTelem" },	// 4949
+	{ 62352, "Function SFXGame.BioSFHandler_Options.OnCloseCallback" },	// 4950
+	{ 62353, "Function SFXGame.BioSFHandler_Options.SetOnCloseCallback" },	// 4951
+	{ 62356, "Function SFXGame.BioSFHandler_Options.Helper_CreateResetConfirmPopup" },	// 4952
+	{ 62365, "Function SFXGame.BioSFHandler_Options.Helper_ExtractPackedOptIDs" },	// 4953
+	{ 62372, "Function SFXGame.BioSFHandler_Options.ResetToDefaults" },	// 4954
+	{ 62375, "Function SFXGame.BioSFHandler_Options.Callback_ResetToDefaults" },	// 4955
+	{ 62388, "Function SFXGame.BioSFHandler_Options.UpdateSpeechLanguageOptions" },	// 4956
+	{ 62390, "Function SFXGame.BioSFHandler_Options.SetOptionsOnGUI" },	// 4957
+	{ 62392, "Function SFXGame.BioSFHandler_Options.SetOption" },	// 4958
+	{ 62395, "Function SFXGame.BioSFHandler_Options.GetProfileSettingForOption" },	// 4959
+	{ 62398, "Function SFXGame.BioSFHandler_Options.GetProfileSettingsForOptions" },	// 4960
+	{ 62403, "Function SFXGame.BioSFHandler_Options.UpdateDisplayGamma" },	// 4961
+	{ 62405, "Function SFXGame.BioSFHandler_Options.UpdateAudioVolumeSettings" },	// 4962
+	{ 62407, "Function SFXGame.BioSFHandler_Options.AddTelem_Int" },	// 4963
+	{ 62413, "Function SFXGame.BioSFHandler_Options.AddTelem_Bool" },	// 4964
+	{ 62419, "Function SFXGame.BioSFHandler_Options.AddTelem_InvBool" },	// 4965
+	{ 62425, "Function SFXGame.BioSFHandler_Options.AddTelem_Brightness" },	// 4966
+	{ 62431, "Function SFXGame.BioSFHandler_Options.AddTelem_Resolution" },	// 4967
+	{ 62437, "Function SFXGame.BioSFHandler_Options.AddTelem_VCInput" },	// 4968
+	{ 62443, "Function SFXGame.BioSFHandler_Options.AddTelem_VCOutput" },	// 4969
+	{ 62449, "Function SFXGame.BioSFHandler_Options.AddTelem_Language" },	// 4970
+	{ 62455, "Function SFXGame.BioSFHandler_Options.AddTelemetryInfo" },	// 4971
+	{ 62463, "Function SFXGame.BioSFHandler_Options.SendTelemetryChanges" },	// 4972
+	{ 62464, "Function SFXGame.BioSFHandler_Options.SendTelemetryDump" },	// 4973
+	{ 62466, "Function SFXGame.BioSFHandler_Options.InitSystemSettingsCache" },	// 4974
+	{ 62467, "Function SFXGame.BioSFHandler_Options.OnStart" },	// 4975
+	{ 62470, "Function SFXGame.BioSFHandler_Options.CloseGui" },	// 4976
+	{ 62479, "Function SFXGame.BioSFHandler_Options.OnPanelAdded" },	// 4977
+	{ 62480, "Function SFXGame.BioSFHandler_Options.MovieLoaded" },	// 4978
+	{ 62482, "Function SFXGame.BioSFHandler_Options.SaveAndExit" },	// 4979
+	{ 62502, "Class SFXGame.biosfhandler_pcachievement" },	// 4980
+	{ 62508, "Class SFXGame.BioSFHandler_PCChoiceGUI" },	// 4981
+	{ 62521, "Class SFXGame.BioSFHandler_PCDesignerUI" },	// 4982
+	{ 62571, "Class SFXGame.BioSFHandler_PCGameOver" },	// 4983
+	{ 62642, "Function SFXGame.BioSFHandler_PCOptions.OnPanelAdded" },	// 4984
+	{ 62643, "Function SFXGame.BioSFHandler_PCOptions.MovieLoaded" },	// 4985
+	{ 62644, "Function SFXGame.BioSFHandler_PCOptions.InitPCBindings" },	// 4986
+	{ 62645, "Function SFXGame.BioSFHandler_PCOptions.ResetToDefaults" },	// 4987
+	{ 62647, "Function SFXGame.BioSFHandler_PCOptions.Callback_ResetPCBindings" },	// 4988
+	{ 62650, "Function SFXGame.BioSFHandler_PCOptions.Helper_DoPCBindingReset" },	// 4989
+	{ 62652, "Function SFXGame.BioSFHandler_PCOptions.RefreshGUIBindings" },	// 4990
+	{ 62653, "Function SFXGame.BioSFHandler_PCOptions.Callback_ResetPCToDefaults" },	// 4991
+	{ 62656, "Function SFXGame.BioSFHandler_PCOptions.ResetPCToDefaults" },	// 4992
+	{ 62657, "Function SFXGame.BioSFHandler_PCOptions.BuildControlBindingList" },	// 4993
+	{ 62659, "Function SFXGame.BioSFHandler_PCOptions.CaptureNewBinding" },	// 4994
+	{ 62665, "Function SFXGame.BioSFHandler_PCOptions.ResetPCBindings" },	// 4995
+	{ 62671, "Function SFXGame.BioSFHandler_PCOptions.SaveAndExit" },	// 4996
+	{ 62674, "Function SFXGame.BioSFHandler_PCOptions.WillChangeDisplay" },	// 4997
+	{ 62675, "Function SFXGame.BioSFHandler_PCOptions.ApplySettings" },	// 4998
+	{ 62676, "Function SFXGame.BioSFHandler_PCOptions.ApplyPCBindings" },	// 4999
+	{ 62677, "Function SFXGame.BioSFHandler_PCOptions.ConfirmDisplayChange" },	// 5000
+	{ 62684, "Function SFXGame.BioSFHandler_PCOptions.Callback_DisplayChangeTimeout" },	// 5001
+	{ 62685, "Function SFXGame.BioSFHandler_PCOptions.RevertSettings" },	// 5002
+	{ 62686, "Function SFXGame.BioSFHandler_PCOptions.Callback_ConfirmDisplayChange" },	// 5003
+	{ 62689, "Function SFXGame.BioSFHandler_PCOptions.ProcessInput" },	// 5004
+	{ 62703, "Class SFXGame.BioSFHandler_PCPauseMenu" },	// 5005
+	{ 62721, "Class SFXGame.BioSFHandler_SelectCharacter" },	// 5006
+	{ 62769, "Class SFXGame.BioSFHandler_SniperOverlay" },	// 5007
+	{ 62840, "Class SFXGame.BioSimpleDialogContainer" },	// 5008
+	{ 62905, "Class SFXGame.BioSkillGame_Bypass_PCHandler" },	// 5009
+	{ 62933, "Class SFXGame.BioSkillGame_Decryption_PCHandler" },	// 5010
+	{ 62936, "Class SFXGame.BioSkillMap" },	// 5011
+	{ 62948, "Class SFXGame.BioSkillMap_Door" },	// 5012
+	{ 62950, "Class SFXGame.BioSkillMap_Test" },	// 5013
+	{ 62954, "Class SFXGame.BioSquadCombat" },	// 5014
+	{ 62994, "Class SFXGame.BioStartLocation" },	// 5015
+	{ 62997, "Class SFXGame.BioStartPoint" },	// 5016
+	{ 63004, "Class SFXGame.BioTempNavPoint" },	// 5017
+	{ 63089, "Class SFXGame.BioTrigger" },	// 5018
+	{ 63103, "Class SFXGame.BioTriggerActorFactory" },	// 5019
+	{ 63145, "Class SFXGame.BioTriggerVolume" },	// 5020
+	{ 63158, "Class SFXGame.BioVectorParameterInstTrack" },	// 5021
+	{ 63160, "Class SFXGame.BioVectorParameterTrack" },	// 5022
+	{ 63162, "Class SFXGame.BioVFXTemplate" },	// 5023
+	{ 63164, "Class SFXGame.BioVisualEffectPool" },	// 5024
+	{ 63166, "Class SFXGame.BioVisualEffectTrack" },	// 5025
+	{ 63168, "Class SFXGame.BioVisualEffectTrackInst" },	// 5026
+	{ 63181, "Class SFXGame.BioWaypointSetFactory" },	// 5027
+	{ 63183, "Class SFXGame.BioWorldInfoTick" },	// 5028
+	{ 63185, "Class SFXGame.BioWp_Kismet" },	// 5029
+	{ 63196, "Class SFXGame.DynamicCylindricalForceActor" },	// 5030
+	{ 63734, "Function SFXGame.SFXTelemetry.SendAchievement" },	// 5031
+	{ 63931, "Class SFXGame.SFXMatchResultsData" },	// 5032
+	{ 64135, "Class SFXGame.SFXActorFactoryEnemySpawnPoint" },	// 5033
+	{ 64137, "Class SFXGame.SFXEnemySpawnPoint" },	// 5034
+	{ 64138, "Class SFXGame.SFXActorFactoryPhysicsAsset" },	// 5035
+	{ 64140, "Class SFXGame.SFXKAssetSpawnable" },	// 5036
+	{ 64141, "Class SFXGame.SFXAI_Critter" },	// 5037
+	{ 64160, "Class SFXGame.SFXAICmd_Critter" },	// 5038
+	{ 64161, "Class SFXGame.SFXAI_None" },	// 5039
+	{ 64164, "Class SFXGame.SFXAICmd_None" },	// 5040
+	{ 64165, "Class SFXGame.SFXAI_TechDrone" },	// 5041
+	{ 64175, "Class SFXGame.SFXAICmd_Combat_TechDrone" },	// 5042
+	{ 64176, "Class SFXGame.SFXAI_TechDrone_NPC" },	// 5043
+	{ 64190, "Class SFXGame.SFXAICmd_Combat_TechDroneNPC" },	// 5044
+	{ 64306, "Class SFXGame.SFXAICmd_Base_HordeApproach" },	// 5045
+	{ 64338, "Class SFXGame.SFXAICmd_Base_MountedGunner" },	// 5046
+	{ 64399, "Class SFXGame.SFXAICmd_CA_DamageReaction" },	// 5047
+	{ 64455, "Class SFXGame.SFXAICmd_MoveAway" },	// 5048
+	{ 64465, "Class SFXGame.SFXAICmd_Combat_Turret" },	// 5049
+	{ 64528, "Class SFXGame.SFXAICmd_HenchmanInteraction" },	// 5050
+	{ 64533, "Class SFXGame.SFXAICmd_EnterCover" },	// 5051
+	{ 64549, "Class SFXGame.SFXAICmd_EnterMountedGun" },	// 5052
+	{ 64566, "Class SFXGame.SFXAICmd_SwitchWeapon" },	// 5053
+	{ 64619, "Class SFXGame.SFXAICmd_WaitForAnimatedTransition" },	// 5054
+	{ 64709, "Class SFXGame.SFXCustomAction_InteractionPointAnim" },	// 5055
+	{ 64713, "Class SFXGame.SFXNav_InteractionHenchManual" },	// 5056
+	{ 64716, "Class SFXGame.SFXNav_InteractionHenchCover" },	// 5057
+	{ 64718, "Class SFXGame.SFXAICmd_InteractionAnim" },	// 5058
+	{ 64916, "Class SFXGame.SFXAICmd_MoveToMeleeRange" },	// 5059
+	{ 65139, "Class SFXGame.SFXSFHandler_AreaMap" },	// 5060
+	{ 65163, "Class SFXGame.SFXAreaMapData" },	// 5061
+	{ 65316, "Class SFXGame.SFXArmorUseModule" },	// 5062
+	{ 65343, "Class SFXGame.SFXArmorNode" },	// 5063
+	{ 65426, "Class SFXGame.SFXBlockingVolume_Ledge" },	// 5064
+	{ 65429, "Class SFXGame.SFXCameraAction_FollowTarget" },	// 5065
+	{ 65510, "Class SFXGame.SFXCameraAction_QuickTurn" },	// 5066
+	{ 65522, "Class SFXGame.SFXCameraMode_Combat" },	// 5067
+	{ 65523, "Function SFXGame.SFXCameraMode_Combat.MakeActive" },	// 5068
+	{ 65526, "Function SFXGame.SFXCameraMode_Combat.MakeInactive" },	// 5069
+	{ 65531, "Class SFXGame.SFXCameraMode_AdeptPunch" },	// 5070
+	{ 65535, "Class SFXGame.SFXCameraMode_AIDebug" },	// 5071
+	{ 65553, "Class SFXGame.SFXCameraMode_Atlas" },	// 5072
+	{ 65557, "Class SFXGame.SFXCameraMode_CombatStorm" },	// 5073
+	{ 65576, "Class SFXGame.SFXCameraMode_Cover" },	// 5074
+	{ 65582, "Class SFXGame.SFXCameraMode_CoverMeleeLeft" },	// 5075
+	{ 65588, "Class SFXGame.SFXCameraMode_CoverMeleeRight" },	// 5076
+	{ 65592, "Class SFXGame.SFXCameraMode_CoverStorm" },	// 5077
+	{ 65598, "Class SFXGame.SFXCameraMode_CoverStormHigh" },	// 5078
+	{ 65604, "Class SFXGame.SFXCameraMode_CoverSwatTurnHigh" },	// 5079
+	{ 65610, "Class SFXGame.SFXCameraMode_CoverSwatTurnLow" },	// 5080
+	{ 65616, "Class SFXGame.SFXCameraMode_CoverSyncMelee" },	// 5081
+	{ 65620, "Class SFXGame.SFXCameraMode_CoverSyncMeleeLeft" },	// 5082
+	{ 65624, "Class SFXGame.SFXCameraMode_CustomAction" },	// 5083
+	{ 65628, "Class SFXGame.SFXCameraMode_EnterCover" },	// 5084
+	{ 65636, "Class SFXGame.SFXCameraMode_ExploreStorm" },	// 5085
+	{ 65654, "Class SFXGame.SFXCameraMode_ForwardRoll" },	// 5086
+	{ 65658, "Class SFXGame.SFXCameraMode_HipAimCover" },	// 5087
+	{ 65662, "Class SFXGame.SFXCameraMode_HitReaction" },	// 5088
+	{ 65666, "Class SFXGame.SFXCameraMode_IllusiveManConflict" },	// 5089
+	{ 65697, "Class SFXGame.SFXSeqAct_BeginIllusiveManConflict" },	// 5090
+	{ 65737, "Class SFXGame.SFXCameraMode_JumpStart" },	// 5091
+	{ 65741, "Class SFXGame.SFXCameraMode_KroganMelee" },	// 5092
+	{ 65745, "Class SFXGame.SFXCameraMode_LadderDown" },	// 5093
+	{ 65765, "Class SFXGame.SFXCameraMode_LadderUp" },	// 5094
+	{ 65769, "Class SFXGame.SFXCameraMode_LockOnPawn" },	// 5095
+	{ 65786, "Class SFXGame.SFXCameraMode_Melee" },	// 5096
+	{ 65790, "Class SFXGame.SFXCustomAction_ProceduralSync" },	// 5097
+	{ 65802, "Class SFXGame.SFXCameraMode_TightAim" },	// 5098
+	{ 65814, "Function SFXGame.SFXWeapon.GetZoomFOV" },	// 5099
+	{ 65820, "Class SFXGame.SFXCameraMode_MountedGunTightAim" },	// 5100
+	{ 65825, "Class SFXGame.SFXCameraMode_PistolTightAim" },	// 5101
+	{ 65830, "Class SFXGame.SFXCameraMode_ReplicationDebug" },	// 5102
+	{ 65841, "Class SFXGame.SFXCameraMode_Roll" },	// 5103
+	{ 65845, "Class SFXGame.SFXCameraMode_SniperAim" },	// 5104
+	{ 65850, "Class SFXGame.SFXCameraMode_Spectator" },	// 5105
+	{ 65858, "Class SFXGame.SFXCameraMode_SplitScreenCombat" },	// 5106
+	{ 65862, "Class SFXGame.SFXCameraMode_TightAimCover" },	// 5107
+	{ 65869, "Class SFXGame.SFXCameraMode_Vehicle" },	// 5108
+	{ 65979, "Class SFXGame.SFXCameraTransition_ZoomSnap" },	// 5109
+	{ 65998, "Class SFXGame.SFXCameraSetup" },	// 5110
+	{ 66148, "Class SFXGame.SFXCameraShakeBase" },	// 5111
+	{ 66151, "Class SFXGame.SFXCameraTransition_Animated" },	// 5112
+	{ 66181, "Class SFXGame.SFXCameraTransition_GalaxyMap" },	// 5113
+	{ 66191, "Class SFXGame.SFXCameraTransition_VanguardSlam" },	// 5114
+	{ 66546, "Function SFXGame.SFXCustomAction_ReachSpecMove.InternalCanDoCustomAction" },	// 5115
+	{ 66550, "Function SFXGame.SFXCustomAction_ReachSpecMove.StartCustomAction" },	// 5116
+	{ 66552, "Function SFXGame.SFXCustomAction_ReachSpecMove.BlockMoveEndPoints" },	// 5117
+	{ 66558, "Function SFXGame.SFXCustomAction_ReachSpecMove.RemoveBlockingEndPoints" },	// 5118
+	{ 66561, "Function SFXGame.SFXCustomAction_ReachSpecMove.Replicate" },	// 5119
+	{ 66562, "Function SFXGame.SFXCustomAction_ReachSpecMove.ClientDoCustomAction" },	// 5120
+	{ 66564, "Function SFXGame.SFXCustomAction_ReachSpecMove.PreAlignPawnLocation" },	// 5121
+	{ 66566, "Function SFXGame.SFXCustomAction_ReachSpecMove.StopCustomAction" },	// 5122
+	{ 66686, "Class SFXGame.SFXPowerCustomAction_MeleePassivePower" },	// 5123
+	{ 66808, "Class SFXGame.SFXCustomAction_BackTakeDown" },	// 5124
+	{ 66823, "Function SFXGame.SFXCustomAction_DamageReaction.GetUsedAnimNames" },	// 5125
+	{ 66828, "Function SFXGame.SFXCustomAction_DamageReaction.Init" },	// 5126
+	{ 66836, "Function SFXGame.SFXCustomAction_DamageReaction.StartCustomAction" },	// 5127
+	{ 66845, "Function SFXGame.SFXCustomAction_DamageReaction.OnCustomActionTimeUp" },	// 5128
+	{ 66847, "Function SFXGame.SFXCustomAction_DamageReaction.StopCustomAction" },	// 5129
+	{ 66848, "Function SFXGame.SFXCustomAction_DamageReaction.BodyStanceAnimEndNotification" },	// 5130
+	{ 66853, "Function SFXGame.SFXCustomAction_DamageReaction.CheckForRagdollRecovery" },	// 5131
+	{ 66854, "Function SFXGame.SFXCustomAction_DamageReaction.PrecacheVFX" },	// 5132
+	{ 66858, "Function SFXGame.SFXCustomAction_DamageReaction.ActivateImpactEmitter" },	// 5133
+	{ 66873, "Class SFXGame.SFXCustomAction_BovineFortitude" },	// 5134
+	{ 66903, "Class SFXGame.SFXCustomAction_Cover90TurnBase" },	// 5135
+	{ 66955, "Class SFXGame.SFXCustomAction_Cover90TurnLeft" },	// 5136
+	{ 66957, "Class SFXGame.SFXCustomAction_Cover90TurnLeftStanding" },	// 5137
+	{ 66959, "Class SFXGame.SFXCustomAction_Cover90TurnRight" },	// 5138
+	{ 66961, "Class SFXGame.SFXCustomAction_Cover90TurnRightStanding" },	// 5139
+	{ 66963, "Function SFXGame.SFXCustomAction_SingleAnim.GetUsedAnimNames" },	// 5140
+	{ 66967, "Function SFXGame.SFXCustomAction_SingleAnim.GetBodyStanceAnim" },	// 5141
+	{ 66969, "Function SFXGame.SFXCustomAction_SingleAnim.StartCustomAction" },	// 5142
+	{ 66983, "Function SFXGame.SFXCustomAction_SingleAnim.OnCustomActionTimeUp" },	// 5143
+	{ 66986, "Function SFXGame.SFXCustomAction_SingleAnim.StopCustomAction" },	// 5144
+	{ 66988, "Function SFXGame.SFXCustomAction_SingleAnim.BodyStanceAnimEndNotification" },	// 5145
+	{ 66994, "Class SFXGame.SFXCustomAction_CoverSlipBase" },	// 5146
+	{ 67002, "Class SFXGame.SFXCustomAction_DrawWeapon" },	// 5147
+	{ 67028, "Class SFXGame.SFXCustomAction_ExplosionBack" },	// 5148
+	{ 67032, "Class SFXGame.SFXCustomAction_ExplosionForward" },	// 5149
+	{ 67036, "Class SFXGame.SFXCustomAction_ExplosionLeft" },	// 5150
+	{ 67040, "Class SFXGame.SFXCustomAction_ExplosionRight" },	// 5151
+	{ 67059, "Class SFXGame.SFXCustomAction_HackDoor" },	// 5152
+	{ 67068, "Class SFXGame.SFXCustomAction_HeavyStdCoverMeleeRight" },	// 5153
+	{ 67087, "Class SFXGame.SFXCustomAction_HolsterWeapon" },	// 5154
+	{ 67107, "Function SFXGame.SFXWeapon.IsAnimTypePistol" },	// 5155
+	{ 67121, "Function SFXGame.SFXCustomAction_LadderClimbDownBase.StartCustomAction" },	// 5156
+	{ 67125, "Function SFXGame.SFXCustomAction_LadderClimbDownBase.PreAlignPawnLocation" },	// 5157
+	{ 67126, "Function SFXGame.SFXCustomAction_LadderClimbDownBase.StopCustomAction" },	// 5158
+	{ 67127, "Function SFXGame.SFXCustomAction_LadderClimbDownBase.SetMoveStage" },	// 5159
+	{ 67138, "Class SFXGame.SFXCustomAction_LookAtLoop" },	// 5160
+	{ 67169, "Class SFXGame.SFXCustomAction_Loop" },	// 5161
+	{ 67193, "Class SFXGame.SFXCustomAction_LoopingInteraction" },	// 5162
+	{ 67298, "Class SFXGame.SFXCustomAction_OmniWave" },	// 5163
+	{ 67308, "Class SFXGame.SFXCustomAction_PlayerEvadeBase" },	// 5164
+	{ 67369, "Class SFXGame.SFXCustomAction_PlayerHeavyMeleeBase" },	// 5165
+	{ 67372, "Function SFXGame.SFXCustomAction_PlayerHeavyMeleeBase.StartCustomAction" },	// 5166
+	{ 67380, "Function SFXGame.sfxpowercustomaction.ApplyTemporaryGameEffect" },	// 5167
+	{ 67382, "Class SFXGame.SFXGameEffect_MovementSpeedBonus" },	// 5168
+	{ 67385, "Function SFXGame.sfxpowercustomaction.GetNearbyActors" },	// 5169
+	{ 67389, "Function SFXGame.SFXCustomAction_PlayerHeavyMeleeBase.MeleeImpact" },	// 5170
+	{ 67390, "Function SFXGame.sfxpowercustomaction.DoAreaExplosionForActor" },	// 5171
+	{ 67395, "Function SFXGame.SFXCustomAction_PlayerHeavyMeleeBase.ReplicateImpact" },	// 5172
+	{ 67402, "Function SFXGame.SFXCustomAction_PlayerHeavyMeleeBase.ClientDoCustomActionImpact" },	// 5173
+	{ 67410, "Function SFXGame.SFXCustomAction_PlayerHeavyMeleeBase.OnTimelineImpact" },	// 5174
+	{ 67412, "Function SFXGame.SFXCustomAction_PlayerHeavyMeleeBase.OnActorImpacted" },	// 5175
+	{ 67420, "Function SFXGame.SFXCustomAction_PlayerHeavyMeleeBase.StopCustomAction" },	// 5176
+	{ 67424, "Class SFXGame.SFXDamageType_HeavyMelee" },	// 5177
+	{ 67425, "Class SFXGame.SFXCustomAction_PlayerMeleeBase" },	// 5178
+	{ 67426, "Class SFXGame.SFXCustomAction_ReloadBase" },	// 5179
+	{ 67427, "Function SFXGame.SFXCustomAction_PlayerMeleeBase.StartCustomAction" },	// 5180
+	{ 67431, "Function SFXGame.SFXCustomAction_PlayerMeleeBase.StartInteraction" },	// 5181
+	{ 67433, "Function SFXGame.SFXCustomAction_PlayerMeleeBase.NonSyncedAction" },	// 5182
+	{ 67435, "Function SFXGame.SFXCustomAction_PlayerMeleeBase.GetMeleeImpactParameters" },	// 5183
+	{ 67439, "Function SFXGame.SFXCustomAction_PlayerMeleeBase.MeleeImpact" },	// 5184
+	{ 67444, "Function SFXGame.SFXCustomAction_PlayerMeleeBase.ClientDoCustomActionImpact" },	// 5185
+	{ 67452, "Function SFXGame.SFXCustomAction_PlayerMeleeBase.OnTimelineImpact" },	// 5186
+	{ 67454, "Function SFXGame.SFXCustomAction_PlayerMeleeBase.PrecacheVFX" },	// 5187
+	{ 67460, "Function SFXGame.SFXCustomAction_PlayerMeleeBase.OnActorImpacted" },	// 5188
+	{ 67470, "Function SFXGame.sfxpowercustomaction.PlayParticleSystemOnSocket" },	// 5189
+	{ 67478, "Function SFXGame.SFXCustomAction_PlayerMeleeBase.StopBlur" },	// 5190
+	{ 67479, "Function SFXGame.SFXCustomAction_PlayerMeleeBase.Breakout" },	// 5191
+	{ 67486, "Class SFXGame.SFXCustomAction_PlayerShieldStandardImpact" },	// 5192
+	{ 67538, "Class SFXGame.SFXCustomAction_ShieldFace" },	// 5193
+	{ 67542, "Class SFXGame.SFXCustomAction_SingleAnimInteraction" },	// 5194
+	{ 67626, "Class SFXGame.SFXCustomAction_SyncBase" },	// 5195
+	{ 67652, "Class SFXGame.SFXCustomAction_SyncBase_Loop" },	// 5196
+	{ 67681, "Class SFXGame.SFXCustomAction_SyncMultiPawnInstigator_Base" },	// 5197
+	{ 67722, "Class SFXGame.SFXCustomAction_SyncMultiBase" },	// 5198
+	{ 67771, "Class SFXGame.SFXCustomAction_Utilize" },	// 5199
+	{ 67786, "Class SFXGame.SFXCustomAction_VariableExit" },	// 5200
+	{ 67805, "Class SFXGame.SFXCustomAction_WeaponPickUp" },	// 5201
+	{ 67813, "Class SFXGame.SFXCustomizationInstance" },	// 5202
+	{ 67823, "Class SFXGame.SFXCustomizationInstance_Player" },	// 5203
+	{ 67851, "Class SFXGame.SFXDamageType_CoverMelee" },	// 5204
+	{ 67854, "Class SFXGame.SFXDamageType_CriticalMelee" },	// 5205
+	{ 67864, "Class SFXGame.SFXDamageType_IllusiveManConflict" },	// 5206
+	{ 67867, "Class SFXGame.SFXDamageType_KroganCharge" },	// 5207
+	{ 67870, "Class SFXGame.SFXDamageType_Power_Control" },	// 5208
+	{ 67888, "Class SFXGame.SFXDamageType_Power_Ragdoll" },	// 5209
+	{ 67894, "Class SFXGame.SFXDamageType_Stasis" },	// 5210
+	{ 67902, "Class SFXGame.SFXDecalActorSpawnable" },	// 5211
+	{ 68021, "Class SFXGame.SFXSeqEvt_SFXDoorInteraction" },	// 5212
+	{ 68132, "Class SFXGame.sfxdroppedammo" },	// 5213
+	{ 68193, "Class SFXGame.SFXDroppedPickup" },	// 5214
+	{ 68201, "Function SFXGame.SFXWeapon.OutOfAmmo" },	// 5215
+	{ 68361, "Class SFXGame.SFXEmitter" },	// 5216
+	{ 68377, "Class SFXGame.SFXDynamicPrefabInstance" },	// 5217
+	{ 68433, "Class SFXGame.SFXTeamInfo" },	// 5218
+	{ 68468, "Class SFXGame.SFXMutator" },	// 5219
+	{ 68484, "Class SFXGame.SFXPawn_PlayerAdeptNonCombat" },	// 5220
+	{ 68485, "Class SFXGame.SFXPawn_PlayerInfiltratorNonCombat" },	// 5221
+	{ 68486, "Class SFXGame.SFXPawn_PlayerEngineerNonCombat" },	// 5222
+	{ 68487, "Class SFXGame.SFXPawn_PlayerVanguardNonCombat" },	// 5223
+	{ 68488, "Class SFXGame.SFXPawn_PlayerSentinelNonCombat" },	// 5224
+	{ 68700, "Class SFXGame.SFXSeqEvt_CombatStarted" },	// 5225
+	{ 68710, "Class SFXGame.SFXSeqEvt_CombatEnded" },	// 5226
+	{ 68841, "Class SFXGame.SFXGameChoiceGUIData_HeavyWeapons" },	// 5227
+	{ 68863, "Class SFXGame.SFXGameChoiceGUIData_Research" },	// 5228
+	{ 68891, "Class SFXGame.SFXGameChoiceGUIData_Weapons" },	// 5229
+	{ 68960, "Class SFXGame.SFXGameEffect_DamageOverTime" },	// 5230
+	{ 68974, "Class SFXGame.SFXGameEffect_GlobalCooldownBonus" },	// 5231
+	{ 68988, "Class SFXGame.SFXGameEffect_HealOverTime" },	// 5232
+	{ 68995, "Class SFXGame.SFXGameEffect_HealthRegenPenalty" },	// 5233
+	{ 68998, "Class SFXGame.SFXGameEffect_HealthBonus" },	// 5234
+	{ 69012, "Class SFXGame.SFXGameEffect_IgnorePlayerSquad" },	// 5235
+	{ 69048, "Class SFXGame.SFXGameEffect_PhysicsDamageMultiplier" },	// 5236
+	{ 69054, "Class SFXGame.SFXGameEffect_PhysicsPower" },	// 5237
+	{ 69057, "Function SFXGame.SFXGameEffect_PowerBonus.OnApplied" },	// 5238
+	{ 69058, "Function SFXGame.SFXGameEffect_PowerBonus.OnRemoved" },	// 5239
+	{ 69059, "Function SFXGame.SFXGameEffect_PowerBonus.RemoveBonuses" },	// 5240
+	{ 69060, "Function SFXGame.SFXGameEffect_PowerBonus.ApplyBonus" },	// 5241
+	{ 69068, "Function SFXGame.sfxgameeffect_powercombo.OnApplied" },	// 5242
+	{ 69072, "Function SFXGame.sfxgameeffect_powercombo.OnRemoved" },	// 5243
+	{ 69073, "Function SFXGame.sfxgameeffect_powercombo.CalculatePowerRatio" },	// 5244
+	{ 69077, "Function SFXGame.sfxgameeffect_powercombo.OnPowerComboDetonated" },	// 5245
+	{ 69100, "Function SFXGame.sfxgameeffect_powercombo.GetDamage" },	// 5246
+	{ 69104, "Function SFXGame.sfxgameeffect_powercombo.GetForce" },	// 5247
+	{ 69108, "Function SFXGame.sfxgameeffect_powercombo.OnImpact" },	// 5248
+	{ 69117, "Function SFXGame.sfxpowercustomaction.GetPowerComboTypeUniqueIDFromClass" },	// 5249
+	{ 69119, "Function SFXGame.sfxgameeffect_powercombo.ClientDoPowerComboImpact" },	// 5250
+	{ 69125, "Class SFXGame.SFXRumble_Power" },	// 5251
+	{ 69126, "Class SFXGame.SFXShake_Power" },	// 5252
+	{ 69128, "Class SFXGame.SFXGameEffect_ShieldBonus" },	// 5253
+	{ 69146, "Class SFXGame.SFXGameEffect_ShieldRegenBonus" },	// 5254
+	{ 69155, "Class SFXGame.SFXGameEffect_TimeDilation" },	// 5255
+	{ 69168, "Class SFXGame.SFXGameEffect_UniqueArmor_Base" },	// 5256
+	{ 69178, "Class SFXGame.SFXGameEffect_WeaponDamageBonus" },	// 5257
+	{ 69180, "Class SFXGame.SFXGameEffect_WeldPhysics" },	// 5258
+	{ 69302, "Class SFXGame.SFXSeqEvt_LeaveWorld" },	// 5259
+	{ 70365, "Class SFXGame.SFXGameViewportClient" },	// 5260
+	{ 70455, "Class SFXGame.SFXLocalPlayer" },	// 5261
+	{ 70769, "Class SFXGame.SFXGAWReinforcementManagerBase" },	// 5262
+	{ 70818, "Class SFXGame.SFXMarkerModuleManager" },	// 5263
+	{ 70869, "Class SFXGame.sfxwavecoordinator" },	// 5264
+	{ 70913, "Class SFXGame.sfxgui_accomplishments" },	// 5265
+	{ 71075, "Function SFXGame.SFXWeapon.SubscribeToImpactNotifications" },	// 5266
+	{ 71078, "Function SFXGame.SFXWeapon.UnsubscribeFromImpactNotifications" },	// 5267
+	{ 71104, "Function SFXGame.SFXWeapon.GetWeaponFireType" },	// 5268
+	{ 71107, "Function SFXGame.SFXWeapon.GetTraceRange" },	// 5269
+	{ 71135, "Class SFXGame.SFXPlayerInventoryManager" },	// 5270
+	{ 71210, "Class SFXGame.SFXGUI_GalaxyAtWar" },	// 5271
+	{ 71886, "Class SFXGame.SFXGUI_MainMenu_RTT_RC_B" },	// 5272
+	{ 72161, "Class SFXGame.SFXGUI_Option_VOLanguage" },	// 5273
+	{ 72244, "Class SFXGame.SFXGUI_SquadRecord" },	// 5274
+	{ 72659, "Class SFXGame.SFXGUI_PCSquadRecord" },	// 5275
+	{ 72736, "Function SFXGame.SFXWeaponMod.GetMaxRank" },	// 5276
+	{ 72748, "Function SFXGame.SFXWeaponMod.GetModDescription" },	// 5277
+	{ 72757, "Function SFXGame.SFXWeaponMod.Upgrade" },	// 5278
+	{ 72768, "Function SFXGame.SFXWeaponMod.ApplyEffects" },	// 5279
+	{ 72770, "Function SFXGame.SFXWeaponMod.RemoveEffects" },	// 5280
+	{ 72771, "Function SFXGame.SFXWeaponMod.OnVisibilityChanged" },	// 5281
+	{ 72773, "Function SFXGame.SFXWeaponMod.GetGameEffectDisplayValue" },	// 5282
+	{ 72777, "Function SFXGame.SFXWeaponMod.GetGameEffectClass" },	// 5283
+	{ 73423, "Class SFXGame.SFXGUI_PCStore" },	// 5284
+	{ 73427, "Class SFXGame.sfxgui_playercountdown" },	// 5285
+	{ 73857, "Class SFXGame.SFXGUI_TeamSelect" },	// 5286
+	{ 74062, "Class SFXGame.SFXGUIData_TeamSelect" },	// 5287
+	{ 74330, "Class SFXGame.SFXGUI_WarAssets" },	// 5288
+	{ 74424, "Class SFXGame.SFXGUI_WeaponReticleSimple" },	// 5289
+	{ 74440, "Class SFXGame.SFXGUI_WeaponReticleSimpleAlpha" },	// 5290
+	{ 74464, "Function SFXGame.sfxgui_weaponselection.OnStart" },	// 5291
+	{ 74465, "Function SFXGame.sfxgui_weaponselection.DisplayNoEngineMessage" },	// 5292
+	{ 74467, "Function SFXGame.sfxgui_weaponselection.Launch" },	// 5293
+	{ 74468, "Function SFXGame.sfxgui_weaponselection.OnClose" },	// 5294
+	{ 74469, "Function SFXGame.sfxgui_weaponselection.CleanupUIWorld" },	// 5295
+	{ 74473, "Function SFXGame.sfxgui_weaponselection.IsMultiPlayerCharacter" },	// 5296
+	{ 74485, "Function SFXGame.sfxgui_weaponselection.MakeLoadoutsActive" },	// 5297
+	{ 74486, "Function SFXGame.sfxgui_weaponselection.GetBioPawn" },	// 5298
+	{ 74488, "Function SFXGame.sfxgui_weaponselection.AS_SetLoading" },	// 5299
+	{ 74491, "Function SFXGame.sfxgui_weaponselection.InitializeTeamSelectOverlay" },	// 5300
+	{ 74492, "Function SFXGame.sfxgui_weaponselection.UpdateHenchmenDisplay" },	// 5301
+	{ 74493, "Function SFXGame.sfxgui_weaponselection.SetupUIWorld" },	// 5302
+	{ 74494, "Function SFXGame.sfxgui_weaponselection.PreLoadData" },	// 5303
+	{ 74498, "Function SFXGame.sfxgui_weaponselection.AS_TeamSetVisible" },	// 5304
+	{ 74499, "Function SFXGame.sfxgui_weaponselection.OnWeaponUIDataLoaded" },	// 5305
+	{ 74500, "Function SFXGame.sfxgui_weaponselection.BuildWeaponLoadout" },	// 5306
+	{ 74501, "Function SFXGame.sfxgui_weaponselection.AS_SelectWeaponSlot" },	// 5307
+	{ 74502, "Function SFXGame.sfxgui_weaponselection.WeaponTypeToSlotIndex" },	// 5308
+	{ 74503, "Function SFXGame.sfxgui_weaponselection.SetCurrentPawnID" },	// 5309
+	{ 74505, "Function SFXGame.sfxgui_weaponselection.RefreshLoadoutWeaponDisplay" },	// 5310
+	{ 74512, "Function SFXGame.sfxgui_weaponselection.AS_SetCurrentNameText" },	// 5311
+	{ 74513, "Function SFXGame.sfxgui_weaponselection.AS_TeamSetHenchman" },	// 5312
+	{ 74517, "Function SFXGame.sfxgui_weaponselection.ApplyPlayerPawnCustomization" },	// 5313
+	{ 74557, "Function SFXGame.sfxgui_weaponselection.CanPawnUseWeaponGroup" },	// 5314
+	{ 74558, "Function SFXGame.sfxgui_weaponselection.AS_SetWeaponSlot" },	// 5315
+	{ 74559, "Function SFXGame.sfxgui_weaponselection.UpdateWeaponEncumbranceDisplay" },	// 5316
+	{ 74574, "Function SFXGame.sfxgui_weaponselection.GetCurrentHenchTag" },	// 5317
+	{ 74577, "Function SFXGame.sfxgui_weaponselection.CurrentPawnHasWeapon" },	// 5318
+	{ 74579, "Function SFXGame.sfxgui_weaponselection.CountCurrentPawnWeapons" },	// 5319
+	{ 74583, "Function SFXGame.sfxgui_weaponselection.Exit" },	// 5320
+	{ 74585, "Function SFXGame.sfxgui_weaponselection.ShowMinimumRequiredWeaponsMessage" },	// 5321
+	{ 74586, "Function SFXGame.sfxgui_weaponselection.ApplyWeaponLoadout" },	// 5322
+	{ 74587, "Function SFXGame.sfxgui_weaponselection.RestorePowerBonuses" },	// 5323
+	{ 74610, "Function SFXGame.SFXTelemetry.GenerateUniqueClassIdFromString" },	// 5324
+	{ 74619, "Class SFXGame.SFXPowerCustomAction_AmmoPowerBase" },	// 5325
+	{ 74628, "Function SFXGame.sfxgui_weaponselection.SetWeaponStatsDisplay" },	// 5326
+	{ 74636, "Function SFXGame.sfxgui_weaponselection.AS_ClearWeaponStatsDisplay" },	// 5327
+	{ 74638, "Function SFXGame.sfxgui_weaponselection.AS_AddWeaponStat" },	// 5328
+	{ 74640, "Function SFXGame.sfxgui_weaponselection.SetWeaponModsDisplay" },	// 5329
+	{ 74648, "Function SFXGame.sfxgui_weaponselection.AS_SetModDisplay" },	// 5330
+	{ 74650, "Function SFXGame.sfxgui_weaponselection.SetWeaponInfoDisplay" },	// 5331
+	{ 74655, "Function SFXGame.sfxgui_weaponselection.AS_SetWeaponInfoDisplay" },	// 5332
+	{ 74656, "Function SFXGame.sfxgui_weaponselection.MainMovieLoaded" },	// 5333
+	{ 74657, "Function SFXGame.sfxgui_weaponselection.SwitchToWeaponSelection" },	// 5334
+	{ 74660, "Function SFXGame.sfxgui_weaponselection.DisplayCurrentWeaponSelection" },	// 5335
+	{ 74665, "Function SFXGame.sfxgui_weaponselection.AS_SetInventoryWeapon" },	// 5336
+	{ 74667, "Function SFXGame.sfxgui_weaponselection.AS_SetSlotNewIcon" },	// 5337
+	{ 74668, "Function SFXGame.sfxgui_weaponselection.SelectNextWeapon" },	// 5338
+	{ 74670, "Function SFXGame.sfxgui_weaponselection.WeaponSelectionItemChanged" },	// 5339
+	{ 74671, "Function SFXGame.sfxgui_weaponselection.SelectPrevWeapon" },	// 5340
+	{ 74673, "Function SFXGame.sfxgui_weaponselection.UndoWeaponSelection" },	// 5341
+	{ 74674, "Function SFXGame.sfxgui_weaponselection.SwitchToWeaponLoadout" },	// 5342
+	{ 74676, "Function SFXGame.sfxgui_weaponselection.WeaponLoadoutItemChanged" },	// 5343
+	{ 74679, "Function SFXGame.sfxgui_weaponselection.UpdateCurrentLoadoutWeaponDisplay" },	// 5344
+	{ 74680, "Function SFXGame.sfxgui_weaponselection.SelectPreviousHenchman" },	// 5345
+	{ 74682, "Function SFXGame.sfxgui_weaponselection.SelectNextHenchman" },	// 5346
+	{ 74706, "Function SFXGame.sfxgui_weaponselection.AS_SetWeightDisplay" },	// 5347
+	{ 74708, "Function SFXGame.sfxgui_weaponselection.CheckCanSelectWeapon" },	// 5348
+	{ 74711, "Function SFXGame.sfxgui_weaponselection.CheckCanEquipWeapon" },	// 5349
+	{ 74716, "Function SFXGame.sfxgui_weaponselection.PromptPlayerToDiscardMPWeapon" },	// 5350
+	{ 74726, "Function SFXGame.sfxgui_weaponselection.PlayerDiscardWeaponCallback" },	// 5351
+	{ 74730, "Function SFXGame.sfxgui_weaponselection.AS_PerformPlayerWeaponAction" },	// 5352
+	{ 74731, "Function SFXGame.sfxgui_weaponselection.HandleInputEvent" },	// 5353
+	{ 74735, "Function SFXGame.sfxgui_weaponselection.AS_ScrollInfoText" },	// 5354
+	{ 74736, "Function SFXGame.sfxgui_weaponselection.AS_SetVisible" },	// 5355
+	{ 74765, "Function SFXGame.sfxgui_weaponselection.AS_SetWeaponAction" },	// 5356
+	{ 74815, "Class SFXGame.SFXGUIData_TerminalNoSquadSel" },	// 5357
+	{ 74817, "Class SFXGame.sfxguiext_weaponmods" },	// 5358
+	{ 75235, "Class SFXGame.SFXModule_MarkerGrenade" },	// 5359
+	{ 75262, "Class SFXGame.SFXGUIValue_MarkerObjectiveSP" },	// 5360
+	{ 75265, "Class SFXGame.SFXModule_MarkerObjectiveSP" },	// 5361
+	{ 75362, "Function SFXGame.SFXWeapon.OnWeaponImpact" },	// 5362
+	{ 75365, "Function SFXGame.SFXWeapon.OnWeaponReload" },	// 5363
+	{ 75367, "Function SFXGame.SFXWeapon.OnWeaponEquip" },	// 5364
+	{ 75369, "Function SFXGame.SFXWeapon.OnWeaponUnequip" },	// 5365
+	{ 75371, "Function SFXGame.SFXWeapon.ReplicatedEvent" },	// 5366
+	{ 75374, "Function SFXGame.SFXWeapon.CharacterSlotUpdated" },	// 5367
+	{ 75376, "Function SFXGame.SFXWeapon.FireModeUpdated" },	// 5368
+	{ 75379, "Function SFXGame.SFXWeapon.PostBeginPlay" },	// 5369
+	{ 75380, "Function SFXGame.SFXWeapon.DeferredPostBeginPlay" },	// 5370
+	{ 75381, "Function SFXGame.SFXWeapon.InitializeWeapon" },	// 5371
+	{ 75392, "Function SFXGame.SFXWeapon.PostInitAnimTree" },	// 5372
+	{ 75394, "Function SFXGame.SFXWeapon.CacheAnimNodes" },	// 5373
+	{ 75398, "Function SFXGame.SFXWeapon.ScaleWeapon" },	// 5374
+	{ 75413, "Function SFXGame.SFXWeapon.InitDefaultDecalProperties" },	// 5375
+	{ 75416, "Function SFXGame.SFXWeapon.ForceEndFire" },	// 5376
+	{ 75417, "Function SFXGame.SFXWeapon.ClearFizzleCount" },	// 5377
+	{ 75418, "Function SFXGame.SFXWeapon.ProjectileFire" },	// 5378
+	{ 75423, "Function SFXGame.SFXWeapon.ServerProjectileFire" },	// 5379
+	{ 75427, "Function SFXGame.SFXWeapon.Internal_ProjectileFire" },	// 5380
+	{ 75435, "Function SFXGame.SFXProjectile.SetPrediction" },	// 5381
+	{ 75438, "Function SFXGame.SFXWeapon.OnClientProjectileSpawned" },	// 5382
+	{ 75442, "Function SFXGame.SFXProjectile.IsShuttingDown" },	// 5383
+	{ 75444, "Function SFXGame.SFXProjectile.SetPredictionTarget" },	// 5384
+	{ 75445, "Function SFXGame.SFXWeapon.GetPhysicalFireStartLoc" },	// 5385
+	{ 75448, "Function SFXGame.SFXWeapon.GetProjectileFirePosition" },	// 5386
+	{ 75454, "Function SFXGame.SFXWeapon.UseFirstPersonCamera" },	// 5387
+	{ 75456, "Function SFXGame.SFXWeapon.NotifyUnpossessed" },	// 5388
+	{ 75458, "Function SFXGame.SFXWeapon.CalculateBonus" },	// 5389
+	{ 75465, "Function SFXGame.SFXWeapon.GetCurrentTotalAmmo" },	// 5390
+	{ 75468, "Function SFXGame.SFXWeapon.GetMaxTotalAmmo" },	// 5391
+	{ 75470, "Function SFXGame.SFXWeapon.ResetAmmoOnHolster" },	// 5392
+	{ 75471, "Function SFXGame.SFXWeapon.GetWeaponRecoil" },	// 5393
+	{ 75481, "Function SFXGame.SFXWeapon.GetAdjustedAim" },	// 5394
+	{ 75487, "Function SFXGame.SFXWeapon.GetPlayerAimError" },	// 5395
+	{ 75491, "Function SFXGame.SFXWeapon.SetZoomed" },	// 5396
+	{ 75501, "Function SFXGame.SFXWeapon.SetRTPCPlayerPosition" },	// 5397
+	{ 75505, "Function SFXGame.SFXWeapon.ServerSetIsZoomed" },	// 5398
+	{ 75507, "Function SFXGame.SFXWeapon.SetWeaponRecoil" },	// 5399
+	{ 75510, "Function SFXGame.SFXWeapon.GetMuzzleLoc" },	// 5400
+	{ 75521, "Function SFXGame.SFXWeapon.GetModifiedFOV" },	// 5401
+	{ 75524, "Function SFXGame.SFXWeapon.InitializeAmmo" },	// 5402
+	{ 75525, "Function SFXGame.SFXWeapon.ConsumeAmmo" },	// 5403
+	{ 75535, "Function SFXGame.SFXTelemetry.SendString" },	// 5404
+	{ 75536, "Function SFXGame.SFXTelemetry.GenerateUniqueClassId" },	// 5405
+	{ 75540, "Function SFXGame.SFXWeapon.HasSpareAmmo" },	// 5406
+	{ 75545, "Function SFXGame.SFXWeapon.GetFireInterval" },	// 5407
+	{ 75548, "Function SFXGame.SFXWeapon.GetLazyFireInterval" },	// 5408
+	{ 75552, "Function SFXGame.SFXWeapon.InstantFire" },	// 5409
+	{ 75560, "Function SFXGame.SFXWeapon.CalcWeaponFire" },	// 5410
+	{ 75572, "Function SFXGame.SFXWeapon.ProcessInstantHit" },	// 5411
+	{ 75581, "Function SFXGame.SFXWeapon.ServerProcessInstantHit" },	// 5412
+	{ 75603, "Function SFXGame.SFXWeapon.ProcessInstantHitNearMiss" },	// 5413
+	{ 75611, "Function SFXGame.SFXWeapon.ProcessInstantHit_Internal" },	// 5414
+	{ 75623, "Function SFXGame.SFXWeapon.ClientDoImpact" },	// 5415
+	{ 75625, "Function SFXGame.SFXWeapon.ReplicateImpact" },	// 5416
+	{ 75630, "Function SFXGame.SFXWeapon.SpawnImpactEffects" },	// 5417
+	{ 75638, "Function SFXGame.SFXWeapon.GetImpactEffect" },	// 5418
+	{ 75643, "Function SFXGame.SFXWeapon.GetWeaponSpecificImpactEffect" },	// 5419
+	{ 75646, "Class SFXGame.SFXPhysicalMaterialImpactEffects" },	// 5420
+	{ 75647, "Function SFXGame.SFXWeapon.SpawnImpactSounds" },	// 5421
+	{ 75652, "Function SFXGame.SFXWeapon.GetImpactSound" },	// 5422
+	{ 75657, "Function SFXGame.SFXWeapon.GetWeaponSpecificImpactSound" },	// 5423
+	{ 75660, "Class SFXGame.SFXPhysicalMaterialImpactSounds" },	// 5424
+	{ 75661, "Function SFXGame.SFXWeapon.SpawnADecal" },	// 5425
+	{ 75667, "Function SFXGame.SFXWeapon.GetDecalData" },	// 5426
+	{ 75673, "Function SFXGame.SFXWeapon.GetWeaponSpecificDecalData" },	// 5427
+	{ 75677, "Class SFXGame.SFXPhysicalMaterialDecals" },	// 5428
+	{ 75678, "Function SFXGame.SFXWeapon.PrecacheVFX" },	// 5429
+	{ 75688, "Function SFXGame.SFXWeapon.PlayFireEffectsOnce" },	// 5430
+	{ 75691, "Function SFXGame.SFXWeapon.CheckTimerFireOnce" },	// 5431
+	{ 75692, "Function SFXGame.SFXWeapon.DummyFireNumTimes" },	// 5432
+	{ 75699, "Function SFXGame.SFXWeapon.DummyFireTimerFunction" },	// 5433
+	{ 75704, "Function SFXGame.SFXWeapon.PlayFireEffects" },	// 5434
+	{ 75710, "Function SFXGame.SFXWeapon.PlayMuzzleFlashEffect" },	// 5435
+	{ 75714, "Function SFXGame.SFXWeapon.IsMuzzleFlashRelevant" },	// 5436
+	{ 75716, "Function SFXGame.SFXWeapon.IsCameraWithinRadius" },	// 5437
+	{ 75723, "Function SFXGame.SFXWeapon.StopMuzzleFlashEffect" },	// 5438
+	{ 75727, "Function SFXGame.SFXWeapon.HideMuzzleFlashEmitter" },	// 5439
+	{ 75728, "Function SFXGame.SFXWeapon.HideReloadEmitters" },	// 5440
+	{ 75730, "Function SFXGame.SFXWeapon.PlayOwnedFireEffects" },	// 5441
+	{ 75737, "Function SFXGame.SFXWeapon.ShouldSpawnTracerFX" },	// 5442
+	{ 75739, "Function SFXGame.SFXWeapon.SpawnTracerEffect" },	// 5443
+	{ 75743, "Function SFXGame.SFXWeapon.WeaponPlayWwiseEvent" },	// 5444
+	{ 75749, "Function SFXGame.SFXWeapon.HearNoiseTimer" },	// 5445
+	{ 75750, "Function SFXGame.SFXWeapon.StopFireEffects" },	// 5446
+	{ 75753, "Function SFXGame.SFXWeapon.PlayReloadEject" },	// 5447
+	{ 75756, "Function SFXGame.SFXWeapon.EffectIsRelevant" },	// 5448
+	{ 75763, "Function SFXGame.SFXWeapon.ShouldAutoReload" },	// 5449
+	{ 75765, "Function SFXGame.SFXWeapon.GetAmmoRestoredPerReload" },	// 5450
+	{ 75767, "Function SFXGame.SFXWeapon.DoReload" },	// 5451
+	{ 75771, "Function SFXGame.SFXWeapon.TryReload" },	// 5452
+	{ 75774, "Function SFXGame.SFXWeapon.PlayNoAmmoEffects" },	// 5453
+	{ 75788, "Function SFXGame.SFXWeapon.AttachFlashlight" },	// 5454
+	{ 75802, "Function SFXGame.SFXWeapon.IncrementFizzleCount" },	// 5455
+	{ 75806, "Function SFXGame.SFXWeapon.PlayNoAmmoFireSound" },	// 5456
+	{ 75811, "Function SFXGame.SFXWeapon.DetachFlashlight" },	// 5457
+	{ 75812, "Function SFXGame.SFXWeapon.ServerFireChargedShot" },	// 5458
+	{ 75817, "Function SFXGame.SFXWeapon.IsChargingWeapon" },	// 5459
+	{ 75913, "Function SFXGame.SFXWeapon.StartChargeEffects" },	// 5460
+	{ 75920, "Function SFXGame.SFXWeapon.StartFullChargeRumble" },	// 5461
+	{ 75931, "Function SFXGame.SFXWeapon.EndFire" },	// 5462
+	{ 75940, "Function SFXGame.SFXWeapon.NotifyWeaponFired" },	// 5463
+	{ 75944, "Function SFXGame.SFXWeapon.CanFire" },	// 5464
+	{ 75958, "Function SFXGame.SFXWeapon.StartFire" },	// 5465
+	{ 75960, "Function SFXGame.SFXWeapon.SelectTarget" },	// 5466
+	{ 75963, "Function SFXGame.SFXWeapon.ServerStopFire" },	// 5467
+	{ 75965, "Function SFXGame.SFXWeapon.SetupWeaponFire" },	// 5468
+	{ 75967, "Function SFXGame.SFXWeapon.GetBurstFireCount" },	// 5469
+	{ 75972, "Function SFXGame.SFXWeapon.ShouldRefire" },	// 5470
+	{ 75975, "Function SFXGame.SFXWeapon.HandleFinishedFiring" },	// 5471
+	{ 75978, "Function SFXGame.SFXWeapon.NotifyWeaponRefireDelayExpired" },	// 5472
+	{ 75979, "Function SFXGame.SFXWeapon.ReloadNearFinished" },	// 5473
+	{ 75980, "Function SFXGame.SFXWeapon.DoAReload" },	// 5474
+	{ 75981, "Function SFXGame.SFXWeapon.CancelReload" },	// 5475
+	{ 75982, "Function SFXGame.SFXWeapon.ServerCancelReload" },	// 5476
+	{ 76004, "Function SFXGame.SFXWeapon.UnEquipFinished" },	// 5477
+	{ 76005, "Function SFXGame.SFXWeapon.UnEquipTimedOut" },	// 5478
+	{ 76018, "Function SFXGame.SFXWeapon.ShutOffAllEmitters" },	// 5479
+	{ 76022, "Function SFXGame.SFXWeapon.StopChargeEffects" },	// 5480
+	{ 76026, "Function SFXGame.SFXWeapon.Expand" },	// 5481
+	{ 76027, "Function SFXGame.SFXWeapon.Collapse" },	// 5482
+	{ 76028, "Function SFXGame.SFXWeapon.EquipNearFinished" },	// 5483
+	{ 76029, "Function SFXGame.SFXWeapon.EquipFinished" },	// 5484
+	{ 76030, "Function SFXGame.SFXWeapon.EquipTimedOut" },	// 5485
+	{ 76047, "Function SFXGame.SFXWeapon.GivenTo" },	// 5486
+	{ 76053, "Function SFXGame.SFXWeapon.AssignToSlot" },	// 5487
+	{ 76055, "Function SFXGame.SFXWeapon.Internal_AssignToSlot" },	// 5488
+	{ 76057, "Function SFXGame.SFXWeapon.AttachWeaponTo" },	// 5489
+	{ 76064, "Function SFXGame.SFXWeapon.AttachMuzzleEffectsComponents" },	// 5490
+	{ 76068, "Function SFXGame.SFXWeapon.DetachWeapon" },	// 5491
+	{ 76070, "Function SFXGame.SFXWeapon.CanThrow" },	// 5492
+	{ 76072, "Function SFXGame.SFXWeapon.ClientWeaponThrown" },	// 5493
+	{ 76074, "Function SFXGame.SFXWeapon.DropFrom" },	// 5494
+	{ 76087, "Function SFXGame.SFXWeapon.HolderDied" },	// 5495
+	{ 76088, "Function SFXGame.SFXWeapon.Destroyed" },	// 5496
+	{ 76089, "Function SFXGame.SFXWeapon.SetAmmoPowerHologramTemplates" },	// 5497
+	{ 76092, "Function SFXGame.SFXWeapon.SetAmmoPowerHologramEnabled" },	// 5498
+	{ 76096, "Function SFXGame.SFXWeapon.DrawDebugShot" },	// 5499
+	{ 76099, "Function SFXGame.SFXWeapon.GetWeaponDebug" },	// 5500
+	{ 76104, "Function SFXGame.SFXWeapon.GetShortDescription" },	// 5501
+	{ 76106, "Function SFXGame.SFXWeapon.GetGeneralDescription" },	// 5502
+	{ 76108, "Function SFXGame.SFXWeapon.CalculateCoverLeanOutOffset" },	// 5503
+	{ 76115, "Function SFXGame.SFXWeapon.CalcRemoteImpactEffects" },	// 5504
+	{ 76124, "Function SFXGame.SFXWeapon.ProjectileFireSimple" },	// 5505
+	{ 76132, "Function SFXGame.SFXWeapon.WeaponFired" },	// 5506
+	{ 76136, "Function SFXGame.SFXWeapon.BeginDummyFire" },	// 5507
+	{ 76139, "Function SFXGame.SFXWeapon.GetInitialDummyFireDelay" },	// 5508
+	{ 76141, "Function SFXGame.SFXWeapon.DummyFire" },	// 5509
+	{ 76158, "Function SFXGame.SFXWeapon.WeaponStoppedFiring" },	// 5510
+	{ 76160, "Function SFXGame.SFXWeapon.CleanUpDummyFire" },	// 5511
+	{ 76161, "Function SFXGame.SFXWeapon.ClientWeaponSet" },	// 5512
+	{ 76164, "Function SFXGame.SFXWeapon.GetReactionChanceModifier" },	// 5513
+	{ 76166, "Function SFXGame.SFXWeapon.IsAnimTypeShotgun" },	// 5514
+	{ 76168, "Function SFXGame.SFXWeapon.IsAnimTypeSniper" },	// 5515
+	{ 76189, "Function SFXGame.SFXWeapon.IsWeaponUnlocked" },	// 5516
+	{ 76193, "Function SFXGame.SFXWeapon.IsWeaponAlreadyAwarded" },	// 5517
+	{ 76214, "Function SFXGame.SFXWeapon.SetFlashlightFireMode" },	// 5518
+	{ 76223, "Function SFXGame.SFXWeapon.DelayedRestoreFlashlightToNormal" },	// 5519
+	{ 76225, "Function SFXGame.SFXWeapon.RestoreFlashlightToNormal" },	// 5520
+	{ 76229, "Function SFXGame.SFXWeapon.ClearWeaponModMaterialParameters" },	// 5521
+	{ 76231, "Function SFXGame.SFXWeapon.SetWeaponModEmissiveValue" },	// 5522
+	{ 76237, "Function SFXGame.SFXWeapon.SetWeaponModGripColour" },	// 5523
+	{ 76243, "Function SFXGame.SFXWeapon.SetWeaponModBodyColour" },	// 5524
+	{ 76249, "Function SFXGame.SFXWeapon.ApplyDefaultWeaponMods" },	// 5525
+	{ 76269, "Function SFXGame.SFXWeapon.SetFlashLocation" },	// 5526
+	{ 76271, "Function SFXGame.SFXWeapon.ClearFlashLocation" },	// 5527
+	{ 76272, "Function SFXGame.SFXWeapon.HasLoopingFire" },	// 5528
+	{ 76274, "Function SFXGame.SFXWeapon.GetWeaponStatBarValues" },	// 5529
+	{ 76280, "Function SFXGame.SFXWeapon.GetStoreQualification" },	// 5530
+	{ 76282, "Function SFXGame.SFXWeapon.FindWeaponClass" },	// 5531
+	{ 76288, "Function SFXGame.SFXWeapon.GetPenetrationDepth" },	// 5532
+	{ 76292, "Function SFXGame.SFXWeapon.IsClientReadyToInitialize" },	// 5533
+	{ 76294, "Function SFXGame.SFXWeapon.GiveWeaponCodex" },	// 5534
+	{ 76410, "Class SFXGame.sfxwave" },	// 5535
+	{ 76670, "Class SFXGame.SFXInterpTrackSetEnvEffectIntensity" },	// 5536
+	{ 76752, "Class SFXGame.SFXTreasureUseModule" },	// 5537
+	{ 77265, "Class SFXGame.SFXMiningNode" },	// 5538
+	{ 77832, "Class SFXGame.SFXMutator_DifficultySpeed" },	// 5539
+	{ 77841, "Class SFXGame.SFXNav_WayPoint" },	// 5540
+	{ 77848, "Class SFXGame.SFXNav_ActionStationWP" },	// 5541
+	{ 77902, "Class SFXGame.SFXNav_KaiLengShield" },	// 5542
+	{ 77941, "Class SFXGame.SFXNav_PlayAnimWP" },	// 5543
+	{ 77950, "Class SFXGame.SFXNav_TurretPoint" },	// 5544
+	{ 77989, "Class SFXGame.SFXOperation_ObjectiveSpawnPoint" },	// 5545
+	{ 78000, "Class SFXGame.SFXOperation_ObjectiveData" },	// 5546
+	{ 78095, "Function SFXGame.SFXProjectile.Reuse" },	// 5547
+	{ 80387, "Class SFXGame.SFXPowerCustomAction_ParagonRenegade" },	// 5548
+	{ 81862, "Function SFXGame.sfxpowercustomaction.GetUsedAnimNames" },	// 5549
+	{ 81868, "Function SFXGame.sfxpowercustomaction.InternalCanDoCustomAction" },	// 5550
+	{ 81880, "Function SFXGame.sfxpowercustomaction.LoadAnimSet" },	// 5551
+	{ 81884, "Function SFXGame.sfxpowercustomaction.GetCurrentBodyStance" },	// 5552
+	{ 81887, "Function SFXGame.sfxpowercustomaction.ChangeCoverAction" },	// 5553
+	{ 81892, "Function SFXGame.sfxpowercustomaction.StartCustomAction" },	// 5554
+	{ 81904, "Function SFXGame.sfxpowercustomaction.StartPower" },	// 5555
+	{ 81911, "Function SFXGame.sfxpowercustomaction.StartCastAnimations" },	// 5556
+	{ 81917, "Function SFXGame.sfxpowercustomaction.PlayBodyStance" },	// 5557
+	{ 81925, "Function SFXGame.sfxpowercustomaction.EndThisCustomAction" },	// 5558
+	{ 81926, "Function SFXGame.sfxpowercustomaction.StopCustomAction" },	// 5559
+	{ 81932, "Function SFXGame.sfxpowercustomaction.BodyStanceAnimEndNotification" },	// 5560
+	{ 81938, "Function SFXGame.sfxpowercustomaction.TickCustomAction" },	// 5561
+	{ 81943, "Function SFXGame.sfxpowercustomaction.GetPowerCooldown" },	// 5562
+	{ 81945, "Function SFXGame.sfxpowercustomaction.StartPowerCooldown" },	// 5563
+	{ 81948, "Function SFXGame.sfxpowercustomaction.ResetPowerCooldown" },	// 5564
+	{ 81949, "Function SFXGame.sfxpowercustomaction.ReleasePower" },	// 5565
+	{ 81956, "Function SFXGame.sfxpowercustomaction.ReleaseProjectilePower" },	// 5566
+	{ 81971, "Function SFXGame.sfxpowercustomaction.OnClientPowerProjectileSpawned" },	// 5567
+	{ 81974, "Function SFXGame.sfxpowercustomaction.ReleaseInstantPower" },	// 5568
+	{ 81979, "Function SFXGame.sfxpowercustomaction.ReleaseMeleePower" },	// 5569
+	{ 81980, "Function SFXGame.sfxpowercustomaction.ReleaseBuffPower" },	// 5570
+	{ 81986, "Function SFXGame.sfxpowercustomaction.OnPowerDetonated" },	// 5571
+	{ 81999, "Function SFXGame.sfxpowercustomaction.DetonationHitsTarget" },	// 5572
+	{ 82002, "Function SFXGame.sfxpowercustomaction.DoPowerDetonatedForActor" },	// 5573
+	{ 82019, "Class SFXGame.SFXProjectile_PowerCustomAction_Grenade" },	// 5574
+	{ 82021, "Function SFXGame.sfxpowercustomaction.CheckForPowerCombo" },	// 5575
+	{ 82022, "Function SFXGame.sfxpowercustomaction.ClientDoCustomActionImpact" },	// 5576
+	{ 82035, "Function SFXGame.sfxpowercustomaction.ClientDoPowerSubsequentImpact" },	// 5577
+	{ 82042, "Function SFXGame.sfxpowercustomaction.AreaExplosion" },	// 5578
+	{ 82073, "Function SFXGame.sfxpowercustomaction.GetImpactDamage" },	// 5579
+	{ 82078, "Function SFXGame.sfxpowercustomaction.GetNonRagdollDamageType" },	// 5580
+	{ 82081, "Function SFXGame.sfxpowercustomaction.GetImpactForce" },	// 5581
+	{ 82084, "Function SFXGame.sfxpowercustomaction.OnImpact" },	// 5582
+	{ 82091, "Function SFXGame.sfxpowercustomaction.PlayReleaseEffects" },	// 5583
+	{ 82095, "Function SFXGame.sfxpowercustomaction.PlayDetonationEffects" },	// 5584
+	{ 82107, "Function SFXGame.sfxpowercustomaction.PlayCasterSounds" },	// 5585
+	{ 82113, "Function SFXGame.sfxpowercustomaction.PlayImpactSounds" },	// 5586
+	{ 82120, "Function SFXGame.sfxpowercustomaction.PlayImpactEffects" },	// 5587
+	{ 82126, "Function SFXGame.sfxpowercustomaction.ApplyBonus" },	// 5588
+	{ 82130, "Function SFXGame.sfxpowercustomaction.ApplyBonusToParameter" },	// 5589
+	{ 82152, "Function SFXGame.sfxpowercustomaction.AddActorToImpactedList" },	// 5590
+	{ 82163, "Function SFXGame.sfxpowercustomaction.CanImpactActor" },	// 5591
+	{ 82166, "Function SFXGame.sfxpowercustomaction.RagdollPhysicsImpact" },	// 5592
+	{ 82180, "Function SFXGame.sfxpowercustomaction.ShouldUsePowerOnShields" },	// 5593
+	{ 82188, "Function SFXGame.sfxpowercustomaction.IsMachineRace" },	// 5594
+	{ 82192, "Function SFXGame.sfxpowercustomaction.GetPhysicsLevel" },	// 5595
+	{ 82198, "Function SFXGame.sfxpowercustomaction.GetPhysicsLevelResistance" },	// 5596
+	{ 82203, "Function SFXGame.sfxpowercustomaction.ImpactPlaceable" },	// 5597
+	{ 82215, "Function SFXGame.sfxpowercustomaction.CanBeRagdolledByPowers" },	// 5598
+	{ 82218, "Function SFXGame.sfxpowercustomaction.IsOfRace" },	// 5599
+	{ 82231, "Function SFXGame.sfxpowercustomaction.ApplyPermanentGameEffect" },	// 5600
+	{ 82240, "Function SFXGame.sfxpowercustomaction.IsPlaceable" },	// 5601
+	{ 82243, "Function SFXGame.sfxpowercustomaction.HasRemainingShieldOfType" },	// 5602
+	{ 82254, "Function SFXGame.sfxpowercustomaction.ApplyHealthBonus" },	// 5603
+	{ 82262, "Function SFXGame.sfxpowercustomaction.ApplyShieldBonus" },	// 5604
+	{ 82271, "Function SFXGame.sfxpowercustomaction.ApplyForceToActor" },	// 5605
+	{ 82276, "Function SFXGame.sfxpowercustomaction.AddEvolvedRankBonus" },	// 5606
+	{ 82280, "Function SFXGame.sfxpowercustomaction.GetDefaultClientEffectParams" },	// 5607
+	{ 82283, "Function SFXGame.sfxpowercustomaction.PlayPowerControllerRumble" },	// 5608
+	{ 82293, "Function SFXGame.sfxpowercustomaction.PlayPowerScreenShake" },	// 5609
+	{ 82302, "Function SFXGame.sfxpowercustomaction.Replicate" },	// 5610
+	{ 82303, "Function SFXGame.sfxpowercustomaction.ClientDoCustomAction" },	// 5611
+	{ 82305, "Function SFXGame.sfxpowercustomaction.ReplicateImpact" },	// 5612
+	{ 82312, "Function SFXGame.sfxpowercustomaction.ReplicatePowerSubsequentImpact" },	// 5613
+	{ 82319, "Function SFXGame.sfxpowercustomaction.ReplicatePowerComboImpact" },	// 5614
+	{ 82325, "Function SFXGame.sfxpowercustomaction.CleanUpProjectile" },	// 5615
+	{ 82330, "Function SFXGame.sfxpowercustomaction.GetPowerAnimInfo" },	// 5616
+	{ 82335, "Function SFXGame.sfxpowercustomaction.ReplaceAnimSetWithDynamic" },	// 5617
+	{ 82337, "Function SFXGame.sfxpowercustomaction.CombatEnded" },	// 5618
+	{ 82338, "Function SFXGame.sfxpowercustomaction.PrecacheVFX" },	// 5619
+	{ 82341, "Function SFXGame.sfxpowercustomaction.AddComboEffect" },	// 5620
+	{ 82357, "Function SFXGame.sfxpowercustomaction.DoPowerCombo" },	// 5621
+	{ 82369, "Function SFXGame.sfxpowercustomaction.DelayedDoPowerCombo" },	// 5622
+	{ 82370, "Function SFXGame.sfxpowercustomaction.ReplicatePowerCombo" },	// 5623
+	{ 82375, "Function SFXGame.sfxpowercustomaction.ClientDoPowerCombo" },	// 5624
+	{ 82387, "Function SFXGame.sfxpowercustomaction.ClientDoPowerComboImpactFromEffect" },	// 5625
+	{ 82398, "Function SFXGame.sfxpowercustomaction.GetPowerComboClassFromUniqueID" },	// 5626
+	{ 82401, "Function SFXGame.sfxpowercustomaction.OnSourcePowerBioticDetonation" },	// 5627
+	{ 82402, "Function SFXGame.sfxpowercustomaction.ReplicationEncodeDelayAndResistance" },	// 5628
+	{ 82406, "Function SFXGame.sfxpowercustomaction.ReplicationDecodeDelayAndResistance" },	// 5629
+	{ 82410, "Function SFXGame.sfxpowercustomaction.RestoreSaveState" },	// 5630
+	{ 82411, "Function SFXGame.sfxpowercustomaction.GetUniquePowerPlayerVariable" },	// 5631
+	{ 82413, "Function SFXGame.sfxpowercustomaction.SetSaveGamePowerState" },	// 5632
+	{ 82415, "Function SFXGame.sfxpowercustomaction.GetSaveGamePowerState" },	// 5633
+	{ 83006, "Function SFXGame.SFXProjectile.SpawnFlightEffects" },	// 5634
+	{ 83014, "Function SFXGame.SFXProjectile.Recycle" },	// 5635
+	{ 83021, "Function SFXGame.SFXProjectile.ShutdownPostEffects" },	// 5636
+	{ 83022, "Function SFXGame.SFXProjectile.Init" },	// 5637
+	{ 83024, "Function SFXGame.SFXProjectile.SetPredictedInitialSpeed" },	// 5638
+	{ 83025, "Function SFXGame.SFXProjectile.ShutDown" },	// 5639
+	{ 83027, "Function SFXGame.SFXProjectile.FellOutOfWorld" },	// 5640
+	{ 83029, "Function SFXGame.SFXProjectile.OutsideWorldBounds" },	// 5641
+	{ 83030, "Function SFXGame.SFXProjectile.HitWall" },	// 5642
+	{ 83035, "Function SFXGame.SFXProjectile.Explode" },	// 5643
+	{ 83038, "Function SFXGame.SFXProjectile.SetProjectileHidden" },	// 5644
+	{ 83041, "Function SFXGame.SFXProjectile.ProjEffectsTrailFinished" },	// 5645
+	{ 83043, "Function SFXGame.SFXProjectile.Tick" },	// 5646
+	{ 83048, "Function SFXGame.SFXProjectile.ApplyExternalForce" },	// 5647
+	{ 83049, "Function SFXGame.SFXProjectile.ProcessTouch" },	// 5648
+	{ 83053, "Function SFXGame.SFXProjectile.Bounce" },	// 5649
+	{ 83062, "Function SFXGame.SFXProjectile.GetDamage" },	// 5650
+	{ 83065, "Function SFXGame.SFXProjectile.GetDamageRadius" },	// 5651
+	{ 83068, "Function SFXGame.SFXProjectile.GetMomentum" },	// 5652
+	{ 83072, "Function SFXGame.SFXProjectile.SpawnImpactEffect" },	// 5653
+	{ 83075, "Function SFXGame.SFXProjectile.ReplicatedEvent" },	// 5654
+	{ 83078, "Function SFXGame.SFXProjectile.ReplicateInit" },	// 5655
+	{ 83081, "Function SFXGame.SFXProjectile.ReplicateExplode" },	// 5656
+	{ 83086, "Function SFXGame.SFXProjectile.ReplicatedInitUpdated" },	// 5657
+	{ 83089, "Function SFXGame.SFXProjectile.ReplicatedExplosionUpdated" },	// 5658
+	{ 83090, "Function SFXGame.SFXProjectile.Reset" },	// 5659
+	{ 83095, "Function SFXGame.SFXProjectile.Tick_Prediction" },	// 5660
+	{ 83101, "Function SFXGame.SFXProjectile.Destroyed" },	// 5661
+	{ 83102, "Function SFXGame.SFXProjectile.IsTargettedProjectile" },	// 5662
+	{ 83104, "Function SFXGame.SFXProjectile.PrecacheVFX" },	// 5663
+	{ 83318, "Class SFXGame.SFXRumble_Explode" },	// 5664
+	{ 83404, "Function SFXGame.SFXProjectile_PowerCustomAction_Grenade.FuseDone" },	// 5665
+	{ 83408, "Function SFXGame.SFXProjectile_PowerCustomAction_Grenade.InitializePowerProjectile" },	// 5666
+	{ 83425, "Function SFXGame.SFXProjectile_PowerCustomAction_Grenade.HitWall" },	// 5667
+	{ 83429, "Function SFXGame.SFXProjectile_PowerCustomAction_Grenade.ProcessTouch" },	// 5668
+	{ 83434, "Function SFXGame.SFXProjectile_PowerCustomAction_Grenade.Tick" },	// 5669
+	{ 83438, "Function SFXGame.SFXProjectile_PowerCustomAction_Grenade.Bounce" },	// 5670
+	{ 83442, "Function SFXGame.SFXProjectile_PowerCustomAction_Grenade.Recycle" },	// 5671
+	{ 83443, "Function SFXGame.SFXProjectile_PowerCustomAction_Grenade.Explode" },	// 5672
+	{ 83715, "Class SFXGame.SFXSeqAct_3DCeberusStateChange" },	// 5673
+	{ 83719, "Class SFXGame.SFXSeqAct_AddCombatZone" },	// 5674
+	{ 83810, "Class SFXGame.SFXSeqAct_AIGoHere" },	// 5675
+	{ 83872, "Class SFXGame.SFXSeqAct_AwardEndGameAchievements" },	// 5676
+	{ 83884, "Class SFXGame.SFXSeqAct_AwardGAWAsset" },	// 5677
+	{ 83911, "Class SFXGame.SFXSeqAct_AwardGAWAsset_Silent" },	// 5678
+	{ 83920, "Class SFXGame.SFXSeqAct_AwardGAWAssetsForLevel" },	// 5679
+	{ 83945, "Class SFXGame.SFXSeqAct_AwardTreasure" },	// 5680
+	{ 83962, "Class SFXGame.SFXSeqAct_CanAffordTreasure" },	// 5681
+	{ 83970, "Class SFXGame.SFXSeqAct_ChangeBehaviour" },	// 5682
+	{ 83977, "Class SFXGame.SFXSeqAct_CharCreateCrust" },	// 5683
+	{ 83979, "Class SFXGame.SFXSeqAct_CheckResourceBudget" },	// 5684
+	{ 83981, "Class SFXGame.SFXSeqAct_ChooseLoadoutBase" },	// 5685
+	{ 84236, "Class SFXGame.SFXSeqAct_CloseGalaxyMap" },	// 5686
+	{ 84254, "Class SFXGame.SFXSeqAct_DefendActor" },	// 5687
+	{ 84326, "Class SFXGame.SFXSeqAct_FlushAsyncWork" },	// 5688
+	{ 84333, "Class SFXGame.SFXSeqAct_ForceCombatOn" },	// 5689
+	{ 84339, "Class SFXGame.SFXSeqAct_GenerateVocEvent" },	// 5690
+	{ 84354, "Class SFXGame.SFXSeqAct_GetCurrentGoal" },	// 5691
+	{ 84361, "Class SFXGame.SFXSeqAct_GetTreasureImage" },	// 5692
+	{ 84370, "Class SFXGame.SFXSeqAct_GivePlotWeapon" },	// 5693
+	{ 84456, "Class SFXGame.SFXSeqAct_InitMainMenu" },	// 5694
+	{ 84461, "Class SFXGame.SFXSeqAct_InterruptCustomAction" },	// 5695
+	{ 84497, "Class SFXGame.SFXSeqAct_LinkLighting" },	// 5696
+	{ 84510, "Class SFXGame.SFXSeqAct_LinkToSaveBool" },	// 5697
+	{ 84567, "Class SFXGame.SFXSeqAct_MainMenu" },	// 5698
+	{ 84573, "Class SFXGame.SFXSeqAct_MakeLevelLive" },	// 5699
+	{ 84616, "Class SFXGame.SFXSeqAct_RemoveCombatZone" },	// 5700
+	{ 84625, "Class SFXGame.SFXSeqAct_ResearchChoiceGUI" },	// 5701
+	{ 84826, "Class SFXGame.SFXSeqAct_SetDoorState" },	// 5702
+	{ 84844, "Class SFXGame.SFXSeqAct_SetDoorType" },	// 5703
+	{ 84851, "Class SFXGame.SFXSeqAct_SetGoalPriority" },	// 5704
+	{ 84858, "Class SFXGame.SFXSeqAct_SetPawnVocState" },	// 5705
+	{ 84870, "Class SFXGame.SFXSeqAct_SetTargetable" },	// 5706
+	{ 84879, "Class SFXGame.SFXSeqAct_SetTreasure" },	// 5707
+	{ 84892, "Class SFXGame.SFXSeqAct_SetWeaponVisibility" },	// 5708
+	{ 84898, "Class SFXGame.SFXSeqAct_ShowCharacterRecordGUI" },	// 5709
+	{ 84914, "Class SFXGame.SFXSeqAct_ShowOptionsGUI" },	// 5710
+	{ 84959, "Class SFXGame.SFXSeqAct_StoreGUI" },	// 5711
+	{ 84984, "Class SFXGame.SFXSeqAct_ToggleAutoHints" },	// 5712
+	{ 84988, "Class SFXGame.SFXSeqAct_ToggleBlinking" },	// 5713
+	{ 85024, "Class SFXGame.SFXSeqAct_ToggleInjuredShepardMode" },	// 5714
+	{ 85029, "Class SFXGame.SFXSeqAct_TogglePrototyping" },	// 5715
+	{ 85052, "Class SFXGame.SFXSeqAct_WaitForPlayerSpawn" },	// 5716
+	{ 85088, "Class SFXGame.SFXSeqCond_GetDifficulty" },	// 5717
+	{ 85095, "Class SFXGame.SFXSeqCond_HasPlayerStart" },	// 5718
+	{ 85117, "Class SFXGame.SFXSeqEvt_HordeEnemyKilled" },	// 5719
+	{ 85119, "Class SFXGame.SFXSeqEvt_HordeWaveEnd" },	// 5720
+	{ 85121, "Class SFXGame.SFXSeqEvt_HordeWaveStart" },	// 5721
+	{ 85125, "Class SFXGame.SFXSeqEvt_LeavingStasis" },	// 5722
+	{ 85131, "Class SFXGame.SFXSeqEvt_ProtoInputTrap" },	// 5723
+	{ 85152, "Class SFXGame.SFXSeqEvt_Tutorial" },	// 5724
+	{ 85154, "Class SFXGame.SFXSeqEvt_VehicleMiningFailure" },	// 5725
+	{ 85156, "Class SFXGame.SFXSeqEvt_VehicleMiningSuccess" },	// 5726
+	{ 85882, "Class SFXGame.SFXSFHandler_PCAreaMap" },	// 5727
+	{ 85885, "Class SFXGame.SFXSFHandler_PCEANetworking" },	// 5728
+	{ 85888, "Class SFXGame.SFXSFHandler_PCHUD" },	// 5729
+	{ 85899, "Class SFXGame.SFXSFHandler_PCLoad" },	// 5730
+	{ 86148, "Class SFXGame.SFXSFHandler_PCPersonalization" },	// 5731
+	{ 86702, "Class SFXGame.SFXSFHandler_PCSave" },	// 5732
+	{ 86780, "Class SFXGame.SFXSFHandler_PCSlideshow" },	// 5733
+	{ 86791, "Class SFXGame.sfxsfhandler_ps3achievement" },	// 5734
+	{ 86796, "Class SFXGame.SFXSFHandler_PS3EANetworking" },	// 5735
+	{ 86798, "Class SFXGame.SFXSFHandler_PS3MainMenu" },	// 5736
+	{ 86808, "Class SFXGame.SFXSFHandler_PS3NewCharacter" },	// 5737
+	{ 86811, "Class SFXGame.SFXSFHandler_PS3Options" },	// 5738
+	{ 86813, "Class SFXGame.SFXSFHandler_PS3Personalization" },	// 5739
+	{ 86990, "Class SFXGame.sfxshield_player" },	// 5740
+	{ 86991, "Function SFXGame.sfxshield_player.PrecacheVFX" },	// 5741
+	{ 86995, "Function SFXGame.sfxshield_player.GetShieldRegenRate" },	// 5742
+	{ 86998, "Function SFXGame.sfxshield_player.GetShieldRegenDelay" },	// 5743
+	{ 87001, "Function SFXGame.sfxshield_player.ApplyDamageToShields" },	// 5744
+	{ 87013, "Function SFXGame.sfxshield_player.BreachShields" },	// 5745
+	{ 87026, "Function SFXGame.sfxshield_player.PlayRecharge" },	// 5746
+	{ 87028, "Function SFXGame.sfxshield_player.BeginRecharge" },	// 5747
+	{ 87046, "Class SFXGame.SFXSignText" },	// 5748
+	{ 87150, "Class SFXGame.SFXStealthVolume" },	// 5749
+	{ 87355, "Function SFXGame.SFXTelemetry.GetInstanceGameSession" },	// 5750
+	{ 87364, "Function SFXGame.SFXTelemetry.SendFloat" },	// 5751
+	{ 87376, "Function SFXGame.SFXTelemetry.AddAttributeToArray" },	// 5752
+	{ 87388, "Function SFXGame.SFXTelemetry.IsCollectionEnabled" },	// 5753
+	{ 87390, "Function SFXGame.SFXTelemetry.OnDisconnect" },	// 5754
+	{ 87395, "Function SFXGame.SFXTelemetry.InitConnectionDelegates" },	// 5755
+	{ 87398, "Function SFXGame.SFXTelemetry.OnAuthenticate" },	// 5756
+	{ 87402, "Function SFXGame.SFXTelemetry.OnLoginChange" },	// 5757
+	{ 87407, "Function SFXGame.SFXTelemetry.SendTelemetryOnProfileReadComplete" },	// 5758
+	{ 87413, "Function SFXGame.SFXTelemetry.SendProfileDependentTelemetry" },	// 5759
+	{ 87417, "Function SFXGame.SFXTelemetry.SendLanguageOverrideSettings" },	// 5760
+	{ 87418, "Function SFXGame.SFXTelemetry.SendCachedDisconnectEvent" },	// 5761
+	{ 87419, "Function SFXGame.SFXTelemetry.GetCharacterID" },	// 5762
+	{ 87619, "Class SFXGame.SFXTracer_Bullet" },	// 5763
+	{ 87623, "Class SFXGame.SFXTreasureNode" },	// 5764
+	{ 87978, "Class SFXGame.SFXWallRunReachSpec" },	// 5765
+	{ 87988, "Class SFXGame.SFXWaveManager" },	// 5766
+	{ 88040, "Function SFXGame.SFXWeapon_AssaultRifle_Base.ShouldSpawnTracerFX" },	// 5767
+	{ 88043, "Function SFXGame.SFXWeapon_AssaultRifle_Base.PlayFireEffects" },	// 5768
+	{ 88046, "Function SFXGame.SFXWeapon_AssaultRifle_Base.GetWeaponSpecificDecalData" },	// 5769
+	{ 88051, "Function SFXGame.SFXWeapon_AssaultRifle_Base.GetWeaponSpecificImpactEffect" },	// 5770
+	{ 88054, "Function SFXGame.SFXWeapon_AssaultRifle_Base.GetWeaponSpecificImpactSound" },	// 5771
+	{ 88057, "Function SFXGame.SFXWeapon_AssaultRifle_Base.GetStoreQualification" },	// 5772
+	{ 88093, "Function SFXGame.SFXWeapon_Shotgun_Base.ScaleWeapon" },	// 5773
+	{ 88095, "Function SFXGame.SFXWeapon_Shotgun_Base.ShouldSpawnTracerFX" },	// 5774
+	{ 88097, "Function SFXGame.SFXWeapon_Shotgun_Base.CustomFire" },	// 5775
+	{ 88100, "Function SFXGame.SFXWeapon_Shotgun_Base.FirePellets" },	// 5776
+	{ 88101, "Function SFXGame.SFXWeapon_Shotgun_Base.DrawDebugShotgunCone" },	// 5777
+	{ 88105, "Function SFXGame.SFXWeapon_Shotgun_Base.CalcRemoteImpactEffects" },	// 5778
+	{ 88119, "Function SFXGame.SFXWeapon_Shotgun_Base.PollLatentFire" },	// 5779
+	{ 88132, "Function SFXGame.SFXWeapon_Shotgun_Base.FinishLatentFire" },	// 5780
+	{ 88133, "Function SFXGame.SFXWeapon_Shotgun_Base.GetWeaponSpecificDecalData" },	// 5781
+	{ 88138, "Function SFXGame.SFXWeapon_Shotgun_Base.GetWeaponSpecificImpactEffect" },	// 5782
+	{ 88141, "Function SFXGame.SFXWeapon_Shotgun_Base.GetWeaponSpecificImpactSound" },	// 5783
+	{ 88144, "Function SFXGame.SFXWeapon_Shotgun_Base.DummyFire" },	// 5784
+	{ 88163, "Function SFXGame.SFXWeapon_Shotgun_Base.GetStoreQualification" },	// 5785
+	{ 88329, "Class SFXGame.SFXWeaponModUseModule" },	// 5786
+	{ 88354, "Class SFXGame.SFXWeaponModNode" },	// 5787
+	{ 88380, "Class SFXGame.SFXWeaponNode" },	// 5788
+	{ 88426, "Class SFXGame.SFXWeaponUseModule_BonusWeapon" },	// 5789
+	{ 88440, "Class SFXGame.SFXWeaponNode_BonusWeapon" },	// 5790
+	{ 105367, "Function sfxgamempcontent.SFXGAWReinforcementBase.OnAwarded" },	// 5791
+	{ 105381, "Function sfxgamempcontent.SFXGAWReinforcementBase.GetCurrentCount" },	// 5792
+	{ 105384, "Function sfxgamempcontent.SFXGAWReinforcementBase.GetPlayerVariableName" },	// 5793
+	{ 105390, "Function sfxgamempcontent.SFXGAWReinforcementBase.GetPlayerVariableNameFromCard" },	// 5794
+	{ 105394, "Function sfxgamempcontent.SFXGAWReinforcementBase.GetCardUniqueID" },	// 5795
+	{ 105406, "Function sfxgamempcontent.SFXGAWReinforcementBase.GenerateCardUniqueID" },	// 5796
+	{ 105408, "Class sfxgamempcontent.sfxgawreinforcementmanager" },	// 5797
+	{ 105410, "Function sfxgamempcontent.SFXGAWReinforcementBase.ConsumeNonGameplayConsumable" },	// 5798
+	{ 105467, "Class sfxgamempcontent.SFXGAWReinforcementBase" },	// 5799
+	{ 105475, "Class sfxgamempcontent.BioStartLocationMP" },	// 5800
+	{ 105531, "Function sfxgamecontent.sfxweapon_heavy_flamethrower_sentryturret.ProcessInstantHit" },	// 5801
+	{ 105533, "Function sfxgamecontent.sfxweapon_heavy_flamethrower_sentryturret.StopMuzzleFlashEffect" },	// 5802
+	{ 105545, "Function sfxgamecontent.sfxweapon_heavy_flamethrower_sentryturret.AttachMuzzleEffectsComponents" },	// 5803
+	{ 105549, "Function sfxgamecontent.sfxweapon_heavy_flamethrower_sentryturret.WeaponStoppedFiring" },	// 5804
+	{ 105551, "Function sfxgamecontent.sfxweapon_heavy_flamethrower_sentryturret.Destroyed" },	// 5805
+	{ 105569, "Function sfxgamecontent.sfxweapon_heavy_flamethrower_sentryturret.PlayWindDownEffects" },	// 5806
+	{ 105573, "Function sfxgamecontent.sfxweapon_heavy_flamethrower_sentryturret.PlayWindUpEffects" },	// 5807
+	{ 105579, "Function sfxgamecontent.sfxweapon_heavy_flamethrower_sentryturret.FireModeUpdated" },	// 5808
+	{ 105733, "Function sfxgamempcontent.SFXGAWReinforcementBase.Activate" },	// 5809
+	{ 105737, "Function sfxgamempcontent.SFXGAWReinforcementBase.Deactivate" },	// 5810
+	{ 105739, "Function sfxgamempcontent.SFXGAWReinforcementBase.IsActive" },	// 5811
+	{ 105742, "Function sfxgamempcontent.SFXGAWReinforcementBase.Initialize" },	// 5812
+	{ 105745, "Function sfxgamempcontent.SFXGAWReinforcementBase.GetCurrentValue" },	// 5813
+	{ 105804, "Function sfxgamecontent.SFXWeapon_Heavy_Beam_Base.GetAdjustedAim" },	// 5814
+	{ 105813, "Function sfxgamecontent.SFXWeapon_Heavy_Beam_Base.PreCalculateAdjustedAim" },	// 5815
+	{ 105820, "Function sfxgamecontent.SFXWeapon_Heavy_Beam_Base.UpdateBeam" },	// 5816
+	{ 105835, "Function sfxgamecontent.SFXWeapon_Heavy_Beam_Base.ProcessInstantHit" },	// 5817
+	{ 105846, "Function sfxgamecontent.SFXWeapon_Heavy_Beam_Base.CalcFireStart" },	// 5818
+	{ 105848, "Function sfxgamecontent.SFXWeapon_Heavy_Beam_Base.StopFire" },	// 5819
+	{ 105850, "Function sfxgamecontent.SFXWeapon_Heavy_Beam_Base.StartFire" },	// 5820
+	{ 105855, "Function sfxgamecontent.SFXWeapon_Heavy_Beam_Base.Tick" },	// 5821
+	{ 105859, "Function sfxgamecontent.SFXWeapon_Heavy_Beam_Base.SpawnImpactEffects" },	// 5822
+	{ 105862, "Function sfxgamecontent.SFXWeapon_Heavy_Beam_Base.GetWeaponSpecificImpactSound" },	// 5823
+	{ 105865, "Function sfxgamecontent.SFXWeapon_Heavy_Beam_Base.GetWeaponSpecificImpactEffect" },	// 5824
+	{ 105870, "Function sfxgamecontent.SFXWeapon_Heavy_Beam_Base.GetWeaponSpecificDecalData" },	// 5825
+	{ 105871, "Function sfxgamecontent.SFXWeapon_Heavy_Beam_Base.StopMuzzleFlashEffect" },	// 5826
+	{ 105872, "Function sfxgamecontent.SFXWeapon_Heavy_Beam_Base.PlayMuzzleFlashEffect" },	// 5827
+	{ 105882, "Function sfxgamecontent.SFXWeapon_Heavy_Beam_Base.StretchDecal" },	// 5828
+	{ 105887, "Function sfxgamecontent.SFXWeapon_Heavy_Beam_Base.SpawnADecal" },	// 5829
+	{ 105888, "Function sfxgamecontent.SFXWeapon_Heavy_Beam_Base.InitDefaultDecalProperties" },	// 5830
+	{ 105951, "Function sfxgamecontent.sfxprojectile_powercustomaction_seeking.ReplicatedEvent" },	// 5831
+	{ 105956, "Function sfxgamecontent.sfxprojectile_powercustomaction_seeking.Tick_Prediction" },	// 5832
+	{ 105957, "Function sfxgamecontent.sfxprojectile_powercustomaction_seeking.Recycle" },	// 5833
+	{ 105959, "Function sfxgamecontent.sfxprojectile_powercustomaction_seeking.InitializeRotation" },	// 5834
+	{ 105966, "Function sfxgamecontent.sfxprojectile_powercustomaction_seeking.InitializePowerProjectile" },	// 5835
+	{ 105971, "Function sfxgamecontent.sfxprojectile_powercustomaction_seeking.PawnEvadedPower" },	// 5836
+	{ 105979, "Function sfxgamecontent.sfxprojectile_powercustomaction_seeking.CanLockOn" },	// 5837
+	{ 105982, "Function sfxgamecontent.sfxprojectile_powercustomaction_seeking.Tick" },	// 5838
+	{ 105990, "Function sfxgamecontent.sfxprojectile_powercustomaction_seeking.TickAimRotation" },	// 5839
+	{ 105998, "Function sfxgamecontent.sfxprojectile_powercustomaction_seeking.TickAim" },	// 5840
+	{ 106000, "Function sfxgamecontent.sfxprojectile_powercustomaction_seeking.Timer" },	// 5841
+	{ 106007, "Function sfxgamecontent.sfxprojectile_powercustomaction_seeking.GetAimLocation" },	// 5842
+	{ 106025, "Class sfxgamecontent.SFXProjectile_PowerCustomAction_SentryTurretRocket" },	// 5843
+	{ 106038, "Function sfxgamecontent.SFXPowerCustomAction_SentryTurretCryoAmmo.ShouldUsePower" },	// 5844
+	{ 106049, "Function sfxgamecontent.SFXPowerCustomAction_SentryTurretCryoAmmo.ClientDoCustomActionImpact" },	// 5845
+	{ 106053, "Function sfxgamecontent.SFXPowerCustomAction_SentryTurretCryoAmmo.SetupEffect" },	// 5846
+	{ 106058, "Function sfxgamecontent.SFXPowerCustomAction_SentryTurretCryoAmmo.ApplyPowerEffects" },	// 5847
+	{ 106077, "Class sfxgamecontent.SFXProjectile_PowerCustomAction_BouncingGrenade" },	// 5848
+	{ 106078, "Class sfxgamecontent.SFXProjectile_PowerCustomAction_SentryTurret" },	// 5849
+	{ 106085, "Function sfxgamecontent.SFXPowerCustomAction_SentryTurret.PrecacheVFX" },	// 5850
+	{ 106086, "Function sfxgamecontent.SFXPowerCustomAction_SentryTurret.PopulatePowerStatBarEvolves" },	// 5851
+	{ 106090, "Function sfxgamecontent.SFXPowerCustomAction_SentryTurret.ApplyBonus" },	// 5852
+	{ 106092, "Function sfxgamecontent.SFXPowerCustomAction_SentryTurret.RecalculateAllPowerData" },	// 5853
+	{ 106096, "Function sfxgamecontent.SFXPowerCustomAction_SentryTurret.EvolvePower" },	// 5854
+	{ 106101, "Function sfxgamecontent.SFXPowerCustomAction_SentryTurret.ShouldUsePower" },	// 5855
+	{ 106104, "Function sfxgamecontent.SFXPowerCustomAction_SentryTurret.OnTurretKilled" },	// 5856
+	{ 106106, "Function sfxgamecontent.SFXPowerCustomAction_SentryTurret.DespawnTurret" },	// 5857
+	{ 106107, "Function sfxgamecontent.SFXPowerCustomAction_SentryTurret.OnPowerRankIncreased" },	// 5858
+	{ 106109, "Function sfxgamecontent.SFXPowerCustomAction_SentryTurret.IsTurretAlive" },	// 5859
+	{ 106134, "Function sfxgamecontent.SFXPowerCustomAction_SentryTurret.SetupCurrentTurret" },	// 5860
+	{ 106137, "Function sfxgamecontent.SFXPowerCustomAction_SentryTurret.NonCombatDespawnTurret" },	// 5861
+	{ 106141, "Function sfxgamecontent.SFXPowerCustomAction_SentryTurret.TurretNonCombatCheck" },	// 5862
+	{ 106147, "Function sfxgamecontent.SFXPowerCustomAction_SentryTurret.SpawnTurret" },	// 5863
+	{ 106150, "Function sfxgamecontent.SFXPowerCustomAction_SentryTurret.DelayedSpawn" },	// 5864
+	{ 106159, "Function sfxgamecontent.SFXPowerCustomAction_SentryTurret.OnPowerDetonated" },	// 5865
+	{ 106160, "Function sfxgamecontent.SFXPowerCustomAction_SentryTurret.StartCustomAction" },	// 5866
+	{ 106170, "Function sfxgamecontent.SFXPowerCustomAction_Decoy.PopulatePowerStatBarEvolves" },	// 5867
+	{ 106174, "Function sfxgamecontent.SFXPowerCustomAction_Decoy.ApplyBonus" },	// 5868
+	{ 106181, "Function sfxgamecontent.SFXPowerCustomAction_Decoy.EvolvePower" },	// 5869
+	{ 106183, "Function sfxgamecontent.SFXPowerCustomAction_Decoy.RecalculateAllPowerData" },	// 5870
+	{ 106184, "Function sfxgamecontent.SFXPowerCustomAction_Decoy.OnPowerRankIncreased" },	// 5871
+	{ 106186, "Function sfxgamecontent.SFXPowerCustomAction_Decoy.IsDecoyAlive" },	// 5872
+	{ 106195, "Function sfxgamecontent.SFXPowerCustomAction_Decoy.SetupSpawnedDecoy" },	// 5873
+	{ 106207, "Function sfxgamecontent.SFXPowerCustomAction_Decoy.OnPowerDetonated" },	// 5874
+	{ 106208, "Function sfxgamecontent.SFXPowerCustomAction_Decoy.StartCustomAction" },	// 5875
+	{ 106213, "Function sfxgamecontent.SFXPowerCustomAction_Decoy.IsSafeSpawnLocation" },	// 5876
+	{ 106216, "Function sfxgamecontent.SFXPowerCustomAction_Decoy.CanImpactActor" },	// 5877
+	{ 106223, "Function sfxgamecontent.SFXPowerCustomAction_Decoy.ClientDoPowerSubsequentImpact" },	// 5878
+	{ 106230, "Function sfxgamecontent.SFXPowerCustomAction_Decoy.ClientDoCustomActionImpact" },	// 5879
+	{ 106237, "Function sfxgamecontent.SFXPowerCustomAction_Decoy.ReplicatePowerSubsequentImpact" },	// 5880
+	{ 106245, "Function sfxgamecontent.SFXPowerCustomAction_Decoy.OnShockImpact" },	// 5881
+	{ 106253, "Function sfxgamecontent.SFXPowerCustomAction_Decoy.OnDeathExplosionImpact" },	// 5882
+	{ 106257, "Function sfxgamecontent.SFXPowerCustomAction_Decoy.DecoyKilledExplosion" },	// 5883
+	{ 106264, "Function sfxgamecontent.SFXPowerCustomAction_Decoy.OnDecoyKilled" },	// 5884
+	{ 106266, "Function sfxgamecontent.SFXPowerCustomAction_Decoy.DespawnDecoy" },	// 5885
+	{ 106273, "Function sfxgamecontent.SFXPowerCustomAction_Decoy.CastShock" },	// 5886
+	{ 106282, "Function sfxgamecontent.SFXPowerCustomAction_Decoy.SpawnDecoy" },	// 5887
+	{ 106293, "Function sfxgamecontent.SFXPowerCustomAction_CombatDroneZap.ClientDoPowerSubsequentImpact" },	// 5888
+	{ 106300, "Function sfxgamecontent.SFXPowerCustomAction_CombatDroneZap.CreateZapChainEffect" },	// 5889
+	{ 106310, "Function sfxgamecontent.SFXPowerCustomAction_CombatDroneZap.OnImpact" },	// 5890
+	{ 106313, "Function sfxgamecontent.SFXPowerCustomAction_CombatDroneZap.PrecacheVFX" },	// 5891
+	{ 106316, "Function sfxgamecontent.SFXPowerCustomAction_CombatDroneZap.GetImpactForce" },	// 5892
+	{ 106320, "Function sfxgamecontent.SFXPowerCustomAction_CombatDroneZap.GetImpactDamage" },	// 5893
+	{ 106343, "Class sfxgamecontent.sfxprojectile_powercustomaction_seeking" },	// 5894
+	{ 106344, "Class sfxgamecontent.SFXProjectile_PowerCustomAction_CombatDroneRocket" },	// 5895
+	{ 106370, "Function sfxgamecontent.SFXPowerCustomAction_CombatDrone.PrecacheVFX" },	// 5896
+	{ 106371, "Function sfxgamecontent.SFXPowerCustomAction_CombatDrone.PopulatePowerStatBarEvolves" },	// 5897
+	{ 106378, "Function sfxgamecontent.SFXPowerCustomAction_CombatDrone.ClientDoPowerSubsequentImpact" },	// 5898
+	{ 106382, "Function sfxgamecontent.SFXPowerCustomAction_CombatDrone.ApplyBonus" },	// 5899
+	{ 106384, "Function sfxgamecontent.SFXPowerCustomAction_CombatDrone.RecalculateAllPowerData" },	// 5900
+	{ 106390, "Function sfxgamecontent.SFXPowerCustomAction_CombatDrone.EvolvePower" },	// 5901
+	{ 106397, "Function sfxgamecontent.SFXPowerCustomAction_CombatDrone.OnDeathExplosionImpact" },	// 5902
+	{ 106407, "Function sfxgamecontent.SFXPowerCustomAction_CombatDrone.OnDroneKilled" },	// 5903
+	{ 106409, "Function sfxgamecontent.SFXPowerCustomAction_CombatDrone.GetDamageType" },	// 5904
+	{ 106410, "Function sfxgamecontent.SFXPowerCustomAction_CombatDrone.OnPowerRankIncreased" },	// 5905
+	{ 106412, "Function sfxgamecontent.SFXPowerCustomAction_CombatDrone.IsDroneAlive" },	// 5906
+	{ 106432, "Function sfxgamecontent.SFXPowerCustomAction_CombatDrone.SetupSpawnedDrone" },	// 5907
+	{ 106433, "Function sfxgamecontent.SFXPowerCustomAction_CombatDrone.NonCombatDespawnDrone" },	// 5908
+	{ 106437, "Function sfxgamecontent.SFXPowerCustomAction_CombatDrone.DroneNonCombatCheck" },	// 5909
+	{ 106443, "Function sfxgamecontent.SFXPowerCustomAction_CombatDrone.SpawnDrone" },	// 5910
+	{ 106451, "Function sfxgamecontent.SFXPowerCustomAction_CombatDrone.OnPowerDetonated" },	// 5911
+	{ 106453, "Function sfxgamecontent.SFXPowerCustomAction_CombatDrone.StartCustomAction" },	// 5912
+	{ 106454, "Class sfxgamecontent.SFXPowerCustomAction_CombatDrone" },	// 5913
+	{ 106458, "Function sfxgamecontent.SFXPowerCustomAction_CombatDroneBase.GetBackLocation" },	// 5914
+	{ 106464, "Function sfxgamecontent.SFXPowerCustomAction_CombatDroneBase.GetFrontLocation" },	// 5915
+	{ 106468, "Function sfxgamecontent.SFXPowerCustomAction_CombatDroneBase.IsSafeSpawnLocation" },	// 5916
+	{ 106470, "Function sfxgamecontent.SFXPowerCustomAction_CombatDroneBase.OnDroneKilled" },	// 5917
+	{ 106472, "Function sfxgamecontent.SFXPowerCustomAction_CombatDroneBase.DespawnDrone" },	// 5918
+	{ 106475, "Function sfxgamecontent.SFXPowerCustomAction_CombatDroneBase.SetupSpawnedDrone" },	// 5919
+	{ 106483, "Function sfxgamecontent.SFXPowerCustomAction_CombatDroneBase.SpawnDrone" },	// 5920
+	{ 106495, "Function sfxgamecontent.SFXPowerCustomAction_AmmoPower.DelayedSetWeaponPower" },	// 5921
+	{ 106503, "Function sfxgamecontent.SFXPowerCustomAction_AmmoPower.ClientDoCustomActionImpact" },	// 5922
+	{ 106506, "Function sfxgamecontent.SFXPowerCustomAction_AmmoPower.DoJoinInProgress" },	// 5923
+	{ 106509, "Function sfxgamecontent.SFXPowerCustomAction_AmmoPower.SetupEffect" },	// 5924
+	{ 106512, "Function sfxgamecontent.SFXPowerCustomAction_AmmoPower.OnPowerRankIncreased" },	// 5925
+	{ 106521, "Function sfxgamecontent.SFXPowerCustomAction_AmmoPower.ShouldUsePower" },	// 5926
+	{ 106524, "Function sfxgamecontent.SFXPowerCustomAction_AmmoPower.DoConcussiveShotSpecialImpact" },	// 5927
+	{ 106531, "Function sfxgamecontent.SFXPowerCustomAction_AmmoPower.ClientDoPowerSubsequentImpact" },	// 5928
+	{ 106534, "Function sfxgamecontent.SFXPowerCustomAction_AmmoPower.ReplicateConcussiveShotSpecialImpact" },	// 5929
+	{ 106540, "Function sfxgamecontent.SFXPowerCustomAction_AmmoPower.ConcussiveShotCustomImpact" },	// 5930
+	{ 106543, "Function sfxgamecontent.SFXPowerCustomAction_AmmoPower.ApplyPowerEffects" },	// 5931
+	{ 106557, "Function sfxgamecontent.SFXPowerCustomAction_AmmoPower.SetWeaponPower" },	// 5932
+	{ 106558, "Function sfxgamecontent.SFXPowerCustomAction_AmmoPower.DeferedSetWeaponPower" },	// 5933
+	{ 106566, "Function sfxgamecontent.SFXPowerCustomAction_AmmoPower.OnImpact" },	// 5934
+	{ 106569, "Function sfxgamecontent.SFXPowerCustomAction_AmmoPower.ReloadAmmoPower" },	// 5935
+	{ 106570, "Function sfxgamecontent.SFXPowerCustomAction_AmmoPower.StopOmniTool" },	// 5936
+	{ 106576, "Function sfxgamecontent.SFXPowerCustomAction_AmmoPower.StartCustomAction" },	// 5937
+	{ 106582, "Function sfxgamecontent.SFXPowerCustomAction_AmmoPower.CanUsePower" },	// 5938
+	{ 106586, "Function sfxgamecontent.SFXPowerCustomAction_AmmoPower.PrecacheVFX" },	// 5939
+	{ 106593, "Class sfxgamecontent.SFXSeqEvt_PlaceableActivated" },	// 5940
+	{ 106594, "Function sfxgamecontent.SFXPlaceable.ActivatePlaceable" },	// 5941
+	{ 106595, "Class sfxgamecontent.SFXSeqEvt_PlaceableDeactivated" },	// 5942
+	{ 106596, "Function sfxgamecontent.SFXPlaceable.DeactivatePlaceable" },	// 5943
+	{ 106599, "Function sfxgamecontent.SFXPlaceable.AllowPlaceableDamageEvents" },	// 5944
+	{ 106608, "Function sfxgamecontent.SFXPlaceable.ImpactWithPower" },	// 5945
+	{ 106618, "Function sfxgamecontent.SFXPlaceable.AreaDamage" },	// 5946
+	{ 106620, "Function sfxgamecontent.SFXPlaceable.AreaDamageForActor" },	// 5947
+	{ 106621, "Class sfxgamecontent.SFXSeqEvt_PlaceableDestroyed" },	// 5948
+	{ 106622, "Function sfxgamecontent.SFXPlaceable.PlaceableDestroyed" },	// 5949
+	{ 106623, "Class sfxgamecontent.SFXSeqEvt_PlaceableReset" },	// 5950
+	{ 106624, "Function sfxgamecontent.SFXPlaceable.ResetPlaceable" },	// 5951
+	{ 106628, "Function sfxgamecontent.SFXPlaceable.ReplicatedEvent" },	// 5952
+	{ 106629, "Class sfxgamecontent.SFXPlaceable" },	// 5953
+	{ 106641, "Class sfxgamecontent.sfxpowercustomaction_sentryturretshock" },	// 5954
+	{ 106642, "Class sfxgamecontent.sfxpowercustomaction_sentryturretrocket" },	// 5955
+	{ 106643, "Class sfxgamecontent.SFXPowerCustomAction_SentryTurretArmorPiercingAmmo" },	// 5956
+	{ 106644, "Class sfxgamecontent.SFXPowerCustomAction_SentryTurretCryoAmmo" },	// 5957
+	{ 106662, "Function sfxgamecontent.sfxpawn_sentryturret.GetPetOwner" },	// 5958
+	{ 106664, "Function sfxgamecontent.sfxpawn_sentryturret.PlayDeathVocalization" },	// 5959
+	{ 106670, "Function sfxgamecontent.sfxpawn_sentryturret.PlayDying" },	// 5960
+	{ 106679, "Function sfxgamecontent.sfxpawn_sentryturret.TakeDamage" },	// 5961
+	{ 106684, "Class sfxgamecontent.SFXPowerCustomAction_SentryTurret" },	// 5962
+	{ 106686, "Function sfxgamecontent.sfxpawn_sentryturret.TurretCreatorInfoUpdated" },	// 5963
+	{ 106688, "Function sfxgamecontent.sfxpawn_sentryturret.ReplicatedEvent" },	// 5964
+	{ 106696, "Function sfxgamecontent.sfxpawn_sentryturret.StartVFX" },	// 5965
+	{ 106702, "Function sfxgamecontent.sfxpawn_sentryturret.SetupCasterAndReplication" },	// 5966
+	{ 106705, "Function sfxgamecontent.sfxpawn_sentryturret.PostBeginPlay" },	// 5967
+	{ 106707, "Function sfxgamecontent.sfxpawn_sentryturret.OnTurretKilled" },	// 5968
+	{ 106711, "Class sfxgamecontent.sfxpawn_sentryturret" },	// 5969
+	{ 106739, "Function sfxgamecontent.sfxpawn_decoy.GetPetOwner" },	// 5970
+	{ 106743, "Function sfxgamecontent.sfxpawn_decoy.ShockCollideTest" },	// 5971
+	{ 106744, "Function sfxgamecontent.sfxpawn_decoy.Destroyed" },	// 5972
+	{ 106750, "Function sfxgamecontent.sfxpawn_decoy.StartDecoyVFX" },	// 5973
+	{ 106752, "Function sfxgamecontent.sfxpawn_decoy.SetDeathTimer" },	// 5974
+	{ 106755, "Function sfxgamecontent.sfxpawn_decoy.PostBeginPlay" },	// 5975
+	{ 106757, "Function sfxgamecontent.sfxpawn_decoy.PlayDeathVocalization" },	// 5976
+	{ 106764, "Function sfxgamecontent.sfxpawn_decoy.PlayDying" },	// 5977
+	{ 106765, "Function sfxgamecontent.sfxpawn_decoy.PlayDyingHelper" },	// 5978
+	{ 106769, "Class sfxgamecontent.SFXPowerCustomAction_Decoy" },	// 5979
+	{ 106771, "Function sfxgamecontent.sfxpawn_decoy.DecoyCreatorInfoUpdated" },	// 5980
+	{ 106773, "Function sfxgamecontent.sfxpawn_decoy.ReplicatedEvent" },	// 5981
+	{ 106778, "Function sfxgamecontent.sfxpawn_decoy.SetupCasterAndReplication" },	// 5982
+	{ 106780, "Function sfxgamecontent.sfxpawn_decoy.OnDecoyKilled" },	// 5983
+	{ 106784, "Class sfxgamecontent.sfxpawn_decoy" },	// 5984
+	{ 106795, "Class sfxgamecontent.SFXPowerCustomAction_CombatDroneRocket" },	// 5985
+	{ 106796, "Class sfxgamecontent.sfxpowercustomaction_combatdroneshock" },	// 5986
+	{ 106821, "Function sfxgamecontent.sfxpawn_combatdrone.PlayDying" },	// 5987
+	{ 106830, "Function sfxgamecontent.sfxpawn_combatdrone.TakeDamage" },	// 5988
+	{ 106838, "Function sfxgamecontent.sfxpawn_combatdrone.StartDroneVFX" },	// 5989
+	{ 106840, "Function sfxgamecontent.sfxpawn_combatdrone.SetupCasterAndReplication" },	// 5990
+	{ 106843, "Function sfxgamecontent.sfxpawn_combatdrone.PostBeginPlay" },	// 5991
+	{ 106844, "Class sfxgamecontent.sfxpawn_combatdrone" },	// 5992
+	{ 106869, "Function sfxgamecontent.SFXPawn_CombatDroneBase.GetPetOwner" },	// 5993
+	{ 106871, "Function sfxgamecontent.SFXPawn_CombatDroneBase.PlayDeathVocalization" },	// 5994
+	{ 106874, "Function sfxgamecontent.SFXPawn_CombatDroneBase.PlayDying" },	// 5995
+	{ 106877, "Class sfxgamecontent.SFXPowerCustomAction_CombatDroneBase" },	// 5996
+	{ 106879, "Function sfxgamecontent.SFXPawn_CombatDroneBase.DroneCreatorInfoUpdated" },	// 5997
+	{ 106881, "Function sfxgamecontent.SFXPawn_CombatDroneBase.ReplicatedEvent" },	// 5998
+	{ 106885, "Function sfxgamecontent.SFXPawn_CombatDroneBase.SetupCasterAndReplication" },	// 5999
+	{ 106887, "Function sfxgamecontent.SFXPawn_CombatDroneBase.OnDroneKilled" },	// 6000
+	{ 106895, "Function sfxgamecontent.SFXGUI_HeavyWeaponReticle.TargetCanHitChanged" },	// 6001
+	{ 106897, "Function sfxgamecontent.SFXGUI_HeavyWeaponReticle.WeaponAmmoChanged" },	// 6002
+	{ 106900, "Function sfxgamecontent.SFXGUI_HeavyWeaponReticle.OnReticleLoaded" },	// 6003
+	{ 106902, "Function sfxgamecontent.SFXGUI_HeavyWeaponReticle.PerformReticleHide" },	// 6004
+	{ 106905, "Function sfxgamecontent.SFXGUI_HeavyWeaponReticle.PerformReticleShow" },	// 6005
+	{ 106906, "Class sfxgamecontent.SFXGUI_HeavyWeaponReticle" },	// 6006
+	{ 106908, "Function sfxgamecontent.SFXGameEffect_WeaponVFXChange.OnRemoved" },	// 6007
+	{ 106917, "Function sfxgamecontent.SFXGameEffect_WeaponVFXChange.OnApplied" },	// 6008
+	{ 106918, "Class sfxgamecontent.SFXGameEffect_WeaponVFXChange" },	// 6009
+	{ 106921, "Function sfxgamecontent.SFXGameEffect_SpareAmmo.OnRemoved" },	// 6010
+	{ 106924, "Function sfxgamecontent.SFXGameEffect_SpareAmmo.OnApplied" },	// 6011
+	{ 106928, "Class sfxgamecontent.SFXRumble_Power_FireCombo" },	// 6012
+	{ 106929, "Class sfxgamecontent.SFXShake_Power_FireCombo" },	// 6013
+	{ 106953, "Function sfxgamecontent.sfxgameeffect_powercombo_fire.OnImpact" },	// 6014
+	{ 106958, "Function sfxgamecontent.sfxgameeffect_powercombo_fire.OnPowerComboDetonated" },	// 6015
+	{ 106964, "Class sfxgamecontent.SFXRumble_Power_ElectricCombo" },	// 6016
+	{ 106965, "Class sfxgamecontent.SFXShake_Power_ElectricCombo" },	// 6017
+	{ 106976, "Function sfxgamecontent.sfxgameeffect_powercombo_electric.OnImpact" },	// 6018
+	{ 106977, "Class sfxgamecontent.sfxgameeffect_powercombo_electric" },	// 6019
+	{ 106980, "Class sfxgamecontent.SFXRumble_Power_CryoCombo" },	// 6020
+	{ 106981, "Class sfxgamecontent.SFXShake_Power_CryoCombo" },	// 6021
+	{ 107000, "Function sfxgamecontent.sfxgameeffect_powercombo_cryo.OnImpact" },	// 6022
+	{ 107012, "Function sfxgamecontent.SFXGameEffect_WeaponMod.OnApplied" },	// 6023
+	{ 107020, "Function sfxgamecontent.SFXGameEffect_IgnorePawn.OnRemoved" },	// 6024
+	{ 107023, "Function sfxgamecontent.SFXGameEffect_IgnorePawn.OnApplied" },	// 6025
+	{ 107024, "Class sfxgamecontent.SFXGameEffect_IgnorePawn" },	// 6026
+	{ 107036, "Function sfxgamecontent.SFXGameEffect_FireDamageOverTime.DoDamage" },	// 6027
+	{ 107041, "Class sfxgamecontent.sfxgameeffect_powercombo_fire" },	// 6028
+	{ 107044, "Function sfxgamecontent.SFXGameEffect_FireDamageOverTime.AddFireDamage" },	// 6029
+	{ 107047, "Function sfxgamecontent.SFXGameEffect_FireDamageOverTime.OnApplied" },	// 6030
+	{ 107048, "Class sfxgamecontent.SFXGameEffect_FireDamageOverTime" },	// 6031
+	{ 107055, "Function sfxgamecontent.SFXGameEffect_ElectricComboBeam.OnRemoved" },	// 6032
+	{ 107057, "Function sfxgamecontent.SFXGameEffect_ElectricComboBeam.OnUpdate" },	// 6033
+	{ 107062, "Function sfxgamecontent.SFXGameEffect_ElectricComboBeam.PlayBeamEffect" },	// 6034
+	{ 107072, "Function sfxgamecontent.SFXGameEffect_ElectricComboBeam.OnApplied" },	// 6035
+	{ 107073, "Class sfxgamecontent.SFXGameEffect_ElectricComboBeam" },	// 6036
+	{ 107076, "Class sfxgamecontent.sfxgameeffect_powercombo_cryo" },	// 6037
+	{ 107080, "Function sfxgamecontent.SFXGameEffect_DelayedCryoFreeze.OnRemoved" },	// 6038
+	{ 107088, "Function sfxgamecontent.SFXGameEffect_DelayedCryoFreeze.OnUpdate" },	// 6039
+	{ 107095, "Function sfxgamecontent.SFXGameEffect_DelayedCryoFreeze.OnApplied" },	// 6040
+	{ 107097, "Function sfxgamecontent.SFXGameEffect_DelayedCryoFreeze.OnFrozenPawnDied" },	// 6041
+	{ 107103, "Class sfxgamecontent.SFXGameEffect_DamageImmunity" },	// 6042
+	{ 107108, "Function sfxgamecontent.SFXGameEffect_CryoFreeze.OnRemoved" },	// 6043
+	{ 107120, "Function sfxgamecontent.SFXGameEffect_CryoFreeze.OnUpdate" },	// 6044
+	{ 107125, "Function sfxgamecontent.SFXGameEffect_CryoFreeze.OnApplied" },	// 6045
+	{ 107127, "Function sfxgamecontent.SFXGameEffect_CryoFreeze.OnFrozenPawnDied" },	// 6046
+	{ 107138, "Function sfxgamecontent.SFXGameEffect_CryoAmmo.GetDamageVocProbabilityMod" },	// 6047
+	{ 107144, "Class sfxgamecontent.SFXGameEffect_PartBasedDamageTakenBonus" },	// 6048
+	{ 107163, "Function sfxgamecontent.SFXGameEffect_CryoAmmo.DoFreezeEffect" },	// 6049
+	{ 107166, "Class sfxgamecontent.SFXGameEffect_CryoFreeze" },	// 6050
+	{ 107167, "Class sfxgamecontent.SFXGameEffect_DelayedCryoFreeze" },	// 6051
+	{ 107174, "Function sfxgamecontent.SFXGameEffect_CryoAmmo.OnWeaponImpact" },	// 6052
+	{ 107177, "Function sfxgamecontent.SFXGameEffect_CryoAmmo.OnApplied" },	// 6053
+	{ 107178, "Class sfxgamecontent.SFXGameEffect_CryoAmmo" },	// 6054
+	{ 107195, "Class sfxgamecontent.SFXPowerCustomAction_CombatDroneZap" },	// 6055
+	{ 107198, "Function sfxgamecontent.SFXGameEffect_CombatDroneZapChain.OnRemoved" },	// 6056
+	{ 107203, "Function sfxgamecontent.SFXGameEffect_CombatDroneZapChain.ImpactAdditionalTarget" },	// 6057
+	{ 107210, "Function sfxgamecontent.SFXGameEffect_CombatDroneZapChain.SelectAndImpactNextTarget" },	// 6058
+	{ 107214, "Function sfxgamecontent.SFXGameEffect_CombatDroneZapChain.OnUpdate" },	// 6059
+	{ 107221, "Function sfxgamecontent.SFXGameEffect_CombatDroneZapChain.PlayBeamEffect" },	// 6060
+	{ 107247, "Function sfxgamecontent.SFXGameEffect_CombatDroneZapChain.OnApplied" },	// 6061
+	{ 107251, "Function sfxgamecontent.SFXGameEffect_CombatDroneZapChain.PrecacheVFX" },	// 6062
+	{ 107254, "Class sfxgamecontent.SFXGameEffect_CombatDroneZapChain" },	// 6063
+	{ 107260, "Class sfxgamecontent.SFXGameEffect_ArmorWeakness" },	// 6064
+	{ 107293, "Function sfxgamecontent.SFXGameEffect_ArmorPiercingAmmo.OnWeaponImpact" },	// 6065
+	{ 107295, "Function sfxgamecontent.SFXGameEffect_ArmorPiercingAmmo.OnRemoved" },	// 6066
+	{ 107296, "Class sfxgamecontent.SFXGameEffect_ArmorPiercingBonus" },	// 6067
+	{ 107299, "Class sfxgamecontent.sfxgameeffect_penetrationdamagebonus" },	// 6068
+	{ 107300, "Class sfxgamecontent.SFXGameEffect_WeaponMod" },	// 6069
+	{ 107301, "Class sfxgamecontent.SFXGameEffect_PenetrationBonus" },	// 6070
+	{ 107303, "Class sfxgamecontent.SFXGameEffect_ConstraintDmgBonus" },	// 6071
+	{ 107305, "Class sfxgamecontent.SFXGameEffect_SpareAmmo" },	// 6072
+	{ 107308, "Function sfxgamecontent.SFXGameEffect_ArmorPiercingAmmo.OnApplied" },	// 6073
+	{ 107313, "Function sfxgamecontent.SFXGameEffect_ArmorPiercingAmmo.PrecacheVFX" },	// 6074
+	{ 107314, "Class sfxgamecontent.SFXGameEffect_ArmorPiercingAmmo" },	// 6075
+	{ 107316, "Class sfxgamecontent.SFXPowerCustomAction_AmmoPower" },	// 6076
+	{ 107323, "Function sfxgamecontent.SFXGameEffect_AmmoPower.OnUpdate" },	// 6077
+	{ 107325, "Function sfxgamecontent.SFXGameEffect_AmmoPower.OnWeaponUnequip" },	// 6078
+	{ 107327, "Function sfxgamecontent.SFXGameEffect_AmmoPower.OnWeaponEquip" },	// 6079
+	{ 107329, "Function sfxgamecontent.SFXGameEffect_AmmoPower.OnWeaponReload" },	// 6080
+	{ 107331, "Function sfxgamecontent.SFXGameEffect_AmmoPower.GetDamageVocProbabilityMod" },	// 6081
+	{ 107335, "Function sfxgamecontent.SFXGameEffect_AmmoPower.OnWeaponImpact" },	// 6082
+	{ 107336, "Function sfxgamecontent.SFXGameEffect_AmmoPower.OnRemoved" },	// 6083
+	{ 107341, "Function sfxgamecontent.SFXGameEffect_AmmoPower.GetBulletsPerSecond" },	// 6084
+	{ 107346, "Function sfxgamecontent.SFXGameEffect_AmmoPower.GetWeaponDamage" },	// 6085
+	{ 107350, "Function sfxgamecontent.SFXGameEffect_AmmoPower.GetHitTarget" },	// 6086
+	{ 107352, "Function sfxgamecontent.SFXGameEffect_AmmoPower.SetupFromWeapon" },	// 6087
+	{ 107358, "Function sfxgamecontent.SFXGameEffect_AmmoPower.OnApplied" },	// 6088
+	{ 107359, "Class sfxgamecontent.SFXGameEffect_AmmoPower" },	// 6089
+	{ 107362, "Class sfxgamecontent.SFXDamageType_SentryTurretShock" },	// 6090
+	{ 107365, "Class sfxgamecontent.SFXDamageType_HeavyWeapon" },	// 6091
+	{ 107370, "Class sfxgamecontent.SFXDamageType_FlameThrower" },	// 6092
+	{ 107376, "Class sfxgamecontent.SFXDamageType_FireExplosion" },	// 6093
+	{ 107379, "Class sfxgamecontent.SFXDamageType_ElectricCombo" },	// 6094
+	{ 107382, "Class sfxgamecontent.SFXDamageType_Decoy" },	// 6095
+	{ 107385, "Class sfxgamecontent.SFXDamageType_CryoExplosion" },	// 6096
+	{ 107388, "Class sfxgamecontent.SFXDamageType_CryoAmmo" },	// 6097
+	{ 107391, "Class sfxgamecontent.SFXDamageType_CombatDroneAttackImproved" },	// 6098
+	{ 107394, "Class sfxgamecontent.SFXDamageType_CombatDroneAttack" },	// 6099
+	{ 107397, "Class sfxgamecontent.SFXDamageType_CombatDrone" },	// 6100
+	{ 107400, "Class sfxgamecontent.SFXDamageType_AssaultRifle" },	// 6101
+	{ 107403, "Class sfxgamecontent.SFXDamageType_ArmorPiercingAmmo" },	// 6102
+	{ 107408, "Class sfxgamecontent.SFXWeapon_AssaultRifle_SentryTurret" },	// 6103
+	{ 107410, "Class sfxgamecontent.SFXWeapon_Heavy_Beam_Base" },	// 6104
+	{ 107411, "Class sfxgamecontent.sfxweapon_heavy_flamethrower_sentryturret" },	// 6105
+	{ 107412, "Function sfxgamecontent.SFXAICmd_Base_SentryTurret.ChooseWeapon" },	// 6106
+	{ 107419, "Function sfxgamempcontent.sfxgawreinforcementmanager.PopulateCardData" },	// 6107
+	{ 107432, "Function sfxgamempcontent.SFXGAWReinforcementBase.SetCurrentValue" },	// 6108
+	{ 107460, "Function sfxgamecontent.SFXAICmd_Base_SentryTurret.ShouldUsePower" },	// 6109
+	{ 107469, "Function sfxgamecontent.SFXAICmd_Base_CombatDrone.ShouldUsePower" },	// 6110
+	{ 107472, "Function sfxgamecontent.SFXAICmd_Base_CombatDrone.GetIdealRange" },	// 6111
+	{ 107478, "Function sfxgamecontent.SFXAICmd_Base_CombatDrone.Pushed" },	// 6112
+	{ 107479, "Class sfxgamecontent.SFXAICmd_Base_SentryTurret" },	// 6113
+	{ 107481, "Class sfxgamecontent.SFXAI_SentryTurret" },	// 6114
+	{ 107482, "Class sfxgamecontent.SFXAICmd_Base_CombatDrone" },	// 6115
+	{ 107488, "Class sfxgamecontent.SFXPawn_CombatDroneBase" },	// 6116
+	{ 107490, "Function sfxgamecontent.sfxai_combatdrone.BioClearCrossLevelReferences" },	// 6117
+	{ 107493, "Function sfxgamecontent.sfxai_combatdrone.PeriodicMoveCheck" },	// 6118
+	{ 107494, "Class sfxgamecontent.sfxai_combatdrone" },	// 6119
+	{ 107626, "Class sfxgamempcontent.sfxgawreinforcementmatchconsumable" },	// 6120
+	{ 107648, "Function sfxgamempcontent.sfxgawreinforcementmanager.OnPurchaseItemDelegate" },	// 6121
+	{ 107650, "Function sfxgamempcontent.sfxgawreinforcementmanager.OnProcessConsumablesDelegate" },	// 6122
+	{ 107652, "Function sfxgamempcontent.sfxgawreinforcementmanager.OnPurchaseItemWithCreditsDelegate" },	// 6123
+	{ 107654, "Function sfxgamempcontent.sfxgawreinforcementmanager.LoadDeck" },	// 6124
+	{ 107661, "Function sfxgamempcontent.sfxgawreinforcementmanager.CardSort" },	// 6125
+	{ 107665, "Function sfxgamempcontent.sfxgawreinforcementmanager.GetCardsOfType" },	// 6126
+	{ 107684, "Function sfxgamempcontent.sfxgawreinforcementmanager.AwardRandomCardsFromPoolCards" },	// 6127
+	{ 107696, "Function sfxgamempcontent.sfxgawreinforcementmanager.GiveCardPack" },	// 6128
+	{ 107720, "Class sfxgamempcontent.sfxtelemetryhooksmp" },	// 6129
+	{ 107722, "Function sfxgamempcontent.sfxgawreinforcementmanager.GetUniqueMatchConsumables" },	// 6130
+	{ 107731, "Function sfxgamempcontent.sfxgawreinforcementmatchconsumable.ContainsCard" },	// 6131
+	{ 107734, "Function sfxgamempcontent.sfxgawreinforcementmanager.MatchConsumableSort" },	// 6132
+	{ 107740, "Function sfxgamempcontent.sfxgawreinforcementmanager.UpdateStoreDescriptions" },	// 6133
+	{ 107769, "Function sfxgamempcontent.sfxgawreinforcementmanager.GetProductDetailsComplete" },	// 6134
+	{ 107770, "Function sfxgamempcontent.sfxgawreinforcementmanager.IsFetchingProductDetails" },	// 6135
+	{ 107772, "Function sfxgamempcontent.sfxgawreinforcementmanager.GetStoreInfo" },	// 6136
+	{ 107775, "Function sfxgamempcontent.sfxgawreinforcementmanager.GetStoreItems" },	// 6137
+	{ 107791, "Function sfxgamempcontent.sfxgawreinforcementmanager.CheckOfferVisibility" },	// 6138
+	{ 107792, "Function sfxgamempcontent.sfxgawreinforcementmanager.FindOfferIndex" },	// 6139
+	{ 107793, "Function sfxgamempcontent.sfxgawreinforcementmanager.GetStoreItemPurchaseType" },	// 6140
+	{ 107795, "Function sfxgamempcontent.sfxgawreinforcementmanager.StoreItemSort" },	// 6141
+	{ 107799, "Function sfxgamempcontent.sfxgawreinforcementmanager.GetCreditCost" },	// 6142
+	{ 107803, "Function sfxgamempcontent.sfxgawreinforcementmanager.GetPlatformCost" },	// 6143
+	{ 107810, "Function sfxgamempcontent.sfxgawreinforcementmanager.GetPlatformCostValue" },	// 6144
+	{ 107831, "Function sfxgamempcontent.sfxgawreinforcementmanager.EntitlementVisiblityCheck" },	// 6145
+	{ 107841, "Function sfxgamempcontent.sfxgawreinforcementmanager.PurchaseItemWithCredits" },	// 6146
+	{ 107847, "Function sfxgamempcontent.sfxgawreinforcementmanager.UpdateLastAwardedCards" },	// 6147
+	{ 107848, "Function sfxgamempcontent.sfxgawreinforcementmanager.OnPurchaseItemWithCreditsFinished" },	// 6148
+	{ 107854, "Function sfxgamempcontent.sfxgawreinforcementmanager.CanPurchaseItemWithCredits" },	// 6149
+	{ 107859, "Function sfxgamempcontent.sfxgawreinforcementmanager.ReloadPlayerSettingsComplete" },	// 6150
+	{ 107860, "Function sfxgamempcontent.sfxgawreinforcementmanager.PurchaseItemFromPlatform" },	// 6151
+	{ 107871, "Function sfxgamempcontent.sfxgawreinforcementmanager.ConsumptionFlowError" },	// 6152
+	{ 107877, "Function sfxgamempcontent.sfxgawreinforcementmanager.ExitConsumptionFlow" },	// 6153
+	{ 107878, "Function sfxgamempcontent.sfxgawreinforcementmanager.StartConsumptionFlow" },	// 6154
+	{ 107879, "Function sfxgamempcontent.sfxgawreinforcementmanager.ConsumptionFlow_Timer" },	// 6155
+	{ 107881, "Function sfxgamempcontent.sfxgawreinforcementmanager.ConsumptionFlow_SetCallbackTimer" },	// 6156
+	{ 107885, "Function sfxgamempcontent.sfxgawreinforcementmanager.ConsumptionFlow_ClearCallbackTimer" },	// 6157
+	{ 107888, "Function sfxgamempcontent.sfxgawreinforcementmanager.ProcessConsumables" },	// 6158
+	{ 107894, "Function sfxgamempcontent.sfxgawreinforcementmanager.ConsumptionFlow_Setup" },	// 6159
+	{ 107898, "Function sfxgamempcontent.sfxgawreinforcementmanager.ConsumptionFlow_Top" },	// 6160
+	{ 107903, "Function sfxgamempcontent.sfxgawreinforcementmanager.ConsumptionFlow_ProcessRemote" },	// 6161
+	{ 107904, "Function sfxgamempcontent.sfxgawreinforcementmanager.ConsumptionFlow_ProcessLocal" },	// 6162
+	{ 107910, "Function sfxgamempcontent.sfxgawreinforcementmanager.AwardPacks" },	// 6163
+	{ 107912, "Function sfxgamempcontent.sfxgawreinforcementmanager.GrantPackPurchasedEntitlement" },	// 6164
+	{ 107920, "Function sfxgamempcontent.sfxgawreinforcementmanager.ConsumptionFlow_SaveComplete" },	// 6165
+	{ 107928, "Function sfxgamempcontent.sfxgawreinforcementmanager.FinishPurchase" },	// 6166
+	{ 107930, "Function sfxgamempcontent.sfxgawreinforcementmanager.ConsumptionFlow_Finished" },	// 6167
+	{ 107932, "Function sfxgamempcontent.sfxgawreinforcementmanager.GetStoreItemIDFromOffer" },	// 6168
+	{ 107936, "Function sfxgamempcontent.sfxgawreinforcementmanager.GetOfferIDFromStoreID" },	// 6169
+	{ 107940, "Function sfxgamempcontent.sfxgawreinforcementmanager.GetPCPointsBalance" },	// 6170
+	{ 107942, "Function sfxgamempcontent.sfxgawreinforcementmanager.CanAffordNewStoreItems" },	// 6171
+	{ 107955, "Class sfxgamempcontent.SFXGAWReinforcementInGameConsumable" },	// 6172
+	{ 107956, "Class sfxgamempcontent.SFXGAWReinforcementInventoryUnlock" },	// 6173
+	{ 107957, "Class sfxgamempcontent.SFXGAWReinforcementMatchConsumable_NonGameplay" },	// 6174
+	{ 107958, "Class sfxgamempcontent.SFXGAWReinforcementPermanentUpgrade" },	// 6175
+	{ 107959, "Class sfxgamempcontent.SFXGAWReinforcementCredits" },	// 6176
+	{ 107960, "Class sfxgamempcontent.SFXGAWReinforcementUnsaved" },	// 6177
+	{ 107961, "Class sfxgamempcontent.SFXGAWReinforcementKitUnlock" },	// 6178
+	{ 107962, "Class sfxgamempcontent.sfxcheatmanagernonnativemp" },	// 6179
+	{ 107965, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.SetKit" },	// 6180
+	{ 107967, "Class sfxgamempcontent.sfxprimp" },	// 6181
+	{ 107968, "Function sfxgamempcontent.sfxprimp.SendCharacterDataToServer" },	// 6182
+	{ 107969, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.ProfileDeck" },	// 6183
+	{ 107979, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.CreditsCardPack" },	// 6184
+	{ 107989, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.CheatCardPack" },	// 6185
+	{ 107995, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.LoadDeck" },	// 6186
+	{ 107998, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.DebugMatchConsumables" },	// 6187
+	{ 108004, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.GiveAllMatchConsumables" },	// 6188
+	{ 108014, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.GiveAmmoConsumable" },	// 6189
+	{ 108018, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.GiveReviveConsumable" },	// 6190
+	{ 108022, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.GiveRocketConsumable" },	// 6191
+	{ 108026, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.GiveShieldConsumable" },	// 6192
+	{ 108030, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.GiveMPConsumables" },	// 6193
+	{ 108032, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.TestHostile" },	// 6194
+	{ 108035, "Class sfxgamempcontent.SFXWave_Horde" },	// 6195
+	{ 108037, "Class sfxgamempcontent.SFXSquadCombatMP" },	// 6196
+	{ 108039, "Class sfxgamempcontent.SFXPlayerSquadMP" },	// 6197
+	{ 108045, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.TestSquads" },	// 6198
+	{ 108050, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.ReplicationDebugCam" },	// 6199
+	{ 108052, "Class sfxgamempcontent.sfxplayercontrollermp" },	// 6200
+	{ 108053, "Class sfxgamempcontent.sfxpawn_playermp" },	// 6201
+	{ 108054, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.UnlockAllMPCards" },	// 6202
+	{ 108060, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.TestPurchaseFromPlatform" },	// 6203
+	{ 108064, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.TestConsumptionError" },	// 6204
+	{ 108068, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.TestPurchaseEntitlement" },	// 6205
+	{ 108071, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.ShowAllMPCards" },	// 6206
+	{ 108078, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.RestartFromWave" },	// 6207
+	{ 108080, "Class sfxgamempcontent.sfxwavecoordinator_hordeoperation" },	// 6208
+	{ 108081, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.RestartFromCheckpoint" },	// 6209
+	{ 108083, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.RestartFromBeginning" },	// 6210
+	{ 108084, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.RestartWithFaction" },	// 6211
+	{ 108090, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.SkipWave" },	// 6212
+	{ 108091, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.PlayHordeLine" },	// 6213
+	{ 108097, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.PlayObjectiveLine" },	// 6214
+	{ 108099, "Class sfxgamempcontent.sfxwave_operation" },	// 6215
+	{ 108101, "Class sfxgamempcontent.sfxoperationobjective" },	// 6216
+	{ 108110, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.ProfileMPGame" },	// 6217
+	{ 108126, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.GetFriendlyCurrentWaveNumber" },	// 6218
+	{ 108139, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.ToggleEndlessWave" },	// 6219
+	{ 108141, "Function sfxgamempcontent.SFXWave_Horde.SetEndlessWaves" },	// 6220
+	{ 108142, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.EndCurrentWave" },	// 6221
+	{ 108143, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.SetEmblem" },	// 6222
+	{ 108144, "Function sfxgamempcontent.sfxcheatmanagernonnativemp.KickServer" },	// 6223
+	{ 108155, "Class sfxgamempcontent.SFXCustomizationInstance_PlayerMP" },	// 6224
+	{ 108156, "Function sfxgamempcontent.SFXCustomizationInstance_PlayerMP.CustomizeMaterialInstance" },	// 6225
+	{ 108160, "Class sfxgamempcontent.SFXPlayerCustomizationMP" },	// 6226
+	{ 108175, "Class sfxgamempcontent.SFXDamageType_ConsumableRocket" },	// 6227
+	{ 108181, "Class sfxgamempcontent.SFXDamageType_ConsumableRocketGib" },	// 6228
+	{ 108185, "Class sfxgamempcontent.SFXDifficultyHandlerMP" },	// 6229
+	{ 108186, "Function sfxgamempcontent.SFXDifficultyHandlerMP.Update" },	// 6230
+	{ 108187, "Function sfxgamempcontent.SFXDifficultyHandlerMP.UpdateDifficultyScore" },	// 6231
+	{ 108190, "Class sfxgamempcontent.sfxgrimp" },	// 6232
+	{ 108207, "Function sfxgamempcontent.sfxwave_operation.InitializeWave" },	// 6233
+	{ 108211, "Class sfxgamempcontent.SFXWaveManager_Operation" },	// 6234
+	{ 108212, "Function sfxgamempcontent.sfxwave_operation.ObjectiveSpawnSort" },	// 6235
+	{ 108216, "Function sfxgamempcontent.sfxwave_operation.BeginWave" },	// 6236
+	{ 108260, "Function sfxgamempcontent.sfxwave_operation.ShowBeginWaveMessage" },	// 6237
+	{ 108262, "Function sfxgamempcontent.sfxwave_operation.FinishWave" },	// 6238
+	{ 108267, "Function sfxgamempcontent.sfxwave_operation.DelayedFinishWave" },	// 6239
+	{ 108269, "Function sfxgamempcontent.sfxwave_operation.RateEnemyStart" },	// 6240
+	{ 108283, "Function sfxgamempcontent.sfxwave_operation.DetermineObjectivesToSpawn" },	// 6241
+	{ 108299, "Function sfxgamempcontent.sfxwave_operation.PawnDowned" },	// 6242
+	{ 108303, "Function sfxgamempcontent.sfxwave_operation.PawnRevived" },	// 6243
+	{ 108307, "Function sfxgamempcontent.sfxwave_operation.ActivateObjectiveCombatZone" },	// 6244
+	{ 108312, "Function sfxgamempcontent.sfxwave_operation.PawnDestroyed" },	// 6245
+	{ 108313, "Function sfxgamempcontent.sfxwave_operation.DeactivateObjectiveCombatZone" },	// 6246
+	{ 108318, "Function sfxgamempcontent.sfxwave_operation.BeginWaveTimeLimit" },	// 6247
+	{ 108322, "Function sfxgamempcontent.sfxwave_operation.SetTimeLimit" },	// 6248
+	{ 108326, "Function sfxgamempcontent.sfxwave_operation.LocalPlayerTimeWarningHint" },	// 6249
+	{ 108329, "Function sfxgamempcontent.sfxwave_operation.CancelCountdownTimer" },	// 6250
+	{ 108331, "Function sfxgamempcontent.sfxwave_operation.CountdownTimerExpired" },	// 6251
+	{ 108333, "Function sfxgamempcontent.sfxwave_operation.DistributeObjectiveScore" },	// 6252
+	{ 108348, "Function sfxgamempcontent.sfxwave_operation.GetCreditBudget" },	// 6253
+	{ 108350, "Function sfxgamempcontent.sfxwave_operation.GetCreditsReward" },	// 6254
+	{ 108353, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.GetCreditScaling" },	// 6255
+	{ 108366, "Class sfxgamempcontent.SFXEngagement_Annex" },	// 6256
+	{ 108369, "Function sfxgamempcontent.SFXEngagement_Annex.SetTimeLimit" },	// 6257
+	{ 108373, "Function sfxgamempcontent.SFXEngagement_Annex.FinishWave" },	// 6258
+	{ 108376, "Function sfxgamempcontent.SFXEngagement_Annex.GetAnnexZoneLocation" },	// 6259
+	{ 108383, "Class sfxgamempcontent.SFXEngagement_Assassination" },	// 6260
+	{ 108384, "Function sfxgamempcontent.SFXEngagement_Assassination.BeginWave" },	// 6261
+	{ 108386, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.PlayAssassinationVOEvent" },	// 6262
+	{ 108389, "Function sfxgamempcontent.SFXEngagement_Assassination.FinishWave" },	// 6263
+	{ 108391, "Class sfxgamempcontent.SFXObjective_AssassinationBase" },	// 6264
+	{ 108392, "Function sfxgamempcontent.SFXEngagement_Assassination.GetAssassinationObjective" },	// 6265
+	{ 108395, "Function sfxgamempcontent.SFXEngagement_Assassination.ChooseAssassinationTarget" },	// 6266
+	{ 108403, "Function sfxgamempcontent.SFXEngagement_Assassination.SetAssassinationTarget" },	// 6267
+	{ 108407, "Function sfxgamempcontent.SFXEngagement_Assassination.PawnSpawned" },	// 6268
+	{ 108411, "Function sfxgamempcontent.SFXEngagement_Assassination.PawnDied" },	// 6269
+	{ 108415, "Function sfxgamempcontent.SFXEngagement_Assassination.PlayWaveStartedInstructionsVO" },	// 6270
+	{ 108417, "Function sfxgamempcontent.sfxoperationobjective.PlayPlayerAcknowledgment" },	// 6271
+	{ 108419, "Class sfxgamempcontent.SFXEngagement_Disarm" },	// 6272
+	{ 108422, "Function sfxgamempcontent.SFXEngagement_Disarm.BeginWave" },	// 6273
+	{ 108426, "Function sfxgamempcontent.sfxoperationobjective.PlayMeshSpecificVOLine" },	// 6274
+	{ 108429, "Function sfxgamempcontent.SFXEngagement_Disarm.SetTimeLimit" },	// 6275
+	{ 108431, "Function sfxgamempcontent.SFXEngagement_Disarm.CancelCountdownTimer" },	// 6276
+	{ 108432, "Function sfxgamempcontent.SFXEngagement_Disarm.PlayVOEvent" },	// 6277
+	{ 108434, "Function sfxgamempcontent.SFXEngagement_Disarm.PlayWaveInstructions" },	// 6278
+	{ 108435, "Function sfxgamempcontent.SFXEngagement_Disarm.PlayInstructionReminder" },	// 6279
+	{ 108436, "Function sfxgamempcontent.SFXEngagement_Disarm.PlayTimeWarning" },	// 6280
+	{ 108437, "Function sfxgamempcontent.SFXEngagement_Disarm.OnBombDisarmed" },	// 6281
+	{ 108449, "Function sfxgamempcontent.SFXEngagement_Disarm.ActivateNextBomb" },	// 6282
+	{ 108451, "Function sfxgamempcontent.SFXEngagement_Disarm.ActivateRandomBomb" },	// 6283
+	{ 108454, "Function sfxgamempcontent.SFXEngagement_Disarm.FinishWave" },	// 6284
+	{ 108459, "Class sfxgamempcontent.SFXEngagement_Extraction" },	// 6285
+	{ 108464, "Class sfxgamempcontent.SFXEngagement_Retrieve" },	// 6286
+	{ 108469, "Function sfxgamempcontent.SFXEngagement_Retrieve.BeginWave" },	// 6287
+	{ 108471, "Function sfxgamempcontent.SFXEngagement_Retrieve.ActivateRandomPickup" },	// 6288
+	{ 108474, "Function sfxgamempcontent.SFXEngagement_Retrieve.UpdateObjectiveStatus" },	// 6289
+	{ 108476, "Function sfxgamempcontent.SFXEngagement_Retrieve.IsCarryingPickup" },	// 6290
+	{ 108479, "Function sfxgamempcontent.SFXEngagement_Retrieve.PlayerPickedUpObject" },	// 6291
+	{ 108481, "Function sfxgamempcontent.SFXEngagement_Retrieve.PlayerDroppedObject" },	// 6292
+	{ 108483, "Function sfxgamempcontent.SFXEngagement_Retrieve.PickupDroppedOff" },	// 6293
+	{ 108493, "Class sfxgamempcontent.SFXGameConfigMP" },	// 6294
+	{ 108500, "Class sfxgamempcontent.sfxgameeffect_matchconsumablebase" },	// 6295
+	{ 108501, "Function sfxgamempcontent.sfxgameeffect_matchconsumablebase.OnApplied" },	// 6296
+	{ 108505, "Function sfxgamempcontent.sfxgameeffect_matchconsumablebase.Consume" },	// 6297
+	{ 108510, "Class sfxgamempcontent.SFXGameInfoMP" },	// 6298
+	{ 108515, "Function sfxgamempcontent.SFXGameInfoMP.PreBeginPlay" },	// 6299
+	{ 108518, "Class sfxgamempcontent.sfxhostmigrationmp" },	// 6300
+	{ 108519, "Function sfxgamempcontent.SFXGameInfoMP.PostBeginPlay" },	// 6301
+	{ 108520, "Function sfxgamempcontent.SFXGameInfoMP.Tick" },	// 6302
+	{ 108522, "Function sfxgamempcontent.SFXGameInfoMP.FindPlayerStart" },	// 6303
+	{ 108534, "Function sfxgamempcontent.SFXGameInfoMP.SpawnDefaultPawnFor" },	// 6304
+	{ 108544, "Function sfxgamempcontent.sfxprimp.GetPawnArchetype" },	// 6305
+	{ 108547, "Function sfxgamempcontent.sfxprimp.GetCharacterKit" },	// 6306
+	{ 108549, "Function sfxgamempcontent.SFXGameInfoMP.RateBioPlayerStart" },	// 6307
+	{ 108557, "Function sfxgamempcontent.SFXGameInfoMP.RatePlayerStart" },	// 6308
+	{ 108565, "Function sfxgamempcontent.SFXGameInfoMP.RestartPlayer" },	// 6309
+	{ 108569, "Function sfxgamempcontent.SFXGameInfoMP.IsRestarting" },	// 6310
+	{ 108570, "Function sfxgamempcontent.sfxplayercontrollermp.PawnNeedsCleanup" },	// 6311
+	{ 108572, "Function sfxgamempcontent.SFXGameInfoMP.RestartPlayerAsync" },	// 6312
+	{ 108575, "Function sfxgamempcontent.sfxprimp.GetAsyncLoadingStatus" },	// 6313
+	{ 108577, "Function sfxgamempcontent.SFXGameInfoMP.TickRestartPlayerAsync" },	// 6314
+	{ 108586, "Function sfxgamempcontent.SFXGameInfoMP.AreAllPlayersDeath" },	// 6315
+	{ 108589, "Function sfxgamempcontent.SFXGameInfoMP.StartMatch" },	// 6316
+	{ 108590, "Function sfxgamempcontent.SFXGameInfoMP.RestartMatch" },	// 6317
+	{ 108591, "Function sfxgamempcontent.SFXGameInfoMP.EndMatch" },	// 6318
+	{ 108592, "Function sfxgamempcontent.SFXGameInfoMP.QuitToLobby" },	// 6319
+	{ 108594, "Function sfxgamempcontent.SFXGameInfoMP.QuitToMainMenu" },	// 6320
+	{ 108595, "Function sfxgamempcontent.SFXGameInfoMP.RegisterServer" },	// 6321
+	{ 108608, "Function sfxgamempcontent.sfxhostmigrationmp.IsReadyToStartMatch" },	// 6322
+	{ 108643, "Function sfxgamempcontent.sfxgrimp.GetScoreManager" },	// 6323
+	{ 108650, "Function sfxgamempcontent.SFXGameInfoMP.GetSeamlessTravelActorList" },	// 6324
+	{ 108655, "Function sfxgamempcontent.SFXGameInfoMP.OnPlayerSquadDeath" },	// 6325
+	{ 108656, "Function sfxgamempcontent.SFXGameInfoMP.PreventPermanentDeath" },	// 6326
+	{ 108659, "Function sfxgamempcontent.SFXGameInfoMP.FindInactivePRI" },	// 6327
+	{ 108662, "Function sfxgamempcontent.SFXGameInfoMP.Logout" },	// 6328
+	{ 108665, "Function sfxgamempcontent.SFXGameInfoMP.GenericPlayerInitialization" },	// 6329
+	{ 108667, "Function sfxgamempcontent.SFXGameInfoMP.SpawnEnemySquad" },	// 6330
+	{ 108669, "Function sfxgamempcontent.SFXGameInfoMP.RegisterJoinInProgressDelegate" },	// 6331
+	{ 108671, "Function sfxgamempcontent.SFXGameInfoMP.UnRegisterJoinInProgressDelegate" },	// 6332
+	{ 108673, "Function sfxgamempcontent.SFXGameInfoMP.CallJoinInProgressDelegates" },	// 6333
+	{ 108675, "Function sfxgamempcontent.SFXGameInfoMP.ClearCrossLevelReferences" },	// 6334
+	{ 108692, "Class sfxgamempcontent.sfxgui_mpendofmatch" },	// 6335
+	{ 108693, "Class sfxgamempcontent.sfxguimoviemp" },	// 6336
+	{ 108694, "Class sfxgamempcontent.sfxgui_mppausemenu" },	// 6337
+	{ 108695, "Class sfxgamempcontent.SFXGUI_MPOptions" },	// 6338
+	{ 108696, "Class sfxgamempcontent.SFXGUI_PCMPOptions" },	// 6339
+	{ 108697, "Class sfxgamempcontent.sfxgui_mpreinforcementsreveal" },	// 6340
+	{ 108698, "Class sfxgamempcontent.SFXGUI_MPHUD" },	// 6341
+	{ 108708, "Class sfxgamempcontent.SFXHUDMP" },	// 6342
+	{ 108709, "Class sfxgamempcontent.sfxgameinfomp_lobby" },	// 6343
+	{ 108710, "Function sfxgamempcontent.sfxgameinfomp_lobby.GetPC" },	// 6344
+	{ 108713, "Function sfxgamempcontent.sfxgameinfomp_lobby.GetOnlineGameSettings" },	// 6345
+	{ 108715, "Function sfxgamempcontent.sfxgameinfomp_lobby.PostBeginPlay" },	// 6346
+	{ 108716, "Function sfxgamempcontent.sfxgameinfomp_lobby.ClearCrossLevelReferences" },	// 6347
+	{ 108717, "Function sfxgamempcontent.sfxgameinfomp_lobby.DeferredPostBeginPlay" },	// 6348
+	{ 108718, "Class sfxgamempcontent.sfxgrimp_lobby" },	// 6349
+	{ 108720, "Function sfxgamempcontent.sfxgameinfomp_lobby.Tick" },	// 6350
+	{ 108723, "Function sfxgamempcontent.sfxgameinfomp_lobby.IsMatchTimerRunning" },	// 6351
+	{ 108725, "Function sfxgamempcontent.sfxgrimp_lobby.SetMatchStartTimer" },	// 6352
+	{ 108727, "Function sfxgamempcontent.sfxgameinfomp_lobby.RestartPlayer" },	// 6353
+	{ 108729, "Function sfxgamempcontent.sfxgameinfomp_lobby.CheckAllPlayersReady" },	// 6354
+	{ 108733, "Function sfxgamempcontent.sfxgrimp_lobby.GetNumReadyPlayers" },	// 6355
+	{ 108735, "Function sfxgamempcontent.sfxgrimp_lobby.GetNumPlayers" },	// 6356
+	{ 108737, "Function sfxgamempcontent.sfxgrimp_lobby.CanForceLastManReady" },	// 6357
+	{ 108739, "Function sfxgamempcontent.sfxgameinfomp_lobby.TravelToNextMap" },	// 6358
+	{ 108742, "Function sfxgamempcontent.sfxgameinfomp_lobby.SetMatchTimerState" },	// 6359
+	{ 108744, "Function sfxgamempcontent.sfxgameinfomp_lobby.CommitSettings" },	// 6360
+	{ 108753, "Function sfxgamempcontent.sfxgameinfomp_lobby.UnCommitSettings" },	// 6361
+	{ 108755, "Function sfxgamempcontent.sfxgameinfomp_lobby.ChangeMatchSettings" },	// 6362
+	{ 108771, "Function sfxgamempcontent.sfxgameinfomp_lobby.ChooseRandomMap" },	// 6363
+	{ 108780, "Class sfxgamempcontent.sfxlobbyflow" },	// 6364
+	{ 108781, "Function sfxgamempcontent.sfxlobbyflow.GetAvailableMapList" },	// 6365
+	{ 108784, "Function sfxgamempcontent.sfxgameinfomp_lobby.ChooseRandomEnemy" },	// 6366
+	{ 108795, "Class sfxgamempcontent.sfxwavemanager_horde" },	// 6367
+	{ 108801, "Function sfxgamempcontent.sfxgameinfomp_lobby.StartMPMatch" },	// 6368
+	{ 108812, "Function sfxgamempcontent.sfxgameinfomp_lobby.CreateOnlineGame" },	// 6369
+	{ 108816, "Function sfxgamempcontent.sfxgameinfomp_lobby.QuickMatch" },	// 6370
+	{ 108820, "Function sfxgamempcontent.sfxgameinfomp_lobby.OnQuickMatchComplete" },	// 6371
+	{ 108823, "Function sfxgamempcontent.sfxgameinfomp_lobby.OnCreateGameComplete" },	// 6372
+	{ 108828, "Function sfxgamempcontent.sfxgameinfomp_lobby.CheckNatRestriction" },	// 6373
+	{ 108832, "Function sfxgamempcontent.sfxgameinfomp_lobby.ShowStrictNatWarning" },	// 6374
+	{ 108836, "Function sfxgamempcontent.sfxgameinfomp_lobby.OnMultiplayerGameDestroyed" },	// 6375
+	{ 108839, "Function sfxgamempcontent.sfxgameinfomp_lobby.OnQuickMatchJoined" },	// 6376
+	{ 108842, "Function sfxgamempcontent.sfxgameinfomp_lobby.OnMPGameStarted" },	// 6377
+	{ 108845, "Function sfxgamempcontent.sfxgameinfomp_lobby.CancelSearchInput" },	// 6378
+	{ 108848, "Function sfxgamempcontent.sfxgameinfomp_lobby.CancelSearch" },	// 6379
+	{ 108849, "Function sfxgamempcontent.sfxgameinfomp_lobby.ShowPrompt" },	// 6380
+	{ 108855, "Function sfxgamempcontent.sfxgameinfomp_lobby.ShowNetworkErrorPrompt" },	// 6381
+	{ 108857, "Function sfxgamempcontent.sfxgameinfomp_lobby.OnMPFatalError" },	// 6382
+	{ 108859, "Function sfxgamempcontent.sfxgameinfomp_lobby.OnMPNetworkError" },	// 6383
+	{ 108861, "Function sfxgamempcontent.sfxgameinfomp_lobby.UpdateKickVotes" },	// 6384
+	{ 108904, "Class sfxgamempcontent.sfxgui_mplobby" },	// 6385
+	{ 108905, "Class sfxgamempcontent.sfxgui_mplobbystatusbars" },	// 6386
+	{ 108906, "Class sfxgamempcontent.sfxgui_mpappearance" },	// 6387
+	{ 108907, "Class sfxgamempcontent.sfxgui_mpselectkit" },	// 6388
+	{ 108908, "Class sfxgamempcontent.sfxgui_mpmatchresults" },	// 6389
+	{ 108909, "Class sfxgamempcontent.sfxgui_mpmatchconsumables" },	// 6390
+	{ 108910, "Class sfxgamempcontent.sfxgui_mpstore" },	// 6391
+	{ 108911, "Class sfxgamempcontent.sfxgui_mppromotion" },	// 6392
+	{ 108952, "Class sfxgamempcontent.sfxpowercustomactionmp_consumable" },	// 6393
+	{ 108974, "Function sfxgamempcontent.SFXGAWReinforcementKitUnlock.OnAwarded" },	// 6394
+	{ 108985, "Function sfxgamempcontent.sfxgawreinforcementmatchconsumable.GetPRI" },	// 6395
+	{ 108991, "Function sfxgamempcontent.sfxgawreinforcementmatchconsumable.FindCardIndexFromID" },	// 6396
+	{ 108999, "Function sfxgamempcontent.sfxgawreinforcementmatchconsumable.IsActive" },	// 6397
+	{ 109005, "Function sfxgamempcontent.sfxgawreinforcementmatchconsumable.Activate" },	// 6398
+	{ 109010, "Function sfxgamempcontent.sfxgawreinforcementmatchconsumable.Deactivate" },	// 6399
+	{ 109015, "Function sfxgamempcontent.sfxgawreinforcementmatchconsumable.GetSlotTypeForCategory" },	// 6400
+	{ 109018, "Function sfxgamempcontent.sfxgawreinforcementmatchconsumable.GetPlayerVariableName" },	// 6401
+	{ 109022, "Function sfxgamempcontent.sfxgawreinforcementmatchconsumable.GetPlayerVariableNameFromCard" },	// 6402
+	{ 109026, "Function sfxgamempcontent.sfxgawreinforcementmatchconsumable.OnAwarded" },	// 6403
+	{ 109035, "Function sfxgamempcontent.sfxgawreinforcementmatchconsumable.TrimTrailingZeroes_NoGear" },	// 6404
+	{ 109048, "Function sfxgamempcontent.sfxgawreinforcementmatchconsumable.FloatToString_NoGear" },	// 6405
+	{ 109053, "Function sfxgamempcontent.sfxgawreinforcementmatchconsumable.FloatToPercentString_NoGear" },	// 6406
+	{ 109056, "Function sfxgamempcontent.sfxgawreinforcementmatchconsumable.FindDescriptionTokens_NoGear" },	// 6407
+	{ 109059, "Function sfxgamempcontent.sfxgawreinforcementmatchconsumable.PrepareCustomTokensForDescription" },	// 6408
+	{ 109093, "Function sfxgamempcontent.sfxgrimp.ReplicatedEvent" },	// 6409
+	{ 109098, "Function sfxgamempcontent.sfxgrimp.PostBeginPlay" },	// 6410
+	{ 109105, "Function sfxgamempcontent.sfxgrimp.SetGameStatus" },	// 6411
+	{ 109107, "Function sfxgamempcontent.sfxgrimp.OnGameStatusChanged" },	// 6412
+	{ 109109, "Function sfxgamempcontent.sfxgrimp.DeferredSetRichPresence" },	// 6413
+	{ 109111, "Function sfxgamempcontent.sfxgrimp.DeferredGrantAccomplishments" },	// 6414
+	{ 109113, "Function sfxgamempcontent.sfxgrimp.NextLivingPlayer" },	// 6415
+	{ 109121, "Function sfxgamempcontent.sfxgrimp.NumLivingPlayers" },	// 6416
+	{ 109127, "Function sfxgamempcontent.sfxgrimp.GetEventTicker" },	// 6417
+	{ 109130, "Function sfxgamempcontent.sfxgrimp.GetActivePlayerIDs" },	// 6418
+	{ 109137, "Function sfxgamempcontent.sfxprimp.IsPlayer" },	// 6419
+	{ 109139, "Function sfxgamempcontent.sfxgrimp.IsJoinInProgress" },	// 6420
+	{ 109141, "Function sfxgamempcontent.sfxgrimp.ClearMatchConsumableGameEffects" },	// 6421
+	{ 109145, "Function sfxgamempcontent.sfxprimp.ClearActiveMatchConsumables" },	// 6422
+	{ 109146, "Function sfxgamempcontent.sfxgrimp.DisplaySquadMedal" },	// 6423
+	{ 109152, "Function sfxgamempcontent.sfxgrimp.IsGameOver" },	// 6424
+	{ 109154, "Function sfxgamempcontent.sfxgrimp.AddSquadMedal" },	// 6425
+	{ 109158, "Function sfxgamempcontent.sfxgrimp.HasSquadMedal" },	// 6426
+	{ 109162, "Function sfxgamempcontent.sfxgrimp.OnSquadMedalsChanged" },	// 6427
+	{ 109165, "Function sfxgamempcontent.sfxgrimp.CopyProperties" },	// 6428
+	{ 109174, "Function sfxgamempcontent.sfxgrimp.GetEnemyWaveTypeID" },	// 6429
+	{ 109176, "Function sfxgamempcontent.sfxgrimp.GetChallengeTypeIndex" },	// 6430
+	{ 109178, "Function sfxgamempcontent.sfxgrimp.GetMapID" },	// 6431
+	{ 109179, "Function sfxgamempcontent.sfxgrimp.OnMissionComplete" },	// 6432
+	{ 109181, "Function sfxgamempcontent.sfxgrimp.RandomMapChosen" },	// 6433
+	{ 109183, "Function sfxgamempcontent.sfxgrimp.RandomFactionChosen" },	// 6434
+	{ 109185, "Function sfxgamempcontent.sfxgrimp.GetTeamScore" },	// 6435
+	{ 109189, "Function sfxgamempcontent.sfxgrimp.AddPRI" },	// 6436
+	{ 109200, "Class sfxgamempcontent.SFXVocalizationManagerMP" },	// 6437
+	{ 109204, "Function sfxgamempcontent.sfxgrimp_lobby.PostBeginPlay" },	// 6438
+	{ 109206, "Function sfxgamempcontent.sfxgrimp_lobby.GetPC" },	// 6439
+	{ 109208, "Function sfxgamempcontent.sfxgrimp_lobby.GetOnlineGameInterface" },	// 6440
+	{ 109211, "Function sfxgamempcontent.sfxgrimp_lobby.ReplicatedEvent" },	// 6441
+	{ 109214, "Function sfxgamempcontent.sfxlobbyflow.RefreshLobbyScreen" },	// 6442
+	{ 109215, "Function sfxgamempcontent.sfxlobbyflow.RefreshLobbyStatusBars" },	// 6443
+	{ 109223, "Function sfxgamempcontent.sfxgrimp_lobby.Tick" },	// 6444
+	{ 109225, "Function sfxgamempcontent.sfxgrimp_lobby.UpdateLobbyTimerSound" },	// 6445
+	{ 109226, "Function sfxgamempcontent.sfxgrimp_lobby.UpdatePlayerListOrder" },	// 6446
+	{ 109230, "Function sfxgamempcontent.sfxgrimp_lobby.UpdateMapArrays" },	// 6447
+	{ 109232, "Function sfxgamempcontent.sfxgrimp_lobby.BuildCombinedMapArray" },	// 6448
+	{ 109233, "Function sfxgamempcontent.sfxlobbyflow.DoesEveryoneHaveMap" },	// 6449
+	{ 109235, "Function sfxgamempcontent.sfxgrimp_lobby.ShowMapChangedDueToDLCMismatchPopup" },	// 6450
+	{ 109246, "Function sfxgamempcontent.sfxgrimp_lobby.CanInteract" },	// 6451
+	{ 109248, "Function sfxgamempcontent.sfxgrimp_lobby.GetLobbyStatusString" },	// 6452
+	{ 109255, "Function sfxgamempcontent.sfxgrimp_lobby.UnreadyAllPlayers" },	// 6453
+	{ 109276, "Function sfxgamempcontent.sfxgrimp_lobby.ReturnToMainMenu" },	// 6454
+	{ 109277, "Function sfxgamempcontent.sfxgrimp_lobby.IsPrivateMatch" },	// 6455
+	{ 109279, "Function sfxgamempcontent.sfxgrimp_lobby.IsMultiplayerGame" },	// 6456
+	{ 109281, "Function sfxgamempcontent.sfxgrimp_lobby.GetPrivacy" },	// 6457
+	{ 109282, "Function sfxgamempcontent.sfxgrimp_lobby.GetMapInfo" },	// 6458
+	{ 109285, "Function sfxgamempcontent.sfxgrimp_lobby.GetEnemyTypes" },	// 6459
+	{ 109288, "Function sfxgamempcontent.sfxgrimp_lobby.GetChallengeTypes" },	// 6460
+	{ 109291, "Function sfxgamempcontent.sfxgrimp_lobby.SaveDataForHostMigration" },	// 6461
+	{ 109293, "Function sfxgamempcontent.sfxgrimp_lobby.CopyProperties" },	// 6462
+	{ 109308, "Function sfxgamempcontent.sfxprimp.GetStoreIsOpen" },	// 6463
+	{ 109406, "Function sfxgamempcontent.sfxgui_mpappearance.OnStart" },	// 6464
+	{ 109422, "Function sfxgamempcontent.sfxgui_mpappearance.OnClose" },	// 6465
+	{ 109423, "Function sfxgamempcontent.sfxgui_mpappearance.GetOriginalCharacterName" },	// 6466
+	{ 109426, "Function sfxgamempcontent.sfxgui_mpappearance.GetTint1SwatchData" },	// 6467
+	{ 109429, "Function sfxgamempcontent.sfxgui_mpappearance.GetTint2SwatchData" },	// 6468
+	{ 109432, "Function sfxgamempcontent.sfxgui_mpappearance.GetPatternData" },	// 6469
+	{ 109435, "Function sfxgamempcontent.sfxgui_mpappearance.GetPatternColorSwatchData" },	// 6470
+	{ 109438, "Function sfxgamempcontent.sfxgui_mpappearance.GetPhongSwatchData" },	// 6471
+	{ 109441, "Function sfxgamempcontent.sfxgui_mpappearance.GetEmissiveSwatchData" },	// 6472
+	{ 109444, "Function sfxgamempcontent.sfxgui_mpappearance.GetSkinToneSwatchData" },	// 6473
+	{ 109447, "Function sfxgamempcontent.sfxgui_mpappearance.GetIdxByAppearanceID" },	// 6474
+	{ 109455, "Function sfxgamempcontent.sfxgui_mpappearance.BackButtonPressed" },	// 6475
+	{ 109456, "Function sfxgamempcontent.sfxlobbyflow.IsInDeployFlow" },	// 6476
+	{ 109458, "Function sfxgamempcontent.sfxgui_mpappearance.ConfirmButtonPressed" },	// 6477
+	{ 109459, "Function sfxgamempcontent.sfxgui_mpappearance.CancelScreen" },	// 6478
+	{ 109465, "Function sfxgamempcontent.sfxgui_mpappearance.CancelConfirmCallback" },	// 6479
+	{ 109468, "Function sfxgamempcontent.sfxgui_mpappearance.ResetPawn" },	// 6480
+	{ 109470, "Function sfxgamempcontent.sfxgui_mpappearance.DisplayCharacterNameErrorBox" },	// 6481
+	{ 109471, "Function sfxgamempcontent.sfxgui_mpappearance.SetInitialPawnPosition" },	// 6482
+	{ 109474, "Function sfxgamempcontent.sfxgui_mpappearance.ApplyTinting" },	// 6483
+	{ 109478, "Function sfxgamempcontent.sfxgui_mpappearance.ChangePawnTint1" },	// 6484
+	{ 109480, "Function sfxgamempcontent.sfxgui_mpappearance.ChangeTint1Selection" },	// 6485
+	{ 109482, "Function sfxgamempcontent.sfxgui_mpappearance.GetSelectedTint1ID" },	// 6486
+	{ 109484, "Function sfxgamempcontent.sfxgui_mpappearance.ChangePawnTint2" },	// 6487
+	{ 109486, "Function sfxgamempcontent.sfxgui_mpappearance.ChangeTint2Selection" },	// 6488
+	{ 109488, "Function sfxgamempcontent.sfxgui_mpappearance.GetSelectedTint2ID" },	// 6489
+	{ 109490, "Function sfxgamempcontent.sfxgui_mpappearance.ChangePawnPatternColor" },	// 6490
+	{ 109492, "Function sfxgamempcontent.sfxgui_mpappearance.ChangePatternColorSelection" },	// 6491
+	{ 109494, "Function sfxgamempcontent.sfxgui_mpappearance.GetSelectedPatternColorID" },	// 6492
+	{ 109496, "Function sfxgamempcontent.sfxgui_mpappearance.ChangePawnPattern" },	// 6493
+	{ 109498, "Function sfxgamempcontent.sfxgui_mpappearance.ChangePatternSelection" },	// 6494
+	{ 109500, "Function sfxgamempcontent.sfxgui_mpappearance.GetSelectedPatternID" },	// 6495
+	{ 109502, "Function sfxgamempcontent.sfxgui_mpappearance.ChangePawnPhong" },	// 6496
+	{ 109504, "Function sfxgamempcontent.sfxgui_mpappearance.ChangePhongSelection" },	// 6497
+	{ 109506, "Function sfxgamempcontent.sfxgui_mpappearance.GetSelectedPhongID" },	// 6498
+	{ 109508, "Function sfxgamempcontent.sfxgui_mpappearance.ChangePawnEmissive" },	// 6499
+	{ 109510, "Function sfxgamempcontent.sfxgui_mpappearance.ChangeEmissiveSelection" },	// 6500
+	{ 109512, "Function sfxgamempcontent.sfxgui_mpappearance.GetSelectedEmissiveID" },	// 6501
+	{ 109514, "Function sfxgamempcontent.sfxgui_mpappearance.ChangePawnSkinTone" },	// 6502
+	{ 109516, "Function sfxgamempcontent.sfxgui_mpappearance.ChangeSkinToneSelection" },	// 6503
+	{ 109518, "Function sfxgamempcontent.sfxgui_mpappearance.GetSelectedSkinToneID" },	// 6504
+	{ 109520, "Function sfxgamempcontent.sfxgui_mpappearance.ShowKeyboard" },	// 6505
+	{ 109524, "Function sfxgamempcontent.sfxgui_mpappearance.KeyboardNameEntryComplete" },	// 6506
+	{ 109528, "Function sfxgamempcontent.sfxgui_mpappearance.SetCharacterName" },	// 6507
+	{ 109530, "Function sfxgamempcontent.sfxgui_mpappearance.ResetScreenInfo" },	// 6508
+	{ 109531, "Function sfxgamempcontent.sfxgui_mpappearance.ResetPawnToLastSelection" },	// 6509
+	{ 109532, "Function sfxgamempcontent.sfxgui_mpappearance.GetSelectedCharacterName" },	// 6510
+	{ 109534, "Function sfxgamempcontent.sfxgui_mpappearance.GetSelectedCharacterClassAndLevel" },	// 6511
+	{ 109538, "Function sfxgamempcontent.sfxgui_mpappearance.GetSelectedKitName" },	// 6512
+	{ 109540, "Function sfxgamempcontent.sfxgui_mpappearance.GetMaxCharacterNameLength" },	// 6513
+	{ 109550, "Function sfxgamempcontent.sfxgui_mpappearance.NameErrorCallback" },	// 6514
+	{ 109553, "Function sfxgamempcontent.sfxgui_mpappearance.IsInDeployFlow" },	// 6515
+	{ 109555, "Function sfxgamempcontent.sfxgui_mpappearance.GetTint1State" },	// 6516
+	{ 109558, "Function sfxgamempcontent.sfxgui_mpappearance.GetTint2State" },	// 6517
+	{ 109561, "Function sfxgamempcontent.sfxgui_mpappearance.GetPatternState" },	// 6518
+	{ 109564, "Function sfxgamempcontent.sfxgui_mpappearance.GetPatternColorState" },	// 6519
+	{ 109567, "Function sfxgamempcontent.sfxgui_mpappearance.GetPhongState" },	// 6520
+	{ 109570, "Function sfxgamempcontent.sfxgui_mpappearance.GetEmissiveState" },	// 6521
+	{ 109573, "Function sfxgamempcontent.sfxgui_mpappearance.GetSkinToneState" },	// 6522
+	{ 109576, "Function sfxgamempcontent.sfxgui_mpappearance.GetMenuItemState" },	// 6523
+	{ 109579, "Function sfxgamempcontent.sfxgui_mpappearance.CanShowPrimaryColor" },	// 6524
+	{ 109581, "Function sfxgamempcontent.sfxgui_mpappearance.CanShowSecondaryColor" },	// 6525
+	{ 109583, "Function sfxgamempcontent.sfxgui_mpappearance.CanShowPattern" },	// 6526
+	{ 109585, "Function sfxgamempcontent.sfxgui_mpappearance.CanShowPatternColor" },	// 6527
+	{ 109587, "Function sfxgamempcontent.sfxgui_mpappearance.CanShowPhong" },	// 6528
+	{ 109589, "Function sfxgamempcontent.sfxgui_mpappearance.CanShowEmissive" },	// 6529
+	{ 109591, "Function sfxgamempcontent.sfxgui_mpappearance.CanShowSkinTone" },	// 6530
+	{ 109593, "Function sfxgamempcontent.sfxgui_mpappearance.HandleInputEvent" },	// 6531
+	{ 109599, "Function sfxgamempcontent.sfxgui_mpappearance.Update" },	// 6532
+	{ 109604, "Function sfxgamempcontent.sfxgui_mpappearance.AS_AddTintSwatch" },	// 6533
+	{ 109609, "Function sfxgamempcontent.sfxgui_mpappearance.AS_RefreshCharacterName" },	// 6534
+	{ 109611, "Function sfxgamempcontent.sfxgui_mpappearance.AS_InitializeScreen" },	// 6535
+	{ 109612, "Function sfxgamempcontent.sfxgui_mpappearance.AS_RefreshCurrentMenuItem" },	// 6536
+	{ 109613, "Function sfxgamempcontent.sfxgui_mpappearance.AS_SetFocusToNameField" },	// 6537
+	{ 109616, "Function sfxgamempcontent.sfxgui_mpendofmatch.OnStart" },	// 6538
+	{ 109617, "Function sfxgamempcontent.sfxgui_mpendofmatch.GetOverallMatchResults" },	// 6539
+	{ 109618, "Function sfxgamempcontent.sfxgui_mpendofmatch.OnClose" },	// 6540
+	{ 109619, "Function sfxgamempcontent.sfxgui_mpendofmatch.GetMatchResults" },	// 6541
+	{ 109632, "Function sfxgamempcontent.sfxgui_mpendofmatch.GetHintText" },	// 6542
+	{ 109657, "Function sfxgamempcontent.SFXGUI_MPHUD.OnStart" },	// 6543
+	{ 109672, "Function sfxgamempcontent.SFXGUI_MPHUD.InitTickerMovie" },	// 6544
+	{ 109673, "Function sfxgamempcontent.SFXGUI_MPHUD.SetObjectiveText" },	// 6545
+	{ 109676, "Function sfxgamempcontent.SFXGUI_MPHUD.OnClose" },	// 6546
+	{ 109678, "Function sfxgamempcontent.SFXGUI_MPHUD.Update" },	// 6547
+	{ 109687, "Function sfxgamempcontent.SFXGUI_MPHUD.AS_HideSpectatorHUD" },	// 6548
+	{ 109688, "Function sfxgamempcontent.SFXGUI_MPHUD.ClearTickerEntries" },	// 6549
+	{ 109689, "Function sfxgamempcontent.SFXGUI_MPHUD.SetPowersVisible" },	// 6550
+	{ 109691, "Function sfxgamempcontent.SFXGUI_MPHUD.ShowDPadPowerIcons" },	// 6551
+	{ 109692, "Function sfxgamempcontent.SFXGUI_MPHUD.ShowSpectatorHUD" },	// 6552
+	{ 109693, "Function sfxgamempcontent.SFXGUI_MPHUD.HideDPadPowerIcons" },	// 6553
+	{ 109694, "Function sfxgamempcontent.SFXGUI_MPHUD.UpdateDPad" },	// 6554
+	{ 109695, "Function sfxgamempcontent.SFXGUI_MPHUD.UpdateCenterPowerIcons" },	// 6555
+	{ 109696, "Function sfxgamempcontent.SFXGUI_MPHUD.UpdateTickers" },	// 6556
+	{ 109697, "Function sfxgamempcontent.SFXGUI_MPHUD.UpdateCountdownTimer" },	// 6557
+	{ 109698, "Function sfxgamempcontent.SFXGUI_MPHUD.UpdateCenterProgressBar" },	// 6558
+	{ 109699, "Function sfxgamempcontent.SFXGUI_MPHUD.UpdateObjectiveCircles" },	// 6559
+	{ 109700, "Function sfxgamempcontent.SFXGUI_MPHUD.Initialize" },	// 6560
+	{ 109701, "Function sfxgamempcontent.SFXGUI_MPHUD.InitializeDPadPowerIcons" },	// 6561
+	{ 109702, "Function sfxgamempcontent.SFXGUI_MPHUD.InitializeCenterPowerIcons" },	// 6562
+	{ 109710, "Class sfxgamempcontent.sfxpowercustomactionmp_consumable_rocket" },	// 6563
+	{ 109711, "Class sfxgamempcontent.sfxpowercustomactionmp_consumable_shield" },	// 6564
+	{ 109712, "Class sfxgamempcontent.sfxpowercustomactionmp_consumable_ammo" },	// 6565
+	{ 109713, "Class sfxgamempcontent.sfxpowercustomactionmp_consumable_revive" },	// 6566
+	{ 109715, "Function sfxgamempcontent.SFXGUI_MPHUD.AS_SetDPadVisible" },	// 6567
+	{ 109717, "Function sfxgamempcontent.SFXGUI_MPHUD.UpdateDPadPowerIcons" },	// 6568
+	{ 109724, "Function sfxgamempcontent.SFXGUI_MPHUD.OnControllerProfileSettingChange" },	// 6569
+	{ 109728, "Function sfxgamempcontent.SFXGUI_MPHUD.AS_SetPowerMapVisible" },	// 6570
+	{ 109729, "Function sfxgamempcontent.SFXGUI_MPHUD.OnPawnPowerUsed" },	// 6571
+	{ 109737, "Function sfxgamempcontent.SFXGUI_MPHUD.AcquireNewTickerEntries" },	// 6572
+	{ 109739, "Function sfxgamempcontent.SFXGUI_MPHUD.AS_FadeTickerBar" },	// 6573
+	{ 109742, "Function sfxgamempcontent.SFXGUI_MPHUD.AddTickerEntry" },	// 6574
+	{ 109747, "Function sfxgamempcontent.SFXGUI_MPHUD.ResetTickerMovie" },	// 6575
+	{ 109748, "Function sfxgamempcontent.SFXGUI_MPHUD.AS_SetTickerText" },	// 6576
+	{ 109751, "Function sfxgamempcontent.SFXGUI_MPHUD.AS_ResetTickerBar" },	// 6577
+	{ 109752, "Function sfxgamempcontent.SFXGUI_MPHUD.OnTickerFadeComplete" },	// 6578
+	{ 109761, "Function sfxgamempcontent.SFXGUI_MPHUD.SetTimerText" },	// 6579
+	{ 109764, "Function sfxgamempcontent.SFXGUI_MPHUD.AS_SetTimerPulse" },	// 6580
+	{ 109767, "Function sfxgamempcontent.SFXGUI_MPHUD.StartCountdownTimer" },	// 6581
+	{ 109770, "Function sfxgamempcontent.SFXGUI_MPHUD.AS_SetTimerVisible" },	// 6582
+	{ 109771, "Function sfxgamempcontent.SFXGUI_MPHUD.CancelCountdownTimer" },	// 6583
+	{ 109774, "Function sfxgamempcontent.SFXGUI_MPHUD.SetObjectiveBarVisible" },	// 6584
+	{ 109775, "Function sfxgamempcontent.SFXGUI_MPHUD.SetObjectiveCirclesVisible" },	// 6585
+	{ 109778, "Function sfxgamempcontent.SFXGUI_MPHUD.AS_SetObjectiveVisible" },	// 6586
+	{ 109779, "Function sfxgamempcontent.SFXGUI_MPHUD.SetBoostAnimOn" },	// 6587
+	{ 109782, "Function sfxgamempcontent.SFXGUI_MPHUD.SetObjectiveBarProgress" },	// 6588
+	{ 109790, "Function sfxgamempcontent.SFXGUI_MPHUD.SetObjectiveCircleText" },	// 6589
+	{ 109795, "Function sfxgamempcontent.SFXGUI_MPHUD.SetObjectiveCircleProgress" },	// 6590
+	{ 109799, "Function sfxgamempcontent.SFXGUI_MPHUD.SetCurrentObjectiveCircleCompletion" },	// 6591
+	{ 109801, "Function sfxgamempcontent.SFXGUI_MPHUD.PlayerIsUsingObjectiveWithTime" },	// 6592
+	{ 109805, "Function sfxgamempcontent.SFXGUI_MPHUD.PlayerIsFinishedWithObjective" },	// 6593
+	{ 109808, "Function sfxgamempcontent.SFXGUI_MPHUD.ShowCenterProgressBar" },	// 6594
+	{ 109813, "Function sfxgamempcontent.SFXGUI_MPHUD.AS_SetProgressBarVisible" },	// 6595
+	{ 109814, "Function sfxgamempcontent.SFXGUI_MPHUD.HideCenterProgressBar" },	// 6596
+	{ 109818, "Function sfxgamempcontent.SFXGUI_MPHUD.DisplaySubareaText" },	// 6597
+	{ 109821, "Function sfxgamempcontent.SFXGUI_MPHUD.AS_DisplaySubareaText" },	// 6598
+	{ 109824, "Function sfxgamempcontent.SFXGUI_MPHUD.AS_ShowSpectatorHUD" },	// 6599
+	{ 109893, "Function sfxgamempcontent.sfxgui_mplobby.OnStart" },	// 6600
+	{ 109894, "Function sfxgamempcontent.sfxgui_mplobby.PreloadLobbyImages" },	// 6601
+	{ 109895, "Function sfxgamempcontent.sfxgui_mplobby.IsUIWorldPawnRequired" },	// 6602
+	{ 109897, "Function sfxgamempcontent.sfxgui_mplobby.SetupUIWorldPawn" },	// 6603
+	{ 109898, "Function sfxgamempcontent.sfxgui_mplobby.GetPreviousSubScreen" },	// 6604
+	{ 109899, "Function sfxgamempcontent.sfxgui_mplobby.ClearAllNewWeaponNotifications" },	// 6605
+	{ 109900, "Function sfxgamempcontent.sfxgui_mplobby.Refresh" },	// 6606
+	{ 109902, "Function sfxgamempcontent.sfxgui_mplobby.OnClose" },	// 6607
+	{ 109903, "Function sfxgamempcontent.sfxgui_mplobby.CleanupUIWorldPawn" },	// 6608
+	{ 109904, "Function sfxgamempcontent.sfxgui_mplobby.Update" },	// 6609
+	{ 109907, "Function sfxgamempcontent.sfxgui_mplobby.IsInParty" },	// 6610
+	{ 109909, "Function sfxgamempcontent.sfxgui_mplobby.CanInteract" },	// 6611
+	{ 109911, "Function sfxgamempcontent.sfxgui_mplobby.RefreshAllSpeakerIcons" },	// 6612
+	{ 109912, "Function sfxgamempcontent.sfxgui_mplobby.OnGAWRequestFinished" },	// 6613
+	{ 109918, "Function sfxgamempcontent.sfxgui_mplobby.AS_RefreshGalaxyAtWarMap" },	// 6614
+	{ 109919, "Function sfxgamempcontent.sfxgui_mplobby.HasGAWRatingsError" },	// 6615
+	{ 109921, "Function sfxgamempcontent.sfxgui_mplobby.GetGAWRatings" },	// 6616
+	{ 109927, "Function sfxgamempcontent.sfxgui_mplobby.AS_RefreshScreen" },	// 6617
+	{ 109936, "Function sfxgamempcontent.sfxgui_mplobby.AS_RefreshAllSpeakerIcons" },	// 6618
+	{ 109940, "Function sfxgamempcontent.sfxgui_mplobby.SetInitialPawnPosition" },	// 6619
+	{ 109944, "Function sfxgamempcontent.sfxgui_mplobby.ApplyTinting" },	// 6620
+	{ 109949, "Function sfxgamempcontent.sfxgui_mplobby.AS_OnTabLoaded" },	// 6621
+	{ 109951, "Function sfxgamempcontent.sfxgui_mplobby.AS_GetPrivacySetting" },	// 6622
+	{ 109953, "Function sfxgamempcontent.sfxgui_mplobby.AS_GetMapSetting" },	// 6623
+	{ 109955, "Function sfxgamempcontent.sfxgui_mplobby.AS_GetEnemySetting" },	// 6624
+	{ 109957, "Function sfxgamempcontent.sfxgui_mplobby.AS_GetChallengeSetting" },	// 6625
+	{ 109961, "Function sfxgamempcontent.sfxgui_mplobby.AS_ExitLobbyCancelled" },	// 6626
+	{ 109962, "Function sfxgamempcontent.sfxgui_mplobby.AS_ExitMultiplayerCancelled" },	// 6627
+	{ 109963, "Function sfxgamempcontent.sfxgui_mplobby.GetCurrentLobbyTab" },	// 6628
+	{ 109965, "Function sfxgamempcontent.sfxgui_mplobby.LoadTab" },	// 6629
+	{ 109971, "Function sfxgamempcontent.sfxgui_mplobby.GetLobbyStatus" },	// 6630
+	{ 109973, "Function sfxgamempcontent.sfxgui_mplobby.GetLobbyStatusString" },	// 6631
+	{ 109975, "Function sfxgamempcontent.sfxgui_mplobby.GetNumPlayerSlots" },	// 6632
+	{ 109977, "Function sfxgamempcontent.sfxgui_mplobby.GetNumPlayers" },	// 6633
+	{ 109979, "Function sfxgamempcontent.sfxgui_mplobby.GetPlayerInSlot" },	// 6634
+	{ 109983, "Function sfxgamempcontent.sfxgui_mplobby.GetPlayerSlotBasicInfo" },	// 6635
+	{ 109986, "Function sfxgamempcontent.sfxgui_mplobby.GetCharacterInfoBasic" },	// 6636
+	{ 109987, "Function sfxgamempcontent.sfxgui_mplobby.GetPlayerSlotDetailedInfo" },	// 6637
+	{ 109990, "Function sfxgamempcontent.sfxgui_mplobby.GetCharacterInfoDetailed" },	// 6638
+	{ 109991, "Function sfxgamempcontent.sfxgui_mplobby.GetLocalPlayerBasicInfo" },	// 6639
+	{ 109993, "Function sfxgamempcontent.sfxgui_mplobby.GetLocalPlayerDetailedInfo" },	// 6640
+	{ 110017, "Function sfxgamempcontent.sfxgui_mplobby.GetCharacterPowerInfo" },	// 6641
+	{ 110018, "Function sfxgamempcontent.sfxgui_mplobby.GetCharacterWeaponInfo" },	// 6642
+	{ 110019, "Function sfxgamempcontent.sfxgui_mplobby.GetCharacterConsumableInfo" },	// 6643
+	{ 110047, "Function sfxgamempcontent.sfxprimp.GetWeapon" },	// 6644
+	{ 110049, "Function sfxgamempcontent.sfxprimp.GetWeaponLevel" },	// 6645
+	{ 110051, "Function sfxgamempcontent.sfxprimp.GetWeaponMod" },	// 6646
+	{ 110066, "Function sfxgamempcontent.sfxgui_mplobby.GetMatchConsumableSlotTypeForCategory" },	// 6647
+	{ 110069, "Function sfxgamempcontent.sfxgui_mplobby.GetCharacterInfo_Patch" },	// 6648
+	{ 110071, "Function sfxgamempcontent.sfxgui_mplobby.IsGameFull" },	// 6649
+	{ 110073, "Function sfxgamempcontent.sfxgui_mplobby.IsPrivateMatch" },	// 6650
+	{ 110075, "Function sfxgamempcontent.sfxgui_mplobby.IsReady" },	// 6651
+	{ 110077, "Function sfxgamempcontent.sfxgui_mplobby.GetPrivacy" },	// 6652
+	{ 110078, "Function sfxgamempcontent.sfxgui_mplobby.CanLevelUp" },	// 6653
+	{ 110080, "Function sfxgamempcontent.sfxgui_mplobby.HasTalentPointsToSpend" },	// 6654
+	{ 110082, "Function sfxgamempcontent.sfxplayercontrollermp.PlayerHasTalentPointsToSpend" },	// 6655
+	{ 110084, "Function sfxgamempcontent.sfxgui_mplobby.HasCreditsToSpend" },	// 6656
+	{ 110086, "Function sfxgamempcontent.sfxplayercontrollermp.PlayerHasCreditsToSpend" },	// 6657
+	{ 110090, "Function sfxgamempcontent.sfxgui_mplobby.HasLeaderboardNotifications" },	// 6658
+	{ 110092, "Function sfxgamempcontent.sfxgui_mplobby.GetLeaderboardNotificationText" },	// 6659
+	{ 110095, "Function sfxgamempcontent.sfxgui_mplobby.SetReady" },	// 6660
+	{ 110097, "Function sfxgamempcontent.sfxgui_mplobby.ShowGamercard" },	// 6661
+	{ 110101, "Function sfxgamempcontent.sfxgui_mplobby.InviteFriends" },	// 6662
+	{ 110110, "Function sfxgamempcontent.sfxgui_mplobby.InviteParty" },	// 6663
+	{ 110112, "Function sfxgamempcontent.sfxgui_mplobby.ShowPartySessions" },	// 6664
+	{ 110115, "Function sfxgamempcontent.sfxgui_mplobby.ExitLobby" },	// 6665
+	{ 110121, "Function sfxgamempcontent.sfxgui_mplobby.ExitLobbyPopupInputDelegate" },	// 6666
+	{ 110124, "Function sfxgamempcontent.sfxgui_mplobby.ConfirmExitLobby" },	// 6667
+	{ 110127, "Function sfxgamempcontent.sfxgui_mplobby.GoBackToSelectFirstCharacter" },	// 6668
+	{ 110128, "Function sfxgamempcontent.sfxlobbyflow.GoBackToSelectFirstCharacter" },	// 6669
+	{ 110129, "Function sfxgamempcontent.sfxgui_mplobby.ExitMultiplayer" },	// 6670
+	{ 110130, "Function sfxgamempcontent.sfxgui_mplobby.ShowExitMultiplayerConfirmationPopup" },	// 6671
+	{ 110135, "Function sfxgamempcontent.sfxgui_mplobby.ExitMultiplayerConfirmationPopupInputDelegate" },	// 6672
+	{ 110138, "Function sfxgamempcontent.sfxgui_mplobby.ConfirmExitMultiplayer" },	// 6673
+	{ 110139, "Function sfxgamempcontent.sfxlobbyflow.ExitMultiplayer" },	// 6674
+	{ 110140, "Function sfxgamempcontent.sfxgui_mplobby.CustomMatch" },	// 6675
+	{ 110141, "Function sfxgamempcontent.sfxgui_mplobby.CheckIfSignedInFailSafe" },	// 6676
+	{ 110142, "Function sfxgamempcontent.sfxlobbyflow.ShowCustomMatchScreen" },	// 6677
+	{ 110143, "Function sfxgamempcontent.sfxgui_mplobby.HostNewMission" },	// 6678
+	{ 110144, "Function sfxgamempcontent.sfxlobbyflow.ShowHostNewMissionScreen" },	// 6679
+	{ 110145, "Function sfxgamempcontent.sfxgui_mplobby.ShowMatchSettingsScreen" },	// 6680
+	{ 110147, "Function sfxgamempcontent.sfxlobbyflow.ShowMatchSettingsScreen" },	// 6681
+	{ 110148, "Function sfxgamempcontent.sfxgui_mplobby.ShowTalentsLevelUpScreen" },	// 6682
+	{ 110150, "Function sfxgamempcontent.sfxlobbyflow.ShowTalentsLevelUpScreen" },	// 6683
+	{ 110151, "Function sfxgamempcontent.sfxgui_mplobby.ShowWeaponsScreen" },	// 6684
+	{ 110152, "Function sfxgamempcontent.sfxlobbyflow.ShowWeaponsScreen" },	// 6685
+	{ 110153, "Function sfxgamempcontent.sfxgui_mplobby.ShowStoreScreen" },	// 6686
+	{ 110154, "Function sfxgamempcontent.sfxlobbyflow.ShowStoreScreen" },	// 6687
+	{ 110155, "Function sfxgamempcontent.sfxgui_mplobby.ShowAppearanceScreen" },	// 6688
+	{ 110157, "Function sfxgamempcontent.sfxlobbyflow.ShowMPAppearanceScreen" },	// 6689
+	{ 110158, "Function sfxgamempcontent.sfxgui_mplobby.ShowMatchConsumablesScreen" },	// 6690
+	{ 110159, "Function sfxgamempcontent.sfxlobbyflow.ShowMatchConsumablesScreen" },	// 6691
+	{ 110160, "Function sfxgamempcontent.sfxgui_mplobby.ShowLeaderboardScreen" },	// 6692
+	{ 110161, "Function sfxgamempcontent.sfxlobbyflow.ShowLeaderboardScreen" },	// 6693
+	{ 110162, "Function sfxgamempcontent.sfxgui_mplobby.ShowOptionsScreen" },	// 6694
+	{ 110163, "Function sfxgamempcontent.sfxlobbyflow.ShowOptionsScreen" },	// 6695
+	{ 110164, "Function sfxgamempcontent.sfxgui_mplobby.SwitchCharacter" },	// 6696
+	{ 110166, "Function sfxgamempcontent.sfxlobbyflow.ShowMPSelectKitScreen" },	// 6697
+	{ 110167, "Function sfxgamempcontent.sfxgui_mplobby.QuickMatch" },	// 6698
+	{ 110168, "Function sfxgamempcontent.sfxgui_mplobby.GetCredits" },	// 6699
+	{ 110170, "Function sfxgamempcontent.sfxgui_mplobby.ChangeMatchSettings" },	// 6700
+	{ 110176, "Function sfxgamempcontent.sfxlobbyflow.ChangeMatchSettings" },	// 6701
+	{ 110178, "Function sfxgamempcontent.sfxgui_mplobby.CancelMatchSettings" },	// 6702
+	{ 110179, "Function sfxgamempcontent.sfxgui_mplobby.GetPreviouslySelectedItem" },	// 6703
+	{ 110183, "Function sfxgamempcontent.sfxgui_mplobby.SetPreviouslySelectedItem" },	// 6704
+	{ 110186, "Function sfxgamempcontent.sfxgui_mplobby.ToggleMuteForSlot" },	// 6705
+	{ 110191, "Function sfxgamempcontent.sfxgui_mplobby.HasNewWeapons" },	// 6706
+	{ 110195, "Function sfxgamempcontent.sfxgui_mplobby.HasNewAppearanceOptions" },	// 6707
+	{ 110199, "Function sfxgamempcontent.sfxgui_mplobby.HasNewMatchConsumables" },	// 6708
+	{ 110202, "Function sfxgamempcontent.sfxgui_mplobby.CanAffordNewStoreItems" },	// 6709
+	{ 110207, "Function sfxgamempcontent.sfxgui_mplobby.HasVotedToKickPlayerInSlot" },	// 6710
+	{ 110212, "Function sfxgamempcontent.sfxgui_mplobby.VoteToKickPlayerInSlot" },	// 6711
+	{ 110217, "Function sfxgamempcontent.sfxgui_mplobby.ChangeMapMusic" },	// 6712
+	{ 110219, "Function sfxgamempcontent.sfxgui_mplobby.GetRandomMapBonusText" },	// 6713
+	{ 110221, "Function sfxgamempcontent.sfxgui_mplobby.GetRandomEnemyBonusText" },	// 6714
+	{ 110223, "Function sfxgamempcontent.sfxgui_mplobby.GetMaxActiveConsumables" },	// 6715
+	{ 110225, "Function sfxgamempcontent.sfxgui_mplobby.GetEnemyBonusText" },	// 6716
+	{ 110226, "Function sfxgamempcontent.sfxgui_mplobby.IsHostingNewMission" },	// 6717
+	{ 110241, "Function sfxgamempcontent.sfxgui_mplobby.ShouldShowChatDisabledMessage" },	// 6718
+	{ 110245, "Function sfxgamempcontent.sfxgui_mplobby.GetFormattedReadinessPercentage" },	// 6719
+	{ 110250, "Function sfxgamempcontent.sfxgui_mplobby.GetMapZoneID" },	// 6720
+	{ 110257, "Function sfxgamempcontent.sfxgui_mplobby.ViewInvitations" },	// 6721
+	{ 110259, "Function sfxgamempcontent.sfxgui_mplobby.CameFromSelectFirstCharacter" },	// 6722
+	{ 110262, "Function sfxgamempcontent.sfxgui_mplobby.GetGAWZoneBonusText" },	// 6723
+	{ 110272, "Function sfxgamempcontent.sfxprimp.GetZoneIncreases" },	// 6724
+	{ 110278, "Function sfxgamempcontent.sfxplayercontrollermp.CheckIfConnectedFailsafe" },	// 6725
+	{ 110280, "Function sfxgamempcontent.sfxgui_mplobby.IsChallengeSystemEnabled" },	// 6726
+	{ 110288, "Function sfxgamempcontent.sfxgui_mplobby.ShowMPChallengeScreen" },	// 6727
+	{ 110290, "Function sfxgamempcontent.sfxgui_mplobby.OnRequestImageComplete" },	// 6728
+	{ 110291, "Function sfxgamempcontent.sfxlobbyflow.ShowMPChallengeScreen" },	// 6729
+	{ 110293, "Function sfxgamempcontent.sfxgui_mplobby.RequestImage" },	// 6730
+	{ 110296, "Function sfxgamempcontent.sfxgui_mplobby.GetEmblemData" },	// 6731
+	{ 110304, "Function sfxgamempcontent.sfxprimp.GetEmblemData" },	// 6732
+	{ 110311, "Function sfxgamempcontent.sfxgui_mplobby.GetMapBonusText" },	// 6733
+	{ 110325, "Function sfxgamempcontent.sfxgui_mplobby.GetPlayerSlotInfo_Patch" },	// 6734
+	{ 110335, "Function sfxgamempcontent.sfxgui_mplobbystatusbars.OnStart" },	// 6735
+	{ 110336, "Function sfxgamempcontent.sfxgui_mplobbystatusbars.OnClose" },	// 6736
+	{ 110337, "Function sfxgamempcontent.sfxgui_mplobbystatusbars.Refresh" },	// 6737
+	{ 110338, "Function sfxgamempcontent.sfxgui_mplobbystatusbars.AS_Refresh" },	// 6738
+	{ 110339, "Function sfxgamempcontent.sfxgui_mplobbystatusbars.Update" },	// 6739
+	{ 110345, "Function sfxgamempcontent.sfxgui_mplobbystatusbars.ShouldShowStatusBar" },	// 6740
+	{ 110347, "Function sfxgamempcontent.sfxgui_mplobbystatusbars.ShouldShowMatchInfo" },	// 6741
+	{ 110349, "Function sfxgamempcontent.sfxlobbyflow.CanSetReady" },	// 6742
+	{ 110352, "Function sfxgamempcontent.sfxgui_mplobbystatusbars.GetPlayerStatus" },	// 6743
+	{ 110365, "Function sfxgamempcontent.sfxgui_mplobbystatusbars.GetReadyButtonString" },	// 6744
+	{ 110369, "Function sfxgamempcontent.sfxgui_mplobbystatusbars.IsReady" },	// 6745
+	{ 110376, "Function sfxgamempcontent.sfxgui_mplobbystatusbars.GetNumReadyPlayers" },	// 6746
+	{ 110399, "Function sfxgamempcontent.sfxgui_mpmatchconsumables.OnStart" },	// 6747
+	{ 110403, "Function sfxgamempcontent.sfxgui_mpmatchconsumables.UpdateActiveList" },	// 6748
+	{ 110404, "Function sfxgamempcontent.sfxgui_mpmatchconsumables.AS_RefreshScreen" },	// 6749
+	{ 110405, "Function sfxgamempcontent.sfxgui_mpmatchconsumables.OnClose" },	// 6750
+	{ 110407, "Function sfxgamempcontent.sfxgui_mpmatchconsumables.GetDisplayInfo" },	// 6751
+	{ 110420, "Function sfxgamempcontent.sfxgui_mpmatchconsumables.IsConsumableAvailable" },	// 6752
+	{ 110421, "Function sfxgamempcontent.sfxgui_mpmatchconsumables.GetConsumableList" },	// 6753
+	{ 110428, "Function sfxgamempcontent.sfxgui_mpmatchconsumables.GetConsumableListFilteredBySlot" },	// 6754
+	{ 110436, "Function sfxgamempcontent.sfxgui_mpmatchconsumables.GetSlotTypeForCategory" },	// 6755
+	{ 110437, "Function sfxgamempcontent.sfxgui_mpmatchconsumables.GetConsumable" },	// 6756
+	{ 110449, "Function sfxgamempcontent.sfxgui_mpmatchconsumables.SetConsumableActive" },	// 6757
+	{ 110455, "Function sfxgamempcontent.sfxgui_mpmatchconsumables.DeactivateConsumablesOfSlotType" },	// 6758
+	{ 110460, "Function sfxgamempcontent.sfxgui_mpmatchconsumables.GetActiveConsumables" },	// 6759
+	{ 110463, "Function sfxgamempcontent.sfxgui_mpmatchconsumables.GetMaxActiveConsumables" },	// 6760
+	{ 110465, "Function sfxgamempcontent.sfxgui_mpmatchconsumables.ExitScreen" },	// 6761
+	{ 110466, "Function sfxgamempcontent.sfxgui_mpmatchconsumables.ClearNewFlagsForSlotType" },	// 6762
+	{ 110467, "Function sfxgamempcontent.sfxlobbyflow.ShowLobbyScreen" },	// 6763
+	{ 110470, "Function sfxgamempcontent.sfxgui_mpmatchconsumables.ShowStoreScreen" },	// 6764
+	{ 110471, "Function sfxgamempcontent.sfxgui_mpmatchconsumables.GetInGameConsumableInfo" },	// 6765
+	{ 110483, "Function sfxgamempcontent.sfxgui_mpmatchconsumables.HasNewConsumablesOfSlotType" },	// 6766
+	{ 110488, "Function sfxgamempcontent.sfxgui_mpmatchconsumables.GetGUICategoryFromSlotType" },	// 6767
+	{ 110510, "Function sfxgamempcontent.sfxgui_mpmatchresults.OnStart" },	// 6768
+	{ 110512, "Function sfxgamempcontent.sfxgui_mpmatchresults.OnClose" },	// 6769
+	{ 110513, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetPlayerData" },	// 6770
+	{ 110526, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetOverallMatchResults" },	// 6771
+	{ 110528, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetPlayerMedalDefinition" },	// 6772
+	{ 110533, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetMedalDefinition" },	// 6773
+	{ 110534, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetSquadMedalDefinition" },	// 6774
+	{ 110545, "Function sfxgamempcontent.sfxgui_mpmatchresults.ResultDataSort" },	// 6775
+	{ 110549, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetSquadMedals" },	// 6776
+	{ 110557, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetMatchMap" },	// 6777
+	{ 110560, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetMatchEnemy" },	// 6778
+	{ 110566, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetMatchChallenge" },	// 6779
+	{ 110572, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetMatchWave" },	// 6780
+	{ 110574, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetMatchTime" },	// 6781
+	{ 110576, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetOriginalExperience" },	// 6782
+	{ 110579, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetFinalExperience" },	// 6783
+	{ 110582, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetSquadTotalXP" },	// 6784
+	{ 110585, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetSquadTotalCredits" },	// 6785
+	{ 110588, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetSquadBonusXP" },	// 6786
+	{ 110591, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetXPRequredForLevel" },	// 6787
+	{ 110595, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetLevelFromXP" },	// 6788
+	{ 110599, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetMissionResult" },	// 6789
+	{ 110601, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetNextLevelString" },	// 6790
+	{ 110606, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetFormattedXPString" },	// 6791
+	{ 110611, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetFormattedXPStringPlus" },	// 6792
+	{ 110616, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetClassDataString" },	// 6793
+	{ 110623, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetCurrentPlayerClassDataString" },	// 6794
+	{ 110628, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetPlusFormattedValue" },	// 6795
+	{ 110633, "Function sfxgamempcontent.sfxgui_mpmatchresults.OnContinue" },	// 6796
+	{ 110634, "Function sfxgamempcontent.sfxgui_mpmatchresults.ShowGamercard" },	// 6797
+	{ 110638, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetIntroEventPauseTime" },	// 6798
+	{ 110641, "Function sfxgamempcontent.sfxgui_mpmatchresults.LeveledUp" },	// 6799
+	{ 110646, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetLeveledUpString" },	// 6800
+	{ 110649, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetGAWMapID" },	// 6801
+	{ 110652, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetGAWMapRating" },	// 6802
+	{ 110656, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetGAWMapRatingIncrease" },	// 6803
+	{ 110659, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetGAWMapString" },	// 6804
+	{ 110668, "Function sfxgamempcontent.sfxgui_mpmatchresults.HasOverallRatingsIncrease" },	// 6805
+	{ 110671, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetMaxReadinessString" },	// 6806
+	{ 110678, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetOverallRatingsString" },	// 6807
+	{ 110683, "Function sfxgamempcontent.sfxgui_mpmatchresults.GetLocalPlayerClassData" },	// 6808
+	{ 110690, "Function sfxgamempcontent.sfxgui_mpmatchresults.StartXPProgressSound" },	// 6809
+	{ 110691, "Function sfxgamempcontent.sfxgui_mpmatchresults.StopXPProgressSound" },	// 6810
+	{ 110692, "Function sfxgamempcontent.sfxgui_mpmatchresults.AS_InitializeScreen" },	// 6811
+	{ 110700, "Function sfxgamempcontent.sfxgui_mppausemenu.OnStart" },	// 6812
+	{ 110701, "Function sfxgamempcontent.sfxgui_mppausemenu.OnClose" },	// 6813
+	{ 110702, "Function sfxgamempcontent.sfxgui_mppausemenu.Exit" },	// 6814
+	{ 110703, "Function sfxgamempcontent.sfxgui_mppausemenu.OpenOptions" },	// 6815
+	{ 110704, "Function sfxgamempcontent.sfxgui_mppausemenu.OnMPOptionsClosed" },	// 6816
+	{ 110706, "Function sfxgamempcontent.sfxgui_mppausemenu.ExitMatch" },	// 6817
+	{ 110712, "Function sfxgamempcontent.sfxgui_mppausemenu.ConfirmExitPopupCallback" },	// 6818
+	{ 110718, "Function sfxgamempcontent.sfxgui_mppausemenu.GetScoreData" },	// 6819
+	{ 110727, "Function sfxgamempcontent.sfxgui_mppausemenu.SortScoreData" },	// 6820
+	{ 110731, "Function sfxgamempcontent.sfxgui_mppausemenu.ShouldAnimate" },	// 6821
+	{ 110734, "Function sfxgamempcontent.sfxgui_mppausemenu.OpenIngamePropertyEditor" },	// 6822
+	{ 110735, "Function sfxgamempcontent.sfxgui_mppausemenu.GetWaveNumber" },	// 6823
+	{ 110741, "Function sfxgamempcontent.sfxgui_mppausemenu.GetMapText" },	// 6824
+	{ 110748, "Function sfxgamempcontent.sfxgui_mppausemenu.GetFactionText" },	// 6825
+	{ 110755, "Function sfxgamempcontent.sfxgui_mppausemenu.GetChallengeText" },	// 6826
+	{ 110761, "Function sfxgamempcontent.sfxgui_mppausemenu.ShowGamercard" },	// 6827
+	{ 110770, "Function sfxgamempcontent.sfxgui_mppromotion.OnStart" },	// 6828
+	{ 110774, "Function sfxgamempcontent.sfxgui_mppromotion.RequestImage" },	// 6829
+	{ 110776, "Function sfxgamempcontent.sfxgui_mppromotion.OnRequestComplete" },	// 6830
+	{ 110780, "Function sfxgamempcontent.sfxgui_mppromotion.OnClose" },	// 6831
+	{ 110781, "Function sfxgamempcontent.sfxgui_mppromotion.OnContinue" },	// 6832
+	{ 110782, "Function sfxgamempcontent.sfxgui_mppromotion.OnReinforcements" },	// 6833
+	{ 110784, "Function sfxgamempcontent.sfxlobbyflow.ShowStoreScreenFromPromotion" },	// 6834
+	{ 110785, "Function sfxgamempcontent.sfxgui_mppromotion.AS_SetPromotionalText" },	// 6835
+	{ 110788, "Function sfxgamempcontent.sfxgui_mppromotion.AS_SetLoadingClipVisible" },	// 6836
+	{ 110790, "Function sfxgamempcontent.sfxgui_mppromotion.AS_SetImageVisible" },	// 6837
+	{ 110808, "Function sfxgamempcontent.sfxgui_mpreinforcementsreveal.OnCloseCallback" },	// 6838
+	{ 110809, "Function sfxgamempcontent.sfxgui_mpreinforcementsreveal.SetOnCloseCallback" },	// 6839
+	{ 110812, "Function sfxgamempcontent.sfxgui_mpreinforcementsreveal.OnStart" },	// 6840
+	{ 110818, "Function sfxgamempcontent.sfxgui_mpreinforcementsreveal.GetAwardedPackName" },	// 6841
+	{ 110820, "Function sfxgamempcontent.sfxgui_mpreinforcementsreveal.GetPackRevealSound" },	// 6842
+	{ 110821, "Function sfxgamempcontent.sfxgui_mpreinforcementsreveal.AS_InitializeScreen" },	// 6843
+	{ 110822, "Function sfxgamempcontent.sfxgui_mpreinforcementsreveal.OnClose" },	// 6844
+	{ 110823, "Function sfxgamempcontent.sfxgui_mpreinforcementsreveal.GetCardDisplayData" },	// 6845
+	{ 110830, "Function sfxgamempcontent.sfxgui_mpreinforcementsreveal.GetPackName" },	// 6846
+	{ 110832, "Function sfxgamempcontent.sfxgui_mpreinforcementsreveal.GetCardData" },	// 6847
+	{ 110841, "Function sfxgamempcontent.sfxgui_mpreinforcementsreveal.GetCardsToDisplay" },	// 6848
+	{ 110842, "Function sfxgamempcontent.sfxgui_mpreinforcementsreveal.Exit" },	// 6849
+	{ 110843, "Function sfxgamempcontent.sfxgui_mpreinforcementsreveal.GetPackIntroTextureRef" },	// 6850
+	{ 110845, "Function sfxgamempcontent.sfxgui_mpreinforcementsreveal.GetPackIntroHoloTextureRef" },	// 6851
+	{ 110884, "Function sfxgamempcontent.sfxgui_mpselectkit.OnStart" },	// 6852
+	{ 110888, "Function sfxgamempcontent.sfxgui_mpselectkit.HasValidLastHighlightedCharacter" },	// 6853
+	{ 110889, "Function sfxgamempcontent.sfxgui_mpselectkit.SetLastHighlightedCharacter" },	// 6854
+	{ 110890, "Function sfxgamempcontent.sfxgui_mpselectkit.GetClassData" },	// 6855
+	{ 110905, "Function sfxgamempcontent.sfxgui_mpselectkit.GetKitData" },	// 6856
+	{ 110916, "Function sfxgamempcontent.sfxgui_mpselectkit.Update" },	// 6857
+	{ 110919, "Function sfxgamempcontent.sfxgui_mpselectkit.ShowWaitMessageBox" },	// 6858
+	{ 110921, "Function sfxgamempcontent.sfxgui_mpselectkit.HideWaitMessageBox" },	// 6859
+	{ 110922, "Function sfxgamempcontent.sfxgui_mpselectkit.DeployKit" },	// 6860
+	{ 110924, "Function sfxgamempcontent.sfxgui_mpselectkit.SelectKitAndProceed" },	// 6861
+	{ 110926, "Function sfxgamempcontent.sfxgui_mpselectkit.OnClose" },	// 6862
+	{ 110927, "Function sfxgamempcontent.sfxgui_mpselectkit.GoBack" },	// 6863
+	{ 110928, "Function sfxgamempcontent.sfxgui_mpselectkit.CanGoBack" },	// 6864
+	{ 110930, "Function sfxgamempcontent.sfxgui_mpselectkit.ShowLoadingCharacterMessageBox" },	// 6865
+	{ 110934, "Function sfxgamempcontent.sfxgui_mpselectkit.HideLoadingCharacterMessageBox" },	// 6866
+	{ 110937, "Function sfxgamempcontent.sfxgui_mpselectkit.PromoteClass" },	// 6867
+	{ 110945, "Function sfxgamempcontent.sfxgui_mpselectkit.PromoteClassWarningCallback" },	// 6868
+	{ 110951, "Function sfxgamempcontent.sfxgui_mpselectkit.PromoteConfirmCallback" },	// 6869
+	{ 110954, "Function sfxgamempcontent.sfxgui_mpselectkit.GetSelectedCharacterClass" },	// 6870
+	{ 110956, "Function sfxgamempcontent.sfxgui_mpselectkit.GetLastHighlightedCharacter" },	// 6871
+	{ 110957, "Function sfxgamempcontent.sfxgui_mpselectkit.GetSelectedCharacterKit" },	// 6872
+	{ 110959, "Function sfxgamempcontent.sfxgui_mpselectkit.IsSignedIn" },	// 6873
+	{ 110971, "Function sfxgamempcontent.sfxgui_mpselectkit.GetPromoteEventPauseTime" },	// 6874
+	{ 110974, "Function sfxgamempcontent.sfxgui_mpselectkit.GetPromotionN7RatingsBoost" },	// 6875
+	{ 110978, "Function sfxgamempcontent.sfxgui_mpselectkit.BackWillExitMultiplayer" },	// 6876
+	{ 110980, "Function sfxgamempcontent.sfxgui_mpselectkit.GetClassPromotionString" },	// 6877
+	{ 110981, "Function sfxgamempcontent.sfxgui_mpselectkit.AS_InitializeScreen" },	// 6878
+	{ 110982, "Function sfxgamempcontent.sfxgui_mpselectkit.AS_RefreshScreen" },	// 6879
+	{ 110983, "Function sfxgamempcontent.sfxgui_mpselectkit.AS_SetInputDisabled" },	// 6880
+	{ 110985, "Function sfxgamempcontent.sfxgui_mpselectkit.AS_StartPromotionEvent" },	// 6881
+	{ 111004, "Function sfxgamempcontent.sfxgui_mpstore.ShowNotification" },	// 6882
+	{ 111008, "Function sfxgamempcontent.sfxgui_mpstore.ShowQueuedNotification" },	// 6883
+	{ 111012, "Function sfxgamempcontent.sfxgui_mpstore.QueuedNotificationCallback" },	// 6884
+	{ 111015, "Function sfxgamempcontent.sfxgui_mpstore.ClearQueuedNotification" },	// 6885
+	{ 111017, "Function sfxgamempcontent.sfxgui_mpstore.OnStart" },	// 6886
+	{ 111023, "Function sfxgamempcontent.sfxgui_mpstore.FinishInitialization" },	// 6887
+	{ 111024, "Function sfxgamempcontent.sfxgui_mpstore.OnWalletBalanceRequestFinished" },	// 6888
+	{ 111028, "Function sfxgamempcontent.sfxgui_mpstore.RetryFinishInitialization" },	// 6889
+	{ 111032, "Function sfxgamempcontent.sfxlobbyflow.GetLobbyGRI" },	// 6890
+	{ 111034, "Function sfxgamempcontent.sfxlobbyflow.SetLastSelectedOffer" },	// 6891
+	{ 111036, "Function sfxgamempcontent.sfxgui_mpstore.ShowReinforcementsRevealScreen" },	// 6892
+	{ 111039, "Function sfxgamempcontent.sfxgui_mpstore.PurchaseErrorCallback" },	// 6893
+	{ 111042, "Function sfxgamempcontent.sfxgui_mpstore.OnClose" },	// 6894
+	{ 111044, "Function sfxgamempcontent.sfxgui_mpstore.Exit" },	// 6895
+	{ 111046, "Function sfxgamempcontent.sfxlobbyflow.FinishStoreScreen" },	// 6896
+	{ 111047, "Function sfxgamempcontent.sfxgui_mpstore.SetInitialSelectedStoreID" },	// 6897
+	{ 111049, "Function sfxgamempcontent.sfxgui_mpstore.GetInitialSelectedID" },	// 6898
+	{ 111051, "Function sfxgamempcontent.sfxgui_mpstore.GetTotalCreditString" },	// 6899
+	{ 111053, "Function sfxgamempcontent.sfxgui_mpstore.GetStoreItems" },	// 6900
+	{ 111059, "Function sfxgamempcontent.sfxgui_mpstore.OnImageRequestComplete" },	// 6901
+	{ 111064, "Function sfxgamempcontent.sfxgui_mpstore.SetRemoteImage" },	// 6902
+	{ 111067, "Function sfxgamempcontent.sfxgui_mpstore.GetExpirationTimeString" },	// 6903
+	{ 111079, "Function sfxgamempcontent.sfxgui_mpstore.GetCreditCostString" },	// 6904
+	{ 111086, "Function sfxgamempcontent.sfxgui_mpstore.CanPurchaseItemWithCredits" },	// 6905
+	{ 111088, "Function sfxgamempcontent.sfxgui_mpstore.IsItemFree" },	// 6906
+	{ 111091, "Function sfxgamempcontent.sfxgui_mpstore.GetPlatformCostString" },	// 6907
+	{ 111098, "Function sfxgamempcontent.sfxgui_mpstore.CanPurchaseItem" },	// 6908
+	{ 111104, "Function sfxgamempcontent.sfxprimp.IsReadyInLobby" },	// 6909
+	{ 111106, "Function sfxgamempcontent.sfxgui_mpstore.PurchaseItem" },	// 6910
+	{ 111114, "Function sfxgamempcontent.sfxgui_mpstore.CheckIfSignedInFailSafe" },	// 6911
+	{ 111115, "Function sfxgamempcontent.sfxgui_mpstore.PurchaseItemWithCredits" },	// 6912
+	{ 111116, "Function sfxgamempcontent.sfxgui_mpstore.PurchaseItemFromPlatform" },	// 6913
+	{ 111117, "Function sfxgamempcontent.sfxgui_mpstore.ConfirmPCPlatformPurchase" },	// 6914
+	{ 111127, "Function sfxgamempcontent.sfxgui_mpstore.PCPurchaseConfirmationCallback" },	// 6915
+	{ 111130, "Function sfxgamempcontent.sfxgui_mpstore.OnPurchaseChoiceCallback" },	// 6916
+	{ 111143, "Function sfxgamempcontent.sfxgui_mpstore.PurchaseCreditsCallback" },	// 6917
+	{ 111146, "Function sfxgamempcontent.sfxgui_mpstore.DoCreditPurchase" },	// 6918
+	{ 111149, "Function sfxgamempcontent.sfxgui_mpstore.OnPurchaseCreditsCallback" },	// 6919
+	{ 111152, "Function sfxgamempcontent.sfxgui_mpstore.OnPurchaseCreditsErrorDialogFinished" },	// 6920
+	{ 111155, "Function sfxgamempcontent.sfxgui_mpstore.FinishPurchase" },	// 6921
+	{ 111162, "Function sfxgamempcontent.sfxgui_mpstore.OnPurchaseItemCallback" },	// 6922
+	{ 111168, "Function sfxgamempcontent.sfxgui_mpstore.ShowFatalErrorDialog" },	// 6923
+	{ 111172, "Function sfxgamempcontent.sfxgui_mpstore.ErrorDialogCallback" },	// 6924
+	{ 111175, "Function sfxgamempcontent.sfxgui_mpstore.GetAvailablePCPoints" },	// 6925
+	{ 111177, "Function sfxgamempcontent.sfxgui_mpstore.HandleInputEvent" },	// 6926
+	{ 111181, "Function sfxgamempcontent.sfxgui_mpstore.CanSetReady" },	// 6927
+	{ 111183, "Function sfxgamempcontent.sfxgui_mpstore.IsReady" },	// 6928
+	{ 111187, "Function sfxgamempcontent.sfxgui_mpstore.AS_InitializeScreen" },	// 6929
+	{ 111188, "Function sfxgamempcontent.sfxgui_mpstore.AS_RefreshCredits" },	// 6930
+	{ 111189, "Function sfxgamempcontent.sfxgui_mpstore.AS_ClearScreen" },	// 6931
+	{ 111190, "Function sfxgamempcontent.sfxgui_mpstore.AS_SetListLoadingClipVisible" },	// 6932
+	{ 111192, "Function sfxgamempcontent.sfxgui_mpstore.AS_SetInputEnabled" },	// 6933
+	{ 111194, "Function sfxgamempcontent.sfxgui_mpstore.AS_SetImageLoadingClipVisible" },	// 6934
+	{ 111196, "Function sfxgamempcontent.sfxgui_mpstore.AS_ShowDefaultStoreImage" },	// 6935
+	{ 111197, "Function sfxgamempcontent.sfxgui_mpstore.AS_ShowRemoteStoreImage" },	// 6936
+	{ 111198, "Function sfxgamempcontent.sfxgui_mpstore.AS_ScrollDetails" },	// 6937
+	{ 111200, "Function sfxgamempcontent.sfxgui_mpstore.AS_RefreshPCPoints" },	// 6938
+	{ 111204, "Function sfxgamempcontent.sfxgui_mpstore.CanManuallyShowReinforcementsRevealScreen" },	// 6939
+	{ 111206, "Function sfxgamempcontent.sfxlobbyflow.ShowReinforcementsRevealScreeen" },	// 6940
+	{ 111210, "Class sfxgamempcontent.SFXHintSystemMP" },	// 6941
+	{ 111211, "Function sfxgamempcontent.SFXHintSystemMP.AddNotification_SupplyDrop" },	// 6942
+	{ 111215, "Function sfxgamempcontent.SFXHintSystemMP.CacheCurrentState" },	// 6943
+	{ 111238, "Function sfxgamempcontent.SFXHintSystemMP.UseReviveHint" },	// 6944
+	{ 111240, "Function sfxgamempcontent.SFXHintSystemMP.UseAmmoHint" },	// 6945
+	{ 111242, "Function sfxgamempcontent.SFXHintSystemMP.UseObjectiveHint" },	// 6946
+	{ 111244, "Function sfxgamempcontent.SFXHintSystemMP.ReviveOtherHint" },	// 6947
+	{ 111246, "Function sfxgamempcontent.SFXHintSystemMP.SwapWeapons" },	// 6948
+	{ 111248, "Function sfxgamempcontent.SFXHintSystemMP.ObjectiveHint" },	// 6949
+	{ 111253, "Function sfxgamempcontent.SFXHintSystemMP.DyingHint" },	// 6950
+	{ 111257, "Function sfxgamempcontent.SFXHintSystemMP.ReviveSystemHint" },	// 6951
+	{ 111260, "Function sfxgamempcontent.SFXHintSystemMP.Objective30sHint" },	// 6952
+	{ 111291, "Function sfxgamempcontent.sfxhostmigrationmp.HasCompleteAndValidState" },	// 6953
+	{ 111295, "Function sfxgamempcontent.sfxhostmigrationmp.InvalidateAll" },	// 6954
+	{ 111296, "Function sfxgamempcontent.sfxhostmigrationmp.CanRestoreWave" },	// 6955
+	{ 111298, "Function sfxgamempcontent.sfxhostmigrationmp.SetWaveToRestore" },	// 6956
+	{ 111300, "Function sfxgamempcontent.sfxhostmigrationmp.GetWaveToRestore" },	// 6957
+	{ 111302, "Function sfxgamempcontent.sfxhostmigrationmp.SaveGRI" },	// 6958
+	{ 111310, "Function sfxgamempcontent.sfxhostmigrationmp.ResetWaveToRestore" },	// 6959
+	{ 111312, "Function sfxgamempcontent.sfxhostmigrationmp.FindPlayer" },	// 6960
+	{ 111318, "Function sfxgamempcontent.sfxhostmigrationmp.RestorePRI" },	// 6961
+	{ 111323, "Function sfxgamempcontent.sfxhostmigrationmp.RestoreGRI" },	// 6962
+	{ 111398, "Class sfxgamempcontent.SFXMessageMP" },	// 6963
+	{ 111407, "Function sfxgamempcontent.sfxlobbyflow.GetPC" },	// 6964
+	{ 111410, "Function sfxgamempcontent.sfxlobbyflow.GetPRI" },	// 6965
+	{ 111413, "Function sfxgamempcontent.sfxlobbyflow.Destroyed" },	// 6966
+	{ 111414, "Function sfxgamempcontent.sfxlobbyflow.ClearCrossLevelReferences" },	// 6967
+	{ 111415, "Function sfxgamempcontent.sfxlobbyflow.RestoreLocalPRIMatchConsumablesFromOfflineTransfer" },	// 6968
+	{ 111426, "Function sfxgamempcontent.sfxlobbyflow.StartMPFlow" },	// 6969
+	{ 111430, "Function sfxgamempcontent.sfxlobbyflow.EnterLobby" },	// 6970
+	{ 111441, "Function sfxgamempcontent.sfxlobbyflow.ShowPromotionScreen" },	// 6971
+	{ 111442, "Function sfxgamempcontent.sfxlobbyflow.ServerRestartPlayer" },	// 6972
+	{ 111443, "Function sfxgamempcontent.sfxlobbyflow.FinishMatchResults" },	// 6973
+	{ 111444, "Function sfxgamempcontent.sfxlobbyflow.ShowMultiplayerMenu" },	// 6974
+	{ 111445, "Function sfxgamempcontent.sfxlobbyflow.FadeInFromBlack" },	// 6975
+	{ 111446, "Function sfxgamempcontent.sfxlobbyflow.HideMultiplayerMenu" },	// 6976
+	{ 111447, "Function sfxgamempcontent.sfxlobbyflow.HideLobbyScreen" },	// 6977
+	{ 111448, "Function sfxgamempcontent.sfxlobbyflow.ShowMatchResultsScreen" },	// 6978
+	{ 111449, "Function sfxgamempcontent.sfxlobbyflow.HideMatchResultsScreen" },	// 6979
+	{ 111450, "Function sfxgamempcontent.sfxlobbyflow.HideSelectKitScreen" },	// 6980
+	{ 111451, "Function sfxgamempcontent.sfxlobbyflow.HideCustomMatchScreen" },	// 6981
+	{ 111452, "Function sfxgamempcontent.sfxlobbyflow.FinishTalentsLevelUpScreen" },	// 6982
+	{ 111453, "Function sfxgamempcontent.sfxlobbyflow.FinishWeaponsScreen" },	// 6983
+	{ 111460, "Function sfxgamempcontent.sfxlobbyflow.FinishLeaderboardScreen" },	// 6984
+	{ 111464, "Function sfxgamempcontent.sfxlobbyflow.ShowLobbyStatusBars" },	// 6985
+	{ 111465, "Function sfxgamempcontent.sfxplayercontrollermp.ShowLobbyStatusBars" },	// 6986
+	{ 111466, "Function sfxgamempcontent.sfxlobbyflow.HideLobbyStatusBars" },	// 6987
+	{ 111467, "Function sfxgamempcontent.sfxplayercontrollermp.HideLobbyStatusBars" },	// 6988
+	{ 111468, "Function sfxgamempcontent.sfxplayercontrollermp.RefreshLobbyStatusBars" },	// 6989
+	{ 111469, "Function sfxgamempcontent.sfxplayercontrollermp.ShowPromotionScreen" },	// 6990
+	{ 111471, "Function sfxgamempcontent.sfxplayercontrollermp.ShowStoreScreenFromPromotion" },	// 6991
+	{ 111472, "Function sfxgamempcontent.sfxlobbyflow.ReturnToMainMenu" },	// 6992
+	{ 111476, "Function sfxgamempcontent.sfxlobbyflow.OnCloseRevealScreen" },	// 6993
+	{ 111477, "Function sfxgamempcontent.sfxlobbyflow.OnOptionsScreenClosed" },	// 6994
+	{ 111478, "Function sfxgamempcontent.sfxlobbyflow.IsReadyToSendPlayerDataToServer" },	// 6995
+	{ 111485, "Function sfxgamempcontent.sfxlobbyflow.IsReadyToStartMPFlow" },	// 6996
+	{ 111489, "Function sfxgamempcontent.sfxlobbyflow.IsReadyToEnterLobby" },	// 6997
+	{ 111493, "Function sfxgamempcontent.sfxlobbyflow.SendPlayerDataToServer" },	// 6998
+	{ 111497, "Function sfxgamempcontent.sfxlobbyflow.Tick" },	// 6999
+	{ 111500, "Function sfxgamempcontent.sfxlobbyflow.FinishMPAppearanceScreen" },	// 7000
+	{ 111505, "Function sfxgamempcontent.sfxlobbyflow.StartDeployFlow" },	// 7001
+	{ 111507, "Function sfxgamempcontent.sfxlobbyflow.SetupLocalCharacterData" },	// 7002
+	{ 111511, "Function sfxgamempcontent.sfxlobbyflow.SpawnDummyPawn" },	// 7003
+	{ 111520, "Function sfxgamempcontent.sfxlobbyflow.RestoreOriginalPawn" },	// 7004
+	{ 111522, "Function sfxgamempcontent.sfxlobbyflow.InitializeWeaponUIManager" },	// 7005
+	{ 111523, "Function sfxgamempcontent.sfxlobbyflow.OnWeaponUIDataLoaded" },	// 7006
+	{ 111524, "Function sfxgamempcontent.sfxlobbyflow.OnMatchSettingsChanged" },	// 7007
+	{ 111525, "Function sfxgamempcontent.sfxlobbyflow.FinishModifyCharacterFlow" },	// 7008
+	{ 111526, "Function sfxgamempcontent.sfxlobbyflow.FinishSelectCharacterFlow" },	// 7009
+	{ 111528, "Function sfxgamempcontent.sfxlobbyflow.FinishChangingMatchSettings" },	// 7010
+	{ 111534, "Function sfxgamempcontent.sfxlobbyflow.OnPlayerEnter" },	// 7011
+	{ 111536, "Function sfxgamempcontent.sfxlobbyflow.OnPlayerLeave" },	// 7012
+	{ 111538, "Function sfxgamempcontent.sfxlobbyflow.OnCharacterChanged" },	// 7013
+	{ 111540, "Function sfxgamempcontent.sfxlobbyflow.OnSearchGameCancelled" },	// 7014
+	{ 111638, "Function sfxgamempcontent.sfxlobbyflow.PlayGuiSound" },	// 7015
+	{ 111657, "Function sfxgamempcontent.sfxlobbyflow.SortMapInfoData" },	// 7016
+	{ 111659, "Function sfxgamempcontent.sfxlobbyflow.IsInConnectToMapFlow" },	// 7017
+	{ 111663, "Function sfxgamempcontent.sfxlobbyflow.StartConnectToMapFlow" },	// 7018
+	{ 111673, "Function sfxgamempcontent.sfxlobbyflow.RefreshMapList" },	// 7019
+	{ 111674, "Function sfxgamempcontent.sfxlobbyflow.StartQuickMatch" },	// 7020
+	{ 111676, "Function sfxgamempcontent.sfxlobbyflow.StartCustomMatch" },	// 7021
+	{ 111680, "Function sfxgamempcontent.sfxlobbyflow.StartNewMatch" },	// 7022
+	{ 111684, "Function sfxgamempcontent.sfxlobbyflow.SavePersonalMatchSettings" },	// 7023
+	{ 111689, "Function sfxgamempcontent.sfxlobbyflow.LoadPersonalMatchSettings" },	// 7024
+	{ 111695, "Function sfxgamempcontent.sfxlobbyflow.ChangeMapMusic" },	// 7025
+	{ 111704, "Function sfxgamempcontent.sfxlobbyflow.OnMPChallengesScreenClosed" },	// 7026
+	{ 111706, "Function sfxgamempcontent.sfxlobbyflow.ShowMPChallengeScreen_Helper" },	// 7027
+	{ 111727, "Function sfxgamempcontent.sfxoperationobjective.ReplicatedEvent" },	// 7028
+	{ 111730, "Function sfxgamempcontent.sfxoperationobjective.ClientFindObjectiveData" },	// 7029
+	{ 111731, "Function sfxgamempcontent.sfxoperationobjective.PostBeginPlay" },	// 7030
+	{ 111733, "Function sfxgamempcontent.sfxoperationobjective.FindOwningWave" },	// 7031
+	{ 111736, "Function sfxgamempcontent.sfxoperationobjective.PlayWaveInstructions" },	// 7032
+	{ 111737, "Function sfxgamempcontent.sfxoperationobjective.RepeatWaveInstructions" },	// 7033
+	{ 111738, "Function sfxgamempcontent.sfxoperationobjective.SetObjectiveData" },	// 7034
+	{ 111742, "Function sfxgamempcontent.sfxoperationobjective.SetObjectiveMesh" },	// 7035
+	{ 111759, "Function sfxgamempcontent.sfxoperationobjective.ActivateObjective" },	// 7036
+	{ 111762, "Function sfxgamempcontent.sfxoperationobjective.ActivateCombatZone" },	// 7037
+	{ 111764, "Function sfxgamempcontent.sfxoperationobjective.Destroyed" },	// 7038
+	{ 111765, "Function sfxgamempcontent.sfxoperationobjective.Deactivate" },	// 7039
+	{ 111767, "Function sfxgamempcontent.sfxoperationobjective.PawnDowned" },	// 7040
+	{ 111769, "Function sfxgamempcontent.sfxoperationobjective.PawnRevived" },	// 7041
+	{ 111771, "Function sfxgamempcontent.sfxoperationobjective.SetOwningWave" },	// 7042
+	{ 111773, "Function sfxgamempcontent.sfxoperationobjective.PawnDestroyed" },	// 7043
+	{ 111780, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.PlayPlayerAcknowledgment" },	// 7044
+	{ 111786, "Function sfxgamempcontent.SFXObjective_AssassinationBase.SetCurrentTarget" },	// 7045
+	{ 111788, "Function sfxgamempcontent.SFXObjective_AssassinationBase.CurrentTargetDied" },	// 7046
+	{ 111795, "Function sfxgamempcontent.sfxpawn_playermp.GetActorGameName" },	// 7047
+	{ 111798, "Function sfxgamempcontent.sfxpawn_playermp.ReplicatedEvent" },	// 7048
+	{ 111800, "Function sfxgamempcontent.sfxpawn_playermp.PlayerKilledMessage" },	// 7049
+	{ 111805, "Function sfxgamempcontent.sfxpawn_playermp.PlayerRevivedMessage" },	// 7050
+	{ 111808, "Function sfxgamempcontent.sfxpawn_playermp.CheckEnterCombat" },	// 7051
+	{ 111809, "Function sfxgamempcontent.sfxpawn_playermp.CopyPawnAppearance" },	// 7052
+	{ 111819, "Function sfxgamempcontent.sfxpawn_playermp.UpdateAppearance" },	// 7053
+	{ 111820, "Function sfxgamempcontent.sfxpawn_playermp.SetMPAppearanceVariables" },	// 7054
+	{ 111828, "Function sfxgamempcontent.sfxpawn_playermp.GetMPAppearanceVariables" },	// 7055
+	{ 111836, "Function sfxgamempcontent.sfxpawn_playermp.ApplyCustomizationToActor" },	// 7056
+	{ 111840, "Function sfxgamempcontent.sfxpawn_playermp.FellOutOfWorld" },	// 7057
+	{ 111842, "Function sfxgamempcontent.sfxpawn_playermp.OutsideWorldBounds" },	// 7058
+	{ 111843, "Function sfxgamempcontent.sfxpawn_playermp.BioBaseRemovedFromWorld" },	// 7059
+	{ 111844, "Function sfxgamempcontent.sfxpawn_playermp.FellOutOfWorldImpl" },	// 7060
+	{ 111846, "Function sfxgamempcontent.sfxpawn_playermp.FinalizeProcessFellOutOfWorld" },	// 7061
+	{ 111847, "Function sfxgamempcontent.sfxpawn_playermp.ServerFellOutOfWorldImpl" },	// 7062
+	{ 111848, "Function sfxgamempcontent.sfxpawn_playermp.StartRevive" },	// 7063
+	{ 111850, "Function sfxgamempcontent.sfxpawn_playermp.IsDeadUpdated" },	// 7064
+	{ 111880, "Function sfxgamempcontent.sfxpawn_playermp.IsReadyForExecution" },	// 7065
+	{ 111884, "Function sfxgamempcontent.sfxpawn_playermp.PreClientTravel" },	// 7066
+	{ 111887, "Function sfxgamempcontent.sfxpawn_playermp.Resurrect" },	// 7067
+	{ 111891, "Function sfxgamempcontent.sfxpawn_playermp.PermaDeadChanged" },	// 7068
+	{ 111895, "Function sfxgamempcontent.sfxpawn_playermp.StartSpectatorCam" },	// 7069
+	{ 111897, "Function sfxgamempcontent.sfxpawn_playermp.PermaDeath" },	// 7070
+	{ 111899, "Function sfxgamempcontent.sfxpawn_playermp.ServerPermaDeath" },	// 7071
+	{ 111902, "Function sfxgamempcontent.sfxpawn_playermp.PostBeginPlay" },	// 7072
+	{ 111904, "Function sfxgamempcontent.sfxpawn_playermp.DeferredPostBeginPlay" },	// 7073
+	{ 111933, "Function sfxgamempcontent.sfxprimp.ApplyMatchConsumableGameEffects" },	// 7074
+	{ 111937, "Function sfxgamempcontent.sfxpawn_playermp.StopLoadingMovie" },	// 7075
+	{ 111939, "Function sfxgamempcontent.sfxpawn_playermp.DeferredSetRichPresence" },	// 7076
+	{ 111940, "Function sfxgamempcontent.sfxpawn_playermp.GetFullName" },	// 7077
+	{ 111942, "Function sfxgamempcontent.sfxpawn_playermp.CreateWeapons" },	// 7078
+	{ 111945, "Function sfxgamempcontent.sfxpawn_playermp.LoadWeapons" },	// 7079
+	{ 111953, "Function sfxgamempcontent.sfxpawn_playermp.IsTestFrameworkSetupComplete" },	// 7080
+	{ 111955, "Function sfxgamempcontent.sfxpawn_playermp.LoadPowerData" },	// 7081
+	{ 111966, "Function sfxgamempcontent.sfxprimp.VerifyPawnPowers" },	// 7082
+	{ 111968, "Function sfxgamempcontent.sfxprimp.GetPower" },	// 7083
+	{ 111970, "Function sfxgamempcontent.sfxpawn_playermp.LoadWeaponModData" },	// 7084
+	{ 111980, "Function sfxgamempcontent.sfxpawn_playermp.PossessedBy" },	// 7085
+	{ 111983, "Function sfxgamempcontent.sfxpawn_playermp.Died" },	// 7086
+	{ 111989, "Function sfxgamempcontent.sfxpawn_playermp.InCombat" },	// 7087
+	{ 111991, "Function sfxgamempcontent.sfxpawn_playermp.ShouldTossWeapon" },	// 7088
+	{ 111995, "Function sfxgamempcontent.sfxpawn_playermp.AutoMapXbox" },	// 7089
+	{ 111997, "Function sfxgamempcontent.sfxpawn_playermp.AutoMapPC" },	// 7090
+	{ 112006, "Function sfxgamempcontent.sfxpawn_playermp.UseReviveConsumablePower" },	// 7091
+	{ 112009, "Function sfxgamempcontent.sfxpawn_playermp.CanPlayDeathEffect" },	// 7092
+	{ 112011, "Function sfxgamempcontent.sfxpawn_playermp.UpdateMappedPowerDisplay" },	// 7093
+	{ 112013, "Function sfxgamempcontent.sfxplayercontrollermp.GetMPHUD" },	// 7094
+	{ 112015, "Function sfxgamempcontent.sfxpawn_playermp.AttemptKillingBlow" },	// 7095
+	{ 112018, "Function sfxgamempcontent.sfxpawn_playermp.SetExecutioner" },	// 7096
+	{ 112020, "Function sfxgamempcontent.sfxpawn_playermp.Touch" },	// 7097
+	{ 112027, "Function sfxgamempcontent.sfxpawn_playermp.Destroyed" },	// 7098
+	{ 112034, "Function sfxgamempcontent.sfxpawn_playermp.GetUIAppearanceTag" },	// 7099
+	{ 112036, "Function sfxgamempcontent.sfxpawn_playermp.UpdateGameEffects" },	// 7100
+	{ 112037, "Function sfxgamempcontent.sfxpawn_playermp.ShouldShowHUDGrenadeCounter" },	// 7101
+	{ 112039, "Function sfxgamempcontent.sfxpawn_playermp.CanDoCustomAction" },	// 7102
+	{ 112045, "Function sfxgamempcontent.sfxpawn_playermp.RagdollFailsafe" },	// 7103
+	{ 112046, "Function sfxgamempcontent.sfxpawn_playermp.ResetSyncMovementFailsafeInfo" },	// 7104
+	{ 112047, "Function sfxgamempcontent.sfxpawn_playermp.HealthFailsafe" },	// 7105
+	{ 112059, "Function sfxgamempcontent.sfxpawn_playermp.ProcessSyncMovementFailsafe" },	// 7106
+	{ 112060, "Function sfxgamempcontent.sfxpawn_playermp.Tick" },	// 7107
+	{ 112089, "Function sfxgamempcontent.sfxplayercontrollermp.OnWeaponSelectFinishedDelegate" },	// 7108
+	{ 112090, "Function sfxgamempcontent.sfxplayercontrollermp.ReceivedPlayer" },	// 7109
+	{ 112092, "Function sfxgamempcontent.sfxplayercontrollermp.Destroyed" },	// 7110
+	{ 112093, "Function sfxgamempcontent.sfxplayercontrollermp.Possess" },	// 7111
+	{ 112096, "Function sfxgamempcontent.sfxplayercontrollermp.DebugSwapController" },	// 7112
+	{ 112097, "Function sfxgamempcontent.sfxplayercontrollermp.CastPower" },	// 7113
+	{ 112099, "Function sfxgamempcontent.sfxplayercontrollermp.CanSave" },	// 7114
+	{ 112102, "Function sfxgamempcontent.sfxplayercontrollermp.PostBeginPlay" },	// 7115
+	{ 112103, "Function sfxgamempcontent.sfxplayercontrollermp.UpdateLocalProfileSettingsCache" },	// 7116
+	{ 112105, "Function sfxgamempcontent.sfxplayercontrollermp.DeferredCheckLocalPlayer" },	// 7117
+	{ 112106, "Function sfxgamempcontent.sfxplayercontrollermp.LoadingScreenTimedOut" },	// 7118
+	{ 112111, "Function sfxgamempcontent.sfxplayercontrollermp.ShowPleaseWaitMessage" },	// 7119
+	{ 112121, "Function sfxgamempcontent.sfxplayercontrollermp.ShowLoadingWidget" },	// 7120
+	{ 112122, "Function sfxgamempcontent.sfxplayercontrollermp.PleaseWait_Callback" },	// 7121
+	{ 112125, "Function sfxgamempcontent.sfxplayercontrollermp.ShowExitConfirmation" },	// 7122
+	{ 112131, "Function sfxgamempcontent.sfxplayercontrollermp.ExitConformation_Callback" },	// 7123
+	{ 112134, "Function sfxgamempcontent.sfxplayercontrollermp.ResetSaveTimer" },	// 7124
+	{ 112136, "Function sfxgamempcontent.sfxplayercontrollermp.TickSaveGame" },	// 7125
+	{ 112138, "Function sfxgamempcontent.sfxplayercontrollermp.OnWaveFinished" },	// 7126
+	{ 112141, "Function sfxgamempcontent.sfxplayercontrollermp.CreateLobbyFlow" },	// 7127
+	{ 112142, "Function sfxgamempcontent.sfxplayercontrollermp.Pause" },	// 7128
+	{ 112143, "Function sfxgamempcontent.sfxplayercontrollermp.CleanupPawn" },	// 7129
+	{ 112145, "Function sfxgamempcontent.sfxplayercontrollermp.PreClientTravel" },	// 7130
+	{ 112151, "Function sfxgamempcontent.sfxplayercontrollermp.StopLoadingMovie" },	// 7131
+	{ 112154, "Function sfxgamempcontent.sfxplayercontrollermp.EnterStartState" },	// 7132
+	{ 112163, "Function sfxgamempcontent.sfxplayercontrollermp.PlayerTick" },	// 7133
+	{ 112174, "Function sfxgamempcontent.sfxplayercontrollermp.GamePlayEndedState" },	// 7134
+	{ 112176, "Function sfxgamempcontent.sfxplayercontrollermp.ShowLobbyScreen" },	// 7135
+	{ 112178, "Function sfxgamempcontent.sfxplayercontrollermp.HideLobbyScreen" },	// 7136
+	{ 112180, "Function sfxgamempcontent.sfxplayercontrollermp.RefreshLobbyScreen" },	// 7137
+	{ 112183, "Function sfxgamempcontent.sfxplayercontrollermp.ShowCustomMatchScreen" },	// 7138
+	{ 112186, "Function sfxgamempcontent.sfxplayercontrollermp.HideCustomMatchScreen" },	// 7139
+	{ 112189, "Function sfxgamempcontent.sfxplayercontrollermp.ShowMatchSettingsScreen" },	// 7140
+	{ 112192, "Function sfxgamempcontent.sfxplayercontrollermp.HideMatchSettingsScreen" },	// 7141
+	{ 112195, "Function sfxgamempcontent.sfxplayercontrollermp.ShowMPSelectKitScreen" },	// 7142
+	{ 112197, "Function sfxgamempcontent.sfxplayercontrollermp.HideMPSelectKitScreen" },	// 7143
+	{ 112199, "Function sfxgamempcontent.sfxplayercontrollermp.ShowMPAppearanceScreen" },	// 7144
+	{ 112201, "Function sfxgamempcontent.sfxplayercontrollermp.ShowMatchConsumablesScreen" },	// 7145
+	{ 112203, "Function sfxgamempcontent.sfxplayercontrollermp.ShowReinforcementsRevealScreeen" },	// 7146
+	{ 112210, "Function sfxgamempcontent.sfxplayercontrollermp.ShowLevelUpUI" },	// 7147
+	{ 112212, "Function sfxgamempcontent.sfxplayercontrollermp.SpawnLevelUpScreen" },	// 7148
+	{ 112218, "Function sfxgamempcontent.sfxplayercontrollermp.ShowMPStoreUI" },	// 7149
+	{ 112223, "Function sfxgamempcontent.sfxplayercontrollermp.ShowWeaponSelectionUI" },	// 7150
+	{ 112227, "Function sfxgamempcontent.sfxplayercontrollermp.FinishedLevelUpUI" },	// 7151
+	{ 112232, "Function sfxgamempcontent.sfxprimp.LoadPowerDataFromSave" },	// 7152
+	{ 112233, "Function sfxgamempcontent.sfxplayercontrollermp.FinishedMPStoreUI" },	// 7153
+	{ 112237, "Function sfxgamempcontent.sfxplayercontrollermp.FinishedWeaponSelectionUI" },	// 7154
+	{ 112241, "Function sfxgamempcontent.sfxprimp.LoadWeaponDataFromSave" },	// 7155
+	{ 112242, "Function sfxgamempcontent.sfxplayercontrollermp.ShowMPEndOfMatchScreen" },	// 7156
+	{ 112244, "Function sfxgamempcontent.sfxplayercontrollermp.ShowMatchResultsScreen" },	// 7157
+	{ 112246, "Function sfxgamempcontent.sfxplayercontrollermp.HideMatchResultsScreen" },	// 7158
+	{ 112250, "Function sfxgamempcontent.sfxplayercontrollermp.ClientWriteLeaderboardStats" },	// 7159
+	{ 112257, "Function sfxgamempcontent.sfxplayercontrollermp.UpdateMPMapsCompleted" },	// 7160
+	{ 112300, "Function sfxgamempcontent.sfxplayercontrollermp.ViewNextPlayer" },	// 7161
+	{ 112301, "Function sfxgamempcontent.sfxplayercontrollermp.ViewPrevPlayer" },	// 7162
+	{ 112302, "Function sfxgamempcontent.sfxplayercontrollermp.Spectate" },	// 7163
+	{ 112303, "Function sfxgamempcontent.sfxplayercontrollermp.ServerSuicide" },	// 7164
+	{ 112304, "Function sfxgamempcontent.sfxplayercontrollermp.ClientWriteOnlinePlayerScores" },	// 7165
+	{ 112306, "Function sfxgamempcontent.sfxplayercontrollermp.SetRichPresence" },	// 7166
+	{ 112322, "Function sfxgamempcontent.sfxplayercontrollermp.OnGameConnectionLost" },	// 7167
+	{ 112323, "Function sfxgamempcontent.sfxplayercontrollermp.SetScoreHudObjectiveText" },	// 7168
+	{ 112326, "Function sfxgamempcontent.sfxplayercontrollermp.SetScoreHudObjectiveProgress" },	// 7169
+	{ 112330, "Function sfxgamempcontent.sfxplayercontrollermp.SetObjectiveCircleProgress" },	// 7170
+	{ 112333, "Function sfxgamempcontent.sfxplayercontrollermp.SetObjectiveCircleText" },	// 7171
+	{ 112339, "Function sfxgamempcontent.sfxplayercontrollermp.ShowEndOfMatchUI" },	// 7172
+	{ 112343, "Function sfxgamempcontent.sfxplayercontrollermp.UpdateInGameConsumableUI" },	// 7173
+	{ 112345, "Function sfxgamempcontent.sfxplayercontrollermp.HideInGameConsumableUI" },	// 7174
+	{ 112347, "Function sfxgamempcontent.sfxplayercontrollermp.DisplayDebugScore" },	// 7175
+	{ 112360, "Function sfxgamempcontent.sfxplayercontrollermp.BeginCountdownTimer" },	// 7176
+	{ 112365, "Function sfxgamempcontent.sfxplayercontrollermp.CancelCountdownTimer" },	// 7177
+	{ 112367, "Function sfxgamempcontent.sfxplayercontrollermp.GetRemainingCountdownTime" },	// 7178
+	{ 112371, "Function sfxgamempcontent.sfxplayercontrollermp.PulsePowerDisplay" },	// 7179
+	{ 112373, "Function sfxgamempcontent.sfxplayercontrollermp.CheckThatGameCanContinue" },	// 7180
+	{ 112374, "Function sfxgamempcontent.sfxplayercontrollermp.BioTalk" },	// 7181
+	{ 112376, "Function sfxgamempcontent.sfxplayercontrollermp.VoicePushToTalkStart" },	// 7182
+	{ 112377, "Function sfxgamempcontent.sfxplayercontrollermp.VoicePushToTalkEnd" },	// 7183
+	{ 112378, "Function sfxgamempcontent.sfxplayercontrollermp.TeamMessage" },	// 7184
+	{ 112383, "Function sfxgamempcontent.sfxplayercontrollermp.OnControllerChanged" },	// 7185
+	{ 112386, "Function sfxgamempcontent.sfxplayercontrollermp.MPBotsClearUsed" },	// 7186
+	{ 112387, "Function sfxgamempcontent.sfxplayercontrollermp.KickPlayer" },	// 7187
+	{ 112390, "Function sfxgamempcontent.sfxplayercontrollermp.ClientKickPlayer" },	// 7188
+	{ 112392, "Function sfxgamempcontent.sfxplayercontrollermp.SetPause" },	// 7189
+	{ 112396, "Function sfxgamempcontent.sfxplayercontrollermp.ServerWaveCoordinatorJoinInProgress" },	// 7190
+	{ 112398, "Function sfxgamempcontent.sfxplayercontrollermp.InternalSawNewEnemy" },	// 7191
+	{ 112404, "Function sfxgamempcontent.sfxplayercontrollermp.ClientPlaySimpleDialogLine" },	// 7192
+	{ 112410, "Function sfxgamempcontent.sfxplayercontrollermp.QuickLoad" },	// 7193
+	{ 112411, "Function sfxgamempcontent.sfxplayercontrollermp.ClientShowExtractionCredits" },	// 7194
+	{ 112416, "Function sfxgamempcontent.sfxplayercontrollermp.BackToMainMenu" },	// 7195
+	{ 112429, "Function sfxgamempcontent.sfxplayercontrollermp.Internal_ResetPlayerController" },	// 7196
+	{ 112430, "Function sfxgamempcontent.sfxplayercontrollermp.SwitchWeapon" },	// 7197
+	{ 112433, "Function sfxgamempcontent.sfxplayercontrollermp.AFK" },	// 7198
+	{ 112437, "Function sfxgamempcontent.sfxplayercontrollermp.SetAFKLastActionTime" },	// 7199
+	{ 112438, "Function sfxgamempcontent.sfxplayercontrollermp.DoAFKTick" },	// 7200
+	{ 112460, "Function sfxgamempcontent.SFXPlayerSquadMP.PostBeginPlay" },	// 7201
+	{ 112461, "Function sfxgamempcontent.SFXPlayerSquadMP.RemoveDyingMember" },	// 7202
+	{ 112463, "Function sfxgamempcontent.SFXPlayerSquadMP.AddMember" },	// 7203
+	{ 112473, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable.OnPowersLoaded" },	// 7204
+	{ 112474, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable.HasCharges" },	// 7205
+	{ 112482, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable.GetChargeCount" },	// 7206
+	{ 112488, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable.UseConsumable" },	// 7207
+	{ 112493, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable.AddAvailableCharges" },	// 7208
+	{ 112496, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable.CanUsePower" },	// 7209
+	{ 112500, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable.GetHUDWheelIconInfo" },	// 7210
+	{ 112502, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable.ShouldUsePower" },	// 7211
+	{ 112507, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable_ammo.OnImpact" },	// 7212
+	{ 112520, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable_ammo.CanUsePower" },	// 7213
+	{ 112534, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable_revive.CanUsePower" },	// 7214
+	{ 112538, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable_revive.InternalCanDoCustomAction" },	// 7215
+	{ 112539, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable_revive.StartPower" },	// 7216
+	{ 112540, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable_revive.OnImpact" },	// 7217
+	{ 112562, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable_rocket.GetWeapon" },	// 7218
+	{ 112565, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable_rocket.OnPawnLoadedWeapons" },	// 7219
+	{ 112567, "Class sfxgamempcontent.sfxweapon_heavy_consumablerocketlauncher" },	// 7220
+	{ 112568, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable_rocket.OnImpact" },	// 7221
+	{ 112578, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable_rocket.RocketConfirmationFromServer" },	// 7222
+	{ 112579, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable_rocket.SetWeaponAmmoFromPower" },	// 7223
+	{ 112580, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable_rocket.AddAvailableCharges" },	// 7224
+	{ 112583, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable_rocket.CanUsePower" },	// 7225
+	{ 112589, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable_shield.OnImpact" },	// 7226
+	{ 112603, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable_shield.StopShieldVFX" },	// 7227
+	{ 112604, "Function sfxgamempcontent.sfxpowercustomactionmp_consumable_shield.RemoveImmunity" },	// 7228
+	{ 112659, "Function sfxgamempcontent.sfxprimp.PostBeginPlay" },	// 7229
+	{ 112660, "Function sfxgamempcontent.sfxprimp.BuildLocalMapArray" },	// 7230
+	{ 112665, "Function sfxgamempcontent.sfxprimp.GetLobbyFlow" },	// 7231
+	{ 112668, "Function sfxgamempcontent.sfxprimp.SetReplicationReady" },	// 7232
+	{ 112669, "Function sfxgamempcontent.sfxprimp.ServerSetReplicationReady" },	// 7233
+	{ 112670, "Function sfxgamempcontent.sfxprimp.ReplicatedEvent" },	// 7234
+	{ 112675, "Function sfxgamempcontent.sfxprimp.SetPawn" },	// 7235
+	{ 112677, "Function sfxgamempcontent.sfxprimp.NotifyPawnCharacterChanged" },	// 7236
+	{ 112678, "Function sfxgamempcontent.sfxprimp.IsAI" },	// 7237
+	{ 112680, "Function sfxgamempcontent.sfxprimp.TriggerNewScoreTag" },	// 7238
+	{ 112685, "Function sfxgamempcontent.sfxprimp.SetComputerName" },	// 7239
+	{ 112687, "Function sfxgamempcontent.sfxprimp.ServerSetComputerName" },	// 7240
+	{ 112689, "Function sfxgamempcontent.sfxprimp.ServerSetCharacterSelection" },	// 7241
+	{ 112692, "Function sfxgamempcontent.sfxprimp.ServerSetWeaponSelection" },	// 7242
+	{ 112695, "Function sfxgamempcontent.sfxprimp.ServerSetPowerSelection" },	// 7243
+	{ 112698, "Function sfxgamempcontent.sfxprimp.ShouldBroadCastWelcomeMessage" },	// 7244
+	{ 112701, "Function sfxgamempcontent.sfxprimp.LoadDataFromSave" },	// 7245
+	{ 112711, "Function sfxgamempcontent.sfxprimp.ClearPowerData" },	// 7246
+	{ 112718, "Function sfxgamempcontent.sfxprimp.ClearWeaponData" },	// 7247
+	{ 112719, "Function sfxgamempcontent.sfxprimp.CanSetReadyInLobby" },	// 7248
+	{ 112721, "Function sfxgamempcontent.sfxprimp.SetReadyInLobby" },	// 7249
+	{ 112723, "Function sfxgamempcontent.sfxprimp.ServerSetReadyInLobby" },	// 7250
+	{ 112725, "Function sfxgamempcontent.sfxprimp.SetReadyToPlay" },	// 7251
+	{ 112730, "Function sfxgamempcontent.sfxprimp.GrantXP" },	// 7252
+	{ 112736, "Function sfxgamempcontent.sfxprimp.GrantCredits" },	// 7253
+	{ 112751, "Function sfxgamempcontent.sfxprimp.GatherMatchResults" },	// 7254
+	{ 112777, "Function sfxgamempcontent.sfxprimp.OnSaveRecordsComplete" },	// 7255
+	{ 112779, "Function sfxgamempcontent.sfxprimp.OnUpdatedRankingsComplete" },	// 7256
+	{ 112783, "Function sfxgamempcontent.sfxprimp.EndOfMatchScreenFinished" },	// 7257
+	{ 112784, "Function sfxgamempcontent.sfxprimp.PRITotalPointSort" },	// 7258
+	{ 112788, "Function sfxgamempcontent.sfxprimp.CopyProperties" },	// 7259
+	{ 112792, "Function sfxgamempcontent.sfxprimp.UnregisterPlayerFromSession" },	// 7260
+	{ 112796, "Function sfxgamempcontent.sfxprimp.OnCharacterChanged" },	// 7261
+	{ 112797, "Function sfxgamempcontent.sfxprimp.GetAPawn" },	// 7262
+	{ 112816, "Function sfxgamempcontent.sfxprimp.SetWeapon" },	// 7263
+	{ 112826, "Function sfxgamempcontent.sfxprimp.SetWeaponMod" },	// 7264
+	{ 112836, "Function sfxgamempcontent.sfxprimp.SetPower" },	// 7265
+	{ 112848, "Function sfxgamempcontent.sfxprimp.SetCharacterKit" },	// 7266
+	{ 112852, "Function sfxgamempcontent.sfxprimp.SetCharacterName" },	// 7267
+	{ 112854, "Function sfxgamempcontent.sfxprimp.SetAppearanceData" },	// 7268
+	{ 112862, "Function sfxgamempcontent.sfxprimp.SetCharacterData" },	// 7269
+	{ 112869, "Function sfxgamempcontent.sfxprimp.GetCharacterData" },	// 7270
+	{ 112876, "Function sfxgamempcontent.sfxprimp.GetAppearanceData" },	// 7271
+	{ 112884, "Function sfxgamempcontent.sfxprimp.GetCharacterData_Patch" },	// 7272
+	{ 112886, "Function sfxgamempcontent.sfxprimp.IsMatchConsumableActive" },	// 7273
+	{ 112903, "Function sfxgamempcontent.sfxprimp.DisplayPlayerMedal" },	// 7274
+	{ 112911, "Function sfxgamempcontent.sfxprimp.AddPlayerMedal" },	// 7275
+	{ 112916, "Function sfxgamempcontent.sfxprimp.OnPlayerMedalsChanged" },	// 7276
+	{ 112923, "Function sfxgamempcontent.sfxprimp.ServerSetMapArray" },	// 7277
+	{ 112926, "Function sfxgamempcontent.sfxprimp.SetKickVote" },	// 7278
+	{ 112928, "Function sfxgamempcontent.sfxprimp.ServerSetKickVote" },	// 7279
+	{ 112930, "Function sfxgamempcontent.sfxprimp.ServerSetReadyToTransitionToLobby" },	// 7280
+	{ 112932, "Function sfxgamempcontent.sfxprimp.SendTelemetryForWeapons" },	// 7281
+	{ 112943, "Function sfxgamempcontent.sfxprimp.GetPlayerChallengeTitle" },	// 7282
+	{ 112950, "Function sfxgamempcontent.sfxprimp.GetCurrentEmblemData" },	// 7283
+	{ 112956, "Function sfxgamempcontent.sfxprimp.ServerSetStoreIsOpen" },	// 7284
+	{ 112957, "Function sfxgamempcontent.sfxprimp.SetStoreIsOpen" },	// 7285
+	{ 112960, "Function sfxgamempcontent.sfxprimp.SetCharacterData_Patch" },	// 7286
+	{ 112970, "Class sfxgamempcontent.SFXProjectile_ConsumableRocket" },	// 7287
+	{ 112971, "Function sfxgamempcontent.SFXProjectile_ConsumableRocket.Explode" },	// 7288
+	{ 112982, "Function sfxgamempcontent.SFXProjectile_ConsumableRocket.DoImpact" },	// 7289
+	{ 112997, "Function sfxgamempcontent.SFXProjectile_ConsumableRocket.GetCappedDamageRadius" },	// 7290
+	{ 112998, "Function sfxgamempcontent.SFXProjectile_ConsumableRocket.GetFarDamage" },	// 7291
+	{ 112999, "Function sfxgamempcontent.SFXProjectile_ConsumableRocket.GetDamageRadius" },	// 7292
+	{ 113009, "Function sfxgamempcontent.SFXProjectile_ConsumableRocket.ProjectileHurtRadius" },	// 7293
+	{ 113021, "Class sfxgamempcontent.SFXRumble_ConsumableRocket" },	// 7294
+	{ 113022, "Class sfxgamempcontent.SFXShake_ConsumableRocket" },	// 7295
+	{ 113141, "Function sfxgamempcontent.SFXWave_Horde.InitializeWave" },	// 7296
+	{ 113151, "Function sfxgamempcontent.SFXWave_Horde.GetEnemySpawnInfoForEnemyType" },	// 7297
+	{ 113152, "Function sfxgamempcontent.SFXWave_Horde.StartAutoBots" },	// 7298
+	{ 113153, "Function sfxgamempcontent.SFXWave_Horde.GetEnemyArray" },	// 7299
+	{ 113159, "Function sfxgamempcontent.SFXWave_Horde.BeginWave" },	// 7300
+	{ 113168, "Function sfxgamempcontent.SFXWave_Horde.FinishWave" },	// 7301
+	{ 113171, "Function sfxgamempcontent.SFXWave_Horde.ChooseEnemyStart" },	// 7302
+	{ 113186, "Function sfxgamempcontent.SFXWave_Horde.RateEnemyStart" },	// 7303
+	{ 113203, "Function sfxgamempcontent.SFXWave_Horde.CanEnemyUseSpawnPoint" },	// 7304
+	{ 113223, "Function sfxgamempcontent.SFXWave_Horde.ChooseSquadToSpawn" },	// 7305
+	{ 113228, "Function sfxgamempcontent.SFXWave_Horde.ChooseEnemyToSpawn" },	// 7306
+	{ 113239, "Function sfxgamempcontent.SFXWave_Horde.AreRemainingEnemiesOnMyTeam" },	// 7307
+	{ 113242, "Function sfxgamempcontent.SFXWave_Horde.SpawnEnemy" },	// 7308
+	{ 113249, "Function sfxgamempcontent.SFXWave_Horde.SpawnHorde" },	// 7309
+	{ 113251, "Function sfxgamempcontent.SFXWave_Horde.EnemyBudgetRemaining" },	// 7310
+	{ 113253, "Function sfxgamempcontent.SFXWave_Horde.ShouldSpawnSquad" },	// 7311
+	{ 113254, "Function sfxgamempcontent.SFXWave_Horde.UpdateObjectiveStatus" },	// 7312
+	{ 113258, "Function sfxgamempcontent.SFXWave_Horde.ActivateEnemyObjectiveMarkers" },	// 7313
+	{ 113261, "Function sfxgamempcontent.SFXWave_Horde.PawnDied" },	// 7314
+	{ 113267, "Function sfxgamempcontent.SFXWave_Horde.GetPlayerCount" },	// 7315
+	{ 113274, "Function sfxgamempcontent.SFXWave_Horde.TriggerWaveStartEvent" },	// 7316
+	{ 113282, "Function sfxgamempcontent.SFXWave_Horde.TriggerEnemyKilledEvent" },	// 7317
+	{ 113290, "Function sfxgamempcontent.SFXWave_Horde.TriggerWaveEndEvent" },	// 7318
+	{ 113298, "Function sfxgamempcontent.SFXWave_Horde.GetCreatureWaveCost" },	// 7319
+	{ 113304, "Function sfxgamempcontent.SFXWave_Horde.StopSpawningNewEnemies" },	// 7320
+	{ 113308, "Function sfxgamempcontent.SFXWave_Horde.PawnRevived" },	// 7321
+	{ 113312, "Function sfxgamempcontent.SFXWave_Horde.CalculateSpawnedEnemyCost" },	// 7322
+	{ 113316, "Function sfxgamempcontent.SFXWave_Horde.GetScoreBudget" },	// 7323
+	{ 113323, "Class sfxgamempcontent.SFXWave_Horde_Cerberus" },	// 7324
+	{ 113325, "Class sfxgamempcontent.SFXWave_Horde_Geth" },	// 7325
+	{ 113327, "Class sfxgamempcontent.SFXWave_Horde_Reaper" },	// 7326
+	{ 113337, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.ReplicatedEvent" },	// 7327
+	{ 113339, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.PreBeginPlay" },	// 7328
+	{ 113341, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.PostBeginPlay" },	// 7329
+	{ 113345, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.StartWaves" },	// 7330
+	{ 113352, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.UpdateCurrentWaveNumber" },	// 7331
+	{ 113354, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.EndWaves" },	// 7332
+	{ 113355, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.GetPercentOfWavesCompleted" },	// 7333
+	{ 113358, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.GoToWave" },	// 7334
+	{ 113360, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.GenerateHordeWaveList" },	// 7335
+	{ 113362, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.GenerateOperationWaveList" },	// 7336
+	{ 113364, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.OnWaveFinished" },	// 7337
+	{ 113376, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.IsCurrentWaveAnOperation" },	// 7338
+	{ 113377, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.AdvanceToNextWave" },	// 7339
+	{ 113380, "Function sfxgamempcontent.sfxwavemanager_horde.GetWaveIndex" },	// 7340
+	{ 113384, "Function sfxgamempcontent.SFXWaveManager_Operation.GetWaveIndex" },	// 7341
+	{ 113386, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.StartNewWave" },	// 7342
+	{ 113402, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.OnAllWavesFinishedLoading" },	// 7343
+	{ 113407, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.OnAllWavesFinished" },	// 7344
+	{ 113413, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.DisplayDebugCountdown" },	// 7345
+	{ 113414, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.EndOfWave" },	// 7346
+	{ 113420, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.IsSpecifiedWaveAnOperation" },	// 7347
+	{ 113427, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.ReplicatedWaveEventUpdated" },	// 7348
+	{ 113429, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.ReplicateWaveEventInfo" },	// 7349
+	{ 113431, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.SyncWithServer" },	// 7350
+	{ 113432, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.HandleJoinInProgress" },	// 7351
+	{ 113433, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.HandleHostMigration" },	// 7352
+	{ 113434, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.RecoverFromWaveEventInfo" },	// 7353
+	{ 113437, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.SyncClientMatchTimer" },	// 7354
+	{ 113439, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.ClientHandleJoinInProgress" },	// 7355
+	{ 113440, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.PawnDowned" },	// 7356
+	{ 113442, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.PlayManDownVO" },	// 7357
+	{ 113445, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.PlayInstructionVO" },	// 7358
+	{ 113446, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.PlayHordeGameStartedVO" },	// 7359
+	{ 113447, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.OnSingleEnemyRemaining" },	// 7360
+	{ 113451, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.PlayEndWaveCongratulationsVO" },	// 7361
+	{ 113455, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.PlayHalfWavesDoneVO" },	// 7362
+	{ 113456, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.PlayHordeWaveDoneVO" },	// 7363
+	{ 113463, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.GetEnemyScoreBudget" },	// 7364
+	{ 113468, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.GetObjectiveCreditBudget" },	// 7365
+	{ 113471, "Function sfxgamempcontent.sfxwavecoordinator_hordeoperation.GetObjectiveScoreBudget" },	// 7366
+	{ 113483, "Function sfxgamempcontent.sfxwavemanager_horde.GeneratePotentialWaveList" },	// 7367
+	{ 113491, "Function sfxgamempcontent.sfxwavemanager_horde.SelectWaveType" },	// 7368
+	{ 113500, "Function sfxgamempcontent.sfxwavemanager_horde.HordeWaveSort" },	// 7369
+	{ 113504, "Function sfxgamempcontent.sfxwavemanager_horde.WavePointsForRound" },	// 7370
+	{ 113510, "Function sfxgamempcontent.sfxwavemanager_horde.GenerateEnemySpawnPointList" },	// 7371
+	{ 113517, "Function sfxgamempcontent.SFXWaveManager_Operation.ReplicatedEvent" },	// 7372
+	{ 113519, "Function sfxgamempcontent.SFXWaveManager_Operation.GeneratePotentialWaveList" },	// 7373
+	{ 113537, "Function sfxgamempcontent.SFXWaveManager_Operation.SortObjectByName" },	// 7374
+	{ 113554, "Function sfxgamempcontent.SFXWaveManager_Operation.GetWaveType" },	// 7375
+	{ 113557, "Function sfxgamempcontent.SFXWaveManager_Operation.MatchTimerSync" },	// 7376
+	{ 113558, "Function sfxgamempcontent.SFXWaveManager_Operation.SyncClientMatchTimer" },	// 7377
+	{ 113561, "Function sfxgamempcontent.SFXWaveManager_Operation.ForceMatchTimerSync" },	// 7378
+	{ 113564, "Function sfxgamempcontent.sfxweapon_heavy_consumablerocketlauncher.GetAmmoCountInMagazine" },	// 7379
+	{ 113567, "Function sfxgamempcontent.sfxweapon_heavy_consumablerocketlauncher.HasAmmo" },	// 7380
+	{ 113571, "Function sfxgamempcontent.sfxweapon_heavy_consumablerocketlauncher.StartFire" },	// 7381
+	{ 113573, "Function sfxgamempcontent.sfxweapon_heavy_consumablerocketlauncher.ServerPlayNoAmmoEffects" },	// 7382
+	{ 113574, "Function sfxgamempcontent.sfxweapon_heavy_consumablerocketlauncher.StartChargeEffects" },	// 7383
+	{ 113577, "Function sfxgamempcontent.sfxweapon_heavy_consumablerocketlauncher.ServerCurrentWeapon" },	// 7384
+	{ 113581, "Function sfxgamempcontent.sfxweapon_heavy_consumablerocketlauncher.StopChargeEffects" },	// 7385
+	{ 113583, "Function sfxgamempcontent.sfxweapon_heavy_consumablerocketlauncher.FireAmmunition" },	// 7386
+	{ 113587, "Function sfxgamempcontent.sfxweapon_heavy_consumablerocketlauncher.ShutOffAllEmitters" },	// 7387
+	{ 113589, "Function sfxgamempcontent.sfxweapon_heavy_consumablerocketlauncher.ConsumeAmmo" },	// 7388
+	{ 113591, "Function sfxgamempcontent.sfxweapon_heavy_consumablerocketlauncher.PutDownWeapon" },	// 7389
+	{ 113592, "Function sfxgamempcontent.sfxweapon_heavy_consumablerocketlauncher.InitializeWeapon" },	// 7390
+	{ 113593, "Function sfxgamempcontent.sfxweapon_heavy_consumablerocketlauncher.DropGun" },	// 7391
+	{ 113594, "Function sfxgamempcontent.sfxweapon_heavy_consumablerocketlauncher.ClientRocketFired" },	// 7392
+	{ 124467, "Class sfxgamempcontentdlc_shared_mp.SFXEngagement_Retrieve_DLC_Base" },	// 7393
+	{ 124480, "Class sfxgamecontentdlc_con_mp2_retrieve.sfxengagement_retrieve_dlc" },	// 7394
+	{ 124491, "Function sfxgamecontentdlc_con_mp2_retrieve.sfxengagement_retrieve_dlc.BeginWave" },	// 7395
+	{ 124519, "Function sfxgamecontentdlc_con_mp2_retrieve.sfxengagement_retrieve_dlc.DistributeObjectiveScore" },	// 7396
+	{ 124531, "Function sfxgamecontentdlc_con_mp2_retrieve.sfxengagement_retrieve_dlc.DetermineObjectivesToSpawn" },	// 7397
+	{ 124545, "Function sfxgamecontentdlc_con_mp2_retrieve.sfxengagement_retrieve_dlc.ActivateRandomPickup" },	// 7398
+	{ 124548, "Function sfxgamecontentdlc_con_mp2_retrieve.sfxengagement_retrieve_dlc.UpdateObjectiveStatus" },	// 7399
+	{ 124549, "Function sfxgamecontentdlc_con_mp2_retrieve.sfxengagement_retrieve_dlc.IsCarryingPickup" },	// 7400
+	{ 124552, "Function sfxgamecontentdlc_con_mp2_retrieve.sfxengagement_retrieve_dlc.PlayerPickedUpObject" },	// 7401
+	{ 124554, "Function sfxgamecontentdlc_con_mp2_retrieve.sfxengagement_retrieve_dlc.PlayerDroppedObject" },	// 7402
+	{ 124556, "Function sfxgamecontentdlc_con_mp2_retrieve.sfxengagement_retrieve_dlc.PickupDroppedOff" },	// 7403
+	{ 124563, "Function sfxgamecontentdlc_con_mp2_retrieve.sfxengagement_retrieve_dlc.PlayDroppedOffVO" },	// 7404
+	{ 124617, "Class sfxgamempcontentdlc_shared_mp.SFXEngagement_MobileAnnex_Base" },	// 7405
+	{ 124620, "Class SFXGameContentDLC_CON_MP3_MobileAnnex.SFXEngagement_MobileAnnex" },	// 7406
+	{ 124673, "Class sfxgamecontentdlc_con_mp4_horde.SFXGUI_CollectorHUDOverlay" },	// 7407
+	{ 124681, "Function sfxgamecontentdlc_con_mp4_horde.SFXGUI_CollectorHUDOverlay.OnStart" },	// 7408
+	{ 124682, "Function sfxgamecontentdlc_con_mp4_horde.SFXGUI_CollectorHUDOverlay.InternalOnStart" },	// 7409
+	{ 124683, "Function sfxgamecontentdlc_con_mp4_horde.SFXGUI_CollectorHUDOverlay.CheckInitialize" },	// 7410
+	{ 124689, "Function sfxgamecontentdlc_con_mp4_horde.SFXGUI_CollectorHUDOverlay.ClearSwarmOverlays" },	// 7411
+	{ 124690, "Function sfxgamecontentdlc_con_mp4_horde.SFXGUI_CollectorHUDOverlay.InitializePCQuickslotIconOverlays" },	// 7412
+	{ 124691, "Function sfxgamecontentdlc_con_mp4_horde.SFXGUI_CollectorHUDOverlay.InitializeMPHUDPowerIconOverlays" },	// 7413
+	{ 124692, "Function sfxgamecontentdlc_con_mp4_horde.SFXGUI_CollectorHUDOverlay.PositionPowerIconOverlays" },	// 7414
+	{ 124693, "Function sfxgamecontentdlc_con_mp4_horde.SFXGUI_CollectorHUDOverlay.SetForcedCooldown" },	// 7415
+	{ 124695, "Function sfxgamecontentdlc_con_mp4_horde.SFXGUI_CollectorHUDOverlay.UpdateCooldownOverride" },	// 7416
+	{ 124697, "Function sfxgamecontentdlc_con_mp4_horde.SFXGUI_CollectorHUDOverlay.ResetForcedCooldown" },	// 7417
+	{ 124699, "Function sfxgamecontentdlc_con_mp4_horde.SFXGUI_CollectorHUDOverlay.OnClose" },	// 7418
+	{ 124701, "Function sfxgamecontentdlc_con_mp4_horde.SFXGUI_CollectorHUDOverlay.AS_ResetCooldownPowerIcons" },	// 7419
+	{ 124703, "Function sfxgamecontentdlc_con_mp4_horde.SFXGUI_CollectorHUDOverlay.InitializePowerIconOverlay" },	// 7420
+	{ 124714, "Function sfxgamecontentdlc_con_mp4_horde.SFXGUI_CollectorHUDOverlay.AS_GetCollectorCooldownForPowerIcon" },	// 7421
+	{ 124718, "Function sfxgamecontentdlc_con_mp4_horde.SFXGUI_CollectorHUDOverlay.GetGlobalPosition" },	// 7422
+	{ 124737, "Class sfxgamempcontentdlc_shared_mp.SFXSharedMP_ForcedReference" },	// 7423
+	{ 124739, "Class sfxgamecontentdlc_con_mp4_horde.SFXMP4_ForcedReference" },	// 7424
+	{ 124741, "Class sfxgamecontentdlc_con_mp4_horde.SFXWave_Horde_Cerberus2" },	// 7425
+	{ 124743, "Class sfxgamecontentdlc_con_mp4_horde.SFXWave_Horde_Collector" },	// 7426
+	{ 124745, "Class sfxgamecontentdlc_con_mp4_horde.SFXWave_Horde_Geth2" },	// 7427
+	{ 124747, "Class sfxgamecontentdlc_con_mp4_horde.SFXWave_Horde_Reaper2" },	// 7428
+	{ 124889, "Class sfxgamempcontent.SFXSeqAct_CloseMPWeaponSelect" },	// 7429
+	{ 124895, "Class sfxgamempcontentdlc_shared_mp.SFXGameInfoMP_Lobby_DLC" },	// 7430
+	{ 124900, "Class sfxgamempcontentdlc_shared_mp.SFXGUI_MPWeaponSelection_DLC" },	// 7431
+	{ 124901, "Class sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges" },	// 7432
+	{ 124904, "Class sfxgamempcontentdlc_shared_mp.SFXGUI_MPLobby_DLC" },	// 7433
+	{ 124905, "Class sfxgamempcontentdlc_shared_mp.SFXGUI_MPSelectKit_DLC" },	// 7434
+	{ 124906, "Class sfxgamempcontentdlc_shared_mp.SFXGUI_MPMatchConsumables_DLC" },	// 7435
+	{ 124921, "Class sfxgamempcontentdlc_shared_mp.SFXGUI_MPReinforcementsReveal_DLC" },	// 7436
+	{ 124924, "Class sfxgamempcontentdlc_shared_mp.SFXGAWReinforcementMatchConsumable_Gear" },	// 7437
+	{ 124939, "Function sfxgamempcontentdlc_shared_mp.SFXGAWReinforcementMatchConsumable_Gear.PrepareCustomTokensForGearDescription" },	// 7438
+	{ 124944, "Function sfxgamempcontentdlc_shared_mp.SFXGAWReinforcementMatchConsumable_Gear.FindDescriptionTokens" },	// 7439
+	{ 124949, "Function sfxgamempcontentdlc_shared_mp.SFXGAWReinforcementMatchConsumable_Gear.FloatToPercentString" },	// 7440
+	{ 124952, "Function sfxgamempcontentdlc_shared_mp.SFXGAWReinforcementMatchConsumable_Gear.TrimTrailingZeroes" },	// 7441
+	{ 124956, "Function sfxgamempcontentdlc_shared_mp.SFXGAWReinforcementMatchConsumable_Gear.IsActive" },	// 7442
+	{ 124963, "Function sfxgamempcontentdlc_shared_mp.SFXGAWReinforcementMatchConsumable_Gear.Activate" },	// 7443
+	{ 124969, "Function sfxgamempcontentdlc_shared_mp.SFXGAWReinforcementMatchConsumable_Gear.Deactivate" },	// 7444
+	{ 124975, "Function sfxgamempcontentdlc_shared_mp.SFXGAWReinforcementMatchConsumable_Gear.OnAwarded" },	// 7445
+	{ 125032, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.OnStart" },	// 7446
+	{ 125033, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.SetupFunctionIntercepts" },	// 7447
+	{ 125034, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.ConstructEnumObjects" },	// 7448
+	{ 125035, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.OnClose" },	// 7449
+	{ 125037, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.ResetStartupOverrides" },	// 7450
+	{ 125042, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.ChallengeSort_Rank_Index" },	// 7451
+	{ 125046, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.ChallengeSort_Parent" },	// 7452
+	{ 125050, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.CheckInitializeData" },	// 7453
+	{ 125053, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.InitializeChallengeArray" },	// 7454
+	{ 125060, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.BuildPercentCompletion" },	// 7455
+	{ 125061, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.BuildUIData" },	// 7456
+	{ 125087, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.IsAccomplishmentRepeatable" },	// 7457
+	{ 125099, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.BuildPercentCompletion_Helper" },	// 7458
+	{ 125124, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.ExInitializeJournal" },	// 7459
+	{ 125125, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.AS_SetupVisualState" },	// 7460
+	{ 125126, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.AS_SetUnreadItemCounts" },	// 7461
+	{ 125127, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.ExFocusOnTab" },	// 7462
+	{ 125130, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.DisplayCategoryChallenges" },	// 7463
+	{ 125139, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.AS_StartDisplayList" },	// 7464
+	{ 125140, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.AS_AddListItems" },	// 7465
+	{ 125141, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.AS_EndDisplayList" },	// 7466
+	{ 125142, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.ExSetLastEntry" },	// 7467
+	{ 125146, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.SetDetails" },	// 7468
+	{ 125147, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.ExExpandEntry" },	// 7469
+	{ 125148, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.ExpandListEntry" },	// 7470
+	{ 125158, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.AS_SetSubItems" },	// 7471
+	{ 125159, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.ExFocusOnSubentry" },	// 7472
+	{ 125161, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.FocusOnSubentry" },	// 7473
+	{ 125165, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.HandleRewardSelection" },	// 7474
+	{ 125174, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.DoNothingFunction" },	// 7475
+	{ 125175, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.SetRewardButtonVisibility" },	// 7476
+	{ 125178, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.SetRewardButtonEnabled" },	// 7477
+	{ 125186, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.AS_SetDetails" },	// 7478
+	{ 125187, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.OnRequestImageComplete" },	// 7479
+	{ 125189, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.ReturnToBrowser" },	// 7480
+	{ 125190, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.HandleInputEvent" },	// 7481
+	{ 125194, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.AS_ScrollDetailsAnalog" },	// 7482
+	{ 125195, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges.SetAccomplishmentRepeatable" },	// 7483
+	{ 125336, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPSelectKit_DLC.ShowCharacterInfo" },	// 7484
+	{ 125341, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPSelectKit_DLC.ComposeKitDescriptionString" },	// 7485
+	{ 125345, "Function sfxgamempcontentdlc_shared_mp.SFXGUI_MPSelectKit_DLC.ShowCharacterInfoCallback" },	// 7486
+	{ 127520, "Class sfxgamecontent.SFXCharacterClass_Content" },	// 7487
+	{ 127522, "Class sfxgamecontent.sfxcustomaction_revive" },	// 7488
+	{ 127523, "Class sfxgamecontent.SFXCustomAction_Reload" },	// 7489
+	{ 127524, "Class sfxgamecontent.SFXCustomAction_ActivateWeaponFlashlight" },	// 7490
+	{ 127525, "Class sfxgamecontent.SFXCustomAction_MantleLookAt" },	// 7491
+	{ 127526, "Class sfxgamecontent.SFXCustomAction_CoverSlipLookAt" },	// 7492
+	{ 127527, "Class sfxgamecontent.SFXCustomAction_StdCoverSlipLookAt" },	// 7493
+	{ 127528, "Class sfxgamecontent.SFXCustomAction_SwatTurnLookAt" },	// 7494
+	{ 127529, "Class sfxgamecontent.SFXCustomAction_StdSwatTurnLookAt" },	// 7495
+	{ 127530, "Class sfxgamecontent.SFXCustomAction_GapJump" },	// 7496
+	{ 127531, "Class sfxgamecontent.SFXCustomAction_StandingGapJump" },	// 7497
+	{ 127532, "Class sfxgamecontent.SFXCustomAction_JumpDown" },	// 7498
+	{ 127533, "Class sfxgamecontent.SFXCustomAction_PlayerMantleOverCover" },	// 7499
+	{ 127534, "Class sfxgamecontent.SFXCustomAction_PlayerMantleUp" },	// 7500
+	{ 127535, "Class sfxgamecontent.sfxcustomaction_simplemovebase" },	// 7501
+	{ 127536, "Class sfxgamecontent.SFXCustomAction_PlayerCoverSlipLeft" },	// 7502
+	{ 127537, "Class sfxgamecontent.SFXCustomAction_PlayerCoverSlipLeftStanding" },	// 7503
+	{ 127538, "Class sfxgamecontent.SFXCustomAction_PlayerCoverSlipRight" },	// 7504
+	{ 127539, "Class sfxgamecontent.SFXCustomAction_PlayerCoverSlipRightStanding" },	// 7505
+	{ 127540, "Class sfxgamecontent.SFXCustomAction_PlayerLadderClimbUp" },	// 7506
+	{ 127541, "Class sfxgamecontent.SFXCustomAction_PlayerLadderClimbDown" },	// 7507
+	{ 127542, "Class sfxgamecontent.SFXCustomAction_PlayerEvadeLeft" },	// 7508
+	{ 127543, "Class sfxgamecontent.SFXCustomAction_PlayerEvadeRight" },	// 7509
+	{ 127544, "Class sfxgamecontent.SFXCustomAction_PlayerEvadeForward" },	// 7510
+	{ 127545, "Class sfxgamecontent.SFXCustomAction_PlayerEvadeBackwards" },	// 7511
+	{ 127546, "Class sfxgamecontent.SFXCustomAction_MantleMelee" },	// 7512
+	{ 127547, "Class sfxgamecontent.SFXCustomAction_SyncCoverGrab" },	// 7513
+	{ 127548, "Class sfxgamecontent.SFXCustomAction_SyncCoverMelee" },	// 7514
+	{ 127549, "Class sfxgamecontent.SFXCustomAction_StdCoverMeleeLeft" },	// 7515
+	{ 127550, "Class sfxgamecontent.SFXCustomAction_CoverMeleeLeft" },	// 7516
+	{ 127551, "Class sfxgamecontent.SFXCustomAction_CoverMeleeRight" },	// 7517
+	{ 127552, "Class sfxgamecontent.SFXCustomAction_StdCoverMeleeRight" },	// 7518
+	{ 127553, "Class sfxgamecontent.SFXCustomAction_HvyStdCoverMeleeLeft" },	// 7519
+	{ 127554, "Class sfxgamecontent.SFXCustomAction_HvyCoverMeleeLeft" },	// 7520
+	{ 127555, "Class sfxgamecontent.SFXCustomAction_HvyCoverMeleeRight" },	// 7521
+	{ 127556, "Class sfxgamecontent.SFXCustomAction_HvyStdCoverMeleeRight" },	// 7522
+	{ 127557, "Class sfxgamecontent.SFXCustomAction_RifleMeleeOne" },	// 7523
+	{ 127558, "Class sfxgamecontent.SFXCustomAction_RifleMeleeTwo" },	// 7524
+	{ 127559, "Class sfxgamecontent.SFXCustomAction_RifleMeleeThree" },	// 7525
+	{ 127560, "Class sfxgamecontent.SFXCustomAction_PistolMeleeOne" },	// 7526
+	{ 127561, "Class sfxgamecontent.SFXCustomAction_PistolMeleeTwo" },	// 7527
+	{ 127562, "Class sfxgamecontent.SFXCustomAction_PistolMeleeThree" },	// 7528
+	{ 127563, "Class sfxgamecontent.SFXCustomAction_PlayerStandardImpact" },	// 7529
+	{ 127564, "Class sfxgamecontent.SFXCustomAction_PlayerStandardImpactForward" },	// 7530
+	{ 127565, "Class sfxgamecontent.SFXCustomAction_PlayerStandardImpactLeft" },	// 7531
+	{ 127566, "Class sfxgamecontent.SFXCustomAction_PlayerStandardImpactRight" },	// 7532
+	{ 127567, "Class sfxgamecontent.SFXCustomAction_PlayerMeleed" },	// 7533
+	{ 127568, "Class sfxgamecontent.SFXCustomAction_KnockbackImpactForward" },	// 7534
+	{ 127569, "Class sfxgamecontent.SFXCustomAction_MeleedLeft" },	// 7535
+	{ 127570, "Class sfxgamecontent.SFXCustomAction_MeleedRight" },	// 7536
+	{ 127571, "Class sfxgamecontent.SFXCustomAction_KnockbackImpact" },	// 7537
+	{ 127572, "Class sfxgamecontent.SFXCustomAction_KnockbackImpactLeft" },	// 7538
+	{ 127573, "Class sfxgamecontent.SFXCustomAction_KnockbackImpactRight" },	// 7539
+	{ 127574, "Class sfxgamecontent.SFXCustomAction_MeleedForward" },	// 7540
+	{ 127575, "Class sfxgamecontent.SFXCustomAction_FlinchLight" },	// 7541
+	{ 127576, "Class sfxgamecontent.SFXCustomAction_FlinchBase" },	// 7542
+	{ 127577, "Class sfxgamecontent.SFXCustomAction_FlinchHeavy" },	// 7543
+	{ 127578, "Class sfxgamecontent.SFXCustomAction_PlayerOnFire" },	// 7544
+	{ 127579, "Function sfxgamecontent.SFXCustomAction_ActivateWeaponFlashlight.StartCustomAction" },	// 7545
+	{ 127581, "Function sfxgamecontent.SFXCustomAction_ActivateWeaponFlashlight.StopCustomAction" },	// 7546
+	{ 127584, "Class sfxgamecontent.SFXCustomAction_AdeptPunch" },	// 7547
+	{ 127595, "Class sfxgamecontent.SFXDamageType_AdeptHeavyMelee" },	// 7548
+	{ 127599, "Function sfxgamecontent.SFXCustomAction_SyncCoverGrab.StartMeleeAttack" },	// 7549
+	{ 127602, "Class sfxgamecontent.SFXSeqEvt_PerformedMeleeOverCover" },	// 7550
+	{ 127603, "Function sfxgamecontent.SFXCustomAction_SyncCoverGrab.InternalCanDoCustomAction" },	// 7551
+	{ 127609, "Function sfxgamecontent.SFXCustomAction_SyncCoverGrab.VerifyVictimDestIsClear" },	// 7552
+	{ 127620, "Function sfxgamecontent.SFXCustomAction_SyncCoverGrab.ShouldPlayMirrorAnim" },	// 7553
+	{ 127627, "Function sfxgamecontent.SFXCustomAction_SyncCoverGrab.StartCustomAction" },	// 7554
+	{ 127631, "Function sfxgamecontent.SFXCustomAction_SyncCoverGrab.GetVictimPawn" },	// 7555
+	{ 127639, "Function sfxgamecontent.SFXCustomAction_SyncCoverGrab.GetAttackerAnim" },	// 7556
+	{ 127642, "Function sfxgamecontent.SFXCustomAction_SyncCoverGrab.GetVictimAnim" },	// 7557
+	{ 127645, "Function sfxgamecontent.SFXCustomAction_SyncCoverGrab.SyncAttack" },	// 7558
+	{ 127646, "Function sfxgamecontent.SFXCustomAction_SyncCoverGrab.NonSyncedAction" },	// 7559
+	{ 127647, "Function sfxgamecontent.SFXCustomAction_SyncCoverGrab.StopCustomAction" },	// 7560
+	{ 127652, "Class sfxgamecontent.SFXCustomAction_AdeptSyncCoverGrab" },	// 7561
+	{ 127669, "Function sfxgamecontent.SFXCustomAction_CoverSlipLookAt.GetStartBodyStanceAnim" },	// 7562
+	{ 127673, "Function sfxgamecontent.SFXCustomAction_CoverSlipLookAt.GetLoopBodyStanceAnim" },	// 7563
+	{ 127677, "Function sfxgamecontent.SFXCustomAction_CoverSlipLookAt.GetEndBodyStanceAnim" },	// 7564
+	{ 127681, "Function sfxgamecontent.SFXCustomAction_CoverSlipLookAt.GetUsedAnimNames" },	// 7565
+	{ 127684, "Function sfxgamecontent.SFXCustomAction_CoverSlipLookAt.FlinchActionOverride" },	// 7566
+	{ 127687, "Function sfxgamecontent.SFXCustomAction_FlinchBase.GetUsedAnimNames" },	// 7567
+	{ 127700, "Function sfxgamecontent.SFXCustomAction_FlinchBase.InternalCanDoCustomAction" },	// 7568
+	{ 127704, "Function sfxgamecontent.SFXCustomAction_FlinchBase.GetBodyStanceAnim" },	// 7569
+	{ 127709, "Function sfxgamecontent.SFXCustomAction_FlinchBase.StartCustomAction" },	// 7570
+	{ 127711, "Function sfxgamecontent.SFXCustomAction_FlinchBase.StopCustomAction" },	// 7571
+	{ 127712, "Function sfxgamecontent.SFXCustomAction_FlinchBase.FlinchActionOverride" },	// 7572
+	{ 127713, "Function sfxgamecontent.SFXCustomAction_FlinchBase.PlayWhizSound" },	// 7573
+	{ 127716, "Function sfxgamecontent.SFXCustomAction_FlinchBase.PlayImpactSound" },	// 7574
+	{ 127731, "Function sfxgamecontent.SFXCustomAction_GapJump.GetUsedAnimNames" },	// 7575
+	{ 127735, "Function sfxgamecontent.SFXCustomAction_GapJump.StartCustomAction" },	// 7576
+	{ 127739, "Function sfxgamecontent.SFXCustomAction_GapJump.AlignmentTimeout" },	// 7577
+	{ 127740, "Function sfxgamecontent.SFXCustomAction_GapJump.ReachedPrecisePosition" },	// 7578
+	{ 127741, "Function sfxgamecontent.SFXCustomAction_GapJump.StartAnimation" },	// 7579
+	{ 127749, "Function sfxgamecontent.SFXCustomAction_GapJump.StopCustomAction" },	// 7580
+	{ 127750, "Function sfxgamecontent.SFXCustomAction_GapJump.BodyStanceAnimEndNotification" },	// 7581
+	{ 127754, "Function sfxgamecontent.SFXCustomAction_GapJump.BlockMoveEndPoints" },	// 7582
+	{ 127758, "Function sfxgamecontent.SFXCustomAction_GapJump.RemoveBlockingEndPoints" },	// 7583
+	{ 127760, "Function sfxgamecontent.SFXCustomAction_GapJump.EndThisCustomAction" },	// 7584
+	{ 127761, "Function sfxgamecontent.SFXCustomAction_GapJump.NotifyBump" },	// 7585
+	{ 127803, "Function sfxgamecontent.SFXCustomAction_MantleLookAt.GetStartBodyStanceAnim" },	// 7586
+	{ 127807, "Function sfxgamecontent.SFXCustomAction_MantleLookAt.GetLoopBodyStanceAnim" },	// 7587
+	{ 127811, "Function sfxgamecontent.SFXCustomAction_MantleLookAt.GetEndBodyStanceAnim" },	// 7588
+	{ 127815, "Function sfxgamecontent.SFXCustomAction_MantleLookAt.GetUsedAnimNames" },	// 7589
+	{ 127818, "Function sfxgamecontent.SFXCustomAction_MantleLookAt.FlinchActionOverride" },	// 7590
+	{ 127823, "Function sfxgamecontent.SFXCustomAction_MantleMelee.StartCustomAction" },	// 7591
+	{ 127824, "Function sfxgamecontent.SFXCustomAction_MantleMelee.StopCustomAction" },	// 7592
+	{ 127825, "Function sfxgamecontent.SFXCustomAction_MantleMelee.ClientDoCustomActionImpact" },	// 7593
+	{ 127834, "Function sfxgamecontent.SFXCustomAction_MantleMelee.NotifyBump" },	// 7594
+	{ 127838, "Function sfxgamecontent.SFXCustomAction_MantleMelee.Breakout" },	// 7595
+	{ 127840, "Function sfxgamecontent.SFXCustomAction_MantleMelee.EndThisCustomAction" },	// 7596
+	{ 127845, "Class sfxgamecontent.SFXCustomAction_Meleed" },	// 7597
+	{ 127879, "Class sfxgamecontent.SFXGameEffect_DisableAI" },	// 7598
+	{ 127930, "Function sfxgamecontent.SFXCustomAction_PlayerEvadeBackwards.InternalCanDoCustomAction" },	// 7599
+	{ 127934, "Function sfxgamecontent.SFXCustomAction_PlayerEvadeBackwards.StartCustomAction" },	// 7600
+	{ 127937, "Function sfxgamecontent.SFXCustomAction_PlayerEvadeBackwards.StopCustomAction" },	// 7601
+	{ 127938, "Function sfxgamecontent.SFXCustomAction_PlayerEvadeBackwards.RollOverride" },	// 7602
+	{ 127939, "Function sfxgamecontent.SFXCustomAction_PlayerEvadeBackwards.ClientDoCustomActionImpact" },	// 7603
+	{ 127951, "Function sfxgamecontent.SFXCustomAction_PlayerEvadeForward.InternalCanDoCustomAction" },	// 7604
+	{ 127955, "Function sfxgamecontent.SFXCustomAction_PlayerEvadeForward.StartCustomAction" },	// 7605
+	{ 127959, "Function sfxgamecontent.SFXCustomAction_PlayerEvadeForward.SyncRotation" },	// 7606
+	{ 127963, "Function sfxgamecontent.SFXCustomAction_PlayerEvadeForward.EndThisCustomAction" },	// 7607
+	{ 127964, "Function sfxgamecontent.SFXCustomAction_PlayerEvadeForward.NotifyHitWall" },	// 7608
+	{ 127969, "Function sfxgamecontent.SFXCustomAction_PlayerEvadeForward.TurnOnHitWall" },	// 7609
+	{ 127970, "Function sfxgamecontent.SFXCustomAction_PlayerEvadeForward.StopCustomAction" },	// 7610
+	{ 127971, "Function sfxgamecontent.SFXCustomAction_PlayerEvadeForward.RollOverride" },	// 7611
+	{ 127972, "Function sfxgamecontent.SFXCustomAction_PlayerEvadeForward.ClientDoCustomActionImpact" },	// 7612
+	{ 127985, "Function sfxgamecontent.SFXCustomAction_PlayerEvadeLeft.InternalCanDoCustomAction" },	// 7613
+	{ 127989, "Function sfxgamecontent.SFXCustomAction_PlayerEvadeLeft.StartCustomAction" },	// 7614
+	{ 127992, "Function sfxgamecontent.SFXCustomAction_PlayerEvadeLeft.RollOverride" },	// 7615
+	{ 127995, "Function sfxgamecontent.SFXCustomAction_PlayerEvadeRight.InternalCanDoCustomAction" },	// 7616
+	{ 127999, "Function sfxgamecontent.SFXCustomAction_PlayerEvadeRight.StartCustomAction" },	// 7617
+	{ 128002, "Function sfxgamecontent.SFXCustomAction_PlayerEvadeRight.RollOverride" },	// 7618
+	{ 128005, "Class sfxgamecontent.SFXCustomAction_PlayerKnockbackImpact" },	// 7619
+	{ 128012, "Function sfxgamecontent.SFXCustomAction_PlayerLadderClimbUp.GetUsedAnimNames" },	// 7620
+	{ 128017, "Function sfxgamecontent.SFXCustomAction_PlayerLadderClimbUp.TickInput" },	// 7621
+	{ 128020, "Function sfxgamecontent.SFXCustomAction_PlayerLadderClimbUp.StartCustomAction" },	// 7622
+	{ 128025, "Function sfxgamecontent.SFXCustomAction_PlayerLadderClimbUp.TickAlignment" },	// 7623
+	{ 128030, "Function sfxgamecontent.SFXCustomAction_PlayerLadderClimbUp.SyncJumpEntrance" },	// 7624
+	{ 128033, "Function sfxgamecontent.SFXCustomAction_PlayerLadderClimbUp.SyncRotation" },	// 7625
+	{ 128039, "Function sfxgamecontent.SFXCustomAction_PlayerLadderClimbUp.TickCustomAction" },	// 7626
+	{ 128043, "Function sfxgamecontent.SFXCustomAction_PlayerLadderClimbUp.SetMoveStage" },	// 7627
+	{ 128049, "Function sfxgamecontent.SFXCustomAction_PlayerLadderClimbUp.PreAlignPawnLocation" },	// 7628
+	{ 128053, "Function sfxgamecontent.SFXCustomAction_PlayerLadderClimbUp.StopCustomAction" },	// 7629
+	{ 128055, "Function sfxgamecontent.SFXCustomAction_PlayerMantleOverCover.StartCustomAction" },	// 7630
+	{ 128059, "Function sfxgamecontent.SFXCustomAction_PlayerMantleOverCover.StopCustomAction" },	// 7631
+	{ 128060, "Function sfxgamecontent.SFXCustomAction_PlayerMantleOverCover.TickCustomAction" },	// 7632
+	{ 128063, "Function sfxgamecontent.SFXCustomAction_PlayerMantleOverCover.BodyStanceAnimEndNotification" },	// 7633
+	{ 128067, "Function sfxgamecontent.SFXCustomAction_PlayerMantleOverCover.GetUsedAnimNames" },	// 7634
+	{ 128079, "Function sfxgamecontent.SFXCustomAction_PlayerMantleOverCover.GetStartAnim" },	// 7635
+	{ 128081, "Function sfxgamecontent.SFXCustomAction_PlayerMantleOverCover.GetLoopAnim" },	// 7636
+	{ 128083, "Function sfxgamecontent.SFXCustomAction_PlayerMantleOverCover.GetEndAnim" },	// 7637
+	{ 128086, "Function sfxgamecontent.sfxcustomaction_simplemovebase.GetUsedAnimNames" },	// 7638
+	{ 128090, "Function sfxgamecontent.sfxcustomaction_simplemovebase.ReachedPrecisePosition" },	// 7639
+	{ 128091, "Function sfxgamecontent.sfxcustomaction_simplemovebase.BlockMoveEndPoints" },	// 7640
+	{ 128097, "Function sfxgamecontent.sfxcustomaction_simplemovebase.RemoveBlockingEndPoints" },	// 7641
+	{ 128100, "Function sfxgamecontent.sfxcustomaction_simplemovebase.InternalCanDoCustomAction" },	// 7642
+	{ 128104, "Function sfxgamecontent.sfxcustomaction_simplemovebase.StartCustomAction" },	// 7643
+	{ 128109, "Function sfxgamecontent.sfxcustomaction_simplemovebase.GetBodyStanceAnim" },	// 7644
+	{ 128111, "Function sfxgamecontent.sfxcustomaction_simplemovebase.PlayStartAnimation" },	// 7645
+	{ 128128, "Function sfxgamecontent.sfxcustomaction_simplemovebase.StopCustomAction" },	// 7646
+	{ 128130, "Function sfxgamecontent.sfxcustomaction_simplemovebase.BodyStanceAnimEndNotification" },	// 7647
+	{ 128134, "Function sfxgamecontent.sfxcustomaction_simplemovebase.DestTimeout" },	// 7648
+	{ 128135, "Function sfxgamecontent.sfxcustomaction_simplemovebase.CanBeInterrupted" },	// 7649
+	{ 128137, "Function sfxgamecontent.sfxcustomaction_simplemovebase.Replicate" },	// 7650
+	{ 128138, "Function sfxgamecontent.sfxcustomaction_simplemovebase.ClientDoCustomAction" },	// 7651
+	{ 128141, "Function sfxgamecontent.SFXCustomAction_PlayerMantleUp.GetUsedAnimNames" },	// 7652
+	{ 128146, "Function sfxgamecontent.SFXCustomAction_PlayerMantleUp.InternalCanDoCustomAction" },	// 7653
+	{ 128152, "Function sfxgamecontent.SFXCustomAction_PlayerMantleUp.StartCustomAction" },	// 7654
+	{ 128154, "Function sfxgamecontent.SFXCustomAction_PlayerMantleUp.StopCustomAction" },	// 7655
+	{ 128155, "Function sfxgamecontent.SFXCustomAction_PlayerMantleUp.GetBodyStanceAnim" },	// 7656
+	{ 128157, "Function sfxgamecontent.SFXCustomAction_PlayerMantleUp.Replicate" },	// 7657
+	{ 128158, "Function sfxgamecontent.SFXCustomAction_PlayerMantleUp.ServerStartCustomAction" },	// 7658
+	{ 128162, "Function sfxgamecontent.SFXCustomAction_PlayerMantleUp.ClientDoCustomAction" },	// 7659
+	{ 128168, "Class sfxgamecontent.SFXCustomAction_PlayerStaggerImpact" },	// 7660
+	{ 128174, "Function sfxgamecontent.SFXCustomAction_Reload.GetUsedAnimNames" },	// 7661
+	{ 128178, "Function sfxgamecontent.SFXCustomAction_Reload.StartCustomAction" },	// 7662
+	{ 128181, "Function sfxgamecontent.SFXCustomAction_Reload.StopCustomAction" },	// 7663
+	{ 128183, "Function sfxgamecontent.sfxcustomaction_revive.InternalCanDoCustomAction" },	// 7664
+	{ 128187, "Function sfxgamecontent.sfxcustomaction_revive.StartCustomAction" },	// 7665
+	{ 128190, "Function sfxgamecontent.sfxcustomaction_revive.Resurrect" },	// 7666
+	{ 128193, "Function sfxgamecontent.sfxcustomaction_revive.StopCustomAction" },	// 7667
+	{ 128194, "Function sfxgamecontent.sfxcustomaction_revive.TickCustomAction" },	// 7668
+	{ 128196, "Function sfxgamecontent.sfxcustomaction_revive.CheckFiring" },	// 7669
+	{ 128197, "Function sfxgamecontent.sfxcustomaction_revive.ClientDoCustomAction" },	// 7670
+	{ 128199, "Function sfxgamecontent.sfxcustomaction_revive.Replicate" },	// 7671
+	{ 128200, "Function sfxgamecontent.sfxcustomaction_revive.BodyStanceAnimEndNotification" },	// 7672
+	{ 128206, "Function sfxgamecontent.SFXCustomAction_RifleMeleeOne.StartCustomAction" },	// 7673
+	{ 128207, "Function sfxgamecontent.SFXCustomAction_RifleMeleeOne.RifleMeleeSecondary" },	// 7674
+	{ 128208, "Function sfxgamecontent.SFXCustomAction_RifleMeleeOne.DoRifleMeleeTwo" },	// 7675
+	{ 128210, "Function sfxgamecontent.SFXCustomAction_RifleMeleeOne.NoHeavyMelee" },	// 7676
+	{ 128211, "Function sfxgamecontent.SFXCustomAction_RifleMeleeOne.HeavyMelee" },	// 7677
+	{ 128213, "Function sfxgamecontent.SFXCustomAction_RifleMeleeOne.EndAction" },	// 7678
+	{ 128214, "Function sfxgamecontent.SFXCustomAction_RifleMeleeOne.StopCustomAction" },	// 7679
+	{ 128215, "Function sfxgamecontent.SFXCustomAction_RifleMeleeOne.ReplicateImpact" },	// 7680
+	{ 128222, "Function sfxgamecontent.SFXCustomAction_RifleMeleeOne.OnActorImpacted" },	// 7681
+	{ 128235, "Function sfxgamecontent.SFXCustomAction_RifleMeleeOne.StopMove" },	// 7682
+	{ 128285, "Function sfxgamecontent.SFXCustomAction_StdCoverSlipLookAt.GetStartBodyStanceAnim" },	// 7683
+	{ 128289, "Function sfxgamecontent.SFXCustomAction_StdCoverSlipLookAt.GetLoopBodyStanceAnim" },	// 7684
+	{ 128293, "Function sfxgamecontent.SFXCustomAction_StdCoverSlipLookAt.GetEndBodyStanceAnim" },	// 7685
+	{ 128297, "Function sfxgamecontent.SFXCustomAction_StdCoverSlipLookAt.GetUsedAnimNames" },	// 7686
+	{ 128300, "Function sfxgamecontent.SFXCustomAction_StdCoverSlipLookAt.FlinchActionOverride" },	// 7687
+	{ 128303, "Function sfxgamecontent.SFXCustomAction_StdSwatTurnLookAt.GetStartBodyStanceAnim" },	// 7688
+	{ 128307, "Function sfxgamecontent.SFXCustomAction_StdSwatTurnLookAt.GetLoopBodyStanceAnim" },	// 7689
+	{ 128311, "Function sfxgamecontent.SFXCustomAction_StdSwatTurnLookAt.GetEndBodyStanceAnim" },	// 7690
+	{ 128315, "Function sfxgamecontent.SFXCustomAction_StdSwatTurnLookAt.GetUsedAnimNames" },	// 7691
+	{ 128318, "Function sfxgamecontent.SFXCustomAction_StdSwatTurnLookAt.FlinchActionOverride" },	// 7692
+	{ 128321, "Function sfxgamecontent.SFXCustomAction_SwatTurnLookAt.GetStartBodyStanceAnim" },	// 7693
+	{ 128325, "Function sfxgamecontent.SFXCustomAction_SwatTurnLookAt.GetLoopBodyStanceAnim" },	// 7694
+	{ 128329, "Function sfxgamecontent.SFXCustomAction_SwatTurnLookAt.GetEndBodyStanceAnim" },	// 7695
+	{ 128333, "Function sfxgamecontent.SFXCustomAction_SwatTurnLookAt.GetUsedAnimNames" },	// 7696
+	{ 128336, "Function sfxgamecontent.SFXCustomAction_SwatTurnLookAt.FlinchActionOverride" },	// 7697
+	{ 128339, "Function sfxgamecontent.SFXCustomAction_SyncCoverMelee.GetUsedAnimNames" },	// 7698
+	{ 128343, "Function sfxgamecontent.SFXCustomAction_SyncCoverMelee.StartCustomAction" },	// 7699
+	{ 128345, "Function sfxgamecontent.SFXCustomAction_SyncCoverMelee.EndThisCustomAction" },	// 7700
+	{ 128347, "Function sfxgamecontent.SFXCustomAction_SyncCoverMelee.StopCustomAction" },	// 7701
+	{ 128348, "Function sfxgamecontent.SFXCustomAction_SyncCoverMelee.MeleeImpact" },	// 7702
+	{ 128354, "Class sfxgamecontent.SFXDamageType_AdeptHeavyMelee_NoRagdoll" },	// 7703
+	{ 128357, "Class sfxgamecontent.SFXDamageType_BioticExplosion" },	// 7704
+	{ 128360, "Class sfxgamecontent.SFXDamageType_BioticExplosion_NoRagdoll" },	// 7705
+	{ 128363, "Class sfxgamecontent.SFXDamageType_HeavyPistol" },	// 7706
+	{ 128366, "Class sfxgamecontent.SFXDamageType_Warp" },	// 7707
+	{ 128371, "Class sfxgamecontent.SFXDamageType_ImprovedWarp" },	// 7708
+	{ 128374, "Class sfxgamecontent.SFXDamageType_WarpDoT" },	// 7709
+	{ 128377, "Class sfxgamecontent.SFXDamageType_ImprovedWarpDoT" },	// 7710
+	{ 128380, "Class sfxgamecontent.SFXDamageType_Shockwave" },	// 7711
+	{ 128383, "Class sfxgamecontent.SFXDamageType_Shockwave_NoRagdoll" },	// 7712
+	{ 128386, "Class sfxgamecontent.SFXDamageType_Singularity" },	// 7713
+	{ 128389, "Class sfxgamecontent.SFXDamageType_Singularity_DoT" },	// 7714
+	{ 128392, "Class sfxgamecontent.SFXDamageType_Singularity_Explosion" },	// 7715
+	{ 128395, "Class sfxgamecontent.SFXDamageType_Singularity_NoRagdoll" },	// 7716
+	{ 128398, "Class sfxgamecontent.SFXGameEffect_AntiGravity" },	// 7717
+	{ 128406, "Class sfxgamecontent.SFXGameEffect_BioticPowerDamageTakenBonus" },	// 7718
+	{ 128419, "Class sfxgamecontent.SFXGameEffect_PartBasedDamageBonus" },	// 7719
+	{ 128425, "Class sfxgamecontent.sfxgameeffect_powercombo_biotic" },	// 7720
+	{ 128431, "Class sfxgamecontent.SFXShake_Power_BioticCombo" },	// 7721
+	{ 128432, "Class sfxgamecontent.SFXRumble_Power_BioticCombo" },	// 7722
+	{ 128438, "Class sfxgamecontent.SFXGameEffect_Ragdoll" },	// 7723
+	{ 128446, "Class sfxgamecontent.SFXGameEffect_ShockwaveLift" },	// 7724
+	{ 128447, "Function sfxgamecontent.SFXGameEffect_ShockwaveLift.OnApplied" },	// 7725
+	{ 128449, "Function sfxgamecontent.SFXGameEffect_ShockwaveLift.OnUpdate" },	// 7726
+	{ 128453, "Function sfxgamecontent.SFXGameEffect_ShockwaveLift.OnRemoved" },	// 7727
+	{ 128454, "Function sfxgamecontent.SFXGameEffect_ShockwaveLift.HasOtherGravityEffects" },	// 7728
+	{ 128459, "Class sfxgamecontent.SFXGameEffect_Singularity" },	// 7729
+	{ 128460, "Function sfxgamecontent.SFXGameEffect_Singularity.OnApplied" },	// 7730
+	{ 128466, "Function sfxgamecontent.SFXGameEffect_Singularity.UpdateActor" },	// 7731
+	{ 128475, "Function sfxgamecontent.SFXGameEffect_Singularity.InitialMovement" },	// 7732
+	{ 128477, "Function sfxgamecontent.SFXGameEffect_Singularity.AddForceToActor" },	// 7733
+	{ 128480, "Function sfxgamecontent.SFXGameEffect_Singularity.OnRemoved" },	// 7734
+	{ 128483, "Function sfxgamecontent.SFXGameEffect_Singularity.IsStillInSingularity" },	// 7735
+	{ 128487, "Function sfxgamecontent.SFXGameEffect_Singularity.OutOfRangeCheck" },	// 7736
+	{ 128491, "Class sfxgamecontent.sfxpowercustomaction_singularity" },	// 7737
+	{ 128493, "Class sfxgamecontent.SFXGameEffect_Stasis" },	// 7738
+	{ 128494, "Function sfxgamecontent.SFXGameEffect_Stasis.OnApplied" },	// 7739
+	{ 128500, "Function sfxgamecontent.SFXGameEffect_Stasis.StartCrustVFX" },	// 7740
+	{ 128505, "Function sfxgamecontent.SFXGameEffect_Stasis.NullVelocity" },	// 7741
+	{ 128511, "Function sfxgamecontent.SFXGameEffect_Stasis.OnUpdate" },	// 7742
+	{ 128515, "Function sfxgamecontent.SFXGameEffect_Stasis.UnStasisTarget" },	// 7743
+	{ 128518, "Function sfxgamecontent.SFXGameEffect_Stasis.OnRemoved" },	// 7744
+	{ 128519, "Class sfxgamecontent.sfxpowercustomaction_stasis" },	// 7745
+	{ 128524, "Class sfxgamecontent.SFXGameEffect_WeaponDamageTakenBonus" },	// 7746
+	{ 128530, "Class sfxgamecontent.SFXGameEffect_WeaponWeightModifier" },	// 7747
+	{ 128533, "Function sfxgamecontent.SFXGameEffect_WeaponWeightModifier.OnApplied" },	// 7748
+	{ 128536, "Function sfxgamecontent.SFXGameEffect_WeaponWeightModifier.OnRemoved" },	// 7749
+	{ 128540, "Class sfxgamecontent.SFXGameEffect_WeightCapacity" },	// 7750
+	{ 128546, "Class sfxgamecontent.SFXPowerCustomAction_Shockwave" },	// 7751
+	{ 128549, "Function sfxgamecontent.SFXPowerCustomAction_Shockwave.ReleaseProjectilePower" },	// 7752
+	{ 128558, "Class sfxgamecontent.SFXProjectile_PowerCustomAction_Shockwave" },	// 7753
+	{ 128559, "Function sfxgamecontent.SFXPowerCustomAction_Shockwave.OnPowerDetonated" },	// 7754
+	{ 128564, "Function sfxgamecontent.SFXPowerCustomAction_Shockwave.DoImpact" },	// 7755
+	{ 128576, "Function sfxgamecontent.SFXPowerCustomAction_Shockwave.DoSubsequentImpact" },	// 7756
+	{ 128598, "Function sfxgamecontent.SFXPowerCustomAction_Shockwave.ClientDoPowerSubsequentImpact" },	// 7757
+	{ 128606, "Function sfxgamecontent.SFXPowerCustomAction_Shockwave.OnRagdollPhysicsImpact" },	// 7758
+	{ 128611, "Function sfxgamecontent.SFXPowerCustomAction_Shockwave.ShouldUsePower" },	// 7759
+	{ 128617, "Function sfxgamecontent.SFXPowerCustomAction_Shockwave.EvolvePower" },	// 7760
+	{ 128623, "Function sfxgamecontent.SFXPowerCustomAction_Shockwave.RecalculateAllPowerData" },	// 7761
+	{ 128626, "Function sfxgamecontent.SFXPowerCustomAction_Shockwave.ApplyBonus" },	// 7762
+	{ 128630, "Function sfxgamecontent.SFXPowerCustomAction_Shockwave.PopulatePowerStatBarEvolves" },	// 7763
+	{ 128632, "Class sfxgamecontent.SFXRumble_Power_HeavyImpact" },	// 7764
+	{ 128633, "Class sfxgamecontent.SFXShake_Power_Shockwave" },	// 7765
+	{ 128634, "Class sfxgamecontent.SFXShake_Power_HeavyImpact" },	// 7766
+	{ 128655, "Function sfxgamecontent.sfxpowercustomaction_singularity.StartCustomAction" },	// 7767
+	{ 128656, "Function sfxgamecontent.sfxpowercustomaction_singularity.OnPowersLoaded" },	// 7768
+	{ 128658, "Function sfxgamecontent.sfxpowercustomaction_singularity.GetImpactForce" },	// 7769
+	{ 128661, "Function sfxgamecontent.sfxpowercustomaction_singularity.ReleasePower" },	// 7770
+	{ 128663, "Function sfxgamecontent.sfxpowercustomaction_singularity.OnPowerDetonated" },	// 7771
+	{ 128672, "Function sfxgamecontent.sfxpowercustomaction_singularity.ClientDoCustomActionImpact" },	// 7772
+	{ 128679, "Function sfxgamecontent.sfxpowercustomaction_singularity.TickCustomAction" },	// 7773
+	{ 128701, "Function sfxgamecontent.sfxpowercustomaction_singularity.ImpactNewTarget" },	// 7774
+	{ 128717, "Function sfxgamecontent.sfxpowercustomaction_singularity.ApplyBioticComboEffect" },	// 7775
+	{ 128724, "Function sfxgamecontent.sfxpowercustomaction_singularity.OnGameEffectEnded" },	// 7776
+	{ 128726, "Function sfxgamecontent.sfxpowercustomaction_singularity.CanPutInSingularity" },	// 7777
+	{ 128731, "Function sfxgamecontent.sfxpowercustomaction_singularity.TurnOffSingularity" },	// 7778
+	{ 128733, "Function sfxgamecontent.sfxpowercustomaction_singularity.Internal_TurnOffSingularity" },	// 7779
+	{ 128739, "Function sfxgamecontent.sfxpowercustomaction_singularity.SingularityExplosion" },	// 7780
+	{ 128746, "Function sfxgamecontent.sfxpowercustomaction_singularity.SpawnSingularity" },	// 7781
+	{ 128747, "Function sfxgamecontent.sfxpowercustomaction_singularity.OnExplosionImpact" },	// 7782
+	{ 128749, "Function sfxgamecontent.sfxpowercustomaction_singularity.SpawnSingularityVFX" },	// 7783
+	{ 128754, "Function sfxgamecontent.sfxpowercustomaction_singularity.OnRagdollPhysicsImpact" },	// 7784
+	{ 128758, "Function sfxgamecontent.sfxpowercustomaction_singularity.OnPowerRankIncreased" },	// 7785
+	{ 128759, "Function sfxgamecontent.sfxpowercustomaction_singularity.ShouldUsePower" },	// 7786
+	{ 128765, "Function sfxgamecontent.sfxpowercustomaction_singularity.EvolvePower" },	// 7787
+	{ 128772, "Function sfxgamecontent.sfxpowercustomaction_singularity.RecalculateAllPowerData" },	// 7788
+	{ 128774, "Function sfxgamecontent.sfxpowercustomaction_singularity.ApplyBonus" },	// 7789
+	{ 128778, "Function sfxgamecontent.sfxpowercustomaction_singularity.ClientDoPowerSubsequentImpact" },	// 7790
+	{ 128785, "Function sfxgamecontent.sfxpowercustomaction_singularity.DoJoinInProgress" },	// 7791
+	{ 128786, "Function sfxgamecontent.sfxpowercustomaction_singularity.OnOwnerDestroyed" },	// 7792
+	{ 128787, "Function sfxgamecontent.sfxpowercustomaction_singularity.PopulatePowerStatBarEvolves" },	// 7793
+	{ 128788, "Function sfxgamecontent.sfxpowercustomaction_singularity.CombatEnded" },	// 7794
+	{ 128814, "Class sfxgamecontent.SFXProjectile_PowerCustomAction_SuperSeeking" },	// 7795
+	{ 128830, "Function sfxgamecontent.sfxpowercustomaction_stasis.StartCustomAction" },	// 7796
+	{ 128831, "Function sfxgamecontent.sfxpowercustomaction_stasis.StartPowerCooldown" },	// 7797
+	{ 128835, "Function sfxgamecontent.sfxpowercustomaction_stasis.OnPowerDetonated" },	// 7798
+	{ 128844, "Function sfxgamecontent.sfxpowercustomaction_stasis.StartStasisBubbleVFX" },	// 7799
+	{ 128850, "Function sfxgamecontent.sfxpowercustomaction_stasis.StopStasisBubble" },	// 7800
+	{ 128852, "Function sfxgamecontent.sfxpowercustomaction_stasis.ClientDoPowerSubsequentImpact" },	// 7801
+	{ 128859, "Function sfxgamecontent.sfxpowercustomaction_stasis.ClientEndStasisEffect" },	// 7802
+	{ 128861, "Function sfxgamecontent.sfxpowercustomaction_stasis.ClientDoCustomActionImpact" },	// 7803
+	{ 128871, "Function sfxgamecontent.sfxpowercustomaction_stasis.TickCustomAction" },	// 7804
+	{ 128875, "Function sfxgamecontent.sfxpowercustomaction_stasis.OnImpact" },	// 7805
+	{ 128886, "Function sfxgamecontent.sfxpowercustomaction_stasis.UnStasisCurrentTargets" },	// 7806
+	{ 128890, "Function sfxgamecontent.sfxpowercustomaction_stasis.ClientImpactClearEffects" },	// 7807
+	{ 128891, "Function sfxgamecontent.sfxpowercustomaction_stasis.DoJoinInProgress" },	// 7808
+	{ 128896, "Function sfxgamecontent.sfxpowercustomaction_stasis.OnOwnerDestroyed" },	// 7809
+	{ 128897, "Function sfxgamecontent.sfxpowercustomaction_stasis.OnGameEffectEnded" },	// 7810
+	{ 128899, "Function sfxgamecontent.sfxpowercustomaction_stasis.ShouldUsePower" },	// 7811
+	{ 128904, "Function sfxgamecontent.sfxpowercustomaction_stasis.EvolvePower" },	// 7812
+	{ 128911, "Function sfxgamecontent.sfxpowercustomaction_stasis.RecalculateAllPowerData" },	// 7813
+	{ 128914, "Function sfxgamecontent.sfxpowercustomaction_stasis.PopulatePowerStatBarEvolves" },	// 7814
+	{ 128917, "Function sfxgamecontent.sfxpowercustomaction_stasis.ImpactStasis" },	// 7815
+	{ 128921, "Function sfxgamecontent.sfxpowercustomaction_stasis.ImpactPushAway" },	// 7816
+	{ 128947, "Class sfxgamecontent.SFXPowerCustomAction_Warp" },	// 7817
+	{ 128948, "Function sfxgamecontent.SFXPowerCustomAction_Warp.GetImpactDamage" },	// 7818
+	{ 128953, "Function sfxgamecontent.SFXPowerCustomAction_Warp.GetTotalDamage" },	// 7819
+	{ 128957, "Function sfxgamecontent.SFXPowerCustomAction_Warp.OnImpact" },	// 7820
+	{ 128982, "Function sfxgamecontent.SFXPowerCustomAction_Warp.PlayImpactEffects" },	// 7821
+	{ 128986, "Function sfxgamecontent.SFXPowerCustomAction_Warp.ShouldUsePower" },	// 7822
+	{ 128991, "Function sfxgamecontent.SFXPowerCustomAction_Warp.EvolvePower" },	// 7823
+	{ 128998, "Function sfxgamecontent.SFXPowerCustomAction_Warp.RecalculateAllPowerData" },	// 7824
+	{ 129000, "Function sfxgamecontent.SFXPowerCustomAction_Warp.ApplyBonus" },	// 7825
+	{ 129004, "Function sfxgamecontent.SFXPowerCustomAction_Warp.PopulatePowerStatBarEvolves" },	// 7826
+	{ 129024, "Function sfxgamecontent.SFXProjectile_PowerCustomAction_Shockwave.HitWall" },	// 7827
+	{ 129028, "Function sfxgamecontent.SFXProjectile_PowerCustomAction_Shockwave.ProcessTouch" },	// 7828
+	{ 129032, "Function sfxgamecontent.SFXProjectile_PowerCustomAction_Shockwave.InitializePowerProjectile" },	// 7829
+	{ 129044, "Function sfxgamecontent.SFXProjectile_PowerCustomAction_Shockwave.Tick" },	// 7830
+	{ 129048, "Function sfxgamecontent.SFXProjectile_PowerCustomAction_Shockwave.ReplicateExplode" },	// 7831
+	{ 129055, "Function sfxgamecontent.SFXProjectile_PowerCustomAction_SuperSeeking.TickAimRotation" },	// 7832
+	{ 129062, "Function sfxgamecontent.SFXProjectile_PowerCustomAction_SuperSeeking.InitializeRotation" },	// 7833
+	{ 129090, "Class sfxgamecontent.SFXShield_Biotic_Player" },	// 7834
+	{ 129096, "Class sfxgamecontent.SFXWeapon_AssaultRifle_Avenger" },	// 7835
+	{ 129122, "Class sfxgamecontent.SFXWeapon_Pistol_Predator" },	// 7836
+	{ 129152, "Class sfxgamempcontent.SFXCharacterClass_ContentMP" },	// 7837
+	{ 129154, "Class sfxgamempcontent.SFXCustomAction_PickupRetrieveObject" },	// 7838
+	{ 129155, "Class sfxgamempcontent.SFXCustomAction_DisarmObject" },	// 7839
+	{ 129156, "Class sfxgamempcontent.SFXCustomAction_PlayerStaggerMP" },	// 7840
+	{ 129157, "Class sfxgamempcontent.SFXPowerCustomActionMP_ConsumableAmmoPower" },	// 7841
+	{ 129158, "Class sfxgamempcontent.SFXCharacterClassMP_Adept" },	// 7842
+	{ 129160, "Class sfxgamempcontent.sfxpowercustomactionmp_singularity" },	// 7843
+	{ 129161, "Class sfxgamempcontent.SFXPowerCustomActionMP_Warp" },	// 7844
+	{ 129162, "Class sfxgamempcontent.SFXPowerCustomActionMP_Shockwave" },	// 7845
+	{ 129163, "Class sfxgamempcontent.sfxpowercustomactionmp_humanpassive" },	// 7846
+	{ 129164, "Class sfxgamempcontent.sfxpowercustomactionmp_passivebase" },	// 7847
+	{ 129165, "Class sfxgamempcontent.SFXPowerCustomActionMP_HumanMeleePassive_Adept" },	// 7848
+	{ 129166, "Class sfxgamempcontent.SFXPowerCustomActionMP_HumanMeleePassiveBase" },	// 7849
+	{ 129167, "Class sfxgamempcontent.SFXPowerCustomActionMP_MeleePassiveBase" },	// 7850
+	{ 129169, "Function sfxgamempcontent.SFXCustomAction_DisarmObject.StartCustomAction" },	// 7851
+	{ 129174, "Function sfxgamempcontent.SFXCustomAction_DisarmObject.CheckFiring" },	// 7852
+	{ 129175, "Function sfxgamempcontent.SFXCustomAction_DisarmObject.DisarmSuccess" },	// 7853
+	{ 129177, "Function sfxgamempcontent.SFXCustomAction_DisarmObject.StopCustomAction" },	// 7854
+	{ 129182, "Function sfxgamempcontent.SFXCustomAction_DisarmObject.BodyStanceAnimEndNotification" },	// 7855
+	{ 129186, "Class sfxgamempcontent.sfxobjective_disarm_base" },	// 7856
+	{ 129191, "Function sfxgamempcontent.SFXCustomAction_PickupRetrieveObject.StartCustomAction" },	// 7857
+	{ 129203, "Function sfxgamempcontent.SFXCustomAction_PickupRetrieveObject.CheckFiring" },	// 7858
+	{ 129204, "Function sfxgamempcontent.SFXCustomAction_PickupRetrieveObject.StopCustomAction" },	// 7859
+	{ 129208, "Class sfxgamempcontent.sfxobjective_retrieve_pickupobject" },	// 7860
+	{ 129213, "Class sfxgamempcontent.SFXGameEffect_MatchConsumable_AmmoPower" },	// 7861
+	{ 129214, "Function sfxgamempcontent.SFXGameEffect_MatchConsumable_AmmoPower.OnApplied" },	// 7862
+	{ 129218, "Function sfxgamempcontent.SFXGameEffect_MatchConsumable_AmmoPower.SetupFromWeapon" },	// 7863
+	{ 129221, "Function sfxgamempcontent.SFXGameEffect_MatchConsumable_AmmoPower.OnRemoved" },	// 7864
+	{ 129224, "Function sfxgamempcontent.SFXGameEffect_MatchConsumable_AmmoPower.ApplyToWeapon" },	// 7865
+	{ 129229, "Function sfxgamempcontent.SFXGameEffect_MatchConsumable_AmmoPower.RemoveFromWeapon" },	// 7866
+	{ 129231, "Function sfxgamempcontent.SFXGameEffect_MatchConsumable_AmmoPower.GetWeaponDamage" },	// 7867
+	{ 129236, "Function sfxgamempcontent.SFXGameEffect_MatchConsumable_AmmoPower.GetBulletsPerSecond" },	// 7868
+	{ 129241, "Function sfxgamempcontent.SFXGameEffect_MatchConsumable_AmmoPower.GetHitTarget" },	// 7869
+	{ 129245, "Function sfxgamempcontent.SFXGameEffect_MatchConsumable_AmmoPower.OnWeaponImpact" },	// 7870
+	{ 129249, "Function sfxgamempcontent.SFXGameEffect_MatchConsumable_AmmoPower.OnWeaponReload" },	// 7871
+	{ 129251, "Function sfxgamempcontent.SFXGameEffect_MatchConsumable_AmmoPower.OnWeaponEquip" },	// 7872
+	{ 129253, "Function sfxgamempcontent.SFXGameEffect_MatchConsumable_AmmoPower.OnWeaponUnequip" },	// 7873
+	{ 129255, "Function sfxgamempcontent.SFXGameEffect_MatchConsumable_AmmoPower.GetDamageVocProbabilityMod" },	// 7874
+	{ 129258, "Function sfxgamempcontent.SFXGameEffect_MatchConsumable_AmmoPower.OnUpdate" },	// 7875
+	{ 129264, "Class sfxgamempcontent.SFXGameEffect_MatchConsumable_AmmoPower_Cryo" },	// 7876
+	{ 129273, "Function sfxgamempcontent.SFXGameEffect_MatchConsumable_AmmoPower_Cryo.OnWeaponImpact" },	// 7877
+	{ 129281, "Function sfxgamempcontent.SFXGameEffect_MatchConsumable_AmmoPower_Cryo.DoFreezeEffect" },	// 7878
+	{ 129299, "Class sfxgamempcontent.sfxgameeffect_matchconsumable_ammopower_disruptor" },	// 7879
+	{ 129306, "Function sfxgamempcontent.sfxgameeffect_matchconsumable_ammopower_disruptor.OnWeaponImpact" },	// 7880
+	{ 129325, "Function sfxgamempcontent.sfxgameeffect_matchconsumable_ammopower_disruptor.StunEnemy" },	// 7881
+	{ 129332, "Function sfxgamempcontent.sfxobjective_disarm_base.ReplicatedEvent" },	// 7882
+	{ 129335, "Function sfxgamempcontent.sfxobjective_disarm_base.PostBeginPlay" },	// 7883
+	{ 129337, "Function sfxgamempcontent.sfxobjective_disarm_base.ActivateObjective" },	// 7884
+	{ 129339, "Function sfxgamempcontent.sfxobjective_disarm_base.Deactivate" },	// 7885
+	{ 129341, "Function sfxgamempcontent.sfxobjective_disarm_base.Used" },	// 7886
+	{ 129347, "Function sfxgamempcontent.sfxobjective_disarm_base.DisarmBomb" },	// 7887
+	{ 129349, "Function sfxgamempcontent.sfxobjective_disarm_base.SetOwningWave" },	// 7888
+	{ 129356, "Class sfxgamempcontent.sfxobjective_retrieve_dropofflocation" },	// 7889
+	{ 129357, "Function sfxgamempcontent.sfxobjective_retrieve_dropofflocation.PostBeginPlay" },	// 7890
+	{ 129364, "Function sfxgamempcontent.sfxobjective_retrieve_dropofflocation.Destroyed" },	// 7891
+	{ 129365, "Function sfxgamempcontent.sfxobjective_retrieve_dropofflocation.Touch" },	// 7892
+	{ 129374, "Function sfxgamempcontent.sfxobjective_retrieve_dropofflocation.ObjectPickedUp" },	// 7893
+	{ 129378, "Function sfxgamempcontent.sfxobjective_retrieve_dropofflocation.ObjectDroppedOff" },	// 7894
+	{ 129380, "Function sfxgamempcontent.sfxobjective_retrieve_pickupobject.ObjectDroppedOff" },	// 7895
+	{ 129381, "Function sfxgamempcontent.sfxobjective_retrieve_dropofflocation.SetOwningWave" },	// 7896
+	{ 129396, "Function sfxgamempcontent.sfxobjective_retrieve_pickupobject.ReplicatedEvent" },	// 7897
+	{ 129399, "Function sfxgamempcontent.sfxobjective_retrieve_pickupobject.ReplicatePickupObjectEvent" },	// 7898
+	{ 129403, "Function sfxgamempcontent.sfxobjective_retrieve_pickupobject.ClientPickupObjectEvent" },	// 7899
+	{ 129405, "Function sfxgamempcontent.sfxobjective_retrieve_pickupobject.PostBeginPlay" },	// 7900
+	{ 129407, "Function sfxgamempcontent.sfxobjective_retrieve_pickupobject.SetObjectiveData" },	// 7901
+	{ 129409, "Function sfxgamempcontent.sfxobjective_retrieve_pickupobject.ActivateObjective" },	// 7902
+	{ 129411, "Function sfxgamempcontent.sfxobjective_retrieve_pickupobject.Deactivate" },	// 7903
+	{ 129413, "Function sfxgamempcontent.sfxobjective_retrieve_pickupobject.Used" },	// 7904
+	{ 129418, "Function sfxgamempcontent.sfxobjective_retrieve_pickupobject.OnPickedUp" },	// 7905
+	{ 129424, "Function sfxgamempcontent.sfxobjective_retrieve_pickupobject.PawnDowned" },	// 7906
+	{ 129426, "Function sfxgamempcontent.sfxobjective_retrieve_pickupobject.PickUpObject" },	// 7907
+	{ 129435, "Function sfxgamempcontent.sfxobjective_retrieve_pickupobject.DropObject" },	// 7908
+	{ 129438, "Function sfxgamempcontent.sfxobjective_retrieve_pickupobject.RemovePickupObject" },	// 7909
+	{ 129443, "Function sfxgamempcontent.sfxobjective_retrieve_pickupobject.Destroyed" },	// 7910
+	{ 129444, "Function sfxgamempcontent.sfxobjective_retrieve_pickupobject.SetOwningWave" },	// 7911
+	{ 129452, "Class sfxgamempcontent.SFXPawn_PlayerMP_Adept" },	// 7912
+	{ 129488, "Function sfxgamempcontent.SFXPowerCustomActionMP_MeleePassiveBase.ApplyGlobalBonus" },	// 7913
+	{ 129492, "Function sfxgamempcontent.SFXPowerCustomActionMP_MeleePassiveBase.EvolvePower" },	// 7914
+	{ 129498, "Function sfxgamempcontent.SFXPowerCustomActionMP_MeleePassiveBase.RecalculateAllPowerData" },	// 7915
+	{ 129500, "Function sfxgamempcontent.SFXPowerCustomActionMP_MeleePassiveBase.ApplyBonus" },	// 7916
+	{ 129504, "Function sfxgamempcontent.SFXPowerCustomActionMP_MeleePassiveBase.PopulatePowerStatBarEvolves" },	// 7917
+	{ 129517, "Function sfxgamempcontent.sfxpowercustomactionmp_passivebase.ApplyGlobalBonus" },	// 7918
+	{ 129525, "Function sfxgamempcontent.sfxpowercustomactionmp_passivebase.EvolvePower" },	// 7919
+	{ 129532, "Function sfxgamempcontent.sfxpowercustomactionmp_passivebase.RecalculateAllPowerData" },	// 7920
+	{ 129534, "Function sfxgamempcontent.sfxpowercustomactionmp_passivebase.PopulatePowerStatBarEvolves" },	// 7921
+	{ 135541, "Class sfxgamecontent.SFXDamageType_CryoFreeze" },	// 7922
+	{ 135544, "Class sfxgamecontent.SFXDamageType_Shotgun" },	// 7923
+	{ 135547, "Class sfxgamecontent.SFXGameEffect_MaxGrenadeBonus" },	// 7924
+	{ 135555, "Class sfxgamecontent.SFXGameEffect_MeleeDamageBonus" },	// 7925
+	{ 135557, "Class sfxgamecontent.SFXGameEffect_WeaponStabilityBonus" },	// 7926
+	{ 135563, "Class sfxgamecontent.SFXGUI_ShotgunReticle" },	// 7927
+	{ 135565, "Function sfxgamecontent.SFXGUI_ShotgunReticle.OnReticleLoaded" },	// 7928
+	{ 135567, "Function sfxgamecontent.SFXGUI_ShotgunReticle.PerformReticleShow" },	// 7929
+	{ 135569, "Function sfxgamecontent.SFXGUI_ShotgunReticle.PerformReticleHide" },	// 7930
+	{ 135571, "Function sfxgamecontent.SFXGUI_ShotgunReticle.Update" },	// 7931
+	{ 135581, "Function sfxgamecontent.SFXGUI_ShotgunReticle.TargetCanHitChanged" },	// 7932
+	{ 135583, "Function sfxgamecontent.SFXGUI_ShotgunReticle.ResetReticle" },	// 7933
+	{ 135590, "Class sfxgamecontent.SFXPowerCustomAction_CryoBlast" },	// 7934
+	{ 135591, "Function sfxgamecontent.SFXPowerCustomAction_CryoBlast.OnImpact" },	// 7935
+	{ 135605, "Function sfxgamecontent.SFXPowerCustomAction_CryoBlast.ApplyFreezeEffect" },	// 7936
+	{ 135607, "Function sfxgamecontent.SFXPowerCustomAction_CryoBlast.ApplySlowdownEffect" },	// 7937
+	{ 135623, "Function sfxgamecontent.SFXPowerCustomAction_CryoBlast.OnFrozenPawnDied" },	// 7938
+	{ 135639, "Function sfxgamecontent.SFXPowerCustomAction_CryoBlast.ClientDoPowerSubsequentImpact" },	// 7939
+	{ 135646, "Function sfxgamecontent.SFXPowerCustomAction_CryoBlast.ShouldUsePower" },	// 7940
+	{ 135650, "Function sfxgamecontent.SFXPowerCustomAction_CryoBlast.GetDefaultClientEffectParams" },	// 7941
+	{ 135653, "Function sfxgamecontent.SFXPowerCustomAction_CryoBlast.RecalculateAllPowerData" },	// 7942
+	{ 135655, "Function sfxgamecontent.SFXPowerCustomAction_CryoBlast.EvolvePower" },	// 7943
+	{ 135664, "Function sfxgamecontent.SFXPowerCustomAction_CryoBlast.ApplyBonus" },	// 7944
+	{ 135668, "Function sfxgamecontent.SFXPowerCustomAction_CryoBlast.PopulatePowerStatBarEvolves" },	// 7945
+	{ 135683, "Class sfxgamecontent.SFXPowerCustomAction_GrenadeBase" },	// 7946
+	{ 135684, "Function sfxgamecontent.SFXPowerCustomAction_GrenadeBase.OnPowersLoaded" },	// 7947
+	{ 135686, "Function sfxgamecontent.SFXPowerCustomAction_GrenadeBase.OnPowerAdded" },	// 7948
+	{ 135689, "Function sfxgamecontent.SFXPowerCustomAction_GrenadeBase.OnPowerRankIncreased" },	// 7949
+	{ 135690, "Function sfxgamecontent.SFXPowerCustomAction_GrenadeBase.OnSquadMemberAdded" },	// 7950
+	{ 135692, "Function sfxgamecontent.SFXPowerCustomAction_GrenadeBase.ResetPower" },	// 7951
+	{ 135693, "Function sfxgamecontent.SFXPowerCustomAction_GrenadeBase.ApplyGrenadeBonus" },	// 7952
+	{ 135694, "Function sfxgamecontent.SFXPowerCustomAction_GrenadeBase.CanUsePower" },	// 7953
+	{ 135699, "Function sfxgamecontent.SFXPowerCustomAction_GrenadeBase.ReleasePower" },	// 7954
+	{ 135701, "Function sfxgamecontent.SFXPowerCustomAction_GrenadeBase.AdjustGrenadeCount" },	// 7955
+	{ 135703, "Function sfxgamecontent.SFXPowerCustomAction_GrenadeBase.GetGrenadeCount" },	// 7956
+	{ 135706, "Function sfxgamecontent.SFXPowerCustomAction_GrenadeBase.ShouldUsePower" },	// 7957
+	{ 135711, "Function sfxgamecontent.SFXPowerCustomAction_GrenadeBase.GetHUDWheelIconInfo" },	// 7958
+	{ 135715, "Class sfxgamecontent.SFXRumble_Power_BioticCharge" },	// 7959
+	{ 135718, "Class sfxgamecontent.SFXShake_Power_BioticCharge" },	// 7960
+	{ 135720, "Class sfxgamecontent.SFXShield_Energy_Player" },	// 7961
+	{ 135723, "Class sfxgamecontent.SFXWeapon_Shotgun_Katana" },	// 7962
+	{ 135748, "Class sfxgamecontentdlc_con_mp4.SFXCameraMode_TurianPack" },	// 7963
+	{ 135752, "Class sfxgamecontentdlc_con_mp4.SFXCharacterClassMP_N7Soldier_Turian" },	// 7964
+	{ 135754, "Class sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge" },	// 7965
+	{ 135755, "Class sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base" },	// 7966
+	{ 135756, "Class sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_StimPack" },	// 7967
+	{ 135757, "Class sfxgamempcontent.SFXPowerCustomActionMP_CryoBlast" },	// 7968
+	{ 135758, "Class sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_N7TurianPassive" },	// 7969
+	{ 135759, "Class sfxgamempcontent.sfxpowercustomactionmp_turianpassive" },	// 7970
+	{ 135760, "Class sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_N7TurianMeleePassive" },	// 7971
+	{ 135762, "Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianEvadeLeft" },	// 7972
+	{ 135763, "Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianEvadeBase" },	// 7973
+	{ 135764, "Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianEvadeRight" },	// 7974
+	{ 135765, "Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianEvadeForward" },	// 7975
+	{ 135766, "Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianEvadeBackward" },	// 7976
+	{ 135767, "Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPunch" },	// 7977
+	{ 135768, "Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianMeleeOne" },	// 7978
+	{ 135769, "Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianRifleMeleeTwo" },	// 7979
+	{ 135770, "Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianRifleMeleeThree" },	// 7980
+	{ 135771, "Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPistolMeleeOne" },	// 7981
+	{ 135772, "Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPistolMeleeTwo" },	// 7982
+	{ 135773, "Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPistolMeleeThree" },	// 7983
+	{ 135774, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianEvadeBase.StartCustomAction" },	// 7984
+	{ 135778, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianEvadeBase.TickCustomAction" },	// 7985
+	{ 135782, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianEvadeBase.StopCustomAction" },	// 7986
+	{ 135783, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianEvadeBase.RollOverride" },	// 7987
+	{ 135809, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianMeleeOne.StartCustomAction" },	// 7988
+	{ 135811, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianMeleeOne.RifleMeleeSecondary" },	// 7989
+	{ 135812, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianMeleeOne.DoRifleMeleeTwo" },	// 7990
+	{ 135814, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianMeleeOne.NoHeavyMelee" },	// 7991
+	{ 135815, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianMeleeOne.HeavyMelee" },	// 7992
+	{ 135816, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianMeleeOne.EndAction" },	// 7993
+	{ 135817, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianMeleeOne.StopCustomAction" },	// 7994
+	{ 135818, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianMeleeOne.ReplicateImpact" },	// 7995
+	{ 135825, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianMeleeOne.OnActorImpacted" },	// 7996
+	{ 135838, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianMeleeOne.StopMove" },	// 7997
+	{ 135845, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPistolMeleeOne.StartCustomAction" },	// 7998
+	{ 135847, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPistolMeleeOne.PistolMeleeSecondary" },	// 7999
+	{ 135848, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPistolMeleeOne.DoPistolMeleeTwo" },	// 8000
+	{ 135850, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPistolMeleeOne.NoHeavyMelee" },	// 8001
+	{ 135851, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPistolMeleeOne.HeavyMelee" },	// 8002
+	{ 135853, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPistolMeleeOne.EndAction" },	// 8003
+	{ 135854, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPistolMeleeOne.StopCustomAction" },	// 8004
+	{ 135855, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPistolMeleeOne.ReplicateImpact" },	// 8005
+	{ 135862, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPistolMeleeOne.OnActorImpacted" },	// 8006
+	{ 135875, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPistolMeleeOne.StopMove" },	// 8007
+	{ 135913, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPunch.StartCustomAction" },	// 8008
+	{ 135915, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPunch.Translate" },	// 8009
+	{ 135917, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPunch.GetMeleeDirection" },	// 8010
+	{ 135921, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPunch.OnActorImpacted" },	// 8011
+	{ 135929, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPunch.StopMove" },	// 8012
+	{ 135930, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPunch.ServerStartCustomAction" },	// 8013
+	{ 135935, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPunch.Replicate" },	// 8014
+	{ 135936, "Function sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPunch.ClientDoCustomAction" },	// 8015
+	{ 135939, "Class sfxgamecontentdlc_con_mp4.SFXDamageType_TurianHeavyMelee" },	// 8016
+	{ 135971, "Class sfxgamecontentdlc_con_mp4.SFXDamageType_JetPackCharge" },	// 8017
+	{ 135976, "Class sfxgamecontentdlc_con_mp4.SFXGameEffect_StimPack" },	// 8018
+	{ 135977, "Function sfxgamecontentdlc_con_mp4.SFXGameEffect_StimPack.OnApplied" },	// 8019
+	{ 135979, "Function sfxgamecontentdlc_con_mp4.SFXGameEffect_StimPack.OnRemoved" },	// 8020
+	{ 135983, "Class sfxgamempcontent.SFXPawn_PlayerMP_Soldier" },	// 8021
+	{ 136011, "Class sfxgamecontentdlc_con_mp4.SFXPawn_PlayerMP_N7Soldier_Turian" },	// 8022
+	{ 136041, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.InternalCanDoCustomAction" },	// 8023
+	{ 136045, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.CanUsePower" },	// 8024
+	{ 136058, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.NewVector" },	// 8025
+	{ 136064, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.TestPathReachability" },	// 8026
+	{ 136070, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.ValidateTargetLocation" },	// 8027
+	{ 136085, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.CollectVolumes" },	// 8028
+	{ 136096, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.TryMove" },	// 8029
+	{ 136101, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.FindSpace" },	// 8030
+	{ 136115, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.ValidateTarget" },	// 8031
+	{ 136122, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.FinalizePawnMove" },	// 8032
+	{ 136127, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.StartCustomAction" },	// 8033
+	{ 136140, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.CameraMove" },	// 8034
+	{ 136148, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.InterruptThisCustomAction" },	// 8035
+	{ 136150, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.StopCustomAction" },	// 8036
+	{ 136152, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.PrecacheVFX" },	// 8037
+	{ 136157, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.StartTeleport" },	// 8038
+	{ 136161, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.Teleport" },	// 8039
+	{ 136162, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.OnChargeImpact" },	// 8040
+	{ 136177, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.ClientDoPowerSubsequentImpact" },	// 8041
+	{ 136184, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.GetImpactForce" },	// 8042
+	{ 136190, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.OnRagdollPhysicsImpact" },	// 8043
+	{ 136195, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.SpawnProjectile" },	// 8044
+	{ 136196, "Class sfxgamecontentdlc_con_mp4.SFXProjectile_PowerCustomActionMP_JetPack" },	// 8045
+	{ 136197, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.PlayFailedChargeEffects" },	// 8046
+	{ 136200, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.DoPowerDetonatedForActor" },	// 8047
+	{ 136208, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base.Replicate" },	// 8048
+	{ 136219, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge.CanOverrideCustomAction" },	// 8049
+	{ 136223, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge.StartPower" },	// 8050
+	{ 136225, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge.Impact" },	// 8051
+	{ 136235, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge.EvolvePower" },	// 8052
+	{ 136242, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge.RecalculateAllPowerData" },	// 8053
+	{ 136244, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge.PopulatePowerStatBarEvolves" },	// 8054
+	{ 136265, "Function sfxgamempcontent.sfxpowercustomactionmp_turianpassive.ApplyGlobalBonus" },	// 8055
+	{ 136269, "Function sfxgamempcontent.sfxpowercustomactionmp_turianpassive.EvolvePower" },	// 8056
+	{ 136273, "Function sfxgamempcontent.sfxpowercustomactionmp_turianpassive.RecalculateAllPowerData" },	// 8057
+	{ 136275, "Function sfxgamempcontent.sfxpowercustomactionmp_turianpassive.PopulatePowerStatBarEvolves" },	// 8058
+	{ 136278, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_StimPack.OnImpact" },	// 8059
+	{ 136297, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_StimPack.RemoveImmunity" },	// 8060
+	{ 136300, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_StimPack.ApplyGrenadeBonus" },	// 8061
+	{ 136303, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_StimPack.EvolvePower" },	// 8062
+	{ 136310, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_StimPack.RecalculateAllPowerData" },	// 8063
+	{ 136312, "Function sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_StimPack.PopulatePowerStatBarEvolves" },	// 8064
+	{ 138287, "Class sfxgamecontent.SFXDamageType_Falcon" },	// 8065
+	{ 138290, "Class sfxgamecontent.SFXDamageType_Gib" },	// 8066
+	{ 138297, "Class sfxgamecontent.SFXProjectile_Proximity" },	// 8067
+	{ 138298, "Function sfxgamecontent.SFXProjectile_Proximity.TickProximity" },	// 8068
+	{ 138303, "Function sfxgamecontent.SFXProjectile_Proximity.Init" },	// 8069
+	{ 138305, "Function sfxgamecontent.SFXProjectile_Proximity.Tick" },	// 8070
+	{ 138308, "Function sfxgamecontent.SFXProjectile_Proximity.Explode" },	// 8071
+	{ 138311, "Function sfxgamecontent.SFXProjectile_Proximity.DoImpact" },	// 8072
+	{ 138323, "Function sfxgamecontent.SFXProjectile_Proximity.Recycle" },	// 8073
+	{ 138334, "Class sfxgamecontent.SFXProjectile_SeekingMissile" },	// 8074
+	{ 138335, "Function sfxgamecontent.SFXProjectile_SeekingMissile.AcquireTarget" },	// 8075
+	{ 138346, "Function sfxgamecontent.SFXProjectile_SeekingMissile.AcquireInitialTarget" },	// 8076
+	{ 138348, "Function sfxgamecontent.SFXProjectile_SeekingMissile.GetAimLocation" },	// 8077
+	{ 138351, "Function sfxgamecontent.SFXProjectile_SeekingMissile.Tick" },	// 8078
+	{ 138354, "Function sfxgamecontent.SFXProjectile_SeekingMissile.TickNPC" },	// 8079
+	{ 138366, "Function sfxgamecontent.SFXProjectile_SeekingMissile.DefaultUpdateVelocity" },	// 8080
+	{ 138367, "Function sfxgamecontent.SFXProjectile_SeekingMissile.SetSpeed" },	// 8081
+	{ 138369, "Function sfxgamecontent.SFXProjectile_SeekingMissile.TickPlayer" },	// 8082
+	{ 138379, "Function sfxgamecontent.SFXProjectile_SeekingMissile.Init" },	// 8083
+	{ 138381, "Function sfxgamecontent.SFXProjectile_SeekingMissile.ShutDown" },	// 8084
+	{ 138382, "Function sfxgamecontent.SFXProjectile_SeekingMissile.Destroyed" },	// 8085
+	{ 138383, "Function sfxgamecontent.SFXProjectile_SeekingMissile.Explode" },	// 8086
+	{ 138392, "Function sfxgamecontent.SFXProjectile_SeekingMissile.Recycle" },	// 8087
+	{ 138395, "Class sfxgamecontent.SFXShake_SeekingMissile" },	// 8088
+	{ 138406, "Class sfxgamecontentdlc_con_mp5.SFXDamageType_SalarianBlast_MP" },	// 8089
+	{ 138409, "Class sfxgamecontentdlc_con_mp5.SFXDamageType_SalarianShard_MP" },	// 8090
+	{ 138412, "Class sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlast_MP" },	// 8091
+	{ 138413, "Function sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlast_MP.DoImpact" },	// 8092
+	{ 138424, "Function sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlast_MP.Init" },	// 8093
+	{ 138427, "Function sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlast_MP.SpawnExplosionEffects" },	// 8094
+	{ 138444, "Class sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlastShard_MP" },	// 8095
+	{ 138445, "Function sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlastShard_MP.Init" },	// 8096
+	{ 138451, "Function sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlastShard_MP.Detonate" },	// 8097
+	{ 138452, "Function sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlastShard_MP.DoImpact" },	// 8098
+	{ 138463, "Function sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlastShard_MP.ProcessTouch" },	// 8099
+	{ 138470, "Function sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlastShard_MP.Explode" },	// 8100
+	{ 138477, "Function sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlastShard_MP.SpawnExplosionEffects" },	// 8101
+	{ 138483, "Function sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlastShard_MP.Recycle" },	// 8102
+	{ 138490, "Class sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlastSplitter_MP" },	// 8103
+	{ 138491, "Function sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlastSplitter_MP.Init" },	// 8104
+	{ 138494, "Function sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlastSplitter_MP.Tick" },	// 8105
+	{ 138496, "Function sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlastSplitter_MP.ProcessTouch" },	// 8106
+	{ 138501, "Function sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlastSplitter_MP.DoImpact" },	// 8107
+	{ 138512, "Function sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlastSplitter_MP.Explode" },	// 8108
+	{ 138528, "Function sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlastSplitter_MP.SpawnExplosionEffects" },	// 8109
+	{ 138534, "Function sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlastSplitter_MP.GetDamage" },	// 8110
+	{ 138545, "Class sfxgamecontentdlc_con_mp5.SFXWeapon_Shotgun_Salarian_MP" },	// 8111
+	{ 138546, "Function sfxgamecontentdlc_con_mp5.SFXWeapon_Shotgun_Salarian_MP.InitializeWeapon" },	// 8112
+	{ 138547, "Function sfxgamecontentdlc_con_mp5.SFXWeapon_Shotgun_Salarian_MP.HackLoadWeaponMods" },	// 8113
+	{ 138557, "Function sfxgamecontentdlc_con_mp5.SFXWeapon_Shotgun_Salarian_MP.GetFireModeBaseDamage" },	// 8114
+	{ 138560, "Function sfxgamecontentdlc_con_mp5.SFXWeapon_Shotgun_Salarian_MP.GetProjectileClass" },	// 8115
+	{ 138562, "Function sfxgamecontentdlc_con_mp5.SFXWeapon_Shotgun_Salarian_MP.StartChargeEffects" },	// 8116
+	{ 138565, "Function sfxgamecontentdlc_con_mp5.SFXWeapon_Shotgun_Salarian_MP.StopChargeEffects" },	// 8117
+	{ 138567, "Function sfxgamecontentdlc_con_mp5.SFXWeapon_Shotgun_Salarian_MP.PlayOwnedFireEffects" },	// 8118
+	{ 140394, "Class sfxgamecontent.SFXGameEffect_WeaponMod_AccuracyBonus" },	// 8119
+	{ 140400, "Class sfxgamecontent.SFXGameEffect_WeaponMod_ArmorPiercingBonus" },	// 8120
+	{ 140404, "Class sfxgamecontent.SFXGameEffect_WeaponMod_CrosshairModifier" },	// 8121
+	{ 140410, "Class sfxgamecontent.SFXGameEffect_WeaponMod_DamageBonus" },	// 8122
+	{ 140416, "Class sfxgamecontent.SFXGameEffect_WeaponMod_MeleeDmgBonus" },	// 8123
+	{ 140420, "Class sfxgamecontent.SFXGameEffect_WeaponMod_PenetrationBonus" },	// 8124
+	{ 140424, "Class sfxgamecontent.sfxgameeffect_weaponmod_penetrationdamagebonus" },	// 8125
+	{ 140430, "Class sfxgamecontent.SFXGameEffect_WeaponMod_SpareAmmoBonus" },	// 8126
+	{ 140437, "Class sfxgamecontent.SFXWeaponMod_ShotgunAccuracy" },	// 8127
+	{ 140440, "Class sfxgamecontent.SFXWeaponMod_ShotgunDamage" },	// 8128
+	{ 140448, "Class sfxgamecontent.SFXWeaponMod_ShotgunMeleeDamage" },	// 8129
+	{ 140449, "Function sfxgamecontent.SFXWeaponMod_ShotgunMeleeDamage.ApplyEffects" },	// 8130
+	{ 140452, "Function sfxgamecontent.SFXWeaponMod_ShotgunMeleeDamage.RemoveEffects" },	// 8131
+	{ 140462, "Class sfxgamecontent.SFXWeaponMod_ShotgunReloadSpeed" },	// 8132
+	{ 140465, "Class sfxgamecontent.SFXWeaponMod_ShotgunStability" },	// 8133
+};
+
+UObject* SdkBindings::Objects[ SDK_BINDING_COUNT ];
@@ -46,38 +46,22 @@ public:
 	int                                                AllowJoystickInput;                               		// 0x01CC (0x0004) [0x0000000000004000]              ( CPF_Config )
 	unsigned char                                      UnknownData02[ 0xC ];                             		// 0x01D0 (0x000C) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1348 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1348 );
 	};
 
 };
 
-UClass* UWindowsClient::pClassPointer = NULL;
-
 // Class WinDrv.XnaForceFeedbackManager
 // 0x0000 (0x0050 - 0x0050)
 class UXnaForceFeedbackManager : public UForceFeedbackManager
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1349 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1349 );
 	};
 
 	void PauseWaveform ( unsigned long bPause );
@@ -85,8 +69,6 @@ public:
 	void PlayForceFeedbackWaveform ( class UForceFeedbackWaveform* WaveForm );
 };
 
-UClass* UXnaForceFeedbackManager::pClassPointer = NULL;
-
 
 #ifdef _MSC_VER
 	#pragma pack ( pop )
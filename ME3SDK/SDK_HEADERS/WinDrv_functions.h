@@ -28,10 +28,9 @@
 
 void UXnaForceFeedbackManager::PauseWaveform ( unsigned long bPause )
 {
-	static UFunction* pFnPauseWaveform = NULL;
-
+	UFunction* pFnPauseWaveform = (UFunction*) SdkBindings::Get ( 2454 );
 	if ( ! pFnPauseWaveform )
-		pFnPauseWaveform = (UFunction*) UObject::GObjObjects()->Data[ 16595 ];
+		return;
 
 	UXnaForceFeedbackManager_execPauseWaveform_Parms PauseWaveform_Parms;
 	PauseWaveform_Parms.bPause = bPause;
@@ -46,10 +45,9 @@ void UXnaForceFeedbackManager::PauseWaveform ( unsigned long bPause )
 
 void UXnaForceFeedbackManager::StopForceFeedbackWaveform ( class UForceFeedbackWaveform* WaveForm )
 {
-	static UFunction* pFnStopForceFeedbackWaveform = NULL;
-
+	UFunction* pFnStopForceFeedbackWaveform = (UFunction*) SdkBindings::Get ( 2453 );
 	if ( ! pFnStopForceFeedbackWaveform )
-		pFnStopForceFeedbackWaveform = (UFunction*) UObject::GObjObjects()->Data[ 16593 ];
+		return;
 
 	UXnaForceFeedbackManager_execStopForceFeedbackWaveform_Parms StopForceFeedbackWaveform_Parms;
 	StopForceFeedbackWaveform_Parms.WaveForm = WaveForm;
@@ -64,10 +62,9 @@ void UXnaForceFeedbackManager::StopForceFeedbackWaveform ( class UForceFeedbackW
 
 void UXnaForceFeedbackManager::PlayForceFeedbackWaveform ( class UForceFeedbackWaveform* WaveForm )
 {
-	static UFunction* pFnPlayForceFeedbackWaveform = NULL;
-
+	UFunction* pFnPlayForceFeedbackWaveform = (UFunction*) SdkBindings::Get ( 2452 );
 	if ( ! pFnPlayForceFeedbackWaveform )
-		pFnPlayForceFeedbackWaveform = (UFunction*) UObject::GObjObjects()->Data[ 16584 ];
+		return;
 
 	UXnaForceFeedbackManager_execPlayForceFeedbackWaveform_Parms PlayForceFeedbackWaveform_Parms;
 	PlayForceFeedbackWaveform_Parms.WaveForm = WaveForm;
@@ -54,23 +54,14 @@ class UActorFactoryWwiseAmbientSound : public UActorFactory
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1310 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1310 );
 	};
 
 	void eventPostCreateActor ( class AActor* NewActor );
 };
 
-UClass* UActorFactoryWwiseAmbientSound::pClassPointer = NULL;
-
 // Class WwiseAudio.AnimNotify_WwiseEvent
 // 0x0014 (0x0050 - 0x003C)
 class UAnimNotify_WwiseEvent : public UAnimNotify
@@ -80,22 +71,13 @@ public:
 	struct FName                                       BoneName;                                         		// 0x0044 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bFollowActor : 1;                                 		// 0x004C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1311 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1311 );
 	};
 
 };
 
-UClass* UAnimNotify_WwiseEvent::pClassPointer = NULL;
-
 // Class WwiseAudio.InterpTrackInstWwiseEvent
 // 0x0004 (0x0040 - 0x003C)
 class UInterpTrackInstWwiseEvent : public UInterpTrackInst
@@ -103,22 +85,13 @@ class UInterpTrackInstWwiseEvent : public UInterpTrackInst
 public:
 	float                                              LastUpdatePosition;                               		// 0x003C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1312 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1312 );
 	};
 
 };
 
-UClass* UInterpTrackInstWwiseEvent::pClassPointer = NULL;
-
 // Class WwiseAudio.InterpTrackInstWwiseRTPC
 // 0x0014 (0x0050 - 0x003C)
 class UInterpTrackInstWwiseRTPC : public UInterpTrackInst
@@ -126,22 +99,13 @@ class UInterpTrackInstWwiseRTPC : public UInterpTrackInst
 public:
 	struct FWwiseRTPCForActorHandler                   m_RTPCHandler;                                    		// 0x003C (0x0014) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1313 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1313 );
 	};
 
 };
 
-UClass* UInterpTrackInstWwiseRTPC::pClassPointer = NULL;
-
 // Class WwiseAudio.InterpTrackWwiseEvent
 // 0x0010 (0x006C - 0x005C)
 class UInterpTrackWwiseEvent : public UInterpTrack
@@ -150,22 +114,13 @@ public:
 	TArray< struct FWwiseEventTrackKey >               WwiseEvents;                                      		// 0x005C (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 	unsigned long                                      m_bRequiresPreload : 1;                           		// 0x0068 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1314 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1314 );
 	};
 
 };
 
-UClass* UInterpTrackWwiseEvent::pClassPointer = NULL;
-
 // Class WwiseAudio.InterpTrackWwiseSoundEffect
 // 0x0004 (0x0070 - 0x006C)
 class UInterpTrackWwiseSoundEffect : public UInterpTrackWwiseEvent
@@ -173,22 +128,13 @@ class UInterpTrackWwiseSoundEffect : public UInterpTrackWwiseEvent
 public:
 	class UWwiseAudioComponent*                        m_pComponent;                                     		// 0x006C (0x0004) [0x0000000004082008]              ( CPF_ExportObject | CPF_Transient | CPF_Component | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1315 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1315 );
 	};
 
 };
 
-UClass* UInterpTrackWwiseSoundEffect::pClassPointer = NULL;
-
 // Class WwiseAudio.InterpTrackWwiseRTPC
 // 0x000C (0x007C - 0x0070)
 class UInterpTrackWwiseRTPC : public UInterpTrackFloatBase
@@ -196,44 +142,26 @@ class UInterpTrackWwiseRTPC : public UInterpTrackFloatBase
 public:
 	struct FString                                     Param;                                            		// 0x0070 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1316 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1316 );
 	};
 
 };
 
-UClass* UInterpTrackWwiseRTPC::pClassPointer = NULL;
-
 // Class WwiseAudio.SeqAct_WwiseLockMic
 // 0x0000 (0x00B0 - 0x00B0)
 class USeqAct_WwiseLockMic : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1317 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1317 );
 	};
 
 };
 
-UClass* USeqAct_WwiseLockMic::pClassPointer = NULL;
-
 // Class WwiseAudio.SeqAct_WwiseMusicVolumeDisable
 // 0x0004 (0x00B4 - 0x00B0)
 class USeqAct_WwiseMusicVolumeDisable : public USequenceAction
@@ -241,23 +169,14 @@ class USeqAct_WwiseMusicVolumeDisable : public USequenceAction
 public:
 	class AWwiseMusicVolume*                           m_MusicVolume;                                    		// 0x00B0 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1318 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1318 );
 	};
 
 	int eventGetObjClassVersion ( );
 };
 
-UClass* USeqAct_WwiseMusicVolumeDisable::pClassPointer = NULL;
-
 // Class WwiseAudio.SeqAct_WwiseMusicVolumeEnable
 // 0x0004 (0x00B4 - 0x00B0)
 class USeqAct_WwiseMusicVolumeEnable : public USequenceAction
@@ -265,23 +184,14 @@ class USeqAct_WwiseMusicVolumeEnable : public USequenceAction
 public:
 	class AWwiseMusicVolume*                           m_MusicVolume;                                    		// 0x00B0 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1319 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1319 );
 	};
 
 	int eventGetObjClassVersion ( );
 };
 
-UClass* USeqAct_WwiseMusicVolumeEnable::pClassPointer = NULL;
-
 // Class WwiseAudio.SeqAct_WwisePostEvent
 // 0x0004 (0x00C4 - 0x00C0)
 class USeqAct_WwisePostEvent : public USeqAct_Latent
@@ -289,23 +199,14 @@ class USeqAct_WwisePostEvent : public USeqAct_Latent
 public:
 	class UWwiseBaseSoundObject*                       WwiseObject;                                      		// 0x00C0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1320 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1320 );
 	};
 
 	int eventGetObjClassVersion ( );
 };
 
-UClass* USeqAct_WwisePostEvent::pClassPointer = NULL;
-
 // Class WwiseAudio.SeqAct_WwisePostTrigger
 // 0x000C (0x00BC - 0x00B0)
 class USeqAct_WwisePostTrigger : public USequenceAction
@@ -313,22 +214,13 @@ class USeqAct_WwisePostTrigger : public USequenceAction
 public:
 	struct FString                                     Trigger;                                          		// 0x00B0 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1321 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1321 );
 	};
 
 };
 
-UClass* USeqAct_WwisePostTrigger::pClassPointer = NULL;
-
 // Class WwiseAudio.SeqAct_WwiseSetRTPCValue
 // 0x0020 (0x00E0 - 0x00C0)
 class USeqAct_WwiseSetRTPCValue : public USeqAct_Latent
@@ -339,22 +231,13 @@ public:
 	float                                              Value;                                            		// 0x00D8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      Running : 1;                                      		// 0x00DC (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1322 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1322 );
 	};
 
 };
 
-UClass* USeqAct_WwiseSetRTPCValue::pClassPointer = NULL;
-
 // Class WwiseAudio.SeqAct_WwiseSetState
 // 0x0018 (0x00C8 - 0x00B0)
 class USeqAct_WwiseSetState : public USequenceAction
@@ -363,22 +246,13 @@ public:
 	struct FString                                     StateGroup;                                       		// 0x00B0 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	struct FString                                     State;                                            		// 0x00BC (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1323 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1323 );
 	};
 
 };
 
-UClass* USeqAct_WwiseSetState::pClassPointer = NULL;
-
 // Class WwiseAudio.SeqAct_WwiseSetSwitch
 // 0x0018 (0x00C8 - 0x00B0)
 class USeqAct_WwiseSetSwitch : public USequenceAction
@@ -387,66 +261,39 @@ public:
 	struct FString                                     SwitchGroup;                                      		// 0x00B0 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	struct FString                                     Switch;                                           		// 0x00BC (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1324 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1324 );
 	};
 
 };
 
-UClass* USeqAct_WwiseSetSwitch::pClassPointer = NULL;
-
 // Class WwiseAudio.SeqAct_WwiseStartAudioObjects
 // 0x0000 (0x00B0 - 0x00B0)
 class USeqAct_WwiseStartAudioObjects : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1325 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1325 );
 	};
 
 };
 
-UClass* USeqAct_WwiseStartAudioObjects::pClassPointer = NULL;
-
 // Class WwiseAudio.SeqAct_WwiseStopAll
 // 0x0000 (0x00B0 - 0x00B0)
 class USeqAct_WwiseStopAll : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1326 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1326 );
 	};
 
 };
 
-UClass* USeqAct_WwiseStopAll::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseAmbientSound
 // 0x0012 (0x0208 - 0x01F6)
 class AWwiseAmbientSound : public AKeypoint
@@ -458,24 +305,15 @@ public:
 	unsigned long                                      bWasPlaying : 1;                                  		// 0x0204 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 	unsigned long                                      bIsPlaying : 1;                                   		// 0x0204 (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1327 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1327 );
 	};
 
 	void HideEmitter ( );
 	void DrawEmitter ( );
 };
 
-UClass* AWwiseAmbientSound::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseAudioComponent
 // 0x00EE (0x0144 - 0x0056)
 class UWwiseAudioComponent : public UActorComponent
@@ -515,16 +353,9 @@ public:
 	unsigned long                                      m_bIsRegistered : 1;                              		// 0x0140 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 	unsigned long                                      m_bUpdateAudioEnginePosition : 1;                 		// 0x0140 (0x0004) [0x0000000000000000] [0x00000010] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1328 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1328 );
 	};
 
 	void SetLocation ( struct FVector NewLocation );
@@ -561,8 +392,6 @@ public:
 	void SetRTPCWithHandler ( float fValue, struct FWwiseRTPCForActorHandler* RTPCHandler );
 };
 
-UClass* UWwiseAudioComponent::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseAudioComponentMultiLoc
 // 0x004C (0x0190 - 0x0144)
 class UWwiseAudioComponentMultiLoc : public UWwiseAudioComponent
@@ -572,23 +401,14 @@ public:
 	struct FVector                                     CachedMicPos;                                     		// 0x0180 (0x000C) [0x0000000000002000]              ( CPF_Transient )
 	unsigned long                                      IsDirty : 1;                                      		// 0x018C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1329 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1329 );
 	};
 
 	void Set3D ( );
 };
 
-UClass* UWwiseAudioComponentMultiLoc::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseAudioDevice
 // 0x016B (0x040C - 0x02A1)
 class UWwiseAudioDevice : public UAudioDevice
@@ -596,67 +416,40 @@ class UWwiseAudioDevice : public UAudioDevice
 public:
 	unsigned char                                      UnknownData00[ 0x16B ];                           		// 0x02A1 (0x016B) MISSED OFFSET
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1330 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1330 );
 	};
 
 	bool SetSoundMode ( struct FName NewMode );
 };
 
-UClass* UWwiseAudioDevice::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseBundleArchive
 // 0x0000 (0x003C - 0x003C)
 class UWwiseBundleArchive : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1331 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1331 );
 	};
 
 };
 
-UClass* UWwiseBundleArchive::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseComponentCallback
 // 0x0000 (0x003C - 0x003C)
 class UWwiseComponentCallback : public UInterface
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1332 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1332 );
 	};
 
 };
 
-UClass* UWwiseComponentCallback::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseEnvironmentSettings
 // 0x0024 (0x0060 - 0x003C)
 class UWwiseEnvironmentSettings : public UObject
@@ -671,22 +464,13 @@ public:
 	unsigned long                                      bIdResolved : 1;                                  		// 0x005C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned long                                      bOverrideLowerPriorityEnvironments : 1;           		// 0x005C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1333 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1333 );
 	};
 
 };
 
-UClass* UWwiseEnvironmentSettings::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseEnvironmentVolume
 // 0x0008 (0x0234 - 0x022C)
 class AWwiseEnvironmentVolume : public AVolume
@@ -695,22 +479,13 @@ public:
 	float                                              Priority;                                         		// 0x022C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	class UWwiseEnvironmentSettings*                   Settings;                                         		// 0x0230 (0x0004) [0x0000000004420009]              ( CPF_Edit | CPF_ExportObject | CPF_EditConst | CPF_NeedCtorLink | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1334 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1334 );
 	};
 
 };
 
-UClass* AWwiseEnvironmentVolume::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseEvent
 // 0x003C (0x0078 - 0x003C)
 class UWwiseEvent : public UWwiseBaseSoundObject
@@ -731,22 +506,13 @@ public:
 	unsigned long                                      bUsesDistanceRTPC : 1;                            		// 0x0074 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 	unsigned long                                      m_bHasEnvironmentalSettings : 1;                  		// 0x0074 (0x0004) [0x0000000000002000] [0x00000010] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1335 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1335 );
 	};
 
 };
 
-UClass* UWwiseEvent::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseDialogueEvent
 // 0x000C (0x0084 - 0x0078)
 class UWwiseDialogueEvent : public UWwiseEvent
@@ -754,22 +520,13 @@ class UWwiseDialogueEvent : public UWwiseEvent
 public:
 	TArray< struct FWwiseDialogueArgument >            Arguments;                                        		// 0x0078 (0x000C) [0x0000000000420003]              ( CPF_Edit | CPF_Const | CPF_EditConst | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1336 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1336 );
 	};
 
 };
 
-UClass* UWwiseDialogueEvent::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseEventPairObject
 // 0x0008 (0x0044 - 0x003C)
 class UWwiseEventPairObject : public UWwiseBaseSoundObject
@@ -778,22 +535,13 @@ public:
 	class UWwiseEvent*                                 Play;                                             		// 0x003C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	class UWwiseEvent*                                 Stop;                                             		// 0x0040 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1337 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1337 );
 	};
 
 };
 
-UClass* UWwiseEventPairObject::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseFaceFXStopper
 // 0x0010 (0x004C - 0x003C)
 class UWwiseFaceFXStopper : public UObject
@@ -804,22 +552,13 @@ public:
 	class UWwiseAudioComponent*                        m_WwiseAudioComp;                                 		// 0x0044 (0x0004) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 	class UWwiseEvent*                                 m_WwiseAudioEvent;                                		// 0x0048 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1338 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1338 );
 	};
 
 };
 
-UClass* UWwiseFaceFXStopper::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseFile
 // 0x000C (0x0048 - 0x003C)
 class UWwiseFile : public UObject
@@ -829,22 +568,13 @@ public:
 	int                                                Id;                                               		// 0x0040 (0x0004) [0x0000000000020003]              ( CPF_Edit | CPF_Const | CPF_EditConst )
 	unsigned long                                      IsRegistered : 1;                                 		// 0x0044 (0x0004) [0x0000000000022003] [0x00000001] ( CPF_Edit | CPF_Const | CPF_Transient | CPF_EditConst )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1339 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1339 );
 	};
 
 };
 
-UClass* UWwiseFile::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseBank
 // 0x0018 (0x0060 - 0x0048)
 class UWwiseBank : public UWwiseFile
@@ -857,22 +587,13 @@ public:
 	unsigned long                                      IsLoaded : 1;                                     		// 0x005C (0x0004) [0x0000000000022003] [0x00000002] ( CPF_Edit | CPF_Const | CPF_Transient | CPF_EditConst )
 	unsigned long                                      GenerateDefinition : 1;                           		// 0x005C (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1340 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1340 );
 	};
 
 };
 
-UClass* UWwiseBank::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseStream
 // 0x000C (0x0054 - 0x0048)
 class UWwiseStream : public UWwiseFile
@@ -881,38 +602,22 @@ public:
 	struct FName                                       Filename;                                         		// 0x0048 (0x0008) [0x0000000000000002]              ( CPF_Const )
 	class UWwiseBank*                                  Bank;                                             		// 0x0050 (0x0004) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1341 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1341 );
 	};
 
 };
 
-UClass* UWwiseStream::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseMicPosOrient
 // 0x0000 (0x01F6 - 0x01F6)
 class AWwiseMicPosOrient : public AActor
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1342 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1342 );
 	};
 
 	struct FVector LocalToWorld ( struct FVector vLocal );
@@ -1186,8 +891,6 @@ public:
 	void ForceUpdateComponents ( unsigned long bCollisionUpdate, unsigned long bTransformOnly );
 };
 
-UClass* AWwiseMicPosOrient::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseProcFoleyComponent
 // 0x006E (0x00C4 - 0x0056)
 class UWwiseProcFoleyComponent : public UActorComponent
@@ -1202,23 +905,14 @@ public:
 	int                                                m_nProcFoleyRTPCId;                               		// 0x00BC (0x0004) [0x0000000000000000]              
 	unsigned long                                      m_bIsPlaying : 1;                                 		// 0x00C0 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1343 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1343 );
 	};
 
 	int eventGetMAX_PROC_FOLEY_BONES ( );
 };
 
-UClass* UWwiseProcFoleyComponent::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseVolume
 // 0x0004 (0x0230 - 0x022C)
 class AWwiseVolume : public AVolume
@@ -1226,24 +920,15 @@ class AWwiseVolume : public AVolume
 public:
 	class AWwiseVolumeTimer*                           m_oTrackTimer;                                    		// 0x022C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1344 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1344 );
 	};
 
 	void TimerPop ( class AWwiseVolumeTimer* T );
 	void PostBeginPlay ( );
 };
 
-UClass* AWwiseVolume::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseAudioVolume
 // 0x0020 (0x0250 - 0x0230)
 class AWwiseAudioVolume : public AWwiseVolume
@@ -1258,16 +943,9 @@ public:
 	unsigned long                                      DrawSoundLocations : 1;                           		// 0x024C (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 	unsigned long                                      m_bIs2D : 1;                                      		// 0x024C (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1345 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1345 );
 	};
 
 	void HideVolume ( );
@@ -1279,8 +957,6 @@ public:
 	void PostBeginPlay ( );
 };
 
-UClass* AWwiseAudioVolume::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseMusicVolume
 // 0x0020 (0x0250 - 0x0230)
 class AWwiseMusicVolume : public AWwiseVolume
@@ -1297,16 +973,9 @@ public:
 	unsigned long                                      m_bMyMusicIsPlaying : 1;                          		// 0x024C (0x0004) [0x0000000000000000] [0x00000004] 
 	unsigned long                                      m_bEnabled : 1;                                   		// 0x024C (0x0004) [0x0000000000000000] [0x00000008] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1346 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1346 );
 	};
 
 	void myTimerPop ( );
@@ -1319,8 +988,6 @@ public:
 	void PostBeginPlay ( );
 };
 
-UClass* AWwiseMusicVolume::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseVolumeTimer
 // 0x0006 (0x01FC - 0x01F6)
 class AWwiseVolumeTimer : public AInfo
@@ -1328,46 +995,28 @@ class AWwiseVolumeTimer : public AInfo
 public:
 	class AWwiseVolume*                                m_oVolume;                                        		// 0x01F8 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 1347 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 1347 );
 	};
 
 	void Timer ( );
 };
 
-UClass* AWwiseVolumeTimer::pClassPointer = NULL;
-
 // Class WwiseAudio.ActorFactoryWwiseDistanceRTPC
 // 0x0000 (0x005C - 0x005C)
 class UActorFactoryWwiseDistanceRTPC : public UActorFactory
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 34991 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2929 );
 	};
 
 	void eventPostCreateActor ( class AActor* NewActor );
 };
 
-UClass* UActorFactoryWwiseDistanceRTPC::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseDistanceRTPC
 // 0x0016 (0x020C - 0x01F6)
 class AWwiseDistanceRTPC : public AActor
@@ -1377,46 +1026,28 @@ public:
 	float                                              TickDelay;                                        		// 0x0204 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	float                                              m_fTimeSinceLastUpdate;                           		// 0x0208 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 34993 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2930 );
 	};
 
 	void Tick ( float DeltaTime );
 };
 
-UClass* AWwiseDistanceRTPC::pClassPointer = NULL;
-
 // Class WwiseAudio.ActorFactoryWwiseMicPosOrient
 // 0x0000 (0x005C - 0x005C)
 class UActorFactoryWwiseMicPosOrient : public UActorFactory
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 34994 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2931 );
 	};
 
 	void eventPostCreateActor ( class AActor* NewActor );
 };
 
-UClass* UActorFactoryWwiseMicPosOrient::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseCollection
 // 0x0028 (0x0064 - 0x003C)
 class UWwiseCollection : public UObject
@@ -1427,38 +1058,22 @@ public:
 	TArray< class UWwiseStream* >                      Streams;                                          		// 0x0054 (0x000C) [0x0000000000420003]              ( CPF_Edit | CPF_Const | CPF_EditConst | CPF_NeedCtorLink )
 	class UWwiseBank*                                  Bank;                                             		// 0x0060 (0x0004) [0x0000000000020003]              ( CPF_Edit | CPF_Const | CPF_EditConst )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 35218 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2979 );
 	};
 
 };
 
-UClass* UWwiseCollection::pClassPointer = NULL;
-
 // Class WwiseAudio.WwiseOcclusionVolume
 // 0x0000 (0x022C - 0x022C)
 class AWwiseOcclusionVolume : public AVolume
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 35317 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 2989 );
 	};
 
 	void eventProcessActorSetVolume ( class AActor* Other );
@@ -1472,8 +1087,6 @@ public:
 	bool Encompasses ( class AActor* Other );
 };
 
-UClass* AWwiseOcclusionVolume::pClassPointer = NULL;
-
 
 #ifdef _MSC_VER
 	#pragma pack ( pop )
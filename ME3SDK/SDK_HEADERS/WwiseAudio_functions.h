@@ -28,10 +28,9 @@
 
 void UActorFactoryWwiseAmbientSound::eventPostCreateActor ( class AActor* NewActor )
 {
-	static UFunction* pFnPostCreateActor = NULL;
-
+	UFunction* pFnPostCreateActor = (UFunction*) SdkBindings::Get ( 2387 );
 	if ( ! pFnPostCreateActor )
-		pFnPostCreateActor = (UFunction*) UObject::GObjObjects()->Data[ 5133 ];
+		return;
 
 	UActorFactoryWwiseAmbientSound_eventPostCreateActor_Parms PostCreateActor_Parms;
 	PostCreateActor_Parms.NewActor = NewActor;
@@ -46,10 +45,9 @@ void UActorFactoryWwiseAmbientSound::eventPostCreateActor ( class AActor* NewAct
 
 int USeqAct_WwiseMusicVolumeDisable::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
-
+	UFunction* pFnGetObjClassVersion = (UFunction*) SdkBindings::Get ( 2932 );
 	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = (UFunction*) UObject::GObjObjects()->Data[ 35016 ];
+		return {};
 
 	USeqAct_WwiseMusicVolumeDisable_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -65,10 +63,9 @@ int USeqAct_WwiseMusicVolumeDisable::eventGetObjClassVersion ( )
 
 int USeqAct_WwiseMusicVolumeEnable::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
-
+	UFunction* pFnGetObjClassVersion = (UFunction*) SdkBindings::Get ( 2933 );
 	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = (UFunction*) UObject::GObjObjects()->Data[ 35019 ];
+		return {};
 
 	USeqAct_WwiseMusicVolumeEnable_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -84,10 +81,9 @@ int USeqAct_WwiseMusicVolumeEnable::eventGetObjClassVersion ( )
 
 int USeqAct_WwisePostEvent::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
-
+	UFunction* pFnGetObjClassVersion = (UFunction*) SdkBindings::Get ( 2934 );
 	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = (UFunction*) UObject::GObjObjects()->Data[ 35022 ];
+		return {};
 
 	USeqAct_WwisePostEvent_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -102,10 +98,9 @@ int USeqAct_WwisePostEvent::eventGetObjClassVersion ( )
 
 void AWwiseAmbientSound::HideEmitter ( )
 {
-	static UFunction* pFnHideEmitter = NULL;
-
+	UFunction* pFnHideEmitter = (UFunction*) SdkBindings::Get ( 2936 );
 	if ( ! pFnHideEmitter )
-		pFnHideEmitter = (UFunction*) UObject::GObjObjects()->Data[ 35036 ];
+		return;
 
 	AWwiseAmbientSound_execHideEmitter_Parms HideEmitter_Parms;
 
@@ -122,10 +117,9 @@ void AWwiseAmbientSound::HideEmitter ( )
 
 void AWwiseAmbientSound::DrawEmitter ( )
 {
-	static UFunction* pFnDrawEmitter = NULL;
-
+	UFunction* pFnDrawEmitter = (UFunction*) SdkBindings::Get ( 2935 );
 	if ( ! pFnDrawEmitter )
-		pFnDrawEmitter = (UFunction*) UObject::GObjObjects()->Data[ 35035 ];
+		return;
 
 	AWwiseAmbientSound_execDrawEmitter_Parms DrawEmitter_Parms;
 
@@ -143,10 +137,9 @@ void AWwiseAmbientSound::DrawEmitter ( )
 
 void UWwiseAudioComponent::SetLocation ( struct FVector NewLocation )
 {
-	static UFunction* pFnSetLocation = NULL;
-
+	UFunction* pFnSetLocation = (UFunction*) SdkBindings::Get ( 2968 );
 	if ( ! pFnSetLocation )
-		pFnSetLocation = (UFunction*) UObject::GObjObjects()->Data[ 35141 ];
+		return;
 
 	UWwiseAudioComponent_execSetLocation_Parms SetLocation_Parms;
 	memcpy ( &SetLocation_Parms.NewLocation, &NewLocation, 0xC );
@@ -161,10 +154,9 @@ void UWwiseAudioComponent::SetLocation ( struct FVector NewLocation )
 
 void UWwiseAudioComponent::SetDrawMic ( unsigned long bDraw )
 {
-	static UFunction* pFnSetDrawMic = NULL;
-
+	UFunction* pFnSetDrawMic = (UFunction*) SdkBindings::Get ( 2967 );
 	if ( ! pFnSetDrawMic )
-		pFnSetDrawMic = (UFunction*) UObject::GObjObjects()->Data[ 35139 ];
+		return;
 
 	UWwiseAudioComponent_execSetDrawMic_Parms SetDrawMic_Parms;
 	SetDrawMic_Parms.bDraw = bDraw;
@@ -184,10 +176,9 @@ void UWwiseAudioComponent::SetDrawMic ( unsigned long bDraw )
 
 bool UWwiseAudioComponent::KillSound ( class UWwiseEvent* Event )
 {
-	static UFunction* pFnKillSound = NULL;
-
+	UFunction* pFnKillSound = (UFunction*) SdkBindings::Get ( 2966 );
 	if ( ! pFnKillSound )
-		pFnKillSound = (UFunction*) UObject::GObjObjects()->Data[ 35136 ];
+		return {};
 
 	UWwiseAudioComponent_execKillSound_Parms KillSound_Parms;
 	KillSound_Parms.Event = Event;
@@ -207,10 +198,9 @@ bool UWwiseAudioComponent::KillSound ( class UWwiseEvent* Event )
 
 void UWwiseAudioComponent::Set3D ( )
 {
-	static UFunction* pFnSet3D = NULL;
-
+	UFunction* pFnSet3D = (UFunction*) SdkBindings::Get ( 2965 );
 	if ( ! pFnSet3D )
-		pFnSet3D = (UFunction*) UObject::GObjObjects()->Data[ 35135 ];
+		return;
 
 	UWwiseAudioComponent_execSet3D_Parms Set3D_Parms;
 
@@ -227,10 +217,9 @@ void UWwiseAudioComponent::Set3D ( )
 
 void UWwiseAudioComponent::Set2D ( )
 {
-	static UFunction* pFnSet2D = NULL;
-
+	UFunction* pFnSet2D = (UFunction*) SdkBindings::Get ( 2964 );
 	if ( ! pFnSet2D )
-		pFnSet2D = (UFunction*) UObject::GObjObjects()->Data[ 35134 ];
+		return;
 
 	UWwiseAudioComponent_execSet2D_Parms Set2D_Parms;
 
@@ -249,10 +238,9 @@ void UWwiseAudioComponent::Set2D ( )
 
 bool UWwiseAudioComponent::RegisterGameObject ( struct FString GameObjectName )
 {
-	static UFunction* pFnRegisterGameObject = NULL;
-
+	UFunction* pFnRegisterGameObject = (UFunction*) SdkBindings::Get ( 2963 );
 	if ( ! pFnRegisterGameObject )
-		pFnRegisterGameObject = (UFunction*) UObject::GObjObjects()->Data[ 35131 ];
+		return {};
 
 	UWwiseAudioComponent_execRegisterGameObject_Parms RegisterGameObject_Parms;
 	memcpy ( &RegisterGameObject_Parms.GameObjectName, &GameObjectName, 0xC );
@@ -273,10 +261,9 @@ bool UWwiseAudioComponent::RegisterGameObject ( struct FString GameObjectName )
 
 bool UWwiseAudioComponent::UnregisterGameObject ( )
 {
-	static UFunction* pFnUnregisterGameObject = NULL;
-
+	UFunction* pFnUnregisterGameObject = (UFunction*) SdkBindings::Get ( 2962 );
 	if ( ! pFnUnregisterGameObject )
-		pFnUnregisterGameObject = (UFunction*) UObject::GObjObjects()->Data[ 35129 ];
+		return {};
 
 	UWwiseAudioComponent_execUnregisterGameObject_Parms UnregisterGameObject_Parms;
 
@@ -296,10 +283,9 @@ bool UWwiseAudioComponent::UnregisterGameObject ( )
 
 float UWwiseAudioComponent::GetDistanceToListener ( )
 {
-	static UFunction* pFnGetDistanceToListener = NULL;
-
+	UFunction* pFnGetDistanceToListener = (UFunction*) SdkBindings::Get ( 2961 );
 	if ( ! pFnGetDistanceToListener )
-		pFnGetDistanceToListener = (UFunction*) UObject::GObjObjects()->Data[ 35127 ];
+		return {};
 
 	UWwiseAudioComponent_execGetDistanceToListener_Parms GetDistanceToListener_Parms;
 
@@ -319,10 +305,9 @@ float UWwiseAudioComponent::GetDistanceToListener ( )
 
 void UWwiseAudioComponent::SetObstructionOcclusionEnabled ( unsigned long i_bValue )
 {
-	static UFunction* pFnSetObstructionOcclusionEnabled = NULL;
-
+	UFunction* pFnSetObstructionOcclusionEnabled = (UFunction*) SdkBindings::Get ( 2960 );
 	if ( ! pFnSetObstructionOcclusionEnabled )
-		pFnSetObstructionOcclusionEnabled = (UFunction*) UObject::GObjObjects()->Data[ 35125 ];
+		return;
 
 	UWwiseAudioComponent_execSetObstructionOcclusionEnabled_Parms SetObstructionOcclusionEnabled_Parms;
 	SetObstructionOcclusionEnabled_Parms.i_bValue = i_bValue;
@@ -341,10 +326,9 @@ void UWwiseAudioComponent::SetObstructionOcclusionEnabled ( unsigned long i_bVal
 
 void UWwiseAudioComponent::SetEnvironmentalAudioEnabled ( unsigned long i_bValue )
 {
-	static UFunction* pFnSetEnvironmentalAudioEnabled = NULL;
-
+	UFunction* pFnSetEnvironmentalAudioEnabled = (UFunction*) SdkBindings::Get ( 2959 );
 	if ( ! pFnSetEnvironmentalAudioEnabled )
-		pFnSetEnvironmentalAudioEnabled = (UFunction*) UObject::GObjObjects()->Data[ 35123 ];
+		return;
 
 	UWwiseAudioComponent_execSetEnvironmentalAudioEnabled_Parms SetEnvironmentalAudioEnabled_Parms;
 	SetEnvironmentalAudioEnabled_Parms.i_bValue = i_bValue;
@@ -363,10 +347,9 @@ void UWwiseAudioComponent::SetEnvironmentalAudioEnabled ( unsigned long i_bValue
 
 bool UWwiseAudioComponent::GetObstructionOcclusionEnabled ( )
 {
-	static UFunction* pFnGetObstructionOcclusionEnabled = NULL;
-
+	UFunction* pFnGetObstructionOcclusionEnabled = (UFunction*) SdkBindings::Get ( 2958 );
 	if ( ! pFnGetObstructionOcclusionEnabled )
-		pFnGetObstructionOcclusionEnabled = (UFunction*) UObject::GObjObjects()->Data[ 35121 ];
+		return {};
 
 	UWwiseAudioComponent_execGetObstructionOcclusionEnabled_Parms GetObstructionOcclusionEnabled_Parms;
 
@@ -386,10 +369,9 @@ bool UWwiseAudioComponent::GetObstructionOcclusionEnabled ( )
 
 bool UWwiseAudioComponent::GetEnvironmentalAudioEnabled ( )
 {
-	static UFunction* pFnGetEnvironmentalAudioEnabled = NULL;
-
+	UFunction* pFnGetEnvironmentalAudioEnabled = (UFunction*) SdkBindings::Get ( 2957 );
 	if ( ! pFnGetEnvironmentalAudioEnabled )
-		pFnGetEnvironmentalAudioEnabled = (UFunction*) UObject::GObjObjects()->Data[ 35119 ];
+		return {};
 
 	UWwiseAudioComponent_execGetEnvironmentalAudioEnabled_Parms GetEnvironmentalAudioEnabled_Parms;
 
@@ -409,10 +391,9 @@ bool UWwiseAudioComponent::GetEnvironmentalAudioEnabled ( )
 
 struct FVector UWwiseAudioComponent::GetMicPosition ( )
 {
-	static UFunction* pFnGetMicPosition = NULL;
-
+	UFunction* pFnGetMicPosition = (UFunction*) SdkBindings::Get ( 2956 );
 	if ( ! pFnGetMicPosition )
-		pFnGetMicPosition = (UFunction*) UObject::GObjObjects()->Data[ 35117 ];
+		return {};
 
 	UWwiseAudioComponent_execGetMicPosition_Parms GetMicPosition_Parms;
 
@@ -434,10 +415,9 @@ struct FVector UWwiseAudioComponent::GetMicPosition ( )
 
 bool UWwiseAudioComponent::SetGlobalRTPCFromScript ( struct FString in_pszRtpcName, float in_value )
 {
-	static UFunction* pFnSetGlobalRTPCFromScript = NULL;
-
+	UFunction* pFnSetGlobalRTPCFromScript = (UFunction*) SdkBindings::Get ( 2955 );
 	if ( ! pFnSetGlobalRTPCFromScript )
-		pFnSetGlobalRTPCFromScript = (UFunction*) UObject::GObjObjects()->Data[ 35113 ];
+		return {};
 
 	UWwiseAudioComponent_execSetGlobalRTPCFromScript_Parms SetGlobalRTPCFromScript_Parms;
 	memcpy ( &SetGlobalRTPCFromScript_Parms.in_pszRtpcName, &in_pszRtpcName, 0xC );
@@ -460,10 +440,9 @@ bool UWwiseAudioComponent::SetGlobalRTPCFromScript ( struct FString in_pszRtpcNa
 
 bool UWwiseAudioComponent::StaticPostGlobalEventFromScript ( struct FName GlobalEventName )
 {
-	static UFunction* pFnStaticPostGlobalEventFromScript = NULL;
-
+	UFunction* pFnStaticPostGlobalEventFromScript = (UFunction*) SdkBindings::Get ( 2954 );
 	if ( ! pFnStaticPostGlobalEventFromScript )
-		pFnStaticPostGlobalEventFromScript = (UFunction*) UObject::GObjObjects()->Data[ 35110 ];
+		return {};
 
 	UWwiseAudioComponent_execStaticPostGlobalEventFromScript_Parms StaticPostGlobalEventFromScript_Parms;
 	memcpy ( &StaticPostGlobalEventFromScript_Parms.GlobalEventName, &GlobalEventName, 0x8 );
@@ -489,10 +468,9 @@ bool UWwiseAudioComponent::StaticPostGlobalEventFromScript ( struct FName Global
 
 class UWwiseAudioComponent* UWwiseAudioComponent::CreateComponentFromScript ( class AActor* pActor, struct FString Label, struct FName ComponentGroup, struct FName AttachBone, unsigned long bRegister )
 {
-	static UFunction* pFnCreateComponentFromScript = NULL;
-
+	UFunction* pFnCreateComponentFromScript = (UFunction*) SdkBindings::Get ( 2953 );
 	if ( ! pFnCreateComponentFromScript )
-		pFnCreateComponentFromScript = (UFunction*) UObject::GObjObjects()->Data[ 35103 ];
+		return {};
 
 	UWwiseAudioComponent_execCreateComponentFromScript_Parms CreateComponentFromScript_Parms;
 	CreateComponentFromScript_Parms.pActor = pActor;
@@ -518,10 +496,9 @@ class UWwiseAudioComponent* UWwiseAudioComponent::CreateComponentFromScript ( cl
 
 bool UWwiseAudioComponent::IsEventPlaying ( int WwisePlayingID )
 {
-	static UFunction* pFnIsEventPlaying = NULL;
-
+	UFunction* pFnIsEventPlaying = (UFunction*) SdkBindings::Get ( 2952 );
 	if ( ! pFnIsEventPlaying )
-		pFnIsEventPlaying = (UFunction*) UObject::GObjObjects()->Data[ 35100 ];
+		return {};
 
 	UWwiseAudioComponent_execIsEventPlaying_Parms IsEventPlaying_Parms;
 	IsEventPlaying_Parms.WwisePlayingID = WwisePlayingID;
@@ -543,10 +520,9 @@ bool UWwiseAudioComponent::IsEventPlaying ( int WwisePlayingID )
 
 bool UWwiseAudioComponent::IsPlaying ( class UWwiseBaseSoundObject* Event )
 {
-	static UFunction* pFnIsPlaying = NULL;
-
+	UFunction* pFnIsPlaying = (UFunction*) SdkBindings::Get ( 2951 );
 	if ( ! pFnIsPlaying )
-		pFnIsPlaying = (UFunction*) UObject::GObjObjects()->Data[ 35097 ];
+		return {};
 
 	UWwiseAudioComponent_execIsPlaying_Parms IsPlaying_Parms;
 	IsPlaying_Parms.Event = Event;
@@ -568,10 +544,9 @@ bool UWwiseAudioComponent::IsPlaying ( class UWwiseBaseSoundObject* Event )
 
 bool UWwiseAudioComponent::PostGlobalEvent ( struct FName GlobalEventName )
 {
-	static UFunction* pFnPostGlobalEvent = NULL;
-
+	UFunction* pFnPostGlobalEvent = (UFunction*) SdkBindings::Get ( 2950 );
 	if ( ! pFnPostGlobalEvent )
-		pFnPostGlobalEvent = (UFunction*) UObject::GObjObjects()->Data[ 35094 ];
+		return {};
 
 	UWwiseAudioComponent_execPostGlobalEvent_Parms PostGlobalEvent_Parms;
 	memcpy ( &PostGlobalEvent_Parms.GlobalEventName, &GlobalEventName, 0x8 );
@@ -593,10 +568,9 @@ bool UWwiseAudioComponent::PostGlobalEvent ( struct FName GlobalEventName )
 
 bool UWwiseAudioComponent::SetWwiseTrigger ( struct FString sTrigger )
 {
-	static UFunction* pFnSetWwiseTrigger = NULL;
-
+	UFunction* pFnSetWwiseTrigger = (UFunction*) SdkBindings::Get ( 2949 );
 	if ( ! pFnSetWwiseTrigger )
-		pFnSetWwiseTrigger = (UFunction*) UObject::GObjObjects()->Data[ 35091 ];
+		return {};
 
 	UWwiseAudioComponent_execSetWwiseTrigger_Parms SetWwiseTrigger_Parms;
 	memcpy ( &SetWwiseTrigger_Parms.sTrigger, &sTrigger, 0xC );
@@ -619,10 +593,9 @@ bool UWwiseAudioComponent::SetWwiseTrigger ( struct FString sTrigger )
 
 bool UWwiseAudioComponent::SetWwiseSwitch ( struct FString sGroup, struct FString sState )
 {
-	static UFunction* pFnSetWwiseSwitch = NULL;
-
+	UFunction* pFnSetWwiseSwitch = (UFunction*) SdkBindings::Get ( 2948 );
 	if ( ! pFnSetWwiseSwitch )
-		pFnSetWwiseSwitch = (UFunction*) UObject::GObjObjects()->Data[ 35087 ];
+		return {};
 
 	UWwiseAudioComponent_execSetWwiseSwitch_Parms SetWwiseSwitch_Parms;
 	memcpy ( &SetWwiseSwitch_Parms.sGroup, &sGroup, 0xC );
@@ -646,10 +619,9 @@ bool UWwiseAudioComponent::SetWwiseSwitch ( struct FString sGroup, struct FStrin
 
 bool UWwiseAudioComponent::SetWwiseRTPCs ( TArray< struct FString > sName, TArray< float > fValue )
 {
-	static UFunction* pFnSetWwiseRTPCs = NULL;
-
+	UFunction* pFnSetWwiseRTPCs = (UFunction*) SdkBindings::Get ( 2947 );
 	if ( ! pFnSetWwiseRTPCs )
-		pFnSetWwiseRTPCs = (UFunction*) UObject::GObjObjects()->Data[ 35081 ];
+		return {};
 
 	UWwiseAudioComponent_execSetWwiseRTPCs_Parms SetWwiseRTPCs_Parms;
 	memcpy ( &SetWwiseRTPCs_Parms.sName, &sName, 0xC );
@@ -673,10 +645,9 @@ bool UWwiseAudioComponent::SetWwiseRTPCs ( TArray< struct FString > sName, TArra
 
 bool UWwiseAudioComponent::SetWwiseRTPC ( struct FString sName, float fValue )
 {
-	static UFunction* pFnSetWwiseRTPC = NULL;
-
+	UFunction* pFnSetWwiseRTPC = (UFunction*) SdkBindings::Get ( 2946 );
 	if ( ! pFnSetWwiseRTPC )
-		pFnSetWwiseRTPC = (UFunction*) UObject::GObjObjects()->Data[ 35077 ];
+		return {};
 
 	UWwiseAudioComponent_execSetWwiseRTPC_Parms SetWwiseRTPC_Parms;
 	memcpy ( &SetWwiseRTPC_Parms.sName, &sName, 0xC );
@@ -699,10 +670,9 @@ bool UWwiseAudioComponent::SetWwiseRTPC ( struct FString sName, float fValue )
 
 bool UWwiseAudioComponent::Stop ( class UWwiseBaseSoundObject* Base )
 {
-	static UFunction* pFnStop = NULL;
-
+	UFunction* pFnStop = (UFunction*) SdkBindings::Get ( 2945 );
 	if ( ! pFnStop )
-		pFnStop = (UFunction*) UObject::GObjObjects()->Data[ 35074 ];
+		return {};
 
 	UWwiseAudioComponent_execStop_Parms Stop_Parms;
 	Stop_Parms.Base = Base;
@@ -724,10 +694,9 @@ bool UWwiseAudioComponent::Stop ( class UWwiseBaseSoundObject* Base )
 
 bool UWwiseAudioComponent::StopWwiseEvent ( struct FWwiseEventPair AudioEvent )
 {
-	static UFunction* pFnStopWwiseEvent = NULL;
-
+	UFunction* pFnStopWwiseEvent = (UFunction*) SdkBindings::Get ( 2944 );
 	if ( ! pFnStopWwiseEvent )
-		pFnStopWwiseEvent = (UFunction*) UObject::GObjObjects()->Data[ 35071 ];
+		return {};
 
 	UWwiseAudioComponent_execStopWwiseEvent_Parms StopWwiseEvent_Parms;
 	memcpy ( &StopWwiseEvent_Parms.AudioEvent, &AudioEvent, 0x8 );
@@ -750,10 +719,9 @@ bool UWwiseAudioComponent::StopWwiseEvent ( struct FWwiseEventPair AudioEvent )
 
 bool UWwiseAudioComponent::Play ( class UWwiseBaseSoundObject* Base, unsigned long bTrackPosition )
 {
-	static UFunction* pFnPlay = NULL;
-
+	UFunction* pFnPlay = (UFunction*) SdkBindings::Get ( 2943 );
 	if ( ! pFnPlay )
-		pFnPlay = (UFunction*) UObject::GObjObjects()->Data[ 35067 ];
+		return {};
 
 	UWwiseAudioComponent_execPlay_Parms Play_Parms;
 	Play_Parms.Base = Base;
@@ -777,10 +745,9 @@ bool UWwiseAudioComponent::Play ( class UWwiseBaseSoundObject* Base, unsigned lo
 
 bool UWwiseAudioComponent::PlayWwiseEvent ( struct FWwiseEventPair AudioEvent, unsigned long bTrackPosition )
 {
-	static UFunction* pFnPlayWwiseEvent = NULL;
-
+	UFunction* pFnPlayWwiseEvent = (UFunction*) SdkBindings::Get ( 2942 );
 	if ( ! pFnPlayWwiseEvent )
-		pFnPlayWwiseEvent = (UFunction*) UObject::GObjObjects()->Data[ 35063 ];
+		return {};
 
 	UWwiseAudioComponent_execPlayWwiseEvent_Parms PlayWwiseEvent_Parms;
 	memcpy ( &PlayWwiseEvent_Parms.AudioEvent, &AudioEvent, 0x8 );
@@ -803,10 +770,9 @@ bool UWwiseAudioComponent::PlayWwiseEvent ( struct FWwiseEventPair AudioEvent, u
 
 float UWwiseAudioComponent::SoundPositionByID ( int WwisePlayingID )
 {
-	static UFunction* pFnSoundPositionByID = NULL;
-
+	UFunction* pFnSoundPositionByID = (UFunction*) SdkBindings::Get ( 2941 );
 	if ( ! pFnSoundPositionByID )
-		pFnSoundPositionByID = (UFunction*) UObject::GObjObjects()->Data[ 35060 ];
+		return {};
 
 	UWwiseAudioComponent_execSoundPositionByID_Parms SoundPositionByID_Parms;
 	SoundPositionByID_Parms.WwisePlayingID = WwisePlayingID;
@@ -828,10 +794,9 @@ float UWwiseAudioComponent::SoundPositionByID ( int WwisePlayingID )
 
 float UWwiseAudioComponent::SoundPosition ( class UWwiseBaseSoundObject* Base )
 {
-	static UFunction* pFnSoundPosition = NULL;
-
+	UFunction* pFnSoundPosition = (UFunction*) SdkBindings::Get ( 2940 );
 	if ( ! pFnSoundPosition )
-		pFnSoundPosition = (UFunction*) UObject::GObjObjects()->Data[ 35057 ];
+		return {};
 
 	UWwiseAudioComponent_execSoundPosition_Parms SoundPosition_Parms;
 	SoundPosition_Parms.Base = Base;
@@ -852,10 +817,9 @@ float UWwiseAudioComponent::SoundPosition ( class UWwiseBaseSoundObject* Base )
 
 bool UWwiseAudioComponent::StopAll ( )
 {
-	static UFunction* pFnStopAll = NULL;
-
+	UFunction* pFnStopAll = (UFunction*) SdkBindings::Get ( 2939 );
 	if ( ! pFnStopAll )
-		pFnStopAll = (UFunction*) UObject::GObjObjects()->Data[ 35055 ];
+		return {};
 
 	UWwiseAudioComponent_execStopAll_Parms StopAll_Parms;
 
@@ -877,10 +841,9 @@ bool UWwiseAudioComponent::StopAll ( )
 
 int UWwiseAudioComponent::FindPlayingID ( class UWwiseBaseSoundObject* BaseSound, class UWwiseEvent* StopEvent )
 {
-	static UFunction* pFnFindPlayingID = NULL;
-
+	UFunction* pFnFindPlayingID = (UFunction*) SdkBindings::Get ( 2938 );
 	if ( ! pFnFindPlayingID )
-		pFnFindPlayingID = (UFunction*) UObject::GObjObjects()->Data[ 35051 ];
+		return {};
 
 	UWwiseAudioComponent_execFindPlayingID_Parms FindPlayingID_Parms;
 	FindPlayingID_Parms.BaseSound = BaseSound;
@@ -903,10 +866,9 @@ int UWwiseAudioComponent::FindPlayingID ( class UWwiseBaseSoundObject* BaseSound
 
 void UWwiseAudioComponent::SetRTPCWithHandler ( float fValue, struct FWwiseRTPCForActorHandler* RTPCHandler )
 {
-	static UFunction* pFnSetRTPCWithHandler = NULL;
-
+	UFunction* pFnSetRTPCWithHandler = (UFunction*) SdkBindings::Get ( 2937 );
 	if ( ! pFnSetRTPCWithHandler )
-		pFnSetRTPCWithHandler = (UFunction*) UObject::GObjObjects()->Data[ 35048 ];
+		return;
 
 	UWwiseAudioComponent_execSetRTPCWithHandler_Parms SetRTPCWithHandler_Parms;
 	SetRTPCWithHandler_Parms.fValue = fValue;
@@ -927,10 +889,9 @@ void UWwiseAudioComponent::SetRTPCWithHandler ( float fValue, struct FWwiseRTPCF
 
 void UWwiseAudioComponentMultiLoc::Set3D ( )
 {
-	static UFunction* pFnSet3D = NULL;
-
+	UFunction* pFnSet3D = (UFunction*) SdkBindings::Get ( 2969 );
 	if ( ! pFnSet3D )
-		pFnSet3D = (UFunction*) UObject::GObjObjects()->Data[ 35175 ];
+		return;
 
 	UWwiseAudioComponentMultiLoc_execSet3D_Parms Set3D_Parms;
 
@@ -949,10 +910,9 @@ void UWwiseAudioComponentMultiLoc::Set3D ( )
 
 bool UWwiseAudioDevice::SetSoundMode ( struct FName NewMode )
 {
-	static UFunction* pFnSetSoundMode = NULL;
-
+	UFunction* pFnSetSoundMode = (UFunction*) SdkBindings::Get ( 2416 );
 	if ( ! pFnSetSoundMode )
-		pFnSetSoundMode = (UFunction*) UObject::GObjObjects()->Data[ 9256 ];
+		return {};
 
 	UWwiseAudioDevice_execSetSoundMode_Parms SetSoundMode_Parms;
 	memcpy ( &SetSoundMode_Parms.NewMode, &NewMode, 0x8 );
@@ -974,10 +934,9 @@ bool UWwiseAudioDevice::SetSoundMode ( struct FName NewMode )
 
 struct FVector AWwiseMicPosOrient::LocalToWorld ( struct FVector vLocal )
 {
-	static UFunction* pFnLocalToWorld = NULL;
-
+	UFunction* pFnLocalToWorld = (UFunction*) SdkBindings::Get ( 2384 );
 	if ( ! pFnLocalToWorld )
-		pFnLocalToWorld = (UFunction*) UObject::GObjObjects()->Data[ 4835 ];
+		return {};
 
 	AWwiseMicPosOrient_execLocalToWorld_Parms LocalToWorld_Parms;
 	memcpy ( &LocalToWorld_Parms.vLocal, &vLocal, 0xC );
@@ -997,10 +956,9 @@ struct FVector AWwiseMicPosOrient::LocalToWorld ( struct FVector vLocal )
 
 void AWwiseMicPosOrient::eventBioBaseRemovedFromWorld ( )
 {
-	static UFunction* pFnBioBaseRemovedFromWorld = NULL;
-
+	UFunction* pFnBioBaseRemovedFromWorld = (UFunction*) SdkBindings::Get ( 2383 );
 	if ( ! pFnBioBaseRemovedFromWorld )
-		pFnBioBaseRemovedFromWorld = (UFunction*) UObject::GObjObjects()->Data[ 4834 ];
+		return;
 
 	AWwiseMicPosOrient_eventBioBaseRemovedFromWorld_Parms BioBaseRemovedFromWorld_Parms;
 
@@ -1013,10 +971,9 @@ void AWwiseMicPosOrient::eventBioBaseRemovedFromWorld ( )
 
 void AWwiseMicPosOrient::BioRestoreFromStasis ( )
 {
-	static UFunction* pFnBioRestoreFromStasis = NULL;
-
+	UFunction* pFnBioRestoreFromStasis = (UFunction*) SdkBindings::Get ( 2320 );
 	if ( ! pFnBioRestoreFromStasis )
-		pFnBioRestoreFromStasis = (UFunction*) UObject::GObjObjects()->Data[ 4639 ];
+		return;
 
 	AWwiseMicPosOrient_execBioRestoreFromStasis_Parms BioRestoreFromStasis_Parms;
 
@@ -1034,10 +991,9 @@ void AWwiseMicPosOrient::BioRestoreFromStasis ( )
 
 void AWwiseMicPosOrient::BioApplyStasis ( struct FString Cause )
 {
-	static UFunction* pFnBioApplyStasis = NULL;
-
+	UFunction* pFnBioApplyStasis = (UFunction*) SdkBindings::Get ( 2382 );
 	if ( ! pFnBioApplyStasis )
-		pFnBioApplyStasis = (UFunction*) UObject::GObjObjects()->Data[ 4832 ];
+		return;
 
 	AWwiseMicPosOrient_execBioApplyStasis_Parms BioApplyStasis_Parms;
 	memcpy ( &BioApplyStasis_Parms.Cause, &Cause, 0xC );
@@ -1056,10 +1012,9 @@ void AWwiseMicPosOrient::BioApplyStasis ( struct FString Cause )
 
 void AWwiseMicPosOrient::eventPlayFootStepSound ( int FootDown )
 {
-	static UFunction* pFnPlayFootStepSound = NULL;
-
+	UFunction* pFnPlayFootStepSound = (UFunction*) SdkBindings::Get ( 2381 );
 	if ( ! pFnPlayFootStepSound )
-		pFnPlayFootStepSound = (UFunction*) UObject::GObjObjects()->Data[ 4830 ];
+		return;
 
 	AWwiseMicPosOrient_eventPlayFootStepSound_Parms PlayFootStepSound_Parms;
 	PlayFootStepSound_Parms.FootDown = FootDown;
@@ -1074,10 +1029,9 @@ void AWwiseMicPosOrient::eventPlayFootStepSound ( int FootDown )
 
 void AWwiseMicPosOrient::eventSFXSetAudioComponentRTPCs ( class UActorComponent* pWwiseAudioComponent )
 {
-	static UFunction* pFnSFXSetAudioComponentRTPCs = NULL;
-
+	UFunction* pFnSFXSetAudioComponentRTPCs = (UFunction*) SdkBindings::Get ( 2380 );
 	if ( ! pFnSFXSetAudioComponentRTPCs )
-		pFnSFXSetAudioComponentRTPCs = (UFunction*) UObject::GObjObjects()->Data[ 4828 ];
+		return;
 
 	AWwiseMicPosOrient_eventSFXSetAudioComponentRTPCs_Parms SFXSetAudioComponentRTPCs_Parms;
 	SFXSetAudioComponentRTPCs_Parms.pWwiseAudioComponent = pWwiseAudioComponent;
@@ -1092,10 +1046,9 @@ void AWwiseMicPosOrient::eventSFXSetAudioComponentRTPCs ( class UActorComponent*
 
 class USkeletalMeshComponent* AWwiseMicPosOrient::GetHeadSkelMeshComponent ( )
 {
-	static UFunction* pFnGetHeadSkelMeshComponent = NULL;
-
+	UFunction* pFnGetHeadSkelMeshComponent = (UFunction*) SdkBindings::Get ( 2379 );
 	if ( ! pFnGetHeadSkelMeshComponent )
-		pFnGetHeadSkelMeshComponent = (UFunction*) UObject::GObjObjects()->Data[ 4826 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetHeadSkelMeshComponent_Parms GetHeadSkelMeshComponent_Parms;
 
@@ -1115,10 +1068,9 @@ class USkeletalMeshComponent* AWwiseMicPosOrient::GetHeadSkelMeshComponent ( )
 
 class USkeletalMeshComponent* AWwiseMicPosOrient::GetPrimarySkelMeshComponent ( )
 {
-	static UFunction* pFnGetPrimarySkelMeshComponent = NULL;
-
+	UFunction* pFnGetPrimarySkelMeshComponent = (UFunction*) SdkBindings::Get ( 2378 );
 	if ( ! pFnGetPrimarySkelMeshComponent )
-		pFnGetPrimarySkelMeshComponent = (UFunction*) UObject::GObjObjects()->Data[ 4824 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetPrimarySkelMeshComponent_Parms GetPrimarySkelMeshComponent_Parms;
 
@@ -1145,10 +1097,9 @@ class USkeletalMeshComponent* AWwiseMicPosOrient::GetPrimarySkelMeshComponent (
 
 bool AWwiseMicPosOrient::ImpactWithPower ( unsigned char Resistance, class APawn* Caster, struct FVector HitLocation, struct FVector HitNormal, float Damage, struct FVector Force, class UClass* DamageType )
 {
-	static UFunction* pFnImpactWithPower = NULL;
-
+	UFunction* pFnImpactWithPower = (UFunction*) SdkBindings::Get ( 2377 );
 	if ( ! pFnImpactWithPower )
-		pFnImpactWithPower = (UFunction*) UObject::GObjObjects()->Data[ 4815 ];
+		return {};
 
 	AWwiseMicPosOrient_execImpactWithPower_Parms ImpactWithPower_Parms;
 	ImpactWithPower_Parms.Resistance = Resistance;
@@ -1178,10 +1129,9 @@ bool AWwiseMicPosOrient::ImpactWithPower ( unsigned char Resistance, class APawn
 
 unsigned char AWwiseMicPosOrient::GetPowerResistance ( class APawn* Caster, struct FVector HitLocation, struct FVector HitNormal, class UClass* DamageType, float* Damage, struct FVector* Force, class AActor** TargetOverride )
 {
-	static UFunction* pFnGetPowerResistance = NULL;
-
+	UFunction* pFnGetPowerResistance = (UFunction*) SdkBindings::Get ( 2376 );
 	if ( ! pFnGetPowerResistance )
-		pFnGetPowerResistance = (UFunction*) UObject::GObjObjects()->Data[ 4806 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetPowerResistance_Parms GetPowerResistance_Parms;
 	GetPowerResistance_Parms.Caster = Caster;
@@ -1210,10 +1160,9 @@ unsigned char AWwiseMicPosOrient::GetPowerResistance ( class APawn* Caster, stru
 
 void AWwiseMicPosOrient::RemoveSFXModuleIndex ( int nIndex )
 {
-	static UFunction* pFnRemoveSFXModuleIndex = NULL;
-
+	UFunction* pFnRemoveSFXModuleIndex = (UFunction*) SdkBindings::Get ( 2375 );
 	if ( ! pFnRemoveSFXModuleIndex )
-		pFnRemoveSFXModuleIndex = (UFunction*) UObject::GObjObjects()->Data[ 4804 ];
+		return;
 
 	AWwiseMicPosOrient_execRemoveSFXModuleIndex_Parms RemoveSFXModuleIndex_Parms;
 	RemoveSFXModuleIndex_Parms.nIndex = nIndex;
@@ -1232,10 +1181,9 @@ void AWwiseMicPosOrient::RemoveSFXModuleIndex ( int nIndex )
 
 void AWwiseMicPosOrient::RemoveSFXModule ( class USFXModule* oModule )
 {
-	static UFunction* pFnRemoveSFXModule = NULL;
-
+	UFunction* pFnRemoveSFXModule = (UFunction*) SdkBindings::Get ( 2374 );
 	if ( ! pFnRemoveSFXModule )
-		pFnRemoveSFXModule = (UFunction*) UObject::GObjObjects()->Data[ 4802 ];
+		return;
 
 	AWwiseMicPosOrient_execRemoveSFXModule_Parms RemoveSFXModule_Parms;
 	RemoveSFXModule_Parms.oModule = oModule;
@@ -1255,10 +1203,9 @@ void AWwiseMicPosOrient::RemoveSFXModule ( class USFXModule* oModule )
 
 void AWwiseMicPosOrient::AddSFXModule ( class USFXModule* oModule, unsigned long bUserModule )
 {
-	static UFunction* pFnAddSFXModule = NULL;
-
+	UFunction* pFnAddSFXModule = (UFunction*) SdkBindings::Get ( 2373 );
 	if ( ! pFnAddSFXModule )
-		pFnAddSFXModule = (UFunction*) UObject::GObjObjects()->Data[ 4799 ];
+		return;
 
 	AWwiseMicPosOrient_execAddSFXModule_Parms AddSFXModule_Parms;
 	AddSFXModule_Parms.oModule = oModule;
@@ -1277,10 +1224,9 @@ void AWwiseMicPosOrient::AddSFXModule ( class USFXModule* oModule, unsigned long
 
 void AWwiseMicPosOrient::StopAllSounds ( )
 {
-	static UFunction* pFnStopAllSounds = NULL;
-
+	UFunction* pFnStopAllSounds = (UFunction*) SdkBindings::Get ( 2372 );
 	if ( ! pFnStopAllSounds )
-		pFnStopAllSounds = (UFunction*) UObject::GObjObjects()->Data[ 4798 ];
+		return;
 
 	AWwiseMicPosOrient_execStopAllSounds_Parms StopAllSounds_Parms;
 
@@ -1305,10 +1251,9 @@ void AWwiseMicPosOrient::StopAllSounds ( )
 
 bool AWwiseMicPosOrient::WillOverlap ( struct FVector PosA, struct FVector VelA, struct FVector PosB, struct FVector VelB, float StepSize, float Radius, float* Time )
 {
-	static UFunction* pFnWillOverlap = NULL;
-
+	UFunction* pFnWillOverlap = (UFunction*) SdkBindings::Get ( 2371 );
 	if ( ! pFnWillOverlap )
-		pFnWillOverlap = (UFunction*) UObject::GObjObjects()->Data[ 4789 ];
+		return {};
 
 	AWwiseMicPosOrient_execWillOverlap_Parms WillOverlap_Parms;
 	memcpy ( &WillOverlap_Parms.PosA, &PosA, 0xC );
@@ -1344,10 +1289,9 @@ bool AWwiseMicPosOrient::WillOverlap ( struct FVector PosA, struct FVector VelA,
 
 struct FVector AWwiseMicPosOrient::GetAvoidanceVector ( struct FVector GoalLocation, float CollisionRadius, float MaxSpeed, int NumSamples, float VelocityStepRate, float MaxTimeTilOverlap, TArray< class AActor* >* Obstacles )
 {
-	static UFunction* pFnGetAvoidanceVector = NULL;
-
+	UFunction* pFnGetAvoidanceVector = (UFunction*) SdkBindings::Get ( 2370 );
 	if ( ! pFnGetAvoidanceVector )
-		pFnGetAvoidanceVector = (UFunction*) UObject::GObjObjects()->Data[ 4779 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetAvoidanceVector_Parms GetAvoidanceVector_Parms;
 	memcpy ( &GetAvoidanceVector_Parms.GoalLocation, &GoalLocation, 0xC );
@@ -1376,10 +1320,9 @@ struct FVector AWwiseMicPosOrient::GetAvoidanceVector ( struct FVector GoalLocat
 
 bool AWwiseMicPosOrient::IsClient ( )
 {
-	static UFunction* pFnIsClient = NULL;
-
+	UFunction* pFnIsClient = (UFunction*) SdkBindings::Get ( 2369 );
 	if ( ! pFnIsClient )
-		pFnIsClient = (UFunction*) UObject::GObjObjects()->Data[ 4777 ];
+		return {};
 
 	AWwiseMicPosOrient_execIsClient_Parms IsClient_Parms;
 
@@ -1395,10 +1338,9 @@ bool AWwiseMicPosOrient::IsClient ( )
 
 bool AWwiseMicPosOrient::IsServer ( )
 {
-	static UFunction* pFnIsServer = NULL;
-
+	UFunction* pFnIsServer = (UFunction*) SdkBindings::Get ( 2368 );
 	if ( ! pFnIsServer )
-		pFnIsServer = (UFunction*) UObject::GObjObjects()->Data[ 4775 ];
+		return {};
 
 	AWwiseMicPosOrient_execIsServer_Parms IsServer_Parms;
 
@@ -1414,10 +1356,9 @@ bool AWwiseMicPosOrient::IsServer ( )
 
 bool AWwiseMicPosOrient::IsOwningClient ( )
 {
-	static UFunction* pFnIsOwningClient = NULL;
-
+	UFunction* pFnIsOwningClient = (UFunction*) SdkBindings::Get ( 2367 );
 	if ( ! pFnIsOwningClient )
-		pFnIsOwningClient = (UFunction*) UObject::GObjObjects()->Data[ 4773 ];
+		return {};
 
 	AWwiseMicPosOrient_execIsOwningClient_Parms IsOwningClient_Parms;
 
@@ -1432,10 +1373,9 @@ bool AWwiseMicPosOrient::IsOwningClient ( )
 
 void AWwiseMicPosOrient::eventReplicationEnded ( )
 {
-	static UFunction* pFnReplicationEnded = NULL;
-
+	UFunction* pFnReplicationEnded = (UFunction*) SdkBindings::Get ( 2366 );
 	if ( ! pFnReplicationEnded )
-		pFnReplicationEnded = (UFunction*) UObject::GObjObjects()->Data[ 4772 ];
+		return;
 
 	AWwiseMicPosOrient_eventReplicationEnded_Parms ReplicationEnded_Parms;
 
@@ -1448,10 +1388,9 @@ void AWwiseMicPosOrient::eventReplicationEnded ( )
 
 void AWwiseMicPosOrient::eventPostDemoRewind ( )
 {
-	static UFunction* pFnPostDemoRewind = NULL;
-
+	UFunction* pFnPostDemoRewind = (UFunction*) SdkBindings::Get ( 2365 );
 	if ( ! pFnPostDemoRewind )
-		pFnPostDemoRewind = (UFunction*) UObject::GObjObjects()->Data[ 4771 ];
+		return;
 
 	AWwiseMicPosOrient_eventPostDemoRewind_Parms PostDemoRewind_Parms;
 
@@ -1465,10 +1404,9 @@ void AWwiseMicPosOrient::eventPostDemoRewind ( )
 
 void AWwiseMicPosOrient::eventAnimTreeUpdated ( class USkeletalMeshComponent* SkelMesh )
 {
-	static UFunction* pFnAnimTreeUpdated = NULL;
-
+	UFunction* pFnAnimTreeUpdated = (UFunction*) SdkBindings::Get ( 2364 );
 	if ( ! pFnAnimTreeUpdated )
-		pFnAnimTreeUpdated = (UFunction*) UObject::GObjObjects()->Data[ 4769 ];
+		return;
 
 	AWwiseMicPosOrient_eventAnimTreeUpdated_Parms AnimTreeUpdated_Parms;
 	AnimTreeUpdated_Parms.SkelMesh = SkelMesh;
@@ -1485,10 +1423,9 @@ void AWwiseMicPosOrient::eventAnimTreeUpdated ( class USkeletalMeshComponent* Sk
 
 bool AWwiseMicPosOrient::SupportsKismetModification ( class USequenceOp* AskingOp, struct FString* Reason )
 {
-	static UFunction* pFnSupportsKismetModification = NULL;
-
+	UFunction* pFnSupportsKismetModification = (UFunction*) SdkBindings::Get ( 2363 );
 	if ( ! pFnSupportsKismetModification )
-		pFnSupportsKismetModification = (UFunction*) UObject::GObjObjects()->Data[ 4765 ];
+		return {};
 
 	AWwiseMicPosOrient_execSupportsKismetModification_Parms SupportsKismetModification_Parms;
 	SupportsKismetModification_Parms.AskingOp = AskingOp;
@@ -1512,10 +1449,9 @@ bool AWwiseMicPosOrient::SupportsKismetModification ( class USequenceOp* AskingO
 
 void AWwiseMicPosOrient::eventTrailsNotifyEnd ( class UAnimNotify_Trails* AnimNotifyData )
 {
-	static UFunction* pFnTrailsNotifyEnd = NULL;
-
+	UFunction* pFnTrailsNotifyEnd = (UFunction*) SdkBindings::Get ( 2362 );
 	if ( ! pFnTrailsNotifyEnd )
-		pFnTrailsNotifyEnd = (UFunction*) UObject::GObjObjects()->Data[ 4763 ];
+		return;
 
 	AWwiseMicPosOrient_eventTrailsNotifyEnd_Parms TrailsNotifyEnd_Parms;
 	TrailsNotifyEnd_Parms.AnimNotifyData = AnimNotifyData;
@@ -1530,10 +1466,9 @@ void AWwiseMicPosOrient::eventTrailsNotifyEnd ( class UAnimNotify_Trails* AnimNo
 
 void AWwiseMicPosOrient::eventTrailsNotifyTick ( class UAnimNotify_Trails* AnimNotifyData )
 {
-	static UFunction* pFnTrailsNotifyTick = NULL;
-
+	UFunction* pFnTrailsNotifyTick = (UFunction*) SdkBindings::Get ( 2361 );
 	if ( ! pFnTrailsNotifyTick )
-		pFnTrailsNotifyTick = (UFunction*) UObject::GObjObjects()->Data[ 4761 ];
+		return;
 
 	AWwiseMicPosOrient_eventTrailsNotifyTick_Parms TrailsNotifyTick_Parms;
 	TrailsNotifyTick_Parms.AnimNotifyData = AnimNotifyData;
@@ -1548,10 +1483,9 @@ void AWwiseMicPosOrient::eventTrailsNotifyTick ( class UAnimNotify_Trails* AnimN
 
 void AWwiseMicPosOrient::eventTrailsNotify ( class UAnimNotify_Trails* AnimNotifyData )
 {
-	static UFunction* pFnTrailsNotify = NULL;
-
+	UFunction* pFnTrailsNotify = (UFunction*) SdkBindings::Get ( 2360 );
 	if ( ! pFnTrailsNotify )
-		pFnTrailsNotify = (UFunction*) UObject::GObjObjects()->Data[ 4759 ];
+		return;
 
 	AWwiseMicPosOrient_eventTrailsNotify_Parms TrailsNotify_Parms;
 	TrailsNotify_Parms.AnimNotifyData = AnimNotifyData;
@@ -1566,10 +1500,9 @@ void AWwiseMicPosOrient::eventTrailsNotify ( class UAnimNotify_Trails* AnimNotif
 
 void AWwiseMicPosOrient::eventPlayParticleEffect ( class UAnimNotify_PlayParticleEffect* AnimNotifyData )
 {
-	static UFunction* pFnPlayParticleEffect = NULL;
-
+	UFunction* pFnPlayParticleEffect = (UFunction*) SdkBindings::Get ( 2359 );
 	if ( ! pFnPlayParticleEffect )
-		pFnPlayParticleEffect = (UFunction*) UObject::GObjObjects()->Data[ 4757 ];
+		return;
 
 	AWwiseMicPosOrient_eventPlayParticleEffect_Parms PlayParticleEffect_Parms;
 	PlayParticleEffect_Parms.AnimNotifyData = AnimNotifyData;
@@ -1586,10 +1519,9 @@ void AWwiseMicPosOrient::eventPlayParticleEffect ( class UAnimNotify_PlayParticl
 
 void AWwiseMicPosOrient::GetAimAdhesionExtent ( float* Width, float* Height, struct FVector* Center )
 {
-	static UFunction* pFnGetAimAdhesionExtent = NULL;
-
+	UFunction* pFnGetAimAdhesionExtent = (UFunction*) SdkBindings::Get ( 2358 );
 	if ( ! pFnGetAimAdhesionExtent )
-		pFnGetAimAdhesionExtent = (UFunction*) UObject::GObjObjects()->Data[ 4752 ];
+		return;
 
 	AWwiseMicPosOrient_execGetAimAdhesionExtent_Parms GetAimAdhesionExtent_Parms;
 
@@ -1614,10 +1546,9 @@ void AWwiseMicPosOrient::GetAimAdhesionExtent ( float* Width, float* Height, str
 
 void AWwiseMicPosOrient::GetAimFrictionExtent ( float* Width, float* Height, struct FVector* Center )
 {
-	static UFunction* pFnGetAimFrictionExtent = NULL;
-
+	UFunction* pFnGetAimFrictionExtent = (UFunction*) SdkBindings::Get ( 2357 );
 	if ( ! pFnGetAimFrictionExtent )
-		pFnGetAimFrictionExtent = (UFunction*) UObject::GObjObjects()->Data[ 4747 ];
+		return;
 
 	AWwiseMicPosOrient_execGetAimFrictionExtent_Parms GetAimFrictionExtent_Parms;
 
@@ -1640,10 +1571,9 @@ void AWwiseMicPosOrient::GetAimFrictionExtent ( float* Width, float* Height, str
 
 bool AWwiseMicPosOrient::IsInPersistentLevel ( )
 {
-	static UFunction* pFnIsInPersistentLevel = NULL;
-
+	UFunction* pFnIsInPersistentLevel = (UFunction*) SdkBindings::Get ( 2356 );
 	if ( ! pFnIsInPersistentLevel )
-		pFnIsInPersistentLevel = (UFunction*) UObject::GObjObjects()->Data[ 4745 ];
+		return {};
 
 	AWwiseMicPosOrient_execIsInPersistentLevel_Parms IsInPersistentLevel_Parms;
 
@@ -1663,10 +1593,9 @@ bool AWwiseMicPosOrient::IsInPersistentLevel ( )
 
 void AWwiseMicPosOrient::SetActive ( unsigned long bActive )
 {
-	static UFunction* pFnSetActive = NULL;
-
+	UFunction* pFnSetActive = (UFunction*) SdkBindings::Get ( 2355 );
 	if ( ! pFnSetActive )
-		pFnSetActive = (UFunction*) UObject::GObjObjects()->Data[ 4743 ];
+		return;
 
 	AWwiseMicPosOrient_execSetActive_Parms SetActive_Parms;
 	SetActive_Parms.bActive = bActive;
@@ -1686,10 +1615,9 @@ void AWwiseMicPosOrient::SetActive ( unsigned long bActive )
 
 class USFXModule* AWwiseMicPosOrient::GetModule ( class UClass* ModuleClass )
 {
-	static UFunction* pFnGetModule = NULL;
-
+	UFunction* pFnGetModule = (UFunction*) SdkBindings::Get ( 2257 );
 	if ( ! pFnGetModule )
-		pFnGetModule = (UFunction*) UObject::GObjObjects()->Data[ 4272 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetModule_Parms GetModule_Parms;
 	GetModule_Parms.ModuleClass = ModuleClass;
@@ -1710,10 +1638,9 @@ class USFXModule* AWwiseMicPosOrient::GetModule ( class UClass* ModuleClass )
 
 void AWwiseMicPosOrient::eventExceededPhysicsThreshold ( class AActor* instigatedBy )
 {
-	static UFunction* pFnExceededPhysicsThreshold = NULL;
-
+	UFunction* pFnExceededPhysicsThreshold = (UFunction*) SdkBindings::Get ( 2354 );
 	if ( ! pFnExceededPhysicsThreshold )
-		pFnExceededPhysicsThreshold = (UFunction*) UObject::GObjObjects()->Data[ 4739 ];
+		return;
 
 	AWwiseMicPosOrient_eventExceededPhysicsThreshold_Parms ExceededPhysicsThreshold_Parms;
 	ExceededPhysicsThreshold_Parms.instigatedBy = instigatedBy;
@@ -1728,10 +1655,9 @@ void AWwiseMicPosOrient::eventExceededPhysicsThreshold ( class AActor* instigate
 
 void AWwiseMicPosOrient::eventOnRigidBodySpringOverextension ( class URB_BodyInstance* BodyInstance )
 {
-	static UFunction* pFnOnRigidBodySpringOverextension = NULL;
-
+	UFunction* pFnOnRigidBodySpringOverextension = (UFunction*) SdkBindings::Get ( 2353 );
 	if ( ! pFnOnRigidBodySpringOverextension )
-		pFnOnRigidBodySpringOverextension = (UFunction*) UObject::GObjObjects()->Data[ 4737 ];
+		return;
 
 	AWwiseMicPosOrient_eventOnRigidBodySpringOverextension_Parms OnRigidBodySpringOverextension_Parms;
 	OnRigidBodySpringOverextension_Parms.BodyInstance = BodyInstance;
@@ -1747,10 +1673,9 @@ void AWwiseMicPosOrient::eventOnRigidBodySpringOverextension ( class URB_BodyIns
 
 struct FGuid AWwiseMicPosOrient::GetPackageGuid ( struct FName PackageName )
 {
-	static UFunction* pFnGetPackageGuid = NULL;
-
+	UFunction* pFnGetPackageGuid = (UFunction*) SdkBindings::Get ( 2352 );
 	if ( ! pFnGetPackageGuid )
-		pFnGetPackageGuid = (UFunction*) UObject::GObjObjects()->Data[ 4734 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetPackageGuid_Parms GetPackageGuid_Parms;
 	memcpy ( &GetPackageGuid_Parms.PackageName, &PackageName, 0x8 );
@@ -1771,10 +1696,9 @@ struct FGuid AWwiseMicPosOrient::GetPackageGuid ( struct FName PackageName )
 
 void AWwiseMicPosOrient::eventPostInitAnimTree ( class USkeletalMeshComponent* SkelComp )
 {
-	static UFunction* pFnPostInitAnimTree = NULL;
-
+	UFunction* pFnPostInitAnimTree = (UFunction*) SdkBindings::Get ( 2351 );
 	if ( ! pFnPostInitAnimTree )
-		pFnPostInitAnimTree = (UFunction*) UObject::GObjObjects()->Data[ 4732 ];
+		return;
 
 	AWwiseMicPosOrient_eventPostInitAnimTree_Parms PostInitAnimTree_Parms;
 	PostInitAnimTree_Parms.SkelComp = SkelComp;
@@ -1790,10 +1714,9 @@ void AWwiseMicPosOrient::eventPostInitAnimTree ( class USkeletalMeshComponent* S
 
 void AWwiseMicPosOrient::eventRootMotionExtracted ( class USkeletalMeshComponent* SkelComp, struct FBoneAtom* ExtractedRootMotionDelta )
 {
-	static UFunction* pFnRootMotionExtracted = NULL;
-
+	UFunction* pFnRootMotionExtracted = (UFunction*) SdkBindings::Get ( 2350 );
 	if ( ! pFnRootMotionExtracted )
-		pFnRootMotionExtracted = (UFunction*) UObject::GObjObjects()->Data[ 4729 ];
+		return;
 
 	AWwiseMicPosOrient_eventRootMotionExtracted_Parms RootMotionExtracted_Parms;
 	RootMotionExtracted_Parms.SkelComp = SkelComp;
@@ -1811,10 +1734,9 @@ void AWwiseMicPosOrient::eventRootMotionExtracted ( class USkeletalMeshComponent
 
 void AWwiseMicPosOrient::eventRootMotionModeChanged ( class USkeletalMeshComponent* SkelComp )
 {
-	static UFunction* pFnRootMotionModeChanged = NULL;
-
+	UFunction* pFnRootMotionModeChanged = (UFunction*) SdkBindings::Get ( 2349 );
 	if ( ! pFnRootMotionModeChanged )
-		pFnRootMotionModeChanged = (UFunction*) UObject::GObjObjects()->Data[ 4727 ];
+		return;
 
 	AWwiseMicPosOrient_eventRootMotionModeChanged_Parms RootMotionModeChanged_Parms;
 	RootMotionModeChanged_Parms.SkelComp = SkelComp;
@@ -1832,10 +1754,9 @@ void AWwiseMicPosOrient::eventRootMotionModeChanged ( class USkeletalMeshCompone
 
 void AWwiseMicPosOrient::eventPostRenderFor ( class APlayerController* PC, class UCanvas* Canvas, struct FVector CameraPosition, struct FVector CameraDir )
 {
-	static UFunction* pFnPostRenderFor = NULL;
-
+	UFunction* pFnPostRenderFor = (UFunction*) SdkBindings::Get ( 2348 );
 	if ( ! pFnPostRenderFor )
-		pFnPostRenderFor = (UFunction*) UObject::GObjObjects()->Data[ 4722 ];
+		return;
 
 	AWwiseMicPosOrient_eventPostRenderFor_Parms PostRenderFor_Parms;
 	PostRenderFor_Parms.PC = PC;
@@ -1856,10 +1777,9 @@ void AWwiseMicPosOrient::eventPostRenderFor ( class APlayerController* PC, class
 
 void AWwiseMicPosOrient::NativePostRenderFor ( class APlayerController* PC, class UCanvas* Canvas, struct FVector CameraPosition, struct FVector CameraDir )
 {
-	static UFunction* pFnNativePostRenderFor = NULL;
-
+	UFunction* pFnNativePostRenderFor = (UFunction*) SdkBindings::Get ( 2347 );
 	if ( ! pFnNativePostRenderFor )
-		pFnNativePostRenderFor = (UFunction*) UObject::GObjObjects()->Data[ 4717 ];
+		return;
 
 	AWwiseMicPosOrient_execNativePostRenderFor_Parms NativePostRenderFor_Parms;
 	NativePostRenderFor_Parms.PC = PC;
@@ -1881,10 +1801,9 @@ void AWwiseMicPosOrient::NativePostRenderFor ( class APlayerController* PC, clas
 
 void AWwiseMicPosOrient::SetHUDLocation ( struct FVector NewHUDLocation )
 {
-	static UFunction* pFnSetHUDLocation = NULL;
-
+	UFunction* pFnSetHUDLocation = (UFunction*) SdkBindings::Get ( 2346 );
 	if ( ! pFnSetHUDLocation )
-		pFnSetHUDLocation = (UFunction*) UObject::GObjObjects()->Data[ 4715 ];
+		return;
 
 	AWwiseMicPosOrient_execSetHUDLocation_Parms SetHUDLocation_Parms;
 	memcpy ( &SetHUDLocation_Parms.NewHUDLocation, &NewHUDLocation, 0xC );
@@ -1905,10 +1824,9 @@ void AWwiseMicPosOrient::SetHUDLocation ( struct FVector NewHUDLocation )
 
 void AWwiseMicPosOrient::eventOnRanOver ( class ASVehicle* Vehicle, class UPrimitiveComponent* RunOverComponent, int WheelIndex )
 {
-	static UFunction* pFnOnRanOver = NULL;
-
+	UFunction* pFnOnRanOver = (UFunction*) SdkBindings::Get ( 2345 );
 	if ( ! pFnOnRanOver )
-		pFnOnRanOver = (UFunction*) UObject::GObjObjects()->Data[ 4711 ];
+		return;
 
 	AWwiseMicPosOrient_eventOnRanOver_Parms OnRanOver_Parms;
 	OnRanOver_Parms.Vehicle = Vehicle;
@@ -1928,10 +1846,9 @@ void AWwiseMicPosOrient::eventOnRanOver ( class ASVehicle* Vehicle, class UPrimi
 
 void AWwiseMicPosOrient::eventRigidBodyCollision ( class UPrimitiveComponent* HitComponent, class UPrimitiveComponent* OtherComponent, int ContactIndex, struct FCollisionImpactData* RigidCollisionData )
 {
-	static UFunction* pFnRigidBodyCollision = NULL;
-
+	UFunction* pFnRigidBodyCollision = (UFunction*) SdkBindings::Get ( 2344 );
 	if ( ! pFnRigidBodyCollision )
-		pFnRigidBodyCollision = (UFunction*) UObject::GObjObjects()->Data[ 4694 ];
+		return;
 
 	AWwiseMicPosOrient_eventRigidBodyCollision_Parms RigidBodyCollision_Parms;
 	RigidBodyCollision_Parms.HitComponent = HitComponent;
@@ -1951,10 +1868,9 @@ void AWwiseMicPosOrient::eventRigidBodyCollision ( class UPrimitiveComponent* Hi
 
 void AWwiseMicPosOrient::eventInterpolationChanged ( class USeqAct_Interp* InterpAction )
 {
-	static UFunction* pFnInterpolationChanged = NULL;
-
+	UFunction* pFnInterpolationChanged = (UFunction*) SdkBindings::Get ( 2343 );
 	if ( ! pFnInterpolationChanged )
-		pFnInterpolationChanged = (UFunction*) UObject::GObjObjects()->Data[ 4692 ];
+		return;
 
 	AWwiseMicPosOrient_eventInterpolationChanged_Parms InterpolationChanged_Parms;
 	InterpolationChanged_Parms.InterpAction = InterpAction;
@@ -1969,10 +1885,9 @@ void AWwiseMicPosOrient::eventInterpolationChanged ( class USeqAct_Interp* Inter
 
 void AWwiseMicPosOrient::eventInterpolationFinished ( class USeqAct_Interp* InterpAction )
 {
-	static UFunction* pFnInterpolationFinished = NULL;
-
+	UFunction* pFnInterpolationFinished = (UFunction*) SdkBindings::Get ( 2342 );
 	if ( ! pFnInterpolationFinished )
-		pFnInterpolationFinished = (UFunction*) UObject::GObjObjects()->Data[ 4690 ];
+		return;
 
 	AWwiseMicPosOrient_eventInterpolationFinished_Parms InterpolationFinished_Parms;
 	InterpolationFinished_Parms.InterpAction = InterpAction;
@@ -1988,10 +1903,9 @@ void AWwiseMicPosOrient::eventInterpolationFinished ( class USeqAct_Interp* Inte
 
 void AWwiseMicPosOrient::eventInterpolationStarted ( class USeqAct_Interp* InterpAction, class UInterpGroupInst* GroupInst )
 {
-	static UFunction* pFnInterpolationStarted = NULL;
-
+	UFunction* pFnInterpolationStarted = (UFunction*) SdkBindings::Get ( 2341 );
 	if ( ! pFnInterpolationStarted )
-		pFnInterpolationStarted = (UFunction*) UObject::GObjObjects()->Data[ 4687 ];
+		return;
 
 	AWwiseMicPosOrient_eventInterpolationStarted_Parms InterpolationStarted_Parms;
 	InterpolationStarted_Parms.InterpAction = InterpAction;
@@ -2007,10 +1921,9 @@ void AWwiseMicPosOrient::eventInterpolationStarted ( class USeqAct_Interp* Inter
 
 void AWwiseMicPosOrient::PickedUpBy ( class APawn* P )
 {
-	static UFunction* pFnPickedUpBy = NULL;
-
+	UFunction* pFnPickedUpBy = (UFunction*) SdkBindings::Get ( 2340 );
 	if ( ! pFnPickedUpBy )
-		pFnPickedUpBy = (UFunction*) UObject::GObjObjects()->Data[ 4685 ];
+		return;
 
 	AWwiseMicPosOrient_execPickedUpBy_Parms PickedUpBy_Parms;
 	PickedUpBy_Parms.P = P;
@@ -2024,10 +1937,9 @@ void AWwiseMicPosOrient::PickedUpBy ( class APawn* P )
 
 void AWwiseMicPosOrient::eventSpawnedByKismet ( )
 {
-	static UFunction* pFnSpawnedByKismet = NULL;
-
+	UFunction* pFnSpawnedByKismet = (UFunction*) SdkBindings::Get ( 2339 );
 	if ( ! pFnSpawnedByKismet )
-		pFnSpawnedByKismet = (UFunction*) UObject::GObjObjects()->Data[ 4684 ];
+		return;
 
 	AWwiseMicPosOrient_eventSpawnedByKismet_Parms SpawnedByKismet_Parms;
 
@@ -2043,10 +1955,9 @@ void AWwiseMicPosOrient::eventSpawnedByKismet ( )
 
 struct FVector AWwiseMicPosOrient::GetTargetLocation ( class AActor* RequestedBy, unsigned long bRequestAlternateLoc )
 {
-	static UFunction* pFnGetTargetLocation = NULL;
-
+	UFunction* pFnGetTargetLocation = (UFunction*) SdkBindings::Get ( 2338 );
 	if ( ! pFnGetTargetLocation )
-		pFnGetTargetLocation = (UFunction*) UObject::GObjObjects()->Data[ 4680 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetTargetLocation_Parms GetTargetLocation_Parms;
 	GetTargetLocation_Parms.RequestedBy = RequestedBy;
@@ -2069,10 +1980,9 @@ struct FVector AWwiseMicPosOrient::GetTargetLocation ( class AActor* RequestedBy
 
 void AWwiseMicPosOrient::FindGoodEndView ( class APlayerController* PC, struct FRotator* GoodRotation )
 {
-	static UFunction* pFnFindGoodEndView = NULL;
-
+	UFunction* pFnFindGoodEndView = (UFunction*) SdkBindings::Get ( 2337 );
 	if ( ! pFnFindGoodEndView )
-		pFnFindGoodEndView = (UFunction*) UObject::GObjObjects()->Data[ 4677 ];
+		return;
 
 	AWwiseMicPosOrient_execFindGoodEndView_Parms FindGoodEndView_Parms;
 	FindGoodEndView_Parms.PC = PC;
@@ -2089,10 +1999,9 @@ void AWwiseMicPosOrient::FindGoodEndView ( class APlayerController* PC, struct F
 
 void AWwiseMicPosOrient::NotifyLocalPlayerTeamReceived ( )
 {
-	static UFunction* pFnNotifyLocalPlayerTeamReceived = NULL;
-
+	UFunction* pFnNotifyLocalPlayerTeamReceived = (UFunction*) SdkBindings::Get ( 2336 );
 	if ( ! pFnNotifyLocalPlayerTeamReceived )
-		pFnNotifyLocalPlayerTeamReceived = (UFunction*) UObject::GObjObjects()->Data[ 4676 ];
+		return;
 
 	AWwiseMicPosOrient_execNotifyLocalPlayerTeamReceived_Parms NotifyLocalPlayerTeamReceived_Parms;
 
@@ -2107,10 +2016,9 @@ void AWwiseMicPosOrient::NotifyLocalPlayerTeamReceived ( )
 
 struct FString AWwiseMicPosOrient::GetLocationStringFor ( class APlayerReplicationInfo* PRI )
 {
-	static UFunction* pFnGetLocationStringFor = NULL;
-
+	UFunction* pFnGetLocationStringFor = (UFunction*) SdkBindings::Get ( 2335 );
 	if ( ! pFnGetLocationStringFor )
-		pFnGetLocationStringFor = (UFunction*) UObject::GObjObjects()->Data[ 4673 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetLocationStringFor_Parms GetLocationStringFor_Parms;
 	GetLocationStringFor_Parms.PRI = PRI;
@@ -2127,10 +2035,9 @@ struct FString AWwiseMicPosOrient::GetLocationStringFor ( class APlayerReplicati
 
 unsigned char AWwiseMicPosOrient::eventScriptGetTeamNum ( )
 {
-	static UFunction* pFnScriptGetTeamNum = NULL;
-
+	UFunction* pFnScriptGetTeamNum = (UFunction*) SdkBindings::Get ( 2334 );
 	if ( ! pFnScriptGetTeamNum )
-		pFnScriptGetTeamNum = (UFunction*) UObject::GObjObjects()->Data[ 4671 ];
+		return {};
 
 	AWwiseMicPosOrient_eventScriptGetTeamNum_Parms ScriptGetTeamNum_Parms;
 
@@ -2146,10 +2053,9 @@ unsigned char AWwiseMicPosOrient::eventScriptGetTeamNum ( )
 
 unsigned char AWwiseMicPosOrient::GetTeamNum ( )
 {
-	static UFunction* pFnGetTeamNum = NULL;
-
+	UFunction* pFnGetTeamNum = (UFunction*) SdkBindings::Get ( 2333 );
 	if ( ! pFnGetTeamNum )
-		pFnGetTeamNum = (UFunction*) UObject::GObjObjects()->Data[ 4669 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetTeamNum_Parms GetTeamNum_Parms;
 
@@ -2168,10 +2074,9 @@ unsigned char AWwiseMicPosOrient::GetTeamNum ( )
 
 void AWwiseMicPosOrient::PawnBaseDied ( )
 {
-	static UFunction* pFnPawnBaseDied = NULL;
-
+	UFunction* pFnPawnBaseDied = (UFunction*) SdkBindings::Get ( 2332 );
 	if ( ! pFnPawnBaseDied )
-		pFnPawnBaseDied = (UFunction*) UObject::GObjObjects()->Data[ 4668 ];
+		return;
 
 	AWwiseMicPosOrient_execPawnBaseDied_Parms PawnBaseDied_Parms;
 
@@ -2185,10 +2090,9 @@ void AWwiseMicPosOrient::PawnBaseDied ( )
 
 bool AWwiseMicPosOrient::IsPlayerOwned ( )
 {
-	static UFunction* pFnIsPlayerOwned = NULL;
-
+	UFunction* pFnIsPlayerOwned = (UFunction*) SdkBindings::Get ( 2331 );
 	if ( ! pFnIsPlayerOwned )
-		pFnIsPlayerOwned = (UFunction*) UObject::GObjObjects()->Data[ 4666 ];
+		return {};
 
 	AWwiseMicPosOrient_execIsPlayerOwned_Parms IsPlayerOwned_Parms;
 
@@ -2209,10 +2113,9 @@ bool AWwiseMicPosOrient::IsPlayerOwned ( )
 
 void AWwiseMicPosOrient::eventGetActorEyesViewPoint ( struct FVector* out_Location, struct FRotator* out_rotation )
 {
-	static UFunction* pFnGetActorEyesViewPoint = NULL;
-
+	UFunction* pFnGetActorEyesViewPoint = (UFunction*) SdkBindings::Get ( 2330 );
 	if ( ! pFnGetActorEyesViewPoint )
-		pFnGetActorEyesViewPoint = (UFunction*) UObject::GObjObjects()->Data[ 4663 ];
+		return;
 
 	AWwiseMicPosOrient_eventGetActorEyesViewPoint_Parms GetActorEyesViewPoint_Parms;
 
@@ -2232,10 +2135,9 @@ void AWwiseMicPosOrient::eventGetActorEyesViewPoint ( struct FVector* out_Locati
 
 bool AWwiseMicPosOrient::IsStationary ( )
 {
-	static UFunction* pFnIsStationary = NULL;
-
+	UFunction* pFnIsStationary = (UFunction*) SdkBindings::Get ( 2329 );
 	if ( ! pFnIsStationary )
-		pFnIsStationary = (UFunction*) UObject::GObjObjects()->Data[ 4661 ];
+		return {};
 
 	AWwiseMicPosOrient_execIsStationary_Parms IsStationary_Parms;
 
@@ -2251,10 +2153,9 @@ bool AWwiseMicPosOrient::IsStationary ( )
 
 class UFaceFXAsset* AWwiseMicPosOrient::eventGetActorFaceFXAsset ( )
 {
-	static UFunction* pFnGetActorFaceFXAsset = NULL;
-
+	UFunction* pFnGetActorFaceFXAsset = (UFunction*) SdkBindings::Get ( 2328 );
 	if ( ! pFnGetActorFaceFXAsset )
-		pFnGetActorFaceFXAsset = (UFunction*) UObject::GObjObjects()->Data[ 4659 ];
+		return {};
 
 	AWwiseMicPosOrient_eventGetActorFaceFXAsset_Parms GetActorFaceFXAsset_Parms;
 
@@ -2270,10 +2171,9 @@ class UFaceFXAsset* AWwiseMicPosOrient::eventGetActorFaceFXAsset ( )
 
 bool AWwiseMicPosOrient::CanActorPlayFaceFXAnim ( )
 {
-	static UFunction* pFnCanActorPlayFaceFXAnim = NULL;
-
+	UFunction* pFnCanActorPlayFaceFXAnim = (UFunction*) SdkBindings::Get ( 2327 );
 	if ( ! pFnCanActorPlayFaceFXAnim )
-		pFnCanActorPlayFaceFXAnim = (UFunction*) UObject::GObjObjects()->Data[ 4657 ];
+		return {};
 
 	AWwiseMicPosOrient_execCanActorPlayFaceFXAnim_Parms CanActorPlayFaceFXAnim_Parms;
 
@@ -2289,10 +2189,9 @@ bool AWwiseMicPosOrient::CanActorPlayFaceFXAnim ( )
 
 bool AWwiseMicPosOrient::IsActorPlayingFaceFXAnim ( )
 {
-	static UFunction* pFnIsActorPlayingFaceFXAnim = NULL;
-
+	UFunction* pFnIsActorPlayingFaceFXAnim = (UFunction*) SdkBindings::Get ( 2326 );
 	if ( ! pFnIsActorPlayingFaceFXAnim )
-		pFnIsActorPlayingFaceFXAnim = (UFunction*) UObject::GObjObjects()->Data[ 4655 ];
+		return {};
 
 	AWwiseMicPosOrient_execIsActorPlayingFaceFXAnim_Parms IsActorPlayingFaceFXAnim_Parms;
 
@@ -2309,10 +2208,9 @@ bool AWwiseMicPosOrient::IsActorPlayingFaceFXAnim ( )
 
 void AWwiseMicPosOrient::eventSetSkelControlScale ( struct FName SkelControlName, float Scale )
 {
-	static UFunction* pFnSetSkelControlScale = NULL;
-
+	UFunction* pFnSetSkelControlScale = (UFunction*) SdkBindings::Get ( 2325 );
 	if ( ! pFnSetSkelControlScale )
-		pFnSetSkelControlScale = (UFunction*) UObject::GObjObjects()->Data[ 4652 ];
+		return;
 
 	AWwiseMicPosOrient_eventSetSkelControlScale_Parms SetSkelControlScale_Parms;
 	memcpy ( &SetSkelControlScale_Parms.SkelControlName, &SkelControlName, 0x8 );
@@ -2329,10 +2227,9 @@ void AWwiseMicPosOrient::eventSetSkelControlScale ( struct FName SkelControlName
 
 void AWwiseMicPosOrient::eventSetMorphWeight ( struct FName MorphNodeName, float MorphWeight )
 {
-	static UFunction* pFnSetMorphWeight = NULL;
-
+	UFunction* pFnSetMorphWeight = (UFunction*) SdkBindings::Get ( 2324 );
 	if ( ! pFnSetMorphWeight )
-		pFnSetMorphWeight = (UFunction*) UObject::GObjObjects()->Data[ 4649 ];
+		return;
 
 	AWwiseMicPosOrient_eventSetMorphWeight_Parms SetMorphWeight_Parms;
 	memcpy ( &SetMorphWeight_Parms.MorphNodeName, &MorphNodeName, 0x8 );
@@ -2347,10 +2244,9 @@ void AWwiseMicPosOrient::eventSetMorphWeight ( struct FName MorphNodeName, float
 
 void AWwiseMicPosOrient::eventStopActorFaceFXAnim ( )
 {
-	static UFunction* pFnStopActorFaceFXAnim = NULL;
-
+	UFunction* pFnStopActorFaceFXAnim = (UFunction*) SdkBindings::Get ( 2323 );
 	if ( ! pFnStopActorFaceFXAnim )
-		pFnStopActorFaceFXAnim = (UFunction*) UObject::GObjObjects()->Data[ 4648 ];
+		return;
 
 	AWwiseMicPosOrient_eventStopActorFaceFXAnim_Parms StopActorFaceFXAnim_Parms;
 
@@ -2368,10 +2264,9 @@ void AWwiseMicPosOrient::eventStopActorFaceFXAnim ( )
 
 bool AWwiseMicPosOrient::eventPlayActorFaceFXAnim ( class UFaceFXAnimSet* AnimSet, struct FString GroupName, struct FString SeqName, class USoundCue* SoundCueToPlay )
 {
-	static UFunction* pFnPlayActorFaceFXAnim = NULL;
-
+	UFunction* pFnPlayActorFaceFXAnim = (UFunction*) SdkBindings::Get ( 2322 );
 	if ( ! pFnPlayActorFaceFXAnim )
-		pFnPlayActorFaceFXAnim = (UFunction*) UObject::GObjObjects()->Data[ 4642 ];
+		return {};
 
 	AWwiseMicPosOrient_eventPlayActorFaceFXAnim_Parms PlayActorFaceFXAnim_Parms;
 	PlayActorFaceFXAnim_Parms.AnimSet = AnimSet;
@@ -2391,10 +2286,9 @@ bool AWwiseMicPosOrient::eventPlayActorFaceFXAnim ( class UFaceFXAnimSet* AnimSe
 
 void AWwiseMicPosOrient::eventFinishMovementControl ( class UInterpGroup* InInterpGroup )
 {
-	static UFunction* pFnFinishMovementControl = NULL;
-
+	UFunction* pFnFinishMovementControl = (UFunction*) SdkBindings::Get ( 2321 );
 	if ( ! pFnFinishMovementControl )
-		pFnFinishMovementControl = (UFunction*) UObject::GObjObjects()->Data[ 4640 ];
+		return;
 
 	AWwiseMicPosOrient_eventFinishMovementControl_Parms FinishMovementControl_Parms;
 	FinishMovementControl_Parms.InInterpGroup = InInterpGroup;
@@ -2409,10 +2303,9 @@ void AWwiseMicPosOrient::eventFinishMovementControl ( class UInterpGroup* InInte
 
 void AWwiseMicPosOrient::eventBeginMovementControl ( class UInterpGroup* InInterpGroup )
 {
-	static UFunction* pFnBeginMovementControl = NULL;
-
+	UFunction* pFnBeginMovementControl = (UFunction*) SdkBindings::Get ( 2319 );
 	if ( ! pFnBeginMovementControl )
-		pFnBeginMovementControl = (UFunction*) UObject::GObjObjects()->Data[ 4637 ];
+		return;
 
 	AWwiseMicPosOrient_eventBeginMovementControl_Parms BeginMovementControl_Parms;
 	BeginMovementControl_Parms.InInterpGroup = InInterpGroup;
@@ -2427,10 +2320,9 @@ void AWwiseMicPosOrient::eventBeginMovementControl ( class UInterpGroup* InInter
 
 void AWwiseMicPosOrient::eventFinishAnimControl ( class UInterpGroup* InInterpGroup )
 {
-	static UFunction* pFnFinishAnimControl = NULL;
-
+	UFunction* pFnFinishAnimControl = (UFunction*) SdkBindings::Get ( 2318 );
 	if ( ! pFnFinishAnimControl )
-		pFnFinishAnimControl = (UFunction*) UObject::GObjObjects()->Data[ 4635 ];
+		return;
 
 	AWwiseMicPosOrient_eventFinishAnimControl_Parms FinishAnimControl_Parms;
 	FinishAnimControl_Parms.InInterpGroup = InInterpGroup;
@@ -2450,10 +2342,9 @@ void AWwiseMicPosOrient::eventFinishAnimControl ( class UInterpGroup* InInterpGr
 
 void AWwiseMicPosOrient::eventSetAnimPosition ( struct FName SlotName, int ChannelIndex, struct FName InAnimSeqName, float InPosition, unsigned long bFireNotifies, unsigned long bLooping )
 {
-	static UFunction* pFnSetAnimPosition = NULL;
-
+	UFunction* pFnSetAnimPosition = (UFunction*) SdkBindings::Get ( 2317 );
 	if ( ! pFnSetAnimPosition )
-		pFnSetAnimPosition = (UFunction*) UObject::GObjObjects()->Data[ 4628 ];
+		return;
 
 	AWwiseMicPosOrient_eventSetAnimPosition_Parms SetAnimPosition_Parms;
 	memcpy ( &SetAnimPosition_Parms.SlotName, &SlotName, 0x8 );
@@ -2473,10 +2364,9 @@ void AWwiseMicPosOrient::eventSetAnimPosition ( struct FName SlotName, int Chann
 
 void AWwiseMicPosOrient::eventBeginAnimControl ( class UInterpGroup* InInterpGroup )
 {
-	static UFunction* pFnBeginAnimControl = NULL;
-
+	UFunction* pFnBeginAnimControl = (UFunction*) SdkBindings::Get ( 2316 );
 	if ( ! pFnBeginAnimControl )
-		pFnBeginAnimControl = (UFunction*) UObject::GObjObjects()->Data[ 4626 ];
+		return;
 
 	AWwiseMicPosOrient_eventBeginAnimControl_Parms BeginAnimControl_Parms;
 	BeginAnimControl_Parms.InInterpGroup = InInterpGroup;
@@ -2491,10 +2381,9 @@ void AWwiseMicPosOrient::eventBeginAnimControl ( class UInterpGroup* InInterpGro
 
 void AWwiseMicPosOrient::eventOnAnimPlay ( class UAnimNodeSequence* SeqNode )
 {
-	static UFunction* pFnOnAnimPlay = NULL;
-
+	UFunction* pFnOnAnimPlay = (UFunction*) SdkBindings::Get ( 2315 );
 	if ( ! pFnOnAnimPlay )
-		pFnOnAnimPlay = (UFunction*) UObject::GObjObjects()->Data[ 4624 ];
+		return;
 
 	AWwiseMicPosOrient_eventOnAnimPlay_Parms OnAnimPlay_Parms;
 	OnAnimPlay_Parms.SeqNode = SeqNode;
@@ -2511,10 +2400,9 @@ void AWwiseMicPosOrient::eventOnAnimPlay ( class UAnimNodeSequence* SeqNode )
 
 void AWwiseMicPosOrient::eventOnAnimEnd ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime )
 {
-	static UFunction* pFnOnAnimEnd = NULL;
-
+	UFunction* pFnOnAnimEnd = (UFunction*) SdkBindings::Get ( 2314 );
 	if ( ! pFnOnAnimEnd )
-		pFnOnAnimEnd = (UFunction*) UObject::GObjObjects()->Data[ 4620 ];
+		return;
 
 	AWwiseMicPosOrient_eventOnAnimEnd_Parms OnAnimEnd_Parms;
 	OnAnimEnd_Parms.SeqNode = SeqNode;
@@ -2532,10 +2420,9 @@ void AWwiseMicPosOrient::eventOnAnimEnd ( class UAnimNodeSequence* SeqNode, floa
 
 void AWwiseMicPosOrient::DoKismetAttachment ( class AActor* Attachment, class USeqAct_AttachToActor* Action )
 {
-	static UFunction* pFnDoKismetAttachment = NULL;
-
+	UFunction* pFnDoKismetAttachment = (UFunction*) SdkBindings::Get ( 2313 );
 	if ( ! pFnDoKismetAttachment )
-		pFnDoKismetAttachment = (UFunction*) UObject::GObjObjects()->Data[ 4612 ];
+		return;
 
 	AWwiseMicPosOrient_execDoKismetAttachment_Parms DoKismetAttachment_Parms;
 	DoKismetAttachment_Parms.Attachment = Attachment;
@@ -2551,10 +2438,9 @@ void AWwiseMicPosOrient::DoKismetAttachment ( class AActor* Attachment, class US
 
 void AWwiseMicPosOrient::OnAttachToActor ( class USeqAct_AttachToActor* Action )
 {
-	static UFunction* pFnOnAttachToActor = NULL;
-
+	UFunction* pFnOnAttachToActor = (UFunction*) SdkBindings::Get ( 2312 );
 	if ( ! pFnOnAttachToActor )
-		pFnOnAttachToActor = (UFunction*) UObject::GObjObjects()->Data[ 4604 ];
+		return;
 
 	AWwiseMicPosOrient_execOnAttachToActor_Parms OnAttachToActor_Parms;
 	OnAttachToActor_Parms.Action = Action;
@@ -2576,10 +2462,9 @@ void AWwiseMicPosOrient::OnAttachToActor ( class USeqAct_AttachToActor* Action )
 
 void AWwiseMicPosOrient::BioEnqueueDoKismetAttachment ( class AActor* InAttachment, unsigned long bInDetach, unsigned long bInHardAttach, struct FName InBoneName, unsigned long bInUseRelativeOffset, struct FVector InRelativeOffset, unsigned long bInUseRelativeRotation, struct FRotator InRelativeRotation )
 {
-	static UFunction* pFnBioEnqueueDoKismetAttachment = NULL;
-
+	UFunction* pFnBioEnqueueDoKismetAttachment = (UFunction*) SdkBindings::Get ( 2311 );
 	if ( ! pFnBioEnqueueDoKismetAttachment )
-		pFnBioEnqueueDoKismetAttachment = (UFunction*) UObject::GObjObjects()->Data[ 4595 ];
+		return;
 
 	AWwiseMicPosOrient_execBioEnqueueDoKismetAttachment_Parms BioEnqueueDoKismetAttachment_Parms;
 	BioEnqueueDoKismetAttachment_Parms.InAttachment = InAttachment;
@@ -2612,10 +2497,9 @@ void AWwiseMicPosOrient::BioEnqueueDoKismetAttachment ( class AActor* InAttachme
 
 void AWwiseMicPosOrient::eventBioDoKismetAttachment ( class AActor* InAttachment, unsigned long bInDetach, unsigned long bInHardAttach, struct FName InBoneName, unsigned long bInUseRelativeOffset, struct FVector InRelativeOffset, unsigned long bInUseRelativeRotation, struct FRotator InRelativeRotation )
 {
-	static UFunction* pFnBioDoKismetAttachment = NULL;
-
+	UFunction* pFnBioDoKismetAttachment = (UFunction*) SdkBindings::Get ( 2309 );
 	if ( ! pFnBioDoKismetAttachment )
-		pFnBioDoKismetAttachment = (UFunction*) UObject::GObjObjects()->Data[ 4577 ];
+		return;
 
 	AWwiseMicPosOrient_eventBioDoKismetAttachment_Parms BioDoKismetAttachment_Parms;
 	BioDoKismetAttachment_Parms.InAttachment = InAttachment;
@@ -2637,10 +2521,9 @@ void AWwiseMicPosOrient::eventBioDoKismetAttachment ( class AActor* InAttachment
 
 void AWwiseMicPosOrient::OnToggleHidden ( class USeqAct_ToggleHidden* Action )
 {
-	static UFunction* pFnOnToggleHidden = NULL;
-
+	UFunction* pFnOnToggleHidden = (UFunction*) SdkBindings::Get ( 2307 );
 	if ( ! pFnOnToggleHidden )
-		pFnOnToggleHidden = (UFunction*) UObject::GObjObjects()->Data[ 4569 ];
+		return;
 
 	AWwiseMicPosOrient_execOnToggleHidden_Parms OnToggleHidden_Parms;
 	OnToggleHidden_Parms.Action = Action;
@@ -2655,10 +2538,9 @@ void AWwiseMicPosOrient::OnToggleHidden ( class USeqAct_ToggleHidden* Action )
 
 void AWwiseMicPosOrient::OnChangeCollision ( class USeqAct_ChangeCollision* Action )
 {
-	static UFunction* pFnOnChangeCollision = NULL;
-
+	UFunction* pFnOnChangeCollision = (UFunction*) SdkBindings::Get ( 2306 );
 	if ( ! pFnOnChangeCollision )
-		pFnOnChangeCollision = (UFunction*) UObject::GObjObjects()->Data[ 4559 ];
+		return;
 
 	AWwiseMicPosOrient_execOnChangeCollision_Parms OnChangeCollision_Parms;
 	OnChangeCollision_Parms.Action = Action;
@@ -2673,10 +2555,9 @@ void AWwiseMicPosOrient::OnChangeCollision ( class USeqAct_ChangeCollision* Acti
 
 void AWwiseMicPosOrient::OnSetPhysics ( class USeqAct_SetPhysics* Action )
 {
-	static UFunction* pFnOnSetPhysics = NULL;
-
+	UFunction* pFnOnSetPhysics = (UFunction*) SdkBindings::Get ( 2305 );
 	if ( ! pFnOnSetPhysics )
-		pFnOnSetPhysics = (UFunction*) UObject::GObjObjects()->Data[ 4555 ];
+		return;
 
 	AWwiseMicPosOrient_execOnSetPhysics_Parms OnSetPhysics_Parms;
 	OnSetPhysics_Parms.Action = Action;
@@ -2691,10 +2572,9 @@ void AWwiseMicPosOrient::OnSetPhysics ( class USeqAct_SetPhysics* Action )
 
 void AWwiseMicPosOrient::OnSetBlockRigidBody ( class USeqAct_SetBlockRigidBody* Action )
 {
-	static UFunction* pFnOnSetBlockRigidBody = NULL;
-
+	UFunction* pFnOnSetBlockRigidBody = (UFunction*) SdkBindings::Get ( 2304 );
 	if ( ! pFnOnSetBlockRigidBody )
-		pFnOnSetBlockRigidBody = (UFunction*) UObject::GObjObjects()->Data[ 4550 ];
+		return;
 
 	AWwiseMicPosOrient_execOnSetBlockRigidBody_Parms OnSetBlockRigidBody_Parms;
 	OnSetBlockRigidBody_Parms.Action = Action;
@@ -2709,10 +2589,9 @@ void AWwiseMicPosOrient::OnSetBlockRigidBody ( class USeqAct_SetBlockRigidBody*
 
 void AWwiseMicPosOrient::OnSetVelocity ( class USeqAct_SetVelocity* Action )
 {
-	static UFunction* pFnOnSetVelocity = NULL;
-
+	UFunction* pFnOnSetVelocity = (UFunction*) SdkBindings::Get ( 2302 );
 	if ( ! pFnOnSetVelocity )
-		pFnOnSetVelocity = (UFunction*) UObject::GObjObjects()->Data[ 4541 ];
+		return;
 
 	AWwiseMicPosOrient_execOnSetVelocity_Parms OnSetVelocity_Parms;
 	OnSetVelocity_Parms.Action = Action;
@@ -2727,10 +2606,9 @@ void AWwiseMicPosOrient::OnSetVelocity ( class USeqAct_SetVelocity* Action )
 
 void AWwiseMicPosOrient::OnTeleport ( class USeqAct_Teleport* Action )
 {
-	static UFunction* pFnOnTeleport = NULL;
-
+	UFunction* pFnOnTeleport = (UFunction*) SdkBindings::Get ( 2301 );
 	if ( ! pFnOnTeleport )
-		pFnOnTeleport = (UFunction*) UObject::GObjObjects()->Data[ 4530 ];
+		return;
 
 	AWwiseMicPosOrient_execOnTeleport_Parms OnTeleport_Parms;
 	OnTeleport_Parms.Action = Action;
@@ -2745,10 +2623,9 @@ void AWwiseMicPosOrient::OnTeleport ( class USeqAct_Teleport* Action )
 
 void AWwiseMicPosOrient::OnModifyHealth ( class USeqAct_ModifyHealth* Action )
 {
-	static UFunction* pFnOnModifyHealth = NULL;
-
+	UFunction* pFnOnModifyHealth = (UFunction*) SdkBindings::Get ( 2300 );
 	if ( ! pFnOnModifyHealth )
-		pFnOnModifyHealth = (UFunction*) UObject::GObjObjects()->Data[ 4521 ];
+		return;
 
 	AWwiseMicPosOrient_execOnModifyHealth_Parms OnModifyHealth_Parms;
 	OnModifyHealth_Parms.Action = Action;
@@ -2762,10 +2639,9 @@ void AWwiseMicPosOrient::OnModifyHealth ( class USeqAct_ModifyHealth* Action )
 
 void AWwiseMicPosOrient::BlockForTextureStreaming ( )
 {
-	static UFunction* pFnBlockForTextureStreaming = NULL;
-
+	UFunction* pFnBlockForTextureStreaming = (UFunction*) SdkBindings::Get ( 2299 );
 	if ( ! pFnBlockForTextureStreaming )
-		pFnBlockForTextureStreaming = (UFunction*) UObject::GObjObjects()->Data[ 4520 ];
+		return;
 
 	AWwiseMicPosOrient_execBlockForTextureStreaming_Parms BlockForTextureStreaming_Parms;
 
@@ -2783,10 +2659,9 @@ void AWwiseMicPosOrient::BlockForTextureStreaming ( )
 
 bool AWwiseMicPosOrient::TexturePrestreamIsRequired ( )
 {
-	static UFunction* pFnTexturePrestreamIsRequired = NULL;
-
+	UFunction* pFnTexturePrestreamIsRequired = (UFunction*) SdkBindings::Get ( 2298 );
 	if ( ! pFnTexturePrestreamIsRequired )
-		pFnTexturePrestreamIsRequired = (UFunction*) UObject::GObjObjects()->Data[ 4518 ];
+		return {};
 
 	AWwiseMicPosOrient_execTexturePrestreamIsRequired_Parms TexturePrestreamIsRequired_Parms;
 
@@ -2808,10 +2683,9 @@ bool AWwiseMicPosOrient::TexturePrestreamIsRequired ( )
 
 void AWwiseMicPosOrient::PrestreamTextures ( float Seconds, unsigned long bEnableStreaming, int CinematicTextureGroups )
 {
-	static UFunction* pFnPrestreamTextures = NULL;
-
+	UFunction* pFnPrestreamTextures = (UFunction*) SdkBindings::Get ( 2297 );
 	if ( ! pFnPrestreamTextures )
-		pFnPrestreamTextures = (UFunction*) UObject::GObjObjects()->Data[ 4514 ];
+		return;
 
 	AWwiseMicPosOrient_execPrestreamTextures_Parms PrestreamTextures_Parms;
 	PrestreamTextures_Parms.Seconds = Seconds;
@@ -2831,10 +2705,9 @@ void AWwiseMicPosOrient::PrestreamTextures ( float Seconds, unsigned long bEnabl
 
 void AWwiseMicPosOrient::eventShutDown ( )
 {
-	static UFunction* pFnShutDown = NULL;
-
+	UFunction* pFnShutDown = (UFunction*) SdkBindings::Get ( 2296 );
 	if ( ! pFnShutDown )
-		pFnShutDown = (UFunction*) UObject::GObjObjects()->Data[ 4510 ];
+		return;
 
 	AWwiseMicPosOrient_eventShutDown_Parms ShutDown_Parms;
 
@@ -2848,10 +2721,9 @@ void AWwiseMicPosOrient::eventShutDown ( )
 
 void AWwiseMicPosOrient::SetNetUpdateTime ( float NewUpdateTime )
 {
-	static UFunction* pFnSetNetUpdateTime = NULL;
-
+	UFunction* pFnSetNetUpdateTime = (UFunction*) SdkBindings::Get ( 2295 );
 	if ( ! pFnSetNetUpdateTime )
-		pFnSetNetUpdateTime = (UFunction*) UObject::GObjObjects()->Data[ 4508 ];
+		return;
 
 	AWwiseMicPosOrient_execSetNetUpdateTime_Parms SetNetUpdateTime_Parms;
 	SetNetUpdateTime_Parms.NewUpdateTime = NewUpdateTime;
@@ -2869,10 +2741,9 @@ void AWwiseMicPosOrient::SetNetUpdateTime ( float NewUpdateTime )
 
 void AWwiseMicPosOrient::eventForceNetRelevant ( )
 {
-	static UFunction* pFnForceNetRelevant = NULL;
-
+	UFunction* pFnForceNetRelevant = (UFunction*) SdkBindings::Get ( 2294 );
 	if ( ! pFnForceNetRelevant )
-		pFnForceNetRelevant = (UFunction*) UObject::GObjObjects()->Data[ 4504 ];
+		return;
 
 	AWwiseMicPosOrient_eventForceNetRelevant_Parms ForceNetRelevant_Parms;
 
@@ -2886,10 +2757,9 @@ void AWwiseMicPosOrient::eventForceNetRelevant ( )
 
 void AWwiseMicPosOrient::OnDestroy ( class USeqAct_Destroy* Action )
 {
-	static UFunction* pFnOnDestroy = NULL;
-
+	UFunction* pFnOnDestroy = (UFunction*) SdkBindings::Get ( 2292 );
 	if ( ! pFnOnDestroy )
-		pFnOnDestroy = (UFunction*) UObject::GObjObjects()->Data[ 4496 ];
+		return;
 
 	AWwiseMicPosOrient_execOnDestroy_Parms OnDestroy_Parms;
 	OnDestroy_Parms.Action = Action;
@@ -2907,10 +2777,9 @@ void AWwiseMicPosOrient::OnDestroy ( class USeqAct_Destroy* Action )
 
 void AWwiseMicPosOrient::ClearLatentAction ( class UClass* actionClass, unsigned long bAborted, class USeqAct_Latent* exceptionAction, unsigned long bCancelled )
 {
-	static UFunction* pFnClearLatentAction = NULL;
-
+	UFunction* pFnClearLatentAction = (UFunction*) SdkBindings::Get ( 2291 );
 	if ( ! pFnClearLatentAction )
-		pFnClearLatentAction = (UFunction*) UObject::GObjObjects()->Data[ 4489 ];
+		return;
 
 	AWwiseMicPosOrient_execClearLatentAction_Parms ClearLatentAction_Parms;
 	ClearLatentAction_Parms.actionClass = actionClass;
@@ -2931,10 +2800,9 @@ void AWwiseMicPosOrient::ClearLatentAction ( class UClass* actionClass, unsigned
 
 bool AWwiseMicPosOrient::FindEventsOfClass ( class UClass* EventClass, unsigned long bIncludeDisabled, TArray< class USequenceEvent* >* out_EventList )
 {
-	static UFunction* pFnFindEventsOfClass = NULL;
-
+	UFunction* pFnFindEventsOfClass = (UFunction*) SdkBindings::Get ( 2290 );
 	if ( ! pFnFindEventsOfClass )
-		pFnFindEventsOfClass = (UFunction*) UObject::GObjObjects()->Data[ 4478 ];
+		return {};
 
 	AWwiseMicPosOrient_execFindEventsOfClass_Parms FindEventsOfClass_Parms;
 	FindEventsOfClass_Parms.EventClass = EventClass;
@@ -2961,10 +2829,9 @@ bool AWwiseMicPosOrient::FindEventsOfClass ( class UClass* EventClass, unsigned
 
 bool AWwiseMicPosOrient::ActivateEventClass ( class UClass* InClass, class AActor* inInstigator, unsigned long bTest, TArray< class USequenceEvent* >* EventList, TArray< int >* ActivateIndices, TArray< class USequenceEvent* >* ActivatedEvents )
 {
-	static UFunction* pFnActivateEventClass = NULL;
-
+	UFunction* pFnActivateEventClass = (UFunction*) SdkBindings::Get ( 2286 );
 	if ( ! pFnActivateEventClass )
-		pFnActivateEventClass = (UFunction*) UObject::GObjObjects()->Data[ 4447 ];
+		return {};
 
 	AWwiseMicPosOrient_execActivateEventClass_Parms ActivateEventClass_Parms;
 	ActivateEventClass_Parms.InClass = InClass;
@@ -2995,10 +2862,9 @@ bool AWwiseMicPosOrient::ActivateEventClass ( class UClass* InClass, class AActo
 
 bool AWwiseMicPosOrient::TriggerGlobalEventClass ( class UClass* InEventClass, class AActor* inInstigator, int ActivateIndex )
 {
-	static UFunction* pFnTriggerGlobalEventClass = NULL;
-
+	UFunction* pFnTriggerGlobalEventClass = (UFunction*) SdkBindings::Get ( 2288 );
 	if ( ! pFnTriggerGlobalEventClass )
-		pFnTriggerGlobalEventClass = (UFunction*) UObject::GObjObjects()->Data[ 4450 ];
+		return {};
 
 	AWwiseMicPosOrient_execTriggerGlobalEventClass_Parms TriggerGlobalEventClass_Parms;
 	TriggerGlobalEventClass_Parms.InEventClass = InEventClass;
@@ -3017,10 +2883,9 @@ bool AWwiseMicPosOrient::TriggerGlobalEventClass ( class UClass* InEventClass, c
 
 void AWwiseMicPosOrient::eventReceivedNewEvent ( class USequenceEvent* Evt )
 {
-	static UFunction* pFnReceivedNewEvent = NULL;
-
+	UFunction* pFnReceivedNewEvent = (UFunction*) SdkBindings::Get ( 2287 );
 	if ( ! pFnReceivedNewEvent )
-		pFnReceivedNewEvent = (UFunction*) UObject::GObjObjects()->Data[ 4448 ];
+		return;
 
 	AWwiseMicPosOrient_eventReceivedNewEvent_Parms ReceivedNewEvent_Parms;
 	ReceivedNewEvent_Parms.Evt = Evt;
@@ -3040,10 +2905,9 @@ void AWwiseMicPosOrient::eventReceivedNewEvent ( class USequenceEvent* Evt )
 
 bool AWwiseMicPosOrient::TriggerEventClass ( class UClass* InEventClass, class AActor* inInstigator, int ActivateIndex, unsigned long bTest, TArray< class USequenceEvent* >* ActivatedEvents )
 {
-	static UFunction* pFnTriggerEventClass = NULL;
-
+	UFunction* pFnTriggerEventClass = (UFunction*) SdkBindings::Get ( 2285 );
 	if ( ! pFnTriggerEventClass )
-		pFnTriggerEventClass = (UFunction*) UObject::GObjObjects()->Data[ 4437 ];
+		return {};
 
 	AWwiseMicPosOrient_execTriggerEventClass_Parms TriggerEventClass_Parms;
 	TriggerEventClass_Parms.InEventClass = InEventClass;
@@ -3069,10 +2933,9 @@ bool AWwiseMicPosOrient::TriggerEventClass ( class UClass* InEventClass, class A
 
 bool AWwiseMicPosOrient::EffectIsRelevant ( struct FVector SpawnLocation, unsigned long bForceDedicated, float CullDistance )
 {
-	static UFunction* pFnEffectIsRelevant = NULL;
-
+	UFunction* pFnEffectIsRelevant = (UFunction*) SdkBindings::Get ( 2284 );
 	if ( ! pFnEffectIsRelevant )
-		pFnEffectIsRelevant = (UFunction*) UObject::GObjObjects()->Data[ 4422 ];
+		return {};
 
 	AWwiseMicPosOrient_execEffectIsRelevant_Parms EffectIsRelevant_Parms;
 	memcpy ( &EffectIsRelevant_Parms.SpawnLocation, &SpawnLocation, 0xC );
@@ -3094,10 +2957,9 @@ bool AWwiseMicPosOrient::EffectIsRelevant ( struct FVector SpawnLocation, unsign
 
 bool AWwiseMicPosOrient::CheckMaxEffectDistance ( class APlayerController* P, struct FVector SpawnLocation, float CullDistance )
 {
-	static UFunction* pFnCheckMaxEffectDistance = NULL;
-
+	UFunction* pFnCheckMaxEffectDistance = (UFunction*) SdkBindings::Get ( 2283 );
 	if ( ! pFnCheckMaxEffectDistance )
-		pFnCheckMaxEffectDistance = (UFunction*) UObject::GObjObjects()->Data[ 4412 ];
+		return {};
 
 	AWwiseMicPosOrient_execCheckMaxEffectDistance_Parms CheckMaxEffectDistance_Parms;
 	CheckMaxEffectDistance_Parms.P = P;
@@ -3117,10 +2979,9 @@ bool AWwiseMicPosOrient::CheckMaxEffectDistance ( class APlayerController* P, st
 
 void AWwiseMicPosOrient::ApplyFluidSurfaceImpact ( class AFluidSurfaceActor* Fluid, struct FVector HitLocation )
 {
-	static UFunction* pFnApplyFluidSurfaceImpact = NULL;
-
+	UFunction* pFnApplyFluidSurfaceImpact = (UFunction*) SdkBindings::Get ( 2282 );
 	if ( ! pFnApplyFluidSurfaceImpact )
-		pFnApplyFluidSurfaceImpact = (UFunction*) UObject::GObjObjects()->Data[ 4402 ];
+		return;
 
 	AWwiseMicPosOrient_execApplyFluidSurfaceImpact_Parms ApplyFluidSurfaceImpact_Parms;
 	ApplyFluidSurfaceImpact_Parms.Fluid = Fluid;
@@ -3136,10 +2997,9 @@ void AWwiseMicPosOrient::ApplyFluidSurfaceImpact ( class AFluidSurfaceActor* Flu
 
 bool AWwiseMicPosOrient::CanSplash ( )
 {
-	static UFunction* pFnCanSplash = NULL;
-
+	UFunction* pFnCanSplash = (UFunction*) SdkBindings::Get ( 2281 );
 	if ( ! pFnCanSplash )
-		pFnCanSplash = (UFunction*) UObject::GObjObjects()->Data[ 4400 ];
+		return {};
 
 	AWwiseMicPosOrient_execCanSplash_Parms CanSplash_Parms;
 
@@ -3156,10 +3016,9 @@ bool AWwiseMicPosOrient::CanSplash ( )
 
 void AWwiseMicPosOrient::PlayTeleportEffect ( unsigned long bOut, unsigned long bSound )
 {
-	static UFunction* pFnPlayTeleportEffect = NULL;
-
+	UFunction* pFnPlayTeleportEffect = (UFunction*) SdkBindings::Get ( 2280 );
 	if ( ! pFnPlayTeleportEffect )
-		pFnPlayTeleportEffect = (UFunction*) UObject::GObjObjects()->Data[ 4397 ];
+		return;
 
 	AWwiseMicPosOrient_execPlayTeleportEffect_Parms PlayTeleportEffect_Parms;
 	PlayTeleportEffect_Parms.bOut = bOut;
@@ -3175,10 +3034,9 @@ void AWwiseMicPosOrient::PlayTeleportEffect ( unsigned long bOut, unsigned long
 
 bool AWwiseMicPosOrient::IsInPain ( )
 {
-	static UFunction* pFnIsInPain = NULL;
-
+	UFunction* pFnIsInPain = (UFunction*) SdkBindings::Get ( 2279 );
 	if ( ! pFnIsInPain )
-		pFnIsInPain = (UFunction*) UObject::GObjObjects()->Data[ 4392 ];
+		return {};
 
 	AWwiseMicPosOrient_execIsInPain_Parms IsInPain_Parms;
 
@@ -3195,10 +3053,9 @@ bool AWwiseMicPosOrient::IsInPain ( )
 
 bool AWwiseMicPosOrient::IsInVolume ( class AVolume* aVolume )
 {
-	static UFunction* pFnIsInVolume = NULL;
-
+	UFunction* pFnIsInVolume = (UFunction*) SdkBindings::Get ( 2278 );
 	if ( ! pFnIsInVolume )
-		pFnIsInVolume = (UFunction*) UObject::GObjObjects()->Data[ 4388 ];
+		return {};
 
 	AWwiseMicPosOrient_execIsInVolume_Parms IsInVolume_Parms;
 	IsInVolume_Parms.aVolume = aVolume;
@@ -3214,10 +3071,9 @@ bool AWwiseMicPosOrient::IsInVolume ( class AVolume* aVolume )
 
 void AWwiseMicPosOrient::eventReset ( )
 {
-	static UFunction* pFnReset = NULL;
-
+	UFunction* pFnReset = (UFunction*) SdkBindings::Get ( 2277 );
 	if ( ! pFnReset )
-		pFnReset = (UFunction*) UObject::GObjObjects()->Data[ 4387 ];
+		return;
 
 	AWwiseMicPosOrient_eventReset_Parms Reset_Parms;
 
@@ -3231,10 +3087,9 @@ void AWwiseMicPosOrient::eventReset ( )
 
 class UAudioComponent* AWwiseMicPosOrient::eventGetFaceFXAudioComponent ( )
 {
-	static UFunction* pFnGetFaceFXAudioComponent = NULL;
-
+	UFunction* pFnGetFaceFXAudioComponent = (UFunction*) SdkBindings::Get ( 2276 );
 	if ( ! pFnGetFaceFXAudioComponent )
-		pFnGetFaceFXAudioComponent = (UFunction*) UObject::GObjObjects()->Data[ 4385 ];
+		return {};
 
 	AWwiseMicPosOrient_eventGetFaceFXAudioComponent_Parms GetFaceFXAudioComponent_Parms;
 
@@ -3250,10 +3105,9 @@ class UAudioComponent* AWwiseMicPosOrient::eventGetFaceFXAudioComponent ( )
 
 void AWwiseMicPosOrient::eventModifyHearSoundComponent ( class UAudioComponent* AC )
 {
-	static UFunction* pFnModifyHearSoundComponent = NULL;
-
+	UFunction* pFnModifyHearSoundComponent = (UFunction*) SdkBindings::Get ( 2275 );
 	if ( ! pFnModifyHearSoundComponent )
-		pFnModifyHearSoundComponent = (UFunction*) UObject::GObjObjects()->Data[ 4383 ];
+		return;
 
 	AWwiseMicPosOrient_eventModifyHearSoundComponent_Parms ModifyHearSoundComponent_Parms;
 	ModifyHearSoundComponent_Parms.AC = AC;
@@ -3268,10 +3122,9 @@ void AWwiseMicPosOrient::eventModifyHearSoundComponent ( class UAudioComponent*
 
 struct FString AWwiseMicPosOrient::GetPhysicsName ( )
 {
-	static UFunction* pFnGetPhysicsName = NULL;
-
+	UFunction* pFnGetPhysicsName = (UFunction*) SdkBindings::Get ( 2274 );
 	if ( ! pFnGetPhysicsName )
-		pFnGetPhysicsName = (UFunction*) UObject::GObjObjects()->Data[ 4380 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetPhysicsName_Parms GetPhysicsName_Parms;
 
@@ -3289,10 +3142,9 @@ struct FString AWwiseMicPosOrient::GetPhysicsName ( )
 
 void AWwiseMicPosOrient::DisplayDebug ( class AHUD* HUD, float* out_YL, float* out_YPos )
 {
-	static UFunction* pFnDisplayDebug = NULL;
-
+	UFunction* pFnDisplayDebug = (UFunction*) SdkBindings::Get ( 2273 );
 	if ( ! pFnDisplayDebug )
-		pFnDisplayDebug = (UFunction*) UObject::GObjObjects()->Data[ 4347 ];
+		return;
 
 	AWwiseMicPosOrient_execDisplayDebug_Parms DisplayDebug_Parms;
 	DisplayDebug_Parms.HUD = HUD;
@@ -3313,10 +3165,9 @@ void AWwiseMicPosOrient::DisplayDebug ( class AHUD* HUD, float* out_YL, float* o
 
 struct FString AWwiseMicPosOrient::GetDebugName ( )
 {
-	static UFunction* pFnGetDebugName = NULL;
-
+	UFunction* pFnGetDebugName = (UFunction*) SdkBindings::Get ( 2272 );
 	if ( ! pFnGetDebugName )
-		pFnGetDebugName = (UFunction*) UObject::GObjObjects()->Data[ 4345 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetDebugName_Parms GetDebugName_Parms;
 
@@ -3331,10 +3182,9 @@ struct FString AWwiseMicPosOrient::GetDebugName ( )
 
 void AWwiseMicPosOrient::MatchStarting ( )
 {
-	static UFunction* pFnMatchStarting = NULL;
-
+	UFunction* pFnMatchStarting = (UFunction*) SdkBindings::Get ( 2271 );
 	if ( ! pFnMatchStarting )
-		pFnMatchStarting = (UFunction*) UObject::GObjObjects()->Data[ 4344 ];
+		return;
 
 	AWwiseMicPosOrient_execMatchStarting_Parms MatchStarting_Parms;
 
@@ -3351,10 +3201,9 @@ void AWwiseMicPosOrient::MatchStarting ( )
 
 struct FString AWwiseMicPosOrient::GetLocalString ( int Switch, class APlayerReplicationInfo* RelatedPRI, class APlayerReplicationInfo* RelatedPRI01 )
 {
-	static UFunction* pFnGetLocalString = NULL;
-
+	UFunction* pFnGetLocalString = (UFunction*) SdkBindings::Get ( 2270 );
 	if ( ! pFnGetLocalString )
-		pFnGetLocalString = (UFunction*) UObject::GObjObjects()->Data[ 4339 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetLocalString_Parms GetLocalString_Parms;
 	GetLocalString_Parms.Switch = Switch;
@@ -3375,10 +3224,9 @@ struct FString AWwiseMicPosOrient::GetLocalString ( int Switch, class APlayerRep
 
 void AWwiseMicPosOrient::ReplaceText ( struct FString Replace, struct FString With, struct FString* Text )
 {
-	static UFunction* pFnReplaceText = NULL;
-
+	UFunction* pFnReplaceText = (UFunction*) SdkBindings::Get ( 2269 );
 	if ( ! pFnReplaceText )
-		pFnReplaceText = (UFunction*) UObject::GObjObjects()->Data[ 4333 ];
+		return;
 
 	AWwiseMicPosOrient_execReplaceText_Parms ReplaceText_Parms;
 	memcpy ( &ReplaceText_Parms.Replace, &Replace, 0xC );
@@ -3397,10 +3245,9 @@ void AWwiseMicPosOrient::ReplaceText ( struct FString Replace, struct FString Wi
 
 struct FString AWwiseMicPosOrient::GetHumanReadableName ( )
 {
-	static UFunction* pFnGetHumanReadableName = NULL;
-
+	UFunction* pFnGetHumanReadableName = (UFunction*) SdkBindings::Get ( 2268 );
 	if ( ! pFnGetHumanReadableName )
-		pFnGetHumanReadableName = (UFunction*) UObject::GObjObjects()->Data[ 4331 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetHumanReadableName_Parms GetHumanReadableName_Parms;
 
@@ -3417,10 +3264,9 @@ struct FString AWwiseMicPosOrient::GetHumanReadableName ( )
 
 struct FString AWwiseMicPosOrient::GetItemName ( struct FString FullName )
 {
-	static UFunction* pFnGetItemName = NULL;
-
+	UFunction* pFnGetItemName = (UFunction*) SdkBindings::Get ( 2267 );
 	if ( ! pFnGetItemName )
-		pFnGetItemName = (UFunction*) UObject::GObjObjects()->Data[ 4327 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetItemName_Parms GetItemName_Parms;
 	memcpy ( &GetItemName_Parms.FullName, &FullName, 0xC );
@@ -3441,10 +3287,9 @@ struct FString AWwiseMicPosOrient::GetItemName ( struct FString FullName )
 
 bool AWwiseMicPosOrient::CalcCamera ( float fDeltaTime, struct FVector* out_CamLoc, struct FRotator* out_CamRot, float* out_FOV )
 {
-	static UFunction* pFnCalcCamera = NULL;
-
+	UFunction* pFnCalcCamera = (UFunction*) SdkBindings::Get ( 2266 );
 	if ( ! pFnCalcCamera )
-		pFnCalcCamera = (UFunction*) UObject::GObjObjects()->Data[ 4318 ];
+		return {};
 
 	AWwiseMicPosOrient_execCalcCamera_Parms CalcCamera_Parms;
 	CalcCamera_Parms.fDeltaTime = fDeltaTime;
@@ -3470,10 +3315,9 @@ bool AWwiseMicPosOrient::CalcCamera ( float fDeltaTime, struct FVector* out_CamL
 
 void AWwiseMicPosOrient::eventEndViewTarget ( class APlayerController* PC )
 {
-	static UFunction* pFnEndViewTarget = NULL;
-
+	UFunction* pFnEndViewTarget = (UFunction*) SdkBindings::Get ( 2265 );
 	if ( ! pFnEndViewTarget )
-		pFnEndViewTarget = (UFunction*) UObject::GObjObjects()->Data[ 4316 ];
+		return;
 
 	AWwiseMicPosOrient_eventEndViewTarget_Parms EndViewTarget_Parms;
 	EndViewTarget_Parms.PC = PC;
@@ -3488,10 +3332,9 @@ void AWwiseMicPosOrient::eventEndViewTarget ( class APlayerController* PC )
 
 void AWwiseMicPosOrient::eventBecomeViewTarget ( class APlayerController* PC )
 {
-	static UFunction* pFnBecomeViewTarget = NULL;
-
+	UFunction* pFnBecomeViewTarget = (UFunction*) SdkBindings::Get ( 2264 );
 	if ( ! pFnBecomeViewTarget )
-		pFnBecomeViewTarget = (UFunction*) UObject::GObjObjects()->Data[ 4314 ];
+		return;
 
 	AWwiseMicPosOrient_eventBecomeViewTarget_Parms BecomeViewTarget_Parms;
 	BecomeViewTarget_Parms.PC = PC;
@@ -3506,10 +3349,9 @@ void AWwiseMicPosOrient::eventBecomeViewTarget ( class APlayerController* PC )
 
 bool AWwiseMicPosOrient::CheckForErrors ( )
 {
-	static UFunction* pFnCheckForErrors = NULL;
-
+	UFunction* pFnCheckForErrors = (UFunction*) SdkBindings::Get ( 2263 );
 	if ( ! pFnCheckForErrors )
-		pFnCheckForErrors = (UFunction*) UObject::GObjObjects()->Data[ 4312 ];
+		return {};
 
 	AWwiseMicPosOrient_execCheckForErrors_Parms CheckForErrors_Parms;
 
@@ -3525,10 +3367,9 @@ bool AWwiseMicPosOrient::CheckForErrors ( )
 
 void AWwiseMicPosOrient::eventDebugFreezeGame ( class AActor* ActorToLookAt )
 {
-	static UFunction* pFnDebugFreezeGame = NULL;
-
+	UFunction* pFnDebugFreezeGame = (UFunction*) SdkBindings::Get ( 2262 );
 	if ( ! pFnDebugFreezeGame )
-		pFnDebugFreezeGame = (UFunction*) UObject::GObjObjects()->Data[ 4310 ];
+		return;
 
 	AWwiseMicPosOrient_eventDebugFreezeGame_Parms DebugFreezeGame_Parms;
 	DebugFreezeGame_Parms.ActorToLookAt = ActorToLookAt;
@@ -3543,10 +3384,9 @@ void AWwiseMicPosOrient::eventDebugFreezeGame ( class AActor* ActorToLookAt )
 
 float AWwiseMicPosOrient::GetGravityZ ( )
 {
-	static UFunction* pFnGetGravityZ = NULL;
-
+	UFunction* pFnGetGravityZ = (UFunction*) SdkBindings::Get ( 2261 );
 	if ( ! pFnGetGravityZ )
-		pFnGetGravityZ = (UFunction*) UObject::GObjObjects()->Data[ 4308 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetGravityZ_Parms GetGravityZ_Parms;
 
@@ -3569,10 +3409,9 @@ float AWwiseMicPosOrient::GetGravityZ ( )
 
 void AWwiseMicPosOrient::CheckHitInfo ( class UPrimitiveComponent* FallBackComponent, struct FVector Dir, struct FTraceHitInfo* HitInfo, struct FVector* out_HitLocation )
 {
-	static UFunction* pFnCheckHitInfo = NULL;
-
+	UFunction* pFnCheckHitInfo = (UFunction*) SdkBindings::Get ( 2260 );
 	if ( ! pFnCheckHitInfo )
-		pFnCheckHitInfo = (UFunction*) UObject::GObjObjects()->Data[ 4297 ];
+		return;
 
 	AWwiseMicPosOrient_execCheckHitInfo_Parms CheckHitInfo_Parms;
 	CheckHitInfo_Parms.FallBackComponent = FallBackComponent;
@@ -3603,10 +3442,9 @@ void AWwiseMicPosOrient::CheckHitInfo ( class UPrimitiveComponent* FallBackCompo
 
 void AWwiseMicPosOrient::eventTakeRadiusDamage ( class AController* instigatedBy, float BaseDamage, float DamageRadius, class UClass* DamageType, float Momentum, struct FVector HurtOrigin, unsigned long bFullDamage, class AActor* DamageCauser, float DamageFalloffExponent, struct FTraceHitInfo HitInfo )
 {
-	static UFunction* pFnTakeRadiusDamage = NULL;
-
+	UFunction* pFnTakeRadiusDamage = (UFunction*) SdkBindings::Get ( 2259 );
 	if ( ! pFnTakeRadiusDamage )
-		pFnTakeRadiusDamage = (UFunction*) UObject::GObjObjects()->Data[ 4278 ];
+		return;
 
 	AWwiseMicPosOrient_eventTakeRadiusDamage_Parms TakeRadiusDamage_Parms;
 	TakeRadiusDamage_Parms.instigatedBy = instigatedBy;
@@ -3633,10 +3471,9 @@ void AWwiseMicPosOrient::eventTakeRadiusDamage ( class AController* instigatedBy
 
 bool AWwiseMicPosOrient::eventHealDamage ( int Amount, class AController* Healer, class UClass* DamageType )
 {
-	static UFunction* pFnHealDamage = NULL;
-
+	UFunction* pFnHealDamage = (UFunction*) SdkBindings::Get ( 2258 );
 	if ( ! pFnHealDamage )
-		pFnHealDamage = (UFunction*) UObject::GObjObjects()->Data[ 4273 ];
+		return {};
 
 	AWwiseMicPosOrient_eventHealDamage_Parms HealDamage_Parms;
 	HealDamage_Parms.Amount = Amount;
@@ -3661,10 +3498,9 @@ bool AWwiseMicPosOrient::eventHealDamage ( int Amount, class AController* Healer
 
 void AWwiseMicPosOrient::eventTakeDamage ( float DamageAmount, class AController* EventInstigator, struct FVector HitLocation, struct FVector Momentum, class UClass* DamageType, struct FTraceHitInfo HitInfo, class AActor* DamageCauser )
 {
-	static UFunction* pFnTakeDamage = NULL;
-
+	UFunction* pFnTakeDamage = (UFunction*) SdkBindings::Get ( 2256 );
 	if ( ! pFnTakeDamage )
-		pFnTakeDamage = (UFunction*) UObject::GObjObjects()->Data[ 4261 ];
+		return;
 
 	AWwiseMicPosOrient_eventTakeDamage_Parms TakeDamage_Parms;
 	TakeDamage_Parms.DamageAmount = DamageAmount;
@@ -3685,10 +3521,9 @@ void AWwiseMicPosOrient::eventTakeDamage ( float DamageAmount, class AController
 
 void AWwiseMicPosOrient::KilledBy ( class APawn* EventInstigator )
 {
-	static UFunction* pFnKilledBy = NULL;
-
+	UFunction* pFnKilledBy = (UFunction*) SdkBindings::Get ( 2255 );
 	if ( ! pFnKilledBy )
-		pFnKilledBy = (UFunction*) UObject::GObjObjects()->Data[ 4259 ];
+		return;
 
 	AWwiseMicPosOrient_execKilledBy_Parms KilledBy_Parms;
 	KilledBy_Parms.EventInstigator = EventInstigator;
@@ -3711,10 +3546,9 @@ void AWwiseMicPosOrient::KilledBy ( class APawn* EventInstigator )
 
 bool AWwiseMicPosOrient::HurtRadius ( float BaseDamage, float DamageRadius, class UClass* DamageType, float Momentum, struct FVector HurtOrigin, class AActor* IgnoredActor, class AController* InstigatedByController, unsigned long bDoFullDamage )
 {
-	static UFunction* pFnHurtRadius = NULL;
-
+	UFunction* pFnHurtRadius = (UFunction*) SdkBindings::Get ( 2254 );
 	if ( ! pFnHurtRadius )
-		pFnHurtRadius = (UFunction*) UObject::GObjObjects()->Data[ 4236 ];
+		return {};
 
 	AWwiseMicPosOrient_execHurtRadius_Parms HurtRadius_Parms;
 	HurtRadius_Parms.BaseDamage = BaseDamage;
@@ -3739,10 +3573,9 @@ bool AWwiseMicPosOrient::HurtRadius ( float BaseDamage, float DamageRadius, clas
 
 bool AWwiseMicPosOrient::StopsProjectile ( class AProjectile* P )
 {
-	static UFunction* pFnStopsProjectile = NULL;
-
+	UFunction* pFnStopsProjectile = (UFunction*) SdkBindings::Get ( 2253 );
 	if ( ! pFnStopsProjectile )
-		pFnStopsProjectile = (UFunction*) UObject::GObjObjects()->Data[ 4231 ];
+		return {};
 
 	AWwiseMicPosOrient_execStopsProjectile_Parms StopsProjectile_Parms;
 	StopsProjectile_Parms.P = P;
@@ -3759,10 +3592,9 @@ bool AWwiseMicPosOrient::StopsProjectile ( class AProjectile* P )
 
 void AWwiseMicPosOrient::eventNotifySkelControlBeyondLimit ( class USkelControlLookAt* LookAt )
 {
-	static UFunction* pFnNotifySkelControlBeyondLimit = NULL;
-
+	UFunction* pFnNotifySkelControlBeyondLimit = (UFunction*) SdkBindings::Get ( 2252 );
 	if ( ! pFnNotifySkelControlBeyondLimit )
-		pFnNotifySkelControlBeyondLimit = (UFunction*) UObject::GObjObjects()->Data[ 4229 ];
+		return;
 
 	AWwiseMicPosOrient_eventNotifySkelControlBeyondLimit_Parms NotifySkelControlBeyondLimit_Parms;
 	NotifySkelControlBeyondLimit_Parms.LookAt = LookAt;
@@ -3779,10 +3611,9 @@ void AWwiseMicPosOrient::eventNotifySkelControlBeyondLimit ( class USkelControlL
 
 void AWwiseMicPosOrient::eventConstraintBrokenNotify ( class AActor* ConOwner, class URB_ConstraintSetup* ConSetup, class URB_ConstraintInstance* ConInstance )
 {
-	static UFunction* pFnConstraintBrokenNotify = NULL;
-
+	UFunction* pFnConstraintBrokenNotify = (UFunction*) SdkBindings::Get ( 2251 );
 	if ( ! pFnConstraintBrokenNotify )
-		pFnConstraintBrokenNotify = (UFunction*) UObject::GObjObjects()->Data[ 4225 ];
+		return;
 
 	AWwiseMicPosOrient_eventConstraintBrokenNotify_Parms ConstraintBrokenNotify_Parms;
 	ConstraintBrokenNotify_Parms.ConOwner = ConOwner;
@@ -3798,10 +3629,9 @@ void AWwiseMicPosOrient::eventConstraintBrokenNotify ( class AActor* ConOwner, c
 
 void AWwiseMicPosOrient::eventSetInitialState ( )
 {
-	static UFunction* pFnSetInitialState = NULL;
-
+	UFunction* pFnSetInitialState = (UFunction*) SdkBindings::Get ( 2250 );
 	if ( ! pFnSetInitialState )
-		pFnSetInitialState = (UFunction*) UObject::GObjObjects()->Data[ 4222 ];
+		return;
 
 	AWwiseMicPosOrient_eventSetInitialState_Parms SetInitialState_Parms;
 
@@ -3814,10 +3644,9 @@ void AWwiseMicPosOrient::eventSetInitialState ( )
 
 void AWwiseMicPosOrient::eventPostBeginPlay ( )
 {
-	static UFunction* pFnPostBeginPlay = NULL;
-
+	UFunction* pFnPostBeginPlay = (UFunction*) SdkBindings::Get ( 2249 );
 	if ( ! pFnPostBeginPlay )
-		pFnPostBeginPlay = (UFunction*) UObject::GObjObjects()->Data[ 4221 ];
+		return;
 
 	AWwiseMicPosOrient_eventPostBeginPlay_Parms PostBeginPlay_Parms;
 
@@ -3836,10 +3665,9 @@ void AWwiseMicPosOrient::eventPostBeginPlay ( )
 
 void AWwiseMicPosOrient::eventBroadcastLocalizedTeamMessage ( int TeamIndex, class UClass* InMessageClass, int Switch, class APlayerReplicationInfo* RelatedPRI, class APlayerReplicationInfo* RelatedPRI01, class UObject* OptionalObject )
 {
-	static UFunction* pFnBroadcastLocalizedTeamMessage = NULL;
-
+	UFunction* pFnBroadcastLocalizedTeamMessage = (UFunction*) SdkBindings::Get ( 2248 );
 	if ( ! pFnBroadcastLocalizedTeamMessage )
-		pFnBroadcastLocalizedTeamMessage = (UFunction*) UObject::GObjObjects()->Data[ 4214 ];
+		return;
 
 	AWwiseMicPosOrient_eventBroadcastLocalizedTeamMessage_Parms BroadcastLocalizedTeamMessage_Parms;
 	BroadcastLocalizedTeamMessage_Parms.TeamIndex = TeamIndex;
@@ -3863,10 +3691,9 @@ void AWwiseMicPosOrient::eventBroadcastLocalizedTeamMessage ( int TeamIndex, cla
 
 void AWwiseMicPosOrient::eventBroadcastLocalizedMessage ( class UClass* InMessageClass, int Switch, class APlayerReplicationInfo* RelatedPRI, class APlayerReplicationInfo* RelatedPRI01, class UObject* OptionalObject )
 {
-	static UFunction* pFnBroadcastLocalizedMessage = NULL;
-
+	UFunction* pFnBroadcastLocalizedMessage = (UFunction*) SdkBindings::Get ( 2246 );
 	if ( ! pFnBroadcastLocalizedMessage )
-		pFnBroadcastLocalizedMessage = (UFunction*) UObject::GObjObjects()->Data[ 4207 ];
+		return;
 
 	AWwiseMicPosOrient_eventBroadcastLocalizedMessage_Parms BroadcastLocalizedMessage_Parms;
 	BroadcastLocalizedMessage_Parms.InMessageClass = InMessageClass;
@@ -3884,10 +3711,9 @@ void AWwiseMicPosOrient::eventBroadcastLocalizedMessage ( class UClass* InMessag
 
 void AWwiseMicPosOrient::eventPreBeginPlay ( )
 {
-	static UFunction* pFnPreBeginPlay = NULL;
-
+	UFunction* pFnPreBeginPlay = (UFunction*) SdkBindings::Get ( 2245 );
 	if ( ! pFnPreBeginPlay )
-		pFnPreBeginPlay = (UFunction*) UObject::GObjObjects()->Data[ 4198 ];
+		return;
 
 	AWwiseMicPosOrient_eventPreBeginPlay_Parms PreBeginPlay_Parms;
 
@@ -3903,10 +3729,9 @@ void AWwiseMicPosOrient::eventPreBeginPlay ( )
 
 bool AWwiseMicPosOrient::FindActorsOfClass ( class UClass* ActorClass, TArray< class AActor* >* out_Actors )
 {
-	static UFunction* pFnFindActorsOfClass = NULL;
-
+	UFunction* pFnFindActorsOfClass = (UFunction*) SdkBindings::Get ( 2244 );
 	if ( ! pFnFindActorsOfClass )
-		pFnFindActorsOfClass = (UFunction*) UObject::GObjObjects()->Data[ 4192 ];
+		return {};
 
 	AWwiseMicPosOrient_execFindActorsOfClass_Parms FindActorsOfClass_Parms;
 	FindActorsOfClass_Parms.ActorClass = ActorClass;
@@ -3926,10 +3751,9 @@ bool AWwiseMicPosOrient::FindActorsOfClass ( class UClass* ActorClass, TArray< c
 
 bool AWwiseMicPosOrient::MoveActorToFloor ( )
 {
-	static UFunction* pFnMoveActorToFloor = NULL;
-
+	UFunction* pFnMoveActorToFloor = (UFunction*) SdkBindings::Get ( 2243 );
 	if ( ! pFnMoveActorToFloor )
-		pFnMoveActorToFloor = (UFunction*) UObject::GObjObjects()->Data[ 4190 ];
+		return {};
 
 	AWwiseMicPosOrient_execMoveActorToFloor_Parms MoveActorToFloor_Parms;
 
@@ -3949,10 +3773,9 @@ bool AWwiseMicPosOrient::MoveActorToFloor ( )
 
 class APlayerController* AWwiseMicPosOrient::GetALocalPlayerController ( )
 {
-	static UFunction* pFnGetALocalPlayerController = NULL;
-
+	UFunction* pFnGetALocalPlayerController = (UFunction*) SdkBindings::Get ( 2242 );
 	if ( ! pFnGetALocalPlayerController )
-		pFnGetALocalPlayerController = (UFunction*) UObject::GObjObjects()->Data[ 4188 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetALocalPlayerController_Parms GetALocalPlayerController_Parms;
 
@@ -3973,10 +3796,9 @@ class APlayerController* AWwiseMicPosOrient::GetALocalPlayerController ( )
 
 void AWwiseMicPosOrient::LocalPlayerControllers ( class UClass* BaseClass, class APlayerController** PC )
 {
-	static UFunction* pFnLocalPlayerControllers = NULL;
-
+	UFunction* pFnLocalPlayerControllers = (UFunction*) SdkBindings::Get ( 2241 );
 	if ( ! pFnLocalPlayerControllers )
-		pFnLocalPlayerControllers = (UFunction*) UObject::GObjObjects()->Data[ 4185 ];
+		return;
 
 	AWwiseMicPosOrient_execLocalPlayerControllers_Parms LocalPlayerControllers_Parms;
 	LocalPlayerControllers_Parms.BaseClass = BaseClass;
@@ -3999,10 +3821,9 @@ void AWwiseMicPosOrient::LocalPlayerControllers ( class UClass* BaseClass, class
 
 void AWwiseMicPosOrient::AllOwnedComponents ( class UClass* BaseClass, class UActorComponent** OutComponent )
 {
-	static UFunction* pFnAllOwnedComponents = NULL;
-
+	UFunction* pFnAllOwnedComponents = (UFunction*) SdkBindings::Get ( 2240 );
 	if ( ! pFnAllOwnedComponents )
-		pFnAllOwnedComponents = (UFunction*) UObject::GObjObjects()->Data[ 4182 ];
+		return;
 
 	AWwiseMicPosOrient_execAllOwnedComponents_Parms AllOwnedComponents_Parms;
 	AllOwnedComponents_Parms.BaseClass = BaseClass;
@@ -4025,10 +3846,9 @@ void AWwiseMicPosOrient::AllOwnedComponents ( class UClass* BaseClass, class UAc
 
 void AWwiseMicPosOrient::ComponentList ( class UClass* BaseClass, class UActorComponent** out_Component )
 {
-	static UFunction* pFnComponentList = NULL;
-
+	UFunction* pFnComponentList = (UFunction*) SdkBindings::Get ( 2239 );
 	if ( ! pFnComponentList )
-		pFnComponentList = (UFunction*) UObject::GObjObjects()->Data[ 4179 ];
+		return;
 
 	AWwiseMicPosOrient_execComponentList_Parms ComponentList_Parms;
 	ComponentList_Parms.BaseClass = BaseClass;
@@ -4054,10 +3874,9 @@ void AWwiseMicPosOrient::ComponentList ( class UClass* BaseClass, class UActorCo
 
 void AWwiseMicPosOrient::OverlappingActors ( class UClass* BaseClass, float Radius, struct FVector Loc, unsigned long bIgnoreHidden, class AActor** out_Actor )
 {
-	static UFunction* pFnOverlappingActors = NULL;
-
+	UFunction* pFnOverlappingActors = (UFunction*) SdkBindings::Get ( 2238 );
 	if ( ! pFnOverlappingActors )
-		pFnOverlappingActors = (UFunction*) UObject::GObjObjects()->Data[ 4173 ];
+		return;
 
 	AWwiseMicPosOrient_execOverlappingActors_Parms OverlappingActors_Parms;
 	OverlappingActors_Parms.BaseClass = BaseClass;
@@ -4088,10 +3907,9 @@ void AWwiseMicPosOrient::OverlappingActors ( class UClass* BaseClass, float Radi
 
 void AWwiseMicPosOrient::CollidingActors ( class UClass* BaseClass, float Radius, struct FVector Loc, unsigned long bUseOverlapCheck, class UClass* InterfaceClass, class AActor** Actor, struct FTraceHitInfo* HitInfo )
 {
-	static UFunction* pFnCollidingActors = NULL;
-
+	UFunction* pFnCollidingActors = (UFunction*) SdkBindings::Get ( 2237 );
 	if ( ! pFnCollidingActors )
-		pFnCollidingActors = (UFunction*) UObject::GObjObjects()->Data[ 4165 ];
+		return;
 
 	AWwiseMicPosOrient_execCollidingActors_Parms CollidingActors_Parms;
 	CollidingActors_Parms.BaseClass = BaseClass;
@@ -4133,10 +3951,9 @@ void AWwiseMicPosOrient::CollidingActors ( class UClass* BaseClass, float Radius
 
 void AWwiseMicPosOrient::VisibleCollidingActors ( class UClass* BaseClass, float Radius, struct FVector Loc, unsigned long bIgnoreHidden, struct FVector Extent, unsigned long bTraceActors, class UClass* InterfaceClass, class AActor** Actor, struct FTraceHitInfo* HitInfo )
 {
-	static UFunction* pFnVisibleCollidingActors = NULL;
-
+	UFunction* pFnVisibleCollidingActors = (UFunction*) SdkBindings::Get ( 2236 );
 	if ( ! pFnVisibleCollidingActors )
-		pFnVisibleCollidingActors = (UFunction*) UObject::GObjObjects()->Data[ 4155 ];
+		return;
 
 	AWwiseMicPosOrient_execVisibleCollidingActors_Parms VisibleCollidingActors_Parms;
 	VisibleCollidingActors_Parms.BaseClass = BaseClass;
@@ -4175,10 +3992,9 @@ void AWwiseMicPosOrient::VisibleCollidingActors ( class UClass* BaseClass, float
 
 void AWwiseMicPosOrient::VisibleActors ( class UClass* BaseClass, float Radius, struct FVector Loc, class AActor** Actor )
 {
-	static UFunction* pFnVisibleActors = NULL;
-
+	UFunction* pFnVisibleActors = (UFunction*) SdkBindings::Get ( 2235 );
 	if ( ! pFnVisibleActors )
-		pFnVisibleActors = (UFunction*) UObject::GObjObjects()->Data[ 4150 ];
+		return;
 
 	AWwiseMicPosOrient_execVisibleActors_Parms VisibleActors_Parms;
 	VisibleActors_Parms.BaseClass = BaseClass;
@@ -4215,10 +4031,9 @@ void AWwiseMicPosOrient::VisibleActors ( class UClass* BaseClass, float Radius,
 
 void AWwiseMicPosOrient::TraceActors ( class UClass* BaseClass, struct FVector End, struct FVector Start, struct FVector Extent, int ExtraTraceFlags, class AActor** Actor, struct FVector* HitLoc, struct FVector* HitNorm, struct FTraceHitInfo* HitInfo )
 {
-	static UFunction* pFnTraceActors = NULL;
-
+	UFunction* pFnTraceActors = (UFunction*) SdkBindings::Get ( 2234 );
 	if ( ! pFnTraceActors )
-		pFnTraceActors = (UFunction*) UObject::GObjObjects()->Data[ 4140 ];
+		return;
 
 	AWwiseMicPosOrient_execTraceActors_Parms TraceActors_Parms;
 	TraceActors_Parms.BaseClass = BaseClass;
@@ -4260,10 +4075,9 @@ void AWwiseMicPosOrient::TraceActors ( class UClass* BaseClass, struct FVector E
 
 void AWwiseMicPosOrient::TouchingActors ( class UClass* BaseClass, unsigned long bReverse, class AActor** Actor )
 {
-	static UFunction* pFnTouchingActors = NULL;
-
+	UFunction* pFnTouchingActors = (UFunction*) SdkBindings::Get ( 2233 );
 	if ( ! pFnTouchingActors )
-		pFnTouchingActors = (UFunction*) UObject::GObjObjects()->Data[ 4136 ];
+		return;
 
 	AWwiseMicPosOrient_execTouchingActors_Parms TouchingActors_Parms;
 	TouchingActors_Parms.BaseClass = BaseClass;
@@ -4292,10 +4106,9 @@ void AWwiseMicPosOrient::TouchingActors ( class UClass* BaseClass, unsigned long
 
 void AWwiseMicPosOrient::BasedActors ( class UClass* BaseClass, class AActor** Actor )
 {
-	static UFunction* pFnBasedActors = NULL;
-
+	UFunction* pFnBasedActors = (UFunction*) SdkBindings::Get ( 2232 );
 	if ( ! pFnBasedActors )
-		pFnBasedActors = (UFunction*) UObject::GObjObjects()->Data[ 4133 ];
+		return;
 
 	AWwiseMicPosOrient_execBasedActors_Parms BasedActors_Parms;
 	BasedActors_Parms.BaseClass = BaseClass;
@@ -4323,10 +4136,9 @@ void AWwiseMicPosOrient::BasedActors ( class UClass* BaseClass, class AActor** A
 
 void AWwiseMicPosOrient::ChildActors ( class UClass* BaseClass, class AActor** Actor )
 {
-	static UFunction* pFnChildActors = NULL;
-
+	UFunction* pFnChildActors = (UFunction*) SdkBindings::Get ( 2231 );
 	if ( ! pFnChildActors )
-		pFnChildActors = (UFunction*) UObject::GObjObjects()->Data[ 4130 ];
+		return;
 
 	AWwiseMicPosOrient_execChildActors_Parms ChildActors_Parms;
 	ChildActors_Parms.BaseClass = BaseClass;
@@ -4355,10 +4167,9 @@ void AWwiseMicPosOrient::ChildActors ( class UClass* BaseClass, class AActor** A
 
 void AWwiseMicPosOrient::DynamicActors ( class UClass* BaseClass, class UClass* InterfaceClass, class AActor** Actor )
 {
-	static UFunction* pFnDynamicActors = NULL;
-
+	UFunction* pFnDynamicActors = (UFunction*) SdkBindings::Get ( 2230 );
 	if ( ! pFnDynamicActors )
-		pFnDynamicActors = (UFunction*) UObject::GObjObjects()->Data[ 4126 ];
+		return;
 
 	AWwiseMicPosOrient_execDynamicActors_Parms DynamicActors_Parms;
 	DynamicActors_Parms.BaseClass = BaseClass;
@@ -4388,10 +4199,9 @@ void AWwiseMicPosOrient::DynamicActors ( class UClass* BaseClass, class UClass*
 
 void AWwiseMicPosOrient::AllActors ( class UClass* BaseClass, class UClass* InterfaceClass, class AActor** Actor )
 {
-	static UFunction* pFnAllActors = NULL;
-
+	UFunction* pFnAllActors = (UFunction*) SdkBindings::Get ( 2229 );
 	if ( ! pFnAllActors )
-		pFnAllActors = (UFunction*) UObject::GObjObjects()->Data[ 4122 ];
+		return;
 
 	AWwiseMicPosOrient_execAllActors_Parms AllActors_Parms;
 	AllActors_Parms.BaseClass = BaseClass;
@@ -4419,10 +4229,9 @@ void AWwiseMicPosOrient::AllActors ( class UClass* BaseClass, class UClass* Inte
 
 struct FString AWwiseMicPosOrient::GetURLMap ( )
 {
-	static UFunction* pFnGetURLMap = NULL;
-
+	UFunction* pFnGetURLMap = (UFunction*) SdkBindings::Get ( 2228 );
 	if ( ! pFnGetURLMap )
-		pFnGetURLMap = (UFunction*) UObject::GObjObjects()->Data[ 4120 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetURLMap_Parms GetURLMap_Parms;
 
@@ -4447,10 +4256,9 @@ struct FString AWwiseMicPosOrient::GetURLMap ( )
 
 void AWwiseMicPosOrient::PostTeleport ( class ATeleporter* OutTeleporter )
 {
-	static UFunction* pFnPostTeleport = NULL;
-
+	UFunction* pFnPostTeleport = (UFunction*) SdkBindings::Get ( 2227 );
 	if ( ! pFnPostTeleport )
-		pFnPostTeleport = (UFunction*) UObject::GObjObjects()->Data[ 4118 ];
+		return;
 
 	AWwiseMicPosOrient_execPostTeleport_Parms PostTeleport_Parms;
 	PostTeleport_Parms.OutTeleporter = OutTeleporter;
@@ -4466,10 +4274,9 @@ void AWwiseMicPosOrient::PostTeleport ( class ATeleporter* OutTeleporter )
 
 bool AWwiseMicPosOrient::PreTeleport ( class ATeleporter* InTeleporter )
 {
-	static UFunction* pFnPreTeleport = NULL;
-
+	UFunction* pFnPreTeleport = (UFunction*) SdkBindings::Get ( 2226 );
 	if ( ! pFnPreTeleport )
-		pFnPreTeleport = (UFunction*) UObject::GObjObjects()->Data[ 4115 ];
+		return {};
 
 	AWwiseMicPosOrient_execPreTeleport_Parms PreTeleport_Parms;
 	PreTeleport_Parms.InTeleporter = InTeleporter;
@@ -4487,10 +4294,9 @@ bool AWwiseMicPosOrient::PreTeleport ( class ATeleporter* InTeleporter )
 
 struct FVector AWwiseMicPosOrient::GetDestination ( class AController* C )
 {
-	static UFunction* pFnGetDestination = NULL;
-
+	UFunction* pFnGetDestination = (UFunction*) SdkBindings::Get ( 2225 );
 	if ( ! pFnGetDestination )
-		pFnGetDestination = (UFunction*) UObject::GObjObjects()->Data[ 4112 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetDestination_Parms GetDestination_Parms;
 	GetDestination_Parms.C = C;
@@ -4521,10 +4327,9 @@ struct FVector AWwiseMicPosOrient::GetDestination ( class AController* C )
 
 bool AWwiseMicPosOrient::SuggestTossVelocity ( struct FVector Destination, struct FVector Start, float TossSpeed, float BaseTossZ, float DesiredZPct, struct FVector CollisionSize, float TerminalVelocity, float OverrideGravityZ, unsigned long bOnlyTraceUp, struct FVector* TossVelocity )
 {
-	static UFunction* pFnSuggestTossVelocity = NULL;
-
+	UFunction* pFnSuggestTossVelocity = (UFunction*) SdkBindings::Get ( 2224 );
 	if ( ! pFnSuggestTossVelocity )
-		pFnSuggestTossVelocity = (UFunction*) UObject::GObjObjects()->Data[ 4100 ];
+		return {};
 
 	AWwiseMicPosOrient_execSuggestTossVelocity_Parms SuggestTossVelocity_Parms;
 	memcpy ( &SuggestTossVelocity_Parms.Destination, &Destination, 0xC );
@@ -4556,10 +4361,9 @@ bool AWwiseMicPosOrient::SuggestTossVelocity ( struct FVector Destination, struc
 
 bool AWwiseMicPosOrient::PlayerCanSeeMe ( )
 {
-	static UFunction* pFnPlayerCanSeeMe = NULL;
-
+	UFunction* pFnPlayerCanSeeMe = (UFunction*) SdkBindings::Get ( 2223 );
 	if ( ! pFnPlayerCanSeeMe )
-		pFnPlayerCanSeeMe = (UFunction*) UObject::GObjObjects()->Data[ 4098 ];
+		return {};
 
 	AWwiseMicPosOrient_execPlayerCanSeeMe_Parms PlayerCanSeeMe_Parms;
 
@@ -4585,10 +4389,9 @@ bool AWwiseMicPosOrient::PlayerCanSeeMe ( )
 
 void AWwiseMicPosOrient::MakeNoise ( float Loudness, struct FName NoiseType )
 {
-	static UFunction* pFnMakeNoise = NULL;
-
+	UFunction* pFnMakeNoise = (UFunction*) SdkBindings::Get ( 2222 );
 	if ( ! pFnMakeNoise )
-		pFnMakeNoise = (UFunction*) UObject::GObjObjects()->Data[ 4095 ];
+		return;
 
 	AWwiseMicPosOrient_execMakeNoise_Parms MakeNoise_Parms;
 	MakeNoise_Parms.Loudness = Loudness;
@@ -4613,10 +4416,9 @@ void AWwiseMicPosOrient::MakeNoise ( float Loudness, struct FName NoiseType )
 
 void AWwiseMicPosOrient::StopSound ( class UWwiseBaseSoundObject* InSoundEvent )
 {
-	static UFunction* pFnStopSound = NULL;
-
+	UFunction* pFnStopSound = (UFunction*) SdkBindings::Get ( 2221 );
 	if ( ! pFnStopSound )
-		pFnStopSound = (UFunction*) UObject::GObjObjects()->Data[ 4093 ];
+		return;
 
 	AWwiseMicPosOrient_execStopSound_Parms StopSound_Parms;
 	StopSound_Parms.InSoundEvent = InSoundEvent;
@@ -4640,10 +4442,9 @@ void AWwiseMicPosOrient::StopSound ( class UWwiseBaseSoundObject* InSoundEvent )
 
 void AWwiseMicPosOrient::PlaySound ( class UWwiseBaseSoundObject* InSoundCue, unsigned long bNotReplicated, unsigned long bNoRepToOwner, unsigned long bStopWhenOwnerDestroyed, struct FVector SoundLocation, unsigned long bNoRepToRelevant )
 {
-	static UFunction* pFnPlaySound = NULL;
-
+	UFunction* pFnPlaySound = (UFunction*) SdkBindings::Get ( 2220 );
 	if ( ! pFnPlaySound )
-		pFnPlaySound = (UFunction*) UObject::GObjObjects()->Data[ 4086 ];
+		return;
 
 	AWwiseMicPosOrient_execPlaySound_Parms PlaySound_Parms;
 	PlaySound_Parms.InSoundCue = InSoundCue;
@@ -4673,10 +4474,9 @@ void AWwiseMicPosOrient::PlaySound ( class UWwiseBaseSoundObject* InSoundCue, un
 
 class UAudioComponent* AWwiseMicPosOrient::CreateAudioComponent ( class USoundCue* InSoundCue, unsigned long bPlay, unsigned long bStopWhenOwnerDestroyed, unsigned long bUseLocation, struct FVector SourceLocation, unsigned long bAttachToSelf )
 {
-	static UFunction* pFnCreateAudioComponent = NULL;
-
+	UFunction* pFnCreateAudioComponent = (UFunction*) SdkBindings::Get ( 2219 );
 	if ( ! pFnCreateAudioComponent )
-		pFnCreateAudioComponent = (UFunction*) UObject::GObjObjects()->Data[ 4078 ];
+		return {};
 
 	AWwiseMicPosOrient_execCreateAudioComponent_Parms CreateAudioComponent_Parms;
 	CreateAudioComponent_Parms.InSoundCue = InSoundCue;
@@ -4703,10 +4503,9 @@ class UAudioComponent* AWwiseMicPosOrient::CreateAudioComponent ( class USoundCu
 
 void AWwiseMicPosOrient::ResetTimerTimeDilation ( struct FName TimerName, class UObject* inObj )
 {
-	static UFunction* pFnResetTimerTimeDilation = NULL;
-
+	UFunction* pFnResetTimerTimeDilation = (UFunction*) SdkBindings::Get ( 2218 );
 	if ( ! pFnResetTimerTimeDilation )
-		pFnResetTimerTimeDilation = (UFunction*) UObject::GObjObjects()->Data[ 4075 ];
+		return;
 
 	AWwiseMicPosOrient_execResetTimerTimeDilation_Parms ResetTimerTimeDilation_Parms;
 	memcpy ( &ResetTimerTimeDilation_Parms.TimerName, &TimerName, 0x8 );
@@ -4728,10 +4527,9 @@ void AWwiseMicPosOrient::ResetTimerTimeDilation ( struct FName TimerName, class
 
 void AWwiseMicPosOrient::ModifyTimerTimeDilation ( struct FName TimerName, float InTimerTimeDilation, class UObject* inObj )
 {
-	static UFunction* pFnModifyTimerTimeDilation = NULL;
-
+	UFunction* pFnModifyTimerTimeDilation = (UFunction*) SdkBindings::Get ( 2217 );
 	if ( ! pFnModifyTimerTimeDilation )
-		pFnModifyTimerTimeDilation = (UFunction*) UObject::GObjObjects()->Data[ 4071 ];
+		return;
 
 	AWwiseMicPosOrient_execModifyTimerTimeDilation_Parms ModifyTimerTimeDilation_Parms;
 	memcpy ( &ModifyTimerTimeDilation_Parms.TimerName, &TimerName, 0x8 );
@@ -4754,10 +4552,9 @@ void AWwiseMicPosOrient::ModifyTimerTimeDilation ( struct FName TimerName, float
 
 float AWwiseMicPosOrient::GetRemainingTimeForTimer ( struct FName TimerFuncName, class UObject* inObj )
 {
-	static UFunction* pFnGetRemainingTimeForTimer = NULL;
-
+	UFunction* pFnGetRemainingTimeForTimer = (UFunction*) SdkBindings::Get ( 2216 );
 	if ( ! pFnGetRemainingTimeForTimer )
-		pFnGetRemainingTimeForTimer = (UFunction*) UObject::GObjObjects()->Data[ 4065 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetRemainingTimeForTimer_Parms GetRemainingTimeForTimer_Parms;
 	memcpy ( &GetRemainingTimeForTimer_Parms.TimerFuncName, &TimerFuncName, 0x8 );
@@ -4777,10 +4574,9 @@ float AWwiseMicPosOrient::GetRemainingTimeForTimer ( struct FName TimerFuncName,
 
 float AWwiseMicPosOrient::GetTimerRate ( struct FName TimerFuncName, class UObject* inObj )
 {
-	static UFunction* pFnGetTimerRate = NULL;
-
+	UFunction* pFnGetTimerRate = (UFunction*) SdkBindings::Get ( 2215 );
 	if ( ! pFnGetTimerRate )
-		pFnGetTimerRate = (UFunction*) UObject::GObjObjects()->Data[ 4061 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetTimerRate_Parms GetTimerRate_Parms;
 	memcpy ( &GetTimerRate_Parms.TimerFuncName, &TimerFuncName, 0x8 );
@@ -4804,10 +4600,9 @@ float AWwiseMicPosOrient::GetTimerRate ( struct FName TimerFuncName, class UObje
 
 float AWwiseMicPosOrient::GetTimerCount ( struct FName inTimerFunc, class UObject* inObj )
 {
-	static UFunction* pFnGetTimerCount = NULL;
-
+	UFunction* pFnGetTimerCount = (UFunction*) SdkBindings::Get ( 2214 );
 	if ( ! pFnGetTimerCount )
-		pFnGetTimerCount = (UFunction*) UObject::GObjObjects()->Data[ 4057 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetTimerCount_Parms GetTimerCount_Parms;
 	memcpy ( &GetTimerCount_Parms.inTimerFunc, &inTimerFunc, 0x8 );
@@ -4831,10 +4626,9 @@ float AWwiseMicPosOrient::GetTimerCount ( struct FName inTimerFunc, class UObjec
 
 bool AWwiseMicPosOrient::IsTimerActive ( struct FName inTimerFunc, class UObject* inObj )
 {
-	static UFunction* pFnIsTimerActive = NULL;
-
+	UFunction* pFnIsTimerActive = (UFunction*) SdkBindings::Get ( 2213 );
 	if ( ! pFnIsTimerActive )
-		pFnIsTimerActive = (UFunction*) UObject::GObjObjects()->Data[ 4053 ];
+		return {};
 
 	AWwiseMicPosOrient_execIsTimerActive_Parms IsTimerActive_Parms;
 	memcpy ( &IsTimerActive_Parms.inTimerFunc, &inTimerFunc, 0x8 );
@@ -4858,10 +4652,9 @@ bool AWwiseMicPosOrient::IsTimerActive ( struct FName inTimerFunc, class UObject
 
 void AWwiseMicPosOrient::PauseTimer ( unsigned long bPause, struct FName inTimerFunc, class UObject* inObj )
 {
-	static UFunction* pFnPauseTimer = NULL;
-
+	UFunction* pFnPauseTimer = (UFunction*) SdkBindings::Get ( 2212 );
 	if ( ! pFnPauseTimer )
-		pFnPauseTimer = (UFunction*) UObject::GObjObjects()->Data[ 4049 ];
+		return;
 
 	AWwiseMicPosOrient_execPauseTimer_Parms PauseTimer_Parms;
 	PauseTimer_Parms.bPause = bPause;
@@ -4882,10 +4675,9 @@ void AWwiseMicPosOrient::PauseTimer ( unsigned long bPause, struct FName inTimer
 
 void AWwiseMicPosOrient::ClearAllTimers ( class UObject* inObj )
 {
-	static UFunction* pFnClearAllTimers = NULL;
-
+	UFunction* pFnClearAllTimers = (UFunction*) SdkBindings::Get ( 2211 );
 	if ( ! pFnClearAllTimers )
-		pFnClearAllTimers = (UFunction*) UObject::GObjObjects()->Data[ 4047 ];
+		return;
 
 	AWwiseMicPosOrient_execClearAllTimers_Parms ClearAllTimers_Parms;
 	ClearAllTimers_Parms.inObj = inObj;
@@ -4905,10 +4697,9 @@ void AWwiseMicPosOrient::ClearAllTimers ( class UObject* inObj )
 
 void AWwiseMicPosOrient::ClearTimer ( struct FName inTimerFunc, class UObject* inObj )
 {
-	static UFunction* pFnClearTimer = NULL;
-
+	UFunction* pFnClearTimer = (UFunction*) SdkBindings::Get ( 2210 );
 	if ( ! pFnClearTimer )
-		pFnClearTimer = (UFunction*) UObject::GObjObjects()->Data[ 4044 ];
+		return;
 
 	AWwiseMicPosOrient_execClearTimer_Parms ClearTimer_Parms;
 	memcpy ( &ClearTimer_Parms.inTimerFunc, &inTimerFunc, 0x8 );
@@ -4931,10 +4722,9 @@ void AWwiseMicPosOrient::ClearTimer ( struct FName inTimerFunc, class UObject* i
 
 void AWwiseMicPosOrient::SetTimer ( float InRate, unsigned long inbLoop, struct FName inTimerFunc, class UObject* inObj )
 {
-	static UFunction* pFnSetTimer = NULL;
-
+	UFunction* pFnSetTimer = (UFunction*) SdkBindings::Get ( 2209 );
 	if ( ! pFnSetTimer )
-		pFnSetTimer = (UFunction*) UObject::GObjObjects()->Data[ 4039 ];
+		return;
 
 	AWwiseMicPosOrient_execSetTimer_Parms SetTimer_Parms;
 	SetTimer_Parms.InRate = InRate;
@@ -4960,10 +4750,9 @@ void AWwiseMicPosOrient::SetTimer ( float InRate, unsigned long inbLoop, struct
 
 void AWwiseMicPosOrient::eventTornOff ( )
 {
-	static UFunction* pFnTornOff = NULL;
-
+	UFunction* pFnTornOff = (UFunction*) SdkBindings::Get ( 2208 );
 	if ( ! pFnTornOff )
-		pFnTornOff = (UFunction*) UObject::GObjObjects()->Data[ 4038 ];
+		return;
 
 	AWwiseMicPosOrient_eventTornOff_Parms TornOff_Parms;
 
@@ -4977,10 +4766,9 @@ void AWwiseMicPosOrient::eventTornOff ( )
 
 bool AWwiseMicPosOrient::Destroy ( )
 {
-	static UFunction* pFnDestroy = NULL;
-
+	UFunction* pFnDestroy = (UFunction*) SdkBindings::Get ( 2207 );
 	if ( ! pFnDestroy )
-		pFnDestroy = (UFunction*) UObject::GObjObjects()->Data[ 4036 ];
+		return {};
 
 	AWwiseMicPosOrient_execDestroy_Parms Destroy_Parms;
 
@@ -5013,10 +4801,9 @@ bool AWwiseMicPosOrient::Destroy ( )
 
 class AActor* AWwiseMicPosOrient::Spawn ( class UClass* SpawnClass, class AActor* SpawnOwner, struct FName SpawnTag, struct FVector SpawnLocation, struct FRotator SpawnRotation, class AActor* ActorTemplate, unsigned long bNoCollisionFail, unsigned long bFindSafeLocation )
 {
-	static UFunction* pFnSpawn = NULL;
-
+	UFunction* pFnSpawn = (UFunction*) SdkBindings::Get ( 2206 );
 	if ( ! pFnSpawn )
-		pFnSpawn = (UFunction*) UObject::GObjObjects()->Data[ 4026 ];
+		return {};
 
 	AWwiseMicPosOrient_execSpawn_Parms Spawn_Parms;
 	Spawn_Parms.SpawnClass = SpawnClass;
@@ -5045,10 +4832,9 @@ class AActor* AWwiseMicPosOrient::Spawn ( class UClass* SpawnClass, class AActor
 
 void AWwiseMicPosOrient::GetBoundingCylinder ( float* CollisionRadius, float* CollisionHeight )
 {
-	static UFunction* pFnGetBoundingCylinder = NULL;
-
+	UFunction* pFnGetBoundingCylinder = (UFunction*) SdkBindings::Get ( 2205 );
 	if ( ! pFnGetBoundingCylinder )
-		pFnGetBoundingCylinder = (UFunction*) UObject::GObjObjects()->Data[ 4023 ];
+		return;
 
 	AWwiseMicPosOrient_execGetBoundingCylinder_Parms GetBoundingCylinder_Parms;
 
@@ -5072,10 +4858,9 @@ void AWwiseMicPosOrient::GetBoundingCylinder ( float* CollisionRadius, float* Co
 
 void AWwiseMicPosOrient::GetComponentsBoundingBox ( struct FBox* ActorBox )
 {
-	static UFunction* pFnGetComponentsBoundingBox = NULL;
-
+	UFunction* pFnGetComponentsBoundingBox = (UFunction*) SdkBindings::Get ( 2204 );
 	if ( ! pFnGetComponentsBoundingBox )
-		pFnGetComponentsBoundingBox = (UFunction*) UObject::GObjObjects()->Data[ 4021 ];
+		return;
 
 	AWwiseMicPosOrient_execGetComponentsBoundingBox_Parms GetComponentsBoundingBox_Parms;
 
@@ -5097,10 +4882,9 @@ void AWwiseMicPosOrient::GetComponentsBoundingBox ( struct FBox* ActorBox )
 
 bool AWwiseMicPosOrient::IsOverlapping ( class AActor* A )
 {
-	static UFunction* pFnIsOverlapping = NULL;
-
+	UFunction* pFnIsOverlapping = (UFunction*) SdkBindings::Get ( 2203 );
 	if ( ! pFnIsOverlapping )
-		pFnIsOverlapping = (UFunction*) UObject::GObjObjects()->Data[ 4018 ];
+		return {};
 
 	AWwiseMicPosOrient_execIsOverlapping_Parms IsOverlapping_Parms;
 	IsOverlapping_Parms.A = A;
@@ -5122,10 +4906,9 @@ bool AWwiseMicPosOrient::IsOverlapping ( class AActor* A )
 
 bool AWwiseMicPosOrient::ContainsPoint ( struct FVector Spot )
 {
-	static UFunction* pFnContainsPoint = NULL;
-
+	UFunction* pFnContainsPoint = (UFunction*) SdkBindings::Get ( 2202 );
 	if ( ! pFnContainsPoint )
-		pFnContainsPoint = (UFunction*) UObject::GObjObjects()->Data[ 4015 ];
+		return {};
 
 	AWwiseMicPosOrient_execContainsPoint_Parms ContainsPoint_Parms;
 	memcpy ( &ContainsPoint_Parms.Spot, &Spot, 0xC );
@@ -5148,10 +4931,9 @@ bool AWwiseMicPosOrient::ContainsPoint ( struct FVector Spot )
 
 bool AWwiseMicPosOrient::FindSpot ( struct FVector BoxExtent, struct FVector* SpotLocation )
 {
-	static UFunction* pFnFindSpot = NULL;
-
+	UFunction* pFnFindSpot = (UFunction*) SdkBindings::Get ( 2201 );
 	if ( ! pFnFindSpot )
-		pFnFindSpot = (UFunction*) UObject::GObjObjects()->Data[ 4011 ];
+		return {};
 
 	AWwiseMicPosOrient_execFindSpot_Parms FindSpot_Parms;
 	memcpy ( &FindSpot_Parms.BoxExtent, &BoxExtent, 0xC );
@@ -5180,10 +4962,9 @@ bool AWwiseMicPosOrient::FindSpot ( struct FVector BoxExtent, struct FVector* Sp
 
 bool AWwiseMicPosOrient::TraceAllPhysicsAssetInteractions ( class USkeletalMeshComponent* SkelMeshComp, struct FVector EndTrace, struct FVector StartTrace, struct FVector Extent, TArray< struct FImpactInfo >* out_Hits )
 {
-	static UFunction* pFnTraceAllPhysicsAssetInteractions = NULL;
-
+	UFunction* pFnTraceAllPhysicsAssetInteractions = (UFunction*) SdkBindings::Get ( 2200 );
 	if ( ! pFnTraceAllPhysicsAssetInteractions )
-		pFnTraceAllPhysicsAssetInteractions = (UFunction*) UObject::GObjObjects()->Data[ 4003 ];
+		return {};
 
 	AWwiseMicPosOrient_execTraceAllPhysicsAssetInteractions_Parms TraceAllPhysicsAssetInteractions_Parms;
 	TraceAllPhysicsAssetInteractions_Parms.SkelMeshComp = SkelMeshComp;
@@ -5214,10 +4995,9 @@ bool AWwiseMicPosOrient::TraceAllPhysicsAssetInteractions ( class USkeletalMeshC
 
 bool AWwiseMicPosOrient::FastTrace ( struct FVector TraceEnd, struct FVector TraceStart, struct FVector BoxExtent, unsigned long bTraceBullet )
 {
-	static UFunction* pFnFastTrace = NULL;
-
+	UFunction* pFnFastTrace = (UFunction*) SdkBindings::Get ( 2199 );
 	if ( ! pFnFastTrace )
-		pFnFastTrace = (UFunction*) UObject::GObjObjects()->Data[ 3997 ];
+		return {};
 
 	AWwiseMicPosOrient_execFastTrace_Parms FastTrace_Parms;
 	memcpy ( &FastTrace_Parms.TraceEnd, &TraceEnd, 0xC );
@@ -5249,10 +5029,9 @@ bool AWwiseMicPosOrient::FastTrace ( struct FVector TraceEnd, struct FVector Tra
 
 bool AWwiseMicPosOrient::PointCheckComponent ( class UPrimitiveComponent* InComponent, struct FVector PointLocation, struct FVector PointExtent )
 {
-	static UFunction* pFnPointCheckComponent = NULL;
-
+	UFunction* pFnPointCheckComponent = (UFunction*) SdkBindings::Get ( 2198 );
 	if ( ! pFnPointCheckComponent )
-		pFnPointCheckComponent = (UFunction*) UObject::GObjObjects()->Data[ 3992 ];
+		return {};
 
 	AWwiseMicPosOrient_execPointCheckComponent_Parms PointCheckComponent_Parms;
 	PointCheckComponent_Parms.InComponent = InComponent;
@@ -5283,10 +5062,9 @@ bool AWwiseMicPosOrient::PointCheckComponent ( class UPrimitiveComponent* InComp
 
 bool AWwiseMicPosOrient::TraceComponent ( class UPrimitiveComponent* InComponent, struct FVector TraceEnd, struct FVector TraceStart, struct FVector Extent, unsigned long bComplexCollision, struct FVector* HitLocation, struct FVector* HitNormal, struct FTraceHitInfo* HitInfo )
 {
-	static UFunction* pFnTraceComponent = NULL;
-
+	UFunction* pFnTraceComponent = (UFunction*) SdkBindings::Get ( 2197 );
 	if ( ! pFnTraceComponent )
-		pFnTraceComponent = (UFunction*) UObject::GObjObjects()->Data[ 3982 ];
+		return {};
 
 	AWwiseMicPosOrient_execTraceComponent_Parms TraceComponent_Parms;
 	TraceComponent_Parms.InComponent = InComponent;
@@ -5328,10 +5106,9 @@ bool AWwiseMicPosOrient::TraceComponent ( class UPrimitiveComponent* InComponent
 
 class AActor* AWwiseMicPosOrient::Trace ( struct FVector TraceEnd, struct FVector TraceStart, unsigned long bTraceActors, struct FVector Extent, int ExtraTraceFlags, struct FVector* HitLocation, struct FVector* HitNormal, struct FTraceHitInfo* HitInfo )
 {
-	static UFunction* pFnTrace = NULL;
-
+	UFunction* pFnTrace = (UFunction*) SdkBindings::Get ( 2196 );
 	if ( ! pFnTrace )
-		pFnTrace = (UFunction*) UObject::GObjObjects()->Data[ 3972 ];
+		return {};
 
 	AWwiseMicPosOrient_execTrace_Parms Trace_Parms;
 	memcpy ( &Trace_Parms.TraceEnd, &TraceEnd, 0xC );
@@ -5370,10 +5147,9 @@ class AActor* AWwiseMicPosOrient::Trace ( struct FVector TraceEnd, struct FVecto
 
 void AWwiseMicPosOrient::VolumeBasedDestroy ( class APhysicsVolume* PV )
 {
-	static UFunction* pFnVolumeBasedDestroy = NULL;
-
+	UFunction* pFnVolumeBasedDestroy = (UFunction*) SdkBindings::Get ( 2195 );
 	if ( ! pFnVolumeBasedDestroy )
-		pFnVolumeBasedDestroy = (UFunction*) UObject::GObjObjects()->Data[ 3970 ];
+		return;
 
 	AWwiseMicPosOrient_execVolumeBasedDestroy_Parms VolumeBasedDestroy_Parms;
 	VolumeBasedDestroy_Parms.PV = PV;
@@ -5387,10 +5163,9 @@ void AWwiseMicPosOrient::VolumeBasedDestroy ( class APhysicsVolume* PV )
 
 void AWwiseMicPosOrient::eventOutsideWorldBounds ( )
 {
-	static UFunction* pFnOutsideWorldBounds = NULL;
-
+	UFunction* pFnOutsideWorldBounds = (UFunction*) SdkBindings::Get ( 2194 );
 	if ( ! pFnOutsideWorldBounds )
-		pFnOutsideWorldBounds = (UFunction*) UObject::GObjObjects()->Data[ 3969 ];
+		return;
 
 	AWwiseMicPosOrient_eventOutsideWorldBounds_Parms OutsideWorldBounds_Parms;
 
@@ -5404,10 +5179,9 @@ void AWwiseMicPosOrient::eventOutsideWorldBounds ( )
 
 void AWwiseMicPosOrient::eventFellOutOfWorld ( class UClass* dmgType )
 {
-	static UFunction* pFnFellOutOfWorld = NULL;
-
+	UFunction* pFnFellOutOfWorld = (UFunction*) SdkBindings::Get ( 2193 );
 	if ( ! pFnFellOutOfWorld )
-		pFnFellOutOfWorld = (UFunction*) UObject::GObjObjects()->Data[ 3967 ];
+		return;
 
 	AWwiseMicPosOrient_eventFellOutOfWorld_Parms FellOutOfWorld_Parms;
 	FellOutOfWorld_Parms.dmgType = dmgType;
@@ -5423,10 +5197,9 @@ void AWwiseMicPosOrient::eventFellOutOfWorld ( class UClass* dmgType )
 
 bool AWwiseMicPosOrient::UsedBy ( class APawn* User )
 {
-	static UFunction* pFnUsedBy = NULL;
-
+	UFunction* pFnUsedBy = (UFunction*) SdkBindings::Get ( 2192 );
 	if ( ! pFnUsedBy )
-		pFnUsedBy = (UFunction*) UObject::GObjObjects()->Data[ 3964 ];
+		return {};
 
 	AWwiseMicPosOrient_execUsedBy_Parms UsedBy_Parms;
 	UsedBy_Parms.User = User;
@@ -5445,10 +5218,9 @@ bool AWwiseMicPosOrient::UsedBy ( class APawn* User )
 
 bool AWwiseMicPosOrient::eventOverRotated ( struct FRotator* out_Desired, struct FRotator* out_Actual )
 {
-	static UFunction* pFnOverRotated = NULL;
-
+	UFunction* pFnOverRotated = (UFunction*) SdkBindings::Get ( 2191 );
 	if ( ! pFnOverRotated )
-		pFnOverRotated = (UFunction*) UObject::GObjObjects()->Data[ 3960 ];
+		return {};
 
 	AWwiseMicPosOrient_eventOverRotated_Parms OverRotated_Parms;
 
@@ -5474,10 +5246,9 @@ bool AWwiseMicPosOrient::eventOverRotated ( struct FRotator* out_Desired, struct
 
 bool AWwiseMicPosOrient::ClampRotation ( struct FRotator rBase, struct FRotator rUpperLimits, struct FRotator rLowerLimits, struct FRotator* out_Rot )
 {
-	static UFunction* pFnClampRotation = NULL;
-
+	UFunction* pFnClampRotation = (UFunction*) SdkBindings::Get ( 2190 );
 	if ( ! pFnClampRotation )
-		pFnClampRotation = (UFunction*) UObject::GObjObjects()->Data[ 3954 ];
+		return {};
 
 	AWwiseMicPosOrient_execClampRotation_Parms ClampRotation_Parms;
 	memcpy ( &ClampRotation_Parms.rBase, &rBase, 0xC );
@@ -5502,10 +5273,9 @@ bool AWwiseMicPosOrient::ClampRotation ( struct FRotator rBase, struct FRotator
 
 void AWwiseMicPosOrient::eventOnSleepRBPhysics ( )
 {
-	static UFunction* pFnOnSleepRBPhysics = NULL;
-
+	UFunction* pFnOnSleepRBPhysics = (UFunction*) SdkBindings::Get ( 2189 );
 	if ( ! pFnOnSleepRBPhysics )
-		pFnOnSleepRBPhysics = (UFunction*) UObject::GObjObjects()->Data[ 3953 ];
+		return;
 
 	AWwiseMicPosOrient_eventOnSleepRBPhysics_Parms OnSleepRBPhysics_Parms;
 
@@ -5518,10 +5288,9 @@ void AWwiseMicPosOrient::eventOnSleepRBPhysics ( )
 
 void AWwiseMicPosOrient::eventOnWakeRBPhysics ( )
 {
-	static UFunction* pFnOnWakeRBPhysics = NULL;
-
+	UFunction* pFnOnWakeRBPhysics = (UFunction*) SdkBindings::Get ( 2188 );
 	if ( ! pFnOnWakeRBPhysics )
-		pFnOnWakeRBPhysics = (UFunction*) UObject::GObjObjects()->Data[ 3952 ];
+		return;
 
 	AWwiseMicPosOrient_eventOnWakeRBPhysics_Parms OnWakeRBPhysics_Parms;
 
@@ -5535,10 +5304,9 @@ void AWwiseMicPosOrient::eventOnWakeRBPhysics ( )
 
 void AWwiseMicPosOrient::eventRanInto ( class AActor* Other )
 {
-	static UFunction* pFnRanInto = NULL;
-
+	UFunction* pFnRanInto = (UFunction*) SdkBindings::Get ( 2187 );
 	if ( ! pFnRanInto )
-		pFnRanInto = (UFunction*) UObject::GObjObjects()->Data[ 3950 ];
+		return;
 
 	AWwiseMicPosOrient_eventRanInto_Parms RanInto_Parms;
 	RanInto_Parms.Other = Other;
@@ -5553,10 +5321,9 @@ void AWwiseMicPosOrient::eventRanInto ( class AActor* Other )
 
 void AWwiseMicPosOrient::eventEncroachedBy ( class AActor* Other )
 {
-	static UFunction* pFnEncroachedBy = NULL;
-
+	UFunction* pFnEncroachedBy = (UFunction*) SdkBindings::Get ( 2186 );
 	if ( ! pFnEncroachedBy )
-		pFnEncroachedBy = (UFunction*) UObject::GObjObjects()->Data[ 3948 ];
+		return;
 
 	AWwiseMicPosOrient_eventEncroachedBy_Parms EncroachedBy_Parms;
 	EncroachedBy_Parms.Other = Other;
@@ -5572,10 +5339,9 @@ void AWwiseMicPosOrient::eventEncroachedBy ( class AActor* Other )
 
 bool AWwiseMicPosOrient::eventEncroachingOn ( class AActor* Other )
 {
-	static UFunction* pFnEncroachingOn = NULL;
-
+	UFunction* pFnEncroachingOn = (UFunction*) SdkBindings::Get ( 2185 );
 	if ( ! pFnEncroachingOn )
-		pFnEncroachingOn = (UFunction*) UObject::GObjObjects()->Data[ 3945 ];
+		return {};
 
 	AWwiseMicPosOrient_eventEncroachingOn_Parms EncroachingOn_Parms;
 	EncroachingOn_Parms.Other = Other;
@@ -5591,10 +5357,9 @@ bool AWwiseMicPosOrient::eventEncroachingOn ( class AActor* Other )
 
 void AWwiseMicPosOrient::eventCollisionChanged ( )
 {
-	static UFunction* pFnCollisionChanged = NULL;
-
+	UFunction* pFnCollisionChanged = (UFunction*) SdkBindings::Get ( 2184 );
 	if ( ! pFnCollisionChanged )
-		pFnCollisionChanged = (UFunction*) UObject::GObjObjects()->Data[ 3944 ];
+		return;
 
 	AWwiseMicPosOrient_eventCollisionChanged_Parms CollisionChanged_Parms;
 
@@ -5609,10 +5374,9 @@ void AWwiseMicPosOrient::eventCollisionChanged ( )
 
 class AActor* AWwiseMicPosOrient::eventSpecialHandling ( class APawn* Other )
 {
-	static UFunction* pFnSpecialHandling = NULL;
-
+	UFunction* pFnSpecialHandling = (UFunction*) SdkBindings::Get ( 2183 );
 	if ( ! pFnSpecialHandling )
-		pFnSpecialHandling = (UFunction*) UObject::GObjObjects()->Data[ 3941 ];
+		return {};
 
 	AWwiseMicPosOrient_eventSpecialHandling_Parms SpecialHandling_Parms;
 	SpecialHandling_Parms.Other = Other;
@@ -5629,10 +5393,9 @@ class AActor* AWwiseMicPosOrient::eventSpecialHandling ( class APawn* Other )
 
 void AWwiseMicPosOrient::eventDetach ( class AActor* Other )
 {
-	static UFunction* pFnDetach = NULL;
-
+	UFunction* pFnDetach = (UFunction*) SdkBindings::Get ( 2182 );
 	if ( ! pFnDetach )
-		pFnDetach = (UFunction*) UObject::GObjObjects()->Data[ 3939 ];
+		return;
 
 	AWwiseMicPosOrient_eventDetach_Parms Detach_Parms;
 	Detach_Parms.Other = Other;
@@ -5647,10 +5410,9 @@ void AWwiseMicPosOrient::eventDetach ( class AActor* Other )
 
 void AWwiseMicPosOrient::eventAttach ( class AActor* Other )
 {
-	static UFunction* pFnAttach = NULL;
-
+	UFunction* pFnAttach = (UFunction*) SdkBindings::Get ( 2181 );
 	if ( ! pFnAttach )
-		pFnAttach = (UFunction*) UObject::GObjObjects()->Data[ 3937 ];
+		return;
 
 	AWwiseMicPosOrient_eventAttach_Parms Attach_Parms;
 	Attach_Parms.Other = Other;
@@ -5664,10 +5426,9 @@ void AWwiseMicPosOrient::eventAttach ( class AActor* Other )
 
 void AWwiseMicPosOrient::eventBaseChange ( )
 {
-	static UFunction* pFnBaseChange = NULL;
-
+	UFunction* pFnBaseChange = (UFunction*) SdkBindings::Get ( 2180 );
 	if ( ! pFnBaseChange )
-		pFnBaseChange = (UFunction*) UObject::GObjObjects()->Data[ 3936 ];
+		return;
 
 	AWwiseMicPosOrient_eventBaseChange_Parms BaseChange_Parms;
 
@@ -5683,10 +5444,9 @@ void AWwiseMicPosOrient::eventBaseChange ( )
 
 void AWwiseMicPosOrient::eventBump ( class AActor* Other, class UPrimitiveComponent* OtherComp, struct FVector HitNormal )
 {
-	static UFunction* pFnBump = NULL;
-
+	UFunction* pFnBump = (UFunction*) SdkBindings::Get ( 2179 );
 	if ( ! pFnBump )
-		pFnBump = (UFunction*) UObject::GObjObjects()->Data[ 3932 ];
+		return;
 
 	AWwiseMicPosOrient_eventBump_Parms Bump_Parms;
 	Bump_Parms.Other = Other;
@@ -5703,10 +5463,9 @@ void AWwiseMicPosOrient::eventBump ( class AActor* Other, class UPrimitiveCompon
 
 void AWwiseMicPosOrient::eventUnTouch ( class AActor* Other )
 {
-	static UFunction* pFnUnTouch = NULL;
-
+	UFunction* pFnUnTouch = (UFunction*) SdkBindings::Get ( 2178 );
 	if ( ! pFnUnTouch )
-		pFnUnTouch = (UFunction*) UObject::GObjObjects()->Data[ 3930 ];
+		return;
 
 	AWwiseMicPosOrient_eventUnTouch_Parms UnTouch_Parms;
 	UnTouch_Parms.Other = Other;
@@ -5721,10 +5480,9 @@ void AWwiseMicPosOrient::eventUnTouch ( class AActor* Other )
 
 void AWwiseMicPosOrient::eventPostTouch ( class AActor* Other )
 {
-	static UFunction* pFnPostTouch = NULL;
-
+	UFunction* pFnPostTouch = (UFunction*) SdkBindings::Get ( 2177 );
 	if ( ! pFnPostTouch )
-		pFnPostTouch = (UFunction*) UObject::GObjObjects()->Data[ 3928 ];
+		return;
 
 	AWwiseMicPosOrient_eventPostTouch_Parms PostTouch_Parms;
 	PostTouch_Parms.Other = Other;
@@ -5742,10 +5500,9 @@ void AWwiseMicPosOrient::eventPostTouch ( class AActor* Other )
 
 void AWwiseMicPosOrient::eventTouch ( class AActor* Other, class UPrimitiveComponent* OtherComp, struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnTouch = NULL;
-
+	UFunction* pFnTouch = (UFunction*) SdkBindings::Get ( 2176 );
 	if ( ! pFnTouch )
-		pFnTouch = (UFunction*) UObject::GObjObjects()->Data[ 3923 ];
+		return;
 
 	AWwiseMicPosOrient_eventTouch_Parms Touch_Parms;
 	Touch_Parms.Other = Other;
@@ -5763,10 +5520,9 @@ void AWwiseMicPosOrient::eventTouch ( class AActor* Other, class UPrimitiveCompo
 
 void AWwiseMicPosOrient::eventPhysicsVolumeChange ( class APhysicsVolume* NewVolume )
 {
-	static UFunction* pFnPhysicsVolumeChange = NULL;
-
+	UFunction* pFnPhysicsVolumeChange = (UFunction*) SdkBindings::Get ( 2175 );
 	if ( ! pFnPhysicsVolumeChange )
-		pFnPhysicsVolumeChange = (UFunction*) UObject::GObjObjects()->Data[ 3921 ];
+		return;
 
 	AWwiseMicPosOrient_eventPhysicsVolumeChange_Parms PhysicsVolumeChange_Parms;
 	PhysicsVolumeChange_Parms.NewVolume = NewVolume;
@@ -5782,10 +5538,9 @@ void AWwiseMicPosOrient::eventPhysicsVolumeChange ( class APhysicsVolume* NewVol
 
 void AWwiseMicPosOrient::eventLanded ( struct FVector HitNormal, class AActor* FloorActor )
 {
-	static UFunction* pFnLanded = NULL;
-
+	UFunction* pFnLanded = (UFunction*) SdkBindings::Get ( 2174 );
 	if ( ! pFnLanded )
-		pFnLanded = (UFunction*) UObject::GObjObjects()->Data[ 3918 ];
+		return;
 
 	AWwiseMicPosOrient_eventLanded_Parms Landed_Parms;
 	memcpy ( &Landed_Parms.HitNormal, &HitNormal, 0xC );
@@ -5800,10 +5555,9 @@ void AWwiseMicPosOrient::eventLanded ( struct FVector HitNormal, class AActor* F
 
 void AWwiseMicPosOrient::eventFalling ( )
 {
-	static UFunction* pFnFalling = NULL;
-
+	UFunction* pFnFalling = (UFunction*) SdkBindings::Get ( 2173 );
 	if ( ! pFnFalling )
-		pFnFalling = (UFunction*) UObject::GObjObjects()->Data[ 3917 ];
+		return;
 
 	AWwiseMicPosOrient_eventFalling_Parms Falling_Parms;
 
@@ -5819,10 +5573,9 @@ void AWwiseMicPosOrient::eventFalling ( )
 
 void AWwiseMicPosOrient::eventHitWall ( struct FVector HitNormal, class AActor* Wall, class UPrimitiveComponent* WallComp )
 {
-	static UFunction* pFnHitWall = NULL;
-
+	UFunction* pFnHitWall = (UFunction*) SdkBindings::Get ( 2171 );
 	if ( ! pFnHitWall )
-		pFnHitWall = (UFunction*) UObject::GObjObjects()->Data[ 3912 ];
+		return;
 
 	AWwiseMicPosOrient_eventHitWall_Parms HitWall_Parms;
 	memcpy ( &HitWall_Parms.HitNormal, &HitNormal, 0xC );
@@ -5838,10 +5591,9 @@ void AWwiseMicPosOrient::eventHitWall ( struct FVector HitNormal, class AActor*
 
 void AWwiseMicPosOrient::eventTimer ( )
 {
-	static UFunction* pFnTimer = NULL;
-
+	UFunction* pFnTimer = (UFunction*) SdkBindings::Get ( 2170 );
 	if ( ! pFnTimer )
-		pFnTimer = (UFunction*) UObject::GObjObjects()->Data[ 3911 ];
+		return;
 
 	AWwiseMicPosOrient_eventTimer_Parms Timer_Parms;
 
@@ -5855,10 +5607,9 @@ void AWwiseMicPosOrient::eventTimer ( )
 
 void AWwiseMicPosOrient::eventTick ( float DeltaTime )
 {
-	static UFunction* pFnTick = NULL;
-
+	UFunction* pFnTick = (UFunction*) SdkBindings::Get ( 2169 );
 	if ( ! pFnTick )
-		pFnTick = (UFunction*) UObject::GObjObjects()->Data[ 3909 ];
+		return;
 
 	AWwiseMicPosOrient_eventTick_Parms Tick_Parms;
 	Tick_Parms.DeltaTime = DeltaTime;
@@ -5873,10 +5624,9 @@ void AWwiseMicPosOrient::eventTick ( float DeltaTime )
 
 void AWwiseMicPosOrient::eventLostChild ( class AActor* Other )
 {
-	static UFunction* pFnLostChild = NULL;
-
+	UFunction* pFnLostChild = (UFunction*) SdkBindings::Get ( 2168 );
 	if ( ! pFnLostChild )
-		pFnLostChild = (UFunction*) UObject::GObjObjects()->Data[ 3907 ];
+		return;
 
 	AWwiseMicPosOrient_eventLostChild_Parms LostChild_Parms;
 	LostChild_Parms.Other = Other;
@@ -5891,10 +5641,9 @@ void AWwiseMicPosOrient::eventLostChild ( class AActor* Other )
 
 void AWwiseMicPosOrient::eventGainedChild ( class AActor* Other )
 {
-	static UFunction* pFnGainedChild = NULL;
-
+	UFunction* pFnGainedChild = (UFunction*) SdkBindings::Get ( 2167 );
 	if ( ! pFnGainedChild )
-		pFnGainedChild = (UFunction*) UObject::GObjObjects()->Data[ 3905 ];
+		return;
 
 	AWwiseMicPosOrient_eventGainedChild_Parms GainedChild_Parms;
 	GainedChild_Parms.Other = Other;
@@ -5908,10 +5657,9 @@ void AWwiseMicPosOrient::eventGainedChild ( class AActor* Other )
 
 void AWwiseMicPosOrient::eventDestroyed ( )
 {
-	static UFunction* pFnDestroyed = NULL;
-
+	UFunction* pFnDestroyed = (UFunction*) SdkBindings::Get ( 2166 );
 	if ( ! pFnDestroyed )
-		pFnDestroyed = (UFunction*) UObject::GObjObjects()->Data[ 3904 ];
+		return;
 
 	AWwiseMicPosOrient_eventDestroyed_Parms Destroyed_Parms;
 
@@ -5925,10 +5673,9 @@ void AWwiseMicPosOrient::eventDestroyed ( )
 
 void AWwiseMicPosOrient::SetTickIsDisabled ( unsigned long bInDisabled )
 {
-	static UFunction* pFnSetTickIsDisabled = NULL;
-
+	UFunction* pFnSetTickIsDisabled = (UFunction*) SdkBindings::Get ( 2165 );
 	if ( ! pFnSetTickIsDisabled )
-		pFnSetTickIsDisabled = (UFunction*) UObject::GObjObjects()->Data[ 3902 ];
+		return;
 
 	AWwiseMicPosOrient_execSetTickIsDisabled_Parms SetTickIsDisabled_Parms;
 	SetTickIsDisabled_Parms.bInDisabled = bInDisabled;
@@ -5947,10 +5694,9 @@ void AWwiseMicPosOrient::SetTickIsDisabled ( unsigned long bInDisabled )
 
 void AWwiseMicPosOrient::SetTickGroup ( unsigned char NewTickGroup )
 {
-	static UFunction* pFnSetTickGroup = NULL;
-
+	UFunction* pFnSetTickGroup = (UFunction*) SdkBindings::Get ( 2164 );
 	if ( ! pFnSetTickGroup )
-		pFnSetTickGroup = (UFunction*) UObject::GObjObjects()->Data[ 3900 ];
+		return;
 
 	AWwiseMicPosOrient_execSetTickGroup_Parms SetTickGroup_Parms;
 	SetTickGroup_Parms.NewTickGroup = NewTickGroup;
@@ -5969,10 +5715,9 @@ void AWwiseMicPosOrient::SetTickGroup ( unsigned char NewTickGroup )
 
 void AWwiseMicPosOrient::ReattachComponent ( class UActorComponent* ComponentToReattach )
 {
-	static UFunction* pFnReattachComponent = NULL;
-
+	UFunction* pFnReattachComponent = (UFunction*) SdkBindings::Get ( 2163 );
 	if ( ! pFnReattachComponent )
-		pFnReattachComponent = (UFunction*) UObject::GObjObjects()->Data[ 3898 ];
+		return;
 
 	AWwiseMicPosOrient_execReattachComponent_Parms ReattachComponent_Parms;
 	ReattachComponent_Parms.ComponentToReattach = ComponentToReattach;
@@ -5991,10 +5736,9 @@ void AWwiseMicPosOrient::ReattachComponent ( class UActorComponent* ComponentToR
 
 void AWwiseMicPosOrient::DetachComponent ( class UActorComponent* ExComponent )
 {
-	static UFunction* pFnDetachComponent = NULL;
-
+	UFunction* pFnDetachComponent = (UFunction*) SdkBindings::Get ( 2162 );
 	if ( ! pFnDetachComponent )
-		pFnDetachComponent = (UFunction*) UObject::GObjObjects()->Data[ 3896 ];
+		return;
 
 	AWwiseMicPosOrient_execDetachComponent_Parms DetachComponent_Parms;
 	DetachComponent_Parms.ExComponent = ExComponent;
@@ -6013,10 +5757,9 @@ void AWwiseMicPosOrient::DetachComponent ( class UActorComponent* ExComponent )
 
 void AWwiseMicPosOrient::AttachComponent ( class UActorComponent* NewComponent )
 {
-	static UFunction* pFnAttachComponent = NULL;
-
+	UFunction* pFnAttachComponent = (UFunction*) SdkBindings::Get ( 2161 );
 	if ( ! pFnAttachComponent )
-		pFnAttachComponent = (UFunction*) UObject::GObjObjects()->Data[ 3894 ];
+		return;
 
 	AWwiseMicPosOrient_execAttachComponent_Parms AttachComponent_Parms;
 	AttachComponent_Parms.NewComponent = NewComponent;
@@ -6035,10 +5778,9 @@ void AWwiseMicPosOrient::AttachComponent ( class UActorComponent* NewComponent )
 
 void AWwiseMicPosOrient::UnClock ( float* Time )
 {
-	static UFunction* pFnUnClock = NULL;
-
+	UFunction* pFnUnClock = (UFunction*) SdkBindings::Get ( 2160 );
 	if ( ! pFnUnClock )
-		pFnUnClock = (UFunction*) UObject::GObjObjects()->Data[ 3892 ];
+		return;
 
 	AWwiseMicPosOrient_execUnClock_Parms UnClock_Parms;
 
@@ -6059,10 +5801,9 @@ void AWwiseMicPosOrient::UnClock ( float* Time )
 
 void AWwiseMicPosOrient::Clock ( float* Time )
 {
-	static UFunction* pFnClock = NULL;
-
+	UFunction* pFnClock = (UFunction*) SdkBindings::Get ( 2159 );
 	if ( ! pFnClock )
-		pFnClock = (UFunction*) UObject::GObjObjects()->Data[ 3890 ];
+		return;
 
 	AWwiseMicPosOrient_execClock_Parms Clock_Parms;
 
@@ -6083,10 +5824,9 @@ void AWwiseMicPosOrient::Clock ( float* Time )
 
 void AWwiseMicPosOrient::SetPhysics ( unsigned char newPhysics )
 {
-	static UFunction* pFnSetPhysics = NULL;
-
+	UFunction* pFnSetPhysics = (UFunction*) SdkBindings::Get ( 2158 );
 	if ( ! pFnSetPhysics )
-		pFnSetPhysics = (UFunction*) UObject::GObjObjects()->Data[ 3888 ];
+		return;
 
 	AWwiseMicPosOrient_execSetPhysics_Parms SetPhysics_Parms;
 	SetPhysics_Parms.newPhysics = newPhysics;
@@ -6110,10 +5850,9 @@ void AWwiseMicPosOrient::SetPhysics ( unsigned char newPhysics )
 
 void AWwiseMicPosOrient::SetOnlyOwnerSee ( unsigned long bNewOnlyOwnerSee )
 {
-	static UFunction* pFnSetOnlyOwnerSee = NULL;
-
+	UFunction* pFnSetOnlyOwnerSee = (UFunction*) SdkBindings::Get ( 2157 );
 	if ( ! pFnSetOnlyOwnerSee )
-		pFnSetOnlyOwnerSee = (UFunction*) UObject::GObjObjects()->Data[ 3886 ];
+		return;
 
 	AWwiseMicPosOrient_execSetOnlyOwnerSee_Parms SetOnlyOwnerSee_Parms;
 	SetOnlyOwnerSee_Parms.bNewOnlyOwnerSee = bNewOnlyOwnerSee;
@@ -6132,10 +5871,9 @@ void AWwiseMicPosOrient::SetOnlyOwnerSee ( unsigned long bNewOnlyOwnerSee )
 
 void AWwiseMicPosOrient::SetHidden ( unsigned long bNewHidden )
 {
-	static UFunction* pFnSetHidden = NULL;
-
+	UFunction* pFnSetHidden = (UFunction*) SdkBindings::Get ( 2156 );
 	if ( ! pFnSetHidden )
-		pFnSetHidden = (UFunction*) UObject::GObjObjects()->Data[ 3884 ];
+		return;
 
 	AWwiseMicPosOrient_execSetHidden_Parms SetHidden_Parms;
 	SetHidden_Parms.bNewHidden = bNewHidden;
@@ -6155,10 +5893,9 @@ void AWwiseMicPosOrient::SetHidden ( unsigned long bNewHidden )
 
 void AWwiseMicPosOrient::ChartData ( struct FString DataName, float DataValue )
 {
-	static UFunction* pFnChartData = NULL;
-
+	UFunction* pFnChartData = (UFunction*) SdkBindings::Get ( 2155 );
 	if ( ! pFnChartData )
-		pFnChartData = (UFunction*) UObject::GObjObjects()->Data[ 3881 ];
+		return;
 
 	AWwiseMicPosOrient_execChartData_Parms ChartData_Parms;
 	memcpy ( &ChartData_Parms.DataName, &DataName, 0xC );
@@ -6177,10 +5914,9 @@ void AWwiseMicPosOrient::ChartData ( struct FString DataName, float DataValue )
 
 void AWwiseMicPosOrient::FlushDebugStrings ( )
 {
-	static UFunction* pFnFlushDebugStrings = NULL;
-
+	UFunction* pFnFlushDebugStrings = (UFunction*) SdkBindings::Get ( 2154 );
 	if ( ! pFnFlushDebugStrings )
-		pFnFlushDebugStrings = (UFunction*) UObject::GObjObjects()->Data[ 3880 ];
+		return;
 
 	AWwiseMicPosOrient_execFlushDebugStrings_Parms FlushDebugStrings_Parms;
 
@@ -6202,10 +5938,9 @@ void AWwiseMicPosOrient::FlushDebugStrings ( )
 
 void AWwiseMicPosOrient::DrawDebugFrustrum ( unsigned char R, unsigned char G, unsigned char B, unsigned long bPersistentLines, struct FMatrix* FrustumToWorld )
 {
-	static UFunction* pFnDrawDebugFrustrum = NULL;
-
+	UFunction* pFnDrawDebugFrustrum = (UFunction*) SdkBindings::Get ( 2153 );
 	if ( ! pFnDrawDebugFrustrum )
-		pFnDrawDebugFrustrum = (UFunction*) UObject::GObjObjects()->Data[ 3874 ];
+		return;
 
 	AWwiseMicPosOrient_execDrawDebugFrustrum_Parms DrawDebugFrustrum_Parms;
 	DrawDebugFrustrum_Parms.R = R;
@@ -6234,10 +5969,9 @@ void AWwiseMicPosOrient::DrawDebugFrustrum ( unsigned char R, unsigned char G, u
 
 void AWwiseMicPosOrient::DrawDebugString ( struct FVector TextLocation, struct FString Text, class AActor* TestBaseActor, struct FColor TextColor, float Duration )
 {
-	static UFunction* pFnDrawDebugString = NULL;
-
+	UFunction* pFnDrawDebugString = (UFunction*) SdkBindings::Get ( 2152 );
 	if ( ! pFnDrawDebugString )
-		pFnDrawDebugString = (UFunction*) UObject::GObjObjects()->Data[ 3868 ];
+		return;
 
 	AWwiseMicPosOrient_execDrawDebugString_Parms DrawDebugString_Parms;
 	memcpy ( &DrawDebugString_Parms.TextLocation, &TextLocation, 0xC );
@@ -6267,10 +6001,9 @@ void AWwiseMicPosOrient::DrawDebugString ( struct FVector TextLocation, struct F
 
 void AWwiseMicPosOrient::DrawDebugCone ( struct FVector Origin, struct FVector Direction, float Length, float AngleWidth, float AngleHeight, int NumSides, struct FColor DrawColor, unsigned long bPersistentLines )
 {
-	static UFunction* pFnDrawDebugCone = NULL;
-
+	UFunction* pFnDrawDebugCone = (UFunction*) SdkBindings::Get ( 2151 );
 	if ( ! pFnDrawDebugCone )
-		pFnDrawDebugCone = (UFunction*) UObject::GObjObjects()->Data[ 3859 ];
+		return;
 
 	AWwiseMicPosOrient_execDrawDebugCone_Parms DrawDebugCone_Parms;
 	memcpy ( &DrawDebugCone_Parms.Origin, &Origin, 0xC );
@@ -6303,10 +6036,9 @@ void AWwiseMicPosOrient::DrawDebugCone ( struct FVector Origin, struct FVector D
 
 void AWwiseMicPosOrient::DrawDebugCylinder ( struct FVector Start, struct FVector End, float Radius, int Segments, unsigned char R, unsigned char G, unsigned char B, unsigned long bPersistentLines )
 {
-	static UFunction* pFnDrawDebugCylinder = NULL;
-
+	UFunction* pFnDrawDebugCylinder = (UFunction*) SdkBindings::Get ( 2150 );
 	if ( ! pFnDrawDebugCylinder )
-		pFnDrawDebugCylinder = (UFunction*) UObject::GObjObjects()->Data[ 3850 ];
+		return;
 
 	AWwiseMicPosOrient_execDrawDebugCylinder_Parms DrawDebugCylinder_Parms;
 	memcpy ( &DrawDebugCylinder_Parms.Start, &Start, 0xC );
@@ -6338,10 +6070,9 @@ void AWwiseMicPosOrient::DrawDebugCylinder ( struct FVector Start, struct FVecto
 
 void AWwiseMicPosOrient::DrawDebugSphere ( struct FVector Center, float Radius, int Segments, unsigned char R, unsigned char G, unsigned char B, unsigned long bPersistentLines )
 {
-	static UFunction* pFnDrawDebugSphere = NULL;
-
+	UFunction* pFnDrawDebugSphere = (UFunction*) SdkBindings::Get ( 2149 );
 	if ( ! pFnDrawDebugSphere )
-		pFnDrawDebugSphere = (UFunction*) UObject::GObjObjects()->Data[ 3842 ];
+		return;
 
 	AWwiseMicPosOrient_execDrawDebugSphere_Parms DrawDebugSphere_Parms;
 	memcpy ( &DrawDebugSphere_Parms.Center, &Center, 0xC );
@@ -6369,10 +6100,9 @@ void AWwiseMicPosOrient::DrawDebugSphere ( struct FVector Center, float Radius,
 
 void AWwiseMicPosOrient::DrawDebugCoordinateSystem ( struct FVector AxisLoc, struct FRotator AxisRot, float Scale, unsigned long bPersistentLines )
 {
-	static UFunction* pFnDrawDebugCoordinateSystem = NULL;
-
+	UFunction* pFnDrawDebugCoordinateSystem = (UFunction*) SdkBindings::Get ( 2148 );
 	if ( ! pFnDrawDebugCoordinateSystem )
-		pFnDrawDebugCoordinateSystem = (UFunction*) UObject::GObjObjects()->Data[ 3837 ];
+		return;
 
 	AWwiseMicPosOrient_execDrawDebugCoordinateSystem_Parms DrawDebugCoordinateSystem_Parms;
 	memcpy ( &DrawDebugCoordinateSystem_Parms.AxisLoc, &AxisLoc, 0xC );
@@ -6399,10 +6129,9 @@ void AWwiseMicPosOrient::DrawDebugCoordinateSystem ( struct FVector AxisLoc, str
 
 void AWwiseMicPosOrient::DrawDebugStar ( struct FVector Position, float Size, unsigned char R, unsigned char G, unsigned char B, unsigned long bPersistentLines )
 {
-	static UFunction* pFnDrawDebugStar = NULL;
-
+	UFunction* pFnDrawDebugStar = (UFunction*) SdkBindings::Get ( 2147 );
 	if ( ! pFnDrawDebugStar )
-		pFnDrawDebugStar = (UFunction*) UObject::GObjObjects()->Data[ 3830 ];
+		return;
 
 	AWwiseMicPosOrient_execDrawDebugStar_Parms DrawDebugStar_Parms;
 	memcpy ( &DrawDebugStar_Parms.Position, &Position, 0xC );
@@ -6431,10 +6160,9 @@ void AWwiseMicPosOrient::DrawDebugStar ( struct FVector Position, float Size, un
 
 void AWwiseMicPosOrient::DrawDebugBox ( struct FVector Center, struct FVector Extent, unsigned char R, unsigned char G, unsigned char B, unsigned long bPersistentLines )
 {
-	static UFunction* pFnDrawDebugBox = NULL;
-
+	UFunction* pFnDrawDebugBox = (UFunction*) SdkBindings::Get ( 2146 );
 	if ( ! pFnDrawDebugBox )
-		pFnDrawDebugBox = (UFunction*) UObject::GObjObjects()->Data[ 3823 ];
+		return;
 
 	AWwiseMicPosOrient_execDrawDebugBox_Parms DrawDebugBox_Parms;
 	memcpy ( &DrawDebugBox_Parms.Center, &Center, 0xC );
@@ -6461,10 +6189,9 @@ void AWwiseMicPosOrient::DrawDebugBox ( struct FVector Center, struct FVector Ex
 
 void AWwiseMicPosOrient::DrawDebugPoint ( struct FVector Position, float Size, struct FLinearColor PointColor, unsigned long bPersistentLines )
 {
-	static UFunction* pFnDrawDebugPoint = NULL;
-
+	UFunction* pFnDrawDebugPoint = (UFunction*) SdkBindings::Get ( 2145 );
 	if ( ! pFnDrawDebugPoint )
-		pFnDrawDebugPoint = (UFunction*) UObject::GObjObjects()->Data[ 3818 ];
+		return;
 
 	AWwiseMicPosOrient_execDrawDebugPoint_Parms DrawDebugPoint_Parms;
 	memcpy ( &DrawDebugPoint_Parms.Position, &Position, 0xC );
@@ -6491,10 +6218,9 @@ void AWwiseMicPosOrient::DrawDebugPoint ( struct FVector Position, float Size, s
 
 void AWwiseMicPosOrient::DrawDebugLine ( struct FVector LineStart, struct FVector LineEnd, unsigned char R, unsigned char G, unsigned char B, unsigned long bPersistentLines )
 {
-	static UFunction* pFnDrawDebugLine = NULL;
-
+	UFunction* pFnDrawDebugLine = (UFunction*) SdkBindings::Get ( 2144 );
 	if ( ! pFnDrawDebugLine )
-		pFnDrawDebugLine = (UFunction*) UObject::GObjObjects()->Data[ 3811 ];
+		return;
 
 	AWwiseMicPosOrient_execDrawDebugLine_Parms DrawDebugLine_Parms;
 	memcpy ( &DrawDebugLine_Parms.LineStart, &LineStart, 0xC );
@@ -6517,10 +6243,9 @@ void AWwiseMicPosOrient::DrawDebugLine ( struct FVector LineStart, struct FVecto
 
 void AWwiseMicPosOrient::FlushPersistentDebugLines ( )
 {
-	static UFunction* pFnFlushPersistentDebugLines = NULL;
-
+	UFunction* pFnFlushPersistentDebugLines = (UFunction*) SdkBindings::Get ( 2143 );
 	if ( ! pFnFlushPersistentDebugLines )
-		pFnFlushPersistentDebugLines = (UFunction*) UObject::GObjObjects()->Data[ 3810 ];
+		return;
 
 	AWwiseMicPosOrient_execFlushPersistentDebugLines_Parms FlushPersistentDebugLines_Parms;
 
@@ -6539,10 +6264,9 @@ void AWwiseMicPosOrient::FlushPersistentDebugLines ( )
 
 struct FVector AWwiseMicPosOrient::GetBasedPosition ( struct FBasedPosition BP )
 {
-	static UFunction* pFnGetBasedPosition = NULL;
-
+	UFunction* pFnGetBasedPosition = (UFunction*) SdkBindings::Get ( 2142 );
 	if ( ! pFnGetBasedPosition )
-		pFnGetBasedPosition = (UFunction*) UObject::GObjObjects()->Data[ 3807 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetBasedPosition_Parms GetBasedPosition_Parms;
 	memcpy ( &GetBasedPosition_Parms.BP, &BP, 0x34 );
@@ -6565,10 +6289,9 @@ struct FVector AWwiseMicPosOrient::GetBasedPosition ( struct FBasedPosition BP )
 
 void AWwiseMicPosOrient::SetBasedPosition ( struct FVector pos, class AActor* ForcedBase, struct FBasedPosition* BP )
 {
-	static UFunction* pFnSetBasedPosition = NULL;
-
+	UFunction* pFnSetBasedPosition = (UFunction*) SdkBindings::Get ( 2141 );
 	if ( ! pFnSetBasedPosition )
-		pFnSetBasedPosition = (UFunction*) UObject::GObjObjects()->Data[ 3803 ];
+		return;
 
 	AWwiseMicPosOrient_execSetBasedPosition_Parms SetBasedPosition_Parms;
 	memcpy ( &SetBasedPosition_Parms.pos, &pos, 0xC );
@@ -6592,10 +6315,9 @@ void AWwiseMicPosOrient::SetBasedPosition ( struct FVector pos, class AActor* Fo
 
 struct FVector AWwiseMicPosOrient::BP2Vect ( struct FBasedPosition BP )
 {
-	static UFunction* pFnBP2Vect = NULL;
-
+	UFunction* pFnBP2Vect = (UFunction*) SdkBindings::Get ( 2140 );
 	if ( ! pFnBP2Vect )
-		pFnBP2Vect = (UFunction*) UObject::GObjObjects()->Data[ 3800 ];
+		return {};
 
 	AWwiseMicPosOrient_execBP2Vect_Parms BP2Vect_Parms;
 	memcpy ( &BP2Vect_Parms.BP, &BP, 0x34 );
@@ -6618,10 +6340,9 @@ struct FVector AWwiseMicPosOrient::BP2Vect ( struct FBasedPosition BP )
 
 void AWwiseMicPosOrient::Vect2BP ( struct FVector pos, class AActor* ForcedBase, struct FBasedPosition* BP )
 {
-	static UFunction* pFnVect2BP = NULL;
-
+	UFunction* pFnVect2BP = (UFunction*) SdkBindings::Get ( 2139 );
 	if ( ! pFnVect2BP )
-		pFnVect2BP = (UFunction*) UObject::GObjObjects()->Data[ 3790 ];
+		return;
 
 	AWwiseMicPosOrient_execVect2BP_Parms Vect2BP_Parms;
 	memcpy ( &Vect2BP_Parms.pos, &pos, 0xC );
@@ -6645,10 +6366,9 @@ void AWwiseMicPosOrient::Vect2BP ( struct FVector pos, class AActor* ForcedBase,
 
 void AWwiseMicPosOrient::SetForcedInitialReplicatedProperty ( class UProperty* PropToReplicate, unsigned long bAdd )
 {
-	static UFunction* pFnSetForcedInitialReplicatedProperty = NULL;
-
+	UFunction* pFnSetForcedInitialReplicatedProperty = (UFunction*) SdkBindings::Get ( 2138 );
 	if ( ! pFnSetForcedInitialReplicatedProperty )
-		pFnSetForcedInitialReplicatedProperty = (UFunction*) UObject::GObjObjects()->Data[ 3787 ];
+		return;
 
 	AWwiseMicPosOrient_execSetForcedInitialReplicatedProperty_Parms SetForcedInitialReplicatedProperty_Parms;
 	SetForcedInitialReplicatedProperty_Parms.PropToReplicate = PropToReplicate;
@@ -6668,10 +6388,9 @@ void AWwiseMicPosOrient::SetForcedInitialReplicatedProperty ( class UProperty* P
 
 void AWwiseMicPosOrient::eventReplicatedDataBinding ( struct FName VarName )
 {
-	static UFunction* pFnReplicatedDataBinding = NULL;
-
+	UFunction* pFnReplicatedDataBinding = (UFunction*) SdkBindings::Get ( 2137 );
 	if ( ! pFnReplicatedDataBinding )
-		pFnReplicatedDataBinding = (UFunction*) UObject::GObjObjects()->Data[ 3785 ];
+		return;
 
 	AWwiseMicPosOrient_eventReplicatedDataBinding_Parms ReplicatedDataBinding_Parms;
 	memcpy ( &ReplicatedDataBinding_Parms.VarName, &VarName, 0x8 );
@@ -6686,10 +6405,9 @@ void AWwiseMicPosOrient::eventReplicatedDataBinding ( struct FName VarName )
 
 void AWwiseMicPosOrient::eventReplicatedEvent ( struct FName VarName )
 {
-	static UFunction* pFnReplicatedEvent = NULL;
-
+	UFunction* pFnReplicatedEvent = (UFunction*) SdkBindings::Get ( 2136 );
 	if ( ! pFnReplicatedEvent )
-		pFnReplicatedEvent = (UFunction*) UObject::GObjObjects()->Data[ 3783 ];
+		return;
 
 	AWwiseMicPosOrient_eventReplicatedEvent_Parms ReplicatedEvent_Parms;
 	memcpy ( &ReplicatedEvent_Parms.VarName, &VarName, 0x8 );
@@ -6705,10 +6423,9 @@ void AWwiseMicPosOrient::eventReplicatedEvent ( struct FName VarName )
 
 bool AWwiseMicPosOrient::IsOwnedBy ( class AActor* TestActor )
 {
-	static UFunction* pFnIsOwnedBy = NULL;
-
+	UFunction* pFnIsOwnedBy = (UFunction*) SdkBindings::Get ( 2135 );
 	if ( ! pFnIsOwnedBy )
-		pFnIsOwnedBy = (UFunction*) UObject::GObjObjects()->Data[ 3780 ];
+		return {};
 
 	AWwiseMicPosOrient_execIsOwnedBy_Parms IsOwnedBy_Parms;
 	IsOwnedBy_Parms.TestActor = TestActor;
@@ -6729,10 +6446,9 @@ bool AWwiseMicPosOrient::IsOwnedBy ( class AActor* TestActor )
 
 class AActor* AWwiseMicPosOrient::GetBaseMost ( )
 {
-	static UFunction* pFnGetBaseMost = NULL;
-
+	UFunction* pFnGetBaseMost = (UFunction*) SdkBindings::Get ( 2134 );
 	if ( ! pFnGetBaseMost )
-		pFnGetBaseMost = (UFunction*) UObject::GObjObjects()->Data[ 3778 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetBaseMost_Parms GetBaseMost_Parms;
 
@@ -6753,10 +6469,9 @@ class AActor* AWwiseMicPosOrient::GetBaseMost ( )
 
 bool AWwiseMicPosOrient::IsBasedOn ( class AActor* TestActor )
 {
-	static UFunction* pFnIsBasedOn = NULL;
-
+	UFunction* pFnIsBasedOn = (UFunction*) SdkBindings::Get ( 2133 );
 	if ( ! pFnIsBasedOn )
-		pFnIsBasedOn = (UFunction*) UObject::GObjObjects()->Data[ 3775 ];
+		return {};
 
 	AWwiseMicPosOrient_execIsBasedOn_Parms IsBasedOn_Parms;
 	IsBasedOn_Parms.TestActor = TestActor;
@@ -6776,10 +6491,9 @@ bool AWwiseMicPosOrient::IsBasedOn ( class AActor* TestActor )
 
 void AWwiseMicPosOrient::FindBase ( )
 {
-	static UFunction* pFnFindBase = NULL;
-
+	UFunction* pFnFindBase = (UFunction*) SdkBindings::Get ( 2132 );
 	if ( ! pFnFindBase )
-		pFnFindBase = (UFunction*) UObject::GObjObjects()->Data[ 3774 ];
+		return;
 
 	AWwiseMicPosOrient_execFindBase_Parms FindBase_Parms;
 
@@ -6797,10 +6511,9 @@ void AWwiseMicPosOrient::FindBase ( )
 
 void AWwiseMicPosOrient::SetOwner ( class AActor* NewOwner )
 {
-	static UFunction* pFnSetOwner = NULL;
-
+	UFunction* pFnSetOwner = (UFunction*) SdkBindings::Get ( 2131 );
 	if ( ! pFnSetOwner )
-		pFnSetOwner = (UFunction*) UObject::GObjObjects()->Data[ 3772 ];
+		return;
 
 	AWwiseMicPosOrient_execSetOwner_Parms SetOwner_Parms;
 	SetOwner_Parms.NewOwner = NewOwner;
@@ -6827,10 +6540,9 @@ void AWwiseMicPosOrient::SetOwner ( class AActor* NewOwner )
 
 void AWwiseMicPosOrient::SetBase ( class AActor* NewBase, struct FVector NewFloor, class USkeletalMeshComponent* SkelComp, struct FName AttachName )
 {
-	static UFunction* pFnSetBase = NULL;
-
+	UFunction* pFnSetBase = (UFunction*) SdkBindings::Get ( 2130 );
 	if ( ! pFnSetBase )
-		pFnSetBase = (UFunction*) UObject::GObjObjects()->Data[ 3767 ];
+		return;
 
 	AWwiseMicPosOrient_execSetBase_Parms SetBase_Parms;
 	SetBase_Parms.NewBase = NewBase;
@@ -6857,10 +6569,9 @@ void AWwiseMicPosOrient::SetBase ( class AActor* NewBase, struct FVector NewFloo
 
 float AWwiseMicPosOrient::GetTerminalVelocity ( )
 {
-	static UFunction* pFnGetTerminalVelocity = NULL;
-
+	UFunction* pFnGetTerminalVelocity = (UFunction*) SdkBindings::Get ( 2129 );
 	if ( ! pFnGetTerminalVelocity )
-		pFnGetTerminalVelocity = (UFunction*) UObject::GObjObjects()->Data[ 3765 ];
+		return {};
 
 	AWwiseMicPosOrient_execGetTerminalVelocity_Parms GetTerminalVelocity_Parms;
 
@@ -6880,10 +6591,9 @@ float AWwiseMicPosOrient::GetTerminalVelocity ( )
 
 void AWwiseMicPosOrient::AutonomousPhysics ( float DeltaSeconds )
 {
-	static UFunction* pFnAutonomousPhysics = NULL;
-
+	UFunction* pFnAutonomousPhysics = (UFunction*) SdkBindings::Get ( 2128 );
 	if ( ! pFnAutonomousPhysics )
-		pFnAutonomousPhysics = (UFunction*) UObject::GObjObjects()->Data[ 3763 ];
+		return;
 
 	AWwiseMicPosOrient_execAutonomousPhysics_Parms AutonomousPhysics_Parms;
 	AutonomousPhysics_Parms.DeltaSeconds = DeltaSeconds;
@@ -6908,10 +6618,9 @@ void AWwiseMicPosOrient::AutonomousPhysics ( float DeltaSeconds )
 
 bool AWwiseMicPosOrient::MoveSmooth ( struct FVector Delta )
 {
-	static UFunction* pFnMoveSmooth = NULL;
-
+	UFunction* pFnMoveSmooth = (UFunction*) SdkBindings::Get ( 2127 );
 	if ( ! pFnMoveSmooth )
-		pFnMoveSmooth = (UFunction*) UObject::GObjObjects()->Data[ 3760 ];
+		return {};
 
 	AWwiseMicPosOrient_execMoveSmooth_Parms MoveSmooth_Parms;
 	memcpy ( &MoveSmooth_Parms.Delta, &Delta, 0xC );
@@ -6940,10 +6649,9 @@ bool AWwiseMicPosOrient::MoveSmooth ( struct FVector Delta )
 
 int AWwiseMicPosOrient::fixedTurn ( int Current, int Desired, int DeltaRate )
 {
-	static UFunction* pFnfixedTurn = NULL;
-
+	UFunction* pFnfixedTurn = (UFunction*) SdkBindings::Get ( 2126 );
 	if ( ! pFnfixedTurn )
-		pFnfixedTurn = (UFunction*) UObject::GObjObjects()->Data[ 3755 ];
+		return {};
 
 	AWwiseMicPosOrient_execfixedTurn_Parms fixedTurn_Parms;
 	fixedTurn_Parms.Current = Current;
@@ -6966,10 +6674,9 @@ int AWwiseMicPosOrient::fixedTurn ( int Current, int Desired, int DeltaRate )
 
 void AWwiseMicPosOrient::SetHardAttach ( unsigned long bNewHardAttach )
 {
-	static UFunction* pFnSetHardAttach = NULL;
-
+	UFunction* pFnSetHardAttach = (UFunction*) SdkBindings::Get ( 2125 );
 	if ( ! pFnSetHardAttach )
-		pFnSetHardAttach = (UFunction*) UObject::GObjObjects()->Data[ 3753 ];
+		return;
 
 	AWwiseMicPosOrient_execSetHardAttach_Parms SetHardAttach_Parms;
 	SetHardAttach_Parms.bNewHardAttach = bNewHardAttach;
@@ -6989,10 +6696,9 @@ void AWwiseMicPosOrient::SetHardAttach ( unsigned long bNewHardAttach )
 
 bool AWwiseMicPosOrient::SetRelativeLocation ( struct FVector NewLocation )
 {
-	static UFunction* pFnSetRelativeLocation = NULL;
-
+	UFunction* pFnSetRelativeLocation = (UFunction*) SdkBindings::Get ( 2124 );
 	if ( ! pFnSetRelativeLocation )
-		pFnSetRelativeLocation = (UFunction*) UObject::GObjObjects()->Data[ 3750 ];
+		return {};
 
 	AWwiseMicPosOrient_execSetRelativeLocation_Parms SetRelativeLocation_Parms;
 	memcpy ( &SetRelativeLocation_Parms.NewLocation, &NewLocation, 0xC );
@@ -7014,10 +6720,9 @@ bool AWwiseMicPosOrient::SetRelativeLocation ( struct FVector NewLocation )
 
 bool AWwiseMicPosOrient::SetRelativeRotation ( struct FRotator NewRotation )
 {
-	static UFunction* pFnSetRelativeRotation = NULL;
-
+	UFunction* pFnSetRelativeRotation = (UFunction*) SdkBindings::Get ( 2123 );
 	if ( ! pFnSetRelativeRotation )
-		pFnSetRelativeRotation = (UFunction*) UObject::GObjObjects()->Data[ 3747 ];
+		return {};
 
 	AWwiseMicPosOrient_execSetRelativeRotation_Parms SetRelativeRotation_Parms;
 	memcpy ( &SetRelativeRotation_Parms.NewRotation, &NewRotation, 0xC );
@@ -7038,10 +6743,9 @@ bool AWwiseMicPosOrient::SetRelativeRotation ( struct FRotator NewRotation )
 
 void AWwiseMicPosOrient::SetZone ( unsigned long bForceRefresh )
 {
-	static UFunction* pFnSetZone = NULL;
-
+	UFunction* pFnSetZone = (UFunction*) SdkBindings::Get ( 2122 );
 	if ( ! pFnSetZone )
-		pFnSetZone = (UFunction*) UObject::GObjObjects()->Data[ 3745 ];
+		return;
 
 	AWwiseMicPosOrient_execSetZone_Parms SetZone_Parms;
 	SetZone_Parms.bForceRefresh = bForceRefresh;
@@ -7061,10 +6765,9 @@ void AWwiseMicPosOrient::SetZone ( unsigned long bForceRefresh )
 
 unsigned char AWwiseMicPosOrient::MovingWhichWay ( float* Amount )
 {
-	static UFunction* pFnMovingWhichWay = NULL;
-
+	UFunction* pFnMovingWhichWay = (UFunction*) SdkBindings::Get ( 2121 );
 	if ( ! pFnMovingWhichWay )
-		pFnMovingWhichWay = (UFunction*) UObject::GObjObjects()->Data[ 3742 ];
+		return {};
 
 	AWwiseMicPosOrient_execMovingWhichWay_Parms MovingWhichWay_Parms;
 
@@ -7088,10 +6791,9 @@ unsigned char AWwiseMicPosOrient::MovingWhichWay ( float* Amount )
 
 bool AWwiseMicPosOrient::SetRotation ( struct FRotator NewRotation )
 {
-	static UFunction* pFnSetRotation = NULL;
-
+	UFunction* pFnSetRotation = (UFunction*) SdkBindings::Get ( 2120 );
 	if ( ! pFnSetRotation )
-		pFnSetRotation = (UFunction*) UObject::GObjObjects()->Data[ 3739 ];
+		return {};
 
 	AWwiseMicPosOrient_execSetRotation_Parms SetRotation_Parms;
 	memcpy ( &SetRotation_Parms.NewRotation, &NewRotation, 0xC );
@@ -7119,10 +6821,9 @@ bool AWwiseMicPosOrient::SetRotation ( struct FRotator NewRotation )
 
 bool AWwiseMicPosOrient::SetLocation ( struct FVector NewLocation, unsigned long bDebugFailure )
 {
-	static UFunction* pFnSetLocation = NULL;
-
+	UFunction* pFnSetLocation = (UFunction*) SdkBindings::Get ( 2119 );
 	if ( ! pFnSetLocation )
-		pFnSetLocation = (UFunction*) UObject::GObjObjects()->Data[ 3735 ];
+		return {};
 
 	AWwiseMicPosOrient_execSetLocation_Parms SetLocation_Parms;
 	memcpy ( &SetLocation_Parms.NewLocation, &NewLocation, 0xC );
@@ -7150,10 +6851,9 @@ bool AWwiseMicPosOrient::SetLocation ( struct FVector NewLocation, unsigned long
 
 bool AWwiseMicPosOrient::Move ( struct FVector Delta )
 {
-	static UFunction* pFnMove = NULL;
-
+	UFunction* pFnMove = (UFunction*) SdkBindings::Get ( 2118 );
 	if ( ! pFnMove )
-		pFnMove = (UFunction*) UObject::GObjObjects()->Data[ 3732 ];
+		return {};
 
 	AWwiseMicPosOrient_execMove_Parms Move_Parms;
 	memcpy ( &Move_Parms.Delta, &Delta, 0xC );
@@ -7179,10 +6879,9 @@ bool AWwiseMicPosOrient::Move ( struct FVector Delta )
 
 void AWwiseMicPosOrient::SetDrawScale3D ( struct FVector NewScale3D )
 {
-	static UFunction* pFnSetDrawScale3D = NULL;
-
+	UFunction* pFnSetDrawScale3D = (UFunction*) SdkBindings::Get ( 2117 );
 	if ( ! pFnSetDrawScale3D )
-		pFnSetDrawScale3D = (UFunction*) UObject::GObjObjects()->Data[ 3730 ];
+		return;
 
 	AWwiseMicPosOrient_execSetDrawScale3D_Parms SetDrawScale3D_Parms;
 	memcpy ( &SetDrawScale3D_Parms.NewScale3D, &NewScale3D, 0xC );
@@ -7201,10 +6900,9 @@ void AWwiseMicPosOrient::SetDrawScale3D ( struct FVector NewScale3D )
 
 void AWwiseMicPosOrient::SetDrawScale ( float NewScale )
 {
-	static UFunction* pFnSetDrawScale = NULL;
-
+	UFunction* pFnSetDrawScale = (UFunction*) SdkBindings::Get ( 2116 );
 	if ( ! pFnSetDrawScale )
-		pFnSetDrawScale = (UFunction*) UObject::GObjObjects()->Data[ 3728 ];
+		return;
 
 	AWwiseMicPosOrient_execSetDrawScale_Parms SetDrawScale_Parms;
 	SetDrawScale_Parms.NewScale = NewScale;
@@ -7223,10 +6921,9 @@ void AWwiseMicPosOrient::SetDrawScale ( float NewScale )
 
 void AWwiseMicPosOrient::SetCollisionType ( unsigned char NewCollisionType )
 {
-	static UFunction* pFnSetCollisionType = NULL;
-
+	UFunction* pFnSetCollisionType = (UFunction*) SdkBindings::Get ( 2115 );
 	if ( ! pFnSetCollisionType )
-		pFnSetCollisionType = (UFunction*) UObject::GObjObjects()->Data[ 3726 ];
+		return;
 
 	AWwiseMicPosOrient_execSetCollisionType_Parms SetCollisionType_Parms;
 	SetCollisionType_Parms.NewCollisionType = NewCollisionType;
@@ -7246,10 +6943,9 @@ void AWwiseMicPosOrient::SetCollisionType ( unsigned char NewCollisionType )
 
 void AWwiseMicPosOrient::SetCollisionSize ( float NewRadius, float NewHeight )
 {
-	static UFunction* pFnSetCollisionSize = NULL;
-
+	UFunction* pFnSetCollisionSize = (UFunction*) SdkBindings::Get ( 2114 );
 	if ( ! pFnSetCollisionSize )
-		pFnSetCollisionSize = (UFunction*) UObject::GObjObjects()->Data[ 3723 ];
+		return;
 
 	AWwiseMicPosOrient_execSetCollisionSize_Parms SetCollisionSize_Parms;
 	SetCollisionSize_Parms.NewRadius = NewRadius;
@@ -7276,10 +6972,9 @@ void AWwiseMicPosOrient::SetCollisionSize ( float NewRadius, float NewHeight )
 
 void AWwiseMicPosOrient::SetCollision ( unsigned long bNewColActors, unsigned long bNewBlockActors, unsigned long bNewIgnoreEncroachers )
 {
-	static UFunction* pFnSetCollision = NULL;
-
+	UFunction* pFnSetCollision = (UFunction*) SdkBindings::Get ( 2113 );
 	if ( ! pFnSetCollision )
-		pFnSetCollision = (UFunction*) UObject::GObjObjects()->Data[ 3719 ];
+		return;
 
 	AWwiseMicPosOrient_execSetCollision_Parms SetCollision_Parms;
 	SetCollision_Parms.bNewColActors = bNewColActors;
@@ -7305,10 +7000,9 @@ void AWwiseMicPosOrient::SetCollision ( unsigned long bNewColActors, unsigned lo
 
 void AWwiseMicPosOrient::FinishAnim ( class UAnimNodeSequence* SeqNode )
 {
-	static UFunction* pFnFinishAnim = NULL;
-
+	UFunction* pFnFinishAnim = (UFunction*) SdkBindings::Get ( 2112 );
 	if ( ! pFnFinishAnim )
-		pFnFinishAnim = (UFunction*) UObject::GObjObjects()->Data[ 3717 ];
+		return;
 
 	AWwiseMicPosOrient_execFinishAnim_Parms FinishAnim_Parms;
 	FinishAnim_Parms.SeqNode = SeqNode;
@@ -7332,10 +7026,9 @@ void AWwiseMicPosOrient::FinishAnim ( class UAnimNodeSequence* SeqNode )
 
 void AWwiseMicPosOrient::Sleep ( float Seconds )
 {
-	static UFunction* pFnSleep = NULL;
-
+	UFunction* pFnSleep = (UFunction*) SdkBindings::Get ( 2111 );
 	if ( ! pFnSleep )
-		pFnSleep = (UFunction*) UObject::GObjObjects()->Data[ 3715 ];
+		return;
 
 	AWwiseMicPosOrient_execSleep_Parms Sleep_Parms;
 	Sleep_Parms.Seconds = Seconds;
@@ -7361,10 +7054,9 @@ void AWwiseMicPosOrient::Sleep ( float Seconds )
 
 struct FString AWwiseMicPosOrient::ConsoleCommand ( struct FString Command, unsigned long bWriteToLog )
 {
-	static UFunction* pFnConsoleCommand = NULL;
-
+	UFunction* pFnConsoleCommand = (UFunction*) SdkBindings::Get ( 2110 );
 	if ( ! pFnConsoleCommand )
-		pFnConsoleCommand = (UFunction*) UObject::GObjObjects()->Data[ 3711 ];
+		return {};
 
 	AWwiseMicPosOrient_execConsoleCommand_Parms ConsoleCommand_Parms;
 	memcpy ( &ConsoleCommand_Parms.Command, &Command, 0xC );
@@ -7387,10 +7079,9 @@ struct FString AWwiseMicPosOrient::ConsoleCommand ( struct FString Command, unsi
 
 void AWwiseMicPosOrient::ForceUpdateComponents ( unsigned long bCollisionUpdate, unsigned long bTransformOnly )
 {
-	static UFunction* pFnForceUpdateComponents = NULL;
-
+	UFunction* pFnForceUpdateComponents = (UFunction*) SdkBindings::Get ( 2109 );
 	if ( ! pFnForceUpdateComponents )
-		pFnForceUpdateComponents = (UFunction*) UObject::GObjObjects()->Data[ 3708 ];
+		return;
 
 	AWwiseMicPosOrient_execForceUpdateComponents_Parms ForceUpdateComponents_Parms;
 	ForceUpdateComponents_Parms.bCollisionUpdate = bCollisionUpdate;
@@ -7410,10 +7101,9 @@ void AWwiseMicPosOrient::ForceUpdateComponents ( unsigned long bCollisionUpdate,
 
 int UWwiseProcFoleyComponent::eventGetMAX_PROC_FOLEY_BONES ( )
 {
-	static UFunction* pFnGetMAX_PROC_FOLEY_BONES = NULL;
-
+	UFunction* pFnGetMAX_PROC_FOLEY_BONES = (UFunction*) SdkBindings::Get ( 2990 );
 	if ( ! pFnGetMAX_PROC_FOLEY_BONES )
-		pFnGetMAX_PROC_FOLEY_BONES = (UFunction*) UObject::GObjObjects()->Data[ 35324 ];
+		return {};
 
 	UWwiseProcFoleyComponent_eventGetMAX_PROC_FOLEY_BONES_Parms GetMAX_PROC_FOLEY_BONES_Parms;
 
@@ -7429,10 +7119,9 @@ int UWwiseProcFoleyComponent::eventGetMAX_PROC_FOLEY_BONES ( )
 
 void AWwiseVolume::TimerPop ( class AWwiseVolumeTimer* T )
 {
-	static UFunction* pFnTimerPop = NULL;
-
+	UFunction* pFnTimerPop = (UFunction*) SdkBindings::Get ( 2971 );
 	if ( ! pFnTimerPop )
-		pFnTimerPop = (UFunction*) UObject::GObjObjects()->Data[ 35182 ];
+		return;
 
 	AWwiseVolume_execTimerPop_Parms TimerPop_Parms;
 	TimerPop_Parms.T = T;
@@ -7446,10 +7135,9 @@ void AWwiseVolume::TimerPop ( class AWwiseVolumeTimer* T )
 
 void AWwiseVolume::PostBeginPlay ( )
 {
-	static UFunction* pFnPostBeginPlay = NULL;
-
+	UFunction* pFnPostBeginPlay = (UFunction*) SdkBindings::Get ( 2970 );
 	if ( ! pFnPostBeginPlay )
-		pFnPostBeginPlay = (UFunction*) UObject::GObjObjects()->Data[ 35179 ];
+		return;
 
 	AWwiseVolume_execPostBeginPlay_Parms PostBeginPlay_Parms;
 
@@ -7462,10 +7150,9 @@ void AWwiseVolume::PostBeginPlay ( )
 
 void AWwiseAudioVolume::HideVolume ( )
 {
-	static UFunction* pFnHideVolume = NULL;
-
+	UFunction* pFnHideVolume = (UFunction*) SdkBindings::Get ( 2978 );
 	if ( ! pFnHideVolume )
-		pFnHideVolume = (UFunction*) UObject::GObjObjects()->Data[ 35195 ];
+		return;
 
 	AWwiseAudioVolume_execHideVolume_Parms HideVolume_Parms;
 
@@ -7482,10 +7169,9 @@ void AWwiseAudioVolume::HideVolume ( )
 
 void AWwiseAudioVolume::DrawVolume ( )
 {
-	static UFunction* pFnDrawVolume = NULL;
-
+	UFunction* pFnDrawVolume = (UFunction*) SdkBindings::Get ( 2977 );
 	if ( ! pFnDrawVolume )
-		pFnDrawVolume = (UFunction*) UObject::GObjObjects()->Data[ 35194 ];
+		return;
 
 	AWwiseAudioVolume_execDrawVolume_Parms DrawVolume_Parms;
 
@@ -7502,10 +7188,9 @@ void AWwiseAudioVolume::DrawVolume ( )
 
 void AWwiseAudioVolume::Stop ( )
 {
-	static UFunction* pFnStop = NULL;
-
+	UFunction* pFnStop = (UFunction*) SdkBindings::Get ( 2976 );
 	if ( ! pFnStop )
-		pFnStop = (UFunction*) UObject::GObjObjects()->Data[ 35193 ];
+		return;
 
 	AWwiseAudioVolume_execStop_Parms Stop_Parms;
 
@@ -7522,10 +7207,9 @@ void AWwiseAudioVolume::Stop ( )
 
 void AWwiseAudioVolume::Start ( )
 {
-	static UFunction* pFnStart = NULL;
-
+	UFunction* pFnStart = (UFunction*) SdkBindings::Get ( 2975 );
 	if ( ! pFnStart )
-		pFnStart = (UFunction*) UObject::GObjObjects()->Data[ 35192 ];
+		return;
 
 	AWwiseAudioVolume_execStart_Parms Start_Parms;
 
@@ -7542,10 +7226,9 @@ void AWwiseAudioVolume::Start ( )
 
 void AWwiseAudioVolume::myTimerPop ( )
 {
-	static UFunction* pFnmyTimerPop = NULL;
-
+	UFunction* pFnmyTimerPop = (UFunction*) SdkBindings::Get ( 2974 );
 	if ( ! pFnmyTimerPop )
-		pFnmyTimerPop = (UFunction*) UObject::GObjObjects()->Data[ 35191 ];
+		return;
 
 	AWwiseAudioVolume_execmyTimerPop_Parms myTimerPop_Parms;
 
@@ -7563,10 +7246,9 @@ void AWwiseAudioVolume::myTimerPop ( )
 
 void AWwiseAudioVolume::TimerPop ( class AWwiseVolumeTimer* T )
 {
-	static UFunction* pFnTimerPop = NULL;
-
+	UFunction* pFnTimerPop = (UFunction*) SdkBindings::Get ( 2973 );
 	if ( ! pFnTimerPop )
-		pFnTimerPop = (UFunction*) UObject::GObjObjects()->Data[ 35189 ];
+		return;
 
 	AWwiseAudioVolume_execTimerPop_Parms TimerPop_Parms;
 	TimerPop_Parms.T = T;
@@ -7580,10 +7262,9 @@ void AWwiseAudioVolume::TimerPop ( class AWwiseVolumeTimer* T )
 
 void AWwiseAudioVolume::PostBeginPlay ( )
 {
-	static UFunction* pFnPostBeginPlay = NULL;
-
+	UFunction* pFnPostBeginPlay = (UFunction*) SdkBindings::Get ( 2972 );
 	if ( ! pFnPostBeginPlay )
-		pFnPostBeginPlay = (UFunction*) UObject::GObjObjects()->Data[ 35187 ];
+		return;
 
 	AWwiseAudioVolume_execPostBeginPlay_Parms PostBeginPlay_Parms;
 
@@ -7596,10 +7277,9 @@ void AWwiseAudioVolume::PostBeginPlay ( )
 
 void AWwiseMusicVolume::myTimerPop ( )
 {
-	static UFunction* pFnmyTimerPop = NULL;
-
+	UFunction* pFnmyTimerPop = (UFunction*) SdkBindings::Get ( 2983 );
 	if ( ! pFnmyTimerPop )
-		pFnmyTimerPop = (UFunction*) UObject::GObjObjects()->Data[ 35298 ];
+		return;
 
 	AWwiseMusicVolume_execmyTimerPop_Parms myTimerPop_Parms;
 
@@ -7617,10 +7297,9 @@ void AWwiseMusicVolume::myTimerPop ( )
 
 void AWwiseMusicVolume::SetContainsPlayer ( unsigned long bContainsPlayer )
 {
-	static UFunction* pFnSetContainsPlayer = NULL;
-
+	UFunction* pFnSetContainsPlayer = (UFunction*) SdkBindings::Get ( 2988 );
 	if ( ! pFnSetContainsPlayer )
-		pFnSetContainsPlayer = (UFunction*) UObject::GObjObjects()->Data[ 35305 ];
+		return;
 
 	AWwiseMusicVolume_execSetContainsPlayer_Parms SetContainsPlayer_Parms;
 	SetContainsPlayer_Parms.bContainsPlayer = bContainsPlayer;
@@ -7639,10 +7318,9 @@ void AWwiseMusicVolume::SetContainsPlayer ( unsigned long bContainsPlayer )
 
 void AWwiseMusicVolume::SetEnabled ( unsigned long bEnabled )
 {
-	static UFunction* pFnSetEnabled = NULL;
-
+	UFunction* pFnSetEnabled = (UFunction*) SdkBindings::Get ( 2987 );
 	if ( ! pFnSetEnabled )
-		pFnSetEnabled = (UFunction*) UObject::GObjObjects()->Data[ 35303 ];
+		return;
 
 	AWwiseMusicVolume_execSetEnabled_Parms SetEnabled_Parms;
 	SetEnabled_Parms.bEnabled = bEnabled;
@@ -7660,10 +7338,9 @@ void AWwiseMusicVolume::SetEnabled ( unsigned long bEnabled )
 
 void AWwiseMusicVolume::StopMusic ( )
 {
-	static UFunction* pFnStopMusic = NULL;
-
+	UFunction* pFnStopMusic = (UFunction*) SdkBindings::Get ( 2986 );
 	if ( ! pFnStopMusic )
-		pFnStopMusic = (UFunction*) UObject::GObjObjects()->Data[ 35302 ];
+		return;
 
 	AWwiseMusicVolume_execStopMusic_Parms StopMusic_Parms;
 
@@ -7680,10 +7357,9 @@ void AWwiseMusicVolume::StopMusic ( )
 
 void AWwiseMusicVolume::StartMusic ( )
 {
-	static UFunction* pFnStartMusic = NULL;
-
+	UFunction* pFnStartMusic = (UFunction*) SdkBindings::Get ( 2985 );
 	if ( ! pFnStartMusic )
-		pFnStartMusic = (UFunction*) UObject::GObjObjects()->Data[ 35301 ];
+		return;
 
 	AWwiseMusicVolume_execStartMusic_Parms StartMusic_Parms;
 
@@ -7701,10 +7377,9 @@ void AWwiseMusicVolume::StartMusic ( )
 
 bool AWwiseMusicVolume::CheckPriority ( )
 {
-	static UFunction* pFnCheckPriority = NULL;
-
+	UFunction* pFnCheckPriority = (UFunction*) SdkBindings::Get ( 2984 );
 	if ( ! pFnCheckPriority )
-		pFnCheckPriority = (UFunction*) UObject::GObjObjects()->Data[ 35299 ];
+		return {};
 
 	AWwiseMusicVolume_execCheckPriority_Parms CheckPriority_Parms;
 
@@ -7724,10 +7399,9 @@ bool AWwiseMusicVolume::CheckPriority ( )
 
 void AWwiseMusicVolume::TimerPop ( class AWwiseVolumeTimer* T )
 {
-	static UFunction* pFnTimerPop = NULL;
-
+	UFunction* pFnTimerPop = (UFunction*) SdkBindings::Get ( 2982 );
 	if ( ! pFnTimerPop )
-		pFnTimerPop = (UFunction*) UObject::GObjObjects()->Data[ 35296 ];
+		return;
 
 	AWwiseMusicVolume_execTimerPop_Parms TimerPop_Parms;
 	TimerPop_Parms.T = T;
@@ -7741,10 +7415,9 @@ void AWwiseMusicVolume::TimerPop ( class AWwiseVolumeTimer* T )
 
 void AWwiseMusicVolume::PostBeginPlay ( )
 {
-	static UFunction* pFnPostBeginPlay = NULL;
-
+	UFunction* pFnPostBeginPlay = (UFunction*) SdkBindings::Get ( 2981 );
 	if ( ! pFnPostBeginPlay )
-		pFnPostBeginPlay = (UFunction*) UObject::GObjObjects()->Data[ 35293 ];
+		return;
 
 	AWwiseMusicVolume_execPostBeginPlay_Parms PostBeginPlay_Parms;
 
@@ -7757,10 +7430,9 @@ void AWwiseMusicVolume::PostBeginPlay ( )
 
 void AWwiseVolumeTimer::Timer ( )
 {
-	static UFunction* pFnTimer = NULL;
-
+	UFunction* pFnTimer = (UFunction*) SdkBindings::Get ( 2991 );
 	if ( ! pFnTimer )
-		pFnTimer = (UFunction*) UObject::GObjObjects()->Data[ 35343 ];
+		return;
 
 	AWwiseVolumeTimer_execTimer_Parms Timer_Parms;
 
@@ -7774,10 +7446,9 @@ void AWwiseVolumeTimer::Timer ( )
 
 void UActorFactoryWwiseDistanceRTPC::eventPostCreateActor ( class AActor* NewActor )
 {
-	static UFunction* pFnPostCreateActor = NULL;
-
+	UFunction* pFnPostCreateActor = (UFunction*) SdkBindings::Get ( 2387 );
 	if ( ! pFnPostCreateActor )
-		pFnPostCreateActor = (UFunction*) UObject::GObjObjects()->Data[ 5133 ];
+		return;
 
 	UActorFactoryWwiseDistanceRTPC_eventPostCreateActor_Parms PostCreateActor_Parms;
 	PostCreateActor_Parms.NewActor = NewActor;
@@ -7792,10 +7463,9 @@ void UActorFactoryWwiseDistanceRTPC::eventPostCreateActor ( class AActor* NewAct
 
 void AWwiseDistanceRTPC::Tick ( float DeltaTime )
 {
-	static UFunction* pFnTick = NULL;
-
+	UFunction* pFnTick = (UFunction*) SdkBindings::Get ( 2980 );
 	if ( ! pFnTick )
-		pFnTick = (UFunction*) UObject::GObjObjects()->Data[ 35262 ];
+		return;
 
 	AWwiseDistanceRTPC_execTick_Parms Tick_Parms;
 	Tick_Parms.DeltaTime = DeltaTime;
@@ -7810,10 +7480,9 @@ void AWwiseDistanceRTPC::Tick ( float DeltaTime )
 
 void UActorFactoryWwiseMicPosOrient::eventPostCreateActor ( class AActor* NewActor )
 {
-	static UFunction* pFnPostCreateActor = NULL;
-
+	UFunction* pFnPostCreateActor = (UFunction*) SdkBindings::Get ( 2387 );
 	if ( ! pFnPostCreateActor )
-		pFnPostCreateActor = (UFunction*) UObject::GObjObjects()->Data[ 5133 ];
+		return;
 
 	UActorFactoryWwiseMicPosOrient_eventPostCreateActor_Parms PostCreateActor_Parms;
 	PostCreateActor_Parms.NewActor = NewActor;
@@ -7828,10 +7497,9 @@ void UActorFactoryWwiseMicPosOrient::eventPostCreateActor ( class AActor* NewAct
 
 void AWwiseOcclusionVolume::eventProcessActorSetVolume ( class AActor* Other )
 {
-	static UFunction* pFnProcessActorSetVolume = NULL;
-
+	UFunction* pFnProcessActorSetVolume = (UFunction*) SdkBindings::Get ( 2426 );
 	if ( ! pFnProcessActorSetVolume )
-		pFnProcessActorSetVolume = (UFunction*) UObject::GObjObjects()->Data[ 10916 ];
+		return;
 
 	AWwiseOcclusionVolume_eventProcessActorSetVolume_Parms ProcessActorSetVolume_Parms;
 	ProcessActorSetVolume_Parms.Other = Other;
@@ -7845,10 +7513,9 @@ void AWwiseOcclusionVolume::eventProcessActorSetVolume ( class AActor* Other )
 
 void AWwiseOcclusionVolume::eventCollisionChanged ( )
 {
-	static UFunction* pFnCollisionChanged = NULL;
-
+	UFunction* pFnCollisionChanged = (UFunction*) SdkBindings::Get ( 2425 );
 	if ( ! pFnCollisionChanged )
-		pFnCollisionChanged = (UFunction*) UObject::GObjObjects()->Data[ 10915 ];
+		return;
 
 	AWwiseOcclusionVolume_eventCollisionChanged_Parms CollisionChanged_Parms;
 
@@ -7862,10 +7529,9 @@ void AWwiseOcclusionVolume::eventCollisionChanged ( )
 
 void AWwiseOcclusionVolume::OnToggle ( class USeqAct_Toggle* Action )
 {
-	static UFunction* pFnOnToggle = NULL;
-
+	UFunction* pFnOnToggle = (UFunction*) SdkBindings::Get ( 2424 );
 	if ( ! pFnOnToggle )
-		pFnOnToggle = (UFunction*) UObject::GObjObjects()->Data[ 10913 ];
+		return;
 
 	AWwiseOcclusionVolume_execOnToggle_Parms OnToggle_Parms;
 	OnToggle_Parms.Action = Action;
@@ -7882,10 +7548,9 @@ void AWwiseOcclusionVolume::OnToggle ( class USeqAct_Toggle* Action )
 
 void AWwiseOcclusionVolume::DisplayDebug ( class AHUD* HUD, float* out_YL, float* out_YPos )
 {
-	static UFunction* pFnDisplayDebug = NULL;
-
+	UFunction* pFnDisplayDebug = (UFunction*) SdkBindings::Get ( 2423 );
 	if ( ! pFnDisplayDebug )
-		pFnDisplayDebug = (UFunction*) UObject::GObjObjects()->Data[ 10898 ];
+		return;
 
 	AWwiseOcclusionVolume_execDisplayDebug_Parms DisplayDebug_Parms;
 	DisplayDebug_Parms.HUD = HUD;
@@ -7907,10 +7572,9 @@ void AWwiseOcclusionVolume::DisplayDebug ( class AHUD* HUD, float* out_YL, float
 
 struct FString AWwiseOcclusionVolume::GetLocationStringFor ( class APlayerReplicationInfo* PRI )
 {
-	static UFunction* pFnGetLocationStringFor = NULL;
-
+	UFunction* pFnGetLocationStringFor = (UFunction*) SdkBindings::Get ( 2422 );
 	if ( ! pFnGetLocationStringFor )
-		pFnGetLocationStringFor = (UFunction*) UObject::GObjObjects()->Data[ 10894 ];
+		return {};
 
 	AWwiseOcclusionVolume_execGetLocationStringFor_Parms GetLocationStringFor_Parms;
 	GetLocationStringFor_Parms.PRI = PRI;
@@ -7926,10 +7590,9 @@ struct FString AWwiseOcclusionVolume::GetLocationStringFor ( class APlayerReplic
 
 void AWwiseOcclusionVolume::eventPostBeginPlay ( )
 {
-	static UFunction* pFnPostBeginPlay = NULL;
-
+	UFunction* pFnPostBeginPlay = (UFunction*) SdkBindings::Get ( 2421 );
 	if ( ! pFnPostBeginPlay )
-		pFnPostBeginPlay = (UFunction*) UObject::GObjObjects()->Data[ 10892 ];
+		return;
 
 	AWwiseOcclusionVolume_eventPostBeginPlay_Parms PostBeginPlay_Parms;
 
@@ -7946,10 +7609,9 @@ void AWwiseOcclusionVolume::eventPostBeginPlay ( )
 
 bool AWwiseOcclusionVolume::ScriptLineCheck ( struct FVector* End, struct FVector* Start, struct FVector* Extent )
 {
-	static UFunction* pFnScriptLineCheck = NULL;
-
+	UFunction* pFnScriptLineCheck = (UFunction*) SdkBindings::Get ( 2420 );
 	if ( ! pFnScriptLineCheck )
-		pFnScriptLineCheck = (UFunction*) UObject::GObjObjects()->Data[ 10887 ];
+		return {};
 
 	AWwiseOcclusionVolume_execScriptLineCheck_Parms ScriptLineCheck_Parms;
 
@@ -7979,10 +7641,9 @@ bool AWwiseOcclusionVolume::ScriptLineCheck ( struct FVector* End, struct FVecto
 
 bool AWwiseOcclusionVolume::EncompassesPoint ( struct FVector Loc )
 {
-	static UFunction* pFnEncompassesPoint = NULL;
-
+	UFunction* pFnEncompassesPoint = (UFunction*) SdkBindings::Get ( 2419 );
 	if ( ! pFnEncompassesPoint )
-		pFnEncompassesPoint = (UFunction*) UObject::GObjObjects()->Data[ 10884 ];
+		return {};
 
 	AWwiseOcclusionVolume_execEncompassesPoint_Parms EncompassesPoint_Parms;
 	memcpy ( &EncompassesPoint_Parms.Loc, &Loc, 0xC );
@@ -8004,10 +7665,9 @@ bool AWwiseOcclusionVolume::EncompassesPoint ( struct FVector Loc )
 
 bool AWwiseOcclusionVolume::Encompasses ( class AActor* Other )
 {
-	static UFunction* pFnEncompasses = NULL;
-
+	UFunction* pFnEncompasses = (UFunction*) SdkBindings::Get ( 2418 );
 	if ( ! pFnEncompasses )
-		pFnEncompasses = (UFunction*) UObject::GObjObjects()->Data[ 10881 ];
+		return {};
 
 	AWwiseOcclusionVolume_execEncompasses_Parms Encompasses_Parms;
 	Encompasses_Parms.Other = Other;
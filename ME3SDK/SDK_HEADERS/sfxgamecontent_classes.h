@@ -54,16 +54,9 @@ public:
 	unsigned long                                      bPawnEvaded : 1;                                  		// 0x0460 (0x0004) [0x0000000000002020] [0x00000004] ( CPF_Net | CPF_Transient )
 	unsigned char                                      SeekAimNode;                                      		// 0x0464 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106343 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5894 );
 	};
 
 	void Tick_Prediction ( float DeltaTime );
@@ -80,24 +73,15 @@ public:
 	void eventReplicatedEvent ( struct FName VarName );
 };
 
-UClass* Asfxprojectile_powercustomaction_seeking::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXProjectile_PowerCustomAction_SentryTurretRocket
 // 0x0000 (0x0465 - 0x0465)
 class ASFXProjectile_PowerCustomAction_SentryTurretRocket : public Asfxprojectile_powercustomaction_seeking
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106025 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5843 );
 	};
 
 	void Tick_Prediction ( float DeltaTime );
@@ -114,24 +98,15 @@ public:
 	void eventReplicatedEvent ( struct FName VarName );
 };
 
-UClass* ASFXProjectile_PowerCustomAction_SentryTurretRocket::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXProjectile_PowerCustomAction_BouncingGrenade
 // 0x0000 (0x0444 - 0x0444)
 class ASFXProjectile_PowerCustomAction_BouncingGrenade : public ASFXProjectile_PowerCustomAction_Grenade
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106077 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5848 );
 	};
 
 	void Explode ( struct FVector HitLocation, struct FVector HitNormal );
@@ -144,24 +119,15 @@ public:
 	void FuseDone ( );
 };
 
-UClass* ASFXProjectile_PowerCustomAction_BouncingGrenade::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXProjectile_PowerCustomAction_SentryTurret
 // 0x0000 (0x0444 - 0x0444)
 class ASFXProjectile_PowerCustomAction_SentryTurret : public ASFXProjectile_PowerCustomAction_BouncingGrenade
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106078 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5849 );
 	};
 
 	void Explode ( struct FVector HitLocation, struct FVector HitNormal );
@@ -174,24 +140,15 @@ public:
 	void FuseDone ( );
 };
 
-UClass* ASFXProjectile_PowerCustomAction_SentryTurret::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXProjectile_PowerCustomAction_CombatDroneRocket
 // 0x0000 (0x0465 - 0x0465)
 class ASFXProjectile_PowerCustomAction_CombatDroneRocket : public Asfxprojectile_powercustomaction_seeking
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106344 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5895 );
 	};
 
 	void Tick_Prediction ( float DeltaTime );
@@ -208,8 +165,6 @@ public:
 	void eventReplicatedEvent ( struct FName VarName );
 };
 
-UClass* ASFXProjectile_PowerCustomAction_CombatDroneRocket::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXPowerCustomAction_CombatDroneBase
 // 0x000F (0x06A4 - 0x0695)
 class USFXPowerCustomAction_CombatDroneBase : public Usfxpowercustomaction
@@ -219,16 +174,9 @@ public:
 	class UClass*                                      DroneAIClass;                                     		// 0x069C (0x0004) [0x0000000000000000]              
 	float                                              DroneSpawnOffset;                                 		// 0x06A0 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106877 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5996 );
 	};
 
 	struct FVector GetBackLocation ( class AActor* Target );
@@ -240,8 +188,6 @@ public:
 	class ASFXPawn_CombatDroneBase* SpawnDrone ( struct FVector location, struct FRotator Rotation );
 };
 
-UClass* USFXPowerCustomAction_CombatDroneBase::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXPowerCustomAction_CombatDrone
 // 0x0304 (0x09A8 - 0x06A4)
 class USFXPowerCustomAction_CombatDrone : public USFXPowerCustomAction_CombatDroneBase
@@ -278,16 +224,9 @@ public:
 	float                                              NonCombatTimeout_Length;                          		// 0x09A0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	float                                              NonCombatTimeout_UpdateFrequency;                 		// 0x09A4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106454 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5913 );
 	};
 
 	void PrecacheVFX ( class ASFXObjectPool* ObjectPool, class URvrClientEffectManager* ClientEffects );
@@ -309,24 +248,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXPowerCustomAction_CombatDrone::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXSeqEvt_PlaceableActivated
 // 0x0000 (0x00D2 - 0x00D2)
 class USFXSeqEvt_PlaceableActivated : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106593 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5940 );
 	};
 
 	void eventToggled ( );
@@ -336,24 +266,15 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* USFXSeqEvt_PlaceableActivated::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXSeqEvt_PlaceableDeactivated
 // 0x0000 (0x00D2 - 0x00D2)
 class USFXSeqEvt_PlaceableDeactivated : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106595 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5942 );
 	};
 
 	void eventToggled ( );
@@ -363,24 +284,15 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* USFXSeqEvt_PlaceableDeactivated::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXSeqEvt_PlaceableDestroyed
 // 0x0000 (0x00D2 - 0x00D2)
 class USFXSeqEvt_PlaceableDestroyed : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106621 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5948 );
 	};
 
 	void eventToggled ( );
@@ -390,24 +302,15 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* USFXSeqEvt_PlaceableDestroyed::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXSeqEvt_PlaceableReset
 // 0x0000 (0x00D2 - 0x00D2)
 class USFXSeqEvt_PlaceableReset : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106623 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5950 );
 	};
 
 	void eventToggled ( );
@@ -417,8 +320,6 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* USFXSeqEvt_PlaceableReset::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXPlaceable
 // 0x0004 (0x0274 - 0x0270)
 class ASFXPlaceable : public ASFXPlaceableBase
@@ -427,16 +328,9 @@ public:
 	unsigned long                                      bReplicatedIsDestroyed : 1;                       		// 0x0270 (0x0004) [0x0000000000000020] [0x00000001] ( CPF_Net )
 	unsigned long                                      bReplicatedIsDeactivated : 1;                     		// 0x0270 (0x0004) [0x0000000000000020] [0x00000002] ( CPF_Net )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106629 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5953 );
 	};
 
 	void ActivatePlaceable ( );
@@ -450,24 +344,15 @@ public:
 	void eventReplicatedEvent ( struct FName VarName );
 };
 
-UClass* ASFXPlaceable::pClassPointer = NULL;
-
 // Class sfxgamecontent.sfxpowercustomaction_sentryturretshock
 // 0x0000 (0x0695 - 0x0695)
 class Usfxpowercustomaction_sentryturretshock : public Usfxpowercustomaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106641 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5954 );
 	};
 
 	int GetSaveGamePowerState ( );
@@ -564,24 +449,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* Usfxpowercustomaction_sentryturretshock::pClassPointer = NULL;
-
 // Class sfxgamecontent.sfxpowercustomaction_sentryturretrocket
 // 0x0000 (0x0695 - 0x0695)
 class Usfxpowercustomaction_sentryturretrocket : public Usfxpowercustomaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106642 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5955 );
 	};
 
 	int GetSaveGamePowerState ( );
@@ -678,8 +554,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* Usfxpowercustomaction_sentryturretrocket::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXPowerCustomAction_AmmoPower
 // 0x0057 (0x06EC - 0x0695)
 class USFXPowerCustomAction_AmmoPower : public USFXPowerCustomAction_AmmoPowerBase
@@ -706,16 +580,9 @@ public:
 	unsigned long                                      bModifyImpactVFX : 1;                             		// 0x06E8 (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned long                                      bModifyMuzzle : 1;                                		// 0x06E8 (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107316 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6076 );
 	};
 
 	void DelayedSetWeaponPower ( );
@@ -739,24 +606,15 @@ public:
 	void PrecacheVFX ( class ASFXObjectPool* ObjectPool, class URvrClientEffectManager* ClientEffects );
 };
 
-UClass* USFXPowerCustomAction_AmmoPower::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXPowerCustomAction_SentryTurretArmorPiercingAmmo
 // 0x0000 (0x06EC - 0x06EC)
 class USFXPowerCustomAction_SentryTurretArmorPiercingAmmo : public USFXPowerCustomAction_AmmoPower
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106643 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5956 );
 	};
 
 	void DelayedSetWeaponPower ( );
@@ -780,8 +638,6 @@ public:
 	void PrecacheVFX ( class ASFXObjectPool* ObjectPool, class URvrClientEffectManager* ClientEffects );
 };
 
-UClass* USFXPowerCustomAction_SentryTurretArmorPiercingAmmo::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXPowerCustomAction_SentryTurretCryoAmmo
 // 0x0004 (0x06F0 - 0x06EC)
 class USFXPowerCustomAction_SentryTurretCryoAmmo : public USFXPowerCustomAction_AmmoPower
@@ -789,16 +645,9 @@ class USFXPowerCustomAction_SentryTurretCryoAmmo : public USFXPowerCustomAction_
 public:
 	float                                              FreezeChance;                                     		// 0x06EC (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106644 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5957 );
 	};
 
 	bool eventShouldUsePower ( class AActor* Target, struct FString* sOptionalInfo );
@@ -807,8 +656,6 @@ public:
 	void ApplyPowerEffects ( class ABioPawn* oPawn, class ASFXWeapon* oWeapon );
 };
 
-UClass* USFXPowerCustomAction_SentryTurretCryoAmmo::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXPowerCustomAction_SentryTurret
 // 0x0297 (0x092C - 0x0695)
 class USFXPowerCustomAction_SentryTurret : public Usfxpowercustomaction
@@ -843,16 +690,9 @@ public:
 	float                                              NonCombatTimeout_UpdateFrequency;                 		// 0x0924 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	unsigned long                                      DeathByShutdown : 1;                              		// 0x0928 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106684 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5962 );
 	};
 
 	void PrecacheVFX ( class ASFXObjectPool* ObjectPool, class URvrClientEffectManager* ClientEffects );
@@ -874,8 +714,6 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXPowerCustomAction_SentryTurret::pClassPointer = NULL;
-
 // Class sfxgamecontent.sfxpawn_sentryturret
 // 0x0058 (0x0D98 - 0x0D40)
 class Asfxpawn_sentryturret : public Asfxpawn
@@ -897,16 +735,9 @@ public:
 	unsigned long                                      bHasShock : 1;                                    		// 0x0D94 (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned long                                      bIsClientSideInitialized : 1;                     		// 0x0D94 (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106711 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5969 );
 	};
 
 	class AActor* GetPetOwner ( );
@@ -921,8 +752,6 @@ public:
 	void OnTurretKilled ( class Asfxpawn_sentryturret* oTurret );
 };
 
-UClass* Asfxpawn_sentryturret::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXPowerCustomAction_Decoy
 // 0x020B (0x08A0 - 0x0695)
 class USFXPowerCustomAction_Decoy : public Usfxpowercustomaction
@@ -957,16 +786,9 @@ public:
 	float                                              DistAboveFloor;                                   		// 0x0898 (0x0004) [0x0000000000000000]              
 	unsigned long                                      UserDespawn : 1;                                  		// 0x089C (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106769 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5979 );
 	};
 
 	void PopulatePowerStatBarEvolves ( );
@@ -992,8 +814,6 @@ public:
 	class Asfxpawn_decoy* SpawnDecoy ( struct FVector location, struct FRotator Rotation );
 };
 
-UClass* USFXPowerCustomAction_Decoy::pClassPointer = NULL;
-
 // Class sfxgamecontent.sfxpawn_decoy
 // 0x0054 (0x0D94 - 0x0D40)
 class Asfxpawn_decoy : public Asfxpawn
@@ -1017,16 +837,9 @@ public:
 	unsigned long                                      bExplosiveCooldown : 1;                           		// 0x0D90 (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned long                                      bIsClientSideInitialized : 1;                     		// 0x0D90 (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106784 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5984 );
 	};
 
 	class AActor* GetPetOwner ( );
@@ -1044,24 +857,15 @@ public:
 	void OnDecoyKilled ( class Asfxpawn_decoy* oDecoy );
 };
 
-UClass* Asfxpawn_decoy::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXPowerCustomAction_CombatDroneRocket
 // 0x0000 (0x0695 - 0x0695)
 class USFXPowerCustomAction_CombatDroneRocket : public Usfxpowercustomaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106795 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5985 );
 	};
 
 	int GetSaveGamePowerState ( );
@@ -1158,24 +962,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXPowerCustomAction_CombatDroneRocket::pClassPointer = NULL;
-
 // Class sfxgamecontent.sfxpowercustomaction_combatdroneshock
 // 0x0000 (0x0695 - 0x0695)
 class Usfxpowercustomaction_combatdroneshock : public Usfxpowercustomaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106796 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5986 );
 	};
 
 	int GetSaveGamePowerState ( );
@@ -1272,8 +1067,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* Usfxpowercustomaction_combatdroneshock::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXPawn_CombatDroneBase
 // 0x001C (0x0D5C - 0x0D40)
 class ASFXPawn_CombatDroneBase : public Asfxpawn
@@ -1284,16 +1077,9 @@ public:
 	class AActor*                                      Caster;                                           		// 0x0D54 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bIsClientSideInitialized : 1;                     		// 0x0D58 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107488 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6116 );
 	};
 
 	class AActor* GetPetOwner ( );
@@ -1305,8 +1091,6 @@ public:
 	void OnDroneKilled ( class ASFXPawn_CombatDroneBase* oDrone );
 };
 
-UClass* ASFXPawn_CombatDroneBase::pClassPointer = NULL;
-
 // Class sfxgamecontent.sfxpawn_combatdrone
 // 0x003C (0x0D98 - 0x0D5C)
 class Asfxpawn_combatdrone : public ASFXPawn_CombatDroneBase
@@ -1323,16 +1107,9 @@ public:
 	class UWwiseEvent*                                 StopLoopingSound;                                 		// 0x0D90 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bDroneVFXStopped : 1;                             		// 0x0D94 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106844 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5992 );
 	};
 
 	void PlayDying ( class UClass* DamageType, struct FVector HitLoc );
@@ -1342,8 +1119,6 @@ public:
 	void PostBeginPlay ( );
 };
 
-UClass* Asfxpawn_combatdrone::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGUI_HeavyWeaponReticle
 // 0x000C (0x0098 - 0x008C)
 class USFXGUI_HeavyWeaponReticle : public USFXGUI_WeaponReticleBase
@@ -1353,16 +1128,9 @@ public:
 	class UGFxValue*                                   m_oAmmoText;                                      		// 0x0090 (0x0004) [0x0000000000000000]              
 	class UGFxValue*                                   m_oReticleBG;                                     		// 0x0094 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106906 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6006 );
 	};
 
 	void eventTargetCanHitChanged ( unsigned long bCanHit );
@@ -1372,8 +1140,6 @@ public:
 	void eventPerformReticleShow ( unsigned long bInstant );
 };
 
-UClass* USFXGUI_HeavyWeaponReticle::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_WeaponVFXChange
 // 0x001A (0x007C - 0x0062)
 class USFXGameEffect_WeaponVFXChange : public USFXGameEffect
@@ -1388,112 +1154,67 @@ public:
 	unsigned long                                      bModifyMuzzleFlash : 1;                           		// 0x0078 (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned long                                      bModifyImpactVFX : 1;                             		// 0x0078 (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106918 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6009 );
 	};
 
 	void OnRemoved ( );
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_WeaponVFXChange::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXRumble_Power_FireCombo
 // 0x0000 (0x0048 - 0x0048)
 class USFXRumble_Power_FireCombo : public USFXRumble_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106928 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6012 );
 	};
 
 };
 
-UClass* USFXRumble_Power_FireCombo::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXShake_Power_FireCombo
 // 0x0000 (0x00BC - 0x00BC)
 class USFXShake_Power_FireCombo : public USFXShake_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106929 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6013 );
 	};
 
 };
 
-UClass* USFXShake_Power_FireCombo::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXRumble_Power_ElectricCombo
 // 0x0000 (0x0048 - 0x0048)
 class USFXRumble_Power_ElectricCombo : public USFXRumble_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106964 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6016 );
 	};
 
 };
 
-UClass* USFXRumble_Power_ElectricCombo::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXShake_Power_ElectricCombo
 // 0x0000 (0x00BC - 0x00BC)
 class USFXShake_Power_ElectricCombo : public USFXShake_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106965 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6017 );
 	};
 
 };
 
-UClass* USFXShake_Power_ElectricCombo::pClassPointer = NULL;
-
 // Class sfxgamecontent.sfxgameeffect_powercombo_electric
 // 0x0004 (0x00F4 - 0x00F0)
 class Usfxgameeffect_powercombo_electric : public Usfxgameeffect_powercombo
@@ -1501,67 +1222,40 @@ class Usfxgameeffect_powercombo_electric : public Usfxgameeffect_powercombo
 public:
 	float                                              BeamDuration;                                     		// 0x00F0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106977 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6019 );
 	};
 
 	bool OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector HitLocation, struct FVector HitNormal );
 };
 
-UClass* Usfxgameeffect_powercombo_electric::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXRumble_Power_CryoCombo
 // 0x0000 (0x0048 - 0x0048)
 class USFXRumble_Power_CryoCombo : public USFXRumble_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106980 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6020 );
 	};
 
 };
 
-UClass* USFXRumble_Power_CryoCombo::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXShake_Power_CryoCombo
 // 0x0000 (0x00BC - 0x00BC)
 class USFXShake_Power_CryoCombo : public USFXShake_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 106981 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6021 );
 	};
 
 };
 
-UClass* USFXShake_Power_CryoCombo::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_IgnorePawn
 // 0x0006 (0x0068 - 0x0062)
 class USFXGameEffect_IgnorePawn : public USFXGameEffect
@@ -1569,24 +1263,15 @@ class USFXGameEffect_IgnorePawn : public USFXGameEffect
 public:
 	unsigned long                                      bAffectHenchmen : 1;                              		// 0x0064 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107024 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6026 );
 	};
 
 	void OnRemoved ( );
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_IgnorePawn::pClassPointer = NULL;
-
 // Class sfxgamecontent.sfxgameeffect_powercombo_fire
 // 0x0020 (0x0110 - 0x00F0)
 class Usfxgameeffect_powercombo_fire : public Usfxgameeffect_powercombo
@@ -1599,24 +1284,15 @@ public:
 	int                                                NumFlameEffectsMP;                                		// 0x0108 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	unsigned long                                      bHideBodyOnDetonation : 1;                        		// 0x010C (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107041 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6028 );
 	};
 
 	bool OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector HitLocation, struct FVector HitNormal );
 	void OnPowerComboDetonated ( class Usfxpowercustomaction* DetonationPower, struct FVector HitLocation, struct FVector HitNormal );
 };
 
-UClass* Usfxgameeffect_powercombo_fire::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_FireDamageOverTime
 // 0x0010 (0x007C - 0x006C)
 class USFXGameEffect_FireDamageOverTime : public USFXGameEffect_DamageOverTime
@@ -1628,16 +1304,9 @@ public:
 	unsigned long                                      bComboEffectApplied : 1;                          		// 0x0078 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      bCanCauseCombo : 1;                               		// 0x0078 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107048 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6031 );
 	};
 
 	void DoDamage ( );
@@ -1645,8 +1314,6 @@ public:
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_FireDamageOverTime::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_ElectricComboBeam
 // 0x0026 (0x0088 - 0x0062)
 class USFXGameEffect_ElectricComboBeam : public USFXGameEffect
@@ -1661,16 +1328,9 @@ public:
 	class UWwiseEvent*                                 BeamSound;                                        		// 0x0080 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bBeamActive : 1;                                  		// 0x0084 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107073 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6036 );
 	};
 
 	void OnRemoved ( );
@@ -1679,8 +1339,6 @@ public:
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_ElectricComboBeam::pClassPointer = NULL;
-
 // Class sfxgamecontent.sfxgameeffect_powercombo_cryo
 // 0x0014 (0x0104 - 0x00F0)
 class Usfxgameeffect_powercombo_cryo : public Usfxgameeffect_powercombo
@@ -1691,39 +1349,23 @@ public:
 	class URvrClientEffectInterface*                   CE_HalfFrozenTemplate;                            		// 0x00FC (0x0004) [0x0000000000000000]              
 	float                                              SpeedReduction;                                   		// 0x0100 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107076 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6037 );
 	};
 
 	bool OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector HitLocation, struct FVector HitNormal );
 };
 
-UClass* Usfxgameeffect_powercombo_cryo::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_DamageImmunity
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_DamageImmunity : public USFXGameEffect
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107103 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6042 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -1739,24 +1381,15 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_DamageImmunity::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_PartBasedDamageTakenBonus
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_PartBasedDamageTakenBonus : public USFXGameEffect
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107144 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6048 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -1772,8 +1405,6 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_PartBasedDamageTakenBonus::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_CryoFreeze
 // 0x003F (0x00C0 - 0x0081)
 class USFXGameEffect_CryoFreeze : public USFXGameEffect_WeldPhysics
@@ -1792,16 +1423,9 @@ public:
 	unsigned long                                      bOwnerDied : 1;                                   		// 0x00BC (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned long                                      bPlayFrozenDeathSound : 1;                        		// 0x00BC (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107166 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6050 );
 	};
 
 	void OnRemoved ( );
@@ -1810,8 +1434,6 @@ public:
 	void OnFrozenPawnDied ( class ABioPawn* oPawn );
 };
 
-UClass* USFXGameEffect_CryoFreeze::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_DelayedCryoFreeze
 // 0x003A (0x009C - 0x0062)
 class USFXGameEffect_DelayedCryoFreeze : public USFXGameEffect
@@ -1828,16 +1450,9 @@ public:
 	unsigned long                                      bPlayFrozenDeathSound : 1;                        		// 0x0098 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      bOwnerDied : 1;                                   		// 0x0098 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107167 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6051 );
 	};
 
 	void OnRemoved ( );
@@ -1846,8 +1461,6 @@ public:
 	void OnFrozenPawnDied ( class ABioPawn* oPawn );
 };
 
-UClass* USFXGameEffect_DelayedCryoFreeze::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_AmmoPower
 // 0x0026 (0x0088 - 0x0062)
 class USFXGameEffect_AmmoPower : public USFXGameEffect
@@ -1864,16 +1477,9 @@ public:
 	unsigned long                                      AddedByPlayer : 1;                                		// 0x0084 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      bInCinematic : 1;                                 		// 0x0084 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107359 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6089 );
 	};
 
 	void eventOnUpdate ( float DeltaSeconds );
@@ -1890,8 +1496,6 @@ public:
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_AmmoPower::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_CryoAmmo
 // 0x0030 (0x00B8 - 0x0088)
 class USFXGameEffect_CryoAmmo : public USFXGameEffect_AmmoPower
@@ -1910,16 +1514,9 @@ public:
 	float                                              DelayedFreezeRandDuration;                        		// 0x00B0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	float                                              DelayedFreezeStaticDuration;                      		// 0x00B4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107178 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6054 );
 	};
 
 	float GetDamageVocProbabilityMod ( );
@@ -1928,8 +1525,6 @@ public:
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_CryoAmmo::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXPowerCustomAction_CombatDroneZap
 // 0x0017 (0x06AC - 0x0695)
 class USFXPowerCustomAction_CombatDroneZap : public Usfxpowercustomaction
@@ -1941,16 +1536,9 @@ public:
 	int                                                NumCharges;                                       		// 0x06A4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	class AActor*                                      LastHitActor;                                     		// 0x06A8 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107195 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6055 );
 	};
 
 	void ClientDoPowerSubsequentImpact ( class AActor* oActor, int CustomActionReactionType, float Duration, int ImpactCount, float Delay, unsigned long DoCallback );
@@ -1961,8 +1549,6 @@ public:
 	float GetImpactDamage ( class AActor* oImpacted, class UClass** DamageType );
 };
 
-UClass* USFXPowerCustomAction_CombatDroneZap::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_CombatDroneZapChain
 // 0x006E (0x00D0 - 0x0062)
 class USFXGameEffect_CombatDroneZapChain : public USFXGameEffect
@@ -1992,16 +1578,9 @@ public:
 	unsigned long                                      bEffectDone : 1;                                  		// 0x00CC (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      bBeamActive : 1;                                  		// 0x00CC (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107254 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6063 );
 	};
 
 	void OnRemoved ( );
@@ -2013,24 +1592,15 @@ public:
 	void PrecacheVFX ( class ASFXObjectPool* ObjectPool, class URvrClientEffectManager* ClientEffects );
 };
 
-UClass* USFXGameEffect_CombatDroneZapChain::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_ArmorWeakness
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_ArmorWeakness : public USFXGameEffect
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107260 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6064 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -2046,24 +1616,15 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_ArmorWeakness::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_ArmorPiercingBonus
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_ArmorPiercingBonus : public USFXGameEffect
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107296 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6067 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -2079,8 +1640,6 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_ArmorPiercingBonus::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_WeaponMod
 // 0x0007 (0x0069 - 0x0062)
 class USFXGameEffect_WeaponMod : public USFXGameEffect
@@ -2089,85 +1648,51 @@ public:
 	class ASFXWeapon*                                  MyWeapon;                                         		// 0x0064 (0x0004) [0x0000000000000000]              
 	unsigned char                                      ModStat;                                          		// 0x0068 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107300 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6069 );
 	};
 
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_WeaponMod::pClassPointer = NULL;
-
 // Class sfxgamecontent.sfxgameeffect_penetrationdamagebonus
 // 0x0000 (0x0069 - 0x0069)
 class Usfxgameeffect_penetrationdamagebonus : public USFXGameEffect_WeaponMod
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107299 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6068 );
 	};
 
 	void OnApplied ( );
 };
 
-UClass* Usfxgameeffect_penetrationdamagebonus::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_PenetrationBonus
 // 0x0000 (0x0069 - 0x0069)
 class USFXGameEffect_PenetrationBonus : public USFXGameEffect_WeaponMod
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107301 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6070 );
 	};
 
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_PenetrationBonus::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_ConstraintDmgBonus
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_ConstraintDmgBonus : public USFXGameEffect
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107303 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6071 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -2183,8 +1708,6 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_ConstraintDmgBonus::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_SpareAmmo
 // 0x0006 (0x0068 - 0x0062)
 class USFXGameEffect_SpareAmmo : public USFXGameEffect
@@ -2192,24 +1715,15 @@ class USFXGameEffect_SpareAmmo : public USFXGameEffect
 public:
 	int                                                AmmoIncrease;                                     		// 0x0064 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107305 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6072 );
 	};
 
 	void OnRemoved ( );
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_SpareAmmo::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_ArmorPiercingAmmo
 // 0x0028 (0x00B0 - 0x0088)
 class USFXGameEffect_ArmorPiercingAmmo : public USFXGameEffect_AmmoPower
@@ -2226,16 +1740,9 @@ public:
 	class UParticleSystem*                             PS_OrganicImpactEffect;                           		// 0x00A8 (0x0004) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 	class UParticleSystem*                             PS_NonOrganicImpactEffect;                        		// 0x00AC (0x0004) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107314 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6075 );
 	};
 
 	void OnWeaponImpact ( class ASFXWeapon* Weapon, struct FImpactInfo Impact );
@@ -2244,46 +1751,28 @@ public:
 	void PrecacheVFX ( class ASFXObjectPool* ObjectPool, class URvrClientEffectManager* ClientEffects );
 };
 
-UClass* USFXGameEffect_ArmorPiercingAmmo::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_SentryTurretShock
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_SentryTurretShock : public USFXDamageType_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107362 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6090 );
 	};
 
 };
 
-UClass* USFXDamageType_SentryTurretShock::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_HeavyWeapon
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_HeavyWeapon : public USFXDamageType_Weapon
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107365 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6091 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -2291,24 +1780,15 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_HeavyWeapon::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_FlameThrower
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_FlameThrower : public USFXDamageType_Weapon
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107370 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6092 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -2316,200 +1796,119 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_FlameThrower::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_FireExplosion
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_FireExplosion : public USFXDamageType_Power_Fire
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107376 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6093 );
 	};
 
 };
 
-UClass* USFXDamageType_FireExplosion::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_ElectricCombo
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_ElectricCombo : public USFXDamageType_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107379 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6094 );
 	};
 
 };
 
-UClass* USFXDamageType_ElectricCombo::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_Decoy
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_Decoy : public USFXDamageType_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107382 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6095 );
 	};
 
 };
 
-UClass* USFXDamageType_Decoy::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_CryoExplosion
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_CryoExplosion : public USFXDamageType_Power_Freeze
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107385 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6096 );
 	};
 
 };
 
-UClass* USFXDamageType_CryoExplosion::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_CryoAmmo
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_CryoAmmo : public USFXDamageType_Power_Freeze
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107388 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6097 );
 	};
 
 };
 
-UClass* USFXDamageType_CryoAmmo::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_CombatDroneAttackImproved
 // 0x0000 (0x00EA - 0x00EA)
 class USFXDamageType_CombatDroneAttackImproved : public USFXDamageType_Power_Ragdoll
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107391 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6098 );
 	};
 
 };
 
-UClass* USFXDamageType_CombatDroneAttackImproved::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_CombatDroneAttack
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_CombatDroneAttack : public USFXDamageType_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107394 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6099 );
 	};
 
 };
 
-UClass* USFXDamageType_CombatDroneAttack::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_CombatDrone
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_CombatDrone : public USFXDamageType_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107397 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6100 );
 	};
 
 };
 
-UClass* USFXDamageType_CombatDrone::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_AssaultRifle
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_AssaultRifle : public USFXDamageType_Weapon
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107400 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6101 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -2517,46 +1916,28 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_AssaultRifle::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_ArmorPiercingAmmo
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_ArmorPiercingAmmo : public USFXDamageType_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107403 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6102 );
 	};
 
 };
 
-UClass* USFXDamageType_ArmorPiercingAmmo::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXWeapon_AssaultRifle_SentryTurret
 // 0x0000 (0x0DD8 - 0x0DD8)
 class ASFXWeapon_AssaultRifle_SentryTurret : public ASFXWeapon_AssaultRifle_Base
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107408 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6103 );
 	};
 
 	unsigned char GetStoreQualification ( );
@@ -2567,8 +1948,6 @@ public:
 	bool ShouldSpawnTracerFX ( );
 };
 
-UClass* ASFXWeapon_AssaultRifle_SentryTurret::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXWeapon_Heavy_Beam_Base
 // 0x003C (0x0E14 - 0x0DD8)
 class ASFXWeapon_Heavy_Beam_Base : public ASFXHeavyWeapon
@@ -2586,16 +1965,9 @@ public:
 	unsigned long                                      bFiringContinuously : 1;                          		// 0x0E10 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 	unsigned long                                      bIsFiring : 1;                                    		// 0x0E10 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107410 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6104 );
 	};
 
 	struct FRotator GetAdjustedAim ( struct FVector StartFireLoc );
@@ -2617,8 +1989,6 @@ public:
 	void InitDefaultDecalProperties ( );
 };
 
-UClass* ASFXWeapon_Heavy_Beam_Base::pClassPointer = NULL;
-
 // Class sfxgamecontent.sfxweapon_heavy_flamethrower_sentryturret
 // 0x0020 (0x0E34 - 0x0E14)
 class Asfxweapon_heavy_flamethrower_sentryturret : public ASFXWeapon_Heavy_Beam_Base
@@ -2631,16 +2001,9 @@ public:
 	class UWwiseEvent*                                 WindDownSound;                                    		// 0x0E2C (0x0004) [0x0000000000000000]              
 	class USFXPowerCustomAction_SentryTurret*          SentryTurretPower;                                		// 0x0E30 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107411 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6105 );
 	};
 
 	void ProcessInstantHit ( unsigned char FiringMode, struct FImpactInfo Impact, int NumHits );
@@ -2653,8 +2016,6 @@ public:
 	void FireModeUpdated ( unsigned char FiringMode, unsigned long bViaReplication );
 };
 
-UClass* Asfxweapon_heavy_flamethrower_sentryturret::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXAICmd_Base_SentryTurret
 // 0x0030 (0x00C8 - 0x0098)
 class USFXAICmd_Base_SentryTurret : public USFXAICommand_Base_Combat
@@ -2668,40 +2029,24 @@ public:
 	float                                              FlamethrowerRangeSq;                              		// 0x00C0 (0x0004) [0x0000000000000000]              
 	class AActor*                                      PowerTarget;                                      		// 0x00C4 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107479 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6113 );
 	};
 
 	void ChooseWeapon ( );
 	bool ShouldUsePower ( struct FName* PowerName, class AActor** Target );
 };
 
-UClass* USFXAICmd_Base_SentryTurret::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXAI_SentryTurret
 // 0x0000 (0x0690 - 0x0690)
 class ASFXAI_SentryTurret : public Asfxai_core
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107481 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6114 );
 	};
 
 	void CheckDownedPlayers ( );
@@ -2846,8 +2191,6 @@ public:
 	void UsePowerDelegate ( int nReason );
 };
 
-UClass* ASFXAI_SentryTurret::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXAICmd_Base_CombatDrone
 // 0x002C (0x00C4 - 0x0098)
 class USFXAICmd_Base_CombatDrone : public USFXAICommand_Base_Combat
@@ -2861,16 +2204,9 @@ public:
 	float                                              IdealMinRangeToTarget;                            		// 0x00BC (0x0004) [0x0000000000000000]              
 	float                                              IdealRangeToTarget;                               		// 0x00C0 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107482 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6115 );
 	};
 
 	bool ShouldUsePower ( struct FName* PowerName );
@@ -2878,8 +2214,6 @@ public:
 	void Pushed ( );
 };
 
-UClass* USFXAICmd_Base_CombatDrone::pClassPointer = NULL;
-
 // Class sfxgamecontent.sfxai_combatdrone
 // 0x0010 (0x06A0 - 0x0690)
 class Asfxai_combatdrone : public Asfxai_core
@@ -2889,46 +2223,28 @@ public:
 	float                                              TotalMoveTime;                                    		// 0x0698 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	float                                              MoveTimeout;                                      		// 0x069C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107494 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6119 );
 	};
 
 	void eventBioClearCrossLevelReferences ( class ULevel* ClearedLevel );
 	void PeriodicMoveCheck ( );
 };
 
-UClass* Asfxai_combatdrone::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCharacterClass_Content
 // 0x0000 (0x01CD - 0x01CD)
 class USFXCharacterClass_Content : public USFXCharacterClass
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127520 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7487 );
 	};
 
 };
 
-UClass* USFXCharacterClass_Content::pClassPointer = NULL;
-
 // Class sfxgamecontent.sfxcustomaction_revive
 // 0x000A (0x00F8 - 0x00EE)
 class Usfxcustomaction_revive : public USFXCustomAction_SingleAnim
@@ -2937,16 +2253,9 @@ public:
 	class ASFXPawn_PlayerParty*                        DownedPlayer;                                     		// 0x00F0 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bSuccessRevive : 1;                               		// 0x00F4 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127522 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7488 );
 	};
 
 	void BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime );
@@ -2960,8 +2269,6 @@ public:
 	bool InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced );
 };
 
-UClass* Usfxcustomaction_revive::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_Reload
 // 0x0017 (0x00D8 - 0x00C1)
 class USFXCustomAction_Reload : public USFXCustomAction_ReloadBase
@@ -2971,16 +2278,9 @@ public:
 	float                                              fAnimBlendInTime;                                 		// 0x00D0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	float                                              fAnimBlendOutTime;                                		// 0x00D4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127523 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7489 );
 	};
 
 	void StopCustomAction ( );
@@ -2988,8 +2288,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_Reload::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_ActivateWeaponFlashlight
 // 0x0006 (0x00F4 - 0x00EE)
 class USFXCustomAction_ActivateWeaponFlashlight : public USFXCustomAction_SingleAnim
@@ -2997,24 +2295,15 @@ class USFXCustomAction_ActivateWeaponFlashlight : public USFXCustomAction_Single
 public:
 	class USFXAnimSetCookSpec*                         AnimInfo;                                         		// 0x00F0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127524 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7490 );
 	};
 
 	void StopCustomAction ( );
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_ActivateWeaponFlashlight::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_MantleLookAt
 // 0x004A (0x016C - 0x0122)
 class USFXCustomAction_MantleLookAt : public USFXCustomAction_LookAtLoop
@@ -3027,16 +2316,9 @@ public:
 	struct FBodyStance                                 BS_Mid_Cov_Left_Loop;                             		// 0x0154 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	struct FBodyStance                                 BS_Mid_Cov_Left_End;                              		// 0x0160 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127525 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7491 );
 	};
 
 	void FlinchActionOverride ( );
@@ -3046,8 +2328,6 @@ public:
 	struct FBodyStance GetStartBodyStanceAnim ( );
 };
 
-UClass* USFXCustomAction_MantleLookAt::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_CoverSlipLookAt
 // 0x004A (0x016C - 0x0122)
 class USFXCustomAction_CoverSlipLookAt : public USFXCustomAction_LookAtLoop
@@ -3060,16 +2340,9 @@ public:
 	struct FBodyStance                                 BS_Mid_Cov_Left_Loop;                             		// 0x0154 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	struct FBodyStance                                 BS_Mid_Cov_Left_End;                              		// 0x0160 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127526 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7492 );
 	};
 
 	void FlinchActionOverride ( );
@@ -3079,8 +2352,6 @@ public:
 	struct FBodyStance GetStartBodyStanceAnim ( );
 };
 
-UClass* USFXCustomAction_CoverSlipLookAt::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_StdCoverSlipLookAt
 // 0x004A (0x016C - 0x0122)
 class USFXCustomAction_StdCoverSlipLookAt : public USFXCustomAction_LookAtLoop
@@ -3093,16 +2364,9 @@ public:
 	struct FBodyStance                                 BS_Std_Cov_Left_Loop;                             		// 0x0154 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	struct FBodyStance                                 BS_Std_Cov_Left_End;                              		// 0x0160 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127527 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7493 );
 	};
 
 	void FlinchActionOverride ( );
@@ -3112,8 +2376,6 @@ public:
 	struct FBodyStance GetStartBodyStanceAnim ( );
 };
 
-UClass* USFXCustomAction_StdCoverSlipLookAt::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_SwatTurnLookAt
 // 0x004A (0x016C - 0x0122)
 class USFXCustomAction_SwatTurnLookAt : public USFXCustomAction_LookAtLoop
@@ -3126,16 +2388,9 @@ public:
 	struct FBodyStance                                 BS_Mid_Cov_Left_Loop;                             		// 0x0154 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	struct FBodyStance                                 BS_Mid_Cov_Left_End;                              		// 0x0160 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127528 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7494 );
 	};
 
 	void FlinchActionOverride ( );
@@ -3145,8 +2400,6 @@ public:
 	struct FBodyStance GetStartBodyStanceAnim ( );
 };
 
-UClass* USFXCustomAction_SwatTurnLookAt::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_StdSwatTurnLookAt
 // 0x004A (0x016C - 0x0122)
 class USFXCustomAction_StdSwatTurnLookAt : public USFXCustomAction_LookAtLoop
@@ -3159,16 +2412,9 @@ public:
 	struct FBodyStance                                 BS_Std_Cov_Left_Loop;                             		// 0x0154 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 	struct FBodyStance                                 BS_Std_Cov_Left_End;                              		// 0x0160 (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127529 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7495 );
 	};
 
 	void FlinchActionOverride ( );
@@ -3178,8 +2424,6 @@ public:
 	struct FBodyStance GetStartBodyStanceAnim ( );
 };
 
-UClass* USFXCustomAction_StdSwatTurnLookAt::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_GapJump
 // 0x0037 (0x00F8 - 0x00C1)
 class USFXCustomAction_GapJump : public UBioCustomAction
@@ -3200,16 +2444,9 @@ public:
 	unsigned char                                      RootBoneY;                                        		// 0x00F6 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      RootBoneZ;                                        		// 0x00F7 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127530 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7496 );
 	};
 
 	bool NotifyBump ( class AActor* Other, struct FVector HitNormal );
@@ -3225,24 +2462,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_GapJump::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_StandingGapJump
 // 0x0000 (0x00F8 - 0x00F8)
 class USFXCustomAction_StandingGapJump : public USFXCustomAction_GapJump
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127531 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7497 );
 	};
 
 	bool NotifyBump ( class AActor* Other, struct FVector HitNormal );
@@ -3258,24 +2486,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_StandingGapJump::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_JumpDown
 // 0x0000 (0x0140 - 0x0140)
 class USFXCustomAction_JumpDown : public USFXCustomAction_BoostDownBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127532 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7498 );
 	};
 
 	void StopCustomAction ( );
@@ -3288,8 +2507,6 @@ public:
 	bool InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced );
 };
 
-UClass* USFXCustomAction_JumpDown::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PlayerMantleOverCover
 // 0x0070 (0x04A4 - 0x0434)
 class USFXCustomAction_PlayerMantleOverCover : public USFXCustomAction_MantleOverCoverBase
@@ -3307,16 +2524,9 @@ public:
 	unsigned long                                      bStartFromCover : 1;                              		// 0x04A0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 	unsigned long                                      bStartFromStorm : 1;                              		// 0x04A0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127533 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7499 );
 	};
 
 	void GetEndAnim ( struct FBodyStance* Stance );
@@ -3329,8 +2539,6 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_PlayerMantleOverCover::pClassPointer = NULL;
-
 // Class sfxgamecontent.sfxcustomaction_simplemovebase
 // 0x0035 (0x00F6 - 0x00C1)
 class Usfxcustomaction_simplemovebase : public UBioCustomAction
@@ -3355,16 +2563,9 @@ public:
 	unsigned char                                      RMRM;                                             		// 0x00F4 (0x0001) [0x0000000000000000]              
 	unsigned char                                      MovePhysics;                                      		// 0x00F5 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127535 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7501 );
 	};
 
 	void ClientDoCustomAction ( unsigned long bForced );
@@ -3383,8 +2584,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* Usfxcustomaction_simplemovebase::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PlayerMantleUp
 // 0x0022 (0x0118 - 0x00F6)
 class USFXCustomAction_PlayerMantleUp : public Usfxcustomaction_simplemovebase
@@ -3395,16 +2594,9 @@ public:
 	class ACoverSlotMarker*                            StartingSlot;                                     		// 0x0110 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	unsigned long                                      bStartInCover : 1;                                		// 0x0114 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127534 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7500 );
 	};
 
 	void ClientDoCustomAction ( unsigned long bForced );
@@ -3417,24 +2609,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_PlayerMantleUp::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PlayerCoverSlipLeft
 // 0x0000 (0x00EE - 0x00EE)
 class USFXCustomAction_PlayerCoverSlipLeft : public USFXCustomAction_CoverSlipBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127536 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7502 );
 	};
 
 	void BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime );
@@ -3445,24 +2628,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_PlayerCoverSlipLeft::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PlayerCoverSlipLeftStanding
 // 0x0000 (0x00EE - 0x00EE)
 class USFXCustomAction_PlayerCoverSlipLeftStanding : public USFXCustomAction_CoverSlipBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127537 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7503 );
 	};
 
 	void BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime );
@@ -3473,24 +2647,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_PlayerCoverSlipLeftStanding::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PlayerCoverSlipRight
 // 0x0000 (0x00EE - 0x00EE)
 class USFXCustomAction_PlayerCoverSlipRight : public USFXCustomAction_CoverSlipBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127538 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7504 );
 	};
 
 	void BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime );
@@ -3501,24 +2666,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_PlayerCoverSlipRight::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PlayerCoverSlipRightStanding
 // 0x0000 (0x00EE - 0x00EE)
 class USFXCustomAction_PlayerCoverSlipRightStanding : public USFXCustomAction_CoverSlipBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127539 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7505 );
 	};
 
 	void BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime );
@@ -3529,8 +2685,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_PlayerCoverSlipRightStanding::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PlayerLadderClimbUp
 // 0x0028 (0x017C - 0x0154)
 class USFXCustomAction_PlayerLadderClimbUp : public USFXCustomAction_ClimbUpBase
@@ -3543,16 +2697,9 @@ public:
 	float                                              CloseEnterDistance;                               		// 0x0174 (0x0004) [0x0000000000000000]              
 	float                                              JumpStartDistance;                                		// 0x0178 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127540 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7506 );
 	};
 
 	void StopCustomAction ( );
@@ -3567,24 +2714,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_PlayerLadderClimbUp::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PlayerLadderClimbDown
 // 0x0000 (0x0148 - 0x0148)
 class USFXCustomAction_PlayerLadderClimbDown : public USFXCustomAction_LadderClimbDownBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127541 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7507 );
 	};
 
 	void SetMoveStage ( unsigned char NextStage );
@@ -3593,8 +2731,6 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_PlayerLadderClimbDown::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PlayerEvadeLeft
 // 0x0006 (0x00F4 - 0x00EE)
 class USFXCustomAction_PlayerEvadeLeft : public USFXCustomAction_PlayerEvadeBase
@@ -3602,16 +2738,9 @@ class USFXCustomAction_PlayerEvadeLeft : public USFXCustomAction_PlayerEvadeBase
 public:
 	float                                              MoveDist;                                         		// 0x00F0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127542 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7508 );
 	};
 
 	void RollOverride ( );
@@ -3619,8 +2748,6 @@ public:
 	bool InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced );
 };
 
-UClass* USFXCustomAction_PlayerEvadeLeft::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PlayerEvadeRight
 // 0x0006 (0x00F4 - 0x00EE)
 class USFXCustomAction_PlayerEvadeRight : public USFXCustomAction_PlayerEvadeBase
@@ -3628,16 +2755,9 @@ class USFXCustomAction_PlayerEvadeRight : public USFXCustomAction_PlayerEvadeBas
 public:
 	float                                              MoveDist;                                         		// 0x00F0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127543 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7509 );
 	};
 
 	void RollOverride ( );
@@ -3645,8 +2765,6 @@ public:
 	bool InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced );
 };
 
-UClass* USFXCustomAction_PlayerEvadeRight::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PlayerEvadeForward
 // 0x0016 (0x0104 - 0x00EE)
 class USFXCustomAction_PlayerEvadeForward : public USFXCustomAction_PlayerEvadeBase
@@ -3656,16 +2774,9 @@ public:
 	float                                              MoveDist;                                         		// 0x00FC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	unsigned long                                      bHitWallEnabled : 1;                              		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127544 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7510 );
 	};
 
 	void ClientDoCustomActionImpact ( class AActor* oActor, int ImpactCount, unsigned long bFirstTarget, struct FVector HitLocation, struct FVector HitNormal, int CustomActionReactionType );
@@ -3679,8 +2790,6 @@ public:
 	bool InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced );
 };
 
-UClass* USFXCustomAction_PlayerEvadeForward::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PlayerEvadeBackwards
 // 0x0006 (0x00F4 - 0x00EE)
 class USFXCustomAction_PlayerEvadeBackwards : public USFXCustomAction_PlayerEvadeBase
@@ -3688,16 +2797,9 @@ class USFXCustomAction_PlayerEvadeBackwards : public USFXCustomAction_PlayerEvad
 public:
 	float                                              MoveDist;                                         		// 0x00F0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127545 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7511 );
 	};
 
 	void ClientDoCustomActionImpact ( class AActor* oActor, int ImpactCount, unsigned long bFirstTarget, struct FVector HitLocation, struct FVector HitNormal, int CustomActionReactionType );
@@ -3707,8 +2809,6 @@ public:
 	bool InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced );
 };
 
-UClass* USFXCustomAction_PlayerEvadeBackwards::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_MantleMelee
 // 0x000C (0x01E8 - 0x01DC)
 class USFXCustomAction_MantleMelee : public USFXCustomAction_PlayerMeleeBase
@@ -3716,16 +2816,9 @@ class USFXCustomAction_MantleMelee : public USFXCustomAction_PlayerMeleeBase
 public:
 	TArray< class AActor* >                            HitActors;                                        		// 0x01DC (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127546 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7512 );
 	};
 
 	void EndThisCustomAction ( );
@@ -3736,8 +2829,6 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_MantleMelee::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_SyncCoverGrab
 // 0x0057 (0x0194 - 0x013D)
 class USFXCustomAction_SyncCoverGrab : public USFXCustomAction_ClassMelee
@@ -3749,16 +2840,9 @@ public:
 	class ASFXReachSpecPlaceholderCylinder*            PlaceholderCylinder;                              		// 0x018C (0x0004) [0x0000000000000000]              
 	unsigned long                                      bMirroredAttack : 1;                              		// 0x0190 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127547 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7513 );
 	};
 
 	void StopCustomAction ( );
@@ -3774,8 +2858,6 @@ public:
 	void StartMeleeAttack ( );
 };
 
-UClass* USFXCustomAction_SyncCoverGrab::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_SyncCoverMelee
 // 0x000C (0x01E8 - 0x01DC)
 class USFXCustomAction_SyncCoverMelee : public USFXCustomAction_PlayerMeleeBase
@@ -3783,16 +2865,9 @@ class USFXCustomAction_SyncCoverMelee : public USFXCustomAction_PlayerMeleeBase
 public:
 	struct FBodyStance                                 BS_AnimPistol;                                    		// 0x01DC (0x000C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127548 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7514 );
 	};
 
 	void MeleeImpact ( );
@@ -3802,24 +2877,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_SyncCoverMelee::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_CoverMeleeRight
 // 0x0000 (0x01DC - 0x01DC)
 class USFXCustomAction_CoverMeleeRight : public USFXCustomAction_PlayerMeleeBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127551 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7517 );
 	};
 
 	void Breakout ( );
@@ -3835,24 +2901,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_CoverMeleeRight::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_CoverMeleeLeft
 // 0x0000 (0x01DC - 0x01DC)
 class USFXCustomAction_CoverMeleeLeft : public USFXCustomAction_CoverMeleeRight
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127550 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7516 );
 	};
 
 	void Breakout ( );
@@ -3868,24 +2925,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_CoverMeleeLeft::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_StdCoverMeleeLeft
 // 0x0000 (0x01DC - 0x01DC)
 class USFXCustomAction_StdCoverMeleeLeft : public USFXCustomAction_CoverMeleeLeft
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127549 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7515 );
 	};
 
 	void Breakout ( );
@@ -3901,24 +2949,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_StdCoverMeleeLeft::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_StdCoverMeleeRight
 // 0x0000 (0x01DC - 0x01DC)
 class USFXCustomAction_StdCoverMeleeRight : public USFXCustomAction_CoverMeleeRight
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127552 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7518 );
 	};
 
 	void Breakout ( );
@@ -3934,24 +2973,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_StdCoverMeleeRight::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_HvyCoverMeleeRight
 // 0x0000 (0x01DC - 0x01DC)
 class USFXCustomAction_HvyCoverMeleeRight : public USFXCustomAction_PlayerMeleeBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127555 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7521 );
 	};
 
 	void Breakout ( );
@@ -3967,24 +2997,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_HvyCoverMeleeRight::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_HvyCoverMeleeLeft
 // 0x0000 (0x01DC - 0x01DC)
 class USFXCustomAction_HvyCoverMeleeLeft : public USFXCustomAction_HvyCoverMeleeRight
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127554 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7520 );
 	};
 
 	void Breakout ( );
@@ -4000,24 +3021,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_HvyCoverMeleeLeft::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_HvyStdCoverMeleeLeft
 // 0x0000 (0x01DC - 0x01DC)
 class USFXCustomAction_HvyStdCoverMeleeLeft : public USFXCustomAction_HvyCoverMeleeLeft
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127553 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7519 );
 	};
 
 	void Breakout ( );
@@ -4033,24 +3045,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_HvyStdCoverMeleeLeft::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_HvyStdCoverMeleeRight
 // 0x0000 (0x01DC - 0x01DC)
 class USFXCustomAction_HvyStdCoverMeleeRight : public USFXCustomAction_HvyCoverMeleeRight
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127556 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7522 );
 	};
 
 	void Breakout ( );
@@ -4066,8 +3069,6 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_HvyStdCoverMeleeRight::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_RifleMeleeOne
 // 0x0004 (0x01E0 - 0x01DC)
 class USFXCustomAction_RifleMeleeOne : public USFXCustomAction_PlayerMeleeBase
@@ -4075,16 +3076,9 @@ class USFXCustomAction_RifleMeleeOne : public USFXCustomAction_PlayerMeleeBase
 public:
 	float                                              BladeImpactScale;                                 		// 0x01DC (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127557 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7523 );
 	};
 
 	void StopMove ( );
@@ -4099,24 +3093,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_RifleMeleeOne::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_RifleMeleeTwo
 // 0x0000 (0x01E0 - 0x01E0)
 class USFXCustomAction_RifleMeleeTwo : public USFXCustomAction_RifleMeleeOne
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127558 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7524 );
 	};
 
 	void StopMove ( );
@@ -4131,24 +3116,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_RifleMeleeTwo::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_RifleMeleeThree
 // 0x0000 (0x01E0 - 0x01E0)
 class USFXCustomAction_RifleMeleeThree : public USFXCustomAction_RifleMeleeTwo
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127559 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7525 );
 	};
 
 	void StopMove ( );
@@ -4163,24 +3139,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_RifleMeleeThree::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PistolMeleeOne
 // 0x0000 (0x01DC - 0x01DC)
 class USFXCustomAction_PistolMeleeOne : public USFXCustomAction_PlayerMeleeBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127560 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7526 );
 	};
 
 	void Breakout ( );
@@ -4196,24 +3163,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_PistolMeleeOne::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PistolMeleeTwo
 // 0x0000 (0x01DC - 0x01DC)
 class USFXCustomAction_PistolMeleeTwo : public USFXCustomAction_PistolMeleeOne
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127561 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7527 );
 	};
 
 	void Breakout ( );
@@ -4229,24 +3187,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_PistolMeleeTwo::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PistolMeleeThree
 // 0x0000 (0x01DC - 0x01DC)
 class USFXCustomAction_PistolMeleeThree : public USFXCustomAction_PistolMeleeTwo
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127562 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7528 );
 	};
 
 	void Breakout ( );
@@ -4262,24 +3211,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_PistolMeleeThree::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PlayerStandardImpact
 // 0x0000 (0x0101 - 0x0101)
 class USFXCustomAction_PlayerStandardImpact : public USFXCustomAction_DamageReaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127563 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7529 );
 	};
 
 	void ActivateImpactEmitter ( struct FVector HitLocation, struct FVector HitNormal, struct FName BoneName, class UClass* DamageType );
@@ -4293,24 +3233,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_PlayerStandardImpact::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PlayerStandardImpactForward
 // 0x0000 (0x0101 - 0x0101)
 class USFXCustomAction_PlayerStandardImpactForward : public USFXCustomAction_DamageReaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127564 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7530 );
 	};
 
 	void ActivateImpactEmitter ( struct FVector HitLocation, struct FVector HitNormal, struct FName BoneName, class UClass* DamageType );
@@ -4324,24 +3255,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_PlayerStandardImpactForward::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PlayerStandardImpactLeft
 // 0x0000 (0x0101 - 0x0101)
 class USFXCustomAction_PlayerStandardImpactLeft : public USFXCustomAction_DamageReaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127565 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7531 );
 	};
 
 	void ActivateImpactEmitter ( struct FVector HitLocation, struct FVector HitNormal, struct FName BoneName, class UClass* DamageType );
@@ -4355,24 +3277,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_PlayerStandardImpactLeft::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PlayerStandardImpactRight
 // 0x0000 (0x0101 - 0x0101)
 class USFXCustomAction_PlayerStandardImpactRight : public USFXCustomAction_DamageReaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127566 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7532 );
 	};
 
 	void ActivateImpactEmitter ( struct FVector HitLocation, struct FVector HitNormal, struct FName BoneName, class UClass* DamageType );
@@ -4386,24 +3299,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_PlayerStandardImpactRight::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PlayerMeleed
 // 0x0000 (0x0101 - 0x0101)
 class USFXCustomAction_PlayerMeleed : public USFXCustomAction_DamageReaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127567 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7533 );
 	};
 
 	void ActivateImpactEmitter ( struct FVector HitLocation, struct FVector HitNormal, struct FName BoneName, class UClass* DamageType );
@@ -4417,24 +3321,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_PlayerMeleed::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_KnockbackImpactForward
 // 0x0000 (0x0101 - 0x0101)
 class USFXCustomAction_KnockbackImpactForward : public USFXCustomAction_DamageReaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127568 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7534 );
 	};
 
 	void ActivateImpactEmitter ( struct FVector HitLocation, struct FVector HitNormal, struct FName BoneName, class UClass* DamageType );
@@ -4448,24 +3343,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_KnockbackImpactForward::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_MeleedLeft
 // 0x0000 (0x0101 - 0x0101)
 class USFXCustomAction_MeleedLeft : public USFXCustomAction_DamageReaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127569 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7535 );
 	};
 
 	void ActivateImpactEmitter ( struct FVector HitLocation, struct FVector HitNormal, struct FName BoneName, class UClass* DamageType );
@@ -4479,24 +3365,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_MeleedLeft::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_MeleedRight
 // 0x0000 (0x0101 - 0x0101)
 class USFXCustomAction_MeleedRight : public USFXCustomAction_DamageReaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127570 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7536 );
 	};
 
 	void ActivateImpactEmitter ( struct FVector HitLocation, struct FVector HitNormal, struct FName BoneName, class UClass* DamageType );
@@ -4510,24 +3387,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_MeleedRight::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_KnockbackImpact
 // 0x0000 (0x0101 - 0x0101)
 class USFXCustomAction_KnockbackImpact : public USFXCustomAction_DamageReaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127571 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7537 );
 	};
 
 	void ActivateImpactEmitter ( struct FVector HitLocation, struct FVector HitNormal, struct FName BoneName, class UClass* DamageType );
@@ -4541,24 +3409,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_KnockbackImpact::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_KnockbackImpactLeft
 // 0x0000 (0x0101 - 0x0101)
 class USFXCustomAction_KnockbackImpactLeft : public USFXCustomAction_DamageReaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127572 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7538 );
 	};
 
 	void ActivateImpactEmitter ( struct FVector HitLocation, struct FVector HitNormal, struct FName BoneName, class UClass* DamageType );
@@ -4572,24 +3431,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_KnockbackImpactLeft::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_KnockbackImpactRight
 // 0x0000 (0x0101 - 0x0101)
 class USFXCustomAction_KnockbackImpactRight : public USFXCustomAction_DamageReaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127573 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7539 );
 	};
 
 	void ActivateImpactEmitter ( struct FVector HitLocation, struct FVector HitNormal, struct FName BoneName, class UClass* DamageType );
@@ -4603,24 +3453,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_KnockbackImpactRight::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_MeleedForward
 // 0x0000 (0x0101 - 0x0101)
 class USFXCustomAction_MeleedForward : public USFXCustomAction_DamageReaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127574 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7540 );
 	};
 
 	void ActivateImpactEmitter ( struct FVector HitLocation, struct FVector HitNormal, struct FName BoneName, class UClass* DamageType );
@@ -4634,8 +3475,6 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_MeleedForward::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_FlinchBase
 // 0x0090 (0x017E - 0x00EE)
 class USFXCustomAction_FlinchBase : public USFXCustomAction_SingleAnim
@@ -4659,16 +3498,9 @@ public:
 	unsigned char                                      CoverType;                                        		// 0x017C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 	unsigned char                                      CoverAction;                                      		// 0x017D (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127576 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7542 );
 	};
 
 	void PlayImpactSound ( );
@@ -4681,24 +3513,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_FlinchBase::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_FlinchLight
 // 0x0000 (0x017E - 0x017E)
 class USFXCustomAction_FlinchLight : public USFXCustomAction_FlinchBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127575 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7541 );
 	};
 
 	void PlayImpactSound ( );
@@ -4711,24 +3534,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_FlinchLight::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_FlinchHeavy
 // 0x0000 (0x017E - 0x017E)
 class USFXCustomAction_FlinchHeavy : public USFXCustomAction_FlinchBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127577 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7543 );
 	};
 
 	void PlayImpactSound ( );
@@ -4741,24 +3555,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_FlinchHeavy::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PlayerOnFire
 // 0x0000 (0x0101 - 0x0101)
 class USFXCustomAction_PlayerOnFire : public USFXCustomAction_DamageReaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127578 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7544 );
 	};
 
 	void ActivateImpactEmitter ( struct FVector HitLocation, struct FVector HitNormal, struct FName BoneName, class UClass* DamageType );
@@ -4772,24 +3577,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_PlayerOnFire::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_AdeptPunch
 // 0x0000 (0x0144 - 0x0144)
 class USFXCustomAction_AdeptPunch : public USFXCustomAction_PlayerHeavyMeleeBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127584 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7547 );
 	};
 
 	void StopCustomAction ( );
@@ -4801,46 +3597,28 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_AdeptPunch::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_AdeptHeavyMelee
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_AdeptHeavyMelee : public USFXDamageType_HeavyMelee
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127595 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7548 );
 	};
 
 };
 
-UClass* USFXDamageType_AdeptHeavyMelee::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXSeqEvt_PerformedMeleeOverCover
 // 0x0000 (0x00D2 - 0x00D2)
 class USFXSeqEvt_PerformedMeleeOverCover : public USequenceEvent
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127602 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7550 );
 	};
 
 	void eventToggled ( );
@@ -4850,24 +3628,15 @@ public:
 	void eventRegisterEvent ( );
 };
 
-UClass* USFXSeqEvt_PerformedMeleeOverCover::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_AdeptSyncCoverGrab
 // 0x0000 (0x0194 - 0x0194)
 class USFXCustomAction_AdeptSyncCoverGrab : public USFXCustomAction_SyncCoverGrab
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127652 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7561 );
 	};
 
 	void StopCustomAction ( );
@@ -4883,24 +3652,15 @@ public:
 	void StartMeleeAttack ( );
 };
 
-UClass* USFXCustomAction_AdeptSyncCoverGrab::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_Meleed
 // 0x0000 (0x0101 - 0x0101)
 class USFXCustomAction_Meleed : public USFXCustomAction_DamageReaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127845 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7597 );
 	};
 
 	void ActivateImpactEmitter ( struct FVector HitLocation, struct FVector HitNormal, struct FName BoneName, class UClass* DamageType );
@@ -4914,24 +3674,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_Meleed::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_DisableAI
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_DisableAI : public USFXGameEffect
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 127879 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7598 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -4947,24 +3698,15 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_DisableAI::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PlayerKnockbackImpact
 // 0x0000 (0x0101 - 0x0101)
 class USFXCustomAction_PlayerKnockbackImpact : public USFXCustomAction_DamageReaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128005 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7619 );
 	};
 
 	void ActivateImpactEmitter ( struct FVector HitLocation, struct FVector HitNormal, struct FName BoneName, class UClass* DamageType );
@@ -4978,24 +3720,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_PlayerKnockbackImpact::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXCustomAction_PlayerStaggerImpact
 // 0x0000 (0x0101 - 0x0101)
 class USFXCustomAction_PlayerStaggerImpact : public USFXCustomAction_DamageReaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128168 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7660 );
 	};
 
 	void ActivateImpactEmitter ( struct FVector HitLocation, struct FVector HitNormal, struct FName BoneName, class UClass* DamageType );
@@ -5009,90 +3742,54 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_PlayerStaggerImpact::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_AdeptHeavyMelee_NoRagdoll
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_AdeptHeavyMelee_NoRagdoll : public USFXDamageType_AdeptHeavyMelee
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128354 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7703 );
 	};
 
 };
 
-UClass* USFXDamageType_AdeptHeavyMelee_NoRagdoll::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_BioticExplosion
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_BioticExplosion : public USFXDamageType_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128357 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7704 );
 	};
 
 };
 
-UClass* USFXDamageType_BioticExplosion::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_BioticExplosion_NoRagdoll
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_BioticExplosion_NoRagdoll : public USFXDamageType_BioticExplosion
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128360 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7705 );
 	};
 
 };
 
-UClass* USFXDamageType_BioticExplosion_NoRagdoll::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_HeavyPistol
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_HeavyPistol : public USFXDamageType_Weapon
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128363 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7706 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -5100,244 +3797,145 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_HeavyPistol::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_Warp
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_Warp : public USFXDamageType_Power_Fire
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128366 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7707 );
 	};
 
 };
 
-UClass* USFXDamageType_Warp::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_ImprovedWarp
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_ImprovedWarp : public USFXDamageType_Warp
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128371 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7708 );
 	};
 
 };
 
-UClass* USFXDamageType_ImprovedWarp::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_WarpDoT
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_WarpDoT : public USFXDamageType_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128374 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7709 );
 	};
 
 };
 
-UClass* USFXDamageType_WarpDoT::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_ImprovedWarpDoT
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_ImprovedWarpDoT : public USFXDamageType_WarpDoT
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128377 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7710 );
 	};
 
 };
 
-UClass* USFXDamageType_ImprovedWarpDoT::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_Shockwave
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_Shockwave : public USFXDamageType_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128380 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7711 );
 	};
 
 };
 
-UClass* USFXDamageType_Shockwave::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_Shockwave_NoRagdoll
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_Shockwave_NoRagdoll : public USFXDamageType_Shockwave
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128383 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7712 );
 	};
 
 };
 
-UClass* USFXDamageType_Shockwave_NoRagdoll::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_Singularity
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_Singularity : public USFXDamageType_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128386 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7713 );
 	};
 
 };
 
-UClass* USFXDamageType_Singularity::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_Singularity_DoT
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_Singularity_DoT : public USFXDamageType_Singularity
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128389 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7714 );
 	};
 
 };
 
-UClass* USFXDamageType_Singularity_DoT::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_Singularity_Explosion
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_Singularity_Explosion : public USFXDamageType_Singularity
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128392 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7715 );
 	};
 
 };
 
-UClass* USFXDamageType_Singularity_Explosion::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_Singularity_NoRagdoll
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_Singularity_NoRagdoll : public USFXDamageType_Singularity
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128395 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7716 );
 	};
 
 };
 
-UClass* USFXDamageType_Singularity_NoRagdoll::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_AntiGravity
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_AntiGravity : public USFXGameEffect_PhysicsPower
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128398 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7717 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -5353,24 +3951,15 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_AntiGravity::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_BioticPowerDamageTakenBonus
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_BioticPowerDamageTakenBonus : public USFXGameEffect
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128406 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7718 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -5386,24 +3975,15 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_BioticPowerDamageTakenBonus::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_PartBasedDamageBonus
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_PartBasedDamageBonus : public USFXGameEffect
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128419 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7719 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -5419,24 +3999,15 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_PartBasedDamageBonus::pClassPointer = NULL;
-
 // Class sfxgamecontent.sfxgameeffect_powercombo_biotic
 // 0x0000 (0x00F0 - 0x00F0)
 class Usfxgameeffect_powercombo_biotic : public Usfxgameeffect_powercombo
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128425 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7720 );
 	};
 
 	void ClientDoPowerComboImpact ( class AActor* oActor, int CustomActionReactionType, float DetonationPowerRank, int MiscFlags );
@@ -5449,68 +4020,41 @@ public:
 	void OnApplied ( );
 };
 
-UClass* Usfxgameeffect_powercombo_biotic::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXShake_Power_BioticCombo
 // 0x0000 (0x00BC - 0x00BC)
 class USFXShake_Power_BioticCombo : public USFXShake_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128431 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7721 );
 	};
 
 };
 
-UClass* USFXShake_Power_BioticCombo::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXRumble_Power_BioticCombo
 // 0x0000 (0x0048 - 0x0048)
 class USFXRumble_Power_BioticCombo : public USFXRumble_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128432 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7722 );
 	};
 
 };
 
-UClass* USFXRumble_Power_BioticCombo::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_Ragdoll
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_Ragdoll : public USFXGameEffect_PhysicsPower
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128438 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7723 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -5526,8 +4070,6 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_Ragdoll::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_ShockwaveLift
 // 0x000A (0x006C - 0x0062)
 class USFXGameEffect_ShockwaveLift : public USFXGameEffect_PhysicsPower
@@ -5536,16 +4078,9 @@ public:
 	float                                              GravityValue;                                     		// 0x0064 (0x0004) [0x0000000000000000]              
 	float                                              ForceDrag;                                        		// 0x0068 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128446 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7724 );
 	};
 
 	bool HasOtherGravityEffects ( );
@@ -5554,8 +4089,6 @@ public:
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_ShockwaveLift::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_Singularity
 // 0x003E (0x00A0 - 0x0062)
 class USFXGameEffect_Singularity : public USFXGameEffect_PhysicsPower
@@ -5574,16 +4107,9 @@ public:
 	class Usfxpowercustomaction_singularity*           Power;                                            		// 0x0098 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bApplied : 1;                                     		// 0x009C (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128459 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7729 );
 	};
 
 	bool OutOfRangeCheck ( float Distance );
@@ -5595,8 +4121,6 @@ public:
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_Singularity::pClassPointer = NULL;
-
 // Class sfxgamecontent.sfxpowercustomaction_singularity
 // 0x020B (0x08A0 - 0x0695)
 class Usfxpowercustomaction_singularity : public Usfxpowercustomaction
@@ -5641,16 +4165,9 @@ public:
 	unsigned long                                      m_bSingularityActive : 1;                         		// 0x089C (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      Patch4IterationApplied : 1;                       		// 0x089C (0x0004) [0x0000000000004000] [0x00000002] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128491 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7737 );
 	};
 
 	void CombatEnded ( );
@@ -5683,8 +4200,6 @@ public:
 	void OnPowersLoaded ( );
 };
 
-UClass* Usfxpowercustomaction_singularity::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_Stasis
 // 0x002F (0x00B0 - 0x0081)
 class USFXGameEffect_Stasis : public USFXGameEffect_WeldPhysics
@@ -5701,16 +4216,9 @@ public:
 	unsigned long                                      bWasInMatinee : 1;                                		// 0x00AC (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned long                                      bWasDisabled : 1;                                 		// 0x00AC (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128493 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7738 );
 	};
 
 	void OnRemoved ( );
@@ -5721,8 +4229,6 @@ public:
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_Stasis::pClassPointer = NULL;
-
 // Class sfxgamecontent.sfxpowercustomaction_stasis
 // 0x0134 (0x07C9 - 0x0695)
 class Usfxpowercustomaction_stasis : public Usfxpowercustomaction
@@ -5754,16 +4260,9 @@ public:
 	unsigned long                                      bClientCanProcessNoCooldown : 1;                  		// 0x07C4 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 	unsigned char                                      ClientNoCooldown;                                 		// 0x07C8 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128519 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7745 );
 	};
 
 	void PopulatePowerStatBarEvolves ( );
@@ -5789,24 +4288,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* Usfxpowercustomaction_stasis::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_WeaponDamageTakenBonus
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_WeaponDamageTakenBonus : public USFXGameEffect
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128524 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7746 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -5822,8 +4312,6 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_WeaponDamageTakenBonus::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_WeaponWeightModifier
 // 0x000E (0x0070 - 0x0062)
 class USFXGameEffect_WeaponWeightModifier : public USFXGameEffect
@@ -5831,40 +4319,24 @@ class USFXGameEffect_WeaponWeightModifier : public USFXGameEffect
 public:
 	TArray< unsigned char >                            WeaponClasses;                                    		// 0x0064 (0x000C) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128530 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7747 );
 	};
 
 	void OnRemoved ( );
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_WeaponWeightModifier::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_WeightCapacity
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_WeightCapacity : public USFXGameEffect
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128540 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7750 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -5880,8 +4352,6 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_WeightCapacity::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXPowerCustomAction_Shockwave
 // 0x015B (0x07F0 - 0x0695)
 class USFXPowerCustomAction_Shockwave : public Usfxpowercustomaction
@@ -5906,16 +4376,9 @@ public:
 	class UWwiseEvent*                                 ImpactActorSound;                                 		// 0x07E8 (0x0004) [0x0000000000000000]              
 	int                                                NumTargetsHit;                                    		// 0x07EC (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128546 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7751 );
 	};
 
 	void PopulatePowerStatBarEvolves ( );
@@ -5931,8 +4394,6 @@ public:
 	class ASFXProjectile_PowerCustomAction* ReleaseProjectilePower ( );
 };
 
-UClass* USFXPowerCustomAction_Shockwave::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXProjectile_PowerCustomAction_Shockwave
 // 0x001C (0x0440 - 0x0424)
 class ASFXProjectile_PowerCustomAction_Shockwave : public ASFXProjectile_PowerCustomAction
@@ -5946,16 +4407,9 @@ public:
 	class UWwiseEvent*                                 LastShockwaveSound;                               		// 0x0438 (0x0004) [0x0000000000000000]              
 	class UWwiseEvent*                                 HenchmanLastShockwaveSound;                       		// 0x043C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128558 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7753 );
 	};
 
 	void ReplicateExplode ( struct FVector HitLocation, struct FVector HitNormal );
@@ -5965,74 +4419,45 @@ public:
 	void eventHitWall ( struct FVector HitNormal, class AActor* Wall, class UPrimitiveComponent* WallComp );
 };
 
-UClass* ASFXProjectile_PowerCustomAction_Shockwave::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXRumble_Power_HeavyImpact
 // 0x0000 (0x0048 - 0x0048)
 class USFXRumble_Power_HeavyImpact : public USFXRumble_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128632 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7764 );
 	};
 
 };
 
-UClass* USFXRumble_Power_HeavyImpact::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXShake_Power_Shockwave
 // 0x0000 (0x00BC - 0x00BC)
 class USFXShake_Power_Shockwave : public USFXShake_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128633 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7765 );
 	};
 
 };
 
-UClass* USFXShake_Power_Shockwave::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXShake_Power_HeavyImpact
 // 0x0000 (0x00BC - 0x00BC)
 class USFXShake_Power_HeavyImpact : public USFXShake_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128634 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7766 );
 	};
 
 };
 
-UClass* USFXShake_Power_HeavyImpact::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXProjectile_PowerCustomAction_SuperSeeking
 // 0x0027 (0x048C - 0x0465)
 class ASFXProjectile_PowerCustomAction_SuperSeeking : public Asfxprojectile_powercustomaction_seeking
@@ -6046,24 +4471,15 @@ public:
 	float                                              OffsetAimMaxDistance;                             		// 0x0484 (0x0004) [0x0000000000000000]              
 	float                                              OffsetAimMinDistance;                             		// 0x0488 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128814 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7795 );
 	};
 
 	void InitializeRotation ( class APawn* oCasterPawn );
 	void TickAimRotation ( float DeltaTime, struct FVector SeekVector );
 };
 
-UClass* ASFXProjectile_PowerCustomAction_SuperSeeking::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXPowerCustomAction_Warp
 // 0x00B7 (0x074C - 0x0695)
 class USFXPowerCustomAction_Warp : public Usfxpowercustomaction
@@ -6086,16 +4502,9 @@ public:
 	float                                              InstantDamagePercent;                             		// 0x0744 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	class URvrClientEffectInterface*                   CE_DeathEffect;                                   		// 0x0748 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 128947 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7817 );
 	};
 
 	void PopulatePowerStatBarEvolves ( );
@@ -6109,24 +4518,15 @@ public:
 	float GetImpactDamage ( class AActor* oImpacted, class UClass** DamageType );
 };
 
-UClass* USFXPowerCustomAction_Warp::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXShield_Biotic_Player
 // 0x0000 (0x03D0 - 0x03D0)
 class ASFXShield_Biotic_Player : public Asfxshield_player
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129090 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7834 );
 	};
 
 	void BeginRecharge ( );
@@ -6138,24 +4538,15 @@ public:
 	void PrecacheVFX ( class ASFXObjectPool* ObjectPool, class URvrClientEffectManager* ClientEffects );
 };
 
-UClass* ASFXShield_Biotic_Player::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXWeapon_AssaultRifle_Avenger
 // 0x0000 (0x0DD8 - 0x0DD8)
 class ASFXWeapon_AssaultRifle_Avenger : public ASFXWeapon_AssaultRifle_Base
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129096 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7835 );
 	};
 
 	unsigned char GetStoreQualification ( );
@@ -6166,24 +4557,15 @@ public:
 	bool ShouldSpawnTracerFX ( );
 };
 
-UClass* ASFXWeapon_AssaultRifle_Avenger::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXWeapon_Pistol_Predator
 // 0x0000 (0x0DD2 - 0x0DD2)
 class ASFXWeapon_Pistol_Predator : public ASFXWeapon_Pistol_Base
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129122 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7836 );
 	};
 
 	void GiveWeaponCodex ( );
@@ -6380,46 +4762,28 @@ public:
 	void OnWeaponImpact ( class ASFXWeapon* Weapon, struct FImpactInfo Impact );
 };
 
-UClass* ASFXWeapon_Pistol_Predator::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_CryoFreeze
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_CryoFreeze : public USFXDamageType_Power_Freeze
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135541 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7922 );
 	};
 
 };
 
-UClass* USFXDamageType_CryoFreeze::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_Shotgun
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_Shotgun : public USFXDamageType_Weapon
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135544 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7923 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -6427,24 +4791,15 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_Shotgun::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_MaxGrenadeBonus
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_MaxGrenadeBonus : public USFXGameEffect
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135547 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7924 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -6460,24 +4815,15 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_MaxGrenadeBonus::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_MeleeDamageBonus
 // 0x0000 (0x007C - 0x007C)
 class USFXGameEffect_MeleeDamageBonus : public USFXGameEffect_PowerBonus
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135555 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7925 );
 	};
 
 	void ApplyBonus ( unsigned long bRemove );
@@ -6486,24 +4832,15 @@ public:
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_MeleeDamageBonus::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_WeaponStabilityBonus
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_WeaponStabilityBonus : public USFXGameEffect
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135557 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7926 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -6519,8 +4856,6 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_WeaponStabilityBonus::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGUI_ShotgunReticle
 // 0x001C (0x00A8 - 0x008C)
 class USFXGUI_ShotgunReticle : public USFXGUI_WeaponReticleBase
@@ -6532,16 +4867,9 @@ public:
 	float                                              ReticleOpacity;                                   		// 0x00A0 (0x0004) [0x0000000000000000]              
 	float                                              RadiusModifier;                                   		// 0x00A4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135563 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7927 );
 	};
 
 	void eventResetReticle ( unsigned long bUnsubscribe );
@@ -6552,8 +4880,6 @@ public:
 	void OnReticleLoaded ( );
 };
 
-UClass* USFXGUI_ShotgunReticle::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXPowerCustomAction_CryoBlast
 // 0x00F7 (0x078C - 0x0695)
 class USFXPowerCustomAction_CryoBlast : public Usfxpowercustomaction
@@ -6577,16 +4903,9 @@ public:
 	float                                              TimeDilationMin;                                  		// 0x0784 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	float                                              TimeDilationMax;                                  		// 0x0788 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135590 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7934 );
 	};
 
 	void PopulatePowerStatBarEvolves ( );
@@ -6602,8 +4921,6 @@ public:
 	bool OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector HitLocation, struct FVector HitNormal );
 };
 
-UClass* USFXPowerCustomAction_CryoBlast::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXPowerCustomAction_GrenadeBase
 // 0x0007 (0x069C - 0x0695)
 class USFXPowerCustomAction_GrenadeBase : public Usfxpowercustomaction
@@ -6611,16 +4928,9 @@ class USFXPowerCustomAction_GrenadeBase : public Usfxpowercustomaction
 public:
 	void*                                              srNoGrenades;                                     		// 0x0698 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135683 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7946 );
 	};
 
 	struct FString eventGetHUDWheelIconInfo ( );
@@ -6637,68 +4947,41 @@ public:
 	void OnPowersLoaded ( );
 };
 
-UClass* USFXPowerCustomAction_GrenadeBase::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXRumble_Power_BioticCharge
 // 0x0000 (0x0048 - 0x0048)
 class USFXRumble_Power_BioticCharge : public USFXRumble_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135715 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7959 );
 	};
 
 };
 
-UClass* USFXRumble_Power_BioticCharge::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXShake_Power_BioticCharge
 // 0x0000 (0x00BC - 0x00BC)
 class USFXShake_Power_BioticCharge : public USFXShake_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135718 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7960 );
 	};
 
 };
 
-UClass* USFXShake_Power_BioticCharge::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXShield_Energy_Player
 // 0x0000 (0x03D0 - 0x03D0)
 class ASFXShield_Energy_Player : public Asfxshield_player
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135720 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7961 );
 	};
 
 	void BeginRecharge ( );
@@ -6710,24 +4993,15 @@ public:
 	void PrecacheVFX ( class ASFXObjectPool* ObjectPool, class URvrClientEffectManager* ClientEffects );
 };
 
-UClass* ASFXShield_Energy_Player::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXWeapon_Shotgun_Katana
 // 0x0000 (0x0E5C - 0x0E5C)
 class ASFXWeapon_Shotgun_Katana : public ASFXWeapon_Shotgun_Base
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135723 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7962 );
 	};
 
 	unsigned char GetStoreQualification ( );
@@ -6745,24 +5019,15 @@ public:
 	void ScaleWeapon ( );
 };
 
-UClass* ASFXWeapon_Shotgun_Katana::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_Falcon
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_Falcon : public USFXDamageType
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 138287 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8065 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -6770,24 +5035,15 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_Falcon::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXDamageType_Gib
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_Gib : public USFXDamageType_Weapon
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 138290 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8066 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -6795,8 +5051,6 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_Gib::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXProjectile_Proximity
 // 0x0083 (0x0414 - 0x0391)
 class ASFXProjectile_Proximity : public ASFXProjectile_Explosive
@@ -6806,16 +5060,9 @@ public:
 	float                                              TimeAlive;                                        		// 0x040C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	float                                              ProximityRadius;                                  		// 0x0410 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 138297 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8067 );
 	};
 
 	void Recycle ( );
@@ -6826,8 +5073,6 @@ public:
 	void TickProximity ( );
 };
 
-UClass* ASFXProjectile_Proximity::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXProjectile_SeekingMissile
 // 0x006B (0x03FC - 0x0391)
 class ASFXProjectile_SeekingMissile : public ASFXProjectile_Explosive
@@ -6851,16 +5096,9 @@ public:
 	unsigned long                                      LostTarget : 1;                                   		// 0x03F8 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      bExplodeNextFrame : 1;                            		// 0x03F8 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 138334 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8074 );
 	};
 
 	void Recycle ( );
@@ -6878,207 +5116,126 @@ public:
 	void AcquireTarget ( );
 };
 
-UClass* ASFXProjectile_SeekingMissile::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXShake_SeekingMissile
 // 0x0000 (0x00BC - 0x00BC)
 class USFXShake_SeekingMissile : public USFXShake_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 138395 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8088 );
 	};
 
 };
 
-UClass* USFXShake_SeekingMissile::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_WeaponMod_AccuracyBonus
 // 0x0000 (0x0069 - 0x0069)
 class USFXGameEffect_WeaponMod_AccuracyBonus : public USFXGameEffect_WeaponMod
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 140394 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8119 );
 	};
 
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_WeaponMod_AccuracyBonus::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_WeaponMod_ArmorPiercingBonus
 // 0x0000 (0x0069 - 0x0069)
 class USFXGameEffect_WeaponMod_ArmorPiercingBonus : public USFXGameEffect_WeaponMod
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 140400 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8120 );
 	};
 
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_WeaponMod_ArmorPiercingBonus::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_WeaponMod_CrosshairModifier
 // 0x0000 (0x0069 - 0x0069)
 class USFXGameEffect_WeaponMod_CrosshairModifier : public USFXGameEffect_WeaponMod
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 140404 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8121 );
 	};
 
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_WeaponMod_CrosshairModifier::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_WeaponMod_DamageBonus
 // 0x0000 (0x0069 - 0x0069)
 class USFXGameEffect_WeaponMod_DamageBonus : public USFXGameEffect_WeaponMod
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 140410 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8122 );
 	};
 
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_WeaponMod_DamageBonus::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_WeaponMod_MeleeDmgBonus
 // 0x0000 (0x0069 - 0x0069)
 class USFXGameEffect_WeaponMod_MeleeDmgBonus : public USFXGameEffect_WeaponMod
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 140416 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8123 );
 	};
 
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_WeaponMod_MeleeDmgBonus::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_WeaponMod_PenetrationBonus
 // 0x0000 (0x0069 - 0x0069)
 class USFXGameEffect_WeaponMod_PenetrationBonus : public USFXGameEffect_WeaponMod
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 140420 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8124 );
 	};
 
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_WeaponMod_PenetrationBonus::pClassPointer = NULL;
-
 // Class sfxgamecontent.sfxgameeffect_weaponmod_penetrationdamagebonus
 // 0x0000 (0x0069 - 0x0069)
 class Usfxgameeffect_weaponmod_penetrationdamagebonus : public USFXGameEffect_WeaponMod
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 140424 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8125 );
 	};
 
 	void OnApplied ( );
 };
 
-UClass* Usfxgameeffect_weaponmod_penetrationdamagebonus::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXGameEffect_WeaponMod_SpareAmmoBonus
 // 0x0000 (0x0062 - 0x0062)
 class USFXGameEffect_WeaponMod_SpareAmmoBonus : public USFXGameEffect
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 140430 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8126 );
 	};
 
 	class AController* CheckOwnerInstigator ( class AController* Attacker );
@@ -7094,24 +5251,15 @@ public:
 	void ComputeCustomEffectValue ( float* Value );
 };
 
-UClass* USFXGameEffect_WeaponMod_SpareAmmoBonus::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXWeaponMod_ShotgunAccuracy
 // 0x0000 (0x00EE - 0x00EE)
 class USFXWeaponMod_ShotgunAccuracy : public USFXWeaponMod
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 140437 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8127 );
 	};
 
 	class UClass* GetGameEffectClass ( struct FName EffectClassName );
@@ -7127,24 +5275,15 @@ public:
 	int GetMaxRank ( );
 };
 
-UClass* USFXWeaponMod_ShotgunAccuracy::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXWeaponMod_ShotgunDamage
 // 0x0000 (0x00EE - 0x00EE)
 class USFXWeaponMod_ShotgunDamage : public USFXWeaponMod
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 140440 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8128 );
 	};
 
 	class UClass* GetGameEffectClass ( struct FName EffectClassName );
@@ -7160,8 +5299,6 @@ public:
 	int GetMaxRank ( );
 };
 
-UClass* USFXWeaponMod_ShotgunDamage::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXWeaponMod_ShotgunMeleeDamage
 // 0x000A (0x00F8 - 0x00EE)
 class USFXWeaponMod_ShotgunMeleeDamage : public USFXWeaponMod
@@ -7170,40 +5307,24 @@ public:
 	class UParticleSystem*                             BladeImpactEffect;                                		// 0x00F0 (0x0004) [0x0000000000000000]              
 	class UWwiseEvent*                                 BladeImpactSound;                                 		// 0x00F4 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 140448 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8129 );
 	};
 
 	void RemoveEffects ( );
 	void ApplyEffects ( );
 };
 
-UClass* USFXWeaponMod_ShotgunMeleeDamage::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXWeaponMod_ShotgunReloadSpeed
 // 0x0000 (0x00EE - 0x00EE)
 class USFXWeaponMod_ShotgunReloadSpeed : public USFXWeaponMod
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 140462 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8132 );
 	};
 
 	class UClass* GetGameEffectClass ( struct FName EffectClassName );
@@ -7219,24 +5340,15 @@ public:
 	int GetMaxRank ( );
 };
 
-UClass* USFXWeaponMod_ShotgunReloadSpeed::pClassPointer = NULL;
-
 // Class sfxgamecontent.SFXWeaponMod_ShotgunStability
 // 0x0000 (0x00EE - 0x00EE)
 class USFXWeaponMod_ShotgunStability : public USFXWeaponMod
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 140465 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8133 );
 	};
 
 	class UClass* GetGameEffectClass ( struct FName EffectClassName );
@@ -7252,8 +5364,6 @@ public:
 	int GetMaxRank ( );
 };
 
-UClass* USFXWeaponMod_ShotgunStability::pClassPointer = NULL;
-
 
 #ifdef _MSC_VER
 	#pragma pack ( pop )
@@ -53,16 +53,9 @@ public:
 	float                                              WaveStartedTimestamp2;                            		// 0x016C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 	float                                              MinDistanceToDropOffZone;                         		// 0x0170 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 124480 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7394 );
 	};
 
 	void PlayDroppedOffVO ( );
@@ -77,8 +70,6 @@ public:
 	bool BeginWave ( );
 };
 
-UClass* Usfxengagement_retrieve_dlc::pClassPointer = NULL;
-
 
 #ifdef _MSC_VER
 	#pragma pack ( pop )
@@ -27,10 +27,9 @@
 
 void Usfxengagement_retrieve_dlc::PlayDroppedOffVO ( )
 {
-	static UFunction* pFnPlayDroppedOffVO = NULL;
-
+	UFunction* pFnPlayDroppedOffVO = (UFunction*) SdkBindings::Get ( 7404 );
 	if ( ! pFnPlayDroppedOffVO )
-		pFnPlayDroppedOffVO = (UFunction*) UObject::GObjObjects()->Data[ 124563 ];
+		return;
 
 	Usfxengagement_retrieve_dlc_execPlayDroppedOffVO_Parms PlayDroppedOffVO_Parms;
 
@@ -45,10 +44,9 @@ void Usfxengagement_retrieve_dlc::PlayDroppedOffVO ( )
 
 void Usfxengagement_retrieve_dlc::PickupDroppedOff ( class ASFXPawn_Player* Player, class Asfxoperationobjective* Pickup )
 {
-	static UFunction* pFnPickupDroppedOff = NULL;
-
+	UFunction* pFnPickupDroppedOff = (UFunction*) SdkBindings::Get ( 7403 );
 	if ( ! pFnPickupDroppedOff )
-		pFnPickupDroppedOff = (UFunction*) UObject::GObjObjects()->Data[ 124556 ];
+		return;
 
 	Usfxengagement_retrieve_dlc_execPickupDroppedOff_Parms PickupDroppedOff_Parms;
 	PickupDroppedOff_Parms.Player = Player;
@@ -64,10 +62,9 @@ void Usfxengagement_retrieve_dlc::PickupDroppedOff ( class ASFXPawn_Player* Play
 
 void Usfxengagement_retrieve_dlc::PlayerDroppedObject ( class ASFXPawn_Player* Player )
 {
-	static UFunction* pFnPlayerDroppedObject = NULL;
-
+	UFunction* pFnPlayerDroppedObject = (UFunction*) SdkBindings::Get ( 7402 );
 	if ( ! pFnPlayerDroppedObject )
-		pFnPlayerDroppedObject = (UFunction*) UObject::GObjObjects()->Data[ 124554 ];
+		return;
 
 	Usfxengagement_retrieve_dlc_execPlayerDroppedObject_Parms PlayerDroppedObject_Parms;
 	PlayerDroppedObject_Parms.Player = Player;
@@ -82,10 +79,9 @@ void Usfxengagement_retrieve_dlc::PlayerDroppedObject ( class ASFXPawn_Player* P
 
 void Usfxengagement_retrieve_dlc::PlayerPickedUpObject ( class ASFXPawn_Player* Player )
 {
-	static UFunction* pFnPlayerPickedUpObject = NULL;
-
+	UFunction* pFnPlayerPickedUpObject = (UFunction*) SdkBindings::Get ( 7401 );
 	if ( ! pFnPlayerPickedUpObject )
-		pFnPlayerPickedUpObject = (UFunction*) UObject::GObjObjects()->Data[ 124552 ];
+		return;
 
 	Usfxengagement_retrieve_dlc_execPlayerPickedUpObject_Parms PlayerPickedUpObject_Parms;
 	PlayerPickedUpObject_Parms.Player = Player;
@@ -101,10 +97,9 @@ void Usfxengagement_retrieve_dlc::PlayerPickedUpObject ( class ASFXPawn_Player*
 
 bool Usfxengagement_retrieve_dlc::IsCarryingPickup ( class ASFXPawn_Player* Player )
 {
-	static UFunction* pFnIsCarryingPickup = NULL;
-
+	UFunction* pFnIsCarryingPickup = (UFunction*) SdkBindings::Get ( 7400 );
 	if ( ! pFnIsCarryingPickup )
-		pFnIsCarryingPickup = (UFunction*) UObject::GObjObjects()->Data[ 124549 ];
+		return {};
 
 	Usfxengagement_retrieve_dlc_execIsCarryingPickup_Parms IsCarryingPickup_Parms;
 	IsCarryingPickup_Parms.Player = Player;
@@ -120,10 +115,9 @@ bool Usfxengagement_retrieve_dlc::IsCarryingPickup ( class ASFXPawn_Player* Play
 
 void Usfxengagement_retrieve_dlc::UpdateObjectiveStatus ( )
 {
-	static UFunction* pFnUpdateObjectiveStatus = NULL;
-
+	UFunction* pFnUpdateObjectiveStatus = (UFunction*) SdkBindings::Get ( 7399 );
 	if ( ! pFnUpdateObjectiveStatus )
-		pFnUpdateObjectiveStatus = (UFunction*) UObject::GObjObjects()->Data[ 124548 ];
+		return;
 
 	Usfxengagement_retrieve_dlc_execUpdateObjectiveStatus_Parms UpdateObjectiveStatus_Parms;
 
@@ -136,10 +130,9 @@ void Usfxengagement_retrieve_dlc::UpdateObjectiveStatus ( )
 
 void Usfxengagement_retrieve_dlc::ActivateRandomPickup ( )
 {
-	static UFunction* pFnActivateRandomPickup = NULL;
-
+	UFunction* pFnActivateRandomPickup = (UFunction*) SdkBindings::Get ( 7398 );
 	if ( ! pFnActivateRandomPickup )
-		pFnActivateRandomPickup = (UFunction*) UObject::GObjObjects()->Data[ 124545 ];
+		return;
 
 	Usfxengagement_retrieve_dlc_execActivateRandomPickup_Parms ActivateRandomPickup_Parms;
 
@@ -152,10 +145,9 @@ void Usfxengagement_retrieve_dlc::ActivateRandomPickup ( )
 
 void Usfxengagement_retrieve_dlc::DetermineObjectivesToSpawn ( )
 {
-	static UFunction* pFnDetermineObjectivesToSpawn = NULL;
-
+	UFunction* pFnDetermineObjectivesToSpawn = (UFunction*) SdkBindings::Get ( 7397 );
 	if ( ! pFnDetermineObjectivesToSpawn )
-		pFnDetermineObjectivesToSpawn = (UFunction*) UObject::GObjObjects()->Data[ 124531 ];
+		return;
 
 	Usfxengagement_retrieve_dlc_execDetermineObjectivesToSpawn_Parms DetermineObjectivesToSpawn_Parms;
 
@@ -168,10 +160,9 @@ void Usfxengagement_retrieve_dlc::DetermineObjectivesToSpawn ( )
 
 void Usfxengagement_retrieve_dlc::DistributeObjectiveScore ( )
 {
-	static UFunction* pFnDistributeObjectiveScore = NULL;
-
+	UFunction* pFnDistributeObjectiveScore = (UFunction*) SdkBindings::Get ( 7396 );
 	if ( ! pFnDistributeObjectiveScore )
-		pFnDistributeObjectiveScore = (UFunction*) UObject::GObjObjects()->Data[ 124519 ];
+		return;
 
 	Usfxengagement_retrieve_dlc_execDistributeObjectiveScore_Parms DistributeObjectiveScore_Parms;
 
@@ -185,10 +176,9 @@ void Usfxengagement_retrieve_dlc::DistributeObjectiveScore ( )
 
 bool Usfxengagement_retrieve_dlc::BeginWave ( )
 {
-	static UFunction* pFnBeginWave = NULL;
-
+	UFunction* pFnBeginWave = (UFunction*) SdkBindings::Get ( 7395 );
 	if ( ! pFnBeginWave )
-		pFnBeginWave = (UFunction*) UObject::GObjObjects()->Data[ 124491 ];
+		return {};
 
 	Usfxengagement_retrieve_dlc_execBeginWave_Parms BeginWave_Parms;
 
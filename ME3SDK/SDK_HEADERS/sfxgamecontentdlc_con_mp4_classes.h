@@ -43,46 +43,28 @@ class USFXCameraMode_TurianPack : public USFXCameraMode_Combat
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135748 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7963 );
 	};
 
 	void MakeInactive ( );
 	void MakeActive ( );
 };
 
-UClass* USFXCameraMode_TurianPack::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXCharacterClassMP_N7Soldier_Turian
 // 0x0000 (0x01CD - 0x01CD)
 class USFXCharacterClassMP_N7Soldier_Turian : public USFXCharacterClass_ContentMP
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135752 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7964 );
 	};
 
 };
 
-UClass* USFXCharacterClassMP_N7Soldier_Turian::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge_Base
 // 0x0147 (0x07DC - 0x0695)
 class USFXPowerCustomActionMP_JetPackCharge_Base : public Usfxpowercustomaction
@@ -132,16 +114,9 @@ public:
 	unsigned long                                      bCollectedVolumes : 1;                            		// 0x07D8 (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 	unsigned long                                      bLineCheckToHead : 1;                             		// 0x07D8 (0x0004) [0x0000000000000000] [0x00000020] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135755 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7966 );
 	};
 
 	void Replicate ( );
@@ -171,8 +146,6 @@ public:
 	bool InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced );
 };
 
-UClass* USFXPowerCustomActionMP_JetPackCharge_Base::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_JetPackCharge
 // 0x0090 (0x086C - 0x07DC)
 class USFXPowerCustomActionMP_JetPackCharge : public USFXPowerCustomActionMP_JetPackCharge_Base
@@ -193,16 +166,9 @@ public:
 	float                                              Evolve_TimedPowerDamageBonus;                     		// 0x0864 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	float                                              Evolve_TimedPowerDamageDuration;                  		// 0x0868 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135754 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7965 );
 	};
 
 	void PopulatePowerStatBarEvolves ( );
@@ -213,8 +179,6 @@ public:
 	bool CanOverrideCustomAction ( int OldCustomAction, int InCustomAction );
 };
 
-UClass* USFXPowerCustomActionMP_JetPackCharge::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_StimPack
 // 0x00EC (0x0788 - 0x069C)
 class USFXPowerCustomActionMP_StimPack : public USFXPowerCustomAction_GrenadeBase
@@ -236,16 +200,9 @@ public:
 	class URvrClientEffectInterface*                   CE_SuperHealCrust;                                		// 0x0780 (0x0004) [0x0000000000000000]              
 	float                                              DamageImmunityLength;                             		// 0x0784 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135756 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7967 );
 	};
 
 	void PopulatePowerStatBarEvolves ( );
@@ -256,24 +213,15 @@ public:
 	bool OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector HitLocation, struct FVector HitNormal );
 };
 
-UClass* USFXPowerCustomActionMP_StimPack::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_N7TurianPassive
 // 0x0000 (0x0788 - 0x0788)
 class USFXPowerCustomActionMP_N7TurianPassive : public Usfxpowercustomactionmp_turianpassive
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135758 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7969 );
 	};
 
 	void PopulatePowerStatBarEvolves ( );
@@ -282,24 +230,15 @@ public:
 	void ApplyGlobalBonus ( );
 };
 
-UClass* USFXPowerCustomActionMP_N7TurianPassive::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXPowerCustomActionMP_N7TurianMeleePassive
 // 0x0000 (0x08D4 - 0x08D4)
 class USFXPowerCustomActionMP_N7TurianMeleePassive : public USFXPowerCustomActionMP_MeleePassiveBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135760 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7971 );
 	};
 
 	void PopulatePowerStatBarEvolves ( );
@@ -309,8 +248,6 @@ public:
 	void ApplyGlobalBonus ( );
 };
 
-UClass* USFXPowerCustomActionMP_N7TurianMeleePassive::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianEvadeBase
 // 0x001E (0x010C - 0x00EE)
 class USFXCustomAction_TurianEvadeBase : public USFXCustomAction_PlayerEvadeBase
@@ -322,16 +259,9 @@ public:
 	float                                              Decay;                                            		// 0x0104 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	float                                              GravityCompensationForExtremeDistance;            		// 0x0108 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135763 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7973 );
 	};
 
 	void RollOverride ( );
@@ -340,24 +270,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_TurianEvadeBase::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianEvadeLeft
 // 0x0000 (0x010C - 0x010C)
 class USFXCustomAction_TurianEvadeLeft : public USFXCustomAction_TurianEvadeBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135762 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7972 );
 	};
 
 	void RollOverride ( );
@@ -366,24 +287,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_TurianEvadeLeft::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianEvadeRight
 // 0x0000 (0x010C - 0x010C)
 class USFXCustomAction_TurianEvadeRight : public USFXCustomAction_TurianEvadeBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135764 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7974 );
 	};
 
 	void RollOverride ( );
@@ -392,24 +304,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_TurianEvadeRight::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianEvadeForward
 // 0x0000 (0x010C - 0x010C)
 class USFXCustomAction_TurianEvadeForward : public USFXCustomAction_TurianEvadeBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135765 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7975 );
 	};
 
 	void RollOverride ( );
@@ -418,24 +321,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_TurianEvadeForward::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianEvadeBackward
 // 0x0000 (0x010C - 0x010C)
 class USFXCustomAction_TurianEvadeBackward : public USFXCustomAction_TurianEvadeBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135766 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7976 );
 	};
 
 	void RollOverride ( );
@@ -444,8 +338,6 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_TurianEvadeBackward::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPunch
 // 0x0010 (0x0154 - 0x0144)
 class USFXCustomAction_TurianPunch : public USFXCustomAction_PlayerHeavyMeleeBase
@@ -454,16 +346,9 @@ public:
 	struct FVector                                     ToEnd2D;                                          		// 0x0144 (0x000C) [0x0000000000002000]              ( CPF_Transient )
 	float                                              MoveDist;                                         		// 0x0150 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135767 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7977 );
 	};
 
 	void ClientDoCustomAction ( unsigned long bForced );
@@ -476,8 +361,6 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_TurianPunch::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianMeleeOne
 // 0x0008 (0x01E4 - 0x01DC)
 class USFXCustomAction_TurianMeleeOne : public USFXCustomAction_PlayerMeleeBase
@@ -486,16 +369,9 @@ public:
 	class UAnimSet*                                    AnimSet;                                          		// 0x01DC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	float                                              BladeImpactScale;                                 		// 0x01E0 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135768 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7978 );
 	};
 
 	void StopMove ( );
@@ -510,24 +386,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_TurianMeleeOne::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianRifleMeleeTwo
 // 0x0000 (0x01E4 - 0x01E4)
 class USFXCustomAction_TurianRifleMeleeTwo : public USFXCustomAction_TurianMeleeOne
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135769 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7979 );
 	};
 
 	void StopMove ( );
@@ -542,24 +409,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_TurianRifleMeleeTwo::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianRifleMeleeThree
 // 0x0000 (0x01E4 - 0x01E4)
 class USFXCustomAction_TurianRifleMeleeThree : public USFXCustomAction_TurianRifleMeleeTwo
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135770 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7980 );
 	};
 
 	void StopMove ( );
@@ -574,8 +432,6 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_TurianRifleMeleeThree::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPistolMeleeOne
 // 0x0004 (0x01E0 - 0x01DC)
 class USFXCustomAction_TurianPistolMeleeOne : public USFXCustomAction_PlayerMeleeBase
@@ -583,16 +439,9 @@ class USFXCustomAction_TurianPistolMeleeOne : public USFXCustomAction_PlayerMele
 public:
 	class UAnimSet*                                    AnimSet;                                          		// 0x01DC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135771 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7981 );
 	};
 
 	void StopMove ( );
@@ -607,24 +456,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_TurianPistolMeleeOne::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPistolMeleeTwo
 // 0x0000 (0x01E0 - 0x01E0)
 class USFXCustomAction_TurianPistolMeleeTwo : public USFXCustomAction_TurianPistolMeleeOne
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135772 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7982 );
 	};
 
 	void StopMove ( );
@@ -639,24 +479,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_TurianPistolMeleeTwo::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXCustomAction_TurianPistolMeleeThree
 // 0x0000 (0x01E0 - 0x01E0)
 class USFXCustomAction_TurianPistolMeleeThree : public USFXCustomAction_TurianPistolMeleeTwo
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135773 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7983 );
 	};
 
 	void StopMove ( );
@@ -671,52 +502,32 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_TurianPistolMeleeThree::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXDamageType_TurianHeavyMelee
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_TurianHeavyMelee : public USFXDamageType_HeavyMelee
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135939 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8016 );
 	};
 
 };
 
-UClass* USFXDamageType_TurianHeavyMelee::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXDamageType_JetPackCharge
 // 0x0000 (0x00E9 - 0x00E9)
 class USFXDamageType_JetPackCharge : public USFXDamageType_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135971 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8017 );
 	};
 
 };
 
-UClass* USFXDamageType_JetPackCharge::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXGameEffect_StimPack
 // 0x0006 (0x0068 - 0x0062)
 class USFXGameEffect_StimPack : public USFXGameEffect
@@ -724,40 +535,24 @@ class USFXGameEffect_StimPack : public USFXGameEffect
 public:
 	class USFXPowerCustomActionMP_StimPack*            StimPack;                                         		// 0x0064 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135976 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8018 );
 	};
 
 	void OnRemoved ( );
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_StimPack::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXPawn_PlayerMP_N7Soldier_Turian
 // 0x0000 (0x1288 - 0x1288)
 class ASFXPawn_PlayerMP_N7Soldier_Turian : public ASFXPawn_PlayerMP_Soldier
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 136011 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8022 );
 	};
 
 	void HealthFailsafe ( );
@@ -819,24 +614,15 @@ public:
 	struct FString GetActorGameName ( );
 };
 
-UClass* ASFXPawn_PlayerMP_N7Soldier_Turian::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4.SFXProjectile_PowerCustomActionMP_JetPack
 // 0x0000 (0x02E1 - 0x02E1)
 class ASFXProjectile_PowerCustomActionMP_JetPack : public ASFXProjectile
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 136196 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8045 );
 	};
 
 	void PrecacheVFX ( class ASFXObjectPool* ObjectPool, class URvrClientEffectManager* ClientEffects );
@@ -875,8 +661,6 @@ public:
 	void SpawnFlightEffects ( );
 };
 
-UClass* ASFXProjectile_PowerCustomActionMP_JetPack::pClassPointer = NULL;
-
 
 #ifdef _MSC_VER
 	#pragma pack ( pop )
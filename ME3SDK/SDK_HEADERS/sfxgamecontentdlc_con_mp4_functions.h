@@ -27,10 +27,9 @@
 
 void USFXCameraMode_TurianPack::MakeInactive ( )
 {
-	static UFunction* pFnMakeInactive = NULL;
-
+	UFunction* pFnMakeInactive = (UFunction*) SdkBindings::Get ( 5069 );
 	if ( ! pFnMakeInactive )
-		pFnMakeInactive = (UFunction*) UObject::GObjObjects()->Data[ 65526 ];
+		return;
 
 	USFXCameraMode_TurianPack_execMakeInactive_Parms MakeInactive_Parms;
 
@@ -43,10 +42,9 @@ void USFXCameraMode_TurianPack::MakeInactive ( )
 
 void USFXCameraMode_TurianPack::MakeActive ( )
 {
-	static UFunction* pFnMakeActive = NULL;
-
+	UFunction* pFnMakeActive = (UFunction*) SdkBindings::Get ( 5068 );
 	if ( ! pFnMakeActive )
-		pFnMakeActive = (UFunction*) UObject::GObjObjects()->Data[ 65523 ];
+		return;
 
 	USFXCameraMode_TurianPack_execMakeActive_Parms MakeActive_Parms;
 
@@ -59,10 +57,9 @@ void USFXCameraMode_TurianPack::MakeActive ( )
 
 void USFXPowerCustomActionMP_JetPackCharge::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
-
+	UFunction* pFnPopulatePowerStatBarEvolves = (UFunction*) SdkBindings::Get ( 8054 );
 	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = (UFunction*) UObject::GObjObjects()->Data[ 136244 ];
+		return;
 
 	USFXPowerCustomActionMP_JetPackCharge_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -76,10 +73,9 @@ void USFXPowerCustomActionMP_JetPackCharge::PopulatePowerStatBarEvolves ( )
 
 void USFXPowerCustomActionMP_JetPackCharge::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
-
+	UFunction* pFnRecalculateAllPowerData = (UFunction*) SdkBindings::Get ( 8053 );
 	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = (UFunction*) UObject::GObjObjects()->Data[ 136242 ];
+		return;
 
 	USFXPowerCustomActionMP_JetPackCharge_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -94,10 +90,9 @@ void USFXPowerCustomActionMP_JetPackCharge::RecalculateAllPowerData ( unsigned l
 
 void USFXPowerCustomActionMP_JetPackCharge::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
-
+	UFunction* pFnEvolvePower = (UFunction*) SdkBindings::Get ( 8052 );
 	if ( ! pFnEvolvePower )
-		pFnEvolvePower = (UFunction*) UObject::GObjObjects()->Data[ 136235 ];
+		return;
 
 	USFXPowerCustomActionMP_JetPackCharge_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -111,10 +106,9 @@ void USFXPowerCustomActionMP_JetPackCharge::EvolvePower ( unsigned char choice )
 
 void USFXPowerCustomActionMP_JetPackCharge::Impact ( )
 {
-	static UFunction* pFnImpact = NULL;
-
+	UFunction* pFnImpact = (UFunction*) SdkBindings::Get ( 8051 );
 	if ( ! pFnImpact )
-		pFnImpact = (UFunction*) UObject::GObjObjects()->Data[ 136225 ];
+		return;
 
 	USFXPowerCustomActionMP_JetPackCharge_execImpact_Parms Impact_Parms;
 
@@ -127,10 +121,9 @@ void USFXPowerCustomActionMP_JetPackCharge::Impact ( )
 
 void USFXPowerCustomActionMP_JetPackCharge::StartPower ( )
 {
-	static UFunction* pFnStartPower = NULL;
-
+	UFunction* pFnStartPower = (UFunction*) SdkBindings::Get ( 8050 );
 	if ( ! pFnStartPower )
-		pFnStartPower = (UFunction*) UObject::GObjObjects()->Data[ 136223 ];
+		return;
 
 	USFXPowerCustomActionMP_JetPackCharge_execStartPower_Parms StartPower_Parms;
 
@@ -146,10 +139,9 @@ void USFXPowerCustomActionMP_JetPackCharge::StartPower ( )
 
 bool USFXPowerCustomActionMP_JetPackCharge::CanOverrideCustomAction ( int OldCustomAction, int InCustomAction )
 {
-	static UFunction* pFnCanOverrideCustomAction = NULL;
-
+	UFunction* pFnCanOverrideCustomAction = (UFunction*) SdkBindings::Get ( 8049 );
 	if ( ! pFnCanOverrideCustomAction )
-		pFnCanOverrideCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 136219 ];
+		return {};
 
 	USFXPowerCustomActionMP_JetPackCharge_execCanOverrideCustomAction_Parms CanOverrideCustomAction_Parms;
 	CanOverrideCustomAction_Parms.OldCustomAction = OldCustomAction;
@@ -166,10 +158,9 @@ bool USFXPowerCustomActionMP_JetPackCharge::CanOverrideCustomAction ( int OldCus
 
 void USFXPowerCustomActionMP_JetPackCharge_Base::Replicate ( )
 {
-	static UFunction* pFnReplicate = NULL;
-
+	UFunction* pFnReplicate = (UFunction*) SdkBindings::Get ( 8048 );
 	if ( ! pFnReplicate )
-		pFnReplicate = (UFunction*) UObject::GObjObjects()->Data[ 136208 ];
+		return;
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execReplicate_Parms Replicate_Parms;
 
@@ -189,10 +180,9 @@ void USFXPowerCustomActionMP_JetPackCharge_Base::Replicate ( )
 
 bool USFXPowerCustomActionMP_JetPackCharge_Base::DoPowerDetonatedForActor ( class AActor* oActor, struct FVector HitLocation, struct FVector HitNormal, int nImpactCount, unsigned long bFirstTarget, class ASFXProjectile_PowerCustomAction* oProjectile )
 {
-	static UFunction* pFnDoPowerDetonatedForActor = NULL;
-
+	UFunction* pFnDoPowerDetonatedForActor = (UFunction*) SdkBindings::Get ( 8047 );
 	if ( ! pFnDoPowerDetonatedForActor )
-		pFnDoPowerDetonatedForActor = (UFunction*) UObject::GObjObjects()->Data[ 136200 ];
+		return {};
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execDoPowerDetonatedForActor_Parms DoPowerDetonatedForActor_Parms;
 	DoPowerDetonatedForActor_Parms.oActor = oActor;
@@ -213,10 +203,9 @@ bool USFXPowerCustomActionMP_JetPackCharge_Base::DoPowerDetonatedForActor ( clas
 
 void USFXPowerCustomActionMP_JetPackCharge_Base::PlayFailedChargeEffects ( )
 {
-	static UFunction* pFnPlayFailedChargeEffects = NULL;
-
+	UFunction* pFnPlayFailedChargeEffects = (UFunction*) SdkBindings::Get ( 8046 );
 	if ( ! pFnPlayFailedChargeEffects )
-		pFnPlayFailedChargeEffects = (UFunction*) UObject::GObjObjects()->Data[ 136197 ];
+		return;
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execPlayFailedChargeEffects_Parms PlayFailedChargeEffects_Parms;
 
@@ -229,10 +218,9 @@ void USFXPowerCustomActionMP_JetPackCharge_Base::PlayFailedChargeEffects ( )
 
 void USFXPowerCustomActionMP_JetPackCharge_Base::SpawnProjectile ( )
 {
-	static UFunction* pFnSpawnProjectile = NULL;
-
+	UFunction* pFnSpawnProjectile = (UFunction*) SdkBindings::Get ( 8044 );
 	if ( ! pFnSpawnProjectile )
-		pFnSpawnProjectile = (UFunction*) UObject::GObjObjects()->Data[ 136195 ];
+		return;
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execSpawnProjectile_Parms SpawnProjectile_Parms;
 
@@ -248,10 +236,9 @@ void USFXPowerCustomActionMP_JetPackCharge_Base::SpawnProjectile ( )
 
 void USFXPowerCustomActionMP_JetPackCharge_Base::OnRagdollPhysicsImpact ( class APawn* oPawn, class AActor* oImpactActor, struct FVector vImpactDir )
 {
-	static UFunction* pFnOnRagdollPhysicsImpact = NULL;
-
+	UFunction* pFnOnRagdollPhysicsImpact = (UFunction*) SdkBindings::Get ( 8043 );
 	if ( ! pFnOnRagdollPhysicsImpact )
-		pFnOnRagdollPhysicsImpact = (UFunction*) UObject::GObjObjects()->Data[ 136190 ];
+		return;
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execOnRagdollPhysicsImpact_Parms OnRagdollPhysicsImpact_Parms;
 	OnRagdollPhysicsImpact_Parms.oPawn = oPawn;
@@ -269,10 +256,9 @@ void USFXPowerCustomActionMP_JetPackCharge_Base::OnRagdollPhysicsImpact ( class
 
 float USFXPowerCustomActionMP_JetPackCharge_Base::GetImpactForce ( class AActor* oImpacted )
 {
-	static UFunction* pFnGetImpactForce = NULL;
-
+	UFunction* pFnGetImpactForce = (UFunction*) SdkBindings::Get ( 8042 );
 	if ( ! pFnGetImpactForce )
-		pFnGetImpactForce = (UFunction*) UObject::GObjObjects()->Data[ 136184 ];
+		return {};
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execGetImpactForce_Parms GetImpactForce_Parms;
 	GetImpactForce_Parms.oImpacted = oImpacted;
@@ -294,10 +280,9 @@ float USFXPowerCustomActionMP_JetPackCharge_Base::GetImpactForce ( class AActor*
 
 void USFXPowerCustomActionMP_JetPackCharge_Base::ClientDoPowerSubsequentImpact ( class AActor* oActor, int CustomActionReactionType, float Duration, int ImpactCount, float Delay, unsigned long DoCallback )
 {
-	static UFunction* pFnClientDoPowerSubsequentImpact = NULL;
-
+	UFunction* pFnClientDoPowerSubsequentImpact = (UFunction*) SdkBindings::Get ( 8041 );
 	if ( ! pFnClientDoPowerSubsequentImpact )
-		pFnClientDoPowerSubsequentImpact = (UFunction*) UObject::GObjObjects()->Data[ 136177 ];
+		return;
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execClientDoPowerSubsequentImpact_Parms ClientDoPowerSubsequentImpact_Parms;
 	ClientDoPowerSubsequentImpact_Parms.oActor = oActor;
@@ -322,10 +307,9 @@ void USFXPowerCustomActionMP_JetPackCharge_Base::ClientDoPowerSubsequentImpact (
 
 bool USFXPowerCustomActionMP_JetPackCharge_Base::OnChargeImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnOnChargeImpact = NULL;
-
+	UFunction* pFnOnChargeImpact = (UFunction*) SdkBindings::Get ( 8040 );
 	if ( ! pFnOnChargeImpact )
-		pFnOnChargeImpact = (UFunction*) UObject::GObjObjects()->Data[ 136162 ];
+		return {};
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execOnChargeImpact_Parms OnChargeImpact_Parms;
 	OnChargeImpact_Parms.Resistance = Resistance;
@@ -345,10 +329,9 @@ bool USFXPowerCustomActionMP_JetPackCharge_Base::OnChargeImpact ( unsigned char
 
 void USFXPowerCustomActionMP_JetPackCharge_Base::Teleport ( )
 {
-	static UFunction* pFnTeleport = NULL;
-
+	UFunction* pFnTeleport = (UFunction*) SdkBindings::Get ( 8039 );
 	if ( ! pFnTeleport )
-		pFnTeleport = (UFunction*) UObject::GObjObjects()->Data[ 136161 ];
+		return;
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execTeleport_Parms Teleport_Parms;
 
@@ -361,10 +344,9 @@ void USFXPowerCustomActionMP_JetPackCharge_Base::Teleport ( )
 
 void USFXPowerCustomActionMP_JetPackCharge_Base::StartTeleport ( )
 {
-	static UFunction* pFnStartTeleport = NULL;
-
+	UFunction* pFnStartTeleport = (UFunction*) SdkBindings::Get ( 8038 );
 	if ( ! pFnStartTeleport )
-		pFnStartTeleport = (UFunction*) UObject::GObjObjects()->Data[ 136157 ];
+		return;
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execStartTeleport_Parms StartTeleport_Parms;
 
@@ -379,10 +361,9 @@ void USFXPowerCustomActionMP_JetPackCharge_Base::StartTeleport ( )
 
 void USFXPowerCustomActionMP_JetPackCharge_Base::PrecacheVFX ( class ASFXObjectPool* ObjectPool, class URvrClientEffectManager* ClientEffects )
 {
-	static UFunction* pFnPrecacheVFX = NULL;
-
+	UFunction* pFnPrecacheVFX = (UFunction*) SdkBindings::Get ( 8037 );
 	if ( ! pFnPrecacheVFX )
-		pFnPrecacheVFX = (UFunction*) UObject::GObjObjects()->Data[ 136152 ];
+		return;
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execPrecacheVFX_Parms PrecacheVFX_Parms;
 	PrecacheVFX_Parms.ObjectPool = ObjectPool;
@@ -397,10 +378,9 @@ void USFXPowerCustomActionMP_JetPackCharge_Base::PrecacheVFX ( class ASFXObjectP
 
 void USFXPowerCustomActionMP_JetPackCharge_Base::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
-
+	UFunction* pFnStopCustomAction = (UFunction*) SdkBindings::Get ( 8036 );
 	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 136150 ];
+		return;
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -413,10 +393,9 @@ void USFXPowerCustomActionMP_JetPackCharge_Base::StopCustomAction ( )
 
 void USFXPowerCustomActionMP_JetPackCharge_Base::InterruptThisCustomAction ( )
 {
-	static UFunction* pFnInterruptThisCustomAction = NULL;
-
+	UFunction* pFnInterruptThisCustomAction = (UFunction*) SdkBindings::Get ( 8035 );
 	if ( ! pFnInterruptThisCustomAction )
-		pFnInterruptThisCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 136148 ];
+		return;
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execInterruptThisCustomAction_Parms InterruptThisCustomAction_Parms;
 
@@ -429,10 +408,9 @@ void USFXPowerCustomActionMP_JetPackCharge_Base::InterruptThisCustomAction ( )
 
 void USFXPowerCustomActionMP_JetPackCharge_Base::CameraMove ( )
 {
-	static UFunction* pFnCameraMove = NULL;
-
+	UFunction* pFnCameraMove = (UFunction*) SdkBindings::Get ( 8034 );
 	if ( ! pFnCameraMove )
-		pFnCameraMove = (UFunction*) UObject::GObjObjects()->Data[ 136140 ];
+		return;
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execCameraMove_Parms CameraMove_Parms;
 
@@ -445,10 +423,9 @@ void USFXPowerCustomActionMP_JetPackCharge_Base::CameraMove ( )
 
 void USFXPowerCustomActionMP_JetPackCharge_Base::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
-
+	UFunction* pFnStartCustomAction = (UFunction*) SdkBindings::Get ( 8033 );
 	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 136127 ];
+		return;
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -463,10 +440,9 @@ void USFXPowerCustomActionMP_JetPackCharge_Base::StartCustomAction ( )
 
 void USFXPowerCustomActionMP_JetPackCharge_Base::FinalizePawnMove ( struct FVector* Loc, struct FVector* TargetLoc )
 {
-	static UFunction* pFnFinalizePawnMove = NULL;
-
+	UFunction* pFnFinalizePawnMove = (UFunction*) SdkBindings::Get ( 8032 );
 	if ( ! pFnFinalizePawnMove )
-		pFnFinalizePawnMove = (UFunction*) UObject::GObjObjects()->Data[ 136122 ];
+		return;
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execFinalizePawnMove_Parms FinalizePawnMove_Parms;
 
@@ -486,10 +462,9 @@ void USFXPowerCustomActionMP_JetPackCharge_Base::FinalizePawnMove ( struct FVect
 
 bool USFXPowerCustomActionMP_JetPackCharge_Base::ValidateTarget ( )
 {
-	static UFunction* pFnValidateTarget = NULL;
-
+	UFunction* pFnValidateTarget = (UFunction*) SdkBindings::Get ( 8031 );
 	if ( ! pFnValidateTarget )
-		pFnValidateTarget = (UFunction*) UObject::GObjObjects()->Data[ 136115 ];
+		return {};
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execValidateTarget_Parms ValidateTarget_Parms;
 
@@ -508,10 +483,9 @@ bool USFXPowerCustomActionMP_JetPackCharge_Base::ValidateTarget ( )
 
 bool USFXPowerCustomActionMP_JetPackCharge_Base::FindSpace ( struct FVector Extent, class AActor* TraceActor, struct FVector* NearLocation )
 {
-	static UFunction* pFnFindSpace = NULL;
-
+	UFunction* pFnFindSpace = (UFunction*) SdkBindings::Get ( 8030 );
 	if ( ! pFnFindSpace )
-		pFnFindSpace = (UFunction*) UObject::GObjObjects()->Data[ 136101 ];
+		return {};
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execFindSpace_Parms FindSpace_Parms;
 	memcpy ( &FindSpace_Parms.Extent, &Extent, 0xC );
@@ -535,10 +509,9 @@ bool USFXPowerCustomActionMP_JetPackCharge_Base::FindSpace ( struct FVector Exte
 
 bool USFXPowerCustomActionMP_JetPackCharge_Base::TryMove ( struct FVector NewLocation, struct FVector Dir, class APawn* CollisionActor )
 {
-	static UFunction* pFnTryMove = NULL;
-
+	UFunction* pFnTryMove = (UFunction*) SdkBindings::Get ( 8029 );
 	if ( ! pFnTryMove )
-		pFnTryMove = (UFunction*) UObject::GObjObjects()->Data[ 136096 ];
+		return {};
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execTryMove_Parms TryMove_Parms;
 	memcpy ( &TryMove_Parms.NewLocation, &NewLocation, 0xC );
@@ -556,10 +529,9 @@ bool USFXPowerCustomActionMP_JetPackCharge_Base::TryMove ( struct FVector NewLoc
 
 void USFXPowerCustomActionMP_JetPackCharge_Base::CollectVolumes ( )
 {
-	static UFunction* pFnCollectVolumes = NULL;
-
+	UFunction* pFnCollectVolumes = (UFunction*) SdkBindings::Get ( 8028 );
 	if ( ! pFnCollectVolumes )
-		pFnCollectVolumes = (UFunction*) UObject::GObjObjects()->Data[ 136085 ];
+		return;
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execCollectVolumes_Parms CollectVolumes_Parms;
 
@@ -574,10 +546,9 @@ void USFXPowerCustomActionMP_JetPackCharge_Base::CollectVolumes ( )
 
 bool USFXPowerCustomActionMP_JetPackCharge_Base::ValidateTargetLocation ( struct FVector TargetLocation )
 {
-	static UFunction* pFnValidateTargetLocation = NULL;
-
+	UFunction* pFnValidateTargetLocation = (UFunction*) SdkBindings::Get ( 8027 );
 	if ( ! pFnValidateTargetLocation )
-		pFnValidateTargetLocation = (UFunction*) UObject::GObjObjects()->Data[ 136070 ];
+		return {};
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execValidateTargetLocation_Parms ValidateTargetLocation_Parms;
 	memcpy ( &ValidateTargetLocation_Parms.TargetLocation, &TargetLocation, 0xC );
@@ -597,10 +568,9 @@ bool USFXPowerCustomActionMP_JetPackCharge_Base::ValidateTargetLocation ( struct
 
 bool USFXPowerCustomActionMP_JetPackCharge_Base::TestPathReachability ( class ANavigationPoint* Anchor, struct FVector Extent, struct FVector* StartLocation )
 {
-	static UFunction* pFnTestPathReachability = NULL;
-
+	UFunction* pFnTestPathReachability = (UFunction*) SdkBindings::Get ( 8026 );
 	if ( ! pFnTestPathReachability )
-		pFnTestPathReachability = (UFunction*) UObject::GObjObjects()->Data[ 136064 ];
+		return {};
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execTestPathReachability_Parms TestPathReachability_Parms;
 	TestPathReachability_Parms.Anchor = Anchor;
@@ -624,10 +594,9 @@ bool USFXPowerCustomActionMP_JetPackCharge_Base::TestPathReachability ( class AN
 
 struct FVector USFXPowerCustomActionMP_JetPackCharge_Base::NewVector ( float X, float Y, float Z )
 {
-	static UFunction* pFnNewVector = NULL;
-
+	UFunction* pFnNewVector = (UFunction*) SdkBindings::Get ( 8025 );
 	if ( ! pFnNewVector )
-		pFnNewVector = (UFunction*) UObject::GObjObjects()->Data[ 136058 ];
+		return {};
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execNewVector_Parms NewVector_Parms;
 	NewVector_Parms.X = X;
@@ -647,10 +616,9 @@ struct FVector USFXPowerCustomActionMP_JetPackCharge_Base::NewVector ( float X,
 
 bool USFXPowerCustomActionMP_JetPackCharge_Base::CanUsePower ( class AActor* oTarget )
 {
-	static UFunction* pFnCanUsePower = NULL;
-
+	UFunction* pFnCanUsePower = (UFunction*) SdkBindings::Get ( 8024 );
 	if ( ! pFnCanUsePower )
-		pFnCanUsePower = (UFunction*) UObject::GObjObjects()->Data[ 136045 ];
+		return {};
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execCanUsePower_Parms CanUsePower_Parms;
 	CanUsePower_Parms.oTarget = oTarget;
@@ -669,10 +637,9 @@ bool USFXPowerCustomActionMP_JetPackCharge_Base::CanUsePower ( class AActor* oTa
 
 bool USFXPowerCustomActionMP_JetPackCharge_Base::InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced )
 {
-	static UFunction* pFnInternalCanDoCustomAction = NULL;
-
+	UFunction* pFnInternalCanDoCustomAction = (UFunction*) SdkBindings::Get ( 8023 );
 	if ( ! pFnInternalCanDoCustomAction )
-		pFnInternalCanDoCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 136041 ];
+		return {};
 
 	USFXPowerCustomActionMP_JetPackCharge_Base_execInternalCanDoCustomAction_Parms InternalCanDoCustomAction_Parms;
 	InternalCanDoCustomAction_Parms.SyncPawn = SyncPawn;
@@ -689,10 +656,9 @@ bool USFXPowerCustomActionMP_JetPackCharge_Base::InternalCanDoCustomAction ( cla
 
 void USFXPowerCustomActionMP_StimPack::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
-
+	UFunction* pFnPopulatePowerStatBarEvolves = (UFunction*) SdkBindings::Get ( 8064 );
 	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = (UFunction*) UObject::GObjObjects()->Data[ 136312 ];
+		return;
 
 	USFXPowerCustomActionMP_StimPack_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -706,10 +672,9 @@ void USFXPowerCustomActionMP_StimPack::PopulatePowerStatBarEvolves ( )
 
 void USFXPowerCustomActionMP_StimPack::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
-
+	UFunction* pFnRecalculateAllPowerData = (UFunction*) SdkBindings::Get ( 8063 );
 	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = (UFunction*) UObject::GObjObjects()->Data[ 136310 ];
+		return;
 
 	USFXPowerCustomActionMP_StimPack_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -724,10 +689,9 @@ void USFXPowerCustomActionMP_StimPack::RecalculateAllPowerData ( unsigned long b
 
 void USFXPowerCustomActionMP_StimPack::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
-
+	UFunction* pFnEvolvePower = (UFunction*) SdkBindings::Get ( 8062 );
 	if ( ! pFnEvolvePower )
-		pFnEvolvePower = (UFunction*) UObject::GObjObjects()->Data[ 136303 ];
+		return;
 
 	USFXPowerCustomActionMP_StimPack_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -741,10 +705,9 @@ void USFXPowerCustomActionMP_StimPack::EvolvePower ( unsigned char choice )
 
 void USFXPowerCustomActionMP_StimPack::ApplyGrenadeBonus ( )
 {
-	static UFunction* pFnApplyGrenadeBonus = NULL;
-
+	UFunction* pFnApplyGrenadeBonus = (UFunction*) SdkBindings::Get ( 8061 );
 	if ( ! pFnApplyGrenadeBonus )
-		pFnApplyGrenadeBonus = (UFunction*) UObject::GObjObjects()->Data[ 136300 ];
+		return;
 
 	USFXPowerCustomActionMP_StimPack_execApplyGrenadeBonus_Parms ApplyGrenadeBonus_Parms;
 
@@ -757,10 +720,9 @@ void USFXPowerCustomActionMP_StimPack::ApplyGrenadeBonus ( )
 
 void USFXPowerCustomActionMP_StimPack::RemoveImmunity ( )
 {
-	static UFunction* pFnRemoveImmunity = NULL;
-
+	UFunction* pFnRemoveImmunity = (UFunction*) SdkBindings::Get ( 8060 );
 	if ( ! pFnRemoveImmunity )
-		pFnRemoveImmunity = (UFunction*) UObject::GObjObjects()->Data[ 136297 ];
+		return;
 
 	USFXPowerCustomActionMP_StimPack_execRemoveImmunity_Parms RemoveImmunity_Parms;
 
@@ -779,10 +741,9 @@ void USFXPowerCustomActionMP_StimPack::RemoveImmunity ( )
 
 bool USFXPowerCustomActionMP_StimPack::OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnOnImpact = NULL;
-
+	UFunction* pFnOnImpact = (UFunction*) SdkBindings::Get ( 8059 );
 	if ( ! pFnOnImpact )
-		pFnOnImpact = (UFunction*) UObject::GObjObjects()->Data[ 136278 ];
+		return {};
 
 	USFXPowerCustomActionMP_StimPack_execOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.Resistance = Resistance;
@@ -802,10 +763,9 @@ bool USFXPowerCustomActionMP_StimPack::OnImpact ( unsigned char Resistance, clas
 
 void USFXPowerCustomActionMP_N7TurianPassive::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
-
+	UFunction* pFnPopulatePowerStatBarEvolves = (UFunction*) SdkBindings::Get ( 8058 );
 	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = (UFunction*) UObject::GObjObjects()->Data[ 136275 ];
+		return;
 
 	USFXPowerCustomActionMP_N7TurianPassive_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -819,10 +779,9 @@ void USFXPowerCustomActionMP_N7TurianPassive::PopulatePowerStatBarEvolves ( )
 
 void USFXPowerCustomActionMP_N7TurianPassive::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
-
+	UFunction* pFnRecalculateAllPowerData = (UFunction*) SdkBindings::Get ( 8057 );
 	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = (UFunction*) UObject::GObjObjects()->Data[ 136273 ];
+		return;
 
 	USFXPowerCustomActionMP_N7TurianPassive_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -837,10 +796,9 @@ void USFXPowerCustomActionMP_N7TurianPassive::RecalculateAllPowerData ( unsigned
 
 void USFXPowerCustomActionMP_N7TurianPassive::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
-
+	UFunction* pFnEvolvePower = (UFunction*) SdkBindings::Get ( 8056 );
 	if ( ! pFnEvolvePower )
-		pFnEvolvePower = (UFunction*) UObject::GObjObjects()->Data[ 136269 ];
+		return;
 
 	USFXPowerCustomActionMP_N7TurianPassive_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -854,10 +812,9 @@ void USFXPowerCustomActionMP_N7TurianPassive::EvolvePower ( unsigned char choice
 
 void USFXPowerCustomActionMP_N7TurianPassive::ApplyGlobalBonus ( )
 {
-	static UFunction* pFnApplyGlobalBonus = NULL;
-
+	UFunction* pFnApplyGlobalBonus = (UFunction*) SdkBindings::Get ( 8055 );
 	if ( ! pFnApplyGlobalBonus )
-		pFnApplyGlobalBonus = (UFunction*) UObject::GObjObjects()->Data[ 136265 ];
+		return;
 
 	USFXPowerCustomActionMP_N7TurianPassive_execApplyGlobalBonus_Parms ApplyGlobalBonus_Parms;
 
@@ -870,10 +827,9 @@ void USFXPowerCustomActionMP_N7TurianPassive::ApplyGlobalBonus ( )
 
 void USFXPowerCustomActionMP_N7TurianMeleePassive::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
-
+	UFunction* pFnPopulatePowerStatBarEvolves = (UFunction*) SdkBindings::Get ( 7917 );
 	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = (UFunction*) UObject::GObjObjects()->Data[ 129504 ];
+		return;
 
 	USFXPowerCustomActionMP_N7TurianMeleePassive_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -889,10 +845,9 @@ void USFXPowerCustomActionMP_N7TurianMeleePassive::PopulatePowerStatBarEvolves (
 
 void USFXPowerCustomActionMP_N7TurianMeleePassive::ApplyBonus ( struct FName Parameter, class USFXGameEffect* Bonus, unsigned long bRemove )
 {
-	static UFunction* pFnApplyBonus = NULL;
-
+	UFunction* pFnApplyBonus = (UFunction*) SdkBindings::Get ( 7916 );
 	if ( ! pFnApplyBonus )
-		pFnApplyBonus = (UFunction*) UObject::GObjObjects()->Data[ 129500 ];
+		return;
 
 	USFXPowerCustomActionMP_N7TurianMeleePassive_execApplyBonus_Parms ApplyBonus_Parms;
 	memcpy ( &ApplyBonus_Parms.Parameter, &Parameter, 0x8 );
@@ -909,10 +864,9 @@ void USFXPowerCustomActionMP_N7TurianMeleePassive::ApplyBonus ( struct FName Par
 
 void USFXPowerCustomActionMP_N7TurianMeleePassive::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
-
+	UFunction* pFnRecalculateAllPowerData = (UFunction*) SdkBindings::Get ( 7915 );
 	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = (UFunction*) UObject::GObjObjects()->Data[ 129498 ];
+		return;
 
 	USFXPowerCustomActionMP_N7TurianMeleePassive_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -927,10 +881,9 @@ void USFXPowerCustomActionMP_N7TurianMeleePassive::RecalculateAllPowerData ( uns
 
 void USFXPowerCustomActionMP_N7TurianMeleePassive::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
-
+	UFunction* pFnEvolvePower = (UFunction*) SdkBindings::Get ( 7914 );
 	if ( ! pFnEvolvePower )
-		pFnEvolvePower = (UFunction*) UObject::GObjObjects()->Data[ 129492 ];
+		return;
 
 	USFXPowerCustomActionMP_N7TurianMeleePassive_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -944,10 +897,9 @@ void USFXPowerCustomActionMP_N7TurianMeleePassive::EvolvePower ( unsigned char c
 
 void USFXPowerCustomActionMP_N7TurianMeleePassive::ApplyGlobalBonus ( )
 {
-	static UFunction* pFnApplyGlobalBonus = NULL;
-
+	UFunction* pFnApplyGlobalBonus = (UFunction*) SdkBindings::Get ( 7913 );
 	if ( ! pFnApplyGlobalBonus )
-		pFnApplyGlobalBonus = (UFunction*) UObject::GObjObjects()->Data[ 129488 ];
+		return;
 
 	USFXPowerCustomActionMP_N7TurianMeleePassive_execApplyGlobalBonus_Parms ApplyGlobalBonus_Parms;
 
@@ -960,10 +912,9 @@ void USFXPowerCustomActionMP_N7TurianMeleePassive::ApplyGlobalBonus ( )
 
 void USFXCustomAction_TurianEvadeLeft::RollOverride ( )
 {
-	static UFunction* pFnRollOverride = NULL;
-
+	UFunction* pFnRollOverride = (UFunction*) SdkBindings::Get ( 7987 );
 	if ( ! pFnRollOverride )
-		pFnRollOverride = (UFunction*) UObject::GObjObjects()->Data[ 135783 ];
+		return;
 
 	USFXCustomAction_TurianEvadeLeft_execRollOverride_Parms RollOverride_Parms;
 
@@ -976,10 +927,9 @@ void USFXCustomAction_TurianEvadeLeft::RollOverride ( )
 
 void USFXCustomAction_TurianEvadeLeft::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
-
+	UFunction* pFnStopCustomAction = (UFunction*) SdkBindings::Get ( 7986 );
 	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135782 ];
+		return;
 
 	USFXCustomAction_TurianEvadeLeft_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -993,10 +943,9 @@ void USFXCustomAction_TurianEvadeLeft::StopCustomAction ( )
 
 void USFXCustomAction_TurianEvadeLeft::eventTickCustomAction ( float DeltaTime )
 {
-	static UFunction* pFnTickCustomAction = NULL;
-
+	UFunction* pFnTickCustomAction = (UFunction*) SdkBindings::Get ( 7985 );
 	if ( ! pFnTickCustomAction )
-		pFnTickCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135778 ];
+		return;
 
 	USFXCustomAction_TurianEvadeLeft_eventTickCustomAction_Parms TickCustomAction_Parms;
 	TickCustomAction_Parms.DeltaTime = DeltaTime;
@@ -1010,10 +959,9 @@ void USFXCustomAction_TurianEvadeLeft::eventTickCustomAction ( float DeltaTime )
 
 void USFXCustomAction_TurianEvadeLeft::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
-
+	UFunction* pFnStartCustomAction = (UFunction*) SdkBindings::Get ( 7984 );
 	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135774 ];
+		return;
 
 	USFXCustomAction_TurianEvadeLeft_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -1026,10 +974,9 @@ void USFXCustomAction_TurianEvadeLeft::StartCustomAction ( )
 
 void USFXCustomAction_TurianEvadeBase::RollOverride ( )
 {
-	static UFunction* pFnRollOverride = NULL;
-
+	UFunction* pFnRollOverride = (UFunction*) SdkBindings::Get ( 7987 );
 	if ( ! pFnRollOverride )
-		pFnRollOverride = (UFunction*) UObject::GObjObjects()->Data[ 135783 ];
+		return;
 
 	USFXCustomAction_TurianEvadeBase_execRollOverride_Parms RollOverride_Parms;
 
@@ -1042,10 +989,9 @@ void USFXCustomAction_TurianEvadeBase::RollOverride ( )
 
 void USFXCustomAction_TurianEvadeBase::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
-
+	UFunction* pFnStopCustomAction = (UFunction*) SdkBindings::Get ( 7986 );
 	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135782 ];
+		return;
 
 	USFXCustomAction_TurianEvadeBase_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -1059,10 +1005,9 @@ void USFXCustomAction_TurianEvadeBase::StopCustomAction ( )
 
 void USFXCustomAction_TurianEvadeBase::eventTickCustomAction ( float DeltaTime )
 {
-	static UFunction* pFnTickCustomAction = NULL;
-
+	UFunction* pFnTickCustomAction = (UFunction*) SdkBindings::Get ( 7985 );
 	if ( ! pFnTickCustomAction )
-		pFnTickCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135778 ];
+		return;
 
 	USFXCustomAction_TurianEvadeBase_eventTickCustomAction_Parms TickCustomAction_Parms;
 	TickCustomAction_Parms.DeltaTime = DeltaTime;
@@ -1076,10 +1021,9 @@ void USFXCustomAction_TurianEvadeBase::eventTickCustomAction ( float DeltaTime )
 
 void USFXCustomAction_TurianEvadeBase::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
-
+	UFunction* pFnStartCustomAction = (UFunction*) SdkBindings::Get ( 7984 );
 	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135774 ];
+		return;
 
 	USFXCustomAction_TurianEvadeBase_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -1092,10 +1036,9 @@ void USFXCustomAction_TurianEvadeBase::StartCustomAction ( )
 
 void USFXCustomAction_TurianEvadeRight::RollOverride ( )
 {
-	static UFunction* pFnRollOverride = NULL;
-
+	UFunction* pFnRollOverride = (UFunction*) SdkBindings::Get ( 7987 );
 	if ( ! pFnRollOverride )
-		pFnRollOverride = (UFunction*) UObject::GObjObjects()->Data[ 135783 ];
+		return;
 
 	USFXCustomAction_TurianEvadeRight_execRollOverride_Parms RollOverride_Parms;
 
@@ -1108,10 +1051,9 @@ void USFXCustomAction_TurianEvadeRight::RollOverride ( )
 
 void USFXCustomAction_TurianEvadeRight::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
-
+	UFunction* pFnStopCustomAction = (UFunction*) SdkBindings::Get ( 7986 );
 	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135782 ];
+		return;
 
 	USFXCustomAction_TurianEvadeRight_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -1125,10 +1067,9 @@ void USFXCustomAction_TurianEvadeRight::StopCustomAction ( )
 
 void USFXCustomAction_TurianEvadeRight::eventTickCustomAction ( float DeltaTime )
 {
-	static UFunction* pFnTickCustomAction = NULL;
-
+	UFunction* pFnTickCustomAction = (UFunction*) SdkBindings::Get ( 7985 );
 	if ( ! pFnTickCustomAction )
-		pFnTickCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135778 ];
+		return;
 
 	USFXCustomAction_TurianEvadeRight_eventTickCustomAction_Parms TickCustomAction_Parms;
 	TickCustomAction_Parms.DeltaTime = DeltaTime;
@@ -1142,10 +1083,9 @@ void USFXCustomAction_TurianEvadeRight::eventTickCustomAction ( float DeltaTime
 
 void USFXCustomAction_TurianEvadeRight::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
-
+	UFunction* pFnStartCustomAction = (UFunction*) SdkBindings::Get ( 7984 );
 	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135774 ];
+		return;
 
 	USFXCustomAction_TurianEvadeRight_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -1158,10 +1098,9 @@ void USFXCustomAction_TurianEvadeRight::StartCustomAction ( )
 
 void USFXCustomAction_TurianEvadeForward::RollOverride ( )
 {
-	static UFunction* pFnRollOverride = NULL;
-
+	UFunction* pFnRollOverride = (UFunction*) SdkBindings::Get ( 7987 );
 	if ( ! pFnRollOverride )
-		pFnRollOverride = (UFunction*) UObject::GObjObjects()->Data[ 135783 ];
+		return;
 
 	USFXCustomAction_TurianEvadeForward_execRollOverride_Parms RollOverride_Parms;
 
@@ -1174,10 +1113,9 @@ void USFXCustomAction_TurianEvadeForward::RollOverride ( )
 
 void USFXCustomAction_TurianEvadeForward::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
-
+	UFunction* pFnStopCustomAction = (UFunction*) SdkBindings::Get ( 7986 );
 	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135782 ];
+		return;
 
 	USFXCustomAction_TurianEvadeForward_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -1191,10 +1129,9 @@ void USFXCustomAction_TurianEvadeForward::StopCustomAction ( )
 
 void USFXCustomAction_TurianEvadeForward::eventTickCustomAction ( float DeltaTime )
 {
-	static UFunction* pFnTickCustomAction = NULL;
-
+	UFunction* pFnTickCustomAction = (UFunction*) SdkBindings::Get ( 7985 );
 	if ( ! pFnTickCustomAction )
-		pFnTickCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135778 ];
+		return;
 
 	USFXCustomAction_TurianEvadeForward_eventTickCustomAction_Parms TickCustomAction_Parms;
 	TickCustomAction_Parms.DeltaTime = DeltaTime;
@@ -1208,10 +1145,9 @@ void USFXCustomAction_TurianEvadeForward::eventTickCustomAction ( float DeltaTim
 
 void USFXCustomAction_TurianEvadeForward::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
-
+	UFunction* pFnStartCustomAction = (UFunction*) SdkBindings::Get ( 7984 );
 	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135774 ];
+		return;
 
 	USFXCustomAction_TurianEvadeForward_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -1224,10 +1160,9 @@ void USFXCustomAction_TurianEvadeForward::StartCustomAction ( )
 
 void USFXCustomAction_TurianEvadeBackward::RollOverride ( )
 {
-	static UFunction* pFnRollOverride = NULL;
-
+	UFunction* pFnRollOverride = (UFunction*) SdkBindings::Get ( 7987 );
 	if ( ! pFnRollOverride )
-		pFnRollOverride = (UFunction*) UObject::GObjObjects()->Data[ 135783 ];
+		return;
 
 	USFXCustomAction_TurianEvadeBackward_execRollOverride_Parms RollOverride_Parms;
 
@@ -1240,10 +1175,9 @@ void USFXCustomAction_TurianEvadeBackward::RollOverride ( )
 
 void USFXCustomAction_TurianEvadeBackward::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
-
+	UFunction* pFnStopCustomAction = (UFunction*) SdkBindings::Get ( 7986 );
 	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135782 ];
+		return;
 
 	USFXCustomAction_TurianEvadeBackward_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -1257,10 +1191,9 @@ void USFXCustomAction_TurianEvadeBackward::StopCustomAction ( )
 
 void USFXCustomAction_TurianEvadeBackward::eventTickCustomAction ( float DeltaTime )
 {
-	static UFunction* pFnTickCustomAction = NULL;
-
+	UFunction* pFnTickCustomAction = (UFunction*) SdkBindings::Get ( 7985 );
 	if ( ! pFnTickCustomAction )
-		pFnTickCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135778 ];
+		return;
 
 	USFXCustomAction_TurianEvadeBackward_eventTickCustomAction_Parms TickCustomAction_Parms;
 	TickCustomAction_Parms.DeltaTime = DeltaTime;
@@ -1274,10 +1207,9 @@ void USFXCustomAction_TurianEvadeBackward::eventTickCustomAction ( float DeltaTi
 
 void USFXCustomAction_TurianEvadeBackward::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
-
+	UFunction* pFnStartCustomAction = (UFunction*) SdkBindings::Get ( 7984 );
 	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135774 ];
+		return;
 
 	USFXCustomAction_TurianEvadeBackward_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -1291,10 +1223,9 @@ void USFXCustomAction_TurianEvadeBackward::StartCustomAction ( )
 
 void USFXCustomAction_TurianPunch::ClientDoCustomAction ( unsigned long bForced )
 {
-	static UFunction* pFnClientDoCustomAction = NULL;
-
+	UFunction* pFnClientDoCustomAction = (UFunction*) SdkBindings::Get ( 8015 );
 	if ( ! pFnClientDoCustomAction )
-		pFnClientDoCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135936 ];
+		return;
 
 	USFXCustomAction_TurianPunch_execClientDoCustomAction_Parms ClientDoCustomAction_Parms;
 	ClientDoCustomAction_Parms.bForced = bForced;
@@ -1308,10 +1239,9 @@ void USFXCustomAction_TurianPunch::ClientDoCustomAction ( unsigned long bForced
 
 void USFXCustomAction_TurianPunch::Replicate ( )
 {
-	static UFunction* pFnReplicate = NULL;
-
+	UFunction* pFnReplicate = (UFunction*) SdkBindings::Get ( 8014 );
 	if ( ! pFnReplicate )
-		pFnReplicate = (UFunction*) UObject::GObjObjects()->Data[ 135935 ];
+		return;
 
 	USFXCustomAction_TurianPunch_execReplicate_Parms Replicate_Parms;
 
@@ -1327,10 +1257,9 @@ void USFXCustomAction_TurianPunch::Replicate ( )
 
 void USFXCustomAction_TurianPunch::ServerStartCustomAction ( int NewAction, class ABioPawn* Sync, int NewPowerAction )
 {
-	static UFunction* pFnServerStartCustomAction = NULL;
-
+	UFunction* pFnServerStartCustomAction = (UFunction*) SdkBindings::Get ( 8013 );
 	if ( ! pFnServerStartCustomAction )
-		pFnServerStartCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135930 ];
+		return;
 
 	USFXCustomAction_TurianPunch_execServerStartCustomAction_Parms ServerStartCustomAction_Parms;
 	ServerStartCustomAction_Parms.NewAction = NewAction;
@@ -1346,10 +1275,9 @@ void USFXCustomAction_TurianPunch::ServerStartCustomAction ( int NewAction, clas
 
 void USFXCustomAction_TurianPunch::StopMove ( )
 {
-	static UFunction* pFnStopMove = NULL;
-
+	UFunction* pFnStopMove = (UFunction*) SdkBindings::Get ( 8012 );
 	if ( ! pFnStopMove )
-		pFnStopMove = (UFunction*) UObject::GObjObjects()->Data[ 135929 ];
+		return;
 
 	USFXCustomAction_TurianPunch_execStopMove_Parms StopMove_Parms;
 
@@ -1368,10 +1296,9 @@ void USFXCustomAction_TurianPunch::StopMove ( )
 
 bool USFXCustomAction_TurianPunch::OnActorImpacted ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnOnActorImpacted = NULL;
-
+	UFunction* pFnOnActorImpacted = (UFunction*) SdkBindings::Get ( 8011 );
 	if ( ! pFnOnActorImpacted )
-		pFnOnActorImpacted = (UFunction*) UObject::GObjObjects()->Data[ 135921 ];
+		return {};
 
 	USFXCustomAction_TurianPunch_execOnActorImpacted_Parms OnActorImpacted_Parms;
 	OnActorImpacted_Parms.Resistance = Resistance;
@@ -1392,10 +1319,9 @@ bool USFXCustomAction_TurianPunch::OnActorImpacted ( unsigned char Resistance, c
 
 struct FVector USFXCustomAction_TurianPunch::GetMeleeDirection ( )
 {
-	static UFunction* pFnGetMeleeDirection = NULL;
-
+	UFunction* pFnGetMeleeDirection = (UFunction*) SdkBindings::Get ( 8010 );
 	if ( ! pFnGetMeleeDirection )
-		pFnGetMeleeDirection = (UFunction*) UObject::GObjObjects()->Data[ 135917 ];
+		return {};
 
 	USFXCustomAction_TurianPunch_execGetMeleeDirection_Parms GetMeleeDirection_Parms;
 
@@ -1410,10 +1336,9 @@ struct FVector USFXCustomAction_TurianPunch::GetMeleeDirection ( )
 
 void USFXCustomAction_TurianPunch::Translate ( )
 {
-	static UFunction* pFnTranslate = NULL;
-
+	UFunction* pFnTranslate = (UFunction*) SdkBindings::Get ( 8009 );
 	if ( ! pFnTranslate )
-		pFnTranslate = (UFunction*) UObject::GObjObjects()->Data[ 135915 ];
+		return;
 
 	USFXCustomAction_TurianPunch_execTranslate_Parms Translate_Parms;
 
@@ -1426,10 +1351,9 @@ void USFXCustomAction_TurianPunch::Translate ( )
 
 void USFXCustomAction_TurianPunch::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
-
+	UFunction* pFnStartCustomAction = (UFunction*) SdkBindings::Get ( 8008 );
 	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135913 ];
+		return;
 
 	USFXCustomAction_TurianPunch_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -1442,10 +1366,9 @@ void USFXCustomAction_TurianPunch::StartCustomAction ( )
 
 void USFXCustomAction_TurianMeleeOne::StopMove ( )
 {
-	static UFunction* pFnStopMove = NULL;
-
+	UFunction* pFnStopMove = (UFunction*) SdkBindings::Get ( 7997 );
 	if ( ! pFnStopMove )
-		pFnStopMove = (UFunction*) UObject::GObjObjects()->Data[ 135838 ];
+		return;
 
 	USFXCustomAction_TurianMeleeOne_execStopMove_Parms StopMove_Parms;
 
@@ -1464,10 +1387,9 @@ void USFXCustomAction_TurianMeleeOne::StopMove ( )
 
 bool USFXCustomAction_TurianMeleeOne::OnActorImpacted ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnOnActorImpacted = NULL;
-
+	UFunction* pFnOnActorImpacted = (UFunction*) SdkBindings::Get ( 7996 );
 	if ( ! pFnOnActorImpacted )
-		pFnOnActorImpacted = (UFunction*) UObject::GObjObjects()->Data[ 135825 ];
+		return {};
 
 	USFXCustomAction_TurianMeleeOne_execOnActorImpacted_Parms OnActorImpacted_Parms;
 	OnActorImpacted_Parms.Resistance = Resistance;
@@ -1493,10 +1415,9 @@ bool USFXCustomAction_TurianMeleeOne::OnActorImpacted ( unsigned char Resistance
 
 void USFXCustomAction_TurianMeleeOne::ReplicateImpact ( class ABioPawn* Target, int ImpactCount, unsigned long bFirstTarget, struct FVector HitLocation, struct FVector HitNormal, int CustomActionReactionType )
 {
-	static UFunction* pFnReplicateImpact = NULL;
-
+	UFunction* pFnReplicateImpact = (UFunction*) SdkBindings::Get ( 7995 );
 	if ( ! pFnReplicateImpact )
-		pFnReplicateImpact = (UFunction*) UObject::GObjObjects()->Data[ 135818 ];
+		return;
 
 	USFXCustomAction_TurianMeleeOne_execReplicateImpact_Parms ReplicateImpact_Parms;
 	ReplicateImpact_Parms.Target = Target;
@@ -1515,10 +1436,9 @@ void USFXCustomAction_TurianMeleeOne::ReplicateImpact ( class ABioPawn* Target,
 
 void USFXCustomAction_TurianMeleeOne::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
-
+	UFunction* pFnStopCustomAction = (UFunction*) SdkBindings::Get ( 7994 );
 	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135817 ];
+		return;
 
 	USFXCustomAction_TurianMeleeOne_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -1531,10 +1451,9 @@ void USFXCustomAction_TurianMeleeOne::StopCustomAction ( )
 
 void USFXCustomAction_TurianMeleeOne::EndAction ( )
 {
-	static UFunction* pFnEndAction = NULL;
-
+	UFunction* pFnEndAction = (UFunction*) SdkBindings::Get ( 7993 );
 	if ( ! pFnEndAction )
-		pFnEndAction = (UFunction*) UObject::GObjObjects()->Data[ 135816 ];
+		return;
 
 	USFXCustomAction_TurianMeleeOne_execEndAction_Parms EndAction_Parms;
 
@@ -1547,10 +1466,9 @@ void USFXCustomAction_TurianMeleeOne::EndAction ( )
 
 void USFXCustomAction_TurianMeleeOne::HeavyMelee ( )
 {
-	static UFunction* pFnHeavyMelee = NULL;
-
+	UFunction* pFnHeavyMelee = (UFunction*) SdkBindings::Get ( 7992 );
 	if ( ! pFnHeavyMelee )
-		pFnHeavyMelee = (UFunction*) UObject::GObjObjects()->Data[ 135815 ];
+		return;
 
 	USFXCustomAction_TurianMeleeOne_execHeavyMelee_Parms HeavyMelee_Parms;
 
@@ -1563,10 +1481,9 @@ void USFXCustomAction_TurianMeleeOne::HeavyMelee ( )
 
 void USFXCustomAction_TurianMeleeOne::NoHeavyMelee ( )
 {
-	static UFunction* pFnNoHeavyMelee = NULL;
-
+	UFunction* pFnNoHeavyMelee = (UFunction*) SdkBindings::Get ( 7991 );
 	if ( ! pFnNoHeavyMelee )
-		pFnNoHeavyMelee = (UFunction*) UObject::GObjObjects()->Data[ 135814 ];
+		return;
 
 	USFXCustomAction_TurianMeleeOne_execNoHeavyMelee_Parms NoHeavyMelee_Parms;
 
@@ -1579,10 +1496,9 @@ void USFXCustomAction_TurianMeleeOne::NoHeavyMelee ( )
 
 void USFXCustomAction_TurianMeleeOne::DoRifleMeleeTwo ( )
 {
-	static UFunction* pFnDoRifleMeleeTwo = NULL;
-
+	UFunction* pFnDoRifleMeleeTwo = (UFunction*) SdkBindings::Get ( 7990 );
 	if ( ! pFnDoRifleMeleeTwo )
-		pFnDoRifleMeleeTwo = (UFunction*) UObject::GObjObjects()->Data[ 135812 ];
+		return;
 
 	USFXCustomAction_TurianMeleeOne_execDoRifleMeleeTwo_Parms DoRifleMeleeTwo_Parms;
 
@@ -1595,10 +1511,9 @@ void USFXCustomAction_TurianMeleeOne::DoRifleMeleeTwo ( )
 
 void USFXCustomAction_TurianMeleeOne::RifleMeleeSecondary ( )
 {
-	static UFunction* pFnRifleMeleeSecondary = NULL;
-
+	UFunction* pFnRifleMeleeSecondary = (UFunction*) SdkBindings::Get ( 7989 );
 	if ( ! pFnRifleMeleeSecondary )
-		pFnRifleMeleeSecondary = (UFunction*) UObject::GObjObjects()->Data[ 135811 ];
+		return;
 
 	USFXCustomAction_TurianMeleeOne_execRifleMeleeSecondary_Parms RifleMeleeSecondary_Parms;
 
@@ -1611,10 +1526,9 @@ void USFXCustomAction_TurianMeleeOne::RifleMeleeSecondary ( )
 
 void USFXCustomAction_TurianMeleeOne::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
-
+	UFunction* pFnStartCustomAction = (UFunction*) SdkBindings::Get ( 7988 );
 	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135809 ];
+		return;
 
 	USFXCustomAction_TurianMeleeOne_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -1627,10 +1541,9 @@ void USFXCustomAction_TurianMeleeOne::StartCustomAction ( )
 
 void USFXCustomAction_TurianRifleMeleeTwo::StopMove ( )
 {
-	static UFunction* pFnStopMove = NULL;
-
+	UFunction* pFnStopMove = (UFunction*) SdkBindings::Get ( 7997 );
 	if ( ! pFnStopMove )
-		pFnStopMove = (UFunction*) UObject::GObjObjects()->Data[ 135838 ];
+		return;
 
 	USFXCustomAction_TurianRifleMeleeTwo_execStopMove_Parms StopMove_Parms;
 
@@ -1649,10 +1562,9 @@ void USFXCustomAction_TurianRifleMeleeTwo::StopMove ( )
 
 bool USFXCustomAction_TurianRifleMeleeTwo::OnActorImpacted ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnOnActorImpacted = NULL;
-
+	UFunction* pFnOnActorImpacted = (UFunction*) SdkBindings::Get ( 7996 );
 	if ( ! pFnOnActorImpacted )
-		pFnOnActorImpacted = (UFunction*) UObject::GObjObjects()->Data[ 135825 ];
+		return {};
 
 	USFXCustomAction_TurianRifleMeleeTwo_execOnActorImpacted_Parms OnActorImpacted_Parms;
 	OnActorImpacted_Parms.Resistance = Resistance;
@@ -1678,10 +1590,9 @@ bool USFXCustomAction_TurianRifleMeleeTwo::OnActorImpacted ( unsigned char Resis
 
 void USFXCustomAction_TurianRifleMeleeTwo::ReplicateImpact ( class ABioPawn* Target, int ImpactCount, unsigned long bFirstTarget, struct FVector HitLocation, struct FVector HitNormal, int CustomActionReactionType )
 {
-	static UFunction* pFnReplicateImpact = NULL;
-
+	UFunction* pFnReplicateImpact = (UFunction*) SdkBindings::Get ( 7995 );
 	if ( ! pFnReplicateImpact )
-		pFnReplicateImpact = (UFunction*) UObject::GObjObjects()->Data[ 135818 ];
+		return;
 
 	USFXCustomAction_TurianRifleMeleeTwo_execReplicateImpact_Parms ReplicateImpact_Parms;
 	ReplicateImpact_Parms.Target = Target;
@@ -1700,10 +1611,9 @@ void USFXCustomAction_TurianRifleMeleeTwo::ReplicateImpact ( class ABioPawn* Tar
 
 void USFXCustomAction_TurianRifleMeleeTwo::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
-
+	UFunction* pFnStopCustomAction = (UFunction*) SdkBindings::Get ( 7994 );
 	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135817 ];
+		return;
 
 	USFXCustomAction_TurianRifleMeleeTwo_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -1716,10 +1626,9 @@ void USFXCustomAction_TurianRifleMeleeTwo::StopCustomAction ( )
 
 void USFXCustomAction_TurianRifleMeleeTwo::EndAction ( )
 {
-	static UFunction* pFnEndAction = NULL;
-
+	UFunction* pFnEndAction = (UFunction*) SdkBindings::Get ( 7993 );
 	if ( ! pFnEndAction )
-		pFnEndAction = (UFunction*) UObject::GObjObjects()->Data[ 135816 ];
+		return;
 
 	USFXCustomAction_TurianRifleMeleeTwo_execEndAction_Parms EndAction_Parms;
 
@@ -1732,10 +1641,9 @@ void USFXCustomAction_TurianRifleMeleeTwo::EndAction ( )
 
 void USFXCustomAction_TurianRifleMeleeTwo::HeavyMelee ( )
 {
-	static UFunction* pFnHeavyMelee = NULL;
-
+	UFunction* pFnHeavyMelee = (UFunction*) SdkBindings::Get ( 7992 );
 	if ( ! pFnHeavyMelee )
-		pFnHeavyMelee = (UFunction*) UObject::GObjObjects()->Data[ 135815 ];
+		return;
 
 	USFXCustomAction_TurianRifleMeleeTwo_execHeavyMelee_Parms HeavyMelee_Parms;
 
@@ -1748,10 +1656,9 @@ void USFXCustomAction_TurianRifleMeleeTwo::HeavyMelee ( )
 
 void USFXCustomAction_TurianRifleMeleeTwo::NoHeavyMelee ( )
 {
-	static UFunction* pFnNoHeavyMelee = NULL;
-
+	UFunction* pFnNoHeavyMelee = (UFunction*) SdkBindings::Get ( 7991 );
 	if ( ! pFnNoHeavyMelee )
-		pFnNoHeavyMelee = (UFunction*) UObject::GObjObjects()->Data[ 135814 ];
+		return;
 
 	USFXCustomAction_TurianRifleMeleeTwo_execNoHeavyMelee_Parms NoHeavyMelee_Parms;
 
@@ -1764,10 +1671,9 @@ void USFXCustomAction_TurianRifleMeleeTwo::NoHeavyMelee ( )
 
 void USFXCustomAction_TurianRifleMeleeTwo::DoRifleMeleeTwo ( )
 {
-	static UFunction* pFnDoRifleMeleeTwo = NULL;
-
+	UFunction* pFnDoRifleMeleeTwo = (UFunction*) SdkBindings::Get ( 7990 );
 	if ( ! pFnDoRifleMeleeTwo )
-		pFnDoRifleMeleeTwo = (UFunction*) UObject::GObjObjects()->Data[ 135812 ];
+		return;
 
 	USFXCustomAction_TurianRifleMeleeTwo_execDoRifleMeleeTwo_Parms DoRifleMeleeTwo_Parms;
 
@@ -1780,10 +1686,9 @@ void USFXCustomAction_TurianRifleMeleeTwo::DoRifleMeleeTwo ( )
 
 void USFXCustomAction_TurianRifleMeleeTwo::RifleMeleeSecondary ( )
 {
-	static UFunction* pFnRifleMeleeSecondary = NULL;
-
+	UFunction* pFnRifleMeleeSecondary = (UFunction*) SdkBindings::Get ( 7989 );
 	if ( ! pFnRifleMeleeSecondary )
-		pFnRifleMeleeSecondary = (UFunction*) UObject::GObjObjects()->Data[ 135811 ];
+		return;
 
 	USFXCustomAction_TurianRifleMeleeTwo_execRifleMeleeSecondary_Parms RifleMeleeSecondary_Parms;
 
@@ -1796,10 +1701,9 @@ void USFXCustomAction_TurianRifleMeleeTwo::RifleMeleeSecondary ( )
 
 void USFXCustomAction_TurianRifleMeleeTwo::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
-
+	UFunction* pFnStartCustomAction = (UFunction*) SdkBindings::Get ( 7988 );
 	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135809 ];
+		return;
 
 	USFXCustomAction_TurianRifleMeleeTwo_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -1812,10 +1716,9 @@ void USFXCustomAction_TurianRifleMeleeTwo::StartCustomAction ( )
 
 void USFXCustomAction_TurianRifleMeleeThree::StopMove ( )
 {
-	static UFunction* pFnStopMove = NULL;
-
+	UFunction* pFnStopMove = (UFunction*) SdkBindings::Get ( 7997 );
 	if ( ! pFnStopMove )
-		pFnStopMove = (UFunction*) UObject::GObjObjects()->Data[ 135838 ];
+		return;
 
 	USFXCustomAction_TurianRifleMeleeThree_execStopMove_Parms StopMove_Parms;
 
@@ -1834,10 +1737,9 @@ void USFXCustomAction_TurianRifleMeleeThree::StopMove ( )
 
 bool USFXCustomAction_TurianRifleMeleeThree::OnActorImpacted ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnOnActorImpacted = NULL;
-
+	UFunction* pFnOnActorImpacted = (UFunction*) SdkBindings::Get ( 7996 );
 	if ( ! pFnOnActorImpacted )
-		pFnOnActorImpacted = (UFunction*) UObject::GObjObjects()->Data[ 135825 ];
+		return {};
 
 	USFXCustomAction_TurianRifleMeleeThree_execOnActorImpacted_Parms OnActorImpacted_Parms;
 	OnActorImpacted_Parms.Resistance = Resistance;
@@ -1863,10 +1765,9 @@ bool USFXCustomAction_TurianRifleMeleeThree::OnActorImpacted ( unsigned char Res
 
 void USFXCustomAction_TurianRifleMeleeThree::ReplicateImpact ( class ABioPawn* Target, int ImpactCount, unsigned long bFirstTarget, struct FVector HitLocation, struct FVector HitNormal, int CustomActionReactionType )
 {
-	static UFunction* pFnReplicateImpact = NULL;
-
+	UFunction* pFnReplicateImpact = (UFunction*) SdkBindings::Get ( 7995 );
 	if ( ! pFnReplicateImpact )
-		pFnReplicateImpact = (UFunction*) UObject::GObjObjects()->Data[ 135818 ];
+		return;
 
 	USFXCustomAction_TurianRifleMeleeThree_execReplicateImpact_Parms ReplicateImpact_Parms;
 	ReplicateImpact_Parms.Target = Target;
@@ -1885,10 +1786,9 @@ void USFXCustomAction_TurianRifleMeleeThree::ReplicateImpact ( class ABioPawn* T
 
 void USFXCustomAction_TurianRifleMeleeThree::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
-
+	UFunction* pFnStopCustomAction = (UFunction*) SdkBindings::Get ( 7994 );
 	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135817 ];
+		return;
 
 	USFXCustomAction_TurianRifleMeleeThree_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -1901,10 +1801,9 @@ void USFXCustomAction_TurianRifleMeleeThree::StopCustomAction ( )
 
 void USFXCustomAction_TurianRifleMeleeThree::EndAction ( )
 {
-	static UFunction* pFnEndAction = NULL;
-
+	UFunction* pFnEndAction = (UFunction*) SdkBindings::Get ( 7993 );
 	if ( ! pFnEndAction )
-		pFnEndAction = (UFunction*) UObject::GObjObjects()->Data[ 135816 ];
+		return;
 
 	USFXCustomAction_TurianRifleMeleeThree_execEndAction_Parms EndAction_Parms;
 
@@ -1917,10 +1816,9 @@ void USFXCustomAction_TurianRifleMeleeThree::EndAction ( )
 
 void USFXCustomAction_TurianRifleMeleeThree::HeavyMelee ( )
 {
-	static UFunction* pFnHeavyMelee = NULL;
-
+	UFunction* pFnHeavyMelee = (UFunction*) SdkBindings::Get ( 7992 );
 	if ( ! pFnHeavyMelee )
-		pFnHeavyMelee = (UFunction*) UObject::GObjObjects()->Data[ 135815 ];
+		return;
 
 	USFXCustomAction_TurianRifleMeleeThree_execHeavyMelee_Parms HeavyMelee_Parms;
 
@@ -1933,10 +1831,9 @@ void USFXCustomAction_TurianRifleMeleeThree::HeavyMelee ( )
 
 void USFXCustomAction_TurianRifleMeleeThree::NoHeavyMelee ( )
 {
-	static UFunction* pFnNoHeavyMelee = NULL;
-
+	UFunction* pFnNoHeavyMelee = (UFunction*) SdkBindings::Get ( 7991 );
 	if ( ! pFnNoHeavyMelee )
-		pFnNoHeavyMelee = (UFunction*) UObject::GObjObjects()->Data[ 135814 ];
+		return;
 
 	USFXCustomAction_TurianRifleMeleeThree_execNoHeavyMelee_Parms NoHeavyMelee_Parms;
 
@@ -1949,10 +1846,9 @@ void USFXCustomAction_TurianRifleMeleeThree::NoHeavyMelee ( )
 
 void USFXCustomAction_TurianRifleMeleeThree::DoRifleMeleeTwo ( )
 {
-	static UFunction* pFnDoRifleMeleeTwo = NULL;
-
+	UFunction* pFnDoRifleMeleeTwo = (UFunction*) SdkBindings::Get ( 7990 );
 	if ( ! pFnDoRifleMeleeTwo )
-		pFnDoRifleMeleeTwo = (UFunction*) UObject::GObjObjects()->Data[ 135812 ];
+		return;
 
 	USFXCustomAction_TurianRifleMeleeThree_execDoRifleMeleeTwo_Parms DoRifleMeleeTwo_Parms;
 
@@ -1965,10 +1861,9 @@ void USFXCustomAction_TurianRifleMeleeThree::DoRifleMeleeTwo ( )
 
 void USFXCustomAction_TurianRifleMeleeThree::RifleMeleeSecondary ( )
 {
-	static UFunction* pFnRifleMeleeSecondary = NULL;
-
+	UFunction* pFnRifleMeleeSecondary = (UFunction*) SdkBindings::Get ( 7989 );
 	if ( ! pFnRifleMeleeSecondary )
-		pFnRifleMeleeSecondary = (UFunction*) UObject::GObjObjects()->Data[ 135811 ];
+		return;
 
 	USFXCustomAction_TurianRifleMeleeThree_execRifleMeleeSecondary_Parms RifleMeleeSecondary_Parms;
 
@@ -1981,10 +1876,9 @@ void USFXCustomAction_TurianRifleMeleeThree::RifleMeleeSecondary ( )
 
 void USFXCustomAction_TurianRifleMeleeThree::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
-
+	UFunction* pFnStartCustomAction = (UFunction*) SdkBindings::Get ( 7988 );
 	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135809 ];
+		return;
 
 	USFXCustomAction_TurianRifleMeleeThree_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -1997,10 +1891,9 @@ void USFXCustomAction_TurianRifleMeleeThree::StartCustomAction ( )
 
 void USFXCustomAction_TurianPistolMeleeOne::StopMove ( )
 {
-	static UFunction* pFnStopMove = NULL;
-
+	UFunction* pFnStopMove = (UFunction*) SdkBindings::Get ( 8007 );
 	if ( ! pFnStopMove )
-		pFnStopMove = (UFunction*) UObject::GObjObjects()->Data[ 135875 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeOne_execStopMove_Parms StopMove_Parms;
 
@@ -2019,10 +1912,9 @@ void USFXCustomAction_TurianPistolMeleeOne::StopMove ( )
 
 bool USFXCustomAction_TurianPistolMeleeOne::OnActorImpacted ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnOnActorImpacted = NULL;
-
+	UFunction* pFnOnActorImpacted = (UFunction*) SdkBindings::Get ( 8006 );
 	if ( ! pFnOnActorImpacted )
-		pFnOnActorImpacted = (UFunction*) UObject::GObjObjects()->Data[ 135862 ];
+		return {};
 
 	USFXCustomAction_TurianPistolMeleeOne_execOnActorImpacted_Parms OnActorImpacted_Parms;
 	OnActorImpacted_Parms.Resistance = Resistance;
@@ -2048,10 +1940,9 @@ bool USFXCustomAction_TurianPistolMeleeOne::OnActorImpacted ( unsigned char Resi
 
 void USFXCustomAction_TurianPistolMeleeOne::ReplicateImpact ( class ABioPawn* Target, int ImpactCount, unsigned long bFirstTarget, struct FVector HitLocation, struct FVector HitNormal, int CustomActionReactionType )
 {
-	static UFunction* pFnReplicateImpact = NULL;
-
+	UFunction* pFnReplicateImpact = (UFunction*) SdkBindings::Get ( 8005 );
 	if ( ! pFnReplicateImpact )
-		pFnReplicateImpact = (UFunction*) UObject::GObjObjects()->Data[ 135855 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeOne_execReplicateImpact_Parms ReplicateImpact_Parms;
 	ReplicateImpact_Parms.Target = Target;
@@ -2070,10 +1961,9 @@ void USFXCustomAction_TurianPistolMeleeOne::ReplicateImpact ( class ABioPawn* Ta
 
 void USFXCustomAction_TurianPistolMeleeOne::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
-
+	UFunction* pFnStopCustomAction = (UFunction*) SdkBindings::Get ( 8004 );
 	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135854 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeOne_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -2086,10 +1976,9 @@ void USFXCustomAction_TurianPistolMeleeOne::StopCustomAction ( )
 
 void USFXCustomAction_TurianPistolMeleeOne::EndAction ( )
 {
-	static UFunction* pFnEndAction = NULL;
-
+	UFunction* pFnEndAction = (UFunction*) SdkBindings::Get ( 8003 );
 	if ( ! pFnEndAction )
-		pFnEndAction = (UFunction*) UObject::GObjObjects()->Data[ 135853 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeOne_execEndAction_Parms EndAction_Parms;
 
@@ -2102,10 +1991,9 @@ void USFXCustomAction_TurianPistolMeleeOne::EndAction ( )
 
 void USFXCustomAction_TurianPistolMeleeOne::HeavyMelee ( )
 {
-	static UFunction* pFnHeavyMelee = NULL;
-
+	UFunction* pFnHeavyMelee = (UFunction*) SdkBindings::Get ( 8002 );
 	if ( ! pFnHeavyMelee )
-		pFnHeavyMelee = (UFunction*) UObject::GObjObjects()->Data[ 135851 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeOne_execHeavyMelee_Parms HeavyMelee_Parms;
 
@@ -2118,10 +2006,9 @@ void USFXCustomAction_TurianPistolMeleeOne::HeavyMelee ( )
 
 void USFXCustomAction_TurianPistolMeleeOne::NoHeavyMelee ( )
 {
-	static UFunction* pFnNoHeavyMelee = NULL;
-
+	UFunction* pFnNoHeavyMelee = (UFunction*) SdkBindings::Get ( 8001 );
 	if ( ! pFnNoHeavyMelee )
-		pFnNoHeavyMelee = (UFunction*) UObject::GObjObjects()->Data[ 135850 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeOne_execNoHeavyMelee_Parms NoHeavyMelee_Parms;
 
@@ -2134,10 +2021,9 @@ void USFXCustomAction_TurianPistolMeleeOne::NoHeavyMelee ( )
 
 void USFXCustomAction_TurianPistolMeleeOne::DoPistolMeleeTwo ( )
 {
-	static UFunction* pFnDoPistolMeleeTwo = NULL;
-
+	UFunction* pFnDoPistolMeleeTwo = (UFunction*) SdkBindings::Get ( 8000 );
 	if ( ! pFnDoPistolMeleeTwo )
-		pFnDoPistolMeleeTwo = (UFunction*) UObject::GObjObjects()->Data[ 135848 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeOne_execDoPistolMeleeTwo_Parms DoPistolMeleeTwo_Parms;
 
@@ -2150,10 +2036,9 @@ void USFXCustomAction_TurianPistolMeleeOne::DoPistolMeleeTwo ( )
 
 void USFXCustomAction_TurianPistolMeleeOne::PistolMeleeSecondary ( )
 {
-	static UFunction* pFnPistolMeleeSecondary = NULL;
-
+	UFunction* pFnPistolMeleeSecondary = (UFunction*) SdkBindings::Get ( 7999 );
 	if ( ! pFnPistolMeleeSecondary )
-		pFnPistolMeleeSecondary = (UFunction*) UObject::GObjObjects()->Data[ 135847 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeOne_execPistolMeleeSecondary_Parms PistolMeleeSecondary_Parms;
 
@@ -2166,10 +2051,9 @@ void USFXCustomAction_TurianPistolMeleeOne::PistolMeleeSecondary ( )
 
 void USFXCustomAction_TurianPistolMeleeOne::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
-
+	UFunction* pFnStartCustomAction = (UFunction*) SdkBindings::Get ( 7998 );
 	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135845 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeOne_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -2182,10 +2066,9 @@ void USFXCustomAction_TurianPistolMeleeOne::StartCustomAction ( )
 
 void USFXCustomAction_TurianPistolMeleeTwo::StopMove ( )
 {
-	static UFunction* pFnStopMove = NULL;
-
+	UFunction* pFnStopMove = (UFunction*) SdkBindings::Get ( 8007 );
 	if ( ! pFnStopMove )
-		pFnStopMove = (UFunction*) UObject::GObjObjects()->Data[ 135875 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeTwo_execStopMove_Parms StopMove_Parms;
 
@@ -2204,10 +2087,9 @@ void USFXCustomAction_TurianPistolMeleeTwo::StopMove ( )
 
 bool USFXCustomAction_TurianPistolMeleeTwo::OnActorImpacted ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnOnActorImpacted = NULL;
-
+	UFunction* pFnOnActorImpacted = (UFunction*) SdkBindings::Get ( 8006 );
 	if ( ! pFnOnActorImpacted )
-		pFnOnActorImpacted = (UFunction*) UObject::GObjObjects()->Data[ 135862 ];
+		return {};
 
 	USFXCustomAction_TurianPistolMeleeTwo_execOnActorImpacted_Parms OnActorImpacted_Parms;
 	OnActorImpacted_Parms.Resistance = Resistance;
@@ -2233,10 +2115,9 @@ bool USFXCustomAction_TurianPistolMeleeTwo::OnActorImpacted ( unsigned char Resi
 
 void USFXCustomAction_TurianPistolMeleeTwo::ReplicateImpact ( class ABioPawn* Target, int ImpactCount, unsigned long bFirstTarget, struct FVector HitLocation, struct FVector HitNormal, int CustomActionReactionType )
 {
-	static UFunction* pFnReplicateImpact = NULL;
-
+	UFunction* pFnReplicateImpact = (UFunction*) SdkBindings::Get ( 8005 );
 	if ( ! pFnReplicateImpact )
-		pFnReplicateImpact = (UFunction*) UObject::GObjObjects()->Data[ 135855 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeTwo_execReplicateImpact_Parms ReplicateImpact_Parms;
 	ReplicateImpact_Parms.Target = Target;
@@ -2255,10 +2136,9 @@ void USFXCustomAction_TurianPistolMeleeTwo::ReplicateImpact ( class ABioPawn* Ta
 
 void USFXCustomAction_TurianPistolMeleeTwo::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
-
+	UFunction* pFnStopCustomAction = (UFunction*) SdkBindings::Get ( 8004 );
 	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135854 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeTwo_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -2271,10 +2151,9 @@ void USFXCustomAction_TurianPistolMeleeTwo::StopCustomAction ( )
 
 void USFXCustomAction_TurianPistolMeleeTwo::EndAction ( )
 {
-	static UFunction* pFnEndAction = NULL;
-
+	UFunction* pFnEndAction = (UFunction*) SdkBindings::Get ( 8003 );
 	if ( ! pFnEndAction )
-		pFnEndAction = (UFunction*) UObject::GObjObjects()->Data[ 135853 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeTwo_execEndAction_Parms EndAction_Parms;
 
@@ -2287,10 +2166,9 @@ void USFXCustomAction_TurianPistolMeleeTwo::EndAction ( )
 
 void USFXCustomAction_TurianPistolMeleeTwo::HeavyMelee ( )
 {
-	static UFunction* pFnHeavyMelee = NULL;
-
+	UFunction* pFnHeavyMelee = (UFunction*) SdkBindings::Get ( 8002 );
 	if ( ! pFnHeavyMelee )
-		pFnHeavyMelee = (UFunction*) UObject::GObjObjects()->Data[ 135851 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeTwo_execHeavyMelee_Parms HeavyMelee_Parms;
 
@@ -2303,10 +2181,9 @@ void USFXCustomAction_TurianPistolMeleeTwo::HeavyMelee ( )
 
 void USFXCustomAction_TurianPistolMeleeTwo::NoHeavyMelee ( )
 {
-	static UFunction* pFnNoHeavyMelee = NULL;
-
+	UFunction* pFnNoHeavyMelee = (UFunction*) SdkBindings::Get ( 8001 );
 	if ( ! pFnNoHeavyMelee )
-		pFnNoHeavyMelee = (UFunction*) UObject::GObjObjects()->Data[ 135850 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeTwo_execNoHeavyMelee_Parms NoHeavyMelee_Parms;
 
@@ -2319,10 +2196,9 @@ void USFXCustomAction_TurianPistolMeleeTwo::NoHeavyMelee ( )
 
 void USFXCustomAction_TurianPistolMeleeTwo::DoPistolMeleeTwo ( )
 {
-	static UFunction* pFnDoPistolMeleeTwo = NULL;
-
+	UFunction* pFnDoPistolMeleeTwo = (UFunction*) SdkBindings::Get ( 8000 );
 	if ( ! pFnDoPistolMeleeTwo )
-		pFnDoPistolMeleeTwo = (UFunction*) UObject::GObjObjects()->Data[ 135848 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeTwo_execDoPistolMeleeTwo_Parms DoPistolMeleeTwo_Parms;
 
@@ -2335,10 +2211,9 @@ void USFXCustomAction_TurianPistolMeleeTwo::DoPistolMeleeTwo ( )
 
 void USFXCustomAction_TurianPistolMeleeTwo::PistolMeleeSecondary ( )
 {
-	static UFunction* pFnPistolMeleeSecondary = NULL;
-
+	UFunction* pFnPistolMeleeSecondary = (UFunction*) SdkBindings::Get ( 7999 );
 	if ( ! pFnPistolMeleeSecondary )
-		pFnPistolMeleeSecondary = (UFunction*) UObject::GObjObjects()->Data[ 135847 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeTwo_execPistolMeleeSecondary_Parms PistolMeleeSecondary_Parms;
 
@@ -2351,10 +2226,9 @@ void USFXCustomAction_TurianPistolMeleeTwo::PistolMeleeSecondary ( )
 
 void USFXCustomAction_TurianPistolMeleeTwo::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
-
+	UFunction* pFnStartCustomAction = (UFunction*) SdkBindings::Get ( 7998 );
 	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135845 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeTwo_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -2367,10 +2241,9 @@ void USFXCustomAction_TurianPistolMeleeTwo::StartCustomAction ( )
 
 void USFXCustomAction_TurianPistolMeleeThree::StopMove ( )
 {
-	static UFunction* pFnStopMove = NULL;
-
+	UFunction* pFnStopMove = (UFunction*) SdkBindings::Get ( 8007 );
 	if ( ! pFnStopMove )
-		pFnStopMove = (UFunction*) UObject::GObjObjects()->Data[ 135875 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeThree_execStopMove_Parms StopMove_Parms;
 
@@ -2389,10 +2262,9 @@ void USFXCustomAction_TurianPistolMeleeThree::StopMove ( )
 
 bool USFXCustomAction_TurianPistolMeleeThree::OnActorImpacted ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnOnActorImpacted = NULL;
-
+	UFunction* pFnOnActorImpacted = (UFunction*) SdkBindings::Get ( 8006 );
 	if ( ! pFnOnActorImpacted )
-		pFnOnActorImpacted = (UFunction*) UObject::GObjObjects()->Data[ 135862 ];
+		return {};
 
 	USFXCustomAction_TurianPistolMeleeThree_execOnActorImpacted_Parms OnActorImpacted_Parms;
 	OnActorImpacted_Parms.Resistance = Resistance;
@@ -2418,10 +2290,9 @@ bool USFXCustomAction_TurianPistolMeleeThree::OnActorImpacted ( unsigned char Re
 
 void USFXCustomAction_TurianPistolMeleeThree::ReplicateImpact ( class ABioPawn* Target, int ImpactCount, unsigned long bFirstTarget, struct FVector HitLocation, struct FVector HitNormal, int CustomActionReactionType )
 {
-	static UFunction* pFnReplicateImpact = NULL;
-
+	UFunction* pFnReplicateImpact = (UFunction*) SdkBindings::Get ( 8005 );
 	if ( ! pFnReplicateImpact )
-		pFnReplicateImpact = (UFunction*) UObject::GObjObjects()->Data[ 135855 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeThree_execReplicateImpact_Parms ReplicateImpact_Parms;
 	ReplicateImpact_Parms.Target = Target;
@@ -2440,10 +2311,9 @@ void USFXCustomAction_TurianPistolMeleeThree::ReplicateImpact ( class ABioPawn*
 
 void USFXCustomAction_TurianPistolMeleeThree::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
-
+	UFunction* pFnStopCustomAction = (UFunction*) SdkBindings::Get ( 8004 );
 	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135854 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeThree_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -2456,10 +2326,9 @@ void USFXCustomAction_TurianPistolMeleeThree::StopCustomAction ( )
 
 void USFXCustomAction_TurianPistolMeleeThree::EndAction ( )
 {
-	static UFunction* pFnEndAction = NULL;
-
+	UFunction* pFnEndAction = (UFunction*) SdkBindings::Get ( 8003 );
 	if ( ! pFnEndAction )
-		pFnEndAction = (UFunction*) UObject::GObjObjects()->Data[ 135853 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeThree_execEndAction_Parms EndAction_Parms;
 
@@ -2472,10 +2341,9 @@ void USFXCustomAction_TurianPistolMeleeThree::EndAction ( )
 
 void USFXCustomAction_TurianPistolMeleeThree::HeavyMelee ( )
 {
-	static UFunction* pFnHeavyMelee = NULL;
-
+	UFunction* pFnHeavyMelee = (UFunction*) SdkBindings::Get ( 8002 );
 	if ( ! pFnHeavyMelee )
-		pFnHeavyMelee = (UFunction*) UObject::GObjObjects()->Data[ 135851 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeThree_execHeavyMelee_Parms HeavyMelee_Parms;
 
@@ -2488,10 +2356,9 @@ void USFXCustomAction_TurianPistolMeleeThree::HeavyMelee ( )
 
 void USFXCustomAction_TurianPistolMeleeThree::NoHeavyMelee ( )
 {
-	static UFunction* pFnNoHeavyMelee = NULL;
-
+	UFunction* pFnNoHeavyMelee = (UFunction*) SdkBindings::Get ( 8001 );
 	if ( ! pFnNoHeavyMelee )
-		pFnNoHeavyMelee = (UFunction*) UObject::GObjObjects()->Data[ 135850 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeThree_execNoHeavyMelee_Parms NoHeavyMelee_Parms;
 
@@ -2504,10 +2371,9 @@ void USFXCustomAction_TurianPistolMeleeThree::NoHeavyMelee ( )
 
 void USFXCustomAction_TurianPistolMeleeThree::DoPistolMeleeTwo ( )
 {
-	static UFunction* pFnDoPistolMeleeTwo = NULL;
-
+	UFunction* pFnDoPistolMeleeTwo = (UFunction*) SdkBindings::Get ( 8000 );
 	if ( ! pFnDoPistolMeleeTwo )
-		pFnDoPistolMeleeTwo = (UFunction*) UObject::GObjObjects()->Data[ 135848 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeThree_execDoPistolMeleeTwo_Parms DoPistolMeleeTwo_Parms;
 
@@ -2520,10 +2386,9 @@ void USFXCustomAction_TurianPistolMeleeThree::DoPistolMeleeTwo ( )
 
 void USFXCustomAction_TurianPistolMeleeThree::PistolMeleeSecondary ( )
 {
-	static UFunction* pFnPistolMeleeSecondary = NULL;
-
+	UFunction* pFnPistolMeleeSecondary = (UFunction*) SdkBindings::Get ( 7999 );
 	if ( ! pFnPistolMeleeSecondary )
-		pFnPistolMeleeSecondary = (UFunction*) UObject::GObjObjects()->Data[ 135847 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeThree_execPistolMeleeSecondary_Parms PistolMeleeSecondary_Parms;
 
@@ -2536,10 +2401,9 @@ void USFXCustomAction_TurianPistolMeleeThree::PistolMeleeSecondary ( )
 
 void USFXCustomAction_TurianPistolMeleeThree::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
-
+	UFunction* pFnStartCustomAction = (UFunction*) SdkBindings::Get ( 7998 );
 	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 135845 ];
+		return;
 
 	USFXCustomAction_TurianPistolMeleeThree_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -2552,10 +2416,9 @@ void USFXCustomAction_TurianPistolMeleeThree::StartCustomAction ( )
 
 void USFXGameEffect_StimPack::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
-
+	UFunction* pFnOnRemoved = (UFunction*) SdkBindings::Get ( 8020 );
 	if ( ! pFnOnRemoved )
-		pFnOnRemoved = (UFunction*) UObject::GObjObjects()->Data[ 135979 ];
+		return;
 
 	USFXGameEffect_StimPack_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -2568,10 +2431,9 @@ void USFXGameEffect_StimPack::OnRemoved ( )
 
 void USFXGameEffect_StimPack::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
-
+	UFunction* pFnOnApplied = (UFunction*) SdkBindings::Get ( 8019 );
 	if ( ! pFnOnApplied )
-		pFnOnApplied = (UFunction*) UObject::GObjObjects()->Data[ 135977 ];
+		return;
 
 	USFXGameEffect_StimPack_execOnApplied_Parms OnApplied_Parms;
 
@@ -2584,10 +2446,9 @@ void USFXGameEffect_StimPack::OnApplied ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::HealthFailsafe ( )
 {
-	static UFunction* pFnHealthFailsafe = NULL;
-
+	UFunction* pFnHealthFailsafe = (UFunction*) SdkBindings::Get ( 7105 );
 	if ( ! pFnHealthFailsafe )
-		pFnHealthFailsafe = (UFunction*) UObject::GObjObjects()->Data[ 112047 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execHealthFailsafe_Parms HealthFailsafe_Parms;
 
@@ -2600,10 +2461,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::HealthFailsafe ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::RagdollFailsafe ( )
 {
-	static UFunction* pFnRagdollFailsafe = NULL;
-
+	UFunction* pFnRagdollFailsafe = (UFunction*) SdkBindings::Get ( 7103 );
 	if ( ! pFnRagdollFailsafe )
-		pFnRagdollFailsafe = (UFunction*) UObject::GObjObjects()->Data[ 112045 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execRagdollFailsafe_Parms RagdollFailsafe_Parms;
 
@@ -2616,10 +2476,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::RagdollFailsafe ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::ResetSyncMovementFailsafeInfo ( )
 {
-	static UFunction* pFnResetSyncMovementFailsafeInfo = NULL;
-
+	UFunction* pFnResetSyncMovementFailsafeInfo = (UFunction*) SdkBindings::Get ( 7104 );
 	if ( ! pFnResetSyncMovementFailsafeInfo )
-		pFnResetSyncMovementFailsafeInfo = (UFunction*) UObject::GObjObjects()->Data[ 112046 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execResetSyncMovementFailsafeInfo_Parms ResetSyncMovementFailsafeInfo_Parms;
 
@@ -2632,10 +2491,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::ResetSyncMovementFailsafeInfo ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::ProcessSyncMovementFailsafe ( )
 {
-	static UFunction* pFnProcessSyncMovementFailsafe = NULL;
-
+	UFunction* pFnProcessSyncMovementFailsafe = (UFunction*) SdkBindings::Get ( 7106 );
 	if ( ! pFnProcessSyncMovementFailsafe )
-		pFnProcessSyncMovementFailsafe = (UFunction*) UObject::GObjObjects()->Data[ 112059 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execProcessSyncMovementFailsafe_Parms ProcessSyncMovementFailsafe_Parms;
 
@@ -2649,10 +2507,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::ProcessSyncMovementFailsafe ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::Tick ( float DeltaTime )
 {
-	static UFunction* pFnTick = NULL;
-
+	UFunction* pFnTick = (UFunction*) SdkBindings::Get ( 7107 );
 	if ( ! pFnTick )
-		pFnTick = (UFunction*) UObject::GObjObjects()->Data[ 112060 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execTick_Parms Tick_Parms;
 	Tick_Parms.DeltaTime = DeltaTime;
@@ -2671,10 +2528,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::Tick ( float DeltaTime )
 
 bool ASFXPawn_PlayerMP_N7Soldier_Turian::eventCanDoCustomAction ( int CAction, class APawn* Sync, unsigned long bForced, int PowerCustomAction )
 {
-	static UFunction* pFnCanDoCustomAction = NULL;
-
+	UFunction* pFnCanDoCustomAction = (UFunction*) SdkBindings::Get ( 7102 );
 	if ( ! pFnCanDoCustomAction )
-		pFnCanDoCustomAction = (UFunction*) UObject::GObjObjects()->Data[ 112039 ];
+		return {};
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_eventCanDoCustomAction_Parms CanDoCustomAction_Parms;
 	CanDoCustomAction_Parms.CAction = CAction;
@@ -2694,10 +2550,9 @@ bool ASFXPawn_PlayerMP_N7Soldier_Turian::eventCanDoCustomAction ( int CAction, c
 
 bool ASFXPawn_PlayerMP_N7Soldier_Turian::ShouldShowHUDGrenadeCounter ( )
 {
-	static UFunction* pFnShouldShowHUDGrenadeCounter = NULL;
-
+	UFunction* pFnShouldShowHUDGrenadeCounter = (UFunction*) SdkBindings::Get ( 7101 );
 	if ( ! pFnShouldShowHUDGrenadeCounter )
-		pFnShouldShowHUDGrenadeCounter = (UFunction*) UObject::GObjObjects()->Data[ 112037 ];
+		return {};
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execShouldShowHUDGrenadeCounter_Parms ShouldShowHUDGrenadeCounter_Parms;
 
@@ -2712,10 +2567,9 @@ bool ASFXPawn_PlayerMP_N7Soldier_Turian::ShouldShowHUDGrenadeCounter ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::UpdateGameEffects ( )
 {
-	static UFunction* pFnUpdateGameEffects = NULL;
-
+	UFunction* pFnUpdateGameEffects = (UFunction*) SdkBindings::Get ( 7100 );
 	if ( ! pFnUpdateGameEffects )
-		pFnUpdateGameEffects = (UFunction*) UObject::GObjObjects()->Data[ 112036 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execUpdateGameEffects_Parms UpdateGameEffects_Parms;
 
@@ -2729,10 +2583,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::UpdateGameEffects ( )
 
 struct FName ASFXPawn_PlayerMP_N7Soldier_Turian::GetUIAppearanceTag ( )
 {
-	static UFunction* pFnGetUIAppearanceTag = NULL;
-
+	UFunction* pFnGetUIAppearanceTag = (UFunction*) SdkBindings::Get ( 7099 );
 	if ( ! pFnGetUIAppearanceTag )
-		pFnGetUIAppearanceTag = (UFunction*) UObject::GObjObjects()->Data[ 112034 ];
+		return {};
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execGetUIAppearanceTag_Parms GetUIAppearanceTag_Parms;
 
@@ -2747,10 +2600,9 @@ struct FName ASFXPawn_PlayerMP_N7Soldier_Turian::GetUIAppearanceTag ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::Destroyed ( )
 {
-	static UFunction* pFnDestroyed = NULL;
-
+	UFunction* pFnDestroyed = (UFunction*) SdkBindings::Get ( 7098 );
 	if ( ! pFnDestroyed )
-		pFnDestroyed = (UFunction*) UObject::GObjObjects()->Data[ 112027 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execDestroyed_Parms Destroyed_Parms;
 
@@ -2767,10 +2619,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::Destroyed ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::eventTouch ( class AActor* Other, class UPrimitiveComponent* OtherComp, struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnTouch = NULL;
-
+	UFunction* pFnTouch = (UFunction*) SdkBindings::Get ( 7097 );
 	if ( ! pFnTouch )
-		pFnTouch = (UFunction*) UObject::GObjObjects()->Data[ 112020 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_eventTouch_Parms Touch_Parms;
 	Touch_Parms.Other = Other;
@@ -2788,10 +2639,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::eventTouch ( class AActor* Other, class
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::SetExecutioner ( class APawn* Killer )
 {
-	static UFunction* pFnSetExecutioner = NULL;
-
+	UFunction* pFnSetExecutioner = (UFunction*) SdkBindings::Get ( 7096 );
 	if ( ! pFnSetExecutioner )
-		pFnSetExecutioner = (UFunction*) UObject::GObjObjects()->Data[ 112018 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execSetExecutioner_Parms SetExecutioner_Parms;
 	SetExecutioner_Parms.Killer = Killer;
@@ -2806,10 +2656,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::SetExecutioner ( class APawn* Killer )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::AttemptKillingBlow ( class APawn* Killer )
 {
-	static UFunction* pFnAttemptKillingBlow = NULL;
-
+	UFunction* pFnAttemptKillingBlow = (UFunction*) SdkBindings::Get ( 7095 );
 	if ( ! pFnAttemptKillingBlow )
-		pFnAttemptKillingBlow = (UFunction*) UObject::GObjObjects()->Data[ 112015 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execAttemptKillingBlow_Parms AttemptKillingBlow_Parms;
 	AttemptKillingBlow_Parms.Killer = Killer;
@@ -2823,10 +2672,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::AttemptKillingBlow ( class APawn* Kille
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::UpdateMappedPowerDisplay ( )
 {
-	static UFunction* pFnUpdateMappedPowerDisplay = NULL;
-
+	UFunction* pFnUpdateMappedPowerDisplay = (UFunction*) SdkBindings::Get ( 7093 );
 	if ( ! pFnUpdateMappedPowerDisplay )
-		pFnUpdateMappedPowerDisplay = (UFunction*) UObject::GObjObjects()->Data[ 112011 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execUpdateMappedPowerDisplay_Parms UpdateMappedPowerDisplay_Parms;
 
@@ -2840,10 +2688,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::UpdateMappedPowerDisplay ( )
 
 bool ASFXPawn_PlayerMP_N7Soldier_Turian::CanPlayDeathEffect ( )
 {
-	static UFunction* pFnCanPlayDeathEffect = NULL;
-
+	UFunction* pFnCanPlayDeathEffect = (UFunction*) SdkBindings::Get ( 7092 );
 	if ( ! pFnCanPlayDeathEffect )
-		pFnCanPlayDeathEffect = (UFunction*) UObject::GObjObjects()->Data[ 112009 ];
+		return {};
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execCanPlayDeathEffect_Parms CanPlayDeathEffect_Parms;
 
@@ -2858,10 +2705,9 @@ bool ASFXPawn_PlayerMP_N7Soldier_Turian::CanPlayDeathEffect ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::UseReviveConsumablePower ( )
 {
-	static UFunction* pFnUseReviveConsumablePower = NULL;
-
+	UFunction* pFnUseReviveConsumablePower = (UFunction*) SdkBindings::Get ( 7091 );
 	if ( ! pFnUseReviveConsumablePower )
-		pFnUseReviveConsumablePower = (UFunction*) UObject::GObjObjects()->Data[ 112006 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execUseReviveConsumablePower_Parms UseReviveConsumablePower_Parms;
 
@@ -2874,10 +2720,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::UseReviveConsumablePower ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::AutoMapPC ( )
 {
-	static UFunction* pFnAutoMapPC = NULL;
-
+	UFunction* pFnAutoMapPC = (UFunction*) SdkBindings::Get ( 7090 );
 	if ( ! pFnAutoMapPC )
-		pFnAutoMapPC = (UFunction*) UObject::GObjObjects()->Data[ 111997 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execAutoMapPC_Parms AutoMapPC_Parms;
 
@@ -2890,10 +2735,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::AutoMapPC ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::AutoMapXbox ( )
 {
-	static UFunction* pFnAutoMapXbox = NULL;
-
+	UFunction* pFnAutoMapXbox = (UFunction*) SdkBindings::Get ( 7089 );
 	if ( ! pFnAutoMapXbox )
-		pFnAutoMapXbox = (UFunction*) UObject::GObjObjects()->Data[ 111995 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execAutoMapXbox_Parms AutoMapXbox_Parms;
 
@@ -2909,10 +2753,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::AutoMapXbox ( )
 
 bool ASFXPawn_PlayerMP_N7Soldier_Turian::ShouldTossWeapon ( class ASFXWeapon* ChkWeapon, class ASFXWeapon* NewWeapon )
 {
-	static UFunction* pFnShouldTossWeapon = NULL;
-
+	UFunction* pFnShouldTossWeapon = (UFunction*) SdkBindings::Get ( 7088 );
 	if ( ! pFnShouldTossWeapon )
-		pFnShouldTossWeapon = (UFunction*) UObject::GObjObjects()->Data[ 111991 ];
+		return {};
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execShouldTossWeapon_Parms ShouldTossWeapon_Parms;
 	ShouldTossWeapon_Parms.ChkWeapon = ChkWeapon;
@@ -2930,10 +2773,9 @@ bool ASFXPawn_PlayerMP_N7Soldier_Turian::ShouldTossWeapon ( class ASFXWeapon* Ch
 
 bool ASFXPawn_PlayerMP_N7Soldier_Turian::InCombat ( )
 {
-	static UFunction* pFnInCombat = NULL;
-
+	UFunction* pFnInCombat = (UFunction*) SdkBindings::Get ( 7087 );
 	if ( ! pFnInCombat )
-		pFnInCombat = (UFunction*) UObject::GObjObjects()->Data[ 111989 ];
+		return {};
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execInCombat_Parms InCombat_Parms;
 
@@ -2952,10 +2794,9 @@ bool ASFXPawn_PlayerMP_N7Soldier_Turian::InCombat ( )
 
 bool ASFXPawn_PlayerMP_N7Soldier_Turian::Died ( class AController* Killer, class UClass* DamageType, struct FVector HitLocation )
 {
-	static UFunction* pFnDied = NULL;
-
+	UFunction* pFnDied = (UFunction*) SdkBindings::Get ( 7086 );
 	if ( ! pFnDied )
-		pFnDied = (UFunction*) UObject::GObjObjects()->Data[ 111983 ];
+		return {};
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execDied_Parms Died_Parms;
 	Died_Parms.Killer = Killer;
@@ -2975,10 +2816,9 @@ bool ASFXPawn_PlayerMP_N7Soldier_Turian::Died ( class AController* Killer, class
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::PossessedBy ( class AController* C, unsigned long bVehicleTransition )
 {
-	static UFunction* pFnPossessedBy = NULL;
-
+	UFunction* pFnPossessedBy = (UFunction*) SdkBindings::Get ( 7085 );
 	if ( ! pFnPossessedBy )
-		pFnPossessedBy = (UFunction*) UObject::GObjObjects()->Data[ 111980 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execPossessedBy_Parms PossessedBy_Parms;
 	PossessedBy_Parms.C = C;
@@ -2993,10 +2833,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::PossessedBy ( class AController* C, uns
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::LoadWeaponModData ( )
 {
-	static UFunction* pFnLoadWeaponModData = NULL;
-
+	UFunction* pFnLoadWeaponModData = (UFunction*) SdkBindings::Get ( 7084 );
 	if ( ! pFnLoadWeaponModData )
-		pFnLoadWeaponModData = (UFunction*) UObject::GObjObjects()->Data[ 111970 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execLoadWeaponModData_Parms LoadWeaponModData_Parms;
 
@@ -3009,10 +2848,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::LoadWeaponModData ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::LoadPowerData ( )
 {
-	static UFunction* pFnLoadPowerData = NULL;
-
+	UFunction* pFnLoadPowerData = (UFunction*) SdkBindings::Get ( 7081 );
 	if ( ! pFnLoadPowerData )
-		pFnLoadPowerData = (UFunction*) UObject::GObjObjects()->Data[ 111955 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execLoadPowerData_Parms LoadPowerData_Parms;
 
@@ -3026,10 +2864,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::LoadPowerData ( )
 
 bool ASFXPawn_PlayerMP_N7Soldier_Turian::IsTestFrameworkSetupComplete ( )
 {
-	static UFunction* pFnIsTestFrameworkSetupComplete = NULL;
-
+	UFunction* pFnIsTestFrameworkSetupComplete = (UFunction*) SdkBindings::Get ( 7080 );
 	if ( ! pFnIsTestFrameworkSetupComplete )
-		pFnIsTestFrameworkSetupComplete = (UFunction*) UObject::GObjObjects()->Data[ 111953 ];
+		return {};
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execIsTestFrameworkSetupComplete_Parms IsTestFrameworkSetupComplete_Parms;
 
@@ -3044,10 +2881,9 @@ bool ASFXPawn_PlayerMP_N7Soldier_Turian::IsTestFrameworkSetupComplete ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::LoadWeapons ( )
 {
-	static UFunction* pFnLoadWeapons = NULL;
-
+	UFunction* pFnLoadWeapons = (UFunction*) SdkBindings::Get ( 7079 );
 	if ( ! pFnLoadWeapons )
-		pFnLoadWeapons = (UFunction*) UObject::GObjObjects()->Data[ 111945 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execLoadWeapons_Parms LoadWeapons_Parms;
 
@@ -3062,10 +2898,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::LoadWeapons ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::CreateWeapons ( class USFXLoadoutData* ChkLoadout, unsigned long bForceFromEngineLoadout )
 {
-	static UFunction* pFnCreateWeapons = NULL;
-
+	UFunction* pFnCreateWeapons = (UFunction*) SdkBindings::Get ( 7078 );
 	if ( ! pFnCreateWeapons )
-		pFnCreateWeapons = (UFunction*) UObject::GObjObjects()->Data[ 111942 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execCreateWeapons_Parms CreateWeapons_Parms;
 	CreateWeapons_Parms.ChkLoadout = ChkLoadout;
@@ -3081,10 +2916,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::CreateWeapons ( class USFXLoadoutData*
 
 struct FString ASFXPawn_PlayerMP_N7Soldier_Turian::GetFullName ( )
 {
-	static UFunction* pFnGetFullName = NULL;
-
+	UFunction* pFnGetFullName = (UFunction*) SdkBindings::Get ( 7077 );
 	if ( ! pFnGetFullName )
-		pFnGetFullName = (UFunction*) UObject::GObjObjects()->Data[ 111940 ];
+		return {};
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execGetFullName_Parms GetFullName_Parms;
 
@@ -3099,10 +2933,9 @@ struct FString ASFXPawn_PlayerMP_N7Soldier_Turian::GetFullName ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::DeferredSetRichPresence ( )
 {
-	static UFunction* pFnDeferredSetRichPresence = NULL;
-
+	UFunction* pFnDeferredSetRichPresence = (UFunction*) SdkBindings::Get ( 7076 );
 	if ( ! pFnDeferredSetRichPresence )
-		pFnDeferredSetRichPresence = (UFunction*) UObject::GObjObjects()->Data[ 111939 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execDeferredSetRichPresence_Parms DeferredSetRichPresence_Parms;
 
@@ -3115,10 +2948,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::DeferredSetRichPresence ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::StopLoadingMovie ( )
 {
-	static UFunction* pFnStopLoadingMovie = NULL;
-
+	UFunction* pFnStopLoadingMovie = (UFunction*) SdkBindings::Get ( 7075 );
 	if ( ! pFnStopLoadingMovie )
-		pFnStopLoadingMovie = (UFunction*) UObject::GObjObjects()->Data[ 111937 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execStopLoadingMovie_Parms StopLoadingMovie_Parms;
 
@@ -3131,10 +2963,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::StopLoadingMovie ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::DeferredPostBeginPlay ( )
 {
-	static UFunction* pFnDeferredPostBeginPlay = NULL;
-
+	UFunction* pFnDeferredPostBeginPlay = (UFunction*) SdkBindings::Get ( 7073 );
 	if ( ! pFnDeferredPostBeginPlay )
-		pFnDeferredPostBeginPlay = (UFunction*) UObject::GObjObjects()->Data[ 111904 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execDeferredPostBeginPlay_Parms DeferredPostBeginPlay_Parms;
 
@@ -3147,10 +2978,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::DeferredPostBeginPlay ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::PostBeginPlay ( )
 {
-	static UFunction* pFnPostBeginPlay = NULL;
-
+	UFunction* pFnPostBeginPlay = (UFunction*) SdkBindings::Get ( 7072 );
 	if ( ! pFnPostBeginPlay )
-		pFnPostBeginPlay = (UFunction*) UObject::GObjObjects()->Data[ 111902 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execPostBeginPlay_Parms PostBeginPlay_Parms;
 
@@ -3163,10 +2993,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::PostBeginPlay ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::ServerPermaDeath ( )
 {
-	static UFunction* pFnServerPermaDeath = NULL;
-
+	UFunction* pFnServerPermaDeath = (UFunction*) SdkBindings::Get ( 7071 );
 	if ( ! pFnServerPermaDeath )
-		pFnServerPermaDeath = (UFunction*) UObject::GObjObjects()->Data[ 111899 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execServerPermaDeath_Parms ServerPermaDeath_Parms;
 
@@ -3179,10 +3008,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::ServerPermaDeath ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::PermaDeath ( )
 {
-	static UFunction* pFnPermaDeath = NULL;
-
+	UFunction* pFnPermaDeath = (UFunction*) SdkBindings::Get ( 7070 );
 	if ( ! pFnPermaDeath )
-		pFnPermaDeath = (UFunction*) UObject::GObjObjects()->Data[ 111897 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execPermaDeath_Parms PermaDeath_Parms;
 
@@ -3195,10 +3023,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::PermaDeath ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::StartSpectatorCam ( )
 {
-	static UFunction* pFnStartSpectatorCam = NULL;
-
+	UFunction* pFnStartSpectatorCam = (UFunction*) SdkBindings::Get ( 7069 );
 	if ( ! pFnStartSpectatorCam )
-		pFnStartSpectatorCam = (UFunction*) UObject::GObjObjects()->Data[ 111895 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execStartSpectatorCam_Parms StartSpectatorCam_Parms;
 
@@ -3211,10 +3038,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::StartSpectatorCam ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::PermaDeadChanged ( )
 {
-	static UFunction* pFnPermaDeadChanged = NULL;
-
+	UFunction* pFnPermaDeadChanged = (UFunction*) SdkBindings::Get ( 7068 );
 	if ( ! pFnPermaDeadChanged )
-		pFnPermaDeadChanged = (UFunction*) UObject::GObjObjects()->Data[ 111891 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execPermaDeadChanged_Parms PermaDeadChanged_Parms;
 
@@ -3230,10 +3056,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::PermaDeadChanged ( )
 
 bool ASFXPawn_PlayerMP_N7Soldier_Turian::eventResurrect ( float PercentOfHealthRegained, unsigned long bIsInstantaneous )
 {
-	static UFunction* pFnResurrect = NULL;
-
+	UFunction* pFnResurrect = (UFunction*) SdkBindings::Get ( 7067 );
 	if ( ! pFnResurrect )
-		pFnResurrect = (UFunction*) UObject::GObjObjects()->Data[ 111887 ];
+		return {};
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_eventResurrect_Parms Resurrect_Parms;
 	Resurrect_Parms.PercentOfHealthRegained = PercentOfHealthRegained;
@@ -3250,10 +3075,9 @@ bool ASFXPawn_PlayerMP_N7Soldier_Turian::eventResurrect ( float PercentOfHealthR
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::PreClientTravel ( )
 {
-	static UFunction* pFnPreClientTravel = NULL;
-
+	UFunction* pFnPreClientTravel = (UFunction*) SdkBindings::Get ( 7066 );
 	if ( ! pFnPreClientTravel )
-		pFnPreClientTravel = (UFunction*) UObject::GObjObjects()->Data[ 111884 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execPreClientTravel_Parms PreClientTravel_Parms;
 
@@ -3268,10 +3092,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::PreClientTravel ( )
 
 bool ASFXPawn_PlayerMP_N7Soldier_Turian::IsReadyForExecution ( class Asfxpawn* Killer )
 {
-	static UFunction* pFnIsReadyForExecution = NULL;
-
+	UFunction* pFnIsReadyForExecution = (UFunction*) SdkBindings::Get ( 7065 );
 	if ( ! pFnIsReadyForExecution )
-		pFnIsReadyForExecution = (UFunction*) UObject::GObjObjects()->Data[ 111880 ];
+		return {};
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execIsReadyForExecution_Parms IsReadyForExecution_Parms;
 	IsReadyForExecution_Parms.Killer = Killer;
@@ -3287,10 +3110,9 @@ bool ASFXPawn_PlayerMP_N7Soldier_Turian::IsReadyForExecution ( class Asfxpawn* K
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::IsDeadUpdated ( )
 {
-	static UFunction* pFnIsDeadUpdated = NULL;
-
+	UFunction* pFnIsDeadUpdated = (UFunction*) SdkBindings::Get ( 7064 );
 	if ( ! pFnIsDeadUpdated )
-		pFnIsDeadUpdated = (UFunction*) UObject::GObjObjects()->Data[ 111850 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execIsDeadUpdated_Parms IsDeadUpdated_Parms;
 
@@ -3304,10 +3126,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::IsDeadUpdated ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::StartRevive ( class ASFXPawn_PlayerParty* TargetPawn )
 {
-	static UFunction* pFnStartRevive = NULL;
-
+	UFunction* pFnStartRevive = (UFunction*) SdkBindings::Get ( 7063 );
 	if ( ! pFnStartRevive )
-		pFnStartRevive = (UFunction*) UObject::GObjObjects()->Data[ 111848 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execStartRevive_Parms StartRevive_Parms;
 	StartRevive_Parms.TargetPawn = TargetPawn;
@@ -3321,10 +3142,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::StartRevive ( class ASFXPawn_PlayerPart
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::FinalizeProcessFellOutOfWorld ( )
 {
-	static UFunction* pFnFinalizeProcessFellOutOfWorld = NULL;
-
+	UFunction* pFnFinalizeProcessFellOutOfWorld = (UFunction*) SdkBindings::Get ( 7061 );
 	if ( ! pFnFinalizeProcessFellOutOfWorld )
-		pFnFinalizeProcessFellOutOfWorld = (UFunction*) UObject::GObjObjects()->Data[ 111846 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execFinalizeProcessFellOutOfWorld_Parms FinalizeProcessFellOutOfWorld_Parms;
 
@@ -3337,10 +3157,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::FinalizeProcessFellOutOfWorld ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::ServerFellOutOfWorldImpl ( )
 {
-	static UFunction* pFnServerFellOutOfWorldImpl = NULL;
-
+	UFunction* pFnServerFellOutOfWorldImpl = (UFunction*) SdkBindings::Get ( 7062 );
 	if ( ! pFnServerFellOutOfWorldImpl )
-		pFnServerFellOutOfWorldImpl = (UFunction*) UObject::GObjObjects()->Data[ 111847 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execServerFellOutOfWorldImpl_Parms ServerFellOutOfWorldImpl_Parms;
 
@@ -3353,10 +3172,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::ServerFellOutOfWorldImpl ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::eventFellOutOfWorldImpl ( )
 {
-	static UFunction* pFnFellOutOfWorldImpl = NULL;
-
+	UFunction* pFnFellOutOfWorldImpl = (UFunction*) SdkBindings::Get ( 7060 );
 	if ( ! pFnFellOutOfWorldImpl )
-		pFnFellOutOfWorldImpl = (UFunction*) UObject::GObjObjects()->Data[ 111844 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_eventFellOutOfWorldImpl_Parms FellOutOfWorldImpl_Parms;
 
@@ -3369,10 +3187,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::eventFellOutOfWorldImpl ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::BioBaseRemovedFromWorld ( )
 {
-	static UFunction* pFnBioBaseRemovedFromWorld = NULL;
-
+	UFunction* pFnBioBaseRemovedFromWorld = (UFunction*) SdkBindings::Get ( 7059 );
 	if ( ! pFnBioBaseRemovedFromWorld )
-		pFnBioBaseRemovedFromWorld = (UFunction*) UObject::GObjObjects()->Data[ 111843 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execBioBaseRemovedFromWorld_Parms BioBaseRemovedFromWorld_Parms;
 
@@ -3385,10 +3202,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::BioBaseRemovedFromWorld ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::OutsideWorldBounds ( )
 {
-	static UFunction* pFnOutsideWorldBounds = NULL;
-
+	UFunction* pFnOutsideWorldBounds = (UFunction*) SdkBindings::Get ( 7058 );
 	if ( ! pFnOutsideWorldBounds )
-		pFnOutsideWorldBounds = (UFunction*) UObject::GObjObjects()->Data[ 111842 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execOutsideWorldBounds_Parms OutsideWorldBounds_Parms;
 
@@ -3402,10 +3218,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::OutsideWorldBounds ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::FellOutOfWorld ( class UClass* dmgType )
 {
-	static UFunction* pFnFellOutOfWorld = NULL;
-
+	UFunction* pFnFellOutOfWorld = (UFunction*) SdkBindings::Get ( 7057 );
 	if ( ! pFnFellOutOfWorld )
-		pFnFellOutOfWorld = (UFunction*) UObject::GObjObjects()->Data[ 111840 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execFellOutOfWorld_Parms FellOutOfWorld_Parms;
 	FellOutOfWorld_Parms.dmgType = dmgType;
@@ -3422,10 +3237,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::FellOutOfWorld ( class UClass* dmgType
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::ApplyCustomizationToActor ( class AActor* InTarget, class USFXCustomizationInstance* InSettings, int UIWorldConfigFlags )
 {
-	static UFunction* pFnApplyCustomizationToActor = NULL;
-
+	UFunction* pFnApplyCustomizationToActor = (UFunction*) SdkBindings::Get ( 7056 );
 	if ( ! pFnApplyCustomizationToActor )
-		pFnApplyCustomizationToActor = (UFunction*) UObject::GObjObjects()->Data[ 111836 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execApplyCustomizationToActor_Parms ApplyCustomizationToActor_Parms;
 	ApplyCustomizationToActor_Parms.InTarget = InTarget;
@@ -3448,10 +3262,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::ApplyCustomizationToActor ( class AActo
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::GetMPAppearanceVariables ( int* Tint1, int* Tint2, int* Pattern, int* PatternColor, int* Phong, int* Emissive, int* SkinTone )
 {
-	static UFunction* pFnGetMPAppearanceVariables = NULL;
-
+	UFunction* pFnGetMPAppearanceVariables = (UFunction*) SdkBindings::Get ( 7055 );
 	if ( ! pFnGetMPAppearanceVariables )
-		pFnGetMPAppearanceVariables = (UFunction*) UObject::GObjObjects()->Data[ 111828 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execGetMPAppearanceVariables_Parms GetMPAppearanceVariables_Parms;
 
@@ -3492,10 +3305,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::GetMPAppearanceVariables ( int* Tint1,
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::SetMPAppearanceVariables ( int Tint1, int Tint2, int Pattern, int PatternColor, int Phong, int Emissive, int SkinTone )
 {
-	static UFunction* pFnSetMPAppearanceVariables = NULL;
-
+	UFunction* pFnSetMPAppearanceVariables = (UFunction*) SdkBindings::Get ( 7054 );
 	if ( ! pFnSetMPAppearanceVariables )
-		pFnSetMPAppearanceVariables = (UFunction*) UObject::GObjObjects()->Data[ 111820 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execSetMPAppearanceVariables_Parms SetMPAppearanceVariables_Parms;
 	SetMPAppearanceVariables_Parms.Tint1 = Tint1;
@@ -3515,10 +3327,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::SetMPAppearanceVariables ( int Tint1, i
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::UpdateAppearance ( )
 {
-	static UFunction* pFnUpdateAppearance = NULL;
-
+	UFunction* pFnUpdateAppearance = (UFunction*) SdkBindings::Get ( 7053 );
 	if ( ! pFnUpdateAppearance )
-		pFnUpdateAppearance = (UFunction*) UObject::GObjObjects()->Data[ 111819 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execUpdateAppearance_Parms UpdateAppearance_Parms;
 
@@ -3532,10 +3343,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::UpdateAppearance ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::CopyPawnAppearance ( class ABioPawn* SourcePawn )
 {
-	static UFunction* pFnCopyPawnAppearance = NULL;
-
+	UFunction* pFnCopyPawnAppearance = (UFunction*) SdkBindings::Get ( 7052 );
 	if ( ! pFnCopyPawnAppearance )
-		pFnCopyPawnAppearance = (UFunction*) UObject::GObjObjects()->Data[ 111809 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execCopyPawnAppearance_Parms CopyPawnAppearance_Parms;
 	CopyPawnAppearance_Parms.SourcePawn = SourcePawn;
@@ -3549,10 +3359,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::CopyPawnAppearance ( class ABioPawn* So
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::CheckEnterCombat ( )
 {
-	static UFunction* pFnCheckEnterCombat = NULL;
-
+	UFunction* pFnCheckEnterCombat = (UFunction*) SdkBindings::Get ( 7051 );
 	if ( ! pFnCheckEnterCombat )
-		pFnCheckEnterCombat = (UFunction*) UObject::GObjObjects()->Data[ 111808 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execCheckEnterCombat_Parms CheckEnterCombat_Parms;
 
@@ -3565,10 +3374,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::CheckEnterCombat ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::PlayerRevivedMessage ( )
 {
-	static UFunction* pFnPlayerRevivedMessage = NULL;
-
+	UFunction* pFnPlayerRevivedMessage = (UFunction*) SdkBindings::Get ( 7050 );
 	if ( ! pFnPlayerRevivedMessage )
-		pFnPlayerRevivedMessage = (UFunction*) UObject::GObjObjects()->Data[ 111805 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execPlayerRevivedMessage_Parms PlayerRevivedMessage_Parms;
 
@@ -3581,10 +3389,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::PlayerRevivedMessage ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::PlayerKilledMessage ( )
 {
-	static UFunction* pFnPlayerKilledMessage = NULL;
-
+	UFunction* pFnPlayerKilledMessage = (UFunction*) SdkBindings::Get ( 7049 );
 	if ( ! pFnPlayerKilledMessage )
-		pFnPlayerKilledMessage = (UFunction*) UObject::GObjObjects()->Data[ 111800 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execPlayerKilledMessage_Parms PlayerKilledMessage_Parms;
 
@@ -3598,10 +3405,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::PlayerKilledMessage ( )
 
 void ASFXPawn_PlayerMP_N7Soldier_Turian::eventReplicatedEvent ( struct FName VarName )
 {
-	static UFunction* pFnReplicatedEvent = NULL;
-
+	UFunction* pFnReplicatedEvent = (UFunction*) SdkBindings::Get ( 7048 );
 	if ( ! pFnReplicatedEvent )
-		pFnReplicatedEvent = (UFunction*) UObject::GObjObjects()->Data[ 111798 ];
+		return;
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_eventReplicatedEvent_Parms ReplicatedEvent_Parms;
 	memcpy ( &ReplicatedEvent_Parms.VarName, &VarName, 0x8 );
@@ -3616,10 +3422,9 @@ void ASFXPawn_PlayerMP_N7Soldier_Turian::eventReplicatedEvent ( struct FName Var
 
 struct FString ASFXPawn_PlayerMP_N7Soldier_Turian::GetActorGameName ( )
 {
-	static UFunction* pFnGetActorGameName = NULL;
-
+	UFunction* pFnGetActorGameName = (UFunction*) SdkBindings::Get ( 7047 );
 	if ( ! pFnGetActorGameName )
-		pFnGetActorGameName = (UFunction*) UObject::GObjObjects()->Data[ 111795 ];
+		return {};
 
 	ASFXPawn_PlayerMP_N7Soldier_Turian_execGetActorGameName_Parms GetActorGameName_Parms;
 
@@ -3636,10 +3441,9 @@ struct FString ASFXPawn_PlayerMP_N7Soldier_Turian::GetActorGameName ( )
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::PrecacheVFX ( class ASFXObjectPool* ObjectPool, class URvrClientEffectManager* ClientEffects )
 {
-	static UFunction* pFnPrecacheVFX = NULL;
-
+	UFunction* pFnPrecacheVFX = (UFunction*) SdkBindings::Get ( 5663 );
 	if ( ! pFnPrecacheVFX )
-		pFnPrecacheVFX = (UFunction*) UObject::GObjObjects()->Data[ 83104 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execPrecacheVFX_Parms PrecacheVFX_Parms;
 	PrecacheVFX_Parms.ObjectPool = ObjectPool;
@@ -3655,10 +3459,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::PrecacheVFX ( class ASFXObjectP
 
 bool ASFXProjectile_PowerCustomActionMP_JetPack::IsTargettedProjectile ( )
 {
-	static UFunction* pFnIsTargettedProjectile = NULL;
-
+	UFunction* pFnIsTargettedProjectile = (UFunction*) SdkBindings::Get ( 5662 );
 	if ( ! pFnIsTargettedProjectile )
-		pFnIsTargettedProjectile = (UFunction*) UObject::GObjObjects()->Data[ 83102 ];
+		return {};
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execIsTargettedProjectile_Parms IsTargettedProjectile_Parms;
 
@@ -3673,10 +3476,9 @@ bool ASFXProjectile_PowerCustomActionMP_JetPack::IsTargettedProjectile ( )
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::Destroyed ( )
 {
-	static UFunction* pFnDestroyed = NULL;
-
+	UFunction* pFnDestroyed = (UFunction*) SdkBindings::Get ( 5661 );
 	if ( ! pFnDestroyed )
-		pFnDestroyed = (UFunction*) UObject::GObjObjects()->Data[ 83101 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execDestroyed_Parms Destroyed_Parms;
 
@@ -3690,10 +3492,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::Destroyed ( )
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::Tick_Prediction ( float DeltaTime )
 {
-	static UFunction* pFnTick_Prediction = NULL;
-
+	UFunction* pFnTick_Prediction = (UFunction*) SdkBindings::Get ( 5660 );
 	if ( ! pFnTick_Prediction )
-		pFnTick_Prediction = (UFunction*) UObject::GObjObjects()->Data[ 83095 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execTick_Prediction_Parms Tick_Prediction_Parms;
 	Tick_Prediction_Parms.DeltaTime = DeltaTime;
@@ -3708,10 +3509,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::Tick_Prediction ( float DeltaTi
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::SetPredictionTarget ( class ASFXProjectile* NewTargetProjectile )
 {
-	static UFunction* pFnSetPredictionTarget = NULL;
-
+	UFunction* pFnSetPredictionTarget = (UFunction*) SdkBindings::Get ( 5384 );
 	if ( ! pFnSetPredictionTarget )
-		pFnSetPredictionTarget = (UFunction*) UObject::GObjObjects()->Data[ 75444 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execSetPredictionTarget_Parms SetPredictionTarget_Parms;
 	SetPredictionTarget_Parms.NewTargetProjectile = NewTargetProjectile;
@@ -3727,10 +3527,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::SetPredictionTarget ( class ASF
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::SetPrediction ( unsigned long Active, unsigned long bIsATarget )
 {
-	static UFunction* pFnSetPrediction = NULL;
-
+	UFunction* pFnSetPrediction = (UFunction*) SdkBindings::Get ( 5381 );
 	if ( ! pFnSetPrediction )
-		pFnSetPrediction = (UFunction*) UObject::GObjObjects()->Data[ 75435 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execSetPrediction_Parms SetPrediction_Parms;
 	SetPrediction_Parms.Active = Active;
@@ -3745,10 +3544,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::SetPrediction ( unsigned long A
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::SetPredictedInitialSpeed ( )
 {
-	static UFunction* pFnSetPredictedInitialSpeed = NULL;
-
+	UFunction* pFnSetPredictedInitialSpeed = (UFunction*) SdkBindings::Get ( 5638 );
 	if ( ! pFnSetPredictedInitialSpeed )
-		pFnSetPredictedInitialSpeed = (UFunction*) UObject::GObjObjects()->Data[ 83024 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execSetPredictedInitialSpeed_Parms SetPredictedInitialSpeed_Parms;
 
@@ -3761,10 +3559,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::SetPredictedInitialSpeed ( )
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::Reset ( )
 {
-	static UFunction* pFnReset = NULL;
-
+	UFunction* pFnReset = (UFunction*) SdkBindings::Get ( 5659 );
 	if ( ! pFnReset )
-		pFnReset = (UFunction*) UObject::GObjObjects()->Data[ 83090 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execReset_Parms Reset_Parms;
 
@@ -3777,10 +3574,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::Reset ( )
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::ReplicatedExplosionUpdated ( )
 {
-	static UFunction* pFnReplicatedExplosionUpdated = NULL;
-
+	UFunction* pFnReplicatedExplosionUpdated = (UFunction*) SdkBindings::Get ( 5658 );
 	if ( ! pFnReplicatedExplosionUpdated )
-		pFnReplicatedExplosionUpdated = (UFunction*) UObject::GObjObjects()->Data[ 83089 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execReplicatedExplosionUpdated_Parms ReplicatedExplosionUpdated_Parms;
 
@@ -3793,10 +3589,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::ReplicatedExplosionUpdated ( )
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::ReplicatedInitUpdated ( )
 {
-	static UFunction* pFnReplicatedInitUpdated = NULL;
-
+	UFunction* pFnReplicatedInitUpdated = (UFunction*) SdkBindings::Get ( 5657 );
 	if ( ! pFnReplicatedInitUpdated )
-		pFnReplicatedInitUpdated = (UFunction*) UObject::GObjObjects()->Data[ 83086 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execReplicatedInitUpdated_Parms ReplicatedInitUpdated_Parms;
 
@@ -3811,10 +3606,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::ReplicatedInitUpdated ( )
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::ReplicateExplode ( struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnReplicateExplode = NULL;
-
+	UFunction* pFnReplicateExplode = (UFunction*) SdkBindings::Get ( 5656 );
 	if ( ! pFnReplicateExplode )
-		pFnReplicateExplode = (UFunction*) UObject::GObjObjects()->Data[ 83081 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execReplicateExplode_Parms ReplicateExplode_Parms;
 	memcpy ( &ReplicateExplode_Parms.HitLocation, &HitLocation, 0xC );
@@ -3830,10 +3624,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::ReplicateExplode ( struct FVect
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::ReplicateInit ( struct FVector Direction )
 {
-	static UFunction* pFnReplicateInit = NULL;
-
+	UFunction* pFnReplicateInit = (UFunction*) SdkBindings::Get ( 5655 );
 	if ( ! pFnReplicateInit )
-		pFnReplicateInit = (UFunction*) UObject::GObjObjects()->Data[ 83078 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execReplicateInit_Parms ReplicateInit_Parms;
 	memcpy ( &ReplicateInit_Parms.Direction, &Direction, 0xC );
@@ -3848,10 +3641,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::ReplicateInit ( struct FVector
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::eventReplicatedEvent ( struct FName VarName )
 {
-	static UFunction* pFnReplicatedEvent = NULL;
-
+	UFunction* pFnReplicatedEvent = (UFunction*) SdkBindings::Get ( 5654 );
 	if ( ! pFnReplicatedEvent )
-		pFnReplicatedEvent = (UFunction*) UObject::GObjObjects()->Data[ 83075 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_eventReplicatedEvent_Parms ReplicatedEvent_Parms;
 	memcpy ( &ReplicatedEvent_Parms.VarName, &VarName, 0x8 );
@@ -3867,10 +3659,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::eventReplicatedEvent ( struct F
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::SpawnImpactEffect ( struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnSpawnImpactEffect = NULL;
-
+	UFunction* pFnSpawnImpactEffect = (UFunction*) SdkBindings::Get ( 5653 );
 	if ( ! pFnSpawnImpactEffect )
-		pFnSpawnImpactEffect = (UFunction*) UObject::GObjObjects()->Data[ 83072 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execSpawnImpactEffect_Parms SpawnImpactEffect_Parms;
 	memcpy ( &SpawnImpactEffect_Parms.HitLocation, &HitLocation, 0xC );
@@ -3886,10 +3677,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::SpawnImpactEffect ( struct FVec
 
 float ASFXProjectile_PowerCustomActionMP_JetPack::GetMomentum ( )
 {
-	static UFunction* pFnGetMomentum = NULL;
-
+	UFunction* pFnGetMomentum = (UFunction*) SdkBindings::Get ( 5652 );
 	if ( ! pFnGetMomentum )
-		pFnGetMomentum = (UFunction*) UObject::GObjObjects()->Data[ 83068 ];
+		return {};
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execGetMomentum_Parms GetMomentum_Parms;
 
@@ -3905,10 +3695,9 @@ float ASFXProjectile_PowerCustomActionMP_JetPack::GetMomentum ( )
 
 float ASFXProjectile_PowerCustomActionMP_JetPack::GetDamageRadius ( )
 {
-	static UFunction* pFnGetDamageRadius = NULL;
-
+	UFunction* pFnGetDamageRadius = (UFunction*) SdkBindings::Get ( 5651 );
 	if ( ! pFnGetDamageRadius )
-		pFnGetDamageRadius = (UFunction*) UObject::GObjObjects()->Data[ 83065 ];
+		return {};
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execGetDamageRadius_Parms GetDamageRadius_Parms;
 
@@ -3924,10 +3713,9 @@ float ASFXProjectile_PowerCustomActionMP_JetPack::GetDamageRadius ( )
 
 float ASFXProjectile_PowerCustomActionMP_JetPack::GetDamage ( )
 {
-	static UFunction* pFnGetDamage = NULL;
-
+	UFunction* pFnGetDamage = (UFunction*) SdkBindings::Get ( 5650 );
 	if ( ! pFnGetDamage )
-		pFnGetDamage = (UFunction*) UObject::GObjObjects()->Data[ 83062 ];
+		return {};
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execGetDamage_Parms GetDamage_Parms;
 
@@ -3945,10 +3733,9 @@ float ASFXProjectile_PowerCustomActionMP_JetPack::GetDamage ( )
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::Bounce ( class AActor* HitActor, struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnBounce = NULL;
-
+	UFunction* pFnBounce = (UFunction*) SdkBindings::Get ( 5649 );
 	if ( ! pFnBounce )
-		pFnBounce = (UFunction*) UObject::GObjObjects()->Data[ 83053 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execBounce_Parms Bounce_Parms;
 	Bounce_Parms.HitActor = HitActor;
@@ -3967,10 +3754,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::Bounce ( class AActor* HitActor
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::ProcessTouch ( class AActor* Other, struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnProcessTouch = NULL;
-
+	UFunction* pFnProcessTouch = (UFunction*) SdkBindings::Get ( 5648 );
 	if ( ! pFnProcessTouch )
-		pFnProcessTouch = (UFunction*) UObject::GObjObjects()->Data[ 83049 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execProcessTouch_Parms ProcessTouch_Parms;
 	ProcessTouch_Parms.Other = Other;
@@ -3986,10 +3772,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::ProcessTouch ( class AActor* Ot
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::ApplyExternalForce ( )
 {
-	static UFunction* pFnApplyExternalForce = NULL;
-
+	UFunction* pFnApplyExternalForce = (UFunction*) SdkBindings::Get ( 5647 );
 	if ( ! pFnApplyExternalForce )
-		pFnApplyExternalForce = (UFunction*) UObject::GObjObjects()->Data[ 83048 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execApplyExternalForce_Parms ApplyExternalForce_Parms;
 
@@ -4003,10 +3788,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::ApplyExternalForce ( )
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::Tick ( float DeltaTime )
 {
-	static UFunction* pFnTick = NULL;
-
+	UFunction* pFnTick = (UFunction*) SdkBindings::Get ( 5646 );
 	if ( ! pFnTick )
-		pFnTick = (UFunction*) UObject::GObjObjects()->Data[ 83043 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execTick_Parms Tick_Parms;
 	Tick_Parms.DeltaTime = DeltaTime;
@@ -4021,10 +3805,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::Tick ( float DeltaTime )
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::ProjEffectsTrailFinished ( class UParticleSystemComponent* PSC )
 {
-	static UFunction* pFnProjEffectsTrailFinished = NULL;
-
+	UFunction* pFnProjEffectsTrailFinished = (UFunction*) SdkBindings::Get ( 5645 );
 	if ( ! pFnProjEffectsTrailFinished )
-		pFnProjEffectsTrailFinished = (UFunction*) UObject::GObjObjects()->Data[ 83041 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execProjEffectsTrailFinished_Parms ProjEffectsTrailFinished_Parms;
 	ProjEffectsTrailFinished_Parms.PSC = PSC;
@@ -4039,10 +3822,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::ProjEffectsTrailFinished ( clas
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::SetProjectileHidden ( unsigned long bHide )
 {
-	static UFunction* pFnSetProjectileHidden = NULL;
-
+	UFunction* pFnSetProjectileHidden = (UFunction*) SdkBindings::Get ( 5644 );
 	if ( ! pFnSetProjectileHidden )
-		pFnSetProjectileHidden = (UFunction*) UObject::GObjObjects()->Data[ 83038 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execSetProjectileHidden_Parms SetProjectileHidden_Parms;
 	SetProjectileHidden_Parms.bHide = bHide;
@@ -4058,10 +3840,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::SetProjectileHidden ( unsigned
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::Explode ( struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnExplode = NULL;
-
+	UFunction* pFnExplode = (UFunction*) SdkBindings::Get ( 5643 );
 	if ( ! pFnExplode )
-		pFnExplode = (UFunction*) UObject::GObjObjects()->Data[ 83035 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execExplode_Parms Explode_Parms;
 	memcpy ( &Explode_Parms.HitLocation, &HitLocation, 0xC );
@@ -4079,10 +3860,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::Explode ( struct FVector HitLoc
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::eventHitWall ( struct FVector HitNormal, class AActor* Wall, class UPrimitiveComponent* WallComp )
 {
-	static UFunction* pFnHitWall = NULL;
-
+	UFunction* pFnHitWall = (UFunction*) SdkBindings::Get ( 5642 );
 	if ( ! pFnHitWall )
-		pFnHitWall = (UFunction*) UObject::GObjObjects()->Data[ 83030 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_eventHitWall_Parms HitWall_Parms;
 	memcpy ( &HitWall_Parms.HitNormal, &HitNormal, 0xC );
@@ -4098,10 +3878,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::eventHitWall ( struct FVector H
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::OutsideWorldBounds ( )
 {
-	static UFunction* pFnOutsideWorldBounds = NULL;
-
+	UFunction* pFnOutsideWorldBounds = (UFunction*) SdkBindings::Get ( 5641 );
 	if ( ! pFnOutsideWorldBounds )
-		pFnOutsideWorldBounds = (UFunction*) UObject::GObjObjects()->Data[ 83029 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execOutsideWorldBounds_Parms OutsideWorldBounds_Parms;
 
@@ -4115,10 +3894,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::OutsideWorldBounds ( )
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::FellOutOfWorld ( class UClass* dmgType )
 {
-	static UFunction* pFnFellOutOfWorld = NULL;
-
+	UFunction* pFnFellOutOfWorld = (UFunction*) SdkBindings::Get ( 5640 );
 	if ( ! pFnFellOutOfWorld )
-		pFnFellOutOfWorld = (UFunction*) UObject::GObjObjects()->Data[ 83027 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execFellOutOfWorld_Parms FellOutOfWorld_Parms;
 	FellOutOfWorld_Parms.dmgType = dmgType;
@@ -4133,10 +3911,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::FellOutOfWorld ( class UClass*
 
 bool ASFXProjectile_PowerCustomActionMP_JetPack::IsShuttingDown ( )
 {
-	static UFunction* pFnIsShuttingDown = NULL;
-
+	UFunction* pFnIsShuttingDown = (UFunction*) SdkBindings::Get ( 5383 );
 	if ( ! pFnIsShuttingDown )
-		pFnIsShuttingDown = (UFunction*) UObject::GObjObjects()->Data[ 75442 ];
+		return {};
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execIsShuttingDown_Parms IsShuttingDown_Parms;
 
@@ -4151,10 +3928,9 @@ bool ASFXProjectile_PowerCustomActionMP_JetPack::IsShuttingDown ( )
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::ShutDown ( )
 {
-	static UFunction* pFnShutDown = NULL;
-
+	UFunction* pFnShutDown = (UFunction*) SdkBindings::Get ( 5639 );
 	if ( ! pFnShutDown )
-		pFnShutDown = (UFunction*) UObject::GObjObjects()->Data[ 83025 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execShutDown_Parms ShutDown_Parms;
 
@@ -4168,10 +3944,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::ShutDown ( )
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::Init ( struct FVector Direction )
 {
-	static UFunction* pFnInit = NULL;
-
+	UFunction* pFnInit = (UFunction*) SdkBindings::Get ( 5637 );
 	if ( ! pFnInit )
-		pFnInit = (UFunction*) UObject::GObjObjects()->Data[ 83022 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execInit_Parms Init_Parms;
 	memcpy ( &Init_Parms.Direction, &Direction, 0xC );
@@ -4185,10 +3960,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::Init ( struct FVector Direction
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::ShutdownPostEffects ( )
 {
-	static UFunction* pFnShutdownPostEffects = NULL;
-
+	UFunction* pFnShutdownPostEffects = (UFunction*) SdkBindings::Get ( 5636 );
 	if ( ! pFnShutdownPostEffects )
-		pFnShutdownPostEffects = (UFunction*) UObject::GObjObjects()->Data[ 83021 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execShutdownPostEffects_Parms ShutdownPostEffects_Parms;
 
@@ -4201,10 +3975,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::ShutdownPostEffects ( )
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::eventReuse ( )
 {
-	static UFunction* pFnReuse = NULL;
-
+	UFunction* pFnReuse = (UFunction*) SdkBindings::Get ( 5547 );
 	if ( ! pFnReuse )
-		pFnReuse = (UFunction*) UObject::GObjObjects()->Data[ 78095 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_eventReuse_Parms Reuse_Parms;
 
@@ -4217,10 +3990,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::eventReuse ( )
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::eventRecycle ( )
 {
-	static UFunction* pFnRecycle = NULL;
-
+	UFunction* pFnRecycle = (UFunction*) SdkBindings::Get ( 5635 );
 	if ( ! pFnRecycle )
-		pFnRecycle = (UFunction*) UObject::GObjObjects()->Data[ 83014 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_eventRecycle_Parms Recycle_Parms;
 
@@ -4233,10 +4005,9 @@ void ASFXProjectile_PowerCustomActionMP_JetPack::eventRecycle ( )
 
 void ASFXProjectile_PowerCustomActionMP_JetPack::SpawnFlightEffects ( )
 {
-	static UFunction* pFnSpawnFlightEffects = NULL;
-
+	UFunction* pFnSpawnFlightEffects = (UFunction*) SdkBindings::Get ( 5634 );
 	if ( ! pFnSpawnFlightEffects )
-		pFnSpawnFlightEffects = (UFunction*) UObject::GObjObjects()->Data[ 83006 ];
+		return;
 
 	ASFXProjectile_PowerCustomActionMP_JetPack_execSpawnFlightEffects_Parms SpawnFlightEffects_Parms;
 
@@ -60,16 +60,9 @@ public:
 	unsigned long                                      m_bInitialized : 1;                               		// 0x02B8 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      m_bCooldownOverrideOn : 1;                        		// 0x02B8 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 124673 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7407 );
 	};
 
 	class UGFxValue* AS_GetCollectorCooldownForPowerIcon ( struct FString sIconID );
@@ -89,46 +82,28 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* USFXGUI_CollectorHUDOverlay::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4_horde.SFXMP4_ForcedReference
 // 0x0000 (0x003C - 0x003C)
 class USFXMP4_ForcedReference : public USFXSharedMP_ForcedReference
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 124739 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7424 );
 	};
 
 };
 
-UClass* USFXMP4_ForcedReference::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4_horde.SFXWave_Horde_Cerberus2
 // 0x0000 (0x0148 - 0x0148)
 class USFXWave_Horde_Cerberus2 : public USFXWave_Horde
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 124741 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7425 );
 	};
 
 	void StartAutoBots ( );
@@ -162,24 +137,15 @@ public:
 	void InitializeWave ( class ASFXWaveManager* OwnerManager );
 };
 
-UClass* USFXWave_Horde_Cerberus2::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4_horde.SFXWave_Horde_Collector
 // 0x0000 (0x0148 - 0x0148)
 class USFXWave_Horde_Collector : public USFXWave_Horde
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 124743 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7426 );
 	};
 
 	void StartAutoBots ( );
@@ -213,24 +179,15 @@ public:
 	void InitializeWave ( class ASFXWaveManager* OwnerManager );
 };
 
-UClass* USFXWave_Horde_Collector::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4_horde.SFXWave_Horde_Geth2
 // 0x0000 (0x0148 - 0x0148)
 class USFXWave_Horde_Geth2 : public USFXWave_Horde
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 124745 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7427 );
 	};
 
 	void StartAutoBots ( );
@@ -264,24 +221,15 @@ public:
 	void InitializeWave ( class ASFXWaveManager* OwnerManager );
 };
 
-UClass* USFXWave_Horde_Geth2::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp4_horde.SFXWave_Horde_Reaper2
 // 0x0000 (0x0148 - 0x0148)
 class USFXWave_Horde_Reaper2 : public USFXWave_Horde
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 124747 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7428 );
 	};
 
 	void StartAutoBots ( );
@@ -315,8 +263,6 @@ public:
 	void InitializeWave ( class ASFXWaveManager* OwnerManager );
 };
 
-UClass* USFXWave_Horde_Reaper2::pClassPointer = NULL;
-
 
 #ifdef _MSC_VER
 	#pragma pack ( pop )
@@ -29,10 +29,9 @@
 
 class UGFxValue* USFXGUI_CollectorHUDOverlay::AS_GetCollectorCooldownForPowerIcon ( struct FString sIconID )
 {
-	static UFunction* pFnAS_GetCollectorCooldownForPowerIcon = NULL;
-
+	UFunction* pFnAS_GetCollectorCooldownForPowerIcon = (UFunction*) SdkBindings::Get ( 7421 );
 	if ( ! pFnAS_GetCollectorCooldownForPowerIcon )
-		pFnAS_GetCollectorCooldownForPowerIcon = (UFunction*) UObject::GObjObjects()->Data[ 124714 ];
+		return {};
 
 	USFXGUI_CollectorHUDOverlay_execAS_GetCollectorCooldownForPowerIcon_Parms AS_GetCollectorCooldownForPowerIcon_Parms;
 	memcpy ( &AS_GetCollectorCooldownForPowerIcon_Parms.sIconID, &sIconID, 0xC );
@@ -48,10 +47,9 @@ class UGFxValue* USFXGUI_CollectorHUDOverlay::AS_GetCollectorCooldownForPowerIco
 
 void USFXGUI_CollectorHUDOverlay::AS_ResetCooldownPowerIcons ( )
 {
-	static UFunction* pFnAS_ResetCooldownPowerIcons = NULL;
-
+	UFunction* pFnAS_ResetCooldownPowerIcons = (UFunction*) SdkBindings::Get ( 7419 );
 	if ( ! pFnAS_ResetCooldownPowerIcons )
-		pFnAS_ResetCooldownPowerIcons = (UFunction*) UObject::GObjObjects()->Data[ 124701 ];
+		return;
 
 	USFXGUI_CollectorHUDOverlay_execAS_ResetCooldownPowerIcons_Parms AS_ResetCooldownPowerIcons_Parms;
 
@@ -68,10 +66,9 @@ void USFXGUI_CollectorHUDOverlay::AS_ResetCooldownPowerIcons ( )
 
 bool USFXGUI_CollectorHUDOverlay::GetGlobalPosition ( class UGFxValue* val, float* X, float* Y )
 {
-	static UFunction* pFnGetGlobalPosition = NULL;
-
+	UFunction* pFnGetGlobalPosition = (UFunction*) SdkBindings::Get ( 7422 );
 	if ( ! pFnGetGlobalPosition )
-		pFnGetGlobalPosition = (UFunction*) UObject::GObjObjects()->Data[ 124718 ];
+		return {};
 
 	USFXGUI_CollectorHUDOverlay_execGetGlobalPosition_Parms GetGlobalPosition_Parms;
 	GetGlobalPosition_Parms.val = val;
@@ -93,10 +90,9 @@ bool USFXGUI_CollectorHUDOverlay::GetGlobalPosition ( class UGFxValue* val, floa
 
 void USFXGUI_CollectorHUDOverlay::PositionPowerIconOverlays ( )
 {
-	static UFunction* pFnPositionPowerIconOverlays = NULL;
-
+	UFunction* pFnPositionPowerIconOverlays = (UFunction*) SdkBindings::Get ( 7414 );
 	if ( ! pFnPositionPowerIconOverlays )
-		pFnPositionPowerIconOverlays = (UFunction*) UObject::GObjObjects()->Data[ 124692 ];
+		return;
 
 	USFXGUI_CollectorHUDOverlay_execPositionPowerIconOverlays_Parms PositionPowerIconOverlays_Parms;
 
@@ -113,10 +109,9 @@ void USFXGUI_CollectorHUDOverlay::PositionPowerIconOverlays ( )
 
 int USFXGUI_CollectorHUDOverlay::InitializePowerIconOverlay ( class USFXGUIValue_PowerIcon* oPowerIcon, float fScale, struct FVector2D* vOffset )
 {
-	static UFunction* pFnInitializePowerIconOverlay = NULL;
-
+	UFunction* pFnInitializePowerIconOverlay = (UFunction*) SdkBindings::Get ( 7420 );
 	if ( ! pFnInitializePowerIconOverlay )
-		pFnInitializePowerIconOverlay = (UFunction*) UObject::GObjObjects()->Data[ 124703 ];
+		return {};
 
 	USFXGUI_CollectorHUDOverlay_execInitializePowerIconOverlay_Parms InitializePowerIconOverlay_Parms;
 	InitializePowerIconOverlay_Parms.oPowerIcon = oPowerIcon;
@@ -136,10 +131,9 @@ int USFXGUI_CollectorHUDOverlay::InitializePowerIconOverlay ( class USFXGUIValue
 
 void USFXGUI_CollectorHUDOverlay::InitializeMPHUDPowerIconOverlays ( )
 {
-	static UFunction* pFnInitializeMPHUDPowerIconOverlays = NULL;
-
+	UFunction* pFnInitializeMPHUDPowerIconOverlays = (UFunction*) SdkBindings::Get ( 7413 );
 	if ( ! pFnInitializeMPHUDPowerIconOverlays )
-		pFnInitializeMPHUDPowerIconOverlays = (UFunction*) UObject::GObjObjects()->Data[ 124691 ];
+		return;
 
 	USFXGUI_CollectorHUDOverlay_execInitializeMPHUDPowerIconOverlays_Parms InitializeMPHUDPowerIconOverlays_Parms;
 
@@ -152,10 +146,9 @@ void USFXGUI_CollectorHUDOverlay::InitializeMPHUDPowerIconOverlays ( )
 
 void USFXGUI_CollectorHUDOverlay::InitializePCQuickslotIconOverlays ( )
 {
-	static UFunction* pFnInitializePCQuickslotIconOverlays = NULL;
-
+	UFunction* pFnInitializePCQuickslotIconOverlays = (UFunction*) SdkBindings::Get ( 7412 );
 	if ( ! pFnInitializePCQuickslotIconOverlays )
-		pFnInitializePCQuickslotIconOverlays = (UFunction*) UObject::GObjObjects()->Data[ 124690 ];
+		return;
 
 	USFXGUI_CollectorHUDOverlay_execInitializePCQuickslotIconOverlays_Parms InitializePCQuickslotIconOverlays_Parms;
 
@@ -168,10 +161,9 @@ void USFXGUI_CollectorHUDOverlay::InitializePCQuickslotIconOverlays ( )
 
 void USFXGUI_CollectorHUDOverlay::ClearSwarmOverlays ( )
 {
-	static UFunction* pFnClearSwarmOverlays = NULL;
-
+	UFunction* pFnClearSwarmOverlays = (UFunction*) SdkBindings::Get ( 7411 );
 	if ( ! pFnClearSwarmOverlays )
-		pFnClearSwarmOverlays = (UFunction*) UObject::GObjObjects()->Data[ 124689 ];
+		return;
 
 	USFXGUI_CollectorHUDOverlay_execClearSwarmOverlays_Parms ClearSwarmOverlays_Parms;
 
@@ -184,10 +176,9 @@ void USFXGUI_CollectorHUDOverlay::ClearSwarmOverlays ( )
 
 void USFXGUI_CollectorHUDOverlay::OnClose ( )
 {
-	static UFunction* pFnOnClose = NULL;
-
+	UFunction* pFnOnClose = (UFunction*) SdkBindings::Get ( 7418 );
 	if ( ! pFnOnClose )
-		pFnOnClose = (UFunction*) UObject::GObjObjects()->Data[ 124699 ];
+		return;
 
 	USFXGUI_CollectorHUDOverlay_execOnClose_Parms OnClose_Parms;
 
@@ -200,10 +191,9 @@ void USFXGUI_CollectorHUDOverlay::OnClose ( )
 
 void USFXGUI_CollectorHUDOverlay::UpdateCooldownOverride ( )
 {
-	static UFunction* pFnUpdateCooldownOverride = NULL;
-
+	UFunction* pFnUpdateCooldownOverride = (UFunction*) SdkBindings::Get ( 7416 );
 	if ( ! pFnUpdateCooldownOverride )
-		pFnUpdateCooldownOverride = (UFunction*) UObject::GObjObjects()->Data[ 124695 ];
+		return;
 
 	USFXGUI_CollectorHUDOverlay_execUpdateCooldownOverride_Parms UpdateCooldownOverride_Parms;
 
@@ -216,10 +206,9 @@ void USFXGUI_CollectorHUDOverlay::UpdateCooldownOverride ( )
 
 void USFXGUI_CollectorHUDOverlay::ResetForcedCooldown ( )
 {
-	static UFunction* pFnResetForcedCooldown = NULL;
-
+	UFunction* pFnResetForcedCooldown = (UFunction*) SdkBindings::Get ( 7417 );
 	if ( ! pFnResetForcedCooldown )
-		pFnResetForcedCooldown = (UFunction*) UObject::GObjObjects()->Data[ 124697 ];
+		return;
 
 	USFXGUI_CollectorHUDOverlay_execResetForcedCooldown_Parms ResetForcedCooldown_Parms;
 
@@ -232,10 +221,9 @@ void USFXGUI_CollectorHUDOverlay::ResetForcedCooldown ( )
 
 void USFXGUI_CollectorHUDOverlay::SetForcedCooldown ( )
 {
-	static UFunction* pFnSetForcedCooldown = NULL;
-
+	UFunction* pFnSetForcedCooldown = (UFunction*) SdkBindings::Get ( 7415 );
 	if ( ! pFnSetForcedCooldown )
-		pFnSetForcedCooldown = (UFunction*) UObject::GObjObjects()->Data[ 124693 ];
+		return;
 
 	USFXGUI_CollectorHUDOverlay_execSetForcedCooldown_Parms SetForcedCooldown_Parms;
 
@@ -248,10 +236,9 @@ void USFXGUI_CollectorHUDOverlay::SetForcedCooldown ( )
 
 void USFXGUI_CollectorHUDOverlay::CheckInitialize ( )
 {
-	static UFunction* pFnCheckInitialize = NULL;
-
+	UFunction* pFnCheckInitialize = (UFunction*) SdkBindings::Get ( 7410 );
 	if ( ! pFnCheckInitialize )
-		pFnCheckInitialize = (UFunction*) UObject::GObjObjects()->Data[ 124683 ];
+		return;
 
 	USFXGUI_CollectorHUDOverlay_execCheckInitialize_Parms CheckInitialize_Parms;
 
@@ -264,10 +251,9 @@ void USFXGUI_CollectorHUDOverlay::CheckInitialize ( )
 
 void USFXGUI_CollectorHUDOverlay::InternalOnStart ( )
 {
-	static UFunction* pFnInternalOnStart = NULL;
-
+	UFunction* pFnInternalOnStart = (UFunction*) SdkBindings::Get ( 7409 );
 	if ( ! pFnInternalOnStart )
-		pFnInternalOnStart = (UFunction*) UObject::GObjObjects()->Data[ 124682 ];
+		return;
 
 	USFXGUI_CollectorHUDOverlay_execInternalOnStart_Parms InternalOnStart_Parms;
 
@@ -280,10 +266,9 @@ void USFXGUI_CollectorHUDOverlay::InternalOnStart ( )
 
 void USFXGUI_CollectorHUDOverlay::eventOnStart ( )
 {
-	static UFunction* pFnOnStart = NULL;
-
+	UFunction* pFnOnStart = (UFunction*) SdkBindings::Get ( 7408 );
 	if ( ! pFnOnStart )
-		pFnOnStart = (UFunction*) UObject::GObjObjects()->Data[ 124681 ];
+		return;
 
 	USFXGUI_CollectorHUDOverlay_eventOnStart_Parms OnStart_Parms;
 
@@ -296,10 +281,9 @@ void USFXGUI_CollectorHUDOverlay::eventOnStart ( )
 
 void USFXWave_Horde_Cerberus2::StartAutoBots ( )
 {
-	static UFunction* pFnStartAutoBots = NULL;
-
+	UFunction* pFnStartAutoBots = (UFunction*) SdkBindings::Get ( 7298 );
 	if ( ! pFnStartAutoBots )
-		pFnStartAutoBots = (UFunction*) UObject::GObjObjects()->Data[ 113152 ];
+		return;
 
 	USFXWave_Horde_Cerberus2_execStartAutoBots_Parms StartAutoBots_Parms;
 
@@ -313,10 +297,9 @@ void USFXWave_Horde_Cerberus2::StartAutoBots ( )
 
 float USFXWave_Horde_Cerberus2::GetScoreBudget ( )
 {
-	static UFunction* pFnGetScoreBudget = NULL;
-
+	UFunction* pFnGetScoreBudget = (UFunction*) SdkBindings::Get ( 7323 );
 	if ( ! pFnGetScoreBudget )
-		pFnGetScoreBudget = (UFunction*) UObject::GObjObjects()->Data[ 113316 ];
+		return {};
 
 	USFXWave_Horde_Cerberus2_execGetScoreBudget_Parms GetScoreBudget_Parms;
 
@@ -332,10 +315,9 @@ float USFXWave_Horde_Cerberus2::GetScoreBudget ( )
 
 int USFXWave_Horde_Cerberus2::CalculateSpawnedEnemyCost ( )
 {
-	static UFunction* pFnCalculateSpawnedEnemyCost = NULL;
-
+	UFunction* pFnCalculateSpawnedEnemyCost = (UFunction*) SdkBindings::Get ( 7322 );
 	if ( ! pFnCalculateSpawnedEnemyCost )
-		pFnCalculateSpawnedEnemyCost = (UFunction*) UObject::GObjObjects()->Data[ 113312 ];
+		return {};
 
 	USFXWave_Horde_Cerberus2_execCalculateSpawnedEnemyCost_Parms CalculateSpawnedEnemyCost_Parms;
 
@@ -351,10 +333,9 @@ int USFXWave_Horde_Cerberus2::CalculateSpawnedEnemyCost ( )
 
 void USFXWave_Horde_Cerberus2::PawnRevived ( class ABioPawn* Pawn )
 {
-	static UFunction* pFnPawnRevived = NULL;
-
+	UFunction* pFnPawnRevived = (UFunction*) SdkBindings::Get ( 7321 );
 	if ( ! pFnPawnRevived )
-		pFnPawnRevived = (UFunction*) UObject::GObjObjects()->Data[ 113308 ];
+		return;
 
 	USFXWave_Horde_Cerberus2_execPawnRevived_Parms PawnRevived_Parms;
 	PawnRevived_Parms.Pawn = Pawn;
@@ -370,10 +351,9 @@ void USFXWave_Horde_Cerberus2::PawnRevived ( class ABioPawn* Pawn )
 
 struct FEnemySpawnInfo USFXWave_Horde_Cerberus2::GetEnemySpawnInfoForEnemyType ( struct FName EnemyType )
 {
-	static UFunction* pFnGetEnemySpawnInfoForEnemyType = NULL;
-
+	UFunction* pFnGetEnemySpawnInfoForEnemyType = (UFunction*) SdkBindings::Get ( 7297 );
 	if ( ! pFnGetEnemySpawnInfoForEnemyType )
-		pFnGetEnemySpawnInfoForEnemyType = (UFunction*) UObject::GObjObjects()->Data[ 113151 ];
+		return {};
 
 	USFXWave_Horde_Cerberus2_execGetEnemySpawnInfoForEnemyType_Parms GetEnemySpawnInfoForEnemyType_Parms;
 	memcpy ( &GetEnemySpawnInfoForEnemyType_Parms.EnemyType, &EnemyType, 0x8 );
@@ -389,10 +369,9 @@ struct FEnemySpawnInfo USFXWave_Horde_Cerberus2::GetEnemySpawnInfoForEnemyType (
 
 void USFXWave_Horde_Cerberus2::StopSpawningNewEnemies ( )
 {
-	static UFunction* pFnStopSpawningNewEnemies = NULL;
-
+	UFunction* pFnStopSpawningNewEnemies = (UFunction*) SdkBindings::Get ( 7320 );
 	if ( ! pFnStopSpawningNewEnemies )
-		pFnStopSpawningNewEnemies = (UFunction*) UObject::GObjObjects()->Data[ 113304 ];
+		return;
 
 	USFXWave_Horde_Cerberus2_execStopSpawningNewEnemies_Parms StopSpawningNewEnemies_Parms;
 
@@ -406,10 +385,9 @@ void USFXWave_Horde_Cerberus2::StopSpawningNewEnemies ( )
 
 void USFXWave_Horde_Cerberus2::SetEndlessWaves ( unsigned long Endless )
 {
-	static UFunction* pFnSetEndlessWaves = NULL;
-
+	UFunction* pFnSetEndlessWaves = (UFunction*) SdkBindings::Get ( 6220 );
 	if ( ! pFnSetEndlessWaves )
-		pFnSetEndlessWaves = (UFunction*) UObject::GObjObjects()->Data[ 108141 ];
+		return;
 
 	USFXWave_Horde_Cerberus2_execSetEndlessWaves_Parms SetEndlessWaves_Parms;
 	SetEndlessWaves_Parms.Endless = Endless;
@@ -424,10 +402,9 @@ void USFXWave_Horde_Cerberus2::SetEndlessWaves ( unsigned long Endless )
 
 bool USFXWave_Horde_Cerberus2::EnemyBudgetRemaining ( )
 {
-	static UFunction* pFnEnemyBudgetRemaining = NULL;
-
+	UFunction* pFnEnemyBudgetRemaining = (UFunction*) SdkBindings::Get ( 7310 );
 	if ( ! pFnEnemyBudgetRemaining )
-		pFnEnemyBudgetRemaining = (UFunction*) UObject::GObjObjects()->Data[ 113251 ];
+		return {};
 
 	USFXWave_Horde_Cerberus2_execEnemyBudgetRemaining_Parms EnemyBudgetRemaining_Parms;
 
@@ -444,10 +421,9 @@ bool USFXWave_Horde_Cerberus2::EnemyBudgetRemaining ( )
 
 int USFXWave_Horde_Cerberus2::GetCreatureWaveCost ( class APawn* P )
 {
-	static UFunction* pFnGetCreatureWaveCost = NULL;
-
+	UFunction* pFnGetCreatureWaveCost = (UFunction*) SdkBindings::Get ( 7319 );
 	if ( ! pFnGetCreatureWaveCost )
-		pFnGetCreatureWaveCost = (UFunction*) UObject::GObjObjects()->Data[ 113298 ];
+		return {};
 
 	USFXWave_Horde_Cerberus2_execGetCreatureWaveCost_Parms GetCreatureWaveCost_Parms;
 	GetCreatureWaveCost_Parms.P = P;
@@ -464,10 +440,9 @@ int USFXWave_Horde_Cerberus2::GetCreatureWaveCost ( class APawn* P )
 
 void USFXWave_Horde_Cerberus2::TriggerWaveEndEvent ( int Wave )
 {
-	static UFunction* pFnTriggerWaveEndEvent = NULL;
-
+	UFunction* pFnTriggerWaveEndEvent = (UFunction*) SdkBindings::Get ( 7318 );
 	if ( ! pFnTriggerWaveEndEvent )
-		pFnTriggerWaveEndEvent = (UFunction*) UObject::GObjObjects()->Data[ 113290 ];
+		return;
 
 	USFXWave_Horde_Cerberus2_execTriggerWaveEndEvent_Parms TriggerWaveEndEvent_Parms;
 	TriggerWaveEndEvent_Parms.Wave = Wave;
@@ -483,10 +458,9 @@ void USFXWave_Horde_Cerberus2::TriggerWaveEndEvent ( int Wave )
 
 void USFXWave_Horde_Cerberus2::TriggerEnemyKilledEvent ( class APawn* Killed, class APawn* Killer )
 {
-	static UFunction* pFnTriggerEnemyKilledEvent = NULL;
-
+	UFunction* pFnTriggerEnemyKilledEvent = (UFunction*) SdkBindings::Get ( 7317 );
 	if ( ! pFnTriggerEnemyKilledEvent )
-		pFnTriggerEnemyKilledEvent = (UFunction*) UObject::GObjObjects()->Data[ 113282 ];
+		return;
 
 	USFXWave_Horde_Cerberus2_execTriggerEnemyKilledEvent_Parms TriggerEnemyKilledEvent_Parms;
 	TriggerEnemyKilledEvent_Parms.Killed = Killed;
@@ -502,10 +476,9 @@ void USFXWave_Horde_Cerberus2::TriggerEnemyKilledEvent ( class APawn* Killed, cl
 
 void USFXWave_Horde_Cerberus2::TriggerWaveStartEvent ( int Wave )
 {
-	static UFunction* pFnTriggerWaveStartEvent = NULL;
-
+	UFunction* pFnTriggerWaveStartEvent = (UFunction*) SdkBindings::Get ( 7316 );
 	if ( ! pFnTriggerWaveStartEvent )
-		pFnTriggerWaveStartEvent = (UFunction*) UObject::GObjObjects()->Data[ 113274 ];
+		return;
 
 	USFXWave_Horde_Cerberus2_execTriggerWaveStartEvent_Parms TriggerWaveStartEvent_Parms;
 	TriggerWaveStartEvent_Parms.Wave = Wave;
@@ -520,10 +493,9 @@ void USFXWave_Horde_Cerberus2::TriggerWaveStartEvent ( int Wave )
 
 bool USFXWave_Horde_Cerberus2::ShouldSpawnSquad ( )
 {
-	static UFunction* pFnShouldSpawnSquad = NULL;
-
+	UFunction* pFnShouldSpawnSquad = (UFunction*) SdkBindings::Get ( 7311 );
 	if ( ! pFnShouldSpawnSquad )
-		pFnShouldSpawnSquad = (UFunction*) UObject::GObjObjects()->Data[ 113253 ];
+		return {};
 
 	USFXWave_Horde_Cerberus2_execShouldSpawnSquad_Parms ShouldSpawnSquad_Parms;
 
@@ -539,10 +511,9 @@ bool USFXWave_Horde_Cerberus2::ShouldSpawnSquad ( )
 
 int USFXWave_Horde_Cerberus2::GetPlayerCount ( )
 {
-	static UFunction* pFnGetPlayerCount = NULL;
-
+	UFunction* pFnGetPlayerCount = (UFunction*) SdkBindings::Get ( 7315 );
 	if ( ! pFnGetPlayerCount )
-		pFnGetPlayerCount = (UFunction*) UObject::GObjObjects()->Data[ 113267 ];
+		return {};
 
 	USFXWave_Horde_Cerberus2_execGetPlayerCount_Parms GetPlayerCount_Parms;
 
@@ -559,10 +530,9 @@ int USFXWave_Horde_Cerberus2::GetPlayerCount ( )
 
 void USFXWave_Horde_Cerberus2::PawnDied ( class ABioPawn* Pawn, class ABioPawn* Killer )
 {
-	static UFunction* pFnPawnDied = NULL;
-
+	UFunction* pFnPawnDied = (UFunction*) SdkBindings::Get ( 7314 );
 	if ( ! pFnPawnDied )
-		pFnPawnDied = (UFunction*) UObject::GObjObjects()->Data[ 113261 ];
+		return;
 
 	USFXWave_Horde_Cerberus2_execPawnDied_Parms PawnDied_Parms;
 	PawnDied_Parms.Pawn = Pawn;
@@ -577,10 +547,9 @@ void USFXWave_Horde_Cerberus2::PawnDied ( class ABioPawn* Pawn, class ABioPawn*
 
 void USFXWave_Horde_Cerberus2::ActivateEnemyObjectiveMarkers ( )
 {
-	static UFunction* pFnActivateEnemyObjectiveMarkers = NULL;
-
+	UFunction* pFnActivateEnemyObjectiveMarkers = (UFunction*) SdkBindings::Get ( 7313 );
 	if ( ! pFnActivateEnemyObjectiveMarkers )
-		pFnActivateEnemyObjectiveMarkers = (UFunction*) UObject::GObjObjects()->Data[ 113258 ];
+		return;
 
 	USFXWave_Horde_Cerberus2_execActivateEnemyObjectiveMarkers_Parms ActivateEnemyObjectiveMarkers_Parms;
 
@@ -593,10 +562,9 @@ void USFXWave_Horde_Cerberus2::ActivateEnemyObjectiveMarkers ( )
 
 void USFXWave_Horde_Cerberus2::UpdateObjectiveStatus ( )
 {
-	static UFunction* pFnUpdateObjectiveStatus = NULL;
-
+	UFunction* pFnUpdateObjectiveStatus = (UFunction*) SdkBindings::Get ( 7312 );
 	if ( ! pFnUpdateObjectiveStatus )
-		pFnUpdateObjectiveStatus = (UFunction*) UObject::GObjObjects()->Data[ 113254 ];
+		return;
 
 	USFXWave_Horde_Cerberus2_execUpdateObjectiveStatus_Parms UpdateObjectiveStatus_Parms;
 
@@ -609,10 +577,9 @@ void USFXWave_Horde_Cerberus2::UpdateObjectiveStatus ( )
 
 void USFXWave_Horde_Cerberus2::SpawnHorde ( )
 {
-	static UFunction* pFnSpawnHorde = NULL;
-
+	UFunction* pFnSpawnHorde = (UFunction*) SdkBindings::Get ( 7309 );
 	if ( ! pFnSpawnHorde )
-		pFnSpawnHorde = (UFunction*) UObject::GObjObjects()->Data[ 113249 ];
+		return;
 
 	USFXWave_Horde_Cerberus2_execSpawnHorde_Parms SpawnHorde_Parms;
 
@@ -626,10 +593,9 @@ void USFXWave_Horde_Cerberus2::SpawnHorde ( )
 
 void USFXWave_Horde_Cerberus2::SpawnEnemy ( int Index )
 {
-	static UFunction* pFnSpawnEnemy = NULL;
-
+	UFunction* pFnSpawnEnemy = (UFunction*) SdkBindings::Get ( 7308 );
 	if ( ! pFnSpawnEnemy )
-		pFnSpawnEnemy = (UFunction*) UObject::GObjObjects()->Data[ 113242 ];
+		return;
 
 	USFXWave_Horde_Cerberus2_execSpawnEnemy_Parms SpawnEnemy_Parms;
 	SpawnEnemy_Parms.Index = Index;
@@ -644,10 +610,9 @@ void USFXWave_Horde_Cerberus2::SpawnEnemy ( int Index )
 
 bool USFXWave_Horde_Cerberus2::AreRemainingEnemiesOnMyTeam ( )
 {
-	static UFunction* pFnAreRemainingEnemiesOnMyTeam = NULL;
-
+	UFunction* pFnAreRemainingEnemiesOnMyTeam = (UFunction*) SdkBindings::Get ( 7307 );
 	if ( ! pFnAreRemainingEnemiesOnMyTeam )
-		pFnAreRemainingEnemiesOnMyTeam = (UFunction*) UObject::GObjObjects()->Data[ 113239 ];
+		return {};
 
 	USFXWave_Horde_Cerberus2_execAreRemainingEnemiesOnMyTeam_Parms AreRemainingEnemiesOnMyTeam_Parms;
 
@@ -663,10 +628,9 @@ bool USFXWave_Horde_Cerberus2::AreRemainingEnemiesOnMyTeam ( )
 
 int USFXWave_Horde_Cerberus2::ChooseEnemyToSpawn ( )
 {
-	static UFunction* pFnChooseEnemyToSpawn = NULL;
-
+	UFunction* pFnChooseEnemyToSpawn = (UFunction*) SdkBindings::Get ( 7306 );
 	if ( ! pFnChooseEnemyToSpawn )
-		pFnChooseEnemyToSpawn = (UFunction*) UObject::GObjObjects()->Data[ 113228 ];
+		return {};
 
 	USFXWave_Horde_Cerberus2_execChooseEnemyToSpawn_Parms ChooseEnemyToSpawn_Parms;
 
@@ -682,10 +646,9 @@ int USFXWave_Horde_Cerberus2::ChooseEnemyToSpawn ( )
 
 bool USFXWave_Horde_Cerberus2::ChooseSquadToSpawn ( )
 {
-	static UFunction* pFnChooseSquadToSpawn = NULL;
-
+	UFunction* pFnChooseSquadToSpawn = (UFunction*) SdkBindings::Get ( 7305 );
 	if ( ! pFnChooseSquadToSpawn )
-		pFnChooseSquadToSpawn = (UFunction*) UObject::GObjObjects()->Data[ 113223 ];
+		return {};
 
 	USFXWave_Horde_Cerberus2_execChooseSquadToSpawn_Parms ChooseSquadToSpawn_Parms;
 
@@ -705,10 +668,9 @@ bool USFXWave_Horde_Cerberus2::ChooseSquadToSpawn ( )
 
 bool USFXWave_Horde_Cerberus2::CanEnemyUseSpawnPoint ( class UClass* EnemyClass, float EnemyRadius, float EnemyHeight, class ANavigationPoint* NavPoint )
 {
-	static UFunction* pFnCanEnemyUseSpawnPoint = NULL;
-
+	UFunction* pFnCanEnemyUseSpawnPoint = (UFunction*) SdkBindings::Get ( 7304 );
 	if ( ! pFnCanEnemyUseSpawnPoint )
-		pFnCanEnemyUseSpawnPoint = (UFunction*) UObject::GObjObjects()->Data[ 113203 ];
+		return {};
 
 	USFXWave_Horde_Cerberus2_execCanEnemyUseSpawnPoint_Parms CanEnemyUseSpawnPoint_Parms;
 	CanEnemyUseSpawnPoint_Parms.EnemyClass = EnemyClass;
@@ -733,10 +695,9 @@ bool USFXWave_Horde_Cerberus2::CanEnemyUseSpawnPoint ( class UClass* EnemyClass,
 
 float USFXWave_Horde_Cerberus2::RateEnemyStart ( class ANavigationPoint* NavPoint, float EnemyRadius, float EnemyHeight, class UClass* EnemyClass, unsigned long bDoTraceCheck )
 {
-	static UFunction* pFnRateEnemyStart = NULL;
-
+	UFunction* pFnRateEnemyStart = (UFunction*) SdkBindings::Get ( 7303 );
 	if ( ! pFnRateEnemyStart )
-		pFnRateEnemyStart = (UFunction*) UObject::GObjObjects()->Data[ 113186 ];
+		return {};
 
 	USFXWave_Horde_Cerberus2_execRateEnemyStart_Parms RateEnemyStart_Parms;
 	RateEnemyStart_Parms.NavPoint = NavPoint;
@@ -758,10 +719,9 @@ float USFXWave_Horde_Cerberus2::RateEnemyStart ( class ANavigationPoint* NavPoin
 
 class ANavigationPoint* USFXWave_Horde_Cerberus2::ChooseEnemyStart ( class UClass* EnemyClass )
 {
-	static UFunction* pFnChooseEnemyStart = NULL;
-
+	UFunction* pFnChooseEnemyStart = (UFunction*) SdkBindings::Get ( 7302 );
 	if ( ! pFnChooseEnemyStart )
-		pFnChooseEnemyStart = (UFunction*) UObject::GObjObjects()->Data[ 113171 ];
+		return {};
 
 	USFXWave_Horde_Cerberus2_execChooseEnemyStart_Parms ChooseEnemyStart_Parms;
 	ChooseEnemyStart_Parms.EnemyClass = EnemyClass;
@@ -777,10 +737,9 @@ class ANavigationPoint* USFXWave_Horde_Cerberus2::ChooseEnemyStart ( class UClas
 
 void USFXWave_Horde_Cerberus2::FinishWave ( )
 {
-	static UFunction* pFnFinishWave = NULL;
-
+	UFunction* pFnFinishWave = (UFunction*) SdkBindings::Get ( 7301 );
 	if ( ! pFnFinishWave )
-		pFnFinishWave = (UFunction*) UObject::GObjObjects()->Data[ 113168 ];
+		return;
 
 	USFXWave_Horde_Cerberus2_execFinishWave_Parms FinishWave_Parms;
 
@@ -794,10 +753,9 @@ void USFXWave_Horde_Cerberus2::FinishWave ( )
 
 bool USFXWave_Horde_Cerberus2::BeginWave ( )
 {
-	static UFunction* pFnBeginWave = NULL;
-
+	UFunction* pFnBeginWave = (UFunction*) SdkBindings::Get ( 7300 );
 	if ( ! pFnBeginWave )
-		pFnBeginWave = (UFunction*) UObject::GObjObjects()->Data[ 113159 ];
+		return {};
 
 	USFXWave_Horde_Cerberus2_execBeginWave_Parms BeginWave_Parms;
 
@@ -813,10 +771,9 @@ bool USFXWave_Horde_Cerberus2::BeginWave ( )
 
 void USFXWave_Horde_Cerberus2::GetEnemyArray ( TArray< struct FEnemyWaveInfo >* EnemyArray )
 {
-	static UFunction* pFnGetEnemyArray = NULL;
-
+	UFunction* pFnGetEnemyArray = (UFunction*) SdkBindings::Get ( 7299 );
 	if ( ! pFnGetEnemyArray )
-		pFnGetEnemyArray = (UFunction*) UObject::GObjObjects()->Data[ 113153 ];
+		return;
 
 	USFXWave_Horde_Cerberus2_execGetEnemyArray_Parms GetEnemyArray_Parms;
 
@@ -833,10 +790,9 @@ void USFXWave_Horde_Cerberus2::GetEnemyArray ( TArray< struct FEnemyWaveInfo >*
 
 void USFXWave_Horde_Cerberus2::InitializeWave ( class ASFXWaveManager* OwnerManager )
 {
-	static UFunction* pFnInitializeWave = NULL;
-
+	UFunction* pFnInitializeWave = (UFunction*) SdkBindings::Get ( 7296 );
 	if ( ! pFnInitializeWave )
-		pFnInitializeWave = (UFunction*) UObject::GObjObjects()->Data[ 113141 ];
+		return;
 
 	USFXWave_Horde_Cerberus2_execInitializeWave_Parms InitializeWave_Parms;
 	InitializeWave_Parms.OwnerManager = OwnerManager;
@@ -850,10 +806,9 @@ void USFXWave_Horde_Cerberus2::InitializeWave ( class ASFXWaveManager* OwnerMana
 
 void USFXWave_Horde_Collector::StartAutoBots ( )
 {
-	static UFunction* pFnStartAutoBots = NULL;
-
+	UFunction* pFnStartAutoBots = (UFunction*) SdkBindings::Get ( 7298 );
 	if ( ! pFnStartAutoBots )
-		pFnStartAutoBots = (UFunction*) UObject::GObjObjects()->Data[ 113152 ];
+		return;
 
 	USFXWave_Horde_Collector_execStartAutoBots_Parms StartAutoBots_Parms;
 
@@ -867,10 +822,9 @@ void USFXWave_Horde_Collector::StartAutoBots ( )
 
 float USFXWave_Horde_Collector::GetScoreBudget ( )
 {
-	static UFunction* pFnGetScoreBudget = NULL;
-
+	UFunction* pFnGetScoreBudget = (UFunction*) SdkBindings::Get ( 7323 );
 	if ( ! pFnGetScoreBudget )
-		pFnGetScoreBudget = (UFunction*) UObject::GObjObjects()->Data[ 113316 ];
+		return {};
 
 	USFXWave_Horde_Collector_execGetScoreBudget_Parms GetScoreBudget_Parms;
 
@@ -886,10 +840,9 @@ float USFXWave_Horde_Collector::GetScoreBudget ( )
 
 int USFXWave_Horde_Collector::CalculateSpawnedEnemyCost ( )
 {
-	static UFunction* pFnCalculateSpawnedEnemyCost = NULL;
-
+	UFunction* pFnCalculateSpawnedEnemyCost = (UFunction*) SdkBindings::Get ( 7322 );
 	if ( ! pFnCalculateSpawnedEnemyCost )
-		pFnCalculateSpawnedEnemyCost = (UFunction*) UObject::GObjObjects()->Data[ 113312 ];
+		return {};
 
 	USFXWave_Horde_Collector_execCalculateSpawnedEnemyCost_Parms CalculateSpawnedEnemyCost_Parms;
 
@@ -905,10 +858,9 @@ int USFXWave_Horde_Collector::CalculateSpawnedEnemyCost ( )
 
 void USFXWave_Horde_Collector::PawnRevived ( class ABioPawn* Pawn )
 {
-	static UFunction* pFnPawnRevived = NULL;
-
+	UFunction* pFnPawnRevived = (UFunction*) SdkBindings::Get ( 7321 );
 	if ( ! pFnPawnRevived )
-		pFnPawnRevived = (UFunction*) UObject::GObjObjects()->Data[ 113308 ];
+		return;
 
 	USFXWave_Horde_Collector_execPawnRevived_Parms PawnRevived_Parms;
 	PawnRevived_Parms.Pawn = Pawn;
@@ -924,10 +876,9 @@ void USFXWave_Horde_Collector::PawnRevived ( class ABioPawn* Pawn )
 
 struct FEnemySpawnInfo USFXWave_Horde_Collector::GetEnemySpawnInfoForEnemyType ( struct FName EnemyType )
 {
-	static UFunction* pFnGetEnemySpawnInfoForEnemyType = NULL;
-
+	UFunction* pFnGetEnemySpawnInfoForEnemyType = (UFunction*) SdkBindings::Get ( 7297 );
 	if ( ! pFnGetEnemySpawnInfoForEnemyType )
-		pFnGetEnemySpawnInfoForEnemyType = (UFunction*) UObject::GObjObjects()->Data[ 113151 ];
+		return {};
 
 	USFXWave_Horde_Collector_execGetEnemySpawnInfoForEnemyType_Parms GetEnemySpawnInfoForEnemyType_Parms;
 	memcpy ( &GetEnemySpawnInfoForEnemyType_Parms.EnemyType, &EnemyType, 0x8 );
@@ -943,10 +894,9 @@ struct FEnemySpawnInfo USFXWave_Horde_Collector::GetEnemySpawnInfoForEnemyType (
 
 void USFXWave_Horde_Collector::StopSpawningNewEnemies ( )
 {
-	static UFunction* pFnStopSpawningNewEnemies = NULL;
-
+	UFunction* pFnStopSpawningNewEnemies = (UFunction*) SdkBindings::Get ( 7320 );
 	if ( ! pFnStopSpawningNewEnemies )
-		pFnStopSpawningNewEnemies = (UFunction*) UObject::GObjObjects()->Data[ 113304 ];
+		return;
 
 	USFXWave_Horde_Collector_execStopSpawningNewEnemies_Parms StopSpawningNewEnemies_Parms;
 
@@ -960,10 +910,9 @@ void USFXWave_Horde_Collector::StopSpawningNewEnemies ( )
 
 void USFXWave_Horde_Collector::SetEndlessWaves ( unsigned long Endless )
 {
-	static UFunction* pFnSetEndlessWaves = NULL;
-
+	UFunction* pFnSetEndlessWaves = (UFunction*) SdkBindings::Get ( 6220 );
 	if ( ! pFnSetEndlessWaves )
-		pFnSetEndlessWaves = (UFunction*) UObject::GObjObjects()->Data[ 108141 ];
+		return;
 
 	USFXWave_Horde_Collector_execSetEndlessWaves_Parms SetEndlessWaves_Parms;
 	SetEndlessWaves_Parms.Endless = Endless;
@@ -978,10 +927,9 @@ void USFXWave_Horde_Collector::SetEndlessWaves ( unsigned long Endless )
 
 bool USFXWave_Horde_Collector::EnemyBudgetRemaining ( )
 {
-	static UFunction* pFnEnemyBudgetRemaining = NULL;
-
+	UFunction* pFnEnemyBudgetRemaining = (UFunction*) SdkBindings::Get ( 7310 );
 	if ( ! pFnEnemyBudgetRemaining )
-		pFnEnemyBudgetRemaining = (UFunction*) UObject::GObjObjects()->Data[ 113251 ];
+		return {};
 
 	USFXWave_Horde_Collector_execEnemyBudgetRemaining_Parms EnemyBudgetRemaining_Parms;
 
@@ -998,10 +946,9 @@ bool USFXWave_Horde_Collector::EnemyBudgetRemaining ( )
 
 int USFXWave_Horde_Collector::GetCreatureWaveCost ( class APawn* P )
 {
-	static UFunction* pFnGetCreatureWaveCost = NULL;
-
+	UFunction* pFnGetCreatureWaveCost = (UFunction*) SdkBindings::Get ( 7319 );
 	if ( ! pFnGetCreatureWaveCost )
-		pFnGetCreatureWaveCost = (UFunction*) UObject::GObjObjects()->Data[ 113298 ];
+		return {};
 
 	USFXWave_Horde_Collector_execGetCreatureWaveCost_Parms GetCreatureWaveCost_Parms;
 	GetCreatureWaveCost_Parms.P = P;
@@ -1018,10 +965,9 @@ int USFXWave_Horde_Collector::GetCreatureWaveCost ( class APawn* P )
 
 void USFXWave_Horde_Collector::TriggerWaveEndEvent ( int Wave )
 {
-	static UFunction* pFnTriggerWaveEndEvent = NULL;
-
+	UFunction* pFnTriggerWaveEndEvent = (UFunction*) SdkBindings::Get ( 7318 );
 	if ( ! pFnTriggerWaveEndEvent )
-		pFnTriggerWaveEndEvent = (UFunction*) UObject::GObjObjects()->Data[ 113290 ];
+		return;
 
 	USFXWave_Horde_Collector_execTriggerWaveEndEvent_Parms TriggerWaveEndEvent_Parms;
 	TriggerWaveEndEvent_Parms.Wave = Wave;
@@ -1037,10 +983,9 @@ void USFXWave_Horde_Collector::TriggerWaveEndEvent ( int Wave )
 
 void USFXWave_Horde_Collector::TriggerEnemyKilledEvent ( class APawn* Killed, class APawn* Killer )
 {
-	static UFunction* pFnTriggerEnemyKilledEvent = NULL;
-
+	UFunction* pFnTriggerEnemyKilledEvent = (UFunction*) SdkBindings::Get ( 7317 );
 	if ( ! pFnTriggerEnemyKilledEvent )
-		pFnTriggerEnemyKilledEvent = (UFunction*) UObject::GObjObjects()->Data[ 113282 ];
+		return;
 
 	USFXWave_Horde_Collector_execTriggerEnemyKilledEvent_Parms TriggerEnemyKilledEvent_Parms;
 	TriggerEnemyKilledEvent_Parms.Killed = Killed;
@@ -1056,10 +1001,9 @@ void USFXWave_Horde_Collector::TriggerEnemyKilledEvent ( class APawn* Killed, cl
 
 void USFXWave_Horde_Collector::TriggerWaveStartEvent ( int Wave )
 {
-	static UFunction* pFnTriggerWaveStartEvent = NULL;
-
+	UFunction* pFnTriggerWaveStartEvent = (UFunction*) SdkBindings::Get ( 7316 );
 	if ( ! pFnTriggerWaveStartEvent )
-		pFnTriggerWaveStartEvent = (UFunction*) UObject::GObjObjects()->Data[ 113274 ];
+		return;
 
 	USFXWave_Horde_Collector_execTriggerWaveStartEvent_Parms TriggerWaveStartEvent_Parms;
 	TriggerWaveStartEvent_Parms.Wave = Wave;
@@ -1074,10 +1018,9 @@ void USFXWave_Horde_Collector::TriggerWaveStartEvent ( int Wave )
 
 bool USFXWave_Horde_Collector::ShouldSpawnSquad ( )
 {
-	static UFunction* pFnShouldSpawnSquad = NULL;
-
+	UFunction* pFnShouldSpawnSquad = (UFunction*) SdkBindings::Get ( 7311 );
 	if ( ! pFnShouldSpawnSquad )
-		pFnShouldSpawnSquad = (UFunction*) UObject::GObjObjects()->Data[ 113253 ];
+		return {};
 
 	USFXWave_Horde_Collector_execShouldSpawnSquad_Parms ShouldSpawnSquad_Parms;
 
@@ -1093,10 +1036,9 @@ bool USFXWave_Horde_Collector::ShouldSpawnSquad ( )
 
 int USFXWave_Horde_Collector::GetPlayerCount ( )
 {
-	static UFunction* pFnGetPlayerCount = NULL;
-
+	UFunction* pFnGetPlayerCount = (UFunction*) SdkBindings::Get ( 7315 );
 	if ( ! pFnGetPlayerCount )
-		pFnGetPlayerCount = (UFunction*) UObject::GObjObjects()->Data[ 113267 ];
+		return {};
 
 	USFXWave_Horde_Collector_execGetPlayerCount_Parms GetPlayerCount_Parms;
 
@@ -1113,10 +1055,9 @@ int USFXWave_Horde_Collector::GetPlayerCount ( )
 
 void USFXWave_Horde_Collector::PawnDied ( class ABioPawn* Pawn, class ABioPawn* Killer )
 {
-	static UFunction* pFnPawnDied = NULL;
-
+	UFunction* pFnPawnDied = (UFunction*) SdkBindings::Get ( 7314 );
 	if ( ! pFnPawnDied )
-		pFnPawnDied = (UFunction*) UObject::GObjObjects()->Data[ 113261 ];
+		return;
 
 	USFXWave_Horde_Collector_execPawnDied_Parms PawnDied_Parms;
 	PawnDied_Parms.Pawn = Pawn;
@@ -1131,10 +1072,9 @@ void USFXWave_Horde_Collector::PawnDied ( class ABioPawn* Pawn, class ABioPawn*
 
 void USFXWave_Horde_Collector::ActivateEnemyObjectiveMarkers ( )
 {
-	static UFunction* pFnActivateEnemyObjectiveMarkers = NULL;
-
+	UFunction* pFnActivateEnemyObjectiveMarkers = (UFunction*) SdkBindings::Get ( 7313 );
 	if ( ! pFnActivateEnemyObjectiveMarkers )
-		pFnActivateEnemyObjectiveMarkers = (UFunction*) UObject::GObjObjects()->Data[ 113258 ];
+		return;
 
 	USFXWave_Horde_Collector_execActivateEnemyObjectiveMarkers_Parms ActivateEnemyObjectiveMarkers_Parms;
 
@@ -1147,10 +1087,9 @@ void USFXWave_Horde_Collector::ActivateEnemyObjectiveMarkers ( )
 
 void USFXWave_Horde_Collector::UpdateObjectiveStatus ( )
 {
-	static UFunction* pFnUpdateObjectiveStatus = NULL;
-
+	UFunction* pFnUpdateObjectiveStatus = (UFunction*) SdkBindings::Get ( 7312 );
 	if ( ! pFnUpdateObjectiveStatus )
-		pFnUpdateObjectiveStatus = (UFunction*) UObject::GObjObjects()->Data[ 113254 ];
+		return;
 
 	USFXWave_Horde_Collector_execUpdateObjectiveStatus_Parms UpdateObjectiveStatus_Parms;
 
@@ -1163,10 +1102,9 @@ void USFXWave_Horde_Collector::UpdateObjectiveStatus ( )
 
 void USFXWave_Horde_Collector::SpawnHorde ( )
 {
-	static UFunction* pFnSpawnHorde = NULL;
-
+	UFunction* pFnSpawnHorde = (UFunction*) SdkBindings::Get ( 7309 );
 	if ( ! pFnSpawnHorde )
-		pFnSpawnHorde = (UFunction*) UObject::GObjObjects()->Data[ 113249 ];
+		return;
 
 	USFXWave_Horde_Collector_execSpawnHorde_Parms SpawnHorde_Parms;
 
@@ -1180,10 +1118,9 @@ void USFXWave_Horde_Collector::SpawnHorde ( )
 
 void USFXWave_Horde_Collector::SpawnEnemy ( int Index )
 {
-	static UFunction* pFnSpawnEnemy = NULL;
-
+	UFunction* pFnSpawnEnemy = (UFunction*) SdkBindings::Get ( 7308 );
 	if ( ! pFnSpawnEnemy )
-		pFnSpawnEnemy = (UFunction*) UObject::GObjObjects()->Data[ 113242 ];
+		return;
 
 	USFXWave_Horde_Collector_execSpawnEnemy_Parms SpawnEnemy_Parms;
 	SpawnEnemy_Parms.Index = Index;
@@ -1198,10 +1135,9 @@ void USFXWave_Horde_Collector::SpawnEnemy ( int Index )
 
 bool USFXWave_Horde_Collector::AreRemainingEnemiesOnMyTeam ( )
 {
-	static UFunction* pFnAreRemainingEnemiesOnMyTeam = NULL;
-
+	UFunction* pFnAreRemainingEnemiesOnMyTeam = (UFunction*) SdkBindings::Get ( 7307 );
 	if ( ! pFnAreRemainingEnemiesOnMyTeam )
-		pFnAreRemainingEnemiesOnMyTeam = (UFunction*) UObject::GObjObjects()->Data[ 113239 ];
+		return {};
 
 	USFXWave_Horde_Collector_execAreRemainingEnemiesOnMyTeam_Parms AreRemainingEnemiesOnMyTeam_Parms;
 
@@ -1217,10 +1153,9 @@ bool USFXWave_Horde_Collector::AreRemainingEnemiesOnMyTeam ( )
 
 int USFXWave_Horde_Collector::ChooseEnemyToSpawn ( )
 {
-	static UFunction* pFnChooseEnemyToSpawn = NULL;
-
+	UFunction* pFnChooseEnemyToSpawn = (UFunction*) SdkBindings::Get ( 7306 );
 	if ( ! pFnChooseEnemyToSpawn )
-		pFnChooseEnemyToSpawn = (UFunction*) UObject::GObjObjects()->Data[ 113228 ];
+		return {};
 
 	USFXWave_Horde_Collector_execChooseEnemyToSpawn_Parms ChooseEnemyToSpawn_Parms;
 
@@ -1236,10 +1171,9 @@ int USFXWave_Horde_Collector::ChooseEnemyToSpawn ( )
 
 bool USFXWave_Horde_Collector::ChooseSquadToSpawn ( )
 {
-	static UFunction* pFnChooseSquadToSpawn = NULL;
-
+	UFunction* pFnChooseSquadToSpawn = (UFunction*) SdkBindings::Get ( 7305 );
 	if ( ! pFnChooseSquadToSpawn )
-		pFnChooseSquadToSpawn = (UFunction*) UObject::GObjObjects()->Data[ 113223 ];
+		return {};
 
 	USFXWave_Horde_Collector_execChooseSquadToSpawn_Parms ChooseSquadToSpawn_Parms;
 
@@ -1259,10 +1193,9 @@ bool USFXWave_Horde_Collector::ChooseSquadToSpawn ( )
 
 bool USFXWave_Horde_Collector::CanEnemyUseSpawnPoint ( class UClass* EnemyClass, float EnemyRadius, float EnemyHeight, class ANavigationPoint* NavPoint )
 {
-	static UFunction* pFnCanEnemyUseSpawnPoint = NULL;
-
+	UFunction* pFnCanEnemyUseSpawnPoint = (UFunction*) SdkBindings::Get ( 7304 );
 	if ( ! pFnCanEnemyUseSpawnPoint )
-		pFnCanEnemyUseSpawnPoint = (UFunction*) UObject::GObjObjects()->Data[ 113203 ];
+		return {};
 
 	USFXWave_Horde_Collector_execCanEnemyUseSpawnPoint_Parms CanEnemyUseSpawnPoint_Parms;
 	CanEnemyUseSpawnPoint_Parms.EnemyClass = EnemyClass;
@@ -1287,10 +1220,9 @@ bool USFXWave_Horde_Collector::CanEnemyUseSpawnPoint ( class UClass* EnemyClass,
 
 float USFXWave_Horde_Collector::RateEnemyStart ( class ANavigationPoint* NavPoint, float EnemyRadius, float EnemyHeight, class UClass* EnemyClass, unsigned long bDoTraceCheck )
 {
-	static UFunction* pFnRateEnemyStart = NULL;
-
+	UFunction* pFnRateEnemyStart = (UFunction*) SdkBindings::Get ( 7303 );
 	if ( ! pFnRateEnemyStart )
-		pFnRateEnemyStart = (UFunction*) UObject::GObjObjects()->Data[ 113186 ];
+		return {};
 
 	USFXWave_Horde_Collector_execRateEnemyStart_Parms RateEnemyStart_Parms;
 	RateEnemyStart_Parms.NavPoint = NavPoint;
@@ -1312,10 +1244,9 @@ float USFXWave_Horde_Collector::RateEnemyStart ( class ANavigationPoint* NavPoin
 
 class ANavigationPoint* USFXWave_Horde_Collector::ChooseEnemyStart ( class UClass* EnemyClass )
 {
-	static UFunction* pFnChooseEnemyStart = NULL;
-
+	UFunction* pFnChooseEnemyStart = (UFunction*) SdkBindings::Get ( 7302 );
 	if ( ! pFnChooseEnemyStart )
-		pFnChooseEnemyStart = (UFunction*) UObject::GObjObjects()->Data[ 113171 ];
+		return {};
 
 	USFXWave_Horde_Collector_execChooseEnemyStart_Parms ChooseEnemyStart_Parms;
 	ChooseEnemyStart_Parms.EnemyClass = EnemyClass;
@@ -1331,10 +1262,9 @@ class ANavigationPoint* USFXWave_Horde_Collector::ChooseEnemyStart ( class UClas
 
 void USFXWave_Horde_Collector::FinishWave ( )
 {
-	static UFunction* pFnFinishWave = NULL;
-
+	UFunction* pFnFinishWave = (UFunction*) SdkBindings::Get ( 7301 );
 	if ( ! pFnFinishWave )
-		pFnFinishWave = (UFunction*) UObject::GObjObjects()->Data[ 113168 ];
+		return;
 
 	USFXWave_Horde_Collector_execFinishWave_Parms FinishWave_Parms;
 
@@ -1348,10 +1278,9 @@ void USFXWave_Horde_Collector::FinishWave ( )
 
 bool USFXWave_Horde_Collector::BeginWave ( )
 {
-	static UFunction* pFnBeginWave = NULL;
-
+	UFunction* pFnBeginWave = (UFunction*) SdkBindings::Get ( 7300 );
 	if ( ! pFnBeginWave )
-		pFnBeginWave = (UFunction*) UObject::GObjObjects()->Data[ 113159 ];
+		return {};
 
 	USFXWave_Horde_Collector_execBeginWave_Parms BeginWave_Parms;
 
@@ -1367,10 +1296,9 @@ bool USFXWave_Horde_Collector::BeginWave ( )
 
 void USFXWave_Horde_Collector::GetEnemyArray ( TArray< struct FEnemyWaveInfo >* EnemyArray )
 {
-	static UFunction* pFnGetEnemyArray = NULL;
-
+	UFunction* pFnGetEnemyArray = (UFunction*) SdkBindings::Get ( 7299 );
 	if ( ! pFnGetEnemyArray )
-		pFnGetEnemyArray = (UFunction*) UObject::GObjObjects()->Data[ 113153 ];
+		return;
 
 	USFXWave_Horde_Collector_execGetEnemyArray_Parms GetEnemyArray_Parms;
 
@@ -1387,10 +1315,9 @@ void USFXWave_Horde_Collector::GetEnemyArray ( TArray< struct FEnemyWaveInfo >*
 
 void USFXWave_Horde_Collector::InitializeWave ( class ASFXWaveManager* OwnerManager )
 {
-	static UFunction* pFnInitializeWave = NULL;
-
+	UFunction* pFnInitializeWave = (UFunction*) SdkBindings::Get ( 7296 );
 	if ( ! pFnInitializeWave )
-		pFnInitializeWave = (UFunction*) UObject::GObjObjects()->Data[ 113141 ];
+		return;
 
 	USFXWave_Horde_Collector_execInitializeWave_Parms InitializeWave_Parms;
 	InitializeWave_Parms.OwnerManager = OwnerManager;
@@ -1404,10 +1331,9 @@ void USFXWave_Horde_Collector::InitializeWave ( class ASFXWaveManager* OwnerMana
 
 void USFXWave_Horde_Geth2::StartAutoBots ( )
 {
-	static UFunction* pFnStartAutoBots = NULL;
-
+	UFunction* pFnStartAutoBots = (UFunction*) SdkBindings::Get ( 7298 );
 	if ( ! pFnStartAutoBots )
-		pFnStartAutoBots = (UFunction*) UObject::GObjObjects()->Data[ 113152 ];
+		return;
 
 	USFXWave_Horde_Geth2_execStartAutoBots_Parms StartAutoBots_Parms;
 
@@ -1421,10 +1347,9 @@ void USFXWave_Horde_Geth2::StartAutoBots ( )
 
 float USFXWave_Horde_Geth2::GetScoreBudget ( )
 {
-	static UFunction* pFnGetScoreBudget = NULL;
-
+	UFunction* pFnGetScoreBudget = (UFunction*) SdkBindings::Get ( 7323 );
 	if ( ! pFnGetScoreBudget )
-		pFnGetScoreBudget = (UFunction*) UObject::GObjObjects()->Data[ 113316 ];
+		return {};
 
 	USFXWave_Horde_Geth2_execGetScoreBudget_Parms GetScoreBudget_Parms;
 
@@ -1440,10 +1365,9 @@ float USFXWave_Horde_Geth2::GetScoreBudget ( )
 
 int USFXWave_Horde_Geth2::CalculateSpawnedEnemyCost ( )
 {
-	static UFunction* pFnCalculateSpawnedEnemyCost = NULL;
-
+	UFunction* pFnCalculateSpawnedEnemyCost = (UFunction*) SdkBindings::Get ( 7322 );
 	if ( ! pFnCalculateSpawnedEnemyCost )
-		pFnCalculateSpawnedEnemyCost = (UFunction*) UObject::GObjObjects()->Data[ 113312 ];
+		return {};
 
 	USFXWave_Horde_Geth2_execCalculateSpawnedEnemyCost_Parms CalculateSpawnedEnemyCost_Parms;
 
@@ -1459,10 +1383,9 @@ int USFXWave_Horde_Geth2::CalculateSpawnedEnemyCost ( )
 
 void USFXWave_Horde_Geth2::PawnRevived ( class ABioPawn* Pawn )
 {
-	static UFunction* pFnPawnRevived = NULL;
-
+	UFunction* pFnPawnRevived = (UFunction*) SdkBindings::Get ( 7321 );
 	if ( ! pFnPawnRevived )
-		pFnPawnRevived = (UFunction*) UObject::GObjObjects()->Data[ 113308 ];
+		return;
 
 	USFXWave_Horde_Geth2_execPawnRevived_Parms PawnRevived_Parms;
 	PawnRevived_Parms.Pawn = Pawn;
@@ -1478,10 +1401,9 @@ void USFXWave_Horde_Geth2::PawnRevived ( class ABioPawn* Pawn )
 
 struct FEnemySpawnInfo USFXWave_Horde_Geth2::GetEnemySpawnInfoForEnemyType ( struct FName EnemyType )
 {
-	static UFunction* pFnGetEnemySpawnInfoForEnemyType = NULL;
-
+	UFunction* pFnGetEnemySpawnInfoForEnemyType = (UFunction*) SdkBindings::Get ( 7297 );
 	if ( ! pFnGetEnemySpawnInfoForEnemyType )
-		pFnGetEnemySpawnInfoForEnemyType = (UFunction*) UObject::GObjObjects()->Data[ 113151 ];
+		return {};
 
 	USFXWave_Horde_Geth2_execGetEnemySpawnInfoForEnemyType_Parms GetEnemySpawnInfoForEnemyType_Parms;
 	memcpy ( &GetEnemySpawnInfoForEnemyType_Parms.EnemyType, &EnemyType, 0x8 );
@@ -1497,10 +1419,9 @@ struct FEnemySpawnInfo USFXWave_Horde_Geth2::GetEnemySpawnInfoForEnemyType ( str
 
 void USFXWave_Horde_Geth2::StopSpawningNewEnemies ( )
 {
-	static UFunction* pFnStopSpawningNewEnemies = NULL;
-
+	UFunction* pFnStopSpawningNewEnemies = (UFunction*) SdkBindings::Get ( 7320 );
 	if ( ! pFnStopSpawningNewEnemies )
-		pFnStopSpawningNewEnemies = (UFunction*) UObject::GObjObjects()->Data[ 113304 ];
+		return;
 
 	USFXWave_Horde_Geth2_execStopSpawningNewEnemies_Parms StopSpawningNewEnemies_Parms;
 
@@ -1514,10 +1435,9 @@ void USFXWave_Horde_Geth2::StopSpawningNewEnemies ( )
 
 void USFXWave_Horde_Geth2::SetEndlessWaves ( unsigned long Endless )
 {
-	static UFunction* pFnSetEndlessWaves = NULL;
-
+	UFunction* pFnSetEndlessWaves = (UFunction*) SdkBindings::Get ( 6220 );
 	if ( ! pFnSetEndlessWaves )
-		pFnSetEndlessWaves = (UFunction*) UObject::GObjObjects()->Data[ 108141 ];
+		return;
 
 	USFXWave_Horde_Geth2_execSetEndlessWaves_Parms SetEndlessWaves_Parms;
 	SetEndlessWaves_Parms.Endless = Endless;
@@ -1532,10 +1452,9 @@ void USFXWave_Horde_Geth2::SetEndlessWaves ( unsigned long Endless )
 
 bool USFXWave_Horde_Geth2::EnemyBudgetRemaining ( )
 {
-	static UFunction* pFnEnemyBudgetRemaining = NULL;
-
+	UFunction* pFnEnemyBudgetRemaining = (UFunction*) SdkBindings::Get ( 7310 );
 	if ( ! pFnEnemyBudgetRemaining )
-		pFnEnemyBudgetRemaining = (UFunction*) UObject::GObjObjects()->Data[ 113251 ];
+		return {};
 
 	USFXWave_Horde_Geth2_execEnemyBudgetRemaining_Parms EnemyBudgetRemaining_Parms;
 
@@ -1552,10 +1471,9 @@ bool USFXWave_Horde_Geth2::EnemyBudgetRemaining ( )
 
 int USFXWave_Horde_Geth2::GetCreatureWaveCost ( class APawn* P )
 {
-	static UFunction* pFnGetCreatureWaveCost = NULL;
-
+	UFunction* pFnGetCreatureWaveCost = (UFunction*) SdkBindings::Get ( 7319 );
 	if ( ! pFnGetCreatureWaveCost )
-		pFnGetCreatureWaveCost = (UFunction*) UObject::GObjObjects()->Data[ 113298 ];
+		return {};
 
 	USFXWave_Horde_Geth2_execGetCreatureWaveCost_Parms GetCreatureWaveCost_Parms;
 	GetCreatureWaveCost_Parms.P = P;
@@ -1572,10 +1490,9 @@ int USFXWave_Horde_Geth2::GetCreatureWaveCost ( class APawn* P )
 
 void USFXWave_Horde_Geth2::TriggerWaveEndEvent ( int Wave )
 {
-	static UFunction* pFnTriggerWaveEndEvent = NULL;
-
+	UFunction* pFnTriggerWaveEndEvent = (UFunction*) SdkBindings::Get ( 7318 );
 	if ( ! pFnTriggerWaveEndEvent )
-		pFnTriggerWaveEndEvent = (UFunction*) UObject::GObjObjects()->Data[ 113290 ];
+		return;
 
 	USFXWave_Horde_Geth2_execTriggerWaveEndEvent_Parms TriggerWaveEndEvent_Parms;
 	TriggerWaveEndEvent_Parms.Wave = Wave;
@@ -1591,10 +1508,9 @@ void USFXWave_Horde_Geth2::TriggerWaveEndEvent ( int Wave )
 
 void USFXWave_Horde_Geth2::TriggerEnemyKilledEvent ( class APawn* Killed, class APawn* Killer )
 {
-	static UFunction* pFnTriggerEnemyKilledEvent = NULL;
-
+	UFunction* pFnTriggerEnemyKilledEvent = (UFunction*) SdkBindings::Get ( 7317 );
 	if ( ! pFnTriggerEnemyKilledEvent )
-		pFnTriggerEnemyKilledEvent = (UFunction*) UObject::GObjObjects()->Data[ 113282 ];
+		return;
 
 	USFXWave_Horde_Geth2_execTriggerEnemyKilledEvent_Parms TriggerEnemyKilledEvent_Parms;
 	TriggerEnemyKilledEvent_Parms.Killed = Killed;
@@ -1610,10 +1526,9 @@ void USFXWave_Horde_Geth2::TriggerEnemyKilledEvent ( class APawn* Killed, class
 
 void USFXWave_Horde_Geth2::TriggerWaveStartEvent ( int Wave )
 {
-	static UFunction* pFnTriggerWaveStartEvent = NULL;
-
+	UFunction* pFnTriggerWaveStartEvent = (UFunction*) SdkBindings::Get ( 7316 );
 	if ( ! pFnTriggerWaveStartEvent )
-		pFnTriggerWaveStartEvent = (UFunction*) UObject::GObjObjects()->Data[ 113274 ];
+		return;
 
 	USFXWave_Horde_Geth2_execTriggerWaveStartEvent_Parms TriggerWaveStartEvent_Parms;
 	TriggerWaveStartEvent_Parms.Wave = Wave;
@@ -1628,10 +1543,9 @@ void USFXWave_Horde_Geth2::TriggerWaveStartEvent ( int Wave )
 
 bool USFXWave_Horde_Geth2::ShouldSpawnSquad ( )
 {
-	static UFunction* pFnShouldSpawnSquad = NULL;
-
+	UFunction* pFnShouldSpawnSquad = (UFunction*) SdkBindings::Get ( 7311 );
 	if ( ! pFnShouldSpawnSquad )
-		pFnShouldSpawnSquad = (UFunction*) UObject::GObjObjects()->Data[ 113253 ];
+		return {};
 
 	USFXWave_Horde_Geth2_execShouldSpawnSquad_Parms ShouldSpawnSquad_Parms;
 
@@ -1647,10 +1561,9 @@ bool USFXWave_Horde_Geth2::ShouldSpawnSquad ( )
 
 int USFXWave_Horde_Geth2::GetPlayerCount ( )
 {
-	static UFunction* pFnGetPlayerCount = NULL;
-
+	UFunction* pFnGetPlayerCount = (UFunction*) SdkBindings::Get ( 7315 );
 	if ( ! pFnGetPlayerCount )
-		pFnGetPlayerCount = (UFunction*) UObject::GObjObjects()->Data[ 113267 ];
+		return {};
 
 	USFXWave_Horde_Geth2_execGetPlayerCount_Parms GetPlayerCount_Parms;
 
@@ -1667,10 +1580,9 @@ int USFXWave_Horde_Geth2::GetPlayerCount ( )
 
 void USFXWave_Horde_Geth2::PawnDied ( class ABioPawn* Pawn, class ABioPawn* Killer )
 {
-	static UFunction* pFnPawnDied = NULL;
-
+	UFunction* pFnPawnDied = (UFunction*) SdkBindings::Get ( 7314 );
 	if ( ! pFnPawnDied )
-		pFnPawnDied = (UFunction*) UObject::GObjObjects()->Data[ 113261 ];
+		return;
 
 	USFXWave_Horde_Geth2_execPawnDied_Parms PawnDied_Parms;
 	PawnDied_Parms.Pawn = Pawn;
@@ -1685,10 +1597,9 @@ void USFXWave_Horde_Geth2::PawnDied ( class ABioPawn* Pawn, class ABioPawn* Kill
 
 void USFXWave_Horde_Geth2::ActivateEnemyObjectiveMarkers ( )
 {
-	static UFunction* pFnActivateEnemyObjectiveMarkers = NULL;
-
+	UFunction* pFnActivateEnemyObjectiveMarkers = (UFunction*) SdkBindings::Get ( 7313 );
 	if ( ! pFnActivateEnemyObjectiveMarkers )
-		pFnActivateEnemyObjectiveMarkers = (UFunction*) UObject::GObjObjects()->Data[ 113258 ];
+		return;
 
 	USFXWave_Horde_Geth2_execActivateEnemyObjectiveMarkers_Parms ActivateEnemyObjectiveMarkers_Parms;
 
@@ -1701,10 +1612,9 @@ void USFXWave_Horde_Geth2::ActivateEnemyObjectiveMarkers ( )
 
 void USFXWave_Horde_Geth2::UpdateObjectiveStatus ( )
 {
-	static UFunction* pFnUpdateObjectiveStatus = NULL;
-
+	UFunction* pFnUpdateObjectiveStatus = (UFunction*) SdkBindings::Get ( 7312 );
 	if ( ! pFnUpdateObjectiveStatus )
-		pFnUpdateObjectiveStatus = (UFunction*) UObject::GObjObjects()->Data[ 113254 ];
+		return;
 
 	USFXWave_Horde_Geth2_execUpdateObjectiveStatus_Parms UpdateObjectiveStatus_Parms;
 
@@ -1717,10 +1627,9 @@ void USFXWave_Horde_Geth2::UpdateObjectiveStatus ( )
 
 void USFXWave_Horde_Geth2::SpawnHorde ( )
 {
-	static UFunction* pFnSpawnHorde = NULL;
-
+	UFunction* pFnSpawnHorde = (UFunction*) SdkBindings::Get ( 7309 );
 	if ( ! pFnSpawnHorde )
-		pFnSpawnHorde = (UFunction*) UObject::GObjObjects()->Data[ 113249 ];
+		return;
 
 	USFXWave_Horde_Geth2_execSpawnHorde_Parms SpawnHorde_Parms;
 
@@ -1734,10 +1643,9 @@ void USFXWave_Horde_Geth2::SpawnHorde ( )
 
 void USFXWave_Horde_Geth2::SpawnEnemy ( int Index )
 {
-	static UFunction* pFnSpawnEnemy = NULL;
-
+	UFunction* pFnSpawnEnemy = (UFunction*) SdkBindings::Get ( 7308 );
 	if ( ! pFnSpawnEnemy )
-		pFnSpawnEnemy = (UFunction*) UObject::GObjObjects()->Data[ 113242 ];
+		return;
 
 	USFXWave_Horde_Geth2_execSpawnEnemy_Parms SpawnEnemy_Parms;
 	SpawnEnemy_Parms.Index = Index;
@@ -1752,10 +1660,9 @@ void USFXWave_Horde_Geth2::SpawnEnemy ( int Index )
 
 bool USFXWave_Horde_Geth2::AreRemainingEnemiesOnMyTeam ( )
 {
-	static UFunction* pFnAreRemainingEnemiesOnMyTeam = NULL;
-
+	UFunction* pFnAreRemainingEnemiesOnMyTeam = (UFunction*) SdkBindings::Get ( 7307 );
 	if ( ! pFnAreRemainingEnemiesOnMyTeam )
-		pFnAreRemainingEnemiesOnMyTeam = (UFunction*) UObject::GObjObjects()->Data[ 113239 ];
+		return {};
 
 	USFXWave_Horde_Geth2_execAreRemainingEnemiesOnMyTeam_Parms AreRemainingEnemiesOnMyTeam_Parms;
 
@@ -1771,10 +1678,9 @@ bool USFXWave_Horde_Geth2::AreRemainingEnemiesOnMyTeam ( )
 
 int USFXWave_Horde_Geth2::ChooseEnemyToSpawn ( )
 {
-	static UFunction* pFnChooseEnemyToSpawn = NULL;
-
+	UFunction* pFnChooseEnemyToSpawn = (UFunction*) SdkBindings::Get ( 7306 );
 	if ( ! pFnChooseEnemyToSpawn )
-		pFnChooseEnemyToSpawn = (UFunction*) UObject::GObjObjects()->Data[ 113228 ];
+		return {};
 
 	USFXWave_Horde_Geth2_execChooseEnemyToSpawn_Parms ChooseEnemyToSpawn_Parms;
 
@@ -1790,10 +1696,9 @@ int USFXWave_Horde_Geth2::ChooseEnemyToSpawn ( )
 
 bool USFXWave_Horde_Geth2::ChooseSquadToSpawn ( )
 {
-	static UFunction* pFnChooseSquadToSpawn = NULL;
-
+	UFunction* pFnChooseSquadToSpawn = (UFunction*) SdkBindings::Get ( 7305 );
 	if ( ! pFnChooseSquadToSpawn )
-		pFnChooseSquadToSpawn = (UFunction*) UObject::GObjObjects()->Data[ 113223 ];
+		return {};
 
 	USFXWave_Horde_Geth2_execChooseSquadToSpawn_Parms ChooseSquadToSpawn_Parms;
 
@@ -1813,10 +1718,9 @@ bool USFXWave_Horde_Geth2::ChooseSquadToSpawn ( )
 
 bool USFXWave_Horde_Geth2::CanEnemyUseSpawnPoint ( class UClass* EnemyClass, float EnemyRadius, float EnemyHeight, class ANavigationPoint* NavPoint )
 {
-	static UFunction* pFnCanEnemyUseSpawnPoint = NULL;
-
+	UFunction* pFnCanEnemyUseSpawnPoint = (UFunction*) SdkBindings::Get ( 7304 );
 	if ( ! pFnCanEnemyUseSpawnPoint )
-		pFnCanEnemyUseSpawnPoint = (UFunction*) UObject::GObjObjects()->Data[ 113203 ];
+		return {};
 
 	USFXWave_Horde_Geth2_execCanEnemyUseSpawnPoint_Parms CanEnemyUseSpawnPoint_Parms;
 	CanEnemyUseSpawnPoint_Parms.EnemyClass = EnemyClass;
@@ -1841,10 +1745,9 @@ bool USFXWave_Horde_Geth2::CanEnemyUseSpawnPoint ( class UClass* EnemyClass, flo
 
 float USFXWave_Horde_Geth2::RateEnemyStart ( class ANavigationPoint* NavPoint, float EnemyRadius, float EnemyHeight, class UClass* EnemyClass, unsigned long bDoTraceCheck )
 {
-	static UFunction* pFnRateEnemyStart = NULL;
-
+	UFunction* pFnRateEnemyStart = (UFunction*) SdkBindings::Get ( 7303 );
 	if ( ! pFnRateEnemyStart )
-		pFnRateEnemyStart = (UFunction*) UObject::GObjObjects()->Data[ 113186 ];
+		return {};
 
 	USFXWave_Horde_Geth2_execRateEnemyStart_Parms RateEnemyStart_Parms;
 	RateEnemyStart_Parms.NavPoint = NavPoint;
@@ -1866,10 +1769,9 @@ float USFXWave_Horde_Geth2::RateEnemyStart ( class ANavigationPoint* NavPoint, f
 
 class ANavigationPoint* USFXWave_Horde_Geth2::ChooseEnemyStart ( class UClass* EnemyClass )
 {
-	static UFunction* pFnChooseEnemyStart = NULL;
-
+	UFunction* pFnChooseEnemyStart = (UFunction*) SdkBindings::Get ( 7302 );
 	if ( ! pFnChooseEnemyStart )
-		pFnChooseEnemyStart = (UFunction*) UObject::GObjObjects()->Data[ 113171 ];
+		return {};
 
 	USFXWave_Horde_Geth2_execChooseEnemyStart_Parms ChooseEnemyStart_Parms;
 	ChooseEnemyStart_Parms.EnemyClass = EnemyClass;
@@ -1885,10 +1787,9 @@ class ANavigationPoint* USFXWave_Horde_Geth2::ChooseEnemyStart ( class UClass* E
 
 void USFXWave_Horde_Geth2::FinishWave ( )
 {
-	static UFunction* pFnFinishWave = NULL;
-
+	UFunction* pFnFinishWave = (UFunction*) SdkBindings::Get ( 7301 );
 	if ( ! pFnFinishWave )
-		pFnFinishWave = (UFunction*) UObject::GObjObjects()->Data[ 113168 ];
+		return;
 
 	USFXWave_Horde_Geth2_execFinishWave_Parms FinishWave_Parms;
 
@@ -1902,10 +1803,9 @@ void USFXWave_Horde_Geth2::FinishWave ( )
 
 bool USFXWave_Horde_Geth2::BeginWave ( )
 {
-	static UFunction* pFnBeginWave = NULL;
-
+	UFunction* pFnBeginWave = (UFunction*) SdkBindings::Get ( 7300 );
 	if ( ! pFnBeginWave )
-		pFnBeginWave = (UFunction*) UObject::GObjObjects()->Data[ 113159 ];
+		return {};
 
 	USFXWave_Horde_Geth2_execBeginWave_Parms BeginWave_Parms;
 
@@ -1921,10 +1821,9 @@ bool USFXWave_Horde_Geth2::BeginWave ( )
 
 void USFXWave_Horde_Geth2::GetEnemyArray ( TArray< struct FEnemyWaveInfo >* EnemyArray )
 {
-	static UFunction* pFnGetEnemyArray = NULL;
-
+	UFunction* pFnGetEnemyArray = (UFunction*) SdkBindings::Get ( 7299 );
 	if ( ! pFnGetEnemyArray )
-		pFnGetEnemyArray = (UFunction*) UObject::GObjObjects()->Data[ 113153 ];
+		return;
 
 	USFXWave_Horde_Geth2_execGetEnemyArray_Parms GetEnemyArray_Parms;
 
@@ -1941,10 +1840,9 @@ void USFXWave_Horde_Geth2::GetEnemyArray ( TArray< struct FEnemyWaveInfo >* Enem
 
 void USFXWave_Horde_Geth2::InitializeWave ( class ASFXWaveManager* OwnerManager )
 {
-	static UFunction* pFnInitializeWave = NULL;
-
+	UFunction* pFnInitializeWave = (UFunction*) SdkBindings::Get ( 7296 );
 	if ( ! pFnInitializeWave )
-		pFnInitializeWave = (UFunction*) UObject::GObjObjects()->Data[ 113141 ];
+		return;
 
 	USFXWave_Horde_Geth2_execInitializeWave_Parms InitializeWave_Parms;
 	InitializeWave_Parms.OwnerManager = OwnerManager;
@@ -1958,10 +1856,9 @@ void USFXWave_Horde_Geth2::InitializeWave ( class ASFXWaveManager* OwnerManager
 
 void USFXWave_Horde_Reaper2::StartAutoBots ( )
 {
-	static UFunction* pFnStartAutoBots = NULL;
-
+	UFunction* pFnStartAutoBots = (UFunction*) SdkBindings::Get ( 7298 );
 	if ( ! pFnStartAutoBots )
-		pFnStartAutoBots = (UFunction*) UObject::GObjObjects()->Data[ 113152 ];
+		return;
 
 	USFXWave_Horde_Reaper2_execStartAutoBots_Parms StartAutoBots_Parms;
 
@@ -1975,10 +1872,9 @@ void USFXWave_Horde_Reaper2::StartAutoBots ( )
 
 float USFXWave_Horde_Reaper2::GetScoreBudget ( )
 {
-	static UFunction* pFnGetScoreBudget = NULL;
-
+	UFunction* pFnGetScoreBudget = (UFunction*) SdkBindings::Get ( 7323 );
 	if ( ! pFnGetScoreBudget )
-		pFnGetScoreBudget = (UFunction*) UObject::GObjObjects()->Data[ 113316 ];
+		return {};
 
 	USFXWave_Horde_Reaper2_execGetScoreBudget_Parms GetScoreBudget_Parms;
 
@@ -1994,10 +1890,9 @@ float USFXWave_Horde_Reaper2::GetScoreBudget ( )
 
 int USFXWave_Horde_Reaper2::CalculateSpawnedEnemyCost ( )
 {
-	static UFunction* pFnCalculateSpawnedEnemyCost = NULL;
-
+	UFunction* pFnCalculateSpawnedEnemyCost = (UFunction*) SdkBindings::Get ( 7322 );
 	if ( ! pFnCalculateSpawnedEnemyCost )
-		pFnCalculateSpawnedEnemyCost = (UFunction*) UObject::GObjObjects()->Data[ 113312 ];
+		return {};
 
 	USFXWave_Horde_Reaper2_execCalculateSpawnedEnemyCost_Parms CalculateSpawnedEnemyCost_Parms;
 
@@ -2013,10 +1908,9 @@ int USFXWave_Horde_Reaper2::CalculateSpawnedEnemyCost ( )
 
 void USFXWave_Horde_Reaper2::PawnRevived ( class ABioPawn* Pawn )
 {
-	static UFunction* pFnPawnRevived = NULL;
-
+	UFunction* pFnPawnRevived = (UFunction*) SdkBindings::Get ( 7321 );
 	if ( ! pFnPawnRevived )
-		pFnPawnRevived = (UFunction*) UObject::GObjObjects()->Data[ 113308 ];
+		return;
 
 	USFXWave_Horde_Reaper2_execPawnRevived_Parms PawnRevived_Parms;
 	PawnRevived_Parms.Pawn = Pawn;
@@ -2032,10 +1926,9 @@ void USFXWave_Horde_Reaper2::PawnRevived ( class ABioPawn* Pawn )
 
 struct FEnemySpawnInfo USFXWave_Horde_Reaper2::GetEnemySpawnInfoForEnemyType ( struct FName EnemyType )
 {
-	static UFunction* pFnGetEnemySpawnInfoForEnemyType = NULL;
-
+	UFunction* pFnGetEnemySpawnInfoForEnemyType = (UFunction*) SdkBindings::Get ( 7297 );
 	if ( ! pFnGetEnemySpawnInfoForEnemyType )
-		pFnGetEnemySpawnInfoForEnemyType = (UFunction*) UObject::GObjObjects()->Data[ 113151 ];
+		return {};
 
 	USFXWave_Horde_Reaper2_execGetEnemySpawnInfoForEnemyType_Parms GetEnemySpawnInfoForEnemyType_Parms;
 	memcpy ( &GetEnemySpawnInfoForEnemyType_Parms.EnemyType, &EnemyType, 0x8 );
@@ -2051,10 +1944,9 @@ struct FEnemySpawnInfo USFXWave_Horde_Reaper2::GetEnemySpawnInfoForEnemyType ( s
 
 void USFXWave_Horde_Reaper2::StopSpawningNewEnemies ( )
 {
-	static UFunction* pFnStopSpawningNewEnemies = NULL;
-
+	UFunction* pFnStopSpawningNewEnemies = (UFunction*) SdkBindings::Get ( 7320 );
 	if ( ! pFnStopSpawningNewEnemies )
-		pFnStopSpawningNewEnemies = (UFunction*) UObject::GObjObjects()->Data[ 113304 ];
+		return;
 
 	USFXWave_Horde_Reaper2_execStopSpawningNewEnemies_Parms StopSpawningNewEnemies_Parms;
 
@@ -2068,10 +1960,9 @@ void USFXWave_Horde_Reaper2::StopSpawningNewEnemies ( )
 
 void USFXWave_Horde_Reaper2::SetEndlessWaves ( unsigned long Endless )
 {
-	static UFunction* pFnSetEndlessWaves = NULL;
-
+	UFunction* pFnSetEndlessWaves = (UFunction*) SdkBindings::Get ( 6220 );
 	if ( ! pFnSetEndlessWaves )
-		pFnSetEndlessWaves = (UFunction*) UObject::GObjObjects()->Data[ 108141 ];
+		return;
 
 	USFXWave_Horde_Reaper2_execSetEndlessWaves_Parms SetEndlessWaves_Parms;
 	SetEndlessWaves_Parms.Endless = Endless;
@@ -2086,10 +1977,9 @@ void USFXWave_Horde_Reaper2::SetEndlessWaves ( unsigned long Endless )
 
 bool USFXWave_Horde_Reaper2::EnemyBudgetRemaining ( )
 {
-	static UFunction* pFnEnemyBudgetRemaining = NULL;
-
+	UFunction* pFnEnemyBudgetRemaining = (UFunction*) SdkBindings::Get ( 7310 );
 	if ( ! pFnEnemyBudgetRemaining )
-		pFnEnemyBudgetRemaining = (UFunction*) UObject::GObjObjects()->Data[ 113251 ];
+		return {};
 
 	USFXWave_Horde_Reaper2_execEnemyBudgetRemaining_Parms EnemyBudgetRemaining_Parms;
 
@@ -2106,10 +1996,9 @@ bool USFXWave_Horde_Reaper2::EnemyBudgetRemaining ( )
 
 int USFXWave_Horde_Reaper2::GetCreatureWaveCost ( class APawn* P )
 {
-	static UFunction* pFnGetCreatureWaveCost = NULL;
-
+	UFunction* pFnGetCreatureWaveCost = (UFunction*) SdkBindings::Get ( 7319 );
 	if ( ! pFnGetCreatureWaveCost )
-		pFnGetCreatureWaveCost = (UFunction*) UObject::GObjObjects()->Data[ 113298 ];
+		return {};
 
 	USFXWave_Horde_Reaper2_execGetCreatureWaveCost_Parms GetCreatureWaveCost_Parms;
 	GetCreatureWaveCost_Parms.P = P;
@@ -2126,10 +2015,9 @@ int USFXWave_Horde_Reaper2::GetCreatureWaveCost ( class APawn* P )
 
 void USFXWave_Horde_Reaper2::TriggerWaveEndEvent ( int Wave )
 {
-	static UFunction* pFnTriggerWaveEndEvent = NULL;
-
+	UFunction* pFnTriggerWaveEndEvent = (UFunction*) SdkBindings::Get ( 7318 );
 	if ( ! pFnTriggerWaveEndEvent )
-		pFnTriggerWaveEndEvent = (UFunction*) UObject::GObjObjects()->Data[ 113290 ];
+		return;
 
 	USFXWave_Horde_Reaper2_execTriggerWaveEndEvent_Parms TriggerWaveEndEvent_Parms;
 	TriggerWaveEndEvent_Parms.Wave = Wave;
@@ -2145,10 +2033,9 @@ void USFXWave_Horde_Reaper2::TriggerWaveEndEvent ( int Wave )
 
 void USFXWave_Horde_Reaper2::TriggerEnemyKilledEvent ( class APawn* Killed, class APawn* Killer )
 {
-	static UFunction* pFnTriggerEnemyKilledEvent = NULL;
-
+	UFunction* pFnTriggerEnemyKilledEvent = (UFunction*) SdkBindings::Get ( 7317 );
 	if ( ! pFnTriggerEnemyKilledEvent )
-		pFnTriggerEnemyKilledEvent = (UFunction*) UObject::GObjObjects()->Data[ 113282 ];
+		return;
 
 	USFXWave_Horde_Reaper2_execTriggerEnemyKilledEvent_Parms TriggerEnemyKilledEvent_Parms;
 	TriggerEnemyKilledEvent_Parms.Killed = Killed;
@@ -2164,10 +2051,9 @@ void USFXWave_Horde_Reaper2::TriggerEnemyKilledEvent ( class APawn* Killed, clas
 
 void USFXWave_Horde_Reaper2::TriggerWaveStartEvent ( int Wave )
 {
-	static UFunction* pFnTriggerWaveStartEvent = NULL;
-
+	UFunction* pFnTriggerWaveStartEvent = (UFunction*) SdkBindings::Get ( 7316 );
 	if ( ! pFnTriggerWaveStartEvent )
-		pFnTriggerWaveStartEvent = (UFunction*) UObject::GObjObjects()->Data[ 113274 ];
+		return;
 
 	USFXWave_Horde_Reaper2_execTriggerWaveStartEvent_Parms TriggerWaveStartEvent_Parms;
 	TriggerWaveStartEvent_Parms.Wave = Wave;
@@ -2182,10 +2068,9 @@ void USFXWave_Horde_Reaper2::TriggerWaveStartEvent ( int Wave )
 
 bool USFXWave_Horde_Reaper2::ShouldSpawnSquad ( )
 {
-	static UFunction* pFnShouldSpawnSquad = NULL;
-
+	UFunction* pFnShouldSpawnSquad = (UFunction*) SdkBindings::Get ( 7311 );
 	if ( ! pFnShouldSpawnSquad )
-		pFnShouldSpawnSquad = (UFunction*) UObject::GObjObjects()->Data[ 113253 ];
+		return {};
 
 	USFXWave_Horde_Reaper2_execShouldSpawnSquad_Parms ShouldSpawnSquad_Parms;
 
@@ -2201,10 +2086,9 @@ bool USFXWave_Horde_Reaper2::ShouldSpawnSquad ( )
 
 int USFXWave_Horde_Reaper2::GetPlayerCount ( )
 {
-	static UFunction* pFnGetPlayerCount = NULL;
-
+	UFunction* pFnGetPlayerCount = (UFunction*) SdkBindings::Get ( 7315 );
 	if ( ! pFnGetPlayerCount )
-		pFnGetPlayerCount = (UFunction*) UObject::GObjObjects()->Data[ 113267 ];
+		return {};
 
 	USFXWave_Horde_Reaper2_execGetPlayerCount_Parms GetPlayerCount_Parms;
 
@@ -2221,10 +2105,9 @@ int USFXWave_Horde_Reaper2::GetPlayerCount ( )
 
 void USFXWave_Horde_Reaper2::PawnDied ( class ABioPawn* Pawn, class ABioPawn* Killer )
 {
-	static UFunction* pFnPawnDied = NULL;
-
+	UFunction* pFnPawnDied = (UFunction*) SdkBindings::Get ( 7314 );
 	if ( ! pFnPawnDied )
-		pFnPawnDied = (UFunction*) UObject::GObjObjects()->Data[ 113261 ];
+		return;
 
 	USFXWave_Horde_Reaper2_execPawnDied_Parms PawnDied_Parms;
 	PawnDied_Parms.Pawn = Pawn;
@@ -2239,10 +2122,9 @@ void USFXWave_Horde_Reaper2::PawnDied ( class ABioPawn* Pawn, class ABioPawn* Ki
 
 void USFXWave_Horde_Reaper2::ActivateEnemyObjectiveMarkers ( )
 {
-	static UFunction* pFnActivateEnemyObjectiveMarkers = NULL;
-
+	UFunction* pFnActivateEnemyObjectiveMarkers = (UFunction*) SdkBindings::Get ( 7313 );
 	if ( ! pFnActivateEnemyObjectiveMarkers )
-		pFnActivateEnemyObjectiveMarkers = (UFunction*) UObject::GObjObjects()->Data[ 113258 ];
+		return;
 
 	USFXWave_Horde_Reaper2_execActivateEnemyObjectiveMarkers_Parms ActivateEnemyObjectiveMarkers_Parms;
 
@@ -2255,10 +2137,9 @@ void USFXWave_Horde_Reaper2::ActivateEnemyObjectiveMarkers ( )
 
 void USFXWave_Horde_Reaper2::UpdateObjectiveStatus ( )
 {
-	static UFunction* pFnUpdateObjectiveStatus = NULL;
-
+	UFunction* pFnUpdateObjectiveStatus = (UFunction*) SdkBindings::Get ( 7312 );
 	if ( ! pFnUpdateObjectiveStatus )
-		pFnUpdateObjectiveStatus = (UFunction*) UObject::GObjObjects()->Data[ 113254 ];
+		return;
 
 	USFXWave_Horde_Reaper2_execUpdateObjectiveStatus_Parms UpdateObjectiveStatus_Parms;
 
@@ -2271,10 +2152,9 @@ void USFXWave_Horde_Reaper2::UpdateObjectiveStatus ( )
 
 void USFXWave_Horde_Reaper2::SpawnHorde ( )
 {
-	static UFunction* pFnSpawnHorde = NULL;
-
+	UFunction* pFnSpawnHorde = (UFunction*) SdkBindings::Get ( 7309 );
 	if ( ! pFnSpawnHorde )
-		pFnSpawnHorde = (UFunction*) UObject::GObjObjects()->Data[ 113249 ];
+		return;
 
 	USFXWave_Horde_Reaper2_execSpawnHorde_Parms SpawnHorde_Parms;
 
@@ -2288,10 +2168,9 @@ void USFXWave_Horde_Reaper2::SpawnHorde ( )
 
 void USFXWave_Horde_Reaper2::SpawnEnemy ( int Index )
 {
-	static UFunction* pFnSpawnEnemy = NULL;
-
+	UFunction* pFnSpawnEnemy = (UFunction*) SdkBindings::Get ( 7308 );
 	if ( ! pFnSpawnEnemy )
-		pFnSpawnEnemy = (UFunction*) UObject::GObjObjects()->Data[ 113242 ];
+		return;
 
 	USFXWave_Horde_Reaper2_execSpawnEnemy_Parms SpawnEnemy_Parms;
 	SpawnEnemy_Parms.Index = Index;
@@ -2306,10 +2185,9 @@ void USFXWave_Horde_Reaper2::SpawnEnemy ( int Index )
 
 bool USFXWave_Horde_Reaper2::AreRemainingEnemiesOnMyTeam ( )
 {
-	static UFunction* pFnAreRemainingEnemiesOnMyTeam = NULL;
-
+	UFunction* pFnAreRemainingEnemiesOnMyTeam = (UFunction*) SdkBindings::Get ( 7307 );
 	if ( ! pFnAreRemainingEnemiesOnMyTeam )
-		pFnAreRemainingEnemiesOnMyTeam = (UFunction*) UObject::GObjObjects()->Data[ 113239 ];
+		return {};
 
 	USFXWave_Horde_Reaper2_execAreRemainingEnemiesOnMyTeam_Parms AreRemainingEnemiesOnMyTeam_Parms;
 
@@ -2325,10 +2203,9 @@ bool USFXWave_Horde_Reaper2::AreRemainingEnemiesOnMyTeam ( )
 
 int USFXWave_Horde_Reaper2::ChooseEnemyToSpawn ( )
 {
-	static UFunction* pFnChooseEnemyToSpawn = NULL;
-
+	UFunction* pFnChooseEnemyToSpawn = (UFunction*) SdkBindings::Get ( 7306 );
 	if ( ! pFnChooseEnemyToSpawn )
-		pFnChooseEnemyToSpawn = (UFunction*) UObject::GObjObjects()->Data[ 113228 ];
+		return {};
 
 	USFXWave_Horde_Reaper2_execChooseEnemyToSpawn_Parms ChooseEnemyToSpawn_Parms;
 
@@ -2344,10 +2221,9 @@ int USFXWave_Horde_Reaper2::ChooseEnemyToSpawn ( )
 
 bool USFXWave_Horde_Reaper2::ChooseSquadToSpawn ( )
 {
-	static UFunction* pFnChooseSquadToSpawn = NULL;
-
+	UFunction* pFnChooseSquadToSpawn = (UFunction*) SdkBindings::Get ( 7305 );
 	if ( ! pFnChooseSquadToSpawn )
-		pFnChooseSquadToSpawn = (UFunction*) UObject::GObjObjects()->Data[ 113223 ];
+		return {};
 
 	USFXWave_Horde_Reaper2_execChooseSquadToSpawn_Parms ChooseSquadToSpawn_Parms;
 
@@ -2367,10 +2243,9 @@ bool USFXWave_Horde_Reaper2::ChooseSquadToSpawn ( )
 
 bool USFXWave_Horde_Reaper2::CanEnemyUseSpawnPoint ( class UClass* EnemyClass, float EnemyRadius, float EnemyHeight, class ANavigationPoint* NavPoint )
 {
-	static UFunction* pFnCanEnemyUseSpawnPoint = NULL;
-
+	UFunction* pFnCanEnemyUseSpawnPoint = (UFunction*) SdkBindings::Get ( 7304 );
 	if ( ! pFnCanEnemyUseSpawnPoint )
-		pFnCanEnemyUseSpawnPoint = (UFunction*) UObject::GObjObjects()->Data[ 113203 ];
+		return {};
 
 	USFXWave_Horde_Reaper2_execCanEnemyUseSpawnPoint_Parms CanEnemyUseSpawnPoint_Parms;
 	CanEnemyUseSpawnPoint_Parms.EnemyClass = EnemyClass;
@@ -2395,10 +2270,9 @@ bool USFXWave_Horde_Reaper2::CanEnemyUseSpawnPoint ( class UClass* EnemyClass, f
 
 float USFXWave_Horde_Reaper2::RateEnemyStart ( class ANavigationPoint* NavPoint, float EnemyRadius, float EnemyHeight, class UClass* EnemyClass, unsigned long bDoTraceCheck )
 {
-	static UFunction* pFnRateEnemyStart = NULL;
-
+	UFunction* pFnRateEnemyStart = (UFunction*) SdkBindings::Get ( 7303 );
 	if ( ! pFnRateEnemyStart )
-		pFnRateEnemyStart = (UFunction*) UObject::GObjObjects()->Data[ 113186 ];
+		return {};
 
 	USFXWave_Horde_Reaper2_execRateEnemyStart_Parms RateEnemyStart_Parms;
 	RateEnemyStart_Parms.NavPoint = NavPoint;
@@ -2420,10 +2294,9 @@ float USFXWave_Horde_Reaper2::RateEnemyStart ( class ANavigationPoint* NavPoint,
 
 class ANavigationPoint* USFXWave_Horde_Reaper2::ChooseEnemyStart ( class UClass* EnemyClass )
 {
-	static UFunction* pFnChooseEnemyStart = NULL;
-
+	UFunction* pFnChooseEnemyStart = (UFunction*) SdkBindings::Get ( 7302 );
 	if ( ! pFnChooseEnemyStart )
-		pFnChooseEnemyStart = (UFunction*) UObject::GObjObjects()->Data[ 113171 ];
+		return {};
 
 	USFXWave_Horde_Reaper2_execChooseEnemyStart_Parms ChooseEnemyStart_Parms;
 	ChooseEnemyStart_Parms.EnemyClass = EnemyClass;
@@ -2439,10 +2312,9 @@ class ANavigationPoint* USFXWave_Horde_Reaper2::ChooseEnemyStart ( class UClass*
 
 void USFXWave_Horde_Reaper2::FinishWave ( )
 {
-	static UFunction* pFnFinishWave = NULL;
-
+	UFunction* pFnFinishWave = (UFunction*) SdkBindings::Get ( 7301 );
 	if ( ! pFnFinishWave )
-		pFnFinishWave = (UFunction*) UObject::GObjObjects()->Data[ 113168 ];
+		return;
 
 	USFXWave_Horde_Reaper2_execFinishWave_Parms FinishWave_Parms;
 
@@ -2456,10 +2328,9 @@ void USFXWave_Horde_Reaper2::FinishWave ( )
 
 bool USFXWave_Horde_Reaper2::BeginWave ( )
 {
-	static UFunction* pFnBeginWave = NULL;
-
+	UFunction* pFnBeginWave = (UFunction*) SdkBindings::Get ( 7300 );
 	if ( ! pFnBeginWave )
-		pFnBeginWave = (UFunction*) UObject::GObjObjects()->Data[ 113159 ];
+		return {};
 
 	USFXWave_Horde_Reaper2_execBeginWave_Parms BeginWave_Parms;
 
@@ -2475,10 +2346,9 @@ bool USFXWave_Horde_Reaper2::BeginWave ( )
 
 void USFXWave_Horde_Reaper2::GetEnemyArray ( TArray< struct FEnemyWaveInfo >* EnemyArray )
 {
-	static UFunction* pFnGetEnemyArray = NULL;
-
+	UFunction* pFnGetEnemyArray = (UFunction*) SdkBindings::Get ( 7299 );
 	if ( ! pFnGetEnemyArray )
-		pFnGetEnemyArray = (UFunction*) UObject::GObjObjects()->Data[ 113153 ];
+		return;
 
 	USFXWave_Horde_Reaper2_execGetEnemyArray_Parms GetEnemyArray_Parms;
 
@@ -2495,10 +2365,9 @@ void USFXWave_Horde_Reaper2::GetEnemyArray ( TArray< struct FEnemyWaveInfo >* En
 
 void USFXWave_Horde_Reaper2::InitializeWave ( class ASFXWaveManager* OwnerManager )
 {
-	static UFunction* pFnInitializeWave = NULL;
-
+	UFunction* pFnInitializeWave = (UFunction*) SdkBindings::Get ( 7296 );
 	if ( ! pFnInitializeWave )
-		pFnInitializeWave = (UFunction*) UObject::GObjObjects()->Data[ 113141 ];
+		return;
 
 	USFXWave_Horde_Reaper2_execInitializeWave_Parms InitializeWave_Parms;
 	InitializeWave_Parms.OwnerManager = OwnerManager;
@@ -41,16 +41,9 @@ class USFXDamageType_SalarianBlast_MP : public USFXDamageType_Weapon
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 138406 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8089 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -58,24 +51,15 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_SalarianBlast_MP::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp5.SFXDamageType_SalarianShard_MP
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_SalarianShard_MP : public USFXDamageType_Gib
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 138409 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8090 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -83,8 +67,6 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_SalarianShard_MP::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlast_MP
 // 0x000B (0x039C - 0x0391)
 class ASFXProjectile_SalarianBlast_MP : public ASFXProjectile_Explosive
@@ -93,16 +75,9 @@ public:
 	float                                              GravityScale;                                     		// 0x0394 (0x0004) [0x0000000000000002]              ( CPF_Const )
 	class UWwiseEvent*                                 NPCExplosionSound;                                		// 0x0398 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 138412 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8091 );
 	};
 
 	void SpawnExplosionEffects ( struct FVector HitLocation, struct FVector HitNormal );
@@ -110,8 +85,6 @@ public:
 	void DoImpact ( class AActor* InImpactedActor, class AController* InInstigatorController, float BaseDamage, float InDamageRadius, float Momentum, struct FVector HurtOrigin, unsigned long bFullDamage, struct FTraceHitInfo* HitInfo );
 };
 
-UClass* ASFXProjectile_SalarianBlast_MP::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlastShard_MP
 // 0x001C (0x0430 - 0x0414)
 class ASFXProjectile_SalarianBlastShard_MP : public ASFXProjectile_Proximity
@@ -125,16 +98,9 @@ public:
 	float                                              HighShardExplosionDelay;                          		// 0x0428 (0x0004) [0x0000000000000000]              
 	class UWwiseEvent*                                 NPCExplosionSound;                                		// 0x042C (0x0004) [0x0000000000000002]              ( CPF_Const )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 138444 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8095 );
 	};
 
 	void Recycle ( );
@@ -146,8 +112,6 @@ public:
 	void Init ( struct FVector Direction );
 };
 
-UClass* ASFXProjectile_SalarianBlastShard_MP::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp5.SFXProjectile_SalarianBlastSplitter_MP
 // 0x0028 (0x0424 - 0x03FC)
 class ASFXProjectile_SalarianBlastSplitter_MP : public ASFXProjectile_SeekingMissile
@@ -164,16 +128,9 @@ public:
 	class UWwiseEvent*                                 NPCExplosionSound;                                		// 0x041C (0x0004) [0x0000000000000002]              ( CPF_Const )
 	unsigned long                                      bHitTarget : 1;                                   		// 0x0420 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 138490 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8103 );
 	};
 
 	float GetDamage ( );
@@ -185,8 +142,6 @@ public:
 	void Init ( struct FVector Direction );
 };
 
-UClass* ASFXProjectile_SalarianBlastSplitter_MP::pClassPointer = NULL;
-
 // Class sfxgamecontentdlc_con_mp5.SFXWeapon_Shotgun_Salarian_MP
 // 0x0030 (0x0E8C - 0x0E5C)
 class ASFXWeapon_Shotgun_Salarian_MP : public ASFXWeapon_Shotgun_Base
@@ -202,16 +157,9 @@ public:
 	class UWwiseEvent*                                 ChargedShotSound;                                 		// 0x0E84 (0x0004) [0x0000000000000000]              
 	float                                              ChargedDamageMultiplier;                          		// 0x0E88 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 138545 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8111 );
 	};
 
 	void PlayOwnedFireEffects ( unsigned char FireModeNum, struct FVector HitLocation );
@@ -223,8 +171,6 @@ public:
 	void InitializeWeapon ( );
 };
 
-UClass* ASFXWeapon_Shotgun_Salarian_MP::pClassPointer = NULL;
-
 
 #ifdef _MSC_VER
 	#pragma pack ( pop )
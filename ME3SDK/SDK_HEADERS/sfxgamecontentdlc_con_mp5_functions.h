@@ -29,10 +29,9 @@
 
 float USFXDamageType_SalarianBlast_MP::CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc )
 {
-	static UFunction* pFnCalculateDamageMultiplier = NULL;
-
+	UFunction* pFnCalculateDamageMultiplier = (UFunction*) SdkBindings::Get ( 4408 );
 	if ( ! pFnCalculateDamageMultiplier )
-		pFnCalculateDamageMultiplier = (UFunction*) UObject::GObjObjects()->Data[ 44579 ];
+		return {};
 
 	USFXDamageType_SalarianBlast_MP_execCalculateDamageMultiplier_Parms CalculateDamageMultiplier_Parms;
 
@@ -51,10 +50,9 @@ float USFXDamageType_SalarianBlast_MP::CalculateDamageMultiplier ( struct FDamag
 
 void USFXDamageType_SalarianBlast_MP::ResetDamageCalc ( struct FDamageCalculationAlgorithm* DamageCalc )
 {
-	static UFunction* pFnResetDamageCalc = NULL;
-
+	UFunction* pFnResetDamageCalc = (UFunction*) SdkBindings::Get ( 4407 );
 	if ( ! pFnResetDamageCalc )
-		pFnResetDamageCalc = (UFunction*) UObject::GObjObjects()->Data[ 44554 ];
+		return;
 
 	USFXDamageType_SalarianBlast_MP_execResetDamageCalc_Parms ResetDamageCalc_Parms;
 
@@ -73,10 +71,9 @@ void USFXDamageType_SalarianBlast_MP::ResetDamageCalc ( struct FDamageCalculatio
 
 bool USFXDamageType_SalarianBlast_MP::CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer )
 {
-	static UFunction* pFnCanPlayDeathEffect = NULL;
-
+	UFunction* pFnCanPlayDeathEffect = (UFunction*) SdkBindings::Get ( 4406 );
 	if ( ! pFnCanPlayDeathEffect )
-		pFnCanPlayDeathEffect = (UFunction*) UObject::GObjObjects()->Data[ 44550 ];
+		return {};
 
 	USFXDamageType_SalarianBlast_MP_execCanPlayDeathEffect_Parms CanPlayDeathEffect_Parms;
 	CanPlayDeathEffect_Parms.Target = Target;
@@ -95,10 +92,9 @@ bool USFXDamageType_SalarianBlast_MP::CanPlayDeathEffect ( class ABioPawn* Targe
 
 float USFXDamageType_SalarianShard_MP::CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc )
 {
-	static UFunction* pFnCalculateDamageMultiplier = NULL;
-
+	UFunction* pFnCalculateDamageMultiplier = (UFunction*) SdkBindings::Get ( 4408 );
 	if ( ! pFnCalculateDamageMultiplier )
-		pFnCalculateDamageMultiplier = (UFunction*) UObject::GObjObjects()->Data[ 44579 ];
+		return {};
 
 	USFXDamageType_SalarianShard_MP_execCalculateDamageMultiplier_Parms CalculateDamageMultiplier_Parms;
 
@@ -117,10 +113,9 @@ float USFXDamageType_SalarianShard_MP::CalculateDamageMultiplier ( struct FDamag
 
 void USFXDamageType_SalarianShard_MP::ResetDamageCalc ( struct FDamageCalculationAlgorithm* DamageCalc )
 {
-	static UFunction* pFnResetDamageCalc = NULL;
-
+	UFunction* pFnResetDamageCalc = (UFunction*) SdkBindings::Get ( 4407 );
 	if ( ! pFnResetDamageCalc )
-		pFnResetDamageCalc = (UFunction*) UObject::GObjObjects()->Data[ 44554 ];
+		return;
 
 	USFXDamageType_SalarianShard_MP_execResetDamageCalc_Parms ResetDamageCalc_Parms;
 
@@ -139,10 +134,9 @@ void USFXDamageType_SalarianShard_MP::ResetDamageCalc ( struct FDamageCalculatio
 
 bool USFXDamageType_SalarianShard_MP::CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer )
 {
-	static UFunction* pFnCanPlayDeathEffect = NULL;
-
+	UFunction* pFnCanPlayDeathEffect = (UFunction*) SdkBindings::Get ( 4406 );
 	if ( ! pFnCanPlayDeathEffect )
-		pFnCanPlayDeathEffect = (UFunction*) UObject::GObjObjects()->Data[ 44550 ];
+		return {};
 
 	USFXDamageType_SalarianShard_MP_execCanPlayDeathEffect_Parms CanPlayDeathEffect_Parms;
 	CanPlayDeathEffect_Parms.Target = Target;
@@ -161,10 +155,9 @@ bool USFXDamageType_SalarianShard_MP::CanPlayDeathEffect ( class ABioPawn* Targe
 
 void ASFXProjectile_SalarianBlast_MP::SpawnExplosionEffects ( struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnSpawnExplosionEffects = NULL;
-
+	UFunction* pFnSpawnExplosionEffects = (UFunction*) SdkBindings::Get ( 8094 );
 	if ( ! pFnSpawnExplosionEffects )
-		pFnSpawnExplosionEffects = (UFunction*) UObject::GObjObjects()->Data[ 138427 ];
+		return;
 
 	ASFXProjectile_SalarianBlast_MP_execSpawnExplosionEffects_Parms SpawnExplosionEffects_Parms;
 	memcpy ( &SpawnExplosionEffects_Parms.HitLocation, &HitLocation, 0xC );
@@ -180,10 +173,9 @@ void ASFXProjectile_SalarianBlast_MP::SpawnExplosionEffects ( struct FVector Hit
 
 void ASFXProjectile_SalarianBlast_MP::Init ( struct FVector Direction )
 {
-	static UFunction* pFnInit = NULL;
-
+	UFunction* pFnInit = (UFunction*) SdkBindings::Get ( 8093 );
 	if ( ! pFnInit )
-		pFnInit = (UFunction*) UObject::GObjObjects()->Data[ 138424 ];
+		return;
 
 	ASFXProjectile_SalarianBlast_MP_execInit_Parms Init_Parms;
 	memcpy ( &Init_Parms.Direction, &Direction, 0xC );
@@ -205,10 +197,9 @@ void ASFXProjectile_SalarianBlast_MP::Init ( struct FVector Direction )
 
 void ASFXProjectile_SalarianBlast_MP::DoImpact ( class AActor* InImpactedActor, class AController* InInstigatorController, float BaseDamage, float InDamageRadius, float Momentum, struct FVector HurtOrigin, unsigned long bFullDamage, struct FTraceHitInfo* HitInfo )
 {
-	static UFunction* pFnDoImpact = NULL;
-
+	UFunction* pFnDoImpact = (UFunction*) SdkBindings::Get ( 8092 );
 	if ( ! pFnDoImpact )
-		pFnDoImpact = (UFunction*) UObject::GObjObjects()->Data[ 138413 ];
+		return;
 
 	ASFXProjectile_SalarianBlast_MP_execDoImpact_Parms DoImpact_Parms;
 	DoImpact_Parms.InImpactedActor = InImpactedActor;
@@ -231,10 +222,9 @@ void ASFXProjectile_SalarianBlast_MP::DoImpact ( class AActor* InImpactedActor,
 
 void ASFXProjectile_SalarianBlastShard_MP::Recycle ( )
 {
-	static UFunction* pFnRecycle = NULL;
-
+	UFunction* pFnRecycle = (UFunction*) SdkBindings::Get ( 8102 );
 	if ( ! pFnRecycle )
-		pFnRecycle = (UFunction*) UObject::GObjObjects()->Data[ 138483 ];
+		return;
 
 	ASFXProjectile_SalarianBlastShard_MP_execRecycle_Parms Recycle_Parms;
 
@@ -249,10 +239,9 @@ void ASFXProjectile_SalarianBlastShard_MP::Recycle ( )
 
 void ASFXProjectile_SalarianBlastShard_MP::SpawnExplosionEffects ( struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnSpawnExplosionEffects = NULL;
-
+	UFunction* pFnSpawnExplosionEffects = (UFunction*) SdkBindings::Get ( 8101 );
 	if ( ! pFnSpawnExplosionEffects )
-		pFnSpawnExplosionEffects = (UFunction*) UObject::GObjObjects()->Data[ 138477 ];
+		return;
 
 	ASFXProjectile_SalarianBlastShard_MP_execSpawnExplosionEffects_Parms SpawnExplosionEffects_Parms;
 	memcpy ( &SpawnExplosionEffects_Parms.HitLocation, &HitLocation, 0xC );
@@ -269,10 +258,9 @@ void ASFXProjectile_SalarianBlastShard_MP::SpawnExplosionEffects ( struct FVecto
 
 void ASFXProjectile_SalarianBlastShard_MP::Explode ( struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnExplode = NULL;
-
+	UFunction* pFnExplode = (UFunction*) SdkBindings::Get ( 8100 );
 	if ( ! pFnExplode )
-		pFnExplode = (UFunction*) UObject::GObjObjects()->Data[ 138470 ];
+		return;
 
 	ASFXProjectile_SalarianBlastShard_MP_execExplode_Parms Explode_Parms;
 	memcpy ( &Explode_Parms.HitLocation, &HitLocation, 0xC );
@@ -290,10 +278,9 @@ void ASFXProjectile_SalarianBlastShard_MP::Explode ( struct FVector HitLocation,
 
 void ASFXProjectile_SalarianBlastShard_MP::ProcessTouch ( class AActor* Other, struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnProcessTouch = NULL;
-
+	UFunction* pFnProcessTouch = (UFunction*) SdkBindings::Get ( 8099 );
 	if ( ! pFnProcessTouch )
-		pFnProcessTouch = (UFunction*) UObject::GObjObjects()->Data[ 138463 ];
+		return;
 
 	ASFXProjectile_SalarianBlastShard_MP_execProcessTouch_Parms ProcessTouch_Parms;
 	ProcessTouch_Parms.Other = Other;
@@ -317,10 +304,9 @@ void ASFXProjectile_SalarianBlastShard_MP::ProcessTouch ( class AActor* Other, s
 
 void ASFXProjectile_SalarianBlastShard_MP::DoImpact ( class AActor* InImpactedActor, class AController* InInstigatorController, float BaseDamage, float InDamageRadius, float Momentum, struct FVector HurtOrigin, unsigned long bFullDamage, struct FTraceHitInfo* HitInfo )
 {
-	static UFunction* pFnDoImpact = NULL;
-
+	UFunction* pFnDoImpact = (UFunction*) SdkBindings::Get ( 8098 );
 	if ( ! pFnDoImpact )
-		pFnDoImpact = (UFunction*) UObject::GObjObjects()->Data[ 138452 ];
+		return;
 
 	ASFXProjectile_SalarianBlastShard_MP_execDoImpact_Parms DoImpact_Parms;
 	DoImpact_Parms.InImpactedActor = InImpactedActor;
@@ -343,10 +329,9 @@ void ASFXProjectile_SalarianBlastShard_MP::DoImpact ( class AActor* InImpactedAc
 
 void ASFXProjectile_SalarianBlastShard_MP::Detonate ( )
 {
-	static UFunction* pFnDetonate = NULL;
-
+	UFunction* pFnDetonate = (UFunction*) SdkBindings::Get ( 8097 );
 	if ( ! pFnDetonate )
-		pFnDetonate = (UFunction*) UObject::GObjObjects()->Data[ 138451 ];
+		return;
 
 	ASFXProjectile_SalarianBlastShard_MP_execDetonate_Parms Detonate_Parms;
 
@@ -360,10 +345,9 @@ void ASFXProjectile_SalarianBlastShard_MP::Detonate ( )
 
 void ASFXProjectile_SalarianBlastShard_MP::Init ( struct FVector Direction )
 {
-	static UFunction* pFnInit = NULL;
-
+	UFunction* pFnInit = (UFunction*) SdkBindings::Get ( 8096 );
 	if ( ! pFnInit )
-		pFnInit = (UFunction*) UObject::GObjObjects()->Data[ 138445 ];
+		return;
 
 	ASFXProjectile_SalarianBlastShard_MP_execInit_Parms Init_Parms;
 	memcpy ( &Init_Parms.Direction, &Direction, 0xC );
@@ -378,10 +362,9 @@ void ASFXProjectile_SalarianBlastShard_MP::Init ( struct FVector Direction )
 
 float ASFXProjectile_SalarianBlastSplitter_MP::GetDamage ( )
 {
-	static UFunction* pFnGetDamage = NULL;
-
+	UFunction* pFnGetDamage = (UFunction*) SdkBindings::Get ( 8110 );
 	if ( ! pFnGetDamage )
-		pFnGetDamage = (UFunction*) UObject::GObjObjects()->Data[ 138534 ];
+		return {};
 
 	ASFXProjectile_SalarianBlastSplitter_MP_execGetDamage_Parms GetDamage_Parms;
 
@@ -398,10 +381,9 @@ float ASFXProjectile_SalarianBlastSplitter_MP::GetDamage ( )
 
 void ASFXProjectile_SalarianBlastSplitter_MP::SpawnExplosionEffects ( struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnSpawnExplosionEffects = NULL;
-
+	UFunction* pFnSpawnExplosionEffects = (UFunction*) SdkBindings::Get ( 8109 );
 	if ( ! pFnSpawnExplosionEffects )
-		pFnSpawnExplosionEffects = (UFunction*) UObject::GObjObjects()->Data[ 138528 ];
+		return;
 
 	ASFXProjectile_SalarianBlastSplitter_MP_execSpawnExplosionEffects_Parms SpawnExplosionEffects_Parms;
 	memcpy ( &SpawnExplosionEffects_Parms.HitLocation, &HitLocation, 0xC );
@@ -418,10 +400,9 @@ void ASFXProjectile_SalarianBlastSplitter_MP::SpawnExplosionEffects ( struct FVe
 
 void ASFXProjectile_SalarianBlastSplitter_MP::Explode ( struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnExplode = NULL;
-
+	UFunction* pFnExplode = (UFunction*) SdkBindings::Get ( 8108 );
 	if ( ! pFnExplode )
-		pFnExplode = (UFunction*) UObject::GObjObjects()->Data[ 138512 ];
+		return;
 
 	ASFXProjectile_SalarianBlastSplitter_MP_execExplode_Parms Explode_Parms;
 	memcpy ( &Explode_Parms.HitLocation, &HitLocation, 0xC );
@@ -444,10 +425,9 @@ void ASFXProjectile_SalarianBlastSplitter_MP::Explode ( struct FVector HitLocati
 
 void ASFXProjectile_SalarianBlastSplitter_MP::DoImpact ( class AActor* InImpactedActor, class AController* InInstigatorController, float BaseDamage, float InDamageRadius, float Momentum, struct FVector HurtOrigin, unsigned long bFullDamage, struct FTraceHitInfo* HitInfo )
 {
-	static UFunction* pFnDoImpact = NULL;
-
+	UFunction* pFnDoImpact = (UFunction*) SdkBindings::Get ( 8107 );
 	if ( ! pFnDoImpact )
-		pFnDoImpact = (UFunction*) UObject::GObjObjects()->Data[ 138501 ];
+		return;
 
 	ASFXProjectile_SalarianBlastSplitter_MP_execDoImpact_Parms DoImpact_Parms;
 	DoImpact_Parms.InImpactedActor = InImpactedActor;
@@ -473,10 +453,9 @@ void ASFXProjectile_SalarianBlastSplitter_MP::DoImpact ( class AActor* InImpacte
 
 void ASFXProjectile_SalarianBlastSplitter_MP::ProcessTouch ( class AActor* Other, struct FVector HitLocation, struct FVector HitNormal )
 {
-	static UFunction* pFnProcessTouch = NULL;
-
+	UFunction* pFnProcessTouch = (UFunction*) SdkBindings::Get ( 8106 );
 	if ( ! pFnProcessTouch )
-		pFnProcessTouch = (UFunction*) UObject::GObjObjects()->Data[ 138496 ];
+		return;
 
 	ASFXProjectile_SalarianBlastSplitter_MP_execProcessTouch_Parms ProcessTouch_Parms;
 	ProcessTouch_Parms.Other = Other;
@@ -493,10 +472,9 @@ void ASFXProjectile_SalarianBlastSplitter_MP::ProcessTouch ( class AActor* Other
 
 void ASFXProjectile_SalarianBlastSplitter_MP::Tick ( float DeltaTime )
 {
-	static UFunction* pFnTick = NULL;
-
+	UFunction* pFnTick = (UFunction*) SdkBindings::Get ( 8105 );
 	if ( ! pFnTick )
-		pFnTick = (UFunction*) UObject::GObjObjects()->Data[ 138494 ];
+		return;
 
 	ASFXProjectile_SalarianBlastSplitter_MP_execTick_Parms Tick_Parms;
 	Tick_Parms.DeltaTime = DeltaTime;
@@ -511,10 +489,9 @@ void ASFXProjectile_SalarianBlastSplitter_MP::Tick ( float DeltaTime )
 
 void ASFXProjectile_SalarianBlastSplitter_MP::Init ( struct FVector Direction )
 {
-	static UFunction* pFnInit = NULL;
-
+	UFunction* pFnInit = (UFunction*) SdkBindings::Get ( 8104 );
 	if ( ! pFnInit )
-		pFnInit = (UFunction*) UObject::GObjObjects()->Data[ 138491 ];
+		return;
 
 	ASFXProjectile_SalarianBlastSplitter_MP_execInit_Parms Init_Parms;
 	memcpy ( &Init_Parms.Direction, &Direction, 0xC );
@@ -530,10 +507,9 @@ void ASFXProjectile_SalarianBlastSplitter_MP::Init ( struct FVector Direction )
 
 void ASFXWeapon_Shotgun_Salarian_MP::PlayOwnedFireEffects ( unsigned char FireModeNum, struct FVector HitLocation )
 {
-	static UFunction* pFnPlayOwnedFireEffects = NULL;
-
+	UFunction* pFnPlayOwnedFireEffects = (UFunction*) SdkBindings::Get ( 8118 );
 	if ( ! pFnPlayOwnedFireEffects )
-		pFnPlayOwnedFireEffects = (UFunction*) UObject::GObjObjects()->Data[ 138567 ];
+		return;
 
 	ASFXWeapon_Shotgun_Salarian_MP_execPlayOwnedFireEffects_Parms PlayOwnedFireEffects_Parms;
 	PlayOwnedFireEffects_Parms.FireModeNum = FireModeNum;
@@ -548,10 +524,9 @@ void ASFXWeapon_Shotgun_Salarian_MP::PlayOwnedFireEffects ( unsigned char FireMo
 
 void ASFXWeapon_Shotgun_Salarian_MP::StopChargeEffects ( )
 {
-	static UFunction* pFnStopChargeEffects = NULL;
-
+	UFunction* pFnStopChargeEffects = (UFunction*) SdkBindings::Get ( 8117 );
 	if ( ! pFnStopChargeEffects )
-		pFnStopChargeEffects = (UFunction*) UObject::GObjObjects()->Data[ 138565 ];
+		return;
 
 	ASFXWeapon_Shotgun_Salarian_MP_execStopChargeEffects_Parms StopChargeEffects_Parms;
 
@@ -564,10 +539,9 @@ void ASFXWeapon_Shotgun_Salarian_MP::StopChargeEffects ( )
 
 void ASFXWeapon_Shotgun_Salarian_MP::StartChargeEffects ( )
 {
-	static UFunction* pFnStartChargeEffects = NULL;
-
+	UFunction* pFnStartChargeEffects = (UFunction*) SdkBindings::Get ( 8116 );
 	if ( ! pFnStartChargeEffects )
-		pFnStartChargeEffects = (UFunction*) UObject::GObjObjects()->Data[ 138562 ];
+		return;
 
 	ASFXWeapon_Shotgun_Salarian_MP_execStartChargeEffects_Parms StartChargeEffects_Parms;
 
@@ -581,10 +555,9 @@ void ASFXWeapon_Shotgun_Salarian_MP::StartChargeEffects ( )
 
 class UClass* ASFXWeapon_Shotgun_Salarian_MP::GetProjectileClass ( )
 {
-	static UFunction* pFnGetProjectileClass = NULL;
-
+	UFunction* pFnGetProjectileClass = (UFunction*) SdkBindings::Get ( 8115 );
 	if ( ! pFnGetProjectileClass )
-		pFnGetProjectileClass = (UFunction*) UObject::GObjObjects()->Data[ 138560 ];
+		return {};
 
 	ASFXWeapon_Shotgun_Salarian_MP_execGetProjectileClass_Parms GetProjectileClass_Parms;
 
@@ -600,10 +573,9 @@ class UClass* ASFXWeapon_Shotgun_Salarian_MP::GetProjectileClass ( )
 
 float ASFXWeapon_Shotgun_Salarian_MP::GetFireModeBaseDamage ( )
 {
-	static UFunction* pFnGetFireModeBaseDamage = NULL;
-
+	UFunction* pFnGetFireModeBaseDamage = (UFunction*) SdkBindings::Get ( 8114 );
 	if ( ! pFnGetFireModeBaseDamage )
-		pFnGetFireModeBaseDamage = (UFunction*) UObject::GObjObjects()->Data[ 138557 ];
+		return {};
 
 	ASFXWeapon_Shotgun_Salarian_MP_execGetFireModeBaseDamage_Parms GetFireModeBaseDamage_Parms;
 
@@ -618,10 +590,9 @@ float ASFXWeapon_Shotgun_Salarian_MP::GetFireModeBaseDamage ( )
 
 void ASFXWeapon_Shotgun_Salarian_MP::HackLoadWeaponMods ( )
 {
-	static UFunction* pFnHackLoadWeaponMods = NULL;
-
+	UFunction* pFnHackLoadWeaponMods = (UFunction*) SdkBindings::Get ( 8113 );
 	if ( ! pFnHackLoadWeaponMods )
-		pFnHackLoadWeaponMods = (UFunction*) UObject::GObjObjects()->Data[ 138547 ];
+		return;
 
 	ASFXWeapon_Shotgun_Salarian_MP_execHackLoadWeaponMods_Parms HackLoadWeaponMods_Parms;
 
@@ -634,10 +605,9 @@ void ASFXWeapon_Shotgun_Salarian_MP::HackLoadWeaponMods ( )
 
 void ASFXWeapon_Shotgun_Salarian_MP::InitializeWeapon ( )
 {
-	static UFunction* pFnInitializeWeapon = NULL;
-
+	UFunction* pFnInitializeWeapon = (UFunction*) SdkBindings::Get ( 8112 );
 	if ( ! pFnInitializeWeapon )
-		pFnInitializeWeapon = (UFunction*) UObject::GObjObjects()->Data[ 138546 ];
+		return;
 
 	ASFXWeapon_Shotgun_Salarian_MP_execInitializeWeapon_Parms InitializeWeapon_Parms;
 
@@ -185,16 +185,9 @@ public:
 	unsigned long                                      bProcessConsumableCriticalError : 1;              		// 0x014C (0x0004) [0x0000000000000000] [0x00000004] 
 	unsigned long                                      m_bCreditPurchaseRetry : 1;                       		// 0x014C (0x0004) [0x0000000000000000] [0x00000008] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 105408 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5797 );
 	};
 
 	bool CanAffordNewStoreItems ( int OldCredits, int NewCredits );
@@ -249,8 +242,6 @@ public:
 	void OnPurchaseItemDelegate ( int nResult );
 };
 
-UClass* Usfxgawreinforcementmanager::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXGAWReinforcementBase
 // 0x0028 (0x0064 - 0x003C)
 class USFXGAWReinforcementBase : public UObject
@@ -261,16 +252,9 @@ public:
 	TArray< int >                                      RequiredDLCModuleIDs;                             		// 0x0054 (0x000C) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 	class Usfxgawreinforcementmanager*                 GAWManager;                                       		// 0x0060 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 105467 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5799 );
 	};
 
 	void ConsumeNonGameplayConsumable ( struct FName UniqueName, int VersionIdx );
@@ -288,8 +272,6 @@ public:
 	void Activate ( int UniqueId, float VersionIdx );
 };
 
-UClass* USFXGAWReinforcementBase::pClassPointer = NULL;
-
 // Class sfxgamempcontent.BioStartLocationMP
 // 0x0006 (0x01FC - 0x01F6)
 class ABioStartLocationMP : public AActor
@@ -297,22 +279,13 @@ class ABioStartLocationMP : public AActor
 public:
 	unsigned long                                      bPrimaryStart : 1;                                		// 0x01F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 105475 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 5800 );
 	};
 
 };
 
-UClass* ABioStartLocationMP::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxgawreinforcementmatchconsumable
 // 0x000C (0x0070 - 0x0064)
 class Usfxgawreinforcementmatchconsumable : public USFXGAWReinforcementBase
@@ -320,16 +293,9 @@ class Usfxgawreinforcementmatchconsumable : public USFXGAWReinforcementBase
 public:
 	TArray< struct FDescriptionTokens >                TokensList;                                       		// 0x0064 (0x000C) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107626 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6120 );
 	};
 
 	struct FString TrimTrailingZeroes_NoGear ( struct FString S, unsigned long KeepDecimal );
@@ -349,24 +315,15 @@ public:
 	class Asfxpri* GetPRI ( );
 };
 
-UClass* Usfxgawreinforcementmatchconsumable::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxtelemetryhooksmp
 // 0x0000 (0x00B0 - 0x00B0)
 class Usfxtelemetryhooksmp : public Usfxtelemetryhooks
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107720 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6129 );
 	};
 
 	void SendCachedDisconnectEvent ( );
@@ -394,24 +351,15 @@ public:
 	class USFXTelemetryGameSession* GetInstanceGameSession ( );
 };
 
-UClass* Usfxtelemetryhooksmp::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXGAWReinforcementInGameConsumable
 // 0x0000 (0x0064 - 0x0064)
 class USFXGAWReinforcementInGameConsumable : public USFXGAWReinforcementBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107955 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6172 );
 	};
 
 	void ConsumeNonGameplayConsumable ( struct FName UniqueName, int VersionIdx );
@@ -429,24 +377,15 @@ public:
 	void Activate ( int UniqueId, float VersionIdx );
 };
 
-UClass* USFXGAWReinforcementInGameConsumable::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXGAWReinforcementInventoryUnlock
 // 0x0000 (0x0064 - 0x0064)
 class USFXGAWReinforcementInventoryUnlock : public USFXGAWReinforcementBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107956 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6173 );
 	};
 
 	void ConsumeNonGameplayConsumable ( struct FName UniqueName, int VersionIdx );
@@ -464,24 +403,15 @@ public:
 	void Activate ( int UniqueId, float VersionIdx );
 };
 
-UClass* USFXGAWReinforcementInventoryUnlock::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXGAWReinforcementMatchConsumable_NonGameplay
 // 0x0000 (0x0070 - 0x0070)
 class USFXGAWReinforcementMatchConsumable_NonGameplay : public Usfxgawreinforcementmatchconsumable
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107957 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6174 );
 	};
 
 	struct FString TrimTrailingZeroes_NoGear ( struct FString S, unsigned long KeepDecimal );
@@ -501,24 +431,15 @@ public:
 	class Asfxpri* GetPRI ( );
 };
 
-UClass* USFXGAWReinforcementMatchConsumable_NonGameplay::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXGAWReinforcementPermanentUpgrade
 // 0x0000 (0x0064 - 0x0064)
 class USFXGAWReinforcementPermanentUpgrade : public USFXGAWReinforcementBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107958 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6175 );
 	};
 
 	void ConsumeNonGameplayConsumable ( struct FName UniqueName, int VersionIdx );
@@ -536,24 +457,15 @@ public:
 	void Activate ( int UniqueId, float VersionIdx );
 };
 
-UClass* USFXGAWReinforcementPermanentUpgrade::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXGAWReinforcementUnsaved
 // 0x0000 (0x0064 - 0x0064)
 class USFXGAWReinforcementUnsaved : public USFXGAWReinforcementBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107960 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6177 );
 	};
 
 	void ConsumeNonGameplayConsumable ( struct FName UniqueName, int VersionIdx );
@@ -571,24 +483,15 @@ public:
 	void Activate ( int UniqueId, float VersionIdx );
 };
 
-UClass* USFXGAWReinforcementUnsaved::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXGAWReinforcementCredits
 // 0x0000 (0x0064 - 0x0064)
 class USFXGAWReinforcementCredits : public USFXGAWReinforcementUnsaved
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107959 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6176 );
 	};
 
 	void ConsumeNonGameplayConsumable ( struct FName UniqueName, int VersionIdx );
@@ -606,8 +509,6 @@ public:
 	void Activate ( int UniqueId, float VersionIdx );
 };
 
-UClass* USFXGAWReinforcementCredits::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXGAWReinforcementKitUnlock
 // 0x000C (0x0070 - 0x0064)
 class USFXGAWReinforcementKitUnlock : public USFXGAWReinforcementBase
@@ -615,23 +516,14 @@ class USFXGAWReinforcementKitUnlock : public USFXGAWReinforcementBase
 public:
 	TArray< int >                                      XPBonus;                                          		// 0x0064 (0x000C) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107961 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6178 );
 	};
 
 	bool OnAwarded ( struct FCardInfoData* CardInfoOut, TArray< struct FCardInfoData >* ChosenCards );
 };
 
-UClass* USFXGAWReinforcementKitUnlock::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxcheatmanagernonnativemp
 // 0x000C (0x0170 - 0x0164)
 class Usfxcheatmanagernonnativemp : public Ubiocheatmanagernonnative
@@ -639,16 +531,9 @@ class Usfxcheatmanagernonnativemp : public Ubiocheatmanagernonnative
 public:
 	TArray< struct FString >                           DisplayPools;                                     		// 0x0164 (0x000C) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107962 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6179 );
 	};
 
 	void SetEmblem ( int nEmblemID );
@@ -685,8 +570,6 @@ public:
 	void SetKit ( struct FString KitName );
 };
 
-UClass* Usfxcheatmanagernonnativemp::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxprimp
 // 0x02A5 (0x0679 - 0x03D4)
 class Asfxprimp : public Asfxpri
@@ -737,16 +620,9 @@ public:
 	unsigned char                                      CombinedMapArray[ 0x1E ];                         		// 0x065A (0x001E) [0x0000000000000020]              ( CPF_Net )
 	unsigned char                                      NumKickVotesReceived;                             		// 0x0678 (0x0001) [0x0000000000000020]              ( CPF_Net )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 107967 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6181 );
 	};
 
 	void* GetPlayerChallengeTitle ( );
@@ -827,8 +703,6 @@ public:
 	void PostBeginPlay ( );
 };
 
-UClass* Asfxprimp::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXWave_Horde
 // 0x00EC (0x0148 - 0x005C)
 class USFXWave_Horde : public Usfxwave
@@ -879,16 +753,9 @@ public:
 	unsigned long                                      DisplayObjectivesForAllEnemies : 1;               		// 0x0144 (0x0004) [0x0000000000004000] [0x00000004] ( CPF_Config )
 	unsigned long                                      bWaveIsOver : 1;                                  		// 0x0144 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108035 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6195 );
 	};
 
 	void StartAutoBots ( );
@@ -922,24 +789,15 @@ public:
 	void InitializeWave ( class ASFXWaveManager* OwnerManager );
 };
 
-UClass* USFXWave_Horde::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXSquadCombatMP
 // 0x0000 (0x0228 - 0x0228)
 class ASFXSquadCombatMP : public ABioBaseSquad
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108037 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6196 );
 	};
 
 	void NotifyCombatZoneRemoved ( );
@@ -977,8 +835,6 @@ public:
 	bool RemoveMember ( class APawn* pPawn );
 };
 
-UClass* ASFXSquadCombatMP::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXPlayerSquadMP
 // 0x0008 (0x0230 - 0x0228)
 class ASFXPlayerSquadMP : public ABioBaseSquad
@@ -987,16 +843,9 @@ public:
 	class Asfxpawn_playermp*                           LeaderPawn;                                       		// 0x0228 (0x0004) [0x0000000000002020]              ( CPF_Net | CPF_Transient )
 	class Asfxpawn_playermp*                           LocalPawn;                                        		// 0x022C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108039 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6197 );
 	};
 
 	int eventAddMember ( class APawn* Pawn, unsigned long bCheckPlaypens );
@@ -1004,8 +853,6 @@ public:
 	void eventPostBeginPlay ( );
 };
 
-UClass* ASFXPlayerSquadMP::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxplayercontrollermp
 // 0x0080 (0x0C1C - 0x0B9C)
 class Asfxplayercontrollermp : public Asfxplayercontroller
@@ -1041,16 +888,9 @@ public:
 	unsigned long                                      AFKIgnoreWeaponAndPowerCheck : 1;                 		// 0x0C18 (0x0004) [0x0000000000004000] [0x00000020] ( CPF_Config )
 	unsigned long                                      IsAFKPostponementActive : 1;                      		// 0x0C18 (0x0004) [0x0000000000000000] [0x00000040] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108052 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6200 );
 	};
 
 	void Internal_ResetPlayerController ( struct FVector NewLocation );
@@ -1156,8 +996,6 @@ public:
 	void OnWeaponSelectFinishedDelegate ( );
 };
 
-UClass* Asfxplayercontrollermp::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxpawn_playermp
 // 0x009D (0x1288 - 0x11EB)
 class Asfxpawn_playermp : public ASFXPawn_Player
@@ -1192,16 +1030,9 @@ public:
 	unsigned long                                      bDisplayedKilledMessage : 1;                      		// 0x1284 (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned long                                      bIsProcessingFellOutOfWorld : 1;                  		// 0x1284 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108053 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6201 );
 	};
 
 	void HealthFailsafe ( );
@@ -1263,8 +1094,6 @@ public:
 	struct FString GetActorGameName ( );
 };
 
-UClass* Asfxpawn_playermp::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxwavecoordinator_hordeoperation
 // 0x00A8 (0x02B4 - 0x020C)
 class Asfxwavecoordinator_hordeoperation : public Asfxwavecoordinator
@@ -1300,16 +1129,9 @@ public:
 	unsigned long                                      ShouldStartNewWaves : 1;                          		// 0x02B0 (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned long                                      bForceOperationWave : 1;                          		// 0x02B0 (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108080 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6208 );
 	};
 
 	float GetObjectiveScoreBudget ( );
@@ -1356,8 +1178,6 @@ public:
 	void eventReplicatedEvent ( struct FName VarName );
 };
 
-UClass* Asfxwavecoordinator_hordeoperation::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxwave_operation
 // 0x00B0 (0x010C - 0x005C)
 class Usfxwave_operation : public Usfxwave
@@ -1396,16 +1216,9 @@ public:
 	unsigned long                                      SuccessfullySpawnedObjectives : 1;                		// 0x0108 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 	unsigned long                                      bScoreDistributed : 1;                            		// 0x0108 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108099 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6215 );
 	};
 
 	float GetCreditsReward ( );
@@ -1431,8 +1244,6 @@ public:
 	void InitializeWave ( class ASFXWaveManager* OwnerManager );
 };
 
-UClass* Usfxwave_operation::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxoperationobjective
 // 0x003A (0x0230 - 0x01F6)
 class Asfxoperationobjective : public AActor
@@ -1452,16 +1263,9 @@ public:
 	unsigned long                                      bActivated : 1;                                   		// 0x022C (0x0004) [0x0000000000000020] [0x00000002] ( CPF_Net )
 	unsigned long                                      bEnableCombatZone : 1;                            		// 0x022C (0x0004) [0x0000000000004000] [0x00000004] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108101 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6216 );
 	};
 
 	void PlayPlayerAcknowledgment ( float DelayTime, unsigned long PlayObjectiveBegin );
@@ -1484,8 +1288,6 @@ public:
 	void eventReplicatedEvent ( struct FName VarName );
 };
 
-UClass* Asfxoperationobjective::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXCustomizationInstance_PlayerMP
 // 0x001C (0x0058 - 0x003C)
 class USFXCustomizationInstance_PlayerMP : public USFXCustomizationInstance
@@ -1499,23 +1301,14 @@ public:
 	int                                                PhongID;                                          		// 0x0050 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 	int                                                SkinToneID;                                       		// 0x0054 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108155 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6224 );
 	};
 
 	void CustomizeMaterialInstance ( class UMaterialInstanceConstant* MIC );
 };
 
-UClass* USFXCustomizationInstance_PlayerMP::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXPlayerCustomizationMP
 // 0x0054 (0x0090 - 0x003C)
 class USFXPlayerCustomizationMP : public UObject
@@ -1529,38 +1322,22 @@ public:
 	TArray< struct FCustomizableElement >              EmissiveAppearances;                              		// 0x0078 (0x000C) [0x0000000000404001]              ( CPF_Edit | CPF_Config | CPF_NeedCtorLink )
 	TArray< struct FCustomizableElement >              SkinToneAppearances;                              		// 0x0084 (0x000C) [0x0000000000404001]              ( CPF_Edit | CPF_Config | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108160 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6226 );
 	};
 
 };
 
-UClass* USFXPlayerCustomizationMP::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXDamageType_ConsumableRocket
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_ConsumableRocket : public USFXDamageType_HeavyWeapon
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108175 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6227 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -1568,24 +1345,15 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_ConsumableRocket::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXDamageType_ConsumableRocketGib
 // 0x0000 (0x00E2 - 0x00E2)
 class USFXDamageType_ConsumableRocketGib : public USFXDamageType_ConsumableRocket
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108181 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6228 );
 	};
 
 	float CalculateDamageMultiplier ( struct FDamageCalculationAlgorithm* DamageCalc );
@@ -1593,8 +1361,6 @@ public:
 	bool CanPlayDeathEffect ( class ABioPawn* Target, class AController* Killer );
 };
 
-UClass* USFXDamageType_ConsumableRocketGib::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXDifficultyHandlerMP
 // 0x000A (0x00D4 - 0x00CA)
 class USFXDifficultyHandlerMP : public USFXDifficultyHandler
@@ -1603,24 +1369,15 @@ public:
 	int                                                CurrentWave;                                      		// 0x00CC (0x0004) [0x0000000000000000]              
 	int                                                MaxWave;                                          		// 0x00D0 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108185 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6229 );
 	};
 
 	void UpdateDifficultyScore ( );
 	void Update ( );
 };
 
-UClass* USFXDifficultyHandlerMP::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxgrimp
 // 0x0088 (0x0339 - 0x02B1)
 class Asfxgrimp : public ASFXGRI
@@ -1646,16 +1403,9 @@ public:
 	unsigned long                                      bIsMissionComplete : 1;                           		// 0x0334 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 	unsigned char                                      GameStatus;                                       		// 0x0338 (0x0001) [0x0000000000000020]              ( CPF_Net )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108190 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6232 );
 	};
 
 	void AddPRI ( class APlayerReplicationInfo* PRI );
@@ -1687,8 +1437,6 @@ public:
 	void eventReplicatedEvent ( struct FName VarName );
 };
 
-UClass* Asfxgrimp::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXWaveManager_Operation
 // 0x0034 (0x0240 - 0x020C)
 class ASFXWaveManager_Operation : public ASFXWaveManager
@@ -1702,16 +1450,9 @@ public:
 	int                                                MatchTimer;                                       		// 0x0238 (0x0004) [0x0000000000002020]              ( CPF_Net | CPF_Transient )
 	unsigned long                                      bSuccessfullyGeneratedWaveList : 1;               		// 0x023C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108211 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6234 );
 	};
 
 	void ForceMatchTimerSync ( int NewTime );
@@ -1724,8 +1465,6 @@ public:
 	void eventReplicatedEvent ( struct FName VarName );
 };
 
-UClass* ASFXWaveManager_Operation::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXEngagement_Annex
 // 0x0014 (0x0120 - 0x010C)
 class USFXEngagement_Annex : public Usfxwave_operation
@@ -1735,16 +1474,9 @@ public:
 	void*                                              srAnnexProgressTicker;                            		// 0x0118 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	void*                                              srAnnexProgressTickerPlural;                      		// 0x011C (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108366 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6256 );
 	};
 
 	struct FVector GetAnnexZoneLocation ( class Asfxoperationobjective* ObjectiveActor );
@@ -1752,8 +1484,6 @@ public:
 	void SetTimeLimit ( float TimeLimit );
 };
 
-UClass* USFXEngagement_Annex::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXEngagement_Assassination
 // 0x0004 (0x0110 - 0x010C)
 class USFXEngagement_Assassination : public Usfxwave_operation
@@ -1761,16 +1491,9 @@ class USFXEngagement_Assassination : public Usfxwave_operation
 public:
 	float                                              WaveInstructionVODelay;                           		// 0x010C (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108383 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6260 );
 	};
 
 	void PlayWaveStartedInstructionsVO ( );
@@ -1783,8 +1506,6 @@ public:
 	bool BeginWave ( );
 };
 
-UClass* USFXEngagement_Assassination::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXObjective_AssassinationBase
 // 0x000C (0x023C - 0x0230)
 class ASFXObjective_AssassinationBase : public Asfxoperationobjective
@@ -1794,24 +1515,15 @@ public:
 	int                                                NumTargetsKilled;                                 		// 0x0234 (0x0004) [0x0000000000000000]              
 	int                                                NumTargetsToKill;                                 		// 0x0238 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108391 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6264 );
 	};
 
 	void CurrentTargetDied ( );
 	void SetCurrentTarget ( class ABioPawn* Pawn );
 };
 
-UClass* ASFXObjective_AssassinationBase::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXEngagement_Disarm
 // 0x0034 (0x0140 - 0x010C)
 class USFXEngagement_Disarm : public Usfxwave_operation
@@ -1829,16 +1541,9 @@ public:
 	void*                                              srBombDisarmedTicker;                             		// 0x0138 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	class Asfxoperationobjective*                      ActiveBomb;                                       		// 0x013C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108419 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6272 );
 	};
 
 	void FinishWave ( );
@@ -1854,24 +1559,15 @@ public:
 	bool BeginWave ( );
 };
 
-UClass* USFXEngagement_Disarm::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXEngagement_Extraction
 // 0x0000 (0x010C - 0x010C)
 class USFXEngagement_Extraction : public Usfxwave_operation
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108459 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6285 );
 	};
 
 	float GetCreditsReward ( );
@@ -1897,8 +1593,6 @@ public:
 	void InitializeWave ( class ASFXWaveManager* OwnerManager );
 };
 
-UClass* USFXEngagement_Extraction::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXEngagement_Retrieve
 // 0x002C (0x0138 - 0x010C)
 class USFXEngagement_Retrieve : public Usfxwave_operation
@@ -1912,16 +1606,9 @@ public:
 	void*                                              srTeamScoreReward;                                		// 0x0130 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	void*                                              srObjectiveCompletedReward;                       		// 0x0134 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108464 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6286 );
 	};
 
 	void PickupDroppedOff ( class ASFXPawn_Player* Player, class Asfxoperationobjective* Pickup );
@@ -1933,8 +1620,6 @@ public:
 	bool BeginWave ( );
 };
 
-UClass* USFXEngagement_Retrieve::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXGameConfigMP
 // 0x0014 (0x00B4 - 0x00A0)
 class USFXGameConfigMP : public USFXGameConfig
@@ -1945,22 +1630,13 @@ public:
 	unsigned long                                      ShowMPProgressionScreens : 1;                     		// 0x00B0 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 	unsigned long                                      DisableDroppedAmmo : 1;                           		// 0x00B0 (0x0004) [0x0000000000004000] [0x00000002] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108493 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6294 );
 	};
 
 };
 
-UClass* USFXGameConfigMP::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxgameeffect_matchconsumablebase
 // 0x0012 (0x0074 - 0x0062)
 class Usfxgameeffect_matchconsumablebase : public USFXGameEffect
@@ -1971,24 +1647,15 @@ public:
 	class Asfxpawn*                                    OwnerPawn;                                        		// 0x006C (0x0004) [0x0000000000000000]              
 	unsigned long                                      ShouldDeactivateAfterMatch : 1;                   		// 0x0070 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108500 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6295 );
 	};
 
 	void Consume ( );
 	void OnApplied ( );
 };
 
-UClass* Usfxgameeffect_matchconsumablebase::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXGameInfoMP
 // 0x0064 (0x06B4 - 0x0650)
 class ASFXGameInfoMP : public ASFXGame
@@ -2017,16 +1684,9 @@ public:
 	unsigned long                                      bTriggeredLoad : 1;                               		// 0x06B0 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      bWaitingForPlayers : 1;                           		// 0x06B0 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108510 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6298 );
 	};
 
 	void ClearCrossLevelReferences ( );
@@ -2060,8 +1720,6 @@ public:
 	void PreBeginPlay ( );
 };
 
-UClass* ASFXGameInfoMP::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxhostmigrationmp
 // 0x0050 (0x0090 - 0x0040)
 class Usfxhostmigrationmp : public Usfxhostmigration
@@ -2069,16 +1727,9 @@ class Usfxhostmigrationmp : public Usfxhostmigration
 public:
 	struct FHMMatch                                    Match;                                            		// 0x0040 (0x0050) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108518 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6300 );
 	};
 
 	bool IsReadyToStartMatch ( int ConnectedPlayerCount );
@@ -2094,24 +1745,15 @@ public:
 	bool HasCompleteAndValidState ( class ASFXGRI* GRI );
 };
 
-UClass* Usfxhostmigrationmp::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxguimoviemp
 // 0x0000 (0x0261 - 0x0261)
 class Usfxguimoviemp : public USFXGUIMovie
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108693 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6336 );
 	};
 
 	void SetBackgroundAlpha ( float F );
@@ -2193,8 +1835,6 @@ public:
 	bool OnMovieClosedDelegate ( class USFXGUIMovie* i_ScreenToClose );
 };
 
-UClass* Usfxguimoviemp::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxgui_mpendofmatch
 // 0x0007 (0x0268 - 0x0261)
 class Usfxgui_mpendofmatch : public Usfxguimoviemp
@@ -2202,16 +1842,9 @@ class Usfxgui_mpendofmatch : public Usfxguimoviemp
 public:
 	class USFXMatchResultsData*                        OverallMatchResults;                              		// 0x0264 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108692 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6335 );
 	};
 
 	void* GetHintText ( );
@@ -2221,8 +1854,6 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* Usfxgui_mpendofmatch::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxgui_mppausemenu
 // 0x0023 (0x0284 - 0x0261)
 class Usfxgui_mppausemenu : public USFXGUIMovie
@@ -2237,16 +1868,9 @@ public:
 	void*                                              srChallengeText;                                  		// 0x027C (0x0004) [0x0000000000004000]              ( CPF_Config )
 	unsigned long                                      m_bShouldAnimate : 1;                             		// 0x0280 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108694 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6337 );
 	};
 
 	void ShowGamercard ( int ListIndex );
@@ -2267,24 +1891,15 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* Usfxgui_mppausemenu::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXGUI_MPOptions
 // 0x0000 (0x036E - 0x036E)
 class USFXGUI_MPOptions : public UBioSFHandler_Options
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108695 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6338 );
 	};
 
 	void SaveAndExit ( );
@@ -2320,24 +1935,15 @@ public:
 	void AddTelem ( unsigned char eOptionId, int Value, TArray< struct FTelemetryAttribute >* Attributes, struct FString* TelemetryKey );
 };
 
-UClass* USFXGUI_MPOptions::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXGUI_PCMPOptions
 // 0x0000 (0x03C8 - 0x03C8)
 class USFXGUI_PCMPOptions : public UBioSFHandler_PCOptions
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108696 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6339 );
 	};
 
 	void RevertSettings ( );
@@ -2363,8 +1969,6 @@ public:
 	void OnPanelAdded ( );
 };
 
-UClass* USFXGUI_PCMPOptions::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxgui_mpreinforcementsreveal
 // 0x0027 (0x0288 - 0x0261)
 class Usfxgui_mpreinforcementsreveal : public Usfxguimoviemp
@@ -2376,16 +1980,9 @@ public:
 	class Usfxgawreinforcementmanager*                 GAWManager;                                       		// 0x0280 (0x0004) [0x0000000000000000]              
 	unsigned long                                      bManualReveal : 1;                                		// 0x0284 (0x0004) [0x0000000000000000] [0x00000001] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108697 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6340 );
 	};
 
 	void AS_InitializeScreen ( unsigned long SkipIntro );
@@ -2404,8 +2001,6 @@ public:
 	void OnCloseCallback ( );
 };
 
-UClass* Usfxgui_mpreinforcementsreveal::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXGUI_MPHUD
 // 0x0137 (0x0398 - 0x0261)
 class USFXGUI_MPHUD : public Usfxguimoviemp
@@ -2459,16 +2054,9 @@ public:
 	unsigned long                                      DPadFadeOut : 1;                                  		// 0x0394 (0x0004) [0x0000000000004000] [0x00000200] ( CPF_Config )
 	unsigned long                                      m_bSpectatorHUDVisible : 1;                       		// 0x0394 (0x0004) [0x0000000000002000] [0x00000400] ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108698 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6341 );
 	};
 
 	void AS_HideSpectatorHUD ( );
@@ -2526,24 +2114,15 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* USFXGUI_MPHUD::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXHUDMP
 // 0x0000 (0x0544 - 0x0544)
 class ASFXHUDMP : public ABioHUD
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108708 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6342 );
 	};
 
 	void RemoveTraceAtIndex ( int nTrace );
@@ -2622,8 +2201,6 @@ public:
 	void ViewportDeProject ( class ULocalPlayer* LocalPlayerOwner, struct FVector ScreenLocation, struct FVector* OutLocation, struct FVector* OutDirection );
 };
 
-UClass* ASFXHUDMP::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxgameinfomp_lobby
 // 0x00A1 (0x0755 - 0x06B4)
 class Asfxgameinfomp_lobby : public ASFXGameInfoMP
@@ -2671,16 +2248,9 @@ public:
 	float                                              MatchStartTimer;                                  		// 0x0750 (0x0004) [0x0000000000000000]              
 	unsigned char                                      MatchTimerState;                                  		// 0x0754 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108709 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6343 );
 	};
 
 	bool IsMatchTimerRunning ( );
@@ -2718,8 +2288,6 @@ public:
 	class Asfxplayercontrollermp* GetPC ( );
 };
 
-UClass* Asfxgameinfomp_lobby::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxgrimp_lobby
 // 0x0073 (0x0324 - 0x02B1)
 class Asfxgrimp_lobby : public ASFXGRI
@@ -2747,16 +2315,9 @@ public:
 	unsigned long                                      bRandomMap : 1;                                   		// 0x0320 (0x0004) [0x0000000000000020] [0x00000001] ( CPF_Net )
 	unsigned long                                      bRandomEnemy : 1;                                 		// 0x0320 (0x0004) [0x0000000000000020] [0x00000002] ( CPF_Net )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108718 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6349 );
 	};
 
 	bool CanForceLastManReady ( );
@@ -2787,8 +2348,6 @@ public:
 	void PostBeginPlay ( );
 };
 
-UClass* Asfxgrimp_lobby::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxlobbyflow
 // 0x006C (0x0262 - 0x01F6)
 class Asfxlobbyflow : public AInfo
@@ -2822,16 +2381,9 @@ public:
 	unsigned char                                      CurrentLobbyTab;                                  		// 0x0260 (0x0001) [0x0000000000000000]              
 	unsigned char                                      PreviousSubScreen;                                		// 0x0261 (0x0001) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108780 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6364 );
 	};
 
 	bool OnMPChallengesScreenClosed ( class USFXGUIMovie* oMovie );
@@ -2922,8 +2474,6 @@ public:
 	class Asfxplayercontrollermp* GetPC ( );
 };
 
-UClass* Asfxlobbyflow::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxwavemanager_horde
 // 0x003C (0x0248 - 0x020C)
 class Asfxwavemanager_horde : public ASFXWaveManager
@@ -2936,16 +2486,9 @@ public:
 	struct FVector2D                                   WaveProgressionRange;                             		// 0x023C (0x0008) [0x0000000000004000]              ( CPF_Config )
 	int                                                MaxWaves;                                         		// 0x0244 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108795 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6367 );
 	};
 
 	void GenerateEnemySpawnPointList ( );
@@ -2956,8 +2499,6 @@ public:
 	void GeneratePotentialWaveList ( class UClass* SpecifiedWaveType );
 };
 
-UClass* Asfxwavemanager_horde::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxgui_mplobby
 // 0x008B (0x02EC - 0x0261)
 class Usfxgui_mplobby : public Usfxguimoviemp
@@ -2994,16 +2535,9 @@ public:
 	unsigned long                                      bPreviouslyCouldInteract : 1;                     		// 0x02E8 (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned long                                      m_bGAWRatingsError : 1;                           		// 0x02E8 (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108904 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6385 );
 	};
 
 	bool IsChallengeSystemEnabled ( );
@@ -3120,8 +2654,6 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* Usfxgui_mplobby::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxgui_mplobbystatusbars
 // 0x0027 (0x0288 - 0x0261)
 class Usfxgui_mplobbystatusbars : public Usfxguimoviemp
@@ -3139,16 +2671,9 @@ public:
 	unsigned long                                      m_bShouldShowMatchInfo : 1;                       		// 0x0284 (0x0004) [0x0000000000000000] [0x00000002] 
 	unsigned long                                      m_bCanSetReady : 1;                               		// 0x0284 (0x0004) [0x0000000000000000] [0x00000004] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108905 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6386 );
 	};
 
 	void AS_Refresh ( );
@@ -3164,8 +2689,6 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* Usfxgui_mplobbystatusbars::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxgui_mpappearance
 // 0x00EF (0x0350 - 0x0261)
 class Usfxgui_mpappearance : public Usfxguimoviemp
@@ -3216,16 +2739,9 @@ public:
 	unsigned long                                      m_bUpdatedInitialPawnTint : 1;                    		// 0x034C (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      m_bPCRotationEnabled : 1;                         		// 0x034C (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108906 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6387 );
 	};
 
 	void AS_SetFocusToNameField ( );
@@ -3303,8 +2819,6 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* Usfxgui_mpappearance::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxgui_mpselectkit
 // 0x004F (0x02B0 - 0x0261)
 class Usfxgui_mpselectkit : public Usfxguimoviemp
@@ -3332,16 +2846,9 @@ public:
 	unsigned long                                      bStartDeploy : 1;                                 		// 0x02AC (0x0004) [0x0000000000000000] [0x00000004] 
 	unsigned long                                      bForceOnlineConnection : 1;                       		// 0x02AC (0x0004) [0x0000000000004000] [0x00000008] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108907 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6388 );
 	};
 
 	void AS_StartPromotionEvent ( );
@@ -3376,8 +2883,6 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* Usfxgui_mpselectkit::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxgui_mpmatchresults
 // 0x003F (0x02A0 - 0x0261)
 class Usfxgui_mpmatchresults : public Usfxguimoviemp
@@ -3397,16 +2902,9 @@ public:
 	float                                              fIntroEventPauseTime;                             		// 0x0298 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	class USFXMatchResultsData*                        OverallMatchResults;                              		// 0x029C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108908 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6389 );
 	};
 
 	class USFXMatchResultsData* GetOverallMatchResults ( );
@@ -3455,8 +2953,6 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* Usfxgui_mpmatchresults::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxgui_mpmatchconsumables
 // 0x0033 (0x0294 - 0x0261)
 class Usfxgui_mpmatchconsumables : public Usfxguimoviemp
@@ -3469,16 +2965,9 @@ public:
 	class Usfxgawreinforcementmatchconsumable*         Consumables;                                      		// 0x028C (0x0004) [0x0000000000000000]              
 	unsigned long                                      bLiveIniForPatch4AreLive : 1;                     		// 0x0290 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108909 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6390 );
 	};
 
 	void AS_RefreshScreen ( );
@@ -3503,8 +2992,6 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* Usfxgui_mpmatchconsumables::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxgui_mpstore
 // 0x00B7 (0x0318 - 0x0261)
 class Usfxgui_mpstore : public Usfxguimoviemp
@@ -3547,16 +3034,9 @@ public:
 	unsigned long                                      bProcessPurchases : 1;                            		// 0x0314 (0x0004) [0x0000000000000000] [0x00000001] 
 	unsigned long                                      m_bPurchaseCompleted : 1;                         		// 0x0314 (0x0004) [0x0000000000000000] [0x00000002] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108910 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6391 );
 	};
 
 	void AS_RefreshPCPoints ( );
@@ -3615,8 +3095,6 @@ public:
 	void ShowNotification ( void* srText );
 };
 
-UClass* Usfxgui_mpstore::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxgui_mppromotion
 // 0x0017 (0x0278 - 0x0261)
 class Usfxgui_mppromotion : public Usfxguimoviemp
@@ -3626,16 +3104,9 @@ public:
 	int                                                PromotionalOfferID;                               		// 0x0270 (0x0004) [0x0000000000000000]              
 	class UTexture2D*                                  PromoTexture;                                     		// 0x0274 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108911 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6392 );
 	};
 
 	void AS_SetImageVisible ( unsigned long bVisible );
@@ -3649,8 +3120,6 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* Usfxgui_mppromotion::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxpowercustomactionmp_consumable
 // 0x0013 (0x06A8 - 0x0695)
 class Usfxpowercustomactionmp_consumable : public Usfxpowercustomaction
@@ -3660,16 +3129,9 @@ public:
 	int                                                UsedCount;                                        		// 0x06A0 (0x0004) [0x0000000000000000]              
 	int                                                CapacityBonus;                                    		// 0x06A4 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 108952 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6393 );
 	};
 
 	bool eventShouldUsePower ( class AActor* Target, struct FString* sOptionalInfo );
@@ -3682,24 +3144,15 @@ public:
 	void OnPowersLoaded ( );
 };
 
-UClass* Usfxpowercustomactionmp_consumable::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXVocalizationManagerMP
 // 0x0000 (0x0234 - 0x0234)
 class ASFXVocalizationManagerMP : public ASFXVocalizationManager
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 109200 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6437 );
 	};
 
 	void DrawActorLog ( class AActor* oActor, class ABioHUD* H );
@@ -3710,8 +3163,6 @@ public:
 	void eventPostBeginPlay ( );
 };
 
-UClass* ASFXVocalizationManagerMP::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxpowercustomactionmp_consumable_rocket
 // 0x0004 (0x06AC - 0x06A8)
 class Usfxpowercustomactionmp_consumable_rocket : public Usfxpowercustomactionmp_consumable
@@ -3719,16 +3170,9 @@ class Usfxpowercustomactionmp_consumable_rocket : public Usfxpowercustomactionmp
 public:
 	int                                                ServerConfirmedRocketCount;                       		// 0x06A8 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 109710 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6563 );
 	};
 
 	bool CanUsePower ( class AActor* oTarget );
@@ -3740,8 +3184,6 @@ public:
 	class ASFXHeavyWeapon* GetWeapon ( );
 };
 
-UClass* Usfxpowercustomactionmp_consumable_rocket::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxpowercustomactionmp_consumable_shield
 // 0x0020 (0x06C8 - 0x06A8)
 class Usfxpowercustomactionmp_consumable_shield : public Usfxpowercustomactionmp_consumable
@@ -3753,16 +3195,9 @@ public:
 	float                                              ShieldStrength;                                   		// 0x06C0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	float                                              DamageImmunityLength;                             		// 0x06C4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 109711 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6564 );
 	};
 
 	void RemoveImmunity ( );
@@ -3770,8 +3205,6 @@ public:
 	bool OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector HitLocation, struct FVector HitNormal );
 };
 
-UClass* Usfxpowercustomactionmp_consumable_shield::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxpowercustomactionmp_consumable_ammo
 // 0x0010 (0x06B8 - 0x06A8)
 class Usfxpowercustomactionmp_consumable_ammo : public Usfxpowercustomactionmp_consumable
@@ -3782,24 +3215,15 @@ public:
 	float                                              WeaponDamageBoost;                                		// 0x06B0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	float                                              WeaponDamageBoostDuration;                        		// 0x06B4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 109712 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6565 );
 	};
 
 	bool CanUsePower ( class AActor* oTarget );
 	bool OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector HitLocation, struct FVector HitNormal );
 };
 
-UClass* Usfxpowercustomactionmp_consumable_ammo::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxpowercustomactionmp_consumable_revive
 // 0x0004 (0x06AC - 0x06A8)
 class Usfxpowercustomactionmp_consumable_revive : public Usfxpowercustomactionmp_consumable
@@ -3807,16 +3231,9 @@ class Usfxpowercustomactionmp_consumable_revive : public Usfxpowercustomactionmp
 public:
 	float                                              ImmunityDuration;                                 		// 0x06A8 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 109713 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6566 );
 	};
 
 	bool OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector HitLocation, struct FVector HitNormal );
@@ -3825,8 +3242,6 @@ public:
 	bool InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced );
 };
 
-UClass* Usfxpowercustomactionmp_consumable_revive::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXHintSystemMP
 // 0x0007 (0x0134 - 0x012D)
 class USFXHintSystemMP : public UBioHintSystem
@@ -3843,16 +3258,9 @@ public:
 	unsigned long                                      bBeingRevived : 1;                                		// 0x0130 (0x0004) [0x0000000000000000] [0x00000100] 
 	unsigned long                                      bAnyWeaponHasAmmo : 1;                            		// 0x0130 (0x0004) [0x0000000000000000] [0x00000200] 
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 111210 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6941 );
 	};
 
 	bool Objective30sHint ( );
@@ -3868,24 +3276,15 @@ public:
 	void AddNotification_SupplyDrop ( struct FCardInfoData CardData );
 };
 
-UClass* USFXHintSystemMP::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXMessageMP
 // 0x0000 (0x0050 - 0x0050)
 class USFXMessageMP : public ULocalMessage
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 111398 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 6963 );
 	};
 
 	bool PartiallyDuplicates ( int Switch1, int Switch2, class UObject* OptionalObject1, class UObject* OptionalObject2 );
@@ -3900,8 +3299,6 @@ public:
 	void ClientReceive ( class APlayerController* P, int Switch, class APlayerReplicationInfo* RelatedPRI, class APlayerReplicationInfo* RelatedPRI01, class UObject* OptionalObject );
 };
 
-UClass* USFXMessageMP::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxweapon_heavy_consumablerocketlauncher
 // 0x003C (0x0E14 - 0x0DD8)
 class Asfxweapon_heavy_consumablerocketlauncher : public ASFXHeavyWeapon
@@ -3917,16 +3314,9 @@ public:
 	float                                              CappedDamageRadius;                               		// 0x0E0C (0x0004) [0x0000000000004000]              ( CPF_Config )
 	float                                              FarDamage;                                        		// 0x0E10 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 112567 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7220 );
 	};
 
 	void DropGun ( );
@@ -3945,8 +3335,6 @@ public:
 	int GetAmmoCountInMagazine ( );
 };
 
-UClass* Asfxweapon_heavy_consumablerocketlauncher::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXProjectile_ConsumableRocket
 // 0x000F (0x03A0 - 0x0391)
 class ASFXProjectile_ConsumableRocket : public ASFXProjectile_Explosive
@@ -3956,16 +3344,9 @@ public:
 	class UClass*                                      ScreenShakeClass;                                 		// 0x0398 (0x0004) [0x0000000000000002]              ( CPF_Const )
 	float                                              GibRange;                                         		// 0x039C (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 112970 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7287 );
 	};
 
 	bool ProjectileHurtRadius ( float InDamageAmount, float InDamageRadius, float Momentum, struct FVector HurtOrigin, struct FVector HitNormal );
@@ -3976,68 +3357,41 @@ public:
 	void Explode ( struct FVector HitLocation, struct FVector HitNormal );
 };
 
-UClass* ASFXProjectile_ConsumableRocket::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXRumble_ConsumableRocket
 // 0x0000 (0x0048 - 0x0048)
 class USFXRumble_ConsumableRocket : public USFXRumble_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 113021 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7294 );
 	};
 
 };
 
-UClass* USFXRumble_ConsumableRocket::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXShake_ConsumableRocket
 // 0x0000 (0x00BC - 0x00BC)
 class USFXShake_ConsumableRocket : public USFXShake_Power
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 113022 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7295 );
 	};
 
 };
 
-UClass* USFXShake_ConsumableRocket::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXWave_Horde_Cerberus
 // 0x0000 (0x0148 - 0x0148)
 class USFXWave_Horde_Cerberus : public USFXWave_Horde
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 113323 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7324 );
 	};
 
 	void StartAutoBots ( );
@@ -4071,24 +3425,15 @@ public:
 	void InitializeWave ( class ASFXWaveManager* OwnerManager );
 };
 
-UClass* USFXWave_Horde_Cerberus::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXWave_Horde_Geth
 // 0x0000 (0x0148 - 0x0148)
 class USFXWave_Horde_Geth : public USFXWave_Horde
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 113325 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7325 );
 	};
 
 	void StartAutoBots ( );
@@ -4122,24 +3467,15 @@ public:
 	void InitializeWave ( class ASFXWaveManager* OwnerManager );
 };
 
-UClass* USFXWave_Horde_Geth::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXWave_Horde_Reaper
 // 0x0000 (0x0148 - 0x0148)
 class USFXWave_Horde_Reaper : public USFXWave_Horde
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 113327 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7326 );
 	};
 
 	void StartAutoBots ( );
@@ -4173,52 +3509,32 @@ public:
 	void InitializeWave ( class ASFXWaveManager* OwnerManager );
 };
 
-UClass* USFXWave_Horde_Reaper::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXSeqAct_CloseMPWeaponSelect
 // 0x0000 (0x00B0 - 0x00B0)
 class USFXSeqAct_CloseMPWeaponSelect : public USequenceAction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 124889 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7429 );
 	};
 
 };
 
-UClass* USFXSeqAct_CloseMPWeaponSelect::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXCharacterClass_ContentMP
 // 0x0000 (0x01CD - 0x01CD)
 class USFXCharacterClass_ContentMP : public USFXCharacterClass_Content
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129152 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7837 );
 	};
 
 };
 
-UClass* USFXCharacterClass_ContentMP::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXCustomAction_PickupRetrieveObject
 // 0x0032 (0x0120 - 0x00EE)
 class USFXCustomAction_PickupRetrieveObject : public USFXCustomAction_SingleAnim
@@ -4235,16 +3551,9 @@ public:
 	int                                                BarColor;                                         		// 0x0118 (0x0004) [0x0000000000000000]              
 	int                                                BackgroundColor;                                  		// 0x011C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129154 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7838 );
 	};
 
 	void StopCustomAction ( );
@@ -4252,8 +3561,6 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_PickupRetrieveObject::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXCustomAction_DisarmObject
 // 0x0012 (0x0100 - 0x00EE)
 class USFXCustomAction_DisarmObject : public USFXCustomAction_SingleAnim
@@ -4264,16 +3571,9 @@ public:
 	class UWwiseEvent*                                 DisarmStart;                                      		// 0x00F8 (0x0004) [0x0000000000000000]              
 	class UWwiseEvent*                                 DisarmStop;                                       		// 0x00FC (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129155 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7839 );
 	};
 
 	void BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime );
@@ -4283,24 +3583,15 @@ public:
 	void StartCustomAction ( );
 };
 
-UClass* USFXCustomAction_DisarmObject::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXCustomAction_PlayerStaggerMP
 // 0x0000 (0x0101 - 0x0101)
 class USFXCustomAction_PlayerStaggerMP : public USFXCustomAction_PlayerStaggerImpact
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129156 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7840 );
 	};
 
 	void ActivateImpactEmitter ( struct FVector HitLocation, struct FVector HitNormal, struct FName BoneName, class UClass* DamageType );
@@ -4314,24 +3605,15 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXCustomAction_PlayerStaggerMP::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXPowerCustomActionMP_ConsumableAmmoPower
 // 0x0000 (0x0695 - 0x0695)
 class USFXPowerCustomActionMP_ConsumableAmmoPower : public Usfxpowercustomaction
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129157 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7841 );
 	};
 
 	int GetSaveGamePowerState ( );
@@ -4428,46 +3710,28 @@ public:
 	void eventGetUsedAnimNames ( TArray< struct FName >* UsedAnims );
 };
 
-UClass* USFXPowerCustomActionMP_ConsumableAmmoPower::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXCharacterClassMP_Adept
 // 0x0000 (0x01CD - 0x01CD)
 class USFXCharacterClassMP_Adept : public USFXCharacterClass_ContentMP
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129158 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7842 );
 	};
 
 };
 
-UClass* USFXCharacterClassMP_Adept::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxpowercustomactionmp_singularity
 // 0x0000 (0x08A0 - 0x08A0)
 class Usfxpowercustomactionmp_singularity : public Usfxpowercustomaction_singularity
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129160 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7843 );
 	};
 
 	void CombatEnded ( );
@@ -4500,24 +3764,15 @@ public:
 	void OnPowersLoaded ( );
 };
 
-UClass* Usfxpowercustomactionmp_singularity::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXPowerCustomActionMP_Warp
 // 0x0000 (0x074C - 0x074C)
 class USFXPowerCustomActionMP_Warp : public USFXPowerCustomAction_Warp
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129161 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7844 );
 	};
 
 	void PopulatePowerStatBarEvolves ( );
@@ -4531,24 +3786,15 @@ public:
 	float GetImpactDamage ( class AActor* oImpacted, class UClass** DamageType );
 };
 
-UClass* USFXPowerCustomActionMP_Warp::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXPowerCustomActionMP_Shockwave
 // 0x0000 (0x07F0 - 0x07F0)
 class USFXPowerCustomActionMP_Shockwave : public USFXPowerCustomAction_Shockwave
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129162 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7845 );
 	};
 
 	void PopulatePowerStatBarEvolves ( );
@@ -4564,8 +3810,6 @@ public:
 	class ASFXProjectile_PowerCustomAction* ReleaseProjectilePower ( );
 };
 
-UClass* USFXPowerCustomActionMP_Shockwave::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxpowercustomactionmp_passivebase
 // 0x00BB (0x0750 - 0x0695)
 class Usfxpowercustomactionmp_passivebase : public USFXPowerCustomAction_PassivePower
@@ -4583,16 +3827,9 @@ public:
 	float                                              Evolve_WeaponEncumbranceBonus;                    		// 0x0748 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	float                                              Evolve_WeaponDamageBonus2;                        		// 0x074C (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129164 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7847 );
 	};
 
 	void PopulatePowerStatBarEvolves ( );
@@ -4601,24 +3838,15 @@ public:
 	void ApplyGlobalBonus ( );
 };
 
-UClass* Usfxpowercustomactionmp_passivebase::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxpowercustomactionmp_humanpassive
 // 0x0000 (0x0750 - 0x0750)
 class Usfxpowercustomactionmp_humanpassive : public Usfxpowercustomactionmp_passivebase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129163 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7846 );
 	};
 
 	void PopulatePowerStatBarEvolves ( );
@@ -4627,8 +3855,6 @@ public:
 	void ApplyGlobalBonus ( );
 };
 
-UClass* Usfxpowercustomactionmp_humanpassive::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXPowerCustomActionMP_MeleePassiveBase
 // 0x0084 (0x08D4 - 0x0850)
 class USFXPowerCustomActionMP_MeleePassiveBase : public USFXPowerCustomAction_MeleePassivePower
@@ -4646,16 +3872,9 @@ public:
 	float                                              Evolve_CustomSpreeBonus;                          		// 0x08CC (0x0004) [0x0000000000004000]              ( CPF_Config )
 	float                                              Evolve_CustomSpreeDuration;                       		// 0x08D0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129167 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7850 );
 	};
 
 	void PopulatePowerStatBarEvolves ( );
@@ -4665,24 +3884,15 @@ public:
 	void ApplyGlobalBonus ( );
 };
 
-UClass* USFXPowerCustomActionMP_MeleePassiveBase::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXPowerCustomActionMP_HumanMeleePassiveBase
 // 0x0000 (0x08D4 - 0x08D4)
 class USFXPowerCustomActionMP_HumanMeleePassiveBase : public USFXPowerCustomActionMP_MeleePassiveBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129166 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7849 );
 	};
 
 	void PopulatePowerStatBarEvolves ( );
@@ -4692,24 +3902,15 @@ public:
 	void ApplyGlobalBonus ( );
 };
 
-UClass* USFXPowerCustomActionMP_HumanMeleePassiveBase::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXPowerCustomActionMP_HumanMeleePassive_Adept
 // 0x0000 (0x08D4 - 0x08D4)
 class USFXPowerCustomActionMP_HumanMeleePassive_Adept : public USFXPowerCustomActionMP_HumanMeleePassiveBase
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129165 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7848 );
 	};
 
 	void PopulatePowerStatBarEvolves ( );
@@ -4719,8 +3920,6 @@ public:
 	void ApplyGlobalBonus ( );
 };
 
-UClass* USFXPowerCustomActionMP_HumanMeleePassive_Adept::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxobjective_disarm_base
 // 0x0008 (0x0238 - 0x0230)
 class Asfxobjective_disarm_base : public Asfxoperationobjective
@@ -4729,16 +3928,9 @@ public:
 	class ABioPawn*                                    DisarmedBy;                                       		// 0x0230 (0x0004) [0x0000000000000020]              ( CPF_Net )
 	class USFXEngagement_Disarm*                       DisarmWave;                                       		// 0x0234 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129186 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7856 );
 	};
 
 	void SetOwningWave ( class Usfxwave_operation* NewOwner );
@@ -4750,8 +3942,6 @@ public:
 	void eventReplicatedEvent ( struct FName VarName );
 };
 
-UClass* Asfxobjective_disarm_base::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxobjective_retrieve_pickupobject
 // 0x0028 (0x0258 - 0x0230)
 class Asfxobjective_retrieve_pickupobject : public Asfxoperationobjective
@@ -4766,16 +3956,9 @@ public:
 	void*                                              SrPlayerCarryingObjectiveMarker;                  		// 0x0250 (0x0004) [0x0000000000000002]              ( CPF_Const )
 	class USFXEngagement_Retrieve*                     RetrieveWave;                                     		// 0x0254 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129208 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7860 );
 	};
 
 	void SetOwningWave ( class Usfxwave_operation* NewOwner );
@@ -4796,8 +3979,6 @@ public:
 	void eventReplicatedEvent ( struct FName VarName );
 };
 
-UClass* Asfxobjective_retrieve_pickupobject::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXGameEffect_MatchConsumable_AmmoPower
 // 0x001C (0x0090 - 0x0074)
 class USFXGameEffect_MatchConsumable_AmmoPower : public Usfxgameeffect_matchconsumablebase
@@ -4811,16 +3992,9 @@ public:
 	float                                              DamageFloatProbabilityModifier;                   		// 0x0088 (0x0004) [0x0000000000000000]              
 	class USFXPowerCustomActionMP_ConsumableAmmoPower* Power;                                            		// 0x008C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129213 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7861 );
 	};
 
 	void eventOnUpdate ( float DeltaSeconds );
@@ -4839,8 +4013,6 @@ public:
 	void OnApplied ( );
 };
 
-UClass* USFXGameEffect_MatchConsumable_AmmoPower::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXGameEffect_MatchConsumable_AmmoPower_Cryo
 // 0x0040 (0x00D0 - 0x0090)
 class USFXGameEffect_MatchConsumable_AmmoPower_Cryo : public USFXGameEffect_MatchConsumable_AmmoPower
@@ -4855,24 +4027,15 @@ public:
 	float                                              DelayedFreezeRandDuration;                        		// 0x00C8 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	float                                              DelayedFreezeStaticDuration;                      		// 0x00CC (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129264 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7876 );
 	};
 
 	void DoFreezeEffect ( class ABioPawn* oHitPawn, float fDelay, struct FVector HitLocation, struct FVector HitNormal, unsigned long bForced, unsigned char ForcedResistance );
 	void OnWeaponImpact ( class ASFXWeapon* Weapon, struct FImpactInfo Impact );
 };
 
-UClass* USFXGameEffect_MatchConsumable_AmmoPower_Cryo::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxgameeffect_matchconsumable_ammopower_disruptor
 // 0x0038 (0x00C8 - 0x0090)
 class Usfxgameeffect_matchconsumable_ammopower_disruptor : public USFXGameEffect_MatchConsumable_AmmoPower
@@ -4887,24 +4050,15 @@ public:
 	float                                              ShieldDamageMultiplier;                           		// 0x00C0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	float                                              LastStunTime;                                     		// 0x00C4 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129299 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7879 );
 	};
 
 	void StunEnemy ( class ABioPawn* oPawn );
 	void OnWeaponImpact ( class ASFXWeapon* Weapon, struct FImpactInfo Impact );
 };
 
-UClass* Usfxgameeffect_matchconsumable_ammopower_disruptor::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxobjective_retrieve_dropofflocation
 // 0x0020 (0x0250 - 0x0230)
 class Asfxobjective_retrieve_dropofflocation : public Asfxoperationobjective
@@ -4917,16 +4071,9 @@ public:
 	void*                                              SrDropOffObjectiveMarker;                         		// 0x0248 (0x0004) [0x0000000000000002]              ( CPF_Const )
 	class USFXEngagement_Retrieve*                     RetrieveWave;                                     		// 0x024C (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129356 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7889 );
 	};
 
 	void SetOwningWave ( class Usfxwave_operation* NewOwner );
@@ -4937,24 +4084,15 @@ public:
 	void PostBeginPlay ( );
 };
 
-UClass* Asfxobjective_retrieve_dropofflocation::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXPawn_PlayerMP_Adept
 // 0x0000 (0x1288 - 0x1288)
 class ASFXPawn_PlayerMP_Adept : public Asfxpawn_playermp
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 129452 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7912 );
 	};
 
 	void HealthFailsafe ( );
@@ -5016,24 +4154,15 @@ public:
 	struct FString GetActorGameName ( );
 };
 
-UClass* ASFXPawn_PlayerMP_Adept::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXPowerCustomActionMP_CryoBlast
 // 0x0000 (0x078C - 0x078C)
 class USFXPowerCustomActionMP_CryoBlast : public USFXPowerCustomAction_CryoBlast
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135757 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7968 );
 	};
 
 	void PopulatePowerStatBarEvolves ( );
@@ -5049,8 +4178,6 @@ public:
 	bool OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector HitLocation, struct FVector HitNormal );
 };
 
-UClass* USFXPowerCustomActionMP_CryoBlast::pClassPointer = NULL;
-
 // Class sfxgamempcontent.sfxpowercustomactionmp_turianpassive
 // 0x0038 (0x0788 - 0x0750)
 class Usfxpowercustomactionmp_turianpassive : public Usfxpowercustomactionmp_passivebase
@@ -5060,16 +4187,9 @@ public:
 	float                                              Evolve_WeaponStabilityBonus1;                     		// 0x0780 (0x0004) [0x0000000000004000]              ( CPF_Config )
 	float                                              Evolve_WeaponStabilityBonus2;                     		// 0x0784 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135759 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7970 );
 	};
 
 	void PopulatePowerStatBarEvolves ( );
@@ -5078,24 +4198,15 @@ public:
 	void ApplyGlobalBonus ( );
 };
 
-UClass* Usfxpowercustomactionmp_turianpassive::pClassPointer = NULL;
-
 // Class sfxgamempcontent.SFXPawn_PlayerMP_Soldier
 // 0x0000 (0x1288 - 0x1288)
 class ASFXPawn_PlayerMP_Soldier : public Asfxpawn_playermp
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 135983 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 8021 );
 	};
 
 	void HealthFailsafe ( );
@@ -5157,8 +4268,6 @@ public:
 	struct FString GetActorGameName ( );
 };
 
-UClass* ASFXPawn_PlayerMP_Soldier::pClassPointer = NULL;
-
 
 #ifdef _MSC_VER
 	#pragma pack ( pop )
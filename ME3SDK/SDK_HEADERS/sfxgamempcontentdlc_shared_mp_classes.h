@@ -73,16 +73,9 @@ class USFXEngagement_Retrieve_DLC_Base : public Usfxwave_operation
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 124467 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7393 );
 	};
 
 	float GetCreditsReward ( );
@@ -108,24 +101,15 @@ public:
 	void InitializeWave ( class ASFXWaveManager* OwnerManager );
 };
 
-UClass* USFXEngagement_Retrieve_DLC_Base::pClassPointer = NULL;
-
 // Class sfxgamempcontentdlc_shared_mp.SFXEngagement_MobileAnnex_Base
 // 0x0000 (0x010C - 0x010C)
 class USFXEngagement_MobileAnnex_Base : public Usfxwave_operation
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 124617 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7405 );
 	};
 
 	float GetCreditsReward ( );
@@ -151,30 +135,19 @@ public:
 	void InitializeWave ( class ASFXWaveManager* OwnerManager );
 };
 
-UClass* USFXEngagement_MobileAnnex_Base::pClassPointer = NULL;
-
 // Class sfxgamempcontentdlc_shared_mp.SFXSharedMP_ForcedReference
 // 0x0000 (0x003C - 0x003C)
 class USFXSharedMP_ForcedReference : public UObject
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 124737 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7423 );
 	};
 
 };
 
-UClass* USFXSharedMP_ForcedReference::pClassPointer = NULL;
-
 // Class sfxgamempcontentdlc_shared_mp.SFXGameInfoMP_Lobby_DLC
 // 0x000F (0x0764 - 0x0755)
 class ASFXGameInfoMP_Lobby_DLC : public Asfxgameinfomp_lobby
@@ -184,38 +157,22 @@ public:
 	class UClass*                                      MPChallengeUIClass;                               		// 0x075C (0x0004) [0x0000000000000000]              
 	class UGFxMovieInfo*                               MPChallengeUIScreen;                              		// 0x0760 (0x0004) [0x0000000000000000]              
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 124895 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7430 );
 	};
 
 };
 
-UClass* ASFXGameInfoMP_Lobby_DLC::pClassPointer = NULL;
-
 // Class sfxgamempcontentdlc_shared_mp.SFXGUI_MPWeaponSelection_DLC
 // 0x0000 (0x036A - 0x036A)
 class USFXGUI_MPWeaponSelection_DLC : public Usfxgui_weaponselection
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 124900 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7431 );
 	};
 
 	void AS_SetCurrentNameText ( struct FString sName );
@@ -285,8 +242,6 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* USFXGUI_MPWeaponSelection_DLC::pClassPointer = NULL;
-
 // Class sfxgamempcontentdlc_shared_mp.SFXGUI_MPChallenges
 // 0x00C5 (0x0326 - 0x0261)
 class USFXGUI_MPChallenges : public USFXGUIMovie
@@ -324,16 +279,9 @@ public:
 	unsigned char                                      m_eStartupTab;                                    		// 0x0324 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 	unsigned char                                      m_eCurrentTab;                                    		// 0x0325 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 124901 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7432 );
 	};
 
 	void eventAS_SetDetails ( struct FString sInfo, struct FString sImgResource );
@@ -376,24 +324,15 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* USFXGUI_MPChallenges::pClassPointer = NULL;
-
 // Class sfxgamempcontentdlc_shared_mp.SFXGUI_MPLobby_DLC
 // 0x0000 (0x02EC - 0x02EC)
 class USFXGUI_MPLobby_DLC : public Usfxgui_mplobby
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 124904 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7433 );
 	};
 
 	bool IsChallengeSystemEnabled ( );
@@ -510,8 +449,6 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* USFXGUI_MPLobby_DLC::pClassPointer = NULL;
-
 // Class sfxgamempcontentdlc_shared_mp.SFXGUI_MPSelectKit_DLC
 // 0x000C (0x02BC - 0x02B0)
 class USFXGUI_MPSelectKit_DLC : public Usfxgui_mpselectkit
@@ -519,16 +456,9 @@ class USFXGUI_MPSelectKit_DLC : public Usfxgui_mpselectkit
 public:
 	TArray< struct FKitDescriptionData >               KitDescriptions;                                  		// 0x02B0 (0x000C) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 124905 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7434 );
 	};
 
 	void ShowCharacterInfoCallback ( unsigned long bAPressed, int Context );
@@ -536,24 +466,15 @@ public:
 	void ShowCharacterInfo ( struct FString KitName );
 };
 
-UClass* USFXGUI_MPSelectKit_DLC::pClassPointer = NULL;
-
 // Class sfxgamempcontentdlc_shared_mp.SFXGUI_MPMatchConsumables_DLC
 // 0x0000 (0x0294 - 0x0294)
 class USFXGUI_MPMatchConsumables_DLC : public Usfxgui_mpmatchconsumables
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 124906 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7435 );
 	};
 
 	void AS_RefreshScreen ( );
@@ -578,24 +499,15 @@ public:
 	void eventOnStart ( );
 };
 
-UClass* USFXGUI_MPMatchConsumables_DLC::pClassPointer = NULL;
-
 // Class sfxgamempcontentdlc_shared_mp.SFXGUI_MPReinforcementsReveal_DLC
 // 0x0000 (0x0288 - 0x0288)
 class USFXGUI_MPReinforcementsReveal_DLC : public Usfxgui_mpreinforcementsreveal
 {
 public:
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 124921 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7436 );
 	};
 
 	void AS_InitializeScreen ( unsigned long SkipIntro );
@@ -614,8 +526,6 @@ public:
 	void OnCloseCallback ( );
 };
 
-UClass* USFXGUI_MPReinforcementsReveal_DLC::pClassPointer = NULL;
-
 // Class sfxgamempcontentdlc_shared_mp.SFXGAWReinforcementMatchConsumable_Gear
 // 0x000C (0x007C - 0x0070)
 class USFXGAWReinforcementMatchConsumable_Gear : public Usfxgawreinforcementmatchconsumable
@@ -623,16 +533,9 @@ class USFXGAWReinforcementMatchConsumable_Gear : public Usfxgawreinforcementmatc
 public:
 	TArray< struct FGearDescriptionTokens >            GearTokensList;                                   		// 0x0070 (0x000C) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 
-private:
-	static UClass* pClassPointer;
-
-public:
 	static UClass* StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = (UClass*) UObject::GObjObjects()->Data[ 124924 ];
-
-		return pClassPointer;
+		return (UClass*) SdkBindings::Get ( 7437 );
 	};
 
 	bool OnAwarded ( struct FCardInfoData* CardInfoOut, TArray< struct FCardInfoData >* ChosenCards );
@@ -645,8 +548,6 @@ public:
 	void PrepareCustomTokensForGearDescription ( struct FString CardUniqueName, int GearLevel );
 };
 
-UClass* USFXGAWReinforcementMatchConsumable_Gear::pClassPointer = NULL;
-
 
 #ifdef _MSC_VER
 	#pragma pack ( pop )
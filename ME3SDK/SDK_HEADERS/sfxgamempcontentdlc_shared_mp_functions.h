@@ -28,10 +28,9 @@
 
 float USFXEngagement_Retrieve_DLC_Base::GetCreditsReward ( )
 {
-	static UFunction* pFnGetCreditsReward = NULL;
-
+	UFunction* pFnGetCreditsReward = (UFunction*) SdkBindings::Get ( 6254 );
 	if ( ! pFnGetCreditsReward )
-		pFnGetCreditsReward = (UFunction*) UObject::GObjObjects()->Data[ 108350 ];
+		return {};
 
 	USFXEngagement_Retrieve_DLC_Base_execGetCreditsReward_Parms GetCreditsReward_Parms;
 
@@ -47,10 +46,9 @@ float USFXEngagement_Retrieve_DLC_Base::GetCreditsReward ( )
 
 float USFXEngagement_Retrieve_DLC_Base::GetCreditBudget ( )
 {
-	static UFunction* pFnGetCreditBudget = NULL;
-
+	UFunction* pFnGetCreditBudget = (UFunction*) SdkBindings::Get ( 6253 );
 	if ( ! pFnGetCreditBudget )
-		pFnGetCreditBudget = (UFunction*) UObject::GObjObjects()->Data[ 108348 ];
+		return {};
 
 	USFXEngagement_Retrieve_DLC_Base_execGetCreditBudget_Parms GetCreditBudget_Parms;
 
@@ -65,10 +63,9 @@ float USFXEngagement_Retrieve_DLC_Base::GetCreditBudget ( )
 
 void USFXEngagement_Retrieve_DLC_Base::DistributeObjectiveScore ( )
 {
-	static UFunction* pFnDistributeObjectiveScore = NULL;
-
+	UFunction* pFnDistributeObjectiveScore = (UFunction*) SdkBindings::Get ( 6252 );
 	if ( ! pFnDistributeObjectiveScore )
-		pFnDistributeObjectiveScore = (UFunction*) UObject::GObjObjects()->Data[ 108333 ];
+		return;
 
 	USFXEngagement_Retrieve_DLC_Base_execDistributeObjectiveScore_Parms DistributeObjectiveScore_Parms;
 
@@ -81,10 +78,9 @@ void USFXEngagement_Retrieve_DLC_Base::DistributeObjectiveScore ( )
 
 void USFXEngagement_Retrieve_DLC_Base::CountdownTimerExpired ( )
 {
-	static UFunction* pFnCountdownTimerExpired = NULL;
-
+	UFunction* pFnCountdownTimerExpired = (UFunction*) SdkBindings::Get ( 6251 );
 	if ( ! pFnCountdownTimerExpired )
-		pFnCountdownTimerExpired = (UFunction*) UObject::GObjObjects()->Data[ 108331 ];
+		return;
 
 	USFXEngagement_Retrieve_DLC_Base_execCountdownTimerExpired_Parms CountdownTimerExpired_Parms;
 
@@ -97,10 +93,9 @@ void USFXEngagement_Retrieve_DLC_Base::CountdownTimerExpired ( )
 
 void USFXEngagement_Retrieve_DLC_Base::CancelCountdownTimer ( )
 {
-	static UFunction* pFnCancelCountdownTimer = NULL;
-
+	UFunction* pFnCancelCountdownTimer = (UFunction*) SdkBindings::Get ( 6250 );
 	if ( ! pFnCancelCountdownTimer )
-		pFnCancelCountdownTimer = (UFunction*) UObject::GObjObjects()->Data[ 108329 ];
+		return;
 
 	USFXEngagement_Retrieve_DLC_Base_execCancelCountdownTimer_Parms CancelCountdownTimer_Parms;
 
@@ -113,10 +108,9 @@ void USFXEngagement_Retrieve_DLC_Base::CancelCountdownTimer ( )
 
 void USFXEngagement_Retrieve_DLC_Base::LocalPlayerTimeWarningHint ( )
 {
-	static UFunction* pFnLocalPlayerTimeWarningHint = NULL;
-
+	UFunction* pFnLocalPlayerTimeWarningHint = (UFunction*) SdkBindings::Get ( 6249 );
 	if ( ! pFnLocalPlayerTimeWarningHint )
-		pFnLocalPlayerTimeWarningHint = (UFunction*) UObject::GObjObjects()->Data[ 108326 ];
+		return;
 
 	USFXEngagement_Retrieve_DLC_Base_execLocalPlayerTimeWarningHint_Parms LocalPlayerTimeWarningHint_Parms;
 
@@ -130,10 +124,9 @@ void USFXEngagement_Retrieve_DLC_Base::LocalPlayerTimeWarningHint ( )
 
 void USFXEngagement_Retrieve_DLC_Base::SetTimeLimit ( float TimeLimit )
 {
-	static UFunction* pFnSetTimeLimit = NULL;
-
+	UFunction* pFnSetTimeLimit = (UFunction*) SdkBindings::Get ( 6248 );
 	if ( ! pFnSetTimeLimit )
-		pFnSetTimeLimit = (UFunction*) UObject::GObjObjects()->Data[ 108322 ];
+		return;
 
 	USFXEngagement_Retrieve_DLC_Base_execSetTimeLimit_Parms SetTimeLimit_Parms;
 	SetTimeLimit_Parms.TimeLimit = TimeLimit;
@@ -147,10 +140,9 @@ void USFXEngagement_Retrieve_DLC_Base::SetTimeLimit ( float TimeLimit )
 
 void USFXEngagement_Retrieve_DLC_Base::BeginWaveTimeLimit ( )
 {
-	static UFunction* pFnBeginWaveTimeLimit = NULL;
-
+	UFunction* pFnBeginWaveTimeLimit = (UFunction*) SdkBindings::Get ( 6247 );
 	if ( ! pFnBeginWaveTimeLimit )
-		pFnBeginWaveTimeLimit = (UFunction*) UObject::GObjObjects()->Data[ 108318 ];
+		return;
 
 	USFXEngagement_Retrieve_DLC_Base_execBeginWaveTimeLimit_Parms BeginWaveTimeLimit_Parms;
 
@@ -164,10 +156,9 @@ void USFXEngagement_Retrieve_DLC_Base::BeginWaveTimeLimit ( )
 
 void USFXEngagement_Retrieve_DLC_Base::DeactivateObjectiveCombatZone ( class AActor* ObjectiveActor )
 {
-	static UFunction* pFnDeactivateObjectiveCombatZone = NULL;
-
+	UFunction* pFnDeactivateObjectiveCombatZone = (UFunction*) SdkBindings::Get ( 6246 );
 	if ( ! pFnDeactivateObjectiveCombatZone )
-		pFnDeactivateObjectiveCombatZone = (UFunction*) UObject::GObjObjects()->Data[ 108313 ];
+		return;
 
 	USFXEngagement_Retrieve_DLC_Base_execDeactivateObjectiveCombatZone_Parms DeactivateObjectiveCombatZone_Parms;
 	DeactivateObjectiveCombatZone_Parms.ObjectiveActor = ObjectiveActor;
@@ -182,10 +173,9 @@ void USFXEngagement_Retrieve_DLC_Base::DeactivateObjectiveCombatZone ( class AAc
 
 void USFXEngagement_Retrieve_DLC_Base::ActivateObjectiveCombatZone ( class AActor* ObjectiveActor )
 {
-	static UFunction* pFnActivateObjectiveCombatZone = NULL;
-
+	UFunction* pFnActivateObjectiveCombatZone = (UFunction*) SdkBindings::Get ( 6244 );
 	if ( ! pFnActivateObjectiveCombatZone )
-		pFnActivateObjectiveCombatZone = (UFunction*) UObject::GObjObjects()->Data[ 108307 ];
+		return;
 
 	USFXEngagement_Retrieve_DLC_Base_execActivateObjectiveCombatZone_Parms ActivateObjectiveCombatZone_Parms;
 	ActivateObjectiveCombatZone_Parms.ObjectiveActor = ObjectiveActor;
@@ -200,10 +190,9 @@ void USFXEngagement_Retrieve_DLC_Base::ActivateObjectiveCombatZone ( class AActo
 
 void USFXEngagement_Retrieve_DLC_Base::PawnDestroyed ( class ABioPawn* Pawn )
 {
-	static UFunction* pFnPawnDestroyed = NULL;
-
+	UFunction* pFnPawnDestroyed = (UFunction*) SdkBindings::Get ( 6245 );
 	if ( ! pFnPawnDestroyed )
-		pFnPawnDestroyed = (UFunction*) UObject::GObjObjects()->Data[ 108312 ];
+		return;
 
 	USFXEngagement_Retrieve_DLC_Base_execPawnDestroyed_Parms PawnDestroyed_Parms;
 	PawnDestroyed_Parms.Pawn = Pawn;
@@ -218,10 +207,9 @@ void USFXEngagement_Retrieve_DLC_Base::PawnDestroyed ( class ABioPawn* Pawn )
 
 void USFXEngagement_Retrieve_DLC_Base::PawnRevived ( class ABioPawn* Pawn )
 {
-	static UFunction* pFnPawnRevived = NULL;
-
+	UFunction* pFnPawnRevived = (UFunction*) SdkBindings::Get ( 6243 );
 	if ( ! pFnPawnRevived )
-		pFnPawnRevived = (UFunction*) UObject::GObjObjects()->Data[ 108303 ];
+		return;
 
 	USFXEngagement_Retrieve_DLC_Base_execPawnRevived_Parms PawnRevived_Parms;
 	PawnRevived_Parms.Pawn = Pawn;
@@ -236,10 +224,9 @@ void USFXEngagement_Retrieve_DLC_Base::PawnRevived ( class ABioPawn* Pawn )
 
 void USFXEngagement_Retrieve_DLC_Base::PawnDowned ( class ABioPawn* Pawn )
 {
-	static UFunction* pFnPawnDowned = NULL;
-
+	UFunction* pFnPawnDowned = (UFunction*) SdkBindings::Get ( 6242 );
 	if ( ! pFnPawnDowned )
-		pFnPawnDowned = (UFunction*) UObject::GObjObjects()->Data[ 108299 ];
+		return;
 
 	USFXEngagement_Retrieve_DLC_Base_execPawnDowned_Parms PawnDowned_Parms;
 	PawnDowned_Parms.Pawn = Pawn;
@@ -253,10 +240,9 @@ void USFXEngagement_Retrieve_DLC_Base::PawnDowned ( class ABioPawn* Pawn )
 
 void USFXEngagement_Retrieve_DLC_Base::DetermineObjectivesToSpawn ( )
 {
-	static UFunction* pFnDetermineObjectivesToSpawn = NULL;
-
+	UFunction* pFnDetermineObjectivesToSpawn = (UFunction*) SdkBindings::Get ( 6241 );
 	if ( ! pFnDetermineObjectivesToSpawn )
-		pFnDetermineObjectivesToSpawn = (UFunction*) UObject::GObjObjects()->Data[ 108283 ];
+		return;
 
 	USFXEngagement_Retrieve_DLC_Base_execDetermineObjectivesToSpawn_Parms DetermineObjectivesToSpawn_Parms;
 
@@ -271,10 +257,9 @@ void USFXEngagement_Retrieve_DLC_Base::DetermineObjectivesToSpawn ( )
 
 float USFXEngagement_Retrieve_DLC_Base::RateEnemyStart ( class ANavigationPoint* NavPoint )
 {
-	static UFunction* pFnRateEnemyStart = NULL;
-
+	UFunction* pFnRateEnemyStart = (UFunction*) SdkBindings::Get ( 6240 );
 	if ( ! pFnRateEnemyStart )
-		pFnRateEnemyStart = (UFunction*) UObject::GObjObjects()->Data[ 108269 ];
+		return {};
 
 	USFXEngagement_Retrieve_DLC_Base_execRateEnemyStart_Parms RateEnemyStart_Parms;
 	RateEnemyStart_Parms.NavPoint = NavPoint;
@@ -290,10 +275,9 @@ float USFXEngagement_Retrieve_DLC_Base::RateEnemyStart ( class ANavigationPoint*
 
 void USFXEngagement_Retrieve_DLC_Base::DelayedFinishWave ( )
 {
-	static UFunction* pFnDelayedFinishWave = NULL;
-
+	UFunction* pFnDelayedFinishWave = (UFunction*) SdkBindings::Get ( 6239 );
 	if ( ! pFnDelayedFinishWave )
-		pFnDelayedFinishWave = (UFunction*) UObject::GObjObjects()->Data[ 108267 ];
+		return;
 
 	USFXEngagement_Retrieve_DLC_Base_execDelayedFinishWave_Parms DelayedFinishWave_Parms;
 
@@ -306,10 +290,9 @@ void USFXEngagement_Retrieve_DLC_Base::DelayedFinishWave ( )
 
 void USFXEngagement_Retrieve_DLC_Base::FinishWave ( )
 {
-	static UFunction* pFnFinishWave = NULL;
-
+	UFunction* pFnFinishWave = (UFunction*) SdkBindings::Get ( 6238 );
 	if ( ! pFnFinishWave )
-		pFnFinishWave = (UFunction*) UObject::GObjObjects()->Data[ 108262 ];
+		return;
 
 	USFXEngagement_Retrieve_DLC_Base_execFinishWave_Parms FinishWave_Parms;
 
@@ -322,10 +305,9 @@ void USFXEngagement_Retrieve_DLC_Base::FinishWave ( )
 
 void USFXEngagement_Retrieve_DLC_Base::ShowBeginWaveMessage ( )
 {
-	static UFunction* pFnShowBeginWaveMessage = NULL;
-
+	UFunction* pFnShowBeginWaveMessage = (UFunction*) SdkBindings::Get ( 6237 );
 	if ( ! pFnShowBeginWaveMessage )
-		pFnShowBeginWaveMessage = (UFunction*) UObject::GObjObjects()->Data[ 108260 ];
+		return;
 
 	USFXEngagement_Retrieve_DLC_Base_execShowBeginWaveMessage_Parms ShowBeginWaveMessage_Parms;
 
@@ -339,10 +321,9 @@ void USFXEngagement_Retrieve_DLC_Base::ShowBeginWaveMessage ( )
 
 bool USFXEngagement_Retrieve_DLC_Base::BeginWave ( )
 {
-	static UFunction* pFnBeginWave = NULL;
-
+	UFunction* pFnBeginWave = (UFunction*) SdkBindings::Get ( 6236 );
 	if ( ! pFnBeginWave )
-		pFnBeginWave = (UFunction*) UObject::GObjObjects()->Data[ 108216 ];
+		return {};
 
 	USFXEngagement_Retrieve_DLC_Base_execBeginWave_Parms BeginWave_Parms;
 
@@ -360,10 +341,9 @@ bool USFXEngagement_Retrieve_DLC_Base::BeginWave ( )
 
 int USFXEngagement_Retrieve_DLC_Base::ObjectiveSpawnSort ( class ASFXOperation_ObjectiveSpawnPoint* A, class ASFXOperation_ObjectiveSpawnPoint* B )
 {
-	static UFunction* pFnObjectiveSpawnSort = NULL;
-
+	UFunction* pFnObjectiveSpawnSort = (UFunction*) SdkBindings::Get ( 6235 );
 	if ( ! pFnObjectiveSpawnSort )
-		pFnObjectiveSpawnSort = (UFunction*) UObject::GObjObjects()->Data[ 108212 ];
+		return {};
 
 	USFXEngagement_Retrieve_DLC_Base_execObjectiveSpawnSort_Parms ObjectiveSpawnSort_Parms;
 	ObjectiveSpawnSort_Parms.A = A;
@@ -381,10 +361,9 @@ int USFXEngagement_Retrieve_DLC_Base::ObjectiveSpawnSort ( class ASFXOperation_O
 
 void USFXEngagement_Retrieve_DLC_Base::InitializeWave ( class ASFXWaveManager* OwnerManager )
 {
-	static UFunction* pFnInitializeWave = NULL;
-
+	UFunction* pFnInitializeWave = (UFunction*) SdkBindings::Get ( 6233 );
 	if ( ! pFnInitializeWave )
-		pFnInitializeWave = (UFunction*) UObject::GObjObjects()->Data[ 108207 ];
+		return;
 
 	USFXEngagement_Retrieve_DLC_Base_execInitializeWave_Parms InitializeWave_Parms;
 	InitializeWave_Parms.OwnerManager = OwnerManager;
@@ -399,10 +378,9 @@ void USFXEngagement_Retrieve_DLC_Base::InitializeWave ( class ASFXWaveManager* O
 
 float USFXEngagement_MobileAnnex_Base::GetCreditsReward ( )
 {
-	static UFunction* pFnGetCreditsReward = NULL;
-
+	UFunction* pFnGetCreditsReward = (UFunction*) SdkBindings::Get ( 6254 );
 	if ( ! pFnGetCreditsReward )
-		pFnGetCreditsReward = (UFunction*) UObject::GObjObjects()->Data[ 108350 ];
+		return {};
 
 	USFXEngagement_MobileAnnex_Base_execGetCreditsReward_Parms GetCreditsReward_Parms;
 
@@ -418,10 +396,9 @@ float USFXEngagement_MobileAnnex_Base::GetCreditsReward ( )
 
 float USFXEngagement_MobileAnnex_Base::GetCreditBudget ( )
 {
-	static UFunction* pFnGetCreditBudget = NULL;
-
+	UFunction* pFnGetCreditBudget = (UFunction*) SdkBindings::Get ( 6253 );
 	if ( ! pFnGetCreditBudget )
-		pFnGetCreditBudget = (UFunction*) UObject::GObjObjects()->Data[ 108348 ];
+		return {};
 
 	USFXEngagement_MobileAnnex_Base_execGetCreditBudget_Parms GetCreditBudget_Parms;
 
@@ -436,10 +413,9 @@ float USFXEngagement_MobileAnnex_Base::GetCreditBudget ( )
 
 void USFXEngagement_MobileAnnex_Base::DistributeObjectiveScore ( )
 {
-	static UFunction* pFnDistributeObjectiveScore = NULL;
-
+	UFunction* pFnDistributeObjectiveScore = (UFunction*) SdkBindings::Get ( 6252 );
 	if ( ! pFnDistributeObjectiveScore )
-		pFnDistributeObjectiveScore = (UFunction*) UObject::GObjObjects()->Data[ 108333 ];
+		return;
 
 	USFXEngagement_MobileAnnex_Base_execDistributeObjectiveScore_Parms DistributeObjectiveScore_Parms;
 
@@ -452,10 +428,9 @@ void USFXEngagement_MobileAnnex_Base::DistributeObjectiveScore ( )
 
 void USFXEngagement_MobileAnnex_Base::CountdownTimerExpired ( )
 {
-	static UFunction* pFnCountdownTimerExpired = NULL;
-
+	UFunction* pFnCountdownTimerExpired = (UFunction*) SdkBindings::Get ( 6251 );
 	if ( ! pFnCountdownTimerExpired )
-		pFnCountdownTimerExpired = (UFunction*) UObject::GObjObjects()->Data[ 108331 ];
+		return;
 
 	USFXEngagement_MobileAnnex_Base_execCountdownTimerExpired_Parms CountdownTimerExpired_Parms;
 
@@ -468,10 +443,9 @@ void USFXEngagement_MobileAnnex_Base::CountdownTimerExpired ( )
 
 void USFXEngagement_MobileAnnex_Base::CancelCountdownTimer ( )
 {
-	static UFunction* pFnCancelCountdownTimer = NULL;
-
+	UFunction* pFnCancelCountdownTimer = (UFunction*) SdkBindings::Get ( 6250 );
 	if ( ! pFnCancelCountdownTimer )
-		pFnCancelCountdownTimer = (UFunction*) UObject::GObjObjects()->Data[ 108329 ];
+		return;
 
 	USFXEngagement_MobileAnnex_Base_execCancelCountdownTimer_Parms CancelCountdownTimer_Parms;
 
@@ -484,10 +458,9 @@ void USFXEngagement_MobileAnnex_Base::CancelCountdownTimer ( )
 
 void USFXEngagement_MobileAnnex_Base::LocalPlayerTimeWarningHint ( )
 {
-	static UFunction* pFnLocalPlayerTimeWarningHint = NULL;
-
+	UFunction* pFnLocalPlayerTimeWarningHint = (UFunction*) SdkBindings::Get ( 6249 );
 	if ( ! pFnLocalPlayerTimeWarningHint )
-		pFnLocalPlayerTimeWarningHint = (UFunction*) UObject::GObjObjects()->Data[ 108326 ];
+		return;
 
 	USFXEngagement_MobileAnnex_Base_execLocalPlayerTimeWarningHint_Parms LocalPlayerTimeWarningHint_Parms;
 
@@ -501,10 +474,9 @@ void USFXEngagement_MobileAnnex_Base::LocalPlayerTimeWarningHint ( )
 
 void USFXEngagement_MobileAnnex_Base::SetTimeLimit ( float TimeLimit )
 {
-	static UFunction* pFnSetTimeLimit = NULL;
-
+	UFunction* pFnSetTimeLimit = (UFunction*) SdkBindings::Get ( 6248 );
 	if ( ! pFnSetTimeLimit )
-		pFnSetTimeLimit = (UFunction*) UObject::GObjObjects()->Data[ 108322 ];
+		return;
 
 	USFXEngagement_MobileAnnex_Base_execSetTimeLimit_Parms SetTimeLimit_Parms;
 	SetTimeLimit_Parms.TimeLimit = TimeLimit;
@@ -518,10 +490,9 @@ void USFXEngagement_MobileAnnex_Base::SetTimeLimit ( float TimeLimit )
 
 void USFXEngagement_MobileAnnex_Base::BeginWaveTimeLimit ( )
 {
-	static UFunction* pFnBeginWaveTimeLimit = NULL;
-
+	UFunction* pFnBeginWaveTimeLimit = (UFunction*) SdkBindings::Get ( 6247 );
 	if ( ! pFnBeginWaveTimeLimit )
-		pFnBeginWaveTimeLimit = (UFunction*) UObject::GObjObjects()->Data[ 108318 ];
+		return;
 
 	USFXEngagement_MobileAnnex_Base_execBeginWaveTimeLimit_Parms BeginWaveTimeLimit_Parms;
 
@@ -535,10 +506,9 @@ void USFXEngagement_MobileAnnex_Base::BeginWaveTimeLimit ( )
 
 void USFXEngagement_MobileAnnex_Base::DeactivateObjectiveCombatZone ( class AActor* ObjectiveActor )
 {
-	static UFunction* pFnDeactivateObjectiveCombatZone = NULL;
-
+	UFunction* pFnDeactivateObjectiveCombatZone = (UFunction*) SdkBindings::Get ( 6246 );
 	if ( ! pFnDeactivateObjectiveCombatZone )
-		pFnDeactivateObjectiveCombatZone = (UFunction*) UObject::GObjObjects()->Data[ 108313 ];
+		return;
 
 	USFXEngagement_MobileAnnex_Base_execDeactivateObjectiveCombatZone_Parms DeactivateObjectiveCombatZone_Parms;
 	DeactivateObjectiveCombatZone_Parms.ObjectiveActor = ObjectiveActor;
@@ -553,10 +523,9 @@ void USFXEngagement_MobileAnnex_Base::DeactivateObjectiveCombatZone ( class AAct
 
 void USFXEngagement_MobileAnnex_Base::ActivateObjectiveCombatZone ( class AActor* ObjectiveActor )
 {
-	static UFunction* pFnActivateObjectiveCombatZone = NULL;
-
+	UFunction* pFnActivateObjectiveCombatZone = (UFunction*) SdkBindings::Get ( 6244 );
 	if ( ! pFnActivateObjectiveCombatZone )
-		pFnActivateObjectiveCombatZone = (UFunction*) UObject::GObjObjects()->Data[ 108307 ];
+		return;
 
 	USFXEngagement_MobileAnnex_Base_execActivateObjectiveCombatZone_Parms ActivateObjectiveCombatZone_Parms;
 	ActivateObjectiveCombatZone_Parms.ObjectiveActor = ObjectiveActor;
@@ -571,10 +540,9 @@ void USFXEngagement_MobileAnnex_Base::ActivateObjectiveCombatZone ( class AActor
 
 void USFXEngagement_MobileAnnex_Base::PawnDestroyed ( class ABioPawn* Pawn )
 {
-	static UFunction* pFnPawnDestroyed = NULL;
-
+	UFunction* pFnPawnDestroyed = (UFunction*) SdkBindings::Get ( 6245 );
 	if ( ! pFnPawnDestroyed )
-		pFnPawnDestroyed = (UFunction*) UObject::GObjObjects()->Data[ 108312 ];
+		return;
 
 	USFXEngagement_MobileAnnex_Base_execPawnDestroyed_Parms PawnDestroyed_Parms;
 	PawnDestroyed_Parms.Pawn = Pawn;
@@ -589,10 +557,9 @@ void USFXEngagement_MobileAnnex_Base::PawnDestroyed ( class ABioPawn* Pawn )
 
 void USFXEngagement_MobileAnnex_Base::PawnRevived ( class ABioPawn* Pawn )
 {
-	static UFunction* pFnPawnRevived = NULL;
-
+	UFunction* pFnPawnRevived = (UFunction*) SdkBindings::Get ( 6243 );
 	if ( ! pFnPawnRevived )
-		pFnPawnRevived = (UFunction*) UObject::GObjObjects()->Data[ 108303 ];
+		return;
 
 	USFXEngagement_MobileAnnex_Base_execPawnRevived_Parms PawnRevived_Parms;
 	PawnRevived_Parms.Pawn = Pawn;
@@ -607,10 +574,9 @@ void USFXEngagement_MobileAnnex_Base::PawnRevived ( class ABioPawn* Pawn )
 
 void USFXEngagement_MobileAnnex_Base::PawnDowned ( class ABioPawn* Pawn )
 {
-	static UFunction* pFnPawnDowned = NULL;
-
+	UFunction* pFnPawnDowned = (UFunction*) SdkBindings::Get ( 6242 );
 	if ( ! pFnPawnDowned )
-		pFnPawnDowned = (UFunction*) UObject::GObjObjects()->Data[ 108299 ];
+		return;
 
 	USFXEngagement_MobileAnnex_Base_execPawnDowned_Parms PawnDowned_Parms;
 	PawnDowned_Parms.Pawn = Pawn;
@@ -624,10 +590,9 @@ void USFXEngagement_MobileAnnex_Base::PawnDowned ( class ABioPawn* Pawn )
 
 void USFXEngagement_MobileAnnex_Base::DetermineObjectivesToSpawn ( )
 {
-	static UFunction* pFnDetermineObjectivesToSpawn = NULL;
-
+	UFunction* pFnDetermineObjectivesToSpawn = (UFunction*) SdkBindings::Get ( 6241 );
 	if ( ! pFnDetermineObjectivesToSpawn )
-		pFnDetermineObjectivesToSpawn = (UFunction*) UObject::GObjObjects()->Data[ 108283 ];
+		return;
 
 	USFXEngagement_MobileAnnex_Base_execDetermineObjectivesToSpawn_Parms DetermineObjectivesToSpawn_Parms;
 
@@ -642,10 +607,9 @@ void USFXEngagement_MobileAnnex_Base::DetermineObjectivesToSpawn ( )
 
 float USFXEngagement_MobileAnnex_Base::RateEnemyStart ( class ANavigationPoint* NavPoint )
 {
-	static UFunction* pFnRateEnemyStart = NULL;
-
+	UFunction* pFnRateEnemyStart = (UFunction*) SdkBindings::Get ( 6240 );
 	if ( ! pFnRateEnemyStart )
-		pFnRateEnemyStart = (UFunction*) UObject::GObjObjects()->Data[ 108269 ];
+		return {};
 
 	USFXEngagement_MobileAnnex_Base_execRateEnemyStart_Parms RateEnemyStart_Parms;
 	RateEnemyStart_Parms.NavPoint = NavPoint;
@@ -661,10 +625,9 @@ float USFXEngagement_MobileAnnex_Base::RateEnemyStart ( class ANavigationPoint*
 
 void USFXEngagement_MobileAnnex_Base::DelayedFinishWave ( )
 {
-	static UFunction* pFnDelayedFinishWave = NULL;
-
+	UFunction* pFnDelayedFinishWave = (UFunction*) SdkBindings::Get ( 6239 );
 	if ( ! pFnDelayedFinishWave )
-		pFnDelayedFinishWave = (UFunction*) UObject::GObjObjects()->Data[ 108267 ];
+		return;
 
 	USFXEngagement_MobileAnnex_Base_execDelayedFinishWave_Parms DelayedFinishWave_Parms;
 
@@ -677,10 +640,9 @@ void USFXEngagement_MobileAnnex_Base::DelayedFinishWave ( )
 
 void USFXEngagement_MobileAnnex_Base::FinishWave ( )
 {
-	static UFunction* pFnFinishWave = NULL;
-
+	UFunction* pFnFinishWave = (UFunction*) SdkBindings::Get ( 6238 );
 	if ( ! pFnFinishWave )
-		pFnFinishWave = (UFunction*) UObject::GObjObjects()->Data[ 108262 ];
+		return;
 
 	USFXEngagement_MobileAnnex_Base_execFinishWave_Parms FinishWave_Parms;
 
@@ -693,10 +655,9 @@ void USFXEngagement_MobileAnnex_Base::FinishWave ( )
 
 void USFXEngagement_MobileAnnex_Base::ShowBeginWaveMessage ( )
 {
-	static UFunction* pFnShowBeginWaveMessage = NULL;
-
+	UFunction* pFnShowBeginWaveMessage = (UFunction*) SdkBindings::Get ( 6237 );
 	if ( ! pFnShowBeginWaveMessage )
-		pFnShowBeginWaveMessage = (UFunction*) UObject::GObjObjects()->Data[ 108260 ];
+		return;
 
 	USFXEngagement_MobileAnnex_Base_execShowBeginWaveMessage_Parms ShowBeginWaveMessage_Parms;
 
@@ -710,10 +671,9 @@ void USFXEngagement_MobileAnnex_Base::ShowBeginWaveMessage ( )
 
 bool USFXEngagement_MobileAnnex_Base::BeginWave ( )
 {
-	static UFunction* pFnBeginWave = NULL;
-
+	UFunction* pFnBeginWave = (UFunction*) SdkBindings::Get ( 6236 );
 	if ( ! pFnBeginWave )
-		pFnBeginWave = (UFunction*) UObject::GObjObjects()->Data[ 108216 ];
+		return {};
 
 	USFXEngagement_MobileAnnex_Base_execBeginWave_Parms BeginWave_Parms;
 
@@ -731,10 +691,9 @@ bool USFXEngagement_MobileAnnex_Base::BeginWave ( )
 
 int USFXEngagement_MobileAnnex_Base::ObjectiveSpawnSort ( class ASFXOperation_ObjectiveSpawnPoint* A, class ASFXOperation_ObjectiveSpawnPoint* B )
 {
-	static UFunction* pFnObjectiveSpawnSort = NULL;
-
+	UFunction* pFnObjectiveSpawnSort = (UFunction*) SdkBindings::Get ( 6235 );
 	if ( ! pFnObjectiveSpawnSort )
-		pFnObjectiveSpawnSort = (UFunction*) UObject::GObjObjects()->Data[ 108212 ];
+		return {};
 
 	USFXEngagement_MobileAnnex_Base_execObjectiveSpawnSort_Parms ObjectiveSpawnSort_Parms;
 	ObjectiveSpawnSort_Parms.A = A;
@@ -752,10 +711,9 @@ int USFXEngagement_MobileAnnex_Base::ObjectiveSpawnSort ( class ASFXOperation_Ob
 
 void USFXEngagement_MobileAnnex_Base::InitializeWave ( class ASFXWaveManager* OwnerManager )
 {
-	static UFunction* pFnInitializeWave = NULL;
-
+	UFunction* pFnInitializeWave = (UFunction*) SdkBindings::Get ( 6233 );
 	if ( ! pFnInitializeWave )
-		pFnInitializeWave = (UFunction*) UObject::GObjObjects()->Data[ 108207 ];
+		return;
 
 	USFXEngagement_MobileAnnex_Base_execInitializeWave_Parms InitializeWave_Parms;
 	InitializeWave_Parms.OwnerManager = OwnerManager;
@@ -770,10 +728,9 @@ void USFXEngagement_MobileAnnex_Base::InitializeWave ( class ASFXWaveManager* Ow
 
 void USFXGUI_MPWeaponSelection_DLC::AS_SetCurrentNameText ( struct FString sName )
 {
-	static UFunction* pFnAS_SetCurrentNameText = NULL;
-
+	UFunction* pFnAS_SetCurrentNameText = (UFunction*) SdkBindings::Get ( 5311 );
 	if ( ! pFnAS_SetCurrentNameText )
-		pFnAS_SetCurrentNameText = (UFunction*) UObject::GObjObjects()->Data[ 74512 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execAS_SetCurrentNameText_Parms AS_SetCurrentNameText_Parms;
 	memcpy ( &AS_SetCurrentNameText_Parms.sName, &sName, 0xC );
@@ -790,10 +747,9 @@ void USFXGUI_MPWeaponSelection_DLC::AS_SetCurrentNameText ( struct FString sName
 
 void USFXGUI_MPWeaponSelection_DLC::AS_TeamSetHenchman ( int nIndex, struct FString sName, struct FString sIconResource )
 {
-	static UFunction* pFnAS_TeamSetHenchman = NULL;
-
+	UFunction* pFnAS_TeamSetHenchman = (UFunction*) SdkBindings::Get ( 5312 );
 	if ( ! pFnAS_TeamSetHenchman )
-		pFnAS_TeamSetHenchman = (UFunction*) UObject::GObjObjects()->Data[ 74513 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execAS_TeamSetHenchman_Parms AS_TeamSetHenchman_Parms;
 	AS_TeamSetHenchman_Parms.nIndex = nIndex;
@@ -810,10 +766,9 @@ void USFXGUI_MPWeaponSelection_DLC::AS_TeamSetHenchman ( int nIndex, struct FStr
 
 void USFXGUI_MPWeaponSelection_DLC::AS_TeamSetVisible ( unsigned long bVisible )
 {
-	static UFunction* pFnAS_TeamSetVisible = NULL;
-
+	UFunction* pFnAS_TeamSetVisible = (UFunction*) SdkBindings::Get ( 5304 );
 	if ( ! pFnAS_TeamSetVisible )
-		pFnAS_TeamSetVisible = (UFunction*) UObject::GObjObjects()->Data[ 74498 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execAS_TeamSetVisible_Parms AS_TeamSetVisible_Parms;
 	AS_TeamSetVisible_Parms.bVisible = bVisible;
@@ -830,10 +785,9 @@ void USFXGUI_MPWeaponSelection_DLC::AS_TeamSetVisible ( unsigned long bVisible )
 
 void USFXGUI_MPWeaponSelection_DLC::AS_SetModDisplay ( int nDisplay, struct FString sName, struct FString sImgPath )
 {
-	static UFunction* pFnAS_SetModDisplay = NULL;
-
+	UFunction* pFnAS_SetModDisplay = (UFunction*) SdkBindings::Get ( 5330 );
 	if ( ! pFnAS_SetModDisplay )
-		pFnAS_SetModDisplay = (UFunction*) UObject::GObjObjects()->Data[ 74648 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execAS_SetModDisplay_Parms AS_SetModDisplay_Parms;
 	AS_SetModDisplay_Parms.nDisplay = nDisplay;
@@ -853,10 +807,9 @@ void USFXGUI_MPWeaponSelection_DLC::AS_SetModDisplay ( int nDisplay, struct FStr
 
 void USFXGUI_MPWeaponSelection_DLC::AS_AddWeaponStat ( struct FString sName, float fValue, float fBonus, float fCompare )
 {
-	static UFunction* pFnAS_AddWeaponStat = NULL;
-
+	UFunction* pFnAS_AddWeaponStat = (UFunction*) SdkBindings::Get ( 5328 );
 	if ( ! pFnAS_AddWeaponStat )
-		pFnAS_AddWeaponStat = (UFunction*) UObject::GObjObjects()->Data[ 74638 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execAS_AddWeaponStat_Parms AS_AddWeaponStat_Parms;
 	memcpy ( &AS_AddWeaponStat_Parms.sName, &sName, 0xC );
@@ -873,10 +826,9 @@ void USFXGUI_MPWeaponSelection_DLC::AS_AddWeaponStat ( struct FString sName, flo
 
 void USFXGUI_MPWeaponSelection_DLC::AS_ClearWeaponStatsDisplay ( )
 {
-	static UFunction* pFnAS_ClearWeaponStatsDisplay = NULL;
-
+	UFunction* pFnAS_ClearWeaponStatsDisplay = (UFunction*) SdkBindings::Get ( 5327 );
 	if ( ! pFnAS_ClearWeaponStatsDisplay )
-		pFnAS_ClearWeaponStatsDisplay = (UFunction*) UObject::GObjObjects()->Data[ 74636 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execAS_ClearWeaponStatsDisplay_Parms AS_ClearWeaponStatsDisplay_Parms;
 
@@ -890,10 +842,9 @@ void USFXGUI_MPWeaponSelection_DLC::AS_ClearWeaponStatsDisplay ( )
 
 void USFXGUI_MPWeaponSelection_DLC::AS_SelectWeaponSlot ( int nSlotID )
 {
-	static UFunction* pFnAS_SelectWeaponSlot = NULL;
-
+	UFunction* pFnAS_SelectWeaponSlot = (UFunction*) SdkBindings::Get ( 5307 );
 	if ( ! pFnAS_SelectWeaponSlot )
-		pFnAS_SelectWeaponSlot = (UFunction*) UObject::GObjObjects()->Data[ 74501 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execAS_SelectWeaponSlot_Parms AS_SelectWeaponSlot_Parms;
 	AS_SelectWeaponSlot_Parms.nSlotID = nSlotID;
@@ -908,10 +859,9 @@ void USFXGUI_MPWeaponSelection_DLC::AS_SelectWeaponSlot ( int nSlotID )
 
 void USFXGUI_MPWeaponSelection_DLC::AS_PerformPlayerWeaponAction ( unsigned long bAccept )
 {
-	static UFunction* pFnAS_PerformPlayerWeaponAction = NULL;
-
+	UFunction* pFnAS_PerformPlayerWeaponAction = (UFunction*) SdkBindings::Get ( 5352 );
 	if ( ! pFnAS_PerformPlayerWeaponAction )
-		pFnAS_PerformPlayerWeaponAction = (UFunction*) UObject::GObjObjects()->Data[ 74730 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execAS_PerformPlayerWeaponAction_Parms AS_PerformPlayerWeaponAction_Parms;
 	AS_PerformPlayerWeaponAction_Parms.bAccept = bAccept;
@@ -926,10 +876,9 @@ void USFXGUI_MPWeaponSelection_DLC::AS_PerformPlayerWeaponAction ( unsigned long
 
 void USFXGUI_MPWeaponSelection_DLC::AS_ScrollInfoText ( float fScroll )
 {
-	static UFunction* pFnAS_ScrollInfoText = NULL;
-
+	UFunction* pFnAS_ScrollInfoText = (UFunction*) SdkBindings::Get ( 5354 );
 	if ( ! pFnAS_ScrollInfoText )
-		pFnAS_ScrollInfoText = (UFunction*) UObject::GObjObjects()->Data[ 74735 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execAS_ScrollInfoText_Parms AS_ScrollInfoText_Parms;
 	AS_ScrollInfoText_Parms.fScroll = fScroll;
@@ -945,10 +894,9 @@ void USFXGUI_MPWeaponSelection_DLC::AS_ScrollInfoText ( float fScroll )
 
 void USFXGUI_MPWeaponSelection_DLC::AS_SetSlotNewIcon ( int nSlot, unsigned long bHasNew )
 {
-	static UFunction* pFnAS_SetSlotNewIcon = NULL;
-
+	UFunction* pFnAS_SetSlotNewIcon = (UFunction*) SdkBindings::Get ( 5337 );
 	if ( ! pFnAS_SetSlotNewIcon )
-		pFnAS_SetSlotNewIcon = (UFunction*) UObject::GObjObjects()->Data[ 74667 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execAS_SetSlotNewIcon_Parms AS_SetSlotNewIcon_Parms;
 	AS_SetSlotNewIcon_Parms.nSlot = nSlot;
@@ -965,10 +913,9 @@ void USFXGUI_MPWeaponSelection_DLC::AS_SetSlotNewIcon ( int nSlot, unsigned long
 
 void USFXGUI_MPWeaponSelection_DLC::AS_SetWeaponAction ( struct FString sButtonText, struct FString sCallbackMethodName )
 {
-	static UFunction* pFnAS_SetWeaponAction = NULL;
-
+	UFunction* pFnAS_SetWeaponAction = (UFunction*) SdkBindings::Get ( 5356 );
 	if ( ! pFnAS_SetWeaponAction )
-		pFnAS_SetWeaponAction = (UFunction*) UObject::GObjObjects()->Data[ 74765 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execAS_SetWeaponAction_Parms AS_SetWeaponAction_Parms;
 	memcpy ( &AS_SetWeaponAction_Parms.sButtonText, &sButtonText, 0xC );
@@ -991,10 +938,9 @@ void USFXGUI_MPWeaponSelection_DLC::AS_SetWeaponAction ( struct FString sButtonT
 
 void USFXGUI_MPWeaponSelection_DLC::AS_SetInventoryWeapon ( struct FString sName, struct FString sDesc, struct FString sIconResource, unsigned long bNew, int nNum, int nTotal, unsigned long bFlourish, struct FString sClassPath )
 {
-	static UFunction* pFnAS_SetInventoryWeapon = NULL;
-
+	UFunction* pFnAS_SetInventoryWeapon = (UFunction*) SdkBindings::Get ( 5336 );
 	if ( ! pFnAS_SetInventoryWeapon )
-		pFnAS_SetInventoryWeapon = (UFunction*) UObject::GObjObjects()->Data[ 74665 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execAS_SetInventoryWeapon_Parms AS_SetInventoryWeapon_Parms;
 	memcpy ( &AS_SetInventoryWeapon_Parms.sName, &sName, 0xC );
@@ -1019,10 +965,9 @@ void USFXGUI_MPWeaponSelection_DLC::AS_SetInventoryWeapon ( struct FString sName
 
 void USFXGUI_MPWeaponSelection_DLC::AS_SetWeightDisplay ( int nPercent, int nComparePct, struct FString sBarLabel, struct FString sInfo )
 {
-	static UFunction* pFnAS_SetWeightDisplay = NULL;
-
+	UFunction* pFnAS_SetWeightDisplay = (UFunction*) SdkBindings::Get ( 5347 );
 	if ( ! pFnAS_SetWeightDisplay )
-		pFnAS_SetWeightDisplay = (UFunction*) UObject::GObjObjects()->Data[ 74706 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execAS_SetWeightDisplay_Parms AS_SetWeightDisplay_Parms;
 	AS_SetWeightDisplay_Parms.nPercent = nPercent;
@@ -1043,10 +988,9 @@ void USFXGUI_MPWeaponSelection_DLC::AS_SetWeightDisplay ( int nPercent, int nCom
 
 void USFXGUI_MPWeaponSelection_DLC::AS_SetWeaponInfoDisplay ( struct FString sWeaponName, struct FString sWeaponDescription, struct FString sCategory, struct FString sWeaponImage )
 {
-	static UFunction* pFnAS_SetWeaponInfoDisplay = NULL;
-
+	UFunction* pFnAS_SetWeaponInfoDisplay = (UFunction*) SdkBindings::Get ( 5332 );
 	if ( ! pFnAS_SetWeaponInfoDisplay )
-		pFnAS_SetWeaponInfoDisplay = (UFunction*) UObject::GObjObjects()->Data[ 74655 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execAS_SetWeaponInfoDisplay_Parms AS_SetWeaponInfoDisplay_Parms;
 	memcpy ( &AS_SetWeaponInfoDisplay_Parms.sWeaponName, &sWeaponName, 0xC );
@@ -1072,10 +1016,9 @@ void USFXGUI_MPWeaponSelection_DLC::AS_SetWeaponInfoDisplay ( struct FString sWe
 
 void USFXGUI_MPWeaponSelection_DLC::AS_SetWeaponSlot ( int nSlotID, int nWeaponID, struct FString sWeaponIconResource, int nWeaponIconIndex, int nNumOtherWeapons, unsigned long bHaveNewWeapons, int nCategory, unsigned long bValid, unsigned long bHasModsAvailable )
 {
-	static UFunction* pFnAS_SetWeaponSlot = NULL;
-
+	UFunction* pFnAS_SetWeaponSlot = (UFunction*) SdkBindings::Get ( 5315 );
 	if ( ! pFnAS_SetWeaponSlot )
-		pFnAS_SetWeaponSlot = (UFunction*) UObject::GObjObjects()->Data[ 74558 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execAS_SetWeaponSlot_Parms AS_SetWeaponSlot_Parms;
 	AS_SetWeaponSlot_Parms.nSlotID = nSlotID;
@@ -1099,10 +1042,9 @@ void USFXGUI_MPWeaponSelection_DLC::AS_SetWeaponSlot ( int nSlotID, int nWeaponI
 
 void USFXGUI_MPWeaponSelection_DLC::AS_SetLoading ( unsigned long bLoading, struct FString sText )
 {
-	static UFunction* pFnAS_SetLoading = NULL;
-
+	UFunction* pFnAS_SetLoading = (UFunction*) SdkBindings::Get ( 5299 );
 	if ( ! pFnAS_SetLoading )
-		pFnAS_SetLoading = (UFunction*) UObject::GObjObjects()->Data[ 74488 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execAS_SetLoading_Parms AS_SetLoading_Parms;
 	AS_SetLoading_Parms.bLoading = bLoading;
@@ -1118,10 +1060,9 @@ void USFXGUI_MPWeaponSelection_DLC::AS_SetLoading ( unsigned long bLoading, stru
 
 void USFXGUI_MPWeaponSelection_DLC::AS_SetVisible ( unsigned long bVisible )
 {
-	static UFunction* pFnAS_SetVisible = NULL;
-
+	UFunction* pFnAS_SetVisible = (UFunction*) SdkBindings::Get ( 5355 );
 	if ( ! pFnAS_SetVisible )
-		pFnAS_SetVisible = (UFunction*) UObject::GObjObjects()->Data[ 74736 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execAS_SetVisible_Parms AS_SetVisible_Parms;
 	AS_SetVisible_Parms.bVisible = bVisible;
@@ -1138,10 +1079,9 @@ void USFXGUI_MPWeaponSelection_DLC::AS_SetVisible ( unsigned long bVisible )
 
 bool USFXGUI_MPWeaponSelection_DLC::eventHandleInputEvent ( unsigned char Event, float fValue )
 {
-	static UFunction* pFnHandleInputEvent = NULL;
-
+	UFunction* pFnHandleInputEvent = (UFunction*) SdkBindings::Get ( 5353 );
 	if ( ! pFnHandleInputEvent )
-		pFnHandleInputEvent = (UFunction*) UObject::GObjObjects()->Data[ 74731 ];
+		return {};
 
 	USFXGUI_MPWeaponSelection_DLC_eventHandleInputEvent_Parms HandleInputEvent_Parms;
 	HandleInputEvent_Parms.Event = Event;
@@ -1161,10 +1101,9 @@ bool USFXGUI_MPWeaponSelection_DLC::eventHandleInputEvent ( unsigned char Event,
 
 void USFXGUI_MPWeaponSelection_DLC::PlayerDiscardWeaponCallback ( class UBioSFHandler_MessageBox* oMsgBox, int nChoiceID, unsigned long bCancelled )
 {
-	static UFunction* pFnPlayerDiscardWeaponCallback = NULL;
-
+	UFunction* pFnPlayerDiscardWeaponCallback = (UFunction*) SdkBindings::Get ( 5351 );
 	if ( ! pFnPlayerDiscardWeaponCallback )
-		pFnPlayerDiscardWeaponCallback = (UFunction*) UObject::GObjObjects()->Data[ 74726 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execPlayerDiscardWeaponCallback_Parms PlayerDiscardWeaponCallback_Parms;
 	PlayerDiscardWeaponCallback_Parms.oMsgBox = oMsgBox;
@@ -1181,10 +1120,9 @@ void USFXGUI_MPWeaponSelection_DLC::PlayerDiscardWeaponCallback ( class UBioSFHa
 
 void USFXGUI_MPWeaponSelection_DLC::PromptPlayerToDiscardMPWeapon ( int nWeapCategory )
 {
-	static UFunction* pFnPromptPlayerToDiscardMPWeapon = NULL;
-
+	UFunction* pFnPromptPlayerToDiscardMPWeapon = (UFunction*) SdkBindings::Get ( 5350 );
 	if ( ! pFnPromptPlayerToDiscardMPWeapon )
-		pFnPromptPlayerToDiscardMPWeapon = (UFunction*) UObject::GObjObjects()->Data[ 74716 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execPromptPlayerToDiscardMPWeapon_Parms PromptPlayerToDiscardMPWeapon_Parms;
 	PromptPlayerToDiscardMPWeapon_Parms.nWeapCategory = nWeapCategory;
@@ -1200,10 +1138,9 @@ void USFXGUI_MPWeaponSelection_DLC::PromptPlayerToDiscardMPWeapon ( int nWeapCat
 
 bool USFXGUI_MPWeaponSelection_DLC::CheckCanEquipWeapon ( int nWeapCategory )
 {
-	static UFunction* pFnCheckCanEquipWeapon = NULL;
-
+	UFunction* pFnCheckCanEquipWeapon = (UFunction*) SdkBindings::Get ( 5349 );
 	if ( ! pFnCheckCanEquipWeapon )
-		pFnCheckCanEquipWeapon = (UFunction*) UObject::GObjObjects()->Data[ 74711 ];
+		return {};
 
 	USFXGUI_MPWeaponSelection_DLC_execCheckCanEquipWeapon_Parms CheckCanEquipWeapon_Parms;
 	CheckCanEquipWeapon_Parms.nWeapCategory = nWeapCategory;
@@ -1221,10 +1158,9 @@ bool USFXGUI_MPWeaponSelection_DLC::CheckCanEquipWeapon ( int nWeapCategory )
 
 bool USFXGUI_MPWeaponSelection_DLC::CheckCanSelectWeapon ( int nWeapCategory )
 {
-	static UFunction* pFnCheckCanSelectWeapon = NULL;
-
+	UFunction* pFnCheckCanSelectWeapon = (UFunction*) SdkBindings::Get ( 5348 );
 	if ( ! pFnCheckCanSelectWeapon )
-		pFnCheckCanSelectWeapon = (UFunction*) UObject::GObjObjects()->Data[ 74708 ];
+		return {};
 
 	USFXGUI_MPWeaponSelection_DLC_execCheckCanSelectWeapon_Parms CheckCanSelectWeapon_Parms;
 	CheckCanSelectWeapon_Parms.nWeapCategory = nWeapCategory;
@@ -1240,10 +1176,9 @@ bool USFXGUI_MPWeaponSelection_DLC::CheckCanSelectWeapon ( int nWeapCategory )
 
 void USFXGUI_MPWeaponSelection_DLC::UpdateWeaponEncumbranceDisplay ( )
 {
-	static UFunction* pFnUpdateWeaponEncumbranceDisplay = NULL;
-
+	UFunction* pFnUpdateWeaponEncumbranceDisplay = (UFunction*) SdkBindings::Get ( 5316 );
 	if ( ! pFnUpdateWeaponEncumbranceDisplay )
-		pFnUpdateWeaponEncumbranceDisplay = (UFunction*) UObject::GObjObjects()->Data[ 74559 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execUpdateWeaponEncumbranceDisplay_Parms UpdateWeaponEncumbranceDisplay_Parms;
 
@@ -1256,10 +1191,9 @@ void USFXGUI_MPWeaponSelection_DLC::UpdateWeaponEncumbranceDisplay ( )
 
 void USFXGUI_MPWeaponSelection_DLC::UpdateCurrentLoadoutWeaponDisplay ( )
 {
-	static UFunction* pFnUpdateCurrentLoadoutWeaponDisplay = NULL;
-
+	UFunction* pFnUpdateCurrentLoadoutWeaponDisplay = (UFunction*) SdkBindings::Get ( 5344 );
 	if ( ! pFnUpdateCurrentLoadoutWeaponDisplay )
-		pFnUpdateCurrentLoadoutWeaponDisplay = (UFunction*) UObject::GObjObjects()->Data[ 74679 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execUpdateCurrentLoadoutWeaponDisplay_Parms UpdateCurrentLoadoutWeaponDisplay_Parms;
 
@@ -1272,10 +1206,9 @@ void USFXGUI_MPWeaponSelection_DLC::UpdateCurrentLoadoutWeaponDisplay ( )
 
 void USFXGUI_MPWeaponSelection_DLC::SelectNextHenchman ( )
 {
-	static UFunction* pFnSelectNextHenchman = NULL;
-
+	UFunction* pFnSelectNextHenchman = (UFunction*) SdkBindings::Get ( 5346 );
 	if ( ! pFnSelectNextHenchman )
-		pFnSelectNextHenchman = (UFunction*) UObject::GObjObjects()->Data[ 74682 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execSelectNextHenchman_Parms SelectNextHenchman_Parms;
 
@@ -1288,10 +1221,9 @@ void USFXGUI_MPWeaponSelection_DLC::SelectNextHenchman ( )
 
 void USFXGUI_MPWeaponSelection_DLC::SelectPreviousHenchman ( )
 {
-	static UFunction* pFnSelectPreviousHenchman = NULL;
-
+	UFunction* pFnSelectPreviousHenchman = (UFunction*) SdkBindings::Get ( 5345 );
 	if ( ! pFnSelectPreviousHenchman )
-		pFnSelectPreviousHenchman = (UFunction*) UObject::GObjObjects()->Data[ 74680 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execSelectPreviousHenchman_Parms SelectPreviousHenchman_Parms;
 
@@ -1304,10 +1236,9 @@ void USFXGUI_MPWeaponSelection_DLC::SelectPreviousHenchman ( )
 
 void USFXGUI_MPWeaponSelection_DLC::WeaponSelectionItemChanged ( )
 {
-	static UFunction* pFnWeaponSelectionItemChanged = NULL;
-
+	UFunction* pFnWeaponSelectionItemChanged = (UFunction*) SdkBindings::Get ( 5339 );
 	if ( ! pFnWeaponSelectionItemChanged )
-		pFnWeaponSelectionItemChanged = (UFunction*) UObject::GObjObjects()->Data[ 74670 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execWeaponSelectionItemChanged_Parms WeaponSelectionItemChanged_Parms;
 
@@ -1322,10 +1253,9 @@ void USFXGUI_MPWeaponSelection_DLC::WeaponSelectionItemChanged ( )
 
 void USFXGUI_MPWeaponSelection_DLC::WeaponLoadoutItemChanged ( int nID, int nCategory )
 {
-	static UFunction* pFnWeaponLoadoutItemChanged = NULL;
-
+	UFunction* pFnWeaponLoadoutItemChanged = (UFunction*) SdkBindings::Get ( 5343 );
 	if ( ! pFnWeaponLoadoutItemChanged )
-		pFnWeaponLoadoutItemChanged = (UFunction*) UObject::GObjObjects()->Data[ 74676 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execWeaponLoadoutItemChanged_Parms WeaponLoadoutItemChanged_Parms;
 	WeaponLoadoutItemChanged_Parms.nID = nID;
@@ -1340,10 +1270,9 @@ void USFXGUI_MPWeaponSelection_DLC::WeaponLoadoutItemChanged ( int nID, int nCat
 
 void USFXGUI_MPWeaponSelection_DLC::SwitchToWeaponLoadout ( )
 {
-	static UFunction* pFnSwitchToWeaponLoadout = NULL;
-
+	UFunction* pFnSwitchToWeaponLoadout = (UFunction*) SdkBindings::Get ( 5342 );
 	if ( ! pFnSwitchToWeaponLoadout )
-		pFnSwitchToWeaponLoadout = (UFunction*) UObject::GObjObjects()->Data[ 74674 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execSwitchToWeaponLoadout_Parms SwitchToWeaponLoadout_Parms;
 
@@ -1356,10 +1285,9 @@ void USFXGUI_MPWeaponSelection_DLC::SwitchToWeaponLoadout ( )
 
 void USFXGUI_MPWeaponSelection_DLC::UndoWeaponSelection ( )
 {
-	static UFunction* pFnUndoWeaponSelection = NULL;
-
+	UFunction* pFnUndoWeaponSelection = (UFunction*) SdkBindings::Get ( 5341 );
 	if ( ! pFnUndoWeaponSelection )
-		pFnUndoWeaponSelection = (UFunction*) UObject::GObjObjects()->Data[ 74673 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execUndoWeaponSelection_Parms UndoWeaponSelection_Parms;
 
@@ -1372,10 +1300,9 @@ void USFXGUI_MPWeaponSelection_DLC::UndoWeaponSelection ( )
 
 void USFXGUI_MPWeaponSelection_DLC::SelectPrevWeapon ( )
 {
-	static UFunction* pFnSelectPrevWeapon = NULL;
-
+	UFunction* pFnSelectPrevWeapon = (UFunction*) SdkBindings::Get ( 5340 );
 	if ( ! pFnSelectPrevWeapon )
-		pFnSelectPrevWeapon = (UFunction*) UObject::GObjObjects()->Data[ 74671 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execSelectPrevWeapon_Parms SelectPrevWeapon_Parms;
 
@@ -1388,10 +1315,9 @@ void USFXGUI_MPWeaponSelection_DLC::SelectPrevWeapon ( )
 
 void USFXGUI_MPWeaponSelection_DLC::SelectNextWeapon ( )
 {
-	static UFunction* pFnSelectNextWeapon = NULL;
-
+	UFunction* pFnSelectNextWeapon = (UFunction*) SdkBindings::Get ( 5338 );
 	if ( ! pFnSelectNextWeapon )
-		pFnSelectNextWeapon = (UFunction*) UObject::GObjObjects()->Data[ 74668 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execSelectNextWeapon_Parms SelectNextWeapon_Parms;
 
@@ -1405,10 +1331,9 @@ void USFXGUI_MPWeaponSelection_DLC::SelectNextWeapon ( )
 
 void USFXGUI_MPWeaponSelection_DLC::DisplayCurrentWeaponSelection ( unsigned long bFlourish )
 {
-	static UFunction* pFnDisplayCurrentWeaponSelection = NULL;
-
+	UFunction* pFnDisplayCurrentWeaponSelection = (UFunction*) SdkBindings::Get ( 5335 );
 	if ( ! pFnDisplayCurrentWeaponSelection )
-		pFnDisplayCurrentWeaponSelection = (UFunction*) UObject::GObjObjects()->Data[ 74660 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execDisplayCurrentWeaponSelection_Parms DisplayCurrentWeaponSelection_Parms;
 	DisplayCurrentWeaponSelection_Parms.bFlourish = bFlourish;
@@ -1423,10 +1348,9 @@ void USFXGUI_MPWeaponSelection_DLC::DisplayCurrentWeaponSelection ( unsigned lon
 
 void USFXGUI_MPWeaponSelection_DLC::SwitchToWeaponSelection ( int nWeaponType )
 {
-	static UFunction* pFnSwitchToWeaponSelection = NULL;
-
+	UFunction* pFnSwitchToWeaponSelection = (UFunction*) SdkBindings::Get ( 5334 );
 	if ( ! pFnSwitchToWeaponSelection )
-		pFnSwitchToWeaponSelection = (UFunction*) UObject::GObjObjects()->Data[ 74657 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execSwitchToWeaponSelection_Parms SwitchToWeaponSelection_Parms;
 	SwitchToWeaponSelection_Parms.nWeaponType = nWeaponType;
@@ -1440,10 +1364,9 @@ void USFXGUI_MPWeaponSelection_DLC::SwitchToWeaponSelection ( int nWeaponType )
 
 void USFXGUI_MPWeaponSelection_DLC::MainMovieLoaded ( )
 {
-	static UFunction* pFnMainMovieLoaded = NULL;
-
+	UFunction* pFnMainMovieLoaded = (UFunction*) SdkBindings::Get ( 5333 );
 	if ( ! pFnMainMovieLoaded )
-		pFnMainMovieLoaded = (UFunction*) UObject::GObjObjects()->Data[ 74656 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execMainMovieLoaded_Parms MainMovieLoaded_Parms;
 
@@ -1458,10 +1381,9 @@ void USFXGUI_MPWeaponSelection_DLC::MainMovieLoaded ( )
 
 void USFXGUI_MPWeaponSelection_DLC::SetWeaponInfoDisplay ( int nWeaponIndex, int nCategory )
 {
-	static UFunction* pFnSetWeaponInfoDisplay = NULL;
-
+	UFunction* pFnSetWeaponInfoDisplay = (UFunction*) SdkBindings::Get ( 5331 );
 	if ( ! pFnSetWeaponInfoDisplay )
-		pFnSetWeaponInfoDisplay = (UFunction*) UObject::GObjObjects()->Data[ 74650 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execSetWeaponInfoDisplay_Parms SetWeaponInfoDisplay_Parms;
 	SetWeaponInfoDisplay_Parms.nWeaponIndex = nWeaponIndex;
@@ -1477,10 +1399,9 @@ void USFXGUI_MPWeaponSelection_DLC::SetWeaponInfoDisplay ( int nWeaponIndex, int
 
 void USFXGUI_MPWeaponSelection_DLC::SetWeaponModsDisplay ( int nWeapIndex )
 {
-	static UFunction* pFnSetWeaponModsDisplay = NULL;
-
+	UFunction* pFnSetWeaponModsDisplay = (UFunction*) SdkBindings::Get ( 5329 );
 	if ( ! pFnSetWeaponModsDisplay )
-		pFnSetWeaponModsDisplay = (UFunction*) UObject::GObjObjects()->Data[ 74640 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execSetWeaponModsDisplay_Parms SetWeaponModsDisplay_Parms;
 	SetWeaponModsDisplay_Parms.nWeapIndex = nWeapIndex;
@@ -1495,10 +1416,9 @@ void USFXGUI_MPWeaponSelection_DLC::SetWeaponModsDisplay ( int nWeapIndex )
 
 void USFXGUI_MPWeaponSelection_DLC::SetWeaponStatsDisplay ( int nWeapIndex )
 {
-	static UFunction* pFnSetWeaponStatsDisplay = NULL;
-
+	UFunction* pFnSetWeaponStatsDisplay = (UFunction*) SdkBindings::Get ( 5326 );
 	if ( ! pFnSetWeaponStatsDisplay )
-		pFnSetWeaponStatsDisplay = (UFunction*) UObject::GObjObjects()->Data[ 74628 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execSetWeaponStatsDisplay_Parms SetWeaponStatsDisplay_Parms;
 	SetWeaponStatsDisplay_Parms.nWeapIndex = nWeapIndex;
@@ -1512,10 +1432,9 @@ void USFXGUI_MPWeaponSelection_DLC::SetWeaponStatsDisplay ( int nWeapIndex )
 
 void USFXGUI_MPWeaponSelection_DLC::RestorePowerBonuses ( )
 {
-	static UFunction* pFnRestorePowerBonuses = NULL;
-
+	UFunction* pFnRestorePowerBonuses = (UFunction*) SdkBindings::Get ( 5323 );
 	if ( ! pFnRestorePowerBonuses )
-		pFnRestorePowerBonuses = (UFunction*) UObject::GObjObjects()->Data[ 74587 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execRestorePowerBonuses_Parms RestorePowerBonuses_Parms;
 
@@ -1528,10 +1447,9 @@ void USFXGUI_MPWeaponSelection_DLC::RestorePowerBonuses ( )
 
 void USFXGUI_MPWeaponSelection_DLC::MakeLoadoutsActive ( )
 {
-	static UFunction* pFnMakeLoadoutsActive = NULL;
-
+	UFunction* pFnMakeLoadoutsActive = (UFunction*) SdkBindings::Get ( 5297 );
 	if ( ! pFnMakeLoadoutsActive )
-		pFnMakeLoadoutsActive = (UFunction*) UObject::GObjObjects()->Data[ 74485 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execMakeLoadoutsActive_Parms MakeLoadoutsActive_Parms;
 
@@ -1544,10 +1462,9 @@ void USFXGUI_MPWeaponSelection_DLC::MakeLoadoutsActive ( )
 
 void USFXGUI_MPWeaponSelection_DLC::ApplyWeaponLoadout ( )
 {
-	static UFunction* pFnApplyWeaponLoadout = NULL;
-
+	UFunction* pFnApplyWeaponLoadout = (UFunction*) SdkBindings::Get ( 5322 );
 	if ( ! pFnApplyWeaponLoadout )
-		pFnApplyWeaponLoadout = (UFunction*) UObject::GObjObjects()->Data[ 74586 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execApplyWeaponLoadout_Parms ApplyWeaponLoadout_Parms;
 
@@ -1560,10 +1477,9 @@ void USFXGUI_MPWeaponSelection_DLC::ApplyWeaponLoadout ( )
 
 void USFXGUI_MPWeaponSelection_DLC::ShowMinimumRequiredWeaponsMessage ( )
 {
-	static UFunction* pFnShowMinimumRequiredWeaponsMessage = NULL;
-
+	UFunction* pFnShowMinimumRequiredWeaponsMessage = (UFunction*) SdkBindings::Get ( 5321 );
 	if ( ! pFnShowMinimumRequiredWeaponsMessage )
-		pFnShowMinimumRequiredWeaponsMessage = (UFunction*) UObject::GObjObjects()->Data[ 74585 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execShowMinimumRequiredWeaponsMessage_Parms ShowMinimumRequiredWeaponsMessage_Parms;
 
@@ -1576,10 +1492,9 @@ void USFXGUI_MPWeaponSelection_DLC::ShowMinimumRequiredWeaponsMessage ( )
 
 void USFXGUI_MPWeaponSelection_DLC::Exit ( )
 {
-	static UFunction* pFnExit = NULL;
-
+	UFunction* pFnExit = (UFunction*) SdkBindings::Get ( 5320 );
 	if ( ! pFnExit )
-		pFnExit = (UFunction*) UObject::GObjObjects()->Data[ 74583 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execExit_Parms Exit_Parms;
 
@@ -1593,10 +1508,9 @@ void USFXGUI_MPWeaponSelection_DLC::Exit ( )
 
 int USFXGUI_MPWeaponSelection_DLC::CountCurrentPawnWeapons ( )
 {
-	static UFunction* pFnCountCurrentPawnWeapons = NULL;
-
+	UFunction* pFnCountCurrentPawnWeapons = (UFunction*) SdkBindings::Get ( 5319 );
 	if ( ! pFnCountCurrentPawnWeapons )
-		pFnCountCurrentPawnWeapons = (UFunction*) UObject::GObjObjects()->Data[ 74579 ];
+		return {};
 
 	USFXGUI_MPWeaponSelection_DLC_execCountCurrentPawnWeapons_Parms CountCurrentPawnWeapons_Parms;
 
@@ -1612,10 +1526,9 @@ int USFXGUI_MPWeaponSelection_DLC::CountCurrentPawnWeapons ( )
 
 bool USFXGUI_MPWeaponSelection_DLC::CurrentPawnHasWeapon ( )
 {
-	static UFunction* pFnCurrentPawnHasWeapon = NULL;
-
+	UFunction* pFnCurrentPawnHasWeapon = (UFunction*) SdkBindings::Get ( 5318 );
 	if ( ! pFnCurrentPawnHasWeapon )
-		pFnCurrentPawnHasWeapon = (UFunction*) UObject::GObjObjects()->Data[ 74577 ];
+		return {};
 
 	USFXGUI_MPWeaponSelection_DLC_execCurrentPawnHasWeapon_Parms CurrentPawnHasWeapon_Parms;
 
@@ -1631,10 +1544,9 @@ bool USFXGUI_MPWeaponSelection_DLC::CurrentPawnHasWeapon ( )
 
 struct FName USFXGUI_MPWeaponSelection_DLC::GetCurrentHenchTag ( )
 {
-	static UFunction* pFnGetCurrentHenchTag = NULL;
-
+	UFunction* pFnGetCurrentHenchTag = (UFunction*) SdkBindings::Get ( 5317 );
 	if ( ! pFnGetCurrentHenchTag )
-		pFnGetCurrentHenchTag = (UFunction*) UObject::GObjObjects()->Data[ 74574 ];
+		return {};
 
 	USFXGUI_MPWeaponSelection_DLC_execGetCurrentHenchTag_Parms GetCurrentHenchTag_Parms;
 
@@ -1651,10 +1563,9 @@ struct FName USFXGUI_MPWeaponSelection_DLC::GetCurrentHenchTag ( )
 
 class ABioPawn* USFXGUI_MPWeaponSelection_DLC::GetBioPawn ( int nPawnID )
 {
-	static UFunction* pFnGetBioPawn = NULL;
-
+	UFunction* pFnGetBioPawn = (UFunction*) SdkBindings::Get ( 5298 );
 	if ( ! pFnGetBioPawn )
-		pFnGetBioPawn = (UFunction*) UObject::GObjObjects()->Data[ 74486 ];
+		return {};
 
 	USFXGUI_MPWeaponSelection_DLC_execGetBioPawn_Parms GetBioPawn_Parms;
 	GetBioPawn_Parms.nPawnID = nPawnID;
@@ -1673,10 +1584,9 @@ class ABioPawn* USFXGUI_MPWeaponSelection_DLC::GetBioPawn ( int nPawnID )
 
 bool USFXGUI_MPWeaponSelection_DLC::CanPawnUseWeaponGroup ( int nPawnID, unsigned char eWeaponGroupID )
 {
-	static UFunction* pFnCanPawnUseWeaponGroup = NULL;
-
+	UFunction* pFnCanPawnUseWeaponGroup = (UFunction*) SdkBindings::Get ( 5314 );
 	if ( ! pFnCanPawnUseWeaponGroup )
-		pFnCanPawnUseWeaponGroup = (UFunction*) UObject::GObjObjects()->Data[ 74557 ];
+		return {};
 
 	USFXGUI_MPWeaponSelection_DLC_execCanPawnUseWeaponGroup_Parms CanPawnUseWeaponGroup_Parms;
 	CanPawnUseWeaponGroup_Parms.nPawnID = nPawnID;
@@ -1695,10 +1605,9 @@ bool USFXGUI_MPWeaponSelection_DLC::CanPawnUseWeaponGroup ( int nPawnID, unsigne
 
 int USFXGUI_MPWeaponSelection_DLC::WeaponTypeToSlotIndex ( unsigned char eWeaponType )
 {
-	static UFunction* pFnWeaponTypeToSlotIndex = NULL;
-
+	UFunction* pFnWeaponTypeToSlotIndex = (UFunction*) SdkBindings::Get ( 5308 );
 	if ( ! pFnWeaponTypeToSlotIndex )
-		pFnWeaponTypeToSlotIndex = (UFunction*) UObject::GObjObjects()->Data[ 74502 ];
+		return {};
 
 	USFXGUI_MPWeaponSelection_DLC_execWeaponTypeToSlotIndex_Parms WeaponTypeToSlotIndex_Parms;
 	WeaponTypeToSlotIndex_Parms.eWeaponType = eWeaponType;
@@ -1715,10 +1624,9 @@ int USFXGUI_MPWeaponSelection_DLC::WeaponTypeToSlotIndex ( unsigned char eWeapon
 
 void USFXGUI_MPWeaponSelection_DLC::RefreshLoadoutWeaponDisplay ( unsigned char eWeaponType )
 {
-	static UFunction* pFnRefreshLoadoutWeaponDisplay = NULL;
-
+	UFunction* pFnRefreshLoadoutWeaponDisplay = (UFunction*) SdkBindings::Get ( 5310 );
 	if ( ! pFnRefreshLoadoutWeaponDisplay )
-		pFnRefreshLoadoutWeaponDisplay = (UFunction*) UObject::GObjObjects()->Data[ 74505 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execRefreshLoadoutWeaponDisplay_Parms RefreshLoadoutWeaponDisplay_Parms;
 	RefreshLoadoutWeaponDisplay_Parms.eWeaponType = eWeaponType;
@@ -1733,10 +1641,9 @@ void USFXGUI_MPWeaponSelection_DLC::RefreshLoadoutWeaponDisplay ( unsigned char
 
 void USFXGUI_MPWeaponSelection_DLC::BuildWeaponLoadout ( int nPawnID )
 {
-	static UFunction* pFnBuildWeaponLoadout = NULL;
-
+	UFunction* pFnBuildWeaponLoadout = (UFunction*) SdkBindings::Get ( 5306 );
 	if ( ! pFnBuildWeaponLoadout )
-		pFnBuildWeaponLoadout = (UFunction*) UObject::GObjObjects()->Data[ 74500 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execBuildWeaponLoadout_Parms BuildWeaponLoadout_Parms;
 	BuildWeaponLoadout_Parms.nPawnID = nPawnID;
@@ -1750,10 +1657,9 @@ void USFXGUI_MPWeaponSelection_DLC::BuildWeaponLoadout ( int nPawnID )
 
 void USFXGUI_MPWeaponSelection_DLC::UpdateUIWorldPawnPosition ( )
 {
-	static UFunction* pFnUpdateUIWorldPawnPosition = NULL;
-
+	UFunction* pFnUpdateUIWorldPawnPosition = (UFunction*) SdkBindings::Get ( 4468 );
 	if ( ! pFnUpdateUIWorldPawnPosition )
-		pFnUpdateUIWorldPawnPosition = (UFunction*) UObject::GObjObjects()->Data[ 47358 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execUpdateUIWorldPawnPosition_Parms UpdateUIWorldPawnPosition_Parms;
 
@@ -1766,10 +1672,9 @@ void USFXGUI_MPWeaponSelection_DLC::UpdateUIWorldPawnPosition ( )
 
 void USFXGUI_MPWeaponSelection_DLC::CleanupUIWorld ( )
 {
-	static UFunction* pFnCleanupUIWorld = NULL;
-
+	UFunction* pFnCleanupUIWorld = (UFunction*) SdkBindings::Get ( 5295 );
 	if ( ! pFnCleanupUIWorld )
-		pFnCleanupUIWorld = (UFunction*) UObject::GObjObjects()->Data[ 74469 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execCleanupUIWorld_Parms CleanupUIWorld_Parms;
 
@@ -1783,10 +1688,9 @@ void USFXGUI_MPWeaponSelection_DLC::CleanupUIWorld ( )
 
 void USFXGUI_MPWeaponSelection_DLC::ApplyPlayerPawnCustomization ( class UObject* InData )
 {
-	static UFunction* pFnApplyPlayerPawnCustomization = NULL;
-
+	UFunction* pFnApplyPlayerPawnCustomization = (UFunction*) SdkBindings::Get ( 5313 );
 	if ( ! pFnApplyPlayerPawnCustomization )
-		pFnApplyPlayerPawnCustomization = (UFunction*) UObject::GObjObjects()->Data[ 74517 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execApplyPlayerPawnCustomization_Parms ApplyPlayerPawnCustomization_Parms;
 	ApplyPlayerPawnCustomization_Parms.InData = InData;
@@ -1800,10 +1704,9 @@ void USFXGUI_MPWeaponSelection_DLC::ApplyPlayerPawnCustomization ( class UObject
 
 void USFXGUI_MPWeaponSelection_DLC::SetupUIWorld ( )
 {
-	static UFunction* pFnSetupUIWorld = NULL;
-
+	UFunction* pFnSetupUIWorld = (UFunction*) SdkBindings::Get ( 5302 );
 	if ( ! pFnSetupUIWorld )
-		pFnSetupUIWorld = (UFunction*) UObject::GObjObjects()->Data[ 74493 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execSetupUIWorld_Parms SetupUIWorld_Parms;
 
@@ -1816,10 +1719,9 @@ void USFXGUI_MPWeaponSelection_DLC::SetupUIWorld ( )
 
 void USFXGUI_MPWeaponSelection_DLC::UpdateHenchmenDisplay ( )
 {
-	static UFunction* pFnUpdateHenchmenDisplay = NULL;
-
+	UFunction* pFnUpdateHenchmenDisplay = (UFunction*) SdkBindings::Get ( 5301 );
 	if ( ! pFnUpdateHenchmenDisplay )
-		pFnUpdateHenchmenDisplay = (UFunction*) UObject::GObjObjects()->Data[ 74492 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execUpdateHenchmenDisplay_Parms UpdateHenchmenDisplay_Parms;
 
@@ -1833,10 +1735,9 @@ void USFXGUI_MPWeaponSelection_DLC::UpdateHenchmenDisplay ( )
 
 void USFXGUI_MPWeaponSelection_DLC::SetCurrentPawnID ( int nID )
 {
-	static UFunction* pFnSetCurrentPawnID = NULL;
-
+	UFunction* pFnSetCurrentPawnID = (UFunction*) SdkBindings::Get ( 5309 );
 	if ( ! pFnSetCurrentPawnID )
-		pFnSetCurrentPawnID = (UFunction*) UObject::GObjObjects()->Data[ 74503 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execSetCurrentPawnID_Parms SetCurrentPawnID_Parms;
 	SetCurrentPawnID_Parms.nID = nID;
@@ -1850,10 +1751,9 @@ void USFXGUI_MPWeaponSelection_DLC::SetCurrentPawnID ( int nID )
 
 void USFXGUI_MPWeaponSelection_DLC::OnWeaponUIDataLoaded ( )
 {
-	static UFunction* pFnOnWeaponUIDataLoaded = NULL;
-
+	UFunction* pFnOnWeaponUIDataLoaded = (UFunction*) SdkBindings::Get ( 5305 );
 	if ( ! pFnOnWeaponUIDataLoaded )
-		pFnOnWeaponUIDataLoaded = (UFunction*) UObject::GObjObjects()->Data[ 74499 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execOnWeaponUIDataLoaded_Parms OnWeaponUIDataLoaded_Parms;
 
@@ -1866,10 +1766,9 @@ void USFXGUI_MPWeaponSelection_DLC::OnWeaponUIDataLoaded ( )
 
 void USFXGUI_MPWeaponSelection_DLC::InitializeTeamSelectOverlay ( )
 {
-	static UFunction* pFnInitializeTeamSelectOverlay = NULL;
-
+	UFunction* pFnInitializeTeamSelectOverlay = (UFunction*) SdkBindings::Get ( 5300 );
 	if ( ! pFnInitializeTeamSelectOverlay )
-		pFnInitializeTeamSelectOverlay = (UFunction*) UObject::GObjObjects()->Data[ 74491 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execInitializeTeamSelectOverlay_Parms InitializeTeamSelectOverlay_Parms;
 
@@ -1883,10 +1782,9 @@ void USFXGUI_MPWeaponSelection_DLC::InitializeTeamSelectOverlay ( )
 
 void USFXGUI_MPWeaponSelection_DLC::PreLoadData ( struct FScriptDelegate doneCallback )
 {
-	static UFunction* pFnPreLoadData = NULL;
-
+	UFunction* pFnPreLoadData = (UFunction*) SdkBindings::Get ( 5303 );
 	if ( ! pFnPreLoadData )
-		pFnPreLoadData = (UFunction*) UObject::GObjObjects()->Data[ 74494 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execPreLoadData_Parms PreLoadData_Parms;
 	memcpy ( &PreLoadData_Parms.doneCallback, &doneCallback, 0xC );
@@ -1901,10 +1799,9 @@ void USFXGUI_MPWeaponSelection_DLC::PreLoadData ( struct FScriptDelegate doneCal
 
 void USFXGUI_MPWeaponSelection_DLC::Launch ( unsigned long bPauseGame )
 {
-	static UFunction* pFnLaunch = NULL;
-
+	UFunction* pFnLaunch = (UFunction*) SdkBindings::Get ( 5293 );
 	if ( ! pFnLaunch )
-		pFnLaunch = (UFunction*) UObject::GObjObjects()->Data[ 74467 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execLaunch_Parms Launch_Parms;
 	Launch_Parms.bPauseGame = bPauseGame;
@@ -1919,10 +1816,9 @@ void USFXGUI_MPWeaponSelection_DLC::Launch ( unsigned long bPauseGame )
 
 bool USFXGUI_MPWeaponSelection_DLC::IsMultiPlayerCharacter ( )
 {
-	static UFunction* pFnIsMultiPlayerCharacter = NULL;
-
+	UFunction* pFnIsMultiPlayerCharacter = (UFunction*) SdkBindings::Get ( 5296 );
 	if ( ! pFnIsMultiPlayerCharacter )
-		pFnIsMultiPlayerCharacter = (UFunction*) UObject::GObjObjects()->Data[ 74473 ];
+		return {};
 
 	USFXGUI_MPWeaponSelection_DLC_execIsMultiPlayerCharacter_Parms IsMultiPlayerCharacter_Parms;
 
@@ -1937,10 +1833,9 @@ bool USFXGUI_MPWeaponSelection_DLC::IsMultiPlayerCharacter ( )
 
 void USFXGUI_MPWeaponSelection_DLC::DisplayNoEngineMessage ( )
 {
-	static UFunction* pFnDisplayNoEngineMessage = NULL;
-
+	UFunction* pFnDisplayNoEngineMessage = (UFunction*) SdkBindings::Get ( 5292 );
 	if ( ! pFnDisplayNoEngineMessage )
-		pFnDisplayNoEngineMessage = (UFunction*) UObject::GObjObjects()->Data[ 74465 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_execDisplayNoEngineMessage_Parms DisplayNoEngineMessage_Parms;
 
@@ -1953,10 +1848,9 @@ void USFXGUI_MPWeaponSelection_DLC::DisplayNoEngineMessage ( )
 
 void USFXGUI_MPWeaponSelection_DLC::eventOnClose ( )
 {
-	static UFunction* pFnOnClose = NULL;
-
+	UFunction* pFnOnClose = (UFunction*) SdkBindings::Get ( 5294 );
 	if ( ! pFnOnClose )
-		pFnOnClose = (UFunction*) UObject::GObjObjects()->Data[ 74468 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_eventOnClose_Parms OnClose_Parms;
 
@@ -1969,10 +1863,9 @@ void USFXGUI_MPWeaponSelection_DLC::eventOnClose ( )
 
 void USFXGUI_MPWeaponSelection_DLC::eventOnStart ( )
 {
-	static UFunction* pFnOnStart = NULL;
-
+	UFunction* pFnOnStart = (UFunction*) SdkBindings::Get ( 5291 );
 	if ( ! pFnOnStart )
-		pFnOnStart = (UFunction*) UObject::GObjObjects()->Data[ 74464 ];
+		return;
 
 	USFXGUI_MPWeaponSelection_DLC_eventOnStart_Parms OnStart_Parms;
 
@@ -1987,10 +1880,9 @@ void USFXGUI_MPWeaponSelection_DLC::eventOnStart ( )
 
 void USFXGUI_MPChallenges::eventAS_SetDetails ( struct FString sInfo, struct FString sImgResource )
 {
-	static UFunction* pFnAS_SetDetails = NULL;
-
+	UFunction* pFnAS_SetDetails = (UFunction*) SdkBindings::Get ( 7478 );
 	if ( ! pFnAS_SetDetails )
-		pFnAS_SetDetails = (UFunction*) UObject::GObjObjects()->Data[ 125186 ];
+		return;
 
 	USFXGUI_MPChallenges_eventAS_SetDetails_Parms AS_SetDetails_Parms;
 	memcpy ( &AS_SetDetails_Parms.sInfo, &sInfo, 0xC );
@@ -2006,10 +1898,9 @@ void USFXGUI_MPChallenges::eventAS_SetDetails ( struct FString sInfo, struct FSt
 
 void USFXGUI_MPChallenges::eventAS_EndDisplayList ( int nLastEntryID )
 {
-	static UFunction* pFnAS_EndDisplayList = NULL;
-
+	UFunction* pFnAS_EndDisplayList = (UFunction*) SdkBindings::Get ( 7466 );
 	if ( ! pFnAS_EndDisplayList )
-		pFnAS_EndDisplayList = (UFunction*) UObject::GObjObjects()->Data[ 125141 ];
+		return;
 
 	USFXGUI_MPChallenges_eventAS_EndDisplayList_Parms AS_EndDisplayList_Parms;
 	AS_EndDisplayList_Parms.nLastEntryID = nLastEntryID;
@@ -2024,10 +1915,9 @@ void USFXGUI_MPChallenges::eventAS_EndDisplayList ( int nLastEntryID )
 
 void USFXGUI_MPChallenges::eventAS_SetSubItems ( TArray< struct FChallengeListItem > aSubItems )
 {
-	static UFunction* pFnAS_SetSubItems = NULL;
-
+	UFunction* pFnAS_SetSubItems = (UFunction*) SdkBindings::Get ( 7471 );
 	if ( ! pFnAS_SetSubItems )
-		pFnAS_SetSubItems = (UFunction*) UObject::GObjObjects()->Data[ 125158 ];
+		return;
 
 	USFXGUI_MPChallenges_eventAS_SetSubItems_Parms AS_SetSubItems_Parms;
 	memcpy ( &AS_SetSubItems_Parms.aSubItems, &aSubItems, 0xC );
@@ -2042,10 +1932,9 @@ void USFXGUI_MPChallenges::eventAS_SetSubItems ( TArray< struct FChallengeListIt
 
 void USFXGUI_MPChallenges::eventAS_AddListItems ( TArray< struct FChallengeListItem > aItems )
 {
-	static UFunction* pFnAS_AddListItems = NULL;
-
+	UFunction* pFnAS_AddListItems = (UFunction*) SdkBindings::Get ( 7465 );
 	if ( ! pFnAS_AddListItems )
-		pFnAS_AddListItems = (UFunction*) UObject::GObjObjects()->Data[ 125140 ];
+		return;
 
 	USFXGUI_MPChallenges_eventAS_AddListItems_Parms AS_AddListItems_Parms;
 	memcpy ( &AS_AddListItems_Parms.aItems, &aItems, 0xC );
@@ -2062,10 +1951,9 @@ void USFXGUI_MPChallenges::eventAS_AddListItems ( TArray< struct FChallengeListI
 
 void USFXGUI_MPChallenges::eventAS_StartDisplayList ( struct FString sLabel, struct FString sTitle, int nListLen )
 {
-	static UFunction* pFnAS_StartDisplayList = NULL;
-
+	UFunction* pFnAS_StartDisplayList = (UFunction*) SdkBindings::Get ( 7464 );
 	if ( ! pFnAS_StartDisplayList )
-		pFnAS_StartDisplayList = (UFunction*) UObject::GObjObjects()->Data[ 125139 ];
+		return;
 
 	USFXGUI_MPChallenges_eventAS_StartDisplayList_Parms AS_StartDisplayList_Parms;
 	memcpy ( &AS_StartDisplayList_Parms.sLabel, &sLabel, 0xC );
@@ -2082,10 +1970,9 @@ void USFXGUI_MPChallenges::eventAS_StartDisplayList ( struct FString sLabel, str
 
 void USFXGUI_MPChallenges::eventAS_SetupVisualState ( int nForceTab )
 {
-	static UFunction* pFnAS_SetupVisualState = NULL;
-
+	UFunction* pFnAS_SetupVisualState = (UFunction*) SdkBindings::Get ( 7460 );
 	if ( ! pFnAS_SetupVisualState )
-		pFnAS_SetupVisualState = (UFunction*) UObject::GObjObjects()->Data[ 125125 ];
+		return;
 
 	USFXGUI_MPChallenges_eventAS_SetupVisualState_Parms AS_SetupVisualState_Parms;
 	AS_SetupVisualState_Parms.nForceTab = nForceTab;
@@ -2100,10 +1987,9 @@ void USFXGUI_MPChallenges::eventAS_SetupVisualState ( int nForceTab )
 
 void USFXGUI_MPChallenges::eventAS_ScrollDetailsAnalog ( float fScroll )
 {
-	static UFunction* pFnAS_ScrollDetailsAnalog = NULL;
-
+	UFunction* pFnAS_ScrollDetailsAnalog = (UFunction*) SdkBindings::Get ( 7482 );
 	if ( ! pFnAS_ScrollDetailsAnalog )
-		pFnAS_ScrollDetailsAnalog = (UFunction*) UObject::GObjObjects()->Data[ 125194 ];
+		return;
 
 	USFXGUI_MPChallenges_eventAS_ScrollDetailsAnalog_Parms AS_ScrollDetailsAnalog_Parms;
 	AS_ScrollDetailsAnalog_Parms.fScroll = fScroll;
@@ -2121,10 +2007,9 @@ void USFXGUI_MPChallenges::eventAS_ScrollDetailsAnalog ( float fScroll )
 
 void USFXGUI_MPChallenges::eventAS_SetUnreadItemCounts ( int nQuestPrimary, int nQuestSecondary, int nCodexPrimary, int nCodexSecondary )
 {
-	static UFunction* pFnAS_SetUnreadItemCounts = NULL;
-
+	UFunction* pFnAS_SetUnreadItemCounts = (UFunction*) SdkBindings::Get ( 7461 );
 	if ( ! pFnAS_SetUnreadItemCounts )
-		pFnAS_SetUnreadItemCounts = (UFunction*) UObject::GObjObjects()->Data[ 125126 ];
+		return;
 
 	USFXGUI_MPChallenges_eventAS_SetUnreadItemCounts_Parms AS_SetUnreadItemCounts_Parms;
 	AS_SetUnreadItemCounts_Parms.nQuestPrimary = nQuestPrimary;
@@ -2143,10 +2028,9 @@ void USFXGUI_MPChallenges::eventAS_SetUnreadItemCounts ( int nQuestPrimary, int
 
 bool USFXGUI_MPChallenges::IsAccomplishmentRepeatable ( int AccomplishmentDataIndex )
 {
-	static UFunction* pFnIsAccomplishmentRepeatable = NULL;
-
+	UFunction* pFnIsAccomplishmentRepeatable = (UFunction*) SdkBindings::Get ( 7457 );
 	if ( ! pFnIsAccomplishmentRepeatable )
-		pFnIsAccomplishmentRepeatable = (UFunction*) UObject::GObjObjects()->Data[ 125087 ];
+		return {};
 
 	USFXGUI_MPChallenges_execIsAccomplishmentRepeatable_Parms IsAccomplishmentRepeatable_Parms;
 	IsAccomplishmentRepeatable_Parms.AccomplishmentDataIndex = AccomplishmentDataIndex;
@@ -2163,10 +2047,9 @@ bool USFXGUI_MPChallenges::IsAccomplishmentRepeatable ( int AccomplishmentDataIn
 
 void USFXGUI_MPChallenges::SetAccomplishmentRepeatable ( TArray< unsigned long > NewAccomplishmentDataRepeatable )
 {
-	static UFunction* pFnSetAccomplishmentRepeatable = NULL;
-
+	UFunction* pFnSetAccomplishmentRepeatable = (UFunction*) SdkBindings::Get ( 7483 );
 	if ( ! pFnSetAccomplishmentRepeatable )
-		pFnSetAccomplishmentRepeatable = (UFunction*) UObject::GObjObjects()->Data[ 125195 ];
+		return;
 
 	USFXGUI_MPChallenges_execSetAccomplishmentRepeatable_Parms SetAccomplishmentRepeatable_Parms;
 	memcpy ( &SetAccomplishmentRepeatable_Parms.NewAccomplishmentDataRepeatable, &NewAccomplishmentDataRepeatable, 0xC );
@@ -2183,10 +2066,9 @@ void USFXGUI_MPChallenges::SetAccomplishmentRepeatable ( TArray< unsigned long >
 
 bool USFXGUI_MPChallenges::eventHandleInputEvent ( unsigned char Event, float fValue )
 {
-	static UFunction* pFnHandleInputEvent = NULL;
-
+	UFunction* pFnHandleInputEvent = (UFunction*) SdkBindings::Get ( 7481 );
 	if ( ! pFnHandleInputEvent )
-		pFnHandleInputEvent = (UFunction*) UObject::GObjObjects()->Data[ 125190 ];
+		return {};
 
 	USFXGUI_MPChallenges_eventHandleInputEvent_Parms HandleInputEvent_Parms;
 	HandleInputEvent_Parms.Event = Event;
@@ -2203,10 +2085,9 @@ bool USFXGUI_MPChallenges::eventHandleInputEvent ( unsigned char Event, float fV
 
 void USFXGUI_MPChallenges::ReturnToBrowser ( )
 {
-	static UFunction* pFnReturnToBrowser = NULL;
-
+	UFunction* pFnReturnToBrowser = (UFunction*) SdkBindings::Get ( 7480 );
 	if ( ! pFnReturnToBrowser )
-		pFnReturnToBrowser = (UFunction*) UObject::GObjObjects()->Data[ 125189 ];
+		return;
 
 	USFXGUI_MPChallenges_execReturnToBrowser_Parms ReturnToBrowser_Parms;
 
@@ -2220,10 +2101,9 @@ void USFXGUI_MPChallenges::ReturnToBrowser ( )
 
 void USFXGUI_MPChallenges::OnRequestImageComplete ( struct FSFXOnlineImageRequest ImageRequestResult )
 {
-	static UFunction* pFnOnRequestImageComplete = NULL;
-
+	UFunction* pFnOnRequestImageComplete = (UFunction*) SdkBindings::Get ( 7479 );
 	if ( ! pFnOnRequestImageComplete )
-		pFnOnRequestImageComplete = (UFunction*) UObject::GObjObjects()->Data[ 125187 ];
+		return;
 
 	USFXGUI_MPChallenges_execOnRequestImageComplete_Parms OnRequestImageComplete_Parms;
 	memcpy ( &OnRequestImageComplete_Parms.ImageRequestResult, &ImageRequestResult, 0x18 );
@@ -2240,10 +2120,9 @@ void USFXGUI_MPChallenges::OnRequestImageComplete ( struct FSFXOnlineImageReques
 
 void USFXGUI_MPChallenges::SetDetails ( struct FString sBody, struct FString sImageResourceString, struct FString sImageAssetPath )
 {
-	static UFunction* pFnSetDetails = NULL;
-
+	UFunction* pFnSetDetails = (UFunction*) SdkBindings::Get ( 7468 );
 	if ( ! pFnSetDetails )
-		pFnSetDetails = (UFunction*) UObject::GObjObjects()->Data[ 125146 ];
+		return;
 
 	USFXGUI_MPChallenges_execSetDetails_Parms SetDetails_Parms;
 	memcpy ( &SetDetails_Parms.sBody, &sBody, 0xC );
@@ -2260,10 +2139,9 @@ void USFXGUI_MPChallenges::SetDetails ( struct FString sBody, struct FString sIm
 
 void USFXGUI_MPChallenges::SetRewardButtonEnabled ( unsigned long bEnabled )
 {
-	static UFunction* pFnSetRewardButtonEnabled = NULL;
-
+	UFunction* pFnSetRewardButtonEnabled = (UFunction*) SdkBindings::Get ( 7477 );
 	if ( ! pFnSetRewardButtonEnabled )
-		pFnSetRewardButtonEnabled = (UFunction*) UObject::GObjObjects()->Data[ 125178 ];
+		return;
 
 	USFXGUI_MPChallenges_execSetRewardButtonEnabled_Parms SetRewardButtonEnabled_Parms;
 	SetRewardButtonEnabled_Parms.bEnabled = bEnabled;
@@ -2278,10 +2156,9 @@ void USFXGUI_MPChallenges::SetRewardButtonEnabled ( unsigned long bEnabled )
 
 void USFXGUI_MPChallenges::SetRewardButtonVisibility ( unsigned long bVisible )
 {
-	static UFunction* pFnSetRewardButtonVisibility = NULL;
-
+	UFunction* pFnSetRewardButtonVisibility = (UFunction*) SdkBindings::Get ( 7476 );
 	if ( ! pFnSetRewardButtonVisibility )
-		pFnSetRewardButtonVisibility = (UFunction*) UObject::GObjObjects()->Data[ 125175 ];
+		return;
 
 	USFXGUI_MPChallenges_execSetRewardButtonVisibility_Parms SetRewardButtonVisibility_Parms;
 	SetRewardButtonVisibility_Parms.bVisible = bVisible;
@@ -2295,10 +2172,9 @@ void USFXGUI_MPChallenges::SetRewardButtonVisibility ( unsigned long bVisible )
 
 void USFXGUI_MPChallenges::DoNothingFunction ( )
 {
-	static UFunction* pFnDoNothingFunction = NULL;
-
+	UFunction* pFnDoNothingFunction = (UFunction*) SdkBindings::Get ( 7475 );
 	if ( ! pFnDoNothingFunction )
-		pFnDoNothingFunction = (UFunction*) UObject::GObjObjects()->Data[ 125174 ];
+		return;
 
 	USFXGUI_MPChallenges_execDoNothingFunction_Parms DoNothingFunction_Parms;
 
@@ -2311,10 +2187,9 @@ void USFXGUI_MPChallenges::DoNothingFunction ( )
 
 void USFXGUI_MPChallenges::HandleRewardSelection ( )
 {
-	static UFunction* pFnHandleRewardSelection = NULL;
-
+	UFunction* pFnHandleRewardSelection = (UFunction*) SdkBindings::Get ( 7474 );
 	if ( ! pFnHandleRewardSelection )
-		pFnHandleRewardSelection = (UFunction*) UObject::GObjObjects()->Data[ 125165 ];
+		return;
 
 	USFXGUI_MPChallenges_execHandleRewardSelection_Parms HandleRewardSelection_Parms;
 
@@ -2329,10 +2204,9 @@ void USFXGUI_MPChallenges::HandleRewardSelection ( )
 
 void USFXGUI_MPChallenges::FocusOnSubentry ( TArray< struct FChallengeDisplayItem > aChallenges, int nIndex )
 {
-	static UFunction* pFnFocusOnSubentry = NULL;
-
+	UFunction* pFnFocusOnSubentry = (UFunction*) SdkBindings::Get ( 7473 );
 	if ( ! pFnFocusOnSubentry )
-		pFnFocusOnSubentry = (UFunction*) UObject::GObjObjects()->Data[ 125161 ];
+		return;
 
 	USFXGUI_MPChallenges_execFocusOnSubentry_Parms FocusOnSubentry_Parms;
 	memcpy ( &FocusOnSubentry_Parms.aChallenges, &aChallenges, 0xC );
@@ -2348,10 +2222,9 @@ void USFXGUI_MPChallenges::FocusOnSubentry ( TArray< struct FChallengeDisplayIte
 
 void USFXGUI_MPChallenges::ExFocusOnSubentry ( int nChallengeIndex )
 {
-	static UFunction* pFnExFocusOnSubentry = NULL;
-
+	UFunction* pFnExFocusOnSubentry = (UFunction*) SdkBindings::Get ( 7472 );
 	if ( ! pFnExFocusOnSubentry )
-		pFnExFocusOnSubentry = (UFunction*) UObject::GObjObjects()->Data[ 125159 ];
+		return;
 
 	USFXGUI_MPChallenges_execExFocusOnSubentry_Parms ExFocusOnSubentry_Parms;
 	ExFocusOnSubentry_Parms.nChallengeIndex = nChallengeIndex;
@@ -2366,10 +2239,9 @@ void USFXGUI_MPChallenges::ExFocusOnSubentry ( int nChallengeIndex )
 
 void USFXGUI_MPChallenges::ExpandListEntry ( TArray< struct FChallengeDisplayItem > aChallenges )
 {
-	static UFunction* pFnExpandListEntry = NULL;
-
+	UFunction* pFnExpandListEntry = (UFunction*) SdkBindings::Get ( 7470 );
 	if ( ! pFnExpandListEntry )
-		pFnExpandListEntry = (UFunction*) UObject::GObjObjects()->Data[ 125148 ];
+		return;
 
 	USFXGUI_MPChallenges_execExpandListEntry_Parms ExpandListEntry_Parms;
 	memcpy ( &ExpandListEntry_Parms.aChallenges, &aChallenges, 0xC );
@@ -2383,10 +2255,9 @@ void USFXGUI_MPChallenges::ExpandListEntry ( TArray< struct FChallengeDisplayIte
 
 void USFXGUI_MPChallenges::ExExpandEntry ( )
 {
-	static UFunction* pFnExExpandEntry = NULL;
-
+	UFunction* pFnExExpandEntry = (UFunction*) SdkBindings::Get ( 7469 );
 	if ( ! pFnExExpandEntry )
-		pFnExExpandEntry = (UFunction*) UObject::GObjObjects()->Data[ 125147 ];
+		return;
 
 	USFXGUI_MPChallenges_execExExpandEntry_Parms ExExpandEntry_Parms;
 
@@ -2400,10 +2271,9 @@ void USFXGUI_MPChallenges::ExExpandEntry ( )
 
 void USFXGUI_MPChallenges::ExSetLastEntry ( int nListIndex )
 {
-	static UFunction* pFnExSetLastEntry = NULL;
-
+	UFunction* pFnExSetLastEntry = (UFunction*) SdkBindings::Get ( 7467 );
 	if ( ! pFnExSetLastEntry )
-		pFnExSetLastEntry = (UFunction*) UObject::GObjObjects()->Data[ 125142 ];
+		return;
 
 	USFXGUI_MPChallenges_execExSetLastEntry_Parms ExSetLastEntry_Parms;
 	ExSetLastEntry_Parms.nListIndex = nListIndex;
@@ -2419,10 +2289,9 @@ void USFXGUI_MPChallenges::ExSetLastEntry ( int nListIndex )
 
 void USFXGUI_MPChallenges::DisplayCategoryChallenges ( TArray< struct FChallengeDisplayItem > aChallenges, int nSelectChallengeId )
 {
-	static UFunction* pFnDisplayCategoryChallenges = NULL;
-
+	UFunction* pFnDisplayCategoryChallenges = (UFunction*) SdkBindings::Get ( 7463 );
 	if ( ! pFnDisplayCategoryChallenges )
-		pFnDisplayCategoryChallenges = (UFunction*) UObject::GObjObjects()->Data[ 125130 ];
+		return;
 
 	USFXGUI_MPChallenges_execDisplayCategoryChallenges_Parms DisplayCategoryChallenges_Parms;
 	memcpy ( &DisplayCategoryChallenges_Parms.aChallenges, &aChallenges, 0xC );
@@ -2438,10 +2307,9 @@ void USFXGUI_MPChallenges::DisplayCategoryChallenges ( TArray< struct FChallenge
 
 void USFXGUI_MPChallenges::ExFocusOnTab ( int nTab )
 {
-	static UFunction* pFnExFocusOnTab = NULL;
-
+	UFunction* pFnExFocusOnTab = (UFunction*) SdkBindings::Get ( 7462 );
 	if ( ! pFnExFocusOnTab )
-		pFnExFocusOnTab = (UFunction*) UObject::GObjObjects()->Data[ 125127 ];
+		return;
 
 	USFXGUI_MPChallenges_execExFocusOnTab_Parms ExFocusOnTab_Parms;
 	ExFocusOnTab_Parms.nTab = nTab;
@@ -2455,10 +2323,9 @@ void USFXGUI_MPChallenges::ExFocusOnTab ( int nTab )
 
 void USFXGUI_MPChallenges::ExInitializeJournal ( )
 {
-	static UFunction* pFnExInitializeJournal = NULL;
-
+	UFunction* pFnExInitializeJournal = (UFunction*) SdkBindings::Get ( 7459 );
 	if ( ! pFnExInitializeJournal )
-		pFnExInitializeJournal = (UFunction*) UObject::GObjObjects()->Data[ 125124 ];
+		return;
 
 	USFXGUI_MPChallenges_execExInitializeJournal_Parms ExInitializeJournal_Parms;
 
@@ -2475,10 +2342,9 @@ void USFXGUI_MPChallenges::ExInitializeJournal ( )
 
 void USFXGUI_MPChallenges::BuildPercentCompletion_Helper ( int nCurrentChallengeIndex, class USFXAccomplishmentManager* AccomplishmentManager, TArray< float >* PercentCompletion, TArray< struct FChallengeDisplayItem >* aChallenges )
 {
-	static UFunction* pFnBuildPercentCompletion_Helper = NULL;
-
+	UFunction* pFnBuildPercentCompletion_Helper = (UFunction*) SdkBindings::Get ( 7458 );
 	if ( ! pFnBuildPercentCompletion_Helper )
-		pFnBuildPercentCompletion_Helper = (UFunction*) UObject::GObjObjects()->Data[ 125099 ];
+		return;
 
 	USFXGUI_MPChallenges_execBuildPercentCompletion_Helper_Parms BuildPercentCompletion_Helper_Parms;
 	BuildPercentCompletion_Helper_Parms.nCurrentChallengeIndex = nCurrentChallengeIndex;
@@ -2502,10 +2368,9 @@ void USFXGUI_MPChallenges::BuildPercentCompletion_Helper ( int nCurrentChallenge
 
 void USFXGUI_MPChallenges::BuildPercentCompletion ( class USFXAccomplishmentManager* AccomplishmentManager, TArray< float >* PercentCompletion, TArray< struct FChallengeDisplayItem >* aChallenges )
 {
-	static UFunction* pFnBuildPercentCompletion = NULL;
-
+	UFunction* pFnBuildPercentCompletion = (UFunction*) SdkBindings::Get ( 7455 );
 	if ( ! pFnBuildPercentCompletion )
-		pFnBuildPercentCompletion = (UFunction*) UObject::GObjObjects()->Data[ 125060 ];
+		return;
 
 	USFXGUI_MPChallenges_execBuildPercentCompletion_Parms BuildPercentCompletion_Parms;
 	BuildPercentCompletion_Parms.AccomplishmentManager = AccomplishmentManager;
@@ -2529,10 +2394,9 @@ void USFXGUI_MPChallenges::BuildPercentCompletion ( class USFXAccomplishmentMana
 
 void USFXGUI_MPChallenges::BuildUIData ( int nChallengeIndex, class USFXAccomplishmentManager* AccomplishmentManager, TArray< struct FChallengeDisplayItem >* aChallenges, TArray< float >* PercentageCompletion )
 {
-	static UFunction* pFnBuildUIData = NULL;
-
+	UFunction* pFnBuildUIData = (UFunction*) SdkBindings::Get ( 7456 );
 	if ( ! pFnBuildUIData )
-		pFnBuildUIData = (UFunction*) UObject::GObjObjects()->Data[ 125061 ];
+		return;
 
 	USFXGUI_MPChallenges_execBuildUIData_Parms BuildUIData_Parms;
 	BuildUIData_Parms.nChallengeIndex = nChallengeIndex;
@@ -2555,10 +2419,9 @@ void USFXGUI_MPChallenges::BuildUIData ( int nChallengeIndex, class USFXAccompli
 
 void USFXGUI_MPChallenges::InitializeChallengeArray ( class USFXAccomplishmentManager* AccomplishmentManager, TArray< struct FChallengeDisplayItem >* aChallenges )
 {
-	static UFunction* pFnInitializeChallengeArray = NULL;
-
+	UFunction* pFnInitializeChallengeArray = (UFunction*) SdkBindings::Get ( 7454 );
 	if ( ! pFnInitializeChallengeArray )
-		pFnInitializeChallengeArray = (UFunction*) UObject::GObjObjects()->Data[ 125053 ];
+		return;
 
 	USFXGUI_MPChallenges_execInitializeChallengeArray_Parms InitializeChallengeArray_Parms;
 	InitializeChallengeArray_Parms.AccomplishmentManager = AccomplishmentManager;
@@ -2575,10 +2438,9 @@ void USFXGUI_MPChallenges::InitializeChallengeArray ( class USFXAccomplishmentMa
 
 void USFXGUI_MPChallenges::CheckInitializeData ( )
 {
-	static UFunction* pFnCheckInitializeData = NULL;
-
+	UFunction* pFnCheckInitializeData = (UFunction*) SdkBindings::Get ( 7453 );
 	if ( ! pFnCheckInitializeData )
-		pFnCheckInitializeData = (UFunction*) UObject::GObjObjects()->Data[ 125050 ];
+		return;
 
 	USFXGUI_MPChallenges_execCheckInitializeData_Parms CheckInitializeData_Parms;
 
@@ -2594,10 +2456,9 @@ void USFXGUI_MPChallenges::CheckInitializeData ( )
 
 int USFXGUI_MPChallenges::ChallengeSort_Parent ( struct FChallengeDisplayItem A, struct FChallengeDisplayItem B )
 {
-	static UFunction* pFnChallengeSort_Parent = NULL;
-
+	UFunction* pFnChallengeSort_Parent = (UFunction*) SdkBindings::Get ( 7452 );
 	if ( ! pFnChallengeSort_Parent )
-		pFnChallengeSort_Parent = (UFunction*) UObject::GObjObjects()->Data[ 125046 ];
+		return {};
 
 	USFXGUI_MPChallenges_execChallengeSort_Parent_Parms ChallengeSort_Parent_Parms;
 	memcpy ( &ChallengeSort_Parent_Parms.A, &A, 0x6C );
@@ -2617,10 +2478,9 @@ int USFXGUI_MPChallenges::ChallengeSort_Parent ( struct FChallengeDisplayItem A,
 
 int USFXGUI_MPChallenges::ChallengeSort_Rank_Index ( struct FChallengeDisplayItem A, struct FChallengeDisplayItem B )
 {
-	static UFunction* pFnChallengeSort_Rank_Index = NULL;
-
+	UFunction* pFnChallengeSort_Rank_Index = (UFunction*) SdkBindings::Get ( 7451 );
 	if ( ! pFnChallengeSort_Rank_Index )
-		pFnChallengeSort_Rank_Index = (UFunction*) UObject::GObjObjects()->Data[ 125042 ];
+		return {};
 
 	USFXGUI_MPChallenges_execChallengeSort_Rank_Index_Parms ChallengeSort_Rank_Index_Parms;
 	memcpy ( &ChallengeSort_Rank_Index_Parms.A, &A, 0x6C );
@@ -2637,10 +2497,9 @@ int USFXGUI_MPChallenges::ChallengeSort_Rank_Index ( struct FChallengeDisplayIte
 
 void USFXGUI_MPChallenges::ConstructEnumObjects ( )
 {
-	static UFunction* pFnConstructEnumObjects = NULL;
-
+	UFunction* pFnConstructEnumObjects = (UFunction*) SdkBindings::Get ( 7448 );
 	if ( ! pFnConstructEnumObjects )
-		pFnConstructEnumObjects = (UFunction*) UObject::GObjObjects()->Data[ 125034 ];
+		return;
 
 	USFXGUI_MPChallenges_execConstructEnumObjects_Parms ConstructEnumObjects_Parms;
 
@@ -2653,10 +2512,9 @@ void USFXGUI_MPChallenges::ConstructEnumObjects ( )
 
 void USFXGUI_MPChallenges::SetupFunctionIntercepts ( )
 {
-	static UFunction* pFnSetupFunctionIntercepts = NULL;
-
+	UFunction* pFnSetupFunctionIntercepts = (UFunction*) SdkBindings::Get ( 7447 );
 	if ( ! pFnSetupFunctionIntercepts )
-		pFnSetupFunctionIntercepts = (UFunction*) UObject::GObjObjects()->Data[ 125033 ];
+		return;
 
 	USFXGUI_MPChallenges_execSetupFunctionIntercepts_Parms SetupFunctionIntercepts_Parms;
 
@@ -2669,10 +2527,9 @@ void USFXGUI_MPChallenges::SetupFunctionIntercepts ( )
 
 void USFXGUI_MPChallenges::ResetStartupOverrides ( )
 {
-	static UFunction* pFnResetStartupOverrides = NULL;
-
+	UFunction* pFnResetStartupOverrides = (UFunction*) SdkBindings::Get ( 7450 );
 	if ( ! pFnResetStartupOverrides )
-		pFnResetStartupOverrides = (UFunction*) UObject::GObjObjects()->Data[ 125037 ];
+		return;
 
 	USFXGUI_MPChallenges_execResetStartupOverrides_Parms ResetStartupOverrides_Parms;
 
@@ -2685,10 +2542,9 @@ void USFXGUI_MPChallenges::ResetStartupOverrides ( )
 
 void USFXGUI_MPChallenges::eventOnClose ( )
 {
-	static UFunction* pFnOnClose = NULL;
-
+	UFunction* pFnOnClose = (UFunction*) SdkBindings::Get ( 7449 );
 	if ( ! pFnOnClose )
-		pFnOnClose = (UFunction*) UObject::GObjObjects()->Data[ 125035 ];
+		return;
 
 	USFXGUI_MPChallenges_eventOnClose_Parms OnClose_Parms;
 
@@ -2701,10 +2557,9 @@ void USFXGUI_MPChallenges::eventOnClose ( )
 
 void USFXGUI_MPChallenges::eventOnStart ( )
 {
-	static UFunction* pFnOnStart = NULL;
-
+	UFunction* pFnOnStart = (UFunction*) SdkBindings::Get ( 7446 );
 	if ( ! pFnOnStart )
-		pFnOnStart = (UFunction*) UObject::GObjObjects()->Data[ 125032 ];
+		return;
 
 	USFXGUI_MPChallenges_eventOnStart_Parms OnStart_Parms;
 
@@ -2718,10 +2573,9 @@ void USFXGUI_MPChallenges::eventOnStart ( )
 
 bool USFXGUI_MPLobby_DLC::IsChallengeSystemEnabled ( )
 {
-	static UFunction* pFnIsChallengeSystemEnabled = NULL;
-
+	UFunction* pFnIsChallengeSystemEnabled = (UFunction*) SdkBindings::Get ( 6726 );
 	if ( ! pFnIsChallengeSystemEnabled )
-		pFnIsChallengeSystemEnabled = (UFunction*) UObject::GObjObjects()->Data[ 110280 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execIsChallengeSystemEnabled_Parms IsChallengeSystemEnabled_Parms;
 
@@ -2736,10 +2590,9 @@ bool USFXGUI_MPLobby_DLC::IsChallengeSystemEnabled ( )
 
 void USFXGUI_MPLobby_DLC::ShowMPChallengeScreen ( )
 {
-	static UFunction* pFnShowMPChallengeScreen = NULL;
-
+	UFunction* pFnShowMPChallengeScreen = (UFunction*) SdkBindings::Get ( 6727 );
 	if ( ! pFnShowMPChallengeScreen )
-		pFnShowMPChallengeScreen = (UFunction*) UObject::GObjObjects()->Data[ 110288 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execShowMPChallengeScreen_Parms ShowMPChallengeScreen_Parms;
 
@@ -2753,10 +2606,9 @@ void USFXGUI_MPLobby_DLC::ShowMPChallengeScreen ( )
 
 void USFXGUI_MPLobby_DLC::OnRequestImageComplete ( struct FSFXOnlineImageRequest ImageRequestResult )
 {
-	static UFunction* pFnOnRequestImageComplete = NULL;
-
+	UFunction* pFnOnRequestImageComplete = (UFunction*) SdkBindings::Get ( 6728 );
 	if ( ! pFnOnRequestImageComplete )
-		pFnOnRequestImageComplete = (UFunction*) UObject::GObjObjects()->Data[ 110290 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execOnRequestImageComplete_Parms OnRequestImageComplete_Parms;
 	memcpy ( &OnRequestImageComplete_Parms.ImageRequestResult, &ImageRequestResult, 0x18 );
@@ -2772,10 +2624,9 @@ void USFXGUI_MPLobby_DLC::OnRequestImageComplete ( struct FSFXOnlineImageRequest
 
 struct FString USFXGUI_MPLobby_DLC::RequestImage ( struct FString Resource )
 {
-	static UFunction* pFnRequestImage = NULL;
-
+	UFunction* pFnRequestImage = (UFunction*) SdkBindings::Get ( 6730 );
 	if ( ! pFnRequestImage )
-		pFnRequestImage = (UFunction*) UObject::GObjObjects()->Data[ 110293 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execRequestImage_Parms RequestImage_Parms;
 	memcpy ( &RequestImage_Parms.Resource, &Resource, 0xC );
@@ -2793,10 +2644,9 @@ struct FString USFXGUI_MPLobby_DLC::RequestImage ( struct FString Resource )
 
 struct FEmblemDisplayInfo USFXGUI_MPLobby_DLC::GetEmblemData ( int EmblemID )
 {
-	static UFunction* pFnGetEmblemData = NULL;
-
+	UFunction* pFnGetEmblemData = (UFunction*) SdkBindings::Get ( 6731 );
 	if ( ! pFnGetEmblemData )
-		pFnGetEmblemData = (UFunction*) UObject::GObjObjects()->Data[ 110296 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetEmblemData_Parms GetEmblemData_Parms;
 	GetEmblemData_Parms.EmblemID = EmblemID;
@@ -2813,10 +2663,9 @@ struct FEmblemDisplayInfo USFXGUI_MPLobby_DLC::GetEmblemData ( int EmblemID )
 
 bool USFXGUI_MPLobby_DLC::CheckIfSignedInFailSafe ( )
 {
-	static UFunction* pFnCheckIfSignedInFailSafe = NULL;
-
+	UFunction* pFnCheckIfSignedInFailSafe = (UFunction*) SdkBindings::Get ( 6676 );
 	if ( ! pFnCheckIfSignedInFailSafe )
-		pFnCheckIfSignedInFailSafe = (UFunction*) UObject::GObjObjects()->Data[ 110141 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execCheckIfSignedInFailSafe_Parms CheckIfSignedInFailSafe_Parms;
 
@@ -2833,10 +2682,9 @@ bool USFXGUI_MPLobby_DLC::CheckIfSignedInFailSafe ( )
 
 struct FString USFXGUI_MPLobby_DLC::GetGAWZoneBonusText ( int MapId )
 {
-	static UFunction* pFnGetGAWZoneBonusText = NULL;
-
+	UFunction* pFnGetGAWZoneBonusText = (UFunction*) SdkBindings::Get ( 6723 );
 	if ( ! pFnGetGAWZoneBonusText )
-		pFnGetGAWZoneBonusText = (UFunction*) UObject::GObjObjects()->Data[ 110262 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetGAWZoneBonusText_Parms GetGAWZoneBonusText_Parms;
 	GetGAWZoneBonusText_Parms.MapId = MapId;
@@ -2853,10 +2701,9 @@ struct FString USFXGUI_MPLobby_DLC::GetGAWZoneBonusText ( int MapId )
 
 bool USFXGUI_MPLobby_DLC::CameFromSelectFirstCharacter ( )
 {
-	static UFunction* pFnCameFromSelectFirstCharacter = NULL;
-
+	UFunction* pFnCameFromSelectFirstCharacter = (UFunction*) SdkBindings::Get ( 6722 );
 	if ( ! pFnCameFromSelectFirstCharacter )
-		pFnCameFromSelectFirstCharacter = (UFunction*) UObject::GObjObjects()->Data[ 110259 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execCameFromSelectFirstCharacter_Parms CameFromSelectFirstCharacter_Parms;
 
@@ -2871,10 +2718,9 @@ bool USFXGUI_MPLobby_DLC::CameFromSelectFirstCharacter ( )
 
 void USFXGUI_MPLobby_DLC::ViewInvitations ( )
 {
-	static UFunction* pFnViewInvitations = NULL;
-
+	UFunction* pFnViewInvitations = (UFunction*) SdkBindings::Get ( 6721 );
 	if ( ! pFnViewInvitations )
-		pFnViewInvitations = (UFunction*) UObject::GObjObjects()->Data[ 110257 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execViewInvitations_Parms ViewInvitations_Parms;
 
@@ -2889,10 +2735,9 @@ void USFXGUI_MPLobby_DLC::ViewInvitations ( )
 
 int USFXGUI_MPLobby_DLC::GetMapZoneID ( struct FString MapName )
 {
-	static UFunction* pFnGetMapZoneID = NULL;
-
+	UFunction* pFnGetMapZoneID = (UFunction*) SdkBindings::Get ( 6720 );
 	if ( ! pFnGetMapZoneID )
-		pFnGetMapZoneID = (UFunction*) UObject::GObjObjects()->Data[ 110250 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetMapZoneID_Parms GetMapZoneID_Parms;
 	memcpy ( &GetMapZoneID_Parms.MapName, &MapName, 0xC );
@@ -2910,10 +2755,9 @@ int USFXGUI_MPLobby_DLC::GetMapZoneID ( struct FString MapName )
 
 struct FString USFXGUI_MPLobby_DLC::GetFormattedReadinessPercentage ( int nReadiness )
 {
-	static UFunction* pFnGetFormattedReadinessPercentage = NULL;
-
+	UFunction* pFnGetFormattedReadinessPercentage = (UFunction*) SdkBindings::Get ( 6719 );
 	if ( ! pFnGetFormattedReadinessPercentage )
-		pFnGetFormattedReadinessPercentage = (UFunction*) UObject::GObjObjects()->Data[ 110245 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetFormattedReadinessPercentage_Parms GetFormattedReadinessPercentage_Parms;
 	GetFormattedReadinessPercentage_Parms.nReadiness = nReadiness;
@@ -2930,10 +2774,9 @@ struct FString USFXGUI_MPLobby_DLC::GetFormattedReadinessPercentage ( int nReadi
 
 bool USFXGUI_MPLobby_DLC::ShouldShowChatDisabledMessage ( )
 {
-	static UFunction* pFnShouldShowChatDisabledMessage = NULL;
-
+	UFunction* pFnShouldShowChatDisabledMessage = (UFunction*) SdkBindings::Get ( 6718 );
 	if ( ! pFnShouldShowChatDisabledMessage )
-		pFnShouldShowChatDisabledMessage = (UFunction*) UObject::GObjObjects()->Data[ 110241 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execShouldShowChatDisabledMessage_Parms ShouldShowChatDisabledMessage_Parms;
 
@@ -2948,10 +2791,9 @@ bool USFXGUI_MPLobby_DLC::ShouldShowChatDisabledMessage ( )
 
 void USFXGUI_MPLobby_DLC::PreloadLobbyImages ( )
 {
-	static UFunction* pFnPreloadLobbyImages = NULL;
-
+	UFunction* pFnPreloadLobbyImages = (UFunction*) SdkBindings::Get ( 6601 );
 	if ( ! pFnPreloadLobbyImages )
-		pFnPreloadLobbyImages = (UFunction*) UObject::GObjObjects()->Data[ 109894 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execPreloadLobbyImages_Parms PreloadLobbyImages_Parms;
 
@@ -2965,10 +2807,9 @@ void USFXGUI_MPLobby_DLC::PreloadLobbyImages ( )
 
 bool USFXGUI_MPLobby_DLC::IsHostingNewMission ( )
 {
-	static UFunction* pFnIsHostingNewMission = NULL;
-
+	UFunction* pFnIsHostingNewMission = (UFunction*) SdkBindings::Get ( 6717 );
 	if ( ! pFnIsHostingNewMission )
-		pFnIsHostingNewMission = (UFunction*) UObject::GObjObjects()->Data[ 110226 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execIsHostingNewMission_Parms IsHostingNewMission_Parms;
 
@@ -2984,10 +2825,9 @@ bool USFXGUI_MPLobby_DLC::IsHostingNewMission ( )
 
 int USFXGUI_MPLobby_DLC::GetMaxActiveConsumables ( )
 {
-	static UFunction* pFnGetMaxActiveConsumables = NULL;
-
+	UFunction* pFnGetMaxActiveConsumables = (UFunction*) SdkBindings::Get ( 6715 );
 	if ( ! pFnGetMaxActiveConsumables )
-		pFnGetMaxActiveConsumables = (UFunction*) UObject::GObjObjects()->Data[ 110223 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetMaxActiveConsumables_Parms GetMaxActiveConsumables_Parms;
 
@@ -3005,10 +2845,9 @@ int USFXGUI_MPLobby_DLC::GetMaxActiveConsumables ( )
 
 struct FString USFXGUI_MPLobby_DLC::GetEnemyBonusText ( int EnemyIndex, unsigned long UseXP )
 {
-	static UFunction* pFnGetEnemyBonusText = NULL;
-
+	UFunction* pFnGetEnemyBonusText = (UFunction*) SdkBindings::Get ( 6716 );
 	if ( ! pFnGetEnemyBonusText )
-		pFnGetEnemyBonusText = (UFunction*) UObject::GObjObjects()->Data[ 110225 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetEnemyBonusText_Parms GetEnemyBonusText_Parms;
 	GetEnemyBonusText_Parms.EnemyIndex = EnemyIndex;
@@ -3028,10 +2867,9 @@ struct FString USFXGUI_MPLobby_DLC::GetEnemyBonusText ( int EnemyIndex, unsigned
 
 struct FString USFXGUI_MPLobby_DLC::GetMapBonusText ( int MapIndex, unsigned long UseXP )
 {
-	static UFunction* pFnGetMapBonusText = NULL;
-
+	UFunction* pFnGetMapBonusText = (UFunction*) SdkBindings::Get ( 6733 );
 	if ( ! pFnGetMapBonusText )
-		pFnGetMapBonusText = (UFunction*) UObject::GObjObjects()->Data[ 110311 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetMapBonusText_Parms GetMapBonusText_Parms;
 	GetMapBonusText_Parms.MapIndex = MapIndex;
@@ -3049,10 +2887,9 @@ struct FString USFXGUI_MPLobby_DLC::GetMapBonusText ( int MapIndex, unsigned lon
 
 struct FString USFXGUI_MPLobby_DLC::GetRandomEnemyBonusText ( )
 {
-	static UFunction* pFnGetRandomEnemyBonusText = NULL;
-
+	UFunction* pFnGetRandomEnemyBonusText = (UFunction*) SdkBindings::Get ( 6714 );
 	if ( ! pFnGetRandomEnemyBonusText )
-		pFnGetRandomEnemyBonusText = (UFunction*) UObject::GObjObjects()->Data[ 110221 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetRandomEnemyBonusText_Parms GetRandomEnemyBonusText_Parms;
 
@@ -3068,10 +2905,9 @@ struct FString USFXGUI_MPLobby_DLC::GetRandomEnemyBonusText ( )
 
 struct FString USFXGUI_MPLobby_DLC::GetRandomMapBonusText ( )
 {
-	static UFunction* pFnGetRandomMapBonusText = NULL;
-
+	UFunction* pFnGetRandomMapBonusText = (UFunction*) SdkBindings::Get ( 6713 );
 	if ( ! pFnGetRandomMapBonusText )
-		pFnGetRandomMapBonusText = (UFunction*) UObject::GObjObjects()->Data[ 110219 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetRandomMapBonusText_Parms GetRandomMapBonusText_Parms;
 
@@ -3087,10 +2923,9 @@ struct FString USFXGUI_MPLobby_DLC::GetRandomMapBonusText ( )
 
 void USFXGUI_MPLobby_DLC::ChangeMapMusic ( int nMapId )
 {
-	static UFunction* pFnChangeMapMusic = NULL;
-
+	UFunction* pFnChangeMapMusic = (UFunction*) SdkBindings::Get ( 6712 );
 	if ( ! pFnChangeMapMusic )
-		pFnChangeMapMusic = (UFunction*) UObject::GObjObjects()->Data[ 110217 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execChangeMapMusic_Parms ChangeMapMusic_Parms;
 	ChangeMapMusic_Parms.nMapId = nMapId;
@@ -3106,10 +2941,9 @@ void USFXGUI_MPLobby_DLC::ChangeMapMusic ( int nMapId )
 
 void USFXGUI_MPLobby_DLC::VoteToKickPlayerInSlot ( int SlotIndex, unsigned long bKick )
 {
-	static UFunction* pFnVoteToKickPlayerInSlot = NULL;
-
+	UFunction* pFnVoteToKickPlayerInSlot = (UFunction*) SdkBindings::Get ( 6711 );
 	if ( ! pFnVoteToKickPlayerInSlot )
-		pFnVoteToKickPlayerInSlot = (UFunction*) UObject::GObjObjects()->Data[ 110212 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execVoteToKickPlayerInSlot_Parms VoteToKickPlayerInSlot_Parms;
 	VoteToKickPlayerInSlot_Parms.SlotIndex = SlotIndex;
@@ -3126,10 +2960,9 @@ void USFXGUI_MPLobby_DLC::VoteToKickPlayerInSlot ( int SlotIndex, unsigned long
 
 bool USFXGUI_MPLobby_DLC::HasVotedToKickPlayerInSlot ( int SlotIndex )
 {
-	static UFunction* pFnHasVotedToKickPlayerInSlot = NULL;
-
+	UFunction* pFnHasVotedToKickPlayerInSlot = (UFunction*) SdkBindings::Get ( 6710 );
 	if ( ! pFnHasVotedToKickPlayerInSlot )
-		pFnHasVotedToKickPlayerInSlot = (UFunction*) UObject::GObjObjects()->Data[ 110207 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execHasVotedToKickPlayerInSlot_Parms HasVotedToKickPlayerInSlot_Parms;
 	HasVotedToKickPlayerInSlot_Parms.SlotIndex = SlotIndex;
@@ -3145,10 +2978,9 @@ bool USFXGUI_MPLobby_DLC::HasVotedToKickPlayerInSlot ( int SlotIndex )
 
 void USFXGUI_MPLobby_DLC::ClearAllNewWeaponNotifications ( )
 {
-	static UFunction* pFnClearAllNewWeaponNotifications = NULL;
-
+	UFunction* pFnClearAllNewWeaponNotifications = (UFunction*) SdkBindings::Get ( 6605 );
 	if ( ! pFnClearAllNewWeaponNotifications )
-		pFnClearAllNewWeaponNotifications = (UFunction*) UObject::GObjObjects()->Data[ 109899 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execClearAllNewWeaponNotifications_Parms ClearAllNewWeaponNotifications_Parms;
 
@@ -3162,10 +2994,9 @@ void USFXGUI_MPLobby_DLC::ClearAllNewWeaponNotifications ( )
 
 bool USFXGUI_MPLobby_DLC::CanAffordNewStoreItems ( )
 {
-	static UFunction* pFnCanAffordNewStoreItems = NULL;
-
+	UFunction* pFnCanAffordNewStoreItems = (UFunction*) SdkBindings::Get ( 6709 );
 	if ( ! pFnCanAffordNewStoreItems )
-		pFnCanAffordNewStoreItems = (UFunction*) UObject::GObjObjects()->Data[ 110202 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execCanAffordNewStoreItems_Parms CanAffordNewStoreItems_Parms;
 
@@ -3181,10 +3012,9 @@ bool USFXGUI_MPLobby_DLC::CanAffordNewStoreItems ( )
 
 bool USFXGUI_MPLobby_DLC::HasNewMatchConsumables ( )
 {
-	static UFunction* pFnHasNewMatchConsumables = NULL;
-
+	UFunction* pFnHasNewMatchConsumables = (UFunction*) SdkBindings::Get ( 6708 );
 	if ( ! pFnHasNewMatchConsumables )
-		pFnHasNewMatchConsumables = (UFunction*) UObject::GObjObjects()->Data[ 110199 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execHasNewMatchConsumables_Parms HasNewMatchConsumables_Parms;
 
@@ -3200,10 +3030,9 @@ bool USFXGUI_MPLobby_DLC::HasNewMatchConsumables ( )
 
 bool USFXGUI_MPLobby_DLC::HasNewAppearanceOptions ( )
 {
-	static UFunction* pFnHasNewAppearanceOptions = NULL;
-
+	UFunction* pFnHasNewAppearanceOptions = (UFunction*) SdkBindings::Get ( 6707 );
 	if ( ! pFnHasNewAppearanceOptions )
-		pFnHasNewAppearanceOptions = (UFunction*) UObject::GObjObjects()->Data[ 110195 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execHasNewAppearanceOptions_Parms HasNewAppearanceOptions_Parms;
 
@@ -3219,10 +3048,9 @@ bool USFXGUI_MPLobby_DLC::HasNewAppearanceOptions ( )
 
 bool USFXGUI_MPLobby_DLC::HasNewWeapons ( )
 {
-	static UFunction* pFnHasNewWeapons = NULL;
-
+	UFunction* pFnHasNewWeapons = (UFunction*) SdkBindings::Get ( 6706 );
 	if ( ! pFnHasNewWeapons )
-		pFnHasNewWeapons = (UFunction*) UObject::GObjObjects()->Data[ 110191 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execHasNewWeapons_Parms HasNewWeapons_Parms;
 
@@ -3238,10 +3066,9 @@ bool USFXGUI_MPLobby_DLC::HasNewWeapons ( )
 
 void USFXGUI_MPLobby_DLC::ToggleMuteForSlot ( int SlotIndex )
 {
-	static UFunction* pFnToggleMuteForSlot = NULL;
-
+	UFunction* pFnToggleMuteForSlot = (UFunction*) SdkBindings::Get ( 6705 );
 	if ( ! pFnToggleMuteForSlot )
-		pFnToggleMuteForSlot = (UFunction*) UObject::GObjObjects()->Data[ 110186 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execToggleMuteForSlot_Parms ToggleMuteForSlot_Parms;
 	ToggleMuteForSlot_Parms.SlotIndex = SlotIndex;
@@ -3257,10 +3084,9 @@ void USFXGUI_MPLobby_DLC::ToggleMuteForSlot ( int SlotIndex )
 
 void USFXGUI_MPLobby_DLC::SetPreviouslySelectedItem ( int Subscreen, int ItemIndex )
 {
-	static UFunction* pFnSetPreviouslySelectedItem = NULL;
-
+	UFunction* pFnSetPreviouslySelectedItem = (UFunction*) SdkBindings::Get ( 6704 );
 	if ( ! pFnSetPreviouslySelectedItem )
-		pFnSetPreviouslySelectedItem = (UFunction*) UObject::GObjObjects()->Data[ 110183 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execSetPreviouslySelectedItem_Parms SetPreviouslySelectedItem_Parms;
 	SetPreviouslySelectedItem_Parms.Subscreen = Subscreen;
@@ -3277,10 +3103,9 @@ void USFXGUI_MPLobby_DLC::SetPreviouslySelectedItem ( int Subscreen, int ItemInd
 
 int USFXGUI_MPLobby_DLC::GetPreviouslySelectedItem ( int Subscreen )
 {
-	static UFunction* pFnGetPreviouslySelectedItem = NULL;
-
+	UFunction* pFnGetPreviouslySelectedItem = (UFunction*) SdkBindings::Get ( 6703 );
 	if ( ! pFnGetPreviouslySelectedItem )
-		pFnGetPreviouslySelectedItem = (UFunction*) UObject::GObjObjects()->Data[ 110179 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetPreviouslySelectedItem_Parms GetPreviouslySelectedItem_Parms;
 	GetPreviouslySelectedItem_Parms.Subscreen = Subscreen;
@@ -3296,10 +3121,9 @@ int USFXGUI_MPLobby_DLC::GetPreviouslySelectedItem ( int Subscreen )
 
 void USFXGUI_MPLobby_DLC::CancelMatchSettings ( )
 {
-	static UFunction* pFnCancelMatchSettings = NULL;
-
+	UFunction* pFnCancelMatchSettings = (UFunction*) SdkBindings::Get ( 6702 );
 	if ( ! pFnCancelMatchSettings )
-		pFnCancelMatchSettings = (UFunction*) UObject::GObjObjects()->Data[ 110178 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execCancelMatchSettings_Parms CancelMatchSettings_Parms;
 
@@ -3312,10 +3136,9 @@ void USFXGUI_MPLobby_DLC::CancelMatchSettings ( )
 
 void USFXGUI_MPLobby_DLC::ChangeMatchSettings ( )
 {
-	static UFunction* pFnChangeMatchSettings = NULL;
-
+	UFunction* pFnChangeMatchSettings = (UFunction*) SdkBindings::Get ( 6700 );
 	if ( ! pFnChangeMatchSettings )
-		pFnChangeMatchSettings = (UFunction*) UObject::GObjObjects()->Data[ 110170 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execChangeMatchSettings_Parms ChangeMatchSettings_Parms;
 
@@ -3329,10 +3152,9 @@ void USFXGUI_MPLobby_DLC::ChangeMatchSettings ( )
 
 int USFXGUI_MPLobby_DLC::GetCredits ( )
 {
-	static UFunction* pFnGetCredits = NULL;
-
+	UFunction* pFnGetCredits = (UFunction*) SdkBindings::Get ( 6699 );
 	if ( ! pFnGetCredits )
-		pFnGetCredits = (UFunction*) UObject::GObjObjects()->Data[ 110168 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetCredits_Parms GetCredits_Parms;
 
@@ -3347,10 +3169,9 @@ int USFXGUI_MPLobby_DLC::GetCredits ( )
 
 void USFXGUI_MPLobby_DLC::QuickMatch ( )
 {
-	static UFunction* pFnQuickMatch = NULL;
-
+	UFunction* pFnQuickMatch = (UFunction*) SdkBindings::Get ( 6698 );
 	if ( ! pFnQuickMatch )
-		pFnQuickMatch = (UFunction*) UObject::GObjObjects()->Data[ 110167 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execQuickMatch_Parms QuickMatch_Parms;
 
@@ -3363,10 +3184,9 @@ void USFXGUI_MPLobby_DLC::QuickMatch ( )
 
 void USFXGUI_MPLobby_DLC::SwitchCharacter ( )
 {
-	static UFunction* pFnSwitchCharacter = NULL;
-
+	UFunction* pFnSwitchCharacter = (UFunction*) SdkBindings::Get ( 6696 );
 	if ( ! pFnSwitchCharacter )
-		pFnSwitchCharacter = (UFunction*) UObject::GObjObjects()->Data[ 110164 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execSwitchCharacter_Parms SwitchCharacter_Parms;
 
@@ -3379,10 +3199,9 @@ void USFXGUI_MPLobby_DLC::SwitchCharacter ( )
 
 void USFXGUI_MPLobby_DLC::ShowOptionsScreen ( )
 {
-	static UFunction* pFnShowOptionsScreen = NULL;
-
+	UFunction* pFnShowOptionsScreen = (UFunction*) SdkBindings::Get ( 6694 );
 	if ( ! pFnShowOptionsScreen )
-		pFnShowOptionsScreen = (UFunction*) UObject::GObjObjects()->Data[ 110162 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execShowOptionsScreen_Parms ShowOptionsScreen_Parms;
 
@@ -3395,10 +3214,9 @@ void USFXGUI_MPLobby_DLC::ShowOptionsScreen ( )
 
 void USFXGUI_MPLobby_DLC::ShowLeaderboardScreen ( )
 {
-	static UFunction* pFnShowLeaderboardScreen = NULL;
-
+	UFunction* pFnShowLeaderboardScreen = (UFunction*) SdkBindings::Get ( 6692 );
 	if ( ! pFnShowLeaderboardScreen )
-		pFnShowLeaderboardScreen = (UFunction*) UObject::GObjObjects()->Data[ 110160 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execShowLeaderboardScreen_Parms ShowLeaderboardScreen_Parms;
 
@@ -3411,10 +3229,9 @@ void USFXGUI_MPLobby_DLC::ShowLeaderboardScreen ( )
 
 void USFXGUI_MPLobby_DLC::ShowMatchConsumablesScreen ( )
 {
-	static UFunction* pFnShowMatchConsumablesScreen = NULL;
-
+	UFunction* pFnShowMatchConsumablesScreen = (UFunction*) SdkBindings::Get ( 6690 );
 	if ( ! pFnShowMatchConsumablesScreen )
-		pFnShowMatchConsumablesScreen = (UFunction*) UObject::GObjObjects()->Data[ 110158 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execShowMatchConsumablesScreen_Parms ShowMatchConsumablesScreen_Parms;
 
@@ -3427,10 +3244,9 @@ void USFXGUI_MPLobby_DLC::ShowMatchConsumablesScreen ( )
 
 void USFXGUI_MPLobby_DLC::ShowAppearanceScreen ( )
 {
-	static UFunction* pFnShowAppearanceScreen = NULL;
-
+	UFunction* pFnShowAppearanceScreen = (UFunction*) SdkBindings::Get ( 6688 );
 	if ( ! pFnShowAppearanceScreen )
-		pFnShowAppearanceScreen = (UFunction*) UObject::GObjObjects()->Data[ 110155 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execShowAppearanceScreen_Parms ShowAppearanceScreen_Parms;
 
@@ -3443,10 +3259,9 @@ void USFXGUI_MPLobby_DLC::ShowAppearanceScreen ( )
 
 void USFXGUI_MPLobby_DLC::ShowStoreScreen ( )
 {
-	static UFunction* pFnShowStoreScreen = NULL;
-
+	UFunction* pFnShowStoreScreen = (UFunction*) SdkBindings::Get ( 6686 );
 	if ( ! pFnShowStoreScreen )
-		pFnShowStoreScreen = (UFunction*) UObject::GObjObjects()->Data[ 110153 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execShowStoreScreen_Parms ShowStoreScreen_Parms;
 
@@ -3459,10 +3274,9 @@ void USFXGUI_MPLobby_DLC::ShowStoreScreen ( )
 
 void USFXGUI_MPLobby_DLC::ShowWeaponsScreen ( )
 {
-	static UFunction* pFnShowWeaponsScreen = NULL;
-
+	UFunction* pFnShowWeaponsScreen = (UFunction*) SdkBindings::Get ( 6684 );
 	if ( ! pFnShowWeaponsScreen )
-		pFnShowWeaponsScreen = (UFunction*) UObject::GObjObjects()->Data[ 110151 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execShowWeaponsScreen_Parms ShowWeaponsScreen_Parms;
 
@@ -3475,10 +3289,9 @@ void USFXGUI_MPLobby_DLC::ShowWeaponsScreen ( )
 
 void USFXGUI_MPLobby_DLC::ShowTalentsLevelUpScreen ( )
 {
-	static UFunction* pFnShowTalentsLevelUpScreen = NULL;
-
+	UFunction* pFnShowTalentsLevelUpScreen = (UFunction*) SdkBindings::Get ( 6682 );
 	if ( ! pFnShowTalentsLevelUpScreen )
-		pFnShowTalentsLevelUpScreen = (UFunction*) UObject::GObjObjects()->Data[ 110148 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execShowTalentsLevelUpScreen_Parms ShowTalentsLevelUpScreen_Parms;
 
@@ -3491,10 +3304,9 @@ void USFXGUI_MPLobby_DLC::ShowTalentsLevelUpScreen ( )
 
 void USFXGUI_MPLobby_DLC::ShowMatchSettingsScreen ( )
 {
-	static UFunction* pFnShowMatchSettingsScreen = NULL;
-
+	UFunction* pFnShowMatchSettingsScreen = (UFunction*) SdkBindings::Get ( 6680 );
 	if ( ! pFnShowMatchSettingsScreen )
-		pFnShowMatchSettingsScreen = (UFunction*) UObject::GObjObjects()->Data[ 110145 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execShowMatchSettingsScreen_Parms ShowMatchSettingsScreen_Parms;
 
@@ -3507,10 +3319,9 @@ void USFXGUI_MPLobby_DLC::ShowMatchSettingsScreen ( )
 
 void USFXGUI_MPLobby_DLC::HostNewMission ( )
 {
-	static UFunction* pFnHostNewMission = NULL;
-
+	UFunction* pFnHostNewMission = (UFunction*) SdkBindings::Get ( 6678 );
 	if ( ! pFnHostNewMission )
-		pFnHostNewMission = (UFunction*) UObject::GObjObjects()->Data[ 110143 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execHostNewMission_Parms HostNewMission_Parms;
 
@@ -3523,10 +3334,9 @@ void USFXGUI_MPLobby_DLC::HostNewMission ( )
 
 void USFXGUI_MPLobby_DLC::CustomMatch ( )
 {
-	static UFunction* pFnCustomMatch = NULL;
-
+	UFunction* pFnCustomMatch = (UFunction*) SdkBindings::Get ( 6675 );
 	if ( ! pFnCustomMatch )
-		pFnCustomMatch = (UFunction*) UObject::GObjObjects()->Data[ 110140 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execCustomMatch_Parms CustomMatch_Parms;
 
@@ -3539,10 +3349,9 @@ void USFXGUI_MPLobby_DLC::CustomMatch ( )
 
 void USFXGUI_MPLobby_DLC::ConfirmExitMultiplayer ( )
 {
-	static UFunction* pFnConfirmExitMultiplayer = NULL;
-
+	UFunction* pFnConfirmExitMultiplayer = (UFunction*) SdkBindings::Get ( 6673 );
 	if ( ! pFnConfirmExitMultiplayer )
-		pFnConfirmExitMultiplayer = (UFunction*) UObject::GObjObjects()->Data[ 110138 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execConfirmExitMultiplayer_Parms ConfirmExitMultiplayer_Parms;
 
@@ -3557,10 +3366,9 @@ void USFXGUI_MPLobby_DLC::ConfirmExitMultiplayer ( )
 
 void USFXGUI_MPLobby_DLC::ExitMultiplayerConfirmationPopupInputDelegate ( unsigned long bAPressed, int nContext )
 {
-	static UFunction* pFnExitMultiplayerConfirmationPopupInputDelegate = NULL;
-
+	UFunction* pFnExitMultiplayerConfirmationPopupInputDelegate = (UFunction*) SdkBindings::Get ( 6672 );
 	if ( ! pFnExitMultiplayerConfirmationPopupInputDelegate )
-		pFnExitMultiplayerConfirmationPopupInputDelegate = (UFunction*) UObject::GObjObjects()->Data[ 110135 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execExitMultiplayerConfirmationPopupInputDelegate_Parms ExitMultiplayerConfirmationPopupInputDelegate_Parms;
 	ExitMultiplayerConfirmationPopupInputDelegate_Parms.bAPressed = bAPressed;
@@ -3575,10 +3383,9 @@ void USFXGUI_MPLobby_DLC::ExitMultiplayerConfirmationPopupInputDelegate ( unsign
 
 void USFXGUI_MPLobby_DLC::ShowExitMultiplayerConfirmationPopup ( )
 {
-	static UFunction* pFnShowExitMultiplayerConfirmationPopup = NULL;
-
+	UFunction* pFnShowExitMultiplayerConfirmationPopup = (UFunction*) SdkBindings::Get ( 6671 );
 	if ( ! pFnShowExitMultiplayerConfirmationPopup )
-		pFnShowExitMultiplayerConfirmationPopup = (UFunction*) UObject::GObjObjects()->Data[ 110130 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execShowExitMultiplayerConfirmationPopup_Parms ShowExitMultiplayerConfirmationPopup_Parms;
 
@@ -3591,10 +3398,9 @@ void USFXGUI_MPLobby_DLC::ShowExitMultiplayerConfirmationPopup ( )
 
 void USFXGUI_MPLobby_DLC::ExitMultiplayer ( )
 {
-	static UFunction* pFnExitMultiplayer = NULL;
-
+	UFunction* pFnExitMultiplayer = (UFunction*) SdkBindings::Get ( 6670 );
 	if ( ! pFnExitMultiplayer )
-		pFnExitMultiplayer = (UFunction*) UObject::GObjObjects()->Data[ 110129 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execExitMultiplayer_Parms ExitMultiplayer_Parms;
 
@@ -3607,10 +3413,9 @@ void USFXGUI_MPLobby_DLC::ExitMultiplayer ( )
 
 void USFXGUI_MPLobby_DLC::GoBackToSelectFirstCharacter ( )
 {
-	static UFunction* pFnGoBackToSelectFirstCharacter = NULL;
-
+	UFunction* pFnGoBackToSelectFirstCharacter = (UFunction*) SdkBindings::Get ( 6668 );
 	if ( ! pFnGoBackToSelectFirstCharacter )
-		pFnGoBackToSelectFirstCharacter = (UFunction*) UObject::GObjObjects()->Data[ 110127 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execGoBackToSelectFirstCharacter_Parms GoBackToSelectFirstCharacter_Parms;
 
@@ -3623,10 +3428,9 @@ void USFXGUI_MPLobby_DLC::GoBackToSelectFirstCharacter ( )
 
 void USFXGUI_MPLobby_DLC::ConfirmExitLobby ( )
 {
-	static UFunction* pFnConfirmExitLobby = NULL;
-
+	UFunction* pFnConfirmExitLobby = (UFunction*) SdkBindings::Get ( 6667 );
 	if ( ! pFnConfirmExitLobby )
-		pFnConfirmExitLobby = (UFunction*) UObject::GObjObjects()->Data[ 110124 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execConfirmExitLobby_Parms ConfirmExitLobby_Parms;
 
@@ -3641,10 +3445,9 @@ void USFXGUI_MPLobby_DLC::ConfirmExitLobby ( )
 
 void USFXGUI_MPLobby_DLC::ExitLobbyPopupInputDelegate ( unsigned long bAPressed, int nContext )
 {
-	static UFunction* pFnExitLobbyPopupInputDelegate = NULL;
-
+	UFunction* pFnExitLobbyPopupInputDelegate = (UFunction*) SdkBindings::Get ( 6666 );
 	if ( ! pFnExitLobbyPopupInputDelegate )
-		pFnExitLobbyPopupInputDelegate = (UFunction*) UObject::GObjObjects()->Data[ 110121 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execExitLobbyPopupInputDelegate_Parms ExitLobbyPopupInputDelegate_Parms;
 	ExitLobbyPopupInputDelegate_Parms.bAPressed = bAPressed;
@@ -3659,10 +3462,9 @@ void USFXGUI_MPLobby_DLC::ExitLobbyPopupInputDelegate ( unsigned long bAPressed,
 
 void USFXGUI_MPLobby_DLC::ExitLobby ( )
 {
-	static UFunction* pFnExitLobby = NULL;
-
+	UFunction* pFnExitLobby = (UFunction*) SdkBindings::Get ( 6665 );
 	if ( ! pFnExitLobby )
-		pFnExitLobby = (UFunction*) UObject::GObjObjects()->Data[ 110115 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execExitLobby_Parms ExitLobby_Parms;
 
@@ -3675,10 +3477,9 @@ void USFXGUI_MPLobby_DLC::ExitLobby ( )
 
 void USFXGUI_MPLobby_DLC::ShowPartySessions ( )
 {
-	static UFunction* pFnShowPartySessions = NULL;
-
+	UFunction* pFnShowPartySessions = (UFunction*) SdkBindings::Get ( 6664 );
 	if ( ! pFnShowPartySessions )
-		pFnShowPartySessions = (UFunction*) UObject::GObjObjects()->Data[ 110112 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execShowPartySessions_Parms ShowPartySessions_Parms;
 
@@ -3691,10 +3492,9 @@ void USFXGUI_MPLobby_DLC::ShowPartySessions ( )
 
 void USFXGUI_MPLobby_DLC::InviteParty ( )
 {
-	static UFunction* pFnInviteParty = NULL;
-
+	UFunction* pFnInviteParty = (UFunction*) SdkBindings::Get ( 6663 );
 	if ( ! pFnInviteParty )
-		pFnInviteParty = (UFunction*) UObject::GObjObjects()->Data[ 110110 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execInviteParty_Parms InviteParty_Parms;
 
@@ -3708,10 +3508,9 @@ void USFXGUI_MPLobby_DLC::InviteParty ( )
 
 bool USFXGUI_MPLobby_DLC::IsInParty ( )
 {
-	static UFunction* pFnIsInParty = NULL;
-
+	UFunction* pFnIsInParty = (UFunction*) SdkBindings::Get ( 6610 );
 	if ( ! pFnIsInParty )
-		pFnIsInParty = (UFunction*) UObject::GObjObjects()->Data[ 109907 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execIsInParty_Parms IsInParty_Parms;
 
@@ -3726,10 +3525,9 @@ bool USFXGUI_MPLobby_DLC::IsInParty ( )
 
 void USFXGUI_MPLobby_DLC::InviteFriends ( )
 {
-	static UFunction* pFnInviteFriends = NULL;
-
+	UFunction* pFnInviteFriends = (UFunction*) SdkBindings::Get ( 6662 );
 	if ( ! pFnInviteFriends )
-		pFnInviteFriends = (UFunction*) UObject::GObjObjects()->Data[ 110101 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execInviteFriends_Parms InviteFriends_Parms;
 
@@ -3743,10 +3541,9 @@ void USFXGUI_MPLobby_DLC::InviteFriends ( )
 
 void USFXGUI_MPLobby_DLC::ShowGamercard ( int SlotIndex )
 {
-	static UFunction* pFnShowGamercard = NULL;
-
+	UFunction* pFnShowGamercard = (UFunction*) SdkBindings::Get ( 6661 );
 	if ( ! pFnShowGamercard )
-		pFnShowGamercard = (UFunction*) UObject::GObjObjects()->Data[ 110097 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execShowGamercard_Parms ShowGamercard_Parms;
 	ShowGamercard_Parms.SlotIndex = SlotIndex;
@@ -3761,10 +3558,9 @@ void USFXGUI_MPLobby_DLC::ShowGamercard ( int SlotIndex )
 
 void USFXGUI_MPLobby_DLC::SetReady ( unsigned long Ready )
 {
-	static UFunction* pFnSetReady = NULL;
-
+	UFunction* pFnSetReady = (UFunction*) SdkBindings::Get ( 6660 );
 	if ( ! pFnSetReady )
-		pFnSetReady = (UFunction*) UObject::GObjObjects()->Data[ 110095 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execSetReady_Parms SetReady_Parms;
 	SetReady_Parms.Ready = Ready;
@@ -3779,10 +3575,9 @@ void USFXGUI_MPLobby_DLC::SetReady ( unsigned long Ready )
 
 struct FString USFXGUI_MPLobby_DLC::GetLeaderboardNotificationText ( )
 {
-	static UFunction* pFnGetLeaderboardNotificationText = NULL;
-
+	UFunction* pFnGetLeaderboardNotificationText = (UFunction*) SdkBindings::Get ( 6659 );
 	if ( ! pFnGetLeaderboardNotificationText )
-		pFnGetLeaderboardNotificationText = (UFunction*) UObject::GObjObjects()->Data[ 110092 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetLeaderboardNotificationText_Parms GetLeaderboardNotificationText_Parms;
 
@@ -3798,10 +3593,9 @@ struct FString USFXGUI_MPLobby_DLC::GetLeaderboardNotificationText ( )
 
 bool USFXGUI_MPLobby_DLC::HasLeaderboardNotifications ( )
 {
-	static UFunction* pFnHasLeaderboardNotifications = NULL;
-
+	UFunction* pFnHasLeaderboardNotifications = (UFunction*) SdkBindings::Get ( 6658 );
 	if ( ! pFnHasLeaderboardNotifications )
-		pFnHasLeaderboardNotifications = (UFunction*) UObject::GObjObjects()->Data[ 110090 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execHasLeaderboardNotifications_Parms HasLeaderboardNotifications_Parms;
 
@@ -3817,10 +3611,9 @@ bool USFXGUI_MPLobby_DLC::HasLeaderboardNotifications ( )
 
 int USFXGUI_MPLobby_DLC::GetPreviousSubScreen ( )
 {
-	static UFunction* pFnGetPreviousSubScreen = NULL;
-
+	UFunction* pFnGetPreviousSubScreen = (UFunction*) SdkBindings::Get ( 6604 );
 	if ( ! pFnGetPreviousSubScreen )
-		pFnGetPreviousSubScreen = (UFunction*) UObject::GObjObjects()->Data[ 109898 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetPreviousSubScreen_Parms GetPreviousSubScreen_Parms;
 
@@ -3836,10 +3629,9 @@ int USFXGUI_MPLobby_DLC::GetPreviousSubScreen ( )
 
 bool USFXGUI_MPLobby_DLC::HasCreditsToSpend ( )
 {
-	static UFunction* pFnHasCreditsToSpend = NULL;
-
+	UFunction* pFnHasCreditsToSpend = (UFunction*) SdkBindings::Get ( 6656 );
 	if ( ! pFnHasCreditsToSpend )
-		pFnHasCreditsToSpend = (UFunction*) UObject::GObjObjects()->Data[ 110084 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execHasCreditsToSpend_Parms HasCreditsToSpend_Parms;
 
@@ -3855,10 +3647,9 @@ bool USFXGUI_MPLobby_DLC::HasCreditsToSpend ( )
 
 bool USFXGUI_MPLobby_DLC::HasTalentPointsToSpend ( )
 {
-	static UFunction* pFnHasTalentPointsToSpend = NULL;
-
+	UFunction* pFnHasTalentPointsToSpend = (UFunction*) SdkBindings::Get ( 6654 );
 	if ( ! pFnHasTalentPointsToSpend )
-		pFnHasTalentPointsToSpend = (UFunction*) UObject::GObjObjects()->Data[ 110080 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execHasTalentPointsToSpend_Parms HasTalentPointsToSpend_Parms;
 
@@ -3874,10 +3665,9 @@ bool USFXGUI_MPLobby_DLC::HasTalentPointsToSpend ( )
 
 bool USFXGUI_MPLobby_DLC::CanLevelUp ( )
 {
-	static UFunction* pFnCanLevelUp = NULL;
-
+	UFunction* pFnCanLevelUp = (UFunction*) SdkBindings::Get ( 6653 );
 	if ( ! pFnCanLevelUp )
-		pFnCanLevelUp = (UFunction*) UObject::GObjObjects()->Data[ 110078 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execCanLevelUp_Parms CanLevelUp_Parms;
 
@@ -3893,10 +3683,9 @@ bool USFXGUI_MPLobby_DLC::CanLevelUp ( )
 
 bool USFXGUI_MPLobby_DLC::IsReady ( )
 {
-	static UFunction* pFnIsReady = NULL;
-
+	UFunction* pFnIsReady = (UFunction*) SdkBindings::Get ( 6651 );
 	if ( ! pFnIsReady )
-		pFnIsReady = (UFunction*) UObject::GObjObjects()->Data[ 110075 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execIsReady_Parms IsReady_Parms;
 
@@ -3912,10 +3701,9 @@ bool USFXGUI_MPLobby_DLC::IsReady ( )
 
 int USFXGUI_MPLobby_DLC::GetPrivacy ( )
 {
-	static UFunction* pFnGetPrivacy = NULL;
-
+	UFunction* pFnGetPrivacy = (UFunction*) SdkBindings::Get ( 6652 );
 	if ( ! pFnGetPrivacy )
-		pFnGetPrivacy = (UFunction*) UObject::GObjObjects()->Data[ 110077 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetPrivacy_Parms GetPrivacy_Parms;
 
@@ -3931,10 +3719,9 @@ int USFXGUI_MPLobby_DLC::GetPrivacy ( )
 
 bool USFXGUI_MPLobby_DLC::IsPrivateMatch ( )
 {
-	static UFunction* pFnIsPrivateMatch = NULL;
-
+	UFunction* pFnIsPrivateMatch = (UFunction*) SdkBindings::Get ( 6650 );
 	if ( ! pFnIsPrivateMatch )
-		pFnIsPrivateMatch = (UFunction*) UObject::GObjObjects()->Data[ 110073 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execIsPrivateMatch_Parms IsPrivateMatch_Parms;
 
@@ -3950,10 +3737,9 @@ bool USFXGUI_MPLobby_DLC::IsPrivateMatch ( )
 
 bool USFXGUI_MPLobby_DLC::IsGameFull ( )
 {
-	static UFunction* pFnIsGameFull = NULL;
-
+	UFunction* pFnIsGameFull = (UFunction*) SdkBindings::Get ( 6649 );
 	if ( ! pFnIsGameFull )
-		pFnIsGameFull = (UFunction*) UObject::GObjObjects()->Data[ 110071 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execIsGameFull_Parms IsGameFull_Parms;
 
@@ -3969,10 +3755,9 @@ bool USFXGUI_MPLobby_DLC::IsGameFull ( )
 
 bool USFXGUI_MPLobby_DLC::CanInteract ( )
 {
-	static UFunction* pFnCanInteract = NULL;
-
+	UFunction* pFnCanInteract = (UFunction*) SdkBindings::Get ( 6611 );
 	if ( ! pFnCanInteract )
-		pFnCanInteract = (UFunction*) UObject::GObjObjects()->Data[ 109909 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execCanInteract_Parms CanInteract_Parms;
 
@@ -3989,10 +3774,9 @@ bool USFXGUI_MPLobby_DLC::CanInteract ( )
 
 int USFXGUI_MPLobby_DLC::GetMatchConsumableSlotTypeForCategory ( int Category )
 {
-	static UFunction* pFnGetMatchConsumableSlotTypeForCategory = NULL;
-
+	UFunction* pFnGetMatchConsumableSlotTypeForCategory = (UFunction*) SdkBindings::Get ( 6647 );
 	if ( ! pFnGetMatchConsumableSlotTypeForCategory )
-		pFnGetMatchConsumableSlotTypeForCategory = (UFunction*) UObject::GObjObjects()->Data[ 110066 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetMatchConsumableSlotTypeForCategory_Parms GetMatchConsumableSlotTypeForCategory_Parms;
 	GetMatchConsumableSlotTypeForCategory_Parms.Category = Category;
@@ -4010,10 +3794,9 @@ int USFXGUI_MPLobby_DLC::GetMatchConsumableSlotTypeForCategory ( int Category )
 
 struct FPlayerDisplayInfo_Patch USFXGUI_MPLobby_DLC::GetCharacterInfo_Patch ( class Asfxprimp* PRI )
 {
-	static UFunction* pFnGetCharacterInfo_Patch = NULL;
-
+	UFunction* pFnGetCharacterInfo_Patch = (UFunction*) SdkBindings::Get ( 6648 );
 	if ( ! pFnGetCharacterInfo_Patch )
-		pFnGetCharacterInfo_Patch = (UFunction*) UObject::GObjObjects()->Data[ 110069 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetCharacterInfo_Patch_Parms GetCharacterInfo_Patch_Parms;
 	GetCharacterInfo_Patch_Parms.PRI = PRI;
@@ -4031,10 +3814,9 @@ struct FPlayerDisplayInfo_Patch USFXGUI_MPLobby_DLC::GetCharacterInfo_Patch ( cl
 
 struct FPlayerDisplayInfo_Patch USFXGUI_MPLobby_DLC::GetPlayerSlotInfo_Patch ( int Index )
 {
-	static UFunction* pFnGetPlayerSlotInfo_Patch = NULL;
-
+	UFunction* pFnGetPlayerSlotInfo_Patch = (UFunction*) SdkBindings::Get ( 6734 );
 	if ( ! pFnGetPlayerSlotInfo_Patch )
-		pFnGetPlayerSlotInfo_Patch = (UFunction*) UObject::GObjObjects()->Data[ 110325 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetPlayerSlotInfo_Patch_Parms GetPlayerSlotInfo_Patch_Parms;
 	GetPlayerSlotInfo_Patch_Parms.Index = Index;
@@ -4052,10 +3834,9 @@ struct FPlayerDisplayInfo_Patch USFXGUI_MPLobby_DLC::GetPlayerSlotInfo_Patch ( i
 
 TArray< struct FMatchConsumableDisplayInfo > USFXGUI_MPLobby_DLC::GetCharacterConsumableInfo ( class Asfxprimp* PRI )
 {
-	static UFunction* pFnGetCharacterConsumableInfo = NULL;
-
+	UFunction* pFnGetCharacterConsumableInfo = (UFunction*) SdkBindings::Get ( 6643 );
 	if ( ! pFnGetCharacterConsumableInfo )
-		pFnGetCharacterConsumableInfo = (UFunction*) UObject::GObjObjects()->Data[ 110019 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetCharacterConsumableInfo_Parms GetCharacterConsumableInfo_Parms;
 	GetCharacterConsumableInfo_Parms.PRI = PRI;
@@ -4073,10 +3854,9 @@ TArray< struct FMatchConsumableDisplayInfo > USFXGUI_MPLobby_DLC::GetCharacterCo
 
 TArray< struct FWeaponDisplayInfo > USFXGUI_MPLobby_DLC::GetCharacterWeaponInfo ( class Asfxprimp* PRI )
 {
-	static UFunction* pFnGetCharacterWeaponInfo = NULL;
-
+	UFunction* pFnGetCharacterWeaponInfo = (UFunction*) SdkBindings::Get ( 6642 );
 	if ( ! pFnGetCharacterWeaponInfo )
-		pFnGetCharacterWeaponInfo = (UFunction*) UObject::GObjObjects()->Data[ 110018 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetCharacterWeaponInfo_Parms GetCharacterWeaponInfo_Parms;
 	GetCharacterWeaponInfo_Parms.PRI = PRI;
@@ -4094,10 +3874,9 @@ TArray< struct FWeaponDisplayInfo > USFXGUI_MPLobby_DLC::GetCharacterWeaponInfo
 
 TArray< struct FPowerDisplayInfo > USFXGUI_MPLobby_DLC::GetCharacterPowerInfo ( class Asfxprimp* PRI )
 {
-	static UFunction* pFnGetCharacterPowerInfo = NULL;
-
+	UFunction* pFnGetCharacterPowerInfo = (UFunction*) SdkBindings::Get ( 6641 );
 	if ( ! pFnGetCharacterPowerInfo )
-		pFnGetCharacterPowerInfo = (UFunction*) UObject::GObjObjects()->Data[ 110017 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetCharacterPowerInfo_Parms GetCharacterPowerInfo_Parms;
 	GetCharacterPowerInfo_Parms.PRI = PRI;
@@ -4115,10 +3894,9 @@ TArray< struct FPowerDisplayInfo > USFXGUI_MPLobby_DLC::GetCharacterPowerInfo (
 
 struct FPlayerDisplayInfo USFXGUI_MPLobby_DLC::GetCharacterInfoDetailed ( class Asfxprimp* PRI )
 {
-	static UFunction* pFnGetCharacterInfoDetailed = NULL;
-
+	UFunction* pFnGetCharacterInfoDetailed = (UFunction*) SdkBindings::Get ( 6638 );
 	if ( ! pFnGetCharacterInfoDetailed )
-		pFnGetCharacterInfoDetailed = (UFunction*) UObject::GObjObjects()->Data[ 109990 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetCharacterInfoDetailed_Parms GetCharacterInfoDetailed_Parms;
 	GetCharacterInfoDetailed_Parms.PRI = PRI;
@@ -4136,10 +3914,9 @@ struct FPlayerDisplayInfo USFXGUI_MPLobby_DLC::GetCharacterInfoDetailed ( class
 
 struct FPlayerDisplayInfo USFXGUI_MPLobby_DLC::GetCharacterInfoBasic ( class Asfxprimp* PRI )
 {
-	static UFunction* pFnGetCharacterInfoBasic = NULL;
-
+	UFunction* pFnGetCharacterInfoBasic = (UFunction*) SdkBindings::Get ( 6636 );
 	if ( ! pFnGetCharacterInfoBasic )
-		pFnGetCharacterInfoBasic = (UFunction*) UObject::GObjObjects()->Data[ 109986 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetCharacterInfoBasic_Parms GetCharacterInfoBasic_Parms;
 	GetCharacterInfoBasic_Parms.PRI = PRI;
@@ -4156,10 +3933,9 @@ struct FPlayerDisplayInfo USFXGUI_MPLobby_DLC::GetCharacterInfoBasic ( class Asf
 
 struct FPlayerDisplayInfo USFXGUI_MPLobby_DLC::GetLocalPlayerDetailedInfo ( )
 {
-	static UFunction* pFnGetLocalPlayerDetailedInfo = NULL;
-
+	UFunction* pFnGetLocalPlayerDetailedInfo = (UFunction*) SdkBindings::Get ( 6640 );
 	if ( ! pFnGetLocalPlayerDetailedInfo )
-		pFnGetLocalPlayerDetailedInfo = (UFunction*) UObject::GObjObjects()->Data[ 109993 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetLocalPlayerDetailedInfo_Parms GetLocalPlayerDetailedInfo_Parms;
 
@@ -4175,10 +3951,9 @@ struct FPlayerDisplayInfo USFXGUI_MPLobby_DLC::GetLocalPlayerDetailedInfo ( )
 
 struct FPlayerDisplayInfo USFXGUI_MPLobby_DLC::GetLocalPlayerBasicInfo ( )
 {
-	static UFunction* pFnGetLocalPlayerBasicInfo = NULL;
-
+	UFunction* pFnGetLocalPlayerBasicInfo = (UFunction*) SdkBindings::Get ( 6639 );
 	if ( ! pFnGetLocalPlayerBasicInfo )
-		pFnGetLocalPlayerBasicInfo = (UFunction*) UObject::GObjObjects()->Data[ 109991 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetLocalPlayerBasicInfo_Parms GetLocalPlayerBasicInfo_Parms;
 
@@ -4195,10 +3970,9 @@ struct FPlayerDisplayInfo USFXGUI_MPLobby_DLC::GetLocalPlayerBasicInfo ( )
 
 struct FPlayerDisplayInfo USFXGUI_MPLobby_DLC::GetPlayerSlotDetailedInfo ( int Index )
 {
-	static UFunction* pFnGetPlayerSlotDetailedInfo = NULL;
-
+	UFunction* pFnGetPlayerSlotDetailedInfo = (UFunction*) SdkBindings::Get ( 6637 );
 	if ( ! pFnGetPlayerSlotDetailedInfo )
-		pFnGetPlayerSlotDetailedInfo = (UFunction*) UObject::GObjObjects()->Data[ 109987 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetPlayerSlotDetailedInfo_Parms GetPlayerSlotDetailedInfo_Parms;
 	GetPlayerSlotDetailedInfo_Parms.Index = Index;
@@ -4216,10 +3990,9 @@ struct FPlayerDisplayInfo USFXGUI_MPLobby_DLC::GetPlayerSlotDetailedInfo ( int I
 
 struct FPlayerDisplayInfo USFXGUI_MPLobby_DLC::GetPlayerSlotBasicInfo ( int Index )
 {
-	static UFunction* pFnGetPlayerSlotBasicInfo = NULL;
-
+	UFunction* pFnGetPlayerSlotBasicInfo = (UFunction*) SdkBindings::Get ( 6635 );
 	if ( ! pFnGetPlayerSlotBasicInfo )
-		pFnGetPlayerSlotBasicInfo = (UFunction*) UObject::GObjObjects()->Data[ 109983 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetPlayerSlotBasicInfo_Parms GetPlayerSlotBasicInfo_Parms;
 	GetPlayerSlotBasicInfo_Parms.Index = Index;
@@ -4237,10 +4010,9 @@ struct FPlayerDisplayInfo USFXGUI_MPLobby_DLC::GetPlayerSlotBasicInfo ( int Inde
 
 class Asfxprimp* USFXGUI_MPLobby_DLC::GetPlayerInSlot ( int Index )
 {
-	static UFunction* pFnGetPlayerInSlot = NULL;
-
+	UFunction* pFnGetPlayerInSlot = (UFunction*) SdkBindings::Get ( 6634 );
 	if ( ! pFnGetPlayerInSlot )
-		pFnGetPlayerInSlot = (UFunction*) UObject::GObjObjects()->Data[ 109979 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetPlayerInSlot_Parms GetPlayerInSlot_Parms;
 	GetPlayerInSlot_Parms.Index = Index;
@@ -4257,10 +4029,9 @@ class Asfxprimp* USFXGUI_MPLobby_DLC::GetPlayerInSlot ( int Index )
 
 int USFXGUI_MPLobby_DLC::GetNumPlayers ( )
 {
-	static UFunction* pFnGetNumPlayers = NULL;
-
+	UFunction* pFnGetNumPlayers = (UFunction*) SdkBindings::Get ( 6633 );
 	if ( ! pFnGetNumPlayers )
-		pFnGetNumPlayers = (UFunction*) UObject::GObjObjects()->Data[ 109977 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetNumPlayers_Parms GetNumPlayers_Parms;
 
@@ -4276,10 +4047,9 @@ int USFXGUI_MPLobby_DLC::GetNumPlayers ( )
 
 int USFXGUI_MPLobby_DLC::GetNumPlayerSlots ( )
 {
-	static UFunction* pFnGetNumPlayerSlots = NULL;
-
+	UFunction* pFnGetNumPlayerSlots = (UFunction*) SdkBindings::Get ( 6632 );
 	if ( ! pFnGetNumPlayerSlots )
-		pFnGetNumPlayerSlots = (UFunction*) UObject::GObjObjects()->Data[ 109975 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetNumPlayerSlots_Parms GetNumPlayerSlots_Parms;
 
@@ -4295,10 +4065,9 @@ int USFXGUI_MPLobby_DLC::GetNumPlayerSlots ( )
 
 struct FString USFXGUI_MPLobby_DLC::GetLobbyStatusString ( )
 {
-	static UFunction* pFnGetLobbyStatusString = NULL;
-
+	UFunction* pFnGetLobbyStatusString = (UFunction*) SdkBindings::Get ( 6631 );
 	if ( ! pFnGetLobbyStatusString )
-		pFnGetLobbyStatusString = (UFunction*) UObject::GObjObjects()->Data[ 109973 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetLobbyStatusString_Parms GetLobbyStatusString_Parms;
 
@@ -4314,10 +4083,9 @@ struct FString USFXGUI_MPLobby_DLC::GetLobbyStatusString ( )
 
 struct FString USFXGUI_MPLobby_DLC::GetLobbyStatus ( )
 {
-	static UFunction* pFnGetLobbyStatus = NULL;
-
+	UFunction* pFnGetLobbyStatus = (UFunction*) SdkBindings::Get ( 6630 );
 	if ( ! pFnGetLobbyStatus )
-		pFnGetLobbyStatus = (UFunction*) UObject::GObjObjects()->Data[ 109971 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetLobbyStatus_Parms GetLobbyStatus_Parms;
 
@@ -4334,10 +4102,9 @@ struct FString USFXGUI_MPLobby_DLC::GetLobbyStatus ( )
 
 bool USFXGUI_MPLobby_DLC::IsUIWorldPawnRequired ( int Subscreen )
 {
-	static UFunction* pFnIsUIWorldPawnRequired = NULL;
-
+	UFunction* pFnIsUIWorldPawnRequired = (UFunction*) SdkBindings::Get ( 6602 );
 	if ( ! pFnIsUIWorldPawnRequired )
-		pFnIsUIWorldPawnRequired = (UFunction*) UObject::GObjObjects()->Data[ 109895 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execIsUIWorldPawnRequired_Parms IsUIWorldPawnRequired_Parms;
 	IsUIWorldPawnRequired_Parms.Subscreen = Subscreen;
@@ -4354,10 +4121,9 @@ bool USFXGUI_MPLobby_DLC::IsUIWorldPawnRequired ( int Subscreen )
 
 void USFXGUI_MPLobby_DLC::LoadTab ( int NewTab )
 {
-	static UFunction* pFnLoadTab = NULL;
-
+	UFunction* pFnLoadTab = (UFunction*) SdkBindings::Get ( 6629 );
 	if ( ! pFnLoadTab )
-		pFnLoadTab = (UFunction*) UObject::GObjObjects()->Data[ 109965 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execLoadTab_Parms LoadTab_Parms;
 	LoadTab_Parms.NewTab = NewTab;
@@ -4372,10 +4138,9 @@ void USFXGUI_MPLobby_DLC::LoadTab ( int NewTab )
 
 int USFXGUI_MPLobby_DLC::GetCurrentLobbyTab ( )
 {
-	static UFunction* pFnGetCurrentLobbyTab = NULL;
-
+	UFunction* pFnGetCurrentLobbyTab = (UFunction*) SdkBindings::Get ( 6628 );
 	if ( ! pFnGetCurrentLobbyTab )
-		pFnGetCurrentLobbyTab = (UFunction*) UObject::GObjObjects()->Data[ 109963 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetCurrentLobbyTab_Parms GetCurrentLobbyTab_Parms;
 
@@ -4390,10 +4155,9 @@ int USFXGUI_MPLobby_DLC::GetCurrentLobbyTab ( )
 
 void USFXGUI_MPLobby_DLC::AS_ExitMultiplayerCancelled ( )
 {
-	static UFunction* pFnAS_ExitMultiplayerCancelled = NULL;
-
+	UFunction* pFnAS_ExitMultiplayerCancelled = (UFunction*) SdkBindings::Get ( 6627 );
 	if ( ! pFnAS_ExitMultiplayerCancelled )
-		pFnAS_ExitMultiplayerCancelled = (UFunction*) UObject::GObjObjects()->Data[ 109962 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execAS_ExitMultiplayerCancelled_Parms AS_ExitMultiplayerCancelled_Parms;
 
@@ -4406,10 +4170,9 @@ void USFXGUI_MPLobby_DLC::AS_ExitMultiplayerCancelled ( )
 
 void USFXGUI_MPLobby_DLC::AS_ExitLobbyCancelled ( )
 {
-	static UFunction* pFnAS_ExitLobbyCancelled = NULL;
-
+	UFunction* pFnAS_ExitLobbyCancelled = (UFunction*) SdkBindings::Get ( 6626 );
 	if ( ! pFnAS_ExitLobbyCancelled )
-		pFnAS_ExitLobbyCancelled = (UFunction*) UObject::GObjObjects()->Data[ 109961 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execAS_ExitLobbyCancelled_Parms AS_ExitLobbyCancelled_Parms;
 
@@ -4422,10 +4185,9 @@ void USFXGUI_MPLobby_DLC::AS_ExitLobbyCancelled ( )
 
 void USFXGUI_MPLobby_DLC::AS_RefreshGalaxyAtWarMap ( )
 {
-	static UFunction* pFnAS_RefreshGalaxyAtWarMap = NULL;
-
+	UFunction* pFnAS_RefreshGalaxyAtWarMap = (UFunction*) SdkBindings::Get ( 6614 );
 	if ( ! pFnAS_RefreshGalaxyAtWarMap )
-		pFnAS_RefreshGalaxyAtWarMap = (UFunction*) UObject::GObjObjects()->Data[ 109918 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execAS_RefreshGalaxyAtWarMap_Parms AS_RefreshGalaxyAtWarMap_Parms;
 
@@ -4439,10 +4201,9 @@ void USFXGUI_MPLobby_DLC::AS_RefreshGalaxyAtWarMap ( )
 
 void USFXGUI_MPLobby_DLC::AS_RefreshAllSpeakerIcons ( TArray< float > VoiceData )
 {
-	static UFunction* pFnAS_RefreshAllSpeakerIcons = NULL;
-
+	UFunction* pFnAS_RefreshAllSpeakerIcons = (UFunction*) SdkBindings::Get ( 6618 );
 	if ( ! pFnAS_RefreshAllSpeakerIcons )
-		pFnAS_RefreshAllSpeakerIcons = (UFunction*) UObject::GObjObjects()->Data[ 109936 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execAS_RefreshAllSpeakerIcons_Parms AS_RefreshAllSpeakerIcons_Parms;
 	memcpy ( &AS_RefreshAllSpeakerIcons_Parms.VoiceData, &VoiceData, 0xC );
@@ -4457,10 +4218,9 @@ void USFXGUI_MPLobby_DLC::AS_RefreshAllSpeakerIcons ( TArray< float > VoiceData
 
 int USFXGUI_MPLobby_DLC::AS_GetChallengeSetting ( )
 {
-	static UFunction* pFnAS_GetChallengeSetting = NULL;
-
+	UFunction* pFnAS_GetChallengeSetting = (UFunction*) SdkBindings::Get ( 6625 );
 	if ( ! pFnAS_GetChallengeSetting )
-		pFnAS_GetChallengeSetting = (UFunction*) UObject::GObjObjects()->Data[ 109957 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execAS_GetChallengeSetting_Parms AS_GetChallengeSetting_Parms;
 
@@ -4476,10 +4236,9 @@ int USFXGUI_MPLobby_DLC::AS_GetChallengeSetting ( )
 
 int USFXGUI_MPLobby_DLC::AS_GetEnemySetting ( )
 {
-	static UFunction* pFnAS_GetEnemySetting = NULL;
-
+	UFunction* pFnAS_GetEnemySetting = (UFunction*) SdkBindings::Get ( 6624 );
 	if ( ! pFnAS_GetEnemySetting )
-		pFnAS_GetEnemySetting = (UFunction*) UObject::GObjObjects()->Data[ 109955 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execAS_GetEnemySetting_Parms AS_GetEnemySetting_Parms;
 
@@ -4495,10 +4254,9 @@ int USFXGUI_MPLobby_DLC::AS_GetEnemySetting ( )
 
 int USFXGUI_MPLobby_DLC::AS_GetMapSetting ( )
 {
-	static UFunction* pFnAS_GetMapSetting = NULL;
-
+	UFunction* pFnAS_GetMapSetting = (UFunction*) SdkBindings::Get ( 6623 );
 	if ( ! pFnAS_GetMapSetting )
-		pFnAS_GetMapSetting = (UFunction*) UObject::GObjObjects()->Data[ 109953 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execAS_GetMapSetting_Parms AS_GetMapSetting_Parms;
 
@@ -4514,10 +4272,9 @@ int USFXGUI_MPLobby_DLC::AS_GetMapSetting ( )
 
 int USFXGUI_MPLobby_DLC::AS_GetPrivacySetting ( )
 {
-	static UFunction* pFnAS_GetPrivacySetting = NULL;
-
+	UFunction* pFnAS_GetPrivacySetting = (UFunction*) SdkBindings::Get ( 6622 );
 	if ( ! pFnAS_GetPrivacySetting )
-		pFnAS_GetPrivacySetting = (UFunction*) UObject::GObjObjects()->Data[ 109951 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execAS_GetPrivacySetting_Parms AS_GetPrivacySetting_Parms;
 
@@ -4533,10 +4290,9 @@ int USFXGUI_MPLobby_DLC::AS_GetPrivacySetting ( )
 
 void USFXGUI_MPLobby_DLC::AS_OnTabLoaded ( int Subscreen )
 {
-	static UFunction* pFnAS_OnTabLoaded = NULL;
-
+	UFunction* pFnAS_OnTabLoaded = (UFunction*) SdkBindings::Get ( 6621 );
 	if ( ! pFnAS_OnTabLoaded )
-		pFnAS_OnTabLoaded = (UFunction*) UObject::GObjObjects()->Data[ 109949 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execAS_OnTabLoaded_Parms AS_OnTabLoaded_Parms;
 	AS_OnTabLoaded_Parms.Subscreen = Subscreen;
@@ -4550,10 +4306,9 @@ void USFXGUI_MPLobby_DLC::AS_OnTabLoaded ( int Subscreen )
 
 void USFXGUI_MPLobby_DLC::AS_RefreshScreen ( )
 {
-	static UFunction* pFnAS_RefreshScreen = NULL;
-
+	UFunction* pFnAS_RefreshScreen = (UFunction*) SdkBindings::Get ( 6617 );
 	if ( ! pFnAS_RefreshScreen )
-		pFnAS_RefreshScreen = (UFunction*) UObject::GObjObjects()->Data[ 109927 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execAS_RefreshScreen_Parms AS_RefreshScreen_Parms;
 
@@ -4567,10 +4322,9 @@ void USFXGUI_MPLobby_DLC::AS_RefreshScreen ( )
 
 void USFXGUI_MPLobby_DLC::ApplyTinting ( class UObject* InSettings )
 {
-	static UFunction* pFnApplyTinting = NULL;
-
+	UFunction* pFnApplyTinting = (UFunction*) SdkBindings::Get ( 6620 );
 	if ( ! pFnApplyTinting )
-		pFnApplyTinting = (UFunction*) UObject::GObjObjects()->Data[ 109944 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execApplyTinting_Parms ApplyTinting_Parms;
 	ApplyTinting_Parms.InSettings = InSettings;
@@ -4585,10 +4339,9 @@ void USFXGUI_MPLobby_DLC::ApplyTinting ( class UObject* InSettings )
 
 void USFXGUI_MPLobby_DLC::SetInitialPawnPosition ( class UObject* Data )
 {
-	static UFunction* pFnSetInitialPawnPosition = NULL;
-
+	UFunction* pFnSetInitialPawnPosition = (UFunction*) SdkBindings::Get ( 6619 );
 	if ( ! pFnSetInitialPawnPosition )
-		pFnSetInitialPawnPosition = (UFunction*) UObject::GObjObjects()->Data[ 109940 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execSetInitialPawnPosition_Parms SetInitialPawnPosition_Parms;
 	SetInitialPawnPosition_Parms.Data = Data;
@@ -4602,10 +4355,9 @@ void USFXGUI_MPLobby_DLC::SetInitialPawnPosition ( class UObject* Data )
 
 void USFXGUI_MPLobby_DLC::CleanupUIWorldPawn ( )
 {
-	static UFunction* pFnCleanupUIWorldPawn = NULL;
-
+	UFunction* pFnCleanupUIWorldPawn = (UFunction*) SdkBindings::Get ( 6608 );
 	if ( ! pFnCleanupUIWorldPawn )
-		pFnCleanupUIWorldPawn = (UFunction*) UObject::GObjObjects()->Data[ 109903 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execCleanupUIWorldPawn_Parms CleanupUIWorldPawn_Parms;
 
@@ -4618,10 +4370,9 @@ void USFXGUI_MPLobby_DLC::CleanupUIWorldPawn ( )
 
 void USFXGUI_MPLobby_DLC::SetupUIWorldPawn ( )
 {
-	static UFunction* pFnSetupUIWorldPawn = NULL;
-
+	UFunction* pFnSetupUIWorldPawn = (UFunction*) SdkBindings::Get ( 6603 );
 	if ( ! pFnSetupUIWorldPawn )
-		pFnSetupUIWorldPawn = (UFunction*) UObject::GObjObjects()->Data[ 109897 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execSetupUIWorldPawn_Parms SetupUIWorldPawn_Parms;
 
@@ -4634,10 +4385,9 @@ void USFXGUI_MPLobby_DLC::SetupUIWorldPawn ( )
 
 void USFXGUI_MPLobby_DLC::RefreshAllSpeakerIcons ( )
 {
-	static UFunction* pFnRefreshAllSpeakerIcons = NULL;
-
+	UFunction* pFnRefreshAllSpeakerIcons = (UFunction*) SdkBindings::Get ( 6612 );
 	if ( ! pFnRefreshAllSpeakerIcons )
-		pFnRefreshAllSpeakerIcons = (UFunction*) UObject::GObjObjects()->Data[ 109911 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execRefreshAllSpeakerIcons_Parms RefreshAllSpeakerIcons_Parms;
 
@@ -4650,10 +4400,9 @@ void USFXGUI_MPLobby_DLC::RefreshAllSpeakerIcons ( )
 
 void USFXGUI_MPLobby_DLC::Refresh ( )
 {
-	static UFunction* pFnRefresh = NULL;
-
+	UFunction* pFnRefresh = (UFunction*) SdkBindings::Get ( 6606 );
 	if ( ! pFnRefresh )
-		pFnRefresh = (UFunction*) UObject::GObjObjects()->Data[ 109900 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execRefresh_Parms Refresh_Parms;
 
@@ -4667,10 +4416,9 @@ void USFXGUI_MPLobby_DLC::Refresh ( )
 
 TArray< struct FGAWZoneGUIData > USFXGUI_MPLobby_DLC::GetGAWRatings ( )
 {
-	static UFunction* pFnGetGAWRatings = NULL;
-
+	UFunction* pFnGetGAWRatings = (UFunction*) SdkBindings::Get ( 6616 );
 	if ( ! pFnGetGAWRatings )
-		pFnGetGAWRatings = (UFunction*) UObject::GObjObjects()->Data[ 109921 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execGetGAWRatings_Parms GetGAWRatings_Parms;
 
@@ -4686,10 +4434,9 @@ TArray< struct FGAWZoneGUIData > USFXGUI_MPLobby_DLC::GetGAWRatings ( )
 
 bool USFXGUI_MPLobby_DLC::HasGAWRatingsError ( )
 {
-	static UFunction* pFnHasGAWRatingsError = NULL;
-
+	UFunction* pFnHasGAWRatingsError = (UFunction*) SdkBindings::Get ( 6615 );
 	if ( ! pFnHasGAWRatingsError )
-		pFnHasGAWRatingsError = (UFunction*) UObject::GObjObjects()->Data[ 109919 ];
+		return {};
 
 	USFXGUI_MPLobby_DLC_execHasGAWRatingsError_Parms HasGAWRatingsError_Parms;
 
@@ -4707,10 +4454,9 @@ bool USFXGUI_MPLobby_DLC::HasGAWRatingsError ( )
 
 void USFXGUI_MPLobby_DLC::OnGAWRequestFinished ( TArray< struct FGAWZoneGUIData > ZoneData, int Level, int errorCode )
 {
-	static UFunction* pFnOnGAWRequestFinished = NULL;
-
+	UFunction* pFnOnGAWRequestFinished = (UFunction*) SdkBindings::Get ( 6613 );
 	if ( ! pFnOnGAWRequestFinished )
-		pFnOnGAWRequestFinished = (UFunction*) UObject::GObjObjects()->Data[ 109912 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_execOnGAWRequestFinished_Parms OnGAWRequestFinished_Parms;
 	memcpy ( &OnGAWRequestFinished_Parms.ZoneData, &ZoneData, 0xC );
@@ -4727,10 +4473,9 @@ void USFXGUI_MPLobby_DLC::OnGAWRequestFinished ( TArray< struct FGAWZoneGUIData
 
 void USFXGUI_MPLobby_DLC::eventUpdate ( float fDeltaT )
 {
-	static UFunction* pFnUpdate = NULL;
-
+	UFunction* pFnUpdate = (UFunction*) SdkBindings::Get ( 6609 );
 	if ( ! pFnUpdate )
-		pFnUpdate = (UFunction*) UObject::GObjObjects()->Data[ 109904 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_eventUpdate_Parms Update_Parms;
 	Update_Parms.fDeltaT = fDeltaT;
@@ -4744,10 +4489,9 @@ void USFXGUI_MPLobby_DLC::eventUpdate ( float fDeltaT )
 
 void USFXGUI_MPLobby_DLC::eventOnClose ( )
 {
-	static UFunction* pFnOnClose = NULL;
-
+	UFunction* pFnOnClose = (UFunction*) SdkBindings::Get ( 6607 );
 	if ( ! pFnOnClose )
-		pFnOnClose = (UFunction*) UObject::GObjObjects()->Data[ 109902 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_eventOnClose_Parms OnClose_Parms;
 
@@ -4760,10 +4504,9 @@ void USFXGUI_MPLobby_DLC::eventOnClose ( )
 
 void USFXGUI_MPLobby_DLC::eventOnStart ( )
 {
-	static UFunction* pFnOnStart = NULL;
-
+	UFunction* pFnOnStart = (UFunction*) SdkBindings::Get ( 6600 );
 	if ( ! pFnOnStart )
-		pFnOnStart = (UFunction*) UObject::GObjObjects()->Data[ 109893 ];
+		return;
 
 	USFXGUI_MPLobby_DLC_eventOnStart_Parms OnStart_Parms;
 
@@ -4778,10 +4521,9 @@ void USFXGUI_MPLobby_DLC::eventOnStart ( )
 
 void USFXGUI_MPSelectKit_DLC::ShowCharacterInfoCallback ( unsigned long bAPressed, int Context )
 {
-	static UFunction* pFnShowCharacterInfoCallback = NULL;
-
+	UFunction* pFnShowCharacterInfoCallback = (UFunction*) SdkBindings::Get ( 7486 );
 	if ( ! pFnShowCharacterInfoCallback )
-		pFnShowCharacterInfoCallback = (UFunction*) UObject::GObjObjects()->Data[ 125345 ];
+		return;
 
 	USFXGUI_MPSelectKit_DLC_execShowCharacterInfoCallback_Parms ShowCharacterInfoCallback_Parms;
 	ShowCharacterInfoCallback_Parms.bAPressed = bAPressed;
@@ -4798,10 +4540,9 @@ void USFXGUI_MPSelectKit_DLC::ShowCharacterInfoCallback ( unsigned long bAPresse
 
 struct FString USFXGUI_MPSelectKit_DLC::ComposeKitDescriptionString ( struct FKitDescriptionData oData )
 {
-	static UFunction* pFnComposeKitDescriptionString = NULL;
-
+	UFunction* pFnComposeKitDescriptionString = (UFunction*) SdkBindings::Get ( 7485 );
 	if ( ! pFnComposeKitDescriptionString )
-		pFnComposeKitDescriptionString = (UFunction*) UObject::GObjObjects()->Data[ 125341 ];
+		return {};
 
 	USFXGUI_MPSelectKit_DLC_execComposeKitDescriptionString_Parms ComposeKitDescriptionString_Parms;
 	memcpy ( &ComposeKitDescriptionString_Parms.oData, &oData, 0x30 );
@@ -4818,10 +4559,9 @@ struct FString USFXGUI_MPSelectKit_DLC::ComposeKitDescriptionString ( struct FKi
 
 void USFXGUI_MPSelectKit_DLC::ShowCharacterInfo ( struct FString KitName )
 {
-	static UFunction* pFnShowCharacterInfo = NULL;
-
+	UFunction* pFnShowCharacterInfo = (UFunction*) SdkBindings::Get ( 7484 );
 	if ( ! pFnShowCharacterInfo )
-		pFnShowCharacterInfo = (UFunction*) UObject::GObjObjects()->Data[ 125336 ];
+		return;
 
 	USFXGUI_MPSelectKit_DLC_execShowCharacterInfo_Parms ShowCharacterInfo_Parms;
 	memcpy ( &ShowCharacterInfo_Parms.KitName, &KitName, 0xC );
@@ -4835,10 +4575,9 @@ void USFXGUI_MPSelectKit_DLC::ShowCharacterInfo ( struct FString KitName )
 
 void USFXGUI_MPMatchConsumables_DLC::AS_RefreshScreen ( )
 {
-	static UFunction* pFnAS_RefreshScreen = NULL;
-
+	UFunction* pFnAS_RefreshScreen = (UFunction*) SdkBindings::Get ( 6749 );
 	if ( ! pFnAS_RefreshScreen )
-		pFnAS_RefreshScreen = (UFunction*) UObject::GObjObjects()->Data[ 110404 ];
+		return;
 
 	USFXGUI_MPMatchConsumables_DLC_execAS_RefreshScreen_Parms AS_RefreshScreen_Parms;
 
@@ -4853,10 +4592,9 @@ void USFXGUI_MPMatchConsumables_DLC::AS_RefreshScreen ( )
 
 unsigned char USFXGUI_MPMatchConsumables_DLC::GetGUICategoryFromSlotType ( int SlotType )
 {
-	static UFunction* pFnGetGUICategoryFromSlotType = NULL;
-
+	UFunction* pFnGetGUICategoryFromSlotType = (UFunction*) SdkBindings::Get ( 6767 );
 	if ( ! pFnGetGUICategoryFromSlotType )
-		pFnGetGUICategoryFromSlotType = (UFunction*) UObject::GObjObjects()->Data[ 110488 ];
+		return {};
 
 	USFXGUI_MPMatchConsumables_DLC_execGetGUICategoryFromSlotType_Parms GetGUICategoryFromSlotType_Parms;
 	GetGUICategoryFromSlotType_Parms.SlotType = SlotType;
@@ -4873,10 +4611,9 @@ unsigned char USFXGUI_MPMatchConsumables_DLC::GetGUICategoryFromSlotType ( int S
 
 void USFXGUI_MPMatchConsumables_DLC::ClearNewFlagsForSlotType ( int SlotType )
 {
-	static UFunction* pFnClearNewFlagsForSlotType = NULL;
-
+	UFunction* pFnClearNewFlagsForSlotType = (UFunction*) SdkBindings::Get ( 6762 );
 	if ( ! pFnClearNewFlagsForSlotType )
-		pFnClearNewFlagsForSlotType = (UFunction*) UObject::GObjObjects()->Data[ 110466 ];
+		return;
 
 	USFXGUI_MPMatchConsumables_DLC_execClearNewFlagsForSlotType_Parms ClearNewFlagsForSlotType_Parms;
 	ClearNewFlagsForSlotType_Parms.SlotType = SlotType;
@@ -4892,10 +4629,9 @@ void USFXGUI_MPMatchConsumables_DLC::ClearNewFlagsForSlotType ( int SlotType )
 
 bool USFXGUI_MPMatchConsumables_DLC::HasNewConsumablesOfSlotType ( int SlotType )
 {
-	static UFunction* pFnHasNewConsumablesOfSlotType = NULL;
-
+	UFunction* pFnHasNewConsumablesOfSlotType = (UFunction*) SdkBindings::Get ( 6766 );
 	if ( ! pFnHasNewConsumablesOfSlotType )
-		pFnHasNewConsumablesOfSlotType = (UFunction*) UObject::GObjObjects()->Data[ 110483 ];
+		return {};
 
 	USFXGUI_MPMatchConsumables_DLC_execHasNewConsumablesOfSlotType_Parms HasNewConsumablesOfSlotType_Parms;
 	HasNewConsumablesOfSlotType_Parms.SlotType = SlotType;
@@ -4912,10 +4648,9 @@ bool USFXGUI_MPMatchConsumables_DLC::HasNewConsumablesOfSlotType ( int SlotType
 
 TArray< struct FInGameConsumableInfo > USFXGUI_MPMatchConsumables_DLC::GetInGameConsumableInfo ( )
 {
-	static UFunction* pFnGetInGameConsumableInfo = NULL;
-
+	UFunction* pFnGetInGameConsumableInfo = (UFunction*) SdkBindings::Get ( 6765 );
 	if ( ! pFnGetInGameConsumableInfo )
-		pFnGetInGameConsumableInfo = (UFunction*) UObject::GObjObjects()->Data[ 110471 ];
+		return {};
 
 	USFXGUI_MPMatchConsumables_DLC_execGetInGameConsumableInfo_Parms GetInGameConsumableInfo_Parms;
 
@@ -4930,10 +4665,9 @@ TArray< struct FInGameConsumableInfo > USFXGUI_MPMatchConsumables_DLC::GetInGame
 
 void USFXGUI_MPMatchConsumables_DLC::ShowStoreScreen ( )
 {
-	static UFunction* pFnShowStoreScreen = NULL;
-
+	UFunction* pFnShowStoreScreen = (UFunction*) SdkBindings::Get ( 6764 );
 	if ( ! pFnShowStoreScreen )
-		pFnShowStoreScreen = (UFunction*) UObject::GObjObjects()->Data[ 110470 ];
+		return;
 
 	USFXGUI_MPMatchConsumables_DLC_execShowStoreScreen_Parms ShowStoreScreen_Parms;
 
@@ -4948,10 +4682,9 @@ void USFXGUI_MPMatchConsumables_DLC::ShowStoreScreen ( )
 
 int USFXGUI_MPMatchConsumables_DLC::GetSlotTypeForCategory ( int Category )
 {
-	static UFunction* pFnGetSlotTypeForCategory = NULL;
-
+	UFunction* pFnGetSlotTypeForCategory = (UFunction*) SdkBindings::Get ( 6755 );
 	if ( ! pFnGetSlotTypeForCategory )
-		pFnGetSlotTypeForCategory = (UFunction*) UObject::GObjObjects()->Data[ 110436 ];
+		return {};
 
 	USFXGUI_MPMatchConsumables_DLC_execGetSlotTypeForCategory_Parms GetSlotTypeForCategory_Parms;
 	GetSlotTypeForCategory_Parms.Category = Category;
@@ -4967,10 +4700,9 @@ int USFXGUI_MPMatchConsumables_DLC::GetSlotTypeForCategory ( int Category )
 
 void USFXGUI_MPMatchConsumables_DLC::ExitScreen ( )
 {
-	static UFunction* pFnExitScreen = NULL;
-
+	UFunction* pFnExitScreen = (UFunction*) SdkBindings::Get ( 6761 );
 	if ( ! pFnExitScreen )
-		pFnExitScreen = (UFunction*) UObject::GObjObjects()->Data[ 110465 ];
+		return;
 
 	USFXGUI_MPMatchConsumables_DLC_execExitScreen_Parms ExitScreen_Parms;
 
@@ -4984,10 +4716,9 @@ void USFXGUI_MPMatchConsumables_DLC::ExitScreen ( )
 
 int USFXGUI_MPMatchConsumables_DLC::GetMaxActiveConsumables ( )
 {
-	static UFunction* pFnGetMaxActiveConsumables = NULL;
-
+	UFunction* pFnGetMaxActiveConsumables = (UFunction*) SdkBindings::Get ( 6760 );
 	if ( ! pFnGetMaxActiveConsumables )
-		pFnGetMaxActiveConsumables = (UFunction*) UObject::GObjObjects()->Data[ 110463 ];
+		return {};
 
 	USFXGUI_MPMatchConsumables_DLC_execGetMaxActiveConsumables_Parms GetMaxActiveConsumables_Parms;
 
@@ -5003,10 +4734,9 @@ int USFXGUI_MPMatchConsumables_DLC::GetMaxActiveConsumables ( )
 
 TArray< struct FConsumableDisplayInfo > USFXGUI_MPMatchConsumables_DLC::GetActiveConsumables ( )
 {
-	static UFunction* pFnGetActiveConsumables = NULL;
-
+	UFunction* pFnGetActiveConsumables = (UFunction*) SdkBindings::Get ( 6759 );
 	if ( ! pFnGetActiveConsumables )
-		pFnGetActiveConsumables = (UFunction*) UObject::GObjObjects()->Data[ 110460 ];
+		return {};
 
 	USFXGUI_MPMatchConsumables_DLC_execGetActiveConsumables_Parms GetActiveConsumables_Parms;
 
@@ -5021,10 +4751,9 @@ TArray< struct FConsumableDisplayInfo > USFXGUI_MPMatchConsumables_DLC::GetActiv
 
 void USFXGUI_MPMatchConsumables_DLC::UpdateActiveList ( )
 {
-	static UFunction* pFnUpdateActiveList = NULL;
-
+	UFunction* pFnUpdateActiveList = (UFunction*) SdkBindings::Get ( 6748 );
 	if ( ! pFnUpdateActiveList )
-		pFnUpdateActiveList = (UFunction*) UObject::GObjObjects()->Data[ 110403 ];
+		return;
 
 	USFXGUI_MPMatchConsumables_DLC_execUpdateActiveList_Parms UpdateActiveList_Parms;
 
@@ -5038,10 +4767,9 @@ void USFXGUI_MPMatchConsumables_DLC::UpdateActiveList ( )
 
 void USFXGUI_MPMatchConsumables_DLC::DeactivateConsumablesOfSlotType ( int SlotType )
 {
-	static UFunction* pFnDeactivateConsumablesOfSlotType = NULL;
-
+	UFunction* pFnDeactivateConsumablesOfSlotType = (UFunction*) SdkBindings::Get ( 6758 );
 	if ( ! pFnDeactivateConsumablesOfSlotType )
-		pFnDeactivateConsumablesOfSlotType = (UFunction*) UObject::GObjObjects()->Data[ 110455 ];
+		return;
 
 	USFXGUI_MPMatchConsumables_DLC_execDeactivateConsumablesOfSlotType_Parms DeactivateConsumablesOfSlotType_Parms;
 	DeactivateConsumablesOfSlotType_Parms.SlotType = SlotType;
@@ -5058,10 +4786,9 @@ void USFXGUI_MPMatchConsumables_DLC::DeactivateConsumablesOfSlotType ( int SlotT
 
 void USFXGUI_MPMatchConsumables_DLC::SetConsumableActive ( int Id, int Version, unsigned long bActive )
 {
-	static UFunction* pFnSetConsumableActive = NULL;
-
+	UFunction* pFnSetConsumableActive = (UFunction*) SdkBindings::Get ( 6757 );
 	if ( ! pFnSetConsumableActive )
-		pFnSetConsumableActive = (UFunction*) UObject::GObjObjects()->Data[ 110449 ];
+		return;
 
 	USFXGUI_MPMatchConsumables_DLC_execSetConsumableActive_Parms SetConsumableActive_Parms;
 	SetConsumableActive_Parms.Id = Id;
@@ -5082,10 +4809,9 @@ void USFXGUI_MPMatchConsumables_DLC::SetConsumableActive ( int Id, int Version,
 
 bool USFXGUI_MPMatchConsumables_DLC::IsConsumableAvailable ( class USFXGAWReinforcementBase* CardOwner, int Id, int Version, int Category )
 {
-	static UFunction* pFnIsConsumableAvailable = NULL;
-
+	UFunction* pFnIsConsumableAvailable = (UFunction*) SdkBindings::Get ( 6752 );
 	if ( ! pFnIsConsumableAvailable )
-		pFnIsConsumableAvailable = (UFunction*) UObject::GObjObjects()->Data[ 110420 ];
+		return {};
 
 	USFXGUI_MPMatchConsumables_DLC_execIsConsumableAvailable_Parms IsConsumableAvailable_Parms;
 	IsConsumableAvailable_Parms.CardOwner = CardOwner;
@@ -5107,10 +4833,9 @@ bool USFXGUI_MPMatchConsumables_DLC::IsConsumableAvailable ( class USFXGAWReinfo
 
 struct FConsumableDisplayInfo USFXGUI_MPMatchConsumables_DLC::GetConsumable ( int Id, int Version )
 {
-	static UFunction* pFnGetConsumable = NULL;
-
+	UFunction* pFnGetConsumable = (UFunction*) SdkBindings::Get ( 6756 );
 	if ( ! pFnGetConsumable )
-		pFnGetConsumable = (UFunction*) UObject::GObjObjects()->Data[ 110437 ];
+		return {};
 
 	USFXGUI_MPMatchConsumables_DLC_execGetConsumable_Parms GetConsumable_Parms;
 	GetConsumable_Parms.Id = Id;
@@ -5129,10 +4854,9 @@ struct FConsumableDisplayInfo USFXGUI_MPMatchConsumables_DLC::GetConsumable ( in
 
 TArray< struct FConsumableDisplayInfo > USFXGUI_MPMatchConsumables_DLC::GetConsumableListFilteredBySlot ( int SlotIndex )
 {
-	static UFunction* pFnGetConsumableListFilteredBySlot = NULL;
-
+	UFunction* pFnGetConsumableListFilteredBySlot = (UFunction*) SdkBindings::Get ( 6754 );
 	if ( ! pFnGetConsumableListFilteredBySlot )
-		pFnGetConsumableListFilteredBySlot = (UFunction*) UObject::GObjObjects()->Data[ 110428 ];
+		return {};
 
 	USFXGUI_MPMatchConsumables_DLC_execGetConsumableListFilteredBySlot_Parms GetConsumableListFilteredBySlot_Parms;
 	GetConsumableListFilteredBySlot_Parms.SlotIndex = SlotIndex;
@@ -5149,10 +4873,9 @@ TArray< struct FConsumableDisplayInfo > USFXGUI_MPMatchConsumables_DLC::GetConsu
 
 TArray< struct FConsumableDisplayInfo > USFXGUI_MPMatchConsumables_DLC::GetConsumableList ( )
 {
-	static UFunction* pFnGetConsumableList = NULL;
-
+	UFunction* pFnGetConsumableList = (UFunction*) SdkBindings::Get ( 6753 );
 	if ( ! pFnGetConsumableList )
-		pFnGetConsumableList = (UFunction*) UObject::GObjObjects()->Data[ 110421 ];
+		return {};
 
 	USFXGUI_MPMatchConsumables_DLC_execGetConsumableList_Parms GetConsumableList_Parms;
 
@@ -5170,10 +4893,9 @@ TArray< struct FConsumableDisplayInfo > USFXGUI_MPMatchConsumables_DLC::GetConsu
 
 struct FConsumableDisplayInfo USFXGUI_MPMatchConsumables_DLC::GetDisplayInfo ( int CardID, struct FCardInfoData CardData )
 {
-	static UFunction* pFnGetDisplayInfo = NULL;
-
+	UFunction* pFnGetDisplayInfo = (UFunction*) SdkBindings::Get ( 6751 );
 	if ( ! pFnGetDisplayInfo )
-		pFnGetDisplayInfo = (UFunction*) UObject::GObjObjects()->Data[ 110407 ];
+		return {};
 
 	USFXGUI_MPMatchConsumables_DLC_execGetDisplayInfo_Parms GetDisplayInfo_Parms;
 	GetDisplayInfo_Parms.CardID = CardID;
@@ -5190,10 +4912,9 @@ struct FConsumableDisplayInfo USFXGUI_MPMatchConsumables_DLC::GetDisplayInfo ( i
 
 void USFXGUI_MPMatchConsumables_DLC::eventOnClose ( )
 {
-	static UFunction* pFnOnClose = NULL;
-
+	UFunction* pFnOnClose = (UFunction*) SdkBindings::Get ( 6750 );
 	if ( ! pFnOnClose )
-		pFnOnClose = (UFunction*) UObject::GObjObjects()->Data[ 110405 ];
+		return;
 
 	USFXGUI_MPMatchConsumables_DLC_eventOnClose_Parms OnClose_Parms;
 
@@ -5206,10 +4927,9 @@ void USFXGUI_MPMatchConsumables_DLC::eventOnClose ( )
 
 void USFXGUI_MPMatchConsumables_DLC::eventOnStart ( )
 {
-	static UFunction* pFnOnStart = NULL;
-
+	UFunction* pFnOnStart = (UFunction*) SdkBindings::Get ( 6747 );
 	if ( ! pFnOnStart )
-		pFnOnStart = (UFunction*) UObject::GObjObjects()->Data[ 110399 ];
+		return;
 
 	USFXGUI_MPMatchConsumables_DLC_eventOnStart_Parms OnStart_Parms;
 
@@ -5223,10 +4943,9 @@ void USFXGUI_MPMatchConsumables_DLC::eventOnStart ( )
 
 void USFXGUI_MPReinforcementsReveal_DLC::AS_InitializeScreen ( unsigned long SkipIntro )
 {
-	static UFunction* pFnAS_InitializeScreen = NULL;
-
+	UFunction* pFnAS_InitializeScreen = (UFunction*) SdkBindings::Get ( 6843 );
 	if ( ! pFnAS_InitializeScreen )
-		pFnAS_InitializeScreen = (UFunction*) UObject::GObjObjects()->Data[ 110821 ];
+		return;
 
 	USFXGUI_MPReinforcementsReveal_DLC_execAS_InitializeScreen_Parms AS_InitializeScreen_Parms;
 	AS_InitializeScreen_Parms.SkipIntro = SkipIntro;
@@ -5241,10 +4960,9 @@ void USFXGUI_MPReinforcementsReveal_DLC::AS_InitializeScreen ( unsigned long Ski
 
 TArray< struct FCardInfoData > USFXGUI_MPReinforcementsReveal_DLC::GetCardsToDisplay ( )
 {
-	static UFunction* pFnGetCardsToDisplay = NULL;
-
+	UFunction* pFnGetCardsToDisplay = (UFunction*) SdkBindings::Get ( 6848 );
 	if ( ! pFnGetCardsToDisplay )
-		pFnGetCardsToDisplay = (UFunction*) UObject::GObjObjects()->Data[ 110841 ];
+		return {};
 
 	USFXGUI_MPReinforcementsReveal_DLC_execGetCardsToDisplay_Parms GetCardsToDisplay_Parms;
 
@@ -5260,10 +4978,9 @@ TArray< struct FCardInfoData > USFXGUI_MPReinforcementsReveal_DLC::GetCardsToDis
 
 struct FString USFXGUI_MPReinforcementsReveal_DLC::GetAwardedPackName ( )
 {
-	static UFunction* pFnGetAwardedPackName = NULL;
-
+	UFunction* pFnGetAwardedPackName = (UFunction*) SdkBindings::Get ( 6841 );
 	if ( ! pFnGetAwardedPackName )
-		pFnGetAwardedPackName = (UFunction*) UObject::GObjObjects()->Data[ 110818 ];
+		return {};
 
 	USFXGUI_MPReinforcementsReveal_DLC_execGetAwardedPackName_Parms GetAwardedPackName_Parms;
 
@@ -5279,10 +4996,9 @@ struct FString USFXGUI_MPReinforcementsReveal_DLC::GetAwardedPackName ( )
 
 struct FName USFXGUI_MPReinforcementsReveal_DLC::GetPackRevealSound ( )
 {
-	static UFunction* pFnGetPackRevealSound = NULL;
-
+	UFunction* pFnGetPackRevealSound = (UFunction*) SdkBindings::Get ( 6842 );
 	if ( ! pFnGetPackRevealSound )
-		pFnGetPackRevealSound = (UFunction*) UObject::GObjObjects()->Data[ 110820 ];
+		return {};
 
 	USFXGUI_MPReinforcementsReveal_DLC_execGetPackRevealSound_Parms GetPackRevealSound_Parms;
 
@@ -5298,10 +5014,9 @@ struct FName USFXGUI_MPReinforcementsReveal_DLC::GetPackRevealSound ( )
 
 struct FString USFXGUI_MPReinforcementsReveal_DLC::GetPackIntroHoloTextureRef ( )
 {
-	static UFunction* pFnGetPackIntroHoloTextureRef = NULL;
-
+	UFunction* pFnGetPackIntroHoloTextureRef = (UFunction*) SdkBindings::Get ( 6851 );
 	if ( ! pFnGetPackIntroHoloTextureRef )
-		pFnGetPackIntroHoloTextureRef = (UFunction*) UObject::GObjObjects()->Data[ 110845 ];
+		return {};
 
 	USFXGUI_MPReinforcementsReveal_DLC_execGetPackIntroHoloTextureRef_Parms GetPackIntroHoloTextureRef_Parms;
 
@@ -5317,10 +5032,9 @@ struct FString USFXGUI_MPReinforcementsReveal_DLC::GetPackIntroHoloTextureRef (
 
 struct FString USFXGUI_MPReinforcementsReveal_DLC::GetPackIntroTextureRef ( )
 {
-	static UFunction* pFnGetPackIntroTextureRef = NULL;
-
+	UFunction* pFnGetPackIntroTextureRef = (UFunction*) SdkBindings::Get ( 6850 );
 	if ( ! pFnGetPackIntroTextureRef )
-		pFnGetPackIntroTextureRef = (UFunction*) UObject::GObjObjects()->Data[ 110843 ];
+		return {};
 
 	USFXGUI_MPReinforcementsReveal_DLC_execGetPackIntroTextureRef_Parms GetPackIntroTextureRef_Parms;
 
@@ -5335,10 +5049,9 @@ struct FString USFXGUI_MPReinforcementsReveal_DLC::GetPackIntroTextureRef ( )
 
 void USFXGUI_MPReinforcementsReveal_DLC::Exit ( )
 {
-	static UFunction* pFnExit = NULL;
-
+	UFunction* pFnExit = (UFunction*) SdkBindings::Get ( 6849 );
 	if ( ! pFnExit )
-		pFnExit = (UFunction*) UObject::GObjObjects()->Data[ 110842 ];
+		return;
 
 	USFXGUI_MPReinforcementsReveal_DLC_execExit_Parms Exit_Parms;
 
@@ -5352,10 +5065,9 @@ void USFXGUI_MPReinforcementsReveal_DLC::Exit ( )
 
 TArray< struct FCardDisplayData > USFXGUI_MPReinforcementsReveal_DLC::GetCardData ( )
 {
-	static UFunction* pFnGetCardData = NULL;
-
+	UFunction* pFnGetCardData = (UFunction*) SdkBindings::Get ( 6847 );
 	if ( ! pFnGetCardData )
-		pFnGetCardData = (UFunction*) UObject::GObjObjects()->Data[ 110832 ];
+		return {};
 
 	USFXGUI_MPReinforcementsReveal_DLC_execGetCardData_Parms GetCardData_Parms;
 
@@ -5371,10 +5083,9 @@ TArray< struct FCardDisplayData > USFXGUI_MPReinforcementsReveal_DLC::GetCardDat
 
 struct FString USFXGUI_MPReinforcementsReveal_DLC::GetPackName ( )
 {
-	static UFunction* pFnGetPackName = NULL;
-
+	UFunction* pFnGetPackName = (UFunction*) SdkBindings::Get ( 6846 );
 	if ( ! pFnGetPackName )
-		pFnGetPackName = (UFunction*) UObject::GObjObjects()->Data[ 110830 ];
+		return {};
 
 	USFXGUI_MPReinforcementsReveal_DLC_execGetPackName_Parms GetPackName_Parms;
 
@@ -5391,10 +5102,9 @@ struct FString USFXGUI_MPReinforcementsReveal_DLC::GetPackName ( )
 
 struct FCardDisplayData USFXGUI_MPReinforcementsReveal_DLC::GetCardDisplayData ( struct FCardInfoData* CardData )
 {
-	static UFunction* pFnGetCardDisplayData = NULL;
-
+	UFunction* pFnGetCardDisplayData = (UFunction*) SdkBindings::Get ( 6845 );
 	if ( ! pFnGetCardDisplayData )
-		pFnGetCardDisplayData = (UFunction*) UObject::GObjObjects()->Data[ 110823 ];
+		return {};
 
 	USFXGUI_MPReinforcementsReveal_DLC_execGetCardDisplayData_Parms GetCardDisplayData_Parms;
 
@@ -5412,10 +5122,9 @@ struct FCardDisplayData USFXGUI_MPReinforcementsReveal_DLC::GetCardDisplayData (
 
 void USFXGUI_MPReinforcementsReveal_DLC::eventOnClose ( )
 {
-	static UFunction* pFnOnClose = NULL;
-
+	UFunction* pFnOnClose = (UFunction*) SdkBindings::Get ( 6844 );
 	if ( ! pFnOnClose )
-		pFnOnClose = (UFunction*) UObject::GObjObjects()->Data[ 110822 ];
+		return;
 
 	USFXGUI_MPReinforcementsReveal_DLC_eventOnClose_Parms OnClose_Parms;
 
@@ -5428,10 +5137,9 @@ void USFXGUI_MPReinforcementsReveal_DLC::eventOnClose ( )
 
 void USFXGUI_MPReinforcementsReveal_DLC::eventOnStart ( )
 {
-	static UFunction* pFnOnStart = NULL;
-
+	UFunction* pFnOnStart = (UFunction*) SdkBindings::Get ( 6840 );
 	if ( ! pFnOnStart )
-		pFnOnStart = (UFunction*) UObject::GObjObjects()->Data[ 110812 ];
+		return;
 
 	USFXGUI_MPReinforcementsReveal_DLC_eventOnStart_Parms OnStart_Parms;
 
@@ -5445,10 +5153,9 @@ void USFXGUI_MPReinforcementsReveal_DLC::eventOnStart ( )
 
 void USFXGUI_MPReinforcementsReveal_DLC::SetOnCloseCallback ( struct FScriptDelegate fn_OnCloseDelegate )
 {
-	static UFunction* pFnSetOnCloseCallback = NULL;
-
+	UFunction* pFnSetOnCloseCallback = (UFunction*) SdkBindings::Get ( 6839 );
 	if ( ! pFnSetOnCloseCallback )
-		pFnSetOnCloseCallback = (UFunction*) UObject::GObjObjects()->Data[ 110809 ];
+		return;
 
 	USFXGUI_MPReinforcementsReveal_DLC_execSetOnCloseCallback_Parms SetOnCloseCallback_Parms;
 	memcpy ( &SetOnCloseCallback_Parms.fn_OnCloseDelegate, &fn_OnCloseDelegate, 0xC );
@@ -5462,10 +5169,9 @@ void USFXGUI_MPReinforcementsReveal_DLC::SetOnCloseCallback ( struct FScriptDele
 
 void USFXGUI_MPReinforcementsReveal_DLC::OnCloseCallback ( )
 {
-	static UFunction* pFnOnCloseCallback = NULL;
-
+	UFunction* pFnOnCloseCallback = (UFunction*) SdkBindings::Get ( 6838 );
 	if ( ! pFnOnCloseCallback )
-		pFnOnCloseCallback = (UFunction*) UObject::GObjObjects()->Data[ 110808 ];
+		return;
 
 	USFXGUI_MPReinforcementsReveal_DLC_execOnCloseCallback_Parms OnCloseCallback_Parms;
 
@@ -5481,10 +5187,9 @@ void USFXGUI_MPReinforcementsReveal_DLC::OnCloseCallback ( )
 
 bool USFXGAWReinforcementMatchConsumable_Gear::OnAwarded ( struct FCardInfoData* CardInfoOut, TArray< struct FCardInfoData >* ChosenCards )
 {
-	static UFunction* pFnOnAwarded = NULL;
-
+	UFunction* pFnOnAwarded = (UFunction*) SdkBindings::Get ( 7445 );
 	if ( ! pFnOnAwarded )
-		pFnOnAwarded = (UFunction*) UObject::GObjObjects()->Data[ 124975 ];
+		return {};
 
 	USFXGAWReinforcementMatchConsumable_Gear_execOnAwarded_Parms OnAwarded_Parms;
 
@@ -5507,10 +5212,9 @@ bool USFXGAWReinforcementMatchConsumable_Gear::OnAwarded ( struct FCardInfoData*
 
 void USFXGAWReinforcementMatchConsumable_Gear::Deactivate ( int UniqueId, float VersionIdx )
 {
-	static UFunction* pFnDeactivate = NULL;
-
+	UFunction* pFnDeactivate = (UFunction*) SdkBindings::Get ( 7444 );
 	if ( ! pFnDeactivate )
-		pFnDeactivate = (UFunction*) UObject::GObjObjects()->Data[ 124969 ];
+		return;
 
 	USFXGAWReinforcementMatchConsumable_Gear_execDeactivate_Parms Deactivate_Parms;
 	Deactivate_Parms.UniqueId = UniqueId;
@@ -5527,10 +5231,9 @@ void USFXGAWReinforcementMatchConsumable_Gear::Deactivate ( int UniqueId, float
 
 void USFXGAWReinforcementMatchConsumable_Gear::Activate ( int UniqueId, float VersionIdx )
 {
-	static UFunction* pFnActivate = NULL;
-
+	UFunction* pFnActivate = (UFunction*) SdkBindings::Get ( 7443 );
 	if ( ! pFnActivate )
-		pFnActivate = (UFunction*) UObject::GObjObjects()->Data[ 124963 ];
+		return;
 
 	USFXGAWReinforcementMatchConsumable_Gear_execActivate_Parms Activate_Parms;
 	Activate_Parms.UniqueId = UniqueId;
@@ -5548,10 +5251,9 @@ void USFXGAWReinforcementMatchConsumable_Gear::Activate ( int UniqueId, float Ve
 
 bool USFXGAWReinforcementMatchConsumable_Gear::IsActive ( int UniqueId, float VersionIdx )
 {
-	static UFunction* pFnIsActive = NULL;
-
+	UFunction* pFnIsActive = (UFunction*) SdkBindings::Get ( 7442 );
 	if ( ! pFnIsActive )
-		pFnIsActive = (UFunction*) UObject::GObjObjects()->Data[ 124956 ];
+		return {};
 
 	USFXGAWReinforcementMatchConsumable_Gear_execIsActive_Parms IsActive_Parms;
 	IsActive_Parms.UniqueId = UniqueId;
@@ -5570,10 +5272,9 @@ bool USFXGAWReinforcementMatchConsumable_Gear::IsActive ( int UniqueId, float Ve
 
 struct FString USFXGAWReinforcementMatchConsumable_Gear::TrimTrailingZeroes ( struct FString S )
 {
-	static UFunction* pFnTrimTrailingZeroes = NULL;
-
+	UFunction* pFnTrimTrailingZeroes = (UFunction*) SdkBindings::Get ( 7441 );
 	if ( ! pFnTrimTrailingZeroes )
-		pFnTrimTrailingZeroes = (UFunction*) UObject::GObjObjects()->Data[ 124952 ];
+		return {};
 
 	USFXGAWReinforcementMatchConsumable_Gear_execTrimTrailingZeroes_Parms TrimTrailingZeroes_Parms;
 	memcpy ( &TrimTrailingZeroes_Parms.S, &S, 0xC );
@@ -5591,10 +5292,9 @@ struct FString USFXGAWReinforcementMatchConsumable_Gear::TrimTrailingZeroes ( st
 
 struct FString USFXGAWReinforcementMatchConsumable_Gear::FloatToPercentString ( float F )
 {
-	static UFunction* pFnFloatToPercentString = NULL;
-
+	UFunction* pFnFloatToPercentString = (UFunction*) SdkBindings::Get ( 7440 );
 	if ( ! pFnFloatToPercentString )
-		pFnFloatToPercentString = (UFunction*) UObject::GObjObjects()->Data[ 124949 ];
+		return {};
 
 	USFXGAWReinforcementMatchConsumable_Gear_execFloatToPercentString_Parms FloatToPercentString_Parms;
 	FloatToPercentString_Parms.F = F;
@@ -5612,10 +5312,9 @@ struct FString USFXGAWReinforcementMatchConsumable_Gear::FloatToPercentString (
 
 struct FGearDescriptionTokens USFXGAWReinforcementMatchConsumable_Gear::FindDescriptionTokens ( struct FString CardUniqueName )
 {
-	static UFunction* pFnFindDescriptionTokens = NULL;
-
+	UFunction* pFnFindDescriptionTokens = (UFunction*) SdkBindings::Get ( 7439 );
 	if ( ! pFnFindDescriptionTokens )
-		pFnFindDescriptionTokens = (UFunction*) UObject::GObjObjects()->Data[ 124944 ];
+		return {};
 
 	USFXGAWReinforcementMatchConsumable_Gear_execFindDescriptionTokens_Parms FindDescriptionTokens_Parms;
 	memcpy ( &FindDescriptionTokens_Parms.CardUniqueName, &CardUniqueName, 0xC );
@@ -5633,10 +5332,9 @@ struct FGearDescriptionTokens USFXGAWReinforcementMatchConsumable_Gear::FindDesc
 
 void USFXGAWReinforcementMatchConsumable_Gear::PrepareCustomTokensForGearDescription ( struct FString CardUniqueName, int GearLevel )
 {
-	static UFunction* pFnPrepareCustomTokensForGearDescription = NULL;
-
+	UFunction* pFnPrepareCustomTokensForGearDescription = (UFunction*) SdkBindings::Get ( 7438 );
 	if ( ! pFnPrepareCustomTokensForGearDescription )
-		pFnPrepareCustomTokensForGearDescription = (UFunction*) UObject::GObjObjects()->Data[ 124939 ];
+		return;
 
 	USFXGAWReinforcementMatchConsumable_Gear_execPrepareCustomTokensForGearDescription_Parms PrepareCustomTokensForGearDescription_Parms;
 	memcpy ( &PrepareCustomTokensForGearDescription_Parms.CardUniqueName, &CardUniqueName, 0xC );
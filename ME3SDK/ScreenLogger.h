@@ -1,17 +1,24 @@
 #pragma once
 
 #include <string>
-#include "SdkHeaders.h"
+#include "Packages\SFXGame.h"
 using namespace std;
 using BYTE = unsigned char;
 
 //adapted from WarrantyVoider's ME3OnTheHook
 class ScreenLogger
 {
-	wchar_t* Name;
-	wchar_t* MessageBuffer[20];
+	FString Name;
+	// Lines live in one arena allocated up front: slot i holds up to LineLength - 1 characters plus a terminator at
+	// Arena.Data + i * LineLength. Head is the slot of the newest line, and Lines how many slots hold one.
+	TOwnedArray<wchar_t> Arena;
+	TOwnedArray<int> Lengths;
+	int Capacity;
+	int LineLength;
+	int Head;
+	int Lines;
 
-	static void RenderText(wchar_t* msg, const float x, const float y, const float r, const float g, const float b, UCanvas* can)
+	static void RenderText(const FString& msg, const float x, const float y, const float r, const float g, const float b, UCanvas* can)
 	{
 		can->SetDrawColor(BYTE(r) * 255, BYTE(g) * 255, BYTE(b) * 255, 255);
 		can->SetPos(x, y);
@@ -30,50 +37,81 @@ class ScreenLogger
 		renderInfo.GlowInfo.GlowColor = drawColor;
 		renderInfo.GlowInfo.GlowInnerRadius = glowBorder;
 		renderInfo.GlowInfo.GlowOuterRadius = glowBorder;
-		can->DrawText(FString(msg), 1, 1.0f, 1.0f, &renderInfo);
+		can->DrawText(msg, 1, 1.0f, 1.0f, &renderInfo);
 	}
-public:
 
-	ScreenLogger(wchar_t* name) : Name(name)
+	/// <summary>
+	/// The line logged age messages ago, as an FString over its slot in the arena.
+	/// </summary>
+	FString GetLine(const int age) const
 	{
-		ZeroMemory(MessageBuffer, sizeof(MessageBuffer));
+		const auto slot = (Head - age + Capacity) % Capacity;
+		FString line;
+		line.Data = Arena.Data + slot * LineLength;
+		line.Count = line.Max = Lengths(slot) + 1;
+		return line;
 	}
 
-	~ScreenLogger()
+public:
+
+	/// <summary>
+	/// Keeps the last capacity messages, each cut to lineLength - 1 characters. All memory is allocated here.
+	/// </summary>
+	ScreenLogger(wchar_t* name, const int capacity = 20, const int lineLength = 1024)
+		: Name(name), Capacity(capacity > 0 ? capacity : 1), LineLength(lineLength > 1 ? lineLength : 2), Head(0), Lines(0)
 	{
-		for (auto& msg : MessageBuffer)
-		{
-			if (msg)
-			{
-				free(msg);
-			}
-		}
+		Arena.AddUninitialized(Capacity * LineLength);
+		Lengths.AddUninitialized(Capacity);
 	}
-	
+
 	void PostRenderer(ABioHUD* hud) const
 	{
 		RenderText(Name, 0, 0, 0, 1, 0, hud->Canvas);
-		for (auto i = 0; i < 20; i++)
+		for (auto i = 0; i < Lines; i++)
 		{
-			if (MessageBuffer[i])
-			{
-				RenderText(MessageBuffer[i], 0, float(i * 12 + 12), 0, 1, 0, hud->Canvas);
-			}
+			RenderText(GetLine(i), 0, float(i * 12 + 12), 0, 1, 0, hud->Canvas);
 		}
 	}
 
-	void LogMessage(const wstring& text)
+	void LogMessage(const wchar_t* text, const int length)
 	{
-		const auto mtext = static_cast<wchar_t*>(malloc(sizeof(wchar_t) * 1024));
-		swprintf(mtext, 1024, L"%s", text.c_str());
-		if (MessageBuffer[19])
+		Head = (Head + 1) % Capacity;
+		const auto line = Arena.Data + Head * LineLength;
+		const auto count = length < LineLength - 1 ? length : LineLength - 1;
+		wmemcpy(line, text, count);
+		line[count] = 0;
+		Lengths(Head) = count;
+		if (Lines < Capacity)
 		{
-			free(MessageBuffer[19]);
+			Lines++;
 		}
-		for (auto i = 19; i > 0; i--)
+	}
+
+	void LogMessage(const wstring& text)
+	{
+		LogMessage(text.c_str(), int(text.length()));
+	}
+
+	/// <summary>
+	/// Overwrites the newest line, e.g. to update a repeat count, or logs text if there are no lines yet.
+	/// </summary>
+	void ReplaceNewest(const wchar_t* text, const int length)
+	{
+		if (Lines > 0)
 		{
-			MessageBuffer[i] = MessageBuffer[i - 1];
+			Head = (Head - 1 + Capacity) % Capacity;
+			Lines--;
 		}
-		MessageBuffer[0] = mtext;
+		LogMessage(text, length);
+	}
+
+	void ReplaceNewest(const wstring& text)
+	{
+		ReplaceNewest(text.c_str(), int(text.length()));
+	}
+
+	void Clear()
+	{
+		Lines = 0;
 	}
 };
\ No newline at end of file
@@ -0,0 +1,199 @@
+#pragma once
+/*
+#############################################################################################
+# Mass Effect 3 (1.5) SDK
+# Generated with TheFeckless UE3 SDK Generator v1.4_Beta-Rev.51
+# ========================================================================================= #
+# File: SdkBase.h
+# ========================================================================================= #
+# Credits: uNrEaL, Tamimego, SystemFiles, R00T88, _silencer, the1domo, K@N@VEL
+# Thanks: HOOAH07, lowHertz
+# Forums: www.uc-forum.com, www.gamedeception.net
+#############################################################################################
+*/
+
+#include "SdkPlatform.h"
+
+/*
+# ========================================================================================= #
+# Defines
+# ========================================================================================= #
+*/
+
+#ifndef ME3SDK_PORTABLE
+#define GObjects			0x01AB5634
+#else
+// There's no game to read GObjObjects from, so the host (e.g. the synthetic table in SdkBench) installs one here.
+inline void*& PortableObjectTable()
+{
+	static void* table = nullptr;
+	return table;
+}
+#define GObjects			PortableObjectTable()
+#endif
+
+/*
+# ========================================================================================= #
+# Structs
+# ========================================================================================= #
+*/
+
+template< class T > struct TArray 
+{ 
+public: 
+	T* Data; 
+	int Count; 
+	int Max; 
+
+public: 
+	TArray() 
+	{ 
+		Data = NULL; 
+		Count = Max = 0; 
+	};
+
+	TArray(int size)
+	{
+		Data = (T*)malloc(sizeof(T) * size);
+		Max = size;
+		Count = 0;
+	};
+
+public: 
+	int Num() const
+	{ 
+		return this->Count; 
+	}; 
+
+	bool Any() const {
+		return this->Count > 0;
+	}
+
+	T& operator() ( int i ) 
+	{ 
+		return this->Data[ i ]; 
+	}; 
+
+	const T& operator() ( int i ) const 
+	{ 
+		return this->Data[ i ]; 
+	}; 
+
+	void Add ( T InputData ) 
+	{
+		if (Count >= Max)
+		{
+			Max = Count + 3*Count/8 + 16;
+			Data = (T*)realloc(Data, sizeof(T) * Max);
+		}
+		Data[Count++] = InputData;
+	}; 
+
+	void Clear() 
+	{ 
+		free ( Data ); 
+		Data = NULL; 
+		Count = Max = 0; 
+	}; 
+}; 
+
+struct FNameEntry 
+{ 
+	unsigned char	UnknownData00[ 0x8 ]; 
+	char			Name[ 0x10 ]; 
+}; 
+
+struct FName 
+{ 
+	FNameEntry*		NameEntry; 
+	UINT32	NameIndex; 
+
+	char* GetName() 
+	{ 
+		return this->NameEntry->Name; 
+	}; 
+
+	UINT32 GetIndex()
+	{
+		return this->NameIndex;
+	};
+
+	bool operator == ( const FName& A ) const 
+	{ 
+		return ( NameEntry == A.NameEntry ); 
+	};
+
+	bool operator == (const char* str) const
+	{
+		return strcmp(NameEntry->Name, str) == 0;
+	};
+}; 
+
+struct FString : public TArray< wchar_t > 
+{ 
+	FString() {}; 
+
+	FString ( wchar_t* Other ) 
+	{ 
+		this->Max = this->Count = *Other ? ( wcslen ( Other ) + 1 ) : 0; 
+
+		if ( this->Count ) 
+			this->Data = Other; 
+	}; 
+
+	~FString() {}; 
+
+	FString operator = ( wchar_t* Other ) 
+	{ 
+		if ( this->Data != Other ) 
+		{ 
+			this->Max = this->Count = *Other ? ( wcslen ( Other ) + 1 ) : 0; 
+
+			if ( this->Count ) 
+				this->Data = Other; 
+		} 
+
+		return *this; 
+	};
+
+	/// <summary>
+	/// Checks if the string content of this FString matches the other
+	/// </summary>
+	/// <param name="other"></param>
+	/// <returns></returns>
+	bool operator == (const FString& other) const
+	{
+		// Count includes the terminator, so different lengths can't match and equal ones compare without a scan for it.
+		return Count == other.Count && (Count == 0 || wmemcmp(Data, other.Data, size_t(Count)) == 0);
+	};
+	
+	bool operator == (const wchar_t* str) const
+	{
+		return wcscmp(Data, str) == 0;
+	};
+}; 
+
+struct FScriptDelegate 
+{ 
+	unsigned char UnknownData00[ 0xC ]; 
+}; 
+
+/// <summary>
+/// Appends text at Buffer + Length, truncating to fit BufferSize, and returns the new length.
+/// </summary>
+inline size_t AppendToNameBuffer(char* Buffer, size_t BufferSize, size_t Length, const char* Text)
+{
+	while (*Text && Length + 1 < BufferSize)
+	{
+		Buffer[Length++] = *Text++;
+	}
+	if (BufferSize)
+	{
+		Buffer[Length] = '\0';
+	}
+	return Length;
+}
+
+#include "OwnedArray.h"
+#include "FStringView.h"
+#include "SdkBindings.h"
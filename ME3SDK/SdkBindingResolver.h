@@ -0,0 +1,102 @@
+#pragma once
+
+#include "SDK_HEADERS/SdkBindingTable.h"
+
+int SdkBindings::MissedAtCount[ SDK_BINDING_COUNT ];
+
+bool SdkBindings::HasExpectedName(UObject* object, const SdkBinding& binding)
+{
+	char fullName[256];
+	object->GetFullName(fullName, sizeof(fullName));
+	return !_stricmp(fullName, binding.FullName);
+}
+
+UObject* SdkBindings::ResolveOne(const int slot)
+{
+	const auto& binding = GSdkBindingTable[slot];
+	const auto objects = UObject::GObjObjects();
+	if (MissedAtCount[slot] == objects->Count)
+	{
+		// Nothing has been loaded since the last look, so it's still not there.
+		return nullptr;
+	}
+	const auto atIndex = binding.Index < objects->Count ? objects->Data[binding.Index] : nullptr;
+	if (atIndex && HasExpectedName(atIndex, binding))
+	{
+		Objects[slot] = atIndex;
+		return atIndex;
+	}
+
+	const auto found = ObjectIndex::Get().FindByPath(binding.FullName);
+	if (found)
+	{
+		Objects[slot] = found;
+		return found;
+	}
+	// Not loaded yet. Whatever is at the generated index is some other object, so it's not handed out; look again
+	// once more objects have been loaded.
+	MissedAtCount[slot] = objects->Count;
+	return nullptr;
+}
+
+SdkBindings::ResolveResult SdkBindings::ResolveAll()
+{
+	LARGE_INTEGER frequency, start, end;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&start);
+
+	ResolveResult result = { SDK_BINDING_COUNT, 0, 0, 0, 0.0 };
+	const auto objects = UObject::GObjObjects();
+
+	// Direct pass: most bindings are still where the SDK expects them.
+	std::vector<int> misplaced;
+	for (auto slot = 0; slot < SDK_BINDING_COUNT; slot++)
+	{
+		if (Objects[slot])
+		{
+			result.Verified++;
+			continue;
+		}
+		const auto& binding = GSdkBindingTable[slot];
+		const auto atIndex = binding.Index < objects->Count ? objects->Data[binding.Index] : nullptr;
+		if (atIndex && HasExpectedName(atIndex, binding))
+		{
+			Objects[slot] = atIndex;
+			result.Verified++;
+		}
+		else
+		{
+			misplaced.push_back(slot);
+		}
+	}
+
+	// Everything else is looked up by name in one batch.
+	if (!misplaced.empty())
+	{
+		std::vector<const char*> names;
+		names.reserve(misplaced.size());
+		for (const auto slot : misplaced)
+		{
+			names.push_back(GSdkBindingTable[slot].FullName);
+		}
+		std::vector<UObject*> found(misplaced.size());
+		ObjectIndex::Get().FindByPaths(names.data(), found.data(), int(names.size()));
+		for (size_t i = 0; i < misplaced.size(); i++)
+		{
+			if (found[i])
+			{
+				Objects[misplaced[i]] = found[i];
+				result.Moved++;
+			}
+			else
+			{
+				MissedAtCount[misplaced[i]] = objects->Count;
+				result.Missing++;
+			}
+		}
+	}
+
+	QueryPerformanceCounter(&end);
+	result.Milliseconds = double(end.QuadPart - start.QuadPart) * 1000.0 / double(frequency.QuadPart);
+	return result;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+class UObject;
+
+/// <summary>
+/// A class or function the generated SDK calls into: where it was in GObjObjects when the SDK was generated, and
+/// the full name it must have.
+/// </summary>
+struct SdkBinding
+{
+	int Index;
+	const char* FullName;
+};
+
+/// <summary>
+/// The objects behind every generated StaticClass() and function wrapper, in one dense array indexed by binding
+/// slot (see SdkBindingTable.h). ResolveAll fills the array in one pass at attach: each entry is checked against
+/// its expected full name, and entries that DLC or mods have moved are looked up by name through ObjectIndex.
+/// Entries it couldn't find, e.g. classes from packages that aren't loaded yet, are resolved on first use. Until
+/// they're found, Get returns nullptr, and only looks again once GObjObjects has grown or shrunk. A function
+/// wrapper whose function isn't found returns without calling anything: a default value (0, false, nullptr, an
+/// empty struct) and out parameters left as they were. StaticClass() returns nullptr, which IsA and the
+/// FindObjectsOfType family treat as matching nothing.
+/// </summary>
+class SdkBindings
+{
+public:
+	struct ResolveResult
+	{
+		int Count;
+		// Found at the index the SDK was generated against.
+		int Verified;
+		// Found by name somewhere else.
+		int Moved;
+		// Not found yet; Get returns nullptr for these until they're loaded.
+		int Missing;
+		double Milliseconds;
+	};
+
+	static UObject* Get(const int slot)
+	{
+		const auto object = Objects[slot];
+		return object ? object : ResolveOne(slot);
+	}
+
+	/// <summary>
+	/// Resolves and verifies every binding. Call once from the attach thread; later calls only retry missing ones.
+	/// </summary>
+	static ResolveResult ResolveAll();
+
+private:
+	static UObject* Objects[];
+	// GObjObjects Count when each binding was last looked for and not found.
+	static int MissedAtCount[];
+
+	static bool HasExpectedName(UObject* object, const SdkBinding& binding);
+	static UObject* ResolveOne(int slot);
+};
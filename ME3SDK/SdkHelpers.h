@@ -0,0 +1,149 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string>
+#include <vector>
+#include <locale>
+#include <codecvt>
+#include "Packages/Core.h"
+
+// The helpers from ME3TweaksHeader.h that only need the Core package, kept apart so they also build outside the game
+// (see SdkPlatform.h).
+
+/// <summary>
+/// Replaces the contents of foundObjects with the objects in memory of a specific class type. Reusing one array for
+/// a scan that runs every frame saves allocating a new one each time.
+/// </summary>
+/// <param name="type"></param>
+/// <param name="foundObjects"></param>
+void FindObjectsOfType(UClass* type, TOwnedArray<UObject*>& foundObjects)
+{
+	foundObjects.Empty();
+	ObjectIndex::Get().ForEach(type, [&](UObject* obj)
+	{
+		foundObjects.Add(obj);
+		return true;
+	});
+}
+
+/// <summary>
+/// Gets objects in memory of a specific class type. Returns an array with objects that can be casted to that type.
+/// </summary>
+/// <param name="type"></param>
+/// <returns></returns>
+TOwnedArray<UObject*> FindObjectsOfType(UClass* type)
+{
+	TOwnedArray<UObject*> foundObjects;
+	FindObjectsOfType(type, foundObjects);
+	return foundObjects;
+}
+
+/// <summary>
+/// Gets the first object in memory of the specified type. Ensure you check for NULL.
+/// </summary>
+/// <param name="type"></param>
+/// <returns></returns>
+UObject* FindObjectOfType(UClass* type)
+{
+	UObject* found = NULL;
+	ObjectIndex::Get().ForEach(type, [&](UObject* obj)
+	{
+		found = obj;
+		return false;
+	});
+	return found;
+}
+
+const std::string string_format(const char* const zcFormat, ...) {
+
+	// initialize use of the variable argument array
+	va_list vaArgs;
+	va_start(vaArgs, zcFormat);
+
+	// reliably acquire the size
+	// from a copy of the variable argument array
+	// and a functionally reliable call to mock the formatting
+	va_list vaArgsCopy;
+	va_copy(vaArgsCopy, vaArgs);
+	const int iLen = std::vsnprintf(NULL, 0, zcFormat, vaArgsCopy);
+	va_end(vaArgsCopy);
+
+	// return a formatted string without risking memory mismanagement
+	// and without assuming any compiler or platform specific behavior
+	std::vector<char> zc(iLen + 1);
+	std::vsnprintf(zc.data(), zc.size(), zcFormat, vaArgs);
+	va_end(vaArgs);
+	return std::string(zc.data(), iLen);
+}
+
+/// <summary>
+/// Converts a widestring (wstring) to wchar_t
+/// </summary>
+/// <param name="wstr"></param>
+/// <returns></returns>
+inline std::string ws2s(const std::wstring& wstr)
+{
+	using convert_typeX = std::codecvt_utf8<wchar_t>;
+	std::wstring_convert<convert_typeX, wchar_t> converterX;
+
+	return converterX.to_bytes(wstr);
+}
+
+/*Checks if w2 is part of w1*/
+bool isPartOf(char* w1, char* w2)
+{
+	int i = 0;
+	int j = 0;
+
+
+	while (w1[i] != '\0') {
+		if (w1[i] == w2[j])
+		{
+			int init = i;
+			while (w1[i] == w2[j] && w2[j] != '\0')
+			{
+				j++;
+				i++;
+			}
+			if (w2[j] == '\0') {
+				return true;
+			}
+			// Resume after where this attempt started, or a partial match at the end of w1 would step past its end.
+			i = init;
+			j = 0;
+		}
+		i++;
+	}
+	return false;
+}
+
+std::string wchar2string(wchar_t* str)
+{
+	std::string mystring;
+	while (*str)
+		mystring += (char)*str++;
+	return  mystring;
+}
+
+char GetBit(int value, int bit) {
+	return (value >> bit) & 1;
+}
+
+std::string GuidToString(FGuid guid)
+{
+	char guid_cstr[39];
+	snprintf(guid_cstr, sizeof(guid_cstr),
+		"{%08x-%04x-%04x-%02x%02x-%02x%02x%02x%02x%02x%02x}",
+		guid.A, guid.B, guid.C,
+		GetBit(guid.D, 0), GetBit(guid.D, 1), GetBit(guid.D, 2), GetBit(guid.D, 3),
+		GetBit(guid.D, 4), GetBit(guid.D, 5), GetBit(guid.D, 6), GetBit(guid.D, 7));
+
+	return std::string(guid_cstr);
+}
+
+template<typename T>
+bool IsA(UObject* object) {
+	static ClassHierarchy::TypeCache typeCache;
+	return ClassHierarchy::IsChildOf(object->Class, T::StaticClass(), typeCache);
+}
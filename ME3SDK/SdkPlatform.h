@@ -0,0 +1,87 @@
+#pragma once
+
+// The SDK's only platform dependency. In the game this is windows.h. Anywhere else (GCC or Clang on Linux, e.g. for
+// ME3SDK\Bench) ME3SDK_PORTABLE is defined and the handful of Windows and MSVC CRT names the Core layer uses are
+// provided here instead. Only the Core package and the helpers in SdkHelpers.h are meant to build this way.
+
+#if !defined(_WIN32) && !defined(ME3SDK_PORTABLE)
+#define ME3SDK_PORTABLE
+#endif
+
+#ifndef ME3SDK_PORTABLE
+
+#include <windows.h>
+#include <wchar.h>
+
+#else
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <wchar.h>
+#include <chrono>
+#include <thread>
+
+// Calling conventions only mean something for the game's 32 bit x86 code.
+#define __thiscall
+
+typedef uint8_t BYTE;
+typedef uint16_t WORD;
+typedef uint32_t DWORD;
+typedef uint32_t UINT32;
+typedef uint64_t ULONGLONG;
+
+union LARGE_INTEGER
+{
+	long long QuadPart;
+};
+
+inline void Sleep(const DWORD milliseconds)
+{
+	std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+}
+
+inline int QueryPerformanceFrequency(LARGE_INTEGER* frequency)
+{
+	frequency->QuadPart = 1000000000LL;
+	return 1;
+}
+
+inline int QueryPerformanceCounter(LARGE_INTEGER* counter)
+{
+	counter->QuadPart = std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+	return 1;
+}
+
+inline ULONGLONG GetTickCount64()
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline int _stricmp(const char* a, const char* b)
+{
+	return strcasecmp(a, b);
+}
+
+// The array forms of the MSVC secure CRT functions the SDK calls. Like the originals, they truncate rather than
+// overflow; MSVC would invoke the invalid parameter handler instead.
+template <size_t N>
+int strcpy_s(char (&destination)[N], const char* source)
+{
+	snprintf(destination, N, "%s", source);
+	return 0;
+}
+
+template <size_t N>
+int strcat_s(char (&destination)[N], const char* source)
+{
+	const auto length = strnlen(destination, N);
+	snprintf(destination + length, N - length, "%s", source);
+	return 0;
+}
+
+#endif
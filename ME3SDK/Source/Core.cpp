@@ -0,0 +1,5 @@
+// Function bodies for the Core package. See ME3SDK.vcxproj.
+
+#include "pch.h"
+#include "..\Packages\Core.h"
+#include "..\SDK_HEADERS\Core_functions.h"
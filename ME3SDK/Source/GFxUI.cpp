@@ -0,0 +1,5 @@
+// Function bodies for the GFxUI package. See ME3SDK.vcxproj.
+
+#include "pch.h"
+#include "..\Packages\GFxUI.h"
+#include "..\SDK_HEADERS\GFxUI_functions.h"
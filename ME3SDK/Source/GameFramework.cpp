@@ -0,0 +1,5 @@
+// Function bodies for the GameFramework package. See ME3SDK.vcxproj.
+
+#include "pch.h"
+#include "..\Packages\GameFramework.h"
+#include "..\SDK_HEADERS\GameFramework_functions.h"
@@ -0,0 +1,5 @@
+// Function bodies for the IpDrv package. See ME3SDK.vcxproj.
+
+#include "pch.h"
+#include "..\Packages\IpDrv.h"
+#include "..\SDK_HEADERS\IpDrv_functions.h"
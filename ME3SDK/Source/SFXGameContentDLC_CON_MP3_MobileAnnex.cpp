@@ -0,0 +1,5 @@
+// Function bodies for the SFXGameContentDLC_CON_MP3_MobileAnnex package. See ME3SDK.vcxproj.
+
+#include "pch.h"
+#include "..\Packages\SFXGameContentDLC_CON_MP3_MobileAnnex.h"
+#include "..\SDK_HEADERS\SFXGameContentDLC_CON_MP3_MobileAnnex_functions.h"
@@ -0,0 +1,5 @@
+// Function bodies for the SFXOnlineFoundation package. See ME3SDK.vcxproj.
+
+#include "pch.h"
+#include "..\Packages\SFXOnlineFoundation.h"
+#include "..\SDK_HEADERS\SFXOnlineFoundation_functions.h"
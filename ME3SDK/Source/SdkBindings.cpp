@@ -0,0 +1,4 @@
+// The binding table and its resolver. See SdkBindings.h.
+
+#include "pch.h"
+#include "..\SdkBindingResolver.h"
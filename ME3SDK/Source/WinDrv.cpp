@@ -0,0 +1,5 @@
+// Function bodies for the WinDrv package. See ME3SDK.vcxproj.
+
+#include "pch.h"
+#include "..\Packages\WinDrv.h"
+#include "..\SDK_HEADERS\WinDrv_functions.h"
@@ -0,0 +1,5 @@
+// Function bodies for the WwiseAudio package. See ME3SDK.vcxproj.
+
+#include "pch.h"
+#include "..\Packages\WwiseAudio.h"
+#include "..\SDK_HEADERS\WwiseAudio_functions.h"
@@ -0,0 +1,3 @@
+// Builds the precompiled header. See pch.h.
+
+#include "pch.h"
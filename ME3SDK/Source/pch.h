@@ -0,0 +1,4 @@
+#pragma once
+
+// Shared by every source file in ME3SDK.lib: the package headers down to SFXGame, built once into the PCH.
+#include "..\Packages\SFXGame.h"
@@ -0,0 +1,5 @@
+// Function bodies for the sfxgamecontent package. See ME3SDK.vcxproj.
+
+#include "pch.h"
+#include "..\Packages\sfxgamecontent.h"
+#include "..\SDK_HEADERS\sfxgamecontent_functions.h"
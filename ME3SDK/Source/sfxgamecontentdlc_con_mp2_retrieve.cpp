@@ -0,0 +1,5 @@
+// Function bodies for the sfxgamecontentdlc_con_mp2_retrieve package. See ME3SDK.vcxproj.
+
+#include "pch.h"
+#include "..\Packages\sfxgamecontentdlc_con_mp2_retrieve.h"
+#include "..\SDK_HEADERS\sfxgamecontentdlc_con_mp2_retrieve_functions.h"
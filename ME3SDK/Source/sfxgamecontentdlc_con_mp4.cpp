@@ -0,0 +1,5 @@
+// Function bodies for the sfxgamecontentdlc_con_mp4 package. See ME3SDK.vcxproj.
+
+#include "pch.h"
+#include "..\Packages\sfxgamecontentdlc_con_mp4.h"
+#include "..\SDK_HEADERS\sfxgamecontentdlc_con_mp4_functions.h"
@@ -0,0 +1,5 @@
+// Function bodies for the sfxgamecontentdlc_con_mp4_horde package. See ME3SDK.vcxproj.
+
+#include "pch.h"
+#include "..\Packages\sfxgamecontentdlc_con_mp4_horde.h"
+#include "..\SDK_HEADERS\sfxgamecontentdlc_con_mp4_horde_functions.h"
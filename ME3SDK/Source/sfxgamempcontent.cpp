@@ -0,0 +1,5 @@
+// Function bodies for the sfxgamempcontent package. See ME3SDK.vcxproj.
+
+#include "pch.h"
+#include "..\Packages\sfxgamempcontent.h"
+#include "..\SDK_HEADERS\sfxgamempcontent_functions.h"
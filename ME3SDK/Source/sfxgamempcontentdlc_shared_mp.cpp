@@ -0,0 +1,5 @@
+// Function bodies for the sfxgamempcontentdlc_shared_mp package. See ME3SDK.vcxproj.
+
+#include "pch.h"
+#include "..\Packages\sfxgamempcontentdlc_shared_mp.h"
+#include "..\SDK_HEADERS\sfxgamempcontentdlc_shared_mp_functions.h"
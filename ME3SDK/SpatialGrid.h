@@ -0,0 +1,370 @@
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+/// <summary>
+/// Indexes items by location in a uniform grid of square columns over X and Y. Only columns that hold an item
+/// exist, so the grid covers any world size. A query visits only the columns its area touches and tests Z exactly.
+/// Items are given their locations; the grid never reads them itself. Refresh re-reads a few items' locations at a
+/// time through a callback, so following moving items can be spread over frames.
+/// </summary>
+template <class T>
+class SpatialGrid
+{
+public:
+	struct Entry
+	{
+		T Item;
+		// Caller's data, e.g. where to check that the item is still alive.
+		int Tag;
+		float X;
+		float Y;
+		float Z;
+	};
+
+	explicit SpatialGrid(const float cellSize = 1024.0f) : CellSize(cellSize)
+	{
+	}
+
+	int Num() const
+	{
+		return int(Entries.size());
+	}
+
+	bool Contains(const T& item) const
+	{
+		return IndexOf.count(item) != 0;
+	}
+
+	void Clear()
+	{
+		Entries.clear();
+		Places.clear();
+		IndexOf.clear();
+		Cells.clear();
+		Cursor = 0;
+	}
+
+	/// <summary>
+	/// Adds an item, or moves it if it's already in the grid.
+	/// </summary>
+	void Add(const T& item, const int tag, const float x, const float y, const float z)
+	{
+		const auto it = IndexOf.find(item);
+		if (it != IndexOf.end())
+		{
+			Entries[it->second].Tag = tag;
+			Move(it->second, x, y, z);
+			return;
+		}
+		const auto index = int(Entries.size());
+		Entries.push_back(Entry{ item, tag, x, y, z });
+		Places.emplace_back();
+		IndexOf[item] = index;
+		AddToCell(index);
+	}
+
+	void Remove(const T& item)
+	{
+		const auto it = IndexOf.find(item);
+		if (it != IndexOf.end())
+		{
+			RemoveAt(it->second);
+		}
+	}
+
+	/// <summary>
+	/// Re-reads the locations of up to budget items, continuing where the last call stopped, through
+	/// update(const Entry&, float& x, float& y, float& z). An item for which update returns false is removed.
+	/// </summary>
+	template <class TUpdate>
+	void Refresh(int budget, TUpdate update)
+	{
+		while (budget-- > 0 && !Entries.empty())
+		{
+			if (Cursor >= int(Entries.size()))
+			{
+				Cursor = 0;
+			}
+			float x, y, z;
+			if (!update(static_cast<const Entry&>(Entries[Cursor]), x, y, z))
+			{
+				// The last entry moves into this index, so it's looked at next.
+				RemoveAt(Cursor);
+				continue;
+			}
+			Move(Cursor, x, y, z);
+			Cursor++;
+		}
+	}
+
+	/// <summary>
+	/// Calls callback(const Entry&, float distanceSquared) for each item within radius of the point.
+	/// </summary>
+	template <class TCallback>
+	void ForEachInRadius(const float x, const float y, const float z, const float radius, TCallback callback) const
+	{
+		const auto radiusSquared = radius * radius;
+		VisitColumns(x - radius, y - radius, x + radius, y + radius, [&](const Entry& entry)
+		{
+			const auto distanceSquared = DistanceSquared(entry, x, y, z);
+			if (distanceSquared <= radiusSquared)
+			{
+				callback(entry, distanceSquared);
+			}
+		});
+	}
+
+	/// <summary>
+	/// Calls callback(const Entry&) for each item inside the box, edges included.
+	/// </summary>
+	template <class TCallback>
+	void ForEachInBox(const float minX, const float minY, const float minZ, const float maxX, const float maxY,
+		const float maxZ, TCallback callback) const
+	{
+		VisitColumns(minX, minY, maxX, maxY, [&](const Entry& entry)
+		{
+			if (entry.X >= minX && entry.X <= maxX && entry.Y >= minY && entry.Y <= maxY && entry.Z >= minZ && entry.Z <= maxZ)
+			{
+				callback(entry);
+			}
+		});
+	}
+
+	/// <summary>
+	/// Finds the item nearest the point, within maxRadius, for which accept(const Entry&) returns true. Columns are
+	/// searched in rings around the point's column until no unsearched column can hold anything nearer. Returns
+	/// nullptr if there's no such item.
+	/// </summary>
+	template <class TAccept>
+	const Entry* FindNearest(const float x, const float y, const float z, const float maxRadius, TAccept accept) const
+	{
+		const Entry* best = nullptr;
+		auto bestDistanceSquared = maxRadius * maxRadius;
+		const auto consider = [&](const Entry& entry)
+		{
+			const auto distanceSquared = DistanceSquared(entry, x, y, z);
+			if (distanceSquared <= bestDistanceSquared && accept(entry))
+			{
+				best = &entry;
+				bestDistanceSquared = distanceSquared;
+			}
+		};
+		if (Entries.empty())
+		{
+			return nullptr;
+		}
+
+		const auto cellX = CellOf(x);
+		const auto cellY = CellOf(y);
+		// Beyond this ring every column is either empty or farther than maxRadius.
+		auto lastRing = (std::max)((std::max)(cellX - MinCellX, MaxCellX - cellX), (std::max)(cellY - MinCellY, MaxCellY - cellY));
+		if (maxRadius < 1e30f)
+		{
+			lastRing = (std::min)(lastRing, int(maxRadius / CellSize) + 1);
+		}
+		long long columnsVisited = 0;
+		for (auto ring = 0; ring <= lastRing; ring++)
+		{
+			// Everything outside rings 0 to ring - 1 is at least this far away across X or Y.
+			const auto nearestOutside = float(ring - 1) * CellSize;
+			if (ring > 0 && best && nearestOutside > 0 && nearestOutside * nearestOutside >= bestDistanceSquared)
+			{
+				break;
+			}
+			columnsVisited += ring == 0 ? 1 : 8LL * ring;
+			if (columnsVisited > (long long)Entries.size())
+			{
+				// The rings have grown past the items, so looking at every item is cheaper.
+				for (const auto& entry : Entries)
+				{
+					consider(entry);
+				}
+				return best;
+			}
+			for (auto cx = cellX - ring; cx <= cellX + ring; cx++)
+			{
+				const auto edge = cx == cellX - ring || cx == cellX + ring;
+				for (auto cy = cellY - ring; cy <= cellY + ring; cy += edge || ring == 0 ? 1 : 2 * ring)
+				{
+					VisitColumn(cx, cy, consider);
+				}
+			}
+		}
+		return best;
+	}
+
+	/// <summary>
+	/// Calls callback(const Entry&) for every item, in no particular order.
+	/// </summary>
+	template <class TCallback>
+	void ForEach(TCallback callback) const
+	{
+		for (const auto& entry : Entries)
+		{
+			callback(entry);
+		}
+	}
+
+private:
+	// Where an entry sits: its column's key and its position in that column's list.
+	struct CellPlace
+	{
+		uint64_t Key = 0;
+		int Position = -1;
+	};
+
+	float CellSize;
+	std::vector<Entry> Entries;
+	std::vector<CellPlace> Places;
+	std::unordered_map<T, int> IndexOf;
+	std::unordered_map<uint64_t, std::vector<int>> Cells;
+	int Cursor = 0;
+	// Bounds of the columns that have held an item since the grid last held just one. They only grow otherwise.
+	int MinCellX = 0;
+	int MaxCellX = 0;
+	int MinCellY = 0;
+	int MaxCellY = 0;
+
+	int CellOf(const float coordinate) const
+	{
+		const auto cell = floorf(coordinate / CellSize);
+		// Clamped, and NaN sent to one end, so the conversion is always defined.
+		return cell >= -1e9f ? (cell <= 1e9f ? int(cell) : 1000000000) : -1000000000;
+	}
+
+	static uint64_t KeyOf(const int cellX, const int cellY)
+	{
+		return uint64_t(uint32_t(cellX)) << 32 | uint32_t(cellY);
+	}
+
+	static float DistanceSquared(const Entry& entry, const float x, const float y, const float z)
+	{
+		const auto dx = entry.X - x;
+		const auto dy = entry.Y - y;
+		const auto dz = entry.Z - z;
+		return dx * dx + dy * dy + dz * dz;
+	}
+
+	template <class TVisit>
+	void VisitColumn(const int cellX, const int cellY, TVisit& visit) const
+	{
+		const auto it = Cells.find(KeyOf(cellX, cellY));
+		if (it == Cells.end())
+		{
+			return;
+		}
+		for (const auto index : it->second)
+		{
+			visit(Entries[index]);
+		}
+	}
+
+	template <class TVisit>
+	void VisitColumns(const float minX, const float minY, const float maxX, const float maxY, TVisit visit) const
+	{
+		const auto fromX = (std::max)(CellOf(minX), MinCellX);
+		const auto toX = (std::min)(CellOf(maxX), MaxCellX);
+		const auto fromY = (std::max)(CellOf(minY), MinCellY);
+		const auto toY = (std::min)(CellOf(maxY), MaxCellY);
+		if (fromX > toX || fromY > toY)
+		{
+			return;
+		}
+		if (double(toX - fromX + 1) * double(toY - fromY + 1) > double(Entries.size()))
+		{
+			// An area this big touches more columns than there are items.
+			for (const auto& entry : Entries)
+			{
+				visit(entry);
+			}
+			return;
+		}
+		for (auto cx = fromX; cx <= toX; cx++)
+		{
+			for (auto cy = fromY; cy <= toY; cy++)
+			{
+				VisitColumn(cx, cy, visit);
+			}
+		}
+	}
+
+	void AddToCell(const int index)
+	{
+		const auto& entry = Entries[index];
+		const auto cellX = CellOf(entry.X);
+		const auto cellY = CellOf(entry.Y);
+		if (IndexOf.size() == 1)
+		{
+			MinCellX = MaxCellX = cellX;
+			MinCellY = MaxCellY = cellY;
+		}
+		else
+		{
+			MinCellX = (std::min)(MinCellX, cellX);
+			MaxCellX = (std::max)(MaxCellX, cellX);
+			MinCellY = (std::min)(MinCellY, cellY);
+			MaxCellY = (std::max)(MaxCellY, cellY);
+		}
+		auto& place = Places[index];
+		place.Key = KeyOf(cellX, cellY);
+		auto& cell = Cells[place.Key];
+		place.Position = int(cell.size());
+		cell.push_back(index);
+	}
+
+	void RemoveFromCell(const int index)
+	{
+		auto& place = Places[index];
+		const auto it = Cells.find(place.Key);
+		auto& cell = it->second;
+		const auto moved = cell.back();
+		cell[place.Position] = moved;
+		Places[moved].Position = place.Position;
+		cell.pop_back();
+		if (cell.empty())
+		{
+			Cells.erase(it);
+		}
+		place = CellPlace();
+	}
+
+	void Move(const int index, const float x, const float y, const float z)
+	{
+		auto& entry = Entries[index];
+		const auto key = KeyOf(CellOf(x), CellOf(y));
+		entry.X = x;
+		entry.Y = y;
+		entry.Z = z;
+		if (key != Places[index].Key)
+		{
+			RemoveFromCell(index);
+			AddToCell(index);
+		}
+	}
+
+	void RemoveAt(const int index)
+	{
+		RemoveFromCell(index);
+		IndexOf.erase(Entries[index].Item);
+		const auto last = int(Entries.size()) - 1;
+		if (index != last)
+		{
+			RemoveFromCell(last);
+			Entries[index] = Entries[last];
+			IndexOf[Entries[index].Item] = index;
+			Entries.pop_back();
+			Places.pop_back();
+			AddToCell(index);
+		}
+		else
+		{
+			Entries.pop_back();
+			Places.pop_back();
+		}
+	}
+};
@@ -9,30 +9,20 @@
 #include <shlwapi.h>
 
 //#include "..\ME3SDK\ME3TweaksHeader.h"
-#include "..\ME3SDK\SdkHeaders.h"
-#include "..\detours\detours.h"
+#include "..\ME3SDK\Packages\SFXOnlineFoundation.h"
+#include "..\ME3SDK\ProcessEventHub.h"
 
 #define _CRT_SECURE_NO_WARNINGS
-#pragma comment(lib, "detours.lib") //Library needed for Hooking part.
 
-typedef void(__thiscall *tProcessEvent)(class UObject *, class UFunction *, void *, void *);
-tProcessEvent ProcessEvent = (tProcessEvent)0x00453120;
-
-void __fastcall HookedPE(UObject *pObject, void *edx, UFunction *pFunction, void *pParms, void *pResult)
+bool OnCreateJobGetFriendLeaderboardData(UObject *pObject, UFunction *pFunction, void *pParms, void *pResult)
 {
-	char *szName = pFunction->GetFullName();
-	if (!strcmp(szName, "Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.CreateJobGetFriendLeaderboardData")){
-		return; //Skip this call as it causes crash
-	}
-	ProcessEvent(pObject, pFunction, pParms, pResult);
+	return false; //Skip this call as it causes crash
 }
 
 void onAttach()
 {
-	DetourTransactionBegin();
-	DetourUpdateThread(GetCurrentThread()); //This command set the current working thread to the game current thread.
-	DetourAttach(&(PVOID&)ProcessEvent, HookedPE); //This command will start your Hook.
-	DetourTransactionCommit();
+	SdkBindings::ResolveAll();
+	SubscribeProcessEvent("Function SFXOnlineFoundation.SFXOnlineComponentBlazeLeaderboard.CreateJobGetFriendLeaderboardData", OnCreateJobGetFriendLeaderboardData);
 }
 
 BOOL WINAPI DllMain(HMODULE hModule, DWORD dwReason, LPVOID lpReserved)
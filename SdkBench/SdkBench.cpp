@@ -0,0 +1,1044 @@
+// Benchmarks the SDK's Core layer and the helpers built on it against a synthetic GObjObjects table, so hot path
+// changes can be measured the same way on any machine, without the game. See readme.md for build instructions.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "../ME3SDK/SdkHelpers.h"
+#include "../ME3SDK/FullNameCache.h"
+#include "../ME3SDK/FunctionDispatch.h"
+#include "../ME3SDK/ProcessEventHub.h"
+#include "../ME3SDK/SpatialGrid.h"
+#include "SyntheticObjects.h"
+
+struct BenchSettings
+{
+	SyntheticOptions World;
+	const char* Filter = nullptr;
+	int MinTimeMs = 200;
+	int Repeat = 5;
+	bool Csv = false;
+};
+
+// Results are added here so the compiler can't drop the work that produced them.
+static volatile size_t GSink;
+
+class BenchRunner
+{
+public:
+	explicit BenchRunner(const BenchSettings& settings) : Settings(settings)
+	{
+		if (Settings.Csv)
+		{
+			printf("name,ns_per_op,ops_per_sec,note\n");
+		}
+		else
+		{
+			printf("%-52s %12s %14s  %s\n", "benchmark", "time/op", "ops/s", "note");
+		}
+	}
+
+	/// <summary>
+	/// Times body, which does opsPerCall operations per call, and prints the median of Repeat samples of at least
+	/// MinTimeMs each.
+	/// </summary>
+	template<typename TBody>
+	void Run(const std::string& name, const double opsPerCall, TBody body, const std::string& note = "")
+	{
+		if (!Selected(name))
+		{
+			return;
+		}
+		body();
+		std::vector<double> samples;
+		for (auto r = 0; r < Settings.Repeat; r++)
+		{
+			long long calls = 0;
+			const auto start = Clock::now();
+			double elapsed;
+			do
+			{
+				body();
+				calls++;
+				elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+			} while (elapsed < Settings.MinTimeMs * 1e6);
+			samples.push_back(elapsed / (double(calls) * opsPerCall));
+		}
+		std::sort(samples.begin(), samples.end());
+		Report(name, samples[samples.size() / 2], note);
+	}
+
+	/// <summary>
+	/// Times a single call of body, for work that only happens once, like building an index.
+	/// </summary>
+	template<typename TBody>
+	void RunOnce(const std::string& name, TBody body, const std::string& note = "")
+	{
+		if (!Selected(name))
+		{
+			return;
+		}
+		const auto start = Clock::now();
+		body();
+		Report(name, std::chrono::duration<double, std::nano>(Clock::now() - start).count(), note);
+	}
+
+private:
+	typedef std::chrono::steady_clock Clock;
+	const BenchSettings& Settings;
+
+	bool Selected(const std::string& name) const
+	{
+		return !Settings.Filter || strstr(name.c_str(), Settings.Filter);
+	}
+
+	void Report(const std::string& name, const double nanoseconds, const std::string& note) const
+	{
+		if (Settings.Csv)
+		{
+			printf("%s,%.3f,%.1f,%s\n", name.c_str(), nanoseconds, 1e9 / nanoseconds, note.c_str());
+			return;
+		}
+		char time[32];
+		if (nanoseconds < 1e3)
+		{
+			snprintf(time, sizeof(time), "%.2f ns", nanoseconds);
+		}
+		else if (nanoseconds < 1e6)
+		{
+			snprintf(time, sizeof(time), "%.2f us", nanoseconds / 1e3);
+		}
+		else
+		{
+			snprintf(time, sizeof(time), "%.2f ms", nanoseconds / 1e6);
+		}
+		printf("%-52s %12s %14.0f  %s\n", name.c_str(), time, 1e9 / nanoseconds, note.c_str());
+		fflush(stdout);
+	}
+};
+
+static std::vector<UObject*> LiveObjects()
+{
+	std::vector<UObject*> objects;
+	const auto table = UObject::GObjObjects();
+	for (auto i = 0; i < table->Count; i++)
+	{
+		if (table->Data[i])
+		{
+			objects.push_back(table->Data[i]);
+		}
+	}
+	return objects;
+}
+
+// The loop FindObjectsOfType used before ObjectIndex.
+static int CountLinear(UClass* type)
+{
+	auto count = 0;
+	const auto table = UObject::GObjObjects();
+	for (auto i = 0; i < table->Count; i++)
+	{
+		const auto object = table->Data[i];
+		if (object && object->IsA(type) && !strstr(object->Name.GetName(), "Default_"))
+		{
+			count++;
+		}
+	}
+	return count;
+}
+
+// The loop FindObject used before ObjectIndex.
+static UObject* FindLinear(const char* fullName)
+{
+	const auto table = UObject::GObjObjects();
+	char buffer[256];
+	for (auto i = 0; i < table->Count; i++)
+	{
+		const auto object = table->Data[i];
+		if (object)
+		{
+			object->GetFullName(buffer, sizeof(buffer));
+			if (!_stricmp(buffer, fullName))
+			{
+				return object;
+			}
+		}
+	}
+	return nullptr;
+}
+
+static bool WalkIsA(UClass* cls, UClass* type)
+{
+	for (UField* super = cls; super; super = super->SuperField)
+	{
+		if (super == type)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+static void RunObjectBenchmarks(BenchRunner& bench, SyntheticObjects& world, const std::vector<UObject*>& objects)
+{
+	const auto count = double(objects.size());
+
+	bench.RunOnce("index/ObjectIndex first refresh", [] { ObjectIndex::Get().Refresh(); });
+	bench.RunOnce("index/SdkBindings::ResolveAll", []
+	{
+		const auto result = SdkBindings::ResolveAll();
+		GSink += result.Verified;
+	});
+	bench.Run("index/ObjectIndex refresh, nothing changed", 1, [] { ObjectIndex::Get().Refresh(); });
+	bench.Run("index/ObjectIndex::Update, nothing changed", 1, [] { ObjectIndex::Get().Update(); },
+		"what queries do; sweeps part of the table every 100 ms");
+
+	const char* const types[] = { "Class Engine.Actor", "Class Engine.SequenceOp", "Class Engine.SeqAct_Log", "Class Core.Function" };
+	for (const auto typeName : types)
+	{
+		const auto type = world.FindClass(typeName);
+		const auto found = CountLinear(type);
+		const auto note = std::to_string(found) + " found";
+		bench.Run(std::string("scan/linear IsA loop, ") + (typeName + 6), 1, [=] { GSink += CountLinear(type); }, note);
+		bench.Run(std::string("scan/FindObjectsOfType, ") + (typeName + 6), 1, [=]
+		{
+			const auto result = FindObjectsOfType(type);
+			GSink += result.Count;
+		}, note);
+		TOwnedArray<UObject*> reused;
+		bench.Run(std::string("scan/FindObjectsOfType into a reused array, ") + (typeName + 6), 1, [&]
+		{
+			FindObjectsOfType(type, reused);
+			GSink += reused.Count;
+		}, note);
+		bench.Run(std::string("scan/FindObjectOfType, ") + (typeName + 6), 1, [=] { GSink += size_t(FindObjectOfType(type)); });
+	}
+
+	bench.Run("name/GetName into buffer", count, [&]
+	{
+		char buffer[256];
+		for (const auto object : objects)
+		{
+			GSink += object->GetName(buffer, sizeof(buffer));
+		}
+	});
+	bench.Run("name/GetFullName into buffer", count, [&]
+	{
+		char buffer[256];
+		for (const auto object : objects)
+		{
+			GSink += object->GetFullName(buffer, sizeof(buffer));
+		}
+	});
+	bench.Run("name/GetFullName, thread_local buffer", count, [&]
+	{
+		for (const auto object : objects)
+		{
+			GSink += size_t(object->GetFullName()[0]);
+		}
+	});
+	FullNameCache cache;
+	bench.Run("name/FullNameCache::Get, warm", count, [&]
+	{
+		for (const auto object : objects)
+		{
+			GSink += cache.Get(object).size();
+		}
+	});
+
+	// Pairs of an object's class and a class to test it against; about half of them match.
+	const auto& classes = world.GetClasses();
+	BenchRandom random(world.GetCounts().Instances);
+	std::vector<std::pair<UObject*, UClass*>> pairs(1 << 16);
+	for (auto& pair : pairs)
+	{
+		pair.first = objects[random.Below(uint32_t(objects.size()))];
+		UClass* type = classes[random.Below(uint32_t(classes.size()))];
+		if (random.Unit() < 0.5)
+		{
+			auto depth = 0;
+			for (UField* super = pair.first->Class; super; super = super->SuperField)
+			{
+				depth++;
+			}
+			auto super = pair.first->Class;
+			for (auto up = random.Below(uint32_t(depth)); up > 0; up--)
+			{
+				super = static_cast<UClass*>(super->SuperField);
+			}
+			type = super;
+		}
+		pair.second = type;
+	}
+	bench.Run("isa/UObject::IsA", double(pairs.size()), [&]
+	{
+		for (const auto& pair : pairs)
+		{
+			GSink += pair.first->IsA(pair.second);
+		}
+	});
+	bench.Run("isa/SuperField walk", double(pairs.size()), [&]
+	{
+		for (const auto& pair : pairs)
+		{
+			GSink += WalkIsA(pair.first->Class, pair.second);
+		}
+	});
+
+	// The case the displays are for: objects of the deepest classes tested against classes they don't derive from,
+	// e.g. an event handler checking every actor against the one type it cares about, where the walk has to go all
+	// the way to the root.
+	std::vector<UObject*> deepObjects;
+	for (const auto object : objects)
+	{
+		auto depth = 0;
+		for (UField* super = object->Class; super; super = super->SuperField)
+		{
+			depth++;
+		}
+		if (depth >= 7)
+		{
+			deepObjects.push_back(object);
+		}
+	}
+	std::vector<std::pair<UObject*, UClass*>> misses;
+	while (!deepObjects.empty() && misses.size() < pairs.size())
+	{
+		const auto object = deepObjects[random.Below(uint32_t(deepObjects.size()))];
+		const auto type = classes[random.Below(uint32_t(classes.size()))];
+		if (!WalkIsA(object->Class, type))
+		{
+			misses.emplace_back(object, type);
+		}
+	}
+	bench.Run("isa/UObject::IsA, deep classes, no match", double(misses.size()), [&]
+	{
+		for (const auto& pair : misses)
+		{
+			GSink += pair.first->IsA(pair.second);
+		}
+	});
+	bench.Run("isa/SuperField walk, deep classes, no match", double(misses.size()), [&]
+	{
+		for (const auto& pair : misses)
+		{
+			GSink += WalkIsA(pair.first->Class, pair.second);
+		}
+	});
+
+	// One type checked against the same objects over and over, like a tick handler filtering the actors it sees.
+	// They stay in cache, so this times the check itself. IsA<T> keeps the type's display per T.
+	const std::vector<UObject*> hot(deepObjects.begin(), deepObjects.begin() + (std::min)(deepObjects.size(), size_t(1024)));
+	bench.Run("isa/UObject::IsA, one type, cached objects", double(hot.size()), [&]
+	{
+		for (const auto object : hot)
+		{
+			GSink += object->IsA(UStruct::StaticClass());
+		}
+	});
+	bench.Run("isa/IsA<T>, one type, cached objects", double(hot.size()), [&]
+	{
+		for (const auto object : hot)
+		{
+			GSink += IsA<UStruct>(object);
+		}
+	});
+	bench.Run("isa/SuperField walk, one type, cached objects", double(hot.size()), [&]
+	{
+		for (const auto object : hot)
+		{
+			GSink += WalkIsA(object->Class, UStruct::StaticClass());
+		}
+	});
+
+	// Full names of random objects, and some that don't exist.
+	std::vector<std::string> paths;
+	for (auto i = 0; i < 1000; i++)
+	{
+		paths.push_back(objects[random.Below(uint32_t(objects.size()))]->GetFullName());
+		if (i % 10 == 0)
+		{
+			paths.back() += "_Missing";
+		}
+	}
+	size_t next = 0;
+	bench.Run("find/ObjectIndex::FindByPath", double(paths.size()), [&]
+	{
+		for (const auto& path : paths)
+		{
+			GSink += size_t(ObjectIndex::Get().FindByPath(path.c_str()));
+		}
+	});
+	bench.Run("find/linear GetFullName compare", 1, [&]
+	{
+		GSink += size_t(FindLinear(paths[next++ % paths.size()].c_str()));
+	});
+	bench.Run("find/StaticClass, bound", 1000, []
+	{
+		for (auto i = 0; i < 1000; i++)
+		{
+			GSink += size_t(UClass::StaticClass());
+		}
+	});
+}
+
+static void RunStringBenchmarks(BenchRunner& bench, const std::vector<UObject*>& objects)
+{
+	std::vector<std::string> names;
+	for (size_t i = 0; i < objects.size() && names.size() < 4096; i += objects.size() / 4096 + 1)
+	{
+		names.push_back(objects[i]->GetFullName());
+	}
+	const auto count = double(names.size());
+	char needle[] = "SeqAct";
+	bench.Run("string/isPartOf", count, [&]
+	{
+		for (auto& name : names)
+		{
+			GSink += isPartOf(&name[0], needle);
+		}
+	});
+	bench.Run("string/_stricmp", count, [&]
+	{
+		for (size_t i = 1; i < names.size(); i++)
+		{
+			GSink += _stricmp(names[i - 1].c_str(), names[i].c_str()) == 0;
+		}
+	});
+
+	std::vector<FName> fnames;
+	for (size_t i = 0; i < objects.size() && fnames.size() < 4096; i += objects.size() / 4096 + 1)
+	{
+		fnames.push_back(objects[i]->Name);
+	}
+	bench.Run("string/FName == const char*", double(fnames.size()), [&]
+	{
+		for (const auto& name : fnames)
+		{
+			GSink += name == "SeqAct_Log";
+		}
+	});
+	bench.Run("string/FName == FName", double(fnames.size()), [&]
+	{
+		const auto wanted = fnames[fnames.size() / 2];
+		for (const auto& name : fnames)
+		{
+			GSink += name == wanted;
+		}
+	});
+
+	bench.Run("string/string_format", count, [&]
+	{
+		for (const auto& name : names)
+		{
+			GSink += string_format("%s %d %s\n", name.c_str(), int(name.size()), "activated").size();
+		}
+	});
+	std::vector<std::wstring> wide;
+	for (const auto& name : names)
+	{
+		wide.push_back(std::wstring(name.begin(), name.end()));
+	}
+	bench.Run("string/ws2s", count, [&]
+	{
+		for (const auto& name : wide)
+		{
+			GSink += ws2s(name).size();
+		}
+	});
+
+	bench.Run("tarray/TArray Add 1024", 1024, []
+	{
+		TArray<int> values;
+		for (auto i = 0; i < 1024; i++)
+		{
+			values.Add(i);
+		}
+		GSink += values.Count;
+		values.Clear();
+	});
+	bench.Run("tarray/TOwnedArray Add 1024", 1024, []
+	{
+		TOwnedArray<int> values;
+		for (auto i = 0; i < 1024; i++)
+		{
+			values.Add(i);
+		}
+		GSink += values.Count;
+	});
+	TOwnedArray<int> reused;
+	bench.Run("tarray/TOwnedArray Add 1024, reused", 1024, [&]
+	{
+		reused.Empty();
+		for (auto i = 0; i < 1024; i++)
+		{
+			reused.Add(i);
+		}
+		GSink += reused.Count;
+	});
+	bench.Run("tarray/TOwnedArray AddUninitialized 1024, reused", 1024, [&]
+	{
+		reused.Empty();
+		const auto values = reused.AddUninitialized(1024);
+		for (auto i = 0; i < 1024; i++)
+		{
+			values[i] = i;
+		}
+		GSink += reused.Count;
+	});
+	std::vector<int> source(1024, 1);
+	bench.Run("tarray/TOwnedArray Append 1024, reused", 1024, [&]
+	{
+		reused.Empty();
+		reused.Append(source.data(), int(source.size()));
+		GSink += reused.Count;
+	});
+	std::vector<wchar_t> left(wide[0].begin(), wide[0].end());
+	std::vector<wchar_t> right = left;
+	left.push_back(0);
+	right.push_back(0);
+	bench.Run("fstring/operator==", 1000, [&]
+	{
+		const FString a(left.data());
+		const FString b(right.data());
+		for (auto i = 0; i < 1000; i++)
+		{
+			GSink += a == b;
+		}
+	});
+
+	// A send-message op's links, and links it doesn't handle, matched against its six link names.
+	static const wchar_t* const linkNames[] = { L"MessageName", L"String", L"Vector", L"Float", L"Int", L"Bool",
+		L"Target", L"Instigator", L"Output Object" };
+	std::vector<std::vector<wchar_t>> linkBuffers;
+	for (const auto name : linkNames)
+	{
+		linkBuffers.emplace_back(name, name + wcslen(name) + 1);
+	}
+	std::vector<FString> links;
+	for (auto& buffer : linkBuffers)
+	{
+		links.emplace_back(buffer.data());
+	}
+	bench.Run("fstring/LinkDesc if-else chain of operator==", double(links.size()), [&]
+	{
+		for (const auto& link : links)
+		{
+			GSink += link == L"MessageName" ? 1 : link == L"String" ? 2 : link == L"Vector" ? 3 :
+				link == L"Float" ? 4 : link == L"Int" ? 5 : link == L"Bool" ? 6 : 0;
+		}
+	});
+	static constexpr FStringSwitch<6> linkSwitch = { { L"MessageName", L"String", L"Vector", L"Float", L"Int", L"Bool" } };
+	bench.Run("fstring/LinkDesc FStringSwitch::Match", double(links.size()), [&]
+	{
+		for (const auto& link : links)
+		{
+			GSink += size_t(linkSwitch.Match(link) + 1);
+		}
+	});
+}
+
+// Kismet and function loggers write one line per event: a timestamp and the full names of the objects involved.
+// These time that line through the Direct backend's stdio path, with names built every time and from a cache.
+static void RunLoggerBenchmarks(BenchRunner& bench, const std::vector<UObject*>& objects)
+{
+	auto file = tmpfile();
+	if (!file)
+	{
+		fprintf(stderr, "Skipping logger benchmarks: no temporary file\n");
+		return;
+	}
+	const auto boottime = GetTickCount64();
+	const auto timestamp = [&]
+	{
+		const auto elapsed = GetTickCount64() - boottime;
+		return string_format("[%llu.%d] ", (unsigned long long)(elapsed / 1000), int(elapsed % 1000));
+	};
+	auto lines = 0;
+	const auto write = [&](const std::string& line)
+	{
+		fprintf(file, "%s", line.c_str());
+		if (++lines > 10)
+		{
+			fflush(file);
+			lines = 0;
+		}
+		if (ftell(file) > 64 * 1024 * 1024)
+		{
+			rewind(file);
+		}
+	};
+
+	const size_t batch = 4096;
+	size_t next = 0;
+	bench.Run("log/line, GetFullName + string_format", double(batch), [&]
+	{
+		for (size_t i = 0; i < batch; i++, next++)
+		{
+			const auto op = objects[next % objects.size()];
+			const auto outer = op->Outer ? op->Outer : op;
+			write(timestamp() + string_format("%s in %s\n", op->GetFullName(), outer->GetFullName()));
+		}
+	});
+	FullNameCache cache;
+	std::string line;
+	bench.Run("log/line, FullNameCache appends", double(batch), [&]
+	{
+		for (size_t i = 0; i < batch; i++, next++)
+		{
+			const auto op = objects[next % objects.size()];
+			const auto outer = op->Outer ? op->Outer : op;
+			line = timestamp();
+			cache.Append(op, line);
+			line += " in ";
+			cache.Append(outer, line);
+			line += '\n';
+			write(line);
+		}
+	});
+	fclose(file);
+}
+
+// The old HookedPE pattern: build the called function's full name, then compare it against each watched name in turn.
+static int ClassifyByName(UFunction* function, const std::vector<std::string>& watched)
+{
+	const auto name = function->GetFullName();
+	for (size_t i = 0; i < watched.size(); i++)
+	{
+		// Plugins used both; half the names go through each.
+		if (i % 2 ? isPartOf(name, const_cast<char*>(watched[i].c_str())) : !strcmp(name, watched[i].c_str()))
+		{
+			return int(i);
+		}
+	}
+	return FunctionDispatchTable::NotWatched;
+}
+
+// Every ProcessEvent hook classifies every call the game makes. These replay a synthetic call stream, a few thousand
+// functions called with Zipf-distributed frequency, against a hook watching eight of them, and time classifying each
+// call by full name against FunctionDispatchTable.
+static void RunDispatchBenchmarks(BenchRunner& bench, SyntheticObjects& world, const std::vector<UObject*>& objects,
+	const uint64_t seed)
+{
+	const auto functionClass = world.FindClass("Class Core.Function");
+	std::vector<UFunction*> functions;
+	for (const auto object : objects)
+	{
+		if (object->Class == functionClass)
+		{
+			functions.push_back(static_cast<UFunction*>(object));
+		}
+	}
+	if (functions.empty())
+	{
+		return;
+	}
+	BenchRandom random(seed);
+	for (size_t i = functions.size() - 1; i > 0; i--)
+	{
+		std::swap(functions[i], functions[random.Below(uint32_t(i + 1))]);
+	}
+	functions.resize(std::min(functions.size(), size_t(3000)));
+
+	std::vector<double> weights;
+	auto total = 0.0;
+	for (size_t rank = 0; rank < functions.size(); rank++)
+	{
+		total += 1.0 / pow(double(rank + 1), 1.1);
+		weights.push_back(total);
+	}
+	std::vector<UFunction*> calls(1 << 16);
+	for (auto& call : calls)
+	{
+		const auto at = std::lower_bound(weights.begin(), weights.end(), random.Unit() * total) - weights.begin();
+		call = functions[std::min(size_t(at), functions.size() - 1)];
+	}
+
+	// Watched functions from hot to never called, like a tick, an input handler and events that rarely fire.
+	const size_t ranks[] = { 0, 5, 40, 300, 1500, 2999, 2998, 2997 };
+	std::vector<std::string> watched;
+	FunctionDispatchTable table;
+	for (const auto rank : ranks)
+	{
+		watched.push_back(functions[std::min(rank, functions.size() - 1)]->GetFullName());
+		table.Register(watched.back().c_str());
+	}
+	const auto callCount = double(calls.size());
+	bench.Run("dispatch/GetFullName + strcmp/isPartOf chain", callCount, [&]
+	{
+		for (const auto call : calls)
+		{
+			GSink += size_t(ClassifyByName(call, watched) + 1);
+		}
+	}, std::to_string(functions.size()) + " functions, 8 watched");
+	bench.Run("dispatch/FunctionDispatchTable::Lookup, warm", callCount, [&]
+	{
+		for (const auto call : calls)
+		{
+			GSink += size_t(table.Lookup(call) + 1);
+		}
+	});
+	// A new table classifies each function by name the first time it's called.
+	bench.Run("dispatch/FunctionDispatchTable::Lookup, first call", double(functions.size()), [&]
+	{
+		FunctionDispatchTable cold;
+		for (const auto& name : watched)
+		{
+			cold.Register(name.c_str());
+		}
+		for (const auto function : functions)
+		{
+			GSink += size_t(cold.Lookup(function) + 1);
+		}
+	}, "includes sizing the cache");
+}
+
+// What the hub's callbacks and the mock ProcessEvent did, in order: P for a Pre, O for the original, Q for a Post,
+// each followed by the subscriber's priority.
+static std::string hubEvents;
+static bool hubVeto = false;
+
+static void __thiscall MockProcessEvent(UObject*, UFunction*, void*, void*)
+{
+	hubEvents += "O ";
+}
+
+template <int Priority>
+static bool HubPre(UObject*, UFunction*, void*, void*)
+{
+	hubEvents += "P" + std::to_string(Priority) + ' ';
+	return !(Priority == 20 && hubVeto);
+}
+
+template <int Priority>
+static void HubPost(UObject*, UFunction*, void*, void*)
+{
+	hubEvents += "Q" + std::to_string(Priority) + ' ';
+}
+
+/// <summary>
+/// Checks ProcessEventHub::Dispatch against a mock ProcessEvent: Pre callbacks run in priority order, a Pre that
+/// returns false skips the original and the Pres after it, and Posts run after the original in reverse order.
+/// Returns false and says what went wrong if it doesn't. Then times Dispatch with and without subscribers.
+/// </summary>
+static bool RunHubBenchmarks(BenchRunner& bench, const std::vector<UObject*>& objects)
+{
+	UFunction* watched = nullptr;
+	UFunction* unwatched = nullptr;
+	for (const auto object : objects)
+	{
+		if (!strcmp(object->Class->Name.GetName(), "Function"))
+		{
+			(watched ? unwatched : watched) = static_cast<UFunction*>(object);
+			if (unwatched)
+			{
+				break;
+			}
+		}
+	}
+	if (!unwatched)
+	{
+		return true;
+	}
+	const auto object = objects[objects.size() / 2];
+	const std::string watchedName = watched->GetFullName();
+	const std::string className = object->Class->Name.GetName();
+
+	ProcessEventHub hub;
+	hub.Original = MockProcessEvent;
+	const auto subscribe = [&](const char* function, const tProcessEventPre pre, const tProcessEventPost post,
+		const char* classNameFilter, const int priority)
+	{
+		ProcessEventSubscription subscription = { function, nullptr, classNameFilter, pre, post, priority };
+		hub.Subscribe(subscription);
+	};
+	subscribe(watchedName.c_str(), HubPre<10>, HubPost<10>, nullptr, 10);
+	subscribe(watchedName.c_str(), HubPre<20>, HubPost<20>, className.c_str(), 20);
+	subscribe(watchedName.c_str(), HubPre<-5>, HubPost<-5>, nullptr, -5);
+	subscribe(nullptr, HubPre<0>, HubPost<0>, nullptr, 0);
+	subscribe(watchedName.c_str(), HubPre<30>, HubPost<30>, "NoSuchClass", 30);
+
+	struct Case
+	{
+		const char* What;
+		UFunction* Function;
+		bool Veto;
+		const char* Expected;
+	};
+	const Case cases[] =
+	{
+		{ "watched function", watched, false, "P-5 P0 P10 P20 O Q20 Q10 Q0 Q-5 " },
+		{ "watched function, vetoed", watched, true, "P-5 P0 P10 P20 Q20 Q10 Q0 Q-5 " },
+		{ "wildcard only", unwatched, false, "P0 O Q0 " },
+	};
+	auto passed = true;
+	for (const auto& check : cases)
+	{
+		hubEvents.clear();
+		hubVeto = check.Veto;
+		hub.Dispatch(object, check.Function, nullptr, nullptr);
+		if (hubEvents != check.Expected)
+		{
+			fprintf(stderr, "ProcessEventHub::Dispatch, %s: expected \"%s\", got \"%s\"\n", check.What, check.Expected,
+				hubEvents.c_str());
+			passed = false;
+		}
+	}
+	hubVeto = false;
+
+	bench.Run("hub/Dispatch, wildcard subscriber", 1000, [&]
+	{
+		for (auto i = 0; i < 1000; i++)
+		{
+			hubEvents.clear();
+			hub.Dispatch(object, unwatched, nullptr, nullptr);
+		}
+	}, "callbacks append to a string");
+	bench.Run("hub/Dispatch, five subscribers", 1000, [&]
+	{
+		for (auto i = 0; i < 1000; i++)
+		{
+			hubEvents.clear();
+			hub.Dispatch(object, watched, nullptr, nullptr);
+		}
+	}, "callbacks append to a string");
+	return passed;
+}
+
+static void PrintWorld(const SyntheticObjects& world, const BenchSettings& settings)
+{
+	const auto& counts = world.GetCounts();
+	const auto table = UObject::GObjObjects();
+	fprintf(settings.Csv ? stderr : stdout,
+		"Synthetic GObjObjects: %d slots, seed %llu\n"
+		"  %d classes, %d functions, %d packages, %d default objects, %d instances, %d empty, %d bindings moved\n"
+		"  Classes by depth:",
+		table->Count, (unsigned long long)settings.World.Seed, counts.Classes, counts.Functions, counts.Packages,
+		counts.Defaults, counts.Instances, counts.Empty, counts.MovedBindings);
+	for (const auto classes : world.DepthHistogram())
+	{
+		fprintf(settings.Csv ? stderr : stdout, " %d", classes);
+	}
+	fprintf(settings.Csv ? stderr : stdout, "\n\n");
+}
+
+static int Usage()
+{
+	printf("Usage: SdkBench [options]\n"
+		"  --objects <n>    GObjObjects size, default 300000\n"
+		"  --seed <n>       Generator seed, default 1\n"
+		"  --moved <0-1>    Share of SDK bindings away from their generated index, default 0.05\n"
+		"  --filter <text>  Only benchmarks whose name contains text\n"
+		"  --min-time <ms>  Minimum time per sample, default 200\n"
+		"  --repeat <n>     Samples per benchmark; the median is reported. Default 5\n"
+		"  --csv            Print results as CSV\n");
+	return 1;
+}
+
+// The interop's spatial Kismet actions ask for actors near a point. These place a big hub map's worth of actors in
+// rooms spread over a level and time each query through SpatialGrid against the scan over every actor it replaces.
+static void RunSpatialBenchmarks(BenchRunner& bench, const std::vector<UObject*>& objects, const uint64_t seed)
+{
+	typedef SpatialGrid<UObject*>::Entry Entry;
+	const auto actorCount = std::min(objects.size(), size_t(8000));
+	BenchRandom random(seed);
+	std::vector<Entry> actors;
+	for (size_t i = 0; i < actorCount; i++)
+	{
+		// Rooms of about 2000 units, 64 of them over an 80000 unit square, on a few floors.
+		const auto room = random.Below(64);
+		const auto roomX = float(room % 8) * 10000.0f - 40000.0f;
+		const auto roomY = float(room / 8) * 10000.0f - 40000.0f;
+		Entry entry;
+		entry.Item = objects[i];
+		entry.Tag = int(i);
+		entry.X = roomX + float(random.Unit() * 2000.0);
+		entry.Y = roomY + float(random.Unit() * 2000.0);
+		entry.Z = float(random.Below(4)) * 400.0f + float(random.Unit() * 200.0);
+		actors.push_back(entry);
+	}
+	SpatialGrid<UObject*> grid;
+	bench.RunOnce("spatial/SpatialGrid build, " + std::to_string(actorCount) + " actors", [&]
+	{
+		for (const auto& actor : actors)
+		{
+			grid.Add(actor.Item, actor.Tag, actor.X, actor.Y, actor.Z);
+		}
+	});
+
+	// Query points near actors, as a player or another actor would be.
+	std::vector<Entry> points;
+	for (auto i = 0; i < 256; i++)
+	{
+		auto point = actors[random.Below(uint32_t(actors.size()))];
+		point.X += float(random.Unit() * 400.0 - 200.0);
+		point.Y += float(random.Unit() * 400.0 - 200.0);
+		points.push_back(point);
+	}
+	const auto radius = 1500.0f;
+	bench.Run("spatial/radius 1500, scan every actor", double(points.size()), [&]
+	{
+		for (const auto& point : points)
+		{
+			for (const auto& actor : actors)
+			{
+				const auto dx = actor.X - point.X;
+				const auto dy = actor.Y - point.Y;
+				const auto dz = actor.Z - point.Z;
+				GSink += dx * dx + dy * dy + dz * dz <= radius * radius ? 1 : 0;
+			}
+		}
+	});
+	bench.Run("spatial/radius 1500, SpatialGrid::ForEachInRadius", double(points.size()), [&]
+	{
+		for (const auto& point : points)
+		{
+			grid.ForEachInRadius(point.X, point.Y, point.Z, radius, [&](const Entry&, float) { GSink++; });
+		}
+	});
+	bench.Run("spatial/box 3000x3000x800, scan every actor", double(points.size()), [&]
+	{
+		for (const auto& point : points)
+		{
+			for (const auto& actor : actors)
+			{
+				GSink += fabsf(actor.X - point.X) <= 1500.0f && fabsf(actor.Y - point.Y) <= 1500.0f &&
+					fabsf(actor.Z - point.Z) <= 400.0f ? 1 : 0;
+			}
+		}
+	});
+	bench.Run("spatial/box 3000x3000x800, SpatialGrid::ForEachInBox", double(points.size()), [&]
+	{
+		for (const auto& point : points)
+		{
+			grid.ForEachInBox(point.X - 1500.0f, point.Y - 1500.0f, point.Z - 400.0f, point.X + 1500.0f, point.Y + 1500.0f,
+				point.Z + 400.0f, [&](const Entry&) { GSink++; });
+		}
+	});
+
+	// One actor in 50 is of the class asked for.
+	const auto wanted = [](const Entry& actor) { return actor.Tag % 50 == 0; };
+	bench.Run("spatial/nearest of a class, scan every actor", double(points.size()), [&]
+	{
+		for (const auto& point : points)
+		{
+			const Entry* best = nullptr;
+			auto bestDistanceSquared = 1e38f;
+			for (const auto& actor : actors)
+			{
+				const auto dx = actor.X - point.X;
+				const auto dy = actor.Y - point.Y;
+				const auto dz = actor.Z - point.Z;
+				const auto distanceSquared = dx * dx + dy * dy + dz * dz;
+				if (distanceSquared <= bestDistanceSquared && wanted(actor))
+				{
+					best = &actor;
+					bestDistanceSquared = distanceSquared;
+				}
+			}
+			GSink += best ? size_t(best->Tag) : 0;
+		}
+	});
+	bench.Run("spatial/nearest of a class, SpatialGrid::FindNearest", double(points.size()), [&]
+	{
+		for (const auto& point : points)
+		{
+			const auto best = grid.FindNearest(point.X, point.Y, point.Z, 1e38f, wanted);
+			GSink += best ? size_t(best->Tag) : 0;
+		}
+	});
+
+	// The interop re-reads a budget of actor locations every tick. A quarter of them have moved a little.
+	bench.Run("spatial/SpatialGrid::Refresh, 256 actors", 256, [&]
+	{
+		grid.Refresh(256, [&](const Entry& entry, float& x, float& y, float& z)
+		{
+			const auto& actor = actors[entry.Tag];
+			const auto moved = (entry.Tag & 3) == 0 ? float(random.Unit() * 100.0) : 0.0f;
+			x = actor.X + moved;
+			y = actor.Y;
+			z = actor.Z;
+			return true;
+		});
+	});
+}
+
+int main(int argc, char** argv)
+{
+	BenchSettings settings;
+	for (auto i = 1; i < argc; i++)
+	{
+		const std::string arg = argv[i];
+		const auto hasValue = i + 1 < argc;
+		if (arg == "--objects" && hasValue)
+		{
+			settings.World.Objects = atoi(argv[++i]);
+		}
+		else if (arg == "--seed" && hasValue)
+		{
+			settings.World.Seed = strtoull(argv[++i], nullptr, 10);
+		}
+		else if (arg == "--moved" && hasValue)
+		{
+			settings.World.Moved = atof(argv[++i]);
+		}
+		else if (arg == "--filter" && hasValue)
+		{
+			settings.Filter = argv[++i];
+		}
+		else if (arg == "--min-time" && hasValue)
+		{
+			settings.MinTimeMs = std::max(1, atoi(argv[++i]));
+		}
+		else if (arg == "--repeat" && hasValue)
+		{
+			settings.Repeat = std::max(1, atoi(argv[++i]));
+		}
+		else if (arg == "--csv")
+		{
+			settings.Csv = true;
+		}
+		else
+		{
+			return Usage();
+		}
+	}
+
+	SyntheticObjects world(settings.World);
+	world.Install();
+	PrintWorld(world, settings);
+	const auto objects = LiveObjects();
+
+	BenchRunner bench(settings);
+	RunObjectBenchmarks(bench, world, objects);
+	RunStringBenchmarks(bench, objects);
+	RunDispatchBenchmarks(bench, world, objects, settings.World.Seed);
+	const auto hubPassed = RunHubBenchmarks(bench, objects);
+	RunLoggerBenchmarks(bench, objects);
+	RunSpatialBenchmarks(bench, objects, settings.World.Seed);
+
+	// Last, since it changes the table.
+	bench.Run("index/ObjectIndex refresh after 1000 slots churned", 1, [&]
+	{
+		world.Churn(1000);
+		ObjectIndex::Get().Refresh();
+	}, "includes making the churn");
+	// Grow once first, so neither row below pays for the table and the index moving to bigger storage.
+	world.Grow(1);
+	ObjectIndex::Get().Refresh();
+	bench.RunOnce("index/ObjectIndex::Update after 1000 objects appended", [&]
+	{
+		world.Grow(1000);
+		ObjectIndex::Get().Update();
+	}, "includes making the objects");
+	bench.RunOnce("index/ObjectIndex refresh after 1000 objects appended", [&]
+	{
+		world.Grow(1000);
+		ObjectIndex::Get().Refresh();
+	}, "includes making the objects");
+	return hubPassed ? 0 : 1;
+}
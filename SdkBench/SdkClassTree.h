@@ -0,0 +1,415 @@
+// Generated from the class declarations in ME3SDK\SDK_HEADERS: for each SDK binding slot (see
+// SdkBindingTable.h), the binding slot of the class it derives from, or -1 for Core.Object and for functions.
+
+#pragma once
+
+const short GSdkClassParentSlots[ SDK_BINDING_COUNT ] = 
+{
+	1, -1, 3, 1, 1, 1, 1, 1, 9, 1, 9, 1, 13, 14, 1, 13, 17, 14, 17, 17,
+	21, 17, 21, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 14, 14, 36, 1, 1, 39, 1,
+	39, 42, 1, 1, 13, 44, 3, 46, 1, 48, 49, 49, 51, 52, 51, 51, 51, 51, 51, 58,
+	58, 58, 51, 51, 51, 51, 48, 48, 67, 48, 48, 48, 48, 72, 72, 72, 75, 72, 77, 72,
+	72, 72, 72, 72, 83, 48, 85, 48, 48, 88, 48, 48, 48, 92, 93, 92, 95, 92, 92, 92,
+	99, 92, 92, 92, 92, 92, 105, 92, 92, 92, 92, 110, 110, 92, 92, 48, 48, 48, 48, 118,
+	118, 118, 121, 122, 48, 124, 124, 48, 48, 39, 129, 129, 129, 132, 132, 132, 132, 132, 132, 132,
+	132, 132, 132, 132, 143, 143, 132, 132, 147, 132, 132, 129, 129, 152, 152, 152, 152, 152, 129, 158,
+	1, 160, 160, 160, 163, 160, 165, 165, 160, 160, 160, 160, 160, 172, 172, 160, 160, 160, 160, 160,
+	160, 160, 160, 160, 160, 160, 160, 160, 1, 1, 1, 1, 1, 1, 1, 194, 194, 194, 194, 48,
+	199, 1, 1, 1, 1, 204, 204, 1, 11, 1, 209, 1, 40, 212, 40, 40, 40, 38, 217, 38,
+	38, 38, 1, 222, 1, 11, 1, 1, 1, 1, 229, 1, 1, 1, 1, 234, 234, 1, 1, 11,
+	1, 1, 1, 1, 243, 243, 245, 245, 1, 248, 248, 248, 248, 1, 1, 1, 1, 1, 257, 258,
+	1, 1, 1, 1, 3, 264, 1, 1, 1, 268, 1, 1, 271, 271, 1, 4, 275, 1, 277, 277,
+	279, 279, 1, 1, 1, 284, 284, 284, 284, 288, 289, 290, 284, 284, 1, 294, 295, 1, 297, 297,
+	297, 300, 300, 300, 300, 300, 300, 300, 297, 297, 297, 1, 1, 1, 1, 42, 1, 316, 316, 1,
+	319, 1, 1, 1, 1, 42, 1, 1, 242, 327, 1, 258, 258, 257, 333, 334, 334, 1, 1, 1,
+	339, 51, 51, 199, 48, 48, 88, 48, 48, 132, 148, 132, 132, 132, 11, 354, 11, 1, 1, 358,
+	358, 358, 358, 358, 358, 1, 365, 365, 365, 365, 1, 370, 370, 370, 370, 370, 370, 370, 1, 378,
+	378, 48, 381, 381, 381, 384, 1, 386, 386, 386, 386, 386, 1, 392, 393, 1, 395, 395, 395, 395,
+	395, 395, 395, 402, 395, 395, 1, 406, 407, 408, 408, 408, 411, 411, 411, 411, 408, 408, 417, 417,
+	417, 417, 417, 417, 408, 408, 408, 426, 408, 408, 408, 407, 431, 432, 406, 434, 434, 434, 437, 437,
+	437, 406, 441, 441, 441, 444, 441, 441, 447, 447, 441, 441, 1, 1, 453, 1, 1, 1, 1, 48,
+	459, 459, 48, 132, 160, 259, 72, 466, 466, 466, 466, 129, 471, 471, 471, 471, 160, 476, 476, 48,
+	48, 480, 480, 48, 48, 147, 485, 485, 487, 148, 489, 489, 148, 148, 132, 1, 495, 495, 495, 1,
+	1, 1, 1, 502, 502, 1, 505, 505, 505, 1, 509, 509, 241, 241, 241, 241, 241, 516, 516, 516,
+	516, 516, 516, 516, 516, 241, 525, 241, 241, 241, 241, 530, 530, 530, 530, 530, 530, 241, 1, 538,
+	538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 552, 552, 552, 552, 538, 538, 538,
+	538, 538, 538, 1, 1, 564, 564, 1, 1, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260,
+	260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260,
+	260, 600, 260, 260, 260, 260, 260, 260, 607, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260,
+	260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 630, 631, 630, 630, 630, 260, 260, 260, 260,
+	260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 651, 651, 651, 654, 651, 651, 657, 658,
+	658, 660, 658, 657, 657, 657, 260, 260, 260, 260, 260, 260, 260, 260, 258, 674, 675, 674, 69, 69,
+	48, 132, 213, 218, 1, 684, 1, 1, 687, 688, 688, 687, 691, 691, 691, 687, 695, 695, 695, 695,
+	687, 700, 687, 702, 702, 702, 702, 687, 707, 707, 709, 709, 687, 712, 712, 687, 715, 687, 717, 717,
+	717, 717, 717, 722, 722, 717, 687, 726, 726, 687, 729, 687, 731, 687, 733, 687, 687, 736, 736, 736,
+	687, 740, 740, 740, 740, 687, 745, 745, 745, 745, 745, 687, 751, 751, 687, 754, 687, 756, 757, 756,
+	756, 687, 761, 761, 761, 687, 765, 765, 765, 765, 769, 765, 765, 765, 765, 687, 775, 775, 775, 775,
+	775, 775, 775, 687, 783, 783, 783, 1, 1, 1, 67, 790, 790, 48, 48, 794, 795, 117, 117, 117,
+	117, 132, 132, 129, 129, 129, 805, 806, 1, 1, 1, 1, 1, 1, 1, 1, 1, 816, 816, 816,
+	816, 816, 816, 816, 39, 51, 51, 48, 827, 828, 827, 827, 827, 827, 833, 833, 827, 836, 827, 838,
+	827, 840, 117, 117, 1, 844, 844, 844, 48, 1, 1, 850, 851, 850, 853, 854, 854, 854, 853, 858,
+	858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 878,
+	879, 878, 878, 878, 878, 878, 878, 886, 886, 878, 878, 878, 878, 878, 878, 878, 858, 858, 858, 858,
+	858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 912, 912, 912, 912, 912, 912, 912,
+	912, 912, 912, 912, 912, 912, 912, 912, 912, 912, 912, 858, 858, 932, 858, 858, 858, 858, 858, 853,
+	939, 939, 939, 939, 939, 939, 939, 939, 939, 939, 939, 939, 939, 939, 939, 954, 954, 939, 853, 958,
+	958, 958, 958, 958, 958, 958, 958, 958, 958, 958, 958, 958, 958, 958, 958, 958, 958, 958, 850, 978,
+	979, 978, 978, 978, 978, 984, 978, 986, 978, 978, 989, 978, 991, 991, 991, 991, 991, 978, 978, 88,
+	999, 999, 1001, 1001, 213, 1, 1005, 1006, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005,
+	1019, 1005, 72, 132, 334, 1, 1, 1, 1027, 39, 1029, 11, 1027, 1027, 1033, 1033, 1035, 1033, 1033, 1027,
+	1027, 1027, 1027, 1042, 1042, 1027, 1027, 1046, 1047, 1027, 1028, 1029, 1029, 1052, 1052, 1050, 1029, 1056, 1056, 1058,
+	11, 1060, 11, 11, 1027, 1064, 1046, 1046, 1067, 1067, 1067, 1067, 1067, 1067, 1073, 1067, 1046, 1046, 1047, 1047,
+	1047, 1047, 1047, 1082, 1047, 1084, 1084, 1047, 1047, 1047, 1047, 1047, 1091, 1091, 1091, 1047, 1095, 1095, 1047, 1098,
+	1098, 1048, 1046, 1046, 1103, 1104, 1104, 1106, 1106, 1108, 1104, 1104, 1111, 1104, 1104, 1103, 1115, 1115, 1103, 1118,
+	1046, 1041, 1050, 1122, 1123, 1050, 1122, 1126, 1050, 1128, 1128, 1050, 1050, 1055, 1050, 1050, 1028, 1042, 1042, 1042,
+	1045, 1027, 1141, 1141, 1141, 1027, 1027, 11, 11, 11, 854, 1150, 858, 958, 1153, 1153, 1153, 1, 51, 125,
+	132, 148, 185, 48, 48, 1164, 132, 132, 48, 132, 160, 294, 1, 48, 132, 1, 334, 333, 333, 333,
+	333, 333, 1181, 1182, 1181, 3, 1, 1, 200, 794, 794, 51, 48, 1192, 1193, 1193, 1192, 1196, 1196, 1196,
+	1192, 1200, 1192, 1202, 1202, 1202, 1192, 129, 1207, 1208, 1207, 1210, 1210, 1212, 1207, 1207, 129, 1216, 1217, 139,
+	143, 1, 147, 1, 1, 48, 1225, 132, 51, 125, 1, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230,
+	1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1, 72, 1250, 1250, 1250, 48, 48, 1255, 1, 1, 1,
+	1259, 1, 1, 51, 48, 1210, 1217, 291, 1, 343, 1, 1, 858, 1, 222, 72, 1275, 1, 1277, 1277,
+	1277, 1, 1281, 1281, 274, 1, 1, 1286, 1286, 279, 264, 1, 1, 1, 1, 237, 1033, 1, 1, 1,
+	858, 858, 858, 858, 858, 858, 858, 958, 1294, 1, 160, 395, 538, 538, 241, 1314, 516, 858, 858, 858,
+	878, 858, 878, 858, 858, 858, 858, 88, 129, 1328, 1185, 1, 11, 1, 51, 339, 1335, 339, 1, 1,
+	1339, 1339, 48, 129, 51, 1344, 1344, 72, 202, 232, 1, 1, 1, 1, 1, 51, 1, 1, 1, 1,
+	48, 858, 1, 1223, 48, 1, 174, 1366, 48, 1, 1, 51, 298, 1372, 1372, 1372, 1372, 1372, 1372, 1372,
+	1372, 1372, 1381, 1381, 209, 1384, 1251, 1, 92, 48, 48, 47, 1, 1392, 1392, 1392, 1392, 1392, 1397, 1,
+	77, 1, 200, 1, 1403, 1404, 1, 1, 87, 1, 1, 1410, 319, 319, 319, 320, 319, 319, 319, 319,
+	1419, 1419, 319, 319, 319, 1, 1, 105, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1434, 1434, 92, 92, 105,
+	105, 105, 1, 1, 132, 48, 1, 48, 1447, 1447, 1, 107, 1451, 1452, 1451, 68, 48, 48, 1252, 269,
+	48, 312, 1, 1, 1, 1174, 319, 1466, 1467, 1467, 1469, 1466, 858, 878, 858, 878, 48, 1, 48, 1,
+	1, 1480, 408, 1, 1, 410, 417, 408, 1487, 1488, 1488, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1498,
+	1498, 1487, 1487, 1487, 1487, 1487, 1487, 417, 408, 411, 417, 417, 411, 417, 417, 417, 417, 417, 417, 417,
+	413, 1, 1521, 1, 1523, 1523, 1523, 408, 417, 417, 417, 417, 417, 417, 417, 417, 407, 417, 408, 417,
+	408, 417, 423, 431, 431, 431, 395, 395, 447, 446, 1549, 417, 408, 1552, 395, 1, 381, 381, 444, 447,
+	442, 444, 381, 385, 48, 51, 1, 1, 65, 84, 1, 1, 1571, 1571, 1571, 1571, 1, 1, 1297, 1578,
+	1579, 1, 1581, 1582, 1582, 1579, 1299, 1586, 1, 1296, 1578, 1590, 1591, 1578, 1578, 1578, 1578, 1578, 1578, 1578,
+	1578, 1578, 1578, 1602, 1602, 1579, 1579, 1579, 1607, 1579, 1609, 1579, 1579, 1612, 1579, 1614, 1579, 1616, 1579, 1618,
+	1580, 1579, 1579, 1622, 1622, 1579, 1579, 1579, 1579, 1628, 1579, 1630, 1579, 1, 1299, 1299, 1635, 1635, 1635, 1635,
+	1299, 1640, 1640, 1, 1, 1644, 1644, 1, 1, 1, 1, 1, 1650, 1652, 1653, 1653, 1259, 1254, 1269, 1658,
+	201, 1036, 1, 1, 1663, 1663, 1663, 1663, 1663, 1663, 1663, 1663, 1663, 1663, 1663, 1663, 1663, 1663, 1663, 378,
+	378, 48, 378, 370, 370, 370, 370, 370, 370, 1, 1, 1, 1, 48, 1, 1694, 1694, 1696, 1696, 1698,
+	1698, 1698, 1698, 1698, 1698, 1694, 1694, 1, 1, 1, 1, 68, 116, 1712, 1713, 116, 48, 86, 1, 1,
+	1719, 1, 1, 1, 1, 1, 71, 1, 1, 1034, 1, 1, 1731, 1731, 1731, 1731, 1735, 1735, 1735, 1735,
+	1731, 1731, 1, 550, 527, 538, 516, 512, 1747, 1747, 1747, 1747, 1747, 1747, 1747, 1747, 1755, 1755, 1755, 1755,
+	1755, 1755, 1755, 1747, 1763, 1763, 1763, 1763, 1763, 1763, 1763, 1763, 1771, 1771, 1763, 1763, 1763, 1776, 1776, 1776,
+	1747, 539, 1781, 1781, 1781, 1781, 1781, 1781, 1781, 1788, 1788, 1788, 1788, 1788, 1788, 1788, 1781, 1781, 1781, 527,
+	550, 568, 568, 568, 568, 1, 1, 858, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 1, 319,
+	1, 1, 1821, 1821, 1821, 1821, 1821, 1821, 1, 1828, 1, 1, 1831, 687, 1833, 1833, 1833, 701, 717, 722,
+	784, 794, 1190, 1, 1223, 790, 1845, 792, 793, 1, 1, 1, 1, 1, 1, 1, 1855, 1, 1, 1,
+	463, 848, 858, 858, 858, 858, 858, 878, 858, 858, 894, 858, 858, 858, 858, 1874, 1874, 1874, 858, 858,
+	858, 858, 858, 858, 878, 1884, 1884, 858, 878, 936, 958, 958, 958, 958, 958, 958, 958, 878, 1897, 1897,
+	1897, 1900, 1897, 1897, 1897, 1904, 991, 991, 982, 984, 986, 986, 858, 858, 858, 858, 858, 878, 878, 878,
+	858, 878, 858, 858, 878, 878, 878, 878, 858, 858, 912, 878, 878, 878, 878, 878, 958, 958, 958, 976,
+	991, 982, 986, 1, 1, 1944, 1944, 1944, 268, 1, 48, 1950, 92, 132, 1, 1, 1, 796, 796, 805,
+	48, 92, 132, 48, 1311, 395, 48, 1966, 129, 1, 1969, 1969, 1969, 1969, 1, 1, 1975, 1975, 1975, 1975,
+	1975, 1975, 1975, 1975, 1975, 1975, 1975, 1975, 1975, 1975, 1, 1990, 1990, 1990, 1990, 1990, 1990, 1990, 1990, 1990,
+	1990, 1990, 1990, 1990, 1990, 1198, 1, 128, 129, 809, 858, 858, 858, 529, 560, 1, 2015, 2015, 2015, 2015,
+	2015, 2015, 2021, 2015, 1, 11, 2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025, 2025,
+	2025, 2025, 1, 1944, 1944, 1944, 1944, 1944, 1944, 1944, 1, 1, 1, 274, 1944, 1944, 1944, 1944, 1944, 1944,
+	1944, 1944, 1944, 1, 1944, 2064, 2065, 2064, 2064, 2064, 2069, 2069, 2069, 2064, 2064, 2064, 2064, 1944, 1944, 1944,
+	317, 318, 1, 2082, 2082, 2084, 2084, 2084, 2084, 2084, 2082, 2082, 2082, 2082, 2082, 2082, 2082, 2082, 2082, 2082,
+	2082, 2082, 279, 264, 1944, -1, -1, -1, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 958, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 858, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 858, -1, -1, -1, -1, 936, -1, 858, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, 72, 200, -1, 69, 793, 184, 184, 958, 858, 858, 858, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 1250, 2247, 71, 210, 936, 858, 858, 858, 858, 858, -1, 402, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, 284, 72, 51, 71, 1036, -1, -1, 72, 858, 209, 209, 209, 58,
+	67, 65, 858, -1, -1, -1, -1, -1, -1, -1, -1, 2247, -1, -1, -1, 480, 958, 1136, 2457, 72,
+	68, 858, 858, 51, 11, 11, -1, -1, 1115, 1115, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	105, 958, 48, 858, 797, 797, 797, 797, 797, 858, 858, 858, 858, 912, 858, 912, 858, -1, -1, -1,
+	-1, 958, 958, 978, 978, 978, 11, 1119, 858, 385, 128, 128, 92, 128, 1152, 1153, 1115, 1132, 1115, 58,
+	72, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1,
+	-1, -1, -1, -1, 1276, 2557, -1, -1, -1, -1, -1, 2557, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1276, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, 160, 48, 160, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, 51, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, 273, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1717, 958, -1, 1706, 4338, 4339, 1841,
+	1488, -1, -1, 408, 1488, 402, 65, 4338, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1659, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, 1950, 4381, 1653, 1653, -1, 1404, 1653, 319, 1718, -1, -1, -1, 1, 1415, -1, -1, 1843, 85, 1,
+	-1, 1402, -1, 11, 4347, 1, -1, -1, -1, 1270, 105, 1478, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, 1384, 1384, 4333, -1, 1416, 1401, 319, -1, -1, -1, 1356, 4333, -1, 4394, -1, -1, -1, -1, -1,
+	1458, -1, 1657, 4444, 4371, -1, 1401, -1, -1, 1351, 4333, 4333, 4333, 4333, 319, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, 1, 1578, -1, -1, 1, 1660, 858, -1, -1, 1, 2412, 1781, 1401, -1, 4480,
+	1650, 319, 4409, 1694, 1694, 1694, 1694, 4482, 1694, 4482, 4488, 4488, 4482, 1, 1, 48, 1, 1, -1, -1,
+	1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403,
+	1403, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 1, 48, 1, 1,
+	1, 160, 1401, 4336, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4422, 1384, 809, 4679, 1,
+	1694, 858, -1, -1, 958, 958, 65, 1401, 1694, 4434, 958, 4675, 4675, 4675, 4422, 4422, 4422, 958, 878, 878,
+	-1, 1694, -1, -1, 1384, 4706, 1694, 4706, 4706, 4679, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, 4409, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1694, -1, -1, -1, 4409, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4409, -1, -1, -1, 4798, 4409, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4409, -1, -1, -1,
+	-1, -1, -1, 4798, -1, -1, 4798, -1, -1, -1, -1, -1, -1, 4409, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 858, -1, -1, -1, 4798,
+	4409, 4798, 4798, 4798, 858, 4798, 4798, 4409, 4867, 4409, 4798, 4798, 1401, 4409, 4409, 4833, 4409, -1, 1705, 4880,
+	1696, 4880, 1252, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858,
+	858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 1, 858, 858, 858, 1650,
+	858, 858, 1897, 858, 858, 858, 939, 939, 958, 958, 1579, -1, 1633, 1579, 1579, 1579, 4937, 1576, 4936, 1576,
+	-1, 4942, 4347, 1955, 4347, 4347, 4347, 4347, 4347, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	4930, 1607, 1611, 4933, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, 1606, 1579, 1579, 1, 1623, 1624, 1, 5011, 5011, 4382, 48, 92, 92, 128, 160,
+	65, 538, 530, 1, 1, 241, 538, 160, 48, 1961, 842, -1, 1, 160, 92, 180, 1848, 4371, 4409, 4371,
+	4798, 4371, 4798, 4371, 4798, 4798, 4798, 4482, 4869, 4798, 4409, 4409, 4798, 4409, 4409, 1694, 4410, 4410, 4482, 4409,
+	1579, 1, 1469, 1456, 52, 1650, 4480, 1650, -1, -1, 5067, 1650, 5067, 5067, 5067, 5067, 5075, 5067, 5067, 5067,
+	5067, 5067, 5067, 5067, 5067, 4919, 5067, 5067, 5067, 1650, 878, 5067, 5067, 5067, 5067, 5067, 5067, 4706, 5067, -1,
+	5098, 5098, 1650, 5067, 5098, 1650, 5067, 5067, 5067, 4480, 1, 1, 4480, 4480, 5112, -1, -1, -1, -1, -1,
+	-1, -1, -1, 4663, 4878, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4680, 1694, 5135, 5136, 5135, 5138,
+	-1, -1, -1, -1, -1, -1, 4706, 1694, 4706, 4706, 4706, 4706, 4706, 4878, 1694, -1, -1, -1, -1, -1,
+	1694, 1694, 5055, 4706, 4706, 5097, -1, -1, 1401, -1, -1, -1, -1, -1, -1, -1, -1, 4675, 5097, 1694,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4706, 4706, 5055, 1705, 1705, 1694, 5197, 4680,
+	5196, 4706, 1, 5202, 4694, 4694, 4704, 4422, 4675, 4675, 5208, 461, 958, 66, 66, -1, 69, 848, 1253, 79,
+	4942, 4942, 4942, 4942, 4942, 958, 958, 1571, 1571, 1571, 1401, 1401, 1401, 1401, 1401, 1401, 1401, 1401, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 337, 5111, 1401, 1401, 1401, 1401, 4872, 4687, 958,
+	1295, 278, 1, 1, 48, 1578, -1, -1, -1, -1, 1408, 1578, 1602, 1582, 1579, 5274, -1, -1, -1, -1,
+	-1, -1, -1, -1, 1600, 1578, 1578, 1571, 1578, 1586, 5289, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, 4336, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1575, 1633, 1419,
+	1638, 1420, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	4679, -1, -1, -1, 4679, -1, -1, -1, 4679, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 1763, 1469, 1456, 5219,
+	92, 5540, 105, 5540, 105, 5015, 1, -1, 4663, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1714, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 337, -1, -1, -1, -1, -1, -1, -1, -1, 858, 858, 1897, 858, 1897, 858, 858,
+	1913, 858, 858, 878, 858, 878, 858, 858, 858, 858, 858, 858, 858, 878, 858, 858, 858, 858, 858, 858,
+	858, 1897, 1897, 858, 858, 858, 858, 858, 858, 1897, 1897, 1897, 858, 858, 858, 858, 878, 939, 939, 958,
+	958, 958, 958, 958, 958, 958, 958, 5060, 1625, 1626, 1631, 1627, 1630, 1632, 4930, 1625, 1614, 1618, 1580, 1627,
+	4398, -1, -1, -1, -1, -1, -1, -1, 48, 51, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 1716, 1456, 1372, 48, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 1469, 1456, 1456, 1470, 5788, -1, -1, -1, -1, -1, -1, 5262, -1, 1,
+	48, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 5894, -1, -1, -1, -1, 5574, 5848, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1714, 5894, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5996, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	958, -1, 958, -1, -1, -1, -1, -1, 958, -1, 958, -1, -1, 1455, 4336, 4336, 6076, 6076, -1, -1,
+	-1, -1, 4336, -1, -1, -1, -1, -1, -1, 4339, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4336,
+	-1, -1, -1, -1, 4339, 4336, 4336, -1, -1, -1, -1, -1, 6116, -1, -1, -1, 4336, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 1586, -1, -1, 1401, -1, -1, 5251, 5252, -1, -1, 5251, 5252, -1, 4662,
+	5251, 5252, -1, -1, -1, -1, 1401, -1, 4662, -1, -1, 5230, -1, -1, -1, -1, 1401, 4662, -1, -1,
+	-1, -1, 1401, -1, -1, -1, -1, -1, 1401, -1, 5258, 1401, -1, -1, 6089, 4336, -1, -1, -1, -1,
+	-1, -1, -1, 1401, 1401, -1, -1, 1401, 6069, 1401, 6069, 1401, 1401, -1, -1, 6089, 5325, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, 1401, 4675, 4676, 4676, 4691, 4675, 4675, 4693, 4693, 5209, 4675,
+	4675, 4676, 4675, 4450, 4423, 6104, -1, -1, -1, -1, -1, -1, -1, 4798, 4371, 4798, 4339, -1, -1, 4371,
+	5799, -1, -1, -1, -1, -1, -1, -1, -1, 4943, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5799, 5799, 6120, 5799, 6177, 5799, 5799, 4470,
+	-1, 4440, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5535, 1950, 1950, -1, -1,
+	4401, 4347, -1, -1, -1, -1, -1, -1, 5264, -1, -1, -1, -1, -1, -1, 5535, 48, -1, -1, -1,
+	-1, -1, -1, -1, 5202, -1, 1, 6091, 6227, 1387, -1, -1, 1386, -1, 5766, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 6215, -1, -1, -1,
+	6215, -1, -1, -1, 6216, -1, -1, -1, -1, -1, -1, -1, 6215, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, 6215, 6215, -1, -1, -1, -1, -1, -1, -1, 4655, 1401, -1, -1, 1400, -1,
+	4399, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 6336, 1578, 1578, 1580, 1620,
+	6336, 6336, 1726, 6298, -1, -1, -1, -1, -1, 1386, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 72, -1, -1, 5766, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, 6336, 6336, 6336, 6336, 6336, 6336, 6336, 6336, 4336, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4411, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 6393, 6393, 6393, 6393, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, 4449, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 2247, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	4423, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, 1713, -1, -1, -1, -1, -1, -1, 5251, 5252, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 6195, 6195, 6195, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 6215, 7393, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, 6215, 7405, 1578, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 1, 7423, 6195, 6195, 6195, 6195, 858, 6343, 4466, 1578, 6385, 6388, 6390, 6340, 6120, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, 4397, 4706, 5179, 4706, 5160, 5160, 5160, 5160, 5160, 1694, 7496, 1700, 1697,
+	7501, 1694, 5146, 5146, 5146, 5146, 1702, 1703, 5164, 5164, 5164, 5164, 5178, 4878, 5178, 7516, 7517, 5178, 7517, 7520,
+	7521, 5178, 7521, 5178, 7523, 7524, 5178, 7526, 7527, 4680, 4680, 4680, 4680, 4680, 4680, 4680, 4680, 4680, 4680, 4680,
+	4680, 7542, 4706, 7542, 4680, -1, -1, 5165, 5177, -1, 958, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, 7513, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4680, 1401, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4680,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	4680, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 7548, 4675, 7704, 4676, 4691, 7707, 4675, 7709, 4675, 7711, 4675, 7713, 7713, 7713, 5237, 1401, 1401,
+	4662, 5252, 5251, 5237, 5237, -1, -1, -1, -1, 5237, -1, -1, -1, -1, -1, -1, -1, 4336, 5258, -1,
+	-1, -1, -1, -1, -1, 4336, 1401, 1401, -1, -1, 1401, 4336, -1, 1714, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 5251, 5252, 5252, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5894, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4336, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5740, 4450, 4451, 7487, 4706, 4706,
+	7660, 4336, 7837, 7737, 7817, 7751, 7847, 4663, 7849, 7850, 5123, -1, -1, -1, -1, -1, 6216, -1, -1, -1,
+	6216, 6295, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 7861, -1, -1, 7861,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, 6216, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 6201, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, 4693, 4676, 1401, 4446, 1401, 1586, -1, -1, -1, -1, -1, -1, 4336, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 4336, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5251,
+	5252, 5740, 4432, 5067, 7837, 7966, 4336, 7946, 7934, 7970, 7847, 7850, 7973, 5164, 7973, 7973, 7973, 5165, 5178, 7978,
+	7979, 5178, 7981, 7982, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5177, 4675, 1401, -1,
+	-1, 6201, 8021, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, 1712, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, 1384, 4676, 1713, -1, -1, -1, -1, -1, -1, 1713, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, 5252, 4676, 8066, 1713, -1, -1, -1, 8067, -1, -1, -1, -1,
+	-1, -1, -1, 8074, -1, -1, -1, -1, -1, -1, -1, 4432, -1, -1, -1, -1, -1, -1, -1, 6069,
+	6069, 6069, 6069, 6069, 6069, 6069, 1401, 4389, 4389, 4389, -1, -1, 4389, 4389
+};
@@ -0,0 +1,450 @@
+#pragma once
+
+// Builds a stand-in for the game's GObjObjects table so the SDK's Core layer can be measured without the game.
+// Every class and function the SDK binds is created with its real name, package and place in the class tree (see
+// SdkClassTree.h), at the index the SDK was generated against. The rest of the table is filled the way a loaded
+// level fills it: packages, class default objects and instances whose classes follow a Zipf distribution, a few
+// levels of outers, shared names told apart by instance number, and some empty slots.
+// Everything is derived from the seed, so a given seed and size always produce the same table.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../ME3SDK/Packages/Core.h"
+#include "SdkClassTree.h"
+
+/// <summary>
+/// SplitMix64. Used instead of the standard distributions, whose output differs between standard libraries.
+/// </summary>
+struct BenchRandom
+{
+	uint64_t State;
+
+	explicit BenchRandom(const uint64_t seed) : State(seed) {}
+
+	uint64_t Next()
+	{
+		auto z = (State += 0x9E3779B97F4A7C15ULL);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		return z ^ (z >> 31);
+	}
+
+	// Uniform in [0, bound).
+	uint32_t Below(const uint32_t bound)
+	{
+		return uint32_t(((Next() >> 32) * bound) >> 32);
+	}
+
+	// Uniform in [0, 1).
+	double Unit()
+	{
+		return double(Next() >> 11) * (1.0 / 9007199254740992.0);
+	}
+};
+
+struct SyntheticOptions
+{
+	int Objects = 300000;
+	uint64_t Seed = 1;
+	// Share of SDK bindings moved away from their generated index, as DLC and mods do in the game.
+	double Moved = 0.05;
+	// Share of slots left empty, as after garbage collection.
+	double Empty = 0.02;
+	// Zipf exponent for how instances are spread over classes.
+	double ClassSkew = 1.1;
+};
+
+class SyntheticObjects
+{
+public:
+	// The highest GObjObjects index in SdkBindingTable.h, plus one. Smaller tables spread the bindings out
+	// proportionally, so they are all found by name instead of at their index.
+	static constexpr int GeneratedTableSize = 140466;
+
+	struct Counts
+	{
+		int Packages = 0;
+		int Classes = 0;
+		int Functions = 0;
+		int Defaults = 0;
+		int Instances = 0;
+		int Empty = 0;
+		int MovedBindings = 0;
+	};
+
+	explicit SyntheticObjects(const SyntheticOptions& options) : Options(options), Random(options.Seed)
+	{
+		Build();
+	}
+
+	~SyntheticObjects()
+	{
+		if (PortableObjectTable() == &Table)
+		{
+			PortableObjectTable() = nullptr;
+		}
+		for (const auto block : Allocations)
+		{
+			free(block);
+		}
+	}
+
+	SyntheticObjects(const SyntheticObjects&) = delete;
+	SyntheticObjects& operator=(const SyntheticObjects&) = delete;
+
+	/// <summary>
+	/// Makes this table the one UObject::GObjObjects() returns.
+	/// </summary>
+	void Install()
+	{
+		PortableObjectTable() = &Table;
+	}
+
+	const Counts& GetCounts() const
+	{
+		return Stats;
+	}
+
+	/// <summary>
+	/// Every class object, in binding slot order.
+	/// </summary>
+	const std::vector<UClass*>& GetClasses() const
+	{
+		return Classes;
+	}
+
+	/// <summary>
+	/// The class with the given binding full name, e.g. "Class Engine.SequenceOp", or nullptr.
+	/// </summary>
+	UClass* FindClass(const char* fullName) const
+	{
+		const auto found = BindingsByName.find(fullName);
+		return found != BindingsByName.end() ? static_cast<UClass*>(found->second) : nullptr;
+	}
+
+	/// <summary>
+	/// Number of classes at each depth below Core.Object.
+	/// </summary>
+	std::vector<int> DepthHistogram() const
+	{
+		std::vector<int> histogram;
+		for (const auto cls : Classes)
+		{
+			auto depth = 0;
+			for (auto super = cls->SuperField; super; super = super->SuperField)
+			{
+				depth++;
+			}
+			if (depth >= int(histogram.size()))
+			{
+				histogram.resize(depth + 1);
+			}
+			histogram[depth]++;
+		}
+		return histogram;
+	}
+
+	/// <summary>
+	/// Replaces count random instances with new ones, or empties their slot, like level streaming does.
+	/// Replaced objects stay allocated so pointers cached by the code under test stay readable.
+	/// </summary>
+	void Churn(const int count)
+	{
+		for (auto i = 0; i < count && !InstanceSlots.empty(); i++)
+		{
+			const auto slot = InstanceSlots[Random.Below(uint32_t(InstanceSlots.size()))];
+			if (Random.Unit() < 0.5)
+			{
+				Slots[slot] = nullptr;
+			}
+			else
+			{
+				Slots[slot] = MakeInstance(slot);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Appends count new instances to the end of the table, like loading a level does once the free slots are used up.
+	/// </summary>
+	void Grow(const int count)
+	{
+		for (auto i = 0; i < count; i++)
+		{
+			const auto slot = int(Slots.size());
+			Slots.push_back(nullptr);
+			MakeInstance(slot);
+			InstanceSlots.push_back(slot);
+			Stats.Instances++;
+		}
+		Table.Data = Slots.data();
+		Table.Count = Table.Max = int(Slots.size());
+	}
+
+private:
+	SyntheticOptions Options;
+	BenchRandom Random;
+	Counts Stats;
+	std::vector<UObject*> Slots;
+	TArray<UObject*> Table;
+	std::vector<void*> Allocations;
+	std::unordered_map<std::string, FNameEntry*> Names;
+	std::unordered_map<std::string, UObject*> BindingsByName;
+	std::unordered_map<std::string, UObject*> PackagesByName;
+	std::vector<UClass*> Classes;
+	// Classes instances are drawn from, most popular first, with their cumulative Zipf weights.
+	std::vector<UClass*> InstanceClasses;
+	std::vector<double> InstanceWeights;
+	std::unordered_map<UClass*, UINT32> InstanceNumbers;
+	std::vector<UObject*> Levels;
+	std::vector<UObject*> RecentInstances;
+	std::vector<int> InstanceSlots;
+	UClass* ClassClass = nullptr;
+	UClass* FunctionClass = nullptr;
+	UClass* PackageClass = nullptr;
+
+	FNameEntry* Intern(const std::string& name)
+	{
+		auto& entry = Names[name];
+		if (!entry)
+		{
+			// FNameEntry declares 16 characters, but like the game's, the name runs on past the struct.
+			const auto block = static_cast<char*>(calloc(1, sizeof(FNameEntry) + name.size() + 1));
+			memcpy(block + offsetof(FNameEntry, Name), name.c_str(), name.size() + 1);
+			Allocations.push_back(block);
+			entry = reinterpret_cast<FNameEntry*>(block);
+		}
+		return entry;
+	}
+
+	// Objects are raw zeroed memory, as the SDK only ever reads them: nothing here calls a virtual function.
+	template<typename T>
+	T* Allocate(const size_t extra = 0)
+	{
+		const auto block = calloc(1, sizeof(T) + extra);
+		Allocations.push_back(block);
+		return static_cast<T*>(block);
+	}
+
+	void Place(UObject* object, const int slot, UClass* cls, UObject* outer, const std::string& name, const UINT32 number = 0)
+	{
+		object->ObjectInternalInteger = slot;
+		object->Class = cls;
+		object->Outer = outer;
+		object->Name.NameEntry = Intern(name);
+		object->Name.NameIndex = number;
+		Slots[slot] = object;
+	}
+
+	template<typename TTakeSlot>
+	UObject* Package(const std::string& name, TTakeSlot takeSlot)
+	{
+		auto& package = PackagesByName[name];
+		if (!package)
+		{
+			package = Allocate<UPackage>();
+			// Its class is filled in once Core.Package exists; see Build.
+			Place(package, takeSlot(), nullptr, nullptr, name);
+			Stats.Packages++;
+		}
+		return package;
+	}
+
+	UObject* MakeInstance(const int slot)
+	{
+		const auto pick = std::upper_bound(InstanceWeights.begin(), InstanceWeights.end(), Random.Unit() * InstanceWeights.back());
+		const auto cls = InstanceClasses[std::min(size_t(pick - InstanceWeights.begin()), InstanceClasses.size() - 1)];
+		// Subobjects of other instances, e.g. a sequence's ops, make up part of every level.
+		UObject* outer;
+		if (!RecentInstances.empty() && Random.Unit() < 0.3)
+		{
+			outer = RecentInstances[Random.Below(uint32_t(RecentInstances.size()))];
+		}
+		else
+		{
+			outer = Levels[Random.Below(uint32_t(Levels.size()))];
+		}
+		const auto object = Allocate<UObject>(64);
+		Place(object, slot, cls, outer, cls->Name.GetName(), ++InstanceNumbers[cls]);
+		if (outer->Class == PackageClass)
+		{
+			if (RecentInstances.size() < 4096)
+			{
+				RecentInstances.push_back(object);
+			}
+			else
+			{
+				RecentInstances[Random.Below(4096)] = object;
+			}
+		}
+		return object;
+	}
+
+	void Build()
+	{
+		const auto size = std::max(Options.Objects, SDK_BINDING_COUNT * 2);
+		Slots.assign(size, nullptr);
+
+		// Bindings first, each at its generated index or, for the moved share, wherever there's room.
+		std::vector<bool> taken(size, false);
+		std::vector<int> bindingSlots(SDK_BINDING_COUNT);
+		for (auto i = 0; i < SDK_BINDING_COUNT; i++)
+		{
+			auto slot = int(int64_t(GSdkBindingTable[i].Index) * std::min(size, GeneratedTableSize) / GeneratedTableSize);
+			if (Random.Unit() < Options.Moved || size < GeneratedTableSize)
+			{
+				if (size >= GeneratedTableSize)
+				{
+					Stats.MovedBindings++;
+				}
+				slot = int(Random.Below(uint32_t(size)));
+			}
+			while (taken[slot])
+			{
+				slot = (slot + 1) % size;
+			}
+			taken[slot] = true;
+			bindingSlots[i] = slot;
+		}
+		if (size < GeneratedTableSize)
+		{
+			Stats.MovedBindings = SDK_BINDING_COUNT;
+		}
+
+		// The remaining slots, in a random order, for everything else.
+		std::vector<int> free;
+		for (auto slot = 0; slot < size; slot++)
+		{
+			if (!taken[slot])
+			{
+				free.push_back(slot);
+			}
+		}
+		for (auto i = free.size(); i > 1; i--)
+		{
+			std::swap(free[i - 1], free[Random.Below(uint32_t(i))]);
+		}
+		size_t nextFree = 0;
+		const auto takeFree = [&]() { return free[nextFree++]; };
+
+		// Classes, with their SuperField from the SDK's own class tree.
+		Classes.assign(SDK_BINDING_COUNT, nullptr);
+		for (auto i = 0; i < SDK_BINDING_COUNT; i++)
+		{
+			const std::string fullName = GSdkBindingTable[i].FullName;
+			if (fullName.compare(0, 6, "Class ") != 0)
+			{
+				continue;
+			}
+			const auto dot = fullName.find('.');
+			const auto cls = Allocate<UClass>();
+			Place(cls, bindingSlots[i], nullptr, Package(fullName.substr(6, dot - 6), takeFree), fullName.substr(dot + 1));
+			Classes[i] = cls;
+			BindingsByName[fullName] = cls;
+		}
+		for (auto i = 0; i < SDK_BINDING_COUNT; i++)
+		{
+			if (Classes[i] && GSdkClassParentSlots[i] >= 0)
+			{
+				Classes[i]->SuperField = Classes[GSdkClassParentSlots[i]];
+			}
+		}
+		Classes.erase(std::remove(Classes.begin(), Classes.end(), nullptr), Classes.end());
+		Stats.Classes = int(Classes.size());
+		ClassClass = FindClass("Class Core.Class");
+		FunctionClass = FindClass("Class Core.Function");
+		PackageClass = FindClass("Class Core.Package");
+		for (const auto cls : Classes)
+		{
+			cls->Class = ClassClass;
+		}
+		for (const auto& package : PackagesByName)
+		{
+			package.second->Class = PackageClass;
+		}
+
+		// Functions, inside their class.
+		for (auto i = 0; i < SDK_BINDING_COUNT; i++)
+		{
+			const std::string fullName = GSdkBindingTable[i].FullName;
+			if (fullName.compare(0, 9, "Function ") != 0)
+			{
+				continue;
+			}
+			const auto lastDot = fullName.rfind('.');
+			const auto owner = BindingsByName.find("Class " + fullName.substr(9, lastDot - 9));
+			UObject* outer = owner != BindingsByName.end() ? owner->second : nullptr;
+			const auto function = Allocate<UFunction>();
+			Place(function, bindingSlots[i], FunctionClass, outer, fullName.substr(lastDot + 1));
+			BindingsByName[fullName] = function;
+			Stats.Functions++;
+		}
+
+		// A default object per class.
+		for (const auto cls : Classes)
+		{
+			const auto defaults = Allocate<UObject>(64);
+			Place(defaults, takeFree(), cls, cls->Outer, std::string("Default__") + cls->Name.GetName());
+			Stats.Defaults++;
+		}
+
+		// Level packages, then instances of everything but the classes that describe code.
+		static const char* const prefixes[] = { "BioA", "BioD", "BioP", "BioS", "BioH", "SFXGame_Mp", "BioSnd" };
+		static const char* const areas[] = { "Nor", "Cit", "Mars", "Ear", "Pro", "Kro", "Tuc", "Gth", "Cat", "End", "Cer", "Lev" };
+		const auto levels = std::max(8, size / 2000);
+		for (auto i = 0; i < levels; i++)
+		{
+			const auto name = std::string(prefixes[Random.Below(7)]) + "_" + areas[Random.Below(12)] + std::to_string(100 + i);
+			const auto level = Package(name, takeFree);
+			level->Class = PackageClass;
+			Levels.push_back(level);
+		}
+
+		const auto fieldClass = FindClass("Class Core.Field");
+		for (const auto cls : Classes)
+		{
+			auto isField = false;
+			for (UField* super = cls; super; super = super->SuperField)
+			{
+				isField |= super == fieldClass;
+			}
+			if (cls != PackageClass && !isField)
+			{
+				InstanceClasses.push_back(cls);
+			}
+		}
+		for (auto i = InstanceClasses.size(); i > 1; i--)
+		{
+			std::swap(InstanceClasses[i - 1], InstanceClasses[Random.Below(uint32_t(i))]);
+		}
+		auto total = 0.0;
+		for (size_t rank = 0; rank < InstanceClasses.size(); rank++)
+		{
+			total += 1.0 / pow(double(rank + 1), Options.ClassSkew);
+			InstanceWeights.push_back(total);
+		}
+
+		while (nextFree < free.size())
+		{
+			const auto slot = takeFree();
+			if (Random.Unit() < Options.Empty)
+			{
+				Stats.Empty++;
+				continue;
+			}
+			MakeInstance(slot);
+			InstanceSlots.push_back(slot);
+			Stats.Instances++;
+		}
+
+		Table.Data = Slots.data();
+		Table.Count = Table.Max = int(Slots.size());
+	}
+};
@@ -0,0 +1,252 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
+#include "../ME3SDK/Packages/Core.h"
+
+/// <summary>
+/// What to do with a message passed to LogCoalescer::Submit.
+/// </summary>
+struct LogDecision
+{
+	enum EVerdict
+	{
+		/// <summary>Write and show the message. Suppressed says how many from this op were rate limited since the last one written.</summary>
+		Emit,
+		/// <summary>The op repeated its last message; don't write it. Count is the length of the run, first one included.</summary>
+		Repeat,
+		/// <summary>The op is over its budget; drop the message.</summary>
+		Limited
+	};
+
+	EVerdict Verdict;
+	int Count;
+	int Suppressed;
+	/// <summary>
+	/// Repeats of the op's last written message that the disk log hasn't been told about, or 0. Set when the run ends
+	/// and, while it lasts, at most once per flush interval.
+	/// </summary>
+	int FlushRepeats;
+};
+
+/// <summary>
+/// Sits between Kismet ops and the logs so one op firing every tick can't flood them. Identical consecutive messages
+/// from an op are counted instead of written, and each op gets a token bucket: it may write burst messages at once and
+/// rate per second after that. Keeps per-op counts so the noisiest sequences can be found.
+/// Ops are tracked by address, so an op that hasn't logged for IdleMilliseconds, or whose address now holds a different
+/// op, is forgotten; its counts are kept, by full name, for the report.
+/// </summary>
+class LogCoalescer
+{
+public:
+	struct OpStats
+	{
+		std::string Name;
+		// What the op at this address was when it was named, to tell it from a later op at the same address.
+		FName ObjectName;
+		UObject* Outer;
+		std::wstring LastMessage;
+		unsigned long long FirstSeen;
+		unsigned long long LastSeen;
+		unsigned long long LastRefill;
+		unsigned long long LastFlush;
+		double Tokens;
+		int Run;
+		int UnflushedRepeats;
+		int LimitedSinceWrite;
+		unsigned Written;
+		unsigned Coalesced;
+		unsigned RateLimited;
+
+		unsigned Suppressed() const
+		{
+			return Coalesced + RateLimited;
+		}
+	};
+
+	// Ops that haven't logged for this long are forgotten.
+	static const unsigned long long IdleMilliseconds = 60000;
+
+	/// <param name="rate">Messages per second an op may write once its burst is spent.</param>
+	/// <param name="burst">Messages an op may write back to back.</param>
+	/// <param name="flushMilliseconds">How often a run of repeats still going is reported to the disk log.</param>
+	LogCoalescer(const double rate = 10.0, const double burst = 20.0, const unsigned long long flushMilliseconds = 1000)
+		: Rate(rate), Burst(burst), FlushMilliseconds(flushMilliseconds) {}
+
+	/// <summary>
+	/// Decides what happens to a message op logged at now, a GetTickCount64 time.
+	/// </summary>
+	LogDecision Submit(UObject* op, const std::wstring& message, const unsigned long long now)
+	{
+		return Submit(op, message.c_str(), int(message.length()), now);
+	}
+
+	LogDecision Submit(UObject* op, const wchar_t* message, const int length, const unsigned long long now)
+	{
+		if (now - LastPrune >= IdleMilliseconds)
+		{
+			Prune(now);
+		}
+		auto& stats = GetStats(op, now);
+		stats.LastSeen = now;
+		LogDecision decision = { LogDecision::Emit, 1, 0, 0 };
+		if (stats.Run > 0 && size_t(length) == stats.LastMessage.length() &&
+			wmemcmp(message, stats.LastMessage.c_str(), size_t(length)) == 0)
+		{
+			stats.Run++;
+			stats.Coalesced++;
+			stats.UnflushedRepeats++;
+			decision.Verdict = LogDecision::Repeat;
+			decision.Count = stats.Run;
+			if (now - stats.LastFlush >= FlushMilliseconds)
+			{
+				decision.FlushRepeats = stats.UnflushedRepeats;
+				stats.UnflushedRepeats = 0;
+				stats.LastFlush = now;
+			}
+			return decision;
+		}
+
+		// A different message ends the run, whether or not it's written.
+		decision.FlushRepeats = stats.UnflushedRepeats;
+		stats.UnflushedRepeats = 0;
+		stats.Tokens = (std::min)(Burst, stats.Tokens + (now - stats.LastRefill) * Rate / 1000.0);
+		stats.LastRefill = now;
+		if (stats.Tokens < 1.0)
+		{
+			stats.RateLimited++;
+			stats.LimitedSinceWrite++;
+			stats.Run = 0;
+			decision.Verdict = LogDecision::Limited;
+			return decision;
+		}
+		stats.Tokens -= 1.0;
+		stats.Written++;
+		stats.LastMessage.assign(message, size_t(length));
+		stats.Run = 1;
+		stats.LastFlush = now;
+		decision.Suppressed = stats.LimitedSinceWrite;
+		stats.LimitedSinceWrite = 0;
+		return decision;
+	}
+
+	/// <summary>
+	/// Up to count ops, the ones with the most suppressed messages first, with the counts of every op that has had
+	/// the same full name added together. Ops that never had one are left out.
+	/// </summary>
+	std::vector<OpStats> GetNoisiest(const size_t count) const
+	{
+		auto byName = Retired;
+		for (const auto& entry : Ops)
+		{
+			AddCounts(byName, entry.second);
+		}
+		std::vector<OpStats> noisiest;
+		for (const auto& entry : byName)
+		{
+			if (entry.second.Suppressed() > 0)
+			{
+				noisiest.push_back(entry.second);
+			}
+		}
+		const auto kept = (std::min)(count, noisiest.size());
+		std::partial_sort(noisiest.begin(), noisiest.begin() + kept, noisiest.end(), [](const OpStats& a, const OpStats& b)
+		{
+			return a.Suppressed() > b.Suppressed();
+		});
+		noisiest.resize(kept);
+		return noisiest;
+	}
+
+	/// <summary>
+	/// Calls func(const OpStats&) for every op being tracked now.
+	/// </summary>
+	template <class TFunc>
+	void ForEachOp(TFunc func) const
+	{
+		for (const auto& entry : Ops)
+		{
+			func(entry.second);
+		}
+	}
+
+private:
+	OpStats& GetStats(UObject* op, const unsigned long long now)
+	{
+		auto found = Ops.find(op);
+		if (found != Ops.end())
+		{
+			const auto& known = found->second;
+			if (known.ObjectName.NameEntry == op->Name.NameEntry && known.ObjectName.NameIndex == op->Name.NameIndex &&
+				known.Outer == op->Outer)
+			{
+				return found->second;
+			}
+			// A different op at the same address, e.g. after a map load.
+			Retire(known);
+		}
+		auto& stats = Ops[op];
+		// Named once, here: the op may be gone by the time the stats are read.
+		stats.Name = op->GetFullName();
+		stats.ObjectName = op->Name;
+		stats.Outer = op->Outer;
+		stats.FirstSeen = stats.LastSeen = stats.LastRefill = stats.LastFlush = now;
+		stats.Tokens = Burst;
+		stats.Run = stats.UnflushedRepeats = stats.LimitedSinceWrite = 0;
+		stats.Written = stats.Coalesced = stats.RateLimited = 0;
+		return stats;
+	}
+
+	void Prune(const unsigned long long now)
+	{
+		for (auto it = Ops.begin(); it != Ops.end();)
+		{
+			if (now - it->second.LastSeen >= IdleMilliseconds)
+			{
+				Retire(it->second);
+				it = Ops.erase(it);
+				continue;
+			}
+			++it;
+		}
+		LastPrune = now;
+	}
+
+	/// <summary>
+	/// Keeps a forgotten op's counts for the report. Ops nothing was suppressed from aren't reported, so they're
+	/// not kept.
+	/// </summary>
+	void Retire(const OpStats& stats)
+	{
+		if (stats.Suppressed() > 0)
+		{
+			AddCounts(Retired, stats);
+		}
+	}
+
+	static void AddCounts(std::unordered_map<std::string, OpStats>& byName, const OpStats& stats)
+	{
+		const auto found = byName.find(stats.Name);
+		if (found == byName.end())
+		{
+			byName.emplace(stats.Name, stats);
+			return;
+		}
+		auto& total = found->second;
+		total.FirstSeen = (std::min)(total.FirstSeen, stats.FirstSeen);
+		total.LastSeen = (std::max)(total.LastSeen, stats.LastSeen);
+		total.Written += stats.Written;
+		total.Coalesced += stats.Coalesced;
+		total.RateLimited += stats.RateLimited;
+	}
+
+	double Rate;
+	double Burst;
+	unsigned long long FlushMilliseconds;
+	unsigned long long LastPrune = 0;
+	std::unordered_map<UObject*, OpStats> Ops;
+	// Counts of forgotten ops, by full name.
+	std::unordered_map<std::string, OpStats> Retired;
+};
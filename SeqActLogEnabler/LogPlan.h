@@ -0,0 +1,268 @@
+#pragma once
+
+#include <stdio.h>
+#include <unordered_map>
+#include <vector>
+#include "../ME3SDK/Packages/Engine.h"
+
+/// <summary>
+/// A fixed wide buffer a log line is formatted into, reused for every line. Appends past the end are cut off.
+/// </summary>
+class LogLineBuffer
+{
+public:
+	static const int Capacity = 2048;
+
+	LogLineBuffer() : Length(0)
+	{
+		Data[0] = 0;
+	}
+
+	const wchar_t* GetData() const
+	{
+		return Data;
+	}
+
+	int Len() const
+	{
+		return Length;
+	}
+
+	void Reset()
+	{
+		Truncate(0);
+	}
+
+	/// <summary>
+	/// Cuts the line to its first length characters.
+	/// </summary>
+	void Truncate(const int length)
+	{
+		if (length >= 0 && length < Length)
+		{
+			Length = length;
+			Data[Length] = 0;
+		}
+	}
+
+	void Append(const wchar_t* text, const int count)
+	{
+		const auto copied = count < Capacity - 1 - Length ? count : Capacity - 1 - Length;
+		if (copied > 0)
+		{
+			wmemcpy(Data + Length, text, size_t(copied));
+			Length += copied;
+			Data[Length] = 0;
+		}
+	}
+
+	void Append(const wchar_t character)
+	{
+		Append(&character, 1);
+	}
+
+	/// <summary>
+	/// Appends ASCII text such as an FName, widening each character.
+	/// </summary>
+	void Append(const char* text)
+	{
+		while (*text && Length < Capacity - 1)
+		{
+			Data[Length++] = wchar_t(static_cast<unsigned char>(*text++));
+		}
+		Data[Length] = 0;
+	}
+
+	/// <summary>
+	/// Appends the characters of an FString up to its terminator.
+	/// </summary>
+	void Append(const FString& text)
+	{
+		auto count = 0;
+		while (count < text.Count && text.Data[count] != 0)
+		{
+			count++;
+		}
+		Append(text.Data, count);
+	}
+
+	void Append(const int value)
+	{
+		AppendFormatted(L"%d", value);
+	}
+
+	/// <summary>
+	/// Appends a float the way a wstringstream does by default, with six significant digits.
+	/// </summary>
+	void Append(const float value)
+	{
+		AppendFormatted(L"%g", double(value));
+	}
+
+private:
+	template <class T>
+	void AppendFormatted(const wchar_t* format, const T value)
+	{
+		const auto written = swprintf(Data + Length, size_t(Capacity - Length), format, value);
+		if (written > 0)
+		{
+			Length += written < Capacity - 1 - Length ? written : Capacity - 1 - Length;
+		}
+		Data[Length] = 0;
+	}
+
+	wchar_t Data[Capacity];
+	int Length;
+};
+
+/// <summary>
+/// For each sequence op, the variables linked to it and what type each one is, worked out on its first activation.
+/// Later activations check the plan against the op's name, outer, links and the linked variables' classes with
+/// pointer compares and rebuild it only when something changed, so the IsA superclass walks happen once per op
+/// rather than once per variable per activation. Plans are kept by op address, so a different op or variable that
+/// reuses an address after a map load is caught by those compares; plans of ops that haven't run for
+/// IdleMilliseconds are dropped.
+/// </summary>
+class LogPlanCache
+{
+public:
+	enum EVarType
+	{
+		VAR_Unknown,
+		VAR_String,
+		VAR_Float,
+		VAR_Int,
+		VAR_Vector,
+		VAR_Bool,
+		VAR_Object,
+		VAR_Name
+	};
+
+	struct FPlannedVar
+	{
+		USequenceVariable* Var;
+		// The variable's class when it was planned. Its type only holds while this is unchanged.
+		UClass* Class;
+		EVarType Type;
+	};
+
+	static const unsigned long long IdleMilliseconds = 60000;
+
+	/// <summary>
+	/// The op's linked variables in link order, with their types.
+	/// </summary>
+	/// <param name="now">A GetTickCount64 time</param>
+	const std::vector<FPlannedVar>& GetPlan(USequenceOp* op, const unsigned long long now)
+	{
+		if (now - LastPrune >= IdleMilliseconds)
+		{
+			Prune(now);
+		}
+		auto& plan = Plans[op];
+		plan.LastUsed = now;
+		if (!Matches(op, plan))
+		{
+			Build(op, plan);
+			Rebuilds++;
+		}
+		return plan.Vars;
+	}
+
+	unsigned GetRebuilds() const
+	{
+		return Rebuilds;
+	}
+
+	static EVarType GetVarType(USequenceVariable* var)
+	{
+		if (!var)
+		{
+			return VAR_Unknown;
+		}
+		// In the order the log used to test them, so subclasses resolve the same way.
+		if (IsA<USeqVar_String>(var)) return VAR_String;
+		if (IsA<USeqVar_Float>(var)) return VAR_Float;
+		if (IsA<USeqVar_Int>(var)) return VAR_Int;
+		if (IsA<USeqVar_Vector>(var)) return VAR_Vector;
+		if (IsA<USeqVar_Bool>(var)) return VAR_Bool;
+		if (IsA<USeqVar_Object>(var)) return VAR_Object;
+		if (IsA<USeqVar_Name>(var)) return VAR_Name;
+		return VAR_Unknown;
+	}
+
+private:
+	struct FPlan
+	{
+		// Which op the plan was built for, so a different op at the same address isn't taken for it.
+		FName ObjectName;
+		UObject* Outer;
+		unsigned long long LastUsed;
+		std::vector<FPlannedVar> Vars;
+	};
+
+	static bool Matches(USequenceOp* op, const FPlan& plan)
+	{
+		if (plan.ObjectName.NameEntry != op->Name.NameEntry || plan.ObjectName.NameIndex != op->Name.NameIndex ||
+			plan.Outer != op->Outer)
+		{
+			return false;
+		}
+		size_t planned = 0;
+		const auto numVarLinks = op->VariableLinks.Num();
+		for (auto i = 0; i < numVarLinks; i++)
+		{
+			const auto& vars = op->VariableLinks(i).LinkedVariables;
+			if (planned + vars.Num() > plan.Vars.size())
+			{
+				return false;
+			}
+			for (auto j = 0; j < vars.Num(); j++, planned++)
+			{
+				const auto& var = plan.Vars[planned];
+				if (var.Var != vars(j) || (var.Var && var.Class != var.Var->Class))
+				{
+					return false;
+				}
+			}
+		}
+		return planned == plan.Vars.size();
+	}
+
+	static void Build(USequenceOp* op, FPlan& plan)
+	{
+		plan.ObjectName = op->Name;
+		plan.Outer = op->Outer;
+		plan.Vars.clear();
+		const auto numVarLinks = op->VariableLinks.Num();
+		for (auto i = 0; i < numVarLinks; i++)
+		{
+			const auto& vars = op->VariableLinks(i).LinkedVariables;
+			for (auto j = 0; j < vars.Num(); j++)
+			{
+				const auto var = vars(j);
+				const FPlannedVar planned = { var, var ? var->Class : nullptr, GetVarType(var) };
+				plan.Vars.push_back(planned);
+			}
+		}
+	}
+
+	void Prune(const unsigned long long now)
+	{
+		for (auto it = Plans.begin(); it != Plans.end();)
+		{
+			if (now - it->second.LastUsed >= IdleMilliseconds)
+			{
+				it = Plans.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+		LastPrune = now;
+	}
+
+	std::unordered_map<USequenceOp*, FPlan> Plans;
+	unsigned long long LastPrune = 0;
+	unsigned Rebuilds = 0;
+};
@@ -11,100 +11,145 @@
 
 #include "../ME3SDK/ME3TweaksHeader.h"
 #include "../ME3SDK/ScreenLogger.h"
-#include "../ME3SDK/SdkHeaders.h"
-#include "../detours/detours.h"
+#include "../ME3SDK/Packages/SFXGame.h"
+#include "../ME3SDK/ProcessEventHub.h"
+#include "LogCoalescer.h"
+#include "LogPlan.h"
 
 #define _CRT_SECURE_NO_WARNINGS
-#pragma comment(lib, "detours.lib") //Library needed for Hooking part.
 
-ME3TweaksASILogger logger("SeqAct_Log Enabler v1", "SeqActLog.txt", false);
+ME3TweaksASILogger logger("SeqAct_Log Enabler v1", "SeqActLog.txt", false, LogBackend::Async);
 ScreenLogger screenLogger(L"SeqAct_Log Enabler v1");
+LogCoalescer coalescer;
+// The op whose message is on the newest screen line, so its repeats can update that line instead of adding more.
+UObject* newestScreenOp = nullptr;
+LogPlanCache logPlans;
+// Each activation formats its line here, so logging doesn't allocate until a line is actually written.
+LogLineBuffer logLine;
 
-wstringstream& operator<<(wstringstream& ss, const FString& fStr)
+bool OnSeqActLogActivated(UObject *pObject, UFunction *pFunction, void *pParms, void *pResult)
 {
-	
-	for (auto i = 0; i < fStr.Num() && fStr(i) != 0; i++)
+	const auto seqLog = static_cast<USeqAct_Log*>(pObject);
+	const auto now = GetTickCount64();
+	logLine.Reset();
+	for (const auto& planned : logPlans.GetPlan(seqLog, now))
 	{
-		ss << fStr(i);
+		const auto seqVar = planned.Var;
+		switch (planned.Type)
+		{
+		case LogPlanCache::VAR_String:
+			logLine.Append(static_cast<USeqVar_String*>(seqVar)->StrValue);
+			break;
+		case LogPlanCache::VAR_Float:
+			logLine.Append(static_cast<USeqVar_Float*>(seqVar)->FloatValue);
+			break;
+		case LogPlanCache::VAR_Int:
+			logLine.Append(static_cast<USeqVar_Int*>(seqVar)->IntValue);
+			break;
+		case LogPlanCache::VAR_Vector:
+		{
+			const auto& vec = static_cast<USeqVar_Vector*>(seqVar)->VectValue;
+			logLine.Append(L'(');
+			logLine.Append(vec.X);
+			logLine.Append(L", ", 2);
+			logLine.Append(vec.Y);
+			logLine.Append(L", ", 2);
+			logLine.Append(vec.Z);
+			logLine.Append(L')');
+			break;
+		}
+		case LogPlanCache::VAR_Bool:
+			logLine.Append(static_cast<USeqVar_Bool*>(seqVar)->bValue ? "True" : "False");
+			break;
+		case LogPlanCache::VAR_Object:
+		{
+			const auto referencedObj = static_cast<USeqVar_Object*>(seqVar)->ObjValue;
+			if (referencedObj == nullptr)
+			{
+				continue;
+			}
+			logLine.Append(referencedObj->GetName());
+			break;
+		}
+		case LogPlanCache::VAR_Name:
+			logLine.Append(static_cast<USeqVar_Name*>(seqVar)->NameValue.GetName());
+			break;
+		default:
+			continue;
+		}
+		logLine.Append(L' ');
 	}
-	return ss;
-}
-
-wstringstream& operator<<(wstringstream& ss, const FVector& vec)
-{
-	ss << "(" << vec.X << ", " << vec.Y << ", " << vec.Z << ")";
-	
-	return ss;
+	logLine.Append(L'\n');
+	const auto decision = coalescer.Submit(seqLog, logLine.GetData(), logLine.Len(), now);
+	if (decision.FlushRepeats > 0)
+	{
+		logger.writeToDiskOnly(L"    last message repeated " + to_wstring(decision.FlushRepeats) + L" more times\n", true);
+	}
+	switch (decision.Verdict)
+	{
+	case LogDecision::Emit:
+		if (decision.Suppressed > 0)
+		{
+			// Annotations go before the newline.
+			logLine.Truncate(logLine.Len() - 1);
+			const auto note = L" [" + to_wstring(decision.Suppressed) + L" rate limited]\n";
+			logLine.Append(note.c_str(), int(note.length()));
+		}
+		logger.writeToDiskOnly(wstring(logLine.GetData(), logLine.Len()), true);
+		screenLogger.LogMessage(logLine.GetData(), logLine.Len());
+		newestScreenOp = seqLog;
+		break;
+	case LogDecision::Repeat:
+	{
+		logLine.Truncate(logLine.Len() - 1);
+		const auto count = L" (x" + to_wstring(decision.Count) + L")\n";
+		logLine.Append(count.c_str(), int(count.length()));
+		if (newestScreenOp == seqLog)
+		{
+			screenLogger.ReplaceNewest(logLine.GetData(), logLine.Len());
+		}
+		else
+		{
+			screenLogger.LogMessage(logLine.GetData(), logLine.Len());
+			newestScreenOp = seqLog;
+		}
+		break;
+	}
+	case LogDecision::Limited:
+		break;
+	}
+	return true;
 }
 
-void __fastcall HookedPE(UObject *pObject, void *edx, UFunction *pFunction, void *pParms, void *pResult)
+/// <summary>
+/// Writes the ops that had the most messages coalesced or rate limited, to find spammy sequences.
+/// </summary>
+void WriteSuppressionReport()
 {
-	const auto funcName = pFunction->GetFullName();
-	if (isPartOf(funcName, "Function Engine.SequenceOp.Activated") && IsA<USeqAct_Log>(pObject))
+	const auto noisiest = coalescer.GetNoisiest(20);
+	if (noisiest.empty())
 	{
-		const auto seqLog = static_cast<USeqAct_Log*>(pObject);
-		wstringstream ss;
-		const auto numVarLinks = seqLog->VariableLinks.Num();
-		for (auto i = 0; i < numVarLinks; i++)
-		{
-			const auto numVars = seqLog->VariableLinks(i).LinkedVariables.Num();
-			for (auto j = 0; j < numVars; j++)
-			{
-				const auto seqVar = seqLog->VariableLinks(i).LinkedVariables(j);
-				if (IsA<USeqVar_String>(seqVar))
-				{
-					ss << static_cast<USeqVar_String*>(seqVar)->StrValue << " ";
-				}
-				else if (IsA<USeqVar_Float>(seqVar))
-				{
-					ss << static_cast<USeqVar_Float*>(seqVar)->FloatValue << " ";
-				}
-				else if (IsA<USeqVar_Int>(seqVar))
-				{
-					ss << static_cast<USeqVar_Int*>(seqVar)->IntValue << " ";
-				}
-				else if (IsA<USeqVar_Vector>(seqVar))
-				{
-					ss << static_cast<USeqVar_Vector*>(seqVar)->VectValue << " ";
-				}
-				else if (IsA<USeqVar_Bool>(seqVar))
-				{
-					ss << (static_cast<USeqVar_Bool*>(seqVar)->bValue ? "True" : "False") << " ";
-				}
-				else if (IsA<USeqVar_Object>(seqVar))
-				{
-					const auto seqVarObj = static_cast<USeqVar_Object*>(seqVar);
-					auto referencedObj = seqVarObj->ObjValue;
-					if (referencedObj != nullptr)
-					{
-						ss << referencedObj->GetName() << " ";
-					}
-				}
-				else if (IsA<USeqVar_Name>(seqVar))
-				{
-					ss << static_cast<USeqVar_Name*>(seqVar)->NameValue.GetName() << " ";
-				}
-			}
-		}
-		ss << endl;
-		const wstring msg = ss.str();
-		logger.writeToDiskOnly(msg, true);
-		screenLogger.LogMessage(msg);
+		return;
 	}
-	else if (!strcmp(funcName, "Function SFXGame.BioHUD.PostRender"))
+	logger.writeToDiskOnly(string("Most suppressed SeqAct_Log ops (written, repeats coalesced, rate limited):\n"), true);
+	for (const auto& stats : noisiest)
 	{
-		const auto hud = static_cast<ABioHUD*>(pObject);
-		screenLogger.PostRenderer(hud);
+		logger.writeToDiskOnly(string_format("    %s: %u, %u, %u\n", stats.Name.c_str(), stats.Written, stats.Coalesced, stats.RateLimited), false);
 	}
-	ProcessEvent(pObject, pFunction, pParms, pResult);
+}
+
+bool OnBioHUDPostRender(UObject *pObject, UFunction *pFunction, void *pParms, void *pResult)
+{
+	const auto hud = static_cast<ABioHUD*>(pObject);
+	screenLogger.PostRenderer(hud);
+	return true;
 }
 
 void onAttach()
 {
-	DetourTransactionBegin();
-	DetourUpdateThread(GetCurrentThread()); //This command set the current working thread to the game current thread.
-	DetourAttach(&(PVOID&)ProcessEvent, HookedPE); //This command will start your Hook.
-	DetourTransactionCommit();
+	ResolveSdkBindings(logger);
+	SubscribeProcessEvent("Function Engine.SequenceOp.Activated", OnSeqActLogActivated, nullptr, &USeqAct_Log::StaticClass);
+	SubscribeProcessEvent("Function SFXGame.BioHUD.PostRender", OnBioHUDPostRender);
 }
 
 BOOL WINAPI DllMain(HMODULE hModule, DWORD dwReason, LPVOID lpReserved)
@@ -118,6 +163,8 @@ BOOL WINAPI DllMain(HMODULE hModule, DWORD dwReason, LPVOID lpReserved)
 		break;
 
 	case DLL_PROCESS_DETACH:
+		WriteSuppressionReport();
+		logger.shutdown();
 		return true;
 		break;
 	}
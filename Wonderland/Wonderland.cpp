@@ -10,11 +10,10 @@
 #include <vector>
 
 #include "..\ME3SDK\ME3TweaksHeader.h"
-#include "..\ME3SDK\SdkHeaders.h"
-#include "..\detours\detours.h"
+#include "..\ME3SDK\Packages\SFXGame.h"
+#include "..\ME3SDK\ProcessEventHub.h"
 
 #define _CRT_SECURE_NO_WARNINGS
-#pragma comment(lib, "detours.lib")
 
 // Utilities.
 // --------------------------------------------------
@@ -71,15 +70,15 @@ template<typename T>
 std::vector<T*> FindObjects(UClass* type, bool allowDefaults = false)
 {
 	std::vector<T*> found;
-
-	const auto objects = UObject::GObjObjects();
-	for (auto i = 0; i < objects->Count; i++)
+	const auto add = [&](UObject* object)
 	{
-		auto object = objects->Data[i];
-		if (object && object->IsA(type) && (allowDefaults || nullptr == strstr(object->Name.GetName(), "Default_")))
-		{
-			found.push_back(reinterpret_cast<T*>(object));
-		}
+		found.push_back(reinterpret_cast<T*>(object));
+		return true;
+	};
+	ObjectIndex::Get().ForEach(type, add);
+	if (allowDefaults)
+	{
+		ObjectIndex::Get().ForEachDefault(type, add);
 	}
 	return found;
 }
@@ -87,16 +86,17 @@ std::vector<T*> FindObjects(UClass* type, bool allowDefaults = false)
 template<typename T>
 T* FindADefaultObject(UClass* type)
 {
-	const auto objects = UObject::GObjObjects();
-	for (auto i = 0; i < objects->Count; i++)
+	T* found = nullptr;
+	ObjectIndex::Get().ForEachDefault(type, [&](UObject* object)
 	{
-		auto object = objects->Data[i];
-		if (object && object->IsA(type) && StringStartsWith(object->Name.GetName(), "Default_"))
+		if (!StringStartsWith(object->Name.GetName(), "Default_"))
 		{
-			return reinterpret_cast<T*>(object);
+			return true;
 		}
-	}
-	return nullptr;
+		found = reinterpret_cast<T*>(object);
+		return false;
+	});
+	return found;
 }
 
 inline USFXEngine* GetGameEngine()
@@ -542,180 +542,185 @@ inline bool ThrowWeapon(wchar_t* subject)
 
 // ProcessEvent.
 // --------------------------------------------------
-void __fastcall HookedPE(UObject* pObject, void* edx, UFunction* pFunction, void* pParms, void* pResult)
-{
-	static bool drawTeleport = false;  // enabled by 'drawtrace' in console
+bool drawTeleport = false;  // enabled by 'drawtrace' in console
 
-	if (drawTeleport && StringEquals(pFunction->GetFullName(), "Function SFXGame.BioHUD.PostRender"))
+bool OnBioHUDPostRender(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult)
+{
+	if (!drawTeleport)
 	{
-		const auto& trace = _tracePlayerView();
+		return true;
+	}
 
-		auto bioHud = reinterpret_cast<ABioHUD*>(pObject);
-		auto hudCanvas = bioHud->Canvas;
+	const auto& trace = _tracePlayerView();
 
-		hudCanvas->SetPos(50.f, 50.f);
-		hudCanvas->SetDrawColor(125, 125, 255, 255);
+	auto bioHud = reinterpret_cast<ABioHUD*>(pObject);
+	auto hudCanvas = bioHud->Canvas;
 
-		wchar_t locLine[256];
-		swprintf(locLine, 255, L"My location: %2.3f, %2.3f, %2.3f\nMy rotation: %d, %d, %d",
-			trace.viewLocation.X, trace.viewLocation.Y, trace.viewLocation.Z,
-			trace.viewRotation.Pitch, trace.viewRotation.Yaw, trace.viewRotation.Roll);
-		hudCanvas->DrawTextW(FString(locLine), 1, 1.0, 1.0, nullptr);
+	hudCanvas->SetPos(50.f, 50.f);
+	hudCanvas->SetDrawColor(125, 125, 255, 255);
 
-		hudCanvas->SetDrawColor(125, 255, 255, 255);
+	wchar_t locLine[256];
+	swprintf(locLine, 255, L"My location: %2.3f, %2.3f, %2.3f\nMy rotation: %d, %d, %d",
+		trace.viewLocation.X, trace.viewLocation.Y, trace.viewLocation.Z,
+		trace.viewRotation.Pitch, trace.viewRotation.Yaw, trace.viewRotation.Roll);
+	hudCanvas->DrawTextW(FString(locLine), 1, 1.0, 1.0, nullptr);
 
-		wchar_t posLine[256];
-		swprintf(posLine, 255, L"Trace: %2.3f, %2.3f, %2.3f",
-			trace.hitLocation.X, trace.hitLocation.Y, trace.hitLocation.Z);
-		hudCanvas->DrawTextW(FString(posLine), 1, 1.0, 1.0, nullptr);
+	hudCanvas->SetDrawColor(125, 255, 255, 255);
 
-		bioHud->DrawDebugSphere(trace.hitLocation, 20.f, 10, 255, 0, 0, 0);
+	wchar_t posLine[256];
+	swprintf(posLine, 255, L"Trace: %2.3f, %2.3f, %2.3f",
+		trace.hitLocation.X, trace.hitLocation.Y, trace.hitLocation.Z);
+	hudCanvas->DrawTextW(FString(posLine), 1, 1.0, 1.0, nullptr);
 
-		auto hitActor = trace.hitActor;
-		if (hitActor)
-		{
-			wchar_t hitLine[256];
-			swprintf(hitLine, 255, L"Hit actor: %S_%d", hitActor->GetFullName(), hitActor->Name.GetIndex());
-			hudCanvas->DrawTextW(FString(hitLine), 1, 1.0, 1.0, nullptr);
+	bioHud->DrawDebugSphere(trace.hitLocation, 20.f, 10, 255, 0, 0, 0);
 
-			hitActor->DrawDebugSphere(hitActor->location, 100.f, 10, 0, 0, 255, 0);
+	auto hitActor = trace.hitActor;
+	if (hitActor)
+	{
+		wchar_t hitLine[256];
+		swprintf(hitLine, 255, L"Hit actor: %S_%d", hitActor->GetFullName(), hitActor->Name.GetIndex());
+		hudCanvas->DrawTextW(FString(hitLine), 1, 1.0, 1.0, nullptr);
 
-			auto collisionComponent = hitActor->CollisionComponent;
-			if (collisionComponent)
-			{
-				hitActor->DrawDebugBox(collisionComponent->Bounds.Origin, collisionComponent->Bounds.BoxExtent, 225, 125, 255, 0);
-			}
+		hitActor->DrawDebugSphere(hitActor->location, 100.f, 10, 0, 0, 255, 0);
+
+		auto collisionComponent = hitActor->CollisionComponent;
+		if (collisionComponent)
+		{
+			hitActor->DrawDebugBox(collisionComponent->Bounds.Origin, collisionComponent->Bounds.BoxExtent, 225, 125, 255, 0);
 		}
 	}
+	return true;
+}
 
-	if (IsA<USFXConsole>(pObject) && StringEquals(pFunction->GetFullName(), "Function Console.Typing.InputChar"))
+bool OnConsoleInputChar(UObject* pObject, UFunction* pFunction, void* pParms, void* pResult)
+{
+	auto sfxConsole = reinterpret_cast<USFXConsole*>(pObject);
+	auto inputParams = reinterpret_cast<UConsole_execInputChar_Parms*>(pParms);
+	if (inputParams->Unicode.Count >= 1 && inputParams->Unicode.Data[0] == '\r')
 	{
-		auto sfxConsole = reinterpret_cast<USFXConsole*>(pObject);
-		auto inputParams = reinterpret_cast<UConsole_execInputChar_Parms*>(pParms);
-		if (inputParams->Unicode.Count >= 1 && inputParams->Unicode.Data[0] == '\r')
+		auto command = sfxConsole->TypedStr.Data;
+
+		auto engine = GetGameEngine();
+		if (engine)
 		{
-			auto command = sfxConsole->TypedStr.Data;
+			auto len = wcslen(command);
 
-			auto engine = GetGameEngine();
-			if (engine)
+			if (StringStartsWith(command, L"mychangesize "))
 			{
-				auto len = wcslen(command);
+				wchar_t subject[16];
+				float scale = 1.f;
 
-				if (StringStartsWith(command, L"mychangesize "))
+				wmemset(subject, 0, 16);
+
+				int read = swscanf(command, L"mychangesize %15ls %f", subject, &scale);
+				if (read == 2)
 				{
-					wchar_t subject[16];
-					float scale = 1.f;
-
-					wmemset(subject, 0, 16);
-
-					int read = swscanf(command, L"mychangesize %15ls %f", subject, &scale);
-					if (read == 2)
-					{
-						wprintf(L"Overriden 'changesize': scaling %s to %f\n", subject, scale);
-						ChangeSize(subject, scale);
-					}
-					else
-					{
-						wprintf(L"Overriden 'changesize': error, read %d\n", read);
-					}
-
-					return;
+					wprintf(L"Overriden 'changesize': scaling %s to %f\n", subject, scale);
+					ChangeSize(subject, scale);
 				}
-
-				if (StringStartsWith(command, L"mysetspeed "))
+				else
 				{
-					wchar_t subject[16];
-					float scale = 1.f;
-
-					wmemset(subject, 0, 16);
-
-					int read = swscanf(command, L"mysetspeed %15ls %f", subject, &scale);
-					if (read == 2)
-					{
-						wprintf(L"Overriden 'setspeed': %s -> %f\n", subject, scale);
-						SetSpeed(subject, scale);
-					}
-					else
-					{
-						wprintf(L"Overriden 'setspeed': error, read %d\n", read);
-					}
-
-					return;
+					wprintf(L"Overriden 'changesize': error, read %d\n", read);
 				}
 
-				if (StringStartsWith(command, L"myteleport "))
+				return false;
+			}
+
+			if (StringStartsWith(command, L"mysetspeed "))
+			{
+				wchar_t subject[16];
+				float scale = 1.f;
+
+				wmemset(subject, 0, 16);
+
+				int read = swscanf(command, L"mysetspeed %15ls %f", subject, &scale);
+				if (read == 2)
+				{
+					wprintf(L"Overriden 'setspeed': %s -> %f\n", subject, scale);
+					SetSpeed(subject, scale);
+				}
+				else
 				{
-					wchar_t subject[16];
-					wmemset(subject, 0, 16);
-					int read = swscanf(command, L"myteleport %15ls", subject);
-					if (read == 1)
-					{
-						wprintf(L"Overriden 'teleport': %s\n", subject);
-						Teleport(subject);
-						return;
-					}
-					else if (read > 0)
-					{
-						wprintf(L"Overriden 'teleport': error, read %d\n", read);
-						return;
-					}
-					else
-					{
-						// let the original command through
-					}
+					wprintf(L"Overriden 'setspeed': error, read %d\n", read);
 				}
 
-				if (StringStartsWith(command, L"mygod "))
+				return false;
+			}
+
+			if (StringStartsWith(command, L"myteleport "))
+			{
+				wchar_t subject[16];
+				wmemset(subject, 0, 16);
+				int read = swscanf(command, L"myteleport %15ls", subject);
+				if (read == 1)
 				{
-					wchar_t subject[16];
-					wmemset(subject, 0, 16);
-
-					int read = swscanf(command, L"mygod %15ls", subject);
-					if (read == 1)
-					{
-						wprintf(L"Overriden 'god': %s\n", subject);
-						God(subject);
-						return;
-					}
-					else
-					{
-						wprintf(L"Overriden 'god': error, read %d\n", read);
-						return;
-					}
+					wprintf(L"Overriden 'teleport': %s\n", subject);
+					Teleport(subject);
+					return false;
 				}
+				else if (read > 0)
+				{
+					wprintf(L"Overriden 'teleport': error, read %d\n", read);
+					return false;
+				}
+				else
+				{
+					// let the original command through
+				}
+			}
+
+			if (StringStartsWith(command, L"mygod "))
+			{
+				wchar_t subject[16];
+				wmemset(subject, 0, 16);
 
-				if (StringStartsWith(command, L"mythrowweapon "))
+				int read = swscanf(command, L"mygod %15ls", subject);
+				if (read == 1)
 				{
-					wchar_t subject[16];
-					wmemset(subject, 0, 16);
-
-					int read = swscanf(command, L"mythrowweapon %15ls", subject);
-					if (read == 1)
-					{
-						wprintf(L"Overriden 'throwweapon': %s\n", subject);
-						ThrowWeapon(subject);
-						return;
-					}
-					else
-					{
-						wprintf(L"Overriden 'throwweapon': error, read %d\n", read);
-						return;
-					}
+					wprintf(L"Overriden 'god': %s\n", subject);
+					God(subject);
+					return false;
 				}
+				else
+				{
+					wprintf(L"Overriden 'god': error, read %d\n", read);
+					return false;
+				}
+			}
 
-				if (StringEquals(command, L"drawtrace"))
+			if (StringStartsWith(command, L"mythrowweapon "))
+			{
+				wchar_t subject[16];
+				wmemset(subject, 0, 16);
+
+				int read = swscanf(command, L"mythrowweapon %15ls", subject);
+				if (read == 1)
+				{
+					wprintf(L"Overriden 'throwweapon': %s\n", subject);
+					ThrowWeapon(subject);
+					return false;
+				}
+				else
 				{
-					drawTeleport = !drawTeleport;
-					return;
+					wprintf(L"Overriden 'throwweapon': error, read %d\n", read);
+					return false;
 				}
 			}
+
+			if (StringEquals(command, L"drawtrace"))
+			{
+				drawTeleport = !drawTeleport;
+				return false;
+			}
 		}
 	}
 
-	ProcessEvent(pObject, pFunction, pParms, pResult);
+	return true;
 }
 
 
+int subscriptions[2];
+
 void OnAttach()
 {
 	SetupConsoleIO();
@@ -739,18 +744,16 @@ void OnAttach()
 	printf("    Some commands may not work properly for some of these.\n");
 	printf("\n");
 
-	DetourTransactionBegin();
-	DetourUpdateThread(GetCurrentThread());
-	DetourAttach(&(PVOID&)ProcessEvent, HookedPE);
-	DetourTransactionCommit();
+	subscriptions[0] = SubscribeProcessEvent("Function SFXGame.BioHUD.PostRender", OnBioHUDPostRender);
+	subscriptions[1] = SubscribeProcessEvent("Function Console.Typing.InputChar", OnConsoleInputChar, nullptr, &USFXConsole::StaticClass);
 }
 
 void OnDetach()
 {
-	DetourTransactionBegin();
-	DetourUpdateThread(GetCurrentThread());
-	DetourDetach(&(PVOID&)ProcessEvent, HookedPE);
-	DetourTransactionCommit();
+	for (const auto subscription : subscriptions)
+	{
+		GetProcessEventHub()->Unsubscribe(subscription);
+	}
 
 	TeardownConsoleIO();
 }